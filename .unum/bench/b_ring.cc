@@ -0,0 +1,550 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+/*
+ *  Checks the shared memory rings (u_ring) between processes and times
+ *  them against Unix domain sockets.  The checks are that three producers
+ *  and two consumers on one ring deliver every message once and in each
+ *  producer's order, that an oversize message is refused, that receiving
+ *  from an empty ring and sending to a full one give up when they should,
+ *  and that a ring can be attached from its descriptor.  The timings are
+ *  the round trip of a 64 byte message to a child process and back, and
+ *  the rate a child receives a stream of them sent singly and in batches.
+ *  The descriptors are handed to the child over a socket, as a kernel
+ *  would.  A failed check is reported and the exit status is non-zero.
+ *
+ *    make bench-ring
+ *    (or) b_ring [round trips]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_ring.h"
+
+#define MSG_SIZE        64
+#define MAX_BATCH       64
+#define NUM_SLOTS       1024
+#define STREAM_SCALE    20      // - messages streamed for each round trip
+#define MPMC_PRODUCERS  3
+#define MPMC_CONSUMERS  2
+#define MPMC_PER        40000   // - messages sent by each producer
+
+
+static double now_secs( void ) {
+	struct timespec ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+
+static int cmp_double( const void *a, const void *b ) {
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+
+static bool send_fd( int sock, int fd ) {
+	char           tag = 'r';
+	struct iovec   iov = { &tag, 1 };
+	struct msghdr  msg;
+	union {
+		struct cmsghdr hdr;
+		char           buf[CMSG_SPACE(sizeof(int))];
+	} ctl;
+	
+	std::memset(&msg, 0, sizeof(msg));
+	std::memset(&ctl, 0, sizeof(ctl));
+	msg.msg_iov        = &iov;
+	msg.msg_iovlen     = 1;
+	msg.msg_control    = ctl.buf;
+	msg.msg_controllen = sizeof(ctl.buf);
+	CMSG_FIRSTHDR(&msg)->cmsg_level = SOL_SOCKET;
+	CMSG_FIRSTHDR(&msg)->cmsg_type  = SCM_RIGHTS;
+	CMSG_FIRSTHDR(&msg)->cmsg_len   = CMSG_LEN(sizeof(int));
+	std::memcpy(CMSG_DATA(CMSG_FIRSTHDR(&msg)), &fd, sizeof(int));
+	return sendmsg(sock, &msg, 0) == 1;
+}
+
+
+static int recv_fd( int sock ) {
+	char           tag;
+	struct iovec   iov = { &tag, 1 };
+	struct msghdr  msg;
+	int            fd;
+	union {
+		struct cmsghdr hdr;
+		char           buf[CMSG_SPACE(sizeof(int))];
+	} ctl;
+	
+	std::memset(&msg, 0, sizeof(msg));
+	msg.msg_iov        = &iov;
+	msg.msg_iovlen     = 1;
+	msg.msg_control    = ctl.buf;
+	msg.msg_controllen = sizeof(ctl.buf);
+	if (recvmsg(sock, &msg, 0) != 1 || !CMSG_FIRSTHDR(&msg)) {
+		return -1;
+	}
+	
+	std::memcpy(&fd, CMSG_DATA(CMSG_FIRSTHDR(&msg)), sizeof(int));
+	return fd;
+}
+
+
+static bool read_msg( int fd, char *buf ) {
+	size_t  got = 0;
+	ssize_t rc;
+	
+	while (got < MSG_SIZE) {
+		if ((rc = read(fd, buf + got, MSG_SIZE - got)) <= 0) {
+			return false;
+		}
+		got += (size_t) rc;
+	}
+	return true;
+}
+
+
+static bool wait_child( pid_t pid ) {
+	int status;
+	
+	return pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+	       WEXITSTATUS(status) == 0;
+}
+
+
+static const char *kind_name( un::ring_kind_e kind ) {
+	return kind == un::RING_SPSC ? "spsc" : "mpmc";
+}
+
+
+static void print_trips( const char *name, double *lat, int num ) {
+	std::qsort(lat, (size_t) num, sizeof(double), cmp_double);
+	std::printf("%-16s round trip  %6.2f us  (p90 %.2f, p99 %.2f)\n", name,
+	            lat[num / 2] * 1e6, lat[num * 9 / 10] * 1e6,
+	            lat[num * 99 / 100] * 1e6);
+}
+
+
+static void print_rate( const char *name, int batch, int num, double secs ) {
+	std::printf("%-16s batch %2d  %6.2f M msg/s  (%.0f MB/s)\n", name, batch,
+	            num / secs / 1e6, num * (double) MSG_SIZE / secs / 1e6);
+}
+
+
+/*
+ *  Every producer sends its own sequence and every consumer checks that
+ *  what it takes from each producer only ever moves forward, and reports
+ *  its count and sum back through a pipe once the ring stays empty.
+ */
+static bool check_mpmc( void ) {
+	un::ring_t *ring = un::ring_create(un::RING_MPMC, 64, 16);
+	pid_t      pids[MPMC_PRODUCERS + MPMC_CONSUMERS];
+	int        num_pids = 0, report[2];
+	long long  sum = 0, count = 0, num_bad = 0, expect;
+	bool       is_ok = true;
+	
+	if (!ring || pipe(report) != 0) {
+		return false;
+	}
+	
+	for (int c = 0; c < MPMC_CONSUMERS; c++) {
+		if ((pids[num_pids++] = fork()) == 0) {
+			char           bufs[16][16];
+			un::ring_msg_t msgs[16];
+			int            last[MPMC_PRODUCERS];
+			long long      out[3] = { 0, 0, 0 };
+			unsigned       num;
+			
+			for (int i = 0; i < MPMC_PRODUCERS; i++) {
+				last[i] = -1;
+			}
+			for (;;) {
+				for (int i = 0; i < 16; i++) {
+					msgs[i].data = bufs[i];
+					msgs[i].len  = 16;
+				}
+				if (!(num = un::ring_recv(ring, msgs, 16, 500))) {
+					break;
+				}
+				for (unsigned i = 0; i < num; i++) {
+					int from, seq;
+					
+					std::memcpy(&from, bufs[i], sizeof(int));
+					std::memcpy(&seq, bufs[i] + sizeof(int), sizeof(int));
+					out[1]++;
+					if (from < 0 || from >= MPMC_PRODUCERS || seq <= last[from]) {
+						out[2]++;
+						continue;
+					}
+					last[from]  = seq;
+					out[0]     += seq;
+				}
+			}
+			_exit(write(report[1], out, sizeof(out)) == sizeof(out) ? 0 : 1);
+		}
+	}
+	
+	for (int p = 0; p < MPMC_PRODUCERS; p++) {
+		if ((pids[num_pids++] = fork()) == 0) {
+			char           bufs[8][16];
+			un::ring_msg_t msgs[8];
+			
+			for (int i = 0; i < MPMC_PER; i += 8) {
+				for (int j = 0; j < 8; j++) {
+					int seq = i + j;
+					
+					std::memcpy(bufs[j], &p, sizeof(int));
+					std::memcpy(bufs[j] + sizeof(int), &seq, sizeof(int));
+					msgs[j].data = bufs[j];
+					msgs[j].len  = 16;
+				}
+				if (un::ring_send(ring, msgs, 8, -1) != 8) {
+					_exit(1);
+				}
+			}
+			_exit(0);
+		}
+	}
+	
+	for (int i = 0; i < num_pids; i++) {
+		is_ok = wait_child(pids[i]) && is_ok;
+	}
+	for (int c = 0; c < MPMC_CONSUMERS; c++) {
+		long long out[3];
+		
+		if (read(report[0], out, sizeof(out)) != sizeof(out)) {
+			is_ok = false;
+			break;
+		}
+		sum     += out[0];
+		count   += out[1];
+		num_bad += out[2];
+	}
+	close(report[0]);
+	close(report[1]);
+	un::ring_close(ring);
+	
+	expect = (long long) MPMC_PRODUCERS * MPMC_PER * (MPMC_PER - 1) / 2;
+	is_ok  = is_ok && count == MPMC_PRODUCERS * MPMC_PER && sum == expect &&
+	         num_bad == 0;
+	std::printf("mpmc %d producers, %d consumers: %lld of %d delivered, "
+	            "%lld out of order%s\n", MPMC_PRODUCERS, MPMC_CONSUMERS, count,
+	            MPMC_PRODUCERS * MPMC_PER, num_bad, is_ok ? "" : ", FAILED");
+	return is_ok;
+}
+
+
+// ...the parent sends on one ring and the child echoes on the other
+static bool ring_trips( un::ring_kind_e kind, int num ) {
+	un::ring_t *out = un::ring_create(kind, 256, MSG_SIZE);
+	un::ring_t *in  = un::ring_create(kind, 256, MSG_SIZE);
+	double     *lat = (double *) std::malloc(sizeof(double) * (size_t) num);
+	char       buf[MSG_SIZE], reply[MSG_SIZE], name[32];
+	int        sp[2], num_bad = 0;
+	pid_t      pid;
+	bool       is_ok;
+	
+	if (!out || !in || !lat || socketpair(AF_UNIX, SOCK_STREAM, 0, sp) != 0) {
+		return false;
+	}
+	
+	if ((pid = fork()) == 0) {
+		un::ring_t *c_in, *c_out;
+		
+		close(sp[0]);
+		c_in  = un::ring_attach(recv_fd(sp[1]));
+		c_out = un::ring_attach(recv_fd(sp[1]));
+		for (int i = 0; c_in && c_out && i < num; i++) {
+			un::ring_msg_t msg = { buf, MSG_SIZE };
+			
+			if (un::ring_recv(c_in, &msg, 1, -1) != 1 ||
+			    un::ring_send(c_out, &msg, 1, -1) != 1) {
+				_exit(1);
+			}
+		}
+		_exit(c_in && c_out ? 0 : 1);
+	}
+	
+	send_fd(sp[0], un::ring_fd(out));
+	send_fd(sp[0], un::ring_fd(in));
+	std::memset(buf, 0, sizeof(buf));
+	for (int i = 0; i < num; i++) {
+		un::ring_msg_t msg = { buf, MSG_SIZE }, ans = { reply, MSG_SIZE };
+		double         start = now_secs();
+		int            seq;
+		
+		std::memcpy(buf, &i, sizeof(int));
+		if (un::ring_send(out, &msg, 1, 1000) != 1 ||
+		    un::ring_recv(in, &ans, 1, 1000) != 1) {
+			num_bad = num - i;
+			break;
+		}
+		lat[i] = now_secs() - start;
+		std::memcpy(&seq, reply, sizeof(int));
+		num_bad += (seq != i || ans.len != MSG_SIZE);
+	}
+	
+	is_ok = wait_child(pid) && num_bad == 0;
+	std::snprintf(name, sizeof(name), "ring %s", kind_name(kind));
+	if (is_ok) {
+		print_trips(name, lat, num);
+	} else {
+		std::printf("%s round trip FAILED, %d bad\n", name, num_bad);
+	}
+	
+	un::ring_close(out);
+	un::ring_close(in);
+	close(sp[0]);
+	close(sp[1]);
+	std::free(lat);
+	return is_ok;
+}
+
+
+static bool sock_trips( int type, int num ) {
+	double *lat = (double *) std::malloc(sizeof(double) * (size_t) num);
+	char   buf[MSG_SIZE];
+	int    sp[2];
+	pid_t  pid;
+	
+	if (!lat || socketpair(AF_UNIX, type, 0, sp) != 0) {
+		return false;
+	}
+	
+	if ((pid = fork()) == 0) {
+		close(sp[0]);
+		for (int i = 0; i < num; i++) {
+			if (!read_msg(sp[1], buf) || write(sp[1], buf, MSG_SIZE) != MSG_SIZE) {
+				_exit(1);
+			}
+		}
+		_exit(0);
+	}
+	
+	close(sp[1]);
+	std::memset(buf, 0, sizeof(buf));
+	for (int i = 0; i < num; i++) {
+		double start = now_secs();
+		
+		if (write(sp[0], buf, MSG_SIZE) != MSG_SIZE || !read_msg(sp[0], buf)) {
+			close(sp[0]);
+			std::free(lat);
+			wait_child(pid);
+			return false;
+		}
+		lat[i] = now_secs() - start;
+	}
+	
+	print_trips(type == SOCK_STREAM ? "unix stream" : "unix seqpacket", lat,
+	            num);
+	close(sp[0]);
+	std::free(lat);
+	return wait_child(pid);
+}
+
+
+// ...the child checks the sum of the sequence it receives
+static bool ring_stream( un::ring_kind_e kind, int num, int batch ) {
+	un::ring_t     *ring = un::ring_create(kind, NUM_SLOTS, MSG_SIZE);
+	char           bufs[MAX_BATCH][MSG_SIZE], name[32];
+	un::ring_msg_t msgs[MAX_BATCH];
+	double         start;
+	int            sp[2];
+	pid_t          pid;
+	bool           is_ok;
+	
+	if (!ring || socketpair(AF_UNIX, SOCK_STREAM, 0, sp) != 0) {
+		return false;
+	}
+	
+	if ((pid = fork()) == 0) {
+		un::ring_t *c_ring = un::ring_attach(recv_fd(sp[1]));
+		long long  sum     = 0;
+		int        got     = 0;
+		unsigned   n;
+		
+		while (c_ring && got < num) {
+			for (int i = 0; i < MAX_BATCH; i++) {
+				msgs[i].data = bufs[i];
+				msgs[i].len  = MSG_SIZE;
+			}
+			n = un::ring_recv(c_ring, msgs, MAX_BATCH, 1000);
+			for (unsigned i = 0; i < n; i++) {
+				int seq;
+				
+				std::memcpy(&seq, bufs[i], sizeof(int));
+				sum += seq;
+			}
+			if (!n) {
+				break;
+			}
+			got += (int) n;
+		}
+		_exit(sum == (long long) num * (num - 1) / 2 ? 0 : 1);
+	}
+	
+	send_fd(sp[0], un::ring_fd(ring));
+	start = now_secs();
+	for (int i = 0; i < num; i += batch) {
+		int n = batch < num - i ? batch : num - i;
+		
+		for (int j = 0; j < n; j++) {
+			int seq = i + j;
+			
+			std::memcpy(bufs[j], &seq, sizeof(int));
+			msgs[j].data = bufs[j];
+			msgs[j].len  = MSG_SIZE;
+		}
+		if ((int) un::ring_send(ring, msgs, (unsigned) n, 1000) != n) {
+			break;
+		}
+	}
+	
+	is_ok = wait_child(pid);
+	std::snprintf(name, sizeof(name), "ring %s", kind_name(kind));
+	if (is_ok) {
+		print_rate(name, batch, num, now_secs() - start);
+	} else {
+		std::printf("%s stream FAILED\n", name);
+	}
+	
+	un::ring_close(ring);
+	close(sp[0]);
+	close(sp[1]);
+	return is_ok;
+}
+
+
+static bool sock_stream( int num, int batch ) {
+	static char buf[MAX_BATCH * MSG_SIZE];
+	long long   total = (long long) num * MSG_SIZE;
+	double      start;
+	int         sp[2];
+	pid_t       pid;
+	
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sp) != 0) {
+		return false;
+	}
+	
+	if ((pid = fork()) == 0) {
+		ssize_t rc;
+		
+		close(sp[0]);
+		while (total > 0) {
+			if ((rc = read(sp[1], buf, sizeof(buf))) <= 0) {
+				_exit(1);
+			}
+			total -= rc;
+		}
+		_exit(0);
+	}
+	
+	close(sp[1]);
+	start = now_secs();
+	for (int i = 0; i < num; i += batch) {
+		size_t  len = (size_t) (batch < num - i ? batch : num - i) * MSG_SIZE;
+		size_t  pos = 0;
+		ssize_t rc;
+		
+		while (pos < len) {
+			if ((rc = write(sp[0], buf + pos, len - pos)) <= 0) {
+				close(sp[0]);
+				wait_child(pid);
+				return false;
+			}
+			pos += (size_t) rc;
+		}
+	}
+	
+	close(sp[0]);
+	if (!wait_child(pid)) {
+		return false;
+	}
+	print_rate("unix stream", batch, num, now_secs() - start);
+	return true;
+}
+
+
+static bool check_limits( void ) {
+	un::ring_t     *ring = un::ring_create(un::RING_SPSC, 2, 8), *other;
+	char           big[9], buf[8];
+	un::ring_msg_t over = { big, sizeof(big) }, one = { buf, sizeof(buf) };
+	un::ring_msg_t three[3] = { { buf, 8 }, { buf, 8 }, { buf, 8 } };
+	unsigned       num;
+	double         start, waited;
+	bool           is_ok = ring != NULL;
+	
+	if (!is_ok) {
+		return false;
+	}
+	
+	std::memset(big, 0, sizeof(big));
+	std::memset(buf, 0, sizeof(buf));
+	num    = un::ring_send(ring, &over, 1, 100);
+	is_ok  = num == 0;
+	std::printf("oversize message: %u queued%s\n", num, num ? ", FAILED" : "");
+	
+	start  = now_secs();
+	num    = un::ring_recv(ring, &one, 1, 50);
+	waited = (now_secs() - start) * 1e3;
+	is_ok  = is_ok && num == 0 && waited >= 45.0;
+	std::printf("empty ring: %u received after %.0f ms of 50%s\n", num, waited,
+	            num || waited < 45.0 ? ", FAILED" : "");
+	
+	start  = now_secs();
+	num    = un::ring_send(ring, three, 3, 30);
+	waited = (now_secs() - start) * 1e3;
+	is_ok  = is_ok && num == 2 && waited >= 25.0;
+	std::printf("full ring: %u of 3 queued after %.0f ms of 30%s\n", num,
+	            waited, num != 2 || waited < 25.0 ? ", FAILED" : "");
+	
+	other = un::ring_attach(un::ring_fd(ring));
+	is_ok = is_ok && other && un::ring_slot_size(other) == 8 &&
+	        un::ring_recv(other, three, 3, 0) == 2 && !un::ring_attach(0);
+	std::printf("attach: %s\n", other ? "ok" : "FAILED");
+	if (other) {
+		un::ring_close(other);
+	}
+	
+	un::ring_close(ring);
+	return is_ok;
+}
+
+
+int main( int argc, char **argv ) {
+	int  num     = argc > 1 ? std::atoi(argv[1]) : 100000;
+	int  sizes[] = { 1, 32 };
+	bool is_ok   = true;
+	
+	num   = num < 100 ? 100 : num;
+	is_ok = check_mpmc() && is_ok;
+	is_ok = check_limits() && is_ok;
+	
+	is_ok = ring_trips(un::RING_SPSC, num) && is_ok;
+	is_ok = ring_trips(un::RING_MPMC, num) && is_ok;
+	is_ok = sock_trips(SOCK_STREAM, num) && is_ok;
+	is_ok = sock_trips(SOCK_SEQPACKET, num) && is_ok;
+	
+	for (int i = 0; i < 2; i++) {
+		is_ok = ring_stream(un::RING_SPSC, num * STREAM_SCALE, sizes[i]) && is_ok;
+		is_ok = ring_stream(un::RING_MPMC, num * STREAM_SCALE, sizes[i]) && is_ok;
+		is_ok = sock_stream(num * STREAM_SCALE, sizes[i]) && is_ok;
+	}
+	
+	std::printf("(median of %d round trips, %d streamed)\n", num,
+	            num * STREAM_SCALE);
+	return is_ok ? 0 : 1;
+}
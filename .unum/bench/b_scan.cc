@@ -0,0 +1,198 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+/*
+ *  Times the include scanner (d_scan) against a synthetic tree of 10,000
+ *  headers (40MB on disk) and 2,000 sources, each header including five
+ *  others so that the graph is densely connected.  One source has a
+ *  macro-computed include and one in five a guarded one.  The tree is
+ *  generated under <dir> on the first run and reused after that.
+ *
+ *    make bench-scan
+ *    (or) b_scan <dir> [runs]
+ */
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "u_common.h"
+#include "deploy/d_scan.h"
+
+#define NUM_HEADERS   10000
+#define NUM_SOURCES   2000
+#define NUM_INCLUDES  5
+#define BODY_LINES    30
+#define MAX_RUNS      32
+
+
+static unsigned long long seed = 0x2545f4914f6cdd1dULL;
+
+
+static unsigned next_rand( void ) {
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	return (unsigned) (seed >> 33);
+}
+
+
+static double now_secs( void ) {
+	struct timespec ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+
+static int cmp_double( const void *a, const void *b ) {
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+
+static bool write_header( const char *dir, int n ) {
+	char path[PATH_MAX];
+	FILE *fp;
+	
+	std::snprintf(path, sizeof(path), "%s/inc/h%d.h", dir, n);
+	if (!(fp = std::fopen(path, "w"))) {
+		return false;
+	}
+	
+	std::fprintf(fp, "#pragma once\n/* header %d */\n#include <vector>\n", n);
+	for (int i = 0; i < NUM_INCLUDES; i++) {
+		std::fprintf(fp, "#include \"h%u.h\"\n", next_rand() % NUM_HEADERS);
+	}
+	std::fprintf(fp, "#ifdef X\n#include \"h%u.h\"\n#endif\n",
+	             next_rand() % NUM_HEADERS);
+	
+	// - a literal that looks like a comment and a little over 1KB of code
+	std::fprintf(fp, "struct S%d { int a; const char *s = \"x//y\"; };\n", n);
+	for (int i = 0; i < BODY_LINES; i++) {
+		std::fprintf(fp, "inline int f%d_%d(int x) { return x * %d; }\n", n, i,
+		             i);
+	}
+	
+	std::fclose(fp);
+	return true;
+}
+
+
+static bool write_source( const char *dir, int n ) {
+	char path[PATH_MAX];
+	FILE *fp;
+	
+	std::snprintf(path, sizeof(path), "%s/src/s%d.cc", dir, n);
+	if (!(fp = std::fopen(path, "w"))) {
+		return false;
+	}
+	
+	// - a computed include makes the scanner fall back for that source
+	if (n == 0) {
+		std::fprintf(fp, "#define M \"h%u.h\"\n#include M\n",
+		             next_rand() % NUM_HEADERS);
+	}
+	for (int i = 0; i < NUM_INCLUDES; i++) {
+		std::fprintf(fp, "#include \"h%u.h\"\n", next_rand() % NUM_HEADERS);
+	}
+	if (n % 5 == 0) {
+		std::fprintf(fp, "#if 0\n#include \"h%u.h\"\n#endif\n",
+		             next_rand() % NUM_HEADERS);
+	}
+	std::fprintf(fp, "int main_%d() { return 0; }\n", n);
+	
+	std::fclose(fp);
+	return true;
+}
+
+
+static bool make_tree( const char *dir ) {
+	char        path[PATH_MAX];
+	struct stat s;
+	
+	std::snprintf(path, sizeof(path), "%s/src/s%d.cc", dir, NUM_SOURCES - 1);
+	if (stat(path, &s) == 0) {
+		return true;
+	}
+	
+	std::printf("generating %d headers and %d sources in %s\n", NUM_HEADERS,
+	            NUM_SOURCES, dir);
+	mkdir(dir, S_IRWXU);
+	std::snprintf(path, sizeof(path), "%s/inc", dir);
+	mkdir(path, S_IRWXU);
+	std::snprintf(path, sizeof(path), "%s/src", dir);
+	mkdir(path, S_IRWXU);
+	
+	for (int i = 0; i < NUM_HEADERS; i++) {
+		if (!write_header(dir, i)) {
+			return false;
+		}
+	}
+	for (int i = 0; i < NUM_SOURCES; i++) {
+		if (!write_source(dir, i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+int main( int argc, char **argv ) {
+	const char *dir  = argc > 1 ? argv[1] : "scan-tree";
+	int        runs  = argc > 2 ? std::atoi(argv[2]) : 7;
+	double     scan_t[MAX_RUNS], digest_t[MAX_RUNS], start;
+	int        num_opaque = 0, num_nodes = 0;
+	char       inc[PATH_MAX], path[PATH_MAX];
+	const char *inc_dirs[] = { inc, NULL };
+	
+	runs = runs < 1 ? 1 : (runs > MAX_RUNS ? MAX_RUNS : runs);
+	if (!make_tree(dir)) {
+		std::fprintf(stderr, "b_scan: failed to generate %s\n", dir);
+		return 1;
+	}
+	std::snprintf(inc, sizeof(inc), "%s/inc", dir);
+	
+	for (int r = 0; r < runs; r++) {
+		un::scan_t *scan = un::scan_open(inc_dirs);
+		int        ids[NUM_SOURCES];
+		
+		if (!scan) {
+			return 1;
+		}
+		
+		start = now_secs();
+		for (int i = 0; i < NUM_SOURCES; i++) {
+			std::snprintf(path, sizeof(path), "%s/src/s%d.cc", dir, i);
+			ids[i] = un::scan_file(scan, path);
+		}
+		scan_t[r] = now_secs() - start;
+		
+		start      = now_secs();
+		num_opaque = 0;
+		for (int i = 0; i < NUM_SOURCES; i++) {
+			un::hash_t h;
+			time_t     mtime;
+			
+			num_opaque += !un::scan_digest(scan, ids[i], &h, &mtime);
+		}
+		digest_t[r] = now_secs() - start;
+		num_nodes   = un::scan_count(scan);
+		un::scan_close(scan);
+	}
+	
+	std::qsort(scan_t, (size_t) runs, sizeof(double), cmp_double);
+	std::qsort(digest_t, (size_t) runs, sizeof(double), cmp_double);
+	std::printf("%d files known, %d of %d sources fall back\n", num_nodes,
+	            num_opaque, NUM_SOURCES);
+	std::printf("scan every source          %8.1f ms\n", scan_t[runs / 2] * 1e3);
+	std::printf("digest every closure       %8.1f ms\n",
+	            digest_t[runs / 2] * 1e3);
+	std::printf("(median of %d runs)\n", runs);
+	return 0;
+}
@@ -0,0 +1,203 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+/*
+ *  Times the tree snapshot (d_snap) against a synthetic tree of 100,000
+ *  small files in 1,100 directories, comparing a full rescan, a stat of
+ *  every path and a diff against the snapshot, both with no edits and
+ *  after five files are appended to, one added and one removed.  The
+ *  edits are undone after each run.  The tree is generated under <dir>
+ *  on the first run and reused after that, the snapshot is kept beside
+ *  it in <dir>.snap.
+ *
+ *    make bench-snap
+ *    (or) b_snap <dir> [runs]
+ */
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "deploy/d_snap.h"
+
+#define NUM_TOP       100
+#define NUM_SUB       10
+#define NUM_LEAF      100
+#define NUM_FILES     (NUM_TOP * NUM_SUB * NUM_LEAF)
+#define NUM_APPENDS   5
+#define APPEND_STEP   19997   // - spreads the appends across directories
+#define REMOVED_FILE  77777
+#define MAX_RUNS      32
+
+
+static double now_secs( void ) {
+	struct timespec ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+
+static int cmp_double( const void *a, const void *b ) {
+	double x = *(const double *) a, y = *(const double *) b;
+	return (x > y) - (x < y);
+}
+
+
+static void file_path( char *buf, size_t len, const char *dir, int n ) {
+	std::snprintf(buf, len, "%s/d%02d/s%d/f%03d.h", dir, n / (NUM_SUB * NUM_LEAF),
+	              (n / NUM_LEAF) % NUM_SUB, n % NUM_LEAF);
+}
+
+
+static bool write_file( const char *path, const char *text ) {
+	FILE *fp = std::fopen(path, "w");
+	
+	if (!fp) {
+		return false;
+	}
+	std::fputs(text, fp);
+	return std::fclose(fp) == 0;
+}
+
+
+static bool make_tree( const char *dir ) {
+	char        path[PATH_MAX];
+	struct stat s;
+	
+	file_path(path, sizeof(path), dir, NUM_FILES - 1);
+	if (stat(path, &s) == 0) {
+		return true;
+	}
+	
+	std::printf("generating %d files in %s\n", NUM_FILES, dir);
+	mkdir(dir, S_IRWXU);
+	for (int a = 0; a < NUM_TOP; a++) {
+		std::snprintf(path, sizeof(path), "%s/d%02d", dir, a);
+		mkdir(path, S_IRWXU);
+		for (int b = 0; b < NUM_SUB; b++) {
+			std::snprintf(path, sizeof(path), "%s/d%02d/s%d", dir, a, b);
+			mkdir(path, S_IRWXU);
+		}
+	}
+	
+	for (int i = 0; i < NUM_FILES; i++) {
+		file_path(path, sizeof(path), dir, i);
+		if (!write_file(path, "int x;\n")) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// ...appends to a few files, adds one and removes another
+static void edit_tree( const char *dir, const char *added, int removed ) {
+	char path[PATH_MAX];
+	FILE *fp;
+	
+	for (int i = 0; i < NUM_APPENDS; i++) {
+		file_path(path, sizeof(path), dir, i * APPEND_STEP);
+		if ((fp = std::fopen(path, "a"))) {
+			std::fputs("int y;\n", fp);
+			std::fclose(fp);
+		}
+	}
+	
+	write_file(added, "");
+	file_path(path, sizeof(path), dir, removed);
+	unlink(path);
+}
+
+
+static void restore_tree( const char *dir, const char *added, int removed ) {
+	char path[PATH_MAX];
+	
+	unlink(added);
+	file_path(path, sizeof(path), dir, removed);
+	write_file(path, "int x;\n");
+}
+
+
+int main( int argc, char **argv ) {
+	const char *dir        = argc > 1 ? argv[1] : "snap-tree";
+	int        runs        = argc > 2 ? std::atoi(argv[2]) : 7;
+	int        num_changed = 0;
+	double     build_t[MAX_RUNS], stat_t[MAX_RUNS], same_t[MAX_RUNS];
+	double     edit_t[MAX_RUNS], start;
+	char       snap_file[PATH_MAX], added[PATH_MAX], path[PATH_MAX];
+	const char *dirs[] = { dir };
+	bool       is_recursive[] = { true };
+	
+	runs = runs < 1 ? 1 : (runs > MAX_RUNS ? MAX_RUNS : runs);
+	if (!make_tree(dir)) {
+		std::fprintf(stderr, "b_snap: failed to generate %s\n", dir);
+		return 1;
+	}
+	std::snprintf(snap_file, sizeof(snap_file), "%s.snap", dir);
+	std::snprintf(added, sizeof(added), "%s/d42/s3/new.h", dir);
+	
+	for (int r = 0; r < runs; r++) {
+		un::snap_t        *snap;
+		un::journal_log_t log;
+		struct stat       s;
+		
+		start      = now_secs();
+		snap       = un::snap_build(dirs, is_recursive, 1, NULL);
+		build_t[r] = now_secs() - start;
+		if (!snap || !un::snap_save(snap, snap_file)) {
+			std::fprintf(stderr, "b_snap: failed to save %s\n", snap_file);
+			return 1;
+		}
+		un::snap_close(snap);
+		
+		start = now_secs();
+		for (int i = 0; i < NUM_FILES; i++) {
+			file_path(path, sizeof(path), dir, i);
+			stat(path, &s);
+		}
+		stat_t[r] = now_secs() - start;
+		
+		if (!(snap = un::snap_load(snap_file))) {
+			return 1;
+		}
+		start = now_secs();
+		un::snap_diff(snap, &log);
+		same_t[r] = now_secs() - start;
+		un::journal_free(&log);
+		
+		// - modification times must move past the snapshot's
+		usleep(10000);
+		edit_tree(dir, added, REMOVED_FILE);
+		start = now_secs();
+		un::snap_diff(snap, &log);
+		edit_t[r]   = now_secs() - start;
+		num_changed = log.num_paths;
+		un::journal_free(&log);
+		un::snap_close(snap);
+		restore_tree(dir, added, REMOVED_FILE);
+	}
+	
+	std::qsort(build_t, (size_t) runs, sizeof(double), cmp_double);
+	std::qsort(stat_t, (size_t) runs, sizeof(double), cmp_double);
+	std::qsort(same_t, (size_t) runs, sizeof(double), cmp_double);
+	std::qsort(edit_t, (size_t) runs, sizeof(double), cmp_double);
+	std::printf("%d files, %d paths changed by the edits\n", NUM_FILES,
+	            num_changed);
+	std::printf("full rescan (readdir + stat) %8.1f ms\n", build_t[runs / 2] * 1e3);
+	std::printf("stat every path              %8.1f ms\n", stat_t[runs / 2] * 1e3);
+	std::printf("snapshot diff, no edits      %8.1f ms\n", same_t[runs / 2] * 1e3);
+	std::printf("snapshot diff, %d edits       %8.1f ms\n", NUM_APPENDS + 2,
+	            edit_t[runs / 2] * 1e3);
+	std::printf("(median of %d runs)\n", runs);
+	return 0;
+}
@@ -26,6 +26,7 @@
 #include <limits.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 // ...test that this is a C++ compiler
@@ -33,6 +34,10 @@
 #include <cstdio>
 #include <cstdlib>
 
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
 
 typedef enum {
 	A_CXX = 0,
@@ -44,6 +49,7 @@ typedef enum {
 typedef enum {
 	P_UNKNOWN = 0,
 	P_MACOS,
+	P_LINUX,
 } platform_e;
 
 typedef const char **cstrarr_t;
@@ -52,27 +58,40 @@ typedef const char **cstrarr_t;
 static cstrarr_t arr_add( cstrarr_t arr, const char *text );
 static void build_pre_k( void );
 static void config_basis( void );
+static void cxx_fingerprint( void );
+static void detect_capabilities( void );
+static void detect_hardware( void );
 static void detect_path_style( void );
 static void detect_platform( void );
 static struct stat file_info( const char *path );
 static char *find_in_path( const char *cmd );
+static unsigned long long fnv1a( unsigned long long hash, const char *text );
+static int hw_count_list( const char *path );
+static long hw_read_size( const char *path );
 static bool last_header_mod( const char *dir_path, time_t *last_mod );
 static const char *parse_option( const char *optName, const char *from );
 static void parse_cmd_line( int argc, char *argv[] );
 static void printf_config( const char *fmt, ... );
+static int probe_cc( const char *name, const char *source );
+static const int *probe_find( const char *name );
+static void probe_set( const char *name, int rc );
+static void probe_load( void );
+static void probe_save( void );
 static const char *resolve_cmd( const char *cmd );
 static void read_manifest( cstrarr_t *inc_dirs, cstrarr_t *src_files,
                            time_t *last_mod );
 static char *rstrcat( char *buf, const char *text );
-static int run_cc( const char *bin_file, cstrarr_t pp_defs, cstrarr_t inc_dirs,
-                   cstrarr_t src_files );
-static int run_cc_with_source( const char *source );
+static int run_cc( const char *bin_file, cstrarr_t flags, cstrarr_t pp_defs,
+                   cstrarr_t inc_dirs, cstrarr_t src_files );
+static int run_cc_with_source( const char *source, cstrarr_t flags );
 static bool s_ends_with( const char *text, const char *suffix );
+static bool stamp_matches( void );
 static cstrarr_t to_arr( const char *text, ... /* NULL */ );
 static const char *to_repo( const char *path, bool from_basis = true );
 static const char *trim_ws( char *text );
 static void uabort( const char *fmt, ... );
 static void write_config( void );
+static void write_stamp( void );
 
 
 #define BASIS_DIR          to_repo(NULL)
@@ -83,17 +102,22 @@ static void write_config( void );
 #define BIN_DIR            to_repo("deployed/bin")
 #define UCONFIG_FILE       to_repo("deployed/build/include/u_config.h")
 #define UKERN_FILE         to_repo("deployed/bin/unum")
+#define PROBE_FILE         to_repo("deployed/build/probe.cache")
+#define STAMP_FILE         to_repo("deployed/build/kernel.id")
 #define MANIFEST_FILE      to_repo("config/manifest.umy")
 #define DEBUG_ENV          "UBOOT_DEBUG"
+#define SYS_CPU_DIR        "/sys/devices/system/cpu"
+#define SYS_NODE_DIR       "/sys/devices/system/node"
 #define MAN_SEC_CORE       "core:"
 #define MAN_SEC_BUILD      "build:"
 #define MAN_SEC_INC        "include:"
 #define is_path_sep(c)      (c == '/' || c == '\\')
 #define is_file(p)         (file_info((p)).st_mode & S_IFREG)
 #define is_dir(p)          (file_info((p)).st_mode & S_IFDIR)
-#define path_sep_s         ((char [2]) { path_sep, '\0' })
 #define CFG_SIZE           32768
-#define IS_UNIX            (platform == P_MACOS)
+#define FNV_BASIS          14695981039346656037ULL
+#define PROBE_MAX          64
+#define IS_UNIX            (platform == P_MACOS || platform == P_LINUX)
 #define assert(e)          if (!(e)) uabort("assert failed, line %d", __LINE__)
 
 
@@ -106,10 +130,119 @@ static char        root_dir[PATH_MAX];
 static char        config[CFG_SIZE];
 static char        *cfg_offset               = config;
 static char        path_sep                  = '\0';
+static char        path_sep_s[2]             = { '\0', '\0' };
 static platform_e  platform                  = P_UNKNOWN;
 static FILE        *uberr                    = NULL;
 
 
+// - hardware topology is stable for a basis and is encoded as constants
+//   so that tuning defaults may be decided at compile time.
+static struct { long cpus;
+                long smt;
+                long cache_l1d;
+                long cache_l2;
+                long cache_l3;
+                long cache_line;
+                long numa_nodes; } hw;
+
+
+// - compiler probes are cached per toolchain fingerprint so that re-running
+//   `make` on a bootstrapped tree never pays for another test compile.
+static struct { char cxx_path[PATH_MAX];
+                long long cxx_mtime;
+                unsigned long long cxx_version;
+                unsigned long long tool_id;
+                int  num_probes;
+                bool is_dirty;
+                struct { char name[64];
+                         int  rc; } probes[PROBE_MAX]; } probe_cache;
+
+
+// - optimization capabilities of the compiler, emitted as UNUM_HAVE_* so that
+//   basis code may specialize hot paths at compile time.
+static struct { const char *macro;
+                const char *flags;
+                const char *source;
+                bool       is_supported; } caps[] = {
+	{ "MARCH_NATIVE", "-march=native",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "TARGET_SSE42", "-Werror",
+	  "#include <immintrin.h>\n"
+	  "__attribute__((target(\"sse4.2\")))\n"
+	  "unsigned crc(unsigned c, unsigned v) { return _mm_crc32_u32(c, v); }\n"
+	  "int main(int argc, char **argv) { return 0; }\n" },
+
+	{ "TARGET_AVX2", "-Werror",
+	  "#include <immintrin.h>\n"
+	  "__attribute__((target(\"avx2\")))\n"
+	  "__m256i add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }\n"
+	  "int main(int argc, char **argv) { return 0; }\n" },
+
+	{ "TARGET_AVX512", "-Werror",
+	  "#include <immintrin.h>\n"
+	  "__attribute__((target(\"avx512f\")))\n"
+	  "__m512i add(__m512i a, __m512i b) { return _mm512_add_epi32(a, b); }\n"
+	  "int main(int argc, char **argv) { return 0; }\n" },
+
+	{ "LTO", "-flto",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "LTO_PARTITION", "-flto=auto -flto-partition=balanced",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "LTO_INCREMENTAL", "-flto=auto -flto-incremental=.",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "LTO_THIN", "-flto=thin -fuse-ld=lld",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "PCH", "-x c++-header",
+	  "#include <cstdio>\n"
+	  "inline int unum_pch(void) { return 1; }\n" },
+
+	{ "FILE_PREFIX_MAP", "-ffile-prefix-map=/unum=.",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "NO_GNU_UNIQUE", "-fno-gnu-unique",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "LD_MOLD", "-fuse-ld=mold",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "LD_LLD", "-fuse-ld=lld",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "LD_GOLD", "-fuse-ld=gold -Wl,--threads",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "MODULES_TS", "-std=c++20 -fmodules-ts -Werror",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "PGO", "-fprofile-generate -fprofile-update=atomic "
+	         "-fprofile-partial-training",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "PGO_INSTR", "-fprofile-instr-generate -Werror",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "TIME_TRACE", "-ftime-trace",
+	  "int main(int argc, char **argv) { return argc - 1; }\n" },
+
+	{ "BUILTIN_EXPECT", "-Werror",
+	  "int main(int argc, char **argv) {\n"
+	  "  if (__builtin_expect(argc > 1, 0)) { return 1; }\n"
+	  "  return 0;\n"
+	  "}\n" },
+
+	{ "LIKELY", "-Werror",
+	  "int main(int argc, char **argv) {\n"
+	  "  if (argc > 1) [[unlikely]] { return 1; }\n"
+	  "  return 0;\n"
+	  "}\n" },
+};
+
+
 int main( int argc, char *argv[] ) {
 	// - don't spam stderr with system()
 	uberr = fdopen(dup(fileno(stderr)), "w");
@@ -121,7 +254,12 @@ int main( int argc, char *argv[] ) {
 	detect_path_style();
 	parse_cmd_line(argc, argv);
 	config_basis();
+	cxx_fingerprint();
+	probe_load();
 	detect_platform();
+	detect_capabilities();
+	probe_save();
+	detect_hardware();
 	write_config();
 	build_pre_k();
 
@@ -145,6 +283,7 @@ static void detect_path_style( void ) {
 	if (!path_sep) {
 		uabort("failed to detect path sep");
 	}
+	path_sep_s[0] = path_sep;
 
 	if (!is_dir(to_repo(NULL))) {
 		uabort("no basis, invalid unum repo");
@@ -293,7 +432,7 @@ static void config_basis( void ) {
 
 
 static void detect_platform( void ) {
-	if (run_cc_with_source(
+	if (probe_cc("platform-macos",
 	           "#include <Carbon/Carbon.h>\n"	
 	           "#include <cstdio>\n\n"
 	           "int main(int argc, char **argv) {\n"
@@ -304,30 +443,430 @@ static void detect_platform( void ) {
 		return;
 	}
 
+	if (probe_cc("platform-linux",
+	           "#ifndef __linux__\n"
+	           "#error \"not linux\"\n"
+	           "#endif\n"
+	           "#include <unistd.h>\n"
+	           "#include <cstdio>\n\n"
+	           "int main(int argc, char **argv) {\n"
+	           "  printf(\"hello unum %ld\", (long) getpid());\n"
+	           "}\n"
+	          ) == 0) {
+		platform = P_LINUX;
+		return;
+	}
+
 	uabort("unsupported platform type");
 }
 
 
-static int run_cc_with_source( const char *source ) {
-	const char *tmp_env[]         = { "TMPDIR", "TMP", "TEMP", "TEMPDIR", 
-	                                  NULL };
+/*
+ *  The toolchain fingerprint is the compiler path, its modification time and
+ *  a hash of its `--version` banner.  Any difference discards all cached 
+ *  probe results because they may no longer describe the compiler.
+ */
+static void cxx_fingerprint( void ) {
+	const char          *cxx = bargs[A_CXX].value;
+	char                *cmd = NULL;
+	char                buf[512];
+	unsigned long long  hash = FNV_BASIS;
+	FILE                *fp;
+
+	strncpy(probe_cache.cxx_path, cxx, PATH_MAX - 1);
+	probe_cache.cxx_mtime = (long long) file_info(cxx).st_mtime;
+
+	cmd = rstrcat(cmd, cxx);
+	cmd = rstrcat(cmd, " --version 2>/dev/null");
+	fp  = popen(cmd, "r");
+	free(cmd);
+	if (!fp) {
+		uabort("failed to query compiler version");
+	}
+
+	while (fgets(buf, sizeof(buf), fp)) {
+		hash = fnv1a(hash, buf);
+	}
+
+	if (pclose(fp) != 0) {
+		uabort("failed to query compiler version");
+	}
+
+	probe_cache.cxx_version = hash;
+
+	// - the kernel embeds its tools, so an existing binary is only 
+	//   trustworthy when all of them are unchanged.
+	snprintf(buf, sizeof(buf), "%lld %016llx", probe_cache.cxx_mtime,
+	         probe_cache.cxx_version);
+	hash = fnv1a(FNV_BASIS, cxx);
+	hash = fnv1a(hash, buf);
+	hash = fnv1a(hash, bargs[A_LD].value);
+	probe_cache.tool_id = hash;
+}
+
+
+static unsigned long long fnv1a( unsigned long long hash, const char *text ) {
+	for (const char *tp = text; tp && *tp; tp++) {
+		hash ^= (unsigned char) *tp;
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+
+/*
+ *  <sample-probe-cache>
+ *
+ *  cxx 1700000000 8c2f0e1d5a4b3c21 /usr/bin/c++
+ *  platform-macos 256
+ *  platform-linux 0
+ *
+ */
+static void probe_load( void ) {
+	FILE                *fp;
+	char                buf[PATH_MAX + 128];
+	long long           mtime;
+	unsigned long long  version;
+	int                 rc, pos = 0;
+
+	probe_cache.num_probes = 0;
+	probe_cache.is_dirty   = true;
+
+	fp = fopen(PROBE_FILE, "r");
+	if (!fp) {
+		return;
+	}
+
+	if (!fgets(buf, sizeof(buf), fp) ||
+	    sscanf(buf, "cxx %lld %llx %n", &mtime, &version, &pos) != 2 ||
+	    !pos || strcmp(trim_ws(&buf[pos]), probe_cache.cxx_path) ||
+	    mtime != probe_cache.cxx_mtime ||
+	    version != probe_cache.cxx_version) {
+		fclose(fp);
+		return;
+	}
+
+	while (probe_cache.num_probes < PROBE_MAX && fgets(buf, sizeof(buf), fp)) {
+		int n = probe_cache.num_probes;
+		if (sscanf(buf, "%63s %d", probe_cache.probes[n].name, &rc) == 2) {
+			probe_cache.probes[n].rc = rc;
+			probe_cache.num_probes++;
+		}
+	}
+
+	fclose(fp);
+	probe_cache.is_dirty = false;
+}
+
+
+static void probe_save( void ) {
+	FILE *fp;
+
+	if (!probe_cache.is_dirty) {
+		return;
+	}
+
+	fp = fopen(PROBE_FILE, "w");
+	if (!fp) {
+		uabort("failed to write probe cache '%s'", PROBE_FILE);
+	}
+
+	fprintf(fp, "cxx %lld %016llx %s\n", probe_cache.cxx_mtime,
+	        probe_cache.cxx_version, probe_cache.cxx_path);
+	for (int i = 0; i < probe_cache.num_probes; i++) {
+		fprintf(fp, "%s %d\n", probe_cache.probes[i].name,
+		        probe_cache.probes[i].rc);
+	}
+
+	if (ferror(fp)) {
+		uabort("failed to write probe cache '%s'", PROBE_FILE);
+	}
+	fclose(fp);
+	probe_cache.is_dirty = false;
+}
+
+
+// - compile `source` once per toolchain, returning the cached result after
+static int probe_cc( const char *name, const char *source ) {
+	const int *cached = probe_find(name);
+	int       rc;
+
+	if (cached) {
+		return *cached;
+	}
+
+	rc = run_cc_with_source(source, NULL);
+	probe_set(name, rc);
+
+	return rc;
+}
+
+
+static const int *probe_find( const char *name ) {
+	for (int i = 0; i < probe_cache.num_probes; i++) {
+		if (!strcmp(probe_cache.probes[i].name, name)) {
+			return &probe_cache.probes[i].rc;
+		}
+	}
+
+	return NULL;
+}
+
+
+static void probe_set( const char *name, int rc ) {
+	assert(strlen(name) < sizeof(probe_cache.probes[0].name));
+
+	if (probe_cache.num_probes == PROBE_MAX) {
+		uabort("too many compiler probes");
+	}
+
+	strcpy(probe_cache.probes[probe_cache.num_probes].name, name);
+	probe_cache.probes[probe_cache.num_probes].rc = rc;
+	probe_cache.num_probes++;
+	probe_cache.is_dirty = true;
+}
+
+
+/*
+ *  Capability probes are independent of one another so any that aren't
+ *  already cached are compiled concurrently, one child process per probe
+ *  and limited to the number of online processors.
+ */
+static void detect_capabilities( void ) {
+	const int  num_caps       = sizeof(caps)/sizeof(caps[0]);
+	long       max_jobs       = sysconf(_SC_NPROCESSORS_ONLN);
+	pid_t      jobs[num_caps];
+	int        num_jobs       = 0;
+	int        next           = 0;
+	int        status;
+	pid_t      pid;
+	char       name[64];
+
+	max_jobs = max_jobs > 0 ? max_jobs : 1;
+
+	while (next < num_caps || num_jobs) {
+		if (next < num_caps && num_jobs < max_jobs) {
+			const int *cached;
+			const int i = next++;
+
+			jobs[i] = 0;
+			snprintf(name, sizeof(name), "have-%s", caps[i].macro);
+			if ((cached = probe_find(name))) {
+				caps[i].is_supported = (*cached == 0);
+				continue;
+			}
+
+			// - the child reports only success or failure and never returns
+			//   through the parent's exit path.
+			if ((jobs[i] = fork()) == 0) {
+				cstrarr_t flags = NULL;
+				char      *fp   = strdup(caps[i].flags);
+
+				for (char *tok = strtok(fp, " "); tok;
+				     tok = strtok(NULL, " ")) {
+					flags = arr_add(flags, tok);
+				}
+				_exit(run_cc_with_source(caps[i].source, flags) == 0 ? 0 : 1);
+
+			} else if (jobs[i] < 0) {
+				uabort("failed to start capability probe '%s'", caps[i].macro);
+			}
+
+			num_jobs++;
+			continue;
+		}
+
+		if ((pid = wait(&status)) < 0) {
+			uabort("failed to wait for capability probes");
+		}
+
+		for (int i = 0; i < next; i++) {
+			if (jobs[i] != pid) {
+				continue;
+			}
+
+			caps[i].is_supported = WIFEXITED(status) &&
+			                       WEXITSTATUS(status) == 0;
+			snprintf(name, sizeof(name), "have-%s", caps[i].macro);
+			probe_set(name, caps[i].is_supported ? 0 : 1);
+			jobs[i] = 0;
+			num_jobs--;
+			break;
+		}
+	}
+}
+
+
+static void detect_hardware( void ) {
+	char path[PATH_MAX];
+	char type[64];
+	long level;
+	FILE *fp;
+
+#if defined(__APPLE__)
+	const char *names[] = { "hw.activecpu", "hw.logicalcpu",
+	                        "hw.physicalcpu", "hw.l1dcachesize",
+	                        "hw.l2cachesize", "hw.l3cachesize",
+	                        "hw.cachelinesize", NULL };
+	long long  values[7];
+
+	for (int i = 0; names[i]; i++) {
+		size_t len = sizeof(values[i]);
+		values[i]  = 0;
+		if (sysctlbyname(names[i], &values[i], &len, NULL, 0) == 0 &&
+		    len == sizeof(int)) {
+			values[i] = *(int *) &values[i];
+		}
+	}
+
+	hw.cpus       = values[0];
+	hw.smt        = values[2] ? values[1] / values[2] : 0;
+	hw.cache_l1d  = values[3];
+	hw.cache_l2   = values[4];
+	hw.cache_l3   = values[5];
+	hw.cache_line = values[6];
+	hw.numa_nodes = 1;
+#endif
+
+	if (platform == P_LINUX) {
+		hw.cpus       = hw_count_list(SYS_CPU_DIR "/online");
+		hw.smt        = hw_count_list(SYS_CPU_DIR
+		                              "/cpu0/topology/thread_siblings_list");
+		hw.numa_nodes = hw_count_list(SYS_NODE_DIR "/online");
+
+		for (int i = 0; ; i++) {
+			snprintf(path, PATH_MAX, SYS_CPU_DIR "/cpu0/cache/index%d/level",
+			         i);
+			if (!(level = hw_read_size(path))) {
+				break;
+			}
+
+			snprintf(path, PATH_MAX, SYS_CPU_DIR "/cpu0/cache/index%d/type",
+			         i);
+			type[0] = '\0';
+			if ((fp = fopen(path, "r"))) {
+				fgets(type, sizeof(type), fp);
+				fclose(fp);
+			}
+
+			if (!strncmp(type, "Instruction", 11)) {
+				continue;
+			}
+
+			snprintf(path, PATH_MAX, SYS_CPU_DIR "/cpu0/cache/index%d/size",
+			         i);
+			if (level == 1) {
+				hw.cache_l1d = hw_read_size(path);
+			} else if (level == 2) {
+				hw.cache_l2  = hw_read_size(path);
+			} else if (level == 3) {
+				hw.cache_l3  = hw_read_size(path);
+			}
+
+			if (!hw.cache_line) {
+				snprintf(path, PATH_MAX, SYS_CPU_DIR "/cpu0/cache/index%d/"
+				         "coherency_line_size", i);
+				hw.cache_line = hw_read_size(path);
+			}
+		}
+	}
+
+	// - conservative values for anything the host won't disclose
+	if (hw.cpus <= 0) {
+		hw.cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		hw.cpus = hw.cpus > 0 ? hw.cpus : 1;
+	}
+	hw.smt        = hw.smt > 0 ? hw.smt : 1;
+	hw.cache_l1d  = hw.cache_l1d > 0 ? hw.cache_l1d : 32 * 1024;
+	hw.cache_l2   = hw.cache_l2 > 0 ? hw.cache_l2 : 256 * 1024;
+	hw.cache_l3   = hw.cache_l3 > 0 ? hw.cache_l3 : 0;
+	hw.cache_line = hw.cache_line > 0 ? hw.cache_line : 64;
+	hw.numa_nodes = hw.numa_nodes > 0 ? hw.numa_nodes : 1;
+}
+
+
+// ...counts the entries in a sysfs list (eg. "0-3,8-11")
+static int hw_count_list( const char *path ) {
+	char buf[1024];
+	int  ret = 0;
+	FILE *fp;
+
+	if (!(fp = fopen(path, "r"))) {
+		return 0;
+	}
+
+	if (fgets(buf, sizeof(buf), fp)) {
+		for (char *bp = buf; *bp && !isspace(*bp);) {
+			long first = strtol(bp, &bp, 10);
+			long last  = (*bp == '-') ? strtol(bp + 1, &bp, 10) : first;
+
+			ret += (int) (last - first + 1);
+			if (*bp == ',') {
+				bp++;
+			}
+		}
+	}
+
+	fclose(fp);
+	return ret;
+}
+
+
+// ...sysfs sizes are expressed as "48K" or "8M", parsed as read_size() in
+//    u_sysinfo.cc does so that sysinfo reports the same values
+static long hw_read_size( const char *path ) {
+	char buf[64];
+	char *bp;
+	long ret = 0;
+	FILE *fp;
+
+	if (!(fp = fopen(path, "r"))) {
+		return 0;
+	}
+
+	if (fgets(buf, sizeof(buf), fp)) {
+		ret = strtol(buf, &bp, 10);
+		ret = (*bp == 'K') ? ret * 1024 :
+		      (*bp == 'M') ? ret * 1024 * 1024 :
+		      (*bp == 'G') ? ret * 1024 * 1024 * 1024 : ret;
+	}
+
+	fclose(fp);
+	return ret;
+}
+
+
+static int run_cc_with_source( const char *source, cstrarr_t flags ) {
+	const char *tmp_env[]         = { "XDG_RUNTIME_DIR", "TMPDIR", "TMP", 
+	                                  "TEMP", "TEMPDIR", NULL };
 	const char **tp               = tmp_env;
 	int        rc;
 	char       src_name[PATH_MAX];
 	char       bin_name[PATH_MAX];
 	FILE       *src_file;
 
-	// ...avoids the scary warning from macos for using tmpnam
+	// ...avoids the scary warning from macos for using tmpnam, preferring
+	//   RAM-backed locations because these files are short-lived.
 	do {
 		const char *e_val = getenv(*tp);
 
+		if (tp == tmp_env && !e_val && is_dir("/dev/shm") &&
+		    access("/dev/shm", W_OK) == 0) {
+			e_val = "/dev/shm";
+		}
+
 		if (e_val) {
-			snprintf(src_name, PATH_MAX, "%s%cunum-boot.cc", e_val, path_sep);
+			snprintf(src_name, PATH_MAX, "%s%cunum-boot-%ld.cc", e_val,
+			         path_sep, (long) getpid());
 			break;	
 		}
 
 		if (!*++tp) {
-			uabort("failed to find temp directory!.");
+			// ...most Linux shells don't export one
+			snprintf(src_name, PATH_MAX, "%s%cunum-boot-%ld.cc", P_tmpdir,
+			         path_sep, (long) getpid());
+			break;
 		}
 	} while (*tp);
 
@@ -339,7 +878,7 @@ static int run_cc_with_source( const char *source ) {
 	}
 	fclose(src_file);
 
-	rc = run_cc(bin_name, NULL, NULL, to_arr(src_name, NULL));
+	rc = run_cc(bin_name, flags, NULL, NULL, to_arr(src_name, NULL));
 
 	unlink(src_name);
 	unlink(bin_name);
@@ -392,14 +931,19 @@ static cstrarr_t arr_add( cstrarr_t arr, const char *text ) {
 
 
 // - arrays must be terminated with NULL
-static int run_cc( const char *bin_file, cstrarr_t pp_defs, cstrarr_t inc_dirs,
-                   cstrarr_t src_files ) {
+static int run_cc( const char *bin_file, cstrarr_t flags, cstrarr_t pp_defs,
+                   cstrarr_t inc_dirs, cstrarr_t src_files ) {
 	char *cmd = NULL;
 	
 	assert(src_files);
 	
 	cmd = rstrcat(cmd, bargs[A_CXX].value);
 
+	for (; flags && *flags && **flags; flags++) {
+		cmd = rstrcat(cmd, " ");
+		cmd = rstrcat(cmd, *flags);
+	}
+
 	for (; inc_dirs && *inc_dirs && **inc_dirs; inc_dirs++) {
 		cmd = rstrcat(cmd, " -I");
 		cmd = rstrcat(cmd, *inc_dirs);
@@ -491,6 +1035,9 @@ static void write_config( void ) {
 	printf_config("%s#define UNUM_OS_MACOS        %d",
 	                platform == P_MACOS ? "" : "// ", 
 	                platform == P_MACOS ? 1 : 0);
+	printf_config("%s#define UNUM_OS_LINUX        %d",
+	                platform == P_LINUX ? "" : "// ", 
+	                platform == P_LINUX ? 1 : 0);
 	printf_config("");
 
 
@@ -499,22 +1046,33 @@ static void write_config( void ) {
 	printf_config("");
 
 
-	// - defining these here guarantee that if the code is moved to a different
-	//   root, the configuration will look different and trigger rebuilds
-	printf_config("#define UNUM_DIR_ROOT        \"%s\"", root_dir);
-	printf_config("#define UNUM_DIR_BASIS       \"%s\"", BASIS_DIR);
-	printf_config("#define UNUM_BASIS_DEPLOY    \"%s\"", DEPLOYED_DIR);
-	printf_config("#define UNUM_BASIS_BUILD     \"%s\"", BUILD_DIR);
-	printf_config("#define UNUM_BASIS_INCLUDE   \"%s\"", BUILD_INCLUDE_DIR);
-	printf_config("#define UNUM_BASIS_BIN       \"%s\"", BIN_DIR);
-	printf_config("#define UNUM_MANIFEST        \"%s\"", MANIFEST_FILE);
-	printf_config("");
-	printf_config("#define UNUM_RUNTIME_BIN     \"%s\"", UKERN_FILE);
-	printf_config("");
+	// - repository locations are intentionally absent because they are
+	//   resolved by the kernel at runtime (see u_paths.h), which keeps this
+	//   header and every object that includes it identical across clones.
 
 
 	printf_config("#define UNUM_TOOL_CXX        \"%s\"", bargs[A_CXX].value);
 	printf_config("#define UNUM_TOOL_LD         \"%s\"", bargs[A_LD].value);
+	printf_config("#define UNUM_TOOL_ID         \"%016llx\"",
+	              probe_cache.tool_id);
+	printf_config("");
+
+
+	printf_config("#define UNUM_HW_CPUS         %ld", hw.cpus);
+	printf_config("#define UNUM_HW_SMT          %ld", hw.smt);
+	printf_config("#define UNUM_HW_CACHE_L1D    %ld", hw.cache_l1d);
+	printf_config("#define UNUM_HW_CACHE_L2     %ld", hw.cache_l2);
+	printf_config("#define UNUM_HW_CACHE_L3     %ld", hw.cache_l3);
+	printf_config("#define UNUM_HW_CACHE_LINE   %ld", hw.cache_line);
+	printf_config("#define UNUM_HW_NUMA_NODES   %ld", hw.numa_nodes);
+	printf_config("");
+
+
+	for (int i = 0; i < sizeof(caps)/sizeof(caps[0]); i++) {
+		printf_config("%s#define UNUM_HAVE_%-*s %d",
+		              caps[i].is_supported ? "" : "// ",
+		              16, caps[i].macro, caps[i].is_supported ? 1 : 0);
+	}
 	printf_config("");
 
 	printf_config("#endif /* UNUM_CONFIG_H */");
@@ -562,15 +1120,50 @@ static void build_pre_k( void ) {
 	if ((s = file_info(bin_file)).st_mode & S_IFREG && s.st_mtime >= last_mod) {
 		return;
 	}
+
+	// - a kernel built by this same toolchain is able to deploy itself
+	//   and anything newer, the pre-kernel would only duplicate that work.
+	if (s.st_mode & S_IFREG && stamp_matches()) {
+		return;
+	}
 	
-	rc = run_cc(bin_file, to_arr("UNUM_BOOTSTRAP", NULL), inc_dirs, src_files);
+	rc = run_cc(bin_file, NULL, to_arr("UNUM_BOOTSTRAP", NULL), inc_dirs,
+	            src_files);
 	if (rc != 0) {
 		uabort("failed to build pre-k, rc=%d", rc);
 	}
+
+	write_stamp();
 	
 	printf("unum: bootstrapping prepared\n");
 }
 
+
+// - the stamp records the toolchain id of the last kernel to be built
+static bool stamp_matches( void ) {
+	FILE                *fp;
+	unsigned long long  tool_id = 0;
+	bool                ret     = false;
+
+	if ((fp = fopen(STAMP_FILE, "r"))) {
+		ret = fscanf(fp, "%llx", &tool_id) == 1 &&
+		      tool_id == probe_cache.tool_id;
+		fclose(fp);
+	}
+
+	return ret;
+}
+
+
+static void write_stamp( void ) {
+	FILE *fp = fopen(STAMP_FILE, "w");
+
+	if (!fp || fprintf(fp, "%016llx\n", probe_cache.tool_id) < 0) {
+		uabort("failed to write kernel stamp '%s'", STAMP_FILE);
+	}
+	fclose(fp);
+}
+
 /*
  *  <sample-manifest>
  *
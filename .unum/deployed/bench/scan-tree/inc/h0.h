@@ -0,0 +1,42 @@
+#pragma once
+/* header 0 */
+#include <vector>
+#include "h2085.h"
+#include "h4515.h"
+#include "h7549.h"
+#include "h2711.h"
+#include "h2836.h"
+#ifdef X
+#include "h9874.h"
+#endif
+struct S0 { int a; const char *s = "x//y"; };
+inline int f0_0(int x) { return x * 0; }
+inline int f0_1(int x) { return x * 1; }
+inline int f0_2(int x) { return x * 2; }
+inline int f0_3(int x) { return x * 3; }
+inline int f0_4(int x) { return x * 4; }
+inline int f0_5(int x) { return x * 5; }
+inline int f0_6(int x) { return x * 6; }
+inline int f0_7(int x) { return x * 7; }
+inline int f0_8(int x) { return x * 8; }
+inline int f0_9(int x) { return x * 9; }
+inline int f0_10(int x) { return x * 10; }
+inline int f0_11(int x) { return x * 11; }
+inline int f0_12(int x) { return x * 12; }
+inline int f0_13(int x) { return x * 13; }
+inline int f0_14(int x) { return x * 14; }
+inline int f0_15(int x) { return x * 15; }
+inline int f0_16(int x) { return x * 16; }
+inline int f0_17(int x) { return x * 17; }
+inline int f0_18(int x) { return x * 18; }
+inline int f0_19(int x) { return x * 19; }
+inline int f0_20(int x) { return x * 20; }
+inline int f0_21(int x) { return x * 21; }
+inline int f0_22(int x) { return x * 22; }
+inline int f0_23(int x) { return x * 23; }
+inline int f0_24(int x) { return x * 24; }
+inline int f0_25(int x) { return x * 25; }
+inline int f0_26(int x) { return x * 26; }
+inline int f0_27(int x) { return x * 27; }
+inline int f0_28(int x) { return x * 28; }
+inline int f0_29(int x) { return x * 29; }
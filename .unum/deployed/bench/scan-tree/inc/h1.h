@@ -0,0 +1,42 @@
+#pragma once
+/* header 1 */
+#include <vector>
+#include "h4381.h"
+#include "h413.h"
+#include "h8894.h"
+#include "h8808.h"
+#include "h3224.h"
+#ifdef X
+#include "h3755.h"
+#endif
+struct S1 { int a; const char *s = "x//y"; };
+inline int f1_0(int x) { return x * 0; }
+inline int f1_1(int x) { return x * 1; }
+inline int f1_2(int x) { return x * 2; }
+inline int f1_3(int x) { return x * 3; }
+inline int f1_4(int x) { return x * 4; }
+inline int f1_5(int x) { return x * 5; }
+inline int f1_6(int x) { return x * 6; }
+inline int f1_7(int x) { return x * 7; }
+inline int f1_8(int x) { return x * 8; }
+inline int f1_9(int x) { return x * 9; }
+inline int f1_10(int x) { return x * 10; }
+inline int f1_11(int x) { return x * 11; }
+inline int f1_12(int x) { return x * 12; }
+inline int f1_13(int x) { return x * 13; }
+inline int f1_14(int x) { return x * 14; }
+inline int f1_15(int x) { return x * 15; }
+inline int f1_16(int x) { return x * 16; }
+inline int f1_17(int x) { return x * 17; }
+inline int f1_18(int x) { return x * 18; }
+inline int f1_19(int x) { return x * 19; }
+inline int f1_20(int x) { return x * 20; }
+inline int f1_21(int x) { return x * 21; }
+inline int f1_22(int x) { return x * 22; }
+inline int f1_23(int x) { return x * 23; }
+inline int f1_24(int x) { return x * 24; }
+inline int f1_25(int x) { return x * 25; }
+inline int f1_26(int x) { return x * 26; }
+inline int f1_27(int x) { return x * 27; }
+inline int f1_28(int x) { return x * 28; }
+inline int f1_29(int x) { return x * 29; }
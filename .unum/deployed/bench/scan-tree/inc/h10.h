@@ -0,0 +1,42 @@
+#pragma once
+/* header 10 */
+#include <vector>
+#include "h4842.h"
+#include "h5298.h"
+#include "h5236.h"
+#include "h8925.h"
+#include "h9952.h"
+#ifdef X
+#include "h9203.h"
+#endif
+struct S10 { int a; const char *s = "x//y"; };
+inline int f10_0(int x) { return x * 0; }
+inline int f10_1(int x) { return x * 1; }
+inline int f10_2(int x) { return x * 2; }
+inline int f10_3(int x) { return x * 3; }
+inline int f10_4(int x) { return x * 4; }
+inline int f10_5(int x) { return x * 5; }
+inline int f10_6(int x) { return x * 6; }
+inline int f10_7(int x) { return x * 7; }
+inline int f10_8(int x) { return x * 8; }
+inline int f10_9(int x) { return x * 9; }
+inline int f10_10(int x) { return x * 10; }
+inline int f10_11(int x) { return x * 11; }
+inline int f10_12(int x) { return x * 12; }
+inline int f10_13(int x) { return x * 13; }
+inline int f10_14(int x) { return x * 14; }
+inline int f10_15(int x) { return x * 15; }
+inline int f10_16(int x) { return x * 16; }
+inline int f10_17(int x) { return x * 17; }
+inline int f10_18(int x) { return x * 18; }
+inline int f10_19(int x) { return x * 19; }
+inline int f10_20(int x) { return x * 20; }
+inline int f10_21(int x) { return x * 21; }
+inline int f10_22(int x) { return x * 22; }
+inline int f10_23(int x) { return x * 23; }
+inline int f10_24(int x) { return x * 24; }
+inline int f10_25(int x) { return x * 25; }
+inline int f10_26(int x) { return x * 26; }
+inline int f10_27(int x) { return x * 27; }
+inline int f10_28(int x) { return x * 28; }
+inline int f10_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 100 */
+#include <vector>
+#include "h4658.h"
+#include "h5949.h"
+#include "h3858.h"
+#include "h1269.h"
+#include "h6605.h"
+#ifdef X
+#include "h3744.h"
+#endif
+struct S100 { int a; const char *s = "x//y"; };
+inline int f100_0(int x) { return x * 0; }
+inline int f100_1(int x) { return x * 1; }
+inline int f100_2(int x) { return x * 2; }
+inline int f100_3(int x) { return x * 3; }
+inline int f100_4(int x) { return x * 4; }
+inline int f100_5(int x) { return x * 5; }
+inline int f100_6(int x) { return x * 6; }
+inline int f100_7(int x) { return x * 7; }
+inline int f100_8(int x) { return x * 8; }
+inline int f100_9(int x) { return x * 9; }
+inline int f100_10(int x) { return x * 10; }
+inline int f100_11(int x) { return x * 11; }
+inline int f100_12(int x) { return x * 12; }
+inline int f100_13(int x) { return x * 13; }
+inline int f100_14(int x) { return x * 14; }
+inline int f100_15(int x) { return x * 15; }
+inline int f100_16(int x) { return x * 16; }
+inline int f100_17(int x) { return x * 17; }
+inline int f100_18(int x) { return x * 18; }
+inline int f100_19(int x) { return x * 19; }
+inline int f100_20(int x) { return x * 20; }
+inline int f100_21(int x) { return x * 21; }
+inline int f100_22(int x) { return x * 22; }
+inline int f100_23(int x) { return x * 23; }
+inline int f100_24(int x) { return x * 24; }
+inline int f100_25(int x) { return x * 25; }
+inline int f100_26(int x) { return x * 26; }
+inline int f100_27(int x) { return x * 27; }
+inline int f100_28(int x) { return x * 28; }
+inline int f100_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1002 */
+#include <vector>
+#include "h4480.h"
+#include "h4299.h"
+#include "h1385.h"
+#include "h2794.h"
+#include "h7079.h"
+#ifdef X
+#include "h2488.h"
+#endif
+struct S1002 { int a; const char *s = "x//y"; };
+inline int f1002_0(int x) { return x * 0; }
+inline int f1002_1(int x) { return x * 1; }
+inline int f1002_2(int x) { return x * 2; }
+inline int f1002_3(int x) { return x * 3; }
+inline int f1002_4(int x) { return x * 4; }
+inline int f1002_5(int x) { return x * 5; }
+inline int f1002_6(int x) { return x * 6; }
+inline int f1002_7(int x) { return x * 7; }
+inline int f1002_8(int x) { return x * 8; }
+inline int f1002_9(int x) { return x * 9; }
+inline int f1002_10(int x) { return x * 10; }
+inline int f1002_11(int x) { return x * 11; }
+inline int f1002_12(int x) { return x * 12; }
+inline int f1002_13(int x) { return x * 13; }
+inline int f1002_14(int x) { return x * 14; }
+inline int f1002_15(int x) { return x * 15; }
+inline int f1002_16(int x) { return x * 16; }
+inline int f1002_17(int x) { return x * 17; }
+inline int f1002_18(int x) { return x * 18; }
+inline int f1002_19(int x) { return x * 19; }
+inline int f1002_20(int x) { return x * 20; }
+inline int f1002_21(int x) { return x * 21; }
+inline int f1002_22(int x) { return x * 22; }
+inline int f1002_23(int x) { return x * 23; }
+inline int f1002_24(int x) { return x * 24; }
+inline int f1002_25(int x) { return x * 25; }
+inline int f1002_26(int x) { return x * 26; }
+inline int f1002_27(int x) { return x * 27; }
+inline int f1002_28(int x) { return x * 28; }
+inline int f1002_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1003 */
+#include <vector>
+#include "h4713.h"
+#include "h993.h"
+#include "h6923.h"
+#include "h1453.h"
+#include "h1150.h"
+#ifdef X
+#include "h5398.h"
+#endif
+struct S1003 { int a; const char *s = "x//y"; };
+inline int f1003_0(int x) { return x * 0; }
+inline int f1003_1(int x) { return x * 1; }
+inline int f1003_2(int x) { return x * 2; }
+inline int f1003_3(int x) { return x * 3; }
+inline int f1003_4(int x) { return x * 4; }
+inline int f1003_5(int x) { return x * 5; }
+inline int f1003_6(int x) { return x * 6; }
+inline int f1003_7(int x) { return x * 7; }
+inline int f1003_8(int x) { return x * 8; }
+inline int f1003_9(int x) { return x * 9; }
+inline int f1003_10(int x) { return x * 10; }
+inline int f1003_11(int x) { return x * 11; }
+inline int f1003_12(int x) { return x * 12; }
+inline int f1003_13(int x) { return x * 13; }
+inline int f1003_14(int x) { return x * 14; }
+inline int f1003_15(int x) { return x * 15; }
+inline int f1003_16(int x) { return x * 16; }
+inline int f1003_17(int x) { return x * 17; }
+inline int f1003_18(int x) { return x * 18; }
+inline int f1003_19(int x) { return x * 19; }
+inline int f1003_20(int x) { return x * 20; }
+inline int f1003_21(int x) { return x * 21; }
+inline int f1003_22(int x) { return x * 22; }
+inline int f1003_23(int x) { return x * 23; }
+inline int f1003_24(int x) { return x * 24; }
+inline int f1003_25(int x) { return x * 25; }
+inline int f1003_26(int x) { return x * 26; }
+inline int f1003_27(int x) { return x * 27; }
+inline int f1003_28(int x) { return x * 28; }
+inline int f1003_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1004 */
+#include <vector>
+#include "h8681.h"
+#include "h195.h"
+#include "h895.h"
+#include "h4589.h"
+#include "h9210.h"
+#ifdef X
+#include "h6824.h"
+#endif
+struct S1004 { int a; const char *s = "x//y"; };
+inline int f1004_0(int x) { return x * 0; }
+inline int f1004_1(int x) { return x * 1; }
+inline int f1004_2(int x) { return x * 2; }
+inline int f1004_3(int x) { return x * 3; }
+inline int f1004_4(int x) { return x * 4; }
+inline int f1004_5(int x) { return x * 5; }
+inline int f1004_6(int x) { return x * 6; }
+inline int f1004_7(int x) { return x * 7; }
+inline int f1004_8(int x) { return x * 8; }
+inline int f1004_9(int x) { return x * 9; }
+inline int f1004_10(int x) { return x * 10; }
+inline int f1004_11(int x) { return x * 11; }
+inline int f1004_12(int x) { return x * 12; }
+inline int f1004_13(int x) { return x * 13; }
+inline int f1004_14(int x) { return x * 14; }
+inline int f1004_15(int x) { return x * 15; }
+inline int f1004_16(int x) { return x * 16; }
+inline int f1004_17(int x) { return x * 17; }
+inline int f1004_18(int x) { return x * 18; }
+inline int f1004_19(int x) { return x * 19; }
+inline int f1004_20(int x) { return x * 20; }
+inline int f1004_21(int x) { return x * 21; }
+inline int f1004_22(int x) { return x * 22; }
+inline int f1004_23(int x) { return x * 23; }
+inline int f1004_24(int x) { return x * 24; }
+inline int f1004_25(int x) { return x * 25; }
+inline int f1004_26(int x) { return x * 26; }
+inline int f1004_27(int x) { return x * 27; }
+inline int f1004_28(int x) { return x * 28; }
+inline int f1004_29(int x) { return x * 29; }
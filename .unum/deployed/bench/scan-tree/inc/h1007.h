@@ -0,0 +1,42 @@
+#pragma once
+/* header 1007 */
+#include <vector>
+#include "h7445.h"
+#include "h3092.h"
+#include "h7373.h"
+#include "h3045.h"
+#include "h5265.h"
+#ifdef X
+#include "h450.h"
+#endif
+struct S1007 { int a; const char *s = "x//y"; };
+inline int f1007_0(int x) { return x * 0; }
+inline int f1007_1(int x) { return x * 1; }
+inline int f1007_2(int x) { return x * 2; }
+inline int f1007_3(int x) { return x * 3; }
+inline int f1007_4(int x) { return x * 4; }
+inline int f1007_5(int x) { return x * 5; }
+inline int f1007_6(int x) { return x * 6; }
+inline int f1007_7(int x) { return x * 7; }
+inline int f1007_8(int x) { return x * 8; }
+inline int f1007_9(int x) { return x * 9; }
+inline int f1007_10(int x) { return x * 10; }
+inline int f1007_11(int x) { return x * 11; }
+inline int f1007_12(int x) { return x * 12; }
+inline int f1007_13(int x) { return x * 13; }
+inline int f1007_14(int x) { return x * 14; }
+inline int f1007_15(int x) { return x * 15; }
+inline int f1007_16(int x) { return x * 16; }
+inline int f1007_17(int x) { return x * 17; }
+inline int f1007_18(int x) { return x * 18; }
+inline int f1007_19(int x) { return x * 19; }
+inline int f1007_20(int x) { return x * 20; }
+inline int f1007_21(int x) { return x * 21; }
+inline int f1007_22(int x) { return x * 22; }
+inline int f1007_23(int x) { return x * 23; }
+inline int f1007_24(int x) { return x * 24; }
+inline int f1007_25(int x) { return x * 25; }
+inline int f1007_26(int x) { return x * 26; }
+inline int f1007_27(int x) { return x * 27; }
+inline int f1007_28(int x) { return x * 28; }
+inline int f1007_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1008 */
+#include <vector>
+#include "h1652.h"
+#include "h3536.h"
+#include "h2755.h"
+#include "h2164.h"
+#include "h7227.h"
+#ifdef X
+#include "h109.h"
+#endif
+struct S1008 { int a; const char *s = "x//y"; };
+inline int f1008_0(int x) { return x * 0; }
+inline int f1008_1(int x) { return x * 1; }
+inline int f1008_2(int x) { return x * 2; }
+inline int f1008_3(int x) { return x * 3; }
+inline int f1008_4(int x) { return x * 4; }
+inline int f1008_5(int x) { return x * 5; }
+inline int f1008_6(int x) { return x * 6; }
+inline int f1008_7(int x) { return x * 7; }
+inline int f1008_8(int x) { return x * 8; }
+inline int f1008_9(int x) { return x * 9; }
+inline int f1008_10(int x) { return x * 10; }
+inline int f1008_11(int x) { return x * 11; }
+inline int f1008_12(int x) { return x * 12; }
+inline int f1008_13(int x) { return x * 13; }
+inline int f1008_14(int x) { return x * 14; }
+inline int f1008_15(int x) { return x * 15; }
+inline int f1008_16(int x) { return x * 16; }
+inline int f1008_17(int x) { return x * 17; }
+inline int f1008_18(int x) { return x * 18; }
+inline int f1008_19(int x) { return x * 19; }
+inline int f1008_20(int x) { return x * 20; }
+inline int f1008_21(int x) { return x * 21; }
+inline int f1008_22(int x) { return x * 22; }
+inline int f1008_23(int x) { return x * 23; }
+inline int f1008_24(int x) { return x * 24; }
+inline int f1008_25(int x) { return x * 25; }
+inline int f1008_26(int x) { return x * 26; }
+inline int f1008_27(int x) { return x * 27; }
+inline int f1008_28(int x) { return x * 28; }
+inline int f1008_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1010 */
+#include <vector>
+#include "h6538.h"
+#include "h8268.h"
+#include "h7457.h"
+#include "h9007.h"
+#include "h1276.h"
+#ifdef X
+#include "h1841.h"
+#endif
+struct S1010 { int a; const char *s = "x//y"; };
+inline int f1010_0(int x) { return x * 0; }
+inline int f1010_1(int x) { return x * 1; }
+inline int f1010_2(int x) { return x * 2; }
+inline int f1010_3(int x) { return x * 3; }
+inline int f1010_4(int x) { return x * 4; }
+inline int f1010_5(int x) { return x * 5; }
+inline int f1010_6(int x) { return x * 6; }
+inline int f1010_7(int x) { return x * 7; }
+inline int f1010_8(int x) { return x * 8; }
+inline int f1010_9(int x) { return x * 9; }
+inline int f1010_10(int x) { return x * 10; }
+inline int f1010_11(int x) { return x * 11; }
+inline int f1010_12(int x) { return x * 12; }
+inline int f1010_13(int x) { return x * 13; }
+inline int f1010_14(int x) { return x * 14; }
+inline int f1010_15(int x) { return x * 15; }
+inline int f1010_16(int x) { return x * 16; }
+inline int f1010_17(int x) { return x * 17; }
+inline int f1010_18(int x) { return x * 18; }
+inline int f1010_19(int x) { return x * 19; }
+inline int f1010_20(int x) { return x * 20; }
+inline int f1010_21(int x) { return x * 21; }
+inline int f1010_22(int x) { return x * 22; }
+inline int f1010_23(int x) { return x * 23; }
+inline int f1010_24(int x) { return x * 24; }
+inline int f1010_25(int x) { return x * 25; }
+inline int f1010_26(int x) { return x * 26; }
+inline int f1010_27(int x) { return x * 27; }
+inline int f1010_28(int x) { return x * 28; }
+inline int f1010_29(int x) { return x * 29; }
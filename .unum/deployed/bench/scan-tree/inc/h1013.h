@@ -0,0 +1,42 @@
+#pragma once
+/* header 1013 */
+#include <vector>
+#include "h3574.h"
+#include "h28.h"
+#include "h7768.h"
+#include "h9887.h"
+#include "h9280.h"
+#ifdef X
+#include "h4747.h"
+#endif
+struct S1013 { int a; const char *s = "x//y"; };
+inline int f1013_0(int x) { return x * 0; }
+inline int f1013_1(int x) { return x * 1; }
+inline int f1013_2(int x) { return x * 2; }
+inline int f1013_3(int x) { return x * 3; }
+inline int f1013_4(int x) { return x * 4; }
+inline int f1013_5(int x) { return x * 5; }
+inline int f1013_6(int x) { return x * 6; }
+inline int f1013_7(int x) { return x * 7; }
+inline int f1013_8(int x) { return x * 8; }
+inline int f1013_9(int x) { return x * 9; }
+inline int f1013_10(int x) { return x * 10; }
+inline int f1013_11(int x) { return x * 11; }
+inline int f1013_12(int x) { return x * 12; }
+inline int f1013_13(int x) { return x * 13; }
+inline int f1013_14(int x) { return x * 14; }
+inline int f1013_15(int x) { return x * 15; }
+inline int f1013_16(int x) { return x * 16; }
+inline int f1013_17(int x) { return x * 17; }
+inline int f1013_18(int x) { return x * 18; }
+inline int f1013_19(int x) { return x * 19; }
+inline int f1013_20(int x) { return x * 20; }
+inline int f1013_21(int x) { return x * 21; }
+inline int f1013_22(int x) { return x * 22; }
+inline int f1013_23(int x) { return x * 23; }
+inline int f1013_24(int x) { return x * 24; }
+inline int f1013_25(int x) { return x * 25; }
+inline int f1013_26(int x) { return x * 26; }
+inline int f1013_27(int x) { return x * 27; }
+inline int f1013_28(int x) { return x * 28; }
+inline int f1013_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1017 */
+#include <vector>
+#include "h5847.h"
+#include "h6759.h"
+#include "h9039.h"
+#include "h2042.h"
+#include "h7961.h"
+#ifdef X
+#include "h555.h"
+#endif
+struct S1017 { int a; const char *s = "x//y"; };
+inline int f1017_0(int x) { return x * 0; }
+inline int f1017_1(int x) { return x * 1; }
+inline int f1017_2(int x) { return x * 2; }
+inline int f1017_3(int x) { return x * 3; }
+inline int f1017_4(int x) { return x * 4; }
+inline int f1017_5(int x) { return x * 5; }
+inline int f1017_6(int x) { return x * 6; }
+inline int f1017_7(int x) { return x * 7; }
+inline int f1017_8(int x) { return x * 8; }
+inline int f1017_9(int x) { return x * 9; }
+inline int f1017_10(int x) { return x * 10; }
+inline int f1017_11(int x) { return x * 11; }
+inline int f1017_12(int x) { return x * 12; }
+inline int f1017_13(int x) { return x * 13; }
+inline int f1017_14(int x) { return x * 14; }
+inline int f1017_15(int x) { return x * 15; }
+inline int f1017_16(int x) { return x * 16; }
+inline int f1017_17(int x) { return x * 17; }
+inline int f1017_18(int x) { return x * 18; }
+inline int f1017_19(int x) { return x * 19; }
+inline int f1017_20(int x) { return x * 20; }
+inline int f1017_21(int x) { return x * 21; }
+inline int f1017_22(int x) { return x * 22; }
+inline int f1017_23(int x) { return x * 23; }
+inline int f1017_24(int x) { return x * 24; }
+inline int f1017_25(int x) { return x * 25; }
+inline int f1017_26(int x) { return x * 26; }
+inline int f1017_27(int x) { return x * 27; }
+inline int f1017_28(int x) { return x * 28; }
+inline int f1017_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1019 */
+#include <vector>
+#include "h593.h"
+#include "h3488.h"
+#include "h3766.h"
+#include "h994.h"
+#include "h145.h"
+#ifdef X
+#include "h7696.h"
+#endif
+struct S1019 { int a; const char *s = "x//y"; };
+inline int f1019_0(int x) { return x * 0; }
+inline int f1019_1(int x) { return x * 1; }
+inline int f1019_2(int x) { return x * 2; }
+inline int f1019_3(int x) { return x * 3; }
+inline int f1019_4(int x) { return x * 4; }
+inline int f1019_5(int x) { return x * 5; }
+inline int f1019_6(int x) { return x * 6; }
+inline int f1019_7(int x) { return x * 7; }
+inline int f1019_8(int x) { return x * 8; }
+inline int f1019_9(int x) { return x * 9; }
+inline int f1019_10(int x) { return x * 10; }
+inline int f1019_11(int x) { return x * 11; }
+inline int f1019_12(int x) { return x * 12; }
+inline int f1019_13(int x) { return x * 13; }
+inline int f1019_14(int x) { return x * 14; }
+inline int f1019_15(int x) { return x * 15; }
+inline int f1019_16(int x) { return x * 16; }
+inline int f1019_17(int x) { return x * 17; }
+inline int f1019_18(int x) { return x * 18; }
+inline int f1019_19(int x) { return x * 19; }
+inline int f1019_20(int x) { return x * 20; }
+inline int f1019_21(int x) { return x * 21; }
+inline int f1019_22(int x) { return x * 22; }
+inline int f1019_23(int x) { return x * 23; }
+inline int f1019_24(int x) { return x * 24; }
+inline int f1019_25(int x) { return x * 25; }
+inline int f1019_26(int x) { return x * 26; }
+inline int f1019_27(int x) { return x * 27; }
+inline int f1019_28(int x) { return x * 28; }
+inline int f1019_29(int x) { return x * 29; }
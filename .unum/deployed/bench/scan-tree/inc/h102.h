@@ -0,0 +1,42 @@
+#pragma once
+/* header 102 */
+#include <vector>
+#include "h6635.h"
+#include "h9762.h"
+#include "h5310.h"
+#include "h5740.h"
+#include "h5303.h"
+#ifdef X
+#include "h8443.h"
+#endif
+struct S102 { int a; const char *s = "x//y"; };
+inline int f102_0(int x) { return x * 0; }
+inline int f102_1(int x) { return x * 1; }
+inline int f102_2(int x) { return x * 2; }
+inline int f102_3(int x) { return x * 3; }
+inline int f102_4(int x) { return x * 4; }
+inline int f102_5(int x) { return x * 5; }
+inline int f102_6(int x) { return x * 6; }
+inline int f102_7(int x) { return x * 7; }
+inline int f102_8(int x) { return x * 8; }
+inline int f102_9(int x) { return x * 9; }
+inline int f102_10(int x) { return x * 10; }
+inline int f102_11(int x) { return x * 11; }
+inline int f102_12(int x) { return x * 12; }
+inline int f102_13(int x) { return x * 13; }
+inline int f102_14(int x) { return x * 14; }
+inline int f102_15(int x) { return x * 15; }
+inline int f102_16(int x) { return x * 16; }
+inline int f102_17(int x) { return x * 17; }
+inline int f102_18(int x) { return x * 18; }
+inline int f102_19(int x) { return x * 19; }
+inline int f102_20(int x) { return x * 20; }
+inline int f102_21(int x) { return x * 21; }
+inline int f102_22(int x) { return x * 22; }
+inline int f102_23(int x) { return x * 23; }
+inline int f102_24(int x) { return x * 24; }
+inline int f102_25(int x) { return x * 25; }
+inline int f102_26(int x) { return x * 26; }
+inline int f102_27(int x) { return x * 27; }
+inline int f102_28(int x) { return x * 28; }
+inline int f102_29(int x) { return x * 29; }
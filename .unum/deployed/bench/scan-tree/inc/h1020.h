@@ -0,0 +1,42 @@
+#pragma once
+/* header 1020 */
+#include <vector>
+#include "h7246.h"
+#include "h4798.h"
+#include "h6709.h"
+#include "h6219.h"
+#include "h5088.h"
+#ifdef X
+#include "h4992.h"
+#endif
+struct S1020 { int a; const char *s = "x//y"; };
+inline int f1020_0(int x) { return x * 0; }
+inline int f1020_1(int x) { return x * 1; }
+inline int f1020_2(int x) { return x * 2; }
+inline int f1020_3(int x) { return x * 3; }
+inline int f1020_4(int x) { return x * 4; }
+inline int f1020_5(int x) { return x * 5; }
+inline int f1020_6(int x) { return x * 6; }
+inline int f1020_7(int x) { return x * 7; }
+inline int f1020_8(int x) { return x * 8; }
+inline int f1020_9(int x) { return x * 9; }
+inline int f1020_10(int x) { return x * 10; }
+inline int f1020_11(int x) { return x * 11; }
+inline int f1020_12(int x) { return x * 12; }
+inline int f1020_13(int x) { return x * 13; }
+inline int f1020_14(int x) { return x * 14; }
+inline int f1020_15(int x) { return x * 15; }
+inline int f1020_16(int x) { return x * 16; }
+inline int f1020_17(int x) { return x * 17; }
+inline int f1020_18(int x) { return x * 18; }
+inline int f1020_19(int x) { return x * 19; }
+inline int f1020_20(int x) { return x * 20; }
+inline int f1020_21(int x) { return x * 21; }
+inline int f1020_22(int x) { return x * 22; }
+inline int f1020_23(int x) { return x * 23; }
+inline int f1020_24(int x) { return x * 24; }
+inline int f1020_25(int x) { return x * 25; }
+inline int f1020_26(int x) { return x * 26; }
+inline int f1020_27(int x) { return x * 27; }
+inline int f1020_28(int x) { return x * 28; }
+inline int f1020_29(int x) { return x * 29; }
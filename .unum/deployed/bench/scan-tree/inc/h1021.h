@@ -0,0 +1,42 @@
+#pragma once
+/* header 1021 */
+#include <vector>
+#include "h3210.h"
+#include "h7840.h"
+#include "h5668.h"
+#include "h250.h"
+#include "h4826.h"
+#ifdef X
+#include "h7873.h"
+#endif
+struct S1021 { int a; const char *s = "x//y"; };
+inline int f1021_0(int x) { return x * 0; }
+inline int f1021_1(int x) { return x * 1; }
+inline int f1021_2(int x) { return x * 2; }
+inline int f1021_3(int x) { return x * 3; }
+inline int f1021_4(int x) { return x * 4; }
+inline int f1021_5(int x) { return x * 5; }
+inline int f1021_6(int x) { return x * 6; }
+inline int f1021_7(int x) { return x * 7; }
+inline int f1021_8(int x) { return x * 8; }
+inline int f1021_9(int x) { return x * 9; }
+inline int f1021_10(int x) { return x * 10; }
+inline int f1021_11(int x) { return x * 11; }
+inline int f1021_12(int x) { return x * 12; }
+inline int f1021_13(int x) { return x * 13; }
+inline int f1021_14(int x) { return x * 14; }
+inline int f1021_15(int x) { return x * 15; }
+inline int f1021_16(int x) { return x * 16; }
+inline int f1021_17(int x) { return x * 17; }
+inline int f1021_18(int x) { return x * 18; }
+inline int f1021_19(int x) { return x * 19; }
+inline int f1021_20(int x) { return x * 20; }
+inline int f1021_21(int x) { return x * 21; }
+inline int f1021_22(int x) { return x * 22; }
+inline int f1021_23(int x) { return x * 23; }
+inline int f1021_24(int x) { return x * 24; }
+inline int f1021_25(int x) { return x * 25; }
+inline int f1021_26(int x) { return x * 26; }
+inline int f1021_27(int x) { return x * 27; }
+inline int f1021_28(int x) { return x * 28; }
+inline int f1021_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1024 */
+#include <vector>
+#include "h2125.h"
+#include "h8664.h"
+#include "h5762.h"
+#include "h3305.h"
+#include "h241.h"
+#ifdef X
+#include "h8245.h"
+#endif
+struct S1024 { int a; const char *s = "x//y"; };
+inline int f1024_0(int x) { return x * 0; }
+inline int f1024_1(int x) { return x * 1; }
+inline int f1024_2(int x) { return x * 2; }
+inline int f1024_3(int x) { return x * 3; }
+inline int f1024_4(int x) { return x * 4; }
+inline int f1024_5(int x) { return x * 5; }
+inline int f1024_6(int x) { return x * 6; }
+inline int f1024_7(int x) { return x * 7; }
+inline int f1024_8(int x) { return x * 8; }
+inline int f1024_9(int x) { return x * 9; }
+inline int f1024_10(int x) { return x * 10; }
+inline int f1024_11(int x) { return x * 11; }
+inline int f1024_12(int x) { return x * 12; }
+inline int f1024_13(int x) { return x * 13; }
+inline int f1024_14(int x) { return x * 14; }
+inline int f1024_15(int x) { return x * 15; }
+inline int f1024_16(int x) { return x * 16; }
+inline int f1024_17(int x) { return x * 17; }
+inline int f1024_18(int x) { return x * 18; }
+inline int f1024_19(int x) { return x * 19; }
+inline int f1024_20(int x) { return x * 20; }
+inline int f1024_21(int x) { return x * 21; }
+inline int f1024_22(int x) { return x * 22; }
+inline int f1024_23(int x) { return x * 23; }
+inline int f1024_24(int x) { return x * 24; }
+inline int f1024_25(int x) { return x * 25; }
+inline int f1024_26(int x) { return x * 26; }
+inline int f1024_27(int x) { return x * 27; }
+inline int f1024_28(int x) { return x * 28; }
+inline int f1024_29(int x) { return x * 29; }
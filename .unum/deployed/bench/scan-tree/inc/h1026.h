@@ -0,0 +1,42 @@
+#pragma once
+/* header 1026 */
+#include <vector>
+#include "h3816.h"
+#include "h3890.h"
+#include "h3925.h"
+#include "h7475.h"
+#include "h1019.h"
+#ifdef X
+#include "h6083.h"
+#endif
+struct S1026 { int a; const char *s = "x//y"; };
+inline int f1026_0(int x) { return x * 0; }
+inline int f1026_1(int x) { return x * 1; }
+inline int f1026_2(int x) { return x * 2; }
+inline int f1026_3(int x) { return x * 3; }
+inline int f1026_4(int x) { return x * 4; }
+inline int f1026_5(int x) { return x * 5; }
+inline int f1026_6(int x) { return x * 6; }
+inline int f1026_7(int x) { return x * 7; }
+inline int f1026_8(int x) { return x * 8; }
+inline int f1026_9(int x) { return x * 9; }
+inline int f1026_10(int x) { return x * 10; }
+inline int f1026_11(int x) { return x * 11; }
+inline int f1026_12(int x) { return x * 12; }
+inline int f1026_13(int x) { return x * 13; }
+inline int f1026_14(int x) { return x * 14; }
+inline int f1026_15(int x) { return x * 15; }
+inline int f1026_16(int x) { return x * 16; }
+inline int f1026_17(int x) { return x * 17; }
+inline int f1026_18(int x) { return x * 18; }
+inline int f1026_19(int x) { return x * 19; }
+inline int f1026_20(int x) { return x * 20; }
+inline int f1026_21(int x) { return x * 21; }
+inline int f1026_22(int x) { return x * 22; }
+inline int f1026_23(int x) { return x * 23; }
+inline int f1026_24(int x) { return x * 24; }
+inline int f1026_25(int x) { return x * 25; }
+inline int f1026_26(int x) { return x * 26; }
+inline int f1026_27(int x) { return x * 27; }
+inline int f1026_28(int x) { return x * 28; }
+inline int f1026_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1028 */
+#include <vector>
+#include "h7075.h"
+#include "h8005.h"
+#include "h3593.h"
+#include "h3666.h"
+#include "h7542.h"
+#ifdef X
+#include "h4381.h"
+#endif
+struct S1028 { int a; const char *s = "x//y"; };
+inline int f1028_0(int x) { return x * 0; }
+inline int f1028_1(int x) { return x * 1; }
+inline int f1028_2(int x) { return x * 2; }
+inline int f1028_3(int x) { return x * 3; }
+inline int f1028_4(int x) { return x * 4; }
+inline int f1028_5(int x) { return x * 5; }
+inline int f1028_6(int x) { return x * 6; }
+inline int f1028_7(int x) { return x * 7; }
+inline int f1028_8(int x) { return x * 8; }
+inline int f1028_9(int x) { return x * 9; }
+inline int f1028_10(int x) { return x * 10; }
+inline int f1028_11(int x) { return x * 11; }
+inline int f1028_12(int x) { return x * 12; }
+inline int f1028_13(int x) { return x * 13; }
+inline int f1028_14(int x) { return x * 14; }
+inline int f1028_15(int x) { return x * 15; }
+inline int f1028_16(int x) { return x * 16; }
+inline int f1028_17(int x) { return x * 17; }
+inline int f1028_18(int x) { return x * 18; }
+inline int f1028_19(int x) { return x * 19; }
+inline int f1028_20(int x) { return x * 20; }
+inline int f1028_21(int x) { return x * 21; }
+inline int f1028_22(int x) { return x * 22; }
+inline int f1028_23(int x) { return x * 23; }
+inline int f1028_24(int x) { return x * 24; }
+inline int f1028_25(int x) { return x * 25; }
+inline int f1028_26(int x) { return x * 26; }
+inline int f1028_27(int x) { return x * 27; }
+inline int f1028_28(int x) { return x * 28; }
+inline int f1028_29(int x) { return x * 29; }
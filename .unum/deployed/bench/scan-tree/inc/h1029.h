@@ -0,0 +1,42 @@
+#pragma once
+/* header 1029 */
+#include <vector>
+#include "h9711.h"
+#include "h3447.h"
+#include "h3202.h"
+#include "h9811.h"
+#include "h5414.h"
+#ifdef X
+#include "h4381.h"
+#endif
+struct S1029 { int a; const char *s = "x//y"; };
+inline int f1029_0(int x) { return x * 0; }
+inline int f1029_1(int x) { return x * 1; }
+inline int f1029_2(int x) { return x * 2; }
+inline int f1029_3(int x) { return x * 3; }
+inline int f1029_4(int x) { return x * 4; }
+inline int f1029_5(int x) { return x * 5; }
+inline int f1029_6(int x) { return x * 6; }
+inline int f1029_7(int x) { return x * 7; }
+inline int f1029_8(int x) { return x * 8; }
+inline int f1029_9(int x) { return x * 9; }
+inline int f1029_10(int x) { return x * 10; }
+inline int f1029_11(int x) { return x * 11; }
+inline int f1029_12(int x) { return x * 12; }
+inline int f1029_13(int x) { return x * 13; }
+inline int f1029_14(int x) { return x * 14; }
+inline int f1029_15(int x) { return x * 15; }
+inline int f1029_16(int x) { return x * 16; }
+inline int f1029_17(int x) { return x * 17; }
+inline int f1029_18(int x) { return x * 18; }
+inline int f1029_19(int x) { return x * 19; }
+inline int f1029_20(int x) { return x * 20; }
+inline int f1029_21(int x) { return x * 21; }
+inline int f1029_22(int x) { return x * 22; }
+inline int f1029_23(int x) { return x * 23; }
+inline int f1029_24(int x) { return x * 24; }
+inline int f1029_25(int x) { return x * 25; }
+inline int f1029_26(int x) { return x * 26; }
+inline int f1029_27(int x) { return x * 27; }
+inline int f1029_28(int x) { return x * 28; }
+inline int f1029_29(int x) { return x * 29; }
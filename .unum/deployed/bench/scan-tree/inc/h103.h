@@ -0,0 +1,42 @@
+#pragma once
+/* header 103 */
+#include <vector>
+#include "h5960.h"
+#include "h150.h"
+#include "h6760.h"
+#include "h8810.h"
+#include "h9297.h"
+#ifdef X
+#include "h6825.h"
+#endif
+struct S103 { int a; const char *s = "x//y"; };
+inline int f103_0(int x) { return x * 0; }
+inline int f103_1(int x) { return x * 1; }
+inline int f103_2(int x) { return x * 2; }
+inline int f103_3(int x) { return x * 3; }
+inline int f103_4(int x) { return x * 4; }
+inline int f103_5(int x) { return x * 5; }
+inline int f103_6(int x) { return x * 6; }
+inline int f103_7(int x) { return x * 7; }
+inline int f103_8(int x) { return x * 8; }
+inline int f103_9(int x) { return x * 9; }
+inline int f103_10(int x) { return x * 10; }
+inline int f103_11(int x) { return x * 11; }
+inline int f103_12(int x) { return x * 12; }
+inline int f103_13(int x) { return x * 13; }
+inline int f103_14(int x) { return x * 14; }
+inline int f103_15(int x) { return x * 15; }
+inline int f103_16(int x) { return x * 16; }
+inline int f103_17(int x) { return x * 17; }
+inline int f103_18(int x) { return x * 18; }
+inline int f103_19(int x) { return x * 19; }
+inline int f103_20(int x) { return x * 20; }
+inline int f103_21(int x) { return x * 21; }
+inline int f103_22(int x) { return x * 22; }
+inline int f103_23(int x) { return x * 23; }
+inline int f103_24(int x) { return x * 24; }
+inline int f103_25(int x) { return x * 25; }
+inline int f103_26(int x) { return x * 26; }
+inline int f103_27(int x) { return x * 27; }
+inline int f103_28(int x) { return x * 28; }
+inline int f103_29(int x) { return x * 29; }
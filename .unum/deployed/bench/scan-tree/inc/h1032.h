@@ -0,0 +1,42 @@
+#pragma once
+/* header 1032 */
+#include <vector>
+#include "h84.h"
+#include "h3282.h"
+#include "h3475.h"
+#include "h4765.h"
+#include "h2366.h"
+#ifdef X
+#include "h2541.h"
+#endif
+struct S1032 { int a; const char *s = "x//y"; };
+inline int f1032_0(int x) { return x * 0; }
+inline int f1032_1(int x) { return x * 1; }
+inline int f1032_2(int x) { return x * 2; }
+inline int f1032_3(int x) { return x * 3; }
+inline int f1032_4(int x) { return x * 4; }
+inline int f1032_5(int x) { return x * 5; }
+inline int f1032_6(int x) { return x * 6; }
+inline int f1032_7(int x) { return x * 7; }
+inline int f1032_8(int x) { return x * 8; }
+inline int f1032_9(int x) { return x * 9; }
+inline int f1032_10(int x) { return x * 10; }
+inline int f1032_11(int x) { return x * 11; }
+inline int f1032_12(int x) { return x * 12; }
+inline int f1032_13(int x) { return x * 13; }
+inline int f1032_14(int x) { return x * 14; }
+inline int f1032_15(int x) { return x * 15; }
+inline int f1032_16(int x) { return x * 16; }
+inline int f1032_17(int x) { return x * 17; }
+inline int f1032_18(int x) { return x * 18; }
+inline int f1032_19(int x) { return x * 19; }
+inline int f1032_20(int x) { return x * 20; }
+inline int f1032_21(int x) { return x * 21; }
+inline int f1032_22(int x) { return x * 22; }
+inline int f1032_23(int x) { return x * 23; }
+inline int f1032_24(int x) { return x * 24; }
+inline int f1032_25(int x) { return x * 25; }
+inline int f1032_26(int x) { return x * 26; }
+inline int f1032_27(int x) { return x * 27; }
+inline int f1032_28(int x) { return x * 28; }
+inline int f1032_29(int x) { return x * 29; }
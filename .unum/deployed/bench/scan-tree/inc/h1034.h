@@ -0,0 +1,42 @@
+#pragma once
+/* header 1034 */
+#include <vector>
+#include "h3990.h"
+#include "h6959.h"
+#include "h5448.h"
+#include "h1925.h"
+#include "h2821.h"
+#ifdef X
+#include "h8344.h"
+#endif
+struct S1034 { int a; const char *s = "x//y"; };
+inline int f1034_0(int x) { return x * 0; }
+inline int f1034_1(int x) { return x * 1; }
+inline int f1034_2(int x) { return x * 2; }
+inline int f1034_3(int x) { return x * 3; }
+inline int f1034_4(int x) { return x * 4; }
+inline int f1034_5(int x) { return x * 5; }
+inline int f1034_6(int x) { return x * 6; }
+inline int f1034_7(int x) { return x * 7; }
+inline int f1034_8(int x) { return x * 8; }
+inline int f1034_9(int x) { return x * 9; }
+inline int f1034_10(int x) { return x * 10; }
+inline int f1034_11(int x) { return x * 11; }
+inline int f1034_12(int x) { return x * 12; }
+inline int f1034_13(int x) { return x * 13; }
+inline int f1034_14(int x) { return x * 14; }
+inline int f1034_15(int x) { return x * 15; }
+inline int f1034_16(int x) { return x * 16; }
+inline int f1034_17(int x) { return x * 17; }
+inline int f1034_18(int x) { return x * 18; }
+inline int f1034_19(int x) { return x * 19; }
+inline int f1034_20(int x) { return x * 20; }
+inline int f1034_21(int x) { return x * 21; }
+inline int f1034_22(int x) { return x * 22; }
+inline int f1034_23(int x) { return x * 23; }
+inline int f1034_24(int x) { return x * 24; }
+inline int f1034_25(int x) { return x * 25; }
+inline int f1034_26(int x) { return x * 26; }
+inline int f1034_27(int x) { return x * 27; }
+inline int f1034_28(int x) { return x * 28; }
+inline int f1034_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1036 */
+#include <vector>
+#include "h5273.h"
+#include "h9911.h"
+#include "h1386.h"
+#include "h6227.h"
+#include "h5148.h"
+#ifdef X
+#include "h1038.h"
+#endif
+struct S1036 { int a; const char *s = "x//y"; };
+inline int f1036_0(int x) { return x * 0; }
+inline int f1036_1(int x) { return x * 1; }
+inline int f1036_2(int x) { return x * 2; }
+inline int f1036_3(int x) { return x * 3; }
+inline int f1036_4(int x) { return x * 4; }
+inline int f1036_5(int x) { return x * 5; }
+inline int f1036_6(int x) { return x * 6; }
+inline int f1036_7(int x) { return x * 7; }
+inline int f1036_8(int x) { return x * 8; }
+inline int f1036_9(int x) { return x * 9; }
+inline int f1036_10(int x) { return x * 10; }
+inline int f1036_11(int x) { return x * 11; }
+inline int f1036_12(int x) { return x * 12; }
+inline int f1036_13(int x) { return x * 13; }
+inline int f1036_14(int x) { return x * 14; }
+inline int f1036_15(int x) { return x * 15; }
+inline int f1036_16(int x) { return x * 16; }
+inline int f1036_17(int x) { return x * 17; }
+inline int f1036_18(int x) { return x * 18; }
+inline int f1036_19(int x) { return x * 19; }
+inline int f1036_20(int x) { return x * 20; }
+inline int f1036_21(int x) { return x * 21; }
+inline int f1036_22(int x) { return x * 22; }
+inline int f1036_23(int x) { return x * 23; }
+inline int f1036_24(int x) { return x * 24; }
+inline int f1036_25(int x) { return x * 25; }
+inline int f1036_26(int x) { return x * 26; }
+inline int f1036_27(int x) { return x * 27; }
+inline int f1036_28(int x) { return x * 28; }
+inline int f1036_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1039 */
+#include <vector>
+#include "h7685.h"
+#include "h2255.h"
+#include "h7826.h"
+#include "h8112.h"
+#include "h2296.h"
+#ifdef X
+#include "h6365.h"
+#endif
+struct S1039 { int a; const char *s = "x//y"; };
+inline int f1039_0(int x) { return x * 0; }
+inline int f1039_1(int x) { return x * 1; }
+inline int f1039_2(int x) { return x * 2; }
+inline int f1039_3(int x) { return x * 3; }
+inline int f1039_4(int x) { return x * 4; }
+inline int f1039_5(int x) { return x * 5; }
+inline int f1039_6(int x) { return x * 6; }
+inline int f1039_7(int x) { return x * 7; }
+inline int f1039_8(int x) { return x * 8; }
+inline int f1039_9(int x) { return x * 9; }
+inline int f1039_10(int x) { return x * 10; }
+inline int f1039_11(int x) { return x * 11; }
+inline int f1039_12(int x) { return x * 12; }
+inline int f1039_13(int x) { return x * 13; }
+inline int f1039_14(int x) { return x * 14; }
+inline int f1039_15(int x) { return x * 15; }
+inline int f1039_16(int x) { return x * 16; }
+inline int f1039_17(int x) { return x * 17; }
+inline int f1039_18(int x) { return x * 18; }
+inline int f1039_19(int x) { return x * 19; }
+inline int f1039_20(int x) { return x * 20; }
+inline int f1039_21(int x) { return x * 21; }
+inline int f1039_22(int x) { return x * 22; }
+inline int f1039_23(int x) { return x * 23; }
+inline int f1039_24(int x) { return x * 24; }
+inline int f1039_25(int x) { return x * 25; }
+inline int f1039_26(int x) { return x * 26; }
+inline int f1039_27(int x) { return x * 27; }
+inline int f1039_28(int x) { return x * 28; }
+inline int f1039_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1042 */
+#include <vector>
+#include "h546.h"
+#include "h9090.h"
+#include "h504.h"
+#include "h3219.h"
+#include "h980.h"
+#ifdef X
+#include "h7492.h"
+#endif
+struct S1042 { int a; const char *s = "x//y"; };
+inline int f1042_0(int x) { return x * 0; }
+inline int f1042_1(int x) { return x * 1; }
+inline int f1042_2(int x) { return x * 2; }
+inline int f1042_3(int x) { return x * 3; }
+inline int f1042_4(int x) { return x * 4; }
+inline int f1042_5(int x) { return x * 5; }
+inline int f1042_6(int x) { return x * 6; }
+inline int f1042_7(int x) { return x * 7; }
+inline int f1042_8(int x) { return x * 8; }
+inline int f1042_9(int x) { return x * 9; }
+inline int f1042_10(int x) { return x * 10; }
+inline int f1042_11(int x) { return x * 11; }
+inline int f1042_12(int x) { return x * 12; }
+inline int f1042_13(int x) { return x * 13; }
+inline int f1042_14(int x) { return x * 14; }
+inline int f1042_15(int x) { return x * 15; }
+inline int f1042_16(int x) { return x * 16; }
+inline int f1042_17(int x) { return x * 17; }
+inline int f1042_18(int x) { return x * 18; }
+inline int f1042_19(int x) { return x * 19; }
+inline int f1042_20(int x) { return x * 20; }
+inline int f1042_21(int x) { return x * 21; }
+inline int f1042_22(int x) { return x * 22; }
+inline int f1042_23(int x) { return x * 23; }
+inline int f1042_24(int x) { return x * 24; }
+inline int f1042_25(int x) { return x * 25; }
+inline int f1042_26(int x) { return x * 26; }
+inline int f1042_27(int x) { return x * 27; }
+inline int f1042_28(int x) { return x * 28; }
+inline int f1042_29(int x) { return x * 29; }
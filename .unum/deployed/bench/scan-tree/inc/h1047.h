@@ -0,0 +1,42 @@
+#pragma once
+/* header 1047 */
+#include <vector>
+#include "h5519.h"
+#include "h7024.h"
+#include "h2883.h"
+#include "h7111.h"
+#include "h4037.h"
+#ifdef X
+#include "h2987.h"
+#endif
+struct S1047 { int a; const char *s = "x//y"; };
+inline int f1047_0(int x) { return x * 0; }
+inline int f1047_1(int x) { return x * 1; }
+inline int f1047_2(int x) { return x * 2; }
+inline int f1047_3(int x) { return x * 3; }
+inline int f1047_4(int x) { return x * 4; }
+inline int f1047_5(int x) { return x * 5; }
+inline int f1047_6(int x) { return x * 6; }
+inline int f1047_7(int x) { return x * 7; }
+inline int f1047_8(int x) { return x * 8; }
+inline int f1047_9(int x) { return x * 9; }
+inline int f1047_10(int x) { return x * 10; }
+inline int f1047_11(int x) { return x * 11; }
+inline int f1047_12(int x) { return x * 12; }
+inline int f1047_13(int x) { return x * 13; }
+inline int f1047_14(int x) { return x * 14; }
+inline int f1047_15(int x) { return x * 15; }
+inline int f1047_16(int x) { return x * 16; }
+inline int f1047_17(int x) { return x * 17; }
+inline int f1047_18(int x) { return x * 18; }
+inline int f1047_19(int x) { return x * 19; }
+inline int f1047_20(int x) { return x * 20; }
+inline int f1047_21(int x) { return x * 21; }
+inline int f1047_22(int x) { return x * 22; }
+inline int f1047_23(int x) { return x * 23; }
+inline int f1047_24(int x) { return x * 24; }
+inline int f1047_25(int x) { return x * 25; }
+inline int f1047_26(int x) { return x * 26; }
+inline int f1047_27(int x) { return x * 27; }
+inline int f1047_28(int x) { return x * 28; }
+inline int f1047_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1049 */
+#include <vector>
+#include "h5527.h"
+#include "h7235.h"
+#include "h6064.h"
+#include "h2305.h"
+#include "h6753.h"
+#ifdef X
+#include "h3173.h"
+#endif
+struct S1049 { int a; const char *s = "x//y"; };
+inline int f1049_0(int x) { return x * 0; }
+inline int f1049_1(int x) { return x * 1; }
+inline int f1049_2(int x) { return x * 2; }
+inline int f1049_3(int x) { return x * 3; }
+inline int f1049_4(int x) { return x * 4; }
+inline int f1049_5(int x) { return x * 5; }
+inline int f1049_6(int x) { return x * 6; }
+inline int f1049_7(int x) { return x * 7; }
+inline int f1049_8(int x) { return x * 8; }
+inline int f1049_9(int x) { return x * 9; }
+inline int f1049_10(int x) { return x * 10; }
+inline int f1049_11(int x) { return x * 11; }
+inline int f1049_12(int x) { return x * 12; }
+inline int f1049_13(int x) { return x * 13; }
+inline int f1049_14(int x) { return x * 14; }
+inline int f1049_15(int x) { return x * 15; }
+inline int f1049_16(int x) { return x * 16; }
+inline int f1049_17(int x) { return x * 17; }
+inline int f1049_18(int x) { return x * 18; }
+inline int f1049_19(int x) { return x * 19; }
+inline int f1049_20(int x) { return x * 20; }
+inline int f1049_21(int x) { return x * 21; }
+inline int f1049_22(int x) { return x * 22; }
+inline int f1049_23(int x) { return x * 23; }
+inline int f1049_24(int x) { return x * 24; }
+inline int f1049_25(int x) { return x * 25; }
+inline int f1049_26(int x) { return x * 26; }
+inline int f1049_27(int x) { return x * 27; }
+inline int f1049_28(int x) { return x * 28; }
+inline int f1049_29(int x) { return x * 29; }
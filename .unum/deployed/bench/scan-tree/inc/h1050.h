@@ -0,0 +1,42 @@
+#pragma once
+/* header 1050 */
+#include <vector>
+#include "h5889.h"
+#include "h9411.h"
+#include "h3922.h"
+#include "h4367.h"
+#include "h1373.h"
+#ifdef X
+#include "h9851.h"
+#endif
+struct S1050 { int a; const char *s = "x//y"; };
+inline int f1050_0(int x) { return x * 0; }
+inline int f1050_1(int x) { return x * 1; }
+inline int f1050_2(int x) { return x * 2; }
+inline int f1050_3(int x) { return x * 3; }
+inline int f1050_4(int x) { return x * 4; }
+inline int f1050_5(int x) { return x * 5; }
+inline int f1050_6(int x) { return x * 6; }
+inline int f1050_7(int x) { return x * 7; }
+inline int f1050_8(int x) { return x * 8; }
+inline int f1050_9(int x) { return x * 9; }
+inline int f1050_10(int x) { return x * 10; }
+inline int f1050_11(int x) { return x * 11; }
+inline int f1050_12(int x) { return x * 12; }
+inline int f1050_13(int x) { return x * 13; }
+inline int f1050_14(int x) { return x * 14; }
+inline int f1050_15(int x) { return x * 15; }
+inline int f1050_16(int x) { return x * 16; }
+inline int f1050_17(int x) { return x * 17; }
+inline int f1050_18(int x) { return x * 18; }
+inline int f1050_19(int x) { return x * 19; }
+inline int f1050_20(int x) { return x * 20; }
+inline int f1050_21(int x) { return x * 21; }
+inline int f1050_22(int x) { return x * 22; }
+inline int f1050_23(int x) { return x * 23; }
+inline int f1050_24(int x) { return x * 24; }
+inline int f1050_25(int x) { return x * 25; }
+inline int f1050_26(int x) { return x * 26; }
+inline int f1050_27(int x) { return x * 27; }
+inline int f1050_28(int x) { return x * 28; }
+inline int f1050_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1053 */
+#include <vector>
+#include "h1248.h"
+#include "h2364.h"
+#include "h571.h"
+#include "h2761.h"
+#include "h4468.h"
+#ifdef X
+#include "h3738.h"
+#endif
+struct S1053 { int a; const char *s = "x//y"; };
+inline int f1053_0(int x) { return x * 0; }
+inline int f1053_1(int x) { return x * 1; }
+inline int f1053_2(int x) { return x * 2; }
+inline int f1053_3(int x) { return x * 3; }
+inline int f1053_4(int x) { return x * 4; }
+inline int f1053_5(int x) { return x * 5; }
+inline int f1053_6(int x) { return x * 6; }
+inline int f1053_7(int x) { return x * 7; }
+inline int f1053_8(int x) { return x * 8; }
+inline int f1053_9(int x) { return x * 9; }
+inline int f1053_10(int x) { return x * 10; }
+inline int f1053_11(int x) { return x * 11; }
+inline int f1053_12(int x) { return x * 12; }
+inline int f1053_13(int x) { return x * 13; }
+inline int f1053_14(int x) { return x * 14; }
+inline int f1053_15(int x) { return x * 15; }
+inline int f1053_16(int x) { return x * 16; }
+inline int f1053_17(int x) { return x * 17; }
+inline int f1053_18(int x) { return x * 18; }
+inline int f1053_19(int x) { return x * 19; }
+inline int f1053_20(int x) { return x * 20; }
+inline int f1053_21(int x) { return x * 21; }
+inline int f1053_22(int x) { return x * 22; }
+inline int f1053_23(int x) { return x * 23; }
+inline int f1053_24(int x) { return x * 24; }
+inline int f1053_25(int x) { return x * 25; }
+inline int f1053_26(int x) { return x * 26; }
+inline int f1053_27(int x) { return x * 27; }
+inline int f1053_28(int x) { return x * 28; }
+inline int f1053_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1056 */
+#include <vector>
+#include "h1020.h"
+#include "h5567.h"
+#include "h5356.h"
+#include "h5574.h"
+#include "h4050.h"
+#ifdef X
+#include "h3758.h"
+#endif
+struct S1056 { int a; const char *s = "x//y"; };
+inline int f1056_0(int x) { return x * 0; }
+inline int f1056_1(int x) { return x * 1; }
+inline int f1056_2(int x) { return x * 2; }
+inline int f1056_3(int x) { return x * 3; }
+inline int f1056_4(int x) { return x * 4; }
+inline int f1056_5(int x) { return x * 5; }
+inline int f1056_6(int x) { return x * 6; }
+inline int f1056_7(int x) { return x * 7; }
+inline int f1056_8(int x) { return x * 8; }
+inline int f1056_9(int x) { return x * 9; }
+inline int f1056_10(int x) { return x * 10; }
+inline int f1056_11(int x) { return x * 11; }
+inline int f1056_12(int x) { return x * 12; }
+inline int f1056_13(int x) { return x * 13; }
+inline int f1056_14(int x) { return x * 14; }
+inline int f1056_15(int x) { return x * 15; }
+inline int f1056_16(int x) { return x * 16; }
+inline int f1056_17(int x) { return x * 17; }
+inline int f1056_18(int x) { return x * 18; }
+inline int f1056_19(int x) { return x * 19; }
+inline int f1056_20(int x) { return x * 20; }
+inline int f1056_21(int x) { return x * 21; }
+inline int f1056_22(int x) { return x * 22; }
+inline int f1056_23(int x) { return x * 23; }
+inline int f1056_24(int x) { return x * 24; }
+inline int f1056_25(int x) { return x * 25; }
+inline int f1056_26(int x) { return x * 26; }
+inline int f1056_27(int x) { return x * 27; }
+inline int f1056_28(int x) { return x * 28; }
+inline int f1056_29(int x) { return x * 29; }
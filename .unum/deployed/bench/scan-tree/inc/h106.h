@@ -0,0 +1,42 @@
+#pragma once
+/* header 106 */
+#include <vector>
+#include "h9874.h"
+#include "h3110.h"
+#include "h6539.h"
+#include "h2703.h"
+#include "h4177.h"
+#ifdef X
+#include "h7581.h"
+#endif
+struct S106 { int a; const char *s = "x//y"; };
+inline int f106_0(int x) { return x * 0; }
+inline int f106_1(int x) { return x * 1; }
+inline int f106_2(int x) { return x * 2; }
+inline int f106_3(int x) { return x * 3; }
+inline int f106_4(int x) { return x * 4; }
+inline int f106_5(int x) { return x * 5; }
+inline int f106_6(int x) { return x * 6; }
+inline int f106_7(int x) { return x * 7; }
+inline int f106_8(int x) { return x * 8; }
+inline int f106_9(int x) { return x * 9; }
+inline int f106_10(int x) { return x * 10; }
+inline int f106_11(int x) { return x * 11; }
+inline int f106_12(int x) { return x * 12; }
+inline int f106_13(int x) { return x * 13; }
+inline int f106_14(int x) { return x * 14; }
+inline int f106_15(int x) { return x * 15; }
+inline int f106_16(int x) { return x * 16; }
+inline int f106_17(int x) { return x * 17; }
+inline int f106_18(int x) { return x * 18; }
+inline int f106_19(int x) { return x * 19; }
+inline int f106_20(int x) { return x * 20; }
+inline int f106_21(int x) { return x * 21; }
+inline int f106_22(int x) { return x * 22; }
+inline int f106_23(int x) { return x * 23; }
+inline int f106_24(int x) { return x * 24; }
+inline int f106_25(int x) { return x * 25; }
+inline int f106_26(int x) { return x * 26; }
+inline int f106_27(int x) { return x * 27; }
+inline int f106_28(int x) { return x * 28; }
+inline int f106_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1060 */
+#include <vector>
+#include "h246.h"
+#include "h4378.h"
+#include "h5192.h"
+#include "h958.h"
+#include "h9955.h"
+#ifdef X
+#include "h1478.h"
+#endif
+struct S1060 { int a; const char *s = "x//y"; };
+inline int f1060_0(int x) { return x * 0; }
+inline int f1060_1(int x) { return x * 1; }
+inline int f1060_2(int x) { return x * 2; }
+inline int f1060_3(int x) { return x * 3; }
+inline int f1060_4(int x) { return x * 4; }
+inline int f1060_5(int x) { return x * 5; }
+inline int f1060_6(int x) { return x * 6; }
+inline int f1060_7(int x) { return x * 7; }
+inline int f1060_8(int x) { return x * 8; }
+inline int f1060_9(int x) { return x * 9; }
+inline int f1060_10(int x) { return x * 10; }
+inline int f1060_11(int x) { return x * 11; }
+inline int f1060_12(int x) { return x * 12; }
+inline int f1060_13(int x) { return x * 13; }
+inline int f1060_14(int x) { return x * 14; }
+inline int f1060_15(int x) { return x * 15; }
+inline int f1060_16(int x) { return x * 16; }
+inline int f1060_17(int x) { return x * 17; }
+inline int f1060_18(int x) { return x * 18; }
+inline int f1060_19(int x) { return x * 19; }
+inline int f1060_20(int x) { return x * 20; }
+inline int f1060_21(int x) { return x * 21; }
+inline int f1060_22(int x) { return x * 22; }
+inline int f1060_23(int x) { return x * 23; }
+inline int f1060_24(int x) { return x * 24; }
+inline int f1060_25(int x) { return x * 25; }
+inline int f1060_26(int x) { return x * 26; }
+inline int f1060_27(int x) { return x * 27; }
+inline int f1060_28(int x) { return x * 28; }
+inline int f1060_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1061 */
+#include <vector>
+#include "h9666.h"
+#include "h5819.h"
+#include "h9412.h"
+#include "h8706.h"
+#include "h4150.h"
+#ifdef X
+#include "h9580.h"
+#endif
+struct S1061 { int a; const char *s = "x//y"; };
+inline int f1061_0(int x) { return x * 0; }
+inline int f1061_1(int x) { return x * 1; }
+inline int f1061_2(int x) { return x * 2; }
+inline int f1061_3(int x) { return x * 3; }
+inline int f1061_4(int x) { return x * 4; }
+inline int f1061_5(int x) { return x * 5; }
+inline int f1061_6(int x) { return x * 6; }
+inline int f1061_7(int x) { return x * 7; }
+inline int f1061_8(int x) { return x * 8; }
+inline int f1061_9(int x) { return x * 9; }
+inline int f1061_10(int x) { return x * 10; }
+inline int f1061_11(int x) { return x * 11; }
+inline int f1061_12(int x) { return x * 12; }
+inline int f1061_13(int x) { return x * 13; }
+inline int f1061_14(int x) { return x * 14; }
+inline int f1061_15(int x) { return x * 15; }
+inline int f1061_16(int x) { return x * 16; }
+inline int f1061_17(int x) { return x * 17; }
+inline int f1061_18(int x) { return x * 18; }
+inline int f1061_19(int x) { return x * 19; }
+inline int f1061_20(int x) { return x * 20; }
+inline int f1061_21(int x) { return x * 21; }
+inline int f1061_22(int x) { return x * 22; }
+inline int f1061_23(int x) { return x * 23; }
+inline int f1061_24(int x) { return x * 24; }
+inline int f1061_25(int x) { return x * 25; }
+inline int f1061_26(int x) { return x * 26; }
+inline int f1061_27(int x) { return x * 27; }
+inline int f1061_28(int x) { return x * 28; }
+inline int f1061_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1066 */
+#include <vector>
+#include "h8572.h"
+#include "h8632.h"
+#include "h7456.h"
+#include "h2637.h"
+#include "h2802.h"
+#ifdef X
+#include "h7871.h"
+#endif
+struct S1066 { int a; const char *s = "x//y"; };
+inline int f1066_0(int x) { return x * 0; }
+inline int f1066_1(int x) { return x * 1; }
+inline int f1066_2(int x) { return x * 2; }
+inline int f1066_3(int x) { return x * 3; }
+inline int f1066_4(int x) { return x * 4; }
+inline int f1066_5(int x) { return x * 5; }
+inline int f1066_6(int x) { return x * 6; }
+inline int f1066_7(int x) { return x * 7; }
+inline int f1066_8(int x) { return x * 8; }
+inline int f1066_9(int x) { return x * 9; }
+inline int f1066_10(int x) { return x * 10; }
+inline int f1066_11(int x) { return x * 11; }
+inline int f1066_12(int x) { return x * 12; }
+inline int f1066_13(int x) { return x * 13; }
+inline int f1066_14(int x) { return x * 14; }
+inline int f1066_15(int x) { return x * 15; }
+inline int f1066_16(int x) { return x * 16; }
+inline int f1066_17(int x) { return x * 17; }
+inline int f1066_18(int x) { return x * 18; }
+inline int f1066_19(int x) { return x * 19; }
+inline int f1066_20(int x) { return x * 20; }
+inline int f1066_21(int x) { return x * 21; }
+inline int f1066_22(int x) { return x * 22; }
+inline int f1066_23(int x) { return x * 23; }
+inline int f1066_24(int x) { return x * 24; }
+inline int f1066_25(int x) { return x * 25; }
+inline int f1066_26(int x) { return x * 26; }
+inline int f1066_27(int x) { return x * 27; }
+inline int f1066_28(int x) { return x * 28; }
+inline int f1066_29(int x) { return x * 29; }
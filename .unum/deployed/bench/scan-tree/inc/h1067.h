@@ -0,0 +1,42 @@
+#pragma once
+/* header 1067 */
+#include <vector>
+#include "h9663.h"
+#include "h9971.h"
+#include "h2808.h"
+#include "h5929.h"
+#include "h6589.h"
+#ifdef X
+#include "h3334.h"
+#endif
+struct S1067 { int a; const char *s = "x//y"; };
+inline int f1067_0(int x) { return x * 0; }
+inline int f1067_1(int x) { return x * 1; }
+inline int f1067_2(int x) { return x * 2; }
+inline int f1067_3(int x) { return x * 3; }
+inline int f1067_4(int x) { return x * 4; }
+inline int f1067_5(int x) { return x * 5; }
+inline int f1067_6(int x) { return x * 6; }
+inline int f1067_7(int x) { return x * 7; }
+inline int f1067_8(int x) { return x * 8; }
+inline int f1067_9(int x) { return x * 9; }
+inline int f1067_10(int x) { return x * 10; }
+inline int f1067_11(int x) { return x * 11; }
+inline int f1067_12(int x) { return x * 12; }
+inline int f1067_13(int x) { return x * 13; }
+inline int f1067_14(int x) { return x * 14; }
+inline int f1067_15(int x) { return x * 15; }
+inline int f1067_16(int x) { return x * 16; }
+inline int f1067_17(int x) { return x * 17; }
+inline int f1067_18(int x) { return x * 18; }
+inline int f1067_19(int x) { return x * 19; }
+inline int f1067_20(int x) { return x * 20; }
+inline int f1067_21(int x) { return x * 21; }
+inline int f1067_22(int x) { return x * 22; }
+inline int f1067_23(int x) { return x * 23; }
+inline int f1067_24(int x) { return x * 24; }
+inline int f1067_25(int x) { return x * 25; }
+inline int f1067_26(int x) { return x * 26; }
+inline int f1067_27(int x) { return x * 27; }
+inline int f1067_28(int x) { return x * 28; }
+inline int f1067_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1068 */
+#include <vector>
+#include "h8248.h"
+#include "h2694.h"
+#include "h2809.h"
+#include "h9170.h"
+#include "h3845.h"
+#ifdef X
+#include "h8250.h"
+#endif
+struct S1068 { int a; const char *s = "x//y"; };
+inline int f1068_0(int x) { return x * 0; }
+inline int f1068_1(int x) { return x * 1; }
+inline int f1068_2(int x) { return x * 2; }
+inline int f1068_3(int x) { return x * 3; }
+inline int f1068_4(int x) { return x * 4; }
+inline int f1068_5(int x) { return x * 5; }
+inline int f1068_6(int x) { return x * 6; }
+inline int f1068_7(int x) { return x * 7; }
+inline int f1068_8(int x) { return x * 8; }
+inline int f1068_9(int x) { return x * 9; }
+inline int f1068_10(int x) { return x * 10; }
+inline int f1068_11(int x) { return x * 11; }
+inline int f1068_12(int x) { return x * 12; }
+inline int f1068_13(int x) { return x * 13; }
+inline int f1068_14(int x) { return x * 14; }
+inline int f1068_15(int x) { return x * 15; }
+inline int f1068_16(int x) { return x * 16; }
+inline int f1068_17(int x) { return x * 17; }
+inline int f1068_18(int x) { return x * 18; }
+inline int f1068_19(int x) { return x * 19; }
+inline int f1068_20(int x) { return x * 20; }
+inline int f1068_21(int x) { return x * 21; }
+inline int f1068_22(int x) { return x * 22; }
+inline int f1068_23(int x) { return x * 23; }
+inline int f1068_24(int x) { return x * 24; }
+inline int f1068_25(int x) { return x * 25; }
+inline int f1068_26(int x) { return x * 26; }
+inline int f1068_27(int x) { return x * 27; }
+inline int f1068_28(int x) { return x * 28; }
+inline int f1068_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 107 */
+#include <vector>
+#include "h3373.h"
+#include "h1046.h"
+#include "h8537.h"
+#include "h2244.h"
+#include "h317.h"
+#ifdef X
+#include "h8141.h"
+#endif
+struct S107 { int a; const char *s = "x//y"; };
+inline int f107_0(int x) { return x * 0; }
+inline int f107_1(int x) { return x * 1; }
+inline int f107_2(int x) { return x * 2; }
+inline int f107_3(int x) { return x * 3; }
+inline int f107_4(int x) { return x * 4; }
+inline int f107_5(int x) { return x * 5; }
+inline int f107_6(int x) { return x * 6; }
+inline int f107_7(int x) { return x * 7; }
+inline int f107_8(int x) { return x * 8; }
+inline int f107_9(int x) { return x * 9; }
+inline int f107_10(int x) { return x * 10; }
+inline int f107_11(int x) { return x * 11; }
+inline int f107_12(int x) { return x * 12; }
+inline int f107_13(int x) { return x * 13; }
+inline int f107_14(int x) { return x * 14; }
+inline int f107_15(int x) { return x * 15; }
+inline int f107_16(int x) { return x * 16; }
+inline int f107_17(int x) { return x * 17; }
+inline int f107_18(int x) { return x * 18; }
+inline int f107_19(int x) { return x * 19; }
+inline int f107_20(int x) { return x * 20; }
+inline int f107_21(int x) { return x * 21; }
+inline int f107_22(int x) { return x * 22; }
+inline int f107_23(int x) { return x * 23; }
+inline int f107_24(int x) { return x * 24; }
+inline int f107_25(int x) { return x * 25; }
+inline int f107_26(int x) { return x * 26; }
+inline int f107_27(int x) { return x * 27; }
+inline int f107_28(int x) { return x * 28; }
+inline int f107_29(int x) { return x * 29; }
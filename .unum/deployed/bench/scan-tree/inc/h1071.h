@@ -0,0 +1,42 @@
+#pragma once
+/* header 1071 */
+#include <vector>
+#include "h3739.h"
+#include "h1345.h"
+#include "h1070.h"
+#include "h4686.h"
+#include "h3392.h"
+#ifdef X
+#include "h7273.h"
+#endif
+struct S1071 { int a; const char *s = "x//y"; };
+inline int f1071_0(int x) { return x * 0; }
+inline int f1071_1(int x) { return x * 1; }
+inline int f1071_2(int x) { return x * 2; }
+inline int f1071_3(int x) { return x * 3; }
+inline int f1071_4(int x) { return x * 4; }
+inline int f1071_5(int x) { return x * 5; }
+inline int f1071_6(int x) { return x * 6; }
+inline int f1071_7(int x) { return x * 7; }
+inline int f1071_8(int x) { return x * 8; }
+inline int f1071_9(int x) { return x * 9; }
+inline int f1071_10(int x) { return x * 10; }
+inline int f1071_11(int x) { return x * 11; }
+inline int f1071_12(int x) { return x * 12; }
+inline int f1071_13(int x) { return x * 13; }
+inline int f1071_14(int x) { return x * 14; }
+inline int f1071_15(int x) { return x * 15; }
+inline int f1071_16(int x) { return x * 16; }
+inline int f1071_17(int x) { return x * 17; }
+inline int f1071_18(int x) { return x * 18; }
+inline int f1071_19(int x) { return x * 19; }
+inline int f1071_20(int x) { return x * 20; }
+inline int f1071_21(int x) { return x * 21; }
+inline int f1071_22(int x) { return x * 22; }
+inline int f1071_23(int x) { return x * 23; }
+inline int f1071_24(int x) { return x * 24; }
+inline int f1071_25(int x) { return x * 25; }
+inline int f1071_26(int x) { return x * 26; }
+inline int f1071_27(int x) { return x * 27; }
+inline int f1071_28(int x) { return x * 28; }
+inline int f1071_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1072 */
+#include <vector>
+#include "h6354.h"
+#include "h9845.h"
+#include "h4083.h"
+#include "h3462.h"
+#include "h686.h"
+#ifdef X
+#include "h2655.h"
+#endif
+struct S1072 { int a; const char *s = "x//y"; };
+inline int f1072_0(int x) { return x * 0; }
+inline int f1072_1(int x) { return x * 1; }
+inline int f1072_2(int x) { return x * 2; }
+inline int f1072_3(int x) { return x * 3; }
+inline int f1072_4(int x) { return x * 4; }
+inline int f1072_5(int x) { return x * 5; }
+inline int f1072_6(int x) { return x * 6; }
+inline int f1072_7(int x) { return x * 7; }
+inline int f1072_8(int x) { return x * 8; }
+inline int f1072_9(int x) { return x * 9; }
+inline int f1072_10(int x) { return x * 10; }
+inline int f1072_11(int x) { return x * 11; }
+inline int f1072_12(int x) { return x * 12; }
+inline int f1072_13(int x) { return x * 13; }
+inline int f1072_14(int x) { return x * 14; }
+inline int f1072_15(int x) { return x * 15; }
+inline int f1072_16(int x) { return x * 16; }
+inline int f1072_17(int x) { return x * 17; }
+inline int f1072_18(int x) { return x * 18; }
+inline int f1072_19(int x) { return x * 19; }
+inline int f1072_20(int x) { return x * 20; }
+inline int f1072_21(int x) { return x * 21; }
+inline int f1072_22(int x) { return x * 22; }
+inline int f1072_23(int x) { return x * 23; }
+inline int f1072_24(int x) { return x * 24; }
+inline int f1072_25(int x) { return x * 25; }
+inline int f1072_26(int x) { return x * 26; }
+inline int f1072_27(int x) { return x * 27; }
+inline int f1072_28(int x) { return x * 28; }
+inline int f1072_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1074 */
+#include <vector>
+#include "h2904.h"
+#include "h4418.h"
+#include "h2044.h"
+#include "h744.h"
+#include "h314.h"
+#ifdef X
+#include "h637.h"
+#endif
+struct S1074 { int a; const char *s = "x//y"; };
+inline int f1074_0(int x) { return x * 0; }
+inline int f1074_1(int x) { return x * 1; }
+inline int f1074_2(int x) { return x * 2; }
+inline int f1074_3(int x) { return x * 3; }
+inline int f1074_4(int x) { return x * 4; }
+inline int f1074_5(int x) { return x * 5; }
+inline int f1074_6(int x) { return x * 6; }
+inline int f1074_7(int x) { return x * 7; }
+inline int f1074_8(int x) { return x * 8; }
+inline int f1074_9(int x) { return x * 9; }
+inline int f1074_10(int x) { return x * 10; }
+inline int f1074_11(int x) { return x * 11; }
+inline int f1074_12(int x) { return x * 12; }
+inline int f1074_13(int x) { return x * 13; }
+inline int f1074_14(int x) { return x * 14; }
+inline int f1074_15(int x) { return x * 15; }
+inline int f1074_16(int x) { return x * 16; }
+inline int f1074_17(int x) { return x * 17; }
+inline int f1074_18(int x) { return x * 18; }
+inline int f1074_19(int x) { return x * 19; }
+inline int f1074_20(int x) { return x * 20; }
+inline int f1074_21(int x) { return x * 21; }
+inline int f1074_22(int x) { return x * 22; }
+inline int f1074_23(int x) { return x * 23; }
+inline int f1074_24(int x) { return x * 24; }
+inline int f1074_25(int x) { return x * 25; }
+inline int f1074_26(int x) { return x * 26; }
+inline int f1074_27(int x) { return x * 27; }
+inline int f1074_28(int x) { return x * 28; }
+inline int f1074_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1075 */
+#include <vector>
+#include "h9190.h"
+#include "h7709.h"
+#include "h4961.h"
+#include "h5456.h"
+#include "h8512.h"
+#ifdef X
+#include "h2329.h"
+#endif
+struct S1075 { int a; const char *s = "x//y"; };
+inline int f1075_0(int x) { return x * 0; }
+inline int f1075_1(int x) { return x * 1; }
+inline int f1075_2(int x) { return x * 2; }
+inline int f1075_3(int x) { return x * 3; }
+inline int f1075_4(int x) { return x * 4; }
+inline int f1075_5(int x) { return x * 5; }
+inline int f1075_6(int x) { return x * 6; }
+inline int f1075_7(int x) { return x * 7; }
+inline int f1075_8(int x) { return x * 8; }
+inline int f1075_9(int x) { return x * 9; }
+inline int f1075_10(int x) { return x * 10; }
+inline int f1075_11(int x) { return x * 11; }
+inline int f1075_12(int x) { return x * 12; }
+inline int f1075_13(int x) { return x * 13; }
+inline int f1075_14(int x) { return x * 14; }
+inline int f1075_15(int x) { return x * 15; }
+inline int f1075_16(int x) { return x * 16; }
+inline int f1075_17(int x) { return x * 17; }
+inline int f1075_18(int x) { return x * 18; }
+inline int f1075_19(int x) { return x * 19; }
+inline int f1075_20(int x) { return x * 20; }
+inline int f1075_21(int x) { return x * 21; }
+inline int f1075_22(int x) { return x * 22; }
+inline int f1075_23(int x) { return x * 23; }
+inline int f1075_24(int x) { return x * 24; }
+inline int f1075_25(int x) { return x * 25; }
+inline int f1075_26(int x) { return x * 26; }
+inline int f1075_27(int x) { return x * 27; }
+inline int f1075_28(int x) { return x * 28; }
+inline int f1075_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1076 */
+#include <vector>
+#include "h9944.h"
+#include "h9703.h"
+#include "h2821.h"
+#include "h4575.h"
+#include "h3456.h"
+#ifdef X
+#include "h5832.h"
+#endif
+struct S1076 { int a; const char *s = "x//y"; };
+inline int f1076_0(int x) { return x * 0; }
+inline int f1076_1(int x) { return x * 1; }
+inline int f1076_2(int x) { return x * 2; }
+inline int f1076_3(int x) { return x * 3; }
+inline int f1076_4(int x) { return x * 4; }
+inline int f1076_5(int x) { return x * 5; }
+inline int f1076_6(int x) { return x * 6; }
+inline int f1076_7(int x) { return x * 7; }
+inline int f1076_8(int x) { return x * 8; }
+inline int f1076_9(int x) { return x * 9; }
+inline int f1076_10(int x) { return x * 10; }
+inline int f1076_11(int x) { return x * 11; }
+inline int f1076_12(int x) { return x * 12; }
+inline int f1076_13(int x) { return x * 13; }
+inline int f1076_14(int x) { return x * 14; }
+inline int f1076_15(int x) { return x * 15; }
+inline int f1076_16(int x) { return x * 16; }
+inline int f1076_17(int x) { return x * 17; }
+inline int f1076_18(int x) { return x * 18; }
+inline int f1076_19(int x) { return x * 19; }
+inline int f1076_20(int x) { return x * 20; }
+inline int f1076_21(int x) { return x * 21; }
+inline int f1076_22(int x) { return x * 22; }
+inline int f1076_23(int x) { return x * 23; }
+inline int f1076_24(int x) { return x * 24; }
+inline int f1076_25(int x) { return x * 25; }
+inline int f1076_26(int x) { return x * 26; }
+inline int f1076_27(int x) { return x * 27; }
+inline int f1076_28(int x) { return x * 28; }
+inline int f1076_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1077 */
+#include <vector>
+#include "h9860.h"
+#include "h6842.h"
+#include "h158.h"
+#include "h3334.h"
+#include "h9674.h"
+#ifdef X
+#include "h4897.h"
+#endif
+struct S1077 { int a; const char *s = "x//y"; };
+inline int f1077_0(int x) { return x * 0; }
+inline int f1077_1(int x) { return x * 1; }
+inline int f1077_2(int x) { return x * 2; }
+inline int f1077_3(int x) { return x * 3; }
+inline int f1077_4(int x) { return x * 4; }
+inline int f1077_5(int x) { return x * 5; }
+inline int f1077_6(int x) { return x * 6; }
+inline int f1077_7(int x) { return x * 7; }
+inline int f1077_8(int x) { return x * 8; }
+inline int f1077_9(int x) { return x * 9; }
+inline int f1077_10(int x) { return x * 10; }
+inline int f1077_11(int x) { return x * 11; }
+inline int f1077_12(int x) { return x * 12; }
+inline int f1077_13(int x) { return x * 13; }
+inline int f1077_14(int x) { return x * 14; }
+inline int f1077_15(int x) { return x * 15; }
+inline int f1077_16(int x) { return x * 16; }
+inline int f1077_17(int x) { return x * 17; }
+inline int f1077_18(int x) { return x * 18; }
+inline int f1077_19(int x) { return x * 19; }
+inline int f1077_20(int x) { return x * 20; }
+inline int f1077_21(int x) { return x * 21; }
+inline int f1077_22(int x) { return x * 22; }
+inline int f1077_23(int x) { return x * 23; }
+inline int f1077_24(int x) { return x * 24; }
+inline int f1077_25(int x) { return x * 25; }
+inline int f1077_26(int x) { return x * 26; }
+inline int f1077_27(int x) { return x * 27; }
+inline int f1077_28(int x) { return x * 28; }
+inline int f1077_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1078 */
+#include <vector>
+#include "h7475.h"
+#include "h827.h"
+#include "h1570.h"
+#include "h3626.h"
+#include "h5545.h"
+#ifdef X
+#include "h6958.h"
+#endif
+struct S1078 { int a; const char *s = "x//y"; };
+inline int f1078_0(int x) { return x * 0; }
+inline int f1078_1(int x) { return x * 1; }
+inline int f1078_2(int x) { return x * 2; }
+inline int f1078_3(int x) { return x * 3; }
+inline int f1078_4(int x) { return x * 4; }
+inline int f1078_5(int x) { return x * 5; }
+inline int f1078_6(int x) { return x * 6; }
+inline int f1078_7(int x) { return x * 7; }
+inline int f1078_8(int x) { return x * 8; }
+inline int f1078_9(int x) { return x * 9; }
+inline int f1078_10(int x) { return x * 10; }
+inline int f1078_11(int x) { return x * 11; }
+inline int f1078_12(int x) { return x * 12; }
+inline int f1078_13(int x) { return x * 13; }
+inline int f1078_14(int x) { return x * 14; }
+inline int f1078_15(int x) { return x * 15; }
+inline int f1078_16(int x) { return x * 16; }
+inline int f1078_17(int x) { return x * 17; }
+inline int f1078_18(int x) { return x * 18; }
+inline int f1078_19(int x) { return x * 19; }
+inline int f1078_20(int x) { return x * 20; }
+inline int f1078_21(int x) { return x * 21; }
+inline int f1078_22(int x) { return x * 22; }
+inline int f1078_23(int x) { return x * 23; }
+inline int f1078_24(int x) { return x * 24; }
+inline int f1078_25(int x) { return x * 25; }
+inline int f1078_26(int x) { return x * 26; }
+inline int f1078_27(int x) { return x * 27; }
+inline int f1078_28(int x) { return x * 28; }
+inline int f1078_29(int x) { return x * 29; }
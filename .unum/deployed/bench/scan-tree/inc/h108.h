@@ -0,0 +1,42 @@
+#pragma once
+/* header 108 */
+#include <vector>
+#include "h6763.h"
+#include "h1892.h"
+#include "h8360.h"
+#include "h7046.h"
+#include "h6061.h"
+#ifdef X
+#include "h2025.h"
+#endif
+struct S108 { int a; const char *s = "x//y"; };
+inline int f108_0(int x) { return x * 0; }
+inline int f108_1(int x) { return x * 1; }
+inline int f108_2(int x) { return x * 2; }
+inline int f108_3(int x) { return x * 3; }
+inline int f108_4(int x) { return x * 4; }
+inline int f108_5(int x) { return x * 5; }
+inline int f108_6(int x) { return x * 6; }
+inline int f108_7(int x) { return x * 7; }
+inline int f108_8(int x) { return x * 8; }
+inline int f108_9(int x) { return x * 9; }
+inline int f108_10(int x) { return x * 10; }
+inline int f108_11(int x) { return x * 11; }
+inline int f108_12(int x) { return x * 12; }
+inline int f108_13(int x) { return x * 13; }
+inline int f108_14(int x) { return x * 14; }
+inline int f108_15(int x) { return x * 15; }
+inline int f108_16(int x) { return x * 16; }
+inline int f108_17(int x) { return x * 17; }
+inline int f108_18(int x) { return x * 18; }
+inline int f108_19(int x) { return x * 19; }
+inline int f108_20(int x) { return x * 20; }
+inline int f108_21(int x) { return x * 21; }
+inline int f108_22(int x) { return x * 22; }
+inline int f108_23(int x) { return x * 23; }
+inline int f108_24(int x) { return x * 24; }
+inline int f108_25(int x) { return x * 25; }
+inline int f108_26(int x) { return x * 26; }
+inline int f108_27(int x) { return x * 27; }
+inline int f108_28(int x) { return x * 28; }
+inline int f108_29(int x) { return x * 29; }
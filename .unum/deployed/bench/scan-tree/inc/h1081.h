@@ -0,0 +1,42 @@
+#pragma once
+/* header 1081 */
+#include <vector>
+#include "h6862.h"
+#include "h5408.h"
+#include "h9928.h"
+#include "h8642.h"
+#include "h1186.h"
+#ifdef X
+#include "h9037.h"
+#endif
+struct S1081 { int a; const char *s = "x//y"; };
+inline int f1081_0(int x) { return x * 0; }
+inline int f1081_1(int x) { return x * 1; }
+inline int f1081_2(int x) { return x * 2; }
+inline int f1081_3(int x) { return x * 3; }
+inline int f1081_4(int x) { return x * 4; }
+inline int f1081_5(int x) { return x * 5; }
+inline int f1081_6(int x) { return x * 6; }
+inline int f1081_7(int x) { return x * 7; }
+inline int f1081_8(int x) { return x * 8; }
+inline int f1081_9(int x) { return x * 9; }
+inline int f1081_10(int x) { return x * 10; }
+inline int f1081_11(int x) { return x * 11; }
+inline int f1081_12(int x) { return x * 12; }
+inline int f1081_13(int x) { return x * 13; }
+inline int f1081_14(int x) { return x * 14; }
+inline int f1081_15(int x) { return x * 15; }
+inline int f1081_16(int x) { return x * 16; }
+inline int f1081_17(int x) { return x * 17; }
+inline int f1081_18(int x) { return x * 18; }
+inline int f1081_19(int x) { return x * 19; }
+inline int f1081_20(int x) { return x * 20; }
+inline int f1081_21(int x) { return x * 21; }
+inline int f1081_22(int x) { return x * 22; }
+inline int f1081_23(int x) { return x * 23; }
+inline int f1081_24(int x) { return x * 24; }
+inline int f1081_25(int x) { return x * 25; }
+inline int f1081_26(int x) { return x * 26; }
+inline int f1081_27(int x) { return x * 27; }
+inline int f1081_28(int x) { return x * 28; }
+inline int f1081_29(int x) { return x * 29; }
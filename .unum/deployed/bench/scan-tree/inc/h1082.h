@@ -0,0 +1,42 @@
+#pragma once
+/* header 1082 */
+#include <vector>
+#include "h6993.h"
+#include "h7784.h"
+#include "h9968.h"
+#include "h8321.h"
+#include "h4571.h"
+#ifdef X
+#include "h9613.h"
+#endif
+struct S1082 { int a; const char *s = "x//y"; };
+inline int f1082_0(int x) { return x * 0; }
+inline int f1082_1(int x) { return x * 1; }
+inline int f1082_2(int x) { return x * 2; }
+inline int f1082_3(int x) { return x * 3; }
+inline int f1082_4(int x) { return x * 4; }
+inline int f1082_5(int x) { return x * 5; }
+inline int f1082_6(int x) { return x * 6; }
+inline int f1082_7(int x) { return x * 7; }
+inline int f1082_8(int x) { return x * 8; }
+inline int f1082_9(int x) { return x * 9; }
+inline int f1082_10(int x) { return x * 10; }
+inline int f1082_11(int x) { return x * 11; }
+inline int f1082_12(int x) { return x * 12; }
+inline int f1082_13(int x) { return x * 13; }
+inline int f1082_14(int x) { return x * 14; }
+inline int f1082_15(int x) { return x * 15; }
+inline int f1082_16(int x) { return x * 16; }
+inline int f1082_17(int x) { return x * 17; }
+inline int f1082_18(int x) { return x * 18; }
+inline int f1082_19(int x) { return x * 19; }
+inline int f1082_20(int x) { return x * 20; }
+inline int f1082_21(int x) { return x * 21; }
+inline int f1082_22(int x) { return x * 22; }
+inline int f1082_23(int x) { return x * 23; }
+inline int f1082_24(int x) { return x * 24; }
+inline int f1082_25(int x) { return x * 25; }
+inline int f1082_26(int x) { return x * 26; }
+inline int f1082_27(int x) { return x * 27; }
+inline int f1082_28(int x) { return x * 28; }
+inline int f1082_29(int x) { return x * 29; }
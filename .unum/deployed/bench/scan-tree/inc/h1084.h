@@ -0,0 +1,42 @@
+#pragma once
+/* header 1084 */
+#include <vector>
+#include "h9964.h"
+#include "h8602.h"
+#include "h6690.h"
+#include "h2088.h"
+#include "h3768.h"
+#ifdef X
+#include "h9428.h"
+#endif
+struct S1084 { int a; const char *s = "x//y"; };
+inline int f1084_0(int x) { return x * 0; }
+inline int f1084_1(int x) { return x * 1; }
+inline int f1084_2(int x) { return x * 2; }
+inline int f1084_3(int x) { return x * 3; }
+inline int f1084_4(int x) { return x * 4; }
+inline int f1084_5(int x) { return x * 5; }
+inline int f1084_6(int x) { return x * 6; }
+inline int f1084_7(int x) { return x * 7; }
+inline int f1084_8(int x) { return x * 8; }
+inline int f1084_9(int x) { return x * 9; }
+inline int f1084_10(int x) { return x * 10; }
+inline int f1084_11(int x) { return x * 11; }
+inline int f1084_12(int x) { return x * 12; }
+inline int f1084_13(int x) { return x * 13; }
+inline int f1084_14(int x) { return x * 14; }
+inline int f1084_15(int x) { return x * 15; }
+inline int f1084_16(int x) { return x * 16; }
+inline int f1084_17(int x) { return x * 17; }
+inline int f1084_18(int x) { return x * 18; }
+inline int f1084_19(int x) { return x * 19; }
+inline int f1084_20(int x) { return x * 20; }
+inline int f1084_21(int x) { return x * 21; }
+inline int f1084_22(int x) { return x * 22; }
+inline int f1084_23(int x) { return x * 23; }
+inline int f1084_24(int x) { return x * 24; }
+inline int f1084_25(int x) { return x * 25; }
+inline int f1084_26(int x) { return x * 26; }
+inline int f1084_27(int x) { return x * 27; }
+inline int f1084_28(int x) { return x * 28; }
+inline int f1084_29(int x) { return x * 29; }
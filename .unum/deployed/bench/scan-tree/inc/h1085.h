@@ -0,0 +1,42 @@
+#pragma once
+/* header 1085 */
+#include <vector>
+#include "h758.h"
+#include "h3978.h"
+#include "h3275.h"
+#include "h2038.h"
+#include "h5163.h"
+#ifdef X
+#include "h9180.h"
+#endif
+struct S1085 { int a; const char *s = "x//y"; };
+inline int f1085_0(int x) { return x * 0; }
+inline int f1085_1(int x) { return x * 1; }
+inline int f1085_2(int x) { return x * 2; }
+inline int f1085_3(int x) { return x * 3; }
+inline int f1085_4(int x) { return x * 4; }
+inline int f1085_5(int x) { return x * 5; }
+inline int f1085_6(int x) { return x * 6; }
+inline int f1085_7(int x) { return x * 7; }
+inline int f1085_8(int x) { return x * 8; }
+inline int f1085_9(int x) { return x * 9; }
+inline int f1085_10(int x) { return x * 10; }
+inline int f1085_11(int x) { return x * 11; }
+inline int f1085_12(int x) { return x * 12; }
+inline int f1085_13(int x) { return x * 13; }
+inline int f1085_14(int x) { return x * 14; }
+inline int f1085_15(int x) { return x * 15; }
+inline int f1085_16(int x) { return x * 16; }
+inline int f1085_17(int x) { return x * 17; }
+inline int f1085_18(int x) { return x * 18; }
+inline int f1085_19(int x) { return x * 19; }
+inline int f1085_20(int x) { return x * 20; }
+inline int f1085_21(int x) { return x * 21; }
+inline int f1085_22(int x) { return x * 22; }
+inline int f1085_23(int x) { return x * 23; }
+inline int f1085_24(int x) { return x * 24; }
+inline int f1085_25(int x) { return x * 25; }
+inline int f1085_26(int x) { return x * 26; }
+inline int f1085_27(int x) { return x * 27; }
+inline int f1085_28(int x) { return x * 28; }
+inline int f1085_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1088 */
+#include <vector>
+#include "h6617.h"
+#include "h4872.h"
+#include "h4773.h"
+#include "h486.h"
+#include "h503.h"
+#ifdef X
+#include "h417.h"
+#endif
+struct S1088 { int a; const char *s = "x//y"; };
+inline int f1088_0(int x) { return x * 0; }
+inline int f1088_1(int x) { return x * 1; }
+inline int f1088_2(int x) { return x * 2; }
+inline int f1088_3(int x) { return x * 3; }
+inline int f1088_4(int x) { return x * 4; }
+inline int f1088_5(int x) { return x * 5; }
+inline int f1088_6(int x) { return x * 6; }
+inline int f1088_7(int x) { return x * 7; }
+inline int f1088_8(int x) { return x * 8; }
+inline int f1088_9(int x) { return x * 9; }
+inline int f1088_10(int x) { return x * 10; }
+inline int f1088_11(int x) { return x * 11; }
+inline int f1088_12(int x) { return x * 12; }
+inline int f1088_13(int x) { return x * 13; }
+inline int f1088_14(int x) { return x * 14; }
+inline int f1088_15(int x) { return x * 15; }
+inline int f1088_16(int x) { return x * 16; }
+inline int f1088_17(int x) { return x * 17; }
+inline int f1088_18(int x) { return x * 18; }
+inline int f1088_19(int x) { return x * 19; }
+inline int f1088_20(int x) { return x * 20; }
+inline int f1088_21(int x) { return x * 21; }
+inline int f1088_22(int x) { return x * 22; }
+inline int f1088_23(int x) { return x * 23; }
+inline int f1088_24(int x) { return x * 24; }
+inline int f1088_25(int x) { return x * 25; }
+inline int f1088_26(int x) { return x * 26; }
+inline int f1088_27(int x) { return x * 27; }
+inline int f1088_28(int x) { return x * 28; }
+inline int f1088_29(int x) { return x * 29; }
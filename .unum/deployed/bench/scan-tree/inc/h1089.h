@@ -0,0 +1,42 @@
+#pragma once
+/* header 1089 */
+#include <vector>
+#include "h2856.h"
+#include "h1221.h"
+#include "h5115.h"
+#include "h7815.h"
+#include "h5878.h"
+#ifdef X
+#include "h3783.h"
+#endif
+struct S1089 { int a; const char *s = "x//y"; };
+inline int f1089_0(int x) { return x * 0; }
+inline int f1089_1(int x) { return x * 1; }
+inline int f1089_2(int x) { return x * 2; }
+inline int f1089_3(int x) { return x * 3; }
+inline int f1089_4(int x) { return x * 4; }
+inline int f1089_5(int x) { return x * 5; }
+inline int f1089_6(int x) { return x * 6; }
+inline int f1089_7(int x) { return x * 7; }
+inline int f1089_8(int x) { return x * 8; }
+inline int f1089_9(int x) { return x * 9; }
+inline int f1089_10(int x) { return x * 10; }
+inline int f1089_11(int x) { return x * 11; }
+inline int f1089_12(int x) { return x * 12; }
+inline int f1089_13(int x) { return x * 13; }
+inline int f1089_14(int x) { return x * 14; }
+inline int f1089_15(int x) { return x * 15; }
+inline int f1089_16(int x) { return x * 16; }
+inline int f1089_17(int x) { return x * 17; }
+inline int f1089_18(int x) { return x * 18; }
+inline int f1089_19(int x) { return x * 19; }
+inline int f1089_20(int x) { return x * 20; }
+inline int f1089_21(int x) { return x * 21; }
+inline int f1089_22(int x) { return x * 22; }
+inline int f1089_23(int x) { return x * 23; }
+inline int f1089_24(int x) { return x * 24; }
+inline int f1089_25(int x) { return x * 25; }
+inline int f1089_26(int x) { return x * 26; }
+inline int f1089_27(int x) { return x * 27; }
+inline int f1089_28(int x) { return x * 28; }
+inline int f1089_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 109 */
+#include <vector>
+#include "h2004.h"
+#include "h1567.h"
+#include "h7557.h"
+#include "h2846.h"
+#include "h1085.h"
+#ifdef X
+#include "h5984.h"
+#endif
+struct S109 { int a; const char *s = "x//y"; };
+inline int f109_0(int x) { return x * 0; }
+inline int f109_1(int x) { return x * 1; }
+inline int f109_2(int x) { return x * 2; }
+inline int f109_3(int x) { return x * 3; }
+inline int f109_4(int x) { return x * 4; }
+inline int f109_5(int x) { return x * 5; }
+inline int f109_6(int x) { return x * 6; }
+inline int f109_7(int x) { return x * 7; }
+inline int f109_8(int x) { return x * 8; }
+inline int f109_9(int x) { return x * 9; }
+inline int f109_10(int x) { return x * 10; }
+inline int f109_11(int x) { return x * 11; }
+inline int f109_12(int x) { return x * 12; }
+inline int f109_13(int x) { return x * 13; }
+inline int f109_14(int x) { return x * 14; }
+inline int f109_15(int x) { return x * 15; }
+inline int f109_16(int x) { return x * 16; }
+inline int f109_17(int x) { return x * 17; }
+inline int f109_18(int x) { return x * 18; }
+inline int f109_19(int x) { return x * 19; }
+inline int f109_20(int x) { return x * 20; }
+inline int f109_21(int x) { return x * 21; }
+inline int f109_22(int x) { return x * 22; }
+inline int f109_23(int x) { return x * 23; }
+inline int f109_24(int x) { return x * 24; }
+inline int f109_25(int x) { return x * 25; }
+inline int f109_26(int x) { return x * 26; }
+inline int f109_27(int x) { return x * 27; }
+inline int f109_28(int x) { return x * 28; }
+inline int f109_29(int x) { return x * 29; }
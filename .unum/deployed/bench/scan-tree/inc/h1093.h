@@ -0,0 +1,42 @@
+#pragma once
+/* header 1093 */
+#include <vector>
+#include "h1691.h"
+#include "h7876.h"
+#include "h102.h"
+#include "h7855.h"
+#include "h4374.h"
+#ifdef X
+#include "h5672.h"
+#endif
+struct S1093 { int a; const char *s = "x//y"; };
+inline int f1093_0(int x) { return x * 0; }
+inline int f1093_1(int x) { return x * 1; }
+inline int f1093_2(int x) { return x * 2; }
+inline int f1093_3(int x) { return x * 3; }
+inline int f1093_4(int x) { return x * 4; }
+inline int f1093_5(int x) { return x * 5; }
+inline int f1093_6(int x) { return x * 6; }
+inline int f1093_7(int x) { return x * 7; }
+inline int f1093_8(int x) { return x * 8; }
+inline int f1093_9(int x) { return x * 9; }
+inline int f1093_10(int x) { return x * 10; }
+inline int f1093_11(int x) { return x * 11; }
+inline int f1093_12(int x) { return x * 12; }
+inline int f1093_13(int x) { return x * 13; }
+inline int f1093_14(int x) { return x * 14; }
+inline int f1093_15(int x) { return x * 15; }
+inline int f1093_16(int x) { return x * 16; }
+inline int f1093_17(int x) { return x * 17; }
+inline int f1093_18(int x) { return x * 18; }
+inline int f1093_19(int x) { return x * 19; }
+inline int f1093_20(int x) { return x * 20; }
+inline int f1093_21(int x) { return x * 21; }
+inline int f1093_22(int x) { return x * 22; }
+inline int f1093_23(int x) { return x * 23; }
+inline int f1093_24(int x) { return x * 24; }
+inline int f1093_25(int x) { return x * 25; }
+inline int f1093_26(int x) { return x * 26; }
+inline int f1093_27(int x) { return x * 27; }
+inline int f1093_28(int x) { return x * 28; }
+inline int f1093_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1095 */
+#include <vector>
+#include "h7648.h"
+#include "h5822.h"
+#include "h8559.h"
+#include "h159.h"
+#include "h2172.h"
+#ifdef X
+#include "h1563.h"
+#endif
+struct S1095 { int a; const char *s = "x//y"; };
+inline int f1095_0(int x) { return x * 0; }
+inline int f1095_1(int x) { return x * 1; }
+inline int f1095_2(int x) { return x * 2; }
+inline int f1095_3(int x) { return x * 3; }
+inline int f1095_4(int x) { return x * 4; }
+inline int f1095_5(int x) { return x * 5; }
+inline int f1095_6(int x) { return x * 6; }
+inline int f1095_7(int x) { return x * 7; }
+inline int f1095_8(int x) { return x * 8; }
+inline int f1095_9(int x) { return x * 9; }
+inline int f1095_10(int x) { return x * 10; }
+inline int f1095_11(int x) { return x * 11; }
+inline int f1095_12(int x) { return x * 12; }
+inline int f1095_13(int x) { return x * 13; }
+inline int f1095_14(int x) { return x * 14; }
+inline int f1095_15(int x) { return x * 15; }
+inline int f1095_16(int x) { return x * 16; }
+inline int f1095_17(int x) { return x * 17; }
+inline int f1095_18(int x) { return x * 18; }
+inline int f1095_19(int x) { return x * 19; }
+inline int f1095_20(int x) { return x * 20; }
+inline int f1095_21(int x) { return x * 21; }
+inline int f1095_22(int x) { return x * 22; }
+inline int f1095_23(int x) { return x * 23; }
+inline int f1095_24(int x) { return x * 24; }
+inline int f1095_25(int x) { return x * 25; }
+inline int f1095_26(int x) { return x * 26; }
+inline int f1095_27(int x) { return x * 27; }
+inline int f1095_28(int x) { return x * 28; }
+inline int f1095_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1097 */
+#include <vector>
+#include "h9775.h"
+#include "h5007.h"
+#include "h5694.h"
+#include "h6910.h"
+#include "h4736.h"
+#ifdef X
+#include "h3813.h"
+#endif
+struct S1097 { int a; const char *s = "x//y"; };
+inline int f1097_0(int x) { return x * 0; }
+inline int f1097_1(int x) { return x * 1; }
+inline int f1097_2(int x) { return x * 2; }
+inline int f1097_3(int x) { return x * 3; }
+inline int f1097_4(int x) { return x * 4; }
+inline int f1097_5(int x) { return x * 5; }
+inline int f1097_6(int x) { return x * 6; }
+inline int f1097_7(int x) { return x * 7; }
+inline int f1097_8(int x) { return x * 8; }
+inline int f1097_9(int x) { return x * 9; }
+inline int f1097_10(int x) { return x * 10; }
+inline int f1097_11(int x) { return x * 11; }
+inline int f1097_12(int x) { return x * 12; }
+inline int f1097_13(int x) { return x * 13; }
+inline int f1097_14(int x) { return x * 14; }
+inline int f1097_15(int x) { return x * 15; }
+inline int f1097_16(int x) { return x * 16; }
+inline int f1097_17(int x) { return x * 17; }
+inline int f1097_18(int x) { return x * 18; }
+inline int f1097_19(int x) { return x * 19; }
+inline int f1097_20(int x) { return x * 20; }
+inline int f1097_21(int x) { return x * 21; }
+inline int f1097_22(int x) { return x * 22; }
+inline int f1097_23(int x) { return x * 23; }
+inline int f1097_24(int x) { return x * 24; }
+inline int f1097_25(int x) { return x * 25; }
+inline int f1097_26(int x) { return x * 26; }
+inline int f1097_27(int x) { return x * 27; }
+inline int f1097_28(int x) { return x * 28; }
+inline int f1097_29(int x) { return x * 29; }
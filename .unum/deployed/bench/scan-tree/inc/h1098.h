@@ -0,0 +1,42 @@
+#pragma once
+/* header 1098 */
+#include <vector>
+#include "h9998.h"
+#include "h1395.h"
+#include "h8062.h"
+#include "h6931.h"
+#include "h5963.h"
+#ifdef X
+#include "h7840.h"
+#endif
+struct S1098 { int a; const char *s = "x//y"; };
+inline int f1098_0(int x) { return x * 0; }
+inline int f1098_1(int x) { return x * 1; }
+inline int f1098_2(int x) { return x * 2; }
+inline int f1098_3(int x) { return x * 3; }
+inline int f1098_4(int x) { return x * 4; }
+inline int f1098_5(int x) { return x * 5; }
+inline int f1098_6(int x) { return x * 6; }
+inline int f1098_7(int x) { return x * 7; }
+inline int f1098_8(int x) { return x * 8; }
+inline int f1098_9(int x) { return x * 9; }
+inline int f1098_10(int x) { return x * 10; }
+inline int f1098_11(int x) { return x * 11; }
+inline int f1098_12(int x) { return x * 12; }
+inline int f1098_13(int x) { return x * 13; }
+inline int f1098_14(int x) { return x * 14; }
+inline int f1098_15(int x) { return x * 15; }
+inline int f1098_16(int x) { return x * 16; }
+inline int f1098_17(int x) { return x * 17; }
+inline int f1098_18(int x) { return x * 18; }
+inline int f1098_19(int x) { return x * 19; }
+inline int f1098_20(int x) { return x * 20; }
+inline int f1098_21(int x) { return x * 21; }
+inline int f1098_22(int x) { return x * 22; }
+inline int f1098_23(int x) { return x * 23; }
+inline int f1098_24(int x) { return x * 24; }
+inline int f1098_25(int x) { return x * 25; }
+inline int f1098_26(int x) { return x * 26; }
+inline int f1098_27(int x) { return x * 27; }
+inline int f1098_28(int x) { return x * 28; }
+inline int f1098_29(int x) { return x * 29; }
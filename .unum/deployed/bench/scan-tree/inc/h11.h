@@ -0,0 +1,42 @@
+#pragma once
+/* header 11 */
+#include <vector>
+#include "h9932.h"
+#include "h1897.h"
+#include "h8270.h"
+#include "h8895.h"
+#include "h7864.h"
+#ifdef X
+#include "h8676.h"
+#endif
+struct S11 { int a; const char *s = "x//y"; };
+inline int f11_0(int x) { return x * 0; }
+inline int f11_1(int x) { return x * 1; }
+inline int f11_2(int x) { return x * 2; }
+inline int f11_3(int x) { return x * 3; }
+inline int f11_4(int x) { return x * 4; }
+inline int f11_5(int x) { return x * 5; }
+inline int f11_6(int x) { return x * 6; }
+inline int f11_7(int x) { return x * 7; }
+inline int f11_8(int x) { return x * 8; }
+inline int f11_9(int x) { return x * 9; }
+inline int f11_10(int x) { return x * 10; }
+inline int f11_11(int x) { return x * 11; }
+inline int f11_12(int x) { return x * 12; }
+inline int f11_13(int x) { return x * 13; }
+inline int f11_14(int x) { return x * 14; }
+inline int f11_15(int x) { return x * 15; }
+inline int f11_16(int x) { return x * 16; }
+inline int f11_17(int x) { return x * 17; }
+inline int f11_18(int x) { return x * 18; }
+inline int f11_19(int x) { return x * 19; }
+inline int f11_20(int x) { return x * 20; }
+inline int f11_21(int x) { return x * 21; }
+inline int f11_22(int x) { return x * 22; }
+inline int f11_23(int x) { return x * 23; }
+inline int f11_24(int x) { return x * 24; }
+inline int f11_25(int x) { return x * 25; }
+inline int f11_26(int x) { return x * 26; }
+inline int f11_27(int x) { return x * 27; }
+inline int f11_28(int x) { return x * 28; }
+inline int f11_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1101 */
+#include <vector>
+#include "h2966.h"
+#include "h817.h"
+#include "h4104.h"
+#include "h4571.h"
+#include "h4459.h"
+#ifdef X
+#include "h1184.h"
+#endif
+struct S1101 { int a; const char *s = "x//y"; };
+inline int f1101_0(int x) { return x * 0; }
+inline int f1101_1(int x) { return x * 1; }
+inline int f1101_2(int x) { return x * 2; }
+inline int f1101_3(int x) { return x * 3; }
+inline int f1101_4(int x) { return x * 4; }
+inline int f1101_5(int x) { return x * 5; }
+inline int f1101_6(int x) { return x * 6; }
+inline int f1101_7(int x) { return x * 7; }
+inline int f1101_8(int x) { return x * 8; }
+inline int f1101_9(int x) { return x * 9; }
+inline int f1101_10(int x) { return x * 10; }
+inline int f1101_11(int x) { return x * 11; }
+inline int f1101_12(int x) { return x * 12; }
+inline int f1101_13(int x) { return x * 13; }
+inline int f1101_14(int x) { return x * 14; }
+inline int f1101_15(int x) { return x * 15; }
+inline int f1101_16(int x) { return x * 16; }
+inline int f1101_17(int x) { return x * 17; }
+inline int f1101_18(int x) { return x * 18; }
+inline int f1101_19(int x) { return x * 19; }
+inline int f1101_20(int x) { return x * 20; }
+inline int f1101_21(int x) { return x * 21; }
+inline int f1101_22(int x) { return x * 22; }
+inline int f1101_23(int x) { return x * 23; }
+inline int f1101_24(int x) { return x * 24; }
+inline int f1101_25(int x) { return x * 25; }
+inline int f1101_26(int x) { return x * 26; }
+inline int f1101_27(int x) { return x * 27; }
+inline int f1101_28(int x) { return x * 28; }
+inline int f1101_29(int x) { return x * 29; }
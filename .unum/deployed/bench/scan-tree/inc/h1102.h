@@ -0,0 +1,42 @@
+#pragma once
+/* header 1102 */
+#include <vector>
+#include "h1267.h"
+#include "h658.h"
+#include "h5923.h"
+#include "h967.h"
+#include "h7810.h"
+#ifdef X
+#include "h9274.h"
+#endif
+struct S1102 { int a; const char *s = "x//y"; };
+inline int f1102_0(int x) { return x * 0; }
+inline int f1102_1(int x) { return x * 1; }
+inline int f1102_2(int x) { return x * 2; }
+inline int f1102_3(int x) { return x * 3; }
+inline int f1102_4(int x) { return x * 4; }
+inline int f1102_5(int x) { return x * 5; }
+inline int f1102_6(int x) { return x * 6; }
+inline int f1102_7(int x) { return x * 7; }
+inline int f1102_8(int x) { return x * 8; }
+inline int f1102_9(int x) { return x * 9; }
+inline int f1102_10(int x) { return x * 10; }
+inline int f1102_11(int x) { return x * 11; }
+inline int f1102_12(int x) { return x * 12; }
+inline int f1102_13(int x) { return x * 13; }
+inline int f1102_14(int x) { return x * 14; }
+inline int f1102_15(int x) { return x * 15; }
+inline int f1102_16(int x) { return x * 16; }
+inline int f1102_17(int x) { return x * 17; }
+inline int f1102_18(int x) { return x * 18; }
+inline int f1102_19(int x) { return x * 19; }
+inline int f1102_20(int x) { return x * 20; }
+inline int f1102_21(int x) { return x * 21; }
+inline int f1102_22(int x) { return x * 22; }
+inline int f1102_23(int x) { return x * 23; }
+inline int f1102_24(int x) { return x * 24; }
+inline int f1102_25(int x) { return x * 25; }
+inline int f1102_26(int x) { return x * 26; }
+inline int f1102_27(int x) { return x * 27; }
+inline int f1102_28(int x) { return x * 28; }
+inline int f1102_29(int x) { return x * 29; }
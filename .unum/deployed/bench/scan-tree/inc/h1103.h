@@ -0,0 +1,42 @@
+#pragma once
+/* header 1103 */
+#include <vector>
+#include "h2275.h"
+#include "h1906.h"
+#include "h4931.h"
+#include "h411.h"
+#include "h985.h"
+#ifdef X
+#include "h9936.h"
+#endif
+struct S1103 { int a; const char *s = "x//y"; };
+inline int f1103_0(int x) { return x * 0; }
+inline int f1103_1(int x) { return x * 1; }
+inline int f1103_2(int x) { return x * 2; }
+inline int f1103_3(int x) { return x * 3; }
+inline int f1103_4(int x) { return x * 4; }
+inline int f1103_5(int x) { return x * 5; }
+inline int f1103_6(int x) { return x * 6; }
+inline int f1103_7(int x) { return x * 7; }
+inline int f1103_8(int x) { return x * 8; }
+inline int f1103_9(int x) { return x * 9; }
+inline int f1103_10(int x) { return x * 10; }
+inline int f1103_11(int x) { return x * 11; }
+inline int f1103_12(int x) { return x * 12; }
+inline int f1103_13(int x) { return x * 13; }
+inline int f1103_14(int x) { return x * 14; }
+inline int f1103_15(int x) { return x * 15; }
+inline int f1103_16(int x) { return x * 16; }
+inline int f1103_17(int x) { return x * 17; }
+inline int f1103_18(int x) { return x * 18; }
+inline int f1103_19(int x) { return x * 19; }
+inline int f1103_20(int x) { return x * 20; }
+inline int f1103_21(int x) { return x * 21; }
+inline int f1103_22(int x) { return x * 22; }
+inline int f1103_23(int x) { return x * 23; }
+inline int f1103_24(int x) { return x * 24; }
+inline int f1103_25(int x) { return x * 25; }
+inline int f1103_26(int x) { return x * 26; }
+inline int f1103_27(int x) { return x * 27; }
+inline int f1103_28(int x) { return x * 28; }
+inline int f1103_29(int x) { return x * 29; }
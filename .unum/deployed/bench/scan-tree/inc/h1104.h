@@ -0,0 +1,42 @@
+#pragma once
+/* header 1104 */
+#include <vector>
+#include "h7225.h"
+#include "h9350.h"
+#include "h9268.h"
+#include "h5666.h"
+#include "h7844.h"
+#ifdef X
+#include "h6875.h"
+#endif
+struct S1104 { int a; const char *s = "x//y"; };
+inline int f1104_0(int x) { return x * 0; }
+inline int f1104_1(int x) { return x * 1; }
+inline int f1104_2(int x) { return x * 2; }
+inline int f1104_3(int x) { return x * 3; }
+inline int f1104_4(int x) { return x * 4; }
+inline int f1104_5(int x) { return x * 5; }
+inline int f1104_6(int x) { return x * 6; }
+inline int f1104_7(int x) { return x * 7; }
+inline int f1104_8(int x) { return x * 8; }
+inline int f1104_9(int x) { return x * 9; }
+inline int f1104_10(int x) { return x * 10; }
+inline int f1104_11(int x) { return x * 11; }
+inline int f1104_12(int x) { return x * 12; }
+inline int f1104_13(int x) { return x * 13; }
+inline int f1104_14(int x) { return x * 14; }
+inline int f1104_15(int x) { return x * 15; }
+inline int f1104_16(int x) { return x * 16; }
+inline int f1104_17(int x) { return x * 17; }
+inline int f1104_18(int x) { return x * 18; }
+inline int f1104_19(int x) { return x * 19; }
+inline int f1104_20(int x) { return x * 20; }
+inline int f1104_21(int x) { return x * 21; }
+inline int f1104_22(int x) { return x * 22; }
+inline int f1104_23(int x) { return x * 23; }
+inline int f1104_24(int x) { return x * 24; }
+inline int f1104_25(int x) { return x * 25; }
+inline int f1104_26(int x) { return x * 26; }
+inline int f1104_27(int x) { return x * 27; }
+inline int f1104_28(int x) { return x * 28; }
+inline int f1104_29(int x) { return x * 29; }
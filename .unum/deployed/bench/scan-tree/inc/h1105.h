@@ -0,0 +1,42 @@
+#pragma once
+/* header 1105 */
+#include <vector>
+#include "h4549.h"
+#include "h6763.h"
+#include "h8730.h"
+#include "h7504.h"
+#include "h2535.h"
+#ifdef X
+#include "h4989.h"
+#endif
+struct S1105 { int a; const char *s = "x//y"; };
+inline int f1105_0(int x) { return x * 0; }
+inline int f1105_1(int x) { return x * 1; }
+inline int f1105_2(int x) { return x * 2; }
+inline int f1105_3(int x) { return x * 3; }
+inline int f1105_4(int x) { return x * 4; }
+inline int f1105_5(int x) { return x * 5; }
+inline int f1105_6(int x) { return x * 6; }
+inline int f1105_7(int x) { return x * 7; }
+inline int f1105_8(int x) { return x * 8; }
+inline int f1105_9(int x) { return x * 9; }
+inline int f1105_10(int x) { return x * 10; }
+inline int f1105_11(int x) { return x * 11; }
+inline int f1105_12(int x) { return x * 12; }
+inline int f1105_13(int x) { return x * 13; }
+inline int f1105_14(int x) { return x * 14; }
+inline int f1105_15(int x) { return x * 15; }
+inline int f1105_16(int x) { return x * 16; }
+inline int f1105_17(int x) { return x * 17; }
+inline int f1105_18(int x) { return x * 18; }
+inline int f1105_19(int x) { return x * 19; }
+inline int f1105_20(int x) { return x * 20; }
+inline int f1105_21(int x) { return x * 21; }
+inline int f1105_22(int x) { return x * 22; }
+inline int f1105_23(int x) { return x * 23; }
+inline int f1105_24(int x) { return x * 24; }
+inline int f1105_25(int x) { return x * 25; }
+inline int f1105_26(int x) { return x * 26; }
+inline int f1105_27(int x) { return x * 27; }
+inline int f1105_28(int x) { return x * 28; }
+inline int f1105_29(int x) { return x * 29; }
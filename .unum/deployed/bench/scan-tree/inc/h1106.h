@@ -0,0 +1,42 @@
+#pragma once
+/* header 1106 */
+#include <vector>
+#include "h8764.h"
+#include "h3734.h"
+#include "h5549.h"
+#include "h7597.h"
+#include "h6150.h"
+#ifdef X
+#include "h5598.h"
+#endif
+struct S1106 { int a; const char *s = "x//y"; };
+inline int f1106_0(int x) { return x * 0; }
+inline int f1106_1(int x) { return x * 1; }
+inline int f1106_2(int x) { return x * 2; }
+inline int f1106_3(int x) { return x * 3; }
+inline int f1106_4(int x) { return x * 4; }
+inline int f1106_5(int x) { return x * 5; }
+inline int f1106_6(int x) { return x * 6; }
+inline int f1106_7(int x) { return x * 7; }
+inline int f1106_8(int x) { return x * 8; }
+inline int f1106_9(int x) { return x * 9; }
+inline int f1106_10(int x) { return x * 10; }
+inline int f1106_11(int x) { return x * 11; }
+inline int f1106_12(int x) { return x * 12; }
+inline int f1106_13(int x) { return x * 13; }
+inline int f1106_14(int x) { return x * 14; }
+inline int f1106_15(int x) { return x * 15; }
+inline int f1106_16(int x) { return x * 16; }
+inline int f1106_17(int x) { return x * 17; }
+inline int f1106_18(int x) { return x * 18; }
+inline int f1106_19(int x) { return x * 19; }
+inline int f1106_20(int x) { return x * 20; }
+inline int f1106_21(int x) { return x * 21; }
+inline int f1106_22(int x) { return x * 22; }
+inline int f1106_23(int x) { return x * 23; }
+inline int f1106_24(int x) { return x * 24; }
+inline int f1106_25(int x) { return x * 25; }
+inline int f1106_26(int x) { return x * 26; }
+inline int f1106_27(int x) { return x * 27; }
+inline int f1106_28(int x) { return x * 28; }
+inline int f1106_29(int x) { return x * 29; }
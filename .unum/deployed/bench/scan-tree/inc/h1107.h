@@ -0,0 +1,42 @@
+#pragma once
+/* header 1107 */
+#include <vector>
+#include "h9418.h"
+#include "h8719.h"
+#include "h5854.h"
+#include "h8665.h"
+#include "h1948.h"
+#ifdef X
+#include "h5450.h"
+#endif
+struct S1107 { int a; const char *s = "x//y"; };
+inline int f1107_0(int x) { return x * 0; }
+inline int f1107_1(int x) { return x * 1; }
+inline int f1107_2(int x) { return x * 2; }
+inline int f1107_3(int x) { return x * 3; }
+inline int f1107_4(int x) { return x * 4; }
+inline int f1107_5(int x) { return x * 5; }
+inline int f1107_6(int x) { return x * 6; }
+inline int f1107_7(int x) { return x * 7; }
+inline int f1107_8(int x) { return x * 8; }
+inline int f1107_9(int x) { return x * 9; }
+inline int f1107_10(int x) { return x * 10; }
+inline int f1107_11(int x) { return x * 11; }
+inline int f1107_12(int x) { return x * 12; }
+inline int f1107_13(int x) { return x * 13; }
+inline int f1107_14(int x) { return x * 14; }
+inline int f1107_15(int x) { return x * 15; }
+inline int f1107_16(int x) { return x * 16; }
+inline int f1107_17(int x) { return x * 17; }
+inline int f1107_18(int x) { return x * 18; }
+inline int f1107_19(int x) { return x * 19; }
+inline int f1107_20(int x) { return x * 20; }
+inline int f1107_21(int x) { return x * 21; }
+inline int f1107_22(int x) { return x * 22; }
+inline int f1107_23(int x) { return x * 23; }
+inline int f1107_24(int x) { return x * 24; }
+inline int f1107_25(int x) { return x * 25; }
+inline int f1107_26(int x) { return x * 26; }
+inline int f1107_27(int x) { return x * 27; }
+inline int f1107_28(int x) { return x * 28; }
+inline int f1107_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1108 */
+#include <vector>
+#include "h2653.h"
+#include "h1254.h"
+#include "h1963.h"
+#include "h7287.h"
+#include "h7644.h"
+#ifdef X
+#include "h6797.h"
+#endif
+struct S1108 { int a; const char *s = "x//y"; };
+inline int f1108_0(int x) { return x * 0; }
+inline int f1108_1(int x) { return x * 1; }
+inline int f1108_2(int x) { return x * 2; }
+inline int f1108_3(int x) { return x * 3; }
+inline int f1108_4(int x) { return x * 4; }
+inline int f1108_5(int x) { return x * 5; }
+inline int f1108_6(int x) { return x * 6; }
+inline int f1108_7(int x) { return x * 7; }
+inline int f1108_8(int x) { return x * 8; }
+inline int f1108_9(int x) { return x * 9; }
+inline int f1108_10(int x) { return x * 10; }
+inline int f1108_11(int x) { return x * 11; }
+inline int f1108_12(int x) { return x * 12; }
+inline int f1108_13(int x) { return x * 13; }
+inline int f1108_14(int x) { return x * 14; }
+inline int f1108_15(int x) { return x * 15; }
+inline int f1108_16(int x) { return x * 16; }
+inline int f1108_17(int x) { return x * 17; }
+inline int f1108_18(int x) { return x * 18; }
+inline int f1108_19(int x) { return x * 19; }
+inline int f1108_20(int x) { return x * 20; }
+inline int f1108_21(int x) { return x * 21; }
+inline int f1108_22(int x) { return x * 22; }
+inline int f1108_23(int x) { return x * 23; }
+inline int f1108_24(int x) { return x * 24; }
+inline int f1108_25(int x) { return x * 25; }
+inline int f1108_26(int x) { return x * 26; }
+inline int f1108_27(int x) { return x * 27; }
+inline int f1108_28(int x) { return x * 28; }
+inline int f1108_29(int x) { return x * 29; }
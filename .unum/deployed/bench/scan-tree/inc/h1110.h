@@ -0,0 +1,42 @@
+#pragma once
+/* header 1110 */
+#include <vector>
+#include "h379.h"
+#include "h3384.h"
+#include "h5927.h"
+#include "h2774.h"
+#include "h5071.h"
+#ifdef X
+#include "h4776.h"
+#endif
+struct S1110 { int a; const char *s = "x//y"; };
+inline int f1110_0(int x) { return x * 0; }
+inline int f1110_1(int x) { return x * 1; }
+inline int f1110_2(int x) { return x * 2; }
+inline int f1110_3(int x) { return x * 3; }
+inline int f1110_4(int x) { return x * 4; }
+inline int f1110_5(int x) { return x * 5; }
+inline int f1110_6(int x) { return x * 6; }
+inline int f1110_7(int x) { return x * 7; }
+inline int f1110_8(int x) { return x * 8; }
+inline int f1110_9(int x) { return x * 9; }
+inline int f1110_10(int x) { return x * 10; }
+inline int f1110_11(int x) { return x * 11; }
+inline int f1110_12(int x) { return x * 12; }
+inline int f1110_13(int x) { return x * 13; }
+inline int f1110_14(int x) { return x * 14; }
+inline int f1110_15(int x) { return x * 15; }
+inline int f1110_16(int x) { return x * 16; }
+inline int f1110_17(int x) { return x * 17; }
+inline int f1110_18(int x) { return x * 18; }
+inline int f1110_19(int x) { return x * 19; }
+inline int f1110_20(int x) { return x * 20; }
+inline int f1110_21(int x) { return x * 21; }
+inline int f1110_22(int x) { return x * 22; }
+inline int f1110_23(int x) { return x * 23; }
+inline int f1110_24(int x) { return x * 24; }
+inline int f1110_25(int x) { return x * 25; }
+inline int f1110_26(int x) { return x * 26; }
+inline int f1110_27(int x) { return x * 27; }
+inline int f1110_28(int x) { return x * 28; }
+inline int f1110_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1111 */
+#include <vector>
+#include "h4002.h"
+#include "h6841.h"
+#include "h8614.h"
+#include "h4475.h"
+#include "h1808.h"
+#ifdef X
+#include "h9852.h"
+#endif
+struct S1111 { int a; const char *s = "x//y"; };
+inline int f1111_0(int x) { return x * 0; }
+inline int f1111_1(int x) { return x * 1; }
+inline int f1111_2(int x) { return x * 2; }
+inline int f1111_3(int x) { return x * 3; }
+inline int f1111_4(int x) { return x * 4; }
+inline int f1111_5(int x) { return x * 5; }
+inline int f1111_6(int x) { return x * 6; }
+inline int f1111_7(int x) { return x * 7; }
+inline int f1111_8(int x) { return x * 8; }
+inline int f1111_9(int x) { return x * 9; }
+inline int f1111_10(int x) { return x * 10; }
+inline int f1111_11(int x) { return x * 11; }
+inline int f1111_12(int x) { return x * 12; }
+inline int f1111_13(int x) { return x * 13; }
+inline int f1111_14(int x) { return x * 14; }
+inline int f1111_15(int x) { return x * 15; }
+inline int f1111_16(int x) { return x * 16; }
+inline int f1111_17(int x) { return x * 17; }
+inline int f1111_18(int x) { return x * 18; }
+inline int f1111_19(int x) { return x * 19; }
+inline int f1111_20(int x) { return x * 20; }
+inline int f1111_21(int x) { return x * 21; }
+inline int f1111_22(int x) { return x * 22; }
+inline int f1111_23(int x) { return x * 23; }
+inline int f1111_24(int x) { return x * 24; }
+inline int f1111_25(int x) { return x * 25; }
+inline int f1111_26(int x) { return x * 26; }
+inline int f1111_27(int x) { return x * 27; }
+inline int f1111_28(int x) { return x * 28; }
+inline int f1111_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1112 */
+#include <vector>
+#include "h7568.h"
+#include "h7276.h"
+#include "h2165.h"
+#include "h9060.h"
+#include "h8359.h"
+#ifdef X
+#include "h1131.h"
+#endif
+struct S1112 { int a; const char *s = "x//y"; };
+inline int f1112_0(int x) { return x * 0; }
+inline int f1112_1(int x) { return x * 1; }
+inline int f1112_2(int x) { return x * 2; }
+inline int f1112_3(int x) { return x * 3; }
+inline int f1112_4(int x) { return x * 4; }
+inline int f1112_5(int x) { return x * 5; }
+inline int f1112_6(int x) { return x * 6; }
+inline int f1112_7(int x) { return x * 7; }
+inline int f1112_8(int x) { return x * 8; }
+inline int f1112_9(int x) { return x * 9; }
+inline int f1112_10(int x) { return x * 10; }
+inline int f1112_11(int x) { return x * 11; }
+inline int f1112_12(int x) { return x * 12; }
+inline int f1112_13(int x) { return x * 13; }
+inline int f1112_14(int x) { return x * 14; }
+inline int f1112_15(int x) { return x * 15; }
+inline int f1112_16(int x) { return x * 16; }
+inline int f1112_17(int x) { return x * 17; }
+inline int f1112_18(int x) { return x * 18; }
+inline int f1112_19(int x) { return x * 19; }
+inline int f1112_20(int x) { return x * 20; }
+inline int f1112_21(int x) { return x * 21; }
+inline int f1112_22(int x) { return x * 22; }
+inline int f1112_23(int x) { return x * 23; }
+inline int f1112_24(int x) { return x * 24; }
+inline int f1112_25(int x) { return x * 25; }
+inline int f1112_26(int x) { return x * 26; }
+inline int f1112_27(int x) { return x * 27; }
+inline int f1112_28(int x) { return x * 28; }
+inline int f1112_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1113 */
+#include <vector>
+#include "h8854.h"
+#include "h6162.h"
+#include "h8547.h"
+#include "h2598.h"
+#include "h5518.h"
+#ifdef X
+#include "h6861.h"
+#endif
+struct S1113 { int a; const char *s = "x//y"; };
+inline int f1113_0(int x) { return x * 0; }
+inline int f1113_1(int x) { return x * 1; }
+inline int f1113_2(int x) { return x * 2; }
+inline int f1113_3(int x) { return x * 3; }
+inline int f1113_4(int x) { return x * 4; }
+inline int f1113_5(int x) { return x * 5; }
+inline int f1113_6(int x) { return x * 6; }
+inline int f1113_7(int x) { return x * 7; }
+inline int f1113_8(int x) { return x * 8; }
+inline int f1113_9(int x) { return x * 9; }
+inline int f1113_10(int x) { return x * 10; }
+inline int f1113_11(int x) { return x * 11; }
+inline int f1113_12(int x) { return x * 12; }
+inline int f1113_13(int x) { return x * 13; }
+inline int f1113_14(int x) { return x * 14; }
+inline int f1113_15(int x) { return x * 15; }
+inline int f1113_16(int x) { return x * 16; }
+inline int f1113_17(int x) { return x * 17; }
+inline int f1113_18(int x) { return x * 18; }
+inline int f1113_19(int x) { return x * 19; }
+inline int f1113_20(int x) { return x * 20; }
+inline int f1113_21(int x) { return x * 21; }
+inline int f1113_22(int x) { return x * 22; }
+inline int f1113_23(int x) { return x * 23; }
+inline int f1113_24(int x) { return x * 24; }
+inline int f1113_25(int x) { return x * 25; }
+inline int f1113_26(int x) { return x * 26; }
+inline int f1113_27(int x) { return x * 27; }
+inline int f1113_28(int x) { return x * 28; }
+inline int f1113_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1116 */
+#include <vector>
+#include "h8025.h"
+#include "h1902.h"
+#include "h2921.h"
+#include "h6983.h"
+#include "h6362.h"
+#ifdef X
+#include "h7656.h"
+#endif
+struct S1116 { int a; const char *s = "x//y"; };
+inline int f1116_0(int x) { return x * 0; }
+inline int f1116_1(int x) { return x * 1; }
+inline int f1116_2(int x) { return x * 2; }
+inline int f1116_3(int x) { return x * 3; }
+inline int f1116_4(int x) { return x * 4; }
+inline int f1116_5(int x) { return x * 5; }
+inline int f1116_6(int x) { return x * 6; }
+inline int f1116_7(int x) { return x * 7; }
+inline int f1116_8(int x) { return x * 8; }
+inline int f1116_9(int x) { return x * 9; }
+inline int f1116_10(int x) { return x * 10; }
+inline int f1116_11(int x) { return x * 11; }
+inline int f1116_12(int x) { return x * 12; }
+inline int f1116_13(int x) { return x * 13; }
+inline int f1116_14(int x) { return x * 14; }
+inline int f1116_15(int x) { return x * 15; }
+inline int f1116_16(int x) { return x * 16; }
+inline int f1116_17(int x) { return x * 17; }
+inline int f1116_18(int x) { return x * 18; }
+inline int f1116_19(int x) { return x * 19; }
+inline int f1116_20(int x) { return x * 20; }
+inline int f1116_21(int x) { return x * 21; }
+inline int f1116_22(int x) { return x * 22; }
+inline int f1116_23(int x) { return x * 23; }
+inline int f1116_24(int x) { return x * 24; }
+inline int f1116_25(int x) { return x * 25; }
+inline int f1116_26(int x) { return x * 26; }
+inline int f1116_27(int x) { return x * 27; }
+inline int f1116_28(int x) { return x * 28; }
+inline int f1116_29(int x) { return x * 29; }
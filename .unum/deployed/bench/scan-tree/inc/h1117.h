@@ -0,0 +1,42 @@
+#pragma once
+/* header 1117 */
+#include <vector>
+#include "h8452.h"
+#include "h1414.h"
+#include "h6626.h"
+#include "h7039.h"
+#include "h8321.h"
+#ifdef X
+#include "h1298.h"
+#endif
+struct S1117 { int a; const char *s = "x//y"; };
+inline int f1117_0(int x) { return x * 0; }
+inline int f1117_1(int x) { return x * 1; }
+inline int f1117_2(int x) { return x * 2; }
+inline int f1117_3(int x) { return x * 3; }
+inline int f1117_4(int x) { return x * 4; }
+inline int f1117_5(int x) { return x * 5; }
+inline int f1117_6(int x) { return x * 6; }
+inline int f1117_7(int x) { return x * 7; }
+inline int f1117_8(int x) { return x * 8; }
+inline int f1117_9(int x) { return x * 9; }
+inline int f1117_10(int x) { return x * 10; }
+inline int f1117_11(int x) { return x * 11; }
+inline int f1117_12(int x) { return x * 12; }
+inline int f1117_13(int x) { return x * 13; }
+inline int f1117_14(int x) { return x * 14; }
+inline int f1117_15(int x) { return x * 15; }
+inline int f1117_16(int x) { return x * 16; }
+inline int f1117_17(int x) { return x * 17; }
+inline int f1117_18(int x) { return x * 18; }
+inline int f1117_19(int x) { return x * 19; }
+inline int f1117_20(int x) { return x * 20; }
+inline int f1117_21(int x) { return x * 21; }
+inline int f1117_22(int x) { return x * 22; }
+inline int f1117_23(int x) { return x * 23; }
+inline int f1117_24(int x) { return x * 24; }
+inline int f1117_25(int x) { return x * 25; }
+inline int f1117_26(int x) { return x * 26; }
+inline int f1117_27(int x) { return x * 27; }
+inline int f1117_28(int x) { return x * 28; }
+inline int f1117_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1118 */
+#include <vector>
+#include "h1966.h"
+#include "h6956.h"
+#include "h8876.h"
+#include "h5763.h"
+#include "h7542.h"
+#ifdef X
+#include "h8739.h"
+#endif
+struct S1118 { int a; const char *s = "x//y"; };
+inline int f1118_0(int x) { return x * 0; }
+inline int f1118_1(int x) { return x * 1; }
+inline int f1118_2(int x) { return x * 2; }
+inline int f1118_3(int x) { return x * 3; }
+inline int f1118_4(int x) { return x * 4; }
+inline int f1118_5(int x) { return x * 5; }
+inline int f1118_6(int x) { return x * 6; }
+inline int f1118_7(int x) { return x * 7; }
+inline int f1118_8(int x) { return x * 8; }
+inline int f1118_9(int x) { return x * 9; }
+inline int f1118_10(int x) { return x * 10; }
+inline int f1118_11(int x) { return x * 11; }
+inline int f1118_12(int x) { return x * 12; }
+inline int f1118_13(int x) { return x * 13; }
+inline int f1118_14(int x) { return x * 14; }
+inline int f1118_15(int x) { return x * 15; }
+inline int f1118_16(int x) { return x * 16; }
+inline int f1118_17(int x) { return x * 17; }
+inline int f1118_18(int x) { return x * 18; }
+inline int f1118_19(int x) { return x * 19; }
+inline int f1118_20(int x) { return x * 20; }
+inline int f1118_21(int x) { return x * 21; }
+inline int f1118_22(int x) { return x * 22; }
+inline int f1118_23(int x) { return x * 23; }
+inline int f1118_24(int x) { return x * 24; }
+inline int f1118_25(int x) { return x * 25; }
+inline int f1118_26(int x) { return x * 26; }
+inline int f1118_27(int x) { return x * 27; }
+inline int f1118_28(int x) { return x * 28; }
+inline int f1118_29(int x) { return x * 29; }
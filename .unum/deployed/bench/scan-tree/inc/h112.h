@@ -0,0 +1,42 @@
+#pragma once
+/* header 112 */
+#include <vector>
+#include "h5960.h"
+#include "h6781.h"
+#include "h5553.h"
+#include "h9881.h"
+#include "h8614.h"
+#ifdef X
+#include "h4103.h"
+#endif
+struct S112 { int a; const char *s = "x//y"; };
+inline int f112_0(int x) { return x * 0; }
+inline int f112_1(int x) { return x * 1; }
+inline int f112_2(int x) { return x * 2; }
+inline int f112_3(int x) { return x * 3; }
+inline int f112_4(int x) { return x * 4; }
+inline int f112_5(int x) { return x * 5; }
+inline int f112_6(int x) { return x * 6; }
+inline int f112_7(int x) { return x * 7; }
+inline int f112_8(int x) { return x * 8; }
+inline int f112_9(int x) { return x * 9; }
+inline int f112_10(int x) { return x * 10; }
+inline int f112_11(int x) { return x * 11; }
+inline int f112_12(int x) { return x * 12; }
+inline int f112_13(int x) { return x * 13; }
+inline int f112_14(int x) { return x * 14; }
+inline int f112_15(int x) { return x * 15; }
+inline int f112_16(int x) { return x * 16; }
+inline int f112_17(int x) { return x * 17; }
+inline int f112_18(int x) { return x * 18; }
+inline int f112_19(int x) { return x * 19; }
+inline int f112_20(int x) { return x * 20; }
+inline int f112_21(int x) { return x * 21; }
+inline int f112_22(int x) { return x * 22; }
+inline int f112_23(int x) { return x * 23; }
+inline int f112_24(int x) { return x * 24; }
+inline int f112_25(int x) { return x * 25; }
+inline int f112_26(int x) { return x * 26; }
+inline int f112_27(int x) { return x * 27; }
+inline int f112_28(int x) { return x * 28; }
+inline int f112_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1120 */
+#include <vector>
+#include "h8777.h"
+#include "h1873.h"
+#include "h1959.h"
+#include "h7635.h"
+#include "h1468.h"
+#ifdef X
+#include "h4860.h"
+#endif
+struct S1120 { int a; const char *s = "x//y"; };
+inline int f1120_0(int x) { return x * 0; }
+inline int f1120_1(int x) { return x * 1; }
+inline int f1120_2(int x) { return x * 2; }
+inline int f1120_3(int x) { return x * 3; }
+inline int f1120_4(int x) { return x * 4; }
+inline int f1120_5(int x) { return x * 5; }
+inline int f1120_6(int x) { return x * 6; }
+inline int f1120_7(int x) { return x * 7; }
+inline int f1120_8(int x) { return x * 8; }
+inline int f1120_9(int x) { return x * 9; }
+inline int f1120_10(int x) { return x * 10; }
+inline int f1120_11(int x) { return x * 11; }
+inline int f1120_12(int x) { return x * 12; }
+inline int f1120_13(int x) { return x * 13; }
+inline int f1120_14(int x) { return x * 14; }
+inline int f1120_15(int x) { return x * 15; }
+inline int f1120_16(int x) { return x * 16; }
+inline int f1120_17(int x) { return x * 17; }
+inline int f1120_18(int x) { return x * 18; }
+inline int f1120_19(int x) { return x * 19; }
+inline int f1120_20(int x) { return x * 20; }
+inline int f1120_21(int x) { return x * 21; }
+inline int f1120_22(int x) { return x * 22; }
+inline int f1120_23(int x) { return x * 23; }
+inline int f1120_24(int x) { return x * 24; }
+inline int f1120_25(int x) { return x * 25; }
+inline int f1120_26(int x) { return x * 26; }
+inline int f1120_27(int x) { return x * 27; }
+inline int f1120_28(int x) { return x * 28; }
+inline int f1120_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1123 */
+#include <vector>
+#include "h6142.h"
+#include "h5848.h"
+#include "h9905.h"
+#include "h9115.h"
+#include "h8351.h"
+#ifdef X
+#include "h2847.h"
+#endif
+struct S1123 { int a; const char *s = "x//y"; };
+inline int f1123_0(int x) { return x * 0; }
+inline int f1123_1(int x) { return x * 1; }
+inline int f1123_2(int x) { return x * 2; }
+inline int f1123_3(int x) { return x * 3; }
+inline int f1123_4(int x) { return x * 4; }
+inline int f1123_5(int x) { return x * 5; }
+inline int f1123_6(int x) { return x * 6; }
+inline int f1123_7(int x) { return x * 7; }
+inline int f1123_8(int x) { return x * 8; }
+inline int f1123_9(int x) { return x * 9; }
+inline int f1123_10(int x) { return x * 10; }
+inline int f1123_11(int x) { return x * 11; }
+inline int f1123_12(int x) { return x * 12; }
+inline int f1123_13(int x) { return x * 13; }
+inline int f1123_14(int x) { return x * 14; }
+inline int f1123_15(int x) { return x * 15; }
+inline int f1123_16(int x) { return x * 16; }
+inline int f1123_17(int x) { return x * 17; }
+inline int f1123_18(int x) { return x * 18; }
+inline int f1123_19(int x) { return x * 19; }
+inline int f1123_20(int x) { return x * 20; }
+inline int f1123_21(int x) { return x * 21; }
+inline int f1123_22(int x) { return x * 22; }
+inline int f1123_23(int x) { return x * 23; }
+inline int f1123_24(int x) { return x * 24; }
+inline int f1123_25(int x) { return x * 25; }
+inline int f1123_26(int x) { return x * 26; }
+inline int f1123_27(int x) { return x * 27; }
+inline int f1123_28(int x) { return x * 28; }
+inline int f1123_29(int x) { return x * 29; }
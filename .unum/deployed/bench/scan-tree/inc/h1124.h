@@ -0,0 +1,42 @@
+#pragma once
+/* header 1124 */
+#include <vector>
+#include "h3144.h"
+#include "h9571.h"
+#include "h1665.h"
+#include "h9718.h"
+#include "h8279.h"
+#ifdef X
+#include "h5139.h"
+#endif
+struct S1124 { int a; const char *s = "x//y"; };
+inline int f1124_0(int x) { return x * 0; }
+inline int f1124_1(int x) { return x * 1; }
+inline int f1124_2(int x) { return x * 2; }
+inline int f1124_3(int x) { return x * 3; }
+inline int f1124_4(int x) { return x * 4; }
+inline int f1124_5(int x) { return x * 5; }
+inline int f1124_6(int x) { return x * 6; }
+inline int f1124_7(int x) { return x * 7; }
+inline int f1124_8(int x) { return x * 8; }
+inline int f1124_9(int x) { return x * 9; }
+inline int f1124_10(int x) { return x * 10; }
+inline int f1124_11(int x) { return x * 11; }
+inline int f1124_12(int x) { return x * 12; }
+inline int f1124_13(int x) { return x * 13; }
+inline int f1124_14(int x) { return x * 14; }
+inline int f1124_15(int x) { return x * 15; }
+inline int f1124_16(int x) { return x * 16; }
+inline int f1124_17(int x) { return x * 17; }
+inline int f1124_18(int x) { return x * 18; }
+inline int f1124_19(int x) { return x * 19; }
+inline int f1124_20(int x) { return x * 20; }
+inline int f1124_21(int x) { return x * 21; }
+inline int f1124_22(int x) { return x * 22; }
+inline int f1124_23(int x) { return x * 23; }
+inline int f1124_24(int x) { return x * 24; }
+inline int f1124_25(int x) { return x * 25; }
+inline int f1124_26(int x) { return x * 26; }
+inline int f1124_27(int x) { return x * 27; }
+inline int f1124_28(int x) { return x * 28; }
+inline int f1124_29(int x) { return x * 29; }
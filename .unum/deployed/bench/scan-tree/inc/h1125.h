@@ -0,0 +1,42 @@
+#pragma once
+/* header 1125 */
+#include <vector>
+#include "h1597.h"
+#include "h6075.h"
+#include "h5065.h"
+#include "h8486.h"
+#include "h2461.h"
+#ifdef X
+#include "h3649.h"
+#endif
+struct S1125 { int a; const char *s = "x//y"; };
+inline int f1125_0(int x) { return x * 0; }
+inline int f1125_1(int x) { return x * 1; }
+inline int f1125_2(int x) { return x * 2; }
+inline int f1125_3(int x) { return x * 3; }
+inline int f1125_4(int x) { return x * 4; }
+inline int f1125_5(int x) { return x * 5; }
+inline int f1125_6(int x) { return x * 6; }
+inline int f1125_7(int x) { return x * 7; }
+inline int f1125_8(int x) { return x * 8; }
+inline int f1125_9(int x) { return x * 9; }
+inline int f1125_10(int x) { return x * 10; }
+inline int f1125_11(int x) { return x * 11; }
+inline int f1125_12(int x) { return x * 12; }
+inline int f1125_13(int x) { return x * 13; }
+inline int f1125_14(int x) { return x * 14; }
+inline int f1125_15(int x) { return x * 15; }
+inline int f1125_16(int x) { return x * 16; }
+inline int f1125_17(int x) { return x * 17; }
+inline int f1125_18(int x) { return x * 18; }
+inline int f1125_19(int x) { return x * 19; }
+inline int f1125_20(int x) { return x * 20; }
+inline int f1125_21(int x) { return x * 21; }
+inline int f1125_22(int x) { return x * 22; }
+inline int f1125_23(int x) { return x * 23; }
+inline int f1125_24(int x) { return x * 24; }
+inline int f1125_25(int x) { return x * 25; }
+inline int f1125_26(int x) { return x * 26; }
+inline int f1125_27(int x) { return x * 27; }
+inline int f1125_28(int x) { return x * 28; }
+inline int f1125_29(int x) { return x * 29; }
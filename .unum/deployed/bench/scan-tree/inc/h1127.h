@@ -0,0 +1,42 @@
+#pragma once
+/* header 1127 */
+#include <vector>
+#include "h7816.h"
+#include "h9183.h"
+#include "h1047.h"
+#include "h9030.h"
+#include "h5108.h"
+#ifdef X
+#include "h7298.h"
+#endif
+struct S1127 { int a; const char *s = "x//y"; };
+inline int f1127_0(int x) { return x * 0; }
+inline int f1127_1(int x) { return x * 1; }
+inline int f1127_2(int x) { return x * 2; }
+inline int f1127_3(int x) { return x * 3; }
+inline int f1127_4(int x) { return x * 4; }
+inline int f1127_5(int x) { return x * 5; }
+inline int f1127_6(int x) { return x * 6; }
+inline int f1127_7(int x) { return x * 7; }
+inline int f1127_8(int x) { return x * 8; }
+inline int f1127_9(int x) { return x * 9; }
+inline int f1127_10(int x) { return x * 10; }
+inline int f1127_11(int x) { return x * 11; }
+inline int f1127_12(int x) { return x * 12; }
+inline int f1127_13(int x) { return x * 13; }
+inline int f1127_14(int x) { return x * 14; }
+inline int f1127_15(int x) { return x * 15; }
+inline int f1127_16(int x) { return x * 16; }
+inline int f1127_17(int x) { return x * 17; }
+inline int f1127_18(int x) { return x * 18; }
+inline int f1127_19(int x) { return x * 19; }
+inline int f1127_20(int x) { return x * 20; }
+inline int f1127_21(int x) { return x * 21; }
+inline int f1127_22(int x) { return x * 22; }
+inline int f1127_23(int x) { return x * 23; }
+inline int f1127_24(int x) { return x * 24; }
+inline int f1127_25(int x) { return x * 25; }
+inline int f1127_26(int x) { return x * 26; }
+inline int f1127_27(int x) { return x * 27; }
+inline int f1127_28(int x) { return x * 28; }
+inline int f1127_29(int x) { return x * 29; }
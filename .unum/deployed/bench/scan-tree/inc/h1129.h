@@ -0,0 +1,42 @@
+#pragma once
+/* header 1129 */
+#include <vector>
+#include "h8150.h"
+#include "h6631.h"
+#include "h4739.h"
+#include "h6898.h"
+#include "h2989.h"
+#ifdef X
+#include "h5532.h"
+#endif
+struct S1129 { int a; const char *s = "x//y"; };
+inline int f1129_0(int x) { return x * 0; }
+inline int f1129_1(int x) { return x * 1; }
+inline int f1129_2(int x) { return x * 2; }
+inline int f1129_3(int x) { return x * 3; }
+inline int f1129_4(int x) { return x * 4; }
+inline int f1129_5(int x) { return x * 5; }
+inline int f1129_6(int x) { return x * 6; }
+inline int f1129_7(int x) { return x * 7; }
+inline int f1129_8(int x) { return x * 8; }
+inline int f1129_9(int x) { return x * 9; }
+inline int f1129_10(int x) { return x * 10; }
+inline int f1129_11(int x) { return x * 11; }
+inline int f1129_12(int x) { return x * 12; }
+inline int f1129_13(int x) { return x * 13; }
+inline int f1129_14(int x) { return x * 14; }
+inline int f1129_15(int x) { return x * 15; }
+inline int f1129_16(int x) { return x * 16; }
+inline int f1129_17(int x) { return x * 17; }
+inline int f1129_18(int x) { return x * 18; }
+inline int f1129_19(int x) { return x * 19; }
+inline int f1129_20(int x) { return x * 20; }
+inline int f1129_21(int x) { return x * 21; }
+inline int f1129_22(int x) { return x * 22; }
+inline int f1129_23(int x) { return x * 23; }
+inline int f1129_24(int x) { return x * 24; }
+inline int f1129_25(int x) { return x * 25; }
+inline int f1129_26(int x) { return x * 26; }
+inline int f1129_27(int x) { return x * 27; }
+inline int f1129_28(int x) { return x * 28; }
+inline int f1129_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 113 */
+#include <vector>
+#include "h5774.h"
+#include "h8140.h"
+#include "h4484.h"
+#include "h9241.h"
+#include "h9592.h"
+#ifdef X
+#include "h7139.h"
+#endif
+struct S113 { int a; const char *s = "x//y"; };
+inline int f113_0(int x) { return x * 0; }
+inline int f113_1(int x) { return x * 1; }
+inline int f113_2(int x) { return x * 2; }
+inline int f113_3(int x) { return x * 3; }
+inline int f113_4(int x) { return x * 4; }
+inline int f113_5(int x) { return x * 5; }
+inline int f113_6(int x) { return x * 6; }
+inline int f113_7(int x) { return x * 7; }
+inline int f113_8(int x) { return x * 8; }
+inline int f113_9(int x) { return x * 9; }
+inline int f113_10(int x) { return x * 10; }
+inline int f113_11(int x) { return x * 11; }
+inline int f113_12(int x) { return x * 12; }
+inline int f113_13(int x) { return x * 13; }
+inline int f113_14(int x) { return x * 14; }
+inline int f113_15(int x) { return x * 15; }
+inline int f113_16(int x) { return x * 16; }
+inline int f113_17(int x) { return x * 17; }
+inline int f113_18(int x) { return x * 18; }
+inline int f113_19(int x) { return x * 19; }
+inline int f113_20(int x) { return x * 20; }
+inline int f113_21(int x) { return x * 21; }
+inline int f113_22(int x) { return x * 22; }
+inline int f113_23(int x) { return x * 23; }
+inline int f113_24(int x) { return x * 24; }
+inline int f113_25(int x) { return x * 25; }
+inline int f113_26(int x) { return x * 26; }
+inline int f113_27(int x) { return x * 27; }
+inline int f113_28(int x) { return x * 28; }
+inline int f113_29(int x) { return x * 29; }
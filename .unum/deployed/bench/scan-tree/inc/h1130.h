@@ -0,0 +1,42 @@
+#pragma once
+/* header 1130 */
+#include <vector>
+#include "h92.h"
+#include "h5378.h"
+#include "h5024.h"
+#include "h8449.h"
+#include "h7921.h"
+#ifdef X
+#include "h5376.h"
+#endif
+struct S1130 { int a; const char *s = "x//y"; };
+inline int f1130_0(int x) { return x * 0; }
+inline int f1130_1(int x) { return x * 1; }
+inline int f1130_2(int x) { return x * 2; }
+inline int f1130_3(int x) { return x * 3; }
+inline int f1130_4(int x) { return x * 4; }
+inline int f1130_5(int x) { return x * 5; }
+inline int f1130_6(int x) { return x * 6; }
+inline int f1130_7(int x) { return x * 7; }
+inline int f1130_8(int x) { return x * 8; }
+inline int f1130_9(int x) { return x * 9; }
+inline int f1130_10(int x) { return x * 10; }
+inline int f1130_11(int x) { return x * 11; }
+inline int f1130_12(int x) { return x * 12; }
+inline int f1130_13(int x) { return x * 13; }
+inline int f1130_14(int x) { return x * 14; }
+inline int f1130_15(int x) { return x * 15; }
+inline int f1130_16(int x) { return x * 16; }
+inline int f1130_17(int x) { return x * 17; }
+inline int f1130_18(int x) { return x * 18; }
+inline int f1130_19(int x) { return x * 19; }
+inline int f1130_20(int x) { return x * 20; }
+inline int f1130_21(int x) { return x * 21; }
+inline int f1130_22(int x) { return x * 22; }
+inline int f1130_23(int x) { return x * 23; }
+inline int f1130_24(int x) { return x * 24; }
+inline int f1130_25(int x) { return x * 25; }
+inline int f1130_26(int x) { return x * 26; }
+inline int f1130_27(int x) { return x * 27; }
+inline int f1130_28(int x) { return x * 28; }
+inline int f1130_29(int x) { return x * 29; }
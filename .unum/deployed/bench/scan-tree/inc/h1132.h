@@ -0,0 +1,42 @@
+#pragma once
+/* header 1132 */
+#include <vector>
+#include "h8740.h"
+#include "h1107.h"
+#include "h1396.h"
+#include "h8838.h"
+#include "h7704.h"
+#ifdef X
+#include "h3239.h"
+#endif
+struct S1132 { int a; const char *s = "x//y"; };
+inline int f1132_0(int x) { return x * 0; }
+inline int f1132_1(int x) { return x * 1; }
+inline int f1132_2(int x) { return x * 2; }
+inline int f1132_3(int x) { return x * 3; }
+inline int f1132_4(int x) { return x * 4; }
+inline int f1132_5(int x) { return x * 5; }
+inline int f1132_6(int x) { return x * 6; }
+inline int f1132_7(int x) { return x * 7; }
+inline int f1132_8(int x) { return x * 8; }
+inline int f1132_9(int x) { return x * 9; }
+inline int f1132_10(int x) { return x * 10; }
+inline int f1132_11(int x) { return x * 11; }
+inline int f1132_12(int x) { return x * 12; }
+inline int f1132_13(int x) { return x * 13; }
+inline int f1132_14(int x) { return x * 14; }
+inline int f1132_15(int x) { return x * 15; }
+inline int f1132_16(int x) { return x * 16; }
+inline int f1132_17(int x) { return x * 17; }
+inline int f1132_18(int x) { return x * 18; }
+inline int f1132_19(int x) { return x * 19; }
+inline int f1132_20(int x) { return x * 20; }
+inline int f1132_21(int x) { return x * 21; }
+inline int f1132_22(int x) { return x * 22; }
+inline int f1132_23(int x) { return x * 23; }
+inline int f1132_24(int x) { return x * 24; }
+inline int f1132_25(int x) { return x * 25; }
+inline int f1132_26(int x) { return x * 26; }
+inline int f1132_27(int x) { return x * 27; }
+inline int f1132_28(int x) { return x * 28; }
+inline int f1132_29(int x) { return x * 29; }
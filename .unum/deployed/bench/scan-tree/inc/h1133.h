@@ -0,0 +1,42 @@
+#pragma once
+/* header 1133 */
+#include <vector>
+#include "h9067.h"
+#include "h6671.h"
+#include "h3043.h"
+#include "h3340.h"
+#include "h8756.h"
+#ifdef X
+#include "h3522.h"
+#endif
+struct S1133 { int a; const char *s = "x//y"; };
+inline int f1133_0(int x) { return x * 0; }
+inline int f1133_1(int x) { return x * 1; }
+inline int f1133_2(int x) { return x * 2; }
+inline int f1133_3(int x) { return x * 3; }
+inline int f1133_4(int x) { return x * 4; }
+inline int f1133_5(int x) { return x * 5; }
+inline int f1133_6(int x) { return x * 6; }
+inline int f1133_7(int x) { return x * 7; }
+inline int f1133_8(int x) { return x * 8; }
+inline int f1133_9(int x) { return x * 9; }
+inline int f1133_10(int x) { return x * 10; }
+inline int f1133_11(int x) { return x * 11; }
+inline int f1133_12(int x) { return x * 12; }
+inline int f1133_13(int x) { return x * 13; }
+inline int f1133_14(int x) { return x * 14; }
+inline int f1133_15(int x) { return x * 15; }
+inline int f1133_16(int x) { return x * 16; }
+inline int f1133_17(int x) { return x * 17; }
+inline int f1133_18(int x) { return x * 18; }
+inline int f1133_19(int x) { return x * 19; }
+inline int f1133_20(int x) { return x * 20; }
+inline int f1133_21(int x) { return x * 21; }
+inline int f1133_22(int x) { return x * 22; }
+inline int f1133_23(int x) { return x * 23; }
+inline int f1133_24(int x) { return x * 24; }
+inline int f1133_25(int x) { return x * 25; }
+inline int f1133_26(int x) { return x * 26; }
+inline int f1133_27(int x) { return x * 27; }
+inline int f1133_28(int x) { return x * 28; }
+inline int f1133_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1134 */
+#include <vector>
+#include "h536.h"
+#include "h7783.h"
+#include "h1611.h"
+#include "h7004.h"
+#include "h4189.h"
+#ifdef X
+#include "h556.h"
+#endif
+struct S1134 { int a; const char *s = "x//y"; };
+inline int f1134_0(int x) { return x * 0; }
+inline int f1134_1(int x) { return x * 1; }
+inline int f1134_2(int x) { return x * 2; }
+inline int f1134_3(int x) { return x * 3; }
+inline int f1134_4(int x) { return x * 4; }
+inline int f1134_5(int x) { return x * 5; }
+inline int f1134_6(int x) { return x * 6; }
+inline int f1134_7(int x) { return x * 7; }
+inline int f1134_8(int x) { return x * 8; }
+inline int f1134_9(int x) { return x * 9; }
+inline int f1134_10(int x) { return x * 10; }
+inline int f1134_11(int x) { return x * 11; }
+inline int f1134_12(int x) { return x * 12; }
+inline int f1134_13(int x) { return x * 13; }
+inline int f1134_14(int x) { return x * 14; }
+inline int f1134_15(int x) { return x * 15; }
+inline int f1134_16(int x) { return x * 16; }
+inline int f1134_17(int x) { return x * 17; }
+inline int f1134_18(int x) { return x * 18; }
+inline int f1134_19(int x) { return x * 19; }
+inline int f1134_20(int x) { return x * 20; }
+inline int f1134_21(int x) { return x * 21; }
+inline int f1134_22(int x) { return x * 22; }
+inline int f1134_23(int x) { return x * 23; }
+inline int f1134_24(int x) { return x * 24; }
+inline int f1134_25(int x) { return x * 25; }
+inline int f1134_26(int x) { return x * 26; }
+inline int f1134_27(int x) { return x * 27; }
+inline int f1134_28(int x) { return x * 28; }
+inline int f1134_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1135 */
+#include <vector>
+#include "h7879.h"
+#include "h6238.h"
+#include "h3631.h"
+#include "h1379.h"
+#include "h759.h"
+#ifdef X
+#include "h2851.h"
+#endif
+struct S1135 { int a; const char *s = "x//y"; };
+inline int f1135_0(int x) { return x * 0; }
+inline int f1135_1(int x) { return x * 1; }
+inline int f1135_2(int x) { return x * 2; }
+inline int f1135_3(int x) { return x * 3; }
+inline int f1135_4(int x) { return x * 4; }
+inline int f1135_5(int x) { return x * 5; }
+inline int f1135_6(int x) { return x * 6; }
+inline int f1135_7(int x) { return x * 7; }
+inline int f1135_8(int x) { return x * 8; }
+inline int f1135_9(int x) { return x * 9; }
+inline int f1135_10(int x) { return x * 10; }
+inline int f1135_11(int x) { return x * 11; }
+inline int f1135_12(int x) { return x * 12; }
+inline int f1135_13(int x) { return x * 13; }
+inline int f1135_14(int x) { return x * 14; }
+inline int f1135_15(int x) { return x * 15; }
+inline int f1135_16(int x) { return x * 16; }
+inline int f1135_17(int x) { return x * 17; }
+inline int f1135_18(int x) { return x * 18; }
+inline int f1135_19(int x) { return x * 19; }
+inline int f1135_20(int x) { return x * 20; }
+inline int f1135_21(int x) { return x * 21; }
+inline int f1135_22(int x) { return x * 22; }
+inline int f1135_23(int x) { return x * 23; }
+inline int f1135_24(int x) { return x * 24; }
+inline int f1135_25(int x) { return x * 25; }
+inline int f1135_26(int x) { return x * 26; }
+inline int f1135_27(int x) { return x * 27; }
+inline int f1135_28(int x) { return x * 28; }
+inline int f1135_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1137 */
+#include <vector>
+#include "h289.h"
+#include "h5404.h"
+#include "h4107.h"
+#include "h8425.h"
+#include "h1699.h"
+#ifdef X
+#include "h3323.h"
+#endif
+struct S1137 { int a; const char *s = "x//y"; };
+inline int f1137_0(int x) { return x * 0; }
+inline int f1137_1(int x) { return x * 1; }
+inline int f1137_2(int x) { return x * 2; }
+inline int f1137_3(int x) { return x * 3; }
+inline int f1137_4(int x) { return x * 4; }
+inline int f1137_5(int x) { return x * 5; }
+inline int f1137_6(int x) { return x * 6; }
+inline int f1137_7(int x) { return x * 7; }
+inline int f1137_8(int x) { return x * 8; }
+inline int f1137_9(int x) { return x * 9; }
+inline int f1137_10(int x) { return x * 10; }
+inline int f1137_11(int x) { return x * 11; }
+inline int f1137_12(int x) { return x * 12; }
+inline int f1137_13(int x) { return x * 13; }
+inline int f1137_14(int x) { return x * 14; }
+inline int f1137_15(int x) { return x * 15; }
+inline int f1137_16(int x) { return x * 16; }
+inline int f1137_17(int x) { return x * 17; }
+inline int f1137_18(int x) { return x * 18; }
+inline int f1137_19(int x) { return x * 19; }
+inline int f1137_20(int x) { return x * 20; }
+inline int f1137_21(int x) { return x * 21; }
+inline int f1137_22(int x) { return x * 22; }
+inline int f1137_23(int x) { return x * 23; }
+inline int f1137_24(int x) { return x * 24; }
+inline int f1137_25(int x) { return x * 25; }
+inline int f1137_26(int x) { return x * 26; }
+inline int f1137_27(int x) { return x * 27; }
+inline int f1137_28(int x) { return x * 28; }
+inline int f1137_29(int x) { return x * 29; }
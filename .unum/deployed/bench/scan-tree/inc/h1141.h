@@ -0,0 +1,42 @@
+#pragma once
+/* header 1141 */
+#include <vector>
+#include "h1906.h"
+#include "h3755.h"
+#include "h7625.h"
+#include "h225.h"
+#include "h6010.h"
+#ifdef X
+#include "h7494.h"
+#endif
+struct S1141 { int a; const char *s = "x//y"; };
+inline int f1141_0(int x) { return x * 0; }
+inline int f1141_1(int x) { return x * 1; }
+inline int f1141_2(int x) { return x * 2; }
+inline int f1141_3(int x) { return x * 3; }
+inline int f1141_4(int x) { return x * 4; }
+inline int f1141_5(int x) { return x * 5; }
+inline int f1141_6(int x) { return x * 6; }
+inline int f1141_7(int x) { return x * 7; }
+inline int f1141_8(int x) { return x * 8; }
+inline int f1141_9(int x) { return x * 9; }
+inline int f1141_10(int x) { return x * 10; }
+inline int f1141_11(int x) { return x * 11; }
+inline int f1141_12(int x) { return x * 12; }
+inline int f1141_13(int x) { return x * 13; }
+inline int f1141_14(int x) { return x * 14; }
+inline int f1141_15(int x) { return x * 15; }
+inline int f1141_16(int x) { return x * 16; }
+inline int f1141_17(int x) { return x * 17; }
+inline int f1141_18(int x) { return x * 18; }
+inline int f1141_19(int x) { return x * 19; }
+inline int f1141_20(int x) { return x * 20; }
+inline int f1141_21(int x) { return x * 21; }
+inline int f1141_22(int x) { return x * 22; }
+inline int f1141_23(int x) { return x * 23; }
+inline int f1141_24(int x) { return x * 24; }
+inline int f1141_25(int x) { return x * 25; }
+inline int f1141_26(int x) { return x * 26; }
+inline int f1141_27(int x) { return x * 27; }
+inline int f1141_28(int x) { return x * 28; }
+inline int f1141_29(int x) { return x * 29; }
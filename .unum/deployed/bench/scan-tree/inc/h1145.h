@@ -0,0 +1,42 @@
+#pragma once
+/* header 1145 */
+#include <vector>
+#include "h6487.h"
+#include "h1458.h"
+#include "h1116.h"
+#include "h9986.h"
+#include "h3854.h"
+#ifdef X
+#include "h5619.h"
+#endif
+struct S1145 { int a; const char *s = "x//y"; };
+inline int f1145_0(int x) { return x * 0; }
+inline int f1145_1(int x) { return x * 1; }
+inline int f1145_2(int x) { return x * 2; }
+inline int f1145_3(int x) { return x * 3; }
+inline int f1145_4(int x) { return x * 4; }
+inline int f1145_5(int x) { return x * 5; }
+inline int f1145_6(int x) { return x * 6; }
+inline int f1145_7(int x) { return x * 7; }
+inline int f1145_8(int x) { return x * 8; }
+inline int f1145_9(int x) { return x * 9; }
+inline int f1145_10(int x) { return x * 10; }
+inline int f1145_11(int x) { return x * 11; }
+inline int f1145_12(int x) { return x * 12; }
+inline int f1145_13(int x) { return x * 13; }
+inline int f1145_14(int x) { return x * 14; }
+inline int f1145_15(int x) { return x * 15; }
+inline int f1145_16(int x) { return x * 16; }
+inline int f1145_17(int x) { return x * 17; }
+inline int f1145_18(int x) { return x * 18; }
+inline int f1145_19(int x) { return x * 19; }
+inline int f1145_20(int x) { return x * 20; }
+inline int f1145_21(int x) { return x * 21; }
+inline int f1145_22(int x) { return x * 22; }
+inline int f1145_23(int x) { return x * 23; }
+inline int f1145_24(int x) { return x * 24; }
+inline int f1145_25(int x) { return x * 25; }
+inline int f1145_26(int x) { return x * 26; }
+inline int f1145_27(int x) { return x * 27; }
+inline int f1145_28(int x) { return x * 28; }
+inline int f1145_29(int x) { return x * 29; }
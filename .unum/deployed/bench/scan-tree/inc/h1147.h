@@ -0,0 +1,42 @@
+#pragma once
+/* header 1147 */
+#include <vector>
+#include "h4706.h"
+#include "h7233.h"
+#include "h2852.h"
+#include "h4822.h"
+#include "h1162.h"
+#ifdef X
+#include "h1018.h"
+#endif
+struct S1147 { int a; const char *s = "x//y"; };
+inline int f1147_0(int x) { return x * 0; }
+inline int f1147_1(int x) { return x * 1; }
+inline int f1147_2(int x) { return x * 2; }
+inline int f1147_3(int x) { return x * 3; }
+inline int f1147_4(int x) { return x * 4; }
+inline int f1147_5(int x) { return x * 5; }
+inline int f1147_6(int x) { return x * 6; }
+inline int f1147_7(int x) { return x * 7; }
+inline int f1147_8(int x) { return x * 8; }
+inline int f1147_9(int x) { return x * 9; }
+inline int f1147_10(int x) { return x * 10; }
+inline int f1147_11(int x) { return x * 11; }
+inline int f1147_12(int x) { return x * 12; }
+inline int f1147_13(int x) { return x * 13; }
+inline int f1147_14(int x) { return x * 14; }
+inline int f1147_15(int x) { return x * 15; }
+inline int f1147_16(int x) { return x * 16; }
+inline int f1147_17(int x) { return x * 17; }
+inline int f1147_18(int x) { return x * 18; }
+inline int f1147_19(int x) { return x * 19; }
+inline int f1147_20(int x) { return x * 20; }
+inline int f1147_21(int x) { return x * 21; }
+inline int f1147_22(int x) { return x * 22; }
+inline int f1147_23(int x) { return x * 23; }
+inline int f1147_24(int x) { return x * 24; }
+inline int f1147_25(int x) { return x * 25; }
+inline int f1147_26(int x) { return x * 26; }
+inline int f1147_27(int x) { return x * 27; }
+inline int f1147_28(int x) { return x * 28; }
+inline int f1147_29(int x) { return x * 29; }
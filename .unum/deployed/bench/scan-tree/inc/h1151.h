@@ -0,0 +1,42 @@
+#pragma once
+/* header 1151 */
+#include <vector>
+#include "h363.h"
+#include "h1568.h"
+#include "h29.h"
+#include "h3335.h"
+#include "h2183.h"
+#ifdef X
+#include "h3429.h"
+#endif
+struct S1151 { int a; const char *s = "x//y"; };
+inline int f1151_0(int x) { return x * 0; }
+inline int f1151_1(int x) { return x * 1; }
+inline int f1151_2(int x) { return x * 2; }
+inline int f1151_3(int x) { return x * 3; }
+inline int f1151_4(int x) { return x * 4; }
+inline int f1151_5(int x) { return x * 5; }
+inline int f1151_6(int x) { return x * 6; }
+inline int f1151_7(int x) { return x * 7; }
+inline int f1151_8(int x) { return x * 8; }
+inline int f1151_9(int x) { return x * 9; }
+inline int f1151_10(int x) { return x * 10; }
+inline int f1151_11(int x) { return x * 11; }
+inline int f1151_12(int x) { return x * 12; }
+inline int f1151_13(int x) { return x * 13; }
+inline int f1151_14(int x) { return x * 14; }
+inline int f1151_15(int x) { return x * 15; }
+inline int f1151_16(int x) { return x * 16; }
+inline int f1151_17(int x) { return x * 17; }
+inline int f1151_18(int x) { return x * 18; }
+inline int f1151_19(int x) { return x * 19; }
+inline int f1151_20(int x) { return x * 20; }
+inline int f1151_21(int x) { return x * 21; }
+inline int f1151_22(int x) { return x * 22; }
+inline int f1151_23(int x) { return x * 23; }
+inline int f1151_24(int x) { return x * 24; }
+inline int f1151_25(int x) { return x * 25; }
+inline int f1151_26(int x) { return x * 26; }
+inline int f1151_27(int x) { return x * 27; }
+inline int f1151_28(int x) { return x * 28; }
+inline int f1151_29(int x) { return x * 29; }
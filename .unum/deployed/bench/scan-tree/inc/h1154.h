@@ -0,0 +1,42 @@
+#pragma once
+/* header 1154 */
+#include <vector>
+#include "h5711.h"
+#include "h7997.h"
+#include "h9988.h"
+#include "h2500.h"
+#include "h6599.h"
+#ifdef X
+#include "h3973.h"
+#endif
+struct S1154 { int a; const char *s = "x//y"; };
+inline int f1154_0(int x) { return x * 0; }
+inline int f1154_1(int x) { return x * 1; }
+inline int f1154_2(int x) { return x * 2; }
+inline int f1154_3(int x) { return x * 3; }
+inline int f1154_4(int x) { return x * 4; }
+inline int f1154_5(int x) { return x * 5; }
+inline int f1154_6(int x) { return x * 6; }
+inline int f1154_7(int x) { return x * 7; }
+inline int f1154_8(int x) { return x * 8; }
+inline int f1154_9(int x) { return x * 9; }
+inline int f1154_10(int x) { return x * 10; }
+inline int f1154_11(int x) { return x * 11; }
+inline int f1154_12(int x) { return x * 12; }
+inline int f1154_13(int x) { return x * 13; }
+inline int f1154_14(int x) { return x * 14; }
+inline int f1154_15(int x) { return x * 15; }
+inline int f1154_16(int x) { return x * 16; }
+inline int f1154_17(int x) { return x * 17; }
+inline int f1154_18(int x) { return x * 18; }
+inline int f1154_19(int x) { return x * 19; }
+inline int f1154_20(int x) { return x * 20; }
+inline int f1154_21(int x) { return x * 21; }
+inline int f1154_22(int x) { return x * 22; }
+inline int f1154_23(int x) { return x * 23; }
+inline int f1154_24(int x) { return x * 24; }
+inline int f1154_25(int x) { return x * 25; }
+inline int f1154_26(int x) { return x * 26; }
+inline int f1154_27(int x) { return x * 27; }
+inline int f1154_28(int x) { return x * 28; }
+inline int f1154_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1162 */
+#include <vector>
+#include "h8851.h"
+#include "h132.h"
+#include "h4423.h"
+#include "h6116.h"
+#include "h4599.h"
+#ifdef X
+#include "h2024.h"
+#endif
+struct S1162 { int a; const char *s = "x//y"; };
+inline int f1162_0(int x) { return x * 0; }
+inline int f1162_1(int x) { return x * 1; }
+inline int f1162_2(int x) { return x * 2; }
+inline int f1162_3(int x) { return x * 3; }
+inline int f1162_4(int x) { return x * 4; }
+inline int f1162_5(int x) { return x * 5; }
+inline int f1162_6(int x) { return x * 6; }
+inline int f1162_7(int x) { return x * 7; }
+inline int f1162_8(int x) { return x * 8; }
+inline int f1162_9(int x) { return x * 9; }
+inline int f1162_10(int x) { return x * 10; }
+inline int f1162_11(int x) { return x * 11; }
+inline int f1162_12(int x) { return x * 12; }
+inline int f1162_13(int x) { return x * 13; }
+inline int f1162_14(int x) { return x * 14; }
+inline int f1162_15(int x) { return x * 15; }
+inline int f1162_16(int x) { return x * 16; }
+inline int f1162_17(int x) { return x * 17; }
+inline int f1162_18(int x) { return x * 18; }
+inline int f1162_19(int x) { return x * 19; }
+inline int f1162_20(int x) { return x * 20; }
+inline int f1162_21(int x) { return x * 21; }
+inline int f1162_22(int x) { return x * 22; }
+inline int f1162_23(int x) { return x * 23; }
+inline int f1162_24(int x) { return x * 24; }
+inline int f1162_25(int x) { return x * 25; }
+inline int f1162_26(int x) { return x * 26; }
+inline int f1162_27(int x) { return x * 27; }
+inline int f1162_28(int x) { return x * 28; }
+inline int f1162_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1164 */
+#include <vector>
+#include "h8436.h"
+#include "h1682.h"
+#include "h6067.h"
+#include "h4045.h"
+#include "h6054.h"
+#ifdef X
+#include "h8630.h"
+#endif
+struct S1164 { int a; const char *s = "x//y"; };
+inline int f1164_0(int x) { return x * 0; }
+inline int f1164_1(int x) { return x * 1; }
+inline int f1164_2(int x) { return x * 2; }
+inline int f1164_3(int x) { return x * 3; }
+inline int f1164_4(int x) { return x * 4; }
+inline int f1164_5(int x) { return x * 5; }
+inline int f1164_6(int x) { return x * 6; }
+inline int f1164_7(int x) { return x * 7; }
+inline int f1164_8(int x) { return x * 8; }
+inline int f1164_9(int x) { return x * 9; }
+inline int f1164_10(int x) { return x * 10; }
+inline int f1164_11(int x) { return x * 11; }
+inline int f1164_12(int x) { return x * 12; }
+inline int f1164_13(int x) { return x * 13; }
+inline int f1164_14(int x) { return x * 14; }
+inline int f1164_15(int x) { return x * 15; }
+inline int f1164_16(int x) { return x * 16; }
+inline int f1164_17(int x) { return x * 17; }
+inline int f1164_18(int x) { return x * 18; }
+inline int f1164_19(int x) { return x * 19; }
+inline int f1164_20(int x) { return x * 20; }
+inline int f1164_21(int x) { return x * 21; }
+inline int f1164_22(int x) { return x * 22; }
+inline int f1164_23(int x) { return x * 23; }
+inline int f1164_24(int x) { return x * 24; }
+inline int f1164_25(int x) { return x * 25; }
+inline int f1164_26(int x) { return x * 26; }
+inline int f1164_27(int x) { return x * 27; }
+inline int f1164_28(int x) { return x * 28; }
+inline int f1164_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1165 */
+#include <vector>
+#include "h9721.h"
+#include "h3133.h"
+#include "h3037.h"
+#include "h6819.h"
+#include "h8227.h"
+#ifdef X
+#include "h7517.h"
+#endif
+struct S1165 { int a; const char *s = "x//y"; };
+inline int f1165_0(int x) { return x * 0; }
+inline int f1165_1(int x) { return x * 1; }
+inline int f1165_2(int x) { return x * 2; }
+inline int f1165_3(int x) { return x * 3; }
+inline int f1165_4(int x) { return x * 4; }
+inline int f1165_5(int x) { return x * 5; }
+inline int f1165_6(int x) { return x * 6; }
+inline int f1165_7(int x) { return x * 7; }
+inline int f1165_8(int x) { return x * 8; }
+inline int f1165_9(int x) { return x * 9; }
+inline int f1165_10(int x) { return x * 10; }
+inline int f1165_11(int x) { return x * 11; }
+inline int f1165_12(int x) { return x * 12; }
+inline int f1165_13(int x) { return x * 13; }
+inline int f1165_14(int x) { return x * 14; }
+inline int f1165_15(int x) { return x * 15; }
+inline int f1165_16(int x) { return x * 16; }
+inline int f1165_17(int x) { return x * 17; }
+inline int f1165_18(int x) { return x * 18; }
+inline int f1165_19(int x) { return x * 19; }
+inline int f1165_20(int x) { return x * 20; }
+inline int f1165_21(int x) { return x * 21; }
+inline int f1165_22(int x) { return x * 22; }
+inline int f1165_23(int x) { return x * 23; }
+inline int f1165_24(int x) { return x * 24; }
+inline int f1165_25(int x) { return x * 25; }
+inline int f1165_26(int x) { return x * 26; }
+inline int f1165_27(int x) { return x * 27; }
+inline int f1165_28(int x) { return x * 28; }
+inline int f1165_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1166 */
+#include <vector>
+#include "h5609.h"
+#include "h2016.h"
+#include "h9257.h"
+#include "h8124.h"
+#include "h3607.h"
+#ifdef X
+#include "h7406.h"
+#endif
+struct S1166 { int a; const char *s = "x//y"; };
+inline int f1166_0(int x) { return x * 0; }
+inline int f1166_1(int x) { return x * 1; }
+inline int f1166_2(int x) { return x * 2; }
+inline int f1166_3(int x) { return x * 3; }
+inline int f1166_4(int x) { return x * 4; }
+inline int f1166_5(int x) { return x * 5; }
+inline int f1166_6(int x) { return x * 6; }
+inline int f1166_7(int x) { return x * 7; }
+inline int f1166_8(int x) { return x * 8; }
+inline int f1166_9(int x) { return x * 9; }
+inline int f1166_10(int x) { return x * 10; }
+inline int f1166_11(int x) { return x * 11; }
+inline int f1166_12(int x) { return x * 12; }
+inline int f1166_13(int x) { return x * 13; }
+inline int f1166_14(int x) { return x * 14; }
+inline int f1166_15(int x) { return x * 15; }
+inline int f1166_16(int x) { return x * 16; }
+inline int f1166_17(int x) { return x * 17; }
+inline int f1166_18(int x) { return x * 18; }
+inline int f1166_19(int x) { return x * 19; }
+inline int f1166_20(int x) { return x * 20; }
+inline int f1166_21(int x) { return x * 21; }
+inline int f1166_22(int x) { return x * 22; }
+inline int f1166_23(int x) { return x * 23; }
+inline int f1166_24(int x) { return x * 24; }
+inline int f1166_25(int x) { return x * 25; }
+inline int f1166_26(int x) { return x * 26; }
+inline int f1166_27(int x) { return x * 27; }
+inline int f1166_28(int x) { return x * 28; }
+inline int f1166_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1167 */
+#include <vector>
+#include "h7748.h"
+#include "h2631.h"
+#include "h9418.h"
+#include "h4803.h"
+#include "h6271.h"
+#ifdef X
+#include "h9014.h"
+#endif
+struct S1167 { int a; const char *s = "x//y"; };
+inline int f1167_0(int x) { return x * 0; }
+inline int f1167_1(int x) { return x * 1; }
+inline int f1167_2(int x) { return x * 2; }
+inline int f1167_3(int x) { return x * 3; }
+inline int f1167_4(int x) { return x * 4; }
+inline int f1167_5(int x) { return x * 5; }
+inline int f1167_6(int x) { return x * 6; }
+inline int f1167_7(int x) { return x * 7; }
+inline int f1167_8(int x) { return x * 8; }
+inline int f1167_9(int x) { return x * 9; }
+inline int f1167_10(int x) { return x * 10; }
+inline int f1167_11(int x) { return x * 11; }
+inline int f1167_12(int x) { return x * 12; }
+inline int f1167_13(int x) { return x * 13; }
+inline int f1167_14(int x) { return x * 14; }
+inline int f1167_15(int x) { return x * 15; }
+inline int f1167_16(int x) { return x * 16; }
+inline int f1167_17(int x) { return x * 17; }
+inline int f1167_18(int x) { return x * 18; }
+inline int f1167_19(int x) { return x * 19; }
+inline int f1167_20(int x) { return x * 20; }
+inline int f1167_21(int x) { return x * 21; }
+inline int f1167_22(int x) { return x * 22; }
+inline int f1167_23(int x) { return x * 23; }
+inline int f1167_24(int x) { return x * 24; }
+inline int f1167_25(int x) { return x * 25; }
+inline int f1167_26(int x) { return x * 26; }
+inline int f1167_27(int x) { return x * 27; }
+inline int f1167_28(int x) { return x * 28; }
+inline int f1167_29(int x) { return x * 29; }
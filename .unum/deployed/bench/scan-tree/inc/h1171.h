@@ -0,0 +1,42 @@
+#pragma once
+/* header 1171 */
+#include <vector>
+#include "h1850.h"
+#include "h7781.h"
+#include "h4089.h"
+#include "h9755.h"
+#include "h6873.h"
+#ifdef X
+#include "h8574.h"
+#endif
+struct S1171 { int a; const char *s = "x//y"; };
+inline int f1171_0(int x) { return x * 0; }
+inline int f1171_1(int x) { return x * 1; }
+inline int f1171_2(int x) { return x * 2; }
+inline int f1171_3(int x) { return x * 3; }
+inline int f1171_4(int x) { return x * 4; }
+inline int f1171_5(int x) { return x * 5; }
+inline int f1171_6(int x) { return x * 6; }
+inline int f1171_7(int x) { return x * 7; }
+inline int f1171_8(int x) { return x * 8; }
+inline int f1171_9(int x) { return x * 9; }
+inline int f1171_10(int x) { return x * 10; }
+inline int f1171_11(int x) { return x * 11; }
+inline int f1171_12(int x) { return x * 12; }
+inline int f1171_13(int x) { return x * 13; }
+inline int f1171_14(int x) { return x * 14; }
+inline int f1171_15(int x) { return x * 15; }
+inline int f1171_16(int x) { return x * 16; }
+inline int f1171_17(int x) { return x * 17; }
+inline int f1171_18(int x) { return x * 18; }
+inline int f1171_19(int x) { return x * 19; }
+inline int f1171_20(int x) { return x * 20; }
+inline int f1171_21(int x) { return x * 21; }
+inline int f1171_22(int x) { return x * 22; }
+inline int f1171_23(int x) { return x * 23; }
+inline int f1171_24(int x) { return x * 24; }
+inline int f1171_25(int x) { return x * 25; }
+inline int f1171_26(int x) { return x * 26; }
+inline int f1171_27(int x) { return x * 27; }
+inline int f1171_28(int x) { return x * 28; }
+inline int f1171_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1173 */
+#include <vector>
+#include "h2953.h"
+#include "h1304.h"
+#include "h9382.h"
+#include "h2845.h"
+#include "h5428.h"
+#ifdef X
+#include "h8545.h"
+#endif
+struct S1173 { int a; const char *s = "x//y"; };
+inline int f1173_0(int x) { return x * 0; }
+inline int f1173_1(int x) { return x * 1; }
+inline int f1173_2(int x) { return x * 2; }
+inline int f1173_3(int x) { return x * 3; }
+inline int f1173_4(int x) { return x * 4; }
+inline int f1173_5(int x) { return x * 5; }
+inline int f1173_6(int x) { return x * 6; }
+inline int f1173_7(int x) { return x * 7; }
+inline int f1173_8(int x) { return x * 8; }
+inline int f1173_9(int x) { return x * 9; }
+inline int f1173_10(int x) { return x * 10; }
+inline int f1173_11(int x) { return x * 11; }
+inline int f1173_12(int x) { return x * 12; }
+inline int f1173_13(int x) { return x * 13; }
+inline int f1173_14(int x) { return x * 14; }
+inline int f1173_15(int x) { return x * 15; }
+inline int f1173_16(int x) { return x * 16; }
+inline int f1173_17(int x) { return x * 17; }
+inline int f1173_18(int x) { return x * 18; }
+inline int f1173_19(int x) { return x * 19; }
+inline int f1173_20(int x) { return x * 20; }
+inline int f1173_21(int x) { return x * 21; }
+inline int f1173_22(int x) { return x * 22; }
+inline int f1173_23(int x) { return x * 23; }
+inline int f1173_24(int x) { return x * 24; }
+inline int f1173_25(int x) { return x * 25; }
+inline int f1173_26(int x) { return x * 26; }
+inline int f1173_27(int x) { return x * 27; }
+inline int f1173_28(int x) { return x * 28; }
+inline int f1173_29(int x) { return x * 29; }
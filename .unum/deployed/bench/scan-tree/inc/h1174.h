@@ -0,0 +1,42 @@
+#pragma once
+/* header 1174 */
+#include <vector>
+#include "h7132.h"
+#include "h8434.h"
+#include "h3053.h"
+#include "h1219.h"
+#include "h8593.h"
+#ifdef X
+#include "h7919.h"
+#endif
+struct S1174 { int a; const char *s = "x//y"; };
+inline int f1174_0(int x) { return x * 0; }
+inline int f1174_1(int x) { return x * 1; }
+inline int f1174_2(int x) { return x * 2; }
+inline int f1174_3(int x) { return x * 3; }
+inline int f1174_4(int x) { return x * 4; }
+inline int f1174_5(int x) { return x * 5; }
+inline int f1174_6(int x) { return x * 6; }
+inline int f1174_7(int x) { return x * 7; }
+inline int f1174_8(int x) { return x * 8; }
+inline int f1174_9(int x) { return x * 9; }
+inline int f1174_10(int x) { return x * 10; }
+inline int f1174_11(int x) { return x * 11; }
+inline int f1174_12(int x) { return x * 12; }
+inline int f1174_13(int x) { return x * 13; }
+inline int f1174_14(int x) { return x * 14; }
+inline int f1174_15(int x) { return x * 15; }
+inline int f1174_16(int x) { return x * 16; }
+inline int f1174_17(int x) { return x * 17; }
+inline int f1174_18(int x) { return x * 18; }
+inline int f1174_19(int x) { return x * 19; }
+inline int f1174_20(int x) { return x * 20; }
+inline int f1174_21(int x) { return x * 21; }
+inline int f1174_22(int x) { return x * 22; }
+inline int f1174_23(int x) { return x * 23; }
+inline int f1174_24(int x) { return x * 24; }
+inline int f1174_25(int x) { return x * 25; }
+inline int f1174_26(int x) { return x * 26; }
+inline int f1174_27(int x) { return x * 27; }
+inline int f1174_28(int x) { return x * 28; }
+inline int f1174_29(int x) { return x * 29; }
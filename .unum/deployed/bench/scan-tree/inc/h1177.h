@@ -0,0 +1,42 @@
+#pragma once
+/* header 1177 */
+#include <vector>
+#include "h8422.h"
+#include "h9448.h"
+#include "h9644.h"
+#include "h4397.h"
+#include "h1925.h"
+#ifdef X
+#include "h4770.h"
+#endif
+struct S1177 { int a; const char *s = "x//y"; };
+inline int f1177_0(int x) { return x * 0; }
+inline int f1177_1(int x) { return x * 1; }
+inline int f1177_2(int x) { return x * 2; }
+inline int f1177_3(int x) { return x * 3; }
+inline int f1177_4(int x) { return x * 4; }
+inline int f1177_5(int x) { return x * 5; }
+inline int f1177_6(int x) { return x * 6; }
+inline int f1177_7(int x) { return x * 7; }
+inline int f1177_8(int x) { return x * 8; }
+inline int f1177_9(int x) { return x * 9; }
+inline int f1177_10(int x) { return x * 10; }
+inline int f1177_11(int x) { return x * 11; }
+inline int f1177_12(int x) { return x * 12; }
+inline int f1177_13(int x) { return x * 13; }
+inline int f1177_14(int x) { return x * 14; }
+inline int f1177_15(int x) { return x * 15; }
+inline int f1177_16(int x) { return x * 16; }
+inline int f1177_17(int x) { return x * 17; }
+inline int f1177_18(int x) { return x * 18; }
+inline int f1177_19(int x) { return x * 19; }
+inline int f1177_20(int x) { return x * 20; }
+inline int f1177_21(int x) { return x * 21; }
+inline int f1177_22(int x) { return x * 22; }
+inline int f1177_23(int x) { return x * 23; }
+inline int f1177_24(int x) { return x * 24; }
+inline int f1177_25(int x) { return x * 25; }
+inline int f1177_26(int x) { return x * 26; }
+inline int f1177_27(int x) { return x * 27; }
+inline int f1177_28(int x) { return x * 28; }
+inline int f1177_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1185 */
+#include <vector>
+#include "h4524.h"
+#include "h4777.h"
+#include "h7595.h"
+#include "h4606.h"
+#include "h9014.h"
+#ifdef X
+#include "h7396.h"
+#endif
+struct S1185 { int a; const char *s = "x//y"; };
+inline int f1185_0(int x) { return x * 0; }
+inline int f1185_1(int x) { return x * 1; }
+inline int f1185_2(int x) { return x * 2; }
+inline int f1185_3(int x) { return x * 3; }
+inline int f1185_4(int x) { return x * 4; }
+inline int f1185_5(int x) { return x * 5; }
+inline int f1185_6(int x) { return x * 6; }
+inline int f1185_7(int x) { return x * 7; }
+inline int f1185_8(int x) { return x * 8; }
+inline int f1185_9(int x) { return x * 9; }
+inline int f1185_10(int x) { return x * 10; }
+inline int f1185_11(int x) { return x * 11; }
+inline int f1185_12(int x) { return x * 12; }
+inline int f1185_13(int x) { return x * 13; }
+inline int f1185_14(int x) { return x * 14; }
+inline int f1185_15(int x) { return x * 15; }
+inline int f1185_16(int x) { return x * 16; }
+inline int f1185_17(int x) { return x * 17; }
+inline int f1185_18(int x) { return x * 18; }
+inline int f1185_19(int x) { return x * 19; }
+inline int f1185_20(int x) { return x * 20; }
+inline int f1185_21(int x) { return x * 21; }
+inline int f1185_22(int x) { return x * 22; }
+inline int f1185_23(int x) { return x * 23; }
+inline int f1185_24(int x) { return x * 24; }
+inline int f1185_25(int x) { return x * 25; }
+inline int f1185_26(int x) { return x * 26; }
+inline int f1185_27(int x) { return x * 27; }
+inline int f1185_28(int x) { return x * 28; }
+inline int f1185_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1188 */
+#include <vector>
+#include "h9486.h"
+#include "h4558.h"
+#include "h8458.h"
+#include "h8816.h"
+#include "h4297.h"
+#ifdef X
+#include "h4496.h"
+#endif
+struct S1188 { int a; const char *s = "x//y"; };
+inline int f1188_0(int x) { return x * 0; }
+inline int f1188_1(int x) { return x * 1; }
+inline int f1188_2(int x) { return x * 2; }
+inline int f1188_3(int x) { return x * 3; }
+inline int f1188_4(int x) { return x * 4; }
+inline int f1188_5(int x) { return x * 5; }
+inline int f1188_6(int x) { return x * 6; }
+inline int f1188_7(int x) { return x * 7; }
+inline int f1188_8(int x) { return x * 8; }
+inline int f1188_9(int x) { return x * 9; }
+inline int f1188_10(int x) { return x * 10; }
+inline int f1188_11(int x) { return x * 11; }
+inline int f1188_12(int x) { return x * 12; }
+inline int f1188_13(int x) { return x * 13; }
+inline int f1188_14(int x) { return x * 14; }
+inline int f1188_15(int x) { return x * 15; }
+inline int f1188_16(int x) { return x * 16; }
+inline int f1188_17(int x) { return x * 17; }
+inline int f1188_18(int x) { return x * 18; }
+inline int f1188_19(int x) { return x * 19; }
+inline int f1188_20(int x) { return x * 20; }
+inline int f1188_21(int x) { return x * 21; }
+inline int f1188_22(int x) { return x * 22; }
+inline int f1188_23(int x) { return x * 23; }
+inline int f1188_24(int x) { return x * 24; }
+inline int f1188_25(int x) { return x * 25; }
+inline int f1188_26(int x) { return x * 26; }
+inline int f1188_27(int x) { return x * 27; }
+inline int f1188_28(int x) { return x * 28; }
+inline int f1188_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1189 */
+#include <vector>
+#include "h5761.h"
+#include "h1173.h"
+#include "h9997.h"
+#include "h1841.h"
+#include "h4663.h"
+#ifdef X
+#include "h4616.h"
+#endif
+struct S1189 { int a; const char *s = "x//y"; };
+inline int f1189_0(int x) { return x * 0; }
+inline int f1189_1(int x) { return x * 1; }
+inline int f1189_2(int x) { return x * 2; }
+inline int f1189_3(int x) { return x * 3; }
+inline int f1189_4(int x) { return x * 4; }
+inline int f1189_5(int x) { return x * 5; }
+inline int f1189_6(int x) { return x * 6; }
+inline int f1189_7(int x) { return x * 7; }
+inline int f1189_8(int x) { return x * 8; }
+inline int f1189_9(int x) { return x * 9; }
+inline int f1189_10(int x) { return x * 10; }
+inline int f1189_11(int x) { return x * 11; }
+inline int f1189_12(int x) { return x * 12; }
+inline int f1189_13(int x) { return x * 13; }
+inline int f1189_14(int x) { return x * 14; }
+inline int f1189_15(int x) { return x * 15; }
+inline int f1189_16(int x) { return x * 16; }
+inline int f1189_17(int x) { return x * 17; }
+inline int f1189_18(int x) { return x * 18; }
+inline int f1189_19(int x) { return x * 19; }
+inline int f1189_20(int x) { return x * 20; }
+inline int f1189_21(int x) { return x * 21; }
+inline int f1189_22(int x) { return x * 22; }
+inline int f1189_23(int x) { return x * 23; }
+inline int f1189_24(int x) { return x * 24; }
+inline int f1189_25(int x) { return x * 25; }
+inline int f1189_26(int x) { return x * 26; }
+inline int f1189_27(int x) { return x * 27; }
+inline int f1189_28(int x) { return x * 28; }
+inline int f1189_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 119 */
+#include <vector>
+#include "h2246.h"
+#include "h269.h"
+#include "h6402.h"
+#include "h7066.h"
+#include "h3366.h"
+#ifdef X
+#include "h2517.h"
+#endif
+struct S119 { int a; const char *s = "x//y"; };
+inline int f119_0(int x) { return x * 0; }
+inline int f119_1(int x) { return x * 1; }
+inline int f119_2(int x) { return x * 2; }
+inline int f119_3(int x) { return x * 3; }
+inline int f119_4(int x) { return x * 4; }
+inline int f119_5(int x) { return x * 5; }
+inline int f119_6(int x) { return x * 6; }
+inline int f119_7(int x) { return x * 7; }
+inline int f119_8(int x) { return x * 8; }
+inline int f119_9(int x) { return x * 9; }
+inline int f119_10(int x) { return x * 10; }
+inline int f119_11(int x) { return x * 11; }
+inline int f119_12(int x) { return x * 12; }
+inline int f119_13(int x) { return x * 13; }
+inline int f119_14(int x) { return x * 14; }
+inline int f119_15(int x) { return x * 15; }
+inline int f119_16(int x) { return x * 16; }
+inline int f119_17(int x) { return x * 17; }
+inline int f119_18(int x) { return x * 18; }
+inline int f119_19(int x) { return x * 19; }
+inline int f119_20(int x) { return x * 20; }
+inline int f119_21(int x) { return x * 21; }
+inline int f119_22(int x) { return x * 22; }
+inline int f119_23(int x) { return x * 23; }
+inline int f119_24(int x) { return x * 24; }
+inline int f119_25(int x) { return x * 25; }
+inline int f119_26(int x) { return x * 26; }
+inline int f119_27(int x) { return x * 27; }
+inline int f119_28(int x) { return x * 28; }
+inline int f119_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1191 */
+#include <vector>
+#include "h8731.h"
+#include "h8510.h"
+#include "h1256.h"
+#include "h7349.h"
+#include "h353.h"
+#ifdef X
+#include "h9495.h"
+#endif
+struct S1191 { int a; const char *s = "x//y"; };
+inline int f1191_0(int x) { return x * 0; }
+inline int f1191_1(int x) { return x * 1; }
+inline int f1191_2(int x) { return x * 2; }
+inline int f1191_3(int x) { return x * 3; }
+inline int f1191_4(int x) { return x * 4; }
+inline int f1191_5(int x) { return x * 5; }
+inline int f1191_6(int x) { return x * 6; }
+inline int f1191_7(int x) { return x * 7; }
+inline int f1191_8(int x) { return x * 8; }
+inline int f1191_9(int x) { return x * 9; }
+inline int f1191_10(int x) { return x * 10; }
+inline int f1191_11(int x) { return x * 11; }
+inline int f1191_12(int x) { return x * 12; }
+inline int f1191_13(int x) { return x * 13; }
+inline int f1191_14(int x) { return x * 14; }
+inline int f1191_15(int x) { return x * 15; }
+inline int f1191_16(int x) { return x * 16; }
+inline int f1191_17(int x) { return x * 17; }
+inline int f1191_18(int x) { return x * 18; }
+inline int f1191_19(int x) { return x * 19; }
+inline int f1191_20(int x) { return x * 20; }
+inline int f1191_21(int x) { return x * 21; }
+inline int f1191_22(int x) { return x * 22; }
+inline int f1191_23(int x) { return x * 23; }
+inline int f1191_24(int x) { return x * 24; }
+inline int f1191_25(int x) { return x * 25; }
+inline int f1191_26(int x) { return x * 26; }
+inline int f1191_27(int x) { return x * 27; }
+inline int f1191_28(int x) { return x * 28; }
+inline int f1191_29(int x) { return x * 29; }
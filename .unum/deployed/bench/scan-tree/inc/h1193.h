@@ -0,0 +1,42 @@
+#pragma once
+/* header 1193 */
+#include <vector>
+#include "h7197.h"
+#include "h1892.h"
+#include "h2695.h"
+#include "h5837.h"
+#include "h4345.h"
+#ifdef X
+#include "h1829.h"
+#endif
+struct S1193 { int a; const char *s = "x//y"; };
+inline int f1193_0(int x) { return x * 0; }
+inline int f1193_1(int x) { return x * 1; }
+inline int f1193_2(int x) { return x * 2; }
+inline int f1193_3(int x) { return x * 3; }
+inline int f1193_4(int x) { return x * 4; }
+inline int f1193_5(int x) { return x * 5; }
+inline int f1193_6(int x) { return x * 6; }
+inline int f1193_7(int x) { return x * 7; }
+inline int f1193_8(int x) { return x * 8; }
+inline int f1193_9(int x) { return x * 9; }
+inline int f1193_10(int x) { return x * 10; }
+inline int f1193_11(int x) { return x * 11; }
+inline int f1193_12(int x) { return x * 12; }
+inline int f1193_13(int x) { return x * 13; }
+inline int f1193_14(int x) { return x * 14; }
+inline int f1193_15(int x) { return x * 15; }
+inline int f1193_16(int x) { return x * 16; }
+inline int f1193_17(int x) { return x * 17; }
+inline int f1193_18(int x) { return x * 18; }
+inline int f1193_19(int x) { return x * 19; }
+inline int f1193_20(int x) { return x * 20; }
+inline int f1193_21(int x) { return x * 21; }
+inline int f1193_22(int x) { return x * 22; }
+inline int f1193_23(int x) { return x * 23; }
+inline int f1193_24(int x) { return x * 24; }
+inline int f1193_25(int x) { return x * 25; }
+inline int f1193_26(int x) { return x * 26; }
+inline int f1193_27(int x) { return x * 27; }
+inline int f1193_28(int x) { return x * 28; }
+inline int f1193_29(int x) { return x * 29; }
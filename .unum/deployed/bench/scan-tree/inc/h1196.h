@@ -0,0 +1,42 @@
+#pragma once
+/* header 1196 */
+#include <vector>
+#include "h2779.h"
+#include "h3166.h"
+#include "h8892.h"
+#include "h500.h"
+#include "h5522.h"
+#ifdef X
+#include "h3177.h"
+#endif
+struct S1196 { int a; const char *s = "x//y"; };
+inline int f1196_0(int x) { return x * 0; }
+inline int f1196_1(int x) { return x * 1; }
+inline int f1196_2(int x) { return x * 2; }
+inline int f1196_3(int x) { return x * 3; }
+inline int f1196_4(int x) { return x * 4; }
+inline int f1196_5(int x) { return x * 5; }
+inline int f1196_6(int x) { return x * 6; }
+inline int f1196_7(int x) { return x * 7; }
+inline int f1196_8(int x) { return x * 8; }
+inline int f1196_9(int x) { return x * 9; }
+inline int f1196_10(int x) { return x * 10; }
+inline int f1196_11(int x) { return x * 11; }
+inline int f1196_12(int x) { return x * 12; }
+inline int f1196_13(int x) { return x * 13; }
+inline int f1196_14(int x) { return x * 14; }
+inline int f1196_15(int x) { return x * 15; }
+inline int f1196_16(int x) { return x * 16; }
+inline int f1196_17(int x) { return x * 17; }
+inline int f1196_18(int x) { return x * 18; }
+inline int f1196_19(int x) { return x * 19; }
+inline int f1196_20(int x) { return x * 20; }
+inline int f1196_21(int x) { return x * 21; }
+inline int f1196_22(int x) { return x * 22; }
+inline int f1196_23(int x) { return x * 23; }
+inline int f1196_24(int x) { return x * 24; }
+inline int f1196_25(int x) { return x * 25; }
+inline int f1196_26(int x) { return x * 26; }
+inline int f1196_27(int x) { return x * 27; }
+inline int f1196_28(int x) { return x * 28; }
+inline int f1196_29(int x) { return x * 29; }
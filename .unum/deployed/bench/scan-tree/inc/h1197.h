@@ -0,0 +1,42 @@
+#pragma once
+/* header 1197 */
+#include <vector>
+#include "h7966.h"
+#include "h2178.h"
+#include "h8365.h"
+#include "h9112.h"
+#include "h8984.h"
+#ifdef X
+#include "h5737.h"
+#endif
+struct S1197 { int a; const char *s = "x//y"; };
+inline int f1197_0(int x) { return x * 0; }
+inline int f1197_1(int x) { return x * 1; }
+inline int f1197_2(int x) { return x * 2; }
+inline int f1197_3(int x) { return x * 3; }
+inline int f1197_4(int x) { return x * 4; }
+inline int f1197_5(int x) { return x * 5; }
+inline int f1197_6(int x) { return x * 6; }
+inline int f1197_7(int x) { return x * 7; }
+inline int f1197_8(int x) { return x * 8; }
+inline int f1197_9(int x) { return x * 9; }
+inline int f1197_10(int x) { return x * 10; }
+inline int f1197_11(int x) { return x * 11; }
+inline int f1197_12(int x) { return x * 12; }
+inline int f1197_13(int x) { return x * 13; }
+inline int f1197_14(int x) { return x * 14; }
+inline int f1197_15(int x) { return x * 15; }
+inline int f1197_16(int x) { return x * 16; }
+inline int f1197_17(int x) { return x * 17; }
+inline int f1197_18(int x) { return x * 18; }
+inline int f1197_19(int x) { return x * 19; }
+inline int f1197_20(int x) { return x * 20; }
+inline int f1197_21(int x) { return x * 21; }
+inline int f1197_22(int x) { return x * 22; }
+inline int f1197_23(int x) { return x * 23; }
+inline int f1197_24(int x) { return x * 24; }
+inline int f1197_25(int x) { return x * 25; }
+inline int f1197_26(int x) { return x * 26; }
+inline int f1197_27(int x) { return x * 27; }
+inline int f1197_28(int x) { return x * 28; }
+inline int f1197_29(int x) { return x * 29; }
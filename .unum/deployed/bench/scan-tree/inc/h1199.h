@@ -0,0 +1,42 @@
+#pragma once
+/* header 1199 */
+#include <vector>
+#include "h6356.h"
+#include "h5041.h"
+#include "h9732.h"
+#include "h601.h"
+#include "h4283.h"
+#ifdef X
+#include "h3544.h"
+#endif
+struct S1199 { int a; const char *s = "x//y"; };
+inline int f1199_0(int x) { return x * 0; }
+inline int f1199_1(int x) { return x * 1; }
+inline int f1199_2(int x) { return x * 2; }
+inline int f1199_3(int x) { return x * 3; }
+inline int f1199_4(int x) { return x * 4; }
+inline int f1199_5(int x) { return x * 5; }
+inline int f1199_6(int x) { return x * 6; }
+inline int f1199_7(int x) { return x * 7; }
+inline int f1199_8(int x) { return x * 8; }
+inline int f1199_9(int x) { return x * 9; }
+inline int f1199_10(int x) { return x * 10; }
+inline int f1199_11(int x) { return x * 11; }
+inline int f1199_12(int x) { return x * 12; }
+inline int f1199_13(int x) { return x * 13; }
+inline int f1199_14(int x) { return x * 14; }
+inline int f1199_15(int x) { return x * 15; }
+inline int f1199_16(int x) { return x * 16; }
+inline int f1199_17(int x) { return x * 17; }
+inline int f1199_18(int x) { return x * 18; }
+inline int f1199_19(int x) { return x * 19; }
+inline int f1199_20(int x) { return x * 20; }
+inline int f1199_21(int x) { return x * 21; }
+inline int f1199_22(int x) { return x * 22; }
+inline int f1199_23(int x) { return x * 23; }
+inline int f1199_24(int x) { return x * 24; }
+inline int f1199_25(int x) { return x * 25; }
+inline int f1199_26(int x) { return x * 26; }
+inline int f1199_27(int x) { return x * 27; }
+inline int f1199_28(int x) { return x * 28; }
+inline int f1199_29(int x) { return x * 29; }
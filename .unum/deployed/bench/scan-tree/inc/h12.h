@@ -0,0 +1,42 @@
+#pragma once
+/* header 12 */
+#include <vector>
+#include "h1361.h"
+#include "h5271.h"
+#include "h5778.h"
+#include "h9178.h"
+#include "h5722.h"
+#ifdef X
+#include "h8037.h"
+#endif
+struct S12 { int a; const char *s = "x//y"; };
+inline int f12_0(int x) { return x * 0; }
+inline int f12_1(int x) { return x * 1; }
+inline int f12_2(int x) { return x * 2; }
+inline int f12_3(int x) { return x * 3; }
+inline int f12_4(int x) { return x * 4; }
+inline int f12_5(int x) { return x * 5; }
+inline int f12_6(int x) { return x * 6; }
+inline int f12_7(int x) { return x * 7; }
+inline int f12_8(int x) { return x * 8; }
+inline int f12_9(int x) { return x * 9; }
+inline int f12_10(int x) { return x * 10; }
+inline int f12_11(int x) { return x * 11; }
+inline int f12_12(int x) { return x * 12; }
+inline int f12_13(int x) { return x * 13; }
+inline int f12_14(int x) { return x * 14; }
+inline int f12_15(int x) { return x * 15; }
+inline int f12_16(int x) { return x * 16; }
+inline int f12_17(int x) { return x * 17; }
+inline int f12_18(int x) { return x * 18; }
+inline int f12_19(int x) { return x * 19; }
+inline int f12_20(int x) { return x * 20; }
+inline int f12_21(int x) { return x * 21; }
+inline int f12_22(int x) { return x * 22; }
+inline int f12_23(int x) { return x * 23; }
+inline int f12_24(int x) { return x * 24; }
+inline int f12_25(int x) { return x * 25; }
+inline int f12_26(int x) { return x * 26; }
+inline int f12_27(int x) { return x * 27; }
+inline int f12_28(int x) { return x * 28; }
+inline int f12_29(int x) { return x * 29; }
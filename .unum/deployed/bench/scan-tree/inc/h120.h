@@ -0,0 +1,42 @@
+#pragma once
+/* header 120 */
+#include <vector>
+#include "h8694.h"
+#include "h2906.h"
+#include "h7472.h"
+#include "h4483.h"
+#include "h255.h"
+#ifdef X
+#include "h3714.h"
+#endif
+struct S120 { int a; const char *s = "x//y"; };
+inline int f120_0(int x) { return x * 0; }
+inline int f120_1(int x) { return x * 1; }
+inline int f120_2(int x) { return x * 2; }
+inline int f120_3(int x) { return x * 3; }
+inline int f120_4(int x) { return x * 4; }
+inline int f120_5(int x) { return x * 5; }
+inline int f120_6(int x) { return x * 6; }
+inline int f120_7(int x) { return x * 7; }
+inline int f120_8(int x) { return x * 8; }
+inline int f120_9(int x) { return x * 9; }
+inline int f120_10(int x) { return x * 10; }
+inline int f120_11(int x) { return x * 11; }
+inline int f120_12(int x) { return x * 12; }
+inline int f120_13(int x) { return x * 13; }
+inline int f120_14(int x) { return x * 14; }
+inline int f120_15(int x) { return x * 15; }
+inline int f120_16(int x) { return x * 16; }
+inline int f120_17(int x) { return x * 17; }
+inline int f120_18(int x) { return x * 18; }
+inline int f120_19(int x) { return x * 19; }
+inline int f120_20(int x) { return x * 20; }
+inline int f120_21(int x) { return x * 21; }
+inline int f120_22(int x) { return x * 22; }
+inline int f120_23(int x) { return x * 23; }
+inline int f120_24(int x) { return x * 24; }
+inline int f120_25(int x) { return x * 25; }
+inline int f120_26(int x) { return x * 26; }
+inline int f120_27(int x) { return x * 27; }
+inline int f120_28(int x) { return x * 28; }
+inline int f120_29(int x) { return x * 29; }
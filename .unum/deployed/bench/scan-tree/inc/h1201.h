@@ -0,0 +1,42 @@
+#pragma once
+/* header 1201 */
+#include <vector>
+#include "h295.h"
+#include "h9384.h"
+#include "h5545.h"
+#include "h8976.h"
+#include "h5063.h"
+#ifdef X
+#include "h2872.h"
+#endif
+struct S1201 { int a; const char *s = "x//y"; };
+inline int f1201_0(int x) { return x * 0; }
+inline int f1201_1(int x) { return x * 1; }
+inline int f1201_2(int x) { return x * 2; }
+inline int f1201_3(int x) { return x * 3; }
+inline int f1201_4(int x) { return x * 4; }
+inline int f1201_5(int x) { return x * 5; }
+inline int f1201_6(int x) { return x * 6; }
+inline int f1201_7(int x) { return x * 7; }
+inline int f1201_8(int x) { return x * 8; }
+inline int f1201_9(int x) { return x * 9; }
+inline int f1201_10(int x) { return x * 10; }
+inline int f1201_11(int x) { return x * 11; }
+inline int f1201_12(int x) { return x * 12; }
+inline int f1201_13(int x) { return x * 13; }
+inline int f1201_14(int x) { return x * 14; }
+inline int f1201_15(int x) { return x * 15; }
+inline int f1201_16(int x) { return x * 16; }
+inline int f1201_17(int x) { return x * 17; }
+inline int f1201_18(int x) { return x * 18; }
+inline int f1201_19(int x) { return x * 19; }
+inline int f1201_20(int x) { return x * 20; }
+inline int f1201_21(int x) { return x * 21; }
+inline int f1201_22(int x) { return x * 22; }
+inline int f1201_23(int x) { return x * 23; }
+inline int f1201_24(int x) { return x * 24; }
+inline int f1201_25(int x) { return x * 25; }
+inline int f1201_26(int x) { return x * 26; }
+inline int f1201_27(int x) { return x * 27; }
+inline int f1201_28(int x) { return x * 28; }
+inline int f1201_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1202 */
+#include <vector>
+#include "h1358.h"
+#include "h98.h"
+#include "h3915.h"
+#include "h8738.h"
+#include "h4423.h"
+#ifdef X
+#include "h6988.h"
+#endif
+struct S1202 { int a; const char *s = "x//y"; };
+inline int f1202_0(int x) { return x * 0; }
+inline int f1202_1(int x) { return x * 1; }
+inline int f1202_2(int x) { return x * 2; }
+inline int f1202_3(int x) { return x * 3; }
+inline int f1202_4(int x) { return x * 4; }
+inline int f1202_5(int x) { return x * 5; }
+inline int f1202_6(int x) { return x * 6; }
+inline int f1202_7(int x) { return x * 7; }
+inline int f1202_8(int x) { return x * 8; }
+inline int f1202_9(int x) { return x * 9; }
+inline int f1202_10(int x) { return x * 10; }
+inline int f1202_11(int x) { return x * 11; }
+inline int f1202_12(int x) { return x * 12; }
+inline int f1202_13(int x) { return x * 13; }
+inline int f1202_14(int x) { return x * 14; }
+inline int f1202_15(int x) { return x * 15; }
+inline int f1202_16(int x) { return x * 16; }
+inline int f1202_17(int x) { return x * 17; }
+inline int f1202_18(int x) { return x * 18; }
+inline int f1202_19(int x) { return x * 19; }
+inline int f1202_20(int x) { return x * 20; }
+inline int f1202_21(int x) { return x * 21; }
+inline int f1202_22(int x) { return x * 22; }
+inline int f1202_23(int x) { return x * 23; }
+inline int f1202_24(int x) { return x * 24; }
+inline int f1202_25(int x) { return x * 25; }
+inline int f1202_26(int x) { return x * 26; }
+inline int f1202_27(int x) { return x * 27; }
+inline int f1202_28(int x) { return x * 28; }
+inline int f1202_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1205 */
+#include <vector>
+#include "h1734.h"
+#include "h7476.h"
+#include "h6589.h"
+#include "h2089.h"
+#include "h3989.h"
+#ifdef X
+#include "h5486.h"
+#endif
+struct S1205 { int a; const char *s = "x//y"; };
+inline int f1205_0(int x) { return x * 0; }
+inline int f1205_1(int x) { return x * 1; }
+inline int f1205_2(int x) { return x * 2; }
+inline int f1205_3(int x) { return x * 3; }
+inline int f1205_4(int x) { return x * 4; }
+inline int f1205_5(int x) { return x * 5; }
+inline int f1205_6(int x) { return x * 6; }
+inline int f1205_7(int x) { return x * 7; }
+inline int f1205_8(int x) { return x * 8; }
+inline int f1205_9(int x) { return x * 9; }
+inline int f1205_10(int x) { return x * 10; }
+inline int f1205_11(int x) { return x * 11; }
+inline int f1205_12(int x) { return x * 12; }
+inline int f1205_13(int x) { return x * 13; }
+inline int f1205_14(int x) { return x * 14; }
+inline int f1205_15(int x) { return x * 15; }
+inline int f1205_16(int x) { return x * 16; }
+inline int f1205_17(int x) { return x * 17; }
+inline int f1205_18(int x) { return x * 18; }
+inline int f1205_19(int x) { return x * 19; }
+inline int f1205_20(int x) { return x * 20; }
+inline int f1205_21(int x) { return x * 21; }
+inline int f1205_22(int x) { return x * 22; }
+inline int f1205_23(int x) { return x * 23; }
+inline int f1205_24(int x) { return x * 24; }
+inline int f1205_25(int x) { return x * 25; }
+inline int f1205_26(int x) { return x * 26; }
+inline int f1205_27(int x) { return x * 27; }
+inline int f1205_28(int x) { return x * 28; }
+inline int f1205_29(int x) { return x * 29; }
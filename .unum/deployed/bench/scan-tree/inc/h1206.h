@@ -0,0 +1,42 @@
+#pragma once
+/* header 1206 */
+#include <vector>
+#include "h9729.h"
+#include "h5724.h"
+#include "h2078.h"
+#include "h2730.h"
+#include "h7694.h"
+#ifdef X
+#include "h1744.h"
+#endif
+struct S1206 { int a; const char *s = "x//y"; };
+inline int f1206_0(int x) { return x * 0; }
+inline int f1206_1(int x) { return x * 1; }
+inline int f1206_2(int x) { return x * 2; }
+inline int f1206_3(int x) { return x * 3; }
+inline int f1206_4(int x) { return x * 4; }
+inline int f1206_5(int x) { return x * 5; }
+inline int f1206_6(int x) { return x * 6; }
+inline int f1206_7(int x) { return x * 7; }
+inline int f1206_8(int x) { return x * 8; }
+inline int f1206_9(int x) { return x * 9; }
+inline int f1206_10(int x) { return x * 10; }
+inline int f1206_11(int x) { return x * 11; }
+inline int f1206_12(int x) { return x * 12; }
+inline int f1206_13(int x) { return x * 13; }
+inline int f1206_14(int x) { return x * 14; }
+inline int f1206_15(int x) { return x * 15; }
+inline int f1206_16(int x) { return x * 16; }
+inline int f1206_17(int x) { return x * 17; }
+inline int f1206_18(int x) { return x * 18; }
+inline int f1206_19(int x) { return x * 19; }
+inline int f1206_20(int x) { return x * 20; }
+inline int f1206_21(int x) { return x * 21; }
+inline int f1206_22(int x) { return x * 22; }
+inline int f1206_23(int x) { return x * 23; }
+inline int f1206_24(int x) { return x * 24; }
+inline int f1206_25(int x) { return x * 25; }
+inline int f1206_26(int x) { return x * 26; }
+inline int f1206_27(int x) { return x * 27; }
+inline int f1206_28(int x) { return x * 28; }
+inline int f1206_29(int x) { return x * 29; }
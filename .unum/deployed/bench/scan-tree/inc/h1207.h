@@ -0,0 +1,42 @@
+#pragma once
+/* header 1207 */
+#include <vector>
+#include "h209.h"
+#include "h7312.h"
+#include "h6550.h"
+#include "h82.h"
+#include "h2739.h"
+#ifdef X
+#include "h2277.h"
+#endif
+struct S1207 { int a; const char *s = "x//y"; };
+inline int f1207_0(int x) { return x * 0; }
+inline int f1207_1(int x) { return x * 1; }
+inline int f1207_2(int x) { return x * 2; }
+inline int f1207_3(int x) { return x * 3; }
+inline int f1207_4(int x) { return x * 4; }
+inline int f1207_5(int x) { return x * 5; }
+inline int f1207_6(int x) { return x * 6; }
+inline int f1207_7(int x) { return x * 7; }
+inline int f1207_8(int x) { return x * 8; }
+inline int f1207_9(int x) { return x * 9; }
+inline int f1207_10(int x) { return x * 10; }
+inline int f1207_11(int x) { return x * 11; }
+inline int f1207_12(int x) { return x * 12; }
+inline int f1207_13(int x) { return x * 13; }
+inline int f1207_14(int x) { return x * 14; }
+inline int f1207_15(int x) { return x * 15; }
+inline int f1207_16(int x) { return x * 16; }
+inline int f1207_17(int x) { return x * 17; }
+inline int f1207_18(int x) { return x * 18; }
+inline int f1207_19(int x) { return x * 19; }
+inline int f1207_20(int x) { return x * 20; }
+inline int f1207_21(int x) { return x * 21; }
+inline int f1207_22(int x) { return x * 22; }
+inline int f1207_23(int x) { return x * 23; }
+inline int f1207_24(int x) { return x * 24; }
+inline int f1207_25(int x) { return x * 25; }
+inline int f1207_26(int x) { return x * 26; }
+inline int f1207_27(int x) { return x * 27; }
+inline int f1207_28(int x) { return x * 28; }
+inline int f1207_29(int x) { return x * 29; }
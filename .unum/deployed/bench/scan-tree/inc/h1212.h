@@ -0,0 +1,42 @@
+#pragma once
+/* header 1212 */
+#include <vector>
+#include "h6660.h"
+#include "h1644.h"
+#include "h2122.h"
+#include "h587.h"
+#include "h1000.h"
+#ifdef X
+#include "h270.h"
+#endif
+struct S1212 { int a; const char *s = "x//y"; };
+inline int f1212_0(int x) { return x * 0; }
+inline int f1212_1(int x) { return x * 1; }
+inline int f1212_2(int x) { return x * 2; }
+inline int f1212_3(int x) { return x * 3; }
+inline int f1212_4(int x) { return x * 4; }
+inline int f1212_5(int x) { return x * 5; }
+inline int f1212_6(int x) { return x * 6; }
+inline int f1212_7(int x) { return x * 7; }
+inline int f1212_8(int x) { return x * 8; }
+inline int f1212_9(int x) { return x * 9; }
+inline int f1212_10(int x) { return x * 10; }
+inline int f1212_11(int x) { return x * 11; }
+inline int f1212_12(int x) { return x * 12; }
+inline int f1212_13(int x) { return x * 13; }
+inline int f1212_14(int x) { return x * 14; }
+inline int f1212_15(int x) { return x * 15; }
+inline int f1212_16(int x) { return x * 16; }
+inline int f1212_17(int x) { return x * 17; }
+inline int f1212_18(int x) { return x * 18; }
+inline int f1212_19(int x) { return x * 19; }
+inline int f1212_20(int x) { return x * 20; }
+inline int f1212_21(int x) { return x * 21; }
+inline int f1212_22(int x) { return x * 22; }
+inline int f1212_23(int x) { return x * 23; }
+inline int f1212_24(int x) { return x * 24; }
+inline int f1212_25(int x) { return x * 25; }
+inline int f1212_26(int x) { return x * 26; }
+inline int f1212_27(int x) { return x * 27; }
+inline int f1212_28(int x) { return x * 28; }
+inline int f1212_29(int x) { return x * 29; }
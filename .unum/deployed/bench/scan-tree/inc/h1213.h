@@ -0,0 +1,42 @@
+#pragma once
+/* header 1213 */
+#include <vector>
+#include "h9477.h"
+#include "h135.h"
+#include "h7852.h"
+#include "h8019.h"
+#include "h9450.h"
+#ifdef X
+#include "h7632.h"
+#endif
+struct S1213 { int a; const char *s = "x//y"; };
+inline int f1213_0(int x) { return x * 0; }
+inline int f1213_1(int x) { return x * 1; }
+inline int f1213_2(int x) { return x * 2; }
+inline int f1213_3(int x) { return x * 3; }
+inline int f1213_4(int x) { return x * 4; }
+inline int f1213_5(int x) { return x * 5; }
+inline int f1213_6(int x) { return x * 6; }
+inline int f1213_7(int x) { return x * 7; }
+inline int f1213_8(int x) { return x * 8; }
+inline int f1213_9(int x) { return x * 9; }
+inline int f1213_10(int x) { return x * 10; }
+inline int f1213_11(int x) { return x * 11; }
+inline int f1213_12(int x) { return x * 12; }
+inline int f1213_13(int x) { return x * 13; }
+inline int f1213_14(int x) { return x * 14; }
+inline int f1213_15(int x) { return x * 15; }
+inline int f1213_16(int x) { return x * 16; }
+inline int f1213_17(int x) { return x * 17; }
+inline int f1213_18(int x) { return x * 18; }
+inline int f1213_19(int x) { return x * 19; }
+inline int f1213_20(int x) { return x * 20; }
+inline int f1213_21(int x) { return x * 21; }
+inline int f1213_22(int x) { return x * 22; }
+inline int f1213_23(int x) { return x * 23; }
+inline int f1213_24(int x) { return x * 24; }
+inline int f1213_25(int x) { return x * 25; }
+inline int f1213_26(int x) { return x * 26; }
+inline int f1213_27(int x) { return x * 27; }
+inline int f1213_28(int x) { return x * 28; }
+inline int f1213_29(int x) { return x * 29; }
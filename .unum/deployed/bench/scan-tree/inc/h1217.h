@@ -0,0 +1,42 @@
+#pragma once
+/* header 1217 */
+#include <vector>
+#include "h7009.h"
+#include "h9444.h"
+#include "h6441.h"
+#include "h3502.h"
+#include "h8630.h"
+#ifdef X
+#include "h8859.h"
+#endif
+struct S1217 { int a; const char *s = "x//y"; };
+inline int f1217_0(int x) { return x * 0; }
+inline int f1217_1(int x) { return x * 1; }
+inline int f1217_2(int x) { return x * 2; }
+inline int f1217_3(int x) { return x * 3; }
+inline int f1217_4(int x) { return x * 4; }
+inline int f1217_5(int x) { return x * 5; }
+inline int f1217_6(int x) { return x * 6; }
+inline int f1217_7(int x) { return x * 7; }
+inline int f1217_8(int x) { return x * 8; }
+inline int f1217_9(int x) { return x * 9; }
+inline int f1217_10(int x) { return x * 10; }
+inline int f1217_11(int x) { return x * 11; }
+inline int f1217_12(int x) { return x * 12; }
+inline int f1217_13(int x) { return x * 13; }
+inline int f1217_14(int x) { return x * 14; }
+inline int f1217_15(int x) { return x * 15; }
+inline int f1217_16(int x) { return x * 16; }
+inline int f1217_17(int x) { return x * 17; }
+inline int f1217_18(int x) { return x * 18; }
+inline int f1217_19(int x) { return x * 19; }
+inline int f1217_20(int x) { return x * 20; }
+inline int f1217_21(int x) { return x * 21; }
+inline int f1217_22(int x) { return x * 22; }
+inline int f1217_23(int x) { return x * 23; }
+inline int f1217_24(int x) { return x * 24; }
+inline int f1217_25(int x) { return x * 25; }
+inline int f1217_26(int x) { return x * 26; }
+inline int f1217_27(int x) { return x * 27; }
+inline int f1217_28(int x) { return x * 28; }
+inline int f1217_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1219 */
+#include <vector>
+#include "h8408.h"
+#include "h9194.h"
+#include "h7346.h"
+#include "h1835.h"
+#include "h4325.h"
+#ifdef X
+#include "h6858.h"
+#endif
+struct S1219 { int a; const char *s = "x//y"; };
+inline int f1219_0(int x) { return x * 0; }
+inline int f1219_1(int x) { return x * 1; }
+inline int f1219_2(int x) { return x * 2; }
+inline int f1219_3(int x) { return x * 3; }
+inline int f1219_4(int x) { return x * 4; }
+inline int f1219_5(int x) { return x * 5; }
+inline int f1219_6(int x) { return x * 6; }
+inline int f1219_7(int x) { return x * 7; }
+inline int f1219_8(int x) { return x * 8; }
+inline int f1219_9(int x) { return x * 9; }
+inline int f1219_10(int x) { return x * 10; }
+inline int f1219_11(int x) { return x * 11; }
+inline int f1219_12(int x) { return x * 12; }
+inline int f1219_13(int x) { return x * 13; }
+inline int f1219_14(int x) { return x * 14; }
+inline int f1219_15(int x) { return x * 15; }
+inline int f1219_16(int x) { return x * 16; }
+inline int f1219_17(int x) { return x * 17; }
+inline int f1219_18(int x) { return x * 18; }
+inline int f1219_19(int x) { return x * 19; }
+inline int f1219_20(int x) { return x * 20; }
+inline int f1219_21(int x) { return x * 21; }
+inline int f1219_22(int x) { return x * 22; }
+inline int f1219_23(int x) { return x * 23; }
+inline int f1219_24(int x) { return x * 24; }
+inline int f1219_25(int x) { return x * 25; }
+inline int f1219_26(int x) { return x * 26; }
+inline int f1219_27(int x) { return x * 27; }
+inline int f1219_28(int x) { return x * 28; }
+inline int f1219_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 122 */
+#include <vector>
+#include "h3816.h"
+#include "h1907.h"
+#include "h6274.h"
+#include "h7196.h"
+#include "h7087.h"
+#ifdef X
+#include "h8574.h"
+#endif
+struct S122 { int a; const char *s = "x//y"; };
+inline int f122_0(int x) { return x * 0; }
+inline int f122_1(int x) { return x * 1; }
+inline int f122_2(int x) { return x * 2; }
+inline int f122_3(int x) { return x * 3; }
+inline int f122_4(int x) { return x * 4; }
+inline int f122_5(int x) { return x * 5; }
+inline int f122_6(int x) { return x * 6; }
+inline int f122_7(int x) { return x * 7; }
+inline int f122_8(int x) { return x * 8; }
+inline int f122_9(int x) { return x * 9; }
+inline int f122_10(int x) { return x * 10; }
+inline int f122_11(int x) { return x * 11; }
+inline int f122_12(int x) { return x * 12; }
+inline int f122_13(int x) { return x * 13; }
+inline int f122_14(int x) { return x * 14; }
+inline int f122_15(int x) { return x * 15; }
+inline int f122_16(int x) { return x * 16; }
+inline int f122_17(int x) { return x * 17; }
+inline int f122_18(int x) { return x * 18; }
+inline int f122_19(int x) { return x * 19; }
+inline int f122_20(int x) { return x * 20; }
+inline int f122_21(int x) { return x * 21; }
+inline int f122_22(int x) { return x * 22; }
+inline int f122_23(int x) { return x * 23; }
+inline int f122_24(int x) { return x * 24; }
+inline int f122_25(int x) { return x * 25; }
+inline int f122_26(int x) { return x * 26; }
+inline int f122_27(int x) { return x * 27; }
+inline int f122_28(int x) { return x * 28; }
+inline int f122_29(int x) { return x * 29; }
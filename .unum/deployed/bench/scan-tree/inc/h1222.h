@@ -0,0 +1,42 @@
+#pragma once
+/* header 1222 */
+#include <vector>
+#include "h7248.h"
+#include "h9919.h"
+#include "h4226.h"
+#include "h7718.h"
+#include "h4910.h"
+#ifdef X
+#include "h5946.h"
+#endif
+struct S1222 { int a; const char *s = "x//y"; };
+inline int f1222_0(int x) { return x * 0; }
+inline int f1222_1(int x) { return x * 1; }
+inline int f1222_2(int x) { return x * 2; }
+inline int f1222_3(int x) { return x * 3; }
+inline int f1222_4(int x) { return x * 4; }
+inline int f1222_5(int x) { return x * 5; }
+inline int f1222_6(int x) { return x * 6; }
+inline int f1222_7(int x) { return x * 7; }
+inline int f1222_8(int x) { return x * 8; }
+inline int f1222_9(int x) { return x * 9; }
+inline int f1222_10(int x) { return x * 10; }
+inline int f1222_11(int x) { return x * 11; }
+inline int f1222_12(int x) { return x * 12; }
+inline int f1222_13(int x) { return x * 13; }
+inline int f1222_14(int x) { return x * 14; }
+inline int f1222_15(int x) { return x * 15; }
+inline int f1222_16(int x) { return x * 16; }
+inline int f1222_17(int x) { return x * 17; }
+inline int f1222_18(int x) { return x * 18; }
+inline int f1222_19(int x) { return x * 19; }
+inline int f1222_20(int x) { return x * 20; }
+inline int f1222_21(int x) { return x * 21; }
+inline int f1222_22(int x) { return x * 22; }
+inline int f1222_23(int x) { return x * 23; }
+inline int f1222_24(int x) { return x * 24; }
+inline int f1222_25(int x) { return x * 25; }
+inline int f1222_26(int x) { return x * 26; }
+inline int f1222_27(int x) { return x * 27; }
+inline int f1222_28(int x) { return x * 28; }
+inline int f1222_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1223 */
+#include <vector>
+#include "h7706.h"
+#include "h1999.h"
+#include "h9277.h"
+#include "h751.h"
+#include "h1599.h"
+#ifdef X
+#include "h742.h"
+#endif
+struct S1223 { int a; const char *s = "x//y"; };
+inline int f1223_0(int x) { return x * 0; }
+inline int f1223_1(int x) { return x * 1; }
+inline int f1223_2(int x) { return x * 2; }
+inline int f1223_3(int x) { return x * 3; }
+inline int f1223_4(int x) { return x * 4; }
+inline int f1223_5(int x) { return x * 5; }
+inline int f1223_6(int x) { return x * 6; }
+inline int f1223_7(int x) { return x * 7; }
+inline int f1223_8(int x) { return x * 8; }
+inline int f1223_9(int x) { return x * 9; }
+inline int f1223_10(int x) { return x * 10; }
+inline int f1223_11(int x) { return x * 11; }
+inline int f1223_12(int x) { return x * 12; }
+inline int f1223_13(int x) { return x * 13; }
+inline int f1223_14(int x) { return x * 14; }
+inline int f1223_15(int x) { return x * 15; }
+inline int f1223_16(int x) { return x * 16; }
+inline int f1223_17(int x) { return x * 17; }
+inline int f1223_18(int x) { return x * 18; }
+inline int f1223_19(int x) { return x * 19; }
+inline int f1223_20(int x) { return x * 20; }
+inline int f1223_21(int x) { return x * 21; }
+inline int f1223_22(int x) { return x * 22; }
+inline int f1223_23(int x) { return x * 23; }
+inline int f1223_24(int x) { return x * 24; }
+inline int f1223_25(int x) { return x * 25; }
+inline int f1223_26(int x) { return x * 26; }
+inline int f1223_27(int x) { return x * 27; }
+inline int f1223_28(int x) { return x * 28; }
+inline int f1223_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1224 */
+#include <vector>
+#include "h5094.h"
+#include "h7563.h"
+#include "h5580.h"
+#include "h8497.h"
+#include "h2614.h"
+#ifdef X
+#include "h8634.h"
+#endif
+struct S1224 { int a; const char *s = "x//y"; };
+inline int f1224_0(int x) { return x * 0; }
+inline int f1224_1(int x) { return x * 1; }
+inline int f1224_2(int x) { return x * 2; }
+inline int f1224_3(int x) { return x * 3; }
+inline int f1224_4(int x) { return x * 4; }
+inline int f1224_5(int x) { return x * 5; }
+inline int f1224_6(int x) { return x * 6; }
+inline int f1224_7(int x) { return x * 7; }
+inline int f1224_8(int x) { return x * 8; }
+inline int f1224_9(int x) { return x * 9; }
+inline int f1224_10(int x) { return x * 10; }
+inline int f1224_11(int x) { return x * 11; }
+inline int f1224_12(int x) { return x * 12; }
+inline int f1224_13(int x) { return x * 13; }
+inline int f1224_14(int x) { return x * 14; }
+inline int f1224_15(int x) { return x * 15; }
+inline int f1224_16(int x) { return x * 16; }
+inline int f1224_17(int x) { return x * 17; }
+inline int f1224_18(int x) { return x * 18; }
+inline int f1224_19(int x) { return x * 19; }
+inline int f1224_20(int x) { return x * 20; }
+inline int f1224_21(int x) { return x * 21; }
+inline int f1224_22(int x) { return x * 22; }
+inline int f1224_23(int x) { return x * 23; }
+inline int f1224_24(int x) { return x * 24; }
+inline int f1224_25(int x) { return x * 25; }
+inline int f1224_26(int x) { return x * 26; }
+inline int f1224_27(int x) { return x * 27; }
+inline int f1224_28(int x) { return x * 28; }
+inline int f1224_29(int x) { return x * 29; }
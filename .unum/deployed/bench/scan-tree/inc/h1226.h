@@ -0,0 +1,42 @@
+#pragma once
+/* header 1226 */
+#include <vector>
+#include "h348.h"
+#include "h3981.h"
+#include "h7623.h"
+#include "h9458.h"
+#include "h1869.h"
+#ifdef X
+#include "h7312.h"
+#endif
+struct S1226 { int a; const char *s = "x//y"; };
+inline int f1226_0(int x) { return x * 0; }
+inline int f1226_1(int x) { return x * 1; }
+inline int f1226_2(int x) { return x * 2; }
+inline int f1226_3(int x) { return x * 3; }
+inline int f1226_4(int x) { return x * 4; }
+inline int f1226_5(int x) { return x * 5; }
+inline int f1226_6(int x) { return x * 6; }
+inline int f1226_7(int x) { return x * 7; }
+inline int f1226_8(int x) { return x * 8; }
+inline int f1226_9(int x) { return x * 9; }
+inline int f1226_10(int x) { return x * 10; }
+inline int f1226_11(int x) { return x * 11; }
+inline int f1226_12(int x) { return x * 12; }
+inline int f1226_13(int x) { return x * 13; }
+inline int f1226_14(int x) { return x * 14; }
+inline int f1226_15(int x) { return x * 15; }
+inline int f1226_16(int x) { return x * 16; }
+inline int f1226_17(int x) { return x * 17; }
+inline int f1226_18(int x) { return x * 18; }
+inline int f1226_19(int x) { return x * 19; }
+inline int f1226_20(int x) { return x * 20; }
+inline int f1226_21(int x) { return x * 21; }
+inline int f1226_22(int x) { return x * 22; }
+inline int f1226_23(int x) { return x * 23; }
+inline int f1226_24(int x) { return x * 24; }
+inline int f1226_25(int x) { return x * 25; }
+inline int f1226_26(int x) { return x * 26; }
+inline int f1226_27(int x) { return x * 27; }
+inline int f1226_28(int x) { return x * 28; }
+inline int f1226_29(int x) { return x * 29; }
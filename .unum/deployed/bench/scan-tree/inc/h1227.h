@@ -0,0 +1,42 @@
+#pragma once
+/* header 1227 */
+#include <vector>
+#include "h917.h"
+#include "h1790.h"
+#include "h6268.h"
+#include "h4017.h"
+#include "h4102.h"
+#ifdef X
+#include "h4962.h"
+#endif
+struct S1227 { int a; const char *s = "x//y"; };
+inline int f1227_0(int x) { return x * 0; }
+inline int f1227_1(int x) { return x * 1; }
+inline int f1227_2(int x) { return x * 2; }
+inline int f1227_3(int x) { return x * 3; }
+inline int f1227_4(int x) { return x * 4; }
+inline int f1227_5(int x) { return x * 5; }
+inline int f1227_6(int x) { return x * 6; }
+inline int f1227_7(int x) { return x * 7; }
+inline int f1227_8(int x) { return x * 8; }
+inline int f1227_9(int x) { return x * 9; }
+inline int f1227_10(int x) { return x * 10; }
+inline int f1227_11(int x) { return x * 11; }
+inline int f1227_12(int x) { return x * 12; }
+inline int f1227_13(int x) { return x * 13; }
+inline int f1227_14(int x) { return x * 14; }
+inline int f1227_15(int x) { return x * 15; }
+inline int f1227_16(int x) { return x * 16; }
+inline int f1227_17(int x) { return x * 17; }
+inline int f1227_18(int x) { return x * 18; }
+inline int f1227_19(int x) { return x * 19; }
+inline int f1227_20(int x) { return x * 20; }
+inline int f1227_21(int x) { return x * 21; }
+inline int f1227_22(int x) { return x * 22; }
+inline int f1227_23(int x) { return x * 23; }
+inline int f1227_24(int x) { return x * 24; }
+inline int f1227_25(int x) { return x * 25; }
+inline int f1227_26(int x) { return x * 26; }
+inline int f1227_27(int x) { return x * 27; }
+inline int f1227_28(int x) { return x * 28; }
+inline int f1227_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1228 */
+#include <vector>
+#include "h9892.h"
+#include "h7378.h"
+#include "h1194.h"
+#include "h73.h"
+#include "h8745.h"
+#ifdef X
+#include "h4679.h"
+#endif
+struct S1228 { int a; const char *s = "x//y"; };
+inline int f1228_0(int x) { return x * 0; }
+inline int f1228_1(int x) { return x * 1; }
+inline int f1228_2(int x) { return x * 2; }
+inline int f1228_3(int x) { return x * 3; }
+inline int f1228_4(int x) { return x * 4; }
+inline int f1228_5(int x) { return x * 5; }
+inline int f1228_6(int x) { return x * 6; }
+inline int f1228_7(int x) { return x * 7; }
+inline int f1228_8(int x) { return x * 8; }
+inline int f1228_9(int x) { return x * 9; }
+inline int f1228_10(int x) { return x * 10; }
+inline int f1228_11(int x) { return x * 11; }
+inline int f1228_12(int x) { return x * 12; }
+inline int f1228_13(int x) { return x * 13; }
+inline int f1228_14(int x) { return x * 14; }
+inline int f1228_15(int x) { return x * 15; }
+inline int f1228_16(int x) { return x * 16; }
+inline int f1228_17(int x) { return x * 17; }
+inline int f1228_18(int x) { return x * 18; }
+inline int f1228_19(int x) { return x * 19; }
+inline int f1228_20(int x) { return x * 20; }
+inline int f1228_21(int x) { return x * 21; }
+inline int f1228_22(int x) { return x * 22; }
+inline int f1228_23(int x) { return x * 23; }
+inline int f1228_24(int x) { return x * 24; }
+inline int f1228_25(int x) { return x * 25; }
+inline int f1228_26(int x) { return x * 26; }
+inline int f1228_27(int x) { return x * 27; }
+inline int f1228_28(int x) { return x * 28; }
+inline int f1228_29(int x) { return x * 29; }
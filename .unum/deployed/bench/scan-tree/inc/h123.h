@@ -0,0 +1,42 @@
+#pragma once
+/* header 123 */
+#include <vector>
+#include "h899.h"
+#include "h8049.h"
+#include "h7044.h"
+#include "h2703.h"
+#include "h9891.h"
+#ifdef X
+#include "h9592.h"
+#endif
+struct S123 { int a; const char *s = "x//y"; };
+inline int f123_0(int x) { return x * 0; }
+inline int f123_1(int x) { return x * 1; }
+inline int f123_2(int x) { return x * 2; }
+inline int f123_3(int x) { return x * 3; }
+inline int f123_4(int x) { return x * 4; }
+inline int f123_5(int x) { return x * 5; }
+inline int f123_6(int x) { return x * 6; }
+inline int f123_7(int x) { return x * 7; }
+inline int f123_8(int x) { return x * 8; }
+inline int f123_9(int x) { return x * 9; }
+inline int f123_10(int x) { return x * 10; }
+inline int f123_11(int x) { return x * 11; }
+inline int f123_12(int x) { return x * 12; }
+inline int f123_13(int x) { return x * 13; }
+inline int f123_14(int x) { return x * 14; }
+inline int f123_15(int x) { return x * 15; }
+inline int f123_16(int x) { return x * 16; }
+inline int f123_17(int x) { return x * 17; }
+inline int f123_18(int x) { return x * 18; }
+inline int f123_19(int x) { return x * 19; }
+inline int f123_20(int x) { return x * 20; }
+inline int f123_21(int x) { return x * 21; }
+inline int f123_22(int x) { return x * 22; }
+inline int f123_23(int x) { return x * 23; }
+inline int f123_24(int x) { return x * 24; }
+inline int f123_25(int x) { return x * 25; }
+inline int f123_26(int x) { return x * 26; }
+inline int f123_27(int x) { return x * 27; }
+inline int f123_28(int x) { return x * 28; }
+inline int f123_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1232 */
+#include <vector>
+#include "h8762.h"
+#include "h8239.h"
+#include "h9419.h"
+#include "h6629.h"
+#include "h7675.h"
+#ifdef X
+#include "h2805.h"
+#endif
+struct S1232 { int a; const char *s = "x//y"; };
+inline int f1232_0(int x) { return x * 0; }
+inline int f1232_1(int x) { return x * 1; }
+inline int f1232_2(int x) { return x * 2; }
+inline int f1232_3(int x) { return x * 3; }
+inline int f1232_4(int x) { return x * 4; }
+inline int f1232_5(int x) { return x * 5; }
+inline int f1232_6(int x) { return x * 6; }
+inline int f1232_7(int x) { return x * 7; }
+inline int f1232_8(int x) { return x * 8; }
+inline int f1232_9(int x) { return x * 9; }
+inline int f1232_10(int x) { return x * 10; }
+inline int f1232_11(int x) { return x * 11; }
+inline int f1232_12(int x) { return x * 12; }
+inline int f1232_13(int x) { return x * 13; }
+inline int f1232_14(int x) { return x * 14; }
+inline int f1232_15(int x) { return x * 15; }
+inline int f1232_16(int x) { return x * 16; }
+inline int f1232_17(int x) { return x * 17; }
+inline int f1232_18(int x) { return x * 18; }
+inline int f1232_19(int x) { return x * 19; }
+inline int f1232_20(int x) { return x * 20; }
+inline int f1232_21(int x) { return x * 21; }
+inline int f1232_22(int x) { return x * 22; }
+inline int f1232_23(int x) { return x * 23; }
+inline int f1232_24(int x) { return x * 24; }
+inline int f1232_25(int x) { return x * 25; }
+inline int f1232_26(int x) { return x * 26; }
+inline int f1232_27(int x) { return x * 27; }
+inline int f1232_28(int x) { return x * 28; }
+inline int f1232_29(int x) { return x * 29; }
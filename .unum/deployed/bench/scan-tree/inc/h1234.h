@@ -0,0 +1,42 @@
+#pragma once
+/* header 1234 */
+#include <vector>
+#include "h5815.h"
+#include "h4318.h"
+#include "h785.h"
+#include "h5892.h"
+#include "h1615.h"
+#ifdef X
+#include "h5777.h"
+#endif
+struct S1234 { int a; const char *s = "x//y"; };
+inline int f1234_0(int x) { return x * 0; }
+inline int f1234_1(int x) { return x * 1; }
+inline int f1234_2(int x) { return x * 2; }
+inline int f1234_3(int x) { return x * 3; }
+inline int f1234_4(int x) { return x * 4; }
+inline int f1234_5(int x) { return x * 5; }
+inline int f1234_6(int x) { return x * 6; }
+inline int f1234_7(int x) { return x * 7; }
+inline int f1234_8(int x) { return x * 8; }
+inline int f1234_9(int x) { return x * 9; }
+inline int f1234_10(int x) { return x * 10; }
+inline int f1234_11(int x) { return x * 11; }
+inline int f1234_12(int x) { return x * 12; }
+inline int f1234_13(int x) { return x * 13; }
+inline int f1234_14(int x) { return x * 14; }
+inline int f1234_15(int x) { return x * 15; }
+inline int f1234_16(int x) { return x * 16; }
+inline int f1234_17(int x) { return x * 17; }
+inline int f1234_18(int x) { return x * 18; }
+inline int f1234_19(int x) { return x * 19; }
+inline int f1234_20(int x) { return x * 20; }
+inline int f1234_21(int x) { return x * 21; }
+inline int f1234_22(int x) { return x * 22; }
+inline int f1234_23(int x) { return x * 23; }
+inline int f1234_24(int x) { return x * 24; }
+inline int f1234_25(int x) { return x * 25; }
+inline int f1234_26(int x) { return x * 26; }
+inline int f1234_27(int x) { return x * 27; }
+inline int f1234_28(int x) { return x * 28; }
+inline int f1234_29(int x) { return x * 29; }
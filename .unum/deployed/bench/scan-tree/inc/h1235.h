@@ -0,0 +1,42 @@
+#pragma once
+/* header 1235 */
+#include <vector>
+#include "h1072.h"
+#include "h8721.h"
+#include "h1038.h"
+#include "h8382.h"
+#include "h8902.h"
+#ifdef X
+#include "h7848.h"
+#endif
+struct S1235 { int a; const char *s = "x//y"; };
+inline int f1235_0(int x) { return x * 0; }
+inline int f1235_1(int x) { return x * 1; }
+inline int f1235_2(int x) { return x * 2; }
+inline int f1235_3(int x) { return x * 3; }
+inline int f1235_4(int x) { return x * 4; }
+inline int f1235_5(int x) { return x * 5; }
+inline int f1235_6(int x) { return x * 6; }
+inline int f1235_7(int x) { return x * 7; }
+inline int f1235_8(int x) { return x * 8; }
+inline int f1235_9(int x) { return x * 9; }
+inline int f1235_10(int x) { return x * 10; }
+inline int f1235_11(int x) { return x * 11; }
+inline int f1235_12(int x) { return x * 12; }
+inline int f1235_13(int x) { return x * 13; }
+inline int f1235_14(int x) { return x * 14; }
+inline int f1235_15(int x) { return x * 15; }
+inline int f1235_16(int x) { return x * 16; }
+inline int f1235_17(int x) { return x * 17; }
+inline int f1235_18(int x) { return x * 18; }
+inline int f1235_19(int x) { return x * 19; }
+inline int f1235_20(int x) { return x * 20; }
+inline int f1235_21(int x) { return x * 21; }
+inline int f1235_22(int x) { return x * 22; }
+inline int f1235_23(int x) { return x * 23; }
+inline int f1235_24(int x) { return x * 24; }
+inline int f1235_25(int x) { return x * 25; }
+inline int f1235_26(int x) { return x * 26; }
+inline int f1235_27(int x) { return x * 27; }
+inline int f1235_28(int x) { return x * 28; }
+inline int f1235_29(int x) { return x * 29; }
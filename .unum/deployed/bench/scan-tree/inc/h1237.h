@@ -0,0 +1,42 @@
+#pragma once
+/* header 1237 */
+#include <vector>
+#include "h7664.h"
+#include "h4820.h"
+#include "h1188.h"
+#include "h4252.h"
+#include "h8009.h"
+#ifdef X
+#include "h5066.h"
+#endif
+struct S1237 { int a; const char *s = "x//y"; };
+inline int f1237_0(int x) { return x * 0; }
+inline int f1237_1(int x) { return x * 1; }
+inline int f1237_2(int x) { return x * 2; }
+inline int f1237_3(int x) { return x * 3; }
+inline int f1237_4(int x) { return x * 4; }
+inline int f1237_5(int x) { return x * 5; }
+inline int f1237_6(int x) { return x * 6; }
+inline int f1237_7(int x) { return x * 7; }
+inline int f1237_8(int x) { return x * 8; }
+inline int f1237_9(int x) { return x * 9; }
+inline int f1237_10(int x) { return x * 10; }
+inline int f1237_11(int x) { return x * 11; }
+inline int f1237_12(int x) { return x * 12; }
+inline int f1237_13(int x) { return x * 13; }
+inline int f1237_14(int x) { return x * 14; }
+inline int f1237_15(int x) { return x * 15; }
+inline int f1237_16(int x) { return x * 16; }
+inline int f1237_17(int x) { return x * 17; }
+inline int f1237_18(int x) { return x * 18; }
+inline int f1237_19(int x) { return x * 19; }
+inline int f1237_20(int x) { return x * 20; }
+inline int f1237_21(int x) { return x * 21; }
+inline int f1237_22(int x) { return x * 22; }
+inline int f1237_23(int x) { return x * 23; }
+inline int f1237_24(int x) { return x * 24; }
+inline int f1237_25(int x) { return x * 25; }
+inline int f1237_26(int x) { return x * 26; }
+inline int f1237_27(int x) { return x * 27; }
+inline int f1237_28(int x) { return x * 28; }
+inline int f1237_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1238 */
+#include <vector>
+#include "h5278.h"
+#include "h6970.h"
+#include "h993.h"
+#include "h9062.h"
+#include "h9854.h"
+#ifdef X
+#include "h1186.h"
+#endif
+struct S1238 { int a; const char *s = "x//y"; };
+inline int f1238_0(int x) { return x * 0; }
+inline int f1238_1(int x) { return x * 1; }
+inline int f1238_2(int x) { return x * 2; }
+inline int f1238_3(int x) { return x * 3; }
+inline int f1238_4(int x) { return x * 4; }
+inline int f1238_5(int x) { return x * 5; }
+inline int f1238_6(int x) { return x * 6; }
+inline int f1238_7(int x) { return x * 7; }
+inline int f1238_8(int x) { return x * 8; }
+inline int f1238_9(int x) { return x * 9; }
+inline int f1238_10(int x) { return x * 10; }
+inline int f1238_11(int x) { return x * 11; }
+inline int f1238_12(int x) { return x * 12; }
+inline int f1238_13(int x) { return x * 13; }
+inline int f1238_14(int x) { return x * 14; }
+inline int f1238_15(int x) { return x * 15; }
+inline int f1238_16(int x) { return x * 16; }
+inline int f1238_17(int x) { return x * 17; }
+inline int f1238_18(int x) { return x * 18; }
+inline int f1238_19(int x) { return x * 19; }
+inline int f1238_20(int x) { return x * 20; }
+inline int f1238_21(int x) { return x * 21; }
+inline int f1238_22(int x) { return x * 22; }
+inline int f1238_23(int x) { return x * 23; }
+inline int f1238_24(int x) { return x * 24; }
+inline int f1238_25(int x) { return x * 25; }
+inline int f1238_26(int x) { return x * 26; }
+inline int f1238_27(int x) { return x * 27; }
+inline int f1238_28(int x) { return x * 28; }
+inline int f1238_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1239 */
+#include <vector>
+#include "h9134.h"
+#include "h4735.h"
+#include "h9199.h"
+#include "h1641.h"
+#include "h175.h"
+#ifdef X
+#include "h4057.h"
+#endif
+struct S1239 { int a; const char *s = "x//y"; };
+inline int f1239_0(int x) { return x * 0; }
+inline int f1239_1(int x) { return x * 1; }
+inline int f1239_2(int x) { return x * 2; }
+inline int f1239_3(int x) { return x * 3; }
+inline int f1239_4(int x) { return x * 4; }
+inline int f1239_5(int x) { return x * 5; }
+inline int f1239_6(int x) { return x * 6; }
+inline int f1239_7(int x) { return x * 7; }
+inline int f1239_8(int x) { return x * 8; }
+inline int f1239_9(int x) { return x * 9; }
+inline int f1239_10(int x) { return x * 10; }
+inline int f1239_11(int x) { return x * 11; }
+inline int f1239_12(int x) { return x * 12; }
+inline int f1239_13(int x) { return x * 13; }
+inline int f1239_14(int x) { return x * 14; }
+inline int f1239_15(int x) { return x * 15; }
+inline int f1239_16(int x) { return x * 16; }
+inline int f1239_17(int x) { return x * 17; }
+inline int f1239_18(int x) { return x * 18; }
+inline int f1239_19(int x) { return x * 19; }
+inline int f1239_20(int x) { return x * 20; }
+inline int f1239_21(int x) { return x * 21; }
+inline int f1239_22(int x) { return x * 22; }
+inline int f1239_23(int x) { return x * 23; }
+inline int f1239_24(int x) { return x * 24; }
+inline int f1239_25(int x) { return x * 25; }
+inline int f1239_26(int x) { return x * 26; }
+inline int f1239_27(int x) { return x * 27; }
+inline int f1239_28(int x) { return x * 28; }
+inline int f1239_29(int x) { return x * 29; }
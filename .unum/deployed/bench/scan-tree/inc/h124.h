@@ -0,0 +1,42 @@
+#pragma once
+/* header 124 */
+#include <vector>
+#include "h6764.h"
+#include "h6033.h"
+#include "h5965.h"
+#include "h5761.h"
+#include "h3521.h"
+#ifdef X
+#include "h5730.h"
+#endif
+struct S124 { int a; const char *s = "x//y"; };
+inline int f124_0(int x) { return x * 0; }
+inline int f124_1(int x) { return x * 1; }
+inline int f124_2(int x) { return x * 2; }
+inline int f124_3(int x) { return x * 3; }
+inline int f124_4(int x) { return x * 4; }
+inline int f124_5(int x) { return x * 5; }
+inline int f124_6(int x) { return x * 6; }
+inline int f124_7(int x) { return x * 7; }
+inline int f124_8(int x) { return x * 8; }
+inline int f124_9(int x) { return x * 9; }
+inline int f124_10(int x) { return x * 10; }
+inline int f124_11(int x) { return x * 11; }
+inline int f124_12(int x) { return x * 12; }
+inline int f124_13(int x) { return x * 13; }
+inline int f124_14(int x) { return x * 14; }
+inline int f124_15(int x) { return x * 15; }
+inline int f124_16(int x) { return x * 16; }
+inline int f124_17(int x) { return x * 17; }
+inline int f124_18(int x) { return x * 18; }
+inline int f124_19(int x) { return x * 19; }
+inline int f124_20(int x) { return x * 20; }
+inline int f124_21(int x) { return x * 21; }
+inline int f124_22(int x) { return x * 22; }
+inline int f124_23(int x) { return x * 23; }
+inline int f124_24(int x) { return x * 24; }
+inline int f124_25(int x) { return x * 25; }
+inline int f124_26(int x) { return x * 26; }
+inline int f124_27(int x) { return x * 27; }
+inline int f124_28(int x) { return x * 28; }
+inline int f124_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1241 */
+#include <vector>
+#include "h6274.h"
+#include "h39.h"
+#include "h526.h"
+#include "h9142.h"
+#include "h6667.h"
+#ifdef X
+#include "h7253.h"
+#endif
+struct S1241 { int a; const char *s = "x//y"; };
+inline int f1241_0(int x) { return x * 0; }
+inline int f1241_1(int x) { return x * 1; }
+inline int f1241_2(int x) { return x * 2; }
+inline int f1241_3(int x) { return x * 3; }
+inline int f1241_4(int x) { return x * 4; }
+inline int f1241_5(int x) { return x * 5; }
+inline int f1241_6(int x) { return x * 6; }
+inline int f1241_7(int x) { return x * 7; }
+inline int f1241_8(int x) { return x * 8; }
+inline int f1241_9(int x) { return x * 9; }
+inline int f1241_10(int x) { return x * 10; }
+inline int f1241_11(int x) { return x * 11; }
+inline int f1241_12(int x) { return x * 12; }
+inline int f1241_13(int x) { return x * 13; }
+inline int f1241_14(int x) { return x * 14; }
+inline int f1241_15(int x) { return x * 15; }
+inline int f1241_16(int x) { return x * 16; }
+inline int f1241_17(int x) { return x * 17; }
+inline int f1241_18(int x) { return x * 18; }
+inline int f1241_19(int x) { return x * 19; }
+inline int f1241_20(int x) { return x * 20; }
+inline int f1241_21(int x) { return x * 21; }
+inline int f1241_22(int x) { return x * 22; }
+inline int f1241_23(int x) { return x * 23; }
+inline int f1241_24(int x) { return x * 24; }
+inline int f1241_25(int x) { return x * 25; }
+inline int f1241_26(int x) { return x * 26; }
+inline int f1241_27(int x) { return x * 27; }
+inline int f1241_28(int x) { return x * 28; }
+inline int f1241_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1244 */
+#include <vector>
+#include "h2469.h"
+#include "h1366.h"
+#include "h9754.h"
+#include "h7037.h"
+#include "h5981.h"
+#ifdef X
+#include "h1361.h"
+#endif
+struct S1244 { int a; const char *s = "x//y"; };
+inline int f1244_0(int x) { return x * 0; }
+inline int f1244_1(int x) { return x * 1; }
+inline int f1244_2(int x) { return x * 2; }
+inline int f1244_3(int x) { return x * 3; }
+inline int f1244_4(int x) { return x * 4; }
+inline int f1244_5(int x) { return x * 5; }
+inline int f1244_6(int x) { return x * 6; }
+inline int f1244_7(int x) { return x * 7; }
+inline int f1244_8(int x) { return x * 8; }
+inline int f1244_9(int x) { return x * 9; }
+inline int f1244_10(int x) { return x * 10; }
+inline int f1244_11(int x) { return x * 11; }
+inline int f1244_12(int x) { return x * 12; }
+inline int f1244_13(int x) { return x * 13; }
+inline int f1244_14(int x) { return x * 14; }
+inline int f1244_15(int x) { return x * 15; }
+inline int f1244_16(int x) { return x * 16; }
+inline int f1244_17(int x) { return x * 17; }
+inline int f1244_18(int x) { return x * 18; }
+inline int f1244_19(int x) { return x * 19; }
+inline int f1244_20(int x) { return x * 20; }
+inline int f1244_21(int x) { return x * 21; }
+inline int f1244_22(int x) { return x * 22; }
+inline int f1244_23(int x) { return x * 23; }
+inline int f1244_24(int x) { return x * 24; }
+inline int f1244_25(int x) { return x * 25; }
+inline int f1244_26(int x) { return x * 26; }
+inline int f1244_27(int x) { return x * 27; }
+inline int f1244_28(int x) { return x * 28; }
+inline int f1244_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1246 */
+#include <vector>
+#include "h3384.h"
+#include "h9541.h"
+#include "h2487.h"
+#include "h7572.h"
+#include "h5655.h"
+#ifdef X
+#include "h8238.h"
+#endif
+struct S1246 { int a; const char *s = "x//y"; };
+inline int f1246_0(int x) { return x * 0; }
+inline int f1246_1(int x) { return x * 1; }
+inline int f1246_2(int x) { return x * 2; }
+inline int f1246_3(int x) { return x * 3; }
+inline int f1246_4(int x) { return x * 4; }
+inline int f1246_5(int x) { return x * 5; }
+inline int f1246_6(int x) { return x * 6; }
+inline int f1246_7(int x) { return x * 7; }
+inline int f1246_8(int x) { return x * 8; }
+inline int f1246_9(int x) { return x * 9; }
+inline int f1246_10(int x) { return x * 10; }
+inline int f1246_11(int x) { return x * 11; }
+inline int f1246_12(int x) { return x * 12; }
+inline int f1246_13(int x) { return x * 13; }
+inline int f1246_14(int x) { return x * 14; }
+inline int f1246_15(int x) { return x * 15; }
+inline int f1246_16(int x) { return x * 16; }
+inline int f1246_17(int x) { return x * 17; }
+inline int f1246_18(int x) { return x * 18; }
+inline int f1246_19(int x) { return x * 19; }
+inline int f1246_20(int x) { return x * 20; }
+inline int f1246_21(int x) { return x * 21; }
+inline int f1246_22(int x) { return x * 22; }
+inline int f1246_23(int x) { return x * 23; }
+inline int f1246_24(int x) { return x * 24; }
+inline int f1246_25(int x) { return x * 25; }
+inline int f1246_26(int x) { return x * 26; }
+inline int f1246_27(int x) { return x * 27; }
+inline int f1246_28(int x) { return x * 28; }
+inline int f1246_29(int x) { return x * 29; }
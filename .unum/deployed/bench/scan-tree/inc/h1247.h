@@ -0,0 +1,42 @@
+#pragma once
+/* header 1247 */
+#include <vector>
+#include "h1255.h"
+#include "h1206.h"
+#include "h9577.h"
+#include "h5641.h"
+#include "h3236.h"
+#ifdef X
+#include "h1029.h"
+#endif
+struct S1247 { int a; const char *s = "x//y"; };
+inline int f1247_0(int x) { return x * 0; }
+inline int f1247_1(int x) { return x * 1; }
+inline int f1247_2(int x) { return x * 2; }
+inline int f1247_3(int x) { return x * 3; }
+inline int f1247_4(int x) { return x * 4; }
+inline int f1247_5(int x) { return x * 5; }
+inline int f1247_6(int x) { return x * 6; }
+inline int f1247_7(int x) { return x * 7; }
+inline int f1247_8(int x) { return x * 8; }
+inline int f1247_9(int x) { return x * 9; }
+inline int f1247_10(int x) { return x * 10; }
+inline int f1247_11(int x) { return x * 11; }
+inline int f1247_12(int x) { return x * 12; }
+inline int f1247_13(int x) { return x * 13; }
+inline int f1247_14(int x) { return x * 14; }
+inline int f1247_15(int x) { return x * 15; }
+inline int f1247_16(int x) { return x * 16; }
+inline int f1247_17(int x) { return x * 17; }
+inline int f1247_18(int x) { return x * 18; }
+inline int f1247_19(int x) { return x * 19; }
+inline int f1247_20(int x) { return x * 20; }
+inline int f1247_21(int x) { return x * 21; }
+inline int f1247_22(int x) { return x * 22; }
+inline int f1247_23(int x) { return x * 23; }
+inline int f1247_24(int x) { return x * 24; }
+inline int f1247_25(int x) { return x * 25; }
+inline int f1247_26(int x) { return x * 26; }
+inline int f1247_27(int x) { return x * 27; }
+inline int f1247_28(int x) { return x * 28; }
+inline int f1247_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1250 */
+#include <vector>
+#include "h3364.h"
+#include "h3901.h"
+#include "h1739.h"
+#include "h1566.h"
+#include "h3299.h"
+#ifdef X
+#include "h6729.h"
+#endif
+struct S1250 { int a; const char *s = "x//y"; };
+inline int f1250_0(int x) { return x * 0; }
+inline int f1250_1(int x) { return x * 1; }
+inline int f1250_2(int x) { return x * 2; }
+inline int f1250_3(int x) { return x * 3; }
+inline int f1250_4(int x) { return x * 4; }
+inline int f1250_5(int x) { return x * 5; }
+inline int f1250_6(int x) { return x * 6; }
+inline int f1250_7(int x) { return x * 7; }
+inline int f1250_8(int x) { return x * 8; }
+inline int f1250_9(int x) { return x * 9; }
+inline int f1250_10(int x) { return x * 10; }
+inline int f1250_11(int x) { return x * 11; }
+inline int f1250_12(int x) { return x * 12; }
+inline int f1250_13(int x) { return x * 13; }
+inline int f1250_14(int x) { return x * 14; }
+inline int f1250_15(int x) { return x * 15; }
+inline int f1250_16(int x) { return x * 16; }
+inline int f1250_17(int x) { return x * 17; }
+inline int f1250_18(int x) { return x * 18; }
+inline int f1250_19(int x) { return x * 19; }
+inline int f1250_20(int x) { return x * 20; }
+inline int f1250_21(int x) { return x * 21; }
+inline int f1250_22(int x) { return x * 22; }
+inline int f1250_23(int x) { return x * 23; }
+inline int f1250_24(int x) { return x * 24; }
+inline int f1250_25(int x) { return x * 25; }
+inline int f1250_26(int x) { return x * 26; }
+inline int f1250_27(int x) { return x * 27; }
+inline int f1250_28(int x) { return x * 28; }
+inline int f1250_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1251 */
+#include <vector>
+#include "h5489.h"
+#include "h2837.h"
+#include "h7216.h"
+#include "h1294.h"
+#include "h6600.h"
+#ifdef X
+#include "h2964.h"
+#endif
+struct S1251 { int a; const char *s = "x//y"; };
+inline int f1251_0(int x) { return x * 0; }
+inline int f1251_1(int x) { return x * 1; }
+inline int f1251_2(int x) { return x * 2; }
+inline int f1251_3(int x) { return x * 3; }
+inline int f1251_4(int x) { return x * 4; }
+inline int f1251_5(int x) { return x * 5; }
+inline int f1251_6(int x) { return x * 6; }
+inline int f1251_7(int x) { return x * 7; }
+inline int f1251_8(int x) { return x * 8; }
+inline int f1251_9(int x) { return x * 9; }
+inline int f1251_10(int x) { return x * 10; }
+inline int f1251_11(int x) { return x * 11; }
+inline int f1251_12(int x) { return x * 12; }
+inline int f1251_13(int x) { return x * 13; }
+inline int f1251_14(int x) { return x * 14; }
+inline int f1251_15(int x) { return x * 15; }
+inline int f1251_16(int x) { return x * 16; }
+inline int f1251_17(int x) { return x * 17; }
+inline int f1251_18(int x) { return x * 18; }
+inline int f1251_19(int x) { return x * 19; }
+inline int f1251_20(int x) { return x * 20; }
+inline int f1251_21(int x) { return x * 21; }
+inline int f1251_22(int x) { return x * 22; }
+inline int f1251_23(int x) { return x * 23; }
+inline int f1251_24(int x) { return x * 24; }
+inline int f1251_25(int x) { return x * 25; }
+inline int f1251_26(int x) { return x * 26; }
+inline int f1251_27(int x) { return x * 27; }
+inline int f1251_28(int x) { return x * 28; }
+inline int f1251_29(int x) { return x * 29; }
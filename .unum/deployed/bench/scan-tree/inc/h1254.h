@@ -0,0 +1,42 @@
+#pragma once
+/* header 1254 */
+#include <vector>
+#include "h9397.h"
+#include "h593.h"
+#include "h7715.h"
+#include "h512.h"
+#include "h4626.h"
+#ifdef X
+#include "h4915.h"
+#endif
+struct S1254 { int a; const char *s = "x//y"; };
+inline int f1254_0(int x) { return x * 0; }
+inline int f1254_1(int x) { return x * 1; }
+inline int f1254_2(int x) { return x * 2; }
+inline int f1254_3(int x) { return x * 3; }
+inline int f1254_4(int x) { return x * 4; }
+inline int f1254_5(int x) { return x * 5; }
+inline int f1254_6(int x) { return x * 6; }
+inline int f1254_7(int x) { return x * 7; }
+inline int f1254_8(int x) { return x * 8; }
+inline int f1254_9(int x) { return x * 9; }
+inline int f1254_10(int x) { return x * 10; }
+inline int f1254_11(int x) { return x * 11; }
+inline int f1254_12(int x) { return x * 12; }
+inline int f1254_13(int x) { return x * 13; }
+inline int f1254_14(int x) { return x * 14; }
+inline int f1254_15(int x) { return x * 15; }
+inline int f1254_16(int x) { return x * 16; }
+inline int f1254_17(int x) { return x * 17; }
+inline int f1254_18(int x) { return x * 18; }
+inline int f1254_19(int x) { return x * 19; }
+inline int f1254_20(int x) { return x * 20; }
+inline int f1254_21(int x) { return x * 21; }
+inline int f1254_22(int x) { return x * 22; }
+inline int f1254_23(int x) { return x * 23; }
+inline int f1254_24(int x) { return x * 24; }
+inline int f1254_25(int x) { return x * 25; }
+inline int f1254_26(int x) { return x * 26; }
+inline int f1254_27(int x) { return x * 27; }
+inline int f1254_28(int x) { return x * 28; }
+inline int f1254_29(int x) { return x * 29; }
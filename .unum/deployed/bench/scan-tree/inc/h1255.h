@@ -0,0 +1,42 @@
+#pragma once
+/* header 1255 */
+#include <vector>
+#include "h2191.h"
+#include "h9472.h"
+#include "h7623.h"
+#include "h8382.h"
+#include "h7677.h"
+#ifdef X
+#include "h5516.h"
+#endif
+struct S1255 { int a; const char *s = "x//y"; };
+inline int f1255_0(int x) { return x * 0; }
+inline int f1255_1(int x) { return x * 1; }
+inline int f1255_2(int x) { return x * 2; }
+inline int f1255_3(int x) { return x * 3; }
+inline int f1255_4(int x) { return x * 4; }
+inline int f1255_5(int x) { return x * 5; }
+inline int f1255_6(int x) { return x * 6; }
+inline int f1255_7(int x) { return x * 7; }
+inline int f1255_8(int x) { return x * 8; }
+inline int f1255_9(int x) { return x * 9; }
+inline int f1255_10(int x) { return x * 10; }
+inline int f1255_11(int x) { return x * 11; }
+inline int f1255_12(int x) { return x * 12; }
+inline int f1255_13(int x) { return x * 13; }
+inline int f1255_14(int x) { return x * 14; }
+inline int f1255_15(int x) { return x * 15; }
+inline int f1255_16(int x) { return x * 16; }
+inline int f1255_17(int x) { return x * 17; }
+inline int f1255_18(int x) { return x * 18; }
+inline int f1255_19(int x) { return x * 19; }
+inline int f1255_20(int x) { return x * 20; }
+inline int f1255_21(int x) { return x * 21; }
+inline int f1255_22(int x) { return x * 22; }
+inline int f1255_23(int x) { return x * 23; }
+inline int f1255_24(int x) { return x * 24; }
+inline int f1255_25(int x) { return x * 25; }
+inline int f1255_26(int x) { return x * 26; }
+inline int f1255_27(int x) { return x * 27; }
+inline int f1255_28(int x) { return x * 28; }
+inline int f1255_29(int x) { return x * 29; }
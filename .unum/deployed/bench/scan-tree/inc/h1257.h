@@ -0,0 +1,42 @@
+#pragma once
+/* header 1257 */
+#include <vector>
+#include "h561.h"
+#include "h5885.h"
+#include "h8287.h"
+#include "h8306.h"
+#include "h5377.h"
+#ifdef X
+#include "h6024.h"
+#endif
+struct S1257 { int a; const char *s = "x//y"; };
+inline int f1257_0(int x) { return x * 0; }
+inline int f1257_1(int x) { return x * 1; }
+inline int f1257_2(int x) { return x * 2; }
+inline int f1257_3(int x) { return x * 3; }
+inline int f1257_4(int x) { return x * 4; }
+inline int f1257_5(int x) { return x * 5; }
+inline int f1257_6(int x) { return x * 6; }
+inline int f1257_7(int x) { return x * 7; }
+inline int f1257_8(int x) { return x * 8; }
+inline int f1257_9(int x) { return x * 9; }
+inline int f1257_10(int x) { return x * 10; }
+inline int f1257_11(int x) { return x * 11; }
+inline int f1257_12(int x) { return x * 12; }
+inline int f1257_13(int x) { return x * 13; }
+inline int f1257_14(int x) { return x * 14; }
+inline int f1257_15(int x) { return x * 15; }
+inline int f1257_16(int x) { return x * 16; }
+inline int f1257_17(int x) { return x * 17; }
+inline int f1257_18(int x) { return x * 18; }
+inline int f1257_19(int x) { return x * 19; }
+inline int f1257_20(int x) { return x * 20; }
+inline int f1257_21(int x) { return x * 21; }
+inline int f1257_22(int x) { return x * 22; }
+inline int f1257_23(int x) { return x * 23; }
+inline int f1257_24(int x) { return x * 24; }
+inline int f1257_25(int x) { return x * 25; }
+inline int f1257_26(int x) { return x * 26; }
+inline int f1257_27(int x) { return x * 27; }
+inline int f1257_28(int x) { return x * 28; }
+inline int f1257_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1259 */
+#include <vector>
+#include "h239.h"
+#include "h8698.h"
+#include "h1219.h"
+#include "h3329.h"
+#include "h8491.h"
+#ifdef X
+#include "h426.h"
+#endif
+struct S1259 { int a; const char *s = "x//y"; };
+inline int f1259_0(int x) { return x * 0; }
+inline int f1259_1(int x) { return x * 1; }
+inline int f1259_2(int x) { return x * 2; }
+inline int f1259_3(int x) { return x * 3; }
+inline int f1259_4(int x) { return x * 4; }
+inline int f1259_5(int x) { return x * 5; }
+inline int f1259_6(int x) { return x * 6; }
+inline int f1259_7(int x) { return x * 7; }
+inline int f1259_8(int x) { return x * 8; }
+inline int f1259_9(int x) { return x * 9; }
+inline int f1259_10(int x) { return x * 10; }
+inline int f1259_11(int x) { return x * 11; }
+inline int f1259_12(int x) { return x * 12; }
+inline int f1259_13(int x) { return x * 13; }
+inline int f1259_14(int x) { return x * 14; }
+inline int f1259_15(int x) { return x * 15; }
+inline int f1259_16(int x) { return x * 16; }
+inline int f1259_17(int x) { return x * 17; }
+inline int f1259_18(int x) { return x * 18; }
+inline int f1259_19(int x) { return x * 19; }
+inline int f1259_20(int x) { return x * 20; }
+inline int f1259_21(int x) { return x * 21; }
+inline int f1259_22(int x) { return x * 22; }
+inline int f1259_23(int x) { return x * 23; }
+inline int f1259_24(int x) { return x * 24; }
+inline int f1259_25(int x) { return x * 25; }
+inline int f1259_26(int x) { return x * 26; }
+inline int f1259_27(int x) { return x * 27; }
+inline int f1259_28(int x) { return x * 28; }
+inline int f1259_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1265 */
+#include <vector>
+#include "h7493.h"
+#include "h7772.h"
+#include "h1391.h"
+#include "h2542.h"
+#include "h1494.h"
+#ifdef X
+#include "h1253.h"
+#endif
+struct S1265 { int a; const char *s = "x//y"; };
+inline int f1265_0(int x) { return x * 0; }
+inline int f1265_1(int x) { return x * 1; }
+inline int f1265_2(int x) { return x * 2; }
+inline int f1265_3(int x) { return x * 3; }
+inline int f1265_4(int x) { return x * 4; }
+inline int f1265_5(int x) { return x * 5; }
+inline int f1265_6(int x) { return x * 6; }
+inline int f1265_7(int x) { return x * 7; }
+inline int f1265_8(int x) { return x * 8; }
+inline int f1265_9(int x) { return x * 9; }
+inline int f1265_10(int x) { return x * 10; }
+inline int f1265_11(int x) { return x * 11; }
+inline int f1265_12(int x) { return x * 12; }
+inline int f1265_13(int x) { return x * 13; }
+inline int f1265_14(int x) { return x * 14; }
+inline int f1265_15(int x) { return x * 15; }
+inline int f1265_16(int x) { return x * 16; }
+inline int f1265_17(int x) { return x * 17; }
+inline int f1265_18(int x) { return x * 18; }
+inline int f1265_19(int x) { return x * 19; }
+inline int f1265_20(int x) { return x * 20; }
+inline int f1265_21(int x) { return x * 21; }
+inline int f1265_22(int x) { return x * 22; }
+inline int f1265_23(int x) { return x * 23; }
+inline int f1265_24(int x) { return x * 24; }
+inline int f1265_25(int x) { return x * 25; }
+inline int f1265_26(int x) { return x * 26; }
+inline int f1265_27(int x) { return x * 27; }
+inline int f1265_28(int x) { return x * 28; }
+inline int f1265_29(int x) { return x * 29; }
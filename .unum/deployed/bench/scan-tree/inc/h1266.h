@@ -0,0 +1,42 @@
+#pragma once
+/* header 1266 */
+#include <vector>
+#include "h572.h"
+#include "h8281.h"
+#include "h8243.h"
+#include "h9844.h"
+#include "h4904.h"
+#ifdef X
+#include "h2735.h"
+#endif
+struct S1266 { int a; const char *s = "x//y"; };
+inline int f1266_0(int x) { return x * 0; }
+inline int f1266_1(int x) { return x * 1; }
+inline int f1266_2(int x) { return x * 2; }
+inline int f1266_3(int x) { return x * 3; }
+inline int f1266_4(int x) { return x * 4; }
+inline int f1266_5(int x) { return x * 5; }
+inline int f1266_6(int x) { return x * 6; }
+inline int f1266_7(int x) { return x * 7; }
+inline int f1266_8(int x) { return x * 8; }
+inline int f1266_9(int x) { return x * 9; }
+inline int f1266_10(int x) { return x * 10; }
+inline int f1266_11(int x) { return x * 11; }
+inline int f1266_12(int x) { return x * 12; }
+inline int f1266_13(int x) { return x * 13; }
+inline int f1266_14(int x) { return x * 14; }
+inline int f1266_15(int x) { return x * 15; }
+inline int f1266_16(int x) { return x * 16; }
+inline int f1266_17(int x) { return x * 17; }
+inline int f1266_18(int x) { return x * 18; }
+inline int f1266_19(int x) { return x * 19; }
+inline int f1266_20(int x) { return x * 20; }
+inline int f1266_21(int x) { return x * 21; }
+inline int f1266_22(int x) { return x * 22; }
+inline int f1266_23(int x) { return x * 23; }
+inline int f1266_24(int x) { return x * 24; }
+inline int f1266_25(int x) { return x * 25; }
+inline int f1266_26(int x) { return x * 26; }
+inline int f1266_27(int x) { return x * 27; }
+inline int f1266_28(int x) { return x * 28; }
+inline int f1266_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1269 */
+#include <vector>
+#include "h3025.h"
+#include "h606.h"
+#include "h3560.h"
+#include "h717.h"
+#include "h7244.h"
+#ifdef X
+#include "h7309.h"
+#endif
+struct S1269 { int a; const char *s = "x//y"; };
+inline int f1269_0(int x) { return x * 0; }
+inline int f1269_1(int x) { return x * 1; }
+inline int f1269_2(int x) { return x * 2; }
+inline int f1269_3(int x) { return x * 3; }
+inline int f1269_4(int x) { return x * 4; }
+inline int f1269_5(int x) { return x * 5; }
+inline int f1269_6(int x) { return x * 6; }
+inline int f1269_7(int x) { return x * 7; }
+inline int f1269_8(int x) { return x * 8; }
+inline int f1269_9(int x) { return x * 9; }
+inline int f1269_10(int x) { return x * 10; }
+inline int f1269_11(int x) { return x * 11; }
+inline int f1269_12(int x) { return x * 12; }
+inline int f1269_13(int x) { return x * 13; }
+inline int f1269_14(int x) { return x * 14; }
+inline int f1269_15(int x) { return x * 15; }
+inline int f1269_16(int x) { return x * 16; }
+inline int f1269_17(int x) { return x * 17; }
+inline int f1269_18(int x) { return x * 18; }
+inline int f1269_19(int x) { return x * 19; }
+inline int f1269_20(int x) { return x * 20; }
+inline int f1269_21(int x) { return x * 21; }
+inline int f1269_22(int x) { return x * 22; }
+inline int f1269_23(int x) { return x * 23; }
+inline int f1269_24(int x) { return x * 24; }
+inline int f1269_25(int x) { return x * 25; }
+inline int f1269_26(int x) { return x * 26; }
+inline int f1269_27(int x) { return x * 27; }
+inline int f1269_28(int x) { return x * 28; }
+inline int f1269_29(int x) { return x * 29; }
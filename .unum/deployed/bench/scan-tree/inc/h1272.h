@@ -0,0 +1,42 @@
+#pragma once
+/* header 1272 */
+#include <vector>
+#include "h7657.h"
+#include "h1597.h"
+#include "h6833.h"
+#include "h4534.h"
+#include "h9778.h"
+#ifdef X
+#include "h4791.h"
+#endif
+struct S1272 { int a; const char *s = "x//y"; };
+inline int f1272_0(int x) { return x * 0; }
+inline int f1272_1(int x) { return x * 1; }
+inline int f1272_2(int x) { return x * 2; }
+inline int f1272_3(int x) { return x * 3; }
+inline int f1272_4(int x) { return x * 4; }
+inline int f1272_5(int x) { return x * 5; }
+inline int f1272_6(int x) { return x * 6; }
+inline int f1272_7(int x) { return x * 7; }
+inline int f1272_8(int x) { return x * 8; }
+inline int f1272_9(int x) { return x * 9; }
+inline int f1272_10(int x) { return x * 10; }
+inline int f1272_11(int x) { return x * 11; }
+inline int f1272_12(int x) { return x * 12; }
+inline int f1272_13(int x) { return x * 13; }
+inline int f1272_14(int x) { return x * 14; }
+inline int f1272_15(int x) { return x * 15; }
+inline int f1272_16(int x) { return x * 16; }
+inline int f1272_17(int x) { return x * 17; }
+inline int f1272_18(int x) { return x * 18; }
+inline int f1272_19(int x) { return x * 19; }
+inline int f1272_20(int x) { return x * 20; }
+inline int f1272_21(int x) { return x * 21; }
+inline int f1272_22(int x) { return x * 22; }
+inline int f1272_23(int x) { return x * 23; }
+inline int f1272_24(int x) { return x * 24; }
+inline int f1272_25(int x) { return x * 25; }
+inline int f1272_26(int x) { return x * 26; }
+inline int f1272_27(int x) { return x * 27; }
+inline int f1272_28(int x) { return x * 28; }
+inline int f1272_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1276 */
+#include <vector>
+#include "h4994.h"
+#include "h4231.h"
+#include "h8927.h"
+#include "h8844.h"
+#include "h437.h"
+#ifdef X
+#include "h214.h"
+#endif
+struct S1276 { int a; const char *s = "x//y"; };
+inline int f1276_0(int x) { return x * 0; }
+inline int f1276_1(int x) { return x * 1; }
+inline int f1276_2(int x) { return x * 2; }
+inline int f1276_3(int x) { return x * 3; }
+inline int f1276_4(int x) { return x * 4; }
+inline int f1276_5(int x) { return x * 5; }
+inline int f1276_6(int x) { return x * 6; }
+inline int f1276_7(int x) { return x * 7; }
+inline int f1276_8(int x) { return x * 8; }
+inline int f1276_9(int x) { return x * 9; }
+inline int f1276_10(int x) { return x * 10; }
+inline int f1276_11(int x) { return x * 11; }
+inline int f1276_12(int x) { return x * 12; }
+inline int f1276_13(int x) { return x * 13; }
+inline int f1276_14(int x) { return x * 14; }
+inline int f1276_15(int x) { return x * 15; }
+inline int f1276_16(int x) { return x * 16; }
+inline int f1276_17(int x) { return x * 17; }
+inline int f1276_18(int x) { return x * 18; }
+inline int f1276_19(int x) { return x * 19; }
+inline int f1276_20(int x) { return x * 20; }
+inline int f1276_21(int x) { return x * 21; }
+inline int f1276_22(int x) { return x * 22; }
+inline int f1276_23(int x) { return x * 23; }
+inline int f1276_24(int x) { return x * 24; }
+inline int f1276_25(int x) { return x * 25; }
+inline int f1276_26(int x) { return x * 26; }
+inline int f1276_27(int x) { return x * 27; }
+inline int f1276_28(int x) { return x * 28; }
+inline int f1276_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1279 */
+#include <vector>
+#include "h4585.h"
+#include "h4081.h"
+#include "h2301.h"
+#include "h5108.h"
+#include "h3702.h"
+#ifdef X
+#include "h6765.h"
+#endif
+struct S1279 { int a; const char *s = "x//y"; };
+inline int f1279_0(int x) { return x * 0; }
+inline int f1279_1(int x) { return x * 1; }
+inline int f1279_2(int x) { return x * 2; }
+inline int f1279_3(int x) { return x * 3; }
+inline int f1279_4(int x) { return x * 4; }
+inline int f1279_5(int x) { return x * 5; }
+inline int f1279_6(int x) { return x * 6; }
+inline int f1279_7(int x) { return x * 7; }
+inline int f1279_8(int x) { return x * 8; }
+inline int f1279_9(int x) { return x * 9; }
+inline int f1279_10(int x) { return x * 10; }
+inline int f1279_11(int x) { return x * 11; }
+inline int f1279_12(int x) { return x * 12; }
+inline int f1279_13(int x) { return x * 13; }
+inline int f1279_14(int x) { return x * 14; }
+inline int f1279_15(int x) { return x * 15; }
+inline int f1279_16(int x) { return x * 16; }
+inline int f1279_17(int x) { return x * 17; }
+inline int f1279_18(int x) { return x * 18; }
+inline int f1279_19(int x) { return x * 19; }
+inline int f1279_20(int x) { return x * 20; }
+inline int f1279_21(int x) { return x * 21; }
+inline int f1279_22(int x) { return x * 22; }
+inline int f1279_23(int x) { return x * 23; }
+inline int f1279_24(int x) { return x * 24; }
+inline int f1279_25(int x) { return x * 25; }
+inline int f1279_26(int x) { return x * 26; }
+inline int f1279_27(int x) { return x * 27; }
+inline int f1279_28(int x) { return x * 28; }
+inline int f1279_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1281 */
+#include <vector>
+#include "h8419.h"
+#include "h1902.h"
+#include "h1878.h"
+#include "h3757.h"
+#include "h6467.h"
+#ifdef X
+#include "h4964.h"
+#endif
+struct S1281 { int a; const char *s = "x//y"; };
+inline int f1281_0(int x) { return x * 0; }
+inline int f1281_1(int x) { return x * 1; }
+inline int f1281_2(int x) { return x * 2; }
+inline int f1281_3(int x) { return x * 3; }
+inline int f1281_4(int x) { return x * 4; }
+inline int f1281_5(int x) { return x * 5; }
+inline int f1281_6(int x) { return x * 6; }
+inline int f1281_7(int x) { return x * 7; }
+inline int f1281_8(int x) { return x * 8; }
+inline int f1281_9(int x) { return x * 9; }
+inline int f1281_10(int x) { return x * 10; }
+inline int f1281_11(int x) { return x * 11; }
+inline int f1281_12(int x) { return x * 12; }
+inline int f1281_13(int x) { return x * 13; }
+inline int f1281_14(int x) { return x * 14; }
+inline int f1281_15(int x) { return x * 15; }
+inline int f1281_16(int x) { return x * 16; }
+inline int f1281_17(int x) { return x * 17; }
+inline int f1281_18(int x) { return x * 18; }
+inline int f1281_19(int x) { return x * 19; }
+inline int f1281_20(int x) { return x * 20; }
+inline int f1281_21(int x) { return x * 21; }
+inline int f1281_22(int x) { return x * 22; }
+inline int f1281_23(int x) { return x * 23; }
+inline int f1281_24(int x) { return x * 24; }
+inline int f1281_25(int x) { return x * 25; }
+inline int f1281_26(int x) { return x * 26; }
+inline int f1281_27(int x) { return x * 27; }
+inline int f1281_28(int x) { return x * 28; }
+inline int f1281_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1282 */
+#include <vector>
+#include "h5130.h"
+#include "h1509.h"
+#include "h2835.h"
+#include "h7799.h"
+#include "h4567.h"
+#ifdef X
+#include "h4836.h"
+#endif
+struct S1282 { int a; const char *s = "x//y"; };
+inline int f1282_0(int x) { return x * 0; }
+inline int f1282_1(int x) { return x * 1; }
+inline int f1282_2(int x) { return x * 2; }
+inline int f1282_3(int x) { return x * 3; }
+inline int f1282_4(int x) { return x * 4; }
+inline int f1282_5(int x) { return x * 5; }
+inline int f1282_6(int x) { return x * 6; }
+inline int f1282_7(int x) { return x * 7; }
+inline int f1282_8(int x) { return x * 8; }
+inline int f1282_9(int x) { return x * 9; }
+inline int f1282_10(int x) { return x * 10; }
+inline int f1282_11(int x) { return x * 11; }
+inline int f1282_12(int x) { return x * 12; }
+inline int f1282_13(int x) { return x * 13; }
+inline int f1282_14(int x) { return x * 14; }
+inline int f1282_15(int x) { return x * 15; }
+inline int f1282_16(int x) { return x * 16; }
+inline int f1282_17(int x) { return x * 17; }
+inline int f1282_18(int x) { return x * 18; }
+inline int f1282_19(int x) { return x * 19; }
+inline int f1282_20(int x) { return x * 20; }
+inline int f1282_21(int x) { return x * 21; }
+inline int f1282_22(int x) { return x * 22; }
+inline int f1282_23(int x) { return x * 23; }
+inline int f1282_24(int x) { return x * 24; }
+inline int f1282_25(int x) { return x * 25; }
+inline int f1282_26(int x) { return x * 26; }
+inline int f1282_27(int x) { return x * 27; }
+inline int f1282_28(int x) { return x * 28; }
+inline int f1282_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1285 */
+#include <vector>
+#include "h2479.h"
+#include "h2510.h"
+#include "h705.h"
+#include "h5752.h"
+#include "h163.h"
+#ifdef X
+#include "h3275.h"
+#endif
+struct S1285 { int a; const char *s = "x//y"; };
+inline int f1285_0(int x) { return x * 0; }
+inline int f1285_1(int x) { return x * 1; }
+inline int f1285_2(int x) { return x * 2; }
+inline int f1285_3(int x) { return x * 3; }
+inline int f1285_4(int x) { return x * 4; }
+inline int f1285_5(int x) { return x * 5; }
+inline int f1285_6(int x) { return x * 6; }
+inline int f1285_7(int x) { return x * 7; }
+inline int f1285_8(int x) { return x * 8; }
+inline int f1285_9(int x) { return x * 9; }
+inline int f1285_10(int x) { return x * 10; }
+inline int f1285_11(int x) { return x * 11; }
+inline int f1285_12(int x) { return x * 12; }
+inline int f1285_13(int x) { return x * 13; }
+inline int f1285_14(int x) { return x * 14; }
+inline int f1285_15(int x) { return x * 15; }
+inline int f1285_16(int x) { return x * 16; }
+inline int f1285_17(int x) { return x * 17; }
+inline int f1285_18(int x) { return x * 18; }
+inline int f1285_19(int x) { return x * 19; }
+inline int f1285_20(int x) { return x * 20; }
+inline int f1285_21(int x) { return x * 21; }
+inline int f1285_22(int x) { return x * 22; }
+inline int f1285_23(int x) { return x * 23; }
+inline int f1285_24(int x) { return x * 24; }
+inline int f1285_25(int x) { return x * 25; }
+inline int f1285_26(int x) { return x * 26; }
+inline int f1285_27(int x) { return x * 27; }
+inline int f1285_28(int x) { return x * 28; }
+inline int f1285_29(int x) { return x * 29; }
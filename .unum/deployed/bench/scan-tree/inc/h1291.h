@@ -0,0 +1,42 @@
+#pragma once
+/* header 1291 */
+#include <vector>
+#include "h418.h"
+#include "h4145.h"
+#include "h427.h"
+#include "h3085.h"
+#include "h3865.h"
+#ifdef X
+#include "h3927.h"
+#endif
+struct S1291 { int a; const char *s = "x//y"; };
+inline int f1291_0(int x) { return x * 0; }
+inline int f1291_1(int x) { return x * 1; }
+inline int f1291_2(int x) { return x * 2; }
+inline int f1291_3(int x) { return x * 3; }
+inline int f1291_4(int x) { return x * 4; }
+inline int f1291_5(int x) { return x * 5; }
+inline int f1291_6(int x) { return x * 6; }
+inline int f1291_7(int x) { return x * 7; }
+inline int f1291_8(int x) { return x * 8; }
+inline int f1291_9(int x) { return x * 9; }
+inline int f1291_10(int x) { return x * 10; }
+inline int f1291_11(int x) { return x * 11; }
+inline int f1291_12(int x) { return x * 12; }
+inline int f1291_13(int x) { return x * 13; }
+inline int f1291_14(int x) { return x * 14; }
+inline int f1291_15(int x) { return x * 15; }
+inline int f1291_16(int x) { return x * 16; }
+inline int f1291_17(int x) { return x * 17; }
+inline int f1291_18(int x) { return x * 18; }
+inline int f1291_19(int x) { return x * 19; }
+inline int f1291_20(int x) { return x * 20; }
+inline int f1291_21(int x) { return x * 21; }
+inline int f1291_22(int x) { return x * 22; }
+inline int f1291_23(int x) { return x * 23; }
+inline int f1291_24(int x) { return x * 24; }
+inline int f1291_25(int x) { return x * 25; }
+inline int f1291_26(int x) { return x * 26; }
+inline int f1291_27(int x) { return x * 27; }
+inline int f1291_28(int x) { return x * 28; }
+inline int f1291_29(int x) { return x * 29; }
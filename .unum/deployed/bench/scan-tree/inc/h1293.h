@@ -0,0 +1,42 @@
+#pragma once
+/* header 1293 */
+#include <vector>
+#include "h8519.h"
+#include "h8160.h"
+#include "h1049.h"
+#include "h189.h"
+#include "h9700.h"
+#ifdef X
+#include "h7921.h"
+#endif
+struct S1293 { int a; const char *s = "x//y"; };
+inline int f1293_0(int x) { return x * 0; }
+inline int f1293_1(int x) { return x * 1; }
+inline int f1293_2(int x) { return x * 2; }
+inline int f1293_3(int x) { return x * 3; }
+inline int f1293_4(int x) { return x * 4; }
+inline int f1293_5(int x) { return x * 5; }
+inline int f1293_6(int x) { return x * 6; }
+inline int f1293_7(int x) { return x * 7; }
+inline int f1293_8(int x) { return x * 8; }
+inline int f1293_9(int x) { return x * 9; }
+inline int f1293_10(int x) { return x * 10; }
+inline int f1293_11(int x) { return x * 11; }
+inline int f1293_12(int x) { return x * 12; }
+inline int f1293_13(int x) { return x * 13; }
+inline int f1293_14(int x) { return x * 14; }
+inline int f1293_15(int x) { return x * 15; }
+inline int f1293_16(int x) { return x * 16; }
+inline int f1293_17(int x) { return x * 17; }
+inline int f1293_18(int x) { return x * 18; }
+inline int f1293_19(int x) { return x * 19; }
+inline int f1293_20(int x) { return x * 20; }
+inline int f1293_21(int x) { return x * 21; }
+inline int f1293_22(int x) { return x * 22; }
+inline int f1293_23(int x) { return x * 23; }
+inline int f1293_24(int x) { return x * 24; }
+inline int f1293_25(int x) { return x * 25; }
+inline int f1293_26(int x) { return x * 26; }
+inline int f1293_27(int x) { return x * 27; }
+inline int f1293_28(int x) { return x * 28; }
+inline int f1293_29(int x) { return x * 29; }
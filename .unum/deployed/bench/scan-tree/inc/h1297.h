@@ -0,0 +1,42 @@
+#pragma once
+/* header 1297 */
+#include <vector>
+#include "h5766.h"
+#include "h9969.h"
+#include "h7267.h"
+#include "h6935.h"
+#include "h1861.h"
+#ifdef X
+#include "h1236.h"
+#endif
+struct S1297 { int a; const char *s = "x//y"; };
+inline int f1297_0(int x) { return x * 0; }
+inline int f1297_1(int x) { return x * 1; }
+inline int f1297_2(int x) { return x * 2; }
+inline int f1297_3(int x) { return x * 3; }
+inline int f1297_4(int x) { return x * 4; }
+inline int f1297_5(int x) { return x * 5; }
+inline int f1297_6(int x) { return x * 6; }
+inline int f1297_7(int x) { return x * 7; }
+inline int f1297_8(int x) { return x * 8; }
+inline int f1297_9(int x) { return x * 9; }
+inline int f1297_10(int x) { return x * 10; }
+inline int f1297_11(int x) { return x * 11; }
+inline int f1297_12(int x) { return x * 12; }
+inline int f1297_13(int x) { return x * 13; }
+inline int f1297_14(int x) { return x * 14; }
+inline int f1297_15(int x) { return x * 15; }
+inline int f1297_16(int x) { return x * 16; }
+inline int f1297_17(int x) { return x * 17; }
+inline int f1297_18(int x) { return x * 18; }
+inline int f1297_19(int x) { return x * 19; }
+inline int f1297_20(int x) { return x * 20; }
+inline int f1297_21(int x) { return x * 21; }
+inline int f1297_22(int x) { return x * 22; }
+inline int f1297_23(int x) { return x * 23; }
+inline int f1297_24(int x) { return x * 24; }
+inline int f1297_25(int x) { return x * 25; }
+inline int f1297_26(int x) { return x * 26; }
+inline int f1297_27(int x) { return x * 27; }
+inline int f1297_28(int x) { return x * 28; }
+inline int f1297_29(int x) { return x * 29; }
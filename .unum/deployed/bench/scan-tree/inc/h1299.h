@@ -0,0 +1,42 @@
+#pragma once
+/* header 1299 */
+#include <vector>
+#include "h2012.h"
+#include "h5189.h"
+#include "h8590.h"
+#include "h7799.h"
+#include "h7637.h"
+#ifdef X
+#include "h6591.h"
+#endif
+struct S1299 { int a; const char *s = "x//y"; };
+inline int f1299_0(int x) { return x * 0; }
+inline int f1299_1(int x) { return x * 1; }
+inline int f1299_2(int x) { return x * 2; }
+inline int f1299_3(int x) { return x * 3; }
+inline int f1299_4(int x) { return x * 4; }
+inline int f1299_5(int x) { return x * 5; }
+inline int f1299_6(int x) { return x * 6; }
+inline int f1299_7(int x) { return x * 7; }
+inline int f1299_8(int x) { return x * 8; }
+inline int f1299_9(int x) { return x * 9; }
+inline int f1299_10(int x) { return x * 10; }
+inline int f1299_11(int x) { return x * 11; }
+inline int f1299_12(int x) { return x * 12; }
+inline int f1299_13(int x) { return x * 13; }
+inline int f1299_14(int x) { return x * 14; }
+inline int f1299_15(int x) { return x * 15; }
+inline int f1299_16(int x) { return x * 16; }
+inline int f1299_17(int x) { return x * 17; }
+inline int f1299_18(int x) { return x * 18; }
+inline int f1299_19(int x) { return x * 19; }
+inline int f1299_20(int x) { return x * 20; }
+inline int f1299_21(int x) { return x * 21; }
+inline int f1299_22(int x) { return x * 22; }
+inline int f1299_23(int x) { return x * 23; }
+inline int f1299_24(int x) { return x * 24; }
+inline int f1299_25(int x) { return x * 25; }
+inline int f1299_26(int x) { return x * 26; }
+inline int f1299_27(int x) { return x * 27; }
+inline int f1299_28(int x) { return x * 28; }
+inline int f1299_29(int x) { return x * 29; }
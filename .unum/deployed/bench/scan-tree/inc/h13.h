@@ -0,0 +1,42 @@
+#pragma once
+/* header 13 */
+#include <vector>
+#include "h343.h"
+#include "h1940.h"
+#include "h3466.h"
+#include "h9214.h"
+#include "h8765.h"
+#ifdef X
+#include "h7533.h"
+#endif
+struct S13 { int a; const char *s = "x//y"; };
+inline int f13_0(int x) { return x * 0; }
+inline int f13_1(int x) { return x * 1; }
+inline int f13_2(int x) { return x * 2; }
+inline int f13_3(int x) { return x * 3; }
+inline int f13_4(int x) { return x * 4; }
+inline int f13_5(int x) { return x * 5; }
+inline int f13_6(int x) { return x * 6; }
+inline int f13_7(int x) { return x * 7; }
+inline int f13_8(int x) { return x * 8; }
+inline int f13_9(int x) { return x * 9; }
+inline int f13_10(int x) { return x * 10; }
+inline int f13_11(int x) { return x * 11; }
+inline int f13_12(int x) { return x * 12; }
+inline int f13_13(int x) { return x * 13; }
+inline int f13_14(int x) { return x * 14; }
+inline int f13_15(int x) { return x * 15; }
+inline int f13_16(int x) { return x * 16; }
+inline int f13_17(int x) { return x * 17; }
+inline int f13_18(int x) { return x * 18; }
+inline int f13_19(int x) { return x * 19; }
+inline int f13_20(int x) { return x * 20; }
+inline int f13_21(int x) { return x * 21; }
+inline int f13_22(int x) { return x * 22; }
+inline int f13_23(int x) { return x * 23; }
+inline int f13_24(int x) { return x * 24; }
+inline int f13_25(int x) { return x * 25; }
+inline int f13_26(int x) { return x * 26; }
+inline int f13_27(int x) { return x * 27; }
+inline int f13_28(int x) { return x * 28; }
+inline int f13_29(int x) { return x * 29; }
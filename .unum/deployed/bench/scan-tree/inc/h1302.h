@@ -0,0 +1,42 @@
+#pragma once
+/* header 1302 */
+#include <vector>
+#include "h6223.h"
+#include "h2999.h"
+#include "h1927.h"
+#include "h3412.h"
+#include "h6590.h"
+#ifdef X
+#include "h8243.h"
+#endif
+struct S1302 { int a; const char *s = "x//y"; };
+inline int f1302_0(int x) { return x * 0; }
+inline int f1302_1(int x) { return x * 1; }
+inline int f1302_2(int x) { return x * 2; }
+inline int f1302_3(int x) { return x * 3; }
+inline int f1302_4(int x) { return x * 4; }
+inline int f1302_5(int x) { return x * 5; }
+inline int f1302_6(int x) { return x * 6; }
+inline int f1302_7(int x) { return x * 7; }
+inline int f1302_8(int x) { return x * 8; }
+inline int f1302_9(int x) { return x * 9; }
+inline int f1302_10(int x) { return x * 10; }
+inline int f1302_11(int x) { return x * 11; }
+inline int f1302_12(int x) { return x * 12; }
+inline int f1302_13(int x) { return x * 13; }
+inline int f1302_14(int x) { return x * 14; }
+inline int f1302_15(int x) { return x * 15; }
+inline int f1302_16(int x) { return x * 16; }
+inline int f1302_17(int x) { return x * 17; }
+inline int f1302_18(int x) { return x * 18; }
+inline int f1302_19(int x) { return x * 19; }
+inline int f1302_20(int x) { return x * 20; }
+inline int f1302_21(int x) { return x * 21; }
+inline int f1302_22(int x) { return x * 22; }
+inline int f1302_23(int x) { return x * 23; }
+inline int f1302_24(int x) { return x * 24; }
+inline int f1302_25(int x) { return x * 25; }
+inline int f1302_26(int x) { return x * 26; }
+inline int f1302_27(int x) { return x * 27; }
+inline int f1302_28(int x) { return x * 28; }
+inline int f1302_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1303 */
+#include <vector>
+#include "h8435.h"
+#include "h3678.h"
+#include "h1827.h"
+#include "h4196.h"
+#include "h56.h"
+#ifdef X
+#include "h6849.h"
+#endif
+struct S1303 { int a; const char *s = "x//y"; };
+inline int f1303_0(int x) { return x * 0; }
+inline int f1303_1(int x) { return x * 1; }
+inline int f1303_2(int x) { return x * 2; }
+inline int f1303_3(int x) { return x * 3; }
+inline int f1303_4(int x) { return x * 4; }
+inline int f1303_5(int x) { return x * 5; }
+inline int f1303_6(int x) { return x * 6; }
+inline int f1303_7(int x) { return x * 7; }
+inline int f1303_8(int x) { return x * 8; }
+inline int f1303_9(int x) { return x * 9; }
+inline int f1303_10(int x) { return x * 10; }
+inline int f1303_11(int x) { return x * 11; }
+inline int f1303_12(int x) { return x * 12; }
+inline int f1303_13(int x) { return x * 13; }
+inline int f1303_14(int x) { return x * 14; }
+inline int f1303_15(int x) { return x * 15; }
+inline int f1303_16(int x) { return x * 16; }
+inline int f1303_17(int x) { return x * 17; }
+inline int f1303_18(int x) { return x * 18; }
+inline int f1303_19(int x) { return x * 19; }
+inline int f1303_20(int x) { return x * 20; }
+inline int f1303_21(int x) { return x * 21; }
+inline int f1303_22(int x) { return x * 22; }
+inline int f1303_23(int x) { return x * 23; }
+inline int f1303_24(int x) { return x * 24; }
+inline int f1303_25(int x) { return x * 25; }
+inline int f1303_26(int x) { return x * 26; }
+inline int f1303_27(int x) { return x * 27; }
+inline int f1303_28(int x) { return x * 28; }
+inline int f1303_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1304 */
+#include <vector>
+#include "h346.h"
+#include "h3576.h"
+#include "h7691.h"
+#include "h4599.h"
+#include "h1176.h"
+#ifdef X
+#include "h5663.h"
+#endif
+struct S1304 { int a; const char *s = "x//y"; };
+inline int f1304_0(int x) { return x * 0; }
+inline int f1304_1(int x) { return x * 1; }
+inline int f1304_2(int x) { return x * 2; }
+inline int f1304_3(int x) { return x * 3; }
+inline int f1304_4(int x) { return x * 4; }
+inline int f1304_5(int x) { return x * 5; }
+inline int f1304_6(int x) { return x * 6; }
+inline int f1304_7(int x) { return x * 7; }
+inline int f1304_8(int x) { return x * 8; }
+inline int f1304_9(int x) { return x * 9; }
+inline int f1304_10(int x) { return x * 10; }
+inline int f1304_11(int x) { return x * 11; }
+inline int f1304_12(int x) { return x * 12; }
+inline int f1304_13(int x) { return x * 13; }
+inline int f1304_14(int x) { return x * 14; }
+inline int f1304_15(int x) { return x * 15; }
+inline int f1304_16(int x) { return x * 16; }
+inline int f1304_17(int x) { return x * 17; }
+inline int f1304_18(int x) { return x * 18; }
+inline int f1304_19(int x) { return x * 19; }
+inline int f1304_20(int x) { return x * 20; }
+inline int f1304_21(int x) { return x * 21; }
+inline int f1304_22(int x) { return x * 22; }
+inline int f1304_23(int x) { return x * 23; }
+inline int f1304_24(int x) { return x * 24; }
+inline int f1304_25(int x) { return x * 25; }
+inline int f1304_26(int x) { return x * 26; }
+inline int f1304_27(int x) { return x * 27; }
+inline int f1304_28(int x) { return x * 28; }
+inline int f1304_29(int x) { return x * 29; }
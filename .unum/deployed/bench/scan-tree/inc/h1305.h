@@ -0,0 +1,42 @@
+#pragma once
+/* header 1305 */
+#include <vector>
+#include "h9776.h"
+#include "h8069.h"
+#include "h6740.h"
+#include "h3647.h"
+#include "h4353.h"
+#ifdef X
+#include "h9964.h"
+#endif
+struct S1305 { int a; const char *s = "x//y"; };
+inline int f1305_0(int x) { return x * 0; }
+inline int f1305_1(int x) { return x * 1; }
+inline int f1305_2(int x) { return x * 2; }
+inline int f1305_3(int x) { return x * 3; }
+inline int f1305_4(int x) { return x * 4; }
+inline int f1305_5(int x) { return x * 5; }
+inline int f1305_6(int x) { return x * 6; }
+inline int f1305_7(int x) { return x * 7; }
+inline int f1305_8(int x) { return x * 8; }
+inline int f1305_9(int x) { return x * 9; }
+inline int f1305_10(int x) { return x * 10; }
+inline int f1305_11(int x) { return x * 11; }
+inline int f1305_12(int x) { return x * 12; }
+inline int f1305_13(int x) { return x * 13; }
+inline int f1305_14(int x) { return x * 14; }
+inline int f1305_15(int x) { return x * 15; }
+inline int f1305_16(int x) { return x * 16; }
+inline int f1305_17(int x) { return x * 17; }
+inline int f1305_18(int x) { return x * 18; }
+inline int f1305_19(int x) { return x * 19; }
+inline int f1305_20(int x) { return x * 20; }
+inline int f1305_21(int x) { return x * 21; }
+inline int f1305_22(int x) { return x * 22; }
+inline int f1305_23(int x) { return x * 23; }
+inline int f1305_24(int x) { return x * 24; }
+inline int f1305_25(int x) { return x * 25; }
+inline int f1305_26(int x) { return x * 26; }
+inline int f1305_27(int x) { return x * 27; }
+inline int f1305_28(int x) { return x * 28; }
+inline int f1305_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1306 */
+#include <vector>
+#include "h933.h"
+#include "h8799.h"
+#include "h9855.h"
+#include "h8977.h"
+#include "h2278.h"
+#ifdef X
+#include "h9781.h"
+#endif
+struct S1306 { int a; const char *s = "x//y"; };
+inline int f1306_0(int x) { return x * 0; }
+inline int f1306_1(int x) { return x * 1; }
+inline int f1306_2(int x) { return x * 2; }
+inline int f1306_3(int x) { return x * 3; }
+inline int f1306_4(int x) { return x * 4; }
+inline int f1306_5(int x) { return x * 5; }
+inline int f1306_6(int x) { return x * 6; }
+inline int f1306_7(int x) { return x * 7; }
+inline int f1306_8(int x) { return x * 8; }
+inline int f1306_9(int x) { return x * 9; }
+inline int f1306_10(int x) { return x * 10; }
+inline int f1306_11(int x) { return x * 11; }
+inline int f1306_12(int x) { return x * 12; }
+inline int f1306_13(int x) { return x * 13; }
+inline int f1306_14(int x) { return x * 14; }
+inline int f1306_15(int x) { return x * 15; }
+inline int f1306_16(int x) { return x * 16; }
+inline int f1306_17(int x) { return x * 17; }
+inline int f1306_18(int x) { return x * 18; }
+inline int f1306_19(int x) { return x * 19; }
+inline int f1306_20(int x) { return x * 20; }
+inline int f1306_21(int x) { return x * 21; }
+inline int f1306_22(int x) { return x * 22; }
+inline int f1306_23(int x) { return x * 23; }
+inline int f1306_24(int x) { return x * 24; }
+inline int f1306_25(int x) { return x * 25; }
+inline int f1306_26(int x) { return x * 26; }
+inline int f1306_27(int x) { return x * 27; }
+inline int f1306_28(int x) { return x * 28; }
+inline int f1306_29(int x) { return x * 29; }
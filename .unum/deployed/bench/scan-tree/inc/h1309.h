@@ -0,0 +1,42 @@
+#pragma once
+/* header 1309 */
+#include <vector>
+#include "h5807.h"
+#include "h8871.h"
+#include "h6190.h"
+#include "h1818.h"
+#include "h4914.h"
+#ifdef X
+#include "h8151.h"
+#endif
+struct S1309 { int a; const char *s = "x//y"; };
+inline int f1309_0(int x) { return x * 0; }
+inline int f1309_1(int x) { return x * 1; }
+inline int f1309_2(int x) { return x * 2; }
+inline int f1309_3(int x) { return x * 3; }
+inline int f1309_4(int x) { return x * 4; }
+inline int f1309_5(int x) { return x * 5; }
+inline int f1309_6(int x) { return x * 6; }
+inline int f1309_7(int x) { return x * 7; }
+inline int f1309_8(int x) { return x * 8; }
+inline int f1309_9(int x) { return x * 9; }
+inline int f1309_10(int x) { return x * 10; }
+inline int f1309_11(int x) { return x * 11; }
+inline int f1309_12(int x) { return x * 12; }
+inline int f1309_13(int x) { return x * 13; }
+inline int f1309_14(int x) { return x * 14; }
+inline int f1309_15(int x) { return x * 15; }
+inline int f1309_16(int x) { return x * 16; }
+inline int f1309_17(int x) { return x * 17; }
+inline int f1309_18(int x) { return x * 18; }
+inline int f1309_19(int x) { return x * 19; }
+inline int f1309_20(int x) { return x * 20; }
+inline int f1309_21(int x) { return x * 21; }
+inline int f1309_22(int x) { return x * 22; }
+inline int f1309_23(int x) { return x * 23; }
+inline int f1309_24(int x) { return x * 24; }
+inline int f1309_25(int x) { return x * 25; }
+inline int f1309_26(int x) { return x * 26; }
+inline int f1309_27(int x) { return x * 27; }
+inline int f1309_28(int x) { return x * 28; }
+inline int f1309_29(int x) { return x * 29; }
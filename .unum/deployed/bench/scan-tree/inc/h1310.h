@@ -0,0 +1,42 @@
+#pragma once
+/* header 1310 */
+#include <vector>
+#include "h9174.h"
+#include "h1120.h"
+#include "h6711.h"
+#include "h1553.h"
+#include "h4838.h"
+#ifdef X
+#include "h5334.h"
+#endif
+struct S1310 { int a; const char *s = "x//y"; };
+inline int f1310_0(int x) { return x * 0; }
+inline int f1310_1(int x) { return x * 1; }
+inline int f1310_2(int x) { return x * 2; }
+inline int f1310_3(int x) { return x * 3; }
+inline int f1310_4(int x) { return x * 4; }
+inline int f1310_5(int x) { return x * 5; }
+inline int f1310_6(int x) { return x * 6; }
+inline int f1310_7(int x) { return x * 7; }
+inline int f1310_8(int x) { return x * 8; }
+inline int f1310_9(int x) { return x * 9; }
+inline int f1310_10(int x) { return x * 10; }
+inline int f1310_11(int x) { return x * 11; }
+inline int f1310_12(int x) { return x * 12; }
+inline int f1310_13(int x) { return x * 13; }
+inline int f1310_14(int x) { return x * 14; }
+inline int f1310_15(int x) { return x * 15; }
+inline int f1310_16(int x) { return x * 16; }
+inline int f1310_17(int x) { return x * 17; }
+inline int f1310_18(int x) { return x * 18; }
+inline int f1310_19(int x) { return x * 19; }
+inline int f1310_20(int x) { return x * 20; }
+inline int f1310_21(int x) { return x * 21; }
+inline int f1310_22(int x) { return x * 22; }
+inline int f1310_23(int x) { return x * 23; }
+inline int f1310_24(int x) { return x * 24; }
+inline int f1310_25(int x) { return x * 25; }
+inline int f1310_26(int x) { return x * 26; }
+inline int f1310_27(int x) { return x * 27; }
+inline int f1310_28(int x) { return x * 28; }
+inline int f1310_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1311 */
+#include <vector>
+#include "h9988.h"
+#include "h7826.h"
+#include "h8927.h"
+#include "h8022.h"
+#include "h5233.h"
+#ifdef X
+#include "h167.h"
+#endif
+struct S1311 { int a; const char *s = "x//y"; };
+inline int f1311_0(int x) { return x * 0; }
+inline int f1311_1(int x) { return x * 1; }
+inline int f1311_2(int x) { return x * 2; }
+inline int f1311_3(int x) { return x * 3; }
+inline int f1311_4(int x) { return x * 4; }
+inline int f1311_5(int x) { return x * 5; }
+inline int f1311_6(int x) { return x * 6; }
+inline int f1311_7(int x) { return x * 7; }
+inline int f1311_8(int x) { return x * 8; }
+inline int f1311_9(int x) { return x * 9; }
+inline int f1311_10(int x) { return x * 10; }
+inline int f1311_11(int x) { return x * 11; }
+inline int f1311_12(int x) { return x * 12; }
+inline int f1311_13(int x) { return x * 13; }
+inline int f1311_14(int x) { return x * 14; }
+inline int f1311_15(int x) { return x * 15; }
+inline int f1311_16(int x) { return x * 16; }
+inline int f1311_17(int x) { return x * 17; }
+inline int f1311_18(int x) { return x * 18; }
+inline int f1311_19(int x) { return x * 19; }
+inline int f1311_20(int x) { return x * 20; }
+inline int f1311_21(int x) { return x * 21; }
+inline int f1311_22(int x) { return x * 22; }
+inline int f1311_23(int x) { return x * 23; }
+inline int f1311_24(int x) { return x * 24; }
+inline int f1311_25(int x) { return x * 25; }
+inline int f1311_26(int x) { return x * 26; }
+inline int f1311_27(int x) { return x * 27; }
+inline int f1311_28(int x) { return x * 28; }
+inline int f1311_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1312 */
+#include <vector>
+#include "h172.h"
+#include "h8697.h"
+#include "h6583.h"
+#include "h5414.h"
+#include "h7988.h"
+#ifdef X
+#include "h4333.h"
+#endif
+struct S1312 { int a; const char *s = "x//y"; };
+inline int f1312_0(int x) { return x * 0; }
+inline int f1312_1(int x) { return x * 1; }
+inline int f1312_2(int x) { return x * 2; }
+inline int f1312_3(int x) { return x * 3; }
+inline int f1312_4(int x) { return x * 4; }
+inline int f1312_5(int x) { return x * 5; }
+inline int f1312_6(int x) { return x * 6; }
+inline int f1312_7(int x) { return x * 7; }
+inline int f1312_8(int x) { return x * 8; }
+inline int f1312_9(int x) { return x * 9; }
+inline int f1312_10(int x) { return x * 10; }
+inline int f1312_11(int x) { return x * 11; }
+inline int f1312_12(int x) { return x * 12; }
+inline int f1312_13(int x) { return x * 13; }
+inline int f1312_14(int x) { return x * 14; }
+inline int f1312_15(int x) { return x * 15; }
+inline int f1312_16(int x) { return x * 16; }
+inline int f1312_17(int x) { return x * 17; }
+inline int f1312_18(int x) { return x * 18; }
+inline int f1312_19(int x) { return x * 19; }
+inline int f1312_20(int x) { return x * 20; }
+inline int f1312_21(int x) { return x * 21; }
+inline int f1312_22(int x) { return x * 22; }
+inline int f1312_23(int x) { return x * 23; }
+inline int f1312_24(int x) { return x * 24; }
+inline int f1312_25(int x) { return x * 25; }
+inline int f1312_26(int x) { return x * 26; }
+inline int f1312_27(int x) { return x * 27; }
+inline int f1312_28(int x) { return x * 28; }
+inline int f1312_29(int x) { return x * 29; }
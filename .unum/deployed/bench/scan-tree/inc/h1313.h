@@ -0,0 +1,42 @@
+#pragma once
+/* header 1313 */
+#include <vector>
+#include "h8544.h"
+#include "h8775.h"
+#include "h84.h"
+#include "h9439.h"
+#include "h9187.h"
+#ifdef X
+#include "h4463.h"
+#endif
+struct S1313 { int a; const char *s = "x//y"; };
+inline int f1313_0(int x) { return x * 0; }
+inline int f1313_1(int x) { return x * 1; }
+inline int f1313_2(int x) { return x * 2; }
+inline int f1313_3(int x) { return x * 3; }
+inline int f1313_4(int x) { return x * 4; }
+inline int f1313_5(int x) { return x * 5; }
+inline int f1313_6(int x) { return x * 6; }
+inline int f1313_7(int x) { return x * 7; }
+inline int f1313_8(int x) { return x * 8; }
+inline int f1313_9(int x) { return x * 9; }
+inline int f1313_10(int x) { return x * 10; }
+inline int f1313_11(int x) { return x * 11; }
+inline int f1313_12(int x) { return x * 12; }
+inline int f1313_13(int x) { return x * 13; }
+inline int f1313_14(int x) { return x * 14; }
+inline int f1313_15(int x) { return x * 15; }
+inline int f1313_16(int x) { return x * 16; }
+inline int f1313_17(int x) { return x * 17; }
+inline int f1313_18(int x) { return x * 18; }
+inline int f1313_19(int x) { return x * 19; }
+inline int f1313_20(int x) { return x * 20; }
+inline int f1313_21(int x) { return x * 21; }
+inline int f1313_22(int x) { return x * 22; }
+inline int f1313_23(int x) { return x * 23; }
+inline int f1313_24(int x) { return x * 24; }
+inline int f1313_25(int x) { return x * 25; }
+inline int f1313_26(int x) { return x * 26; }
+inline int f1313_27(int x) { return x * 27; }
+inline int f1313_28(int x) { return x * 28; }
+inline int f1313_29(int x) { return x * 29; }
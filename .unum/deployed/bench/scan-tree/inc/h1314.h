@@ -0,0 +1,42 @@
+#pragma once
+/* header 1314 */
+#include <vector>
+#include "h4876.h"
+#include "h8108.h"
+#include "h9033.h"
+#include "h7563.h"
+#include "h9583.h"
+#ifdef X
+#include "h2936.h"
+#endif
+struct S1314 { int a; const char *s = "x//y"; };
+inline int f1314_0(int x) { return x * 0; }
+inline int f1314_1(int x) { return x * 1; }
+inline int f1314_2(int x) { return x * 2; }
+inline int f1314_3(int x) { return x * 3; }
+inline int f1314_4(int x) { return x * 4; }
+inline int f1314_5(int x) { return x * 5; }
+inline int f1314_6(int x) { return x * 6; }
+inline int f1314_7(int x) { return x * 7; }
+inline int f1314_8(int x) { return x * 8; }
+inline int f1314_9(int x) { return x * 9; }
+inline int f1314_10(int x) { return x * 10; }
+inline int f1314_11(int x) { return x * 11; }
+inline int f1314_12(int x) { return x * 12; }
+inline int f1314_13(int x) { return x * 13; }
+inline int f1314_14(int x) { return x * 14; }
+inline int f1314_15(int x) { return x * 15; }
+inline int f1314_16(int x) { return x * 16; }
+inline int f1314_17(int x) { return x * 17; }
+inline int f1314_18(int x) { return x * 18; }
+inline int f1314_19(int x) { return x * 19; }
+inline int f1314_20(int x) { return x * 20; }
+inline int f1314_21(int x) { return x * 21; }
+inline int f1314_22(int x) { return x * 22; }
+inline int f1314_23(int x) { return x * 23; }
+inline int f1314_24(int x) { return x * 24; }
+inline int f1314_25(int x) { return x * 25; }
+inline int f1314_26(int x) { return x * 26; }
+inline int f1314_27(int x) { return x * 27; }
+inline int f1314_28(int x) { return x * 28; }
+inline int f1314_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1316 */
+#include <vector>
+#include "h8838.h"
+#include "h3425.h"
+#include "h2660.h"
+#include "h9765.h"
+#include "h9471.h"
+#ifdef X
+#include "h2437.h"
+#endif
+struct S1316 { int a; const char *s = "x//y"; };
+inline int f1316_0(int x) { return x * 0; }
+inline int f1316_1(int x) { return x * 1; }
+inline int f1316_2(int x) { return x * 2; }
+inline int f1316_3(int x) { return x * 3; }
+inline int f1316_4(int x) { return x * 4; }
+inline int f1316_5(int x) { return x * 5; }
+inline int f1316_6(int x) { return x * 6; }
+inline int f1316_7(int x) { return x * 7; }
+inline int f1316_8(int x) { return x * 8; }
+inline int f1316_9(int x) { return x * 9; }
+inline int f1316_10(int x) { return x * 10; }
+inline int f1316_11(int x) { return x * 11; }
+inline int f1316_12(int x) { return x * 12; }
+inline int f1316_13(int x) { return x * 13; }
+inline int f1316_14(int x) { return x * 14; }
+inline int f1316_15(int x) { return x * 15; }
+inline int f1316_16(int x) { return x * 16; }
+inline int f1316_17(int x) { return x * 17; }
+inline int f1316_18(int x) { return x * 18; }
+inline int f1316_19(int x) { return x * 19; }
+inline int f1316_20(int x) { return x * 20; }
+inline int f1316_21(int x) { return x * 21; }
+inline int f1316_22(int x) { return x * 22; }
+inline int f1316_23(int x) { return x * 23; }
+inline int f1316_24(int x) { return x * 24; }
+inline int f1316_25(int x) { return x * 25; }
+inline int f1316_26(int x) { return x * 26; }
+inline int f1316_27(int x) { return x * 27; }
+inline int f1316_28(int x) { return x * 28; }
+inline int f1316_29(int x) { return x * 29; }
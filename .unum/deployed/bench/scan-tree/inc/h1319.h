@@ -0,0 +1,42 @@
+#pragma once
+/* header 1319 */
+#include <vector>
+#include "h873.h"
+#include "h8511.h"
+#include "h6271.h"
+#include "h2575.h"
+#include "h7842.h"
+#ifdef X
+#include "h3243.h"
+#endif
+struct S1319 { int a; const char *s = "x//y"; };
+inline int f1319_0(int x) { return x * 0; }
+inline int f1319_1(int x) { return x * 1; }
+inline int f1319_2(int x) { return x * 2; }
+inline int f1319_3(int x) { return x * 3; }
+inline int f1319_4(int x) { return x * 4; }
+inline int f1319_5(int x) { return x * 5; }
+inline int f1319_6(int x) { return x * 6; }
+inline int f1319_7(int x) { return x * 7; }
+inline int f1319_8(int x) { return x * 8; }
+inline int f1319_9(int x) { return x * 9; }
+inline int f1319_10(int x) { return x * 10; }
+inline int f1319_11(int x) { return x * 11; }
+inline int f1319_12(int x) { return x * 12; }
+inline int f1319_13(int x) { return x * 13; }
+inline int f1319_14(int x) { return x * 14; }
+inline int f1319_15(int x) { return x * 15; }
+inline int f1319_16(int x) { return x * 16; }
+inline int f1319_17(int x) { return x * 17; }
+inline int f1319_18(int x) { return x * 18; }
+inline int f1319_19(int x) { return x * 19; }
+inline int f1319_20(int x) { return x * 20; }
+inline int f1319_21(int x) { return x * 21; }
+inline int f1319_22(int x) { return x * 22; }
+inline int f1319_23(int x) { return x * 23; }
+inline int f1319_24(int x) { return x * 24; }
+inline int f1319_25(int x) { return x * 25; }
+inline int f1319_26(int x) { return x * 26; }
+inline int f1319_27(int x) { return x * 27; }
+inline int f1319_28(int x) { return x * 28; }
+inline int f1319_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1323 */
+#include <vector>
+#include "h8837.h"
+#include "h3726.h"
+#include "h1294.h"
+#include "h1343.h"
+#include "h7838.h"
+#ifdef X
+#include "h1983.h"
+#endif
+struct S1323 { int a; const char *s = "x//y"; };
+inline int f1323_0(int x) { return x * 0; }
+inline int f1323_1(int x) { return x * 1; }
+inline int f1323_2(int x) { return x * 2; }
+inline int f1323_3(int x) { return x * 3; }
+inline int f1323_4(int x) { return x * 4; }
+inline int f1323_5(int x) { return x * 5; }
+inline int f1323_6(int x) { return x * 6; }
+inline int f1323_7(int x) { return x * 7; }
+inline int f1323_8(int x) { return x * 8; }
+inline int f1323_9(int x) { return x * 9; }
+inline int f1323_10(int x) { return x * 10; }
+inline int f1323_11(int x) { return x * 11; }
+inline int f1323_12(int x) { return x * 12; }
+inline int f1323_13(int x) { return x * 13; }
+inline int f1323_14(int x) { return x * 14; }
+inline int f1323_15(int x) { return x * 15; }
+inline int f1323_16(int x) { return x * 16; }
+inline int f1323_17(int x) { return x * 17; }
+inline int f1323_18(int x) { return x * 18; }
+inline int f1323_19(int x) { return x * 19; }
+inline int f1323_20(int x) { return x * 20; }
+inline int f1323_21(int x) { return x * 21; }
+inline int f1323_22(int x) { return x * 22; }
+inline int f1323_23(int x) { return x * 23; }
+inline int f1323_24(int x) { return x * 24; }
+inline int f1323_25(int x) { return x * 25; }
+inline int f1323_26(int x) { return x * 26; }
+inline int f1323_27(int x) { return x * 27; }
+inline int f1323_28(int x) { return x * 28; }
+inline int f1323_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1325 */
+#include <vector>
+#include "h5850.h"
+#include "h7582.h"
+#include "h2404.h"
+#include "h752.h"
+#include "h6961.h"
+#ifdef X
+#include "h5103.h"
+#endif
+struct S1325 { int a; const char *s = "x//y"; };
+inline int f1325_0(int x) { return x * 0; }
+inline int f1325_1(int x) { return x * 1; }
+inline int f1325_2(int x) { return x * 2; }
+inline int f1325_3(int x) { return x * 3; }
+inline int f1325_4(int x) { return x * 4; }
+inline int f1325_5(int x) { return x * 5; }
+inline int f1325_6(int x) { return x * 6; }
+inline int f1325_7(int x) { return x * 7; }
+inline int f1325_8(int x) { return x * 8; }
+inline int f1325_9(int x) { return x * 9; }
+inline int f1325_10(int x) { return x * 10; }
+inline int f1325_11(int x) { return x * 11; }
+inline int f1325_12(int x) { return x * 12; }
+inline int f1325_13(int x) { return x * 13; }
+inline int f1325_14(int x) { return x * 14; }
+inline int f1325_15(int x) { return x * 15; }
+inline int f1325_16(int x) { return x * 16; }
+inline int f1325_17(int x) { return x * 17; }
+inline int f1325_18(int x) { return x * 18; }
+inline int f1325_19(int x) { return x * 19; }
+inline int f1325_20(int x) { return x * 20; }
+inline int f1325_21(int x) { return x * 21; }
+inline int f1325_22(int x) { return x * 22; }
+inline int f1325_23(int x) { return x * 23; }
+inline int f1325_24(int x) { return x * 24; }
+inline int f1325_25(int x) { return x * 25; }
+inline int f1325_26(int x) { return x * 26; }
+inline int f1325_27(int x) { return x * 27; }
+inline int f1325_28(int x) { return x * 28; }
+inline int f1325_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 133 */
+#include <vector>
+#include "h3670.h"
+#include "h6224.h"
+#include "h503.h"
+#include "h4591.h"
+#include "h357.h"
+#ifdef X
+#include "h9513.h"
+#endif
+struct S133 { int a; const char *s = "x//y"; };
+inline int f133_0(int x) { return x * 0; }
+inline int f133_1(int x) { return x * 1; }
+inline int f133_2(int x) { return x * 2; }
+inline int f133_3(int x) { return x * 3; }
+inline int f133_4(int x) { return x * 4; }
+inline int f133_5(int x) { return x * 5; }
+inline int f133_6(int x) { return x * 6; }
+inline int f133_7(int x) { return x * 7; }
+inline int f133_8(int x) { return x * 8; }
+inline int f133_9(int x) { return x * 9; }
+inline int f133_10(int x) { return x * 10; }
+inline int f133_11(int x) { return x * 11; }
+inline int f133_12(int x) { return x * 12; }
+inline int f133_13(int x) { return x * 13; }
+inline int f133_14(int x) { return x * 14; }
+inline int f133_15(int x) { return x * 15; }
+inline int f133_16(int x) { return x * 16; }
+inline int f133_17(int x) { return x * 17; }
+inline int f133_18(int x) { return x * 18; }
+inline int f133_19(int x) { return x * 19; }
+inline int f133_20(int x) { return x * 20; }
+inline int f133_21(int x) { return x * 21; }
+inline int f133_22(int x) { return x * 22; }
+inline int f133_23(int x) { return x * 23; }
+inline int f133_24(int x) { return x * 24; }
+inline int f133_25(int x) { return x * 25; }
+inline int f133_26(int x) { return x * 26; }
+inline int f133_27(int x) { return x * 27; }
+inline int f133_28(int x) { return x * 28; }
+inline int f133_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1334 */
+#include <vector>
+#include "h5116.h"
+#include "h9245.h"
+#include "h7676.h"
+#include "h5421.h"
+#include "h6573.h"
+#ifdef X
+#include "h1696.h"
+#endif
+struct S1334 { int a; const char *s = "x//y"; };
+inline int f1334_0(int x) { return x * 0; }
+inline int f1334_1(int x) { return x * 1; }
+inline int f1334_2(int x) { return x * 2; }
+inline int f1334_3(int x) { return x * 3; }
+inline int f1334_4(int x) { return x * 4; }
+inline int f1334_5(int x) { return x * 5; }
+inline int f1334_6(int x) { return x * 6; }
+inline int f1334_7(int x) { return x * 7; }
+inline int f1334_8(int x) { return x * 8; }
+inline int f1334_9(int x) { return x * 9; }
+inline int f1334_10(int x) { return x * 10; }
+inline int f1334_11(int x) { return x * 11; }
+inline int f1334_12(int x) { return x * 12; }
+inline int f1334_13(int x) { return x * 13; }
+inline int f1334_14(int x) { return x * 14; }
+inline int f1334_15(int x) { return x * 15; }
+inline int f1334_16(int x) { return x * 16; }
+inline int f1334_17(int x) { return x * 17; }
+inline int f1334_18(int x) { return x * 18; }
+inline int f1334_19(int x) { return x * 19; }
+inline int f1334_20(int x) { return x * 20; }
+inline int f1334_21(int x) { return x * 21; }
+inline int f1334_22(int x) { return x * 22; }
+inline int f1334_23(int x) { return x * 23; }
+inline int f1334_24(int x) { return x * 24; }
+inline int f1334_25(int x) { return x * 25; }
+inline int f1334_26(int x) { return x * 26; }
+inline int f1334_27(int x) { return x * 27; }
+inline int f1334_28(int x) { return x * 28; }
+inline int f1334_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1336 */
+#include <vector>
+#include "h6641.h"
+#include "h7843.h"
+#include "h8977.h"
+#include "h2404.h"
+#include "h4692.h"
+#ifdef X
+#include "h3063.h"
+#endif
+struct S1336 { int a; const char *s = "x//y"; };
+inline int f1336_0(int x) { return x * 0; }
+inline int f1336_1(int x) { return x * 1; }
+inline int f1336_2(int x) { return x * 2; }
+inline int f1336_3(int x) { return x * 3; }
+inline int f1336_4(int x) { return x * 4; }
+inline int f1336_5(int x) { return x * 5; }
+inline int f1336_6(int x) { return x * 6; }
+inline int f1336_7(int x) { return x * 7; }
+inline int f1336_8(int x) { return x * 8; }
+inline int f1336_9(int x) { return x * 9; }
+inline int f1336_10(int x) { return x * 10; }
+inline int f1336_11(int x) { return x * 11; }
+inline int f1336_12(int x) { return x * 12; }
+inline int f1336_13(int x) { return x * 13; }
+inline int f1336_14(int x) { return x * 14; }
+inline int f1336_15(int x) { return x * 15; }
+inline int f1336_16(int x) { return x * 16; }
+inline int f1336_17(int x) { return x * 17; }
+inline int f1336_18(int x) { return x * 18; }
+inline int f1336_19(int x) { return x * 19; }
+inline int f1336_20(int x) { return x * 20; }
+inline int f1336_21(int x) { return x * 21; }
+inline int f1336_22(int x) { return x * 22; }
+inline int f1336_23(int x) { return x * 23; }
+inline int f1336_24(int x) { return x * 24; }
+inline int f1336_25(int x) { return x * 25; }
+inline int f1336_26(int x) { return x * 26; }
+inline int f1336_27(int x) { return x * 27; }
+inline int f1336_28(int x) { return x * 28; }
+inline int f1336_29(int x) { return x * 29; }
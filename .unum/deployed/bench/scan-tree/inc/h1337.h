@@ -0,0 +1,42 @@
+#pragma once
+/* header 1337 */
+#include <vector>
+#include "h4214.h"
+#include "h2705.h"
+#include "h109.h"
+#include "h1011.h"
+#include "h3612.h"
+#ifdef X
+#include "h5366.h"
+#endif
+struct S1337 { int a; const char *s = "x//y"; };
+inline int f1337_0(int x) { return x * 0; }
+inline int f1337_1(int x) { return x * 1; }
+inline int f1337_2(int x) { return x * 2; }
+inline int f1337_3(int x) { return x * 3; }
+inline int f1337_4(int x) { return x * 4; }
+inline int f1337_5(int x) { return x * 5; }
+inline int f1337_6(int x) { return x * 6; }
+inline int f1337_7(int x) { return x * 7; }
+inline int f1337_8(int x) { return x * 8; }
+inline int f1337_9(int x) { return x * 9; }
+inline int f1337_10(int x) { return x * 10; }
+inline int f1337_11(int x) { return x * 11; }
+inline int f1337_12(int x) { return x * 12; }
+inline int f1337_13(int x) { return x * 13; }
+inline int f1337_14(int x) { return x * 14; }
+inline int f1337_15(int x) { return x * 15; }
+inline int f1337_16(int x) { return x * 16; }
+inline int f1337_17(int x) { return x * 17; }
+inline int f1337_18(int x) { return x * 18; }
+inline int f1337_19(int x) { return x * 19; }
+inline int f1337_20(int x) { return x * 20; }
+inline int f1337_21(int x) { return x * 21; }
+inline int f1337_22(int x) { return x * 22; }
+inline int f1337_23(int x) { return x * 23; }
+inline int f1337_24(int x) { return x * 24; }
+inline int f1337_25(int x) { return x * 25; }
+inline int f1337_26(int x) { return x * 26; }
+inline int f1337_27(int x) { return x * 27; }
+inline int f1337_28(int x) { return x * 28; }
+inline int f1337_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1338 */
+#include <vector>
+#include "h6943.h"
+#include "h8083.h"
+#include "h9682.h"
+#include "h6105.h"
+#include "h7257.h"
+#ifdef X
+#include "h747.h"
+#endif
+struct S1338 { int a; const char *s = "x//y"; };
+inline int f1338_0(int x) { return x * 0; }
+inline int f1338_1(int x) { return x * 1; }
+inline int f1338_2(int x) { return x * 2; }
+inline int f1338_3(int x) { return x * 3; }
+inline int f1338_4(int x) { return x * 4; }
+inline int f1338_5(int x) { return x * 5; }
+inline int f1338_6(int x) { return x * 6; }
+inline int f1338_7(int x) { return x * 7; }
+inline int f1338_8(int x) { return x * 8; }
+inline int f1338_9(int x) { return x * 9; }
+inline int f1338_10(int x) { return x * 10; }
+inline int f1338_11(int x) { return x * 11; }
+inline int f1338_12(int x) { return x * 12; }
+inline int f1338_13(int x) { return x * 13; }
+inline int f1338_14(int x) { return x * 14; }
+inline int f1338_15(int x) { return x * 15; }
+inline int f1338_16(int x) { return x * 16; }
+inline int f1338_17(int x) { return x * 17; }
+inline int f1338_18(int x) { return x * 18; }
+inline int f1338_19(int x) { return x * 19; }
+inline int f1338_20(int x) { return x * 20; }
+inline int f1338_21(int x) { return x * 21; }
+inline int f1338_22(int x) { return x * 22; }
+inline int f1338_23(int x) { return x * 23; }
+inline int f1338_24(int x) { return x * 24; }
+inline int f1338_25(int x) { return x * 25; }
+inline int f1338_26(int x) { return x * 26; }
+inline int f1338_27(int x) { return x * 27; }
+inline int f1338_28(int x) { return x * 28; }
+inline int f1338_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1339 */
+#include <vector>
+#include "h4378.h"
+#include "h3121.h"
+#include "h2889.h"
+#include "h8647.h"
+#include "h7471.h"
+#ifdef X
+#include "h6866.h"
+#endif
+struct S1339 { int a; const char *s = "x//y"; };
+inline int f1339_0(int x) { return x * 0; }
+inline int f1339_1(int x) { return x * 1; }
+inline int f1339_2(int x) { return x * 2; }
+inline int f1339_3(int x) { return x * 3; }
+inline int f1339_4(int x) { return x * 4; }
+inline int f1339_5(int x) { return x * 5; }
+inline int f1339_6(int x) { return x * 6; }
+inline int f1339_7(int x) { return x * 7; }
+inline int f1339_8(int x) { return x * 8; }
+inline int f1339_9(int x) { return x * 9; }
+inline int f1339_10(int x) { return x * 10; }
+inline int f1339_11(int x) { return x * 11; }
+inline int f1339_12(int x) { return x * 12; }
+inline int f1339_13(int x) { return x * 13; }
+inline int f1339_14(int x) { return x * 14; }
+inline int f1339_15(int x) { return x * 15; }
+inline int f1339_16(int x) { return x * 16; }
+inline int f1339_17(int x) { return x * 17; }
+inline int f1339_18(int x) { return x * 18; }
+inline int f1339_19(int x) { return x * 19; }
+inline int f1339_20(int x) { return x * 20; }
+inline int f1339_21(int x) { return x * 21; }
+inline int f1339_22(int x) { return x * 22; }
+inline int f1339_23(int x) { return x * 23; }
+inline int f1339_24(int x) { return x * 24; }
+inline int f1339_25(int x) { return x * 25; }
+inline int f1339_26(int x) { return x * 26; }
+inline int f1339_27(int x) { return x * 27; }
+inline int f1339_28(int x) { return x * 28; }
+inline int f1339_29(int x) { return x * 29; }
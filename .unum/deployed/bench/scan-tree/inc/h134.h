@@ -0,0 +1,42 @@
+#pragma once
+/* header 134 */
+#include <vector>
+#include "h410.h"
+#include "h570.h"
+#include "h8350.h"
+#include "h6118.h"
+#include "h4973.h"
+#ifdef X
+#include "h8454.h"
+#endif
+struct S134 { int a; const char *s = "x//y"; };
+inline int f134_0(int x) { return x * 0; }
+inline int f134_1(int x) { return x * 1; }
+inline int f134_2(int x) { return x * 2; }
+inline int f134_3(int x) { return x * 3; }
+inline int f134_4(int x) { return x * 4; }
+inline int f134_5(int x) { return x * 5; }
+inline int f134_6(int x) { return x * 6; }
+inline int f134_7(int x) { return x * 7; }
+inline int f134_8(int x) { return x * 8; }
+inline int f134_9(int x) { return x * 9; }
+inline int f134_10(int x) { return x * 10; }
+inline int f134_11(int x) { return x * 11; }
+inline int f134_12(int x) { return x * 12; }
+inline int f134_13(int x) { return x * 13; }
+inline int f134_14(int x) { return x * 14; }
+inline int f134_15(int x) { return x * 15; }
+inline int f134_16(int x) { return x * 16; }
+inline int f134_17(int x) { return x * 17; }
+inline int f134_18(int x) { return x * 18; }
+inline int f134_19(int x) { return x * 19; }
+inline int f134_20(int x) { return x * 20; }
+inline int f134_21(int x) { return x * 21; }
+inline int f134_22(int x) { return x * 22; }
+inline int f134_23(int x) { return x * 23; }
+inline int f134_24(int x) { return x * 24; }
+inline int f134_25(int x) { return x * 25; }
+inline int f134_26(int x) { return x * 26; }
+inline int f134_27(int x) { return x * 27; }
+inline int f134_28(int x) { return x * 28; }
+inline int f134_29(int x) { return x * 29; }
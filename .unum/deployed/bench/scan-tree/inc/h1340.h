@@ -0,0 +1,42 @@
+#pragma once
+/* header 1340 */
+#include <vector>
+#include "h6363.h"
+#include "h1236.h"
+#include "h3930.h"
+#include "h5623.h"
+#include "h9191.h"
+#ifdef X
+#include "h110.h"
+#endif
+struct S1340 { int a; const char *s = "x//y"; };
+inline int f1340_0(int x) { return x * 0; }
+inline int f1340_1(int x) { return x * 1; }
+inline int f1340_2(int x) { return x * 2; }
+inline int f1340_3(int x) { return x * 3; }
+inline int f1340_4(int x) { return x * 4; }
+inline int f1340_5(int x) { return x * 5; }
+inline int f1340_6(int x) { return x * 6; }
+inline int f1340_7(int x) { return x * 7; }
+inline int f1340_8(int x) { return x * 8; }
+inline int f1340_9(int x) { return x * 9; }
+inline int f1340_10(int x) { return x * 10; }
+inline int f1340_11(int x) { return x * 11; }
+inline int f1340_12(int x) { return x * 12; }
+inline int f1340_13(int x) { return x * 13; }
+inline int f1340_14(int x) { return x * 14; }
+inline int f1340_15(int x) { return x * 15; }
+inline int f1340_16(int x) { return x * 16; }
+inline int f1340_17(int x) { return x * 17; }
+inline int f1340_18(int x) { return x * 18; }
+inline int f1340_19(int x) { return x * 19; }
+inline int f1340_20(int x) { return x * 20; }
+inline int f1340_21(int x) { return x * 21; }
+inline int f1340_22(int x) { return x * 22; }
+inline int f1340_23(int x) { return x * 23; }
+inline int f1340_24(int x) { return x * 24; }
+inline int f1340_25(int x) { return x * 25; }
+inline int f1340_26(int x) { return x * 26; }
+inline int f1340_27(int x) { return x * 27; }
+inline int f1340_28(int x) { return x * 28; }
+inline int f1340_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1342 */
+#include <vector>
+#include "h3751.h"
+#include "h7956.h"
+#include "h9780.h"
+#include "h367.h"
+#include "h2847.h"
+#ifdef X
+#include "h4648.h"
+#endif
+struct S1342 { int a; const char *s = "x//y"; };
+inline int f1342_0(int x) { return x * 0; }
+inline int f1342_1(int x) { return x * 1; }
+inline int f1342_2(int x) { return x * 2; }
+inline int f1342_3(int x) { return x * 3; }
+inline int f1342_4(int x) { return x * 4; }
+inline int f1342_5(int x) { return x * 5; }
+inline int f1342_6(int x) { return x * 6; }
+inline int f1342_7(int x) { return x * 7; }
+inline int f1342_8(int x) { return x * 8; }
+inline int f1342_9(int x) { return x * 9; }
+inline int f1342_10(int x) { return x * 10; }
+inline int f1342_11(int x) { return x * 11; }
+inline int f1342_12(int x) { return x * 12; }
+inline int f1342_13(int x) { return x * 13; }
+inline int f1342_14(int x) { return x * 14; }
+inline int f1342_15(int x) { return x * 15; }
+inline int f1342_16(int x) { return x * 16; }
+inline int f1342_17(int x) { return x * 17; }
+inline int f1342_18(int x) { return x * 18; }
+inline int f1342_19(int x) { return x * 19; }
+inline int f1342_20(int x) { return x * 20; }
+inline int f1342_21(int x) { return x * 21; }
+inline int f1342_22(int x) { return x * 22; }
+inline int f1342_23(int x) { return x * 23; }
+inline int f1342_24(int x) { return x * 24; }
+inline int f1342_25(int x) { return x * 25; }
+inline int f1342_26(int x) { return x * 26; }
+inline int f1342_27(int x) { return x * 27; }
+inline int f1342_28(int x) { return x * 28; }
+inline int f1342_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1345 */
+#include <vector>
+#include "h1356.h"
+#include "h883.h"
+#include "h1497.h"
+#include "h8443.h"
+#include "h9123.h"
+#ifdef X
+#include "h1998.h"
+#endif
+struct S1345 { int a; const char *s = "x//y"; };
+inline int f1345_0(int x) { return x * 0; }
+inline int f1345_1(int x) { return x * 1; }
+inline int f1345_2(int x) { return x * 2; }
+inline int f1345_3(int x) { return x * 3; }
+inline int f1345_4(int x) { return x * 4; }
+inline int f1345_5(int x) { return x * 5; }
+inline int f1345_6(int x) { return x * 6; }
+inline int f1345_7(int x) { return x * 7; }
+inline int f1345_8(int x) { return x * 8; }
+inline int f1345_9(int x) { return x * 9; }
+inline int f1345_10(int x) { return x * 10; }
+inline int f1345_11(int x) { return x * 11; }
+inline int f1345_12(int x) { return x * 12; }
+inline int f1345_13(int x) { return x * 13; }
+inline int f1345_14(int x) { return x * 14; }
+inline int f1345_15(int x) { return x * 15; }
+inline int f1345_16(int x) { return x * 16; }
+inline int f1345_17(int x) { return x * 17; }
+inline int f1345_18(int x) { return x * 18; }
+inline int f1345_19(int x) { return x * 19; }
+inline int f1345_20(int x) { return x * 20; }
+inline int f1345_21(int x) { return x * 21; }
+inline int f1345_22(int x) { return x * 22; }
+inline int f1345_23(int x) { return x * 23; }
+inline int f1345_24(int x) { return x * 24; }
+inline int f1345_25(int x) { return x * 25; }
+inline int f1345_26(int x) { return x * 26; }
+inline int f1345_27(int x) { return x * 27; }
+inline int f1345_28(int x) { return x * 28; }
+inline int f1345_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1347 */
+#include <vector>
+#include "h4036.h"
+#include "h2793.h"
+#include "h8026.h"
+#include "h5394.h"
+#include "h2195.h"
+#ifdef X
+#include "h7264.h"
+#endif
+struct S1347 { int a; const char *s = "x//y"; };
+inline int f1347_0(int x) { return x * 0; }
+inline int f1347_1(int x) { return x * 1; }
+inline int f1347_2(int x) { return x * 2; }
+inline int f1347_3(int x) { return x * 3; }
+inline int f1347_4(int x) { return x * 4; }
+inline int f1347_5(int x) { return x * 5; }
+inline int f1347_6(int x) { return x * 6; }
+inline int f1347_7(int x) { return x * 7; }
+inline int f1347_8(int x) { return x * 8; }
+inline int f1347_9(int x) { return x * 9; }
+inline int f1347_10(int x) { return x * 10; }
+inline int f1347_11(int x) { return x * 11; }
+inline int f1347_12(int x) { return x * 12; }
+inline int f1347_13(int x) { return x * 13; }
+inline int f1347_14(int x) { return x * 14; }
+inline int f1347_15(int x) { return x * 15; }
+inline int f1347_16(int x) { return x * 16; }
+inline int f1347_17(int x) { return x * 17; }
+inline int f1347_18(int x) { return x * 18; }
+inline int f1347_19(int x) { return x * 19; }
+inline int f1347_20(int x) { return x * 20; }
+inline int f1347_21(int x) { return x * 21; }
+inline int f1347_22(int x) { return x * 22; }
+inline int f1347_23(int x) { return x * 23; }
+inline int f1347_24(int x) { return x * 24; }
+inline int f1347_25(int x) { return x * 25; }
+inline int f1347_26(int x) { return x * 26; }
+inline int f1347_27(int x) { return x * 27; }
+inline int f1347_28(int x) { return x * 28; }
+inline int f1347_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1349 */
+#include <vector>
+#include "h1665.h"
+#include "h6709.h"
+#include "h1662.h"
+#include "h3679.h"
+#include "h5089.h"
+#ifdef X
+#include "h2148.h"
+#endif
+struct S1349 { int a; const char *s = "x//y"; };
+inline int f1349_0(int x) { return x * 0; }
+inline int f1349_1(int x) { return x * 1; }
+inline int f1349_2(int x) { return x * 2; }
+inline int f1349_3(int x) { return x * 3; }
+inline int f1349_4(int x) { return x * 4; }
+inline int f1349_5(int x) { return x * 5; }
+inline int f1349_6(int x) { return x * 6; }
+inline int f1349_7(int x) { return x * 7; }
+inline int f1349_8(int x) { return x * 8; }
+inline int f1349_9(int x) { return x * 9; }
+inline int f1349_10(int x) { return x * 10; }
+inline int f1349_11(int x) { return x * 11; }
+inline int f1349_12(int x) { return x * 12; }
+inline int f1349_13(int x) { return x * 13; }
+inline int f1349_14(int x) { return x * 14; }
+inline int f1349_15(int x) { return x * 15; }
+inline int f1349_16(int x) { return x * 16; }
+inline int f1349_17(int x) { return x * 17; }
+inline int f1349_18(int x) { return x * 18; }
+inline int f1349_19(int x) { return x * 19; }
+inline int f1349_20(int x) { return x * 20; }
+inline int f1349_21(int x) { return x * 21; }
+inline int f1349_22(int x) { return x * 22; }
+inline int f1349_23(int x) { return x * 23; }
+inline int f1349_24(int x) { return x * 24; }
+inline int f1349_25(int x) { return x * 25; }
+inline int f1349_26(int x) { return x * 26; }
+inline int f1349_27(int x) { return x * 27; }
+inline int f1349_28(int x) { return x * 28; }
+inline int f1349_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1355 */
+#include <vector>
+#include "h3161.h"
+#include "h1316.h"
+#include "h5859.h"
+#include "h1733.h"
+#include "h3779.h"
+#ifdef X
+#include "h4641.h"
+#endif
+struct S1355 { int a; const char *s = "x//y"; };
+inline int f1355_0(int x) { return x * 0; }
+inline int f1355_1(int x) { return x * 1; }
+inline int f1355_2(int x) { return x * 2; }
+inline int f1355_3(int x) { return x * 3; }
+inline int f1355_4(int x) { return x * 4; }
+inline int f1355_5(int x) { return x * 5; }
+inline int f1355_6(int x) { return x * 6; }
+inline int f1355_7(int x) { return x * 7; }
+inline int f1355_8(int x) { return x * 8; }
+inline int f1355_9(int x) { return x * 9; }
+inline int f1355_10(int x) { return x * 10; }
+inline int f1355_11(int x) { return x * 11; }
+inline int f1355_12(int x) { return x * 12; }
+inline int f1355_13(int x) { return x * 13; }
+inline int f1355_14(int x) { return x * 14; }
+inline int f1355_15(int x) { return x * 15; }
+inline int f1355_16(int x) { return x * 16; }
+inline int f1355_17(int x) { return x * 17; }
+inline int f1355_18(int x) { return x * 18; }
+inline int f1355_19(int x) { return x * 19; }
+inline int f1355_20(int x) { return x * 20; }
+inline int f1355_21(int x) { return x * 21; }
+inline int f1355_22(int x) { return x * 22; }
+inline int f1355_23(int x) { return x * 23; }
+inline int f1355_24(int x) { return x * 24; }
+inline int f1355_25(int x) { return x * 25; }
+inline int f1355_26(int x) { return x * 26; }
+inline int f1355_27(int x) { return x * 27; }
+inline int f1355_28(int x) { return x * 28; }
+inline int f1355_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1357 */
+#include <vector>
+#include "h6495.h"
+#include "h7074.h"
+#include "h66.h"
+#include "h9778.h"
+#include "h7761.h"
+#ifdef X
+#include "h9158.h"
+#endif
+struct S1357 { int a; const char *s = "x//y"; };
+inline int f1357_0(int x) { return x * 0; }
+inline int f1357_1(int x) { return x * 1; }
+inline int f1357_2(int x) { return x * 2; }
+inline int f1357_3(int x) { return x * 3; }
+inline int f1357_4(int x) { return x * 4; }
+inline int f1357_5(int x) { return x * 5; }
+inline int f1357_6(int x) { return x * 6; }
+inline int f1357_7(int x) { return x * 7; }
+inline int f1357_8(int x) { return x * 8; }
+inline int f1357_9(int x) { return x * 9; }
+inline int f1357_10(int x) { return x * 10; }
+inline int f1357_11(int x) { return x * 11; }
+inline int f1357_12(int x) { return x * 12; }
+inline int f1357_13(int x) { return x * 13; }
+inline int f1357_14(int x) { return x * 14; }
+inline int f1357_15(int x) { return x * 15; }
+inline int f1357_16(int x) { return x * 16; }
+inline int f1357_17(int x) { return x * 17; }
+inline int f1357_18(int x) { return x * 18; }
+inline int f1357_19(int x) { return x * 19; }
+inline int f1357_20(int x) { return x * 20; }
+inline int f1357_21(int x) { return x * 21; }
+inline int f1357_22(int x) { return x * 22; }
+inline int f1357_23(int x) { return x * 23; }
+inline int f1357_24(int x) { return x * 24; }
+inline int f1357_25(int x) { return x * 25; }
+inline int f1357_26(int x) { return x * 26; }
+inline int f1357_27(int x) { return x * 27; }
+inline int f1357_28(int x) { return x * 28; }
+inline int f1357_29(int x) { return x * 29; }
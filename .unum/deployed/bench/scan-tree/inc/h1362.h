@@ -0,0 +1,42 @@
+#pragma once
+/* header 1362 */
+#include <vector>
+#include "h4212.h"
+#include "h9504.h"
+#include "h8600.h"
+#include "h3310.h"
+#include "h7727.h"
+#ifdef X
+#include "h2842.h"
+#endif
+struct S1362 { int a; const char *s = "x//y"; };
+inline int f1362_0(int x) { return x * 0; }
+inline int f1362_1(int x) { return x * 1; }
+inline int f1362_2(int x) { return x * 2; }
+inline int f1362_3(int x) { return x * 3; }
+inline int f1362_4(int x) { return x * 4; }
+inline int f1362_5(int x) { return x * 5; }
+inline int f1362_6(int x) { return x * 6; }
+inline int f1362_7(int x) { return x * 7; }
+inline int f1362_8(int x) { return x * 8; }
+inline int f1362_9(int x) { return x * 9; }
+inline int f1362_10(int x) { return x * 10; }
+inline int f1362_11(int x) { return x * 11; }
+inline int f1362_12(int x) { return x * 12; }
+inline int f1362_13(int x) { return x * 13; }
+inline int f1362_14(int x) { return x * 14; }
+inline int f1362_15(int x) { return x * 15; }
+inline int f1362_16(int x) { return x * 16; }
+inline int f1362_17(int x) { return x * 17; }
+inline int f1362_18(int x) { return x * 18; }
+inline int f1362_19(int x) { return x * 19; }
+inline int f1362_20(int x) { return x * 20; }
+inline int f1362_21(int x) { return x * 21; }
+inline int f1362_22(int x) { return x * 22; }
+inline int f1362_23(int x) { return x * 23; }
+inline int f1362_24(int x) { return x * 24; }
+inline int f1362_25(int x) { return x * 25; }
+inline int f1362_26(int x) { return x * 26; }
+inline int f1362_27(int x) { return x * 27; }
+inline int f1362_28(int x) { return x * 28; }
+inline int f1362_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1365 */
+#include <vector>
+#include "h9948.h"
+#include "h1114.h"
+#include "h5072.h"
+#include "h5131.h"
+#include "h9195.h"
+#ifdef X
+#include "h925.h"
+#endif
+struct S1365 { int a; const char *s = "x//y"; };
+inline int f1365_0(int x) { return x * 0; }
+inline int f1365_1(int x) { return x * 1; }
+inline int f1365_2(int x) { return x * 2; }
+inline int f1365_3(int x) { return x * 3; }
+inline int f1365_4(int x) { return x * 4; }
+inline int f1365_5(int x) { return x * 5; }
+inline int f1365_6(int x) { return x * 6; }
+inline int f1365_7(int x) { return x * 7; }
+inline int f1365_8(int x) { return x * 8; }
+inline int f1365_9(int x) { return x * 9; }
+inline int f1365_10(int x) { return x * 10; }
+inline int f1365_11(int x) { return x * 11; }
+inline int f1365_12(int x) { return x * 12; }
+inline int f1365_13(int x) { return x * 13; }
+inline int f1365_14(int x) { return x * 14; }
+inline int f1365_15(int x) { return x * 15; }
+inline int f1365_16(int x) { return x * 16; }
+inline int f1365_17(int x) { return x * 17; }
+inline int f1365_18(int x) { return x * 18; }
+inline int f1365_19(int x) { return x * 19; }
+inline int f1365_20(int x) { return x * 20; }
+inline int f1365_21(int x) { return x * 21; }
+inline int f1365_22(int x) { return x * 22; }
+inline int f1365_23(int x) { return x * 23; }
+inline int f1365_24(int x) { return x * 24; }
+inline int f1365_25(int x) { return x * 25; }
+inline int f1365_26(int x) { return x * 26; }
+inline int f1365_27(int x) { return x * 27; }
+inline int f1365_28(int x) { return x * 28; }
+inline int f1365_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1366 */
+#include <vector>
+#include "h8228.h"
+#include "h2963.h"
+#include "h6956.h"
+#include "h6983.h"
+#include "h9517.h"
+#ifdef X
+#include "h7304.h"
+#endif
+struct S1366 { int a; const char *s = "x//y"; };
+inline int f1366_0(int x) { return x * 0; }
+inline int f1366_1(int x) { return x * 1; }
+inline int f1366_2(int x) { return x * 2; }
+inline int f1366_3(int x) { return x * 3; }
+inline int f1366_4(int x) { return x * 4; }
+inline int f1366_5(int x) { return x * 5; }
+inline int f1366_6(int x) { return x * 6; }
+inline int f1366_7(int x) { return x * 7; }
+inline int f1366_8(int x) { return x * 8; }
+inline int f1366_9(int x) { return x * 9; }
+inline int f1366_10(int x) { return x * 10; }
+inline int f1366_11(int x) { return x * 11; }
+inline int f1366_12(int x) { return x * 12; }
+inline int f1366_13(int x) { return x * 13; }
+inline int f1366_14(int x) { return x * 14; }
+inline int f1366_15(int x) { return x * 15; }
+inline int f1366_16(int x) { return x * 16; }
+inline int f1366_17(int x) { return x * 17; }
+inline int f1366_18(int x) { return x * 18; }
+inline int f1366_19(int x) { return x * 19; }
+inline int f1366_20(int x) { return x * 20; }
+inline int f1366_21(int x) { return x * 21; }
+inline int f1366_22(int x) { return x * 22; }
+inline int f1366_23(int x) { return x * 23; }
+inline int f1366_24(int x) { return x * 24; }
+inline int f1366_25(int x) { return x * 25; }
+inline int f1366_26(int x) { return x * 26; }
+inline int f1366_27(int x) { return x * 27; }
+inline int f1366_28(int x) { return x * 28; }
+inline int f1366_29(int x) { return x * 29; }
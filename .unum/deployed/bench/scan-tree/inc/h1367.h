@@ -0,0 +1,42 @@
+#pragma once
+/* header 1367 */
+#include <vector>
+#include "h5508.h"
+#include "h7193.h"
+#include "h3169.h"
+#include "h1062.h"
+#include "h3361.h"
+#ifdef X
+#include "h6510.h"
+#endif
+struct S1367 { int a; const char *s = "x//y"; };
+inline int f1367_0(int x) { return x * 0; }
+inline int f1367_1(int x) { return x * 1; }
+inline int f1367_2(int x) { return x * 2; }
+inline int f1367_3(int x) { return x * 3; }
+inline int f1367_4(int x) { return x * 4; }
+inline int f1367_5(int x) { return x * 5; }
+inline int f1367_6(int x) { return x * 6; }
+inline int f1367_7(int x) { return x * 7; }
+inline int f1367_8(int x) { return x * 8; }
+inline int f1367_9(int x) { return x * 9; }
+inline int f1367_10(int x) { return x * 10; }
+inline int f1367_11(int x) { return x * 11; }
+inline int f1367_12(int x) { return x * 12; }
+inline int f1367_13(int x) { return x * 13; }
+inline int f1367_14(int x) { return x * 14; }
+inline int f1367_15(int x) { return x * 15; }
+inline int f1367_16(int x) { return x * 16; }
+inline int f1367_17(int x) { return x * 17; }
+inline int f1367_18(int x) { return x * 18; }
+inline int f1367_19(int x) { return x * 19; }
+inline int f1367_20(int x) { return x * 20; }
+inline int f1367_21(int x) { return x * 21; }
+inline int f1367_22(int x) { return x * 22; }
+inline int f1367_23(int x) { return x * 23; }
+inline int f1367_24(int x) { return x * 24; }
+inline int f1367_25(int x) { return x * 25; }
+inline int f1367_26(int x) { return x * 26; }
+inline int f1367_27(int x) { return x * 27; }
+inline int f1367_28(int x) { return x * 28; }
+inline int f1367_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1368 */
+#include <vector>
+#include "h7235.h"
+#include "h7884.h"
+#include "h1010.h"
+#include "h4187.h"
+#include "h9667.h"
+#ifdef X
+#include "h1023.h"
+#endif
+struct S1368 { int a; const char *s = "x//y"; };
+inline int f1368_0(int x) { return x * 0; }
+inline int f1368_1(int x) { return x * 1; }
+inline int f1368_2(int x) { return x * 2; }
+inline int f1368_3(int x) { return x * 3; }
+inline int f1368_4(int x) { return x * 4; }
+inline int f1368_5(int x) { return x * 5; }
+inline int f1368_6(int x) { return x * 6; }
+inline int f1368_7(int x) { return x * 7; }
+inline int f1368_8(int x) { return x * 8; }
+inline int f1368_9(int x) { return x * 9; }
+inline int f1368_10(int x) { return x * 10; }
+inline int f1368_11(int x) { return x * 11; }
+inline int f1368_12(int x) { return x * 12; }
+inline int f1368_13(int x) { return x * 13; }
+inline int f1368_14(int x) { return x * 14; }
+inline int f1368_15(int x) { return x * 15; }
+inline int f1368_16(int x) { return x * 16; }
+inline int f1368_17(int x) { return x * 17; }
+inline int f1368_18(int x) { return x * 18; }
+inline int f1368_19(int x) { return x * 19; }
+inline int f1368_20(int x) { return x * 20; }
+inline int f1368_21(int x) { return x * 21; }
+inline int f1368_22(int x) { return x * 22; }
+inline int f1368_23(int x) { return x * 23; }
+inline int f1368_24(int x) { return x * 24; }
+inline int f1368_25(int x) { return x * 25; }
+inline int f1368_26(int x) { return x * 26; }
+inline int f1368_27(int x) { return x * 27; }
+inline int f1368_28(int x) { return x * 28; }
+inline int f1368_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1369 */
+#include <vector>
+#include "h7938.h"
+#include "h6856.h"
+#include "h309.h"
+#include "h5657.h"
+#include "h2578.h"
+#ifdef X
+#include "h525.h"
+#endif
+struct S1369 { int a; const char *s = "x//y"; };
+inline int f1369_0(int x) { return x * 0; }
+inline int f1369_1(int x) { return x * 1; }
+inline int f1369_2(int x) { return x * 2; }
+inline int f1369_3(int x) { return x * 3; }
+inline int f1369_4(int x) { return x * 4; }
+inline int f1369_5(int x) { return x * 5; }
+inline int f1369_6(int x) { return x * 6; }
+inline int f1369_7(int x) { return x * 7; }
+inline int f1369_8(int x) { return x * 8; }
+inline int f1369_9(int x) { return x * 9; }
+inline int f1369_10(int x) { return x * 10; }
+inline int f1369_11(int x) { return x * 11; }
+inline int f1369_12(int x) { return x * 12; }
+inline int f1369_13(int x) { return x * 13; }
+inline int f1369_14(int x) { return x * 14; }
+inline int f1369_15(int x) { return x * 15; }
+inline int f1369_16(int x) { return x * 16; }
+inline int f1369_17(int x) { return x * 17; }
+inline int f1369_18(int x) { return x * 18; }
+inline int f1369_19(int x) { return x * 19; }
+inline int f1369_20(int x) { return x * 20; }
+inline int f1369_21(int x) { return x * 21; }
+inline int f1369_22(int x) { return x * 22; }
+inline int f1369_23(int x) { return x * 23; }
+inline int f1369_24(int x) { return x * 24; }
+inline int f1369_25(int x) { return x * 25; }
+inline int f1369_26(int x) { return x * 26; }
+inline int f1369_27(int x) { return x * 27; }
+inline int f1369_28(int x) { return x * 28; }
+inline int f1369_29(int x) { return x * 29; }
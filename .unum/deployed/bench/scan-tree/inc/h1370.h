@@ -0,0 +1,42 @@
+#pragma once
+/* header 1370 */
+#include <vector>
+#include "h7942.h"
+#include "h5388.h"
+#include "h6226.h"
+#include "h5014.h"
+#include "h2327.h"
+#ifdef X
+#include "h4650.h"
+#endif
+struct S1370 { int a; const char *s = "x//y"; };
+inline int f1370_0(int x) { return x * 0; }
+inline int f1370_1(int x) { return x * 1; }
+inline int f1370_2(int x) { return x * 2; }
+inline int f1370_3(int x) { return x * 3; }
+inline int f1370_4(int x) { return x * 4; }
+inline int f1370_5(int x) { return x * 5; }
+inline int f1370_6(int x) { return x * 6; }
+inline int f1370_7(int x) { return x * 7; }
+inline int f1370_8(int x) { return x * 8; }
+inline int f1370_9(int x) { return x * 9; }
+inline int f1370_10(int x) { return x * 10; }
+inline int f1370_11(int x) { return x * 11; }
+inline int f1370_12(int x) { return x * 12; }
+inline int f1370_13(int x) { return x * 13; }
+inline int f1370_14(int x) { return x * 14; }
+inline int f1370_15(int x) { return x * 15; }
+inline int f1370_16(int x) { return x * 16; }
+inline int f1370_17(int x) { return x * 17; }
+inline int f1370_18(int x) { return x * 18; }
+inline int f1370_19(int x) { return x * 19; }
+inline int f1370_20(int x) { return x * 20; }
+inline int f1370_21(int x) { return x * 21; }
+inline int f1370_22(int x) { return x * 22; }
+inline int f1370_23(int x) { return x * 23; }
+inline int f1370_24(int x) { return x * 24; }
+inline int f1370_25(int x) { return x * 25; }
+inline int f1370_26(int x) { return x * 26; }
+inline int f1370_27(int x) { return x * 27; }
+inline int f1370_28(int x) { return x * 28; }
+inline int f1370_29(int x) { return x * 29; }
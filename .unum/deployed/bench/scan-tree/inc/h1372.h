@@ -0,0 +1,42 @@
+#pragma once
+/* header 1372 */
+#include <vector>
+#include "h7814.h"
+#include "h3718.h"
+#include "h5507.h"
+#include "h4939.h"
+#include "h3746.h"
+#ifdef X
+#include "h3072.h"
+#endif
+struct S1372 { int a; const char *s = "x//y"; };
+inline int f1372_0(int x) { return x * 0; }
+inline int f1372_1(int x) { return x * 1; }
+inline int f1372_2(int x) { return x * 2; }
+inline int f1372_3(int x) { return x * 3; }
+inline int f1372_4(int x) { return x * 4; }
+inline int f1372_5(int x) { return x * 5; }
+inline int f1372_6(int x) { return x * 6; }
+inline int f1372_7(int x) { return x * 7; }
+inline int f1372_8(int x) { return x * 8; }
+inline int f1372_9(int x) { return x * 9; }
+inline int f1372_10(int x) { return x * 10; }
+inline int f1372_11(int x) { return x * 11; }
+inline int f1372_12(int x) { return x * 12; }
+inline int f1372_13(int x) { return x * 13; }
+inline int f1372_14(int x) { return x * 14; }
+inline int f1372_15(int x) { return x * 15; }
+inline int f1372_16(int x) { return x * 16; }
+inline int f1372_17(int x) { return x * 17; }
+inline int f1372_18(int x) { return x * 18; }
+inline int f1372_19(int x) { return x * 19; }
+inline int f1372_20(int x) { return x * 20; }
+inline int f1372_21(int x) { return x * 21; }
+inline int f1372_22(int x) { return x * 22; }
+inline int f1372_23(int x) { return x * 23; }
+inline int f1372_24(int x) { return x * 24; }
+inline int f1372_25(int x) { return x * 25; }
+inline int f1372_26(int x) { return x * 26; }
+inline int f1372_27(int x) { return x * 27; }
+inline int f1372_28(int x) { return x * 28; }
+inline int f1372_29(int x) { return x * 29; }
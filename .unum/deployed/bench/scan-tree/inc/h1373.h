@@ -0,0 +1,42 @@
+#pragma once
+/* header 1373 */
+#include <vector>
+#include "h4082.h"
+#include "h8027.h"
+#include "h5197.h"
+#include "h284.h"
+#include "h3847.h"
+#ifdef X
+#include "h621.h"
+#endif
+struct S1373 { int a; const char *s = "x//y"; };
+inline int f1373_0(int x) { return x * 0; }
+inline int f1373_1(int x) { return x * 1; }
+inline int f1373_2(int x) { return x * 2; }
+inline int f1373_3(int x) { return x * 3; }
+inline int f1373_4(int x) { return x * 4; }
+inline int f1373_5(int x) { return x * 5; }
+inline int f1373_6(int x) { return x * 6; }
+inline int f1373_7(int x) { return x * 7; }
+inline int f1373_8(int x) { return x * 8; }
+inline int f1373_9(int x) { return x * 9; }
+inline int f1373_10(int x) { return x * 10; }
+inline int f1373_11(int x) { return x * 11; }
+inline int f1373_12(int x) { return x * 12; }
+inline int f1373_13(int x) { return x * 13; }
+inline int f1373_14(int x) { return x * 14; }
+inline int f1373_15(int x) { return x * 15; }
+inline int f1373_16(int x) { return x * 16; }
+inline int f1373_17(int x) { return x * 17; }
+inline int f1373_18(int x) { return x * 18; }
+inline int f1373_19(int x) { return x * 19; }
+inline int f1373_20(int x) { return x * 20; }
+inline int f1373_21(int x) { return x * 21; }
+inline int f1373_22(int x) { return x * 22; }
+inline int f1373_23(int x) { return x * 23; }
+inline int f1373_24(int x) { return x * 24; }
+inline int f1373_25(int x) { return x * 25; }
+inline int f1373_26(int x) { return x * 26; }
+inline int f1373_27(int x) { return x * 27; }
+inline int f1373_28(int x) { return x * 28; }
+inline int f1373_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1374 */
+#include <vector>
+#include "h5877.h"
+#include "h5244.h"
+#include "h1599.h"
+#include "h1644.h"
+#include "h8729.h"
+#ifdef X
+#include "h2844.h"
+#endif
+struct S1374 { int a; const char *s = "x//y"; };
+inline int f1374_0(int x) { return x * 0; }
+inline int f1374_1(int x) { return x * 1; }
+inline int f1374_2(int x) { return x * 2; }
+inline int f1374_3(int x) { return x * 3; }
+inline int f1374_4(int x) { return x * 4; }
+inline int f1374_5(int x) { return x * 5; }
+inline int f1374_6(int x) { return x * 6; }
+inline int f1374_7(int x) { return x * 7; }
+inline int f1374_8(int x) { return x * 8; }
+inline int f1374_9(int x) { return x * 9; }
+inline int f1374_10(int x) { return x * 10; }
+inline int f1374_11(int x) { return x * 11; }
+inline int f1374_12(int x) { return x * 12; }
+inline int f1374_13(int x) { return x * 13; }
+inline int f1374_14(int x) { return x * 14; }
+inline int f1374_15(int x) { return x * 15; }
+inline int f1374_16(int x) { return x * 16; }
+inline int f1374_17(int x) { return x * 17; }
+inline int f1374_18(int x) { return x * 18; }
+inline int f1374_19(int x) { return x * 19; }
+inline int f1374_20(int x) { return x * 20; }
+inline int f1374_21(int x) { return x * 21; }
+inline int f1374_22(int x) { return x * 22; }
+inline int f1374_23(int x) { return x * 23; }
+inline int f1374_24(int x) { return x * 24; }
+inline int f1374_25(int x) { return x * 25; }
+inline int f1374_26(int x) { return x * 26; }
+inline int f1374_27(int x) { return x * 27; }
+inline int f1374_28(int x) { return x * 28; }
+inline int f1374_29(int x) { return x * 29; }
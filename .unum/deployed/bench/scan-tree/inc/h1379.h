@@ -0,0 +1,42 @@
+#pragma once
+/* header 1379 */
+#include <vector>
+#include "h1172.h"
+#include "h7450.h"
+#include "h1901.h"
+#include "h8344.h"
+#include "h5547.h"
+#ifdef X
+#include "h509.h"
+#endif
+struct S1379 { int a; const char *s = "x//y"; };
+inline int f1379_0(int x) { return x * 0; }
+inline int f1379_1(int x) { return x * 1; }
+inline int f1379_2(int x) { return x * 2; }
+inline int f1379_3(int x) { return x * 3; }
+inline int f1379_4(int x) { return x * 4; }
+inline int f1379_5(int x) { return x * 5; }
+inline int f1379_6(int x) { return x * 6; }
+inline int f1379_7(int x) { return x * 7; }
+inline int f1379_8(int x) { return x * 8; }
+inline int f1379_9(int x) { return x * 9; }
+inline int f1379_10(int x) { return x * 10; }
+inline int f1379_11(int x) { return x * 11; }
+inline int f1379_12(int x) { return x * 12; }
+inline int f1379_13(int x) { return x * 13; }
+inline int f1379_14(int x) { return x * 14; }
+inline int f1379_15(int x) { return x * 15; }
+inline int f1379_16(int x) { return x * 16; }
+inline int f1379_17(int x) { return x * 17; }
+inline int f1379_18(int x) { return x * 18; }
+inline int f1379_19(int x) { return x * 19; }
+inline int f1379_20(int x) { return x * 20; }
+inline int f1379_21(int x) { return x * 21; }
+inline int f1379_22(int x) { return x * 22; }
+inline int f1379_23(int x) { return x * 23; }
+inline int f1379_24(int x) { return x * 24; }
+inline int f1379_25(int x) { return x * 25; }
+inline int f1379_26(int x) { return x * 26; }
+inline int f1379_27(int x) { return x * 27; }
+inline int f1379_28(int x) { return x * 28; }
+inline int f1379_29(int x) { return x * 29; }
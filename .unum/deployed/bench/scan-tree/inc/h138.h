@@ -0,0 +1,42 @@
+#pragma once
+/* header 138 */
+#include <vector>
+#include "h3981.h"
+#include "h3974.h"
+#include "h2496.h"
+#include "h3389.h"
+#include "h875.h"
+#ifdef X
+#include "h1397.h"
+#endif
+struct S138 { int a; const char *s = "x//y"; };
+inline int f138_0(int x) { return x * 0; }
+inline int f138_1(int x) { return x * 1; }
+inline int f138_2(int x) { return x * 2; }
+inline int f138_3(int x) { return x * 3; }
+inline int f138_4(int x) { return x * 4; }
+inline int f138_5(int x) { return x * 5; }
+inline int f138_6(int x) { return x * 6; }
+inline int f138_7(int x) { return x * 7; }
+inline int f138_8(int x) { return x * 8; }
+inline int f138_9(int x) { return x * 9; }
+inline int f138_10(int x) { return x * 10; }
+inline int f138_11(int x) { return x * 11; }
+inline int f138_12(int x) { return x * 12; }
+inline int f138_13(int x) { return x * 13; }
+inline int f138_14(int x) { return x * 14; }
+inline int f138_15(int x) { return x * 15; }
+inline int f138_16(int x) { return x * 16; }
+inline int f138_17(int x) { return x * 17; }
+inline int f138_18(int x) { return x * 18; }
+inline int f138_19(int x) { return x * 19; }
+inline int f138_20(int x) { return x * 20; }
+inline int f138_21(int x) { return x * 21; }
+inline int f138_22(int x) { return x * 22; }
+inline int f138_23(int x) { return x * 23; }
+inline int f138_24(int x) { return x * 24; }
+inline int f138_25(int x) { return x * 25; }
+inline int f138_26(int x) { return x * 26; }
+inline int f138_27(int x) { return x * 27; }
+inline int f138_28(int x) { return x * 28; }
+inline int f138_29(int x) { return x * 29; }
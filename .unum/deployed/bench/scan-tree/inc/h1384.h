@@ -0,0 +1,42 @@
+#pragma once
+/* header 1384 */
+#include <vector>
+#include "h9944.h"
+#include "h8846.h"
+#include "h7759.h"
+#include "h5379.h"
+#include "h4917.h"
+#ifdef X
+#include "h461.h"
+#endif
+struct S1384 { int a; const char *s = "x//y"; };
+inline int f1384_0(int x) { return x * 0; }
+inline int f1384_1(int x) { return x * 1; }
+inline int f1384_2(int x) { return x * 2; }
+inline int f1384_3(int x) { return x * 3; }
+inline int f1384_4(int x) { return x * 4; }
+inline int f1384_5(int x) { return x * 5; }
+inline int f1384_6(int x) { return x * 6; }
+inline int f1384_7(int x) { return x * 7; }
+inline int f1384_8(int x) { return x * 8; }
+inline int f1384_9(int x) { return x * 9; }
+inline int f1384_10(int x) { return x * 10; }
+inline int f1384_11(int x) { return x * 11; }
+inline int f1384_12(int x) { return x * 12; }
+inline int f1384_13(int x) { return x * 13; }
+inline int f1384_14(int x) { return x * 14; }
+inline int f1384_15(int x) { return x * 15; }
+inline int f1384_16(int x) { return x * 16; }
+inline int f1384_17(int x) { return x * 17; }
+inline int f1384_18(int x) { return x * 18; }
+inline int f1384_19(int x) { return x * 19; }
+inline int f1384_20(int x) { return x * 20; }
+inline int f1384_21(int x) { return x * 21; }
+inline int f1384_22(int x) { return x * 22; }
+inline int f1384_23(int x) { return x * 23; }
+inline int f1384_24(int x) { return x * 24; }
+inline int f1384_25(int x) { return x * 25; }
+inline int f1384_26(int x) { return x * 26; }
+inline int f1384_27(int x) { return x * 27; }
+inline int f1384_28(int x) { return x * 28; }
+inline int f1384_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1385 */
+#include <vector>
+#include "h3595.h"
+#include "h5562.h"
+#include "h8882.h"
+#include "h8779.h"
+#include "h2838.h"
+#ifdef X
+#include "h8546.h"
+#endif
+struct S1385 { int a; const char *s = "x//y"; };
+inline int f1385_0(int x) { return x * 0; }
+inline int f1385_1(int x) { return x * 1; }
+inline int f1385_2(int x) { return x * 2; }
+inline int f1385_3(int x) { return x * 3; }
+inline int f1385_4(int x) { return x * 4; }
+inline int f1385_5(int x) { return x * 5; }
+inline int f1385_6(int x) { return x * 6; }
+inline int f1385_7(int x) { return x * 7; }
+inline int f1385_8(int x) { return x * 8; }
+inline int f1385_9(int x) { return x * 9; }
+inline int f1385_10(int x) { return x * 10; }
+inline int f1385_11(int x) { return x * 11; }
+inline int f1385_12(int x) { return x * 12; }
+inline int f1385_13(int x) { return x * 13; }
+inline int f1385_14(int x) { return x * 14; }
+inline int f1385_15(int x) { return x * 15; }
+inline int f1385_16(int x) { return x * 16; }
+inline int f1385_17(int x) { return x * 17; }
+inline int f1385_18(int x) { return x * 18; }
+inline int f1385_19(int x) { return x * 19; }
+inline int f1385_20(int x) { return x * 20; }
+inline int f1385_21(int x) { return x * 21; }
+inline int f1385_22(int x) { return x * 22; }
+inline int f1385_23(int x) { return x * 23; }
+inline int f1385_24(int x) { return x * 24; }
+inline int f1385_25(int x) { return x * 25; }
+inline int f1385_26(int x) { return x * 26; }
+inline int f1385_27(int x) { return x * 27; }
+inline int f1385_28(int x) { return x * 28; }
+inline int f1385_29(int x) { return x * 29; }
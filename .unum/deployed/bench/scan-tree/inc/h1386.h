@@ -0,0 +1,42 @@
+#pragma once
+/* header 1386 */
+#include <vector>
+#include "h5376.h"
+#include "h3108.h"
+#include "h8448.h"
+#include "h9349.h"
+#include "h8057.h"
+#ifdef X
+#include "h3575.h"
+#endif
+struct S1386 { int a; const char *s = "x//y"; };
+inline int f1386_0(int x) { return x * 0; }
+inline int f1386_1(int x) { return x * 1; }
+inline int f1386_2(int x) { return x * 2; }
+inline int f1386_3(int x) { return x * 3; }
+inline int f1386_4(int x) { return x * 4; }
+inline int f1386_5(int x) { return x * 5; }
+inline int f1386_6(int x) { return x * 6; }
+inline int f1386_7(int x) { return x * 7; }
+inline int f1386_8(int x) { return x * 8; }
+inline int f1386_9(int x) { return x * 9; }
+inline int f1386_10(int x) { return x * 10; }
+inline int f1386_11(int x) { return x * 11; }
+inline int f1386_12(int x) { return x * 12; }
+inline int f1386_13(int x) { return x * 13; }
+inline int f1386_14(int x) { return x * 14; }
+inline int f1386_15(int x) { return x * 15; }
+inline int f1386_16(int x) { return x * 16; }
+inline int f1386_17(int x) { return x * 17; }
+inline int f1386_18(int x) { return x * 18; }
+inline int f1386_19(int x) { return x * 19; }
+inline int f1386_20(int x) { return x * 20; }
+inline int f1386_21(int x) { return x * 21; }
+inline int f1386_22(int x) { return x * 22; }
+inline int f1386_23(int x) { return x * 23; }
+inline int f1386_24(int x) { return x * 24; }
+inline int f1386_25(int x) { return x * 25; }
+inline int f1386_26(int x) { return x * 26; }
+inline int f1386_27(int x) { return x * 27; }
+inline int f1386_28(int x) { return x * 28; }
+inline int f1386_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1387 */
+#include <vector>
+#include "h956.h"
+#include "h4187.h"
+#include "h2127.h"
+#include "h9763.h"
+#include "h4773.h"
+#ifdef X
+#include "h5317.h"
+#endif
+struct S1387 { int a; const char *s = "x//y"; };
+inline int f1387_0(int x) { return x * 0; }
+inline int f1387_1(int x) { return x * 1; }
+inline int f1387_2(int x) { return x * 2; }
+inline int f1387_3(int x) { return x * 3; }
+inline int f1387_4(int x) { return x * 4; }
+inline int f1387_5(int x) { return x * 5; }
+inline int f1387_6(int x) { return x * 6; }
+inline int f1387_7(int x) { return x * 7; }
+inline int f1387_8(int x) { return x * 8; }
+inline int f1387_9(int x) { return x * 9; }
+inline int f1387_10(int x) { return x * 10; }
+inline int f1387_11(int x) { return x * 11; }
+inline int f1387_12(int x) { return x * 12; }
+inline int f1387_13(int x) { return x * 13; }
+inline int f1387_14(int x) { return x * 14; }
+inline int f1387_15(int x) { return x * 15; }
+inline int f1387_16(int x) { return x * 16; }
+inline int f1387_17(int x) { return x * 17; }
+inline int f1387_18(int x) { return x * 18; }
+inline int f1387_19(int x) { return x * 19; }
+inline int f1387_20(int x) { return x * 20; }
+inline int f1387_21(int x) { return x * 21; }
+inline int f1387_22(int x) { return x * 22; }
+inline int f1387_23(int x) { return x * 23; }
+inline int f1387_24(int x) { return x * 24; }
+inline int f1387_25(int x) { return x * 25; }
+inline int f1387_26(int x) { return x * 26; }
+inline int f1387_27(int x) { return x * 27; }
+inline int f1387_28(int x) { return x * 28; }
+inline int f1387_29(int x) { return x * 29; }
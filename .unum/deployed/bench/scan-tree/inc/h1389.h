@@ -0,0 +1,42 @@
+#pragma once
+/* header 1389 */
+#include <vector>
+#include "h8054.h"
+#include "h2660.h"
+#include "h5117.h"
+#include "h7246.h"
+#include "h1284.h"
+#ifdef X
+#include "h4991.h"
+#endif
+struct S1389 { int a; const char *s = "x//y"; };
+inline int f1389_0(int x) { return x * 0; }
+inline int f1389_1(int x) { return x * 1; }
+inline int f1389_2(int x) { return x * 2; }
+inline int f1389_3(int x) { return x * 3; }
+inline int f1389_4(int x) { return x * 4; }
+inline int f1389_5(int x) { return x * 5; }
+inline int f1389_6(int x) { return x * 6; }
+inline int f1389_7(int x) { return x * 7; }
+inline int f1389_8(int x) { return x * 8; }
+inline int f1389_9(int x) { return x * 9; }
+inline int f1389_10(int x) { return x * 10; }
+inline int f1389_11(int x) { return x * 11; }
+inline int f1389_12(int x) { return x * 12; }
+inline int f1389_13(int x) { return x * 13; }
+inline int f1389_14(int x) { return x * 14; }
+inline int f1389_15(int x) { return x * 15; }
+inline int f1389_16(int x) { return x * 16; }
+inline int f1389_17(int x) { return x * 17; }
+inline int f1389_18(int x) { return x * 18; }
+inline int f1389_19(int x) { return x * 19; }
+inline int f1389_20(int x) { return x * 20; }
+inline int f1389_21(int x) { return x * 21; }
+inline int f1389_22(int x) { return x * 22; }
+inline int f1389_23(int x) { return x * 23; }
+inline int f1389_24(int x) { return x * 24; }
+inline int f1389_25(int x) { return x * 25; }
+inline int f1389_26(int x) { return x * 26; }
+inline int f1389_27(int x) { return x * 27; }
+inline int f1389_28(int x) { return x * 28; }
+inline int f1389_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1391 */
+#include <vector>
+#include "h53.h"
+#include "h8333.h"
+#include "h3551.h"
+#include "h362.h"
+#include "h2727.h"
+#ifdef X
+#include "h3712.h"
+#endif
+struct S1391 { int a; const char *s = "x//y"; };
+inline int f1391_0(int x) { return x * 0; }
+inline int f1391_1(int x) { return x * 1; }
+inline int f1391_2(int x) { return x * 2; }
+inline int f1391_3(int x) { return x * 3; }
+inline int f1391_4(int x) { return x * 4; }
+inline int f1391_5(int x) { return x * 5; }
+inline int f1391_6(int x) { return x * 6; }
+inline int f1391_7(int x) { return x * 7; }
+inline int f1391_8(int x) { return x * 8; }
+inline int f1391_9(int x) { return x * 9; }
+inline int f1391_10(int x) { return x * 10; }
+inline int f1391_11(int x) { return x * 11; }
+inline int f1391_12(int x) { return x * 12; }
+inline int f1391_13(int x) { return x * 13; }
+inline int f1391_14(int x) { return x * 14; }
+inline int f1391_15(int x) { return x * 15; }
+inline int f1391_16(int x) { return x * 16; }
+inline int f1391_17(int x) { return x * 17; }
+inline int f1391_18(int x) { return x * 18; }
+inline int f1391_19(int x) { return x * 19; }
+inline int f1391_20(int x) { return x * 20; }
+inline int f1391_21(int x) { return x * 21; }
+inline int f1391_22(int x) { return x * 22; }
+inline int f1391_23(int x) { return x * 23; }
+inline int f1391_24(int x) { return x * 24; }
+inline int f1391_25(int x) { return x * 25; }
+inline int f1391_26(int x) { return x * 26; }
+inline int f1391_27(int x) { return x * 27; }
+inline int f1391_28(int x) { return x * 28; }
+inline int f1391_29(int x) { return x * 29; }
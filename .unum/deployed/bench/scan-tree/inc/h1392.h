@@ -0,0 +1,42 @@
+#pragma once
+/* header 1392 */
+#include <vector>
+#include "h3595.h"
+#include "h4002.h"
+#include "h7035.h"
+#include "h1020.h"
+#include "h5733.h"
+#ifdef X
+#include "h6312.h"
+#endif
+struct S1392 { int a; const char *s = "x//y"; };
+inline int f1392_0(int x) { return x * 0; }
+inline int f1392_1(int x) { return x * 1; }
+inline int f1392_2(int x) { return x * 2; }
+inline int f1392_3(int x) { return x * 3; }
+inline int f1392_4(int x) { return x * 4; }
+inline int f1392_5(int x) { return x * 5; }
+inline int f1392_6(int x) { return x * 6; }
+inline int f1392_7(int x) { return x * 7; }
+inline int f1392_8(int x) { return x * 8; }
+inline int f1392_9(int x) { return x * 9; }
+inline int f1392_10(int x) { return x * 10; }
+inline int f1392_11(int x) { return x * 11; }
+inline int f1392_12(int x) { return x * 12; }
+inline int f1392_13(int x) { return x * 13; }
+inline int f1392_14(int x) { return x * 14; }
+inline int f1392_15(int x) { return x * 15; }
+inline int f1392_16(int x) { return x * 16; }
+inline int f1392_17(int x) { return x * 17; }
+inline int f1392_18(int x) { return x * 18; }
+inline int f1392_19(int x) { return x * 19; }
+inline int f1392_20(int x) { return x * 20; }
+inline int f1392_21(int x) { return x * 21; }
+inline int f1392_22(int x) { return x * 22; }
+inline int f1392_23(int x) { return x * 23; }
+inline int f1392_24(int x) { return x * 24; }
+inline int f1392_25(int x) { return x * 25; }
+inline int f1392_26(int x) { return x * 26; }
+inline int f1392_27(int x) { return x * 27; }
+inline int f1392_28(int x) { return x * 28; }
+inline int f1392_29(int x) { return x * 29; }
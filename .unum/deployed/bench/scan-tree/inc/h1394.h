@@ -0,0 +1,42 @@
+#pragma once
+/* header 1394 */
+#include <vector>
+#include "h8031.h"
+#include "h3205.h"
+#include "h4522.h"
+#include "h7011.h"
+#include "h1801.h"
+#ifdef X
+#include "h1246.h"
+#endif
+struct S1394 { int a; const char *s = "x//y"; };
+inline int f1394_0(int x) { return x * 0; }
+inline int f1394_1(int x) { return x * 1; }
+inline int f1394_2(int x) { return x * 2; }
+inline int f1394_3(int x) { return x * 3; }
+inline int f1394_4(int x) { return x * 4; }
+inline int f1394_5(int x) { return x * 5; }
+inline int f1394_6(int x) { return x * 6; }
+inline int f1394_7(int x) { return x * 7; }
+inline int f1394_8(int x) { return x * 8; }
+inline int f1394_9(int x) { return x * 9; }
+inline int f1394_10(int x) { return x * 10; }
+inline int f1394_11(int x) { return x * 11; }
+inline int f1394_12(int x) { return x * 12; }
+inline int f1394_13(int x) { return x * 13; }
+inline int f1394_14(int x) { return x * 14; }
+inline int f1394_15(int x) { return x * 15; }
+inline int f1394_16(int x) { return x * 16; }
+inline int f1394_17(int x) { return x * 17; }
+inline int f1394_18(int x) { return x * 18; }
+inline int f1394_19(int x) { return x * 19; }
+inline int f1394_20(int x) { return x * 20; }
+inline int f1394_21(int x) { return x * 21; }
+inline int f1394_22(int x) { return x * 22; }
+inline int f1394_23(int x) { return x * 23; }
+inline int f1394_24(int x) { return x * 24; }
+inline int f1394_25(int x) { return x * 25; }
+inline int f1394_26(int x) { return x * 26; }
+inline int f1394_27(int x) { return x * 27; }
+inline int f1394_28(int x) { return x * 28; }
+inline int f1394_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1395 */
+#include <vector>
+#include "h205.h"
+#include "h458.h"
+#include "h5377.h"
+#include "h9984.h"
+#include "h2425.h"
+#ifdef X
+#include "h2387.h"
+#endif
+struct S1395 { int a; const char *s = "x//y"; };
+inline int f1395_0(int x) { return x * 0; }
+inline int f1395_1(int x) { return x * 1; }
+inline int f1395_2(int x) { return x * 2; }
+inline int f1395_3(int x) { return x * 3; }
+inline int f1395_4(int x) { return x * 4; }
+inline int f1395_5(int x) { return x * 5; }
+inline int f1395_6(int x) { return x * 6; }
+inline int f1395_7(int x) { return x * 7; }
+inline int f1395_8(int x) { return x * 8; }
+inline int f1395_9(int x) { return x * 9; }
+inline int f1395_10(int x) { return x * 10; }
+inline int f1395_11(int x) { return x * 11; }
+inline int f1395_12(int x) { return x * 12; }
+inline int f1395_13(int x) { return x * 13; }
+inline int f1395_14(int x) { return x * 14; }
+inline int f1395_15(int x) { return x * 15; }
+inline int f1395_16(int x) { return x * 16; }
+inline int f1395_17(int x) { return x * 17; }
+inline int f1395_18(int x) { return x * 18; }
+inline int f1395_19(int x) { return x * 19; }
+inline int f1395_20(int x) { return x * 20; }
+inline int f1395_21(int x) { return x * 21; }
+inline int f1395_22(int x) { return x * 22; }
+inline int f1395_23(int x) { return x * 23; }
+inline int f1395_24(int x) { return x * 24; }
+inline int f1395_25(int x) { return x * 25; }
+inline int f1395_26(int x) { return x * 26; }
+inline int f1395_27(int x) { return x * 27; }
+inline int f1395_28(int x) { return x * 28; }
+inline int f1395_29(int x) { return x * 29; }
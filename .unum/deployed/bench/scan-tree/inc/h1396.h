@@ -0,0 +1,42 @@
+#pragma once
+/* header 1396 */
+#include <vector>
+#include "h2053.h"
+#include "h472.h"
+#include "h7944.h"
+#include "h5484.h"
+#include "h326.h"
+#ifdef X
+#include "h7243.h"
+#endif
+struct S1396 { int a; const char *s = "x//y"; };
+inline int f1396_0(int x) { return x * 0; }
+inline int f1396_1(int x) { return x * 1; }
+inline int f1396_2(int x) { return x * 2; }
+inline int f1396_3(int x) { return x * 3; }
+inline int f1396_4(int x) { return x * 4; }
+inline int f1396_5(int x) { return x * 5; }
+inline int f1396_6(int x) { return x * 6; }
+inline int f1396_7(int x) { return x * 7; }
+inline int f1396_8(int x) { return x * 8; }
+inline int f1396_9(int x) { return x * 9; }
+inline int f1396_10(int x) { return x * 10; }
+inline int f1396_11(int x) { return x * 11; }
+inline int f1396_12(int x) { return x * 12; }
+inline int f1396_13(int x) { return x * 13; }
+inline int f1396_14(int x) { return x * 14; }
+inline int f1396_15(int x) { return x * 15; }
+inline int f1396_16(int x) { return x * 16; }
+inline int f1396_17(int x) { return x * 17; }
+inline int f1396_18(int x) { return x * 18; }
+inline int f1396_19(int x) { return x * 19; }
+inline int f1396_20(int x) { return x * 20; }
+inline int f1396_21(int x) { return x * 21; }
+inline int f1396_22(int x) { return x * 22; }
+inline int f1396_23(int x) { return x * 23; }
+inline int f1396_24(int x) { return x * 24; }
+inline int f1396_25(int x) { return x * 25; }
+inline int f1396_26(int x) { return x * 26; }
+inline int f1396_27(int x) { return x * 27; }
+inline int f1396_28(int x) { return x * 28; }
+inline int f1396_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1397 */
+#include <vector>
+#include "h4.h"
+#include "h2524.h"
+#include "h7083.h"
+#include "h5224.h"
+#include "h1909.h"
+#ifdef X
+#include "h5906.h"
+#endif
+struct S1397 { int a; const char *s = "x//y"; };
+inline int f1397_0(int x) { return x * 0; }
+inline int f1397_1(int x) { return x * 1; }
+inline int f1397_2(int x) { return x * 2; }
+inline int f1397_3(int x) { return x * 3; }
+inline int f1397_4(int x) { return x * 4; }
+inline int f1397_5(int x) { return x * 5; }
+inline int f1397_6(int x) { return x * 6; }
+inline int f1397_7(int x) { return x * 7; }
+inline int f1397_8(int x) { return x * 8; }
+inline int f1397_9(int x) { return x * 9; }
+inline int f1397_10(int x) { return x * 10; }
+inline int f1397_11(int x) { return x * 11; }
+inline int f1397_12(int x) { return x * 12; }
+inline int f1397_13(int x) { return x * 13; }
+inline int f1397_14(int x) { return x * 14; }
+inline int f1397_15(int x) { return x * 15; }
+inline int f1397_16(int x) { return x * 16; }
+inline int f1397_17(int x) { return x * 17; }
+inline int f1397_18(int x) { return x * 18; }
+inline int f1397_19(int x) { return x * 19; }
+inline int f1397_20(int x) { return x * 20; }
+inline int f1397_21(int x) { return x * 21; }
+inline int f1397_22(int x) { return x * 22; }
+inline int f1397_23(int x) { return x * 23; }
+inline int f1397_24(int x) { return x * 24; }
+inline int f1397_25(int x) { return x * 25; }
+inline int f1397_26(int x) { return x * 26; }
+inline int f1397_27(int x) { return x * 27; }
+inline int f1397_28(int x) { return x * 28; }
+inline int f1397_29(int x) { return x * 29; }
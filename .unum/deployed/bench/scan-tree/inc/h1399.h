@@ -0,0 +1,42 @@
+#pragma once
+/* header 1399 */
+#include <vector>
+#include "h3771.h"
+#include "h5321.h"
+#include "h1225.h"
+#include "h5191.h"
+#include "h4373.h"
+#ifdef X
+#include "h5786.h"
+#endif
+struct S1399 { int a; const char *s = "x//y"; };
+inline int f1399_0(int x) { return x * 0; }
+inline int f1399_1(int x) { return x * 1; }
+inline int f1399_2(int x) { return x * 2; }
+inline int f1399_3(int x) { return x * 3; }
+inline int f1399_4(int x) { return x * 4; }
+inline int f1399_5(int x) { return x * 5; }
+inline int f1399_6(int x) { return x * 6; }
+inline int f1399_7(int x) { return x * 7; }
+inline int f1399_8(int x) { return x * 8; }
+inline int f1399_9(int x) { return x * 9; }
+inline int f1399_10(int x) { return x * 10; }
+inline int f1399_11(int x) { return x * 11; }
+inline int f1399_12(int x) { return x * 12; }
+inline int f1399_13(int x) { return x * 13; }
+inline int f1399_14(int x) { return x * 14; }
+inline int f1399_15(int x) { return x * 15; }
+inline int f1399_16(int x) { return x * 16; }
+inline int f1399_17(int x) { return x * 17; }
+inline int f1399_18(int x) { return x * 18; }
+inline int f1399_19(int x) { return x * 19; }
+inline int f1399_20(int x) { return x * 20; }
+inline int f1399_21(int x) { return x * 21; }
+inline int f1399_22(int x) { return x * 22; }
+inline int f1399_23(int x) { return x * 23; }
+inline int f1399_24(int x) { return x * 24; }
+inline int f1399_25(int x) { return x * 25; }
+inline int f1399_26(int x) { return x * 26; }
+inline int f1399_27(int x) { return x * 27; }
+inline int f1399_28(int x) { return x * 28; }
+inline int f1399_29(int x) { return x * 29; }
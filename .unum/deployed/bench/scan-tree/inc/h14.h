@@ -0,0 +1,42 @@
+#pragma once
+/* header 14 */
+#include <vector>
+#include "h7907.h"
+#include "h5839.h"
+#include "h8397.h"
+#include "h4969.h"
+#include "h9339.h"
+#ifdef X
+#include "h1491.h"
+#endif
+struct S14 { int a; const char *s = "x//y"; };
+inline int f14_0(int x) { return x * 0; }
+inline int f14_1(int x) { return x * 1; }
+inline int f14_2(int x) { return x * 2; }
+inline int f14_3(int x) { return x * 3; }
+inline int f14_4(int x) { return x * 4; }
+inline int f14_5(int x) { return x * 5; }
+inline int f14_6(int x) { return x * 6; }
+inline int f14_7(int x) { return x * 7; }
+inline int f14_8(int x) { return x * 8; }
+inline int f14_9(int x) { return x * 9; }
+inline int f14_10(int x) { return x * 10; }
+inline int f14_11(int x) { return x * 11; }
+inline int f14_12(int x) { return x * 12; }
+inline int f14_13(int x) { return x * 13; }
+inline int f14_14(int x) { return x * 14; }
+inline int f14_15(int x) { return x * 15; }
+inline int f14_16(int x) { return x * 16; }
+inline int f14_17(int x) { return x * 17; }
+inline int f14_18(int x) { return x * 18; }
+inline int f14_19(int x) { return x * 19; }
+inline int f14_20(int x) { return x * 20; }
+inline int f14_21(int x) { return x * 21; }
+inline int f14_22(int x) { return x * 22; }
+inline int f14_23(int x) { return x * 23; }
+inline int f14_24(int x) { return x * 24; }
+inline int f14_25(int x) { return x * 25; }
+inline int f14_26(int x) { return x * 26; }
+inline int f14_27(int x) { return x * 27; }
+inline int f14_28(int x) { return x * 28; }
+inline int f14_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1400 */
+#include <vector>
+#include "h7694.h"
+#include "h8780.h"
+#include "h5604.h"
+#include "h1465.h"
+#include "h443.h"
+#ifdef X
+#include "h3397.h"
+#endif
+struct S1400 { int a; const char *s = "x//y"; };
+inline int f1400_0(int x) { return x * 0; }
+inline int f1400_1(int x) { return x * 1; }
+inline int f1400_2(int x) { return x * 2; }
+inline int f1400_3(int x) { return x * 3; }
+inline int f1400_4(int x) { return x * 4; }
+inline int f1400_5(int x) { return x * 5; }
+inline int f1400_6(int x) { return x * 6; }
+inline int f1400_7(int x) { return x * 7; }
+inline int f1400_8(int x) { return x * 8; }
+inline int f1400_9(int x) { return x * 9; }
+inline int f1400_10(int x) { return x * 10; }
+inline int f1400_11(int x) { return x * 11; }
+inline int f1400_12(int x) { return x * 12; }
+inline int f1400_13(int x) { return x * 13; }
+inline int f1400_14(int x) { return x * 14; }
+inline int f1400_15(int x) { return x * 15; }
+inline int f1400_16(int x) { return x * 16; }
+inline int f1400_17(int x) { return x * 17; }
+inline int f1400_18(int x) { return x * 18; }
+inline int f1400_19(int x) { return x * 19; }
+inline int f1400_20(int x) { return x * 20; }
+inline int f1400_21(int x) { return x * 21; }
+inline int f1400_22(int x) { return x * 22; }
+inline int f1400_23(int x) { return x * 23; }
+inline int f1400_24(int x) { return x * 24; }
+inline int f1400_25(int x) { return x * 25; }
+inline int f1400_26(int x) { return x * 26; }
+inline int f1400_27(int x) { return x * 27; }
+inline int f1400_28(int x) { return x * 28; }
+inline int f1400_29(int x) { return x * 29; }
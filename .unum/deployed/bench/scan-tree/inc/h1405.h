@@ -0,0 +1,42 @@
+#pragma once
+/* header 1405 */
+#include <vector>
+#include "h420.h"
+#include "h2901.h"
+#include "h515.h"
+#include "h6156.h"
+#include "h6926.h"
+#ifdef X
+#include "h3386.h"
+#endif
+struct S1405 { int a; const char *s = "x//y"; };
+inline int f1405_0(int x) { return x * 0; }
+inline int f1405_1(int x) { return x * 1; }
+inline int f1405_2(int x) { return x * 2; }
+inline int f1405_3(int x) { return x * 3; }
+inline int f1405_4(int x) { return x * 4; }
+inline int f1405_5(int x) { return x * 5; }
+inline int f1405_6(int x) { return x * 6; }
+inline int f1405_7(int x) { return x * 7; }
+inline int f1405_8(int x) { return x * 8; }
+inline int f1405_9(int x) { return x * 9; }
+inline int f1405_10(int x) { return x * 10; }
+inline int f1405_11(int x) { return x * 11; }
+inline int f1405_12(int x) { return x * 12; }
+inline int f1405_13(int x) { return x * 13; }
+inline int f1405_14(int x) { return x * 14; }
+inline int f1405_15(int x) { return x * 15; }
+inline int f1405_16(int x) { return x * 16; }
+inline int f1405_17(int x) { return x * 17; }
+inline int f1405_18(int x) { return x * 18; }
+inline int f1405_19(int x) { return x * 19; }
+inline int f1405_20(int x) { return x * 20; }
+inline int f1405_21(int x) { return x * 21; }
+inline int f1405_22(int x) { return x * 22; }
+inline int f1405_23(int x) { return x * 23; }
+inline int f1405_24(int x) { return x * 24; }
+inline int f1405_25(int x) { return x * 25; }
+inline int f1405_26(int x) { return x * 26; }
+inline int f1405_27(int x) { return x * 27; }
+inline int f1405_28(int x) { return x * 28; }
+inline int f1405_29(int x) { return x * 29; }
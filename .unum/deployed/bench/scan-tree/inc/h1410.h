@@ -0,0 +1,42 @@
+#pragma once
+/* header 1410 */
+#include <vector>
+#include "h562.h"
+#include "h4125.h"
+#include "h4487.h"
+#include "h8262.h"
+#include "h8440.h"
+#ifdef X
+#include "h6658.h"
+#endif
+struct S1410 { int a; const char *s = "x//y"; };
+inline int f1410_0(int x) { return x * 0; }
+inline int f1410_1(int x) { return x * 1; }
+inline int f1410_2(int x) { return x * 2; }
+inline int f1410_3(int x) { return x * 3; }
+inline int f1410_4(int x) { return x * 4; }
+inline int f1410_5(int x) { return x * 5; }
+inline int f1410_6(int x) { return x * 6; }
+inline int f1410_7(int x) { return x * 7; }
+inline int f1410_8(int x) { return x * 8; }
+inline int f1410_9(int x) { return x * 9; }
+inline int f1410_10(int x) { return x * 10; }
+inline int f1410_11(int x) { return x * 11; }
+inline int f1410_12(int x) { return x * 12; }
+inline int f1410_13(int x) { return x * 13; }
+inline int f1410_14(int x) { return x * 14; }
+inline int f1410_15(int x) { return x * 15; }
+inline int f1410_16(int x) { return x * 16; }
+inline int f1410_17(int x) { return x * 17; }
+inline int f1410_18(int x) { return x * 18; }
+inline int f1410_19(int x) { return x * 19; }
+inline int f1410_20(int x) { return x * 20; }
+inline int f1410_21(int x) { return x * 21; }
+inline int f1410_22(int x) { return x * 22; }
+inline int f1410_23(int x) { return x * 23; }
+inline int f1410_24(int x) { return x * 24; }
+inline int f1410_25(int x) { return x * 25; }
+inline int f1410_26(int x) { return x * 26; }
+inline int f1410_27(int x) { return x * 27; }
+inline int f1410_28(int x) { return x * 28; }
+inline int f1410_29(int x) { return x * 29; }
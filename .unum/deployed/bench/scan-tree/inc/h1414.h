@@ -0,0 +1,42 @@
+#pragma once
+/* header 1414 */
+#include <vector>
+#include "h228.h"
+#include "h7257.h"
+#include "h5731.h"
+#include "h212.h"
+#include "h919.h"
+#ifdef X
+#include "h3973.h"
+#endif
+struct S1414 { int a; const char *s = "x//y"; };
+inline int f1414_0(int x) { return x * 0; }
+inline int f1414_1(int x) { return x * 1; }
+inline int f1414_2(int x) { return x * 2; }
+inline int f1414_3(int x) { return x * 3; }
+inline int f1414_4(int x) { return x * 4; }
+inline int f1414_5(int x) { return x * 5; }
+inline int f1414_6(int x) { return x * 6; }
+inline int f1414_7(int x) { return x * 7; }
+inline int f1414_8(int x) { return x * 8; }
+inline int f1414_9(int x) { return x * 9; }
+inline int f1414_10(int x) { return x * 10; }
+inline int f1414_11(int x) { return x * 11; }
+inline int f1414_12(int x) { return x * 12; }
+inline int f1414_13(int x) { return x * 13; }
+inline int f1414_14(int x) { return x * 14; }
+inline int f1414_15(int x) { return x * 15; }
+inline int f1414_16(int x) { return x * 16; }
+inline int f1414_17(int x) { return x * 17; }
+inline int f1414_18(int x) { return x * 18; }
+inline int f1414_19(int x) { return x * 19; }
+inline int f1414_20(int x) { return x * 20; }
+inline int f1414_21(int x) { return x * 21; }
+inline int f1414_22(int x) { return x * 22; }
+inline int f1414_23(int x) { return x * 23; }
+inline int f1414_24(int x) { return x * 24; }
+inline int f1414_25(int x) { return x * 25; }
+inline int f1414_26(int x) { return x * 26; }
+inline int f1414_27(int x) { return x * 27; }
+inline int f1414_28(int x) { return x * 28; }
+inline int f1414_29(int x) { return x * 29; }
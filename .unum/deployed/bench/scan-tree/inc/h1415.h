@@ -0,0 +1,42 @@
+#pragma once
+/* header 1415 */
+#include <vector>
+#include "h2302.h"
+#include "h2111.h"
+#include "h5714.h"
+#include "h2668.h"
+#include "h2735.h"
+#ifdef X
+#include "h5644.h"
+#endif
+struct S1415 { int a; const char *s = "x//y"; };
+inline int f1415_0(int x) { return x * 0; }
+inline int f1415_1(int x) { return x * 1; }
+inline int f1415_2(int x) { return x * 2; }
+inline int f1415_3(int x) { return x * 3; }
+inline int f1415_4(int x) { return x * 4; }
+inline int f1415_5(int x) { return x * 5; }
+inline int f1415_6(int x) { return x * 6; }
+inline int f1415_7(int x) { return x * 7; }
+inline int f1415_8(int x) { return x * 8; }
+inline int f1415_9(int x) { return x * 9; }
+inline int f1415_10(int x) { return x * 10; }
+inline int f1415_11(int x) { return x * 11; }
+inline int f1415_12(int x) { return x * 12; }
+inline int f1415_13(int x) { return x * 13; }
+inline int f1415_14(int x) { return x * 14; }
+inline int f1415_15(int x) { return x * 15; }
+inline int f1415_16(int x) { return x * 16; }
+inline int f1415_17(int x) { return x * 17; }
+inline int f1415_18(int x) { return x * 18; }
+inline int f1415_19(int x) { return x * 19; }
+inline int f1415_20(int x) { return x * 20; }
+inline int f1415_21(int x) { return x * 21; }
+inline int f1415_22(int x) { return x * 22; }
+inline int f1415_23(int x) { return x * 23; }
+inline int f1415_24(int x) { return x * 24; }
+inline int f1415_25(int x) { return x * 25; }
+inline int f1415_26(int x) { return x * 26; }
+inline int f1415_27(int x) { return x * 27; }
+inline int f1415_28(int x) { return x * 28; }
+inline int f1415_29(int x) { return x * 29; }
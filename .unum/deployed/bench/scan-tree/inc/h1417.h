@@ -0,0 +1,42 @@
+#pragma once
+/* header 1417 */
+#include <vector>
+#include "h425.h"
+#include "h5575.h"
+#include "h9611.h"
+#include "h3925.h"
+#include "h754.h"
+#ifdef X
+#include "h3685.h"
+#endif
+struct S1417 { int a; const char *s = "x//y"; };
+inline int f1417_0(int x) { return x * 0; }
+inline int f1417_1(int x) { return x * 1; }
+inline int f1417_2(int x) { return x * 2; }
+inline int f1417_3(int x) { return x * 3; }
+inline int f1417_4(int x) { return x * 4; }
+inline int f1417_5(int x) { return x * 5; }
+inline int f1417_6(int x) { return x * 6; }
+inline int f1417_7(int x) { return x * 7; }
+inline int f1417_8(int x) { return x * 8; }
+inline int f1417_9(int x) { return x * 9; }
+inline int f1417_10(int x) { return x * 10; }
+inline int f1417_11(int x) { return x * 11; }
+inline int f1417_12(int x) { return x * 12; }
+inline int f1417_13(int x) { return x * 13; }
+inline int f1417_14(int x) { return x * 14; }
+inline int f1417_15(int x) { return x * 15; }
+inline int f1417_16(int x) { return x * 16; }
+inline int f1417_17(int x) { return x * 17; }
+inline int f1417_18(int x) { return x * 18; }
+inline int f1417_19(int x) { return x * 19; }
+inline int f1417_20(int x) { return x * 20; }
+inline int f1417_21(int x) { return x * 21; }
+inline int f1417_22(int x) { return x * 22; }
+inline int f1417_23(int x) { return x * 23; }
+inline int f1417_24(int x) { return x * 24; }
+inline int f1417_25(int x) { return x * 25; }
+inline int f1417_26(int x) { return x * 26; }
+inline int f1417_27(int x) { return x * 27; }
+inline int f1417_28(int x) { return x * 28; }
+inline int f1417_29(int x) { return x * 29; }
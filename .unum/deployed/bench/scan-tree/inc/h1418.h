@@ -0,0 +1,42 @@
+#pragma once
+/* header 1418 */
+#include <vector>
+#include "h2374.h"
+#include "h9931.h"
+#include "h2507.h"
+#include "h3675.h"
+#include "h6556.h"
+#ifdef X
+#include "h9337.h"
+#endif
+struct S1418 { int a; const char *s = "x//y"; };
+inline int f1418_0(int x) { return x * 0; }
+inline int f1418_1(int x) { return x * 1; }
+inline int f1418_2(int x) { return x * 2; }
+inline int f1418_3(int x) { return x * 3; }
+inline int f1418_4(int x) { return x * 4; }
+inline int f1418_5(int x) { return x * 5; }
+inline int f1418_6(int x) { return x * 6; }
+inline int f1418_7(int x) { return x * 7; }
+inline int f1418_8(int x) { return x * 8; }
+inline int f1418_9(int x) { return x * 9; }
+inline int f1418_10(int x) { return x * 10; }
+inline int f1418_11(int x) { return x * 11; }
+inline int f1418_12(int x) { return x * 12; }
+inline int f1418_13(int x) { return x * 13; }
+inline int f1418_14(int x) { return x * 14; }
+inline int f1418_15(int x) { return x * 15; }
+inline int f1418_16(int x) { return x * 16; }
+inline int f1418_17(int x) { return x * 17; }
+inline int f1418_18(int x) { return x * 18; }
+inline int f1418_19(int x) { return x * 19; }
+inline int f1418_20(int x) { return x * 20; }
+inline int f1418_21(int x) { return x * 21; }
+inline int f1418_22(int x) { return x * 22; }
+inline int f1418_23(int x) { return x * 23; }
+inline int f1418_24(int x) { return x * 24; }
+inline int f1418_25(int x) { return x * 25; }
+inline int f1418_26(int x) { return x * 26; }
+inline int f1418_27(int x) { return x * 27; }
+inline int f1418_28(int x) { return x * 28; }
+inline int f1418_29(int x) { return x * 29; }
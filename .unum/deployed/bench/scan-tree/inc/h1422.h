@@ -0,0 +1,42 @@
+#pragma once
+/* header 1422 */
+#include <vector>
+#include "h7934.h"
+#include "h6282.h"
+#include "h7246.h"
+#include "h5710.h"
+#include "h3646.h"
+#ifdef X
+#include "h1254.h"
+#endif
+struct S1422 { int a; const char *s = "x//y"; };
+inline int f1422_0(int x) { return x * 0; }
+inline int f1422_1(int x) { return x * 1; }
+inline int f1422_2(int x) { return x * 2; }
+inline int f1422_3(int x) { return x * 3; }
+inline int f1422_4(int x) { return x * 4; }
+inline int f1422_5(int x) { return x * 5; }
+inline int f1422_6(int x) { return x * 6; }
+inline int f1422_7(int x) { return x * 7; }
+inline int f1422_8(int x) { return x * 8; }
+inline int f1422_9(int x) { return x * 9; }
+inline int f1422_10(int x) { return x * 10; }
+inline int f1422_11(int x) { return x * 11; }
+inline int f1422_12(int x) { return x * 12; }
+inline int f1422_13(int x) { return x * 13; }
+inline int f1422_14(int x) { return x * 14; }
+inline int f1422_15(int x) { return x * 15; }
+inline int f1422_16(int x) { return x * 16; }
+inline int f1422_17(int x) { return x * 17; }
+inline int f1422_18(int x) { return x * 18; }
+inline int f1422_19(int x) { return x * 19; }
+inline int f1422_20(int x) { return x * 20; }
+inline int f1422_21(int x) { return x * 21; }
+inline int f1422_22(int x) { return x * 22; }
+inline int f1422_23(int x) { return x * 23; }
+inline int f1422_24(int x) { return x * 24; }
+inline int f1422_25(int x) { return x * 25; }
+inline int f1422_26(int x) { return x * 26; }
+inline int f1422_27(int x) { return x * 27; }
+inline int f1422_28(int x) { return x * 28; }
+inline int f1422_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1423 */
+#include <vector>
+#include "h273.h"
+#include "h9256.h"
+#include "h5534.h"
+#include "h1352.h"
+#include "h8253.h"
+#ifdef X
+#include "h9435.h"
+#endif
+struct S1423 { int a; const char *s = "x//y"; };
+inline int f1423_0(int x) { return x * 0; }
+inline int f1423_1(int x) { return x * 1; }
+inline int f1423_2(int x) { return x * 2; }
+inline int f1423_3(int x) { return x * 3; }
+inline int f1423_4(int x) { return x * 4; }
+inline int f1423_5(int x) { return x * 5; }
+inline int f1423_6(int x) { return x * 6; }
+inline int f1423_7(int x) { return x * 7; }
+inline int f1423_8(int x) { return x * 8; }
+inline int f1423_9(int x) { return x * 9; }
+inline int f1423_10(int x) { return x * 10; }
+inline int f1423_11(int x) { return x * 11; }
+inline int f1423_12(int x) { return x * 12; }
+inline int f1423_13(int x) { return x * 13; }
+inline int f1423_14(int x) { return x * 14; }
+inline int f1423_15(int x) { return x * 15; }
+inline int f1423_16(int x) { return x * 16; }
+inline int f1423_17(int x) { return x * 17; }
+inline int f1423_18(int x) { return x * 18; }
+inline int f1423_19(int x) { return x * 19; }
+inline int f1423_20(int x) { return x * 20; }
+inline int f1423_21(int x) { return x * 21; }
+inline int f1423_22(int x) { return x * 22; }
+inline int f1423_23(int x) { return x * 23; }
+inline int f1423_24(int x) { return x * 24; }
+inline int f1423_25(int x) { return x * 25; }
+inline int f1423_26(int x) { return x * 26; }
+inline int f1423_27(int x) { return x * 27; }
+inline int f1423_28(int x) { return x * 28; }
+inline int f1423_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1424 */
+#include <vector>
+#include "h1198.h"
+#include "h3376.h"
+#include "h2905.h"
+#include "h9671.h"
+#include "h1300.h"
+#ifdef X
+#include "h5725.h"
+#endif
+struct S1424 { int a; const char *s = "x//y"; };
+inline int f1424_0(int x) { return x * 0; }
+inline int f1424_1(int x) { return x * 1; }
+inline int f1424_2(int x) { return x * 2; }
+inline int f1424_3(int x) { return x * 3; }
+inline int f1424_4(int x) { return x * 4; }
+inline int f1424_5(int x) { return x * 5; }
+inline int f1424_6(int x) { return x * 6; }
+inline int f1424_7(int x) { return x * 7; }
+inline int f1424_8(int x) { return x * 8; }
+inline int f1424_9(int x) { return x * 9; }
+inline int f1424_10(int x) { return x * 10; }
+inline int f1424_11(int x) { return x * 11; }
+inline int f1424_12(int x) { return x * 12; }
+inline int f1424_13(int x) { return x * 13; }
+inline int f1424_14(int x) { return x * 14; }
+inline int f1424_15(int x) { return x * 15; }
+inline int f1424_16(int x) { return x * 16; }
+inline int f1424_17(int x) { return x * 17; }
+inline int f1424_18(int x) { return x * 18; }
+inline int f1424_19(int x) { return x * 19; }
+inline int f1424_20(int x) { return x * 20; }
+inline int f1424_21(int x) { return x * 21; }
+inline int f1424_22(int x) { return x * 22; }
+inline int f1424_23(int x) { return x * 23; }
+inline int f1424_24(int x) { return x * 24; }
+inline int f1424_25(int x) { return x * 25; }
+inline int f1424_26(int x) { return x * 26; }
+inline int f1424_27(int x) { return x * 27; }
+inline int f1424_28(int x) { return x * 28; }
+inline int f1424_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1425 */
+#include <vector>
+#include "h2874.h"
+#include "h3411.h"
+#include "h3713.h"
+#include "h8799.h"
+#include "h5244.h"
+#ifdef X
+#include "h327.h"
+#endif
+struct S1425 { int a; const char *s = "x//y"; };
+inline int f1425_0(int x) { return x * 0; }
+inline int f1425_1(int x) { return x * 1; }
+inline int f1425_2(int x) { return x * 2; }
+inline int f1425_3(int x) { return x * 3; }
+inline int f1425_4(int x) { return x * 4; }
+inline int f1425_5(int x) { return x * 5; }
+inline int f1425_6(int x) { return x * 6; }
+inline int f1425_7(int x) { return x * 7; }
+inline int f1425_8(int x) { return x * 8; }
+inline int f1425_9(int x) { return x * 9; }
+inline int f1425_10(int x) { return x * 10; }
+inline int f1425_11(int x) { return x * 11; }
+inline int f1425_12(int x) { return x * 12; }
+inline int f1425_13(int x) { return x * 13; }
+inline int f1425_14(int x) { return x * 14; }
+inline int f1425_15(int x) { return x * 15; }
+inline int f1425_16(int x) { return x * 16; }
+inline int f1425_17(int x) { return x * 17; }
+inline int f1425_18(int x) { return x * 18; }
+inline int f1425_19(int x) { return x * 19; }
+inline int f1425_20(int x) { return x * 20; }
+inline int f1425_21(int x) { return x * 21; }
+inline int f1425_22(int x) { return x * 22; }
+inline int f1425_23(int x) { return x * 23; }
+inline int f1425_24(int x) { return x * 24; }
+inline int f1425_25(int x) { return x * 25; }
+inline int f1425_26(int x) { return x * 26; }
+inline int f1425_27(int x) { return x * 27; }
+inline int f1425_28(int x) { return x * 28; }
+inline int f1425_29(int x) { return x * 29; }
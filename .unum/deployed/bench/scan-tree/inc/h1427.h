@@ -0,0 +1,42 @@
+#pragma once
+/* header 1427 */
+#include <vector>
+#include "h2599.h"
+#include "h7182.h"
+#include "h2371.h"
+#include "h2881.h"
+#include "h4507.h"
+#ifdef X
+#include "h8990.h"
+#endif
+struct S1427 { int a; const char *s = "x//y"; };
+inline int f1427_0(int x) { return x * 0; }
+inline int f1427_1(int x) { return x * 1; }
+inline int f1427_2(int x) { return x * 2; }
+inline int f1427_3(int x) { return x * 3; }
+inline int f1427_4(int x) { return x * 4; }
+inline int f1427_5(int x) { return x * 5; }
+inline int f1427_6(int x) { return x * 6; }
+inline int f1427_7(int x) { return x * 7; }
+inline int f1427_8(int x) { return x * 8; }
+inline int f1427_9(int x) { return x * 9; }
+inline int f1427_10(int x) { return x * 10; }
+inline int f1427_11(int x) { return x * 11; }
+inline int f1427_12(int x) { return x * 12; }
+inline int f1427_13(int x) { return x * 13; }
+inline int f1427_14(int x) { return x * 14; }
+inline int f1427_15(int x) { return x * 15; }
+inline int f1427_16(int x) { return x * 16; }
+inline int f1427_17(int x) { return x * 17; }
+inline int f1427_18(int x) { return x * 18; }
+inline int f1427_19(int x) { return x * 19; }
+inline int f1427_20(int x) { return x * 20; }
+inline int f1427_21(int x) { return x * 21; }
+inline int f1427_22(int x) { return x * 22; }
+inline int f1427_23(int x) { return x * 23; }
+inline int f1427_24(int x) { return x * 24; }
+inline int f1427_25(int x) { return x * 25; }
+inline int f1427_26(int x) { return x * 26; }
+inline int f1427_27(int x) { return x * 27; }
+inline int f1427_28(int x) { return x * 28; }
+inline int f1427_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1429 */
+#include <vector>
+#include "h1260.h"
+#include "h46.h"
+#include "h497.h"
+#include "h7197.h"
+#include "h9042.h"
+#ifdef X
+#include "h1002.h"
+#endif
+struct S1429 { int a; const char *s = "x//y"; };
+inline int f1429_0(int x) { return x * 0; }
+inline int f1429_1(int x) { return x * 1; }
+inline int f1429_2(int x) { return x * 2; }
+inline int f1429_3(int x) { return x * 3; }
+inline int f1429_4(int x) { return x * 4; }
+inline int f1429_5(int x) { return x * 5; }
+inline int f1429_6(int x) { return x * 6; }
+inline int f1429_7(int x) { return x * 7; }
+inline int f1429_8(int x) { return x * 8; }
+inline int f1429_9(int x) { return x * 9; }
+inline int f1429_10(int x) { return x * 10; }
+inline int f1429_11(int x) { return x * 11; }
+inline int f1429_12(int x) { return x * 12; }
+inline int f1429_13(int x) { return x * 13; }
+inline int f1429_14(int x) { return x * 14; }
+inline int f1429_15(int x) { return x * 15; }
+inline int f1429_16(int x) { return x * 16; }
+inline int f1429_17(int x) { return x * 17; }
+inline int f1429_18(int x) { return x * 18; }
+inline int f1429_19(int x) { return x * 19; }
+inline int f1429_20(int x) { return x * 20; }
+inline int f1429_21(int x) { return x * 21; }
+inline int f1429_22(int x) { return x * 22; }
+inline int f1429_23(int x) { return x * 23; }
+inline int f1429_24(int x) { return x * 24; }
+inline int f1429_25(int x) { return x * 25; }
+inline int f1429_26(int x) { return x * 26; }
+inline int f1429_27(int x) { return x * 27; }
+inline int f1429_28(int x) { return x * 28; }
+inline int f1429_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1431 */
+#include <vector>
+#include "h5640.h"
+#include "h6270.h"
+#include "h8386.h"
+#include "h6316.h"
+#include "h9582.h"
+#ifdef X
+#include "h1633.h"
+#endif
+struct S1431 { int a; const char *s = "x//y"; };
+inline int f1431_0(int x) { return x * 0; }
+inline int f1431_1(int x) { return x * 1; }
+inline int f1431_2(int x) { return x * 2; }
+inline int f1431_3(int x) { return x * 3; }
+inline int f1431_4(int x) { return x * 4; }
+inline int f1431_5(int x) { return x * 5; }
+inline int f1431_6(int x) { return x * 6; }
+inline int f1431_7(int x) { return x * 7; }
+inline int f1431_8(int x) { return x * 8; }
+inline int f1431_9(int x) { return x * 9; }
+inline int f1431_10(int x) { return x * 10; }
+inline int f1431_11(int x) { return x * 11; }
+inline int f1431_12(int x) { return x * 12; }
+inline int f1431_13(int x) { return x * 13; }
+inline int f1431_14(int x) { return x * 14; }
+inline int f1431_15(int x) { return x * 15; }
+inline int f1431_16(int x) { return x * 16; }
+inline int f1431_17(int x) { return x * 17; }
+inline int f1431_18(int x) { return x * 18; }
+inline int f1431_19(int x) { return x * 19; }
+inline int f1431_20(int x) { return x * 20; }
+inline int f1431_21(int x) { return x * 21; }
+inline int f1431_22(int x) { return x * 22; }
+inline int f1431_23(int x) { return x * 23; }
+inline int f1431_24(int x) { return x * 24; }
+inline int f1431_25(int x) { return x * 25; }
+inline int f1431_26(int x) { return x * 26; }
+inline int f1431_27(int x) { return x * 27; }
+inline int f1431_28(int x) { return x * 28; }
+inline int f1431_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1432 */
+#include <vector>
+#include "h287.h"
+#include "h5897.h"
+#include "h3326.h"
+#include "h7389.h"
+#include "h5460.h"
+#ifdef X
+#include "h6677.h"
+#endif
+struct S1432 { int a; const char *s = "x//y"; };
+inline int f1432_0(int x) { return x * 0; }
+inline int f1432_1(int x) { return x * 1; }
+inline int f1432_2(int x) { return x * 2; }
+inline int f1432_3(int x) { return x * 3; }
+inline int f1432_4(int x) { return x * 4; }
+inline int f1432_5(int x) { return x * 5; }
+inline int f1432_6(int x) { return x * 6; }
+inline int f1432_7(int x) { return x * 7; }
+inline int f1432_8(int x) { return x * 8; }
+inline int f1432_9(int x) { return x * 9; }
+inline int f1432_10(int x) { return x * 10; }
+inline int f1432_11(int x) { return x * 11; }
+inline int f1432_12(int x) { return x * 12; }
+inline int f1432_13(int x) { return x * 13; }
+inline int f1432_14(int x) { return x * 14; }
+inline int f1432_15(int x) { return x * 15; }
+inline int f1432_16(int x) { return x * 16; }
+inline int f1432_17(int x) { return x * 17; }
+inline int f1432_18(int x) { return x * 18; }
+inline int f1432_19(int x) { return x * 19; }
+inline int f1432_20(int x) { return x * 20; }
+inline int f1432_21(int x) { return x * 21; }
+inline int f1432_22(int x) { return x * 22; }
+inline int f1432_23(int x) { return x * 23; }
+inline int f1432_24(int x) { return x * 24; }
+inline int f1432_25(int x) { return x * 25; }
+inline int f1432_26(int x) { return x * 26; }
+inline int f1432_27(int x) { return x * 27; }
+inline int f1432_28(int x) { return x * 28; }
+inline int f1432_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1435 */
+#include <vector>
+#include "h6744.h"
+#include "h6786.h"
+#include "h2326.h"
+#include "h6798.h"
+#include "h7046.h"
+#ifdef X
+#include "h6373.h"
+#endif
+struct S1435 { int a; const char *s = "x//y"; };
+inline int f1435_0(int x) { return x * 0; }
+inline int f1435_1(int x) { return x * 1; }
+inline int f1435_2(int x) { return x * 2; }
+inline int f1435_3(int x) { return x * 3; }
+inline int f1435_4(int x) { return x * 4; }
+inline int f1435_5(int x) { return x * 5; }
+inline int f1435_6(int x) { return x * 6; }
+inline int f1435_7(int x) { return x * 7; }
+inline int f1435_8(int x) { return x * 8; }
+inline int f1435_9(int x) { return x * 9; }
+inline int f1435_10(int x) { return x * 10; }
+inline int f1435_11(int x) { return x * 11; }
+inline int f1435_12(int x) { return x * 12; }
+inline int f1435_13(int x) { return x * 13; }
+inline int f1435_14(int x) { return x * 14; }
+inline int f1435_15(int x) { return x * 15; }
+inline int f1435_16(int x) { return x * 16; }
+inline int f1435_17(int x) { return x * 17; }
+inline int f1435_18(int x) { return x * 18; }
+inline int f1435_19(int x) { return x * 19; }
+inline int f1435_20(int x) { return x * 20; }
+inline int f1435_21(int x) { return x * 21; }
+inline int f1435_22(int x) { return x * 22; }
+inline int f1435_23(int x) { return x * 23; }
+inline int f1435_24(int x) { return x * 24; }
+inline int f1435_25(int x) { return x * 25; }
+inline int f1435_26(int x) { return x * 26; }
+inline int f1435_27(int x) { return x * 27; }
+inline int f1435_28(int x) { return x * 28; }
+inline int f1435_29(int x) { return x * 29; }
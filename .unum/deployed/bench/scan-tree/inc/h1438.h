@@ -0,0 +1,42 @@
+#pragma once
+/* header 1438 */
+#include <vector>
+#include "h2103.h"
+#include "h953.h"
+#include "h6558.h"
+#include "h1147.h"
+#include "h6287.h"
+#ifdef X
+#include "h1230.h"
+#endif
+struct S1438 { int a; const char *s = "x//y"; };
+inline int f1438_0(int x) { return x * 0; }
+inline int f1438_1(int x) { return x * 1; }
+inline int f1438_2(int x) { return x * 2; }
+inline int f1438_3(int x) { return x * 3; }
+inline int f1438_4(int x) { return x * 4; }
+inline int f1438_5(int x) { return x * 5; }
+inline int f1438_6(int x) { return x * 6; }
+inline int f1438_7(int x) { return x * 7; }
+inline int f1438_8(int x) { return x * 8; }
+inline int f1438_9(int x) { return x * 9; }
+inline int f1438_10(int x) { return x * 10; }
+inline int f1438_11(int x) { return x * 11; }
+inline int f1438_12(int x) { return x * 12; }
+inline int f1438_13(int x) { return x * 13; }
+inline int f1438_14(int x) { return x * 14; }
+inline int f1438_15(int x) { return x * 15; }
+inline int f1438_16(int x) { return x * 16; }
+inline int f1438_17(int x) { return x * 17; }
+inline int f1438_18(int x) { return x * 18; }
+inline int f1438_19(int x) { return x * 19; }
+inline int f1438_20(int x) { return x * 20; }
+inline int f1438_21(int x) { return x * 21; }
+inline int f1438_22(int x) { return x * 22; }
+inline int f1438_23(int x) { return x * 23; }
+inline int f1438_24(int x) { return x * 24; }
+inline int f1438_25(int x) { return x * 25; }
+inline int f1438_26(int x) { return x * 26; }
+inline int f1438_27(int x) { return x * 27; }
+inline int f1438_28(int x) { return x * 28; }
+inline int f1438_29(int x) { return x * 29; }
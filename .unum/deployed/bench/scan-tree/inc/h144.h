@@ -0,0 +1,42 @@
+#pragma once
+/* header 144 */
+#include <vector>
+#include "h4740.h"
+#include "h1032.h"
+#include "h6.h"
+#include "h7025.h"
+#include "h75.h"
+#ifdef X
+#include "h2271.h"
+#endif
+struct S144 { int a; const char *s = "x//y"; };
+inline int f144_0(int x) { return x * 0; }
+inline int f144_1(int x) { return x * 1; }
+inline int f144_2(int x) { return x * 2; }
+inline int f144_3(int x) { return x * 3; }
+inline int f144_4(int x) { return x * 4; }
+inline int f144_5(int x) { return x * 5; }
+inline int f144_6(int x) { return x * 6; }
+inline int f144_7(int x) { return x * 7; }
+inline int f144_8(int x) { return x * 8; }
+inline int f144_9(int x) { return x * 9; }
+inline int f144_10(int x) { return x * 10; }
+inline int f144_11(int x) { return x * 11; }
+inline int f144_12(int x) { return x * 12; }
+inline int f144_13(int x) { return x * 13; }
+inline int f144_14(int x) { return x * 14; }
+inline int f144_15(int x) { return x * 15; }
+inline int f144_16(int x) { return x * 16; }
+inline int f144_17(int x) { return x * 17; }
+inline int f144_18(int x) { return x * 18; }
+inline int f144_19(int x) { return x * 19; }
+inline int f144_20(int x) { return x * 20; }
+inline int f144_21(int x) { return x * 21; }
+inline int f144_22(int x) { return x * 22; }
+inline int f144_23(int x) { return x * 23; }
+inline int f144_24(int x) { return x * 24; }
+inline int f144_25(int x) { return x * 25; }
+inline int f144_26(int x) { return x * 26; }
+inline int f144_27(int x) { return x * 27; }
+inline int f144_28(int x) { return x * 28; }
+inline int f144_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1441 */
+#include <vector>
+#include "h6315.h"
+#include "h7640.h"
+#include "h7818.h"
+#include "h9578.h"
+#include "h9478.h"
+#ifdef X
+#include "h670.h"
+#endif
+struct S1441 { int a; const char *s = "x//y"; };
+inline int f1441_0(int x) { return x * 0; }
+inline int f1441_1(int x) { return x * 1; }
+inline int f1441_2(int x) { return x * 2; }
+inline int f1441_3(int x) { return x * 3; }
+inline int f1441_4(int x) { return x * 4; }
+inline int f1441_5(int x) { return x * 5; }
+inline int f1441_6(int x) { return x * 6; }
+inline int f1441_7(int x) { return x * 7; }
+inline int f1441_8(int x) { return x * 8; }
+inline int f1441_9(int x) { return x * 9; }
+inline int f1441_10(int x) { return x * 10; }
+inline int f1441_11(int x) { return x * 11; }
+inline int f1441_12(int x) { return x * 12; }
+inline int f1441_13(int x) { return x * 13; }
+inline int f1441_14(int x) { return x * 14; }
+inline int f1441_15(int x) { return x * 15; }
+inline int f1441_16(int x) { return x * 16; }
+inline int f1441_17(int x) { return x * 17; }
+inline int f1441_18(int x) { return x * 18; }
+inline int f1441_19(int x) { return x * 19; }
+inline int f1441_20(int x) { return x * 20; }
+inline int f1441_21(int x) { return x * 21; }
+inline int f1441_22(int x) { return x * 22; }
+inline int f1441_23(int x) { return x * 23; }
+inline int f1441_24(int x) { return x * 24; }
+inline int f1441_25(int x) { return x * 25; }
+inline int f1441_26(int x) { return x * 26; }
+inline int f1441_27(int x) { return x * 27; }
+inline int f1441_28(int x) { return x * 28; }
+inline int f1441_29(int x) { return x * 29; }
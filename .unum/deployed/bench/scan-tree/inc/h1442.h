@@ -0,0 +1,42 @@
+#pragma once
+/* header 1442 */
+#include <vector>
+#include "h2452.h"
+#include "h7802.h"
+#include "h242.h"
+#include "h5725.h"
+#include "h3825.h"
+#ifdef X
+#include "h6585.h"
+#endif
+struct S1442 { int a; const char *s = "x//y"; };
+inline int f1442_0(int x) { return x * 0; }
+inline int f1442_1(int x) { return x * 1; }
+inline int f1442_2(int x) { return x * 2; }
+inline int f1442_3(int x) { return x * 3; }
+inline int f1442_4(int x) { return x * 4; }
+inline int f1442_5(int x) { return x * 5; }
+inline int f1442_6(int x) { return x * 6; }
+inline int f1442_7(int x) { return x * 7; }
+inline int f1442_8(int x) { return x * 8; }
+inline int f1442_9(int x) { return x * 9; }
+inline int f1442_10(int x) { return x * 10; }
+inline int f1442_11(int x) { return x * 11; }
+inline int f1442_12(int x) { return x * 12; }
+inline int f1442_13(int x) { return x * 13; }
+inline int f1442_14(int x) { return x * 14; }
+inline int f1442_15(int x) { return x * 15; }
+inline int f1442_16(int x) { return x * 16; }
+inline int f1442_17(int x) { return x * 17; }
+inline int f1442_18(int x) { return x * 18; }
+inline int f1442_19(int x) { return x * 19; }
+inline int f1442_20(int x) { return x * 20; }
+inline int f1442_21(int x) { return x * 21; }
+inline int f1442_22(int x) { return x * 22; }
+inline int f1442_23(int x) { return x * 23; }
+inline int f1442_24(int x) { return x * 24; }
+inline int f1442_25(int x) { return x * 25; }
+inline int f1442_26(int x) { return x * 26; }
+inline int f1442_27(int x) { return x * 27; }
+inline int f1442_28(int x) { return x * 28; }
+inline int f1442_29(int x) { return x * 29; }
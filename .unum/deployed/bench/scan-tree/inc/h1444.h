@@ -0,0 +1,42 @@
+#pragma once
+/* header 1444 */
+#include <vector>
+#include "h3762.h"
+#include "h1984.h"
+#include "h2762.h"
+#include "h1011.h"
+#include "h8230.h"
+#ifdef X
+#include "h919.h"
+#endif
+struct S1444 { int a; const char *s = "x//y"; };
+inline int f1444_0(int x) { return x * 0; }
+inline int f1444_1(int x) { return x * 1; }
+inline int f1444_2(int x) { return x * 2; }
+inline int f1444_3(int x) { return x * 3; }
+inline int f1444_4(int x) { return x * 4; }
+inline int f1444_5(int x) { return x * 5; }
+inline int f1444_6(int x) { return x * 6; }
+inline int f1444_7(int x) { return x * 7; }
+inline int f1444_8(int x) { return x * 8; }
+inline int f1444_9(int x) { return x * 9; }
+inline int f1444_10(int x) { return x * 10; }
+inline int f1444_11(int x) { return x * 11; }
+inline int f1444_12(int x) { return x * 12; }
+inline int f1444_13(int x) { return x * 13; }
+inline int f1444_14(int x) { return x * 14; }
+inline int f1444_15(int x) { return x * 15; }
+inline int f1444_16(int x) { return x * 16; }
+inline int f1444_17(int x) { return x * 17; }
+inline int f1444_18(int x) { return x * 18; }
+inline int f1444_19(int x) { return x * 19; }
+inline int f1444_20(int x) { return x * 20; }
+inline int f1444_21(int x) { return x * 21; }
+inline int f1444_22(int x) { return x * 22; }
+inline int f1444_23(int x) { return x * 23; }
+inline int f1444_24(int x) { return x * 24; }
+inline int f1444_25(int x) { return x * 25; }
+inline int f1444_26(int x) { return x * 26; }
+inline int f1444_27(int x) { return x * 27; }
+inline int f1444_28(int x) { return x * 28; }
+inline int f1444_29(int x) { return x * 29; }
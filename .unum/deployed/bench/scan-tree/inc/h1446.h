@@ -0,0 +1,42 @@
+#pragma once
+/* header 1446 */
+#include <vector>
+#include "h7063.h"
+#include "h4754.h"
+#include "h5439.h"
+#include "h127.h"
+#include "h418.h"
+#ifdef X
+#include "h1494.h"
+#endif
+struct S1446 { int a; const char *s = "x//y"; };
+inline int f1446_0(int x) { return x * 0; }
+inline int f1446_1(int x) { return x * 1; }
+inline int f1446_2(int x) { return x * 2; }
+inline int f1446_3(int x) { return x * 3; }
+inline int f1446_4(int x) { return x * 4; }
+inline int f1446_5(int x) { return x * 5; }
+inline int f1446_6(int x) { return x * 6; }
+inline int f1446_7(int x) { return x * 7; }
+inline int f1446_8(int x) { return x * 8; }
+inline int f1446_9(int x) { return x * 9; }
+inline int f1446_10(int x) { return x * 10; }
+inline int f1446_11(int x) { return x * 11; }
+inline int f1446_12(int x) { return x * 12; }
+inline int f1446_13(int x) { return x * 13; }
+inline int f1446_14(int x) { return x * 14; }
+inline int f1446_15(int x) { return x * 15; }
+inline int f1446_16(int x) { return x * 16; }
+inline int f1446_17(int x) { return x * 17; }
+inline int f1446_18(int x) { return x * 18; }
+inline int f1446_19(int x) { return x * 19; }
+inline int f1446_20(int x) { return x * 20; }
+inline int f1446_21(int x) { return x * 21; }
+inline int f1446_22(int x) { return x * 22; }
+inline int f1446_23(int x) { return x * 23; }
+inline int f1446_24(int x) { return x * 24; }
+inline int f1446_25(int x) { return x * 25; }
+inline int f1446_26(int x) { return x * 26; }
+inline int f1446_27(int x) { return x * 27; }
+inline int f1446_28(int x) { return x * 28; }
+inline int f1446_29(int x) { return x * 29; }
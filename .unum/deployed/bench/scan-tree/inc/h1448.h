@@ -0,0 +1,42 @@
+#pragma once
+/* header 1448 */
+#include <vector>
+#include "h5131.h"
+#include "h8934.h"
+#include "h2404.h"
+#include "h4729.h"
+#include "h212.h"
+#ifdef X
+#include "h1097.h"
+#endif
+struct S1448 { int a; const char *s = "x//y"; };
+inline int f1448_0(int x) { return x * 0; }
+inline int f1448_1(int x) { return x * 1; }
+inline int f1448_2(int x) { return x * 2; }
+inline int f1448_3(int x) { return x * 3; }
+inline int f1448_4(int x) { return x * 4; }
+inline int f1448_5(int x) { return x * 5; }
+inline int f1448_6(int x) { return x * 6; }
+inline int f1448_7(int x) { return x * 7; }
+inline int f1448_8(int x) { return x * 8; }
+inline int f1448_9(int x) { return x * 9; }
+inline int f1448_10(int x) { return x * 10; }
+inline int f1448_11(int x) { return x * 11; }
+inline int f1448_12(int x) { return x * 12; }
+inline int f1448_13(int x) { return x * 13; }
+inline int f1448_14(int x) { return x * 14; }
+inline int f1448_15(int x) { return x * 15; }
+inline int f1448_16(int x) { return x * 16; }
+inline int f1448_17(int x) { return x * 17; }
+inline int f1448_18(int x) { return x * 18; }
+inline int f1448_19(int x) { return x * 19; }
+inline int f1448_20(int x) { return x * 20; }
+inline int f1448_21(int x) { return x * 21; }
+inline int f1448_22(int x) { return x * 22; }
+inline int f1448_23(int x) { return x * 23; }
+inline int f1448_24(int x) { return x * 24; }
+inline int f1448_25(int x) { return x * 25; }
+inline int f1448_26(int x) { return x * 26; }
+inline int f1448_27(int x) { return x * 27; }
+inline int f1448_28(int x) { return x * 28; }
+inline int f1448_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 145 */
+#include <vector>
+#include "h9492.h"
+#include "h8813.h"
+#include "h1865.h"
+#include "h8585.h"
+#include "h9420.h"
+#ifdef X
+#include "h3499.h"
+#endif
+struct S145 { int a; const char *s = "x//y"; };
+inline int f145_0(int x) { return x * 0; }
+inline int f145_1(int x) { return x * 1; }
+inline int f145_2(int x) { return x * 2; }
+inline int f145_3(int x) { return x * 3; }
+inline int f145_4(int x) { return x * 4; }
+inline int f145_5(int x) { return x * 5; }
+inline int f145_6(int x) { return x * 6; }
+inline int f145_7(int x) { return x * 7; }
+inline int f145_8(int x) { return x * 8; }
+inline int f145_9(int x) { return x * 9; }
+inline int f145_10(int x) { return x * 10; }
+inline int f145_11(int x) { return x * 11; }
+inline int f145_12(int x) { return x * 12; }
+inline int f145_13(int x) { return x * 13; }
+inline int f145_14(int x) { return x * 14; }
+inline int f145_15(int x) { return x * 15; }
+inline int f145_16(int x) { return x * 16; }
+inline int f145_17(int x) { return x * 17; }
+inline int f145_18(int x) { return x * 18; }
+inline int f145_19(int x) { return x * 19; }
+inline int f145_20(int x) { return x * 20; }
+inline int f145_21(int x) { return x * 21; }
+inline int f145_22(int x) { return x * 22; }
+inline int f145_23(int x) { return x * 23; }
+inline int f145_24(int x) { return x * 24; }
+inline int f145_25(int x) { return x * 25; }
+inline int f145_26(int x) { return x * 26; }
+inline int f145_27(int x) { return x * 27; }
+inline int f145_28(int x) { return x * 28; }
+inline int f145_29(int x) { return x * 29; }
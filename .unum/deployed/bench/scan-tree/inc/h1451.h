@@ -0,0 +1,42 @@
+#pragma once
+/* header 1451 */
+#include <vector>
+#include "h3501.h"
+#include "h5263.h"
+#include "h468.h"
+#include "h4973.h"
+#include "h6647.h"
+#ifdef X
+#include "h4092.h"
+#endif
+struct S1451 { int a; const char *s = "x//y"; };
+inline int f1451_0(int x) { return x * 0; }
+inline int f1451_1(int x) { return x * 1; }
+inline int f1451_2(int x) { return x * 2; }
+inline int f1451_3(int x) { return x * 3; }
+inline int f1451_4(int x) { return x * 4; }
+inline int f1451_5(int x) { return x * 5; }
+inline int f1451_6(int x) { return x * 6; }
+inline int f1451_7(int x) { return x * 7; }
+inline int f1451_8(int x) { return x * 8; }
+inline int f1451_9(int x) { return x * 9; }
+inline int f1451_10(int x) { return x * 10; }
+inline int f1451_11(int x) { return x * 11; }
+inline int f1451_12(int x) { return x * 12; }
+inline int f1451_13(int x) { return x * 13; }
+inline int f1451_14(int x) { return x * 14; }
+inline int f1451_15(int x) { return x * 15; }
+inline int f1451_16(int x) { return x * 16; }
+inline int f1451_17(int x) { return x * 17; }
+inline int f1451_18(int x) { return x * 18; }
+inline int f1451_19(int x) { return x * 19; }
+inline int f1451_20(int x) { return x * 20; }
+inline int f1451_21(int x) { return x * 21; }
+inline int f1451_22(int x) { return x * 22; }
+inline int f1451_23(int x) { return x * 23; }
+inline int f1451_24(int x) { return x * 24; }
+inline int f1451_25(int x) { return x * 25; }
+inline int f1451_26(int x) { return x * 26; }
+inline int f1451_27(int x) { return x * 27; }
+inline int f1451_28(int x) { return x * 28; }
+inline int f1451_29(int x) { return x * 29; }
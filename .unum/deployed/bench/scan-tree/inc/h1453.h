@@ -0,0 +1,42 @@
+#pragma once
+/* header 1453 */
+#include <vector>
+#include "h2731.h"
+#include "h5847.h"
+#include "h791.h"
+#include "h6619.h"
+#include "h2457.h"
+#ifdef X
+#include "h8324.h"
+#endif
+struct S1453 { int a; const char *s = "x//y"; };
+inline int f1453_0(int x) { return x * 0; }
+inline int f1453_1(int x) { return x * 1; }
+inline int f1453_2(int x) { return x * 2; }
+inline int f1453_3(int x) { return x * 3; }
+inline int f1453_4(int x) { return x * 4; }
+inline int f1453_5(int x) { return x * 5; }
+inline int f1453_6(int x) { return x * 6; }
+inline int f1453_7(int x) { return x * 7; }
+inline int f1453_8(int x) { return x * 8; }
+inline int f1453_9(int x) { return x * 9; }
+inline int f1453_10(int x) { return x * 10; }
+inline int f1453_11(int x) { return x * 11; }
+inline int f1453_12(int x) { return x * 12; }
+inline int f1453_13(int x) { return x * 13; }
+inline int f1453_14(int x) { return x * 14; }
+inline int f1453_15(int x) { return x * 15; }
+inline int f1453_16(int x) { return x * 16; }
+inline int f1453_17(int x) { return x * 17; }
+inline int f1453_18(int x) { return x * 18; }
+inline int f1453_19(int x) { return x * 19; }
+inline int f1453_20(int x) { return x * 20; }
+inline int f1453_21(int x) { return x * 21; }
+inline int f1453_22(int x) { return x * 22; }
+inline int f1453_23(int x) { return x * 23; }
+inline int f1453_24(int x) { return x * 24; }
+inline int f1453_25(int x) { return x * 25; }
+inline int f1453_26(int x) { return x * 26; }
+inline int f1453_27(int x) { return x * 27; }
+inline int f1453_28(int x) { return x * 28; }
+inline int f1453_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1454 */
+#include <vector>
+#include "h2229.h"
+#include "h6702.h"
+#include "h5849.h"
+#include "h9100.h"
+#include "h4403.h"
+#ifdef X
+#include "h4591.h"
+#endif
+struct S1454 { int a; const char *s = "x//y"; };
+inline int f1454_0(int x) { return x * 0; }
+inline int f1454_1(int x) { return x * 1; }
+inline int f1454_2(int x) { return x * 2; }
+inline int f1454_3(int x) { return x * 3; }
+inline int f1454_4(int x) { return x * 4; }
+inline int f1454_5(int x) { return x * 5; }
+inline int f1454_6(int x) { return x * 6; }
+inline int f1454_7(int x) { return x * 7; }
+inline int f1454_8(int x) { return x * 8; }
+inline int f1454_9(int x) { return x * 9; }
+inline int f1454_10(int x) { return x * 10; }
+inline int f1454_11(int x) { return x * 11; }
+inline int f1454_12(int x) { return x * 12; }
+inline int f1454_13(int x) { return x * 13; }
+inline int f1454_14(int x) { return x * 14; }
+inline int f1454_15(int x) { return x * 15; }
+inline int f1454_16(int x) { return x * 16; }
+inline int f1454_17(int x) { return x * 17; }
+inline int f1454_18(int x) { return x * 18; }
+inline int f1454_19(int x) { return x * 19; }
+inline int f1454_20(int x) { return x * 20; }
+inline int f1454_21(int x) { return x * 21; }
+inline int f1454_22(int x) { return x * 22; }
+inline int f1454_23(int x) { return x * 23; }
+inline int f1454_24(int x) { return x * 24; }
+inline int f1454_25(int x) { return x * 25; }
+inline int f1454_26(int x) { return x * 26; }
+inline int f1454_27(int x) { return x * 27; }
+inline int f1454_28(int x) { return x * 28; }
+inline int f1454_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1457 */
+#include <vector>
+#include "h7764.h"
+#include "h2617.h"
+#include "h622.h"
+#include "h2276.h"
+#include "h6081.h"
+#ifdef X
+#include "h4009.h"
+#endif
+struct S1457 { int a; const char *s = "x//y"; };
+inline int f1457_0(int x) { return x * 0; }
+inline int f1457_1(int x) { return x * 1; }
+inline int f1457_2(int x) { return x * 2; }
+inline int f1457_3(int x) { return x * 3; }
+inline int f1457_4(int x) { return x * 4; }
+inline int f1457_5(int x) { return x * 5; }
+inline int f1457_6(int x) { return x * 6; }
+inline int f1457_7(int x) { return x * 7; }
+inline int f1457_8(int x) { return x * 8; }
+inline int f1457_9(int x) { return x * 9; }
+inline int f1457_10(int x) { return x * 10; }
+inline int f1457_11(int x) { return x * 11; }
+inline int f1457_12(int x) { return x * 12; }
+inline int f1457_13(int x) { return x * 13; }
+inline int f1457_14(int x) { return x * 14; }
+inline int f1457_15(int x) { return x * 15; }
+inline int f1457_16(int x) { return x * 16; }
+inline int f1457_17(int x) { return x * 17; }
+inline int f1457_18(int x) { return x * 18; }
+inline int f1457_19(int x) { return x * 19; }
+inline int f1457_20(int x) { return x * 20; }
+inline int f1457_21(int x) { return x * 21; }
+inline int f1457_22(int x) { return x * 22; }
+inline int f1457_23(int x) { return x * 23; }
+inline int f1457_24(int x) { return x * 24; }
+inline int f1457_25(int x) { return x * 25; }
+inline int f1457_26(int x) { return x * 26; }
+inline int f1457_27(int x) { return x * 27; }
+inline int f1457_28(int x) { return x * 28; }
+inline int f1457_29(int x) { return x * 29; }
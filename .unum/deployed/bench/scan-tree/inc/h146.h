@@ -0,0 +1,42 @@
+#pragma once
+/* header 146 */
+#include <vector>
+#include "h1511.h"
+#include "h4776.h"
+#include "h3087.h"
+#include "h4759.h"
+#include "h8049.h"
+#ifdef X
+#include "h300.h"
+#endif
+struct S146 { int a; const char *s = "x//y"; };
+inline int f146_0(int x) { return x * 0; }
+inline int f146_1(int x) { return x * 1; }
+inline int f146_2(int x) { return x * 2; }
+inline int f146_3(int x) { return x * 3; }
+inline int f146_4(int x) { return x * 4; }
+inline int f146_5(int x) { return x * 5; }
+inline int f146_6(int x) { return x * 6; }
+inline int f146_7(int x) { return x * 7; }
+inline int f146_8(int x) { return x * 8; }
+inline int f146_9(int x) { return x * 9; }
+inline int f146_10(int x) { return x * 10; }
+inline int f146_11(int x) { return x * 11; }
+inline int f146_12(int x) { return x * 12; }
+inline int f146_13(int x) { return x * 13; }
+inline int f146_14(int x) { return x * 14; }
+inline int f146_15(int x) { return x * 15; }
+inline int f146_16(int x) { return x * 16; }
+inline int f146_17(int x) { return x * 17; }
+inline int f146_18(int x) { return x * 18; }
+inline int f146_19(int x) { return x * 19; }
+inline int f146_20(int x) { return x * 20; }
+inline int f146_21(int x) { return x * 21; }
+inline int f146_22(int x) { return x * 22; }
+inline int f146_23(int x) { return x * 23; }
+inline int f146_24(int x) { return x * 24; }
+inline int f146_25(int x) { return x * 25; }
+inline int f146_26(int x) { return x * 26; }
+inline int f146_27(int x) { return x * 27; }
+inline int f146_28(int x) { return x * 28; }
+inline int f146_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1460 */
+#include <vector>
+#include "h8402.h"
+#include "h1906.h"
+#include "h68.h"
+#include "h1339.h"
+#include "h9040.h"
+#ifdef X
+#include "h6853.h"
+#endif
+struct S1460 { int a; const char *s = "x//y"; };
+inline int f1460_0(int x) { return x * 0; }
+inline int f1460_1(int x) { return x * 1; }
+inline int f1460_2(int x) { return x * 2; }
+inline int f1460_3(int x) { return x * 3; }
+inline int f1460_4(int x) { return x * 4; }
+inline int f1460_5(int x) { return x * 5; }
+inline int f1460_6(int x) { return x * 6; }
+inline int f1460_7(int x) { return x * 7; }
+inline int f1460_8(int x) { return x * 8; }
+inline int f1460_9(int x) { return x * 9; }
+inline int f1460_10(int x) { return x * 10; }
+inline int f1460_11(int x) { return x * 11; }
+inline int f1460_12(int x) { return x * 12; }
+inline int f1460_13(int x) { return x * 13; }
+inline int f1460_14(int x) { return x * 14; }
+inline int f1460_15(int x) { return x * 15; }
+inline int f1460_16(int x) { return x * 16; }
+inline int f1460_17(int x) { return x * 17; }
+inline int f1460_18(int x) { return x * 18; }
+inline int f1460_19(int x) { return x * 19; }
+inline int f1460_20(int x) { return x * 20; }
+inline int f1460_21(int x) { return x * 21; }
+inline int f1460_22(int x) { return x * 22; }
+inline int f1460_23(int x) { return x * 23; }
+inline int f1460_24(int x) { return x * 24; }
+inline int f1460_25(int x) { return x * 25; }
+inline int f1460_26(int x) { return x * 26; }
+inline int f1460_27(int x) { return x * 27; }
+inline int f1460_28(int x) { return x * 28; }
+inline int f1460_29(int x) { return x * 29; }
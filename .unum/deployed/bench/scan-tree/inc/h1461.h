@@ -0,0 +1,42 @@
+#pragma once
+/* header 1461 */
+#include <vector>
+#include "h1310.h"
+#include "h4940.h"
+#include "h2386.h"
+#include "h8980.h"
+#include "h6570.h"
+#ifdef X
+#include "h524.h"
+#endif
+struct S1461 { int a; const char *s = "x//y"; };
+inline int f1461_0(int x) { return x * 0; }
+inline int f1461_1(int x) { return x * 1; }
+inline int f1461_2(int x) { return x * 2; }
+inline int f1461_3(int x) { return x * 3; }
+inline int f1461_4(int x) { return x * 4; }
+inline int f1461_5(int x) { return x * 5; }
+inline int f1461_6(int x) { return x * 6; }
+inline int f1461_7(int x) { return x * 7; }
+inline int f1461_8(int x) { return x * 8; }
+inline int f1461_9(int x) { return x * 9; }
+inline int f1461_10(int x) { return x * 10; }
+inline int f1461_11(int x) { return x * 11; }
+inline int f1461_12(int x) { return x * 12; }
+inline int f1461_13(int x) { return x * 13; }
+inline int f1461_14(int x) { return x * 14; }
+inline int f1461_15(int x) { return x * 15; }
+inline int f1461_16(int x) { return x * 16; }
+inline int f1461_17(int x) { return x * 17; }
+inline int f1461_18(int x) { return x * 18; }
+inline int f1461_19(int x) { return x * 19; }
+inline int f1461_20(int x) { return x * 20; }
+inline int f1461_21(int x) { return x * 21; }
+inline int f1461_22(int x) { return x * 22; }
+inline int f1461_23(int x) { return x * 23; }
+inline int f1461_24(int x) { return x * 24; }
+inline int f1461_25(int x) { return x * 25; }
+inline int f1461_26(int x) { return x * 26; }
+inline int f1461_27(int x) { return x * 27; }
+inline int f1461_28(int x) { return x * 28; }
+inline int f1461_29(int x) { return x * 29; }
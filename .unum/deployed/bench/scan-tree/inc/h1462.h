@@ -0,0 +1,42 @@
+#pragma once
+/* header 1462 */
+#include <vector>
+#include "h2504.h"
+#include "h662.h"
+#include "h2387.h"
+#include "h2296.h"
+#include "h8891.h"
+#ifdef X
+#include "h4212.h"
+#endif
+struct S1462 { int a; const char *s = "x//y"; };
+inline int f1462_0(int x) { return x * 0; }
+inline int f1462_1(int x) { return x * 1; }
+inline int f1462_2(int x) { return x * 2; }
+inline int f1462_3(int x) { return x * 3; }
+inline int f1462_4(int x) { return x * 4; }
+inline int f1462_5(int x) { return x * 5; }
+inline int f1462_6(int x) { return x * 6; }
+inline int f1462_7(int x) { return x * 7; }
+inline int f1462_8(int x) { return x * 8; }
+inline int f1462_9(int x) { return x * 9; }
+inline int f1462_10(int x) { return x * 10; }
+inline int f1462_11(int x) { return x * 11; }
+inline int f1462_12(int x) { return x * 12; }
+inline int f1462_13(int x) { return x * 13; }
+inline int f1462_14(int x) { return x * 14; }
+inline int f1462_15(int x) { return x * 15; }
+inline int f1462_16(int x) { return x * 16; }
+inline int f1462_17(int x) { return x * 17; }
+inline int f1462_18(int x) { return x * 18; }
+inline int f1462_19(int x) { return x * 19; }
+inline int f1462_20(int x) { return x * 20; }
+inline int f1462_21(int x) { return x * 21; }
+inline int f1462_22(int x) { return x * 22; }
+inline int f1462_23(int x) { return x * 23; }
+inline int f1462_24(int x) { return x * 24; }
+inline int f1462_25(int x) { return x * 25; }
+inline int f1462_26(int x) { return x * 26; }
+inline int f1462_27(int x) { return x * 27; }
+inline int f1462_28(int x) { return x * 28; }
+inline int f1462_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1463 */
+#include <vector>
+#include "h5558.h"
+#include "h6582.h"
+#include "h2716.h"
+#include "h3188.h"
+#include "h9272.h"
+#ifdef X
+#include "h5176.h"
+#endif
+struct S1463 { int a; const char *s = "x//y"; };
+inline int f1463_0(int x) { return x * 0; }
+inline int f1463_1(int x) { return x * 1; }
+inline int f1463_2(int x) { return x * 2; }
+inline int f1463_3(int x) { return x * 3; }
+inline int f1463_4(int x) { return x * 4; }
+inline int f1463_5(int x) { return x * 5; }
+inline int f1463_6(int x) { return x * 6; }
+inline int f1463_7(int x) { return x * 7; }
+inline int f1463_8(int x) { return x * 8; }
+inline int f1463_9(int x) { return x * 9; }
+inline int f1463_10(int x) { return x * 10; }
+inline int f1463_11(int x) { return x * 11; }
+inline int f1463_12(int x) { return x * 12; }
+inline int f1463_13(int x) { return x * 13; }
+inline int f1463_14(int x) { return x * 14; }
+inline int f1463_15(int x) { return x * 15; }
+inline int f1463_16(int x) { return x * 16; }
+inline int f1463_17(int x) { return x * 17; }
+inline int f1463_18(int x) { return x * 18; }
+inline int f1463_19(int x) { return x * 19; }
+inline int f1463_20(int x) { return x * 20; }
+inline int f1463_21(int x) { return x * 21; }
+inline int f1463_22(int x) { return x * 22; }
+inline int f1463_23(int x) { return x * 23; }
+inline int f1463_24(int x) { return x * 24; }
+inline int f1463_25(int x) { return x * 25; }
+inline int f1463_26(int x) { return x * 26; }
+inline int f1463_27(int x) { return x * 27; }
+inline int f1463_28(int x) { return x * 28; }
+inline int f1463_29(int x) { return x * 29; }
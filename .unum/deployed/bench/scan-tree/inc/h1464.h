@@ -0,0 +1,42 @@
+#pragma once
+/* header 1464 */
+#include <vector>
+#include "h7275.h"
+#include "h562.h"
+#include "h8255.h"
+#include "h7508.h"
+#include "h5040.h"
+#ifdef X
+#include "h3414.h"
+#endif
+struct S1464 { int a; const char *s = "x//y"; };
+inline int f1464_0(int x) { return x * 0; }
+inline int f1464_1(int x) { return x * 1; }
+inline int f1464_2(int x) { return x * 2; }
+inline int f1464_3(int x) { return x * 3; }
+inline int f1464_4(int x) { return x * 4; }
+inline int f1464_5(int x) { return x * 5; }
+inline int f1464_6(int x) { return x * 6; }
+inline int f1464_7(int x) { return x * 7; }
+inline int f1464_8(int x) { return x * 8; }
+inline int f1464_9(int x) { return x * 9; }
+inline int f1464_10(int x) { return x * 10; }
+inline int f1464_11(int x) { return x * 11; }
+inline int f1464_12(int x) { return x * 12; }
+inline int f1464_13(int x) { return x * 13; }
+inline int f1464_14(int x) { return x * 14; }
+inline int f1464_15(int x) { return x * 15; }
+inline int f1464_16(int x) { return x * 16; }
+inline int f1464_17(int x) { return x * 17; }
+inline int f1464_18(int x) { return x * 18; }
+inline int f1464_19(int x) { return x * 19; }
+inline int f1464_20(int x) { return x * 20; }
+inline int f1464_21(int x) { return x * 21; }
+inline int f1464_22(int x) { return x * 22; }
+inline int f1464_23(int x) { return x * 23; }
+inline int f1464_24(int x) { return x * 24; }
+inline int f1464_25(int x) { return x * 25; }
+inline int f1464_26(int x) { return x * 26; }
+inline int f1464_27(int x) { return x * 27; }
+inline int f1464_28(int x) { return x * 28; }
+inline int f1464_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1469 */
+#include <vector>
+#include "h4793.h"
+#include "h3762.h"
+#include "h8513.h"
+#include "h2056.h"
+#include "h3418.h"
+#ifdef X
+#include "h4434.h"
+#endif
+struct S1469 { int a; const char *s = "x//y"; };
+inline int f1469_0(int x) { return x * 0; }
+inline int f1469_1(int x) { return x * 1; }
+inline int f1469_2(int x) { return x * 2; }
+inline int f1469_3(int x) { return x * 3; }
+inline int f1469_4(int x) { return x * 4; }
+inline int f1469_5(int x) { return x * 5; }
+inline int f1469_6(int x) { return x * 6; }
+inline int f1469_7(int x) { return x * 7; }
+inline int f1469_8(int x) { return x * 8; }
+inline int f1469_9(int x) { return x * 9; }
+inline int f1469_10(int x) { return x * 10; }
+inline int f1469_11(int x) { return x * 11; }
+inline int f1469_12(int x) { return x * 12; }
+inline int f1469_13(int x) { return x * 13; }
+inline int f1469_14(int x) { return x * 14; }
+inline int f1469_15(int x) { return x * 15; }
+inline int f1469_16(int x) { return x * 16; }
+inline int f1469_17(int x) { return x * 17; }
+inline int f1469_18(int x) { return x * 18; }
+inline int f1469_19(int x) { return x * 19; }
+inline int f1469_20(int x) { return x * 20; }
+inline int f1469_21(int x) { return x * 21; }
+inline int f1469_22(int x) { return x * 22; }
+inline int f1469_23(int x) { return x * 23; }
+inline int f1469_24(int x) { return x * 24; }
+inline int f1469_25(int x) { return x * 25; }
+inline int f1469_26(int x) { return x * 26; }
+inline int f1469_27(int x) { return x * 27; }
+inline int f1469_28(int x) { return x * 28; }
+inline int f1469_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1470 */
+#include <vector>
+#include "h5774.h"
+#include "h7884.h"
+#include "h4308.h"
+#include "h3032.h"
+#include "h322.h"
+#ifdef X
+#include "h2044.h"
+#endif
+struct S1470 { int a; const char *s = "x//y"; };
+inline int f1470_0(int x) { return x * 0; }
+inline int f1470_1(int x) { return x * 1; }
+inline int f1470_2(int x) { return x * 2; }
+inline int f1470_3(int x) { return x * 3; }
+inline int f1470_4(int x) { return x * 4; }
+inline int f1470_5(int x) { return x * 5; }
+inline int f1470_6(int x) { return x * 6; }
+inline int f1470_7(int x) { return x * 7; }
+inline int f1470_8(int x) { return x * 8; }
+inline int f1470_9(int x) { return x * 9; }
+inline int f1470_10(int x) { return x * 10; }
+inline int f1470_11(int x) { return x * 11; }
+inline int f1470_12(int x) { return x * 12; }
+inline int f1470_13(int x) { return x * 13; }
+inline int f1470_14(int x) { return x * 14; }
+inline int f1470_15(int x) { return x * 15; }
+inline int f1470_16(int x) { return x * 16; }
+inline int f1470_17(int x) { return x * 17; }
+inline int f1470_18(int x) { return x * 18; }
+inline int f1470_19(int x) { return x * 19; }
+inline int f1470_20(int x) { return x * 20; }
+inline int f1470_21(int x) { return x * 21; }
+inline int f1470_22(int x) { return x * 22; }
+inline int f1470_23(int x) { return x * 23; }
+inline int f1470_24(int x) { return x * 24; }
+inline int f1470_25(int x) { return x * 25; }
+inline int f1470_26(int x) { return x * 26; }
+inline int f1470_27(int x) { return x * 27; }
+inline int f1470_28(int x) { return x * 28; }
+inline int f1470_29(int x) { return x * 29; }
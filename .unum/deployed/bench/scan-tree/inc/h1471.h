@@ -0,0 +1,42 @@
+#pragma once
+/* header 1471 */
+#include <vector>
+#include "h9600.h"
+#include "h27.h"
+#include "h101.h"
+#include "h2190.h"
+#include "h2557.h"
+#ifdef X
+#include "h905.h"
+#endif
+struct S1471 { int a; const char *s = "x//y"; };
+inline int f1471_0(int x) { return x * 0; }
+inline int f1471_1(int x) { return x * 1; }
+inline int f1471_2(int x) { return x * 2; }
+inline int f1471_3(int x) { return x * 3; }
+inline int f1471_4(int x) { return x * 4; }
+inline int f1471_5(int x) { return x * 5; }
+inline int f1471_6(int x) { return x * 6; }
+inline int f1471_7(int x) { return x * 7; }
+inline int f1471_8(int x) { return x * 8; }
+inline int f1471_9(int x) { return x * 9; }
+inline int f1471_10(int x) { return x * 10; }
+inline int f1471_11(int x) { return x * 11; }
+inline int f1471_12(int x) { return x * 12; }
+inline int f1471_13(int x) { return x * 13; }
+inline int f1471_14(int x) { return x * 14; }
+inline int f1471_15(int x) { return x * 15; }
+inline int f1471_16(int x) { return x * 16; }
+inline int f1471_17(int x) { return x * 17; }
+inline int f1471_18(int x) { return x * 18; }
+inline int f1471_19(int x) { return x * 19; }
+inline int f1471_20(int x) { return x * 20; }
+inline int f1471_21(int x) { return x * 21; }
+inline int f1471_22(int x) { return x * 22; }
+inline int f1471_23(int x) { return x * 23; }
+inline int f1471_24(int x) { return x * 24; }
+inline int f1471_25(int x) { return x * 25; }
+inline int f1471_26(int x) { return x * 26; }
+inline int f1471_27(int x) { return x * 27; }
+inline int f1471_28(int x) { return x * 28; }
+inline int f1471_29(int x) { return x * 29; }
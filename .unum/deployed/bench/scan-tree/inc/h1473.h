@@ -0,0 +1,42 @@
+#pragma once
+/* header 1473 */
+#include <vector>
+#include "h5704.h"
+#include "h9855.h"
+#include "h4344.h"
+#include "h6461.h"
+#include "h8524.h"
+#ifdef X
+#include "h4485.h"
+#endif
+struct S1473 { int a; const char *s = "x//y"; };
+inline int f1473_0(int x) { return x * 0; }
+inline int f1473_1(int x) { return x * 1; }
+inline int f1473_2(int x) { return x * 2; }
+inline int f1473_3(int x) { return x * 3; }
+inline int f1473_4(int x) { return x * 4; }
+inline int f1473_5(int x) { return x * 5; }
+inline int f1473_6(int x) { return x * 6; }
+inline int f1473_7(int x) { return x * 7; }
+inline int f1473_8(int x) { return x * 8; }
+inline int f1473_9(int x) { return x * 9; }
+inline int f1473_10(int x) { return x * 10; }
+inline int f1473_11(int x) { return x * 11; }
+inline int f1473_12(int x) { return x * 12; }
+inline int f1473_13(int x) { return x * 13; }
+inline int f1473_14(int x) { return x * 14; }
+inline int f1473_15(int x) { return x * 15; }
+inline int f1473_16(int x) { return x * 16; }
+inline int f1473_17(int x) { return x * 17; }
+inline int f1473_18(int x) { return x * 18; }
+inline int f1473_19(int x) { return x * 19; }
+inline int f1473_20(int x) { return x * 20; }
+inline int f1473_21(int x) { return x * 21; }
+inline int f1473_22(int x) { return x * 22; }
+inline int f1473_23(int x) { return x * 23; }
+inline int f1473_24(int x) { return x * 24; }
+inline int f1473_25(int x) { return x * 25; }
+inline int f1473_26(int x) { return x * 26; }
+inline int f1473_27(int x) { return x * 27; }
+inline int f1473_28(int x) { return x * 28; }
+inline int f1473_29(int x) { return x * 29; }
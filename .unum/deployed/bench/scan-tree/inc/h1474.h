@@ -0,0 +1,42 @@
+#pragma once
+/* header 1474 */
+#include <vector>
+#include "h74.h"
+#include "h9455.h"
+#include "h5774.h"
+#include "h7499.h"
+#include "h4145.h"
+#ifdef X
+#include "h4624.h"
+#endif
+struct S1474 { int a; const char *s = "x//y"; };
+inline int f1474_0(int x) { return x * 0; }
+inline int f1474_1(int x) { return x * 1; }
+inline int f1474_2(int x) { return x * 2; }
+inline int f1474_3(int x) { return x * 3; }
+inline int f1474_4(int x) { return x * 4; }
+inline int f1474_5(int x) { return x * 5; }
+inline int f1474_6(int x) { return x * 6; }
+inline int f1474_7(int x) { return x * 7; }
+inline int f1474_8(int x) { return x * 8; }
+inline int f1474_9(int x) { return x * 9; }
+inline int f1474_10(int x) { return x * 10; }
+inline int f1474_11(int x) { return x * 11; }
+inline int f1474_12(int x) { return x * 12; }
+inline int f1474_13(int x) { return x * 13; }
+inline int f1474_14(int x) { return x * 14; }
+inline int f1474_15(int x) { return x * 15; }
+inline int f1474_16(int x) { return x * 16; }
+inline int f1474_17(int x) { return x * 17; }
+inline int f1474_18(int x) { return x * 18; }
+inline int f1474_19(int x) { return x * 19; }
+inline int f1474_20(int x) { return x * 20; }
+inline int f1474_21(int x) { return x * 21; }
+inline int f1474_22(int x) { return x * 22; }
+inline int f1474_23(int x) { return x * 23; }
+inline int f1474_24(int x) { return x * 24; }
+inline int f1474_25(int x) { return x * 25; }
+inline int f1474_26(int x) { return x * 26; }
+inline int f1474_27(int x) { return x * 27; }
+inline int f1474_28(int x) { return x * 28; }
+inline int f1474_29(int x) { return x * 29; }
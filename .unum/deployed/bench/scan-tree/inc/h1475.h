@@ -0,0 +1,42 @@
+#pragma once
+/* header 1475 */
+#include <vector>
+#include "h7625.h"
+#include "h296.h"
+#include "h9836.h"
+#include "h9832.h"
+#include "h7255.h"
+#ifdef X
+#include "h3581.h"
+#endif
+struct S1475 { int a; const char *s = "x//y"; };
+inline int f1475_0(int x) { return x * 0; }
+inline int f1475_1(int x) { return x * 1; }
+inline int f1475_2(int x) { return x * 2; }
+inline int f1475_3(int x) { return x * 3; }
+inline int f1475_4(int x) { return x * 4; }
+inline int f1475_5(int x) { return x * 5; }
+inline int f1475_6(int x) { return x * 6; }
+inline int f1475_7(int x) { return x * 7; }
+inline int f1475_8(int x) { return x * 8; }
+inline int f1475_9(int x) { return x * 9; }
+inline int f1475_10(int x) { return x * 10; }
+inline int f1475_11(int x) { return x * 11; }
+inline int f1475_12(int x) { return x * 12; }
+inline int f1475_13(int x) { return x * 13; }
+inline int f1475_14(int x) { return x * 14; }
+inline int f1475_15(int x) { return x * 15; }
+inline int f1475_16(int x) { return x * 16; }
+inline int f1475_17(int x) { return x * 17; }
+inline int f1475_18(int x) { return x * 18; }
+inline int f1475_19(int x) { return x * 19; }
+inline int f1475_20(int x) { return x * 20; }
+inline int f1475_21(int x) { return x * 21; }
+inline int f1475_22(int x) { return x * 22; }
+inline int f1475_23(int x) { return x * 23; }
+inline int f1475_24(int x) { return x * 24; }
+inline int f1475_25(int x) { return x * 25; }
+inline int f1475_26(int x) { return x * 26; }
+inline int f1475_27(int x) { return x * 27; }
+inline int f1475_28(int x) { return x * 28; }
+inline int f1475_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1476 */
+#include <vector>
+#include "h1999.h"
+#include "h5444.h"
+#include "h1275.h"
+#include "h8253.h"
+#include "h5589.h"
+#ifdef X
+#include "h7019.h"
+#endif
+struct S1476 { int a; const char *s = "x//y"; };
+inline int f1476_0(int x) { return x * 0; }
+inline int f1476_1(int x) { return x * 1; }
+inline int f1476_2(int x) { return x * 2; }
+inline int f1476_3(int x) { return x * 3; }
+inline int f1476_4(int x) { return x * 4; }
+inline int f1476_5(int x) { return x * 5; }
+inline int f1476_6(int x) { return x * 6; }
+inline int f1476_7(int x) { return x * 7; }
+inline int f1476_8(int x) { return x * 8; }
+inline int f1476_9(int x) { return x * 9; }
+inline int f1476_10(int x) { return x * 10; }
+inline int f1476_11(int x) { return x * 11; }
+inline int f1476_12(int x) { return x * 12; }
+inline int f1476_13(int x) { return x * 13; }
+inline int f1476_14(int x) { return x * 14; }
+inline int f1476_15(int x) { return x * 15; }
+inline int f1476_16(int x) { return x * 16; }
+inline int f1476_17(int x) { return x * 17; }
+inline int f1476_18(int x) { return x * 18; }
+inline int f1476_19(int x) { return x * 19; }
+inline int f1476_20(int x) { return x * 20; }
+inline int f1476_21(int x) { return x * 21; }
+inline int f1476_22(int x) { return x * 22; }
+inline int f1476_23(int x) { return x * 23; }
+inline int f1476_24(int x) { return x * 24; }
+inline int f1476_25(int x) { return x * 25; }
+inline int f1476_26(int x) { return x * 26; }
+inline int f1476_27(int x) { return x * 27; }
+inline int f1476_28(int x) { return x * 28; }
+inline int f1476_29(int x) { return x * 29; }
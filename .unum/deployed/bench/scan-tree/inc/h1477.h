@@ -0,0 +1,42 @@
+#pragma once
+/* header 1477 */
+#include <vector>
+#include "h5763.h"
+#include "h3864.h"
+#include "h5313.h"
+#include "h7186.h"
+#include "h9817.h"
+#ifdef X
+#include "h236.h"
+#endif
+struct S1477 { int a; const char *s = "x//y"; };
+inline int f1477_0(int x) { return x * 0; }
+inline int f1477_1(int x) { return x * 1; }
+inline int f1477_2(int x) { return x * 2; }
+inline int f1477_3(int x) { return x * 3; }
+inline int f1477_4(int x) { return x * 4; }
+inline int f1477_5(int x) { return x * 5; }
+inline int f1477_6(int x) { return x * 6; }
+inline int f1477_7(int x) { return x * 7; }
+inline int f1477_8(int x) { return x * 8; }
+inline int f1477_9(int x) { return x * 9; }
+inline int f1477_10(int x) { return x * 10; }
+inline int f1477_11(int x) { return x * 11; }
+inline int f1477_12(int x) { return x * 12; }
+inline int f1477_13(int x) { return x * 13; }
+inline int f1477_14(int x) { return x * 14; }
+inline int f1477_15(int x) { return x * 15; }
+inline int f1477_16(int x) { return x * 16; }
+inline int f1477_17(int x) { return x * 17; }
+inline int f1477_18(int x) { return x * 18; }
+inline int f1477_19(int x) { return x * 19; }
+inline int f1477_20(int x) { return x * 20; }
+inline int f1477_21(int x) { return x * 21; }
+inline int f1477_22(int x) { return x * 22; }
+inline int f1477_23(int x) { return x * 23; }
+inline int f1477_24(int x) { return x * 24; }
+inline int f1477_25(int x) { return x * 25; }
+inline int f1477_26(int x) { return x * 26; }
+inline int f1477_27(int x) { return x * 27; }
+inline int f1477_28(int x) { return x * 28; }
+inline int f1477_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1479 */
+#include <vector>
+#include "h1486.h"
+#include "h1236.h"
+#include "h8002.h"
+#include "h2700.h"
+#include "h5890.h"
+#ifdef X
+#include "h6573.h"
+#endif
+struct S1479 { int a; const char *s = "x//y"; };
+inline int f1479_0(int x) { return x * 0; }
+inline int f1479_1(int x) { return x * 1; }
+inline int f1479_2(int x) { return x * 2; }
+inline int f1479_3(int x) { return x * 3; }
+inline int f1479_4(int x) { return x * 4; }
+inline int f1479_5(int x) { return x * 5; }
+inline int f1479_6(int x) { return x * 6; }
+inline int f1479_7(int x) { return x * 7; }
+inline int f1479_8(int x) { return x * 8; }
+inline int f1479_9(int x) { return x * 9; }
+inline int f1479_10(int x) { return x * 10; }
+inline int f1479_11(int x) { return x * 11; }
+inline int f1479_12(int x) { return x * 12; }
+inline int f1479_13(int x) { return x * 13; }
+inline int f1479_14(int x) { return x * 14; }
+inline int f1479_15(int x) { return x * 15; }
+inline int f1479_16(int x) { return x * 16; }
+inline int f1479_17(int x) { return x * 17; }
+inline int f1479_18(int x) { return x * 18; }
+inline int f1479_19(int x) { return x * 19; }
+inline int f1479_20(int x) { return x * 20; }
+inline int f1479_21(int x) { return x * 21; }
+inline int f1479_22(int x) { return x * 22; }
+inline int f1479_23(int x) { return x * 23; }
+inline int f1479_24(int x) { return x * 24; }
+inline int f1479_25(int x) { return x * 25; }
+inline int f1479_26(int x) { return x * 26; }
+inline int f1479_27(int x) { return x * 27; }
+inline int f1479_28(int x) { return x * 28; }
+inline int f1479_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 148 */
+#include <vector>
+#include "h3627.h"
+#include "h2750.h"
+#include "h1987.h"
+#include "h5026.h"
+#include "h8521.h"
+#ifdef X
+#include "h7505.h"
+#endif
+struct S148 { int a; const char *s = "x//y"; };
+inline int f148_0(int x) { return x * 0; }
+inline int f148_1(int x) { return x * 1; }
+inline int f148_2(int x) { return x * 2; }
+inline int f148_3(int x) { return x * 3; }
+inline int f148_4(int x) { return x * 4; }
+inline int f148_5(int x) { return x * 5; }
+inline int f148_6(int x) { return x * 6; }
+inline int f148_7(int x) { return x * 7; }
+inline int f148_8(int x) { return x * 8; }
+inline int f148_9(int x) { return x * 9; }
+inline int f148_10(int x) { return x * 10; }
+inline int f148_11(int x) { return x * 11; }
+inline int f148_12(int x) { return x * 12; }
+inline int f148_13(int x) { return x * 13; }
+inline int f148_14(int x) { return x * 14; }
+inline int f148_15(int x) { return x * 15; }
+inline int f148_16(int x) { return x * 16; }
+inline int f148_17(int x) { return x * 17; }
+inline int f148_18(int x) { return x * 18; }
+inline int f148_19(int x) { return x * 19; }
+inline int f148_20(int x) { return x * 20; }
+inline int f148_21(int x) { return x * 21; }
+inline int f148_22(int x) { return x * 22; }
+inline int f148_23(int x) { return x * 23; }
+inline int f148_24(int x) { return x * 24; }
+inline int f148_25(int x) { return x * 25; }
+inline int f148_26(int x) { return x * 26; }
+inline int f148_27(int x) { return x * 27; }
+inline int f148_28(int x) { return x * 28; }
+inline int f148_29(int x) { return x * 29; }
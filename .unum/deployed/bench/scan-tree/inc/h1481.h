@@ -0,0 +1,42 @@
+#pragma once
+/* header 1481 */
+#include <vector>
+#include "h193.h"
+#include "h9018.h"
+#include "h9180.h"
+#include "h3233.h"
+#include "h1648.h"
+#ifdef X
+#include "h3497.h"
+#endif
+struct S1481 { int a; const char *s = "x//y"; };
+inline int f1481_0(int x) { return x * 0; }
+inline int f1481_1(int x) { return x * 1; }
+inline int f1481_2(int x) { return x * 2; }
+inline int f1481_3(int x) { return x * 3; }
+inline int f1481_4(int x) { return x * 4; }
+inline int f1481_5(int x) { return x * 5; }
+inline int f1481_6(int x) { return x * 6; }
+inline int f1481_7(int x) { return x * 7; }
+inline int f1481_8(int x) { return x * 8; }
+inline int f1481_9(int x) { return x * 9; }
+inline int f1481_10(int x) { return x * 10; }
+inline int f1481_11(int x) { return x * 11; }
+inline int f1481_12(int x) { return x * 12; }
+inline int f1481_13(int x) { return x * 13; }
+inline int f1481_14(int x) { return x * 14; }
+inline int f1481_15(int x) { return x * 15; }
+inline int f1481_16(int x) { return x * 16; }
+inline int f1481_17(int x) { return x * 17; }
+inline int f1481_18(int x) { return x * 18; }
+inline int f1481_19(int x) { return x * 19; }
+inline int f1481_20(int x) { return x * 20; }
+inline int f1481_21(int x) { return x * 21; }
+inline int f1481_22(int x) { return x * 22; }
+inline int f1481_23(int x) { return x * 23; }
+inline int f1481_24(int x) { return x * 24; }
+inline int f1481_25(int x) { return x * 25; }
+inline int f1481_26(int x) { return x * 26; }
+inline int f1481_27(int x) { return x * 27; }
+inline int f1481_28(int x) { return x * 28; }
+inline int f1481_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1484 */
+#include <vector>
+#include "h5574.h"
+#include "h6276.h"
+#include "h16.h"
+#include "h7076.h"
+#include "h9968.h"
+#ifdef X
+#include "h5934.h"
+#endif
+struct S1484 { int a; const char *s = "x//y"; };
+inline int f1484_0(int x) { return x * 0; }
+inline int f1484_1(int x) { return x * 1; }
+inline int f1484_2(int x) { return x * 2; }
+inline int f1484_3(int x) { return x * 3; }
+inline int f1484_4(int x) { return x * 4; }
+inline int f1484_5(int x) { return x * 5; }
+inline int f1484_6(int x) { return x * 6; }
+inline int f1484_7(int x) { return x * 7; }
+inline int f1484_8(int x) { return x * 8; }
+inline int f1484_9(int x) { return x * 9; }
+inline int f1484_10(int x) { return x * 10; }
+inline int f1484_11(int x) { return x * 11; }
+inline int f1484_12(int x) { return x * 12; }
+inline int f1484_13(int x) { return x * 13; }
+inline int f1484_14(int x) { return x * 14; }
+inline int f1484_15(int x) { return x * 15; }
+inline int f1484_16(int x) { return x * 16; }
+inline int f1484_17(int x) { return x * 17; }
+inline int f1484_18(int x) { return x * 18; }
+inline int f1484_19(int x) { return x * 19; }
+inline int f1484_20(int x) { return x * 20; }
+inline int f1484_21(int x) { return x * 21; }
+inline int f1484_22(int x) { return x * 22; }
+inline int f1484_23(int x) { return x * 23; }
+inline int f1484_24(int x) { return x * 24; }
+inline int f1484_25(int x) { return x * 25; }
+inline int f1484_26(int x) { return x * 26; }
+inline int f1484_27(int x) { return x * 27; }
+inline int f1484_28(int x) { return x * 28; }
+inline int f1484_29(int x) { return x * 29; }
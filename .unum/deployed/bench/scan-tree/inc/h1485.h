@@ -0,0 +1,42 @@
+#pragma once
+/* header 1485 */
+#include <vector>
+#include "h3324.h"
+#include "h7987.h"
+#include "h663.h"
+#include "h313.h"
+#include "h591.h"
+#ifdef X
+#include "h8787.h"
+#endif
+struct S1485 { int a; const char *s = "x//y"; };
+inline int f1485_0(int x) { return x * 0; }
+inline int f1485_1(int x) { return x * 1; }
+inline int f1485_2(int x) { return x * 2; }
+inline int f1485_3(int x) { return x * 3; }
+inline int f1485_4(int x) { return x * 4; }
+inline int f1485_5(int x) { return x * 5; }
+inline int f1485_6(int x) { return x * 6; }
+inline int f1485_7(int x) { return x * 7; }
+inline int f1485_8(int x) { return x * 8; }
+inline int f1485_9(int x) { return x * 9; }
+inline int f1485_10(int x) { return x * 10; }
+inline int f1485_11(int x) { return x * 11; }
+inline int f1485_12(int x) { return x * 12; }
+inline int f1485_13(int x) { return x * 13; }
+inline int f1485_14(int x) { return x * 14; }
+inline int f1485_15(int x) { return x * 15; }
+inline int f1485_16(int x) { return x * 16; }
+inline int f1485_17(int x) { return x * 17; }
+inline int f1485_18(int x) { return x * 18; }
+inline int f1485_19(int x) { return x * 19; }
+inline int f1485_20(int x) { return x * 20; }
+inline int f1485_21(int x) { return x * 21; }
+inline int f1485_22(int x) { return x * 22; }
+inline int f1485_23(int x) { return x * 23; }
+inline int f1485_24(int x) { return x * 24; }
+inline int f1485_25(int x) { return x * 25; }
+inline int f1485_26(int x) { return x * 26; }
+inline int f1485_27(int x) { return x * 27; }
+inline int f1485_28(int x) { return x * 28; }
+inline int f1485_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1487 */
+#include <vector>
+#include "h7185.h"
+#include "h8434.h"
+#include "h2449.h"
+#include "h2686.h"
+#include "h2724.h"
+#ifdef X
+#include "h6921.h"
+#endif
+struct S1487 { int a; const char *s = "x//y"; };
+inline int f1487_0(int x) { return x * 0; }
+inline int f1487_1(int x) { return x * 1; }
+inline int f1487_2(int x) { return x * 2; }
+inline int f1487_3(int x) { return x * 3; }
+inline int f1487_4(int x) { return x * 4; }
+inline int f1487_5(int x) { return x * 5; }
+inline int f1487_6(int x) { return x * 6; }
+inline int f1487_7(int x) { return x * 7; }
+inline int f1487_8(int x) { return x * 8; }
+inline int f1487_9(int x) { return x * 9; }
+inline int f1487_10(int x) { return x * 10; }
+inline int f1487_11(int x) { return x * 11; }
+inline int f1487_12(int x) { return x * 12; }
+inline int f1487_13(int x) { return x * 13; }
+inline int f1487_14(int x) { return x * 14; }
+inline int f1487_15(int x) { return x * 15; }
+inline int f1487_16(int x) { return x * 16; }
+inline int f1487_17(int x) { return x * 17; }
+inline int f1487_18(int x) { return x * 18; }
+inline int f1487_19(int x) { return x * 19; }
+inline int f1487_20(int x) { return x * 20; }
+inline int f1487_21(int x) { return x * 21; }
+inline int f1487_22(int x) { return x * 22; }
+inline int f1487_23(int x) { return x * 23; }
+inline int f1487_24(int x) { return x * 24; }
+inline int f1487_25(int x) { return x * 25; }
+inline int f1487_26(int x) { return x * 26; }
+inline int f1487_27(int x) { return x * 27; }
+inline int f1487_28(int x) { return x * 28; }
+inline int f1487_29(int x) { return x * 29; }
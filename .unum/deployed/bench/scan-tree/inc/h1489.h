@@ -0,0 +1,42 @@
+#pragma once
+/* header 1489 */
+#include <vector>
+#include "h4231.h"
+#include "h3873.h"
+#include "h7345.h"
+#include "h6018.h"
+#include "h4487.h"
+#ifdef X
+#include "h5444.h"
+#endif
+struct S1489 { int a; const char *s = "x//y"; };
+inline int f1489_0(int x) { return x * 0; }
+inline int f1489_1(int x) { return x * 1; }
+inline int f1489_2(int x) { return x * 2; }
+inline int f1489_3(int x) { return x * 3; }
+inline int f1489_4(int x) { return x * 4; }
+inline int f1489_5(int x) { return x * 5; }
+inline int f1489_6(int x) { return x * 6; }
+inline int f1489_7(int x) { return x * 7; }
+inline int f1489_8(int x) { return x * 8; }
+inline int f1489_9(int x) { return x * 9; }
+inline int f1489_10(int x) { return x * 10; }
+inline int f1489_11(int x) { return x * 11; }
+inline int f1489_12(int x) { return x * 12; }
+inline int f1489_13(int x) { return x * 13; }
+inline int f1489_14(int x) { return x * 14; }
+inline int f1489_15(int x) { return x * 15; }
+inline int f1489_16(int x) { return x * 16; }
+inline int f1489_17(int x) { return x * 17; }
+inline int f1489_18(int x) { return x * 18; }
+inline int f1489_19(int x) { return x * 19; }
+inline int f1489_20(int x) { return x * 20; }
+inline int f1489_21(int x) { return x * 21; }
+inline int f1489_22(int x) { return x * 22; }
+inline int f1489_23(int x) { return x * 23; }
+inline int f1489_24(int x) { return x * 24; }
+inline int f1489_25(int x) { return x * 25; }
+inline int f1489_26(int x) { return x * 26; }
+inline int f1489_27(int x) { return x * 27; }
+inline int f1489_28(int x) { return x * 28; }
+inline int f1489_29(int x) { return x * 29; }
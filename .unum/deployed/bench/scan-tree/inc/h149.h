@@ -0,0 +1,42 @@
+#pragma once
+/* header 149 */
+#include <vector>
+#include "h7212.h"
+#include "h1970.h"
+#include "h2776.h"
+#include "h1371.h"
+#include "h5196.h"
+#ifdef X
+#include "h5597.h"
+#endif
+struct S149 { int a; const char *s = "x//y"; };
+inline int f149_0(int x) { return x * 0; }
+inline int f149_1(int x) { return x * 1; }
+inline int f149_2(int x) { return x * 2; }
+inline int f149_3(int x) { return x * 3; }
+inline int f149_4(int x) { return x * 4; }
+inline int f149_5(int x) { return x * 5; }
+inline int f149_6(int x) { return x * 6; }
+inline int f149_7(int x) { return x * 7; }
+inline int f149_8(int x) { return x * 8; }
+inline int f149_9(int x) { return x * 9; }
+inline int f149_10(int x) { return x * 10; }
+inline int f149_11(int x) { return x * 11; }
+inline int f149_12(int x) { return x * 12; }
+inline int f149_13(int x) { return x * 13; }
+inline int f149_14(int x) { return x * 14; }
+inline int f149_15(int x) { return x * 15; }
+inline int f149_16(int x) { return x * 16; }
+inline int f149_17(int x) { return x * 17; }
+inline int f149_18(int x) { return x * 18; }
+inline int f149_19(int x) { return x * 19; }
+inline int f149_20(int x) { return x * 20; }
+inline int f149_21(int x) { return x * 21; }
+inline int f149_22(int x) { return x * 22; }
+inline int f149_23(int x) { return x * 23; }
+inline int f149_24(int x) { return x * 24; }
+inline int f149_25(int x) { return x * 25; }
+inline int f149_26(int x) { return x * 26; }
+inline int f149_27(int x) { return x * 27; }
+inline int f149_28(int x) { return x * 28; }
+inline int f149_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1493 */
+#include <vector>
+#include "h7240.h"
+#include "h4522.h"
+#include "h3427.h"
+#include "h2427.h"
+#include "h2672.h"
+#ifdef X
+#include "h4041.h"
+#endif
+struct S1493 { int a; const char *s = "x//y"; };
+inline int f1493_0(int x) { return x * 0; }
+inline int f1493_1(int x) { return x * 1; }
+inline int f1493_2(int x) { return x * 2; }
+inline int f1493_3(int x) { return x * 3; }
+inline int f1493_4(int x) { return x * 4; }
+inline int f1493_5(int x) { return x * 5; }
+inline int f1493_6(int x) { return x * 6; }
+inline int f1493_7(int x) { return x * 7; }
+inline int f1493_8(int x) { return x * 8; }
+inline int f1493_9(int x) { return x * 9; }
+inline int f1493_10(int x) { return x * 10; }
+inline int f1493_11(int x) { return x * 11; }
+inline int f1493_12(int x) { return x * 12; }
+inline int f1493_13(int x) { return x * 13; }
+inline int f1493_14(int x) { return x * 14; }
+inline int f1493_15(int x) { return x * 15; }
+inline int f1493_16(int x) { return x * 16; }
+inline int f1493_17(int x) { return x * 17; }
+inline int f1493_18(int x) { return x * 18; }
+inline int f1493_19(int x) { return x * 19; }
+inline int f1493_20(int x) { return x * 20; }
+inline int f1493_21(int x) { return x * 21; }
+inline int f1493_22(int x) { return x * 22; }
+inline int f1493_23(int x) { return x * 23; }
+inline int f1493_24(int x) { return x * 24; }
+inline int f1493_25(int x) { return x * 25; }
+inline int f1493_26(int x) { return x * 26; }
+inline int f1493_27(int x) { return x * 27; }
+inline int f1493_28(int x) { return x * 28; }
+inline int f1493_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1496 */
+#include <vector>
+#include "h8470.h"
+#include "h9314.h"
+#include "h5992.h"
+#include "h8572.h"
+#include "h8178.h"
+#ifdef X
+#include "h5887.h"
+#endif
+struct S1496 { int a; const char *s = "x//y"; };
+inline int f1496_0(int x) { return x * 0; }
+inline int f1496_1(int x) { return x * 1; }
+inline int f1496_2(int x) { return x * 2; }
+inline int f1496_3(int x) { return x * 3; }
+inline int f1496_4(int x) { return x * 4; }
+inline int f1496_5(int x) { return x * 5; }
+inline int f1496_6(int x) { return x * 6; }
+inline int f1496_7(int x) { return x * 7; }
+inline int f1496_8(int x) { return x * 8; }
+inline int f1496_9(int x) { return x * 9; }
+inline int f1496_10(int x) { return x * 10; }
+inline int f1496_11(int x) { return x * 11; }
+inline int f1496_12(int x) { return x * 12; }
+inline int f1496_13(int x) { return x * 13; }
+inline int f1496_14(int x) { return x * 14; }
+inline int f1496_15(int x) { return x * 15; }
+inline int f1496_16(int x) { return x * 16; }
+inline int f1496_17(int x) { return x * 17; }
+inline int f1496_18(int x) { return x * 18; }
+inline int f1496_19(int x) { return x * 19; }
+inline int f1496_20(int x) { return x * 20; }
+inline int f1496_21(int x) { return x * 21; }
+inline int f1496_22(int x) { return x * 22; }
+inline int f1496_23(int x) { return x * 23; }
+inline int f1496_24(int x) { return x * 24; }
+inline int f1496_25(int x) { return x * 25; }
+inline int f1496_26(int x) { return x * 26; }
+inline int f1496_27(int x) { return x * 27; }
+inline int f1496_28(int x) { return x * 28; }
+inline int f1496_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1497 */
+#include <vector>
+#include "h2053.h"
+#include "h5097.h"
+#include "h1799.h"
+#include "h4180.h"
+#include "h7072.h"
+#ifdef X
+#include "h3169.h"
+#endif
+struct S1497 { int a; const char *s = "x//y"; };
+inline int f1497_0(int x) { return x * 0; }
+inline int f1497_1(int x) { return x * 1; }
+inline int f1497_2(int x) { return x * 2; }
+inline int f1497_3(int x) { return x * 3; }
+inline int f1497_4(int x) { return x * 4; }
+inline int f1497_5(int x) { return x * 5; }
+inline int f1497_6(int x) { return x * 6; }
+inline int f1497_7(int x) { return x * 7; }
+inline int f1497_8(int x) { return x * 8; }
+inline int f1497_9(int x) { return x * 9; }
+inline int f1497_10(int x) { return x * 10; }
+inline int f1497_11(int x) { return x * 11; }
+inline int f1497_12(int x) { return x * 12; }
+inline int f1497_13(int x) { return x * 13; }
+inline int f1497_14(int x) { return x * 14; }
+inline int f1497_15(int x) { return x * 15; }
+inline int f1497_16(int x) { return x * 16; }
+inline int f1497_17(int x) { return x * 17; }
+inline int f1497_18(int x) { return x * 18; }
+inline int f1497_19(int x) { return x * 19; }
+inline int f1497_20(int x) { return x * 20; }
+inline int f1497_21(int x) { return x * 21; }
+inline int f1497_22(int x) { return x * 22; }
+inline int f1497_23(int x) { return x * 23; }
+inline int f1497_24(int x) { return x * 24; }
+inline int f1497_25(int x) { return x * 25; }
+inline int f1497_26(int x) { return x * 26; }
+inline int f1497_27(int x) { return x * 27; }
+inline int f1497_28(int x) { return x * 28; }
+inline int f1497_29(int x) { return x * 29; }
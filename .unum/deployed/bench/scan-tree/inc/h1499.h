@@ -0,0 +1,42 @@
+#pragma once
+/* header 1499 */
+#include <vector>
+#include "h5276.h"
+#include "h2675.h"
+#include "h3831.h"
+#include "h3237.h"
+#include "h1680.h"
+#ifdef X
+#include "h9302.h"
+#endif
+struct S1499 { int a; const char *s = "x//y"; };
+inline int f1499_0(int x) { return x * 0; }
+inline int f1499_1(int x) { return x * 1; }
+inline int f1499_2(int x) { return x * 2; }
+inline int f1499_3(int x) { return x * 3; }
+inline int f1499_4(int x) { return x * 4; }
+inline int f1499_5(int x) { return x * 5; }
+inline int f1499_6(int x) { return x * 6; }
+inline int f1499_7(int x) { return x * 7; }
+inline int f1499_8(int x) { return x * 8; }
+inline int f1499_9(int x) { return x * 9; }
+inline int f1499_10(int x) { return x * 10; }
+inline int f1499_11(int x) { return x * 11; }
+inline int f1499_12(int x) { return x * 12; }
+inline int f1499_13(int x) { return x * 13; }
+inline int f1499_14(int x) { return x * 14; }
+inline int f1499_15(int x) { return x * 15; }
+inline int f1499_16(int x) { return x * 16; }
+inline int f1499_17(int x) { return x * 17; }
+inline int f1499_18(int x) { return x * 18; }
+inline int f1499_19(int x) { return x * 19; }
+inline int f1499_20(int x) { return x * 20; }
+inline int f1499_21(int x) { return x * 21; }
+inline int f1499_22(int x) { return x * 22; }
+inline int f1499_23(int x) { return x * 23; }
+inline int f1499_24(int x) { return x * 24; }
+inline int f1499_25(int x) { return x * 25; }
+inline int f1499_26(int x) { return x * 26; }
+inline int f1499_27(int x) { return x * 27; }
+inline int f1499_28(int x) { return x * 28; }
+inline int f1499_29(int x) { return x * 29; }
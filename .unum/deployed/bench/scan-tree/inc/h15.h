@@ -0,0 +1,42 @@
+#pragma once
+/* header 15 */
+#include <vector>
+#include "h4490.h"
+#include "h2358.h"
+#include "h2328.h"
+#include "h4240.h"
+#include "h9096.h"
+#ifdef X
+#include "h2574.h"
+#endif
+struct S15 { int a; const char *s = "x//y"; };
+inline int f15_0(int x) { return x * 0; }
+inline int f15_1(int x) { return x * 1; }
+inline int f15_2(int x) { return x * 2; }
+inline int f15_3(int x) { return x * 3; }
+inline int f15_4(int x) { return x * 4; }
+inline int f15_5(int x) { return x * 5; }
+inline int f15_6(int x) { return x * 6; }
+inline int f15_7(int x) { return x * 7; }
+inline int f15_8(int x) { return x * 8; }
+inline int f15_9(int x) { return x * 9; }
+inline int f15_10(int x) { return x * 10; }
+inline int f15_11(int x) { return x * 11; }
+inline int f15_12(int x) { return x * 12; }
+inline int f15_13(int x) { return x * 13; }
+inline int f15_14(int x) { return x * 14; }
+inline int f15_15(int x) { return x * 15; }
+inline int f15_16(int x) { return x * 16; }
+inline int f15_17(int x) { return x * 17; }
+inline int f15_18(int x) { return x * 18; }
+inline int f15_19(int x) { return x * 19; }
+inline int f15_20(int x) { return x * 20; }
+inline int f15_21(int x) { return x * 21; }
+inline int f15_22(int x) { return x * 22; }
+inline int f15_23(int x) { return x * 23; }
+inline int f15_24(int x) { return x * 24; }
+inline int f15_25(int x) { return x * 25; }
+inline int f15_26(int x) { return x * 26; }
+inline int f15_27(int x) { return x * 27; }
+inline int f15_28(int x) { return x * 28; }
+inline int f15_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 150 */
+#include <vector>
+#include "h4507.h"
+#include "h5123.h"
+#include "h9273.h"
+#include "h5309.h"
+#include "h8784.h"
+#ifdef X
+#include "h7282.h"
+#endif
+struct S150 { int a; const char *s = "x//y"; };
+inline int f150_0(int x) { return x * 0; }
+inline int f150_1(int x) { return x * 1; }
+inline int f150_2(int x) { return x * 2; }
+inline int f150_3(int x) { return x * 3; }
+inline int f150_4(int x) { return x * 4; }
+inline int f150_5(int x) { return x * 5; }
+inline int f150_6(int x) { return x * 6; }
+inline int f150_7(int x) { return x * 7; }
+inline int f150_8(int x) { return x * 8; }
+inline int f150_9(int x) { return x * 9; }
+inline int f150_10(int x) { return x * 10; }
+inline int f150_11(int x) { return x * 11; }
+inline int f150_12(int x) { return x * 12; }
+inline int f150_13(int x) { return x * 13; }
+inline int f150_14(int x) { return x * 14; }
+inline int f150_15(int x) { return x * 15; }
+inline int f150_16(int x) { return x * 16; }
+inline int f150_17(int x) { return x * 17; }
+inline int f150_18(int x) { return x * 18; }
+inline int f150_19(int x) { return x * 19; }
+inline int f150_20(int x) { return x * 20; }
+inline int f150_21(int x) { return x * 21; }
+inline int f150_22(int x) { return x * 22; }
+inline int f150_23(int x) { return x * 23; }
+inline int f150_24(int x) { return x * 24; }
+inline int f150_25(int x) { return x * 25; }
+inline int f150_26(int x) { return x * 26; }
+inline int f150_27(int x) { return x * 27; }
+inline int f150_28(int x) { return x * 28; }
+inline int f150_29(int x) { return x * 29; }
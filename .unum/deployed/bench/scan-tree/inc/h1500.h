@@ -0,0 +1,42 @@
+#pragma once
+/* header 1500 */
+#include <vector>
+#include "h3176.h"
+#include "h7369.h"
+#include "h4847.h"
+#include "h2435.h"
+#include "h3730.h"
+#ifdef X
+#include "h1477.h"
+#endif
+struct S1500 { int a; const char *s = "x//y"; };
+inline int f1500_0(int x) { return x * 0; }
+inline int f1500_1(int x) { return x * 1; }
+inline int f1500_2(int x) { return x * 2; }
+inline int f1500_3(int x) { return x * 3; }
+inline int f1500_4(int x) { return x * 4; }
+inline int f1500_5(int x) { return x * 5; }
+inline int f1500_6(int x) { return x * 6; }
+inline int f1500_7(int x) { return x * 7; }
+inline int f1500_8(int x) { return x * 8; }
+inline int f1500_9(int x) { return x * 9; }
+inline int f1500_10(int x) { return x * 10; }
+inline int f1500_11(int x) { return x * 11; }
+inline int f1500_12(int x) { return x * 12; }
+inline int f1500_13(int x) { return x * 13; }
+inline int f1500_14(int x) { return x * 14; }
+inline int f1500_15(int x) { return x * 15; }
+inline int f1500_16(int x) { return x * 16; }
+inline int f1500_17(int x) { return x * 17; }
+inline int f1500_18(int x) { return x * 18; }
+inline int f1500_19(int x) { return x * 19; }
+inline int f1500_20(int x) { return x * 20; }
+inline int f1500_21(int x) { return x * 21; }
+inline int f1500_22(int x) { return x * 22; }
+inline int f1500_23(int x) { return x * 23; }
+inline int f1500_24(int x) { return x * 24; }
+inline int f1500_25(int x) { return x * 25; }
+inline int f1500_26(int x) { return x * 26; }
+inline int f1500_27(int x) { return x * 27; }
+inline int f1500_28(int x) { return x * 28; }
+inline int f1500_29(int x) { return x * 29; }
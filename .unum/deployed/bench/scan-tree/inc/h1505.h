@@ -0,0 +1,42 @@
+#pragma once
+/* header 1505 */
+#include <vector>
+#include "h4248.h"
+#include "h9292.h"
+#include "h3074.h"
+#include "h2029.h"
+#include "h1305.h"
+#ifdef X
+#include "h5352.h"
+#endif
+struct S1505 { int a; const char *s = "x//y"; };
+inline int f1505_0(int x) { return x * 0; }
+inline int f1505_1(int x) { return x * 1; }
+inline int f1505_2(int x) { return x * 2; }
+inline int f1505_3(int x) { return x * 3; }
+inline int f1505_4(int x) { return x * 4; }
+inline int f1505_5(int x) { return x * 5; }
+inline int f1505_6(int x) { return x * 6; }
+inline int f1505_7(int x) { return x * 7; }
+inline int f1505_8(int x) { return x * 8; }
+inline int f1505_9(int x) { return x * 9; }
+inline int f1505_10(int x) { return x * 10; }
+inline int f1505_11(int x) { return x * 11; }
+inline int f1505_12(int x) { return x * 12; }
+inline int f1505_13(int x) { return x * 13; }
+inline int f1505_14(int x) { return x * 14; }
+inline int f1505_15(int x) { return x * 15; }
+inline int f1505_16(int x) { return x * 16; }
+inline int f1505_17(int x) { return x * 17; }
+inline int f1505_18(int x) { return x * 18; }
+inline int f1505_19(int x) { return x * 19; }
+inline int f1505_20(int x) { return x * 20; }
+inline int f1505_21(int x) { return x * 21; }
+inline int f1505_22(int x) { return x * 22; }
+inline int f1505_23(int x) { return x * 23; }
+inline int f1505_24(int x) { return x * 24; }
+inline int f1505_25(int x) { return x * 25; }
+inline int f1505_26(int x) { return x * 26; }
+inline int f1505_27(int x) { return x * 27; }
+inline int f1505_28(int x) { return x * 28; }
+inline int f1505_29(int x) { return x * 29; }
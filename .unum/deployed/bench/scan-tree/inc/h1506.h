@@ -0,0 +1,42 @@
+#pragma once
+/* header 1506 */
+#include <vector>
+#include "h908.h"
+#include "h3820.h"
+#include "h3019.h"
+#include "h9460.h"
+#include "h1581.h"
+#ifdef X
+#include "h7120.h"
+#endif
+struct S1506 { int a; const char *s = "x//y"; };
+inline int f1506_0(int x) { return x * 0; }
+inline int f1506_1(int x) { return x * 1; }
+inline int f1506_2(int x) { return x * 2; }
+inline int f1506_3(int x) { return x * 3; }
+inline int f1506_4(int x) { return x * 4; }
+inline int f1506_5(int x) { return x * 5; }
+inline int f1506_6(int x) { return x * 6; }
+inline int f1506_7(int x) { return x * 7; }
+inline int f1506_8(int x) { return x * 8; }
+inline int f1506_9(int x) { return x * 9; }
+inline int f1506_10(int x) { return x * 10; }
+inline int f1506_11(int x) { return x * 11; }
+inline int f1506_12(int x) { return x * 12; }
+inline int f1506_13(int x) { return x * 13; }
+inline int f1506_14(int x) { return x * 14; }
+inline int f1506_15(int x) { return x * 15; }
+inline int f1506_16(int x) { return x * 16; }
+inline int f1506_17(int x) { return x * 17; }
+inline int f1506_18(int x) { return x * 18; }
+inline int f1506_19(int x) { return x * 19; }
+inline int f1506_20(int x) { return x * 20; }
+inline int f1506_21(int x) { return x * 21; }
+inline int f1506_22(int x) { return x * 22; }
+inline int f1506_23(int x) { return x * 23; }
+inline int f1506_24(int x) { return x * 24; }
+inline int f1506_25(int x) { return x * 25; }
+inline int f1506_26(int x) { return x * 26; }
+inline int f1506_27(int x) { return x * 27; }
+inline int f1506_28(int x) { return x * 28; }
+inline int f1506_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1508 */
+#include <vector>
+#include "h955.h"
+#include "h9994.h"
+#include "h3051.h"
+#include "h6622.h"
+#include "h258.h"
+#ifdef X
+#include "h9400.h"
+#endif
+struct S1508 { int a; const char *s = "x//y"; };
+inline int f1508_0(int x) { return x * 0; }
+inline int f1508_1(int x) { return x * 1; }
+inline int f1508_2(int x) { return x * 2; }
+inline int f1508_3(int x) { return x * 3; }
+inline int f1508_4(int x) { return x * 4; }
+inline int f1508_5(int x) { return x * 5; }
+inline int f1508_6(int x) { return x * 6; }
+inline int f1508_7(int x) { return x * 7; }
+inline int f1508_8(int x) { return x * 8; }
+inline int f1508_9(int x) { return x * 9; }
+inline int f1508_10(int x) { return x * 10; }
+inline int f1508_11(int x) { return x * 11; }
+inline int f1508_12(int x) { return x * 12; }
+inline int f1508_13(int x) { return x * 13; }
+inline int f1508_14(int x) { return x * 14; }
+inline int f1508_15(int x) { return x * 15; }
+inline int f1508_16(int x) { return x * 16; }
+inline int f1508_17(int x) { return x * 17; }
+inline int f1508_18(int x) { return x * 18; }
+inline int f1508_19(int x) { return x * 19; }
+inline int f1508_20(int x) { return x * 20; }
+inline int f1508_21(int x) { return x * 21; }
+inline int f1508_22(int x) { return x * 22; }
+inline int f1508_23(int x) { return x * 23; }
+inline int f1508_24(int x) { return x * 24; }
+inline int f1508_25(int x) { return x * 25; }
+inline int f1508_26(int x) { return x * 26; }
+inline int f1508_27(int x) { return x * 27; }
+inline int f1508_28(int x) { return x * 28; }
+inline int f1508_29(int x) { return x * 29; }
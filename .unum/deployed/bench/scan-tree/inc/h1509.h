@@ -0,0 +1,42 @@
+#pragma once
+/* header 1509 */
+#include <vector>
+#include "h5814.h"
+#include "h2144.h"
+#include "h6614.h"
+#include "h8672.h"
+#include "h2474.h"
+#ifdef X
+#include "h7020.h"
+#endif
+struct S1509 { int a; const char *s = "x//y"; };
+inline int f1509_0(int x) { return x * 0; }
+inline int f1509_1(int x) { return x * 1; }
+inline int f1509_2(int x) { return x * 2; }
+inline int f1509_3(int x) { return x * 3; }
+inline int f1509_4(int x) { return x * 4; }
+inline int f1509_5(int x) { return x * 5; }
+inline int f1509_6(int x) { return x * 6; }
+inline int f1509_7(int x) { return x * 7; }
+inline int f1509_8(int x) { return x * 8; }
+inline int f1509_9(int x) { return x * 9; }
+inline int f1509_10(int x) { return x * 10; }
+inline int f1509_11(int x) { return x * 11; }
+inline int f1509_12(int x) { return x * 12; }
+inline int f1509_13(int x) { return x * 13; }
+inline int f1509_14(int x) { return x * 14; }
+inline int f1509_15(int x) { return x * 15; }
+inline int f1509_16(int x) { return x * 16; }
+inline int f1509_17(int x) { return x * 17; }
+inline int f1509_18(int x) { return x * 18; }
+inline int f1509_19(int x) { return x * 19; }
+inline int f1509_20(int x) { return x * 20; }
+inline int f1509_21(int x) { return x * 21; }
+inline int f1509_22(int x) { return x * 22; }
+inline int f1509_23(int x) { return x * 23; }
+inline int f1509_24(int x) { return x * 24; }
+inline int f1509_25(int x) { return x * 25; }
+inline int f1509_26(int x) { return x * 26; }
+inline int f1509_27(int x) { return x * 27; }
+inline int f1509_28(int x) { return x * 28; }
+inline int f1509_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1511 */
+#include <vector>
+#include "h8805.h"
+#include "h4096.h"
+#include "h8303.h"
+#include "h6608.h"
+#include "h7538.h"
+#ifdef X
+#include "h2318.h"
+#endif
+struct S1511 { int a; const char *s = "x//y"; };
+inline int f1511_0(int x) { return x * 0; }
+inline int f1511_1(int x) { return x * 1; }
+inline int f1511_2(int x) { return x * 2; }
+inline int f1511_3(int x) { return x * 3; }
+inline int f1511_4(int x) { return x * 4; }
+inline int f1511_5(int x) { return x * 5; }
+inline int f1511_6(int x) { return x * 6; }
+inline int f1511_7(int x) { return x * 7; }
+inline int f1511_8(int x) { return x * 8; }
+inline int f1511_9(int x) { return x * 9; }
+inline int f1511_10(int x) { return x * 10; }
+inline int f1511_11(int x) { return x * 11; }
+inline int f1511_12(int x) { return x * 12; }
+inline int f1511_13(int x) { return x * 13; }
+inline int f1511_14(int x) { return x * 14; }
+inline int f1511_15(int x) { return x * 15; }
+inline int f1511_16(int x) { return x * 16; }
+inline int f1511_17(int x) { return x * 17; }
+inline int f1511_18(int x) { return x * 18; }
+inline int f1511_19(int x) { return x * 19; }
+inline int f1511_20(int x) { return x * 20; }
+inline int f1511_21(int x) { return x * 21; }
+inline int f1511_22(int x) { return x * 22; }
+inline int f1511_23(int x) { return x * 23; }
+inline int f1511_24(int x) { return x * 24; }
+inline int f1511_25(int x) { return x * 25; }
+inline int f1511_26(int x) { return x * 26; }
+inline int f1511_27(int x) { return x * 27; }
+inline int f1511_28(int x) { return x * 28; }
+inline int f1511_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1516 */
+#include <vector>
+#include "h6876.h"
+#include "h1128.h"
+#include "h8726.h"
+#include "h1942.h"
+#include "h8840.h"
+#ifdef X
+#include "h3844.h"
+#endif
+struct S1516 { int a; const char *s = "x//y"; };
+inline int f1516_0(int x) { return x * 0; }
+inline int f1516_1(int x) { return x * 1; }
+inline int f1516_2(int x) { return x * 2; }
+inline int f1516_3(int x) { return x * 3; }
+inline int f1516_4(int x) { return x * 4; }
+inline int f1516_5(int x) { return x * 5; }
+inline int f1516_6(int x) { return x * 6; }
+inline int f1516_7(int x) { return x * 7; }
+inline int f1516_8(int x) { return x * 8; }
+inline int f1516_9(int x) { return x * 9; }
+inline int f1516_10(int x) { return x * 10; }
+inline int f1516_11(int x) { return x * 11; }
+inline int f1516_12(int x) { return x * 12; }
+inline int f1516_13(int x) { return x * 13; }
+inline int f1516_14(int x) { return x * 14; }
+inline int f1516_15(int x) { return x * 15; }
+inline int f1516_16(int x) { return x * 16; }
+inline int f1516_17(int x) { return x * 17; }
+inline int f1516_18(int x) { return x * 18; }
+inline int f1516_19(int x) { return x * 19; }
+inline int f1516_20(int x) { return x * 20; }
+inline int f1516_21(int x) { return x * 21; }
+inline int f1516_22(int x) { return x * 22; }
+inline int f1516_23(int x) { return x * 23; }
+inline int f1516_24(int x) { return x * 24; }
+inline int f1516_25(int x) { return x * 25; }
+inline int f1516_26(int x) { return x * 26; }
+inline int f1516_27(int x) { return x * 27; }
+inline int f1516_28(int x) { return x * 28; }
+inline int f1516_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1517 */
+#include <vector>
+#include "h2917.h"
+#include "h8755.h"
+#include "h8537.h"
+#include "h7677.h"
+#include "h8313.h"
+#ifdef X
+#include "h4677.h"
+#endif
+struct S1517 { int a; const char *s = "x//y"; };
+inline int f1517_0(int x) { return x * 0; }
+inline int f1517_1(int x) { return x * 1; }
+inline int f1517_2(int x) { return x * 2; }
+inline int f1517_3(int x) { return x * 3; }
+inline int f1517_4(int x) { return x * 4; }
+inline int f1517_5(int x) { return x * 5; }
+inline int f1517_6(int x) { return x * 6; }
+inline int f1517_7(int x) { return x * 7; }
+inline int f1517_8(int x) { return x * 8; }
+inline int f1517_9(int x) { return x * 9; }
+inline int f1517_10(int x) { return x * 10; }
+inline int f1517_11(int x) { return x * 11; }
+inline int f1517_12(int x) { return x * 12; }
+inline int f1517_13(int x) { return x * 13; }
+inline int f1517_14(int x) { return x * 14; }
+inline int f1517_15(int x) { return x * 15; }
+inline int f1517_16(int x) { return x * 16; }
+inline int f1517_17(int x) { return x * 17; }
+inline int f1517_18(int x) { return x * 18; }
+inline int f1517_19(int x) { return x * 19; }
+inline int f1517_20(int x) { return x * 20; }
+inline int f1517_21(int x) { return x * 21; }
+inline int f1517_22(int x) { return x * 22; }
+inline int f1517_23(int x) { return x * 23; }
+inline int f1517_24(int x) { return x * 24; }
+inline int f1517_25(int x) { return x * 25; }
+inline int f1517_26(int x) { return x * 26; }
+inline int f1517_27(int x) { return x * 27; }
+inline int f1517_28(int x) { return x * 28; }
+inline int f1517_29(int x) { return x * 29; }
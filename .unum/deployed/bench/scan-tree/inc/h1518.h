@@ -0,0 +1,42 @@
+#pragma once
+/* header 1518 */
+#include <vector>
+#include "h4602.h"
+#include "h2688.h"
+#include "h2887.h"
+#include "h893.h"
+#include "h4816.h"
+#ifdef X
+#include "h2464.h"
+#endif
+struct S1518 { int a; const char *s = "x//y"; };
+inline int f1518_0(int x) { return x * 0; }
+inline int f1518_1(int x) { return x * 1; }
+inline int f1518_2(int x) { return x * 2; }
+inline int f1518_3(int x) { return x * 3; }
+inline int f1518_4(int x) { return x * 4; }
+inline int f1518_5(int x) { return x * 5; }
+inline int f1518_6(int x) { return x * 6; }
+inline int f1518_7(int x) { return x * 7; }
+inline int f1518_8(int x) { return x * 8; }
+inline int f1518_9(int x) { return x * 9; }
+inline int f1518_10(int x) { return x * 10; }
+inline int f1518_11(int x) { return x * 11; }
+inline int f1518_12(int x) { return x * 12; }
+inline int f1518_13(int x) { return x * 13; }
+inline int f1518_14(int x) { return x * 14; }
+inline int f1518_15(int x) { return x * 15; }
+inline int f1518_16(int x) { return x * 16; }
+inline int f1518_17(int x) { return x * 17; }
+inline int f1518_18(int x) { return x * 18; }
+inline int f1518_19(int x) { return x * 19; }
+inline int f1518_20(int x) { return x * 20; }
+inline int f1518_21(int x) { return x * 21; }
+inline int f1518_22(int x) { return x * 22; }
+inline int f1518_23(int x) { return x * 23; }
+inline int f1518_24(int x) { return x * 24; }
+inline int f1518_25(int x) { return x * 25; }
+inline int f1518_26(int x) { return x * 26; }
+inline int f1518_27(int x) { return x * 27; }
+inline int f1518_28(int x) { return x * 28; }
+inline int f1518_29(int x) { return x * 29; }
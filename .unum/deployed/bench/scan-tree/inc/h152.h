@@ -0,0 +1,42 @@
+#pragma once
+/* header 152 */
+#include <vector>
+#include "h9440.h"
+#include "h5783.h"
+#include "h2427.h"
+#include "h9027.h"
+#include "h8017.h"
+#ifdef X
+#include "h6754.h"
+#endif
+struct S152 { int a; const char *s = "x//y"; };
+inline int f152_0(int x) { return x * 0; }
+inline int f152_1(int x) { return x * 1; }
+inline int f152_2(int x) { return x * 2; }
+inline int f152_3(int x) { return x * 3; }
+inline int f152_4(int x) { return x * 4; }
+inline int f152_5(int x) { return x * 5; }
+inline int f152_6(int x) { return x * 6; }
+inline int f152_7(int x) { return x * 7; }
+inline int f152_8(int x) { return x * 8; }
+inline int f152_9(int x) { return x * 9; }
+inline int f152_10(int x) { return x * 10; }
+inline int f152_11(int x) { return x * 11; }
+inline int f152_12(int x) { return x * 12; }
+inline int f152_13(int x) { return x * 13; }
+inline int f152_14(int x) { return x * 14; }
+inline int f152_15(int x) { return x * 15; }
+inline int f152_16(int x) { return x * 16; }
+inline int f152_17(int x) { return x * 17; }
+inline int f152_18(int x) { return x * 18; }
+inline int f152_19(int x) { return x * 19; }
+inline int f152_20(int x) { return x * 20; }
+inline int f152_21(int x) { return x * 21; }
+inline int f152_22(int x) { return x * 22; }
+inline int f152_23(int x) { return x * 23; }
+inline int f152_24(int x) { return x * 24; }
+inline int f152_25(int x) { return x * 25; }
+inline int f152_26(int x) { return x * 26; }
+inline int f152_27(int x) { return x * 27; }
+inline int f152_28(int x) { return x * 28; }
+inline int f152_29(int x) { return x * 29; }
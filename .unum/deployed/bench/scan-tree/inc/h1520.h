@@ -0,0 +1,42 @@
+#pragma once
+/* header 1520 */
+#include <vector>
+#include "h9687.h"
+#include "h2119.h"
+#include "h2523.h"
+#include "h194.h"
+#include "h5314.h"
+#ifdef X
+#include "h7861.h"
+#endif
+struct S1520 { int a; const char *s = "x//y"; };
+inline int f1520_0(int x) { return x * 0; }
+inline int f1520_1(int x) { return x * 1; }
+inline int f1520_2(int x) { return x * 2; }
+inline int f1520_3(int x) { return x * 3; }
+inline int f1520_4(int x) { return x * 4; }
+inline int f1520_5(int x) { return x * 5; }
+inline int f1520_6(int x) { return x * 6; }
+inline int f1520_7(int x) { return x * 7; }
+inline int f1520_8(int x) { return x * 8; }
+inline int f1520_9(int x) { return x * 9; }
+inline int f1520_10(int x) { return x * 10; }
+inline int f1520_11(int x) { return x * 11; }
+inline int f1520_12(int x) { return x * 12; }
+inline int f1520_13(int x) { return x * 13; }
+inline int f1520_14(int x) { return x * 14; }
+inline int f1520_15(int x) { return x * 15; }
+inline int f1520_16(int x) { return x * 16; }
+inline int f1520_17(int x) { return x * 17; }
+inline int f1520_18(int x) { return x * 18; }
+inline int f1520_19(int x) { return x * 19; }
+inline int f1520_20(int x) { return x * 20; }
+inline int f1520_21(int x) { return x * 21; }
+inline int f1520_22(int x) { return x * 22; }
+inline int f1520_23(int x) { return x * 23; }
+inline int f1520_24(int x) { return x * 24; }
+inline int f1520_25(int x) { return x * 25; }
+inline int f1520_26(int x) { return x * 26; }
+inline int f1520_27(int x) { return x * 27; }
+inline int f1520_28(int x) { return x * 28; }
+inline int f1520_29(int x) { return x * 29; }
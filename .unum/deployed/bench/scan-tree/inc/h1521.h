@@ -0,0 +1,42 @@
+#pragma once
+/* header 1521 */
+#include <vector>
+#include "h1406.h"
+#include "h2888.h"
+#include "h8754.h"
+#include "h6121.h"
+#include "h2873.h"
+#ifdef X
+#include "h7278.h"
+#endif
+struct S1521 { int a; const char *s = "x//y"; };
+inline int f1521_0(int x) { return x * 0; }
+inline int f1521_1(int x) { return x * 1; }
+inline int f1521_2(int x) { return x * 2; }
+inline int f1521_3(int x) { return x * 3; }
+inline int f1521_4(int x) { return x * 4; }
+inline int f1521_5(int x) { return x * 5; }
+inline int f1521_6(int x) { return x * 6; }
+inline int f1521_7(int x) { return x * 7; }
+inline int f1521_8(int x) { return x * 8; }
+inline int f1521_9(int x) { return x * 9; }
+inline int f1521_10(int x) { return x * 10; }
+inline int f1521_11(int x) { return x * 11; }
+inline int f1521_12(int x) { return x * 12; }
+inline int f1521_13(int x) { return x * 13; }
+inline int f1521_14(int x) { return x * 14; }
+inline int f1521_15(int x) { return x * 15; }
+inline int f1521_16(int x) { return x * 16; }
+inline int f1521_17(int x) { return x * 17; }
+inline int f1521_18(int x) { return x * 18; }
+inline int f1521_19(int x) { return x * 19; }
+inline int f1521_20(int x) { return x * 20; }
+inline int f1521_21(int x) { return x * 21; }
+inline int f1521_22(int x) { return x * 22; }
+inline int f1521_23(int x) { return x * 23; }
+inline int f1521_24(int x) { return x * 24; }
+inline int f1521_25(int x) { return x * 25; }
+inline int f1521_26(int x) { return x * 26; }
+inline int f1521_27(int x) { return x * 27; }
+inline int f1521_28(int x) { return x * 28; }
+inline int f1521_29(int x) { return x * 29; }
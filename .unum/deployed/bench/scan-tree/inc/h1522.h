@@ -0,0 +1,42 @@
+#pragma once
+/* header 1522 */
+#include <vector>
+#include "h3402.h"
+#include "h7446.h"
+#include "h2507.h"
+#include "h9393.h"
+#include "h8777.h"
+#ifdef X
+#include "h9007.h"
+#endif
+struct S1522 { int a; const char *s = "x//y"; };
+inline int f1522_0(int x) { return x * 0; }
+inline int f1522_1(int x) { return x * 1; }
+inline int f1522_2(int x) { return x * 2; }
+inline int f1522_3(int x) { return x * 3; }
+inline int f1522_4(int x) { return x * 4; }
+inline int f1522_5(int x) { return x * 5; }
+inline int f1522_6(int x) { return x * 6; }
+inline int f1522_7(int x) { return x * 7; }
+inline int f1522_8(int x) { return x * 8; }
+inline int f1522_9(int x) { return x * 9; }
+inline int f1522_10(int x) { return x * 10; }
+inline int f1522_11(int x) { return x * 11; }
+inline int f1522_12(int x) { return x * 12; }
+inline int f1522_13(int x) { return x * 13; }
+inline int f1522_14(int x) { return x * 14; }
+inline int f1522_15(int x) { return x * 15; }
+inline int f1522_16(int x) { return x * 16; }
+inline int f1522_17(int x) { return x * 17; }
+inline int f1522_18(int x) { return x * 18; }
+inline int f1522_19(int x) { return x * 19; }
+inline int f1522_20(int x) { return x * 20; }
+inline int f1522_21(int x) { return x * 21; }
+inline int f1522_22(int x) { return x * 22; }
+inline int f1522_23(int x) { return x * 23; }
+inline int f1522_24(int x) { return x * 24; }
+inline int f1522_25(int x) { return x * 25; }
+inline int f1522_26(int x) { return x * 26; }
+inline int f1522_27(int x) { return x * 27; }
+inline int f1522_28(int x) { return x * 28; }
+inline int f1522_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1523 */
+#include <vector>
+#include "h6585.h"
+#include "h1671.h"
+#include "h8167.h"
+#include "h3371.h"
+#include "h440.h"
+#ifdef X
+#include "h1379.h"
+#endif
+struct S1523 { int a; const char *s = "x//y"; };
+inline int f1523_0(int x) { return x * 0; }
+inline int f1523_1(int x) { return x * 1; }
+inline int f1523_2(int x) { return x * 2; }
+inline int f1523_3(int x) { return x * 3; }
+inline int f1523_4(int x) { return x * 4; }
+inline int f1523_5(int x) { return x * 5; }
+inline int f1523_6(int x) { return x * 6; }
+inline int f1523_7(int x) { return x * 7; }
+inline int f1523_8(int x) { return x * 8; }
+inline int f1523_9(int x) { return x * 9; }
+inline int f1523_10(int x) { return x * 10; }
+inline int f1523_11(int x) { return x * 11; }
+inline int f1523_12(int x) { return x * 12; }
+inline int f1523_13(int x) { return x * 13; }
+inline int f1523_14(int x) { return x * 14; }
+inline int f1523_15(int x) { return x * 15; }
+inline int f1523_16(int x) { return x * 16; }
+inline int f1523_17(int x) { return x * 17; }
+inline int f1523_18(int x) { return x * 18; }
+inline int f1523_19(int x) { return x * 19; }
+inline int f1523_20(int x) { return x * 20; }
+inline int f1523_21(int x) { return x * 21; }
+inline int f1523_22(int x) { return x * 22; }
+inline int f1523_23(int x) { return x * 23; }
+inline int f1523_24(int x) { return x * 24; }
+inline int f1523_25(int x) { return x * 25; }
+inline int f1523_26(int x) { return x * 26; }
+inline int f1523_27(int x) { return x * 27; }
+inline int f1523_28(int x) { return x * 28; }
+inline int f1523_29(int x) { return x * 29; }
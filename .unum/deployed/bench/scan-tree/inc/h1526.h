@@ -0,0 +1,42 @@
+#pragma once
+/* header 1526 */
+#include <vector>
+#include "h3032.h"
+#include "h6038.h"
+#include "h1370.h"
+#include "h3833.h"
+#include "h4559.h"
+#ifdef X
+#include "h3893.h"
+#endif
+struct S1526 { int a; const char *s = "x//y"; };
+inline int f1526_0(int x) { return x * 0; }
+inline int f1526_1(int x) { return x * 1; }
+inline int f1526_2(int x) { return x * 2; }
+inline int f1526_3(int x) { return x * 3; }
+inline int f1526_4(int x) { return x * 4; }
+inline int f1526_5(int x) { return x * 5; }
+inline int f1526_6(int x) { return x * 6; }
+inline int f1526_7(int x) { return x * 7; }
+inline int f1526_8(int x) { return x * 8; }
+inline int f1526_9(int x) { return x * 9; }
+inline int f1526_10(int x) { return x * 10; }
+inline int f1526_11(int x) { return x * 11; }
+inline int f1526_12(int x) { return x * 12; }
+inline int f1526_13(int x) { return x * 13; }
+inline int f1526_14(int x) { return x * 14; }
+inline int f1526_15(int x) { return x * 15; }
+inline int f1526_16(int x) { return x * 16; }
+inline int f1526_17(int x) { return x * 17; }
+inline int f1526_18(int x) { return x * 18; }
+inline int f1526_19(int x) { return x * 19; }
+inline int f1526_20(int x) { return x * 20; }
+inline int f1526_21(int x) { return x * 21; }
+inline int f1526_22(int x) { return x * 22; }
+inline int f1526_23(int x) { return x * 23; }
+inline int f1526_24(int x) { return x * 24; }
+inline int f1526_25(int x) { return x * 25; }
+inline int f1526_26(int x) { return x * 26; }
+inline int f1526_27(int x) { return x * 27; }
+inline int f1526_28(int x) { return x * 28; }
+inline int f1526_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1529 */
+#include <vector>
+#include "h823.h"
+#include "h3373.h"
+#include "h650.h"
+#include "h5601.h"
+#include "h4888.h"
+#ifdef X
+#include "h571.h"
+#endif
+struct S1529 { int a; const char *s = "x//y"; };
+inline int f1529_0(int x) { return x * 0; }
+inline int f1529_1(int x) { return x * 1; }
+inline int f1529_2(int x) { return x * 2; }
+inline int f1529_3(int x) { return x * 3; }
+inline int f1529_4(int x) { return x * 4; }
+inline int f1529_5(int x) { return x * 5; }
+inline int f1529_6(int x) { return x * 6; }
+inline int f1529_7(int x) { return x * 7; }
+inline int f1529_8(int x) { return x * 8; }
+inline int f1529_9(int x) { return x * 9; }
+inline int f1529_10(int x) { return x * 10; }
+inline int f1529_11(int x) { return x * 11; }
+inline int f1529_12(int x) { return x * 12; }
+inline int f1529_13(int x) { return x * 13; }
+inline int f1529_14(int x) { return x * 14; }
+inline int f1529_15(int x) { return x * 15; }
+inline int f1529_16(int x) { return x * 16; }
+inline int f1529_17(int x) { return x * 17; }
+inline int f1529_18(int x) { return x * 18; }
+inline int f1529_19(int x) { return x * 19; }
+inline int f1529_20(int x) { return x * 20; }
+inline int f1529_21(int x) { return x * 21; }
+inline int f1529_22(int x) { return x * 22; }
+inline int f1529_23(int x) { return x * 23; }
+inline int f1529_24(int x) { return x * 24; }
+inline int f1529_25(int x) { return x * 25; }
+inline int f1529_26(int x) { return x * 26; }
+inline int f1529_27(int x) { return x * 27; }
+inline int f1529_28(int x) { return x * 28; }
+inline int f1529_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 153 */
+#include <vector>
+#include "h2138.h"
+#include "h4148.h"
+#include "h5122.h"
+#include "h7288.h"
+#include "h4310.h"
+#ifdef X
+#include "h7735.h"
+#endif
+struct S153 { int a; const char *s = "x//y"; };
+inline int f153_0(int x) { return x * 0; }
+inline int f153_1(int x) { return x * 1; }
+inline int f153_2(int x) { return x * 2; }
+inline int f153_3(int x) { return x * 3; }
+inline int f153_4(int x) { return x * 4; }
+inline int f153_5(int x) { return x * 5; }
+inline int f153_6(int x) { return x * 6; }
+inline int f153_7(int x) { return x * 7; }
+inline int f153_8(int x) { return x * 8; }
+inline int f153_9(int x) { return x * 9; }
+inline int f153_10(int x) { return x * 10; }
+inline int f153_11(int x) { return x * 11; }
+inline int f153_12(int x) { return x * 12; }
+inline int f153_13(int x) { return x * 13; }
+inline int f153_14(int x) { return x * 14; }
+inline int f153_15(int x) { return x * 15; }
+inline int f153_16(int x) { return x * 16; }
+inline int f153_17(int x) { return x * 17; }
+inline int f153_18(int x) { return x * 18; }
+inline int f153_19(int x) { return x * 19; }
+inline int f153_20(int x) { return x * 20; }
+inline int f153_21(int x) { return x * 21; }
+inline int f153_22(int x) { return x * 22; }
+inline int f153_23(int x) { return x * 23; }
+inline int f153_24(int x) { return x * 24; }
+inline int f153_25(int x) { return x * 25; }
+inline int f153_26(int x) { return x * 26; }
+inline int f153_27(int x) { return x * 27; }
+inline int f153_28(int x) { return x * 28; }
+inline int f153_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1530 */
+#include <vector>
+#include "h440.h"
+#include "h2168.h"
+#include "h7045.h"
+#include "h4970.h"
+#include "h5481.h"
+#ifdef X
+#include "h4438.h"
+#endif
+struct S1530 { int a; const char *s = "x//y"; };
+inline int f1530_0(int x) { return x * 0; }
+inline int f1530_1(int x) { return x * 1; }
+inline int f1530_2(int x) { return x * 2; }
+inline int f1530_3(int x) { return x * 3; }
+inline int f1530_4(int x) { return x * 4; }
+inline int f1530_5(int x) { return x * 5; }
+inline int f1530_6(int x) { return x * 6; }
+inline int f1530_7(int x) { return x * 7; }
+inline int f1530_8(int x) { return x * 8; }
+inline int f1530_9(int x) { return x * 9; }
+inline int f1530_10(int x) { return x * 10; }
+inline int f1530_11(int x) { return x * 11; }
+inline int f1530_12(int x) { return x * 12; }
+inline int f1530_13(int x) { return x * 13; }
+inline int f1530_14(int x) { return x * 14; }
+inline int f1530_15(int x) { return x * 15; }
+inline int f1530_16(int x) { return x * 16; }
+inline int f1530_17(int x) { return x * 17; }
+inline int f1530_18(int x) { return x * 18; }
+inline int f1530_19(int x) { return x * 19; }
+inline int f1530_20(int x) { return x * 20; }
+inline int f1530_21(int x) { return x * 21; }
+inline int f1530_22(int x) { return x * 22; }
+inline int f1530_23(int x) { return x * 23; }
+inline int f1530_24(int x) { return x * 24; }
+inline int f1530_25(int x) { return x * 25; }
+inline int f1530_26(int x) { return x * 26; }
+inline int f1530_27(int x) { return x * 27; }
+inline int f1530_28(int x) { return x * 28; }
+inline int f1530_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1532 */
+#include <vector>
+#include "h2876.h"
+#include "h9309.h"
+#include "h775.h"
+#include "h994.h"
+#include "h7776.h"
+#ifdef X
+#include "h2325.h"
+#endif
+struct S1532 { int a; const char *s = "x//y"; };
+inline int f1532_0(int x) { return x * 0; }
+inline int f1532_1(int x) { return x * 1; }
+inline int f1532_2(int x) { return x * 2; }
+inline int f1532_3(int x) { return x * 3; }
+inline int f1532_4(int x) { return x * 4; }
+inline int f1532_5(int x) { return x * 5; }
+inline int f1532_6(int x) { return x * 6; }
+inline int f1532_7(int x) { return x * 7; }
+inline int f1532_8(int x) { return x * 8; }
+inline int f1532_9(int x) { return x * 9; }
+inline int f1532_10(int x) { return x * 10; }
+inline int f1532_11(int x) { return x * 11; }
+inline int f1532_12(int x) { return x * 12; }
+inline int f1532_13(int x) { return x * 13; }
+inline int f1532_14(int x) { return x * 14; }
+inline int f1532_15(int x) { return x * 15; }
+inline int f1532_16(int x) { return x * 16; }
+inline int f1532_17(int x) { return x * 17; }
+inline int f1532_18(int x) { return x * 18; }
+inline int f1532_19(int x) { return x * 19; }
+inline int f1532_20(int x) { return x * 20; }
+inline int f1532_21(int x) { return x * 21; }
+inline int f1532_22(int x) { return x * 22; }
+inline int f1532_23(int x) { return x * 23; }
+inline int f1532_24(int x) { return x * 24; }
+inline int f1532_25(int x) { return x * 25; }
+inline int f1532_26(int x) { return x * 26; }
+inline int f1532_27(int x) { return x * 27; }
+inline int f1532_28(int x) { return x * 28; }
+inline int f1532_29(int x) { return x * 29; }
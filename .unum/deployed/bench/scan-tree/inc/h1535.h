@@ -0,0 +1,42 @@
+#pragma once
+/* header 1535 */
+#include <vector>
+#include "h838.h"
+#include "h7153.h"
+#include "h3784.h"
+#include "h935.h"
+#include "h8059.h"
+#ifdef X
+#include "h4980.h"
+#endif
+struct S1535 { int a; const char *s = "x//y"; };
+inline int f1535_0(int x) { return x * 0; }
+inline int f1535_1(int x) { return x * 1; }
+inline int f1535_2(int x) { return x * 2; }
+inline int f1535_3(int x) { return x * 3; }
+inline int f1535_4(int x) { return x * 4; }
+inline int f1535_5(int x) { return x * 5; }
+inline int f1535_6(int x) { return x * 6; }
+inline int f1535_7(int x) { return x * 7; }
+inline int f1535_8(int x) { return x * 8; }
+inline int f1535_9(int x) { return x * 9; }
+inline int f1535_10(int x) { return x * 10; }
+inline int f1535_11(int x) { return x * 11; }
+inline int f1535_12(int x) { return x * 12; }
+inline int f1535_13(int x) { return x * 13; }
+inline int f1535_14(int x) { return x * 14; }
+inline int f1535_15(int x) { return x * 15; }
+inline int f1535_16(int x) { return x * 16; }
+inline int f1535_17(int x) { return x * 17; }
+inline int f1535_18(int x) { return x * 18; }
+inline int f1535_19(int x) { return x * 19; }
+inline int f1535_20(int x) { return x * 20; }
+inline int f1535_21(int x) { return x * 21; }
+inline int f1535_22(int x) { return x * 22; }
+inline int f1535_23(int x) { return x * 23; }
+inline int f1535_24(int x) { return x * 24; }
+inline int f1535_25(int x) { return x * 25; }
+inline int f1535_26(int x) { return x * 26; }
+inline int f1535_27(int x) { return x * 27; }
+inline int f1535_28(int x) { return x * 28; }
+inline int f1535_29(int x) { return x * 29; }
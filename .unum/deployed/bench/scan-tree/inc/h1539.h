@@ -0,0 +1,42 @@
+#pragma once
+/* header 1539 */
+#include <vector>
+#include "h8891.h"
+#include "h1516.h"
+#include "h2065.h"
+#include "h4074.h"
+#include "h6347.h"
+#ifdef X
+#include "h7417.h"
+#endif
+struct S1539 { int a; const char *s = "x//y"; };
+inline int f1539_0(int x) { return x * 0; }
+inline int f1539_1(int x) { return x * 1; }
+inline int f1539_2(int x) { return x * 2; }
+inline int f1539_3(int x) { return x * 3; }
+inline int f1539_4(int x) { return x * 4; }
+inline int f1539_5(int x) { return x * 5; }
+inline int f1539_6(int x) { return x * 6; }
+inline int f1539_7(int x) { return x * 7; }
+inline int f1539_8(int x) { return x * 8; }
+inline int f1539_9(int x) { return x * 9; }
+inline int f1539_10(int x) { return x * 10; }
+inline int f1539_11(int x) { return x * 11; }
+inline int f1539_12(int x) { return x * 12; }
+inline int f1539_13(int x) { return x * 13; }
+inline int f1539_14(int x) { return x * 14; }
+inline int f1539_15(int x) { return x * 15; }
+inline int f1539_16(int x) { return x * 16; }
+inline int f1539_17(int x) { return x * 17; }
+inline int f1539_18(int x) { return x * 18; }
+inline int f1539_19(int x) { return x * 19; }
+inline int f1539_20(int x) { return x * 20; }
+inline int f1539_21(int x) { return x * 21; }
+inline int f1539_22(int x) { return x * 22; }
+inline int f1539_23(int x) { return x * 23; }
+inline int f1539_24(int x) { return x * 24; }
+inline int f1539_25(int x) { return x * 25; }
+inline int f1539_26(int x) { return x * 26; }
+inline int f1539_27(int x) { return x * 27; }
+inline int f1539_28(int x) { return x * 28; }
+inline int f1539_29(int x) { return x * 29; }
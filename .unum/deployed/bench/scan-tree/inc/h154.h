@@ -0,0 +1,42 @@
+#pragma once
+/* header 154 */
+#include <vector>
+#include "h3106.h"
+#include "h3503.h"
+#include "h5307.h"
+#include "h3022.h"
+#include "h7805.h"
+#ifdef X
+#include "h7897.h"
+#endif
+struct S154 { int a; const char *s = "x//y"; };
+inline int f154_0(int x) { return x * 0; }
+inline int f154_1(int x) { return x * 1; }
+inline int f154_2(int x) { return x * 2; }
+inline int f154_3(int x) { return x * 3; }
+inline int f154_4(int x) { return x * 4; }
+inline int f154_5(int x) { return x * 5; }
+inline int f154_6(int x) { return x * 6; }
+inline int f154_7(int x) { return x * 7; }
+inline int f154_8(int x) { return x * 8; }
+inline int f154_9(int x) { return x * 9; }
+inline int f154_10(int x) { return x * 10; }
+inline int f154_11(int x) { return x * 11; }
+inline int f154_12(int x) { return x * 12; }
+inline int f154_13(int x) { return x * 13; }
+inline int f154_14(int x) { return x * 14; }
+inline int f154_15(int x) { return x * 15; }
+inline int f154_16(int x) { return x * 16; }
+inline int f154_17(int x) { return x * 17; }
+inline int f154_18(int x) { return x * 18; }
+inline int f154_19(int x) { return x * 19; }
+inline int f154_20(int x) { return x * 20; }
+inline int f154_21(int x) { return x * 21; }
+inline int f154_22(int x) { return x * 22; }
+inline int f154_23(int x) { return x * 23; }
+inline int f154_24(int x) { return x * 24; }
+inline int f154_25(int x) { return x * 25; }
+inline int f154_26(int x) { return x * 26; }
+inline int f154_27(int x) { return x * 27; }
+inline int f154_28(int x) { return x * 28; }
+inline int f154_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1541 */
+#include <vector>
+#include "h5647.h"
+#include "h7956.h"
+#include "h4342.h"
+#include "h657.h"
+#include "h2399.h"
+#ifdef X
+#include "h1525.h"
+#endif
+struct S1541 { int a; const char *s = "x//y"; };
+inline int f1541_0(int x) { return x * 0; }
+inline int f1541_1(int x) { return x * 1; }
+inline int f1541_2(int x) { return x * 2; }
+inline int f1541_3(int x) { return x * 3; }
+inline int f1541_4(int x) { return x * 4; }
+inline int f1541_5(int x) { return x * 5; }
+inline int f1541_6(int x) { return x * 6; }
+inline int f1541_7(int x) { return x * 7; }
+inline int f1541_8(int x) { return x * 8; }
+inline int f1541_9(int x) { return x * 9; }
+inline int f1541_10(int x) { return x * 10; }
+inline int f1541_11(int x) { return x * 11; }
+inline int f1541_12(int x) { return x * 12; }
+inline int f1541_13(int x) { return x * 13; }
+inline int f1541_14(int x) { return x * 14; }
+inline int f1541_15(int x) { return x * 15; }
+inline int f1541_16(int x) { return x * 16; }
+inline int f1541_17(int x) { return x * 17; }
+inline int f1541_18(int x) { return x * 18; }
+inline int f1541_19(int x) { return x * 19; }
+inline int f1541_20(int x) { return x * 20; }
+inline int f1541_21(int x) { return x * 21; }
+inline int f1541_22(int x) { return x * 22; }
+inline int f1541_23(int x) { return x * 23; }
+inline int f1541_24(int x) { return x * 24; }
+inline int f1541_25(int x) { return x * 25; }
+inline int f1541_26(int x) { return x * 26; }
+inline int f1541_27(int x) { return x * 27; }
+inline int f1541_28(int x) { return x * 28; }
+inline int f1541_29(int x) { return x * 29; }
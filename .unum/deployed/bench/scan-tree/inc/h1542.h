@@ -0,0 +1,42 @@
+#pragma once
+/* header 1542 */
+#include <vector>
+#include "h519.h"
+#include "h6328.h"
+#include "h7429.h"
+#include "h6510.h"
+#include "h2671.h"
+#ifdef X
+#include "h5832.h"
+#endif
+struct S1542 { int a; const char *s = "x//y"; };
+inline int f1542_0(int x) { return x * 0; }
+inline int f1542_1(int x) { return x * 1; }
+inline int f1542_2(int x) { return x * 2; }
+inline int f1542_3(int x) { return x * 3; }
+inline int f1542_4(int x) { return x * 4; }
+inline int f1542_5(int x) { return x * 5; }
+inline int f1542_6(int x) { return x * 6; }
+inline int f1542_7(int x) { return x * 7; }
+inline int f1542_8(int x) { return x * 8; }
+inline int f1542_9(int x) { return x * 9; }
+inline int f1542_10(int x) { return x * 10; }
+inline int f1542_11(int x) { return x * 11; }
+inline int f1542_12(int x) { return x * 12; }
+inline int f1542_13(int x) { return x * 13; }
+inline int f1542_14(int x) { return x * 14; }
+inline int f1542_15(int x) { return x * 15; }
+inline int f1542_16(int x) { return x * 16; }
+inline int f1542_17(int x) { return x * 17; }
+inline int f1542_18(int x) { return x * 18; }
+inline int f1542_19(int x) { return x * 19; }
+inline int f1542_20(int x) { return x * 20; }
+inline int f1542_21(int x) { return x * 21; }
+inline int f1542_22(int x) { return x * 22; }
+inline int f1542_23(int x) { return x * 23; }
+inline int f1542_24(int x) { return x * 24; }
+inline int f1542_25(int x) { return x * 25; }
+inline int f1542_26(int x) { return x * 26; }
+inline int f1542_27(int x) { return x * 27; }
+inline int f1542_28(int x) { return x * 28; }
+inline int f1542_29(int x) { return x * 29; }
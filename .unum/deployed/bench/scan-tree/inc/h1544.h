@@ -0,0 +1,42 @@
+#pragma once
+/* header 1544 */
+#include <vector>
+#include "h9663.h"
+#include "h962.h"
+#include "h8708.h"
+#include "h9184.h"
+#include "h815.h"
+#ifdef X
+#include "h4346.h"
+#endif
+struct S1544 { int a; const char *s = "x//y"; };
+inline int f1544_0(int x) { return x * 0; }
+inline int f1544_1(int x) { return x * 1; }
+inline int f1544_2(int x) { return x * 2; }
+inline int f1544_3(int x) { return x * 3; }
+inline int f1544_4(int x) { return x * 4; }
+inline int f1544_5(int x) { return x * 5; }
+inline int f1544_6(int x) { return x * 6; }
+inline int f1544_7(int x) { return x * 7; }
+inline int f1544_8(int x) { return x * 8; }
+inline int f1544_9(int x) { return x * 9; }
+inline int f1544_10(int x) { return x * 10; }
+inline int f1544_11(int x) { return x * 11; }
+inline int f1544_12(int x) { return x * 12; }
+inline int f1544_13(int x) { return x * 13; }
+inline int f1544_14(int x) { return x * 14; }
+inline int f1544_15(int x) { return x * 15; }
+inline int f1544_16(int x) { return x * 16; }
+inline int f1544_17(int x) { return x * 17; }
+inline int f1544_18(int x) { return x * 18; }
+inline int f1544_19(int x) { return x * 19; }
+inline int f1544_20(int x) { return x * 20; }
+inline int f1544_21(int x) { return x * 21; }
+inline int f1544_22(int x) { return x * 22; }
+inline int f1544_23(int x) { return x * 23; }
+inline int f1544_24(int x) { return x * 24; }
+inline int f1544_25(int x) { return x * 25; }
+inline int f1544_26(int x) { return x * 26; }
+inline int f1544_27(int x) { return x * 27; }
+inline int f1544_28(int x) { return x * 28; }
+inline int f1544_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1546 */
+#include <vector>
+#include "h2405.h"
+#include "h2537.h"
+#include "h1822.h"
+#include "h695.h"
+#include "h9630.h"
+#ifdef X
+#include "h5377.h"
+#endif
+struct S1546 { int a; const char *s = "x//y"; };
+inline int f1546_0(int x) { return x * 0; }
+inline int f1546_1(int x) { return x * 1; }
+inline int f1546_2(int x) { return x * 2; }
+inline int f1546_3(int x) { return x * 3; }
+inline int f1546_4(int x) { return x * 4; }
+inline int f1546_5(int x) { return x * 5; }
+inline int f1546_6(int x) { return x * 6; }
+inline int f1546_7(int x) { return x * 7; }
+inline int f1546_8(int x) { return x * 8; }
+inline int f1546_9(int x) { return x * 9; }
+inline int f1546_10(int x) { return x * 10; }
+inline int f1546_11(int x) { return x * 11; }
+inline int f1546_12(int x) { return x * 12; }
+inline int f1546_13(int x) { return x * 13; }
+inline int f1546_14(int x) { return x * 14; }
+inline int f1546_15(int x) { return x * 15; }
+inline int f1546_16(int x) { return x * 16; }
+inline int f1546_17(int x) { return x * 17; }
+inline int f1546_18(int x) { return x * 18; }
+inline int f1546_19(int x) { return x * 19; }
+inline int f1546_20(int x) { return x * 20; }
+inline int f1546_21(int x) { return x * 21; }
+inline int f1546_22(int x) { return x * 22; }
+inline int f1546_23(int x) { return x * 23; }
+inline int f1546_24(int x) { return x * 24; }
+inline int f1546_25(int x) { return x * 25; }
+inline int f1546_26(int x) { return x * 26; }
+inline int f1546_27(int x) { return x * 27; }
+inline int f1546_28(int x) { return x * 28; }
+inline int f1546_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1549 */
+#include <vector>
+#include "h5706.h"
+#include "h7210.h"
+#include "h7154.h"
+#include "h8585.h"
+#include "h878.h"
+#ifdef X
+#include "h6708.h"
+#endif
+struct S1549 { int a; const char *s = "x//y"; };
+inline int f1549_0(int x) { return x * 0; }
+inline int f1549_1(int x) { return x * 1; }
+inline int f1549_2(int x) { return x * 2; }
+inline int f1549_3(int x) { return x * 3; }
+inline int f1549_4(int x) { return x * 4; }
+inline int f1549_5(int x) { return x * 5; }
+inline int f1549_6(int x) { return x * 6; }
+inline int f1549_7(int x) { return x * 7; }
+inline int f1549_8(int x) { return x * 8; }
+inline int f1549_9(int x) { return x * 9; }
+inline int f1549_10(int x) { return x * 10; }
+inline int f1549_11(int x) { return x * 11; }
+inline int f1549_12(int x) { return x * 12; }
+inline int f1549_13(int x) { return x * 13; }
+inline int f1549_14(int x) { return x * 14; }
+inline int f1549_15(int x) { return x * 15; }
+inline int f1549_16(int x) { return x * 16; }
+inline int f1549_17(int x) { return x * 17; }
+inline int f1549_18(int x) { return x * 18; }
+inline int f1549_19(int x) { return x * 19; }
+inline int f1549_20(int x) { return x * 20; }
+inline int f1549_21(int x) { return x * 21; }
+inline int f1549_22(int x) { return x * 22; }
+inline int f1549_23(int x) { return x * 23; }
+inline int f1549_24(int x) { return x * 24; }
+inline int f1549_25(int x) { return x * 25; }
+inline int f1549_26(int x) { return x * 26; }
+inline int f1549_27(int x) { return x * 27; }
+inline int f1549_28(int x) { return x * 28; }
+inline int f1549_29(int x) { return x * 29; }
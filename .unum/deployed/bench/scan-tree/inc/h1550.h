@@ -0,0 +1,42 @@
+#pragma once
+/* header 1550 */
+#include <vector>
+#include "h1248.h"
+#include "h7608.h"
+#include "h1214.h"
+#include "h4349.h"
+#include "h5350.h"
+#ifdef X
+#include "h7196.h"
+#endif
+struct S1550 { int a; const char *s = "x//y"; };
+inline int f1550_0(int x) { return x * 0; }
+inline int f1550_1(int x) { return x * 1; }
+inline int f1550_2(int x) { return x * 2; }
+inline int f1550_3(int x) { return x * 3; }
+inline int f1550_4(int x) { return x * 4; }
+inline int f1550_5(int x) { return x * 5; }
+inline int f1550_6(int x) { return x * 6; }
+inline int f1550_7(int x) { return x * 7; }
+inline int f1550_8(int x) { return x * 8; }
+inline int f1550_9(int x) { return x * 9; }
+inline int f1550_10(int x) { return x * 10; }
+inline int f1550_11(int x) { return x * 11; }
+inline int f1550_12(int x) { return x * 12; }
+inline int f1550_13(int x) { return x * 13; }
+inline int f1550_14(int x) { return x * 14; }
+inline int f1550_15(int x) { return x * 15; }
+inline int f1550_16(int x) { return x * 16; }
+inline int f1550_17(int x) { return x * 17; }
+inline int f1550_18(int x) { return x * 18; }
+inline int f1550_19(int x) { return x * 19; }
+inline int f1550_20(int x) { return x * 20; }
+inline int f1550_21(int x) { return x * 21; }
+inline int f1550_22(int x) { return x * 22; }
+inline int f1550_23(int x) { return x * 23; }
+inline int f1550_24(int x) { return x * 24; }
+inline int f1550_25(int x) { return x * 25; }
+inline int f1550_26(int x) { return x * 26; }
+inline int f1550_27(int x) { return x * 27; }
+inline int f1550_28(int x) { return x * 28; }
+inline int f1550_29(int x) { return x * 29; }
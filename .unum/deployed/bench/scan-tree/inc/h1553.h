@@ -0,0 +1,42 @@
+#pragma once
+/* header 1553 */
+#include <vector>
+#include "h3881.h"
+#include "h5656.h"
+#include "h6324.h"
+#include "h4769.h"
+#include "h1666.h"
+#ifdef X
+#include "h7385.h"
+#endif
+struct S1553 { int a; const char *s = "x//y"; };
+inline int f1553_0(int x) { return x * 0; }
+inline int f1553_1(int x) { return x * 1; }
+inline int f1553_2(int x) { return x * 2; }
+inline int f1553_3(int x) { return x * 3; }
+inline int f1553_4(int x) { return x * 4; }
+inline int f1553_5(int x) { return x * 5; }
+inline int f1553_6(int x) { return x * 6; }
+inline int f1553_7(int x) { return x * 7; }
+inline int f1553_8(int x) { return x * 8; }
+inline int f1553_9(int x) { return x * 9; }
+inline int f1553_10(int x) { return x * 10; }
+inline int f1553_11(int x) { return x * 11; }
+inline int f1553_12(int x) { return x * 12; }
+inline int f1553_13(int x) { return x * 13; }
+inline int f1553_14(int x) { return x * 14; }
+inline int f1553_15(int x) { return x * 15; }
+inline int f1553_16(int x) { return x * 16; }
+inline int f1553_17(int x) { return x * 17; }
+inline int f1553_18(int x) { return x * 18; }
+inline int f1553_19(int x) { return x * 19; }
+inline int f1553_20(int x) { return x * 20; }
+inline int f1553_21(int x) { return x * 21; }
+inline int f1553_22(int x) { return x * 22; }
+inline int f1553_23(int x) { return x * 23; }
+inline int f1553_24(int x) { return x * 24; }
+inline int f1553_25(int x) { return x * 25; }
+inline int f1553_26(int x) { return x * 26; }
+inline int f1553_27(int x) { return x * 27; }
+inline int f1553_28(int x) { return x * 28; }
+inline int f1553_29(int x) { return x * 29; }
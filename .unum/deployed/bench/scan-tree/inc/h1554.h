@@ -0,0 +1,42 @@
+#pragma once
+/* header 1554 */
+#include <vector>
+#include "h1554.h"
+#include "h4086.h"
+#include "h8993.h"
+#include "h7239.h"
+#include "h163.h"
+#ifdef X
+#include "h1429.h"
+#endif
+struct S1554 { int a; const char *s = "x//y"; };
+inline int f1554_0(int x) { return x * 0; }
+inline int f1554_1(int x) { return x * 1; }
+inline int f1554_2(int x) { return x * 2; }
+inline int f1554_3(int x) { return x * 3; }
+inline int f1554_4(int x) { return x * 4; }
+inline int f1554_5(int x) { return x * 5; }
+inline int f1554_6(int x) { return x * 6; }
+inline int f1554_7(int x) { return x * 7; }
+inline int f1554_8(int x) { return x * 8; }
+inline int f1554_9(int x) { return x * 9; }
+inline int f1554_10(int x) { return x * 10; }
+inline int f1554_11(int x) { return x * 11; }
+inline int f1554_12(int x) { return x * 12; }
+inline int f1554_13(int x) { return x * 13; }
+inline int f1554_14(int x) { return x * 14; }
+inline int f1554_15(int x) { return x * 15; }
+inline int f1554_16(int x) { return x * 16; }
+inline int f1554_17(int x) { return x * 17; }
+inline int f1554_18(int x) { return x * 18; }
+inline int f1554_19(int x) { return x * 19; }
+inline int f1554_20(int x) { return x * 20; }
+inline int f1554_21(int x) { return x * 21; }
+inline int f1554_22(int x) { return x * 22; }
+inline int f1554_23(int x) { return x * 23; }
+inline int f1554_24(int x) { return x * 24; }
+inline int f1554_25(int x) { return x * 25; }
+inline int f1554_26(int x) { return x * 26; }
+inline int f1554_27(int x) { return x * 27; }
+inline int f1554_28(int x) { return x * 28; }
+inline int f1554_29(int x) { return x * 29; }
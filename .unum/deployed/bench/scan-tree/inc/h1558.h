@@ -0,0 +1,42 @@
+#pragma once
+/* header 1558 */
+#include <vector>
+#include "h9816.h"
+#include "h7174.h"
+#include "h7881.h"
+#include "h8223.h"
+#include "h120.h"
+#ifdef X
+#include "h7770.h"
+#endif
+struct S1558 { int a; const char *s = "x//y"; };
+inline int f1558_0(int x) { return x * 0; }
+inline int f1558_1(int x) { return x * 1; }
+inline int f1558_2(int x) { return x * 2; }
+inline int f1558_3(int x) { return x * 3; }
+inline int f1558_4(int x) { return x * 4; }
+inline int f1558_5(int x) { return x * 5; }
+inline int f1558_6(int x) { return x * 6; }
+inline int f1558_7(int x) { return x * 7; }
+inline int f1558_8(int x) { return x * 8; }
+inline int f1558_9(int x) { return x * 9; }
+inline int f1558_10(int x) { return x * 10; }
+inline int f1558_11(int x) { return x * 11; }
+inline int f1558_12(int x) { return x * 12; }
+inline int f1558_13(int x) { return x * 13; }
+inline int f1558_14(int x) { return x * 14; }
+inline int f1558_15(int x) { return x * 15; }
+inline int f1558_16(int x) { return x * 16; }
+inline int f1558_17(int x) { return x * 17; }
+inline int f1558_18(int x) { return x * 18; }
+inline int f1558_19(int x) { return x * 19; }
+inline int f1558_20(int x) { return x * 20; }
+inline int f1558_21(int x) { return x * 21; }
+inline int f1558_22(int x) { return x * 22; }
+inline int f1558_23(int x) { return x * 23; }
+inline int f1558_24(int x) { return x * 24; }
+inline int f1558_25(int x) { return x * 25; }
+inline int f1558_26(int x) { return x * 26; }
+inline int f1558_27(int x) { return x * 27; }
+inline int f1558_28(int x) { return x * 28; }
+inline int f1558_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1559 */
+#include <vector>
+#include "h9766.h"
+#include "h4166.h"
+#include "h7742.h"
+#include "h4869.h"
+#include "h9762.h"
+#ifdef X
+#include "h7369.h"
+#endif
+struct S1559 { int a; const char *s = "x//y"; };
+inline int f1559_0(int x) { return x * 0; }
+inline int f1559_1(int x) { return x * 1; }
+inline int f1559_2(int x) { return x * 2; }
+inline int f1559_3(int x) { return x * 3; }
+inline int f1559_4(int x) { return x * 4; }
+inline int f1559_5(int x) { return x * 5; }
+inline int f1559_6(int x) { return x * 6; }
+inline int f1559_7(int x) { return x * 7; }
+inline int f1559_8(int x) { return x * 8; }
+inline int f1559_9(int x) { return x * 9; }
+inline int f1559_10(int x) { return x * 10; }
+inline int f1559_11(int x) { return x * 11; }
+inline int f1559_12(int x) { return x * 12; }
+inline int f1559_13(int x) { return x * 13; }
+inline int f1559_14(int x) { return x * 14; }
+inline int f1559_15(int x) { return x * 15; }
+inline int f1559_16(int x) { return x * 16; }
+inline int f1559_17(int x) { return x * 17; }
+inline int f1559_18(int x) { return x * 18; }
+inline int f1559_19(int x) { return x * 19; }
+inline int f1559_20(int x) { return x * 20; }
+inline int f1559_21(int x) { return x * 21; }
+inline int f1559_22(int x) { return x * 22; }
+inline int f1559_23(int x) { return x * 23; }
+inline int f1559_24(int x) { return x * 24; }
+inline int f1559_25(int x) { return x * 25; }
+inline int f1559_26(int x) { return x * 26; }
+inline int f1559_27(int x) { return x * 27; }
+inline int f1559_28(int x) { return x * 28; }
+inline int f1559_29(int x) { return x * 29; }
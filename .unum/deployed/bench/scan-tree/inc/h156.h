@@ -0,0 +1,42 @@
+#pragma once
+/* header 156 */
+#include <vector>
+#include "h5767.h"
+#include "h5881.h"
+#include "h8500.h"
+#include "h6888.h"
+#include "h651.h"
+#ifdef X
+#include "h7379.h"
+#endif
+struct S156 { int a; const char *s = "x//y"; };
+inline int f156_0(int x) { return x * 0; }
+inline int f156_1(int x) { return x * 1; }
+inline int f156_2(int x) { return x * 2; }
+inline int f156_3(int x) { return x * 3; }
+inline int f156_4(int x) { return x * 4; }
+inline int f156_5(int x) { return x * 5; }
+inline int f156_6(int x) { return x * 6; }
+inline int f156_7(int x) { return x * 7; }
+inline int f156_8(int x) { return x * 8; }
+inline int f156_9(int x) { return x * 9; }
+inline int f156_10(int x) { return x * 10; }
+inline int f156_11(int x) { return x * 11; }
+inline int f156_12(int x) { return x * 12; }
+inline int f156_13(int x) { return x * 13; }
+inline int f156_14(int x) { return x * 14; }
+inline int f156_15(int x) { return x * 15; }
+inline int f156_16(int x) { return x * 16; }
+inline int f156_17(int x) { return x * 17; }
+inline int f156_18(int x) { return x * 18; }
+inline int f156_19(int x) { return x * 19; }
+inline int f156_20(int x) { return x * 20; }
+inline int f156_21(int x) { return x * 21; }
+inline int f156_22(int x) { return x * 22; }
+inline int f156_23(int x) { return x * 23; }
+inline int f156_24(int x) { return x * 24; }
+inline int f156_25(int x) { return x * 25; }
+inline int f156_26(int x) { return x * 26; }
+inline int f156_27(int x) { return x * 27; }
+inline int f156_28(int x) { return x * 28; }
+inline int f156_29(int x) { return x * 29; }
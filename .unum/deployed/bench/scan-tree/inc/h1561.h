@@ -0,0 +1,42 @@
+#pragma once
+/* header 1561 */
+#include <vector>
+#include "h3016.h"
+#include "h8110.h"
+#include "h166.h"
+#include "h3298.h"
+#include "h9924.h"
+#ifdef X
+#include "h7803.h"
+#endif
+struct S1561 { int a; const char *s = "x//y"; };
+inline int f1561_0(int x) { return x * 0; }
+inline int f1561_1(int x) { return x * 1; }
+inline int f1561_2(int x) { return x * 2; }
+inline int f1561_3(int x) { return x * 3; }
+inline int f1561_4(int x) { return x * 4; }
+inline int f1561_5(int x) { return x * 5; }
+inline int f1561_6(int x) { return x * 6; }
+inline int f1561_7(int x) { return x * 7; }
+inline int f1561_8(int x) { return x * 8; }
+inline int f1561_9(int x) { return x * 9; }
+inline int f1561_10(int x) { return x * 10; }
+inline int f1561_11(int x) { return x * 11; }
+inline int f1561_12(int x) { return x * 12; }
+inline int f1561_13(int x) { return x * 13; }
+inline int f1561_14(int x) { return x * 14; }
+inline int f1561_15(int x) { return x * 15; }
+inline int f1561_16(int x) { return x * 16; }
+inline int f1561_17(int x) { return x * 17; }
+inline int f1561_18(int x) { return x * 18; }
+inline int f1561_19(int x) { return x * 19; }
+inline int f1561_20(int x) { return x * 20; }
+inline int f1561_21(int x) { return x * 21; }
+inline int f1561_22(int x) { return x * 22; }
+inline int f1561_23(int x) { return x * 23; }
+inline int f1561_24(int x) { return x * 24; }
+inline int f1561_25(int x) { return x * 25; }
+inline int f1561_26(int x) { return x * 26; }
+inline int f1561_27(int x) { return x * 27; }
+inline int f1561_28(int x) { return x * 28; }
+inline int f1561_29(int x) { return x * 29; }
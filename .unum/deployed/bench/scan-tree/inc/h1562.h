@@ -0,0 +1,42 @@
+#pragma once
+/* header 1562 */
+#include <vector>
+#include "h169.h"
+#include "h6999.h"
+#include "h1219.h"
+#include "h331.h"
+#include "h9341.h"
+#ifdef X
+#include "h818.h"
+#endif
+struct S1562 { int a; const char *s = "x//y"; };
+inline int f1562_0(int x) { return x * 0; }
+inline int f1562_1(int x) { return x * 1; }
+inline int f1562_2(int x) { return x * 2; }
+inline int f1562_3(int x) { return x * 3; }
+inline int f1562_4(int x) { return x * 4; }
+inline int f1562_5(int x) { return x * 5; }
+inline int f1562_6(int x) { return x * 6; }
+inline int f1562_7(int x) { return x * 7; }
+inline int f1562_8(int x) { return x * 8; }
+inline int f1562_9(int x) { return x * 9; }
+inline int f1562_10(int x) { return x * 10; }
+inline int f1562_11(int x) { return x * 11; }
+inline int f1562_12(int x) { return x * 12; }
+inline int f1562_13(int x) { return x * 13; }
+inline int f1562_14(int x) { return x * 14; }
+inline int f1562_15(int x) { return x * 15; }
+inline int f1562_16(int x) { return x * 16; }
+inline int f1562_17(int x) { return x * 17; }
+inline int f1562_18(int x) { return x * 18; }
+inline int f1562_19(int x) { return x * 19; }
+inline int f1562_20(int x) { return x * 20; }
+inline int f1562_21(int x) { return x * 21; }
+inline int f1562_22(int x) { return x * 22; }
+inline int f1562_23(int x) { return x * 23; }
+inline int f1562_24(int x) { return x * 24; }
+inline int f1562_25(int x) { return x * 25; }
+inline int f1562_26(int x) { return x * 26; }
+inline int f1562_27(int x) { return x * 27; }
+inline int f1562_28(int x) { return x * 28; }
+inline int f1562_29(int x) { return x * 29; }
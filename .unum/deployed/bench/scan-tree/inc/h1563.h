@@ -0,0 +1,42 @@
+#pragma once
+/* header 1563 */
+#include <vector>
+#include "h4046.h"
+#include "h3977.h"
+#include "h8383.h"
+#include "h1406.h"
+#include "h7824.h"
+#ifdef X
+#include "h788.h"
+#endif
+struct S1563 { int a; const char *s = "x//y"; };
+inline int f1563_0(int x) { return x * 0; }
+inline int f1563_1(int x) { return x * 1; }
+inline int f1563_2(int x) { return x * 2; }
+inline int f1563_3(int x) { return x * 3; }
+inline int f1563_4(int x) { return x * 4; }
+inline int f1563_5(int x) { return x * 5; }
+inline int f1563_6(int x) { return x * 6; }
+inline int f1563_7(int x) { return x * 7; }
+inline int f1563_8(int x) { return x * 8; }
+inline int f1563_9(int x) { return x * 9; }
+inline int f1563_10(int x) { return x * 10; }
+inline int f1563_11(int x) { return x * 11; }
+inline int f1563_12(int x) { return x * 12; }
+inline int f1563_13(int x) { return x * 13; }
+inline int f1563_14(int x) { return x * 14; }
+inline int f1563_15(int x) { return x * 15; }
+inline int f1563_16(int x) { return x * 16; }
+inline int f1563_17(int x) { return x * 17; }
+inline int f1563_18(int x) { return x * 18; }
+inline int f1563_19(int x) { return x * 19; }
+inline int f1563_20(int x) { return x * 20; }
+inline int f1563_21(int x) { return x * 21; }
+inline int f1563_22(int x) { return x * 22; }
+inline int f1563_23(int x) { return x * 23; }
+inline int f1563_24(int x) { return x * 24; }
+inline int f1563_25(int x) { return x * 25; }
+inline int f1563_26(int x) { return x * 26; }
+inline int f1563_27(int x) { return x * 27; }
+inline int f1563_28(int x) { return x * 28; }
+inline int f1563_29(int x) { return x * 29; }
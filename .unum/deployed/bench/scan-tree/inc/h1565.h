@@ -0,0 +1,42 @@
+#pragma once
+/* header 1565 */
+#include <vector>
+#include "h9163.h"
+#include "h8806.h"
+#include "h7038.h"
+#include "h9348.h"
+#include "h9568.h"
+#ifdef X
+#include "h2071.h"
+#endif
+struct S1565 { int a; const char *s = "x//y"; };
+inline int f1565_0(int x) { return x * 0; }
+inline int f1565_1(int x) { return x * 1; }
+inline int f1565_2(int x) { return x * 2; }
+inline int f1565_3(int x) { return x * 3; }
+inline int f1565_4(int x) { return x * 4; }
+inline int f1565_5(int x) { return x * 5; }
+inline int f1565_6(int x) { return x * 6; }
+inline int f1565_7(int x) { return x * 7; }
+inline int f1565_8(int x) { return x * 8; }
+inline int f1565_9(int x) { return x * 9; }
+inline int f1565_10(int x) { return x * 10; }
+inline int f1565_11(int x) { return x * 11; }
+inline int f1565_12(int x) { return x * 12; }
+inline int f1565_13(int x) { return x * 13; }
+inline int f1565_14(int x) { return x * 14; }
+inline int f1565_15(int x) { return x * 15; }
+inline int f1565_16(int x) { return x * 16; }
+inline int f1565_17(int x) { return x * 17; }
+inline int f1565_18(int x) { return x * 18; }
+inline int f1565_19(int x) { return x * 19; }
+inline int f1565_20(int x) { return x * 20; }
+inline int f1565_21(int x) { return x * 21; }
+inline int f1565_22(int x) { return x * 22; }
+inline int f1565_23(int x) { return x * 23; }
+inline int f1565_24(int x) { return x * 24; }
+inline int f1565_25(int x) { return x * 25; }
+inline int f1565_26(int x) { return x * 26; }
+inline int f1565_27(int x) { return x * 27; }
+inline int f1565_28(int x) { return x * 28; }
+inline int f1565_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1566 */
+#include <vector>
+#include "h1319.h"
+#include "h1920.h"
+#include "h1642.h"
+#include "h4286.h"
+#include "h1193.h"
+#ifdef X
+#include "h5142.h"
+#endif
+struct S1566 { int a; const char *s = "x//y"; };
+inline int f1566_0(int x) { return x * 0; }
+inline int f1566_1(int x) { return x * 1; }
+inline int f1566_2(int x) { return x * 2; }
+inline int f1566_3(int x) { return x * 3; }
+inline int f1566_4(int x) { return x * 4; }
+inline int f1566_5(int x) { return x * 5; }
+inline int f1566_6(int x) { return x * 6; }
+inline int f1566_7(int x) { return x * 7; }
+inline int f1566_8(int x) { return x * 8; }
+inline int f1566_9(int x) { return x * 9; }
+inline int f1566_10(int x) { return x * 10; }
+inline int f1566_11(int x) { return x * 11; }
+inline int f1566_12(int x) { return x * 12; }
+inline int f1566_13(int x) { return x * 13; }
+inline int f1566_14(int x) { return x * 14; }
+inline int f1566_15(int x) { return x * 15; }
+inline int f1566_16(int x) { return x * 16; }
+inline int f1566_17(int x) { return x * 17; }
+inline int f1566_18(int x) { return x * 18; }
+inline int f1566_19(int x) { return x * 19; }
+inline int f1566_20(int x) { return x * 20; }
+inline int f1566_21(int x) { return x * 21; }
+inline int f1566_22(int x) { return x * 22; }
+inline int f1566_23(int x) { return x * 23; }
+inline int f1566_24(int x) { return x * 24; }
+inline int f1566_25(int x) { return x * 25; }
+inline int f1566_26(int x) { return x * 26; }
+inline int f1566_27(int x) { return x * 27; }
+inline int f1566_28(int x) { return x * 28; }
+inline int f1566_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1569 */
+#include <vector>
+#include "h1409.h"
+#include "h2528.h"
+#include "h8276.h"
+#include "h9925.h"
+#include "h1826.h"
+#ifdef X
+#include "h4719.h"
+#endif
+struct S1569 { int a; const char *s = "x//y"; };
+inline int f1569_0(int x) { return x * 0; }
+inline int f1569_1(int x) { return x * 1; }
+inline int f1569_2(int x) { return x * 2; }
+inline int f1569_3(int x) { return x * 3; }
+inline int f1569_4(int x) { return x * 4; }
+inline int f1569_5(int x) { return x * 5; }
+inline int f1569_6(int x) { return x * 6; }
+inline int f1569_7(int x) { return x * 7; }
+inline int f1569_8(int x) { return x * 8; }
+inline int f1569_9(int x) { return x * 9; }
+inline int f1569_10(int x) { return x * 10; }
+inline int f1569_11(int x) { return x * 11; }
+inline int f1569_12(int x) { return x * 12; }
+inline int f1569_13(int x) { return x * 13; }
+inline int f1569_14(int x) { return x * 14; }
+inline int f1569_15(int x) { return x * 15; }
+inline int f1569_16(int x) { return x * 16; }
+inline int f1569_17(int x) { return x * 17; }
+inline int f1569_18(int x) { return x * 18; }
+inline int f1569_19(int x) { return x * 19; }
+inline int f1569_20(int x) { return x * 20; }
+inline int f1569_21(int x) { return x * 21; }
+inline int f1569_22(int x) { return x * 22; }
+inline int f1569_23(int x) { return x * 23; }
+inline int f1569_24(int x) { return x * 24; }
+inline int f1569_25(int x) { return x * 25; }
+inline int f1569_26(int x) { return x * 26; }
+inline int f1569_27(int x) { return x * 27; }
+inline int f1569_28(int x) { return x * 28; }
+inline int f1569_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 157 */
+#include <vector>
+#include "h4002.h"
+#include "h1913.h"
+#include "h7181.h"
+#include "h9933.h"
+#include "h6016.h"
+#ifdef X
+#include "h2576.h"
+#endif
+struct S157 { int a; const char *s = "x//y"; };
+inline int f157_0(int x) { return x * 0; }
+inline int f157_1(int x) { return x * 1; }
+inline int f157_2(int x) { return x * 2; }
+inline int f157_3(int x) { return x * 3; }
+inline int f157_4(int x) { return x * 4; }
+inline int f157_5(int x) { return x * 5; }
+inline int f157_6(int x) { return x * 6; }
+inline int f157_7(int x) { return x * 7; }
+inline int f157_8(int x) { return x * 8; }
+inline int f157_9(int x) { return x * 9; }
+inline int f157_10(int x) { return x * 10; }
+inline int f157_11(int x) { return x * 11; }
+inline int f157_12(int x) { return x * 12; }
+inline int f157_13(int x) { return x * 13; }
+inline int f157_14(int x) { return x * 14; }
+inline int f157_15(int x) { return x * 15; }
+inline int f157_16(int x) { return x * 16; }
+inline int f157_17(int x) { return x * 17; }
+inline int f157_18(int x) { return x * 18; }
+inline int f157_19(int x) { return x * 19; }
+inline int f157_20(int x) { return x * 20; }
+inline int f157_21(int x) { return x * 21; }
+inline int f157_22(int x) { return x * 22; }
+inline int f157_23(int x) { return x * 23; }
+inline int f157_24(int x) { return x * 24; }
+inline int f157_25(int x) { return x * 25; }
+inline int f157_26(int x) { return x * 26; }
+inline int f157_27(int x) { return x * 27; }
+inline int f157_28(int x) { return x * 28; }
+inline int f157_29(int x) { return x * 29; }
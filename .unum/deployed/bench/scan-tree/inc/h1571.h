@@ -0,0 +1,42 @@
+#pragma once
+/* header 1571 */
+#include <vector>
+#include "h3191.h"
+#include "h6381.h"
+#include "h7848.h"
+#include "h9507.h"
+#include "h4638.h"
+#ifdef X
+#include "h7768.h"
+#endif
+struct S1571 { int a; const char *s = "x//y"; };
+inline int f1571_0(int x) { return x * 0; }
+inline int f1571_1(int x) { return x * 1; }
+inline int f1571_2(int x) { return x * 2; }
+inline int f1571_3(int x) { return x * 3; }
+inline int f1571_4(int x) { return x * 4; }
+inline int f1571_5(int x) { return x * 5; }
+inline int f1571_6(int x) { return x * 6; }
+inline int f1571_7(int x) { return x * 7; }
+inline int f1571_8(int x) { return x * 8; }
+inline int f1571_9(int x) { return x * 9; }
+inline int f1571_10(int x) { return x * 10; }
+inline int f1571_11(int x) { return x * 11; }
+inline int f1571_12(int x) { return x * 12; }
+inline int f1571_13(int x) { return x * 13; }
+inline int f1571_14(int x) { return x * 14; }
+inline int f1571_15(int x) { return x * 15; }
+inline int f1571_16(int x) { return x * 16; }
+inline int f1571_17(int x) { return x * 17; }
+inline int f1571_18(int x) { return x * 18; }
+inline int f1571_19(int x) { return x * 19; }
+inline int f1571_20(int x) { return x * 20; }
+inline int f1571_21(int x) { return x * 21; }
+inline int f1571_22(int x) { return x * 22; }
+inline int f1571_23(int x) { return x * 23; }
+inline int f1571_24(int x) { return x * 24; }
+inline int f1571_25(int x) { return x * 25; }
+inline int f1571_26(int x) { return x * 26; }
+inline int f1571_27(int x) { return x * 27; }
+inline int f1571_28(int x) { return x * 28; }
+inline int f1571_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1574 */
+#include <vector>
+#include "h7755.h"
+#include "h7031.h"
+#include "h12.h"
+#include "h8923.h"
+#include "h2614.h"
+#ifdef X
+#include "h178.h"
+#endif
+struct S1574 { int a; const char *s = "x//y"; };
+inline int f1574_0(int x) { return x * 0; }
+inline int f1574_1(int x) { return x * 1; }
+inline int f1574_2(int x) { return x * 2; }
+inline int f1574_3(int x) { return x * 3; }
+inline int f1574_4(int x) { return x * 4; }
+inline int f1574_5(int x) { return x * 5; }
+inline int f1574_6(int x) { return x * 6; }
+inline int f1574_7(int x) { return x * 7; }
+inline int f1574_8(int x) { return x * 8; }
+inline int f1574_9(int x) { return x * 9; }
+inline int f1574_10(int x) { return x * 10; }
+inline int f1574_11(int x) { return x * 11; }
+inline int f1574_12(int x) { return x * 12; }
+inline int f1574_13(int x) { return x * 13; }
+inline int f1574_14(int x) { return x * 14; }
+inline int f1574_15(int x) { return x * 15; }
+inline int f1574_16(int x) { return x * 16; }
+inline int f1574_17(int x) { return x * 17; }
+inline int f1574_18(int x) { return x * 18; }
+inline int f1574_19(int x) { return x * 19; }
+inline int f1574_20(int x) { return x * 20; }
+inline int f1574_21(int x) { return x * 21; }
+inline int f1574_22(int x) { return x * 22; }
+inline int f1574_23(int x) { return x * 23; }
+inline int f1574_24(int x) { return x * 24; }
+inline int f1574_25(int x) { return x * 25; }
+inline int f1574_26(int x) { return x * 26; }
+inline int f1574_27(int x) { return x * 27; }
+inline int f1574_28(int x) { return x * 28; }
+inline int f1574_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1577 */
+#include <vector>
+#include "h5195.h"
+#include "h4319.h"
+#include "h4357.h"
+#include "h8026.h"
+#include "h5119.h"
+#ifdef X
+#include "h9424.h"
+#endif
+struct S1577 { int a; const char *s = "x//y"; };
+inline int f1577_0(int x) { return x * 0; }
+inline int f1577_1(int x) { return x * 1; }
+inline int f1577_2(int x) { return x * 2; }
+inline int f1577_3(int x) { return x * 3; }
+inline int f1577_4(int x) { return x * 4; }
+inline int f1577_5(int x) { return x * 5; }
+inline int f1577_6(int x) { return x * 6; }
+inline int f1577_7(int x) { return x * 7; }
+inline int f1577_8(int x) { return x * 8; }
+inline int f1577_9(int x) { return x * 9; }
+inline int f1577_10(int x) { return x * 10; }
+inline int f1577_11(int x) { return x * 11; }
+inline int f1577_12(int x) { return x * 12; }
+inline int f1577_13(int x) { return x * 13; }
+inline int f1577_14(int x) { return x * 14; }
+inline int f1577_15(int x) { return x * 15; }
+inline int f1577_16(int x) { return x * 16; }
+inline int f1577_17(int x) { return x * 17; }
+inline int f1577_18(int x) { return x * 18; }
+inline int f1577_19(int x) { return x * 19; }
+inline int f1577_20(int x) { return x * 20; }
+inline int f1577_21(int x) { return x * 21; }
+inline int f1577_22(int x) { return x * 22; }
+inline int f1577_23(int x) { return x * 23; }
+inline int f1577_24(int x) { return x * 24; }
+inline int f1577_25(int x) { return x * 25; }
+inline int f1577_26(int x) { return x * 26; }
+inline int f1577_27(int x) { return x * 27; }
+inline int f1577_28(int x) { return x * 28; }
+inline int f1577_29(int x) { return x * 29; }
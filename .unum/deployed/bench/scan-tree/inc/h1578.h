@@ -0,0 +1,42 @@
+#pragma once
+/* header 1578 */
+#include <vector>
+#include "h5772.h"
+#include "h5694.h"
+#include "h8538.h"
+#include "h6375.h"
+#include "h2074.h"
+#ifdef X
+#include "h8666.h"
+#endif
+struct S1578 { int a; const char *s = "x//y"; };
+inline int f1578_0(int x) { return x * 0; }
+inline int f1578_1(int x) { return x * 1; }
+inline int f1578_2(int x) { return x * 2; }
+inline int f1578_3(int x) { return x * 3; }
+inline int f1578_4(int x) { return x * 4; }
+inline int f1578_5(int x) { return x * 5; }
+inline int f1578_6(int x) { return x * 6; }
+inline int f1578_7(int x) { return x * 7; }
+inline int f1578_8(int x) { return x * 8; }
+inline int f1578_9(int x) { return x * 9; }
+inline int f1578_10(int x) { return x * 10; }
+inline int f1578_11(int x) { return x * 11; }
+inline int f1578_12(int x) { return x * 12; }
+inline int f1578_13(int x) { return x * 13; }
+inline int f1578_14(int x) { return x * 14; }
+inline int f1578_15(int x) { return x * 15; }
+inline int f1578_16(int x) { return x * 16; }
+inline int f1578_17(int x) { return x * 17; }
+inline int f1578_18(int x) { return x * 18; }
+inline int f1578_19(int x) { return x * 19; }
+inline int f1578_20(int x) { return x * 20; }
+inline int f1578_21(int x) { return x * 21; }
+inline int f1578_22(int x) { return x * 22; }
+inline int f1578_23(int x) { return x * 23; }
+inline int f1578_24(int x) { return x * 24; }
+inline int f1578_25(int x) { return x * 25; }
+inline int f1578_26(int x) { return x * 26; }
+inline int f1578_27(int x) { return x * 27; }
+inline int f1578_28(int x) { return x * 28; }
+inline int f1578_29(int x) { return x * 29; }
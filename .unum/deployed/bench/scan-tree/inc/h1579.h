@@ -0,0 +1,42 @@
+#pragma once
+/* header 1579 */
+#include <vector>
+#include "h5645.h"
+#include "h188.h"
+#include "h6822.h"
+#include "h3620.h"
+#include "h3527.h"
+#ifdef X
+#include "h7738.h"
+#endif
+struct S1579 { int a; const char *s = "x//y"; };
+inline int f1579_0(int x) { return x * 0; }
+inline int f1579_1(int x) { return x * 1; }
+inline int f1579_2(int x) { return x * 2; }
+inline int f1579_3(int x) { return x * 3; }
+inline int f1579_4(int x) { return x * 4; }
+inline int f1579_5(int x) { return x * 5; }
+inline int f1579_6(int x) { return x * 6; }
+inline int f1579_7(int x) { return x * 7; }
+inline int f1579_8(int x) { return x * 8; }
+inline int f1579_9(int x) { return x * 9; }
+inline int f1579_10(int x) { return x * 10; }
+inline int f1579_11(int x) { return x * 11; }
+inline int f1579_12(int x) { return x * 12; }
+inline int f1579_13(int x) { return x * 13; }
+inline int f1579_14(int x) { return x * 14; }
+inline int f1579_15(int x) { return x * 15; }
+inline int f1579_16(int x) { return x * 16; }
+inline int f1579_17(int x) { return x * 17; }
+inline int f1579_18(int x) { return x * 18; }
+inline int f1579_19(int x) { return x * 19; }
+inline int f1579_20(int x) { return x * 20; }
+inline int f1579_21(int x) { return x * 21; }
+inline int f1579_22(int x) { return x * 22; }
+inline int f1579_23(int x) { return x * 23; }
+inline int f1579_24(int x) { return x * 24; }
+inline int f1579_25(int x) { return x * 25; }
+inline int f1579_26(int x) { return x * 26; }
+inline int f1579_27(int x) { return x * 27; }
+inline int f1579_28(int x) { return x * 28; }
+inline int f1579_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1580 */
+#include <vector>
+#include "h9118.h"
+#include "h5297.h"
+#include "h4809.h"
+#include "h2871.h"
+#include "h9895.h"
+#ifdef X
+#include "h2841.h"
+#endif
+struct S1580 { int a; const char *s = "x//y"; };
+inline int f1580_0(int x) { return x * 0; }
+inline int f1580_1(int x) { return x * 1; }
+inline int f1580_2(int x) { return x * 2; }
+inline int f1580_3(int x) { return x * 3; }
+inline int f1580_4(int x) { return x * 4; }
+inline int f1580_5(int x) { return x * 5; }
+inline int f1580_6(int x) { return x * 6; }
+inline int f1580_7(int x) { return x * 7; }
+inline int f1580_8(int x) { return x * 8; }
+inline int f1580_9(int x) { return x * 9; }
+inline int f1580_10(int x) { return x * 10; }
+inline int f1580_11(int x) { return x * 11; }
+inline int f1580_12(int x) { return x * 12; }
+inline int f1580_13(int x) { return x * 13; }
+inline int f1580_14(int x) { return x * 14; }
+inline int f1580_15(int x) { return x * 15; }
+inline int f1580_16(int x) { return x * 16; }
+inline int f1580_17(int x) { return x * 17; }
+inline int f1580_18(int x) { return x * 18; }
+inline int f1580_19(int x) { return x * 19; }
+inline int f1580_20(int x) { return x * 20; }
+inline int f1580_21(int x) { return x * 21; }
+inline int f1580_22(int x) { return x * 22; }
+inline int f1580_23(int x) { return x * 23; }
+inline int f1580_24(int x) { return x * 24; }
+inline int f1580_25(int x) { return x * 25; }
+inline int f1580_26(int x) { return x * 26; }
+inline int f1580_27(int x) { return x * 27; }
+inline int f1580_28(int x) { return x * 28; }
+inline int f1580_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1581 */
+#include <vector>
+#include "h2233.h"
+#include "h1366.h"
+#include "h6484.h"
+#include "h7692.h"
+#include "h6358.h"
+#ifdef X
+#include "h7401.h"
+#endif
+struct S1581 { int a; const char *s = "x//y"; };
+inline int f1581_0(int x) { return x * 0; }
+inline int f1581_1(int x) { return x * 1; }
+inline int f1581_2(int x) { return x * 2; }
+inline int f1581_3(int x) { return x * 3; }
+inline int f1581_4(int x) { return x * 4; }
+inline int f1581_5(int x) { return x * 5; }
+inline int f1581_6(int x) { return x * 6; }
+inline int f1581_7(int x) { return x * 7; }
+inline int f1581_8(int x) { return x * 8; }
+inline int f1581_9(int x) { return x * 9; }
+inline int f1581_10(int x) { return x * 10; }
+inline int f1581_11(int x) { return x * 11; }
+inline int f1581_12(int x) { return x * 12; }
+inline int f1581_13(int x) { return x * 13; }
+inline int f1581_14(int x) { return x * 14; }
+inline int f1581_15(int x) { return x * 15; }
+inline int f1581_16(int x) { return x * 16; }
+inline int f1581_17(int x) { return x * 17; }
+inline int f1581_18(int x) { return x * 18; }
+inline int f1581_19(int x) { return x * 19; }
+inline int f1581_20(int x) { return x * 20; }
+inline int f1581_21(int x) { return x * 21; }
+inline int f1581_22(int x) { return x * 22; }
+inline int f1581_23(int x) { return x * 23; }
+inline int f1581_24(int x) { return x * 24; }
+inline int f1581_25(int x) { return x * 25; }
+inline int f1581_26(int x) { return x * 26; }
+inline int f1581_27(int x) { return x * 27; }
+inline int f1581_28(int x) { return x * 28; }
+inline int f1581_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1582 */
+#include <vector>
+#include "h9376.h"
+#include "h2240.h"
+#include "h2064.h"
+#include "h1919.h"
+#include "h7284.h"
+#ifdef X
+#include "h9872.h"
+#endif
+struct S1582 { int a; const char *s = "x//y"; };
+inline int f1582_0(int x) { return x * 0; }
+inline int f1582_1(int x) { return x * 1; }
+inline int f1582_2(int x) { return x * 2; }
+inline int f1582_3(int x) { return x * 3; }
+inline int f1582_4(int x) { return x * 4; }
+inline int f1582_5(int x) { return x * 5; }
+inline int f1582_6(int x) { return x * 6; }
+inline int f1582_7(int x) { return x * 7; }
+inline int f1582_8(int x) { return x * 8; }
+inline int f1582_9(int x) { return x * 9; }
+inline int f1582_10(int x) { return x * 10; }
+inline int f1582_11(int x) { return x * 11; }
+inline int f1582_12(int x) { return x * 12; }
+inline int f1582_13(int x) { return x * 13; }
+inline int f1582_14(int x) { return x * 14; }
+inline int f1582_15(int x) { return x * 15; }
+inline int f1582_16(int x) { return x * 16; }
+inline int f1582_17(int x) { return x * 17; }
+inline int f1582_18(int x) { return x * 18; }
+inline int f1582_19(int x) { return x * 19; }
+inline int f1582_20(int x) { return x * 20; }
+inline int f1582_21(int x) { return x * 21; }
+inline int f1582_22(int x) { return x * 22; }
+inline int f1582_23(int x) { return x * 23; }
+inline int f1582_24(int x) { return x * 24; }
+inline int f1582_25(int x) { return x * 25; }
+inline int f1582_26(int x) { return x * 26; }
+inline int f1582_27(int x) { return x * 27; }
+inline int f1582_28(int x) { return x * 28; }
+inline int f1582_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1585 */
+#include <vector>
+#include "h49.h"
+#include "h485.h"
+#include "h6447.h"
+#include "h4134.h"
+#include "h3517.h"
+#ifdef X
+#include "h8369.h"
+#endif
+struct S1585 { int a; const char *s = "x//y"; };
+inline int f1585_0(int x) { return x * 0; }
+inline int f1585_1(int x) { return x * 1; }
+inline int f1585_2(int x) { return x * 2; }
+inline int f1585_3(int x) { return x * 3; }
+inline int f1585_4(int x) { return x * 4; }
+inline int f1585_5(int x) { return x * 5; }
+inline int f1585_6(int x) { return x * 6; }
+inline int f1585_7(int x) { return x * 7; }
+inline int f1585_8(int x) { return x * 8; }
+inline int f1585_9(int x) { return x * 9; }
+inline int f1585_10(int x) { return x * 10; }
+inline int f1585_11(int x) { return x * 11; }
+inline int f1585_12(int x) { return x * 12; }
+inline int f1585_13(int x) { return x * 13; }
+inline int f1585_14(int x) { return x * 14; }
+inline int f1585_15(int x) { return x * 15; }
+inline int f1585_16(int x) { return x * 16; }
+inline int f1585_17(int x) { return x * 17; }
+inline int f1585_18(int x) { return x * 18; }
+inline int f1585_19(int x) { return x * 19; }
+inline int f1585_20(int x) { return x * 20; }
+inline int f1585_21(int x) { return x * 21; }
+inline int f1585_22(int x) { return x * 22; }
+inline int f1585_23(int x) { return x * 23; }
+inline int f1585_24(int x) { return x * 24; }
+inline int f1585_25(int x) { return x * 25; }
+inline int f1585_26(int x) { return x * 26; }
+inline int f1585_27(int x) { return x * 27; }
+inline int f1585_28(int x) { return x * 28; }
+inline int f1585_29(int x) { return x * 29; }
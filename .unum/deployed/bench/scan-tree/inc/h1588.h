@@ -0,0 +1,42 @@
+#pragma once
+/* header 1588 */
+#include <vector>
+#include "h1661.h"
+#include "h7291.h"
+#include "h5648.h"
+#include "h110.h"
+#include "h5089.h"
+#ifdef X
+#include "h7922.h"
+#endif
+struct S1588 { int a; const char *s = "x//y"; };
+inline int f1588_0(int x) { return x * 0; }
+inline int f1588_1(int x) { return x * 1; }
+inline int f1588_2(int x) { return x * 2; }
+inline int f1588_3(int x) { return x * 3; }
+inline int f1588_4(int x) { return x * 4; }
+inline int f1588_5(int x) { return x * 5; }
+inline int f1588_6(int x) { return x * 6; }
+inline int f1588_7(int x) { return x * 7; }
+inline int f1588_8(int x) { return x * 8; }
+inline int f1588_9(int x) { return x * 9; }
+inline int f1588_10(int x) { return x * 10; }
+inline int f1588_11(int x) { return x * 11; }
+inline int f1588_12(int x) { return x * 12; }
+inline int f1588_13(int x) { return x * 13; }
+inline int f1588_14(int x) { return x * 14; }
+inline int f1588_15(int x) { return x * 15; }
+inline int f1588_16(int x) { return x * 16; }
+inline int f1588_17(int x) { return x * 17; }
+inline int f1588_18(int x) { return x * 18; }
+inline int f1588_19(int x) { return x * 19; }
+inline int f1588_20(int x) { return x * 20; }
+inline int f1588_21(int x) { return x * 21; }
+inline int f1588_22(int x) { return x * 22; }
+inline int f1588_23(int x) { return x * 23; }
+inline int f1588_24(int x) { return x * 24; }
+inline int f1588_25(int x) { return x * 25; }
+inline int f1588_26(int x) { return x * 26; }
+inline int f1588_27(int x) { return x * 27; }
+inline int f1588_28(int x) { return x * 28; }
+inline int f1588_29(int x) { return x * 29; }
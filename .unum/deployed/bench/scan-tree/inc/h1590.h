@@ -0,0 +1,42 @@
+#pragma once
+/* header 1590 */
+#include <vector>
+#include "h5784.h"
+#include "h6642.h"
+#include "h5815.h"
+#include "h4144.h"
+#include "h9872.h"
+#ifdef X
+#include "h4612.h"
+#endif
+struct S1590 { int a; const char *s = "x//y"; };
+inline int f1590_0(int x) { return x * 0; }
+inline int f1590_1(int x) { return x * 1; }
+inline int f1590_2(int x) { return x * 2; }
+inline int f1590_3(int x) { return x * 3; }
+inline int f1590_4(int x) { return x * 4; }
+inline int f1590_5(int x) { return x * 5; }
+inline int f1590_6(int x) { return x * 6; }
+inline int f1590_7(int x) { return x * 7; }
+inline int f1590_8(int x) { return x * 8; }
+inline int f1590_9(int x) { return x * 9; }
+inline int f1590_10(int x) { return x * 10; }
+inline int f1590_11(int x) { return x * 11; }
+inline int f1590_12(int x) { return x * 12; }
+inline int f1590_13(int x) { return x * 13; }
+inline int f1590_14(int x) { return x * 14; }
+inline int f1590_15(int x) { return x * 15; }
+inline int f1590_16(int x) { return x * 16; }
+inline int f1590_17(int x) { return x * 17; }
+inline int f1590_18(int x) { return x * 18; }
+inline int f1590_19(int x) { return x * 19; }
+inline int f1590_20(int x) { return x * 20; }
+inline int f1590_21(int x) { return x * 21; }
+inline int f1590_22(int x) { return x * 22; }
+inline int f1590_23(int x) { return x * 23; }
+inline int f1590_24(int x) { return x * 24; }
+inline int f1590_25(int x) { return x * 25; }
+inline int f1590_26(int x) { return x * 26; }
+inline int f1590_27(int x) { return x * 27; }
+inline int f1590_28(int x) { return x * 28; }
+inline int f1590_29(int x) { return x * 29; }
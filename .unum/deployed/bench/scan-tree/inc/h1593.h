@@ -0,0 +1,42 @@
+#pragma once
+/* header 1593 */
+#include <vector>
+#include "h3596.h"
+#include "h2000.h"
+#include "h3793.h"
+#include "h1346.h"
+#include "h9081.h"
+#ifdef X
+#include "h2439.h"
+#endif
+struct S1593 { int a; const char *s = "x//y"; };
+inline int f1593_0(int x) { return x * 0; }
+inline int f1593_1(int x) { return x * 1; }
+inline int f1593_2(int x) { return x * 2; }
+inline int f1593_3(int x) { return x * 3; }
+inline int f1593_4(int x) { return x * 4; }
+inline int f1593_5(int x) { return x * 5; }
+inline int f1593_6(int x) { return x * 6; }
+inline int f1593_7(int x) { return x * 7; }
+inline int f1593_8(int x) { return x * 8; }
+inline int f1593_9(int x) { return x * 9; }
+inline int f1593_10(int x) { return x * 10; }
+inline int f1593_11(int x) { return x * 11; }
+inline int f1593_12(int x) { return x * 12; }
+inline int f1593_13(int x) { return x * 13; }
+inline int f1593_14(int x) { return x * 14; }
+inline int f1593_15(int x) { return x * 15; }
+inline int f1593_16(int x) { return x * 16; }
+inline int f1593_17(int x) { return x * 17; }
+inline int f1593_18(int x) { return x * 18; }
+inline int f1593_19(int x) { return x * 19; }
+inline int f1593_20(int x) { return x * 20; }
+inline int f1593_21(int x) { return x * 21; }
+inline int f1593_22(int x) { return x * 22; }
+inline int f1593_23(int x) { return x * 23; }
+inline int f1593_24(int x) { return x * 24; }
+inline int f1593_25(int x) { return x * 25; }
+inline int f1593_26(int x) { return x * 26; }
+inline int f1593_27(int x) { return x * 27; }
+inline int f1593_28(int x) { return x * 28; }
+inline int f1593_29(int x) { return x * 29; }
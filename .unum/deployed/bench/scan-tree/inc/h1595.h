@@ -0,0 +1,42 @@
+#pragma once
+/* header 1595 */
+#include <vector>
+#include "h7649.h"
+#include "h566.h"
+#include "h9877.h"
+#include "h1158.h"
+#include "h7737.h"
+#ifdef X
+#include "h2456.h"
+#endif
+struct S1595 { int a; const char *s = "x//y"; };
+inline int f1595_0(int x) { return x * 0; }
+inline int f1595_1(int x) { return x * 1; }
+inline int f1595_2(int x) { return x * 2; }
+inline int f1595_3(int x) { return x * 3; }
+inline int f1595_4(int x) { return x * 4; }
+inline int f1595_5(int x) { return x * 5; }
+inline int f1595_6(int x) { return x * 6; }
+inline int f1595_7(int x) { return x * 7; }
+inline int f1595_8(int x) { return x * 8; }
+inline int f1595_9(int x) { return x * 9; }
+inline int f1595_10(int x) { return x * 10; }
+inline int f1595_11(int x) { return x * 11; }
+inline int f1595_12(int x) { return x * 12; }
+inline int f1595_13(int x) { return x * 13; }
+inline int f1595_14(int x) { return x * 14; }
+inline int f1595_15(int x) { return x * 15; }
+inline int f1595_16(int x) { return x * 16; }
+inline int f1595_17(int x) { return x * 17; }
+inline int f1595_18(int x) { return x * 18; }
+inline int f1595_19(int x) { return x * 19; }
+inline int f1595_20(int x) { return x * 20; }
+inline int f1595_21(int x) { return x * 21; }
+inline int f1595_22(int x) { return x * 22; }
+inline int f1595_23(int x) { return x * 23; }
+inline int f1595_24(int x) { return x * 24; }
+inline int f1595_25(int x) { return x * 25; }
+inline int f1595_26(int x) { return x * 26; }
+inline int f1595_27(int x) { return x * 27; }
+inline int f1595_28(int x) { return x * 28; }
+inline int f1595_29(int x) { return x * 29; }
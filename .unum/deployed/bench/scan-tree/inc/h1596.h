@@ -0,0 +1,42 @@
+#pragma once
+/* header 1596 */
+#include <vector>
+#include "h8565.h"
+#include "h6720.h"
+#include "h2964.h"
+#include "h5631.h"
+#include "h4122.h"
+#ifdef X
+#include "h2371.h"
+#endif
+struct S1596 { int a; const char *s = "x//y"; };
+inline int f1596_0(int x) { return x * 0; }
+inline int f1596_1(int x) { return x * 1; }
+inline int f1596_2(int x) { return x * 2; }
+inline int f1596_3(int x) { return x * 3; }
+inline int f1596_4(int x) { return x * 4; }
+inline int f1596_5(int x) { return x * 5; }
+inline int f1596_6(int x) { return x * 6; }
+inline int f1596_7(int x) { return x * 7; }
+inline int f1596_8(int x) { return x * 8; }
+inline int f1596_9(int x) { return x * 9; }
+inline int f1596_10(int x) { return x * 10; }
+inline int f1596_11(int x) { return x * 11; }
+inline int f1596_12(int x) { return x * 12; }
+inline int f1596_13(int x) { return x * 13; }
+inline int f1596_14(int x) { return x * 14; }
+inline int f1596_15(int x) { return x * 15; }
+inline int f1596_16(int x) { return x * 16; }
+inline int f1596_17(int x) { return x * 17; }
+inline int f1596_18(int x) { return x * 18; }
+inline int f1596_19(int x) { return x * 19; }
+inline int f1596_20(int x) { return x * 20; }
+inline int f1596_21(int x) { return x * 21; }
+inline int f1596_22(int x) { return x * 22; }
+inline int f1596_23(int x) { return x * 23; }
+inline int f1596_24(int x) { return x * 24; }
+inline int f1596_25(int x) { return x * 25; }
+inline int f1596_26(int x) { return x * 26; }
+inline int f1596_27(int x) { return x * 27; }
+inline int f1596_28(int x) { return x * 28; }
+inline int f1596_29(int x) { return x * 29; }
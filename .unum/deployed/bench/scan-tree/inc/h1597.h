@@ -0,0 +1,42 @@
+#pragma once
+/* header 1597 */
+#include <vector>
+#include "h4434.h"
+#include "h8487.h"
+#include "h521.h"
+#include "h6473.h"
+#include "h6796.h"
+#ifdef X
+#include "h6730.h"
+#endif
+struct S1597 { int a; const char *s = "x//y"; };
+inline int f1597_0(int x) { return x * 0; }
+inline int f1597_1(int x) { return x * 1; }
+inline int f1597_2(int x) { return x * 2; }
+inline int f1597_3(int x) { return x * 3; }
+inline int f1597_4(int x) { return x * 4; }
+inline int f1597_5(int x) { return x * 5; }
+inline int f1597_6(int x) { return x * 6; }
+inline int f1597_7(int x) { return x * 7; }
+inline int f1597_8(int x) { return x * 8; }
+inline int f1597_9(int x) { return x * 9; }
+inline int f1597_10(int x) { return x * 10; }
+inline int f1597_11(int x) { return x * 11; }
+inline int f1597_12(int x) { return x * 12; }
+inline int f1597_13(int x) { return x * 13; }
+inline int f1597_14(int x) { return x * 14; }
+inline int f1597_15(int x) { return x * 15; }
+inline int f1597_16(int x) { return x * 16; }
+inline int f1597_17(int x) { return x * 17; }
+inline int f1597_18(int x) { return x * 18; }
+inline int f1597_19(int x) { return x * 19; }
+inline int f1597_20(int x) { return x * 20; }
+inline int f1597_21(int x) { return x * 21; }
+inline int f1597_22(int x) { return x * 22; }
+inline int f1597_23(int x) { return x * 23; }
+inline int f1597_24(int x) { return x * 24; }
+inline int f1597_25(int x) { return x * 25; }
+inline int f1597_26(int x) { return x * 26; }
+inline int f1597_27(int x) { return x * 27; }
+inline int f1597_28(int x) { return x * 28; }
+inline int f1597_29(int x) { return x * 29; }
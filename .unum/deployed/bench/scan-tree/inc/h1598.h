@@ -0,0 +1,42 @@
+#pragma once
+/* header 1598 */
+#include <vector>
+#include "h2711.h"
+#include "h4381.h"
+#include "h6599.h"
+#include "h2959.h"
+#include "h7554.h"
+#ifdef X
+#include "h9001.h"
+#endif
+struct S1598 { int a; const char *s = "x//y"; };
+inline int f1598_0(int x) { return x * 0; }
+inline int f1598_1(int x) { return x * 1; }
+inline int f1598_2(int x) { return x * 2; }
+inline int f1598_3(int x) { return x * 3; }
+inline int f1598_4(int x) { return x * 4; }
+inline int f1598_5(int x) { return x * 5; }
+inline int f1598_6(int x) { return x * 6; }
+inline int f1598_7(int x) { return x * 7; }
+inline int f1598_8(int x) { return x * 8; }
+inline int f1598_9(int x) { return x * 9; }
+inline int f1598_10(int x) { return x * 10; }
+inline int f1598_11(int x) { return x * 11; }
+inline int f1598_12(int x) { return x * 12; }
+inline int f1598_13(int x) { return x * 13; }
+inline int f1598_14(int x) { return x * 14; }
+inline int f1598_15(int x) { return x * 15; }
+inline int f1598_16(int x) { return x * 16; }
+inline int f1598_17(int x) { return x * 17; }
+inline int f1598_18(int x) { return x * 18; }
+inline int f1598_19(int x) { return x * 19; }
+inline int f1598_20(int x) { return x * 20; }
+inline int f1598_21(int x) { return x * 21; }
+inline int f1598_22(int x) { return x * 22; }
+inline int f1598_23(int x) { return x * 23; }
+inline int f1598_24(int x) { return x * 24; }
+inline int f1598_25(int x) { return x * 25; }
+inline int f1598_26(int x) { return x * 26; }
+inline int f1598_27(int x) { return x * 27; }
+inline int f1598_28(int x) { return x * 28; }
+inline int f1598_29(int x) { return x * 29; }
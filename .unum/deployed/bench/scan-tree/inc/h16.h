@@ -0,0 +1,42 @@
+#pragma once
+/* header 16 */
+#include <vector>
+#include "h2221.h"
+#include "h3988.h"
+#include "h1114.h"
+#include "h1542.h"
+#include "h590.h"
+#ifdef X
+#include "h4871.h"
+#endif
+struct S16 { int a; const char *s = "x//y"; };
+inline int f16_0(int x) { return x * 0; }
+inline int f16_1(int x) { return x * 1; }
+inline int f16_2(int x) { return x * 2; }
+inline int f16_3(int x) { return x * 3; }
+inline int f16_4(int x) { return x * 4; }
+inline int f16_5(int x) { return x * 5; }
+inline int f16_6(int x) { return x * 6; }
+inline int f16_7(int x) { return x * 7; }
+inline int f16_8(int x) { return x * 8; }
+inline int f16_9(int x) { return x * 9; }
+inline int f16_10(int x) { return x * 10; }
+inline int f16_11(int x) { return x * 11; }
+inline int f16_12(int x) { return x * 12; }
+inline int f16_13(int x) { return x * 13; }
+inline int f16_14(int x) { return x * 14; }
+inline int f16_15(int x) { return x * 15; }
+inline int f16_16(int x) { return x * 16; }
+inline int f16_17(int x) { return x * 17; }
+inline int f16_18(int x) { return x * 18; }
+inline int f16_19(int x) { return x * 19; }
+inline int f16_20(int x) { return x * 20; }
+inline int f16_21(int x) { return x * 21; }
+inline int f16_22(int x) { return x * 22; }
+inline int f16_23(int x) { return x * 23; }
+inline int f16_24(int x) { return x * 24; }
+inline int f16_25(int x) { return x * 25; }
+inline int f16_26(int x) { return x * 26; }
+inline int f16_27(int x) { return x * 27; }
+inline int f16_28(int x) { return x * 28; }
+inline int f16_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1601 */
+#include <vector>
+#include "h3618.h"
+#include "h1750.h"
+#include "h6422.h"
+#include "h6386.h"
+#include "h2141.h"
+#ifdef X
+#include "h1510.h"
+#endif
+struct S1601 { int a; const char *s = "x//y"; };
+inline int f1601_0(int x) { return x * 0; }
+inline int f1601_1(int x) { return x * 1; }
+inline int f1601_2(int x) { return x * 2; }
+inline int f1601_3(int x) { return x * 3; }
+inline int f1601_4(int x) { return x * 4; }
+inline int f1601_5(int x) { return x * 5; }
+inline int f1601_6(int x) { return x * 6; }
+inline int f1601_7(int x) { return x * 7; }
+inline int f1601_8(int x) { return x * 8; }
+inline int f1601_9(int x) { return x * 9; }
+inline int f1601_10(int x) { return x * 10; }
+inline int f1601_11(int x) { return x * 11; }
+inline int f1601_12(int x) { return x * 12; }
+inline int f1601_13(int x) { return x * 13; }
+inline int f1601_14(int x) { return x * 14; }
+inline int f1601_15(int x) { return x * 15; }
+inline int f1601_16(int x) { return x * 16; }
+inline int f1601_17(int x) { return x * 17; }
+inline int f1601_18(int x) { return x * 18; }
+inline int f1601_19(int x) { return x * 19; }
+inline int f1601_20(int x) { return x * 20; }
+inline int f1601_21(int x) { return x * 21; }
+inline int f1601_22(int x) { return x * 22; }
+inline int f1601_23(int x) { return x * 23; }
+inline int f1601_24(int x) { return x * 24; }
+inline int f1601_25(int x) { return x * 25; }
+inline int f1601_26(int x) { return x * 26; }
+inline int f1601_27(int x) { return x * 27; }
+inline int f1601_28(int x) { return x * 28; }
+inline int f1601_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1602 */
+#include <vector>
+#include "h8381.h"
+#include "h6345.h"
+#include "h355.h"
+#include "h5293.h"
+#include "h2477.h"
+#ifdef X
+#include "h6525.h"
+#endif
+struct S1602 { int a; const char *s = "x//y"; };
+inline int f1602_0(int x) { return x * 0; }
+inline int f1602_1(int x) { return x * 1; }
+inline int f1602_2(int x) { return x * 2; }
+inline int f1602_3(int x) { return x * 3; }
+inline int f1602_4(int x) { return x * 4; }
+inline int f1602_5(int x) { return x * 5; }
+inline int f1602_6(int x) { return x * 6; }
+inline int f1602_7(int x) { return x * 7; }
+inline int f1602_8(int x) { return x * 8; }
+inline int f1602_9(int x) { return x * 9; }
+inline int f1602_10(int x) { return x * 10; }
+inline int f1602_11(int x) { return x * 11; }
+inline int f1602_12(int x) { return x * 12; }
+inline int f1602_13(int x) { return x * 13; }
+inline int f1602_14(int x) { return x * 14; }
+inline int f1602_15(int x) { return x * 15; }
+inline int f1602_16(int x) { return x * 16; }
+inline int f1602_17(int x) { return x * 17; }
+inline int f1602_18(int x) { return x * 18; }
+inline int f1602_19(int x) { return x * 19; }
+inline int f1602_20(int x) { return x * 20; }
+inline int f1602_21(int x) { return x * 21; }
+inline int f1602_22(int x) { return x * 22; }
+inline int f1602_23(int x) { return x * 23; }
+inline int f1602_24(int x) { return x * 24; }
+inline int f1602_25(int x) { return x * 25; }
+inline int f1602_26(int x) { return x * 26; }
+inline int f1602_27(int x) { return x * 27; }
+inline int f1602_28(int x) { return x * 28; }
+inline int f1602_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1603 */
+#include <vector>
+#include "h9485.h"
+#include "h3033.h"
+#include "h7988.h"
+#include "h5236.h"
+#include "h4141.h"
+#ifdef X
+#include "h2705.h"
+#endif
+struct S1603 { int a; const char *s = "x//y"; };
+inline int f1603_0(int x) { return x * 0; }
+inline int f1603_1(int x) { return x * 1; }
+inline int f1603_2(int x) { return x * 2; }
+inline int f1603_3(int x) { return x * 3; }
+inline int f1603_4(int x) { return x * 4; }
+inline int f1603_5(int x) { return x * 5; }
+inline int f1603_6(int x) { return x * 6; }
+inline int f1603_7(int x) { return x * 7; }
+inline int f1603_8(int x) { return x * 8; }
+inline int f1603_9(int x) { return x * 9; }
+inline int f1603_10(int x) { return x * 10; }
+inline int f1603_11(int x) { return x * 11; }
+inline int f1603_12(int x) { return x * 12; }
+inline int f1603_13(int x) { return x * 13; }
+inline int f1603_14(int x) { return x * 14; }
+inline int f1603_15(int x) { return x * 15; }
+inline int f1603_16(int x) { return x * 16; }
+inline int f1603_17(int x) { return x * 17; }
+inline int f1603_18(int x) { return x * 18; }
+inline int f1603_19(int x) { return x * 19; }
+inline int f1603_20(int x) { return x * 20; }
+inline int f1603_21(int x) { return x * 21; }
+inline int f1603_22(int x) { return x * 22; }
+inline int f1603_23(int x) { return x * 23; }
+inline int f1603_24(int x) { return x * 24; }
+inline int f1603_25(int x) { return x * 25; }
+inline int f1603_26(int x) { return x * 26; }
+inline int f1603_27(int x) { return x * 27; }
+inline int f1603_28(int x) { return x * 28; }
+inline int f1603_29(int x) { return x * 29; }
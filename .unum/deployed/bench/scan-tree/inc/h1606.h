@@ -0,0 +1,42 @@
+#pragma once
+/* header 1606 */
+#include <vector>
+#include "h9693.h"
+#include "h4300.h"
+#include "h2836.h"
+#include "h1885.h"
+#include "h430.h"
+#ifdef X
+#include "h151.h"
+#endif
+struct S1606 { int a; const char *s = "x//y"; };
+inline int f1606_0(int x) { return x * 0; }
+inline int f1606_1(int x) { return x * 1; }
+inline int f1606_2(int x) { return x * 2; }
+inline int f1606_3(int x) { return x * 3; }
+inline int f1606_4(int x) { return x * 4; }
+inline int f1606_5(int x) { return x * 5; }
+inline int f1606_6(int x) { return x * 6; }
+inline int f1606_7(int x) { return x * 7; }
+inline int f1606_8(int x) { return x * 8; }
+inline int f1606_9(int x) { return x * 9; }
+inline int f1606_10(int x) { return x * 10; }
+inline int f1606_11(int x) { return x * 11; }
+inline int f1606_12(int x) { return x * 12; }
+inline int f1606_13(int x) { return x * 13; }
+inline int f1606_14(int x) { return x * 14; }
+inline int f1606_15(int x) { return x * 15; }
+inline int f1606_16(int x) { return x * 16; }
+inline int f1606_17(int x) { return x * 17; }
+inline int f1606_18(int x) { return x * 18; }
+inline int f1606_19(int x) { return x * 19; }
+inline int f1606_20(int x) { return x * 20; }
+inline int f1606_21(int x) { return x * 21; }
+inline int f1606_22(int x) { return x * 22; }
+inline int f1606_23(int x) { return x * 23; }
+inline int f1606_24(int x) { return x * 24; }
+inline int f1606_25(int x) { return x * 25; }
+inline int f1606_26(int x) { return x * 26; }
+inline int f1606_27(int x) { return x * 27; }
+inline int f1606_28(int x) { return x * 28; }
+inline int f1606_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1607 */
+#include <vector>
+#include "h7755.h"
+#include "h637.h"
+#include "h9958.h"
+#include "h5561.h"
+#include "h3300.h"
+#ifdef X
+#include "h6815.h"
+#endif
+struct S1607 { int a; const char *s = "x//y"; };
+inline int f1607_0(int x) { return x * 0; }
+inline int f1607_1(int x) { return x * 1; }
+inline int f1607_2(int x) { return x * 2; }
+inline int f1607_3(int x) { return x * 3; }
+inline int f1607_4(int x) { return x * 4; }
+inline int f1607_5(int x) { return x * 5; }
+inline int f1607_6(int x) { return x * 6; }
+inline int f1607_7(int x) { return x * 7; }
+inline int f1607_8(int x) { return x * 8; }
+inline int f1607_9(int x) { return x * 9; }
+inline int f1607_10(int x) { return x * 10; }
+inline int f1607_11(int x) { return x * 11; }
+inline int f1607_12(int x) { return x * 12; }
+inline int f1607_13(int x) { return x * 13; }
+inline int f1607_14(int x) { return x * 14; }
+inline int f1607_15(int x) { return x * 15; }
+inline int f1607_16(int x) { return x * 16; }
+inline int f1607_17(int x) { return x * 17; }
+inline int f1607_18(int x) { return x * 18; }
+inline int f1607_19(int x) { return x * 19; }
+inline int f1607_20(int x) { return x * 20; }
+inline int f1607_21(int x) { return x * 21; }
+inline int f1607_22(int x) { return x * 22; }
+inline int f1607_23(int x) { return x * 23; }
+inline int f1607_24(int x) { return x * 24; }
+inline int f1607_25(int x) { return x * 25; }
+inline int f1607_26(int x) { return x * 26; }
+inline int f1607_27(int x) { return x * 27; }
+inline int f1607_28(int x) { return x * 28; }
+inline int f1607_29(int x) { return x * 29; }
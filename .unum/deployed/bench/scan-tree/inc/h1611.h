@@ -0,0 +1,42 @@
+#pragma once
+/* header 1611 */
+#include <vector>
+#include "h4799.h"
+#include "h9890.h"
+#include "h7783.h"
+#include "h8282.h"
+#include "h5195.h"
+#ifdef X
+#include "h8096.h"
+#endif
+struct S1611 { int a; const char *s = "x//y"; };
+inline int f1611_0(int x) { return x * 0; }
+inline int f1611_1(int x) { return x * 1; }
+inline int f1611_2(int x) { return x * 2; }
+inline int f1611_3(int x) { return x * 3; }
+inline int f1611_4(int x) { return x * 4; }
+inline int f1611_5(int x) { return x * 5; }
+inline int f1611_6(int x) { return x * 6; }
+inline int f1611_7(int x) { return x * 7; }
+inline int f1611_8(int x) { return x * 8; }
+inline int f1611_9(int x) { return x * 9; }
+inline int f1611_10(int x) { return x * 10; }
+inline int f1611_11(int x) { return x * 11; }
+inline int f1611_12(int x) { return x * 12; }
+inline int f1611_13(int x) { return x * 13; }
+inline int f1611_14(int x) { return x * 14; }
+inline int f1611_15(int x) { return x * 15; }
+inline int f1611_16(int x) { return x * 16; }
+inline int f1611_17(int x) { return x * 17; }
+inline int f1611_18(int x) { return x * 18; }
+inline int f1611_19(int x) { return x * 19; }
+inline int f1611_20(int x) { return x * 20; }
+inline int f1611_21(int x) { return x * 21; }
+inline int f1611_22(int x) { return x * 22; }
+inline int f1611_23(int x) { return x * 23; }
+inline int f1611_24(int x) { return x * 24; }
+inline int f1611_25(int x) { return x * 25; }
+inline int f1611_26(int x) { return x * 26; }
+inline int f1611_27(int x) { return x * 27; }
+inline int f1611_28(int x) { return x * 28; }
+inline int f1611_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1612 */
+#include <vector>
+#include "h7493.h"
+#include "h5758.h"
+#include "h1610.h"
+#include "h3708.h"
+#include "h7870.h"
+#ifdef X
+#include "h3109.h"
+#endif
+struct S1612 { int a; const char *s = "x//y"; };
+inline int f1612_0(int x) { return x * 0; }
+inline int f1612_1(int x) { return x * 1; }
+inline int f1612_2(int x) { return x * 2; }
+inline int f1612_3(int x) { return x * 3; }
+inline int f1612_4(int x) { return x * 4; }
+inline int f1612_5(int x) { return x * 5; }
+inline int f1612_6(int x) { return x * 6; }
+inline int f1612_7(int x) { return x * 7; }
+inline int f1612_8(int x) { return x * 8; }
+inline int f1612_9(int x) { return x * 9; }
+inline int f1612_10(int x) { return x * 10; }
+inline int f1612_11(int x) { return x * 11; }
+inline int f1612_12(int x) { return x * 12; }
+inline int f1612_13(int x) { return x * 13; }
+inline int f1612_14(int x) { return x * 14; }
+inline int f1612_15(int x) { return x * 15; }
+inline int f1612_16(int x) { return x * 16; }
+inline int f1612_17(int x) { return x * 17; }
+inline int f1612_18(int x) { return x * 18; }
+inline int f1612_19(int x) { return x * 19; }
+inline int f1612_20(int x) { return x * 20; }
+inline int f1612_21(int x) { return x * 21; }
+inline int f1612_22(int x) { return x * 22; }
+inline int f1612_23(int x) { return x * 23; }
+inline int f1612_24(int x) { return x * 24; }
+inline int f1612_25(int x) { return x * 25; }
+inline int f1612_26(int x) { return x * 26; }
+inline int f1612_27(int x) { return x * 27; }
+inline int f1612_28(int x) { return x * 28; }
+inline int f1612_29(int x) { return x * 29; }
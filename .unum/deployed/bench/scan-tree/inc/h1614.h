@@ -0,0 +1,42 @@
+#pragma once
+/* header 1614 */
+#include <vector>
+#include "h9141.h"
+#include "h798.h"
+#include "h8889.h"
+#include "h3629.h"
+#include "h7198.h"
+#ifdef X
+#include "h3307.h"
+#endif
+struct S1614 { int a; const char *s = "x//y"; };
+inline int f1614_0(int x) { return x * 0; }
+inline int f1614_1(int x) { return x * 1; }
+inline int f1614_2(int x) { return x * 2; }
+inline int f1614_3(int x) { return x * 3; }
+inline int f1614_4(int x) { return x * 4; }
+inline int f1614_5(int x) { return x * 5; }
+inline int f1614_6(int x) { return x * 6; }
+inline int f1614_7(int x) { return x * 7; }
+inline int f1614_8(int x) { return x * 8; }
+inline int f1614_9(int x) { return x * 9; }
+inline int f1614_10(int x) { return x * 10; }
+inline int f1614_11(int x) { return x * 11; }
+inline int f1614_12(int x) { return x * 12; }
+inline int f1614_13(int x) { return x * 13; }
+inline int f1614_14(int x) { return x * 14; }
+inline int f1614_15(int x) { return x * 15; }
+inline int f1614_16(int x) { return x * 16; }
+inline int f1614_17(int x) { return x * 17; }
+inline int f1614_18(int x) { return x * 18; }
+inline int f1614_19(int x) { return x * 19; }
+inline int f1614_20(int x) { return x * 20; }
+inline int f1614_21(int x) { return x * 21; }
+inline int f1614_22(int x) { return x * 22; }
+inline int f1614_23(int x) { return x * 23; }
+inline int f1614_24(int x) { return x * 24; }
+inline int f1614_25(int x) { return x * 25; }
+inline int f1614_26(int x) { return x * 26; }
+inline int f1614_27(int x) { return x * 27; }
+inline int f1614_28(int x) { return x * 28; }
+inline int f1614_29(int x) { return x * 29; }
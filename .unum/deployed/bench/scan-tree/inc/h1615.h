@@ -0,0 +1,42 @@
+#pragma once
+/* header 1615 */
+#include <vector>
+#include "h6045.h"
+#include "h7522.h"
+#include "h4871.h"
+#include "h1969.h"
+#include "h511.h"
+#ifdef X
+#include "h2731.h"
+#endif
+struct S1615 { int a; const char *s = "x//y"; };
+inline int f1615_0(int x) { return x * 0; }
+inline int f1615_1(int x) { return x * 1; }
+inline int f1615_2(int x) { return x * 2; }
+inline int f1615_3(int x) { return x * 3; }
+inline int f1615_4(int x) { return x * 4; }
+inline int f1615_5(int x) { return x * 5; }
+inline int f1615_6(int x) { return x * 6; }
+inline int f1615_7(int x) { return x * 7; }
+inline int f1615_8(int x) { return x * 8; }
+inline int f1615_9(int x) { return x * 9; }
+inline int f1615_10(int x) { return x * 10; }
+inline int f1615_11(int x) { return x * 11; }
+inline int f1615_12(int x) { return x * 12; }
+inline int f1615_13(int x) { return x * 13; }
+inline int f1615_14(int x) { return x * 14; }
+inline int f1615_15(int x) { return x * 15; }
+inline int f1615_16(int x) { return x * 16; }
+inline int f1615_17(int x) { return x * 17; }
+inline int f1615_18(int x) { return x * 18; }
+inline int f1615_19(int x) { return x * 19; }
+inline int f1615_20(int x) { return x * 20; }
+inline int f1615_21(int x) { return x * 21; }
+inline int f1615_22(int x) { return x * 22; }
+inline int f1615_23(int x) { return x * 23; }
+inline int f1615_24(int x) { return x * 24; }
+inline int f1615_25(int x) { return x * 25; }
+inline int f1615_26(int x) { return x * 26; }
+inline int f1615_27(int x) { return x * 27; }
+inline int f1615_28(int x) { return x * 28; }
+inline int f1615_29(int x) { return x * 29; }
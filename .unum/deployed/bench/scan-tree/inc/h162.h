@@ -0,0 +1,42 @@
+#pragma once
+/* header 162 */
+#include <vector>
+#include "h7769.h"
+#include "h1046.h"
+#include "h6101.h"
+#include "h5979.h"
+#include "h2586.h"
+#ifdef X
+#include "h176.h"
+#endif
+struct S162 { int a; const char *s = "x//y"; };
+inline int f162_0(int x) { return x * 0; }
+inline int f162_1(int x) { return x * 1; }
+inline int f162_2(int x) { return x * 2; }
+inline int f162_3(int x) { return x * 3; }
+inline int f162_4(int x) { return x * 4; }
+inline int f162_5(int x) { return x * 5; }
+inline int f162_6(int x) { return x * 6; }
+inline int f162_7(int x) { return x * 7; }
+inline int f162_8(int x) { return x * 8; }
+inline int f162_9(int x) { return x * 9; }
+inline int f162_10(int x) { return x * 10; }
+inline int f162_11(int x) { return x * 11; }
+inline int f162_12(int x) { return x * 12; }
+inline int f162_13(int x) { return x * 13; }
+inline int f162_14(int x) { return x * 14; }
+inline int f162_15(int x) { return x * 15; }
+inline int f162_16(int x) { return x * 16; }
+inline int f162_17(int x) { return x * 17; }
+inline int f162_18(int x) { return x * 18; }
+inline int f162_19(int x) { return x * 19; }
+inline int f162_20(int x) { return x * 20; }
+inline int f162_21(int x) { return x * 21; }
+inline int f162_22(int x) { return x * 22; }
+inline int f162_23(int x) { return x * 23; }
+inline int f162_24(int x) { return x * 24; }
+inline int f162_25(int x) { return x * 25; }
+inline int f162_26(int x) { return x * 26; }
+inline int f162_27(int x) { return x * 27; }
+inline int f162_28(int x) { return x * 28; }
+inline int f162_29(int x) { return x * 29; }
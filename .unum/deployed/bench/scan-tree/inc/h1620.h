@@ -0,0 +1,42 @@
+#pragma once
+/* header 1620 */
+#include <vector>
+#include "h2928.h"
+#include "h8167.h"
+#include "h8993.h"
+#include "h4927.h"
+#include "h7930.h"
+#ifdef X
+#include "h7206.h"
+#endif
+struct S1620 { int a; const char *s = "x//y"; };
+inline int f1620_0(int x) { return x * 0; }
+inline int f1620_1(int x) { return x * 1; }
+inline int f1620_2(int x) { return x * 2; }
+inline int f1620_3(int x) { return x * 3; }
+inline int f1620_4(int x) { return x * 4; }
+inline int f1620_5(int x) { return x * 5; }
+inline int f1620_6(int x) { return x * 6; }
+inline int f1620_7(int x) { return x * 7; }
+inline int f1620_8(int x) { return x * 8; }
+inline int f1620_9(int x) { return x * 9; }
+inline int f1620_10(int x) { return x * 10; }
+inline int f1620_11(int x) { return x * 11; }
+inline int f1620_12(int x) { return x * 12; }
+inline int f1620_13(int x) { return x * 13; }
+inline int f1620_14(int x) { return x * 14; }
+inline int f1620_15(int x) { return x * 15; }
+inline int f1620_16(int x) { return x * 16; }
+inline int f1620_17(int x) { return x * 17; }
+inline int f1620_18(int x) { return x * 18; }
+inline int f1620_19(int x) { return x * 19; }
+inline int f1620_20(int x) { return x * 20; }
+inline int f1620_21(int x) { return x * 21; }
+inline int f1620_22(int x) { return x * 22; }
+inline int f1620_23(int x) { return x * 23; }
+inline int f1620_24(int x) { return x * 24; }
+inline int f1620_25(int x) { return x * 25; }
+inline int f1620_26(int x) { return x * 26; }
+inline int f1620_27(int x) { return x * 27; }
+inline int f1620_28(int x) { return x * 28; }
+inline int f1620_29(int x) { return x * 29; }
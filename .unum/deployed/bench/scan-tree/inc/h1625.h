@@ -0,0 +1,42 @@
+#pragma once
+/* header 1625 */
+#include <vector>
+#include "h7845.h"
+#include "h3931.h"
+#include "h6015.h"
+#include "h2923.h"
+#include "h8224.h"
+#ifdef X
+#include "h237.h"
+#endif
+struct S1625 { int a; const char *s = "x//y"; };
+inline int f1625_0(int x) { return x * 0; }
+inline int f1625_1(int x) { return x * 1; }
+inline int f1625_2(int x) { return x * 2; }
+inline int f1625_3(int x) { return x * 3; }
+inline int f1625_4(int x) { return x * 4; }
+inline int f1625_5(int x) { return x * 5; }
+inline int f1625_6(int x) { return x * 6; }
+inline int f1625_7(int x) { return x * 7; }
+inline int f1625_8(int x) { return x * 8; }
+inline int f1625_9(int x) { return x * 9; }
+inline int f1625_10(int x) { return x * 10; }
+inline int f1625_11(int x) { return x * 11; }
+inline int f1625_12(int x) { return x * 12; }
+inline int f1625_13(int x) { return x * 13; }
+inline int f1625_14(int x) { return x * 14; }
+inline int f1625_15(int x) { return x * 15; }
+inline int f1625_16(int x) { return x * 16; }
+inline int f1625_17(int x) { return x * 17; }
+inline int f1625_18(int x) { return x * 18; }
+inline int f1625_19(int x) { return x * 19; }
+inline int f1625_20(int x) { return x * 20; }
+inline int f1625_21(int x) { return x * 21; }
+inline int f1625_22(int x) { return x * 22; }
+inline int f1625_23(int x) { return x * 23; }
+inline int f1625_24(int x) { return x * 24; }
+inline int f1625_25(int x) { return x * 25; }
+inline int f1625_26(int x) { return x * 26; }
+inline int f1625_27(int x) { return x * 27; }
+inline int f1625_28(int x) { return x * 28; }
+inline int f1625_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1627 */
+#include <vector>
+#include "h2175.h"
+#include "h283.h"
+#include "h498.h"
+#include "h3084.h"
+#include "h3920.h"
+#ifdef X
+#include "h2700.h"
+#endif
+struct S1627 { int a; const char *s = "x//y"; };
+inline int f1627_0(int x) { return x * 0; }
+inline int f1627_1(int x) { return x * 1; }
+inline int f1627_2(int x) { return x * 2; }
+inline int f1627_3(int x) { return x * 3; }
+inline int f1627_4(int x) { return x * 4; }
+inline int f1627_5(int x) { return x * 5; }
+inline int f1627_6(int x) { return x * 6; }
+inline int f1627_7(int x) { return x * 7; }
+inline int f1627_8(int x) { return x * 8; }
+inline int f1627_9(int x) { return x * 9; }
+inline int f1627_10(int x) { return x * 10; }
+inline int f1627_11(int x) { return x * 11; }
+inline int f1627_12(int x) { return x * 12; }
+inline int f1627_13(int x) { return x * 13; }
+inline int f1627_14(int x) { return x * 14; }
+inline int f1627_15(int x) { return x * 15; }
+inline int f1627_16(int x) { return x * 16; }
+inline int f1627_17(int x) { return x * 17; }
+inline int f1627_18(int x) { return x * 18; }
+inline int f1627_19(int x) { return x * 19; }
+inline int f1627_20(int x) { return x * 20; }
+inline int f1627_21(int x) { return x * 21; }
+inline int f1627_22(int x) { return x * 22; }
+inline int f1627_23(int x) { return x * 23; }
+inline int f1627_24(int x) { return x * 24; }
+inline int f1627_25(int x) { return x * 25; }
+inline int f1627_26(int x) { return x * 26; }
+inline int f1627_27(int x) { return x * 27; }
+inline int f1627_28(int x) { return x * 28; }
+inline int f1627_29(int x) { return x * 29; }
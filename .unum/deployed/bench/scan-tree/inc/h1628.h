@@ -0,0 +1,42 @@
+#pragma once
+/* header 1628 */
+#include <vector>
+#include "h2676.h"
+#include "h6071.h"
+#include "h2565.h"
+#include "h4694.h"
+#include "h7696.h"
+#ifdef X
+#include "h9215.h"
+#endif
+struct S1628 { int a; const char *s = "x//y"; };
+inline int f1628_0(int x) { return x * 0; }
+inline int f1628_1(int x) { return x * 1; }
+inline int f1628_2(int x) { return x * 2; }
+inline int f1628_3(int x) { return x * 3; }
+inline int f1628_4(int x) { return x * 4; }
+inline int f1628_5(int x) { return x * 5; }
+inline int f1628_6(int x) { return x * 6; }
+inline int f1628_7(int x) { return x * 7; }
+inline int f1628_8(int x) { return x * 8; }
+inline int f1628_9(int x) { return x * 9; }
+inline int f1628_10(int x) { return x * 10; }
+inline int f1628_11(int x) { return x * 11; }
+inline int f1628_12(int x) { return x * 12; }
+inline int f1628_13(int x) { return x * 13; }
+inline int f1628_14(int x) { return x * 14; }
+inline int f1628_15(int x) { return x * 15; }
+inline int f1628_16(int x) { return x * 16; }
+inline int f1628_17(int x) { return x * 17; }
+inline int f1628_18(int x) { return x * 18; }
+inline int f1628_19(int x) { return x * 19; }
+inline int f1628_20(int x) { return x * 20; }
+inline int f1628_21(int x) { return x * 21; }
+inline int f1628_22(int x) { return x * 22; }
+inline int f1628_23(int x) { return x * 23; }
+inline int f1628_24(int x) { return x * 24; }
+inline int f1628_25(int x) { return x * 25; }
+inline int f1628_26(int x) { return x * 26; }
+inline int f1628_27(int x) { return x * 27; }
+inline int f1628_28(int x) { return x * 28; }
+inline int f1628_29(int x) { return x * 29; }
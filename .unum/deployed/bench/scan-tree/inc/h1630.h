@@ -0,0 +1,42 @@
+#pragma once
+/* header 1630 */
+#include <vector>
+#include "h1262.h"
+#include "h8527.h"
+#include "h3685.h"
+#include "h9385.h"
+#include "h3088.h"
+#ifdef X
+#include "h543.h"
+#endif
+struct S1630 { int a; const char *s = "x//y"; };
+inline int f1630_0(int x) { return x * 0; }
+inline int f1630_1(int x) { return x * 1; }
+inline int f1630_2(int x) { return x * 2; }
+inline int f1630_3(int x) { return x * 3; }
+inline int f1630_4(int x) { return x * 4; }
+inline int f1630_5(int x) { return x * 5; }
+inline int f1630_6(int x) { return x * 6; }
+inline int f1630_7(int x) { return x * 7; }
+inline int f1630_8(int x) { return x * 8; }
+inline int f1630_9(int x) { return x * 9; }
+inline int f1630_10(int x) { return x * 10; }
+inline int f1630_11(int x) { return x * 11; }
+inline int f1630_12(int x) { return x * 12; }
+inline int f1630_13(int x) { return x * 13; }
+inline int f1630_14(int x) { return x * 14; }
+inline int f1630_15(int x) { return x * 15; }
+inline int f1630_16(int x) { return x * 16; }
+inline int f1630_17(int x) { return x * 17; }
+inline int f1630_18(int x) { return x * 18; }
+inline int f1630_19(int x) { return x * 19; }
+inline int f1630_20(int x) { return x * 20; }
+inline int f1630_21(int x) { return x * 21; }
+inline int f1630_22(int x) { return x * 22; }
+inline int f1630_23(int x) { return x * 23; }
+inline int f1630_24(int x) { return x * 24; }
+inline int f1630_25(int x) { return x * 25; }
+inline int f1630_26(int x) { return x * 26; }
+inline int f1630_27(int x) { return x * 27; }
+inline int f1630_28(int x) { return x * 28; }
+inline int f1630_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1631 */
+#include <vector>
+#include "h6543.h"
+#include "h6060.h"
+#include "h8867.h"
+#include "h9955.h"
+#include "h2135.h"
+#ifdef X
+#include "h2076.h"
+#endif
+struct S1631 { int a; const char *s = "x//y"; };
+inline int f1631_0(int x) { return x * 0; }
+inline int f1631_1(int x) { return x * 1; }
+inline int f1631_2(int x) { return x * 2; }
+inline int f1631_3(int x) { return x * 3; }
+inline int f1631_4(int x) { return x * 4; }
+inline int f1631_5(int x) { return x * 5; }
+inline int f1631_6(int x) { return x * 6; }
+inline int f1631_7(int x) { return x * 7; }
+inline int f1631_8(int x) { return x * 8; }
+inline int f1631_9(int x) { return x * 9; }
+inline int f1631_10(int x) { return x * 10; }
+inline int f1631_11(int x) { return x * 11; }
+inline int f1631_12(int x) { return x * 12; }
+inline int f1631_13(int x) { return x * 13; }
+inline int f1631_14(int x) { return x * 14; }
+inline int f1631_15(int x) { return x * 15; }
+inline int f1631_16(int x) { return x * 16; }
+inline int f1631_17(int x) { return x * 17; }
+inline int f1631_18(int x) { return x * 18; }
+inline int f1631_19(int x) { return x * 19; }
+inline int f1631_20(int x) { return x * 20; }
+inline int f1631_21(int x) { return x * 21; }
+inline int f1631_22(int x) { return x * 22; }
+inline int f1631_23(int x) { return x * 23; }
+inline int f1631_24(int x) { return x * 24; }
+inline int f1631_25(int x) { return x * 25; }
+inline int f1631_26(int x) { return x * 26; }
+inline int f1631_27(int x) { return x * 27; }
+inline int f1631_28(int x) { return x * 28; }
+inline int f1631_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1633 */
+#include <vector>
+#include "h5716.h"
+#include "h9135.h"
+#include "h9382.h"
+#include "h7603.h"
+#include "h4428.h"
+#ifdef X
+#include "h2353.h"
+#endif
+struct S1633 { int a; const char *s = "x//y"; };
+inline int f1633_0(int x) { return x * 0; }
+inline int f1633_1(int x) { return x * 1; }
+inline int f1633_2(int x) { return x * 2; }
+inline int f1633_3(int x) { return x * 3; }
+inline int f1633_4(int x) { return x * 4; }
+inline int f1633_5(int x) { return x * 5; }
+inline int f1633_6(int x) { return x * 6; }
+inline int f1633_7(int x) { return x * 7; }
+inline int f1633_8(int x) { return x * 8; }
+inline int f1633_9(int x) { return x * 9; }
+inline int f1633_10(int x) { return x * 10; }
+inline int f1633_11(int x) { return x * 11; }
+inline int f1633_12(int x) { return x * 12; }
+inline int f1633_13(int x) { return x * 13; }
+inline int f1633_14(int x) { return x * 14; }
+inline int f1633_15(int x) { return x * 15; }
+inline int f1633_16(int x) { return x * 16; }
+inline int f1633_17(int x) { return x * 17; }
+inline int f1633_18(int x) { return x * 18; }
+inline int f1633_19(int x) { return x * 19; }
+inline int f1633_20(int x) { return x * 20; }
+inline int f1633_21(int x) { return x * 21; }
+inline int f1633_22(int x) { return x * 22; }
+inline int f1633_23(int x) { return x * 23; }
+inline int f1633_24(int x) { return x * 24; }
+inline int f1633_25(int x) { return x * 25; }
+inline int f1633_26(int x) { return x * 26; }
+inline int f1633_27(int x) { return x * 27; }
+inline int f1633_28(int x) { return x * 28; }
+inline int f1633_29(int x) { return x * 29; }
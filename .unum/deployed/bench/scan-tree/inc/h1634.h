@@ -0,0 +1,42 @@
+#pragma once
+/* header 1634 */
+#include <vector>
+#include "h2077.h"
+#include "h283.h"
+#include "h929.h"
+#include "h1192.h"
+#include "h6276.h"
+#ifdef X
+#include "h4702.h"
+#endif
+struct S1634 { int a; const char *s = "x//y"; };
+inline int f1634_0(int x) { return x * 0; }
+inline int f1634_1(int x) { return x * 1; }
+inline int f1634_2(int x) { return x * 2; }
+inline int f1634_3(int x) { return x * 3; }
+inline int f1634_4(int x) { return x * 4; }
+inline int f1634_5(int x) { return x * 5; }
+inline int f1634_6(int x) { return x * 6; }
+inline int f1634_7(int x) { return x * 7; }
+inline int f1634_8(int x) { return x * 8; }
+inline int f1634_9(int x) { return x * 9; }
+inline int f1634_10(int x) { return x * 10; }
+inline int f1634_11(int x) { return x * 11; }
+inline int f1634_12(int x) { return x * 12; }
+inline int f1634_13(int x) { return x * 13; }
+inline int f1634_14(int x) { return x * 14; }
+inline int f1634_15(int x) { return x * 15; }
+inline int f1634_16(int x) { return x * 16; }
+inline int f1634_17(int x) { return x * 17; }
+inline int f1634_18(int x) { return x * 18; }
+inline int f1634_19(int x) { return x * 19; }
+inline int f1634_20(int x) { return x * 20; }
+inline int f1634_21(int x) { return x * 21; }
+inline int f1634_22(int x) { return x * 22; }
+inline int f1634_23(int x) { return x * 23; }
+inline int f1634_24(int x) { return x * 24; }
+inline int f1634_25(int x) { return x * 25; }
+inline int f1634_26(int x) { return x * 26; }
+inline int f1634_27(int x) { return x * 27; }
+inline int f1634_28(int x) { return x * 28; }
+inline int f1634_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1635 */
+#include <vector>
+#include "h3864.h"
+#include "h9730.h"
+#include "h677.h"
+#include "h2188.h"
+#include "h1248.h"
+#ifdef X
+#include "h1735.h"
+#endif
+struct S1635 { int a; const char *s = "x//y"; };
+inline int f1635_0(int x) { return x * 0; }
+inline int f1635_1(int x) { return x * 1; }
+inline int f1635_2(int x) { return x * 2; }
+inline int f1635_3(int x) { return x * 3; }
+inline int f1635_4(int x) { return x * 4; }
+inline int f1635_5(int x) { return x * 5; }
+inline int f1635_6(int x) { return x * 6; }
+inline int f1635_7(int x) { return x * 7; }
+inline int f1635_8(int x) { return x * 8; }
+inline int f1635_9(int x) { return x * 9; }
+inline int f1635_10(int x) { return x * 10; }
+inline int f1635_11(int x) { return x * 11; }
+inline int f1635_12(int x) { return x * 12; }
+inline int f1635_13(int x) { return x * 13; }
+inline int f1635_14(int x) { return x * 14; }
+inline int f1635_15(int x) { return x * 15; }
+inline int f1635_16(int x) { return x * 16; }
+inline int f1635_17(int x) { return x * 17; }
+inline int f1635_18(int x) { return x * 18; }
+inline int f1635_19(int x) { return x * 19; }
+inline int f1635_20(int x) { return x * 20; }
+inline int f1635_21(int x) { return x * 21; }
+inline int f1635_22(int x) { return x * 22; }
+inline int f1635_23(int x) { return x * 23; }
+inline int f1635_24(int x) { return x * 24; }
+inline int f1635_25(int x) { return x * 25; }
+inline int f1635_26(int x) { return x * 26; }
+inline int f1635_27(int x) { return x * 27; }
+inline int f1635_28(int x) { return x * 28; }
+inline int f1635_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1636 */
+#include <vector>
+#include "h8773.h"
+#include "h3862.h"
+#include "h5668.h"
+#include "h6725.h"
+#include "h5684.h"
+#ifdef X
+#include "h5721.h"
+#endif
+struct S1636 { int a; const char *s = "x//y"; };
+inline int f1636_0(int x) { return x * 0; }
+inline int f1636_1(int x) { return x * 1; }
+inline int f1636_2(int x) { return x * 2; }
+inline int f1636_3(int x) { return x * 3; }
+inline int f1636_4(int x) { return x * 4; }
+inline int f1636_5(int x) { return x * 5; }
+inline int f1636_6(int x) { return x * 6; }
+inline int f1636_7(int x) { return x * 7; }
+inline int f1636_8(int x) { return x * 8; }
+inline int f1636_9(int x) { return x * 9; }
+inline int f1636_10(int x) { return x * 10; }
+inline int f1636_11(int x) { return x * 11; }
+inline int f1636_12(int x) { return x * 12; }
+inline int f1636_13(int x) { return x * 13; }
+inline int f1636_14(int x) { return x * 14; }
+inline int f1636_15(int x) { return x * 15; }
+inline int f1636_16(int x) { return x * 16; }
+inline int f1636_17(int x) { return x * 17; }
+inline int f1636_18(int x) { return x * 18; }
+inline int f1636_19(int x) { return x * 19; }
+inline int f1636_20(int x) { return x * 20; }
+inline int f1636_21(int x) { return x * 21; }
+inline int f1636_22(int x) { return x * 22; }
+inline int f1636_23(int x) { return x * 23; }
+inline int f1636_24(int x) { return x * 24; }
+inline int f1636_25(int x) { return x * 25; }
+inline int f1636_26(int x) { return x * 26; }
+inline int f1636_27(int x) { return x * 27; }
+inline int f1636_28(int x) { return x * 28; }
+inline int f1636_29(int x) { return x * 29; }
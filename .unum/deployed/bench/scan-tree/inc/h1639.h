@@ -0,0 +1,42 @@
+#pragma once
+/* header 1639 */
+#include <vector>
+#include "h5239.h"
+#include "h4178.h"
+#include "h9429.h"
+#include "h1467.h"
+#include "h1614.h"
+#ifdef X
+#include "h1597.h"
+#endif
+struct S1639 { int a; const char *s = "x//y"; };
+inline int f1639_0(int x) { return x * 0; }
+inline int f1639_1(int x) { return x * 1; }
+inline int f1639_2(int x) { return x * 2; }
+inline int f1639_3(int x) { return x * 3; }
+inline int f1639_4(int x) { return x * 4; }
+inline int f1639_5(int x) { return x * 5; }
+inline int f1639_6(int x) { return x * 6; }
+inline int f1639_7(int x) { return x * 7; }
+inline int f1639_8(int x) { return x * 8; }
+inline int f1639_9(int x) { return x * 9; }
+inline int f1639_10(int x) { return x * 10; }
+inline int f1639_11(int x) { return x * 11; }
+inline int f1639_12(int x) { return x * 12; }
+inline int f1639_13(int x) { return x * 13; }
+inline int f1639_14(int x) { return x * 14; }
+inline int f1639_15(int x) { return x * 15; }
+inline int f1639_16(int x) { return x * 16; }
+inline int f1639_17(int x) { return x * 17; }
+inline int f1639_18(int x) { return x * 18; }
+inline int f1639_19(int x) { return x * 19; }
+inline int f1639_20(int x) { return x * 20; }
+inline int f1639_21(int x) { return x * 21; }
+inline int f1639_22(int x) { return x * 22; }
+inline int f1639_23(int x) { return x * 23; }
+inline int f1639_24(int x) { return x * 24; }
+inline int f1639_25(int x) { return x * 25; }
+inline int f1639_26(int x) { return x * 26; }
+inline int f1639_27(int x) { return x * 27; }
+inline int f1639_28(int x) { return x * 28; }
+inline int f1639_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1640 */
+#include <vector>
+#include "h9620.h"
+#include "h3267.h"
+#include "h3075.h"
+#include "h2904.h"
+#include "h1474.h"
+#ifdef X
+#include "h4005.h"
+#endif
+struct S1640 { int a; const char *s = "x//y"; };
+inline int f1640_0(int x) { return x * 0; }
+inline int f1640_1(int x) { return x * 1; }
+inline int f1640_2(int x) { return x * 2; }
+inline int f1640_3(int x) { return x * 3; }
+inline int f1640_4(int x) { return x * 4; }
+inline int f1640_5(int x) { return x * 5; }
+inline int f1640_6(int x) { return x * 6; }
+inline int f1640_7(int x) { return x * 7; }
+inline int f1640_8(int x) { return x * 8; }
+inline int f1640_9(int x) { return x * 9; }
+inline int f1640_10(int x) { return x * 10; }
+inline int f1640_11(int x) { return x * 11; }
+inline int f1640_12(int x) { return x * 12; }
+inline int f1640_13(int x) { return x * 13; }
+inline int f1640_14(int x) { return x * 14; }
+inline int f1640_15(int x) { return x * 15; }
+inline int f1640_16(int x) { return x * 16; }
+inline int f1640_17(int x) { return x * 17; }
+inline int f1640_18(int x) { return x * 18; }
+inline int f1640_19(int x) { return x * 19; }
+inline int f1640_20(int x) { return x * 20; }
+inline int f1640_21(int x) { return x * 21; }
+inline int f1640_22(int x) { return x * 22; }
+inline int f1640_23(int x) { return x * 23; }
+inline int f1640_24(int x) { return x * 24; }
+inline int f1640_25(int x) { return x * 25; }
+inline int f1640_26(int x) { return x * 26; }
+inline int f1640_27(int x) { return x * 27; }
+inline int f1640_28(int x) { return x * 28; }
+inline int f1640_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1642 */
+#include <vector>
+#include "h3270.h"
+#include "h9180.h"
+#include "h860.h"
+#include "h988.h"
+#include "h7537.h"
+#ifdef X
+#include "h9708.h"
+#endif
+struct S1642 { int a; const char *s = "x//y"; };
+inline int f1642_0(int x) { return x * 0; }
+inline int f1642_1(int x) { return x * 1; }
+inline int f1642_2(int x) { return x * 2; }
+inline int f1642_3(int x) { return x * 3; }
+inline int f1642_4(int x) { return x * 4; }
+inline int f1642_5(int x) { return x * 5; }
+inline int f1642_6(int x) { return x * 6; }
+inline int f1642_7(int x) { return x * 7; }
+inline int f1642_8(int x) { return x * 8; }
+inline int f1642_9(int x) { return x * 9; }
+inline int f1642_10(int x) { return x * 10; }
+inline int f1642_11(int x) { return x * 11; }
+inline int f1642_12(int x) { return x * 12; }
+inline int f1642_13(int x) { return x * 13; }
+inline int f1642_14(int x) { return x * 14; }
+inline int f1642_15(int x) { return x * 15; }
+inline int f1642_16(int x) { return x * 16; }
+inline int f1642_17(int x) { return x * 17; }
+inline int f1642_18(int x) { return x * 18; }
+inline int f1642_19(int x) { return x * 19; }
+inline int f1642_20(int x) { return x * 20; }
+inline int f1642_21(int x) { return x * 21; }
+inline int f1642_22(int x) { return x * 22; }
+inline int f1642_23(int x) { return x * 23; }
+inline int f1642_24(int x) { return x * 24; }
+inline int f1642_25(int x) { return x * 25; }
+inline int f1642_26(int x) { return x * 26; }
+inline int f1642_27(int x) { return x * 27; }
+inline int f1642_28(int x) { return x * 28; }
+inline int f1642_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1643 */
+#include <vector>
+#include "h7949.h"
+#include "h2287.h"
+#include "h6577.h"
+#include "h1997.h"
+#include "h486.h"
+#ifdef X
+#include "h4124.h"
+#endif
+struct S1643 { int a; const char *s = "x//y"; };
+inline int f1643_0(int x) { return x * 0; }
+inline int f1643_1(int x) { return x * 1; }
+inline int f1643_2(int x) { return x * 2; }
+inline int f1643_3(int x) { return x * 3; }
+inline int f1643_4(int x) { return x * 4; }
+inline int f1643_5(int x) { return x * 5; }
+inline int f1643_6(int x) { return x * 6; }
+inline int f1643_7(int x) { return x * 7; }
+inline int f1643_8(int x) { return x * 8; }
+inline int f1643_9(int x) { return x * 9; }
+inline int f1643_10(int x) { return x * 10; }
+inline int f1643_11(int x) { return x * 11; }
+inline int f1643_12(int x) { return x * 12; }
+inline int f1643_13(int x) { return x * 13; }
+inline int f1643_14(int x) { return x * 14; }
+inline int f1643_15(int x) { return x * 15; }
+inline int f1643_16(int x) { return x * 16; }
+inline int f1643_17(int x) { return x * 17; }
+inline int f1643_18(int x) { return x * 18; }
+inline int f1643_19(int x) { return x * 19; }
+inline int f1643_20(int x) { return x * 20; }
+inline int f1643_21(int x) { return x * 21; }
+inline int f1643_22(int x) { return x * 22; }
+inline int f1643_23(int x) { return x * 23; }
+inline int f1643_24(int x) { return x * 24; }
+inline int f1643_25(int x) { return x * 25; }
+inline int f1643_26(int x) { return x * 26; }
+inline int f1643_27(int x) { return x * 27; }
+inline int f1643_28(int x) { return x * 28; }
+inline int f1643_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1645 */
+#include <vector>
+#include "h822.h"
+#include "h911.h"
+#include "h8625.h"
+#include "h3781.h"
+#include "h2425.h"
+#ifdef X
+#include "h8264.h"
+#endif
+struct S1645 { int a; const char *s = "x//y"; };
+inline int f1645_0(int x) { return x * 0; }
+inline int f1645_1(int x) { return x * 1; }
+inline int f1645_2(int x) { return x * 2; }
+inline int f1645_3(int x) { return x * 3; }
+inline int f1645_4(int x) { return x * 4; }
+inline int f1645_5(int x) { return x * 5; }
+inline int f1645_6(int x) { return x * 6; }
+inline int f1645_7(int x) { return x * 7; }
+inline int f1645_8(int x) { return x * 8; }
+inline int f1645_9(int x) { return x * 9; }
+inline int f1645_10(int x) { return x * 10; }
+inline int f1645_11(int x) { return x * 11; }
+inline int f1645_12(int x) { return x * 12; }
+inline int f1645_13(int x) { return x * 13; }
+inline int f1645_14(int x) { return x * 14; }
+inline int f1645_15(int x) { return x * 15; }
+inline int f1645_16(int x) { return x * 16; }
+inline int f1645_17(int x) { return x * 17; }
+inline int f1645_18(int x) { return x * 18; }
+inline int f1645_19(int x) { return x * 19; }
+inline int f1645_20(int x) { return x * 20; }
+inline int f1645_21(int x) { return x * 21; }
+inline int f1645_22(int x) { return x * 22; }
+inline int f1645_23(int x) { return x * 23; }
+inline int f1645_24(int x) { return x * 24; }
+inline int f1645_25(int x) { return x * 25; }
+inline int f1645_26(int x) { return x * 26; }
+inline int f1645_27(int x) { return x * 27; }
+inline int f1645_28(int x) { return x * 28; }
+inline int f1645_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1646 */
+#include <vector>
+#include "h3823.h"
+#include "h5045.h"
+#include "h2696.h"
+#include "h5031.h"
+#include "h9562.h"
+#ifdef X
+#include "h5309.h"
+#endif
+struct S1646 { int a; const char *s = "x//y"; };
+inline int f1646_0(int x) { return x * 0; }
+inline int f1646_1(int x) { return x * 1; }
+inline int f1646_2(int x) { return x * 2; }
+inline int f1646_3(int x) { return x * 3; }
+inline int f1646_4(int x) { return x * 4; }
+inline int f1646_5(int x) { return x * 5; }
+inline int f1646_6(int x) { return x * 6; }
+inline int f1646_7(int x) { return x * 7; }
+inline int f1646_8(int x) { return x * 8; }
+inline int f1646_9(int x) { return x * 9; }
+inline int f1646_10(int x) { return x * 10; }
+inline int f1646_11(int x) { return x * 11; }
+inline int f1646_12(int x) { return x * 12; }
+inline int f1646_13(int x) { return x * 13; }
+inline int f1646_14(int x) { return x * 14; }
+inline int f1646_15(int x) { return x * 15; }
+inline int f1646_16(int x) { return x * 16; }
+inline int f1646_17(int x) { return x * 17; }
+inline int f1646_18(int x) { return x * 18; }
+inline int f1646_19(int x) { return x * 19; }
+inline int f1646_20(int x) { return x * 20; }
+inline int f1646_21(int x) { return x * 21; }
+inline int f1646_22(int x) { return x * 22; }
+inline int f1646_23(int x) { return x * 23; }
+inline int f1646_24(int x) { return x * 24; }
+inline int f1646_25(int x) { return x * 25; }
+inline int f1646_26(int x) { return x * 26; }
+inline int f1646_27(int x) { return x * 27; }
+inline int f1646_28(int x) { return x * 28; }
+inline int f1646_29(int x) { return x * 29; }
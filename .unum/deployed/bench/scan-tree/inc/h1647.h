@@ -0,0 +1,42 @@
+#pragma once
+/* header 1647 */
+#include <vector>
+#include "h4127.h"
+#include "h4900.h"
+#include "h1051.h"
+#include "h5193.h"
+#include "h5053.h"
+#ifdef X
+#include "h9674.h"
+#endif
+struct S1647 { int a; const char *s = "x//y"; };
+inline int f1647_0(int x) { return x * 0; }
+inline int f1647_1(int x) { return x * 1; }
+inline int f1647_2(int x) { return x * 2; }
+inline int f1647_3(int x) { return x * 3; }
+inline int f1647_4(int x) { return x * 4; }
+inline int f1647_5(int x) { return x * 5; }
+inline int f1647_6(int x) { return x * 6; }
+inline int f1647_7(int x) { return x * 7; }
+inline int f1647_8(int x) { return x * 8; }
+inline int f1647_9(int x) { return x * 9; }
+inline int f1647_10(int x) { return x * 10; }
+inline int f1647_11(int x) { return x * 11; }
+inline int f1647_12(int x) { return x * 12; }
+inline int f1647_13(int x) { return x * 13; }
+inline int f1647_14(int x) { return x * 14; }
+inline int f1647_15(int x) { return x * 15; }
+inline int f1647_16(int x) { return x * 16; }
+inline int f1647_17(int x) { return x * 17; }
+inline int f1647_18(int x) { return x * 18; }
+inline int f1647_19(int x) { return x * 19; }
+inline int f1647_20(int x) { return x * 20; }
+inline int f1647_21(int x) { return x * 21; }
+inline int f1647_22(int x) { return x * 22; }
+inline int f1647_23(int x) { return x * 23; }
+inline int f1647_24(int x) { return x * 24; }
+inline int f1647_25(int x) { return x * 25; }
+inline int f1647_26(int x) { return x * 26; }
+inline int f1647_27(int x) { return x * 27; }
+inline int f1647_28(int x) { return x * 28; }
+inline int f1647_29(int x) { return x * 29; }
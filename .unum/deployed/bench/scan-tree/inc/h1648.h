@@ -0,0 +1,42 @@
+#pragma once
+/* header 1648 */
+#include <vector>
+#include "h7542.h"
+#include "h7615.h"
+#include "h5153.h"
+#include "h5434.h"
+#include "h5461.h"
+#ifdef X
+#include "h4097.h"
+#endif
+struct S1648 { int a; const char *s = "x//y"; };
+inline int f1648_0(int x) { return x * 0; }
+inline int f1648_1(int x) { return x * 1; }
+inline int f1648_2(int x) { return x * 2; }
+inline int f1648_3(int x) { return x * 3; }
+inline int f1648_4(int x) { return x * 4; }
+inline int f1648_5(int x) { return x * 5; }
+inline int f1648_6(int x) { return x * 6; }
+inline int f1648_7(int x) { return x * 7; }
+inline int f1648_8(int x) { return x * 8; }
+inline int f1648_9(int x) { return x * 9; }
+inline int f1648_10(int x) { return x * 10; }
+inline int f1648_11(int x) { return x * 11; }
+inline int f1648_12(int x) { return x * 12; }
+inline int f1648_13(int x) { return x * 13; }
+inline int f1648_14(int x) { return x * 14; }
+inline int f1648_15(int x) { return x * 15; }
+inline int f1648_16(int x) { return x * 16; }
+inline int f1648_17(int x) { return x * 17; }
+inline int f1648_18(int x) { return x * 18; }
+inline int f1648_19(int x) { return x * 19; }
+inline int f1648_20(int x) { return x * 20; }
+inline int f1648_21(int x) { return x * 21; }
+inline int f1648_22(int x) { return x * 22; }
+inline int f1648_23(int x) { return x * 23; }
+inline int f1648_24(int x) { return x * 24; }
+inline int f1648_25(int x) { return x * 25; }
+inline int f1648_26(int x) { return x * 26; }
+inline int f1648_27(int x) { return x * 27; }
+inline int f1648_28(int x) { return x * 28; }
+inline int f1648_29(int x) { return x * 29; }
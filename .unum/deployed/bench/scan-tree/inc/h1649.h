@@ -0,0 +1,42 @@
+#pragma once
+/* header 1649 */
+#include <vector>
+#include "h70.h"
+#include "h3605.h"
+#include "h8120.h"
+#include "h6677.h"
+#include "h1115.h"
+#ifdef X
+#include "h3218.h"
+#endif
+struct S1649 { int a; const char *s = "x//y"; };
+inline int f1649_0(int x) { return x * 0; }
+inline int f1649_1(int x) { return x * 1; }
+inline int f1649_2(int x) { return x * 2; }
+inline int f1649_3(int x) { return x * 3; }
+inline int f1649_4(int x) { return x * 4; }
+inline int f1649_5(int x) { return x * 5; }
+inline int f1649_6(int x) { return x * 6; }
+inline int f1649_7(int x) { return x * 7; }
+inline int f1649_8(int x) { return x * 8; }
+inline int f1649_9(int x) { return x * 9; }
+inline int f1649_10(int x) { return x * 10; }
+inline int f1649_11(int x) { return x * 11; }
+inline int f1649_12(int x) { return x * 12; }
+inline int f1649_13(int x) { return x * 13; }
+inline int f1649_14(int x) { return x * 14; }
+inline int f1649_15(int x) { return x * 15; }
+inline int f1649_16(int x) { return x * 16; }
+inline int f1649_17(int x) { return x * 17; }
+inline int f1649_18(int x) { return x * 18; }
+inline int f1649_19(int x) { return x * 19; }
+inline int f1649_20(int x) { return x * 20; }
+inline int f1649_21(int x) { return x * 21; }
+inline int f1649_22(int x) { return x * 22; }
+inline int f1649_23(int x) { return x * 23; }
+inline int f1649_24(int x) { return x * 24; }
+inline int f1649_25(int x) { return x * 25; }
+inline int f1649_26(int x) { return x * 26; }
+inline int f1649_27(int x) { return x * 27; }
+inline int f1649_28(int x) { return x * 28; }
+inline int f1649_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1651 */
+#include <vector>
+#include "h150.h"
+#include "h5115.h"
+#include "h9878.h"
+#include "h2416.h"
+#include "h7616.h"
+#ifdef X
+#include "h7371.h"
+#endif
+struct S1651 { int a; const char *s = "x//y"; };
+inline int f1651_0(int x) { return x * 0; }
+inline int f1651_1(int x) { return x * 1; }
+inline int f1651_2(int x) { return x * 2; }
+inline int f1651_3(int x) { return x * 3; }
+inline int f1651_4(int x) { return x * 4; }
+inline int f1651_5(int x) { return x * 5; }
+inline int f1651_6(int x) { return x * 6; }
+inline int f1651_7(int x) { return x * 7; }
+inline int f1651_8(int x) { return x * 8; }
+inline int f1651_9(int x) { return x * 9; }
+inline int f1651_10(int x) { return x * 10; }
+inline int f1651_11(int x) { return x * 11; }
+inline int f1651_12(int x) { return x * 12; }
+inline int f1651_13(int x) { return x * 13; }
+inline int f1651_14(int x) { return x * 14; }
+inline int f1651_15(int x) { return x * 15; }
+inline int f1651_16(int x) { return x * 16; }
+inline int f1651_17(int x) { return x * 17; }
+inline int f1651_18(int x) { return x * 18; }
+inline int f1651_19(int x) { return x * 19; }
+inline int f1651_20(int x) { return x * 20; }
+inline int f1651_21(int x) { return x * 21; }
+inline int f1651_22(int x) { return x * 22; }
+inline int f1651_23(int x) { return x * 23; }
+inline int f1651_24(int x) { return x * 24; }
+inline int f1651_25(int x) { return x * 25; }
+inline int f1651_26(int x) { return x * 26; }
+inline int f1651_27(int x) { return x * 27; }
+inline int f1651_28(int x) { return x * 28; }
+inline int f1651_29(int x) { return x * 29; }
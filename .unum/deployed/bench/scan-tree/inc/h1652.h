@@ -0,0 +1,42 @@
+#pragma once
+/* header 1652 */
+#include <vector>
+#include "h9833.h"
+#include "h5146.h"
+#include "h9870.h"
+#include "h8550.h"
+#include "h9646.h"
+#ifdef X
+#include "h6570.h"
+#endif
+struct S1652 { int a; const char *s = "x//y"; };
+inline int f1652_0(int x) { return x * 0; }
+inline int f1652_1(int x) { return x * 1; }
+inline int f1652_2(int x) { return x * 2; }
+inline int f1652_3(int x) { return x * 3; }
+inline int f1652_4(int x) { return x * 4; }
+inline int f1652_5(int x) { return x * 5; }
+inline int f1652_6(int x) { return x * 6; }
+inline int f1652_7(int x) { return x * 7; }
+inline int f1652_8(int x) { return x * 8; }
+inline int f1652_9(int x) { return x * 9; }
+inline int f1652_10(int x) { return x * 10; }
+inline int f1652_11(int x) { return x * 11; }
+inline int f1652_12(int x) { return x * 12; }
+inline int f1652_13(int x) { return x * 13; }
+inline int f1652_14(int x) { return x * 14; }
+inline int f1652_15(int x) { return x * 15; }
+inline int f1652_16(int x) { return x * 16; }
+inline int f1652_17(int x) { return x * 17; }
+inline int f1652_18(int x) { return x * 18; }
+inline int f1652_19(int x) { return x * 19; }
+inline int f1652_20(int x) { return x * 20; }
+inline int f1652_21(int x) { return x * 21; }
+inline int f1652_22(int x) { return x * 22; }
+inline int f1652_23(int x) { return x * 23; }
+inline int f1652_24(int x) { return x * 24; }
+inline int f1652_25(int x) { return x * 25; }
+inline int f1652_26(int x) { return x * 26; }
+inline int f1652_27(int x) { return x * 27; }
+inline int f1652_28(int x) { return x * 28; }
+inline int f1652_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1654 */
+#include <vector>
+#include "h4052.h"
+#include "h5316.h"
+#include "h3384.h"
+#include "h6719.h"
+#include "h6401.h"
+#ifdef X
+#include "h8486.h"
+#endif
+struct S1654 { int a; const char *s = "x//y"; };
+inline int f1654_0(int x) { return x * 0; }
+inline int f1654_1(int x) { return x * 1; }
+inline int f1654_2(int x) { return x * 2; }
+inline int f1654_3(int x) { return x * 3; }
+inline int f1654_4(int x) { return x * 4; }
+inline int f1654_5(int x) { return x * 5; }
+inline int f1654_6(int x) { return x * 6; }
+inline int f1654_7(int x) { return x * 7; }
+inline int f1654_8(int x) { return x * 8; }
+inline int f1654_9(int x) { return x * 9; }
+inline int f1654_10(int x) { return x * 10; }
+inline int f1654_11(int x) { return x * 11; }
+inline int f1654_12(int x) { return x * 12; }
+inline int f1654_13(int x) { return x * 13; }
+inline int f1654_14(int x) { return x * 14; }
+inline int f1654_15(int x) { return x * 15; }
+inline int f1654_16(int x) { return x * 16; }
+inline int f1654_17(int x) { return x * 17; }
+inline int f1654_18(int x) { return x * 18; }
+inline int f1654_19(int x) { return x * 19; }
+inline int f1654_20(int x) { return x * 20; }
+inline int f1654_21(int x) { return x * 21; }
+inline int f1654_22(int x) { return x * 22; }
+inline int f1654_23(int x) { return x * 23; }
+inline int f1654_24(int x) { return x * 24; }
+inline int f1654_25(int x) { return x * 25; }
+inline int f1654_26(int x) { return x * 26; }
+inline int f1654_27(int x) { return x * 27; }
+inline int f1654_28(int x) { return x * 28; }
+inline int f1654_29(int x) { return x * 29; }
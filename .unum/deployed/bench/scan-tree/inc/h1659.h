@@ -0,0 +1,42 @@
+#pragma once
+/* header 1659 */
+#include <vector>
+#include "h7174.h"
+#include "h3603.h"
+#include "h1866.h"
+#include "h7226.h"
+#include "h3462.h"
+#ifdef X
+#include "h4861.h"
+#endif
+struct S1659 { int a; const char *s = "x//y"; };
+inline int f1659_0(int x) { return x * 0; }
+inline int f1659_1(int x) { return x * 1; }
+inline int f1659_2(int x) { return x * 2; }
+inline int f1659_3(int x) { return x * 3; }
+inline int f1659_4(int x) { return x * 4; }
+inline int f1659_5(int x) { return x * 5; }
+inline int f1659_6(int x) { return x * 6; }
+inline int f1659_7(int x) { return x * 7; }
+inline int f1659_8(int x) { return x * 8; }
+inline int f1659_9(int x) { return x * 9; }
+inline int f1659_10(int x) { return x * 10; }
+inline int f1659_11(int x) { return x * 11; }
+inline int f1659_12(int x) { return x * 12; }
+inline int f1659_13(int x) { return x * 13; }
+inline int f1659_14(int x) { return x * 14; }
+inline int f1659_15(int x) { return x * 15; }
+inline int f1659_16(int x) { return x * 16; }
+inline int f1659_17(int x) { return x * 17; }
+inline int f1659_18(int x) { return x * 18; }
+inline int f1659_19(int x) { return x * 19; }
+inline int f1659_20(int x) { return x * 20; }
+inline int f1659_21(int x) { return x * 21; }
+inline int f1659_22(int x) { return x * 22; }
+inline int f1659_23(int x) { return x * 23; }
+inline int f1659_24(int x) { return x * 24; }
+inline int f1659_25(int x) { return x * 25; }
+inline int f1659_26(int x) { return x * 26; }
+inline int f1659_27(int x) { return x * 27; }
+inline int f1659_28(int x) { return x * 28; }
+inline int f1659_29(int x) { return x * 29; }
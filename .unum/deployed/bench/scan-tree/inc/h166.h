@@ -0,0 +1,42 @@
+#pragma once
+/* header 166 */
+#include <vector>
+#include "h6175.h"
+#include "h1029.h"
+#include "h7324.h"
+#include "h8945.h"
+#include "h2020.h"
+#ifdef X
+#include "h7183.h"
+#endif
+struct S166 { int a; const char *s = "x//y"; };
+inline int f166_0(int x) { return x * 0; }
+inline int f166_1(int x) { return x * 1; }
+inline int f166_2(int x) { return x * 2; }
+inline int f166_3(int x) { return x * 3; }
+inline int f166_4(int x) { return x * 4; }
+inline int f166_5(int x) { return x * 5; }
+inline int f166_6(int x) { return x * 6; }
+inline int f166_7(int x) { return x * 7; }
+inline int f166_8(int x) { return x * 8; }
+inline int f166_9(int x) { return x * 9; }
+inline int f166_10(int x) { return x * 10; }
+inline int f166_11(int x) { return x * 11; }
+inline int f166_12(int x) { return x * 12; }
+inline int f166_13(int x) { return x * 13; }
+inline int f166_14(int x) { return x * 14; }
+inline int f166_15(int x) { return x * 15; }
+inline int f166_16(int x) { return x * 16; }
+inline int f166_17(int x) { return x * 17; }
+inline int f166_18(int x) { return x * 18; }
+inline int f166_19(int x) { return x * 19; }
+inline int f166_20(int x) { return x * 20; }
+inline int f166_21(int x) { return x * 21; }
+inline int f166_22(int x) { return x * 22; }
+inline int f166_23(int x) { return x * 23; }
+inline int f166_24(int x) { return x * 24; }
+inline int f166_25(int x) { return x * 25; }
+inline int f166_26(int x) { return x * 26; }
+inline int f166_27(int x) { return x * 27; }
+inline int f166_28(int x) { return x * 28; }
+inline int f166_29(int x) { return x * 29; }
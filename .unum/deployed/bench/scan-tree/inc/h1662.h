@@ -0,0 +1,42 @@
+#pragma once
+/* header 1662 */
+#include <vector>
+#include "h5568.h"
+#include "h7245.h"
+#include "h148.h"
+#include "h3055.h"
+#include "h3388.h"
+#ifdef X
+#include "h1458.h"
+#endif
+struct S1662 { int a; const char *s = "x//y"; };
+inline int f1662_0(int x) { return x * 0; }
+inline int f1662_1(int x) { return x * 1; }
+inline int f1662_2(int x) { return x * 2; }
+inline int f1662_3(int x) { return x * 3; }
+inline int f1662_4(int x) { return x * 4; }
+inline int f1662_5(int x) { return x * 5; }
+inline int f1662_6(int x) { return x * 6; }
+inline int f1662_7(int x) { return x * 7; }
+inline int f1662_8(int x) { return x * 8; }
+inline int f1662_9(int x) { return x * 9; }
+inline int f1662_10(int x) { return x * 10; }
+inline int f1662_11(int x) { return x * 11; }
+inline int f1662_12(int x) { return x * 12; }
+inline int f1662_13(int x) { return x * 13; }
+inline int f1662_14(int x) { return x * 14; }
+inline int f1662_15(int x) { return x * 15; }
+inline int f1662_16(int x) { return x * 16; }
+inline int f1662_17(int x) { return x * 17; }
+inline int f1662_18(int x) { return x * 18; }
+inline int f1662_19(int x) { return x * 19; }
+inline int f1662_20(int x) { return x * 20; }
+inline int f1662_21(int x) { return x * 21; }
+inline int f1662_22(int x) { return x * 22; }
+inline int f1662_23(int x) { return x * 23; }
+inline int f1662_24(int x) { return x * 24; }
+inline int f1662_25(int x) { return x * 25; }
+inline int f1662_26(int x) { return x * 26; }
+inline int f1662_27(int x) { return x * 27; }
+inline int f1662_28(int x) { return x * 28; }
+inline int f1662_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1663 */
+#include <vector>
+#include "h8723.h"
+#include "h1471.h"
+#include "h3580.h"
+#include "h8504.h"
+#include "h1934.h"
+#ifdef X
+#include "h9926.h"
+#endif
+struct S1663 { int a; const char *s = "x//y"; };
+inline int f1663_0(int x) { return x * 0; }
+inline int f1663_1(int x) { return x * 1; }
+inline int f1663_2(int x) { return x * 2; }
+inline int f1663_3(int x) { return x * 3; }
+inline int f1663_4(int x) { return x * 4; }
+inline int f1663_5(int x) { return x * 5; }
+inline int f1663_6(int x) { return x * 6; }
+inline int f1663_7(int x) { return x * 7; }
+inline int f1663_8(int x) { return x * 8; }
+inline int f1663_9(int x) { return x * 9; }
+inline int f1663_10(int x) { return x * 10; }
+inline int f1663_11(int x) { return x * 11; }
+inline int f1663_12(int x) { return x * 12; }
+inline int f1663_13(int x) { return x * 13; }
+inline int f1663_14(int x) { return x * 14; }
+inline int f1663_15(int x) { return x * 15; }
+inline int f1663_16(int x) { return x * 16; }
+inline int f1663_17(int x) { return x * 17; }
+inline int f1663_18(int x) { return x * 18; }
+inline int f1663_19(int x) { return x * 19; }
+inline int f1663_20(int x) { return x * 20; }
+inline int f1663_21(int x) { return x * 21; }
+inline int f1663_22(int x) { return x * 22; }
+inline int f1663_23(int x) { return x * 23; }
+inline int f1663_24(int x) { return x * 24; }
+inline int f1663_25(int x) { return x * 25; }
+inline int f1663_26(int x) { return x * 26; }
+inline int f1663_27(int x) { return x * 27; }
+inline int f1663_28(int x) { return x * 28; }
+inline int f1663_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1664 */
+#include <vector>
+#include "h4056.h"
+#include "h3751.h"
+#include "h6547.h"
+#include "h6485.h"
+#include "h4777.h"
+#ifdef X
+#include "h5155.h"
+#endif
+struct S1664 { int a; const char *s = "x//y"; };
+inline int f1664_0(int x) { return x * 0; }
+inline int f1664_1(int x) { return x * 1; }
+inline int f1664_2(int x) { return x * 2; }
+inline int f1664_3(int x) { return x * 3; }
+inline int f1664_4(int x) { return x * 4; }
+inline int f1664_5(int x) { return x * 5; }
+inline int f1664_6(int x) { return x * 6; }
+inline int f1664_7(int x) { return x * 7; }
+inline int f1664_8(int x) { return x * 8; }
+inline int f1664_9(int x) { return x * 9; }
+inline int f1664_10(int x) { return x * 10; }
+inline int f1664_11(int x) { return x * 11; }
+inline int f1664_12(int x) { return x * 12; }
+inline int f1664_13(int x) { return x * 13; }
+inline int f1664_14(int x) { return x * 14; }
+inline int f1664_15(int x) { return x * 15; }
+inline int f1664_16(int x) { return x * 16; }
+inline int f1664_17(int x) { return x * 17; }
+inline int f1664_18(int x) { return x * 18; }
+inline int f1664_19(int x) { return x * 19; }
+inline int f1664_20(int x) { return x * 20; }
+inline int f1664_21(int x) { return x * 21; }
+inline int f1664_22(int x) { return x * 22; }
+inline int f1664_23(int x) { return x * 23; }
+inline int f1664_24(int x) { return x * 24; }
+inline int f1664_25(int x) { return x * 25; }
+inline int f1664_26(int x) { return x * 26; }
+inline int f1664_27(int x) { return x * 27; }
+inline int f1664_28(int x) { return x * 28; }
+inline int f1664_29(int x) { return x * 29; }
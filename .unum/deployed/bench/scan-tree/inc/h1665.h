@@ -0,0 +1,42 @@
+#pragma once
+/* header 1665 */
+#include <vector>
+#include "h8838.h"
+#include "h5883.h"
+#include "h6805.h"
+#include "h8644.h"
+#include "h6874.h"
+#ifdef X
+#include "h3617.h"
+#endif
+struct S1665 { int a; const char *s = "x//y"; };
+inline int f1665_0(int x) { return x * 0; }
+inline int f1665_1(int x) { return x * 1; }
+inline int f1665_2(int x) { return x * 2; }
+inline int f1665_3(int x) { return x * 3; }
+inline int f1665_4(int x) { return x * 4; }
+inline int f1665_5(int x) { return x * 5; }
+inline int f1665_6(int x) { return x * 6; }
+inline int f1665_7(int x) { return x * 7; }
+inline int f1665_8(int x) { return x * 8; }
+inline int f1665_9(int x) { return x * 9; }
+inline int f1665_10(int x) { return x * 10; }
+inline int f1665_11(int x) { return x * 11; }
+inline int f1665_12(int x) { return x * 12; }
+inline int f1665_13(int x) { return x * 13; }
+inline int f1665_14(int x) { return x * 14; }
+inline int f1665_15(int x) { return x * 15; }
+inline int f1665_16(int x) { return x * 16; }
+inline int f1665_17(int x) { return x * 17; }
+inline int f1665_18(int x) { return x * 18; }
+inline int f1665_19(int x) { return x * 19; }
+inline int f1665_20(int x) { return x * 20; }
+inline int f1665_21(int x) { return x * 21; }
+inline int f1665_22(int x) { return x * 22; }
+inline int f1665_23(int x) { return x * 23; }
+inline int f1665_24(int x) { return x * 24; }
+inline int f1665_25(int x) { return x * 25; }
+inline int f1665_26(int x) { return x * 26; }
+inline int f1665_27(int x) { return x * 27; }
+inline int f1665_28(int x) { return x * 28; }
+inline int f1665_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1666 */
+#include <vector>
+#include "h2545.h"
+#include "h3742.h"
+#include "h8035.h"
+#include "h9411.h"
+#include "h4278.h"
+#ifdef X
+#include "h7869.h"
+#endif
+struct S1666 { int a; const char *s = "x//y"; };
+inline int f1666_0(int x) { return x * 0; }
+inline int f1666_1(int x) { return x * 1; }
+inline int f1666_2(int x) { return x * 2; }
+inline int f1666_3(int x) { return x * 3; }
+inline int f1666_4(int x) { return x * 4; }
+inline int f1666_5(int x) { return x * 5; }
+inline int f1666_6(int x) { return x * 6; }
+inline int f1666_7(int x) { return x * 7; }
+inline int f1666_8(int x) { return x * 8; }
+inline int f1666_9(int x) { return x * 9; }
+inline int f1666_10(int x) { return x * 10; }
+inline int f1666_11(int x) { return x * 11; }
+inline int f1666_12(int x) { return x * 12; }
+inline int f1666_13(int x) { return x * 13; }
+inline int f1666_14(int x) { return x * 14; }
+inline int f1666_15(int x) { return x * 15; }
+inline int f1666_16(int x) { return x * 16; }
+inline int f1666_17(int x) { return x * 17; }
+inline int f1666_18(int x) { return x * 18; }
+inline int f1666_19(int x) { return x * 19; }
+inline int f1666_20(int x) { return x * 20; }
+inline int f1666_21(int x) { return x * 21; }
+inline int f1666_22(int x) { return x * 22; }
+inline int f1666_23(int x) { return x * 23; }
+inline int f1666_24(int x) { return x * 24; }
+inline int f1666_25(int x) { return x * 25; }
+inline int f1666_26(int x) { return x * 26; }
+inline int f1666_27(int x) { return x * 27; }
+inline int f1666_28(int x) { return x * 28; }
+inline int f1666_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1668 */
+#include <vector>
+#include "h3633.h"
+#include "h4925.h"
+#include "h7705.h"
+#include "h5496.h"
+#include "h848.h"
+#ifdef X
+#include "h8454.h"
+#endif
+struct S1668 { int a; const char *s = "x//y"; };
+inline int f1668_0(int x) { return x * 0; }
+inline int f1668_1(int x) { return x * 1; }
+inline int f1668_2(int x) { return x * 2; }
+inline int f1668_3(int x) { return x * 3; }
+inline int f1668_4(int x) { return x * 4; }
+inline int f1668_5(int x) { return x * 5; }
+inline int f1668_6(int x) { return x * 6; }
+inline int f1668_7(int x) { return x * 7; }
+inline int f1668_8(int x) { return x * 8; }
+inline int f1668_9(int x) { return x * 9; }
+inline int f1668_10(int x) { return x * 10; }
+inline int f1668_11(int x) { return x * 11; }
+inline int f1668_12(int x) { return x * 12; }
+inline int f1668_13(int x) { return x * 13; }
+inline int f1668_14(int x) { return x * 14; }
+inline int f1668_15(int x) { return x * 15; }
+inline int f1668_16(int x) { return x * 16; }
+inline int f1668_17(int x) { return x * 17; }
+inline int f1668_18(int x) { return x * 18; }
+inline int f1668_19(int x) { return x * 19; }
+inline int f1668_20(int x) { return x * 20; }
+inline int f1668_21(int x) { return x * 21; }
+inline int f1668_22(int x) { return x * 22; }
+inline int f1668_23(int x) { return x * 23; }
+inline int f1668_24(int x) { return x * 24; }
+inline int f1668_25(int x) { return x * 25; }
+inline int f1668_26(int x) { return x * 26; }
+inline int f1668_27(int x) { return x * 27; }
+inline int f1668_28(int x) { return x * 28; }
+inline int f1668_29(int x) { return x * 29; }
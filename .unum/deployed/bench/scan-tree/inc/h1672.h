@@ -0,0 +1,42 @@
+#pragma once
+/* header 1672 */
+#include <vector>
+#include "h2658.h"
+#include "h6181.h"
+#include "h6000.h"
+#include "h5861.h"
+#include "h3071.h"
+#ifdef X
+#include "h3050.h"
+#endif
+struct S1672 { int a; const char *s = "x//y"; };
+inline int f1672_0(int x) { return x * 0; }
+inline int f1672_1(int x) { return x * 1; }
+inline int f1672_2(int x) { return x * 2; }
+inline int f1672_3(int x) { return x * 3; }
+inline int f1672_4(int x) { return x * 4; }
+inline int f1672_5(int x) { return x * 5; }
+inline int f1672_6(int x) { return x * 6; }
+inline int f1672_7(int x) { return x * 7; }
+inline int f1672_8(int x) { return x * 8; }
+inline int f1672_9(int x) { return x * 9; }
+inline int f1672_10(int x) { return x * 10; }
+inline int f1672_11(int x) { return x * 11; }
+inline int f1672_12(int x) { return x * 12; }
+inline int f1672_13(int x) { return x * 13; }
+inline int f1672_14(int x) { return x * 14; }
+inline int f1672_15(int x) { return x * 15; }
+inline int f1672_16(int x) { return x * 16; }
+inline int f1672_17(int x) { return x * 17; }
+inline int f1672_18(int x) { return x * 18; }
+inline int f1672_19(int x) { return x * 19; }
+inline int f1672_20(int x) { return x * 20; }
+inline int f1672_21(int x) { return x * 21; }
+inline int f1672_22(int x) { return x * 22; }
+inline int f1672_23(int x) { return x * 23; }
+inline int f1672_24(int x) { return x * 24; }
+inline int f1672_25(int x) { return x * 25; }
+inline int f1672_26(int x) { return x * 26; }
+inline int f1672_27(int x) { return x * 27; }
+inline int f1672_28(int x) { return x * 28; }
+inline int f1672_29(int x) { return x * 29; }
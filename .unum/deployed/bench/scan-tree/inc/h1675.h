@@ -0,0 +1,42 @@
+#pragma once
+/* header 1675 */
+#include <vector>
+#include "h8279.h"
+#include "h1268.h"
+#include "h7621.h"
+#include "h238.h"
+#include "h8817.h"
+#ifdef X
+#include "h3348.h"
+#endif
+struct S1675 { int a; const char *s = "x//y"; };
+inline int f1675_0(int x) { return x * 0; }
+inline int f1675_1(int x) { return x * 1; }
+inline int f1675_2(int x) { return x * 2; }
+inline int f1675_3(int x) { return x * 3; }
+inline int f1675_4(int x) { return x * 4; }
+inline int f1675_5(int x) { return x * 5; }
+inline int f1675_6(int x) { return x * 6; }
+inline int f1675_7(int x) { return x * 7; }
+inline int f1675_8(int x) { return x * 8; }
+inline int f1675_9(int x) { return x * 9; }
+inline int f1675_10(int x) { return x * 10; }
+inline int f1675_11(int x) { return x * 11; }
+inline int f1675_12(int x) { return x * 12; }
+inline int f1675_13(int x) { return x * 13; }
+inline int f1675_14(int x) { return x * 14; }
+inline int f1675_15(int x) { return x * 15; }
+inline int f1675_16(int x) { return x * 16; }
+inline int f1675_17(int x) { return x * 17; }
+inline int f1675_18(int x) { return x * 18; }
+inline int f1675_19(int x) { return x * 19; }
+inline int f1675_20(int x) { return x * 20; }
+inline int f1675_21(int x) { return x * 21; }
+inline int f1675_22(int x) { return x * 22; }
+inline int f1675_23(int x) { return x * 23; }
+inline int f1675_24(int x) { return x * 24; }
+inline int f1675_25(int x) { return x * 25; }
+inline int f1675_26(int x) { return x * 26; }
+inline int f1675_27(int x) { return x * 27; }
+inline int f1675_28(int x) { return x * 28; }
+inline int f1675_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1676 */
+#include <vector>
+#include "h2125.h"
+#include "h9019.h"
+#include "h716.h"
+#include "h5378.h"
+#include "h9562.h"
+#ifdef X
+#include "h6961.h"
+#endif
+struct S1676 { int a; const char *s = "x//y"; };
+inline int f1676_0(int x) { return x * 0; }
+inline int f1676_1(int x) { return x * 1; }
+inline int f1676_2(int x) { return x * 2; }
+inline int f1676_3(int x) { return x * 3; }
+inline int f1676_4(int x) { return x * 4; }
+inline int f1676_5(int x) { return x * 5; }
+inline int f1676_6(int x) { return x * 6; }
+inline int f1676_7(int x) { return x * 7; }
+inline int f1676_8(int x) { return x * 8; }
+inline int f1676_9(int x) { return x * 9; }
+inline int f1676_10(int x) { return x * 10; }
+inline int f1676_11(int x) { return x * 11; }
+inline int f1676_12(int x) { return x * 12; }
+inline int f1676_13(int x) { return x * 13; }
+inline int f1676_14(int x) { return x * 14; }
+inline int f1676_15(int x) { return x * 15; }
+inline int f1676_16(int x) { return x * 16; }
+inline int f1676_17(int x) { return x * 17; }
+inline int f1676_18(int x) { return x * 18; }
+inline int f1676_19(int x) { return x * 19; }
+inline int f1676_20(int x) { return x * 20; }
+inline int f1676_21(int x) { return x * 21; }
+inline int f1676_22(int x) { return x * 22; }
+inline int f1676_23(int x) { return x * 23; }
+inline int f1676_24(int x) { return x * 24; }
+inline int f1676_25(int x) { return x * 25; }
+inline int f1676_26(int x) { return x * 26; }
+inline int f1676_27(int x) { return x * 27; }
+inline int f1676_28(int x) { return x * 28; }
+inline int f1676_29(int x) { return x * 29; }
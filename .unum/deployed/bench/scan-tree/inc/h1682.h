@@ -0,0 +1,42 @@
+#pragma once
+/* header 1682 */
+#include <vector>
+#include "h7264.h"
+#include "h8246.h"
+#include "h4273.h"
+#include "h899.h"
+#include "h9203.h"
+#ifdef X
+#include "h4119.h"
+#endif
+struct S1682 { int a; const char *s = "x//y"; };
+inline int f1682_0(int x) { return x * 0; }
+inline int f1682_1(int x) { return x * 1; }
+inline int f1682_2(int x) { return x * 2; }
+inline int f1682_3(int x) { return x * 3; }
+inline int f1682_4(int x) { return x * 4; }
+inline int f1682_5(int x) { return x * 5; }
+inline int f1682_6(int x) { return x * 6; }
+inline int f1682_7(int x) { return x * 7; }
+inline int f1682_8(int x) { return x * 8; }
+inline int f1682_9(int x) { return x * 9; }
+inline int f1682_10(int x) { return x * 10; }
+inline int f1682_11(int x) { return x * 11; }
+inline int f1682_12(int x) { return x * 12; }
+inline int f1682_13(int x) { return x * 13; }
+inline int f1682_14(int x) { return x * 14; }
+inline int f1682_15(int x) { return x * 15; }
+inline int f1682_16(int x) { return x * 16; }
+inline int f1682_17(int x) { return x * 17; }
+inline int f1682_18(int x) { return x * 18; }
+inline int f1682_19(int x) { return x * 19; }
+inline int f1682_20(int x) { return x * 20; }
+inline int f1682_21(int x) { return x * 21; }
+inline int f1682_22(int x) { return x * 22; }
+inline int f1682_23(int x) { return x * 23; }
+inline int f1682_24(int x) { return x * 24; }
+inline int f1682_25(int x) { return x * 25; }
+inline int f1682_26(int x) { return x * 26; }
+inline int f1682_27(int x) { return x * 27; }
+inline int f1682_28(int x) { return x * 28; }
+inline int f1682_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1683 */
+#include <vector>
+#include "h122.h"
+#include "h356.h"
+#include "h2161.h"
+#include "h188.h"
+#include "h7122.h"
+#ifdef X
+#include "h6340.h"
+#endif
+struct S1683 { int a; const char *s = "x//y"; };
+inline int f1683_0(int x) { return x * 0; }
+inline int f1683_1(int x) { return x * 1; }
+inline int f1683_2(int x) { return x * 2; }
+inline int f1683_3(int x) { return x * 3; }
+inline int f1683_4(int x) { return x * 4; }
+inline int f1683_5(int x) { return x * 5; }
+inline int f1683_6(int x) { return x * 6; }
+inline int f1683_7(int x) { return x * 7; }
+inline int f1683_8(int x) { return x * 8; }
+inline int f1683_9(int x) { return x * 9; }
+inline int f1683_10(int x) { return x * 10; }
+inline int f1683_11(int x) { return x * 11; }
+inline int f1683_12(int x) { return x * 12; }
+inline int f1683_13(int x) { return x * 13; }
+inline int f1683_14(int x) { return x * 14; }
+inline int f1683_15(int x) { return x * 15; }
+inline int f1683_16(int x) { return x * 16; }
+inline int f1683_17(int x) { return x * 17; }
+inline int f1683_18(int x) { return x * 18; }
+inline int f1683_19(int x) { return x * 19; }
+inline int f1683_20(int x) { return x * 20; }
+inline int f1683_21(int x) { return x * 21; }
+inline int f1683_22(int x) { return x * 22; }
+inline int f1683_23(int x) { return x * 23; }
+inline int f1683_24(int x) { return x * 24; }
+inline int f1683_25(int x) { return x * 25; }
+inline int f1683_26(int x) { return x * 26; }
+inline int f1683_27(int x) { return x * 27; }
+inline int f1683_28(int x) { return x * 28; }
+inline int f1683_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1684 */
+#include <vector>
+#include "h5601.h"
+#include "h2818.h"
+#include "h165.h"
+#include "h5193.h"
+#include "h2959.h"
+#ifdef X
+#include "h1007.h"
+#endif
+struct S1684 { int a; const char *s = "x//y"; };
+inline int f1684_0(int x) { return x * 0; }
+inline int f1684_1(int x) { return x * 1; }
+inline int f1684_2(int x) { return x * 2; }
+inline int f1684_3(int x) { return x * 3; }
+inline int f1684_4(int x) { return x * 4; }
+inline int f1684_5(int x) { return x * 5; }
+inline int f1684_6(int x) { return x * 6; }
+inline int f1684_7(int x) { return x * 7; }
+inline int f1684_8(int x) { return x * 8; }
+inline int f1684_9(int x) { return x * 9; }
+inline int f1684_10(int x) { return x * 10; }
+inline int f1684_11(int x) { return x * 11; }
+inline int f1684_12(int x) { return x * 12; }
+inline int f1684_13(int x) { return x * 13; }
+inline int f1684_14(int x) { return x * 14; }
+inline int f1684_15(int x) { return x * 15; }
+inline int f1684_16(int x) { return x * 16; }
+inline int f1684_17(int x) { return x * 17; }
+inline int f1684_18(int x) { return x * 18; }
+inline int f1684_19(int x) { return x * 19; }
+inline int f1684_20(int x) { return x * 20; }
+inline int f1684_21(int x) { return x * 21; }
+inline int f1684_22(int x) { return x * 22; }
+inline int f1684_23(int x) { return x * 23; }
+inline int f1684_24(int x) { return x * 24; }
+inline int f1684_25(int x) { return x * 25; }
+inline int f1684_26(int x) { return x * 26; }
+inline int f1684_27(int x) { return x * 27; }
+inline int f1684_28(int x) { return x * 28; }
+inline int f1684_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1685 */
+#include <vector>
+#include "h3577.h"
+#include "h7225.h"
+#include "h9228.h"
+#include "h4571.h"
+#include "h7559.h"
+#ifdef X
+#include "h1087.h"
+#endif
+struct S1685 { int a; const char *s = "x//y"; };
+inline int f1685_0(int x) { return x * 0; }
+inline int f1685_1(int x) { return x * 1; }
+inline int f1685_2(int x) { return x * 2; }
+inline int f1685_3(int x) { return x * 3; }
+inline int f1685_4(int x) { return x * 4; }
+inline int f1685_5(int x) { return x * 5; }
+inline int f1685_6(int x) { return x * 6; }
+inline int f1685_7(int x) { return x * 7; }
+inline int f1685_8(int x) { return x * 8; }
+inline int f1685_9(int x) { return x * 9; }
+inline int f1685_10(int x) { return x * 10; }
+inline int f1685_11(int x) { return x * 11; }
+inline int f1685_12(int x) { return x * 12; }
+inline int f1685_13(int x) { return x * 13; }
+inline int f1685_14(int x) { return x * 14; }
+inline int f1685_15(int x) { return x * 15; }
+inline int f1685_16(int x) { return x * 16; }
+inline int f1685_17(int x) { return x * 17; }
+inline int f1685_18(int x) { return x * 18; }
+inline int f1685_19(int x) { return x * 19; }
+inline int f1685_20(int x) { return x * 20; }
+inline int f1685_21(int x) { return x * 21; }
+inline int f1685_22(int x) { return x * 22; }
+inline int f1685_23(int x) { return x * 23; }
+inline int f1685_24(int x) { return x * 24; }
+inline int f1685_25(int x) { return x * 25; }
+inline int f1685_26(int x) { return x * 26; }
+inline int f1685_27(int x) { return x * 27; }
+inline int f1685_28(int x) { return x * 28; }
+inline int f1685_29(int x) { return x * 29; }
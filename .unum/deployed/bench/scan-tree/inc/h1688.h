@@ -0,0 +1,42 @@
+#pragma once
+/* header 1688 */
+#include <vector>
+#include "h1118.h"
+#include "h8680.h"
+#include "h8127.h"
+#include "h8957.h"
+#include "h2124.h"
+#ifdef X
+#include "h113.h"
+#endif
+struct S1688 { int a; const char *s = "x//y"; };
+inline int f1688_0(int x) { return x * 0; }
+inline int f1688_1(int x) { return x * 1; }
+inline int f1688_2(int x) { return x * 2; }
+inline int f1688_3(int x) { return x * 3; }
+inline int f1688_4(int x) { return x * 4; }
+inline int f1688_5(int x) { return x * 5; }
+inline int f1688_6(int x) { return x * 6; }
+inline int f1688_7(int x) { return x * 7; }
+inline int f1688_8(int x) { return x * 8; }
+inline int f1688_9(int x) { return x * 9; }
+inline int f1688_10(int x) { return x * 10; }
+inline int f1688_11(int x) { return x * 11; }
+inline int f1688_12(int x) { return x * 12; }
+inline int f1688_13(int x) { return x * 13; }
+inline int f1688_14(int x) { return x * 14; }
+inline int f1688_15(int x) { return x * 15; }
+inline int f1688_16(int x) { return x * 16; }
+inline int f1688_17(int x) { return x * 17; }
+inline int f1688_18(int x) { return x * 18; }
+inline int f1688_19(int x) { return x * 19; }
+inline int f1688_20(int x) { return x * 20; }
+inline int f1688_21(int x) { return x * 21; }
+inline int f1688_22(int x) { return x * 22; }
+inline int f1688_23(int x) { return x * 23; }
+inline int f1688_24(int x) { return x * 24; }
+inline int f1688_25(int x) { return x * 25; }
+inline int f1688_26(int x) { return x * 26; }
+inline int f1688_27(int x) { return x * 27; }
+inline int f1688_28(int x) { return x * 28; }
+inline int f1688_29(int x) { return x * 29; }
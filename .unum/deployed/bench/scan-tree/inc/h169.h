@@ -0,0 +1,42 @@
+#pragma once
+/* header 169 */
+#include <vector>
+#include "h627.h"
+#include "h7490.h"
+#include "h4613.h"
+#include "h5780.h"
+#include "h244.h"
+#ifdef X
+#include "h4385.h"
+#endif
+struct S169 { int a; const char *s = "x//y"; };
+inline int f169_0(int x) { return x * 0; }
+inline int f169_1(int x) { return x * 1; }
+inline int f169_2(int x) { return x * 2; }
+inline int f169_3(int x) { return x * 3; }
+inline int f169_4(int x) { return x * 4; }
+inline int f169_5(int x) { return x * 5; }
+inline int f169_6(int x) { return x * 6; }
+inline int f169_7(int x) { return x * 7; }
+inline int f169_8(int x) { return x * 8; }
+inline int f169_9(int x) { return x * 9; }
+inline int f169_10(int x) { return x * 10; }
+inline int f169_11(int x) { return x * 11; }
+inline int f169_12(int x) { return x * 12; }
+inline int f169_13(int x) { return x * 13; }
+inline int f169_14(int x) { return x * 14; }
+inline int f169_15(int x) { return x * 15; }
+inline int f169_16(int x) { return x * 16; }
+inline int f169_17(int x) { return x * 17; }
+inline int f169_18(int x) { return x * 18; }
+inline int f169_19(int x) { return x * 19; }
+inline int f169_20(int x) { return x * 20; }
+inline int f169_21(int x) { return x * 21; }
+inline int f169_22(int x) { return x * 22; }
+inline int f169_23(int x) { return x * 23; }
+inline int f169_24(int x) { return x * 24; }
+inline int f169_25(int x) { return x * 25; }
+inline int f169_26(int x) { return x * 26; }
+inline int f169_27(int x) { return x * 27; }
+inline int f169_28(int x) { return x * 28; }
+inline int f169_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1690 */
+#include <vector>
+#include "h4122.h"
+#include "h8401.h"
+#include "h1900.h"
+#include "h2556.h"
+#include "h6485.h"
+#ifdef X
+#include "h4758.h"
+#endif
+struct S1690 { int a; const char *s = "x//y"; };
+inline int f1690_0(int x) { return x * 0; }
+inline int f1690_1(int x) { return x * 1; }
+inline int f1690_2(int x) { return x * 2; }
+inline int f1690_3(int x) { return x * 3; }
+inline int f1690_4(int x) { return x * 4; }
+inline int f1690_5(int x) { return x * 5; }
+inline int f1690_6(int x) { return x * 6; }
+inline int f1690_7(int x) { return x * 7; }
+inline int f1690_8(int x) { return x * 8; }
+inline int f1690_9(int x) { return x * 9; }
+inline int f1690_10(int x) { return x * 10; }
+inline int f1690_11(int x) { return x * 11; }
+inline int f1690_12(int x) { return x * 12; }
+inline int f1690_13(int x) { return x * 13; }
+inline int f1690_14(int x) { return x * 14; }
+inline int f1690_15(int x) { return x * 15; }
+inline int f1690_16(int x) { return x * 16; }
+inline int f1690_17(int x) { return x * 17; }
+inline int f1690_18(int x) { return x * 18; }
+inline int f1690_19(int x) { return x * 19; }
+inline int f1690_20(int x) { return x * 20; }
+inline int f1690_21(int x) { return x * 21; }
+inline int f1690_22(int x) { return x * 22; }
+inline int f1690_23(int x) { return x * 23; }
+inline int f1690_24(int x) { return x * 24; }
+inline int f1690_25(int x) { return x * 25; }
+inline int f1690_26(int x) { return x * 26; }
+inline int f1690_27(int x) { return x * 27; }
+inline int f1690_28(int x) { return x * 28; }
+inline int f1690_29(int x) { return x * 29; }
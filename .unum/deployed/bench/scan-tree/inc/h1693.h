@@ -0,0 +1,42 @@
+#pragma once
+/* header 1693 */
+#include <vector>
+#include "h8731.h"
+#include "h8879.h"
+#include "h2947.h"
+#include "h5328.h"
+#include "h8632.h"
+#ifdef X
+#include "h626.h"
+#endif
+struct S1693 { int a; const char *s = "x//y"; };
+inline int f1693_0(int x) { return x * 0; }
+inline int f1693_1(int x) { return x * 1; }
+inline int f1693_2(int x) { return x * 2; }
+inline int f1693_3(int x) { return x * 3; }
+inline int f1693_4(int x) { return x * 4; }
+inline int f1693_5(int x) { return x * 5; }
+inline int f1693_6(int x) { return x * 6; }
+inline int f1693_7(int x) { return x * 7; }
+inline int f1693_8(int x) { return x * 8; }
+inline int f1693_9(int x) { return x * 9; }
+inline int f1693_10(int x) { return x * 10; }
+inline int f1693_11(int x) { return x * 11; }
+inline int f1693_12(int x) { return x * 12; }
+inline int f1693_13(int x) { return x * 13; }
+inline int f1693_14(int x) { return x * 14; }
+inline int f1693_15(int x) { return x * 15; }
+inline int f1693_16(int x) { return x * 16; }
+inline int f1693_17(int x) { return x * 17; }
+inline int f1693_18(int x) { return x * 18; }
+inline int f1693_19(int x) { return x * 19; }
+inline int f1693_20(int x) { return x * 20; }
+inline int f1693_21(int x) { return x * 21; }
+inline int f1693_22(int x) { return x * 22; }
+inline int f1693_23(int x) { return x * 23; }
+inline int f1693_24(int x) { return x * 24; }
+inline int f1693_25(int x) { return x * 25; }
+inline int f1693_26(int x) { return x * 26; }
+inline int f1693_27(int x) { return x * 27; }
+inline int f1693_28(int x) { return x * 28; }
+inline int f1693_29(int x) { return x * 29; }
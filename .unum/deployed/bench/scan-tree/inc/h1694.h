@@ -0,0 +1,42 @@
+#pragma once
+/* header 1694 */
+#include <vector>
+#include "h3563.h"
+#include "h1704.h"
+#include "h8739.h"
+#include "h6552.h"
+#include "h7662.h"
+#ifdef X
+#include "h9676.h"
+#endif
+struct S1694 { int a; const char *s = "x//y"; };
+inline int f1694_0(int x) { return x * 0; }
+inline int f1694_1(int x) { return x * 1; }
+inline int f1694_2(int x) { return x * 2; }
+inline int f1694_3(int x) { return x * 3; }
+inline int f1694_4(int x) { return x * 4; }
+inline int f1694_5(int x) { return x * 5; }
+inline int f1694_6(int x) { return x * 6; }
+inline int f1694_7(int x) { return x * 7; }
+inline int f1694_8(int x) { return x * 8; }
+inline int f1694_9(int x) { return x * 9; }
+inline int f1694_10(int x) { return x * 10; }
+inline int f1694_11(int x) { return x * 11; }
+inline int f1694_12(int x) { return x * 12; }
+inline int f1694_13(int x) { return x * 13; }
+inline int f1694_14(int x) { return x * 14; }
+inline int f1694_15(int x) { return x * 15; }
+inline int f1694_16(int x) { return x * 16; }
+inline int f1694_17(int x) { return x * 17; }
+inline int f1694_18(int x) { return x * 18; }
+inline int f1694_19(int x) { return x * 19; }
+inline int f1694_20(int x) { return x * 20; }
+inline int f1694_21(int x) { return x * 21; }
+inline int f1694_22(int x) { return x * 22; }
+inline int f1694_23(int x) { return x * 23; }
+inline int f1694_24(int x) { return x * 24; }
+inline int f1694_25(int x) { return x * 25; }
+inline int f1694_26(int x) { return x * 26; }
+inline int f1694_27(int x) { return x * 27; }
+inline int f1694_28(int x) { return x * 28; }
+inline int f1694_29(int x) { return x * 29; }
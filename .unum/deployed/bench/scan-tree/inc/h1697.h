@@ -0,0 +1,42 @@
+#pragma once
+/* header 1697 */
+#include <vector>
+#include "h5769.h"
+#include "h6037.h"
+#include "h5545.h"
+#include "h9896.h"
+#include "h7086.h"
+#ifdef X
+#include "h4976.h"
+#endif
+struct S1697 { int a; const char *s = "x//y"; };
+inline int f1697_0(int x) { return x * 0; }
+inline int f1697_1(int x) { return x * 1; }
+inline int f1697_2(int x) { return x * 2; }
+inline int f1697_3(int x) { return x * 3; }
+inline int f1697_4(int x) { return x * 4; }
+inline int f1697_5(int x) { return x * 5; }
+inline int f1697_6(int x) { return x * 6; }
+inline int f1697_7(int x) { return x * 7; }
+inline int f1697_8(int x) { return x * 8; }
+inline int f1697_9(int x) { return x * 9; }
+inline int f1697_10(int x) { return x * 10; }
+inline int f1697_11(int x) { return x * 11; }
+inline int f1697_12(int x) { return x * 12; }
+inline int f1697_13(int x) { return x * 13; }
+inline int f1697_14(int x) { return x * 14; }
+inline int f1697_15(int x) { return x * 15; }
+inline int f1697_16(int x) { return x * 16; }
+inline int f1697_17(int x) { return x * 17; }
+inline int f1697_18(int x) { return x * 18; }
+inline int f1697_19(int x) { return x * 19; }
+inline int f1697_20(int x) { return x * 20; }
+inline int f1697_21(int x) { return x * 21; }
+inline int f1697_22(int x) { return x * 22; }
+inline int f1697_23(int x) { return x * 23; }
+inline int f1697_24(int x) { return x * 24; }
+inline int f1697_25(int x) { return x * 25; }
+inline int f1697_26(int x) { return x * 26; }
+inline int f1697_27(int x) { return x * 27; }
+inline int f1697_28(int x) { return x * 28; }
+inline int f1697_29(int x) { return x * 29; }
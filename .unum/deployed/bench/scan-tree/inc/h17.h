@@ -0,0 +1,42 @@
+#pragma once
+/* header 17 */
+#include <vector>
+#include "h5017.h"
+#include "h4813.h"
+#include "h5250.h"
+#include "h8724.h"
+#include "h7335.h"
+#ifdef X
+#include "h6603.h"
+#endif
+struct S17 { int a; const char *s = "x//y"; };
+inline int f17_0(int x) { return x * 0; }
+inline int f17_1(int x) { return x * 1; }
+inline int f17_2(int x) { return x * 2; }
+inline int f17_3(int x) { return x * 3; }
+inline int f17_4(int x) { return x * 4; }
+inline int f17_5(int x) { return x * 5; }
+inline int f17_6(int x) { return x * 6; }
+inline int f17_7(int x) { return x * 7; }
+inline int f17_8(int x) { return x * 8; }
+inline int f17_9(int x) { return x * 9; }
+inline int f17_10(int x) { return x * 10; }
+inline int f17_11(int x) { return x * 11; }
+inline int f17_12(int x) { return x * 12; }
+inline int f17_13(int x) { return x * 13; }
+inline int f17_14(int x) { return x * 14; }
+inline int f17_15(int x) { return x * 15; }
+inline int f17_16(int x) { return x * 16; }
+inline int f17_17(int x) { return x * 17; }
+inline int f17_18(int x) { return x * 18; }
+inline int f17_19(int x) { return x * 19; }
+inline int f17_20(int x) { return x * 20; }
+inline int f17_21(int x) { return x * 21; }
+inline int f17_22(int x) { return x * 22; }
+inline int f17_23(int x) { return x * 23; }
+inline int f17_24(int x) { return x * 24; }
+inline int f17_25(int x) { return x * 25; }
+inline int f17_26(int x) { return x * 26; }
+inline int f17_27(int x) { return x * 27; }
+inline int f17_28(int x) { return x * 28; }
+inline int f17_29(int x) { return x * 29; }
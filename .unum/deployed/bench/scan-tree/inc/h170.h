@@ -0,0 +1,42 @@
+#pragma once
+/* header 170 */
+#include <vector>
+#include "h8965.h"
+#include "h2232.h"
+#include "h7798.h"
+#include "h1025.h"
+#include "h8834.h"
+#ifdef X
+#include "h8886.h"
+#endif
+struct S170 { int a; const char *s = "x//y"; };
+inline int f170_0(int x) { return x * 0; }
+inline int f170_1(int x) { return x * 1; }
+inline int f170_2(int x) { return x * 2; }
+inline int f170_3(int x) { return x * 3; }
+inline int f170_4(int x) { return x * 4; }
+inline int f170_5(int x) { return x * 5; }
+inline int f170_6(int x) { return x * 6; }
+inline int f170_7(int x) { return x * 7; }
+inline int f170_8(int x) { return x * 8; }
+inline int f170_9(int x) { return x * 9; }
+inline int f170_10(int x) { return x * 10; }
+inline int f170_11(int x) { return x * 11; }
+inline int f170_12(int x) { return x * 12; }
+inline int f170_13(int x) { return x * 13; }
+inline int f170_14(int x) { return x * 14; }
+inline int f170_15(int x) { return x * 15; }
+inline int f170_16(int x) { return x * 16; }
+inline int f170_17(int x) { return x * 17; }
+inline int f170_18(int x) { return x * 18; }
+inline int f170_19(int x) { return x * 19; }
+inline int f170_20(int x) { return x * 20; }
+inline int f170_21(int x) { return x * 21; }
+inline int f170_22(int x) { return x * 22; }
+inline int f170_23(int x) { return x * 23; }
+inline int f170_24(int x) { return x * 24; }
+inline int f170_25(int x) { return x * 25; }
+inline int f170_26(int x) { return x * 26; }
+inline int f170_27(int x) { return x * 27; }
+inline int f170_28(int x) { return x * 28; }
+inline int f170_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1700 */
+#include <vector>
+#include "h779.h"
+#include "h8371.h"
+#include "h1049.h"
+#include "h4309.h"
+#include "h7638.h"
+#ifdef X
+#include "h5915.h"
+#endif
+struct S1700 { int a; const char *s = "x//y"; };
+inline int f1700_0(int x) { return x * 0; }
+inline int f1700_1(int x) { return x * 1; }
+inline int f1700_2(int x) { return x * 2; }
+inline int f1700_3(int x) { return x * 3; }
+inline int f1700_4(int x) { return x * 4; }
+inline int f1700_5(int x) { return x * 5; }
+inline int f1700_6(int x) { return x * 6; }
+inline int f1700_7(int x) { return x * 7; }
+inline int f1700_8(int x) { return x * 8; }
+inline int f1700_9(int x) { return x * 9; }
+inline int f1700_10(int x) { return x * 10; }
+inline int f1700_11(int x) { return x * 11; }
+inline int f1700_12(int x) { return x * 12; }
+inline int f1700_13(int x) { return x * 13; }
+inline int f1700_14(int x) { return x * 14; }
+inline int f1700_15(int x) { return x * 15; }
+inline int f1700_16(int x) { return x * 16; }
+inline int f1700_17(int x) { return x * 17; }
+inline int f1700_18(int x) { return x * 18; }
+inline int f1700_19(int x) { return x * 19; }
+inline int f1700_20(int x) { return x * 20; }
+inline int f1700_21(int x) { return x * 21; }
+inline int f1700_22(int x) { return x * 22; }
+inline int f1700_23(int x) { return x * 23; }
+inline int f1700_24(int x) { return x * 24; }
+inline int f1700_25(int x) { return x * 25; }
+inline int f1700_26(int x) { return x * 26; }
+inline int f1700_27(int x) { return x * 27; }
+inline int f1700_28(int x) { return x * 28; }
+inline int f1700_29(int x) { return x * 29; }
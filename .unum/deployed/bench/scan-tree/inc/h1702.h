@@ -0,0 +1,42 @@
+#pragma once
+/* header 1702 */
+#include <vector>
+#include "h7849.h"
+#include "h701.h"
+#include "h9257.h"
+#include "h2122.h"
+#include "h8469.h"
+#ifdef X
+#include "h9342.h"
+#endif
+struct S1702 { int a; const char *s = "x//y"; };
+inline int f1702_0(int x) { return x * 0; }
+inline int f1702_1(int x) { return x * 1; }
+inline int f1702_2(int x) { return x * 2; }
+inline int f1702_3(int x) { return x * 3; }
+inline int f1702_4(int x) { return x * 4; }
+inline int f1702_5(int x) { return x * 5; }
+inline int f1702_6(int x) { return x * 6; }
+inline int f1702_7(int x) { return x * 7; }
+inline int f1702_8(int x) { return x * 8; }
+inline int f1702_9(int x) { return x * 9; }
+inline int f1702_10(int x) { return x * 10; }
+inline int f1702_11(int x) { return x * 11; }
+inline int f1702_12(int x) { return x * 12; }
+inline int f1702_13(int x) { return x * 13; }
+inline int f1702_14(int x) { return x * 14; }
+inline int f1702_15(int x) { return x * 15; }
+inline int f1702_16(int x) { return x * 16; }
+inline int f1702_17(int x) { return x * 17; }
+inline int f1702_18(int x) { return x * 18; }
+inline int f1702_19(int x) { return x * 19; }
+inline int f1702_20(int x) { return x * 20; }
+inline int f1702_21(int x) { return x * 21; }
+inline int f1702_22(int x) { return x * 22; }
+inline int f1702_23(int x) { return x * 23; }
+inline int f1702_24(int x) { return x * 24; }
+inline int f1702_25(int x) { return x * 25; }
+inline int f1702_26(int x) { return x * 26; }
+inline int f1702_27(int x) { return x * 27; }
+inline int f1702_28(int x) { return x * 28; }
+inline int f1702_29(int x) { return x * 29; }
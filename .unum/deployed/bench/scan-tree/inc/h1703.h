@@ -0,0 +1,42 @@
+#pragma once
+/* header 1703 */
+#include <vector>
+#include "h4498.h"
+#include "h2839.h"
+#include "h5205.h"
+#include "h9093.h"
+#include "h6109.h"
+#ifdef X
+#include "h9314.h"
+#endif
+struct S1703 { int a; const char *s = "x//y"; };
+inline int f1703_0(int x) { return x * 0; }
+inline int f1703_1(int x) { return x * 1; }
+inline int f1703_2(int x) { return x * 2; }
+inline int f1703_3(int x) { return x * 3; }
+inline int f1703_4(int x) { return x * 4; }
+inline int f1703_5(int x) { return x * 5; }
+inline int f1703_6(int x) { return x * 6; }
+inline int f1703_7(int x) { return x * 7; }
+inline int f1703_8(int x) { return x * 8; }
+inline int f1703_9(int x) { return x * 9; }
+inline int f1703_10(int x) { return x * 10; }
+inline int f1703_11(int x) { return x * 11; }
+inline int f1703_12(int x) { return x * 12; }
+inline int f1703_13(int x) { return x * 13; }
+inline int f1703_14(int x) { return x * 14; }
+inline int f1703_15(int x) { return x * 15; }
+inline int f1703_16(int x) { return x * 16; }
+inline int f1703_17(int x) { return x * 17; }
+inline int f1703_18(int x) { return x * 18; }
+inline int f1703_19(int x) { return x * 19; }
+inline int f1703_20(int x) { return x * 20; }
+inline int f1703_21(int x) { return x * 21; }
+inline int f1703_22(int x) { return x * 22; }
+inline int f1703_23(int x) { return x * 23; }
+inline int f1703_24(int x) { return x * 24; }
+inline int f1703_25(int x) { return x * 25; }
+inline int f1703_26(int x) { return x * 26; }
+inline int f1703_27(int x) { return x * 27; }
+inline int f1703_28(int x) { return x * 28; }
+inline int f1703_29(int x) { return x * 29; }
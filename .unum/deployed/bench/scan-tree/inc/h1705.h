@@ -0,0 +1,42 @@
+#pragma once
+/* header 1705 */
+#include <vector>
+#include "h4479.h"
+#include "h769.h"
+#include "h1782.h"
+#include "h3080.h"
+#include "h1002.h"
+#ifdef X
+#include "h8274.h"
+#endif
+struct S1705 { int a; const char *s = "x//y"; };
+inline int f1705_0(int x) { return x * 0; }
+inline int f1705_1(int x) { return x * 1; }
+inline int f1705_2(int x) { return x * 2; }
+inline int f1705_3(int x) { return x * 3; }
+inline int f1705_4(int x) { return x * 4; }
+inline int f1705_5(int x) { return x * 5; }
+inline int f1705_6(int x) { return x * 6; }
+inline int f1705_7(int x) { return x * 7; }
+inline int f1705_8(int x) { return x * 8; }
+inline int f1705_9(int x) { return x * 9; }
+inline int f1705_10(int x) { return x * 10; }
+inline int f1705_11(int x) { return x * 11; }
+inline int f1705_12(int x) { return x * 12; }
+inline int f1705_13(int x) { return x * 13; }
+inline int f1705_14(int x) { return x * 14; }
+inline int f1705_15(int x) { return x * 15; }
+inline int f1705_16(int x) { return x * 16; }
+inline int f1705_17(int x) { return x * 17; }
+inline int f1705_18(int x) { return x * 18; }
+inline int f1705_19(int x) { return x * 19; }
+inline int f1705_20(int x) { return x * 20; }
+inline int f1705_21(int x) { return x * 21; }
+inline int f1705_22(int x) { return x * 22; }
+inline int f1705_23(int x) { return x * 23; }
+inline int f1705_24(int x) { return x * 24; }
+inline int f1705_25(int x) { return x * 25; }
+inline int f1705_26(int x) { return x * 26; }
+inline int f1705_27(int x) { return x * 27; }
+inline int f1705_28(int x) { return x * 28; }
+inline int f1705_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1708 */
+#include <vector>
+#include "h7557.h"
+#include "h6895.h"
+#include "h6549.h"
+#include "h1554.h"
+#include "h8458.h"
+#ifdef X
+#include "h6966.h"
+#endif
+struct S1708 { int a; const char *s = "x//y"; };
+inline int f1708_0(int x) { return x * 0; }
+inline int f1708_1(int x) { return x * 1; }
+inline int f1708_2(int x) { return x * 2; }
+inline int f1708_3(int x) { return x * 3; }
+inline int f1708_4(int x) { return x * 4; }
+inline int f1708_5(int x) { return x * 5; }
+inline int f1708_6(int x) { return x * 6; }
+inline int f1708_7(int x) { return x * 7; }
+inline int f1708_8(int x) { return x * 8; }
+inline int f1708_9(int x) { return x * 9; }
+inline int f1708_10(int x) { return x * 10; }
+inline int f1708_11(int x) { return x * 11; }
+inline int f1708_12(int x) { return x * 12; }
+inline int f1708_13(int x) { return x * 13; }
+inline int f1708_14(int x) { return x * 14; }
+inline int f1708_15(int x) { return x * 15; }
+inline int f1708_16(int x) { return x * 16; }
+inline int f1708_17(int x) { return x * 17; }
+inline int f1708_18(int x) { return x * 18; }
+inline int f1708_19(int x) { return x * 19; }
+inline int f1708_20(int x) { return x * 20; }
+inline int f1708_21(int x) { return x * 21; }
+inline int f1708_22(int x) { return x * 22; }
+inline int f1708_23(int x) { return x * 23; }
+inline int f1708_24(int x) { return x * 24; }
+inline int f1708_25(int x) { return x * 25; }
+inline int f1708_26(int x) { return x * 26; }
+inline int f1708_27(int x) { return x * 27; }
+inline int f1708_28(int x) { return x * 28; }
+inline int f1708_29(int x) { return x * 29; }
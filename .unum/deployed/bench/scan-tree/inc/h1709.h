@@ -0,0 +1,42 @@
+#pragma once
+/* header 1709 */
+#include <vector>
+#include "h8263.h"
+#include "h6721.h"
+#include "h2151.h"
+#include "h3396.h"
+#include "h986.h"
+#ifdef X
+#include "h6383.h"
+#endif
+struct S1709 { int a; const char *s = "x//y"; };
+inline int f1709_0(int x) { return x * 0; }
+inline int f1709_1(int x) { return x * 1; }
+inline int f1709_2(int x) { return x * 2; }
+inline int f1709_3(int x) { return x * 3; }
+inline int f1709_4(int x) { return x * 4; }
+inline int f1709_5(int x) { return x * 5; }
+inline int f1709_6(int x) { return x * 6; }
+inline int f1709_7(int x) { return x * 7; }
+inline int f1709_8(int x) { return x * 8; }
+inline int f1709_9(int x) { return x * 9; }
+inline int f1709_10(int x) { return x * 10; }
+inline int f1709_11(int x) { return x * 11; }
+inline int f1709_12(int x) { return x * 12; }
+inline int f1709_13(int x) { return x * 13; }
+inline int f1709_14(int x) { return x * 14; }
+inline int f1709_15(int x) { return x * 15; }
+inline int f1709_16(int x) { return x * 16; }
+inline int f1709_17(int x) { return x * 17; }
+inline int f1709_18(int x) { return x * 18; }
+inline int f1709_19(int x) { return x * 19; }
+inline int f1709_20(int x) { return x * 20; }
+inline int f1709_21(int x) { return x * 21; }
+inline int f1709_22(int x) { return x * 22; }
+inline int f1709_23(int x) { return x * 23; }
+inline int f1709_24(int x) { return x * 24; }
+inline int f1709_25(int x) { return x * 25; }
+inline int f1709_26(int x) { return x * 26; }
+inline int f1709_27(int x) { return x * 27; }
+inline int f1709_28(int x) { return x * 28; }
+inline int f1709_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1710 */
+#include <vector>
+#include "h3625.h"
+#include "h2953.h"
+#include "h945.h"
+#include "h7467.h"
+#include "h7290.h"
+#ifdef X
+#include "h6377.h"
+#endif
+struct S1710 { int a; const char *s = "x//y"; };
+inline int f1710_0(int x) { return x * 0; }
+inline int f1710_1(int x) { return x * 1; }
+inline int f1710_2(int x) { return x * 2; }
+inline int f1710_3(int x) { return x * 3; }
+inline int f1710_4(int x) { return x * 4; }
+inline int f1710_5(int x) { return x * 5; }
+inline int f1710_6(int x) { return x * 6; }
+inline int f1710_7(int x) { return x * 7; }
+inline int f1710_8(int x) { return x * 8; }
+inline int f1710_9(int x) { return x * 9; }
+inline int f1710_10(int x) { return x * 10; }
+inline int f1710_11(int x) { return x * 11; }
+inline int f1710_12(int x) { return x * 12; }
+inline int f1710_13(int x) { return x * 13; }
+inline int f1710_14(int x) { return x * 14; }
+inline int f1710_15(int x) { return x * 15; }
+inline int f1710_16(int x) { return x * 16; }
+inline int f1710_17(int x) { return x * 17; }
+inline int f1710_18(int x) { return x * 18; }
+inline int f1710_19(int x) { return x * 19; }
+inline int f1710_20(int x) { return x * 20; }
+inline int f1710_21(int x) { return x * 21; }
+inline int f1710_22(int x) { return x * 22; }
+inline int f1710_23(int x) { return x * 23; }
+inline int f1710_24(int x) { return x * 24; }
+inline int f1710_25(int x) { return x * 25; }
+inline int f1710_26(int x) { return x * 26; }
+inline int f1710_27(int x) { return x * 27; }
+inline int f1710_28(int x) { return x * 28; }
+inline int f1710_29(int x) { return x * 29; }
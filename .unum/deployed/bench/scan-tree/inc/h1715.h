@@ -0,0 +1,42 @@
+#pragma once
+/* header 1715 */
+#include <vector>
+#include "h9751.h"
+#include "h3651.h"
+#include "h8597.h"
+#include "h3620.h"
+#include "h9680.h"
+#ifdef X
+#include "h544.h"
+#endif
+struct S1715 { int a; const char *s = "x//y"; };
+inline int f1715_0(int x) { return x * 0; }
+inline int f1715_1(int x) { return x * 1; }
+inline int f1715_2(int x) { return x * 2; }
+inline int f1715_3(int x) { return x * 3; }
+inline int f1715_4(int x) { return x * 4; }
+inline int f1715_5(int x) { return x * 5; }
+inline int f1715_6(int x) { return x * 6; }
+inline int f1715_7(int x) { return x * 7; }
+inline int f1715_8(int x) { return x * 8; }
+inline int f1715_9(int x) { return x * 9; }
+inline int f1715_10(int x) { return x * 10; }
+inline int f1715_11(int x) { return x * 11; }
+inline int f1715_12(int x) { return x * 12; }
+inline int f1715_13(int x) { return x * 13; }
+inline int f1715_14(int x) { return x * 14; }
+inline int f1715_15(int x) { return x * 15; }
+inline int f1715_16(int x) { return x * 16; }
+inline int f1715_17(int x) { return x * 17; }
+inline int f1715_18(int x) { return x * 18; }
+inline int f1715_19(int x) { return x * 19; }
+inline int f1715_20(int x) { return x * 20; }
+inline int f1715_21(int x) { return x * 21; }
+inline int f1715_22(int x) { return x * 22; }
+inline int f1715_23(int x) { return x * 23; }
+inline int f1715_24(int x) { return x * 24; }
+inline int f1715_25(int x) { return x * 25; }
+inline int f1715_26(int x) { return x * 26; }
+inline int f1715_27(int x) { return x * 27; }
+inline int f1715_28(int x) { return x * 28; }
+inline int f1715_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 172 */
+#include <vector>
+#include "h5425.h"
+#include "h2340.h"
+#include "h7582.h"
+#include "h5159.h"
+#include "h9660.h"
+#ifdef X
+#include "h4613.h"
+#endif
+struct S172 { int a; const char *s = "x//y"; };
+inline int f172_0(int x) { return x * 0; }
+inline int f172_1(int x) { return x * 1; }
+inline int f172_2(int x) { return x * 2; }
+inline int f172_3(int x) { return x * 3; }
+inline int f172_4(int x) { return x * 4; }
+inline int f172_5(int x) { return x * 5; }
+inline int f172_6(int x) { return x * 6; }
+inline int f172_7(int x) { return x * 7; }
+inline int f172_8(int x) { return x * 8; }
+inline int f172_9(int x) { return x * 9; }
+inline int f172_10(int x) { return x * 10; }
+inline int f172_11(int x) { return x * 11; }
+inline int f172_12(int x) { return x * 12; }
+inline int f172_13(int x) { return x * 13; }
+inline int f172_14(int x) { return x * 14; }
+inline int f172_15(int x) { return x * 15; }
+inline int f172_16(int x) { return x * 16; }
+inline int f172_17(int x) { return x * 17; }
+inline int f172_18(int x) { return x * 18; }
+inline int f172_19(int x) { return x * 19; }
+inline int f172_20(int x) { return x * 20; }
+inline int f172_21(int x) { return x * 21; }
+inline int f172_22(int x) { return x * 22; }
+inline int f172_23(int x) { return x * 23; }
+inline int f172_24(int x) { return x * 24; }
+inline int f172_25(int x) { return x * 25; }
+inline int f172_26(int x) { return x * 26; }
+inline int f172_27(int x) { return x * 27; }
+inline int f172_28(int x) { return x * 28; }
+inline int f172_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1722 */
+#include <vector>
+#include "h3972.h"
+#include "h3546.h"
+#include "h5950.h"
+#include "h8763.h"
+#include "h3545.h"
+#ifdef X
+#include "h9949.h"
+#endif
+struct S1722 { int a; const char *s = "x//y"; };
+inline int f1722_0(int x) { return x * 0; }
+inline int f1722_1(int x) { return x * 1; }
+inline int f1722_2(int x) { return x * 2; }
+inline int f1722_3(int x) { return x * 3; }
+inline int f1722_4(int x) { return x * 4; }
+inline int f1722_5(int x) { return x * 5; }
+inline int f1722_6(int x) { return x * 6; }
+inline int f1722_7(int x) { return x * 7; }
+inline int f1722_8(int x) { return x * 8; }
+inline int f1722_9(int x) { return x * 9; }
+inline int f1722_10(int x) { return x * 10; }
+inline int f1722_11(int x) { return x * 11; }
+inline int f1722_12(int x) { return x * 12; }
+inline int f1722_13(int x) { return x * 13; }
+inline int f1722_14(int x) { return x * 14; }
+inline int f1722_15(int x) { return x * 15; }
+inline int f1722_16(int x) { return x * 16; }
+inline int f1722_17(int x) { return x * 17; }
+inline int f1722_18(int x) { return x * 18; }
+inline int f1722_19(int x) { return x * 19; }
+inline int f1722_20(int x) { return x * 20; }
+inline int f1722_21(int x) { return x * 21; }
+inline int f1722_22(int x) { return x * 22; }
+inline int f1722_23(int x) { return x * 23; }
+inline int f1722_24(int x) { return x * 24; }
+inline int f1722_25(int x) { return x * 25; }
+inline int f1722_26(int x) { return x * 26; }
+inline int f1722_27(int x) { return x * 27; }
+inline int f1722_28(int x) { return x * 28; }
+inline int f1722_29(int x) { return x * 29; }
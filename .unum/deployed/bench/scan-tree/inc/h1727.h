@@ -0,0 +1,42 @@
+#pragma once
+/* header 1727 */
+#include <vector>
+#include "h9611.h"
+#include "h7748.h"
+#include "h2660.h"
+#include "h9536.h"
+#include "h7733.h"
+#ifdef X
+#include "h8382.h"
+#endif
+struct S1727 { int a; const char *s = "x//y"; };
+inline int f1727_0(int x) { return x * 0; }
+inline int f1727_1(int x) { return x * 1; }
+inline int f1727_2(int x) { return x * 2; }
+inline int f1727_3(int x) { return x * 3; }
+inline int f1727_4(int x) { return x * 4; }
+inline int f1727_5(int x) { return x * 5; }
+inline int f1727_6(int x) { return x * 6; }
+inline int f1727_7(int x) { return x * 7; }
+inline int f1727_8(int x) { return x * 8; }
+inline int f1727_9(int x) { return x * 9; }
+inline int f1727_10(int x) { return x * 10; }
+inline int f1727_11(int x) { return x * 11; }
+inline int f1727_12(int x) { return x * 12; }
+inline int f1727_13(int x) { return x * 13; }
+inline int f1727_14(int x) { return x * 14; }
+inline int f1727_15(int x) { return x * 15; }
+inline int f1727_16(int x) { return x * 16; }
+inline int f1727_17(int x) { return x * 17; }
+inline int f1727_18(int x) { return x * 18; }
+inline int f1727_19(int x) { return x * 19; }
+inline int f1727_20(int x) { return x * 20; }
+inline int f1727_21(int x) { return x * 21; }
+inline int f1727_22(int x) { return x * 22; }
+inline int f1727_23(int x) { return x * 23; }
+inline int f1727_24(int x) { return x * 24; }
+inline int f1727_25(int x) { return x * 25; }
+inline int f1727_26(int x) { return x * 26; }
+inline int f1727_27(int x) { return x * 27; }
+inline int f1727_28(int x) { return x * 28; }
+inline int f1727_29(int x) { return x * 29; }
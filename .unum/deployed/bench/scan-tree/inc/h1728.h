@@ -0,0 +1,42 @@
+#pragma once
+/* header 1728 */
+#include <vector>
+#include "h5840.h"
+#include "h8944.h"
+#include "h1748.h"
+#include "h8075.h"
+#include "h5057.h"
+#ifdef X
+#include "h3011.h"
+#endif
+struct S1728 { int a; const char *s = "x//y"; };
+inline int f1728_0(int x) { return x * 0; }
+inline int f1728_1(int x) { return x * 1; }
+inline int f1728_2(int x) { return x * 2; }
+inline int f1728_3(int x) { return x * 3; }
+inline int f1728_4(int x) { return x * 4; }
+inline int f1728_5(int x) { return x * 5; }
+inline int f1728_6(int x) { return x * 6; }
+inline int f1728_7(int x) { return x * 7; }
+inline int f1728_8(int x) { return x * 8; }
+inline int f1728_9(int x) { return x * 9; }
+inline int f1728_10(int x) { return x * 10; }
+inline int f1728_11(int x) { return x * 11; }
+inline int f1728_12(int x) { return x * 12; }
+inline int f1728_13(int x) { return x * 13; }
+inline int f1728_14(int x) { return x * 14; }
+inline int f1728_15(int x) { return x * 15; }
+inline int f1728_16(int x) { return x * 16; }
+inline int f1728_17(int x) { return x * 17; }
+inline int f1728_18(int x) { return x * 18; }
+inline int f1728_19(int x) { return x * 19; }
+inline int f1728_20(int x) { return x * 20; }
+inline int f1728_21(int x) { return x * 21; }
+inline int f1728_22(int x) { return x * 22; }
+inline int f1728_23(int x) { return x * 23; }
+inline int f1728_24(int x) { return x * 24; }
+inline int f1728_25(int x) { return x * 25; }
+inline int f1728_26(int x) { return x * 26; }
+inline int f1728_27(int x) { return x * 27; }
+inline int f1728_28(int x) { return x * 28; }
+inline int f1728_29(int x) { return x * 29; }
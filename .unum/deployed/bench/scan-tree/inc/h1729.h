@@ -0,0 +1,42 @@
+#pragma once
+/* header 1729 */
+#include <vector>
+#include "h3608.h"
+#include "h3443.h"
+#include "h7442.h"
+#include "h4088.h"
+#include "h6372.h"
+#ifdef X
+#include "h2968.h"
+#endif
+struct S1729 { int a; const char *s = "x//y"; };
+inline int f1729_0(int x) { return x * 0; }
+inline int f1729_1(int x) { return x * 1; }
+inline int f1729_2(int x) { return x * 2; }
+inline int f1729_3(int x) { return x * 3; }
+inline int f1729_4(int x) { return x * 4; }
+inline int f1729_5(int x) { return x * 5; }
+inline int f1729_6(int x) { return x * 6; }
+inline int f1729_7(int x) { return x * 7; }
+inline int f1729_8(int x) { return x * 8; }
+inline int f1729_9(int x) { return x * 9; }
+inline int f1729_10(int x) { return x * 10; }
+inline int f1729_11(int x) { return x * 11; }
+inline int f1729_12(int x) { return x * 12; }
+inline int f1729_13(int x) { return x * 13; }
+inline int f1729_14(int x) { return x * 14; }
+inline int f1729_15(int x) { return x * 15; }
+inline int f1729_16(int x) { return x * 16; }
+inline int f1729_17(int x) { return x * 17; }
+inline int f1729_18(int x) { return x * 18; }
+inline int f1729_19(int x) { return x * 19; }
+inline int f1729_20(int x) { return x * 20; }
+inline int f1729_21(int x) { return x * 21; }
+inline int f1729_22(int x) { return x * 22; }
+inline int f1729_23(int x) { return x * 23; }
+inline int f1729_24(int x) { return x * 24; }
+inline int f1729_25(int x) { return x * 25; }
+inline int f1729_26(int x) { return x * 26; }
+inline int f1729_27(int x) { return x * 27; }
+inline int f1729_28(int x) { return x * 28; }
+inline int f1729_29(int x) { return x * 29; }
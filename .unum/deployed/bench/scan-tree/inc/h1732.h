@@ -0,0 +1,42 @@
+#pragma once
+/* header 1732 */
+#include <vector>
+#include "h2504.h"
+#include "h874.h"
+#include "h8442.h"
+#include "h9847.h"
+#include "h3469.h"
+#ifdef X
+#include "h8696.h"
+#endif
+struct S1732 { int a; const char *s = "x//y"; };
+inline int f1732_0(int x) { return x * 0; }
+inline int f1732_1(int x) { return x * 1; }
+inline int f1732_2(int x) { return x * 2; }
+inline int f1732_3(int x) { return x * 3; }
+inline int f1732_4(int x) { return x * 4; }
+inline int f1732_5(int x) { return x * 5; }
+inline int f1732_6(int x) { return x * 6; }
+inline int f1732_7(int x) { return x * 7; }
+inline int f1732_8(int x) { return x * 8; }
+inline int f1732_9(int x) { return x * 9; }
+inline int f1732_10(int x) { return x * 10; }
+inline int f1732_11(int x) { return x * 11; }
+inline int f1732_12(int x) { return x * 12; }
+inline int f1732_13(int x) { return x * 13; }
+inline int f1732_14(int x) { return x * 14; }
+inline int f1732_15(int x) { return x * 15; }
+inline int f1732_16(int x) { return x * 16; }
+inline int f1732_17(int x) { return x * 17; }
+inline int f1732_18(int x) { return x * 18; }
+inline int f1732_19(int x) { return x * 19; }
+inline int f1732_20(int x) { return x * 20; }
+inline int f1732_21(int x) { return x * 21; }
+inline int f1732_22(int x) { return x * 22; }
+inline int f1732_23(int x) { return x * 23; }
+inline int f1732_24(int x) { return x * 24; }
+inline int f1732_25(int x) { return x * 25; }
+inline int f1732_26(int x) { return x * 26; }
+inline int f1732_27(int x) { return x * 27; }
+inline int f1732_28(int x) { return x * 28; }
+inline int f1732_29(int x) { return x * 29; }
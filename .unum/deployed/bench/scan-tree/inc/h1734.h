@@ -0,0 +1,42 @@
+#pragma once
+/* header 1734 */
+#include <vector>
+#include "h7160.h"
+#include "h2388.h"
+#include "h9259.h"
+#include "h3374.h"
+#include "h5168.h"
+#ifdef X
+#include "h7833.h"
+#endif
+struct S1734 { int a; const char *s = "x//y"; };
+inline int f1734_0(int x) { return x * 0; }
+inline int f1734_1(int x) { return x * 1; }
+inline int f1734_2(int x) { return x * 2; }
+inline int f1734_3(int x) { return x * 3; }
+inline int f1734_4(int x) { return x * 4; }
+inline int f1734_5(int x) { return x * 5; }
+inline int f1734_6(int x) { return x * 6; }
+inline int f1734_7(int x) { return x * 7; }
+inline int f1734_8(int x) { return x * 8; }
+inline int f1734_9(int x) { return x * 9; }
+inline int f1734_10(int x) { return x * 10; }
+inline int f1734_11(int x) { return x * 11; }
+inline int f1734_12(int x) { return x * 12; }
+inline int f1734_13(int x) { return x * 13; }
+inline int f1734_14(int x) { return x * 14; }
+inline int f1734_15(int x) { return x * 15; }
+inline int f1734_16(int x) { return x * 16; }
+inline int f1734_17(int x) { return x * 17; }
+inline int f1734_18(int x) { return x * 18; }
+inline int f1734_19(int x) { return x * 19; }
+inline int f1734_20(int x) { return x * 20; }
+inline int f1734_21(int x) { return x * 21; }
+inline int f1734_22(int x) { return x * 22; }
+inline int f1734_23(int x) { return x * 23; }
+inline int f1734_24(int x) { return x * 24; }
+inline int f1734_25(int x) { return x * 25; }
+inline int f1734_26(int x) { return x * 26; }
+inline int f1734_27(int x) { return x * 27; }
+inline int f1734_28(int x) { return x * 28; }
+inline int f1734_29(int x) { return x * 29; }
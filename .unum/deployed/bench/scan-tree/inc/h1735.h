@@ -0,0 +1,42 @@
+#pragma once
+/* header 1735 */
+#include <vector>
+#include "h8696.h"
+#include "h77.h"
+#include "h2183.h"
+#include "h4596.h"
+#include "h9501.h"
+#ifdef X
+#include "h3039.h"
+#endif
+struct S1735 { int a; const char *s = "x//y"; };
+inline int f1735_0(int x) { return x * 0; }
+inline int f1735_1(int x) { return x * 1; }
+inline int f1735_2(int x) { return x * 2; }
+inline int f1735_3(int x) { return x * 3; }
+inline int f1735_4(int x) { return x * 4; }
+inline int f1735_5(int x) { return x * 5; }
+inline int f1735_6(int x) { return x * 6; }
+inline int f1735_7(int x) { return x * 7; }
+inline int f1735_8(int x) { return x * 8; }
+inline int f1735_9(int x) { return x * 9; }
+inline int f1735_10(int x) { return x * 10; }
+inline int f1735_11(int x) { return x * 11; }
+inline int f1735_12(int x) { return x * 12; }
+inline int f1735_13(int x) { return x * 13; }
+inline int f1735_14(int x) { return x * 14; }
+inline int f1735_15(int x) { return x * 15; }
+inline int f1735_16(int x) { return x * 16; }
+inline int f1735_17(int x) { return x * 17; }
+inline int f1735_18(int x) { return x * 18; }
+inline int f1735_19(int x) { return x * 19; }
+inline int f1735_20(int x) { return x * 20; }
+inline int f1735_21(int x) { return x * 21; }
+inline int f1735_22(int x) { return x * 22; }
+inline int f1735_23(int x) { return x * 23; }
+inline int f1735_24(int x) { return x * 24; }
+inline int f1735_25(int x) { return x * 25; }
+inline int f1735_26(int x) { return x * 26; }
+inline int f1735_27(int x) { return x * 27; }
+inline int f1735_28(int x) { return x * 28; }
+inline int f1735_29(int x) { return x * 29; }
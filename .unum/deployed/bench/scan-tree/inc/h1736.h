@@ -0,0 +1,42 @@
+#pragma once
+/* header 1736 */
+#include <vector>
+#include "h4654.h"
+#include "h912.h"
+#include "h4095.h"
+#include "h4504.h"
+#include "h3139.h"
+#ifdef X
+#include "h44.h"
+#endif
+struct S1736 { int a; const char *s = "x//y"; };
+inline int f1736_0(int x) { return x * 0; }
+inline int f1736_1(int x) { return x * 1; }
+inline int f1736_2(int x) { return x * 2; }
+inline int f1736_3(int x) { return x * 3; }
+inline int f1736_4(int x) { return x * 4; }
+inline int f1736_5(int x) { return x * 5; }
+inline int f1736_6(int x) { return x * 6; }
+inline int f1736_7(int x) { return x * 7; }
+inline int f1736_8(int x) { return x * 8; }
+inline int f1736_9(int x) { return x * 9; }
+inline int f1736_10(int x) { return x * 10; }
+inline int f1736_11(int x) { return x * 11; }
+inline int f1736_12(int x) { return x * 12; }
+inline int f1736_13(int x) { return x * 13; }
+inline int f1736_14(int x) { return x * 14; }
+inline int f1736_15(int x) { return x * 15; }
+inline int f1736_16(int x) { return x * 16; }
+inline int f1736_17(int x) { return x * 17; }
+inline int f1736_18(int x) { return x * 18; }
+inline int f1736_19(int x) { return x * 19; }
+inline int f1736_20(int x) { return x * 20; }
+inline int f1736_21(int x) { return x * 21; }
+inline int f1736_22(int x) { return x * 22; }
+inline int f1736_23(int x) { return x * 23; }
+inline int f1736_24(int x) { return x * 24; }
+inline int f1736_25(int x) { return x * 25; }
+inline int f1736_26(int x) { return x * 26; }
+inline int f1736_27(int x) { return x * 27; }
+inline int f1736_28(int x) { return x * 28; }
+inline int f1736_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1737 */
+#include <vector>
+#include "h6911.h"
+#include "h1866.h"
+#include "h5241.h"
+#include "h1186.h"
+#include "h3089.h"
+#ifdef X
+#include "h1649.h"
+#endif
+struct S1737 { int a; const char *s = "x//y"; };
+inline int f1737_0(int x) { return x * 0; }
+inline int f1737_1(int x) { return x * 1; }
+inline int f1737_2(int x) { return x * 2; }
+inline int f1737_3(int x) { return x * 3; }
+inline int f1737_4(int x) { return x * 4; }
+inline int f1737_5(int x) { return x * 5; }
+inline int f1737_6(int x) { return x * 6; }
+inline int f1737_7(int x) { return x * 7; }
+inline int f1737_8(int x) { return x * 8; }
+inline int f1737_9(int x) { return x * 9; }
+inline int f1737_10(int x) { return x * 10; }
+inline int f1737_11(int x) { return x * 11; }
+inline int f1737_12(int x) { return x * 12; }
+inline int f1737_13(int x) { return x * 13; }
+inline int f1737_14(int x) { return x * 14; }
+inline int f1737_15(int x) { return x * 15; }
+inline int f1737_16(int x) { return x * 16; }
+inline int f1737_17(int x) { return x * 17; }
+inline int f1737_18(int x) { return x * 18; }
+inline int f1737_19(int x) { return x * 19; }
+inline int f1737_20(int x) { return x * 20; }
+inline int f1737_21(int x) { return x * 21; }
+inline int f1737_22(int x) { return x * 22; }
+inline int f1737_23(int x) { return x * 23; }
+inline int f1737_24(int x) { return x * 24; }
+inline int f1737_25(int x) { return x * 25; }
+inline int f1737_26(int x) { return x * 26; }
+inline int f1737_27(int x) { return x * 27; }
+inline int f1737_28(int x) { return x * 28; }
+inline int f1737_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1738 */
+#include <vector>
+#include "h9945.h"
+#include "h1435.h"
+#include "h8865.h"
+#include "h4946.h"
+#include "h8808.h"
+#ifdef X
+#include "h9001.h"
+#endif
+struct S1738 { int a; const char *s = "x//y"; };
+inline int f1738_0(int x) { return x * 0; }
+inline int f1738_1(int x) { return x * 1; }
+inline int f1738_2(int x) { return x * 2; }
+inline int f1738_3(int x) { return x * 3; }
+inline int f1738_4(int x) { return x * 4; }
+inline int f1738_5(int x) { return x * 5; }
+inline int f1738_6(int x) { return x * 6; }
+inline int f1738_7(int x) { return x * 7; }
+inline int f1738_8(int x) { return x * 8; }
+inline int f1738_9(int x) { return x * 9; }
+inline int f1738_10(int x) { return x * 10; }
+inline int f1738_11(int x) { return x * 11; }
+inline int f1738_12(int x) { return x * 12; }
+inline int f1738_13(int x) { return x * 13; }
+inline int f1738_14(int x) { return x * 14; }
+inline int f1738_15(int x) { return x * 15; }
+inline int f1738_16(int x) { return x * 16; }
+inline int f1738_17(int x) { return x * 17; }
+inline int f1738_18(int x) { return x * 18; }
+inline int f1738_19(int x) { return x * 19; }
+inline int f1738_20(int x) { return x * 20; }
+inline int f1738_21(int x) { return x * 21; }
+inline int f1738_22(int x) { return x * 22; }
+inline int f1738_23(int x) { return x * 23; }
+inline int f1738_24(int x) { return x * 24; }
+inline int f1738_25(int x) { return x * 25; }
+inline int f1738_26(int x) { return x * 26; }
+inline int f1738_27(int x) { return x * 27; }
+inline int f1738_28(int x) { return x * 28; }
+inline int f1738_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1739 */
+#include <vector>
+#include "h415.h"
+#include "h4161.h"
+#include "h6889.h"
+#include "h9884.h"
+#include "h6337.h"
+#ifdef X
+#include "h6362.h"
+#endif
+struct S1739 { int a; const char *s = "x//y"; };
+inline int f1739_0(int x) { return x * 0; }
+inline int f1739_1(int x) { return x * 1; }
+inline int f1739_2(int x) { return x * 2; }
+inline int f1739_3(int x) { return x * 3; }
+inline int f1739_4(int x) { return x * 4; }
+inline int f1739_5(int x) { return x * 5; }
+inline int f1739_6(int x) { return x * 6; }
+inline int f1739_7(int x) { return x * 7; }
+inline int f1739_8(int x) { return x * 8; }
+inline int f1739_9(int x) { return x * 9; }
+inline int f1739_10(int x) { return x * 10; }
+inline int f1739_11(int x) { return x * 11; }
+inline int f1739_12(int x) { return x * 12; }
+inline int f1739_13(int x) { return x * 13; }
+inline int f1739_14(int x) { return x * 14; }
+inline int f1739_15(int x) { return x * 15; }
+inline int f1739_16(int x) { return x * 16; }
+inline int f1739_17(int x) { return x * 17; }
+inline int f1739_18(int x) { return x * 18; }
+inline int f1739_19(int x) { return x * 19; }
+inline int f1739_20(int x) { return x * 20; }
+inline int f1739_21(int x) { return x * 21; }
+inline int f1739_22(int x) { return x * 22; }
+inline int f1739_23(int x) { return x * 23; }
+inline int f1739_24(int x) { return x * 24; }
+inline int f1739_25(int x) { return x * 25; }
+inline int f1739_26(int x) { return x * 26; }
+inline int f1739_27(int x) { return x * 27; }
+inline int f1739_28(int x) { return x * 28; }
+inline int f1739_29(int x) { return x * 29; }
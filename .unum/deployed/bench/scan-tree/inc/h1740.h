@@ -0,0 +1,42 @@
+#pragma once
+/* header 1740 */
+#include <vector>
+#include "h571.h"
+#include "h7995.h"
+#include "h7402.h"
+#include "h2542.h"
+#include "h9616.h"
+#ifdef X
+#include "h6099.h"
+#endif
+struct S1740 { int a; const char *s = "x//y"; };
+inline int f1740_0(int x) { return x * 0; }
+inline int f1740_1(int x) { return x * 1; }
+inline int f1740_2(int x) { return x * 2; }
+inline int f1740_3(int x) { return x * 3; }
+inline int f1740_4(int x) { return x * 4; }
+inline int f1740_5(int x) { return x * 5; }
+inline int f1740_6(int x) { return x * 6; }
+inline int f1740_7(int x) { return x * 7; }
+inline int f1740_8(int x) { return x * 8; }
+inline int f1740_9(int x) { return x * 9; }
+inline int f1740_10(int x) { return x * 10; }
+inline int f1740_11(int x) { return x * 11; }
+inline int f1740_12(int x) { return x * 12; }
+inline int f1740_13(int x) { return x * 13; }
+inline int f1740_14(int x) { return x * 14; }
+inline int f1740_15(int x) { return x * 15; }
+inline int f1740_16(int x) { return x * 16; }
+inline int f1740_17(int x) { return x * 17; }
+inline int f1740_18(int x) { return x * 18; }
+inline int f1740_19(int x) { return x * 19; }
+inline int f1740_20(int x) { return x * 20; }
+inline int f1740_21(int x) { return x * 21; }
+inline int f1740_22(int x) { return x * 22; }
+inline int f1740_23(int x) { return x * 23; }
+inline int f1740_24(int x) { return x * 24; }
+inline int f1740_25(int x) { return x * 25; }
+inline int f1740_26(int x) { return x * 26; }
+inline int f1740_27(int x) { return x * 27; }
+inline int f1740_28(int x) { return x * 28; }
+inline int f1740_29(int x) { return x * 29; }
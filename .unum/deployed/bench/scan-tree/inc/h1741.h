@@ -0,0 +1,42 @@
+#pragma once
+/* header 1741 */
+#include <vector>
+#include "h8426.h"
+#include "h6661.h"
+#include "h9282.h"
+#include "h1069.h"
+#include "h620.h"
+#ifdef X
+#include "h4924.h"
+#endif
+struct S1741 { int a; const char *s = "x//y"; };
+inline int f1741_0(int x) { return x * 0; }
+inline int f1741_1(int x) { return x * 1; }
+inline int f1741_2(int x) { return x * 2; }
+inline int f1741_3(int x) { return x * 3; }
+inline int f1741_4(int x) { return x * 4; }
+inline int f1741_5(int x) { return x * 5; }
+inline int f1741_6(int x) { return x * 6; }
+inline int f1741_7(int x) { return x * 7; }
+inline int f1741_8(int x) { return x * 8; }
+inline int f1741_9(int x) { return x * 9; }
+inline int f1741_10(int x) { return x * 10; }
+inline int f1741_11(int x) { return x * 11; }
+inline int f1741_12(int x) { return x * 12; }
+inline int f1741_13(int x) { return x * 13; }
+inline int f1741_14(int x) { return x * 14; }
+inline int f1741_15(int x) { return x * 15; }
+inline int f1741_16(int x) { return x * 16; }
+inline int f1741_17(int x) { return x * 17; }
+inline int f1741_18(int x) { return x * 18; }
+inline int f1741_19(int x) { return x * 19; }
+inline int f1741_20(int x) { return x * 20; }
+inline int f1741_21(int x) { return x * 21; }
+inline int f1741_22(int x) { return x * 22; }
+inline int f1741_23(int x) { return x * 23; }
+inline int f1741_24(int x) { return x * 24; }
+inline int f1741_25(int x) { return x * 25; }
+inline int f1741_26(int x) { return x * 26; }
+inline int f1741_27(int x) { return x * 27; }
+inline int f1741_28(int x) { return x * 28; }
+inline int f1741_29(int x) { return x * 29; }
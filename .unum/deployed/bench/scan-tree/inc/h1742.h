@@ -0,0 +1,42 @@
+#pragma once
+/* header 1742 */
+#include <vector>
+#include "h8468.h"
+#include "h6413.h"
+#include "h6302.h"
+#include "h1517.h"
+#include "h2949.h"
+#ifdef X
+#include "h9645.h"
+#endif
+struct S1742 { int a; const char *s = "x//y"; };
+inline int f1742_0(int x) { return x * 0; }
+inline int f1742_1(int x) { return x * 1; }
+inline int f1742_2(int x) { return x * 2; }
+inline int f1742_3(int x) { return x * 3; }
+inline int f1742_4(int x) { return x * 4; }
+inline int f1742_5(int x) { return x * 5; }
+inline int f1742_6(int x) { return x * 6; }
+inline int f1742_7(int x) { return x * 7; }
+inline int f1742_8(int x) { return x * 8; }
+inline int f1742_9(int x) { return x * 9; }
+inline int f1742_10(int x) { return x * 10; }
+inline int f1742_11(int x) { return x * 11; }
+inline int f1742_12(int x) { return x * 12; }
+inline int f1742_13(int x) { return x * 13; }
+inline int f1742_14(int x) { return x * 14; }
+inline int f1742_15(int x) { return x * 15; }
+inline int f1742_16(int x) { return x * 16; }
+inline int f1742_17(int x) { return x * 17; }
+inline int f1742_18(int x) { return x * 18; }
+inline int f1742_19(int x) { return x * 19; }
+inline int f1742_20(int x) { return x * 20; }
+inline int f1742_21(int x) { return x * 21; }
+inline int f1742_22(int x) { return x * 22; }
+inline int f1742_23(int x) { return x * 23; }
+inline int f1742_24(int x) { return x * 24; }
+inline int f1742_25(int x) { return x * 25; }
+inline int f1742_26(int x) { return x * 26; }
+inline int f1742_27(int x) { return x * 27; }
+inline int f1742_28(int x) { return x * 28; }
+inline int f1742_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1743 */
+#include <vector>
+#include "h6764.h"
+#include "h4414.h"
+#include "h1092.h"
+#include "h4241.h"
+#include "h6469.h"
+#ifdef X
+#include "h3570.h"
+#endif
+struct S1743 { int a; const char *s = "x//y"; };
+inline int f1743_0(int x) { return x * 0; }
+inline int f1743_1(int x) { return x * 1; }
+inline int f1743_2(int x) { return x * 2; }
+inline int f1743_3(int x) { return x * 3; }
+inline int f1743_4(int x) { return x * 4; }
+inline int f1743_5(int x) { return x * 5; }
+inline int f1743_6(int x) { return x * 6; }
+inline int f1743_7(int x) { return x * 7; }
+inline int f1743_8(int x) { return x * 8; }
+inline int f1743_9(int x) { return x * 9; }
+inline int f1743_10(int x) { return x * 10; }
+inline int f1743_11(int x) { return x * 11; }
+inline int f1743_12(int x) { return x * 12; }
+inline int f1743_13(int x) { return x * 13; }
+inline int f1743_14(int x) { return x * 14; }
+inline int f1743_15(int x) { return x * 15; }
+inline int f1743_16(int x) { return x * 16; }
+inline int f1743_17(int x) { return x * 17; }
+inline int f1743_18(int x) { return x * 18; }
+inline int f1743_19(int x) { return x * 19; }
+inline int f1743_20(int x) { return x * 20; }
+inline int f1743_21(int x) { return x * 21; }
+inline int f1743_22(int x) { return x * 22; }
+inline int f1743_23(int x) { return x * 23; }
+inline int f1743_24(int x) { return x * 24; }
+inline int f1743_25(int x) { return x * 25; }
+inline int f1743_26(int x) { return x * 26; }
+inline int f1743_27(int x) { return x * 27; }
+inline int f1743_28(int x) { return x * 28; }
+inline int f1743_29(int x) { return x * 29; }
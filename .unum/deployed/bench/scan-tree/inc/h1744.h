@@ -0,0 +1,42 @@
+#pragma once
+/* header 1744 */
+#include <vector>
+#include "h3723.h"
+#include "h1728.h"
+#include "h4996.h"
+#include "h8643.h"
+#include "h5252.h"
+#ifdef X
+#include "h7990.h"
+#endif
+struct S1744 { int a; const char *s = "x//y"; };
+inline int f1744_0(int x) { return x * 0; }
+inline int f1744_1(int x) { return x * 1; }
+inline int f1744_2(int x) { return x * 2; }
+inline int f1744_3(int x) { return x * 3; }
+inline int f1744_4(int x) { return x * 4; }
+inline int f1744_5(int x) { return x * 5; }
+inline int f1744_6(int x) { return x * 6; }
+inline int f1744_7(int x) { return x * 7; }
+inline int f1744_8(int x) { return x * 8; }
+inline int f1744_9(int x) { return x * 9; }
+inline int f1744_10(int x) { return x * 10; }
+inline int f1744_11(int x) { return x * 11; }
+inline int f1744_12(int x) { return x * 12; }
+inline int f1744_13(int x) { return x * 13; }
+inline int f1744_14(int x) { return x * 14; }
+inline int f1744_15(int x) { return x * 15; }
+inline int f1744_16(int x) { return x * 16; }
+inline int f1744_17(int x) { return x * 17; }
+inline int f1744_18(int x) { return x * 18; }
+inline int f1744_19(int x) { return x * 19; }
+inline int f1744_20(int x) { return x * 20; }
+inline int f1744_21(int x) { return x * 21; }
+inline int f1744_22(int x) { return x * 22; }
+inline int f1744_23(int x) { return x * 23; }
+inline int f1744_24(int x) { return x * 24; }
+inline int f1744_25(int x) { return x * 25; }
+inline int f1744_26(int x) { return x * 26; }
+inline int f1744_27(int x) { return x * 27; }
+inline int f1744_28(int x) { return x * 28; }
+inline int f1744_29(int x) { return x * 29; }
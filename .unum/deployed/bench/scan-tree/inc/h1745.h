@@ -0,0 +1,42 @@
+#pragma once
+/* header 1745 */
+#include <vector>
+#include "h8913.h"
+#include "h9183.h"
+#include "h8146.h"
+#include "h3867.h"
+#include "h1251.h"
+#ifdef X
+#include "h1706.h"
+#endif
+struct S1745 { int a; const char *s = "x//y"; };
+inline int f1745_0(int x) { return x * 0; }
+inline int f1745_1(int x) { return x * 1; }
+inline int f1745_2(int x) { return x * 2; }
+inline int f1745_3(int x) { return x * 3; }
+inline int f1745_4(int x) { return x * 4; }
+inline int f1745_5(int x) { return x * 5; }
+inline int f1745_6(int x) { return x * 6; }
+inline int f1745_7(int x) { return x * 7; }
+inline int f1745_8(int x) { return x * 8; }
+inline int f1745_9(int x) { return x * 9; }
+inline int f1745_10(int x) { return x * 10; }
+inline int f1745_11(int x) { return x * 11; }
+inline int f1745_12(int x) { return x * 12; }
+inline int f1745_13(int x) { return x * 13; }
+inline int f1745_14(int x) { return x * 14; }
+inline int f1745_15(int x) { return x * 15; }
+inline int f1745_16(int x) { return x * 16; }
+inline int f1745_17(int x) { return x * 17; }
+inline int f1745_18(int x) { return x * 18; }
+inline int f1745_19(int x) { return x * 19; }
+inline int f1745_20(int x) { return x * 20; }
+inline int f1745_21(int x) { return x * 21; }
+inline int f1745_22(int x) { return x * 22; }
+inline int f1745_23(int x) { return x * 23; }
+inline int f1745_24(int x) { return x * 24; }
+inline int f1745_25(int x) { return x * 25; }
+inline int f1745_26(int x) { return x * 26; }
+inline int f1745_27(int x) { return x * 27; }
+inline int f1745_28(int x) { return x * 28; }
+inline int f1745_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1747 */
+#include <vector>
+#include "h5223.h"
+#include "h512.h"
+#include "h7543.h"
+#include "h4527.h"
+#include "h8705.h"
+#ifdef X
+#include "h3308.h"
+#endif
+struct S1747 { int a; const char *s = "x//y"; };
+inline int f1747_0(int x) { return x * 0; }
+inline int f1747_1(int x) { return x * 1; }
+inline int f1747_2(int x) { return x * 2; }
+inline int f1747_3(int x) { return x * 3; }
+inline int f1747_4(int x) { return x * 4; }
+inline int f1747_5(int x) { return x * 5; }
+inline int f1747_6(int x) { return x * 6; }
+inline int f1747_7(int x) { return x * 7; }
+inline int f1747_8(int x) { return x * 8; }
+inline int f1747_9(int x) { return x * 9; }
+inline int f1747_10(int x) { return x * 10; }
+inline int f1747_11(int x) { return x * 11; }
+inline int f1747_12(int x) { return x * 12; }
+inline int f1747_13(int x) { return x * 13; }
+inline int f1747_14(int x) { return x * 14; }
+inline int f1747_15(int x) { return x * 15; }
+inline int f1747_16(int x) { return x * 16; }
+inline int f1747_17(int x) { return x * 17; }
+inline int f1747_18(int x) { return x * 18; }
+inline int f1747_19(int x) { return x * 19; }
+inline int f1747_20(int x) { return x * 20; }
+inline int f1747_21(int x) { return x * 21; }
+inline int f1747_22(int x) { return x * 22; }
+inline int f1747_23(int x) { return x * 23; }
+inline int f1747_24(int x) { return x * 24; }
+inline int f1747_25(int x) { return x * 25; }
+inline int f1747_26(int x) { return x * 26; }
+inline int f1747_27(int x) { return x * 27; }
+inline int f1747_28(int x) { return x * 28; }
+inline int f1747_29(int x) { return x * 29; }
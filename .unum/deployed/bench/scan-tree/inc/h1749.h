@@ -0,0 +1,42 @@
+#pragma once
+/* header 1749 */
+#include <vector>
+#include "h1416.h"
+#include "h4328.h"
+#include "h754.h"
+#include "h6431.h"
+#include "h9659.h"
+#ifdef X
+#include "h2411.h"
+#endif
+struct S1749 { int a; const char *s = "x//y"; };
+inline int f1749_0(int x) { return x * 0; }
+inline int f1749_1(int x) { return x * 1; }
+inline int f1749_2(int x) { return x * 2; }
+inline int f1749_3(int x) { return x * 3; }
+inline int f1749_4(int x) { return x * 4; }
+inline int f1749_5(int x) { return x * 5; }
+inline int f1749_6(int x) { return x * 6; }
+inline int f1749_7(int x) { return x * 7; }
+inline int f1749_8(int x) { return x * 8; }
+inline int f1749_9(int x) { return x * 9; }
+inline int f1749_10(int x) { return x * 10; }
+inline int f1749_11(int x) { return x * 11; }
+inline int f1749_12(int x) { return x * 12; }
+inline int f1749_13(int x) { return x * 13; }
+inline int f1749_14(int x) { return x * 14; }
+inline int f1749_15(int x) { return x * 15; }
+inline int f1749_16(int x) { return x * 16; }
+inline int f1749_17(int x) { return x * 17; }
+inline int f1749_18(int x) { return x * 18; }
+inline int f1749_19(int x) { return x * 19; }
+inline int f1749_20(int x) { return x * 20; }
+inline int f1749_21(int x) { return x * 21; }
+inline int f1749_22(int x) { return x * 22; }
+inline int f1749_23(int x) { return x * 23; }
+inline int f1749_24(int x) { return x * 24; }
+inline int f1749_25(int x) { return x * 25; }
+inline int f1749_26(int x) { return x * 26; }
+inline int f1749_27(int x) { return x * 27; }
+inline int f1749_28(int x) { return x * 28; }
+inline int f1749_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 175 */
+#include <vector>
+#include "h2340.h"
+#include "h1299.h"
+#include "h4860.h"
+#include "h6777.h"
+#include "h2972.h"
+#ifdef X
+#include "h5913.h"
+#endif
+struct S175 { int a; const char *s = "x//y"; };
+inline int f175_0(int x) { return x * 0; }
+inline int f175_1(int x) { return x * 1; }
+inline int f175_2(int x) { return x * 2; }
+inline int f175_3(int x) { return x * 3; }
+inline int f175_4(int x) { return x * 4; }
+inline int f175_5(int x) { return x * 5; }
+inline int f175_6(int x) { return x * 6; }
+inline int f175_7(int x) { return x * 7; }
+inline int f175_8(int x) { return x * 8; }
+inline int f175_9(int x) { return x * 9; }
+inline int f175_10(int x) { return x * 10; }
+inline int f175_11(int x) { return x * 11; }
+inline int f175_12(int x) { return x * 12; }
+inline int f175_13(int x) { return x * 13; }
+inline int f175_14(int x) { return x * 14; }
+inline int f175_15(int x) { return x * 15; }
+inline int f175_16(int x) { return x * 16; }
+inline int f175_17(int x) { return x * 17; }
+inline int f175_18(int x) { return x * 18; }
+inline int f175_19(int x) { return x * 19; }
+inline int f175_20(int x) { return x * 20; }
+inline int f175_21(int x) { return x * 21; }
+inline int f175_22(int x) { return x * 22; }
+inline int f175_23(int x) { return x * 23; }
+inline int f175_24(int x) { return x * 24; }
+inline int f175_25(int x) { return x * 25; }
+inline int f175_26(int x) { return x * 26; }
+inline int f175_27(int x) { return x * 27; }
+inline int f175_28(int x) { return x * 28; }
+inline int f175_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1752 */
+#include <vector>
+#include "h7683.h"
+#include "h8641.h"
+#include "h3256.h"
+#include "h3600.h"
+#include "h5058.h"
+#ifdef X
+#include "h7008.h"
+#endif
+struct S1752 { int a; const char *s = "x//y"; };
+inline int f1752_0(int x) { return x * 0; }
+inline int f1752_1(int x) { return x * 1; }
+inline int f1752_2(int x) { return x * 2; }
+inline int f1752_3(int x) { return x * 3; }
+inline int f1752_4(int x) { return x * 4; }
+inline int f1752_5(int x) { return x * 5; }
+inline int f1752_6(int x) { return x * 6; }
+inline int f1752_7(int x) { return x * 7; }
+inline int f1752_8(int x) { return x * 8; }
+inline int f1752_9(int x) { return x * 9; }
+inline int f1752_10(int x) { return x * 10; }
+inline int f1752_11(int x) { return x * 11; }
+inline int f1752_12(int x) { return x * 12; }
+inline int f1752_13(int x) { return x * 13; }
+inline int f1752_14(int x) { return x * 14; }
+inline int f1752_15(int x) { return x * 15; }
+inline int f1752_16(int x) { return x * 16; }
+inline int f1752_17(int x) { return x * 17; }
+inline int f1752_18(int x) { return x * 18; }
+inline int f1752_19(int x) { return x * 19; }
+inline int f1752_20(int x) { return x * 20; }
+inline int f1752_21(int x) { return x * 21; }
+inline int f1752_22(int x) { return x * 22; }
+inline int f1752_23(int x) { return x * 23; }
+inline int f1752_24(int x) { return x * 24; }
+inline int f1752_25(int x) { return x * 25; }
+inline int f1752_26(int x) { return x * 26; }
+inline int f1752_27(int x) { return x * 27; }
+inline int f1752_28(int x) { return x * 28; }
+inline int f1752_29(int x) { return x * 29; }
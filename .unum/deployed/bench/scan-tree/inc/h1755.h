@@ -0,0 +1,42 @@
+#pragma once
+/* header 1755 */
+#include <vector>
+#include "h4036.h"
+#include "h4467.h"
+#include "h2164.h"
+#include "h7273.h"
+#include "h8682.h"
+#ifdef X
+#include "h7981.h"
+#endif
+struct S1755 { int a; const char *s = "x//y"; };
+inline int f1755_0(int x) { return x * 0; }
+inline int f1755_1(int x) { return x * 1; }
+inline int f1755_2(int x) { return x * 2; }
+inline int f1755_3(int x) { return x * 3; }
+inline int f1755_4(int x) { return x * 4; }
+inline int f1755_5(int x) { return x * 5; }
+inline int f1755_6(int x) { return x * 6; }
+inline int f1755_7(int x) { return x * 7; }
+inline int f1755_8(int x) { return x * 8; }
+inline int f1755_9(int x) { return x * 9; }
+inline int f1755_10(int x) { return x * 10; }
+inline int f1755_11(int x) { return x * 11; }
+inline int f1755_12(int x) { return x * 12; }
+inline int f1755_13(int x) { return x * 13; }
+inline int f1755_14(int x) { return x * 14; }
+inline int f1755_15(int x) { return x * 15; }
+inline int f1755_16(int x) { return x * 16; }
+inline int f1755_17(int x) { return x * 17; }
+inline int f1755_18(int x) { return x * 18; }
+inline int f1755_19(int x) { return x * 19; }
+inline int f1755_20(int x) { return x * 20; }
+inline int f1755_21(int x) { return x * 21; }
+inline int f1755_22(int x) { return x * 22; }
+inline int f1755_23(int x) { return x * 23; }
+inline int f1755_24(int x) { return x * 24; }
+inline int f1755_25(int x) { return x * 25; }
+inline int f1755_26(int x) { return x * 26; }
+inline int f1755_27(int x) { return x * 27; }
+inline int f1755_28(int x) { return x * 28; }
+inline int f1755_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1758 */
+#include <vector>
+#include "h3380.h"
+#include "h7009.h"
+#include "h5715.h"
+#include "h6811.h"
+#include "h8535.h"
+#ifdef X
+#include "h7653.h"
+#endif
+struct S1758 { int a; const char *s = "x//y"; };
+inline int f1758_0(int x) { return x * 0; }
+inline int f1758_1(int x) { return x * 1; }
+inline int f1758_2(int x) { return x * 2; }
+inline int f1758_3(int x) { return x * 3; }
+inline int f1758_4(int x) { return x * 4; }
+inline int f1758_5(int x) { return x * 5; }
+inline int f1758_6(int x) { return x * 6; }
+inline int f1758_7(int x) { return x * 7; }
+inline int f1758_8(int x) { return x * 8; }
+inline int f1758_9(int x) { return x * 9; }
+inline int f1758_10(int x) { return x * 10; }
+inline int f1758_11(int x) { return x * 11; }
+inline int f1758_12(int x) { return x * 12; }
+inline int f1758_13(int x) { return x * 13; }
+inline int f1758_14(int x) { return x * 14; }
+inline int f1758_15(int x) { return x * 15; }
+inline int f1758_16(int x) { return x * 16; }
+inline int f1758_17(int x) { return x * 17; }
+inline int f1758_18(int x) { return x * 18; }
+inline int f1758_19(int x) { return x * 19; }
+inline int f1758_20(int x) { return x * 20; }
+inline int f1758_21(int x) { return x * 21; }
+inline int f1758_22(int x) { return x * 22; }
+inline int f1758_23(int x) { return x * 23; }
+inline int f1758_24(int x) { return x * 24; }
+inline int f1758_25(int x) { return x * 25; }
+inline int f1758_26(int x) { return x * 26; }
+inline int f1758_27(int x) { return x * 27; }
+inline int f1758_28(int x) { return x * 28; }
+inline int f1758_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1759 */
+#include <vector>
+#include "h7692.h"
+#include "h212.h"
+#include "h7987.h"
+#include "h9966.h"
+#include "h1894.h"
+#ifdef X
+#include "h2062.h"
+#endif
+struct S1759 { int a; const char *s = "x//y"; };
+inline int f1759_0(int x) { return x * 0; }
+inline int f1759_1(int x) { return x * 1; }
+inline int f1759_2(int x) { return x * 2; }
+inline int f1759_3(int x) { return x * 3; }
+inline int f1759_4(int x) { return x * 4; }
+inline int f1759_5(int x) { return x * 5; }
+inline int f1759_6(int x) { return x * 6; }
+inline int f1759_7(int x) { return x * 7; }
+inline int f1759_8(int x) { return x * 8; }
+inline int f1759_9(int x) { return x * 9; }
+inline int f1759_10(int x) { return x * 10; }
+inline int f1759_11(int x) { return x * 11; }
+inline int f1759_12(int x) { return x * 12; }
+inline int f1759_13(int x) { return x * 13; }
+inline int f1759_14(int x) { return x * 14; }
+inline int f1759_15(int x) { return x * 15; }
+inline int f1759_16(int x) { return x * 16; }
+inline int f1759_17(int x) { return x * 17; }
+inline int f1759_18(int x) { return x * 18; }
+inline int f1759_19(int x) { return x * 19; }
+inline int f1759_20(int x) { return x * 20; }
+inline int f1759_21(int x) { return x * 21; }
+inline int f1759_22(int x) { return x * 22; }
+inline int f1759_23(int x) { return x * 23; }
+inline int f1759_24(int x) { return x * 24; }
+inline int f1759_25(int x) { return x * 25; }
+inline int f1759_26(int x) { return x * 26; }
+inline int f1759_27(int x) { return x * 27; }
+inline int f1759_28(int x) { return x * 28; }
+inline int f1759_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 176 */
+#include <vector>
+#include "h5764.h"
+#include "h2085.h"
+#include "h5764.h"
+#include "h5368.h"
+#include "h8353.h"
+#ifdef X
+#include "h1455.h"
+#endif
+struct S176 { int a; const char *s = "x//y"; };
+inline int f176_0(int x) { return x * 0; }
+inline int f176_1(int x) { return x * 1; }
+inline int f176_2(int x) { return x * 2; }
+inline int f176_3(int x) { return x * 3; }
+inline int f176_4(int x) { return x * 4; }
+inline int f176_5(int x) { return x * 5; }
+inline int f176_6(int x) { return x * 6; }
+inline int f176_7(int x) { return x * 7; }
+inline int f176_8(int x) { return x * 8; }
+inline int f176_9(int x) { return x * 9; }
+inline int f176_10(int x) { return x * 10; }
+inline int f176_11(int x) { return x * 11; }
+inline int f176_12(int x) { return x * 12; }
+inline int f176_13(int x) { return x * 13; }
+inline int f176_14(int x) { return x * 14; }
+inline int f176_15(int x) { return x * 15; }
+inline int f176_16(int x) { return x * 16; }
+inline int f176_17(int x) { return x * 17; }
+inline int f176_18(int x) { return x * 18; }
+inline int f176_19(int x) { return x * 19; }
+inline int f176_20(int x) { return x * 20; }
+inline int f176_21(int x) { return x * 21; }
+inline int f176_22(int x) { return x * 22; }
+inline int f176_23(int x) { return x * 23; }
+inline int f176_24(int x) { return x * 24; }
+inline int f176_25(int x) { return x * 25; }
+inline int f176_26(int x) { return x * 26; }
+inline int f176_27(int x) { return x * 27; }
+inline int f176_28(int x) { return x * 28; }
+inline int f176_29(int x) { return x * 29; }
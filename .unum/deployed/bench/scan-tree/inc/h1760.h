@@ -0,0 +1,42 @@
+#pragma once
+/* header 1760 */
+#include <vector>
+#include "h4828.h"
+#include "h8164.h"
+#include "h171.h"
+#include "h5944.h"
+#include "h7370.h"
+#ifdef X
+#include "h6942.h"
+#endif
+struct S1760 { int a; const char *s = "x//y"; };
+inline int f1760_0(int x) { return x * 0; }
+inline int f1760_1(int x) { return x * 1; }
+inline int f1760_2(int x) { return x * 2; }
+inline int f1760_3(int x) { return x * 3; }
+inline int f1760_4(int x) { return x * 4; }
+inline int f1760_5(int x) { return x * 5; }
+inline int f1760_6(int x) { return x * 6; }
+inline int f1760_7(int x) { return x * 7; }
+inline int f1760_8(int x) { return x * 8; }
+inline int f1760_9(int x) { return x * 9; }
+inline int f1760_10(int x) { return x * 10; }
+inline int f1760_11(int x) { return x * 11; }
+inline int f1760_12(int x) { return x * 12; }
+inline int f1760_13(int x) { return x * 13; }
+inline int f1760_14(int x) { return x * 14; }
+inline int f1760_15(int x) { return x * 15; }
+inline int f1760_16(int x) { return x * 16; }
+inline int f1760_17(int x) { return x * 17; }
+inline int f1760_18(int x) { return x * 18; }
+inline int f1760_19(int x) { return x * 19; }
+inline int f1760_20(int x) { return x * 20; }
+inline int f1760_21(int x) { return x * 21; }
+inline int f1760_22(int x) { return x * 22; }
+inline int f1760_23(int x) { return x * 23; }
+inline int f1760_24(int x) { return x * 24; }
+inline int f1760_25(int x) { return x * 25; }
+inline int f1760_26(int x) { return x * 26; }
+inline int f1760_27(int x) { return x * 27; }
+inline int f1760_28(int x) { return x * 28; }
+inline int f1760_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1763 */
+#include <vector>
+#include "h3875.h"
+#include "h3079.h"
+#include "h1987.h"
+#include "h9539.h"
+#include "h8555.h"
+#ifdef X
+#include "h333.h"
+#endif
+struct S1763 { int a; const char *s = "x//y"; };
+inline int f1763_0(int x) { return x * 0; }
+inline int f1763_1(int x) { return x * 1; }
+inline int f1763_2(int x) { return x * 2; }
+inline int f1763_3(int x) { return x * 3; }
+inline int f1763_4(int x) { return x * 4; }
+inline int f1763_5(int x) { return x * 5; }
+inline int f1763_6(int x) { return x * 6; }
+inline int f1763_7(int x) { return x * 7; }
+inline int f1763_8(int x) { return x * 8; }
+inline int f1763_9(int x) { return x * 9; }
+inline int f1763_10(int x) { return x * 10; }
+inline int f1763_11(int x) { return x * 11; }
+inline int f1763_12(int x) { return x * 12; }
+inline int f1763_13(int x) { return x * 13; }
+inline int f1763_14(int x) { return x * 14; }
+inline int f1763_15(int x) { return x * 15; }
+inline int f1763_16(int x) { return x * 16; }
+inline int f1763_17(int x) { return x * 17; }
+inline int f1763_18(int x) { return x * 18; }
+inline int f1763_19(int x) { return x * 19; }
+inline int f1763_20(int x) { return x * 20; }
+inline int f1763_21(int x) { return x * 21; }
+inline int f1763_22(int x) { return x * 22; }
+inline int f1763_23(int x) { return x * 23; }
+inline int f1763_24(int x) { return x * 24; }
+inline int f1763_25(int x) { return x * 25; }
+inline int f1763_26(int x) { return x * 26; }
+inline int f1763_27(int x) { return x * 27; }
+inline int f1763_28(int x) { return x * 28; }
+inline int f1763_29(int x) { return x * 29; }
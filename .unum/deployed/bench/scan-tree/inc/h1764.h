@@ -0,0 +1,42 @@
+#pragma once
+/* header 1764 */
+#include <vector>
+#include "h5963.h"
+#include "h3009.h"
+#include "h9661.h"
+#include "h9994.h"
+#include "h5635.h"
+#ifdef X
+#include "h1280.h"
+#endif
+struct S1764 { int a; const char *s = "x//y"; };
+inline int f1764_0(int x) { return x * 0; }
+inline int f1764_1(int x) { return x * 1; }
+inline int f1764_2(int x) { return x * 2; }
+inline int f1764_3(int x) { return x * 3; }
+inline int f1764_4(int x) { return x * 4; }
+inline int f1764_5(int x) { return x * 5; }
+inline int f1764_6(int x) { return x * 6; }
+inline int f1764_7(int x) { return x * 7; }
+inline int f1764_8(int x) { return x * 8; }
+inline int f1764_9(int x) { return x * 9; }
+inline int f1764_10(int x) { return x * 10; }
+inline int f1764_11(int x) { return x * 11; }
+inline int f1764_12(int x) { return x * 12; }
+inline int f1764_13(int x) { return x * 13; }
+inline int f1764_14(int x) { return x * 14; }
+inline int f1764_15(int x) { return x * 15; }
+inline int f1764_16(int x) { return x * 16; }
+inline int f1764_17(int x) { return x * 17; }
+inline int f1764_18(int x) { return x * 18; }
+inline int f1764_19(int x) { return x * 19; }
+inline int f1764_20(int x) { return x * 20; }
+inline int f1764_21(int x) { return x * 21; }
+inline int f1764_22(int x) { return x * 22; }
+inline int f1764_23(int x) { return x * 23; }
+inline int f1764_24(int x) { return x * 24; }
+inline int f1764_25(int x) { return x * 25; }
+inline int f1764_26(int x) { return x * 26; }
+inline int f1764_27(int x) { return x * 27; }
+inline int f1764_28(int x) { return x * 28; }
+inline int f1764_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1766 */
+#include <vector>
+#include "h2371.h"
+#include "h479.h"
+#include "h8730.h"
+#include "h3922.h"
+#include "h4152.h"
+#ifdef X
+#include "h9800.h"
+#endif
+struct S1766 { int a; const char *s = "x//y"; };
+inline int f1766_0(int x) { return x * 0; }
+inline int f1766_1(int x) { return x * 1; }
+inline int f1766_2(int x) { return x * 2; }
+inline int f1766_3(int x) { return x * 3; }
+inline int f1766_4(int x) { return x * 4; }
+inline int f1766_5(int x) { return x * 5; }
+inline int f1766_6(int x) { return x * 6; }
+inline int f1766_7(int x) { return x * 7; }
+inline int f1766_8(int x) { return x * 8; }
+inline int f1766_9(int x) { return x * 9; }
+inline int f1766_10(int x) { return x * 10; }
+inline int f1766_11(int x) { return x * 11; }
+inline int f1766_12(int x) { return x * 12; }
+inline int f1766_13(int x) { return x * 13; }
+inline int f1766_14(int x) { return x * 14; }
+inline int f1766_15(int x) { return x * 15; }
+inline int f1766_16(int x) { return x * 16; }
+inline int f1766_17(int x) { return x * 17; }
+inline int f1766_18(int x) { return x * 18; }
+inline int f1766_19(int x) { return x * 19; }
+inline int f1766_20(int x) { return x * 20; }
+inline int f1766_21(int x) { return x * 21; }
+inline int f1766_22(int x) { return x * 22; }
+inline int f1766_23(int x) { return x * 23; }
+inline int f1766_24(int x) { return x * 24; }
+inline int f1766_25(int x) { return x * 25; }
+inline int f1766_26(int x) { return x * 26; }
+inline int f1766_27(int x) { return x * 27; }
+inline int f1766_28(int x) { return x * 28; }
+inline int f1766_29(int x) { return x * 29; }
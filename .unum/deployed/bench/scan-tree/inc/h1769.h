@@ -0,0 +1,42 @@
+#pragma once
+/* header 1769 */
+#include <vector>
+#include "h3199.h"
+#include "h3296.h"
+#include "h6437.h"
+#include "h6294.h"
+#include "h650.h"
+#ifdef X
+#include "h6977.h"
+#endif
+struct S1769 { int a; const char *s = "x//y"; };
+inline int f1769_0(int x) { return x * 0; }
+inline int f1769_1(int x) { return x * 1; }
+inline int f1769_2(int x) { return x * 2; }
+inline int f1769_3(int x) { return x * 3; }
+inline int f1769_4(int x) { return x * 4; }
+inline int f1769_5(int x) { return x * 5; }
+inline int f1769_6(int x) { return x * 6; }
+inline int f1769_7(int x) { return x * 7; }
+inline int f1769_8(int x) { return x * 8; }
+inline int f1769_9(int x) { return x * 9; }
+inline int f1769_10(int x) { return x * 10; }
+inline int f1769_11(int x) { return x * 11; }
+inline int f1769_12(int x) { return x * 12; }
+inline int f1769_13(int x) { return x * 13; }
+inline int f1769_14(int x) { return x * 14; }
+inline int f1769_15(int x) { return x * 15; }
+inline int f1769_16(int x) { return x * 16; }
+inline int f1769_17(int x) { return x * 17; }
+inline int f1769_18(int x) { return x * 18; }
+inline int f1769_19(int x) { return x * 19; }
+inline int f1769_20(int x) { return x * 20; }
+inline int f1769_21(int x) { return x * 21; }
+inline int f1769_22(int x) { return x * 22; }
+inline int f1769_23(int x) { return x * 23; }
+inline int f1769_24(int x) { return x * 24; }
+inline int f1769_25(int x) { return x * 25; }
+inline int f1769_26(int x) { return x * 26; }
+inline int f1769_27(int x) { return x * 27; }
+inline int f1769_28(int x) { return x * 28; }
+inline int f1769_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1771 */
+#include <vector>
+#include "h7229.h"
+#include "h279.h"
+#include "h8606.h"
+#include "h4102.h"
+#include "h6904.h"
+#ifdef X
+#include "h4242.h"
+#endif
+struct S1771 { int a; const char *s = "x//y"; };
+inline int f1771_0(int x) { return x * 0; }
+inline int f1771_1(int x) { return x * 1; }
+inline int f1771_2(int x) { return x * 2; }
+inline int f1771_3(int x) { return x * 3; }
+inline int f1771_4(int x) { return x * 4; }
+inline int f1771_5(int x) { return x * 5; }
+inline int f1771_6(int x) { return x * 6; }
+inline int f1771_7(int x) { return x * 7; }
+inline int f1771_8(int x) { return x * 8; }
+inline int f1771_9(int x) { return x * 9; }
+inline int f1771_10(int x) { return x * 10; }
+inline int f1771_11(int x) { return x * 11; }
+inline int f1771_12(int x) { return x * 12; }
+inline int f1771_13(int x) { return x * 13; }
+inline int f1771_14(int x) { return x * 14; }
+inline int f1771_15(int x) { return x * 15; }
+inline int f1771_16(int x) { return x * 16; }
+inline int f1771_17(int x) { return x * 17; }
+inline int f1771_18(int x) { return x * 18; }
+inline int f1771_19(int x) { return x * 19; }
+inline int f1771_20(int x) { return x * 20; }
+inline int f1771_21(int x) { return x * 21; }
+inline int f1771_22(int x) { return x * 22; }
+inline int f1771_23(int x) { return x * 23; }
+inline int f1771_24(int x) { return x * 24; }
+inline int f1771_25(int x) { return x * 25; }
+inline int f1771_26(int x) { return x * 26; }
+inline int f1771_27(int x) { return x * 27; }
+inline int f1771_28(int x) { return x * 28; }
+inline int f1771_29(int x) { return x * 29; }
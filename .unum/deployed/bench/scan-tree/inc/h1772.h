@@ -0,0 +1,42 @@
+#pragma once
+/* header 1772 */
+#include <vector>
+#include "h6256.h"
+#include "h2145.h"
+#include "h5906.h"
+#include "h7765.h"
+#include "h2629.h"
+#ifdef X
+#include "h6985.h"
+#endif
+struct S1772 { int a; const char *s = "x//y"; };
+inline int f1772_0(int x) { return x * 0; }
+inline int f1772_1(int x) { return x * 1; }
+inline int f1772_2(int x) { return x * 2; }
+inline int f1772_3(int x) { return x * 3; }
+inline int f1772_4(int x) { return x * 4; }
+inline int f1772_5(int x) { return x * 5; }
+inline int f1772_6(int x) { return x * 6; }
+inline int f1772_7(int x) { return x * 7; }
+inline int f1772_8(int x) { return x * 8; }
+inline int f1772_9(int x) { return x * 9; }
+inline int f1772_10(int x) { return x * 10; }
+inline int f1772_11(int x) { return x * 11; }
+inline int f1772_12(int x) { return x * 12; }
+inline int f1772_13(int x) { return x * 13; }
+inline int f1772_14(int x) { return x * 14; }
+inline int f1772_15(int x) { return x * 15; }
+inline int f1772_16(int x) { return x * 16; }
+inline int f1772_17(int x) { return x * 17; }
+inline int f1772_18(int x) { return x * 18; }
+inline int f1772_19(int x) { return x * 19; }
+inline int f1772_20(int x) { return x * 20; }
+inline int f1772_21(int x) { return x * 21; }
+inline int f1772_22(int x) { return x * 22; }
+inline int f1772_23(int x) { return x * 23; }
+inline int f1772_24(int x) { return x * 24; }
+inline int f1772_25(int x) { return x * 25; }
+inline int f1772_26(int x) { return x * 26; }
+inline int f1772_27(int x) { return x * 27; }
+inline int f1772_28(int x) { return x * 28; }
+inline int f1772_29(int x) { return x * 29; }
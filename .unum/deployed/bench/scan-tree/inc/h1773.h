@@ -0,0 +1,42 @@
+#pragma once
+/* header 1773 */
+#include <vector>
+#include "h959.h"
+#include "h8223.h"
+#include "h1811.h"
+#include "h5033.h"
+#include "h5288.h"
+#ifdef X
+#include "h2393.h"
+#endif
+struct S1773 { int a; const char *s = "x//y"; };
+inline int f1773_0(int x) { return x * 0; }
+inline int f1773_1(int x) { return x * 1; }
+inline int f1773_2(int x) { return x * 2; }
+inline int f1773_3(int x) { return x * 3; }
+inline int f1773_4(int x) { return x * 4; }
+inline int f1773_5(int x) { return x * 5; }
+inline int f1773_6(int x) { return x * 6; }
+inline int f1773_7(int x) { return x * 7; }
+inline int f1773_8(int x) { return x * 8; }
+inline int f1773_9(int x) { return x * 9; }
+inline int f1773_10(int x) { return x * 10; }
+inline int f1773_11(int x) { return x * 11; }
+inline int f1773_12(int x) { return x * 12; }
+inline int f1773_13(int x) { return x * 13; }
+inline int f1773_14(int x) { return x * 14; }
+inline int f1773_15(int x) { return x * 15; }
+inline int f1773_16(int x) { return x * 16; }
+inline int f1773_17(int x) { return x * 17; }
+inline int f1773_18(int x) { return x * 18; }
+inline int f1773_19(int x) { return x * 19; }
+inline int f1773_20(int x) { return x * 20; }
+inline int f1773_21(int x) { return x * 21; }
+inline int f1773_22(int x) { return x * 22; }
+inline int f1773_23(int x) { return x * 23; }
+inline int f1773_24(int x) { return x * 24; }
+inline int f1773_25(int x) { return x * 25; }
+inline int f1773_26(int x) { return x * 26; }
+inline int f1773_27(int x) { return x * 27; }
+inline int f1773_28(int x) { return x * 28; }
+inline int f1773_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1774 */
+#include <vector>
+#include "h7146.h"
+#include "h7192.h"
+#include "h7606.h"
+#include "h4038.h"
+#include "h7075.h"
+#ifdef X
+#include "h8377.h"
+#endif
+struct S1774 { int a; const char *s = "x//y"; };
+inline int f1774_0(int x) { return x * 0; }
+inline int f1774_1(int x) { return x * 1; }
+inline int f1774_2(int x) { return x * 2; }
+inline int f1774_3(int x) { return x * 3; }
+inline int f1774_4(int x) { return x * 4; }
+inline int f1774_5(int x) { return x * 5; }
+inline int f1774_6(int x) { return x * 6; }
+inline int f1774_7(int x) { return x * 7; }
+inline int f1774_8(int x) { return x * 8; }
+inline int f1774_9(int x) { return x * 9; }
+inline int f1774_10(int x) { return x * 10; }
+inline int f1774_11(int x) { return x * 11; }
+inline int f1774_12(int x) { return x * 12; }
+inline int f1774_13(int x) { return x * 13; }
+inline int f1774_14(int x) { return x * 14; }
+inline int f1774_15(int x) { return x * 15; }
+inline int f1774_16(int x) { return x * 16; }
+inline int f1774_17(int x) { return x * 17; }
+inline int f1774_18(int x) { return x * 18; }
+inline int f1774_19(int x) { return x * 19; }
+inline int f1774_20(int x) { return x * 20; }
+inline int f1774_21(int x) { return x * 21; }
+inline int f1774_22(int x) { return x * 22; }
+inline int f1774_23(int x) { return x * 23; }
+inline int f1774_24(int x) { return x * 24; }
+inline int f1774_25(int x) { return x * 25; }
+inline int f1774_26(int x) { return x * 26; }
+inline int f1774_27(int x) { return x * 27; }
+inline int f1774_28(int x) { return x * 28; }
+inline int f1774_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1775 */
+#include <vector>
+#include "h1635.h"
+#include "h808.h"
+#include "h1072.h"
+#include "h1192.h"
+#include "h1048.h"
+#ifdef X
+#include "h9361.h"
+#endif
+struct S1775 { int a; const char *s = "x//y"; };
+inline int f1775_0(int x) { return x * 0; }
+inline int f1775_1(int x) { return x * 1; }
+inline int f1775_2(int x) { return x * 2; }
+inline int f1775_3(int x) { return x * 3; }
+inline int f1775_4(int x) { return x * 4; }
+inline int f1775_5(int x) { return x * 5; }
+inline int f1775_6(int x) { return x * 6; }
+inline int f1775_7(int x) { return x * 7; }
+inline int f1775_8(int x) { return x * 8; }
+inline int f1775_9(int x) { return x * 9; }
+inline int f1775_10(int x) { return x * 10; }
+inline int f1775_11(int x) { return x * 11; }
+inline int f1775_12(int x) { return x * 12; }
+inline int f1775_13(int x) { return x * 13; }
+inline int f1775_14(int x) { return x * 14; }
+inline int f1775_15(int x) { return x * 15; }
+inline int f1775_16(int x) { return x * 16; }
+inline int f1775_17(int x) { return x * 17; }
+inline int f1775_18(int x) { return x * 18; }
+inline int f1775_19(int x) { return x * 19; }
+inline int f1775_20(int x) { return x * 20; }
+inline int f1775_21(int x) { return x * 21; }
+inline int f1775_22(int x) { return x * 22; }
+inline int f1775_23(int x) { return x * 23; }
+inline int f1775_24(int x) { return x * 24; }
+inline int f1775_25(int x) { return x * 25; }
+inline int f1775_26(int x) { return x * 26; }
+inline int f1775_27(int x) { return x * 27; }
+inline int f1775_28(int x) { return x * 28; }
+inline int f1775_29(int x) { return x * 29; }
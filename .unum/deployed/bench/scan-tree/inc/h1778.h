@@ -0,0 +1,42 @@
+#pragma once
+/* header 1778 */
+#include <vector>
+#include "h3206.h"
+#include "h36.h"
+#include "h914.h"
+#include "h6453.h"
+#include "h9693.h"
+#ifdef X
+#include "h9164.h"
+#endif
+struct S1778 { int a; const char *s = "x//y"; };
+inline int f1778_0(int x) { return x * 0; }
+inline int f1778_1(int x) { return x * 1; }
+inline int f1778_2(int x) { return x * 2; }
+inline int f1778_3(int x) { return x * 3; }
+inline int f1778_4(int x) { return x * 4; }
+inline int f1778_5(int x) { return x * 5; }
+inline int f1778_6(int x) { return x * 6; }
+inline int f1778_7(int x) { return x * 7; }
+inline int f1778_8(int x) { return x * 8; }
+inline int f1778_9(int x) { return x * 9; }
+inline int f1778_10(int x) { return x * 10; }
+inline int f1778_11(int x) { return x * 11; }
+inline int f1778_12(int x) { return x * 12; }
+inline int f1778_13(int x) { return x * 13; }
+inline int f1778_14(int x) { return x * 14; }
+inline int f1778_15(int x) { return x * 15; }
+inline int f1778_16(int x) { return x * 16; }
+inline int f1778_17(int x) { return x * 17; }
+inline int f1778_18(int x) { return x * 18; }
+inline int f1778_19(int x) { return x * 19; }
+inline int f1778_20(int x) { return x * 20; }
+inline int f1778_21(int x) { return x * 21; }
+inline int f1778_22(int x) { return x * 22; }
+inline int f1778_23(int x) { return x * 23; }
+inline int f1778_24(int x) { return x * 24; }
+inline int f1778_25(int x) { return x * 25; }
+inline int f1778_26(int x) { return x * 26; }
+inline int f1778_27(int x) { return x * 27; }
+inline int f1778_28(int x) { return x * 28; }
+inline int f1778_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1779 */
+#include <vector>
+#include "h6069.h"
+#include "h9061.h"
+#include "h6065.h"
+#include "h5507.h"
+#include "h7019.h"
+#ifdef X
+#include "h3608.h"
+#endif
+struct S1779 { int a; const char *s = "x//y"; };
+inline int f1779_0(int x) { return x * 0; }
+inline int f1779_1(int x) { return x * 1; }
+inline int f1779_2(int x) { return x * 2; }
+inline int f1779_3(int x) { return x * 3; }
+inline int f1779_4(int x) { return x * 4; }
+inline int f1779_5(int x) { return x * 5; }
+inline int f1779_6(int x) { return x * 6; }
+inline int f1779_7(int x) { return x * 7; }
+inline int f1779_8(int x) { return x * 8; }
+inline int f1779_9(int x) { return x * 9; }
+inline int f1779_10(int x) { return x * 10; }
+inline int f1779_11(int x) { return x * 11; }
+inline int f1779_12(int x) { return x * 12; }
+inline int f1779_13(int x) { return x * 13; }
+inline int f1779_14(int x) { return x * 14; }
+inline int f1779_15(int x) { return x * 15; }
+inline int f1779_16(int x) { return x * 16; }
+inline int f1779_17(int x) { return x * 17; }
+inline int f1779_18(int x) { return x * 18; }
+inline int f1779_19(int x) { return x * 19; }
+inline int f1779_20(int x) { return x * 20; }
+inline int f1779_21(int x) { return x * 21; }
+inline int f1779_22(int x) { return x * 22; }
+inline int f1779_23(int x) { return x * 23; }
+inline int f1779_24(int x) { return x * 24; }
+inline int f1779_25(int x) { return x * 25; }
+inline int f1779_26(int x) { return x * 26; }
+inline int f1779_27(int x) { return x * 27; }
+inline int f1779_28(int x) { return x * 28; }
+inline int f1779_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1781 */
+#include <vector>
+#include "h9874.h"
+#include "h2354.h"
+#include "h244.h"
+#include "h4192.h"
+#include "h2953.h"
+#ifdef X
+#include "h2645.h"
+#endif
+struct S1781 { int a; const char *s = "x//y"; };
+inline int f1781_0(int x) { return x * 0; }
+inline int f1781_1(int x) { return x * 1; }
+inline int f1781_2(int x) { return x * 2; }
+inline int f1781_3(int x) { return x * 3; }
+inline int f1781_4(int x) { return x * 4; }
+inline int f1781_5(int x) { return x * 5; }
+inline int f1781_6(int x) { return x * 6; }
+inline int f1781_7(int x) { return x * 7; }
+inline int f1781_8(int x) { return x * 8; }
+inline int f1781_9(int x) { return x * 9; }
+inline int f1781_10(int x) { return x * 10; }
+inline int f1781_11(int x) { return x * 11; }
+inline int f1781_12(int x) { return x * 12; }
+inline int f1781_13(int x) { return x * 13; }
+inline int f1781_14(int x) { return x * 14; }
+inline int f1781_15(int x) { return x * 15; }
+inline int f1781_16(int x) { return x * 16; }
+inline int f1781_17(int x) { return x * 17; }
+inline int f1781_18(int x) { return x * 18; }
+inline int f1781_19(int x) { return x * 19; }
+inline int f1781_20(int x) { return x * 20; }
+inline int f1781_21(int x) { return x * 21; }
+inline int f1781_22(int x) { return x * 22; }
+inline int f1781_23(int x) { return x * 23; }
+inline int f1781_24(int x) { return x * 24; }
+inline int f1781_25(int x) { return x * 25; }
+inline int f1781_26(int x) { return x * 26; }
+inline int f1781_27(int x) { return x * 27; }
+inline int f1781_28(int x) { return x * 28; }
+inline int f1781_29(int x) { return x * 29; }
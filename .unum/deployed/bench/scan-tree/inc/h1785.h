@@ -0,0 +1,42 @@
+#pragma once
+/* header 1785 */
+#include <vector>
+#include "h7585.h"
+#include "h9323.h"
+#include "h943.h"
+#include "h1198.h"
+#include "h6987.h"
+#ifdef X
+#include "h9892.h"
+#endif
+struct S1785 { int a; const char *s = "x//y"; };
+inline int f1785_0(int x) { return x * 0; }
+inline int f1785_1(int x) { return x * 1; }
+inline int f1785_2(int x) { return x * 2; }
+inline int f1785_3(int x) { return x * 3; }
+inline int f1785_4(int x) { return x * 4; }
+inline int f1785_5(int x) { return x * 5; }
+inline int f1785_6(int x) { return x * 6; }
+inline int f1785_7(int x) { return x * 7; }
+inline int f1785_8(int x) { return x * 8; }
+inline int f1785_9(int x) { return x * 9; }
+inline int f1785_10(int x) { return x * 10; }
+inline int f1785_11(int x) { return x * 11; }
+inline int f1785_12(int x) { return x * 12; }
+inline int f1785_13(int x) { return x * 13; }
+inline int f1785_14(int x) { return x * 14; }
+inline int f1785_15(int x) { return x * 15; }
+inline int f1785_16(int x) { return x * 16; }
+inline int f1785_17(int x) { return x * 17; }
+inline int f1785_18(int x) { return x * 18; }
+inline int f1785_19(int x) { return x * 19; }
+inline int f1785_20(int x) { return x * 20; }
+inline int f1785_21(int x) { return x * 21; }
+inline int f1785_22(int x) { return x * 22; }
+inline int f1785_23(int x) { return x * 23; }
+inline int f1785_24(int x) { return x * 24; }
+inline int f1785_25(int x) { return x * 25; }
+inline int f1785_26(int x) { return x * 26; }
+inline int f1785_27(int x) { return x * 27; }
+inline int f1785_28(int x) { return x * 28; }
+inline int f1785_29(int x) { return x * 29; }
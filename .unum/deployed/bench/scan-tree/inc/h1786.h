@@ -0,0 +1,42 @@
+#pragma once
+/* header 1786 */
+#include <vector>
+#include "h7558.h"
+#include "h4236.h"
+#include "h4634.h"
+#include "h2117.h"
+#include "h4262.h"
+#ifdef X
+#include "h7117.h"
+#endif
+struct S1786 { int a; const char *s = "x//y"; };
+inline int f1786_0(int x) { return x * 0; }
+inline int f1786_1(int x) { return x * 1; }
+inline int f1786_2(int x) { return x * 2; }
+inline int f1786_3(int x) { return x * 3; }
+inline int f1786_4(int x) { return x * 4; }
+inline int f1786_5(int x) { return x * 5; }
+inline int f1786_6(int x) { return x * 6; }
+inline int f1786_7(int x) { return x * 7; }
+inline int f1786_8(int x) { return x * 8; }
+inline int f1786_9(int x) { return x * 9; }
+inline int f1786_10(int x) { return x * 10; }
+inline int f1786_11(int x) { return x * 11; }
+inline int f1786_12(int x) { return x * 12; }
+inline int f1786_13(int x) { return x * 13; }
+inline int f1786_14(int x) { return x * 14; }
+inline int f1786_15(int x) { return x * 15; }
+inline int f1786_16(int x) { return x * 16; }
+inline int f1786_17(int x) { return x * 17; }
+inline int f1786_18(int x) { return x * 18; }
+inline int f1786_19(int x) { return x * 19; }
+inline int f1786_20(int x) { return x * 20; }
+inline int f1786_21(int x) { return x * 21; }
+inline int f1786_22(int x) { return x * 22; }
+inline int f1786_23(int x) { return x * 23; }
+inline int f1786_24(int x) { return x * 24; }
+inline int f1786_25(int x) { return x * 25; }
+inline int f1786_26(int x) { return x * 26; }
+inline int f1786_27(int x) { return x * 27; }
+inline int f1786_28(int x) { return x * 28; }
+inline int f1786_29(int x) { return x * 29; }
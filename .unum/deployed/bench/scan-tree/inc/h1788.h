@@ -0,0 +1,42 @@
+#pragma once
+/* header 1788 */
+#include <vector>
+#include "h8976.h"
+#include "h209.h"
+#include "h1834.h"
+#include "h5006.h"
+#include "h8069.h"
+#ifdef X
+#include "h126.h"
+#endif
+struct S1788 { int a; const char *s = "x//y"; };
+inline int f1788_0(int x) { return x * 0; }
+inline int f1788_1(int x) { return x * 1; }
+inline int f1788_2(int x) { return x * 2; }
+inline int f1788_3(int x) { return x * 3; }
+inline int f1788_4(int x) { return x * 4; }
+inline int f1788_5(int x) { return x * 5; }
+inline int f1788_6(int x) { return x * 6; }
+inline int f1788_7(int x) { return x * 7; }
+inline int f1788_8(int x) { return x * 8; }
+inline int f1788_9(int x) { return x * 9; }
+inline int f1788_10(int x) { return x * 10; }
+inline int f1788_11(int x) { return x * 11; }
+inline int f1788_12(int x) { return x * 12; }
+inline int f1788_13(int x) { return x * 13; }
+inline int f1788_14(int x) { return x * 14; }
+inline int f1788_15(int x) { return x * 15; }
+inline int f1788_16(int x) { return x * 16; }
+inline int f1788_17(int x) { return x * 17; }
+inline int f1788_18(int x) { return x * 18; }
+inline int f1788_19(int x) { return x * 19; }
+inline int f1788_20(int x) { return x * 20; }
+inline int f1788_21(int x) { return x * 21; }
+inline int f1788_22(int x) { return x * 22; }
+inline int f1788_23(int x) { return x * 23; }
+inline int f1788_24(int x) { return x * 24; }
+inline int f1788_25(int x) { return x * 25; }
+inline int f1788_26(int x) { return x * 26; }
+inline int f1788_27(int x) { return x * 27; }
+inline int f1788_28(int x) { return x * 28; }
+inline int f1788_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1789 */
+#include <vector>
+#include "h4336.h"
+#include "h9787.h"
+#include "h315.h"
+#include "h5429.h"
+#include "h3648.h"
+#ifdef X
+#include "h223.h"
+#endif
+struct S1789 { int a; const char *s = "x//y"; };
+inline int f1789_0(int x) { return x * 0; }
+inline int f1789_1(int x) { return x * 1; }
+inline int f1789_2(int x) { return x * 2; }
+inline int f1789_3(int x) { return x * 3; }
+inline int f1789_4(int x) { return x * 4; }
+inline int f1789_5(int x) { return x * 5; }
+inline int f1789_6(int x) { return x * 6; }
+inline int f1789_7(int x) { return x * 7; }
+inline int f1789_8(int x) { return x * 8; }
+inline int f1789_9(int x) { return x * 9; }
+inline int f1789_10(int x) { return x * 10; }
+inline int f1789_11(int x) { return x * 11; }
+inline int f1789_12(int x) { return x * 12; }
+inline int f1789_13(int x) { return x * 13; }
+inline int f1789_14(int x) { return x * 14; }
+inline int f1789_15(int x) { return x * 15; }
+inline int f1789_16(int x) { return x * 16; }
+inline int f1789_17(int x) { return x * 17; }
+inline int f1789_18(int x) { return x * 18; }
+inline int f1789_19(int x) { return x * 19; }
+inline int f1789_20(int x) { return x * 20; }
+inline int f1789_21(int x) { return x * 21; }
+inline int f1789_22(int x) { return x * 22; }
+inline int f1789_23(int x) { return x * 23; }
+inline int f1789_24(int x) { return x * 24; }
+inline int f1789_25(int x) { return x * 25; }
+inline int f1789_26(int x) { return x * 26; }
+inline int f1789_27(int x) { return x * 27; }
+inline int f1789_28(int x) { return x * 28; }
+inline int f1789_29(int x) { return x * 29; }
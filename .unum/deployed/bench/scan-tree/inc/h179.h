@@ -0,0 +1,42 @@
+#pragma once
+/* header 179 */
+#include <vector>
+#include "h7058.h"
+#include "h9861.h"
+#include "h6753.h"
+#include "h7510.h"
+#include "h9202.h"
+#ifdef X
+#include "h5756.h"
+#endif
+struct S179 { int a; const char *s = "x//y"; };
+inline int f179_0(int x) { return x * 0; }
+inline int f179_1(int x) { return x * 1; }
+inline int f179_2(int x) { return x * 2; }
+inline int f179_3(int x) { return x * 3; }
+inline int f179_4(int x) { return x * 4; }
+inline int f179_5(int x) { return x * 5; }
+inline int f179_6(int x) { return x * 6; }
+inline int f179_7(int x) { return x * 7; }
+inline int f179_8(int x) { return x * 8; }
+inline int f179_9(int x) { return x * 9; }
+inline int f179_10(int x) { return x * 10; }
+inline int f179_11(int x) { return x * 11; }
+inline int f179_12(int x) { return x * 12; }
+inline int f179_13(int x) { return x * 13; }
+inline int f179_14(int x) { return x * 14; }
+inline int f179_15(int x) { return x * 15; }
+inline int f179_16(int x) { return x * 16; }
+inline int f179_17(int x) { return x * 17; }
+inline int f179_18(int x) { return x * 18; }
+inline int f179_19(int x) { return x * 19; }
+inline int f179_20(int x) { return x * 20; }
+inline int f179_21(int x) { return x * 21; }
+inline int f179_22(int x) { return x * 22; }
+inline int f179_23(int x) { return x * 23; }
+inline int f179_24(int x) { return x * 24; }
+inline int f179_25(int x) { return x * 25; }
+inline int f179_26(int x) { return x * 26; }
+inline int f179_27(int x) { return x * 27; }
+inline int f179_28(int x) { return x * 28; }
+inline int f179_29(int x) { return x * 29; }
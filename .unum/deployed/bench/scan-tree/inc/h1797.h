@@ -0,0 +1,42 @@
+#pragma once
+/* header 1797 */
+#include <vector>
+#include "h4263.h"
+#include "h6022.h"
+#include "h1839.h"
+#include "h4935.h"
+#include "h7022.h"
+#ifdef X
+#include "h899.h"
+#endif
+struct S1797 { int a; const char *s = "x//y"; };
+inline int f1797_0(int x) { return x * 0; }
+inline int f1797_1(int x) { return x * 1; }
+inline int f1797_2(int x) { return x * 2; }
+inline int f1797_3(int x) { return x * 3; }
+inline int f1797_4(int x) { return x * 4; }
+inline int f1797_5(int x) { return x * 5; }
+inline int f1797_6(int x) { return x * 6; }
+inline int f1797_7(int x) { return x * 7; }
+inline int f1797_8(int x) { return x * 8; }
+inline int f1797_9(int x) { return x * 9; }
+inline int f1797_10(int x) { return x * 10; }
+inline int f1797_11(int x) { return x * 11; }
+inline int f1797_12(int x) { return x * 12; }
+inline int f1797_13(int x) { return x * 13; }
+inline int f1797_14(int x) { return x * 14; }
+inline int f1797_15(int x) { return x * 15; }
+inline int f1797_16(int x) { return x * 16; }
+inline int f1797_17(int x) { return x * 17; }
+inline int f1797_18(int x) { return x * 18; }
+inline int f1797_19(int x) { return x * 19; }
+inline int f1797_20(int x) { return x * 20; }
+inline int f1797_21(int x) { return x * 21; }
+inline int f1797_22(int x) { return x * 22; }
+inline int f1797_23(int x) { return x * 23; }
+inline int f1797_24(int x) { return x * 24; }
+inline int f1797_25(int x) { return x * 25; }
+inline int f1797_26(int x) { return x * 26; }
+inline int f1797_27(int x) { return x * 27; }
+inline int f1797_28(int x) { return x * 28; }
+inline int f1797_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 18 */
+#include <vector>
+#include "h3398.h"
+#include "h1821.h"
+#include "h7386.h"
+#include "h5942.h"
+#include "h416.h"
+#ifdef X
+#include "h9108.h"
+#endif
+struct S18 { int a; const char *s = "x//y"; };
+inline int f18_0(int x) { return x * 0; }
+inline int f18_1(int x) { return x * 1; }
+inline int f18_2(int x) { return x * 2; }
+inline int f18_3(int x) { return x * 3; }
+inline int f18_4(int x) { return x * 4; }
+inline int f18_5(int x) { return x * 5; }
+inline int f18_6(int x) { return x * 6; }
+inline int f18_7(int x) { return x * 7; }
+inline int f18_8(int x) { return x * 8; }
+inline int f18_9(int x) { return x * 9; }
+inline int f18_10(int x) { return x * 10; }
+inline int f18_11(int x) { return x * 11; }
+inline int f18_12(int x) { return x * 12; }
+inline int f18_13(int x) { return x * 13; }
+inline int f18_14(int x) { return x * 14; }
+inline int f18_15(int x) { return x * 15; }
+inline int f18_16(int x) { return x * 16; }
+inline int f18_17(int x) { return x * 17; }
+inline int f18_18(int x) { return x * 18; }
+inline int f18_19(int x) { return x * 19; }
+inline int f18_20(int x) { return x * 20; }
+inline int f18_21(int x) { return x * 21; }
+inline int f18_22(int x) { return x * 22; }
+inline int f18_23(int x) { return x * 23; }
+inline int f18_24(int x) { return x * 24; }
+inline int f18_25(int x) { return x * 25; }
+inline int f18_26(int x) { return x * 26; }
+inline int f18_27(int x) { return x * 27; }
+inline int f18_28(int x) { return x * 28; }
+inline int f18_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1802 */
+#include <vector>
+#include "h9153.h"
+#include "h6759.h"
+#include "h4065.h"
+#include "h3439.h"
+#include "h9208.h"
+#ifdef X
+#include "h753.h"
+#endif
+struct S1802 { int a; const char *s = "x//y"; };
+inline int f1802_0(int x) { return x * 0; }
+inline int f1802_1(int x) { return x * 1; }
+inline int f1802_2(int x) { return x * 2; }
+inline int f1802_3(int x) { return x * 3; }
+inline int f1802_4(int x) { return x * 4; }
+inline int f1802_5(int x) { return x * 5; }
+inline int f1802_6(int x) { return x * 6; }
+inline int f1802_7(int x) { return x * 7; }
+inline int f1802_8(int x) { return x * 8; }
+inline int f1802_9(int x) { return x * 9; }
+inline int f1802_10(int x) { return x * 10; }
+inline int f1802_11(int x) { return x * 11; }
+inline int f1802_12(int x) { return x * 12; }
+inline int f1802_13(int x) { return x * 13; }
+inline int f1802_14(int x) { return x * 14; }
+inline int f1802_15(int x) { return x * 15; }
+inline int f1802_16(int x) { return x * 16; }
+inline int f1802_17(int x) { return x * 17; }
+inline int f1802_18(int x) { return x * 18; }
+inline int f1802_19(int x) { return x * 19; }
+inline int f1802_20(int x) { return x * 20; }
+inline int f1802_21(int x) { return x * 21; }
+inline int f1802_22(int x) { return x * 22; }
+inline int f1802_23(int x) { return x * 23; }
+inline int f1802_24(int x) { return x * 24; }
+inline int f1802_25(int x) { return x * 25; }
+inline int f1802_26(int x) { return x * 26; }
+inline int f1802_27(int x) { return x * 27; }
+inline int f1802_28(int x) { return x * 28; }
+inline int f1802_29(int x) { return x * 29; }
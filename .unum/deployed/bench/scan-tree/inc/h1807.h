@@ -0,0 +1,42 @@
+#pragma once
+/* header 1807 */
+#include <vector>
+#include "h5695.h"
+#include "h8659.h"
+#include "h2669.h"
+#include "h2329.h"
+#include "h6800.h"
+#ifdef X
+#include "h7668.h"
+#endif
+struct S1807 { int a; const char *s = "x//y"; };
+inline int f1807_0(int x) { return x * 0; }
+inline int f1807_1(int x) { return x * 1; }
+inline int f1807_2(int x) { return x * 2; }
+inline int f1807_3(int x) { return x * 3; }
+inline int f1807_4(int x) { return x * 4; }
+inline int f1807_5(int x) { return x * 5; }
+inline int f1807_6(int x) { return x * 6; }
+inline int f1807_7(int x) { return x * 7; }
+inline int f1807_8(int x) { return x * 8; }
+inline int f1807_9(int x) { return x * 9; }
+inline int f1807_10(int x) { return x * 10; }
+inline int f1807_11(int x) { return x * 11; }
+inline int f1807_12(int x) { return x * 12; }
+inline int f1807_13(int x) { return x * 13; }
+inline int f1807_14(int x) { return x * 14; }
+inline int f1807_15(int x) { return x * 15; }
+inline int f1807_16(int x) { return x * 16; }
+inline int f1807_17(int x) { return x * 17; }
+inline int f1807_18(int x) { return x * 18; }
+inline int f1807_19(int x) { return x * 19; }
+inline int f1807_20(int x) { return x * 20; }
+inline int f1807_21(int x) { return x * 21; }
+inline int f1807_22(int x) { return x * 22; }
+inline int f1807_23(int x) { return x * 23; }
+inline int f1807_24(int x) { return x * 24; }
+inline int f1807_25(int x) { return x * 25; }
+inline int f1807_26(int x) { return x * 26; }
+inline int f1807_27(int x) { return x * 27; }
+inline int f1807_28(int x) { return x * 28; }
+inline int f1807_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1808 */
+#include <vector>
+#include "h4145.h"
+#include "h6023.h"
+#include "h3783.h"
+#include "h3869.h"
+#include "h9772.h"
+#ifdef X
+#include "h2714.h"
+#endif
+struct S1808 { int a; const char *s = "x//y"; };
+inline int f1808_0(int x) { return x * 0; }
+inline int f1808_1(int x) { return x * 1; }
+inline int f1808_2(int x) { return x * 2; }
+inline int f1808_3(int x) { return x * 3; }
+inline int f1808_4(int x) { return x * 4; }
+inline int f1808_5(int x) { return x * 5; }
+inline int f1808_6(int x) { return x * 6; }
+inline int f1808_7(int x) { return x * 7; }
+inline int f1808_8(int x) { return x * 8; }
+inline int f1808_9(int x) { return x * 9; }
+inline int f1808_10(int x) { return x * 10; }
+inline int f1808_11(int x) { return x * 11; }
+inline int f1808_12(int x) { return x * 12; }
+inline int f1808_13(int x) { return x * 13; }
+inline int f1808_14(int x) { return x * 14; }
+inline int f1808_15(int x) { return x * 15; }
+inline int f1808_16(int x) { return x * 16; }
+inline int f1808_17(int x) { return x * 17; }
+inline int f1808_18(int x) { return x * 18; }
+inline int f1808_19(int x) { return x * 19; }
+inline int f1808_20(int x) { return x * 20; }
+inline int f1808_21(int x) { return x * 21; }
+inline int f1808_22(int x) { return x * 22; }
+inline int f1808_23(int x) { return x * 23; }
+inline int f1808_24(int x) { return x * 24; }
+inline int f1808_25(int x) { return x * 25; }
+inline int f1808_26(int x) { return x * 26; }
+inline int f1808_27(int x) { return x * 27; }
+inline int f1808_28(int x) { return x * 28; }
+inline int f1808_29(int x) { return x * 29; }
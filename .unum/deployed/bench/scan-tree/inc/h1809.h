@@ -0,0 +1,42 @@
+#pragma once
+/* header 1809 */
+#include <vector>
+#include "h3133.h"
+#include "h4559.h"
+#include "h6018.h"
+#include "h3404.h"
+#include "h4511.h"
+#ifdef X
+#include "h4110.h"
+#endif
+struct S1809 { int a; const char *s = "x//y"; };
+inline int f1809_0(int x) { return x * 0; }
+inline int f1809_1(int x) { return x * 1; }
+inline int f1809_2(int x) { return x * 2; }
+inline int f1809_3(int x) { return x * 3; }
+inline int f1809_4(int x) { return x * 4; }
+inline int f1809_5(int x) { return x * 5; }
+inline int f1809_6(int x) { return x * 6; }
+inline int f1809_7(int x) { return x * 7; }
+inline int f1809_8(int x) { return x * 8; }
+inline int f1809_9(int x) { return x * 9; }
+inline int f1809_10(int x) { return x * 10; }
+inline int f1809_11(int x) { return x * 11; }
+inline int f1809_12(int x) { return x * 12; }
+inline int f1809_13(int x) { return x * 13; }
+inline int f1809_14(int x) { return x * 14; }
+inline int f1809_15(int x) { return x * 15; }
+inline int f1809_16(int x) { return x * 16; }
+inline int f1809_17(int x) { return x * 17; }
+inline int f1809_18(int x) { return x * 18; }
+inline int f1809_19(int x) { return x * 19; }
+inline int f1809_20(int x) { return x * 20; }
+inline int f1809_21(int x) { return x * 21; }
+inline int f1809_22(int x) { return x * 22; }
+inline int f1809_23(int x) { return x * 23; }
+inline int f1809_24(int x) { return x * 24; }
+inline int f1809_25(int x) { return x * 25; }
+inline int f1809_26(int x) { return x * 26; }
+inline int f1809_27(int x) { return x * 27; }
+inline int f1809_28(int x) { return x * 28; }
+inline int f1809_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 181 */
+#include <vector>
+#include "h3679.h"
+#include "h113.h"
+#include "h2457.h"
+#include "h9881.h"
+#include "h9942.h"
+#ifdef X
+#include "h8152.h"
+#endif
+struct S181 { int a; const char *s = "x//y"; };
+inline int f181_0(int x) { return x * 0; }
+inline int f181_1(int x) { return x * 1; }
+inline int f181_2(int x) { return x * 2; }
+inline int f181_3(int x) { return x * 3; }
+inline int f181_4(int x) { return x * 4; }
+inline int f181_5(int x) { return x * 5; }
+inline int f181_6(int x) { return x * 6; }
+inline int f181_7(int x) { return x * 7; }
+inline int f181_8(int x) { return x * 8; }
+inline int f181_9(int x) { return x * 9; }
+inline int f181_10(int x) { return x * 10; }
+inline int f181_11(int x) { return x * 11; }
+inline int f181_12(int x) { return x * 12; }
+inline int f181_13(int x) { return x * 13; }
+inline int f181_14(int x) { return x * 14; }
+inline int f181_15(int x) { return x * 15; }
+inline int f181_16(int x) { return x * 16; }
+inline int f181_17(int x) { return x * 17; }
+inline int f181_18(int x) { return x * 18; }
+inline int f181_19(int x) { return x * 19; }
+inline int f181_20(int x) { return x * 20; }
+inline int f181_21(int x) { return x * 21; }
+inline int f181_22(int x) { return x * 22; }
+inline int f181_23(int x) { return x * 23; }
+inline int f181_24(int x) { return x * 24; }
+inline int f181_25(int x) { return x * 25; }
+inline int f181_26(int x) { return x * 26; }
+inline int f181_27(int x) { return x * 27; }
+inline int f181_28(int x) { return x * 28; }
+inline int f181_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1812 */
+#include <vector>
+#include "h4959.h"
+#include "h323.h"
+#include "h8442.h"
+#include "h1073.h"
+#include "h6098.h"
+#ifdef X
+#include "h2349.h"
+#endif
+struct S1812 { int a; const char *s = "x//y"; };
+inline int f1812_0(int x) { return x * 0; }
+inline int f1812_1(int x) { return x * 1; }
+inline int f1812_2(int x) { return x * 2; }
+inline int f1812_3(int x) { return x * 3; }
+inline int f1812_4(int x) { return x * 4; }
+inline int f1812_5(int x) { return x * 5; }
+inline int f1812_6(int x) { return x * 6; }
+inline int f1812_7(int x) { return x * 7; }
+inline int f1812_8(int x) { return x * 8; }
+inline int f1812_9(int x) { return x * 9; }
+inline int f1812_10(int x) { return x * 10; }
+inline int f1812_11(int x) { return x * 11; }
+inline int f1812_12(int x) { return x * 12; }
+inline int f1812_13(int x) { return x * 13; }
+inline int f1812_14(int x) { return x * 14; }
+inline int f1812_15(int x) { return x * 15; }
+inline int f1812_16(int x) { return x * 16; }
+inline int f1812_17(int x) { return x * 17; }
+inline int f1812_18(int x) { return x * 18; }
+inline int f1812_19(int x) { return x * 19; }
+inline int f1812_20(int x) { return x * 20; }
+inline int f1812_21(int x) { return x * 21; }
+inline int f1812_22(int x) { return x * 22; }
+inline int f1812_23(int x) { return x * 23; }
+inline int f1812_24(int x) { return x * 24; }
+inline int f1812_25(int x) { return x * 25; }
+inline int f1812_26(int x) { return x * 26; }
+inline int f1812_27(int x) { return x * 27; }
+inline int f1812_28(int x) { return x * 28; }
+inline int f1812_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1816 */
+#include <vector>
+#include "h5541.h"
+#include "h8073.h"
+#include "h2917.h"
+#include "h4697.h"
+#include "h521.h"
+#ifdef X
+#include "h4406.h"
+#endif
+struct S1816 { int a; const char *s = "x//y"; };
+inline int f1816_0(int x) { return x * 0; }
+inline int f1816_1(int x) { return x * 1; }
+inline int f1816_2(int x) { return x * 2; }
+inline int f1816_3(int x) { return x * 3; }
+inline int f1816_4(int x) { return x * 4; }
+inline int f1816_5(int x) { return x * 5; }
+inline int f1816_6(int x) { return x * 6; }
+inline int f1816_7(int x) { return x * 7; }
+inline int f1816_8(int x) { return x * 8; }
+inline int f1816_9(int x) { return x * 9; }
+inline int f1816_10(int x) { return x * 10; }
+inline int f1816_11(int x) { return x * 11; }
+inline int f1816_12(int x) { return x * 12; }
+inline int f1816_13(int x) { return x * 13; }
+inline int f1816_14(int x) { return x * 14; }
+inline int f1816_15(int x) { return x * 15; }
+inline int f1816_16(int x) { return x * 16; }
+inline int f1816_17(int x) { return x * 17; }
+inline int f1816_18(int x) { return x * 18; }
+inline int f1816_19(int x) { return x * 19; }
+inline int f1816_20(int x) { return x * 20; }
+inline int f1816_21(int x) { return x * 21; }
+inline int f1816_22(int x) { return x * 22; }
+inline int f1816_23(int x) { return x * 23; }
+inline int f1816_24(int x) { return x * 24; }
+inline int f1816_25(int x) { return x * 25; }
+inline int f1816_26(int x) { return x * 26; }
+inline int f1816_27(int x) { return x * 27; }
+inline int f1816_28(int x) { return x * 28; }
+inline int f1816_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1817 */
+#include <vector>
+#include "h4399.h"
+#include "h9844.h"
+#include "h7261.h"
+#include "h1612.h"
+#include "h2309.h"
+#ifdef X
+#include "h5170.h"
+#endif
+struct S1817 { int a; const char *s = "x//y"; };
+inline int f1817_0(int x) { return x * 0; }
+inline int f1817_1(int x) { return x * 1; }
+inline int f1817_2(int x) { return x * 2; }
+inline int f1817_3(int x) { return x * 3; }
+inline int f1817_4(int x) { return x * 4; }
+inline int f1817_5(int x) { return x * 5; }
+inline int f1817_6(int x) { return x * 6; }
+inline int f1817_7(int x) { return x * 7; }
+inline int f1817_8(int x) { return x * 8; }
+inline int f1817_9(int x) { return x * 9; }
+inline int f1817_10(int x) { return x * 10; }
+inline int f1817_11(int x) { return x * 11; }
+inline int f1817_12(int x) { return x * 12; }
+inline int f1817_13(int x) { return x * 13; }
+inline int f1817_14(int x) { return x * 14; }
+inline int f1817_15(int x) { return x * 15; }
+inline int f1817_16(int x) { return x * 16; }
+inline int f1817_17(int x) { return x * 17; }
+inline int f1817_18(int x) { return x * 18; }
+inline int f1817_19(int x) { return x * 19; }
+inline int f1817_20(int x) { return x * 20; }
+inline int f1817_21(int x) { return x * 21; }
+inline int f1817_22(int x) { return x * 22; }
+inline int f1817_23(int x) { return x * 23; }
+inline int f1817_24(int x) { return x * 24; }
+inline int f1817_25(int x) { return x * 25; }
+inline int f1817_26(int x) { return x * 26; }
+inline int f1817_27(int x) { return x * 27; }
+inline int f1817_28(int x) { return x * 28; }
+inline int f1817_29(int x) { return x * 29; }
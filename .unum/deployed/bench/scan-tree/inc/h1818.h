@@ -0,0 +1,42 @@
+#pragma once
+/* header 1818 */
+#include <vector>
+#include "h1440.h"
+#include "h5068.h"
+#include "h8023.h"
+#include "h953.h"
+#include "h5552.h"
+#ifdef X
+#include "h5373.h"
+#endif
+struct S1818 { int a; const char *s = "x//y"; };
+inline int f1818_0(int x) { return x * 0; }
+inline int f1818_1(int x) { return x * 1; }
+inline int f1818_2(int x) { return x * 2; }
+inline int f1818_3(int x) { return x * 3; }
+inline int f1818_4(int x) { return x * 4; }
+inline int f1818_5(int x) { return x * 5; }
+inline int f1818_6(int x) { return x * 6; }
+inline int f1818_7(int x) { return x * 7; }
+inline int f1818_8(int x) { return x * 8; }
+inline int f1818_9(int x) { return x * 9; }
+inline int f1818_10(int x) { return x * 10; }
+inline int f1818_11(int x) { return x * 11; }
+inline int f1818_12(int x) { return x * 12; }
+inline int f1818_13(int x) { return x * 13; }
+inline int f1818_14(int x) { return x * 14; }
+inline int f1818_15(int x) { return x * 15; }
+inline int f1818_16(int x) { return x * 16; }
+inline int f1818_17(int x) { return x * 17; }
+inline int f1818_18(int x) { return x * 18; }
+inline int f1818_19(int x) { return x * 19; }
+inline int f1818_20(int x) { return x * 20; }
+inline int f1818_21(int x) { return x * 21; }
+inline int f1818_22(int x) { return x * 22; }
+inline int f1818_23(int x) { return x * 23; }
+inline int f1818_24(int x) { return x * 24; }
+inline int f1818_25(int x) { return x * 25; }
+inline int f1818_26(int x) { return x * 26; }
+inline int f1818_27(int x) { return x * 27; }
+inline int f1818_28(int x) { return x * 28; }
+inline int f1818_29(int x) { return x * 29; }
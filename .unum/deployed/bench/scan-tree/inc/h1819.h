@@ -0,0 +1,42 @@
+#pragma once
+/* header 1819 */
+#include <vector>
+#include "h2847.h"
+#include "h1902.h"
+#include "h1346.h"
+#include "h8519.h"
+#include "h315.h"
+#ifdef X
+#include "h5756.h"
+#endif
+struct S1819 { int a; const char *s = "x//y"; };
+inline int f1819_0(int x) { return x * 0; }
+inline int f1819_1(int x) { return x * 1; }
+inline int f1819_2(int x) { return x * 2; }
+inline int f1819_3(int x) { return x * 3; }
+inline int f1819_4(int x) { return x * 4; }
+inline int f1819_5(int x) { return x * 5; }
+inline int f1819_6(int x) { return x * 6; }
+inline int f1819_7(int x) { return x * 7; }
+inline int f1819_8(int x) { return x * 8; }
+inline int f1819_9(int x) { return x * 9; }
+inline int f1819_10(int x) { return x * 10; }
+inline int f1819_11(int x) { return x * 11; }
+inline int f1819_12(int x) { return x * 12; }
+inline int f1819_13(int x) { return x * 13; }
+inline int f1819_14(int x) { return x * 14; }
+inline int f1819_15(int x) { return x * 15; }
+inline int f1819_16(int x) { return x * 16; }
+inline int f1819_17(int x) { return x * 17; }
+inline int f1819_18(int x) { return x * 18; }
+inline int f1819_19(int x) { return x * 19; }
+inline int f1819_20(int x) { return x * 20; }
+inline int f1819_21(int x) { return x * 21; }
+inline int f1819_22(int x) { return x * 22; }
+inline int f1819_23(int x) { return x * 23; }
+inline int f1819_24(int x) { return x * 24; }
+inline int f1819_25(int x) { return x * 25; }
+inline int f1819_26(int x) { return x * 26; }
+inline int f1819_27(int x) { return x * 27; }
+inline int f1819_28(int x) { return x * 28; }
+inline int f1819_29(int x) { return x * 29; }
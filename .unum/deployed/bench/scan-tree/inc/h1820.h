@@ -0,0 +1,42 @@
+#pragma once
+/* header 1820 */
+#include <vector>
+#include "h1598.h"
+#include "h4362.h"
+#include "h2682.h"
+#include "h9198.h"
+#include "h2081.h"
+#ifdef X
+#include "h9299.h"
+#endif
+struct S1820 { int a; const char *s = "x//y"; };
+inline int f1820_0(int x) { return x * 0; }
+inline int f1820_1(int x) { return x * 1; }
+inline int f1820_2(int x) { return x * 2; }
+inline int f1820_3(int x) { return x * 3; }
+inline int f1820_4(int x) { return x * 4; }
+inline int f1820_5(int x) { return x * 5; }
+inline int f1820_6(int x) { return x * 6; }
+inline int f1820_7(int x) { return x * 7; }
+inline int f1820_8(int x) { return x * 8; }
+inline int f1820_9(int x) { return x * 9; }
+inline int f1820_10(int x) { return x * 10; }
+inline int f1820_11(int x) { return x * 11; }
+inline int f1820_12(int x) { return x * 12; }
+inline int f1820_13(int x) { return x * 13; }
+inline int f1820_14(int x) { return x * 14; }
+inline int f1820_15(int x) { return x * 15; }
+inline int f1820_16(int x) { return x * 16; }
+inline int f1820_17(int x) { return x * 17; }
+inline int f1820_18(int x) { return x * 18; }
+inline int f1820_19(int x) { return x * 19; }
+inline int f1820_20(int x) { return x * 20; }
+inline int f1820_21(int x) { return x * 21; }
+inline int f1820_22(int x) { return x * 22; }
+inline int f1820_23(int x) { return x * 23; }
+inline int f1820_24(int x) { return x * 24; }
+inline int f1820_25(int x) { return x * 25; }
+inline int f1820_26(int x) { return x * 26; }
+inline int f1820_27(int x) { return x * 27; }
+inline int f1820_28(int x) { return x * 28; }
+inline int f1820_29(int x) { return x * 29; }
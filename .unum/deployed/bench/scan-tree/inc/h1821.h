@@ -0,0 +1,42 @@
+#pragma once
+/* header 1821 */
+#include <vector>
+#include "h1277.h"
+#include "h9508.h"
+#include "h3640.h"
+#include "h2354.h"
+#include "h4130.h"
+#ifdef X
+#include "h8946.h"
+#endif
+struct S1821 { int a; const char *s = "x//y"; };
+inline int f1821_0(int x) { return x * 0; }
+inline int f1821_1(int x) { return x * 1; }
+inline int f1821_2(int x) { return x * 2; }
+inline int f1821_3(int x) { return x * 3; }
+inline int f1821_4(int x) { return x * 4; }
+inline int f1821_5(int x) { return x * 5; }
+inline int f1821_6(int x) { return x * 6; }
+inline int f1821_7(int x) { return x * 7; }
+inline int f1821_8(int x) { return x * 8; }
+inline int f1821_9(int x) { return x * 9; }
+inline int f1821_10(int x) { return x * 10; }
+inline int f1821_11(int x) { return x * 11; }
+inline int f1821_12(int x) { return x * 12; }
+inline int f1821_13(int x) { return x * 13; }
+inline int f1821_14(int x) { return x * 14; }
+inline int f1821_15(int x) { return x * 15; }
+inline int f1821_16(int x) { return x * 16; }
+inline int f1821_17(int x) { return x * 17; }
+inline int f1821_18(int x) { return x * 18; }
+inline int f1821_19(int x) { return x * 19; }
+inline int f1821_20(int x) { return x * 20; }
+inline int f1821_21(int x) { return x * 21; }
+inline int f1821_22(int x) { return x * 22; }
+inline int f1821_23(int x) { return x * 23; }
+inline int f1821_24(int x) { return x * 24; }
+inline int f1821_25(int x) { return x * 25; }
+inline int f1821_26(int x) { return x * 26; }
+inline int f1821_27(int x) { return x * 27; }
+inline int f1821_28(int x) { return x * 28; }
+inline int f1821_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1825 */
+#include <vector>
+#include "h249.h"
+#include "h6827.h"
+#include "h8896.h"
+#include "h3431.h"
+#include "h2719.h"
+#ifdef X
+#include "h431.h"
+#endif
+struct S1825 { int a; const char *s = "x//y"; };
+inline int f1825_0(int x) { return x * 0; }
+inline int f1825_1(int x) { return x * 1; }
+inline int f1825_2(int x) { return x * 2; }
+inline int f1825_3(int x) { return x * 3; }
+inline int f1825_4(int x) { return x * 4; }
+inline int f1825_5(int x) { return x * 5; }
+inline int f1825_6(int x) { return x * 6; }
+inline int f1825_7(int x) { return x * 7; }
+inline int f1825_8(int x) { return x * 8; }
+inline int f1825_9(int x) { return x * 9; }
+inline int f1825_10(int x) { return x * 10; }
+inline int f1825_11(int x) { return x * 11; }
+inline int f1825_12(int x) { return x * 12; }
+inline int f1825_13(int x) { return x * 13; }
+inline int f1825_14(int x) { return x * 14; }
+inline int f1825_15(int x) { return x * 15; }
+inline int f1825_16(int x) { return x * 16; }
+inline int f1825_17(int x) { return x * 17; }
+inline int f1825_18(int x) { return x * 18; }
+inline int f1825_19(int x) { return x * 19; }
+inline int f1825_20(int x) { return x * 20; }
+inline int f1825_21(int x) { return x * 21; }
+inline int f1825_22(int x) { return x * 22; }
+inline int f1825_23(int x) { return x * 23; }
+inline int f1825_24(int x) { return x * 24; }
+inline int f1825_25(int x) { return x * 25; }
+inline int f1825_26(int x) { return x * 26; }
+inline int f1825_27(int x) { return x * 27; }
+inline int f1825_28(int x) { return x * 28; }
+inline int f1825_29(int x) { return x * 29; }
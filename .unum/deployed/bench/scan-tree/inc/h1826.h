@@ -0,0 +1,42 @@
+#pragma once
+/* header 1826 */
+#include <vector>
+#include "h7213.h"
+#include "h5424.h"
+#include "h2594.h"
+#include "h6693.h"
+#include "h4935.h"
+#ifdef X
+#include "h3558.h"
+#endif
+struct S1826 { int a; const char *s = "x//y"; };
+inline int f1826_0(int x) { return x * 0; }
+inline int f1826_1(int x) { return x * 1; }
+inline int f1826_2(int x) { return x * 2; }
+inline int f1826_3(int x) { return x * 3; }
+inline int f1826_4(int x) { return x * 4; }
+inline int f1826_5(int x) { return x * 5; }
+inline int f1826_6(int x) { return x * 6; }
+inline int f1826_7(int x) { return x * 7; }
+inline int f1826_8(int x) { return x * 8; }
+inline int f1826_9(int x) { return x * 9; }
+inline int f1826_10(int x) { return x * 10; }
+inline int f1826_11(int x) { return x * 11; }
+inline int f1826_12(int x) { return x * 12; }
+inline int f1826_13(int x) { return x * 13; }
+inline int f1826_14(int x) { return x * 14; }
+inline int f1826_15(int x) { return x * 15; }
+inline int f1826_16(int x) { return x * 16; }
+inline int f1826_17(int x) { return x * 17; }
+inline int f1826_18(int x) { return x * 18; }
+inline int f1826_19(int x) { return x * 19; }
+inline int f1826_20(int x) { return x * 20; }
+inline int f1826_21(int x) { return x * 21; }
+inline int f1826_22(int x) { return x * 22; }
+inline int f1826_23(int x) { return x * 23; }
+inline int f1826_24(int x) { return x * 24; }
+inline int f1826_25(int x) { return x * 25; }
+inline int f1826_26(int x) { return x * 26; }
+inline int f1826_27(int x) { return x * 27; }
+inline int f1826_28(int x) { return x * 28; }
+inline int f1826_29(int x) { return x * 29; }
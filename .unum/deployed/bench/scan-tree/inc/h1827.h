@@ -0,0 +1,42 @@
+#pragma once
+/* header 1827 */
+#include <vector>
+#include "h3079.h"
+#include "h830.h"
+#include "h5400.h"
+#include "h8021.h"
+#include "h1267.h"
+#ifdef X
+#include "h7491.h"
+#endif
+struct S1827 { int a; const char *s = "x//y"; };
+inline int f1827_0(int x) { return x * 0; }
+inline int f1827_1(int x) { return x * 1; }
+inline int f1827_2(int x) { return x * 2; }
+inline int f1827_3(int x) { return x * 3; }
+inline int f1827_4(int x) { return x * 4; }
+inline int f1827_5(int x) { return x * 5; }
+inline int f1827_6(int x) { return x * 6; }
+inline int f1827_7(int x) { return x * 7; }
+inline int f1827_8(int x) { return x * 8; }
+inline int f1827_9(int x) { return x * 9; }
+inline int f1827_10(int x) { return x * 10; }
+inline int f1827_11(int x) { return x * 11; }
+inline int f1827_12(int x) { return x * 12; }
+inline int f1827_13(int x) { return x * 13; }
+inline int f1827_14(int x) { return x * 14; }
+inline int f1827_15(int x) { return x * 15; }
+inline int f1827_16(int x) { return x * 16; }
+inline int f1827_17(int x) { return x * 17; }
+inline int f1827_18(int x) { return x * 18; }
+inline int f1827_19(int x) { return x * 19; }
+inline int f1827_20(int x) { return x * 20; }
+inline int f1827_21(int x) { return x * 21; }
+inline int f1827_22(int x) { return x * 22; }
+inline int f1827_23(int x) { return x * 23; }
+inline int f1827_24(int x) { return x * 24; }
+inline int f1827_25(int x) { return x * 25; }
+inline int f1827_26(int x) { return x * 26; }
+inline int f1827_27(int x) { return x * 27; }
+inline int f1827_28(int x) { return x * 28; }
+inline int f1827_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1829 */
+#include <vector>
+#include "h1326.h"
+#include "h1820.h"
+#include "h5922.h"
+#include "h3874.h"
+#include "h5969.h"
+#ifdef X
+#include "h6607.h"
+#endif
+struct S1829 { int a; const char *s = "x//y"; };
+inline int f1829_0(int x) { return x * 0; }
+inline int f1829_1(int x) { return x * 1; }
+inline int f1829_2(int x) { return x * 2; }
+inline int f1829_3(int x) { return x * 3; }
+inline int f1829_4(int x) { return x * 4; }
+inline int f1829_5(int x) { return x * 5; }
+inline int f1829_6(int x) { return x * 6; }
+inline int f1829_7(int x) { return x * 7; }
+inline int f1829_8(int x) { return x * 8; }
+inline int f1829_9(int x) { return x * 9; }
+inline int f1829_10(int x) { return x * 10; }
+inline int f1829_11(int x) { return x * 11; }
+inline int f1829_12(int x) { return x * 12; }
+inline int f1829_13(int x) { return x * 13; }
+inline int f1829_14(int x) { return x * 14; }
+inline int f1829_15(int x) { return x * 15; }
+inline int f1829_16(int x) { return x * 16; }
+inline int f1829_17(int x) { return x * 17; }
+inline int f1829_18(int x) { return x * 18; }
+inline int f1829_19(int x) { return x * 19; }
+inline int f1829_20(int x) { return x * 20; }
+inline int f1829_21(int x) { return x * 21; }
+inline int f1829_22(int x) { return x * 22; }
+inline int f1829_23(int x) { return x * 23; }
+inline int f1829_24(int x) { return x * 24; }
+inline int f1829_25(int x) { return x * 25; }
+inline int f1829_26(int x) { return x * 26; }
+inline int f1829_27(int x) { return x * 27; }
+inline int f1829_28(int x) { return x * 28; }
+inline int f1829_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 183 */
+#include <vector>
+#include "h8824.h"
+#include "h7626.h"
+#include "h993.h"
+#include "h3772.h"
+#include "h80.h"
+#ifdef X
+#include "h8938.h"
+#endif
+struct S183 { int a; const char *s = "x//y"; };
+inline int f183_0(int x) { return x * 0; }
+inline int f183_1(int x) { return x * 1; }
+inline int f183_2(int x) { return x * 2; }
+inline int f183_3(int x) { return x * 3; }
+inline int f183_4(int x) { return x * 4; }
+inline int f183_5(int x) { return x * 5; }
+inline int f183_6(int x) { return x * 6; }
+inline int f183_7(int x) { return x * 7; }
+inline int f183_8(int x) { return x * 8; }
+inline int f183_9(int x) { return x * 9; }
+inline int f183_10(int x) { return x * 10; }
+inline int f183_11(int x) { return x * 11; }
+inline int f183_12(int x) { return x * 12; }
+inline int f183_13(int x) { return x * 13; }
+inline int f183_14(int x) { return x * 14; }
+inline int f183_15(int x) { return x * 15; }
+inline int f183_16(int x) { return x * 16; }
+inline int f183_17(int x) { return x * 17; }
+inline int f183_18(int x) { return x * 18; }
+inline int f183_19(int x) { return x * 19; }
+inline int f183_20(int x) { return x * 20; }
+inline int f183_21(int x) { return x * 21; }
+inline int f183_22(int x) { return x * 22; }
+inline int f183_23(int x) { return x * 23; }
+inline int f183_24(int x) { return x * 24; }
+inline int f183_25(int x) { return x * 25; }
+inline int f183_26(int x) { return x * 26; }
+inline int f183_27(int x) { return x * 27; }
+inline int f183_28(int x) { return x * 28; }
+inline int f183_29(int x) { return x * 29; }
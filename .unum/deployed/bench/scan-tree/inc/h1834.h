@@ -0,0 +1,42 @@
+#pragma once
+/* header 1834 */
+#include <vector>
+#include "h7820.h"
+#include "h4224.h"
+#include "h875.h"
+#include "h193.h"
+#include "h5805.h"
+#ifdef X
+#include "h4718.h"
+#endif
+struct S1834 { int a; const char *s = "x//y"; };
+inline int f1834_0(int x) { return x * 0; }
+inline int f1834_1(int x) { return x * 1; }
+inline int f1834_2(int x) { return x * 2; }
+inline int f1834_3(int x) { return x * 3; }
+inline int f1834_4(int x) { return x * 4; }
+inline int f1834_5(int x) { return x * 5; }
+inline int f1834_6(int x) { return x * 6; }
+inline int f1834_7(int x) { return x * 7; }
+inline int f1834_8(int x) { return x * 8; }
+inline int f1834_9(int x) { return x * 9; }
+inline int f1834_10(int x) { return x * 10; }
+inline int f1834_11(int x) { return x * 11; }
+inline int f1834_12(int x) { return x * 12; }
+inline int f1834_13(int x) { return x * 13; }
+inline int f1834_14(int x) { return x * 14; }
+inline int f1834_15(int x) { return x * 15; }
+inline int f1834_16(int x) { return x * 16; }
+inline int f1834_17(int x) { return x * 17; }
+inline int f1834_18(int x) { return x * 18; }
+inline int f1834_19(int x) { return x * 19; }
+inline int f1834_20(int x) { return x * 20; }
+inline int f1834_21(int x) { return x * 21; }
+inline int f1834_22(int x) { return x * 22; }
+inline int f1834_23(int x) { return x * 23; }
+inline int f1834_24(int x) { return x * 24; }
+inline int f1834_25(int x) { return x * 25; }
+inline int f1834_26(int x) { return x * 26; }
+inline int f1834_27(int x) { return x * 27; }
+inline int f1834_28(int x) { return x * 28; }
+inline int f1834_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1836 */
+#include <vector>
+#include "h8417.h"
+#include "h5631.h"
+#include "h7313.h"
+#include "h678.h"
+#include "h6892.h"
+#ifdef X
+#include "h8161.h"
+#endif
+struct S1836 { int a; const char *s = "x//y"; };
+inline int f1836_0(int x) { return x * 0; }
+inline int f1836_1(int x) { return x * 1; }
+inline int f1836_2(int x) { return x * 2; }
+inline int f1836_3(int x) { return x * 3; }
+inline int f1836_4(int x) { return x * 4; }
+inline int f1836_5(int x) { return x * 5; }
+inline int f1836_6(int x) { return x * 6; }
+inline int f1836_7(int x) { return x * 7; }
+inline int f1836_8(int x) { return x * 8; }
+inline int f1836_9(int x) { return x * 9; }
+inline int f1836_10(int x) { return x * 10; }
+inline int f1836_11(int x) { return x * 11; }
+inline int f1836_12(int x) { return x * 12; }
+inline int f1836_13(int x) { return x * 13; }
+inline int f1836_14(int x) { return x * 14; }
+inline int f1836_15(int x) { return x * 15; }
+inline int f1836_16(int x) { return x * 16; }
+inline int f1836_17(int x) { return x * 17; }
+inline int f1836_18(int x) { return x * 18; }
+inline int f1836_19(int x) { return x * 19; }
+inline int f1836_20(int x) { return x * 20; }
+inline int f1836_21(int x) { return x * 21; }
+inline int f1836_22(int x) { return x * 22; }
+inline int f1836_23(int x) { return x * 23; }
+inline int f1836_24(int x) { return x * 24; }
+inline int f1836_25(int x) { return x * 25; }
+inline int f1836_26(int x) { return x * 26; }
+inline int f1836_27(int x) { return x * 27; }
+inline int f1836_28(int x) { return x * 28; }
+inline int f1836_29(int x) { return x * 29; }
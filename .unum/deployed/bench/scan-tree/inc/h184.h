@@ -0,0 +1,42 @@
+#pragma once
+/* header 184 */
+#include <vector>
+#include "h6958.h"
+#include "h5185.h"
+#include "h7047.h"
+#include "h1434.h"
+#include "h5241.h"
+#ifdef X
+#include "h742.h"
+#endif
+struct S184 { int a; const char *s = "x//y"; };
+inline int f184_0(int x) { return x * 0; }
+inline int f184_1(int x) { return x * 1; }
+inline int f184_2(int x) { return x * 2; }
+inline int f184_3(int x) { return x * 3; }
+inline int f184_4(int x) { return x * 4; }
+inline int f184_5(int x) { return x * 5; }
+inline int f184_6(int x) { return x * 6; }
+inline int f184_7(int x) { return x * 7; }
+inline int f184_8(int x) { return x * 8; }
+inline int f184_9(int x) { return x * 9; }
+inline int f184_10(int x) { return x * 10; }
+inline int f184_11(int x) { return x * 11; }
+inline int f184_12(int x) { return x * 12; }
+inline int f184_13(int x) { return x * 13; }
+inline int f184_14(int x) { return x * 14; }
+inline int f184_15(int x) { return x * 15; }
+inline int f184_16(int x) { return x * 16; }
+inline int f184_17(int x) { return x * 17; }
+inline int f184_18(int x) { return x * 18; }
+inline int f184_19(int x) { return x * 19; }
+inline int f184_20(int x) { return x * 20; }
+inline int f184_21(int x) { return x * 21; }
+inline int f184_22(int x) { return x * 22; }
+inline int f184_23(int x) { return x * 23; }
+inline int f184_24(int x) { return x * 24; }
+inline int f184_25(int x) { return x * 25; }
+inline int f184_26(int x) { return x * 26; }
+inline int f184_27(int x) { return x * 27; }
+inline int f184_28(int x) { return x * 28; }
+inline int f184_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1840 */
+#include <vector>
+#include "h7277.h"
+#include "h3337.h"
+#include "h5335.h"
+#include "h149.h"
+#include "h9715.h"
+#ifdef X
+#include "h341.h"
+#endif
+struct S1840 { int a; const char *s = "x//y"; };
+inline int f1840_0(int x) { return x * 0; }
+inline int f1840_1(int x) { return x * 1; }
+inline int f1840_2(int x) { return x * 2; }
+inline int f1840_3(int x) { return x * 3; }
+inline int f1840_4(int x) { return x * 4; }
+inline int f1840_5(int x) { return x * 5; }
+inline int f1840_6(int x) { return x * 6; }
+inline int f1840_7(int x) { return x * 7; }
+inline int f1840_8(int x) { return x * 8; }
+inline int f1840_9(int x) { return x * 9; }
+inline int f1840_10(int x) { return x * 10; }
+inline int f1840_11(int x) { return x * 11; }
+inline int f1840_12(int x) { return x * 12; }
+inline int f1840_13(int x) { return x * 13; }
+inline int f1840_14(int x) { return x * 14; }
+inline int f1840_15(int x) { return x * 15; }
+inline int f1840_16(int x) { return x * 16; }
+inline int f1840_17(int x) { return x * 17; }
+inline int f1840_18(int x) { return x * 18; }
+inline int f1840_19(int x) { return x * 19; }
+inline int f1840_20(int x) { return x * 20; }
+inline int f1840_21(int x) { return x * 21; }
+inline int f1840_22(int x) { return x * 22; }
+inline int f1840_23(int x) { return x * 23; }
+inline int f1840_24(int x) { return x * 24; }
+inline int f1840_25(int x) { return x * 25; }
+inline int f1840_26(int x) { return x * 26; }
+inline int f1840_27(int x) { return x * 27; }
+inline int f1840_28(int x) { return x * 28; }
+inline int f1840_29(int x) { return x * 29; }
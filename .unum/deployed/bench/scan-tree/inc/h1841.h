@@ -0,0 +1,42 @@
+#pragma once
+/* header 1841 */
+#include <vector>
+#include "h8745.h"
+#include "h5132.h"
+#include "h4370.h"
+#include "h1646.h"
+#include "h4915.h"
+#ifdef X
+#include "h3932.h"
+#endif
+struct S1841 { int a; const char *s = "x//y"; };
+inline int f1841_0(int x) { return x * 0; }
+inline int f1841_1(int x) { return x * 1; }
+inline int f1841_2(int x) { return x * 2; }
+inline int f1841_3(int x) { return x * 3; }
+inline int f1841_4(int x) { return x * 4; }
+inline int f1841_5(int x) { return x * 5; }
+inline int f1841_6(int x) { return x * 6; }
+inline int f1841_7(int x) { return x * 7; }
+inline int f1841_8(int x) { return x * 8; }
+inline int f1841_9(int x) { return x * 9; }
+inline int f1841_10(int x) { return x * 10; }
+inline int f1841_11(int x) { return x * 11; }
+inline int f1841_12(int x) { return x * 12; }
+inline int f1841_13(int x) { return x * 13; }
+inline int f1841_14(int x) { return x * 14; }
+inline int f1841_15(int x) { return x * 15; }
+inline int f1841_16(int x) { return x * 16; }
+inline int f1841_17(int x) { return x * 17; }
+inline int f1841_18(int x) { return x * 18; }
+inline int f1841_19(int x) { return x * 19; }
+inline int f1841_20(int x) { return x * 20; }
+inline int f1841_21(int x) { return x * 21; }
+inline int f1841_22(int x) { return x * 22; }
+inline int f1841_23(int x) { return x * 23; }
+inline int f1841_24(int x) { return x * 24; }
+inline int f1841_25(int x) { return x * 25; }
+inline int f1841_26(int x) { return x * 26; }
+inline int f1841_27(int x) { return x * 27; }
+inline int f1841_28(int x) { return x * 28; }
+inline int f1841_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1843 */
+#include <vector>
+#include "h4661.h"
+#include "h4983.h"
+#include "h2743.h"
+#include "h5918.h"
+#include "h7419.h"
+#ifdef X
+#include "h5309.h"
+#endif
+struct S1843 { int a; const char *s = "x//y"; };
+inline int f1843_0(int x) { return x * 0; }
+inline int f1843_1(int x) { return x * 1; }
+inline int f1843_2(int x) { return x * 2; }
+inline int f1843_3(int x) { return x * 3; }
+inline int f1843_4(int x) { return x * 4; }
+inline int f1843_5(int x) { return x * 5; }
+inline int f1843_6(int x) { return x * 6; }
+inline int f1843_7(int x) { return x * 7; }
+inline int f1843_8(int x) { return x * 8; }
+inline int f1843_9(int x) { return x * 9; }
+inline int f1843_10(int x) { return x * 10; }
+inline int f1843_11(int x) { return x * 11; }
+inline int f1843_12(int x) { return x * 12; }
+inline int f1843_13(int x) { return x * 13; }
+inline int f1843_14(int x) { return x * 14; }
+inline int f1843_15(int x) { return x * 15; }
+inline int f1843_16(int x) { return x * 16; }
+inline int f1843_17(int x) { return x * 17; }
+inline int f1843_18(int x) { return x * 18; }
+inline int f1843_19(int x) { return x * 19; }
+inline int f1843_20(int x) { return x * 20; }
+inline int f1843_21(int x) { return x * 21; }
+inline int f1843_22(int x) { return x * 22; }
+inline int f1843_23(int x) { return x * 23; }
+inline int f1843_24(int x) { return x * 24; }
+inline int f1843_25(int x) { return x * 25; }
+inline int f1843_26(int x) { return x * 26; }
+inline int f1843_27(int x) { return x * 27; }
+inline int f1843_28(int x) { return x * 28; }
+inline int f1843_29(int x) { return x * 29; }
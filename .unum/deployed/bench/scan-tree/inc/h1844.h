@@ -0,0 +1,42 @@
+#pragma once
+/* header 1844 */
+#include <vector>
+#include "h1138.h"
+#include "h6759.h"
+#include "h6311.h"
+#include "h9639.h"
+#include "h4326.h"
+#ifdef X
+#include "h2387.h"
+#endif
+struct S1844 { int a; const char *s = "x//y"; };
+inline int f1844_0(int x) { return x * 0; }
+inline int f1844_1(int x) { return x * 1; }
+inline int f1844_2(int x) { return x * 2; }
+inline int f1844_3(int x) { return x * 3; }
+inline int f1844_4(int x) { return x * 4; }
+inline int f1844_5(int x) { return x * 5; }
+inline int f1844_6(int x) { return x * 6; }
+inline int f1844_7(int x) { return x * 7; }
+inline int f1844_8(int x) { return x * 8; }
+inline int f1844_9(int x) { return x * 9; }
+inline int f1844_10(int x) { return x * 10; }
+inline int f1844_11(int x) { return x * 11; }
+inline int f1844_12(int x) { return x * 12; }
+inline int f1844_13(int x) { return x * 13; }
+inline int f1844_14(int x) { return x * 14; }
+inline int f1844_15(int x) { return x * 15; }
+inline int f1844_16(int x) { return x * 16; }
+inline int f1844_17(int x) { return x * 17; }
+inline int f1844_18(int x) { return x * 18; }
+inline int f1844_19(int x) { return x * 19; }
+inline int f1844_20(int x) { return x * 20; }
+inline int f1844_21(int x) { return x * 21; }
+inline int f1844_22(int x) { return x * 22; }
+inline int f1844_23(int x) { return x * 23; }
+inline int f1844_24(int x) { return x * 24; }
+inline int f1844_25(int x) { return x * 25; }
+inline int f1844_26(int x) { return x * 26; }
+inline int f1844_27(int x) { return x * 27; }
+inline int f1844_28(int x) { return x * 28; }
+inline int f1844_29(int x) { return x * 29; }
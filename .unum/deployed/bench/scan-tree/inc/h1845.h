@@ -0,0 +1,42 @@
+#pragma once
+/* header 1845 */
+#include <vector>
+#include "h3800.h"
+#include "h6121.h"
+#include "h8627.h"
+#include "h5666.h"
+#include "h934.h"
+#ifdef X
+#include "h8086.h"
+#endif
+struct S1845 { int a; const char *s = "x//y"; };
+inline int f1845_0(int x) { return x * 0; }
+inline int f1845_1(int x) { return x * 1; }
+inline int f1845_2(int x) { return x * 2; }
+inline int f1845_3(int x) { return x * 3; }
+inline int f1845_4(int x) { return x * 4; }
+inline int f1845_5(int x) { return x * 5; }
+inline int f1845_6(int x) { return x * 6; }
+inline int f1845_7(int x) { return x * 7; }
+inline int f1845_8(int x) { return x * 8; }
+inline int f1845_9(int x) { return x * 9; }
+inline int f1845_10(int x) { return x * 10; }
+inline int f1845_11(int x) { return x * 11; }
+inline int f1845_12(int x) { return x * 12; }
+inline int f1845_13(int x) { return x * 13; }
+inline int f1845_14(int x) { return x * 14; }
+inline int f1845_15(int x) { return x * 15; }
+inline int f1845_16(int x) { return x * 16; }
+inline int f1845_17(int x) { return x * 17; }
+inline int f1845_18(int x) { return x * 18; }
+inline int f1845_19(int x) { return x * 19; }
+inline int f1845_20(int x) { return x * 20; }
+inline int f1845_21(int x) { return x * 21; }
+inline int f1845_22(int x) { return x * 22; }
+inline int f1845_23(int x) { return x * 23; }
+inline int f1845_24(int x) { return x * 24; }
+inline int f1845_25(int x) { return x * 25; }
+inline int f1845_26(int x) { return x * 26; }
+inline int f1845_27(int x) { return x * 27; }
+inline int f1845_28(int x) { return x * 28; }
+inline int f1845_29(int x) { return x * 29; }
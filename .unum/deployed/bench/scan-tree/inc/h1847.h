@@ -0,0 +1,42 @@
+#pragma once
+/* header 1847 */
+#include <vector>
+#include "h5820.h"
+#include "h1227.h"
+#include "h9505.h"
+#include "h4213.h"
+#include "h9405.h"
+#ifdef X
+#include "h6253.h"
+#endif
+struct S1847 { int a; const char *s = "x//y"; };
+inline int f1847_0(int x) { return x * 0; }
+inline int f1847_1(int x) { return x * 1; }
+inline int f1847_2(int x) { return x * 2; }
+inline int f1847_3(int x) { return x * 3; }
+inline int f1847_4(int x) { return x * 4; }
+inline int f1847_5(int x) { return x * 5; }
+inline int f1847_6(int x) { return x * 6; }
+inline int f1847_7(int x) { return x * 7; }
+inline int f1847_8(int x) { return x * 8; }
+inline int f1847_9(int x) { return x * 9; }
+inline int f1847_10(int x) { return x * 10; }
+inline int f1847_11(int x) { return x * 11; }
+inline int f1847_12(int x) { return x * 12; }
+inline int f1847_13(int x) { return x * 13; }
+inline int f1847_14(int x) { return x * 14; }
+inline int f1847_15(int x) { return x * 15; }
+inline int f1847_16(int x) { return x * 16; }
+inline int f1847_17(int x) { return x * 17; }
+inline int f1847_18(int x) { return x * 18; }
+inline int f1847_19(int x) { return x * 19; }
+inline int f1847_20(int x) { return x * 20; }
+inline int f1847_21(int x) { return x * 21; }
+inline int f1847_22(int x) { return x * 22; }
+inline int f1847_23(int x) { return x * 23; }
+inline int f1847_24(int x) { return x * 24; }
+inline int f1847_25(int x) { return x * 25; }
+inline int f1847_26(int x) { return x * 26; }
+inline int f1847_27(int x) { return x * 27; }
+inline int f1847_28(int x) { return x * 28; }
+inline int f1847_29(int x) { return x * 29; }
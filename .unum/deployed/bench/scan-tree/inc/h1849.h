@@ -0,0 +1,42 @@
+#pragma once
+/* header 1849 */
+#include <vector>
+#include "h8736.h"
+#include "h6659.h"
+#include "h4234.h"
+#include "h5696.h"
+#include "h8498.h"
+#ifdef X
+#include "h3425.h"
+#endif
+struct S1849 { int a; const char *s = "x//y"; };
+inline int f1849_0(int x) { return x * 0; }
+inline int f1849_1(int x) { return x * 1; }
+inline int f1849_2(int x) { return x * 2; }
+inline int f1849_3(int x) { return x * 3; }
+inline int f1849_4(int x) { return x * 4; }
+inline int f1849_5(int x) { return x * 5; }
+inline int f1849_6(int x) { return x * 6; }
+inline int f1849_7(int x) { return x * 7; }
+inline int f1849_8(int x) { return x * 8; }
+inline int f1849_9(int x) { return x * 9; }
+inline int f1849_10(int x) { return x * 10; }
+inline int f1849_11(int x) { return x * 11; }
+inline int f1849_12(int x) { return x * 12; }
+inline int f1849_13(int x) { return x * 13; }
+inline int f1849_14(int x) { return x * 14; }
+inline int f1849_15(int x) { return x * 15; }
+inline int f1849_16(int x) { return x * 16; }
+inline int f1849_17(int x) { return x * 17; }
+inline int f1849_18(int x) { return x * 18; }
+inline int f1849_19(int x) { return x * 19; }
+inline int f1849_20(int x) { return x * 20; }
+inline int f1849_21(int x) { return x * 21; }
+inline int f1849_22(int x) { return x * 22; }
+inline int f1849_23(int x) { return x * 23; }
+inline int f1849_24(int x) { return x * 24; }
+inline int f1849_25(int x) { return x * 25; }
+inline int f1849_26(int x) { return x * 26; }
+inline int f1849_27(int x) { return x * 27; }
+inline int f1849_28(int x) { return x * 28; }
+inline int f1849_29(int x) { return x * 29; }
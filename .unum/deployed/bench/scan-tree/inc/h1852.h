@@ -0,0 +1,42 @@
+#pragma once
+/* header 1852 */
+#include <vector>
+#include "h5840.h"
+#include "h7072.h"
+#include "h7435.h"
+#include "h672.h"
+#include "h6563.h"
+#ifdef X
+#include "h6127.h"
+#endif
+struct S1852 { int a; const char *s = "x//y"; };
+inline int f1852_0(int x) { return x * 0; }
+inline int f1852_1(int x) { return x * 1; }
+inline int f1852_2(int x) { return x * 2; }
+inline int f1852_3(int x) { return x * 3; }
+inline int f1852_4(int x) { return x * 4; }
+inline int f1852_5(int x) { return x * 5; }
+inline int f1852_6(int x) { return x * 6; }
+inline int f1852_7(int x) { return x * 7; }
+inline int f1852_8(int x) { return x * 8; }
+inline int f1852_9(int x) { return x * 9; }
+inline int f1852_10(int x) { return x * 10; }
+inline int f1852_11(int x) { return x * 11; }
+inline int f1852_12(int x) { return x * 12; }
+inline int f1852_13(int x) { return x * 13; }
+inline int f1852_14(int x) { return x * 14; }
+inline int f1852_15(int x) { return x * 15; }
+inline int f1852_16(int x) { return x * 16; }
+inline int f1852_17(int x) { return x * 17; }
+inline int f1852_18(int x) { return x * 18; }
+inline int f1852_19(int x) { return x * 19; }
+inline int f1852_20(int x) { return x * 20; }
+inline int f1852_21(int x) { return x * 21; }
+inline int f1852_22(int x) { return x * 22; }
+inline int f1852_23(int x) { return x * 23; }
+inline int f1852_24(int x) { return x * 24; }
+inline int f1852_25(int x) { return x * 25; }
+inline int f1852_26(int x) { return x * 26; }
+inline int f1852_27(int x) { return x * 27; }
+inline int f1852_28(int x) { return x * 28; }
+inline int f1852_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1856 */
+#include <vector>
+#include "h9448.h"
+#include "h3057.h"
+#include "h352.h"
+#include "h4905.h"
+#include "h8603.h"
+#ifdef X
+#include "h2556.h"
+#endif
+struct S1856 { int a; const char *s = "x//y"; };
+inline int f1856_0(int x) { return x * 0; }
+inline int f1856_1(int x) { return x * 1; }
+inline int f1856_2(int x) { return x * 2; }
+inline int f1856_3(int x) { return x * 3; }
+inline int f1856_4(int x) { return x * 4; }
+inline int f1856_5(int x) { return x * 5; }
+inline int f1856_6(int x) { return x * 6; }
+inline int f1856_7(int x) { return x * 7; }
+inline int f1856_8(int x) { return x * 8; }
+inline int f1856_9(int x) { return x * 9; }
+inline int f1856_10(int x) { return x * 10; }
+inline int f1856_11(int x) { return x * 11; }
+inline int f1856_12(int x) { return x * 12; }
+inline int f1856_13(int x) { return x * 13; }
+inline int f1856_14(int x) { return x * 14; }
+inline int f1856_15(int x) { return x * 15; }
+inline int f1856_16(int x) { return x * 16; }
+inline int f1856_17(int x) { return x * 17; }
+inline int f1856_18(int x) { return x * 18; }
+inline int f1856_19(int x) { return x * 19; }
+inline int f1856_20(int x) { return x * 20; }
+inline int f1856_21(int x) { return x * 21; }
+inline int f1856_22(int x) { return x * 22; }
+inline int f1856_23(int x) { return x * 23; }
+inline int f1856_24(int x) { return x * 24; }
+inline int f1856_25(int x) { return x * 25; }
+inline int f1856_26(int x) { return x * 26; }
+inline int f1856_27(int x) { return x * 27; }
+inline int f1856_28(int x) { return x * 28; }
+inline int f1856_29(int x) { return x * 29; }
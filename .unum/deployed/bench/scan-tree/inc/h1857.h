@@ -0,0 +1,42 @@
+#pragma once
+/* header 1857 */
+#include <vector>
+#include "h1576.h"
+#include "h7251.h"
+#include "h4633.h"
+#include "h607.h"
+#include "h6878.h"
+#ifdef X
+#include "h5872.h"
+#endif
+struct S1857 { int a; const char *s = "x//y"; };
+inline int f1857_0(int x) { return x * 0; }
+inline int f1857_1(int x) { return x * 1; }
+inline int f1857_2(int x) { return x * 2; }
+inline int f1857_3(int x) { return x * 3; }
+inline int f1857_4(int x) { return x * 4; }
+inline int f1857_5(int x) { return x * 5; }
+inline int f1857_6(int x) { return x * 6; }
+inline int f1857_7(int x) { return x * 7; }
+inline int f1857_8(int x) { return x * 8; }
+inline int f1857_9(int x) { return x * 9; }
+inline int f1857_10(int x) { return x * 10; }
+inline int f1857_11(int x) { return x * 11; }
+inline int f1857_12(int x) { return x * 12; }
+inline int f1857_13(int x) { return x * 13; }
+inline int f1857_14(int x) { return x * 14; }
+inline int f1857_15(int x) { return x * 15; }
+inline int f1857_16(int x) { return x * 16; }
+inline int f1857_17(int x) { return x * 17; }
+inline int f1857_18(int x) { return x * 18; }
+inline int f1857_19(int x) { return x * 19; }
+inline int f1857_20(int x) { return x * 20; }
+inline int f1857_21(int x) { return x * 21; }
+inline int f1857_22(int x) { return x * 22; }
+inline int f1857_23(int x) { return x * 23; }
+inline int f1857_24(int x) { return x * 24; }
+inline int f1857_25(int x) { return x * 25; }
+inline int f1857_26(int x) { return x * 26; }
+inline int f1857_27(int x) { return x * 27; }
+inline int f1857_28(int x) { return x * 28; }
+inline int f1857_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1859 */
+#include <vector>
+#include "h5327.h"
+#include "h4866.h"
+#include "h8248.h"
+#include "h4424.h"
+#include "h432.h"
+#ifdef X
+#include "h4844.h"
+#endif
+struct S1859 { int a; const char *s = "x//y"; };
+inline int f1859_0(int x) { return x * 0; }
+inline int f1859_1(int x) { return x * 1; }
+inline int f1859_2(int x) { return x * 2; }
+inline int f1859_3(int x) { return x * 3; }
+inline int f1859_4(int x) { return x * 4; }
+inline int f1859_5(int x) { return x * 5; }
+inline int f1859_6(int x) { return x * 6; }
+inline int f1859_7(int x) { return x * 7; }
+inline int f1859_8(int x) { return x * 8; }
+inline int f1859_9(int x) { return x * 9; }
+inline int f1859_10(int x) { return x * 10; }
+inline int f1859_11(int x) { return x * 11; }
+inline int f1859_12(int x) { return x * 12; }
+inline int f1859_13(int x) { return x * 13; }
+inline int f1859_14(int x) { return x * 14; }
+inline int f1859_15(int x) { return x * 15; }
+inline int f1859_16(int x) { return x * 16; }
+inline int f1859_17(int x) { return x * 17; }
+inline int f1859_18(int x) { return x * 18; }
+inline int f1859_19(int x) { return x * 19; }
+inline int f1859_20(int x) { return x * 20; }
+inline int f1859_21(int x) { return x * 21; }
+inline int f1859_22(int x) { return x * 22; }
+inline int f1859_23(int x) { return x * 23; }
+inline int f1859_24(int x) { return x * 24; }
+inline int f1859_25(int x) { return x * 25; }
+inline int f1859_26(int x) { return x * 26; }
+inline int f1859_27(int x) { return x * 27; }
+inline int f1859_28(int x) { return x * 28; }
+inline int f1859_29(int x) { return x * 29; }
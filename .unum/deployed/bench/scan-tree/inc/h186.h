@@ -0,0 +1,42 @@
+#pragma once
+/* header 186 */
+#include <vector>
+#include "h9843.h"
+#include "h1138.h"
+#include "h7384.h"
+#include "h4047.h"
+#include "h5351.h"
+#ifdef X
+#include "h6990.h"
+#endif
+struct S186 { int a; const char *s = "x//y"; };
+inline int f186_0(int x) { return x * 0; }
+inline int f186_1(int x) { return x * 1; }
+inline int f186_2(int x) { return x * 2; }
+inline int f186_3(int x) { return x * 3; }
+inline int f186_4(int x) { return x * 4; }
+inline int f186_5(int x) { return x * 5; }
+inline int f186_6(int x) { return x * 6; }
+inline int f186_7(int x) { return x * 7; }
+inline int f186_8(int x) { return x * 8; }
+inline int f186_9(int x) { return x * 9; }
+inline int f186_10(int x) { return x * 10; }
+inline int f186_11(int x) { return x * 11; }
+inline int f186_12(int x) { return x * 12; }
+inline int f186_13(int x) { return x * 13; }
+inline int f186_14(int x) { return x * 14; }
+inline int f186_15(int x) { return x * 15; }
+inline int f186_16(int x) { return x * 16; }
+inline int f186_17(int x) { return x * 17; }
+inline int f186_18(int x) { return x * 18; }
+inline int f186_19(int x) { return x * 19; }
+inline int f186_20(int x) { return x * 20; }
+inline int f186_21(int x) { return x * 21; }
+inline int f186_22(int x) { return x * 22; }
+inline int f186_23(int x) { return x * 23; }
+inline int f186_24(int x) { return x * 24; }
+inline int f186_25(int x) { return x * 25; }
+inline int f186_26(int x) { return x * 26; }
+inline int f186_27(int x) { return x * 27; }
+inline int f186_28(int x) { return x * 28; }
+inline int f186_29(int x) { return x * 29; }
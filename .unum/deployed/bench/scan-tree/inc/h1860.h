@@ -0,0 +1,42 @@
+#pragma once
+/* header 1860 */
+#include <vector>
+#include "h6025.h"
+#include "h3126.h"
+#include "h8188.h"
+#include "h9737.h"
+#include "h1592.h"
+#ifdef X
+#include "h640.h"
+#endif
+struct S1860 { int a; const char *s = "x//y"; };
+inline int f1860_0(int x) { return x * 0; }
+inline int f1860_1(int x) { return x * 1; }
+inline int f1860_2(int x) { return x * 2; }
+inline int f1860_3(int x) { return x * 3; }
+inline int f1860_4(int x) { return x * 4; }
+inline int f1860_5(int x) { return x * 5; }
+inline int f1860_6(int x) { return x * 6; }
+inline int f1860_7(int x) { return x * 7; }
+inline int f1860_8(int x) { return x * 8; }
+inline int f1860_9(int x) { return x * 9; }
+inline int f1860_10(int x) { return x * 10; }
+inline int f1860_11(int x) { return x * 11; }
+inline int f1860_12(int x) { return x * 12; }
+inline int f1860_13(int x) { return x * 13; }
+inline int f1860_14(int x) { return x * 14; }
+inline int f1860_15(int x) { return x * 15; }
+inline int f1860_16(int x) { return x * 16; }
+inline int f1860_17(int x) { return x * 17; }
+inline int f1860_18(int x) { return x * 18; }
+inline int f1860_19(int x) { return x * 19; }
+inline int f1860_20(int x) { return x * 20; }
+inline int f1860_21(int x) { return x * 21; }
+inline int f1860_22(int x) { return x * 22; }
+inline int f1860_23(int x) { return x * 23; }
+inline int f1860_24(int x) { return x * 24; }
+inline int f1860_25(int x) { return x * 25; }
+inline int f1860_26(int x) { return x * 26; }
+inline int f1860_27(int x) { return x * 27; }
+inline int f1860_28(int x) { return x * 28; }
+inline int f1860_29(int x) { return x * 29; }
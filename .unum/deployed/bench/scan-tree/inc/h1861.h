@@ -0,0 +1,42 @@
+#pragma once
+/* header 1861 */
+#include <vector>
+#include "h8774.h"
+#include "h433.h"
+#include "h9731.h"
+#include "h9345.h"
+#include "h6663.h"
+#ifdef X
+#include "h802.h"
+#endif
+struct S1861 { int a; const char *s = "x//y"; };
+inline int f1861_0(int x) { return x * 0; }
+inline int f1861_1(int x) { return x * 1; }
+inline int f1861_2(int x) { return x * 2; }
+inline int f1861_3(int x) { return x * 3; }
+inline int f1861_4(int x) { return x * 4; }
+inline int f1861_5(int x) { return x * 5; }
+inline int f1861_6(int x) { return x * 6; }
+inline int f1861_7(int x) { return x * 7; }
+inline int f1861_8(int x) { return x * 8; }
+inline int f1861_9(int x) { return x * 9; }
+inline int f1861_10(int x) { return x * 10; }
+inline int f1861_11(int x) { return x * 11; }
+inline int f1861_12(int x) { return x * 12; }
+inline int f1861_13(int x) { return x * 13; }
+inline int f1861_14(int x) { return x * 14; }
+inline int f1861_15(int x) { return x * 15; }
+inline int f1861_16(int x) { return x * 16; }
+inline int f1861_17(int x) { return x * 17; }
+inline int f1861_18(int x) { return x * 18; }
+inline int f1861_19(int x) { return x * 19; }
+inline int f1861_20(int x) { return x * 20; }
+inline int f1861_21(int x) { return x * 21; }
+inline int f1861_22(int x) { return x * 22; }
+inline int f1861_23(int x) { return x * 23; }
+inline int f1861_24(int x) { return x * 24; }
+inline int f1861_25(int x) { return x * 25; }
+inline int f1861_26(int x) { return x * 26; }
+inline int f1861_27(int x) { return x * 27; }
+inline int f1861_28(int x) { return x * 28; }
+inline int f1861_29(int x) { return x * 29; }
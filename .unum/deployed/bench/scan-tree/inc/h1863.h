@@ -0,0 +1,42 @@
+#pragma once
+/* header 1863 */
+#include <vector>
+#include "h3822.h"
+#include "h4742.h"
+#include "h9565.h"
+#include "h2157.h"
+#include "h1854.h"
+#ifdef X
+#include "h1106.h"
+#endif
+struct S1863 { int a; const char *s = "x//y"; };
+inline int f1863_0(int x) { return x * 0; }
+inline int f1863_1(int x) { return x * 1; }
+inline int f1863_2(int x) { return x * 2; }
+inline int f1863_3(int x) { return x * 3; }
+inline int f1863_4(int x) { return x * 4; }
+inline int f1863_5(int x) { return x * 5; }
+inline int f1863_6(int x) { return x * 6; }
+inline int f1863_7(int x) { return x * 7; }
+inline int f1863_8(int x) { return x * 8; }
+inline int f1863_9(int x) { return x * 9; }
+inline int f1863_10(int x) { return x * 10; }
+inline int f1863_11(int x) { return x * 11; }
+inline int f1863_12(int x) { return x * 12; }
+inline int f1863_13(int x) { return x * 13; }
+inline int f1863_14(int x) { return x * 14; }
+inline int f1863_15(int x) { return x * 15; }
+inline int f1863_16(int x) { return x * 16; }
+inline int f1863_17(int x) { return x * 17; }
+inline int f1863_18(int x) { return x * 18; }
+inline int f1863_19(int x) { return x * 19; }
+inline int f1863_20(int x) { return x * 20; }
+inline int f1863_21(int x) { return x * 21; }
+inline int f1863_22(int x) { return x * 22; }
+inline int f1863_23(int x) { return x * 23; }
+inline int f1863_24(int x) { return x * 24; }
+inline int f1863_25(int x) { return x * 25; }
+inline int f1863_26(int x) { return x * 26; }
+inline int f1863_27(int x) { return x * 27; }
+inline int f1863_28(int x) { return x * 28; }
+inline int f1863_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1867 */
+#include <vector>
+#include "h373.h"
+#include "h2922.h"
+#include "h4469.h"
+#include "h4442.h"
+#include "h8635.h"
+#ifdef X
+#include "h2375.h"
+#endif
+struct S1867 { int a; const char *s = "x//y"; };
+inline int f1867_0(int x) { return x * 0; }
+inline int f1867_1(int x) { return x * 1; }
+inline int f1867_2(int x) { return x * 2; }
+inline int f1867_3(int x) { return x * 3; }
+inline int f1867_4(int x) { return x * 4; }
+inline int f1867_5(int x) { return x * 5; }
+inline int f1867_6(int x) { return x * 6; }
+inline int f1867_7(int x) { return x * 7; }
+inline int f1867_8(int x) { return x * 8; }
+inline int f1867_9(int x) { return x * 9; }
+inline int f1867_10(int x) { return x * 10; }
+inline int f1867_11(int x) { return x * 11; }
+inline int f1867_12(int x) { return x * 12; }
+inline int f1867_13(int x) { return x * 13; }
+inline int f1867_14(int x) { return x * 14; }
+inline int f1867_15(int x) { return x * 15; }
+inline int f1867_16(int x) { return x * 16; }
+inline int f1867_17(int x) { return x * 17; }
+inline int f1867_18(int x) { return x * 18; }
+inline int f1867_19(int x) { return x * 19; }
+inline int f1867_20(int x) { return x * 20; }
+inline int f1867_21(int x) { return x * 21; }
+inline int f1867_22(int x) { return x * 22; }
+inline int f1867_23(int x) { return x * 23; }
+inline int f1867_24(int x) { return x * 24; }
+inline int f1867_25(int x) { return x * 25; }
+inline int f1867_26(int x) { return x * 26; }
+inline int f1867_27(int x) { return x * 27; }
+inline int f1867_28(int x) { return x * 28; }
+inline int f1867_29(int x) { return x * 29; }
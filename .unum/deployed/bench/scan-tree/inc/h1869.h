@@ -0,0 +1,42 @@
+#pragma once
+/* header 1869 */
+#include <vector>
+#include "h2837.h"
+#include "h9541.h"
+#include "h1426.h"
+#include "h5852.h"
+#include "h8228.h"
+#ifdef X
+#include "h6331.h"
+#endif
+struct S1869 { int a; const char *s = "x//y"; };
+inline int f1869_0(int x) { return x * 0; }
+inline int f1869_1(int x) { return x * 1; }
+inline int f1869_2(int x) { return x * 2; }
+inline int f1869_3(int x) { return x * 3; }
+inline int f1869_4(int x) { return x * 4; }
+inline int f1869_5(int x) { return x * 5; }
+inline int f1869_6(int x) { return x * 6; }
+inline int f1869_7(int x) { return x * 7; }
+inline int f1869_8(int x) { return x * 8; }
+inline int f1869_9(int x) { return x * 9; }
+inline int f1869_10(int x) { return x * 10; }
+inline int f1869_11(int x) { return x * 11; }
+inline int f1869_12(int x) { return x * 12; }
+inline int f1869_13(int x) { return x * 13; }
+inline int f1869_14(int x) { return x * 14; }
+inline int f1869_15(int x) { return x * 15; }
+inline int f1869_16(int x) { return x * 16; }
+inline int f1869_17(int x) { return x * 17; }
+inline int f1869_18(int x) { return x * 18; }
+inline int f1869_19(int x) { return x * 19; }
+inline int f1869_20(int x) { return x * 20; }
+inline int f1869_21(int x) { return x * 21; }
+inline int f1869_22(int x) { return x * 22; }
+inline int f1869_23(int x) { return x * 23; }
+inline int f1869_24(int x) { return x * 24; }
+inline int f1869_25(int x) { return x * 25; }
+inline int f1869_26(int x) { return x * 26; }
+inline int f1869_27(int x) { return x * 27; }
+inline int f1869_28(int x) { return x * 28; }
+inline int f1869_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1870 */
+#include <vector>
+#include "h2938.h"
+#include "h2046.h"
+#include "h734.h"
+#include "h6286.h"
+#include "h3334.h"
+#ifdef X
+#include "h4847.h"
+#endif
+struct S1870 { int a; const char *s = "x//y"; };
+inline int f1870_0(int x) { return x * 0; }
+inline int f1870_1(int x) { return x * 1; }
+inline int f1870_2(int x) { return x * 2; }
+inline int f1870_3(int x) { return x * 3; }
+inline int f1870_4(int x) { return x * 4; }
+inline int f1870_5(int x) { return x * 5; }
+inline int f1870_6(int x) { return x * 6; }
+inline int f1870_7(int x) { return x * 7; }
+inline int f1870_8(int x) { return x * 8; }
+inline int f1870_9(int x) { return x * 9; }
+inline int f1870_10(int x) { return x * 10; }
+inline int f1870_11(int x) { return x * 11; }
+inline int f1870_12(int x) { return x * 12; }
+inline int f1870_13(int x) { return x * 13; }
+inline int f1870_14(int x) { return x * 14; }
+inline int f1870_15(int x) { return x * 15; }
+inline int f1870_16(int x) { return x * 16; }
+inline int f1870_17(int x) { return x * 17; }
+inline int f1870_18(int x) { return x * 18; }
+inline int f1870_19(int x) { return x * 19; }
+inline int f1870_20(int x) { return x * 20; }
+inline int f1870_21(int x) { return x * 21; }
+inline int f1870_22(int x) { return x * 22; }
+inline int f1870_23(int x) { return x * 23; }
+inline int f1870_24(int x) { return x * 24; }
+inline int f1870_25(int x) { return x * 25; }
+inline int f1870_26(int x) { return x * 26; }
+inline int f1870_27(int x) { return x * 27; }
+inline int f1870_28(int x) { return x * 28; }
+inline int f1870_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1872 */
+#include <vector>
+#include "h8085.h"
+#include "h516.h"
+#include "h5893.h"
+#include "h6539.h"
+#include "h645.h"
+#ifdef X
+#include "h2845.h"
+#endif
+struct S1872 { int a; const char *s = "x//y"; };
+inline int f1872_0(int x) { return x * 0; }
+inline int f1872_1(int x) { return x * 1; }
+inline int f1872_2(int x) { return x * 2; }
+inline int f1872_3(int x) { return x * 3; }
+inline int f1872_4(int x) { return x * 4; }
+inline int f1872_5(int x) { return x * 5; }
+inline int f1872_6(int x) { return x * 6; }
+inline int f1872_7(int x) { return x * 7; }
+inline int f1872_8(int x) { return x * 8; }
+inline int f1872_9(int x) { return x * 9; }
+inline int f1872_10(int x) { return x * 10; }
+inline int f1872_11(int x) { return x * 11; }
+inline int f1872_12(int x) { return x * 12; }
+inline int f1872_13(int x) { return x * 13; }
+inline int f1872_14(int x) { return x * 14; }
+inline int f1872_15(int x) { return x * 15; }
+inline int f1872_16(int x) { return x * 16; }
+inline int f1872_17(int x) { return x * 17; }
+inline int f1872_18(int x) { return x * 18; }
+inline int f1872_19(int x) { return x * 19; }
+inline int f1872_20(int x) { return x * 20; }
+inline int f1872_21(int x) { return x * 21; }
+inline int f1872_22(int x) { return x * 22; }
+inline int f1872_23(int x) { return x * 23; }
+inline int f1872_24(int x) { return x * 24; }
+inline int f1872_25(int x) { return x * 25; }
+inline int f1872_26(int x) { return x * 26; }
+inline int f1872_27(int x) { return x * 27; }
+inline int f1872_28(int x) { return x * 28; }
+inline int f1872_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1874 */
+#include <vector>
+#include "h9502.h"
+#include "h851.h"
+#include "h1663.h"
+#include "h2836.h"
+#include "h4578.h"
+#ifdef X
+#include "h1094.h"
+#endif
+struct S1874 { int a; const char *s = "x//y"; };
+inline int f1874_0(int x) { return x * 0; }
+inline int f1874_1(int x) { return x * 1; }
+inline int f1874_2(int x) { return x * 2; }
+inline int f1874_3(int x) { return x * 3; }
+inline int f1874_4(int x) { return x * 4; }
+inline int f1874_5(int x) { return x * 5; }
+inline int f1874_6(int x) { return x * 6; }
+inline int f1874_7(int x) { return x * 7; }
+inline int f1874_8(int x) { return x * 8; }
+inline int f1874_9(int x) { return x * 9; }
+inline int f1874_10(int x) { return x * 10; }
+inline int f1874_11(int x) { return x * 11; }
+inline int f1874_12(int x) { return x * 12; }
+inline int f1874_13(int x) { return x * 13; }
+inline int f1874_14(int x) { return x * 14; }
+inline int f1874_15(int x) { return x * 15; }
+inline int f1874_16(int x) { return x * 16; }
+inline int f1874_17(int x) { return x * 17; }
+inline int f1874_18(int x) { return x * 18; }
+inline int f1874_19(int x) { return x * 19; }
+inline int f1874_20(int x) { return x * 20; }
+inline int f1874_21(int x) { return x * 21; }
+inline int f1874_22(int x) { return x * 22; }
+inline int f1874_23(int x) { return x * 23; }
+inline int f1874_24(int x) { return x * 24; }
+inline int f1874_25(int x) { return x * 25; }
+inline int f1874_26(int x) { return x * 26; }
+inline int f1874_27(int x) { return x * 27; }
+inline int f1874_28(int x) { return x * 28; }
+inline int f1874_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1875 */
+#include <vector>
+#include "h7238.h"
+#include "h7111.h"
+#include "h1220.h"
+#include "h3841.h"
+#include "h3333.h"
+#ifdef X
+#include "h4641.h"
+#endif
+struct S1875 { int a; const char *s = "x//y"; };
+inline int f1875_0(int x) { return x * 0; }
+inline int f1875_1(int x) { return x * 1; }
+inline int f1875_2(int x) { return x * 2; }
+inline int f1875_3(int x) { return x * 3; }
+inline int f1875_4(int x) { return x * 4; }
+inline int f1875_5(int x) { return x * 5; }
+inline int f1875_6(int x) { return x * 6; }
+inline int f1875_7(int x) { return x * 7; }
+inline int f1875_8(int x) { return x * 8; }
+inline int f1875_9(int x) { return x * 9; }
+inline int f1875_10(int x) { return x * 10; }
+inline int f1875_11(int x) { return x * 11; }
+inline int f1875_12(int x) { return x * 12; }
+inline int f1875_13(int x) { return x * 13; }
+inline int f1875_14(int x) { return x * 14; }
+inline int f1875_15(int x) { return x * 15; }
+inline int f1875_16(int x) { return x * 16; }
+inline int f1875_17(int x) { return x * 17; }
+inline int f1875_18(int x) { return x * 18; }
+inline int f1875_19(int x) { return x * 19; }
+inline int f1875_20(int x) { return x * 20; }
+inline int f1875_21(int x) { return x * 21; }
+inline int f1875_22(int x) { return x * 22; }
+inline int f1875_23(int x) { return x * 23; }
+inline int f1875_24(int x) { return x * 24; }
+inline int f1875_25(int x) { return x * 25; }
+inline int f1875_26(int x) { return x * 26; }
+inline int f1875_27(int x) { return x * 27; }
+inline int f1875_28(int x) { return x * 28; }
+inline int f1875_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1878 */
+#include <vector>
+#include "h8833.h"
+#include "h8800.h"
+#include "h7942.h"
+#include "h8792.h"
+#include "h9213.h"
+#ifdef X
+#include "h7072.h"
+#endif
+struct S1878 { int a; const char *s = "x//y"; };
+inline int f1878_0(int x) { return x * 0; }
+inline int f1878_1(int x) { return x * 1; }
+inline int f1878_2(int x) { return x * 2; }
+inline int f1878_3(int x) { return x * 3; }
+inline int f1878_4(int x) { return x * 4; }
+inline int f1878_5(int x) { return x * 5; }
+inline int f1878_6(int x) { return x * 6; }
+inline int f1878_7(int x) { return x * 7; }
+inline int f1878_8(int x) { return x * 8; }
+inline int f1878_9(int x) { return x * 9; }
+inline int f1878_10(int x) { return x * 10; }
+inline int f1878_11(int x) { return x * 11; }
+inline int f1878_12(int x) { return x * 12; }
+inline int f1878_13(int x) { return x * 13; }
+inline int f1878_14(int x) { return x * 14; }
+inline int f1878_15(int x) { return x * 15; }
+inline int f1878_16(int x) { return x * 16; }
+inline int f1878_17(int x) { return x * 17; }
+inline int f1878_18(int x) { return x * 18; }
+inline int f1878_19(int x) { return x * 19; }
+inline int f1878_20(int x) { return x * 20; }
+inline int f1878_21(int x) { return x * 21; }
+inline int f1878_22(int x) { return x * 22; }
+inline int f1878_23(int x) { return x * 23; }
+inline int f1878_24(int x) { return x * 24; }
+inline int f1878_25(int x) { return x * 25; }
+inline int f1878_26(int x) { return x * 26; }
+inline int f1878_27(int x) { return x * 27; }
+inline int f1878_28(int x) { return x * 28; }
+inline int f1878_29(int x) { return x * 29; }
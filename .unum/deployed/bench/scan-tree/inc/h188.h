@@ -0,0 +1,42 @@
+#pragma once
+/* header 188 */
+#include <vector>
+#include "h560.h"
+#include "h2831.h"
+#include "h5788.h"
+#include "h5012.h"
+#include "h1719.h"
+#ifdef X
+#include "h9031.h"
+#endif
+struct S188 { int a; const char *s = "x//y"; };
+inline int f188_0(int x) { return x * 0; }
+inline int f188_1(int x) { return x * 1; }
+inline int f188_2(int x) { return x * 2; }
+inline int f188_3(int x) { return x * 3; }
+inline int f188_4(int x) { return x * 4; }
+inline int f188_5(int x) { return x * 5; }
+inline int f188_6(int x) { return x * 6; }
+inline int f188_7(int x) { return x * 7; }
+inline int f188_8(int x) { return x * 8; }
+inline int f188_9(int x) { return x * 9; }
+inline int f188_10(int x) { return x * 10; }
+inline int f188_11(int x) { return x * 11; }
+inline int f188_12(int x) { return x * 12; }
+inline int f188_13(int x) { return x * 13; }
+inline int f188_14(int x) { return x * 14; }
+inline int f188_15(int x) { return x * 15; }
+inline int f188_16(int x) { return x * 16; }
+inline int f188_17(int x) { return x * 17; }
+inline int f188_18(int x) { return x * 18; }
+inline int f188_19(int x) { return x * 19; }
+inline int f188_20(int x) { return x * 20; }
+inline int f188_21(int x) { return x * 21; }
+inline int f188_22(int x) { return x * 22; }
+inline int f188_23(int x) { return x * 23; }
+inline int f188_24(int x) { return x * 24; }
+inline int f188_25(int x) { return x * 25; }
+inline int f188_26(int x) { return x * 26; }
+inline int f188_27(int x) { return x * 27; }
+inline int f188_28(int x) { return x * 28; }
+inline int f188_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1880 */
+#include <vector>
+#include "h7432.h"
+#include "h6189.h"
+#include "h6811.h"
+#include "h6789.h"
+#include "h1173.h"
+#ifdef X
+#include "h9134.h"
+#endif
+struct S1880 { int a; const char *s = "x//y"; };
+inline int f1880_0(int x) { return x * 0; }
+inline int f1880_1(int x) { return x * 1; }
+inline int f1880_2(int x) { return x * 2; }
+inline int f1880_3(int x) { return x * 3; }
+inline int f1880_4(int x) { return x * 4; }
+inline int f1880_5(int x) { return x * 5; }
+inline int f1880_6(int x) { return x * 6; }
+inline int f1880_7(int x) { return x * 7; }
+inline int f1880_8(int x) { return x * 8; }
+inline int f1880_9(int x) { return x * 9; }
+inline int f1880_10(int x) { return x * 10; }
+inline int f1880_11(int x) { return x * 11; }
+inline int f1880_12(int x) { return x * 12; }
+inline int f1880_13(int x) { return x * 13; }
+inline int f1880_14(int x) { return x * 14; }
+inline int f1880_15(int x) { return x * 15; }
+inline int f1880_16(int x) { return x * 16; }
+inline int f1880_17(int x) { return x * 17; }
+inline int f1880_18(int x) { return x * 18; }
+inline int f1880_19(int x) { return x * 19; }
+inline int f1880_20(int x) { return x * 20; }
+inline int f1880_21(int x) { return x * 21; }
+inline int f1880_22(int x) { return x * 22; }
+inline int f1880_23(int x) { return x * 23; }
+inline int f1880_24(int x) { return x * 24; }
+inline int f1880_25(int x) { return x * 25; }
+inline int f1880_26(int x) { return x * 26; }
+inline int f1880_27(int x) { return x * 27; }
+inline int f1880_28(int x) { return x * 28; }
+inline int f1880_29(int x) { return x * 29; }
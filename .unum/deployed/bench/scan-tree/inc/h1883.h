@@ -0,0 +1,42 @@
+#pragma once
+/* header 1883 */
+#include <vector>
+#include "h4827.h"
+#include "h6880.h"
+#include "h1175.h"
+#include "h8632.h"
+#include "h3817.h"
+#ifdef X
+#include "h9921.h"
+#endif
+struct S1883 { int a; const char *s = "x//y"; };
+inline int f1883_0(int x) { return x * 0; }
+inline int f1883_1(int x) { return x * 1; }
+inline int f1883_2(int x) { return x * 2; }
+inline int f1883_3(int x) { return x * 3; }
+inline int f1883_4(int x) { return x * 4; }
+inline int f1883_5(int x) { return x * 5; }
+inline int f1883_6(int x) { return x * 6; }
+inline int f1883_7(int x) { return x * 7; }
+inline int f1883_8(int x) { return x * 8; }
+inline int f1883_9(int x) { return x * 9; }
+inline int f1883_10(int x) { return x * 10; }
+inline int f1883_11(int x) { return x * 11; }
+inline int f1883_12(int x) { return x * 12; }
+inline int f1883_13(int x) { return x * 13; }
+inline int f1883_14(int x) { return x * 14; }
+inline int f1883_15(int x) { return x * 15; }
+inline int f1883_16(int x) { return x * 16; }
+inline int f1883_17(int x) { return x * 17; }
+inline int f1883_18(int x) { return x * 18; }
+inline int f1883_19(int x) { return x * 19; }
+inline int f1883_20(int x) { return x * 20; }
+inline int f1883_21(int x) { return x * 21; }
+inline int f1883_22(int x) { return x * 22; }
+inline int f1883_23(int x) { return x * 23; }
+inline int f1883_24(int x) { return x * 24; }
+inline int f1883_25(int x) { return x * 25; }
+inline int f1883_26(int x) { return x * 26; }
+inline int f1883_27(int x) { return x * 27; }
+inline int f1883_28(int x) { return x * 28; }
+inline int f1883_29(int x) { return x * 29; }
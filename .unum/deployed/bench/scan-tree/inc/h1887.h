@@ -0,0 +1,42 @@
+#pragma once
+/* header 1887 */
+#include <vector>
+#include "h9329.h"
+#include "h4927.h"
+#include "h6227.h"
+#include "h3042.h"
+#include "h8937.h"
+#ifdef X
+#include "h6882.h"
+#endif
+struct S1887 { int a; const char *s = "x//y"; };
+inline int f1887_0(int x) { return x * 0; }
+inline int f1887_1(int x) { return x * 1; }
+inline int f1887_2(int x) { return x * 2; }
+inline int f1887_3(int x) { return x * 3; }
+inline int f1887_4(int x) { return x * 4; }
+inline int f1887_5(int x) { return x * 5; }
+inline int f1887_6(int x) { return x * 6; }
+inline int f1887_7(int x) { return x * 7; }
+inline int f1887_8(int x) { return x * 8; }
+inline int f1887_9(int x) { return x * 9; }
+inline int f1887_10(int x) { return x * 10; }
+inline int f1887_11(int x) { return x * 11; }
+inline int f1887_12(int x) { return x * 12; }
+inline int f1887_13(int x) { return x * 13; }
+inline int f1887_14(int x) { return x * 14; }
+inline int f1887_15(int x) { return x * 15; }
+inline int f1887_16(int x) { return x * 16; }
+inline int f1887_17(int x) { return x * 17; }
+inline int f1887_18(int x) { return x * 18; }
+inline int f1887_19(int x) { return x * 19; }
+inline int f1887_20(int x) { return x * 20; }
+inline int f1887_21(int x) { return x * 21; }
+inline int f1887_22(int x) { return x * 22; }
+inline int f1887_23(int x) { return x * 23; }
+inline int f1887_24(int x) { return x * 24; }
+inline int f1887_25(int x) { return x * 25; }
+inline int f1887_26(int x) { return x * 26; }
+inline int f1887_27(int x) { return x * 27; }
+inline int f1887_28(int x) { return x * 28; }
+inline int f1887_29(int x) { return x * 29; }
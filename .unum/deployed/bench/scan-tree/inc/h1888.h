@@ -0,0 +1,42 @@
+#pragma once
+/* header 1888 */
+#include <vector>
+#include "h383.h"
+#include "h3319.h"
+#include "h9773.h"
+#include "h4887.h"
+#include "h5386.h"
+#ifdef X
+#include "h126.h"
+#endif
+struct S1888 { int a; const char *s = "x//y"; };
+inline int f1888_0(int x) { return x * 0; }
+inline int f1888_1(int x) { return x * 1; }
+inline int f1888_2(int x) { return x * 2; }
+inline int f1888_3(int x) { return x * 3; }
+inline int f1888_4(int x) { return x * 4; }
+inline int f1888_5(int x) { return x * 5; }
+inline int f1888_6(int x) { return x * 6; }
+inline int f1888_7(int x) { return x * 7; }
+inline int f1888_8(int x) { return x * 8; }
+inline int f1888_9(int x) { return x * 9; }
+inline int f1888_10(int x) { return x * 10; }
+inline int f1888_11(int x) { return x * 11; }
+inline int f1888_12(int x) { return x * 12; }
+inline int f1888_13(int x) { return x * 13; }
+inline int f1888_14(int x) { return x * 14; }
+inline int f1888_15(int x) { return x * 15; }
+inline int f1888_16(int x) { return x * 16; }
+inline int f1888_17(int x) { return x * 17; }
+inline int f1888_18(int x) { return x * 18; }
+inline int f1888_19(int x) { return x * 19; }
+inline int f1888_20(int x) { return x * 20; }
+inline int f1888_21(int x) { return x * 21; }
+inline int f1888_22(int x) { return x * 22; }
+inline int f1888_23(int x) { return x * 23; }
+inline int f1888_24(int x) { return x * 24; }
+inline int f1888_25(int x) { return x * 25; }
+inline int f1888_26(int x) { return x * 26; }
+inline int f1888_27(int x) { return x * 27; }
+inline int f1888_28(int x) { return x * 28; }
+inline int f1888_29(int x) { return x * 29; }
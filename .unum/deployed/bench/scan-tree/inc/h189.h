@@ -0,0 +1,42 @@
+#pragma once
+/* header 189 */
+#include <vector>
+#include "h4439.h"
+#include "h7688.h"
+#include "h7436.h"
+#include "h1338.h"
+#include "h1553.h"
+#ifdef X
+#include "h4704.h"
+#endif
+struct S189 { int a; const char *s = "x//y"; };
+inline int f189_0(int x) { return x * 0; }
+inline int f189_1(int x) { return x * 1; }
+inline int f189_2(int x) { return x * 2; }
+inline int f189_3(int x) { return x * 3; }
+inline int f189_4(int x) { return x * 4; }
+inline int f189_5(int x) { return x * 5; }
+inline int f189_6(int x) { return x * 6; }
+inline int f189_7(int x) { return x * 7; }
+inline int f189_8(int x) { return x * 8; }
+inline int f189_9(int x) { return x * 9; }
+inline int f189_10(int x) { return x * 10; }
+inline int f189_11(int x) { return x * 11; }
+inline int f189_12(int x) { return x * 12; }
+inline int f189_13(int x) { return x * 13; }
+inline int f189_14(int x) { return x * 14; }
+inline int f189_15(int x) { return x * 15; }
+inline int f189_16(int x) { return x * 16; }
+inline int f189_17(int x) { return x * 17; }
+inline int f189_18(int x) { return x * 18; }
+inline int f189_19(int x) { return x * 19; }
+inline int f189_20(int x) { return x * 20; }
+inline int f189_21(int x) { return x * 21; }
+inline int f189_22(int x) { return x * 22; }
+inline int f189_23(int x) { return x * 23; }
+inline int f189_24(int x) { return x * 24; }
+inline int f189_25(int x) { return x * 25; }
+inline int f189_26(int x) { return x * 26; }
+inline int f189_27(int x) { return x * 27; }
+inline int f189_28(int x) { return x * 28; }
+inline int f189_29(int x) { return x * 29; }
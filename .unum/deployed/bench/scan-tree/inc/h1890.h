@@ -0,0 +1,42 @@
+#pragma once
+/* header 1890 */
+#include <vector>
+#include "h4067.h"
+#include "h551.h"
+#include "h9338.h"
+#include "h5573.h"
+#include "h79.h"
+#ifdef X
+#include "h5436.h"
+#endif
+struct S1890 { int a; const char *s = "x//y"; };
+inline int f1890_0(int x) { return x * 0; }
+inline int f1890_1(int x) { return x * 1; }
+inline int f1890_2(int x) { return x * 2; }
+inline int f1890_3(int x) { return x * 3; }
+inline int f1890_4(int x) { return x * 4; }
+inline int f1890_5(int x) { return x * 5; }
+inline int f1890_6(int x) { return x * 6; }
+inline int f1890_7(int x) { return x * 7; }
+inline int f1890_8(int x) { return x * 8; }
+inline int f1890_9(int x) { return x * 9; }
+inline int f1890_10(int x) { return x * 10; }
+inline int f1890_11(int x) { return x * 11; }
+inline int f1890_12(int x) { return x * 12; }
+inline int f1890_13(int x) { return x * 13; }
+inline int f1890_14(int x) { return x * 14; }
+inline int f1890_15(int x) { return x * 15; }
+inline int f1890_16(int x) { return x * 16; }
+inline int f1890_17(int x) { return x * 17; }
+inline int f1890_18(int x) { return x * 18; }
+inline int f1890_19(int x) { return x * 19; }
+inline int f1890_20(int x) { return x * 20; }
+inline int f1890_21(int x) { return x * 21; }
+inline int f1890_22(int x) { return x * 22; }
+inline int f1890_23(int x) { return x * 23; }
+inline int f1890_24(int x) { return x * 24; }
+inline int f1890_25(int x) { return x * 25; }
+inline int f1890_26(int x) { return x * 26; }
+inline int f1890_27(int x) { return x * 27; }
+inline int f1890_28(int x) { return x * 28; }
+inline int f1890_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1891 */
+#include <vector>
+#include "h2398.h"
+#include "h8473.h"
+#include "h3732.h"
+#include "h877.h"
+#include "h6015.h"
+#ifdef X
+#include "h7059.h"
+#endif
+struct S1891 { int a; const char *s = "x//y"; };
+inline int f1891_0(int x) { return x * 0; }
+inline int f1891_1(int x) { return x * 1; }
+inline int f1891_2(int x) { return x * 2; }
+inline int f1891_3(int x) { return x * 3; }
+inline int f1891_4(int x) { return x * 4; }
+inline int f1891_5(int x) { return x * 5; }
+inline int f1891_6(int x) { return x * 6; }
+inline int f1891_7(int x) { return x * 7; }
+inline int f1891_8(int x) { return x * 8; }
+inline int f1891_9(int x) { return x * 9; }
+inline int f1891_10(int x) { return x * 10; }
+inline int f1891_11(int x) { return x * 11; }
+inline int f1891_12(int x) { return x * 12; }
+inline int f1891_13(int x) { return x * 13; }
+inline int f1891_14(int x) { return x * 14; }
+inline int f1891_15(int x) { return x * 15; }
+inline int f1891_16(int x) { return x * 16; }
+inline int f1891_17(int x) { return x * 17; }
+inline int f1891_18(int x) { return x * 18; }
+inline int f1891_19(int x) { return x * 19; }
+inline int f1891_20(int x) { return x * 20; }
+inline int f1891_21(int x) { return x * 21; }
+inline int f1891_22(int x) { return x * 22; }
+inline int f1891_23(int x) { return x * 23; }
+inline int f1891_24(int x) { return x * 24; }
+inline int f1891_25(int x) { return x * 25; }
+inline int f1891_26(int x) { return x * 26; }
+inline int f1891_27(int x) { return x * 27; }
+inline int f1891_28(int x) { return x * 28; }
+inline int f1891_29(int x) { return x * 29; }
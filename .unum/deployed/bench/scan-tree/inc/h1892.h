@@ -0,0 +1,42 @@
+#pragma once
+/* header 1892 */
+#include <vector>
+#include "h322.h"
+#include "h3271.h"
+#include "h5243.h"
+#include "h2929.h"
+#include "h1824.h"
+#ifdef X
+#include "h8911.h"
+#endif
+struct S1892 { int a; const char *s = "x//y"; };
+inline int f1892_0(int x) { return x * 0; }
+inline int f1892_1(int x) { return x * 1; }
+inline int f1892_2(int x) { return x * 2; }
+inline int f1892_3(int x) { return x * 3; }
+inline int f1892_4(int x) { return x * 4; }
+inline int f1892_5(int x) { return x * 5; }
+inline int f1892_6(int x) { return x * 6; }
+inline int f1892_7(int x) { return x * 7; }
+inline int f1892_8(int x) { return x * 8; }
+inline int f1892_9(int x) { return x * 9; }
+inline int f1892_10(int x) { return x * 10; }
+inline int f1892_11(int x) { return x * 11; }
+inline int f1892_12(int x) { return x * 12; }
+inline int f1892_13(int x) { return x * 13; }
+inline int f1892_14(int x) { return x * 14; }
+inline int f1892_15(int x) { return x * 15; }
+inline int f1892_16(int x) { return x * 16; }
+inline int f1892_17(int x) { return x * 17; }
+inline int f1892_18(int x) { return x * 18; }
+inline int f1892_19(int x) { return x * 19; }
+inline int f1892_20(int x) { return x * 20; }
+inline int f1892_21(int x) { return x * 21; }
+inline int f1892_22(int x) { return x * 22; }
+inline int f1892_23(int x) { return x * 23; }
+inline int f1892_24(int x) { return x * 24; }
+inline int f1892_25(int x) { return x * 25; }
+inline int f1892_26(int x) { return x * 26; }
+inline int f1892_27(int x) { return x * 27; }
+inline int f1892_28(int x) { return x * 28; }
+inline int f1892_29(int x) { return x * 29; }
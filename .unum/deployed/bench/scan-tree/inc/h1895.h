@@ -0,0 +1,42 @@
+#pragma once
+/* header 1895 */
+#include <vector>
+#include "h4816.h"
+#include "h542.h"
+#include "h3511.h"
+#include "h875.h"
+#include "h9865.h"
+#ifdef X
+#include "h7487.h"
+#endif
+struct S1895 { int a; const char *s = "x//y"; };
+inline int f1895_0(int x) { return x * 0; }
+inline int f1895_1(int x) { return x * 1; }
+inline int f1895_2(int x) { return x * 2; }
+inline int f1895_3(int x) { return x * 3; }
+inline int f1895_4(int x) { return x * 4; }
+inline int f1895_5(int x) { return x * 5; }
+inline int f1895_6(int x) { return x * 6; }
+inline int f1895_7(int x) { return x * 7; }
+inline int f1895_8(int x) { return x * 8; }
+inline int f1895_9(int x) { return x * 9; }
+inline int f1895_10(int x) { return x * 10; }
+inline int f1895_11(int x) { return x * 11; }
+inline int f1895_12(int x) { return x * 12; }
+inline int f1895_13(int x) { return x * 13; }
+inline int f1895_14(int x) { return x * 14; }
+inline int f1895_15(int x) { return x * 15; }
+inline int f1895_16(int x) { return x * 16; }
+inline int f1895_17(int x) { return x * 17; }
+inline int f1895_18(int x) { return x * 18; }
+inline int f1895_19(int x) { return x * 19; }
+inline int f1895_20(int x) { return x * 20; }
+inline int f1895_21(int x) { return x * 21; }
+inline int f1895_22(int x) { return x * 22; }
+inline int f1895_23(int x) { return x * 23; }
+inline int f1895_24(int x) { return x * 24; }
+inline int f1895_25(int x) { return x * 25; }
+inline int f1895_26(int x) { return x * 26; }
+inline int f1895_27(int x) { return x * 27; }
+inline int f1895_28(int x) { return x * 28; }
+inline int f1895_29(int x) { return x * 29; }
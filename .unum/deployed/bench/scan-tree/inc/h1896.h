@@ -0,0 +1,42 @@
+#pragma once
+/* header 1896 */
+#include <vector>
+#include "h1711.h"
+#include "h324.h"
+#include "h528.h"
+#include "h8390.h"
+#include "h3131.h"
+#ifdef X
+#include "h3217.h"
+#endif
+struct S1896 { int a; const char *s = "x//y"; };
+inline int f1896_0(int x) { return x * 0; }
+inline int f1896_1(int x) { return x * 1; }
+inline int f1896_2(int x) { return x * 2; }
+inline int f1896_3(int x) { return x * 3; }
+inline int f1896_4(int x) { return x * 4; }
+inline int f1896_5(int x) { return x * 5; }
+inline int f1896_6(int x) { return x * 6; }
+inline int f1896_7(int x) { return x * 7; }
+inline int f1896_8(int x) { return x * 8; }
+inline int f1896_9(int x) { return x * 9; }
+inline int f1896_10(int x) { return x * 10; }
+inline int f1896_11(int x) { return x * 11; }
+inline int f1896_12(int x) { return x * 12; }
+inline int f1896_13(int x) { return x * 13; }
+inline int f1896_14(int x) { return x * 14; }
+inline int f1896_15(int x) { return x * 15; }
+inline int f1896_16(int x) { return x * 16; }
+inline int f1896_17(int x) { return x * 17; }
+inline int f1896_18(int x) { return x * 18; }
+inline int f1896_19(int x) { return x * 19; }
+inline int f1896_20(int x) { return x * 20; }
+inline int f1896_21(int x) { return x * 21; }
+inline int f1896_22(int x) { return x * 22; }
+inline int f1896_23(int x) { return x * 23; }
+inline int f1896_24(int x) { return x * 24; }
+inline int f1896_25(int x) { return x * 25; }
+inline int f1896_26(int x) { return x * 26; }
+inline int f1896_27(int x) { return x * 27; }
+inline int f1896_28(int x) { return x * 28; }
+inline int f1896_29(int x) { return x * 29; }
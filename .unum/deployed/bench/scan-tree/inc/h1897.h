@@ -0,0 +1,42 @@
+#pragma once
+/* header 1897 */
+#include <vector>
+#include "h6386.h"
+#include "h2028.h"
+#include "h3143.h"
+#include "h3563.h"
+#include "h3921.h"
+#ifdef X
+#include "h8194.h"
+#endif
+struct S1897 { int a; const char *s = "x//y"; };
+inline int f1897_0(int x) { return x * 0; }
+inline int f1897_1(int x) { return x * 1; }
+inline int f1897_2(int x) { return x * 2; }
+inline int f1897_3(int x) { return x * 3; }
+inline int f1897_4(int x) { return x * 4; }
+inline int f1897_5(int x) { return x * 5; }
+inline int f1897_6(int x) { return x * 6; }
+inline int f1897_7(int x) { return x * 7; }
+inline int f1897_8(int x) { return x * 8; }
+inline int f1897_9(int x) { return x * 9; }
+inline int f1897_10(int x) { return x * 10; }
+inline int f1897_11(int x) { return x * 11; }
+inline int f1897_12(int x) { return x * 12; }
+inline int f1897_13(int x) { return x * 13; }
+inline int f1897_14(int x) { return x * 14; }
+inline int f1897_15(int x) { return x * 15; }
+inline int f1897_16(int x) { return x * 16; }
+inline int f1897_17(int x) { return x * 17; }
+inline int f1897_18(int x) { return x * 18; }
+inline int f1897_19(int x) { return x * 19; }
+inline int f1897_20(int x) { return x * 20; }
+inline int f1897_21(int x) { return x * 21; }
+inline int f1897_22(int x) { return x * 22; }
+inline int f1897_23(int x) { return x * 23; }
+inline int f1897_24(int x) { return x * 24; }
+inline int f1897_25(int x) { return x * 25; }
+inline int f1897_26(int x) { return x * 26; }
+inline int f1897_27(int x) { return x * 27; }
+inline int f1897_28(int x) { return x * 28; }
+inline int f1897_29(int x) { return x * 29; }
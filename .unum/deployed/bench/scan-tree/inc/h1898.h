@@ -0,0 +1,42 @@
+#pragma once
+/* header 1898 */
+#include <vector>
+#include "h1585.h"
+#include "h2282.h"
+#include "h6443.h"
+#include "h2322.h"
+#include "h9495.h"
+#ifdef X
+#include "h4123.h"
+#endif
+struct S1898 { int a; const char *s = "x//y"; };
+inline int f1898_0(int x) { return x * 0; }
+inline int f1898_1(int x) { return x * 1; }
+inline int f1898_2(int x) { return x * 2; }
+inline int f1898_3(int x) { return x * 3; }
+inline int f1898_4(int x) { return x * 4; }
+inline int f1898_5(int x) { return x * 5; }
+inline int f1898_6(int x) { return x * 6; }
+inline int f1898_7(int x) { return x * 7; }
+inline int f1898_8(int x) { return x * 8; }
+inline int f1898_9(int x) { return x * 9; }
+inline int f1898_10(int x) { return x * 10; }
+inline int f1898_11(int x) { return x * 11; }
+inline int f1898_12(int x) { return x * 12; }
+inline int f1898_13(int x) { return x * 13; }
+inline int f1898_14(int x) { return x * 14; }
+inline int f1898_15(int x) { return x * 15; }
+inline int f1898_16(int x) { return x * 16; }
+inline int f1898_17(int x) { return x * 17; }
+inline int f1898_18(int x) { return x * 18; }
+inline int f1898_19(int x) { return x * 19; }
+inline int f1898_20(int x) { return x * 20; }
+inline int f1898_21(int x) { return x * 21; }
+inline int f1898_22(int x) { return x * 22; }
+inline int f1898_23(int x) { return x * 23; }
+inline int f1898_24(int x) { return x * 24; }
+inline int f1898_25(int x) { return x * 25; }
+inline int f1898_26(int x) { return x * 26; }
+inline int f1898_27(int x) { return x * 27; }
+inline int f1898_28(int x) { return x * 28; }
+inline int f1898_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1899 */
+#include <vector>
+#include "h7136.h"
+#include "h6019.h"
+#include "h7093.h"
+#include "h4350.h"
+#include "h5193.h"
+#ifdef X
+#include "h7860.h"
+#endif
+struct S1899 { int a; const char *s = "x//y"; };
+inline int f1899_0(int x) { return x * 0; }
+inline int f1899_1(int x) { return x * 1; }
+inline int f1899_2(int x) { return x * 2; }
+inline int f1899_3(int x) { return x * 3; }
+inline int f1899_4(int x) { return x * 4; }
+inline int f1899_5(int x) { return x * 5; }
+inline int f1899_6(int x) { return x * 6; }
+inline int f1899_7(int x) { return x * 7; }
+inline int f1899_8(int x) { return x * 8; }
+inline int f1899_9(int x) { return x * 9; }
+inline int f1899_10(int x) { return x * 10; }
+inline int f1899_11(int x) { return x * 11; }
+inline int f1899_12(int x) { return x * 12; }
+inline int f1899_13(int x) { return x * 13; }
+inline int f1899_14(int x) { return x * 14; }
+inline int f1899_15(int x) { return x * 15; }
+inline int f1899_16(int x) { return x * 16; }
+inline int f1899_17(int x) { return x * 17; }
+inline int f1899_18(int x) { return x * 18; }
+inline int f1899_19(int x) { return x * 19; }
+inline int f1899_20(int x) { return x * 20; }
+inline int f1899_21(int x) { return x * 21; }
+inline int f1899_22(int x) { return x * 22; }
+inline int f1899_23(int x) { return x * 23; }
+inline int f1899_24(int x) { return x * 24; }
+inline int f1899_25(int x) { return x * 25; }
+inline int f1899_26(int x) { return x * 26; }
+inline int f1899_27(int x) { return x * 27; }
+inline int f1899_28(int x) { return x * 28; }
+inline int f1899_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 19 */
+#include <vector>
+#include "h1404.h"
+#include "h2629.h"
+#include "h3345.h"
+#include "h3802.h"
+#include "h2357.h"
+#ifdef X
+#include "h9410.h"
+#endif
+struct S19 { int a; const char *s = "x//y"; };
+inline int f19_0(int x) { return x * 0; }
+inline int f19_1(int x) { return x * 1; }
+inline int f19_2(int x) { return x * 2; }
+inline int f19_3(int x) { return x * 3; }
+inline int f19_4(int x) { return x * 4; }
+inline int f19_5(int x) { return x * 5; }
+inline int f19_6(int x) { return x * 6; }
+inline int f19_7(int x) { return x * 7; }
+inline int f19_8(int x) { return x * 8; }
+inline int f19_9(int x) { return x * 9; }
+inline int f19_10(int x) { return x * 10; }
+inline int f19_11(int x) { return x * 11; }
+inline int f19_12(int x) { return x * 12; }
+inline int f19_13(int x) { return x * 13; }
+inline int f19_14(int x) { return x * 14; }
+inline int f19_15(int x) { return x * 15; }
+inline int f19_16(int x) { return x * 16; }
+inline int f19_17(int x) { return x * 17; }
+inline int f19_18(int x) { return x * 18; }
+inline int f19_19(int x) { return x * 19; }
+inline int f19_20(int x) { return x * 20; }
+inline int f19_21(int x) { return x * 21; }
+inline int f19_22(int x) { return x * 22; }
+inline int f19_23(int x) { return x * 23; }
+inline int f19_24(int x) { return x * 24; }
+inline int f19_25(int x) { return x * 25; }
+inline int f19_26(int x) { return x * 26; }
+inline int f19_27(int x) { return x * 27; }
+inline int f19_28(int x) { return x * 28; }
+inline int f19_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1901 */
+#include <vector>
+#include "h4580.h"
+#include "h8156.h"
+#include "h7725.h"
+#include "h1130.h"
+#include "h3530.h"
+#ifdef X
+#include "h472.h"
+#endif
+struct S1901 { int a; const char *s = "x//y"; };
+inline int f1901_0(int x) { return x * 0; }
+inline int f1901_1(int x) { return x * 1; }
+inline int f1901_2(int x) { return x * 2; }
+inline int f1901_3(int x) { return x * 3; }
+inline int f1901_4(int x) { return x * 4; }
+inline int f1901_5(int x) { return x * 5; }
+inline int f1901_6(int x) { return x * 6; }
+inline int f1901_7(int x) { return x * 7; }
+inline int f1901_8(int x) { return x * 8; }
+inline int f1901_9(int x) { return x * 9; }
+inline int f1901_10(int x) { return x * 10; }
+inline int f1901_11(int x) { return x * 11; }
+inline int f1901_12(int x) { return x * 12; }
+inline int f1901_13(int x) { return x * 13; }
+inline int f1901_14(int x) { return x * 14; }
+inline int f1901_15(int x) { return x * 15; }
+inline int f1901_16(int x) { return x * 16; }
+inline int f1901_17(int x) { return x * 17; }
+inline int f1901_18(int x) { return x * 18; }
+inline int f1901_19(int x) { return x * 19; }
+inline int f1901_20(int x) { return x * 20; }
+inline int f1901_21(int x) { return x * 21; }
+inline int f1901_22(int x) { return x * 22; }
+inline int f1901_23(int x) { return x * 23; }
+inline int f1901_24(int x) { return x * 24; }
+inline int f1901_25(int x) { return x * 25; }
+inline int f1901_26(int x) { return x * 26; }
+inline int f1901_27(int x) { return x * 27; }
+inline int f1901_28(int x) { return x * 28; }
+inline int f1901_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1902 */
+#include <vector>
+#include "h7861.h"
+#include "h4721.h"
+#include "h7788.h"
+#include "h3839.h"
+#include "h1112.h"
+#ifdef X
+#include "h5145.h"
+#endif
+struct S1902 { int a; const char *s = "x//y"; };
+inline int f1902_0(int x) { return x * 0; }
+inline int f1902_1(int x) { return x * 1; }
+inline int f1902_2(int x) { return x * 2; }
+inline int f1902_3(int x) { return x * 3; }
+inline int f1902_4(int x) { return x * 4; }
+inline int f1902_5(int x) { return x * 5; }
+inline int f1902_6(int x) { return x * 6; }
+inline int f1902_7(int x) { return x * 7; }
+inline int f1902_8(int x) { return x * 8; }
+inline int f1902_9(int x) { return x * 9; }
+inline int f1902_10(int x) { return x * 10; }
+inline int f1902_11(int x) { return x * 11; }
+inline int f1902_12(int x) { return x * 12; }
+inline int f1902_13(int x) { return x * 13; }
+inline int f1902_14(int x) { return x * 14; }
+inline int f1902_15(int x) { return x * 15; }
+inline int f1902_16(int x) { return x * 16; }
+inline int f1902_17(int x) { return x * 17; }
+inline int f1902_18(int x) { return x * 18; }
+inline int f1902_19(int x) { return x * 19; }
+inline int f1902_20(int x) { return x * 20; }
+inline int f1902_21(int x) { return x * 21; }
+inline int f1902_22(int x) { return x * 22; }
+inline int f1902_23(int x) { return x * 23; }
+inline int f1902_24(int x) { return x * 24; }
+inline int f1902_25(int x) { return x * 25; }
+inline int f1902_26(int x) { return x * 26; }
+inline int f1902_27(int x) { return x * 27; }
+inline int f1902_28(int x) { return x * 28; }
+inline int f1902_29(int x) { return x * 29; }
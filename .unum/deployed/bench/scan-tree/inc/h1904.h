@@ -0,0 +1,42 @@
+#pragma once
+/* header 1904 */
+#include <vector>
+#include "h9852.h"
+#include "h280.h"
+#include "h8856.h"
+#include "h830.h"
+#include "h6987.h"
+#ifdef X
+#include "h5195.h"
+#endif
+struct S1904 { int a; const char *s = "x//y"; };
+inline int f1904_0(int x) { return x * 0; }
+inline int f1904_1(int x) { return x * 1; }
+inline int f1904_2(int x) { return x * 2; }
+inline int f1904_3(int x) { return x * 3; }
+inline int f1904_4(int x) { return x * 4; }
+inline int f1904_5(int x) { return x * 5; }
+inline int f1904_6(int x) { return x * 6; }
+inline int f1904_7(int x) { return x * 7; }
+inline int f1904_8(int x) { return x * 8; }
+inline int f1904_9(int x) { return x * 9; }
+inline int f1904_10(int x) { return x * 10; }
+inline int f1904_11(int x) { return x * 11; }
+inline int f1904_12(int x) { return x * 12; }
+inline int f1904_13(int x) { return x * 13; }
+inline int f1904_14(int x) { return x * 14; }
+inline int f1904_15(int x) { return x * 15; }
+inline int f1904_16(int x) { return x * 16; }
+inline int f1904_17(int x) { return x * 17; }
+inline int f1904_18(int x) { return x * 18; }
+inline int f1904_19(int x) { return x * 19; }
+inline int f1904_20(int x) { return x * 20; }
+inline int f1904_21(int x) { return x * 21; }
+inline int f1904_22(int x) { return x * 22; }
+inline int f1904_23(int x) { return x * 23; }
+inline int f1904_24(int x) { return x * 24; }
+inline int f1904_25(int x) { return x * 25; }
+inline int f1904_26(int x) { return x * 26; }
+inline int f1904_27(int x) { return x * 27; }
+inline int f1904_28(int x) { return x * 28; }
+inline int f1904_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1907 */
+#include <vector>
+#include "h8325.h"
+#include "h2129.h"
+#include "h7214.h"
+#include "h6.h"
+#include "h5264.h"
+#ifdef X
+#include "h3978.h"
+#endif
+struct S1907 { int a; const char *s = "x//y"; };
+inline int f1907_0(int x) { return x * 0; }
+inline int f1907_1(int x) { return x * 1; }
+inline int f1907_2(int x) { return x * 2; }
+inline int f1907_3(int x) { return x * 3; }
+inline int f1907_4(int x) { return x * 4; }
+inline int f1907_5(int x) { return x * 5; }
+inline int f1907_6(int x) { return x * 6; }
+inline int f1907_7(int x) { return x * 7; }
+inline int f1907_8(int x) { return x * 8; }
+inline int f1907_9(int x) { return x * 9; }
+inline int f1907_10(int x) { return x * 10; }
+inline int f1907_11(int x) { return x * 11; }
+inline int f1907_12(int x) { return x * 12; }
+inline int f1907_13(int x) { return x * 13; }
+inline int f1907_14(int x) { return x * 14; }
+inline int f1907_15(int x) { return x * 15; }
+inline int f1907_16(int x) { return x * 16; }
+inline int f1907_17(int x) { return x * 17; }
+inline int f1907_18(int x) { return x * 18; }
+inline int f1907_19(int x) { return x * 19; }
+inline int f1907_20(int x) { return x * 20; }
+inline int f1907_21(int x) { return x * 21; }
+inline int f1907_22(int x) { return x * 22; }
+inline int f1907_23(int x) { return x * 23; }
+inline int f1907_24(int x) { return x * 24; }
+inline int f1907_25(int x) { return x * 25; }
+inline int f1907_26(int x) { return x * 26; }
+inline int f1907_27(int x) { return x * 27; }
+inline int f1907_28(int x) { return x * 28; }
+inline int f1907_29(int x) { return x * 29; }
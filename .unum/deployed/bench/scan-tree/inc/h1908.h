@@ -0,0 +1,42 @@
+#pragma once
+/* header 1908 */
+#include <vector>
+#include "h5885.h"
+#include "h638.h"
+#include "h2477.h"
+#include "h4747.h"
+#include "h3558.h"
+#ifdef X
+#include "h3457.h"
+#endif
+struct S1908 { int a; const char *s = "x//y"; };
+inline int f1908_0(int x) { return x * 0; }
+inline int f1908_1(int x) { return x * 1; }
+inline int f1908_2(int x) { return x * 2; }
+inline int f1908_3(int x) { return x * 3; }
+inline int f1908_4(int x) { return x * 4; }
+inline int f1908_5(int x) { return x * 5; }
+inline int f1908_6(int x) { return x * 6; }
+inline int f1908_7(int x) { return x * 7; }
+inline int f1908_8(int x) { return x * 8; }
+inline int f1908_9(int x) { return x * 9; }
+inline int f1908_10(int x) { return x * 10; }
+inline int f1908_11(int x) { return x * 11; }
+inline int f1908_12(int x) { return x * 12; }
+inline int f1908_13(int x) { return x * 13; }
+inline int f1908_14(int x) { return x * 14; }
+inline int f1908_15(int x) { return x * 15; }
+inline int f1908_16(int x) { return x * 16; }
+inline int f1908_17(int x) { return x * 17; }
+inline int f1908_18(int x) { return x * 18; }
+inline int f1908_19(int x) { return x * 19; }
+inline int f1908_20(int x) { return x * 20; }
+inline int f1908_21(int x) { return x * 21; }
+inline int f1908_22(int x) { return x * 22; }
+inline int f1908_23(int x) { return x * 23; }
+inline int f1908_24(int x) { return x * 24; }
+inline int f1908_25(int x) { return x * 25; }
+inline int f1908_26(int x) { return x * 26; }
+inline int f1908_27(int x) { return x * 27; }
+inline int f1908_28(int x) { return x * 28; }
+inline int f1908_29(int x) { return x * 29; }
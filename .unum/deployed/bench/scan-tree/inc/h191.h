@@ -0,0 +1,42 @@
+#pragma once
+/* header 191 */
+#include <vector>
+#include "h4989.h"
+#include "h6216.h"
+#include "h6918.h"
+#include "h2893.h"
+#include "h5166.h"
+#ifdef X
+#include "h3019.h"
+#endif
+struct S191 { int a; const char *s = "x//y"; };
+inline int f191_0(int x) { return x * 0; }
+inline int f191_1(int x) { return x * 1; }
+inline int f191_2(int x) { return x * 2; }
+inline int f191_3(int x) { return x * 3; }
+inline int f191_4(int x) { return x * 4; }
+inline int f191_5(int x) { return x * 5; }
+inline int f191_6(int x) { return x * 6; }
+inline int f191_7(int x) { return x * 7; }
+inline int f191_8(int x) { return x * 8; }
+inline int f191_9(int x) { return x * 9; }
+inline int f191_10(int x) { return x * 10; }
+inline int f191_11(int x) { return x * 11; }
+inline int f191_12(int x) { return x * 12; }
+inline int f191_13(int x) { return x * 13; }
+inline int f191_14(int x) { return x * 14; }
+inline int f191_15(int x) { return x * 15; }
+inline int f191_16(int x) { return x * 16; }
+inline int f191_17(int x) { return x * 17; }
+inline int f191_18(int x) { return x * 18; }
+inline int f191_19(int x) { return x * 19; }
+inline int f191_20(int x) { return x * 20; }
+inline int f191_21(int x) { return x * 21; }
+inline int f191_22(int x) { return x * 22; }
+inline int f191_23(int x) { return x * 23; }
+inline int f191_24(int x) { return x * 24; }
+inline int f191_25(int x) { return x * 25; }
+inline int f191_26(int x) { return x * 26; }
+inline int f191_27(int x) { return x * 27; }
+inline int f191_28(int x) { return x * 28; }
+inline int f191_29(int x) { return x * 29; }
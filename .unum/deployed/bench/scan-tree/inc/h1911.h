@@ -0,0 +1,42 @@
+#pragma once
+/* header 1911 */
+#include <vector>
+#include "h7630.h"
+#include "h2360.h"
+#include "h2810.h"
+#include "h900.h"
+#include "h6725.h"
+#ifdef X
+#include "h8617.h"
+#endif
+struct S1911 { int a; const char *s = "x//y"; };
+inline int f1911_0(int x) { return x * 0; }
+inline int f1911_1(int x) { return x * 1; }
+inline int f1911_2(int x) { return x * 2; }
+inline int f1911_3(int x) { return x * 3; }
+inline int f1911_4(int x) { return x * 4; }
+inline int f1911_5(int x) { return x * 5; }
+inline int f1911_6(int x) { return x * 6; }
+inline int f1911_7(int x) { return x * 7; }
+inline int f1911_8(int x) { return x * 8; }
+inline int f1911_9(int x) { return x * 9; }
+inline int f1911_10(int x) { return x * 10; }
+inline int f1911_11(int x) { return x * 11; }
+inline int f1911_12(int x) { return x * 12; }
+inline int f1911_13(int x) { return x * 13; }
+inline int f1911_14(int x) { return x * 14; }
+inline int f1911_15(int x) { return x * 15; }
+inline int f1911_16(int x) { return x * 16; }
+inline int f1911_17(int x) { return x * 17; }
+inline int f1911_18(int x) { return x * 18; }
+inline int f1911_19(int x) { return x * 19; }
+inline int f1911_20(int x) { return x * 20; }
+inline int f1911_21(int x) { return x * 21; }
+inline int f1911_22(int x) { return x * 22; }
+inline int f1911_23(int x) { return x * 23; }
+inline int f1911_24(int x) { return x * 24; }
+inline int f1911_25(int x) { return x * 25; }
+inline int f1911_26(int x) { return x * 26; }
+inline int f1911_27(int x) { return x * 27; }
+inline int f1911_28(int x) { return x * 28; }
+inline int f1911_29(int x) { return x * 29; }
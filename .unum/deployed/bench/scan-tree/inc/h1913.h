@@ -0,0 +1,42 @@
+#pragma once
+/* header 1913 */
+#include <vector>
+#include "h7999.h"
+#include "h5268.h"
+#include "h4999.h"
+#include "h6116.h"
+#include "h7361.h"
+#ifdef X
+#include "h6024.h"
+#endif
+struct S1913 { int a; const char *s = "x//y"; };
+inline int f1913_0(int x) { return x * 0; }
+inline int f1913_1(int x) { return x * 1; }
+inline int f1913_2(int x) { return x * 2; }
+inline int f1913_3(int x) { return x * 3; }
+inline int f1913_4(int x) { return x * 4; }
+inline int f1913_5(int x) { return x * 5; }
+inline int f1913_6(int x) { return x * 6; }
+inline int f1913_7(int x) { return x * 7; }
+inline int f1913_8(int x) { return x * 8; }
+inline int f1913_9(int x) { return x * 9; }
+inline int f1913_10(int x) { return x * 10; }
+inline int f1913_11(int x) { return x * 11; }
+inline int f1913_12(int x) { return x * 12; }
+inline int f1913_13(int x) { return x * 13; }
+inline int f1913_14(int x) { return x * 14; }
+inline int f1913_15(int x) { return x * 15; }
+inline int f1913_16(int x) { return x * 16; }
+inline int f1913_17(int x) { return x * 17; }
+inline int f1913_18(int x) { return x * 18; }
+inline int f1913_19(int x) { return x * 19; }
+inline int f1913_20(int x) { return x * 20; }
+inline int f1913_21(int x) { return x * 21; }
+inline int f1913_22(int x) { return x * 22; }
+inline int f1913_23(int x) { return x * 23; }
+inline int f1913_24(int x) { return x * 24; }
+inline int f1913_25(int x) { return x * 25; }
+inline int f1913_26(int x) { return x * 26; }
+inline int f1913_27(int x) { return x * 27; }
+inline int f1913_28(int x) { return x * 28; }
+inline int f1913_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1915 */
+#include <vector>
+#include "h9990.h"
+#include "h8251.h"
+#include "h4459.h"
+#include "h6326.h"
+#include "h7655.h"
+#ifdef X
+#include "h9247.h"
+#endif
+struct S1915 { int a; const char *s = "x//y"; };
+inline int f1915_0(int x) { return x * 0; }
+inline int f1915_1(int x) { return x * 1; }
+inline int f1915_2(int x) { return x * 2; }
+inline int f1915_3(int x) { return x * 3; }
+inline int f1915_4(int x) { return x * 4; }
+inline int f1915_5(int x) { return x * 5; }
+inline int f1915_6(int x) { return x * 6; }
+inline int f1915_7(int x) { return x * 7; }
+inline int f1915_8(int x) { return x * 8; }
+inline int f1915_9(int x) { return x * 9; }
+inline int f1915_10(int x) { return x * 10; }
+inline int f1915_11(int x) { return x * 11; }
+inline int f1915_12(int x) { return x * 12; }
+inline int f1915_13(int x) { return x * 13; }
+inline int f1915_14(int x) { return x * 14; }
+inline int f1915_15(int x) { return x * 15; }
+inline int f1915_16(int x) { return x * 16; }
+inline int f1915_17(int x) { return x * 17; }
+inline int f1915_18(int x) { return x * 18; }
+inline int f1915_19(int x) { return x * 19; }
+inline int f1915_20(int x) { return x * 20; }
+inline int f1915_21(int x) { return x * 21; }
+inline int f1915_22(int x) { return x * 22; }
+inline int f1915_23(int x) { return x * 23; }
+inline int f1915_24(int x) { return x * 24; }
+inline int f1915_25(int x) { return x * 25; }
+inline int f1915_26(int x) { return x * 26; }
+inline int f1915_27(int x) { return x * 27; }
+inline int f1915_28(int x) { return x * 28; }
+inline int f1915_29(int x) { return x * 29; }
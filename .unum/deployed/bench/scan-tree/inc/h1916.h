@@ -0,0 +1,42 @@
+#pragma once
+/* header 1916 */
+#include <vector>
+#include "h8777.h"
+#include "h7834.h"
+#include "h7281.h"
+#include "h9593.h"
+#include "h3960.h"
+#ifdef X
+#include "h3120.h"
+#endif
+struct S1916 { int a; const char *s = "x//y"; };
+inline int f1916_0(int x) { return x * 0; }
+inline int f1916_1(int x) { return x * 1; }
+inline int f1916_2(int x) { return x * 2; }
+inline int f1916_3(int x) { return x * 3; }
+inline int f1916_4(int x) { return x * 4; }
+inline int f1916_5(int x) { return x * 5; }
+inline int f1916_6(int x) { return x * 6; }
+inline int f1916_7(int x) { return x * 7; }
+inline int f1916_8(int x) { return x * 8; }
+inline int f1916_9(int x) { return x * 9; }
+inline int f1916_10(int x) { return x * 10; }
+inline int f1916_11(int x) { return x * 11; }
+inline int f1916_12(int x) { return x * 12; }
+inline int f1916_13(int x) { return x * 13; }
+inline int f1916_14(int x) { return x * 14; }
+inline int f1916_15(int x) { return x * 15; }
+inline int f1916_16(int x) { return x * 16; }
+inline int f1916_17(int x) { return x * 17; }
+inline int f1916_18(int x) { return x * 18; }
+inline int f1916_19(int x) { return x * 19; }
+inline int f1916_20(int x) { return x * 20; }
+inline int f1916_21(int x) { return x * 21; }
+inline int f1916_22(int x) { return x * 22; }
+inline int f1916_23(int x) { return x * 23; }
+inline int f1916_24(int x) { return x * 24; }
+inline int f1916_25(int x) { return x * 25; }
+inline int f1916_26(int x) { return x * 26; }
+inline int f1916_27(int x) { return x * 27; }
+inline int f1916_28(int x) { return x * 28; }
+inline int f1916_29(int x) { return x * 29; }
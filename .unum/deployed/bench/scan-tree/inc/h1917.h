@@ -0,0 +1,42 @@
+#pragma once
+/* header 1917 */
+#include <vector>
+#include "h550.h"
+#include "h6807.h"
+#include "h7551.h"
+#include "h8140.h"
+#include "h4661.h"
+#ifdef X
+#include "h5122.h"
+#endif
+struct S1917 { int a; const char *s = "x//y"; };
+inline int f1917_0(int x) { return x * 0; }
+inline int f1917_1(int x) { return x * 1; }
+inline int f1917_2(int x) { return x * 2; }
+inline int f1917_3(int x) { return x * 3; }
+inline int f1917_4(int x) { return x * 4; }
+inline int f1917_5(int x) { return x * 5; }
+inline int f1917_6(int x) { return x * 6; }
+inline int f1917_7(int x) { return x * 7; }
+inline int f1917_8(int x) { return x * 8; }
+inline int f1917_9(int x) { return x * 9; }
+inline int f1917_10(int x) { return x * 10; }
+inline int f1917_11(int x) { return x * 11; }
+inline int f1917_12(int x) { return x * 12; }
+inline int f1917_13(int x) { return x * 13; }
+inline int f1917_14(int x) { return x * 14; }
+inline int f1917_15(int x) { return x * 15; }
+inline int f1917_16(int x) { return x * 16; }
+inline int f1917_17(int x) { return x * 17; }
+inline int f1917_18(int x) { return x * 18; }
+inline int f1917_19(int x) { return x * 19; }
+inline int f1917_20(int x) { return x * 20; }
+inline int f1917_21(int x) { return x * 21; }
+inline int f1917_22(int x) { return x * 22; }
+inline int f1917_23(int x) { return x * 23; }
+inline int f1917_24(int x) { return x * 24; }
+inline int f1917_25(int x) { return x * 25; }
+inline int f1917_26(int x) { return x * 26; }
+inline int f1917_27(int x) { return x * 27; }
+inline int f1917_28(int x) { return x * 28; }
+inline int f1917_29(int x) { return x * 29; }
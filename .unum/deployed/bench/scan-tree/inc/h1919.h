@@ -0,0 +1,42 @@
+#pragma once
+/* header 1919 */
+#include <vector>
+#include "h6696.h"
+#include "h6346.h"
+#include "h7565.h"
+#include "h4975.h"
+#include "h4106.h"
+#ifdef X
+#include "h1073.h"
+#endif
+struct S1919 { int a; const char *s = "x//y"; };
+inline int f1919_0(int x) { return x * 0; }
+inline int f1919_1(int x) { return x * 1; }
+inline int f1919_2(int x) { return x * 2; }
+inline int f1919_3(int x) { return x * 3; }
+inline int f1919_4(int x) { return x * 4; }
+inline int f1919_5(int x) { return x * 5; }
+inline int f1919_6(int x) { return x * 6; }
+inline int f1919_7(int x) { return x * 7; }
+inline int f1919_8(int x) { return x * 8; }
+inline int f1919_9(int x) { return x * 9; }
+inline int f1919_10(int x) { return x * 10; }
+inline int f1919_11(int x) { return x * 11; }
+inline int f1919_12(int x) { return x * 12; }
+inline int f1919_13(int x) { return x * 13; }
+inline int f1919_14(int x) { return x * 14; }
+inline int f1919_15(int x) { return x * 15; }
+inline int f1919_16(int x) { return x * 16; }
+inline int f1919_17(int x) { return x * 17; }
+inline int f1919_18(int x) { return x * 18; }
+inline int f1919_19(int x) { return x * 19; }
+inline int f1919_20(int x) { return x * 20; }
+inline int f1919_21(int x) { return x * 21; }
+inline int f1919_22(int x) { return x * 22; }
+inline int f1919_23(int x) { return x * 23; }
+inline int f1919_24(int x) { return x * 24; }
+inline int f1919_25(int x) { return x * 25; }
+inline int f1919_26(int x) { return x * 26; }
+inline int f1919_27(int x) { return x * 27; }
+inline int f1919_28(int x) { return x * 28; }
+inline int f1919_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 192 */
+#include <vector>
+#include "h6247.h"
+#include "h1681.h"
+#include "h1428.h"
+#include "h269.h"
+#include "h8061.h"
+#ifdef X
+#include "h3490.h"
+#endif
+struct S192 { int a; const char *s = "x//y"; };
+inline int f192_0(int x) { return x * 0; }
+inline int f192_1(int x) { return x * 1; }
+inline int f192_2(int x) { return x * 2; }
+inline int f192_3(int x) { return x * 3; }
+inline int f192_4(int x) { return x * 4; }
+inline int f192_5(int x) { return x * 5; }
+inline int f192_6(int x) { return x * 6; }
+inline int f192_7(int x) { return x * 7; }
+inline int f192_8(int x) { return x * 8; }
+inline int f192_9(int x) { return x * 9; }
+inline int f192_10(int x) { return x * 10; }
+inline int f192_11(int x) { return x * 11; }
+inline int f192_12(int x) { return x * 12; }
+inline int f192_13(int x) { return x * 13; }
+inline int f192_14(int x) { return x * 14; }
+inline int f192_15(int x) { return x * 15; }
+inline int f192_16(int x) { return x * 16; }
+inline int f192_17(int x) { return x * 17; }
+inline int f192_18(int x) { return x * 18; }
+inline int f192_19(int x) { return x * 19; }
+inline int f192_20(int x) { return x * 20; }
+inline int f192_21(int x) { return x * 21; }
+inline int f192_22(int x) { return x * 22; }
+inline int f192_23(int x) { return x * 23; }
+inline int f192_24(int x) { return x * 24; }
+inline int f192_25(int x) { return x * 25; }
+inline int f192_26(int x) { return x * 26; }
+inline int f192_27(int x) { return x * 27; }
+inline int f192_28(int x) { return x * 28; }
+inline int f192_29(int x) { return x * 29; }
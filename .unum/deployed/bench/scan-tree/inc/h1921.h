@@ -0,0 +1,42 @@
+#pragma once
+/* header 1921 */
+#include <vector>
+#include "h258.h"
+#include "h8994.h"
+#include "h7168.h"
+#include "h4976.h"
+#include "h7046.h"
+#ifdef X
+#include "h1695.h"
+#endif
+struct S1921 { int a; const char *s = "x//y"; };
+inline int f1921_0(int x) { return x * 0; }
+inline int f1921_1(int x) { return x * 1; }
+inline int f1921_2(int x) { return x * 2; }
+inline int f1921_3(int x) { return x * 3; }
+inline int f1921_4(int x) { return x * 4; }
+inline int f1921_5(int x) { return x * 5; }
+inline int f1921_6(int x) { return x * 6; }
+inline int f1921_7(int x) { return x * 7; }
+inline int f1921_8(int x) { return x * 8; }
+inline int f1921_9(int x) { return x * 9; }
+inline int f1921_10(int x) { return x * 10; }
+inline int f1921_11(int x) { return x * 11; }
+inline int f1921_12(int x) { return x * 12; }
+inline int f1921_13(int x) { return x * 13; }
+inline int f1921_14(int x) { return x * 14; }
+inline int f1921_15(int x) { return x * 15; }
+inline int f1921_16(int x) { return x * 16; }
+inline int f1921_17(int x) { return x * 17; }
+inline int f1921_18(int x) { return x * 18; }
+inline int f1921_19(int x) { return x * 19; }
+inline int f1921_20(int x) { return x * 20; }
+inline int f1921_21(int x) { return x * 21; }
+inline int f1921_22(int x) { return x * 22; }
+inline int f1921_23(int x) { return x * 23; }
+inline int f1921_24(int x) { return x * 24; }
+inline int f1921_25(int x) { return x * 25; }
+inline int f1921_26(int x) { return x * 26; }
+inline int f1921_27(int x) { return x * 27; }
+inline int f1921_28(int x) { return x * 28; }
+inline int f1921_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1924 */
+#include <vector>
+#include "h1774.h"
+#include "h8335.h"
+#include "h3488.h"
+#include "h5135.h"
+#include "h3753.h"
+#ifdef X
+#include "h5652.h"
+#endif
+struct S1924 { int a; const char *s = "x//y"; };
+inline int f1924_0(int x) { return x * 0; }
+inline int f1924_1(int x) { return x * 1; }
+inline int f1924_2(int x) { return x * 2; }
+inline int f1924_3(int x) { return x * 3; }
+inline int f1924_4(int x) { return x * 4; }
+inline int f1924_5(int x) { return x * 5; }
+inline int f1924_6(int x) { return x * 6; }
+inline int f1924_7(int x) { return x * 7; }
+inline int f1924_8(int x) { return x * 8; }
+inline int f1924_9(int x) { return x * 9; }
+inline int f1924_10(int x) { return x * 10; }
+inline int f1924_11(int x) { return x * 11; }
+inline int f1924_12(int x) { return x * 12; }
+inline int f1924_13(int x) { return x * 13; }
+inline int f1924_14(int x) { return x * 14; }
+inline int f1924_15(int x) { return x * 15; }
+inline int f1924_16(int x) { return x * 16; }
+inline int f1924_17(int x) { return x * 17; }
+inline int f1924_18(int x) { return x * 18; }
+inline int f1924_19(int x) { return x * 19; }
+inline int f1924_20(int x) { return x * 20; }
+inline int f1924_21(int x) { return x * 21; }
+inline int f1924_22(int x) { return x * 22; }
+inline int f1924_23(int x) { return x * 23; }
+inline int f1924_24(int x) { return x * 24; }
+inline int f1924_25(int x) { return x * 25; }
+inline int f1924_26(int x) { return x * 26; }
+inline int f1924_27(int x) { return x * 27; }
+inline int f1924_28(int x) { return x * 28; }
+inline int f1924_29(int x) { return x * 29; }
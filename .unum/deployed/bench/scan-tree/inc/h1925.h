@@ -0,0 +1,42 @@
+#pragma once
+/* header 1925 */
+#include <vector>
+#include "h9423.h"
+#include "h1823.h"
+#include "h2254.h"
+#include "h3934.h"
+#include "h5083.h"
+#ifdef X
+#include "h6363.h"
+#endif
+struct S1925 { int a; const char *s = "x//y"; };
+inline int f1925_0(int x) { return x * 0; }
+inline int f1925_1(int x) { return x * 1; }
+inline int f1925_2(int x) { return x * 2; }
+inline int f1925_3(int x) { return x * 3; }
+inline int f1925_4(int x) { return x * 4; }
+inline int f1925_5(int x) { return x * 5; }
+inline int f1925_6(int x) { return x * 6; }
+inline int f1925_7(int x) { return x * 7; }
+inline int f1925_8(int x) { return x * 8; }
+inline int f1925_9(int x) { return x * 9; }
+inline int f1925_10(int x) { return x * 10; }
+inline int f1925_11(int x) { return x * 11; }
+inline int f1925_12(int x) { return x * 12; }
+inline int f1925_13(int x) { return x * 13; }
+inline int f1925_14(int x) { return x * 14; }
+inline int f1925_15(int x) { return x * 15; }
+inline int f1925_16(int x) { return x * 16; }
+inline int f1925_17(int x) { return x * 17; }
+inline int f1925_18(int x) { return x * 18; }
+inline int f1925_19(int x) { return x * 19; }
+inline int f1925_20(int x) { return x * 20; }
+inline int f1925_21(int x) { return x * 21; }
+inline int f1925_22(int x) { return x * 22; }
+inline int f1925_23(int x) { return x * 23; }
+inline int f1925_24(int x) { return x * 24; }
+inline int f1925_25(int x) { return x * 25; }
+inline int f1925_26(int x) { return x * 26; }
+inline int f1925_27(int x) { return x * 27; }
+inline int f1925_28(int x) { return x * 28; }
+inline int f1925_29(int x) { return x * 29; }
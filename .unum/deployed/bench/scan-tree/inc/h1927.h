@@ -0,0 +1,42 @@
+#pragma once
+/* header 1927 */
+#include <vector>
+#include "h4050.h"
+#include "h1747.h"
+#include "h424.h"
+#include "h6200.h"
+#include "h5478.h"
+#ifdef X
+#include "h3439.h"
+#endif
+struct S1927 { int a; const char *s = "x//y"; };
+inline int f1927_0(int x) { return x * 0; }
+inline int f1927_1(int x) { return x * 1; }
+inline int f1927_2(int x) { return x * 2; }
+inline int f1927_3(int x) { return x * 3; }
+inline int f1927_4(int x) { return x * 4; }
+inline int f1927_5(int x) { return x * 5; }
+inline int f1927_6(int x) { return x * 6; }
+inline int f1927_7(int x) { return x * 7; }
+inline int f1927_8(int x) { return x * 8; }
+inline int f1927_9(int x) { return x * 9; }
+inline int f1927_10(int x) { return x * 10; }
+inline int f1927_11(int x) { return x * 11; }
+inline int f1927_12(int x) { return x * 12; }
+inline int f1927_13(int x) { return x * 13; }
+inline int f1927_14(int x) { return x * 14; }
+inline int f1927_15(int x) { return x * 15; }
+inline int f1927_16(int x) { return x * 16; }
+inline int f1927_17(int x) { return x * 17; }
+inline int f1927_18(int x) { return x * 18; }
+inline int f1927_19(int x) { return x * 19; }
+inline int f1927_20(int x) { return x * 20; }
+inline int f1927_21(int x) { return x * 21; }
+inline int f1927_22(int x) { return x * 22; }
+inline int f1927_23(int x) { return x * 23; }
+inline int f1927_24(int x) { return x * 24; }
+inline int f1927_25(int x) { return x * 25; }
+inline int f1927_26(int x) { return x * 26; }
+inline int f1927_27(int x) { return x * 27; }
+inline int f1927_28(int x) { return x * 28; }
+inline int f1927_29(int x) { return x * 29; }
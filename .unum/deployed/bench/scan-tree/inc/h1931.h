@@ -0,0 +1,42 @@
+#pragma once
+/* header 1931 */
+#include <vector>
+#include "h6031.h"
+#include "h6051.h"
+#include "h9270.h"
+#include "h7767.h"
+#include "h1888.h"
+#ifdef X
+#include "h7931.h"
+#endif
+struct S1931 { int a; const char *s = "x//y"; };
+inline int f1931_0(int x) { return x * 0; }
+inline int f1931_1(int x) { return x * 1; }
+inline int f1931_2(int x) { return x * 2; }
+inline int f1931_3(int x) { return x * 3; }
+inline int f1931_4(int x) { return x * 4; }
+inline int f1931_5(int x) { return x * 5; }
+inline int f1931_6(int x) { return x * 6; }
+inline int f1931_7(int x) { return x * 7; }
+inline int f1931_8(int x) { return x * 8; }
+inline int f1931_9(int x) { return x * 9; }
+inline int f1931_10(int x) { return x * 10; }
+inline int f1931_11(int x) { return x * 11; }
+inline int f1931_12(int x) { return x * 12; }
+inline int f1931_13(int x) { return x * 13; }
+inline int f1931_14(int x) { return x * 14; }
+inline int f1931_15(int x) { return x * 15; }
+inline int f1931_16(int x) { return x * 16; }
+inline int f1931_17(int x) { return x * 17; }
+inline int f1931_18(int x) { return x * 18; }
+inline int f1931_19(int x) { return x * 19; }
+inline int f1931_20(int x) { return x * 20; }
+inline int f1931_21(int x) { return x * 21; }
+inline int f1931_22(int x) { return x * 22; }
+inline int f1931_23(int x) { return x * 23; }
+inline int f1931_24(int x) { return x * 24; }
+inline int f1931_25(int x) { return x * 25; }
+inline int f1931_26(int x) { return x * 26; }
+inline int f1931_27(int x) { return x * 27; }
+inline int f1931_28(int x) { return x * 28; }
+inline int f1931_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1932 */
+#include <vector>
+#include "h3984.h"
+#include "h1455.h"
+#include "h2955.h"
+#include "h5514.h"
+#include "h2164.h"
+#ifdef X
+#include "h4695.h"
+#endif
+struct S1932 { int a; const char *s = "x//y"; };
+inline int f1932_0(int x) { return x * 0; }
+inline int f1932_1(int x) { return x * 1; }
+inline int f1932_2(int x) { return x * 2; }
+inline int f1932_3(int x) { return x * 3; }
+inline int f1932_4(int x) { return x * 4; }
+inline int f1932_5(int x) { return x * 5; }
+inline int f1932_6(int x) { return x * 6; }
+inline int f1932_7(int x) { return x * 7; }
+inline int f1932_8(int x) { return x * 8; }
+inline int f1932_9(int x) { return x * 9; }
+inline int f1932_10(int x) { return x * 10; }
+inline int f1932_11(int x) { return x * 11; }
+inline int f1932_12(int x) { return x * 12; }
+inline int f1932_13(int x) { return x * 13; }
+inline int f1932_14(int x) { return x * 14; }
+inline int f1932_15(int x) { return x * 15; }
+inline int f1932_16(int x) { return x * 16; }
+inline int f1932_17(int x) { return x * 17; }
+inline int f1932_18(int x) { return x * 18; }
+inline int f1932_19(int x) { return x * 19; }
+inline int f1932_20(int x) { return x * 20; }
+inline int f1932_21(int x) { return x * 21; }
+inline int f1932_22(int x) { return x * 22; }
+inline int f1932_23(int x) { return x * 23; }
+inline int f1932_24(int x) { return x * 24; }
+inline int f1932_25(int x) { return x * 25; }
+inline int f1932_26(int x) { return x * 26; }
+inline int f1932_27(int x) { return x * 27; }
+inline int f1932_28(int x) { return x * 28; }
+inline int f1932_29(int x) { return x * 29; }
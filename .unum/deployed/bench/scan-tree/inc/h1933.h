@@ -0,0 +1,42 @@
+#pragma once
+/* header 1933 */
+#include <vector>
+#include "h1659.h"
+#include "h497.h"
+#include "h6528.h"
+#include "h8356.h"
+#include "h7400.h"
+#ifdef X
+#include "h2166.h"
+#endif
+struct S1933 { int a; const char *s = "x//y"; };
+inline int f1933_0(int x) { return x * 0; }
+inline int f1933_1(int x) { return x * 1; }
+inline int f1933_2(int x) { return x * 2; }
+inline int f1933_3(int x) { return x * 3; }
+inline int f1933_4(int x) { return x * 4; }
+inline int f1933_5(int x) { return x * 5; }
+inline int f1933_6(int x) { return x * 6; }
+inline int f1933_7(int x) { return x * 7; }
+inline int f1933_8(int x) { return x * 8; }
+inline int f1933_9(int x) { return x * 9; }
+inline int f1933_10(int x) { return x * 10; }
+inline int f1933_11(int x) { return x * 11; }
+inline int f1933_12(int x) { return x * 12; }
+inline int f1933_13(int x) { return x * 13; }
+inline int f1933_14(int x) { return x * 14; }
+inline int f1933_15(int x) { return x * 15; }
+inline int f1933_16(int x) { return x * 16; }
+inline int f1933_17(int x) { return x * 17; }
+inline int f1933_18(int x) { return x * 18; }
+inline int f1933_19(int x) { return x * 19; }
+inline int f1933_20(int x) { return x * 20; }
+inline int f1933_21(int x) { return x * 21; }
+inline int f1933_22(int x) { return x * 22; }
+inline int f1933_23(int x) { return x * 23; }
+inline int f1933_24(int x) { return x * 24; }
+inline int f1933_25(int x) { return x * 25; }
+inline int f1933_26(int x) { return x * 26; }
+inline int f1933_27(int x) { return x * 27; }
+inline int f1933_28(int x) { return x * 28; }
+inline int f1933_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1934 */
+#include <vector>
+#include "h6125.h"
+#include "h9029.h"
+#include "h724.h"
+#include "h4615.h"
+#include "h8279.h"
+#ifdef X
+#include "h2518.h"
+#endif
+struct S1934 { int a; const char *s = "x//y"; };
+inline int f1934_0(int x) { return x * 0; }
+inline int f1934_1(int x) { return x * 1; }
+inline int f1934_2(int x) { return x * 2; }
+inline int f1934_3(int x) { return x * 3; }
+inline int f1934_4(int x) { return x * 4; }
+inline int f1934_5(int x) { return x * 5; }
+inline int f1934_6(int x) { return x * 6; }
+inline int f1934_7(int x) { return x * 7; }
+inline int f1934_8(int x) { return x * 8; }
+inline int f1934_9(int x) { return x * 9; }
+inline int f1934_10(int x) { return x * 10; }
+inline int f1934_11(int x) { return x * 11; }
+inline int f1934_12(int x) { return x * 12; }
+inline int f1934_13(int x) { return x * 13; }
+inline int f1934_14(int x) { return x * 14; }
+inline int f1934_15(int x) { return x * 15; }
+inline int f1934_16(int x) { return x * 16; }
+inline int f1934_17(int x) { return x * 17; }
+inline int f1934_18(int x) { return x * 18; }
+inline int f1934_19(int x) { return x * 19; }
+inline int f1934_20(int x) { return x * 20; }
+inline int f1934_21(int x) { return x * 21; }
+inline int f1934_22(int x) { return x * 22; }
+inline int f1934_23(int x) { return x * 23; }
+inline int f1934_24(int x) { return x * 24; }
+inline int f1934_25(int x) { return x * 25; }
+inline int f1934_26(int x) { return x * 26; }
+inline int f1934_27(int x) { return x * 27; }
+inline int f1934_28(int x) { return x * 28; }
+inline int f1934_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1936 */
+#include <vector>
+#include "h7159.h"
+#include "h1319.h"
+#include "h8862.h"
+#include "h9684.h"
+#include "h6329.h"
+#ifdef X
+#include "h8778.h"
+#endif
+struct S1936 { int a; const char *s = "x//y"; };
+inline int f1936_0(int x) { return x * 0; }
+inline int f1936_1(int x) { return x * 1; }
+inline int f1936_2(int x) { return x * 2; }
+inline int f1936_3(int x) { return x * 3; }
+inline int f1936_4(int x) { return x * 4; }
+inline int f1936_5(int x) { return x * 5; }
+inline int f1936_6(int x) { return x * 6; }
+inline int f1936_7(int x) { return x * 7; }
+inline int f1936_8(int x) { return x * 8; }
+inline int f1936_9(int x) { return x * 9; }
+inline int f1936_10(int x) { return x * 10; }
+inline int f1936_11(int x) { return x * 11; }
+inline int f1936_12(int x) { return x * 12; }
+inline int f1936_13(int x) { return x * 13; }
+inline int f1936_14(int x) { return x * 14; }
+inline int f1936_15(int x) { return x * 15; }
+inline int f1936_16(int x) { return x * 16; }
+inline int f1936_17(int x) { return x * 17; }
+inline int f1936_18(int x) { return x * 18; }
+inline int f1936_19(int x) { return x * 19; }
+inline int f1936_20(int x) { return x * 20; }
+inline int f1936_21(int x) { return x * 21; }
+inline int f1936_22(int x) { return x * 22; }
+inline int f1936_23(int x) { return x * 23; }
+inline int f1936_24(int x) { return x * 24; }
+inline int f1936_25(int x) { return x * 25; }
+inline int f1936_26(int x) { return x * 26; }
+inline int f1936_27(int x) { return x * 27; }
+inline int f1936_28(int x) { return x * 28; }
+inline int f1936_29(int x) { return x * 29; }
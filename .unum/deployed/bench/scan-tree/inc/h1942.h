@@ -0,0 +1,42 @@
+#pragma once
+/* header 1942 */
+#include <vector>
+#include "h9524.h"
+#include "h6433.h"
+#include "h4009.h"
+#include "h479.h"
+#include "h9565.h"
+#ifdef X
+#include "h710.h"
+#endif
+struct S1942 { int a; const char *s = "x//y"; };
+inline int f1942_0(int x) { return x * 0; }
+inline int f1942_1(int x) { return x * 1; }
+inline int f1942_2(int x) { return x * 2; }
+inline int f1942_3(int x) { return x * 3; }
+inline int f1942_4(int x) { return x * 4; }
+inline int f1942_5(int x) { return x * 5; }
+inline int f1942_6(int x) { return x * 6; }
+inline int f1942_7(int x) { return x * 7; }
+inline int f1942_8(int x) { return x * 8; }
+inline int f1942_9(int x) { return x * 9; }
+inline int f1942_10(int x) { return x * 10; }
+inline int f1942_11(int x) { return x * 11; }
+inline int f1942_12(int x) { return x * 12; }
+inline int f1942_13(int x) { return x * 13; }
+inline int f1942_14(int x) { return x * 14; }
+inline int f1942_15(int x) { return x * 15; }
+inline int f1942_16(int x) { return x * 16; }
+inline int f1942_17(int x) { return x * 17; }
+inline int f1942_18(int x) { return x * 18; }
+inline int f1942_19(int x) { return x * 19; }
+inline int f1942_20(int x) { return x * 20; }
+inline int f1942_21(int x) { return x * 21; }
+inline int f1942_22(int x) { return x * 22; }
+inline int f1942_23(int x) { return x * 23; }
+inline int f1942_24(int x) { return x * 24; }
+inline int f1942_25(int x) { return x * 25; }
+inline int f1942_26(int x) { return x * 26; }
+inline int f1942_27(int x) { return x * 27; }
+inline int f1942_28(int x) { return x * 28; }
+inline int f1942_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1944 */
+#include <vector>
+#include "h3885.h"
+#include "h6173.h"
+#include "h8523.h"
+#include "h9391.h"
+#include "h8047.h"
+#ifdef X
+#include "h1587.h"
+#endif
+struct S1944 { int a; const char *s = "x//y"; };
+inline int f1944_0(int x) { return x * 0; }
+inline int f1944_1(int x) { return x * 1; }
+inline int f1944_2(int x) { return x * 2; }
+inline int f1944_3(int x) { return x * 3; }
+inline int f1944_4(int x) { return x * 4; }
+inline int f1944_5(int x) { return x * 5; }
+inline int f1944_6(int x) { return x * 6; }
+inline int f1944_7(int x) { return x * 7; }
+inline int f1944_8(int x) { return x * 8; }
+inline int f1944_9(int x) { return x * 9; }
+inline int f1944_10(int x) { return x * 10; }
+inline int f1944_11(int x) { return x * 11; }
+inline int f1944_12(int x) { return x * 12; }
+inline int f1944_13(int x) { return x * 13; }
+inline int f1944_14(int x) { return x * 14; }
+inline int f1944_15(int x) { return x * 15; }
+inline int f1944_16(int x) { return x * 16; }
+inline int f1944_17(int x) { return x * 17; }
+inline int f1944_18(int x) { return x * 18; }
+inline int f1944_19(int x) { return x * 19; }
+inline int f1944_20(int x) { return x * 20; }
+inline int f1944_21(int x) { return x * 21; }
+inline int f1944_22(int x) { return x * 22; }
+inline int f1944_23(int x) { return x * 23; }
+inline int f1944_24(int x) { return x * 24; }
+inline int f1944_25(int x) { return x * 25; }
+inline int f1944_26(int x) { return x * 26; }
+inline int f1944_27(int x) { return x * 27; }
+inline int f1944_28(int x) { return x * 28; }
+inline int f1944_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1945 */
+#include <vector>
+#include "h4936.h"
+#include "h109.h"
+#include "h8043.h"
+#include "h7175.h"
+#include "h940.h"
+#ifdef X
+#include "h6023.h"
+#endif
+struct S1945 { int a; const char *s = "x//y"; };
+inline int f1945_0(int x) { return x * 0; }
+inline int f1945_1(int x) { return x * 1; }
+inline int f1945_2(int x) { return x * 2; }
+inline int f1945_3(int x) { return x * 3; }
+inline int f1945_4(int x) { return x * 4; }
+inline int f1945_5(int x) { return x * 5; }
+inline int f1945_6(int x) { return x * 6; }
+inline int f1945_7(int x) { return x * 7; }
+inline int f1945_8(int x) { return x * 8; }
+inline int f1945_9(int x) { return x * 9; }
+inline int f1945_10(int x) { return x * 10; }
+inline int f1945_11(int x) { return x * 11; }
+inline int f1945_12(int x) { return x * 12; }
+inline int f1945_13(int x) { return x * 13; }
+inline int f1945_14(int x) { return x * 14; }
+inline int f1945_15(int x) { return x * 15; }
+inline int f1945_16(int x) { return x * 16; }
+inline int f1945_17(int x) { return x * 17; }
+inline int f1945_18(int x) { return x * 18; }
+inline int f1945_19(int x) { return x * 19; }
+inline int f1945_20(int x) { return x * 20; }
+inline int f1945_21(int x) { return x * 21; }
+inline int f1945_22(int x) { return x * 22; }
+inline int f1945_23(int x) { return x * 23; }
+inline int f1945_24(int x) { return x * 24; }
+inline int f1945_25(int x) { return x * 25; }
+inline int f1945_26(int x) { return x * 26; }
+inline int f1945_27(int x) { return x * 27; }
+inline int f1945_28(int x) { return x * 28; }
+inline int f1945_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1947 */
+#include <vector>
+#include "h6095.h"
+#include "h5897.h"
+#include "h5434.h"
+#include "h2985.h"
+#include "h4271.h"
+#ifdef X
+#include "h4501.h"
+#endif
+struct S1947 { int a; const char *s = "x//y"; };
+inline int f1947_0(int x) { return x * 0; }
+inline int f1947_1(int x) { return x * 1; }
+inline int f1947_2(int x) { return x * 2; }
+inline int f1947_3(int x) { return x * 3; }
+inline int f1947_4(int x) { return x * 4; }
+inline int f1947_5(int x) { return x * 5; }
+inline int f1947_6(int x) { return x * 6; }
+inline int f1947_7(int x) { return x * 7; }
+inline int f1947_8(int x) { return x * 8; }
+inline int f1947_9(int x) { return x * 9; }
+inline int f1947_10(int x) { return x * 10; }
+inline int f1947_11(int x) { return x * 11; }
+inline int f1947_12(int x) { return x * 12; }
+inline int f1947_13(int x) { return x * 13; }
+inline int f1947_14(int x) { return x * 14; }
+inline int f1947_15(int x) { return x * 15; }
+inline int f1947_16(int x) { return x * 16; }
+inline int f1947_17(int x) { return x * 17; }
+inline int f1947_18(int x) { return x * 18; }
+inline int f1947_19(int x) { return x * 19; }
+inline int f1947_20(int x) { return x * 20; }
+inline int f1947_21(int x) { return x * 21; }
+inline int f1947_22(int x) { return x * 22; }
+inline int f1947_23(int x) { return x * 23; }
+inline int f1947_24(int x) { return x * 24; }
+inline int f1947_25(int x) { return x * 25; }
+inline int f1947_26(int x) { return x * 26; }
+inline int f1947_27(int x) { return x * 27; }
+inline int f1947_28(int x) { return x * 28; }
+inline int f1947_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1949 */
+#include <vector>
+#include "h8194.h"
+#include "h1465.h"
+#include "h9159.h"
+#include "h536.h"
+#include "h9662.h"
+#ifdef X
+#include "h3555.h"
+#endif
+struct S1949 { int a; const char *s = "x//y"; };
+inline int f1949_0(int x) { return x * 0; }
+inline int f1949_1(int x) { return x * 1; }
+inline int f1949_2(int x) { return x * 2; }
+inline int f1949_3(int x) { return x * 3; }
+inline int f1949_4(int x) { return x * 4; }
+inline int f1949_5(int x) { return x * 5; }
+inline int f1949_6(int x) { return x * 6; }
+inline int f1949_7(int x) { return x * 7; }
+inline int f1949_8(int x) { return x * 8; }
+inline int f1949_9(int x) { return x * 9; }
+inline int f1949_10(int x) { return x * 10; }
+inline int f1949_11(int x) { return x * 11; }
+inline int f1949_12(int x) { return x * 12; }
+inline int f1949_13(int x) { return x * 13; }
+inline int f1949_14(int x) { return x * 14; }
+inline int f1949_15(int x) { return x * 15; }
+inline int f1949_16(int x) { return x * 16; }
+inline int f1949_17(int x) { return x * 17; }
+inline int f1949_18(int x) { return x * 18; }
+inline int f1949_19(int x) { return x * 19; }
+inline int f1949_20(int x) { return x * 20; }
+inline int f1949_21(int x) { return x * 21; }
+inline int f1949_22(int x) { return x * 22; }
+inline int f1949_23(int x) { return x * 23; }
+inline int f1949_24(int x) { return x * 24; }
+inline int f1949_25(int x) { return x * 25; }
+inline int f1949_26(int x) { return x * 26; }
+inline int f1949_27(int x) { return x * 27; }
+inline int f1949_28(int x) { return x * 28; }
+inline int f1949_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1950 */
+#include <vector>
+#include "h228.h"
+#include "h4486.h"
+#include "h5354.h"
+#include "h1018.h"
+#include "h9657.h"
+#ifdef X
+#include "h7080.h"
+#endif
+struct S1950 { int a; const char *s = "x//y"; };
+inline int f1950_0(int x) { return x * 0; }
+inline int f1950_1(int x) { return x * 1; }
+inline int f1950_2(int x) { return x * 2; }
+inline int f1950_3(int x) { return x * 3; }
+inline int f1950_4(int x) { return x * 4; }
+inline int f1950_5(int x) { return x * 5; }
+inline int f1950_6(int x) { return x * 6; }
+inline int f1950_7(int x) { return x * 7; }
+inline int f1950_8(int x) { return x * 8; }
+inline int f1950_9(int x) { return x * 9; }
+inline int f1950_10(int x) { return x * 10; }
+inline int f1950_11(int x) { return x * 11; }
+inline int f1950_12(int x) { return x * 12; }
+inline int f1950_13(int x) { return x * 13; }
+inline int f1950_14(int x) { return x * 14; }
+inline int f1950_15(int x) { return x * 15; }
+inline int f1950_16(int x) { return x * 16; }
+inline int f1950_17(int x) { return x * 17; }
+inline int f1950_18(int x) { return x * 18; }
+inline int f1950_19(int x) { return x * 19; }
+inline int f1950_20(int x) { return x * 20; }
+inline int f1950_21(int x) { return x * 21; }
+inline int f1950_22(int x) { return x * 22; }
+inline int f1950_23(int x) { return x * 23; }
+inline int f1950_24(int x) { return x * 24; }
+inline int f1950_25(int x) { return x * 25; }
+inline int f1950_26(int x) { return x * 26; }
+inline int f1950_27(int x) { return x * 27; }
+inline int f1950_28(int x) { return x * 28; }
+inline int f1950_29(int x) { return x * 29; }
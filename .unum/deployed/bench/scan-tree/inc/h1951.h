@@ -0,0 +1,42 @@
+#pragma once
+/* header 1951 */
+#include <vector>
+#include "h8477.h"
+#include "h7058.h"
+#include "h4490.h"
+#include "h8810.h"
+#include "h4251.h"
+#ifdef X
+#include "h4204.h"
+#endif
+struct S1951 { int a; const char *s = "x//y"; };
+inline int f1951_0(int x) { return x * 0; }
+inline int f1951_1(int x) { return x * 1; }
+inline int f1951_2(int x) { return x * 2; }
+inline int f1951_3(int x) { return x * 3; }
+inline int f1951_4(int x) { return x * 4; }
+inline int f1951_5(int x) { return x * 5; }
+inline int f1951_6(int x) { return x * 6; }
+inline int f1951_7(int x) { return x * 7; }
+inline int f1951_8(int x) { return x * 8; }
+inline int f1951_9(int x) { return x * 9; }
+inline int f1951_10(int x) { return x * 10; }
+inline int f1951_11(int x) { return x * 11; }
+inline int f1951_12(int x) { return x * 12; }
+inline int f1951_13(int x) { return x * 13; }
+inline int f1951_14(int x) { return x * 14; }
+inline int f1951_15(int x) { return x * 15; }
+inline int f1951_16(int x) { return x * 16; }
+inline int f1951_17(int x) { return x * 17; }
+inline int f1951_18(int x) { return x * 18; }
+inline int f1951_19(int x) { return x * 19; }
+inline int f1951_20(int x) { return x * 20; }
+inline int f1951_21(int x) { return x * 21; }
+inline int f1951_22(int x) { return x * 22; }
+inline int f1951_23(int x) { return x * 23; }
+inline int f1951_24(int x) { return x * 24; }
+inline int f1951_25(int x) { return x * 25; }
+inline int f1951_26(int x) { return x * 26; }
+inline int f1951_27(int x) { return x * 27; }
+inline int f1951_28(int x) { return x * 28; }
+inline int f1951_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1954 */
+#include <vector>
+#include "h9661.h"
+#include "h7566.h"
+#include "h5641.h"
+#include "h75.h"
+#include "h1403.h"
+#ifdef X
+#include "h4947.h"
+#endif
+struct S1954 { int a; const char *s = "x//y"; };
+inline int f1954_0(int x) { return x * 0; }
+inline int f1954_1(int x) { return x * 1; }
+inline int f1954_2(int x) { return x * 2; }
+inline int f1954_3(int x) { return x * 3; }
+inline int f1954_4(int x) { return x * 4; }
+inline int f1954_5(int x) { return x * 5; }
+inline int f1954_6(int x) { return x * 6; }
+inline int f1954_7(int x) { return x * 7; }
+inline int f1954_8(int x) { return x * 8; }
+inline int f1954_9(int x) { return x * 9; }
+inline int f1954_10(int x) { return x * 10; }
+inline int f1954_11(int x) { return x * 11; }
+inline int f1954_12(int x) { return x * 12; }
+inline int f1954_13(int x) { return x * 13; }
+inline int f1954_14(int x) { return x * 14; }
+inline int f1954_15(int x) { return x * 15; }
+inline int f1954_16(int x) { return x * 16; }
+inline int f1954_17(int x) { return x * 17; }
+inline int f1954_18(int x) { return x * 18; }
+inline int f1954_19(int x) { return x * 19; }
+inline int f1954_20(int x) { return x * 20; }
+inline int f1954_21(int x) { return x * 21; }
+inline int f1954_22(int x) { return x * 22; }
+inline int f1954_23(int x) { return x * 23; }
+inline int f1954_24(int x) { return x * 24; }
+inline int f1954_25(int x) { return x * 25; }
+inline int f1954_26(int x) { return x * 26; }
+inline int f1954_27(int x) { return x * 27; }
+inline int f1954_28(int x) { return x * 28; }
+inline int f1954_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1955 */
+#include <vector>
+#include "h4014.h"
+#include "h5105.h"
+#include "h8498.h"
+#include "h2920.h"
+#include "h5328.h"
+#ifdef X
+#include "h6448.h"
+#endif
+struct S1955 { int a; const char *s = "x//y"; };
+inline int f1955_0(int x) { return x * 0; }
+inline int f1955_1(int x) { return x * 1; }
+inline int f1955_2(int x) { return x * 2; }
+inline int f1955_3(int x) { return x * 3; }
+inline int f1955_4(int x) { return x * 4; }
+inline int f1955_5(int x) { return x * 5; }
+inline int f1955_6(int x) { return x * 6; }
+inline int f1955_7(int x) { return x * 7; }
+inline int f1955_8(int x) { return x * 8; }
+inline int f1955_9(int x) { return x * 9; }
+inline int f1955_10(int x) { return x * 10; }
+inline int f1955_11(int x) { return x * 11; }
+inline int f1955_12(int x) { return x * 12; }
+inline int f1955_13(int x) { return x * 13; }
+inline int f1955_14(int x) { return x * 14; }
+inline int f1955_15(int x) { return x * 15; }
+inline int f1955_16(int x) { return x * 16; }
+inline int f1955_17(int x) { return x * 17; }
+inline int f1955_18(int x) { return x * 18; }
+inline int f1955_19(int x) { return x * 19; }
+inline int f1955_20(int x) { return x * 20; }
+inline int f1955_21(int x) { return x * 21; }
+inline int f1955_22(int x) { return x * 22; }
+inline int f1955_23(int x) { return x * 23; }
+inline int f1955_24(int x) { return x * 24; }
+inline int f1955_25(int x) { return x * 25; }
+inline int f1955_26(int x) { return x * 26; }
+inline int f1955_27(int x) { return x * 27; }
+inline int f1955_28(int x) { return x * 28; }
+inline int f1955_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1956 */
+#include <vector>
+#include "h910.h"
+#include "h5275.h"
+#include "h9649.h"
+#include "h185.h"
+#include "h92.h"
+#ifdef X
+#include "h2984.h"
+#endif
+struct S1956 { int a; const char *s = "x//y"; };
+inline int f1956_0(int x) { return x * 0; }
+inline int f1956_1(int x) { return x * 1; }
+inline int f1956_2(int x) { return x * 2; }
+inline int f1956_3(int x) { return x * 3; }
+inline int f1956_4(int x) { return x * 4; }
+inline int f1956_5(int x) { return x * 5; }
+inline int f1956_6(int x) { return x * 6; }
+inline int f1956_7(int x) { return x * 7; }
+inline int f1956_8(int x) { return x * 8; }
+inline int f1956_9(int x) { return x * 9; }
+inline int f1956_10(int x) { return x * 10; }
+inline int f1956_11(int x) { return x * 11; }
+inline int f1956_12(int x) { return x * 12; }
+inline int f1956_13(int x) { return x * 13; }
+inline int f1956_14(int x) { return x * 14; }
+inline int f1956_15(int x) { return x * 15; }
+inline int f1956_16(int x) { return x * 16; }
+inline int f1956_17(int x) { return x * 17; }
+inline int f1956_18(int x) { return x * 18; }
+inline int f1956_19(int x) { return x * 19; }
+inline int f1956_20(int x) { return x * 20; }
+inline int f1956_21(int x) { return x * 21; }
+inline int f1956_22(int x) { return x * 22; }
+inline int f1956_23(int x) { return x * 23; }
+inline int f1956_24(int x) { return x * 24; }
+inline int f1956_25(int x) { return x * 25; }
+inline int f1956_26(int x) { return x * 26; }
+inline int f1956_27(int x) { return x * 27; }
+inline int f1956_28(int x) { return x * 28; }
+inline int f1956_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1959 */
+#include <vector>
+#include "h5499.h"
+#include "h7228.h"
+#include "h9155.h"
+#include "h4971.h"
+#include "h9003.h"
+#ifdef X
+#include "h6527.h"
+#endif
+struct S1959 { int a; const char *s = "x//y"; };
+inline int f1959_0(int x) { return x * 0; }
+inline int f1959_1(int x) { return x * 1; }
+inline int f1959_2(int x) { return x * 2; }
+inline int f1959_3(int x) { return x * 3; }
+inline int f1959_4(int x) { return x * 4; }
+inline int f1959_5(int x) { return x * 5; }
+inline int f1959_6(int x) { return x * 6; }
+inline int f1959_7(int x) { return x * 7; }
+inline int f1959_8(int x) { return x * 8; }
+inline int f1959_9(int x) { return x * 9; }
+inline int f1959_10(int x) { return x * 10; }
+inline int f1959_11(int x) { return x * 11; }
+inline int f1959_12(int x) { return x * 12; }
+inline int f1959_13(int x) { return x * 13; }
+inline int f1959_14(int x) { return x * 14; }
+inline int f1959_15(int x) { return x * 15; }
+inline int f1959_16(int x) { return x * 16; }
+inline int f1959_17(int x) { return x * 17; }
+inline int f1959_18(int x) { return x * 18; }
+inline int f1959_19(int x) { return x * 19; }
+inline int f1959_20(int x) { return x * 20; }
+inline int f1959_21(int x) { return x * 21; }
+inline int f1959_22(int x) { return x * 22; }
+inline int f1959_23(int x) { return x * 23; }
+inline int f1959_24(int x) { return x * 24; }
+inline int f1959_25(int x) { return x * 25; }
+inline int f1959_26(int x) { return x * 26; }
+inline int f1959_27(int x) { return x * 27; }
+inline int f1959_28(int x) { return x * 28; }
+inline int f1959_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1963 */
+#include <vector>
+#include "h5.h"
+#include "h6230.h"
+#include "h8609.h"
+#include "h4133.h"
+#include "h1476.h"
+#ifdef X
+#include "h8026.h"
+#endif
+struct S1963 { int a; const char *s = "x//y"; };
+inline int f1963_0(int x) { return x * 0; }
+inline int f1963_1(int x) { return x * 1; }
+inline int f1963_2(int x) { return x * 2; }
+inline int f1963_3(int x) { return x * 3; }
+inline int f1963_4(int x) { return x * 4; }
+inline int f1963_5(int x) { return x * 5; }
+inline int f1963_6(int x) { return x * 6; }
+inline int f1963_7(int x) { return x * 7; }
+inline int f1963_8(int x) { return x * 8; }
+inline int f1963_9(int x) { return x * 9; }
+inline int f1963_10(int x) { return x * 10; }
+inline int f1963_11(int x) { return x * 11; }
+inline int f1963_12(int x) { return x * 12; }
+inline int f1963_13(int x) { return x * 13; }
+inline int f1963_14(int x) { return x * 14; }
+inline int f1963_15(int x) { return x * 15; }
+inline int f1963_16(int x) { return x * 16; }
+inline int f1963_17(int x) { return x * 17; }
+inline int f1963_18(int x) { return x * 18; }
+inline int f1963_19(int x) { return x * 19; }
+inline int f1963_20(int x) { return x * 20; }
+inline int f1963_21(int x) { return x * 21; }
+inline int f1963_22(int x) { return x * 22; }
+inline int f1963_23(int x) { return x * 23; }
+inline int f1963_24(int x) { return x * 24; }
+inline int f1963_25(int x) { return x * 25; }
+inline int f1963_26(int x) { return x * 26; }
+inline int f1963_27(int x) { return x * 27; }
+inline int f1963_28(int x) { return x * 28; }
+inline int f1963_29(int x) { return x * 29; }
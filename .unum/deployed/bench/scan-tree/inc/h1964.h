@@ -0,0 +1,42 @@
+#pragma once
+/* header 1964 */
+#include <vector>
+#include "h8881.h"
+#include "h1023.h"
+#include "h1994.h"
+#include "h9594.h"
+#include "h2535.h"
+#ifdef X
+#include "h4477.h"
+#endif
+struct S1964 { int a; const char *s = "x//y"; };
+inline int f1964_0(int x) { return x * 0; }
+inline int f1964_1(int x) { return x * 1; }
+inline int f1964_2(int x) { return x * 2; }
+inline int f1964_3(int x) { return x * 3; }
+inline int f1964_4(int x) { return x * 4; }
+inline int f1964_5(int x) { return x * 5; }
+inline int f1964_6(int x) { return x * 6; }
+inline int f1964_7(int x) { return x * 7; }
+inline int f1964_8(int x) { return x * 8; }
+inline int f1964_9(int x) { return x * 9; }
+inline int f1964_10(int x) { return x * 10; }
+inline int f1964_11(int x) { return x * 11; }
+inline int f1964_12(int x) { return x * 12; }
+inline int f1964_13(int x) { return x * 13; }
+inline int f1964_14(int x) { return x * 14; }
+inline int f1964_15(int x) { return x * 15; }
+inline int f1964_16(int x) { return x * 16; }
+inline int f1964_17(int x) { return x * 17; }
+inline int f1964_18(int x) { return x * 18; }
+inline int f1964_19(int x) { return x * 19; }
+inline int f1964_20(int x) { return x * 20; }
+inline int f1964_21(int x) { return x * 21; }
+inline int f1964_22(int x) { return x * 22; }
+inline int f1964_23(int x) { return x * 23; }
+inline int f1964_24(int x) { return x * 24; }
+inline int f1964_25(int x) { return x * 25; }
+inline int f1964_26(int x) { return x * 26; }
+inline int f1964_27(int x) { return x * 27; }
+inline int f1964_28(int x) { return x * 28; }
+inline int f1964_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1965 */
+#include <vector>
+#include "h9242.h"
+#include "h6668.h"
+#include "h7737.h"
+#include "h2254.h"
+#include "h2895.h"
+#ifdef X
+#include "h3537.h"
+#endif
+struct S1965 { int a; const char *s = "x//y"; };
+inline int f1965_0(int x) { return x * 0; }
+inline int f1965_1(int x) { return x * 1; }
+inline int f1965_2(int x) { return x * 2; }
+inline int f1965_3(int x) { return x * 3; }
+inline int f1965_4(int x) { return x * 4; }
+inline int f1965_5(int x) { return x * 5; }
+inline int f1965_6(int x) { return x * 6; }
+inline int f1965_7(int x) { return x * 7; }
+inline int f1965_8(int x) { return x * 8; }
+inline int f1965_9(int x) { return x * 9; }
+inline int f1965_10(int x) { return x * 10; }
+inline int f1965_11(int x) { return x * 11; }
+inline int f1965_12(int x) { return x * 12; }
+inline int f1965_13(int x) { return x * 13; }
+inline int f1965_14(int x) { return x * 14; }
+inline int f1965_15(int x) { return x * 15; }
+inline int f1965_16(int x) { return x * 16; }
+inline int f1965_17(int x) { return x * 17; }
+inline int f1965_18(int x) { return x * 18; }
+inline int f1965_19(int x) { return x * 19; }
+inline int f1965_20(int x) { return x * 20; }
+inline int f1965_21(int x) { return x * 21; }
+inline int f1965_22(int x) { return x * 22; }
+inline int f1965_23(int x) { return x * 23; }
+inline int f1965_24(int x) { return x * 24; }
+inline int f1965_25(int x) { return x * 25; }
+inline int f1965_26(int x) { return x * 26; }
+inline int f1965_27(int x) { return x * 27; }
+inline int f1965_28(int x) { return x * 28; }
+inline int f1965_29(int x) { return x * 29; }
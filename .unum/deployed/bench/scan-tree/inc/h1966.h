@@ -0,0 +1,42 @@
+#pragma once
+/* header 1966 */
+#include <vector>
+#include "h3865.h"
+#include "h5373.h"
+#include "h5589.h"
+#include "h9641.h"
+#include "h6486.h"
+#ifdef X
+#include "h2619.h"
+#endif
+struct S1966 { int a; const char *s = "x//y"; };
+inline int f1966_0(int x) { return x * 0; }
+inline int f1966_1(int x) { return x * 1; }
+inline int f1966_2(int x) { return x * 2; }
+inline int f1966_3(int x) { return x * 3; }
+inline int f1966_4(int x) { return x * 4; }
+inline int f1966_5(int x) { return x * 5; }
+inline int f1966_6(int x) { return x * 6; }
+inline int f1966_7(int x) { return x * 7; }
+inline int f1966_8(int x) { return x * 8; }
+inline int f1966_9(int x) { return x * 9; }
+inline int f1966_10(int x) { return x * 10; }
+inline int f1966_11(int x) { return x * 11; }
+inline int f1966_12(int x) { return x * 12; }
+inline int f1966_13(int x) { return x * 13; }
+inline int f1966_14(int x) { return x * 14; }
+inline int f1966_15(int x) { return x * 15; }
+inline int f1966_16(int x) { return x * 16; }
+inline int f1966_17(int x) { return x * 17; }
+inline int f1966_18(int x) { return x * 18; }
+inline int f1966_19(int x) { return x * 19; }
+inline int f1966_20(int x) { return x * 20; }
+inline int f1966_21(int x) { return x * 21; }
+inline int f1966_22(int x) { return x * 22; }
+inline int f1966_23(int x) { return x * 23; }
+inline int f1966_24(int x) { return x * 24; }
+inline int f1966_25(int x) { return x * 25; }
+inline int f1966_26(int x) { return x * 26; }
+inline int f1966_27(int x) { return x * 27; }
+inline int f1966_28(int x) { return x * 28; }
+inline int f1966_29(int x) { return x * 29; }
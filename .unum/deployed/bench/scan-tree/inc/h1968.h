@@ -0,0 +1,42 @@
+#pragma once
+/* header 1968 */
+#include <vector>
+#include "h6847.h"
+#include "h3897.h"
+#include "h3525.h"
+#include "h2957.h"
+#include "h6020.h"
+#ifdef X
+#include "h2477.h"
+#endif
+struct S1968 { int a; const char *s = "x//y"; };
+inline int f1968_0(int x) { return x * 0; }
+inline int f1968_1(int x) { return x * 1; }
+inline int f1968_2(int x) { return x * 2; }
+inline int f1968_3(int x) { return x * 3; }
+inline int f1968_4(int x) { return x * 4; }
+inline int f1968_5(int x) { return x * 5; }
+inline int f1968_6(int x) { return x * 6; }
+inline int f1968_7(int x) { return x * 7; }
+inline int f1968_8(int x) { return x * 8; }
+inline int f1968_9(int x) { return x * 9; }
+inline int f1968_10(int x) { return x * 10; }
+inline int f1968_11(int x) { return x * 11; }
+inline int f1968_12(int x) { return x * 12; }
+inline int f1968_13(int x) { return x * 13; }
+inline int f1968_14(int x) { return x * 14; }
+inline int f1968_15(int x) { return x * 15; }
+inline int f1968_16(int x) { return x * 16; }
+inline int f1968_17(int x) { return x * 17; }
+inline int f1968_18(int x) { return x * 18; }
+inline int f1968_19(int x) { return x * 19; }
+inline int f1968_20(int x) { return x * 20; }
+inline int f1968_21(int x) { return x * 21; }
+inline int f1968_22(int x) { return x * 22; }
+inline int f1968_23(int x) { return x * 23; }
+inline int f1968_24(int x) { return x * 24; }
+inline int f1968_25(int x) { return x * 25; }
+inline int f1968_26(int x) { return x * 26; }
+inline int f1968_27(int x) { return x * 27; }
+inline int f1968_28(int x) { return x * 28; }
+inline int f1968_29(int x) { return x * 29; }
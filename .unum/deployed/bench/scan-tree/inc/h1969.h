@@ -0,0 +1,42 @@
+#pragma once
+/* header 1969 */
+#include <vector>
+#include "h7161.h"
+#include "h9705.h"
+#include "h7577.h"
+#include "h7337.h"
+#include "h6577.h"
+#ifdef X
+#include "h6674.h"
+#endif
+struct S1969 { int a; const char *s = "x//y"; };
+inline int f1969_0(int x) { return x * 0; }
+inline int f1969_1(int x) { return x * 1; }
+inline int f1969_2(int x) { return x * 2; }
+inline int f1969_3(int x) { return x * 3; }
+inline int f1969_4(int x) { return x * 4; }
+inline int f1969_5(int x) { return x * 5; }
+inline int f1969_6(int x) { return x * 6; }
+inline int f1969_7(int x) { return x * 7; }
+inline int f1969_8(int x) { return x * 8; }
+inline int f1969_9(int x) { return x * 9; }
+inline int f1969_10(int x) { return x * 10; }
+inline int f1969_11(int x) { return x * 11; }
+inline int f1969_12(int x) { return x * 12; }
+inline int f1969_13(int x) { return x * 13; }
+inline int f1969_14(int x) { return x * 14; }
+inline int f1969_15(int x) { return x * 15; }
+inline int f1969_16(int x) { return x * 16; }
+inline int f1969_17(int x) { return x * 17; }
+inline int f1969_18(int x) { return x * 18; }
+inline int f1969_19(int x) { return x * 19; }
+inline int f1969_20(int x) { return x * 20; }
+inline int f1969_21(int x) { return x * 21; }
+inline int f1969_22(int x) { return x * 22; }
+inline int f1969_23(int x) { return x * 23; }
+inline int f1969_24(int x) { return x * 24; }
+inline int f1969_25(int x) { return x * 25; }
+inline int f1969_26(int x) { return x * 26; }
+inline int f1969_27(int x) { return x * 27; }
+inline int f1969_28(int x) { return x * 28; }
+inline int f1969_29(int x) { return x * 29; }
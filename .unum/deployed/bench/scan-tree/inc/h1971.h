@@ -0,0 +1,42 @@
+#pragma once
+/* header 1971 */
+#include <vector>
+#include "h5712.h"
+#include "h5913.h"
+#include "h9897.h"
+#include "h703.h"
+#include "h7720.h"
+#ifdef X
+#include "h1723.h"
+#endif
+struct S1971 { int a; const char *s = "x//y"; };
+inline int f1971_0(int x) { return x * 0; }
+inline int f1971_1(int x) { return x * 1; }
+inline int f1971_2(int x) { return x * 2; }
+inline int f1971_3(int x) { return x * 3; }
+inline int f1971_4(int x) { return x * 4; }
+inline int f1971_5(int x) { return x * 5; }
+inline int f1971_6(int x) { return x * 6; }
+inline int f1971_7(int x) { return x * 7; }
+inline int f1971_8(int x) { return x * 8; }
+inline int f1971_9(int x) { return x * 9; }
+inline int f1971_10(int x) { return x * 10; }
+inline int f1971_11(int x) { return x * 11; }
+inline int f1971_12(int x) { return x * 12; }
+inline int f1971_13(int x) { return x * 13; }
+inline int f1971_14(int x) { return x * 14; }
+inline int f1971_15(int x) { return x * 15; }
+inline int f1971_16(int x) { return x * 16; }
+inline int f1971_17(int x) { return x * 17; }
+inline int f1971_18(int x) { return x * 18; }
+inline int f1971_19(int x) { return x * 19; }
+inline int f1971_20(int x) { return x * 20; }
+inline int f1971_21(int x) { return x * 21; }
+inline int f1971_22(int x) { return x * 22; }
+inline int f1971_23(int x) { return x * 23; }
+inline int f1971_24(int x) { return x * 24; }
+inline int f1971_25(int x) { return x * 25; }
+inline int f1971_26(int x) { return x * 26; }
+inline int f1971_27(int x) { return x * 27; }
+inline int f1971_28(int x) { return x * 28; }
+inline int f1971_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1973 */
+#include <vector>
+#include "h3607.h"
+#include "h5128.h"
+#include "h406.h"
+#include "h3834.h"
+#include "h5662.h"
+#ifdef X
+#include "h1925.h"
+#endif
+struct S1973 { int a; const char *s = "x//y"; };
+inline int f1973_0(int x) { return x * 0; }
+inline int f1973_1(int x) { return x * 1; }
+inline int f1973_2(int x) { return x * 2; }
+inline int f1973_3(int x) { return x * 3; }
+inline int f1973_4(int x) { return x * 4; }
+inline int f1973_5(int x) { return x * 5; }
+inline int f1973_6(int x) { return x * 6; }
+inline int f1973_7(int x) { return x * 7; }
+inline int f1973_8(int x) { return x * 8; }
+inline int f1973_9(int x) { return x * 9; }
+inline int f1973_10(int x) { return x * 10; }
+inline int f1973_11(int x) { return x * 11; }
+inline int f1973_12(int x) { return x * 12; }
+inline int f1973_13(int x) { return x * 13; }
+inline int f1973_14(int x) { return x * 14; }
+inline int f1973_15(int x) { return x * 15; }
+inline int f1973_16(int x) { return x * 16; }
+inline int f1973_17(int x) { return x * 17; }
+inline int f1973_18(int x) { return x * 18; }
+inline int f1973_19(int x) { return x * 19; }
+inline int f1973_20(int x) { return x * 20; }
+inline int f1973_21(int x) { return x * 21; }
+inline int f1973_22(int x) { return x * 22; }
+inline int f1973_23(int x) { return x * 23; }
+inline int f1973_24(int x) { return x * 24; }
+inline int f1973_25(int x) { return x * 25; }
+inline int f1973_26(int x) { return x * 26; }
+inline int f1973_27(int x) { return x * 27; }
+inline int f1973_28(int x) { return x * 28; }
+inline int f1973_29(int x) { return x * 29; }
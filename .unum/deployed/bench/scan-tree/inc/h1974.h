@@ -0,0 +1,42 @@
+#pragma once
+/* header 1974 */
+#include <vector>
+#include "h8194.h"
+#include "h182.h"
+#include "h6549.h"
+#include "h1185.h"
+#include "h4152.h"
+#ifdef X
+#include "h995.h"
+#endif
+struct S1974 { int a; const char *s = "x//y"; };
+inline int f1974_0(int x) { return x * 0; }
+inline int f1974_1(int x) { return x * 1; }
+inline int f1974_2(int x) { return x * 2; }
+inline int f1974_3(int x) { return x * 3; }
+inline int f1974_4(int x) { return x * 4; }
+inline int f1974_5(int x) { return x * 5; }
+inline int f1974_6(int x) { return x * 6; }
+inline int f1974_7(int x) { return x * 7; }
+inline int f1974_8(int x) { return x * 8; }
+inline int f1974_9(int x) { return x * 9; }
+inline int f1974_10(int x) { return x * 10; }
+inline int f1974_11(int x) { return x * 11; }
+inline int f1974_12(int x) { return x * 12; }
+inline int f1974_13(int x) { return x * 13; }
+inline int f1974_14(int x) { return x * 14; }
+inline int f1974_15(int x) { return x * 15; }
+inline int f1974_16(int x) { return x * 16; }
+inline int f1974_17(int x) { return x * 17; }
+inline int f1974_18(int x) { return x * 18; }
+inline int f1974_19(int x) { return x * 19; }
+inline int f1974_20(int x) { return x * 20; }
+inline int f1974_21(int x) { return x * 21; }
+inline int f1974_22(int x) { return x * 22; }
+inline int f1974_23(int x) { return x * 23; }
+inline int f1974_24(int x) { return x * 24; }
+inline int f1974_25(int x) { return x * 25; }
+inline int f1974_26(int x) { return x * 26; }
+inline int f1974_27(int x) { return x * 27; }
+inline int f1974_28(int x) { return x * 28; }
+inline int f1974_29(int x) { return x * 29; }
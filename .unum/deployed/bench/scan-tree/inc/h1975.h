@@ -0,0 +1,42 @@
+#pragma once
+/* header 1975 */
+#include <vector>
+#include "h9184.h"
+#include "h293.h"
+#include "h318.h"
+#include "h7000.h"
+#include "h7640.h"
+#ifdef X
+#include "h8219.h"
+#endif
+struct S1975 { int a; const char *s = "x//y"; };
+inline int f1975_0(int x) { return x * 0; }
+inline int f1975_1(int x) { return x * 1; }
+inline int f1975_2(int x) { return x * 2; }
+inline int f1975_3(int x) { return x * 3; }
+inline int f1975_4(int x) { return x * 4; }
+inline int f1975_5(int x) { return x * 5; }
+inline int f1975_6(int x) { return x * 6; }
+inline int f1975_7(int x) { return x * 7; }
+inline int f1975_8(int x) { return x * 8; }
+inline int f1975_9(int x) { return x * 9; }
+inline int f1975_10(int x) { return x * 10; }
+inline int f1975_11(int x) { return x * 11; }
+inline int f1975_12(int x) { return x * 12; }
+inline int f1975_13(int x) { return x * 13; }
+inline int f1975_14(int x) { return x * 14; }
+inline int f1975_15(int x) { return x * 15; }
+inline int f1975_16(int x) { return x * 16; }
+inline int f1975_17(int x) { return x * 17; }
+inline int f1975_18(int x) { return x * 18; }
+inline int f1975_19(int x) { return x * 19; }
+inline int f1975_20(int x) { return x * 20; }
+inline int f1975_21(int x) { return x * 21; }
+inline int f1975_22(int x) { return x * 22; }
+inline int f1975_23(int x) { return x * 23; }
+inline int f1975_24(int x) { return x * 24; }
+inline int f1975_25(int x) { return x * 25; }
+inline int f1975_26(int x) { return x * 26; }
+inline int f1975_27(int x) { return x * 27; }
+inline int f1975_28(int x) { return x * 28; }
+inline int f1975_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1977 */
+#include <vector>
+#include "h7980.h"
+#include "h4968.h"
+#include "h5155.h"
+#include "h4551.h"
+#include "h1647.h"
+#ifdef X
+#include "h1203.h"
+#endif
+struct S1977 { int a; const char *s = "x//y"; };
+inline int f1977_0(int x) { return x * 0; }
+inline int f1977_1(int x) { return x * 1; }
+inline int f1977_2(int x) { return x * 2; }
+inline int f1977_3(int x) { return x * 3; }
+inline int f1977_4(int x) { return x * 4; }
+inline int f1977_5(int x) { return x * 5; }
+inline int f1977_6(int x) { return x * 6; }
+inline int f1977_7(int x) { return x * 7; }
+inline int f1977_8(int x) { return x * 8; }
+inline int f1977_9(int x) { return x * 9; }
+inline int f1977_10(int x) { return x * 10; }
+inline int f1977_11(int x) { return x * 11; }
+inline int f1977_12(int x) { return x * 12; }
+inline int f1977_13(int x) { return x * 13; }
+inline int f1977_14(int x) { return x * 14; }
+inline int f1977_15(int x) { return x * 15; }
+inline int f1977_16(int x) { return x * 16; }
+inline int f1977_17(int x) { return x * 17; }
+inline int f1977_18(int x) { return x * 18; }
+inline int f1977_19(int x) { return x * 19; }
+inline int f1977_20(int x) { return x * 20; }
+inline int f1977_21(int x) { return x * 21; }
+inline int f1977_22(int x) { return x * 22; }
+inline int f1977_23(int x) { return x * 23; }
+inline int f1977_24(int x) { return x * 24; }
+inline int f1977_25(int x) { return x * 25; }
+inline int f1977_26(int x) { return x * 26; }
+inline int f1977_27(int x) { return x * 27; }
+inline int f1977_28(int x) { return x * 28; }
+inline int f1977_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1979 */
+#include <vector>
+#include "h2.h"
+#include "h5640.h"
+#include "h8515.h"
+#include "h1421.h"
+#include "h310.h"
+#ifdef X
+#include "h5202.h"
+#endif
+struct S1979 { int a; const char *s = "x//y"; };
+inline int f1979_0(int x) { return x * 0; }
+inline int f1979_1(int x) { return x * 1; }
+inline int f1979_2(int x) { return x * 2; }
+inline int f1979_3(int x) { return x * 3; }
+inline int f1979_4(int x) { return x * 4; }
+inline int f1979_5(int x) { return x * 5; }
+inline int f1979_6(int x) { return x * 6; }
+inline int f1979_7(int x) { return x * 7; }
+inline int f1979_8(int x) { return x * 8; }
+inline int f1979_9(int x) { return x * 9; }
+inline int f1979_10(int x) { return x * 10; }
+inline int f1979_11(int x) { return x * 11; }
+inline int f1979_12(int x) { return x * 12; }
+inline int f1979_13(int x) { return x * 13; }
+inline int f1979_14(int x) { return x * 14; }
+inline int f1979_15(int x) { return x * 15; }
+inline int f1979_16(int x) { return x * 16; }
+inline int f1979_17(int x) { return x * 17; }
+inline int f1979_18(int x) { return x * 18; }
+inline int f1979_19(int x) { return x * 19; }
+inline int f1979_20(int x) { return x * 20; }
+inline int f1979_21(int x) { return x * 21; }
+inline int f1979_22(int x) { return x * 22; }
+inline int f1979_23(int x) { return x * 23; }
+inline int f1979_24(int x) { return x * 24; }
+inline int f1979_25(int x) { return x * 25; }
+inline int f1979_26(int x) { return x * 26; }
+inline int f1979_27(int x) { return x * 27; }
+inline int f1979_28(int x) { return x * 28; }
+inline int f1979_29(int x) { return x * 29; }
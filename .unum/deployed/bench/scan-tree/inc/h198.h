@@ -0,0 +1,42 @@
+#pragma once
+/* header 198 */
+#include <vector>
+#include "h4101.h"
+#include "h1503.h"
+#include "h2967.h"
+#include "h3738.h"
+#include "h4836.h"
+#ifdef X
+#include "h9744.h"
+#endif
+struct S198 { int a; const char *s = "x//y"; };
+inline int f198_0(int x) { return x * 0; }
+inline int f198_1(int x) { return x * 1; }
+inline int f198_2(int x) { return x * 2; }
+inline int f198_3(int x) { return x * 3; }
+inline int f198_4(int x) { return x * 4; }
+inline int f198_5(int x) { return x * 5; }
+inline int f198_6(int x) { return x * 6; }
+inline int f198_7(int x) { return x * 7; }
+inline int f198_8(int x) { return x * 8; }
+inline int f198_9(int x) { return x * 9; }
+inline int f198_10(int x) { return x * 10; }
+inline int f198_11(int x) { return x * 11; }
+inline int f198_12(int x) { return x * 12; }
+inline int f198_13(int x) { return x * 13; }
+inline int f198_14(int x) { return x * 14; }
+inline int f198_15(int x) { return x * 15; }
+inline int f198_16(int x) { return x * 16; }
+inline int f198_17(int x) { return x * 17; }
+inline int f198_18(int x) { return x * 18; }
+inline int f198_19(int x) { return x * 19; }
+inline int f198_20(int x) { return x * 20; }
+inline int f198_21(int x) { return x * 21; }
+inline int f198_22(int x) { return x * 22; }
+inline int f198_23(int x) { return x * 23; }
+inline int f198_24(int x) { return x * 24; }
+inline int f198_25(int x) { return x * 25; }
+inline int f198_26(int x) { return x * 26; }
+inline int f198_27(int x) { return x * 27; }
+inline int f198_28(int x) { return x * 28; }
+inline int f198_29(int x) { return x * 29; }
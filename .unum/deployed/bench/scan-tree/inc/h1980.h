@@ -0,0 +1,42 @@
+#pragma once
+/* header 1980 */
+#include <vector>
+#include "h5360.h"
+#include "h4633.h"
+#include "h8291.h"
+#include "h2284.h"
+#include "h6961.h"
+#ifdef X
+#include "h6807.h"
+#endif
+struct S1980 { int a; const char *s = "x//y"; };
+inline int f1980_0(int x) { return x * 0; }
+inline int f1980_1(int x) { return x * 1; }
+inline int f1980_2(int x) { return x * 2; }
+inline int f1980_3(int x) { return x * 3; }
+inline int f1980_4(int x) { return x * 4; }
+inline int f1980_5(int x) { return x * 5; }
+inline int f1980_6(int x) { return x * 6; }
+inline int f1980_7(int x) { return x * 7; }
+inline int f1980_8(int x) { return x * 8; }
+inline int f1980_9(int x) { return x * 9; }
+inline int f1980_10(int x) { return x * 10; }
+inline int f1980_11(int x) { return x * 11; }
+inline int f1980_12(int x) { return x * 12; }
+inline int f1980_13(int x) { return x * 13; }
+inline int f1980_14(int x) { return x * 14; }
+inline int f1980_15(int x) { return x * 15; }
+inline int f1980_16(int x) { return x * 16; }
+inline int f1980_17(int x) { return x * 17; }
+inline int f1980_18(int x) { return x * 18; }
+inline int f1980_19(int x) { return x * 19; }
+inline int f1980_20(int x) { return x * 20; }
+inline int f1980_21(int x) { return x * 21; }
+inline int f1980_22(int x) { return x * 22; }
+inline int f1980_23(int x) { return x * 23; }
+inline int f1980_24(int x) { return x * 24; }
+inline int f1980_25(int x) { return x * 25; }
+inline int f1980_26(int x) { return x * 26; }
+inline int f1980_27(int x) { return x * 27; }
+inline int f1980_28(int x) { return x * 28; }
+inline int f1980_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1982 */
+#include <vector>
+#include "h9406.h"
+#include "h4152.h"
+#include "h3224.h"
+#include "h5249.h"
+#include "h8005.h"
+#ifdef X
+#include "h5056.h"
+#endif
+struct S1982 { int a; const char *s = "x//y"; };
+inline int f1982_0(int x) { return x * 0; }
+inline int f1982_1(int x) { return x * 1; }
+inline int f1982_2(int x) { return x * 2; }
+inline int f1982_3(int x) { return x * 3; }
+inline int f1982_4(int x) { return x * 4; }
+inline int f1982_5(int x) { return x * 5; }
+inline int f1982_6(int x) { return x * 6; }
+inline int f1982_7(int x) { return x * 7; }
+inline int f1982_8(int x) { return x * 8; }
+inline int f1982_9(int x) { return x * 9; }
+inline int f1982_10(int x) { return x * 10; }
+inline int f1982_11(int x) { return x * 11; }
+inline int f1982_12(int x) { return x * 12; }
+inline int f1982_13(int x) { return x * 13; }
+inline int f1982_14(int x) { return x * 14; }
+inline int f1982_15(int x) { return x * 15; }
+inline int f1982_16(int x) { return x * 16; }
+inline int f1982_17(int x) { return x * 17; }
+inline int f1982_18(int x) { return x * 18; }
+inline int f1982_19(int x) { return x * 19; }
+inline int f1982_20(int x) { return x * 20; }
+inline int f1982_21(int x) { return x * 21; }
+inline int f1982_22(int x) { return x * 22; }
+inline int f1982_23(int x) { return x * 23; }
+inline int f1982_24(int x) { return x * 24; }
+inline int f1982_25(int x) { return x * 25; }
+inline int f1982_26(int x) { return x * 26; }
+inline int f1982_27(int x) { return x * 27; }
+inline int f1982_28(int x) { return x * 28; }
+inline int f1982_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1983 */
+#include <vector>
+#include "h3502.h"
+#include "h2501.h"
+#include "h5842.h"
+#include "h3825.h"
+#include "h1775.h"
+#ifdef X
+#include "h5816.h"
+#endif
+struct S1983 { int a; const char *s = "x//y"; };
+inline int f1983_0(int x) { return x * 0; }
+inline int f1983_1(int x) { return x * 1; }
+inline int f1983_2(int x) { return x * 2; }
+inline int f1983_3(int x) { return x * 3; }
+inline int f1983_4(int x) { return x * 4; }
+inline int f1983_5(int x) { return x * 5; }
+inline int f1983_6(int x) { return x * 6; }
+inline int f1983_7(int x) { return x * 7; }
+inline int f1983_8(int x) { return x * 8; }
+inline int f1983_9(int x) { return x * 9; }
+inline int f1983_10(int x) { return x * 10; }
+inline int f1983_11(int x) { return x * 11; }
+inline int f1983_12(int x) { return x * 12; }
+inline int f1983_13(int x) { return x * 13; }
+inline int f1983_14(int x) { return x * 14; }
+inline int f1983_15(int x) { return x * 15; }
+inline int f1983_16(int x) { return x * 16; }
+inline int f1983_17(int x) { return x * 17; }
+inline int f1983_18(int x) { return x * 18; }
+inline int f1983_19(int x) { return x * 19; }
+inline int f1983_20(int x) { return x * 20; }
+inline int f1983_21(int x) { return x * 21; }
+inline int f1983_22(int x) { return x * 22; }
+inline int f1983_23(int x) { return x * 23; }
+inline int f1983_24(int x) { return x * 24; }
+inline int f1983_25(int x) { return x * 25; }
+inline int f1983_26(int x) { return x * 26; }
+inline int f1983_27(int x) { return x * 27; }
+inline int f1983_28(int x) { return x * 28; }
+inline int f1983_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1986 */
+#include <vector>
+#include "h5324.h"
+#include "h2172.h"
+#include "h8664.h"
+#include "h3451.h"
+#include "h2725.h"
+#ifdef X
+#include "h6863.h"
+#endif
+struct S1986 { int a; const char *s = "x//y"; };
+inline int f1986_0(int x) { return x * 0; }
+inline int f1986_1(int x) { return x * 1; }
+inline int f1986_2(int x) { return x * 2; }
+inline int f1986_3(int x) { return x * 3; }
+inline int f1986_4(int x) { return x * 4; }
+inline int f1986_5(int x) { return x * 5; }
+inline int f1986_6(int x) { return x * 6; }
+inline int f1986_7(int x) { return x * 7; }
+inline int f1986_8(int x) { return x * 8; }
+inline int f1986_9(int x) { return x * 9; }
+inline int f1986_10(int x) { return x * 10; }
+inline int f1986_11(int x) { return x * 11; }
+inline int f1986_12(int x) { return x * 12; }
+inline int f1986_13(int x) { return x * 13; }
+inline int f1986_14(int x) { return x * 14; }
+inline int f1986_15(int x) { return x * 15; }
+inline int f1986_16(int x) { return x * 16; }
+inline int f1986_17(int x) { return x * 17; }
+inline int f1986_18(int x) { return x * 18; }
+inline int f1986_19(int x) { return x * 19; }
+inline int f1986_20(int x) { return x * 20; }
+inline int f1986_21(int x) { return x * 21; }
+inline int f1986_22(int x) { return x * 22; }
+inline int f1986_23(int x) { return x * 23; }
+inline int f1986_24(int x) { return x * 24; }
+inline int f1986_25(int x) { return x * 25; }
+inline int f1986_26(int x) { return x * 26; }
+inline int f1986_27(int x) { return x * 27; }
+inline int f1986_28(int x) { return x * 28; }
+inline int f1986_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1987 */
+#include <vector>
+#include "h2743.h"
+#include "h7869.h"
+#include "h5878.h"
+#include "h1951.h"
+#include "h3429.h"
+#ifdef X
+#include "h1240.h"
+#endif
+struct S1987 { int a; const char *s = "x//y"; };
+inline int f1987_0(int x) { return x * 0; }
+inline int f1987_1(int x) { return x * 1; }
+inline int f1987_2(int x) { return x * 2; }
+inline int f1987_3(int x) { return x * 3; }
+inline int f1987_4(int x) { return x * 4; }
+inline int f1987_5(int x) { return x * 5; }
+inline int f1987_6(int x) { return x * 6; }
+inline int f1987_7(int x) { return x * 7; }
+inline int f1987_8(int x) { return x * 8; }
+inline int f1987_9(int x) { return x * 9; }
+inline int f1987_10(int x) { return x * 10; }
+inline int f1987_11(int x) { return x * 11; }
+inline int f1987_12(int x) { return x * 12; }
+inline int f1987_13(int x) { return x * 13; }
+inline int f1987_14(int x) { return x * 14; }
+inline int f1987_15(int x) { return x * 15; }
+inline int f1987_16(int x) { return x * 16; }
+inline int f1987_17(int x) { return x * 17; }
+inline int f1987_18(int x) { return x * 18; }
+inline int f1987_19(int x) { return x * 19; }
+inline int f1987_20(int x) { return x * 20; }
+inline int f1987_21(int x) { return x * 21; }
+inline int f1987_22(int x) { return x * 22; }
+inline int f1987_23(int x) { return x * 23; }
+inline int f1987_24(int x) { return x * 24; }
+inline int f1987_25(int x) { return x * 25; }
+inline int f1987_26(int x) { return x * 26; }
+inline int f1987_27(int x) { return x * 27; }
+inline int f1987_28(int x) { return x * 28; }
+inline int f1987_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 199 */
+#include <vector>
+#include "h3857.h"
+#include "h2411.h"
+#include "h4550.h"
+#include "h1199.h"
+#include "h6151.h"
+#ifdef X
+#include "h1955.h"
+#endif
+struct S199 { int a; const char *s = "x//y"; };
+inline int f199_0(int x) { return x * 0; }
+inline int f199_1(int x) { return x * 1; }
+inline int f199_2(int x) { return x * 2; }
+inline int f199_3(int x) { return x * 3; }
+inline int f199_4(int x) { return x * 4; }
+inline int f199_5(int x) { return x * 5; }
+inline int f199_6(int x) { return x * 6; }
+inline int f199_7(int x) { return x * 7; }
+inline int f199_8(int x) { return x * 8; }
+inline int f199_9(int x) { return x * 9; }
+inline int f199_10(int x) { return x * 10; }
+inline int f199_11(int x) { return x * 11; }
+inline int f199_12(int x) { return x * 12; }
+inline int f199_13(int x) { return x * 13; }
+inline int f199_14(int x) { return x * 14; }
+inline int f199_15(int x) { return x * 15; }
+inline int f199_16(int x) { return x * 16; }
+inline int f199_17(int x) { return x * 17; }
+inline int f199_18(int x) { return x * 18; }
+inline int f199_19(int x) { return x * 19; }
+inline int f199_20(int x) { return x * 20; }
+inline int f199_21(int x) { return x * 21; }
+inline int f199_22(int x) { return x * 22; }
+inline int f199_23(int x) { return x * 23; }
+inline int f199_24(int x) { return x * 24; }
+inline int f199_25(int x) { return x * 25; }
+inline int f199_26(int x) { return x * 26; }
+inline int f199_27(int x) { return x * 27; }
+inline int f199_28(int x) { return x * 28; }
+inline int f199_29(int x) { return x * 29; }
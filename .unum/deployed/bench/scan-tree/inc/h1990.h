@@ -0,0 +1,42 @@
+#pragma once
+/* header 1990 */
+#include <vector>
+#include "h3581.h"
+#include "h1999.h"
+#include "h7720.h"
+#include "h5147.h"
+#include "h5718.h"
+#ifdef X
+#include "h8483.h"
+#endif
+struct S1990 { int a; const char *s = "x//y"; };
+inline int f1990_0(int x) { return x * 0; }
+inline int f1990_1(int x) { return x * 1; }
+inline int f1990_2(int x) { return x * 2; }
+inline int f1990_3(int x) { return x * 3; }
+inline int f1990_4(int x) { return x * 4; }
+inline int f1990_5(int x) { return x * 5; }
+inline int f1990_6(int x) { return x * 6; }
+inline int f1990_7(int x) { return x * 7; }
+inline int f1990_8(int x) { return x * 8; }
+inline int f1990_9(int x) { return x * 9; }
+inline int f1990_10(int x) { return x * 10; }
+inline int f1990_11(int x) { return x * 11; }
+inline int f1990_12(int x) { return x * 12; }
+inline int f1990_13(int x) { return x * 13; }
+inline int f1990_14(int x) { return x * 14; }
+inline int f1990_15(int x) { return x * 15; }
+inline int f1990_16(int x) { return x * 16; }
+inline int f1990_17(int x) { return x * 17; }
+inline int f1990_18(int x) { return x * 18; }
+inline int f1990_19(int x) { return x * 19; }
+inline int f1990_20(int x) { return x * 20; }
+inline int f1990_21(int x) { return x * 21; }
+inline int f1990_22(int x) { return x * 22; }
+inline int f1990_23(int x) { return x * 23; }
+inline int f1990_24(int x) { return x * 24; }
+inline int f1990_25(int x) { return x * 25; }
+inline int f1990_26(int x) { return x * 26; }
+inline int f1990_27(int x) { return x * 27; }
+inline int f1990_28(int x) { return x * 28; }
+inline int f1990_29(int x) { return x * 29; }
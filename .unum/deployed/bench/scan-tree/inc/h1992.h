@@ -0,0 +1,42 @@
+#pragma once
+/* header 1992 */
+#include <vector>
+#include "h3144.h"
+#include "h2397.h"
+#include "h3169.h"
+#include "h1353.h"
+#include "h7631.h"
+#ifdef X
+#include "h5702.h"
+#endif
+struct S1992 { int a; const char *s = "x//y"; };
+inline int f1992_0(int x) { return x * 0; }
+inline int f1992_1(int x) { return x * 1; }
+inline int f1992_2(int x) { return x * 2; }
+inline int f1992_3(int x) { return x * 3; }
+inline int f1992_4(int x) { return x * 4; }
+inline int f1992_5(int x) { return x * 5; }
+inline int f1992_6(int x) { return x * 6; }
+inline int f1992_7(int x) { return x * 7; }
+inline int f1992_8(int x) { return x * 8; }
+inline int f1992_9(int x) { return x * 9; }
+inline int f1992_10(int x) { return x * 10; }
+inline int f1992_11(int x) { return x * 11; }
+inline int f1992_12(int x) { return x * 12; }
+inline int f1992_13(int x) { return x * 13; }
+inline int f1992_14(int x) { return x * 14; }
+inline int f1992_15(int x) { return x * 15; }
+inline int f1992_16(int x) { return x * 16; }
+inline int f1992_17(int x) { return x * 17; }
+inline int f1992_18(int x) { return x * 18; }
+inline int f1992_19(int x) { return x * 19; }
+inline int f1992_20(int x) { return x * 20; }
+inline int f1992_21(int x) { return x * 21; }
+inline int f1992_22(int x) { return x * 22; }
+inline int f1992_23(int x) { return x * 23; }
+inline int f1992_24(int x) { return x * 24; }
+inline int f1992_25(int x) { return x * 25; }
+inline int f1992_26(int x) { return x * 26; }
+inline int f1992_27(int x) { return x * 27; }
+inline int f1992_28(int x) { return x * 28; }
+inline int f1992_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 1993 */
+#include <vector>
+#include "h6266.h"
+#include "h6591.h"
+#include "h797.h"
+#include "h8492.h"
+#include "h452.h"
+#ifdef X
+#include "h6566.h"
+#endif
+struct S1993 { int a; const char *s = "x//y"; };
+inline int f1993_0(int x) { return x * 0; }
+inline int f1993_1(int x) { return x * 1; }
+inline int f1993_2(int x) { return x * 2; }
+inline int f1993_3(int x) { return x * 3; }
+inline int f1993_4(int x) { return x * 4; }
+inline int f1993_5(int x) { return x * 5; }
+inline int f1993_6(int x) { return x * 6; }
+inline int f1993_7(int x) { return x * 7; }
+inline int f1993_8(int x) { return x * 8; }
+inline int f1993_9(int x) { return x * 9; }
+inline int f1993_10(int x) { return x * 10; }
+inline int f1993_11(int x) { return x * 11; }
+inline int f1993_12(int x) { return x * 12; }
+inline int f1993_13(int x) { return x * 13; }
+inline int f1993_14(int x) { return x * 14; }
+inline int f1993_15(int x) { return x * 15; }
+inline int f1993_16(int x) { return x * 16; }
+inline int f1993_17(int x) { return x * 17; }
+inline int f1993_18(int x) { return x * 18; }
+inline int f1993_19(int x) { return x * 19; }
+inline int f1993_20(int x) { return x * 20; }
+inline int f1993_21(int x) { return x * 21; }
+inline int f1993_22(int x) { return x * 22; }
+inline int f1993_23(int x) { return x * 23; }
+inline int f1993_24(int x) { return x * 24; }
+inline int f1993_25(int x) { return x * 25; }
+inline int f1993_26(int x) { return x * 26; }
+inline int f1993_27(int x) { return x * 27; }
+inline int f1993_28(int x) { return x * 28; }
+inline int f1993_29(int x) { return x * 29; }
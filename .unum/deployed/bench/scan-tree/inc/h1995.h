@@ -0,0 +1,42 @@
+#pragma once
+/* header 1995 */
+#include <vector>
+#include "h2288.h"
+#include "h1200.h"
+#include "h6590.h"
+#include "h9852.h"
+#include "h1872.h"
+#ifdef X
+#include "h330.h"
+#endif
+struct S1995 { int a; const char *s = "x//y"; };
+inline int f1995_0(int x) { return x * 0; }
+inline int f1995_1(int x) { return x * 1; }
+inline int f1995_2(int x) { return x * 2; }
+inline int f1995_3(int x) { return x * 3; }
+inline int f1995_4(int x) { return x * 4; }
+inline int f1995_5(int x) { return x * 5; }
+inline int f1995_6(int x) { return x * 6; }
+inline int f1995_7(int x) { return x * 7; }
+inline int f1995_8(int x) { return x * 8; }
+inline int f1995_9(int x) { return x * 9; }
+inline int f1995_10(int x) { return x * 10; }
+inline int f1995_11(int x) { return x * 11; }
+inline int f1995_12(int x) { return x * 12; }
+inline int f1995_13(int x) { return x * 13; }
+inline int f1995_14(int x) { return x * 14; }
+inline int f1995_15(int x) { return x * 15; }
+inline int f1995_16(int x) { return x * 16; }
+inline int f1995_17(int x) { return x * 17; }
+inline int f1995_18(int x) { return x * 18; }
+inline int f1995_19(int x) { return x * 19; }
+inline int f1995_20(int x) { return x * 20; }
+inline int f1995_21(int x) { return x * 21; }
+inline int f1995_22(int x) { return x * 22; }
+inline int f1995_23(int x) { return x * 23; }
+inline int f1995_24(int x) { return x * 24; }
+inline int f1995_25(int x) { return x * 25; }
+inline int f1995_26(int x) { return x * 26; }
+inline int f1995_27(int x) { return x * 27; }
+inline int f1995_28(int x) { return x * 28; }
+inline int f1995_29(int x) { return x * 29; }
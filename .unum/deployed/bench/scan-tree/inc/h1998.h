@@ -0,0 +1,42 @@
+#pragma once
+/* header 1998 */
+#include <vector>
+#include "h8583.h"
+#include "h478.h"
+#include "h1837.h"
+#include "h7306.h"
+#include "h3061.h"
+#ifdef X
+#include "h1853.h"
+#endif
+struct S1998 { int a; const char *s = "x//y"; };
+inline int f1998_0(int x) { return x * 0; }
+inline int f1998_1(int x) { return x * 1; }
+inline int f1998_2(int x) { return x * 2; }
+inline int f1998_3(int x) { return x * 3; }
+inline int f1998_4(int x) { return x * 4; }
+inline int f1998_5(int x) { return x * 5; }
+inline int f1998_6(int x) { return x * 6; }
+inline int f1998_7(int x) { return x * 7; }
+inline int f1998_8(int x) { return x * 8; }
+inline int f1998_9(int x) { return x * 9; }
+inline int f1998_10(int x) { return x * 10; }
+inline int f1998_11(int x) { return x * 11; }
+inline int f1998_12(int x) { return x * 12; }
+inline int f1998_13(int x) { return x * 13; }
+inline int f1998_14(int x) { return x * 14; }
+inline int f1998_15(int x) { return x * 15; }
+inline int f1998_16(int x) { return x * 16; }
+inline int f1998_17(int x) { return x * 17; }
+inline int f1998_18(int x) { return x * 18; }
+inline int f1998_19(int x) { return x * 19; }
+inline int f1998_20(int x) { return x * 20; }
+inline int f1998_21(int x) { return x * 21; }
+inline int f1998_22(int x) { return x * 22; }
+inline int f1998_23(int x) { return x * 23; }
+inline int f1998_24(int x) { return x * 24; }
+inline int f1998_25(int x) { return x * 25; }
+inline int f1998_26(int x) { return x * 26; }
+inline int f1998_27(int x) { return x * 27; }
+inline int f1998_28(int x) { return x * 28; }
+inline int f1998_29(int x) { return x * 29; }
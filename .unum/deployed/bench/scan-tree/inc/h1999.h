@@ -0,0 +1,42 @@
+#pragma once
+/* header 1999 */
+#include <vector>
+#include "h5494.h"
+#include "h7579.h"
+#include "h626.h"
+#include "h5947.h"
+#include "h2080.h"
+#ifdef X
+#include "h7584.h"
+#endif
+struct S1999 { int a; const char *s = "x//y"; };
+inline int f1999_0(int x) { return x * 0; }
+inline int f1999_1(int x) { return x * 1; }
+inline int f1999_2(int x) { return x * 2; }
+inline int f1999_3(int x) { return x * 3; }
+inline int f1999_4(int x) { return x * 4; }
+inline int f1999_5(int x) { return x * 5; }
+inline int f1999_6(int x) { return x * 6; }
+inline int f1999_7(int x) { return x * 7; }
+inline int f1999_8(int x) { return x * 8; }
+inline int f1999_9(int x) { return x * 9; }
+inline int f1999_10(int x) { return x * 10; }
+inline int f1999_11(int x) { return x * 11; }
+inline int f1999_12(int x) { return x * 12; }
+inline int f1999_13(int x) { return x * 13; }
+inline int f1999_14(int x) { return x * 14; }
+inline int f1999_15(int x) { return x * 15; }
+inline int f1999_16(int x) { return x * 16; }
+inline int f1999_17(int x) { return x * 17; }
+inline int f1999_18(int x) { return x * 18; }
+inline int f1999_19(int x) { return x * 19; }
+inline int f1999_20(int x) { return x * 20; }
+inline int f1999_21(int x) { return x * 21; }
+inline int f1999_22(int x) { return x * 22; }
+inline int f1999_23(int x) { return x * 23; }
+inline int f1999_24(int x) { return x * 24; }
+inline int f1999_25(int x) { return x * 25; }
+inline int f1999_26(int x) { return x * 26; }
+inline int f1999_27(int x) { return x * 27; }
+inline int f1999_28(int x) { return x * 28; }
+inline int f1999_29(int x) { return x * 29; }
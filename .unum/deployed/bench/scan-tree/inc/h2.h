@@ -0,0 +1,42 @@
+#pragma once
+/* header 2 */
+#include <vector>
+#include "h1314.h"
+#include "h8515.h"
+#include "h4380.h"
+#include "h5117.h"
+#include "h9260.h"
+#ifdef X
+#include "h3802.h"
+#endif
+struct S2 { int a; const char *s = "x//y"; };
+inline int f2_0(int x) { return x * 0; }
+inline int f2_1(int x) { return x * 1; }
+inline int f2_2(int x) { return x * 2; }
+inline int f2_3(int x) { return x * 3; }
+inline int f2_4(int x) { return x * 4; }
+inline int f2_5(int x) { return x * 5; }
+inline int f2_6(int x) { return x * 6; }
+inline int f2_7(int x) { return x * 7; }
+inline int f2_8(int x) { return x * 8; }
+inline int f2_9(int x) { return x * 9; }
+inline int f2_10(int x) { return x * 10; }
+inline int f2_11(int x) { return x * 11; }
+inline int f2_12(int x) { return x * 12; }
+inline int f2_13(int x) { return x * 13; }
+inline int f2_14(int x) { return x * 14; }
+inline int f2_15(int x) { return x * 15; }
+inline int f2_16(int x) { return x * 16; }
+inline int f2_17(int x) { return x * 17; }
+inline int f2_18(int x) { return x * 18; }
+inline int f2_19(int x) { return x * 19; }
+inline int f2_20(int x) { return x * 20; }
+inline int f2_21(int x) { return x * 21; }
+inline int f2_22(int x) { return x * 22; }
+inline int f2_23(int x) { return x * 23; }
+inline int f2_24(int x) { return x * 24; }
+inline int f2_25(int x) { return x * 25; }
+inline int f2_26(int x) { return x * 26; }
+inline int f2_27(int x) { return x * 27; }
+inline int f2_28(int x) { return x * 28; }
+inline int f2_29(int x) { return x * 29; }
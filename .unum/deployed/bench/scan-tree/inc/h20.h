@@ -0,0 +1,42 @@
+#pragma once
+/* header 20 */
+#include <vector>
+#include "h4992.h"
+#include "h5932.h"
+#include "h4746.h"
+#include "h4440.h"
+#include "h7573.h"
+#ifdef X
+#include "h75.h"
+#endif
+struct S20 { int a; const char *s = "x//y"; };
+inline int f20_0(int x) { return x * 0; }
+inline int f20_1(int x) { return x * 1; }
+inline int f20_2(int x) { return x * 2; }
+inline int f20_3(int x) { return x * 3; }
+inline int f20_4(int x) { return x * 4; }
+inline int f20_5(int x) { return x * 5; }
+inline int f20_6(int x) { return x * 6; }
+inline int f20_7(int x) { return x * 7; }
+inline int f20_8(int x) { return x * 8; }
+inline int f20_9(int x) { return x * 9; }
+inline int f20_10(int x) { return x * 10; }
+inline int f20_11(int x) { return x * 11; }
+inline int f20_12(int x) { return x * 12; }
+inline int f20_13(int x) { return x * 13; }
+inline int f20_14(int x) { return x * 14; }
+inline int f20_15(int x) { return x * 15; }
+inline int f20_16(int x) { return x * 16; }
+inline int f20_17(int x) { return x * 17; }
+inline int f20_18(int x) { return x * 18; }
+inline int f20_19(int x) { return x * 19; }
+inline int f20_20(int x) { return x * 20; }
+inline int f20_21(int x) { return x * 21; }
+inline int f20_22(int x) { return x * 22; }
+inline int f20_23(int x) { return x * 23; }
+inline int f20_24(int x) { return x * 24; }
+inline int f20_25(int x) { return x * 25; }
+inline int f20_26(int x) { return x * 26; }
+inline int f20_27(int x) { return x * 27; }
+inline int f20_28(int x) { return x * 28; }
+inline int f20_29(int x) { return x * 29; }
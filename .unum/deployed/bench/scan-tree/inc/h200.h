@@ -0,0 +1,42 @@
+#pragma once
+/* header 200 */
+#include <vector>
+#include "h501.h"
+#include "h7056.h"
+#include "h4221.h"
+#include "h9105.h"
+#include "h3224.h"
+#ifdef X
+#include "h2272.h"
+#endif
+struct S200 { int a; const char *s = "x//y"; };
+inline int f200_0(int x) { return x * 0; }
+inline int f200_1(int x) { return x * 1; }
+inline int f200_2(int x) { return x * 2; }
+inline int f200_3(int x) { return x * 3; }
+inline int f200_4(int x) { return x * 4; }
+inline int f200_5(int x) { return x * 5; }
+inline int f200_6(int x) { return x * 6; }
+inline int f200_7(int x) { return x * 7; }
+inline int f200_8(int x) { return x * 8; }
+inline int f200_9(int x) { return x * 9; }
+inline int f200_10(int x) { return x * 10; }
+inline int f200_11(int x) { return x * 11; }
+inline int f200_12(int x) { return x * 12; }
+inline int f200_13(int x) { return x * 13; }
+inline int f200_14(int x) { return x * 14; }
+inline int f200_15(int x) { return x * 15; }
+inline int f200_16(int x) { return x * 16; }
+inline int f200_17(int x) { return x * 17; }
+inline int f200_18(int x) { return x * 18; }
+inline int f200_19(int x) { return x * 19; }
+inline int f200_20(int x) { return x * 20; }
+inline int f200_21(int x) { return x * 21; }
+inline int f200_22(int x) { return x * 22; }
+inline int f200_23(int x) { return x * 23; }
+inline int f200_24(int x) { return x * 24; }
+inline int f200_25(int x) { return x * 25; }
+inline int f200_26(int x) { return x * 26; }
+inline int f200_27(int x) { return x * 27; }
+inline int f200_28(int x) { return x * 28; }
+inline int f200_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2003 */
+#include <vector>
+#include "h1360.h"
+#include "h7434.h"
+#include "h2089.h"
+#include "h9016.h"
+#include "h6925.h"
+#ifdef X
+#include "h366.h"
+#endif
+struct S2003 { int a; const char *s = "x//y"; };
+inline int f2003_0(int x) { return x * 0; }
+inline int f2003_1(int x) { return x * 1; }
+inline int f2003_2(int x) { return x * 2; }
+inline int f2003_3(int x) { return x * 3; }
+inline int f2003_4(int x) { return x * 4; }
+inline int f2003_5(int x) { return x * 5; }
+inline int f2003_6(int x) { return x * 6; }
+inline int f2003_7(int x) { return x * 7; }
+inline int f2003_8(int x) { return x * 8; }
+inline int f2003_9(int x) { return x * 9; }
+inline int f2003_10(int x) { return x * 10; }
+inline int f2003_11(int x) { return x * 11; }
+inline int f2003_12(int x) { return x * 12; }
+inline int f2003_13(int x) { return x * 13; }
+inline int f2003_14(int x) { return x * 14; }
+inline int f2003_15(int x) { return x * 15; }
+inline int f2003_16(int x) { return x * 16; }
+inline int f2003_17(int x) { return x * 17; }
+inline int f2003_18(int x) { return x * 18; }
+inline int f2003_19(int x) { return x * 19; }
+inline int f2003_20(int x) { return x * 20; }
+inline int f2003_21(int x) { return x * 21; }
+inline int f2003_22(int x) { return x * 22; }
+inline int f2003_23(int x) { return x * 23; }
+inline int f2003_24(int x) { return x * 24; }
+inline int f2003_25(int x) { return x * 25; }
+inline int f2003_26(int x) { return x * 26; }
+inline int f2003_27(int x) { return x * 27; }
+inline int f2003_28(int x) { return x * 28; }
+inline int f2003_29(int x) { return x * 29; }
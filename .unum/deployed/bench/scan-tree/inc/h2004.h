@@ -0,0 +1,42 @@
+#pragma once
+/* header 2004 */
+#include <vector>
+#include "h9036.h"
+#include "h8718.h"
+#include "h3083.h"
+#include "h6381.h"
+#include "h690.h"
+#ifdef X
+#include "h6981.h"
+#endif
+struct S2004 { int a; const char *s = "x//y"; };
+inline int f2004_0(int x) { return x * 0; }
+inline int f2004_1(int x) { return x * 1; }
+inline int f2004_2(int x) { return x * 2; }
+inline int f2004_3(int x) { return x * 3; }
+inline int f2004_4(int x) { return x * 4; }
+inline int f2004_5(int x) { return x * 5; }
+inline int f2004_6(int x) { return x * 6; }
+inline int f2004_7(int x) { return x * 7; }
+inline int f2004_8(int x) { return x * 8; }
+inline int f2004_9(int x) { return x * 9; }
+inline int f2004_10(int x) { return x * 10; }
+inline int f2004_11(int x) { return x * 11; }
+inline int f2004_12(int x) { return x * 12; }
+inline int f2004_13(int x) { return x * 13; }
+inline int f2004_14(int x) { return x * 14; }
+inline int f2004_15(int x) { return x * 15; }
+inline int f2004_16(int x) { return x * 16; }
+inline int f2004_17(int x) { return x * 17; }
+inline int f2004_18(int x) { return x * 18; }
+inline int f2004_19(int x) { return x * 19; }
+inline int f2004_20(int x) { return x * 20; }
+inline int f2004_21(int x) { return x * 21; }
+inline int f2004_22(int x) { return x * 22; }
+inline int f2004_23(int x) { return x * 23; }
+inline int f2004_24(int x) { return x * 24; }
+inline int f2004_25(int x) { return x * 25; }
+inline int f2004_26(int x) { return x * 26; }
+inline int f2004_27(int x) { return x * 27; }
+inline int f2004_28(int x) { return x * 28; }
+inline int f2004_29(int x) { return x * 29; }
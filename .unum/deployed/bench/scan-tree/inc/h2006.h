@@ -0,0 +1,42 @@
+#pragma once
+/* header 2006 */
+#include <vector>
+#include "h5410.h"
+#include "h2617.h"
+#include "h5014.h"
+#include "h3182.h"
+#include "h7112.h"
+#ifdef X
+#include "h1261.h"
+#endif
+struct S2006 { int a; const char *s = "x//y"; };
+inline int f2006_0(int x) { return x * 0; }
+inline int f2006_1(int x) { return x * 1; }
+inline int f2006_2(int x) { return x * 2; }
+inline int f2006_3(int x) { return x * 3; }
+inline int f2006_4(int x) { return x * 4; }
+inline int f2006_5(int x) { return x * 5; }
+inline int f2006_6(int x) { return x * 6; }
+inline int f2006_7(int x) { return x * 7; }
+inline int f2006_8(int x) { return x * 8; }
+inline int f2006_9(int x) { return x * 9; }
+inline int f2006_10(int x) { return x * 10; }
+inline int f2006_11(int x) { return x * 11; }
+inline int f2006_12(int x) { return x * 12; }
+inline int f2006_13(int x) { return x * 13; }
+inline int f2006_14(int x) { return x * 14; }
+inline int f2006_15(int x) { return x * 15; }
+inline int f2006_16(int x) { return x * 16; }
+inline int f2006_17(int x) { return x * 17; }
+inline int f2006_18(int x) { return x * 18; }
+inline int f2006_19(int x) { return x * 19; }
+inline int f2006_20(int x) { return x * 20; }
+inline int f2006_21(int x) { return x * 21; }
+inline int f2006_22(int x) { return x * 22; }
+inline int f2006_23(int x) { return x * 23; }
+inline int f2006_24(int x) { return x * 24; }
+inline int f2006_25(int x) { return x * 25; }
+inline int f2006_26(int x) { return x * 26; }
+inline int f2006_27(int x) { return x * 27; }
+inline int f2006_28(int x) { return x * 28; }
+inline int f2006_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2007 */
+#include <vector>
+#include "h1040.h"
+#include "h110.h"
+#include "h6162.h"
+#include "h337.h"
+#include "h4093.h"
+#ifdef X
+#include "h9150.h"
+#endif
+struct S2007 { int a; const char *s = "x//y"; };
+inline int f2007_0(int x) { return x * 0; }
+inline int f2007_1(int x) { return x * 1; }
+inline int f2007_2(int x) { return x * 2; }
+inline int f2007_3(int x) { return x * 3; }
+inline int f2007_4(int x) { return x * 4; }
+inline int f2007_5(int x) { return x * 5; }
+inline int f2007_6(int x) { return x * 6; }
+inline int f2007_7(int x) { return x * 7; }
+inline int f2007_8(int x) { return x * 8; }
+inline int f2007_9(int x) { return x * 9; }
+inline int f2007_10(int x) { return x * 10; }
+inline int f2007_11(int x) { return x * 11; }
+inline int f2007_12(int x) { return x * 12; }
+inline int f2007_13(int x) { return x * 13; }
+inline int f2007_14(int x) { return x * 14; }
+inline int f2007_15(int x) { return x * 15; }
+inline int f2007_16(int x) { return x * 16; }
+inline int f2007_17(int x) { return x * 17; }
+inline int f2007_18(int x) { return x * 18; }
+inline int f2007_19(int x) { return x * 19; }
+inline int f2007_20(int x) { return x * 20; }
+inline int f2007_21(int x) { return x * 21; }
+inline int f2007_22(int x) { return x * 22; }
+inline int f2007_23(int x) { return x * 23; }
+inline int f2007_24(int x) { return x * 24; }
+inline int f2007_25(int x) { return x * 25; }
+inline int f2007_26(int x) { return x * 26; }
+inline int f2007_27(int x) { return x * 27; }
+inline int f2007_28(int x) { return x * 28; }
+inline int f2007_29(int x) { return x * 29; }
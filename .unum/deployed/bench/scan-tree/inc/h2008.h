@@ -0,0 +1,42 @@
+#pragma once
+/* header 2008 */
+#include <vector>
+#include "h7802.h"
+#include "h3993.h"
+#include "h2156.h"
+#include "h1688.h"
+#include "h3376.h"
+#ifdef X
+#include "h1267.h"
+#endif
+struct S2008 { int a; const char *s = "x//y"; };
+inline int f2008_0(int x) { return x * 0; }
+inline int f2008_1(int x) { return x * 1; }
+inline int f2008_2(int x) { return x * 2; }
+inline int f2008_3(int x) { return x * 3; }
+inline int f2008_4(int x) { return x * 4; }
+inline int f2008_5(int x) { return x * 5; }
+inline int f2008_6(int x) { return x * 6; }
+inline int f2008_7(int x) { return x * 7; }
+inline int f2008_8(int x) { return x * 8; }
+inline int f2008_9(int x) { return x * 9; }
+inline int f2008_10(int x) { return x * 10; }
+inline int f2008_11(int x) { return x * 11; }
+inline int f2008_12(int x) { return x * 12; }
+inline int f2008_13(int x) { return x * 13; }
+inline int f2008_14(int x) { return x * 14; }
+inline int f2008_15(int x) { return x * 15; }
+inline int f2008_16(int x) { return x * 16; }
+inline int f2008_17(int x) { return x * 17; }
+inline int f2008_18(int x) { return x * 18; }
+inline int f2008_19(int x) { return x * 19; }
+inline int f2008_20(int x) { return x * 20; }
+inline int f2008_21(int x) { return x * 21; }
+inline int f2008_22(int x) { return x * 22; }
+inline int f2008_23(int x) { return x * 23; }
+inline int f2008_24(int x) { return x * 24; }
+inline int f2008_25(int x) { return x * 25; }
+inline int f2008_26(int x) { return x * 26; }
+inline int f2008_27(int x) { return x * 27; }
+inline int f2008_28(int x) { return x * 28; }
+inline int f2008_29(int x) { return x * 29; }
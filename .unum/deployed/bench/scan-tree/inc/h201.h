@@ -0,0 +1,42 @@
+#pragma once
+/* header 201 */
+#include <vector>
+#include "h6795.h"
+#include "h3179.h"
+#include "h4487.h"
+#include "h3280.h"
+#include "h2520.h"
+#ifdef X
+#include "h3495.h"
+#endif
+struct S201 { int a; const char *s = "x//y"; };
+inline int f201_0(int x) { return x * 0; }
+inline int f201_1(int x) { return x * 1; }
+inline int f201_2(int x) { return x * 2; }
+inline int f201_3(int x) { return x * 3; }
+inline int f201_4(int x) { return x * 4; }
+inline int f201_5(int x) { return x * 5; }
+inline int f201_6(int x) { return x * 6; }
+inline int f201_7(int x) { return x * 7; }
+inline int f201_8(int x) { return x * 8; }
+inline int f201_9(int x) { return x * 9; }
+inline int f201_10(int x) { return x * 10; }
+inline int f201_11(int x) { return x * 11; }
+inline int f201_12(int x) { return x * 12; }
+inline int f201_13(int x) { return x * 13; }
+inline int f201_14(int x) { return x * 14; }
+inline int f201_15(int x) { return x * 15; }
+inline int f201_16(int x) { return x * 16; }
+inline int f201_17(int x) { return x * 17; }
+inline int f201_18(int x) { return x * 18; }
+inline int f201_19(int x) { return x * 19; }
+inline int f201_20(int x) { return x * 20; }
+inline int f201_21(int x) { return x * 21; }
+inline int f201_22(int x) { return x * 22; }
+inline int f201_23(int x) { return x * 23; }
+inline int f201_24(int x) { return x * 24; }
+inline int f201_25(int x) { return x * 25; }
+inline int f201_26(int x) { return x * 26; }
+inline int f201_27(int x) { return x * 27; }
+inline int f201_28(int x) { return x * 28; }
+inline int f201_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2012 */
+#include <vector>
+#include "h2232.h"
+#include "h9604.h"
+#include "h8314.h"
+#include "h2349.h"
+#include "h4457.h"
+#ifdef X
+#include "h8426.h"
+#endif
+struct S2012 { int a; const char *s = "x//y"; };
+inline int f2012_0(int x) { return x * 0; }
+inline int f2012_1(int x) { return x * 1; }
+inline int f2012_2(int x) { return x * 2; }
+inline int f2012_3(int x) { return x * 3; }
+inline int f2012_4(int x) { return x * 4; }
+inline int f2012_5(int x) { return x * 5; }
+inline int f2012_6(int x) { return x * 6; }
+inline int f2012_7(int x) { return x * 7; }
+inline int f2012_8(int x) { return x * 8; }
+inline int f2012_9(int x) { return x * 9; }
+inline int f2012_10(int x) { return x * 10; }
+inline int f2012_11(int x) { return x * 11; }
+inline int f2012_12(int x) { return x * 12; }
+inline int f2012_13(int x) { return x * 13; }
+inline int f2012_14(int x) { return x * 14; }
+inline int f2012_15(int x) { return x * 15; }
+inline int f2012_16(int x) { return x * 16; }
+inline int f2012_17(int x) { return x * 17; }
+inline int f2012_18(int x) { return x * 18; }
+inline int f2012_19(int x) { return x * 19; }
+inline int f2012_20(int x) { return x * 20; }
+inline int f2012_21(int x) { return x * 21; }
+inline int f2012_22(int x) { return x * 22; }
+inline int f2012_23(int x) { return x * 23; }
+inline int f2012_24(int x) { return x * 24; }
+inline int f2012_25(int x) { return x * 25; }
+inline int f2012_26(int x) { return x * 26; }
+inline int f2012_27(int x) { return x * 27; }
+inline int f2012_28(int x) { return x * 28; }
+inline int f2012_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2013 */
+#include <vector>
+#include "h8315.h"
+#include "h2987.h"
+#include "h1204.h"
+#include "h6271.h"
+#include "h2468.h"
+#ifdef X
+#include "h7472.h"
+#endif
+struct S2013 { int a; const char *s = "x//y"; };
+inline int f2013_0(int x) { return x * 0; }
+inline int f2013_1(int x) { return x * 1; }
+inline int f2013_2(int x) { return x * 2; }
+inline int f2013_3(int x) { return x * 3; }
+inline int f2013_4(int x) { return x * 4; }
+inline int f2013_5(int x) { return x * 5; }
+inline int f2013_6(int x) { return x * 6; }
+inline int f2013_7(int x) { return x * 7; }
+inline int f2013_8(int x) { return x * 8; }
+inline int f2013_9(int x) { return x * 9; }
+inline int f2013_10(int x) { return x * 10; }
+inline int f2013_11(int x) { return x * 11; }
+inline int f2013_12(int x) { return x * 12; }
+inline int f2013_13(int x) { return x * 13; }
+inline int f2013_14(int x) { return x * 14; }
+inline int f2013_15(int x) { return x * 15; }
+inline int f2013_16(int x) { return x * 16; }
+inline int f2013_17(int x) { return x * 17; }
+inline int f2013_18(int x) { return x * 18; }
+inline int f2013_19(int x) { return x * 19; }
+inline int f2013_20(int x) { return x * 20; }
+inline int f2013_21(int x) { return x * 21; }
+inline int f2013_22(int x) { return x * 22; }
+inline int f2013_23(int x) { return x * 23; }
+inline int f2013_24(int x) { return x * 24; }
+inline int f2013_25(int x) { return x * 25; }
+inline int f2013_26(int x) { return x * 26; }
+inline int f2013_27(int x) { return x * 27; }
+inline int f2013_28(int x) { return x * 28; }
+inline int f2013_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2015 */
+#include <vector>
+#include "h8900.h"
+#include "h7669.h"
+#include "h1414.h"
+#include "h7987.h"
+#include "h9293.h"
+#ifdef X
+#include "h9922.h"
+#endif
+struct S2015 { int a; const char *s = "x//y"; };
+inline int f2015_0(int x) { return x * 0; }
+inline int f2015_1(int x) { return x * 1; }
+inline int f2015_2(int x) { return x * 2; }
+inline int f2015_3(int x) { return x * 3; }
+inline int f2015_4(int x) { return x * 4; }
+inline int f2015_5(int x) { return x * 5; }
+inline int f2015_6(int x) { return x * 6; }
+inline int f2015_7(int x) { return x * 7; }
+inline int f2015_8(int x) { return x * 8; }
+inline int f2015_9(int x) { return x * 9; }
+inline int f2015_10(int x) { return x * 10; }
+inline int f2015_11(int x) { return x * 11; }
+inline int f2015_12(int x) { return x * 12; }
+inline int f2015_13(int x) { return x * 13; }
+inline int f2015_14(int x) { return x * 14; }
+inline int f2015_15(int x) { return x * 15; }
+inline int f2015_16(int x) { return x * 16; }
+inline int f2015_17(int x) { return x * 17; }
+inline int f2015_18(int x) { return x * 18; }
+inline int f2015_19(int x) { return x * 19; }
+inline int f2015_20(int x) { return x * 20; }
+inline int f2015_21(int x) { return x * 21; }
+inline int f2015_22(int x) { return x * 22; }
+inline int f2015_23(int x) { return x * 23; }
+inline int f2015_24(int x) { return x * 24; }
+inline int f2015_25(int x) { return x * 25; }
+inline int f2015_26(int x) { return x * 26; }
+inline int f2015_27(int x) { return x * 27; }
+inline int f2015_28(int x) { return x * 28; }
+inline int f2015_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2017 */
+#include <vector>
+#include "h8741.h"
+#include "h3768.h"
+#include "h6493.h"
+#include "h4723.h"
+#include "h8579.h"
+#ifdef X
+#include "h8407.h"
+#endif
+struct S2017 { int a; const char *s = "x//y"; };
+inline int f2017_0(int x) { return x * 0; }
+inline int f2017_1(int x) { return x * 1; }
+inline int f2017_2(int x) { return x * 2; }
+inline int f2017_3(int x) { return x * 3; }
+inline int f2017_4(int x) { return x * 4; }
+inline int f2017_5(int x) { return x * 5; }
+inline int f2017_6(int x) { return x * 6; }
+inline int f2017_7(int x) { return x * 7; }
+inline int f2017_8(int x) { return x * 8; }
+inline int f2017_9(int x) { return x * 9; }
+inline int f2017_10(int x) { return x * 10; }
+inline int f2017_11(int x) { return x * 11; }
+inline int f2017_12(int x) { return x * 12; }
+inline int f2017_13(int x) { return x * 13; }
+inline int f2017_14(int x) { return x * 14; }
+inline int f2017_15(int x) { return x * 15; }
+inline int f2017_16(int x) { return x * 16; }
+inline int f2017_17(int x) { return x * 17; }
+inline int f2017_18(int x) { return x * 18; }
+inline int f2017_19(int x) { return x * 19; }
+inline int f2017_20(int x) { return x * 20; }
+inline int f2017_21(int x) { return x * 21; }
+inline int f2017_22(int x) { return x * 22; }
+inline int f2017_23(int x) { return x * 23; }
+inline int f2017_24(int x) { return x * 24; }
+inline int f2017_25(int x) { return x * 25; }
+inline int f2017_26(int x) { return x * 26; }
+inline int f2017_27(int x) { return x * 27; }
+inline int f2017_28(int x) { return x * 28; }
+inline int f2017_29(int x) { return x * 29; }
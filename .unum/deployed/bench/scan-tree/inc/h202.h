@@ -0,0 +1,42 @@
+#pragma once
+/* header 202 */
+#include <vector>
+#include "h6453.h"
+#include "h2092.h"
+#include "h3281.h"
+#include "h1824.h"
+#include "h6558.h"
+#ifdef X
+#include "h4380.h"
+#endif
+struct S202 { int a; const char *s = "x//y"; };
+inline int f202_0(int x) { return x * 0; }
+inline int f202_1(int x) { return x * 1; }
+inline int f202_2(int x) { return x * 2; }
+inline int f202_3(int x) { return x * 3; }
+inline int f202_4(int x) { return x * 4; }
+inline int f202_5(int x) { return x * 5; }
+inline int f202_6(int x) { return x * 6; }
+inline int f202_7(int x) { return x * 7; }
+inline int f202_8(int x) { return x * 8; }
+inline int f202_9(int x) { return x * 9; }
+inline int f202_10(int x) { return x * 10; }
+inline int f202_11(int x) { return x * 11; }
+inline int f202_12(int x) { return x * 12; }
+inline int f202_13(int x) { return x * 13; }
+inline int f202_14(int x) { return x * 14; }
+inline int f202_15(int x) { return x * 15; }
+inline int f202_16(int x) { return x * 16; }
+inline int f202_17(int x) { return x * 17; }
+inline int f202_18(int x) { return x * 18; }
+inline int f202_19(int x) { return x * 19; }
+inline int f202_20(int x) { return x * 20; }
+inline int f202_21(int x) { return x * 21; }
+inline int f202_22(int x) { return x * 22; }
+inline int f202_23(int x) { return x * 23; }
+inline int f202_24(int x) { return x * 24; }
+inline int f202_25(int x) { return x * 25; }
+inline int f202_26(int x) { return x * 26; }
+inline int f202_27(int x) { return x * 27; }
+inline int f202_28(int x) { return x * 28; }
+inline int f202_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2020 */
+#include <vector>
+#include "h6847.h"
+#include "h2725.h"
+#include "h1616.h"
+#include "h2975.h"
+#include "h6506.h"
+#ifdef X
+#include "h3815.h"
+#endif
+struct S2020 { int a; const char *s = "x//y"; };
+inline int f2020_0(int x) { return x * 0; }
+inline int f2020_1(int x) { return x * 1; }
+inline int f2020_2(int x) { return x * 2; }
+inline int f2020_3(int x) { return x * 3; }
+inline int f2020_4(int x) { return x * 4; }
+inline int f2020_5(int x) { return x * 5; }
+inline int f2020_6(int x) { return x * 6; }
+inline int f2020_7(int x) { return x * 7; }
+inline int f2020_8(int x) { return x * 8; }
+inline int f2020_9(int x) { return x * 9; }
+inline int f2020_10(int x) { return x * 10; }
+inline int f2020_11(int x) { return x * 11; }
+inline int f2020_12(int x) { return x * 12; }
+inline int f2020_13(int x) { return x * 13; }
+inline int f2020_14(int x) { return x * 14; }
+inline int f2020_15(int x) { return x * 15; }
+inline int f2020_16(int x) { return x * 16; }
+inline int f2020_17(int x) { return x * 17; }
+inline int f2020_18(int x) { return x * 18; }
+inline int f2020_19(int x) { return x * 19; }
+inline int f2020_20(int x) { return x * 20; }
+inline int f2020_21(int x) { return x * 21; }
+inline int f2020_22(int x) { return x * 22; }
+inline int f2020_23(int x) { return x * 23; }
+inline int f2020_24(int x) { return x * 24; }
+inline int f2020_25(int x) { return x * 25; }
+inline int f2020_26(int x) { return x * 26; }
+inline int f2020_27(int x) { return x * 27; }
+inline int f2020_28(int x) { return x * 28; }
+inline int f2020_29(int x) { return x * 29; }
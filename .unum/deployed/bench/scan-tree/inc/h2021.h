@@ -0,0 +1,42 @@
+#pragma once
+/* header 2021 */
+#include <vector>
+#include "h2797.h"
+#include "h2211.h"
+#include "h1301.h"
+#include "h5078.h"
+#include "h6424.h"
+#ifdef X
+#include "h2904.h"
+#endif
+struct S2021 { int a; const char *s = "x//y"; };
+inline int f2021_0(int x) { return x * 0; }
+inline int f2021_1(int x) { return x * 1; }
+inline int f2021_2(int x) { return x * 2; }
+inline int f2021_3(int x) { return x * 3; }
+inline int f2021_4(int x) { return x * 4; }
+inline int f2021_5(int x) { return x * 5; }
+inline int f2021_6(int x) { return x * 6; }
+inline int f2021_7(int x) { return x * 7; }
+inline int f2021_8(int x) { return x * 8; }
+inline int f2021_9(int x) { return x * 9; }
+inline int f2021_10(int x) { return x * 10; }
+inline int f2021_11(int x) { return x * 11; }
+inline int f2021_12(int x) { return x * 12; }
+inline int f2021_13(int x) { return x * 13; }
+inline int f2021_14(int x) { return x * 14; }
+inline int f2021_15(int x) { return x * 15; }
+inline int f2021_16(int x) { return x * 16; }
+inline int f2021_17(int x) { return x * 17; }
+inline int f2021_18(int x) { return x * 18; }
+inline int f2021_19(int x) { return x * 19; }
+inline int f2021_20(int x) { return x * 20; }
+inline int f2021_21(int x) { return x * 21; }
+inline int f2021_22(int x) { return x * 22; }
+inline int f2021_23(int x) { return x * 23; }
+inline int f2021_24(int x) { return x * 24; }
+inline int f2021_25(int x) { return x * 25; }
+inline int f2021_26(int x) { return x * 26; }
+inline int f2021_27(int x) { return x * 27; }
+inline int f2021_28(int x) { return x * 28; }
+inline int f2021_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2022 */
+#include <vector>
+#include "h5388.h"
+#include "h1345.h"
+#include "h1667.h"
+#include "h4903.h"
+#include "h5839.h"
+#ifdef X
+#include "h9530.h"
+#endif
+struct S2022 { int a; const char *s = "x//y"; };
+inline int f2022_0(int x) { return x * 0; }
+inline int f2022_1(int x) { return x * 1; }
+inline int f2022_2(int x) { return x * 2; }
+inline int f2022_3(int x) { return x * 3; }
+inline int f2022_4(int x) { return x * 4; }
+inline int f2022_5(int x) { return x * 5; }
+inline int f2022_6(int x) { return x * 6; }
+inline int f2022_7(int x) { return x * 7; }
+inline int f2022_8(int x) { return x * 8; }
+inline int f2022_9(int x) { return x * 9; }
+inline int f2022_10(int x) { return x * 10; }
+inline int f2022_11(int x) { return x * 11; }
+inline int f2022_12(int x) { return x * 12; }
+inline int f2022_13(int x) { return x * 13; }
+inline int f2022_14(int x) { return x * 14; }
+inline int f2022_15(int x) { return x * 15; }
+inline int f2022_16(int x) { return x * 16; }
+inline int f2022_17(int x) { return x * 17; }
+inline int f2022_18(int x) { return x * 18; }
+inline int f2022_19(int x) { return x * 19; }
+inline int f2022_20(int x) { return x * 20; }
+inline int f2022_21(int x) { return x * 21; }
+inline int f2022_22(int x) { return x * 22; }
+inline int f2022_23(int x) { return x * 23; }
+inline int f2022_24(int x) { return x * 24; }
+inline int f2022_25(int x) { return x * 25; }
+inline int f2022_26(int x) { return x * 26; }
+inline int f2022_27(int x) { return x * 27; }
+inline int f2022_28(int x) { return x * 28; }
+inline int f2022_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2026 */
+#include <vector>
+#include "h8990.h"
+#include "h8418.h"
+#include "h244.h"
+#include "h2757.h"
+#include "h5075.h"
+#ifdef X
+#include "h3312.h"
+#endif
+struct S2026 { int a; const char *s = "x//y"; };
+inline int f2026_0(int x) { return x * 0; }
+inline int f2026_1(int x) { return x * 1; }
+inline int f2026_2(int x) { return x * 2; }
+inline int f2026_3(int x) { return x * 3; }
+inline int f2026_4(int x) { return x * 4; }
+inline int f2026_5(int x) { return x * 5; }
+inline int f2026_6(int x) { return x * 6; }
+inline int f2026_7(int x) { return x * 7; }
+inline int f2026_8(int x) { return x * 8; }
+inline int f2026_9(int x) { return x * 9; }
+inline int f2026_10(int x) { return x * 10; }
+inline int f2026_11(int x) { return x * 11; }
+inline int f2026_12(int x) { return x * 12; }
+inline int f2026_13(int x) { return x * 13; }
+inline int f2026_14(int x) { return x * 14; }
+inline int f2026_15(int x) { return x * 15; }
+inline int f2026_16(int x) { return x * 16; }
+inline int f2026_17(int x) { return x * 17; }
+inline int f2026_18(int x) { return x * 18; }
+inline int f2026_19(int x) { return x * 19; }
+inline int f2026_20(int x) { return x * 20; }
+inline int f2026_21(int x) { return x * 21; }
+inline int f2026_22(int x) { return x * 22; }
+inline int f2026_23(int x) { return x * 23; }
+inline int f2026_24(int x) { return x * 24; }
+inline int f2026_25(int x) { return x * 25; }
+inline int f2026_26(int x) { return x * 26; }
+inline int f2026_27(int x) { return x * 27; }
+inline int f2026_28(int x) { return x * 28; }
+inline int f2026_29(int x) { return x * 29; }
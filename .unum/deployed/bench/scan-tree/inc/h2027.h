@@ -0,0 +1,42 @@
+#pragma once
+/* header 2027 */
+#include <vector>
+#include "h1612.h"
+#include "h6398.h"
+#include "h8580.h"
+#include "h6390.h"
+#include "h9784.h"
+#ifdef X
+#include "h5824.h"
+#endif
+struct S2027 { int a; const char *s = "x//y"; };
+inline int f2027_0(int x) { return x * 0; }
+inline int f2027_1(int x) { return x * 1; }
+inline int f2027_2(int x) { return x * 2; }
+inline int f2027_3(int x) { return x * 3; }
+inline int f2027_4(int x) { return x * 4; }
+inline int f2027_5(int x) { return x * 5; }
+inline int f2027_6(int x) { return x * 6; }
+inline int f2027_7(int x) { return x * 7; }
+inline int f2027_8(int x) { return x * 8; }
+inline int f2027_9(int x) { return x * 9; }
+inline int f2027_10(int x) { return x * 10; }
+inline int f2027_11(int x) { return x * 11; }
+inline int f2027_12(int x) { return x * 12; }
+inline int f2027_13(int x) { return x * 13; }
+inline int f2027_14(int x) { return x * 14; }
+inline int f2027_15(int x) { return x * 15; }
+inline int f2027_16(int x) { return x * 16; }
+inline int f2027_17(int x) { return x * 17; }
+inline int f2027_18(int x) { return x * 18; }
+inline int f2027_19(int x) { return x * 19; }
+inline int f2027_20(int x) { return x * 20; }
+inline int f2027_21(int x) { return x * 21; }
+inline int f2027_22(int x) { return x * 22; }
+inline int f2027_23(int x) { return x * 23; }
+inline int f2027_24(int x) { return x * 24; }
+inline int f2027_25(int x) { return x * 25; }
+inline int f2027_26(int x) { return x * 26; }
+inline int f2027_27(int x) { return x * 27; }
+inline int f2027_28(int x) { return x * 28; }
+inline int f2027_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2029 */
+#include <vector>
+#include "h4201.h"
+#include "h2188.h"
+#include "h6636.h"
+#include "h4985.h"
+#include "h979.h"
+#ifdef X
+#include "h5782.h"
+#endif
+struct S2029 { int a; const char *s = "x//y"; };
+inline int f2029_0(int x) { return x * 0; }
+inline int f2029_1(int x) { return x * 1; }
+inline int f2029_2(int x) { return x * 2; }
+inline int f2029_3(int x) { return x * 3; }
+inline int f2029_4(int x) { return x * 4; }
+inline int f2029_5(int x) { return x * 5; }
+inline int f2029_6(int x) { return x * 6; }
+inline int f2029_7(int x) { return x * 7; }
+inline int f2029_8(int x) { return x * 8; }
+inline int f2029_9(int x) { return x * 9; }
+inline int f2029_10(int x) { return x * 10; }
+inline int f2029_11(int x) { return x * 11; }
+inline int f2029_12(int x) { return x * 12; }
+inline int f2029_13(int x) { return x * 13; }
+inline int f2029_14(int x) { return x * 14; }
+inline int f2029_15(int x) { return x * 15; }
+inline int f2029_16(int x) { return x * 16; }
+inline int f2029_17(int x) { return x * 17; }
+inline int f2029_18(int x) { return x * 18; }
+inline int f2029_19(int x) { return x * 19; }
+inline int f2029_20(int x) { return x * 20; }
+inline int f2029_21(int x) { return x * 21; }
+inline int f2029_22(int x) { return x * 22; }
+inline int f2029_23(int x) { return x * 23; }
+inline int f2029_24(int x) { return x * 24; }
+inline int f2029_25(int x) { return x * 25; }
+inline int f2029_26(int x) { return x * 26; }
+inline int f2029_27(int x) { return x * 27; }
+inline int f2029_28(int x) { return x * 28; }
+inline int f2029_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 203 */
+#include <vector>
+#include "h3025.h"
+#include "h6253.h"
+#include "h3280.h"
+#include "h824.h"
+#include "h967.h"
+#ifdef X
+#include "h4293.h"
+#endif
+struct S203 { int a; const char *s = "x//y"; };
+inline int f203_0(int x) { return x * 0; }
+inline int f203_1(int x) { return x * 1; }
+inline int f203_2(int x) { return x * 2; }
+inline int f203_3(int x) { return x * 3; }
+inline int f203_4(int x) { return x * 4; }
+inline int f203_5(int x) { return x * 5; }
+inline int f203_6(int x) { return x * 6; }
+inline int f203_7(int x) { return x * 7; }
+inline int f203_8(int x) { return x * 8; }
+inline int f203_9(int x) { return x * 9; }
+inline int f203_10(int x) { return x * 10; }
+inline int f203_11(int x) { return x * 11; }
+inline int f203_12(int x) { return x * 12; }
+inline int f203_13(int x) { return x * 13; }
+inline int f203_14(int x) { return x * 14; }
+inline int f203_15(int x) { return x * 15; }
+inline int f203_16(int x) { return x * 16; }
+inline int f203_17(int x) { return x * 17; }
+inline int f203_18(int x) { return x * 18; }
+inline int f203_19(int x) { return x * 19; }
+inline int f203_20(int x) { return x * 20; }
+inline int f203_21(int x) { return x * 21; }
+inline int f203_22(int x) { return x * 22; }
+inline int f203_23(int x) { return x * 23; }
+inline int f203_24(int x) { return x * 24; }
+inline int f203_25(int x) { return x * 25; }
+inline int f203_26(int x) { return x * 26; }
+inline int f203_27(int x) { return x * 27; }
+inline int f203_28(int x) { return x * 28; }
+inline int f203_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2032 */
+#include <vector>
+#include "h4555.h"
+#include "h1047.h"
+#include "h7373.h"
+#include "h7320.h"
+#include "h1804.h"
+#ifdef X
+#include "h4498.h"
+#endif
+struct S2032 { int a; const char *s = "x//y"; };
+inline int f2032_0(int x) { return x * 0; }
+inline int f2032_1(int x) { return x * 1; }
+inline int f2032_2(int x) { return x * 2; }
+inline int f2032_3(int x) { return x * 3; }
+inline int f2032_4(int x) { return x * 4; }
+inline int f2032_5(int x) { return x * 5; }
+inline int f2032_6(int x) { return x * 6; }
+inline int f2032_7(int x) { return x * 7; }
+inline int f2032_8(int x) { return x * 8; }
+inline int f2032_9(int x) { return x * 9; }
+inline int f2032_10(int x) { return x * 10; }
+inline int f2032_11(int x) { return x * 11; }
+inline int f2032_12(int x) { return x * 12; }
+inline int f2032_13(int x) { return x * 13; }
+inline int f2032_14(int x) { return x * 14; }
+inline int f2032_15(int x) { return x * 15; }
+inline int f2032_16(int x) { return x * 16; }
+inline int f2032_17(int x) { return x * 17; }
+inline int f2032_18(int x) { return x * 18; }
+inline int f2032_19(int x) { return x * 19; }
+inline int f2032_20(int x) { return x * 20; }
+inline int f2032_21(int x) { return x * 21; }
+inline int f2032_22(int x) { return x * 22; }
+inline int f2032_23(int x) { return x * 23; }
+inline int f2032_24(int x) { return x * 24; }
+inline int f2032_25(int x) { return x * 25; }
+inline int f2032_26(int x) { return x * 26; }
+inline int f2032_27(int x) { return x * 27; }
+inline int f2032_28(int x) { return x * 28; }
+inline int f2032_29(int x) { return x * 29; }
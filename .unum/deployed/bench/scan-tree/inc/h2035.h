@@ -0,0 +1,42 @@
+#pragma once
+/* header 2035 */
+#include <vector>
+#include "h8680.h"
+#include "h9020.h"
+#include "h6931.h"
+#include "h7213.h"
+#include "h7687.h"
+#ifdef X
+#include "h2559.h"
+#endif
+struct S2035 { int a; const char *s = "x//y"; };
+inline int f2035_0(int x) { return x * 0; }
+inline int f2035_1(int x) { return x * 1; }
+inline int f2035_2(int x) { return x * 2; }
+inline int f2035_3(int x) { return x * 3; }
+inline int f2035_4(int x) { return x * 4; }
+inline int f2035_5(int x) { return x * 5; }
+inline int f2035_6(int x) { return x * 6; }
+inline int f2035_7(int x) { return x * 7; }
+inline int f2035_8(int x) { return x * 8; }
+inline int f2035_9(int x) { return x * 9; }
+inline int f2035_10(int x) { return x * 10; }
+inline int f2035_11(int x) { return x * 11; }
+inline int f2035_12(int x) { return x * 12; }
+inline int f2035_13(int x) { return x * 13; }
+inline int f2035_14(int x) { return x * 14; }
+inline int f2035_15(int x) { return x * 15; }
+inline int f2035_16(int x) { return x * 16; }
+inline int f2035_17(int x) { return x * 17; }
+inline int f2035_18(int x) { return x * 18; }
+inline int f2035_19(int x) { return x * 19; }
+inline int f2035_20(int x) { return x * 20; }
+inline int f2035_21(int x) { return x * 21; }
+inline int f2035_22(int x) { return x * 22; }
+inline int f2035_23(int x) { return x * 23; }
+inline int f2035_24(int x) { return x * 24; }
+inline int f2035_25(int x) { return x * 25; }
+inline int f2035_26(int x) { return x * 26; }
+inline int f2035_27(int x) { return x * 27; }
+inline int f2035_28(int x) { return x * 28; }
+inline int f2035_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2037 */
+#include <vector>
+#include "h6422.h"
+#include "h5965.h"
+#include "h813.h"
+#include "h8361.h"
+#include "h321.h"
+#ifdef X
+#include "h8941.h"
+#endif
+struct S2037 { int a; const char *s = "x//y"; };
+inline int f2037_0(int x) { return x * 0; }
+inline int f2037_1(int x) { return x * 1; }
+inline int f2037_2(int x) { return x * 2; }
+inline int f2037_3(int x) { return x * 3; }
+inline int f2037_4(int x) { return x * 4; }
+inline int f2037_5(int x) { return x * 5; }
+inline int f2037_6(int x) { return x * 6; }
+inline int f2037_7(int x) { return x * 7; }
+inline int f2037_8(int x) { return x * 8; }
+inline int f2037_9(int x) { return x * 9; }
+inline int f2037_10(int x) { return x * 10; }
+inline int f2037_11(int x) { return x * 11; }
+inline int f2037_12(int x) { return x * 12; }
+inline int f2037_13(int x) { return x * 13; }
+inline int f2037_14(int x) { return x * 14; }
+inline int f2037_15(int x) { return x * 15; }
+inline int f2037_16(int x) { return x * 16; }
+inline int f2037_17(int x) { return x * 17; }
+inline int f2037_18(int x) { return x * 18; }
+inline int f2037_19(int x) { return x * 19; }
+inline int f2037_20(int x) { return x * 20; }
+inline int f2037_21(int x) { return x * 21; }
+inline int f2037_22(int x) { return x * 22; }
+inline int f2037_23(int x) { return x * 23; }
+inline int f2037_24(int x) { return x * 24; }
+inline int f2037_25(int x) { return x * 25; }
+inline int f2037_26(int x) { return x * 26; }
+inline int f2037_27(int x) { return x * 27; }
+inline int f2037_28(int x) { return x * 28; }
+inline int f2037_29(int x) { return x * 29; }
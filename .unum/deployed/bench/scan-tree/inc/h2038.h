@@ -0,0 +1,42 @@
+#pragma once
+/* header 2038 */
+#include <vector>
+#include "h2130.h"
+#include "h2369.h"
+#include "h635.h"
+#include "h2207.h"
+#include "h5711.h"
+#ifdef X
+#include "h6613.h"
+#endif
+struct S2038 { int a; const char *s = "x//y"; };
+inline int f2038_0(int x) { return x * 0; }
+inline int f2038_1(int x) { return x * 1; }
+inline int f2038_2(int x) { return x * 2; }
+inline int f2038_3(int x) { return x * 3; }
+inline int f2038_4(int x) { return x * 4; }
+inline int f2038_5(int x) { return x * 5; }
+inline int f2038_6(int x) { return x * 6; }
+inline int f2038_7(int x) { return x * 7; }
+inline int f2038_8(int x) { return x * 8; }
+inline int f2038_9(int x) { return x * 9; }
+inline int f2038_10(int x) { return x * 10; }
+inline int f2038_11(int x) { return x * 11; }
+inline int f2038_12(int x) { return x * 12; }
+inline int f2038_13(int x) { return x * 13; }
+inline int f2038_14(int x) { return x * 14; }
+inline int f2038_15(int x) { return x * 15; }
+inline int f2038_16(int x) { return x * 16; }
+inline int f2038_17(int x) { return x * 17; }
+inline int f2038_18(int x) { return x * 18; }
+inline int f2038_19(int x) { return x * 19; }
+inline int f2038_20(int x) { return x * 20; }
+inline int f2038_21(int x) { return x * 21; }
+inline int f2038_22(int x) { return x * 22; }
+inline int f2038_23(int x) { return x * 23; }
+inline int f2038_24(int x) { return x * 24; }
+inline int f2038_25(int x) { return x * 25; }
+inline int f2038_26(int x) { return x * 26; }
+inline int f2038_27(int x) { return x * 27; }
+inline int f2038_28(int x) { return x * 28; }
+inline int f2038_29(int x) { return x * 29; }
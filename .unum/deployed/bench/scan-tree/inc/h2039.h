@@ -0,0 +1,42 @@
+#pragma once
+/* header 2039 */
+#include <vector>
+#include "h4039.h"
+#include "h1809.h"
+#include "h3484.h"
+#include "h8138.h"
+#include "h4407.h"
+#ifdef X
+#include "h1993.h"
+#endif
+struct S2039 { int a; const char *s = "x//y"; };
+inline int f2039_0(int x) { return x * 0; }
+inline int f2039_1(int x) { return x * 1; }
+inline int f2039_2(int x) { return x * 2; }
+inline int f2039_3(int x) { return x * 3; }
+inline int f2039_4(int x) { return x * 4; }
+inline int f2039_5(int x) { return x * 5; }
+inline int f2039_6(int x) { return x * 6; }
+inline int f2039_7(int x) { return x * 7; }
+inline int f2039_8(int x) { return x * 8; }
+inline int f2039_9(int x) { return x * 9; }
+inline int f2039_10(int x) { return x * 10; }
+inline int f2039_11(int x) { return x * 11; }
+inline int f2039_12(int x) { return x * 12; }
+inline int f2039_13(int x) { return x * 13; }
+inline int f2039_14(int x) { return x * 14; }
+inline int f2039_15(int x) { return x * 15; }
+inline int f2039_16(int x) { return x * 16; }
+inline int f2039_17(int x) { return x * 17; }
+inline int f2039_18(int x) { return x * 18; }
+inline int f2039_19(int x) { return x * 19; }
+inline int f2039_20(int x) { return x * 20; }
+inline int f2039_21(int x) { return x * 21; }
+inline int f2039_22(int x) { return x * 22; }
+inline int f2039_23(int x) { return x * 23; }
+inline int f2039_24(int x) { return x * 24; }
+inline int f2039_25(int x) { return x * 25; }
+inline int f2039_26(int x) { return x * 26; }
+inline int f2039_27(int x) { return x * 27; }
+inline int f2039_28(int x) { return x * 28; }
+inline int f2039_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 204 */
+#include <vector>
+#include "h6977.h"
+#include "h9925.h"
+#include "h7102.h"
+#include "h3271.h"
+#include "h9392.h"
+#ifdef X
+#include "h9730.h"
+#endif
+struct S204 { int a; const char *s = "x//y"; };
+inline int f204_0(int x) { return x * 0; }
+inline int f204_1(int x) { return x * 1; }
+inline int f204_2(int x) { return x * 2; }
+inline int f204_3(int x) { return x * 3; }
+inline int f204_4(int x) { return x * 4; }
+inline int f204_5(int x) { return x * 5; }
+inline int f204_6(int x) { return x * 6; }
+inline int f204_7(int x) { return x * 7; }
+inline int f204_8(int x) { return x * 8; }
+inline int f204_9(int x) { return x * 9; }
+inline int f204_10(int x) { return x * 10; }
+inline int f204_11(int x) { return x * 11; }
+inline int f204_12(int x) { return x * 12; }
+inline int f204_13(int x) { return x * 13; }
+inline int f204_14(int x) { return x * 14; }
+inline int f204_15(int x) { return x * 15; }
+inline int f204_16(int x) { return x * 16; }
+inline int f204_17(int x) { return x * 17; }
+inline int f204_18(int x) { return x * 18; }
+inline int f204_19(int x) { return x * 19; }
+inline int f204_20(int x) { return x * 20; }
+inline int f204_21(int x) { return x * 21; }
+inline int f204_22(int x) { return x * 22; }
+inline int f204_23(int x) { return x * 23; }
+inline int f204_24(int x) { return x * 24; }
+inline int f204_25(int x) { return x * 25; }
+inline int f204_26(int x) { return x * 26; }
+inline int f204_27(int x) { return x * 27; }
+inline int f204_28(int x) { return x * 28; }
+inline int f204_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2047 */
+#include <vector>
+#include "h5984.h"
+#include "h2391.h"
+#include "h1523.h"
+#include "h9104.h"
+#include "h2977.h"
+#ifdef X
+#include "h2605.h"
+#endif
+struct S2047 { int a; const char *s = "x//y"; };
+inline int f2047_0(int x) { return x * 0; }
+inline int f2047_1(int x) { return x * 1; }
+inline int f2047_2(int x) { return x * 2; }
+inline int f2047_3(int x) { return x * 3; }
+inline int f2047_4(int x) { return x * 4; }
+inline int f2047_5(int x) { return x * 5; }
+inline int f2047_6(int x) { return x * 6; }
+inline int f2047_7(int x) { return x * 7; }
+inline int f2047_8(int x) { return x * 8; }
+inline int f2047_9(int x) { return x * 9; }
+inline int f2047_10(int x) { return x * 10; }
+inline int f2047_11(int x) { return x * 11; }
+inline int f2047_12(int x) { return x * 12; }
+inline int f2047_13(int x) { return x * 13; }
+inline int f2047_14(int x) { return x * 14; }
+inline int f2047_15(int x) { return x * 15; }
+inline int f2047_16(int x) { return x * 16; }
+inline int f2047_17(int x) { return x * 17; }
+inline int f2047_18(int x) { return x * 18; }
+inline int f2047_19(int x) { return x * 19; }
+inline int f2047_20(int x) { return x * 20; }
+inline int f2047_21(int x) { return x * 21; }
+inline int f2047_22(int x) { return x * 22; }
+inline int f2047_23(int x) { return x * 23; }
+inline int f2047_24(int x) { return x * 24; }
+inline int f2047_25(int x) { return x * 25; }
+inline int f2047_26(int x) { return x * 26; }
+inline int f2047_27(int x) { return x * 27; }
+inline int f2047_28(int x) { return x * 28; }
+inline int f2047_29(int x) { return x * 29; }
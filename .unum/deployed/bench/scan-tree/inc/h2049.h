@@ -0,0 +1,42 @@
+#pragma once
+/* header 2049 */
+#include <vector>
+#include "h5873.h"
+#include "h4607.h"
+#include "h5996.h"
+#include "h7596.h"
+#include "h6007.h"
+#ifdef X
+#include "h3520.h"
+#endif
+struct S2049 { int a; const char *s = "x//y"; };
+inline int f2049_0(int x) { return x * 0; }
+inline int f2049_1(int x) { return x * 1; }
+inline int f2049_2(int x) { return x * 2; }
+inline int f2049_3(int x) { return x * 3; }
+inline int f2049_4(int x) { return x * 4; }
+inline int f2049_5(int x) { return x * 5; }
+inline int f2049_6(int x) { return x * 6; }
+inline int f2049_7(int x) { return x * 7; }
+inline int f2049_8(int x) { return x * 8; }
+inline int f2049_9(int x) { return x * 9; }
+inline int f2049_10(int x) { return x * 10; }
+inline int f2049_11(int x) { return x * 11; }
+inline int f2049_12(int x) { return x * 12; }
+inline int f2049_13(int x) { return x * 13; }
+inline int f2049_14(int x) { return x * 14; }
+inline int f2049_15(int x) { return x * 15; }
+inline int f2049_16(int x) { return x * 16; }
+inline int f2049_17(int x) { return x * 17; }
+inline int f2049_18(int x) { return x * 18; }
+inline int f2049_19(int x) { return x * 19; }
+inline int f2049_20(int x) { return x * 20; }
+inline int f2049_21(int x) { return x * 21; }
+inline int f2049_22(int x) { return x * 22; }
+inline int f2049_23(int x) { return x * 23; }
+inline int f2049_24(int x) { return x * 24; }
+inline int f2049_25(int x) { return x * 25; }
+inline int f2049_26(int x) { return x * 26; }
+inline int f2049_27(int x) { return x * 27; }
+inline int f2049_28(int x) { return x * 28; }
+inline int f2049_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 205 */
+#include <vector>
+#include "h3393.h"
+#include "h2315.h"
+#include "h7733.h"
+#include "h5596.h"
+#include "h3721.h"
+#ifdef X
+#include "h1571.h"
+#endif
+struct S205 { int a; const char *s = "x//y"; };
+inline int f205_0(int x) { return x * 0; }
+inline int f205_1(int x) { return x * 1; }
+inline int f205_2(int x) { return x * 2; }
+inline int f205_3(int x) { return x * 3; }
+inline int f205_4(int x) { return x * 4; }
+inline int f205_5(int x) { return x * 5; }
+inline int f205_6(int x) { return x * 6; }
+inline int f205_7(int x) { return x * 7; }
+inline int f205_8(int x) { return x * 8; }
+inline int f205_9(int x) { return x * 9; }
+inline int f205_10(int x) { return x * 10; }
+inline int f205_11(int x) { return x * 11; }
+inline int f205_12(int x) { return x * 12; }
+inline int f205_13(int x) { return x * 13; }
+inline int f205_14(int x) { return x * 14; }
+inline int f205_15(int x) { return x * 15; }
+inline int f205_16(int x) { return x * 16; }
+inline int f205_17(int x) { return x * 17; }
+inline int f205_18(int x) { return x * 18; }
+inline int f205_19(int x) { return x * 19; }
+inline int f205_20(int x) { return x * 20; }
+inline int f205_21(int x) { return x * 21; }
+inline int f205_22(int x) { return x * 22; }
+inline int f205_23(int x) { return x * 23; }
+inline int f205_24(int x) { return x * 24; }
+inline int f205_25(int x) { return x * 25; }
+inline int f205_26(int x) { return x * 26; }
+inline int f205_27(int x) { return x * 27; }
+inline int f205_28(int x) { return x * 28; }
+inline int f205_29(int x) { return x * 29; }
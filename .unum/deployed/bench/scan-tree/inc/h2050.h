@@ -0,0 +1,42 @@
+#pragma once
+/* header 2050 */
+#include <vector>
+#include "h7329.h"
+#include "h2244.h"
+#include "h7752.h"
+#include "h3854.h"
+#include "h9735.h"
+#ifdef X
+#include "h2988.h"
+#endif
+struct S2050 { int a; const char *s = "x//y"; };
+inline int f2050_0(int x) { return x * 0; }
+inline int f2050_1(int x) { return x * 1; }
+inline int f2050_2(int x) { return x * 2; }
+inline int f2050_3(int x) { return x * 3; }
+inline int f2050_4(int x) { return x * 4; }
+inline int f2050_5(int x) { return x * 5; }
+inline int f2050_6(int x) { return x * 6; }
+inline int f2050_7(int x) { return x * 7; }
+inline int f2050_8(int x) { return x * 8; }
+inline int f2050_9(int x) { return x * 9; }
+inline int f2050_10(int x) { return x * 10; }
+inline int f2050_11(int x) { return x * 11; }
+inline int f2050_12(int x) { return x * 12; }
+inline int f2050_13(int x) { return x * 13; }
+inline int f2050_14(int x) { return x * 14; }
+inline int f2050_15(int x) { return x * 15; }
+inline int f2050_16(int x) { return x * 16; }
+inline int f2050_17(int x) { return x * 17; }
+inline int f2050_18(int x) { return x * 18; }
+inline int f2050_19(int x) { return x * 19; }
+inline int f2050_20(int x) { return x * 20; }
+inline int f2050_21(int x) { return x * 21; }
+inline int f2050_22(int x) { return x * 22; }
+inline int f2050_23(int x) { return x * 23; }
+inline int f2050_24(int x) { return x * 24; }
+inline int f2050_25(int x) { return x * 25; }
+inline int f2050_26(int x) { return x * 26; }
+inline int f2050_27(int x) { return x * 27; }
+inline int f2050_28(int x) { return x * 28; }
+inline int f2050_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2052 */
+#include <vector>
+#include "h9744.h"
+#include "h9990.h"
+#include "h962.h"
+#include "h7245.h"
+#include "h6936.h"
+#ifdef X
+#include "h6457.h"
+#endif
+struct S2052 { int a; const char *s = "x//y"; };
+inline int f2052_0(int x) { return x * 0; }
+inline int f2052_1(int x) { return x * 1; }
+inline int f2052_2(int x) { return x * 2; }
+inline int f2052_3(int x) { return x * 3; }
+inline int f2052_4(int x) { return x * 4; }
+inline int f2052_5(int x) { return x * 5; }
+inline int f2052_6(int x) { return x * 6; }
+inline int f2052_7(int x) { return x * 7; }
+inline int f2052_8(int x) { return x * 8; }
+inline int f2052_9(int x) { return x * 9; }
+inline int f2052_10(int x) { return x * 10; }
+inline int f2052_11(int x) { return x * 11; }
+inline int f2052_12(int x) { return x * 12; }
+inline int f2052_13(int x) { return x * 13; }
+inline int f2052_14(int x) { return x * 14; }
+inline int f2052_15(int x) { return x * 15; }
+inline int f2052_16(int x) { return x * 16; }
+inline int f2052_17(int x) { return x * 17; }
+inline int f2052_18(int x) { return x * 18; }
+inline int f2052_19(int x) { return x * 19; }
+inline int f2052_20(int x) { return x * 20; }
+inline int f2052_21(int x) { return x * 21; }
+inline int f2052_22(int x) { return x * 22; }
+inline int f2052_23(int x) { return x * 23; }
+inline int f2052_24(int x) { return x * 24; }
+inline int f2052_25(int x) { return x * 25; }
+inline int f2052_26(int x) { return x * 26; }
+inline int f2052_27(int x) { return x * 27; }
+inline int f2052_28(int x) { return x * 28; }
+inline int f2052_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2054 */
+#include <vector>
+#include "h7104.h"
+#include "h8668.h"
+#include "h9355.h"
+#include "h4252.h"
+#include "h1584.h"
+#ifdef X
+#include "h7855.h"
+#endif
+struct S2054 { int a; const char *s = "x//y"; };
+inline int f2054_0(int x) { return x * 0; }
+inline int f2054_1(int x) { return x * 1; }
+inline int f2054_2(int x) { return x * 2; }
+inline int f2054_3(int x) { return x * 3; }
+inline int f2054_4(int x) { return x * 4; }
+inline int f2054_5(int x) { return x * 5; }
+inline int f2054_6(int x) { return x * 6; }
+inline int f2054_7(int x) { return x * 7; }
+inline int f2054_8(int x) { return x * 8; }
+inline int f2054_9(int x) { return x * 9; }
+inline int f2054_10(int x) { return x * 10; }
+inline int f2054_11(int x) { return x * 11; }
+inline int f2054_12(int x) { return x * 12; }
+inline int f2054_13(int x) { return x * 13; }
+inline int f2054_14(int x) { return x * 14; }
+inline int f2054_15(int x) { return x * 15; }
+inline int f2054_16(int x) { return x * 16; }
+inline int f2054_17(int x) { return x * 17; }
+inline int f2054_18(int x) { return x * 18; }
+inline int f2054_19(int x) { return x * 19; }
+inline int f2054_20(int x) { return x * 20; }
+inline int f2054_21(int x) { return x * 21; }
+inline int f2054_22(int x) { return x * 22; }
+inline int f2054_23(int x) { return x * 23; }
+inline int f2054_24(int x) { return x * 24; }
+inline int f2054_25(int x) { return x * 25; }
+inline int f2054_26(int x) { return x * 26; }
+inline int f2054_27(int x) { return x * 27; }
+inline int f2054_28(int x) { return x * 28; }
+inline int f2054_29(int x) { return x * 29; }
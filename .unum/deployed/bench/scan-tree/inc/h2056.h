@@ -0,0 +1,42 @@
+#pragma once
+/* header 2056 */
+#include <vector>
+#include "h1859.h"
+#include "h852.h"
+#include "h6485.h"
+#include "h1564.h"
+#include "h9358.h"
+#ifdef X
+#include "h5507.h"
+#endif
+struct S2056 { int a; const char *s = "x//y"; };
+inline int f2056_0(int x) { return x * 0; }
+inline int f2056_1(int x) { return x * 1; }
+inline int f2056_2(int x) { return x * 2; }
+inline int f2056_3(int x) { return x * 3; }
+inline int f2056_4(int x) { return x * 4; }
+inline int f2056_5(int x) { return x * 5; }
+inline int f2056_6(int x) { return x * 6; }
+inline int f2056_7(int x) { return x * 7; }
+inline int f2056_8(int x) { return x * 8; }
+inline int f2056_9(int x) { return x * 9; }
+inline int f2056_10(int x) { return x * 10; }
+inline int f2056_11(int x) { return x * 11; }
+inline int f2056_12(int x) { return x * 12; }
+inline int f2056_13(int x) { return x * 13; }
+inline int f2056_14(int x) { return x * 14; }
+inline int f2056_15(int x) { return x * 15; }
+inline int f2056_16(int x) { return x * 16; }
+inline int f2056_17(int x) { return x * 17; }
+inline int f2056_18(int x) { return x * 18; }
+inline int f2056_19(int x) { return x * 19; }
+inline int f2056_20(int x) { return x * 20; }
+inline int f2056_21(int x) { return x * 21; }
+inline int f2056_22(int x) { return x * 22; }
+inline int f2056_23(int x) { return x * 23; }
+inline int f2056_24(int x) { return x * 24; }
+inline int f2056_25(int x) { return x * 25; }
+inline int f2056_26(int x) { return x * 26; }
+inline int f2056_27(int x) { return x * 27; }
+inline int f2056_28(int x) { return x * 28; }
+inline int f2056_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2057 */
+#include <vector>
+#include "h6648.h"
+#include "h4905.h"
+#include "h4181.h"
+#include "h4654.h"
+#include "h5654.h"
+#ifdef X
+#include "h6316.h"
+#endif
+struct S2057 { int a; const char *s = "x//y"; };
+inline int f2057_0(int x) { return x * 0; }
+inline int f2057_1(int x) { return x * 1; }
+inline int f2057_2(int x) { return x * 2; }
+inline int f2057_3(int x) { return x * 3; }
+inline int f2057_4(int x) { return x * 4; }
+inline int f2057_5(int x) { return x * 5; }
+inline int f2057_6(int x) { return x * 6; }
+inline int f2057_7(int x) { return x * 7; }
+inline int f2057_8(int x) { return x * 8; }
+inline int f2057_9(int x) { return x * 9; }
+inline int f2057_10(int x) { return x * 10; }
+inline int f2057_11(int x) { return x * 11; }
+inline int f2057_12(int x) { return x * 12; }
+inline int f2057_13(int x) { return x * 13; }
+inline int f2057_14(int x) { return x * 14; }
+inline int f2057_15(int x) { return x * 15; }
+inline int f2057_16(int x) { return x * 16; }
+inline int f2057_17(int x) { return x * 17; }
+inline int f2057_18(int x) { return x * 18; }
+inline int f2057_19(int x) { return x * 19; }
+inline int f2057_20(int x) { return x * 20; }
+inline int f2057_21(int x) { return x * 21; }
+inline int f2057_22(int x) { return x * 22; }
+inline int f2057_23(int x) { return x * 23; }
+inline int f2057_24(int x) { return x * 24; }
+inline int f2057_25(int x) { return x * 25; }
+inline int f2057_26(int x) { return x * 26; }
+inline int f2057_27(int x) { return x * 27; }
+inline int f2057_28(int x) { return x * 28; }
+inline int f2057_29(int x) { return x * 29; }
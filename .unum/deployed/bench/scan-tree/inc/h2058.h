@@ -0,0 +1,42 @@
+#pragma once
+/* header 2058 */
+#include <vector>
+#include "h3330.h"
+#include "h1187.h"
+#include "h6302.h"
+#include "h5460.h"
+#include "h2931.h"
+#ifdef X
+#include "h8535.h"
+#endif
+struct S2058 { int a; const char *s = "x//y"; };
+inline int f2058_0(int x) { return x * 0; }
+inline int f2058_1(int x) { return x * 1; }
+inline int f2058_2(int x) { return x * 2; }
+inline int f2058_3(int x) { return x * 3; }
+inline int f2058_4(int x) { return x * 4; }
+inline int f2058_5(int x) { return x * 5; }
+inline int f2058_6(int x) { return x * 6; }
+inline int f2058_7(int x) { return x * 7; }
+inline int f2058_8(int x) { return x * 8; }
+inline int f2058_9(int x) { return x * 9; }
+inline int f2058_10(int x) { return x * 10; }
+inline int f2058_11(int x) { return x * 11; }
+inline int f2058_12(int x) { return x * 12; }
+inline int f2058_13(int x) { return x * 13; }
+inline int f2058_14(int x) { return x * 14; }
+inline int f2058_15(int x) { return x * 15; }
+inline int f2058_16(int x) { return x * 16; }
+inline int f2058_17(int x) { return x * 17; }
+inline int f2058_18(int x) { return x * 18; }
+inline int f2058_19(int x) { return x * 19; }
+inline int f2058_20(int x) { return x * 20; }
+inline int f2058_21(int x) { return x * 21; }
+inline int f2058_22(int x) { return x * 22; }
+inline int f2058_23(int x) { return x * 23; }
+inline int f2058_24(int x) { return x * 24; }
+inline int f2058_25(int x) { return x * 25; }
+inline int f2058_26(int x) { return x * 26; }
+inline int f2058_27(int x) { return x * 27; }
+inline int f2058_28(int x) { return x * 28; }
+inline int f2058_29(int x) { return x * 29; }
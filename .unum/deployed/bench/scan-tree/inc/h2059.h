@@ -0,0 +1,42 @@
+#pragma once
+/* header 2059 */
+#include <vector>
+#include "h7376.h"
+#include "h9908.h"
+#include "h8436.h"
+#include "h2051.h"
+#include "h9426.h"
+#ifdef X
+#include "h6824.h"
+#endif
+struct S2059 { int a; const char *s = "x//y"; };
+inline int f2059_0(int x) { return x * 0; }
+inline int f2059_1(int x) { return x * 1; }
+inline int f2059_2(int x) { return x * 2; }
+inline int f2059_3(int x) { return x * 3; }
+inline int f2059_4(int x) { return x * 4; }
+inline int f2059_5(int x) { return x * 5; }
+inline int f2059_6(int x) { return x * 6; }
+inline int f2059_7(int x) { return x * 7; }
+inline int f2059_8(int x) { return x * 8; }
+inline int f2059_9(int x) { return x * 9; }
+inline int f2059_10(int x) { return x * 10; }
+inline int f2059_11(int x) { return x * 11; }
+inline int f2059_12(int x) { return x * 12; }
+inline int f2059_13(int x) { return x * 13; }
+inline int f2059_14(int x) { return x * 14; }
+inline int f2059_15(int x) { return x * 15; }
+inline int f2059_16(int x) { return x * 16; }
+inline int f2059_17(int x) { return x * 17; }
+inline int f2059_18(int x) { return x * 18; }
+inline int f2059_19(int x) { return x * 19; }
+inline int f2059_20(int x) { return x * 20; }
+inline int f2059_21(int x) { return x * 21; }
+inline int f2059_22(int x) { return x * 22; }
+inline int f2059_23(int x) { return x * 23; }
+inline int f2059_24(int x) { return x * 24; }
+inline int f2059_25(int x) { return x * 25; }
+inline int f2059_26(int x) { return x * 26; }
+inline int f2059_27(int x) { return x * 27; }
+inline int f2059_28(int x) { return x * 28; }
+inline int f2059_29(int x) { return x * 29; }
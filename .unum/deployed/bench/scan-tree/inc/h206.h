@@ -0,0 +1,42 @@
+#pragma once
+/* header 206 */
+#include <vector>
+#include "h7573.h"
+#include "h9525.h"
+#include "h6467.h"
+#include "h8682.h"
+#include "h5565.h"
+#ifdef X
+#include "h5356.h"
+#endif
+struct S206 { int a; const char *s = "x//y"; };
+inline int f206_0(int x) { return x * 0; }
+inline int f206_1(int x) { return x * 1; }
+inline int f206_2(int x) { return x * 2; }
+inline int f206_3(int x) { return x * 3; }
+inline int f206_4(int x) { return x * 4; }
+inline int f206_5(int x) { return x * 5; }
+inline int f206_6(int x) { return x * 6; }
+inline int f206_7(int x) { return x * 7; }
+inline int f206_8(int x) { return x * 8; }
+inline int f206_9(int x) { return x * 9; }
+inline int f206_10(int x) { return x * 10; }
+inline int f206_11(int x) { return x * 11; }
+inline int f206_12(int x) { return x * 12; }
+inline int f206_13(int x) { return x * 13; }
+inline int f206_14(int x) { return x * 14; }
+inline int f206_15(int x) { return x * 15; }
+inline int f206_16(int x) { return x * 16; }
+inline int f206_17(int x) { return x * 17; }
+inline int f206_18(int x) { return x * 18; }
+inline int f206_19(int x) { return x * 19; }
+inline int f206_20(int x) { return x * 20; }
+inline int f206_21(int x) { return x * 21; }
+inline int f206_22(int x) { return x * 22; }
+inline int f206_23(int x) { return x * 23; }
+inline int f206_24(int x) { return x * 24; }
+inline int f206_25(int x) { return x * 25; }
+inline int f206_26(int x) { return x * 26; }
+inline int f206_27(int x) { return x * 27; }
+inline int f206_28(int x) { return x * 28; }
+inline int f206_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2062 */
+#include <vector>
+#include "h392.h"
+#include "h9558.h"
+#include "h4624.h"
+#include "h4811.h"
+#include "h9685.h"
+#ifdef X
+#include "h8314.h"
+#endif
+struct S2062 { int a; const char *s = "x//y"; };
+inline int f2062_0(int x) { return x * 0; }
+inline int f2062_1(int x) { return x * 1; }
+inline int f2062_2(int x) { return x * 2; }
+inline int f2062_3(int x) { return x * 3; }
+inline int f2062_4(int x) { return x * 4; }
+inline int f2062_5(int x) { return x * 5; }
+inline int f2062_6(int x) { return x * 6; }
+inline int f2062_7(int x) { return x * 7; }
+inline int f2062_8(int x) { return x * 8; }
+inline int f2062_9(int x) { return x * 9; }
+inline int f2062_10(int x) { return x * 10; }
+inline int f2062_11(int x) { return x * 11; }
+inline int f2062_12(int x) { return x * 12; }
+inline int f2062_13(int x) { return x * 13; }
+inline int f2062_14(int x) { return x * 14; }
+inline int f2062_15(int x) { return x * 15; }
+inline int f2062_16(int x) { return x * 16; }
+inline int f2062_17(int x) { return x * 17; }
+inline int f2062_18(int x) { return x * 18; }
+inline int f2062_19(int x) { return x * 19; }
+inline int f2062_20(int x) { return x * 20; }
+inline int f2062_21(int x) { return x * 21; }
+inline int f2062_22(int x) { return x * 22; }
+inline int f2062_23(int x) { return x * 23; }
+inline int f2062_24(int x) { return x * 24; }
+inline int f2062_25(int x) { return x * 25; }
+inline int f2062_26(int x) { return x * 26; }
+inline int f2062_27(int x) { return x * 27; }
+inline int f2062_28(int x) { return x * 28; }
+inline int f2062_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2063 */
+#include <vector>
+#include "h636.h"
+#include "h8149.h"
+#include "h9177.h"
+#include "h5263.h"
+#include "h8791.h"
+#ifdef X
+#include "h663.h"
+#endif
+struct S2063 { int a; const char *s = "x//y"; };
+inline int f2063_0(int x) { return x * 0; }
+inline int f2063_1(int x) { return x * 1; }
+inline int f2063_2(int x) { return x * 2; }
+inline int f2063_3(int x) { return x * 3; }
+inline int f2063_4(int x) { return x * 4; }
+inline int f2063_5(int x) { return x * 5; }
+inline int f2063_6(int x) { return x * 6; }
+inline int f2063_7(int x) { return x * 7; }
+inline int f2063_8(int x) { return x * 8; }
+inline int f2063_9(int x) { return x * 9; }
+inline int f2063_10(int x) { return x * 10; }
+inline int f2063_11(int x) { return x * 11; }
+inline int f2063_12(int x) { return x * 12; }
+inline int f2063_13(int x) { return x * 13; }
+inline int f2063_14(int x) { return x * 14; }
+inline int f2063_15(int x) { return x * 15; }
+inline int f2063_16(int x) { return x * 16; }
+inline int f2063_17(int x) { return x * 17; }
+inline int f2063_18(int x) { return x * 18; }
+inline int f2063_19(int x) { return x * 19; }
+inline int f2063_20(int x) { return x * 20; }
+inline int f2063_21(int x) { return x * 21; }
+inline int f2063_22(int x) { return x * 22; }
+inline int f2063_23(int x) { return x * 23; }
+inline int f2063_24(int x) { return x * 24; }
+inline int f2063_25(int x) { return x * 25; }
+inline int f2063_26(int x) { return x * 26; }
+inline int f2063_27(int x) { return x * 27; }
+inline int f2063_28(int x) { return x * 28; }
+inline int f2063_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2065 */
+#include <vector>
+#include "h9217.h"
+#include "h6411.h"
+#include "h3475.h"
+#include "h4955.h"
+#include "h4888.h"
+#ifdef X
+#include "h2711.h"
+#endif
+struct S2065 { int a; const char *s = "x//y"; };
+inline int f2065_0(int x) { return x * 0; }
+inline int f2065_1(int x) { return x * 1; }
+inline int f2065_2(int x) { return x * 2; }
+inline int f2065_3(int x) { return x * 3; }
+inline int f2065_4(int x) { return x * 4; }
+inline int f2065_5(int x) { return x * 5; }
+inline int f2065_6(int x) { return x * 6; }
+inline int f2065_7(int x) { return x * 7; }
+inline int f2065_8(int x) { return x * 8; }
+inline int f2065_9(int x) { return x * 9; }
+inline int f2065_10(int x) { return x * 10; }
+inline int f2065_11(int x) { return x * 11; }
+inline int f2065_12(int x) { return x * 12; }
+inline int f2065_13(int x) { return x * 13; }
+inline int f2065_14(int x) { return x * 14; }
+inline int f2065_15(int x) { return x * 15; }
+inline int f2065_16(int x) { return x * 16; }
+inline int f2065_17(int x) { return x * 17; }
+inline int f2065_18(int x) { return x * 18; }
+inline int f2065_19(int x) { return x * 19; }
+inline int f2065_20(int x) { return x * 20; }
+inline int f2065_21(int x) { return x * 21; }
+inline int f2065_22(int x) { return x * 22; }
+inline int f2065_23(int x) { return x * 23; }
+inline int f2065_24(int x) { return x * 24; }
+inline int f2065_25(int x) { return x * 25; }
+inline int f2065_26(int x) { return x * 26; }
+inline int f2065_27(int x) { return x * 27; }
+inline int f2065_28(int x) { return x * 28; }
+inline int f2065_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2066 */
+#include <vector>
+#include "h7699.h"
+#include "h4040.h"
+#include "h3112.h"
+#include "h3121.h"
+#include "h6787.h"
+#ifdef X
+#include "h9183.h"
+#endif
+struct S2066 { int a; const char *s = "x//y"; };
+inline int f2066_0(int x) { return x * 0; }
+inline int f2066_1(int x) { return x * 1; }
+inline int f2066_2(int x) { return x * 2; }
+inline int f2066_3(int x) { return x * 3; }
+inline int f2066_4(int x) { return x * 4; }
+inline int f2066_5(int x) { return x * 5; }
+inline int f2066_6(int x) { return x * 6; }
+inline int f2066_7(int x) { return x * 7; }
+inline int f2066_8(int x) { return x * 8; }
+inline int f2066_9(int x) { return x * 9; }
+inline int f2066_10(int x) { return x * 10; }
+inline int f2066_11(int x) { return x * 11; }
+inline int f2066_12(int x) { return x * 12; }
+inline int f2066_13(int x) { return x * 13; }
+inline int f2066_14(int x) { return x * 14; }
+inline int f2066_15(int x) { return x * 15; }
+inline int f2066_16(int x) { return x * 16; }
+inline int f2066_17(int x) { return x * 17; }
+inline int f2066_18(int x) { return x * 18; }
+inline int f2066_19(int x) { return x * 19; }
+inline int f2066_20(int x) { return x * 20; }
+inline int f2066_21(int x) { return x * 21; }
+inline int f2066_22(int x) { return x * 22; }
+inline int f2066_23(int x) { return x * 23; }
+inline int f2066_24(int x) { return x * 24; }
+inline int f2066_25(int x) { return x * 25; }
+inline int f2066_26(int x) { return x * 26; }
+inline int f2066_27(int x) { return x * 27; }
+inline int f2066_28(int x) { return x * 28; }
+inline int f2066_29(int x) { return x * 29; }
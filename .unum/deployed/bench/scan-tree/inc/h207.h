@@ -0,0 +1,42 @@
+#pragma once
+/* header 207 */
+#include <vector>
+#include "h4415.h"
+#include "h1672.h"
+#include "h51.h"
+#include "h9041.h"
+#include "h9608.h"
+#ifdef X
+#include "h1828.h"
+#endif
+struct S207 { int a; const char *s = "x//y"; };
+inline int f207_0(int x) { return x * 0; }
+inline int f207_1(int x) { return x * 1; }
+inline int f207_2(int x) { return x * 2; }
+inline int f207_3(int x) { return x * 3; }
+inline int f207_4(int x) { return x * 4; }
+inline int f207_5(int x) { return x * 5; }
+inline int f207_6(int x) { return x * 6; }
+inline int f207_7(int x) { return x * 7; }
+inline int f207_8(int x) { return x * 8; }
+inline int f207_9(int x) { return x * 9; }
+inline int f207_10(int x) { return x * 10; }
+inline int f207_11(int x) { return x * 11; }
+inline int f207_12(int x) { return x * 12; }
+inline int f207_13(int x) { return x * 13; }
+inline int f207_14(int x) { return x * 14; }
+inline int f207_15(int x) { return x * 15; }
+inline int f207_16(int x) { return x * 16; }
+inline int f207_17(int x) { return x * 17; }
+inline int f207_18(int x) { return x * 18; }
+inline int f207_19(int x) { return x * 19; }
+inline int f207_20(int x) { return x * 20; }
+inline int f207_21(int x) { return x * 21; }
+inline int f207_22(int x) { return x * 22; }
+inline int f207_23(int x) { return x * 23; }
+inline int f207_24(int x) { return x * 24; }
+inline int f207_25(int x) { return x * 25; }
+inline int f207_26(int x) { return x * 26; }
+inline int f207_27(int x) { return x * 27; }
+inline int f207_28(int x) { return x * 28; }
+inline int f207_29(int x) { return x * 29; }
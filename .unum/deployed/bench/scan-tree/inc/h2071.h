@@ -0,0 +1,42 @@
+#pragma once
+/* header 2071 */
+#include <vector>
+#include "h7387.h"
+#include "h818.h"
+#include "h7450.h"
+#include "h3983.h"
+#include "h3725.h"
+#ifdef X
+#include "h5342.h"
+#endif
+struct S2071 { int a; const char *s = "x//y"; };
+inline int f2071_0(int x) { return x * 0; }
+inline int f2071_1(int x) { return x * 1; }
+inline int f2071_2(int x) { return x * 2; }
+inline int f2071_3(int x) { return x * 3; }
+inline int f2071_4(int x) { return x * 4; }
+inline int f2071_5(int x) { return x * 5; }
+inline int f2071_6(int x) { return x * 6; }
+inline int f2071_7(int x) { return x * 7; }
+inline int f2071_8(int x) { return x * 8; }
+inline int f2071_9(int x) { return x * 9; }
+inline int f2071_10(int x) { return x * 10; }
+inline int f2071_11(int x) { return x * 11; }
+inline int f2071_12(int x) { return x * 12; }
+inline int f2071_13(int x) { return x * 13; }
+inline int f2071_14(int x) { return x * 14; }
+inline int f2071_15(int x) { return x * 15; }
+inline int f2071_16(int x) { return x * 16; }
+inline int f2071_17(int x) { return x * 17; }
+inline int f2071_18(int x) { return x * 18; }
+inline int f2071_19(int x) { return x * 19; }
+inline int f2071_20(int x) { return x * 20; }
+inline int f2071_21(int x) { return x * 21; }
+inline int f2071_22(int x) { return x * 22; }
+inline int f2071_23(int x) { return x * 23; }
+inline int f2071_24(int x) { return x * 24; }
+inline int f2071_25(int x) { return x * 25; }
+inline int f2071_26(int x) { return x * 26; }
+inline int f2071_27(int x) { return x * 27; }
+inline int f2071_28(int x) { return x * 28; }
+inline int f2071_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2078 */
+#include <vector>
+#include "h4915.h"
+#include "h6561.h"
+#include "h7353.h"
+#include "h287.h"
+#include "h6849.h"
+#ifdef X
+#include "h8861.h"
+#endif
+struct S2078 { int a; const char *s = "x//y"; };
+inline int f2078_0(int x) { return x * 0; }
+inline int f2078_1(int x) { return x * 1; }
+inline int f2078_2(int x) { return x * 2; }
+inline int f2078_3(int x) { return x * 3; }
+inline int f2078_4(int x) { return x * 4; }
+inline int f2078_5(int x) { return x * 5; }
+inline int f2078_6(int x) { return x * 6; }
+inline int f2078_7(int x) { return x * 7; }
+inline int f2078_8(int x) { return x * 8; }
+inline int f2078_9(int x) { return x * 9; }
+inline int f2078_10(int x) { return x * 10; }
+inline int f2078_11(int x) { return x * 11; }
+inline int f2078_12(int x) { return x * 12; }
+inline int f2078_13(int x) { return x * 13; }
+inline int f2078_14(int x) { return x * 14; }
+inline int f2078_15(int x) { return x * 15; }
+inline int f2078_16(int x) { return x * 16; }
+inline int f2078_17(int x) { return x * 17; }
+inline int f2078_18(int x) { return x * 18; }
+inline int f2078_19(int x) { return x * 19; }
+inline int f2078_20(int x) { return x * 20; }
+inline int f2078_21(int x) { return x * 21; }
+inline int f2078_22(int x) { return x * 22; }
+inline int f2078_23(int x) { return x * 23; }
+inline int f2078_24(int x) { return x * 24; }
+inline int f2078_25(int x) { return x * 25; }
+inline int f2078_26(int x) { return x * 26; }
+inline int f2078_27(int x) { return x * 27; }
+inline int f2078_28(int x) { return x * 28; }
+inline int f2078_29(int x) { return x * 29; }
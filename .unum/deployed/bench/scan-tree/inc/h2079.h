@@ -0,0 +1,42 @@
+#pragma once
+/* header 2079 */
+#include <vector>
+#include "h4618.h"
+#include "h4743.h"
+#include "h3566.h"
+#include "h8841.h"
+#include "h5062.h"
+#ifdef X
+#include "h4241.h"
+#endif
+struct S2079 { int a; const char *s = "x//y"; };
+inline int f2079_0(int x) { return x * 0; }
+inline int f2079_1(int x) { return x * 1; }
+inline int f2079_2(int x) { return x * 2; }
+inline int f2079_3(int x) { return x * 3; }
+inline int f2079_4(int x) { return x * 4; }
+inline int f2079_5(int x) { return x * 5; }
+inline int f2079_6(int x) { return x * 6; }
+inline int f2079_7(int x) { return x * 7; }
+inline int f2079_8(int x) { return x * 8; }
+inline int f2079_9(int x) { return x * 9; }
+inline int f2079_10(int x) { return x * 10; }
+inline int f2079_11(int x) { return x * 11; }
+inline int f2079_12(int x) { return x * 12; }
+inline int f2079_13(int x) { return x * 13; }
+inline int f2079_14(int x) { return x * 14; }
+inline int f2079_15(int x) { return x * 15; }
+inline int f2079_16(int x) { return x * 16; }
+inline int f2079_17(int x) { return x * 17; }
+inline int f2079_18(int x) { return x * 18; }
+inline int f2079_19(int x) { return x * 19; }
+inline int f2079_20(int x) { return x * 20; }
+inline int f2079_21(int x) { return x * 21; }
+inline int f2079_22(int x) { return x * 22; }
+inline int f2079_23(int x) { return x * 23; }
+inline int f2079_24(int x) { return x * 24; }
+inline int f2079_25(int x) { return x * 25; }
+inline int f2079_26(int x) { return x * 26; }
+inline int f2079_27(int x) { return x * 27; }
+inline int f2079_28(int x) { return x * 28; }
+inline int f2079_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2080 */
+#include <vector>
+#include "h866.h"
+#include "h4033.h"
+#include "h666.h"
+#include "h2869.h"
+#include "h4155.h"
+#ifdef X
+#include "h2883.h"
+#endif
+struct S2080 { int a; const char *s = "x//y"; };
+inline int f2080_0(int x) { return x * 0; }
+inline int f2080_1(int x) { return x * 1; }
+inline int f2080_2(int x) { return x * 2; }
+inline int f2080_3(int x) { return x * 3; }
+inline int f2080_4(int x) { return x * 4; }
+inline int f2080_5(int x) { return x * 5; }
+inline int f2080_6(int x) { return x * 6; }
+inline int f2080_7(int x) { return x * 7; }
+inline int f2080_8(int x) { return x * 8; }
+inline int f2080_9(int x) { return x * 9; }
+inline int f2080_10(int x) { return x * 10; }
+inline int f2080_11(int x) { return x * 11; }
+inline int f2080_12(int x) { return x * 12; }
+inline int f2080_13(int x) { return x * 13; }
+inline int f2080_14(int x) { return x * 14; }
+inline int f2080_15(int x) { return x * 15; }
+inline int f2080_16(int x) { return x * 16; }
+inline int f2080_17(int x) { return x * 17; }
+inline int f2080_18(int x) { return x * 18; }
+inline int f2080_19(int x) { return x * 19; }
+inline int f2080_20(int x) { return x * 20; }
+inline int f2080_21(int x) { return x * 21; }
+inline int f2080_22(int x) { return x * 22; }
+inline int f2080_23(int x) { return x * 23; }
+inline int f2080_24(int x) { return x * 24; }
+inline int f2080_25(int x) { return x * 25; }
+inline int f2080_26(int x) { return x * 26; }
+inline int f2080_27(int x) { return x * 27; }
+inline int f2080_28(int x) { return x * 28; }
+inline int f2080_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2081 */
+#include <vector>
+#include "h1287.h"
+#include "h9853.h"
+#include "h620.h"
+#include "h7.h"
+#include "h519.h"
+#ifdef X
+#include "h8623.h"
+#endif
+struct S2081 { int a; const char *s = "x//y"; };
+inline int f2081_0(int x) { return x * 0; }
+inline int f2081_1(int x) { return x * 1; }
+inline int f2081_2(int x) { return x * 2; }
+inline int f2081_3(int x) { return x * 3; }
+inline int f2081_4(int x) { return x * 4; }
+inline int f2081_5(int x) { return x * 5; }
+inline int f2081_6(int x) { return x * 6; }
+inline int f2081_7(int x) { return x * 7; }
+inline int f2081_8(int x) { return x * 8; }
+inline int f2081_9(int x) { return x * 9; }
+inline int f2081_10(int x) { return x * 10; }
+inline int f2081_11(int x) { return x * 11; }
+inline int f2081_12(int x) { return x * 12; }
+inline int f2081_13(int x) { return x * 13; }
+inline int f2081_14(int x) { return x * 14; }
+inline int f2081_15(int x) { return x * 15; }
+inline int f2081_16(int x) { return x * 16; }
+inline int f2081_17(int x) { return x * 17; }
+inline int f2081_18(int x) { return x * 18; }
+inline int f2081_19(int x) { return x * 19; }
+inline int f2081_20(int x) { return x * 20; }
+inline int f2081_21(int x) { return x * 21; }
+inline int f2081_22(int x) { return x * 22; }
+inline int f2081_23(int x) { return x * 23; }
+inline int f2081_24(int x) { return x * 24; }
+inline int f2081_25(int x) { return x * 25; }
+inline int f2081_26(int x) { return x * 26; }
+inline int f2081_27(int x) { return x * 27; }
+inline int f2081_28(int x) { return x * 28; }
+inline int f2081_29(int x) { return x * 29; }
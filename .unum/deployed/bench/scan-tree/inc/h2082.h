@@ -0,0 +1,42 @@
+#pragma once
+/* header 2082 */
+#include <vector>
+#include "h9597.h"
+#include "h8062.h"
+#include "h4925.h"
+#include "h7158.h"
+#include "h8481.h"
+#ifdef X
+#include "h647.h"
+#endif
+struct S2082 { int a; const char *s = "x//y"; };
+inline int f2082_0(int x) { return x * 0; }
+inline int f2082_1(int x) { return x * 1; }
+inline int f2082_2(int x) { return x * 2; }
+inline int f2082_3(int x) { return x * 3; }
+inline int f2082_4(int x) { return x * 4; }
+inline int f2082_5(int x) { return x * 5; }
+inline int f2082_6(int x) { return x * 6; }
+inline int f2082_7(int x) { return x * 7; }
+inline int f2082_8(int x) { return x * 8; }
+inline int f2082_9(int x) { return x * 9; }
+inline int f2082_10(int x) { return x * 10; }
+inline int f2082_11(int x) { return x * 11; }
+inline int f2082_12(int x) { return x * 12; }
+inline int f2082_13(int x) { return x * 13; }
+inline int f2082_14(int x) { return x * 14; }
+inline int f2082_15(int x) { return x * 15; }
+inline int f2082_16(int x) { return x * 16; }
+inline int f2082_17(int x) { return x * 17; }
+inline int f2082_18(int x) { return x * 18; }
+inline int f2082_19(int x) { return x * 19; }
+inline int f2082_20(int x) { return x * 20; }
+inline int f2082_21(int x) { return x * 21; }
+inline int f2082_22(int x) { return x * 22; }
+inline int f2082_23(int x) { return x * 23; }
+inline int f2082_24(int x) { return x * 24; }
+inline int f2082_25(int x) { return x * 25; }
+inline int f2082_26(int x) { return x * 26; }
+inline int f2082_27(int x) { return x * 27; }
+inline int f2082_28(int x) { return x * 28; }
+inline int f2082_29(int x) { return x * 29; }
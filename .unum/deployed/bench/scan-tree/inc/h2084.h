@@ -0,0 +1,42 @@
+#pragma once
+/* header 2084 */
+#include <vector>
+#include "h3896.h"
+#include "h1103.h"
+#include "h7063.h"
+#include "h5851.h"
+#include "h7737.h"
+#ifdef X
+#include "h3336.h"
+#endif
+struct S2084 { int a; const char *s = "x//y"; };
+inline int f2084_0(int x) { return x * 0; }
+inline int f2084_1(int x) { return x * 1; }
+inline int f2084_2(int x) { return x * 2; }
+inline int f2084_3(int x) { return x * 3; }
+inline int f2084_4(int x) { return x * 4; }
+inline int f2084_5(int x) { return x * 5; }
+inline int f2084_6(int x) { return x * 6; }
+inline int f2084_7(int x) { return x * 7; }
+inline int f2084_8(int x) { return x * 8; }
+inline int f2084_9(int x) { return x * 9; }
+inline int f2084_10(int x) { return x * 10; }
+inline int f2084_11(int x) { return x * 11; }
+inline int f2084_12(int x) { return x * 12; }
+inline int f2084_13(int x) { return x * 13; }
+inline int f2084_14(int x) { return x * 14; }
+inline int f2084_15(int x) { return x * 15; }
+inline int f2084_16(int x) { return x * 16; }
+inline int f2084_17(int x) { return x * 17; }
+inline int f2084_18(int x) { return x * 18; }
+inline int f2084_19(int x) { return x * 19; }
+inline int f2084_20(int x) { return x * 20; }
+inline int f2084_21(int x) { return x * 21; }
+inline int f2084_22(int x) { return x * 22; }
+inline int f2084_23(int x) { return x * 23; }
+inline int f2084_24(int x) { return x * 24; }
+inline int f2084_25(int x) { return x * 25; }
+inline int f2084_26(int x) { return x * 26; }
+inline int f2084_27(int x) { return x * 27; }
+inline int f2084_28(int x) { return x * 28; }
+inline int f2084_29(int x) { return x * 29; }
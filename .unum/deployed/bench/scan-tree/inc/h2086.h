@@ -0,0 +1,42 @@
+#pragma once
+/* header 2086 */
+#include <vector>
+#include "h5913.h"
+#include "h5610.h"
+#include "h6503.h"
+#include "h286.h"
+#include "h8389.h"
+#ifdef X
+#include "h3391.h"
+#endif
+struct S2086 { int a; const char *s = "x//y"; };
+inline int f2086_0(int x) { return x * 0; }
+inline int f2086_1(int x) { return x * 1; }
+inline int f2086_2(int x) { return x * 2; }
+inline int f2086_3(int x) { return x * 3; }
+inline int f2086_4(int x) { return x * 4; }
+inline int f2086_5(int x) { return x * 5; }
+inline int f2086_6(int x) { return x * 6; }
+inline int f2086_7(int x) { return x * 7; }
+inline int f2086_8(int x) { return x * 8; }
+inline int f2086_9(int x) { return x * 9; }
+inline int f2086_10(int x) { return x * 10; }
+inline int f2086_11(int x) { return x * 11; }
+inline int f2086_12(int x) { return x * 12; }
+inline int f2086_13(int x) { return x * 13; }
+inline int f2086_14(int x) { return x * 14; }
+inline int f2086_15(int x) { return x * 15; }
+inline int f2086_16(int x) { return x * 16; }
+inline int f2086_17(int x) { return x * 17; }
+inline int f2086_18(int x) { return x * 18; }
+inline int f2086_19(int x) { return x * 19; }
+inline int f2086_20(int x) { return x * 20; }
+inline int f2086_21(int x) { return x * 21; }
+inline int f2086_22(int x) { return x * 22; }
+inline int f2086_23(int x) { return x * 23; }
+inline int f2086_24(int x) { return x * 24; }
+inline int f2086_25(int x) { return x * 25; }
+inline int f2086_26(int x) { return x * 26; }
+inline int f2086_27(int x) { return x * 27; }
+inline int f2086_28(int x) { return x * 28; }
+inline int f2086_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 209 */
+#include <vector>
+#include "h4952.h"
+#include "h9371.h"
+#include "h6679.h"
+#include "h8247.h"
+#include "h9776.h"
+#ifdef X
+#include "h1760.h"
+#endif
+struct S209 { int a; const char *s = "x//y"; };
+inline int f209_0(int x) { return x * 0; }
+inline int f209_1(int x) { return x * 1; }
+inline int f209_2(int x) { return x * 2; }
+inline int f209_3(int x) { return x * 3; }
+inline int f209_4(int x) { return x * 4; }
+inline int f209_5(int x) { return x * 5; }
+inline int f209_6(int x) { return x * 6; }
+inline int f209_7(int x) { return x * 7; }
+inline int f209_8(int x) { return x * 8; }
+inline int f209_9(int x) { return x * 9; }
+inline int f209_10(int x) { return x * 10; }
+inline int f209_11(int x) { return x * 11; }
+inline int f209_12(int x) { return x * 12; }
+inline int f209_13(int x) { return x * 13; }
+inline int f209_14(int x) { return x * 14; }
+inline int f209_15(int x) { return x * 15; }
+inline int f209_16(int x) { return x * 16; }
+inline int f209_17(int x) { return x * 17; }
+inline int f209_18(int x) { return x * 18; }
+inline int f209_19(int x) { return x * 19; }
+inline int f209_20(int x) { return x * 20; }
+inline int f209_21(int x) { return x * 21; }
+inline int f209_22(int x) { return x * 22; }
+inline int f209_23(int x) { return x * 23; }
+inline int f209_24(int x) { return x * 24; }
+inline int f209_25(int x) { return x * 25; }
+inline int f209_26(int x) { return x * 26; }
+inline int f209_27(int x) { return x * 27; }
+inline int f209_28(int x) { return x * 28; }
+inline int f209_29(int x) { return x * 29; }
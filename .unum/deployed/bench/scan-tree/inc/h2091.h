@@ -0,0 +1,42 @@
+#pragma once
+/* header 2091 */
+#include <vector>
+#include "h1857.h"
+#include "h2160.h"
+#include "h9313.h"
+#include "h487.h"
+#include "h6415.h"
+#ifdef X
+#include "h1899.h"
+#endif
+struct S2091 { int a; const char *s = "x//y"; };
+inline int f2091_0(int x) { return x * 0; }
+inline int f2091_1(int x) { return x * 1; }
+inline int f2091_2(int x) { return x * 2; }
+inline int f2091_3(int x) { return x * 3; }
+inline int f2091_4(int x) { return x * 4; }
+inline int f2091_5(int x) { return x * 5; }
+inline int f2091_6(int x) { return x * 6; }
+inline int f2091_7(int x) { return x * 7; }
+inline int f2091_8(int x) { return x * 8; }
+inline int f2091_9(int x) { return x * 9; }
+inline int f2091_10(int x) { return x * 10; }
+inline int f2091_11(int x) { return x * 11; }
+inline int f2091_12(int x) { return x * 12; }
+inline int f2091_13(int x) { return x * 13; }
+inline int f2091_14(int x) { return x * 14; }
+inline int f2091_15(int x) { return x * 15; }
+inline int f2091_16(int x) { return x * 16; }
+inline int f2091_17(int x) { return x * 17; }
+inline int f2091_18(int x) { return x * 18; }
+inline int f2091_19(int x) { return x * 19; }
+inline int f2091_20(int x) { return x * 20; }
+inline int f2091_21(int x) { return x * 21; }
+inline int f2091_22(int x) { return x * 22; }
+inline int f2091_23(int x) { return x * 23; }
+inline int f2091_24(int x) { return x * 24; }
+inline int f2091_25(int x) { return x * 25; }
+inline int f2091_26(int x) { return x * 26; }
+inline int f2091_27(int x) { return x * 27; }
+inline int f2091_28(int x) { return x * 28; }
+inline int f2091_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2092 */
+#include <vector>
+#include "h1269.h"
+#include "h9948.h"
+#include "h4815.h"
+#include "h7251.h"
+#include "h1238.h"
+#ifdef X
+#include "h2206.h"
+#endif
+struct S2092 { int a; const char *s = "x//y"; };
+inline int f2092_0(int x) { return x * 0; }
+inline int f2092_1(int x) { return x * 1; }
+inline int f2092_2(int x) { return x * 2; }
+inline int f2092_3(int x) { return x * 3; }
+inline int f2092_4(int x) { return x * 4; }
+inline int f2092_5(int x) { return x * 5; }
+inline int f2092_6(int x) { return x * 6; }
+inline int f2092_7(int x) { return x * 7; }
+inline int f2092_8(int x) { return x * 8; }
+inline int f2092_9(int x) { return x * 9; }
+inline int f2092_10(int x) { return x * 10; }
+inline int f2092_11(int x) { return x * 11; }
+inline int f2092_12(int x) { return x * 12; }
+inline int f2092_13(int x) { return x * 13; }
+inline int f2092_14(int x) { return x * 14; }
+inline int f2092_15(int x) { return x * 15; }
+inline int f2092_16(int x) { return x * 16; }
+inline int f2092_17(int x) { return x * 17; }
+inline int f2092_18(int x) { return x * 18; }
+inline int f2092_19(int x) { return x * 19; }
+inline int f2092_20(int x) { return x * 20; }
+inline int f2092_21(int x) { return x * 21; }
+inline int f2092_22(int x) { return x * 22; }
+inline int f2092_23(int x) { return x * 23; }
+inline int f2092_24(int x) { return x * 24; }
+inline int f2092_25(int x) { return x * 25; }
+inline int f2092_26(int x) { return x * 26; }
+inline int f2092_27(int x) { return x * 27; }
+inline int f2092_28(int x) { return x * 28; }
+inline int f2092_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2093 */
+#include <vector>
+#include "h472.h"
+#include "h6971.h"
+#include "h100.h"
+#include "h4403.h"
+#include "h9895.h"
+#ifdef X
+#include "h1024.h"
+#endif
+struct S2093 { int a; const char *s = "x//y"; };
+inline int f2093_0(int x) { return x * 0; }
+inline int f2093_1(int x) { return x * 1; }
+inline int f2093_2(int x) { return x * 2; }
+inline int f2093_3(int x) { return x * 3; }
+inline int f2093_4(int x) { return x * 4; }
+inline int f2093_5(int x) { return x * 5; }
+inline int f2093_6(int x) { return x * 6; }
+inline int f2093_7(int x) { return x * 7; }
+inline int f2093_8(int x) { return x * 8; }
+inline int f2093_9(int x) { return x * 9; }
+inline int f2093_10(int x) { return x * 10; }
+inline int f2093_11(int x) { return x * 11; }
+inline int f2093_12(int x) { return x * 12; }
+inline int f2093_13(int x) { return x * 13; }
+inline int f2093_14(int x) { return x * 14; }
+inline int f2093_15(int x) { return x * 15; }
+inline int f2093_16(int x) { return x * 16; }
+inline int f2093_17(int x) { return x * 17; }
+inline int f2093_18(int x) { return x * 18; }
+inline int f2093_19(int x) { return x * 19; }
+inline int f2093_20(int x) { return x * 20; }
+inline int f2093_21(int x) { return x * 21; }
+inline int f2093_22(int x) { return x * 22; }
+inline int f2093_23(int x) { return x * 23; }
+inline int f2093_24(int x) { return x * 24; }
+inline int f2093_25(int x) { return x * 25; }
+inline int f2093_26(int x) { return x * 26; }
+inline int f2093_27(int x) { return x * 27; }
+inline int f2093_28(int x) { return x * 28; }
+inline int f2093_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2094 */
+#include <vector>
+#include "h6275.h"
+#include "h2342.h"
+#include "h656.h"
+#include "h7455.h"
+#include "h3526.h"
+#ifdef X
+#include "h2059.h"
+#endif
+struct S2094 { int a; const char *s = "x//y"; };
+inline int f2094_0(int x) { return x * 0; }
+inline int f2094_1(int x) { return x * 1; }
+inline int f2094_2(int x) { return x * 2; }
+inline int f2094_3(int x) { return x * 3; }
+inline int f2094_4(int x) { return x * 4; }
+inline int f2094_5(int x) { return x * 5; }
+inline int f2094_6(int x) { return x * 6; }
+inline int f2094_7(int x) { return x * 7; }
+inline int f2094_8(int x) { return x * 8; }
+inline int f2094_9(int x) { return x * 9; }
+inline int f2094_10(int x) { return x * 10; }
+inline int f2094_11(int x) { return x * 11; }
+inline int f2094_12(int x) { return x * 12; }
+inline int f2094_13(int x) { return x * 13; }
+inline int f2094_14(int x) { return x * 14; }
+inline int f2094_15(int x) { return x * 15; }
+inline int f2094_16(int x) { return x * 16; }
+inline int f2094_17(int x) { return x * 17; }
+inline int f2094_18(int x) { return x * 18; }
+inline int f2094_19(int x) { return x * 19; }
+inline int f2094_20(int x) { return x * 20; }
+inline int f2094_21(int x) { return x * 21; }
+inline int f2094_22(int x) { return x * 22; }
+inline int f2094_23(int x) { return x * 23; }
+inline int f2094_24(int x) { return x * 24; }
+inline int f2094_25(int x) { return x * 25; }
+inline int f2094_26(int x) { return x * 26; }
+inline int f2094_27(int x) { return x * 27; }
+inline int f2094_28(int x) { return x * 28; }
+inline int f2094_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2095 */
+#include <vector>
+#include "h8748.h"
+#include "h4818.h"
+#include "h6935.h"
+#include "h9926.h"
+#include "h7091.h"
+#ifdef X
+#include "h6576.h"
+#endif
+struct S2095 { int a; const char *s = "x//y"; };
+inline int f2095_0(int x) { return x * 0; }
+inline int f2095_1(int x) { return x * 1; }
+inline int f2095_2(int x) { return x * 2; }
+inline int f2095_3(int x) { return x * 3; }
+inline int f2095_4(int x) { return x * 4; }
+inline int f2095_5(int x) { return x * 5; }
+inline int f2095_6(int x) { return x * 6; }
+inline int f2095_7(int x) { return x * 7; }
+inline int f2095_8(int x) { return x * 8; }
+inline int f2095_9(int x) { return x * 9; }
+inline int f2095_10(int x) { return x * 10; }
+inline int f2095_11(int x) { return x * 11; }
+inline int f2095_12(int x) { return x * 12; }
+inline int f2095_13(int x) { return x * 13; }
+inline int f2095_14(int x) { return x * 14; }
+inline int f2095_15(int x) { return x * 15; }
+inline int f2095_16(int x) { return x * 16; }
+inline int f2095_17(int x) { return x * 17; }
+inline int f2095_18(int x) { return x * 18; }
+inline int f2095_19(int x) { return x * 19; }
+inline int f2095_20(int x) { return x * 20; }
+inline int f2095_21(int x) { return x * 21; }
+inline int f2095_22(int x) { return x * 22; }
+inline int f2095_23(int x) { return x * 23; }
+inline int f2095_24(int x) { return x * 24; }
+inline int f2095_25(int x) { return x * 25; }
+inline int f2095_26(int x) { return x * 26; }
+inline int f2095_27(int x) { return x * 27; }
+inline int f2095_28(int x) { return x * 28; }
+inline int f2095_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2096 */
+#include <vector>
+#include "h8033.h"
+#include "h2162.h"
+#include "h5559.h"
+#include "h3068.h"
+#include "h7328.h"
+#ifdef X
+#include "h1870.h"
+#endif
+struct S2096 { int a; const char *s = "x//y"; };
+inline int f2096_0(int x) { return x * 0; }
+inline int f2096_1(int x) { return x * 1; }
+inline int f2096_2(int x) { return x * 2; }
+inline int f2096_3(int x) { return x * 3; }
+inline int f2096_4(int x) { return x * 4; }
+inline int f2096_5(int x) { return x * 5; }
+inline int f2096_6(int x) { return x * 6; }
+inline int f2096_7(int x) { return x * 7; }
+inline int f2096_8(int x) { return x * 8; }
+inline int f2096_9(int x) { return x * 9; }
+inline int f2096_10(int x) { return x * 10; }
+inline int f2096_11(int x) { return x * 11; }
+inline int f2096_12(int x) { return x * 12; }
+inline int f2096_13(int x) { return x * 13; }
+inline int f2096_14(int x) { return x * 14; }
+inline int f2096_15(int x) { return x * 15; }
+inline int f2096_16(int x) { return x * 16; }
+inline int f2096_17(int x) { return x * 17; }
+inline int f2096_18(int x) { return x * 18; }
+inline int f2096_19(int x) { return x * 19; }
+inline int f2096_20(int x) { return x * 20; }
+inline int f2096_21(int x) { return x * 21; }
+inline int f2096_22(int x) { return x * 22; }
+inline int f2096_23(int x) { return x * 23; }
+inline int f2096_24(int x) { return x * 24; }
+inline int f2096_25(int x) { return x * 25; }
+inline int f2096_26(int x) { return x * 26; }
+inline int f2096_27(int x) { return x * 27; }
+inline int f2096_28(int x) { return x * 28; }
+inline int f2096_29(int x) { return x * 29; }
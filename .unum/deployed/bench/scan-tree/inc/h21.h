@@ -0,0 +1,42 @@
+#pragma once
+/* header 21 */
+#include <vector>
+#include "h4026.h"
+#include "h8610.h"
+#include "h7492.h"
+#include "h3993.h"
+#include "h7198.h"
+#ifdef X
+#include "h5478.h"
+#endif
+struct S21 { int a; const char *s = "x//y"; };
+inline int f21_0(int x) { return x * 0; }
+inline int f21_1(int x) { return x * 1; }
+inline int f21_2(int x) { return x * 2; }
+inline int f21_3(int x) { return x * 3; }
+inline int f21_4(int x) { return x * 4; }
+inline int f21_5(int x) { return x * 5; }
+inline int f21_6(int x) { return x * 6; }
+inline int f21_7(int x) { return x * 7; }
+inline int f21_8(int x) { return x * 8; }
+inline int f21_9(int x) { return x * 9; }
+inline int f21_10(int x) { return x * 10; }
+inline int f21_11(int x) { return x * 11; }
+inline int f21_12(int x) { return x * 12; }
+inline int f21_13(int x) { return x * 13; }
+inline int f21_14(int x) { return x * 14; }
+inline int f21_15(int x) { return x * 15; }
+inline int f21_16(int x) { return x * 16; }
+inline int f21_17(int x) { return x * 17; }
+inline int f21_18(int x) { return x * 18; }
+inline int f21_19(int x) { return x * 19; }
+inline int f21_20(int x) { return x * 20; }
+inline int f21_21(int x) { return x * 21; }
+inline int f21_22(int x) { return x * 22; }
+inline int f21_23(int x) { return x * 23; }
+inline int f21_24(int x) { return x * 24; }
+inline int f21_25(int x) { return x * 25; }
+inline int f21_26(int x) { return x * 26; }
+inline int f21_27(int x) { return x * 27; }
+inline int f21_28(int x) { return x * 28; }
+inline int f21_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 210 */
+#include <vector>
+#include "h6297.h"
+#include "h2057.h"
+#include "h7253.h"
+#include "h6687.h"
+#include "h1568.h"
+#ifdef X
+#include "h1943.h"
+#endif
+struct S210 { int a; const char *s = "x//y"; };
+inline int f210_0(int x) { return x * 0; }
+inline int f210_1(int x) { return x * 1; }
+inline int f210_2(int x) { return x * 2; }
+inline int f210_3(int x) { return x * 3; }
+inline int f210_4(int x) { return x * 4; }
+inline int f210_5(int x) { return x * 5; }
+inline int f210_6(int x) { return x * 6; }
+inline int f210_7(int x) { return x * 7; }
+inline int f210_8(int x) { return x * 8; }
+inline int f210_9(int x) { return x * 9; }
+inline int f210_10(int x) { return x * 10; }
+inline int f210_11(int x) { return x * 11; }
+inline int f210_12(int x) { return x * 12; }
+inline int f210_13(int x) { return x * 13; }
+inline int f210_14(int x) { return x * 14; }
+inline int f210_15(int x) { return x * 15; }
+inline int f210_16(int x) { return x * 16; }
+inline int f210_17(int x) { return x * 17; }
+inline int f210_18(int x) { return x * 18; }
+inline int f210_19(int x) { return x * 19; }
+inline int f210_20(int x) { return x * 20; }
+inline int f210_21(int x) { return x * 21; }
+inline int f210_22(int x) { return x * 22; }
+inline int f210_23(int x) { return x * 23; }
+inline int f210_24(int x) { return x * 24; }
+inline int f210_25(int x) { return x * 25; }
+inline int f210_26(int x) { return x * 26; }
+inline int f210_27(int x) { return x * 27; }
+inline int f210_28(int x) { return x * 28; }
+inline int f210_29(int x) { return x * 29; }
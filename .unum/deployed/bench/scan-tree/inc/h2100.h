@@ -0,0 +1,42 @@
+#pragma once
+/* header 2100 */
+#include <vector>
+#include "h3997.h"
+#include "h647.h"
+#include "h4132.h"
+#include "h1628.h"
+#include "h6118.h"
+#ifdef X
+#include "h9968.h"
+#endif
+struct S2100 { int a; const char *s = "x//y"; };
+inline int f2100_0(int x) { return x * 0; }
+inline int f2100_1(int x) { return x * 1; }
+inline int f2100_2(int x) { return x * 2; }
+inline int f2100_3(int x) { return x * 3; }
+inline int f2100_4(int x) { return x * 4; }
+inline int f2100_5(int x) { return x * 5; }
+inline int f2100_6(int x) { return x * 6; }
+inline int f2100_7(int x) { return x * 7; }
+inline int f2100_8(int x) { return x * 8; }
+inline int f2100_9(int x) { return x * 9; }
+inline int f2100_10(int x) { return x * 10; }
+inline int f2100_11(int x) { return x * 11; }
+inline int f2100_12(int x) { return x * 12; }
+inline int f2100_13(int x) { return x * 13; }
+inline int f2100_14(int x) { return x * 14; }
+inline int f2100_15(int x) { return x * 15; }
+inline int f2100_16(int x) { return x * 16; }
+inline int f2100_17(int x) { return x * 17; }
+inline int f2100_18(int x) { return x * 18; }
+inline int f2100_19(int x) { return x * 19; }
+inline int f2100_20(int x) { return x * 20; }
+inline int f2100_21(int x) { return x * 21; }
+inline int f2100_22(int x) { return x * 22; }
+inline int f2100_23(int x) { return x * 23; }
+inline int f2100_24(int x) { return x * 24; }
+inline int f2100_25(int x) { return x * 25; }
+inline int f2100_26(int x) { return x * 26; }
+inline int f2100_27(int x) { return x * 27; }
+inline int f2100_28(int x) { return x * 28; }
+inline int f2100_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2103 */
+#include <vector>
+#include "h420.h"
+#include "h7713.h"
+#include "h7501.h"
+#include "h1221.h"
+#include "h2960.h"
+#ifdef X
+#include "h7950.h"
+#endif
+struct S2103 { int a; const char *s = "x//y"; };
+inline int f2103_0(int x) { return x * 0; }
+inline int f2103_1(int x) { return x * 1; }
+inline int f2103_2(int x) { return x * 2; }
+inline int f2103_3(int x) { return x * 3; }
+inline int f2103_4(int x) { return x * 4; }
+inline int f2103_5(int x) { return x * 5; }
+inline int f2103_6(int x) { return x * 6; }
+inline int f2103_7(int x) { return x * 7; }
+inline int f2103_8(int x) { return x * 8; }
+inline int f2103_9(int x) { return x * 9; }
+inline int f2103_10(int x) { return x * 10; }
+inline int f2103_11(int x) { return x * 11; }
+inline int f2103_12(int x) { return x * 12; }
+inline int f2103_13(int x) { return x * 13; }
+inline int f2103_14(int x) { return x * 14; }
+inline int f2103_15(int x) { return x * 15; }
+inline int f2103_16(int x) { return x * 16; }
+inline int f2103_17(int x) { return x * 17; }
+inline int f2103_18(int x) { return x * 18; }
+inline int f2103_19(int x) { return x * 19; }
+inline int f2103_20(int x) { return x * 20; }
+inline int f2103_21(int x) { return x * 21; }
+inline int f2103_22(int x) { return x * 22; }
+inline int f2103_23(int x) { return x * 23; }
+inline int f2103_24(int x) { return x * 24; }
+inline int f2103_25(int x) { return x * 25; }
+inline int f2103_26(int x) { return x * 26; }
+inline int f2103_27(int x) { return x * 27; }
+inline int f2103_28(int x) { return x * 28; }
+inline int f2103_29(int x) { return x * 29; }
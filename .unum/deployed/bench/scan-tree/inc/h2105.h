@@ -0,0 +1,42 @@
+#pragma once
+/* header 2105 */
+#include <vector>
+#include "h2931.h"
+#include "h494.h"
+#include "h4191.h"
+#include "h8754.h"
+#include "h614.h"
+#ifdef X
+#include "h5411.h"
+#endif
+struct S2105 { int a; const char *s = "x//y"; };
+inline int f2105_0(int x) { return x * 0; }
+inline int f2105_1(int x) { return x * 1; }
+inline int f2105_2(int x) { return x * 2; }
+inline int f2105_3(int x) { return x * 3; }
+inline int f2105_4(int x) { return x * 4; }
+inline int f2105_5(int x) { return x * 5; }
+inline int f2105_6(int x) { return x * 6; }
+inline int f2105_7(int x) { return x * 7; }
+inline int f2105_8(int x) { return x * 8; }
+inline int f2105_9(int x) { return x * 9; }
+inline int f2105_10(int x) { return x * 10; }
+inline int f2105_11(int x) { return x * 11; }
+inline int f2105_12(int x) { return x * 12; }
+inline int f2105_13(int x) { return x * 13; }
+inline int f2105_14(int x) { return x * 14; }
+inline int f2105_15(int x) { return x * 15; }
+inline int f2105_16(int x) { return x * 16; }
+inline int f2105_17(int x) { return x * 17; }
+inline int f2105_18(int x) { return x * 18; }
+inline int f2105_19(int x) { return x * 19; }
+inline int f2105_20(int x) { return x * 20; }
+inline int f2105_21(int x) { return x * 21; }
+inline int f2105_22(int x) { return x * 22; }
+inline int f2105_23(int x) { return x * 23; }
+inline int f2105_24(int x) { return x * 24; }
+inline int f2105_25(int x) { return x * 25; }
+inline int f2105_26(int x) { return x * 26; }
+inline int f2105_27(int x) { return x * 27; }
+inline int f2105_28(int x) { return x * 28; }
+inline int f2105_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2106 */
+#include <vector>
+#include "h6432.h"
+#include "h5407.h"
+#include "h9150.h"
+#include "h9102.h"
+#include "h1130.h"
+#ifdef X
+#include "h4325.h"
+#endif
+struct S2106 { int a; const char *s = "x//y"; };
+inline int f2106_0(int x) { return x * 0; }
+inline int f2106_1(int x) { return x * 1; }
+inline int f2106_2(int x) { return x * 2; }
+inline int f2106_3(int x) { return x * 3; }
+inline int f2106_4(int x) { return x * 4; }
+inline int f2106_5(int x) { return x * 5; }
+inline int f2106_6(int x) { return x * 6; }
+inline int f2106_7(int x) { return x * 7; }
+inline int f2106_8(int x) { return x * 8; }
+inline int f2106_9(int x) { return x * 9; }
+inline int f2106_10(int x) { return x * 10; }
+inline int f2106_11(int x) { return x * 11; }
+inline int f2106_12(int x) { return x * 12; }
+inline int f2106_13(int x) { return x * 13; }
+inline int f2106_14(int x) { return x * 14; }
+inline int f2106_15(int x) { return x * 15; }
+inline int f2106_16(int x) { return x * 16; }
+inline int f2106_17(int x) { return x * 17; }
+inline int f2106_18(int x) { return x * 18; }
+inline int f2106_19(int x) { return x * 19; }
+inline int f2106_20(int x) { return x * 20; }
+inline int f2106_21(int x) { return x * 21; }
+inline int f2106_22(int x) { return x * 22; }
+inline int f2106_23(int x) { return x * 23; }
+inline int f2106_24(int x) { return x * 24; }
+inline int f2106_25(int x) { return x * 25; }
+inline int f2106_26(int x) { return x * 26; }
+inline int f2106_27(int x) { return x * 27; }
+inline int f2106_28(int x) { return x * 28; }
+inline int f2106_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2107 */
+#include <vector>
+#include "h6662.h"
+#include "h486.h"
+#include "h8208.h"
+#include "h8872.h"
+#include "h6600.h"
+#ifdef X
+#include "h2747.h"
+#endif
+struct S2107 { int a; const char *s = "x//y"; };
+inline int f2107_0(int x) { return x * 0; }
+inline int f2107_1(int x) { return x * 1; }
+inline int f2107_2(int x) { return x * 2; }
+inline int f2107_3(int x) { return x * 3; }
+inline int f2107_4(int x) { return x * 4; }
+inline int f2107_5(int x) { return x * 5; }
+inline int f2107_6(int x) { return x * 6; }
+inline int f2107_7(int x) { return x * 7; }
+inline int f2107_8(int x) { return x * 8; }
+inline int f2107_9(int x) { return x * 9; }
+inline int f2107_10(int x) { return x * 10; }
+inline int f2107_11(int x) { return x * 11; }
+inline int f2107_12(int x) { return x * 12; }
+inline int f2107_13(int x) { return x * 13; }
+inline int f2107_14(int x) { return x * 14; }
+inline int f2107_15(int x) { return x * 15; }
+inline int f2107_16(int x) { return x * 16; }
+inline int f2107_17(int x) { return x * 17; }
+inline int f2107_18(int x) { return x * 18; }
+inline int f2107_19(int x) { return x * 19; }
+inline int f2107_20(int x) { return x * 20; }
+inline int f2107_21(int x) { return x * 21; }
+inline int f2107_22(int x) { return x * 22; }
+inline int f2107_23(int x) { return x * 23; }
+inline int f2107_24(int x) { return x * 24; }
+inline int f2107_25(int x) { return x * 25; }
+inline int f2107_26(int x) { return x * 26; }
+inline int f2107_27(int x) { return x * 27; }
+inline int f2107_28(int x) { return x * 28; }
+inline int f2107_29(int x) { return x * 29; }
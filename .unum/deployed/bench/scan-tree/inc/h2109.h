@@ -0,0 +1,42 @@
+#pragma once
+/* header 2109 */
+#include <vector>
+#include "h9750.h"
+#include "h7460.h"
+#include "h5463.h"
+#include "h8226.h"
+#include "h2975.h"
+#ifdef X
+#include "h6748.h"
+#endif
+struct S2109 { int a; const char *s = "x//y"; };
+inline int f2109_0(int x) { return x * 0; }
+inline int f2109_1(int x) { return x * 1; }
+inline int f2109_2(int x) { return x * 2; }
+inline int f2109_3(int x) { return x * 3; }
+inline int f2109_4(int x) { return x * 4; }
+inline int f2109_5(int x) { return x * 5; }
+inline int f2109_6(int x) { return x * 6; }
+inline int f2109_7(int x) { return x * 7; }
+inline int f2109_8(int x) { return x * 8; }
+inline int f2109_9(int x) { return x * 9; }
+inline int f2109_10(int x) { return x * 10; }
+inline int f2109_11(int x) { return x * 11; }
+inline int f2109_12(int x) { return x * 12; }
+inline int f2109_13(int x) { return x * 13; }
+inline int f2109_14(int x) { return x * 14; }
+inline int f2109_15(int x) { return x * 15; }
+inline int f2109_16(int x) { return x * 16; }
+inline int f2109_17(int x) { return x * 17; }
+inline int f2109_18(int x) { return x * 18; }
+inline int f2109_19(int x) { return x * 19; }
+inline int f2109_20(int x) { return x * 20; }
+inline int f2109_21(int x) { return x * 21; }
+inline int f2109_22(int x) { return x * 22; }
+inline int f2109_23(int x) { return x * 23; }
+inline int f2109_24(int x) { return x * 24; }
+inline int f2109_25(int x) { return x * 25; }
+inline int f2109_26(int x) { return x * 26; }
+inline int f2109_27(int x) { return x * 27; }
+inline int f2109_28(int x) { return x * 28; }
+inline int f2109_29(int x) { return x * 29; }
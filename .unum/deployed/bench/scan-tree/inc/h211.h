@@ -0,0 +1,42 @@
+#pragma once
+/* header 211 */
+#include <vector>
+#include "h9084.h"
+#include "h4196.h"
+#include "h4447.h"
+#include "h1872.h"
+#include "h1798.h"
+#ifdef X
+#include "h7394.h"
+#endif
+struct S211 { int a; const char *s = "x//y"; };
+inline int f211_0(int x) { return x * 0; }
+inline int f211_1(int x) { return x * 1; }
+inline int f211_2(int x) { return x * 2; }
+inline int f211_3(int x) { return x * 3; }
+inline int f211_4(int x) { return x * 4; }
+inline int f211_5(int x) { return x * 5; }
+inline int f211_6(int x) { return x * 6; }
+inline int f211_7(int x) { return x * 7; }
+inline int f211_8(int x) { return x * 8; }
+inline int f211_9(int x) { return x * 9; }
+inline int f211_10(int x) { return x * 10; }
+inline int f211_11(int x) { return x * 11; }
+inline int f211_12(int x) { return x * 12; }
+inline int f211_13(int x) { return x * 13; }
+inline int f211_14(int x) { return x * 14; }
+inline int f211_15(int x) { return x * 15; }
+inline int f211_16(int x) { return x * 16; }
+inline int f211_17(int x) { return x * 17; }
+inline int f211_18(int x) { return x * 18; }
+inline int f211_19(int x) { return x * 19; }
+inline int f211_20(int x) { return x * 20; }
+inline int f211_21(int x) { return x * 21; }
+inline int f211_22(int x) { return x * 22; }
+inline int f211_23(int x) { return x * 23; }
+inline int f211_24(int x) { return x * 24; }
+inline int f211_25(int x) { return x * 25; }
+inline int f211_26(int x) { return x * 26; }
+inline int f211_27(int x) { return x * 27; }
+inline int f211_28(int x) { return x * 28; }
+inline int f211_29(int x) { return x * 29; }
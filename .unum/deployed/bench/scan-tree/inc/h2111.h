@@ -0,0 +1,42 @@
+#pragma once
+/* header 2111 */
+#include <vector>
+#include "h5830.h"
+#include "h2931.h"
+#include "h4149.h"
+#include "h3296.h"
+#include "h107.h"
+#ifdef X
+#include "h3550.h"
+#endif
+struct S2111 { int a; const char *s = "x//y"; };
+inline int f2111_0(int x) { return x * 0; }
+inline int f2111_1(int x) { return x * 1; }
+inline int f2111_2(int x) { return x * 2; }
+inline int f2111_3(int x) { return x * 3; }
+inline int f2111_4(int x) { return x * 4; }
+inline int f2111_5(int x) { return x * 5; }
+inline int f2111_6(int x) { return x * 6; }
+inline int f2111_7(int x) { return x * 7; }
+inline int f2111_8(int x) { return x * 8; }
+inline int f2111_9(int x) { return x * 9; }
+inline int f2111_10(int x) { return x * 10; }
+inline int f2111_11(int x) { return x * 11; }
+inline int f2111_12(int x) { return x * 12; }
+inline int f2111_13(int x) { return x * 13; }
+inline int f2111_14(int x) { return x * 14; }
+inline int f2111_15(int x) { return x * 15; }
+inline int f2111_16(int x) { return x * 16; }
+inline int f2111_17(int x) { return x * 17; }
+inline int f2111_18(int x) { return x * 18; }
+inline int f2111_19(int x) { return x * 19; }
+inline int f2111_20(int x) { return x * 20; }
+inline int f2111_21(int x) { return x * 21; }
+inline int f2111_22(int x) { return x * 22; }
+inline int f2111_23(int x) { return x * 23; }
+inline int f2111_24(int x) { return x * 24; }
+inline int f2111_25(int x) { return x * 25; }
+inline int f2111_26(int x) { return x * 26; }
+inline int f2111_27(int x) { return x * 27; }
+inline int f2111_28(int x) { return x * 28; }
+inline int f2111_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2113 */
+#include <vector>
+#include "h3534.h"
+#include "h2496.h"
+#include "h1128.h"
+#include "h9795.h"
+#include "h3748.h"
+#ifdef X
+#include "h6509.h"
+#endif
+struct S2113 { int a; const char *s = "x//y"; };
+inline int f2113_0(int x) { return x * 0; }
+inline int f2113_1(int x) { return x * 1; }
+inline int f2113_2(int x) { return x * 2; }
+inline int f2113_3(int x) { return x * 3; }
+inline int f2113_4(int x) { return x * 4; }
+inline int f2113_5(int x) { return x * 5; }
+inline int f2113_6(int x) { return x * 6; }
+inline int f2113_7(int x) { return x * 7; }
+inline int f2113_8(int x) { return x * 8; }
+inline int f2113_9(int x) { return x * 9; }
+inline int f2113_10(int x) { return x * 10; }
+inline int f2113_11(int x) { return x * 11; }
+inline int f2113_12(int x) { return x * 12; }
+inline int f2113_13(int x) { return x * 13; }
+inline int f2113_14(int x) { return x * 14; }
+inline int f2113_15(int x) { return x * 15; }
+inline int f2113_16(int x) { return x * 16; }
+inline int f2113_17(int x) { return x * 17; }
+inline int f2113_18(int x) { return x * 18; }
+inline int f2113_19(int x) { return x * 19; }
+inline int f2113_20(int x) { return x * 20; }
+inline int f2113_21(int x) { return x * 21; }
+inline int f2113_22(int x) { return x * 22; }
+inline int f2113_23(int x) { return x * 23; }
+inline int f2113_24(int x) { return x * 24; }
+inline int f2113_25(int x) { return x * 25; }
+inline int f2113_26(int x) { return x * 26; }
+inline int f2113_27(int x) { return x * 27; }
+inline int f2113_28(int x) { return x * 28; }
+inline int f2113_29(int x) { return x * 29; }
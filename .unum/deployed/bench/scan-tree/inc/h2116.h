@@ -0,0 +1,42 @@
+#pragma once
+/* header 2116 */
+#include <vector>
+#include "h5925.h"
+#include "h1016.h"
+#include "h8638.h"
+#include "h7812.h"
+#include "h2086.h"
+#ifdef X
+#include "h6643.h"
+#endif
+struct S2116 { int a; const char *s = "x//y"; };
+inline int f2116_0(int x) { return x * 0; }
+inline int f2116_1(int x) { return x * 1; }
+inline int f2116_2(int x) { return x * 2; }
+inline int f2116_3(int x) { return x * 3; }
+inline int f2116_4(int x) { return x * 4; }
+inline int f2116_5(int x) { return x * 5; }
+inline int f2116_6(int x) { return x * 6; }
+inline int f2116_7(int x) { return x * 7; }
+inline int f2116_8(int x) { return x * 8; }
+inline int f2116_9(int x) { return x * 9; }
+inline int f2116_10(int x) { return x * 10; }
+inline int f2116_11(int x) { return x * 11; }
+inline int f2116_12(int x) { return x * 12; }
+inline int f2116_13(int x) { return x * 13; }
+inline int f2116_14(int x) { return x * 14; }
+inline int f2116_15(int x) { return x * 15; }
+inline int f2116_16(int x) { return x * 16; }
+inline int f2116_17(int x) { return x * 17; }
+inline int f2116_18(int x) { return x * 18; }
+inline int f2116_19(int x) { return x * 19; }
+inline int f2116_20(int x) { return x * 20; }
+inline int f2116_21(int x) { return x * 21; }
+inline int f2116_22(int x) { return x * 22; }
+inline int f2116_23(int x) { return x * 23; }
+inline int f2116_24(int x) { return x * 24; }
+inline int f2116_25(int x) { return x * 25; }
+inline int f2116_26(int x) { return x * 26; }
+inline int f2116_27(int x) { return x * 27; }
+inline int f2116_28(int x) { return x * 28; }
+inline int f2116_29(int x) { return x * 29; }
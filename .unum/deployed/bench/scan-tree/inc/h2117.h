@@ -0,0 +1,42 @@
+#pragma once
+/* header 2117 */
+#include <vector>
+#include "h6965.h"
+#include "h2983.h"
+#include "h2589.h"
+#include "h8264.h"
+#include "h2890.h"
+#ifdef X
+#include "h2357.h"
+#endif
+struct S2117 { int a; const char *s = "x//y"; };
+inline int f2117_0(int x) { return x * 0; }
+inline int f2117_1(int x) { return x * 1; }
+inline int f2117_2(int x) { return x * 2; }
+inline int f2117_3(int x) { return x * 3; }
+inline int f2117_4(int x) { return x * 4; }
+inline int f2117_5(int x) { return x * 5; }
+inline int f2117_6(int x) { return x * 6; }
+inline int f2117_7(int x) { return x * 7; }
+inline int f2117_8(int x) { return x * 8; }
+inline int f2117_9(int x) { return x * 9; }
+inline int f2117_10(int x) { return x * 10; }
+inline int f2117_11(int x) { return x * 11; }
+inline int f2117_12(int x) { return x * 12; }
+inline int f2117_13(int x) { return x * 13; }
+inline int f2117_14(int x) { return x * 14; }
+inline int f2117_15(int x) { return x * 15; }
+inline int f2117_16(int x) { return x * 16; }
+inline int f2117_17(int x) { return x * 17; }
+inline int f2117_18(int x) { return x * 18; }
+inline int f2117_19(int x) { return x * 19; }
+inline int f2117_20(int x) { return x * 20; }
+inline int f2117_21(int x) { return x * 21; }
+inline int f2117_22(int x) { return x * 22; }
+inline int f2117_23(int x) { return x * 23; }
+inline int f2117_24(int x) { return x * 24; }
+inline int f2117_25(int x) { return x * 25; }
+inline int f2117_26(int x) { return x * 26; }
+inline int f2117_27(int x) { return x * 27; }
+inline int f2117_28(int x) { return x * 28; }
+inline int f2117_29(int x) { return x * 29; }
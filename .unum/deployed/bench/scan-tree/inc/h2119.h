@@ -0,0 +1,42 @@
+#pragma once
+/* header 2119 */
+#include <vector>
+#include "h2009.h"
+#include "h4187.h"
+#include "h6192.h"
+#include "h3674.h"
+#include "h6172.h"
+#ifdef X
+#include "h3164.h"
+#endif
+struct S2119 { int a; const char *s = "x//y"; };
+inline int f2119_0(int x) { return x * 0; }
+inline int f2119_1(int x) { return x * 1; }
+inline int f2119_2(int x) { return x * 2; }
+inline int f2119_3(int x) { return x * 3; }
+inline int f2119_4(int x) { return x * 4; }
+inline int f2119_5(int x) { return x * 5; }
+inline int f2119_6(int x) { return x * 6; }
+inline int f2119_7(int x) { return x * 7; }
+inline int f2119_8(int x) { return x * 8; }
+inline int f2119_9(int x) { return x * 9; }
+inline int f2119_10(int x) { return x * 10; }
+inline int f2119_11(int x) { return x * 11; }
+inline int f2119_12(int x) { return x * 12; }
+inline int f2119_13(int x) { return x * 13; }
+inline int f2119_14(int x) { return x * 14; }
+inline int f2119_15(int x) { return x * 15; }
+inline int f2119_16(int x) { return x * 16; }
+inline int f2119_17(int x) { return x * 17; }
+inline int f2119_18(int x) { return x * 18; }
+inline int f2119_19(int x) { return x * 19; }
+inline int f2119_20(int x) { return x * 20; }
+inline int f2119_21(int x) { return x * 21; }
+inline int f2119_22(int x) { return x * 22; }
+inline int f2119_23(int x) { return x * 23; }
+inline int f2119_24(int x) { return x * 24; }
+inline int f2119_25(int x) { return x * 25; }
+inline int f2119_26(int x) { return x * 26; }
+inline int f2119_27(int x) { return x * 27; }
+inline int f2119_28(int x) { return x * 28; }
+inline int f2119_29(int x) { return x * 29; }
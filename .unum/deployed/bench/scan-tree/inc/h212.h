@@ -0,0 +1,42 @@
+#pragma once
+/* header 212 */
+#include <vector>
+#include "h8260.h"
+#include "h3035.h"
+#include "h1264.h"
+#include "h1283.h"
+#include "h8269.h"
+#ifdef X
+#include "h5292.h"
+#endif
+struct S212 { int a; const char *s = "x//y"; };
+inline int f212_0(int x) { return x * 0; }
+inline int f212_1(int x) { return x * 1; }
+inline int f212_2(int x) { return x * 2; }
+inline int f212_3(int x) { return x * 3; }
+inline int f212_4(int x) { return x * 4; }
+inline int f212_5(int x) { return x * 5; }
+inline int f212_6(int x) { return x * 6; }
+inline int f212_7(int x) { return x * 7; }
+inline int f212_8(int x) { return x * 8; }
+inline int f212_9(int x) { return x * 9; }
+inline int f212_10(int x) { return x * 10; }
+inline int f212_11(int x) { return x * 11; }
+inline int f212_12(int x) { return x * 12; }
+inline int f212_13(int x) { return x * 13; }
+inline int f212_14(int x) { return x * 14; }
+inline int f212_15(int x) { return x * 15; }
+inline int f212_16(int x) { return x * 16; }
+inline int f212_17(int x) { return x * 17; }
+inline int f212_18(int x) { return x * 18; }
+inline int f212_19(int x) { return x * 19; }
+inline int f212_20(int x) { return x * 20; }
+inline int f212_21(int x) { return x * 21; }
+inline int f212_22(int x) { return x * 22; }
+inline int f212_23(int x) { return x * 23; }
+inline int f212_24(int x) { return x * 24; }
+inline int f212_25(int x) { return x * 25; }
+inline int f212_26(int x) { return x * 26; }
+inline int f212_27(int x) { return x * 27; }
+inline int f212_28(int x) { return x * 28; }
+inline int f212_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2120 */
+#include <vector>
+#include "h2362.h"
+#include "h2437.h"
+#include "h3141.h"
+#include "h9399.h"
+#include "h1075.h"
+#ifdef X
+#include "h5449.h"
+#endif
+struct S2120 { int a; const char *s = "x//y"; };
+inline int f2120_0(int x) { return x * 0; }
+inline int f2120_1(int x) { return x * 1; }
+inline int f2120_2(int x) { return x * 2; }
+inline int f2120_3(int x) { return x * 3; }
+inline int f2120_4(int x) { return x * 4; }
+inline int f2120_5(int x) { return x * 5; }
+inline int f2120_6(int x) { return x * 6; }
+inline int f2120_7(int x) { return x * 7; }
+inline int f2120_8(int x) { return x * 8; }
+inline int f2120_9(int x) { return x * 9; }
+inline int f2120_10(int x) { return x * 10; }
+inline int f2120_11(int x) { return x * 11; }
+inline int f2120_12(int x) { return x * 12; }
+inline int f2120_13(int x) { return x * 13; }
+inline int f2120_14(int x) { return x * 14; }
+inline int f2120_15(int x) { return x * 15; }
+inline int f2120_16(int x) { return x * 16; }
+inline int f2120_17(int x) { return x * 17; }
+inline int f2120_18(int x) { return x * 18; }
+inline int f2120_19(int x) { return x * 19; }
+inline int f2120_20(int x) { return x * 20; }
+inline int f2120_21(int x) { return x * 21; }
+inline int f2120_22(int x) { return x * 22; }
+inline int f2120_23(int x) { return x * 23; }
+inline int f2120_24(int x) { return x * 24; }
+inline int f2120_25(int x) { return x * 25; }
+inline int f2120_26(int x) { return x * 26; }
+inline int f2120_27(int x) { return x * 27; }
+inline int f2120_28(int x) { return x * 28; }
+inline int f2120_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2121 */
+#include <vector>
+#include "h1799.h"
+#include "h3349.h"
+#include "h3981.h"
+#include "h312.h"
+#include "h279.h"
+#ifdef X
+#include "h6536.h"
+#endif
+struct S2121 { int a; const char *s = "x//y"; };
+inline int f2121_0(int x) { return x * 0; }
+inline int f2121_1(int x) { return x * 1; }
+inline int f2121_2(int x) { return x * 2; }
+inline int f2121_3(int x) { return x * 3; }
+inline int f2121_4(int x) { return x * 4; }
+inline int f2121_5(int x) { return x * 5; }
+inline int f2121_6(int x) { return x * 6; }
+inline int f2121_7(int x) { return x * 7; }
+inline int f2121_8(int x) { return x * 8; }
+inline int f2121_9(int x) { return x * 9; }
+inline int f2121_10(int x) { return x * 10; }
+inline int f2121_11(int x) { return x * 11; }
+inline int f2121_12(int x) { return x * 12; }
+inline int f2121_13(int x) { return x * 13; }
+inline int f2121_14(int x) { return x * 14; }
+inline int f2121_15(int x) { return x * 15; }
+inline int f2121_16(int x) { return x * 16; }
+inline int f2121_17(int x) { return x * 17; }
+inline int f2121_18(int x) { return x * 18; }
+inline int f2121_19(int x) { return x * 19; }
+inline int f2121_20(int x) { return x * 20; }
+inline int f2121_21(int x) { return x * 21; }
+inline int f2121_22(int x) { return x * 22; }
+inline int f2121_23(int x) { return x * 23; }
+inline int f2121_24(int x) { return x * 24; }
+inline int f2121_25(int x) { return x * 25; }
+inline int f2121_26(int x) { return x * 26; }
+inline int f2121_27(int x) { return x * 27; }
+inline int f2121_28(int x) { return x * 28; }
+inline int f2121_29(int x) { return x * 29; }
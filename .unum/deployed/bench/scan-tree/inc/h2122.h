@@ -0,0 +1,42 @@
+#pragma once
+/* header 2122 */
+#include <vector>
+#include "h4386.h"
+#include "h9405.h"
+#include "h2854.h"
+#include "h1338.h"
+#include "h6627.h"
+#ifdef X
+#include "h2125.h"
+#endif
+struct S2122 { int a; const char *s = "x//y"; };
+inline int f2122_0(int x) { return x * 0; }
+inline int f2122_1(int x) { return x * 1; }
+inline int f2122_2(int x) { return x * 2; }
+inline int f2122_3(int x) { return x * 3; }
+inline int f2122_4(int x) { return x * 4; }
+inline int f2122_5(int x) { return x * 5; }
+inline int f2122_6(int x) { return x * 6; }
+inline int f2122_7(int x) { return x * 7; }
+inline int f2122_8(int x) { return x * 8; }
+inline int f2122_9(int x) { return x * 9; }
+inline int f2122_10(int x) { return x * 10; }
+inline int f2122_11(int x) { return x * 11; }
+inline int f2122_12(int x) { return x * 12; }
+inline int f2122_13(int x) { return x * 13; }
+inline int f2122_14(int x) { return x * 14; }
+inline int f2122_15(int x) { return x * 15; }
+inline int f2122_16(int x) { return x * 16; }
+inline int f2122_17(int x) { return x * 17; }
+inline int f2122_18(int x) { return x * 18; }
+inline int f2122_19(int x) { return x * 19; }
+inline int f2122_20(int x) { return x * 20; }
+inline int f2122_21(int x) { return x * 21; }
+inline int f2122_22(int x) { return x * 22; }
+inline int f2122_23(int x) { return x * 23; }
+inline int f2122_24(int x) { return x * 24; }
+inline int f2122_25(int x) { return x * 25; }
+inline int f2122_26(int x) { return x * 26; }
+inline int f2122_27(int x) { return x * 27; }
+inline int f2122_28(int x) { return x * 28; }
+inline int f2122_29(int x) { return x * 29; }
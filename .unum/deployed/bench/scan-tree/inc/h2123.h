@@ -0,0 +1,42 @@
+#pragma once
+/* header 2123 */
+#include <vector>
+#include "h6639.h"
+#include "h406.h"
+#include "h7496.h"
+#include "h8027.h"
+#include "h3349.h"
+#ifdef X
+#include "h8330.h"
+#endif
+struct S2123 { int a; const char *s = "x//y"; };
+inline int f2123_0(int x) { return x * 0; }
+inline int f2123_1(int x) { return x * 1; }
+inline int f2123_2(int x) { return x * 2; }
+inline int f2123_3(int x) { return x * 3; }
+inline int f2123_4(int x) { return x * 4; }
+inline int f2123_5(int x) { return x * 5; }
+inline int f2123_6(int x) { return x * 6; }
+inline int f2123_7(int x) { return x * 7; }
+inline int f2123_8(int x) { return x * 8; }
+inline int f2123_9(int x) { return x * 9; }
+inline int f2123_10(int x) { return x * 10; }
+inline int f2123_11(int x) { return x * 11; }
+inline int f2123_12(int x) { return x * 12; }
+inline int f2123_13(int x) { return x * 13; }
+inline int f2123_14(int x) { return x * 14; }
+inline int f2123_15(int x) { return x * 15; }
+inline int f2123_16(int x) { return x * 16; }
+inline int f2123_17(int x) { return x * 17; }
+inline int f2123_18(int x) { return x * 18; }
+inline int f2123_19(int x) { return x * 19; }
+inline int f2123_20(int x) { return x * 20; }
+inline int f2123_21(int x) { return x * 21; }
+inline int f2123_22(int x) { return x * 22; }
+inline int f2123_23(int x) { return x * 23; }
+inline int f2123_24(int x) { return x * 24; }
+inline int f2123_25(int x) { return x * 25; }
+inline int f2123_26(int x) { return x * 26; }
+inline int f2123_27(int x) { return x * 27; }
+inline int f2123_28(int x) { return x * 28; }
+inline int f2123_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2129 */
+#include <vector>
+#include "h6405.h"
+#include "h6210.h"
+#include "h2852.h"
+#include "h3059.h"
+#include "h9604.h"
+#ifdef X
+#include "h3519.h"
+#endif
+struct S2129 { int a; const char *s = "x//y"; };
+inline int f2129_0(int x) { return x * 0; }
+inline int f2129_1(int x) { return x * 1; }
+inline int f2129_2(int x) { return x * 2; }
+inline int f2129_3(int x) { return x * 3; }
+inline int f2129_4(int x) { return x * 4; }
+inline int f2129_5(int x) { return x * 5; }
+inline int f2129_6(int x) { return x * 6; }
+inline int f2129_7(int x) { return x * 7; }
+inline int f2129_8(int x) { return x * 8; }
+inline int f2129_9(int x) { return x * 9; }
+inline int f2129_10(int x) { return x * 10; }
+inline int f2129_11(int x) { return x * 11; }
+inline int f2129_12(int x) { return x * 12; }
+inline int f2129_13(int x) { return x * 13; }
+inline int f2129_14(int x) { return x * 14; }
+inline int f2129_15(int x) { return x * 15; }
+inline int f2129_16(int x) { return x * 16; }
+inline int f2129_17(int x) { return x * 17; }
+inline int f2129_18(int x) { return x * 18; }
+inline int f2129_19(int x) { return x * 19; }
+inline int f2129_20(int x) { return x * 20; }
+inline int f2129_21(int x) { return x * 21; }
+inline int f2129_22(int x) { return x * 22; }
+inline int f2129_23(int x) { return x * 23; }
+inline int f2129_24(int x) { return x * 24; }
+inline int f2129_25(int x) { return x * 25; }
+inline int f2129_26(int x) { return x * 26; }
+inline int f2129_27(int x) { return x * 27; }
+inline int f2129_28(int x) { return x * 28; }
+inline int f2129_29(int x) { return x * 29; }
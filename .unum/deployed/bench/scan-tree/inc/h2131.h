@@ -0,0 +1,42 @@
+#pragma once
+/* header 2131 */
+#include <vector>
+#include "h6014.h"
+#include "h1520.h"
+#include "h9570.h"
+#include "h2492.h"
+#include "h6362.h"
+#ifdef X
+#include "h2987.h"
+#endif
+struct S2131 { int a; const char *s = "x//y"; };
+inline int f2131_0(int x) { return x * 0; }
+inline int f2131_1(int x) { return x * 1; }
+inline int f2131_2(int x) { return x * 2; }
+inline int f2131_3(int x) { return x * 3; }
+inline int f2131_4(int x) { return x * 4; }
+inline int f2131_5(int x) { return x * 5; }
+inline int f2131_6(int x) { return x * 6; }
+inline int f2131_7(int x) { return x * 7; }
+inline int f2131_8(int x) { return x * 8; }
+inline int f2131_9(int x) { return x * 9; }
+inline int f2131_10(int x) { return x * 10; }
+inline int f2131_11(int x) { return x * 11; }
+inline int f2131_12(int x) { return x * 12; }
+inline int f2131_13(int x) { return x * 13; }
+inline int f2131_14(int x) { return x * 14; }
+inline int f2131_15(int x) { return x * 15; }
+inline int f2131_16(int x) { return x * 16; }
+inline int f2131_17(int x) { return x * 17; }
+inline int f2131_18(int x) { return x * 18; }
+inline int f2131_19(int x) { return x * 19; }
+inline int f2131_20(int x) { return x * 20; }
+inline int f2131_21(int x) { return x * 21; }
+inline int f2131_22(int x) { return x * 22; }
+inline int f2131_23(int x) { return x * 23; }
+inline int f2131_24(int x) { return x * 24; }
+inline int f2131_25(int x) { return x * 25; }
+inline int f2131_26(int x) { return x * 26; }
+inline int f2131_27(int x) { return x * 27; }
+inline int f2131_28(int x) { return x * 28; }
+inline int f2131_29(int x) { return x * 29; }
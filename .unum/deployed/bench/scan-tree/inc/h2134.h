@@ -0,0 +1,42 @@
+#pragma once
+/* header 2134 */
+#include <vector>
+#include "h3145.h"
+#include "h1375.h"
+#include "h6970.h"
+#include "h6129.h"
+#include "h6186.h"
+#ifdef X
+#include "h9341.h"
+#endif
+struct S2134 { int a; const char *s = "x//y"; };
+inline int f2134_0(int x) { return x * 0; }
+inline int f2134_1(int x) { return x * 1; }
+inline int f2134_2(int x) { return x * 2; }
+inline int f2134_3(int x) { return x * 3; }
+inline int f2134_4(int x) { return x * 4; }
+inline int f2134_5(int x) { return x * 5; }
+inline int f2134_6(int x) { return x * 6; }
+inline int f2134_7(int x) { return x * 7; }
+inline int f2134_8(int x) { return x * 8; }
+inline int f2134_9(int x) { return x * 9; }
+inline int f2134_10(int x) { return x * 10; }
+inline int f2134_11(int x) { return x * 11; }
+inline int f2134_12(int x) { return x * 12; }
+inline int f2134_13(int x) { return x * 13; }
+inline int f2134_14(int x) { return x * 14; }
+inline int f2134_15(int x) { return x * 15; }
+inline int f2134_16(int x) { return x * 16; }
+inline int f2134_17(int x) { return x * 17; }
+inline int f2134_18(int x) { return x * 18; }
+inline int f2134_19(int x) { return x * 19; }
+inline int f2134_20(int x) { return x * 20; }
+inline int f2134_21(int x) { return x * 21; }
+inline int f2134_22(int x) { return x * 22; }
+inline int f2134_23(int x) { return x * 23; }
+inline int f2134_24(int x) { return x * 24; }
+inline int f2134_25(int x) { return x * 25; }
+inline int f2134_26(int x) { return x * 26; }
+inline int f2134_27(int x) { return x * 27; }
+inline int f2134_28(int x) { return x * 28; }
+inline int f2134_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2135 */
+#include <vector>
+#include "h6119.h"
+#include "h7707.h"
+#include "h6132.h"
+#include "h3978.h"
+#include "h1660.h"
+#ifdef X
+#include "h3285.h"
+#endif
+struct S2135 { int a; const char *s = "x//y"; };
+inline int f2135_0(int x) { return x * 0; }
+inline int f2135_1(int x) { return x * 1; }
+inline int f2135_2(int x) { return x * 2; }
+inline int f2135_3(int x) { return x * 3; }
+inline int f2135_4(int x) { return x * 4; }
+inline int f2135_5(int x) { return x * 5; }
+inline int f2135_6(int x) { return x * 6; }
+inline int f2135_7(int x) { return x * 7; }
+inline int f2135_8(int x) { return x * 8; }
+inline int f2135_9(int x) { return x * 9; }
+inline int f2135_10(int x) { return x * 10; }
+inline int f2135_11(int x) { return x * 11; }
+inline int f2135_12(int x) { return x * 12; }
+inline int f2135_13(int x) { return x * 13; }
+inline int f2135_14(int x) { return x * 14; }
+inline int f2135_15(int x) { return x * 15; }
+inline int f2135_16(int x) { return x * 16; }
+inline int f2135_17(int x) { return x * 17; }
+inline int f2135_18(int x) { return x * 18; }
+inline int f2135_19(int x) { return x * 19; }
+inline int f2135_20(int x) { return x * 20; }
+inline int f2135_21(int x) { return x * 21; }
+inline int f2135_22(int x) { return x * 22; }
+inline int f2135_23(int x) { return x * 23; }
+inline int f2135_24(int x) { return x * 24; }
+inline int f2135_25(int x) { return x * 25; }
+inline int f2135_26(int x) { return x * 26; }
+inline int f2135_27(int x) { return x * 27; }
+inline int f2135_28(int x) { return x * 28; }
+inline int f2135_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2141 */
+#include <vector>
+#include "h2389.h"
+#include "h7757.h"
+#include "h1924.h"
+#include "h2261.h"
+#include "h3598.h"
+#ifdef X
+#include "h7283.h"
+#endif
+struct S2141 { int a; const char *s = "x//y"; };
+inline int f2141_0(int x) { return x * 0; }
+inline int f2141_1(int x) { return x * 1; }
+inline int f2141_2(int x) { return x * 2; }
+inline int f2141_3(int x) { return x * 3; }
+inline int f2141_4(int x) { return x * 4; }
+inline int f2141_5(int x) { return x * 5; }
+inline int f2141_6(int x) { return x * 6; }
+inline int f2141_7(int x) { return x * 7; }
+inline int f2141_8(int x) { return x * 8; }
+inline int f2141_9(int x) { return x * 9; }
+inline int f2141_10(int x) { return x * 10; }
+inline int f2141_11(int x) { return x * 11; }
+inline int f2141_12(int x) { return x * 12; }
+inline int f2141_13(int x) { return x * 13; }
+inline int f2141_14(int x) { return x * 14; }
+inline int f2141_15(int x) { return x * 15; }
+inline int f2141_16(int x) { return x * 16; }
+inline int f2141_17(int x) { return x * 17; }
+inline int f2141_18(int x) { return x * 18; }
+inline int f2141_19(int x) { return x * 19; }
+inline int f2141_20(int x) { return x * 20; }
+inline int f2141_21(int x) { return x * 21; }
+inline int f2141_22(int x) { return x * 22; }
+inline int f2141_23(int x) { return x * 23; }
+inline int f2141_24(int x) { return x * 24; }
+inline int f2141_25(int x) { return x * 25; }
+inline int f2141_26(int x) { return x * 26; }
+inline int f2141_27(int x) { return x * 27; }
+inline int f2141_28(int x) { return x * 28; }
+inline int f2141_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2144 */
+#include <vector>
+#include "h889.h"
+#include "h2296.h"
+#include "h3658.h"
+#include "h796.h"
+#include "h8617.h"
+#ifdef X
+#include "h5748.h"
+#endif
+struct S2144 { int a; const char *s = "x//y"; };
+inline int f2144_0(int x) { return x * 0; }
+inline int f2144_1(int x) { return x * 1; }
+inline int f2144_2(int x) { return x * 2; }
+inline int f2144_3(int x) { return x * 3; }
+inline int f2144_4(int x) { return x * 4; }
+inline int f2144_5(int x) { return x * 5; }
+inline int f2144_6(int x) { return x * 6; }
+inline int f2144_7(int x) { return x * 7; }
+inline int f2144_8(int x) { return x * 8; }
+inline int f2144_9(int x) { return x * 9; }
+inline int f2144_10(int x) { return x * 10; }
+inline int f2144_11(int x) { return x * 11; }
+inline int f2144_12(int x) { return x * 12; }
+inline int f2144_13(int x) { return x * 13; }
+inline int f2144_14(int x) { return x * 14; }
+inline int f2144_15(int x) { return x * 15; }
+inline int f2144_16(int x) { return x * 16; }
+inline int f2144_17(int x) { return x * 17; }
+inline int f2144_18(int x) { return x * 18; }
+inline int f2144_19(int x) { return x * 19; }
+inline int f2144_20(int x) { return x * 20; }
+inline int f2144_21(int x) { return x * 21; }
+inline int f2144_22(int x) { return x * 22; }
+inline int f2144_23(int x) { return x * 23; }
+inline int f2144_24(int x) { return x * 24; }
+inline int f2144_25(int x) { return x * 25; }
+inline int f2144_26(int x) { return x * 26; }
+inline int f2144_27(int x) { return x * 27; }
+inline int f2144_28(int x) { return x * 28; }
+inline int f2144_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2145 */
+#include <vector>
+#include "h4760.h"
+#include "h1392.h"
+#include "h6658.h"
+#include "h6199.h"
+#include "h4561.h"
+#ifdef X
+#include "h7440.h"
+#endif
+struct S2145 { int a; const char *s = "x//y"; };
+inline int f2145_0(int x) { return x * 0; }
+inline int f2145_1(int x) { return x * 1; }
+inline int f2145_2(int x) { return x * 2; }
+inline int f2145_3(int x) { return x * 3; }
+inline int f2145_4(int x) { return x * 4; }
+inline int f2145_5(int x) { return x * 5; }
+inline int f2145_6(int x) { return x * 6; }
+inline int f2145_7(int x) { return x * 7; }
+inline int f2145_8(int x) { return x * 8; }
+inline int f2145_9(int x) { return x * 9; }
+inline int f2145_10(int x) { return x * 10; }
+inline int f2145_11(int x) { return x * 11; }
+inline int f2145_12(int x) { return x * 12; }
+inline int f2145_13(int x) { return x * 13; }
+inline int f2145_14(int x) { return x * 14; }
+inline int f2145_15(int x) { return x * 15; }
+inline int f2145_16(int x) { return x * 16; }
+inline int f2145_17(int x) { return x * 17; }
+inline int f2145_18(int x) { return x * 18; }
+inline int f2145_19(int x) { return x * 19; }
+inline int f2145_20(int x) { return x * 20; }
+inline int f2145_21(int x) { return x * 21; }
+inline int f2145_22(int x) { return x * 22; }
+inline int f2145_23(int x) { return x * 23; }
+inline int f2145_24(int x) { return x * 24; }
+inline int f2145_25(int x) { return x * 25; }
+inline int f2145_26(int x) { return x * 26; }
+inline int f2145_27(int x) { return x * 27; }
+inline int f2145_28(int x) { return x * 28; }
+inline int f2145_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2149 */
+#include <vector>
+#include "h7668.h"
+#include "h2499.h"
+#include "h5103.h"
+#include "h6042.h"
+#include "h428.h"
+#ifdef X
+#include "h515.h"
+#endif
+struct S2149 { int a; const char *s = "x//y"; };
+inline int f2149_0(int x) { return x * 0; }
+inline int f2149_1(int x) { return x * 1; }
+inline int f2149_2(int x) { return x * 2; }
+inline int f2149_3(int x) { return x * 3; }
+inline int f2149_4(int x) { return x * 4; }
+inline int f2149_5(int x) { return x * 5; }
+inline int f2149_6(int x) { return x * 6; }
+inline int f2149_7(int x) { return x * 7; }
+inline int f2149_8(int x) { return x * 8; }
+inline int f2149_9(int x) { return x * 9; }
+inline int f2149_10(int x) { return x * 10; }
+inline int f2149_11(int x) { return x * 11; }
+inline int f2149_12(int x) { return x * 12; }
+inline int f2149_13(int x) { return x * 13; }
+inline int f2149_14(int x) { return x * 14; }
+inline int f2149_15(int x) { return x * 15; }
+inline int f2149_16(int x) { return x * 16; }
+inline int f2149_17(int x) { return x * 17; }
+inline int f2149_18(int x) { return x * 18; }
+inline int f2149_19(int x) { return x * 19; }
+inline int f2149_20(int x) { return x * 20; }
+inline int f2149_21(int x) { return x * 21; }
+inline int f2149_22(int x) { return x * 22; }
+inline int f2149_23(int x) { return x * 23; }
+inline int f2149_24(int x) { return x * 24; }
+inline int f2149_25(int x) { return x * 25; }
+inline int f2149_26(int x) { return x * 26; }
+inline int f2149_27(int x) { return x * 27; }
+inline int f2149_28(int x) { return x * 28; }
+inline int f2149_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2152 */
+#include <vector>
+#include "h6775.h"
+#include "h1821.h"
+#include "h5147.h"
+#include "h6838.h"
+#include "h8761.h"
+#ifdef X
+#include "h3271.h"
+#endif
+struct S2152 { int a; const char *s = "x//y"; };
+inline int f2152_0(int x) { return x * 0; }
+inline int f2152_1(int x) { return x * 1; }
+inline int f2152_2(int x) { return x * 2; }
+inline int f2152_3(int x) { return x * 3; }
+inline int f2152_4(int x) { return x * 4; }
+inline int f2152_5(int x) { return x * 5; }
+inline int f2152_6(int x) { return x * 6; }
+inline int f2152_7(int x) { return x * 7; }
+inline int f2152_8(int x) { return x * 8; }
+inline int f2152_9(int x) { return x * 9; }
+inline int f2152_10(int x) { return x * 10; }
+inline int f2152_11(int x) { return x * 11; }
+inline int f2152_12(int x) { return x * 12; }
+inline int f2152_13(int x) { return x * 13; }
+inline int f2152_14(int x) { return x * 14; }
+inline int f2152_15(int x) { return x * 15; }
+inline int f2152_16(int x) { return x * 16; }
+inline int f2152_17(int x) { return x * 17; }
+inline int f2152_18(int x) { return x * 18; }
+inline int f2152_19(int x) { return x * 19; }
+inline int f2152_20(int x) { return x * 20; }
+inline int f2152_21(int x) { return x * 21; }
+inline int f2152_22(int x) { return x * 22; }
+inline int f2152_23(int x) { return x * 23; }
+inline int f2152_24(int x) { return x * 24; }
+inline int f2152_25(int x) { return x * 25; }
+inline int f2152_26(int x) { return x * 26; }
+inline int f2152_27(int x) { return x * 27; }
+inline int f2152_28(int x) { return x * 28; }
+inline int f2152_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2153 */
+#include <vector>
+#include "h5460.h"
+#include "h836.h"
+#include "h1690.h"
+#include "h3142.h"
+#include "h410.h"
+#ifdef X
+#include "h1757.h"
+#endif
+struct S2153 { int a; const char *s = "x//y"; };
+inline int f2153_0(int x) { return x * 0; }
+inline int f2153_1(int x) { return x * 1; }
+inline int f2153_2(int x) { return x * 2; }
+inline int f2153_3(int x) { return x * 3; }
+inline int f2153_4(int x) { return x * 4; }
+inline int f2153_5(int x) { return x * 5; }
+inline int f2153_6(int x) { return x * 6; }
+inline int f2153_7(int x) { return x * 7; }
+inline int f2153_8(int x) { return x * 8; }
+inline int f2153_9(int x) { return x * 9; }
+inline int f2153_10(int x) { return x * 10; }
+inline int f2153_11(int x) { return x * 11; }
+inline int f2153_12(int x) { return x * 12; }
+inline int f2153_13(int x) { return x * 13; }
+inline int f2153_14(int x) { return x * 14; }
+inline int f2153_15(int x) { return x * 15; }
+inline int f2153_16(int x) { return x * 16; }
+inline int f2153_17(int x) { return x * 17; }
+inline int f2153_18(int x) { return x * 18; }
+inline int f2153_19(int x) { return x * 19; }
+inline int f2153_20(int x) { return x * 20; }
+inline int f2153_21(int x) { return x * 21; }
+inline int f2153_22(int x) { return x * 22; }
+inline int f2153_23(int x) { return x * 23; }
+inline int f2153_24(int x) { return x * 24; }
+inline int f2153_25(int x) { return x * 25; }
+inline int f2153_26(int x) { return x * 26; }
+inline int f2153_27(int x) { return x * 27; }
+inline int f2153_28(int x) { return x * 28; }
+inline int f2153_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2155 */
+#include <vector>
+#include "h1369.h"
+#include "h5842.h"
+#include "h9060.h"
+#include "h8350.h"
+#include "h2256.h"
+#ifdef X
+#include "h289.h"
+#endif
+struct S2155 { int a; const char *s = "x//y"; };
+inline int f2155_0(int x) { return x * 0; }
+inline int f2155_1(int x) { return x * 1; }
+inline int f2155_2(int x) { return x * 2; }
+inline int f2155_3(int x) { return x * 3; }
+inline int f2155_4(int x) { return x * 4; }
+inline int f2155_5(int x) { return x * 5; }
+inline int f2155_6(int x) { return x * 6; }
+inline int f2155_7(int x) { return x * 7; }
+inline int f2155_8(int x) { return x * 8; }
+inline int f2155_9(int x) { return x * 9; }
+inline int f2155_10(int x) { return x * 10; }
+inline int f2155_11(int x) { return x * 11; }
+inline int f2155_12(int x) { return x * 12; }
+inline int f2155_13(int x) { return x * 13; }
+inline int f2155_14(int x) { return x * 14; }
+inline int f2155_15(int x) { return x * 15; }
+inline int f2155_16(int x) { return x * 16; }
+inline int f2155_17(int x) { return x * 17; }
+inline int f2155_18(int x) { return x * 18; }
+inline int f2155_19(int x) { return x * 19; }
+inline int f2155_20(int x) { return x * 20; }
+inline int f2155_21(int x) { return x * 21; }
+inline int f2155_22(int x) { return x * 22; }
+inline int f2155_23(int x) { return x * 23; }
+inline int f2155_24(int x) { return x * 24; }
+inline int f2155_25(int x) { return x * 25; }
+inline int f2155_26(int x) { return x * 26; }
+inline int f2155_27(int x) { return x * 27; }
+inline int f2155_28(int x) { return x * 28; }
+inline int f2155_29(int x) { return x * 29; }
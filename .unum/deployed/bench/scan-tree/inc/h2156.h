@@ -0,0 +1,42 @@
+#pragma once
+/* header 2156 */
+#include <vector>
+#include "h75.h"
+#include "h2675.h"
+#include "h785.h"
+#include "h4442.h"
+#include "h1959.h"
+#ifdef X
+#include "h3109.h"
+#endif
+struct S2156 { int a; const char *s = "x//y"; };
+inline int f2156_0(int x) { return x * 0; }
+inline int f2156_1(int x) { return x * 1; }
+inline int f2156_2(int x) { return x * 2; }
+inline int f2156_3(int x) { return x * 3; }
+inline int f2156_4(int x) { return x * 4; }
+inline int f2156_5(int x) { return x * 5; }
+inline int f2156_6(int x) { return x * 6; }
+inline int f2156_7(int x) { return x * 7; }
+inline int f2156_8(int x) { return x * 8; }
+inline int f2156_9(int x) { return x * 9; }
+inline int f2156_10(int x) { return x * 10; }
+inline int f2156_11(int x) { return x * 11; }
+inline int f2156_12(int x) { return x * 12; }
+inline int f2156_13(int x) { return x * 13; }
+inline int f2156_14(int x) { return x * 14; }
+inline int f2156_15(int x) { return x * 15; }
+inline int f2156_16(int x) { return x * 16; }
+inline int f2156_17(int x) { return x * 17; }
+inline int f2156_18(int x) { return x * 18; }
+inline int f2156_19(int x) { return x * 19; }
+inline int f2156_20(int x) { return x * 20; }
+inline int f2156_21(int x) { return x * 21; }
+inline int f2156_22(int x) { return x * 22; }
+inline int f2156_23(int x) { return x * 23; }
+inline int f2156_24(int x) { return x * 24; }
+inline int f2156_25(int x) { return x * 25; }
+inline int f2156_26(int x) { return x * 26; }
+inline int f2156_27(int x) { return x * 27; }
+inline int f2156_28(int x) { return x * 28; }
+inline int f2156_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2157 */
+#include <vector>
+#include "h8597.h"
+#include "h9528.h"
+#include "h8013.h"
+#include "h6343.h"
+#include "h4088.h"
+#ifdef X
+#include "h8022.h"
+#endif
+struct S2157 { int a; const char *s = "x//y"; };
+inline int f2157_0(int x) { return x * 0; }
+inline int f2157_1(int x) { return x * 1; }
+inline int f2157_2(int x) { return x * 2; }
+inline int f2157_3(int x) { return x * 3; }
+inline int f2157_4(int x) { return x * 4; }
+inline int f2157_5(int x) { return x * 5; }
+inline int f2157_6(int x) { return x * 6; }
+inline int f2157_7(int x) { return x * 7; }
+inline int f2157_8(int x) { return x * 8; }
+inline int f2157_9(int x) { return x * 9; }
+inline int f2157_10(int x) { return x * 10; }
+inline int f2157_11(int x) { return x * 11; }
+inline int f2157_12(int x) { return x * 12; }
+inline int f2157_13(int x) { return x * 13; }
+inline int f2157_14(int x) { return x * 14; }
+inline int f2157_15(int x) { return x * 15; }
+inline int f2157_16(int x) { return x * 16; }
+inline int f2157_17(int x) { return x * 17; }
+inline int f2157_18(int x) { return x * 18; }
+inline int f2157_19(int x) { return x * 19; }
+inline int f2157_20(int x) { return x * 20; }
+inline int f2157_21(int x) { return x * 21; }
+inline int f2157_22(int x) { return x * 22; }
+inline int f2157_23(int x) { return x * 23; }
+inline int f2157_24(int x) { return x * 24; }
+inline int f2157_25(int x) { return x * 25; }
+inline int f2157_26(int x) { return x * 26; }
+inline int f2157_27(int x) { return x * 27; }
+inline int f2157_28(int x) { return x * 28; }
+inline int f2157_29(int x) { return x * 29; }
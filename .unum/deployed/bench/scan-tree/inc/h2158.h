@@ -0,0 +1,42 @@
+#pragma once
+/* header 2158 */
+#include <vector>
+#include "h7471.h"
+#include "h3457.h"
+#include "h1204.h"
+#include "h3620.h"
+#include "h5863.h"
+#ifdef X
+#include "h8646.h"
+#endif
+struct S2158 { int a; const char *s = "x//y"; };
+inline int f2158_0(int x) { return x * 0; }
+inline int f2158_1(int x) { return x * 1; }
+inline int f2158_2(int x) { return x * 2; }
+inline int f2158_3(int x) { return x * 3; }
+inline int f2158_4(int x) { return x * 4; }
+inline int f2158_5(int x) { return x * 5; }
+inline int f2158_6(int x) { return x * 6; }
+inline int f2158_7(int x) { return x * 7; }
+inline int f2158_8(int x) { return x * 8; }
+inline int f2158_9(int x) { return x * 9; }
+inline int f2158_10(int x) { return x * 10; }
+inline int f2158_11(int x) { return x * 11; }
+inline int f2158_12(int x) { return x * 12; }
+inline int f2158_13(int x) { return x * 13; }
+inline int f2158_14(int x) { return x * 14; }
+inline int f2158_15(int x) { return x * 15; }
+inline int f2158_16(int x) { return x * 16; }
+inline int f2158_17(int x) { return x * 17; }
+inline int f2158_18(int x) { return x * 18; }
+inline int f2158_19(int x) { return x * 19; }
+inline int f2158_20(int x) { return x * 20; }
+inline int f2158_21(int x) { return x * 21; }
+inline int f2158_22(int x) { return x * 22; }
+inline int f2158_23(int x) { return x * 23; }
+inline int f2158_24(int x) { return x * 24; }
+inline int f2158_25(int x) { return x * 25; }
+inline int f2158_26(int x) { return x * 26; }
+inline int f2158_27(int x) { return x * 27; }
+inline int f2158_28(int x) { return x * 28; }
+inline int f2158_29(int x) { return x * 29; }
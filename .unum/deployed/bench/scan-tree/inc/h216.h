@@ -0,0 +1,42 @@
+#pragma once
+/* header 216 */
+#include <vector>
+#include "h1136.h"
+#include "h4982.h"
+#include "h398.h"
+#include "h1.h"
+#include "h6123.h"
+#ifdef X
+#include "h2518.h"
+#endif
+struct S216 { int a; const char *s = "x//y"; };
+inline int f216_0(int x) { return x * 0; }
+inline int f216_1(int x) { return x * 1; }
+inline int f216_2(int x) { return x * 2; }
+inline int f216_3(int x) { return x * 3; }
+inline int f216_4(int x) { return x * 4; }
+inline int f216_5(int x) { return x * 5; }
+inline int f216_6(int x) { return x * 6; }
+inline int f216_7(int x) { return x * 7; }
+inline int f216_8(int x) { return x * 8; }
+inline int f216_9(int x) { return x * 9; }
+inline int f216_10(int x) { return x * 10; }
+inline int f216_11(int x) { return x * 11; }
+inline int f216_12(int x) { return x * 12; }
+inline int f216_13(int x) { return x * 13; }
+inline int f216_14(int x) { return x * 14; }
+inline int f216_15(int x) { return x * 15; }
+inline int f216_16(int x) { return x * 16; }
+inline int f216_17(int x) { return x * 17; }
+inline int f216_18(int x) { return x * 18; }
+inline int f216_19(int x) { return x * 19; }
+inline int f216_20(int x) { return x * 20; }
+inline int f216_21(int x) { return x * 21; }
+inline int f216_22(int x) { return x * 22; }
+inline int f216_23(int x) { return x * 23; }
+inline int f216_24(int x) { return x * 24; }
+inline int f216_25(int x) { return x * 25; }
+inline int f216_26(int x) { return x * 26; }
+inline int f216_27(int x) { return x * 27; }
+inline int f216_28(int x) { return x * 28; }
+inline int f216_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2161 */
+#include <vector>
+#include "h4054.h"
+#include "h6405.h"
+#include "h9513.h"
+#include "h4578.h"
+#include "h7127.h"
+#ifdef X
+#include "h1896.h"
+#endif
+struct S2161 { int a; const char *s = "x//y"; };
+inline int f2161_0(int x) { return x * 0; }
+inline int f2161_1(int x) { return x * 1; }
+inline int f2161_2(int x) { return x * 2; }
+inline int f2161_3(int x) { return x * 3; }
+inline int f2161_4(int x) { return x * 4; }
+inline int f2161_5(int x) { return x * 5; }
+inline int f2161_6(int x) { return x * 6; }
+inline int f2161_7(int x) { return x * 7; }
+inline int f2161_8(int x) { return x * 8; }
+inline int f2161_9(int x) { return x * 9; }
+inline int f2161_10(int x) { return x * 10; }
+inline int f2161_11(int x) { return x * 11; }
+inline int f2161_12(int x) { return x * 12; }
+inline int f2161_13(int x) { return x * 13; }
+inline int f2161_14(int x) { return x * 14; }
+inline int f2161_15(int x) { return x * 15; }
+inline int f2161_16(int x) { return x * 16; }
+inline int f2161_17(int x) { return x * 17; }
+inline int f2161_18(int x) { return x * 18; }
+inline int f2161_19(int x) { return x * 19; }
+inline int f2161_20(int x) { return x * 20; }
+inline int f2161_21(int x) { return x * 21; }
+inline int f2161_22(int x) { return x * 22; }
+inline int f2161_23(int x) { return x * 23; }
+inline int f2161_24(int x) { return x * 24; }
+inline int f2161_25(int x) { return x * 25; }
+inline int f2161_26(int x) { return x * 26; }
+inline int f2161_27(int x) { return x * 27; }
+inline int f2161_28(int x) { return x * 28; }
+inline int f2161_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2165 */
+#include <vector>
+#include "h2005.h"
+#include "h5231.h"
+#include "h5123.h"
+#include "h3519.h"
+#include "h4434.h"
+#ifdef X
+#include "h2488.h"
+#endif
+struct S2165 { int a; const char *s = "x//y"; };
+inline int f2165_0(int x) { return x * 0; }
+inline int f2165_1(int x) { return x * 1; }
+inline int f2165_2(int x) { return x * 2; }
+inline int f2165_3(int x) { return x * 3; }
+inline int f2165_4(int x) { return x * 4; }
+inline int f2165_5(int x) { return x * 5; }
+inline int f2165_6(int x) { return x * 6; }
+inline int f2165_7(int x) { return x * 7; }
+inline int f2165_8(int x) { return x * 8; }
+inline int f2165_9(int x) { return x * 9; }
+inline int f2165_10(int x) { return x * 10; }
+inline int f2165_11(int x) { return x * 11; }
+inline int f2165_12(int x) { return x * 12; }
+inline int f2165_13(int x) { return x * 13; }
+inline int f2165_14(int x) { return x * 14; }
+inline int f2165_15(int x) { return x * 15; }
+inline int f2165_16(int x) { return x * 16; }
+inline int f2165_17(int x) { return x * 17; }
+inline int f2165_18(int x) { return x * 18; }
+inline int f2165_19(int x) { return x * 19; }
+inline int f2165_20(int x) { return x * 20; }
+inline int f2165_21(int x) { return x * 21; }
+inline int f2165_22(int x) { return x * 22; }
+inline int f2165_23(int x) { return x * 23; }
+inline int f2165_24(int x) { return x * 24; }
+inline int f2165_25(int x) { return x * 25; }
+inline int f2165_26(int x) { return x * 26; }
+inline int f2165_27(int x) { return x * 27; }
+inline int f2165_28(int x) { return x * 28; }
+inline int f2165_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2168 */
+#include <vector>
+#include "h453.h"
+#include "h1265.h"
+#include "h4821.h"
+#include "h479.h"
+#include "h6175.h"
+#ifdef X
+#include "h8440.h"
+#endif
+struct S2168 { int a; const char *s = "x//y"; };
+inline int f2168_0(int x) { return x * 0; }
+inline int f2168_1(int x) { return x * 1; }
+inline int f2168_2(int x) { return x * 2; }
+inline int f2168_3(int x) { return x * 3; }
+inline int f2168_4(int x) { return x * 4; }
+inline int f2168_5(int x) { return x * 5; }
+inline int f2168_6(int x) { return x * 6; }
+inline int f2168_7(int x) { return x * 7; }
+inline int f2168_8(int x) { return x * 8; }
+inline int f2168_9(int x) { return x * 9; }
+inline int f2168_10(int x) { return x * 10; }
+inline int f2168_11(int x) { return x * 11; }
+inline int f2168_12(int x) { return x * 12; }
+inline int f2168_13(int x) { return x * 13; }
+inline int f2168_14(int x) { return x * 14; }
+inline int f2168_15(int x) { return x * 15; }
+inline int f2168_16(int x) { return x * 16; }
+inline int f2168_17(int x) { return x * 17; }
+inline int f2168_18(int x) { return x * 18; }
+inline int f2168_19(int x) { return x * 19; }
+inline int f2168_20(int x) { return x * 20; }
+inline int f2168_21(int x) { return x * 21; }
+inline int f2168_22(int x) { return x * 22; }
+inline int f2168_23(int x) { return x * 23; }
+inline int f2168_24(int x) { return x * 24; }
+inline int f2168_25(int x) { return x * 25; }
+inline int f2168_26(int x) { return x * 26; }
+inline int f2168_27(int x) { return x * 27; }
+inline int f2168_28(int x) { return x * 28; }
+inline int f2168_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2171 */
+#include <vector>
+#include "h2325.h"
+#include "h5555.h"
+#include "h8849.h"
+#include "h3106.h"
+#include "h2831.h"
+#ifdef X
+#include "h5790.h"
+#endif
+struct S2171 { int a; const char *s = "x//y"; };
+inline int f2171_0(int x) { return x * 0; }
+inline int f2171_1(int x) { return x * 1; }
+inline int f2171_2(int x) { return x * 2; }
+inline int f2171_3(int x) { return x * 3; }
+inline int f2171_4(int x) { return x * 4; }
+inline int f2171_5(int x) { return x * 5; }
+inline int f2171_6(int x) { return x * 6; }
+inline int f2171_7(int x) { return x * 7; }
+inline int f2171_8(int x) { return x * 8; }
+inline int f2171_9(int x) { return x * 9; }
+inline int f2171_10(int x) { return x * 10; }
+inline int f2171_11(int x) { return x * 11; }
+inline int f2171_12(int x) { return x * 12; }
+inline int f2171_13(int x) { return x * 13; }
+inline int f2171_14(int x) { return x * 14; }
+inline int f2171_15(int x) { return x * 15; }
+inline int f2171_16(int x) { return x * 16; }
+inline int f2171_17(int x) { return x * 17; }
+inline int f2171_18(int x) { return x * 18; }
+inline int f2171_19(int x) { return x * 19; }
+inline int f2171_20(int x) { return x * 20; }
+inline int f2171_21(int x) { return x * 21; }
+inline int f2171_22(int x) { return x * 22; }
+inline int f2171_23(int x) { return x * 23; }
+inline int f2171_24(int x) { return x * 24; }
+inline int f2171_25(int x) { return x * 25; }
+inline int f2171_26(int x) { return x * 26; }
+inline int f2171_27(int x) { return x * 27; }
+inline int f2171_28(int x) { return x * 28; }
+inline int f2171_29(int x) { return x * 29; }
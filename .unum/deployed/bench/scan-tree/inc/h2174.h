@@ -0,0 +1,42 @@
+#pragma once
+/* header 2174 */
+#include <vector>
+#include "h8385.h"
+#include "h7474.h"
+#include "h7327.h"
+#include "h7762.h"
+#include "h5279.h"
+#ifdef X
+#include "h3495.h"
+#endif
+struct S2174 { int a; const char *s = "x//y"; };
+inline int f2174_0(int x) { return x * 0; }
+inline int f2174_1(int x) { return x * 1; }
+inline int f2174_2(int x) { return x * 2; }
+inline int f2174_3(int x) { return x * 3; }
+inline int f2174_4(int x) { return x * 4; }
+inline int f2174_5(int x) { return x * 5; }
+inline int f2174_6(int x) { return x * 6; }
+inline int f2174_7(int x) { return x * 7; }
+inline int f2174_8(int x) { return x * 8; }
+inline int f2174_9(int x) { return x * 9; }
+inline int f2174_10(int x) { return x * 10; }
+inline int f2174_11(int x) { return x * 11; }
+inline int f2174_12(int x) { return x * 12; }
+inline int f2174_13(int x) { return x * 13; }
+inline int f2174_14(int x) { return x * 14; }
+inline int f2174_15(int x) { return x * 15; }
+inline int f2174_16(int x) { return x * 16; }
+inline int f2174_17(int x) { return x * 17; }
+inline int f2174_18(int x) { return x * 18; }
+inline int f2174_19(int x) { return x * 19; }
+inline int f2174_20(int x) { return x * 20; }
+inline int f2174_21(int x) { return x * 21; }
+inline int f2174_22(int x) { return x * 22; }
+inline int f2174_23(int x) { return x * 23; }
+inline int f2174_24(int x) { return x * 24; }
+inline int f2174_25(int x) { return x * 25; }
+inline int f2174_26(int x) { return x * 26; }
+inline int f2174_27(int x) { return x * 27; }
+inline int f2174_28(int x) { return x * 28; }
+inline int f2174_29(int x) { return x * 29; }
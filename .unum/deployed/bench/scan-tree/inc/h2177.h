@@ -0,0 +1,42 @@
+#pragma once
+/* header 2177 */
+#include <vector>
+#include "h2346.h"
+#include "h9026.h"
+#include "h564.h"
+#include "h8961.h"
+#include "h9953.h"
+#ifdef X
+#include "h9355.h"
+#endif
+struct S2177 { int a; const char *s = "x//y"; };
+inline int f2177_0(int x) { return x * 0; }
+inline int f2177_1(int x) { return x * 1; }
+inline int f2177_2(int x) { return x * 2; }
+inline int f2177_3(int x) { return x * 3; }
+inline int f2177_4(int x) { return x * 4; }
+inline int f2177_5(int x) { return x * 5; }
+inline int f2177_6(int x) { return x * 6; }
+inline int f2177_7(int x) { return x * 7; }
+inline int f2177_8(int x) { return x * 8; }
+inline int f2177_9(int x) { return x * 9; }
+inline int f2177_10(int x) { return x * 10; }
+inline int f2177_11(int x) { return x * 11; }
+inline int f2177_12(int x) { return x * 12; }
+inline int f2177_13(int x) { return x * 13; }
+inline int f2177_14(int x) { return x * 14; }
+inline int f2177_15(int x) { return x * 15; }
+inline int f2177_16(int x) { return x * 16; }
+inline int f2177_17(int x) { return x * 17; }
+inline int f2177_18(int x) { return x * 18; }
+inline int f2177_19(int x) { return x * 19; }
+inline int f2177_20(int x) { return x * 20; }
+inline int f2177_21(int x) { return x * 21; }
+inline int f2177_22(int x) { return x * 22; }
+inline int f2177_23(int x) { return x * 23; }
+inline int f2177_24(int x) { return x * 24; }
+inline int f2177_25(int x) { return x * 25; }
+inline int f2177_26(int x) { return x * 26; }
+inline int f2177_27(int x) { return x * 27; }
+inline int f2177_28(int x) { return x * 28; }
+inline int f2177_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2178 */
+#include <vector>
+#include "h5165.h"
+#include "h6352.h"
+#include "h8739.h"
+#include "h5774.h"
+#include "h9362.h"
+#ifdef X
+#include "h109.h"
+#endif
+struct S2178 { int a; const char *s = "x//y"; };
+inline int f2178_0(int x) { return x * 0; }
+inline int f2178_1(int x) { return x * 1; }
+inline int f2178_2(int x) { return x * 2; }
+inline int f2178_3(int x) { return x * 3; }
+inline int f2178_4(int x) { return x * 4; }
+inline int f2178_5(int x) { return x * 5; }
+inline int f2178_6(int x) { return x * 6; }
+inline int f2178_7(int x) { return x * 7; }
+inline int f2178_8(int x) { return x * 8; }
+inline int f2178_9(int x) { return x * 9; }
+inline int f2178_10(int x) { return x * 10; }
+inline int f2178_11(int x) { return x * 11; }
+inline int f2178_12(int x) { return x * 12; }
+inline int f2178_13(int x) { return x * 13; }
+inline int f2178_14(int x) { return x * 14; }
+inline int f2178_15(int x) { return x * 15; }
+inline int f2178_16(int x) { return x * 16; }
+inline int f2178_17(int x) { return x * 17; }
+inline int f2178_18(int x) { return x * 18; }
+inline int f2178_19(int x) { return x * 19; }
+inline int f2178_20(int x) { return x * 20; }
+inline int f2178_21(int x) { return x * 21; }
+inline int f2178_22(int x) { return x * 22; }
+inline int f2178_23(int x) { return x * 23; }
+inline int f2178_24(int x) { return x * 24; }
+inline int f2178_25(int x) { return x * 25; }
+inline int f2178_26(int x) { return x * 26; }
+inline int f2178_27(int x) { return x * 27; }
+inline int f2178_28(int x) { return x * 28; }
+inline int f2178_29(int x) { return x * 29; }
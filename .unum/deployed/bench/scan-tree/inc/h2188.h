@@ -0,0 +1,42 @@
+#pragma once
+/* header 2188 */
+#include <vector>
+#include "h6838.h"
+#include "h401.h"
+#include "h2940.h"
+#include "h8406.h"
+#include "h4821.h"
+#ifdef X
+#include "h8562.h"
+#endif
+struct S2188 { int a; const char *s = "x//y"; };
+inline int f2188_0(int x) { return x * 0; }
+inline int f2188_1(int x) { return x * 1; }
+inline int f2188_2(int x) { return x * 2; }
+inline int f2188_3(int x) { return x * 3; }
+inline int f2188_4(int x) { return x * 4; }
+inline int f2188_5(int x) { return x * 5; }
+inline int f2188_6(int x) { return x * 6; }
+inline int f2188_7(int x) { return x * 7; }
+inline int f2188_8(int x) { return x * 8; }
+inline int f2188_9(int x) { return x * 9; }
+inline int f2188_10(int x) { return x * 10; }
+inline int f2188_11(int x) { return x * 11; }
+inline int f2188_12(int x) { return x * 12; }
+inline int f2188_13(int x) { return x * 13; }
+inline int f2188_14(int x) { return x * 14; }
+inline int f2188_15(int x) { return x * 15; }
+inline int f2188_16(int x) { return x * 16; }
+inline int f2188_17(int x) { return x * 17; }
+inline int f2188_18(int x) { return x * 18; }
+inline int f2188_19(int x) { return x * 19; }
+inline int f2188_20(int x) { return x * 20; }
+inline int f2188_21(int x) { return x * 21; }
+inline int f2188_22(int x) { return x * 22; }
+inline int f2188_23(int x) { return x * 23; }
+inline int f2188_24(int x) { return x * 24; }
+inline int f2188_25(int x) { return x * 25; }
+inline int f2188_26(int x) { return x * 26; }
+inline int f2188_27(int x) { return x * 27; }
+inline int f2188_28(int x) { return x * 28; }
+inline int f2188_29(int x) { return x * 29; }
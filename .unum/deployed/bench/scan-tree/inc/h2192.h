@@ -0,0 +1,42 @@
+#pragma once
+/* header 2192 */
+#include <vector>
+#include "h9881.h"
+#include "h6625.h"
+#include "h5822.h"
+#include "h8006.h"
+#include "h6432.h"
+#ifdef X
+#include "h4353.h"
+#endif
+struct S2192 { int a; const char *s = "x//y"; };
+inline int f2192_0(int x) { return x * 0; }
+inline int f2192_1(int x) { return x * 1; }
+inline int f2192_2(int x) { return x * 2; }
+inline int f2192_3(int x) { return x * 3; }
+inline int f2192_4(int x) { return x * 4; }
+inline int f2192_5(int x) { return x * 5; }
+inline int f2192_6(int x) { return x * 6; }
+inline int f2192_7(int x) { return x * 7; }
+inline int f2192_8(int x) { return x * 8; }
+inline int f2192_9(int x) { return x * 9; }
+inline int f2192_10(int x) { return x * 10; }
+inline int f2192_11(int x) { return x * 11; }
+inline int f2192_12(int x) { return x * 12; }
+inline int f2192_13(int x) { return x * 13; }
+inline int f2192_14(int x) { return x * 14; }
+inline int f2192_15(int x) { return x * 15; }
+inline int f2192_16(int x) { return x * 16; }
+inline int f2192_17(int x) { return x * 17; }
+inline int f2192_18(int x) { return x * 18; }
+inline int f2192_19(int x) { return x * 19; }
+inline int f2192_20(int x) { return x * 20; }
+inline int f2192_21(int x) { return x * 21; }
+inline int f2192_22(int x) { return x * 22; }
+inline int f2192_23(int x) { return x * 23; }
+inline int f2192_24(int x) { return x * 24; }
+inline int f2192_25(int x) { return x * 25; }
+inline int f2192_26(int x) { return x * 26; }
+inline int f2192_27(int x) { return x * 27; }
+inline int f2192_28(int x) { return x * 28; }
+inline int f2192_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2194 */
+#include <vector>
+#include "h9462.h"
+#include "h3562.h"
+#include "h6758.h"
+#include "h79.h"
+#include "h6500.h"
+#ifdef X
+#include "h7029.h"
+#endif
+struct S2194 { int a; const char *s = "x//y"; };
+inline int f2194_0(int x) { return x * 0; }
+inline int f2194_1(int x) { return x * 1; }
+inline int f2194_2(int x) { return x * 2; }
+inline int f2194_3(int x) { return x * 3; }
+inline int f2194_4(int x) { return x * 4; }
+inline int f2194_5(int x) { return x * 5; }
+inline int f2194_6(int x) { return x * 6; }
+inline int f2194_7(int x) { return x * 7; }
+inline int f2194_8(int x) { return x * 8; }
+inline int f2194_9(int x) { return x * 9; }
+inline int f2194_10(int x) { return x * 10; }
+inline int f2194_11(int x) { return x * 11; }
+inline int f2194_12(int x) { return x * 12; }
+inline int f2194_13(int x) { return x * 13; }
+inline int f2194_14(int x) { return x * 14; }
+inline int f2194_15(int x) { return x * 15; }
+inline int f2194_16(int x) { return x * 16; }
+inline int f2194_17(int x) { return x * 17; }
+inline int f2194_18(int x) { return x * 18; }
+inline int f2194_19(int x) { return x * 19; }
+inline int f2194_20(int x) { return x * 20; }
+inline int f2194_21(int x) { return x * 21; }
+inline int f2194_22(int x) { return x * 22; }
+inline int f2194_23(int x) { return x * 23; }
+inline int f2194_24(int x) { return x * 24; }
+inline int f2194_25(int x) { return x * 25; }
+inline int f2194_26(int x) { return x * 26; }
+inline int f2194_27(int x) { return x * 27; }
+inline int f2194_28(int x) { return x * 28; }
+inline int f2194_29(int x) { return x * 29; }
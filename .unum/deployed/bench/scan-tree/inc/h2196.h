@@ -0,0 +1,42 @@
+#pragma once
+/* header 2196 */
+#include <vector>
+#include "h9331.h"
+#include "h3037.h"
+#include "h7747.h"
+#include "h1755.h"
+#include "h5010.h"
+#ifdef X
+#include "h3781.h"
+#endif
+struct S2196 { int a; const char *s = "x//y"; };
+inline int f2196_0(int x) { return x * 0; }
+inline int f2196_1(int x) { return x * 1; }
+inline int f2196_2(int x) { return x * 2; }
+inline int f2196_3(int x) { return x * 3; }
+inline int f2196_4(int x) { return x * 4; }
+inline int f2196_5(int x) { return x * 5; }
+inline int f2196_6(int x) { return x * 6; }
+inline int f2196_7(int x) { return x * 7; }
+inline int f2196_8(int x) { return x * 8; }
+inline int f2196_9(int x) { return x * 9; }
+inline int f2196_10(int x) { return x * 10; }
+inline int f2196_11(int x) { return x * 11; }
+inline int f2196_12(int x) { return x * 12; }
+inline int f2196_13(int x) { return x * 13; }
+inline int f2196_14(int x) { return x * 14; }
+inline int f2196_15(int x) { return x * 15; }
+inline int f2196_16(int x) { return x * 16; }
+inline int f2196_17(int x) { return x * 17; }
+inline int f2196_18(int x) { return x * 18; }
+inline int f2196_19(int x) { return x * 19; }
+inline int f2196_20(int x) { return x * 20; }
+inline int f2196_21(int x) { return x * 21; }
+inline int f2196_22(int x) { return x * 22; }
+inline int f2196_23(int x) { return x * 23; }
+inline int f2196_24(int x) { return x * 24; }
+inline int f2196_25(int x) { return x * 25; }
+inline int f2196_26(int x) { return x * 26; }
+inline int f2196_27(int x) { return x * 27; }
+inline int f2196_28(int x) { return x * 28; }
+inline int f2196_29(int x) { return x * 29; }
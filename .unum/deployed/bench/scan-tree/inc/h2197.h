@@ -0,0 +1,42 @@
+#pragma once
+/* header 2197 */
+#include <vector>
+#include "h8993.h"
+#include "h994.h"
+#include "h8105.h"
+#include "h826.h"
+#include "h3463.h"
+#ifdef X
+#include "h8561.h"
+#endif
+struct S2197 { int a; const char *s = "x//y"; };
+inline int f2197_0(int x) { return x * 0; }
+inline int f2197_1(int x) { return x * 1; }
+inline int f2197_2(int x) { return x * 2; }
+inline int f2197_3(int x) { return x * 3; }
+inline int f2197_4(int x) { return x * 4; }
+inline int f2197_5(int x) { return x * 5; }
+inline int f2197_6(int x) { return x * 6; }
+inline int f2197_7(int x) { return x * 7; }
+inline int f2197_8(int x) { return x * 8; }
+inline int f2197_9(int x) { return x * 9; }
+inline int f2197_10(int x) { return x * 10; }
+inline int f2197_11(int x) { return x * 11; }
+inline int f2197_12(int x) { return x * 12; }
+inline int f2197_13(int x) { return x * 13; }
+inline int f2197_14(int x) { return x * 14; }
+inline int f2197_15(int x) { return x * 15; }
+inline int f2197_16(int x) { return x * 16; }
+inline int f2197_17(int x) { return x * 17; }
+inline int f2197_18(int x) { return x * 18; }
+inline int f2197_19(int x) { return x * 19; }
+inline int f2197_20(int x) { return x * 20; }
+inline int f2197_21(int x) { return x * 21; }
+inline int f2197_22(int x) { return x * 22; }
+inline int f2197_23(int x) { return x * 23; }
+inline int f2197_24(int x) { return x * 24; }
+inline int f2197_25(int x) { return x * 25; }
+inline int f2197_26(int x) { return x * 26; }
+inline int f2197_27(int x) { return x * 27; }
+inline int f2197_28(int x) { return x * 28; }
+inline int f2197_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2199 */
+#include <vector>
+#include "h4291.h"
+#include "h5871.h"
+#include "h4768.h"
+#include "h6967.h"
+#include "h5814.h"
+#ifdef X
+#include "h5247.h"
+#endif
+struct S2199 { int a; const char *s = "x//y"; };
+inline int f2199_0(int x) { return x * 0; }
+inline int f2199_1(int x) { return x * 1; }
+inline int f2199_2(int x) { return x * 2; }
+inline int f2199_3(int x) { return x * 3; }
+inline int f2199_4(int x) { return x * 4; }
+inline int f2199_5(int x) { return x * 5; }
+inline int f2199_6(int x) { return x * 6; }
+inline int f2199_7(int x) { return x * 7; }
+inline int f2199_8(int x) { return x * 8; }
+inline int f2199_9(int x) { return x * 9; }
+inline int f2199_10(int x) { return x * 10; }
+inline int f2199_11(int x) { return x * 11; }
+inline int f2199_12(int x) { return x * 12; }
+inline int f2199_13(int x) { return x * 13; }
+inline int f2199_14(int x) { return x * 14; }
+inline int f2199_15(int x) { return x * 15; }
+inline int f2199_16(int x) { return x * 16; }
+inline int f2199_17(int x) { return x * 17; }
+inline int f2199_18(int x) { return x * 18; }
+inline int f2199_19(int x) { return x * 19; }
+inline int f2199_20(int x) { return x * 20; }
+inline int f2199_21(int x) { return x * 21; }
+inline int f2199_22(int x) { return x * 22; }
+inline int f2199_23(int x) { return x * 23; }
+inline int f2199_24(int x) { return x * 24; }
+inline int f2199_25(int x) { return x * 25; }
+inline int f2199_26(int x) { return x * 26; }
+inline int f2199_27(int x) { return x * 27; }
+inline int f2199_28(int x) { return x * 28; }
+inline int f2199_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 22 */
+#include <vector>
+#include "h933.h"
+#include "h1089.h"
+#include "h2436.h"
+#include "h3447.h"
+#include "h2736.h"
+#ifdef X
+#include "h8375.h"
+#endif
+struct S22 { int a; const char *s = "x//y"; };
+inline int f22_0(int x) { return x * 0; }
+inline int f22_1(int x) { return x * 1; }
+inline int f22_2(int x) { return x * 2; }
+inline int f22_3(int x) { return x * 3; }
+inline int f22_4(int x) { return x * 4; }
+inline int f22_5(int x) { return x * 5; }
+inline int f22_6(int x) { return x * 6; }
+inline int f22_7(int x) { return x * 7; }
+inline int f22_8(int x) { return x * 8; }
+inline int f22_9(int x) { return x * 9; }
+inline int f22_10(int x) { return x * 10; }
+inline int f22_11(int x) { return x * 11; }
+inline int f22_12(int x) { return x * 12; }
+inline int f22_13(int x) { return x * 13; }
+inline int f22_14(int x) { return x * 14; }
+inline int f22_15(int x) { return x * 15; }
+inline int f22_16(int x) { return x * 16; }
+inline int f22_17(int x) { return x * 17; }
+inline int f22_18(int x) { return x * 18; }
+inline int f22_19(int x) { return x * 19; }
+inline int f22_20(int x) { return x * 20; }
+inline int f22_21(int x) { return x * 21; }
+inline int f22_22(int x) { return x * 22; }
+inline int f22_23(int x) { return x * 23; }
+inline int f22_24(int x) { return x * 24; }
+inline int f22_25(int x) { return x * 25; }
+inline int f22_26(int x) { return x * 26; }
+inline int f22_27(int x) { return x * 27; }
+inline int f22_28(int x) { return x * 28; }
+inline int f22_29(int x) { return x * 29; }
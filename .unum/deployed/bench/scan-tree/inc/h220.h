@@ -0,0 +1,42 @@
+#pragma once
+/* header 220 */
+#include <vector>
+#include "h4064.h"
+#include "h529.h"
+#include "h1151.h"
+#include "h3762.h"
+#include "h3242.h"
+#ifdef X
+#include "h8464.h"
+#endif
+struct S220 { int a; const char *s = "x//y"; };
+inline int f220_0(int x) { return x * 0; }
+inline int f220_1(int x) { return x * 1; }
+inline int f220_2(int x) { return x * 2; }
+inline int f220_3(int x) { return x * 3; }
+inline int f220_4(int x) { return x * 4; }
+inline int f220_5(int x) { return x * 5; }
+inline int f220_6(int x) { return x * 6; }
+inline int f220_7(int x) { return x * 7; }
+inline int f220_8(int x) { return x * 8; }
+inline int f220_9(int x) { return x * 9; }
+inline int f220_10(int x) { return x * 10; }
+inline int f220_11(int x) { return x * 11; }
+inline int f220_12(int x) { return x * 12; }
+inline int f220_13(int x) { return x * 13; }
+inline int f220_14(int x) { return x * 14; }
+inline int f220_15(int x) { return x * 15; }
+inline int f220_16(int x) { return x * 16; }
+inline int f220_17(int x) { return x * 17; }
+inline int f220_18(int x) { return x * 18; }
+inline int f220_19(int x) { return x * 19; }
+inline int f220_20(int x) { return x * 20; }
+inline int f220_21(int x) { return x * 21; }
+inline int f220_22(int x) { return x * 22; }
+inline int f220_23(int x) { return x * 23; }
+inline int f220_24(int x) { return x * 24; }
+inline int f220_25(int x) { return x * 25; }
+inline int f220_26(int x) { return x * 26; }
+inline int f220_27(int x) { return x * 27; }
+inline int f220_28(int x) { return x * 28; }
+inline int f220_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2203 */
+#include <vector>
+#include "h4396.h"
+#include "h1750.h"
+#include "h798.h"
+#include "h2871.h"
+#include "h3784.h"
+#ifdef X
+#include "h7132.h"
+#endif
+struct S2203 { int a; const char *s = "x//y"; };
+inline int f2203_0(int x) { return x * 0; }
+inline int f2203_1(int x) { return x * 1; }
+inline int f2203_2(int x) { return x * 2; }
+inline int f2203_3(int x) { return x * 3; }
+inline int f2203_4(int x) { return x * 4; }
+inline int f2203_5(int x) { return x * 5; }
+inline int f2203_6(int x) { return x * 6; }
+inline int f2203_7(int x) { return x * 7; }
+inline int f2203_8(int x) { return x * 8; }
+inline int f2203_9(int x) { return x * 9; }
+inline int f2203_10(int x) { return x * 10; }
+inline int f2203_11(int x) { return x * 11; }
+inline int f2203_12(int x) { return x * 12; }
+inline int f2203_13(int x) { return x * 13; }
+inline int f2203_14(int x) { return x * 14; }
+inline int f2203_15(int x) { return x * 15; }
+inline int f2203_16(int x) { return x * 16; }
+inline int f2203_17(int x) { return x * 17; }
+inline int f2203_18(int x) { return x * 18; }
+inline int f2203_19(int x) { return x * 19; }
+inline int f2203_20(int x) { return x * 20; }
+inline int f2203_21(int x) { return x * 21; }
+inline int f2203_22(int x) { return x * 22; }
+inline int f2203_23(int x) { return x * 23; }
+inline int f2203_24(int x) { return x * 24; }
+inline int f2203_25(int x) { return x * 25; }
+inline int f2203_26(int x) { return x * 26; }
+inline int f2203_27(int x) { return x * 27; }
+inline int f2203_28(int x) { return x * 28; }
+inline int f2203_29(int x) { return x * 29; }
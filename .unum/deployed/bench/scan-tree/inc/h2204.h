@@ -0,0 +1,42 @@
+#pragma once
+/* header 2204 */
+#include <vector>
+#include "h4544.h"
+#include "h3649.h"
+#include "h3774.h"
+#include "h9360.h"
+#include "h3363.h"
+#ifdef X
+#include "h4096.h"
+#endif
+struct S2204 { int a; const char *s = "x//y"; };
+inline int f2204_0(int x) { return x * 0; }
+inline int f2204_1(int x) { return x * 1; }
+inline int f2204_2(int x) { return x * 2; }
+inline int f2204_3(int x) { return x * 3; }
+inline int f2204_4(int x) { return x * 4; }
+inline int f2204_5(int x) { return x * 5; }
+inline int f2204_6(int x) { return x * 6; }
+inline int f2204_7(int x) { return x * 7; }
+inline int f2204_8(int x) { return x * 8; }
+inline int f2204_9(int x) { return x * 9; }
+inline int f2204_10(int x) { return x * 10; }
+inline int f2204_11(int x) { return x * 11; }
+inline int f2204_12(int x) { return x * 12; }
+inline int f2204_13(int x) { return x * 13; }
+inline int f2204_14(int x) { return x * 14; }
+inline int f2204_15(int x) { return x * 15; }
+inline int f2204_16(int x) { return x * 16; }
+inline int f2204_17(int x) { return x * 17; }
+inline int f2204_18(int x) { return x * 18; }
+inline int f2204_19(int x) { return x * 19; }
+inline int f2204_20(int x) { return x * 20; }
+inline int f2204_21(int x) { return x * 21; }
+inline int f2204_22(int x) { return x * 22; }
+inline int f2204_23(int x) { return x * 23; }
+inline int f2204_24(int x) { return x * 24; }
+inline int f2204_25(int x) { return x * 25; }
+inline int f2204_26(int x) { return x * 26; }
+inline int f2204_27(int x) { return x * 27; }
+inline int f2204_28(int x) { return x * 28; }
+inline int f2204_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2205 */
+#include <vector>
+#include "h1402.h"
+#include "h1117.h"
+#include "h713.h"
+#include "h4068.h"
+#include "h6317.h"
+#ifdef X
+#include "h2829.h"
+#endif
+struct S2205 { int a; const char *s = "x//y"; };
+inline int f2205_0(int x) { return x * 0; }
+inline int f2205_1(int x) { return x * 1; }
+inline int f2205_2(int x) { return x * 2; }
+inline int f2205_3(int x) { return x * 3; }
+inline int f2205_4(int x) { return x * 4; }
+inline int f2205_5(int x) { return x * 5; }
+inline int f2205_6(int x) { return x * 6; }
+inline int f2205_7(int x) { return x * 7; }
+inline int f2205_8(int x) { return x * 8; }
+inline int f2205_9(int x) { return x * 9; }
+inline int f2205_10(int x) { return x * 10; }
+inline int f2205_11(int x) { return x * 11; }
+inline int f2205_12(int x) { return x * 12; }
+inline int f2205_13(int x) { return x * 13; }
+inline int f2205_14(int x) { return x * 14; }
+inline int f2205_15(int x) { return x * 15; }
+inline int f2205_16(int x) { return x * 16; }
+inline int f2205_17(int x) { return x * 17; }
+inline int f2205_18(int x) { return x * 18; }
+inline int f2205_19(int x) { return x * 19; }
+inline int f2205_20(int x) { return x * 20; }
+inline int f2205_21(int x) { return x * 21; }
+inline int f2205_22(int x) { return x * 22; }
+inline int f2205_23(int x) { return x * 23; }
+inline int f2205_24(int x) { return x * 24; }
+inline int f2205_25(int x) { return x * 25; }
+inline int f2205_26(int x) { return x * 26; }
+inline int f2205_27(int x) { return x * 27; }
+inline int f2205_28(int x) { return x * 28; }
+inline int f2205_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2208 */
+#include <vector>
+#include "h3620.h"
+#include "h8677.h"
+#include "h2039.h"
+#include "h2551.h"
+#include "h4975.h"
+#ifdef X
+#include "h8409.h"
+#endif
+struct S2208 { int a; const char *s = "x//y"; };
+inline int f2208_0(int x) { return x * 0; }
+inline int f2208_1(int x) { return x * 1; }
+inline int f2208_2(int x) { return x * 2; }
+inline int f2208_3(int x) { return x * 3; }
+inline int f2208_4(int x) { return x * 4; }
+inline int f2208_5(int x) { return x * 5; }
+inline int f2208_6(int x) { return x * 6; }
+inline int f2208_7(int x) { return x * 7; }
+inline int f2208_8(int x) { return x * 8; }
+inline int f2208_9(int x) { return x * 9; }
+inline int f2208_10(int x) { return x * 10; }
+inline int f2208_11(int x) { return x * 11; }
+inline int f2208_12(int x) { return x * 12; }
+inline int f2208_13(int x) { return x * 13; }
+inline int f2208_14(int x) { return x * 14; }
+inline int f2208_15(int x) { return x * 15; }
+inline int f2208_16(int x) { return x * 16; }
+inline int f2208_17(int x) { return x * 17; }
+inline int f2208_18(int x) { return x * 18; }
+inline int f2208_19(int x) { return x * 19; }
+inline int f2208_20(int x) { return x * 20; }
+inline int f2208_21(int x) { return x * 21; }
+inline int f2208_22(int x) { return x * 22; }
+inline int f2208_23(int x) { return x * 23; }
+inline int f2208_24(int x) { return x * 24; }
+inline int f2208_25(int x) { return x * 25; }
+inline int f2208_26(int x) { return x * 26; }
+inline int f2208_27(int x) { return x * 27; }
+inline int f2208_28(int x) { return x * 28; }
+inline int f2208_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2210 */
+#include <vector>
+#include "h5838.h"
+#include "h7531.h"
+#include "h1514.h"
+#include "h3747.h"
+#include "h5152.h"
+#ifdef X
+#include "h4778.h"
+#endif
+struct S2210 { int a; const char *s = "x//y"; };
+inline int f2210_0(int x) { return x * 0; }
+inline int f2210_1(int x) { return x * 1; }
+inline int f2210_2(int x) { return x * 2; }
+inline int f2210_3(int x) { return x * 3; }
+inline int f2210_4(int x) { return x * 4; }
+inline int f2210_5(int x) { return x * 5; }
+inline int f2210_6(int x) { return x * 6; }
+inline int f2210_7(int x) { return x * 7; }
+inline int f2210_8(int x) { return x * 8; }
+inline int f2210_9(int x) { return x * 9; }
+inline int f2210_10(int x) { return x * 10; }
+inline int f2210_11(int x) { return x * 11; }
+inline int f2210_12(int x) { return x * 12; }
+inline int f2210_13(int x) { return x * 13; }
+inline int f2210_14(int x) { return x * 14; }
+inline int f2210_15(int x) { return x * 15; }
+inline int f2210_16(int x) { return x * 16; }
+inline int f2210_17(int x) { return x * 17; }
+inline int f2210_18(int x) { return x * 18; }
+inline int f2210_19(int x) { return x * 19; }
+inline int f2210_20(int x) { return x * 20; }
+inline int f2210_21(int x) { return x * 21; }
+inline int f2210_22(int x) { return x * 22; }
+inline int f2210_23(int x) { return x * 23; }
+inline int f2210_24(int x) { return x * 24; }
+inline int f2210_25(int x) { return x * 25; }
+inline int f2210_26(int x) { return x * 26; }
+inline int f2210_27(int x) { return x * 27; }
+inline int f2210_28(int x) { return x * 28; }
+inline int f2210_29(int x) { return x * 29; }
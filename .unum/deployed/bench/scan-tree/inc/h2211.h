@@ -0,0 +1,42 @@
+#pragma once
+/* header 2211 */
+#include <vector>
+#include "h2391.h"
+#include "h7084.h"
+#include "h9730.h"
+#include "h9897.h"
+#include "h2530.h"
+#ifdef X
+#include "h3949.h"
+#endif
+struct S2211 { int a; const char *s = "x//y"; };
+inline int f2211_0(int x) { return x * 0; }
+inline int f2211_1(int x) { return x * 1; }
+inline int f2211_2(int x) { return x * 2; }
+inline int f2211_3(int x) { return x * 3; }
+inline int f2211_4(int x) { return x * 4; }
+inline int f2211_5(int x) { return x * 5; }
+inline int f2211_6(int x) { return x * 6; }
+inline int f2211_7(int x) { return x * 7; }
+inline int f2211_8(int x) { return x * 8; }
+inline int f2211_9(int x) { return x * 9; }
+inline int f2211_10(int x) { return x * 10; }
+inline int f2211_11(int x) { return x * 11; }
+inline int f2211_12(int x) { return x * 12; }
+inline int f2211_13(int x) { return x * 13; }
+inline int f2211_14(int x) { return x * 14; }
+inline int f2211_15(int x) { return x * 15; }
+inline int f2211_16(int x) { return x * 16; }
+inline int f2211_17(int x) { return x * 17; }
+inline int f2211_18(int x) { return x * 18; }
+inline int f2211_19(int x) { return x * 19; }
+inline int f2211_20(int x) { return x * 20; }
+inline int f2211_21(int x) { return x * 21; }
+inline int f2211_22(int x) { return x * 22; }
+inline int f2211_23(int x) { return x * 23; }
+inline int f2211_24(int x) { return x * 24; }
+inline int f2211_25(int x) { return x * 25; }
+inline int f2211_26(int x) { return x * 26; }
+inline int f2211_27(int x) { return x * 27; }
+inline int f2211_28(int x) { return x * 28; }
+inline int f2211_29(int x) { return x * 29; }
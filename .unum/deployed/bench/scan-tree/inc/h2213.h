@@ -0,0 +1,42 @@
+#pragma once
+/* header 2213 */
+#include <vector>
+#include "h4968.h"
+#include "h9595.h"
+#include "h6002.h"
+#include "h6060.h"
+#include "h7183.h"
+#ifdef X
+#include "h5222.h"
+#endif
+struct S2213 { int a; const char *s = "x//y"; };
+inline int f2213_0(int x) { return x * 0; }
+inline int f2213_1(int x) { return x * 1; }
+inline int f2213_2(int x) { return x * 2; }
+inline int f2213_3(int x) { return x * 3; }
+inline int f2213_4(int x) { return x * 4; }
+inline int f2213_5(int x) { return x * 5; }
+inline int f2213_6(int x) { return x * 6; }
+inline int f2213_7(int x) { return x * 7; }
+inline int f2213_8(int x) { return x * 8; }
+inline int f2213_9(int x) { return x * 9; }
+inline int f2213_10(int x) { return x * 10; }
+inline int f2213_11(int x) { return x * 11; }
+inline int f2213_12(int x) { return x * 12; }
+inline int f2213_13(int x) { return x * 13; }
+inline int f2213_14(int x) { return x * 14; }
+inline int f2213_15(int x) { return x * 15; }
+inline int f2213_16(int x) { return x * 16; }
+inline int f2213_17(int x) { return x * 17; }
+inline int f2213_18(int x) { return x * 18; }
+inline int f2213_19(int x) { return x * 19; }
+inline int f2213_20(int x) { return x * 20; }
+inline int f2213_21(int x) { return x * 21; }
+inline int f2213_22(int x) { return x * 22; }
+inline int f2213_23(int x) { return x * 23; }
+inline int f2213_24(int x) { return x * 24; }
+inline int f2213_25(int x) { return x * 25; }
+inline int f2213_26(int x) { return x * 26; }
+inline int f2213_27(int x) { return x * 27; }
+inline int f2213_28(int x) { return x * 28; }
+inline int f2213_29(int x) { return x * 29; }
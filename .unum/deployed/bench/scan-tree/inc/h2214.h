@@ -0,0 +1,42 @@
+#pragma once
+/* header 2214 */
+#include <vector>
+#include "h9545.h"
+#include "h7655.h"
+#include "h4490.h"
+#include "h6622.h"
+#include "h3598.h"
+#ifdef X
+#include "h7398.h"
+#endif
+struct S2214 { int a; const char *s = "x//y"; };
+inline int f2214_0(int x) { return x * 0; }
+inline int f2214_1(int x) { return x * 1; }
+inline int f2214_2(int x) { return x * 2; }
+inline int f2214_3(int x) { return x * 3; }
+inline int f2214_4(int x) { return x * 4; }
+inline int f2214_5(int x) { return x * 5; }
+inline int f2214_6(int x) { return x * 6; }
+inline int f2214_7(int x) { return x * 7; }
+inline int f2214_8(int x) { return x * 8; }
+inline int f2214_9(int x) { return x * 9; }
+inline int f2214_10(int x) { return x * 10; }
+inline int f2214_11(int x) { return x * 11; }
+inline int f2214_12(int x) { return x * 12; }
+inline int f2214_13(int x) { return x * 13; }
+inline int f2214_14(int x) { return x * 14; }
+inline int f2214_15(int x) { return x * 15; }
+inline int f2214_16(int x) { return x * 16; }
+inline int f2214_17(int x) { return x * 17; }
+inline int f2214_18(int x) { return x * 18; }
+inline int f2214_19(int x) { return x * 19; }
+inline int f2214_20(int x) { return x * 20; }
+inline int f2214_21(int x) { return x * 21; }
+inline int f2214_22(int x) { return x * 22; }
+inline int f2214_23(int x) { return x * 23; }
+inline int f2214_24(int x) { return x * 24; }
+inline int f2214_25(int x) { return x * 25; }
+inline int f2214_26(int x) { return x * 26; }
+inline int f2214_27(int x) { return x * 27; }
+inline int f2214_28(int x) { return x * 28; }
+inline int f2214_29(int x) { return x * 29; }
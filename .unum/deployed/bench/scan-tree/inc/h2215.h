@@ -0,0 +1,42 @@
+#pragma once
+/* header 2215 */
+#include <vector>
+#include "h6013.h"
+#include "h4504.h"
+#include "h1633.h"
+#include "h1660.h"
+#include "h6163.h"
+#ifdef X
+#include "h6818.h"
+#endif
+struct S2215 { int a; const char *s = "x//y"; };
+inline int f2215_0(int x) { return x * 0; }
+inline int f2215_1(int x) { return x * 1; }
+inline int f2215_2(int x) { return x * 2; }
+inline int f2215_3(int x) { return x * 3; }
+inline int f2215_4(int x) { return x * 4; }
+inline int f2215_5(int x) { return x * 5; }
+inline int f2215_6(int x) { return x * 6; }
+inline int f2215_7(int x) { return x * 7; }
+inline int f2215_8(int x) { return x * 8; }
+inline int f2215_9(int x) { return x * 9; }
+inline int f2215_10(int x) { return x * 10; }
+inline int f2215_11(int x) { return x * 11; }
+inline int f2215_12(int x) { return x * 12; }
+inline int f2215_13(int x) { return x * 13; }
+inline int f2215_14(int x) { return x * 14; }
+inline int f2215_15(int x) { return x * 15; }
+inline int f2215_16(int x) { return x * 16; }
+inline int f2215_17(int x) { return x * 17; }
+inline int f2215_18(int x) { return x * 18; }
+inline int f2215_19(int x) { return x * 19; }
+inline int f2215_20(int x) { return x * 20; }
+inline int f2215_21(int x) { return x * 21; }
+inline int f2215_22(int x) { return x * 22; }
+inline int f2215_23(int x) { return x * 23; }
+inline int f2215_24(int x) { return x * 24; }
+inline int f2215_25(int x) { return x * 25; }
+inline int f2215_26(int x) { return x * 26; }
+inline int f2215_27(int x) { return x * 27; }
+inline int f2215_28(int x) { return x * 28; }
+inline int f2215_29(int x) { return x * 29; }
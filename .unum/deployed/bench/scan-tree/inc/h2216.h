@@ -0,0 +1,42 @@
+#pragma once
+/* header 2216 */
+#include <vector>
+#include "h4308.h"
+#include "h8526.h"
+#include "h4774.h"
+#include "h4830.h"
+#include "h971.h"
+#ifdef X
+#include "h2658.h"
+#endif
+struct S2216 { int a; const char *s = "x//y"; };
+inline int f2216_0(int x) { return x * 0; }
+inline int f2216_1(int x) { return x * 1; }
+inline int f2216_2(int x) { return x * 2; }
+inline int f2216_3(int x) { return x * 3; }
+inline int f2216_4(int x) { return x * 4; }
+inline int f2216_5(int x) { return x * 5; }
+inline int f2216_6(int x) { return x * 6; }
+inline int f2216_7(int x) { return x * 7; }
+inline int f2216_8(int x) { return x * 8; }
+inline int f2216_9(int x) { return x * 9; }
+inline int f2216_10(int x) { return x * 10; }
+inline int f2216_11(int x) { return x * 11; }
+inline int f2216_12(int x) { return x * 12; }
+inline int f2216_13(int x) { return x * 13; }
+inline int f2216_14(int x) { return x * 14; }
+inline int f2216_15(int x) { return x * 15; }
+inline int f2216_16(int x) { return x * 16; }
+inline int f2216_17(int x) { return x * 17; }
+inline int f2216_18(int x) { return x * 18; }
+inline int f2216_19(int x) { return x * 19; }
+inline int f2216_20(int x) { return x * 20; }
+inline int f2216_21(int x) { return x * 21; }
+inline int f2216_22(int x) { return x * 22; }
+inline int f2216_23(int x) { return x * 23; }
+inline int f2216_24(int x) { return x * 24; }
+inline int f2216_25(int x) { return x * 25; }
+inline int f2216_26(int x) { return x * 26; }
+inline int f2216_27(int x) { return x * 27; }
+inline int f2216_28(int x) { return x * 28; }
+inline int f2216_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2219 */
+#include <vector>
+#include "h2660.h"
+#include "h2941.h"
+#include "h7189.h"
+#include "h2069.h"
+#include "h2233.h"
+#ifdef X
+#include "h7436.h"
+#endif
+struct S2219 { int a; const char *s = "x//y"; };
+inline int f2219_0(int x) { return x * 0; }
+inline int f2219_1(int x) { return x * 1; }
+inline int f2219_2(int x) { return x * 2; }
+inline int f2219_3(int x) { return x * 3; }
+inline int f2219_4(int x) { return x * 4; }
+inline int f2219_5(int x) { return x * 5; }
+inline int f2219_6(int x) { return x * 6; }
+inline int f2219_7(int x) { return x * 7; }
+inline int f2219_8(int x) { return x * 8; }
+inline int f2219_9(int x) { return x * 9; }
+inline int f2219_10(int x) { return x * 10; }
+inline int f2219_11(int x) { return x * 11; }
+inline int f2219_12(int x) { return x * 12; }
+inline int f2219_13(int x) { return x * 13; }
+inline int f2219_14(int x) { return x * 14; }
+inline int f2219_15(int x) { return x * 15; }
+inline int f2219_16(int x) { return x * 16; }
+inline int f2219_17(int x) { return x * 17; }
+inline int f2219_18(int x) { return x * 18; }
+inline int f2219_19(int x) { return x * 19; }
+inline int f2219_20(int x) { return x * 20; }
+inline int f2219_21(int x) { return x * 21; }
+inline int f2219_22(int x) { return x * 22; }
+inline int f2219_23(int x) { return x * 23; }
+inline int f2219_24(int x) { return x * 24; }
+inline int f2219_25(int x) { return x * 25; }
+inline int f2219_26(int x) { return x * 26; }
+inline int f2219_27(int x) { return x * 27; }
+inline int f2219_28(int x) { return x * 28; }
+inline int f2219_29(int x) { return x * 29; }
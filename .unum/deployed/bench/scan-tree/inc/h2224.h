@@ -0,0 +1,42 @@
+#pragma once
+/* header 2224 */
+#include <vector>
+#include "h4191.h"
+#include "h8843.h"
+#include "h2909.h"
+#include "h9945.h"
+#include "h8382.h"
+#ifdef X
+#include "h3828.h"
+#endif
+struct S2224 { int a; const char *s = "x//y"; };
+inline int f2224_0(int x) { return x * 0; }
+inline int f2224_1(int x) { return x * 1; }
+inline int f2224_2(int x) { return x * 2; }
+inline int f2224_3(int x) { return x * 3; }
+inline int f2224_4(int x) { return x * 4; }
+inline int f2224_5(int x) { return x * 5; }
+inline int f2224_6(int x) { return x * 6; }
+inline int f2224_7(int x) { return x * 7; }
+inline int f2224_8(int x) { return x * 8; }
+inline int f2224_9(int x) { return x * 9; }
+inline int f2224_10(int x) { return x * 10; }
+inline int f2224_11(int x) { return x * 11; }
+inline int f2224_12(int x) { return x * 12; }
+inline int f2224_13(int x) { return x * 13; }
+inline int f2224_14(int x) { return x * 14; }
+inline int f2224_15(int x) { return x * 15; }
+inline int f2224_16(int x) { return x * 16; }
+inline int f2224_17(int x) { return x * 17; }
+inline int f2224_18(int x) { return x * 18; }
+inline int f2224_19(int x) { return x * 19; }
+inline int f2224_20(int x) { return x * 20; }
+inline int f2224_21(int x) { return x * 21; }
+inline int f2224_22(int x) { return x * 22; }
+inline int f2224_23(int x) { return x * 23; }
+inline int f2224_24(int x) { return x * 24; }
+inline int f2224_25(int x) { return x * 25; }
+inline int f2224_26(int x) { return x * 26; }
+inline int f2224_27(int x) { return x * 27; }
+inline int f2224_28(int x) { return x * 28; }
+inline int f2224_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2227 */
+#include <vector>
+#include "h6819.h"
+#include "h1367.h"
+#include "h7525.h"
+#include "h5788.h"
+#include "h5223.h"
+#ifdef X
+#include "h5664.h"
+#endif
+struct S2227 { int a; const char *s = "x//y"; };
+inline int f2227_0(int x) { return x * 0; }
+inline int f2227_1(int x) { return x * 1; }
+inline int f2227_2(int x) { return x * 2; }
+inline int f2227_3(int x) { return x * 3; }
+inline int f2227_4(int x) { return x * 4; }
+inline int f2227_5(int x) { return x * 5; }
+inline int f2227_6(int x) { return x * 6; }
+inline int f2227_7(int x) { return x * 7; }
+inline int f2227_8(int x) { return x * 8; }
+inline int f2227_9(int x) { return x * 9; }
+inline int f2227_10(int x) { return x * 10; }
+inline int f2227_11(int x) { return x * 11; }
+inline int f2227_12(int x) { return x * 12; }
+inline int f2227_13(int x) { return x * 13; }
+inline int f2227_14(int x) { return x * 14; }
+inline int f2227_15(int x) { return x * 15; }
+inline int f2227_16(int x) { return x * 16; }
+inline int f2227_17(int x) { return x * 17; }
+inline int f2227_18(int x) { return x * 18; }
+inline int f2227_19(int x) { return x * 19; }
+inline int f2227_20(int x) { return x * 20; }
+inline int f2227_21(int x) { return x * 21; }
+inline int f2227_22(int x) { return x * 22; }
+inline int f2227_23(int x) { return x * 23; }
+inline int f2227_24(int x) { return x * 24; }
+inline int f2227_25(int x) { return x * 25; }
+inline int f2227_26(int x) { return x * 26; }
+inline int f2227_27(int x) { return x * 27; }
+inline int f2227_28(int x) { return x * 28; }
+inline int f2227_29(int x) { return x * 29; }
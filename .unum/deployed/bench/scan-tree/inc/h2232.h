@@ -0,0 +1,42 @@
+#pragma once
+/* header 2232 */
+#include <vector>
+#include "h5195.h"
+#include "h7792.h"
+#include "h9643.h"
+#include "h3152.h"
+#include "h8642.h"
+#ifdef X
+#include "h7874.h"
+#endif
+struct S2232 { int a; const char *s = "x//y"; };
+inline int f2232_0(int x) { return x * 0; }
+inline int f2232_1(int x) { return x * 1; }
+inline int f2232_2(int x) { return x * 2; }
+inline int f2232_3(int x) { return x * 3; }
+inline int f2232_4(int x) { return x * 4; }
+inline int f2232_5(int x) { return x * 5; }
+inline int f2232_6(int x) { return x * 6; }
+inline int f2232_7(int x) { return x * 7; }
+inline int f2232_8(int x) { return x * 8; }
+inline int f2232_9(int x) { return x * 9; }
+inline int f2232_10(int x) { return x * 10; }
+inline int f2232_11(int x) { return x * 11; }
+inline int f2232_12(int x) { return x * 12; }
+inline int f2232_13(int x) { return x * 13; }
+inline int f2232_14(int x) { return x * 14; }
+inline int f2232_15(int x) { return x * 15; }
+inline int f2232_16(int x) { return x * 16; }
+inline int f2232_17(int x) { return x * 17; }
+inline int f2232_18(int x) { return x * 18; }
+inline int f2232_19(int x) { return x * 19; }
+inline int f2232_20(int x) { return x * 20; }
+inline int f2232_21(int x) { return x * 21; }
+inline int f2232_22(int x) { return x * 22; }
+inline int f2232_23(int x) { return x * 23; }
+inline int f2232_24(int x) { return x * 24; }
+inline int f2232_25(int x) { return x * 25; }
+inline int f2232_26(int x) { return x * 26; }
+inline int f2232_27(int x) { return x * 27; }
+inline int f2232_28(int x) { return x * 28; }
+inline int f2232_29(int x) { return x * 29; }
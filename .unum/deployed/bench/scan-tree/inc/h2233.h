@@ -0,0 +1,42 @@
+#pragma once
+/* header 2233 */
+#include <vector>
+#include "h1066.h"
+#include "h2863.h"
+#include "h8355.h"
+#include "h3071.h"
+#include "h5082.h"
+#ifdef X
+#include "h2086.h"
+#endif
+struct S2233 { int a; const char *s = "x//y"; };
+inline int f2233_0(int x) { return x * 0; }
+inline int f2233_1(int x) { return x * 1; }
+inline int f2233_2(int x) { return x * 2; }
+inline int f2233_3(int x) { return x * 3; }
+inline int f2233_4(int x) { return x * 4; }
+inline int f2233_5(int x) { return x * 5; }
+inline int f2233_6(int x) { return x * 6; }
+inline int f2233_7(int x) { return x * 7; }
+inline int f2233_8(int x) { return x * 8; }
+inline int f2233_9(int x) { return x * 9; }
+inline int f2233_10(int x) { return x * 10; }
+inline int f2233_11(int x) { return x * 11; }
+inline int f2233_12(int x) { return x * 12; }
+inline int f2233_13(int x) { return x * 13; }
+inline int f2233_14(int x) { return x * 14; }
+inline int f2233_15(int x) { return x * 15; }
+inline int f2233_16(int x) { return x * 16; }
+inline int f2233_17(int x) { return x * 17; }
+inline int f2233_18(int x) { return x * 18; }
+inline int f2233_19(int x) { return x * 19; }
+inline int f2233_20(int x) { return x * 20; }
+inline int f2233_21(int x) { return x * 21; }
+inline int f2233_22(int x) { return x * 22; }
+inline int f2233_23(int x) { return x * 23; }
+inline int f2233_24(int x) { return x * 24; }
+inline int f2233_25(int x) { return x * 25; }
+inline int f2233_26(int x) { return x * 26; }
+inline int f2233_27(int x) { return x * 27; }
+inline int f2233_28(int x) { return x * 28; }
+inline int f2233_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2235 */
+#include <vector>
+#include "h2550.h"
+#include "h7712.h"
+#include "h3382.h"
+#include "h5131.h"
+#include "h2750.h"
+#ifdef X
+#include "h3009.h"
+#endif
+struct S2235 { int a; const char *s = "x//y"; };
+inline int f2235_0(int x) { return x * 0; }
+inline int f2235_1(int x) { return x * 1; }
+inline int f2235_2(int x) { return x * 2; }
+inline int f2235_3(int x) { return x * 3; }
+inline int f2235_4(int x) { return x * 4; }
+inline int f2235_5(int x) { return x * 5; }
+inline int f2235_6(int x) { return x * 6; }
+inline int f2235_7(int x) { return x * 7; }
+inline int f2235_8(int x) { return x * 8; }
+inline int f2235_9(int x) { return x * 9; }
+inline int f2235_10(int x) { return x * 10; }
+inline int f2235_11(int x) { return x * 11; }
+inline int f2235_12(int x) { return x * 12; }
+inline int f2235_13(int x) { return x * 13; }
+inline int f2235_14(int x) { return x * 14; }
+inline int f2235_15(int x) { return x * 15; }
+inline int f2235_16(int x) { return x * 16; }
+inline int f2235_17(int x) { return x * 17; }
+inline int f2235_18(int x) { return x * 18; }
+inline int f2235_19(int x) { return x * 19; }
+inline int f2235_20(int x) { return x * 20; }
+inline int f2235_21(int x) { return x * 21; }
+inline int f2235_22(int x) { return x * 22; }
+inline int f2235_23(int x) { return x * 23; }
+inline int f2235_24(int x) { return x * 24; }
+inline int f2235_25(int x) { return x * 25; }
+inline int f2235_26(int x) { return x * 26; }
+inline int f2235_27(int x) { return x * 27; }
+inline int f2235_28(int x) { return x * 28; }
+inline int f2235_29(int x) { return x * 29; }
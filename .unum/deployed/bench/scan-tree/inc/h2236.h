@@ -0,0 +1,42 @@
+#pragma once
+/* header 2236 */
+#include <vector>
+#include "h2147.h"
+#include "h394.h"
+#include "h133.h"
+#include "h2059.h"
+#include "h6167.h"
+#ifdef X
+#include "h9518.h"
+#endif
+struct S2236 { int a; const char *s = "x//y"; };
+inline int f2236_0(int x) { return x * 0; }
+inline int f2236_1(int x) { return x * 1; }
+inline int f2236_2(int x) { return x * 2; }
+inline int f2236_3(int x) { return x * 3; }
+inline int f2236_4(int x) { return x * 4; }
+inline int f2236_5(int x) { return x * 5; }
+inline int f2236_6(int x) { return x * 6; }
+inline int f2236_7(int x) { return x * 7; }
+inline int f2236_8(int x) { return x * 8; }
+inline int f2236_9(int x) { return x * 9; }
+inline int f2236_10(int x) { return x * 10; }
+inline int f2236_11(int x) { return x * 11; }
+inline int f2236_12(int x) { return x * 12; }
+inline int f2236_13(int x) { return x * 13; }
+inline int f2236_14(int x) { return x * 14; }
+inline int f2236_15(int x) { return x * 15; }
+inline int f2236_16(int x) { return x * 16; }
+inline int f2236_17(int x) { return x * 17; }
+inline int f2236_18(int x) { return x * 18; }
+inline int f2236_19(int x) { return x * 19; }
+inline int f2236_20(int x) { return x * 20; }
+inline int f2236_21(int x) { return x * 21; }
+inline int f2236_22(int x) { return x * 22; }
+inline int f2236_23(int x) { return x * 23; }
+inline int f2236_24(int x) { return x * 24; }
+inline int f2236_25(int x) { return x * 25; }
+inline int f2236_26(int x) { return x * 26; }
+inline int f2236_27(int x) { return x * 27; }
+inline int f2236_28(int x) { return x * 28; }
+inline int f2236_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2237 */
+#include <vector>
+#include "h9501.h"
+#include "h9423.h"
+#include "h5454.h"
+#include "h112.h"
+#include "h2129.h"
+#ifdef X
+#include "h7678.h"
+#endif
+struct S2237 { int a; const char *s = "x//y"; };
+inline int f2237_0(int x) { return x * 0; }
+inline int f2237_1(int x) { return x * 1; }
+inline int f2237_2(int x) { return x * 2; }
+inline int f2237_3(int x) { return x * 3; }
+inline int f2237_4(int x) { return x * 4; }
+inline int f2237_5(int x) { return x * 5; }
+inline int f2237_6(int x) { return x * 6; }
+inline int f2237_7(int x) { return x * 7; }
+inline int f2237_8(int x) { return x * 8; }
+inline int f2237_9(int x) { return x * 9; }
+inline int f2237_10(int x) { return x * 10; }
+inline int f2237_11(int x) { return x * 11; }
+inline int f2237_12(int x) { return x * 12; }
+inline int f2237_13(int x) { return x * 13; }
+inline int f2237_14(int x) { return x * 14; }
+inline int f2237_15(int x) { return x * 15; }
+inline int f2237_16(int x) { return x * 16; }
+inline int f2237_17(int x) { return x * 17; }
+inline int f2237_18(int x) { return x * 18; }
+inline int f2237_19(int x) { return x * 19; }
+inline int f2237_20(int x) { return x * 20; }
+inline int f2237_21(int x) { return x * 21; }
+inline int f2237_22(int x) { return x * 22; }
+inline int f2237_23(int x) { return x * 23; }
+inline int f2237_24(int x) { return x * 24; }
+inline int f2237_25(int x) { return x * 25; }
+inline int f2237_26(int x) { return x * 26; }
+inline int f2237_27(int x) { return x * 27; }
+inline int f2237_28(int x) { return x * 28; }
+inline int f2237_29(int x) { return x * 29; }
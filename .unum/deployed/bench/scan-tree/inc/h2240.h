@@ -0,0 +1,42 @@
+#pragma once
+/* header 2240 */
+#include <vector>
+#include "h7040.h"
+#include "h744.h"
+#include "h314.h"
+#include "h4158.h"
+#include "h8967.h"
+#ifdef X
+#include "h4900.h"
+#endif
+struct S2240 { int a; const char *s = "x//y"; };
+inline int f2240_0(int x) { return x * 0; }
+inline int f2240_1(int x) { return x * 1; }
+inline int f2240_2(int x) { return x * 2; }
+inline int f2240_3(int x) { return x * 3; }
+inline int f2240_4(int x) { return x * 4; }
+inline int f2240_5(int x) { return x * 5; }
+inline int f2240_6(int x) { return x * 6; }
+inline int f2240_7(int x) { return x * 7; }
+inline int f2240_8(int x) { return x * 8; }
+inline int f2240_9(int x) { return x * 9; }
+inline int f2240_10(int x) { return x * 10; }
+inline int f2240_11(int x) { return x * 11; }
+inline int f2240_12(int x) { return x * 12; }
+inline int f2240_13(int x) { return x * 13; }
+inline int f2240_14(int x) { return x * 14; }
+inline int f2240_15(int x) { return x * 15; }
+inline int f2240_16(int x) { return x * 16; }
+inline int f2240_17(int x) { return x * 17; }
+inline int f2240_18(int x) { return x * 18; }
+inline int f2240_19(int x) { return x * 19; }
+inline int f2240_20(int x) { return x * 20; }
+inline int f2240_21(int x) { return x * 21; }
+inline int f2240_22(int x) { return x * 22; }
+inline int f2240_23(int x) { return x * 23; }
+inline int f2240_24(int x) { return x * 24; }
+inline int f2240_25(int x) { return x * 25; }
+inline int f2240_26(int x) { return x * 26; }
+inline int f2240_27(int x) { return x * 27; }
+inline int f2240_28(int x) { return x * 28; }
+inline int f2240_29(int x) { return x * 29; }
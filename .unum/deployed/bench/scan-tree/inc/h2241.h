@@ -0,0 +1,42 @@
+#pragma once
+/* header 2241 */
+#include <vector>
+#include "h7521.h"
+#include "h8949.h"
+#include "h6237.h"
+#include "h3023.h"
+#include "h8153.h"
+#ifdef X
+#include "h9085.h"
+#endif
+struct S2241 { int a; const char *s = "x//y"; };
+inline int f2241_0(int x) { return x * 0; }
+inline int f2241_1(int x) { return x * 1; }
+inline int f2241_2(int x) { return x * 2; }
+inline int f2241_3(int x) { return x * 3; }
+inline int f2241_4(int x) { return x * 4; }
+inline int f2241_5(int x) { return x * 5; }
+inline int f2241_6(int x) { return x * 6; }
+inline int f2241_7(int x) { return x * 7; }
+inline int f2241_8(int x) { return x * 8; }
+inline int f2241_9(int x) { return x * 9; }
+inline int f2241_10(int x) { return x * 10; }
+inline int f2241_11(int x) { return x * 11; }
+inline int f2241_12(int x) { return x * 12; }
+inline int f2241_13(int x) { return x * 13; }
+inline int f2241_14(int x) { return x * 14; }
+inline int f2241_15(int x) { return x * 15; }
+inline int f2241_16(int x) { return x * 16; }
+inline int f2241_17(int x) { return x * 17; }
+inline int f2241_18(int x) { return x * 18; }
+inline int f2241_19(int x) { return x * 19; }
+inline int f2241_20(int x) { return x * 20; }
+inline int f2241_21(int x) { return x * 21; }
+inline int f2241_22(int x) { return x * 22; }
+inline int f2241_23(int x) { return x * 23; }
+inline int f2241_24(int x) { return x * 24; }
+inline int f2241_25(int x) { return x * 25; }
+inline int f2241_26(int x) { return x * 26; }
+inline int f2241_27(int x) { return x * 27; }
+inline int f2241_28(int x) { return x * 28; }
+inline int f2241_29(int x) { return x * 29; }
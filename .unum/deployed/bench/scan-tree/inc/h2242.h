@@ -0,0 +1,42 @@
+#pragma once
+/* header 2242 */
+#include <vector>
+#include "h467.h"
+#include "h9684.h"
+#include "h9908.h"
+#include "h8169.h"
+#include "h4055.h"
+#ifdef X
+#include "h3172.h"
+#endif
+struct S2242 { int a; const char *s = "x//y"; };
+inline int f2242_0(int x) { return x * 0; }
+inline int f2242_1(int x) { return x * 1; }
+inline int f2242_2(int x) { return x * 2; }
+inline int f2242_3(int x) { return x * 3; }
+inline int f2242_4(int x) { return x * 4; }
+inline int f2242_5(int x) { return x * 5; }
+inline int f2242_6(int x) { return x * 6; }
+inline int f2242_7(int x) { return x * 7; }
+inline int f2242_8(int x) { return x * 8; }
+inline int f2242_9(int x) { return x * 9; }
+inline int f2242_10(int x) { return x * 10; }
+inline int f2242_11(int x) { return x * 11; }
+inline int f2242_12(int x) { return x * 12; }
+inline int f2242_13(int x) { return x * 13; }
+inline int f2242_14(int x) { return x * 14; }
+inline int f2242_15(int x) { return x * 15; }
+inline int f2242_16(int x) { return x * 16; }
+inline int f2242_17(int x) { return x * 17; }
+inline int f2242_18(int x) { return x * 18; }
+inline int f2242_19(int x) { return x * 19; }
+inline int f2242_20(int x) { return x * 20; }
+inline int f2242_21(int x) { return x * 21; }
+inline int f2242_22(int x) { return x * 22; }
+inline int f2242_23(int x) { return x * 23; }
+inline int f2242_24(int x) { return x * 24; }
+inline int f2242_25(int x) { return x * 25; }
+inline int f2242_26(int x) { return x * 26; }
+inline int f2242_27(int x) { return x * 27; }
+inline int f2242_28(int x) { return x * 28; }
+inline int f2242_29(int x) { return x * 29; }
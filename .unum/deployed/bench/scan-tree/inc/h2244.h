@@ -0,0 +1,42 @@
+#pragma once
+/* header 2244 */
+#include <vector>
+#include "h5176.h"
+#include "h7334.h"
+#include "h5237.h"
+#include "h2277.h"
+#include "h5561.h"
+#ifdef X
+#include "h4050.h"
+#endif
+struct S2244 { int a; const char *s = "x//y"; };
+inline int f2244_0(int x) { return x * 0; }
+inline int f2244_1(int x) { return x * 1; }
+inline int f2244_2(int x) { return x * 2; }
+inline int f2244_3(int x) { return x * 3; }
+inline int f2244_4(int x) { return x * 4; }
+inline int f2244_5(int x) { return x * 5; }
+inline int f2244_6(int x) { return x * 6; }
+inline int f2244_7(int x) { return x * 7; }
+inline int f2244_8(int x) { return x * 8; }
+inline int f2244_9(int x) { return x * 9; }
+inline int f2244_10(int x) { return x * 10; }
+inline int f2244_11(int x) { return x * 11; }
+inline int f2244_12(int x) { return x * 12; }
+inline int f2244_13(int x) { return x * 13; }
+inline int f2244_14(int x) { return x * 14; }
+inline int f2244_15(int x) { return x * 15; }
+inline int f2244_16(int x) { return x * 16; }
+inline int f2244_17(int x) { return x * 17; }
+inline int f2244_18(int x) { return x * 18; }
+inline int f2244_19(int x) { return x * 19; }
+inline int f2244_20(int x) { return x * 20; }
+inline int f2244_21(int x) { return x * 21; }
+inline int f2244_22(int x) { return x * 22; }
+inline int f2244_23(int x) { return x * 23; }
+inline int f2244_24(int x) { return x * 24; }
+inline int f2244_25(int x) { return x * 25; }
+inline int f2244_26(int x) { return x * 26; }
+inline int f2244_27(int x) { return x * 27; }
+inline int f2244_28(int x) { return x * 28; }
+inline int f2244_29(int x) { return x * 29; }
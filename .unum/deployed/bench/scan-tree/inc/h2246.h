@@ -0,0 +1,42 @@
+#pragma once
+/* header 2246 */
+#include <vector>
+#include "h5157.h"
+#include "h3284.h"
+#include "h9412.h"
+#include "h5056.h"
+#include "h9250.h"
+#ifdef X
+#include "h7746.h"
+#endif
+struct S2246 { int a; const char *s = "x//y"; };
+inline int f2246_0(int x) { return x * 0; }
+inline int f2246_1(int x) { return x * 1; }
+inline int f2246_2(int x) { return x * 2; }
+inline int f2246_3(int x) { return x * 3; }
+inline int f2246_4(int x) { return x * 4; }
+inline int f2246_5(int x) { return x * 5; }
+inline int f2246_6(int x) { return x * 6; }
+inline int f2246_7(int x) { return x * 7; }
+inline int f2246_8(int x) { return x * 8; }
+inline int f2246_9(int x) { return x * 9; }
+inline int f2246_10(int x) { return x * 10; }
+inline int f2246_11(int x) { return x * 11; }
+inline int f2246_12(int x) { return x * 12; }
+inline int f2246_13(int x) { return x * 13; }
+inline int f2246_14(int x) { return x * 14; }
+inline int f2246_15(int x) { return x * 15; }
+inline int f2246_16(int x) { return x * 16; }
+inline int f2246_17(int x) { return x * 17; }
+inline int f2246_18(int x) { return x * 18; }
+inline int f2246_19(int x) { return x * 19; }
+inline int f2246_20(int x) { return x * 20; }
+inline int f2246_21(int x) { return x * 21; }
+inline int f2246_22(int x) { return x * 22; }
+inline int f2246_23(int x) { return x * 23; }
+inline int f2246_24(int x) { return x * 24; }
+inline int f2246_25(int x) { return x * 25; }
+inline int f2246_26(int x) { return x * 26; }
+inline int f2246_27(int x) { return x * 27; }
+inline int f2246_28(int x) { return x * 28; }
+inline int f2246_29(int x) { return x * 29; }
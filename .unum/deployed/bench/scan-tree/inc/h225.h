@@ -0,0 +1,42 @@
+#pragma once
+/* header 225 */
+#include <vector>
+#include "h6128.h"
+#include "h1384.h"
+#include "h3225.h"
+#include "h8044.h"
+#include "h6735.h"
+#ifdef X
+#include "h4659.h"
+#endif
+struct S225 { int a; const char *s = "x//y"; };
+inline int f225_0(int x) { return x * 0; }
+inline int f225_1(int x) { return x * 1; }
+inline int f225_2(int x) { return x * 2; }
+inline int f225_3(int x) { return x * 3; }
+inline int f225_4(int x) { return x * 4; }
+inline int f225_5(int x) { return x * 5; }
+inline int f225_6(int x) { return x * 6; }
+inline int f225_7(int x) { return x * 7; }
+inline int f225_8(int x) { return x * 8; }
+inline int f225_9(int x) { return x * 9; }
+inline int f225_10(int x) { return x * 10; }
+inline int f225_11(int x) { return x * 11; }
+inline int f225_12(int x) { return x * 12; }
+inline int f225_13(int x) { return x * 13; }
+inline int f225_14(int x) { return x * 14; }
+inline int f225_15(int x) { return x * 15; }
+inline int f225_16(int x) { return x * 16; }
+inline int f225_17(int x) { return x * 17; }
+inline int f225_18(int x) { return x * 18; }
+inline int f225_19(int x) { return x * 19; }
+inline int f225_20(int x) { return x * 20; }
+inline int f225_21(int x) { return x * 21; }
+inline int f225_22(int x) { return x * 22; }
+inline int f225_23(int x) { return x * 23; }
+inline int f225_24(int x) { return x * 24; }
+inline int f225_25(int x) { return x * 25; }
+inline int f225_26(int x) { return x * 26; }
+inline int f225_27(int x) { return x * 27; }
+inline int f225_28(int x) { return x * 28; }
+inline int f225_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2252 */
+#include <vector>
+#include "h6841.h"
+#include "h4258.h"
+#include "h750.h"
+#include "h1204.h"
+#include "h1008.h"
+#ifdef X
+#include "h3540.h"
+#endif
+struct S2252 { int a; const char *s = "x//y"; };
+inline int f2252_0(int x) { return x * 0; }
+inline int f2252_1(int x) { return x * 1; }
+inline int f2252_2(int x) { return x * 2; }
+inline int f2252_3(int x) { return x * 3; }
+inline int f2252_4(int x) { return x * 4; }
+inline int f2252_5(int x) { return x * 5; }
+inline int f2252_6(int x) { return x * 6; }
+inline int f2252_7(int x) { return x * 7; }
+inline int f2252_8(int x) { return x * 8; }
+inline int f2252_9(int x) { return x * 9; }
+inline int f2252_10(int x) { return x * 10; }
+inline int f2252_11(int x) { return x * 11; }
+inline int f2252_12(int x) { return x * 12; }
+inline int f2252_13(int x) { return x * 13; }
+inline int f2252_14(int x) { return x * 14; }
+inline int f2252_15(int x) { return x * 15; }
+inline int f2252_16(int x) { return x * 16; }
+inline int f2252_17(int x) { return x * 17; }
+inline int f2252_18(int x) { return x * 18; }
+inline int f2252_19(int x) { return x * 19; }
+inline int f2252_20(int x) { return x * 20; }
+inline int f2252_21(int x) { return x * 21; }
+inline int f2252_22(int x) { return x * 22; }
+inline int f2252_23(int x) { return x * 23; }
+inline int f2252_24(int x) { return x * 24; }
+inline int f2252_25(int x) { return x * 25; }
+inline int f2252_26(int x) { return x * 26; }
+inline int f2252_27(int x) { return x * 27; }
+inline int f2252_28(int x) { return x * 28; }
+inline int f2252_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2253 */
+#include <vector>
+#include "h5613.h"
+#include "h3244.h"
+#include "h322.h"
+#include "h2115.h"
+#include "h2301.h"
+#ifdef X
+#include "h4254.h"
+#endif
+struct S2253 { int a; const char *s = "x//y"; };
+inline int f2253_0(int x) { return x * 0; }
+inline int f2253_1(int x) { return x * 1; }
+inline int f2253_2(int x) { return x * 2; }
+inline int f2253_3(int x) { return x * 3; }
+inline int f2253_4(int x) { return x * 4; }
+inline int f2253_5(int x) { return x * 5; }
+inline int f2253_6(int x) { return x * 6; }
+inline int f2253_7(int x) { return x * 7; }
+inline int f2253_8(int x) { return x * 8; }
+inline int f2253_9(int x) { return x * 9; }
+inline int f2253_10(int x) { return x * 10; }
+inline int f2253_11(int x) { return x * 11; }
+inline int f2253_12(int x) { return x * 12; }
+inline int f2253_13(int x) { return x * 13; }
+inline int f2253_14(int x) { return x * 14; }
+inline int f2253_15(int x) { return x * 15; }
+inline int f2253_16(int x) { return x * 16; }
+inline int f2253_17(int x) { return x * 17; }
+inline int f2253_18(int x) { return x * 18; }
+inline int f2253_19(int x) { return x * 19; }
+inline int f2253_20(int x) { return x * 20; }
+inline int f2253_21(int x) { return x * 21; }
+inline int f2253_22(int x) { return x * 22; }
+inline int f2253_23(int x) { return x * 23; }
+inline int f2253_24(int x) { return x * 24; }
+inline int f2253_25(int x) { return x * 25; }
+inline int f2253_26(int x) { return x * 26; }
+inline int f2253_27(int x) { return x * 27; }
+inline int f2253_28(int x) { return x * 28; }
+inline int f2253_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2256 */
+#include <vector>
+#include "h1397.h"
+#include "h6377.h"
+#include "h973.h"
+#include "h898.h"
+#include "h794.h"
+#ifdef X
+#include "h4307.h"
+#endif
+struct S2256 { int a; const char *s = "x//y"; };
+inline int f2256_0(int x) { return x * 0; }
+inline int f2256_1(int x) { return x * 1; }
+inline int f2256_2(int x) { return x * 2; }
+inline int f2256_3(int x) { return x * 3; }
+inline int f2256_4(int x) { return x * 4; }
+inline int f2256_5(int x) { return x * 5; }
+inline int f2256_6(int x) { return x * 6; }
+inline int f2256_7(int x) { return x * 7; }
+inline int f2256_8(int x) { return x * 8; }
+inline int f2256_9(int x) { return x * 9; }
+inline int f2256_10(int x) { return x * 10; }
+inline int f2256_11(int x) { return x * 11; }
+inline int f2256_12(int x) { return x * 12; }
+inline int f2256_13(int x) { return x * 13; }
+inline int f2256_14(int x) { return x * 14; }
+inline int f2256_15(int x) { return x * 15; }
+inline int f2256_16(int x) { return x * 16; }
+inline int f2256_17(int x) { return x * 17; }
+inline int f2256_18(int x) { return x * 18; }
+inline int f2256_19(int x) { return x * 19; }
+inline int f2256_20(int x) { return x * 20; }
+inline int f2256_21(int x) { return x * 21; }
+inline int f2256_22(int x) { return x * 22; }
+inline int f2256_23(int x) { return x * 23; }
+inline int f2256_24(int x) { return x * 24; }
+inline int f2256_25(int x) { return x * 25; }
+inline int f2256_26(int x) { return x * 26; }
+inline int f2256_27(int x) { return x * 27; }
+inline int f2256_28(int x) { return x * 28; }
+inline int f2256_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2259 */
+#include <vector>
+#include "h4168.h"
+#include "h1757.h"
+#include "h684.h"
+#include "h9962.h"
+#include "h5468.h"
+#ifdef X
+#include "h5101.h"
+#endif
+struct S2259 { int a; const char *s = "x//y"; };
+inline int f2259_0(int x) { return x * 0; }
+inline int f2259_1(int x) { return x * 1; }
+inline int f2259_2(int x) { return x * 2; }
+inline int f2259_3(int x) { return x * 3; }
+inline int f2259_4(int x) { return x * 4; }
+inline int f2259_5(int x) { return x * 5; }
+inline int f2259_6(int x) { return x * 6; }
+inline int f2259_7(int x) { return x * 7; }
+inline int f2259_8(int x) { return x * 8; }
+inline int f2259_9(int x) { return x * 9; }
+inline int f2259_10(int x) { return x * 10; }
+inline int f2259_11(int x) { return x * 11; }
+inline int f2259_12(int x) { return x * 12; }
+inline int f2259_13(int x) { return x * 13; }
+inline int f2259_14(int x) { return x * 14; }
+inline int f2259_15(int x) { return x * 15; }
+inline int f2259_16(int x) { return x * 16; }
+inline int f2259_17(int x) { return x * 17; }
+inline int f2259_18(int x) { return x * 18; }
+inline int f2259_19(int x) { return x * 19; }
+inline int f2259_20(int x) { return x * 20; }
+inline int f2259_21(int x) { return x * 21; }
+inline int f2259_22(int x) { return x * 22; }
+inline int f2259_23(int x) { return x * 23; }
+inline int f2259_24(int x) { return x * 24; }
+inline int f2259_25(int x) { return x * 25; }
+inline int f2259_26(int x) { return x * 26; }
+inline int f2259_27(int x) { return x * 27; }
+inline int f2259_28(int x) { return x * 28; }
+inline int f2259_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 226 */
+#include <vector>
+#include "h4732.h"
+#include "h9397.h"
+#include "h4173.h"
+#include "h3085.h"
+#include "h9055.h"
+#ifdef X
+#include "h3117.h"
+#endif
+struct S226 { int a; const char *s = "x//y"; };
+inline int f226_0(int x) { return x * 0; }
+inline int f226_1(int x) { return x * 1; }
+inline int f226_2(int x) { return x * 2; }
+inline int f226_3(int x) { return x * 3; }
+inline int f226_4(int x) { return x * 4; }
+inline int f226_5(int x) { return x * 5; }
+inline int f226_6(int x) { return x * 6; }
+inline int f226_7(int x) { return x * 7; }
+inline int f226_8(int x) { return x * 8; }
+inline int f226_9(int x) { return x * 9; }
+inline int f226_10(int x) { return x * 10; }
+inline int f226_11(int x) { return x * 11; }
+inline int f226_12(int x) { return x * 12; }
+inline int f226_13(int x) { return x * 13; }
+inline int f226_14(int x) { return x * 14; }
+inline int f226_15(int x) { return x * 15; }
+inline int f226_16(int x) { return x * 16; }
+inline int f226_17(int x) { return x * 17; }
+inline int f226_18(int x) { return x * 18; }
+inline int f226_19(int x) { return x * 19; }
+inline int f226_20(int x) { return x * 20; }
+inline int f226_21(int x) { return x * 21; }
+inline int f226_22(int x) { return x * 22; }
+inline int f226_23(int x) { return x * 23; }
+inline int f226_24(int x) { return x * 24; }
+inline int f226_25(int x) { return x * 25; }
+inline int f226_26(int x) { return x * 26; }
+inline int f226_27(int x) { return x * 27; }
+inline int f226_28(int x) { return x * 28; }
+inline int f226_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2260 */
+#include <vector>
+#include "h1056.h"
+#include "h4077.h"
+#include "h26.h"
+#include "h1736.h"
+#include "h4763.h"
+#ifdef X
+#include "h5542.h"
+#endif
+struct S2260 { int a; const char *s = "x//y"; };
+inline int f2260_0(int x) { return x * 0; }
+inline int f2260_1(int x) { return x * 1; }
+inline int f2260_2(int x) { return x * 2; }
+inline int f2260_3(int x) { return x * 3; }
+inline int f2260_4(int x) { return x * 4; }
+inline int f2260_5(int x) { return x * 5; }
+inline int f2260_6(int x) { return x * 6; }
+inline int f2260_7(int x) { return x * 7; }
+inline int f2260_8(int x) { return x * 8; }
+inline int f2260_9(int x) { return x * 9; }
+inline int f2260_10(int x) { return x * 10; }
+inline int f2260_11(int x) { return x * 11; }
+inline int f2260_12(int x) { return x * 12; }
+inline int f2260_13(int x) { return x * 13; }
+inline int f2260_14(int x) { return x * 14; }
+inline int f2260_15(int x) { return x * 15; }
+inline int f2260_16(int x) { return x * 16; }
+inline int f2260_17(int x) { return x * 17; }
+inline int f2260_18(int x) { return x * 18; }
+inline int f2260_19(int x) { return x * 19; }
+inline int f2260_20(int x) { return x * 20; }
+inline int f2260_21(int x) { return x * 21; }
+inline int f2260_22(int x) { return x * 22; }
+inline int f2260_23(int x) { return x * 23; }
+inline int f2260_24(int x) { return x * 24; }
+inline int f2260_25(int x) { return x * 25; }
+inline int f2260_26(int x) { return x * 26; }
+inline int f2260_27(int x) { return x * 27; }
+inline int f2260_28(int x) { return x * 28; }
+inline int f2260_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2261 */
+#include <vector>
+#include "h4833.h"
+#include "h3681.h"
+#include "h6356.h"
+#include "h3165.h"
+#include "h3005.h"
+#ifdef X
+#include "h8506.h"
+#endif
+struct S2261 { int a; const char *s = "x//y"; };
+inline int f2261_0(int x) { return x * 0; }
+inline int f2261_1(int x) { return x * 1; }
+inline int f2261_2(int x) { return x * 2; }
+inline int f2261_3(int x) { return x * 3; }
+inline int f2261_4(int x) { return x * 4; }
+inline int f2261_5(int x) { return x * 5; }
+inline int f2261_6(int x) { return x * 6; }
+inline int f2261_7(int x) { return x * 7; }
+inline int f2261_8(int x) { return x * 8; }
+inline int f2261_9(int x) { return x * 9; }
+inline int f2261_10(int x) { return x * 10; }
+inline int f2261_11(int x) { return x * 11; }
+inline int f2261_12(int x) { return x * 12; }
+inline int f2261_13(int x) { return x * 13; }
+inline int f2261_14(int x) { return x * 14; }
+inline int f2261_15(int x) { return x * 15; }
+inline int f2261_16(int x) { return x * 16; }
+inline int f2261_17(int x) { return x * 17; }
+inline int f2261_18(int x) { return x * 18; }
+inline int f2261_19(int x) { return x * 19; }
+inline int f2261_20(int x) { return x * 20; }
+inline int f2261_21(int x) { return x * 21; }
+inline int f2261_22(int x) { return x * 22; }
+inline int f2261_23(int x) { return x * 23; }
+inline int f2261_24(int x) { return x * 24; }
+inline int f2261_25(int x) { return x * 25; }
+inline int f2261_26(int x) { return x * 26; }
+inline int f2261_27(int x) { return x * 27; }
+inline int f2261_28(int x) { return x * 28; }
+inline int f2261_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2262 */
+#include <vector>
+#include "h3698.h"
+#include "h4210.h"
+#include "h6560.h"
+#include "h494.h"
+#include "h611.h"
+#ifdef X
+#include "h7311.h"
+#endif
+struct S2262 { int a; const char *s = "x//y"; };
+inline int f2262_0(int x) { return x * 0; }
+inline int f2262_1(int x) { return x * 1; }
+inline int f2262_2(int x) { return x * 2; }
+inline int f2262_3(int x) { return x * 3; }
+inline int f2262_4(int x) { return x * 4; }
+inline int f2262_5(int x) { return x * 5; }
+inline int f2262_6(int x) { return x * 6; }
+inline int f2262_7(int x) { return x * 7; }
+inline int f2262_8(int x) { return x * 8; }
+inline int f2262_9(int x) { return x * 9; }
+inline int f2262_10(int x) { return x * 10; }
+inline int f2262_11(int x) { return x * 11; }
+inline int f2262_12(int x) { return x * 12; }
+inline int f2262_13(int x) { return x * 13; }
+inline int f2262_14(int x) { return x * 14; }
+inline int f2262_15(int x) { return x * 15; }
+inline int f2262_16(int x) { return x * 16; }
+inline int f2262_17(int x) { return x * 17; }
+inline int f2262_18(int x) { return x * 18; }
+inline int f2262_19(int x) { return x * 19; }
+inline int f2262_20(int x) { return x * 20; }
+inline int f2262_21(int x) { return x * 21; }
+inline int f2262_22(int x) { return x * 22; }
+inline int f2262_23(int x) { return x * 23; }
+inline int f2262_24(int x) { return x * 24; }
+inline int f2262_25(int x) { return x * 25; }
+inline int f2262_26(int x) { return x * 26; }
+inline int f2262_27(int x) { return x * 27; }
+inline int f2262_28(int x) { return x * 28; }
+inline int f2262_29(int x) { return x * 29; }
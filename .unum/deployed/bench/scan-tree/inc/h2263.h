@@ -0,0 +1,42 @@
+#pragma once
+/* header 2263 */
+#include <vector>
+#include "h1846.h"
+#include "h1221.h"
+#include "h5032.h"
+#include "h925.h"
+#include "h1490.h"
+#ifdef X
+#include "h2298.h"
+#endif
+struct S2263 { int a; const char *s = "x//y"; };
+inline int f2263_0(int x) { return x * 0; }
+inline int f2263_1(int x) { return x * 1; }
+inline int f2263_2(int x) { return x * 2; }
+inline int f2263_3(int x) { return x * 3; }
+inline int f2263_4(int x) { return x * 4; }
+inline int f2263_5(int x) { return x * 5; }
+inline int f2263_6(int x) { return x * 6; }
+inline int f2263_7(int x) { return x * 7; }
+inline int f2263_8(int x) { return x * 8; }
+inline int f2263_9(int x) { return x * 9; }
+inline int f2263_10(int x) { return x * 10; }
+inline int f2263_11(int x) { return x * 11; }
+inline int f2263_12(int x) { return x * 12; }
+inline int f2263_13(int x) { return x * 13; }
+inline int f2263_14(int x) { return x * 14; }
+inline int f2263_15(int x) { return x * 15; }
+inline int f2263_16(int x) { return x * 16; }
+inline int f2263_17(int x) { return x * 17; }
+inline int f2263_18(int x) { return x * 18; }
+inline int f2263_19(int x) { return x * 19; }
+inline int f2263_20(int x) { return x * 20; }
+inline int f2263_21(int x) { return x * 21; }
+inline int f2263_22(int x) { return x * 22; }
+inline int f2263_23(int x) { return x * 23; }
+inline int f2263_24(int x) { return x * 24; }
+inline int f2263_25(int x) { return x * 25; }
+inline int f2263_26(int x) { return x * 26; }
+inline int f2263_27(int x) { return x * 27; }
+inline int f2263_28(int x) { return x * 28; }
+inline int f2263_29(int x) { return x * 29; }
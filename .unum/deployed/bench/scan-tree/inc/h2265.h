@@ -0,0 +1,42 @@
+#pragma once
+/* header 2265 */
+#include <vector>
+#include "h549.h"
+#include "h6142.h"
+#include "h1613.h"
+#include "h5109.h"
+#include "h2172.h"
+#ifdef X
+#include "h72.h"
+#endif
+struct S2265 { int a; const char *s = "x//y"; };
+inline int f2265_0(int x) { return x * 0; }
+inline int f2265_1(int x) { return x * 1; }
+inline int f2265_2(int x) { return x * 2; }
+inline int f2265_3(int x) { return x * 3; }
+inline int f2265_4(int x) { return x * 4; }
+inline int f2265_5(int x) { return x * 5; }
+inline int f2265_6(int x) { return x * 6; }
+inline int f2265_7(int x) { return x * 7; }
+inline int f2265_8(int x) { return x * 8; }
+inline int f2265_9(int x) { return x * 9; }
+inline int f2265_10(int x) { return x * 10; }
+inline int f2265_11(int x) { return x * 11; }
+inline int f2265_12(int x) { return x * 12; }
+inline int f2265_13(int x) { return x * 13; }
+inline int f2265_14(int x) { return x * 14; }
+inline int f2265_15(int x) { return x * 15; }
+inline int f2265_16(int x) { return x * 16; }
+inline int f2265_17(int x) { return x * 17; }
+inline int f2265_18(int x) { return x * 18; }
+inline int f2265_19(int x) { return x * 19; }
+inline int f2265_20(int x) { return x * 20; }
+inline int f2265_21(int x) { return x * 21; }
+inline int f2265_22(int x) { return x * 22; }
+inline int f2265_23(int x) { return x * 23; }
+inline int f2265_24(int x) { return x * 24; }
+inline int f2265_25(int x) { return x * 25; }
+inline int f2265_26(int x) { return x * 26; }
+inline int f2265_27(int x) { return x * 27; }
+inline int f2265_28(int x) { return x * 28; }
+inline int f2265_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2266 */
+#include <vector>
+#include "h2863.h"
+#include "h1898.h"
+#include "h3451.h"
+#include "h3854.h"
+#include "h4759.h"
+#ifdef X
+#include "h3944.h"
+#endif
+struct S2266 { int a; const char *s = "x//y"; };
+inline int f2266_0(int x) { return x * 0; }
+inline int f2266_1(int x) { return x * 1; }
+inline int f2266_2(int x) { return x * 2; }
+inline int f2266_3(int x) { return x * 3; }
+inline int f2266_4(int x) { return x * 4; }
+inline int f2266_5(int x) { return x * 5; }
+inline int f2266_6(int x) { return x * 6; }
+inline int f2266_7(int x) { return x * 7; }
+inline int f2266_8(int x) { return x * 8; }
+inline int f2266_9(int x) { return x * 9; }
+inline int f2266_10(int x) { return x * 10; }
+inline int f2266_11(int x) { return x * 11; }
+inline int f2266_12(int x) { return x * 12; }
+inline int f2266_13(int x) { return x * 13; }
+inline int f2266_14(int x) { return x * 14; }
+inline int f2266_15(int x) { return x * 15; }
+inline int f2266_16(int x) { return x * 16; }
+inline int f2266_17(int x) { return x * 17; }
+inline int f2266_18(int x) { return x * 18; }
+inline int f2266_19(int x) { return x * 19; }
+inline int f2266_20(int x) { return x * 20; }
+inline int f2266_21(int x) { return x * 21; }
+inline int f2266_22(int x) { return x * 22; }
+inline int f2266_23(int x) { return x * 23; }
+inline int f2266_24(int x) { return x * 24; }
+inline int f2266_25(int x) { return x * 25; }
+inline int f2266_26(int x) { return x * 26; }
+inline int f2266_27(int x) { return x * 27; }
+inline int f2266_28(int x) { return x * 28; }
+inline int f2266_29(int x) { return x * 29; }
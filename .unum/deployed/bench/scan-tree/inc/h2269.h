@@ -0,0 +1,42 @@
+#pragma once
+/* header 2269 */
+#include <vector>
+#include "h7665.h"
+#include "h8587.h"
+#include "h2170.h"
+#include "h7933.h"
+#include "h9383.h"
+#ifdef X
+#include "h4317.h"
+#endif
+struct S2269 { int a; const char *s = "x//y"; };
+inline int f2269_0(int x) { return x * 0; }
+inline int f2269_1(int x) { return x * 1; }
+inline int f2269_2(int x) { return x * 2; }
+inline int f2269_3(int x) { return x * 3; }
+inline int f2269_4(int x) { return x * 4; }
+inline int f2269_5(int x) { return x * 5; }
+inline int f2269_6(int x) { return x * 6; }
+inline int f2269_7(int x) { return x * 7; }
+inline int f2269_8(int x) { return x * 8; }
+inline int f2269_9(int x) { return x * 9; }
+inline int f2269_10(int x) { return x * 10; }
+inline int f2269_11(int x) { return x * 11; }
+inline int f2269_12(int x) { return x * 12; }
+inline int f2269_13(int x) { return x * 13; }
+inline int f2269_14(int x) { return x * 14; }
+inline int f2269_15(int x) { return x * 15; }
+inline int f2269_16(int x) { return x * 16; }
+inline int f2269_17(int x) { return x * 17; }
+inline int f2269_18(int x) { return x * 18; }
+inline int f2269_19(int x) { return x * 19; }
+inline int f2269_20(int x) { return x * 20; }
+inline int f2269_21(int x) { return x * 21; }
+inline int f2269_22(int x) { return x * 22; }
+inline int f2269_23(int x) { return x * 23; }
+inline int f2269_24(int x) { return x * 24; }
+inline int f2269_25(int x) { return x * 25; }
+inline int f2269_26(int x) { return x * 26; }
+inline int f2269_27(int x) { return x * 27; }
+inline int f2269_28(int x) { return x * 28; }
+inline int f2269_29(int x) { return x * 29; }
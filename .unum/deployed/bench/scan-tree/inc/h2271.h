@@ -0,0 +1,42 @@
+#pragma once
+/* header 2271 */
+#include <vector>
+#include "h3301.h"
+#include "h562.h"
+#include "h3643.h"
+#include "h8761.h"
+#include "h3512.h"
+#ifdef X
+#include "h4797.h"
+#endif
+struct S2271 { int a; const char *s = "x//y"; };
+inline int f2271_0(int x) { return x * 0; }
+inline int f2271_1(int x) { return x * 1; }
+inline int f2271_2(int x) { return x * 2; }
+inline int f2271_3(int x) { return x * 3; }
+inline int f2271_4(int x) { return x * 4; }
+inline int f2271_5(int x) { return x * 5; }
+inline int f2271_6(int x) { return x * 6; }
+inline int f2271_7(int x) { return x * 7; }
+inline int f2271_8(int x) { return x * 8; }
+inline int f2271_9(int x) { return x * 9; }
+inline int f2271_10(int x) { return x * 10; }
+inline int f2271_11(int x) { return x * 11; }
+inline int f2271_12(int x) { return x * 12; }
+inline int f2271_13(int x) { return x * 13; }
+inline int f2271_14(int x) { return x * 14; }
+inline int f2271_15(int x) { return x * 15; }
+inline int f2271_16(int x) { return x * 16; }
+inline int f2271_17(int x) { return x * 17; }
+inline int f2271_18(int x) { return x * 18; }
+inline int f2271_19(int x) { return x * 19; }
+inline int f2271_20(int x) { return x * 20; }
+inline int f2271_21(int x) { return x * 21; }
+inline int f2271_22(int x) { return x * 22; }
+inline int f2271_23(int x) { return x * 23; }
+inline int f2271_24(int x) { return x * 24; }
+inline int f2271_25(int x) { return x * 25; }
+inline int f2271_26(int x) { return x * 26; }
+inline int f2271_27(int x) { return x * 27; }
+inline int f2271_28(int x) { return x * 28; }
+inline int f2271_29(int x) { return x * 29; }
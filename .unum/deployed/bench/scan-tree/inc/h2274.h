@@ -0,0 +1,42 @@
+#pragma once
+/* header 2274 */
+#include <vector>
+#include "h5256.h"
+#include "h1959.h"
+#include "h2911.h"
+#include "h8998.h"
+#include "h3252.h"
+#ifdef X
+#include "h2973.h"
+#endif
+struct S2274 { int a; const char *s = "x//y"; };
+inline int f2274_0(int x) { return x * 0; }
+inline int f2274_1(int x) { return x * 1; }
+inline int f2274_2(int x) { return x * 2; }
+inline int f2274_3(int x) { return x * 3; }
+inline int f2274_4(int x) { return x * 4; }
+inline int f2274_5(int x) { return x * 5; }
+inline int f2274_6(int x) { return x * 6; }
+inline int f2274_7(int x) { return x * 7; }
+inline int f2274_8(int x) { return x * 8; }
+inline int f2274_9(int x) { return x * 9; }
+inline int f2274_10(int x) { return x * 10; }
+inline int f2274_11(int x) { return x * 11; }
+inline int f2274_12(int x) { return x * 12; }
+inline int f2274_13(int x) { return x * 13; }
+inline int f2274_14(int x) { return x * 14; }
+inline int f2274_15(int x) { return x * 15; }
+inline int f2274_16(int x) { return x * 16; }
+inline int f2274_17(int x) { return x * 17; }
+inline int f2274_18(int x) { return x * 18; }
+inline int f2274_19(int x) { return x * 19; }
+inline int f2274_20(int x) { return x * 20; }
+inline int f2274_21(int x) { return x * 21; }
+inline int f2274_22(int x) { return x * 22; }
+inline int f2274_23(int x) { return x * 23; }
+inline int f2274_24(int x) { return x * 24; }
+inline int f2274_25(int x) { return x * 25; }
+inline int f2274_26(int x) { return x * 26; }
+inline int f2274_27(int x) { return x * 27; }
+inline int f2274_28(int x) { return x * 28; }
+inline int f2274_29(int x) { return x * 29; }
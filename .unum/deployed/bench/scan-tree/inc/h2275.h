@@ -0,0 +1,42 @@
+#pragma once
+/* header 2275 */
+#include <vector>
+#include "h2836.h"
+#include "h3317.h"
+#include "h4386.h"
+#include "h8699.h"
+#include "h1697.h"
+#ifdef X
+#include "h7926.h"
+#endif
+struct S2275 { int a; const char *s = "x//y"; };
+inline int f2275_0(int x) { return x * 0; }
+inline int f2275_1(int x) { return x * 1; }
+inline int f2275_2(int x) { return x * 2; }
+inline int f2275_3(int x) { return x * 3; }
+inline int f2275_4(int x) { return x * 4; }
+inline int f2275_5(int x) { return x * 5; }
+inline int f2275_6(int x) { return x * 6; }
+inline int f2275_7(int x) { return x * 7; }
+inline int f2275_8(int x) { return x * 8; }
+inline int f2275_9(int x) { return x * 9; }
+inline int f2275_10(int x) { return x * 10; }
+inline int f2275_11(int x) { return x * 11; }
+inline int f2275_12(int x) { return x * 12; }
+inline int f2275_13(int x) { return x * 13; }
+inline int f2275_14(int x) { return x * 14; }
+inline int f2275_15(int x) { return x * 15; }
+inline int f2275_16(int x) { return x * 16; }
+inline int f2275_17(int x) { return x * 17; }
+inline int f2275_18(int x) { return x * 18; }
+inline int f2275_19(int x) { return x * 19; }
+inline int f2275_20(int x) { return x * 20; }
+inline int f2275_21(int x) { return x * 21; }
+inline int f2275_22(int x) { return x * 22; }
+inline int f2275_23(int x) { return x * 23; }
+inline int f2275_24(int x) { return x * 24; }
+inline int f2275_25(int x) { return x * 25; }
+inline int f2275_26(int x) { return x * 26; }
+inline int f2275_27(int x) { return x * 27; }
+inline int f2275_28(int x) { return x * 28; }
+inline int f2275_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2276 */
+#include <vector>
+#include "h8348.h"
+#include "h9400.h"
+#include "h1422.h"
+#include "h8605.h"
+#include "h9912.h"
+#ifdef X
+#include "h5851.h"
+#endif
+struct S2276 { int a; const char *s = "x//y"; };
+inline int f2276_0(int x) { return x * 0; }
+inline int f2276_1(int x) { return x * 1; }
+inline int f2276_2(int x) { return x * 2; }
+inline int f2276_3(int x) { return x * 3; }
+inline int f2276_4(int x) { return x * 4; }
+inline int f2276_5(int x) { return x * 5; }
+inline int f2276_6(int x) { return x * 6; }
+inline int f2276_7(int x) { return x * 7; }
+inline int f2276_8(int x) { return x * 8; }
+inline int f2276_9(int x) { return x * 9; }
+inline int f2276_10(int x) { return x * 10; }
+inline int f2276_11(int x) { return x * 11; }
+inline int f2276_12(int x) { return x * 12; }
+inline int f2276_13(int x) { return x * 13; }
+inline int f2276_14(int x) { return x * 14; }
+inline int f2276_15(int x) { return x * 15; }
+inline int f2276_16(int x) { return x * 16; }
+inline int f2276_17(int x) { return x * 17; }
+inline int f2276_18(int x) { return x * 18; }
+inline int f2276_19(int x) { return x * 19; }
+inline int f2276_20(int x) { return x * 20; }
+inline int f2276_21(int x) { return x * 21; }
+inline int f2276_22(int x) { return x * 22; }
+inline int f2276_23(int x) { return x * 23; }
+inline int f2276_24(int x) { return x * 24; }
+inline int f2276_25(int x) { return x * 25; }
+inline int f2276_26(int x) { return x * 26; }
+inline int f2276_27(int x) { return x * 27; }
+inline int f2276_28(int x) { return x * 28; }
+inline int f2276_29(int x) { return x * 29; }
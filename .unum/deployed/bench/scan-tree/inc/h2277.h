@@ -0,0 +1,42 @@
+#pragma once
+/* header 2277 */
+#include <vector>
+#include "h3713.h"
+#include "h9271.h"
+#include "h3802.h"
+#include "h4629.h"
+#include "h8824.h"
+#ifdef X
+#include "h2110.h"
+#endif
+struct S2277 { int a; const char *s = "x//y"; };
+inline int f2277_0(int x) { return x * 0; }
+inline int f2277_1(int x) { return x * 1; }
+inline int f2277_2(int x) { return x * 2; }
+inline int f2277_3(int x) { return x * 3; }
+inline int f2277_4(int x) { return x * 4; }
+inline int f2277_5(int x) { return x * 5; }
+inline int f2277_6(int x) { return x * 6; }
+inline int f2277_7(int x) { return x * 7; }
+inline int f2277_8(int x) { return x * 8; }
+inline int f2277_9(int x) { return x * 9; }
+inline int f2277_10(int x) { return x * 10; }
+inline int f2277_11(int x) { return x * 11; }
+inline int f2277_12(int x) { return x * 12; }
+inline int f2277_13(int x) { return x * 13; }
+inline int f2277_14(int x) { return x * 14; }
+inline int f2277_15(int x) { return x * 15; }
+inline int f2277_16(int x) { return x * 16; }
+inline int f2277_17(int x) { return x * 17; }
+inline int f2277_18(int x) { return x * 18; }
+inline int f2277_19(int x) { return x * 19; }
+inline int f2277_20(int x) { return x * 20; }
+inline int f2277_21(int x) { return x * 21; }
+inline int f2277_22(int x) { return x * 22; }
+inline int f2277_23(int x) { return x * 23; }
+inline int f2277_24(int x) { return x * 24; }
+inline int f2277_25(int x) { return x * 25; }
+inline int f2277_26(int x) { return x * 26; }
+inline int f2277_27(int x) { return x * 27; }
+inline int f2277_28(int x) { return x * 28; }
+inline int f2277_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2279 */
+#include <vector>
+#include "h8431.h"
+#include "h6666.h"
+#include "h2638.h"
+#include "h9147.h"
+#include "h7083.h"
+#ifdef X
+#include "h556.h"
+#endif
+struct S2279 { int a; const char *s = "x//y"; };
+inline int f2279_0(int x) { return x * 0; }
+inline int f2279_1(int x) { return x * 1; }
+inline int f2279_2(int x) { return x * 2; }
+inline int f2279_3(int x) { return x * 3; }
+inline int f2279_4(int x) { return x * 4; }
+inline int f2279_5(int x) { return x * 5; }
+inline int f2279_6(int x) { return x * 6; }
+inline int f2279_7(int x) { return x * 7; }
+inline int f2279_8(int x) { return x * 8; }
+inline int f2279_9(int x) { return x * 9; }
+inline int f2279_10(int x) { return x * 10; }
+inline int f2279_11(int x) { return x * 11; }
+inline int f2279_12(int x) { return x * 12; }
+inline int f2279_13(int x) { return x * 13; }
+inline int f2279_14(int x) { return x * 14; }
+inline int f2279_15(int x) { return x * 15; }
+inline int f2279_16(int x) { return x * 16; }
+inline int f2279_17(int x) { return x * 17; }
+inline int f2279_18(int x) { return x * 18; }
+inline int f2279_19(int x) { return x * 19; }
+inline int f2279_20(int x) { return x * 20; }
+inline int f2279_21(int x) { return x * 21; }
+inline int f2279_22(int x) { return x * 22; }
+inline int f2279_23(int x) { return x * 23; }
+inline int f2279_24(int x) { return x * 24; }
+inline int f2279_25(int x) { return x * 25; }
+inline int f2279_26(int x) { return x * 26; }
+inline int f2279_27(int x) { return x * 27; }
+inline int f2279_28(int x) { return x * 28; }
+inline int f2279_29(int x) { return x * 29; }
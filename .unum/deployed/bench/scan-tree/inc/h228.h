@@ -0,0 +1,42 @@
+#pragma once
+/* header 228 */
+#include <vector>
+#include "h9837.h"
+#include "h468.h"
+#include "h4233.h"
+#include "h9679.h"
+#include "h3021.h"
+#ifdef X
+#include "h8925.h"
+#endif
+struct S228 { int a; const char *s = "x//y"; };
+inline int f228_0(int x) { return x * 0; }
+inline int f228_1(int x) { return x * 1; }
+inline int f228_2(int x) { return x * 2; }
+inline int f228_3(int x) { return x * 3; }
+inline int f228_4(int x) { return x * 4; }
+inline int f228_5(int x) { return x * 5; }
+inline int f228_6(int x) { return x * 6; }
+inline int f228_7(int x) { return x * 7; }
+inline int f228_8(int x) { return x * 8; }
+inline int f228_9(int x) { return x * 9; }
+inline int f228_10(int x) { return x * 10; }
+inline int f228_11(int x) { return x * 11; }
+inline int f228_12(int x) { return x * 12; }
+inline int f228_13(int x) { return x * 13; }
+inline int f228_14(int x) { return x * 14; }
+inline int f228_15(int x) { return x * 15; }
+inline int f228_16(int x) { return x * 16; }
+inline int f228_17(int x) { return x * 17; }
+inline int f228_18(int x) { return x * 18; }
+inline int f228_19(int x) { return x * 19; }
+inline int f228_20(int x) { return x * 20; }
+inline int f228_21(int x) { return x * 21; }
+inline int f228_22(int x) { return x * 22; }
+inline int f228_23(int x) { return x * 23; }
+inline int f228_24(int x) { return x * 24; }
+inline int f228_25(int x) { return x * 25; }
+inline int f228_26(int x) { return x * 26; }
+inline int f228_27(int x) { return x * 27; }
+inline int f228_28(int x) { return x * 28; }
+inline int f228_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2280 */
+#include <vector>
+#include "h4582.h"
+#include "h6995.h"
+#include "h398.h"
+#include "h2814.h"
+#include "h7629.h"
+#ifdef X
+#include "h5246.h"
+#endif
+struct S2280 { int a; const char *s = "x//y"; };
+inline int f2280_0(int x) { return x * 0; }
+inline int f2280_1(int x) { return x * 1; }
+inline int f2280_2(int x) { return x * 2; }
+inline int f2280_3(int x) { return x * 3; }
+inline int f2280_4(int x) { return x * 4; }
+inline int f2280_5(int x) { return x * 5; }
+inline int f2280_6(int x) { return x * 6; }
+inline int f2280_7(int x) { return x * 7; }
+inline int f2280_8(int x) { return x * 8; }
+inline int f2280_9(int x) { return x * 9; }
+inline int f2280_10(int x) { return x * 10; }
+inline int f2280_11(int x) { return x * 11; }
+inline int f2280_12(int x) { return x * 12; }
+inline int f2280_13(int x) { return x * 13; }
+inline int f2280_14(int x) { return x * 14; }
+inline int f2280_15(int x) { return x * 15; }
+inline int f2280_16(int x) { return x * 16; }
+inline int f2280_17(int x) { return x * 17; }
+inline int f2280_18(int x) { return x * 18; }
+inline int f2280_19(int x) { return x * 19; }
+inline int f2280_20(int x) { return x * 20; }
+inline int f2280_21(int x) { return x * 21; }
+inline int f2280_22(int x) { return x * 22; }
+inline int f2280_23(int x) { return x * 23; }
+inline int f2280_24(int x) { return x * 24; }
+inline int f2280_25(int x) { return x * 25; }
+inline int f2280_26(int x) { return x * 26; }
+inline int f2280_27(int x) { return x * 27; }
+inline int f2280_28(int x) { return x * 28; }
+inline int f2280_29(int x) { return x * 29; }
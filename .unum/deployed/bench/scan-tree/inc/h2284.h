@@ -0,0 +1,42 @@
+#pragma once
+/* header 2284 */
+#include <vector>
+#include "h4715.h"
+#include "h6587.h"
+#include "h2533.h"
+#include "h8234.h"
+#include "h1810.h"
+#ifdef X
+#include "h3095.h"
+#endif
+struct S2284 { int a; const char *s = "x//y"; };
+inline int f2284_0(int x) { return x * 0; }
+inline int f2284_1(int x) { return x * 1; }
+inline int f2284_2(int x) { return x * 2; }
+inline int f2284_3(int x) { return x * 3; }
+inline int f2284_4(int x) { return x * 4; }
+inline int f2284_5(int x) { return x * 5; }
+inline int f2284_6(int x) { return x * 6; }
+inline int f2284_7(int x) { return x * 7; }
+inline int f2284_8(int x) { return x * 8; }
+inline int f2284_9(int x) { return x * 9; }
+inline int f2284_10(int x) { return x * 10; }
+inline int f2284_11(int x) { return x * 11; }
+inline int f2284_12(int x) { return x * 12; }
+inline int f2284_13(int x) { return x * 13; }
+inline int f2284_14(int x) { return x * 14; }
+inline int f2284_15(int x) { return x * 15; }
+inline int f2284_16(int x) { return x * 16; }
+inline int f2284_17(int x) { return x * 17; }
+inline int f2284_18(int x) { return x * 18; }
+inline int f2284_19(int x) { return x * 19; }
+inline int f2284_20(int x) { return x * 20; }
+inline int f2284_21(int x) { return x * 21; }
+inline int f2284_22(int x) { return x * 22; }
+inline int f2284_23(int x) { return x * 23; }
+inline int f2284_24(int x) { return x * 24; }
+inline int f2284_25(int x) { return x * 25; }
+inline int f2284_26(int x) { return x * 26; }
+inline int f2284_27(int x) { return x * 27; }
+inline int f2284_28(int x) { return x * 28; }
+inline int f2284_29(int x) { return x * 29; }
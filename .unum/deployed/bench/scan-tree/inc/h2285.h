@@ -0,0 +1,42 @@
+#pragma once
+/* header 2285 */
+#include <vector>
+#include "h9932.h"
+#include "h3478.h"
+#include "h464.h"
+#include "h7223.h"
+#include "h2989.h"
+#ifdef X
+#include "h5303.h"
+#endif
+struct S2285 { int a; const char *s = "x//y"; };
+inline int f2285_0(int x) { return x * 0; }
+inline int f2285_1(int x) { return x * 1; }
+inline int f2285_2(int x) { return x * 2; }
+inline int f2285_3(int x) { return x * 3; }
+inline int f2285_4(int x) { return x * 4; }
+inline int f2285_5(int x) { return x * 5; }
+inline int f2285_6(int x) { return x * 6; }
+inline int f2285_7(int x) { return x * 7; }
+inline int f2285_8(int x) { return x * 8; }
+inline int f2285_9(int x) { return x * 9; }
+inline int f2285_10(int x) { return x * 10; }
+inline int f2285_11(int x) { return x * 11; }
+inline int f2285_12(int x) { return x * 12; }
+inline int f2285_13(int x) { return x * 13; }
+inline int f2285_14(int x) { return x * 14; }
+inline int f2285_15(int x) { return x * 15; }
+inline int f2285_16(int x) { return x * 16; }
+inline int f2285_17(int x) { return x * 17; }
+inline int f2285_18(int x) { return x * 18; }
+inline int f2285_19(int x) { return x * 19; }
+inline int f2285_20(int x) { return x * 20; }
+inline int f2285_21(int x) { return x * 21; }
+inline int f2285_22(int x) { return x * 22; }
+inline int f2285_23(int x) { return x * 23; }
+inline int f2285_24(int x) { return x * 24; }
+inline int f2285_25(int x) { return x * 25; }
+inline int f2285_26(int x) { return x * 26; }
+inline int f2285_27(int x) { return x * 27; }
+inline int f2285_28(int x) { return x * 28; }
+inline int f2285_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2289 */
+#include <vector>
+#include "h6663.h"
+#include "h8356.h"
+#include "h8569.h"
+#include "h5096.h"
+#include "h8563.h"
+#ifdef X
+#include "h8802.h"
+#endif
+struct S2289 { int a; const char *s = "x//y"; };
+inline int f2289_0(int x) { return x * 0; }
+inline int f2289_1(int x) { return x * 1; }
+inline int f2289_2(int x) { return x * 2; }
+inline int f2289_3(int x) { return x * 3; }
+inline int f2289_4(int x) { return x * 4; }
+inline int f2289_5(int x) { return x * 5; }
+inline int f2289_6(int x) { return x * 6; }
+inline int f2289_7(int x) { return x * 7; }
+inline int f2289_8(int x) { return x * 8; }
+inline int f2289_9(int x) { return x * 9; }
+inline int f2289_10(int x) { return x * 10; }
+inline int f2289_11(int x) { return x * 11; }
+inline int f2289_12(int x) { return x * 12; }
+inline int f2289_13(int x) { return x * 13; }
+inline int f2289_14(int x) { return x * 14; }
+inline int f2289_15(int x) { return x * 15; }
+inline int f2289_16(int x) { return x * 16; }
+inline int f2289_17(int x) { return x * 17; }
+inline int f2289_18(int x) { return x * 18; }
+inline int f2289_19(int x) { return x * 19; }
+inline int f2289_20(int x) { return x * 20; }
+inline int f2289_21(int x) { return x * 21; }
+inline int f2289_22(int x) { return x * 22; }
+inline int f2289_23(int x) { return x * 23; }
+inline int f2289_24(int x) { return x * 24; }
+inline int f2289_25(int x) { return x * 25; }
+inline int f2289_26(int x) { return x * 26; }
+inline int f2289_27(int x) { return x * 27; }
+inline int f2289_28(int x) { return x * 28; }
+inline int f2289_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 229 */
+#include <vector>
+#include "h4106.h"
+#include "h2830.h"
+#include "h5741.h"
+#include "h3476.h"
+#include "h3802.h"
+#ifdef X
+#include "h3810.h"
+#endif
+struct S229 { int a; const char *s = "x//y"; };
+inline int f229_0(int x) { return x * 0; }
+inline int f229_1(int x) { return x * 1; }
+inline int f229_2(int x) { return x * 2; }
+inline int f229_3(int x) { return x * 3; }
+inline int f229_4(int x) { return x * 4; }
+inline int f229_5(int x) { return x * 5; }
+inline int f229_6(int x) { return x * 6; }
+inline int f229_7(int x) { return x * 7; }
+inline int f229_8(int x) { return x * 8; }
+inline int f229_9(int x) { return x * 9; }
+inline int f229_10(int x) { return x * 10; }
+inline int f229_11(int x) { return x * 11; }
+inline int f229_12(int x) { return x * 12; }
+inline int f229_13(int x) { return x * 13; }
+inline int f229_14(int x) { return x * 14; }
+inline int f229_15(int x) { return x * 15; }
+inline int f229_16(int x) { return x * 16; }
+inline int f229_17(int x) { return x * 17; }
+inline int f229_18(int x) { return x * 18; }
+inline int f229_19(int x) { return x * 19; }
+inline int f229_20(int x) { return x * 20; }
+inline int f229_21(int x) { return x * 21; }
+inline int f229_22(int x) { return x * 22; }
+inline int f229_23(int x) { return x * 23; }
+inline int f229_24(int x) { return x * 24; }
+inline int f229_25(int x) { return x * 25; }
+inline int f229_26(int x) { return x * 26; }
+inline int f229_27(int x) { return x * 27; }
+inline int f229_28(int x) { return x * 28; }
+inline int f229_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2290 */
+#include <vector>
+#include "h7149.h"
+#include "h921.h"
+#include "h476.h"
+#include "h5169.h"
+#include "h5474.h"
+#ifdef X
+#include "h5639.h"
+#endif
+struct S2290 { int a; const char *s = "x//y"; };
+inline int f2290_0(int x) { return x * 0; }
+inline int f2290_1(int x) { return x * 1; }
+inline int f2290_2(int x) { return x * 2; }
+inline int f2290_3(int x) { return x * 3; }
+inline int f2290_4(int x) { return x * 4; }
+inline int f2290_5(int x) { return x * 5; }
+inline int f2290_6(int x) { return x * 6; }
+inline int f2290_7(int x) { return x * 7; }
+inline int f2290_8(int x) { return x * 8; }
+inline int f2290_9(int x) { return x * 9; }
+inline int f2290_10(int x) { return x * 10; }
+inline int f2290_11(int x) { return x * 11; }
+inline int f2290_12(int x) { return x * 12; }
+inline int f2290_13(int x) { return x * 13; }
+inline int f2290_14(int x) { return x * 14; }
+inline int f2290_15(int x) { return x * 15; }
+inline int f2290_16(int x) { return x * 16; }
+inline int f2290_17(int x) { return x * 17; }
+inline int f2290_18(int x) { return x * 18; }
+inline int f2290_19(int x) { return x * 19; }
+inline int f2290_20(int x) { return x * 20; }
+inline int f2290_21(int x) { return x * 21; }
+inline int f2290_22(int x) { return x * 22; }
+inline int f2290_23(int x) { return x * 23; }
+inline int f2290_24(int x) { return x * 24; }
+inline int f2290_25(int x) { return x * 25; }
+inline int f2290_26(int x) { return x * 26; }
+inline int f2290_27(int x) { return x * 27; }
+inline int f2290_28(int x) { return x * 28; }
+inline int f2290_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2292 */
+#include <vector>
+#include "h8405.h"
+#include "h2406.h"
+#include "h475.h"
+#include "h1855.h"
+#include "h4144.h"
+#ifdef X
+#include "h8323.h"
+#endif
+struct S2292 { int a; const char *s = "x//y"; };
+inline int f2292_0(int x) { return x * 0; }
+inline int f2292_1(int x) { return x * 1; }
+inline int f2292_2(int x) { return x * 2; }
+inline int f2292_3(int x) { return x * 3; }
+inline int f2292_4(int x) { return x * 4; }
+inline int f2292_5(int x) { return x * 5; }
+inline int f2292_6(int x) { return x * 6; }
+inline int f2292_7(int x) { return x * 7; }
+inline int f2292_8(int x) { return x * 8; }
+inline int f2292_9(int x) { return x * 9; }
+inline int f2292_10(int x) { return x * 10; }
+inline int f2292_11(int x) { return x * 11; }
+inline int f2292_12(int x) { return x * 12; }
+inline int f2292_13(int x) { return x * 13; }
+inline int f2292_14(int x) { return x * 14; }
+inline int f2292_15(int x) { return x * 15; }
+inline int f2292_16(int x) { return x * 16; }
+inline int f2292_17(int x) { return x * 17; }
+inline int f2292_18(int x) { return x * 18; }
+inline int f2292_19(int x) { return x * 19; }
+inline int f2292_20(int x) { return x * 20; }
+inline int f2292_21(int x) { return x * 21; }
+inline int f2292_22(int x) { return x * 22; }
+inline int f2292_23(int x) { return x * 23; }
+inline int f2292_24(int x) { return x * 24; }
+inline int f2292_25(int x) { return x * 25; }
+inline int f2292_26(int x) { return x * 26; }
+inline int f2292_27(int x) { return x * 27; }
+inline int f2292_28(int x) { return x * 28; }
+inline int f2292_29(int x) { return x * 29; }
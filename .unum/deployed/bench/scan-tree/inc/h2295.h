@@ -0,0 +1,42 @@
+#pragma once
+/* header 2295 */
+#include <vector>
+#include "h3530.h"
+#include "h6828.h"
+#include "h7716.h"
+#include "h1280.h"
+#include "h7751.h"
+#ifdef X
+#include "h804.h"
+#endif
+struct S2295 { int a; const char *s = "x//y"; };
+inline int f2295_0(int x) { return x * 0; }
+inline int f2295_1(int x) { return x * 1; }
+inline int f2295_2(int x) { return x * 2; }
+inline int f2295_3(int x) { return x * 3; }
+inline int f2295_4(int x) { return x * 4; }
+inline int f2295_5(int x) { return x * 5; }
+inline int f2295_6(int x) { return x * 6; }
+inline int f2295_7(int x) { return x * 7; }
+inline int f2295_8(int x) { return x * 8; }
+inline int f2295_9(int x) { return x * 9; }
+inline int f2295_10(int x) { return x * 10; }
+inline int f2295_11(int x) { return x * 11; }
+inline int f2295_12(int x) { return x * 12; }
+inline int f2295_13(int x) { return x * 13; }
+inline int f2295_14(int x) { return x * 14; }
+inline int f2295_15(int x) { return x * 15; }
+inline int f2295_16(int x) { return x * 16; }
+inline int f2295_17(int x) { return x * 17; }
+inline int f2295_18(int x) { return x * 18; }
+inline int f2295_19(int x) { return x * 19; }
+inline int f2295_20(int x) { return x * 20; }
+inline int f2295_21(int x) { return x * 21; }
+inline int f2295_22(int x) { return x * 22; }
+inline int f2295_23(int x) { return x * 23; }
+inline int f2295_24(int x) { return x * 24; }
+inline int f2295_25(int x) { return x * 25; }
+inline int f2295_26(int x) { return x * 26; }
+inline int f2295_27(int x) { return x * 27; }
+inline int f2295_28(int x) { return x * 28; }
+inline int f2295_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2296 */
+#include <vector>
+#include "h8680.h"
+#include "h9804.h"
+#include "h3105.h"
+#include "h5907.h"
+#include "h360.h"
+#ifdef X
+#include "h7701.h"
+#endif
+struct S2296 { int a; const char *s = "x//y"; };
+inline int f2296_0(int x) { return x * 0; }
+inline int f2296_1(int x) { return x * 1; }
+inline int f2296_2(int x) { return x * 2; }
+inline int f2296_3(int x) { return x * 3; }
+inline int f2296_4(int x) { return x * 4; }
+inline int f2296_5(int x) { return x * 5; }
+inline int f2296_6(int x) { return x * 6; }
+inline int f2296_7(int x) { return x * 7; }
+inline int f2296_8(int x) { return x * 8; }
+inline int f2296_9(int x) { return x * 9; }
+inline int f2296_10(int x) { return x * 10; }
+inline int f2296_11(int x) { return x * 11; }
+inline int f2296_12(int x) { return x * 12; }
+inline int f2296_13(int x) { return x * 13; }
+inline int f2296_14(int x) { return x * 14; }
+inline int f2296_15(int x) { return x * 15; }
+inline int f2296_16(int x) { return x * 16; }
+inline int f2296_17(int x) { return x * 17; }
+inline int f2296_18(int x) { return x * 18; }
+inline int f2296_19(int x) { return x * 19; }
+inline int f2296_20(int x) { return x * 20; }
+inline int f2296_21(int x) { return x * 21; }
+inline int f2296_22(int x) { return x * 22; }
+inline int f2296_23(int x) { return x * 23; }
+inline int f2296_24(int x) { return x * 24; }
+inline int f2296_25(int x) { return x * 25; }
+inline int f2296_26(int x) { return x * 26; }
+inline int f2296_27(int x) { return x * 27; }
+inline int f2296_28(int x) { return x * 28; }
+inline int f2296_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2297 */
+#include <vector>
+#include "h9560.h"
+#include "h4389.h"
+#include "h4835.h"
+#include "h1130.h"
+#include "h823.h"
+#ifdef X
+#include "h7896.h"
+#endif
+struct S2297 { int a; const char *s = "x//y"; };
+inline int f2297_0(int x) { return x * 0; }
+inline int f2297_1(int x) { return x * 1; }
+inline int f2297_2(int x) { return x * 2; }
+inline int f2297_3(int x) { return x * 3; }
+inline int f2297_4(int x) { return x * 4; }
+inline int f2297_5(int x) { return x * 5; }
+inline int f2297_6(int x) { return x * 6; }
+inline int f2297_7(int x) { return x * 7; }
+inline int f2297_8(int x) { return x * 8; }
+inline int f2297_9(int x) { return x * 9; }
+inline int f2297_10(int x) { return x * 10; }
+inline int f2297_11(int x) { return x * 11; }
+inline int f2297_12(int x) { return x * 12; }
+inline int f2297_13(int x) { return x * 13; }
+inline int f2297_14(int x) { return x * 14; }
+inline int f2297_15(int x) { return x * 15; }
+inline int f2297_16(int x) { return x * 16; }
+inline int f2297_17(int x) { return x * 17; }
+inline int f2297_18(int x) { return x * 18; }
+inline int f2297_19(int x) { return x * 19; }
+inline int f2297_20(int x) { return x * 20; }
+inline int f2297_21(int x) { return x * 21; }
+inline int f2297_22(int x) { return x * 22; }
+inline int f2297_23(int x) { return x * 23; }
+inline int f2297_24(int x) { return x * 24; }
+inline int f2297_25(int x) { return x * 25; }
+inline int f2297_26(int x) { return x * 26; }
+inline int f2297_27(int x) { return x * 27; }
+inline int f2297_28(int x) { return x * 28; }
+inline int f2297_29(int x) { return x * 29; }
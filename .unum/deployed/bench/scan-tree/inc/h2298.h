@@ -0,0 +1,42 @@
+#pragma once
+/* header 2298 */
+#include <vector>
+#include "h3125.h"
+#include "h4016.h"
+#include "h5987.h"
+#include "h3230.h"
+#include "h1891.h"
+#ifdef X
+#include "h2598.h"
+#endif
+struct S2298 { int a; const char *s = "x//y"; };
+inline int f2298_0(int x) { return x * 0; }
+inline int f2298_1(int x) { return x * 1; }
+inline int f2298_2(int x) { return x * 2; }
+inline int f2298_3(int x) { return x * 3; }
+inline int f2298_4(int x) { return x * 4; }
+inline int f2298_5(int x) { return x * 5; }
+inline int f2298_6(int x) { return x * 6; }
+inline int f2298_7(int x) { return x * 7; }
+inline int f2298_8(int x) { return x * 8; }
+inline int f2298_9(int x) { return x * 9; }
+inline int f2298_10(int x) { return x * 10; }
+inline int f2298_11(int x) { return x * 11; }
+inline int f2298_12(int x) { return x * 12; }
+inline int f2298_13(int x) { return x * 13; }
+inline int f2298_14(int x) { return x * 14; }
+inline int f2298_15(int x) { return x * 15; }
+inline int f2298_16(int x) { return x * 16; }
+inline int f2298_17(int x) { return x * 17; }
+inline int f2298_18(int x) { return x * 18; }
+inline int f2298_19(int x) { return x * 19; }
+inline int f2298_20(int x) { return x * 20; }
+inline int f2298_21(int x) { return x * 21; }
+inline int f2298_22(int x) { return x * 22; }
+inline int f2298_23(int x) { return x * 23; }
+inline int f2298_24(int x) { return x * 24; }
+inline int f2298_25(int x) { return x * 25; }
+inline int f2298_26(int x) { return x * 26; }
+inline int f2298_27(int x) { return x * 27; }
+inline int f2298_28(int x) { return x * 28; }
+inline int f2298_29(int x) { return x * 29; }
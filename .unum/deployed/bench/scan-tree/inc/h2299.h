@@ -0,0 +1,42 @@
+#pragma once
+/* header 2299 */
+#include <vector>
+#include "h2885.h"
+#include "h4742.h"
+#include "h7063.h"
+#include "h7138.h"
+#include "h3369.h"
+#ifdef X
+#include "h7942.h"
+#endif
+struct S2299 { int a; const char *s = "x//y"; };
+inline int f2299_0(int x) { return x * 0; }
+inline int f2299_1(int x) { return x * 1; }
+inline int f2299_2(int x) { return x * 2; }
+inline int f2299_3(int x) { return x * 3; }
+inline int f2299_4(int x) { return x * 4; }
+inline int f2299_5(int x) { return x * 5; }
+inline int f2299_6(int x) { return x * 6; }
+inline int f2299_7(int x) { return x * 7; }
+inline int f2299_8(int x) { return x * 8; }
+inline int f2299_9(int x) { return x * 9; }
+inline int f2299_10(int x) { return x * 10; }
+inline int f2299_11(int x) { return x * 11; }
+inline int f2299_12(int x) { return x * 12; }
+inline int f2299_13(int x) { return x * 13; }
+inline int f2299_14(int x) { return x * 14; }
+inline int f2299_15(int x) { return x * 15; }
+inline int f2299_16(int x) { return x * 16; }
+inline int f2299_17(int x) { return x * 17; }
+inline int f2299_18(int x) { return x * 18; }
+inline int f2299_19(int x) { return x * 19; }
+inline int f2299_20(int x) { return x * 20; }
+inline int f2299_21(int x) { return x * 21; }
+inline int f2299_22(int x) { return x * 22; }
+inline int f2299_23(int x) { return x * 23; }
+inline int f2299_24(int x) { return x * 24; }
+inline int f2299_25(int x) { return x * 25; }
+inline int f2299_26(int x) { return x * 26; }
+inline int f2299_27(int x) { return x * 27; }
+inline int f2299_28(int x) { return x * 28; }
+inline int f2299_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 23 */
+#include <vector>
+#include "h1455.h"
+#include "h62.h"
+#include "h7741.h"
+#include "h8987.h"
+#include "h4189.h"
+#ifdef X
+#include "h5932.h"
+#endif
+struct S23 { int a; const char *s = "x//y"; };
+inline int f23_0(int x) { return x * 0; }
+inline int f23_1(int x) { return x * 1; }
+inline int f23_2(int x) { return x * 2; }
+inline int f23_3(int x) { return x * 3; }
+inline int f23_4(int x) { return x * 4; }
+inline int f23_5(int x) { return x * 5; }
+inline int f23_6(int x) { return x * 6; }
+inline int f23_7(int x) { return x * 7; }
+inline int f23_8(int x) { return x * 8; }
+inline int f23_9(int x) { return x * 9; }
+inline int f23_10(int x) { return x * 10; }
+inline int f23_11(int x) { return x * 11; }
+inline int f23_12(int x) { return x * 12; }
+inline int f23_13(int x) { return x * 13; }
+inline int f23_14(int x) { return x * 14; }
+inline int f23_15(int x) { return x * 15; }
+inline int f23_16(int x) { return x * 16; }
+inline int f23_17(int x) { return x * 17; }
+inline int f23_18(int x) { return x * 18; }
+inline int f23_19(int x) { return x * 19; }
+inline int f23_20(int x) { return x * 20; }
+inline int f23_21(int x) { return x * 21; }
+inline int f23_22(int x) { return x * 22; }
+inline int f23_23(int x) { return x * 23; }
+inline int f23_24(int x) { return x * 24; }
+inline int f23_25(int x) { return x * 25; }
+inline int f23_26(int x) { return x * 26; }
+inline int f23_27(int x) { return x * 27; }
+inline int f23_28(int x) { return x * 28; }
+inline int f23_29(int x) { return x * 29; }
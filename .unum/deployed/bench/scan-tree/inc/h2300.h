@@ -0,0 +1,42 @@
+#pragma once
+/* header 2300 */
+#include <vector>
+#include "h272.h"
+#include "h5669.h"
+#include "h5566.h"
+#include "h9080.h"
+#include "h4880.h"
+#ifdef X
+#include "h774.h"
+#endif
+struct S2300 { int a; const char *s = "x//y"; };
+inline int f2300_0(int x) { return x * 0; }
+inline int f2300_1(int x) { return x * 1; }
+inline int f2300_2(int x) { return x * 2; }
+inline int f2300_3(int x) { return x * 3; }
+inline int f2300_4(int x) { return x * 4; }
+inline int f2300_5(int x) { return x * 5; }
+inline int f2300_6(int x) { return x * 6; }
+inline int f2300_7(int x) { return x * 7; }
+inline int f2300_8(int x) { return x * 8; }
+inline int f2300_9(int x) { return x * 9; }
+inline int f2300_10(int x) { return x * 10; }
+inline int f2300_11(int x) { return x * 11; }
+inline int f2300_12(int x) { return x * 12; }
+inline int f2300_13(int x) { return x * 13; }
+inline int f2300_14(int x) { return x * 14; }
+inline int f2300_15(int x) { return x * 15; }
+inline int f2300_16(int x) { return x * 16; }
+inline int f2300_17(int x) { return x * 17; }
+inline int f2300_18(int x) { return x * 18; }
+inline int f2300_19(int x) { return x * 19; }
+inline int f2300_20(int x) { return x * 20; }
+inline int f2300_21(int x) { return x * 21; }
+inline int f2300_22(int x) { return x * 22; }
+inline int f2300_23(int x) { return x * 23; }
+inline int f2300_24(int x) { return x * 24; }
+inline int f2300_25(int x) { return x * 25; }
+inline int f2300_26(int x) { return x * 26; }
+inline int f2300_27(int x) { return x * 27; }
+inline int f2300_28(int x) { return x * 28; }
+inline int f2300_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2306 */
+#include <vector>
+#include "h1454.h"
+#include "h6935.h"
+#include "h9254.h"
+#include "h1246.h"
+#include "h3823.h"
+#ifdef X
+#include "h6933.h"
+#endif
+struct S2306 { int a; const char *s = "x//y"; };
+inline int f2306_0(int x) { return x * 0; }
+inline int f2306_1(int x) { return x * 1; }
+inline int f2306_2(int x) { return x * 2; }
+inline int f2306_3(int x) { return x * 3; }
+inline int f2306_4(int x) { return x * 4; }
+inline int f2306_5(int x) { return x * 5; }
+inline int f2306_6(int x) { return x * 6; }
+inline int f2306_7(int x) { return x * 7; }
+inline int f2306_8(int x) { return x * 8; }
+inline int f2306_9(int x) { return x * 9; }
+inline int f2306_10(int x) { return x * 10; }
+inline int f2306_11(int x) { return x * 11; }
+inline int f2306_12(int x) { return x * 12; }
+inline int f2306_13(int x) { return x * 13; }
+inline int f2306_14(int x) { return x * 14; }
+inline int f2306_15(int x) { return x * 15; }
+inline int f2306_16(int x) { return x * 16; }
+inline int f2306_17(int x) { return x * 17; }
+inline int f2306_18(int x) { return x * 18; }
+inline int f2306_19(int x) { return x * 19; }
+inline int f2306_20(int x) { return x * 20; }
+inline int f2306_21(int x) { return x * 21; }
+inline int f2306_22(int x) { return x * 22; }
+inline int f2306_23(int x) { return x * 23; }
+inline int f2306_24(int x) { return x * 24; }
+inline int f2306_25(int x) { return x * 25; }
+inline int f2306_26(int x) { return x * 26; }
+inline int f2306_27(int x) { return x * 27; }
+inline int f2306_28(int x) { return x * 28; }
+inline int f2306_29(int x) { return x * 29; }
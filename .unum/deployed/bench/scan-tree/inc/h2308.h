@@ -0,0 +1,42 @@
+#pragma once
+/* header 2308 */
+#include <vector>
+#include "h9179.h"
+#include "h7874.h"
+#include "h283.h"
+#include "h2827.h"
+#include "h2169.h"
+#ifdef X
+#include "h9933.h"
+#endif
+struct S2308 { int a; const char *s = "x//y"; };
+inline int f2308_0(int x) { return x * 0; }
+inline int f2308_1(int x) { return x * 1; }
+inline int f2308_2(int x) { return x * 2; }
+inline int f2308_3(int x) { return x * 3; }
+inline int f2308_4(int x) { return x * 4; }
+inline int f2308_5(int x) { return x * 5; }
+inline int f2308_6(int x) { return x * 6; }
+inline int f2308_7(int x) { return x * 7; }
+inline int f2308_8(int x) { return x * 8; }
+inline int f2308_9(int x) { return x * 9; }
+inline int f2308_10(int x) { return x * 10; }
+inline int f2308_11(int x) { return x * 11; }
+inline int f2308_12(int x) { return x * 12; }
+inline int f2308_13(int x) { return x * 13; }
+inline int f2308_14(int x) { return x * 14; }
+inline int f2308_15(int x) { return x * 15; }
+inline int f2308_16(int x) { return x * 16; }
+inline int f2308_17(int x) { return x * 17; }
+inline int f2308_18(int x) { return x * 18; }
+inline int f2308_19(int x) { return x * 19; }
+inline int f2308_20(int x) { return x * 20; }
+inline int f2308_21(int x) { return x * 21; }
+inline int f2308_22(int x) { return x * 22; }
+inline int f2308_23(int x) { return x * 23; }
+inline int f2308_24(int x) { return x * 24; }
+inline int f2308_25(int x) { return x * 25; }
+inline int f2308_26(int x) { return x * 26; }
+inline int f2308_27(int x) { return x * 27; }
+inline int f2308_28(int x) { return x * 28; }
+inline int f2308_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2312 */
+#include <vector>
+#include "h8541.h"
+#include "h8464.h"
+#include "h9276.h"
+#include "h5644.h"
+#include "h6250.h"
+#ifdef X
+#include "h6691.h"
+#endif
+struct S2312 { int a; const char *s = "x//y"; };
+inline int f2312_0(int x) { return x * 0; }
+inline int f2312_1(int x) { return x * 1; }
+inline int f2312_2(int x) { return x * 2; }
+inline int f2312_3(int x) { return x * 3; }
+inline int f2312_4(int x) { return x * 4; }
+inline int f2312_5(int x) { return x * 5; }
+inline int f2312_6(int x) { return x * 6; }
+inline int f2312_7(int x) { return x * 7; }
+inline int f2312_8(int x) { return x * 8; }
+inline int f2312_9(int x) { return x * 9; }
+inline int f2312_10(int x) { return x * 10; }
+inline int f2312_11(int x) { return x * 11; }
+inline int f2312_12(int x) { return x * 12; }
+inline int f2312_13(int x) { return x * 13; }
+inline int f2312_14(int x) { return x * 14; }
+inline int f2312_15(int x) { return x * 15; }
+inline int f2312_16(int x) { return x * 16; }
+inline int f2312_17(int x) { return x * 17; }
+inline int f2312_18(int x) { return x * 18; }
+inline int f2312_19(int x) { return x * 19; }
+inline int f2312_20(int x) { return x * 20; }
+inline int f2312_21(int x) { return x * 21; }
+inline int f2312_22(int x) { return x * 22; }
+inline int f2312_23(int x) { return x * 23; }
+inline int f2312_24(int x) { return x * 24; }
+inline int f2312_25(int x) { return x * 25; }
+inline int f2312_26(int x) { return x * 26; }
+inline int f2312_27(int x) { return x * 27; }
+inline int f2312_28(int x) { return x * 28; }
+inline int f2312_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2315 */
+#include <vector>
+#include "h3605.h"
+#include "h8794.h"
+#include "h8671.h"
+#include "h3.h"
+#include "h6250.h"
+#ifdef X
+#include "h7069.h"
+#endif
+struct S2315 { int a; const char *s = "x//y"; };
+inline int f2315_0(int x) { return x * 0; }
+inline int f2315_1(int x) { return x * 1; }
+inline int f2315_2(int x) { return x * 2; }
+inline int f2315_3(int x) { return x * 3; }
+inline int f2315_4(int x) { return x * 4; }
+inline int f2315_5(int x) { return x * 5; }
+inline int f2315_6(int x) { return x * 6; }
+inline int f2315_7(int x) { return x * 7; }
+inline int f2315_8(int x) { return x * 8; }
+inline int f2315_9(int x) { return x * 9; }
+inline int f2315_10(int x) { return x * 10; }
+inline int f2315_11(int x) { return x * 11; }
+inline int f2315_12(int x) { return x * 12; }
+inline int f2315_13(int x) { return x * 13; }
+inline int f2315_14(int x) { return x * 14; }
+inline int f2315_15(int x) { return x * 15; }
+inline int f2315_16(int x) { return x * 16; }
+inline int f2315_17(int x) { return x * 17; }
+inline int f2315_18(int x) { return x * 18; }
+inline int f2315_19(int x) { return x * 19; }
+inline int f2315_20(int x) { return x * 20; }
+inline int f2315_21(int x) { return x * 21; }
+inline int f2315_22(int x) { return x * 22; }
+inline int f2315_23(int x) { return x * 23; }
+inline int f2315_24(int x) { return x * 24; }
+inline int f2315_25(int x) { return x * 25; }
+inline int f2315_26(int x) { return x * 26; }
+inline int f2315_27(int x) { return x * 27; }
+inline int f2315_28(int x) { return x * 28; }
+inline int f2315_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2319 */
+#include <vector>
+#include "h4010.h"
+#include "h7729.h"
+#include "h7522.h"
+#include "h6847.h"
+#include "h3876.h"
+#ifdef X
+#include "h5816.h"
+#endif
+struct S2319 { int a; const char *s = "x//y"; };
+inline int f2319_0(int x) { return x * 0; }
+inline int f2319_1(int x) { return x * 1; }
+inline int f2319_2(int x) { return x * 2; }
+inline int f2319_3(int x) { return x * 3; }
+inline int f2319_4(int x) { return x * 4; }
+inline int f2319_5(int x) { return x * 5; }
+inline int f2319_6(int x) { return x * 6; }
+inline int f2319_7(int x) { return x * 7; }
+inline int f2319_8(int x) { return x * 8; }
+inline int f2319_9(int x) { return x * 9; }
+inline int f2319_10(int x) { return x * 10; }
+inline int f2319_11(int x) { return x * 11; }
+inline int f2319_12(int x) { return x * 12; }
+inline int f2319_13(int x) { return x * 13; }
+inline int f2319_14(int x) { return x * 14; }
+inline int f2319_15(int x) { return x * 15; }
+inline int f2319_16(int x) { return x * 16; }
+inline int f2319_17(int x) { return x * 17; }
+inline int f2319_18(int x) { return x * 18; }
+inline int f2319_19(int x) { return x * 19; }
+inline int f2319_20(int x) { return x * 20; }
+inline int f2319_21(int x) { return x * 21; }
+inline int f2319_22(int x) { return x * 22; }
+inline int f2319_23(int x) { return x * 23; }
+inline int f2319_24(int x) { return x * 24; }
+inline int f2319_25(int x) { return x * 25; }
+inline int f2319_26(int x) { return x * 26; }
+inline int f2319_27(int x) { return x * 27; }
+inline int f2319_28(int x) { return x * 28; }
+inline int f2319_29(int x) { return x * 29; }
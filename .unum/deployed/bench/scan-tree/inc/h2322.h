@@ -0,0 +1,42 @@
+#pragma once
+/* header 2322 */
+#include <vector>
+#include "h5067.h"
+#include "h1332.h"
+#include "h3709.h"
+#include "h1170.h"
+#include "h397.h"
+#ifdef X
+#include "h1892.h"
+#endif
+struct S2322 { int a; const char *s = "x//y"; };
+inline int f2322_0(int x) { return x * 0; }
+inline int f2322_1(int x) { return x * 1; }
+inline int f2322_2(int x) { return x * 2; }
+inline int f2322_3(int x) { return x * 3; }
+inline int f2322_4(int x) { return x * 4; }
+inline int f2322_5(int x) { return x * 5; }
+inline int f2322_6(int x) { return x * 6; }
+inline int f2322_7(int x) { return x * 7; }
+inline int f2322_8(int x) { return x * 8; }
+inline int f2322_9(int x) { return x * 9; }
+inline int f2322_10(int x) { return x * 10; }
+inline int f2322_11(int x) { return x * 11; }
+inline int f2322_12(int x) { return x * 12; }
+inline int f2322_13(int x) { return x * 13; }
+inline int f2322_14(int x) { return x * 14; }
+inline int f2322_15(int x) { return x * 15; }
+inline int f2322_16(int x) { return x * 16; }
+inline int f2322_17(int x) { return x * 17; }
+inline int f2322_18(int x) { return x * 18; }
+inline int f2322_19(int x) { return x * 19; }
+inline int f2322_20(int x) { return x * 20; }
+inline int f2322_21(int x) { return x * 21; }
+inline int f2322_22(int x) { return x * 22; }
+inline int f2322_23(int x) { return x * 23; }
+inline int f2322_24(int x) { return x * 24; }
+inline int f2322_25(int x) { return x * 25; }
+inline int f2322_26(int x) { return x * 26; }
+inline int f2322_27(int x) { return x * 27; }
+inline int f2322_28(int x) { return x * 28; }
+inline int f2322_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2323 */
+#include <vector>
+#include "h5063.h"
+#include "h9189.h"
+#include "h3377.h"
+#include "h6592.h"
+#include "h5520.h"
+#ifdef X
+#include "h2882.h"
+#endif
+struct S2323 { int a; const char *s = "x//y"; };
+inline int f2323_0(int x) { return x * 0; }
+inline int f2323_1(int x) { return x * 1; }
+inline int f2323_2(int x) { return x * 2; }
+inline int f2323_3(int x) { return x * 3; }
+inline int f2323_4(int x) { return x * 4; }
+inline int f2323_5(int x) { return x * 5; }
+inline int f2323_6(int x) { return x * 6; }
+inline int f2323_7(int x) { return x * 7; }
+inline int f2323_8(int x) { return x * 8; }
+inline int f2323_9(int x) { return x * 9; }
+inline int f2323_10(int x) { return x * 10; }
+inline int f2323_11(int x) { return x * 11; }
+inline int f2323_12(int x) { return x * 12; }
+inline int f2323_13(int x) { return x * 13; }
+inline int f2323_14(int x) { return x * 14; }
+inline int f2323_15(int x) { return x * 15; }
+inline int f2323_16(int x) { return x * 16; }
+inline int f2323_17(int x) { return x * 17; }
+inline int f2323_18(int x) { return x * 18; }
+inline int f2323_19(int x) { return x * 19; }
+inline int f2323_20(int x) { return x * 20; }
+inline int f2323_21(int x) { return x * 21; }
+inline int f2323_22(int x) { return x * 22; }
+inline int f2323_23(int x) { return x * 23; }
+inline int f2323_24(int x) { return x * 24; }
+inline int f2323_25(int x) { return x * 25; }
+inline int f2323_26(int x) { return x * 26; }
+inline int f2323_27(int x) { return x * 27; }
+inline int f2323_28(int x) { return x * 28; }
+inline int f2323_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2324 */
+#include <vector>
+#include "h5653.h"
+#include "h6952.h"
+#include "h87.h"
+#include "h1564.h"
+#include "h4953.h"
+#ifdef X
+#include "h6416.h"
+#endif
+struct S2324 { int a; const char *s = "x//y"; };
+inline int f2324_0(int x) { return x * 0; }
+inline int f2324_1(int x) { return x * 1; }
+inline int f2324_2(int x) { return x * 2; }
+inline int f2324_3(int x) { return x * 3; }
+inline int f2324_4(int x) { return x * 4; }
+inline int f2324_5(int x) { return x * 5; }
+inline int f2324_6(int x) { return x * 6; }
+inline int f2324_7(int x) { return x * 7; }
+inline int f2324_8(int x) { return x * 8; }
+inline int f2324_9(int x) { return x * 9; }
+inline int f2324_10(int x) { return x * 10; }
+inline int f2324_11(int x) { return x * 11; }
+inline int f2324_12(int x) { return x * 12; }
+inline int f2324_13(int x) { return x * 13; }
+inline int f2324_14(int x) { return x * 14; }
+inline int f2324_15(int x) { return x * 15; }
+inline int f2324_16(int x) { return x * 16; }
+inline int f2324_17(int x) { return x * 17; }
+inline int f2324_18(int x) { return x * 18; }
+inline int f2324_19(int x) { return x * 19; }
+inline int f2324_20(int x) { return x * 20; }
+inline int f2324_21(int x) { return x * 21; }
+inline int f2324_22(int x) { return x * 22; }
+inline int f2324_23(int x) { return x * 23; }
+inline int f2324_24(int x) { return x * 24; }
+inline int f2324_25(int x) { return x * 25; }
+inline int f2324_26(int x) { return x * 26; }
+inline int f2324_27(int x) { return x * 27; }
+inline int f2324_28(int x) { return x * 28; }
+inline int f2324_29(int x) { return x * 29; }
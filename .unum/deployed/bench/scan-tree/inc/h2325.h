@@ -0,0 +1,42 @@
+#pragma once
+/* header 2325 */
+#include <vector>
+#include "h8127.h"
+#include "h4277.h"
+#include "h9314.h"
+#include "h132.h"
+#include "h8616.h"
+#ifdef X
+#include "h5100.h"
+#endif
+struct S2325 { int a; const char *s = "x//y"; };
+inline int f2325_0(int x) { return x * 0; }
+inline int f2325_1(int x) { return x * 1; }
+inline int f2325_2(int x) { return x * 2; }
+inline int f2325_3(int x) { return x * 3; }
+inline int f2325_4(int x) { return x * 4; }
+inline int f2325_5(int x) { return x * 5; }
+inline int f2325_6(int x) { return x * 6; }
+inline int f2325_7(int x) { return x * 7; }
+inline int f2325_8(int x) { return x * 8; }
+inline int f2325_9(int x) { return x * 9; }
+inline int f2325_10(int x) { return x * 10; }
+inline int f2325_11(int x) { return x * 11; }
+inline int f2325_12(int x) { return x * 12; }
+inline int f2325_13(int x) { return x * 13; }
+inline int f2325_14(int x) { return x * 14; }
+inline int f2325_15(int x) { return x * 15; }
+inline int f2325_16(int x) { return x * 16; }
+inline int f2325_17(int x) { return x * 17; }
+inline int f2325_18(int x) { return x * 18; }
+inline int f2325_19(int x) { return x * 19; }
+inline int f2325_20(int x) { return x * 20; }
+inline int f2325_21(int x) { return x * 21; }
+inline int f2325_22(int x) { return x * 22; }
+inline int f2325_23(int x) { return x * 23; }
+inline int f2325_24(int x) { return x * 24; }
+inline int f2325_25(int x) { return x * 25; }
+inline int f2325_26(int x) { return x * 26; }
+inline int f2325_27(int x) { return x * 27; }
+inline int f2325_28(int x) { return x * 28; }
+inline int f2325_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2326 */
+#include <vector>
+#include "h2992.h"
+#include "h5211.h"
+#include "h7814.h"
+#include "h8921.h"
+#include "h9820.h"
+#ifdef X
+#include "h4535.h"
+#endif
+struct S2326 { int a; const char *s = "x//y"; };
+inline int f2326_0(int x) { return x * 0; }
+inline int f2326_1(int x) { return x * 1; }
+inline int f2326_2(int x) { return x * 2; }
+inline int f2326_3(int x) { return x * 3; }
+inline int f2326_4(int x) { return x * 4; }
+inline int f2326_5(int x) { return x * 5; }
+inline int f2326_6(int x) { return x * 6; }
+inline int f2326_7(int x) { return x * 7; }
+inline int f2326_8(int x) { return x * 8; }
+inline int f2326_9(int x) { return x * 9; }
+inline int f2326_10(int x) { return x * 10; }
+inline int f2326_11(int x) { return x * 11; }
+inline int f2326_12(int x) { return x * 12; }
+inline int f2326_13(int x) { return x * 13; }
+inline int f2326_14(int x) { return x * 14; }
+inline int f2326_15(int x) { return x * 15; }
+inline int f2326_16(int x) { return x * 16; }
+inline int f2326_17(int x) { return x * 17; }
+inline int f2326_18(int x) { return x * 18; }
+inline int f2326_19(int x) { return x * 19; }
+inline int f2326_20(int x) { return x * 20; }
+inline int f2326_21(int x) { return x * 21; }
+inline int f2326_22(int x) { return x * 22; }
+inline int f2326_23(int x) { return x * 23; }
+inline int f2326_24(int x) { return x * 24; }
+inline int f2326_25(int x) { return x * 25; }
+inline int f2326_26(int x) { return x * 26; }
+inline int f2326_27(int x) { return x * 27; }
+inline int f2326_28(int x) { return x * 28; }
+inline int f2326_29(int x) { return x * 29; }
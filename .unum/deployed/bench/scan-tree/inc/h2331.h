@@ -0,0 +1,42 @@
+#pragma once
+/* header 2331 */
+#include <vector>
+#include "h1949.h"
+#include "h2469.h"
+#include "h6087.h"
+#include "h5790.h"
+#include "h640.h"
+#ifdef X
+#include "h2571.h"
+#endif
+struct S2331 { int a; const char *s = "x//y"; };
+inline int f2331_0(int x) { return x * 0; }
+inline int f2331_1(int x) { return x * 1; }
+inline int f2331_2(int x) { return x * 2; }
+inline int f2331_3(int x) { return x * 3; }
+inline int f2331_4(int x) { return x * 4; }
+inline int f2331_5(int x) { return x * 5; }
+inline int f2331_6(int x) { return x * 6; }
+inline int f2331_7(int x) { return x * 7; }
+inline int f2331_8(int x) { return x * 8; }
+inline int f2331_9(int x) { return x * 9; }
+inline int f2331_10(int x) { return x * 10; }
+inline int f2331_11(int x) { return x * 11; }
+inline int f2331_12(int x) { return x * 12; }
+inline int f2331_13(int x) { return x * 13; }
+inline int f2331_14(int x) { return x * 14; }
+inline int f2331_15(int x) { return x * 15; }
+inline int f2331_16(int x) { return x * 16; }
+inline int f2331_17(int x) { return x * 17; }
+inline int f2331_18(int x) { return x * 18; }
+inline int f2331_19(int x) { return x * 19; }
+inline int f2331_20(int x) { return x * 20; }
+inline int f2331_21(int x) { return x * 21; }
+inline int f2331_22(int x) { return x * 22; }
+inline int f2331_23(int x) { return x * 23; }
+inline int f2331_24(int x) { return x * 24; }
+inline int f2331_25(int x) { return x * 25; }
+inline int f2331_26(int x) { return x * 26; }
+inline int f2331_27(int x) { return x * 27; }
+inline int f2331_28(int x) { return x * 28; }
+inline int f2331_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2337 */
+#include <vector>
+#include "h1195.h"
+#include "h2057.h"
+#include "h8575.h"
+#include "h7112.h"
+#include "h5732.h"
+#ifdef X
+#include "h7376.h"
+#endif
+struct S2337 { int a; const char *s = "x//y"; };
+inline int f2337_0(int x) { return x * 0; }
+inline int f2337_1(int x) { return x * 1; }
+inline int f2337_2(int x) { return x * 2; }
+inline int f2337_3(int x) { return x * 3; }
+inline int f2337_4(int x) { return x * 4; }
+inline int f2337_5(int x) { return x * 5; }
+inline int f2337_6(int x) { return x * 6; }
+inline int f2337_7(int x) { return x * 7; }
+inline int f2337_8(int x) { return x * 8; }
+inline int f2337_9(int x) { return x * 9; }
+inline int f2337_10(int x) { return x * 10; }
+inline int f2337_11(int x) { return x * 11; }
+inline int f2337_12(int x) { return x * 12; }
+inline int f2337_13(int x) { return x * 13; }
+inline int f2337_14(int x) { return x * 14; }
+inline int f2337_15(int x) { return x * 15; }
+inline int f2337_16(int x) { return x * 16; }
+inline int f2337_17(int x) { return x * 17; }
+inline int f2337_18(int x) { return x * 18; }
+inline int f2337_19(int x) { return x * 19; }
+inline int f2337_20(int x) { return x * 20; }
+inline int f2337_21(int x) { return x * 21; }
+inline int f2337_22(int x) { return x * 22; }
+inline int f2337_23(int x) { return x * 23; }
+inline int f2337_24(int x) { return x * 24; }
+inline int f2337_25(int x) { return x * 25; }
+inline int f2337_26(int x) { return x * 26; }
+inline int f2337_27(int x) { return x * 27; }
+inline int f2337_28(int x) { return x * 28; }
+inline int f2337_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 234 */
+#include <vector>
+#include "h9810.h"
+#include "h2163.h"
+#include "h1878.h"
+#include "h2984.h"
+#include "h42.h"
+#ifdef X
+#include "h5349.h"
+#endif
+struct S234 { int a; const char *s = "x//y"; };
+inline int f234_0(int x) { return x * 0; }
+inline int f234_1(int x) { return x * 1; }
+inline int f234_2(int x) { return x * 2; }
+inline int f234_3(int x) { return x * 3; }
+inline int f234_4(int x) { return x * 4; }
+inline int f234_5(int x) { return x * 5; }
+inline int f234_6(int x) { return x * 6; }
+inline int f234_7(int x) { return x * 7; }
+inline int f234_8(int x) { return x * 8; }
+inline int f234_9(int x) { return x * 9; }
+inline int f234_10(int x) { return x * 10; }
+inline int f234_11(int x) { return x * 11; }
+inline int f234_12(int x) { return x * 12; }
+inline int f234_13(int x) { return x * 13; }
+inline int f234_14(int x) { return x * 14; }
+inline int f234_15(int x) { return x * 15; }
+inline int f234_16(int x) { return x * 16; }
+inline int f234_17(int x) { return x * 17; }
+inline int f234_18(int x) { return x * 18; }
+inline int f234_19(int x) { return x * 19; }
+inline int f234_20(int x) { return x * 20; }
+inline int f234_21(int x) { return x * 21; }
+inline int f234_22(int x) { return x * 22; }
+inline int f234_23(int x) { return x * 23; }
+inline int f234_24(int x) { return x * 24; }
+inline int f234_25(int x) { return x * 25; }
+inline int f234_26(int x) { return x * 26; }
+inline int f234_27(int x) { return x * 27; }
+inline int f234_28(int x) { return x * 28; }
+inline int f234_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2340 */
+#include <vector>
+#include "h6593.h"
+#include "h1270.h"
+#include "h9273.h"
+#include "h4501.h"
+#include "h2761.h"
+#ifdef X
+#include "h2289.h"
+#endif
+struct S2340 { int a; const char *s = "x//y"; };
+inline int f2340_0(int x) { return x * 0; }
+inline int f2340_1(int x) { return x * 1; }
+inline int f2340_2(int x) { return x * 2; }
+inline int f2340_3(int x) { return x * 3; }
+inline int f2340_4(int x) { return x * 4; }
+inline int f2340_5(int x) { return x * 5; }
+inline int f2340_6(int x) { return x * 6; }
+inline int f2340_7(int x) { return x * 7; }
+inline int f2340_8(int x) { return x * 8; }
+inline int f2340_9(int x) { return x * 9; }
+inline int f2340_10(int x) { return x * 10; }
+inline int f2340_11(int x) { return x * 11; }
+inline int f2340_12(int x) { return x * 12; }
+inline int f2340_13(int x) { return x * 13; }
+inline int f2340_14(int x) { return x * 14; }
+inline int f2340_15(int x) { return x * 15; }
+inline int f2340_16(int x) { return x * 16; }
+inline int f2340_17(int x) { return x * 17; }
+inline int f2340_18(int x) { return x * 18; }
+inline int f2340_19(int x) { return x * 19; }
+inline int f2340_20(int x) { return x * 20; }
+inline int f2340_21(int x) { return x * 21; }
+inline int f2340_22(int x) { return x * 22; }
+inline int f2340_23(int x) { return x * 23; }
+inline int f2340_24(int x) { return x * 24; }
+inline int f2340_25(int x) { return x * 25; }
+inline int f2340_26(int x) { return x * 26; }
+inline int f2340_27(int x) { return x * 27; }
+inline int f2340_28(int x) { return x * 28; }
+inline int f2340_29(int x) { return x * 29; }
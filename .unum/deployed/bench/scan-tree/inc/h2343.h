@@ -0,0 +1,42 @@
+#pragma once
+/* header 2343 */
+#include <vector>
+#include "h8075.h"
+#include "h9197.h"
+#include "h2817.h"
+#include "h81.h"
+#include "h5182.h"
+#ifdef X
+#include "h6646.h"
+#endif
+struct S2343 { int a; const char *s = "x//y"; };
+inline int f2343_0(int x) { return x * 0; }
+inline int f2343_1(int x) { return x * 1; }
+inline int f2343_2(int x) { return x * 2; }
+inline int f2343_3(int x) { return x * 3; }
+inline int f2343_4(int x) { return x * 4; }
+inline int f2343_5(int x) { return x * 5; }
+inline int f2343_6(int x) { return x * 6; }
+inline int f2343_7(int x) { return x * 7; }
+inline int f2343_8(int x) { return x * 8; }
+inline int f2343_9(int x) { return x * 9; }
+inline int f2343_10(int x) { return x * 10; }
+inline int f2343_11(int x) { return x * 11; }
+inline int f2343_12(int x) { return x * 12; }
+inline int f2343_13(int x) { return x * 13; }
+inline int f2343_14(int x) { return x * 14; }
+inline int f2343_15(int x) { return x * 15; }
+inline int f2343_16(int x) { return x * 16; }
+inline int f2343_17(int x) { return x * 17; }
+inline int f2343_18(int x) { return x * 18; }
+inline int f2343_19(int x) { return x * 19; }
+inline int f2343_20(int x) { return x * 20; }
+inline int f2343_21(int x) { return x * 21; }
+inline int f2343_22(int x) { return x * 22; }
+inline int f2343_23(int x) { return x * 23; }
+inline int f2343_24(int x) { return x * 24; }
+inline int f2343_25(int x) { return x * 25; }
+inline int f2343_26(int x) { return x * 26; }
+inline int f2343_27(int x) { return x * 27; }
+inline int f2343_28(int x) { return x * 28; }
+inline int f2343_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2344 */
+#include <vector>
+#include "h6983.h"
+#include "h1043.h"
+#include "h2032.h"
+#include "h8448.h"
+#include "h1486.h"
+#ifdef X
+#include "h8.h"
+#endif
+struct S2344 { int a; const char *s = "x//y"; };
+inline int f2344_0(int x) { return x * 0; }
+inline int f2344_1(int x) { return x * 1; }
+inline int f2344_2(int x) { return x * 2; }
+inline int f2344_3(int x) { return x * 3; }
+inline int f2344_4(int x) { return x * 4; }
+inline int f2344_5(int x) { return x * 5; }
+inline int f2344_6(int x) { return x * 6; }
+inline int f2344_7(int x) { return x * 7; }
+inline int f2344_8(int x) { return x * 8; }
+inline int f2344_9(int x) { return x * 9; }
+inline int f2344_10(int x) { return x * 10; }
+inline int f2344_11(int x) { return x * 11; }
+inline int f2344_12(int x) { return x * 12; }
+inline int f2344_13(int x) { return x * 13; }
+inline int f2344_14(int x) { return x * 14; }
+inline int f2344_15(int x) { return x * 15; }
+inline int f2344_16(int x) { return x * 16; }
+inline int f2344_17(int x) { return x * 17; }
+inline int f2344_18(int x) { return x * 18; }
+inline int f2344_19(int x) { return x * 19; }
+inline int f2344_20(int x) { return x * 20; }
+inline int f2344_21(int x) { return x * 21; }
+inline int f2344_22(int x) { return x * 22; }
+inline int f2344_23(int x) { return x * 23; }
+inline int f2344_24(int x) { return x * 24; }
+inline int f2344_25(int x) { return x * 25; }
+inline int f2344_26(int x) { return x * 26; }
+inline int f2344_27(int x) { return x * 27; }
+inline int f2344_28(int x) { return x * 28; }
+inline int f2344_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2347 */
+#include <vector>
+#include "h4020.h"
+#include "h2568.h"
+#include "h5943.h"
+#include "h1473.h"
+#include "h7198.h"
+#ifdef X
+#include "h5802.h"
+#endif
+struct S2347 { int a; const char *s = "x//y"; };
+inline int f2347_0(int x) { return x * 0; }
+inline int f2347_1(int x) { return x * 1; }
+inline int f2347_2(int x) { return x * 2; }
+inline int f2347_3(int x) { return x * 3; }
+inline int f2347_4(int x) { return x * 4; }
+inline int f2347_5(int x) { return x * 5; }
+inline int f2347_6(int x) { return x * 6; }
+inline int f2347_7(int x) { return x * 7; }
+inline int f2347_8(int x) { return x * 8; }
+inline int f2347_9(int x) { return x * 9; }
+inline int f2347_10(int x) { return x * 10; }
+inline int f2347_11(int x) { return x * 11; }
+inline int f2347_12(int x) { return x * 12; }
+inline int f2347_13(int x) { return x * 13; }
+inline int f2347_14(int x) { return x * 14; }
+inline int f2347_15(int x) { return x * 15; }
+inline int f2347_16(int x) { return x * 16; }
+inline int f2347_17(int x) { return x * 17; }
+inline int f2347_18(int x) { return x * 18; }
+inline int f2347_19(int x) { return x * 19; }
+inline int f2347_20(int x) { return x * 20; }
+inline int f2347_21(int x) { return x * 21; }
+inline int f2347_22(int x) { return x * 22; }
+inline int f2347_23(int x) { return x * 23; }
+inline int f2347_24(int x) { return x * 24; }
+inline int f2347_25(int x) { return x * 25; }
+inline int f2347_26(int x) { return x * 26; }
+inline int f2347_27(int x) { return x * 27; }
+inline int f2347_28(int x) { return x * 28; }
+inline int f2347_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2348 */
+#include <vector>
+#include "h8624.h"
+#include "h891.h"
+#include "h2846.h"
+#include "h799.h"
+#include "h7351.h"
+#ifdef X
+#include "h303.h"
+#endif
+struct S2348 { int a; const char *s = "x//y"; };
+inline int f2348_0(int x) { return x * 0; }
+inline int f2348_1(int x) { return x * 1; }
+inline int f2348_2(int x) { return x * 2; }
+inline int f2348_3(int x) { return x * 3; }
+inline int f2348_4(int x) { return x * 4; }
+inline int f2348_5(int x) { return x * 5; }
+inline int f2348_6(int x) { return x * 6; }
+inline int f2348_7(int x) { return x * 7; }
+inline int f2348_8(int x) { return x * 8; }
+inline int f2348_9(int x) { return x * 9; }
+inline int f2348_10(int x) { return x * 10; }
+inline int f2348_11(int x) { return x * 11; }
+inline int f2348_12(int x) { return x * 12; }
+inline int f2348_13(int x) { return x * 13; }
+inline int f2348_14(int x) { return x * 14; }
+inline int f2348_15(int x) { return x * 15; }
+inline int f2348_16(int x) { return x * 16; }
+inline int f2348_17(int x) { return x * 17; }
+inline int f2348_18(int x) { return x * 18; }
+inline int f2348_19(int x) { return x * 19; }
+inline int f2348_20(int x) { return x * 20; }
+inline int f2348_21(int x) { return x * 21; }
+inline int f2348_22(int x) { return x * 22; }
+inline int f2348_23(int x) { return x * 23; }
+inline int f2348_24(int x) { return x * 24; }
+inline int f2348_25(int x) { return x * 25; }
+inline int f2348_26(int x) { return x * 26; }
+inline int f2348_27(int x) { return x * 27; }
+inline int f2348_28(int x) { return x * 28; }
+inline int f2348_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2349 */
+#include <vector>
+#include "h1543.h"
+#include "h7265.h"
+#include "h1728.h"
+#include "h8530.h"
+#include "h2347.h"
+#ifdef X
+#include "h3326.h"
+#endif
+struct S2349 { int a; const char *s = "x//y"; };
+inline int f2349_0(int x) { return x * 0; }
+inline int f2349_1(int x) { return x * 1; }
+inline int f2349_2(int x) { return x * 2; }
+inline int f2349_3(int x) { return x * 3; }
+inline int f2349_4(int x) { return x * 4; }
+inline int f2349_5(int x) { return x * 5; }
+inline int f2349_6(int x) { return x * 6; }
+inline int f2349_7(int x) { return x * 7; }
+inline int f2349_8(int x) { return x * 8; }
+inline int f2349_9(int x) { return x * 9; }
+inline int f2349_10(int x) { return x * 10; }
+inline int f2349_11(int x) { return x * 11; }
+inline int f2349_12(int x) { return x * 12; }
+inline int f2349_13(int x) { return x * 13; }
+inline int f2349_14(int x) { return x * 14; }
+inline int f2349_15(int x) { return x * 15; }
+inline int f2349_16(int x) { return x * 16; }
+inline int f2349_17(int x) { return x * 17; }
+inline int f2349_18(int x) { return x * 18; }
+inline int f2349_19(int x) { return x * 19; }
+inline int f2349_20(int x) { return x * 20; }
+inline int f2349_21(int x) { return x * 21; }
+inline int f2349_22(int x) { return x * 22; }
+inline int f2349_23(int x) { return x * 23; }
+inline int f2349_24(int x) { return x * 24; }
+inline int f2349_25(int x) { return x * 25; }
+inline int f2349_26(int x) { return x * 26; }
+inline int f2349_27(int x) { return x * 27; }
+inline int f2349_28(int x) { return x * 28; }
+inline int f2349_29(int x) { return x * 29; }
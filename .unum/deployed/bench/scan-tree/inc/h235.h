@@ -0,0 +1,42 @@
+#pragma once
+/* header 235 */
+#include <vector>
+#include "h4944.h"
+#include "h3784.h"
+#include "h1733.h"
+#include "h5199.h"
+#include "h2400.h"
+#ifdef X
+#include "h3889.h"
+#endif
+struct S235 { int a; const char *s = "x//y"; };
+inline int f235_0(int x) { return x * 0; }
+inline int f235_1(int x) { return x * 1; }
+inline int f235_2(int x) { return x * 2; }
+inline int f235_3(int x) { return x * 3; }
+inline int f235_4(int x) { return x * 4; }
+inline int f235_5(int x) { return x * 5; }
+inline int f235_6(int x) { return x * 6; }
+inline int f235_7(int x) { return x * 7; }
+inline int f235_8(int x) { return x * 8; }
+inline int f235_9(int x) { return x * 9; }
+inline int f235_10(int x) { return x * 10; }
+inline int f235_11(int x) { return x * 11; }
+inline int f235_12(int x) { return x * 12; }
+inline int f235_13(int x) { return x * 13; }
+inline int f235_14(int x) { return x * 14; }
+inline int f235_15(int x) { return x * 15; }
+inline int f235_16(int x) { return x * 16; }
+inline int f235_17(int x) { return x * 17; }
+inline int f235_18(int x) { return x * 18; }
+inline int f235_19(int x) { return x * 19; }
+inline int f235_20(int x) { return x * 20; }
+inline int f235_21(int x) { return x * 21; }
+inline int f235_22(int x) { return x * 22; }
+inline int f235_23(int x) { return x * 23; }
+inline int f235_24(int x) { return x * 24; }
+inline int f235_25(int x) { return x * 25; }
+inline int f235_26(int x) { return x * 26; }
+inline int f235_27(int x) { return x * 27; }
+inline int f235_28(int x) { return x * 28; }
+inline int f235_29(int x) { return x * 29; }
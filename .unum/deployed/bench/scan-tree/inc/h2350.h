@@ -0,0 +1,42 @@
+#pragma once
+/* header 2350 */
+#include <vector>
+#include "h7129.h"
+#include "h3447.h"
+#include "h9441.h"
+#include "h9257.h"
+#include "h9385.h"
+#ifdef X
+#include "h2911.h"
+#endif
+struct S2350 { int a; const char *s = "x//y"; };
+inline int f2350_0(int x) { return x * 0; }
+inline int f2350_1(int x) { return x * 1; }
+inline int f2350_2(int x) { return x * 2; }
+inline int f2350_3(int x) { return x * 3; }
+inline int f2350_4(int x) { return x * 4; }
+inline int f2350_5(int x) { return x * 5; }
+inline int f2350_6(int x) { return x * 6; }
+inline int f2350_7(int x) { return x * 7; }
+inline int f2350_8(int x) { return x * 8; }
+inline int f2350_9(int x) { return x * 9; }
+inline int f2350_10(int x) { return x * 10; }
+inline int f2350_11(int x) { return x * 11; }
+inline int f2350_12(int x) { return x * 12; }
+inline int f2350_13(int x) { return x * 13; }
+inline int f2350_14(int x) { return x * 14; }
+inline int f2350_15(int x) { return x * 15; }
+inline int f2350_16(int x) { return x * 16; }
+inline int f2350_17(int x) { return x * 17; }
+inline int f2350_18(int x) { return x * 18; }
+inline int f2350_19(int x) { return x * 19; }
+inline int f2350_20(int x) { return x * 20; }
+inline int f2350_21(int x) { return x * 21; }
+inline int f2350_22(int x) { return x * 22; }
+inline int f2350_23(int x) { return x * 23; }
+inline int f2350_24(int x) { return x * 24; }
+inline int f2350_25(int x) { return x * 25; }
+inline int f2350_26(int x) { return x * 26; }
+inline int f2350_27(int x) { return x * 27; }
+inline int f2350_28(int x) { return x * 28; }
+inline int f2350_29(int x) { return x * 29; }
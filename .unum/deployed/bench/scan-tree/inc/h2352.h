@@ -0,0 +1,42 @@
+#pragma once
+/* header 2352 */
+#include <vector>
+#include "h4740.h"
+#include "h3709.h"
+#include "h1498.h"
+#include "h9564.h"
+#include "h3575.h"
+#ifdef X
+#include "h9900.h"
+#endif
+struct S2352 { int a; const char *s = "x//y"; };
+inline int f2352_0(int x) { return x * 0; }
+inline int f2352_1(int x) { return x * 1; }
+inline int f2352_2(int x) { return x * 2; }
+inline int f2352_3(int x) { return x * 3; }
+inline int f2352_4(int x) { return x * 4; }
+inline int f2352_5(int x) { return x * 5; }
+inline int f2352_6(int x) { return x * 6; }
+inline int f2352_7(int x) { return x * 7; }
+inline int f2352_8(int x) { return x * 8; }
+inline int f2352_9(int x) { return x * 9; }
+inline int f2352_10(int x) { return x * 10; }
+inline int f2352_11(int x) { return x * 11; }
+inline int f2352_12(int x) { return x * 12; }
+inline int f2352_13(int x) { return x * 13; }
+inline int f2352_14(int x) { return x * 14; }
+inline int f2352_15(int x) { return x * 15; }
+inline int f2352_16(int x) { return x * 16; }
+inline int f2352_17(int x) { return x * 17; }
+inline int f2352_18(int x) { return x * 18; }
+inline int f2352_19(int x) { return x * 19; }
+inline int f2352_20(int x) { return x * 20; }
+inline int f2352_21(int x) { return x * 21; }
+inline int f2352_22(int x) { return x * 22; }
+inline int f2352_23(int x) { return x * 23; }
+inline int f2352_24(int x) { return x * 24; }
+inline int f2352_25(int x) { return x * 25; }
+inline int f2352_26(int x) { return x * 26; }
+inline int f2352_27(int x) { return x * 27; }
+inline int f2352_28(int x) { return x * 28; }
+inline int f2352_29(int x) { return x * 29; }
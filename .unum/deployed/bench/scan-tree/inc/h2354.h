@@ -0,0 +1,42 @@
+#pragma once
+/* header 2354 */
+#include <vector>
+#include "h8327.h"
+#include "h9794.h"
+#include "h1631.h"
+#include "h4347.h"
+#include "h4972.h"
+#ifdef X
+#include "h7251.h"
+#endif
+struct S2354 { int a; const char *s = "x//y"; };
+inline int f2354_0(int x) { return x * 0; }
+inline int f2354_1(int x) { return x * 1; }
+inline int f2354_2(int x) { return x * 2; }
+inline int f2354_3(int x) { return x * 3; }
+inline int f2354_4(int x) { return x * 4; }
+inline int f2354_5(int x) { return x * 5; }
+inline int f2354_6(int x) { return x * 6; }
+inline int f2354_7(int x) { return x * 7; }
+inline int f2354_8(int x) { return x * 8; }
+inline int f2354_9(int x) { return x * 9; }
+inline int f2354_10(int x) { return x * 10; }
+inline int f2354_11(int x) { return x * 11; }
+inline int f2354_12(int x) { return x * 12; }
+inline int f2354_13(int x) { return x * 13; }
+inline int f2354_14(int x) { return x * 14; }
+inline int f2354_15(int x) { return x * 15; }
+inline int f2354_16(int x) { return x * 16; }
+inline int f2354_17(int x) { return x * 17; }
+inline int f2354_18(int x) { return x * 18; }
+inline int f2354_19(int x) { return x * 19; }
+inline int f2354_20(int x) { return x * 20; }
+inline int f2354_21(int x) { return x * 21; }
+inline int f2354_22(int x) { return x * 22; }
+inline int f2354_23(int x) { return x * 23; }
+inline int f2354_24(int x) { return x * 24; }
+inline int f2354_25(int x) { return x * 25; }
+inline int f2354_26(int x) { return x * 26; }
+inline int f2354_27(int x) { return x * 27; }
+inline int f2354_28(int x) { return x * 28; }
+inline int f2354_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2355 */
+#include <vector>
+#include "h4028.h"
+#include "h797.h"
+#include "h7737.h"
+#include "h9743.h"
+#include "h7786.h"
+#ifdef X
+#include "h949.h"
+#endif
+struct S2355 { int a; const char *s = "x//y"; };
+inline int f2355_0(int x) { return x * 0; }
+inline int f2355_1(int x) { return x * 1; }
+inline int f2355_2(int x) { return x * 2; }
+inline int f2355_3(int x) { return x * 3; }
+inline int f2355_4(int x) { return x * 4; }
+inline int f2355_5(int x) { return x * 5; }
+inline int f2355_6(int x) { return x * 6; }
+inline int f2355_7(int x) { return x * 7; }
+inline int f2355_8(int x) { return x * 8; }
+inline int f2355_9(int x) { return x * 9; }
+inline int f2355_10(int x) { return x * 10; }
+inline int f2355_11(int x) { return x * 11; }
+inline int f2355_12(int x) { return x * 12; }
+inline int f2355_13(int x) { return x * 13; }
+inline int f2355_14(int x) { return x * 14; }
+inline int f2355_15(int x) { return x * 15; }
+inline int f2355_16(int x) { return x * 16; }
+inline int f2355_17(int x) { return x * 17; }
+inline int f2355_18(int x) { return x * 18; }
+inline int f2355_19(int x) { return x * 19; }
+inline int f2355_20(int x) { return x * 20; }
+inline int f2355_21(int x) { return x * 21; }
+inline int f2355_22(int x) { return x * 22; }
+inline int f2355_23(int x) { return x * 23; }
+inline int f2355_24(int x) { return x * 24; }
+inline int f2355_25(int x) { return x * 25; }
+inline int f2355_26(int x) { return x * 26; }
+inline int f2355_27(int x) { return x * 27; }
+inline int f2355_28(int x) { return x * 28; }
+inline int f2355_29(int x) { return x * 29; }
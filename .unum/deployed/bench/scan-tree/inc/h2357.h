@@ -0,0 +1,42 @@
+#pragma once
+/* header 2357 */
+#include <vector>
+#include "h5398.h"
+#include "h3656.h"
+#include "h1686.h"
+#include "h2364.h"
+#include "h8335.h"
+#ifdef X
+#include "h7635.h"
+#endif
+struct S2357 { int a; const char *s = "x//y"; };
+inline int f2357_0(int x) { return x * 0; }
+inline int f2357_1(int x) { return x * 1; }
+inline int f2357_2(int x) { return x * 2; }
+inline int f2357_3(int x) { return x * 3; }
+inline int f2357_4(int x) { return x * 4; }
+inline int f2357_5(int x) { return x * 5; }
+inline int f2357_6(int x) { return x * 6; }
+inline int f2357_7(int x) { return x * 7; }
+inline int f2357_8(int x) { return x * 8; }
+inline int f2357_9(int x) { return x * 9; }
+inline int f2357_10(int x) { return x * 10; }
+inline int f2357_11(int x) { return x * 11; }
+inline int f2357_12(int x) { return x * 12; }
+inline int f2357_13(int x) { return x * 13; }
+inline int f2357_14(int x) { return x * 14; }
+inline int f2357_15(int x) { return x * 15; }
+inline int f2357_16(int x) { return x * 16; }
+inline int f2357_17(int x) { return x * 17; }
+inline int f2357_18(int x) { return x * 18; }
+inline int f2357_19(int x) { return x * 19; }
+inline int f2357_20(int x) { return x * 20; }
+inline int f2357_21(int x) { return x * 21; }
+inline int f2357_22(int x) { return x * 22; }
+inline int f2357_23(int x) { return x * 23; }
+inline int f2357_24(int x) { return x * 24; }
+inline int f2357_25(int x) { return x * 25; }
+inline int f2357_26(int x) { return x * 26; }
+inline int f2357_27(int x) { return x * 27; }
+inline int f2357_28(int x) { return x * 28; }
+inline int f2357_29(int x) { return x * 29; }
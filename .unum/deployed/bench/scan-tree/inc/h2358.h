@@ -0,0 +1,42 @@
+#pragma once
+/* header 2358 */
+#include <vector>
+#include "h4102.h"
+#include "h120.h"
+#include "h7672.h"
+#include "h5880.h"
+#include "h9517.h"
+#ifdef X
+#include "h6471.h"
+#endif
+struct S2358 { int a; const char *s = "x//y"; };
+inline int f2358_0(int x) { return x * 0; }
+inline int f2358_1(int x) { return x * 1; }
+inline int f2358_2(int x) { return x * 2; }
+inline int f2358_3(int x) { return x * 3; }
+inline int f2358_4(int x) { return x * 4; }
+inline int f2358_5(int x) { return x * 5; }
+inline int f2358_6(int x) { return x * 6; }
+inline int f2358_7(int x) { return x * 7; }
+inline int f2358_8(int x) { return x * 8; }
+inline int f2358_9(int x) { return x * 9; }
+inline int f2358_10(int x) { return x * 10; }
+inline int f2358_11(int x) { return x * 11; }
+inline int f2358_12(int x) { return x * 12; }
+inline int f2358_13(int x) { return x * 13; }
+inline int f2358_14(int x) { return x * 14; }
+inline int f2358_15(int x) { return x * 15; }
+inline int f2358_16(int x) { return x * 16; }
+inline int f2358_17(int x) { return x * 17; }
+inline int f2358_18(int x) { return x * 18; }
+inline int f2358_19(int x) { return x * 19; }
+inline int f2358_20(int x) { return x * 20; }
+inline int f2358_21(int x) { return x * 21; }
+inline int f2358_22(int x) { return x * 22; }
+inline int f2358_23(int x) { return x * 23; }
+inline int f2358_24(int x) { return x * 24; }
+inline int f2358_25(int x) { return x * 25; }
+inline int f2358_26(int x) { return x * 26; }
+inline int f2358_27(int x) { return x * 27; }
+inline int f2358_28(int x) { return x * 28; }
+inline int f2358_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2359 */
+#include <vector>
+#include "h1568.h"
+#include "h412.h"
+#include "h2662.h"
+#include "h1758.h"
+#include "h4187.h"
+#ifdef X
+#include "h9233.h"
+#endif
+struct S2359 { int a; const char *s = "x//y"; };
+inline int f2359_0(int x) { return x * 0; }
+inline int f2359_1(int x) { return x * 1; }
+inline int f2359_2(int x) { return x * 2; }
+inline int f2359_3(int x) { return x * 3; }
+inline int f2359_4(int x) { return x * 4; }
+inline int f2359_5(int x) { return x * 5; }
+inline int f2359_6(int x) { return x * 6; }
+inline int f2359_7(int x) { return x * 7; }
+inline int f2359_8(int x) { return x * 8; }
+inline int f2359_9(int x) { return x * 9; }
+inline int f2359_10(int x) { return x * 10; }
+inline int f2359_11(int x) { return x * 11; }
+inline int f2359_12(int x) { return x * 12; }
+inline int f2359_13(int x) { return x * 13; }
+inline int f2359_14(int x) { return x * 14; }
+inline int f2359_15(int x) { return x * 15; }
+inline int f2359_16(int x) { return x * 16; }
+inline int f2359_17(int x) { return x * 17; }
+inline int f2359_18(int x) { return x * 18; }
+inline int f2359_19(int x) { return x * 19; }
+inline int f2359_20(int x) { return x * 20; }
+inline int f2359_21(int x) { return x * 21; }
+inline int f2359_22(int x) { return x * 22; }
+inline int f2359_23(int x) { return x * 23; }
+inline int f2359_24(int x) { return x * 24; }
+inline int f2359_25(int x) { return x * 25; }
+inline int f2359_26(int x) { return x * 26; }
+inline int f2359_27(int x) { return x * 27; }
+inline int f2359_28(int x) { return x * 28; }
+inline int f2359_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 236 */
+#include <vector>
+#include "h2878.h"
+#include "h5020.h"
+#include "h6348.h"
+#include "h2100.h"
+#include "h934.h"
+#ifdef X
+#include "h3772.h"
+#endif
+struct S236 { int a; const char *s = "x//y"; };
+inline int f236_0(int x) { return x * 0; }
+inline int f236_1(int x) { return x * 1; }
+inline int f236_2(int x) { return x * 2; }
+inline int f236_3(int x) { return x * 3; }
+inline int f236_4(int x) { return x * 4; }
+inline int f236_5(int x) { return x * 5; }
+inline int f236_6(int x) { return x * 6; }
+inline int f236_7(int x) { return x * 7; }
+inline int f236_8(int x) { return x * 8; }
+inline int f236_9(int x) { return x * 9; }
+inline int f236_10(int x) { return x * 10; }
+inline int f236_11(int x) { return x * 11; }
+inline int f236_12(int x) { return x * 12; }
+inline int f236_13(int x) { return x * 13; }
+inline int f236_14(int x) { return x * 14; }
+inline int f236_15(int x) { return x * 15; }
+inline int f236_16(int x) { return x * 16; }
+inline int f236_17(int x) { return x * 17; }
+inline int f236_18(int x) { return x * 18; }
+inline int f236_19(int x) { return x * 19; }
+inline int f236_20(int x) { return x * 20; }
+inline int f236_21(int x) { return x * 21; }
+inline int f236_22(int x) { return x * 22; }
+inline int f236_23(int x) { return x * 23; }
+inline int f236_24(int x) { return x * 24; }
+inline int f236_25(int x) { return x * 25; }
+inline int f236_26(int x) { return x * 26; }
+inline int f236_27(int x) { return x * 27; }
+inline int f236_28(int x) { return x * 28; }
+inline int f236_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2360 */
+#include <vector>
+#include "h8578.h"
+#include "h3288.h"
+#include "h9706.h"
+#include "h707.h"
+#include "h8279.h"
+#ifdef X
+#include "h8209.h"
+#endif
+struct S2360 { int a; const char *s = "x//y"; };
+inline int f2360_0(int x) { return x * 0; }
+inline int f2360_1(int x) { return x * 1; }
+inline int f2360_2(int x) { return x * 2; }
+inline int f2360_3(int x) { return x * 3; }
+inline int f2360_4(int x) { return x * 4; }
+inline int f2360_5(int x) { return x * 5; }
+inline int f2360_6(int x) { return x * 6; }
+inline int f2360_7(int x) { return x * 7; }
+inline int f2360_8(int x) { return x * 8; }
+inline int f2360_9(int x) { return x * 9; }
+inline int f2360_10(int x) { return x * 10; }
+inline int f2360_11(int x) { return x * 11; }
+inline int f2360_12(int x) { return x * 12; }
+inline int f2360_13(int x) { return x * 13; }
+inline int f2360_14(int x) { return x * 14; }
+inline int f2360_15(int x) { return x * 15; }
+inline int f2360_16(int x) { return x * 16; }
+inline int f2360_17(int x) { return x * 17; }
+inline int f2360_18(int x) { return x * 18; }
+inline int f2360_19(int x) { return x * 19; }
+inline int f2360_20(int x) { return x * 20; }
+inline int f2360_21(int x) { return x * 21; }
+inline int f2360_22(int x) { return x * 22; }
+inline int f2360_23(int x) { return x * 23; }
+inline int f2360_24(int x) { return x * 24; }
+inline int f2360_25(int x) { return x * 25; }
+inline int f2360_26(int x) { return x * 26; }
+inline int f2360_27(int x) { return x * 27; }
+inline int f2360_28(int x) { return x * 28; }
+inline int f2360_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2363 */
+#include <vector>
+#include "h5259.h"
+#include "h2067.h"
+#include "h2739.h"
+#include "h5929.h"
+#include "h4779.h"
+#ifdef X
+#include "h7362.h"
+#endif
+struct S2363 { int a; const char *s = "x//y"; };
+inline int f2363_0(int x) { return x * 0; }
+inline int f2363_1(int x) { return x * 1; }
+inline int f2363_2(int x) { return x * 2; }
+inline int f2363_3(int x) { return x * 3; }
+inline int f2363_4(int x) { return x * 4; }
+inline int f2363_5(int x) { return x * 5; }
+inline int f2363_6(int x) { return x * 6; }
+inline int f2363_7(int x) { return x * 7; }
+inline int f2363_8(int x) { return x * 8; }
+inline int f2363_9(int x) { return x * 9; }
+inline int f2363_10(int x) { return x * 10; }
+inline int f2363_11(int x) { return x * 11; }
+inline int f2363_12(int x) { return x * 12; }
+inline int f2363_13(int x) { return x * 13; }
+inline int f2363_14(int x) { return x * 14; }
+inline int f2363_15(int x) { return x * 15; }
+inline int f2363_16(int x) { return x * 16; }
+inline int f2363_17(int x) { return x * 17; }
+inline int f2363_18(int x) { return x * 18; }
+inline int f2363_19(int x) { return x * 19; }
+inline int f2363_20(int x) { return x * 20; }
+inline int f2363_21(int x) { return x * 21; }
+inline int f2363_22(int x) { return x * 22; }
+inline int f2363_23(int x) { return x * 23; }
+inline int f2363_24(int x) { return x * 24; }
+inline int f2363_25(int x) { return x * 25; }
+inline int f2363_26(int x) { return x * 26; }
+inline int f2363_27(int x) { return x * 27; }
+inline int f2363_28(int x) { return x * 28; }
+inline int f2363_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2364 */
+#include <vector>
+#include "h7884.h"
+#include "h2743.h"
+#include "h4304.h"
+#include "h4627.h"
+#include "h9931.h"
+#ifdef X
+#include "h5406.h"
+#endif
+struct S2364 { int a; const char *s = "x//y"; };
+inline int f2364_0(int x) { return x * 0; }
+inline int f2364_1(int x) { return x * 1; }
+inline int f2364_2(int x) { return x * 2; }
+inline int f2364_3(int x) { return x * 3; }
+inline int f2364_4(int x) { return x * 4; }
+inline int f2364_5(int x) { return x * 5; }
+inline int f2364_6(int x) { return x * 6; }
+inline int f2364_7(int x) { return x * 7; }
+inline int f2364_8(int x) { return x * 8; }
+inline int f2364_9(int x) { return x * 9; }
+inline int f2364_10(int x) { return x * 10; }
+inline int f2364_11(int x) { return x * 11; }
+inline int f2364_12(int x) { return x * 12; }
+inline int f2364_13(int x) { return x * 13; }
+inline int f2364_14(int x) { return x * 14; }
+inline int f2364_15(int x) { return x * 15; }
+inline int f2364_16(int x) { return x * 16; }
+inline int f2364_17(int x) { return x * 17; }
+inline int f2364_18(int x) { return x * 18; }
+inline int f2364_19(int x) { return x * 19; }
+inline int f2364_20(int x) { return x * 20; }
+inline int f2364_21(int x) { return x * 21; }
+inline int f2364_22(int x) { return x * 22; }
+inline int f2364_23(int x) { return x * 23; }
+inline int f2364_24(int x) { return x * 24; }
+inline int f2364_25(int x) { return x * 25; }
+inline int f2364_26(int x) { return x * 26; }
+inline int f2364_27(int x) { return x * 27; }
+inline int f2364_28(int x) { return x * 28; }
+inline int f2364_29(int x) { return x * 29; }
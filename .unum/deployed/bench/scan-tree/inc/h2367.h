@@ -0,0 +1,42 @@
+#pragma once
+/* header 2367 */
+#include <vector>
+#include "h7664.h"
+#include "h4441.h"
+#include "h1650.h"
+#include "h4769.h"
+#include "h6102.h"
+#ifdef X
+#include "h1205.h"
+#endif
+struct S2367 { int a; const char *s = "x//y"; };
+inline int f2367_0(int x) { return x * 0; }
+inline int f2367_1(int x) { return x * 1; }
+inline int f2367_2(int x) { return x * 2; }
+inline int f2367_3(int x) { return x * 3; }
+inline int f2367_4(int x) { return x * 4; }
+inline int f2367_5(int x) { return x * 5; }
+inline int f2367_6(int x) { return x * 6; }
+inline int f2367_7(int x) { return x * 7; }
+inline int f2367_8(int x) { return x * 8; }
+inline int f2367_9(int x) { return x * 9; }
+inline int f2367_10(int x) { return x * 10; }
+inline int f2367_11(int x) { return x * 11; }
+inline int f2367_12(int x) { return x * 12; }
+inline int f2367_13(int x) { return x * 13; }
+inline int f2367_14(int x) { return x * 14; }
+inline int f2367_15(int x) { return x * 15; }
+inline int f2367_16(int x) { return x * 16; }
+inline int f2367_17(int x) { return x * 17; }
+inline int f2367_18(int x) { return x * 18; }
+inline int f2367_19(int x) { return x * 19; }
+inline int f2367_20(int x) { return x * 20; }
+inline int f2367_21(int x) { return x * 21; }
+inline int f2367_22(int x) { return x * 22; }
+inline int f2367_23(int x) { return x * 23; }
+inline int f2367_24(int x) { return x * 24; }
+inline int f2367_25(int x) { return x * 25; }
+inline int f2367_26(int x) { return x * 26; }
+inline int f2367_27(int x) { return x * 27; }
+inline int f2367_28(int x) { return x * 28; }
+inline int f2367_29(int x) { return x * 29; }
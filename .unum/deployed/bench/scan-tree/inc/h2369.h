@@ -0,0 +1,42 @@
+#pragma once
+/* header 2369 */
+#include <vector>
+#include "h9445.h"
+#include "h79.h"
+#include "h1144.h"
+#include "h9091.h"
+#include "h8264.h"
+#ifdef X
+#include "h5116.h"
+#endif
+struct S2369 { int a; const char *s = "x//y"; };
+inline int f2369_0(int x) { return x * 0; }
+inline int f2369_1(int x) { return x * 1; }
+inline int f2369_2(int x) { return x * 2; }
+inline int f2369_3(int x) { return x * 3; }
+inline int f2369_4(int x) { return x * 4; }
+inline int f2369_5(int x) { return x * 5; }
+inline int f2369_6(int x) { return x * 6; }
+inline int f2369_7(int x) { return x * 7; }
+inline int f2369_8(int x) { return x * 8; }
+inline int f2369_9(int x) { return x * 9; }
+inline int f2369_10(int x) { return x * 10; }
+inline int f2369_11(int x) { return x * 11; }
+inline int f2369_12(int x) { return x * 12; }
+inline int f2369_13(int x) { return x * 13; }
+inline int f2369_14(int x) { return x * 14; }
+inline int f2369_15(int x) { return x * 15; }
+inline int f2369_16(int x) { return x * 16; }
+inline int f2369_17(int x) { return x * 17; }
+inline int f2369_18(int x) { return x * 18; }
+inline int f2369_19(int x) { return x * 19; }
+inline int f2369_20(int x) { return x * 20; }
+inline int f2369_21(int x) { return x * 21; }
+inline int f2369_22(int x) { return x * 22; }
+inline int f2369_23(int x) { return x * 23; }
+inline int f2369_24(int x) { return x * 24; }
+inline int f2369_25(int x) { return x * 25; }
+inline int f2369_26(int x) { return x * 26; }
+inline int f2369_27(int x) { return x * 27; }
+inline int f2369_28(int x) { return x * 28; }
+inline int f2369_29(int x) { return x * 29; }
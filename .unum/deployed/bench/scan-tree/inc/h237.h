@@ -0,0 +1,42 @@
+#pragma once
+/* header 237 */
+#include <vector>
+#include "h2686.h"
+#include "h8255.h"
+#include "h3147.h"
+#include "h8623.h"
+#include "h1827.h"
+#ifdef X
+#include "h7880.h"
+#endif
+struct S237 { int a; const char *s = "x//y"; };
+inline int f237_0(int x) { return x * 0; }
+inline int f237_1(int x) { return x * 1; }
+inline int f237_2(int x) { return x * 2; }
+inline int f237_3(int x) { return x * 3; }
+inline int f237_4(int x) { return x * 4; }
+inline int f237_5(int x) { return x * 5; }
+inline int f237_6(int x) { return x * 6; }
+inline int f237_7(int x) { return x * 7; }
+inline int f237_8(int x) { return x * 8; }
+inline int f237_9(int x) { return x * 9; }
+inline int f237_10(int x) { return x * 10; }
+inline int f237_11(int x) { return x * 11; }
+inline int f237_12(int x) { return x * 12; }
+inline int f237_13(int x) { return x * 13; }
+inline int f237_14(int x) { return x * 14; }
+inline int f237_15(int x) { return x * 15; }
+inline int f237_16(int x) { return x * 16; }
+inline int f237_17(int x) { return x * 17; }
+inline int f237_18(int x) { return x * 18; }
+inline int f237_19(int x) { return x * 19; }
+inline int f237_20(int x) { return x * 20; }
+inline int f237_21(int x) { return x * 21; }
+inline int f237_22(int x) { return x * 22; }
+inline int f237_23(int x) { return x * 23; }
+inline int f237_24(int x) { return x * 24; }
+inline int f237_25(int x) { return x * 25; }
+inline int f237_26(int x) { return x * 26; }
+inline int f237_27(int x) { return x * 27; }
+inline int f237_28(int x) { return x * 28; }
+inline int f237_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2370 */
+#include <vector>
+#include "h4238.h"
+#include "h5837.h"
+#include "h9365.h"
+#include "h8825.h"
+#include "h4832.h"
+#ifdef X
+#include "h680.h"
+#endif
+struct S2370 { int a; const char *s = "x//y"; };
+inline int f2370_0(int x) { return x * 0; }
+inline int f2370_1(int x) { return x * 1; }
+inline int f2370_2(int x) { return x * 2; }
+inline int f2370_3(int x) { return x * 3; }
+inline int f2370_4(int x) { return x * 4; }
+inline int f2370_5(int x) { return x * 5; }
+inline int f2370_6(int x) { return x * 6; }
+inline int f2370_7(int x) { return x * 7; }
+inline int f2370_8(int x) { return x * 8; }
+inline int f2370_9(int x) { return x * 9; }
+inline int f2370_10(int x) { return x * 10; }
+inline int f2370_11(int x) { return x * 11; }
+inline int f2370_12(int x) { return x * 12; }
+inline int f2370_13(int x) { return x * 13; }
+inline int f2370_14(int x) { return x * 14; }
+inline int f2370_15(int x) { return x * 15; }
+inline int f2370_16(int x) { return x * 16; }
+inline int f2370_17(int x) { return x * 17; }
+inline int f2370_18(int x) { return x * 18; }
+inline int f2370_19(int x) { return x * 19; }
+inline int f2370_20(int x) { return x * 20; }
+inline int f2370_21(int x) { return x * 21; }
+inline int f2370_22(int x) { return x * 22; }
+inline int f2370_23(int x) { return x * 23; }
+inline int f2370_24(int x) { return x * 24; }
+inline int f2370_25(int x) { return x * 25; }
+inline int f2370_26(int x) { return x * 26; }
+inline int f2370_27(int x) { return x * 27; }
+inline int f2370_28(int x) { return x * 28; }
+inline int f2370_29(int x) { return x * 29; }
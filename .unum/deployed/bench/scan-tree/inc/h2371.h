@@ -0,0 +1,42 @@
+#pragma once
+/* header 2371 */
+#include <vector>
+#include "h6511.h"
+#include "h8516.h"
+#include "h9329.h"
+#include "h7444.h"
+#include "h3905.h"
+#ifdef X
+#include "h3046.h"
+#endif
+struct S2371 { int a; const char *s = "x//y"; };
+inline int f2371_0(int x) { return x * 0; }
+inline int f2371_1(int x) { return x * 1; }
+inline int f2371_2(int x) { return x * 2; }
+inline int f2371_3(int x) { return x * 3; }
+inline int f2371_4(int x) { return x * 4; }
+inline int f2371_5(int x) { return x * 5; }
+inline int f2371_6(int x) { return x * 6; }
+inline int f2371_7(int x) { return x * 7; }
+inline int f2371_8(int x) { return x * 8; }
+inline int f2371_9(int x) { return x * 9; }
+inline int f2371_10(int x) { return x * 10; }
+inline int f2371_11(int x) { return x * 11; }
+inline int f2371_12(int x) { return x * 12; }
+inline int f2371_13(int x) { return x * 13; }
+inline int f2371_14(int x) { return x * 14; }
+inline int f2371_15(int x) { return x * 15; }
+inline int f2371_16(int x) { return x * 16; }
+inline int f2371_17(int x) { return x * 17; }
+inline int f2371_18(int x) { return x * 18; }
+inline int f2371_19(int x) { return x * 19; }
+inline int f2371_20(int x) { return x * 20; }
+inline int f2371_21(int x) { return x * 21; }
+inline int f2371_22(int x) { return x * 22; }
+inline int f2371_23(int x) { return x * 23; }
+inline int f2371_24(int x) { return x * 24; }
+inline int f2371_25(int x) { return x * 25; }
+inline int f2371_26(int x) { return x * 26; }
+inline int f2371_27(int x) { return x * 27; }
+inline int f2371_28(int x) { return x * 28; }
+inline int f2371_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2372 */
+#include <vector>
+#include "h2876.h"
+#include "h2882.h"
+#include "h3899.h"
+#include "h7833.h"
+#include "h3695.h"
+#ifdef X
+#include "h5949.h"
+#endif
+struct S2372 { int a; const char *s = "x//y"; };
+inline int f2372_0(int x) { return x * 0; }
+inline int f2372_1(int x) { return x * 1; }
+inline int f2372_2(int x) { return x * 2; }
+inline int f2372_3(int x) { return x * 3; }
+inline int f2372_4(int x) { return x * 4; }
+inline int f2372_5(int x) { return x * 5; }
+inline int f2372_6(int x) { return x * 6; }
+inline int f2372_7(int x) { return x * 7; }
+inline int f2372_8(int x) { return x * 8; }
+inline int f2372_9(int x) { return x * 9; }
+inline int f2372_10(int x) { return x * 10; }
+inline int f2372_11(int x) { return x * 11; }
+inline int f2372_12(int x) { return x * 12; }
+inline int f2372_13(int x) { return x * 13; }
+inline int f2372_14(int x) { return x * 14; }
+inline int f2372_15(int x) { return x * 15; }
+inline int f2372_16(int x) { return x * 16; }
+inline int f2372_17(int x) { return x * 17; }
+inline int f2372_18(int x) { return x * 18; }
+inline int f2372_19(int x) { return x * 19; }
+inline int f2372_20(int x) { return x * 20; }
+inline int f2372_21(int x) { return x * 21; }
+inline int f2372_22(int x) { return x * 22; }
+inline int f2372_23(int x) { return x * 23; }
+inline int f2372_24(int x) { return x * 24; }
+inline int f2372_25(int x) { return x * 25; }
+inline int f2372_26(int x) { return x * 26; }
+inline int f2372_27(int x) { return x * 27; }
+inline int f2372_28(int x) { return x * 28; }
+inline int f2372_29(int x) { return x * 29; }
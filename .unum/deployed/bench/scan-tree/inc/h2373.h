@@ -0,0 +1,42 @@
+#pragma once
+/* header 2373 */
+#include <vector>
+#include "h1169.h"
+#include "h7788.h"
+#include "h5790.h"
+#include "h1825.h"
+#include "h9804.h"
+#ifdef X
+#include "h237.h"
+#endif
+struct S2373 { int a; const char *s = "x//y"; };
+inline int f2373_0(int x) { return x * 0; }
+inline int f2373_1(int x) { return x * 1; }
+inline int f2373_2(int x) { return x * 2; }
+inline int f2373_3(int x) { return x * 3; }
+inline int f2373_4(int x) { return x * 4; }
+inline int f2373_5(int x) { return x * 5; }
+inline int f2373_6(int x) { return x * 6; }
+inline int f2373_7(int x) { return x * 7; }
+inline int f2373_8(int x) { return x * 8; }
+inline int f2373_9(int x) { return x * 9; }
+inline int f2373_10(int x) { return x * 10; }
+inline int f2373_11(int x) { return x * 11; }
+inline int f2373_12(int x) { return x * 12; }
+inline int f2373_13(int x) { return x * 13; }
+inline int f2373_14(int x) { return x * 14; }
+inline int f2373_15(int x) { return x * 15; }
+inline int f2373_16(int x) { return x * 16; }
+inline int f2373_17(int x) { return x * 17; }
+inline int f2373_18(int x) { return x * 18; }
+inline int f2373_19(int x) { return x * 19; }
+inline int f2373_20(int x) { return x * 20; }
+inline int f2373_21(int x) { return x * 21; }
+inline int f2373_22(int x) { return x * 22; }
+inline int f2373_23(int x) { return x * 23; }
+inline int f2373_24(int x) { return x * 24; }
+inline int f2373_25(int x) { return x * 25; }
+inline int f2373_26(int x) { return x * 26; }
+inline int f2373_27(int x) { return x * 27; }
+inline int f2373_28(int x) { return x * 28; }
+inline int f2373_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2374 */
+#include <vector>
+#include "h8884.h"
+#include "h4.h"
+#include "h4587.h"
+#include "h2842.h"
+#include "h9543.h"
+#ifdef X
+#include "h3399.h"
+#endif
+struct S2374 { int a; const char *s = "x//y"; };
+inline int f2374_0(int x) { return x * 0; }
+inline int f2374_1(int x) { return x * 1; }
+inline int f2374_2(int x) { return x * 2; }
+inline int f2374_3(int x) { return x * 3; }
+inline int f2374_4(int x) { return x * 4; }
+inline int f2374_5(int x) { return x * 5; }
+inline int f2374_6(int x) { return x * 6; }
+inline int f2374_7(int x) { return x * 7; }
+inline int f2374_8(int x) { return x * 8; }
+inline int f2374_9(int x) { return x * 9; }
+inline int f2374_10(int x) { return x * 10; }
+inline int f2374_11(int x) { return x * 11; }
+inline int f2374_12(int x) { return x * 12; }
+inline int f2374_13(int x) { return x * 13; }
+inline int f2374_14(int x) { return x * 14; }
+inline int f2374_15(int x) { return x * 15; }
+inline int f2374_16(int x) { return x * 16; }
+inline int f2374_17(int x) { return x * 17; }
+inline int f2374_18(int x) { return x * 18; }
+inline int f2374_19(int x) { return x * 19; }
+inline int f2374_20(int x) { return x * 20; }
+inline int f2374_21(int x) { return x * 21; }
+inline int f2374_22(int x) { return x * 22; }
+inline int f2374_23(int x) { return x * 23; }
+inline int f2374_24(int x) { return x * 24; }
+inline int f2374_25(int x) { return x * 25; }
+inline int f2374_26(int x) { return x * 26; }
+inline int f2374_27(int x) { return x * 27; }
+inline int f2374_28(int x) { return x * 28; }
+inline int f2374_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2379 */
+#include <vector>
+#include "h1696.h"
+#include "h7484.h"
+#include "h872.h"
+#include "h1668.h"
+#include "h7384.h"
+#ifdef X
+#include "h1214.h"
+#endif
+struct S2379 { int a; const char *s = "x//y"; };
+inline int f2379_0(int x) { return x * 0; }
+inline int f2379_1(int x) { return x * 1; }
+inline int f2379_2(int x) { return x * 2; }
+inline int f2379_3(int x) { return x * 3; }
+inline int f2379_4(int x) { return x * 4; }
+inline int f2379_5(int x) { return x * 5; }
+inline int f2379_6(int x) { return x * 6; }
+inline int f2379_7(int x) { return x * 7; }
+inline int f2379_8(int x) { return x * 8; }
+inline int f2379_9(int x) { return x * 9; }
+inline int f2379_10(int x) { return x * 10; }
+inline int f2379_11(int x) { return x * 11; }
+inline int f2379_12(int x) { return x * 12; }
+inline int f2379_13(int x) { return x * 13; }
+inline int f2379_14(int x) { return x * 14; }
+inline int f2379_15(int x) { return x * 15; }
+inline int f2379_16(int x) { return x * 16; }
+inline int f2379_17(int x) { return x * 17; }
+inline int f2379_18(int x) { return x * 18; }
+inline int f2379_19(int x) { return x * 19; }
+inline int f2379_20(int x) { return x * 20; }
+inline int f2379_21(int x) { return x * 21; }
+inline int f2379_22(int x) { return x * 22; }
+inline int f2379_23(int x) { return x * 23; }
+inline int f2379_24(int x) { return x * 24; }
+inline int f2379_25(int x) { return x * 25; }
+inline int f2379_26(int x) { return x * 26; }
+inline int f2379_27(int x) { return x * 27; }
+inline int f2379_28(int x) { return x * 28; }
+inline int f2379_29(int x) { return x * 29; }
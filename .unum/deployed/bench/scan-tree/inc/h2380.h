@@ -0,0 +1,42 @@
+#pragma once
+/* header 2380 */
+#include <vector>
+#include "h5643.h"
+#include "h1505.h"
+#include "h1507.h"
+#include "h5435.h"
+#include "h7802.h"
+#ifdef X
+#include "h6249.h"
+#endif
+struct S2380 { int a; const char *s = "x//y"; };
+inline int f2380_0(int x) { return x * 0; }
+inline int f2380_1(int x) { return x * 1; }
+inline int f2380_2(int x) { return x * 2; }
+inline int f2380_3(int x) { return x * 3; }
+inline int f2380_4(int x) { return x * 4; }
+inline int f2380_5(int x) { return x * 5; }
+inline int f2380_6(int x) { return x * 6; }
+inline int f2380_7(int x) { return x * 7; }
+inline int f2380_8(int x) { return x * 8; }
+inline int f2380_9(int x) { return x * 9; }
+inline int f2380_10(int x) { return x * 10; }
+inline int f2380_11(int x) { return x * 11; }
+inline int f2380_12(int x) { return x * 12; }
+inline int f2380_13(int x) { return x * 13; }
+inline int f2380_14(int x) { return x * 14; }
+inline int f2380_15(int x) { return x * 15; }
+inline int f2380_16(int x) { return x * 16; }
+inline int f2380_17(int x) { return x * 17; }
+inline int f2380_18(int x) { return x * 18; }
+inline int f2380_19(int x) { return x * 19; }
+inline int f2380_20(int x) { return x * 20; }
+inline int f2380_21(int x) { return x * 21; }
+inline int f2380_22(int x) { return x * 22; }
+inline int f2380_23(int x) { return x * 23; }
+inline int f2380_24(int x) { return x * 24; }
+inline int f2380_25(int x) { return x * 25; }
+inline int f2380_26(int x) { return x * 26; }
+inline int f2380_27(int x) { return x * 27; }
+inline int f2380_28(int x) { return x * 28; }
+inline int f2380_29(int x) { return x * 29; }
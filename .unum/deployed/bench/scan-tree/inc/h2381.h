@@ -0,0 +1,42 @@
+#pragma once
+/* header 2381 */
+#include <vector>
+#include "h3337.h"
+#include "h901.h"
+#include "h9584.h"
+#include "h1510.h"
+#include "h8382.h"
+#ifdef X
+#include "h4405.h"
+#endif
+struct S2381 { int a; const char *s = "x//y"; };
+inline int f2381_0(int x) { return x * 0; }
+inline int f2381_1(int x) { return x * 1; }
+inline int f2381_2(int x) { return x * 2; }
+inline int f2381_3(int x) { return x * 3; }
+inline int f2381_4(int x) { return x * 4; }
+inline int f2381_5(int x) { return x * 5; }
+inline int f2381_6(int x) { return x * 6; }
+inline int f2381_7(int x) { return x * 7; }
+inline int f2381_8(int x) { return x * 8; }
+inline int f2381_9(int x) { return x * 9; }
+inline int f2381_10(int x) { return x * 10; }
+inline int f2381_11(int x) { return x * 11; }
+inline int f2381_12(int x) { return x * 12; }
+inline int f2381_13(int x) { return x * 13; }
+inline int f2381_14(int x) { return x * 14; }
+inline int f2381_15(int x) { return x * 15; }
+inline int f2381_16(int x) { return x * 16; }
+inline int f2381_17(int x) { return x * 17; }
+inline int f2381_18(int x) { return x * 18; }
+inline int f2381_19(int x) { return x * 19; }
+inline int f2381_20(int x) { return x * 20; }
+inline int f2381_21(int x) { return x * 21; }
+inline int f2381_22(int x) { return x * 22; }
+inline int f2381_23(int x) { return x * 23; }
+inline int f2381_24(int x) { return x * 24; }
+inline int f2381_25(int x) { return x * 25; }
+inline int f2381_26(int x) { return x * 26; }
+inline int f2381_27(int x) { return x * 27; }
+inline int f2381_28(int x) { return x * 28; }
+inline int f2381_29(int x) { return x * 29; }
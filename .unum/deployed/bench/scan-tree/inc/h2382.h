@@ -0,0 +1,42 @@
+#pragma once
+/* header 2382 */
+#include <vector>
+#include "h8873.h"
+#include "h9811.h"
+#include "h9867.h"
+#include "h4304.h"
+#include "h5607.h"
+#ifdef X
+#include "h6123.h"
+#endif
+struct S2382 { int a; const char *s = "x//y"; };
+inline int f2382_0(int x) { return x * 0; }
+inline int f2382_1(int x) { return x * 1; }
+inline int f2382_2(int x) { return x * 2; }
+inline int f2382_3(int x) { return x * 3; }
+inline int f2382_4(int x) { return x * 4; }
+inline int f2382_5(int x) { return x * 5; }
+inline int f2382_6(int x) { return x * 6; }
+inline int f2382_7(int x) { return x * 7; }
+inline int f2382_8(int x) { return x * 8; }
+inline int f2382_9(int x) { return x * 9; }
+inline int f2382_10(int x) { return x * 10; }
+inline int f2382_11(int x) { return x * 11; }
+inline int f2382_12(int x) { return x * 12; }
+inline int f2382_13(int x) { return x * 13; }
+inline int f2382_14(int x) { return x * 14; }
+inline int f2382_15(int x) { return x * 15; }
+inline int f2382_16(int x) { return x * 16; }
+inline int f2382_17(int x) { return x * 17; }
+inline int f2382_18(int x) { return x * 18; }
+inline int f2382_19(int x) { return x * 19; }
+inline int f2382_20(int x) { return x * 20; }
+inline int f2382_21(int x) { return x * 21; }
+inline int f2382_22(int x) { return x * 22; }
+inline int f2382_23(int x) { return x * 23; }
+inline int f2382_24(int x) { return x * 24; }
+inline int f2382_25(int x) { return x * 25; }
+inline int f2382_26(int x) { return x * 26; }
+inline int f2382_27(int x) { return x * 27; }
+inline int f2382_28(int x) { return x * 28; }
+inline int f2382_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2385 */
+#include <vector>
+#include "h3580.h"
+#include "h4483.h"
+#include "h2438.h"
+#include "h9413.h"
+#include "h8597.h"
+#ifdef X
+#include "h7039.h"
+#endif
+struct S2385 { int a; const char *s = "x//y"; };
+inline int f2385_0(int x) { return x * 0; }
+inline int f2385_1(int x) { return x * 1; }
+inline int f2385_2(int x) { return x * 2; }
+inline int f2385_3(int x) { return x * 3; }
+inline int f2385_4(int x) { return x * 4; }
+inline int f2385_5(int x) { return x * 5; }
+inline int f2385_6(int x) { return x * 6; }
+inline int f2385_7(int x) { return x * 7; }
+inline int f2385_8(int x) { return x * 8; }
+inline int f2385_9(int x) { return x * 9; }
+inline int f2385_10(int x) { return x * 10; }
+inline int f2385_11(int x) { return x * 11; }
+inline int f2385_12(int x) { return x * 12; }
+inline int f2385_13(int x) { return x * 13; }
+inline int f2385_14(int x) { return x * 14; }
+inline int f2385_15(int x) { return x * 15; }
+inline int f2385_16(int x) { return x * 16; }
+inline int f2385_17(int x) { return x * 17; }
+inline int f2385_18(int x) { return x * 18; }
+inline int f2385_19(int x) { return x * 19; }
+inline int f2385_20(int x) { return x * 20; }
+inline int f2385_21(int x) { return x * 21; }
+inline int f2385_22(int x) { return x * 22; }
+inline int f2385_23(int x) { return x * 23; }
+inline int f2385_24(int x) { return x * 24; }
+inline int f2385_25(int x) { return x * 25; }
+inline int f2385_26(int x) { return x * 26; }
+inline int f2385_27(int x) { return x * 27; }
+inline int f2385_28(int x) { return x * 28; }
+inline int f2385_29(int x) { return x * 29; }
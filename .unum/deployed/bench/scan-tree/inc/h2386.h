@@ -0,0 +1,42 @@
+#pragma once
+/* header 2386 */
+#include <vector>
+#include "h960.h"
+#include "h3341.h"
+#include "h3514.h"
+#include "h8225.h"
+#include "h1753.h"
+#ifdef X
+#include "h5266.h"
+#endif
+struct S2386 { int a; const char *s = "x//y"; };
+inline int f2386_0(int x) { return x * 0; }
+inline int f2386_1(int x) { return x * 1; }
+inline int f2386_2(int x) { return x * 2; }
+inline int f2386_3(int x) { return x * 3; }
+inline int f2386_4(int x) { return x * 4; }
+inline int f2386_5(int x) { return x * 5; }
+inline int f2386_6(int x) { return x * 6; }
+inline int f2386_7(int x) { return x * 7; }
+inline int f2386_8(int x) { return x * 8; }
+inline int f2386_9(int x) { return x * 9; }
+inline int f2386_10(int x) { return x * 10; }
+inline int f2386_11(int x) { return x * 11; }
+inline int f2386_12(int x) { return x * 12; }
+inline int f2386_13(int x) { return x * 13; }
+inline int f2386_14(int x) { return x * 14; }
+inline int f2386_15(int x) { return x * 15; }
+inline int f2386_16(int x) { return x * 16; }
+inline int f2386_17(int x) { return x * 17; }
+inline int f2386_18(int x) { return x * 18; }
+inline int f2386_19(int x) { return x * 19; }
+inline int f2386_20(int x) { return x * 20; }
+inline int f2386_21(int x) { return x * 21; }
+inline int f2386_22(int x) { return x * 22; }
+inline int f2386_23(int x) { return x * 23; }
+inline int f2386_24(int x) { return x * 24; }
+inline int f2386_25(int x) { return x * 25; }
+inline int f2386_26(int x) { return x * 26; }
+inline int f2386_27(int x) { return x * 27; }
+inline int f2386_28(int x) { return x * 28; }
+inline int f2386_29(int x) { return x * 29; }
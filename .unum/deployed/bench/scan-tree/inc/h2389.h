@@ -0,0 +1,42 @@
+#pragma once
+/* header 2389 */
+#include <vector>
+#include "h4330.h"
+#include "h9001.h"
+#include "h873.h"
+#include "h4391.h"
+#include "h5737.h"
+#ifdef X
+#include "h7120.h"
+#endif
+struct S2389 { int a; const char *s = "x//y"; };
+inline int f2389_0(int x) { return x * 0; }
+inline int f2389_1(int x) { return x * 1; }
+inline int f2389_2(int x) { return x * 2; }
+inline int f2389_3(int x) { return x * 3; }
+inline int f2389_4(int x) { return x * 4; }
+inline int f2389_5(int x) { return x * 5; }
+inline int f2389_6(int x) { return x * 6; }
+inline int f2389_7(int x) { return x * 7; }
+inline int f2389_8(int x) { return x * 8; }
+inline int f2389_9(int x) { return x * 9; }
+inline int f2389_10(int x) { return x * 10; }
+inline int f2389_11(int x) { return x * 11; }
+inline int f2389_12(int x) { return x * 12; }
+inline int f2389_13(int x) { return x * 13; }
+inline int f2389_14(int x) { return x * 14; }
+inline int f2389_15(int x) { return x * 15; }
+inline int f2389_16(int x) { return x * 16; }
+inline int f2389_17(int x) { return x * 17; }
+inline int f2389_18(int x) { return x * 18; }
+inline int f2389_19(int x) { return x * 19; }
+inline int f2389_20(int x) { return x * 20; }
+inline int f2389_21(int x) { return x * 21; }
+inline int f2389_22(int x) { return x * 22; }
+inline int f2389_23(int x) { return x * 23; }
+inline int f2389_24(int x) { return x * 24; }
+inline int f2389_25(int x) { return x * 25; }
+inline int f2389_26(int x) { return x * 26; }
+inline int f2389_27(int x) { return x * 27; }
+inline int f2389_28(int x) { return x * 28; }
+inline int f2389_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2390 */
+#include <vector>
+#include "h4073.h"
+#include "h1955.h"
+#include "h8007.h"
+#include "h7393.h"
+#include "h706.h"
+#ifdef X
+#include "h6495.h"
+#endif
+struct S2390 { int a; const char *s = "x//y"; };
+inline int f2390_0(int x) { return x * 0; }
+inline int f2390_1(int x) { return x * 1; }
+inline int f2390_2(int x) { return x * 2; }
+inline int f2390_3(int x) { return x * 3; }
+inline int f2390_4(int x) { return x * 4; }
+inline int f2390_5(int x) { return x * 5; }
+inline int f2390_6(int x) { return x * 6; }
+inline int f2390_7(int x) { return x * 7; }
+inline int f2390_8(int x) { return x * 8; }
+inline int f2390_9(int x) { return x * 9; }
+inline int f2390_10(int x) { return x * 10; }
+inline int f2390_11(int x) { return x * 11; }
+inline int f2390_12(int x) { return x * 12; }
+inline int f2390_13(int x) { return x * 13; }
+inline int f2390_14(int x) { return x * 14; }
+inline int f2390_15(int x) { return x * 15; }
+inline int f2390_16(int x) { return x * 16; }
+inline int f2390_17(int x) { return x * 17; }
+inline int f2390_18(int x) { return x * 18; }
+inline int f2390_19(int x) { return x * 19; }
+inline int f2390_20(int x) { return x * 20; }
+inline int f2390_21(int x) { return x * 21; }
+inline int f2390_22(int x) { return x * 22; }
+inline int f2390_23(int x) { return x * 23; }
+inline int f2390_24(int x) { return x * 24; }
+inline int f2390_25(int x) { return x * 25; }
+inline int f2390_26(int x) { return x * 26; }
+inline int f2390_27(int x) { return x * 27; }
+inline int f2390_28(int x) { return x * 28; }
+inline int f2390_29(int x) { return x * 29; }
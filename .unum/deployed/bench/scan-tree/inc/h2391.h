@@ -0,0 +1,42 @@
+#pragma once
+/* header 2391 */
+#include <vector>
+#include "h6058.h"
+#include "h6324.h"
+#include "h8710.h"
+#include "h3582.h"
+#include "h1906.h"
+#ifdef X
+#include "h916.h"
+#endif
+struct S2391 { int a; const char *s = "x//y"; };
+inline int f2391_0(int x) { return x * 0; }
+inline int f2391_1(int x) { return x * 1; }
+inline int f2391_2(int x) { return x * 2; }
+inline int f2391_3(int x) { return x * 3; }
+inline int f2391_4(int x) { return x * 4; }
+inline int f2391_5(int x) { return x * 5; }
+inline int f2391_6(int x) { return x * 6; }
+inline int f2391_7(int x) { return x * 7; }
+inline int f2391_8(int x) { return x * 8; }
+inline int f2391_9(int x) { return x * 9; }
+inline int f2391_10(int x) { return x * 10; }
+inline int f2391_11(int x) { return x * 11; }
+inline int f2391_12(int x) { return x * 12; }
+inline int f2391_13(int x) { return x * 13; }
+inline int f2391_14(int x) { return x * 14; }
+inline int f2391_15(int x) { return x * 15; }
+inline int f2391_16(int x) { return x * 16; }
+inline int f2391_17(int x) { return x * 17; }
+inline int f2391_18(int x) { return x * 18; }
+inline int f2391_19(int x) { return x * 19; }
+inline int f2391_20(int x) { return x * 20; }
+inline int f2391_21(int x) { return x * 21; }
+inline int f2391_22(int x) { return x * 22; }
+inline int f2391_23(int x) { return x * 23; }
+inline int f2391_24(int x) { return x * 24; }
+inline int f2391_25(int x) { return x * 25; }
+inline int f2391_26(int x) { return x * 26; }
+inline int f2391_27(int x) { return x * 27; }
+inline int f2391_28(int x) { return x * 28; }
+inline int f2391_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2396 */
+#include <vector>
+#include "h5489.h"
+#include "h2547.h"
+#include "h5801.h"
+#include "h9321.h"
+#include "h2304.h"
+#ifdef X
+#include "h848.h"
+#endif
+struct S2396 { int a; const char *s = "x//y"; };
+inline int f2396_0(int x) { return x * 0; }
+inline int f2396_1(int x) { return x * 1; }
+inline int f2396_2(int x) { return x * 2; }
+inline int f2396_3(int x) { return x * 3; }
+inline int f2396_4(int x) { return x * 4; }
+inline int f2396_5(int x) { return x * 5; }
+inline int f2396_6(int x) { return x * 6; }
+inline int f2396_7(int x) { return x * 7; }
+inline int f2396_8(int x) { return x * 8; }
+inline int f2396_9(int x) { return x * 9; }
+inline int f2396_10(int x) { return x * 10; }
+inline int f2396_11(int x) { return x * 11; }
+inline int f2396_12(int x) { return x * 12; }
+inline int f2396_13(int x) { return x * 13; }
+inline int f2396_14(int x) { return x * 14; }
+inline int f2396_15(int x) { return x * 15; }
+inline int f2396_16(int x) { return x * 16; }
+inline int f2396_17(int x) { return x * 17; }
+inline int f2396_18(int x) { return x * 18; }
+inline int f2396_19(int x) { return x * 19; }
+inline int f2396_20(int x) { return x * 20; }
+inline int f2396_21(int x) { return x * 21; }
+inline int f2396_22(int x) { return x * 22; }
+inline int f2396_23(int x) { return x * 23; }
+inline int f2396_24(int x) { return x * 24; }
+inline int f2396_25(int x) { return x * 25; }
+inline int f2396_26(int x) { return x * 26; }
+inline int f2396_27(int x) { return x * 27; }
+inline int f2396_28(int x) { return x * 28; }
+inline int f2396_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2397 */
+#include <vector>
+#include "h8767.h"
+#include "h3449.h"
+#include "h5904.h"
+#include "h5074.h"
+#include "h559.h"
+#ifdef X
+#include "h9561.h"
+#endif
+struct S2397 { int a; const char *s = "x//y"; };
+inline int f2397_0(int x) { return x * 0; }
+inline int f2397_1(int x) { return x * 1; }
+inline int f2397_2(int x) { return x * 2; }
+inline int f2397_3(int x) { return x * 3; }
+inline int f2397_4(int x) { return x * 4; }
+inline int f2397_5(int x) { return x * 5; }
+inline int f2397_6(int x) { return x * 6; }
+inline int f2397_7(int x) { return x * 7; }
+inline int f2397_8(int x) { return x * 8; }
+inline int f2397_9(int x) { return x * 9; }
+inline int f2397_10(int x) { return x * 10; }
+inline int f2397_11(int x) { return x * 11; }
+inline int f2397_12(int x) { return x * 12; }
+inline int f2397_13(int x) { return x * 13; }
+inline int f2397_14(int x) { return x * 14; }
+inline int f2397_15(int x) { return x * 15; }
+inline int f2397_16(int x) { return x * 16; }
+inline int f2397_17(int x) { return x * 17; }
+inline int f2397_18(int x) { return x * 18; }
+inline int f2397_19(int x) { return x * 19; }
+inline int f2397_20(int x) { return x * 20; }
+inline int f2397_21(int x) { return x * 21; }
+inline int f2397_22(int x) { return x * 22; }
+inline int f2397_23(int x) { return x * 23; }
+inline int f2397_24(int x) { return x * 24; }
+inline int f2397_25(int x) { return x * 25; }
+inline int f2397_26(int x) { return x * 26; }
+inline int f2397_27(int x) { return x * 27; }
+inline int f2397_28(int x) { return x * 28; }
+inline int f2397_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 24 */
+#include <vector>
+#include "h4428.h"
+#include "h4671.h"
+#include "h324.h"
+#include "h4911.h"
+#include "h8840.h"
+#ifdef X
+#include "h2599.h"
+#endif
+struct S24 { int a; const char *s = "x//y"; };
+inline int f24_0(int x) { return x * 0; }
+inline int f24_1(int x) { return x * 1; }
+inline int f24_2(int x) { return x * 2; }
+inline int f24_3(int x) { return x * 3; }
+inline int f24_4(int x) { return x * 4; }
+inline int f24_5(int x) { return x * 5; }
+inline int f24_6(int x) { return x * 6; }
+inline int f24_7(int x) { return x * 7; }
+inline int f24_8(int x) { return x * 8; }
+inline int f24_9(int x) { return x * 9; }
+inline int f24_10(int x) { return x * 10; }
+inline int f24_11(int x) { return x * 11; }
+inline int f24_12(int x) { return x * 12; }
+inline int f24_13(int x) { return x * 13; }
+inline int f24_14(int x) { return x * 14; }
+inline int f24_15(int x) { return x * 15; }
+inline int f24_16(int x) { return x * 16; }
+inline int f24_17(int x) { return x * 17; }
+inline int f24_18(int x) { return x * 18; }
+inline int f24_19(int x) { return x * 19; }
+inline int f24_20(int x) { return x * 20; }
+inline int f24_21(int x) { return x * 21; }
+inline int f24_22(int x) { return x * 22; }
+inline int f24_23(int x) { return x * 23; }
+inline int f24_24(int x) { return x * 24; }
+inline int f24_25(int x) { return x * 25; }
+inline int f24_26(int x) { return x * 26; }
+inline int f24_27(int x) { return x * 27; }
+inline int f24_28(int x) { return x * 28; }
+inline int f24_29(int x) { return x * 29; }
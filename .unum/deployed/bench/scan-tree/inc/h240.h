@@ -0,0 +1,42 @@
+#pragma once
+/* header 240 */
+#include <vector>
+#include "h1066.h"
+#include "h3153.h"
+#include "h3280.h"
+#include "h6796.h"
+#include "h1138.h"
+#ifdef X
+#include "h4685.h"
+#endif
+struct S240 { int a; const char *s = "x//y"; };
+inline int f240_0(int x) { return x * 0; }
+inline int f240_1(int x) { return x * 1; }
+inline int f240_2(int x) { return x * 2; }
+inline int f240_3(int x) { return x * 3; }
+inline int f240_4(int x) { return x * 4; }
+inline int f240_5(int x) { return x * 5; }
+inline int f240_6(int x) { return x * 6; }
+inline int f240_7(int x) { return x * 7; }
+inline int f240_8(int x) { return x * 8; }
+inline int f240_9(int x) { return x * 9; }
+inline int f240_10(int x) { return x * 10; }
+inline int f240_11(int x) { return x * 11; }
+inline int f240_12(int x) { return x * 12; }
+inline int f240_13(int x) { return x * 13; }
+inline int f240_14(int x) { return x * 14; }
+inline int f240_15(int x) { return x * 15; }
+inline int f240_16(int x) { return x * 16; }
+inline int f240_17(int x) { return x * 17; }
+inline int f240_18(int x) { return x * 18; }
+inline int f240_19(int x) { return x * 19; }
+inline int f240_20(int x) { return x * 20; }
+inline int f240_21(int x) { return x * 21; }
+inline int f240_22(int x) { return x * 22; }
+inline int f240_23(int x) { return x * 23; }
+inline int f240_24(int x) { return x * 24; }
+inline int f240_25(int x) { return x * 25; }
+inline int f240_26(int x) { return x * 26; }
+inline int f240_27(int x) { return x * 27; }
+inline int f240_28(int x) { return x * 28; }
+inline int f240_29(int x) { return x * 29; }
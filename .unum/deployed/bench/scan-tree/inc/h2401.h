@@ -0,0 +1,42 @@
+#pragma once
+/* header 2401 */
+#include <vector>
+#include "h93.h"
+#include "h9285.h"
+#include "h9379.h"
+#include "h8460.h"
+#include "h1383.h"
+#ifdef X
+#include "h2115.h"
+#endif
+struct S2401 { int a; const char *s = "x//y"; };
+inline int f2401_0(int x) { return x * 0; }
+inline int f2401_1(int x) { return x * 1; }
+inline int f2401_2(int x) { return x * 2; }
+inline int f2401_3(int x) { return x * 3; }
+inline int f2401_4(int x) { return x * 4; }
+inline int f2401_5(int x) { return x * 5; }
+inline int f2401_6(int x) { return x * 6; }
+inline int f2401_7(int x) { return x * 7; }
+inline int f2401_8(int x) { return x * 8; }
+inline int f2401_9(int x) { return x * 9; }
+inline int f2401_10(int x) { return x * 10; }
+inline int f2401_11(int x) { return x * 11; }
+inline int f2401_12(int x) { return x * 12; }
+inline int f2401_13(int x) { return x * 13; }
+inline int f2401_14(int x) { return x * 14; }
+inline int f2401_15(int x) { return x * 15; }
+inline int f2401_16(int x) { return x * 16; }
+inline int f2401_17(int x) { return x * 17; }
+inline int f2401_18(int x) { return x * 18; }
+inline int f2401_19(int x) { return x * 19; }
+inline int f2401_20(int x) { return x * 20; }
+inline int f2401_21(int x) { return x * 21; }
+inline int f2401_22(int x) { return x * 22; }
+inline int f2401_23(int x) { return x * 23; }
+inline int f2401_24(int x) { return x * 24; }
+inline int f2401_25(int x) { return x * 25; }
+inline int f2401_26(int x) { return x * 26; }
+inline int f2401_27(int x) { return x * 27; }
+inline int f2401_28(int x) { return x * 28; }
+inline int f2401_29(int x) { return x * 29; }
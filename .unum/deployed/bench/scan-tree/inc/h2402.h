@@ -0,0 +1,42 @@
+#pragma once
+/* header 2402 */
+#include <vector>
+#include "h2559.h"
+#include "h5193.h"
+#include "h9622.h"
+#include "h4202.h"
+#include "h2066.h"
+#ifdef X
+#include "h3561.h"
+#endif
+struct S2402 { int a; const char *s = "x//y"; };
+inline int f2402_0(int x) { return x * 0; }
+inline int f2402_1(int x) { return x * 1; }
+inline int f2402_2(int x) { return x * 2; }
+inline int f2402_3(int x) { return x * 3; }
+inline int f2402_4(int x) { return x * 4; }
+inline int f2402_5(int x) { return x * 5; }
+inline int f2402_6(int x) { return x * 6; }
+inline int f2402_7(int x) { return x * 7; }
+inline int f2402_8(int x) { return x * 8; }
+inline int f2402_9(int x) { return x * 9; }
+inline int f2402_10(int x) { return x * 10; }
+inline int f2402_11(int x) { return x * 11; }
+inline int f2402_12(int x) { return x * 12; }
+inline int f2402_13(int x) { return x * 13; }
+inline int f2402_14(int x) { return x * 14; }
+inline int f2402_15(int x) { return x * 15; }
+inline int f2402_16(int x) { return x * 16; }
+inline int f2402_17(int x) { return x * 17; }
+inline int f2402_18(int x) { return x * 18; }
+inline int f2402_19(int x) { return x * 19; }
+inline int f2402_20(int x) { return x * 20; }
+inline int f2402_21(int x) { return x * 21; }
+inline int f2402_22(int x) { return x * 22; }
+inline int f2402_23(int x) { return x * 23; }
+inline int f2402_24(int x) { return x * 24; }
+inline int f2402_25(int x) { return x * 25; }
+inline int f2402_26(int x) { return x * 26; }
+inline int f2402_27(int x) { return x * 27; }
+inline int f2402_28(int x) { return x * 28; }
+inline int f2402_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2405 */
+#include <vector>
+#include "h9997.h"
+#include "h6870.h"
+#include "h6330.h"
+#include "h2166.h"
+#include "h4216.h"
+#ifdef X
+#include "h9623.h"
+#endif
+struct S2405 { int a; const char *s = "x//y"; };
+inline int f2405_0(int x) { return x * 0; }
+inline int f2405_1(int x) { return x * 1; }
+inline int f2405_2(int x) { return x * 2; }
+inline int f2405_3(int x) { return x * 3; }
+inline int f2405_4(int x) { return x * 4; }
+inline int f2405_5(int x) { return x * 5; }
+inline int f2405_6(int x) { return x * 6; }
+inline int f2405_7(int x) { return x * 7; }
+inline int f2405_8(int x) { return x * 8; }
+inline int f2405_9(int x) { return x * 9; }
+inline int f2405_10(int x) { return x * 10; }
+inline int f2405_11(int x) { return x * 11; }
+inline int f2405_12(int x) { return x * 12; }
+inline int f2405_13(int x) { return x * 13; }
+inline int f2405_14(int x) { return x * 14; }
+inline int f2405_15(int x) { return x * 15; }
+inline int f2405_16(int x) { return x * 16; }
+inline int f2405_17(int x) { return x * 17; }
+inline int f2405_18(int x) { return x * 18; }
+inline int f2405_19(int x) { return x * 19; }
+inline int f2405_20(int x) { return x * 20; }
+inline int f2405_21(int x) { return x * 21; }
+inline int f2405_22(int x) { return x * 22; }
+inline int f2405_23(int x) { return x * 23; }
+inline int f2405_24(int x) { return x * 24; }
+inline int f2405_25(int x) { return x * 25; }
+inline int f2405_26(int x) { return x * 26; }
+inline int f2405_27(int x) { return x * 27; }
+inline int f2405_28(int x) { return x * 28; }
+inline int f2405_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 241 */
+#include <vector>
+#include "h6691.h"
+#include "h4003.h"
+#include "h3432.h"
+#include "h211.h"
+#include "h5474.h"
+#ifdef X
+#include "h1331.h"
+#endif
+struct S241 { int a; const char *s = "x//y"; };
+inline int f241_0(int x) { return x * 0; }
+inline int f241_1(int x) { return x * 1; }
+inline int f241_2(int x) { return x * 2; }
+inline int f241_3(int x) { return x * 3; }
+inline int f241_4(int x) { return x * 4; }
+inline int f241_5(int x) { return x * 5; }
+inline int f241_6(int x) { return x * 6; }
+inline int f241_7(int x) { return x * 7; }
+inline int f241_8(int x) { return x * 8; }
+inline int f241_9(int x) { return x * 9; }
+inline int f241_10(int x) { return x * 10; }
+inline int f241_11(int x) { return x * 11; }
+inline int f241_12(int x) { return x * 12; }
+inline int f241_13(int x) { return x * 13; }
+inline int f241_14(int x) { return x * 14; }
+inline int f241_15(int x) { return x * 15; }
+inline int f241_16(int x) { return x * 16; }
+inline int f241_17(int x) { return x * 17; }
+inline int f241_18(int x) { return x * 18; }
+inline int f241_19(int x) { return x * 19; }
+inline int f241_20(int x) { return x * 20; }
+inline int f241_21(int x) { return x * 21; }
+inline int f241_22(int x) { return x * 22; }
+inline int f241_23(int x) { return x * 23; }
+inline int f241_24(int x) { return x * 24; }
+inline int f241_25(int x) { return x * 25; }
+inline int f241_26(int x) { return x * 26; }
+inline int f241_27(int x) { return x * 27; }
+inline int f241_28(int x) { return x * 28; }
+inline int f241_29(int x) { return x * 29; }
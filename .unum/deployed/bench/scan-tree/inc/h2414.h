@@ -0,0 +1,42 @@
+#pragma once
+/* header 2414 */
+#include <vector>
+#include "h9832.h"
+#include "h8329.h"
+#include "h6223.h"
+#include "h1773.h"
+#include "h3837.h"
+#ifdef X
+#include "h8743.h"
+#endif
+struct S2414 { int a; const char *s = "x//y"; };
+inline int f2414_0(int x) { return x * 0; }
+inline int f2414_1(int x) { return x * 1; }
+inline int f2414_2(int x) { return x * 2; }
+inline int f2414_3(int x) { return x * 3; }
+inline int f2414_4(int x) { return x * 4; }
+inline int f2414_5(int x) { return x * 5; }
+inline int f2414_6(int x) { return x * 6; }
+inline int f2414_7(int x) { return x * 7; }
+inline int f2414_8(int x) { return x * 8; }
+inline int f2414_9(int x) { return x * 9; }
+inline int f2414_10(int x) { return x * 10; }
+inline int f2414_11(int x) { return x * 11; }
+inline int f2414_12(int x) { return x * 12; }
+inline int f2414_13(int x) { return x * 13; }
+inline int f2414_14(int x) { return x * 14; }
+inline int f2414_15(int x) { return x * 15; }
+inline int f2414_16(int x) { return x * 16; }
+inline int f2414_17(int x) { return x * 17; }
+inline int f2414_18(int x) { return x * 18; }
+inline int f2414_19(int x) { return x * 19; }
+inline int f2414_20(int x) { return x * 20; }
+inline int f2414_21(int x) { return x * 21; }
+inline int f2414_22(int x) { return x * 22; }
+inline int f2414_23(int x) { return x * 23; }
+inline int f2414_24(int x) { return x * 24; }
+inline int f2414_25(int x) { return x * 25; }
+inline int f2414_26(int x) { return x * 26; }
+inline int f2414_27(int x) { return x * 27; }
+inline int f2414_28(int x) { return x * 28; }
+inline int f2414_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2417 */
+#include <vector>
+#include "h6325.h"
+#include "h8851.h"
+#include "h3493.h"
+#include "h2073.h"
+#include "h2833.h"
+#ifdef X
+#include "h2899.h"
+#endif
+struct S2417 { int a; const char *s = "x//y"; };
+inline int f2417_0(int x) { return x * 0; }
+inline int f2417_1(int x) { return x * 1; }
+inline int f2417_2(int x) { return x * 2; }
+inline int f2417_3(int x) { return x * 3; }
+inline int f2417_4(int x) { return x * 4; }
+inline int f2417_5(int x) { return x * 5; }
+inline int f2417_6(int x) { return x * 6; }
+inline int f2417_7(int x) { return x * 7; }
+inline int f2417_8(int x) { return x * 8; }
+inline int f2417_9(int x) { return x * 9; }
+inline int f2417_10(int x) { return x * 10; }
+inline int f2417_11(int x) { return x * 11; }
+inline int f2417_12(int x) { return x * 12; }
+inline int f2417_13(int x) { return x * 13; }
+inline int f2417_14(int x) { return x * 14; }
+inline int f2417_15(int x) { return x * 15; }
+inline int f2417_16(int x) { return x * 16; }
+inline int f2417_17(int x) { return x * 17; }
+inline int f2417_18(int x) { return x * 18; }
+inline int f2417_19(int x) { return x * 19; }
+inline int f2417_20(int x) { return x * 20; }
+inline int f2417_21(int x) { return x * 21; }
+inline int f2417_22(int x) { return x * 22; }
+inline int f2417_23(int x) { return x * 23; }
+inline int f2417_24(int x) { return x * 24; }
+inline int f2417_25(int x) { return x * 25; }
+inline int f2417_26(int x) { return x * 26; }
+inline int f2417_27(int x) { return x * 27; }
+inline int f2417_28(int x) { return x * 28; }
+inline int f2417_29(int x) { return x * 29; }
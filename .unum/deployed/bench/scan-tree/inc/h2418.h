@@ -0,0 +1,42 @@
+#pragma once
+/* header 2418 */
+#include <vector>
+#include "h9927.h"
+#include "h499.h"
+#include "h1235.h"
+#include "h6885.h"
+#include "h9467.h"
+#ifdef X
+#include "h7275.h"
+#endif
+struct S2418 { int a; const char *s = "x//y"; };
+inline int f2418_0(int x) { return x * 0; }
+inline int f2418_1(int x) { return x * 1; }
+inline int f2418_2(int x) { return x * 2; }
+inline int f2418_3(int x) { return x * 3; }
+inline int f2418_4(int x) { return x * 4; }
+inline int f2418_5(int x) { return x * 5; }
+inline int f2418_6(int x) { return x * 6; }
+inline int f2418_7(int x) { return x * 7; }
+inline int f2418_8(int x) { return x * 8; }
+inline int f2418_9(int x) { return x * 9; }
+inline int f2418_10(int x) { return x * 10; }
+inline int f2418_11(int x) { return x * 11; }
+inline int f2418_12(int x) { return x * 12; }
+inline int f2418_13(int x) { return x * 13; }
+inline int f2418_14(int x) { return x * 14; }
+inline int f2418_15(int x) { return x * 15; }
+inline int f2418_16(int x) { return x * 16; }
+inline int f2418_17(int x) { return x * 17; }
+inline int f2418_18(int x) { return x * 18; }
+inline int f2418_19(int x) { return x * 19; }
+inline int f2418_20(int x) { return x * 20; }
+inline int f2418_21(int x) { return x * 21; }
+inline int f2418_22(int x) { return x * 22; }
+inline int f2418_23(int x) { return x * 23; }
+inline int f2418_24(int x) { return x * 24; }
+inline int f2418_25(int x) { return x * 25; }
+inline int f2418_26(int x) { return x * 26; }
+inline int f2418_27(int x) { return x * 27; }
+inline int f2418_28(int x) { return x * 28; }
+inline int f2418_29(int x) { return x * 29; }
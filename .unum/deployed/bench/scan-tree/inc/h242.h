@@ -0,0 +1,42 @@
+#pragma once
+/* header 242 */
+#include <vector>
+#include "h4394.h"
+#include "h2536.h"
+#include "h3545.h"
+#include "h5546.h"
+#include "h2089.h"
+#ifdef X
+#include "h7816.h"
+#endif
+struct S242 { int a; const char *s = "x//y"; };
+inline int f242_0(int x) { return x * 0; }
+inline int f242_1(int x) { return x * 1; }
+inline int f242_2(int x) { return x * 2; }
+inline int f242_3(int x) { return x * 3; }
+inline int f242_4(int x) { return x * 4; }
+inline int f242_5(int x) { return x * 5; }
+inline int f242_6(int x) { return x * 6; }
+inline int f242_7(int x) { return x * 7; }
+inline int f242_8(int x) { return x * 8; }
+inline int f242_9(int x) { return x * 9; }
+inline int f242_10(int x) { return x * 10; }
+inline int f242_11(int x) { return x * 11; }
+inline int f242_12(int x) { return x * 12; }
+inline int f242_13(int x) { return x * 13; }
+inline int f242_14(int x) { return x * 14; }
+inline int f242_15(int x) { return x * 15; }
+inline int f242_16(int x) { return x * 16; }
+inline int f242_17(int x) { return x * 17; }
+inline int f242_18(int x) { return x * 18; }
+inline int f242_19(int x) { return x * 19; }
+inline int f242_20(int x) { return x * 20; }
+inline int f242_21(int x) { return x * 21; }
+inline int f242_22(int x) { return x * 22; }
+inline int f242_23(int x) { return x * 23; }
+inline int f242_24(int x) { return x * 24; }
+inline int f242_25(int x) { return x * 25; }
+inline int f242_26(int x) { return x * 26; }
+inline int f242_27(int x) { return x * 27; }
+inline int f242_28(int x) { return x * 28; }
+inline int f242_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2421 */
+#include <vector>
+#include "h7091.h"
+#include "h5322.h"
+#include "h2312.h"
+#include "h6560.h"
+#include "h9943.h"
+#ifdef X
+#include "h2110.h"
+#endif
+struct S2421 { int a; const char *s = "x//y"; };
+inline int f2421_0(int x) { return x * 0; }
+inline int f2421_1(int x) { return x * 1; }
+inline int f2421_2(int x) { return x * 2; }
+inline int f2421_3(int x) { return x * 3; }
+inline int f2421_4(int x) { return x * 4; }
+inline int f2421_5(int x) { return x * 5; }
+inline int f2421_6(int x) { return x * 6; }
+inline int f2421_7(int x) { return x * 7; }
+inline int f2421_8(int x) { return x * 8; }
+inline int f2421_9(int x) { return x * 9; }
+inline int f2421_10(int x) { return x * 10; }
+inline int f2421_11(int x) { return x * 11; }
+inline int f2421_12(int x) { return x * 12; }
+inline int f2421_13(int x) { return x * 13; }
+inline int f2421_14(int x) { return x * 14; }
+inline int f2421_15(int x) { return x * 15; }
+inline int f2421_16(int x) { return x * 16; }
+inline int f2421_17(int x) { return x * 17; }
+inline int f2421_18(int x) { return x * 18; }
+inline int f2421_19(int x) { return x * 19; }
+inline int f2421_20(int x) { return x * 20; }
+inline int f2421_21(int x) { return x * 21; }
+inline int f2421_22(int x) { return x * 22; }
+inline int f2421_23(int x) { return x * 23; }
+inline int f2421_24(int x) { return x * 24; }
+inline int f2421_25(int x) { return x * 25; }
+inline int f2421_26(int x) { return x * 26; }
+inline int f2421_27(int x) { return x * 27; }
+inline int f2421_28(int x) { return x * 28; }
+inline int f2421_29(int x) { return x * 29; }
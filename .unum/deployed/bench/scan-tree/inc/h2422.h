@@ -0,0 +1,42 @@
+#pragma once
+/* header 2422 */
+#include <vector>
+#include "h9899.h"
+#include "h4975.h"
+#include "h6802.h"
+#include "h8567.h"
+#include "h6572.h"
+#ifdef X
+#include "h2595.h"
+#endif
+struct S2422 { int a; const char *s = "x//y"; };
+inline int f2422_0(int x) { return x * 0; }
+inline int f2422_1(int x) { return x * 1; }
+inline int f2422_2(int x) { return x * 2; }
+inline int f2422_3(int x) { return x * 3; }
+inline int f2422_4(int x) { return x * 4; }
+inline int f2422_5(int x) { return x * 5; }
+inline int f2422_6(int x) { return x * 6; }
+inline int f2422_7(int x) { return x * 7; }
+inline int f2422_8(int x) { return x * 8; }
+inline int f2422_9(int x) { return x * 9; }
+inline int f2422_10(int x) { return x * 10; }
+inline int f2422_11(int x) { return x * 11; }
+inline int f2422_12(int x) { return x * 12; }
+inline int f2422_13(int x) { return x * 13; }
+inline int f2422_14(int x) { return x * 14; }
+inline int f2422_15(int x) { return x * 15; }
+inline int f2422_16(int x) { return x * 16; }
+inline int f2422_17(int x) { return x * 17; }
+inline int f2422_18(int x) { return x * 18; }
+inline int f2422_19(int x) { return x * 19; }
+inline int f2422_20(int x) { return x * 20; }
+inline int f2422_21(int x) { return x * 21; }
+inline int f2422_22(int x) { return x * 22; }
+inline int f2422_23(int x) { return x * 23; }
+inline int f2422_24(int x) { return x * 24; }
+inline int f2422_25(int x) { return x * 25; }
+inline int f2422_26(int x) { return x * 26; }
+inline int f2422_27(int x) { return x * 27; }
+inline int f2422_28(int x) { return x * 28; }
+inline int f2422_29(int x) { return x * 29; }
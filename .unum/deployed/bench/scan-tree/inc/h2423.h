@@ -0,0 +1,42 @@
+#pragma once
+/* header 2423 */
+#include <vector>
+#include "h5471.h"
+#include "h1578.h"
+#include "h528.h"
+#include "h4167.h"
+#include "h2974.h"
+#ifdef X
+#include "h5470.h"
+#endif
+struct S2423 { int a; const char *s = "x//y"; };
+inline int f2423_0(int x) { return x * 0; }
+inline int f2423_1(int x) { return x * 1; }
+inline int f2423_2(int x) { return x * 2; }
+inline int f2423_3(int x) { return x * 3; }
+inline int f2423_4(int x) { return x * 4; }
+inline int f2423_5(int x) { return x * 5; }
+inline int f2423_6(int x) { return x * 6; }
+inline int f2423_7(int x) { return x * 7; }
+inline int f2423_8(int x) { return x * 8; }
+inline int f2423_9(int x) { return x * 9; }
+inline int f2423_10(int x) { return x * 10; }
+inline int f2423_11(int x) { return x * 11; }
+inline int f2423_12(int x) { return x * 12; }
+inline int f2423_13(int x) { return x * 13; }
+inline int f2423_14(int x) { return x * 14; }
+inline int f2423_15(int x) { return x * 15; }
+inline int f2423_16(int x) { return x * 16; }
+inline int f2423_17(int x) { return x * 17; }
+inline int f2423_18(int x) { return x * 18; }
+inline int f2423_19(int x) { return x * 19; }
+inline int f2423_20(int x) { return x * 20; }
+inline int f2423_21(int x) { return x * 21; }
+inline int f2423_22(int x) { return x * 22; }
+inline int f2423_23(int x) { return x * 23; }
+inline int f2423_24(int x) { return x * 24; }
+inline int f2423_25(int x) { return x * 25; }
+inline int f2423_26(int x) { return x * 26; }
+inline int f2423_27(int x) { return x * 27; }
+inline int f2423_28(int x) { return x * 28; }
+inline int f2423_29(int x) { return x * 29; }
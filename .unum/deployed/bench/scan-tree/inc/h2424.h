@@ -0,0 +1,42 @@
+#pragma once
+/* header 2424 */
+#include <vector>
+#include "h844.h"
+#include "h1931.h"
+#include "h7199.h"
+#include "h237.h"
+#include "h8813.h"
+#ifdef X
+#include "h4761.h"
+#endif
+struct S2424 { int a; const char *s = "x//y"; };
+inline int f2424_0(int x) { return x * 0; }
+inline int f2424_1(int x) { return x * 1; }
+inline int f2424_2(int x) { return x * 2; }
+inline int f2424_3(int x) { return x * 3; }
+inline int f2424_4(int x) { return x * 4; }
+inline int f2424_5(int x) { return x * 5; }
+inline int f2424_6(int x) { return x * 6; }
+inline int f2424_7(int x) { return x * 7; }
+inline int f2424_8(int x) { return x * 8; }
+inline int f2424_9(int x) { return x * 9; }
+inline int f2424_10(int x) { return x * 10; }
+inline int f2424_11(int x) { return x * 11; }
+inline int f2424_12(int x) { return x * 12; }
+inline int f2424_13(int x) { return x * 13; }
+inline int f2424_14(int x) { return x * 14; }
+inline int f2424_15(int x) { return x * 15; }
+inline int f2424_16(int x) { return x * 16; }
+inline int f2424_17(int x) { return x * 17; }
+inline int f2424_18(int x) { return x * 18; }
+inline int f2424_19(int x) { return x * 19; }
+inline int f2424_20(int x) { return x * 20; }
+inline int f2424_21(int x) { return x * 21; }
+inline int f2424_22(int x) { return x * 22; }
+inline int f2424_23(int x) { return x * 23; }
+inline int f2424_24(int x) { return x * 24; }
+inline int f2424_25(int x) { return x * 25; }
+inline int f2424_26(int x) { return x * 26; }
+inline int f2424_27(int x) { return x * 27; }
+inline int f2424_28(int x) { return x * 28; }
+inline int f2424_29(int x) { return x * 29; }
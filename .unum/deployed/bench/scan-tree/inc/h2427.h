@@ -0,0 +1,42 @@
+#pragma once
+/* header 2427 */
+#include <vector>
+#include "h1941.h"
+#include "h5717.h"
+#include "h3047.h"
+#include "h6596.h"
+#include "h254.h"
+#ifdef X
+#include "h7006.h"
+#endif
+struct S2427 { int a; const char *s = "x//y"; };
+inline int f2427_0(int x) { return x * 0; }
+inline int f2427_1(int x) { return x * 1; }
+inline int f2427_2(int x) { return x * 2; }
+inline int f2427_3(int x) { return x * 3; }
+inline int f2427_4(int x) { return x * 4; }
+inline int f2427_5(int x) { return x * 5; }
+inline int f2427_6(int x) { return x * 6; }
+inline int f2427_7(int x) { return x * 7; }
+inline int f2427_8(int x) { return x * 8; }
+inline int f2427_9(int x) { return x * 9; }
+inline int f2427_10(int x) { return x * 10; }
+inline int f2427_11(int x) { return x * 11; }
+inline int f2427_12(int x) { return x * 12; }
+inline int f2427_13(int x) { return x * 13; }
+inline int f2427_14(int x) { return x * 14; }
+inline int f2427_15(int x) { return x * 15; }
+inline int f2427_16(int x) { return x * 16; }
+inline int f2427_17(int x) { return x * 17; }
+inline int f2427_18(int x) { return x * 18; }
+inline int f2427_19(int x) { return x * 19; }
+inline int f2427_20(int x) { return x * 20; }
+inline int f2427_21(int x) { return x * 21; }
+inline int f2427_22(int x) { return x * 22; }
+inline int f2427_23(int x) { return x * 23; }
+inline int f2427_24(int x) { return x * 24; }
+inline int f2427_25(int x) { return x * 25; }
+inline int f2427_26(int x) { return x * 26; }
+inline int f2427_27(int x) { return x * 27; }
+inline int f2427_28(int x) { return x * 28; }
+inline int f2427_29(int x) { return x * 29; }
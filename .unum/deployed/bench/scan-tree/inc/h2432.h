@@ -0,0 +1,42 @@
+#pragma once
+/* header 2432 */
+#include <vector>
+#include "h6415.h"
+#include "h4638.h"
+#include "h23.h"
+#include "h7350.h"
+#include "h4118.h"
+#ifdef X
+#include "h529.h"
+#endif
+struct S2432 { int a; const char *s = "x//y"; };
+inline int f2432_0(int x) { return x * 0; }
+inline int f2432_1(int x) { return x * 1; }
+inline int f2432_2(int x) { return x * 2; }
+inline int f2432_3(int x) { return x * 3; }
+inline int f2432_4(int x) { return x * 4; }
+inline int f2432_5(int x) { return x * 5; }
+inline int f2432_6(int x) { return x * 6; }
+inline int f2432_7(int x) { return x * 7; }
+inline int f2432_8(int x) { return x * 8; }
+inline int f2432_9(int x) { return x * 9; }
+inline int f2432_10(int x) { return x * 10; }
+inline int f2432_11(int x) { return x * 11; }
+inline int f2432_12(int x) { return x * 12; }
+inline int f2432_13(int x) { return x * 13; }
+inline int f2432_14(int x) { return x * 14; }
+inline int f2432_15(int x) { return x * 15; }
+inline int f2432_16(int x) { return x * 16; }
+inline int f2432_17(int x) { return x * 17; }
+inline int f2432_18(int x) { return x * 18; }
+inline int f2432_19(int x) { return x * 19; }
+inline int f2432_20(int x) { return x * 20; }
+inline int f2432_21(int x) { return x * 21; }
+inline int f2432_22(int x) { return x * 22; }
+inline int f2432_23(int x) { return x * 23; }
+inline int f2432_24(int x) { return x * 24; }
+inline int f2432_25(int x) { return x * 25; }
+inline int f2432_26(int x) { return x * 26; }
+inline int f2432_27(int x) { return x * 27; }
+inline int f2432_28(int x) { return x * 28; }
+inline int f2432_29(int x) { return x * 29; }
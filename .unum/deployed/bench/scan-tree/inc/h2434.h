@@ -0,0 +1,42 @@
+#pragma once
+/* header 2434 */
+#include <vector>
+#include "h9981.h"
+#include "h2717.h"
+#include "h5254.h"
+#include "h1334.h"
+#include "h5579.h"
+#ifdef X
+#include "h342.h"
+#endif
+struct S2434 { int a; const char *s = "x//y"; };
+inline int f2434_0(int x) { return x * 0; }
+inline int f2434_1(int x) { return x * 1; }
+inline int f2434_2(int x) { return x * 2; }
+inline int f2434_3(int x) { return x * 3; }
+inline int f2434_4(int x) { return x * 4; }
+inline int f2434_5(int x) { return x * 5; }
+inline int f2434_6(int x) { return x * 6; }
+inline int f2434_7(int x) { return x * 7; }
+inline int f2434_8(int x) { return x * 8; }
+inline int f2434_9(int x) { return x * 9; }
+inline int f2434_10(int x) { return x * 10; }
+inline int f2434_11(int x) { return x * 11; }
+inline int f2434_12(int x) { return x * 12; }
+inline int f2434_13(int x) { return x * 13; }
+inline int f2434_14(int x) { return x * 14; }
+inline int f2434_15(int x) { return x * 15; }
+inline int f2434_16(int x) { return x * 16; }
+inline int f2434_17(int x) { return x * 17; }
+inline int f2434_18(int x) { return x * 18; }
+inline int f2434_19(int x) { return x * 19; }
+inline int f2434_20(int x) { return x * 20; }
+inline int f2434_21(int x) { return x * 21; }
+inline int f2434_22(int x) { return x * 22; }
+inline int f2434_23(int x) { return x * 23; }
+inline int f2434_24(int x) { return x * 24; }
+inline int f2434_25(int x) { return x * 25; }
+inline int f2434_26(int x) { return x * 26; }
+inline int f2434_27(int x) { return x * 27; }
+inline int f2434_28(int x) { return x * 28; }
+inline int f2434_29(int x) { return x * 29; }
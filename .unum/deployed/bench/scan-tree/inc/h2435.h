@@ -0,0 +1,42 @@
+#pragma once
+/* header 2435 */
+#include <vector>
+#include "h6278.h"
+#include "h9871.h"
+#include "h862.h"
+#include "h2694.h"
+#include "h3847.h"
+#ifdef X
+#include "h2266.h"
+#endif
+struct S2435 { int a; const char *s = "x//y"; };
+inline int f2435_0(int x) { return x * 0; }
+inline int f2435_1(int x) { return x * 1; }
+inline int f2435_2(int x) { return x * 2; }
+inline int f2435_3(int x) { return x * 3; }
+inline int f2435_4(int x) { return x * 4; }
+inline int f2435_5(int x) { return x * 5; }
+inline int f2435_6(int x) { return x * 6; }
+inline int f2435_7(int x) { return x * 7; }
+inline int f2435_8(int x) { return x * 8; }
+inline int f2435_9(int x) { return x * 9; }
+inline int f2435_10(int x) { return x * 10; }
+inline int f2435_11(int x) { return x * 11; }
+inline int f2435_12(int x) { return x * 12; }
+inline int f2435_13(int x) { return x * 13; }
+inline int f2435_14(int x) { return x * 14; }
+inline int f2435_15(int x) { return x * 15; }
+inline int f2435_16(int x) { return x * 16; }
+inline int f2435_17(int x) { return x * 17; }
+inline int f2435_18(int x) { return x * 18; }
+inline int f2435_19(int x) { return x * 19; }
+inline int f2435_20(int x) { return x * 20; }
+inline int f2435_21(int x) { return x * 21; }
+inline int f2435_22(int x) { return x * 22; }
+inline int f2435_23(int x) { return x * 23; }
+inline int f2435_24(int x) { return x * 24; }
+inline int f2435_25(int x) { return x * 25; }
+inline int f2435_26(int x) { return x * 26; }
+inline int f2435_27(int x) { return x * 27; }
+inline int f2435_28(int x) { return x * 28; }
+inline int f2435_29(int x) { return x * 29; }
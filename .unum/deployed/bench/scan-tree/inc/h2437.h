@@ -0,0 +1,42 @@
+#pragma once
+/* header 2437 */
+#include <vector>
+#include "h4898.h"
+#include "h2841.h"
+#include "h7354.h"
+#include "h4100.h"
+#include "h2481.h"
+#ifdef X
+#include "h8651.h"
+#endif
+struct S2437 { int a; const char *s = "x//y"; };
+inline int f2437_0(int x) { return x * 0; }
+inline int f2437_1(int x) { return x * 1; }
+inline int f2437_2(int x) { return x * 2; }
+inline int f2437_3(int x) { return x * 3; }
+inline int f2437_4(int x) { return x * 4; }
+inline int f2437_5(int x) { return x * 5; }
+inline int f2437_6(int x) { return x * 6; }
+inline int f2437_7(int x) { return x * 7; }
+inline int f2437_8(int x) { return x * 8; }
+inline int f2437_9(int x) { return x * 9; }
+inline int f2437_10(int x) { return x * 10; }
+inline int f2437_11(int x) { return x * 11; }
+inline int f2437_12(int x) { return x * 12; }
+inline int f2437_13(int x) { return x * 13; }
+inline int f2437_14(int x) { return x * 14; }
+inline int f2437_15(int x) { return x * 15; }
+inline int f2437_16(int x) { return x * 16; }
+inline int f2437_17(int x) { return x * 17; }
+inline int f2437_18(int x) { return x * 18; }
+inline int f2437_19(int x) { return x * 19; }
+inline int f2437_20(int x) { return x * 20; }
+inline int f2437_21(int x) { return x * 21; }
+inline int f2437_22(int x) { return x * 22; }
+inline int f2437_23(int x) { return x * 23; }
+inline int f2437_24(int x) { return x * 24; }
+inline int f2437_25(int x) { return x * 25; }
+inline int f2437_26(int x) { return x * 26; }
+inline int f2437_27(int x) { return x * 27; }
+inline int f2437_28(int x) { return x * 28; }
+inline int f2437_29(int x) { return x * 29; }
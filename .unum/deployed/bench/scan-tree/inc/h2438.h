@@ -0,0 +1,42 @@
+#pragma once
+/* header 2438 */
+#include <vector>
+#include "h6933.h"
+#include "h7770.h"
+#include "h2878.h"
+#include "h7714.h"
+#include "h5595.h"
+#ifdef X
+#include "h8256.h"
+#endif
+struct S2438 { int a; const char *s = "x//y"; };
+inline int f2438_0(int x) { return x * 0; }
+inline int f2438_1(int x) { return x * 1; }
+inline int f2438_2(int x) { return x * 2; }
+inline int f2438_3(int x) { return x * 3; }
+inline int f2438_4(int x) { return x * 4; }
+inline int f2438_5(int x) { return x * 5; }
+inline int f2438_6(int x) { return x * 6; }
+inline int f2438_7(int x) { return x * 7; }
+inline int f2438_8(int x) { return x * 8; }
+inline int f2438_9(int x) { return x * 9; }
+inline int f2438_10(int x) { return x * 10; }
+inline int f2438_11(int x) { return x * 11; }
+inline int f2438_12(int x) { return x * 12; }
+inline int f2438_13(int x) { return x * 13; }
+inline int f2438_14(int x) { return x * 14; }
+inline int f2438_15(int x) { return x * 15; }
+inline int f2438_16(int x) { return x * 16; }
+inline int f2438_17(int x) { return x * 17; }
+inline int f2438_18(int x) { return x * 18; }
+inline int f2438_19(int x) { return x * 19; }
+inline int f2438_20(int x) { return x * 20; }
+inline int f2438_21(int x) { return x * 21; }
+inline int f2438_22(int x) { return x * 22; }
+inline int f2438_23(int x) { return x * 23; }
+inline int f2438_24(int x) { return x * 24; }
+inline int f2438_25(int x) { return x * 25; }
+inline int f2438_26(int x) { return x * 26; }
+inline int f2438_27(int x) { return x * 27; }
+inline int f2438_28(int x) { return x * 28; }
+inline int f2438_29(int x) { return x * 29; }
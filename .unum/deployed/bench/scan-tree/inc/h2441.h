@@ -0,0 +1,42 @@
+#pragma once
+/* header 2441 */
+#include <vector>
+#include "h8939.h"
+#include "h2698.h"
+#include "h2988.h"
+#include "h8300.h"
+#include "h7098.h"
+#ifdef X
+#include "h5484.h"
+#endif
+struct S2441 { int a; const char *s = "x//y"; };
+inline int f2441_0(int x) { return x * 0; }
+inline int f2441_1(int x) { return x * 1; }
+inline int f2441_2(int x) { return x * 2; }
+inline int f2441_3(int x) { return x * 3; }
+inline int f2441_4(int x) { return x * 4; }
+inline int f2441_5(int x) { return x * 5; }
+inline int f2441_6(int x) { return x * 6; }
+inline int f2441_7(int x) { return x * 7; }
+inline int f2441_8(int x) { return x * 8; }
+inline int f2441_9(int x) { return x * 9; }
+inline int f2441_10(int x) { return x * 10; }
+inline int f2441_11(int x) { return x * 11; }
+inline int f2441_12(int x) { return x * 12; }
+inline int f2441_13(int x) { return x * 13; }
+inline int f2441_14(int x) { return x * 14; }
+inline int f2441_15(int x) { return x * 15; }
+inline int f2441_16(int x) { return x * 16; }
+inline int f2441_17(int x) { return x * 17; }
+inline int f2441_18(int x) { return x * 18; }
+inline int f2441_19(int x) { return x * 19; }
+inline int f2441_20(int x) { return x * 20; }
+inline int f2441_21(int x) { return x * 21; }
+inline int f2441_22(int x) { return x * 22; }
+inline int f2441_23(int x) { return x * 23; }
+inline int f2441_24(int x) { return x * 24; }
+inline int f2441_25(int x) { return x * 25; }
+inline int f2441_26(int x) { return x * 26; }
+inline int f2441_27(int x) { return x * 27; }
+inline int f2441_28(int x) { return x * 28; }
+inline int f2441_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2444 */
+#include <vector>
+#include "h8259.h"
+#include "h2419.h"
+#include "h5370.h"
+#include "h9320.h"
+#include "h7761.h"
+#ifdef X
+#include "h8607.h"
+#endif
+struct S2444 { int a; const char *s = "x//y"; };
+inline int f2444_0(int x) { return x * 0; }
+inline int f2444_1(int x) { return x * 1; }
+inline int f2444_2(int x) { return x * 2; }
+inline int f2444_3(int x) { return x * 3; }
+inline int f2444_4(int x) { return x * 4; }
+inline int f2444_5(int x) { return x * 5; }
+inline int f2444_6(int x) { return x * 6; }
+inline int f2444_7(int x) { return x * 7; }
+inline int f2444_8(int x) { return x * 8; }
+inline int f2444_9(int x) { return x * 9; }
+inline int f2444_10(int x) { return x * 10; }
+inline int f2444_11(int x) { return x * 11; }
+inline int f2444_12(int x) { return x * 12; }
+inline int f2444_13(int x) { return x * 13; }
+inline int f2444_14(int x) { return x * 14; }
+inline int f2444_15(int x) { return x * 15; }
+inline int f2444_16(int x) { return x * 16; }
+inline int f2444_17(int x) { return x * 17; }
+inline int f2444_18(int x) { return x * 18; }
+inline int f2444_19(int x) { return x * 19; }
+inline int f2444_20(int x) { return x * 20; }
+inline int f2444_21(int x) { return x * 21; }
+inline int f2444_22(int x) { return x * 22; }
+inline int f2444_23(int x) { return x * 23; }
+inline int f2444_24(int x) { return x * 24; }
+inline int f2444_25(int x) { return x * 25; }
+inline int f2444_26(int x) { return x * 26; }
+inline int f2444_27(int x) { return x * 27; }
+inline int f2444_28(int x) { return x * 28; }
+inline int f2444_29(int x) { return x * 29; }
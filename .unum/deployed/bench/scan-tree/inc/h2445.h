@@ -0,0 +1,42 @@
+#pragma once
+/* header 2445 */
+#include <vector>
+#include "h755.h"
+#include "h1757.h"
+#include "h2990.h"
+#include "h4549.h"
+#include "h7248.h"
+#ifdef X
+#include "h6762.h"
+#endif
+struct S2445 { int a; const char *s = "x//y"; };
+inline int f2445_0(int x) { return x * 0; }
+inline int f2445_1(int x) { return x * 1; }
+inline int f2445_2(int x) { return x * 2; }
+inline int f2445_3(int x) { return x * 3; }
+inline int f2445_4(int x) { return x * 4; }
+inline int f2445_5(int x) { return x * 5; }
+inline int f2445_6(int x) { return x * 6; }
+inline int f2445_7(int x) { return x * 7; }
+inline int f2445_8(int x) { return x * 8; }
+inline int f2445_9(int x) { return x * 9; }
+inline int f2445_10(int x) { return x * 10; }
+inline int f2445_11(int x) { return x * 11; }
+inline int f2445_12(int x) { return x * 12; }
+inline int f2445_13(int x) { return x * 13; }
+inline int f2445_14(int x) { return x * 14; }
+inline int f2445_15(int x) { return x * 15; }
+inline int f2445_16(int x) { return x * 16; }
+inline int f2445_17(int x) { return x * 17; }
+inline int f2445_18(int x) { return x * 18; }
+inline int f2445_19(int x) { return x * 19; }
+inline int f2445_20(int x) { return x * 20; }
+inline int f2445_21(int x) { return x * 21; }
+inline int f2445_22(int x) { return x * 22; }
+inline int f2445_23(int x) { return x * 23; }
+inline int f2445_24(int x) { return x * 24; }
+inline int f2445_25(int x) { return x * 25; }
+inline int f2445_26(int x) { return x * 26; }
+inline int f2445_27(int x) { return x * 27; }
+inline int f2445_28(int x) { return x * 28; }
+inline int f2445_29(int x) { return x * 29; }
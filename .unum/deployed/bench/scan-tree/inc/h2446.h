@@ -0,0 +1,42 @@
+#pragma once
+/* header 2446 */
+#include <vector>
+#include "h5329.h"
+#include "h3125.h"
+#include "h3880.h"
+#include "h1968.h"
+#include "h8697.h"
+#ifdef X
+#include "h5370.h"
+#endif
+struct S2446 { int a; const char *s = "x//y"; };
+inline int f2446_0(int x) { return x * 0; }
+inline int f2446_1(int x) { return x * 1; }
+inline int f2446_2(int x) { return x * 2; }
+inline int f2446_3(int x) { return x * 3; }
+inline int f2446_4(int x) { return x * 4; }
+inline int f2446_5(int x) { return x * 5; }
+inline int f2446_6(int x) { return x * 6; }
+inline int f2446_7(int x) { return x * 7; }
+inline int f2446_8(int x) { return x * 8; }
+inline int f2446_9(int x) { return x * 9; }
+inline int f2446_10(int x) { return x * 10; }
+inline int f2446_11(int x) { return x * 11; }
+inline int f2446_12(int x) { return x * 12; }
+inline int f2446_13(int x) { return x * 13; }
+inline int f2446_14(int x) { return x * 14; }
+inline int f2446_15(int x) { return x * 15; }
+inline int f2446_16(int x) { return x * 16; }
+inline int f2446_17(int x) { return x * 17; }
+inline int f2446_18(int x) { return x * 18; }
+inline int f2446_19(int x) { return x * 19; }
+inline int f2446_20(int x) { return x * 20; }
+inline int f2446_21(int x) { return x * 21; }
+inline int f2446_22(int x) { return x * 22; }
+inline int f2446_23(int x) { return x * 23; }
+inline int f2446_24(int x) { return x * 24; }
+inline int f2446_25(int x) { return x * 25; }
+inline int f2446_26(int x) { return x * 26; }
+inline int f2446_27(int x) { return x * 27; }
+inline int f2446_28(int x) { return x * 28; }
+inline int f2446_29(int x) { return x * 29; }
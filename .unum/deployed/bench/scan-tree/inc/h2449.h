@@ -0,0 +1,42 @@
+#pragma once
+/* header 2449 */
+#include <vector>
+#include "h1491.h"
+#include "h8127.h"
+#include "h9738.h"
+#include "h5721.h"
+#include "h4816.h"
+#ifdef X
+#include "h7682.h"
+#endif
+struct S2449 { int a; const char *s = "x//y"; };
+inline int f2449_0(int x) { return x * 0; }
+inline int f2449_1(int x) { return x * 1; }
+inline int f2449_2(int x) { return x * 2; }
+inline int f2449_3(int x) { return x * 3; }
+inline int f2449_4(int x) { return x * 4; }
+inline int f2449_5(int x) { return x * 5; }
+inline int f2449_6(int x) { return x * 6; }
+inline int f2449_7(int x) { return x * 7; }
+inline int f2449_8(int x) { return x * 8; }
+inline int f2449_9(int x) { return x * 9; }
+inline int f2449_10(int x) { return x * 10; }
+inline int f2449_11(int x) { return x * 11; }
+inline int f2449_12(int x) { return x * 12; }
+inline int f2449_13(int x) { return x * 13; }
+inline int f2449_14(int x) { return x * 14; }
+inline int f2449_15(int x) { return x * 15; }
+inline int f2449_16(int x) { return x * 16; }
+inline int f2449_17(int x) { return x * 17; }
+inline int f2449_18(int x) { return x * 18; }
+inline int f2449_19(int x) { return x * 19; }
+inline int f2449_20(int x) { return x * 20; }
+inline int f2449_21(int x) { return x * 21; }
+inline int f2449_22(int x) { return x * 22; }
+inline int f2449_23(int x) { return x * 23; }
+inline int f2449_24(int x) { return x * 24; }
+inline int f2449_25(int x) { return x * 25; }
+inline int f2449_26(int x) { return x * 26; }
+inline int f2449_27(int x) { return x * 27; }
+inline int f2449_28(int x) { return x * 28; }
+inline int f2449_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 245 */
+#include <vector>
+#include "h4254.h"
+#include "h6237.h"
+#include "h6594.h"
+#include "h7597.h"
+#include "h6264.h"
+#ifdef X
+#include "h4610.h"
+#endif
+struct S245 { int a; const char *s = "x//y"; };
+inline int f245_0(int x) { return x * 0; }
+inline int f245_1(int x) { return x * 1; }
+inline int f245_2(int x) { return x * 2; }
+inline int f245_3(int x) { return x * 3; }
+inline int f245_4(int x) { return x * 4; }
+inline int f245_5(int x) { return x * 5; }
+inline int f245_6(int x) { return x * 6; }
+inline int f245_7(int x) { return x * 7; }
+inline int f245_8(int x) { return x * 8; }
+inline int f245_9(int x) { return x * 9; }
+inline int f245_10(int x) { return x * 10; }
+inline int f245_11(int x) { return x * 11; }
+inline int f245_12(int x) { return x * 12; }
+inline int f245_13(int x) { return x * 13; }
+inline int f245_14(int x) { return x * 14; }
+inline int f245_15(int x) { return x * 15; }
+inline int f245_16(int x) { return x * 16; }
+inline int f245_17(int x) { return x * 17; }
+inline int f245_18(int x) { return x * 18; }
+inline int f245_19(int x) { return x * 19; }
+inline int f245_20(int x) { return x * 20; }
+inline int f245_21(int x) { return x * 21; }
+inline int f245_22(int x) { return x * 22; }
+inline int f245_23(int x) { return x * 23; }
+inline int f245_24(int x) { return x * 24; }
+inline int f245_25(int x) { return x * 25; }
+inline int f245_26(int x) { return x * 26; }
+inline int f245_27(int x) { return x * 27; }
+inline int f245_28(int x) { return x * 28; }
+inline int f245_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2452 */
+#include <vector>
+#include "h5438.h"
+#include "h7651.h"
+#include "h6974.h"
+#include "h9370.h"
+#include "h7271.h"
+#ifdef X
+#include "h8169.h"
+#endif
+struct S2452 { int a; const char *s = "x//y"; };
+inline int f2452_0(int x) { return x * 0; }
+inline int f2452_1(int x) { return x * 1; }
+inline int f2452_2(int x) { return x * 2; }
+inline int f2452_3(int x) { return x * 3; }
+inline int f2452_4(int x) { return x * 4; }
+inline int f2452_5(int x) { return x * 5; }
+inline int f2452_6(int x) { return x * 6; }
+inline int f2452_7(int x) { return x * 7; }
+inline int f2452_8(int x) { return x * 8; }
+inline int f2452_9(int x) { return x * 9; }
+inline int f2452_10(int x) { return x * 10; }
+inline int f2452_11(int x) { return x * 11; }
+inline int f2452_12(int x) { return x * 12; }
+inline int f2452_13(int x) { return x * 13; }
+inline int f2452_14(int x) { return x * 14; }
+inline int f2452_15(int x) { return x * 15; }
+inline int f2452_16(int x) { return x * 16; }
+inline int f2452_17(int x) { return x * 17; }
+inline int f2452_18(int x) { return x * 18; }
+inline int f2452_19(int x) { return x * 19; }
+inline int f2452_20(int x) { return x * 20; }
+inline int f2452_21(int x) { return x * 21; }
+inline int f2452_22(int x) { return x * 22; }
+inline int f2452_23(int x) { return x * 23; }
+inline int f2452_24(int x) { return x * 24; }
+inline int f2452_25(int x) { return x * 25; }
+inline int f2452_26(int x) { return x * 26; }
+inline int f2452_27(int x) { return x * 27; }
+inline int f2452_28(int x) { return x * 28; }
+inline int f2452_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2453 */
+#include <vector>
+#include "h8044.h"
+#include "h3833.h"
+#include "h8886.h"
+#include "h6705.h"
+#include "h73.h"
+#ifdef X
+#include "h1152.h"
+#endif
+struct S2453 { int a; const char *s = "x//y"; };
+inline int f2453_0(int x) { return x * 0; }
+inline int f2453_1(int x) { return x * 1; }
+inline int f2453_2(int x) { return x * 2; }
+inline int f2453_3(int x) { return x * 3; }
+inline int f2453_4(int x) { return x * 4; }
+inline int f2453_5(int x) { return x * 5; }
+inline int f2453_6(int x) { return x * 6; }
+inline int f2453_7(int x) { return x * 7; }
+inline int f2453_8(int x) { return x * 8; }
+inline int f2453_9(int x) { return x * 9; }
+inline int f2453_10(int x) { return x * 10; }
+inline int f2453_11(int x) { return x * 11; }
+inline int f2453_12(int x) { return x * 12; }
+inline int f2453_13(int x) { return x * 13; }
+inline int f2453_14(int x) { return x * 14; }
+inline int f2453_15(int x) { return x * 15; }
+inline int f2453_16(int x) { return x * 16; }
+inline int f2453_17(int x) { return x * 17; }
+inline int f2453_18(int x) { return x * 18; }
+inline int f2453_19(int x) { return x * 19; }
+inline int f2453_20(int x) { return x * 20; }
+inline int f2453_21(int x) { return x * 21; }
+inline int f2453_22(int x) { return x * 22; }
+inline int f2453_23(int x) { return x * 23; }
+inline int f2453_24(int x) { return x * 24; }
+inline int f2453_25(int x) { return x * 25; }
+inline int f2453_26(int x) { return x * 26; }
+inline int f2453_27(int x) { return x * 27; }
+inline int f2453_28(int x) { return x * 28; }
+inline int f2453_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2454 */
+#include <vector>
+#include "h3726.h"
+#include "h9655.h"
+#include "h7534.h"
+#include "h178.h"
+#include "h719.h"
+#ifdef X
+#include "h1231.h"
+#endif
+struct S2454 { int a; const char *s = "x//y"; };
+inline int f2454_0(int x) { return x * 0; }
+inline int f2454_1(int x) { return x * 1; }
+inline int f2454_2(int x) { return x * 2; }
+inline int f2454_3(int x) { return x * 3; }
+inline int f2454_4(int x) { return x * 4; }
+inline int f2454_5(int x) { return x * 5; }
+inline int f2454_6(int x) { return x * 6; }
+inline int f2454_7(int x) { return x * 7; }
+inline int f2454_8(int x) { return x * 8; }
+inline int f2454_9(int x) { return x * 9; }
+inline int f2454_10(int x) { return x * 10; }
+inline int f2454_11(int x) { return x * 11; }
+inline int f2454_12(int x) { return x * 12; }
+inline int f2454_13(int x) { return x * 13; }
+inline int f2454_14(int x) { return x * 14; }
+inline int f2454_15(int x) { return x * 15; }
+inline int f2454_16(int x) { return x * 16; }
+inline int f2454_17(int x) { return x * 17; }
+inline int f2454_18(int x) { return x * 18; }
+inline int f2454_19(int x) { return x * 19; }
+inline int f2454_20(int x) { return x * 20; }
+inline int f2454_21(int x) { return x * 21; }
+inline int f2454_22(int x) { return x * 22; }
+inline int f2454_23(int x) { return x * 23; }
+inline int f2454_24(int x) { return x * 24; }
+inline int f2454_25(int x) { return x * 25; }
+inline int f2454_26(int x) { return x * 26; }
+inline int f2454_27(int x) { return x * 27; }
+inline int f2454_28(int x) { return x * 28; }
+inline int f2454_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2455 */
+#include <vector>
+#include "h2286.h"
+#include "h4629.h"
+#include "h628.h"
+#include "h7570.h"
+#include "h3077.h"
+#ifdef X
+#include "h3209.h"
+#endif
+struct S2455 { int a; const char *s = "x//y"; };
+inline int f2455_0(int x) { return x * 0; }
+inline int f2455_1(int x) { return x * 1; }
+inline int f2455_2(int x) { return x * 2; }
+inline int f2455_3(int x) { return x * 3; }
+inline int f2455_4(int x) { return x * 4; }
+inline int f2455_5(int x) { return x * 5; }
+inline int f2455_6(int x) { return x * 6; }
+inline int f2455_7(int x) { return x * 7; }
+inline int f2455_8(int x) { return x * 8; }
+inline int f2455_9(int x) { return x * 9; }
+inline int f2455_10(int x) { return x * 10; }
+inline int f2455_11(int x) { return x * 11; }
+inline int f2455_12(int x) { return x * 12; }
+inline int f2455_13(int x) { return x * 13; }
+inline int f2455_14(int x) { return x * 14; }
+inline int f2455_15(int x) { return x * 15; }
+inline int f2455_16(int x) { return x * 16; }
+inline int f2455_17(int x) { return x * 17; }
+inline int f2455_18(int x) { return x * 18; }
+inline int f2455_19(int x) { return x * 19; }
+inline int f2455_20(int x) { return x * 20; }
+inline int f2455_21(int x) { return x * 21; }
+inline int f2455_22(int x) { return x * 22; }
+inline int f2455_23(int x) { return x * 23; }
+inline int f2455_24(int x) { return x * 24; }
+inline int f2455_25(int x) { return x * 25; }
+inline int f2455_26(int x) { return x * 26; }
+inline int f2455_27(int x) { return x * 27; }
+inline int f2455_28(int x) { return x * 28; }
+inline int f2455_29(int x) { return x * 29; }
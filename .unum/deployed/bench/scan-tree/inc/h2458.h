@@ -0,0 +1,42 @@
+#pragma once
+/* header 2458 */
+#include <vector>
+#include "h8022.h"
+#include "h9446.h"
+#include "h8000.h"
+#include "h821.h"
+#include "h408.h"
+#ifdef X
+#include "h7402.h"
+#endif
+struct S2458 { int a; const char *s = "x//y"; };
+inline int f2458_0(int x) { return x * 0; }
+inline int f2458_1(int x) { return x * 1; }
+inline int f2458_2(int x) { return x * 2; }
+inline int f2458_3(int x) { return x * 3; }
+inline int f2458_4(int x) { return x * 4; }
+inline int f2458_5(int x) { return x * 5; }
+inline int f2458_6(int x) { return x * 6; }
+inline int f2458_7(int x) { return x * 7; }
+inline int f2458_8(int x) { return x * 8; }
+inline int f2458_9(int x) { return x * 9; }
+inline int f2458_10(int x) { return x * 10; }
+inline int f2458_11(int x) { return x * 11; }
+inline int f2458_12(int x) { return x * 12; }
+inline int f2458_13(int x) { return x * 13; }
+inline int f2458_14(int x) { return x * 14; }
+inline int f2458_15(int x) { return x * 15; }
+inline int f2458_16(int x) { return x * 16; }
+inline int f2458_17(int x) { return x * 17; }
+inline int f2458_18(int x) { return x * 18; }
+inline int f2458_19(int x) { return x * 19; }
+inline int f2458_20(int x) { return x * 20; }
+inline int f2458_21(int x) { return x * 21; }
+inline int f2458_22(int x) { return x * 22; }
+inline int f2458_23(int x) { return x * 23; }
+inline int f2458_24(int x) { return x * 24; }
+inline int f2458_25(int x) { return x * 25; }
+inline int f2458_26(int x) { return x * 26; }
+inline int f2458_27(int x) { return x * 27; }
+inline int f2458_28(int x) { return x * 28; }
+inline int f2458_29(int x) { return x * 29; }
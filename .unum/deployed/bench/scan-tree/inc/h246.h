@@ -0,0 +1,42 @@
+#pragma once
+/* header 246 */
+#include <vector>
+#include "h8957.h"
+#include "h590.h"
+#include "h75.h"
+#include "h9328.h"
+#include "h5164.h"
+#ifdef X
+#include "h8185.h"
+#endif
+struct S246 { int a; const char *s = "x//y"; };
+inline int f246_0(int x) { return x * 0; }
+inline int f246_1(int x) { return x * 1; }
+inline int f246_2(int x) { return x * 2; }
+inline int f246_3(int x) { return x * 3; }
+inline int f246_4(int x) { return x * 4; }
+inline int f246_5(int x) { return x * 5; }
+inline int f246_6(int x) { return x * 6; }
+inline int f246_7(int x) { return x * 7; }
+inline int f246_8(int x) { return x * 8; }
+inline int f246_9(int x) { return x * 9; }
+inline int f246_10(int x) { return x * 10; }
+inline int f246_11(int x) { return x * 11; }
+inline int f246_12(int x) { return x * 12; }
+inline int f246_13(int x) { return x * 13; }
+inline int f246_14(int x) { return x * 14; }
+inline int f246_15(int x) { return x * 15; }
+inline int f246_16(int x) { return x * 16; }
+inline int f246_17(int x) { return x * 17; }
+inline int f246_18(int x) { return x * 18; }
+inline int f246_19(int x) { return x * 19; }
+inline int f246_20(int x) { return x * 20; }
+inline int f246_21(int x) { return x * 21; }
+inline int f246_22(int x) { return x * 22; }
+inline int f246_23(int x) { return x * 23; }
+inline int f246_24(int x) { return x * 24; }
+inline int f246_25(int x) { return x * 25; }
+inline int f246_26(int x) { return x * 26; }
+inline int f246_27(int x) { return x * 27; }
+inline int f246_28(int x) { return x * 28; }
+inline int f246_29(int x) { return x * 29; }
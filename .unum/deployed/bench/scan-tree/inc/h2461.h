@@ -0,0 +1,42 @@
+#pragma once
+/* header 2461 */
+#include <vector>
+#include "h3434.h"
+#include "h8730.h"
+#include "h6584.h"
+#include "h1679.h"
+#include "h746.h"
+#ifdef X
+#include "h7353.h"
+#endif
+struct S2461 { int a; const char *s = "x//y"; };
+inline int f2461_0(int x) { return x * 0; }
+inline int f2461_1(int x) { return x * 1; }
+inline int f2461_2(int x) { return x * 2; }
+inline int f2461_3(int x) { return x * 3; }
+inline int f2461_4(int x) { return x * 4; }
+inline int f2461_5(int x) { return x * 5; }
+inline int f2461_6(int x) { return x * 6; }
+inline int f2461_7(int x) { return x * 7; }
+inline int f2461_8(int x) { return x * 8; }
+inline int f2461_9(int x) { return x * 9; }
+inline int f2461_10(int x) { return x * 10; }
+inline int f2461_11(int x) { return x * 11; }
+inline int f2461_12(int x) { return x * 12; }
+inline int f2461_13(int x) { return x * 13; }
+inline int f2461_14(int x) { return x * 14; }
+inline int f2461_15(int x) { return x * 15; }
+inline int f2461_16(int x) { return x * 16; }
+inline int f2461_17(int x) { return x * 17; }
+inline int f2461_18(int x) { return x * 18; }
+inline int f2461_19(int x) { return x * 19; }
+inline int f2461_20(int x) { return x * 20; }
+inline int f2461_21(int x) { return x * 21; }
+inline int f2461_22(int x) { return x * 22; }
+inline int f2461_23(int x) { return x * 23; }
+inline int f2461_24(int x) { return x * 24; }
+inline int f2461_25(int x) { return x * 25; }
+inline int f2461_26(int x) { return x * 26; }
+inline int f2461_27(int x) { return x * 27; }
+inline int f2461_28(int x) { return x * 28; }
+inline int f2461_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2464 */
+#include <vector>
+#include "h3529.h"
+#include "h9653.h"
+#include "h2529.h"
+#include "h2829.h"
+#include "h3147.h"
+#ifdef X
+#include "h7713.h"
+#endif
+struct S2464 { int a; const char *s = "x//y"; };
+inline int f2464_0(int x) { return x * 0; }
+inline int f2464_1(int x) { return x * 1; }
+inline int f2464_2(int x) { return x * 2; }
+inline int f2464_3(int x) { return x * 3; }
+inline int f2464_4(int x) { return x * 4; }
+inline int f2464_5(int x) { return x * 5; }
+inline int f2464_6(int x) { return x * 6; }
+inline int f2464_7(int x) { return x * 7; }
+inline int f2464_8(int x) { return x * 8; }
+inline int f2464_9(int x) { return x * 9; }
+inline int f2464_10(int x) { return x * 10; }
+inline int f2464_11(int x) { return x * 11; }
+inline int f2464_12(int x) { return x * 12; }
+inline int f2464_13(int x) { return x * 13; }
+inline int f2464_14(int x) { return x * 14; }
+inline int f2464_15(int x) { return x * 15; }
+inline int f2464_16(int x) { return x * 16; }
+inline int f2464_17(int x) { return x * 17; }
+inline int f2464_18(int x) { return x * 18; }
+inline int f2464_19(int x) { return x * 19; }
+inline int f2464_20(int x) { return x * 20; }
+inline int f2464_21(int x) { return x * 21; }
+inline int f2464_22(int x) { return x * 22; }
+inline int f2464_23(int x) { return x * 23; }
+inline int f2464_24(int x) { return x * 24; }
+inline int f2464_25(int x) { return x * 25; }
+inline int f2464_26(int x) { return x * 26; }
+inline int f2464_27(int x) { return x * 27; }
+inline int f2464_28(int x) { return x * 28; }
+inline int f2464_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2465 */
+#include <vector>
+#include "h1066.h"
+#include "h5753.h"
+#include "h8642.h"
+#include "h4440.h"
+#include "h4305.h"
+#ifdef X
+#include "h6680.h"
+#endif
+struct S2465 { int a; const char *s = "x//y"; };
+inline int f2465_0(int x) { return x * 0; }
+inline int f2465_1(int x) { return x * 1; }
+inline int f2465_2(int x) { return x * 2; }
+inline int f2465_3(int x) { return x * 3; }
+inline int f2465_4(int x) { return x * 4; }
+inline int f2465_5(int x) { return x * 5; }
+inline int f2465_6(int x) { return x * 6; }
+inline int f2465_7(int x) { return x * 7; }
+inline int f2465_8(int x) { return x * 8; }
+inline int f2465_9(int x) { return x * 9; }
+inline int f2465_10(int x) { return x * 10; }
+inline int f2465_11(int x) { return x * 11; }
+inline int f2465_12(int x) { return x * 12; }
+inline int f2465_13(int x) { return x * 13; }
+inline int f2465_14(int x) { return x * 14; }
+inline int f2465_15(int x) { return x * 15; }
+inline int f2465_16(int x) { return x * 16; }
+inline int f2465_17(int x) { return x * 17; }
+inline int f2465_18(int x) { return x * 18; }
+inline int f2465_19(int x) { return x * 19; }
+inline int f2465_20(int x) { return x * 20; }
+inline int f2465_21(int x) { return x * 21; }
+inline int f2465_22(int x) { return x * 22; }
+inline int f2465_23(int x) { return x * 23; }
+inline int f2465_24(int x) { return x * 24; }
+inline int f2465_25(int x) { return x * 25; }
+inline int f2465_26(int x) { return x * 26; }
+inline int f2465_27(int x) { return x * 27; }
+inline int f2465_28(int x) { return x * 28; }
+inline int f2465_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2466 */
+#include <vector>
+#include "h2272.h"
+#include "h3277.h"
+#include "h8932.h"
+#include "h1688.h"
+#include "h9615.h"
+#ifdef X
+#include "h3126.h"
+#endif
+struct S2466 { int a; const char *s = "x//y"; };
+inline int f2466_0(int x) { return x * 0; }
+inline int f2466_1(int x) { return x * 1; }
+inline int f2466_2(int x) { return x * 2; }
+inline int f2466_3(int x) { return x * 3; }
+inline int f2466_4(int x) { return x * 4; }
+inline int f2466_5(int x) { return x * 5; }
+inline int f2466_6(int x) { return x * 6; }
+inline int f2466_7(int x) { return x * 7; }
+inline int f2466_8(int x) { return x * 8; }
+inline int f2466_9(int x) { return x * 9; }
+inline int f2466_10(int x) { return x * 10; }
+inline int f2466_11(int x) { return x * 11; }
+inline int f2466_12(int x) { return x * 12; }
+inline int f2466_13(int x) { return x * 13; }
+inline int f2466_14(int x) { return x * 14; }
+inline int f2466_15(int x) { return x * 15; }
+inline int f2466_16(int x) { return x * 16; }
+inline int f2466_17(int x) { return x * 17; }
+inline int f2466_18(int x) { return x * 18; }
+inline int f2466_19(int x) { return x * 19; }
+inline int f2466_20(int x) { return x * 20; }
+inline int f2466_21(int x) { return x * 21; }
+inline int f2466_22(int x) { return x * 22; }
+inline int f2466_23(int x) { return x * 23; }
+inline int f2466_24(int x) { return x * 24; }
+inline int f2466_25(int x) { return x * 25; }
+inline int f2466_26(int x) { return x * 26; }
+inline int f2466_27(int x) { return x * 27; }
+inline int f2466_28(int x) { return x * 28; }
+inline int f2466_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2474 */
+#include <vector>
+#include "h8448.h"
+#include "h7505.h"
+#include "h259.h"
+#include "h8119.h"
+#include "h6885.h"
+#ifdef X
+#include "h3827.h"
+#endif
+struct S2474 { int a; const char *s = "x//y"; };
+inline int f2474_0(int x) { return x * 0; }
+inline int f2474_1(int x) { return x * 1; }
+inline int f2474_2(int x) { return x * 2; }
+inline int f2474_3(int x) { return x * 3; }
+inline int f2474_4(int x) { return x * 4; }
+inline int f2474_5(int x) { return x * 5; }
+inline int f2474_6(int x) { return x * 6; }
+inline int f2474_7(int x) { return x * 7; }
+inline int f2474_8(int x) { return x * 8; }
+inline int f2474_9(int x) { return x * 9; }
+inline int f2474_10(int x) { return x * 10; }
+inline int f2474_11(int x) { return x * 11; }
+inline int f2474_12(int x) { return x * 12; }
+inline int f2474_13(int x) { return x * 13; }
+inline int f2474_14(int x) { return x * 14; }
+inline int f2474_15(int x) { return x * 15; }
+inline int f2474_16(int x) { return x * 16; }
+inline int f2474_17(int x) { return x * 17; }
+inline int f2474_18(int x) { return x * 18; }
+inline int f2474_19(int x) { return x * 19; }
+inline int f2474_20(int x) { return x * 20; }
+inline int f2474_21(int x) { return x * 21; }
+inline int f2474_22(int x) { return x * 22; }
+inline int f2474_23(int x) { return x * 23; }
+inline int f2474_24(int x) { return x * 24; }
+inline int f2474_25(int x) { return x * 25; }
+inline int f2474_26(int x) { return x * 26; }
+inline int f2474_27(int x) { return x * 27; }
+inline int f2474_28(int x) { return x * 28; }
+inline int f2474_29(int x) { return x * 29; }
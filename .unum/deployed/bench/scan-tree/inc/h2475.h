@@ -0,0 +1,42 @@
+#pragma once
+/* header 2475 */
+#include <vector>
+#include "h6105.h"
+#include "h3885.h"
+#include "h7844.h"
+#include "h828.h"
+#include "h6269.h"
+#ifdef X
+#include "h9665.h"
+#endif
+struct S2475 { int a; const char *s = "x//y"; };
+inline int f2475_0(int x) { return x * 0; }
+inline int f2475_1(int x) { return x * 1; }
+inline int f2475_2(int x) { return x * 2; }
+inline int f2475_3(int x) { return x * 3; }
+inline int f2475_4(int x) { return x * 4; }
+inline int f2475_5(int x) { return x * 5; }
+inline int f2475_6(int x) { return x * 6; }
+inline int f2475_7(int x) { return x * 7; }
+inline int f2475_8(int x) { return x * 8; }
+inline int f2475_9(int x) { return x * 9; }
+inline int f2475_10(int x) { return x * 10; }
+inline int f2475_11(int x) { return x * 11; }
+inline int f2475_12(int x) { return x * 12; }
+inline int f2475_13(int x) { return x * 13; }
+inline int f2475_14(int x) { return x * 14; }
+inline int f2475_15(int x) { return x * 15; }
+inline int f2475_16(int x) { return x * 16; }
+inline int f2475_17(int x) { return x * 17; }
+inline int f2475_18(int x) { return x * 18; }
+inline int f2475_19(int x) { return x * 19; }
+inline int f2475_20(int x) { return x * 20; }
+inline int f2475_21(int x) { return x * 21; }
+inline int f2475_22(int x) { return x * 22; }
+inline int f2475_23(int x) { return x * 23; }
+inline int f2475_24(int x) { return x * 24; }
+inline int f2475_25(int x) { return x * 25; }
+inline int f2475_26(int x) { return x * 26; }
+inline int f2475_27(int x) { return x * 27; }
+inline int f2475_28(int x) { return x * 28; }
+inline int f2475_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2477 */
+#include <vector>
+#include "h5458.h"
+#include "h9592.h"
+#include "h2094.h"
+#include "h0.h"
+#include "h7680.h"
+#ifdef X
+#include "h8592.h"
+#endif
+struct S2477 { int a; const char *s = "x//y"; };
+inline int f2477_0(int x) { return x * 0; }
+inline int f2477_1(int x) { return x * 1; }
+inline int f2477_2(int x) { return x * 2; }
+inline int f2477_3(int x) { return x * 3; }
+inline int f2477_4(int x) { return x * 4; }
+inline int f2477_5(int x) { return x * 5; }
+inline int f2477_6(int x) { return x * 6; }
+inline int f2477_7(int x) { return x * 7; }
+inline int f2477_8(int x) { return x * 8; }
+inline int f2477_9(int x) { return x * 9; }
+inline int f2477_10(int x) { return x * 10; }
+inline int f2477_11(int x) { return x * 11; }
+inline int f2477_12(int x) { return x * 12; }
+inline int f2477_13(int x) { return x * 13; }
+inline int f2477_14(int x) { return x * 14; }
+inline int f2477_15(int x) { return x * 15; }
+inline int f2477_16(int x) { return x * 16; }
+inline int f2477_17(int x) { return x * 17; }
+inline int f2477_18(int x) { return x * 18; }
+inline int f2477_19(int x) { return x * 19; }
+inline int f2477_20(int x) { return x * 20; }
+inline int f2477_21(int x) { return x * 21; }
+inline int f2477_22(int x) { return x * 22; }
+inline int f2477_23(int x) { return x * 23; }
+inline int f2477_24(int x) { return x * 24; }
+inline int f2477_25(int x) { return x * 25; }
+inline int f2477_26(int x) { return x * 26; }
+inline int f2477_27(int x) { return x * 27; }
+inline int f2477_28(int x) { return x * 28; }
+inline int f2477_29(int x) { return x * 29; }
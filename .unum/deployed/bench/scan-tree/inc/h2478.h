@@ -0,0 +1,42 @@
+#pragma once
+/* header 2478 */
+#include <vector>
+#include "h2168.h"
+#include "h6493.h"
+#include "h4560.h"
+#include "h6081.h"
+#include "h950.h"
+#ifdef X
+#include "h9724.h"
+#endif
+struct S2478 { int a; const char *s = "x//y"; };
+inline int f2478_0(int x) { return x * 0; }
+inline int f2478_1(int x) { return x * 1; }
+inline int f2478_2(int x) { return x * 2; }
+inline int f2478_3(int x) { return x * 3; }
+inline int f2478_4(int x) { return x * 4; }
+inline int f2478_5(int x) { return x * 5; }
+inline int f2478_6(int x) { return x * 6; }
+inline int f2478_7(int x) { return x * 7; }
+inline int f2478_8(int x) { return x * 8; }
+inline int f2478_9(int x) { return x * 9; }
+inline int f2478_10(int x) { return x * 10; }
+inline int f2478_11(int x) { return x * 11; }
+inline int f2478_12(int x) { return x * 12; }
+inline int f2478_13(int x) { return x * 13; }
+inline int f2478_14(int x) { return x * 14; }
+inline int f2478_15(int x) { return x * 15; }
+inline int f2478_16(int x) { return x * 16; }
+inline int f2478_17(int x) { return x * 17; }
+inline int f2478_18(int x) { return x * 18; }
+inline int f2478_19(int x) { return x * 19; }
+inline int f2478_20(int x) { return x * 20; }
+inline int f2478_21(int x) { return x * 21; }
+inline int f2478_22(int x) { return x * 22; }
+inline int f2478_23(int x) { return x * 23; }
+inline int f2478_24(int x) { return x * 24; }
+inline int f2478_25(int x) { return x * 25; }
+inline int f2478_26(int x) { return x * 26; }
+inline int f2478_27(int x) { return x * 27; }
+inline int f2478_28(int x) { return x * 28; }
+inline int f2478_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2481 */
+#include <vector>
+#include "h2456.h"
+#include "h1096.h"
+#include "h7476.h"
+#include "h11.h"
+#include "h4784.h"
+#ifdef X
+#include "h5726.h"
+#endif
+struct S2481 { int a; const char *s = "x//y"; };
+inline int f2481_0(int x) { return x * 0; }
+inline int f2481_1(int x) { return x * 1; }
+inline int f2481_2(int x) { return x * 2; }
+inline int f2481_3(int x) { return x * 3; }
+inline int f2481_4(int x) { return x * 4; }
+inline int f2481_5(int x) { return x * 5; }
+inline int f2481_6(int x) { return x * 6; }
+inline int f2481_7(int x) { return x * 7; }
+inline int f2481_8(int x) { return x * 8; }
+inline int f2481_9(int x) { return x * 9; }
+inline int f2481_10(int x) { return x * 10; }
+inline int f2481_11(int x) { return x * 11; }
+inline int f2481_12(int x) { return x * 12; }
+inline int f2481_13(int x) { return x * 13; }
+inline int f2481_14(int x) { return x * 14; }
+inline int f2481_15(int x) { return x * 15; }
+inline int f2481_16(int x) { return x * 16; }
+inline int f2481_17(int x) { return x * 17; }
+inline int f2481_18(int x) { return x * 18; }
+inline int f2481_19(int x) { return x * 19; }
+inline int f2481_20(int x) { return x * 20; }
+inline int f2481_21(int x) { return x * 21; }
+inline int f2481_22(int x) { return x * 22; }
+inline int f2481_23(int x) { return x * 23; }
+inline int f2481_24(int x) { return x * 24; }
+inline int f2481_25(int x) { return x * 25; }
+inline int f2481_26(int x) { return x * 26; }
+inline int f2481_27(int x) { return x * 27; }
+inline int f2481_28(int x) { return x * 28; }
+inline int f2481_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2485 */
+#include <vector>
+#include "h4243.h"
+#include "h2469.h"
+#include "h71.h"
+#include "h2522.h"
+#include "h2743.h"
+#ifdef X
+#include "h1314.h"
+#endif
+struct S2485 { int a; const char *s = "x//y"; };
+inline int f2485_0(int x) { return x * 0; }
+inline int f2485_1(int x) { return x * 1; }
+inline int f2485_2(int x) { return x * 2; }
+inline int f2485_3(int x) { return x * 3; }
+inline int f2485_4(int x) { return x * 4; }
+inline int f2485_5(int x) { return x * 5; }
+inline int f2485_6(int x) { return x * 6; }
+inline int f2485_7(int x) { return x * 7; }
+inline int f2485_8(int x) { return x * 8; }
+inline int f2485_9(int x) { return x * 9; }
+inline int f2485_10(int x) { return x * 10; }
+inline int f2485_11(int x) { return x * 11; }
+inline int f2485_12(int x) { return x * 12; }
+inline int f2485_13(int x) { return x * 13; }
+inline int f2485_14(int x) { return x * 14; }
+inline int f2485_15(int x) { return x * 15; }
+inline int f2485_16(int x) { return x * 16; }
+inline int f2485_17(int x) { return x * 17; }
+inline int f2485_18(int x) { return x * 18; }
+inline int f2485_19(int x) { return x * 19; }
+inline int f2485_20(int x) { return x * 20; }
+inline int f2485_21(int x) { return x * 21; }
+inline int f2485_22(int x) { return x * 22; }
+inline int f2485_23(int x) { return x * 23; }
+inline int f2485_24(int x) { return x * 24; }
+inline int f2485_25(int x) { return x * 25; }
+inline int f2485_26(int x) { return x * 26; }
+inline int f2485_27(int x) { return x * 27; }
+inline int f2485_28(int x) { return x * 28; }
+inline int f2485_29(int x) { return x * 29; }
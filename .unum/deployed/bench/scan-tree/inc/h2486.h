@@ -0,0 +1,42 @@
+#pragma once
+/* header 2486 */
+#include <vector>
+#include "h4990.h"
+#include "h6711.h"
+#include "h8758.h"
+#include "h8232.h"
+#include "h6651.h"
+#ifdef X
+#include "h3764.h"
+#endif
+struct S2486 { int a; const char *s = "x//y"; };
+inline int f2486_0(int x) { return x * 0; }
+inline int f2486_1(int x) { return x * 1; }
+inline int f2486_2(int x) { return x * 2; }
+inline int f2486_3(int x) { return x * 3; }
+inline int f2486_4(int x) { return x * 4; }
+inline int f2486_5(int x) { return x * 5; }
+inline int f2486_6(int x) { return x * 6; }
+inline int f2486_7(int x) { return x * 7; }
+inline int f2486_8(int x) { return x * 8; }
+inline int f2486_9(int x) { return x * 9; }
+inline int f2486_10(int x) { return x * 10; }
+inline int f2486_11(int x) { return x * 11; }
+inline int f2486_12(int x) { return x * 12; }
+inline int f2486_13(int x) { return x * 13; }
+inline int f2486_14(int x) { return x * 14; }
+inline int f2486_15(int x) { return x * 15; }
+inline int f2486_16(int x) { return x * 16; }
+inline int f2486_17(int x) { return x * 17; }
+inline int f2486_18(int x) { return x * 18; }
+inline int f2486_19(int x) { return x * 19; }
+inline int f2486_20(int x) { return x * 20; }
+inline int f2486_21(int x) { return x * 21; }
+inline int f2486_22(int x) { return x * 22; }
+inline int f2486_23(int x) { return x * 23; }
+inline int f2486_24(int x) { return x * 24; }
+inline int f2486_25(int x) { return x * 25; }
+inline int f2486_26(int x) { return x * 26; }
+inline int f2486_27(int x) { return x * 27; }
+inline int f2486_28(int x) { return x * 28; }
+inline int f2486_29(int x) { return x * 29; }
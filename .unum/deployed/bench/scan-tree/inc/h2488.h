@@ -0,0 +1,42 @@
+#pragma once
+/* header 2488 */
+#include <vector>
+#include "h3794.h"
+#include "h2093.h"
+#include "h6085.h"
+#include "h6126.h"
+#include "h4069.h"
+#ifdef X
+#include "h7410.h"
+#endif
+struct S2488 { int a; const char *s = "x//y"; };
+inline int f2488_0(int x) { return x * 0; }
+inline int f2488_1(int x) { return x * 1; }
+inline int f2488_2(int x) { return x * 2; }
+inline int f2488_3(int x) { return x * 3; }
+inline int f2488_4(int x) { return x * 4; }
+inline int f2488_5(int x) { return x * 5; }
+inline int f2488_6(int x) { return x * 6; }
+inline int f2488_7(int x) { return x * 7; }
+inline int f2488_8(int x) { return x * 8; }
+inline int f2488_9(int x) { return x * 9; }
+inline int f2488_10(int x) { return x * 10; }
+inline int f2488_11(int x) { return x * 11; }
+inline int f2488_12(int x) { return x * 12; }
+inline int f2488_13(int x) { return x * 13; }
+inline int f2488_14(int x) { return x * 14; }
+inline int f2488_15(int x) { return x * 15; }
+inline int f2488_16(int x) { return x * 16; }
+inline int f2488_17(int x) { return x * 17; }
+inline int f2488_18(int x) { return x * 18; }
+inline int f2488_19(int x) { return x * 19; }
+inline int f2488_20(int x) { return x * 20; }
+inline int f2488_21(int x) { return x * 21; }
+inline int f2488_22(int x) { return x * 22; }
+inline int f2488_23(int x) { return x * 23; }
+inline int f2488_24(int x) { return x * 24; }
+inline int f2488_25(int x) { return x * 25; }
+inline int f2488_26(int x) { return x * 26; }
+inline int f2488_27(int x) { return x * 27; }
+inline int f2488_28(int x) { return x * 28; }
+inline int f2488_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2493 */
+#include <vector>
+#include "h9257.h"
+#include "h1276.h"
+#include "h4009.h"
+#include "h6916.h"
+#include "h3122.h"
+#ifdef X
+#include "h4023.h"
+#endif
+struct S2493 { int a; const char *s = "x//y"; };
+inline int f2493_0(int x) { return x * 0; }
+inline int f2493_1(int x) { return x * 1; }
+inline int f2493_2(int x) { return x * 2; }
+inline int f2493_3(int x) { return x * 3; }
+inline int f2493_4(int x) { return x * 4; }
+inline int f2493_5(int x) { return x * 5; }
+inline int f2493_6(int x) { return x * 6; }
+inline int f2493_7(int x) { return x * 7; }
+inline int f2493_8(int x) { return x * 8; }
+inline int f2493_9(int x) { return x * 9; }
+inline int f2493_10(int x) { return x * 10; }
+inline int f2493_11(int x) { return x * 11; }
+inline int f2493_12(int x) { return x * 12; }
+inline int f2493_13(int x) { return x * 13; }
+inline int f2493_14(int x) { return x * 14; }
+inline int f2493_15(int x) { return x * 15; }
+inline int f2493_16(int x) { return x * 16; }
+inline int f2493_17(int x) { return x * 17; }
+inline int f2493_18(int x) { return x * 18; }
+inline int f2493_19(int x) { return x * 19; }
+inline int f2493_20(int x) { return x * 20; }
+inline int f2493_21(int x) { return x * 21; }
+inline int f2493_22(int x) { return x * 22; }
+inline int f2493_23(int x) { return x * 23; }
+inline int f2493_24(int x) { return x * 24; }
+inline int f2493_25(int x) { return x * 25; }
+inline int f2493_26(int x) { return x * 26; }
+inline int f2493_27(int x) { return x * 27; }
+inline int f2493_28(int x) { return x * 28; }
+inline int f2493_29(int x) { return x * 29; }
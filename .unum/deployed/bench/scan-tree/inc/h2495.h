@@ -0,0 +1,42 @@
+#pragma once
+/* header 2495 */
+#include <vector>
+#include "h5536.h"
+#include "h4753.h"
+#include "h3236.h"
+#include "h3198.h"
+#include "h8387.h"
+#ifdef X
+#include "h3305.h"
+#endif
+struct S2495 { int a; const char *s = "x//y"; };
+inline int f2495_0(int x) { return x * 0; }
+inline int f2495_1(int x) { return x * 1; }
+inline int f2495_2(int x) { return x * 2; }
+inline int f2495_3(int x) { return x * 3; }
+inline int f2495_4(int x) { return x * 4; }
+inline int f2495_5(int x) { return x * 5; }
+inline int f2495_6(int x) { return x * 6; }
+inline int f2495_7(int x) { return x * 7; }
+inline int f2495_8(int x) { return x * 8; }
+inline int f2495_9(int x) { return x * 9; }
+inline int f2495_10(int x) { return x * 10; }
+inline int f2495_11(int x) { return x * 11; }
+inline int f2495_12(int x) { return x * 12; }
+inline int f2495_13(int x) { return x * 13; }
+inline int f2495_14(int x) { return x * 14; }
+inline int f2495_15(int x) { return x * 15; }
+inline int f2495_16(int x) { return x * 16; }
+inline int f2495_17(int x) { return x * 17; }
+inline int f2495_18(int x) { return x * 18; }
+inline int f2495_19(int x) { return x * 19; }
+inline int f2495_20(int x) { return x * 20; }
+inline int f2495_21(int x) { return x * 21; }
+inline int f2495_22(int x) { return x * 22; }
+inline int f2495_23(int x) { return x * 23; }
+inline int f2495_24(int x) { return x * 24; }
+inline int f2495_25(int x) { return x * 25; }
+inline int f2495_26(int x) { return x * 26; }
+inline int f2495_27(int x) { return x * 27; }
+inline int f2495_28(int x) { return x * 28; }
+inline int f2495_29(int x) { return x * 29; }
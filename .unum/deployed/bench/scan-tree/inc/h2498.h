@@ -0,0 +1,42 @@
+#pragma once
+/* header 2498 */
+#include <vector>
+#include "h5233.h"
+#include "h3778.h"
+#include "h4857.h"
+#include "h9687.h"
+#include "h1227.h"
+#ifdef X
+#include "h6299.h"
+#endif
+struct S2498 { int a; const char *s = "x//y"; };
+inline int f2498_0(int x) { return x * 0; }
+inline int f2498_1(int x) { return x * 1; }
+inline int f2498_2(int x) { return x * 2; }
+inline int f2498_3(int x) { return x * 3; }
+inline int f2498_4(int x) { return x * 4; }
+inline int f2498_5(int x) { return x * 5; }
+inline int f2498_6(int x) { return x * 6; }
+inline int f2498_7(int x) { return x * 7; }
+inline int f2498_8(int x) { return x * 8; }
+inline int f2498_9(int x) { return x * 9; }
+inline int f2498_10(int x) { return x * 10; }
+inline int f2498_11(int x) { return x * 11; }
+inline int f2498_12(int x) { return x * 12; }
+inline int f2498_13(int x) { return x * 13; }
+inline int f2498_14(int x) { return x * 14; }
+inline int f2498_15(int x) { return x * 15; }
+inline int f2498_16(int x) { return x * 16; }
+inline int f2498_17(int x) { return x * 17; }
+inline int f2498_18(int x) { return x * 18; }
+inline int f2498_19(int x) { return x * 19; }
+inline int f2498_20(int x) { return x * 20; }
+inline int f2498_21(int x) { return x * 21; }
+inline int f2498_22(int x) { return x * 22; }
+inline int f2498_23(int x) { return x * 23; }
+inline int f2498_24(int x) { return x * 24; }
+inline int f2498_25(int x) { return x * 25; }
+inline int f2498_26(int x) { return x * 26; }
+inline int f2498_27(int x) { return x * 27; }
+inline int f2498_28(int x) { return x * 28; }
+inline int f2498_29(int x) { return x * 29; }
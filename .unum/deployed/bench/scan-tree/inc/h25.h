@@ -0,0 +1,42 @@
+#pragma once
+/* header 25 */
+#include <vector>
+#include "h8410.h"
+#include "h8781.h"
+#include "h5747.h"
+#include "h6742.h"
+#include "h2415.h"
+#ifdef X
+#include "h6069.h"
+#endif
+struct S25 { int a; const char *s = "x//y"; };
+inline int f25_0(int x) { return x * 0; }
+inline int f25_1(int x) { return x * 1; }
+inline int f25_2(int x) { return x * 2; }
+inline int f25_3(int x) { return x * 3; }
+inline int f25_4(int x) { return x * 4; }
+inline int f25_5(int x) { return x * 5; }
+inline int f25_6(int x) { return x * 6; }
+inline int f25_7(int x) { return x * 7; }
+inline int f25_8(int x) { return x * 8; }
+inline int f25_9(int x) { return x * 9; }
+inline int f25_10(int x) { return x * 10; }
+inline int f25_11(int x) { return x * 11; }
+inline int f25_12(int x) { return x * 12; }
+inline int f25_13(int x) { return x * 13; }
+inline int f25_14(int x) { return x * 14; }
+inline int f25_15(int x) { return x * 15; }
+inline int f25_16(int x) { return x * 16; }
+inline int f25_17(int x) { return x * 17; }
+inline int f25_18(int x) { return x * 18; }
+inline int f25_19(int x) { return x * 19; }
+inline int f25_20(int x) { return x * 20; }
+inline int f25_21(int x) { return x * 21; }
+inline int f25_22(int x) { return x * 22; }
+inline int f25_23(int x) { return x * 23; }
+inline int f25_24(int x) { return x * 24; }
+inline int f25_25(int x) { return x * 25; }
+inline int f25_26(int x) { return x * 26; }
+inline int f25_27(int x) { return x * 27; }
+inline int f25_28(int x) { return x * 28; }
+inline int f25_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 250 */
+#include <vector>
+#include "h8949.h"
+#include "h1178.h"
+#include "h6548.h"
+#include "h2174.h"
+#include "h6116.h"
+#ifdef X
+#include "h6.h"
+#endif
+struct S250 { int a; const char *s = "x//y"; };
+inline int f250_0(int x) { return x * 0; }
+inline int f250_1(int x) { return x * 1; }
+inline int f250_2(int x) { return x * 2; }
+inline int f250_3(int x) { return x * 3; }
+inline int f250_4(int x) { return x * 4; }
+inline int f250_5(int x) { return x * 5; }
+inline int f250_6(int x) { return x * 6; }
+inline int f250_7(int x) { return x * 7; }
+inline int f250_8(int x) { return x * 8; }
+inline int f250_9(int x) { return x * 9; }
+inline int f250_10(int x) { return x * 10; }
+inline int f250_11(int x) { return x * 11; }
+inline int f250_12(int x) { return x * 12; }
+inline int f250_13(int x) { return x * 13; }
+inline int f250_14(int x) { return x * 14; }
+inline int f250_15(int x) { return x * 15; }
+inline int f250_16(int x) { return x * 16; }
+inline int f250_17(int x) { return x * 17; }
+inline int f250_18(int x) { return x * 18; }
+inline int f250_19(int x) { return x * 19; }
+inline int f250_20(int x) { return x * 20; }
+inline int f250_21(int x) { return x * 21; }
+inline int f250_22(int x) { return x * 22; }
+inline int f250_23(int x) { return x * 23; }
+inline int f250_24(int x) { return x * 24; }
+inline int f250_25(int x) { return x * 25; }
+inline int f250_26(int x) { return x * 26; }
+inline int f250_27(int x) { return x * 27; }
+inline int f250_28(int x) { return x * 28; }
+inline int f250_29(int x) { return x * 29; }
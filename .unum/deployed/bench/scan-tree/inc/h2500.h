@@ -0,0 +1,42 @@
+#pragma once
+/* header 2500 */
+#include <vector>
+#include "h316.h"
+#include "h8433.h"
+#include "h6010.h"
+#include "h5883.h"
+#include "h8881.h"
+#ifdef X
+#include "h989.h"
+#endif
+struct S2500 { int a; const char *s = "x//y"; };
+inline int f2500_0(int x) { return x * 0; }
+inline int f2500_1(int x) { return x * 1; }
+inline int f2500_2(int x) { return x * 2; }
+inline int f2500_3(int x) { return x * 3; }
+inline int f2500_4(int x) { return x * 4; }
+inline int f2500_5(int x) { return x * 5; }
+inline int f2500_6(int x) { return x * 6; }
+inline int f2500_7(int x) { return x * 7; }
+inline int f2500_8(int x) { return x * 8; }
+inline int f2500_9(int x) { return x * 9; }
+inline int f2500_10(int x) { return x * 10; }
+inline int f2500_11(int x) { return x * 11; }
+inline int f2500_12(int x) { return x * 12; }
+inline int f2500_13(int x) { return x * 13; }
+inline int f2500_14(int x) { return x * 14; }
+inline int f2500_15(int x) { return x * 15; }
+inline int f2500_16(int x) { return x * 16; }
+inline int f2500_17(int x) { return x * 17; }
+inline int f2500_18(int x) { return x * 18; }
+inline int f2500_19(int x) { return x * 19; }
+inline int f2500_20(int x) { return x * 20; }
+inline int f2500_21(int x) { return x * 21; }
+inline int f2500_22(int x) { return x * 22; }
+inline int f2500_23(int x) { return x * 23; }
+inline int f2500_24(int x) { return x * 24; }
+inline int f2500_25(int x) { return x * 25; }
+inline int f2500_26(int x) { return x * 26; }
+inline int f2500_27(int x) { return x * 27; }
+inline int f2500_28(int x) { return x * 28; }
+inline int f2500_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2508 */
+#include <vector>
+#include "h3804.h"
+#include "h7177.h"
+#include "h3407.h"
+#include "h3265.h"
+#include "h4405.h"
+#ifdef X
+#include "h1820.h"
+#endif
+struct S2508 { int a; const char *s = "x//y"; };
+inline int f2508_0(int x) { return x * 0; }
+inline int f2508_1(int x) { return x * 1; }
+inline int f2508_2(int x) { return x * 2; }
+inline int f2508_3(int x) { return x * 3; }
+inline int f2508_4(int x) { return x * 4; }
+inline int f2508_5(int x) { return x * 5; }
+inline int f2508_6(int x) { return x * 6; }
+inline int f2508_7(int x) { return x * 7; }
+inline int f2508_8(int x) { return x * 8; }
+inline int f2508_9(int x) { return x * 9; }
+inline int f2508_10(int x) { return x * 10; }
+inline int f2508_11(int x) { return x * 11; }
+inline int f2508_12(int x) { return x * 12; }
+inline int f2508_13(int x) { return x * 13; }
+inline int f2508_14(int x) { return x * 14; }
+inline int f2508_15(int x) { return x * 15; }
+inline int f2508_16(int x) { return x * 16; }
+inline int f2508_17(int x) { return x * 17; }
+inline int f2508_18(int x) { return x * 18; }
+inline int f2508_19(int x) { return x * 19; }
+inline int f2508_20(int x) { return x * 20; }
+inline int f2508_21(int x) { return x * 21; }
+inline int f2508_22(int x) { return x * 22; }
+inline int f2508_23(int x) { return x * 23; }
+inline int f2508_24(int x) { return x * 24; }
+inline int f2508_25(int x) { return x * 25; }
+inline int f2508_26(int x) { return x * 26; }
+inline int f2508_27(int x) { return x * 27; }
+inline int f2508_28(int x) { return x * 28; }
+inline int f2508_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2509 */
+#include <vector>
+#include "h9361.h"
+#include "h5483.h"
+#include "h7044.h"
+#include "h8762.h"
+#include "h8200.h"
+#ifdef X
+#include "h4521.h"
+#endif
+struct S2509 { int a; const char *s = "x//y"; };
+inline int f2509_0(int x) { return x * 0; }
+inline int f2509_1(int x) { return x * 1; }
+inline int f2509_2(int x) { return x * 2; }
+inline int f2509_3(int x) { return x * 3; }
+inline int f2509_4(int x) { return x * 4; }
+inline int f2509_5(int x) { return x * 5; }
+inline int f2509_6(int x) { return x * 6; }
+inline int f2509_7(int x) { return x * 7; }
+inline int f2509_8(int x) { return x * 8; }
+inline int f2509_9(int x) { return x * 9; }
+inline int f2509_10(int x) { return x * 10; }
+inline int f2509_11(int x) { return x * 11; }
+inline int f2509_12(int x) { return x * 12; }
+inline int f2509_13(int x) { return x * 13; }
+inline int f2509_14(int x) { return x * 14; }
+inline int f2509_15(int x) { return x * 15; }
+inline int f2509_16(int x) { return x * 16; }
+inline int f2509_17(int x) { return x * 17; }
+inline int f2509_18(int x) { return x * 18; }
+inline int f2509_19(int x) { return x * 19; }
+inline int f2509_20(int x) { return x * 20; }
+inline int f2509_21(int x) { return x * 21; }
+inline int f2509_22(int x) { return x * 22; }
+inline int f2509_23(int x) { return x * 23; }
+inline int f2509_24(int x) { return x * 24; }
+inline int f2509_25(int x) { return x * 25; }
+inline int f2509_26(int x) { return x * 26; }
+inline int f2509_27(int x) { return x * 27; }
+inline int f2509_28(int x) { return x * 28; }
+inline int f2509_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2512 */
+#include <vector>
+#include "h3224.h"
+#include "h5962.h"
+#include "h4404.h"
+#include "h1127.h"
+#include "h7246.h"
+#ifdef X
+#include "h132.h"
+#endif
+struct S2512 { int a; const char *s = "x//y"; };
+inline int f2512_0(int x) { return x * 0; }
+inline int f2512_1(int x) { return x * 1; }
+inline int f2512_2(int x) { return x * 2; }
+inline int f2512_3(int x) { return x * 3; }
+inline int f2512_4(int x) { return x * 4; }
+inline int f2512_5(int x) { return x * 5; }
+inline int f2512_6(int x) { return x * 6; }
+inline int f2512_7(int x) { return x * 7; }
+inline int f2512_8(int x) { return x * 8; }
+inline int f2512_9(int x) { return x * 9; }
+inline int f2512_10(int x) { return x * 10; }
+inline int f2512_11(int x) { return x * 11; }
+inline int f2512_12(int x) { return x * 12; }
+inline int f2512_13(int x) { return x * 13; }
+inline int f2512_14(int x) { return x * 14; }
+inline int f2512_15(int x) { return x * 15; }
+inline int f2512_16(int x) { return x * 16; }
+inline int f2512_17(int x) { return x * 17; }
+inline int f2512_18(int x) { return x * 18; }
+inline int f2512_19(int x) { return x * 19; }
+inline int f2512_20(int x) { return x * 20; }
+inline int f2512_21(int x) { return x * 21; }
+inline int f2512_22(int x) { return x * 22; }
+inline int f2512_23(int x) { return x * 23; }
+inline int f2512_24(int x) { return x * 24; }
+inline int f2512_25(int x) { return x * 25; }
+inline int f2512_26(int x) { return x * 26; }
+inline int f2512_27(int x) { return x * 27; }
+inline int f2512_28(int x) { return x * 28; }
+inline int f2512_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2513 */
+#include <vector>
+#include "h5530.h"
+#include "h6277.h"
+#include "h5001.h"
+#include "h5084.h"
+#include "h6206.h"
+#ifdef X
+#include "h7940.h"
+#endif
+struct S2513 { int a; const char *s = "x//y"; };
+inline int f2513_0(int x) { return x * 0; }
+inline int f2513_1(int x) { return x * 1; }
+inline int f2513_2(int x) { return x * 2; }
+inline int f2513_3(int x) { return x * 3; }
+inline int f2513_4(int x) { return x * 4; }
+inline int f2513_5(int x) { return x * 5; }
+inline int f2513_6(int x) { return x * 6; }
+inline int f2513_7(int x) { return x * 7; }
+inline int f2513_8(int x) { return x * 8; }
+inline int f2513_9(int x) { return x * 9; }
+inline int f2513_10(int x) { return x * 10; }
+inline int f2513_11(int x) { return x * 11; }
+inline int f2513_12(int x) { return x * 12; }
+inline int f2513_13(int x) { return x * 13; }
+inline int f2513_14(int x) { return x * 14; }
+inline int f2513_15(int x) { return x * 15; }
+inline int f2513_16(int x) { return x * 16; }
+inline int f2513_17(int x) { return x * 17; }
+inline int f2513_18(int x) { return x * 18; }
+inline int f2513_19(int x) { return x * 19; }
+inline int f2513_20(int x) { return x * 20; }
+inline int f2513_21(int x) { return x * 21; }
+inline int f2513_22(int x) { return x * 22; }
+inline int f2513_23(int x) { return x * 23; }
+inline int f2513_24(int x) { return x * 24; }
+inline int f2513_25(int x) { return x * 25; }
+inline int f2513_26(int x) { return x * 26; }
+inline int f2513_27(int x) { return x * 27; }
+inline int f2513_28(int x) { return x * 28; }
+inline int f2513_29(int x) { return x * 29; }
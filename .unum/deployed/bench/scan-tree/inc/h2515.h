@@ -0,0 +1,42 @@
+#pragma once
+/* header 2515 */
+#include <vector>
+#include "h195.h"
+#include "h6000.h"
+#include "h3163.h"
+#include "h8364.h"
+#include "h8687.h"
+#ifdef X
+#include "h9469.h"
+#endif
+struct S2515 { int a; const char *s = "x//y"; };
+inline int f2515_0(int x) { return x * 0; }
+inline int f2515_1(int x) { return x * 1; }
+inline int f2515_2(int x) { return x * 2; }
+inline int f2515_3(int x) { return x * 3; }
+inline int f2515_4(int x) { return x * 4; }
+inline int f2515_5(int x) { return x * 5; }
+inline int f2515_6(int x) { return x * 6; }
+inline int f2515_7(int x) { return x * 7; }
+inline int f2515_8(int x) { return x * 8; }
+inline int f2515_9(int x) { return x * 9; }
+inline int f2515_10(int x) { return x * 10; }
+inline int f2515_11(int x) { return x * 11; }
+inline int f2515_12(int x) { return x * 12; }
+inline int f2515_13(int x) { return x * 13; }
+inline int f2515_14(int x) { return x * 14; }
+inline int f2515_15(int x) { return x * 15; }
+inline int f2515_16(int x) { return x * 16; }
+inline int f2515_17(int x) { return x * 17; }
+inline int f2515_18(int x) { return x * 18; }
+inline int f2515_19(int x) { return x * 19; }
+inline int f2515_20(int x) { return x * 20; }
+inline int f2515_21(int x) { return x * 21; }
+inline int f2515_22(int x) { return x * 22; }
+inline int f2515_23(int x) { return x * 23; }
+inline int f2515_24(int x) { return x * 24; }
+inline int f2515_25(int x) { return x * 25; }
+inline int f2515_26(int x) { return x * 26; }
+inline int f2515_27(int x) { return x * 27; }
+inline int f2515_28(int x) { return x * 28; }
+inline int f2515_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2516 */
+#include <vector>
+#include "h14.h"
+#include "h8633.h"
+#include "h9507.h"
+#include "h9885.h"
+#include "h5451.h"
+#ifdef X
+#include "h3012.h"
+#endif
+struct S2516 { int a; const char *s = "x//y"; };
+inline int f2516_0(int x) { return x * 0; }
+inline int f2516_1(int x) { return x * 1; }
+inline int f2516_2(int x) { return x * 2; }
+inline int f2516_3(int x) { return x * 3; }
+inline int f2516_4(int x) { return x * 4; }
+inline int f2516_5(int x) { return x * 5; }
+inline int f2516_6(int x) { return x * 6; }
+inline int f2516_7(int x) { return x * 7; }
+inline int f2516_8(int x) { return x * 8; }
+inline int f2516_9(int x) { return x * 9; }
+inline int f2516_10(int x) { return x * 10; }
+inline int f2516_11(int x) { return x * 11; }
+inline int f2516_12(int x) { return x * 12; }
+inline int f2516_13(int x) { return x * 13; }
+inline int f2516_14(int x) { return x * 14; }
+inline int f2516_15(int x) { return x * 15; }
+inline int f2516_16(int x) { return x * 16; }
+inline int f2516_17(int x) { return x * 17; }
+inline int f2516_18(int x) { return x * 18; }
+inline int f2516_19(int x) { return x * 19; }
+inline int f2516_20(int x) { return x * 20; }
+inline int f2516_21(int x) { return x * 21; }
+inline int f2516_22(int x) { return x * 22; }
+inline int f2516_23(int x) { return x * 23; }
+inline int f2516_24(int x) { return x * 24; }
+inline int f2516_25(int x) { return x * 25; }
+inline int f2516_26(int x) { return x * 26; }
+inline int f2516_27(int x) { return x * 27; }
+inline int f2516_28(int x) { return x * 28; }
+inline int f2516_29(int x) { return x * 29; }
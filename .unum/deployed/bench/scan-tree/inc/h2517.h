@@ -0,0 +1,42 @@
+#pragma once
+/* header 2517 */
+#include <vector>
+#include "h9833.h"
+#include "h2997.h"
+#include "h5379.h"
+#include "h9646.h"
+#include "h1563.h"
+#ifdef X
+#include "h2312.h"
+#endif
+struct S2517 { int a; const char *s = "x//y"; };
+inline int f2517_0(int x) { return x * 0; }
+inline int f2517_1(int x) { return x * 1; }
+inline int f2517_2(int x) { return x * 2; }
+inline int f2517_3(int x) { return x * 3; }
+inline int f2517_4(int x) { return x * 4; }
+inline int f2517_5(int x) { return x * 5; }
+inline int f2517_6(int x) { return x * 6; }
+inline int f2517_7(int x) { return x * 7; }
+inline int f2517_8(int x) { return x * 8; }
+inline int f2517_9(int x) { return x * 9; }
+inline int f2517_10(int x) { return x * 10; }
+inline int f2517_11(int x) { return x * 11; }
+inline int f2517_12(int x) { return x * 12; }
+inline int f2517_13(int x) { return x * 13; }
+inline int f2517_14(int x) { return x * 14; }
+inline int f2517_15(int x) { return x * 15; }
+inline int f2517_16(int x) { return x * 16; }
+inline int f2517_17(int x) { return x * 17; }
+inline int f2517_18(int x) { return x * 18; }
+inline int f2517_19(int x) { return x * 19; }
+inline int f2517_20(int x) { return x * 20; }
+inline int f2517_21(int x) { return x * 21; }
+inline int f2517_22(int x) { return x * 22; }
+inline int f2517_23(int x) { return x * 23; }
+inline int f2517_24(int x) { return x * 24; }
+inline int f2517_25(int x) { return x * 25; }
+inline int f2517_26(int x) { return x * 26; }
+inline int f2517_27(int x) { return x * 27; }
+inline int f2517_28(int x) { return x * 28; }
+inline int f2517_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2519 */
+#include <vector>
+#include "h256.h"
+#include "h2540.h"
+#include "h6059.h"
+#include "h9649.h"
+#include "h419.h"
+#ifdef X
+#include "h923.h"
+#endif
+struct S2519 { int a; const char *s = "x//y"; };
+inline int f2519_0(int x) { return x * 0; }
+inline int f2519_1(int x) { return x * 1; }
+inline int f2519_2(int x) { return x * 2; }
+inline int f2519_3(int x) { return x * 3; }
+inline int f2519_4(int x) { return x * 4; }
+inline int f2519_5(int x) { return x * 5; }
+inline int f2519_6(int x) { return x * 6; }
+inline int f2519_7(int x) { return x * 7; }
+inline int f2519_8(int x) { return x * 8; }
+inline int f2519_9(int x) { return x * 9; }
+inline int f2519_10(int x) { return x * 10; }
+inline int f2519_11(int x) { return x * 11; }
+inline int f2519_12(int x) { return x * 12; }
+inline int f2519_13(int x) { return x * 13; }
+inline int f2519_14(int x) { return x * 14; }
+inline int f2519_15(int x) { return x * 15; }
+inline int f2519_16(int x) { return x * 16; }
+inline int f2519_17(int x) { return x * 17; }
+inline int f2519_18(int x) { return x * 18; }
+inline int f2519_19(int x) { return x * 19; }
+inline int f2519_20(int x) { return x * 20; }
+inline int f2519_21(int x) { return x * 21; }
+inline int f2519_22(int x) { return x * 22; }
+inline int f2519_23(int x) { return x * 23; }
+inline int f2519_24(int x) { return x * 24; }
+inline int f2519_25(int x) { return x * 25; }
+inline int f2519_26(int x) { return x * 26; }
+inline int f2519_27(int x) { return x * 27; }
+inline int f2519_28(int x) { return x * 28; }
+inline int f2519_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2520 */
+#include <vector>
+#include "h5871.h"
+#include "h2539.h"
+#include "h9246.h"
+#include "h1238.h"
+#include "h2623.h"
+#ifdef X
+#include "h5196.h"
+#endif
+struct S2520 { int a; const char *s = "x//y"; };
+inline int f2520_0(int x) { return x * 0; }
+inline int f2520_1(int x) { return x * 1; }
+inline int f2520_2(int x) { return x * 2; }
+inline int f2520_3(int x) { return x * 3; }
+inline int f2520_4(int x) { return x * 4; }
+inline int f2520_5(int x) { return x * 5; }
+inline int f2520_6(int x) { return x * 6; }
+inline int f2520_7(int x) { return x * 7; }
+inline int f2520_8(int x) { return x * 8; }
+inline int f2520_9(int x) { return x * 9; }
+inline int f2520_10(int x) { return x * 10; }
+inline int f2520_11(int x) { return x * 11; }
+inline int f2520_12(int x) { return x * 12; }
+inline int f2520_13(int x) { return x * 13; }
+inline int f2520_14(int x) { return x * 14; }
+inline int f2520_15(int x) { return x * 15; }
+inline int f2520_16(int x) { return x * 16; }
+inline int f2520_17(int x) { return x * 17; }
+inline int f2520_18(int x) { return x * 18; }
+inline int f2520_19(int x) { return x * 19; }
+inline int f2520_20(int x) { return x * 20; }
+inline int f2520_21(int x) { return x * 21; }
+inline int f2520_22(int x) { return x * 22; }
+inline int f2520_23(int x) { return x * 23; }
+inline int f2520_24(int x) { return x * 24; }
+inline int f2520_25(int x) { return x * 25; }
+inline int f2520_26(int x) { return x * 26; }
+inline int f2520_27(int x) { return x * 27; }
+inline int f2520_28(int x) { return x * 28; }
+inline int f2520_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2521 */
+#include <vector>
+#include "h7617.h"
+#include "h5594.h"
+#include "h9718.h"
+#include "h9937.h"
+#include "h4374.h"
+#ifdef X
+#include "h9129.h"
+#endif
+struct S2521 { int a; const char *s = "x//y"; };
+inline int f2521_0(int x) { return x * 0; }
+inline int f2521_1(int x) { return x * 1; }
+inline int f2521_2(int x) { return x * 2; }
+inline int f2521_3(int x) { return x * 3; }
+inline int f2521_4(int x) { return x * 4; }
+inline int f2521_5(int x) { return x * 5; }
+inline int f2521_6(int x) { return x * 6; }
+inline int f2521_7(int x) { return x * 7; }
+inline int f2521_8(int x) { return x * 8; }
+inline int f2521_9(int x) { return x * 9; }
+inline int f2521_10(int x) { return x * 10; }
+inline int f2521_11(int x) { return x * 11; }
+inline int f2521_12(int x) { return x * 12; }
+inline int f2521_13(int x) { return x * 13; }
+inline int f2521_14(int x) { return x * 14; }
+inline int f2521_15(int x) { return x * 15; }
+inline int f2521_16(int x) { return x * 16; }
+inline int f2521_17(int x) { return x * 17; }
+inline int f2521_18(int x) { return x * 18; }
+inline int f2521_19(int x) { return x * 19; }
+inline int f2521_20(int x) { return x * 20; }
+inline int f2521_21(int x) { return x * 21; }
+inline int f2521_22(int x) { return x * 22; }
+inline int f2521_23(int x) { return x * 23; }
+inline int f2521_24(int x) { return x * 24; }
+inline int f2521_25(int x) { return x * 25; }
+inline int f2521_26(int x) { return x * 26; }
+inline int f2521_27(int x) { return x * 27; }
+inline int f2521_28(int x) { return x * 28; }
+inline int f2521_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2523 */
+#include <vector>
+#include "h3661.h"
+#include "h7818.h"
+#include "h8710.h"
+#include "h8994.h"
+#include "h9742.h"
+#ifdef X
+#include "h5076.h"
+#endif
+struct S2523 { int a; const char *s = "x//y"; };
+inline int f2523_0(int x) { return x * 0; }
+inline int f2523_1(int x) { return x * 1; }
+inline int f2523_2(int x) { return x * 2; }
+inline int f2523_3(int x) { return x * 3; }
+inline int f2523_4(int x) { return x * 4; }
+inline int f2523_5(int x) { return x * 5; }
+inline int f2523_6(int x) { return x * 6; }
+inline int f2523_7(int x) { return x * 7; }
+inline int f2523_8(int x) { return x * 8; }
+inline int f2523_9(int x) { return x * 9; }
+inline int f2523_10(int x) { return x * 10; }
+inline int f2523_11(int x) { return x * 11; }
+inline int f2523_12(int x) { return x * 12; }
+inline int f2523_13(int x) { return x * 13; }
+inline int f2523_14(int x) { return x * 14; }
+inline int f2523_15(int x) { return x * 15; }
+inline int f2523_16(int x) { return x * 16; }
+inline int f2523_17(int x) { return x * 17; }
+inline int f2523_18(int x) { return x * 18; }
+inline int f2523_19(int x) { return x * 19; }
+inline int f2523_20(int x) { return x * 20; }
+inline int f2523_21(int x) { return x * 21; }
+inline int f2523_22(int x) { return x * 22; }
+inline int f2523_23(int x) { return x * 23; }
+inline int f2523_24(int x) { return x * 24; }
+inline int f2523_25(int x) { return x * 25; }
+inline int f2523_26(int x) { return x * 26; }
+inline int f2523_27(int x) { return x * 27; }
+inline int f2523_28(int x) { return x * 28; }
+inline int f2523_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2524 */
+#include <vector>
+#include "h4263.h"
+#include "h3513.h"
+#include "h9959.h"
+#include "h5226.h"
+#include "h9835.h"
+#ifdef X
+#include "h6939.h"
+#endif
+struct S2524 { int a; const char *s = "x//y"; };
+inline int f2524_0(int x) { return x * 0; }
+inline int f2524_1(int x) { return x * 1; }
+inline int f2524_2(int x) { return x * 2; }
+inline int f2524_3(int x) { return x * 3; }
+inline int f2524_4(int x) { return x * 4; }
+inline int f2524_5(int x) { return x * 5; }
+inline int f2524_6(int x) { return x * 6; }
+inline int f2524_7(int x) { return x * 7; }
+inline int f2524_8(int x) { return x * 8; }
+inline int f2524_9(int x) { return x * 9; }
+inline int f2524_10(int x) { return x * 10; }
+inline int f2524_11(int x) { return x * 11; }
+inline int f2524_12(int x) { return x * 12; }
+inline int f2524_13(int x) { return x * 13; }
+inline int f2524_14(int x) { return x * 14; }
+inline int f2524_15(int x) { return x * 15; }
+inline int f2524_16(int x) { return x * 16; }
+inline int f2524_17(int x) { return x * 17; }
+inline int f2524_18(int x) { return x * 18; }
+inline int f2524_19(int x) { return x * 19; }
+inline int f2524_20(int x) { return x * 20; }
+inline int f2524_21(int x) { return x * 21; }
+inline int f2524_22(int x) { return x * 22; }
+inline int f2524_23(int x) { return x * 23; }
+inline int f2524_24(int x) { return x * 24; }
+inline int f2524_25(int x) { return x * 25; }
+inline int f2524_26(int x) { return x * 26; }
+inline int f2524_27(int x) { return x * 27; }
+inline int f2524_28(int x) { return x * 28; }
+inline int f2524_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2528 */
+#include <vector>
+#include "h9030.h"
+#include "h8590.h"
+#include "h9405.h"
+#include "h5762.h"
+#include "h4776.h"
+#ifdef X
+#include "h1169.h"
+#endif
+struct S2528 { int a; const char *s = "x//y"; };
+inline int f2528_0(int x) { return x * 0; }
+inline int f2528_1(int x) { return x * 1; }
+inline int f2528_2(int x) { return x * 2; }
+inline int f2528_3(int x) { return x * 3; }
+inline int f2528_4(int x) { return x * 4; }
+inline int f2528_5(int x) { return x * 5; }
+inline int f2528_6(int x) { return x * 6; }
+inline int f2528_7(int x) { return x * 7; }
+inline int f2528_8(int x) { return x * 8; }
+inline int f2528_9(int x) { return x * 9; }
+inline int f2528_10(int x) { return x * 10; }
+inline int f2528_11(int x) { return x * 11; }
+inline int f2528_12(int x) { return x * 12; }
+inline int f2528_13(int x) { return x * 13; }
+inline int f2528_14(int x) { return x * 14; }
+inline int f2528_15(int x) { return x * 15; }
+inline int f2528_16(int x) { return x * 16; }
+inline int f2528_17(int x) { return x * 17; }
+inline int f2528_18(int x) { return x * 18; }
+inline int f2528_19(int x) { return x * 19; }
+inline int f2528_20(int x) { return x * 20; }
+inline int f2528_21(int x) { return x * 21; }
+inline int f2528_22(int x) { return x * 22; }
+inline int f2528_23(int x) { return x * 23; }
+inline int f2528_24(int x) { return x * 24; }
+inline int f2528_25(int x) { return x * 25; }
+inline int f2528_26(int x) { return x * 26; }
+inline int f2528_27(int x) { return x * 27; }
+inline int f2528_28(int x) { return x * 28; }
+inline int f2528_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2530 */
+#include <vector>
+#include "h4633.h"
+#include "h9249.h"
+#include "h5835.h"
+#include "h8253.h"
+#include "h8251.h"
+#ifdef X
+#include "h7585.h"
+#endif
+struct S2530 { int a; const char *s = "x//y"; };
+inline int f2530_0(int x) { return x * 0; }
+inline int f2530_1(int x) { return x * 1; }
+inline int f2530_2(int x) { return x * 2; }
+inline int f2530_3(int x) { return x * 3; }
+inline int f2530_4(int x) { return x * 4; }
+inline int f2530_5(int x) { return x * 5; }
+inline int f2530_6(int x) { return x * 6; }
+inline int f2530_7(int x) { return x * 7; }
+inline int f2530_8(int x) { return x * 8; }
+inline int f2530_9(int x) { return x * 9; }
+inline int f2530_10(int x) { return x * 10; }
+inline int f2530_11(int x) { return x * 11; }
+inline int f2530_12(int x) { return x * 12; }
+inline int f2530_13(int x) { return x * 13; }
+inline int f2530_14(int x) { return x * 14; }
+inline int f2530_15(int x) { return x * 15; }
+inline int f2530_16(int x) { return x * 16; }
+inline int f2530_17(int x) { return x * 17; }
+inline int f2530_18(int x) { return x * 18; }
+inline int f2530_19(int x) { return x * 19; }
+inline int f2530_20(int x) { return x * 20; }
+inline int f2530_21(int x) { return x * 21; }
+inline int f2530_22(int x) { return x * 22; }
+inline int f2530_23(int x) { return x * 23; }
+inline int f2530_24(int x) { return x * 24; }
+inline int f2530_25(int x) { return x * 25; }
+inline int f2530_26(int x) { return x * 26; }
+inline int f2530_27(int x) { return x * 27; }
+inline int f2530_28(int x) { return x * 28; }
+inline int f2530_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2531 */
+#include <vector>
+#include "h3148.h"
+#include "h399.h"
+#include "h4955.h"
+#include "h8757.h"
+#include "h7353.h"
+#ifdef X
+#include "h8928.h"
+#endif
+struct S2531 { int a; const char *s = "x//y"; };
+inline int f2531_0(int x) { return x * 0; }
+inline int f2531_1(int x) { return x * 1; }
+inline int f2531_2(int x) { return x * 2; }
+inline int f2531_3(int x) { return x * 3; }
+inline int f2531_4(int x) { return x * 4; }
+inline int f2531_5(int x) { return x * 5; }
+inline int f2531_6(int x) { return x * 6; }
+inline int f2531_7(int x) { return x * 7; }
+inline int f2531_8(int x) { return x * 8; }
+inline int f2531_9(int x) { return x * 9; }
+inline int f2531_10(int x) { return x * 10; }
+inline int f2531_11(int x) { return x * 11; }
+inline int f2531_12(int x) { return x * 12; }
+inline int f2531_13(int x) { return x * 13; }
+inline int f2531_14(int x) { return x * 14; }
+inline int f2531_15(int x) { return x * 15; }
+inline int f2531_16(int x) { return x * 16; }
+inline int f2531_17(int x) { return x * 17; }
+inline int f2531_18(int x) { return x * 18; }
+inline int f2531_19(int x) { return x * 19; }
+inline int f2531_20(int x) { return x * 20; }
+inline int f2531_21(int x) { return x * 21; }
+inline int f2531_22(int x) { return x * 22; }
+inline int f2531_23(int x) { return x * 23; }
+inline int f2531_24(int x) { return x * 24; }
+inline int f2531_25(int x) { return x * 25; }
+inline int f2531_26(int x) { return x * 26; }
+inline int f2531_27(int x) { return x * 27; }
+inline int f2531_28(int x) { return x * 28; }
+inline int f2531_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2533 */
+#include <vector>
+#include "h3509.h"
+#include "h1044.h"
+#include "h5300.h"
+#include "h7902.h"
+#include "h5591.h"
+#ifdef X
+#include "h9487.h"
+#endif
+struct S2533 { int a; const char *s = "x//y"; };
+inline int f2533_0(int x) { return x * 0; }
+inline int f2533_1(int x) { return x * 1; }
+inline int f2533_2(int x) { return x * 2; }
+inline int f2533_3(int x) { return x * 3; }
+inline int f2533_4(int x) { return x * 4; }
+inline int f2533_5(int x) { return x * 5; }
+inline int f2533_6(int x) { return x * 6; }
+inline int f2533_7(int x) { return x * 7; }
+inline int f2533_8(int x) { return x * 8; }
+inline int f2533_9(int x) { return x * 9; }
+inline int f2533_10(int x) { return x * 10; }
+inline int f2533_11(int x) { return x * 11; }
+inline int f2533_12(int x) { return x * 12; }
+inline int f2533_13(int x) { return x * 13; }
+inline int f2533_14(int x) { return x * 14; }
+inline int f2533_15(int x) { return x * 15; }
+inline int f2533_16(int x) { return x * 16; }
+inline int f2533_17(int x) { return x * 17; }
+inline int f2533_18(int x) { return x * 18; }
+inline int f2533_19(int x) { return x * 19; }
+inline int f2533_20(int x) { return x * 20; }
+inline int f2533_21(int x) { return x * 21; }
+inline int f2533_22(int x) { return x * 22; }
+inline int f2533_23(int x) { return x * 23; }
+inline int f2533_24(int x) { return x * 24; }
+inline int f2533_25(int x) { return x * 25; }
+inline int f2533_26(int x) { return x * 26; }
+inline int f2533_27(int x) { return x * 27; }
+inline int f2533_28(int x) { return x * 28; }
+inline int f2533_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2535 */
+#include <vector>
+#include "h7565.h"
+#include "h2371.h"
+#include "h4266.h"
+#include "h2416.h"
+#include "h6114.h"
+#ifdef X
+#include "h2744.h"
+#endif
+struct S2535 { int a; const char *s = "x//y"; };
+inline int f2535_0(int x) { return x * 0; }
+inline int f2535_1(int x) { return x * 1; }
+inline int f2535_2(int x) { return x * 2; }
+inline int f2535_3(int x) { return x * 3; }
+inline int f2535_4(int x) { return x * 4; }
+inline int f2535_5(int x) { return x * 5; }
+inline int f2535_6(int x) { return x * 6; }
+inline int f2535_7(int x) { return x * 7; }
+inline int f2535_8(int x) { return x * 8; }
+inline int f2535_9(int x) { return x * 9; }
+inline int f2535_10(int x) { return x * 10; }
+inline int f2535_11(int x) { return x * 11; }
+inline int f2535_12(int x) { return x * 12; }
+inline int f2535_13(int x) { return x * 13; }
+inline int f2535_14(int x) { return x * 14; }
+inline int f2535_15(int x) { return x * 15; }
+inline int f2535_16(int x) { return x * 16; }
+inline int f2535_17(int x) { return x * 17; }
+inline int f2535_18(int x) { return x * 18; }
+inline int f2535_19(int x) { return x * 19; }
+inline int f2535_20(int x) { return x * 20; }
+inline int f2535_21(int x) { return x * 21; }
+inline int f2535_22(int x) { return x * 22; }
+inline int f2535_23(int x) { return x * 23; }
+inline int f2535_24(int x) { return x * 24; }
+inline int f2535_25(int x) { return x * 25; }
+inline int f2535_26(int x) { return x * 26; }
+inline int f2535_27(int x) { return x * 27; }
+inline int f2535_28(int x) { return x * 28; }
+inline int f2535_29(int x) { return x * 29; }
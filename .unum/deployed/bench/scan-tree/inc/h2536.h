@@ -0,0 +1,42 @@
+#pragma once
+/* header 2536 */
+#include <vector>
+#include "h8004.h"
+#include "h6975.h"
+#include "h1946.h"
+#include "h8213.h"
+#include "h6930.h"
+#ifdef X
+#include "h6366.h"
+#endif
+struct S2536 { int a; const char *s = "x//y"; };
+inline int f2536_0(int x) { return x * 0; }
+inline int f2536_1(int x) { return x * 1; }
+inline int f2536_2(int x) { return x * 2; }
+inline int f2536_3(int x) { return x * 3; }
+inline int f2536_4(int x) { return x * 4; }
+inline int f2536_5(int x) { return x * 5; }
+inline int f2536_6(int x) { return x * 6; }
+inline int f2536_7(int x) { return x * 7; }
+inline int f2536_8(int x) { return x * 8; }
+inline int f2536_9(int x) { return x * 9; }
+inline int f2536_10(int x) { return x * 10; }
+inline int f2536_11(int x) { return x * 11; }
+inline int f2536_12(int x) { return x * 12; }
+inline int f2536_13(int x) { return x * 13; }
+inline int f2536_14(int x) { return x * 14; }
+inline int f2536_15(int x) { return x * 15; }
+inline int f2536_16(int x) { return x * 16; }
+inline int f2536_17(int x) { return x * 17; }
+inline int f2536_18(int x) { return x * 18; }
+inline int f2536_19(int x) { return x * 19; }
+inline int f2536_20(int x) { return x * 20; }
+inline int f2536_21(int x) { return x * 21; }
+inline int f2536_22(int x) { return x * 22; }
+inline int f2536_23(int x) { return x * 23; }
+inline int f2536_24(int x) { return x * 24; }
+inline int f2536_25(int x) { return x * 25; }
+inline int f2536_26(int x) { return x * 26; }
+inline int f2536_27(int x) { return x * 27; }
+inline int f2536_28(int x) { return x * 28; }
+inline int f2536_29(int x) { return x * 29; }
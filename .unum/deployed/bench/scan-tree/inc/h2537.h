@@ -0,0 +1,42 @@
+#pragma once
+/* header 2537 */
+#include <vector>
+#include "h409.h"
+#include "h6409.h"
+#include "h9684.h"
+#include "h6654.h"
+#include "h743.h"
+#ifdef X
+#include "h5547.h"
+#endif
+struct S2537 { int a; const char *s = "x//y"; };
+inline int f2537_0(int x) { return x * 0; }
+inline int f2537_1(int x) { return x * 1; }
+inline int f2537_2(int x) { return x * 2; }
+inline int f2537_3(int x) { return x * 3; }
+inline int f2537_4(int x) { return x * 4; }
+inline int f2537_5(int x) { return x * 5; }
+inline int f2537_6(int x) { return x * 6; }
+inline int f2537_7(int x) { return x * 7; }
+inline int f2537_8(int x) { return x * 8; }
+inline int f2537_9(int x) { return x * 9; }
+inline int f2537_10(int x) { return x * 10; }
+inline int f2537_11(int x) { return x * 11; }
+inline int f2537_12(int x) { return x * 12; }
+inline int f2537_13(int x) { return x * 13; }
+inline int f2537_14(int x) { return x * 14; }
+inline int f2537_15(int x) { return x * 15; }
+inline int f2537_16(int x) { return x * 16; }
+inline int f2537_17(int x) { return x * 17; }
+inline int f2537_18(int x) { return x * 18; }
+inline int f2537_19(int x) { return x * 19; }
+inline int f2537_20(int x) { return x * 20; }
+inline int f2537_21(int x) { return x * 21; }
+inline int f2537_22(int x) { return x * 22; }
+inline int f2537_23(int x) { return x * 23; }
+inline int f2537_24(int x) { return x * 24; }
+inline int f2537_25(int x) { return x * 25; }
+inline int f2537_26(int x) { return x * 26; }
+inline int f2537_27(int x) { return x * 27; }
+inline int f2537_28(int x) { return x * 28; }
+inline int f2537_29(int x) { return x * 29; }
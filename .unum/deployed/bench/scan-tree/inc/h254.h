@@ -0,0 +1,42 @@
+#pragma once
+/* header 254 */
+#include <vector>
+#include "h9323.h"
+#include "h3547.h"
+#include "h6167.h"
+#include "h3546.h"
+#include "h1648.h"
+#ifdef X
+#include "h1743.h"
+#endif
+struct S254 { int a; const char *s = "x//y"; };
+inline int f254_0(int x) { return x * 0; }
+inline int f254_1(int x) { return x * 1; }
+inline int f254_2(int x) { return x * 2; }
+inline int f254_3(int x) { return x * 3; }
+inline int f254_4(int x) { return x * 4; }
+inline int f254_5(int x) { return x * 5; }
+inline int f254_6(int x) { return x * 6; }
+inline int f254_7(int x) { return x * 7; }
+inline int f254_8(int x) { return x * 8; }
+inline int f254_9(int x) { return x * 9; }
+inline int f254_10(int x) { return x * 10; }
+inline int f254_11(int x) { return x * 11; }
+inline int f254_12(int x) { return x * 12; }
+inline int f254_13(int x) { return x * 13; }
+inline int f254_14(int x) { return x * 14; }
+inline int f254_15(int x) { return x * 15; }
+inline int f254_16(int x) { return x * 16; }
+inline int f254_17(int x) { return x * 17; }
+inline int f254_18(int x) { return x * 18; }
+inline int f254_19(int x) { return x * 19; }
+inline int f254_20(int x) { return x * 20; }
+inline int f254_21(int x) { return x * 21; }
+inline int f254_22(int x) { return x * 22; }
+inline int f254_23(int x) { return x * 23; }
+inline int f254_24(int x) { return x * 24; }
+inline int f254_25(int x) { return x * 25; }
+inline int f254_26(int x) { return x * 26; }
+inline int f254_27(int x) { return x * 27; }
+inline int f254_28(int x) { return x * 28; }
+inline int f254_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2541 */
+#include <vector>
+#include "h1839.h"
+#include "h3770.h"
+#include "h3134.h"
+#include "h3935.h"
+#include "h4092.h"
+#ifdef X
+#include "h8306.h"
+#endif
+struct S2541 { int a; const char *s = "x//y"; };
+inline int f2541_0(int x) { return x * 0; }
+inline int f2541_1(int x) { return x * 1; }
+inline int f2541_2(int x) { return x * 2; }
+inline int f2541_3(int x) { return x * 3; }
+inline int f2541_4(int x) { return x * 4; }
+inline int f2541_5(int x) { return x * 5; }
+inline int f2541_6(int x) { return x * 6; }
+inline int f2541_7(int x) { return x * 7; }
+inline int f2541_8(int x) { return x * 8; }
+inline int f2541_9(int x) { return x * 9; }
+inline int f2541_10(int x) { return x * 10; }
+inline int f2541_11(int x) { return x * 11; }
+inline int f2541_12(int x) { return x * 12; }
+inline int f2541_13(int x) { return x * 13; }
+inline int f2541_14(int x) { return x * 14; }
+inline int f2541_15(int x) { return x * 15; }
+inline int f2541_16(int x) { return x * 16; }
+inline int f2541_17(int x) { return x * 17; }
+inline int f2541_18(int x) { return x * 18; }
+inline int f2541_19(int x) { return x * 19; }
+inline int f2541_20(int x) { return x * 20; }
+inline int f2541_21(int x) { return x * 21; }
+inline int f2541_22(int x) { return x * 22; }
+inline int f2541_23(int x) { return x * 23; }
+inline int f2541_24(int x) { return x * 24; }
+inline int f2541_25(int x) { return x * 25; }
+inline int f2541_26(int x) { return x * 26; }
+inline int f2541_27(int x) { return x * 27; }
+inline int f2541_28(int x) { return x * 28; }
+inline int f2541_29(int x) { return x * 29; }
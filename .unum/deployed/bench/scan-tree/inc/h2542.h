@@ -0,0 +1,42 @@
+#pragma once
+/* header 2542 */
+#include <vector>
+#include "h8956.h"
+#include "h5238.h"
+#include "h1462.h"
+#include "h9640.h"
+#include "h7275.h"
+#ifdef X
+#include "h9723.h"
+#endif
+struct S2542 { int a; const char *s = "x//y"; };
+inline int f2542_0(int x) { return x * 0; }
+inline int f2542_1(int x) { return x * 1; }
+inline int f2542_2(int x) { return x * 2; }
+inline int f2542_3(int x) { return x * 3; }
+inline int f2542_4(int x) { return x * 4; }
+inline int f2542_5(int x) { return x * 5; }
+inline int f2542_6(int x) { return x * 6; }
+inline int f2542_7(int x) { return x * 7; }
+inline int f2542_8(int x) { return x * 8; }
+inline int f2542_9(int x) { return x * 9; }
+inline int f2542_10(int x) { return x * 10; }
+inline int f2542_11(int x) { return x * 11; }
+inline int f2542_12(int x) { return x * 12; }
+inline int f2542_13(int x) { return x * 13; }
+inline int f2542_14(int x) { return x * 14; }
+inline int f2542_15(int x) { return x * 15; }
+inline int f2542_16(int x) { return x * 16; }
+inline int f2542_17(int x) { return x * 17; }
+inline int f2542_18(int x) { return x * 18; }
+inline int f2542_19(int x) { return x * 19; }
+inline int f2542_20(int x) { return x * 20; }
+inline int f2542_21(int x) { return x * 21; }
+inline int f2542_22(int x) { return x * 22; }
+inline int f2542_23(int x) { return x * 23; }
+inline int f2542_24(int x) { return x * 24; }
+inline int f2542_25(int x) { return x * 25; }
+inline int f2542_26(int x) { return x * 26; }
+inline int f2542_27(int x) { return x * 27; }
+inline int f2542_28(int x) { return x * 28; }
+inline int f2542_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2543 */
+#include <vector>
+#include "h8289.h"
+#include "h4174.h"
+#include "h4840.h"
+#include "h1027.h"
+#include "h6346.h"
+#ifdef X
+#include "h2651.h"
+#endif
+struct S2543 { int a; const char *s = "x//y"; };
+inline int f2543_0(int x) { return x * 0; }
+inline int f2543_1(int x) { return x * 1; }
+inline int f2543_2(int x) { return x * 2; }
+inline int f2543_3(int x) { return x * 3; }
+inline int f2543_4(int x) { return x * 4; }
+inline int f2543_5(int x) { return x * 5; }
+inline int f2543_6(int x) { return x * 6; }
+inline int f2543_7(int x) { return x * 7; }
+inline int f2543_8(int x) { return x * 8; }
+inline int f2543_9(int x) { return x * 9; }
+inline int f2543_10(int x) { return x * 10; }
+inline int f2543_11(int x) { return x * 11; }
+inline int f2543_12(int x) { return x * 12; }
+inline int f2543_13(int x) { return x * 13; }
+inline int f2543_14(int x) { return x * 14; }
+inline int f2543_15(int x) { return x * 15; }
+inline int f2543_16(int x) { return x * 16; }
+inline int f2543_17(int x) { return x * 17; }
+inline int f2543_18(int x) { return x * 18; }
+inline int f2543_19(int x) { return x * 19; }
+inline int f2543_20(int x) { return x * 20; }
+inline int f2543_21(int x) { return x * 21; }
+inline int f2543_22(int x) { return x * 22; }
+inline int f2543_23(int x) { return x * 23; }
+inline int f2543_24(int x) { return x * 24; }
+inline int f2543_25(int x) { return x * 25; }
+inline int f2543_26(int x) { return x * 26; }
+inline int f2543_27(int x) { return x * 27; }
+inline int f2543_28(int x) { return x * 28; }
+inline int f2543_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2545 */
+#include <vector>
+#include "h4426.h"
+#include "h7579.h"
+#include "h6679.h"
+#include "h9631.h"
+#include "h9065.h"
+#ifdef X
+#include "h4493.h"
+#endif
+struct S2545 { int a; const char *s = "x//y"; };
+inline int f2545_0(int x) { return x * 0; }
+inline int f2545_1(int x) { return x * 1; }
+inline int f2545_2(int x) { return x * 2; }
+inline int f2545_3(int x) { return x * 3; }
+inline int f2545_4(int x) { return x * 4; }
+inline int f2545_5(int x) { return x * 5; }
+inline int f2545_6(int x) { return x * 6; }
+inline int f2545_7(int x) { return x * 7; }
+inline int f2545_8(int x) { return x * 8; }
+inline int f2545_9(int x) { return x * 9; }
+inline int f2545_10(int x) { return x * 10; }
+inline int f2545_11(int x) { return x * 11; }
+inline int f2545_12(int x) { return x * 12; }
+inline int f2545_13(int x) { return x * 13; }
+inline int f2545_14(int x) { return x * 14; }
+inline int f2545_15(int x) { return x * 15; }
+inline int f2545_16(int x) { return x * 16; }
+inline int f2545_17(int x) { return x * 17; }
+inline int f2545_18(int x) { return x * 18; }
+inline int f2545_19(int x) { return x * 19; }
+inline int f2545_20(int x) { return x * 20; }
+inline int f2545_21(int x) { return x * 21; }
+inline int f2545_22(int x) { return x * 22; }
+inline int f2545_23(int x) { return x * 23; }
+inline int f2545_24(int x) { return x * 24; }
+inline int f2545_25(int x) { return x * 25; }
+inline int f2545_26(int x) { return x * 26; }
+inline int f2545_27(int x) { return x * 27; }
+inline int f2545_28(int x) { return x * 28; }
+inline int f2545_29(int x) { return x * 29; }
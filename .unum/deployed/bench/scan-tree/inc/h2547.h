@@ -0,0 +1,42 @@
+#pragma once
+/* header 2547 */
+#include <vector>
+#include "h3203.h"
+#include "h9637.h"
+#include "h6632.h"
+#include "h1023.h"
+#include "h4853.h"
+#ifdef X
+#include "h8326.h"
+#endif
+struct S2547 { int a; const char *s = "x//y"; };
+inline int f2547_0(int x) { return x * 0; }
+inline int f2547_1(int x) { return x * 1; }
+inline int f2547_2(int x) { return x * 2; }
+inline int f2547_3(int x) { return x * 3; }
+inline int f2547_4(int x) { return x * 4; }
+inline int f2547_5(int x) { return x * 5; }
+inline int f2547_6(int x) { return x * 6; }
+inline int f2547_7(int x) { return x * 7; }
+inline int f2547_8(int x) { return x * 8; }
+inline int f2547_9(int x) { return x * 9; }
+inline int f2547_10(int x) { return x * 10; }
+inline int f2547_11(int x) { return x * 11; }
+inline int f2547_12(int x) { return x * 12; }
+inline int f2547_13(int x) { return x * 13; }
+inline int f2547_14(int x) { return x * 14; }
+inline int f2547_15(int x) { return x * 15; }
+inline int f2547_16(int x) { return x * 16; }
+inline int f2547_17(int x) { return x * 17; }
+inline int f2547_18(int x) { return x * 18; }
+inline int f2547_19(int x) { return x * 19; }
+inline int f2547_20(int x) { return x * 20; }
+inline int f2547_21(int x) { return x * 21; }
+inline int f2547_22(int x) { return x * 22; }
+inline int f2547_23(int x) { return x * 23; }
+inline int f2547_24(int x) { return x * 24; }
+inline int f2547_25(int x) { return x * 25; }
+inline int f2547_26(int x) { return x * 26; }
+inline int f2547_27(int x) { return x * 27; }
+inline int f2547_28(int x) { return x * 28; }
+inline int f2547_29(int x) { return x * 29; }
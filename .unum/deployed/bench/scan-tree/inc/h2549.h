@@ -0,0 +1,42 @@
+#pragma once
+/* header 2549 */
+#include <vector>
+#include "h5056.h"
+#include "h7207.h"
+#include "h7032.h"
+#include "h2577.h"
+#include "h5784.h"
+#ifdef X
+#include "h3310.h"
+#endif
+struct S2549 { int a; const char *s = "x//y"; };
+inline int f2549_0(int x) { return x * 0; }
+inline int f2549_1(int x) { return x * 1; }
+inline int f2549_2(int x) { return x * 2; }
+inline int f2549_3(int x) { return x * 3; }
+inline int f2549_4(int x) { return x * 4; }
+inline int f2549_5(int x) { return x * 5; }
+inline int f2549_6(int x) { return x * 6; }
+inline int f2549_7(int x) { return x * 7; }
+inline int f2549_8(int x) { return x * 8; }
+inline int f2549_9(int x) { return x * 9; }
+inline int f2549_10(int x) { return x * 10; }
+inline int f2549_11(int x) { return x * 11; }
+inline int f2549_12(int x) { return x * 12; }
+inline int f2549_13(int x) { return x * 13; }
+inline int f2549_14(int x) { return x * 14; }
+inline int f2549_15(int x) { return x * 15; }
+inline int f2549_16(int x) { return x * 16; }
+inline int f2549_17(int x) { return x * 17; }
+inline int f2549_18(int x) { return x * 18; }
+inline int f2549_19(int x) { return x * 19; }
+inline int f2549_20(int x) { return x * 20; }
+inline int f2549_21(int x) { return x * 21; }
+inline int f2549_22(int x) { return x * 22; }
+inline int f2549_23(int x) { return x * 23; }
+inline int f2549_24(int x) { return x * 24; }
+inline int f2549_25(int x) { return x * 25; }
+inline int f2549_26(int x) { return x * 26; }
+inline int f2549_27(int x) { return x * 27; }
+inline int f2549_28(int x) { return x * 28; }
+inline int f2549_29(int x) { return x * 29; }
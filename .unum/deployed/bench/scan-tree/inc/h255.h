@@ -0,0 +1,42 @@
+#pragma once
+/* header 255 */
+#include <vector>
+#include "h1880.h"
+#include "h4779.h"
+#include "h6427.h"
+#include "h4001.h"
+#include "h1199.h"
+#ifdef X
+#include "h3882.h"
+#endif
+struct S255 { int a; const char *s = "x//y"; };
+inline int f255_0(int x) { return x * 0; }
+inline int f255_1(int x) { return x * 1; }
+inline int f255_2(int x) { return x * 2; }
+inline int f255_3(int x) { return x * 3; }
+inline int f255_4(int x) { return x * 4; }
+inline int f255_5(int x) { return x * 5; }
+inline int f255_6(int x) { return x * 6; }
+inline int f255_7(int x) { return x * 7; }
+inline int f255_8(int x) { return x * 8; }
+inline int f255_9(int x) { return x * 9; }
+inline int f255_10(int x) { return x * 10; }
+inline int f255_11(int x) { return x * 11; }
+inline int f255_12(int x) { return x * 12; }
+inline int f255_13(int x) { return x * 13; }
+inline int f255_14(int x) { return x * 14; }
+inline int f255_15(int x) { return x * 15; }
+inline int f255_16(int x) { return x * 16; }
+inline int f255_17(int x) { return x * 17; }
+inline int f255_18(int x) { return x * 18; }
+inline int f255_19(int x) { return x * 19; }
+inline int f255_20(int x) { return x * 20; }
+inline int f255_21(int x) { return x * 21; }
+inline int f255_22(int x) { return x * 22; }
+inline int f255_23(int x) { return x * 23; }
+inline int f255_24(int x) { return x * 24; }
+inline int f255_25(int x) { return x * 25; }
+inline int f255_26(int x) { return x * 26; }
+inline int f255_27(int x) { return x * 27; }
+inline int f255_28(int x) { return x * 28; }
+inline int f255_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2550 */
+#include <vector>
+#include "h9494.h"
+#include "h275.h"
+#include "h5258.h"
+#include "h9273.h"
+#include "h9339.h"
+#ifdef X
+#include "h1868.h"
+#endif
+struct S2550 { int a; const char *s = "x//y"; };
+inline int f2550_0(int x) { return x * 0; }
+inline int f2550_1(int x) { return x * 1; }
+inline int f2550_2(int x) { return x * 2; }
+inline int f2550_3(int x) { return x * 3; }
+inline int f2550_4(int x) { return x * 4; }
+inline int f2550_5(int x) { return x * 5; }
+inline int f2550_6(int x) { return x * 6; }
+inline int f2550_7(int x) { return x * 7; }
+inline int f2550_8(int x) { return x * 8; }
+inline int f2550_9(int x) { return x * 9; }
+inline int f2550_10(int x) { return x * 10; }
+inline int f2550_11(int x) { return x * 11; }
+inline int f2550_12(int x) { return x * 12; }
+inline int f2550_13(int x) { return x * 13; }
+inline int f2550_14(int x) { return x * 14; }
+inline int f2550_15(int x) { return x * 15; }
+inline int f2550_16(int x) { return x * 16; }
+inline int f2550_17(int x) { return x * 17; }
+inline int f2550_18(int x) { return x * 18; }
+inline int f2550_19(int x) { return x * 19; }
+inline int f2550_20(int x) { return x * 20; }
+inline int f2550_21(int x) { return x * 21; }
+inline int f2550_22(int x) { return x * 22; }
+inline int f2550_23(int x) { return x * 23; }
+inline int f2550_24(int x) { return x * 24; }
+inline int f2550_25(int x) { return x * 25; }
+inline int f2550_26(int x) { return x * 26; }
+inline int f2550_27(int x) { return x * 27; }
+inline int f2550_28(int x) { return x * 28; }
+inline int f2550_29(int x) { return x * 29; }
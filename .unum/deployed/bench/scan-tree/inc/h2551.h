@@ -0,0 +1,42 @@
+#pragma once
+/* header 2551 */
+#include <vector>
+#include "h115.h"
+#include "h336.h"
+#include "h5272.h"
+#include "h8245.h"
+#include "h5884.h"
+#ifdef X
+#include "h9183.h"
+#endif
+struct S2551 { int a; const char *s = "x//y"; };
+inline int f2551_0(int x) { return x * 0; }
+inline int f2551_1(int x) { return x * 1; }
+inline int f2551_2(int x) { return x * 2; }
+inline int f2551_3(int x) { return x * 3; }
+inline int f2551_4(int x) { return x * 4; }
+inline int f2551_5(int x) { return x * 5; }
+inline int f2551_6(int x) { return x * 6; }
+inline int f2551_7(int x) { return x * 7; }
+inline int f2551_8(int x) { return x * 8; }
+inline int f2551_9(int x) { return x * 9; }
+inline int f2551_10(int x) { return x * 10; }
+inline int f2551_11(int x) { return x * 11; }
+inline int f2551_12(int x) { return x * 12; }
+inline int f2551_13(int x) { return x * 13; }
+inline int f2551_14(int x) { return x * 14; }
+inline int f2551_15(int x) { return x * 15; }
+inline int f2551_16(int x) { return x * 16; }
+inline int f2551_17(int x) { return x * 17; }
+inline int f2551_18(int x) { return x * 18; }
+inline int f2551_19(int x) { return x * 19; }
+inline int f2551_20(int x) { return x * 20; }
+inline int f2551_21(int x) { return x * 21; }
+inline int f2551_22(int x) { return x * 22; }
+inline int f2551_23(int x) { return x * 23; }
+inline int f2551_24(int x) { return x * 24; }
+inline int f2551_25(int x) { return x * 25; }
+inline int f2551_26(int x) { return x * 26; }
+inline int f2551_27(int x) { return x * 27; }
+inline int f2551_28(int x) { return x * 28; }
+inline int f2551_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2553 */
+#include <vector>
+#include "h484.h"
+#include "h8234.h"
+#include "h3597.h"
+#include "h671.h"
+#include "h5478.h"
+#ifdef X
+#include "h2501.h"
+#endif
+struct S2553 { int a; const char *s = "x//y"; };
+inline int f2553_0(int x) { return x * 0; }
+inline int f2553_1(int x) { return x * 1; }
+inline int f2553_2(int x) { return x * 2; }
+inline int f2553_3(int x) { return x * 3; }
+inline int f2553_4(int x) { return x * 4; }
+inline int f2553_5(int x) { return x * 5; }
+inline int f2553_6(int x) { return x * 6; }
+inline int f2553_7(int x) { return x * 7; }
+inline int f2553_8(int x) { return x * 8; }
+inline int f2553_9(int x) { return x * 9; }
+inline int f2553_10(int x) { return x * 10; }
+inline int f2553_11(int x) { return x * 11; }
+inline int f2553_12(int x) { return x * 12; }
+inline int f2553_13(int x) { return x * 13; }
+inline int f2553_14(int x) { return x * 14; }
+inline int f2553_15(int x) { return x * 15; }
+inline int f2553_16(int x) { return x * 16; }
+inline int f2553_17(int x) { return x * 17; }
+inline int f2553_18(int x) { return x * 18; }
+inline int f2553_19(int x) { return x * 19; }
+inline int f2553_20(int x) { return x * 20; }
+inline int f2553_21(int x) { return x * 21; }
+inline int f2553_22(int x) { return x * 22; }
+inline int f2553_23(int x) { return x * 23; }
+inline int f2553_24(int x) { return x * 24; }
+inline int f2553_25(int x) { return x * 25; }
+inline int f2553_26(int x) { return x * 26; }
+inline int f2553_27(int x) { return x * 27; }
+inline int f2553_28(int x) { return x * 28; }
+inline int f2553_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2555 */
+#include <vector>
+#include "h7983.h"
+#include "h753.h"
+#include "h7267.h"
+#include "h6733.h"
+#include "h7665.h"
+#ifdef X
+#include "h1288.h"
+#endif
+struct S2555 { int a; const char *s = "x//y"; };
+inline int f2555_0(int x) { return x * 0; }
+inline int f2555_1(int x) { return x * 1; }
+inline int f2555_2(int x) { return x * 2; }
+inline int f2555_3(int x) { return x * 3; }
+inline int f2555_4(int x) { return x * 4; }
+inline int f2555_5(int x) { return x * 5; }
+inline int f2555_6(int x) { return x * 6; }
+inline int f2555_7(int x) { return x * 7; }
+inline int f2555_8(int x) { return x * 8; }
+inline int f2555_9(int x) { return x * 9; }
+inline int f2555_10(int x) { return x * 10; }
+inline int f2555_11(int x) { return x * 11; }
+inline int f2555_12(int x) { return x * 12; }
+inline int f2555_13(int x) { return x * 13; }
+inline int f2555_14(int x) { return x * 14; }
+inline int f2555_15(int x) { return x * 15; }
+inline int f2555_16(int x) { return x * 16; }
+inline int f2555_17(int x) { return x * 17; }
+inline int f2555_18(int x) { return x * 18; }
+inline int f2555_19(int x) { return x * 19; }
+inline int f2555_20(int x) { return x * 20; }
+inline int f2555_21(int x) { return x * 21; }
+inline int f2555_22(int x) { return x * 22; }
+inline int f2555_23(int x) { return x * 23; }
+inline int f2555_24(int x) { return x * 24; }
+inline int f2555_25(int x) { return x * 25; }
+inline int f2555_26(int x) { return x * 26; }
+inline int f2555_27(int x) { return x * 27; }
+inline int f2555_28(int x) { return x * 28; }
+inline int f2555_29(int x) { return x * 29; }
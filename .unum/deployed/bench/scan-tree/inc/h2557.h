@@ -0,0 +1,42 @@
+#pragma once
+/* header 2557 */
+#include <vector>
+#include "h3559.h"
+#include "h3550.h"
+#include "h7989.h"
+#include "h7474.h"
+#include "h3116.h"
+#ifdef X
+#include "h148.h"
+#endif
+struct S2557 { int a; const char *s = "x//y"; };
+inline int f2557_0(int x) { return x * 0; }
+inline int f2557_1(int x) { return x * 1; }
+inline int f2557_2(int x) { return x * 2; }
+inline int f2557_3(int x) { return x * 3; }
+inline int f2557_4(int x) { return x * 4; }
+inline int f2557_5(int x) { return x * 5; }
+inline int f2557_6(int x) { return x * 6; }
+inline int f2557_7(int x) { return x * 7; }
+inline int f2557_8(int x) { return x * 8; }
+inline int f2557_9(int x) { return x * 9; }
+inline int f2557_10(int x) { return x * 10; }
+inline int f2557_11(int x) { return x * 11; }
+inline int f2557_12(int x) { return x * 12; }
+inline int f2557_13(int x) { return x * 13; }
+inline int f2557_14(int x) { return x * 14; }
+inline int f2557_15(int x) { return x * 15; }
+inline int f2557_16(int x) { return x * 16; }
+inline int f2557_17(int x) { return x * 17; }
+inline int f2557_18(int x) { return x * 18; }
+inline int f2557_19(int x) { return x * 19; }
+inline int f2557_20(int x) { return x * 20; }
+inline int f2557_21(int x) { return x * 21; }
+inline int f2557_22(int x) { return x * 22; }
+inline int f2557_23(int x) { return x * 23; }
+inline int f2557_24(int x) { return x * 24; }
+inline int f2557_25(int x) { return x * 25; }
+inline int f2557_26(int x) { return x * 26; }
+inline int f2557_27(int x) { return x * 27; }
+inline int f2557_28(int x) { return x * 28; }
+inline int f2557_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2559 */
+#include <vector>
+#include "h4410.h"
+#include "h2224.h"
+#include "h3492.h"
+#include "h4498.h"
+#include "h1617.h"
+#ifdef X
+#include "h4470.h"
+#endif
+struct S2559 { int a; const char *s = "x//y"; };
+inline int f2559_0(int x) { return x * 0; }
+inline int f2559_1(int x) { return x * 1; }
+inline int f2559_2(int x) { return x * 2; }
+inline int f2559_3(int x) { return x * 3; }
+inline int f2559_4(int x) { return x * 4; }
+inline int f2559_5(int x) { return x * 5; }
+inline int f2559_6(int x) { return x * 6; }
+inline int f2559_7(int x) { return x * 7; }
+inline int f2559_8(int x) { return x * 8; }
+inline int f2559_9(int x) { return x * 9; }
+inline int f2559_10(int x) { return x * 10; }
+inline int f2559_11(int x) { return x * 11; }
+inline int f2559_12(int x) { return x * 12; }
+inline int f2559_13(int x) { return x * 13; }
+inline int f2559_14(int x) { return x * 14; }
+inline int f2559_15(int x) { return x * 15; }
+inline int f2559_16(int x) { return x * 16; }
+inline int f2559_17(int x) { return x * 17; }
+inline int f2559_18(int x) { return x * 18; }
+inline int f2559_19(int x) { return x * 19; }
+inline int f2559_20(int x) { return x * 20; }
+inline int f2559_21(int x) { return x * 21; }
+inline int f2559_22(int x) { return x * 22; }
+inline int f2559_23(int x) { return x * 23; }
+inline int f2559_24(int x) { return x * 24; }
+inline int f2559_25(int x) { return x * 25; }
+inline int f2559_26(int x) { return x * 26; }
+inline int f2559_27(int x) { return x * 27; }
+inline int f2559_28(int x) { return x * 28; }
+inline int f2559_29(int x) { return x * 29; }
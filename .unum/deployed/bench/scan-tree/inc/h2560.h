@@ -0,0 +1,42 @@
+#pragma once
+/* header 2560 */
+#include <vector>
+#include "h3158.h"
+#include "h7990.h"
+#include "h2375.h"
+#include "h7114.h"
+#include "h7447.h"
+#ifdef X
+#include "h4150.h"
+#endif
+struct S2560 { int a; const char *s = "x//y"; };
+inline int f2560_0(int x) { return x * 0; }
+inline int f2560_1(int x) { return x * 1; }
+inline int f2560_2(int x) { return x * 2; }
+inline int f2560_3(int x) { return x * 3; }
+inline int f2560_4(int x) { return x * 4; }
+inline int f2560_5(int x) { return x * 5; }
+inline int f2560_6(int x) { return x * 6; }
+inline int f2560_7(int x) { return x * 7; }
+inline int f2560_8(int x) { return x * 8; }
+inline int f2560_9(int x) { return x * 9; }
+inline int f2560_10(int x) { return x * 10; }
+inline int f2560_11(int x) { return x * 11; }
+inline int f2560_12(int x) { return x * 12; }
+inline int f2560_13(int x) { return x * 13; }
+inline int f2560_14(int x) { return x * 14; }
+inline int f2560_15(int x) { return x * 15; }
+inline int f2560_16(int x) { return x * 16; }
+inline int f2560_17(int x) { return x * 17; }
+inline int f2560_18(int x) { return x * 18; }
+inline int f2560_19(int x) { return x * 19; }
+inline int f2560_20(int x) { return x * 20; }
+inline int f2560_21(int x) { return x * 21; }
+inline int f2560_22(int x) { return x * 22; }
+inline int f2560_23(int x) { return x * 23; }
+inline int f2560_24(int x) { return x * 24; }
+inline int f2560_25(int x) { return x * 25; }
+inline int f2560_26(int x) { return x * 26; }
+inline int f2560_27(int x) { return x * 27; }
+inline int f2560_28(int x) { return x * 28; }
+inline int f2560_29(int x) { return x * 29; }
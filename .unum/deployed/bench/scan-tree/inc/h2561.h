@@ -0,0 +1,42 @@
+#pragma once
+/* header 2561 */
+#include <vector>
+#include "h2982.h"
+#include "h9985.h"
+#include "h8159.h"
+#include "h3834.h"
+#include "h7709.h"
+#ifdef X
+#include "h2484.h"
+#endif
+struct S2561 { int a; const char *s = "x//y"; };
+inline int f2561_0(int x) { return x * 0; }
+inline int f2561_1(int x) { return x * 1; }
+inline int f2561_2(int x) { return x * 2; }
+inline int f2561_3(int x) { return x * 3; }
+inline int f2561_4(int x) { return x * 4; }
+inline int f2561_5(int x) { return x * 5; }
+inline int f2561_6(int x) { return x * 6; }
+inline int f2561_7(int x) { return x * 7; }
+inline int f2561_8(int x) { return x * 8; }
+inline int f2561_9(int x) { return x * 9; }
+inline int f2561_10(int x) { return x * 10; }
+inline int f2561_11(int x) { return x * 11; }
+inline int f2561_12(int x) { return x * 12; }
+inline int f2561_13(int x) { return x * 13; }
+inline int f2561_14(int x) { return x * 14; }
+inline int f2561_15(int x) { return x * 15; }
+inline int f2561_16(int x) { return x * 16; }
+inline int f2561_17(int x) { return x * 17; }
+inline int f2561_18(int x) { return x * 18; }
+inline int f2561_19(int x) { return x * 19; }
+inline int f2561_20(int x) { return x * 20; }
+inline int f2561_21(int x) { return x * 21; }
+inline int f2561_22(int x) { return x * 22; }
+inline int f2561_23(int x) { return x * 23; }
+inline int f2561_24(int x) { return x * 24; }
+inline int f2561_25(int x) { return x * 25; }
+inline int f2561_26(int x) { return x * 26; }
+inline int f2561_27(int x) { return x * 27; }
+inline int f2561_28(int x) { return x * 28; }
+inline int f2561_29(int x) { return x * 29; }
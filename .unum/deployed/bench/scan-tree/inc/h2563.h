@@ -0,0 +1,42 @@
+#pragma once
+/* header 2563 */
+#include <vector>
+#include "h5046.h"
+#include "h6728.h"
+#include "h3108.h"
+#include "h2693.h"
+#include "h6720.h"
+#ifdef X
+#include "h1125.h"
+#endif
+struct S2563 { int a; const char *s = "x//y"; };
+inline int f2563_0(int x) { return x * 0; }
+inline int f2563_1(int x) { return x * 1; }
+inline int f2563_2(int x) { return x * 2; }
+inline int f2563_3(int x) { return x * 3; }
+inline int f2563_4(int x) { return x * 4; }
+inline int f2563_5(int x) { return x * 5; }
+inline int f2563_6(int x) { return x * 6; }
+inline int f2563_7(int x) { return x * 7; }
+inline int f2563_8(int x) { return x * 8; }
+inline int f2563_9(int x) { return x * 9; }
+inline int f2563_10(int x) { return x * 10; }
+inline int f2563_11(int x) { return x * 11; }
+inline int f2563_12(int x) { return x * 12; }
+inline int f2563_13(int x) { return x * 13; }
+inline int f2563_14(int x) { return x * 14; }
+inline int f2563_15(int x) { return x * 15; }
+inline int f2563_16(int x) { return x * 16; }
+inline int f2563_17(int x) { return x * 17; }
+inline int f2563_18(int x) { return x * 18; }
+inline int f2563_19(int x) { return x * 19; }
+inline int f2563_20(int x) { return x * 20; }
+inline int f2563_21(int x) { return x * 21; }
+inline int f2563_22(int x) { return x * 22; }
+inline int f2563_23(int x) { return x * 23; }
+inline int f2563_24(int x) { return x * 24; }
+inline int f2563_25(int x) { return x * 25; }
+inline int f2563_26(int x) { return x * 26; }
+inline int f2563_27(int x) { return x * 27; }
+inline int f2563_28(int x) { return x * 28; }
+inline int f2563_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2564 */
+#include <vector>
+#include "h4030.h"
+#include "h2562.h"
+#include "h196.h"
+#include "h8426.h"
+#include "h1047.h"
+#ifdef X
+#include "h660.h"
+#endif
+struct S2564 { int a; const char *s = "x//y"; };
+inline int f2564_0(int x) { return x * 0; }
+inline int f2564_1(int x) { return x * 1; }
+inline int f2564_2(int x) { return x * 2; }
+inline int f2564_3(int x) { return x * 3; }
+inline int f2564_4(int x) { return x * 4; }
+inline int f2564_5(int x) { return x * 5; }
+inline int f2564_6(int x) { return x * 6; }
+inline int f2564_7(int x) { return x * 7; }
+inline int f2564_8(int x) { return x * 8; }
+inline int f2564_9(int x) { return x * 9; }
+inline int f2564_10(int x) { return x * 10; }
+inline int f2564_11(int x) { return x * 11; }
+inline int f2564_12(int x) { return x * 12; }
+inline int f2564_13(int x) { return x * 13; }
+inline int f2564_14(int x) { return x * 14; }
+inline int f2564_15(int x) { return x * 15; }
+inline int f2564_16(int x) { return x * 16; }
+inline int f2564_17(int x) { return x * 17; }
+inline int f2564_18(int x) { return x * 18; }
+inline int f2564_19(int x) { return x * 19; }
+inline int f2564_20(int x) { return x * 20; }
+inline int f2564_21(int x) { return x * 21; }
+inline int f2564_22(int x) { return x * 22; }
+inline int f2564_23(int x) { return x * 23; }
+inline int f2564_24(int x) { return x * 24; }
+inline int f2564_25(int x) { return x * 25; }
+inline int f2564_26(int x) { return x * 26; }
+inline int f2564_27(int x) { return x * 27; }
+inline int f2564_28(int x) { return x * 28; }
+inline int f2564_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2565 */
+#include <vector>
+#include "h9354.h"
+#include "h6321.h"
+#include "h5515.h"
+#include "h7196.h"
+#include "h3619.h"
+#ifdef X
+#include "h735.h"
+#endif
+struct S2565 { int a; const char *s = "x//y"; };
+inline int f2565_0(int x) { return x * 0; }
+inline int f2565_1(int x) { return x * 1; }
+inline int f2565_2(int x) { return x * 2; }
+inline int f2565_3(int x) { return x * 3; }
+inline int f2565_4(int x) { return x * 4; }
+inline int f2565_5(int x) { return x * 5; }
+inline int f2565_6(int x) { return x * 6; }
+inline int f2565_7(int x) { return x * 7; }
+inline int f2565_8(int x) { return x * 8; }
+inline int f2565_9(int x) { return x * 9; }
+inline int f2565_10(int x) { return x * 10; }
+inline int f2565_11(int x) { return x * 11; }
+inline int f2565_12(int x) { return x * 12; }
+inline int f2565_13(int x) { return x * 13; }
+inline int f2565_14(int x) { return x * 14; }
+inline int f2565_15(int x) { return x * 15; }
+inline int f2565_16(int x) { return x * 16; }
+inline int f2565_17(int x) { return x * 17; }
+inline int f2565_18(int x) { return x * 18; }
+inline int f2565_19(int x) { return x * 19; }
+inline int f2565_20(int x) { return x * 20; }
+inline int f2565_21(int x) { return x * 21; }
+inline int f2565_22(int x) { return x * 22; }
+inline int f2565_23(int x) { return x * 23; }
+inline int f2565_24(int x) { return x * 24; }
+inline int f2565_25(int x) { return x * 25; }
+inline int f2565_26(int x) { return x * 26; }
+inline int f2565_27(int x) { return x * 27; }
+inline int f2565_28(int x) { return x * 28; }
+inline int f2565_29(int x) { return x * 29; }
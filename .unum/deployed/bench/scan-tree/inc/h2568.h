@@ -0,0 +1,42 @@
+#pragma once
+/* header 2568 */
+#include <vector>
+#include "h3598.h"
+#include "h8205.h"
+#include "h2178.h"
+#include "h3188.h"
+#include "h3146.h"
+#ifdef X
+#include "h9326.h"
+#endif
+struct S2568 { int a; const char *s = "x//y"; };
+inline int f2568_0(int x) { return x * 0; }
+inline int f2568_1(int x) { return x * 1; }
+inline int f2568_2(int x) { return x * 2; }
+inline int f2568_3(int x) { return x * 3; }
+inline int f2568_4(int x) { return x * 4; }
+inline int f2568_5(int x) { return x * 5; }
+inline int f2568_6(int x) { return x * 6; }
+inline int f2568_7(int x) { return x * 7; }
+inline int f2568_8(int x) { return x * 8; }
+inline int f2568_9(int x) { return x * 9; }
+inline int f2568_10(int x) { return x * 10; }
+inline int f2568_11(int x) { return x * 11; }
+inline int f2568_12(int x) { return x * 12; }
+inline int f2568_13(int x) { return x * 13; }
+inline int f2568_14(int x) { return x * 14; }
+inline int f2568_15(int x) { return x * 15; }
+inline int f2568_16(int x) { return x * 16; }
+inline int f2568_17(int x) { return x * 17; }
+inline int f2568_18(int x) { return x * 18; }
+inline int f2568_19(int x) { return x * 19; }
+inline int f2568_20(int x) { return x * 20; }
+inline int f2568_21(int x) { return x * 21; }
+inline int f2568_22(int x) { return x * 22; }
+inline int f2568_23(int x) { return x * 23; }
+inline int f2568_24(int x) { return x * 24; }
+inline int f2568_25(int x) { return x * 25; }
+inline int f2568_26(int x) { return x * 26; }
+inline int f2568_27(int x) { return x * 27; }
+inline int f2568_28(int x) { return x * 28; }
+inline int f2568_29(int x) { return x * 29; }
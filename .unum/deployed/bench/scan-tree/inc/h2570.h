@@ -0,0 +1,42 @@
+#pragma once
+/* header 2570 */
+#include <vector>
+#include "h7724.h"
+#include "h658.h"
+#include "h3671.h"
+#include "h1059.h"
+#include "h4961.h"
+#ifdef X
+#include "h3471.h"
+#endif
+struct S2570 { int a; const char *s = "x//y"; };
+inline int f2570_0(int x) { return x * 0; }
+inline int f2570_1(int x) { return x * 1; }
+inline int f2570_2(int x) { return x * 2; }
+inline int f2570_3(int x) { return x * 3; }
+inline int f2570_4(int x) { return x * 4; }
+inline int f2570_5(int x) { return x * 5; }
+inline int f2570_6(int x) { return x * 6; }
+inline int f2570_7(int x) { return x * 7; }
+inline int f2570_8(int x) { return x * 8; }
+inline int f2570_9(int x) { return x * 9; }
+inline int f2570_10(int x) { return x * 10; }
+inline int f2570_11(int x) { return x * 11; }
+inline int f2570_12(int x) { return x * 12; }
+inline int f2570_13(int x) { return x * 13; }
+inline int f2570_14(int x) { return x * 14; }
+inline int f2570_15(int x) { return x * 15; }
+inline int f2570_16(int x) { return x * 16; }
+inline int f2570_17(int x) { return x * 17; }
+inline int f2570_18(int x) { return x * 18; }
+inline int f2570_19(int x) { return x * 19; }
+inline int f2570_20(int x) { return x * 20; }
+inline int f2570_21(int x) { return x * 21; }
+inline int f2570_22(int x) { return x * 22; }
+inline int f2570_23(int x) { return x * 23; }
+inline int f2570_24(int x) { return x * 24; }
+inline int f2570_25(int x) { return x * 25; }
+inline int f2570_26(int x) { return x * 26; }
+inline int f2570_27(int x) { return x * 27; }
+inline int f2570_28(int x) { return x * 28; }
+inline int f2570_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2574 */
+#include <vector>
+#include "h3835.h"
+#include "h5000.h"
+#include "h303.h"
+#include "h9283.h"
+#include "h1369.h"
+#ifdef X
+#include "h2899.h"
+#endif
+struct S2574 { int a; const char *s = "x//y"; };
+inline int f2574_0(int x) { return x * 0; }
+inline int f2574_1(int x) { return x * 1; }
+inline int f2574_2(int x) { return x * 2; }
+inline int f2574_3(int x) { return x * 3; }
+inline int f2574_4(int x) { return x * 4; }
+inline int f2574_5(int x) { return x * 5; }
+inline int f2574_6(int x) { return x * 6; }
+inline int f2574_7(int x) { return x * 7; }
+inline int f2574_8(int x) { return x * 8; }
+inline int f2574_9(int x) { return x * 9; }
+inline int f2574_10(int x) { return x * 10; }
+inline int f2574_11(int x) { return x * 11; }
+inline int f2574_12(int x) { return x * 12; }
+inline int f2574_13(int x) { return x * 13; }
+inline int f2574_14(int x) { return x * 14; }
+inline int f2574_15(int x) { return x * 15; }
+inline int f2574_16(int x) { return x * 16; }
+inline int f2574_17(int x) { return x * 17; }
+inline int f2574_18(int x) { return x * 18; }
+inline int f2574_19(int x) { return x * 19; }
+inline int f2574_20(int x) { return x * 20; }
+inline int f2574_21(int x) { return x * 21; }
+inline int f2574_22(int x) { return x * 22; }
+inline int f2574_23(int x) { return x * 23; }
+inline int f2574_24(int x) { return x * 24; }
+inline int f2574_25(int x) { return x * 25; }
+inline int f2574_26(int x) { return x * 26; }
+inline int f2574_27(int x) { return x * 27; }
+inline int f2574_28(int x) { return x * 28; }
+inline int f2574_29(int x) { return x * 29; }
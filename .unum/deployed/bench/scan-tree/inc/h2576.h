@@ -0,0 +1,42 @@
+#pragma once
+/* header 2576 */
+#include <vector>
+#include "h8444.h"
+#include "h4651.h"
+#include "h5930.h"
+#include "h843.h"
+#include "h1818.h"
+#ifdef X
+#include "h3639.h"
+#endif
+struct S2576 { int a; const char *s = "x//y"; };
+inline int f2576_0(int x) { return x * 0; }
+inline int f2576_1(int x) { return x * 1; }
+inline int f2576_2(int x) { return x * 2; }
+inline int f2576_3(int x) { return x * 3; }
+inline int f2576_4(int x) { return x * 4; }
+inline int f2576_5(int x) { return x * 5; }
+inline int f2576_6(int x) { return x * 6; }
+inline int f2576_7(int x) { return x * 7; }
+inline int f2576_8(int x) { return x * 8; }
+inline int f2576_9(int x) { return x * 9; }
+inline int f2576_10(int x) { return x * 10; }
+inline int f2576_11(int x) { return x * 11; }
+inline int f2576_12(int x) { return x * 12; }
+inline int f2576_13(int x) { return x * 13; }
+inline int f2576_14(int x) { return x * 14; }
+inline int f2576_15(int x) { return x * 15; }
+inline int f2576_16(int x) { return x * 16; }
+inline int f2576_17(int x) { return x * 17; }
+inline int f2576_18(int x) { return x * 18; }
+inline int f2576_19(int x) { return x * 19; }
+inline int f2576_20(int x) { return x * 20; }
+inline int f2576_21(int x) { return x * 21; }
+inline int f2576_22(int x) { return x * 22; }
+inline int f2576_23(int x) { return x * 23; }
+inline int f2576_24(int x) { return x * 24; }
+inline int f2576_25(int x) { return x * 25; }
+inline int f2576_26(int x) { return x * 26; }
+inline int f2576_27(int x) { return x * 27; }
+inline int f2576_28(int x) { return x * 28; }
+inline int f2576_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2577 */
+#include <vector>
+#include "h8683.h"
+#include "h1654.h"
+#include "h6802.h"
+#include "h2255.h"
+#include "h592.h"
+#ifdef X
+#include "h2385.h"
+#endif
+struct S2577 { int a; const char *s = "x//y"; };
+inline int f2577_0(int x) { return x * 0; }
+inline int f2577_1(int x) { return x * 1; }
+inline int f2577_2(int x) { return x * 2; }
+inline int f2577_3(int x) { return x * 3; }
+inline int f2577_4(int x) { return x * 4; }
+inline int f2577_5(int x) { return x * 5; }
+inline int f2577_6(int x) { return x * 6; }
+inline int f2577_7(int x) { return x * 7; }
+inline int f2577_8(int x) { return x * 8; }
+inline int f2577_9(int x) { return x * 9; }
+inline int f2577_10(int x) { return x * 10; }
+inline int f2577_11(int x) { return x * 11; }
+inline int f2577_12(int x) { return x * 12; }
+inline int f2577_13(int x) { return x * 13; }
+inline int f2577_14(int x) { return x * 14; }
+inline int f2577_15(int x) { return x * 15; }
+inline int f2577_16(int x) { return x * 16; }
+inline int f2577_17(int x) { return x * 17; }
+inline int f2577_18(int x) { return x * 18; }
+inline int f2577_19(int x) { return x * 19; }
+inline int f2577_20(int x) { return x * 20; }
+inline int f2577_21(int x) { return x * 21; }
+inline int f2577_22(int x) { return x * 22; }
+inline int f2577_23(int x) { return x * 23; }
+inline int f2577_24(int x) { return x * 24; }
+inline int f2577_25(int x) { return x * 25; }
+inline int f2577_26(int x) { return x * 26; }
+inline int f2577_27(int x) { return x * 27; }
+inline int f2577_28(int x) { return x * 28; }
+inline int f2577_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2578 */
+#include <vector>
+#include "h8352.h"
+#include "h5695.h"
+#include "h3116.h"
+#include "h7351.h"
+#include "h8081.h"
+#ifdef X
+#include "h376.h"
+#endif
+struct S2578 { int a; const char *s = "x//y"; };
+inline int f2578_0(int x) { return x * 0; }
+inline int f2578_1(int x) { return x * 1; }
+inline int f2578_2(int x) { return x * 2; }
+inline int f2578_3(int x) { return x * 3; }
+inline int f2578_4(int x) { return x * 4; }
+inline int f2578_5(int x) { return x * 5; }
+inline int f2578_6(int x) { return x * 6; }
+inline int f2578_7(int x) { return x * 7; }
+inline int f2578_8(int x) { return x * 8; }
+inline int f2578_9(int x) { return x * 9; }
+inline int f2578_10(int x) { return x * 10; }
+inline int f2578_11(int x) { return x * 11; }
+inline int f2578_12(int x) { return x * 12; }
+inline int f2578_13(int x) { return x * 13; }
+inline int f2578_14(int x) { return x * 14; }
+inline int f2578_15(int x) { return x * 15; }
+inline int f2578_16(int x) { return x * 16; }
+inline int f2578_17(int x) { return x * 17; }
+inline int f2578_18(int x) { return x * 18; }
+inline int f2578_19(int x) { return x * 19; }
+inline int f2578_20(int x) { return x * 20; }
+inline int f2578_21(int x) { return x * 21; }
+inline int f2578_22(int x) { return x * 22; }
+inline int f2578_23(int x) { return x * 23; }
+inline int f2578_24(int x) { return x * 24; }
+inline int f2578_25(int x) { return x * 25; }
+inline int f2578_26(int x) { return x * 26; }
+inline int f2578_27(int x) { return x * 27; }
+inline int f2578_28(int x) { return x * 28; }
+inline int f2578_29(int x) { return x * 29; }
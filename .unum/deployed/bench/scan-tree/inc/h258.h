@@ -0,0 +1,42 @@
+#pragma once
+/* header 258 */
+#include <vector>
+#include "h950.h"
+#include "h5521.h"
+#include "h6742.h"
+#include "h2464.h"
+#include "h6727.h"
+#ifdef X
+#include "h3312.h"
+#endif
+struct S258 { int a; const char *s = "x//y"; };
+inline int f258_0(int x) { return x * 0; }
+inline int f258_1(int x) { return x * 1; }
+inline int f258_2(int x) { return x * 2; }
+inline int f258_3(int x) { return x * 3; }
+inline int f258_4(int x) { return x * 4; }
+inline int f258_5(int x) { return x * 5; }
+inline int f258_6(int x) { return x * 6; }
+inline int f258_7(int x) { return x * 7; }
+inline int f258_8(int x) { return x * 8; }
+inline int f258_9(int x) { return x * 9; }
+inline int f258_10(int x) { return x * 10; }
+inline int f258_11(int x) { return x * 11; }
+inline int f258_12(int x) { return x * 12; }
+inline int f258_13(int x) { return x * 13; }
+inline int f258_14(int x) { return x * 14; }
+inline int f258_15(int x) { return x * 15; }
+inline int f258_16(int x) { return x * 16; }
+inline int f258_17(int x) { return x * 17; }
+inline int f258_18(int x) { return x * 18; }
+inline int f258_19(int x) { return x * 19; }
+inline int f258_20(int x) { return x * 20; }
+inline int f258_21(int x) { return x * 21; }
+inline int f258_22(int x) { return x * 22; }
+inline int f258_23(int x) { return x * 23; }
+inline int f258_24(int x) { return x * 24; }
+inline int f258_25(int x) { return x * 25; }
+inline int f258_26(int x) { return x * 26; }
+inline int f258_27(int x) { return x * 27; }
+inline int f258_28(int x) { return x * 28; }
+inline int f258_29(int x) { return x * 29; }
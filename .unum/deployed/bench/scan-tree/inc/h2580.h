@@ -0,0 +1,42 @@
+#pragma once
+/* header 2580 */
+#include <vector>
+#include "h5455.h"
+#include "h3558.h"
+#include "h9543.h"
+#include "h8967.h"
+#include "h3673.h"
+#ifdef X
+#include "h2397.h"
+#endif
+struct S2580 { int a; const char *s = "x//y"; };
+inline int f2580_0(int x) { return x * 0; }
+inline int f2580_1(int x) { return x * 1; }
+inline int f2580_2(int x) { return x * 2; }
+inline int f2580_3(int x) { return x * 3; }
+inline int f2580_4(int x) { return x * 4; }
+inline int f2580_5(int x) { return x * 5; }
+inline int f2580_6(int x) { return x * 6; }
+inline int f2580_7(int x) { return x * 7; }
+inline int f2580_8(int x) { return x * 8; }
+inline int f2580_9(int x) { return x * 9; }
+inline int f2580_10(int x) { return x * 10; }
+inline int f2580_11(int x) { return x * 11; }
+inline int f2580_12(int x) { return x * 12; }
+inline int f2580_13(int x) { return x * 13; }
+inline int f2580_14(int x) { return x * 14; }
+inline int f2580_15(int x) { return x * 15; }
+inline int f2580_16(int x) { return x * 16; }
+inline int f2580_17(int x) { return x * 17; }
+inline int f2580_18(int x) { return x * 18; }
+inline int f2580_19(int x) { return x * 19; }
+inline int f2580_20(int x) { return x * 20; }
+inline int f2580_21(int x) { return x * 21; }
+inline int f2580_22(int x) { return x * 22; }
+inline int f2580_23(int x) { return x * 23; }
+inline int f2580_24(int x) { return x * 24; }
+inline int f2580_25(int x) { return x * 25; }
+inline int f2580_26(int x) { return x * 26; }
+inline int f2580_27(int x) { return x * 27; }
+inline int f2580_28(int x) { return x * 28; }
+inline int f2580_29(int x) { return x * 29; }
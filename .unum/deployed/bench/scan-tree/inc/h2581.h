@@ -0,0 +1,42 @@
+#pragma once
+/* header 2581 */
+#include <vector>
+#include "h6895.h"
+#include "h6127.h"
+#include "h9732.h"
+#include "h8012.h"
+#include "h5279.h"
+#ifdef X
+#include "h3080.h"
+#endif
+struct S2581 { int a; const char *s = "x//y"; };
+inline int f2581_0(int x) { return x * 0; }
+inline int f2581_1(int x) { return x * 1; }
+inline int f2581_2(int x) { return x * 2; }
+inline int f2581_3(int x) { return x * 3; }
+inline int f2581_4(int x) { return x * 4; }
+inline int f2581_5(int x) { return x * 5; }
+inline int f2581_6(int x) { return x * 6; }
+inline int f2581_7(int x) { return x * 7; }
+inline int f2581_8(int x) { return x * 8; }
+inline int f2581_9(int x) { return x * 9; }
+inline int f2581_10(int x) { return x * 10; }
+inline int f2581_11(int x) { return x * 11; }
+inline int f2581_12(int x) { return x * 12; }
+inline int f2581_13(int x) { return x * 13; }
+inline int f2581_14(int x) { return x * 14; }
+inline int f2581_15(int x) { return x * 15; }
+inline int f2581_16(int x) { return x * 16; }
+inline int f2581_17(int x) { return x * 17; }
+inline int f2581_18(int x) { return x * 18; }
+inline int f2581_19(int x) { return x * 19; }
+inline int f2581_20(int x) { return x * 20; }
+inline int f2581_21(int x) { return x * 21; }
+inline int f2581_22(int x) { return x * 22; }
+inline int f2581_23(int x) { return x * 23; }
+inline int f2581_24(int x) { return x * 24; }
+inline int f2581_25(int x) { return x * 25; }
+inline int f2581_26(int x) { return x * 26; }
+inline int f2581_27(int x) { return x * 27; }
+inline int f2581_28(int x) { return x * 28; }
+inline int f2581_29(int x) { return x * 29; }
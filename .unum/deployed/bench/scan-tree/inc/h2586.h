@@ -0,0 +1,42 @@
+#pragma once
+/* header 2586 */
+#include <vector>
+#include "h5957.h"
+#include "h6965.h"
+#include "h8682.h"
+#include "h8128.h"
+#include "h3881.h"
+#ifdef X
+#include "h7788.h"
+#endif
+struct S2586 { int a; const char *s = "x//y"; };
+inline int f2586_0(int x) { return x * 0; }
+inline int f2586_1(int x) { return x * 1; }
+inline int f2586_2(int x) { return x * 2; }
+inline int f2586_3(int x) { return x * 3; }
+inline int f2586_4(int x) { return x * 4; }
+inline int f2586_5(int x) { return x * 5; }
+inline int f2586_6(int x) { return x * 6; }
+inline int f2586_7(int x) { return x * 7; }
+inline int f2586_8(int x) { return x * 8; }
+inline int f2586_9(int x) { return x * 9; }
+inline int f2586_10(int x) { return x * 10; }
+inline int f2586_11(int x) { return x * 11; }
+inline int f2586_12(int x) { return x * 12; }
+inline int f2586_13(int x) { return x * 13; }
+inline int f2586_14(int x) { return x * 14; }
+inline int f2586_15(int x) { return x * 15; }
+inline int f2586_16(int x) { return x * 16; }
+inline int f2586_17(int x) { return x * 17; }
+inline int f2586_18(int x) { return x * 18; }
+inline int f2586_19(int x) { return x * 19; }
+inline int f2586_20(int x) { return x * 20; }
+inline int f2586_21(int x) { return x * 21; }
+inline int f2586_22(int x) { return x * 22; }
+inline int f2586_23(int x) { return x * 23; }
+inline int f2586_24(int x) { return x * 24; }
+inline int f2586_25(int x) { return x * 25; }
+inline int f2586_26(int x) { return x * 26; }
+inline int f2586_27(int x) { return x * 27; }
+inline int f2586_28(int x) { return x * 28; }
+inline int f2586_29(int x) { return x * 29; }
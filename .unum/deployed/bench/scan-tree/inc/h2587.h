@@ -0,0 +1,42 @@
+#pragma once
+/* header 2587 */
+#include <vector>
+#include "h9986.h"
+#include "h6154.h"
+#include "h140.h"
+#include "h6394.h"
+#include "h6185.h"
+#ifdef X
+#include "h4301.h"
+#endif
+struct S2587 { int a; const char *s = "x//y"; };
+inline int f2587_0(int x) { return x * 0; }
+inline int f2587_1(int x) { return x * 1; }
+inline int f2587_2(int x) { return x * 2; }
+inline int f2587_3(int x) { return x * 3; }
+inline int f2587_4(int x) { return x * 4; }
+inline int f2587_5(int x) { return x * 5; }
+inline int f2587_6(int x) { return x * 6; }
+inline int f2587_7(int x) { return x * 7; }
+inline int f2587_8(int x) { return x * 8; }
+inline int f2587_9(int x) { return x * 9; }
+inline int f2587_10(int x) { return x * 10; }
+inline int f2587_11(int x) { return x * 11; }
+inline int f2587_12(int x) { return x * 12; }
+inline int f2587_13(int x) { return x * 13; }
+inline int f2587_14(int x) { return x * 14; }
+inline int f2587_15(int x) { return x * 15; }
+inline int f2587_16(int x) { return x * 16; }
+inline int f2587_17(int x) { return x * 17; }
+inline int f2587_18(int x) { return x * 18; }
+inline int f2587_19(int x) { return x * 19; }
+inline int f2587_20(int x) { return x * 20; }
+inline int f2587_21(int x) { return x * 21; }
+inline int f2587_22(int x) { return x * 22; }
+inline int f2587_23(int x) { return x * 23; }
+inline int f2587_24(int x) { return x * 24; }
+inline int f2587_25(int x) { return x * 25; }
+inline int f2587_26(int x) { return x * 26; }
+inline int f2587_27(int x) { return x * 27; }
+inline int f2587_28(int x) { return x * 28; }
+inline int f2587_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2589 */
+#include <vector>
+#include "h958.h"
+#include "h3408.h"
+#include "h6875.h"
+#include "h4959.h"
+#include "h7831.h"
+#ifdef X
+#include "h548.h"
+#endif
+struct S2589 { int a; const char *s = "x//y"; };
+inline int f2589_0(int x) { return x * 0; }
+inline int f2589_1(int x) { return x * 1; }
+inline int f2589_2(int x) { return x * 2; }
+inline int f2589_3(int x) { return x * 3; }
+inline int f2589_4(int x) { return x * 4; }
+inline int f2589_5(int x) { return x * 5; }
+inline int f2589_6(int x) { return x * 6; }
+inline int f2589_7(int x) { return x * 7; }
+inline int f2589_8(int x) { return x * 8; }
+inline int f2589_9(int x) { return x * 9; }
+inline int f2589_10(int x) { return x * 10; }
+inline int f2589_11(int x) { return x * 11; }
+inline int f2589_12(int x) { return x * 12; }
+inline int f2589_13(int x) { return x * 13; }
+inline int f2589_14(int x) { return x * 14; }
+inline int f2589_15(int x) { return x * 15; }
+inline int f2589_16(int x) { return x * 16; }
+inline int f2589_17(int x) { return x * 17; }
+inline int f2589_18(int x) { return x * 18; }
+inline int f2589_19(int x) { return x * 19; }
+inline int f2589_20(int x) { return x * 20; }
+inline int f2589_21(int x) { return x * 21; }
+inline int f2589_22(int x) { return x * 22; }
+inline int f2589_23(int x) { return x * 23; }
+inline int f2589_24(int x) { return x * 24; }
+inline int f2589_25(int x) { return x * 25; }
+inline int f2589_26(int x) { return x * 26; }
+inline int f2589_27(int x) { return x * 27; }
+inline int f2589_28(int x) { return x * 28; }
+inline int f2589_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 259 */
+#include <vector>
+#include "h1308.h"
+#include "h3047.h"
+#include "h2382.h"
+#include "h5039.h"
+#include "h4434.h"
+#ifdef X
+#include "h7849.h"
+#endif
+struct S259 { int a; const char *s = "x//y"; };
+inline int f259_0(int x) { return x * 0; }
+inline int f259_1(int x) { return x * 1; }
+inline int f259_2(int x) { return x * 2; }
+inline int f259_3(int x) { return x * 3; }
+inline int f259_4(int x) { return x * 4; }
+inline int f259_5(int x) { return x * 5; }
+inline int f259_6(int x) { return x * 6; }
+inline int f259_7(int x) { return x * 7; }
+inline int f259_8(int x) { return x * 8; }
+inline int f259_9(int x) { return x * 9; }
+inline int f259_10(int x) { return x * 10; }
+inline int f259_11(int x) { return x * 11; }
+inline int f259_12(int x) { return x * 12; }
+inline int f259_13(int x) { return x * 13; }
+inline int f259_14(int x) { return x * 14; }
+inline int f259_15(int x) { return x * 15; }
+inline int f259_16(int x) { return x * 16; }
+inline int f259_17(int x) { return x * 17; }
+inline int f259_18(int x) { return x * 18; }
+inline int f259_19(int x) { return x * 19; }
+inline int f259_20(int x) { return x * 20; }
+inline int f259_21(int x) { return x * 21; }
+inline int f259_22(int x) { return x * 22; }
+inline int f259_23(int x) { return x * 23; }
+inline int f259_24(int x) { return x * 24; }
+inline int f259_25(int x) { return x * 25; }
+inline int f259_26(int x) { return x * 26; }
+inline int f259_27(int x) { return x * 27; }
+inline int f259_28(int x) { return x * 28; }
+inline int f259_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2591 */
+#include <vector>
+#include "h4357.h"
+#include "h3129.h"
+#include "h1254.h"
+#include "h6526.h"
+#include "h3347.h"
+#ifdef X
+#include "h3576.h"
+#endif
+struct S2591 { int a; const char *s = "x//y"; };
+inline int f2591_0(int x) { return x * 0; }
+inline int f2591_1(int x) { return x * 1; }
+inline int f2591_2(int x) { return x * 2; }
+inline int f2591_3(int x) { return x * 3; }
+inline int f2591_4(int x) { return x * 4; }
+inline int f2591_5(int x) { return x * 5; }
+inline int f2591_6(int x) { return x * 6; }
+inline int f2591_7(int x) { return x * 7; }
+inline int f2591_8(int x) { return x * 8; }
+inline int f2591_9(int x) { return x * 9; }
+inline int f2591_10(int x) { return x * 10; }
+inline int f2591_11(int x) { return x * 11; }
+inline int f2591_12(int x) { return x * 12; }
+inline int f2591_13(int x) { return x * 13; }
+inline int f2591_14(int x) { return x * 14; }
+inline int f2591_15(int x) { return x * 15; }
+inline int f2591_16(int x) { return x * 16; }
+inline int f2591_17(int x) { return x * 17; }
+inline int f2591_18(int x) { return x * 18; }
+inline int f2591_19(int x) { return x * 19; }
+inline int f2591_20(int x) { return x * 20; }
+inline int f2591_21(int x) { return x * 21; }
+inline int f2591_22(int x) { return x * 22; }
+inline int f2591_23(int x) { return x * 23; }
+inline int f2591_24(int x) { return x * 24; }
+inline int f2591_25(int x) { return x * 25; }
+inline int f2591_26(int x) { return x * 26; }
+inline int f2591_27(int x) { return x * 27; }
+inline int f2591_28(int x) { return x * 28; }
+inline int f2591_29(int x) { return x * 29; }
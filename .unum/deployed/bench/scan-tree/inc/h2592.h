@@ -0,0 +1,42 @@
+#pragma once
+/* header 2592 */
+#include <vector>
+#include "h4684.h"
+#include "h6295.h"
+#include "h1547.h"
+#include "h9622.h"
+#include "h9002.h"
+#ifdef X
+#include "h5493.h"
+#endif
+struct S2592 { int a; const char *s = "x//y"; };
+inline int f2592_0(int x) { return x * 0; }
+inline int f2592_1(int x) { return x * 1; }
+inline int f2592_2(int x) { return x * 2; }
+inline int f2592_3(int x) { return x * 3; }
+inline int f2592_4(int x) { return x * 4; }
+inline int f2592_5(int x) { return x * 5; }
+inline int f2592_6(int x) { return x * 6; }
+inline int f2592_7(int x) { return x * 7; }
+inline int f2592_8(int x) { return x * 8; }
+inline int f2592_9(int x) { return x * 9; }
+inline int f2592_10(int x) { return x * 10; }
+inline int f2592_11(int x) { return x * 11; }
+inline int f2592_12(int x) { return x * 12; }
+inline int f2592_13(int x) { return x * 13; }
+inline int f2592_14(int x) { return x * 14; }
+inline int f2592_15(int x) { return x * 15; }
+inline int f2592_16(int x) { return x * 16; }
+inline int f2592_17(int x) { return x * 17; }
+inline int f2592_18(int x) { return x * 18; }
+inline int f2592_19(int x) { return x * 19; }
+inline int f2592_20(int x) { return x * 20; }
+inline int f2592_21(int x) { return x * 21; }
+inline int f2592_22(int x) { return x * 22; }
+inline int f2592_23(int x) { return x * 23; }
+inline int f2592_24(int x) { return x * 24; }
+inline int f2592_25(int x) { return x * 25; }
+inline int f2592_26(int x) { return x * 26; }
+inline int f2592_27(int x) { return x * 27; }
+inline int f2592_28(int x) { return x * 28; }
+inline int f2592_29(int x) { return x * 29; }
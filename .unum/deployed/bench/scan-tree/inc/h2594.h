@@ -0,0 +1,42 @@
+#pragma once
+/* header 2594 */
+#include <vector>
+#include "h2629.h"
+#include "h4890.h"
+#include "h6794.h"
+#include "h6333.h"
+#include "h3897.h"
+#ifdef X
+#include "h1185.h"
+#endif
+struct S2594 { int a; const char *s = "x//y"; };
+inline int f2594_0(int x) { return x * 0; }
+inline int f2594_1(int x) { return x * 1; }
+inline int f2594_2(int x) { return x * 2; }
+inline int f2594_3(int x) { return x * 3; }
+inline int f2594_4(int x) { return x * 4; }
+inline int f2594_5(int x) { return x * 5; }
+inline int f2594_6(int x) { return x * 6; }
+inline int f2594_7(int x) { return x * 7; }
+inline int f2594_8(int x) { return x * 8; }
+inline int f2594_9(int x) { return x * 9; }
+inline int f2594_10(int x) { return x * 10; }
+inline int f2594_11(int x) { return x * 11; }
+inline int f2594_12(int x) { return x * 12; }
+inline int f2594_13(int x) { return x * 13; }
+inline int f2594_14(int x) { return x * 14; }
+inline int f2594_15(int x) { return x * 15; }
+inline int f2594_16(int x) { return x * 16; }
+inline int f2594_17(int x) { return x * 17; }
+inline int f2594_18(int x) { return x * 18; }
+inline int f2594_19(int x) { return x * 19; }
+inline int f2594_20(int x) { return x * 20; }
+inline int f2594_21(int x) { return x * 21; }
+inline int f2594_22(int x) { return x * 22; }
+inline int f2594_23(int x) { return x * 23; }
+inline int f2594_24(int x) { return x * 24; }
+inline int f2594_25(int x) { return x * 25; }
+inline int f2594_26(int x) { return x * 26; }
+inline int f2594_27(int x) { return x * 27; }
+inline int f2594_28(int x) { return x * 28; }
+inline int f2594_29(int x) { return x * 29; }
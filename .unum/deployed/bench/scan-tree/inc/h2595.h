@@ -0,0 +1,42 @@
+#pragma once
+/* header 2595 */
+#include <vector>
+#include "h4053.h"
+#include "h7856.h"
+#include "h3231.h"
+#include "h207.h"
+#include "h8135.h"
+#ifdef X
+#include "h3934.h"
+#endif
+struct S2595 { int a; const char *s = "x//y"; };
+inline int f2595_0(int x) { return x * 0; }
+inline int f2595_1(int x) { return x * 1; }
+inline int f2595_2(int x) { return x * 2; }
+inline int f2595_3(int x) { return x * 3; }
+inline int f2595_4(int x) { return x * 4; }
+inline int f2595_5(int x) { return x * 5; }
+inline int f2595_6(int x) { return x * 6; }
+inline int f2595_7(int x) { return x * 7; }
+inline int f2595_8(int x) { return x * 8; }
+inline int f2595_9(int x) { return x * 9; }
+inline int f2595_10(int x) { return x * 10; }
+inline int f2595_11(int x) { return x * 11; }
+inline int f2595_12(int x) { return x * 12; }
+inline int f2595_13(int x) { return x * 13; }
+inline int f2595_14(int x) { return x * 14; }
+inline int f2595_15(int x) { return x * 15; }
+inline int f2595_16(int x) { return x * 16; }
+inline int f2595_17(int x) { return x * 17; }
+inline int f2595_18(int x) { return x * 18; }
+inline int f2595_19(int x) { return x * 19; }
+inline int f2595_20(int x) { return x * 20; }
+inline int f2595_21(int x) { return x * 21; }
+inline int f2595_22(int x) { return x * 22; }
+inline int f2595_23(int x) { return x * 23; }
+inline int f2595_24(int x) { return x * 24; }
+inline int f2595_25(int x) { return x * 25; }
+inline int f2595_26(int x) { return x * 26; }
+inline int f2595_27(int x) { return x * 27; }
+inline int f2595_28(int x) { return x * 28; }
+inline int f2595_29(int x) { return x * 29; }
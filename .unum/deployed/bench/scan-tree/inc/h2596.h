@@ -0,0 +1,42 @@
+#pragma once
+/* header 2596 */
+#include <vector>
+#include "h1380.h"
+#include "h7287.h"
+#include "h7337.h"
+#include "h3937.h"
+#include "h4467.h"
+#ifdef X
+#include "h4729.h"
+#endif
+struct S2596 { int a; const char *s = "x//y"; };
+inline int f2596_0(int x) { return x * 0; }
+inline int f2596_1(int x) { return x * 1; }
+inline int f2596_2(int x) { return x * 2; }
+inline int f2596_3(int x) { return x * 3; }
+inline int f2596_4(int x) { return x * 4; }
+inline int f2596_5(int x) { return x * 5; }
+inline int f2596_6(int x) { return x * 6; }
+inline int f2596_7(int x) { return x * 7; }
+inline int f2596_8(int x) { return x * 8; }
+inline int f2596_9(int x) { return x * 9; }
+inline int f2596_10(int x) { return x * 10; }
+inline int f2596_11(int x) { return x * 11; }
+inline int f2596_12(int x) { return x * 12; }
+inline int f2596_13(int x) { return x * 13; }
+inline int f2596_14(int x) { return x * 14; }
+inline int f2596_15(int x) { return x * 15; }
+inline int f2596_16(int x) { return x * 16; }
+inline int f2596_17(int x) { return x * 17; }
+inline int f2596_18(int x) { return x * 18; }
+inline int f2596_19(int x) { return x * 19; }
+inline int f2596_20(int x) { return x * 20; }
+inline int f2596_21(int x) { return x * 21; }
+inline int f2596_22(int x) { return x * 22; }
+inline int f2596_23(int x) { return x * 23; }
+inline int f2596_24(int x) { return x * 24; }
+inline int f2596_25(int x) { return x * 25; }
+inline int f2596_26(int x) { return x * 26; }
+inline int f2596_27(int x) { return x * 27; }
+inline int f2596_28(int x) { return x * 28; }
+inline int f2596_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2597 */
+#include <vector>
+#include "h1061.h"
+#include "h1367.h"
+#include "h6317.h"
+#include "h4506.h"
+#include "h7316.h"
+#ifdef X
+#include "h5259.h"
+#endif
+struct S2597 { int a; const char *s = "x//y"; };
+inline int f2597_0(int x) { return x * 0; }
+inline int f2597_1(int x) { return x * 1; }
+inline int f2597_2(int x) { return x * 2; }
+inline int f2597_3(int x) { return x * 3; }
+inline int f2597_4(int x) { return x * 4; }
+inline int f2597_5(int x) { return x * 5; }
+inline int f2597_6(int x) { return x * 6; }
+inline int f2597_7(int x) { return x * 7; }
+inline int f2597_8(int x) { return x * 8; }
+inline int f2597_9(int x) { return x * 9; }
+inline int f2597_10(int x) { return x * 10; }
+inline int f2597_11(int x) { return x * 11; }
+inline int f2597_12(int x) { return x * 12; }
+inline int f2597_13(int x) { return x * 13; }
+inline int f2597_14(int x) { return x * 14; }
+inline int f2597_15(int x) { return x * 15; }
+inline int f2597_16(int x) { return x * 16; }
+inline int f2597_17(int x) { return x * 17; }
+inline int f2597_18(int x) { return x * 18; }
+inline int f2597_19(int x) { return x * 19; }
+inline int f2597_20(int x) { return x * 20; }
+inline int f2597_21(int x) { return x * 21; }
+inline int f2597_22(int x) { return x * 22; }
+inline int f2597_23(int x) { return x * 23; }
+inline int f2597_24(int x) { return x * 24; }
+inline int f2597_25(int x) { return x * 25; }
+inline int f2597_26(int x) { return x * 26; }
+inline int f2597_27(int x) { return x * 27; }
+inline int f2597_28(int x) { return x * 28; }
+inline int f2597_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 26 */
+#include <vector>
+#include "h6378.h"
+#include "h9903.h"
+#include "h4588.h"
+#include "h8249.h"
+#include "h8515.h"
+#ifdef X
+#include "h1482.h"
+#endif
+struct S26 { int a; const char *s = "x//y"; };
+inline int f26_0(int x) { return x * 0; }
+inline int f26_1(int x) { return x * 1; }
+inline int f26_2(int x) { return x * 2; }
+inline int f26_3(int x) { return x * 3; }
+inline int f26_4(int x) { return x * 4; }
+inline int f26_5(int x) { return x * 5; }
+inline int f26_6(int x) { return x * 6; }
+inline int f26_7(int x) { return x * 7; }
+inline int f26_8(int x) { return x * 8; }
+inline int f26_9(int x) { return x * 9; }
+inline int f26_10(int x) { return x * 10; }
+inline int f26_11(int x) { return x * 11; }
+inline int f26_12(int x) { return x * 12; }
+inline int f26_13(int x) { return x * 13; }
+inline int f26_14(int x) { return x * 14; }
+inline int f26_15(int x) { return x * 15; }
+inline int f26_16(int x) { return x * 16; }
+inline int f26_17(int x) { return x * 17; }
+inline int f26_18(int x) { return x * 18; }
+inline int f26_19(int x) { return x * 19; }
+inline int f26_20(int x) { return x * 20; }
+inline int f26_21(int x) { return x * 21; }
+inline int f26_22(int x) { return x * 22; }
+inline int f26_23(int x) { return x * 23; }
+inline int f26_24(int x) { return x * 24; }
+inline int f26_25(int x) { return x * 25; }
+inline int f26_26(int x) { return x * 26; }
+inline int f26_27(int x) { return x * 27; }
+inline int f26_28(int x) { return x * 28; }
+inline int f26_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2600 */
+#include <vector>
+#include "h7715.h"
+#include "h4447.h"
+#include "h9500.h"
+#include "h89.h"
+#include "h2744.h"
+#ifdef X
+#include "h7233.h"
+#endif
+struct S2600 { int a; const char *s = "x//y"; };
+inline int f2600_0(int x) { return x * 0; }
+inline int f2600_1(int x) { return x * 1; }
+inline int f2600_2(int x) { return x * 2; }
+inline int f2600_3(int x) { return x * 3; }
+inline int f2600_4(int x) { return x * 4; }
+inline int f2600_5(int x) { return x * 5; }
+inline int f2600_6(int x) { return x * 6; }
+inline int f2600_7(int x) { return x * 7; }
+inline int f2600_8(int x) { return x * 8; }
+inline int f2600_9(int x) { return x * 9; }
+inline int f2600_10(int x) { return x * 10; }
+inline int f2600_11(int x) { return x * 11; }
+inline int f2600_12(int x) { return x * 12; }
+inline int f2600_13(int x) { return x * 13; }
+inline int f2600_14(int x) { return x * 14; }
+inline int f2600_15(int x) { return x * 15; }
+inline int f2600_16(int x) { return x * 16; }
+inline int f2600_17(int x) { return x * 17; }
+inline int f2600_18(int x) { return x * 18; }
+inline int f2600_19(int x) { return x * 19; }
+inline int f2600_20(int x) { return x * 20; }
+inline int f2600_21(int x) { return x * 21; }
+inline int f2600_22(int x) { return x * 22; }
+inline int f2600_23(int x) { return x * 23; }
+inline int f2600_24(int x) { return x * 24; }
+inline int f2600_25(int x) { return x * 25; }
+inline int f2600_26(int x) { return x * 26; }
+inline int f2600_27(int x) { return x * 27; }
+inline int f2600_28(int x) { return x * 28; }
+inline int f2600_29(int x) { return x * 29; }
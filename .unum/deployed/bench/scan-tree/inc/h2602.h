@@ -0,0 +1,42 @@
+#pragma once
+/* header 2602 */
+#include <vector>
+#include "h2549.h"
+#include "h2805.h"
+#include "h2030.h"
+#include "h9640.h"
+#include "h7368.h"
+#ifdef X
+#include "h6451.h"
+#endif
+struct S2602 { int a; const char *s = "x//y"; };
+inline int f2602_0(int x) { return x * 0; }
+inline int f2602_1(int x) { return x * 1; }
+inline int f2602_2(int x) { return x * 2; }
+inline int f2602_3(int x) { return x * 3; }
+inline int f2602_4(int x) { return x * 4; }
+inline int f2602_5(int x) { return x * 5; }
+inline int f2602_6(int x) { return x * 6; }
+inline int f2602_7(int x) { return x * 7; }
+inline int f2602_8(int x) { return x * 8; }
+inline int f2602_9(int x) { return x * 9; }
+inline int f2602_10(int x) { return x * 10; }
+inline int f2602_11(int x) { return x * 11; }
+inline int f2602_12(int x) { return x * 12; }
+inline int f2602_13(int x) { return x * 13; }
+inline int f2602_14(int x) { return x * 14; }
+inline int f2602_15(int x) { return x * 15; }
+inline int f2602_16(int x) { return x * 16; }
+inline int f2602_17(int x) { return x * 17; }
+inline int f2602_18(int x) { return x * 18; }
+inline int f2602_19(int x) { return x * 19; }
+inline int f2602_20(int x) { return x * 20; }
+inline int f2602_21(int x) { return x * 21; }
+inline int f2602_22(int x) { return x * 22; }
+inline int f2602_23(int x) { return x * 23; }
+inline int f2602_24(int x) { return x * 24; }
+inline int f2602_25(int x) { return x * 25; }
+inline int f2602_26(int x) { return x * 26; }
+inline int f2602_27(int x) { return x * 27; }
+inline int f2602_28(int x) { return x * 28; }
+inline int f2602_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2603 */
+#include <vector>
+#include "h7017.h"
+#include "h8214.h"
+#include "h2375.h"
+#include "h1318.h"
+#include "h83.h"
+#ifdef X
+#include "h7470.h"
+#endif
+struct S2603 { int a; const char *s = "x//y"; };
+inline int f2603_0(int x) { return x * 0; }
+inline int f2603_1(int x) { return x * 1; }
+inline int f2603_2(int x) { return x * 2; }
+inline int f2603_3(int x) { return x * 3; }
+inline int f2603_4(int x) { return x * 4; }
+inline int f2603_5(int x) { return x * 5; }
+inline int f2603_6(int x) { return x * 6; }
+inline int f2603_7(int x) { return x * 7; }
+inline int f2603_8(int x) { return x * 8; }
+inline int f2603_9(int x) { return x * 9; }
+inline int f2603_10(int x) { return x * 10; }
+inline int f2603_11(int x) { return x * 11; }
+inline int f2603_12(int x) { return x * 12; }
+inline int f2603_13(int x) { return x * 13; }
+inline int f2603_14(int x) { return x * 14; }
+inline int f2603_15(int x) { return x * 15; }
+inline int f2603_16(int x) { return x * 16; }
+inline int f2603_17(int x) { return x * 17; }
+inline int f2603_18(int x) { return x * 18; }
+inline int f2603_19(int x) { return x * 19; }
+inline int f2603_20(int x) { return x * 20; }
+inline int f2603_21(int x) { return x * 21; }
+inline int f2603_22(int x) { return x * 22; }
+inline int f2603_23(int x) { return x * 23; }
+inline int f2603_24(int x) { return x * 24; }
+inline int f2603_25(int x) { return x * 25; }
+inline int f2603_26(int x) { return x * 26; }
+inline int f2603_27(int x) { return x * 27; }
+inline int f2603_28(int x) { return x * 28; }
+inline int f2603_29(int x) { return x * 29; }
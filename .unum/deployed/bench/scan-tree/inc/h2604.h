@@ -0,0 +1,42 @@
+#pragma once
+/* header 2604 */
+#include <vector>
+#include "h1145.h"
+#include "h8301.h"
+#include "h1401.h"
+#include "h3787.h"
+#include "h513.h"
+#ifdef X
+#include "h4401.h"
+#endif
+struct S2604 { int a; const char *s = "x//y"; };
+inline int f2604_0(int x) { return x * 0; }
+inline int f2604_1(int x) { return x * 1; }
+inline int f2604_2(int x) { return x * 2; }
+inline int f2604_3(int x) { return x * 3; }
+inline int f2604_4(int x) { return x * 4; }
+inline int f2604_5(int x) { return x * 5; }
+inline int f2604_6(int x) { return x * 6; }
+inline int f2604_7(int x) { return x * 7; }
+inline int f2604_8(int x) { return x * 8; }
+inline int f2604_9(int x) { return x * 9; }
+inline int f2604_10(int x) { return x * 10; }
+inline int f2604_11(int x) { return x * 11; }
+inline int f2604_12(int x) { return x * 12; }
+inline int f2604_13(int x) { return x * 13; }
+inline int f2604_14(int x) { return x * 14; }
+inline int f2604_15(int x) { return x * 15; }
+inline int f2604_16(int x) { return x * 16; }
+inline int f2604_17(int x) { return x * 17; }
+inline int f2604_18(int x) { return x * 18; }
+inline int f2604_19(int x) { return x * 19; }
+inline int f2604_20(int x) { return x * 20; }
+inline int f2604_21(int x) { return x * 21; }
+inline int f2604_22(int x) { return x * 22; }
+inline int f2604_23(int x) { return x * 23; }
+inline int f2604_24(int x) { return x * 24; }
+inline int f2604_25(int x) { return x * 25; }
+inline int f2604_26(int x) { return x * 26; }
+inline int f2604_27(int x) { return x * 27; }
+inline int f2604_28(int x) { return x * 28; }
+inline int f2604_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2606 */
+#include <vector>
+#include "h133.h"
+#include "h8874.h"
+#include "h7517.h"
+#include "h6885.h"
+#include "h2640.h"
+#ifdef X
+#include "h97.h"
+#endif
+struct S2606 { int a; const char *s = "x//y"; };
+inline int f2606_0(int x) { return x * 0; }
+inline int f2606_1(int x) { return x * 1; }
+inline int f2606_2(int x) { return x * 2; }
+inline int f2606_3(int x) { return x * 3; }
+inline int f2606_4(int x) { return x * 4; }
+inline int f2606_5(int x) { return x * 5; }
+inline int f2606_6(int x) { return x * 6; }
+inline int f2606_7(int x) { return x * 7; }
+inline int f2606_8(int x) { return x * 8; }
+inline int f2606_9(int x) { return x * 9; }
+inline int f2606_10(int x) { return x * 10; }
+inline int f2606_11(int x) { return x * 11; }
+inline int f2606_12(int x) { return x * 12; }
+inline int f2606_13(int x) { return x * 13; }
+inline int f2606_14(int x) { return x * 14; }
+inline int f2606_15(int x) { return x * 15; }
+inline int f2606_16(int x) { return x * 16; }
+inline int f2606_17(int x) { return x * 17; }
+inline int f2606_18(int x) { return x * 18; }
+inline int f2606_19(int x) { return x * 19; }
+inline int f2606_20(int x) { return x * 20; }
+inline int f2606_21(int x) { return x * 21; }
+inline int f2606_22(int x) { return x * 22; }
+inline int f2606_23(int x) { return x * 23; }
+inline int f2606_24(int x) { return x * 24; }
+inline int f2606_25(int x) { return x * 25; }
+inline int f2606_26(int x) { return x * 26; }
+inline int f2606_27(int x) { return x * 27; }
+inline int f2606_28(int x) { return x * 28; }
+inline int f2606_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2608 */
+#include <vector>
+#include "h148.h"
+#include "h4278.h"
+#include "h9828.h"
+#include "h7151.h"
+#include "h3315.h"
+#ifdef X
+#include "h8293.h"
+#endif
+struct S2608 { int a; const char *s = "x//y"; };
+inline int f2608_0(int x) { return x * 0; }
+inline int f2608_1(int x) { return x * 1; }
+inline int f2608_2(int x) { return x * 2; }
+inline int f2608_3(int x) { return x * 3; }
+inline int f2608_4(int x) { return x * 4; }
+inline int f2608_5(int x) { return x * 5; }
+inline int f2608_6(int x) { return x * 6; }
+inline int f2608_7(int x) { return x * 7; }
+inline int f2608_8(int x) { return x * 8; }
+inline int f2608_9(int x) { return x * 9; }
+inline int f2608_10(int x) { return x * 10; }
+inline int f2608_11(int x) { return x * 11; }
+inline int f2608_12(int x) { return x * 12; }
+inline int f2608_13(int x) { return x * 13; }
+inline int f2608_14(int x) { return x * 14; }
+inline int f2608_15(int x) { return x * 15; }
+inline int f2608_16(int x) { return x * 16; }
+inline int f2608_17(int x) { return x * 17; }
+inline int f2608_18(int x) { return x * 18; }
+inline int f2608_19(int x) { return x * 19; }
+inline int f2608_20(int x) { return x * 20; }
+inline int f2608_21(int x) { return x * 21; }
+inline int f2608_22(int x) { return x * 22; }
+inline int f2608_23(int x) { return x * 23; }
+inline int f2608_24(int x) { return x * 24; }
+inline int f2608_25(int x) { return x * 25; }
+inline int f2608_26(int x) { return x * 26; }
+inline int f2608_27(int x) { return x * 27; }
+inline int f2608_28(int x) { return x * 28; }
+inline int f2608_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 261 */
+#include <vector>
+#include "h3123.h"
+#include "h3547.h"
+#include "h3186.h"
+#include "h3758.h"
+#include "h8709.h"
+#ifdef X
+#include "h1296.h"
+#endif
+struct S261 { int a; const char *s = "x//y"; };
+inline int f261_0(int x) { return x * 0; }
+inline int f261_1(int x) { return x * 1; }
+inline int f261_2(int x) { return x * 2; }
+inline int f261_3(int x) { return x * 3; }
+inline int f261_4(int x) { return x * 4; }
+inline int f261_5(int x) { return x * 5; }
+inline int f261_6(int x) { return x * 6; }
+inline int f261_7(int x) { return x * 7; }
+inline int f261_8(int x) { return x * 8; }
+inline int f261_9(int x) { return x * 9; }
+inline int f261_10(int x) { return x * 10; }
+inline int f261_11(int x) { return x * 11; }
+inline int f261_12(int x) { return x * 12; }
+inline int f261_13(int x) { return x * 13; }
+inline int f261_14(int x) { return x * 14; }
+inline int f261_15(int x) { return x * 15; }
+inline int f261_16(int x) { return x * 16; }
+inline int f261_17(int x) { return x * 17; }
+inline int f261_18(int x) { return x * 18; }
+inline int f261_19(int x) { return x * 19; }
+inline int f261_20(int x) { return x * 20; }
+inline int f261_21(int x) { return x * 21; }
+inline int f261_22(int x) { return x * 22; }
+inline int f261_23(int x) { return x * 23; }
+inline int f261_24(int x) { return x * 24; }
+inline int f261_25(int x) { return x * 25; }
+inline int f261_26(int x) { return x * 26; }
+inline int f261_27(int x) { return x * 27; }
+inline int f261_28(int x) { return x * 28; }
+inline int f261_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2610 */
+#include <vector>
+#include "h8794.h"
+#include "h5803.h"
+#include "h2219.h"
+#include "h1021.h"
+#include "h1453.h"
+#ifdef X
+#include "h9015.h"
+#endif
+struct S2610 { int a; const char *s = "x//y"; };
+inline int f2610_0(int x) { return x * 0; }
+inline int f2610_1(int x) { return x * 1; }
+inline int f2610_2(int x) { return x * 2; }
+inline int f2610_3(int x) { return x * 3; }
+inline int f2610_4(int x) { return x * 4; }
+inline int f2610_5(int x) { return x * 5; }
+inline int f2610_6(int x) { return x * 6; }
+inline int f2610_7(int x) { return x * 7; }
+inline int f2610_8(int x) { return x * 8; }
+inline int f2610_9(int x) { return x * 9; }
+inline int f2610_10(int x) { return x * 10; }
+inline int f2610_11(int x) { return x * 11; }
+inline int f2610_12(int x) { return x * 12; }
+inline int f2610_13(int x) { return x * 13; }
+inline int f2610_14(int x) { return x * 14; }
+inline int f2610_15(int x) { return x * 15; }
+inline int f2610_16(int x) { return x * 16; }
+inline int f2610_17(int x) { return x * 17; }
+inline int f2610_18(int x) { return x * 18; }
+inline int f2610_19(int x) { return x * 19; }
+inline int f2610_20(int x) { return x * 20; }
+inline int f2610_21(int x) { return x * 21; }
+inline int f2610_22(int x) { return x * 22; }
+inline int f2610_23(int x) { return x * 23; }
+inline int f2610_24(int x) { return x * 24; }
+inline int f2610_25(int x) { return x * 25; }
+inline int f2610_26(int x) { return x * 26; }
+inline int f2610_27(int x) { return x * 27; }
+inline int f2610_28(int x) { return x * 28; }
+inline int f2610_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2612 */
+#include <vector>
+#include "h9158.h"
+#include "h8369.h"
+#include "h5999.h"
+#include "h7260.h"
+#include "h4590.h"
+#ifdef X
+#include "h6376.h"
+#endif
+struct S2612 { int a; const char *s = "x//y"; };
+inline int f2612_0(int x) { return x * 0; }
+inline int f2612_1(int x) { return x * 1; }
+inline int f2612_2(int x) { return x * 2; }
+inline int f2612_3(int x) { return x * 3; }
+inline int f2612_4(int x) { return x * 4; }
+inline int f2612_5(int x) { return x * 5; }
+inline int f2612_6(int x) { return x * 6; }
+inline int f2612_7(int x) { return x * 7; }
+inline int f2612_8(int x) { return x * 8; }
+inline int f2612_9(int x) { return x * 9; }
+inline int f2612_10(int x) { return x * 10; }
+inline int f2612_11(int x) { return x * 11; }
+inline int f2612_12(int x) { return x * 12; }
+inline int f2612_13(int x) { return x * 13; }
+inline int f2612_14(int x) { return x * 14; }
+inline int f2612_15(int x) { return x * 15; }
+inline int f2612_16(int x) { return x * 16; }
+inline int f2612_17(int x) { return x * 17; }
+inline int f2612_18(int x) { return x * 18; }
+inline int f2612_19(int x) { return x * 19; }
+inline int f2612_20(int x) { return x * 20; }
+inline int f2612_21(int x) { return x * 21; }
+inline int f2612_22(int x) { return x * 22; }
+inline int f2612_23(int x) { return x * 23; }
+inline int f2612_24(int x) { return x * 24; }
+inline int f2612_25(int x) { return x * 25; }
+inline int f2612_26(int x) { return x * 26; }
+inline int f2612_27(int x) { return x * 27; }
+inline int f2612_28(int x) { return x * 28; }
+inline int f2612_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2613 */
+#include <vector>
+#include "h7389.h"
+#include "h9556.h"
+#include "h7146.h"
+#include "h9531.h"
+#include "h5436.h"
+#ifdef X
+#include "h5121.h"
+#endif
+struct S2613 { int a; const char *s = "x//y"; };
+inline int f2613_0(int x) { return x * 0; }
+inline int f2613_1(int x) { return x * 1; }
+inline int f2613_2(int x) { return x * 2; }
+inline int f2613_3(int x) { return x * 3; }
+inline int f2613_4(int x) { return x * 4; }
+inline int f2613_5(int x) { return x * 5; }
+inline int f2613_6(int x) { return x * 6; }
+inline int f2613_7(int x) { return x * 7; }
+inline int f2613_8(int x) { return x * 8; }
+inline int f2613_9(int x) { return x * 9; }
+inline int f2613_10(int x) { return x * 10; }
+inline int f2613_11(int x) { return x * 11; }
+inline int f2613_12(int x) { return x * 12; }
+inline int f2613_13(int x) { return x * 13; }
+inline int f2613_14(int x) { return x * 14; }
+inline int f2613_15(int x) { return x * 15; }
+inline int f2613_16(int x) { return x * 16; }
+inline int f2613_17(int x) { return x * 17; }
+inline int f2613_18(int x) { return x * 18; }
+inline int f2613_19(int x) { return x * 19; }
+inline int f2613_20(int x) { return x * 20; }
+inline int f2613_21(int x) { return x * 21; }
+inline int f2613_22(int x) { return x * 22; }
+inline int f2613_23(int x) { return x * 23; }
+inline int f2613_24(int x) { return x * 24; }
+inline int f2613_25(int x) { return x * 25; }
+inline int f2613_26(int x) { return x * 26; }
+inline int f2613_27(int x) { return x * 27; }
+inline int f2613_28(int x) { return x * 28; }
+inline int f2613_29(int x) { return x * 29; }
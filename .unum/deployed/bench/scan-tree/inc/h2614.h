@@ -0,0 +1,42 @@
+#pragma once
+/* header 2614 */
+#include <vector>
+#include "h1220.h"
+#include "h7102.h"
+#include "h977.h"
+#include "h1530.h"
+#include "h9990.h"
+#ifdef X
+#include "h7967.h"
+#endif
+struct S2614 { int a; const char *s = "x//y"; };
+inline int f2614_0(int x) { return x * 0; }
+inline int f2614_1(int x) { return x * 1; }
+inline int f2614_2(int x) { return x * 2; }
+inline int f2614_3(int x) { return x * 3; }
+inline int f2614_4(int x) { return x * 4; }
+inline int f2614_5(int x) { return x * 5; }
+inline int f2614_6(int x) { return x * 6; }
+inline int f2614_7(int x) { return x * 7; }
+inline int f2614_8(int x) { return x * 8; }
+inline int f2614_9(int x) { return x * 9; }
+inline int f2614_10(int x) { return x * 10; }
+inline int f2614_11(int x) { return x * 11; }
+inline int f2614_12(int x) { return x * 12; }
+inline int f2614_13(int x) { return x * 13; }
+inline int f2614_14(int x) { return x * 14; }
+inline int f2614_15(int x) { return x * 15; }
+inline int f2614_16(int x) { return x * 16; }
+inline int f2614_17(int x) { return x * 17; }
+inline int f2614_18(int x) { return x * 18; }
+inline int f2614_19(int x) { return x * 19; }
+inline int f2614_20(int x) { return x * 20; }
+inline int f2614_21(int x) { return x * 21; }
+inline int f2614_22(int x) { return x * 22; }
+inline int f2614_23(int x) { return x * 23; }
+inline int f2614_24(int x) { return x * 24; }
+inline int f2614_25(int x) { return x * 25; }
+inline int f2614_26(int x) { return x * 26; }
+inline int f2614_27(int x) { return x * 27; }
+inline int f2614_28(int x) { return x * 28; }
+inline int f2614_29(int x) { return x * 29; }
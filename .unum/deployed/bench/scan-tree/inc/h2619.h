@@ -0,0 +1,42 @@
+#pragma once
+/* header 2619 */
+#include <vector>
+#include "h4656.h"
+#include "h6530.h"
+#include "h3554.h"
+#include "h2669.h"
+#include "h3169.h"
+#ifdef X
+#include "h1070.h"
+#endif
+struct S2619 { int a; const char *s = "x//y"; };
+inline int f2619_0(int x) { return x * 0; }
+inline int f2619_1(int x) { return x * 1; }
+inline int f2619_2(int x) { return x * 2; }
+inline int f2619_3(int x) { return x * 3; }
+inline int f2619_4(int x) { return x * 4; }
+inline int f2619_5(int x) { return x * 5; }
+inline int f2619_6(int x) { return x * 6; }
+inline int f2619_7(int x) { return x * 7; }
+inline int f2619_8(int x) { return x * 8; }
+inline int f2619_9(int x) { return x * 9; }
+inline int f2619_10(int x) { return x * 10; }
+inline int f2619_11(int x) { return x * 11; }
+inline int f2619_12(int x) { return x * 12; }
+inline int f2619_13(int x) { return x * 13; }
+inline int f2619_14(int x) { return x * 14; }
+inline int f2619_15(int x) { return x * 15; }
+inline int f2619_16(int x) { return x * 16; }
+inline int f2619_17(int x) { return x * 17; }
+inline int f2619_18(int x) { return x * 18; }
+inline int f2619_19(int x) { return x * 19; }
+inline int f2619_20(int x) { return x * 20; }
+inline int f2619_21(int x) { return x * 21; }
+inline int f2619_22(int x) { return x * 22; }
+inline int f2619_23(int x) { return x * 23; }
+inline int f2619_24(int x) { return x * 24; }
+inline int f2619_25(int x) { return x * 25; }
+inline int f2619_26(int x) { return x * 26; }
+inline int f2619_27(int x) { return x * 27; }
+inline int f2619_28(int x) { return x * 28; }
+inline int f2619_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 262 */
+#include <vector>
+#include "h2680.h"
+#include "h7813.h"
+#include "h3818.h"
+#include "h6268.h"
+#include "h8491.h"
+#ifdef X
+#include "h3792.h"
+#endif
+struct S262 { int a; const char *s = "x//y"; };
+inline int f262_0(int x) { return x * 0; }
+inline int f262_1(int x) { return x * 1; }
+inline int f262_2(int x) { return x * 2; }
+inline int f262_3(int x) { return x * 3; }
+inline int f262_4(int x) { return x * 4; }
+inline int f262_5(int x) { return x * 5; }
+inline int f262_6(int x) { return x * 6; }
+inline int f262_7(int x) { return x * 7; }
+inline int f262_8(int x) { return x * 8; }
+inline int f262_9(int x) { return x * 9; }
+inline int f262_10(int x) { return x * 10; }
+inline int f262_11(int x) { return x * 11; }
+inline int f262_12(int x) { return x * 12; }
+inline int f262_13(int x) { return x * 13; }
+inline int f262_14(int x) { return x * 14; }
+inline int f262_15(int x) { return x * 15; }
+inline int f262_16(int x) { return x * 16; }
+inline int f262_17(int x) { return x * 17; }
+inline int f262_18(int x) { return x * 18; }
+inline int f262_19(int x) { return x * 19; }
+inline int f262_20(int x) { return x * 20; }
+inline int f262_21(int x) { return x * 21; }
+inline int f262_22(int x) { return x * 22; }
+inline int f262_23(int x) { return x * 23; }
+inline int f262_24(int x) { return x * 24; }
+inline int f262_25(int x) { return x * 25; }
+inline int f262_26(int x) { return x * 26; }
+inline int f262_27(int x) { return x * 27; }
+inline int f262_28(int x) { return x * 28; }
+inline int f262_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2620 */
+#include <vector>
+#include "h7578.h"
+#include "h3043.h"
+#include "h4134.h"
+#include "h7430.h"
+#include "h2175.h"
+#ifdef X
+#include "h5630.h"
+#endif
+struct S2620 { int a; const char *s = "x//y"; };
+inline int f2620_0(int x) { return x * 0; }
+inline int f2620_1(int x) { return x * 1; }
+inline int f2620_2(int x) { return x * 2; }
+inline int f2620_3(int x) { return x * 3; }
+inline int f2620_4(int x) { return x * 4; }
+inline int f2620_5(int x) { return x * 5; }
+inline int f2620_6(int x) { return x * 6; }
+inline int f2620_7(int x) { return x * 7; }
+inline int f2620_8(int x) { return x * 8; }
+inline int f2620_9(int x) { return x * 9; }
+inline int f2620_10(int x) { return x * 10; }
+inline int f2620_11(int x) { return x * 11; }
+inline int f2620_12(int x) { return x * 12; }
+inline int f2620_13(int x) { return x * 13; }
+inline int f2620_14(int x) { return x * 14; }
+inline int f2620_15(int x) { return x * 15; }
+inline int f2620_16(int x) { return x * 16; }
+inline int f2620_17(int x) { return x * 17; }
+inline int f2620_18(int x) { return x * 18; }
+inline int f2620_19(int x) { return x * 19; }
+inline int f2620_20(int x) { return x * 20; }
+inline int f2620_21(int x) { return x * 21; }
+inline int f2620_22(int x) { return x * 22; }
+inline int f2620_23(int x) { return x * 23; }
+inline int f2620_24(int x) { return x * 24; }
+inline int f2620_25(int x) { return x * 25; }
+inline int f2620_26(int x) { return x * 26; }
+inline int f2620_27(int x) { return x * 27; }
+inline int f2620_28(int x) { return x * 28; }
+inline int f2620_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2623 */
+#include <vector>
+#include "h3096.h"
+#include "h9737.h"
+#include "h6674.h"
+#include "h9126.h"
+#include "h2861.h"
+#ifdef X
+#include "h4864.h"
+#endif
+struct S2623 { int a; const char *s = "x//y"; };
+inline int f2623_0(int x) { return x * 0; }
+inline int f2623_1(int x) { return x * 1; }
+inline int f2623_2(int x) { return x * 2; }
+inline int f2623_3(int x) { return x * 3; }
+inline int f2623_4(int x) { return x * 4; }
+inline int f2623_5(int x) { return x * 5; }
+inline int f2623_6(int x) { return x * 6; }
+inline int f2623_7(int x) { return x * 7; }
+inline int f2623_8(int x) { return x * 8; }
+inline int f2623_9(int x) { return x * 9; }
+inline int f2623_10(int x) { return x * 10; }
+inline int f2623_11(int x) { return x * 11; }
+inline int f2623_12(int x) { return x * 12; }
+inline int f2623_13(int x) { return x * 13; }
+inline int f2623_14(int x) { return x * 14; }
+inline int f2623_15(int x) { return x * 15; }
+inline int f2623_16(int x) { return x * 16; }
+inline int f2623_17(int x) { return x * 17; }
+inline int f2623_18(int x) { return x * 18; }
+inline int f2623_19(int x) { return x * 19; }
+inline int f2623_20(int x) { return x * 20; }
+inline int f2623_21(int x) { return x * 21; }
+inline int f2623_22(int x) { return x * 22; }
+inline int f2623_23(int x) { return x * 23; }
+inline int f2623_24(int x) { return x * 24; }
+inline int f2623_25(int x) { return x * 25; }
+inline int f2623_26(int x) { return x * 26; }
+inline int f2623_27(int x) { return x * 27; }
+inline int f2623_28(int x) { return x * 28; }
+inline int f2623_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2626 */
+#include <vector>
+#include "h9365.h"
+#include "h8393.h"
+#include "h7990.h"
+#include "h6893.h"
+#include "h7958.h"
+#ifdef X
+#include "h9500.h"
+#endif
+struct S2626 { int a; const char *s = "x//y"; };
+inline int f2626_0(int x) { return x * 0; }
+inline int f2626_1(int x) { return x * 1; }
+inline int f2626_2(int x) { return x * 2; }
+inline int f2626_3(int x) { return x * 3; }
+inline int f2626_4(int x) { return x * 4; }
+inline int f2626_5(int x) { return x * 5; }
+inline int f2626_6(int x) { return x * 6; }
+inline int f2626_7(int x) { return x * 7; }
+inline int f2626_8(int x) { return x * 8; }
+inline int f2626_9(int x) { return x * 9; }
+inline int f2626_10(int x) { return x * 10; }
+inline int f2626_11(int x) { return x * 11; }
+inline int f2626_12(int x) { return x * 12; }
+inline int f2626_13(int x) { return x * 13; }
+inline int f2626_14(int x) { return x * 14; }
+inline int f2626_15(int x) { return x * 15; }
+inline int f2626_16(int x) { return x * 16; }
+inline int f2626_17(int x) { return x * 17; }
+inline int f2626_18(int x) { return x * 18; }
+inline int f2626_19(int x) { return x * 19; }
+inline int f2626_20(int x) { return x * 20; }
+inline int f2626_21(int x) { return x * 21; }
+inline int f2626_22(int x) { return x * 22; }
+inline int f2626_23(int x) { return x * 23; }
+inline int f2626_24(int x) { return x * 24; }
+inline int f2626_25(int x) { return x * 25; }
+inline int f2626_26(int x) { return x * 26; }
+inline int f2626_27(int x) { return x * 27; }
+inline int f2626_28(int x) { return x * 28; }
+inline int f2626_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2627 */
+#include <vector>
+#include "h2869.h"
+#include "h47.h"
+#include "h7002.h"
+#include "h2857.h"
+#include "h8190.h"
+#ifdef X
+#include "h6847.h"
+#endif
+struct S2627 { int a; const char *s = "x//y"; };
+inline int f2627_0(int x) { return x * 0; }
+inline int f2627_1(int x) { return x * 1; }
+inline int f2627_2(int x) { return x * 2; }
+inline int f2627_3(int x) { return x * 3; }
+inline int f2627_4(int x) { return x * 4; }
+inline int f2627_5(int x) { return x * 5; }
+inline int f2627_6(int x) { return x * 6; }
+inline int f2627_7(int x) { return x * 7; }
+inline int f2627_8(int x) { return x * 8; }
+inline int f2627_9(int x) { return x * 9; }
+inline int f2627_10(int x) { return x * 10; }
+inline int f2627_11(int x) { return x * 11; }
+inline int f2627_12(int x) { return x * 12; }
+inline int f2627_13(int x) { return x * 13; }
+inline int f2627_14(int x) { return x * 14; }
+inline int f2627_15(int x) { return x * 15; }
+inline int f2627_16(int x) { return x * 16; }
+inline int f2627_17(int x) { return x * 17; }
+inline int f2627_18(int x) { return x * 18; }
+inline int f2627_19(int x) { return x * 19; }
+inline int f2627_20(int x) { return x * 20; }
+inline int f2627_21(int x) { return x * 21; }
+inline int f2627_22(int x) { return x * 22; }
+inline int f2627_23(int x) { return x * 23; }
+inline int f2627_24(int x) { return x * 24; }
+inline int f2627_25(int x) { return x * 25; }
+inline int f2627_26(int x) { return x * 26; }
+inline int f2627_27(int x) { return x * 27; }
+inline int f2627_28(int x) { return x * 28; }
+inline int f2627_29(int x) { return x * 29; }
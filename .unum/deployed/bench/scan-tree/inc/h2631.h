@@ -0,0 +1,42 @@
+#pragma once
+/* header 2631 */
+#include <vector>
+#include "h7430.h"
+#include "h5598.h"
+#include "h6987.h"
+#include "h506.h"
+#include "h9026.h"
+#ifdef X
+#include "h2648.h"
+#endif
+struct S2631 { int a; const char *s = "x//y"; };
+inline int f2631_0(int x) { return x * 0; }
+inline int f2631_1(int x) { return x * 1; }
+inline int f2631_2(int x) { return x * 2; }
+inline int f2631_3(int x) { return x * 3; }
+inline int f2631_4(int x) { return x * 4; }
+inline int f2631_5(int x) { return x * 5; }
+inline int f2631_6(int x) { return x * 6; }
+inline int f2631_7(int x) { return x * 7; }
+inline int f2631_8(int x) { return x * 8; }
+inline int f2631_9(int x) { return x * 9; }
+inline int f2631_10(int x) { return x * 10; }
+inline int f2631_11(int x) { return x * 11; }
+inline int f2631_12(int x) { return x * 12; }
+inline int f2631_13(int x) { return x * 13; }
+inline int f2631_14(int x) { return x * 14; }
+inline int f2631_15(int x) { return x * 15; }
+inline int f2631_16(int x) { return x * 16; }
+inline int f2631_17(int x) { return x * 17; }
+inline int f2631_18(int x) { return x * 18; }
+inline int f2631_19(int x) { return x * 19; }
+inline int f2631_20(int x) { return x * 20; }
+inline int f2631_21(int x) { return x * 21; }
+inline int f2631_22(int x) { return x * 22; }
+inline int f2631_23(int x) { return x * 23; }
+inline int f2631_24(int x) { return x * 24; }
+inline int f2631_25(int x) { return x * 25; }
+inline int f2631_26(int x) { return x * 26; }
+inline int f2631_27(int x) { return x * 27; }
+inline int f2631_28(int x) { return x * 28; }
+inline int f2631_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2632 */
+#include <vector>
+#include "h7862.h"
+#include "h8174.h"
+#include "h6475.h"
+#include "h4379.h"
+#include "h7868.h"
+#ifdef X
+#include "h2251.h"
+#endif
+struct S2632 { int a; const char *s = "x//y"; };
+inline int f2632_0(int x) { return x * 0; }
+inline int f2632_1(int x) { return x * 1; }
+inline int f2632_2(int x) { return x * 2; }
+inline int f2632_3(int x) { return x * 3; }
+inline int f2632_4(int x) { return x * 4; }
+inline int f2632_5(int x) { return x * 5; }
+inline int f2632_6(int x) { return x * 6; }
+inline int f2632_7(int x) { return x * 7; }
+inline int f2632_8(int x) { return x * 8; }
+inline int f2632_9(int x) { return x * 9; }
+inline int f2632_10(int x) { return x * 10; }
+inline int f2632_11(int x) { return x * 11; }
+inline int f2632_12(int x) { return x * 12; }
+inline int f2632_13(int x) { return x * 13; }
+inline int f2632_14(int x) { return x * 14; }
+inline int f2632_15(int x) { return x * 15; }
+inline int f2632_16(int x) { return x * 16; }
+inline int f2632_17(int x) { return x * 17; }
+inline int f2632_18(int x) { return x * 18; }
+inline int f2632_19(int x) { return x * 19; }
+inline int f2632_20(int x) { return x * 20; }
+inline int f2632_21(int x) { return x * 21; }
+inline int f2632_22(int x) { return x * 22; }
+inline int f2632_23(int x) { return x * 23; }
+inline int f2632_24(int x) { return x * 24; }
+inline int f2632_25(int x) { return x * 25; }
+inline int f2632_26(int x) { return x * 26; }
+inline int f2632_27(int x) { return x * 27; }
+inline int f2632_28(int x) { return x * 28; }
+inline int f2632_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2633 */
+#include <vector>
+#include "h8353.h"
+#include "h872.h"
+#include "h952.h"
+#include "h2352.h"
+#include "h4843.h"
+#ifdef X
+#include "h7717.h"
+#endif
+struct S2633 { int a; const char *s = "x//y"; };
+inline int f2633_0(int x) { return x * 0; }
+inline int f2633_1(int x) { return x * 1; }
+inline int f2633_2(int x) { return x * 2; }
+inline int f2633_3(int x) { return x * 3; }
+inline int f2633_4(int x) { return x * 4; }
+inline int f2633_5(int x) { return x * 5; }
+inline int f2633_6(int x) { return x * 6; }
+inline int f2633_7(int x) { return x * 7; }
+inline int f2633_8(int x) { return x * 8; }
+inline int f2633_9(int x) { return x * 9; }
+inline int f2633_10(int x) { return x * 10; }
+inline int f2633_11(int x) { return x * 11; }
+inline int f2633_12(int x) { return x * 12; }
+inline int f2633_13(int x) { return x * 13; }
+inline int f2633_14(int x) { return x * 14; }
+inline int f2633_15(int x) { return x * 15; }
+inline int f2633_16(int x) { return x * 16; }
+inline int f2633_17(int x) { return x * 17; }
+inline int f2633_18(int x) { return x * 18; }
+inline int f2633_19(int x) { return x * 19; }
+inline int f2633_20(int x) { return x * 20; }
+inline int f2633_21(int x) { return x * 21; }
+inline int f2633_22(int x) { return x * 22; }
+inline int f2633_23(int x) { return x * 23; }
+inline int f2633_24(int x) { return x * 24; }
+inline int f2633_25(int x) { return x * 25; }
+inline int f2633_26(int x) { return x * 26; }
+inline int f2633_27(int x) { return x * 27; }
+inline int f2633_28(int x) { return x * 28; }
+inline int f2633_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2634 */
+#include <vector>
+#include "h954.h"
+#include "h3125.h"
+#include "h1468.h"
+#include "h6217.h"
+#include "h5387.h"
+#ifdef X
+#include "h7373.h"
+#endif
+struct S2634 { int a; const char *s = "x//y"; };
+inline int f2634_0(int x) { return x * 0; }
+inline int f2634_1(int x) { return x * 1; }
+inline int f2634_2(int x) { return x * 2; }
+inline int f2634_3(int x) { return x * 3; }
+inline int f2634_4(int x) { return x * 4; }
+inline int f2634_5(int x) { return x * 5; }
+inline int f2634_6(int x) { return x * 6; }
+inline int f2634_7(int x) { return x * 7; }
+inline int f2634_8(int x) { return x * 8; }
+inline int f2634_9(int x) { return x * 9; }
+inline int f2634_10(int x) { return x * 10; }
+inline int f2634_11(int x) { return x * 11; }
+inline int f2634_12(int x) { return x * 12; }
+inline int f2634_13(int x) { return x * 13; }
+inline int f2634_14(int x) { return x * 14; }
+inline int f2634_15(int x) { return x * 15; }
+inline int f2634_16(int x) { return x * 16; }
+inline int f2634_17(int x) { return x * 17; }
+inline int f2634_18(int x) { return x * 18; }
+inline int f2634_19(int x) { return x * 19; }
+inline int f2634_20(int x) { return x * 20; }
+inline int f2634_21(int x) { return x * 21; }
+inline int f2634_22(int x) { return x * 22; }
+inline int f2634_23(int x) { return x * 23; }
+inline int f2634_24(int x) { return x * 24; }
+inline int f2634_25(int x) { return x * 25; }
+inline int f2634_26(int x) { return x * 26; }
+inline int f2634_27(int x) { return x * 27; }
+inline int f2634_28(int x) { return x * 28; }
+inline int f2634_29(int x) { return x * 29; }
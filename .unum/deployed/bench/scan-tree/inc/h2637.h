@@ -0,0 +1,42 @@
+#pragma once
+/* header 2637 */
+#include <vector>
+#include "h5155.h"
+#include "h5501.h"
+#include "h6307.h"
+#include "h8119.h"
+#include "h2824.h"
+#ifdef X
+#include "h994.h"
+#endif
+struct S2637 { int a; const char *s = "x//y"; };
+inline int f2637_0(int x) { return x * 0; }
+inline int f2637_1(int x) { return x * 1; }
+inline int f2637_2(int x) { return x * 2; }
+inline int f2637_3(int x) { return x * 3; }
+inline int f2637_4(int x) { return x * 4; }
+inline int f2637_5(int x) { return x * 5; }
+inline int f2637_6(int x) { return x * 6; }
+inline int f2637_7(int x) { return x * 7; }
+inline int f2637_8(int x) { return x * 8; }
+inline int f2637_9(int x) { return x * 9; }
+inline int f2637_10(int x) { return x * 10; }
+inline int f2637_11(int x) { return x * 11; }
+inline int f2637_12(int x) { return x * 12; }
+inline int f2637_13(int x) { return x * 13; }
+inline int f2637_14(int x) { return x * 14; }
+inline int f2637_15(int x) { return x * 15; }
+inline int f2637_16(int x) { return x * 16; }
+inline int f2637_17(int x) { return x * 17; }
+inline int f2637_18(int x) { return x * 18; }
+inline int f2637_19(int x) { return x * 19; }
+inline int f2637_20(int x) { return x * 20; }
+inline int f2637_21(int x) { return x * 21; }
+inline int f2637_22(int x) { return x * 22; }
+inline int f2637_23(int x) { return x * 23; }
+inline int f2637_24(int x) { return x * 24; }
+inline int f2637_25(int x) { return x * 25; }
+inline int f2637_26(int x) { return x * 26; }
+inline int f2637_27(int x) { return x * 27; }
+inline int f2637_28(int x) { return x * 28; }
+inline int f2637_29(int x) { return x * 29; }
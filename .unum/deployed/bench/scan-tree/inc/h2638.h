@@ -0,0 +1,42 @@
+#pragma once
+/* header 2638 */
+#include <vector>
+#include "h6120.h"
+#include "h9814.h"
+#include "h8065.h"
+#include "h3932.h"
+#include "h1979.h"
+#ifdef X
+#include "h1353.h"
+#endif
+struct S2638 { int a; const char *s = "x//y"; };
+inline int f2638_0(int x) { return x * 0; }
+inline int f2638_1(int x) { return x * 1; }
+inline int f2638_2(int x) { return x * 2; }
+inline int f2638_3(int x) { return x * 3; }
+inline int f2638_4(int x) { return x * 4; }
+inline int f2638_5(int x) { return x * 5; }
+inline int f2638_6(int x) { return x * 6; }
+inline int f2638_7(int x) { return x * 7; }
+inline int f2638_8(int x) { return x * 8; }
+inline int f2638_9(int x) { return x * 9; }
+inline int f2638_10(int x) { return x * 10; }
+inline int f2638_11(int x) { return x * 11; }
+inline int f2638_12(int x) { return x * 12; }
+inline int f2638_13(int x) { return x * 13; }
+inline int f2638_14(int x) { return x * 14; }
+inline int f2638_15(int x) { return x * 15; }
+inline int f2638_16(int x) { return x * 16; }
+inline int f2638_17(int x) { return x * 17; }
+inline int f2638_18(int x) { return x * 18; }
+inline int f2638_19(int x) { return x * 19; }
+inline int f2638_20(int x) { return x * 20; }
+inline int f2638_21(int x) { return x * 21; }
+inline int f2638_22(int x) { return x * 22; }
+inline int f2638_23(int x) { return x * 23; }
+inline int f2638_24(int x) { return x * 24; }
+inline int f2638_25(int x) { return x * 25; }
+inline int f2638_26(int x) { return x * 26; }
+inline int f2638_27(int x) { return x * 27; }
+inline int f2638_28(int x) { return x * 28; }
+inline int f2638_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 264 */
+#include <vector>
+#include "h5885.h"
+#include "h6889.h"
+#include "h12.h"
+#include "h3677.h"
+#include "h1173.h"
+#ifdef X
+#include "h6729.h"
+#endif
+struct S264 { int a; const char *s = "x//y"; };
+inline int f264_0(int x) { return x * 0; }
+inline int f264_1(int x) { return x * 1; }
+inline int f264_2(int x) { return x * 2; }
+inline int f264_3(int x) { return x * 3; }
+inline int f264_4(int x) { return x * 4; }
+inline int f264_5(int x) { return x * 5; }
+inline int f264_6(int x) { return x * 6; }
+inline int f264_7(int x) { return x * 7; }
+inline int f264_8(int x) { return x * 8; }
+inline int f264_9(int x) { return x * 9; }
+inline int f264_10(int x) { return x * 10; }
+inline int f264_11(int x) { return x * 11; }
+inline int f264_12(int x) { return x * 12; }
+inline int f264_13(int x) { return x * 13; }
+inline int f264_14(int x) { return x * 14; }
+inline int f264_15(int x) { return x * 15; }
+inline int f264_16(int x) { return x * 16; }
+inline int f264_17(int x) { return x * 17; }
+inline int f264_18(int x) { return x * 18; }
+inline int f264_19(int x) { return x * 19; }
+inline int f264_20(int x) { return x * 20; }
+inline int f264_21(int x) { return x * 21; }
+inline int f264_22(int x) { return x * 22; }
+inline int f264_23(int x) { return x * 23; }
+inline int f264_24(int x) { return x * 24; }
+inline int f264_25(int x) { return x * 25; }
+inline int f264_26(int x) { return x * 26; }
+inline int f264_27(int x) { return x * 27; }
+inline int f264_28(int x) { return x * 28; }
+inline int f264_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2640 */
+#include <vector>
+#include "h2700.h"
+#include "h9873.h"
+#include "h2988.h"
+#include "h9635.h"
+#include "h5174.h"
+#ifdef X
+#include "h4273.h"
+#endif
+struct S2640 { int a; const char *s = "x//y"; };
+inline int f2640_0(int x) { return x * 0; }
+inline int f2640_1(int x) { return x * 1; }
+inline int f2640_2(int x) { return x * 2; }
+inline int f2640_3(int x) { return x * 3; }
+inline int f2640_4(int x) { return x * 4; }
+inline int f2640_5(int x) { return x * 5; }
+inline int f2640_6(int x) { return x * 6; }
+inline int f2640_7(int x) { return x * 7; }
+inline int f2640_8(int x) { return x * 8; }
+inline int f2640_9(int x) { return x * 9; }
+inline int f2640_10(int x) { return x * 10; }
+inline int f2640_11(int x) { return x * 11; }
+inline int f2640_12(int x) { return x * 12; }
+inline int f2640_13(int x) { return x * 13; }
+inline int f2640_14(int x) { return x * 14; }
+inline int f2640_15(int x) { return x * 15; }
+inline int f2640_16(int x) { return x * 16; }
+inline int f2640_17(int x) { return x * 17; }
+inline int f2640_18(int x) { return x * 18; }
+inline int f2640_19(int x) { return x * 19; }
+inline int f2640_20(int x) { return x * 20; }
+inline int f2640_21(int x) { return x * 21; }
+inline int f2640_22(int x) { return x * 22; }
+inline int f2640_23(int x) { return x * 23; }
+inline int f2640_24(int x) { return x * 24; }
+inline int f2640_25(int x) { return x * 25; }
+inline int f2640_26(int x) { return x * 26; }
+inline int f2640_27(int x) { return x * 27; }
+inline int f2640_28(int x) { return x * 28; }
+inline int f2640_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2641 */
+#include <vector>
+#include "h6023.h"
+#include "h8516.h"
+#include "h9100.h"
+#include "h6485.h"
+#include "h4734.h"
+#ifdef X
+#include "h248.h"
+#endif
+struct S2641 { int a; const char *s = "x//y"; };
+inline int f2641_0(int x) { return x * 0; }
+inline int f2641_1(int x) { return x * 1; }
+inline int f2641_2(int x) { return x * 2; }
+inline int f2641_3(int x) { return x * 3; }
+inline int f2641_4(int x) { return x * 4; }
+inline int f2641_5(int x) { return x * 5; }
+inline int f2641_6(int x) { return x * 6; }
+inline int f2641_7(int x) { return x * 7; }
+inline int f2641_8(int x) { return x * 8; }
+inline int f2641_9(int x) { return x * 9; }
+inline int f2641_10(int x) { return x * 10; }
+inline int f2641_11(int x) { return x * 11; }
+inline int f2641_12(int x) { return x * 12; }
+inline int f2641_13(int x) { return x * 13; }
+inline int f2641_14(int x) { return x * 14; }
+inline int f2641_15(int x) { return x * 15; }
+inline int f2641_16(int x) { return x * 16; }
+inline int f2641_17(int x) { return x * 17; }
+inline int f2641_18(int x) { return x * 18; }
+inline int f2641_19(int x) { return x * 19; }
+inline int f2641_20(int x) { return x * 20; }
+inline int f2641_21(int x) { return x * 21; }
+inline int f2641_22(int x) { return x * 22; }
+inline int f2641_23(int x) { return x * 23; }
+inline int f2641_24(int x) { return x * 24; }
+inline int f2641_25(int x) { return x * 25; }
+inline int f2641_26(int x) { return x * 26; }
+inline int f2641_27(int x) { return x * 27; }
+inline int f2641_28(int x) { return x * 28; }
+inline int f2641_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2642 */
+#include <vector>
+#include "h8822.h"
+#include "h4226.h"
+#include "h1304.h"
+#include "h233.h"
+#include "h5034.h"
+#ifdef X
+#include "h7184.h"
+#endif
+struct S2642 { int a; const char *s = "x//y"; };
+inline int f2642_0(int x) { return x * 0; }
+inline int f2642_1(int x) { return x * 1; }
+inline int f2642_2(int x) { return x * 2; }
+inline int f2642_3(int x) { return x * 3; }
+inline int f2642_4(int x) { return x * 4; }
+inline int f2642_5(int x) { return x * 5; }
+inline int f2642_6(int x) { return x * 6; }
+inline int f2642_7(int x) { return x * 7; }
+inline int f2642_8(int x) { return x * 8; }
+inline int f2642_9(int x) { return x * 9; }
+inline int f2642_10(int x) { return x * 10; }
+inline int f2642_11(int x) { return x * 11; }
+inline int f2642_12(int x) { return x * 12; }
+inline int f2642_13(int x) { return x * 13; }
+inline int f2642_14(int x) { return x * 14; }
+inline int f2642_15(int x) { return x * 15; }
+inline int f2642_16(int x) { return x * 16; }
+inline int f2642_17(int x) { return x * 17; }
+inline int f2642_18(int x) { return x * 18; }
+inline int f2642_19(int x) { return x * 19; }
+inline int f2642_20(int x) { return x * 20; }
+inline int f2642_21(int x) { return x * 21; }
+inline int f2642_22(int x) { return x * 22; }
+inline int f2642_23(int x) { return x * 23; }
+inline int f2642_24(int x) { return x * 24; }
+inline int f2642_25(int x) { return x * 25; }
+inline int f2642_26(int x) { return x * 26; }
+inline int f2642_27(int x) { return x * 27; }
+inline int f2642_28(int x) { return x * 28; }
+inline int f2642_29(int x) { return x * 29; }
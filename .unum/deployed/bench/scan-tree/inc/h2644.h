@@ -0,0 +1,42 @@
+#pragma once
+/* header 2644 */
+#include <vector>
+#include "h9807.h"
+#include "h1803.h"
+#include "h225.h"
+#include "h8496.h"
+#include "h6789.h"
+#ifdef X
+#include "h9953.h"
+#endif
+struct S2644 { int a; const char *s = "x//y"; };
+inline int f2644_0(int x) { return x * 0; }
+inline int f2644_1(int x) { return x * 1; }
+inline int f2644_2(int x) { return x * 2; }
+inline int f2644_3(int x) { return x * 3; }
+inline int f2644_4(int x) { return x * 4; }
+inline int f2644_5(int x) { return x * 5; }
+inline int f2644_6(int x) { return x * 6; }
+inline int f2644_7(int x) { return x * 7; }
+inline int f2644_8(int x) { return x * 8; }
+inline int f2644_9(int x) { return x * 9; }
+inline int f2644_10(int x) { return x * 10; }
+inline int f2644_11(int x) { return x * 11; }
+inline int f2644_12(int x) { return x * 12; }
+inline int f2644_13(int x) { return x * 13; }
+inline int f2644_14(int x) { return x * 14; }
+inline int f2644_15(int x) { return x * 15; }
+inline int f2644_16(int x) { return x * 16; }
+inline int f2644_17(int x) { return x * 17; }
+inline int f2644_18(int x) { return x * 18; }
+inline int f2644_19(int x) { return x * 19; }
+inline int f2644_20(int x) { return x * 20; }
+inline int f2644_21(int x) { return x * 21; }
+inline int f2644_22(int x) { return x * 22; }
+inline int f2644_23(int x) { return x * 23; }
+inline int f2644_24(int x) { return x * 24; }
+inline int f2644_25(int x) { return x * 25; }
+inline int f2644_26(int x) { return x * 26; }
+inline int f2644_27(int x) { return x * 27; }
+inline int f2644_28(int x) { return x * 28; }
+inline int f2644_29(int x) { return x * 29; }
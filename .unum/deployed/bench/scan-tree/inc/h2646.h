@@ -0,0 +1,42 @@
+#pragma once
+/* header 2646 */
+#include <vector>
+#include "h2027.h"
+#include "h4098.h"
+#include "h189.h"
+#include "h333.h"
+#include "h9179.h"
+#ifdef X
+#include "h2377.h"
+#endif
+struct S2646 { int a; const char *s = "x//y"; };
+inline int f2646_0(int x) { return x * 0; }
+inline int f2646_1(int x) { return x * 1; }
+inline int f2646_2(int x) { return x * 2; }
+inline int f2646_3(int x) { return x * 3; }
+inline int f2646_4(int x) { return x * 4; }
+inline int f2646_5(int x) { return x * 5; }
+inline int f2646_6(int x) { return x * 6; }
+inline int f2646_7(int x) { return x * 7; }
+inline int f2646_8(int x) { return x * 8; }
+inline int f2646_9(int x) { return x * 9; }
+inline int f2646_10(int x) { return x * 10; }
+inline int f2646_11(int x) { return x * 11; }
+inline int f2646_12(int x) { return x * 12; }
+inline int f2646_13(int x) { return x * 13; }
+inline int f2646_14(int x) { return x * 14; }
+inline int f2646_15(int x) { return x * 15; }
+inline int f2646_16(int x) { return x * 16; }
+inline int f2646_17(int x) { return x * 17; }
+inline int f2646_18(int x) { return x * 18; }
+inline int f2646_19(int x) { return x * 19; }
+inline int f2646_20(int x) { return x * 20; }
+inline int f2646_21(int x) { return x * 21; }
+inline int f2646_22(int x) { return x * 22; }
+inline int f2646_23(int x) { return x * 23; }
+inline int f2646_24(int x) { return x * 24; }
+inline int f2646_25(int x) { return x * 25; }
+inline int f2646_26(int x) { return x * 26; }
+inline int f2646_27(int x) { return x * 27; }
+inline int f2646_28(int x) { return x * 28; }
+inline int f2646_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2649 */
+#include <vector>
+#include "h2750.h"
+#include "h9529.h"
+#include "h4878.h"
+#include "h3026.h"
+#include "h7938.h"
+#ifdef X
+#include "h9032.h"
+#endif
+struct S2649 { int a; const char *s = "x//y"; };
+inline int f2649_0(int x) { return x * 0; }
+inline int f2649_1(int x) { return x * 1; }
+inline int f2649_2(int x) { return x * 2; }
+inline int f2649_3(int x) { return x * 3; }
+inline int f2649_4(int x) { return x * 4; }
+inline int f2649_5(int x) { return x * 5; }
+inline int f2649_6(int x) { return x * 6; }
+inline int f2649_7(int x) { return x * 7; }
+inline int f2649_8(int x) { return x * 8; }
+inline int f2649_9(int x) { return x * 9; }
+inline int f2649_10(int x) { return x * 10; }
+inline int f2649_11(int x) { return x * 11; }
+inline int f2649_12(int x) { return x * 12; }
+inline int f2649_13(int x) { return x * 13; }
+inline int f2649_14(int x) { return x * 14; }
+inline int f2649_15(int x) { return x * 15; }
+inline int f2649_16(int x) { return x * 16; }
+inline int f2649_17(int x) { return x * 17; }
+inline int f2649_18(int x) { return x * 18; }
+inline int f2649_19(int x) { return x * 19; }
+inline int f2649_20(int x) { return x * 20; }
+inline int f2649_21(int x) { return x * 21; }
+inline int f2649_22(int x) { return x * 22; }
+inline int f2649_23(int x) { return x * 23; }
+inline int f2649_24(int x) { return x * 24; }
+inline int f2649_25(int x) { return x * 25; }
+inline int f2649_26(int x) { return x * 26; }
+inline int f2649_27(int x) { return x * 27; }
+inline int f2649_28(int x) { return x * 28; }
+inline int f2649_29(int x) { return x * 29; }
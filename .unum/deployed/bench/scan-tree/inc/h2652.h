@@ -0,0 +1,42 @@
+#pragma once
+/* header 2652 */
+#include <vector>
+#include "h2942.h"
+#include "h6590.h"
+#include "h3900.h"
+#include "h4040.h"
+#include "h423.h"
+#ifdef X
+#include "h9145.h"
+#endif
+struct S2652 { int a; const char *s = "x//y"; };
+inline int f2652_0(int x) { return x * 0; }
+inline int f2652_1(int x) { return x * 1; }
+inline int f2652_2(int x) { return x * 2; }
+inline int f2652_3(int x) { return x * 3; }
+inline int f2652_4(int x) { return x * 4; }
+inline int f2652_5(int x) { return x * 5; }
+inline int f2652_6(int x) { return x * 6; }
+inline int f2652_7(int x) { return x * 7; }
+inline int f2652_8(int x) { return x * 8; }
+inline int f2652_9(int x) { return x * 9; }
+inline int f2652_10(int x) { return x * 10; }
+inline int f2652_11(int x) { return x * 11; }
+inline int f2652_12(int x) { return x * 12; }
+inline int f2652_13(int x) { return x * 13; }
+inline int f2652_14(int x) { return x * 14; }
+inline int f2652_15(int x) { return x * 15; }
+inline int f2652_16(int x) { return x * 16; }
+inline int f2652_17(int x) { return x * 17; }
+inline int f2652_18(int x) { return x * 18; }
+inline int f2652_19(int x) { return x * 19; }
+inline int f2652_20(int x) { return x * 20; }
+inline int f2652_21(int x) { return x * 21; }
+inline int f2652_22(int x) { return x * 22; }
+inline int f2652_23(int x) { return x * 23; }
+inline int f2652_24(int x) { return x * 24; }
+inline int f2652_25(int x) { return x * 25; }
+inline int f2652_26(int x) { return x * 26; }
+inline int f2652_27(int x) { return x * 27; }
+inline int f2652_28(int x) { return x * 28; }
+inline int f2652_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2654 */
+#include <vector>
+#include "h2991.h"
+#include "h7051.h"
+#include "h134.h"
+#include "h1875.h"
+#include "h191.h"
+#ifdef X
+#include "h3079.h"
+#endif
+struct S2654 { int a; const char *s = "x//y"; };
+inline int f2654_0(int x) { return x * 0; }
+inline int f2654_1(int x) { return x * 1; }
+inline int f2654_2(int x) { return x * 2; }
+inline int f2654_3(int x) { return x * 3; }
+inline int f2654_4(int x) { return x * 4; }
+inline int f2654_5(int x) { return x * 5; }
+inline int f2654_6(int x) { return x * 6; }
+inline int f2654_7(int x) { return x * 7; }
+inline int f2654_8(int x) { return x * 8; }
+inline int f2654_9(int x) { return x * 9; }
+inline int f2654_10(int x) { return x * 10; }
+inline int f2654_11(int x) { return x * 11; }
+inline int f2654_12(int x) { return x * 12; }
+inline int f2654_13(int x) { return x * 13; }
+inline int f2654_14(int x) { return x * 14; }
+inline int f2654_15(int x) { return x * 15; }
+inline int f2654_16(int x) { return x * 16; }
+inline int f2654_17(int x) { return x * 17; }
+inline int f2654_18(int x) { return x * 18; }
+inline int f2654_19(int x) { return x * 19; }
+inline int f2654_20(int x) { return x * 20; }
+inline int f2654_21(int x) { return x * 21; }
+inline int f2654_22(int x) { return x * 22; }
+inline int f2654_23(int x) { return x * 23; }
+inline int f2654_24(int x) { return x * 24; }
+inline int f2654_25(int x) { return x * 25; }
+inline int f2654_26(int x) { return x * 26; }
+inline int f2654_27(int x) { return x * 27; }
+inline int f2654_28(int x) { return x * 28; }
+inline int f2654_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2655 */
+#include <vector>
+#include "h2886.h"
+#include "h3379.h"
+#include "h4843.h"
+#include "h6559.h"
+#include "h8412.h"
+#ifdef X
+#include "h8582.h"
+#endif
+struct S2655 { int a; const char *s = "x//y"; };
+inline int f2655_0(int x) { return x * 0; }
+inline int f2655_1(int x) { return x * 1; }
+inline int f2655_2(int x) { return x * 2; }
+inline int f2655_3(int x) { return x * 3; }
+inline int f2655_4(int x) { return x * 4; }
+inline int f2655_5(int x) { return x * 5; }
+inline int f2655_6(int x) { return x * 6; }
+inline int f2655_7(int x) { return x * 7; }
+inline int f2655_8(int x) { return x * 8; }
+inline int f2655_9(int x) { return x * 9; }
+inline int f2655_10(int x) { return x * 10; }
+inline int f2655_11(int x) { return x * 11; }
+inline int f2655_12(int x) { return x * 12; }
+inline int f2655_13(int x) { return x * 13; }
+inline int f2655_14(int x) { return x * 14; }
+inline int f2655_15(int x) { return x * 15; }
+inline int f2655_16(int x) { return x * 16; }
+inline int f2655_17(int x) { return x * 17; }
+inline int f2655_18(int x) { return x * 18; }
+inline int f2655_19(int x) { return x * 19; }
+inline int f2655_20(int x) { return x * 20; }
+inline int f2655_21(int x) { return x * 21; }
+inline int f2655_22(int x) { return x * 22; }
+inline int f2655_23(int x) { return x * 23; }
+inline int f2655_24(int x) { return x * 24; }
+inline int f2655_25(int x) { return x * 25; }
+inline int f2655_26(int x) { return x * 26; }
+inline int f2655_27(int x) { return x * 27; }
+inline int f2655_28(int x) { return x * 28; }
+inline int f2655_29(int x) { return x * 29; }
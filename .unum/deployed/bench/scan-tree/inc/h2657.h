@@ -0,0 +1,42 @@
+#pragma once
+/* header 2657 */
+#include <vector>
+#include "h2324.h"
+#include "h1699.h"
+#include "h9678.h"
+#include "h161.h"
+#include "h8761.h"
+#ifdef X
+#include "h8740.h"
+#endif
+struct S2657 { int a; const char *s = "x//y"; };
+inline int f2657_0(int x) { return x * 0; }
+inline int f2657_1(int x) { return x * 1; }
+inline int f2657_2(int x) { return x * 2; }
+inline int f2657_3(int x) { return x * 3; }
+inline int f2657_4(int x) { return x * 4; }
+inline int f2657_5(int x) { return x * 5; }
+inline int f2657_6(int x) { return x * 6; }
+inline int f2657_7(int x) { return x * 7; }
+inline int f2657_8(int x) { return x * 8; }
+inline int f2657_9(int x) { return x * 9; }
+inline int f2657_10(int x) { return x * 10; }
+inline int f2657_11(int x) { return x * 11; }
+inline int f2657_12(int x) { return x * 12; }
+inline int f2657_13(int x) { return x * 13; }
+inline int f2657_14(int x) { return x * 14; }
+inline int f2657_15(int x) { return x * 15; }
+inline int f2657_16(int x) { return x * 16; }
+inline int f2657_17(int x) { return x * 17; }
+inline int f2657_18(int x) { return x * 18; }
+inline int f2657_19(int x) { return x * 19; }
+inline int f2657_20(int x) { return x * 20; }
+inline int f2657_21(int x) { return x * 21; }
+inline int f2657_22(int x) { return x * 22; }
+inline int f2657_23(int x) { return x * 23; }
+inline int f2657_24(int x) { return x * 24; }
+inline int f2657_25(int x) { return x * 25; }
+inline int f2657_26(int x) { return x * 26; }
+inline int f2657_27(int x) { return x * 27; }
+inline int f2657_28(int x) { return x * 28; }
+inline int f2657_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2658 */
+#include <vector>
+#include "h9385.h"
+#include "h6557.h"
+#include "h826.h"
+#include "h1677.h"
+#include "h868.h"
+#ifdef X
+#include "h8638.h"
+#endif
+struct S2658 { int a; const char *s = "x//y"; };
+inline int f2658_0(int x) { return x * 0; }
+inline int f2658_1(int x) { return x * 1; }
+inline int f2658_2(int x) { return x * 2; }
+inline int f2658_3(int x) { return x * 3; }
+inline int f2658_4(int x) { return x * 4; }
+inline int f2658_5(int x) { return x * 5; }
+inline int f2658_6(int x) { return x * 6; }
+inline int f2658_7(int x) { return x * 7; }
+inline int f2658_8(int x) { return x * 8; }
+inline int f2658_9(int x) { return x * 9; }
+inline int f2658_10(int x) { return x * 10; }
+inline int f2658_11(int x) { return x * 11; }
+inline int f2658_12(int x) { return x * 12; }
+inline int f2658_13(int x) { return x * 13; }
+inline int f2658_14(int x) { return x * 14; }
+inline int f2658_15(int x) { return x * 15; }
+inline int f2658_16(int x) { return x * 16; }
+inline int f2658_17(int x) { return x * 17; }
+inline int f2658_18(int x) { return x * 18; }
+inline int f2658_19(int x) { return x * 19; }
+inline int f2658_20(int x) { return x * 20; }
+inline int f2658_21(int x) { return x * 21; }
+inline int f2658_22(int x) { return x * 22; }
+inline int f2658_23(int x) { return x * 23; }
+inline int f2658_24(int x) { return x * 24; }
+inline int f2658_25(int x) { return x * 25; }
+inline int f2658_26(int x) { return x * 26; }
+inline int f2658_27(int x) { return x * 27; }
+inline int f2658_28(int x) { return x * 28; }
+inline int f2658_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 266 */
+#include <vector>
+#include "h5675.h"
+#include "h8413.h"
+#include "h5339.h"
+#include "h7948.h"
+#include "h6134.h"
+#ifdef X
+#include "h6065.h"
+#endif
+struct S266 { int a; const char *s = "x//y"; };
+inline int f266_0(int x) { return x * 0; }
+inline int f266_1(int x) { return x * 1; }
+inline int f266_2(int x) { return x * 2; }
+inline int f266_3(int x) { return x * 3; }
+inline int f266_4(int x) { return x * 4; }
+inline int f266_5(int x) { return x * 5; }
+inline int f266_6(int x) { return x * 6; }
+inline int f266_7(int x) { return x * 7; }
+inline int f266_8(int x) { return x * 8; }
+inline int f266_9(int x) { return x * 9; }
+inline int f266_10(int x) { return x * 10; }
+inline int f266_11(int x) { return x * 11; }
+inline int f266_12(int x) { return x * 12; }
+inline int f266_13(int x) { return x * 13; }
+inline int f266_14(int x) { return x * 14; }
+inline int f266_15(int x) { return x * 15; }
+inline int f266_16(int x) { return x * 16; }
+inline int f266_17(int x) { return x * 17; }
+inline int f266_18(int x) { return x * 18; }
+inline int f266_19(int x) { return x * 19; }
+inline int f266_20(int x) { return x * 20; }
+inline int f266_21(int x) { return x * 21; }
+inline int f266_22(int x) { return x * 22; }
+inline int f266_23(int x) { return x * 23; }
+inline int f266_24(int x) { return x * 24; }
+inline int f266_25(int x) { return x * 25; }
+inline int f266_26(int x) { return x * 26; }
+inline int f266_27(int x) { return x * 27; }
+inline int f266_28(int x) { return x * 28; }
+inline int f266_29(int x) { return x * 29; }
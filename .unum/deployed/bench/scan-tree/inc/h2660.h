@@ -0,0 +1,42 @@
+#pragma once
+/* header 2660 */
+#include <vector>
+#include "h2281.h"
+#include "h9002.h"
+#include "h1251.h"
+#include "h6625.h"
+#include "h1104.h"
+#ifdef X
+#include "h8493.h"
+#endif
+struct S2660 { int a; const char *s = "x//y"; };
+inline int f2660_0(int x) { return x * 0; }
+inline int f2660_1(int x) { return x * 1; }
+inline int f2660_2(int x) { return x * 2; }
+inline int f2660_3(int x) { return x * 3; }
+inline int f2660_4(int x) { return x * 4; }
+inline int f2660_5(int x) { return x * 5; }
+inline int f2660_6(int x) { return x * 6; }
+inline int f2660_7(int x) { return x * 7; }
+inline int f2660_8(int x) { return x * 8; }
+inline int f2660_9(int x) { return x * 9; }
+inline int f2660_10(int x) { return x * 10; }
+inline int f2660_11(int x) { return x * 11; }
+inline int f2660_12(int x) { return x * 12; }
+inline int f2660_13(int x) { return x * 13; }
+inline int f2660_14(int x) { return x * 14; }
+inline int f2660_15(int x) { return x * 15; }
+inline int f2660_16(int x) { return x * 16; }
+inline int f2660_17(int x) { return x * 17; }
+inline int f2660_18(int x) { return x * 18; }
+inline int f2660_19(int x) { return x * 19; }
+inline int f2660_20(int x) { return x * 20; }
+inline int f2660_21(int x) { return x * 21; }
+inline int f2660_22(int x) { return x * 22; }
+inline int f2660_23(int x) { return x * 23; }
+inline int f2660_24(int x) { return x * 24; }
+inline int f2660_25(int x) { return x * 25; }
+inline int f2660_26(int x) { return x * 26; }
+inline int f2660_27(int x) { return x * 27; }
+inline int f2660_28(int x) { return x * 28; }
+inline int f2660_29(int x) { return x * 29; }
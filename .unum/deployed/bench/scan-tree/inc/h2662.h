@@ -0,0 +1,42 @@
+#pragma once
+/* header 2662 */
+#include <vector>
+#include "h3946.h"
+#include "h5576.h"
+#include "h3766.h"
+#include "h2677.h"
+#include "h8667.h"
+#ifdef X
+#include "h2246.h"
+#endif
+struct S2662 { int a; const char *s = "x//y"; };
+inline int f2662_0(int x) { return x * 0; }
+inline int f2662_1(int x) { return x * 1; }
+inline int f2662_2(int x) { return x * 2; }
+inline int f2662_3(int x) { return x * 3; }
+inline int f2662_4(int x) { return x * 4; }
+inline int f2662_5(int x) { return x * 5; }
+inline int f2662_6(int x) { return x * 6; }
+inline int f2662_7(int x) { return x * 7; }
+inline int f2662_8(int x) { return x * 8; }
+inline int f2662_9(int x) { return x * 9; }
+inline int f2662_10(int x) { return x * 10; }
+inline int f2662_11(int x) { return x * 11; }
+inline int f2662_12(int x) { return x * 12; }
+inline int f2662_13(int x) { return x * 13; }
+inline int f2662_14(int x) { return x * 14; }
+inline int f2662_15(int x) { return x * 15; }
+inline int f2662_16(int x) { return x * 16; }
+inline int f2662_17(int x) { return x * 17; }
+inline int f2662_18(int x) { return x * 18; }
+inline int f2662_19(int x) { return x * 19; }
+inline int f2662_20(int x) { return x * 20; }
+inline int f2662_21(int x) { return x * 21; }
+inline int f2662_22(int x) { return x * 22; }
+inline int f2662_23(int x) { return x * 23; }
+inline int f2662_24(int x) { return x * 24; }
+inline int f2662_25(int x) { return x * 25; }
+inline int f2662_26(int x) { return x * 26; }
+inline int f2662_27(int x) { return x * 27; }
+inline int f2662_28(int x) { return x * 28; }
+inline int f2662_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2666 */
+#include <vector>
+#include "h4299.h"
+#include "h2072.h"
+#include "h8124.h"
+#include "h6388.h"
+#include "h1593.h"
+#ifdef X
+#include "h3545.h"
+#endif
+struct S2666 { int a; const char *s = "x//y"; };
+inline int f2666_0(int x) { return x * 0; }
+inline int f2666_1(int x) { return x * 1; }
+inline int f2666_2(int x) { return x * 2; }
+inline int f2666_3(int x) { return x * 3; }
+inline int f2666_4(int x) { return x * 4; }
+inline int f2666_5(int x) { return x * 5; }
+inline int f2666_6(int x) { return x * 6; }
+inline int f2666_7(int x) { return x * 7; }
+inline int f2666_8(int x) { return x * 8; }
+inline int f2666_9(int x) { return x * 9; }
+inline int f2666_10(int x) { return x * 10; }
+inline int f2666_11(int x) { return x * 11; }
+inline int f2666_12(int x) { return x * 12; }
+inline int f2666_13(int x) { return x * 13; }
+inline int f2666_14(int x) { return x * 14; }
+inline int f2666_15(int x) { return x * 15; }
+inline int f2666_16(int x) { return x * 16; }
+inline int f2666_17(int x) { return x * 17; }
+inline int f2666_18(int x) { return x * 18; }
+inline int f2666_19(int x) { return x * 19; }
+inline int f2666_20(int x) { return x * 20; }
+inline int f2666_21(int x) { return x * 21; }
+inline int f2666_22(int x) { return x * 22; }
+inline int f2666_23(int x) { return x * 23; }
+inline int f2666_24(int x) { return x * 24; }
+inline int f2666_25(int x) { return x * 25; }
+inline int f2666_26(int x) { return x * 26; }
+inline int f2666_27(int x) { return x * 27; }
+inline int f2666_28(int x) { return x * 28; }
+inline int f2666_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2669 */
+#include <vector>
+#include "h5749.h"
+#include "h9726.h"
+#include "h4517.h"
+#include "h8425.h"
+#include "h5821.h"
+#ifdef X
+#include "h767.h"
+#endif
+struct S2669 { int a; const char *s = "x//y"; };
+inline int f2669_0(int x) { return x * 0; }
+inline int f2669_1(int x) { return x * 1; }
+inline int f2669_2(int x) { return x * 2; }
+inline int f2669_3(int x) { return x * 3; }
+inline int f2669_4(int x) { return x * 4; }
+inline int f2669_5(int x) { return x * 5; }
+inline int f2669_6(int x) { return x * 6; }
+inline int f2669_7(int x) { return x * 7; }
+inline int f2669_8(int x) { return x * 8; }
+inline int f2669_9(int x) { return x * 9; }
+inline int f2669_10(int x) { return x * 10; }
+inline int f2669_11(int x) { return x * 11; }
+inline int f2669_12(int x) { return x * 12; }
+inline int f2669_13(int x) { return x * 13; }
+inline int f2669_14(int x) { return x * 14; }
+inline int f2669_15(int x) { return x * 15; }
+inline int f2669_16(int x) { return x * 16; }
+inline int f2669_17(int x) { return x * 17; }
+inline int f2669_18(int x) { return x * 18; }
+inline int f2669_19(int x) { return x * 19; }
+inline int f2669_20(int x) { return x * 20; }
+inline int f2669_21(int x) { return x * 21; }
+inline int f2669_22(int x) { return x * 22; }
+inline int f2669_23(int x) { return x * 23; }
+inline int f2669_24(int x) { return x * 24; }
+inline int f2669_25(int x) { return x * 25; }
+inline int f2669_26(int x) { return x * 26; }
+inline int f2669_27(int x) { return x * 27; }
+inline int f2669_28(int x) { return x * 28; }
+inline int f2669_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2672 */
+#include <vector>
+#include "h9355.h"
+#include "h5143.h"
+#include "h5637.h"
+#include "h4538.h"
+#include "h4578.h"
+#ifdef X
+#include "h734.h"
+#endif
+struct S2672 { int a; const char *s = "x//y"; };
+inline int f2672_0(int x) { return x * 0; }
+inline int f2672_1(int x) { return x * 1; }
+inline int f2672_2(int x) { return x * 2; }
+inline int f2672_3(int x) { return x * 3; }
+inline int f2672_4(int x) { return x * 4; }
+inline int f2672_5(int x) { return x * 5; }
+inline int f2672_6(int x) { return x * 6; }
+inline int f2672_7(int x) { return x * 7; }
+inline int f2672_8(int x) { return x * 8; }
+inline int f2672_9(int x) { return x * 9; }
+inline int f2672_10(int x) { return x * 10; }
+inline int f2672_11(int x) { return x * 11; }
+inline int f2672_12(int x) { return x * 12; }
+inline int f2672_13(int x) { return x * 13; }
+inline int f2672_14(int x) { return x * 14; }
+inline int f2672_15(int x) { return x * 15; }
+inline int f2672_16(int x) { return x * 16; }
+inline int f2672_17(int x) { return x * 17; }
+inline int f2672_18(int x) { return x * 18; }
+inline int f2672_19(int x) { return x * 19; }
+inline int f2672_20(int x) { return x * 20; }
+inline int f2672_21(int x) { return x * 21; }
+inline int f2672_22(int x) { return x * 22; }
+inline int f2672_23(int x) { return x * 23; }
+inline int f2672_24(int x) { return x * 24; }
+inline int f2672_25(int x) { return x * 25; }
+inline int f2672_26(int x) { return x * 26; }
+inline int f2672_27(int x) { return x * 27; }
+inline int f2672_28(int x) { return x * 28; }
+inline int f2672_29(int x) { return x * 29; }
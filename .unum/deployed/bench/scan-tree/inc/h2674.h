@@ -0,0 +1,42 @@
+#pragma once
+/* header 2674 */
+#include <vector>
+#include "h4178.h"
+#include "h1166.h"
+#include "h1899.h"
+#include "h1343.h"
+#include "h8651.h"
+#ifdef X
+#include "h3989.h"
+#endif
+struct S2674 { int a; const char *s = "x//y"; };
+inline int f2674_0(int x) { return x * 0; }
+inline int f2674_1(int x) { return x * 1; }
+inline int f2674_2(int x) { return x * 2; }
+inline int f2674_3(int x) { return x * 3; }
+inline int f2674_4(int x) { return x * 4; }
+inline int f2674_5(int x) { return x * 5; }
+inline int f2674_6(int x) { return x * 6; }
+inline int f2674_7(int x) { return x * 7; }
+inline int f2674_8(int x) { return x * 8; }
+inline int f2674_9(int x) { return x * 9; }
+inline int f2674_10(int x) { return x * 10; }
+inline int f2674_11(int x) { return x * 11; }
+inline int f2674_12(int x) { return x * 12; }
+inline int f2674_13(int x) { return x * 13; }
+inline int f2674_14(int x) { return x * 14; }
+inline int f2674_15(int x) { return x * 15; }
+inline int f2674_16(int x) { return x * 16; }
+inline int f2674_17(int x) { return x * 17; }
+inline int f2674_18(int x) { return x * 18; }
+inline int f2674_19(int x) { return x * 19; }
+inline int f2674_20(int x) { return x * 20; }
+inline int f2674_21(int x) { return x * 21; }
+inline int f2674_22(int x) { return x * 22; }
+inline int f2674_23(int x) { return x * 23; }
+inline int f2674_24(int x) { return x * 24; }
+inline int f2674_25(int x) { return x * 25; }
+inline int f2674_26(int x) { return x * 26; }
+inline int f2674_27(int x) { return x * 27; }
+inline int f2674_28(int x) { return x * 28; }
+inline int f2674_29(int x) { return x * 29; }
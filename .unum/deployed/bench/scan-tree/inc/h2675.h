@@ -0,0 +1,42 @@
+#pragma once
+/* header 2675 */
+#include <vector>
+#include "h2536.h"
+#include "h7361.h"
+#include "h7952.h"
+#include "h1472.h"
+#include "h5758.h"
+#ifdef X
+#include "h8422.h"
+#endif
+struct S2675 { int a; const char *s = "x//y"; };
+inline int f2675_0(int x) { return x * 0; }
+inline int f2675_1(int x) { return x * 1; }
+inline int f2675_2(int x) { return x * 2; }
+inline int f2675_3(int x) { return x * 3; }
+inline int f2675_4(int x) { return x * 4; }
+inline int f2675_5(int x) { return x * 5; }
+inline int f2675_6(int x) { return x * 6; }
+inline int f2675_7(int x) { return x * 7; }
+inline int f2675_8(int x) { return x * 8; }
+inline int f2675_9(int x) { return x * 9; }
+inline int f2675_10(int x) { return x * 10; }
+inline int f2675_11(int x) { return x * 11; }
+inline int f2675_12(int x) { return x * 12; }
+inline int f2675_13(int x) { return x * 13; }
+inline int f2675_14(int x) { return x * 14; }
+inline int f2675_15(int x) { return x * 15; }
+inline int f2675_16(int x) { return x * 16; }
+inline int f2675_17(int x) { return x * 17; }
+inline int f2675_18(int x) { return x * 18; }
+inline int f2675_19(int x) { return x * 19; }
+inline int f2675_20(int x) { return x * 20; }
+inline int f2675_21(int x) { return x * 21; }
+inline int f2675_22(int x) { return x * 22; }
+inline int f2675_23(int x) { return x * 23; }
+inline int f2675_24(int x) { return x * 24; }
+inline int f2675_25(int x) { return x * 25; }
+inline int f2675_26(int x) { return x * 26; }
+inline int f2675_27(int x) { return x * 27; }
+inline int f2675_28(int x) { return x * 28; }
+inline int f2675_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2676 */
+#include <vector>
+#include "h1174.h"
+#include "h2743.h"
+#include "h8310.h"
+#include "h9257.h"
+#include "h8044.h"
+#ifdef X
+#include "h3712.h"
+#endif
+struct S2676 { int a; const char *s = "x//y"; };
+inline int f2676_0(int x) { return x * 0; }
+inline int f2676_1(int x) { return x * 1; }
+inline int f2676_2(int x) { return x * 2; }
+inline int f2676_3(int x) { return x * 3; }
+inline int f2676_4(int x) { return x * 4; }
+inline int f2676_5(int x) { return x * 5; }
+inline int f2676_6(int x) { return x * 6; }
+inline int f2676_7(int x) { return x * 7; }
+inline int f2676_8(int x) { return x * 8; }
+inline int f2676_9(int x) { return x * 9; }
+inline int f2676_10(int x) { return x * 10; }
+inline int f2676_11(int x) { return x * 11; }
+inline int f2676_12(int x) { return x * 12; }
+inline int f2676_13(int x) { return x * 13; }
+inline int f2676_14(int x) { return x * 14; }
+inline int f2676_15(int x) { return x * 15; }
+inline int f2676_16(int x) { return x * 16; }
+inline int f2676_17(int x) { return x * 17; }
+inline int f2676_18(int x) { return x * 18; }
+inline int f2676_19(int x) { return x * 19; }
+inline int f2676_20(int x) { return x * 20; }
+inline int f2676_21(int x) { return x * 21; }
+inline int f2676_22(int x) { return x * 22; }
+inline int f2676_23(int x) { return x * 23; }
+inline int f2676_24(int x) { return x * 24; }
+inline int f2676_25(int x) { return x * 25; }
+inline int f2676_26(int x) { return x * 26; }
+inline int f2676_27(int x) { return x * 27; }
+inline int f2676_28(int x) { return x * 28; }
+inline int f2676_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2680 */
+#include <vector>
+#include "h2690.h"
+#include "h812.h"
+#include "h5550.h"
+#include "h1385.h"
+#include "h4624.h"
+#ifdef X
+#include "h9281.h"
+#endif
+struct S2680 { int a; const char *s = "x//y"; };
+inline int f2680_0(int x) { return x * 0; }
+inline int f2680_1(int x) { return x * 1; }
+inline int f2680_2(int x) { return x * 2; }
+inline int f2680_3(int x) { return x * 3; }
+inline int f2680_4(int x) { return x * 4; }
+inline int f2680_5(int x) { return x * 5; }
+inline int f2680_6(int x) { return x * 6; }
+inline int f2680_7(int x) { return x * 7; }
+inline int f2680_8(int x) { return x * 8; }
+inline int f2680_9(int x) { return x * 9; }
+inline int f2680_10(int x) { return x * 10; }
+inline int f2680_11(int x) { return x * 11; }
+inline int f2680_12(int x) { return x * 12; }
+inline int f2680_13(int x) { return x * 13; }
+inline int f2680_14(int x) { return x * 14; }
+inline int f2680_15(int x) { return x * 15; }
+inline int f2680_16(int x) { return x * 16; }
+inline int f2680_17(int x) { return x * 17; }
+inline int f2680_18(int x) { return x * 18; }
+inline int f2680_19(int x) { return x * 19; }
+inline int f2680_20(int x) { return x * 20; }
+inline int f2680_21(int x) { return x * 21; }
+inline int f2680_22(int x) { return x * 22; }
+inline int f2680_23(int x) { return x * 23; }
+inline int f2680_24(int x) { return x * 24; }
+inline int f2680_25(int x) { return x * 25; }
+inline int f2680_26(int x) { return x * 26; }
+inline int f2680_27(int x) { return x * 27; }
+inline int f2680_28(int x) { return x * 28; }
+inline int f2680_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2681 */
+#include <vector>
+#include "h1662.h"
+#include "h9341.h"
+#include "h28.h"
+#include "h4176.h"
+#include "h8888.h"
+#ifdef X
+#include "h777.h"
+#endif
+struct S2681 { int a; const char *s = "x//y"; };
+inline int f2681_0(int x) { return x * 0; }
+inline int f2681_1(int x) { return x * 1; }
+inline int f2681_2(int x) { return x * 2; }
+inline int f2681_3(int x) { return x * 3; }
+inline int f2681_4(int x) { return x * 4; }
+inline int f2681_5(int x) { return x * 5; }
+inline int f2681_6(int x) { return x * 6; }
+inline int f2681_7(int x) { return x * 7; }
+inline int f2681_8(int x) { return x * 8; }
+inline int f2681_9(int x) { return x * 9; }
+inline int f2681_10(int x) { return x * 10; }
+inline int f2681_11(int x) { return x * 11; }
+inline int f2681_12(int x) { return x * 12; }
+inline int f2681_13(int x) { return x * 13; }
+inline int f2681_14(int x) { return x * 14; }
+inline int f2681_15(int x) { return x * 15; }
+inline int f2681_16(int x) { return x * 16; }
+inline int f2681_17(int x) { return x * 17; }
+inline int f2681_18(int x) { return x * 18; }
+inline int f2681_19(int x) { return x * 19; }
+inline int f2681_20(int x) { return x * 20; }
+inline int f2681_21(int x) { return x * 21; }
+inline int f2681_22(int x) { return x * 22; }
+inline int f2681_23(int x) { return x * 23; }
+inline int f2681_24(int x) { return x * 24; }
+inline int f2681_25(int x) { return x * 25; }
+inline int f2681_26(int x) { return x * 26; }
+inline int f2681_27(int x) { return x * 27; }
+inline int f2681_28(int x) { return x * 28; }
+inline int f2681_29(int x) { return x * 29; }
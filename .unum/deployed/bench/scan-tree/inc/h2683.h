@@ -0,0 +1,42 @@
+#pragma once
+/* header 2683 */
+#include <vector>
+#include "h5644.h"
+#include "h2073.h"
+#include "h5847.h"
+#include "h3139.h"
+#include "h963.h"
+#ifdef X
+#include "h8932.h"
+#endif
+struct S2683 { int a; const char *s = "x//y"; };
+inline int f2683_0(int x) { return x * 0; }
+inline int f2683_1(int x) { return x * 1; }
+inline int f2683_2(int x) { return x * 2; }
+inline int f2683_3(int x) { return x * 3; }
+inline int f2683_4(int x) { return x * 4; }
+inline int f2683_5(int x) { return x * 5; }
+inline int f2683_6(int x) { return x * 6; }
+inline int f2683_7(int x) { return x * 7; }
+inline int f2683_8(int x) { return x * 8; }
+inline int f2683_9(int x) { return x * 9; }
+inline int f2683_10(int x) { return x * 10; }
+inline int f2683_11(int x) { return x * 11; }
+inline int f2683_12(int x) { return x * 12; }
+inline int f2683_13(int x) { return x * 13; }
+inline int f2683_14(int x) { return x * 14; }
+inline int f2683_15(int x) { return x * 15; }
+inline int f2683_16(int x) { return x * 16; }
+inline int f2683_17(int x) { return x * 17; }
+inline int f2683_18(int x) { return x * 18; }
+inline int f2683_19(int x) { return x * 19; }
+inline int f2683_20(int x) { return x * 20; }
+inline int f2683_21(int x) { return x * 21; }
+inline int f2683_22(int x) { return x * 22; }
+inline int f2683_23(int x) { return x * 23; }
+inline int f2683_24(int x) { return x * 24; }
+inline int f2683_25(int x) { return x * 25; }
+inline int f2683_26(int x) { return x * 26; }
+inline int f2683_27(int x) { return x * 27; }
+inline int f2683_28(int x) { return x * 28; }
+inline int f2683_29(int x) { return x * 29; }
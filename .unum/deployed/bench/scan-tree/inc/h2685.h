@@ -0,0 +1,42 @@
+#pragma once
+/* header 2685 */
+#include <vector>
+#include "h4305.h"
+#include "h7913.h"
+#include "h3176.h"
+#include "h4105.h"
+#include "h708.h"
+#ifdef X
+#include "h9724.h"
+#endif
+struct S2685 { int a; const char *s = "x//y"; };
+inline int f2685_0(int x) { return x * 0; }
+inline int f2685_1(int x) { return x * 1; }
+inline int f2685_2(int x) { return x * 2; }
+inline int f2685_3(int x) { return x * 3; }
+inline int f2685_4(int x) { return x * 4; }
+inline int f2685_5(int x) { return x * 5; }
+inline int f2685_6(int x) { return x * 6; }
+inline int f2685_7(int x) { return x * 7; }
+inline int f2685_8(int x) { return x * 8; }
+inline int f2685_9(int x) { return x * 9; }
+inline int f2685_10(int x) { return x * 10; }
+inline int f2685_11(int x) { return x * 11; }
+inline int f2685_12(int x) { return x * 12; }
+inline int f2685_13(int x) { return x * 13; }
+inline int f2685_14(int x) { return x * 14; }
+inline int f2685_15(int x) { return x * 15; }
+inline int f2685_16(int x) { return x * 16; }
+inline int f2685_17(int x) { return x * 17; }
+inline int f2685_18(int x) { return x * 18; }
+inline int f2685_19(int x) { return x * 19; }
+inline int f2685_20(int x) { return x * 20; }
+inline int f2685_21(int x) { return x * 21; }
+inline int f2685_22(int x) { return x * 22; }
+inline int f2685_23(int x) { return x * 23; }
+inline int f2685_24(int x) { return x * 24; }
+inline int f2685_25(int x) { return x * 25; }
+inline int f2685_26(int x) { return x * 26; }
+inline int f2685_27(int x) { return x * 27; }
+inline int f2685_28(int x) { return x * 28; }
+inline int f2685_29(int x) { return x * 29; }
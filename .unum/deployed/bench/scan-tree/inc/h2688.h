@@ -0,0 +1,42 @@
+#pragma once
+/* header 2688 */
+#include <vector>
+#include "h563.h"
+#include "h9721.h"
+#include "h1719.h"
+#include "h7237.h"
+#include "h8874.h"
+#ifdef X
+#include "h7098.h"
+#endif
+struct S2688 { int a; const char *s = "x//y"; };
+inline int f2688_0(int x) { return x * 0; }
+inline int f2688_1(int x) { return x * 1; }
+inline int f2688_2(int x) { return x * 2; }
+inline int f2688_3(int x) { return x * 3; }
+inline int f2688_4(int x) { return x * 4; }
+inline int f2688_5(int x) { return x * 5; }
+inline int f2688_6(int x) { return x * 6; }
+inline int f2688_7(int x) { return x * 7; }
+inline int f2688_8(int x) { return x * 8; }
+inline int f2688_9(int x) { return x * 9; }
+inline int f2688_10(int x) { return x * 10; }
+inline int f2688_11(int x) { return x * 11; }
+inline int f2688_12(int x) { return x * 12; }
+inline int f2688_13(int x) { return x * 13; }
+inline int f2688_14(int x) { return x * 14; }
+inline int f2688_15(int x) { return x * 15; }
+inline int f2688_16(int x) { return x * 16; }
+inline int f2688_17(int x) { return x * 17; }
+inline int f2688_18(int x) { return x * 18; }
+inline int f2688_19(int x) { return x * 19; }
+inline int f2688_20(int x) { return x * 20; }
+inline int f2688_21(int x) { return x * 21; }
+inline int f2688_22(int x) { return x * 22; }
+inline int f2688_23(int x) { return x * 23; }
+inline int f2688_24(int x) { return x * 24; }
+inline int f2688_25(int x) { return x * 25; }
+inline int f2688_26(int x) { return x * 26; }
+inline int f2688_27(int x) { return x * 27; }
+inline int f2688_28(int x) { return x * 28; }
+inline int f2688_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2689 */
+#include <vector>
+#include "h9422.h"
+#include "h3277.h"
+#include "h9230.h"
+#include "h5420.h"
+#include "h258.h"
+#ifdef X
+#include "h5507.h"
+#endif
+struct S2689 { int a; const char *s = "x//y"; };
+inline int f2689_0(int x) { return x * 0; }
+inline int f2689_1(int x) { return x * 1; }
+inline int f2689_2(int x) { return x * 2; }
+inline int f2689_3(int x) { return x * 3; }
+inline int f2689_4(int x) { return x * 4; }
+inline int f2689_5(int x) { return x * 5; }
+inline int f2689_6(int x) { return x * 6; }
+inline int f2689_7(int x) { return x * 7; }
+inline int f2689_8(int x) { return x * 8; }
+inline int f2689_9(int x) { return x * 9; }
+inline int f2689_10(int x) { return x * 10; }
+inline int f2689_11(int x) { return x * 11; }
+inline int f2689_12(int x) { return x * 12; }
+inline int f2689_13(int x) { return x * 13; }
+inline int f2689_14(int x) { return x * 14; }
+inline int f2689_15(int x) { return x * 15; }
+inline int f2689_16(int x) { return x * 16; }
+inline int f2689_17(int x) { return x * 17; }
+inline int f2689_18(int x) { return x * 18; }
+inline int f2689_19(int x) { return x * 19; }
+inline int f2689_20(int x) { return x * 20; }
+inline int f2689_21(int x) { return x * 21; }
+inline int f2689_22(int x) { return x * 22; }
+inline int f2689_23(int x) { return x * 23; }
+inline int f2689_24(int x) { return x * 24; }
+inline int f2689_25(int x) { return x * 25; }
+inline int f2689_26(int x) { return x * 26; }
+inline int f2689_27(int x) { return x * 27; }
+inline int f2689_28(int x) { return x * 28; }
+inline int f2689_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 269 */
+#include <vector>
+#include "h3445.h"
+#include "h449.h"
+#include "h1127.h"
+#include "h7284.h"
+#include "h4059.h"
+#ifdef X
+#include "h5828.h"
+#endif
+struct S269 { int a; const char *s = "x//y"; };
+inline int f269_0(int x) { return x * 0; }
+inline int f269_1(int x) { return x * 1; }
+inline int f269_2(int x) { return x * 2; }
+inline int f269_3(int x) { return x * 3; }
+inline int f269_4(int x) { return x * 4; }
+inline int f269_5(int x) { return x * 5; }
+inline int f269_6(int x) { return x * 6; }
+inline int f269_7(int x) { return x * 7; }
+inline int f269_8(int x) { return x * 8; }
+inline int f269_9(int x) { return x * 9; }
+inline int f269_10(int x) { return x * 10; }
+inline int f269_11(int x) { return x * 11; }
+inline int f269_12(int x) { return x * 12; }
+inline int f269_13(int x) { return x * 13; }
+inline int f269_14(int x) { return x * 14; }
+inline int f269_15(int x) { return x * 15; }
+inline int f269_16(int x) { return x * 16; }
+inline int f269_17(int x) { return x * 17; }
+inline int f269_18(int x) { return x * 18; }
+inline int f269_19(int x) { return x * 19; }
+inline int f269_20(int x) { return x * 20; }
+inline int f269_21(int x) { return x * 21; }
+inline int f269_22(int x) { return x * 22; }
+inline int f269_23(int x) { return x * 23; }
+inline int f269_24(int x) { return x * 24; }
+inline int f269_25(int x) { return x * 25; }
+inline int f269_26(int x) { return x * 26; }
+inline int f269_27(int x) { return x * 27; }
+inline int f269_28(int x) { return x * 28; }
+inline int f269_29(int x) { return x * 29; }
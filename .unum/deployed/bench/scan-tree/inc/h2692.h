@@ -0,0 +1,42 @@
+#pragma once
+/* header 2692 */
+#include <vector>
+#include "h3290.h"
+#include "h6823.h"
+#include "h5973.h"
+#include "h4256.h"
+#include "h1767.h"
+#ifdef X
+#include "h782.h"
+#endif
+struct S2692 { int a; const char *s = "x//y"; };
+inline int f2692_0(int x) { return x * 0; }
+inline int f2692_1(int x) { return x * 1; }
+inline int f2692_2(int x) { return x * 2; }
+inline int f2692_3(int x) { return x * 3; }
+inline int f2692_4(int x) { return x * 4; }
+inline int f2692_5(int x) { return x * 5; }
+inline int f2692_6(int x) { return x * 6; }
+inline int f2692_7(int x) { return x * 7; }
+inline int f2692_8(int x) { return x * 8; }
+inline int f2692_9(int x) { return x * 9; }
+inline int f2692_10(int x) { return x * 10; }
+inline int f2692_11(int x) { return x * 11; }
+inline int f2692_12(int x) { return x * 12; }
+inline int f2692_13(int x) { return x * 13; }
+inline int f2692_14(int x) { return x * 14; }
+inline int f2692_15(int x) { return x * 15; }
+inline int f2692_16(int x) { return x * 16; }
+inline int f2692_17(int x) { return x * 17; }
+inline int f2692_18(int x) { return x * 18; }
+inline int f2692_19(int x) { return x * 19; }
+inline int f2692_20(int x) { return x * 20; }
+inline int f2692_21(int x) { return x * 21; }
+inline int f2692_22(int x) { return x * 22; }
+inline int f2692_23(int x) { return x * 23; }
+inline int f2692_24(int x) { return x * 24; }
+inline int f2692_25(int x) { return x * 25; }
+inline int f2692_26(int x) { return x * 26; }
+inline int f2692_27(int x) { return x * 27; }
+inline int f2692_28(int x) { return x * 28; }
+inline int f2692_29(int x) { return x * 29; }
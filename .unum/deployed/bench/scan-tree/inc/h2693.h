@@ -0,0 +1,42 @@
+#pragma once
+/* header 2693 */
+#include <vector>
+#include "h4200.h"
+#include "h8852.h"
+#include "h1011.h"
+#include "h2491.h"
+#include "h958.h"
+#ifdef X
+#include "h4080.h"
+#endif
+struct S2693 { int a; const char *s = "x//y"; };
+inline int f2693_0(int x) { return x * 0; }
+inline int f2693_1(int x) { return x * 1; }
+inline int f2693_2(int x) { return x * 2; }
+inline int f2693_3(int x) { return x * 3; }
+inline int f2693_4(int x) { return x * 4; }
+inline int f2693_5(int x) { return x * 5; }
+inline int f2693_6(int x) { return x * 6; }
+inline int f2693_7(int x) { return x * 7; }
+inline int f2693_8(int x) { return x * 8; }
+inline int f2693_9(int x) { return x * 9; }
+inline int f2693_10(int x) { return x * 10; }
+inline int f2693_11(int x) { return x * 11; }
+inline int f2693_12(int x) { return x * 12; }
+inline int f2693_13(int x) { return x * 13; }
+inline int f2693_14(int x) { return x * 14; }
+inline int f2693_15(int x) { return x * 15; }
+inline int f2693_16(int x) { return x * 16; }
+inline int f2693_17(int x) { return x * 17; }
+inline int f2693_18(int x) { return x * 18; }
+inline int f2693_19(int x) { return x * 19; }
+inline int f2693_20(int x) { return x * 20; }
+inline int f2693_21(int x) { return x * 21; }
+inline int f2693_22(int x) { return x * 22; }
+inline int f2693_23(int x) { return x * 23; }
+inline int f2693_24(int x) { return x * 24; }
+inline int f2693_25(int x) { return x * 25; }
+inline int f2693_26(int x) { return x * 26; }
+inline int f2693_27(int x) { return x * 27; }
+inline int f2693_28(int x) { return x * 28; }
+inline int f2693_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2694 */
+#include <vector>
+#include "h6053.h"
+#include "h4242.h"
+#include "h3306.h"
+#include "h2792.h"
+#include "h2380.h"
+#ifdef X
+#include "h835.h"
+#endif
+struct S2694 { int a; const char *s = "x//y"; };
+inline int f2694_0(int x) { return x * 0; }
+inline int f2694_1(int x) { return x * 1; }
+inline int f2694_2(int x) { return x * 2; }
+inline int f2694_3(int x) { return x * 3; }
+inline int f2694_4(int x) { return x * 4; }
+inline int f2694_5(int x) { return x * 5; }
+inline int f2694_6(int x) { return x * 6; }
+inline int f2694_7(int x) { return x * 7; }
+inline int f2694_8(int x) { return x * 8; }
+inline int f2694_9(int x) { return x * 9; }
+inline int f2694_10(int x) { return x * 10; }
+inline int f2694_11(int x) { return x * 11; }
+inline int f2694_12(int x) { return x * 12; }
+inline int f2694_13(int x) { return x * 13; }
+inline int f2694_14(int x) { return x * 14; }
+inline int f2694_15(int x) { return x * 15; }
+inline int f2694_16(int x) { return x * 16; }
+inline int f2694_17(int x) { return x * 17; }
+inline int f2694_18(int x) { return x * 18; }
+inline int f2694_19(int x) { return x * 19; }
+inline int f2694_20(int x) { return x * 20; }
+inline int f2694_21(int x) { return x * 21; }
+inline int f2694_22(int x) { return x * 22; }
+inline int f2694_23(int x) { return x * 23; }
+inline int f2694_24(int x) { return x * 24; }
+inline int f2694_25(int x) { return x * 25; }
+inline int f2694_26(int x) { return x * 26; }
+inline int f2694_27(int x) { return x * 27; }
+inline int f2694_28(int x) { return x * 28; }
+inline int f2694_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2696 */
+#include <vector>
+#include "h1548.h"
+#include "h1.h"
+#include "h4006.h"
+#include "h2620.h"
+#include "h4677.h"
+#ifdef X
+#include "h2163.h"
+#endif
+struct S2696 { int a; const char *s = "x//y"; };
+inline int f2696_0(int x) { return x * 0; }
+inline int f2696_1(int x) { return x * 1; }
+inline int f2696_2(int x) { return x * 2; }
+inline int f2696_3(int x) { return x * 3; }
+inline int f2696_4(int x) { return x * 4; }
+inline int f2696_5(int x) { return x * 5; }
+inline int f2696_6(int x) { return x * 6; }
+inline int f2696_7(int x) { return x * 7; }
+inline int f2696_8(int x) { return x * 8; }
+inline int f2696_9(int x) { return x * 9; }
+inline int f2696_10(int x) { return x * 10; }
+inline int f2696_11(int x) { return x * 11; }
+inline int f2696_12(int x) { return x * 12; }
+inline int f2696_13(int x) { return x * 13; }
+inline int f2696_14(int x) { return x * 14; }
+inline int f2696_15(int x) { return x * 15; }
+inline int f2696_16(int x) { return x * 16; }
+inline int f2696_17(int x) { return x * 17; }
+inline int f2696_18(int x) { return x * 18; }
+inline int f2696_19(int x) { return x * 19; }
+inline int f2696_20(int x) { return x * 20; }
+inline int f2696_21(int x) { return x * 21; }
+inline int f2696_22(int x) { return x * 22; }
+inline int f2696_23(int x) { return x * 23; }
+inline int f2696_24(int x) { return x * 24; }
+inline int f2696_25(int x) { return x * 25; }
+inline int f2696_26(int x) { return x * 26; }
+inline int f2696_27(int x) { return x * 27; }
+inline int f2696_28(int x) { return x * 28; }
+inline int f2696_29(int x) { return x * 29; }
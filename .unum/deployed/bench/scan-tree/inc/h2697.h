@@ -0,0 +1,42 @@
+#pragma once
+/* header 2697 */
+#include <vector>
+#include "h3284.h"
+#include "h6620.h"
+#include "h2657.h"
+#include "h1856.h"
+#include "h3788.h"
+#ifdef X
+#include "h1738.h"
+#endif
+struct S2697 { int a; const char *s = "x//y"; };
+inline int f2697_0(int x) { return x * 0; }
+inline int f2697_1(int x) { return x * 1; }
+inline int f2697_2(int x) { return x * 2; }
+inline int f2697_3(int x) { return x * 3; }
+inline int f2697_4(int x) { return x * 4; }
+inline int f2697_5(int x) { return x * 5; }
+inline int f2697_6(int x) { return x * 6; }
+inline int f2697_7(int x) { return x * 7; }
+inline int f2697_8(int x) { return x * 8; }
+inline int f2697_9(int x) { return x * 9; }
+inline int f2697_10(int x) { return x * 10; }
+inline int f2697_11(int x) { return x * 11; }
+inline int f2697_12(int x) { return x * 12; }
+inline int f2697_13(int x) { return x * 13; }
+inline int f2697_14(int x) { return x * 14; }
+inline int f2697_15(int x) { return x * 15; }
+inline int f2697_16(int x) { return x * 16; }
+inline int f2697_17(int x) { return x * 17; }
+inline int f2697_18(int x) { return x * 18; }
+inline int f2697_19(int x) { return x * 19; }
+inline int f2697_20(int x) { return x * 20; }
+inline int f2697_21(int x) { return x * 21; }
+inline int f2697_22(int x) { return x * 22; }
+inline int f2697_23(int x) { return x * 23; }
+inline int f2697_24(int x) { return x * 24; }
+inline int f2697_25(int x) { return x * 25; }
+inline int f2697_26(int x) { return x * 26; }
+inline int f2697_27(int x) { return x * 27; }
+inline int f2697_28(int x) { return x * 28; }
+inline int f2697_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2699 */
+#include <vector>
+#include "h5579.h"
+#include "h9256.h"
+#include "h2735.h"
+#include "h5392.h"
+#include "h4857.h"
+#ifdef X
+#include "h6356.h"
+#endif
+struct S2699 { int a; const char *s = "x//y"; };
+inline int f2699_0(int x) { return x * 0; }
+inline int f2699_1(int x) { return x * 1; }
+inline int f2699_2(int x) { return x * 2; }
+inline int f2699_3(int x) { return x * 3; }
+inline int f2699_4(int x) { return x * 4; }
+inline int f2699_5(int x) { return x * 5; }
+inline int f2699_6(int x) { return x * 6; }
+inline int f2699_7(int x) { return x * 7; }
+inline int f2699_8(int x) { return x * 8; }
+inline int f2699_9(int x) { return x * 9; }
+inline int f2699_10(int x) { return x * 10; }
+inline int f2699_11(int x) { return x * 11; }
+inline int f2699_12(int x) { return x * 12; }
+inline int f2699_13(int x) { return x * 13; }
+inline int f2699_14(int x) { return x * 14; }
+inline int f2699_15(int x) { return x * 15; }
+inline int f2699_16(int x) { return x * 16; }
+inline int f2699_17(int x) { return x * 17; }
+inline int f2699_18(int x) { return x * 18; }
+inline int f2699_19(int x) { return x * 19; }
+inline int f2699_20(int x) { return x * 20; }
+inline int f2699_21(int x) { return x * 21; }
+inline int f2699_22(int x) { return x * 22; }
+inline int f2699_23(int x) { return x * 23; }
+inline int f2699_24(int x) { return x * 24; }
+inline int f2699_25(int x) { return x * 25; }
+inline int f2699_26(int x) { return x * 26; }
+inline int f2699_27(int x) { return x * 27; }
+inline int f2699_28(int x) { return x * 28; }
+inline int f2699_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 27 */
+#include <vector>
+#include "h983.h"
+#include "h7945.h"
+#include "h6542.h"
+#include "h5354.h"
+#include "h5721.h"
+#ifdef X
+#include "h1727.h"
+#endif
+struct S27 { int a; const char *s = "x//y"; };
+inline int f27_0(int x) { return x * 0; }
+inline int f27_1(int x) { return x * 1; }
+inline int f27_2(int x) { return x * 2; }
+inline int f27_3(int x) { return x * 3; }
+inline int f27_4(int x) { return x * 4; }
+inline int f27_5(int x) { return x * 5; }
+inline int f27_6(int x) { return x * 6; }
+inline int f27_7(int x) { return x * 7; }
+inline int f27_8(int x) { return x * 8; }
+inline int f27_9(int x) { return x * 9; }
+inline int f27_10(int x) { return x * 10; }
+inline int f27_11(int x) { return x * 11; }
+inline int f27_12(int x) { return x * 12; }
+inline int f27_13(int x) { return x * 13; }
+inline int f27_14(int x) { return x * 14; }
+inline int f27_15(int x) { return x * 15; }
+inline int f27_16(int x) { return x * 16; }
+inline int f27_17(int x) { return x * 17; }
+inline int f27_18(int x) { return x * 18; }
+inline int f27_19(int x) { return x * 19; }
+inline int f27_20(int x) { return x * 20; }
+inline int f27_21(int x) { return x * 21; }
+inline int f27_22(int x) { return x * 22; }
+inline int f27_23(int x) { return x * 23; }
+inline int f27_24(int x) { return x * 24; }
+inline int f27_25(int x) { return x * 25; }
+inline int f27_26(int x) { return x * 26; }
+inline int f27_27(int x) { return x * 27; }
+inline int f27_28(int x) { return x * 28; }
+inline int f27_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2706 */
+#include <vector>
+#include "h6333.h"
+#include "h1488.h"
+#include "h6246.h"
+#include "h8688.h"
+#include "h3503.h"
+#ifdef X
+#include "h1959.h"
+#endif
+struct S2706 { int a; const char *s = "x//y"; };
+inline int f2706_0(int x) { return x * 0; }
+inline int f2706_1(int x) { return x * 1; }
+inline int f2706_2(int x) { return x * 2; }
+inline int f2706_3(int x) { return x * 3; }
+inline int f2706_4(int x) { return x * 4; }
+inline int f2706_5(int x) { return x * 5; }
+inline int f2706_6(int x) { return x * 6; }
+inline int f2706_7(int x) { return x * 7; }
+inline int f2706_8(int x) { return x * 8; }
+inline int f2706_9(int x) { return x * 9; }
+inline int f2706_10(int x) { return x * 10; }
+inline int f2706_11(int x) { return x * 11; }
+inline int f2706_12(int x) { return x * 12; }
+inline int f2706_13(int x) { return x * 13; }
+inline int f2706_14(int x) { return x * 14; }
+inline int f2706_15(int x) { return x * 15; }
+inline int f2706_16(int x) { return x * 16; }
+inline int f2706_17(int x) { return x * 17; }
+inline int f2706_18(int x) { return x * 18; }
+inline int f2706_19(int x) { return x * 19; }
+inline int f2706_20(int x) { return x * 20; }
+inline int f2706_21(int x) { return x * 21; }
+inline int f2706_22(int x) { return x * 22; }
+inline int f2706_23(int x) { return x * 23; }
+inline int f2706_24(int x) { return x * 24; }
+inline int f2706_25(int x) { return x * 25; }
+inline int f2706_26(int x) { return x * 26; }
+inline int f2706_27(int x) { return x * 27; }
+inline int f2706_28(int x) { return x * 28; }
+inline int f2706_29(int x) { return x * 29; }
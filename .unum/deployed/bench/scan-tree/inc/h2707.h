@@ -0,0 +1,42 @@
+#pragma once
+/* header 2707 */
+#include <vector>
+#include "h2220.h"
+#include "h6533.h"
+#include "h1082.h"
+#include "h9068.h"
+#include "h3667.h"
+#ifdef X
+#include "h4337.h"
+#endif
+struct S2707 { int a; const char *s = "x//y"; };
+inline int f2707_0(int x) { return x * 0; }
+inline int f2707_1(int x) { return x * 1; }
+inline int f2707_2(int x) { return x * 2; }
+inline int f2707_3(int x) { return x * 3; }
+inline int f2707_4(int x) { return x * 4; }
+inline int f2707_5(int x) { return x * 5; }
+inline int f2707_6(int x) { return x * 6; }
+inline int f2707_7(int x) { return x * 7; }
+inline int f2707_8(int x) { return x * 8; }
+inline int f2707_9(int x) { return x * 9; }
+inline int f2707_10(int x) { return x * 10; }
+inline int f2707_11(int x) { return x * 11; }
+inline int f2707_12(int x) { return x * 12; }
+inline int f2707_13(int x) { return x * 13; }
+inline int f2707_14(int x) { return x * 14; }
+inline int f2707_15(int x) { return x * 15; }
+inline int f2707_16(int x) { return x * 16; }
+inline int f2707_17(int x) { return x * 17; }
+inline int f2707_18(int x) { return x * 18; }
+inline int f2707_19(int x) { return x * 19; }
+inline int f2707_20(int x) { return x * 20; }
+inline int f2707_21(int x) { return x * 21; }
+inline int f2707_22(int x) { return x * 22; }
+inline int f2707_23(int x) { return x * 23; }
+inline int f2707_24(int x) { return x * 24; }
+inline int f2707_25(int x) { return x * 25; }
+inline int f2707_26(int x) { return x * 26; }
+inline int f2707_27(int x) { return x * 27; }
+inline int f2707_28(int x) { return x * 28; }
+inline int f2707_29(int x) { return x * 29; }
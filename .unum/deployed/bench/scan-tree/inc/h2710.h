@@ -0,0 +1,42 @@
+#pragma once
+/* header 2710 */
+#include <vector>
+#include "h8890.h"
+#include "h7705.h"
+#include "h8632.h"
+#include "h9808.h"
+#include "h6771.h"
+#ifdef X
+#include "h9392.h"
+#endif
+struct S2710 { int a; const char *s = "x//y"; };
+inline int f2710_0(int x) { return x * 0; }
+inline int f2710_1(int x) { return x * 1; }
+inline int f2710_2(int x) { return x * 2; }
+inline int f2710_3(int x) { return x * 3; }
+inline int f2710_4(int x) { return x * 4; }
+inline int f2710_5(int x) { return x * 5; }
+inline int f2710_6(int x) { return x * 6; }
+inline int f2710_7(int x) { return x * 7; }
+inline int f2710_8(int x) { return x * 8; }
+inline int f2710_9(int x) { return x * 9; }
+inline int f2710_10(int x) { return x * 10; }
+inline int f2710_11(int x) { return x * 11; }
+inline int f2710_12(int x) { return x * 12; }
+inline int f2710_13(int x) { return x * 13; }
+inline int f2710_14(int x) { return x * 14; }
+inline int f2710_15(int x) { return x * 15; }
+inline int f2710_16(int x) { return x * 16; }
+inline int f2710_17(int x) { return x * 17; }
+inline int f2710_18(int x) { return x * 18; }
+inline int f2710_19(int x) { return x * 19; }
+inline int f2710_20(int x) { return x * 20; }
+inline int f2710_21(int x) { return x * 21; }
+inline int f2710_22(int x) { return x * 22; }
+inline int f2710_23(int x) { return x * 23; }
+inline int f2710_24(int x) { return x * 24; }
+inline int f2710_25(int x) { return x * 25; }
+inline int f2710_26(int x) { return x * 26; }
+inline int f2710_27(int x) { return x * 27; }
+inline int f2710_28(int x) { return x * 28; }
+inline int f2710_29(int x) { return x * 29; }
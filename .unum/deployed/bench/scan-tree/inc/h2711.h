@@ -0,0 +1,42 @@
+#pragma once
+/* header 2711 */
+#include <vector>
+#include "h3485.h"
+#include "h8207.h"
+#include "h3731.h"
+#include "h6732.h"
+#include "h8846.h"
+#ifdef X
+#include "h485.h"
+#endif
+struct S2711 { int a; const char *s = "x//y"; };
+inline int f2711_0(int x) { return x * 0; }
+inline int f2711_1(int x) { return x * 1; }
+inline int f2711_2(int x) { return x * 2; }
+inline int f2711_3(int x) { return x * 3; }
+inline int f2711_4(int x) { return x * 4; }
+inline int f2711_5(int x) { return x * 5; }
+inline int f2711_6(int x) { return x * 6; }
+inline int f2711_7(int x) { return x * 7; }
+inline int f2711_8(int x) { return x * 8; }
+inline int f2711_9(int x) { return x * 9; }
+inline int f2711_10(int x) { return x * 10; }
+inline int f2711_11(int x) { return x * 11; }
+inline int f2711_12(int x) { return x * 12; }
+inline int f2711_13(int x) { return x * 13; }
+inline int f2711_14(int x) { return x * 14; }
+inline int f2711_15(int x) { return x * 15; }
+inline int f2711_16(int x) { return x * 16; }
+inline int f2711_17(int x) { return x * 17; }
+inline int f2711_18(int x) { return x * 18; }
+inline int f2711_19(int x) { return x * 19; }
+inline int f2711_20(int x) { return x * 20; }
+inline int f2711_21(int x) { return x * 21; }
+inline int f2711_22(int x) { return x * 22; }
+inline int f2711_23(int x) { return x * 23; }
+inline int f2711_24(int x) { return x * 24; }
+inline int f2711_25(int x) { return x * 25; }
+inline int f2711_26(int x) { return x * 26; }
+inline int f2711_27(int x) { return x * 27; }
+inline int f2711_28(int x) { return x * 28; }
+inline int f2711_29(int x) { return x * 29; }
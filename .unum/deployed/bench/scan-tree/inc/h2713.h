@@ -0,0 +1,42 @@
+#pragma once
+/* header 2713 */
+#include <vector>
+#include "h6824.h"
+#include "h1724.h"
+#include "h7888.h"
+#include "h7694.h"
+#include "h5739.h"
+#ifdef X
+#include "h6129.h"
+#endif
+struct S2713 { int a; const char *s = "x//y"; };
+inline int f2713_0(int x) { return x * 0; }
+inline int f2713_1(int x) { return x * 1; }
+inline int f2713_2(int x) { return x * 2; }
+inline int f2713_3(int x) { return x * 3; }
+inline int f2713_4(int x) { return x * 4; }
+inline int f2713_5(int x) { return x * 5; }
+inline int f2713_6(int x) { return x * 6; }
+inline int f2713_7(int x) { return x * 7; }
+inline int f2713_8(int x) { return x * 8; }
+inline int f2713_9(int x) { return x * 9; }
+inline int f2713_10(int x) { return x * 10; }
+inline int f2713_11(int x) { return x * 11; }
+inline int f2713_12(int x) { return x * 12; }
+inline int f2713_13(int x) { return x * 13; }
+inline int f2713_14(int x) { return x * 14; }
+inline int f2713_15(int x) { return x * 15; }
+inline int f2713_16(int x) { return x * 16; }
+inline int f2713_17(int x) { return x * 17; }
+inline int f2713_18(int x) { return x * 18; }
+inline int f2713_19(int x) { return x * 19; }
+inline int f2713_20(int x) { return x * 20; }
+inline int f2713_21(int x) { return x * 21; }
+inline int f2713_22(int x) { return x * 22; }
+inline int f2713_23(int x) { return x * 23; }
+inline int f2713_24(int x) { return x * 24; }
+inline int f2713_25(int x) { return x * 25; }
+inline int f2713_26(int x) { return x * 26; }
+inline int f2713_27(int x) { return x * 27; }
+inline int f2713_28(int x) { return x * 28; }
+inline int f2713_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2715 */
+#include <vector>
+#include "h5787.h"
+#include "h7789.h"
+#include "h119.h"
+#include "h3881.h"
+#include "h383.h"
+#ifdef X
+#include "h2416.h"
+#endif
+struct S2715 { int a; const char *s = "x//y"; };
+inline int f2715_0(int x) { return x * 0; }
+inline int f2715_1(int x) { return x * 1; }
+inline int f2715_2(int x) { return x * 2; }
+inline int f2715_3(int x) { return x * 3; }
+inline int f2715_4(int x) { return x * 4; }
+inline int f2715_5(int x) { return x * 5; }
+inline int f2715_6(int x) { return x * 6; }
+inline int f2715_7(int x) { return x * 7; }
+inline int f2715_8(int x) { return x * 8; }
+inline int f2715_9(int x) { return x * 9; }
+inline int f2715_10(int x) { return x * 10; }
+inline int f2715_11(int x) { return x * 11; }
+inline int f2715_12(int x) { return x * 12; }
+inline int f2715_13(int x) { return x * 13; }
+inline int f2715_14(int x) { return x * 14; }
+inline int f2715_15(int x) { return x * 15; }
+inline int f2715_16(int x) { return x * 16; }
+inline int f2715_17(int x) { return x * 17; }
+inline int f2715_18(int x) { return x * 18; }
+inline int f2715_19(int x) { return x * 19; }
+inline int f2715_20(int x) { return x * 20; }
+inline int f2715_21(int x) { return x * 21; }
+inline int f2715_22(int x) { return x * 22; }
+inline int f2715_23(int x) { return x * 23; }
+inline int f2715_24(int x) { return x * 24; }
+inline int f2715_25(int x) { return x * 25; }
+inline int f2715_26(int x) { return x * 26; }
+inline int f2715_27(int x) { return x * 27; }
+inline int f2715_28(int x) { return x * 28; }
+inline int f2715_29(int x) { return x * 29; }
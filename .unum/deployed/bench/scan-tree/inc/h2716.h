@@ -0,0 +1,42 @@
+#pragma once
+/* header 2716 */
+#include <vector>
+#include "h9772.h"
+#include "h5099.h"
+#include "h7166.h"
+#include "h4578.h"
+#include "h8375.h"
+#ifdef X
+#include "h6098.h"
+#endif
+struct S2716 { int a; const char *s = "x//y"; };
+inline int f2716_0(int x) { return x * 0; }
+inline int f2716_1(int x) { return x * 1; }
+inline int f2716_2(int x) { return x * 2; }
+inline int f2716_3(int x) { return x * 3; }
+inline int f2716_4(int x) { return x * 4; }
+inline int f2716_5(int x) { return x * 5; }
+inline int f2716_6(int x) { return x * 6; }
+inline int f2716_7(int x) { return x * 7; }
+inline int f2716_8(int x) { return x * 8; }
+inline int f2716_9(int x) { return x * 9; }
+inline int f2716_10(int x) { return x * 10; }
+inline int f2716_11(int x) { return x * 11; }
+inline int f2716_12(int x) { return x * 12; }
+inline int f2716_13(int x) { return x * 13; }
+inline int f2716_14(int x) { return x * 14; }
+inline int f2716_15(int x) { return x * 15; }
+inline int f2716_16(int x) { return x * 16; }
+inline int f2716_17(int x) { return x * 17; }
+inline int f2716_18(int x) { return x * 18; }
+inline int f2716_19(int x) { return x * 19; }
+inline int f2716_20(int x) { return x * 20; }
+inline int f2716_21(int x) { return x * 21; }
+inline int f2716_22(int x) { return x * 22; }
+inline int f2716_23(int x) { return x * 23; }
+inline int f2716_24(int x) { return x * 24; }
+inline int f2716_25(int x) { return x * 25; }
+inline int f2716_26(int x) { return x * 26; }
+inline int f2716_27(int x) { return x * 27; }
+inline int f2716_28(int x) { return x * 28; }
+inline int f2716_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2719 */
+#include <vector>
+#include "h1811.h"
+#include "h9967.h"
+#include "h7964.h"
+#include "h4815.h"
+#include "h7697.h"
+#ifdef X
+#include "h533.h"
+#endif
+struct S2719 { int a; const char *s = "x//y"; };
+inline int f2719_0(int x) { return x * 0; }
+inline int f2719_1(int x) { return x * 1; }
+inline int f2719_2(int x) { return x * 2; }
+inline int f2719_3(int x) { return x * 3; }
+inline int f2719_4(int x) { return x * 4; }
+inline int f2719_5(int x) { return x * 5; }
+inline int f2719_6(int x) { return x * 6; }
+inline int f2719_7(int x) { return x * 7; }
+inline int f2719_8(int x) { return x * 8; }
+inline int f2719_9(int x) { return x * 9; }
+inline int f2719_10(int x) { return x * 10; }
+inline int f2719_11(int x) { return x * 11; }
+inline int f2719_12(int x) { return x * 12; }
+inline int f2719_13(int x) { return x * 13; }
+inline int f2719_14(int x) { return x * 14; }
+inline int f2719_15(int x) { return x * 15; }
+inline int f2719_16(int x) { return x * 16; }
+inline int f2719_17(int x) { return x * 17; }
+inline int f2719_18(int x) { return x * 18; }
+inline int f2719_19(int x) { return x * 19; }
+inline int f2719_20(int x) { return x * 20; }
+inline int f2719_21(int x) { return x * 21; }
+inline int f2719_22(int x) { return x * 22; }
+inline int f2719_23(int x) { return x * 23; }
+inline int f2719_24(int x) { return x * 24; }
+inline int f2719_25(int x) { return x * 25; }
+inline int f2719_26(int x) { return x * 26; }
+inline int f2719_27(int x) { return x * 27; }
+inline int f2719_28(int x) { return x * 28; }
+inline int f2719_29(int x) { return x * 29; }
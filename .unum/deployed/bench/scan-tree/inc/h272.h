@@ -0,0 +1,42 @@
+#pragma once
+/* header 272 */
+#include <vector>
+#include "h4157.h"
+#include "h1470.h"
+#include "h4179.h"
+#include "h2096.h"
+#include "h7314.h"
+#ifdef X
+#include "h2122.h"
+#endif
+struct S272 { int a; const char *s = "x//y"; };
+inline int f272_0(int x) { return x * 0; }
+inline int f272_1(int x) { return x * 1; }
+inline int f272_2(int x) { return x * 2; }
+inline int f272_3(int x) { return x * 3; }
+inline int f272_4(int x) { return x * 4; }
+inline int f272_5(int x) { return x * 5; }
+inline int f272_6(int x) { return x * 6; }
+inline int f272_7(int x) { return x * 7; }
+inline int f272_8(int x) { return x * 8; }
+inline int f272_9(int x) { return x * 9; }
+inline int f272_10(int x) { return x * 10; }
+inline int f272_11(int x) { return x * 11; }
+inline int f272_12(int x) { return x * 12; }
+inline int f272_13(int x) { return x * 13; }
+inline int f272_14(int x) { return x * 14; }
+inline int f272_15(int x) { return x * 15; }
+inline int f272_16(int x) { return x * 16; }
+inline int f272_17(int x) { return x * 17; }
+inline int f272_18(int x) { return x * 18; }
+inline int f272_19(int x) { return x * 19; }
+inline int f272_20(int x) { return x * 20; }
+inline int f272_21(int x) { return x * 21; }
+inline int f272_22(int x) { return x * 22; }
+inline int f272_23(int x) { return x * 23; }
+inline int f272_24(int x) { return x * 24; }
+inline int f272_25(int x) { return x * 25; }
+inline int f272_26(int x) { return x * 26; }
+inline int f272_27(int x) { return x * 27; }
+inline int f272_28(int x) { return x * 28; }
+inline int f272_29(int x) { return x * 29; }
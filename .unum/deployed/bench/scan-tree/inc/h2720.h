@@ -0,0 +1,42 @@
+#pragma once
+/* header 2720 */
+#include <vector>
+#include "h9785.h"
+#include "h2885.h"
+#include "h9544.h"
+#include "h8030.h"
+#include "h5395.h"
+#ifdef X
+#include "h8554.h"
+#endif
+struct S2720 { int a; const char *s = "x//y"; };
+inline int f2720_0(int x) { return x * 0; }
+inline int f2720_1(int x) { return x * 1; }
+inline int f2720_2(int x) { return x * 2; }
+inline int f2720_3(int x) { return x * 3; }
+inline int f2720_4(int x) { return x * 4; }
+inline int f2720_5(int x) { return x * 5; }
+inline int f2720_6(int x) { return x * 6; }
+inline int f2720_7(int x) { return x * 7; }
+inline int f2720_8(int x) { return x * 8; }
+inline int f2720_9(int x) { return x * 9; }
+inline int f2720_10(int x) { return x * 10; }
+inline int f2720_11(int x) { return x * 11; }
+inline int f2720_12(int x) { return x * 12; }
+inline int f2720_13(int x) { return x * 13; }
+inline int f2720_14(int x) { return x * 14; }
+inline int f2720_15(int x) { return x * 15; }
+inline int f2720_16(int x) { return x * 16; }
+inline int f2720_17(int x) { return x * 17; }
+inline int f2720_18(int x) { return x * 18; }
+inline int f2720_19(int x) { return x * 19; }
+inline int f2720_20(int x) { return x * 20; }
+inline int f2720_21(int x) { return x * 21; }
+inline int f2720_22(int x) { return x * 22; }
+inline int f2720_23(int x) { return x * 23; }
+inline int f2720_24(int x) { return x * 24; }
+inline int f2720_25(int x) { return x * 25; }
+inline int f2720_26(int x) { return x * 26; }
+inline int f2720_27(int x) { return x * 27; }
+inline int f2720_28(int x) { return x * 28; }
+inline int f2720_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2723 */
+#include <vector>
+#include "h582.h"
+#include "h8162.h"
+#include "h8880.h"
+#include "h3739.h"
+#include "h9977.h"
+#ifdef X
+#include "h3963.h"
+#endif
+struct S2723 { int a; const char *s = "x//y"; };
+inline int f2723_0(int x) { return x * 0; }
+inline int f2723_1(int x) { return x * 1; }
+inline int f2723_2(int x) { return x * 2; }
+inline int f2723_3(int x) { return x * 3; }
+inline int f2723_4(int x) { return x * 4; }
+inline int f2723_5(int x) { return x * 5; }
+inline int f2723_6(int x) { return x * 6; }
+inline int f2723_7(int x) { return x * 7; }
+inline int f2723_8(int x) { return x * 8; }
+inline int f2723_9(int x) { return x * 9; }
+inline int f2723_10(int x) { return x * 10; }
+inline int f2723_11(int x) { return x * 11; }
+inline int f2723_12(int x) { return x * 12; }
+inline int f2723_13(int x) { return x * 13; }
+inline int f2723_14(int x) { return x * 14; }
+inline int f2723_15(int x) { return x * 15; }
+inline int f2723_16(int x) { return x * 16; }
+inline int f2723_17(int x) { return x * 17; }
+inline int f2723_18(int x) { return x * 18; }
+inline int f2723_19(int x) { return x * 19; }
+inline int f2723_20(int x) { return x * 20; }
+inline int f2723_21(int x) { return x * 21; }
+inline int f2723_22(int x) { return x * 22; }
+inline int f2723_23(int x) { return x * 23; }
+inline int f2723_24(int x) { return x * 24; }
+inline int f2723_25(int x) { return x * 25; }
+inline int f2723_26(int x) { return x * 26; }
+inline int f2723_27(int x) { return x * 27; }
+inline int f2723_28(int x) { return x * 28; }
+inline int f2723_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2728 */
+#include <vector>
+#include "h480.h"
+#include "h2833.h"
+#include "h5230.h"
+#include "h6650.h"
+#include "h7257.h"
+#ifdef X
+#include "h5881.h"
+#endif
+struct S2728 { int a; const char *s = "x//y"; };
+inline int f2728_0(int x) { return x * 0; }
+inline int f2728_1(int x) { return x * 1; }
+inline int f2728_2(int x) { return x * 2; }
+inline int f2728_3(int x) { return x * 3; }
+inline int f2728_4(int x) { return x * 4; }
+inline int f2728_5(int x) { return x * 5; }
+inline int f2728_6(int x) { return x * 6; }
+inline int f2728_7(int x) { return x * 7; }
+inline int f2728_8(int x) { return x * 8; }
+inline int f2728_9(int x) { return x * 9; }
+inline int f2728_10(int x) { return x * 10; }
+inline int f2728_11(int x) { return x * 11; }
+inline int f2728_12(int x) { return x * 12; }
+inline int f2728_13(int x) { return x * 13; }
+inline int f2728_14(int x) { return x * 14; }
+inline int f2728_15(int x) { return x * 15; }
+inline int f2728_16(int x) { return x * 16; }
+inline int f2728_17(int x) { return x * 17; }
+inline int f2728_18(int x) { return x * 18; }
+inline int f2728_19(int x) { return x * 19; }
+inline int f2728_20(int x) { return x * 20; }
+inline int f2728_21(int x) { return x * 21; }
+inline int f2728_22(int x) { return x * 22; }
+inline int f2728_23(int x) { return x * 23; }
+inline int f2728_24(int x) { return x * 24; }
+inline int f2728_25(int x) { return x * 25; }
+inline int f2728_26(int x) { return x * 26; }
+inline int f2728_27(int x) { return x * 27; }
+inline int f2728_28(int x) { return x * 28; }
+inline int f2728_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 273 */
+#include <vector>
+#include "h453.h"
+#include "h2314.h"
+#include "h6938.h"
+#include "h4178.h"
+#include "h5872.h"
+#ifdef X
+#include "h243.h"
+#endif
+struct S273 { int a; const char *s = "x//y"; };
+inline int f273_0(int x) { return x * 0; }
+inline int f273_1(int x) { return x * 1; }
+inline int f273_2(int x) { return x * 2; }
+inline int f273_3(int x) { return x * 3; }
+inline int f273_4(int x) { return x * 4; }
+inline int f273_5(int x) { return x * 5; }
+inline int f273_6(int x) { return x * 6; }
+inline int f273_7(int x) { return x * 7; }
+inline int f273_8(int x) { return x * 8; }
+inline int f273_9(int x) { return x * 9; }
+inline int f273_10(int x) { return x * 10; }
+inline int f273_11(int x) { return x * 11; }
+inline int f273_12(int x) { return x * 12; }
+inline int f273_13(int x) { return x * 13; }
+inline int f273_14(int x) { return x * 14; }
+inline int f273_15(int x) { return x * 15; }
+inline int f273_16(int x) { return x * 16; }
+inline int f273_17(int x) { return x * 17; }
+inline int f273_18(int x) { return x * 18; }
+inline int f273_19(int x) { return x * 19; }
+inline int f273_20(int x) { return x * 20; }
+inline int f273_21(int x) { return x * 21; }
+inline int f273_22(int x) { return x * 22; }
+inline int f273_23(int x) { return x * 23; }
+inline int f273_24(int x) { return x * 24; }
+inline int f273_25(int x) { return x * 25; }
+inline int f273_26(int x) { return x * 26; }
+inline int f273_27(int x) { return x * 27; }
+inline int f273_28(int x) { return x * 28; }
+inline int f273_29(int x) { return x * 29; }
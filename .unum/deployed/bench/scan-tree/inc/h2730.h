@@ -0,0 +1,42 @@
+#pragma once
+/* header 2730 */
+#include <vector>
+#include "h5459.h"
+#include "h4805.h"
+#include "h3335.h"
+#include "h1792.h"
+#include "h6257.h"
+#ifdef X
+#include "h402.h"
+#endif
+struct S2730 { int a; const char *s = "x//y"; };
+inline int f2730_0(int x) { return x * 0; }
+inline int f2730_1(int x) { return x * 1; }
+inline int f2730_2(int x) { return x * 2; }
+inline int f2730_3(int x) { return x * 3; }
+inline int f2730_4(int x) { return x * 4; }
+inline int f2730_5(int x) { return x * 5; }
+inline int f2730_6(int x) { return x * 6; }
+inline int f2730_7(int x) { return x * 7; }
+inline int f2730_8(int x) { return x * 8; }
+inline int f2730_9(int x) { return x * 9; }
+inline int f2730_10(int x) { return x * 10; }
+inline int f2730_11(int x) { return x * 11; }
+inline int f2730_12(int x) { return x * 12; }
+inline int f2730_13(int x) { return x * 13; }
+inline int f2730_14(int x) { return x * 14; }
+inline int f2730_15(int x) { return x * 15; }
+inline int f2730_16(int x) { return x * 16; }
+inline int f2730_17(int x) { return x * 17; }
+inline int f2730_18(int x) { return x * 18; }
+inline int f2730_19(int x) { return x * 19; }
+inline int f2730_20(int x) { return x * 20; }
+inline int f2730_21(int x) { return x * 21; }
+inline int f2730_22(int x) { return x * 22; }
+inline int f2730_23(int x) { return x * 23; }
+inline int f2730_24(int x) { return x * 24; }
+inline int f2730_25(int x) { return x * 25; }
+inline int f2730_26(int x) { return x * 26; }
+inline int f2730_27(int x) { return x * 27; }
+inline int f2730_28(int x) { return x * 28; }
+inline int f2730_29(int x) { return x * 29; }
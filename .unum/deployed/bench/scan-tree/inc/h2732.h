@@ -0,0 +1,42 @@
+#pragma once
+/* header 2732 */
+#include <vector>
+#include "h9513.h"
+#include "h7368.h"
+#include "h9166.h"
+#include "h2284.h"
+#include "h3691.h"
+#ifdef X
+#include "h7301.h"
+#endif
+struct S2732 { int a; const char *s = "x//y"; };
+inline int f2732_0(int x) { return x * 0; }
+inline int f2732_1(int x) { return x * 1; }
+inline int f2732_2(int x) { return x * 2; }
+inline int f2732_3(int x) { return x * 3; }
+inline int f2732_4(int x) { return x * 4; }
+inline int f2732_5(int x) { return x * 5; }
+inline int f2732_6(int x) { return x * 6; }
+inline int f2732_7(int x) { return x * 7; }
+inline int f2732_8(int x) { return x * 8; }
+inline int f2732_9(int x) { return x * 9; }
+inline int f2732_10(int x) { return x * 10; }
+inline int f2732_11(int x) { return x * 11; }
+inline int f2732_12(int x) { return x * 12; }
+inline int f2732_13(int x) { return x * 13; }
+inline int f2732_14(int x) { return x * 14; }
+inline int f2732_15(int x) { return x * 15; }
+inline int f2732_16(int x) { return x * 16; }
+inline int f2732_17(int x) { return x * 17; }
+inline int f2732_18(int x) { return x * 18; }
+inline int f2732_19(int x) { return x * 19; }
+inline int f2732_20(int x) { return x * 20; }
+inline int f2732_21(int x) { return x * 21; }
+inline int f2732_22(int x) { return x * 22; }
+inline int f2732_23(int x) { return x * 23; }
+inline int f2732_24(int x) { return x * 24; }
+inline int f2732_25(int x) { return x * 25; }
+inline int f2732_26(int x) { return x * 26; }
+inline int f2732_27(int x) { return x * 27; }
+inline int f2732_28(int x) { return x * 28; }
+inline int f2732_29(int x) { return x * 29; }
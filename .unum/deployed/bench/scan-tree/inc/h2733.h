@@ -0,0 +1,42 @@
+#pragma once
+/* header 2733 */
+#include <vector>
+#include "h8999.h"
+#include "h5412.h"
+#include "h2667.h"
+#include "h9597.h"
+#include "h5012.h"
+#ifdef X
+#include "h3470.h"
+#endif
+struct S2733 { int a; const char *s = "x//y"; };
+inline int f2733_0(int x) { return x * 0; }
+inline int f2733_1(int x) { return x * 1; }
+inline int f2733_2(int x) { return x * 2; }
+inline int f2733_3(int x) { return x * 3; }
+inline int f2733_4(int x) { return x * 4; }
+inline int f2733_5(int x) { return x * 5; }
+inline int f2733_6(int x) { return x * 6; }
+inline int f2733_7(int x) { return x * 7; }
+inline int f2733_8(int x) { return x * 8; }
+inline int f2733_9(int x) { return x * 9; }
+inline int f2733_10(int x) { return x * 10; }
+inline int f2733_11(int x) { return x * 11; }
+inline int f2733_12(int x) { return x * 12; }
+inline int f2733_13(int x) { return x * 13; }
+inline int f2733_14(int x) { return x * 14; }
+inline int f2733_15(int x) { return x * 15; }
+inline int f2733_16(int x) { return x * 16; }
+inline int f2733_17(int x) { return x * 17; }
+inline int f2733_18(int x) { return x * 18; }
+inline int f2733_19(int x) { return x * 19; }
+inline int f2733_20(int x) { return x * 20; }
+inline int f2733_21(int x) { return x * 21; }
+inline int f2733_22(int x) { return x * 22; }
+inline int f2733_23(int x) { return x * 23; }
+inline int f2733_24(int x) { return x * 24; }
+inline int f2733_25(int x) { return x * 25; }
+inline int f2733_26(int x) { return x * 26; }
+inline int f2733_27(int x) { return x * 27; }
+inline int f2733_28(int x) { return x * 28; }
+inline int f2733_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2735 */
+#include <vector>
+#include "h5139.h"
+#include "h7695.h"
+#include "h3240.h"
+#include "h6424.h"
+#include "h121.h"
+#ifdef X
+#include "h2868.h"
+#endif
+struct S2735 { int a; const char *s = "x//y"; };
+inline int f2735_0(int x) { return x * 0; }
+inline int f2735_1(int x) { return x * 1; }
+inline int f2735_2(int x) { return x * 2; }
+inline int f2735_3(int x) { return x * 3; }
+inline int f2735_4(int x) { return x * 4; }
+inline int f2735_5(int x) { return x * 5; }
+inline int f2735_6(int x) { return x * 6; }
+inline int f2735_7(int x) { return x * 7; }
+inline int f2735_8(int x) { return x * 8; }
+inline int f2735_9(int x) { return x * 9; }
+inline int f2735_10(int x) { return x * 10; }
+inline int f2735_11(int x) { return x * 11; }
+inline int f2735_12(int x) { return x * 12; }
+inline int f2735_13(int x) { return x * 13; }
+inline int f2735_14(int x) { return x * 14; }
+inline int f2735_15(int x) { return x * 15; }
+inline int f2735_16(int x) { return x * 16; }
+inline int f2735_17(int x) { return x * 17; }
+inline int f2735_18(int x) { return x * 18; }
+inline int f2735_19(int x) { return x * 19; }
+inline int f2735_20(int x) { return x * 20; }
+inline int f2735_21(int x) { return x * 21; }
+inline int f2735_22(int x) { return x * 22; }
+inline int f2735_23(int x) { return x * 23; }
+inline int f2735_24(int x) { return x * 24; }
+inline int f2735_25(int x) { return x * 25; }
+inline int f2735_26(int x) { return x * 26; }
+inline int f2735_27(int x) { return x * 27; }
+inline int f2735_28(int x) { return x * 28; }
+inline int f2735_29(int x) { return x * 29; }
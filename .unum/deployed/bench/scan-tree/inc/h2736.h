@@ -0,0 +1,42 @@
+#pragma once
+/* header 2736 */
+#include <vector>
+#include "h3238.h"
+#include "h9708.h"
+#include "h726.h"
+#include "h2765.h"
+#include "h6661.h"
+#ifdef X
+#include "h5631.h"
+#endif
+struct S2736 { int a; const char *s = "x//y"; };
+inline int f2736_0(int x) { return x * 0; }
+inline int f2736_1(int x) { return x * 1; }
+inline int f2736_2(int x) { return x * 2; }
+inline int f2736_3(int x) { return x * 3; }
+inline int f2736_4(int x) { return x * 4; }
+inline int f2736_5(int x) { return x * 5; }
+inline int f2736_6(int x) { return x * 6; }
+inline int f2736_7(int x) { return x * 7; }
+inline int f2736_8(int x) { return x * 8; }
+inline int f2736_9(int x) { return x * 9; }
+inline int f2736_10(int x) { return x * 10; }
+inline int f2736_11(int x) { return x * 11; }
+inline int f2736_12(int x) { return x * 12; }
+inline int f2736_13(int x) { return x * 13; }
+inline int f2736_14(int x) { return x * 14; }
+inline int f2736_15(int x) { return x * 15; }
+inline int f2736_16(int x) { return x * 16; }
+inline int f2736_17(int x) { return x * 17; }
+inline int f2736_18(int x) { return x * 18; }
+inline int f2736_19(int x) { return x * 19; }
+inline int f2736_20(int x) { return x * 20; }
+inline int f2736_21(int x) { return x * 21; }
+inline int f2736_22(int x) { return x * 22; }
+inline int f2736_23(int x) { return x * 23; }
+inline int f2736_24(int x) { return x * 24; }
+inline int f2736_25(int x) { return x * 25; }
+inline int f2736_26(int x) { return x * 26; }
+inline int f2736_27(int x) { return x * 27; }
+inline int f2736_28(int x) { return x * 28; }
+inline int f2736_29(int x) { return x * 29; }
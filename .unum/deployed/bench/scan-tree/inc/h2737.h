@@ -0,0 +1,42 @@
+#pragma once
+/* header 2737 */
+#include <vector>
+#include "h700.h"
+#include "h3989.h"
+#include "h6094.h"
+#include "h7377.h"
+#include "h8624.h"
+#ifdef X
+#include "h7706.h"
+#endif
+struct S2737 { int a; const char *s = "x//y"; };
+inline int f2737_0(int x) { return x * 0; }
+inline int f2737_1(int x) { return x * 1; }
+inline int f2737_2(int x) { return x * 2; }
+inline int f2737_3(int x) { return x * 3; }
+inline int f2737_4(int x) { return x * 4; }
+inline int f2737_5(int x) { return x * 5; }
+inline int f2737_6(int x) { return x * 6; }
+inline int f2737_7(int x) { return x * 7; }
+inline int f2737_8(int x) { return x * 8; }
+inline int f2737_9(int x) { return x * 9; }
+inline int f2737_10(int x) { return x * 10; }
+inline int f2737_11(int x) { return x * 11; }
+inline int f2737_12(int x) { return x * 12; }
+inline int f2737_13(int x) { return x * 13; }
+inline int f2737_14(int x) { return x * 14; }
+inline int f2737_15(int x) { return x * 15; }
+inline int f2737_16(int x) { return x * 16; }
+inline int f2737_17(int x) { return x * 17; }
+inline int f2737_18(int x) { return x * 18; }
+inline int f2737_19(int x) { return x * 19; }
+inline int f2737_20(int x) { return x * 20; }
+inline int f2737_21(int x) { return x * 21; }
+inline int f2737_22(int x) { return x * 22; }
+inline int f2737_23(int x) { return x * 23; }
+inline int f2737_24(int x) { return x * 24; }
+inline int f2737_25(int x) { return x * 25; }
+inline int f2737_26(int x) { return x * 26; }
+inline int f2737_27(int x) { return x * 27; }
+inline int f2737_28(int x) { return x * 28; }
+inline int f2737_29(int x) { return x * 29; }
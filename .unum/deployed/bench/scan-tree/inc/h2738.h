@@ -0,0 +1,42 @@
+#pragma once
+/* header 2738 */
+#include <vector>
+#include "h313.h"
+#include "h117.h"
+#include "h2633.h"
+#include "h9658.h"
+#include "h7711.h"
+#ifdef X
+#include "h5005.h"
+#endif
+struct S2738 { int a; const char *s = "x//y"; };
+inline int f2738_0(int x) { return x * 0; }
+inline int f2738_1(int x) { return x * 1; }
+inline int f2738_2(int x) { return x * 2; }
+inline int f2738_3(int x) { return x * 3; }
+inline int f2738_4(int x) { return x * 4; }
+inline int f2738_5(int x) { return x * 5; }
+inline int f2738_6(int x) { return x * 6; }
+inline int f2738_7(int x) { return x * 7; }
+inline int f2738_8(int x) { return x * 8; }
+inline int f2738_9(int x) { return x * 9; }
+inline int f2738_10(int x) { return x * 10; }
+inline int f2738_11(int x) { return x * 11; }
+inline int f2738_12(int x) { return x * 12; }
+inline int f2738_13(int x) { return x * 13; }
+inline int f2738_14(int x) { return x * 14; }
+inline int f2738_15(int x) { return x * 15; }
+inline int f2738_16(int x) { return x * 16; }
+inline int f2738_17(int x) { return x * 17; }
+inline int f2738_18(int x) { return x * 18; }
+inline int f2738_19(int x) { return x * 19; }
+inline int f2738_20(int x) { return x * 20; }
+inline int f2738_21(int x) { return x * 21; }
+inline int f2738_22(int x) { return x * 22; }
+inline int f2738_23(int x) { return x * 23; }
+inline int f2738_24(int x) { return x * 24; }
+inline int f2738_25(int x) { return x * 25; }
+inline int f2738_26(int x) { return x * 26; }
+inline int f2738_27(int x) { return x * 27; }
+inline int f2738_28(int x) { return x * 28; }
+inline int f2738_29(int x) { return x * 29; }
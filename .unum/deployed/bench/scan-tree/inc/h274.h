@@ -0,0 +1,42 @@
+#pragma once
+/* header 274 */
+#include <vector>
+#include "h6101.h"
+#include "h4701.h"
+#include "h6926.h"
+#include "h4532.h"
+#include "h7886.h"
+#ifdef X
+#include "h9337.h"
+#endif
+struct S274 { int a; const char *s = "x//y"; };
+inline int f274_0(int x) { return x * 0; }
+inline int f274_1(int x) { return x * 1; }
+inline int f274_2(int x) { return x * 2; }
+inline int f274_3(int x) { return x * 3; }
+inline int f274_4(int x) { return x * 4; }
+inline int f274_5(int x) { return x * 5; }
+inline int f274_6(int x) { return x * 6; }
+inline int f274_7(int x) { return x * 7; }
+inline int f274_8(int x) { return x * 8; }
+inline int f274_9(int x) { return x * 9; }
+inline int f274_10(int x) { return x * 10; }
+inline int f274_11(int x) { return x * 11; }
+inline int f274_12(int x) { return x * 12; }
+inline int f274_13(int x) { return x * 13; }
+inline int f274_14(int x) { return x * 14; }
+inline int f274_15(int x) { return x * 15; }
+inline int f274_16(int x) { return x * 16; }
+inline int f274_17(int x) { return x * 17; }
+inline int f274_18(int x) { return x * 18; }
+inline int f274_19(int x) { return x * 19; }
+inline int f274_20(int x) { return x * 20; }
+inline int f274_21(int x) { return x * 21; }
+inline int f274_22(int x) { return x * 22; }
+inline int f274_23(int x) { return x * 23; }
+inline int f274_24(int x) { return x * 24; }
+inline int f274_25(int x) { return x * 25; }
+inline int f274_26(int x) { return x * 26; }
+inline int f274_27(int x) { return x * 27; }
+inline int f274_28(int x) { return x * 28; }
+inline int f274_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2740 */
+#include <vector>
+#include "h5601.h"
+#include "h2098.h"
+#include "h7839.h"
+#include "h3133.h"
+#include "h2836.h"
+#ifdef X
+#include "h7532.h"
+#endif
+struct S2740 { int a; const char *s = "x//y"; };
+inline int f2740_0(int x) { return x * 0; }
+inline int f2740_1(int x) { return x * 1; }
+inline int f2740_2(int x) { return x * 2; }
+inline int f2740_3(int x) { return x * 3; }
+inline int f2740_4(int x) { return x * 4; }
+inline int f2740_5(int x) { return x * 5; }
+inline int f2740_6(int x) { return x * 6; }
+inline int f2740_7(int x) { return x * 7; }
+inline int f2740_8(int x) { return x * 8; }
+inline int f2740_9(int x) { return x * 9; }
+inline int f2740_10(int x) { return x * 10; }
+inline int f2740_11(int x) { return x * 11; }
+inline int f2740_12(int x) { return x * 12; }
+inline int f2740_13(int x) { return x * 13; }
+inline int f2740_14(int x) { return x * 14; }
+inline int f2740_15(int x) { return x * 15; }
+inline int f2740_16(int x) { return x * 16; }
+inline int f2740_17(int x) { return x * 17; }
+inline int f2740_18(int x) { return x * 18; }
+inline int f2740_19(int x) { return x * 19; }
+inline int f2740_20(int x) { return x * 20; }
+inline int f2740_21(int x) { return x * 21; }
+inline int f2740_22(int x) { return x * 22; }
+inline int f2740_23(int x) { return x * 23; }
+inline int f2740_24(int x) { return x * 24; }
+inline int f2740_25(int x) { return x * 25; }
+inline int f2740_26(int x) { return x * 26; }
+inline int f2740_27(int x) { return x * 27; }
+inline int f2740_28(int x) { return x * 28; }
+inline int f2740_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2743 */
+#include <vector>
+#include "h9792.h"
+#include "h300.h"
+#include "h775.h"
+#include "h8065.h"
+#include "h8785.h"
+#ifdef X
+#include "h8153.h"
+#endif
+struct S2743 { int a; const char *s = "x//y"; };
+inline int f2743_0(int x) { return x * 0; }
+inline int f2743_1(int x) { return x * 1; }
+inline int f2743_2(int x) { return x * 2; }
+inline int f2743_3(int x) { return x * 3; }
+inline int f2743_4(int x) { return x * 4; }
+inline int f2743_5(int x) { return x * 5; }
+inline int f2743_6(int x) { return x * 6; }
+inline int f2743_7(int x) { return x * 7; }
+inline int f2743_8(int x) { return x * 8; }
+inline int f2743_9(int x) { return x * 9; }
+inline int f2743_10(int x) { return x * 10; }
+inline int f2743_11(int x) { return x * 11; }
+inline int f2743_12(int x) { return x * 12; }
+inline int f2743_13(int x) { return x * 13; }
+inline int f2743_14(int x) { return x * 14; }
+inline int f2743_15(int x) { return x * 15; }
+inline int f2743_16(int x) { return x * 16; }
+inline int f2743_17(int x) { return x * 17; }
+inline int f2743_18(int x) { return x * 18; }
+inline int f2743_19(int x) { return x * 19; }
+inline int f2743_20(int x) { return x * 20; }
+inline int f2743_21(int x) { return x * 21; }
+inline int f2743_22(int x) { return x * 22; }
+inline int f2743_23(int x) { return x * 23; }
+inline int f2743_24(int x) { return x * 24; }
+inline int f2743_25(int x) { return x * 25; }
+inline int f2743_26(int x) { return x * 26; }
+inline int f2743_27(int x) { return x * 27; }
+inline int f2743_28(int x) { return x * 28; }
+inline int f2743_29(int x) { return x * 29; }
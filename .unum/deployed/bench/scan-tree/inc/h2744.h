@@ -0,0 +1,42 @@
+#pragma once
+/* header 2744 */
+#include <vector>
+#include "h2418.h"
+#include "h8084.h"
+#include "h9629.h"
+#include "h3645.h"
+#include "h5390.h"
+#ifdef X
+#include "h3798.h"
+#endif
+struct S2744 { int a; const char *s = "x//y"; };
+inline int f2744_0(int x) { return x * 0; }
+inline int f2744_1(int x) { return x * 1; }
+inline int f2744_2(int x) { return x * 2; }
+inline int f2744_3(int x) { return x * 3; }
+inline int f2744_4(int x) { return x * 4; }
+inline int f2744_5(int x) { return x * 5; }
+inline int f2744_6(int x) { return x * 6; }
+inline int f2744_7(int x) { return x * 7; }
+inline int f2744_8(int x) { return x * 8; }
+inline int f2744_9(int x) { return x * 9; }
+inline int f2744_10(int x) { return x * 10; }
+inline int f2744_11(int x) { return x * 11; }
+inline int f2744_12(int x) { return x * 12; }
+inline int f2744_13(int x) { return x * 13; }
+inline int f2744_14(int x) { return x * 14; }
+inline int f2744_15(int x) { return x * 15; }
+inline int f2744_16(int x) { return x * 16; }
+inline int f2744_17(int x) { return x * 17; }
+inline int f2744_18(int x) { return x * 18; }
+inline int f2744_19(int x) { return x * 19; }
+inline int f2744_20(int x) { return x * 20; }
+inline int f2744_21(int x) { return x * 21; }
+inline int f2744_22(int x) { return x * 22; }
+inline int f2744_23(int x) { return x * 23; }
+inline int f2744_24(int x) { return x * 24; }
+inline int f2744_25(int x) { return x * 25; }
+inline int f2744_26(int x) { return x * 26; }
+inline int f2744_27(int x) { return x * 27; }
+inline int f2744_28(int x) { return x * 28; }
+inline int f2744_29(int x) { return x * 29; }
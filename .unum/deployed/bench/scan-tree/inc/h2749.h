@@ -0,0 +1,42 @@
+#pragma once
+/* header 2749 */
+#include <vector>
+#include "h3675.h"
+#include "h1077.h"
+#include "h1757.h"
+#include "h2100.h"
+#include "h7577.h"
+#ifdef X
+#include "h1836.h"
+#endif
+struct S2749 { int a; const char *s = "x//y"; };
+inline int f2749_0(int x) { return x * 0; }
+inline int f2749_1(int x) { return x * 1; }
+inline int f2749_2(int x) { return x * 2; }
+inline int f2749_3(int x) { return x * 3; }
+inline int f2749_4(int x) { return x * 4; }
+inline int f2749_5(int x) { return x * 5; }
+inline int f2749_6(int x) { return x * 6; }
+inline int f2749_7(int x) { return x * 7; }
+inline int f2749_8(int x) { return x * 8; }
+inline int f2749_9(int x) { return x * 9; }
+inline int f2749_10(int x) { return x * 10; }
+inline int f2749_11(int x) { return x * 11; }
+inline int f2749_12(int x) { return x * 12; }
+inline int f2749_13(int x) { return x * 13; }
+inline int f2749_14(int x) { return x * 14; }
+inline int f2749_15(int x) { return x * 15; }
+inline int f2749_16(int x) { return x * 16; }
+inline int f2749_17(int x) { return x * 17; }
+inline int f2749_18(int x) { return x * 18; }
+inline int f2749_19(int x) { return x * 19; }
+inline int f2749_20(int x) { return x * 20; }
+inline int f2749_21(int x) { return x * 21; }
+inline int f2749_22(int x) { return x * 22; }
+inline int f2749_23(int x) { return x * 23; }
+inline int f2749_24(int x) { return x * 24; }
+inline int f2749_25(int x) { return x * 25; }
+inline int f2749_26(int x) { return x * 26; }
+inline int f2749_27(int x) { return x * 27; }
+inline int f2749_28(int x) { return x * 28; }
+inline int f2749_29(int x) { return x * 29; }
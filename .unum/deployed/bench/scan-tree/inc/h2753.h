@@ -0,0 +1,42 @@
+#pragma once
+/* header 2753 */
+#include <vector>
+#include "h2314.h"
+#include "h7551.h"
+#include "h6440.h"
+#include "h6039.h"
+#include "h36.h"
+#ifdef X
+#include "h7984.h"
+#endif
+struct S2753 { int a; const char *s = "x//y"; };
+inline int f2753_0(int x) { return x * 0; }
+inline int f2753_1(int x) { return x * 1; }
+inline int f2753_2(int x) { return x * 2; }
+inline int f2753_3(int x) { return x * 3; }
+inline int f2753_4(int x) { return x * 4; }
+inline int f2753_5(int x) { return x * 5; }
+inline int f2753_6(int x) { return x * 6; }
+inline int f2753_7(int x) { return x * 7; }
+inline int f2753_8(int x) { return x * 8; }
+inline int f2753_9(int x) { return x * 9; }
+inline int f2753_10(int x) { return x * 10; }
+inline int f2753_11(int x) { return x * 11; }
+inline int f2753_12(int x) { return x * 12; }
+inline int f2753_13(int x) { return x * 13; }
+inline int f2753_14(int x) { return x * 14; }
+inline int f2753_15(int x) { return x * 15; }
+inline int f2753_16(int x) { return x * 16; }
+inline int f2753_17(int x) { return x * 17; }
+inline int f2753_18(int x) { return x * 18; }
+inline int f2753_19(int x) { return x * 19; }
+inline int f2753_20(int x) { return x * 20; }
+inline int f2753_21(int x) { return x * 21; }
+inline int f2753_22(int x) { return x * 22; }
+inline int f2753_23(int x) { return x * 23; }
+inline int f2753_24(int x) { return x * 24; }
+inline int f2753_25(int x) { return x * 25; }
+inline int f2753_26(int x) { return x * 26; }
+inline int f2753_27(int x) { return x * 27; }
+inline int f2753_28(int x) { return x * 28; }
+inline int f2753_29(int x) { return x * 29; }
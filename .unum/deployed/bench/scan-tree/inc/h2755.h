@@ -0,0 +1,42 @@
+#pragma once
+/* header 2755 */
+#include <vector>
+#include "h7695.h"
+#include "h2764.h"
+#include "h5614.h"
+#include "h5213.h"
+#include "h4595.h"
+#ifdef X
+#include "h5617.h"
+#endif
+struct S2755 { int a; const char *s = "x//y"; };
+inline int f2755_0(int x) { return x * 0; }
+inline int f2755_1(int x) { return x * 1; }
+inline int f2755_2(int x) { return x * 2; }
+inline int f2755_3(int x) { return x * 3; }
+inline int f2755_4(int x) { return x * 4; }
+inline int f2755_5(int x) { return x * 5; }
+inline int f2755_6(int x) { return x * 6; }
+inline int f2755_7(int x) { return x * 7; }
+inline int f2755_8(int x) { return x * 8; }
+inline int f2755_9(int x) { return x * 9; }
+inline int f2755_10(int x) { return x * 10; }
+inline int f2755_11(int x) { return x * 11; }
+inline int f2755_12(int x) { return x * 12; }
+inline int f2755_13(int x) { return x * 13; }
+inline int f2755_14(int x) { return x * 14; }
+inline int f2755_15(int x) { return x * 15; }
+inline int f2755_16(int x) { return x * 16; }
+inline int f2755_17(int x) { return x * 17; }
+inline int f2755_18(int x) { return x * 18; }
+inline int f2755_19(int x) { return x * 19; }
+inline int f2755_20(int x) { return x * 20; }
+inline int f2755_21(int x) { return x * 21; }
+inline int f2755_22(int x) { return x * 22; }
+inline int f2755_23(int x) { return x * 23; }
+inline int f2755_24(int x) { return x * 24; }
+inline int f2755_25(int x) { return x * 25; }
+inline int f2755_26(int x) { return x * 26; }
+inline int f2755_27(int x) { return x * 27; }
+inline int f2755_28(int x) { return x * 28; }
+inline int f2755_29(int x) { return x * 29; }
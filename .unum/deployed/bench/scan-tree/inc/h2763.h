@@ -0,0 +1,42 @@
+#pragma once
+/* header 2763 */
+#include <vector>
+#include "h1062.h"
+#include "h4858.h"
+#include "h1131.h"
+#include "h8369.h"
+#include "h8515.h"
+#ifdef X
+#include "h3384.h"
+#endif
+struct S2763 { int a; const char *s = "x//y"; };
+inline int f2763_0(int x) { return x * 0; }
+inline int f2763_1(int x) { return x * 1; }
+inline int f2763_2(int x) { return x * 2; }
+inline int f2763_3(int x) { return x * 3; }
+inline int f2763_4(int x) { return x * 4; }
+inline int f2763_5(int x) { return x * 5; }
+inline int f2763_6(int x) { return x * 6; }
+inline int f2763_7(int x) { return x * 7; }
+inline int f2763_8(int x) { return x * 8; }
+inline int f2763_9(int x) { return x * 9; }
+inline int f2763_10(int x) { return x * 10; }
+inline int f2763_11(int x) { return x * 11; }
+inline int f2763_12(int x) { return x * 12; }
+inline int f2763_13(int x) { return x * 13; }
+inline int f2763_14(int x) { return x * 14; }
+inline int f2763_15(int x) { return x * 15; }
+inline int f2763_16(int x) { return x * 16; }
+inline int f2763_17(int x) { return x * 17; }
+inline int f2763_18(int x) { return x * 18; }
+inline int f2763_19(int x) { return x * 19; }
+inline int f2763_20(int x) { return x * 20; }
+inline int f2763_21(int x) { return x * 21; }
+inline int f2763_22(int x) { return x * 22; }
+inline int f2763_23(int x) { return x * 23; }
+inline int f2763_24(int x) { return x * 24; }
+inline int f2763_25(int x) { return x * 25; }
+inline int f2763_26(int x) { return x * 26; }
+inline int f2763_27(int x) { return x * 27; }
+inline int f2763_28(int x) { return x * 28; }
+inline int f2763_29(int x) { return x * 29; }
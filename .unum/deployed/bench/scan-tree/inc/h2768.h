@@ -0,0 +1,42 @@
+#pragma once
+/* header 2768 */
+#include <vector>
+#include "h9654.h"
+#include "h7601.h"
+#include "h8579.h"
+#include "h8406.h"
+#include "h1501.h"
+#ifdef X
+#include "h1987.h"
+#endif
+struct S2768 { int a; const char *s = "x//y"; };
+inline int f2768_0(int x) { return x * 0; }
+inline int f2768_1(int x) { return x * 1; }
+inline int f2768_2(int x) { return x * 2; }
+inline int f2768_3(int x) { return x * 3; }
+inline int f2768_4(int x) { return x * 4; }
+inline int f2768_5(int x) { return x * 5; }
+inline int f2768_6(int x) { return x * 6; }
+inline int f2768_7(int x) { return x * 7; }
+inline int f2768_8(int x) { return x * 8; }
+inline int f2768_9(int x) { return x * 9; }
+inline int f2768_10(int x) { return x * 10; }
+inline int f2768_11(int x) { return x * 11; }
+inline int f2768_12(int x) { return x * 12; }
+inline int f2768_13(int x) { return x * 13; }
+inline int f2768_14(int x) { return x * 14; }
+inline int f2768_15(int x) { return x * 15; }
+inline int f2768_16(int x) { return x * 16; }
+inline int f2768_17(int x) { return x * 17; }
+inline int f2768_18(int x) { return x * 18; }
+inline int f2768_19(int x) { return x * 19; }
+inline int f2768_20(int x) { return x * 20; }
+inline int f2768_21(int x) { return x * 21; }
+inline int f2768_22(int x) { return x * 22; }
+inline int f2768_23(int x) { return x * 23; }
+inline int f2768_24(int x) { return x * 24; }
+inline int f2768_25(int x) { return x * 25; }
+inline int f2768_26(int x) { return x * 26; }
+inline int f2768_27(int x) { return x * 27; }
+inline int f2768_28(int x) { return x * 28; }
+inline int f2768_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2770 */
+#include <vector>
+#include "h6905.h"
+#include "h6688.h"
+#include "h8346.h"
+#include "h1931.h"
+#include "h2033.h"
+#ifdef X
+#include "h7933.h"
+#endif
+struct S2770 { int a; const char *s = "x//y"; };
+inline int f2770_0(int x) { return x * 0; }
+inline int f2770_1(int x) { return x * 1; }
+inline int f2770_2(int x) { return x * 2; }
+inline int f2770_3(int x) { return x * 3; }
+inline int f2770_4(int x) { return x * 4; }
+inline int f2770_5(int x) { return x * 5; }
+inline int f2770_6(int x) { return x * 6; }
+inline int f2770_7(int x) { return x * 7; }
+inline int f2770_8(int x) { return x * 8; }
+inline int f2770_9(int x) { return x * 9; }
+inline int f2770_10(int x) { return x * 10; }
+inline int f2770_11(int x) { return x * 11; }
+inline int f2770_12(int x) { return x * 12; }
+inline int f2770_13(int x) { return x * 13; }
+inline int f2770_14(int x) { return x * 14; }
+inline int f2770_15(int x) { return x * 15; }
+inline int f2770_16(int x) { return x * 16; }
+inline int f2770_17(int x) { return x * 17; }
+inline int f2770_18(int x) { return x * 18; }
+inline int f2770_19(int x) { return x * 19; }
+inline int f2770_20(int x) { return x * 20; }
+inline int f2770_21(int x) { return x * 21; }
+inline int f2770_22(int x) { return x * 22; }
+inline int f2770_23(int x) { return x * 23; }
+inline int f2770_24(int x) { return x * 24; }
+inline int f2770_25(int x) { return x * 25; }
+inline int f2770_26(int x) { return x * 26; }
+inline int f2770_27(int x) { return x * 27; }
+inline int f2770_28(int x) { return x * 28; }
+inline int f2770_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2771 */
+#include <vector>
+#include "h8419.h"
+#include "h8189.h"
+#include "h8206.h"
+#include "h7956.h"
+#include "h2294.h"
+#ifdef X
+#include "h5251.h"
+#endif
+struct S2771 { int a; const char *s = "x//y"; };
+inline int f2771_0(int x) { return x * 0; }
+inline int f2771_1(int x) { return x * 1; }
+inline int f2771_2(int x) { return x * 2; }
+inline int f2771_3(int x) { return x * 3; }
+inline int f2771_4(int x) { return x * 4; }
+inline int f2771_5(int x) { return x * 5; }
+inline int f2771_6(int x) { return x * 6; }
+inline int f2771_7(int x) { return x * 7; }
+inline int f2771_8(int x) { return x * 8; }
+inline int f2771_9(int x) { return x * 9; }
+inline int f2771_10(int x) { return x * 10; }
+inline int f2771_11(int x) { return x * 11; }
+inline int f2771_12(int x) { return x * 12; }
+inline int f2771_13(int x) { return x * 13; }
+inline int f2771_14(int x) { return x * 14; }
+inline int f2771_15(int x) { return x * 15; }
+inline int f2771_16(int x) { return x * 16; }
+inline int f2771_17(int x) { return x * 17; }
+inline int f2771_18(int x) { return x * 18; }
+inline int f2771_19(int x) { return x * 19; }
+inline int f2771_20(int x) { return x * 20; }
+inline int f2771_21(int x) { return x * 21; }
+inline int f2771_22(int x) { return x * 22; }
+inline int f2771_23(int x) { return x * 23; }
+inline int f2771_24(int x) { return x * 24; }
+inline int f2771_25(int x) { return x * 25; }
+inline int f2771_26(int x) { return x * 26; }
+inline int f2771_27(int x) { return x * 27; }
+inline int f2771_28(int x) { return x * 28; }
+inline int f2771_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2776 */
+#include <vector>
+#include "h2696.h"
+#include "h3116.h"
+#include "h5540.h"
+#include "h3326.h"
+#include "h8019.h"
+#ifdef X
+#include "h4575.h"
+#endif
+struct S2776 { int a; const char *s = "x//y"; };
+inline int f2776_0(int x) { return x * 0; }
+inline int f2776_1(int x) { return x * 1; }
+inline int f2776_2(int x) { return x * 2; }
+inline int f2776_3(int x) { return x * 3; }
+inline int f2776_4(int x) { return x * 4; }
+inline int f2776_5(int x) { return x * 5; }
+inline int f2776_6(int x) { return x * 6; }
+inline int f2776_7(int x) { return x * 7; }
+inline int f2776_8(int x) { return x * 8; }
+inline int f2776_9(int x) { return x * 9; }
+inline int f2776_10(int x) { return x * 10; }
+inline int f2776_11(int x) { return x * 11; }
+inline int f2776_12(int x) { return x * 12; }
+inline int f2776_13(int x) { return x * 13; }
+inline int f2776_14(int x) { return x * 14; }
+inline int f2776_15(int x) { return x * 15; }
+inline int f2776_16(int x) { return x * 16; }
+inline int f2776_17(int x) { return x * 17; }
+inline int f2776_18(int x) { return x * 18; }
+inline int f2776_19(int x) { return x * 19; }
+inline int f2776_20(int x) { return x * 20; }
+inline int f2776_21(int x) { return x * 21; }
+inline int f2776_22(int x) { return x * 22; }
+inline int f2776_23(int x) { return x * 23; }
+inline int f2776_24(int x) { return x * 24; }
+inline int f2776_25(int x) { return x * 25; }
+inline int f2776_26(int x) { return x * 26; }
+inline int f2776_27(int x) { return x * 27; }
+inline int f2776_28(int x) { return x * 28; }
+inline int f2776_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2777 */
+#include <vector>
+#include "h8515.h"
+#include "h1665.h"
+#include "h9792.h"
+#include "h1703.h"
+#include "h8390.h"
+#ifdef X
+#include "h8252.h"
+#endif
+struct S2777 { int a; const char *s = "x//y"; };
+inline int f2777_0(int x) { return x * 0; }
+inline int f2777_1(int x) { return x * 1; }
+inline int f2777_2(int x) { return x * 2; }
+inline int f2777_3(int x) { return x * 3; }
+inline int f2777_4(int x) { return x * 4; }
+inline int f2777_5(int x) { return x * 5; }
+inline int f2777_6(int x) { return x * 6; }
+inline int f2777_7(int x) { return x * 7; }
+inline int f2777_8(int x) { return x * 8; }
+inline int f2777_9(int x) { return x * 9; }
+inline int f2777_10(int x) { return x * 10; }
+inline int f2777_11(int x) { return x * 11; }
+inline int f2777_12(int x) { return x * 12; }
+inline int f2777_13(int x) { return x * 13; }
+inline int f2777_14(int x) { return x * 14; }
+inline int f2777_15(int x) { return x * 15; }
+inline int f2777_16(int x) { return x * 16; }
+inline int f2777_17(int x) { return x * 17; }
+inline int f2777_18(int x) { return x * 18; }
+inline int f2777_19(int x) { return x * 19; }
+inline int f2777_20(int x) { return x * 20; }
+inline int f2777_21(int x) { return x * 21; }
+inline int f2777_22(int x) { return x * 22; }
+inline int f2777_23(int x) { return x * 23; }
+inline int f2777_24(int x) { return x * 24; }
+inline int f2777_25(int x) { return x * 25; }
+inline int f2777_26(int x) { return x * 26; }
+inline int f2777_27(int x) { return x * 27; }
+inline int f2777_28(int x) { return x * 28; }
+inline int f2777_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 278 */
+#include <vector>
+#include "h5736.h"
+#include "h3626.h"
+#include "h5325.h"
+#include "h2933.h"
+#include "h7382.h"
+#ifdef X
+#include "h3835.h"
+#endif
+struct S278 { int a; const char *s = "x//y"; };
+inline int f278_0(int x) { return x * 0; }
+inline int f278_1(int x) { return x * 1; }
+inline int f278_2(int x) { return x * 2; }
+inline int f278_3(int x) { return x * 3; }
+inline int f278_4(int x) { return x * 4; }
+inline int f278_5(int x) { return x * 5; }
+inline int f278_6(int x) { return x * 6; }
+inline int f278_7(int x) { return x * 7; }
+inline int f278_8(int x) { return x * 8; }
+inline int f278_9(int x) { return x * 9; }
+inline int f278_10(int x) { return x * 10; }
+inline int f278_11(int x) { return x * 11; }
+inline int f278_12(int x) { return x * 12; }
+inline int f278_13(int x) { return x * 13; }
+inline int f278_14(int x) { return x * 14; }
+inline int f278_15(int x) { return x * 15; }
+inline int f278_16(int x) { return x * 16; }
+inline int f278_17(int x) { return x * 17; }
+inline int f278_18(int x) { return x * 18; }
+inline int f278_19(int x) { return x * 19; }
+inline int f278_20(int x) { return x * 20; }
+inline int f278_21(int x) { return x * 21; }
+inline int f278_22(int x) { return x * 22; }
+inline int f278_23(int x) { return x * 23; }
+inline int f278_24(int x) { return x * 24; }
+inline int f278_25(int x) { return x * 25; }
+inline int f278_26(int x) { return x * 26; }
+inline int f278_27(int x) { return x * 27; }
+inline int f278_28(int x) { return x * 28; }
+inline int f278_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2786 */
+#include <vector>
+#include "h416.h"
+#include "h3511.h"
+#include "h7985.h"
+#include "h44.h"
+#include "h5684.h"
+#ifdef X
+#include "h3832.h"
+#endif
+struct S2786 { int a; const char *s = "x//y"; };
+inline int f2786_0(int x) { return x * 0; }
+inline int f2786_1(int x) { return x * 1; }
+inline int f2786_2(int x) { return x * 2; }
+inline int f2786_3(int x) { return x * 3; }
+inline int f2786_4(int x) { return x * 4; }
+inline int f2786_5(int x) { return x * 5; }
+inline int f2786_6(int x) { return x * 6; }
+inline int f2786_7(int x) { return x * 7; }
+inline int f2786_8(int x) { return x * 8; }
+inline int f2786_9(int x) { return x * 9; }
+inline int f2786_10(int x) { return x * 10; }
+inline int f2786_11(int x) { return x * 11; }
+inline int f2786_12(int x) { return x * 12; }
+inline int f2786_13(int x) { return x * 13; }
+inline int f2786_14(int x) { return x * 14; }
+inline int f2786_15(int x) { return x * 15; }
+inline int f2786_16(int x) { return x * 16; }
+inline int f2786_17(int x) { return x * 17; }
+inline int f2786_18(int x) { return x * 18; }
+inline int f2786_19(int x) { return x * 19; }
+inline int f2786_20(int x) { return x * 20; }
+inline int f2786_21(int x) { return x * 21; }
+inline int f2786_22(int x) { return x * 22; }
+inline int f2786_23(int x) { return x * 23; }
+inline int f2786_24(int x) { return x * 24; }
+inline int f2786_25(int x) { return x * 25; }
+inline int f2786_26(int x) { return x * 26; }
+inline int f2786_27(int x) { return x * 27; }
+inline int f2786_28(int x) { return x * 28; }
+inline int f2786_29(int x) { return x * 29; }
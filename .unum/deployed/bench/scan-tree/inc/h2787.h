@@ -0,0 +1,42 @@
+#pragma once
+/* header 2787 */
+#include <vector>
+#include "h1347.h"
+#include "h901.h"
+#include "h6987.h"
+#include "h2477.h"
+#include "h9850.h"
+#ifdef X
+#include "h4084.h"
+#endif
+struct S2787 { int a; const char *s = "x//y"; };
+inline int f2787_0(int x) { return x * 0; }
+inline int f2787_1(int x) { return x * 1; }
+inline int f2787_2(int x) { return x * 2; }
+inline int f2787_3(int x) { return x * 3; }
+inline int f2787_4(int x) { return x * 4; }
+inline int f2787_5(int x) { return x * 5; }
+inline int f2787_6(int x) { return x * 6; }
+inline int f2787_7(int x) { return x * 7; }
+inline int f2787_8(int x) { return x * 8; }
+inline int f2787_9(int x) { return x * 9; }
+inline int f2787_10(int x) { return x * 10; }
+inline int f2787_11(int x) { return x * 11; }
+inline int f2787_12(int x) { return x * 12; }
+inline int f2787_13(int x) { return x * 13; }
+inline int f2787_14(int x) { return x * 14; }
+inline int f2787_15(int x) { return x * 15; }
+inline int f2787_16(int x) { return x * 16; }
+inline int f2787_17(int x) { return x * 17; }
+inline int f2787_18(int x) { return x * 18; }
+inline int f2787_19(int x) { return x * 19; }
+inline int f2787_20(int x) { return x * 20; }
+inline int f2787_21(int x) { return x * 21; }
+inline int f2787_22(int x) { return x * 22; }
+inline int f2787_23(int x) { return x * 23; }
+inline int f2787_24(int x) { return x * 24; }
+inline int f2787_25(int x) { return x * 25; }
+inline int f2787_26(int x) { return x * 26; }
+inline int f2787_27(int x) { return x * 27; }
+inline int f2787_28(int x) { return x * 28; }
+inline int f2787_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2789 */
+#include <vector>
+#include "h3440.h"
+#include "h4277.h"
+#include "h625.h"
+#include "h557.h"
+#include "h3802.h"
+#ifdef X
+#include "h3012.h"
+#endif
+struct S2789 { int a; const char *s = "x//y"; };
+inline int f2789_0(int x) { return x * 0; }
+inline int f2789_1(int x) { return x * 1; }
+inline int f2789_2(int x) { return x * 2; }
+inline int f2789_3(int x) { return x * 3; }
+inline int f2789_4(int x) { return x * 4; }
+inline int f2789_5(int x) { return x * 5; }
+inline int f2789_6(int x) { return x * 6; }
+inline int f2789_7(int x) { return x * 7; }
+inline int f2789_8(int x) { return x * 8; }
+inline int f2789_9(int x) { return x * 9; }
+inline int f2789_10(int x) { return x * 10; }
+inline int f2789_11(int x) { return x * 11; }
+inline int f2789_12(int x) { return x * 12; }
+inline int f2789_13(int x) { return x * 13; }
+inline int f2789_14(int x) { return x * 14; }
+inline int f2789_15(int x) { return x * 15; }
+inline int f2789_16(int x) { return x * 16; }
+inline int f2789_17(int x) { return x * 17; }
+inline int f2789_18(int x) { return x * 18; }
+inline int f2789_19(int x) { return x * 19; }
+inline int f2789_20(int x) { return x * 20; }
+inline int f2789_21(int x) { return x * 21; }
+inline int f2789_22(int x) { return x * 22; }
+inline int f2789_23(int x) { return x * 23; }
+inline int f2789_24(int x) { return x * 24; }
+inline int f2789_25(int x) { return x * 25; }
+inline int f2789_26(int x) { return x * 26; }
+inline int f2789_27(int x) { return x * 27; }
+inline int f2789_28(int x) { return x * 28; }
+inline int f2789_29(int x) { return x * 29; }
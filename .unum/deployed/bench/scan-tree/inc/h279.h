@@ -0,0 +1,42 @@
+#pragma once
+/* header 279 */
+#include <vector>
+#include "h1290.h"
+#include "h385.h"
+#include "h3027.h"
+#include "h2249.h"
+#include "h1262.h"
+#ifdef X
+#include "h6990.h"
+#endif
+struct S279 { int a; const char *s = "x//y"; };
+inline int f279_0(int x) { return x * 0; }
+inline int f279_1(int x) { return x * 1; }
+inline int f279_2(int x) { return x * 2; }
+inline int f279_3(int x) { return x * 3; }
+inline int f279_4(int x) { return x * 4; }
+inline int f279_5(int x) { return x * 5; }
+inline int f279_6(int x) { return x * 6; }
+inline int f279_7(int x) { return x * 7; }
+inline int f279_8(int x) { return x * 8; }
+inline int f279_9(int x) { return x * 9; }
+inline int f279_10(int x) { return x * 10; }
+inline int f279_11(int x) { return x * 11; }
+inline int f279_12(int x) { return x * 12; }
+inline int f279_13(int x) { return x * 13; }
+inline int f279_14(int x) { return x * 14; }
+inline int f279_15(int x) { return x * 15; }
+inline int f279_16(int x) { return x * 16; }
+inline int f279_17(int x) { return x * 17; }
+inline int f279_18(int x) { return x * 18; }
+inline int f279_19(int x) { return x * 19; }
+inline int f279_20(int x) { return x * 20; }
+inline int f279_21(int x) { return x * 21; }
+inline int f279_22(int x) { return x * 22; }
+inline int f279_23(int x) { return x * 23; }
+inline int f279_24(int x) { return x * 24; }
+inline int f279_25(int x) { return x * 25; }
+inline int f279_26(int x) { return x * 26; }
+inline int f279_27(int x) { return x * 27; }
+inline int f279_28(int x) { return x * 28; }
+inline int f279_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2790 */
+#include <vector>
+#include "h5666.h"
+#include "h3438.h"
+#include "h2093.h"
+#include "h5278.h"
+#include "h117.h"
+#ifdef X
+#include "h545.h"
+#endif
+struct S2790 { int a; const char *s = "x//y"; };
+inline int f2790_0(int x) { return x * 0; }
+inline int f2790_1(int x) { return x * 1; }
+inline int f2790_2(int x) { return x * 2; }
+inline int f2790_3(int x) { return x * 3; }
+inline int f2790_4(int x) { return x * 4; }
+inline int f2790_5(int x) { return x * 5; }
+inline int f2790_6(int x) { return x * 6; }
+inline int f2790_7(int x) { return x * 7; }
+inline int f2790_8(int x) { return x * 8; }
+inline int f2790_9(int x) { return x * 9; }
+inline int f2790_10(int x) { return x * 10; }
+inline int f2790_11(int x) { return x * 11; }
+inline int f2790_12(int x) { return x * 12; }
+inline int f2790_13(int x) { return x * 13; }
+inline int f2790_14(int x) { return x * 14; }
+inline int f2790_15(int x) { return x * 15; }
+inline int f2790_16(int x) { return x * 16; }
+inline int f2790_17(int x) { return x * 17; }
+inline int f2790_18(int x) { return x * 18; }
+inline int f2790_19(int x) { return x * 19; }
+inline int f2790_20(int x) { return x * 20; }
+inline int f2790_21(int x) { return x * 21; }
+inline int f2790_22(int x) { return x * 22; }
+inline int f2790_23(int x) { return x * 23; }
+inline int f2790_24(int x) { return x * 24; }
+inline int f2790_25(int x) { return x * 25; }
+inline int f2790_26(int x) { return x * 26; }
+inline int f2790_27(int x) { return x * 27; }
+inline int f2790_28(int x) { return x * 28; }
+inline int f2790_29(int x) { return x * 29; }
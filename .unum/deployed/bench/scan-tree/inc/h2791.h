@@ -0,0 +1,42 @@
+#pragma once
+/* header 2791 */
+#include <vector>
+#include "h4013.h"
+#include "h8377.h"
+#include "h3688.h"
+#include "h8735.h"
+#include "h6613.h"
+#ifdef X
+#include "h43.h"
+#endif
+struct S2791 { int a; const char *s = "x//y"; };
+inline int f2791_0(int x) { return x * 0; }
+inline int f2791_1(int x) { return x * 1; }
+inline int f2791_2(int x) { return x * 2; }
+inline int f2791_3(int x) { return x * 3; }
+inline int f2791_4(int x) { return x * 4; }
+inline int f2791_5(int x) { return x * 5; }
+inline int f2791_6(int x) { return x * 6; }
+inline int f2791_7(int x) { return x * 7; }
+inline int f2791_8(int x) { return x * 8; }
+inline int f2791_9(int x) { return x * 9; }
+inline int f2791_10(int x) { return x * 10; }
+inline int f2791_11(int x) { return x * 11; }
+inline int f2791_12(int x) { return x * 12; }
+inline int f2791_13(int x) { return x * 13; }
+inline int f2791_14(int x) { return x * 14; }
+inline int f2791_15(int x) { return x * 15; }
+inline int f2791_16(int x) { return x * 16; }
+inline int f2791_17(int x) { return x * 17; }
+inline int f2791_18(int x) { return x * 18; }
+inline int f2791_19(int x) { return x * 19; }
+inline int f2791_20(int x) { return x * 20; }
+inline int f2791_21(int x) { return x * 21; }
+inline int f2791_22(int x) { return x * 22; }
+inline int f2791_23(int x) { return x * 23; }
+inline int f2791_24(int x) { return x * 24; }
+inline int f2791_25(int x) { return x * 25; }
+inline int f2791_26(int x) { return x * 26; }
+inline int f2791_27(int x) { return x * 27; }
+inline int f2791_28(int x) { return x * 28; }
+inline int f2791_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2792 */
+#include <vector>
+#include "h4961.h"
+#include "h5356.h"
+#include "h3725.h"
+#include "h1491.h"
+#include "h6035.h"
+#ifdef X
+#include "h226.h"
+#endif
+struct S2792 { int a; const char *s = "x//y"; };
+inline int f2792_0(int x) { return x * 0; }
+inline int f2792_1(int x) { return x * 1; }
+inline int f2792_2(int x) { return x * 2; }
+inline int f2792_3(int x) { return x * 3; }
+inline int f2792_4(int x) { return x * 4; }
+inline int f2792_5(int x) { return x * 5; }
+inline int f2792_6(int x) { return x * 6; }
+inline int f2792_7(int x) { return x * 7; }
+inline int f2792_8(int x) { return x * 8; }
+inline int f2792_9(int x) { return x * 9; }
+inline int f2792_10(int x) { return x * 10; }
+inline int f2792_11(int x) { return x * 11; }
+inline int f2792_12(int x) { return x * 12; }
+inline int f2792_13(int x) { return x * 13; }
+inline int f2792_14(int x) { return x * 14; }
+inline int f2792_15(int x) { return x * 15; }
+inline int f2792_16(int x) { return x * 16; }
+inline int f2792_17(int x) { return x * 17; }
+inline int f2792_18(int x) { return x * 18; }
+inline int f2792_19(int x) { return x * 19; }
+inline int f2792_20(int x) { return x * 20; }
+inline int f2792_21(int x) { return x * 21; }
+inline int f2792_22(int x) { return x * 22; }
+inline int f2792_23(int x) { return x * 23; }
+inline int f2792_24(int x) { return x * 24; }
+inline int f2792_25(int x) { return x * 25; }
+inline int f2792_26(int x) { return x * 26; }
+inline int f2792_27(int x) { return x * 27; }
+inline int f2792_28(int x) { return x * 28; }
+inline int f2792_29(int x) { return x * 29; }
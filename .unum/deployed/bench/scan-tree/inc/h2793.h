@@ -0,0 +1,42 @@
+#pragma once
+/* header 2793 */
+#include <vector>
+#include "h9240.h"
+#include "h2554.h"
+#include "h3873.h"
+#include "h9378.h"
+#include "h9299.h"
+#ifdef X
+#include "h8774.h"
+#endif
+struct S2793 { int a; const char *s = "x//y"; };
+inline int f2793_0(int x) { return x * 0; }
+inline int f2793_1(int x) { return x * 1; }
+inline int f2793_2(int x) { return x * 2; }
+inline int f2793_3(int x) { return x * 3; }
+inline int f2793_4(int x) { return x * 4; }
+inline int f2793_5(int x) { return x * 5; }
+inline int f2793_6(int x) { return x * 6; }
+inline int f2793_7(int x) { return x * 7; }
+inline int f2793_8(int x) { return x * 8; }
+inline int f2793_9(int x) { return x * 9; }
+inline int f2793_10(int x) { return x * 10; }
+inline int f2793_11(int x) { return x * 11; }
+inline int f2793_12(int x) { return x * 12; }
+inline int f2793_13(int x) { return x * 13; }
+inline int f2793_14(int x) { return x * 14; }
+inline int f2793_15(int x) { return x * 15; }
+inline int f2793_16(int x) { return x * 16; }
+inline int f2793_17(int x) { return x * 17; }
+inline int f2793_18(int x) { return x * 18; }
+inline int f2793_19(int x) { return x * 19; }
+inline int f2793_20(int x) { return x * 20; }
+inline int f2793_21(int x) { return x * 21; }
+inline int f2793_22(int x) { return x * 22; }
+inline int f2793_23(int x) { return x * 23; }
+inline int f2793_24(int x) { return x * 24; }
+inline int f2793_25(int x) { return x * 25; }
+inline int f2793_26(int x) { return x * 26; }
+inline int f2793_27(int x) { return x * 27; }
+inline int f2793_28(int x) { return x * 28; }
+inline int f2793_29(int x) { return x * 29; }
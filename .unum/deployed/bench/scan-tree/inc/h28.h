@@ -0,0 +1,42 @@
+#pragma once
+/* header 28 */
+#include <vector>
+#include "h8254.h"
+#include "h4015.h"
+#include "h1073.h"
+#include "h9267.h"
+#include "h6126.h"
+#ifdef X
+#include "h3352.h"
+#endif
+struct S28 { int a; const char *s = "x//y"; };
+inline int f28_0(int x) { return x * 0; }
+inline int f28_1(int x) { return x * 1; }
+inline int f28_2(int x) { return x * 2; }
+inline int f28_3(int x) { return x * 3; }
+inline int f28_4(int x) { return x * 4; }
+inline int f28_5(int x) { return x * 5; }
+inline int f28_6(int x) { return x * 6; }
+inline int f28_7(int x) { return x * 7; }
+inline int f28_8(int x) { return x * 8; }
+inline int f28_9(int x) { return x * 9; }
+inline int f28_10(int x) { return x * 10; }
+inline int f28_11(int x) { return x * 11; }
+inline int f28_12(int x) { return x * 12; }
+inline int f28_13(int x) { return x * 13; }
+inline int f28_14(int x) { return x * 14; }
+inline int f28_15(int x) { return x * 15; }
+inline int f28_16(int x) { return x * 16; }
+inline int f28_17(int x) { return x * 17; }
+inline int f28_18(int x) { return x * 18; }
+inline int f28_19(int x) { return x * 19; }
+inline int f28_20(int x) { return x * 20; }
+inline int f28_21(int x) { return x * 21; }
+inline int f28_22(int x) { return x * 22; }
+inline int f28_23(int x) { return x * 23; }
+inline int f28_24(int x) { return x * 24; }
+inline int f28_25(int x) { return x * 25; }
+inline int f28_26(int x) { return x * 26; }
+inline int f28_27(int x) { return x * 27; }
+inline int f28_28(int x) { return x * 28; }
+inline int f28_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2802 */
+#include <vector>
+#include "h5840.h"
+#include "h8943.h"
+#include "h1340.h"
+#include "h8606.h"
+#include "h5014.h"
+#ifdef X
+#include "h1431.h"
+#endif
+struct S2802 { int a; const char *s = "x//y"; };
+inline int f2802_0(int x) { return x * 0; }
+inline int f2802_1(int x) { return x * 1; }
+inline int f2802_2(int x) { return x * 2; }
+inline int f2802_3(int x) { return x * 3; }
+inline int f2802_4(int x) { return x * 4; }
+inline int f2802_5(int x) { return x * 5; }
+inline int f2802_6(int x) { return x * 6; }
+inline int f2802_7(int x) { return x * 7; }
+inline int f2802_8(int x) { return x * 8; }
+inline int f2802_9(int x) { return x * 9; }
+inline int f2802_10(int x) { return x * 10; }
+inline int f2802_11(int x) { return x * 11; }
+inline int f2802_12(int x) { return x * 12; }
+inline int f2802_13(int x) { return x * 13; }
+inline int f2802_14(int x) { return x * 14; }
+inline int f2802_15(int x) { return x * 15; }
+inline int f2802_16(int x) { return x * 16; }
+inline int f2802_17(int x) { return x * 17; }
+inline int f2802_18(int x) { return x * 18; }
+inline int f2802_19(int x) { return x * 19; }
+inline int f2802_20(int x) { return x * 20; }
+inline int f2802_21(int x) { return x * 21; }
+inline int f2802_22(int x) { return x * 22; }
+inline int f2802_23(int x) { return x * 23; }
+inline int f2802_24(int x) { return x * 24; }
+inline int f2802_25(int x) { return x * 25; }
+inline int f2802_26(int x) { return x * 26; }
+inline int f2802_27(int x) { return x * 27; }
+inline int f2802_28(int x) { return x * 28; }
+inline int f2802_29(int x) { return x * 29; }
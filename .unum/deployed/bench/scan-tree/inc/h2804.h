@@ -0,0 +1,42 @@
+#pragma once
+/* header 2804 */
+#include <vector>
+#include "h6630.h"
+#include "h2320.h"
+#include "h412.h"
+#include "h9032.h"
+#include "h7945.h"
+#ifdef X
+#include "h7412.h"
+#endif
+struct S2804 { int a; const char *s = "x//y"; };
+inline int f2804_0(int x) { return x * 0; }
+inline int f2804_1(int x) { return x * 1; }
+inline int f2804_2(int x) { return x * 2; }
+inline int f2804_3(int x) { return x * 3; }
+inline int f2804_4(int x) { return x * 4; }
+inline int f2804_5(int x) { return x * 5; }
+inline int f2804_6(int x) { return x * 6; }
+inline int f2804_7(int x) { return x * 7; }
+inline int f2804_8(int x) { return x * 8; }
+inline int f2804_9(int x) { return x * 9; }
+inline int f2804_10(int x) { return x * 10; }
+inline int f2804_11(int x) { return x * 11; }
+inline int f2804_12(int x) { return x * 12; }
+inline int f2804_13(int x) { return x * 13; }
+inline int f2804_14(int x) { return x * 14; }
+inline int f2804_15(int x) { return x * 15; }
+inline int f2804_16(int x) { return x * 16; }
+inline int f2804_17(int x) { return x * 17; }
+inline int f2804_18(int x) { return x * 18; }
+inline int f2804_19(int x) { return x * 19; }
+inline int f2804_20(int x) { return x * 20; }
+inline int f2804_21(int x) { return x * 21; }
+inline int f2804_22(int x) { return x * 22; }
+inline int f2804_23(int x) { return x * 23; }
+inline int f2804_24(int x) { return x * 24; }
+inline int f2804_25(int x) { return x * 25; }
+inline int f2804_26(int x) { return x * 26; }
+inline int f2804_27(int x) { return x * 27; }
+inline int f2804_28(int x) { return x * 28; }
+inline int f2804_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2811 */
+#include <vector>
+#include "h6312.h"
+#include "h8875.h"
+#include "h5365.h"
+#include "h473.h"
+#include "h2039.h"
+#ifdef X
+#include "h1330.h"
+#endif
+struct S2811 { int a; const char *s = "x//y"; };
+inline int f2811_0(int x) { return x * 0; }
+inline int f2811_1(int x) { return x * 1; }
+inline int f2811_2(int x) { return x * 2; }
+inline int f2811_3(int x) { return x * 3; }
+inline int f2811_4(int x) { return x * 4; }
+inline int f2811_5(int x) { return x * 5; }
+inline int f2811_6(int x) { return x * 6; }
+inline int f2811_7(int x) { return x * 7; }
+inline int f2811_8(int x) { return x * 8; }
+inline int f2811_9(int x) { return x * 9; }
+inline int f2811_10(int x) { return x * 10; }
+inline int f2811_11(int x) { return x * 11; }
+inline int f2811_12(int x) { return x * 12; }
+inline int f2811_13(int x) { return x * 13; }
+inline int f2811_14(int x) { return x * 14; }
+inline int f2811_15(int x) { return x * 15; }
+inline int f2811_16(int x) { return x * 16; }
+inline int f2811_17(int x) { return x * 17; }
+inline int f2811_18(int x) { return x * 18; }
+inline int f2811_19(int x) { return x * 19; }
+inline int f2811_20(int x) { return x * 20; }
+inline int f2811_21(int x) { return x * 21; }
+inline int f2811_22(int x) { return x * 22; }
+inline int f2811_23(int x) { return x * 23; }
+inline int f2811_24(int x) { return x * 24; }
+inline int f2811_25(int x) { return x * 25; }
+inline int f2811_26(int x) { return x * 26; }
+inline int f2811_27(int x) { return x * 27; }
+inline int f2811_28(int x) { return x * 28; }
+inline int f2811_29(int x) { return x * 29; }
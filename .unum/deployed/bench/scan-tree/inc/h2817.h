@@ -0,0 +1,42 @@
+#pragma once
+/* header 2817 */
+#include <vector>
+#include "h3574.h"
+#include "h7438.h"
+#include "h804.h"
+#include "h1981.h"
+#include "h1636.h"
+#ifdef X
+#include "h8507.h"
+#endif
+struct S2817 { int a; const char *s = "x//y"; };
+inline int f2817_0(int x) { return x * 0; }
+inline int f2817_1(int x) { return x * 1; }
+inline int f2817_2(int x) { return x * 2; }
+inline int f2817_3(int x) { return x * 3; }
+inline int f2817_4(int x) { return x * 4; }
+inline int f2817_5(int x) { return x * 5; }
+inline int f2817_6(int x) { return x * 6; }
+inline int f2817_7(int x) { return x * 7; }
+inline int f2817_8(int x) { return x * 8; }
+inline int f2817_9(int x) { return x * 9; }
+inline int f2817_10(int x) { return x * 10; }
+inline int f2817_11(int x) { return x * 11; }
+inline int f2817_12(int x) { return x * 12; }
+inline int f2817_13(int x) { return x * 13; }
+inline int f2817_14(int x) { return x * 14; }
+inline int f2817_15(int x) { return x * 15; }
+inline int f2817_16(int x) { return x * 16; }
+inline int f2817_17(int x) { return x * 17; }
+inline int f2817_18(int x) { return x * 18; }
+inline int f2817_19(int x) { return x * 19; }
+inline int f2817_20(int x) { return x * 20; }
+inline int f2817_21(int x) { return x * 21; }
+inline int f2817_22(int x) { return x * 22; }
+inline int f2817_23(int x) { return x * 23; }
+inline int f2817_24(int x) { return x * 24; }
+inline int f2817_25(int x) { return x * 25; }
+inline int f2817_26(int x) { return x * 26; }
+inline int f2817_27(int x) { return x * 27; }
+inline int f2817_28(int x) { return x * 28; }
+inline int f2817_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 282 */
+#include <vector>
+#include "h4988.h"
+#include "h6618.h"
+#include "h473.h"
+#include "h746.h"
+#include "h6525.h"
+#ifdef X
+#include "h5236.h"
+#endif
+struct S282 { int a; const char *s = "x//y"; };
+inline int f282_0(int x) { return x * 0; }
+inline int f282_1(int x) { return x * 1; }
+inline int f282_2(int x) { return x * 2; }
+inline int f282_3(int x) { return x * 3; }
+inline int f282_4(int x) { return x * 4; }
+inline int f282_5(int x) { return x * 5; }
+inline int f282_6(int x) { return x * 6; }
+inline int f282_7(int x) { return x * 7; }
+inline int f282_8(int x) { return x * 8; }
+inline int f282_9(int x) { return x * 9; }
+inline int f282_10(int x) { return x * 10; }
+inline int f282_11(int x) { return x * 11; }
+inline int f282_12(int x) { return x * 12; }
+inline int f282_13(int x) { return x * 13; }
+inline int f282_14(int x) { return x * 14; }
+inline int f282_15(int x) { return x * 15; }
+inline int f282_16(int x) { return x * 16; }
+inline int f282_17(int x) { return x * 17; }
+inline int f282_18(int x) { return x * 18; }
+inline int f282_19(int x) { return x * 19; }
+inline int f282_20(int x) { return x * 20; }
+inline int f282_21(int x) { return x * 21; }
+inline int f282_22(int x) { return x * 22; }
+inline int f282_23(int x) { return x * 23; }
+inline int f282_24(int x) { return x * 24; }
+inline int f282_25(int x) { return x * 25; }
+inline int f282_26(int x) { return x * 26; }
+inline int f282_27(int x) { return x * 27; }
+inline int f282_28(int x) { return x * 28; }
+inline int f282_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2821 */
+#include <vector>
+#include "h2159.h"
+#include "h7745.h"
+#include "h4686.h"
+#include "h7207.h"
+#include "h5428.h"
+#ifdef X
+#include "h1589.h"
+#endif
+struct S2821 { int a; const char *s = "x//y"; };
+inline int f2821_0(int x) { return x * 0; }
+inline int f2821_1(int x) { return x * 1; }
+inline int f2821_2(int x) { return x * 2; }
+inline int f2821_3(int x) { return x * 3; }
+inline int f2821_4(int x) { return x * 4; }
+inline int f2821_5(int x) { return x * 5; }
+inline int f2821_6(int x) { return x * 6; }
+inline int f2821_7(int x) { return x * 7; }
+inline int f2821_8(int x) { return x * 8; }
+inline int f2821_9(int x) { return x * 9; }
+inline int f2821_10(int x) { return x * 10; }
+inline int f2821_11(int x) { return x * 11; }
+inline int f2821_12(int x) { return x * 12; }
+inline int f2821_13(int x) { return x * 13; }
+inline int f2821_14(int x) { return x * 14; }
+inline int f2821_15(int x) { return x * 15; }
+inline int f2821_16(int x) { return x * 16; }
+inline int f2821_17(int x) { return x * 17; }
+inline int f2821_18(int x) { return x * 18; }
+inline int f2821_19(int x) { return x * 19; }
+inline int f2821_20(int x) { return x * 20; }
+inline int f2821_21(int x) { return x * 21; }
+inline int f2821_22(int x) { return x * 22; }
+inline int f2821_23(int x) { return x * 23; }
+inline int f2821_24(int x) { return x * 24; }
+inline int f2821_25(int x) { return x * 25; }
+inline int f2821_26(int x) { return x * 26; }
+inline int f2821_27(int x) { return x * 27; }
+inline int f2821_28(int x) { return x * 28; }
+inline int f2821_29(int x) { return x * 29; }
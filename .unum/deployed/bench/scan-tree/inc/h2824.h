@@ -0,0 +1,42 @@
+#pragma once
+/* header 2824 */
+#include <vector>
+#include "h1589.h"
+#include "h5798.h"
+#include "h3403.h"
+#include "h6621.h"
+#include "h5689.h"
+#ifdef X
+#include "h3387.h"
+#endif
+struct S2824 { int a; const char *s = "x//y"; };
+inline int f2824_0(int x) { return x * 0; }
+inline int f2824_1(int x) { return x * 1; }
+inline int f2824_2(int x) { return x * 2; }
+inline int f2824_3(int x) { return x * 3; }
+inline int f2824_4(int x) { return x * 4; }
+inline int f2824_5(int x) { return x * 5; }
+inline int f2824_6(int x) { return x * 6; }
+inline int f2824_7(int x) { return x * 7; }
+inline int f2824_8(int x) { return x * 8; }
+inline int f2824_9(int x) { return x * 9; }
+inline int f2824_10(int x) { return x * 10; }
+inline int f2824_11(int x) { return x * 11; }
+inline int f2824_12(int x) { return x * 12; }
+inline int f2824_13(int x) { return x * 13; }
+inline int f2824_14(int x) { return x * 14; }
+inline int f2824_15(int x) { return x * 15; }
+inline int f2824_16(int x) { return x * 16; }
+inline int f2824_17(int x) { return x * 17; }
+inline int f2824_18(int x) { return x * 18; }
+inline int f2824_19(int x) { return x * 19; }
+inline int f2824_20(int x) { return x * 20; }
+inline int f2824_21(int x) { return x * 21; }
+inline int f2824_22(int x) { return x * 22; }
+inline int f2824_23(int x) { return x * 23; }
+inline int f2824_24(int x) { return x * 24; }
+inline int f2824_25(int x) { return x * 25; }
+inline int f2824_26(int x) { return x * 26; }
+inline int f2824_27(int x) { return x * 27; }
+inline int f2824_28(int x) { return x * 28; }
+inline int f2824_29(int x) { return x * 29; }
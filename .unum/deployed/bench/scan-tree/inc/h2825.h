@@ -0,0 +1,42 @@
+#pragma once
+/* header 2825 */
+#include <vector>
+#include "h3711.h"
+#include "h6879.h"
+#include "h8883.h"
+#include "h9499.h"
+#include "h2230.h"
+#ifdef X
+#include "h2571.h"
+#endif
+struct S2825 { int a; const char *s = "x//y"; };
+inline int f2825_0(int x) { return x * 0; }
+inline int f2825_1(int x) { return x * 1; }
+inline int f2825_2(int x) { return x * 2; }
+inline int f2825_3(int x) { return x * 3; }
+inline int f2825_4(int x) { return x * 4; }
+inline int f2825_5(int x) { return x * 5; }
+inline int f2825_6(int x) { return x * 6; }
+inline int f2825_7(int x) { return x * 7; }
+inline int f2825_8(int x) { return x * 8; }
+inline int f2825_9(int x) { return x * 9; }
+inline int f2825_10(int x) { return x * 10; }
+inline int f2825_11(int x) { return x * 11; }
+inline int f2825_12(int x) { return x * 12; }
+inline int f2825_13(int x) { return x * 13; }
+inline int f2825_14(int x) { return x * 14; }
+inline int f2825_15(int x) { return x * 15; }
+inline int f2825_16(int x) { return x * 16; }
+inline int f2825_17(int x) { return x * 17; }
+inline int f2825_18(int x) { return x * 18; }
+inline int f2825_19(int x) { return x * 19; }
+inline int f2825_20(int x) { return x * 20; }
+inline int f2825_21(int x) { return x * 21; }
+inline int f2825_22(int x) { return x * 22; }
+inline int f2825_23(int x) { return x * 23; }
+inline int f2825_24(int x) { return x * 24; }
+inline int f2825_25(int x) { return x * 25; }
+inline int f2825_26(int x) { return x * 26; }
+inline int f2825_27(int x) { return x * 27; }
+inline int f2825_28(int x) { return x * 28; }
+inline int f2825_29(int x) { return x * 29; }
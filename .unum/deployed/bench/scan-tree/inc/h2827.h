@@ -0,0 +1,42 @@
+#pragma once
+/* header 2827 */
+#include <vector>
+#include "h2653.h"
+#include "h8872.h"
+#include "h5665.h"
+#include "h5282.h"
+#include "h3232.h"
+#ifdef X
+#include "h1890.h"
+#endif
+struct S2827 { int a; const char *s = "x//y"; };
+inline int f2827_0(int x) { return x * 0; }
+inline int f2827_1(int x) { return x * 1; }
+inline int f2827_2(int x) { return x * 2; }
+inline int f2827_3(int x) { return x * 3; }
+inline int f2827_4(int x) { return x * 4; }
+inline int f2827_5(int x) { return x * 5; }
+inline int f2827_6(int x) { return x * 6; }
+inline int f2827_7(int x) { return x * 7; }
+inline int f2827_8(int x) { return x * 8; }
+inline int f2827_9(int x) { return x * 9; }
+inline int f2827_10(int x) { return x * 10; }
+inline int f2827_11(int x) { return x * 11; }
+inline int f2827_12(int x) { return x * 12; }
+inline int f2827_13(int x) { return x * 13; }
+inline int f2827_14(int x) { return x * 14; }
+inline int f2827_15(int x) { return x * 15; }
+inline int f2827_16(int x) { return x * 16; }
+inline int f2827_17(int x) { return x * 17; }
+inline int f2827_18(int x) { return x * 18; }
+inline int f2827_19(int x) { return x * 19; }
+inline int f2827_20(int x) { return x * 20; }
+inline int f2827_21(int x) { return x * 21; }
+inline int f2827_22(int x) { return x * 22; }
+inline int f2827_23(int x) { return x * 23; }
+inline int f2827_24(int x) { return x * 24; }
+inline int f2827_25(int x) { return x * 25; }
+inline int f2827_26(int x) { return x * 26; }
+inline int f2827_27(int x) { return x * 27; }
+inline int f2827_28(int x) { return x * 28; }
+inline int f2827_29(int x) { return x * 29; }
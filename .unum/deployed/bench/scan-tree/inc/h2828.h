@@ -0,0 +1,42 @@
+#pragma once
+/* header 2828 */
+#include <vector>
+#include "h8642.h"
+#include "h5060.h"
+#include "h9369.h"
+#include "h7698.h"
+#include "h4399.h"
+#ifdef X
+#include "h5475.h"
+#endif
+struct S2828 { int a; const char *s = "x//y"; };
+inline int f2828_0(int x) { return x * 0; }
+inline int f2828_1(int x) { return x * 1; }
+inline int f2828_2(int x) { return x * 2; }
+inline int f2828_3(int x) { return x * 3; }
+inline int f2828_4(int x) { return x * 4; }
+inline int f2828_5(int x) { return x * 5; }
+inline int f2828_6(int x) { return x * 6; }
+inline int f2828_7(int x) { return x * 7; }
+inline int f2828_8(int x) { return x * 8; }
+inline int f2828_9(int x) { return x * 9; }
+inline int f2828_10(int x) { return x * 10; }
+inline int f2828_11(int x) { return x * 11; }
+inline int f2828_12(int x) { return x * 12; }
+inline int f2828_13(int x) { return x * 13; }
+inline int f2828_14(int x) { return x * 14; }
+inline int f2828_15(int x) { return x * 15; }
+inline int f2828_16(int x) { return x * 16; }
+inline int f2828_17(int x) { return x * 17; }
+inline int f2828_18(int x) { return x * 18; }
+inline int f2828_19(int x) { return x * 19; }
+inline int f2828_20(int x) { return x * 20; }
+inline int f2828_21(int x) { return x * 21; }
+inline int f2828_22(int x) { return x * 22; }
+inline int f2828_23(int x) { return x * 23; }
+inline int f2828_24(int x) { return x * 24; }
+inline int f2828_25(int x) { return x * 25; }
+inline int f2828_26(int x) { return x * 26; }
+inline int f2828_27(int x) { return x * 27; }
+inline int f2828_28(int x) { return x * 28; }
+inline int f2828_29(int x) { return x * 29; }
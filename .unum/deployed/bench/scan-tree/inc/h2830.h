@@ -0,0 +1,42 @@
+#pragma once
+/* header 2830 */
+#include <vector>
+#include "h3150.h"
+#include "h1455.h"
+#include "h7499.h"
+#include "h4393.h"
+#include "h7705.h"
+#ifdef X
+#include "h4718.h"
+#endif
+struct S2830 { int a; const char *s = "x//y"; };
+inline int f2830_0(int x) { return x * 0; }
+inline int f2830_1(int x) { return x * 1; }
+inline int f2830_2(int x) { return x * 2; }
+inline int f2830_3(int x) { return x * 3; }
+inline int f2830_4(int x) { return x * 4; }
+inline int f2830_5(int x) { return x * 5; }
+inline int f2830_6(int x) { return x * 6; }
+inline int f2830_7(int x) { return x * 7; }
+inline int f2830_8(int x) { return x * 8; }
+inline int f2830_9(int x) { return x * 9; }
+inline int f2830_10(int x) { return x * 10; }
+inline int f2830_11(int x) { return x * 11; }
+inline int f2830_12(int x) { return x * 12; }
+inline int f2830_13(int x) { return x * 13; }
+inline int f2830_14(int x) { return x * 14; }
+inline int f2830_15(int x) { return x * 15; }
+inline int f2830_16(int x) { return x * 16; }
+inline int f2830_17(int x) { return x * 17; }
+inline int f2830_18(int x) { return x * 18; }
+inline int f2830_19(int x) { return x * 19; }
+inline int f2830_20(int x) { return x * 20; }
+inline int f2830_21(int x) { return x * 21; }
+inline int f2830_22(int x) { return x * 22; }
+inline int f2830_23(int x) { return x * 23; }
+inline int f2830_24(int x) { return x * 24; }
+inline int f2830_25(int x) { return x * 25; }
+inline int f2830_26(int x) { return x * 26; }
+inline int f2830_27(int x) { return x * 27; }
+inline int f2830_28(int x) { return x * 28; }
+inline int f2830_29(int x) { return x * 29; }
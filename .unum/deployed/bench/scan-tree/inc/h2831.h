@@ -0,0 +1,42 @@
+#pragma once
+/* header 2831 */
+#include <vector>
+#include "h5831.h"
+#include "h9338.h"
+#include "h6562.h"
+#include "h2393.h"
+#include "h5588.h"
+#ifdef X
+#include "h8165.h"
+#endif
+struct S2831 { int a; const char *s = "x//y"; };
+inline int f2831_0(int x) { return x * 0; }
+inline int f2831_1(int x) { return x * 1; }
+inline int f2831_2(int x) { return x * 2; }
+inline int f2831_3(int x) { return x * 3; }
+inline int f2831_4(int x) { return x * 4; }
+inline int f2831_5(int x) { return x * 5; }
+inline int f2831_6(int x) { return x * 6; }
+inline int f2831_7(int x) { return x * 7; }
+inline int f2831_8(int x) { return x * 8; }
+inline int f2831_9(int x) { return x * 9; }
+inline int f2831_10(int x) { return x * 10; }
+inline int f2831_11(int x) { return x * 11; }
+inline int f2831_12(int x) { return x * 12; }
+inline int f2831_13(int x) { return x * 13; }
+inline int f2831_14(int x) { return x * 14; }
+inline int f2831_15(int x) { return x * 15; }
+inline int f2831_16(int x) { return x * 16; }
+inline int f2831_17(int x) { return x * 17; }
+inline int f2831_18(int x) { return x * 18; }
+inline int f2831_19(int x) { return x * 19; }
+inline int f2831_20(int x) { return x * 20; }
+inline int f2831_21(int x) { return x * 21; }
+inline int f2831_22(int x) { return x * 22; }
+inline int f2831_23(int x) { return x * 23; }
+inline int f2831_24(int x) { return x * 24; }
+inline int f2831_25(int x) { return x * 25; }
+inline int f2831_26(int x) { return x * 26; }
+inline int f2831_27(int x) { return x * 27; }
+inline int f2831_28(int x) { return x * 28; }
+inline int f2831_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2832 */
+#include <vector>
+#include "h2158.h"
+#include "h2931.h"
+#include "h1092.h"
+#include "h7120.h"
+#include "h2984.h"
+#ifdef X
+#include "h7796.h"
+#endif
+struct S2832 { int a; const char *s = "x//y"; };
+inline int f2832_0(int x) { return x * 0; }
+inline int f2832_1(int x) { return x * 1; }
+inline int f2832_2(int x) { return x * 2; }
+inline int f2832_3(int x) { return x * 3; }
+inline int f2832_4(int x) { return x * 4; }
+inline int f2832_5(int x) { return x * 5; }
+inline int f2832_6(int x) { return x * 6; }
+inline int f2832_7(int x) { return x * 7; }
+inline int f2832_8(int x) { return x * 8; }
+inline int f2832_9(int x) { return x * 9; }
+inline int f2832_10(int x) { return x * 10; }
+inline int f2832_11(int x) { return x * 11; }
+inline int f2832_12(int x) { return x * 12; }
+inline int f2832_13(int x) { return x * 13; }
+inline int f2832_14(int x) { return x * 14; }
+inline int f2832_15(int x) { return x * 15; }
+inline int f2832_16(int x) { return x * 16; }
+inline int f2832_17(int x) { return x * 17; }
+inline int f2832_18(int x) { return x * 18; }
+inline int f2832_19(int x) { return x * 19; }
+inline int f2832_20(int x) { return x * 20; }
+inline int f2832_21(int x) { return x * 21; }
+inline int f2832_22(int x) { return x * 22; }
+inline int f2832_23(int x) { return x * 23; }
+inline int f2832_24(int x) { return x * 24; }
+inline int f2832_25(int x) { return x * 25; }
+inline int f2832_26(int x) { return x * 26; }
+inline int f2832_27(int x) { return x * 27; }
+inline int f2832_28(int x) { return x * 28; }
+inline int f2832_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2833 */
+#include <vector>
+#include "h5487.h"
+#include "h9598.h"
+#include "h1965.h"
+#include "h7002.h"
+#include "h5285.h"
+#ifdef X
+#include "h20.h"
+#endif
+struct S2833 { int a; const char *s = "x//y"; };
+inline int f2833_0(int x) { return x * 0; }
+inline int f2833_1(int x) { return x * 1; }
+inline int f2833_2(int x) { return x * 2; }
+inline int f2833_3(int x) { return x * 3; }
+inline int f2833_4(int x) { return x * 4; }
+inline int f2833_5(int x) { return x * 5; }
+inline int f2833_6(int x) { return x * 6; }
+inline int f2833_7(int x) { return x * 7; }
+inline int f2833_8(int x) { return x * 8; }
+inline int f2833_9(int x) { return x * 9; }
+inline int f2833_10(int x) { return x * 10; }
+inline int f2833_11(int x) { return x * 11; }
+inline int f2833_12(int x) { return x * 12; }
+inline int f2833_13(int x) { return x * 13; }
+inline int f2833_14(int x) { return x * 14; }
+inline int f2833_15(int x) { return x * 15; }
+inline int f2833_16(int x) { return x * 16; }
+inline int f2833_17(int x) { return x * 17; }
+inline int f2833_18(int x) { return x * 18; }
+inline int f2833_19(int x) { return x * 19; }
+inline int f2833_20(int x) { return x * 20; }
+inline int f2833_21(int x) { return x * 21; }
+inline int f2833_22(int x) { return x * 22; }
+inline int f2833_23(int x) { return x * 23; }
+inline int f2833_24(int x) { return x * 24; }
+inline int f2833_25(int x) { return x * 25; }
+inline int f2833_26(int x) { return x * 26; }
+inline int f2833_27(int x) { return x * 27; }
+inline int f2833_28(int x) { return x * 28; }
+inline int f2833_29(int x) { return x * 29; }
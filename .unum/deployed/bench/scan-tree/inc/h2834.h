@@ -0,0 +1,42 @@
+#pragma once
+/* header 2834 */
+#include <vector>
+#include "h6005.h"
+#include "h9017.h"
+#include "h958.h"
+#include "h3821.h"
+#include "h3052.h"
+#ifdef X
+#include "h9733.h"
+#endif
+struct S2834 { int a; const char *s = "x//y"; };
+inline int f2834_0(int x) { return x * 0; }
+inline int f2834_1(int x) { return x * 1; }
+inline int f2834_2(int x) { return x * 2; }
+inline int f2834_3(int x) { return x * 3; }
+inline int f2834_4(int x) { return x * 4; }
+inline int f2834_5(int x) { return x * 5; }
+inline int f2834_6(int x) { return x * 6; }
+inline int f2834_7(int x) { return x * 7; }
+inline int f2834_8(int x) { return x * 8; }
+inline int f2834_9(int x) { return x * 9; }
+inline int f2834_10(int x) { return x * 10; }
+inline int f2834_11(int x) { return x * 11; }
+inline int f2834_12(int x) { return x * 12; }
+inline int f2834_13(int x) { return x * 13; }
+inline int f2834_14(int x) { return x * 14; }
+inline int f2834_15(int x) { return x * 15; }
+inline int f2834_16(int x) { return x * 16; }
+inline int f2834_17(int x) { return x * 17; }
+inline int f2834_18(int x) { return x * 18; }
+inline int f2834_19(int x) { return x * 19; }
+inline int f2834_20(int x) { return x * 20; }
+inline int f2834_21(int x) { return x * 21; }
+inline int f2834_22(int x) { return x * 22; }
+inline int f2834_23(int x) { return x * 23; }
+inline int f2834_24(int x) { return x * 24; }
+inline int f2834_25(int x) { return x * 25; }
+inline int f2834_26(int x) { return x * 26; }
+inline int f2834_27(int x) { return x * 27; }
+inline int f2834_28(int x) { return x * 28; }
+inline int f2834_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2835 */
+#include <vector>
+#include "h9225.h"
+#include "h9485.h"
+#include "h467.h"
+#include "h6963.h"
+#include "h6587.h"
+#ifdef X
+#include "h9926.h"
+#endif
+struct S2835 { int a; const char *s = "x//y"; };
+inline int f2835_0(int x) { return x * 0; }
+inline int f2835_1(int x) { return x * 1; }
+inline int f2835_2(int x) { return x * 2; }
+inline int f2835_3(int x) { return x * 3; }
+inline int f2835_4(int x) { return x * 4; }
+inline int f2835_5(int x) { return x * 5; }
+inline int f2835_6(int x) { return x * 6; }
+inline int f2835_7(int x) { return x * 7; }
+inline int f2835_8(int x) { return x * 8; }
+inline int f2835_9(int x) { return x * 9; }
+inline int f2835_10(int x) { return x * 10; }
+inline int f2835_11(int x) { return x * 11; }
+inline int f2835_12(int x) { return x * 12; }
+inline int f2835_13(int x) { return x * 13; }
+inline int f2835_14(int x) { return x * 14; }
+inline int f2835_15(int x) { return x * 15; }
+inline int f2835_16(int x) { return x * 16; }
+inline int f2835_17(int x) { return x * 17; }
+inline int f2835_18(int x) { return x * 18; }
+inline int f2835_19(int x) { return x * 19; }
+inline int f2835_20(int x) { return x * 20; }
+inline int f2835_21(int x) { return x * 21; }
+inline int f2835_22(int x) { return x * 22; }
+inline int f2835_23(int x) { return x * 23; }
+inline int f2835_24(int x) { return x * 24; }
+inline int f2835_25(int x) { return x * 25; }
+inline int f2835_26(int x) { return x * 26; }
+inline int f2835_27(int x) { return x * 27; }
+inline int f2835_28(int x) { return x * 28; }
+inline int f2835_29(int x) { return x * 29; }
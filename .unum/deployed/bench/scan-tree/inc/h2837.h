@@ -0,0 +1,42 @@
+#pragma once
+/* header 2837 */
+#include <vector>
+#include "h9061.h"
+#include "h2150.h"
+#include "h7482.h"
+#include "h4026.h"
+#include "h6501.h"
+#ifdef X
+#include "h7695.h"
+#endif
+struct S2837 { int a; const char *s = "x//y"; };
+inline int f2837_0(int x) { return x * 0; }
+inline int f2837_1(int x) { return x * 1; }
+inline int f2837_2(int x) { return x * 2; }
+inline int f2837_3(int x) { return x * 3; }
+inline int f2837_4(int x) { return x * 4; }
+inline int f2837_5(int x) { return x * 5; }
+inline int f2837_6(int x) { return x * 6; }
+inline int f2837_7(int x) { return x * 7; }
+inline int f2837_8(int x) { return x * 8; }
+inline int f2837_9(int x) { return x * 9; }
+inline int f2837_10(int x) { return x * 10; }
+inline int f2837_11(int x) { return x * 11; }
+inline int f2837_12(int x) { return x * 12; }
+inline int f2837_13(int x) { return x * 13; }
+inline int f2837_14(int x) { return x * 14; }
+inline int f2837_15(int x) { return x * 15; }
+inline int f2837_16(int x) { return x * 16; }
+inline int f2837_17(int x) { return x * 17; }
+inline int f2837_18(int x) { return x * 18; }
+inline int f2837_19(int x) { return x * 19; }
+inline int f2837_20(int x) { return x * 20; }
+inline int f2837_21(int x) { return x * 21; }
+inline int f2837_22(int x) { return x * 22; }
+inline int f2837_23(int x) { return x * 23; }
+inline int f2837_24(int x) { return x * 24; }
+inline int f2837_25(int x) { return x * 25; }
+inline int f2837_26(int x) { return x * 26; }
+inline int f2837_27(int x) { return x * 27; }
+inline int f2837_28(int x) { return x * 28; }
+inline int f2837_29(int x) { return x * 29; }
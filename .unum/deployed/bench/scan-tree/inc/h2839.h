@@ -0,0 +1,42 @@
+#pragma once
+/* header 2839 */
+#include <vector>
+#include "h638.h"
+#include "h5385.h"
+#include "h9170.h"
+#include "h2754.h"
+#include "h233.h"
+#ifdef X
+#include "h269.h"
+#endif
+struct S2839 { int a; const char *s = "x//y"; };
+inline int f2839_0(int x) { return x * 0; }
+inline int f2839_1(int x) { return x * 1; }
+inline int f2839_2(int x) { return x * 2; }
+inline int f2839_3(int x) { return x * 3; }
+inline int f2839_4(int x) { return x * 4; }
+inline int f2839_5(int x) { return x * 5; }
+inline int f2839_6(int x) { return x * 6; }
+inline int f2839_7(int x) { return x * 7; }
+inline int f2839_8(int x) { return x * 8; }
+inline int f2839_9(int x) { return x * 9; }
+inline int f2839_10(int x) { return x * 10; }
+inline int f2839_11(int x) { return x * 11; }
+inline int f2839_12(int x) { return x * 12; }
+inline int f2839_13(int x) { return x * 13; }
+inline int f2839_14(int x) { return x * 14; }
+inline int f2839_15(int x) { return x * 15; }
+inline int f2839_16(int x) { return x * 16; }
+inline int f2839_17(int x) { return x * 17; }
+inline int f2839_18(int x) { return x * 18; }
+inline int f2839_19(int x) { return x * 19; }
+inline int f2839_20(int x) { return x * 20; }
+inline int f2839_21(int x) { return x * 21; }
+inline int f2839_22(int x) { return x * 22; }
+inline int f2839_23(int x) { return x * 23; }
+inline int f2839_24(int x) { return x * 24; }
+inline int f2839_25(int x) { return x * 25; }
+inline int f2839_26(int x) { return x * 26; }
+inline int f2839_27(int x) { return x * 27; }
+inline int f2839_28(int x) { return x * 28; }
+inline int f2839_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 284 */
+#include <vector>
+#include "h6926.h"
+#include "h9206.h"
+#include "h3563.h"
+#include "h2552.h"
+#include "h4939.h"
+#ifdef X
+#include "h6106.h"
+#endif
+struct S284 { int a; const char *s = "x//y"; };
+inline int f284_0(int x) { return x * 0; }
+inline int f284_1(int x) { return x * 1; }
+inline int f284_2(int x) { return x * 2; }
+inline int f284_3(int x) { return x * 3; }
+inline int f284_4(int x) { return x * 4; }
+inline int f284_5(int x) { return x * 5; }
+inline int f284_6(int x) { return x * 6; }
+inline int f284_7(int x) { return x * 7; }
+inline int f284_8(int x) { return x * 8; }
+inline int f284_9(int x) { return x * 9; }
+inline int f284_10(int x) { return x * 10; }
+inline int f284_11(int x) { return x * 11; }
+inline int f284_12(int x) { return x * 12; }
+inline int f284_13(int x) { return x * 13; }
+inline int f284_14(int x) { return x * 14; }
+inline int f284_15(int x) { return x * 15; }
+inline int f284_16(int x) { return x * 16; }
+inline int f284_17(int x) { return x * 17; }
+inline int f284_18(int x) { return x * 18; }
+inline int f284_19(int x) { return x * 19; }
+inline int f284_20(int x) { return x * 20; }
+inline int f284_21(int x) { return x * 21; }
+inline int f284_22(int x) { return x * 22; }
+inline int f284_23(int x) { return x * 23; }
+inline int f284_24(int x) { return x * 24; }
+inline int f284_25(int x) { return x * 25; }
+inline int f284_26(int x) { return x * 26; }
+inline int f284_27(int x) { return x * 27; }
+inline int f284_28(int x) { return x * 28; }
+inline int f284_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2840 */
+#include <vector>
+#include "h9198.h"
+#include "h707.h"
+#include "h1297.h"
+#include "h6574.h"
+#include "h7990.h"
+#ifdef X
+#include "h2812.h"
+#endif
+struct S2840 { int a; const char *s = "x//y"; };
+inline int f2840_0(int x) { return x * 0; }
+inline int f2840_1(int x) { return x * 1; }
+inline int f2840_2(int x) { return x * 2; }
+inline int f2840_3(int x) { return x * 3; }
+inline int f2840_4(int x) { return x * 4; }
+inline int f2840_5(int x) { return x * 5; }
+inline int f2840_6(int x) { return x * 6; }
+inline int f2840_7(int x) { return x * 7; }
+inline int f2840_8(int x) { return x * 8; }
+inline int f2840_9(int x) { return x * 9; }
+inline int f2840_10(int x) { return x * 10; }
+inline int f2840_11(int x) { return x * 11; }
+inline int f2840_12(int x) { return x * 12; }
+inline int f2840_13(int x) { return x * 13; }
+inline int f2840_14(int x) { return x * 14; }
+inline int f2840_15(int x) { return x * 15; }
+inline int f2840_16(int x) { return x * 16; }
+inline int f2840_17(int x) { return x * 17; }
+inline int f2840_18(int x) { return x * 18; }
+inline int f2840_19(int x) { return x * 19; }
+inline int f2840_20(int x) { return x * 20; }
+inline int f2840_21(int x) { return x * 21; }
+inline int f2840_22(int x) { return x * 22; }
+inline int f2840_23(int x) { return x * 23; }
+inline int f2840_24(int x) { return x * 24; }
+inline int f2840_25(int x) { return x * 25; }
+inline int f2840_26(int x) { return x * 26; }
+inline int f2840_27(int x) { return x * 27; }
+inline int f2840_28(int x) { return x * 28; }
+inline int f2840_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2841 */
+#include <vector>
+#include "h3541.h"
+#include "h1948.h"
+#include "h2396.h"
+#include "h9693.h"
+#include "h5252.h"
+#ifdef X
+#include "h7984.h"
+#endif
+struct S2841 { int a; const char *s = "x//y"; };
+inline int f2841_0(int x) { return x * 0; }
+inline int f2841_1(int x) { return x * 1; }
+inline int f2841_2(int x) { return x * 2; }
+inline int f2841_3(int x) { return x * 3; }
+inline int f2841_4(int x) { return x * 4; }
+inline int f2841_5(int x) { return x * 5; }
+inline int f2841_6(int x) { return x * 6; }
+inline int f2841_7(int x) { return x * 7; }
+inline int f2841_8(int x) { return x * 8; }
+inline int f2841_9(int x) { return x * 9; }
+inline int f2841_10(int x) { return x * 10; }
+inline int f2841_11(int x) { return x * 11; }
+inline int f2841_12(int x) { return x * 12; }
+inline int f2841_13(int x) { return x * 13; }
+inline int f2841_14(int x) { return x * 14; }
+inline int f2841_15(int x) { return x * 15; }
+inline int f2841_16(int x) { return x * 16; }
+inline int f2841_17(int x) { return x * 17; }
+inline int f2841_18(int x) { return x * 18; }
+inline int f2841_19(int x) { return x * 19; }
+inline int f2841_20(int x) { return x * 20; }
+inline int f2841_21(int x) { return x * 21; }
+inline int f2841_22(int x) { return x * 22; }
+inline int f2841_23(int x) { return x * 23; }
+inline int f2841_24(int x) { return x * 24; }
+inline int f2841_25(int x) { return x * 25; }
+inline int f2841_26(int x) { return x * 26; }
+inline int f2841_27(int x) { return x * 27; }
+inline int f2841_28(int x) { return x * 28; }
+inline int f2841_29(int x) { return x * 29; }
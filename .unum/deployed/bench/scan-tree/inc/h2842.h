@@ -0,0 +1,42 @@
+#pragma once
+/* header 2842 */
+#include <vector>
+#include "h1560.h"
+#include "h6812.h"
+#include "h2951.h"
+#include "h2560.h"
+#include "h21.h"
+#ifdef X
+#include "h1370.h"
+#endif
+struct S2842 { int a; const char *s = "x//y"; };
+inline int f2842_0(int x) { return x * 0; }
+inline int f2842_1(int x) { return x * 1; }
+inline int f2842_2(int x) { return x * 2; }
+inline int f2842_3(int x) { return x * 3; }
+inline int f2842_4(int x) { return x * 4; }
+inline int f2842_5(int x) { return x * 5; }
+inline int f2842_6(int x) { return x * 6; }
+inline int f2842_7(int x) { return x * 7; }
+inline int f2842_8(int x) { return x * 8; }
+inline int f2842_9(int x) { return x * 9; }
+inline int f2842_10(int x) { return x * 10; }
+inline int f2842_11(int x) { return x * 11; }
+inline int f2842_12(int x) { return x * 12; }
+inline int f2842_13(int x) { return x * 13; }
+inline int f2842_14(int x) { return x * 14; }
+inline int f2842_15(int x) { return x * 15; }
+inline int f2842_16(int x) { return x * 16; }
+inline int f2842_17(int x) { return x * 17; }
+inline int f2842_18(int x) { return x * 18; }
+inline int f2842_19(int x) { return x * 19; }
+inline int f2842_20(int x) { return x * 20; }
+inline int f2842_21(int x) { return x * 21; }
+inline int f2842_22(int x) { return x * 22; }
+inline int f2842_23(int x) { return x * 23; }
+inline int f2842_24(int x) { return x * 24; }
+inline int f2842_25(int x) { return x * 25; }
+inline int f2842_26(int x) { return x * 26; }
+inline int f2842_27(int x) { return x * 27; }
+inline int f2842_28(int x) { return x * 28; }
+inline int f2842_29(int x) { return x * 29; }
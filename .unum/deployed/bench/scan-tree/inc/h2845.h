@@ -0,0 +1,42 @@
+#pragma once
+/* header 2845 */
+#include <vector>
+#include "h3314.h"
+#include "h9886.h"
+#include "h1846.h"
+#include "h3624.h"
+#include "h3375.h"
+#ifdef X
+#include "h8951.h"
+#endif
+struct S2845 { int a; const char *s = "x//y"; };
+inline int f2845_0(int x) { return x * 0; }
+inline int f2845_1(int x) { return x * 1; }
+inline int f2845_2(int x) { return x * 2; }
+inline int f2845_3(int x) { return x * 3; }
+inline int f2845_4(int x) { return x * 4; }
+inline int f2845_5(int x) { return x * 5; }
+inline int f2845_6(int x) { return x * 6; }
+inline int f2845_7(int x) { return x * 7; }
+inline int f2845_8(int x) { return x * 8; }
+inline int f2845_9(int x) { return x * 9; }
+inline int f2845_10(int x) { return x * 10; }
+inline int f2845_11(int x) { return x * 11; }
+inline int f2845_12(int x) { return x * 12; }
+inline int f2845_13(int x) { return x * 13; }
+inline int f2845_14(int x) { return x * 14; }
+inline int f2845_15(int x) { return x * 15; }
+inline int f2845_16(int x) { return x * 16; }
+inline int f2845_17(int x) { return x * 17; }
+inline int f2845_18(int x) { return x * 18; }
+inline int f2845_19(int x) { return x * 19; }
+inline int f2845_20(int x) { return x * 20; }
+inline int f2845_21(int x) { return x * 21; }
+inline int f2845_22(int x) { return x * 22; }
+inline int f2845_23(int x) { return x * 23; }
+inline int f2845_24(int x) { return x * 24; }
+inline int f2845_25(int x) { return x * 25; }
+inline int f2845_26(int x) { return x * 26; }
+inline int f2845_27(int x) { return x * 27; }
+inline int f2845_28(int x) { return x * 28; }
+inline int f2845_29(int x) { return x * 29; }
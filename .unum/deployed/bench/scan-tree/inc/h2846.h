@@ -0,0 +1,42 @@
+#pragma once
+/* header 2846 */
+#include <vector>
+#include "h1252.h"
+#include "h7389.h"
+#include "h768.h"
+#include "h8139.h"
+#include "h4870.h"
+#ifdef X
+#include "h3445.h"
+#endif
+struct S2846 { int a; const char *s = "x//y"; };
+inline int f2846_0(int x) { return x * 0; }
+inline int f2846_1(int x) { return x * 1; }
+inline int f2846_2(int x) { return x * 2; }
+inline int f2846_3(int x) { return x * 3; }
+inline int f2846_4(int x) { return x * 4; }
+inline int f2846_5(int x) { return x * 5; }
+inline int f2846_6(int x) { return x * 6; }
+inline int f2846_7(int x) { return x * 7; }
+inline int f2846_8(int x) { return x * 8; }
+inline int f2846_9(int x) { return x * 9; }
+inline int f2846_10(int x) { return x * 10; }
+inline int f2846_11(int x) { return x * 11; }
+inline int f2846_12(int x) { return x * 12; }
+inline int f2846_13(int x) { return x * 13; }
+inline int f2846_14(int x) { return x * 14; }
+inline int f2846_15(int x) { return x * 15; }
+inline int f2846_16(int x) { return x * 16; }
+inline int f2846_17(int x) { return x * 17; }
+inline int f2846_18(int x) { return x * 18; }
+inline int f2846_19(int x) { return x * 19; }
+inline int f2846_20(int x) { return x * 20; }
+inline int f2846_21(int x) { return x * 21; }
+inline int f2846_22(int x) { return x * 22; }
+inline int f2846_23(int x) { return x * 23; }
+inline int f2846_24(int x) { return x * 24; }
+inline int f2846_25(int x) { return x * 25; }
+inline int f2846_26(int x) { return x * 26; }
+inline int f2846_27(int x) { return x * 27; }
+inline int f2846_28(int x) { return x * 28; }
+inline int f2846_29(int x) { return x * 29; }
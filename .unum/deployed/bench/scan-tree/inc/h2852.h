@@ -0,0 +1,42 @@
+#pragma once
+/* header 2852 */
+#include <vector>
+#include "h9317.h"
+#include "h2374.h"
+#include "h8229.h"
+#include "h1505.h"
+#include "h3399.h"
+#ifdef X
+#include "h5488.h"
+#endif
+struct S2852 { int a; const char *s = "x//y"; };
+inline int f2852_0(int x) { return x * 0; }
+inline int f2852_1(int x) { return x * 1; }
+inline int f2852_2(int x) { return x * 2; }
+inline int f2852_3(int x) { return x * 3; }
+inline int f2852_4(int x) { return x * 4; }
+inline int f2852_5(int x) { return x * 5; }
+inline int f2852_6(int x) { return x * 6; }
+inline int f2852_7(int x) { return x * 7; }
+inline int f2852_8(int x) { return x * 8; }
+inline int f2852_9(int x) { return x * 9; }
+inline int f2852_10(int x) { return x * 10; }
+inline int f2852_11(int x) { return x * 11; }
+inline int f2852_12(int x) { return x * 12; }
+inline int f2852_13(int x) { return x * 13; }
+inline int f2852_14(int x) { return x * 14; }
+inline int f2852_15(int x) { return x * 15; }
+inline int f2852_16(int x) { return x * 16; }
+inline int f2852_17(int x) { return x * 17; }
+inline int f2852_18(int x) { return x * 18; }
+inline int f2852_19(int x) { return x * 19; }
+inline int f2852_20(int x) { return x * 20; }
+inline int f2852_21(int x) { return x * 21; }
+inline int f2852_22(int x) { return x * 22; }
+inline int f2852_23(int x) { return x * 23; }
+inline int f2852_24(int x) { return x * 24; }
+inline int f2852_25(int x) { return x * 25; }
+inline int f2852_26(int x) { return x * 26; }
+inline int f2852_27(int x) { return x * 27; }
+inline int f2852_28(int x) { return x * 28; }
+inline int f2852_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2853 */
+#include <vector>
+#include "h2808.h"
+#include "h6933.h"
+#include "h4756.h"
+#include "h1809.h"
+#include "h7457.h"
+#ifdef X
+#include "h1912.h"
+#endif
+struct S2853 { int a; const char *s = "x//y"; };
+inline int f2853_0(int x) { return x * 0; }
+inline int f2853_1(int x) { return x * 1; }
+inline int f2853_2(int x) { return x * 2; }
+inline int f2853_3(int x) { return x * 3; }
+inline int f2853_4(int x) { return x * 4; }
+inline int f2853_5(int x) { return x * 5; }
+inline int f2853_6(int x) { return x * 6; }
+inline int f2853_7(int x) { return x * 7; }
+inline int f2853_8(int x) { return x * 8; }
+inline int f2853_9(int x) { return x * 9; }
+inline int f2853_10(int x) { return x * 10; }
+inline int f2853_11(int x) { return x * 11; }
+inline int f2853_12(int x) { return x * 12; }
+inline int f2853_13(int x) { return x * 13; }
+inline int f2853_14(int x) { return x * 14; }
+inline int f2853_15(int x) { return x * 15; }
+inline int f2853_16(int x) { return x * 16; }
+inline int f2853_17(int x) { return x * 17; }
+inline int f2853_18(int x) { return x * 18; }
+inline int f2853_19(int x) { return x * 19; }
+inline int f2853_20(int x) { return x * 20; }
+inline int f2853_21(int x) { return x * 21; }
+inline int f2853_22(int x) { return x * 22; }
+inline int f2853_23(int x) { return x * 23; }
+inline int f2853_24(int x) { return x * 24; }
+inline int f2853_25(int x) { return x * 25; }
+inline int f2853_26(int x) { return x * 26; }
+inline int f2853_27(int x) { return x * 27; }
+inline int f2853_28(int x) { return x * 28; }
+inline int f2853_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2855 */
+#include <vector>
+#include "h5579.h"
+#include "h9512.h"
+#include "h6362.h"
+#include "h9422.h"
+#include "h1338.h"
+#ifdef X
+#include "h8838.h"
+#endif
+struct S2855 { int a; const char *s = "x//y"; };
+inline int f2855_0(int x) { return x * 0; }
+inline int f2855_1(int x) { return x * 1; }
+inline int f2855_2(int x) { return x * 2; }
+inline int f2855_3(int x) { return x * 3; }
+inline int f2855_4(int x) { return x * 4; }
+inline int f2855_5(int x) { return x * 5; }
+inline int f2855_6(int x) { return x * 6; }
+inline int f2855_7(int x) { return x * 7; }
+inline int f2855_8(int x) { return x * 8; }
+inline int f2855_9(int x) { return x * 9; }
+inline int f2855_10(int x) { return x * 10; }
+inline int f2855_11(int x) { return x * 11; }
+inline int f2855_12(int x) { return x * 12; }
+inline int f2855_13(int x) { return x * 13; }
+inline int f2855_14(int x) { return x * 14; }
+inline int f2855_15(int x) { return x * 15; }
+inline int f2855_16(int x) { return x * 16; }
+inline int f2855_17(int x) { return x * 17; }
+inline int f2855_18(int x) { return x * 18; }
+inline int f2855_19(int x) { return x * 19; }
+inline int f2855_20(int x) { return x * 20; }
+inline int f2855_21(int x) { return x * 21; }
+inline int f2855_22(int x) { return x * 22; }
+inline int f2855_23(int x) { return x * 23; }
+inline int f2855_24(int x) { return x * 24; }
+inline int f2855_25(int x) { return x * 25; }
+inline int f2855_26(int x) { return x * 26; }
+inline int f2855_27(int x) { return x * 27; }
+inline int f2855_28(int x) { return x * 28; }
+inline int f2855_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2859 */
+#include <vector>
+#include "h6946.h"
+#include "h3282.h"
+#include "h216.h"
+#include "h7835.h"
+#include "h3679.h"
+#ifdef X
+#include "h348.h"
+#endif
+struct S2859 { int a; const char *s = "x//y"; };
+inline int f2859_0(int x) { return x * 0; }
+inline int f2859_1(int x) { return x * 1; }
+inline int f2859_2(int x) { return x * 2; }
+inline int f2859_3(int x) { return x * 3; }
+inline int f2859_4(int x) { return x * 4; }
+inline int f2859_5(int x) { return x * 5; }
+inline int f2859_6(int x) { return x * 6; }
+inline int f2859_7(int x) { return x * 7; }
+inline int f2859_8(int x) { return x * 8; }
+inline int f2859_9(int x) { return x * 9; }
+inline int f2859_10(int x) { return x * 10; }
+inline int f2859_11(int x) { return x * 11; }
+inline int f2859_12(int x) { return x * 12; }
+inline int f2859_13(int x) { return x * 13; }
+inline int f2859_14(int x) { return x * 14; }
+inline int f2859_15(int x) { return x * 15; }
+inline int f2859_16(int x) { return x * 16; }
+inline int f2859_17(int x) { return x * 17; }
+inline int f2859_18(int x) { return x * 18; }
+inline int f2859_19(int x) { return x * 19; }
+inline int f2859_20(int x) { return x * 20; }
+inline int f2859_21(int x) { return x * 21; }
+inline int f2859_22(int x) { return x * 22; }
+inline int f2859_23(int x) { return x * 23; }
+inline int f2859_24(int x) { return x * 24; }
+inline int f2859_25(int x) { return x * 25; }
+inline int f2859_26(int x) { return x * 26; }
+inline int f2859_27(int x) { return x * 27; }
+inline int f2859_28(int x) { return x * 28; }
+inline int f2859_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 286 */
+#include <vector>
+#include "h2518.h"
+#include "h445.h"
+#include "h9739.h"
+#include "h5920.h"
+#include "h912.h"
+#ifdef X
+#include "h2537.h"
+#endif
+struct S286 { int a; const char *s = "x//y"; };
+inline int f286_0(int x) { return x * 0; }
+inline int f286_1(int x) { return x * 1; }
+inline int f286_2(int x) { return x * 2; }
+inline int f286_3(int x) { return x * 3; }
+inline int f286_4(int x) { return x * 4; }
+inline int f286_5(int x) { return x * 5; }
+inline int f286_6(int x) { return x * 6; }
+inline int f286_7(int x) { return x * 7; }
+inline int f286_8(int x) { return x * 8; }
+inline int f286_9(int x) { return x * 9; }
+inline int f286_10(int x) { return x * 10; }
+inline int f286_11(int x) { return x * 11; }
+inline int f286_12(int x) { return x * 12; }
+inline int f286_13(int x) { return x * 13; }
+inline int f286_14(int x) { return x * 14; }
+inline int f286_15(int x) { return x * 15; }
+inline int f286_16(int x) { return x * 16; }
+inline int f286_17(int x) { return x * 17; }
+inline int f286_18(int x) { return x * 18; }
+inline int f286_19(int x) { return x * 19; }
+inline int f286_20(int x) { return x * 20; }
+inline int f286_21(int x) { return x * 21; }
+inline int f286_22(int x) { return x * 22; }
+inline int f286_23(int x) { return x * 23; }
+inline int f286_24(int x) { return x * 24; }
+inline int f286_25(int x) { return x * 25; }
+inline int f286_26(int x) { return x * 26; }
+inline int f286_27(int x) { return x * 27; }
+inline int f286_28(int x) { return x * 28; }
+inline int f286_29(int x) { return x * 29; }
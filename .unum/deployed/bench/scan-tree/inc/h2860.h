@@ -0,0 +1,42 @@
+#pragma once
+/* header 2860 */
+#include <vector>
+#include "h2804.h"
+#include "h9559.h"
+#include "h8846.h"
+#include "h7064.h"
+#include "h9669.h"
+#ifdef X
+#include "h3221.h"
+#endif
+struct S2860 { int a; const char *s = "x//y"; };
+inline int f2860_0(int x) { return x * 0; }
+inline int f2860_1(int x) { return x * 1; }
+inline int f2860_2(int x) { return x * 2; }
+inline int f2860_3(int x) { return x * 3; }
+inline int f2860_4(int x) { return x * 4; }
+inline int f2860_5(int x) { return x * 5; }
+inline int f2860_6(int x) { return x * 6; }
+inline int f2860_7(int x) { return x * 7; }
+inline int f2860_8(int x) { return x * 8; }
+inline int f2860_9(int x) { return x * 9; }
+inline int f2860_10(int x) { return x * 10; }
+inline int f2860_11(int x) { return x * 11; }
+inline int f2860_12(int x) { return x * 12; }
+inline int f2860_13(int x) { return x * 13; }
+inline int f2860_14(int x) { return x * 14; }
+inline int f2860_15(int x) { return x * 15; }
+inline int f2860_16(int x) { return x * 16; }
+inline int f2860_17(int x) { return x * 17; }
+inline int f2860_18(int x) { return x * 18; }
+inline int f2860_19(int x) { return x * 19; }
+inline int f2860_20(int x) { return x * 20; }
+inline int f2860_21(int x) { return x * 21; }
+inline int f2860_22(int x) { return x * 22; }
+inline int f2860_23(int x) { return x * 23; }
+inline int f2860_24(int x) { return x * 24; }
+inline int f2860_25(int x) { return x * 25; }
+inline int f2860_26(int x) { return x * 26; }
+inline int f2860_27(int x) { return x * 27; }
+inline int f2860_28(int x) { return x * 28; }
+inline int f2860_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2862 */
+#include <vector>
+#include "h4831.h"
+#include "h2695.h"
+#include "h3684.h"
+#include "h3735.h"
+#include "h7057.h"
+#ifdef X
+#include "h8532.h"
+#endif
+struct S2862 { int a; const char *s = "x//y"; };
+inline int f2862_0(int x) { return x * 0; }
+inline int f2862_1(int x) { return x * 1; }
+inline int f2862_2(int x) { return x * 2; }
+inline int f2862_3(int x) { return x * 3; }
+inline int f2862_4(int x) { return x * 4; }
+inline int f2862_5(int x) { return x * 5; }
+inline int f2862_6(int x) { return x * 6; }
+inline int f2862_7(int x) { return x * 7; }
+inline int f2862_8(int x) { return x * 8; }
+inline int f2862_9(int x) { return x * 9; }
+inline int f2862_10(int x) { return x * 10; }
+inline int f2862_11(int x) { return x * 11; }
+inline int f2862_12(int x) { return x * 12; }
+inline int f2862_13(int x) { return x * 13; }
+inline int f2862_14(int x) { return x * 14; }
+inline int f2862_15(int x) { return x * 15; }
+inline int f2862_16(int x) { return x * 16; }
+inline int f2862_17(int x) { return x * 17; }
+inline int f2862_18(int x) { return x * 18; }
+inline int f2862_19(int x) { return x * 19; }
+inline int f2862_20(int x) { return x * 20; }
+inline int f2862_21(int x) { return x * 21; }
+inline int f2862_22(int x) { return x * 22; }
+inline int f2862_23(int x) { return x * 23; }
+inline int f2862_24(int x) { return x * 24; }
+inline int f2862_25(int x) { return x * 25; }
+inline int f2862_26(int x) { return x * 26; }
+inline int f2862_27(int x) { return x * 27; }
+inline int f2862_28(int x) { return x * 28; }
+inline int f2862_29(int x) { return x * 29; }
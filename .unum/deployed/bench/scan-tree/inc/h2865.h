@@ -0,0 +1,42 @@
+#pragma once
+/* header 2865 */
+#include <vector>
+#include "h9018.h"
+#include "h8120.h"
+#include "h2290.h"
+#include "h6415.h"
+#include "h4262.h"
+#ifdef X
+#include "h336.h"
+#endif
+struct S2865 { int a; const char *s = "x//y"; };
+inline int f2865_0(int x) { return x * 0; }
+inline int f2865_1(int x) { return x * 1; }
+inline int f2865_2(int x) { return x * 2; }
+inline int f2865_3(int x) { return x * 3; }
+inline int f2865_4(int x) { return x * 4; }
+inline int f2865_5(int x) { return x * 5; }
+inline int f2865_6(int x) { return x * 6; }
+inline int f2865_7(int x) { return x * 7; }
+inline int f2865_8(int x) { return x * 8; }
+inline int f2865_9(int x) { return x * 9; }
+inline int f2865_10(int x) { return x * 10; }
+inline int f2865_11(int x) { return x * 11; }
+inline int f2865_12(int x) { return x * 12; }
+inline int f2865_13(int x) { return x * 13; }
+inline int f2865_14(int x) { return x * 14; }
+inline int f2865_15(int x) { return x * 15; }
+inline int f2865_16(int x) { return x * 16; }
+inline int f2865_17(int x) { return x * 17; }
+inline int f2865_18(int x) { return x * 18; }
+inline int f2865_19(int x) { return x * 19; }
+inline int f2865_20(int x) { return x * 20; }
+inline int f2865_21(int x) { return x * 21; }
+inline int f2865_22(int x) { return x * 22; }
+inline int f2865_23(int x) { return x * 23; }
+inline int f2865_24(int x) { return x * 24; }
+inline int f2865_25(int x) { return x * 25; }
+inline int f2865_26(int x) { return x * 26; }
+inline int f2865_27(int x) { return x * 27; }
+inline int f2865_28(int x) { return x * 28; }
+inline int f2865_29(int x) { return x * 29; }
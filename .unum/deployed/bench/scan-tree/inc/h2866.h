@@ -0,0 +1,42 @@
+#pragma once
+/* header 2866 */
+#include <vector>
+#include "h8127.h"
+#include "h9581.h"
+#include "h599.h"
+#include "h6415.h"
+#include "h9050.h"
+#ifdef X
+#include "h8621.h"
+#endif
+struct S2866 { int a; const char *s = "x//y"; };
+inline int f2866_0(int x) { return x * 0; }
+inline int f2866_1(int x) { return x * 1; }
+inline int f2866_2(int x) { return x * 2; }
+inline int f2866_3(int x) { return x * 3; }
+inline int f2866_4(int x) { return x * 4; }
+inline int f2866_5(int x) { return x * 5; }
+inline int f2866_6(int x) { return x * 6; }
+inline int f2866_7(int x) { return x * 7; }
+inline int f2866_8(int x) { return x * 8; }
+inline int f2866_9(int x) { return x * 9; }
+inline int f2866_10(int x) { return x * 10; }
+inline int f2866_11(int x) { return x * 11; }
+inline int f2866_12(int x) { return x * 12; }
+inline int f2866_13(int x) { return x * 13; }
+inline int f2866_14(int x) { return x * 14; }
+inline int f2866_15(int x) { return x * 15; }
+inline int f2866_16(int x) { return x * 16; }
+inline int f2866_17(int x) { return x * 17; }
+inline int f2866_18(int x) { return x * 18; }
+inline int f2866_19(int x) { return x * 19; }
+inline int f2866_20(int x) { return x * 20; }
+inline int f2866_21(int x) { return x * 21; }
+inline int f2866_22(int x) { return x * 22; }
+inline int f2866_23(int x) { return x * 23; }
+inline int f2866_24(int x) { return x * 24; }
+inline int f2866_25(int x) { return x * 25; }
+inline int f2866_26(int x) { return x * 26; }
+inline int f2866_27(int x) { return x * 27; }
+inline int f2866_28(int x) { return x * 28; }
+inline int f2866_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2868 */
+#include <vector>
+#include "h9969.h"
+#include "h2319.h"
+#include "h4725.h"
+#include "h9370.h"
+#include "h74.h"
+#ifdef X
+#include "h5856.h"
+#endif
+struct S2868 { int a; const char *s = "x//y"; };
+inline int f2868_0(int x) { return x * 0; }
+inline int f2868_1(int x) { return x * 1; }
+inline int f2868_2(int x) { return x * 2; }
+inline int f2868_3(int x) { return x * 3; }
+inline int f2868_4(int x) { return x * 4; }
+inline int f2868_5(int x) { return x * 5; }
+inline int f2868_6(int x) { return x * 6; }
+inline int f2868_7(int x) { return x * 7; }
+inline int f2868_8(int x) { return x * 8; }
+inline int f2868_9(int x) { return x * 9; }
+inline int f2868_10(int x) { return x * 10; }
+inline int f2868_11(int x) { return x * 11; }
+inline int f2868_12(int x) { return x * 12; }
+inline int f2868_13(int x) { return x * 13; }
+inline int f2868_14(int x) { return x * 14; }
+inline int f2868_15(int x) { return x * 15; }
+inline int f2868_16(int x) { return x * 16; }
+inline int f2868_17(int x) { return x * 17; }
+inline int f2868_18(int x) { return x * 18; }
+inline int f2868_19(int x) { return x * 19; }
+inline int f2868_20(int x) { return x * 20; }
+inline int f2868_21(int x) { return x * 21; }
+inline int f2868_22(int x) { return x * 22; }
+inline int f2868_23(int x) { return x * 23; }
+inline int f2868_24(int x) { return x * 24; }
+inline int f2868_25(int x) { return x * 25; }
+inline int f2868_26(int x) { return x * 26; }
+inline int f2868_27(int x) { return x * 27; }
+inline int f2868_28(int x) { return x * 28; }
+inline int f2868_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2870 */
+#include <vector>
+#include "h6182.h"
+#include "h1976.h"
+#include "h4074.h"
+#include "h6371.h"
+#include "h4010.h"
+#ifdef X
+#include "h2214.h"
+#endif
+struct S2870 { int a; const char *s = "x//y"; };
+inline int f2870_0(int x) { return x * 0; }
+inline int f2870_1(int x) { return x * 1; }
+inline int f2870_2(int x) { return x * 2; }
+inline int f2870_3(int x) { return x * 3; }
+inline int f2870_4(int x) { return x * 4; }
+inline int f2870_5(int x) { return x * 5; }
+inline int f2870_6(int x) { return x * 6; }
+inline int f2870_7(int x) { return x * 7; }
+inline int f2870_8(int x) { return x * 8; }
+inline int f2870_9(int x) { return x * 9; }
+inline int f2870_10(int x) { return x * 10; }
+inline int f2870_11(int x) { return x * 11; }
+inline int f2870_12(int x) { return x * 12; }
+inline int f2870_13(int x) { return x * 13; }
+inline int f2870_14(int x) { return x * 14; }
+inline int f2870_15(int x) { return x * 15; }
+inline int f2870_16(int x) { return x * 16; }
+inline int f2870_17(int x) { return x * 17; }
+inline int f2870_18(int x) { return x * 18; }
+inline int f2870_19(int x) { return x * 19; }
+inline int f2870_20(int x) { return x * 20; }
+inline int f2870_21(int x) { return x * 21; }
+inline int f2870_22(int x) { return x * 22; }
+inline int f2870_23(int x) { return x * 23; }
+inline int f2870_24(int x) { return x * 24; }
+inline int f2870_25(int x) { return x * 25; }
+inline int f2870_26(int x) { return x * 26; }
+inline int f2870_27(int x) { return x * 27; }
+inline int f2870_28(int x) { return x * 28; }
+inline int f2870_29(int x) { return x * 29; }
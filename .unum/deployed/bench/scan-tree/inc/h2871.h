@@ -0,0 +1,42 @@
+#pragma once
+/* header 2871 */
+#include <vector>
+#include "h4724.h"
+#include "h3347.h"
+#include "h2396.h"
+#include "h7764.h"
+#include "h3832.h"
+#ifdef X
+#include "h7314.h"
+#endif
+struct S2871 { int a; const char *s = "x//y"; };
+inline int f2871_0(int x) { return x * 0; }
+inline int f2871_1(int x) { return x * 1; }
+inline int f2871_2(int x) { return x * 2; }
+inline int f2871_3(int x) { return x * 3; }
+inline int f2871_4(int x) { return x * 4; }
+inline int f2871_5(int x) { return x * 5; }
+inline int f2871_6(int x) { return x * 6; }
+inline int f2871_7(int x) { return x * 7; }
+inline int f2871_8(int x) { return x * 8; }
+inline int f2871_9(int x) { return x * 9; }
+inline int f2871_10(int x) { return x * 10; }
+inline int f2871_11(int x) { return x * 11; }
+inline int f2871_12(int x) { return x * 12; }
+inline int f2871_13(int x) { return x * 13; }
+inline int f2871_14(int x) { return x * 14; }
+inline int f2871_15(int x) { return x * 15; }
+inline int f2871_16(int x) { return x * 16; }
+inline int f2871_17(int x) { return x * 17; }
+inline int f2871_18(int x) { return x * 18; }
+inline int f2871_19(int x) { return x * 19; }
+inline int f2871_20(int x) { return x * 20; }
+inline int f2871_21(int x) { return x * 21; }
+inline int f2871_22(int x) { return x * 22; }
+inline int f2871_23(int x) { return x * 23; }
+inline int f2871_24(int x) { return x * 24; }
+inline int f2871_25(int x) { return x * 25; }
+inline int f2871_26(int x) { return x * 26; }
+inline int f2871_27(int x) { return x * 27; }
+inline int f2871_28(int x) { return x * 28; }
+inline int f2871_29(int x) { return x * 29; }
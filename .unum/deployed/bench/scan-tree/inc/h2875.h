@@ -0,0 +1,42 @@
+#pragma once
+/* header 2875 */
+#include <vector>
+#include "h7402.h"
+#include "h9087.h"
+#include "h5908.h"
+#include "h8123.h"
+#include "h8938.h"
+#ifdef X
+#include "h5604.h"
+#endif
+struct S2875 { int a; const char *s = "x//y"; };
+inline int f2875_0(int x) { return x * 0; }
+inline int f2875_1(int x) { return x * 1; }
+inline int f2875_2(int x) { return x * 2; }
+inline int f2875_3(int x) { return x * 3; }
+inline int f2875_4(int x) { return x * 4; }
+inline int f2875_5(int x) { return x * 5; }
+inline int f2875_6(int x) { return x * 6; }
+inline int f2875_7(int x) { return x * 7; }
+inline int f2875_8(int x) { return x * 8; }
+inline int f2875_9(int x) { return x * 9; }
+inline int f2875_10(int x) { return x * 10; }
+inline int f2875_11(int x) { return x * 11; }
+inline int f2875_12(int x) { return x * 12; }
+inline int f2875_13(int x) { return x * 13; }
+inline int f2875_14(int x) { return x * 14; }
+inline int f2875_15(int x) { return x * 15; }
+inline int f2875_16(int x) { return x * 16; }
+inline int f2875_17(int x) { return x * 17; }
+inline int f2875_18(int x) { return x * 18; }
+inline int f2875_19(int x) { return x * 19; }
+inline int f2875_20(int x) { return x * 20; }
+inline int f2875_21(int x) { return x * 21; }
+inline int f2875_22(int x) { return x * 22; }
+inline int f2875_23(int x) { return x * 23; }
+inline int f2875_24(int x) { return x * 24; }
+inline int f2875_25(int x) { return x * 25; }
+inline int f2875_26(int x) { return x * 26; }
+inline int f2875_27(int x) { return x * 27; }
+inline int f2875_28(int x) { return x * 28; }
+inline int f2875_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2876 */
+#include <vector>
+#include "h9375.h"
+#include "h655.h"
+#include "h5832.h"
+#include "h5126.h"
+#include "h959.h"
+#ifdef X
+#include "h7089.h"
+#endif
+struct S2876 { int a; const char *s = "x//y"; };
+inline int f2876_0(int x) { return x * 0; }
+inline int f2876_1(int x) { return x * 1; }
+inline int f2876_2(int x) { return x * 2; }
+inline int f2876_3(int x) { return x * 3; }
+inline int f2876_4(int x) { return x * 4; }
+inline int f2876_5(int x) { return x * 5; }
+inline int f2876_6(int x) { return x * 6; }
+inline int f2876_7(int x) { return x * 7; }
+inline int f2876_8(int x) { return x * 8; }
+inline int f2876_9(int x) { return x * 9; }
+inline int f2876_10(int x) { return x * 10; }
+inline int f2876_11(int x) { return x * 11; }
+inline int f2876_12(int x) { return x * 12; }
+inline int f2876_13(int x) { return x * 13; }
+inline int f2876_14(int x) { return x * 14; }
+inline int f2876_15(int x) { return x * 15; }
+inline int f2876_16(int x) { return x * 16; }
+inline int f2876_17(int x) { return x * 17; }
+inline int f2876_18(int x) { return x * 18; }
+inline int f2876_19(int x) { return x * 19; }
+inline int f2876_20(int x) { return x * 20; }
+inline int f2876_21(int x) { return x * 21; }
+inline int f2876_22(int x) { return x * 22; }
+inline int f2876_23(int x) { return x * 23; }
+inline int f2876_24(int x) { return x * 24; }
+inline int f2876_25(int x) { return x * 25; }
+inline int f2876_26(int x) { return x * 26; }
+inline int f2876_27(int x) { return x * 27; }
+inline int f2876_28(int x) { return x * 28; }
+inline int f2876_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2877 */
+#include <vector>
+#include "h289.h"
+#include "h4263.h"
+#include "h8286.h"
+#include "h8051.h"
+#include "h4910.h"
+#ifdef X
+#include "h5737.h"
+#endif
+struct S2877 { int a; const char *s = "x//y"; };
+inline int f2877_0(int x) { return x * 0; }
+inline int f2877_1(int x) { return x * 1; }
+inline int f2877_2(int x) { return x * 2; }
+inline int f2877_3(int x) { return x * 3; }
+inline int f2877_4(int x) { return x * 4; }
+inline int f2877_5(int x) { return x * 5; }
+inline int f2877_6(int x) { return x * 6; }
+inline int f2877_7(int x) { return x * 7; }
+inline int f2877_8(int x) { return x * 8; }
+inline int f2877_9(int x) { return x * 9; }
+inline int f2877_10(int x) { return x * 10; }
+inline int f2877_11(int x) { return x * 11; }
+inline int f2877_12(int x) { return x * 12; }
+inline int f2877_13(int x) { return x * 13; }
+inline int f2877_14(int x) { return x * 14; }
+inline int f2877_15(int x) { return x * 15; }
+inline int f2877_16(int x) { return x * 16; }
+inline int f2877_17(int x) { return x * 17; }
+inline int f2877_18(int x) { return x * 18; }
+inline int f2877_19(int x) { return x * 19; }
+inline int f2877_20(int x) { return x * 20; }
+inline int f2877_21(int x) { return x * 21; }
+inline int f2877_22(int x) { return x * 22; }
+inline int f2877_23(int x) { return x * 23; }
+inline int f2877_24(int x) { return x * 24; }
+inline int f2877_25(int x) { return x * 25; }
+inline int f2877_26(int x) { return x * 26; }
+inline int f2877_27(int x) { return x * 27; }
+inline int f2877_28(int x) { return x * 28; }
+inline int f2877_29(int x) { return x * 29; }
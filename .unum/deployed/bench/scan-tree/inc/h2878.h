@@ -0,0 +1,42 @@
+#pragma once
+/* header 2878 */
+#include <vector>
+#include "h5696.h"
+#include "h4364.h"
+#include "h2722.h"
+#include "h1039.h"
+#include "h7148.h"
+#ifdef X
+#include "h9310.h"
+#endif
+struct S2878 { int a; const char *s = "x//y"; };
+inline int f2878_0(int x) { return x * 0; }
+inline int f2878_1(int x) { return x * 1; }
+inline int f2878_2(int x) { return x * 2; }
+inline int f2878_3(int x) { return x * 3; }
+inline int f2878_4(int x) { return x * 4; }
+inline int f2878_5(int x) { return x * 5; }
+inline int f2878_6(int x) { return x * 6; }
+inline int f2878_7(int x) { return x * 7; }
+inline int f2878_8(int x) { return x * 8; }
+inline int f2878_9(int x) { return x * 9; }
+inline int f2878_10(int x) { return x * 10; }
+inline int f2878_11(int x) { return x * 11; }
+inline int f2878_12(int x) { return x * 12; }
+inline int f2878_13(int x) { return x * 13; }
+inline int f2878_14(int x) { return x * 14; }
+inline int f2878_15(int x) { return x * 15; }
+inline int f2878_16(int x) { return x * 16; }
+inline int f2878_17(int x) { return x * 17; }
+inline int f2878_18(int x) { return x * 18; }
+inline int f2878_19(int x) { return x * 19; }
+inline int f2878_20(int x) { return x * 20; }
+inline int f2878_21(int x) { return x * 21; }
+inline int f2878_22(int x) { return x * 22; }
+inline int f2878_23(int x) { return x * 23; }
+inline int f2878_24(int x) { return x * 24; }
+inline int f2878_25(int x) { return x * 25; }
+inline int f2878_26(int x) { return x * 26; }
+inline int f2878_27(int x) { return x * 27; }
+inline int f2878_28(int x) { return x * 28; }
+inline int f2878_29(int x) { return x * 29; }
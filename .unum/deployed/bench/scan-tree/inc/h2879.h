@@ -0,0 +1,42 @@
+#pragma once
+/* header 2879 */
+#include <vector>
+#include "h4586.h"
+#include "h3795.h"
+#include "h4232.h"
+#include "h9998.h"
+#include "h105.h"
+#ifdef X
+#include "h2027.h"
+#endif
+struct S2879 { int a; const char *s = "x//y"; };
+inline int f2879_0(int x) { return x * 0; }
+inline int f2879_1(int x) { return x * 1; }
+inline int f2879_2(int x) { return x * 2; }
+inline int f2879_3(int x) { return x * 3; }
+inline int f2879_4(int x) { return x * 4; }
+inline int f2879_5(int x) { return x * 5; }
+inline int f2879_6(int x) { return x * 6; }
+inline int f2879_7(int x) { return x * 7; }
+inline int f2879_8(int x) { return x * 8; }
+inline int f2879_9(int x) { return x * 9; }
+inline int f2879_10(int x) { return x * 10; }
+inline int f2879_11(int x) { return x * 11; }
+inline int f2879_12(int x) { return x * 12; }
+inline int f2879_13(int x) { return x * 13; }
+inline int f2879_14(int x) { return x * 14; }
+inline int f2879_15(int x) { return x * 15; }
+inline int f2879_16(int x) { return x * 16; }
+inline int f2879_17(int x) { return x * 17; }
+inline int f2879_18(int x) { return x * 18; }
+inline int f2879_19(int x) { return x * 19; }
+inline int f2879_20(int x) { return x * 20; }
+inline int f2879_21(int x) { return x * 21; }
+inline int f2879_22(int x) { return x * 22; }
+inline int f2879_23(int x) { return x * 23; }
+inline int f2879_24(int x) { return x * 24; }
+inline int f2879_25(int x) { return x * 25; }
+inline int f2879_26(int x) { return x * 26; }
+inline int f2879_27(int x) { return x * 27; }
+inline int f2879_28(int x) { return x * 28; }
+inline int f2879_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2882 */
+#include <vector>
+#include "h9630.h"
+#include "h2440.h"
+#include "h3212.h"
+#include "h5197.h"
+#include "h7971.h"
+#ifdef X
+#include "h9443.h"
+#endif
+struct S2882 { int a; const char *s = "x//y"; };
+inline int f2882_0(int x) { return x * 0; }
+inline int f2882_1(int x) { return x * 1; }
+inline int f2882_2(int x) { return x * 2; }
+inline int f2882_3(int x) { return x * 3; }
+inline int f2882_4(int x) { return x * 4; }
+inline int f2882_5(int x) { return x * 5; }
+inline int f2882_6(int x) { return x * 6; }
+inline int f2882_7(int x) { return x * 7; }
+inline int f2882_8(int x) { return x * 8; }
+inline int f2882_9(int x) { return x * 9; }
+inline int f2882_10(int x) { return x * 10; }
+inline int f2882_11(int x) { return x * 11; }
+inline int f2882_12(int x) { return x * 12; }
+inline int f2882_13(int x) { return x * 13; }
+inline int f2882_14(int x) { return x * 14; }
+inline int f2882_15(int x) { return x * 15; }
+inline int f2882_16(int x) { return x * 16; }
+inline int f2882_17(int x) { return x * 17; }
+inline int f2882_18(int x) { return x * 18; }
+inline int f2882_19(int x) { return x * 19; }
+inline int f2882_20(int x) { return x * 20; }
+inline int f2882_21(int x) { return x * 21; }
+inline int f2882_22(int x) { return x * 22; }
+inline int f2882_23(int x) { return x * 23; }
+inline int f2882_24(int x) { return x * 24; }
+inline int f2882_25(int x) { return x * 25; }
+inline int f2882_26(int x) { return x * 26; }
+inline int f2882_27(int x) { return x * 27; }
+inline int f2882_28(int x) { return x * 28; }
+inline int f2882_29(int x) { return x * 29; }
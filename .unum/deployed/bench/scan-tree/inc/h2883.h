@@ -0,0 +1,42 @@
+#pragma once
+/* header 2883 */
+#include <vector>
+#include "h3427.h"
+#include "h1286.h"
+#include "h2483.h"
+#include "h2219.h"
+#include "h211.h"
+#ifdef X
+#include "h8437.h"
+#endif
+struct S2883 { int a; const char *s = "x//y"; };
+inline int f2883_0(int x) { return x * 0; }
+inline int f2883_1(int x) { return x * 1; }
+inline int f2883_2(int x) { return x * 2; }
+inline int f2883_3(int x) { return x * 3; }
+inline int f2883_4(int x) { return x * 4; }
+inline int f2883_5(int x) { return x * 5; }
+inline int f2883_6(int x) { return x * 6; }
+inline int f2883_7(int x) { return x * 7; }
+inline int f2883_8(int x) { return x * 8; }
+inline int f2883_9(int x) { return x * 9; }
+inline int f2883_10(int x) { return x * 10; }
+inline int f2883_11(int x) { return x * 11; }
+inline int f2883_12(int x) { return x * 12; }
+inline int f2883_13(int x) { return x * 13; }
+inline int f2883_14(int x) { return x * 14; }
+inline int f2883_15(int x) { return x * 15; }
+inline int f2883_16(int x) { return x * 16; }
+inline int f2883_17(int x) { return x * 17; }
+inline int f2883_18(int x) { return x * 18; }
+inline int f2883_19(int x) { return x * 19; }
+inline int f2883_20(int x) { return x * 20; }
+inline int f2883_21(int x) { return x * 21; }
+inline int f2883_22(int x) { return x * 22; }
+inline int f2883_23(int x) { return x * 23; }
+inline int f2883_24(int x) { return x * 24; }
+inline int f2883_25(int x) { return x * 25; }
+inline int f2883_26(int x) { return x * 26; }
+inline int f2883_27(int x) { return x * 27; }
+inline int f2883_28(int x) { return x * 28; }
+inline int f2883_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2884 */
+#include <vector>
+#include "h4292.h"
+#include "h2251.h"
+#include "h2035.h"
+#include "h5971.h"
+#include "h6157.h"
+#ifdef X
+#include "h9071.h"
+#endif
+struct S2884 { int a; const char *s = "x//y"; };
+inline int f2884_0(int x) { return x * 0; }
+inline int f2884_1(int x) { return x * 1; }
+inline int f2884_2(int x) { return x * 2; }
+inline int f2884_3(int x) { return x * 3; }
+inline int f2884_4(int x) { return x * 4; }
+inline int f2884_5(int x) { return x * 5; }
+inline int f2884_6(int x) { return x * 6; }
+inline int f2884_7(int x) { return x * 7; }
+inline int f2884_8(int x) { return x * 8; }
+inline int f2884_9(int x) { return x * 9; }
+inline int f2884_10(int x) { return x * 10; }
+inline int f2884_11(int x) { return x * 11; }
+inline int f2884_12(int x) { return x * 12; }
+inline int f2884_13(int x) { return x * 13; }
+inline int f2884_14(int x) { return x * 14; }
+inline int f2884_15(int x) { return x * 15; }
+inline int f2884_16(int x) { return x * 16; }
+inline int f2884_17(int x) { return x * 17; }
+inline int f2884_18(int x) { return x * 18; }
+inline int f2884_19(int x) { return x * 19; }
+inline int f2884_20(int x) { return x * 20; }
+inline int f2884_21(int x) { return x * 21; }
+inline int f2884_22(int x) { return x * 22; }
+inline int f2884_23(int x) { return x * 23; }
+inline int f2884_24(int x) { return x * 24; }
+inline int f2884_25(int x) { return x * 25; }
+inline int f2884_26(int x) { return x * 26; }
+inline int f2884_27(int x) { return x * 27; }
+inline int f2884_28(int x) { return x * 28; }
+inline int f2884_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2886 */
+#include <vector>
+#include "h8968.h"
+#include "h3238.h"
+#include "h1508.h"
+#include "h3533.h"
+#include "h798.h"
+#ifdef X
+#include "h2670.h"
+#endif
+struct S2886 { int a; const char *s = "x//y"; };
+inline int f2886_0(int x) { return x * 0; }
+inline int f2886_1(int x) { return x * 1; }
+inline int f2886_2(int x) { return x * 2; }
+inline int f2886_3(int x) { return x * 3; }
+inline int f2886_4(int x) { return x * 4; }
+inline int f2886_5(int x) { return x * 5; }
+inline int f2886_6(int x) { return x * 6; }
+inline int f2886_7(int x) { return x * 7; }
+inline int f2886_8(int x) { return x * 8; }
+inline int f2886_9(int x) { return x * 9; }
+inline int f2886_10(int x) { return x * 10; }
+inline int f2886_11(int x) { return x * 11; }
+inline int f2886_12(int x) { return x * 12; }
+inline int f2886_13(int x) { return x * 13; }
+inline int f2886_14(int x) { return x * 14; }
+inline int f2886_15(int x) { return x * 15; }
+inline int f2886_16(int x) { return x * 16; }
+inline int f2886_17(int x) { return x * 17; }
+inline int f2886_18(int x) { return x * 18; }
+inline int f2886_19(int x) { return x * 19; }
+inline int f2886_20(int x) { return x * 20; }
+inline int f2886_21(int x) { return x * 21; }
+inline int f2886_22(int x) { return x * 22; }
+inline int f2886_23(int x) { return x * 23; }
+inline int f2886_24(int x) { return x * 24; }
+inline int f2886_25(int x) { return x * 25; }
+inline int f2886_26(int x) { return x * 26; }
+inline int f2886_27(int x) { return x * 27; }
+inline int f2886_28(int x) { return x * 28; }
+inline int f2886_29(int x) { return x * 29; }
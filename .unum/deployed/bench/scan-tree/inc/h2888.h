@@ -0,0 +1,42 @@
+#pragma once
+/* header 2888 */
+#include <vector>
+#include "h26.h"
+#include "h9142.h"
+#include "h2881.h"
+#include "h8544.h"
+#include "h7969.h"
+#ifdef X
+#include "h7332.h"
+#endif
+struct S2888 { int a; const char *s = "x//y"; };
+inline int f2888_0(int x) { return x * 0; }
+inline int f2888_1(int x) { return x * 1; }
+inline int f2888_2(int x) { return x * 2; }
+inline int f2888_3(int x) { return x * 3; }
+inline int f2888_4(int x) { return x * 4; }
+inline int f2888_5(int x) { return x * 5; }
+inline int f2888_6(int x) { return x * 6; }
+inline int f2888_7(int x) { return x * 7; }
+inline int f2888_8(int x) { return x * 8; }
+inline int f2888_9(int x) { return x * 9; }
+inline int f2888_10(int x) { return x * 10; }
+inline int f2888_11(int x) { return x * 11; }
+inline int f2888_12(int x) { return x * 12; }
+inline int f2888_13(int x) { return x * 13; }
+inline int f2888_14(int x) { return x * 14; }
+inline int f2888_15(int x) { return x * 15; }
+inline int f2888_16(int x) { return x * 16; }
+inline int f2888_17(int x) { return x * 17; }
+inline int f2888_18(int x) { return x * 18; }
+inline int f2888_19(int x) { return x * 19; }
+inline int f2888_20(int x) { return x * 20; }
+inline int f2888_21(int x) { return x * 21; }
+inline int f2888_22(int x) { return x * 22; }
+inline int f2888_23(int x) { return x * 23; }
+inline int f2888_24(int x) { return x * 24; }
+inline int f2888_25(int x) { return x * 25; }
+inline int f2888_26(int x) { return x * 26; }
+inline int f2888_27(int x) { return x * 27; }
+inline int f2888_28(int x) { return x * 28; }
+inline int f2888_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 289 */
+#include <vector>
+#include "h4790.h"
+#include "h2738.h"
+#include "h1421.h"
+#include "h2893.h"
+#include "h5998.h"
+#ifdef X
+#include "h7228.h"
+#endif
+struct S289 { int a; const char *s = "x//y"; };
+inline int f289_0(int x) { return x * 0; }
+inline int f289_1(int x) { return x * 1; }
+inline int f289_2(int x) { return x * 2; }
+inline int f289_3(int x) { return x * 3; }
+inline int f289_4(int x) { return x * 4; }
+inline int f289_5(int x) { return x * 5; }
+inline int f289_6(int x) { return x * 6; }
+inline int f289_7(int x) { return x * 7; }
+inline int f289_8(int x) { return x * 8; }
+inline int f289_9(int x) { return x * 9; }
+inline int f289_10(int x) { return x * 10; }
+inline int f289_11(int x) { return x * 11; }
+inline int f289_12(int x) { return x * 12; }
+inline int f289_13(int x) { return x * 13; }
+inline int f289_14(int x) { return x * 14; }
+inline int f289_15(int x) { return x * 15; }
+inline int f289_16(int x) { return x * 16; }
+inline int f289_17(int x) { return x * 17; }
+inline int f289_18(int x) { return x * 18; }
+inline int f289_19(int x) { return x * 19; }
+inline int f289_20(int x) { return x * 20; }
+inline int f289_21(int x) { return x * 21; }
+inline int f289_22(int x) { return x * 22; }
+inline int f289_23(int x) { return x * 23; }
+inline int f289_24(int x) { return x * 24; }
+inline int f289_25(int x) { return x * 25; }
+inline int f289_26(int x) { return x * 26; }
+inline int f289_27(int x) { return x * 27; }
+inline int f289_28(int x) { return x * 28; }
+inline int f289_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2891 */
+#include <vector>
+#include "h1881.h"
+#include "h6207.h"
+#include "h7433.h"
+#include "h1481.h"
+#include "h5591.h"
+#ifdef X
+#include "h4654.h"
+#endif
+struct S2891 { int a; const char *s = "x//y"; };
+inline int f2891_0(int x) { return x * 0; }
+inline int f2891_1(int x) { return x * 1; }
+inline int f2891_2(int x) { return x * 2; }
+inline int f2891_3(int x) { return x * 3; }
+inline int f2891_4(int x) { return x * 4; }
+inline int f2891_5(int x) { return x * 5; }
+inline int f2891_6(int x) { return x * 6; }
+inline int f2891_7(int x) { return x * 7; }
+inline int f2891_8(int x) { return x * 8; }
+inline int f2891_9(int x) { return x * 9; }
+inline int f2891_10(int x) { return x * 10; }
+inline int f2891_11(int x) { return x * 11; }
+inline int f2891_12(int x) { return x * 12; }
+inline int f2891_13(int x) { return x * 13; }
+inline int f2891_14(int x) { return x * 14; }
+inline int f2891_15(int x) { return x * 15; }
+inline int f2891_16(int x) { return x * 16; }
+inline int f2891_17(int x) { return x * 17; }
+inline int f2891_18(int x) { return x * 18; }
+inline int f2891_19(int x) { return x * 19; }
+inline int f2891_20(int x) { return x * 20; }
+inline int f2891_21(int x) { return x * 21; }
+inline int f2891_22(int x) { return x * 22; }
+inline int f2891_23(int x) { return x * 23; }
+inline int f2891_24(int x) { return x * 24; }
+inline int f2891_25(int x) { return x * 25; }
+inline int f2891_26(int x) { return x * 26; }
+inline int f2891_27(int x) { return x * 27; }
+inline int f2891_28(int x) { return x * 28; }
+inline int f2891_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2893 */
+#include <vector>
+#include "h9000.h"
+#include "h4759.h"
+#include "h3082.h"
+#include "h37.h"
+#include "h9467.h"
+#ifdef X
+#include "h7914.h"
+#endif
+struct S2893 { int a; const char *s = "x//y"; };
+inline int f2893_0(int x) { return x * 0; }
+inline int f2893_1(int x) { return x * 1; }
+inline int f2893_2(int x) { return x * 2; }
+inline int f2893_3(int x) { return x * 3; }
+inline int f2893_4(int x) { return x * 4; }
+inline int f2893_5(int x) { return x * 5; }
+inline int f2893_6(int x) { return x * 6; }
+inline int f2893_7(int x) { return x * 7; }
+inline int f2893_8(int x) { return x * 8; }
+inline int f2893_9(int x) { return x * 9; }
+inline int f2893_10(int x) { return x * 10; }
+inline int f2893_11(int x) { return x * 11; }
+inline int f2893_12(int x) { return x * 12; }
+inline int f2893_13(int x) { return x * 13; }
+inline int f2893_14(int x) { return x * 14; }
+inline int f2893_15(int x) { return x * 15; }
+inline int f2893_16(int x) { return x * 16; }
+inline int f2893_17(int x) { return x * 17; }
+inline int f2893_18(int x) { return x * 18; }
+inline int f2893_19(int x) { return x * 19; }
+inline int f2893_20(int x) { return x * 20; }
+inline int f2893_21(int x) { return x * 21; }
+inline int f2893_22(int x) { return x * 22; }
+inline int f2893_23(int x) { return x * 23; }
+inline int f2893_24(int x) { return x * 24; }
+inline int f2893_25(int x) { return x * 25; }
+inline int f2893_26(int x) { return x * 26; }
+inline int f2893_27(int x) { return x * 27; }
+inline int f2893_28(int x) { return x * 28; }
+inline int f2893_29(int x) { return x * 29; }
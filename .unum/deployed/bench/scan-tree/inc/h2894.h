@@ -0,0 +1,42 @@
+#pragma once
+/* header 2894 */
+#include <vector>
+#include "h8723.h"
+#include "h6173.h"
+#include "h8147.h"
+#include "h2565.h"
+#include "h1977.h"
+#ifdef X
+#include "h3888.h"
+#endif
+struct S2894 { int a; const char *s = "x//y"; };
+inline int f2894_0(int x) { return x * 0; }
+inline int f2894_1(int x) { return x * 1; }
+inline int f2894_2(int x) { return x * 2; }
+inline int f2894_3(int x) { return x * 3; }
+inline int f2894_4(int x) { return x * 4; }
+inline int f2894_5(int x) { return x * 5; }
+inline int f2894_6(int x) { return x * 6; }
+inline int f2894_7(int x) { return x * 7; }
+inline int f2894_8(int x) { return x * 8; }
+inline int f2894_9(int x) { return x * 9; }
+inline int f2894_10(int x) { return x * 10; }
+inline int f2894_11(int x) { return x * 11; }
+inline int f2894_12(int x) { return x * 12; }
+inline int f2894_13(int x) { return x * 13; }
+inline int f2894_14(int x) { return x * 14; }
+inline int f2894_15(int x) { return x * 15; }
+inline int f2894_16(int x) { return x * 16; }
+inline int f2894_17(int x) { return x * 17; }
+inline int f2894_18(int x) { return x * 18; }
+inline int f2894_19(int x) { return x * 19; }
+inline int f2894_20(int x) { return x * 20; }
+inline int f2894_21(int x) { return x * 21; }
+inline int f2894_22(int x) { return x * 22; }
+inline int f2894_23(int x) { return x * 23; }
+inline int f2894_24(int x) { return x * 24; }
+inline int f2894_25(int x) { return x * 25; }
+inline int f2894_26(int x) { return x * 26; }
+inline int f2894_27(int x) { return x * 27; }
+inline int f2894_28(int x) { return x * 28; }
+inline int f2894_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2895 */
+#include <vector>
+#include "h3180.h"
+#include "h5680.h"
+#include "h6523.h"
+#include "h6392.h"
+#include "h2656.h"
+#ifdef X
+#include "h7891.h"
+#endif
+struct S2895 { int a; const char *s = "x//y"; };
+inline int f2895_0(int x) { return x * 0; }
+inline int f2895_1(int x) { return x * 1; }
+inline int f2895_2(int x) { return x * 2; }
+inline int f2895_3(int x) { return x * 3; }
+inline int f2895_4(int x) { return x * 4; }
+inline int f2895_5(int x) { return x * 5; }
+inline int f2895_6(int x) { return x * 6; }
+inline int f2895_7(int x) { return x * 7; }
+inline int f2895_8(int x) { return x * 8; }
+inline int f2895_9(int x) { return x * 9; }
+inline int f2895_10(int x) { return x * 10; }
+inline int f2895_11(int x) { return x * 11; }
+inline int f2895_12(int x) { return x * 12; }
+inline int f2895_13(int x) { return x * 13; }
+inline int f2895_14(int x) { return x * 14; }
+inline int f2895_15(int x) { return x * 15; }
+inline int f2895_16(int x) { return x * 16; }
+inline int f2895_17(int x) { return x * 17; }
+inline int f2895_18(int x) { return x * 18; }
+inline int f2895_19(int x) { return x * 19; }
+inline int f2895_20(int x) { return x * 20; }
+inline int f2895_21(int x) { return x * 21; }
+inline int f2895_22(int x) { return x * 22; }
+inline int f2895_23(int x) { return x * 23; }
+inline int f2895_24(int x) { return x * 24; }
+inline int f2895_25(int x) { return x * 25; }
+inline int f2895_26(int x) { return x * 26; }
+inline int f2895_27(int x) { return x * 27; }
+inline int f2895_28(int x) { return x * 28; }
+inline int f2895_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2896 */
+#include <vector>
+#include "h2459.h"
+#include "h1241.h"
+#include "h4454.h"
+#include "h109.h"
+#include "h8882.h"
+#ifdef X
+#include "h6255.h"
+#endif
+struct S2896 { int a; const char *s = "x//y"; };
+inline int f2896_0(int x) { return x * 0; }
+inline int f2896_1(int x) { return x * 1; }
+inline int f2896_2(int x) { return x * 2; }
+inline int f2896_3(int x) { return x * 3; }
+inline int f2896_4(int x) { return x * 4; }
+inline int f2896_5(int x) { return x * 5; }
+inline int f2896_6(int x) { return x * 6; }
+inline int f2896_7(int x) { return x * 7; }
+inline int f2896_8(int x) { return x * 8; }
+inline int f2896_9(int x) { return x * 9; }
+inline int f2896_10(int x) { return x * 10; }
+inline int f2896_11(int x) { return x * 11; }
+inline int f2896_12(int x) { return x * 12; }
+inline int f2896_13(int x) { return x * 13; }
+inline int f2896_14(int x) { return x * 14; }
+inline int f2896_15(int x) { return x * 15; }
+inline int f2896_16(int x) { return x * 16; }
+inline int f2896_17(int x) { return x * 17; }
+inline int f2896_18(int x) { return x * 18; }
+inline int f2896_19(int x) { return x * 19; }
+inline int f2896_20(int x) { return x * 20; }
+inline int f2896_21(int x) { return x * 21; }
+inline int f2896_22(int x) { return x * 22; }
+inline int f2896_23(int x) { return x * 23; }
+inline int f2896_24(int x) { return x * 24; }
+inline int f2896_25(int x) { return x * 25; }
+inline int f2896_26(int x) { return x * 26; }
+inline int f2896_27(int x) { return x * 27; }
+inline int f2896_28(int x) { return x * 28; }
+inline int f2896_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2897 */
+#include <vector>
+#include "h1158.h"
+#include "h3609.h"
+#include "h811.h"
+#include "h7478.h"
+#include "h4937.h"
+#ifdef X
+#include "h6761.h"
+#endif
+struct S2897 { int a; const char *s = "x//y"; };
+inline int f2897_0(int x) { return x * 0; }
+inline int f2897_1(int x) { return x * 1; }
+inline int f2897_2(int x) { return x * 2; }
+inline int f2897_3(int x) { return x * 3; }
+inline int f2897_4(int x) { return x * 4; }
+inline int f2897_5(int x) { return x * 5; }
+inline int f2897_6(int x) { return x * 6; }
+inline int f2897_7(int x) { return x * 7; }
+inline int f2897_8(int x) { return x * 8; }
+inline int f2897_9(int x) { return x * 9; }
+inline int f2897_10(int x) { return x * 10; }
+inline int f2897_11(int x) { return x * 11; }
+inline int f2897_12(int x) { return x * 12; }
+inline int f2897_13(int x) { return x * 13; }
+inline int f2897_14(int x) { return x * 14; }
+inline int f2897_15(int x) { return x * 15; }
+inline int f2897_16(int x) { return x * 16; }
+inline int f2897_17(int x) { return x * 17; }
+inline int f2897_18(int x) { return x * 18; }
+inline int f2897_19(int x) { return x * 19; }
+inline int f2897_20(int x) { return x * 20; }
+inline int f2897_21(int x) { return x * 21; }
+inline int f2897_22(int x) { return x * 22; }
+inline int f2897_23(int x) { return x * 23; }
+inline int f2897_24(int x) { return x * 24; }
+inline int f2897_25(int x) { return x * 25; }
+inline int f2897_26(int x) { return x * 26; }
+inline int f2897_27(int x) { return x * 27; }
+inline int f2897_28(int x) { return x * 28; }
+inline int f2897_29(int x) { return x * 29; }
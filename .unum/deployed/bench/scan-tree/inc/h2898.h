@@ -0,0 +1,42 @@
+#pragma once
+/* header 2898 */
+#include <vector>
+#include "h1848.h"
+#include "h981.h"
+#include "h4394.h"
+#include "h1578.h"
+#include "h7092.h"
+#ifdef X
+#include "h9121.h"
+#endif
+struct S2898 { int a; const char *s = "x//y"; };
+inline int f2898_0(int x) { return x * 0; }
+inline int f2898_1(int x) { return x * 1; }
+inline int f2898_2(int x) { return x * 2; }
+inline int f2898_3(int x) { return x * 3; }
+inline int f2898_4(int x) { return x * 4; }
+inline int f2898_5(int x) { return x * 5; }
+inline int f2898_6(int x) { return x * 6; }
+inline int f2898_7(int x) { return x * 7; }
+inline int f2898_8(int x) { return x * 8; }
+inline int f2898_9(int x) { return x * 9; }
+inline int f2898_10(int x) { return x * 10; }
+inline int f2898_11(int x) { return x * 11; }
+inline int f2898_12(int x) { return x * 12; }
+inline int f2898_13(int x) { return x * 13; }
+inline int f2898_14(int x) { return x * 14; }
+inline int f2898_15(int x) { return x * 15; }
+inline int f2898_16(int x) { return x * 16; }
+inline int f2898_17(int x) { return x * 17; }
+inline int f2898_18(int x) { return x * 18; }
+inline int f2898_19(int x) { return x * 19; }
+inline int f2898_20(int x) { return x * 20; }
+inline int f2898_21(int x) { return x * 21; }
+inline int f2898_22(int x) { return x * 22; }
+inline int f2898_23(int x) { return x * 23; }
+inline int f2898_24(int x) { return x * 24; }
+inline int f2898_25(int x) { return x * 25; }
+inline int f2898_26(int x) { return x * 26; }
+inline int f2898_27(int x) { return x * 27; }
+inline int f2898_28(int x) { return x * 28; }
+inline int f2898_29(int x) { return x * 29; }
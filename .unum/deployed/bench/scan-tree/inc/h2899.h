@@ -0,0 +1,42 @@
+#pragma once
+/* header 2899 */
+#include <vector>
+#include "h9465.h"
+#include "h4634.h"
+#include "h4134.h"
+#include "h9538.h"
+#include "h4288.h"
+#ifdef X
+#include "h3877.h"
+#endif
+struct S2899 { int a; const char *s = "x//y"; };
+inline int f2899_0(int x) { return x * 0; }
+inline int f2899_1(int x) { return x * 1; }
+inline int f2899_2(int x) { return x * 2; }
+inline int f2899_3(int x) { return x * 3; }
+inline int f2899_4(int x) { return x * 4; }
+inline int f2899_5(int x) { return x * 5; }
+inline int f2899_6(int x) { return x * 6; }
+inline int f2899_7(int x) { return x * 7; }
+inline int f2899_8(int x) { return x * 8; }
+inline int f2899_9(int x) { return x * 9; }
+inline int f2899_10(int x) { return x * 10; }
+inline int f2899_11(int x) { return x * 11; }
+inline int f2899_12(int x) { return x * 12; }
+inline int f2899_13(int x) { return x * 13; }
+inline int f2899_14(int x) { return x * 14; }
+inline int f2899_15(int x) { return x * 15; }
+inline int f2899_16(int x) { return x * 16; }
+inline int f2899_17(int x) { return x * 17; }
+inline int f2899_18(int x) { return x * 18; }
+inline int f2899_19(int x) { return x * 19; }
+inline int f2899_20(int x) { return x * 20; }
+inline int f2899_21(int x) { return x * 21; }
+inline int f2899_22(int x) { return x * 22; }
+inline int f2899_23(int x) { return x * 23; }
+inline int f2899_24(int x) { return x * 24; }
+inline int f2899_25(int x) { return x * 25; }
+inline int f2899_26(int x) { return x * 26; }
+inline int f2899_27(int x) { return x * 27; }
+inline int f2899_28(int x) { return x * 28; }
+inline int f2899_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 29 */
+#include <vector>
+#include "h898.h"
+#include "h1250.h"
+#include "h6613.h"
+#include "h9228.h"
+#include "h2213.h"
+#ifdef X
+#include "h8263.h"
+#endif
+struct S29 { int a; const char *s = "x//y"; };
+inline int f29_0(int x) { return x * 0; }
+inline int f29_1(int x) { return x * 1; }
+inline int f29_2(int x) { return x * 2; }
+inline int f29_3(int x) { return x * 3; }
+inline int f29_4(int x) { return x * 4; }
+inline int f29_5(int x) { return x * 5; }
+inline int f29_6(int x) { return x * 6; }
+inline int f29_7(int x) { return x * 7; }
+inline int f29_8(int x) { return x * 8; }
+inline int f29_9(int x) { return x * 9; }
+inline int f29_10(int x) { return x * 10; }
+inline int f29_11(int x) { return x * 11; }
+inline int f29_12(int x) { return x * 12; }
+inline int f29_13(int x) { return x * 13; }
+inline int f29_14(int x) { return x * 14; }
+inline int f29_15(int x) { return x * 15; }
+inline int f29_16(int x) { return x * 16; }
+inline int f29_17(int x) { return x * 17; }
+inline int f29_18(int x) { return x * 18; }
+inline int f29_19(int x) { return x * 19; }
+inline int f29_20(int x) { return x * 20; }
+inline int f29_21(int x) { return x * 21; }
+inline int f29_22(int x) { return x * 22; }
+inline int f29_23(int x) { return x * 23; }
+inline int f29_24(int x) { return x * 24; }
+inline int f29_25(int x) { return x * 25; }
+inline int f29_26(int x) { return x * 26; }
+inline int f29_27(int x) { return x * 27; }
+inline int f29_28(int x) { return x * 28; }
+inline int f29_29(int x) { return x * 29; }
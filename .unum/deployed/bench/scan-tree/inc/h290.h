@@ -0,0 +1,42 @@
+#pragma once
+/* header 290 */
+#include <vector>
+#include "h5464.h"
+#include "h2084.h"
+#include "h5979.h"
+#include "h4618.h"
+#include "h7044.h"
+#ifdef X
+#include "h5819.h"
+#endif
+struct S290 { int a; const char *s = "x//y"; };
+inline int f290_0(int x) { return x * 0; }
+inline int f290_1(int x) { return x * 1; }
+inline int f290_2(int x) { return x * 2; }
+inline int f290_3(int x) { return x * 3; }
+inline int f290_4(int x) { return x * 4; }
+inline int f290_5(int x) { return x * 5; }
+inline int f290_6(int x) { return x * 6; }
+inline int f290_7(int x) { return x * 7; }
+inline int f290_8(int x) { return x * 8; }
+inline int f290_9(int x) { return x * 9; }
+inline int f290_10(int x) { return x * 10; }
+inline int f290_11(int x) { return x * 11; }
+inline int f290_12(int x) { return x * 12; }
+inline int f290_13(int x) { return x * 13; }
+inline int f290_14(int x) { return x * 14; }
+inline int f290_15(int x) { return x * 15; }
+inline int f290_16(int x) { return x * 16; }
+inline int f290_17(int x) { return x * 17; }
+inline int f290_18(int x) { return x * 18; }
+inline int f290_19(int x) { return x * 19; }
+inline int f290_20(int x) { return x * 20; }
+inline int f290_21(int x) { return x * 21; }
+inline int f290_22(int x) { return x * 22; }
+inline int f290_23(int x) { return x * 23; }
+inline int f290_24(int x) { return x * 24; }
+inline int f290_25(int x) { return x * 25; }
+inline int f290_26(int x) { return x * 26; }
+inline int f290_27(int x) { return x * 27; }
+inline int f290_28(int x) { return x * 28; }
+inline int f290_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2900 */
+#include <vector>
+#include "h7511.h"
+#include "h4079.h"
+#include "h7675.h"
+#include "h6884.h"
+#include "h7356.h"
+#ifdef X
+#include "h8592.h"
+#endif
+struct S2900 { int a; const char *s = "x//y"; };
+inline int f2900_0(int x) { return x * 0; }
+inline int f2900_1(int x) { return x * 1; }
+inline int f2900_2(int x) { return x * 2; }
+inline int f2900_3(int x) { return x * 3; }
+inline int f2900_4(int x) { return x * 4; }
+inline int f2900_5(int x) { return x * 5; }
+inline int f2900_6(int x) { return x * 6; }
+inline int f2900_7(int x) { return x * 7; }
+inline int f2900_8(int x) { return x * 8; }
+inline int f2900_9(int x) { return x * 9; }
+inline int f2900_10(int x) { return x * 10; }
+inline int f2900_11(int x) { return x * 11; }
+inline int f2900_12(int x) { return x * 12; }
+inline int f2900_13(int x) { return x * 13; }
+inline int f2900_14(int x) { return x * 14; }
+inline int f2900_15(int x) { return x * 15; }
+inline int f2900_16(int x) { return x * 16; }
+inline int f2900_17(int x) { return x * 17; }
+inline int f2900_18(int x) { return x * 18; }
+inline int f2900_19(int x) { return x * 19; }
+inline int f2900_20(int x) { return x * 20; }
+inline int f2900_21(int x) { return x * 21; }
+inline int f2900_22(int x) { return x * 22; }
+inline int f2900_23(int x) { return x * 23; }
+inline int f2900_24(int x) { return x * 24; }
+inline int f2900_25(int x) { return x * 25; }
+inline int f2900_26(int x) { return x * 26; }
+inline int f2900_27(int x) { return x * 27; }
+inline int f2900_28(int x) { return x * 28; }
+inline int f2900_29(int x) { return x * 29; }
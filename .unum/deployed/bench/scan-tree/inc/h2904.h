@@ -0,0 +1,42 @@
+#pragma once
+/* header 2904 */
+#include <vector>
+#include "h5873.h"
+#include "h8585.h"
+#include "h3040.h"
+#include "h2819.h"
+#include "h2607.h"
+#ifdef X
+#include "h7497.h"
+#endif
+struct S2904 { int a; const char *s = "x//y"; };
+inline int f2904_0(int x) { return x * 0; }
+inline int f2904_1(int x) { return x * 1; }
+inline int f2904_2(int x) { return x * 2; }
+inline int f2904_3(int x) { return x * 3; }
+inline int f2904_4(int x) { return x * 4; }
+inline int f2904_5(int x) { return x * 5; }
+inline int f2904_6(int x) { return x * 6; }
+inline int f2904_7(int x) { return x * 7; }
+inline int f2904_8(int x) { return x * 8; }
+inline int f2904_9(int x) { return x * 9; }
+inline int f2904_10(int x) { return x * 10; }
+inline int f2904_11(int x) { return x * 11; }
+inline int f2904_12(int x) { return x * 12; }
+inline int f2904_13(int x) { return x * 13; }
+inline int f2904_14(int x) { return x * 14; }
+inline int f2904_15(int x) { return x * 15; }
+inline int f2904_16(int x) { return x * 16; }
+inline int f2904_17(int x) { return x * 17; }
+inline int f2904_18(int x) { return x * 18; }
+inline int f2904_19(int x) { return x * 19; }
+inline int f2904_20(int x) { return x * 20; }
+inline int f2904_21(int x) { return x * 21; }
+inline int f2904_22(int x) { return x * 22; }
+inline int f2904_23(int x) { return x * 23; }
+inline int f2904_24(int x) { return x * 24; }
+inline int f2904_25(int x) { return x * 25; }
+inline int f2904_26(int x) { return x * 26; }
+inline int f2904_27(int x) { return x * 27; }
+inline int f2904_28(int x) { return x * 28; }
+inline int f2904_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2905 */
+#include <vector>
+#include "h1614.h"
+#include "h7013.h"
+#include "h3145.h"
+#include "h4178.h"
+#include "h6319.h"
+#ifdef X
+#include "h706.h"
+#endif
+struct S2905 { int a; const char *s = "x//y"; };
+inline int f2905_0(int x) { return x * 0; }
+inline int f2905_1(int x) { return x * 1; }
+inline int f2905_2(int x) { return x * 2; }
+inline int f2905_3(int x) { return x * 3; }
+inline int f2905_4(int x) { return x * 4; }
+inline int f2905_5(int x) { return x * 5; }
+inline int f2905_6(int x) { return x * 6; }
+inline int f2905_7(int x) { return x * 7; }
+inline int f2905_8(int x) { return x * 8; }
+inline int f2905_9(int x) { return x * 9; }
+inline int f2905_10(int x) { return x * 10; }
+inline int f2905_11(int x) { return x * 11; }
+inline int f2905_12(int x) { return x * 12; }
+inline int f2905_13(int x) { return x * 13; }
+inline int f2905_14(int x) { return x * 14; }
+inline int f2905_15(int x) { return x * 15; }
+inline int f2905_16(int x) { return x * 16; }
+inline int f2905_17(int x) { return x * 17; }
+inline int f2905_18(int x) { return x * 18; }
+inline int f2905_19(int x) { return x * 19; }
+inline int f2905_20(int x) { return x * 20; }
+inline int f2905_21(int x) { return x * 21; }
+inline int f2905_22(int x) { return x * 22; }
+inline int f2905_23(int x) { return x * 23; }
+inline int f2905_24(int x) { return x * 24; }
+inline int f2905_25(int x) { return x * 25; }
+inline int f2905_26(int x) { return x * 26; }
+inline int f2905_27(int x) { return x * 27; }
+inline int f2905_28(int x) { return x * 28; }
+inline int f2905_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2906 */
+#include <vector>
+#include "h2488.h"
+#include "h2838.h"
+#include "h2973.h"
+#include "h983.h"
+#include "h6610.h"
+#ifdef X
+#include "h5311.h"
+#endif
+struct S2906 { int a; const char *s = "x//y"; };
+inline int f2906_0(int x) { return x * 0; }
+inline int f2906_1(int x) { return x * 1; }
+inline int f2906_2(int x) { return x * 2; }
+inline int f2906_3(int x) { return x * 3; }
+inline int f2906_4(int x) { return x * 4; }
+inline int f2906_5(int x) { return x * 5; }
+inline int f2906_6(int x) { return x * 6; }
+inline int f2906_7(int x) { return x * 7; }
+inline int f2906_8(int x) { return x * 8; }
+inline int f2906_9(int x) { return x * 9; }
+inline int f2906_10(int x) { return x * 10; }
+inline int f2906_11(int x) { return x * 11; }
+inline int f2906_12(int x) { return x * 12; }
+inline int f2906_13(int x) { return x * 13; }
+inline int f2906_14(int x) { return x * 14; }
+inline int f2906_15(int x) { return x * 15; }
+inline int f2906_16(int x) { return x * 16; }
+inline int f2906_17(int x) { return x * 17; }
+inline int f2906_18(int x) { return x * 18; }
+inline int f2906_19(int x) { return x * 19; }
+inline int f2906_20(int x) { return x * 20; }
+inline int f2906_21(int x) { return x * 21; }
+inline int f2906_22(int x) { return x * 22; }
+inline int f2906_23(int x) { return x * 23; }
+inline int f2906_24(int x) { return x * 24; }
+inline int f2906_25(int x) { return x * 25; }
+inline int f2906_26(int x) { return x * 26; }
+inline int f2906_27(int x) { return x * 27; }
+inline int f2906_28(int x) { return x * 28; }
+inline int f2906_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2907 */
+#include <vector>
+#include "h4112.h"
+#include "h6593.h"
+#include "h2615.h"
+#include "h1776.h"
+#include "h4708.h"
+#ifdef X
+#include "h481.h"
+#endif
+struct S2907 { int a; const char *s = "x//y"; };
+inline int f2907_0(int x) { return x * 0; }
+inline int f2907_1(int x) { return x * 1; }
+inline int f2907_2(int x) { return x * 2; }
+inline int f2907_3(int x) { return x * 3; }
+inline int f2907_4(int x) { return x * 4; }
+inline int f2907_5(int x) { return x * 5; }
+inline int f2907_6(int x) { return x * 6; }
+inline int f2907_7(int x) { return x * 7; }
+inline int f2907_8(int x) { return x * 8; }
+inline int f2907_9(int x) { return x * 9; }
+inline int f2907_10(int x) { return x * 10; }
+inline int f2907_11(int x) { return x * 11; }
+inline int f2907_12(int x) { return x * 12; }
+inline int f2907_13(int x) { return x * 13; }
+inline int f2907_14(int x) { return x * 14; }
+inline int f2907_15(int x) { return x * 15; }
+inline int f2907_16(int x) { return x * 16; }
+inline int f2907_17(int x) { return x * 17; }
+inline int f2907_18(int x) { return x * 18; }
+inline int f2907_19(int x) { return x * 19; }
+inline int f2907_20(int x) { return x * 20; }
+inline int f2907_21(int x) { return x * 21; }
+inline int f2907_22(int x) { return x * 22; }
+inline int f2907_23(int x) { return x * 23; }
+inline int f2907_24(int x) { return x * 24; }
+inline int f2907_25(int x) { return x * 25; }
+inline int f2907_26(int x) { return x * 26; }
+inline int f2907_27(int x) { return x * 27; }
+inline int f2907_28(int x) { return x * 28; }
+inline int f2907_29(int x) { return x * 29; }
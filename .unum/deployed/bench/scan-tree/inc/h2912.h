@@ -0,0 +1,42 @@
+#pragma once
+/* header 2912 */
+#include <vector>
+#include "h9842.h"
+#include "h9936.h"
+#include "h88.h"
+#include "h2510.h"
+#include "h9869.h"
+#ifdef X
+#include "h2516.h"
+#endif
+struct S2912 { int a; const char *s = "x//y"; };
+inline int f2912_0(int x) { return x * 0; }
+inline int f2912_1(int x) { return x * 1; }
+inline int f2912_2(int x) { return x * 2; }
+inline int f2912_3(int x) { return x * 3; }
+inline int f2912_4(int x) { return x * 4; }
+inline int f2912_5(int x) { return x * 5; }
+inline int f2912_6(int x) { return x * 6; }
+inline int f2912_7(int x) { return x * 7; }
+inline int f2912_8(int x) { return x * 8; }
+inline int f2912_9(int x) { return x * 9; }
+inline int f2912_10(int x) { return x * 10; }
+inline int f2912_11(int x) { return x * 11; }
+inline int f2912_12(int x) { return x * 12; }
+inline int f2912_13(int x) { return x * 13; }
+inline int f2912_14(int x) { return x * 14; }
+inline int f2912_15(int x) { return x * 15; }
+inline int f2912_16(int x) { return x * 16; }
+inline int f2912_17(int x) { return x * 17; }
+inline int f2912_18(int x) { return x * 18; }
+inline int f2912_19(int x) { return x * 19; }
+inline int f2912_20(int x) { return x * 20; }
+inline int f2912_21(int x) { return x * 21; }
+inline int f2912_22(int x) { return x * 22; }
+inline int f2912_23(int x) { return x * 23; }
+inline int f2912_24(int x) { return x * 24; }
+inline int f2912_25(int x) { return x * 25; }
+inline int f2912_26(int x) { return x * 26; }
+inline int f2912_27(int x) { return x * 27; }
+inline int f2912_28(int x) { return x * 28; }
+inline int f2912_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2915 */
+#include <vector>
+#include "h8392.h"
+#include "h1844.h"
+#include "h7550.h"
+#include "h3838.h"
+#include "h8591.h"
+#ifdef X
+#include "h6990.h"
+#endif
+struct S2915 { int a; const char *s = "x//y"; };
+inline int f2915_0(int x) { return x * 0; }
+inline int f2915_1(int x) { return x * 1; }
+inline int f2915_2(int x) { return x * 2; }
+inline int f2915_3(int x) { return x * 3; }
+inline int f2915_4(int x) { return x * 4; }
+inline int f2915_5(int x) { return x * 5; }
+inline int f2915_6(int x) { return x * 6; }
+inline int f2915_7(int x) { return x * 7; }
+inline int f2915_8(int x) { return x * 8; }
+inline int f2915_9(int x) { return x * 9; }
+inline int f2915_10(int x) { return x * 10; }
+inline int f2915_11(int x) { return x * 11; }
+inline int f2915_12(int x) { return x * 12; }
+inline int f2915_13(int x) { return x * 13; }
+inline int f2915_14(int x) { return x * 14; }
+inline int f2915_15(int x) { return x * 15; }
+inline int f2915_16(int x) { return x * 16; }
+inline int f2915_17(int x) { return x * 17; }
+inline int f2915_18(int x) { return x * 18; }
+inline int f2915_19(int x) { return x * 19; }
+inline int f2915_20(int x) { return x * 20; }
+inline int f2915_21(int x) { return x * 21; }
+inline int f2915_22(int x) { return x * 22; }
+inline int f2915_23(int x) { return x * 23; }
+inline int f2915_24(int x) { return x * 24; }
+inline int f2915_25(int x) { return x * 25; }
+inline int f2915_26(int x) { return x * 26; }
+inline int f2915_27(int x) { return x * 27; }
+inline int f2915_28(int x) { return x * 28; }
+inline int f2915_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2916 */
+#include <vector>
+#include "h1140.h"
+#include "h6916.h"
+#include "h1802.h"
+#include "h4230.h"
+#include "h480.h"
+#ifdef X
+#include "h8977.h"
+#endif
+struct S2916 { int a; const char *s = "x//y"; };
+inline int f2916_0(int x) { return x * 0; }
+inline int f2916_1(int x) { return x * 1; }
+inline int f2916_2(int x) { return x * 2; }
+inline int f2916_3(int x) { return x * 3; }
+inline int f2916_4(int x) { return x * 4; }
+inline int f2916_5(int x) { return x * 5; }
+inline int f2916_6(int x) { return x * 6; }
+inline int f2916_7(int x) { return x * 7; }
+inline int f2916_8(int x) { return x * 8; }
+inline int f2916_9(int x) { return x * 9; }
+inline int f2916_10(int x) { return x * 10; }
+inline int f2916_11(int x) { return x * 11; }
+inline int f2916_12(int x) { return x * 12; }
+inline int f2916_13(int x) { return x * 13; }
+inline int f2916_14(int x) { return x * 14; }
+inline int f2916_15(int x) { return x * 15; }
+inline int f2916_16(int x) { return x * 16; }
+inline int f2916_17(int x) { return x * 17; }
+inline int f2916_18(int x) { return x * 18; }
+inline int f2916_19(int x) { return x * 19; }
+inline int f2916_20(int x) { return x * 20; }
+inline int f2916_21(int x) { return x * 21; }
+inline int f2916_22(int x) { return x * 22; }
+inline int f2916_23(int x) { return x * 23; }
+inline int f2916_24(int x) { return x * 24; }
+inline int f2916_25(int x) { return x * 25; }
+inline int f2916_26(int x) { return x * 26; }
+inline int f2916_27(int x) { return x * 27; }
+inline int f2916_28(int x) { return x * 28; }
+inline int f2916_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2918 */
+#include <vector>
+#include "h2713.h"
+#include "h2511.h"
+#include "h5955.h"
+#include "h7307.h"
+#include "h7953.h"
+#ifdef X
+#include "h1422.h"
+#endif
+struct S2918 { int a; const char *s = "x//y"; };
+inline int f2918_0(int x) { return x * 0; }
+inline int f2918_1(int x) { return x * 1; }
+inline int f2918_2(int x) { return x * 2; }
+inline int f2918_3(int x) { return x * 3; }
+inline int f2918_4(int x) { return x * 4; }
+inline int f2918_5(int x) { return x * 5; }
+inline int f2918_6(int x) { return x * 6; }
+inline int f2918_7(int x) { return x * 7; }
+inline int f2918_8(int x) { return x * 8; }
+inline int f2918_9(int x) { return x * 9; }
+inline int f2918_10(int x) { return x * 10; }
+inline int f2918_11(int x) { return x * 11; }
+inline int f2918_12(int x) { return x * 12; }
+inline int f2918_13(int x) { return x * 13; }
+inline int f2918_14(int x) { return x * 14; }
+inline int f2918_15(int x) { return x * 15; }
+inline int f2918_16(int x) { return x * 16; }
+inline int f2918_17(int x) { return x * 17; }
+inline int f2918_18(int x) { return x * 18; }
+inline int f2918_19(int x) { return x * 19; }
+inline int f2918_20(int x) { return x * 20; }
+inline int f2918_21(int x) { return x * 21; }
+inline int f2918_22(int x) { return x * 22; }
+inline int f2918_23(int x) { return x * 23; }
+inline int f2918_24(int x) { return x * 24; }
+inline int f2918_25(int x) { return x * 25; }
+inline int f2918_26(int x) { return x * 26; }
+inline int f2918_27(int x) { return x * 27; }
+inline int f2918_28(int x) { return x * 28; }
+inline int f2918_29(int x) { return x * 29; }
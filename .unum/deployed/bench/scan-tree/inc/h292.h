@@ -0,0 +1,42 @@
+#pragma once
+/* header 292 */
+#include <vector>
+#include "h247.h"
+#include "h6587.h"
+#include "h8651.h"
+#include "h719.h"
+#include "h1626.h"
+#ifdef X
+#include "h2302.h"
+#endif
+struct S292 { int a; const char *s = "x//y"; };
+inline int f292_0(int x) { return x * 0; }
+inline int f292_1(int x) { return x * 1; }
+inline int f292_2(int x) { return x * 2; }
+inline int f292_3(int x) { return x * 3; }
+inline int f292_4(int x) { return x * 4; }
+inline int f292_5(int x) { return x * 5; }
+inline int f292_6(int x) { return x * 6; }
+inline int f292_7(int x) { return x * 7; }
+inline int f292_8(int x) { return x * 8; }
+inline int f292_9(int x) { return x * 9; }
+inline int f292_10(int x) { return x * 10; }
+inline int f292_11(int x) { return x * 11; }
+inline int f292_12(int x) { return x * 12; }
+inline int f292_13(int x) { return x * 13; }
+inline int f292_14(int x) { return x * 14; }
+inline int f292_15(int x) { return x * 15; }
+inline int f292_16(int x) { return x * 16; }
+inline int f292_17(int x) { return x * 17; }
+inline int f292_18(int x) { return x * 18; }
+inline int f292_19(int x) { return x * 19; }
+inline int f292_20(int x) { return x * 20; }
+inline int f292_21(int x) { return x * 21; }
+inline int f292_22(int x) { return x * 22; }
+inline int f292_23(int x) { return x * 23; }
+inline int f292_24(int x) { return x * 24; }
+inline int f292_25(int x) { return x * 25; }
+inline int f292_26(int x) { return x * 26; }
+inline int f292_27(int x) { return x * 27; }
+inline int f292_28(int x) { return x * 28; }
+inline int f292_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2920 */
+#include <vector>
+#include "h9128.h"
+#include "h1293.h"
+#include "h6780.h"
+#include "h9720.h"
+#include "h2852.h"
+#ifdef X
+#include "h1962.h"
+#endif
+struct S2920 { int a; const char *s = "x//y"; };
+inline int f2920_0(int x) { return x * 0; }
+inline int f2920_1(int x) { return x * 1; }
+inline int f2920_2(int x) { return x * 2; }
+inline int f2920_3(int x) { return x * 3; }
+inline int f2920_4(int x) { return x * 4; }
+inline int f2920_5(int x) { return x * 5; }
+inline int f2920_6(int x) { return x * 6; }
+inline int f2920_7(int x) { return x * 7; }
+inline int f2920_8(int x) { return x * 8; }
+inline int f2920_9(int x) { return x * 9; }
+inline int f2920_10(int x) { return x * 10; }
+inline int f2920_11(int x) { return x * 11; }
+inline int f2920_12(int x) { return x * 12; }
+inline int f2920_13(int x) { return x * 13; }
+inline int f2920_14(int x) { return x * 14; }
+inline int f2920_15(int x) { return x * 15; }
+inline int f2920_16(int x) { return x * 16; }
+inline int f2920_17(int x) { return x * 17; }
+inline int f2920_18(int x) { return x * 18; }
+inline int f2920_19(int x) { return x * 19; }
+inline int f2920_20(int x) { return x * 20; }
+inline int f2920_21(int x) { return x * 21; }
+inline int f2920_22(int x) { return x * 22; }
+inline int f2920_23(int x) { return x * 23; }
+inline int f2920_24(int x) { return x * 24; }
+inline int f2920_25(int x) { return x * 25; }
+inline int f2920_26(int x) { return x * 26; }
+inline int f2920_27(int x) { return x * 27; }
+inline int f2920_28(int x) { return x * 28; }
+inline int f2920_29(int x) { return x * 29; }
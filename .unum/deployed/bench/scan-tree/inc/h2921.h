@@ -0,0 +1,42 @@
+#pragma once
+/* header 2921 */
+#include <vector>
+#include "h653.h"
+#include "h5361.h"
+#include "h5878.h"
+#include "h9181.h"
+#include "h7074.h"
+#ifdef X
+#include "h7819.h"
+#endif
+struct S2921 { int a; const char *s = "x//y"; };
+inline int f2921_0(int x) { return x * 0; }
+inline int f2921_1(int x) { return x * 1; }
+inline int f2921_2(int x) { return x * 2; }
+inline int f2921_3(int x) { return x * 3; }
+inline int f2921_4(int x) { return x * 4; }
+inline int f2921_5(int x) { return x * 5; }
+inline int f2921_6(int x) { return x * 6; }
+inline int f2921_7(int x) { return x * 7; }
+inline int f2921_8(int x) { return x * 8; }
+inline int f2921_9(int x) { return x * 9; }
+inline int f2921_10(int x) { return x * 10; }
+inline int f2921_11(int x) { return x * 11; }
+inline int f2921_12(int x) { return x * 12; }
+inline int f2921_13(int x) { return x * 13; }
+inline int f2921_14(int x) { return x * 14; }
+inline int f2921_15(int x) { return x * 15; }
+inline int f2921_16(int x) { return x * 16; }
+inline int f2921_17(int x) { return x * 17; }
+inline int f2921_18(int x) { return x * 18; }
+inline int f2921_19(int x) { return x * 19; }
+inline int f2921_20(int x) { return x * 20; }
+inline int f2921_21(int x) { return x * 21; }
+inline int f2921_22(int x) { return x * 22; }
+inline int f2921_23(int x) { return x * 23; }
+inline int f2921_24(int x) { return x * 24; }
+inline int f2921_25(int x) { return x * 25; }
+inline int f2921_26(int x) { return x * 26; }
+inline int f2921_27(int x) { return x * 27; }
+inline int f2921_28(int x) { return x * 28; }
+inline int f2921_29(int x) { return x * 29; }
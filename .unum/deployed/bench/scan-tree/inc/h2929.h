@@ -0,0 +1,42 @@
+#pragma once
+/* header 2929 */
+#include <vector>
+#include "h3937.h"
+#include "h2527.h"
+#include "h8049.h"
+#include "h8695.h"
+#include "h4580.h"
+#ifdef X
+#include "h2331.h"
+#endif
+struct S2929 { int a; const char *s = "x//y"; };
+inline int f2929_0(int x) { return x * 0; }
+inline int f2929_1(int x) { return x * 1; }
+inline int f2929_2(int x) { return x * 2; }
+inline int f2929_3(int x) { return x * 3; }
+inline int f2929_4(int x) { return x * 4; }
+inline int f2929_5(int x) { return x * 5; }
+inline int f2929_6(int x) { return x * 6; }
+inline int f2929_7(int x) { return x * 7; }
+inline int f2929_8(int x) { return x * 8; }
+inline int f2929_9(int x) { return x * 9; }
+inline int f2929_10(int x) { return x * 10; }
+inline int f2929_11(int x) { return x * 11; }
+inline int f2929_12(int x) { return x * 12; }
+inline int f2929_13(int x) { return x * 13; }
+inline int f2929_14(int x) { return x * 14; }
+inline int f2929_15(int x) { return x * 15; }
+inline int f2929_16(int x) { return x * 16; }
+inline int f2929_17(int x) { return x * 17; }
+inline int f2929_18(int x) { return x * 18; }
+inline int f2929_19(int x) { return x * 19; }
+inline int f2929_20(int x) { return x * 20; }
+inline int f2929_21(int x) { return x * 21; }
+inline int f2929_22(int x) { return x * 22; }
+inline int f2929_23(int x) { return x * 23; }
+inline int f2929_24(int x) { return x * 24; }
+inline int f2929_25(int x) { return x * 25; }
+inline int f2929_26(int x) { return x * 26; }
+inline int f2929_27(int x) { return x * 27; }
+inline int f2929_28(int x) { return x * 28; }
+inline int f2929_29(int x) { return x * 29; }
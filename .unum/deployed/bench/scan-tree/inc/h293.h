@@ -0,0 +1,42 @@
+#pragma once
+/* header 293 */
+#include <vector>
+#include "h2144.h"
+#include "h971.h"
+#include "h4079.h"
+#include "h3943.h"
+#include "h2939.h"
+#ifdef X
+#include "h4710.h"
+#endif
+struct S293 { int a; const char *s = "x//y"; };
+inline int f293_0(int x) { return x * 0; }
+inline int f293_1(int x) { return x * 1; }
+inline int f293_2(int x) { return x * 2; }
+inline int f293_3(int x) { return x * 3; }
+inline int f293_4(int x) { return x * 4; }
+inline int f293_5(int x) { return x * 5; }
+inline int f293_6(int x) { return x * 6; }
+inline int f293_7(int x) { return x * 7; }
+inline int f293_8(int x) { return x * 8; }
+inline int f293_9(int x) { return x * 9; }
+inline int f293_10(int x) { return x * 10; }
+inline int f293_11(int x) { return x * 11; }
+inline int f293_12(int x) { return x * 12; }
+inline int f293_13(int x) { return x * 13; }
+inline int f293_14(int x) { return x * 14; }
+inline int f293_15(int x) { return x * 15; }
+inline int f293_16(int x) { return x * 16; }
+inline int f293_17(int x) { return x * 17; }
+inline int f293_18(int x) { return x * 18; }
+inline int f293_19(int x) { return x * 19; }
+inline int f293_20(int x) { return x * 20; }
+inline int f293_21(int x) { return x * 21; }
+inline int f293_22(int x) { return x * 22; }
+inline int f293_23(int x) { return x * 23; }
+inline int f293_24(int x) { return x * 24; }
+inline int f293_25(int x) { return x * 25; }
+inline int f293_26(int x) { return x * 26; }
+inline int f293_27(int x) { return x * 27; }
+inline int f293_28(int x) { return x * 28; }
+inline int f293_29(int x) { return x * 29; }
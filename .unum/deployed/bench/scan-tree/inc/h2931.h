@@ -0,0 +1,42 @@
+#pragma once
+/* header 2931 */
+#include <vector>
+#include "h1698.h"
+#include "h5662.h"
+#include "h1849.h"
+#include "h193.h"
+#include "h8315.h"
+#ifdef X
+#include "h7459.h"
+#endif
+struct S2931 { int a; const char *s = "x//y"; };
+inline int f2931_0(int x) { return x * 0; }
+inline int f2931_1(int x) { return x * 1; }
+inline int f2931_2(int x) { return x * 2; }
+inline int f2931_3(int x) { return x * 3; }
+inline int f2931_4(int x) { return x * 4; }
+inline int f2931_5(int x) { return x * 5; }
+inline int f2931_6(int x) { return x * 6; }
+inline int f2931_7(int x) { return x * 7; }
+inline int f2931_8(int x) { return x * 8; }
+inline int f2931_9(int x) { return x * 9; }
+inline int f2931_10(int x) { return x * 10; }
+inline int f2931_11(int x) { return x * 11; }
+inline int f2931_12(int x) { return x * 12; }
+inline int f2931_13(int x) { return x * 13; }
+inline int f2931_14(int x) { return x * 14; }
+inline int f2931_15(int x) { return x * 15; }
+inline int f2931_16(int x) { return x * 16; }
+inline int f2931_17(int x) { return x * 17; }
+inline int f2931_18(int x) { return x * 18; }
+inline int f2931_19(int x) { return x * 19; }
+inline int f2931_20(int x) { return x * 20; }
+inline int f2931_21(int x) { return x * 21; }
+inline int f2931_22(int x) { return x * 22; }
+inline int f2931_23(int x) { return x * 23; }
+inline int f2931_24(int x) { return x * 24; }
+inline int f2931_25(int x) { return x * 25; }
+inline int f2931_26(int x) { return x * 26; }
+inline int f2931_27(int x) { return x * 27; }
+inline int f2931_28(int x) { return x * 28; }
+inline int f2931_29(int x) { return x * 29; }
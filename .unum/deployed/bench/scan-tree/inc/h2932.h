@@ -0,0 +1,42 @@
+#pragma once
+/* header 2932 */
+#include <vector>
+#include "h3941.h"
+#include "h1969.h"
+#include "h2991.h"
+#include "h3236.h"
+#include "h8093.h"
+#ifdef X
+#include "h4606.h"
+#endif
+struct S2932 { int a; const char *s = "x//y"; };
+inline int f2932_0(int x) { return x * 0; }
+inline int f2932_1(int x) { return x * 1; }
+inline int f2932_2(int x) { return x * 2; }
+inline int f2932_3(int x) { return x * 3; }
+inline int f2932_4(int x) { return x * 4; }
+inline int f2932_5(int x) { return x * 5; }
+inline int f2932_6(int x) { return x * 6; }
+inline int f2932_7(int x) { return x * 7; }
+inline int f2932_8(int x) { return x * 8; }
+inline int f2932_9(int x) { return x * 9; }
+inline int f2932_10(int x) { return x * 10; }
+inline int f2932_11(int x) { return x * 11; }
+inline int f2932_12(int x) { return x * 12; }
+inline int f2932_13(int x) { return x * 13; }
+inline int f2932_14(int x) { return x * 14; }
+inline int f2932_15(int x) { return x * 15; }
+inline int f2932_16(int x) { return x * 16; }
+inline int f2932_17(int x) { return x * 17; }
+inline int f2932_18(int x) { return x * 18; }
+inline int f2932_19(int x) { return x * 19; }
+inline int f2932_20(int x) { return x * 20; }
+inline int f2932_21(int x) { return x * 21; }
+inline int f2932_22(int x) { return x * 22; }
+inline int f2932_23(int x) { return x * 23; }
+inline int f2932_24(int x) { return x * 24; }
+inline int f2932_25(int x) { return x * 25; }
+inline int f2932_26(int x) { return x * 26; }
+inline int f2932_27(int x) { return x * 27; }
+inline int f2932_28(int x) { return x * 28; }
+inline int f2932_29(int x) { return x * 29; }
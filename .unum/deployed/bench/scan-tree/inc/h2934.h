@@ -0,0 +1,42 @@
+#pragma once
+/* header 2934 */
+#include <vector>
+#include "h5799.h"
+#include "h1207.h"
+#include "h8599.h"
+#include "h8768.h"
+#include "h9547.h"
+#ifdef X
+#include "h3133.h"
+#endif
+struct S2934 { int a; const char *s = "x//y"; };
+inline int f2934_0(int x) { return x * 0; }
+inline int f2934_1(int x) { return x * 1; }
+inline int f2934_2(int x) { return x * 2; }
+inline int f2934_3(int x) { return x * 3; }
+inline int f2934_4(int x) { return x * 4; }
+inline int f2934_5(int x) { return x * 5; }
+inline int f2934_6(int x) { return x * 6; }
+inline int f2934_7(int x) { return x * 7; }
+inline int f2934_8(int x) { return x * 8; }
+inline int f2934_9(int x) { return x * 9; }
+inline int f2934_10(int x) { return x * 10; }
+inline int f2934_11(int x) { return x * 11; }
+inline int f2934_12(int x) { return x * 12; }
+inline int f2934_13(int x) { return x * 13; }
+inline int f2934_14(int x) { return x * 14; }
+inline int f2934_15(int x) { return x * 15; }
+inline int f2934_16(int x) { return x * 16; }
+inline int f2934_17(int x) { return x * 17; }
+inline int f2934_18(int x) { return x * 18; }
+inline int f2934_19(int x) { return x * 19; }
+inline int f2934_20(int x) { return x * 20; }
+inline int f2934_21(int x) { return x * 21; }
+inline int f2934_22(int x) { return x * 22; }
+inline int f2934_23(int x) { return x * 23; }
+inline int f2934_24(int x) { return x * 24; }
+inline int f2934_25(int x) { return x * 25; }
+inline int f2934_26(int x) { return x * 26; }
+inline int f2934_27(int x) { return x * 27; }
+inline int f2934_28(int x) { return x * 28; }
+inline int f2934_29(int x) { return x * 29; }
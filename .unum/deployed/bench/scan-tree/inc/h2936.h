@@ -0,0 +1,42 @@
+#pragma once
+/* header 2936 */
+#include <vector>
+#include "h4659.h"
+#include "h6129.h"
+#include "h4839.h"
+#include "h4957.h"
+#include "h8705.h"
+#ifdef X
+#include "h8310.h"
+#endif
+struct S2936 { int a; const char *s = "x//y"; };
+inline int f2936_0(int x) { return x * 0; }
+inline int f2936_1(int x) { return x * 1; }
+inline int f2936_2(int x) { return x * 2; }
+inline int f2936_3(int x) { return x * 3; }
+inline int f2936_4(int x) { return x * 4; }
+inline int f2936_5(int x) { return x * 5; }
+inline int f2936_6(int x) { return x * 6; }
+inline int f2936_7(int x) { return x * 7; }
+inline int f2936_8(int x) { return x * 8; }
+inline int f2936_9(int x) { return x * 9; }
+inline int f2936_10(int x) { return x * 10; }
+inline int f2936_11(int x) { return x * 11; }
+inline int f2936_12(int x) { return x * 12; }
+inline int f2936_13(int x) { return x * 13; }
+inline int f2936_14(int x) { return x * 14; }
+inline int f2936_15(int x) { return x * 15; }
+inline int f2936_16(int x) { return x * 16; }
+inline int f2936_17(int x) { return x * 17; }
+inline int f2936_18(int x) { return x * 18; }
+inline int f2936_19(int x) { return x * 19; }
+inline int f2936_20(int x) { return x * 20; }
+inline int f2936_21(int x) { return x * 21; }
+inline int f2936_22(int x) { return x * 22; }
+inline int f2936_23(int x) { return x * 23; }
+inline int f2936_24(int x) { return x * 24; }
+inline int f2936_25(int x) { return x * 25; }
+inline int f2936_26(int x) { return x * 26; }
+inline int f2936_27(int x) { return x * 27; }
+inline int f2936_28(int x) { return x * 28; }
+inline int f2936_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2940 */
+#include <vector>
+#include "h5053.h"
+#include "h6888.h"
+#include "h8304.h"
+#include "h2053.h"
+#include "h3069.h"
+#ifdef X
+#include "h8878.h"
+#endif
+struct S2940 { int a; const char *s = "x//y"; };
+inline int f2940_0(int x) { return x * 0; }
+inline int f2940_1(int x) { return x * 1; }
+inline int f2940_2(int x) { return x * 2; }
+inline int f2940_3(int x) { return x * 3; }
+inline int f2940_4(int x) { return x * 4; }
+inline int f2940_5(int x) { return x * 5; }
+inline int f2940_6(int x) { return x * 6; }
+inline int f2940_7(int x) { return x * 7; }
+inline int f2940_8(int x) { return x * 8; }
+inline int f2940_9(int x) { return x * 9; }
+inline int f2940_10(int x) { return x * 10; }
+inline int f2940_11(int x) { return x * 11; }
+inline int f2940_12(int x) { return x * 12; }
+inline int f2940_13(int x) { return x * 13; }
+inline int f2940_14(int x) { return x * 14; }
+inline int f2940_15(int x) { return x * 15; }
+inline int f2940_16(int x) { return x * 16; }
+inline int f2940_17(int x) { return x * 17; }
+inline int f2940_18(int x) { return x * 18; }
+inline int f2940_19(int x) { return x * 19; }
+inline int f2940_20(int x) { return x * 20; }
+inline int f2940_21(int x) { return x * 21; }
+inline int f2940_22(int x) { return x * 22; }
+inline int f2940_23(int x) { return x * 23; }
+inline int f2940_24(int x) { return x * 24; }
+inline int f2940_25(int x) { return x * 25; }
+inline int f2940_26(int x) { return x * 26; }
+inline int f2940_27(int x) { return x * 27; }
+inline int f2940_28(int x) { return x * 28; }
+inline int f2940_29(int x) { return x * 29; }
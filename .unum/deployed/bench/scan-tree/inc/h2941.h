@@ -0,0 +1,42 @@
+#pragma once
+/* header 2941 */
+#include <vector>
+#include "h5718.h"
+#include "h5805.h"
+#include "h8947.h"
+#include "h7013.h"
+#include "h1680.h"
+#ifdef X
+#include "h1815.h"
+#endif
+struct S2941 { int a; const char *s = "x//y"; };
+inline int f2941_0(int x) { return x * 0; }
+inline int f2941_1(int x) { return x * 1; }
+inline int f2941_2(int x) { return x * 2; }
+inline int f2941_3(int x) { return x * 3; }
+inline int f2941_4(int x) { return x * 4; }
+inline int f2941_5(int x) { return x * 5; }
+inline int f2941_6(int x) { return x * 6; }
+inline int f2941_7(int x) { return x * 7; }
+inline int f2941_8(int x) { return x * 8; }
+inline int f2941_9(int x) { return x * 9; }
+inline int f2941_10(int x) { return x * 10; }
+inline int f2941_11(int x) { return x * 11; }
+inline int f2941_12(int x) { return x * 12; }
+inline int f2941_13(int x) { return x * 13; }
+inline int f2941_14(int x) { return x * 14; }
+inline int f2941_15(int x) { return x * 15; }
+inline int f2941_16(int x) { return x * 16; }
+inline int f2941_17(int x) { return x * 17; }
+inline int f2941_18(int x) { return x * 18; }
+inline int f2941_19(int x) { return x * 19; }
+inline int f2941_20(int x) { return x * 20; }
+inline int f2941_21(int x) { return x * 21; }
+inline int f2941_22(int x) { return x * 22; }
+inline int f2941_23(int x) { return x * 23; }
+inline int f2941_24(int x) { return x * 24; }
+inline int f2941_25(int x) { return x * 25; }
+inline int f2941_26(int x) { return x * 26; }
+inline int f2941_27(int x) { return x * 27; }
+inline int f2941_28(int x) { return x * 28; }
+inline int f2941_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2943 */
+#include <vector>
+#include "h2753.h"
+#include "h3169.h"
+#include "h9787.h"
+#include "h8618.h"
+#include "h6978.h"
+#ifdef X
+#include "h4180.h"
+#endif
+struct S2943 { int a; const char *s = "x//y"; };
+inline int f2943_0(int x) { return x * 0; }
+inline int f2943_1(int x) { return x * 1; }
+inline int f2943_2(int x) { return x * 2; }
+inline int f2943_3(int x) { return x * 3; }
+inline int f2943_4(int x) { return x * 4; }
+inline int f2943_5(int x) { return x * 5; }
+inline int f2943_6(int x) { return x * 6; }
+inline int f2943_7(int x) { return x * 7; }
+inline int f2943_8(int x) { return x * 8; }
+inline int f2943_9(int x) { return x * 9; }
+inline int f2943_10(int x) { return x * 10; }
+inline int f2943_11(int x) { return x * 11; }
+inline int f2943_12(int x) { return x * 12; }
+inline int f2943_13(int x) { return x * 13; }
+inline int f2943_14(int x) { return x * 14; }
+inline int f2943_15(int x) { return x * 15; }
+inline int f2943_16(int x) { return x * 16; }
+inline int f2943_17(int x) { return x * 17; }
+inline int f2943_18(int x) { return x * 18; }
+inline int f2943_19(int x) { return x * 19; }
+inline int f2943_20(int x) { return x * 20; }
+inline int f2943_21(int x) { return x * 21; }
+inline int f2943_22(int x) { return x * 22; }
+inline int f2943_23(int x) { return x * 23; }
+inline int f2943_24(int x) { return x * 24; }
+inline int f2943_25(int x) { return x * 25; }
+inline int f2943_26(int x) { return x * 26; }
+inline int f2943_27(int x) { return x * 27; }
+inline int f2943_28(int x) { return x * 28; }
+inline int f2943_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2944 */
+#include <vector>
+#include "h7900.h"
+#include "h9888.h"
+#include "h7949.h"
+#include "h4011.h"
+#include "h9684.h"
+#ifdef X
+#include "h5351.h"
+#endif
+struct S2944 { int a; const char *s = "x//y"; };
+inline int f2944_0(int x) { return x * 0; }
+inline int f2944_1(int x) { return x * 1; }
+inline int f2944_2(int x) { return x * 2; }
+inline int f2944_3(int x) { return x * 3; }
+inline int f2944_4(int x) { return x * 4; }
+inline int f2944_5(int x) { return x * 5; }
+inline int f2944_6(int x) { return x * 6; }
+inline int f2944_7(int x) { return x * 7; }
+inline int f2944_8(int x) { return x * 8; }
+inline int f2944_9(int x) { return x * 9; }
+inline int f2944_10(int x) { return x * 10; }
+inline int f2944_11(int x) { return x * 11; }
+inline int f2944_12(int x) { return x * 12; }
+inline int f2944_13(int x) { return x * 13; }
+inline int f2944_14(int x) { return x * 14; }
+inline int f2944_15(int x) { return x * 15; }
+inline int f2944_16(int x) { return x * 16; }
+inline int f2944_17(int x) { return x * 17; }
+inline int f2944_18(int x) { return x * 18; }
+inline int f2944_19(int x) { return x * 19; }
+inline int f2944_20(int x) { return x * 20; }
+inline int f2944_21(int x) { return x * 21; }
+inline int f2944_22(int x) { return x * 22; }
+inline int f2944_23(int x) { return x * 23; }
+inline int f2944_24(int x) { return x * 24; }
+inline int f2944_25(int x) { return x * 25; }
+inline int f2944_26(int x) { return x * 26; }
+inline int f2944_27(int x) { return x * 27; }
+inline int f2944_28(int x) { return x * 28; }
+inline int f2944_29(int x) { return x * 29; }
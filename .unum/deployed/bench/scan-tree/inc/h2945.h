@@ -0,0 +1,42 @@
+#pragma once
+/* header 2945 */
+#include <vector>
+#include "h7162.h"
+#include "h5489.h"
+#include "h1968.h"
+#include "h1980.h"
+#include "h4159.h"
+#ifdef X
+#include "h5744.h"
+#endif
+struct S2945 { int a; const char *s = "x//y"; };
+inline int f2945_0(int x) { return x * 0; }
+inline int f2945_1(int x) { return x * 1; }
+inline int f2945_2(int x) { return x * 2; }
+inline int f2945_3(int x) { return x * 3; }
+inline int f2945_4(int x) { return x * 4; }
+inline int f2945_5(int x) { return x * 5; }
+inline int f2945_6(int x) { return x * 6; }
+inline int f2945_7(int x) { return x * 7; }
+inline int f2945_8(int x) { return x * 8; }
+inline int f2945_9(int x) { return x * 9; }
+inline int f2945_10(int x) { return x * 10; }
+inline int f2945_11(int x) { return x * 11; }
+inline int f2945_12(int x) { return x * 12; }
+inline int f2945_13(int x) { return x * 13; }
+inline int f2945_14(int x) { return x * 14; }
+inline int f2945_15(int x) { return x * 15; }
+inline int f2945_16(int x) { return x * 16; }
+inline int f2945_17(int x) { return x * 17; }
+inline int f2945_18(int x) { return x * 18; }
+inline int f2945_19(int x) { return x * 19; }
+inline int f2945_20(int x) { return x * 20; }
+inline int f2945_21(int x) { return x * 21; }
+inline int f2945_22(int x) { return x * 22; }
+inline int f2945_23(int x) { return x * 23; }
+inline int f2945_24(int x) { return x * 24; }
+inline int f2945_25(int x) { return x * 25; }
+inline int f2945_26(int x) { return x * 26; }
+inline int f2945_27(int x) { return x * 27; }
+inline int f2945_28(int x) { return x * 28; }
+inline int f2945_29(int x) { return x * 29; }
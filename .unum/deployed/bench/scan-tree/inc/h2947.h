@@ -0,0 +1,42 @@
+#pragma once
+/* header 2947 */
+#include <vector>
+#include "h8040.h"
+#include "h9023.h"
+#include "h8581.h"
+#include "h1863.h"
+#include "h3251.h"
+#ifdef X
+#include "h624.h"
+#endif
+struct S2947 { int a; const char *s = "x//y"; };
+inline int f2947_0(int x) { return x * 0; }
+inline int f2947_1(int x) { return x * 1; }
+inline int f2947_2(int x) { return x * 2; }
+inline int f2947_3(int x) { return x * 3; }
+inline int f2947_4(int x) { return x * 4; }
+inline int f2947_5(int x) { return x * 5; }
+inline int f2947_6(int x) { return x * 6; }
+inline int f2947_7(int x) { return x * 7; }
+inline int f2947_8(int x) { return x * 8; }
+inline int f2947_9(int x) { return x * 9; }
+inline int f2947_10(int x) { return x * 10; }
+inline int f2947_11(int x) { return x * 11; }
+inline int f2947_12(int x) { return x * 12; }
+inline int f2947_13(int x) { return x * 13; }
+inline int f2947_14(int x) { return x * 14; }
+inline int f2947_15(int x) { return x * 15; }
+inline int f2947_16(int x) { return x * 16; }
+inline int f2947_17(int x) { return x * 17; }
+inline int f2947_18(int x) { return x * 18; }
+inline int f2947_19(int x) { return x * 19; }
+inline int f2947_20(int x) { return x * 20; }
+inline int f2947_21(int x) { return x * 21; }
+inline int f2947_22(int x) { return x * 22; }
+inline int f2947_23(int x) { return x * 23; }
+inline int f2947_24(int x) { return x * 24; }
+inline int f2947_25(int x) { return x * 25; }
+inline int f2947_26(int x) { return x * 26; }
+inline int f2947_27(int x) { return x * 27; }
+inline int f2947_28(int x) { return x * 28; }
+inline int f2947_29(int x) { return x * 29; }
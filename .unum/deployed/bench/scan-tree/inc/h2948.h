@@ -0,0 +1,42 @@
+#pragma once
+/* header 2948 */
+#include <vector>
+#include "h616.h"
+#include "h8947.h"
+#include "h7625.h"
+#include "h929.h"
+#include "h2884.h"
+#ifdef X
+#include "h3122.h"
+#endif
+struct S2948 { int a; const char *s = "x//y"; };
+inline int f2948_0(int x) { return x * 0; }
+inline int f2948_1(int x) { return x * 1; }
+inline int f2948_2(int x) { return x * 2; }
+inline int f2948_3(int x) { return x * 3; }
+inline int f2948_4(int x) { return x * 4; }
+inline int f2948_5(int x) { return x * 5; }
+inline int f2948_6(int x) { return x * 6; }
+inline int f2948_7(int x) { return x * 7; }
+inline int f2948_8(int x) { return x * 8; }
+inline int f2948_9(int x) { return x * 9; }
+inline int f2948_10(int x) { return x * 10; }
+inline int f2948_11(int x) { return x * 11; }
+inline int f2948_12(int x) { return x * 12; }
+inline int f2948_13(int x) { return x * 13; }
+inline int f2948_14(int x) { return x * 14; }
+inline int f2948_15(int x) { return x * 15; }
+inline int f2948_16(int x) { return x * 16; }
+inline int f2948_17(int x) { return x * 17; }
+inline int f2948_18(int x) { return x * 18; }
+inline int f2948_19(int x) { return x * 19; }
+inline int f2948_20(int x) { return x * 20; }
+inline int f2948_21(int x) { return x * 21; }
+inline int f2948_22(int x) { return x * 22; }
+inline int f2948_23(int x) { return x * 23; }
+inline int f2948_24(int x) { return x * 24; }
+inline int f2948_25(int x) { return x * 25; }
+inline int f2948_26(int x) { return x * 26; }
+inline int f2948_27(int x) { return x * 27; }
+inline int f2948_28(int x) { return x * 28; }
+inline int f2948_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2950 */
+#include <vector>
+#include "h1207.h"
+#include "h1039.h"
+#include "h4480.h"
+#include "h1170.h"
+#include "h1646.h"
+#ifdef X
+#include "h7454.h"
+#endif
+struct S2950 { int a; const char *s = "x//y"; };
+inline int f2950_0(int x) { return x * 0; }
+inline int f2950_1(int x) { return x * 1; }
+inline int f2950_2(int x) { return x * 2; }
+inline int f2950_3(int x) { return x * 3; }
+inline int f2950_4(int x) { return x * 4; }
+inline int f2950_5(int x) { return x * 5; }
+inline int f2950_6(int x) { return x * 6; }
+inline int f2950_7(int x) { return x * 7; }
+inline int f2950_8(int x) { return x * 8; }
+inline int f2950_9(int x) { return x * 9; }
+inline int f2950_10(int x) { return x * 10; }
+inline int f2950_11(int x) { return x * 11; }
+inline int f2950_12(int x) { return x * 12; }
+inline int f2950_13(int x) { return x * 13; }
+inline int f2950_14(int x) { return x * 14; }
+inline int f2950_15(int x) { return x * 15; }
+inline int f2950_16(int x) { return x * 16; }
+inline int f2950_17(int x) { return x * 17; }
+inline int f2950_18(int x) { return x * 18; }
+inline int f2950_19(int x) { return x * 19; }
+inline int f2950_20(int x) { return x * 20; }
+inline int f2950_21(int x) { return x * 21; }
+inline int f2950_22(int x) { return x * 22; }
+inline int f2950_23(int x) { return x * 23; }
+inline int f2950_24(int x) { return x * 24; }
+inline int f2950_25(int x) { return x * 25; }
+inline int f2950_26(int x) { return x * 26; }
+inline int f2950_27(int x) { return x * 27; }
+inline int f2950_28(int x) { return x * 28; }
+inline int f2950_29(int x) { return x * 29; }
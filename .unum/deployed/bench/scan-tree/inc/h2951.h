@@ -0,0 +1,42 @@
+#pragma once
+/* header 2951 */
+#include <vector>
+#include "h9309.h"
+#include "h6746.h"
+#include "h5286.h"
+#include "h1099.h"
+#include "h501.h"
+#ifdef X
+#include "h388.h"
+#endif
+struct S2951 { int a; const char *s = "x//y"; };
+inline int f2951_0(int x) { return x * 0; }
+inline int f2951_1(int x) { return x * 1; }
+inline int f2951_2(int x) { return x * 2; }
+inline int f2951_3(int x) { return x * 3; }
+inline int f2951_4(int x) { return x * 4; }
+inline int f2951_5(int x) { return x * 5; }
+inline int f2951_6(int x) { return x * 6; }
+inline int f2951_7(int x) { return x * 7; }
+inline int f2951_8(int x) { return x * 8; }
+inline int f2951_9(int x) { return x * 9; }
+inline int f2951_10(int x) { return x * 10; }
+inline int f2951_11(int x) { return x * 11; }
+inline int f2951_12(int x) { return x * 12; }
+inline int f2951_13(int x) { return x * 13; }
+inline int f2951_14(int x) { return x * 14; }
+inline int f2951_15(int x) { return x * 15; }
+inline int f2951_16(int x) { return x * 16; }
+inline int f2951_17(int x) { return x * 17; }
+inline int f2951_18(int x) { return x * 18; }
+inline int f2951_19(int x) { return x * 19; }
+inline int f2951_20(int x) { return x * 20; }
+inline int f2951_21(int x) { return x * 21; }
+inline int f2951_22(int x) { return x * 22; }
+inline int f2951_23(int x) { return x * 23; }
+inline int f2951_24(int x) { return x * 24; }
+inline int f2951_25(int x) { return x * 25; }
+inline int f2951_26(int x) { return x * 26; }
+inline int f2951_27(int x) { return x * 27; }
+inline int f2951_28(int x) { return x * 28; }
+inline int f2951_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2952 */
+#include <vector>
+#include "h8082.h"
+#include "h9175.h"
+#include "h3842.h"
+#include "h7765.h"
+#include "h5563.h"
+#ifdef X
+#include "h5722.h"
+#endif
+struct S2952 { int a; const char *s = "x//y"; };
+inline int f2952_0(int x) { return x * 0; }
+inline int f2952_1(int x) { return x * 1; }
+inline int f2952_2(int x) { return x * 2; }
+inline int f2952_3(int x) { return x * 3; }
+inline int f2952_4(int x) { return x * 4; }
+inline int f2952_5(int x) { return x * 5; }
+inline int f2952_6(int x) { return x * 6; }
+inline int f2952_7(int x) { return x * 7; }
+inline int f2952_8(int x) { return x * 8; }
+inline int f2952_9(int x) { return x * 9; }
+inline int f2952_10(int x) { return x * 10; }
+inline int f2952_11(int x) { return x * 11; }
+inline int f2952_12(int x) { return x * 12; }
+inline int f2952_13(int x) { return x * 13; }
+inline int f2952_14(int x) { return x * 14; }
+inline int f2952_15(int x) { return x * 15; }
+inline int f2952_16(int x) { return x * 16; }
+inline int f2952_17(int x) { return x * 17; }
+inline int f2952_18(int x) { return x * 18; }
+inline int f2952_19(int x) { return x * 19; }
+inline int f2952_20(int x) { return x * 20; }
+inline int f2952_21(int x) { return x * 21; }
+inline int f2952_22(int x) { return x * 22; }
+inline int f2952_23(int x) { return x * 23; }
+inline int f2952_24(int x) { return x * 24; }
+inline int f2952_25(int x) { return x * 25; }
+inline int f2952_26(int x) { return x * 26; }
+inline int f2952_27(int x) { return x * 27; }
+inline int f2952_28(int x) { return x * 28; }
+inline int f2952_29(int x) { return x * 29; }
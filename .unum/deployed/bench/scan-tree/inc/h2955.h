@@ -0,0 +1,42 @@
+#pragma once
+/* header 2955 */
+#include <vector>
+#include "h4412.h"
+#include "h2191.h"
+#include "h5621.h"
+#include "h2254.h"
+#include "h3962.h"
+#ifdef X
+#include "h3229.h"
+#endif
+struct S2955 { int a; const char *s = "x//y"; };
+inline int f2955_0(int x) { return x * 0; }
+inline int f2955_1(int x) { return x * 1; }
+inline int f2955_2(int x) { return x * 2; }
+inline int f2955_3(int x) { return x * 3; }
+inline int f2955_4(int x) { return x * 4; }
+inline int f2955_5(int x) { return x * 5; }
+inline int f2955_6(int x) { return x * 6; }
+inline int f2955_7(int x) { return x * 7; }
+inline int f2955_8(int x) { return x * 8; }
+inline int f2955_9(int x) { return x * 9; }
+inline int f2955_10(int x) { return x * 10; }
+inline int f2955_11(int x) { return x * 11; }
+inline int f2955_12(int x) { return x * 12; }
+inline int f2955_13(int x) { return x * 13; }
+inline int f2955_14(int x) { return x * 14; }
+inline int f2955_15(int x) { return x * 15; }
+inline int f2955_16(int x) { return x * 16; }
+inline int f2955_17(int x) { return x * 17; }
+inline int f2955_18(int x) { return x * 18; }
+inline int f2955_19(int x) { return x * 19; }
+inline int f2955_20(int x) { return x * 20; }
+inline int f2955_21(int x) { return x * 21; }
+inline int f2955_22(int x) { return x * 22; }
+inline int f2955_23(int x) { return x * 23; }
+inline int f2955_24(int x) { return x * 24; }
+inline int f2955_25(int x) { return x * 25; }
+inline int f2955_26(int x) { return x * 26; }
+inline int f2955_27(int x) { return x * 27; }
+inline int f2955_28(int x) { return x * 28; }
+inline int f2955_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2957 */
+#include <vector>
+#include "h7807.h"
+#include "h2024.h"
+#include "h628.h"
+#include "h3846.h"
+#include "h4688.h"
+#ifdef X
+#include "h1361.h"
+#endif
+struct S2957 { int a; const char *s = "x//y"; };
+inline int f2957_0(int x) { return x * 0; }
+inline int f2957_1(int x) { return x * 1; }
+inline int f2957_2(int x) { return x * 2; }
+inline int f2957_3(int x) { return x * 3; }
+inline int f2957_4(int x) { return x * 4; }
+inline int f2957_5(int x) { return x * 5; }
+inline int f2957_6(int x) { return x * 6; }
+inline int f2957_7(int x) { return x * 7; }
+inline int f2957_8(int x) { return x * 8; }
+inline int f2957_9(int x) { return x * 9; }
+inline int f2957_10(int x) { return x * 10; }
+inline int f2957_11(int x) { return x * 11; }
+inline int f2957_12(int x) { return x * 12; }
+inline int f2957_13(int x) { return x * 13; }
+inline int f2957_14(int x) { return x * 14; }
+inline int f2957_15(int x) { return x * 15; }
+inline int f2957_16(int x) { return x * 16; }
+inline int f2957_17(int x) { return x * 17; }
+inline int f2957_18(int x) { return x * 18; }
+inline int f2957_19(int x) { return x * 19; }
+inline int f2957_20(int x) { return x * 20; }
+inline int f2957_21(int x) { return x * 21; }
+inline int f2957_22(int x) { return x * 22; }
+inline int f2957_23(int x) { return x * 23; }
+inline int f2957_24(int x) { return x * 24; }
+inline int f2957_25(int x) { return x * 25; }
+inline int f2957_26(int x) { return x * 26; }
+inline int f2957_27(int x) { return x * 27; }
+inline int f2957_28(int x) { return x * 28; }
+inline int f2957_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 296 */
+#include <vector>
+#include "h7582.h"
+#include "h5812.h"
+#include "h260.h"
+#include "h2066.h"
+#include "h8525.h"
+#ifdef X
+#include "h3577.h"
+#endif
+struct S296 { int a; const char *s = "x//y"; };
+inline int f296_0(int x) { return x * 0; }
+inline int f296_1(int x) { return x * 1; }
+inline int f296_2(int x) { return x * 2; }
+inline int f296_3(int x) { return x * 3; }
+inline int f296_4(int x) { return x * 4; }
+inline int f296_5(int x) { return x * 5; }
+inline int f296_6(int x) { return x * 6; }
+inline int f296_7(int x) { return x * 7; }
+inline int f296_8(int x) { return x * 8; }
+inline int f296_9(int x) { return x * 9; }
+inline int f296_10(int x) { return x * 10; }
+inline int f296_11(int x) { return x * 11; }
+inline int f296_12(int x) { return x * 12; }
+inline int f296_13(int x) { return x * 13; }
+inline int f296_14(int x) { return x * 14; }
+inline int f296_15(int x) { return x * 15; }
+inline int f296_16(int x) { return x * 16; }
+inline int f296_17(int x) { return x * 17; }
+inline int f296_18(int x) { return x * 18; }
+inline int f296_19(int x) { return x * 19; }
+inline int f296_20(int x) { return x * 20; }
+inline int f296_21(int x) { return x * 21; }
+inline int f296_22(int x) { return x * 22; }
+inline int f296_23(int x) { return x * 23; }
+inline int f296_24(int x) { return x * 24; }
+inline int f296_25(int x) { return x * 25; }
+inline int f296_26(int x) { return x * 26; }
+inline int f296_27(int x) { return x * 27; }
+inline int f296_28(int x) { return x * 28; }
+inline int f296_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2960 */
+#include <vector>
+#include "h8077.h"
+#include "h6341.h"
+#include "h4438.h"
+#include "h1107.h"
+#include "h2501.h"
+#ifdef X
+#include "h9468.h"
+#endif
+struct S2960 { int a; const char *s = "x//y"; };
+inline int f2960_0(int x) { return x * 0; }
+inline int f2960_1(int x) { return x * 1; }
+inline int f2960_2(int x) { return x * 2; }
+inline int f2960_3(int x) { return x * 3; }
+inline int f2960_4(int x) { return x * 4; }
+inline int f2960_5(int x) { return x * 5; }
+inline int f2960_6(int x) { return x * 6; }
+inline int f2960_7(int x) { return x * 7; }
+inline int f2960_8(int x) { return x * 8; }
+inline int f2960_9(int x) { return x * 9; }
+inline int f2960_10(int x) { return x * 10; }
+inline int f2960_11(int x) { return x * 11; }
+inline int f2960_12(int x) { return x * 12; }
+inline int f2960_13(int x) { return x * 13; }
+inline int f2960_14(int x) { return x * 14; }
+inline int f2960_15(int x) { return x * 15; }
+inline int f2960_16(int x) { return x * 16; }
+inline int f2960_17(int x) { return x * 17; }
+inline int f2960_18(int x) { return x * 18; }
+inline int f2960_19(int x) { return x * 19; }
+inline int f2960_20(int x) { return x * 20; }
+inline int f2960_21(int x) { return x * 21; }
+inline int f2960_22(int x) { return x * 22; }
+inline int f2960_23(int x) { return x * 23; }
+inline int f2960_24(int x) { return x * 24; }
+inline int f2960_25(int x) { return x * 25; }
+inline int f2960_26(int x) { return x * 26; }
+inline int f2960_27(int x) { return x * 27; }
+inline int f2960_28(int x) { return x * 28; }
+inline int f2960_29(int x) { return x * 29; }
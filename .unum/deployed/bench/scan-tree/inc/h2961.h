@@ -0,0 +1,42 @@
+#pragma once
+/* header 2961 */
+#include <vector>
+#include "h3248.h"
+#include "h2144.h"
+#include "h4452.h"
+#include "h2259.h"
+#include "h5822.h"
+#ifdef X
+#include "h461.h"
+#endif
+struct S2961 { int a; const char *s = "x//y"; };
+inline int f2961_0(int x) { return x * 0; }
+inline int f2961_1(int x) { return x * 1; }
+inline int f2961_2(int x) { return x * 2; }
+inline int f2961_3(int x) { return x * 3; }
+inline int f2961_4(int x) { return x * 4; }
+inline int f2961_5(int x) { return x * 5; }
+inline int f2961_6(int x) { return x * 6; }
+inline int f2961_7(int x) { return x * 7; }
+inline int f2961_8(int x) { return x * 8; }
+inline int f2961_9(int x) { return x * 9; }
+inline int f2961_10(int x) { return x * 10; }
+inline int f2961_11(int x) { return x * 11; }
+inline int f2961_12(int x) { return x * 12; }
+inline int f2961_13(int x) { return x * 13; }
+inline int f2961_14(int x) { return x * 14; }
+inline int f2961_15(int x) { return x * 15; }
+inline int f2961_16(int x) { return x * 16; }
+inline int f2961_17(int x) { return x * 17; }
+inline int f2961_18(int x) { return x * 18; }
+inline int f2961_19(int x) { return x * 19; }
+inline int f2961_20(int x) { return x * 20; }
+inline int f2961_21(int x) { return x * 21; }
+inline int f2961_22(int x) { return x * 22; }
+inline int f2961_23(int x) { return x * 23; }
+inline int f2961_24(int x) { return x * 24; }
+inline int f2961_25(int x) { return x * 25; }
+inline int f2961_26(int x) { return x * 26; }
+inline int f2961_27(int x) { return x * 27; }
+inline int f2961_28(int x) { return x * 28; }
+inline int f2961_29(int x) { return x * 29; }
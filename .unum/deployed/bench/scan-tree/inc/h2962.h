@@ -0,0 +1,42 @@
+#pragma once
+/* header 2962 */
+#include <vector>
+#include "h4436.h"
+#include "h2593.h"
+#include "h9133.h"
+#include "h9737.h"
+#include "h9770.h"
+#ifdef X
+#include "h6456.h"
+#endif
+struct S2962 { int a; const char *s = "x//y"; };
+inline int f2962_0(int x) { return x * 0; }
+inline int f2962_1(int x) { return x * 1; }
+inline int f2962_2(int x) { return x * 2; }
+inline int f2962_3(int x) { return x * 3; }
+inline int f2962_4(int x) { return x * 4; }
+inline int f2962_5(int x) { return x * 5; }
+inline int f2962_6(int x) { return x * 6; }
+inline int f2962_7(int x) { return x * 7; }
+inline int f2962_8(int x) { return x * 8; }
+inline int f2962_9(int x) { return x * 9; }
+inline int f2962_10(int x) { return x * 10; }
+inline int f2962_11(int x) { return x * 11; }
+inline int f2962_12(int x) { return x * 12; }
+inline int f2962_13(int x) { return x * 13; }
+inline int f2962_14(int x) { return x * 14; }
+inline int f2962_15(int x) { return x * 15; }
+inline int f2962_16(int x) { return x * 16; }
+inline int f2962_17(int x) { return x * 17; }
+inline int f2962_18(int x) { return x * 18; }
+inline int f2962_19(int x) { return x * 19; }
+inline int f2962_20(int x) { return x * 20; }
+inline int f2962_21(int x) { return x * 21; }
+inline int f2962_22(int x) { return x * 22; }
+inline int f2962_23(int x) { return x * 23; }
+inline int f2962_24(int x) { return x * 24; }
+inline int f2962_25(int x) { return x * 25; }
+inline int f2962_26(int x) { return x * 26; }
+inline int f2962_27(int x) { return x * 27; }
+inline int f2962_28(int x) { return x * 28; }
+inline int f2962_29(int x) { return x * 29; }
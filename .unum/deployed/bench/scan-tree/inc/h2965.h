@@ -0,0 +1,42 @@
+#pragma once
+/* header 2965 */
+#include <vector>
+#include "h1637.h"
+#include "h8764.h"
+#include "h3651.h"
+#include "h371.h"
+#include "h7475.h"
+#ifdef X
+#include "h9317.h"
+#endif
+struct S2965 { int a; const char *s = "x//y"; };
+inline int f2965_0(int x) { return x * 0; }
+inline int f2965_1(int x) { return x * 1; }
+inline int f2965_2(int x) { return x * 2; }
+inline int f2965_3(int x) { return x * 3; }
+inline int f2965_4(int x) { return x * 4; }
+inline int f2965_5(int x) { return x * 5; }
+inline int f2965_6(int x) { return x * 6; }
+inline int f2965_7(int x) { return x * 7; }
+inline int f2965_8(int x) { return x * 8; }
+inline int f2965_9(int x) { return x * 9; }
+inline int f2965_10(int x) { return x * 10; }
+inline int f2965_11(int x) { return x * 11; }
+inline int f2965_12(int x) { return x * 12; }
+inline int f2965_13(int x) { return x * 13; }
+inline int f2965_14(int x) { return x * 14; }
+inline int f2965_15(int x) { return x * 15; }
+inline int f2965_16(int x) { return x * 16; }
+inline int f2965_17(int x) { return x * 17; }
+inline int f2965_18(int x) { return x * 18; }
+inline int f2965_19(int x) { return x * 19; }
+inline int f2965_20(int x) { return x * 20; }
+inline int f2965_21(int x) { return x * 21; }
+inline int f2965_22(int x) { return x * 22; }
+inline int f2965_23(int x) { return x * 23; }
+inline int f2965_24(int x) { return x * 24; }
+inline int f2965_25(int x) { return x * 25; }
+inline int f2965_26(int x) { return x * 26; }
+inline int f2965_27(int x) { return x * 27; }
+inline int f2965_28(int x) { return x * 28; }
+inline int f2965_29(int x) { return x * 29; }
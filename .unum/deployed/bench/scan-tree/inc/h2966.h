@@ -0,0 +1,42 @@
+#pragma once
+/* header 2966 */
+#include <vector>
+#include "h9721.h"
+#include "h5711.h"
+#include "h9975.h"
+#include "h1015.h"
+#include "h3466.h"
+#ifdef X
+#include "h904.h"
+#endif
+struct S2966 { int a; const char *s = "x//y"; };
+inline int f2966_0(int x) { return x * 0; }
+inline int f2966_1(int x) { return x * 1; }
+inline int f2966_2(int x) { return x * 2; }
+inline int f2966_3(int x) { return x * 3; }
+inline int f2966_4(int x) { return x * 4; }
+inline int f2966_5(int x) { return x * 5; }
+inline int f2966_6(int x) { return x * 6; }
+inline int f2966_7(int x) { return x * 7; }
+inline int f2966_8(int x) { return x * 8; }
+inline int f2966_9(int x) { return x * 9; }
+inline int f2966_10(int x) { return x * 10; }
+inline int f2966_11(int x) { return x * 11; }
+inline int f2966_12(int x) { return x * 12; }
+inline int f2966_13(int x) { return x * 13; }
+inline int f2966_14(int x) { return x * 14; }
+inline int f2966_15(int x) { return x * 15; }
+inline int f2966_16(int x) { return x * 16; }
+inline int f2966_17(int x) { return x * 17; }
+inline int f2966_18(int x) { return x * 18; }
+inline int f2966_19(int x) { return x * 19; }
+inline int f2966_20(int x) { return x * 20; }
+inline int f2966_21(int x) { return x * 21; }
+inline int f2966_22(int x) { return x * 22; }
+inline int f2966_23(int x) { return x * 23; }
+inline int f2966_24(int x) { return x * 24; }
+inline int f2966_25(int x) { return x * 25; }
+inline int f2966_26(int x) { return x * 26; }
+inline int f2966_27(int x) { return x * 27; }
+inline int f2966_28(int x) { return x * 28; }
+inline int f2966_29(int x) { return x * 29; }
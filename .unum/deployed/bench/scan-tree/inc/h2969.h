@@ -0,0 +1,42 @@
+#pragma once
+/* header 2969 */
+#include <vector>
+#include "h5641.h"
+#include "h1108.h"
+#include "h4552.h"
+#include "h7946.h"
+#include "h6284.h"
+#ifdef X
+#include "h122.h"
+#endif
+struct S2969 { int a; const char *s = "x//y"; };
+inline int f2969_0(int x) { return x * 0; }
+inline int f2969_1(int x) { return x * 1; }
+inline int f2969_2(int x) { return x * 2; }
+inline int f2969_3(int x) { return x * 3; }
+inline int f2969_4(int x) { return x * 4; }
+inline int f2969_5(int x) { return x * 5; }
+inline int f2969_6(int x) { return x * 6; }
+inline int f2969_7(int x) { return x * 7; }
+inline int f2969_8(int x) { return x * 8; }
+inline int f2969_9(int x) { return x * 9; }
+inline int f2969_10(int x) { return x * 10; }
+inline int f2969_11(int x) { return x * 11; }
+inline int f2969_12(int x) { return x * 12; }
+inline int f2969_13(int x) { return x * 13; }
+inline int f2969_14(int x) { return x * 14; }
+inline int f2969_15(int x) { return x * 15; }
+inline int f2969_16(int x) { return x * 16; }
+inline int f2969_17(int x) { return x * 17; }
+inline int f2969_18(int x) { return x * 18; }
+inline int f2969_19(int x) { return x * 19; }
+inline int f2969_20(int x) { return x * 20; }
+inline int f2969_21(int x) { return x * 21; }
+inline int f2969_22(int x) { return x * 22; }
+inline int f2969_23(int x) { return x * 23; }
+inline int f2969_24(int x) { return x * 24; }
+inline int f2969_25(int x) { return x * 25; }
+inline int f2969_26(int x) { return x * 26; }
+inline int f2969_27(int x) { return x * 27; }
+inline int f2969_28(int x) { return x * 28; }
+inline int f2969_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 297 */
+#include <vector>
+#include "h275.h"
+#include "h8566.h"
+#include "h5369.h"
+#include "h8047.h"
+#include "h5651.h"
+#ifdef X
+#include "h107.h"
+#endif
+struct S297 { int a; const char *s = "x//y"; };
+inline int f297_0(int x) { return x * 0; }
+inline int f297_1(int x) { return x * 1; }
+inline int f297_2(int x) { return x * 2; }
+inline int f297_3(int x) { return x * 3; }
+inline int f297_4(int x) { return x * 4; }
+inline int f297_5(int x) { return x * 5; }
+inline int f297_6(int x) { return x * 6; }
+inline int f297_7(int x) { return x * 7; }
+inline int f297_8(int x) { return x * 8; }
+inline int f297_9(int x) { return x * 9; }
+inline int f297_10(int x) { return x * 10; }
+inline int f297_11(int x) { return x * 11; }
+inline int f297_12(int x) { return x * 12; }
+inline int f297_13(int x) { return x * 13; }
+inline int f297_14(int x) { return x * 14; }
+inline int f297_15(int x) { return x * 15; }
+inline int f297_16(int x) { return x * 16; }
+inline int f297_17(int x) { return x * 17; }
+inline int f297_18(int x) { return x * 18; }
+inline int f297_19(int x) { return x * 19; }
+inline int f297_20(int x) { return x * 20; }
+inline int f297_21(int x) { return x * 21; }
+inline int f297_22(int x) { return x * 22; }
+inline int f297_23(int x) { return x * 23; }
+inline int f297_24(int x) { return x * 24; }
+inline int f297_25(int x) { return x * 25; }
+inline int f297_26(int x) { return x * 26; }
+inline int f297_27(int x) { return x * 27; }
+inline int f297_28(int x) { return x * 28; }
+inline int f297_29(int x) { return x * 29; }
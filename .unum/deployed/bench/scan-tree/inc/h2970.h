@@ -0,0 +1,42 @@
+#pragma once
+/* header 2970 */
+#include <vector>
+#include "h9964.h"
+#include "h169.h"
+#include "h6865.h"
+#include "h7346.h"
+#include "h1255.h"
+#ifdef X
+#include "h1812.h"
+#endif
+struct S2970 { int a; const char *s = "x//y"; };
+inline int f2970_0(int x) { return x * 0; }
+inline int f2970_1(int x) { return x * 1; }
+inline int f2970_2(int x) { return x * 2; }
+inline int f2970_3(int x) { return x * 3; }
+inline int f2970_4(int x) { return x * 4; }
+inline int f2970_5(int x) { return x * 5; }
+inline int f2970_6(int x) { return x * 6; }
+inline int f2970_7(int x) { return x * 7; }
+inline int f2970_8(int x) { return x * 8; }
+inline int f2970_9(int x) { return x * 9; }
+inline int f2970_10(int x) { return x * 10; }
+inline int f2970_11(int x) { return x * 11; }
+inline int f2970_12(int x) { return x * 12; }
+inline int f2970_13(int x) { return x * 13; }
+inline int f2970_14(int x) { return x * 14; }
+inline int f2970_15(int x) { return x * 15; }
+inline int f2970_16(int x) { return x * 16; }
+inline int f2970_17(int x) { return x * 17; }
+inline int f2970_18(int x) { return x * 18; }
+inline int f2970_19(int x) { return x * 19; }
+inline int f2970_20(int x) { return x * 20; }
+inline int f2970_21(int x) { return x * 21; }
+inline int f2970_22(int x) { return x * 22; }
+inline int f2970_23(int x) { return x * 23; }
+inline int f2970_24(int x) { return x * 24; }
+inline int f2970_25(int x) { return x * 25; }
+inline int f2970_26(int x) { return x * 26; }
+inline int f2970_27(int x) { return x * 27; }
+inline int f2970_28(int x) { return x * 28; }
+inline int f2970_29(int x) { return x * 29; }
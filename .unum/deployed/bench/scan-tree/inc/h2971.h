@@ -0,0 +1,42 @@
+#pragma once
+/* header 2971 */
+#include <vector>
+#include "h7781.h"
+#include "h5208.h"
+#include "h8065.h"
+#include "h4250.h"
+#include "h3837.h"
+#ifdef X
+#include "h519.h"
+#endif
+struct S2971 { int a; const char *s = "x//y"; };
+inline int f2971_0(int x) { return x * 0; }
+inline int f2971_1(int x) { return x * 1; }
+inline int f2971_2(int x) { return x * 2; }
+inline int f2971_3(int x) { return x * 3; }
+inline int f2971_4(int x) { return x * 4; }
+inline int f2971_5(int x) { return x * 5; }
+inline int f2971_6(int x) { return x * 6; }
+inline int f2971_7(int x) { return x * 7; }
+inline int f2971_8(int x) { return x * 8; }
+inline int f2971_9(int x) { return x * 9; }
+inline int f2971_10(int x) { return x * 10; }
+inline int f2971_11(int x) { return x * 11; }
+inline int f2971_12(int x) { return x * 12; }
+inline int f2971_13(int x) { return x * 13; }
+inline int f2971_14(int x) { return x * 14; }
+inline int f2971_15(int x) { return x * 15; }
+inline int f2971_16(int x) { return x * 16; }
+inline int f2971_17(int x) { return x * 17; }
+inline int f2971_18(int x) { return x * 18; }
+inline int f2971_19(int x) { return x * 19; }
+inline int f2971_20(int x) { return x * 20; }
+inline int f2971_21(int x) { return x * 21; }
+inline int f2971_22(int x) { return x * 22; }
+inline int f2971_23(int x) { return x * 23; }
+inline int f2971_24(int x) { return x * 24; }
+inline int f2971_25(int x) { return x * 25; }
+inline int f2971_26(int x) { return x * 26; }
+inline int f2971_27(int x) { return x * 27; }
+inline int f2971_28(int x) { return x * 28; }
+inline int f2971_29(int x) { return x * 29; }
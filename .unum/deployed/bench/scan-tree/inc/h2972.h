@@ -0,0 +1,42 @@
+#pragma once
+/* header 2972 */
+#include <vector>
+#include "h8452.h"
+#include "h7838.h"
+#include "h5415.h"
+#include "h9633.h"
+#include "h2848.h"
+#ifdef X
+#include "h9066.h"
+#endif
+struct S2972 { int a; const char *s = "x//y"; };
+inline int f2972_0(int x) { return x * 0; }
+inline int f2972_1(int x) { return x * 1; }
+inline int f2972_2(int x) { return x * 2; }
+inline int f2972_3(int x) { return x * 3; }
+inline int f2972_4(int x) { return x * 4; }
+inline int f2972_5(int x) { return x * 5; }
+inline int f2972_6(int x) { return x * 6; }
+inline int f2972_7(int x) { return x * 7; }
+inline int f2972_8(int x) { return x * 8; }
+inline int f2972_9(int x) { return x * 9; }
+inline int f2972_10(int x) { return x * 10; }
+inline int f2972_11(int x) { return x * 11; }
+inline int f2972_12(int x) { return x * 12; }
+inline int f2972_13(int x) { return x * 13; }
+inline int f2972_14(int x) { return x * 14; }
+inline int f2972_15(int x) { return x * 15; }
+inline int f2972_16(int x) { return x * 16; }
+inline int f2972_17(int x) { return x * 17; }
+inline int f2972_18(int x) { return x * 18; }
+inline int f2972_19(int x) { return x * 19; }
+inline int f2972_20(int x) { return x * 20; }
+inline int f2972_21(int x) { return x * 21; }
+inline int f2972_22(int x) { return x * 22; }
+inline int f2972_23(int x) { return x * 23; }
+inline int f2972_24(int x) { return x * 24; }
+inline int f2972_25(int x) { return x * 25; }
+inline int f2972_26(int x) { return x * 26; }
+inline int f2972_27(int x) { return x * 27; }
+inline int f2972_28(int x) { return x * 28; }
+inline int f2972_29(int x) { return x * 29; }
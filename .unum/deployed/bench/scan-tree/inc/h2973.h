@@ -0,0 +1,42 @@
+#pragma once
+/* header 2973 */
+#include <vector>
+#include "h9524.h"
+#include "h141.h"
+#include "h9442.h"
+#include "h5404.h"
+#include "h3563.h"
+#ifdef X
+#include "h3609.h"
+#endif
+struct S2973 { int a; const char *s = "x//y"; };
+inline int f2973_0(int x) { return x * 0; }
+inline int f2973_1(int x) { return x * 1; }
+inline int f2973_2(int x) { return x * 2; }
+inline int f2973_3(int x) { return x * 3; }
+inline int f2973_4(int x) { return x * 4; }
+inline int f2973_5(int x) { return x * 5; }
+inline int f2973_6(int x) { return x * 6; }
+inline int f2973_7(int x) { return x * 7; }
+inline int f2973_8(int x) { return x * 8; }
+inline int f2973_9(int x) { return x * 9; }
+inline int f2973_10(int x) { return x * 10; }
+inline int f2973_11(int x) { return x * 11; }
+inline int f2973_12(int x) { return x * 12; }
+inline int f2973_13(int x) { return x * 13; }
+inline int f2973_14(int x) { return x * 14; }
+inline int f2973_15(int x) { return x * 15; }
+inline int f2973_16(int x) { return x * 16; }
+inline int f2973_17(int x) { return x * 17; }
+inline int f2973_18(int x) { return x * 18; }
+inline int f2973_19(int x) { return x * 19; }
+inline int f2973_20(int x) { return x * 20; }
+inline int f2973_21(int x) { return x * 21; }
+inline int f2973_22(int x) { return x * 22; }
+inline int f2973_23(int x) { return x * 23; }
+inline int f2973_24(int x) { return x * 24; }
+inline int f2973_25(int x) { return x * 25; }
+inline int f2973_26(int x) { return x * 26; }
+inline int f2973_27(int x) { return x * 27; }
+inline int f2973_28(int x) { return x * 28; }
+inline int f2973_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2974 */
+#include <vector>
+#include "h6528.h"
+#include "h4282.h"
+#include "h7726.h"
+#include "h8444.h"
+#include "h3729.h"
+#ifdef X
+#include "h6949.h"
+#endif
+struct S2974 { int a; const char *s = "x//y"; };
+inline int f2974_0(int x) { return x * 0; }
+inline int f2974_1(int x) { return x * 1; }
+inline int f2974_2(int x) { return x * 2; }
+inline int f2974_3(int x) { return x * 3; }
+inline int f2974_4(int x) { return x * 4; }
+inline int f2974_5(int x) { return x * 5; }
+inline int f2974_6(int x) { return x * 6; }
+inline int f2974_7(int x) { return x * 7; }
+inline int f2974_8(int x) { return x * 8; }
+inline int f2974_9(int x) { return x * 9; }
+inline int f2974_10(int x) { return x * 10; }
+inline int f2974_11(int x) { return x * 11; }
+inline int f2974_12(int x) { return x * 12; }
+inline int f2974_13(int x) { return x * 13; }
+inline int f2974_14(int x) { return x * 14; }
+inline int f2974_15(int x) { return x * 15; }
+inline int f2974_16(int x) { return x * 16; }
+inline int f2974_17(int x) { return x * 17; }
+inline int f2974_18(int x) { return x * 18; }
+inline int f2974_19(int x) { return x * 19; }
+inline int f2974_20(int x) { return x * 20; }
+inline int f2974_21(int x) { return x * 21; }
+inline int f2974_22(int x) { return x * 22; }
+inline int f2974_23(int x) { return x * 23; }
+inline int f2974_24(int x) { return x * 24; }
+inline int f2974_25(int x) { return x * 25; }
+inline int f2974_26(int x) { return x * 26; }
+inline int f2974_27(int x) { return x * 27; }
+inline int f2974_28(int x) { return x * 28; }
+inline int f2974_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2976 */
+#include <vector>
+#include "h8913.h"
+#include "h8160.h"
+#include "h6190.h"
+#include "h8758.h"
+#include "h6463.h"
+#ifdef X
+#include "h794.h"
+#endif
+struct S2976 { int a; const char *s = "x//y"; };
+inline int f2976_0(int x) { return x * 0; }
+inline int f2976_1(int x) { return x * 1; }
+inline int f2976_2(int x) { return x * 2; }
+inline int f2976_3(int x) { return x * 3; }
+inline int f2976_4(int x) { return x * 4; }
+inline int f2976_5(int x) { return x * 5; }
+inline int f2976_6(int x) { return x * 6; }
+inline int f2976_7(int x) { return x * 7; }
+inline int f2976_8(int x) { return x * 8; }
+inline int f2976_9(int x) { return x * 9; }
+inline int f2976_10(int x) { return x * 10; }
+inline int f2976_11(int x) { return x * 11; }
+inline int f2976_12(int x) { return x * 12; }
+inline int f2976_13(int x) { return x * 13; }
+inline int f2976_14(int x) { return x * 14; }
+inline int f2976_15(int x) { return x * 15; }
+inline int f2976_16(int x) { return x * 16; }
+inline int f2976_17(int x) { return x * 17; }
+inline int f2976_18(int x) { return x * 18; }
+inline int f2976_19(int x) { return x * 19; }
+inline int f2976_20(int x) { return x * 20; }
+inline int f2976_21(int x) { return x * 21; }
+inline int f2976_22(int x) { return x * 22; }
+inline int f2976_23(int x) { return x * 23; }
+inline int f2976_24(int x) { return x * 24; }
+inline int f2976_25(int x) { return x * 25; }
+inline int f2976_26(int x) { return x * 26; }
+inline int f2976_27(int x) { return x * 27; }
+inline int f2976_28(int x) { return x * 28; }
+inline int f2976_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2978 */
+#include <vector>
+#include "h204.h"
+#include "h8892.h"
+#include "h7295.h"
+#include "h3655.h"
+#include "h2571.h"
+#ifdef X
+#include "h599.h"
+#endif
+struct S2978 { int a; const char *s = "x//y"; };
+inline int f2978_0(int x) { return x * 0; }
+inline int f2978_1(int x) { return x * 1; }
+inline int f2978_2(int x) { return x * 2; }
+inline int f2978_3(int x) { return x * 3; }
+inline int f2978_4(int x) { return x * 4; }
+inline int f2978_5(int x) { return x * 5; }
+inline int f2978_6(int x) { return x * 6; }
+inline int f2978_7(int x) { return x * 7; }
+inline int f2978_8(int x) { return x * 8; }
+inline int f2978_9(int x) { return x * 9; }
+inline int f2978_10(int x) { return x * 10; }
+inline int f2978_11(int x) { return x * 11; }
+inline int f2978_12(int x) { return x * 12; }
+inline int f2978_13(int x) { return x * 13; }
+inline int f2978_14(int x) { return x * 14; }
+inline int f2978_15(int x) { return x * 15; }
+inline int f2978_16(int x) { return x * 16; }
+inline int f2978_17(int x) { return x * 17; }
+inline int f2978_18(int x) { return x * 18; }
+inline int f2978_19(int x) { return x * 19; }
+inline int f2978_20(int x) { return x * 20; }
+inline int f2978_21(int x) { return x * 21; }
+inline int f2978_22(int x) { return x * 22; }
+inline int f2978_23(int x) { return x * 23; }
+inline int f2978_24(int x) { return x * 24; }
+inline int f2978_25(int x) { return x * 25; }
+inline int f2978_26(int x) { return x * 26; }
+inline int f2978_27(int x) { return x * 27; }
+inline int f2978_28(int x) { return x * 28; }
+inline int f2978_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 298 */
+#include <vector>
+#include "h791.h"
+#include "h9486.h"
+#include "h4141.h"
+#include "h2260.h"
+#include "h2868.h"
+#ifdef X
+#include "h9445.h"
+#endif
+struct S298 { int a; const char *s = "x//y"; };
+inline int f298_0(int x) { return x * 0; }
+inline int f298_1(int x) { return x * 1; }
+inline int f298_2(int x) { return x * 2; }
+inline int f298_3(int x) { return x * 3; }
+inline int f298_4(int x) { return x * 4; }
+inline int f298_5(int x) { return x * 5; }
+inline int f298_6(int x) { return x * 6; }
+inline int f298_7(int x) { return x * 7; }
+inline int f298_8(int x) { return x * 8; }
+inline int f298_9(int x) { return x * 9; }
+inline int f298_10(int x) { return x * 10; }
+inline int f298_11(int x) { return x * 11; }
+inline int f298_12(int x) { return x * 12; }
+inline int f298_13(int x) { return x * 13; }
+inline int f298_14(int x) { return x * 14; }
+inline int f298_15(int x) { return x * 15; }
+inline int f298_16(int x) { return x * 16; }
+inline int f298_17(int x) { return x * 17; }
+inline int f298_18(int x) { return x * 18; }
+inline int f298_19(int x) { return x * 19; }
+inline int f298_20(int x) { return x * 20; }
+inline int f298_21(int x) { return x * 21; }
+inline int f298_22(int x) { return x * 22; }
+inline int f298_23(int x) { return x * 23; }
+inline int f298_24(int x) { return x * 24; }
+inline int f298_25(int x) { return x * 25; }
+inline int f298_26(int x) { return x * 26; }
+inline int f298_27(int x) { return x * 27; }
+inline int f298_28(int x) { return x * 28; }
+inline int f298_29(int x) { return x * 29; }
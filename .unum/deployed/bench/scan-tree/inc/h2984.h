@@ -0,0 +1,42 @@
+#pragma once
+/* header 2984 */
+#include <vector>
+#include "h1806.h"
+#include "h9960.h"
+#include "h4247.h"
+#include "h4269.h"
+#include "h294.h"
+#ifdef X
+#include "h2648.h"
+#endif
+struct S2984 { int a; const char *s = "x//y"; };
+inline int f2984_0(int x) { return x * 0; }
+inline int f2984_1(int x) { return x * 1; }
+inline int f2984_2(int x) { return x * 2; }
+inline int f2984_3(int x) { return x * 3; }
+inline int f2984_4(int x) { return x * 4; }
+inline int f2984_5(int x) { return x * 5; }
+inline int f2984_6(int x) { return x * 6; }
+inline int f2984_7(int x) { return x * 7; }
+inline int f2984_8(int x) { return x * 8; }
+inline int f2984_9(int x) { return x * 9; }
+inline int f2984_10(int x) { return x * 10; }
+inline int f2984_11(int x) { return x * 11; }
+inline int f2984_12(int x) { return x * 12; }
+inline int f2984_13(int x) { return x * 13; }
+inline int f2984_14(int x) { return x * 14; }
+inline int f2984_15(int x) { return x * 15; }
+inline int f2984_16(int x) { return x * 16; }
+inline int f2984_17(int x) { return x * 17; }
+inline int f2984_18(int x) { return x * 18; }
+inline int f2984_19(int x) { return x * 19; }
+inline int f2984_20(int x) { return x * 20; }
+inline int f2984_21(int x) { return x * 21; }
+inline int f2984_22(int x) { return x * 22; }
+inline int f2984_23(int x) { return x * 23; }
+inline int f2984_24(int x) { return x * 24; }
+inline int f2984_25(int x) { return x * 25; }
+inline int f2984_26(int x) { return x * 26; }
+inline int f2984_27(int x) { return x * 27; }
+inline int f2984_28(int x) { return x * 28; }
+inline int f2984_29(int x) { return x * 29; }
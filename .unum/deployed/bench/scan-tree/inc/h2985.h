@@ -0,0 +1,42 @@
+#pragma once
+/* header 2985 */
+#include <vector>
+#include "h5800.h"
+#include "h2577.h"
+#include "h4737.h"
+#include "h6142.h"
+#include "h9438.h"
+#ifdef X
+#include "h5303.h"
+#endif
+struct S2985 { int a; const char *s = "x//y"; };
+inline int f2985_0(int x) { return x * 0; }
+inline int f2985_1(int x) { return x * 1; }
+inline int f2985_2(int x) { return x * 2; }
+inline int f2985_3(int x) { return x * 3; }
+inline int f2985_4(int x) { return x * 4; }
+inline int f2985_5(int x) { return x * 5; }
+inline int f2985_6(int x) { return x * 6; }
+inline int f2985_7(int x) { return x * 7; }
+inline int f2985_8(int x) { return x * 8; }
+inline int f2985_9(int x) { return x * 9; }
+inline int f2985_10(int x) { return x * 10; }
+inline int f2985_11(int x) { return x * 11; }
+inline int f2985_12(int x) { return x * 12; }
+inline int f2985_13(int x) { return x * 13; }
+inline int f2985_14(int x) { return x * 14; }
+inline int f2985_15(int x) { return x * 15; }
+inline int f2985_16(int x) { return x * 16; }
+inline int f2985_17(int x) { return x * 17; }
+inline int f2985_18(int x) { return x * 18; }
+inline int f2985_19(int x) { return x * 19; }
+inline int f2985_20(int x) { return x * 20; }
+inline int f2985_21(int x) { return x * 21; }
+inline int f2985_22(int x) { return x * 22; }
+inline int f2985_23(int x) { return x * 23; }
+inline int f2985_24(int x) { return x * 24; }
+inline int f2985_25(int x) { return x * 25; }
+inline int f2985_26(int x) { return x * 26; }
+inline int f2985_27(int x) { return x * 27; }
+inline int f2985_28(int x) { return x * 28; }
+inline int f2985_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2987 */
+#include <vector>
+#include "h8328.h"
+#include "h1418.h"
+#include "h7486.h"
+#include "h1512.h"
+#include "h3136.h"
+#ifdef X
+#include "h8967.h"
+#endif
+struct S2987 { int a; const char *s = "x//y"; };
+inline int f2987_0(int x) { return x * 0; }
+inline int f2987_1(int x) { return x * 1; }
+inline int f2987_2(int x) { return x * 2; }
+inline int f2987_3(int x) { return x * 3; }
+inline int f2987_4(int x) { return x * 4; }
+inline int f2987_5(int x) { return x * 5; }
+inline int f2987_6(int x) { return x * 6; }
+inline int f2987_7(int x) { return x * 7; }
+inline int f2987_8(int x) { return x * 8; }
+inline int f2987_9(int x) { return x * 9; }
+inline int f2987_10(int x) { return x * 10; }
+inline int f2987_11(int x) { return x * 11; }
+inline int f2987_12(int x) { return x * 12; }
+inline int f2987_13(int x) { return x * 13; }
+inline int f2987_14(int x) { return x * 14; }
+inline int f2987_15(int x) { return x * 15; }
+inline int f2987_16(int x) { return x * 16; }
+inline int f2987_17(int x) { return x * 17; }
+inline int f2987_18(int x) { return x * 18; }
+inline int f2987_19(int x) { return x * 19; }
+inline int f2987_20(int x) { return x * 20; }
+inline int f2987_21(int x) { return x * 21; }
+inline int f2987_22(int x) { return x * 22; }
+inline int f2987_23(int x) { return x * 23; }
+inline int f2987_24(int x) { return x * 24; }
+inline int f2987_25(int x) { return x * 25; }
+inline int f2987_26(int x) { return x * 26; }
+inline int f2987_27(int x) { return x * 27; }
+inline int f2987_28(int x) { return x * 28; }
+inline int f2987_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2988 */
+#include <vector>
+#include "h3194.h"
+#include "h7785.h"
+#include "h3783.h"
+#include "h7539.h"
+#include "h299.h"
+#ifdef X
+#include "h964.h"
+#endif
+struct S2988 { int a; const char *s = "x//y"; };
+inline int f2988_0(int x) { return x * 0; }
+inline int f2988_1(int x) { return x * 1; }
+inline int f2988_2(int x) { return x * 2; }
+inline int f2988_3(int x) { return x * 3; }
+inline int f2988_4(int x) { return x * 4; }
+inline int f2988_5(int x) { return x * 5; }
+inline int f2988_6(int x) { return x * 6; }
+inline int f2988_7(int x) { return x * 7; }
+inline int f2988_8(int x) { return x * 8; }
+inline int f2988_9(int x) { return x * 9; }
+inline int f2988_10(int x) { return x * 10; }
+inline int f2988_11(int x) { return x * 11; }
+inline int f2988_12(int x) { return x * 12; }
+inline int f2988_13(int x) { return x * 13; }
+inline int f2988_14(int x) { return x * 14; }
+inline int f2988_15(int x) { return x * 15; }
+inline int f2988_16(int x) { return x * 16; }
+inline int f2988_17(int x) { return x * 17; }
+inline int f2988_18(int x) { return x * 18; }
+inline int f2988_19(int x) { return x * 19; }
+inline int f2988_20(int x) { return x * 20; }
+inline int f2988_21(int x) { return x * 21; }
+inline int f2988_22(int x) { return x * 22; }
+inline int f2988_23(int x) { return x * 23; }
+inline int f2988_24(int x) { return x * 24; }
+inline int f2988_25(int x) { return x * 25; }
+inline int f2988_26(int x) { return x * 26; }
+inline int f2988_27(int x) { return x * 27; }
+inline int f2988_28(int x) { return x * 28; }
+inline int f2988_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 299 */
+#include <vector>
+#include "h4402.h"
+#include "h103.h"
+#include "h9741.h"
+#include "h4189.h"
+#include "h5256.h"
+#ifdef X
+#include "h4586.h"
+#endif
+struct S299 { int a; const char *s = "x//y"; };
+inline int f299_0(int x) { return x * 0; }
+inline int f299_1(int x) { return x * 1; }
+inline int f299_2(int x) { return x * 2; }
+inline int f299_3(int x) { return x * 3; }
+inline int f299_4(int x) { return x * 4; }
+inline int f299_5(int x) { return x * 5; }
+inline int f299_6(int x) { return x * 6; }
+inline int f299_7(int x) { return x * 7; }
+inline int f299_8(int x) { return x * 8; }
+inline int f299_9(int x) { return x * 9; }
+inline int f299_10(int x) { return x * 10; }
+inline int f299_11(int x) { return x * 11; }
+inline int f299_12(int x) { return x * 12; }
+inline int f299_13(int x) { return x * 13; }
+inline int f299_14(int x) { return x * 14; }
+inline int f299_15(int x) { return x * 15; }
+inline int f299_16(int x) { return x * 16; }
+inline int f299_17(int x) { return x * 17; }
+inline int f299_18(int x) { return x * 18; }
+inline int f299_19(int x) { return x * 19; }
+inline int f299_20(int x) { return x * 20; }
+inline int f299_21(int x) { return x * 21; }
+inline int f299_22(int x) { return x * 22; }
+inline int f299_23(int x) { return x * 23; }
+inline int f299_24(int x) { return x * 24; }
+inline int f299_25(int x) { return x * 25; }
+inline int f299_26(int x) { return x * 26; }
+inline int f299_27(int x) { return x * 27; }
+inline int f299_28(int x) { return x * 28; }
+inline int f299_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 2992 */
+#include <vector>
+#include "h4714.h"
+#include "h1792.h"
+#include "h1023.h"
+#include "h3831.h"
+#include "h8036.h"
+#ifdef X
+#include "h5234.h"
+#endif
+struct S2992 { int a; const char *s = "x//y"; };
+inline int f2992_0(int x) { return x * 0; }
+inline int f2992_1(int x) { return x * 1; }
+inline int f2992_2(int x) { return x * 2; }
+inline int f2992_3(int x) { return x * 3; }
+inline int f2992_4(int x) { return x * 4; }
+inline int f2992_5(int x) { return x * 5; }
+inline int f2992_6(int x) { return x * 6; }
+inline int f2992_7(int x) { return x * 7; }
+inline int f2992_8(int x) { return x * 8; }
+inline int f2992_9(int x) { return x * 9; }
+inline int f2992_10(int x) { return x * 10; }
+inline int f2992_11(int x) { return x * 11; }
+inline int f2992_12(int x) { return x * 12; }
+inline int f2992_13(int x) { return x * 13; }
+inline int f2992_14(int x) { return x * 14; }
+inline int f2992_15(int x) { return x * 15; }
+inline int f2992_16(int x) { return x * 16; }
+inline int f2992_17(int x) { return x * 17; }
+inline int f2992_18(int x) { return x * 18; }
+inline int f2992_19(int x) { return x * 19; }
+inline int f2992_20(int x) { return x * 20; }
+inline int f2992_21(int x) { return x * 21; }
+inline int f2992_22(int x) { return x * 22; }
+inline int f2992_23(int x) { return x * 23; }
+inline int f2992_24(int x) { return x * 24; }
+inline int f2992_25(int x) { return x * 25; }
+inline int f2992_26(int x) { return x * 26; }
+inline int f2992_27(int x) { return x * 27; }
+inline int f2992_28(int x) { return x * 28; }
+inline int f2992_29(int x) { return x * 29; }
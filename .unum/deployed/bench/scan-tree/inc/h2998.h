@@ -0,0 +1,42 @@
+#pragma once
+/* header 2998 */
+#include <vector>
+#include "h9673.h"
+#include "h7165.h"
+#include "h4419.h"
+#include "h676.h"
+#include "h6210.h"
+#ifdef X
+#include "h1408.h"
+#endif
+struct S2998 { int a; const char *s = "x//y"; };
+inline int f2998_0(int x) { return x * 0; }
+inline int f2998_1(int x) { return x * 1; }
+inline int f2998_2(int x) { return x * 2; }
+inline int f2998_3(int x) { return x * 3; }
+inline int f2998_4(int x) { return x * 4; }
+inline int f2998_5(int x) { return x * 5; }
+inline int f2998_6(int x) { return x * 6; }
+inline int f2998_7(int x) { return x * 7; }
+inline int f2998_8(int x) { return x * 8; }
+inline int f2998_9(int x) { return x * 9; }
+inline int f2998_10(int x) { return x * 10; }
+inline int f2998_11(int x) { return x * 11; }
+inline int f2998_12(int x) { return x * 12; }
+inline int f2998_13(int x) { return x * 13; }
+inline int f2998_14(int x) { return x * 14; }
+inline int f2998_15(int x) { return x * 15; }
+inline int f2998_16(int x) { return x * 16; }
+inline int f2998_17(int x) { return x * 17; }
+inline int f2998_18(int x) { return x * 18; }
+inline int f2998_19(int x) { return x * 19; }
+inline int f2998_20(int x) { return x * 20; }
+inline int f2998_21(int x) { return x * 21; }
+inline int f2998_22(int x) { return x * 22; }
+inline int f2998_23(int x) { return x * 23; }
+inline int f2998_24(int x) { return x * 24; }
+inline int f2998_25(int x) { return x * 25; }
+inline int f2998_26(int x) { return x * 26; }
+inline int f2998_27(int x) { return x * 27; }
+inline int f2998_28(int x) { return x * 28; }
+inline int f2998_29(int x) { return x * 29; }
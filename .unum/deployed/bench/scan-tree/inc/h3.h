@@ -0,0 +1,42 @@
+#pragma once
+/* header 3 */
+#include <vector>
+#include "h92.h"
+#include "h3094.h"
+#include "h2860.h"
+#include "h1109.h"
+#include "h8317.h"
+#ifdef X
+#include "h7177.h"
+#endif
+struct S3 { int a; const char *s = "x//y"; };
+inline int f3_0(int x) { return x * 0; }
+inline int f3_1(int x) { return x * 1; }
+inline int f3_2(int x) { return x * 2; }
+inline int f3_3(int x) { return x * 3; }
+inline int f3_4(int x) { return x * 4; }
+inline int f3_5(int x) { return x * 5; }
+inline int f3_6(int x) { return x * 6; }
+inline int f3_7(int x) { return x * 7; }
+inline int f3_8(int x) { return x * 8; }
+inline int f3_9(int x) { return x * 9; }
+inline int f3_10(int x) { return x * 10; }
+inline int f3_11(int x) { return x * 11; }
+inline int f3_12(int x) { return x * 12; }
+inline int f3_13(int x) { return x * 13; }
+inline int f3_14(int x) { return x * 14; }
+inline int f3_15(int x) { return x * 15; }
+inline int f3_16(int x) { return x * 16; }
+inline int f3_17(int x) { return x * 17; }
+inline int f3_18(int x) { return x * 18; }
+inline int f3_19(int x) { return x * 19; }
+inline int f3_20(int x) { return x * 20; }
+inline int f3_21(int x) { return x * 21; }
+inline int f3_22(int x) { return x * 22; }
+inline int f3_23(int x) { return x * 23; }
+inline int f3_24(int x) { return x * 24; }
+inline int f3_25(int x) { return x * 25; }
+inline int f3_26(int x) { return x * 26; }
+inline int f3_27(int x) { return x * 27; }
+inline int f3_28(int x) { return x * 28; }
+inline int f3_29(int x) { return x * 29; }
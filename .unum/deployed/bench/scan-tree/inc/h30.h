@@ -0,0 +1,42 @@
+#pragma once
+/* header 30 */
+#include <vector>
+#include "h1014.h"
+#include "h4698.h"
+#include "h330.h"
+#include "h7301.h"
+#include "h3684.h"
+#ifdef X
+#include "h4173.h"
+#endif
+struct S30 { int a; const char *s = "x//y"; };
+inline int f30_0(int x) { return x * 0; }
+inline int f30_1(int x) { return x * 1; }
+inline int f30_2(int x) { return x * 2; }
+inline int f30_3(int x) { return x * 3; }
+inline int f30_4(int x) { return x * 4; }
+inline int f30_5(int x) { return x * 5; }
+inline int f30_6(int x) { return x * 6; }
+inline int f30_7(int x) { return x * 7; }
+inline int f30_8(int x) { return x * 8; }
+inline int f30_9(int x) { return x * 9; }
+inline int f30_10(int x) { return x * 10; }
+inline int f30_11(int x) { return x * 11; }
+inline int f30_12(int x) { return x * 12; }
+inline int f30_13(int x) { return x * 13; }
+inline int f30_14(int x) { return x * 14; }
+inline int f30_15(int x) { return x * 15; }
+inline int f30_16(int x) { return x * 16; }
+inline int f30_17(int x) { return x * 17; }
+inline int f30_18(int x) { return x * 18; }
+inline int f30_19(int x) { return x * 19; }
+inline int f30_20(int x) { return x * 20; }
+inline int f30_21(int x) { return x * 21; }
+inline int f30_22(int x) { return x * 22; }
+inline int f30_23(int x) { return x * 23; }
+inline int f30_24(int x) { return x * 24; }
+inline int f30_25(int x) { return x * 25; }
+inline int f30_26(int x) { return x * 26; }
+inline int f30_27(int x) { return x * 27; }
+inline int f30_28(int x) { return x * 28; }
+inline int f30_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3000 */
+#include <vector>
+#include "h3850.h"
+#include "h8993.h"
+#include "h6872.h"
+#include "h9463.h"
+#include "h8008.h"
+#ifdef X
+#include "h4149.h"
+#endif
+struct S3000 { int a; const char *s = "x//y"; };
+inline int f3000_0(int x) { return x * 0; }
+inline int f3000_1(int x) { return x * 1; }
+inline int f3000_2(int x) { return x * 2; }
+inline int f3000_3(int x) { return x * 3; }
+inline int f3000_4(int x) { return x * 4; }
+inline int f3000_5(int x) { return x * 5; }
+inline int f3000_6(int x) { return x * 6; }
+inline int f3000_7(int x) { return x * 7; }
+inline int f3000_8(int x) { return x * 8; }
+inline int f3000_9(int x) { return x * 9; }
+inline int f3000_10(int x) { return x * 10; }
+inline int f3000_11(int x) { return x * 11; }
+inline int f3000_12(int x) { return x * 12; }
+inline int f3000_13(int x) { return x * 13; }
+inline int f3000_14(int x) { return x * 14; }
+inline int f3000_15(int x) { return x * 15; }
+inline int f3000_16(int x) { return x * 16; }
+inline int f3000_17(int x) { return x * 17; }
+inline int f3000_18(int x) { return x * 18; }
+inline int f3000_19(int x) { return x * 19; }
+inline int f3000_20(int x) { return x * 20; }
+inline int f3000_21(int x) { return x * 21; }
+inline int f3000_22(int x) { return x * 22; }
+inline int f3000_23(int x) { return x * 23; }
+inline int f3000_24(int x) { return x * 24; }
+inline int f3000_25(int x) { return x * 25; }
+inline int f3000_26(int x) { return x * 26; }
+inline int f3000_27(int x) { return x * 27; }
+inline int f3000_28(int x) { return x * 28; }
+inline int f3000_29(int x) { return x * 29; }
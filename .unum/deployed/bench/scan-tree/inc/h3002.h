@@ -0,0 +1,42 @@
+#pragma once
+/* header 3002 */
+#include <vector>
+#include "h9688.h"
+#include "h4043.h"
+#include "h9258.h"
+#include "h4725.h"
+#include "h7425.h"
+#ifdef X
+#include "h7100.h"
+#endif
+struct S3002 { int a; const char *s = "x//y"; };
+inline int f3002_0(int x) { return x * 0; }
+inline int f3002_1(int x) { return x * 1; }
+inline int f3002_2(int x) { return x * 2; }
+inline int f3002_3(int x) { return x * 3; }
+inline int f3002_4(int x) { return x * 4; }
+inline int f3002_5(int x) { return x * 5; }
+inline int f3002_6(int x) { return x * 6; }
+inline int f3002_7(int x) { return x * 7; }
+inline int f3002_8(int x) { return x * 8; }
+inline int f3002_9(int x) { return x * 9; }
+inline int f3002_10(int x) { return x * 10; }
+inline int f3002_11(int x) { return x * 11; }
+inline int f3002_12(int x) { return x * 12; }
+inline int f3002_13(int x) { return x * 13; }
+inline int f3002_14(int x) { return x * 14; }
+inline int f3002_15(int x) { return x * 15; }
+inline int f3002_16(int x) { return x * 16; }
+inline int f3002_17(int x) { return x * 17; }
+inline int f3002_18(int x) { return x * 18; }
+inline int f3002_19(int x) { return x * 19; }
+inline int f3002_20(int x) { return x * 20; }
+inline int f3002_21(int x) { return x * 21; }
+inline int f3002_22(int x) { return x * 22; }
+inline int f3002_23(int x) { return x * 23; }
+inline int f3002_24(int x) { return x * 24; }
+inline int f3002_25(int x) { return x * 25; }
+inline int f3002_26(int x) { return x * 26; }
+inline int f3002_27(int x) { return x * 27; }
+inline int f3002_28(int x) { return x * 28; }
+inline int f3002_29(int x) { return x * 29; }
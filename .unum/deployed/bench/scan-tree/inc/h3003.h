@@ -0,0 +1,42 @@
+#pragma once
+/* header 3003 */
+#include <vector>
+#include "h105.h"
+#include "h7765.h"
+#include "h140.h"
+#include "h5502.h"
+#include "h9366.h"
+#ifdef X
+#include "h7085.h"
+#endif
+struct S3003 { int a; const char *s = "x//y"; };
+inline int f3003_0(int x) { return x * 0; }
+inline int f3003_1(int x) { return x * 1; }
+inline int f3003_2(int x) { return x * 2; }
+inline int f3003_3(int x) { return x * 3; }
+inline int f3003_4(int x) { return x * 4; }
+inline int f3003_5(int x) { return x * 5; }
+inline int f3003_6(int x) { return x * 6; }
+inline int f3003_7(int x) { return x * 7; }
+inline int f3003_8(int x) { return x * 8; }
+inline int f3003_9(int x) { return x * 9; }
+inline int f3003_10(int x) { return x * 10; }
+inline int f3003_11(int x) { return x * 11; }
+inline int f3003_12(int x) { return x * 12; }
+inline int f3003_13(int x) { return x * 13; }
+inline int f3003_14(int x) { return x * 14; }
+inline int f3003_15(int x) { return x * 15; }
+inline int f3003_16(int x) { return x * 16; }
+inline int f3003_17(int x) { return x * 17; }
+inline int f3003_18(int x) { return x * 18; }
+inline int f3003_19(int x) { return x * 19; }
+inline int f3003_20(int x) { return x * 20; }
+inline int f3003_21(int x) { return x * 21; }
+inline int f3003_22(int x) { return x * 22; }
+inline int f3003_23(int x) { return x * 23; }
+inline int f3003_24(int x) { return x * 24; }
+inline int f3003_25(int x) { return x * 25; }
+inline int f3003_26(int x) { return x * 26; }
+inline int f3003_27(int x) { return x * 27; }
+inline int f3003_28(int x) { return x * 28; }
+inline int f3003_29(int x) { return x * 29; }
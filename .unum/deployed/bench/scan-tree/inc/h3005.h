@@ -0,0 +1,42 @@
+#pragma once
+/* header 3005 */
+#include <vector>
+#include "h4826.h"
+#include "h2904.h"
+#include "h1078.h"
+#include "h8665.h"
+#include "h3994.h"
+#ifdef X
+#include "h1253.h"
+#endif
+struct S3005 { int a; const char *s = "x//y"; };
+inline int f3005_0(int x) { return x * 0; }
+inline int f3005_1(int x) { return x * 1; }
+inline int f3005_2(int x) { return x * 2; }
+inline int f3005_3(int x) { return x * 3; }
+inline int f3005_4(int x) { return x * 4; }
+inline int f3005_5(int x) { return x * 5; }
+inline int f3005_6(int x) { return x * 6; }
+inline int f3005_7(int x) { return x * 7; }
+inline int f3005_8(int x) { return x * 8; }
+inline int f3005_9(int x) { return x * 9; }
+inline int f3005_10(int x) { return x * 10; }
+inline int f3005_11(int x) { return x * 11; }
+inline int f3005_12(int x) { return x * 12; }
+inline int f3005_13(int x) { return x * 13; }
+inline int f3005_14(int x) { return x * 14; }
+inline int f3005_15(int x) { return x * 15; }
+inline int f3005_16(int x) { return x * 16; }
+inline int f3005_17(int x) { return x * 17; }
+inline int f3005_18(int x) { return x * 18; }
+inline int f3005_19(int x) { return x * 19; }
+inline int f3005_20(int x) { return x * 20; }
+inline int f3005_21(int x) { return x * 21; }
+inline int f3005_22(int x) { return x * 22; }
+inline int f3005_23(int x) { return x * 23; }
+inline int f3005_24(int x) { return x * 24; }
+inline int f3005_25(int x) { return x * 25; }
+inline int f3005_26(int x) { return x * 26; }
+inline int f3005_27(int x) { return x * 27; }
+inline int f3005_28(int x) { return x * 28; }
+inline int f3005_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3008 */
+#include <vector>
+#include "h190.h"
+#include "h6904.h"
+#include "h736.h"
+#include "h2169.h"
+#include "h8288.h"
+#ifdef X
+#include "h6443.h"
+#endif
+struct S3008 { int a; const char *s = "x//y"; };
+inline int f3008_0(int x) { return x * 0; }
+inline int f3008_1(int x) { return x * 1; }
+inline int f3008_2(int x) { return x * 2; }
+inline int f3008_3(int x) { return x * 3; }
+inline int f3008_4(int x) { return x * 4; }
+inline int f3008_5(int x) { return x * 5; }
+inline int f3008_6(int x) { return x * 6; }
+inline int f3008_7(int x) { return x * 7; }
+inline int f3008_8(int x) { return x * 8; }
+inline int f3008_9(int x) { return x * 9; }
+inline int f3008_10(int x) { return x * 10; }
+inline int f3008_11(int x) { return x * 11; }
+inline int f3008_12(int x) { return x * 12; }
+inline int f3008_13(int x) { return x * 13; }
+inline int f3008_14(int x) { return x * 14; }
+inline int f3008_15(int x) { return x * 15; }
+inline int f3008_16(int x) { return x * 16; }
+inline int f3008_17(int x) { return x * 17; }
+inline int f3008_18(int x) { return x * 18; }
+inline int f3008_19(int x) { return x * 19; }
+inline int f3008_20(int x) { return x * 20; }
+inline int f3008_21(int x) { return x * 21; }
+inline int f3008_22(int x) { return x * 22; }
+inline int f3008_23(int x) { return x * 23; }
+inline int f3008_24(int x) { return x * 24; }
+inline int f3008_25(int x) { return x * 25; }
+inline int f3008_26(int x) { return x * 26; }
+inline int f3008_27(int x) { return x * 27; }
+inline int f3008_28(int x) { return x * 28; }
+inline int f3008_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 301 */
+#include <vector>
+#include "h173.h"
+#include "h8589.h"
+#include "h3050.h"
+#include "h43.h"
+#include "h1263.h"
+#ifdef X
+#include "h5404.h"
+#endif
+struct S301 { int a; const char *s = "x//y"; };
+inline int f301_0(int x) { return x * 0; }
+inline int f301_1(int x) { return x * 1; }
+inline int f301_2(int x) { return x * 2; }
+inline int f301_3(int x) { return x * 3; }
+inline int f301_4(int x) { return x * 4; }
+inline int f301_5(int x) { return x * 5; }
+inline int f301_6(int x) { return x * 6; }
+inline int f301_7(int x) { return x * 7; }
+inline int f301_8(int x) { return x * 8; }
+inline int f301_9(int x) { return x * 9; }
+inline int f301_10(int x) { return x * 10; }
+inline int f301_11(int x) { return x * 11; }
+inline int f301_12(int x) { return x * 12; }
+inline int f301_13(int x) { return x * 13; }
+inline int f301_14(int x) { return x * 14; }
+inline int f301_15(int x) { return x * 15; }
+inline int f301_16(int x) { return x * 16; }
+inline int f301_17(int x) { return x * 17; }
+inline int f301_18(int x) { return x * 18; }
+inline int f301_19(int x) { return x * 19; }
+inline int f301_20(int x) { return x * 20; }
+inline int f301_21(int x) { return x * 21; }
+inline int f301_22(int x) { return x * 22; }
+inline int f301_23(int x) { return x * 23; }
+inline int f301_24(int x) { return x * 24; }
+inline int f301_25(int x) { return x * 25; }
+inline int f301_26(int x) { return x * 26; }
+inline int f301_27(int x) { return x * 27; }
+inline int f301_28(int x) { return x * 28; }
+inline int f301_29(int x) { return x * 29; }
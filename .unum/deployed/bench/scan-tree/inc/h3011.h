@@ -0,0 +1,42 @@
+#pragma once
+/* header 3011 */
+#include <vector>
+#include "h4327.h"
+#include "h6988.h"
+#include "h1186.h"
+#include "h5530.h"
+#include "h8296.h"
+#ifdef X
+#include "h6590.h"
+#endif
+struct S3011 { int a; const char *s = "x//y"; };
+inline int f3011_0(int x) { return x * 0; }
+inline int f3011_1(int x) { return x * 1; }
+inline int f3011_2(int x) { return x * 2; }
+inline int f3011_3(int x) { return x * 3; }
+inline int f3011_4(int x) { return x * 4; }
+inline int f3011_5(int x) { return x * 5; }
+inline int f3011_6(int x) { return x * 6; }
+inline int f3011_7(int x) { return x * 7; }
+inline int f3011_8(int x) { return x * 8; }
+inline int f3011_9(int x) { return x * 9; }
+inline int f3011_10(int x) { return x * 10; }
+inline int f3011_11(int x) { return x * 11; }
+inline int f3011_12(int x) { return x * 12; }
+inline int f3011_13(int x) { return x * 13; }
+inline int f3011_14(int x) { return x * 14; }
+inline int f3011_15(int x) { return x * 15; }
+inline int f3011_16(int x) { return x * 16; }
+inline int f3011_17(int x) { return x * 17; }
+inline int f3011_18(int x) { return x * 18; }
+inline int f3011_19(int x) { return x * 19; }
+inline int f3011_20(int x) { return x * 20; }
+inline int f3011_21(int x) { return x * 21; }
+inline int f3011_22(int x) { return x * 22; }
+inline int f3011_23(int x) { return x * 23; }
+inline int f3011_24(int x) { return x * 24; }
+inline int f3011_25(int x) { return x * 25; }
+inline int f3011_26(int x) { return x * 26; }
+inline int f3011_27(int x) { return x * 27; }
+inline int f3011_28(int x) { return x * 28; }
+inline int f3011_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3013 */
+#include <vector>
+#include "h5531.h"
+#include "h7089.h"
+#include "h3577.h"
+#include "h3693.h"
+#include "h9939.h"
+#ifdef X
+#include "h6553.h"
+#endif
+struct S3013 { int a; const char *s = "x//y"; };
+inline int f3013_0(int x) { return x * 0; }
+inline int f3013_1(int x) { return x * 1; }
+inline int f3013_2(int x) { return x * 2; }
+inline int f3013_3(int x) { return x * 3; }
+inline int f3013_4(int x) { return x * 4; }
+inline int f3013_5(int x) { return x * 5; }
+inline int f3013_6(int x) { return x * 6; }
+inline int f3013_7(int x) { return x * 7; }
+inline int f3013_8(int x) { return x * 8; }
+inline int f3013_9(int x) { return x * 9; }
+inline int f3013_10(int x) { return x * 10; }
+inline int f3013_11(int x) { return x * 11; }
+inline int f3013_12(int x) { return x * 12; }
+inline int f3013_13(int x) { return x * 13; }
+inline int f3013_14(int x) { return x * 14; }
+inline int f3013_15(int x) { return x * 15; }
+inline int f3013_16(int x) { return x * 16; }
+inline int f3013_17(int x) { return x * 17; }
+inline int f3013_18(int x) { return x * 18; }
+inline int f3013_19(int x) { return x * 19; }
+inline int f3013_20(int x) { return x * 20; }
+inline int f3013_21(int x) { return x * 21; }
+inline int f3013_22(int x) { return x * 22; }
+inline int f3013_23(int x) { return x * 23; }
+inline int f3013_24(int x) { return x * 24; }
+inline int f3013_25(int x) { return x * 25; }
+inline int f3013_26(int x) { return x * 26; }
+inline int f3013_27(int x) { return x * 27; }
+inline int f3013_28(int x) { return x * 28; }
+inline int f3013_29(int x) { return x * 29; }
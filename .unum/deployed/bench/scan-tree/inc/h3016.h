@@ -0,0 +1,42 @@
+#pragma once
+/* header 3016 */
+#include <vector>
+#include "h5304.h"
+#include "h3439.h"
+#include "h4533.h"
+#include "h954.h"
+#include "h9384.h"
+#ifdef X
+#include "h5941.h"
+#endif
+struct S3016 { int a; const char *s = "x//y"; };
+inline int f3016_0(int x) { return x * 0; }
+inline int f3016_1(int x) { return x * 1; }
+inline int f3016_2(int x) { return x * 2; }
+inline int f3016_3(int x) { return x * 3; }
+inline int f3016_4(int x) { return x * 4; }
+inline int f3016_5(int x) { return x * 5; }
+inline int f3016_6(int x) { return x * 6; }
+inline int f3016_7(int x) { return x * 7; }
+inline int f3016_8(int x) { return x * 8; }
+inline int f3016_9(int x) { return x * 9; }
+inline int f3016_10(int x) { return x * 10; }
+inline int f3016_11(int x) { return x * 11; }
+inline int f3016_12(int x) { return x * 12; }
+inline int f3016_13(int x) { return x * 13; }
+inline int f3016_14(int x) { return x * 14; }
+inline int f3016_15(int x) { return x * 15; }
+inline int f3016_16(int x) { return x * 16; }
+inline int f3016_17(int x) { return x * 17; }
+inline int f3016_18(int x) { return x * 18; }
+inline int f3016_19(int x) { return x * 19; }
+inline int f3016_20(int x) { return x * 20; }
+inline int f3016_21(int x) { return x * 21; }
+inline int f3016_22(int x) { return x * 22; }
+inline int f3016_23(int x) { return x * 23; }
+inline int f3016_24(int x) { return x * 24; }
+inline int f3016_25(int x) { return x * 25; }
+inline int f3016_26(int x) { return x * 26; }
+inline int f3016_27(int x) { return x * 27; }
+inline int f3016_28(int x) { return x * 28; }
+inline int f3016_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3017 */
+#include <vector>
+#include "h4600.h"
+#include "h7144.h"
+#include "h9756.h"
+#include "h4561.h"
+#include "h1474.h"
+#ifdef X
+#include "h1308.h"
+#endif
+struct S3017 { int a; const char *s = "x//y"; };
+inline int f3017_0(int x) { return x * 0; }
+inline int f3017_1(int x) { return x * 1; }
+inline int f3017_2(int x) { return x * 2; }
+inline int f3017_3(int x) { return x * 3; }
+inline int f3017_4(int x) { return x * 4; }
+inline int f3017_5(int x) { return x * 5; }
+inline int f3017_6(int x) { return x * 6; }
+inline int f3017_7(int x) { return x * 7; }
+inline int f3017_8(int x) { return x * 8; }
+inline int f3017_9(int x) { return x * 9; }
+inline int f3017_10(int x) { return x * 10; }
+inline int f3017_11(int x) { return x * 11; }
+inline int f3017_12(int x) { return x * 12; }
+inline int f3017_13(int x) { return x * 13; }
+inline int f3017_14(int x) { return x * 14; }
+inline int f3017_15(int x) { return x * 15; }
+inline int f3017_16(int x) { return x * 16; }
+inline int f3017_17(int x) { return x * 17; }
+inline int f3017_18(int x) { return x * 18; }
+inline int f3017_19(int x) { return x * 19; }
+inline int f3017_20(int x) { return x * 20; }
+inline int f3017_21(int x) { return x * 21; }
+inline int f3017_22(int x) { return x * 22; }
+inline int f3017_23(int x) { return x * 23; }
+inline int f3017_24(int x) { return x * 24; }
+inline int f3017_25(int x) { return x * 25; }
+inline int f3017_26(int x) { return x * 26; }
+inline int f3017_27(int x) { return x * 27; }
+inline int f3017_28(int x) { return x * 28; }
+inline int f3017_29(int x) { return x * 29; }
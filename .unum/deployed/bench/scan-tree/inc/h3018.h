@@ -0,0 +1,42 @@
+#pragma once
+/* header 3018 */
+#include <vector>
+#include "h353.h"
+#include "h7548.h"
+#include "h1122.h"
+#include "h9845.h"
+#include "h4899.h"
+#ifdef X
+#include "h6620.h"
+#endif
+struct S3018 { int a; const char *s = "x//y"; };
+inline int f3018_0(int x) { return x * 0; }
+inline int f3018_1(int x) { return x * 1; }
+inline int f3018_2(int x) { return x * 2; }
+inline int f3018_3(int x) { return x * 3; }
+inline int f3018_4(int x) { return x * 4; }
+inline int f3018_5(int x) { return x * 5; }
+inline int f3018_6(int x) { return x * 6; }
+inline int f3018_7(int x) { return x * 7; }
+inline int f3018_8(int x) { return x * 8; }
+inline int f3018_9(int x) { return x * 9; }
+inline int f3018_10(int x) { return x * 10; }
+inline int f3018_11(int x) { return x * 11; }
+inline int f3018_12(int x) { return x * 12; }
+inline int f3018_13(int x) { return x * 13; }
+inline int f3018_14(int x) { return x * 14; }
+inline int f3018_15(int x) { return x * 15; }
+inline int f3018_16(int x) { return x * 16; }
+inline int f3018_17(int x) { return x * 17; }
+inline int f3018_18(int x) { return x * 18; }
+inline int f3018_19(int x) { return x * 19; }
+inline int f3018_20(int x) { return x * 20; }
+inline int f3018_21(int x) { return x * 21; }
+inline int f3018_22(int x) { return x * 22; }
+inline int f3018_23(int x) { return x * 23; }
+inline int f3018_24(int x) { return x * 24; }
+inline int f3018_25(int x) { return x * 25; }
+inline int f3018_26(int x) { return x * 26; }
+inline int f3018_27(int x) { return x * 27; }
+inline int f3018_28(int x) { return x * 28; }
+inline int f3018_29(int x) { return x * 29; }
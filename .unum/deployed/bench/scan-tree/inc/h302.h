@@ -0,0 +1,42 @@
+#pragma once
+/* header 302 */
+#include <vector>
+#include "h7484.h"
+#include "h7991.h"
+#include "h5122.h"
+#include "h2005.h"
+#include "h3828.h"
+#ifdef X
+#include "h5299.h"
+#endif
+struct S302 { int a; const char *s = "x//y"; };
+inline int f302_0(int x) { return x * 0; }
+inline int f302_1(int x) { return x * 1; }
+inline int f302_2(int x) { return x * 2; }
+inline int f302_3(int x) { return x * 3; }
+inline int f302_4(int x) { return x * 4; }
+inline int f302_5(int x) { return x * 5; }
+inline int f302_6(int x) { return x * 6; }
+inline int f302_7(int x) { return x * 7; }
+inline int f302_8(int x) { return x * 8; }
+inline int f302_9(int x) { return x * 9; }
+inline int f302_10(int x) { return x * 10; }
+inline int f302_11(int x) { return x * 11; }
+inline int f302_12(int x) { return x * 12; }
+inline int f302_13(int x) { return x * 13; }
+inline int f302_14(int x) { return x * 14; }
+inline int f302_15(int x) { return x * 15; }
+inline int f302_16(int x) { return x * 16; }
+inline int f302_17(int x) { return x * 17; }
+inline int f302_18(int x) { return x * 18; }
+inline int f302_19(int x) { return x * 19; }
+inline int f302_20(int x) { return x * 20; }
+inline int f302_21(int x) { return x * 21; }
+inline int f302_22(int x) { return x * 22; }
+inline int f302_23(int x) { return x * 23; }
+inline int f302_24(int x) { return x * 24; }
+inline int f302_25(int x) { return x * 25; }
+inline int f302_26(int x) { return x * 26; }
+inline int f302_27(int x) { return x * 27; }
+inline int f302_28(int x) { return x * 28; }
+inline int f302_29(int x) { return x * 29; }
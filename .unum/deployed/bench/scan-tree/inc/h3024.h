@@ -0,0 +1,42 @@
+#pragma once
+/* header 3024 */
+#include <vector>
+#include "h7438.h"
+#include "h4873.h"
+#include "h3277.h"
+#include "h232.h"
+#include "h3460.h"
+#ifdef X
+#include "h2809.h"
+#endif
+struct S3024 { int a; const char *s = "x//y"; };
+inline int f3024_0(int x) { return x * 0; }
+inline int f3024_1(int x) { return x * 1; }
+inline int f3024_2(int x) { return x * 2; }
+inline int f3024_3(int x) { return x * 3; }
+inline int f3024_4(int x) { return x * 4; }
+inline int f3024_5(int x) { return x * 5; }
+inline int f3024_6(int x) { return x * 6; }
+inline int f3024_7(int x) { return x * 7; }
+inline int f3024_8(int x) { return x * 8; }
+inline int f3024_9(int x) { return x * 9; }
+inline int f3024_10(int x) { return x * 10; }
+inline int f3024_11(int x) { return x * 11; }
+inline int f3024_12(int x) { return x * 12; }
+inline int f3024_13(int x) { return x * 13; }
+inline int f3024_14(int x) { return x * 14; }
+inline int f3024_15(int x) { return x * 15; }
+inline int f3024_16(int x) { return x * 16; }
+inline int f3024_17(int x) { return x * 17; }
+inline int f3024_18(int x) { return x * 18; }
+inline int f3024_19(int x) { return x * 19; }
+inline int f3024_20(int x) { return x * 20; }
+inline int f3024_21(int x) { return x * 21; }
+inline int f3024_22(int x) { return x * 22; }
+inline int f3024_23(int x) { return x * 23; }
+inline int f3024_24(int x) { return x * 24; }
+inline int f3024_25(int x) { return x * 25; }
+inline int f3024_26(int x) { return x * 26; }
+inline int f3024_27(int x) { return x * 27; }
+inline int f3024_28(int x) { return x * 28; }
+inline int f3024_29(int x) { return x * 29; }
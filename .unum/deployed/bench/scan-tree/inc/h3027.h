@@ -0,0 +1,42 @@
+#pragma once
+/* header 3027 */
+#include <vector>
+#include "h2957.h"
+#include "h4397.h"
+#include "h1119.h"
+#include "h954.h"
+#include "h4703.h"
+#ifdef X
+#include "h7827.h"
+#endif
+struct S3027 { int a; const char *s = "x//y"; };
+inline int f3027_0(int x) { return x * 0; }
+inline int f3027_1(int x) { return x * 1; }
+inline int f3027_2(int x) { return x * 2; }
+inline int f3027_3(int x) { return x * 3; }
+inline int f3027_4(int x) { return x * 4; }
+inline int f3027_5(int x) { return x * 5; }
+inline int f3027_6(int x) { return x * 6; }
+inline int f3027_7(int x) { return x * 7; }
+inline int f3027_8(int x) { return x * 8; }
+inline int f3027_9(int x) { return x * 9; }
+inline int f3027_10(int x) { return x * 10; }
+inline int f3027_11(int x) { return x * 11; }
+inline int f3027_12(int x) { return x * 12; }
+inline int f3027_13(int x) { return x * 13; }
+inline int f3027_14(int x) { return x * 14; }
+inline int f3027_15(int x) { return x * 15; }
+inline int f3027_16(int x) { return x * 16; }
+inline int f3027_17(int x) { return x * 17; }
+inline int f3027_18(int x) { return x * 18; }
+inline int f3027_19(int x) { return x * 19; }
+inline int f3027_20(int x) { return x * 20; }
+inline int f3027_21(int x) { return x * 21; }
+inline int f3027_22(int x) { return x * 22; }
+inline int f3027_23(int x) { return x * 23; }
+inline int f3027_24(int x) { return x * 24; }
+inline int f3027_25(int x) { return x * 25; }
+inline int f3027_26(int x) { return x * 26; }
+inline int f3027_27(int x) { return x * 27; }
+inline int f3027_28(int x) { return x * 28; }
+inline int f3027_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3028 */
+#include <vector>
+#include "h2976.h"
+#include "h5219.h"
+#include "h7895.h"
+#include "h8086.h"
+#include "h114.h"
+#ifdef X
+#include "h3948.h"
+#endif
+struct S3028 { int a; const char *s = "x//y"; };
+inline int f3028_0(int x) { return x * 0; }
+inline int f3028_1(int x) { return x * 1; }
+inline int f3028_2(int x) { return x * 2; }
+inline int f3028_3(int x) { return x * 3; }
+inline int f3028_4(int x) { return x * 4; }
+inline int f3028_5(int x) { return x * 5; }
+inline int f3028_6(int x) { return x * 6; }
+inline int f3028_7(int x) { return x * 7; }
+inline int f3028_8(int x) { return x * 8; }
+inline int f3028_9(int x) { return x * 9; }
+inline int f3028_10(int x) { return x * 10; }
+inline int f3028_11(int x) { return x * 11; }
+inline int f3028_12(int x) { return x * 12; }
+inline int f3028_13(int x) { return x * 13; }
+inline int f3028_14(int x) { return x * 14; }
+inline int f3028_15(int x) { return x * 15; }
+inline int f3028_16(int x) { return x * 16; }
+inline int f3028_17(int x) { return x * 17; }
+inline int f3028_18(int x) { return x * 18; }
+inline int f3028_19(int x) { return x * 19; }
+inline int f3028_20(int x) { return x * 20; }
+inline int f3028_21(int x) { return x * 21; }
+inline int f3028_22(int x) { return x * 22; }
+inline int f3028_23(int x) { return x * 23; }
+inline int f3028_24(int x) { return x * 24; }
+inline int f3028_25(int x) { return x * 25; }
+inline int f3028_26(int x) { return x * 26; }
+inline int f3028_27(int x) { return x * 27; }
+inline int f3028_28(int x) { return x * 28; }
+inline int f3028_29(int x) { return x * 29; }
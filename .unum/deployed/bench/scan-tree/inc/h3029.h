@@ -0,0 +1,42 @@
+#pragma once
+/* header 3029 */
+#include <vector>
+#include "h7495.h"
+#include "h3723.h"
+#include "h2035.h"
+#include "h4695.h"
+#include "h7558.h"
+#ifdef X
+#include "h127.h"
+#endif
+struct S3029 { int a; const char *s = "x//y"; };
+inline int f3029_0(int x) { return x * 0; }
+inline int f3029_1(int x) { return x * 1; }
+inline int f3029_2(int x) { return x * 2; }
+inline int f3029_3(int x) { return x * 3; }
+inline int f3029_4(int x) { return x * 4; }
+inline int f3029_5(int x) { return x * 5; }
+inline int f3029_6(int x) { return x * 6; }
+inline int f3029_7(int x) { return x * 7; }
+inline int f3029_8(int x) { return x * 8; }
+inline int f3029_9(int x) { return x * 9; }
+inline int f3029_10(int x) { return x * 10; }
+inline int f3029_11(int x) { return x * 11; }
+inline int f3029_12(int x) { return x * 12; }
+inline int f3029_13(int x) { return x * 13; }
+inline int f3029_14(int x) { return x * 14; }
+inline int f3029_15(int x) { return x * 15; }
+inline int f3029_16(int x) { return x * 16; }
+inline int f3029_17(int x) { return x * 17; }
+inline int f3029_18(int x) { return x * 18; }
+inline int f3029_19(int x) { return x * 19; }
+inline int f3029_20(int x) { return x * 20; }
+inline int f3029_21(int x) { return x * 21; }
+inline int f3029_22(int x) { return x * 22; }
+inline int f3029_23(int x) { return x * 23; }
+inline int f3029_24(int x) { return x * 24; }
+inline int f3029_25(int x) { return x * 25; }
+inline int f3029_26(int x) { return x * 26; }
+inline int f3029_27(int x) { return x * 27; }
+inline int f3029_28(int x) { return x * 28; }
+inline int f3029_29(int x) { return x * 29; }
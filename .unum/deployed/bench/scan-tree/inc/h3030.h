@@ -0,0 +1,42 @@
+#pragma once
+/* header 3030 */
+#include <vector>
+#include "h5563.h"
+#include "h3382.h"
+#include "h743.h"
+#include "h3640.h"
+#include "h1010.h"
+#ifdef X
+#include "h6225.h"
+#endif
+struct S3030 { int a; const char *s = "x//y"; };
+inline int f3030_0(int x) { return x * 0; }
+inline int f3030_1(int x) { return x * 1; }
+inline int f3030_2(int x) { return x * 2; }
+inline int f3030_3(int x) { return x * 3; }
+inline int f3030_4(int x) { return x * 4; }
+inline int f3030_5(int x) { return x * 5; }
+inline int f3030_6(int x) { return x * 6; }
+inline int f3030_7(int x) { return x * 7; }
+inline int f3030_8(int x) { return x * 8; }
+inline int f3030_9(int x) { return x * 9; }
+inline int f3030_10(int x) { return x * 10; }
+inline int f3030_11(int x) { return x * 11; }
+inline int f3030_12(int x) { return x * 12; }
+inline int f3030_13(int x) { return x * 13; }
+inline int f3030_14(int x) { return x * 14; }
+inline int f3030_15(int x) { return x * 15; }
+inline int f3030_16(int x) { return x * 16; }
+inline int f3030_17(int x) { return x * 17; }
+inline int f3030_18(int x) { return x * 18; }
+inline int f3030_19(int x) { return x * 19; }
+inline int f3030_20(int x) { return x * 20; }
+inline int f3030_21(int x) { return x * 21; }
+inline int f3030_22(int x) { return x * 22; }
+inline int f3030_23(int x) { return x * 23; }
+inline int f3030_24(int x) { return x * 24; }
+inline int f3030_25(int x) { return x * 25; }
+inline int f3030_26(int x) { return x * 26; }
+inline int f3030_27(int x) { return x * 27; }
+inline int f3030_28(int x) { return x * 28; }
+inline int f3030_29(int x) { return x * 29; }
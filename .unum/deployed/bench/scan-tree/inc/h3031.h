@@ -0,0 +1,42 @@
+#pragma once
+/* header 3031 */
+#include <vector>
+#include "h3837.h"
+#include "h827.h"
+#include "h976.h"
+#include "h2667.h"
+#include "h4251.h"
+#ifdef X
+#include "h2686.h"
+#endif
+struct S3031 { int a; const char *s = "x//y"; };
+inline int f3031_0(int x) { return x * 0; }
+inline int f3031_1(int x) { return x * 1; }
+inline int f3031_2(int x) { return x * 2; }
+inline int f3031_3(int x) { return x * 3; }
+inline int f3031_4(int x) { return x * 4; }
+inline int f3031_5(int x) { return x * 5; }
+inline int f3031_6(int x) { return x * 6; }
+inline int f3031_7(int x) { return x * 7; }
+inline int f3031_8(int x) { return x * 8; }
+inline int f3031_9(int x) { return x * 9; }
+inline int f3031_10(int x) { return x * 10; }
+inline int f3031_11(int x) { return x * 11; }
+inline int f3031_12(int x) { return x * 12; }
+inline int f3031_13(int x) { return x * 13; }
+inline int f3031_14(int x) { return x * 14; }
+inline int f3031_15(int x) { return x * 15; }
+inline int f3031_16(int x) { return x * 16; }
+inline int f3031_17(int x) { return x * 17; }
+inline int f3031_18(int x) { return x * 18; }
+inline int f3031_19(int x) { return x * 19; }
+inline int f3031_20(int x) { return x * 20; }
+inline int f3031_21(int x) { return x * 21; }
+inline int f3031_22(int x) { return x * 22; }
+inline int f3031_23(int x) { return x * 23; }
+inline int f3031_24(int x) { return x * 24; }
+inline int f3031_25(int x) { return x * 25; }
+inline int f3031_26(int x) { return x * 26; }
+inline int f3031_27(int x) { return x * 27; }
+inline int f3031_28(int x) { return x * 28; }
+inline int f3031_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3035 */
+#include <vector>
+#include "h1574.h"
+#include "h7494.h"
+#include "h154.h"
+#include "h6443.h"
+#include "h3401.h"
+#ifdef X
+#include "h2566.h"
+#endif
+struct S3035 { int a; const char *s = "x//y"; };
+inline int f3035_0(int x) { return x * 0; }
+inline int f3035_1(int x) { return x * 1; }
+inline int f3035_2(int x) { return x * 2; }
+inline int f3035_3(int x) { return x * 3; }
+inline int f3035_4(int x) { return x * 4; }
+inline int f3035_5(int x) { return x * 5; }
+inline int f3035_6(int x) { return x * 6; }
+inline int f3035_7(int x) { return x * 7; }
+inline int f3035_8(int x) { return x * 8; }
+inline int f3035_9(int x) { return x * 9; }
+inline int f3035_10(int x) { return x * 10; }
+inline int f3035_11(int x) { return x * 11; }
+inline int f3035_12(int x) { return x * 12; }
+inline int f3035_13(int x) { return x * 13; }
+inline int f3035_14(int x) { return x * 14; }
+inline int f3035_15(int x) { return x * 15; }
+inline int f3035_16(int x) { return x * 16; }
+inline int f3035_17(int x) { return x * 17; }
+inline int f3035_18(int x) { return x * 18; }
+inline int f3035_19(int x) { return x * 19; }
+inline int f3035_20(int x) { return x * 20; }
+inline int f3035_21(int x) { return x * 21; }
+inline int f3035_22(int x) { return x * 22; }
+inline int f3035_23(int x) { return x * 23; }
+inline int f3035_24(int x) { return x * 24; }
+inline int f3035_25(int x) { return x * 25; }
+inline int f3035_26(int x) { return x * 26; }
+inline int f3035_27(int x) { return x * 27; }
+inline int f3035_28(int x) { return x * 28; }
+inline int f3035_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3037 */
+#include <vector>
+#include "h7711.h"
+#include "h9337.h"
+#include "h7827.h"
+#include "h8330.h"
+#include "h9187.h"
+#ifdef X
+#include "h8605.h"
+#endif
+struct S3037 { int a; const char *s = "x//y"; };
+inline int f3037_0(int x) { return x * 0; }
+inline int f3037_1(int x) { return x * 1; }
+inline int f3037_2(int x) { return x * 2; }
+inline int f3037_3(int x) { return x * 3; }
+inline int f3037_4(int x) { return x * 4; }
+inline int f3037_5(int x) { return x * 5; }
+inline int f3037_6(int x) { return x * 6; }
+inline int f3037_7(int x) { return x * 7; }
+inline int f3037_8(int x) { return x * 8; }
+inline int f3037_9(int x) { return x * 9; }
+inline int f3037_10(int x) { return x * 10; }
+inline int f3037_11(int x) { return x * 11; }
+inline int f3037_12(int x) { return x * 12; }
+inline int f3037_13(int x) { return x * 13; }
+inline int f3037_14(int x) { return x * 14; }
+inline int f3037_15(int x) { return x * 15; }
+inline int f3037_16(int x) { return x * 16; }
+inline int f3037_17(int x) { return x * 17; }
+inline int f3037_18(int x) { return x * 18; }
+inline int f3037_19(int x) { return x * 19; }
+inline int f3037_20(int x) { return x * 20; }
+inline int f3037_21(int x) { return x * 21; }
+inline int f3037_22(int x) { return x * 22; }
+inline int f3037_23(int x) { return x * 23; }
+inline int f3037_24(int x) { return x * 24; }
+inline int f3037_25(int x) { return x * 25; }
+inline int f3037_26(int x) { return x * 26; }
+inline int f3037_27(int x) { return x * 27; }
+inline int f3037_28(int x) { return x * 28; }
+inline int f3037_29(int x) { return x * 29; }
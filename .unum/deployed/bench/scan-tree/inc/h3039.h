@@ -0,0 +1,42 @@
+#pragma once
+/* header 3039 */
+#include <vector>
+#include "h8398.h"
+#include "h6076.h"
+#include "h1556.h"
+#include "h8528.h"
+#include "h5226.h"
+#ifdef X
+#include "h6385.h"
+#endif
+struct S3039 { int a; const char *s = "x//y"; };
+inline int f3039_0(int x) { return x * 0; }
+inline int f3039_1(int x) { return x * 1; }
+inline int f3039_2(int x) { return x * 2; }
+inline int f3039_3(int x) { return x * 3; }
+inline int f3039_4(int x) { return x * 4; }
+inline int f3039_5(int x) { return x * 5; }
+inline int f3039_6(int x) { return x * 6; }
+inline int f3039_7(int x) { return x * 7; }
+inline int f3039_8(int x) { return x * 8; }
+inline int f3039_9(int x) { return x * 9; }
+inline int f3039_10(int x) { return x * 10; }
+inline int f3039_11(int x) { return x * 11; }
+inline int f3039_12(int x) { return x * 12; }
+inline int f3039_13(int x) { return x * 13; }
+inline int f3039_14(int x) { return x * 14; }
+inline int f3039_15(int x) { return x * 15; }
+inline int f3039_16(int x) { return x * 16; }
+inline int f3039_17(int x) { return x * 17; }
+inline int f3039_18(int x) { return x * 18; }
+inline int f3039_19(int x) { return x * 19; }
+inline int f3039_20(int x) { return x * 20; }
+inline int f3039_21(int x) { return x * 21; }
+inline int f3039_22(int x) { return x * 22; }
+inline int f3039_23(int x) { return x * 23; }
+inline int f3039_24(int x) { return x * 24; }
+inline int f3039_25(int x) { return x * 25; }
+inline int f3039_26(int x) { return x * 26; }
+inline int f3039_27(int x) { return x * 27; }
+inline int f3039_28(int x) { return x * 28; }
+inline int f3039_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3041 */
+#include <vector>
+#include "h1209.h"
+#include "h5756.h"
+#include "h3662.h"
+#include "h5653.h"
+#include "h2186.h"
+#ifdef X
+#include "h3284.h"
+#endif
+struct S3041 { int a; const char *s = "x//y"; };
+inline int f3041_0(int x) { return x * 0; }
+inline int f3041_1(int x) { return x * 1; }
+inline int f3041_2(int x) { return x * 2; }
+inline int f3041_3(int x) { return x * 3; }
+inline int f3041_4(int x) { return x * 4; }
+inline int f3041_5(int x) { return x * 5; }
+inline int f3041_6(int x) { return x * 6; }
+inline int f3041_7(int x) { return x * 7; }
+inline int f3041_8(int x) { return x * 8; }
+inline int f3041_9(int x) { return x * 9; }
+inline int f3041_10(int x) { return x * 10; }
+inline int f3041_11(int x) { return x * 11; }
+inline int f3041_12(int x) { return x * 12; }
+inline int f3041_13(int x) { return x * 13; }
+inline int f3041_14(int x) { return x * 14; }
+inline int f3041_15(int x) { return x * 15; }
+inline int f3041_16(int x) { return x * 16; }
+inline int f3041_17(int x) { return x * 17; }
+inline int f3041_18(int x) { return x * 18; }
+inline int f3041_19(int x) { return x * 19; }
+inline int f3041_20(int x) { return x * 20; }
+inline int f3041_21(int x) { return x * 21; }
+inline int f3041_22(int x) { return x * 22; }
+inline int f3041_23(int x) { return x * 23; }
+inline int f3041_24(int x) { return x * 24; }
+inline int f3041_25(int x) { return x * 25; }
+inline int f3041_26(int x) { return x * 26; }
+inline int f3041_27(int x) { return x * 27; }
+inline int f3041_28(int x) { return x * 28; }
+inline int f3041_29(int x) { return x * 29; }
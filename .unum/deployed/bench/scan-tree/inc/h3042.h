@@ -0,0 +1,42 @@
+#pragma once
+/* header 3042 */
+#include <vector>
+#include "h2128.h"
+#include "h3544.h"
+#include "h8121.h"
+#include "h2543.h"
+#include "h2140.h"
+#ifdef X
+#include "h4172.h"
+#endif
+struct S3042 { int a; const char *s = "x//y"; };
+inline int f3042_0(int x) { return x * 0; }
+inline int f3042_1(int x) { return x * 1; }
+inline int f3042_2(int x) { return x * 2; }
+inline int f3042_3(int x) { return x * 3; }
+inline int f3042_4(int x) { return x * 4; }
+inline int f3042_5(int x) { return x * 5; }
+inline int f3042_6(int x) { return x * 6; }
+inline int f3042_7(int x) { return x * 7; }
+inline int f3042_8(int x) { return x * 8; }
+inline int f3042_9(int x) { return x * 9; }
+inline int f3042_10(int x) { return x * 10; }
+inline int f3042_11(int x) { return x * 11; }
+inline int f3042_12(int x) { return x * 12; }
+inline int f3042_13(int x) { return x * 13; }
+inline int f3042_14(int x) { return x * 14; }
+inline int f3042_15(int x) { return x * 15; }
+inline int f3042_16(int x) { return x * 16; }
+inline int f3042_17(int x) { return x * 17; }
+inline int f3042_18(int x) { return x * 18; }
+inline int f3042_19(int x) { return x * 19; }
+inline int f3042_20(int x) { return x * 20; }
+inline int f3042_21(int x) { return x * 21; }
+inline int f3042_22(int x) { return x * 22; }
+inline int f3042_23(int x) { return x * 23; }
+inline int f3042_24(int x) { return x * 24; }
+inline int f3042_25(int x) { return x * 25; }
+inline int f3042_26(int x) { return x * 26; }
+inline int f3042_27(int x) { return x * 27; }
+inline int f3042_28(int x) { return x * 28; }
+inline int f3042_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3046 */
+#include <vector>
+#include "h3389.h"
+#include "h9889.h"
+#include "h5467.h"
+#include "h30.h"
+#include "h5633.h"
+#ifdef X
+#include "h7873.h"
+#endif
+struct S3046 { int a; const char *s = "x//y"; };
+inline int f3046_0(int x) { return x * 0; }
+inline int f3046_1(int x) { return x * 1; }
+inline int f3046_2(int x) { return x * 2; }
+inline int f3046_3(int x) { return x * 3; }
+inline int f3046_4(int x) { return x * 4; }
+inline int f3046_5(int x) { return x * 5; }
+inline int f3046_6(int x) { return x * 6; }
+inline int f3046_7(int x) { return x * 7; }
+inline int f3046_8(int x) { return x * 8; }
+inline int f3046_9(int x) { return x * 9; }
+inline int f3046_10(int x) { return x * 10; }
+inline int f3046_11(int x) { return x * 11; }
+inline int f3046_12(int x) { return x * 12; }
+inline int f3046_13(int x) { return x * 13; }
+inline int f3046_14(int x) { return x * 14; }
+inline int f3046_15(int x) { return x * 15; }
+inline int f3046_16(int x) { return x * 16; }
+inline int f3046_17(int x) { return x * 17; }
+inline int f3046_18(int x) { return x * 18; }
+inline int f3046_19(int x) { return x * 19; }
+inline int f3046_20(int x) { return x * 20; }
+inline int f3046_21(int x) { return x * 21; }
+inline int f3046_22(int x) { return x * 22; }
+inline int f3046_23(int x) { return x * 23; }
+inline int f3046_24(int x) { return x * 24; }
+inline int f3046_25(int x) { return x * 25; }
+inline int f3046_26(int x) { return x * 26; }
+inline int f3046_27(int x) { return x * 27; }
+inline int f3046_28(int x) { return x * 28; }
+inline int f3046_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3049 */
+#include <vector>
+#include "h5424.h"
+#include "h4037.h"
+#include "h3466.h"
+#include "h5838.h"
+#include "h7003.h"
+#ifdef X
+#include "h7277.h"
+#endif
+struct S3049 { int a; const char *s = "x//y"; };
+inline int f3049_0(int x) { return x * 0; }
+inline int f3049_1(int x) { return x * 1; }
+inline int f3049_2(int x) { return x * 2; }
+inline int f3049_3(int x) { return x * 3; }
+inline int f3049_4(int x) { return x * 4; }
+inline int f3049_5(int x) { return x * 5; }
+inline int f3049_6(int x) { return x * 6; }
+inline int f3049_7(int x) { return x * 7; }
+inline int f3049_8(int x) { return x * 8; }
+inline int f3049_9(int x) { return x * 9; }
+inline int f3049_10(int x) { return x * 10; }
+inline int f3049_11(int x) { return x * 11; }
+inline int f3049_12(int x) { return x * 12; }
+inline int f3049_13(int x) { return x * 13; }
+inline int f3049_14(int x) { return x * 14; }
+inline int f3049_15(int x) { return x * 15; }
+inline int f3049_16(int x) { return x * 16; }
+inline int f3049_17(int x) { return x * 17; }
+inline int f3049_18(int x) { return x * 18; }
+inline int f3049_19(int x) { return x * 19; }
+inline int f3049_20(int x) { return x * 20; }
+inline int f3049_21(int x) { return x * 21; }
+inline int f3049_22(int x) { return x * 22; }
+inline int f3049_23(int x) { return x * 23; }
+inline int f3049_24(int x) { return x * 24; }
+inline int f3049_25(int x) { return x * 25; }
+inline int f3049_26(int x) { return x * 26; }
+inline int f3049_27(int x) { return x * 27; }
+inline int f3049_28(int x) { return x * 28; }
+inline int f3049_29(int x) { return x * 29; }
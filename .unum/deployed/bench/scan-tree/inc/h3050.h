@@ -0,0 +1,42 @@
+#pragma once
+/* header 3050 */
+#include <vector>
+#include "h6601.h"
+#include "h2450.h"
+#include "h9281.h"
+#include "h862.h"
+#include "h8587.h"
+#ifdef X
+#include "h1484.h"
+#endif
+struct S3050 { int a; const char *s = "x//y"; };
+inline int f3050_0(int x) { return x * 0; }
+inline int f3050_1(int x) { return x * 1; }
+inline int f3050_2(int x) { return x * 2; }
+inline int f3050_3(int x) { return x * 3; }
+inline int f3050_4(int x) { return x * 4; }
+inline int f3050_5(int x) { return x * 5; }
+inline int f3050_6(int x) { return x * 6; }
+inline int f3050_7(int x) { return x * 7; }
+inline int f3050_8(int x) { return x * 8; }
+inline int f3050_9(int x) { return x * 9; }
+inline int f3050_10(int x) { return x * 10; }
+inline int f3050_11(int x) { return x * 11; }
+inline int f3050_12(int x) { return x * 12; }
+inline int f3050_13(int x) { return x * 13; }
+inline int f3050_14(int x) { return x * 14; }
+inline int f3050_15(int x) { return x * 15; }
+inline int f3050_16(int x) { return x * 16; }
+inline int f3050_17(int x) { return x * 17; }
+inline int f3050_18(int x) { return x * 18; }
+inline int f3050_19(int x) { return x * 19; }
+inline int f3050_20(int x) { return x * 20; }
+inline int f3050_21(int x) { return x * 21; }
+inline int f3050_22(int x) { return x * 22; }
+inline int f3050_23(int x) { return x * 23; }
+inline int f3050_24(int x) { return x * 24; }
+inline int f3050_25(int x) { return x * 25; }
+inline int f3050_26(int x) { return x * 26; }
+inline int f3050_27(int x) { return x * 27; }
+inline int f3050_28(int x) { return x * 28; }
+inline int f3050_29(int x) { return x * 29; }
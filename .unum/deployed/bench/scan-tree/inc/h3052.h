@@ -0,0 +1,42 @@
+#pragma once
+/* header 3052 */
+#include <vector>
+#include "h8184.h"
+#include "h961.h"
+#include "h2085.h"
+#include "h2078.h"
+#include "h5922.h"
+#ifdef X
+#include "h3286.h"
+#endif
+struct S3052 { int a; const char *s = "x//y"; };
+inline int f3052_0(int x) { return x * 0; }
+inline int f3052_1(int x) { return x * 1; }
+inline int f3052_2(int x) { return x * 2; }
+inline int f3052_3(int x) { return x * 3; }
+inline int f3052_4(int x) { return x * 4; }
+inline int f3052_5(int x) { return x * 5; }
+inline int f3052_6(int x) { return x * 6; }
+inline int f3052_7(int x) { return x * 7; }
+inline int f3052_8(int x) { return x * 8; }
+inline int f3052_9(int x) { return x * 9; }
+inline int f3052_10(int x) { return x * 10; }
+inline int f3052_11(int x) { return x * 11; }
+inline int f3052_12(int x) { return x * 12; }
+inline int f3052_13(int x) { return x * 13; }
+inline int f3052_14(int x) { return x * 14; }
+inline int f3052_15(int x) { return x * 15; }
+inline int f3052_16(int x) { return x * 16; }
+inline int f3052_17(int x) { return x * 17; }
+inline int f3052_18(int x) { return x * 18; }
+inline int f3052_19(int x) { return x * 19; }
+inline int f3052_20(int x) { return x * 20; }
+inline int f3052_21(int x) { return x * 21; }
+inline int f3052_22(int x) { return x * 22; }
+inline int f3052_23(int x) { return x * 23; }
+inline int f3052_24(int x) { return x * 24; }
+inline int f3052_25(int x) { return x * 25; }
+inline int f3052_26(int x) { return x * 26; }
+inline int f3052_27(int x) { return x * 27; }
+inline int f3052_28(int x) { return x * 28; }
+inline int f3052_29(int x) { return x * 29; }
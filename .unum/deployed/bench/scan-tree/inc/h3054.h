@@ -0,0 +1,42 @@
+#pragma once
+/* header 3054 */
+#include <vector>
+#include "h3490.h"
+#include "h7250.h"
+#include "h2639.h"
+#include "h9236.h"
+#include "h594.h"
+#ifdef X
+#include "h1108.h"
+#endif
+struct S3054 { int a; const char *s = "x//y"; };
+inline int f3054_0(int x) { return x * 0; }
+inline int f3054_1(int x) { return x * 1; }
+inline int f3054_2(int x) { return x * 2; }
+inline int f3054_3(int x) { return x * 3; }
+inline int f3054_4(int x) { return x * 4; }
+inline int f3054_5(int x) { return x * 5; }
+inline int f3054_6(int x) { return x * 6; }
+inline int f3054_7(int x) { return x * 7; }
+inline int f3054_8(int x) { return x * 8; }
+inline int f3054_9(int x) { return x * 9; }
+inline int f3054_10(int x) { return x * 10; }
+inline int f3054_11(int x) { return x * 11; }
+inline int f3054_12(int x) { return x * 12; }
+inline int f3054_13(int x) { return x * 13; }
+inline int f3054_14(int x) { return x * 14; }
+inline int f3054_15(int x) { return x * 15; }
+inline int f3054_16(int x) { return x * 16; }
+inline int f3054_17(int x) { return x * 17; }
+inline int f3054_18(int x) { return x * 18; }
+inline int f3054_19(int x) { return x * 19; }
+inline int f3054_20(int x) { return x * 20; }
+inline int f3054_21(int x) { return x * 21; }
+inline int f3054_22(int x) { return x * 22; }
+inline int f3054_23(int x) { return x * 23; }
+inline int f3054_24(int x) { return x * 24; }
+inline int f3054_25(int x) { return x * 25; }
+inline int f3054_26(int x) { return x * 26; }
+inline int f3054_27(int x) { return x * 27; }
+inline int f3054_28(int x) { return x * 28; }
+inline int f3054_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3056 */
+#include <vector>
+#include "h1357.h"
+#include "h3729.h"
+#include "h5386.h"
+#include "h3177.h"
+#include "h8102.h"
+#ifdef X
+#include "h4561.h"
+#endif
+struct S3056 { int a; const char *s = "x//y"; };
+inline int f3056_0(int x) { return x * 0; }
+inline int f3056_1(int x) { return x * 1; }
+inline int f3056_2(int x) { return x * 2; }
+inline int f3056_3(int x) { return x * 3; }
+inline int f3056_4(int x) { return x * 4; }
+inline int f3056_5(int x) { return x * 5; }
+inline int f3056_6(int x) { return x * 6; }
+inline int f3056_7(int x) { return x * 7; }
+inline int f3056_8(int x) { return x * 8; }
+inline int f3056_9(int x) { return x * 9; }
+inline int f3056_10(int x) { return x * 10; }
+inline int f3056_11(int x) { return x * 11; }
+inline int f3056_12(int x) { return x * 12; }
+inline int f3056_13(int x) { return x * 13; }
+inline int f3056_14(int x) { return x * 14; }
+inline int f3056_15(int x) { return x * 15; }
+inline int f3056_16(int x) { return x * 16; }
+inline int f3056_17(int x) { return x * 17; }
+inline int f3056_18(int x) { return x * 18; }
+inline int f3056_19(int x) { return x * 19; }
+inline int f3056_20(int x) { return x * 20; }
+inline int f3056_21(int x) { return x * 21; }
+inline int f3056_22(int x) { return x * 22; }
+inline int f3056_23(int x) { return x * 23; }
+inline int f3056_24(int x) { return x * 24; }
+inline int f3056_25(int x) { return x * 25; }
+inline int f3056_26(int x) { return x * 26; }
+inline int f3056_27(int x) { return x * 27; }
+inline int f3056_28(int x) { return x * 28; }
+inline int f3056_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3057 */
+#include <vector>
+#include "h5587.h"
+#include "h8418.h"
+#include "h5768.h"
+#include "h7993.h"
+#include "h1544.h"
+#ifdef X
+#include "h6673.h"
+#endif
+struct S3057 { int a; const char *s = "x//y"; };
+inline int f3057_0(int x) { return x * 0; }
+inline int f3057_1(int x) { return x * 1; }
+inline int f3057_2(int x) { return x * 2; }
+inline int f3057_3(int x) { return x * 3; }
+inline int f3057_4(int x) { return x * 4; }
+inline int f3057_5(int x) { return x * 5; }
+inline int f3057_6(int x) { return x * 6; }
+inline int f3057_7(int x) { return x * 7; }
+inline int f3057_8(int x) { return x * 8; }
+inline int f3057_9(int x) { return x * 9; }
+inline int f3057_10(int x) { return x * 10; }
+inline int f3057_11(int x) { return x * 11; }
+inline int f3057_12(int x) { return x * 12; }
+inline int f3057_13(int x) { return x * 13; }
+inline int f3057_14(int x) { return x * 14; }
+inline int f3057_15(int x) { return x * 15; }
+inline int f3057_16(int x) { return x * 16; }
+inline int f3057_17(int x) { return x * 17; }
+inline int f3057_18(int x) { return x * 18; }
+inline int f3057_19(int x) { return x * 19; }
+inline int f3057_20(int x) { return x * 20; }
+inline int f3057_21(int x) { return x * 21; }
+inline int f3057_22(int x) { return x * 22; }
+inline int f3057_23(int x) { return x * 23; }
+inline int f3057_24(int x) { return x * 24; }
+inline int f3057_25(int x) { return x * 25; }
+inline int f3057_26(int x) { return x * 26; }
+inline int f3057_27(int x) { return x * 27; }
+inline int f3057_28(int x) { return x * 28; }
+inline int f3057_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 306 */
+#include <vector>
+#include "h7279.h"
+#include "h1167.h"
+#include "h6396.h"
+#include "h9371.h"
+#include "h7398.h"
+#ifdef X
+#include "h2693.h"
+#endif
+struct S306 { int a; const char *s = "x//y"; };
+inline int f306_0(int x) { return x * 0; }
+inline int f306_1(int x) { return x * 1; }
+inline int f306_2(int x) { return x * 2; }
+inline int f306_3(int x) { return x * 3; }
+inline int f306_4(int x) { return x * 4; }
+inline int f306_5(int x) { return x * 5; }
+inline int f306_6(int x) { return x * 6; }
+inline int f306_7(int x) { return x * 7; }
+inline int f306_8(int x) { return x * 8; }
+inline int f306_9(int x) { return x * 9; }
+inline int f306_10(int x) { return x * 10; }
+inline int f306_11(int x) { return x * 11; }
+inline int f306_12(int x) { return x * 12; }
+inline int f306_13(int x) { return x * 13; }
+inline int f306_14(int x) { return x * 14; }
+inline int f306_15(int x) { return x * 15; }
+inline int f306_16(int x) { return x * 16; }
+inline int f306_17(int x) { return x * 17; }
+inline int f306_18(int x) { return x * 18; }
+inline int f306_19(int x) { return x * 19; }
+inline int f306_20(int x) { return x * 20; }
+inline int f306_21(int x) { return x * 21; }
+inline int f306_22(int x) { return x * 22; }
+inline int f306_23(int x) { return x * 23; }
+inline int f306_24(int x) { return x * 24; }
+inline int f306_25(int x) { return x * 25; }
+inline int f306_26(int x) { return x * 26; }
+inline int f306_27(int x) { return x * 27; }
+inline int f306_28(int x) { return x * 28; }
+inline int f306_29(int x) { return x * 29; }
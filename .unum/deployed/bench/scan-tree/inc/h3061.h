@@ -0,0 +1,42 @@
+#pragma once
+/* header 3061 */
+#include <vector>
+#include "h5092.h"
+#include "h7557.h"
+#include "h1707.h"
+#include "h9539.h"
+#include "h1222.h"
+#ifdef X
+#include "h3315.h"
+#endif
+struct S3061 { int a; const char *s = "x//y"; };
+inline int f3061_0(int x) { return x * 0; }
+inline int f3061_1(int x) { return x * 1; }
+inline int f3061_2(int x) { return x * 2; }
+inline int f3061_3(int x) { return x * 3; }
+inline int f3061_4(int x) { return x * 4; }
+inline int f3061_5(int x) { return x * 5; }
+inline int f3061_6(int x) { return x * 6; }
+inline int f3061_7(int x) { return x * 7; }
+inline int f3061_8(int x) { return x * 8; }
+inline int f3061_9(int x) { return x * 9; }
+inline int f3061_10(int x) { return x * 10; }
+inline int f3061_11(int x) { return x * 11; }
+inline int f3061_12(int x) { return x * 12; }
+inline int f3061_13(int x) { return x * 13; }
+inline int f3061_14(int x) { return x * 14; }
+inline int f3061_15(int x) { return x * 15; }
+inline int f3061_16(int x) { return x * 16; }
+inline int f3061_17(int x) { return x * 17; }
+inline int f3061_18(int x) { return x * 18; }
+inline int f3061_19(int x) { return x * 19; }
+inline int f3061_20(int x) { return x * 20; }
+inline int f3061_21(int x) { return x * 21; }
+inline int f3061_22(int x) { return x * 22; }
+inline int f3061_23(int x) { return x * 23; }
+inline int f3061_24(int x) { return x * 24; }
+inline int f3061_25(int x) { return x * 25; }
+inline int f3061_26(int x) { return x * 26; }
+inline int f3061_27(int x) { return x * 27; }
+inline int f3061_28(int x) { return x * 28; }
+inline int f3061_29(int x) { return x * 29; }
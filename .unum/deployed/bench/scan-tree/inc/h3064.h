@@ -0,0 +1,42 @@
+#pragma once
+/* header 3064 */
+#include <vector>
+#include "h359.h"
+#include "h3204.h"
+#include "h9893.h"
+#include "h4225.h"
+#include "h8356.h"
+#ifdef X
+#include "h6938.h"
+#endif
+struct S3064 { int a; const char *s = "x//y"; };
+inline int f3064_0(int x) { return x * 0; }
+inline int f3064_1(int x) { return x * 1; }
+inline int f3064_2(int x) { return x * 2; }
+inline int f3064_3(int x) { return x * 3; }
+inline int f3064_4(int x) { return x * 4; }
+inline int f3064_5(int x) { return x * 5; }
+inline int f3064_6(int x) { return x * 6; }
+inline int f3064_7(int x) { return x * 7; }
+inline int f3064_8(int x) { return x * 8; }
+inline int f3064_9(int x) { return x * 9; }
+inline int f3064_10(int x) { return x * 10; }
+inline int f3064_11(int x) { return x * 11; }
+inline int f3064_12(int x) { return x * 12; }
+inline int f3064_13(int x) { return x * 13; }
+inline int f3064_14(int x) { return x * 14; }
+inline int f3064_15(int x) { return x * 15; }
+inline int f3064_16(int x) { return x * 16; }
+inline int f3064_17(int x) { return x * 17; }
+inline int f3064_18(int x) { return x * 18; }
+inline int f3064_19(int x) { return x * 19; }
+inline int f3064_20(int x) { return x * 20; }
+inline int f3064_21(int x) { return x * 21; }
+inline int f3064_22(int x) { return x * 22; }
+inline int f3064_23(int x) { return x * 23; }
+inline int f3064_24(int x) { return x * 24; }
+inline int f3064_25(int x) { return x * 25; }
+inline int f3064_26(int x) { return x * 26; }
+inline int f3064_27(int x) { return x * 27; }
+inline int f3064_28(int x) { return x * 28; }
+inline int f3064_29(int x) { return x * 29; }
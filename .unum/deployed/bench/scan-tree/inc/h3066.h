@@ -0,0 +1,42 @@
+#pragma once
+/* header 3066 */
+#include <vector>
+#include "h6036.h"
+#include "h7435.h"
+#include "h6324.h"
+#include "h1997.h"
+#include "h3092.h"
+#ifdef X
+#include "h183.h"
+#endif
+struct S3066 { int a; const char *s = "x//y"; };
+inline int f3066_0(int x) { return x * 0; }
+inline int f3066_1(int x) { return x * 1; }
+inline int f3066_2(int x) { return x * 2; }
+inline int f3066_3(int x) { return x * 3; }
+inline int f3066_4(int x) { return x * 4; }
+inline int f3066_5(int x) { return x * 5; }
+inline int f3066_6(int x) { return x * 6; }
+inline int f3066_7(int x) { return x * 7; }
+inline int f3066_8(int x) { return x * 8; }
+inline int f3066_9(int x) { return x * 9; }
+inline int f3066_10(int x) { return x * 10; }
+inline int f3066_11(int x) { return x * 11; }
+inline int f3066_12(int x) { return x * 12; }
+inline int f3066_13(int x) { return x * 13; }
+inline int f3066_14(int x) { return x * 14; }
+inline int f3066_15(int x) { return x * 15; }
+inline int f3066_16(int x) { return x * 16; }
+inline int f3066_17(int x) { return x * 17; }
+inline int f3066_18(int x) { return x * 18; }
+inline int f3066_19(int x) { return x * 19; }
+inline int f3066_20(int x) { return x * 20; }
+inline int f3066_21(int x) { return x * 21; }
+inline int f3066_22(int x) { return x * 22; }
+inline int f3066_23(int x) { return x * 23; }
+inline int f3066_24(int x) { return x * 24; }
+inline int f3066_25(int x) { return x * 25; }
+inline int f3066_26(int x) { return x * 26; }
+inline int f3066_27(int x) { return x * 27; }
+inline int f3066_28(int x) { return x * 28; }
+inline int f3066_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3067 */
+#include <vector>
+#include "h5477.h"
+#include "h3260.h"
+#include "h5623.h"
+#include "h5741.h"
+#include "h5756.h"
+#ifdef X
+#include "h8090.h"
+#endif
+struct S3067 { int a; const char *s = "x//y"; };
+inline int f3067_0(int x) { return x * 0; }
+inline int f3067_1(int x) { return x * 1; }
+inline int f3067_2(int x) { return x * 2; }
+inline int f3067_3(int x) { return x * 3; }
+inline int f3067_4(int x) { return x * 4; }
+inline int f3067_5(int x) { return x * 5; }
+inline int f3067_6(int x) { return x * 6; }
+inline int f3067_7(int x) { return x * 7; }
+inline int f3067_8(int x) { return x * 8; }
+inline int f3067_9(int x) { return x * 9; }
+inline int f3067_10(int x) { return x * 10; }
+inline int f3067_11(int x) { return x * 11; }
+inline int f3067_12(int x) { return x * 12; }
+inline int f3067_13(int x) { return x * 13; }
+inline int f3067_14(int x) { return x * 14; }
+inline int f3067_15(int x) { return x * 15; }
+inline int f3067_16(int x) { return x * 16; }
+inline int f3067_17(int x) { return x * 17; }
+inline int f3067_18(int x) { return x * 18; }
+inline int f3067_19(int x) { return x * 19; }
+inline int f3067_20(int x) { return x * 20; }
+inline int f3067_21(int x) { return x * 21; }
+inline int f3067_22(int x) { return x * 22; }
+inline int f3067_23(int x) { return x * 23; }
+inline int f3067_24(int x) { return x * 24; }
+inline int f3067_25(int x) { return x * 25; }
+inline int f3067_26(int x) { return x * 26; }
+inline int f3067_27(int x) { return x * 27; }
+inline int f3067_28(int x) { return x * 28; }
+inline int f3067_29(int x) { return x * 29; }
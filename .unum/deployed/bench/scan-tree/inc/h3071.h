@@ -0,0 +1,42 @@
+#pragma once
+/* header 3071 */
+#include <vector>
+#include "h6738.h"
+#include "h3458.h"
+#include "h4394.h"
+#include "h5683.h"
+#include "h7496.h"
+#ifdef X
+#include "h5556.h"
+#endif
+struct S3071 { int a; const char *s = "x//y"; };
+inline int f3071_0(int x) { return x * 0; }
+inline int f3071_1(int x) { return x * 1; }
+inline int f3071_2(int x) { return x * 2; }
+inline int f3071_3(int x) { return x * 3; }
+inline int f3071_4(int x) { return x * 4; }
+inline int f3071_5(int x) { return x * 5; }
+inline int f3071_6(int x) { return x * 6; }
+inline int f3071_7(int x) { return x * 7; }
+inline int f3071_8(int x) { return x * 8; }
+inline int f3071_9(int x) { return x * 9; }
+inline int f3071_10(int x) { return x * 10; }
+inline int f3071_11(int x) { return x * 11; }
+inline int f3071_12(int x) { return x * 12; }
+inline int f3071_13(int x) { return x * 13; }
+inline int f3071_14(int x) { return x * 14; }
+inline int f3071_15(int x) { return x * 15; }
+inline int f3071_16(int x) { return x * 16; }
+inline int f3071_17(int x) { return x * 17; }
+inline int f3071_18(int x) { return x * 18; }
+inline int f3071_19(int x) { return x * 19; }
+inline int f3071_20(int x) { return x * 20; }
+inline int f3071_21(int x) { return x * 21; }
+inline int f3071_22(int x) { return x * 22; }
+inline int f3071_23(int x) { return x * 23; }
+inline int f3071_24(int x) { return x * 24; }
+inline int f3071_25(int x) { return x * 25; }
+inline int f3071_26(int x) { return x * 26; }
+inline int f3071_27(int x) { return x * 27; }
+inline int f3071_28(int x) { return x * 28; }
+inline int f3071_29(int x) { return x * 29; }
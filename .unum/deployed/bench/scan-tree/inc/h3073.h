@@ -0,0 +1,42 @@
+#pragma once
+/* header 3073 */
+#include <vector>
+#include "h9481.h"
+#include "h436.h"
+#include "h2127.h"
+#include "h615.h"
+#include "h3554.h"
+#ifdef X
+#include "h8282.h"
+#endif
+struct S3073 { int a; const char *s = "x//y"; };
+inline int f3073_0(int x) { return x * 0; }
+inline int f3073_1(int x) { return x * 1; }
+inline int f3073_2(int x) { return x * 2; }
+inline int f3073_3(int x) { return x * 3; }
+inline int f3073_4(int x) { return x * 4; }
+inline int f3073_5(int x) { return x * 5; }
+inline int f3073_6(int x) { return x * 6; }
+inline int f3073_7(int x) { return x * 7; }
+inline int f3073_8(int x) { return x * 8; }
+inline int f3073_9(int x) { return x * 9; }
+inline int f3073_10(int x) { return x * 10; }
+inline int f3073_11(int x) { return x * 11; }
+inline int f3073_12(int x) { return x * 12; }
+inline int f3073_13(int x) { return x * 13; }
+inline int f3073_14(int x) { return x * 14; }
+inline int f3073_15(int x) { return x * 15; }
+inline int f3073_16(int x) { return x * 16; }
+inline int f3073_17(int x) { return x * 17; }
+inline int f3073_18(int x) { return x * 18; }
+inline int f3073_19(int x) { return x * 19; }
+inline int f3073_20(int x) { return x * 20; }
+inline int f3073_21(int x) { return x * 21; }
+inline int f3073_22(int x) { return x * 22; }
+inline int f3073_23(int x) { return x * 23; }
+inline int f3073_24(int x) { return x * 24; }
+inline int f3073_25(int x) { return x * 25; }
+inline int f3073_26(int x) { return x * 26; }
+inline int f3073_27(int x) { return x * 27; }
+inline int f3073_28(int x) { return x * 28; }
+inline int f3073_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3074 */
+#include <vector>
+#include "h8286.h"
+#include "h4825.h"
+#include "h2853.h"
+#include "h5756.h"
+#include "h3423.h"
+#ifdef X
+#include "h7350.h"
+#endif
+struct S3074 { int a; const char *s = "x//y"; };
+inline int f3074_0(int x) { return x * 0; }
+inline int f3074_1(int x) { return x * 1; }
+inline int f3074_2(int x) { return x * 2; }
+inline int f3074_3(int x) { return x * 3; }
+inline int f3074_4(int x) { return x * 4; }
+inline int f3074_5(int x) { return x * 5; }
+inline int f3074_6(int x) { return x * 6; }
+inline int f3074_7(int x) { return x * 7; }
+inline int f3074_8(int x) { return x * 8; }
+inline int f3074_9(int x) { return x * 9; }
+inline int f3074_10(int x) { return x * 10; }
+inline int f3074_11(int x) { return x * 11; }
+inline int f3074_12(int x) { return x * 12; }
+inline int f3074_13(int x) { return x * 13; }
+inline int f3074_14(int x) { return x * 14; }
+inline int f3074_15(int x) { return x * 15; }
+inline int f3074_16(int x) { return x * 16; }
+inline int f3074_17(int x) { return x * 17; }
+inline int f3074_18(int x) { return x * 18; }
+inline int f3074_19(int x) { return x * 19; }
+inline int f3074_20(int x) { return x * 20; }
+inline int f3074_21(int x) { return x * 21; }
+inline int f3074_22(int x) { return x * 22; }
+inline int f3074_23(int x) { return x * 23; }
+inline int f3074_24(int x) { return x * 24; }
+inline int f3074_25(int x) { return x * 25; }
+inline int f3074_26(int x) { return x * 26; }
+inline int f3074_27(int x) { return x * 27; }
+inline int f3074_28(int x) { return x * 28; }
+inline int f3074_29(int x) { return x * 29; }
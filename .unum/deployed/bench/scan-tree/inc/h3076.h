@@ -0,0 +1,42 @@
+#pragma once
+/* header 3076 */
+#include <vector>
+#include "h6419.h"
+#include "h643.h"
+#include "h8291.h"
+#include "h373.h"
+#include "h8128.h"
+#ifdef X
+#include "h9872.h"
+#endif
+struct S3076 { int a; const char *s = "x//y"; };
+inline int f3076_0(int x) { return x * 0; }
+inline int f3076_1(int x) { return x * 1; }
+inline int f3076_2(int x) { return x * 2; }
+inline int f3076_3(int x) { return x * 3; }
+inline int f3076_4(int x) { return x * 4; }
+inline int f3076_5(int x) { return x * 5; }
+inline int f3076_6(int x) { return x * 6; }
+inline int f3076_7(int x) { return x * 7; }
+inline int f3076_8(int x) { return x * 8; }
+inline int f3076_9(int x) { return x * 9; }
+inline int f3076_10(int x) { return x * 10; }
+inline int f3076_11(int x) { return x * 11; }
+inline int f3076_12(int x) { return x * 12; }
+inline int f3076_13(int x) { return x * 13; }
+inline int f3076_14(int x) { return x * 14; }
+inline int f3076_15(int x) { return x * 15; }
+inline int f3076_16(int x) { return x * 16; }
+inline int f3076_17(int x) { return x * 17; }
+inline int f3076_18(int x) { return x * 18; }
+inline int f3076_19(int x) { return x * 19; }
+inline int f3076_20(int x) { return x * 20; }
+inline int f3076_21(int x) { return x * 21; }
+inline int f3076_22(int x) { return x * 22; }
+inline int f3076_23(int x) { return x * 23; }
+inline int f3076_24(int x) { return x * 24; }
+inline int f3076_25(int x) { return x * 25; }
+inline int f3076_26(int x) { return x * 26; }
+inline int f3076_27(int x) { return x * 27; }
+inline int f3076_28(int x) { return x * 28; }
+inline int f3076_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3077 */
+#include <vector>
+#include "h9314.h"
+#include "h4556.h"
+#include "h4105.h"
+#include "h2454.h"
+#include "h1803.h"
+#ifdef X
+#include "h8956.h"
+#endif
+struct S3077 { int a; const char *s = "x//y"; };
+inline int f3077_0(int x) { return x * 0; }
+inline int f3077_1(int x) { return x * 1; }
+inline int f3077_2(int x) { return x * 2; }
+inline int f3077_3(int x) { return x * 3; }
+inline int f3077_4(int x) { return x * 4; }
+inline int f3077_5(int x) { return x * 5; }
+inline int f3077_6(int x) { return x * 6; }
+inline int f3077_7(int x) { return x * 7; }
+inline int f3077_8(int x) { return x * 8; }
+inline int f3077_9(int x) { return x * 9; }
+inline int f3077_10(int x) { return x * 10; }
+inline int f3077_11(int x) { return x * 11; }
+inline int f3077_12(int x) { return x * 12; }
+inline int f3077_13(int x) { return x * 13; }
+inline int f3077_14(int x) { return x * 14; }
+inline int f3077_15(int x) { return x * 15; }
+inline int f3077_16(int x) { return x * 16; }
+inline int f3077_17(int x) { return x * 17; }
+inline int f3077_18(int x) { return x * 18; }
+inline int f3077_19(int x) { return x * 19; }
+inline int f3077_20(int x) { return x * 20; }
+inline int f3077_21(int x) { return x * 21; }
+inline int f3077_22(int x) { return x * 22; }
+inline int f3077_23(int x) { return x * 23; }
+inline int f3077_24(int x) { return x * 24; }
+inline int f3077_25(int x) { return x * 25; }
+inline int f3077_26(int x) { return x * 26; }
+inline int f3077_27(int x) { return x * 27; }
+inline int f3077_28(int x) { return x * 28; }
+inline int f3077_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3078 */
+#include <vector>
+#include "h2240.h"
+#include "h9167.h"
+#include "h2672.h"
+#include "h4848.h"
+#include "h169.h"
+#ifdef X
+#include "h4617.h"
+#endif
+struct S3078 { int a; const char *s = "x//y"; };
+inline int f3078_0(int x) { return x * 0; }
+inline int f3078_1(int x) { return x * 1; }
+inline int f3078_2(int x) { return x * 2; }
+inline int f3078_3(int x) { return x * 3; }
+inline int f3078_4(int x) { return x * 4; }
+inline int f3078_5(int x) { return x * 5; }
+inline int f3078_6(int x) { return x * 6; }
+inline int f3078_7(int x) { return x * 7; }
+inline int f3078_8(int x) { return x * 8; }
+inline int f3078_9(int x) { return x * 9; }
+inline int f3078_10(int x) { return x * 10; }
+inline int f3078_11(int x) { return x * 11; }
+inline int f3078_12(int x) { return x * 12; }
+inline int f3078_13(int x) { return x * 13; }
+inline int f3078_14(int x) { return x * 14; }
+inline int f3078_15(int x) { return x * 15; }
+inline int f3078_16(int x) { return x * 16; }
+inline int f3078_17(int x) { return x * 17; }
+inline int f3078_18(int x) { return x * 18; }
+inline int f3078_19(int x) { return x * 19; }
+inline int f3078_20(int x) { return x * 20; }
+inline int f3078_21(int x) { return x * 21; }
+inline int f3078_22(int x) { return x * 22; }
+inline int f3078_23(int x) { return x * 23; }
+inline int f3078_24(int x) { return x * 24; }
+inline int f3078_25(int x) { return x * 25; }
+inline int f3078_26(int x) { return x * 26; }
+inline int f3078_27(int x) { return x * 27; }
+inline int f3078_28(int x) { return x * 28; }
+inline int f3078_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3082 */
+#include <vector>
+#include "h223.h"
+#include "h4509.h"
+#include "h5975.h"
+#include "h841.h"
+#include "h7415.h"
+#ifdef X
+#include "h8559.h"
+#endif
+struct S3082 { int a; const char *s = "x//y"; };
+inline int f3082_0(int x) { return x * 0; }
+inline int f3082_1(int x) { return x * 1; }
+inline int f3082_2(int x) { return x * 2; }
+inline int f3082_3(int x) { return x * 3; }
+inline int f3082_4(int x) { return x * 4; }
+inline int f3082_5(int x) { return x * 5; }
+inline int f3082_6(int x) { return x * 6; }
+inline int f3082_7(int x) { return x * 7; }
+inline int f3082_8(int x) { return x * 8; }
+inline int f3082_9(int x) { return x * 9; }
+inline int f3082_10(int x) { return x * 10; }
+inline int f3082_11(int x) { return x * 11; }
+inline int f3082_12(int x) { return x * 12; }
+inline int f3082_13(int x) { return x * 13; }
+inline int f3082_14(int x) { return x * 14; }
+inline int f3082_15(int x) { return x * 15; }
+inline int f3082_16(int x) { return x * 16; }
+inline int f3082_17(int x) { return x * 17; }
+inline int f3082_18(int x) { return x * 18; }
+inline int f3082_19(int x) { return x * 19; }
+inline int f3082_20(int x) { return x * 20; }
+inline int f3082_21(int x) { return x * 21; }
+inline int f3082_22(int x) { return x * 22; }
+inline int f3082_23(int x) { return x * 23; }
+inline int f3082_24(int x) { return x * 24; }
+inline int f3082_25(int x) { return x * 25; }
+inline int f3082_26(int x) { return x * 26; }
+inline int f3082_27(int x) { return x * 27; }
+inline int f3082_28(int x) { return x * 28; }
+inline int f3082_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3084 */
+#include <vector>
+#include "h9918.h"
+#include "h4541.h"
+#include "h1241.h"
+#include "h8054.h"
+#include "h415.h"
+#ifdef X
+#include "h406.h"
+#endif
+struct S3084 { int a; const char *s = "x//y"; };
+inline int f3084_0(int x) { return x * 0; }
+inline int f3084_1(int x) { return x * 1; }
+inline int f3084_2(int x) { return x * 2; }
+inline int f3084_3(int x) { return x * 3; }
+inline int f3084_4(int x) { return x * 4; }
+inline int f3084_5(int x) { return x * 5; }
+inline int f3084_6(int x) { return x * 6; }
+inline int f3084_7(int x) { return x * 7; }
+inline int f3084_8(int x) { return x * 8; }
+inline int f3084_9(int x) { return x * 9; }
+inline int f3084_10(int x) { return x * 10; }
+inline int f3084_11(int x) { return x * 11; }
+inline int f3084_12(int x) { return x * 12; }
+inline int f3084_13(int x) { return x * 13; }
+inline int f3084_14(int x) { return x * 14; }
+inline int f3084_15(int x) { return x * 15; }
+inline int f3084_16(int x) { return x * 16; }
+inline int f3084_17(int x) { return x * 17; }
+inline int f3084_18(int x) { return x * 18; }
+inline int f3084_19(int x) { return x * 19; }
+inline int f3084_20(int x) { return x * 20; }
+inline int f3084_21(int x) { return x * 21; }
+inline int f3084_22(int x) { return x * 22; }
+inline int f3084_23(int x) { return x * 23; }
+inline int f3084_24(int x) { return x * 24; }
+inline int f3084_25(int x) { return x * 25; }
+inline int f3084_26(int x) { return x * 26; }
+inline int f3084_27(int x) { return x * 27; }
+inline int f3084_28(int x) { return x * 28; }
+inline int f3084_29(int x) { return x * 29; }
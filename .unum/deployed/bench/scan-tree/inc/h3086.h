@@ -0,0 +1,42 @@
+#pragma once
+/* header 3086 */
+#include <vector>
+#include "h36.h"
+#include "h4739.h"
+#include "h3385.h"
+#include "h4364.h"
+#include "h6320.h"
+#ifdef X
+#include "h2812.h"
+#endif
+struct S3086 { int a; const char *s = "x//y"; };
+inline int f3086_0(int x) { return x * 0; }
+inline int f3086_1(int x) { return x * 1; }
+inline int f3086_2(int x) { return x * 2; }
+inline int f3086_3(int x) { return x * 3; }
+inline int f3086_4(int x) { return x * 4; }
+inline int f3086_5(int x) { return x * 5; }
+inline int f3086_6(int x) { return x * 6; }
+inline int f3086_7(int x) { return x * 7; }
+inline int f3086_8(int x) { return x * 8; }
+inline int f3086_9(int x) { return x * 9; }
+inline int f3086_10(int x) { return x * 10; }
+inline int f3086_11(int x) { return x * 11; }
+inline int f3086_12(int x) { return x * 12; }
+inline int f3086_13(int x) { return x * 13; }
+inline int f3086_14(int x) { return x * 14; }
+inline int f3086_15(int x) { return x * 15; }
+inline int f3086_16(int x) { return x * 16; }
+inline int f3086_17(int x) { return x * 17; }
+inline int f3086_18(int x) { return x * 18; }
+inline int f3086_19(int x) { return x * 19; }
+inline int f3086_20(int x) { return x * 20; }
+inline int f3086_21(int x) { return x * 21; }
+inline int f3086_22(int x) { return x * 22; }
+inline int f3086_23(int x) { return x * 23; }
+inline int f3086_24(int x) { return x * 24; }
+inline int f3086_25(int x) { return x * 25; }
+inline int f3086_26(int x) { return x * 26; }
+inline int f3086_27(int x) { return x * 27; }
+inline int f3086_28(int x) { return x * 28; }
+inline int f3086_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3087 */
+#include <vector>
+#include "h3437.h"
+#include "h23.h"
+#include "h108.h"
+#include "h63.h"
+#include "h5173.h"
+#ifdef X
+#include "h5068.h"
+#endif
+struct S3087 { int a; const char *s = "x//y"; };
+inline int f3087_0(int x) { return x * 0; }
+inline int f3087_1(int x) { return x * 1; }
+inline int f3087_2(int x) { return x * 2; }
+inline int f3087_3(int x) { return x * 3; }
+inline int f3087_4(int x) { return x * 4; }
+inline int f3087_5(int x) { return x * 5; }
+inline int f3087_6(int x) { return x * 6; }
+inline int f3087_7(int x) { return x * 7; }
+inline int f3087_8(int x) { return x * 8; }
+inline int f3087_9(int x) { return x * 9; }
+inline int f3087_10(int x) { return x * 10; }
+inline int f3087_11(int x) { return x * 11; }
+inline int f3087_12(int x) { return x * 12; }
+inline int f3087_13(int x) { return x * 13; }
+inline int f3087_14(int x) { return x * 14; }
+inline int f3087_15(int x) { return x * 15; }
+inline int f3087_16(int x) { return x * 16; }
+inline int f3087_17(int x) { return x * 17; }
+inline int f3087_18(int x) { return x * 18; }
+inline int f3087_19(int x) { return x * 19; }
+inline int f3087_20(int x) { return x * 20; }
+inline int f3087_21(int x) { return x * 21; }
+inline int f3087_22(int x) { return x * 22; }
+inline int f3087_23(int x) { return x * 23; }
+inline int f3087_24(int x) { return x * 24; }
+inline int f3087_25(int x) { return x * 25; }
+inline int f3087_26(int x) { return x * 26; }
+inline int f3087_27(int x) { return x * 27; }
+inline int f3087_28(int x) { return x * 28; }
+inline int f3087_29(int x) { return x * 29; }
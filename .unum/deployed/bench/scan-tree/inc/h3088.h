@@ -0,0 +1,42 @@
+#pragma once
+/* header 3088 */
+#include <vector>
+#include "h6512.h"
+#include "h2586.h"
+#include "h9246.h"
+#include "h3637.h"
+#include "h2123.h"
+#ifdef X
+#include "h7441.h"
+#endif
+struct S3088 { int a; const char *s = "x//y"; };
+inline int f3088_0(int x) { return x * 0; }
+inline int f3088_1(int x) { return x * 1; }
+inline int f3088_2(int x) { return x * 2; }
+inline int f3088_3(int x) { return x * 3; }
+inline int f3088_4(int x) { return x * 4; }
+inline int f3088_5(int x) { return x * 5; }
+inline int f3088_6(int x) { return x * 6; }
+inline int f3088_7(int x) { return x * 7; }
+inline int f3088_8(int x) { return x * 8; }
+inline int f3088_9(int x) { return x * 9; }
+inline int f3088_10(int x) { return x * 10; }
+inline int f3088_11(int x) { return x * 11; }
+inline int f3088_12(int x) { return x * 12; }
+inline int f3088_13(int x) { return x * 13; }
+inline int f3088_14(int x) { return x * 14; }
+inline int f3088_15(int x) { return x * 15; }
+inline int f3088_16(int x) { return x * 16; }
+inline int f3088_17(int x) { return x * 17; }
+inline int f3088_18(int x) { return x * 18; }
+inline int f3088_19(int x) { return x * 19; }
+inline int f3088_20(int x) { return x * 20; }
+inline int f3088_21(int x) { return x * 21; }
+inline int f3088_22(int x) { return x * 22; }
+inline int f3088_23(int x) { return x * 23; }
+inline int f3088_24(int x) { return x * 24; }
+inline int f3088_25(int x) { return x * 25; }
+inline int f3088_26(int x) { return x * 26; }
+inline int f3088_27(int x) { return x * 27; }
+inline int f3088_28(int x) { return x * 28; }
+inline int f3088_29(int x) { return x * 29; }
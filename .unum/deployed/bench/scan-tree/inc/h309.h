@@ -0,0 +1,42 @@
+#pragma once
+/* header 309 */
+#include <vector>
+#include "h9488.h"
+#include "h4415.h"
+#include "h794.h"
+#include "h7573.h"
+#include "h8581.h"
+#ifdef X
+#include "h9270.h"
+#endif
+struct S309 { int a; const char *s = "x//y"; };
+inline int f309_0(int x) { return x * 0; }
+inline int f309_1(int x) { return x * 1; }
+inline int f309_2(int x) { return x * 2; }
+inline int f309_3(int x) { return x * 3; }
+inline int f309_4(int x) { return x * 4; }
+inline int f309_5(int x) { return x * 5; }
+inline int f309_6(int x) { return x * 6; }
+inline int f309_7(int x) { return x * 7; }
+inline int f309_8(int x) { return x * 8; }
+inline int f309_9(int x) { return x * 9; }
+inline int f309_10(int x) { return x * 10; }
+inline int f309_11(int x) { return x * 11; }
+inline int f309_12(int x) { return x * 12; }
+inline int f309_13(int x) { return x * 13; }
+inline int f309_14(int x) { return x * 14; }
+inline int f309_15(int x) { return x * 15; }
+inline int f309_16(int x) { return x * 16; }
+inline int f309_17(int x) { return x * 17; }
+inline int f309_18(int x) { return x * 18; }
+inline int f309_19(int x) { return x * 19; }
+inline int f309_20(int x) { return x * 20; }
+inline int f309_21(int x) { return x * 21; }
+inline int f309_22(int x) { return x * 22; }
+inline int f309_23(int x) { return x * 23; }
+inline int f309_24(int x) { return x * 24; }
+inline int f309_25(int x) { return x * 25; }
+inline int f309_26(int x) { return x * 26; }
+inline int f309_27(int x) { return x * 27; }
+inline int f309_28(int x) { return x * 28; }
+inline int f309_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3095 */
+#include <vector>
+#include "h6773.h"
+#include "h3621.h"
+#include "h1666.h"
+#include "h7603.h"
+#include "h9908.h"
+#ifdef X
+#include "h7.h"
+#endif
+struct S3095 { int a; const char *s = "x//y"; };
+inline int f3095_0(int x) { return x * 0; }
+inline int f3095_1(int x) { return x * 1; }
+inline int f3095_2(int x) { return x * 2; }
+inline int f3095_3(int x) { return x * 3; }
+inline int f3095_4(int x) { return x * 4; }
+inline int f3095_5(int x) { return x * 5; }
+inline int f3095_6(int x) { return x * 6; }
+inline int f3095_7(int x) { return x * 7; }
+inline int f3095_8(int x) { return x * 8; }
+inline int f3095_9(int x) { return x * 9; }
+inline int f3095_10(int x) { return x * 10; }
+inline int f3095_11(int x) { return x * 11; }
+inline int f3095_12(int x) { return x * 12; }
+inline int f3095_13(int x) { return x * 13; }
+inline int f3095_14(int x) { return x * 14; }
+inline int f3095_15(int x) { return x * 15; }
+inline int f3095_16(int x) { return x * 16; }
+inline int f3095_17(int x) { return x * 17; }
+inline int f3095_18(int x) { return x * 18; }
+inline int f3095_19(int x) { return x * 19; }
+inline int f3095_20(int x) { return x * 20; }
+inline int f3095_21(int x) { return x * 21; }
+inline int f3095_22(int x) { return x * 22; }
+inline int f3095_23(int x) { return x * 23; }
+inline int f3095_24(int x) { return x * 24; }
+inline int f3095_25(int x) { return x * 25; }
+inline int f3095_26(int x) { return x * 26; }
+inline int f3095_27(int x) { return x * 27; }
+inline int f3095_28(int x) { return x * 28; }
+inline int f3095_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3097 */
+#include <vector>
+#include "h2448.h"
+#include "h1737.h"
+#include "h4896.h"
+#include "h136.h"
+#include "h1309.h"
+#ifdef X
+#include "h5484.h"
+#endif
+struct S3097 { int a; const char *s = "x//y"; };
+inline int f3097_0(int x) { return x * 0; }
+inline int f3097_1(int x) { return x * 1; }
+inline int f3097_2(int x) { return x * 2; }
+inline int f3097_3(int x) { return x * 3; }
+inline int f3097_4(int x) { return x * 4; }
+inline int f3097_5(int x) { return x * 5; }
+inline int f3097_6(int x) { return x * 6; }
+inline int f3097_7(int x) { return x * 7; }
+inline int f3097_8(int x) { return x * 8; }
+inline int f3097_9(int x) { return x * 9; }
+inline int f3097_10(int x) { return x * 10; }
+inline int f3097_11(int x) { return x * 11; }
+inline int f3097_12(int x) { return x * 12; }
+inline int f3097_13(int x) { return x * 13; }
+inline int f3097_14(int x) { return x * 14; }
+inline int f3097_15(int x) { return x * 15; }
+inline int f3097_16(int x) { return x * 16; }
+inline int f3097_17(int x) { return x * 17; }
+inline int f3097_18(int x) { return x * 18; }
+inline int f3097_19(int x) { return x * 19; }
+inline int f3097_20(int x) { return x * 20; }
+inline int f3097_21(int x) { return x * 21; }
+inline int f3097_22(int x) { return x * 22; }
+inline int f3097_23(int x) { return x * 23; }
+inline int f3097_24(int x) { return x * 24; }
+inline int f3097_25(int x) { return x * 25; }
+inline int f3097_26(int x) { return x * 26; }
+inline int f3097_27(int x) { return x * 27; }
+inline int f3097_28(int x) { return x * 28; }
+inline int f3097_29(int x) { return x * 29; }
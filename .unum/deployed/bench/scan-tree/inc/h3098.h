@@ -0,0 +1,42 @@
+#pragma once
+/* header 3098 */
+#include <vector>
+#include "h807.h"
+#include "h9705.h"
+#include "h4107.h"
+#include "h7782.h"
+#include "h4673.h"
+#ifdef X
+#include "h9931.h"
+#endif
+struct S3098 { int a; const char *s = "x//y"; };
+inline int f3098_0(int x) { return x * 0; }
+inline int f3098_1(int x) { return x * 1; }
+inline int f3098_2(int x) { return x * 2; }
+inline int f3098_3(int x) { return x * 3; }
+inline int f3098_4(int x) { return x * 4; }
+inline int f3098_5(int x) { return x * 5; }
+inline int f3098_6(int x) { return x * 6; }
+inline int f3098_7(int x) { return x * 7; }
+inline int f3098_8(int x) { return x * 8; }
+inline int f3098_9(int x) { return x * 9; }
+inline int f3098_10(int x) { return x * 10; }
+inline int f3098_11(int x) { return x * 11; }
+inline int f3098_12(int x) { return x * 12; }
+inline int f3098_13(int x) { return x * 13; }
+inline int f3098_14(int x) { return x * 14; }
+inline int f3098_15(int x) { return x * 15; }
+inline int f3098_16(int x) { return x * 16; }
+inline int f3098_17(int x) { return x * 17; }
+inline int f3098_18(int x) { return x * 18; }
+inline int f3098_19(int x) { return x * 19; }
+inline int f3098_20(int x) { return x * 20; }
+inline int f3098_21(int x) { return x * 21; }
+inline int f3098_22(int x) { return x * 22; }
+inline int f3098_23(int x) { return x * 23; }
+inline int f3098_24(int x) { return x * 24; }
+inline int f3098_25(int x) { return x * 25; }
+inline int f3098_26(int x) { return x * 26; }
+inline int f3098_27(int x) { return x * 27; }
+inline int f3098_28(int x) { return x * 28; }
+inline int f3098_29(int x) { return x * 29; }
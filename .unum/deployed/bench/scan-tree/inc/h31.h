@@ -0,0 +1,42 @@
+#pragma once
+/* header 31 */
+#include <vector>
+#include "h4940.h"
+#include "h7106.h"
+#include "h4330.h"
+#include "h6343.h"
+#include "h7535.h"
+#ifdef X
+#include "h9031.h"
+#endif
+struct S31 { int a; const char *s = "x//y"; };
+inline int f31_0(int x) { return x * 0; }
+inline int f31_1(int x) { return x * 1; }
+inline int f31_2(int x) { return x * 2; }
+inline int f31_3(int x) { return x * 3; }
+inline int f31_4(int x) { return x * 4; }
+inline int f31_5(int x) { return x * 5; }
+inline int f31_6(int x) { return x * 6; }
+inline int f31_7(int x) { return x * 7; }
+inline int f31_8(int x) { return x * 8; }
+inline int f31_9(int x) { return x * 9; }
+inline int f31_10(int x) { return x * 10; }
+inline int f31_11(int x) { return x * 11; }
+inline int f31_12(int x) { return x * 12; }
+inline int f31_13(int x) { return x * 13; }
+inline int f31_14(int x) { return x * 14; }
+inline int f31_15(int x) { return x * 15; }
+inline int f31_16(int x) { return x * 16; }
+inline int f31_17(int x) { return x * 17; }
+inline int f31_18(int x) { return x * 18; }
+inline int f31_19(int x) { return x * 19; }
+inline int f31_20(int x) { return x * 20; }
+inline int f31_21(int x) { return x * 21; }
+inline int f31_22(int x) { return x * 22; }
+inline int f31_23(int x) { return x * 23; }
+inline int f31_24(int x) { return x * 24; }
+inline int f31_25(int x) { return x * 25; }
+inline int f31_26(int x) { return x * 26; }
+inline int f31_27(int x) { return x * 27; }
+inline int f31_28(int x) { return x * 28; }
+inline int f31_29(int x) { return x * 29; }
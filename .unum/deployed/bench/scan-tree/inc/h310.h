@@ -0,0 +1,42 @@
+#pragma once
+/* header 310 */
+#include <vector>
+#include "h9104.h"
+#include "h7061.h"
+#include "h1126.h"
+#include "h9826.h"
+#include "h4351.h"
+#ifdef X
+#include "h8825.h"
+#endif
+struct S310 { int a; const char *s = "x//y"; };
+inline int f310_0(int x) { return x * 0; }
+inline int f310_1(int x) { return x * 1; }
+inline int f310_2(int x) { return x * 2; }
+inline int f310_3(int x) { return x * 3; }
+inline int f310_4(int x) { return x * 4; }
+inline int f310_5(int x) { return x * 5; }
+inline int f310_6(int x) { return x * 6; }
+inline int f310_7(int x) { return x * 7; }
+inline int f310_8(int x) { return x * 8; }
+inline int f310_9(int x) { return x * 9; }
+inline int f310_10(int x) { return x * 10; }
+inline int f310_11(int x) { return x * 11; }
+inline int f310_12(int x) { return x * 12; }
+inline int f310_13(int x) { return x * 13; }
+inline int f310_14(int x) { return x * 14; }
+inline int f310_15(int x) { return x * 15; }
+inline int f310_16(int x) { return x * 16; }
+inline int f310_17(int x) { return x * 17; }
+inline int f310_18(int x) { return x * 18; }
+inline int f310_19(int x) { return x * 19; }
+inline int f310_20(int x) { return x * 20; }
+inline int f310_21(int x) { return x * 21; }
+inline int f310_22(int x) { return x * 22; }
+inline int f310_23(int x) { return x * 23; }
+inline int f310_24(int x) { return x * 24; }
+inline int f310_25(int x) { return x * 25; }
+inline int f310_26(int x) { return x * 26; }
+inline int f310_27(int x) { return x * 27; }
+inline int f310_28(int x) { return x * 28; }
+inline int f310_29(int x) { return x * 29; }
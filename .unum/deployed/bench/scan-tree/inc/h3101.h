@@ -0,0 +1,42 @@
+#pragma once
+/* header 3101 */
+#include <vector>
+#include "h4130.h"
+#include "h1772.h"
+#include "h9856.h"
+#include "h6043.h"
+#include "h9726.h"
+#ifdef X
+#include "h7234.h"
+#endif
+struct S3101 { int a; const char *s = "x//y"; };
+inline int f3101_0(int x) { return x * 0; }
+inline int f3101_1(int x) { return x * 1; }
+inline int f3101_2(int x) { return x * 2; }
+inline int f3101_3(int x) { return x * 3; }
+inline int f3101_4(int x) { return x * 4; }
+inline int f3101_5(int x) { return x * 5; }
+inline int f3101_6(int x) { return x * 6; }
+inline int f3101_7(int x) { return x * 7; }
+inline int f3101_8(int x) { return x * 8; }
+inline int f3101_9(int x) { return x * 9; }
+inline int f3101_10(int x) { return x * 10; }
+inline int f3101_11(int x) { return x * 11; }
+inline int f3101_12(int x) { return x * 12; }
+inline int f3101_13(int x) { return x * 13; }
+inline int f3101_14(int x) { return x * 14; }
+inline int f3101_15(int x) { return x * 15; }
+inline int f3101_16(int x) { return x * 16; }
+inline int f3101_17(int x) { return x * 17; }
+inline int f3101_18(int x) { return x * 18; }
+inline int f3101_19(int x) { return x * 19; }
+inline int f3101_20(int x) { return x * 20; }
+inline int f3101_21(int x) { return x * 21; }
+inline int f3101_22(int x) { return x * 22; }
+inline int f3101_23(int x) { return x * 23; }
+inline int f3101_24(int x) { return x * 24; }
+inline int f3101_25(int x) { return x * 25; }
+inline int f3101_26(int x) { return x * 26; }
+inline int f3101_27(int x) { return x * 27; }
+inline int f3101_28(int x) { return x * 28; }
+inline int f3101_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3102 */
+#include <vector>
+#include "h8553.h"
+#include "h7992.h"
+#include "h7248.h"
+#include "h4612.h"
+#include "h6662.h"
+#ifdef X
+#include "h7128.h"
+#endif
+struct S3102 { int a; const char *s = "x//y"; };
+inline int f3102_0(int x) { return x * 0; }
+inline int f3102_1(int x) { return x * 1; }
+inline int f3102_2(int x) { return x * 2; }
+inline int f3102_3(int x) { return x * 3; }
+inline int f3102_4(int x) { return x * 4; }
+inline int f3102_5(int x) { return x * 5; }
+inline int f3102_6(int x) { return x * 6; }
+inline int f3102_7(int x) { return x * 7; }
+inline int f3102_8(int x) { return x * 8; }
+inline int f3102_9(int x) { return x * 9; }
+inline int f3102_10(int x) { return x * 10; }
+inline int f3102_11(int x) { return x * 11; }
+inline int f3102_12(int x) { return x * 12; }
+inline int f3102_13(int x) { return x * 13; }
+inline int f3102_14(int x) { return x * 14; }
+inline int f3102_15(int x) { return x * 15; }
+inline int f3102_16(int x) { return x * 16; }
+inline int f3102_17(int x) { return x * 17; }
+inline int f3102_18(int x) { return x * 18; }
+inline int f3102_19(int x) { return x * 19; }
+inline int f3102_20(int x) { return x * 20; }
+inline int f3102_21(int x) { return x * 21; }
+inline int f3102_22(int x) { return x * 22; }
+inline int f3102_23(int x) { return x * 23; }
+inline int f3102_24(int x) { return x * 24; }
+inline int f3102_25(int x) { return x * 25; }
+inline int f3102_26(int x) { return x * 26; }
+inline int f3102_27(int x) { return x * 27; }
+inline int f3102_28(int x) { return x * 28; }
+inline int f3102_29(int x) { return x * 29; }
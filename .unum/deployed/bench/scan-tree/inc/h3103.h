@@ -0,0 +1,42 @@
+#pragma once
+/* header 3103 */
+#include <vector>
+#include "h1868.h"
+#include "h1461.h"
+#include "h1316.h"
+#include "h8265.h"
+#include "h932.h"
+#ifdef X
+#include "h3706.h"
+#endif
+struct S3103 { int a; const char *s = "x//y"; };
+inline int f3103_0(int x) { return x * 0; }
+inline int f3103_1(int x) { return x * 1; }
+inline int f3103_2(int x) { return x * 2; }
+inline int f3103_3(int x) { return x * 3; }
+inline int f3103_4(int x) { return x * 4; }
+inline int f3103_5(int x) { return x * 5; }
+inline int f3103_6(int x) { return x * 6; }
+inline int f3103_7(int x) { return x * 7; }
+inline int f3103_8(int x) { return x * 8; }
+inline int f3103_9(int x) { return x * 9; }
+inline int f3103_10(int x) { return x * 10; }
+inline int f3103_11(int x) { return x * 11; }
+inline int f3103_12(int x) { return x * 12; }
+inline int f3103_13(int x) { return x * 13; }
+inline int f3103_14(int x) { return x * 14; }
+inline int f3103_15(int x) { return x * 15; }
+inline int f3103_16(int x) { return x * 16; }
+inline int f3103_17(int x) { return x * 17; }
+inline int f3103_18(int x) { return x * 18; }
+inline int f3103_19(int x) { return x * 19; }
+inline int f3103_20(int x) { return x * 20; }
+inline int f3103_21(int x) { return x * 21; }
+inline int f3103_22(int x) { return x * 22; }
+inline int f3103_23(int x) { return x * 23; }
+inline int f3103_24(int x) { return x * 24; }
+inline int f3103_25(int x) { return x * 25; }
+inline int f3103_26(int x) { return x * 26; }
+inline int f3103_27(int x) { return x * 27; }
+inline int f3103_28(int x) { return x * 28; }
+inline int f3103_29(int x) { return x * 29; }
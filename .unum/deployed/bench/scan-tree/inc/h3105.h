@@ -0,0 +1,42 @@
+#pragma once
+/* header 3105 */
+#include <vector>
+#include "h5834.h"
+#include "h4688.h"
+#include "h1801.h"
+#include "h5834.h"
+#include "h4213.h"
+#ifdef X
+#include "h8401.h"
+#endif
+struct S3105 { int a; const char *s = "x//y"; };
+inline int f3105_0(int x) { return x * 0; }
+inline int f3105_1(int x) { return x * 1; }
+inline int f3105_2(int x) { return x * 2; }
+inline int f3105_3(int x) { return x * 3; }
+inline int f3105_4(int x) { return x * 4; }
+inline int f3105_5(int x) { return x * 5; }
+inline int f3105_6(int x) { return x * 6; }
+inline int f3105_7(int x) { return x * 7; }
+inline int f3105_8(int x) { return x * 8; }
+inline int f3105_9(int x) { return x * 9; }
+inline int f3105_10(int x) { return x * 10; }
+inline int f3105_11(int x) { return x * 11; }
+inline int f3105_12(int x) { return x * 12; }
+inline int f3105_13(int x) { return x * 13; }
+inline int f3105_14(int x) { return x * 14; }
+inline int f3105_15(int x) { return x * 15; }
+inline int f3105_16(int x) { return x * 16; }
+inline int f3105_17(int x) { return x * 17; }
+inline int f3105_18(int x) { return x * 18; }
+inline int f3105_19(int x) { return x * 19; }
+inline int f3105_20(int x) { return x * 20; }
+inline int f3105_21(int x) { return x * 21; }
+inline int f3105_22(int x) { return x * 22; }
+inline int f3105_23(int x) { return x * 23; }
+inline int f3105_24(int x) { return x * 24; }
+inline int f3105_25(int x) { return x * 25; }
+inline int f3105_26(int x) { return x * 26; }
+inline int f3105_27(int x) { return x * 27; }
+inline int f3105_28(int x) { return x * 28; }
+inline int f3105_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3106 */
+#include <vector>
+#include "h6857.h"
+#include "h356.h"
+#include "h5496.h"
+#include "h3730.h"
+#include "h5509.h"
+#ifdef X
+#include "h175.h"
+#endif
+struct S3106 { int a; const char *s = "x//y"; };
+inline int f3106_0(int x) { return x * 0; }
+inline int f3106_1(int x) { return x * 1; }
+inline int f3106_2(int x) { return x * 2; }
+inline int f3106_3(int x) { return x * 3; }
+inline int f3106_4(int x) { return x * 4; }
+inline int f3106_5(int x) { return x * 5; }
+inline int f3106_6(int x) { return x * 6; }
+inline int f3106_7(int x) { return x * 7; }
+inline int f3106_8(int x) { return x * 8; }
+inline int f3106_9(int x) { return x * 9; }
+inline int f3106_10(int x) { return x * 10; }
+inline int f3106_11(int x) { return x * 11; }
+inline int f3106_12(int x) { return x * 12; }
+inline int f3106_13(int x) { return x * 13; }
+inline int f3106_14(int x) { return x * 14; }
+inline int f3106_15(int x) { return x * 15; }
+inline int f3106_16(int x) { return x * 16; }
+inline int f3106_17(int x) { return x * 17; }
+inline int f3106_18(int x) { return x * 18; }
+inline int f3106_19(int x) { return x * 19; }
+inline int f3106_20(int x) { return x * 20; }
+inline int f3106_21(int x) { return x * 21; }
+inline int f3106_22(int x) { return x * 22; }
+inline int f3106_23(int x) { return x * 23; }
+inline int f3106_24(int x) { return x * 24; }
+inline int f3106_25(int x) { return x * 25; }
+inline int f3106_26(int x) { return x * 26; }
+inline int f3106_27(int x) { return x * 27; }
+inline int f3106_28(int x) { return x * 28; }
+inline int f3106_29(int x) { return x * 29; }
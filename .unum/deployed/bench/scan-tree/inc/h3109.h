@@ -0,0 +1,42 @@
+#pragma once
+/* header 3109 */
+#include <vector>
+#include "h7921.h"
+#include "h6688.h"
+#include "h8995.h"
+#include "h4329.h"
+#include "h474.h"
+#ifdef X
+#include "h9553.h"
+#endif
+struct S3109 { int a; const char *s = "x//y"; };
+inline int f3109_0(int x) { return x * 0; }
+inline int f3109_1(int x) { return x * 1; }
+inline int f3109_2(int x) { return x * 2; }
+inline int f3109_3(int x) { return x * 3; }
+inline int f3109_4(int x) { return x * 4; }
+inline int f3109_5(int x) { return x * 5; }
+inline int f3109_6(int x) { return x * 6; }
+inline int f3109_7(int x) { return x * 7; }
+inline int f3109_8(int x) { return x * 8; }
+inline int f3109_9(int x) { return x * 9; }
+inline int f3109_10(int x) { return x * 10; }
+inline int f3109_11(int x) { return x * 11; }
+inline int f3109_12(int x) { return x * 12; }
+inline int f3109_13(int x) { return x * 13; }
+inline int f3109_14(int x) { return x * 14; }
+inline int f3109_15(int x) { return x * 15; }
+inline int f3109_16(int x) { return x * 16; }
+inline int f3109_17(int x) { return x * 17; }
+inline int f3109_18(int x) { return x * 18; }
+inline int f3109_19(int x) { return x * 19; }
+inline int f3109_20(int x) { return x * 20; }
+inline int f3109_21(int x) { return x * 21; }
+inline int f3109_22(int x) { return x * 22; }
+inline int f3109_23(int x) { return x * 23; }
+inline int f3109_24(int x) { return x * 24; }
+inline int f3109_25(int x) { return x * 25; }
+inline int f3109_26(int x) { return x * 26; }
+inline int f3109_27(int x) { return x * 27; }
+inline int f3109_28(int x) { return x * 28; }
+inline int f3109_29(int x) { return x * 29; }
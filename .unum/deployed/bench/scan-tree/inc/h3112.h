@@ -0,0 +1,42 @@
+#pragma once
+/* header 3112 */
+#include <vector>
+#include "h7730.h"
+#include "h1304.h"
+#include "h5597.h"
+#include "h7770.h"
+#include "h8028.h"
+#ifdef X
+#include "h6436.h"
+#endif
+struct S3112 { int a; const char *s = "x//y"; };
+inline int f3112_0(int x) { return x * 0; }
+inline int f3112_1(int x) { return x * 1; }
+inline int f3112_2(int x) { return x * 2; }
+inline int f3112_3(int x) { return x * 3; }
+inline int f3112_4(int x) { return x * 4; }
+inline int f3112_5(int x) { return x * 5; }
+inline int f3112_6(int x) { return x * 6; }
+inline int f3112_7(int x) { return x * 7; }
+inline int f3112_8(int x) { return x * 8; }
+inline int f3112_9(int x) { return x * 9; }
+inline int f3112_10(int x) { return x * 10; }
+inline int f3112_11(int x) { return x * 11; }
+inline int f3112_12(int x) { return x * 12; }
+inline int f3112_13(int x) { return x * 13; }
+inline int f3112_14(int x) { return x * 14; }
+inline int f3112_15(int x) { return x * 15; }
+inline int f3112_16(int x) { return x * 16; }
+inline int f3112_17(int x) { return x * 17; }
+inline int f3112_18(int x) { return x * 18; }
+inline int f3112_19(int x) { return x * 19; }
+inline int f3112_20(int x) { return x * 20; }
+inline int f3112_21(int x) { return x * 21; }
+inline int f3112_22(int x) { return x * 22; }
+inline int f3112_23(int x) { return x * 23; }
+inline int f3112_24(int x) { return x * 24; }
+inline int f3112_25(int x) { return x * 25; }
+inline int f3112_26(int x) { return x * 26; }
+inline int f3112_27(int x) { return x * 27; }
+inline int f3112_28(int x) { return x * 28; }
+inline int f3112_29(int x) { return x * 29; }
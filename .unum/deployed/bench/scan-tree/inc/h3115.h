@@ -0,0 +1,42 @@
+#pragma once
+/* header 3115 */
+#include <vector>
+#include "h8003.h"
+#include "h5812.h"
+#include "h6101.h"
+#include "h9047.h"
+#include "h4336.h"
+#ifdef X
+#include "h7450.h"
+#endif
+struct S3115 { int a; const char *s = "x//y"; };
+inline int f3115_0(int x) { return x * 0; }
+inline int f3115_1(int x) { return x * 1; }
+inline int f3115_2(int x) { return x * 2; }
+inline int f3115_3(int x) { return x * 3; }
+inline int f3115_4(int x) { return x * 4; }
+inline int f3115_5(int x) { return x * 5; }
+inline int f3115_6(int x) { return x * 6; }
+inline int f3115_7(int x) { return x * 7; }
+inline int f3115_8(int x) { return x * 8; }
+inline int f3115_9(int x) { return x * 9; }
+inline int f3115_10(int x) { return x * 10; }
+inline int f3115_11(int x) { return x * 11; }
+inline int f3115_12(int x) { return x * 12; }
+inline int f3115_13(int x) { return x * 13; }
+inline int f3115_14(int x) { return x * 14; }
+inline int f3115_15(int x) { return x * 15; }
+inline int f3115_16(int x) { return x * 16; }
+inline int f3115_17(int x) { return x * 17; }
+inline int f3115_18(int x) { return x * 18; }
+inline int f3115_19(int x) { return x * 19; }
+inline int f3115_20(int x) { return x * 20; }
+inline int f3115_21(int x) { return x * 21; }
+inline int f3115_22(int x) { return x * 22; }
+inline int f3115_23(int x) { return x * 23; }
+inline int f3115_24(int x) { return x * 24; }
+inline int f3115_25(int x) { return x * 25; }
+inline int f3115_26(int x) { return x * 26; }
+inline int f3115_27(int x) { return x * 27; }
+inline int f3115_28(int x) { return x * 28; }
+inline int f3115_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3116 */
+#include <vector>
+#include "h4489.h"
+#include "h8971.h"
+#include "h406.h"
+#include "h9654.h"
+#include "h2806.h"
+#ifdef X
+#include "h2392.h"
+#endif
+struct S3116 { int a; const char *s = "x//y"; };
+inline int f3116_0(int x) { return x * 0; }
+inline int f3116_1(int x) { return x * 1; }
+inline int f3116_2(int x) { return x * 2; }
+inline int f3116_3(int x) { return x * 3; }
+inline int f3116_4(int x) { return x * 4; }
+inline int f3116_5(int x) { return x * 5; }
+inline int f3116_6(int x) { return x * 6; }
+inline int f3116_7(int x) { return x * 7; }
+inline int f3116_8(int x) { return x * 8; }
+inline int f3116_9(int x) { return x * 9; }
+inline int f3116_10(int x) { return x * 10; }
+inline int f3116_11(int x) { return x * 11; }
+inline int f3116_12(int x) { return x * 12; }
+inline int f3116_13(int x) { return x * 13; }
+inline int f3116_14(int x) { return x * 14; }
+inline int f3116_15(int x) { return x * 15; }
+inline int f3116_16(int x) { return x * 16; }
+inline int f3116_17(int x) { return x * 17; }
+inline int f3116_18(int x) { return x * 18; }
+inline int f3116_19(int x) { return x * 19; }
+inline int f3116_20(int x) { return x * 20; }
+inline int f3116_21(int x) { return x * 21; }
+inline int f3116_22(int x) { return x * 22; }
+inline int f3116_23(int x) { return x * 23; }
+inline int f3116_24(int x) { return x * 24; }
+inline int f3116_25(int x) { return x * 25; }
+inline int f3116_26(int x) { return x * 26; }
+inline int f3116_27(int x) { return x * 27; }
+inline int f3116_28(int x) { return x * 28; }
+inline int f3116_29(int x) { return x * 29; }
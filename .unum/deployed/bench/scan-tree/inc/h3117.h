@@ -0,0 +1,42 @@
+#pragma once
+/* header 3117 */
+#include <vector>
+#include "h7519.h"
+#include "h6399.h"
+#include "h540.h"
+#include "h5108.h"
+#include "h8690.h"
+#ifdef X
+#include "h2142.h"
+#endif
+struct S3117 { int a; const char *s = "x//y"; };
+inline int f3117_0(int x) { return x * 0; }
+inline int f3117_1(int x) { return x * 1; }
+inline int f3117_2(int x) { return x * 2; }
+inline int f3117_3(int x) { return x * 3; }
+inline int f3117_4(int x) { return x * 4; }
+inline int f3117_5(int x) { return x * 5; }
+inline int f3117_6(int x) { return x * 6; }
+inline int f3117_7(int x) { return x * 7; }
+inline int f3117_8(int x) { return x * 8; }
+inline int f3117_9(int x) { return x * 9; }
+inline int f3117_10(int x) { return x * 10; }
+inline int f3117_11(int x) { return x * 11; }
+inline int f3117_12(int x) { return x * 12; }
+inline int f3117_13(int x) { return x * 13; }
+inline int f3117_14(int x) { return x * 14; }
+inline int f3117_15(int x) { return x * 15; }
+inline int f3117_16(int x) { return x * 16; }
+inline int f3117_17(int x) { return x * 17; }
+inline int f3117_18(int x) { return x * 18; }
+inline int f3117_19(int x) { return x * 19; }
+inline int f3117_20(int x) { return x * 20; }
+inline int f3117_21(int x) { return x * 21; }
+inline int f3117_22(int x) { return x * 22; }
+inline int f3117_23(int x) { return x * 23; }
+inline int f3117_24(int x) { return x * 24; }
+inline int f3117_25(int x) { return x * 25; }
+inline int f3117_26(int x) { return x * 26; }
+inline int f3117_27(int x) { return x * 27; }
+inline int f3117_28(int x) { return x * 28; }
+inline int f3117_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3123 */
+#include <vector>
+#include "h5709.h"
+#include "h3731.h"
+#include "h1262.h"
+#include "h7099.h"
+#include "h4855.h"
+#ifdef X
+#include "h5493.h"
+#endif
+struct S3123 { int a; const char *s = "x//y"; };
+inline int f3123_0(int x) { return x * 0; }
+inline int f3123_1(int x) { return x * 1; }
+inline int f3123_2(int x) { return x * 2; }
+inline int f3123_3(int x) { return x * 3; }
+inline int f3123_4(int x) { return x * 4; }
+inline int f3123_5(int x) { return x * 5; }
+inline int f3123_6(int x) { return x * 6; }
+inline int f3123_7(int x) { return x * 7; }
+inline int f3123_8(int x) { return x * 8; }
+inline int f3123_9(int x) { return x * 9; }
+inline int f3123_10(int x) { return x * 10; }
+inline int f3123_11(int x) { return x * 11; }
+inline int f3123_12(int x) { return x * 12; }
+inline int f3123_13(int x) { return x * 13; }
+inline int f3123_14(int x) { return x * 14; }
+inline int f3123_15(int x) { return x * 15; }
+inline int f3123_16(int x) { return x * 16; }
+inline int f3123_17(int x) { return x * 17; }
+inline int f3123_18(int x) { return x * 18; }
+inline int f3123_19(int x) { return x * 19; }
+inline int f3123_20(int x) { return x * 20; }
+inline int f3123_21(int x) { return x * 21; }
+inline int f3123_22(int x) { return x * 22; }
+inline int f3123_23(int x) { return x * 23; }
+inline int f3123_24(int x) { return x * 24; }
+inline int f3123_25(int x) { return x * 25; }
+inline int f3123_26(int x) { return x * 26; }
+inline int f3123_27(int x) { return x * 27; }
+inline int f3123_28(int x) { return x * 28; }
+inline int f3123_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3124 */
+#include <vector>
+#include "h8776.h"
+#include "h8381.h"
+#include "h7423.h"
+#include "h6103.h"
+#include "h6183.h"
+#ifdef X
+#include "h5072.h"
+#endif
+struct S3124 { int a; const char *s = "x//y"; };
+inline int f3124_0(int x) { return x * 0; }
+inline int f3124_1(int x) { return x * 1; }
+inline int f3124_2(int x) { return x * 2; }
+inline int f3124_3(int x) { return x * 3; }
+inline int f3124_4(int x) { return x * 4; }
+inline int f3124_5(int x) { return x * 5; }
+inline int f3124_6(int x) { return x * 6; }
+inline int f3124_7(int x) { return x * 7; }
+inline int f3124_8(int x) { return x * 8; }
+inline int f3124_9(int x) { return x * 9; }
+inline int f3124_10(int x) { return x * 10; }
+inline int f3124_11(int x) { return x * 11; }
+inline int f3124_12(int x) { return x * 12; }
+inline int f3124_13(int x) { return x * 13; }
+inline int f3124_14(int x) { return x * 14; }
+inline int f3124_15(int x) { return x * 15; }
+inline int f3124_16(int x) { return x * 16; }
+inline int f3124_17(int x) { return x * 17; }
+inline int f3124_18(int x) { return x * 18; }
+inline int f3124_19(int x) { return x * 19; }
+inline int f3124_20(int x) { return x * 20; }
+inline int f3124_21(int x) { return x * 21; }
+inline int f3124_22(int x) { return x * 22; }
+inline int f3124_23(int x) { return x * 23; }
+inline int f3124_24(int x) { return x * 24; }
+inline int f3124_25(int x) { return x * 25; }
+inline int f3124_26(int x) { return x * 26; }
+inline int f3124_27(int x) { return x * 27; }
+inline int f3124_28(int x) { return x * 28; }
+inline int f3124_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3126 */
+#include <vector>
+#include "h7431.h"
+#include "h8894.h"
+#include "h9746.h"
+#include "h2809.h"
+#include "h3249.h"
+#ifdef X
+#include "h4336.h"
+#endif
+struct S3126 { int a; const char *s = "x//y"; };
+inline int f3126_0(int x) { return x * 0; }
+inline int f3126_1(int x) { return x * 1; }
+inline int f3126_2(int x) { return x * 2; }
+inline int f3126_3(int x) { return x * 3; }
+inline int f3126_4(int x) { return x * 4; }
+inline int f3126_5(int x) { return x * 5; }
+inline int f3126_6(int x) { return x * 6; }
+inline int f3126_7(int x) { return x * 7; }
+inline int f3126_8(int x) { return x * 8; }
+inline int f3126_9(int x) { return x * 9; }
+inline int f3126_10(int x) { return x * 10; }
+inline int f3126_11(int x) { return x * 11; }
+inline int f3126_12(int x) { return x * 12; }
+inline int f3126_13(int x) { return x * 13; }
+inline int f3126_14(int x) { return x * 14; }
+inline int f3126_15(int x) { return x * 15; }
+inline int f3126_16(int x) { return x * 16; }
+inline int f3126_17(int x) { return x * 17; }
+inline int f3126_18(int x) { return x * 18; }
+inline int f3126_19(int x) { return x * 19; }
+inline int f3126_20(int x) { return x * 20; }
+inline int f3126_21(int x) { return x * 21; }
+inline int f3126_22(int x) { return x * 22; }
+inline int f3126_23(int x) { return x * 23; }
+inline int f3126_24(int x) { return x * 24; }
+inline int f3126_25(int x) { return x * 25; }
+inline int f3126_26(int x) { return x * 26; }
+inline int f3126_27(int x) { return x * 27; }
+inline int f3126_28(int x) { return x * 28; }
+inline int f3126_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3127 */
+#include <vector>
+#include "h3300.h"
+#include "h9538.h"
+#include "h4251.h"
+#include "h1615.h"
+#include "h6153.h"
+#ifdef X
+#include "h7515.h"
+#endif
+struct S3127 { int a; const char *s = "x//y"; };
+inline int f3127_0(int x) { return x * 0; }
+inline int f3127_1(int x) { return x * 1; }
+inline int f3127_2(int x) { return x * 2; }
+inline int f3127_3(int x) { return x * 3; }
+inline int f3127_4(int x) { return x * 4; }
+inline int f3127_5(int x) { return x * 5; }
+inline int f3127_6(int x) { return x * 6; }
+inline int f3127_7(int x) { return x * 7; }
+inline int f3127_8(int x) { return x * 8; }
+inline int f3127_9(int x) { return x * 9; }
+inline int f3127_10(int x) { return x * 10; }
+inline int f3127_11(int x) { return x * 11; }
+inline int f3127_12(int x) { return x * 12; }
+inline int f3127_13(int x) { return x * 13; }
+inline int f3127_14(int x) { return x * 14; }
+inline int f3127_15(int x) { return x * 15; }
+inline int f3127_16(int x) { return x * 16; }
+inline int f3127_17(int x) { return x * 17; }
+inline int f3127_18(int x) { return x * 18; }
+inline int f3127_19(int x) { return x * 19; }
+inline int f3127_20(int x) { return x * 20; }
+inline int f3127_21(int x) { return x * 21; }
+inline int f3127_22(int x) { return x * 22; }
+inline int f3127_23(int x) { return x * 23; }
+inline int f3127_24(int x) { return x * 24; }
+inline int f3127_25(int x) { return x * 25; }
+inline int f3127_26(int x) { return x * 26; }
+inline int f3127_27(int x) { return x * 27; }
+inline int f3127_28(int x) { return x * 28; }
+inline int f3127_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3128 */
+#include <vector>
+#include "h3163.h"
+#include "h5157.h"
+#include "h5686.h"
+#include "h2446.h"
+#include "h7090.h"
+#ifdef X
+#include "h2047.h"
+#endif
+struct S3128 { int a; const char *s = "x//y"; };
+inline int f3128_0(int x) { return x * 0; }
+inline int f3128_1(int x) { return x * 1; }
+inline int f3128_2(int x) { return x * 2; }
+inline int f3128_3(int x) { return x * 3; }
+inline int f3128_4(int x) { return x * 4; }
+inline int f3128_5(int x) { return x * 5; }
+inline int f3128_6(int x) { return x * 6; }
+inline int f3128_7(int x) { return x * 7; }
+inline int f3128_8(int x) { return x * 8; }
+inline int f3128_9(int x) { return x * 9; }
+inline int f3128_10(int x) { return x * 10; }
+inline int f3128_11(int x) { return x * 11; }
+inline int f3128_12(int x) { return x * 12; }
+inline int f3128_13(int x) { return x * 13; }
+inline int f3128_14(int x) { return x * 14; }
+inline int f3128_15(int x) { return x * 15; }
+inline int f3128_16(int x) { return x * 16; }
+inline int f3128_17(int x) { return x * 17; }
+inline int f3128_18(int x) { return x * 18; }
+inline int f3128_19(int x) { return x * 19; }
+inline int f3128_20(int x) { return x * 20; }
+inline int f3128_21(int x) { return x * 21; }
+inline int f3128_22(int x) { return x * 22; }
+inline int f3128_23(int x) { return x * 23; }
+inline int f3128_24(int x) { return x * 24; }
+inline int f3128_25(int x) { return x * 25; }
+inline int f3128_26(int x) { return x * 26; }
+inline int f3128_27(int x) { return x * 27; }
+inline int f3128_28(int x) { return x * 28; }
+inline int f3128_29(int x) { return x * 29; }
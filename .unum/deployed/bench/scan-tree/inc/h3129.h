@@ -0,0 +1,42 @@
+#pragma once
+/* header 3129 */
+#include <vector>
+#include "h647.h"
+#include "h3433.h"
+#include "h9523.h"
+#include "h7437.h"
+#include "h1310.h"
+#ifdef X
+#include "h6744.h"
+#endif
+struct S3129 { int a; const char *s = "x//y"; };
+inline int f3129_0(int x) { return x * 0; }
+inline int f3129_1(int x) { return x * 1; }
+inline int f3129_2(int x) { return x * 2; }
+inline int f3129_3(int x) { return x * 3; }
+inline int f3129_4(int x) { return x * 4; }
+inline int f3129_5(int x) { return x * 5; }
+inline int f3129_6(int x) { return x * 6; }
+inline int f3129_7(int x) { return x * 7; }
+inline int f3129_8(int x) { return x * 8; }
+inline int f3129_9(int x) { return x * 9; }
+inline int f3129_10(int x) { return x * 10; }
+inline int f3129_11(int x) { return x * 11; }
+inline int f3129_12(int x) { return x * 12; }
+inline int f3129_13(int x) { return x * 13; }
+inline int f3129_14(int x) { return x * 14; }
+inline int f3129_15(int x) { return x * 15; }
+inline int f3129_16(int x) { return x * 16; }
+inline int f3129_17(int x) { return x * 17; }
+inline int f3129_18(int x) { return x * 18; }
+inline int f3129_19(int x) { return x * 19; }
+inline int f3129_20(int x) { return x * 20; }
+inline int f3129_21(int x) { return x * 21; }
+inline int f3129_22(int x) { return x * 22; }
+inline int f3129_23(int x) { return x * 23; }
+inline int f3129_24(int x) { return x * 24; }
+inline int f3129_25(int x) { return x * 25; }
+inline int f3129_26(int x) { return x * 26; }
+inline int f3129_27(int x) { return x * 27; }
+inline int f3129_28(int x) { return x * 28; }
+inline int f3129_29(int x) { return x * 29; }
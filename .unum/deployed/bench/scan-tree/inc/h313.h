@@ -0,0 +1,42 @@
+#pragma once
+/* header 313 */
+#include <vector>
+#include "h6643.h"
+#include "h9156.h"
+#include "h1247.h"
+#include "h3509.h"
+#include "h4571.h"
+#ifdef X
+#include "h1688.h"
+#endif
+struct S313 { int a; const char *s = "x//y"; };
+inline int f313_0(int x) { return x * 0; }
+inline int f313_1(int x) { return x * 1; }
+inline int f313_2(int x) { return x * 2; }
+inline int f313_3(int x) { return x * 3; }
+inline int f313_4(int x) { return x * 4; }
+inline int f313_5(int x) { return x * 5; }
+inline int f313_6(int x) { return x * 6; }
+inline int f313_7(int x) { return x * 7; }
+inline int f313_8(int x) { return x * 8; }
+inline int f313_9(int x) { return x * 9; }
+inline int f313_10(int x) { return x * 10; }
+inline int f313_11(int x) { return x * 11; }
+inline int f313_12(int x) { return x * 12; }
+inline int f313_13(int x) { return x * 13; }
+inline int f313_14(int x) { return x * 14; }
+inline int f313_15(int x) { return x * 15; }
+inline int f313_16(int x) { return x * 16; }
+inline int f313_17(int x) { return x * 17; }
+inline int f313_18(int x) { return x * 18; }
+inline int f313_19(int x) { return x * 19; }
+inline int f313_20(int x) { return x * 20; }
+inline int f313_21(int x) { return x * 21; }
+inline int f313_22(int x) { return x * 22; }
+inline int f313_23(int x) { return x * 23; }
+inline int f313_24(int x) { return x * 24; }
+inline int f313_25(int x) { return x * 25; }
+inline int f313_26(int x) { return x * 26; }
+inline int f313_27(int x) { return x * 27; }
+inline int f313_28(int x) { return x * 28; }
+inline int f313_29(int x) { return x * 29; }
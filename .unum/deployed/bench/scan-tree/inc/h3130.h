@@ -0,0 +1,42 @@
+#pragma once
+/* header 3130 */
+#include <vector>
+#include "h2389.h"
+#include "h7129.h"
+#include "h8886.h"
+#include "h5224.h"
+#include "h4680.h"
+#ifdef X
+#include "h8104.h"
+#endif
+struct S3130 { int a; const char *s = "x//y"; };
+inline int f3130_0(int x) { return x * 0; }
+inline int f3130_1(int x) { return x * 1; }
+inline int f3130_2(int x) { return x * 2; }
+inline int f3130_3(int x) { return x * 3; }
+inline int f3130_4(int x) { return x * 4; }
+inline int f3130_5(int x) { return x * 5; }
+inline int f3130_6(int x) { return x * 6; }
+inline int f3130_7(int x) { return x * 7; }
+inline int f3130_8(int x) { return x * 8; }
+inline int f3130_9(int x) { return x * 9; }
+inline int f3130_10(int x) { return x * 10; }
+inline int f3130_11(int x) { return x * 11; }
+inline int f3130_12(int x) { return x * 12; }
+inline int f3130_13(int x) { return x * 13; }
+inline int f3130_14(int x) { return x * 14; }
+inline int f3130_15(int x) { return x * 15; }
+inline int f3130_16(int x) { return x * 16; }
+inline int f3130_17(int x) { return x * 17; }
+inline int f3130_18(int x) { return x * 18; }
+inline int f3130_19(int x) { return x * 19; }
+inline int f3130_20(int x) { return x * 20; }
+inline int f3130_21(int x) { return x * 21; }
+inline int f3130_22(int x) { return x * 22; }
+inline int f3130_23(int x) { return x * 23; }
+inline int f3130_24(int x) { return x * 24; }
+inline int f3130_25(int x) { return x * 25; }
+inline int f3130_26(int x) { return x * 26; }
+inline int f3130_27(int x) { return x * 27; }
+inline int f3130_28(int x) { return x * 28; }
+inline int f3130_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3131 */
+#include <vector>
+#include "h7133.h"
+#include "h9184.h"
+#include "h1638.h"
+#include "h346.h"
+#include "h7189.h"
+#ifdef X
+#include "h1863.h"
+#endif
+struct S3131 { int a; const char *s = "x//y"; };
+inline int f3131_0(int x) { return x * 0; }
+inline int f3131_1(int x) { return x * 1; }
+inline int f3131_2(int x) { return x * 2; }
+inline int f3131_3(int x) { return x * 3; }
+inline int f3131_4(int x) { return x * 4; }
+inline int f3131_5(int x) { return x * 5; }
+inline int f3131_6(int x) { return x * 6; }
+inline int f3131_7(int x) { return x * 7; }
+inline int f3131_8(int x) { return x * 8; }
+inline int f3131_9(int x) { return x * 9; }
+inline int f3131_10(int x) { return x * 10; }
+inline int f3131_11(int x) { return x * 11; }
+inline int f3131_12(int x) { return x * 12; }
+inline int f3131_13(int x) { return x * 13; }
+inline int f3131_14(int x) { return x * 14; }
+inline int f3131_15(int x) { return x * 15; }
+inline int f3131_16(int x) { return x * 16; }
+inline int f3131_17(int x) { return x * 17; }
+inline int f3131_18(int x) { return x * 18; }
+inline int f3131_19(int x) { return x * 19; }
+inline int f3131_20(int x) { return x * 20; }
+inline int f3131_21(int x) { return x * 21; }
+inline int f3131_22(int x) { return x * 22; }
+inline int f3131_23(int x) { return x * 23; }
+inline int f3131_24(int x) { return x * 24; }
+inline int f3131_25(int x) { return x * 25; }
+inline int f3131_26(int x) { return x * 26; }
+inline int f3131_27(int x) { return x * 27; }
+inline int f3131_28(int x) { return x * 28; }
+inline int f3131_29(int x) { return x * 29; }
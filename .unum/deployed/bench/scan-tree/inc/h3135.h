@@ -0,0 +1,42 @@
+#pragma once
+/* header 3135 */
+#include <vector>
+#include "h8451.h"
+#include "h9064.h"
+#include "h3110.h"
+#include "h2201.h"
+#include "h3216.h"
+#ifdef X
+#include "h7012.h"
+#endif
+struct S3135 { int a; const char *s = "x//y"; };
+inline int f3135_0(int x) { return x * 0; }
+inline int f3135_1(int x) { return x * 1; }
+inline int f3135_2(int x) { return x * 2; }
+inline int f3135_3(int x) { return x * 3; }
+inline int f3135_4(int x) { return x * 4; }
+inline int f3135_5(int x) { return x * 5; }
+inline int f3135_6(int x) { return x * 6; }
+inline int f3135_7(int x) { return x * 7; }
+inline int f3135_8(int x) { return x * 8; }
+inline int f3135_9(int x) { return x * 9; }
+inline int f3135_10(int x) { return x * 10; }
+inline int f3135_11(int x) { return x * 11; }
+inline int f3135_12(int x) { return x * 12; }
+inline int f3135_13(int x) { return x * 13; }
+inline int f3135_14(int x) { return x * 14; }
+inline int f3135_15(int x) { return x * 15; }
+inline int f3135_16(int x) { return x * 16; }
+inline int f3135_17(int x) { return x * 17; }
+inline int f3135_18(int x) { return x * 18; }
+inline int f3135_19(int x) { return x * 19; }
+inline int f3135_20(int x) { return x * 20; }
+inline int f3135_21(int x) { return x * 21; }
+inline int f3135_22(int x) { return x * 22; }
+inline int f3135_23(int x) { return x * 23; }
+inline int f3135_24(int x) { return x * 24; }
+inline int f3135_25(int x) { return x * 25; }
+inline int f3135_26(int x) { return x * 26; }
+inline int f3135_27(int x) { return x * 27; }
+inline int f3135_28(int x) { return x * 28; }
+inline int f3135_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3137 */
+#include <vector>
+#include "h88.h"
+#include "h5589.h"
+#include "h841.h"
+#include "h8912.h"
+#include "h5545.h"
+#ifdef X
+#include "h7510.h"
+#endif
+struct S3137 { int a; const char *s = "x//y"; };
+inline int f3137_0(int x) { return x * 0; }
+inline int f3137_1(int x) { return x * 1; }
+inline int f3137_2(int x) { return x * 2; }
+inline int f3137_3(int x) { return x * 3; }
+inline int f3137_4(int x) { return x * 4; }
+inline int f3137_5(int x) { return x * 5; }
+inline int f3137_6(int x) { return x * 6; }
+inline int f3137_7(int x) { return x * 7; }
+inline int f3137_8(int x) { return x * 8; }
+inline int f3137_9(int x) { return x * 9; }
+inline int f3137_10(int x) { return x * 10; }
+inline int f3137_11(int x) { return x * 11; }
+inline int f3137_12(int x) { return x * 12; }
+inline int f3137_13(int x) { return x * 13; }
+inline int f3137_14(int x) { return x * 14; }
+inline int f3137_15(int x) { return x * 15; }
+inline int f3137_16(int x) { return x * 16; }
+inline int f3137_17(int x) { return x * 17; }
+inline int f3137_18(int x) { return x * 18; }
+inline int f3137_19(int x) { return x * 19; }
+inline int f3137_20(int x) { return x * 20; }
+inline int f3137_21(int x) { return x * 21; }
+inline int f3137_22(int x) { return x * 22; }
+inline int f3137_23(int x) { return x * 23; }
+inline int f3137_24(int x) { return x * 24; }
+inline int f3137_25(int x) { return x * 25; }
+inline int f3137_26(int x) { return x * 26; }
+inline int f3137_27(int x) { return x * 27; }
+inline int f3137_28(int x) { return x * 28; }
+inline int f3137_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3139 */
+#include <vector>
+#include "h1134.h"
+#include "h3986.h"
+#include "h7142.h"
+#include "h2402.h"
+#include "h4592.h"
+#ifdef X
+#include "h9406.h"
+#endif
+struct S3139 { int a; const char *s = "x//y"; };
+inline int f3139_0(int x) { return x * 0; }
+inline int f3139_1(int x) { return x * 1; }
+inline int f3139_2(int x) { return x * 2; }
+inline int f3139_3(int x) { return x * 3; }
+inline int f3139_4(int x) { return x * 4; }
+inline int f3139_5(int x) { return x * 5; }
+inline int f3139_6(int x) { return x * 6; }
+inline int f3139_7(int x) { return x * 7; }
+inline int f3139_8(int x) { return x * 8; }
+inline int f3139_9(int x) { return x * 9; }
+inline int f3139_10(int x) { return x * 10; }
+inline int f3139_11(int x) { return x * 11; }
+inline int f3139_12(int x) { return x * 12; }
+inline int f3139_13(int x) { return x * 13; }
+inline int f3139_14(int x) { return x * 14; }
+inline int f3139_15(int x) { return x * 15; }
+inline int f3139_16(int x) { return x * 16; }
+inline int f3139_17(int x) { return x * 17; }
+inline int f3139_18(int x) { return x * 18; }
+inline int f3139_19(int x) { return x * 19; }
+inline int f3139_20(int x) { return x * 20; }
+inline int f3139_21(int x) { return x * 21; }
+inline int f3139_22(int x) { return x * 22; }
+inline int f3139_23(int x) { return x * 23; }
+inline int f3139_24(int x) { return x * 24; }
+inline int f3139_25(int x) { return x * 25; }
+inline int f3139_26(int x) { return x * 26; }
+inline int f3139_27(int x) { return x * 27; }
+inline int f3139_28(int x) { return x * 28; }
+inline int f3139_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3140 */
+#include <vector>
+#include "h2882.h"
+#include "h7951.h"
+#include "h4677.h"
+#include "h7883.h"
+#include "h1317.h"
+#ifdef X
+#include "h1860.h"
+#endif
+struct S3140 { int a; const char *s = "x//y"; };
+inline int f3140_0(int x) { return x * 0; }
+inline int f3140_1(int x) { return x * 1; }
+inline int f3140_2(int x) { return x * 2; }
+inline int f3140_3(int x) { return x * 3; }
+inline int f3140_4(int x) { return x * 4; }
+inline int f3140_5(int x) { return x * 5; }
+inline int f3140_6(int x) { return x * 6; }
+inline int f3140_7(int x) { return x * 7; }
+inline int f3140_8(int x) { return x * 8; }
+inline int f3140_9(int x) { return x * 9; }
+inline int f3140_10(int x) { return x * 10; }
+inline int f3140_11(int x) { return x * 11; }
+inline int f3140_12(int x) { return x * 12; }
+inline int f3140_13(int x) { return x * 13; }
+inline int f3140_14(int x) { return x * 14; }
+inline int f3140_15(int x) { return x * 15; }
+inline int f3140_16(int x) { return x * 16; }
+inline int f3140_17(int x) { return x * 17; }
+inline int f3140_18(int x) { return x * 18; }
+inline int f3140_19(int x) { return x * 19; }
+inline int f3140_20(int x) { return x * 20; }
+inline int f3140_21(int x) { return x * 21; }
+inline int f3140_22(int x) { return x * 22; }
+inline int f3140_23(int x) { return x * 23; }
+inline int f3140_24(int x) { return x * 24; }
+inline int f3140_25(int x) { return x * 25; }
+inline int f3140_26(int x) { return x * 26; }
+inline int f3140_27(int x) { return x * 27; }
+inline int f3140_28(int x) { return x * 28; }
+inline int f3140_29(int x) { return x * 29; }
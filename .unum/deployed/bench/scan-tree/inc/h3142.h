@@ -0,0 +1,42 @@
+#pragma once
+/* header 3142 */
+#include <vector>
+#include "h625.h"
+#include "h8525.h"
+#include "h1155.h"
+#include "h7367.h"
+#include "h6378.h"
+#ifdef X
+#include "h6290.h"
+#endif
+struct S3142 { int a; const char *s = "x//y"; };
+inline int f3142_0(int x) { return x * 0; }
+inline int f3142_1(int x) { return x * 1; }
+inline int f3142_2(int x) { return x * 2; }
+inline int f3142_3(int x) { return x * 3; }
+inline int f3142_4(int x) { return x * 4; }
+inline int f3142_5(int x) { return x * 5; }
+inline int f3142_6(int x) { return x * 6; }
+inline int f3142_7(int x) { return x * 7; }
+inline int f3142_8(int x) { return x * 8; }
+inline int f3142_9(int x) { return x * 9; }
+inline int f3142_10(int x) { return x * 10; }
+inline int f3142_11(int x) { return x * 11; }
+inline int f3142_12(int x) { return x * 12; }
+inline int f3142_13(int x) { return x * 13; }
+inline int f3142_14(int x) { return x * 14; }
+inline int f3142_15(int x) { return x * 15; }
+inline int f3142_16(int x) { return x * 16; }
+inline int f3142_17(int x) { return x * 17; }
+inline int f3142_18(int x) { return x * 18; }
+inline int f3142_19(int x) { return x * 19; }
+inline int f3142_20(int x) { return x * 20; }
+inline int f3142_21(int x) { return x * 21; }
+inline int f3142_22(int x) { return x * 22; }
+inline int f3142_23(int x) { return x * 23; }
+inline int f3142_24(int x) { return x * 24; }
+inline int f3142_25(int x) { return x * 25; }
+inline int f3142_26(int x) { return x * 26; }
+inline int f3142_27(int x) { return x * 27; }
+inline int f3142_28(int x) { return x * 28; }
+inline int f3142_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3145 */
+#include <vector>
+#include "h3645.h"
+#include "h8717.h"
+#include "h5281.h"
+#include "h3825.h"
+#include "h3966.h"
+#ifdef X
+#include "h8219.h"
+#endif
+struct S3145 { int a; const char *s = "x//y"; };
+inline int f3145_0(int x) { return x * 0; }
+inline int f3145_1(int x) { return x * 1; }
+inline int f3145_2(int x) { return x * 2; }
+inline int f3145_3(int x) { return x * 3; }
+inline int f3145_4(int x) { return x * 4; }
+inline int f3145_5(int x) { return x * 5; }
+inline int f3145_6(int x) { return x * 6; }
+inline int f3145_7(int x) { return x * 7; }
+inline int f3145_8(int x) { return x * 8; }
+inline int f3145_9(int x) { return x * 9; }
+inline int f3145_10(int x) { return x * 10; }
+inline int f3145_11(int x) { return x * 11; }
+inline int f3145_12(int x) { return x * 12; }
+inline int f3145_13(int x) { return x * 13; }
+inline int f3145_14(int x) { return x * 14; }
+inline int f3145_15(int x) { return x * 15; }
+inline int f3145_16(int x) { return x * 16; }
+inline int f3145_17(int x) { return x * 17; }
+inline int f3145_18(int x) { return x * 18; }
+inline int f3145_19(int x) { return x * 19; }
+inline int f3145_20(int x) { return x * 20; }
+inline int f3145_21(int x) { return x * 21; }
+inline int f3145_22(int x) { return x * 22; }
+inline int f3145_23(int x) { return x * 23; }
+inline int f3145_24(int x) { return x * 24; }
+inline int f3145_25(int x) { return x * 25; }
+inline int f3145_26(int x) { return x * 26; }
+inline int f3145_27(int x) { return x * 27; }
+inline int f3145_28(int x) { return x * 28; }
+inline int f3145_29(int x) { return x * 29; }
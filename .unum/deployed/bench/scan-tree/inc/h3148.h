@@ -0,0 +1,42 @@
+#pragma once
+/* header 3148 */
+#include <vector>
+#include "h7984.h"
+#include "h7247.h"
+#include "h9309.h"
+#include "h932.h"
+#include "h7828.h"
+#ifdef X
+#include "h4166.h"
+#endif
+struct S3148 { int a; const char *s = "x//y"; };
+inline int f3148_0(int x) { return x * 0; }
+inline int f3148_1(int x) { return x * 1; }
+inline int f3148_2(int x) { return x * 2; }
+inline int f3148_3(int x) { return x * 3; }
+inline int f3148_4(int x) { return x * 4; }
+inline int f3148_5(int x) { return x * 5; }
+inline int f3148_6(int x) { return x * 6; }
+inline int f3148_7(int x) { return x * 7; }
+inline int f3148_8(int x) { return x * 8; }
+inline int f3148_9(int x) { return x * 9; }
+inline int f3148_10(int x) { return x * 10; }
+inline int f3148_11(int x) { return x * 11; }
+inline int f3148_12(int x) { return x * 12; }
+inline int f3148_13(int x) { return x * 13; }
+inline int f3148_14(int x) { return x * 14; }
+inline int f3148_15(int x) { return x * 15; }
+inline int f3148_16(int x) { return x * 16; }
+inline int f3148_17(int x) { return x * 17; }
+inline int f3148_18(int x) { return x * 18; }
+inline int f3148_19(int x) { return x * 19; }
+inline int f3148_20(int x) { return x * 20; }
+inline int f3148_21(int x) { return x * 21; }
+inline int f3148_22(int x) { return x * 22; }
+inline int f3148_23(int x) { return x * 23; }
+inline int f3148_24(int x) { return x * 24; }
+inline int f3148_25(int x) { return x * 25; }
+inline int f3148_26(int x) { return x * 26; }
+inline int f3148_27(int x) { return x * 27; }
+inline int f3148_28(int x) { return x * 28; }
+inline int f3148_29(int x) { return x * 29; }
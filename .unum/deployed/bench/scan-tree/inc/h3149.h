@@ -0,0 +1,42 @@
+#pragma once
+/* header 3149 */
+#include <vector>
+#include "h1920.h"
+#include "h5456.h"
+#include "h6259.h"
+#include "h8985.h"
+#include "h5739.h"
+#ifdef X
+#include "h6967.h"
+#endif
+struct S3149 { int a; const char *s = "x//y"; };
+inline int f3149_0(int x) { return x * 0; }
+inline int f3149_1(int x) { return x * 1; }
+inline int f3149_2(int x) { return x * 2; }
+inline int f3149_3(int x) { return x * 3; }
+inline int f3149_4(int x) { return x * 4; }
+inline int f3149_5(int x) { return x * 5; }
+inline int f3149_6(int x) { return x * 6; }
+inline int f3149_7(int x) { return x * 7; }
+inline int f3149_8(int x) { return x * 8; }
+inline int f3149_9(int x) { return x * 9; }
+inline int f3149_10(int x) { return x * 10; }
+inline int f3149_11(int x) { return x * 11; }
+inline int f3149_12(int x) { return x * 12; }
+inline int f3149_13(int x) { return x * 13; }
+inline int f3149_14(int x) { return x * 14; }
+inline int f3149_15(int x) { return x * 15; }
+inline int f3149_16(int x) { return x * 16; }
+inline int f3149_17(int x) { return x * 17; }
+inline int f3149_18(int x) { return x * 18; }
+inline int f3149_19(int x) { return x * 19; }
+inline int f3149_20(int x) { return x * 20; }
+inline int f3149_21(int x) { return x * 21; }
+inline int f3149_22(int x) { return x * 22; }
+inline int f3149_23(int x) { return x * 23; }
+inline int f3149_24(int x) { return x * 24; }
+inline int f3149_25(int x) { return x * 25; }
+inline int f3149_26(int x) { return x * 26; }
+inline int f3149_27(int x) { return x * 27; }
+inline int f3149_28(int x) { return x * 28; }
+inline int f3149_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3153 */
+#include <vector>
+#include "h4969.h"
+#include "h8152.h"
+#include "h2328.h"
+#include "h2010.h"
+#include "h3731.h"
+#ifdef X
+#include "h3716.h"
+#endif
+struct S3153 { int a; const char *s = "x//y"; };
+inline int f3153_0(int x) { return x * 0; }
+inline int f3153_1(int x) { return x * 1; }
+inline int f3153_2(int x) { return x * 2; }
+inline int f3153_3(int x) { return x * 3; }
+inline int f3153_4(int x) { return x * 4; }
+inline int f3153_5(int x) { return x * 5; }
+inline int f3153_6(int x) { return x * 6; }
+inline int f3153_7(int x) { return x * 7; }
+inline int f3153_8(int x) { return x * 8; }
+inline int f3153_9(int x) { return x * 9; }
+inline int f3153_10(int x) { return x * 10; }
+inline int f3153_11(int x) { return x * 11; }
+inline int f3153_12(int x) { return x * 12; }
+inline int f3153_13(int x) { return x * 13; }
+inline int f3153_14(int x) { return x * 14; }
+inline int f3153_15(int x) { return x * 15; }
+inline int f3153_16(int x) { return x * 16; }
+inline int f3153_17(int x) { return x * 17; }
+inline int f3153_18(int x) { return x * 18; }
+inline int f3153_19(int x) { return x * 19; }
+inline int f3153_20(int x) { return x * 20; }
+inline int f3153_21(int x) { return x * 21; }
+inline int f3153_22(int x) { return x * 22; }
+inline int f3153_23(int x) { return x * 23; }
+inline int f3153_24(int x) { return x * 24; }
+inline int f3153_25(int x) { return x * 25; }
+inline int f3153_26(int x) { return x * 26; }
+inline int f3153_27(int x) { return x * 27; }
+inline int f3153_28(int x) { return x * 28; }
+inline int f3153_29(int x) { return x * 29; }
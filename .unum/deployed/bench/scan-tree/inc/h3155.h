@@ -0,0 +1,42 @@
+#pragma once
+/* header 3155 */
+#include <vector>
+#include "h6025.h"
+#include "h3434.h"
+#include "h8662.h"
+#include "h2551.h"
+#include "h8194.h"
+#ifdef X
+#include "h246.h"
+#endif
+struct S3155 { int a; const char *s = "x//y"; };
+inline int f3155_0(int x) { return x * 0; }
+inline int f3155_1(int x) { return x * 1; }
+inline int f3155_2(int x) { return x * 2; }
+inline int f3155_3(int x) { return x * 3; }
+inline int f3155_4(int x) { return x * 4; }
+inline int f3155_5(int x) { return x * 5; }
+inline int f3155_6(int x) { return x * 6; }
+inline int f3155_7(int x) { return x * 7; }
+inline int f3155_8(int x) { return x * 8; }
+inline int f3155_9(int x) { return x * 9; }
+inline int f3155_10(int x) { return x * 10; }
+inline int f3155_11(int x) { return x * 11; }
+inline int f3155_12(int x) { return x * 12; }
+inline int f3155_13(int x) { return x * 13; }
+inline int f3155_14(int x) { return x * 14; }
+inline int f3155_15(int x) { return x * 15; }
+inline int f3155_16(int x) { return x * 16; }
+inline int f3155_17(int x) { return x * 17; }
+inline int f3155_18(int x) { return x * 18; }
+inline int f3155_19(int x) { return x * 19; }
+inline int f3155_20(int x) { return x * 20; }
+inline int f3155_21(int x) { return x * 21; }
+inline int f3155_22(int x) { return x * 22; }
+inline int f3155_23(int x) { return x * 23; }
+inline int f3155_24(int x) { return x * 24; }
+inline int f3155_25(int x) { return x * 25; }
+inline int f3155_26(int x) { return x * 26; }
+inline int f3155_27(int x) { return x * 27; }
+inline int f3155_28(int x) { return x * 28; }
+inline int f3155_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3158 */
+#include <vector>
+#include "h1629.h"
+#include "h5868.h"
+#include "h3765.h"
+#include "h3737.h"
+#include "h5975.h"
+#ifdef X
+#include "h9820.h"
+#endif
+struct S3158 { int a; const char *s = "x//y"; };
+inline int f3158_0(int x) { return x * 0; }
+inline int f3158_1(int x) { return x * 1; }
+inline int f3158_2(int x) { return x * 2; }
+inline int f3158_3(int x) { return x * 3; }
+inline int f3158_4(int x) { return x * 4; }
+inline int f3158_5(int x) { return x * 5; }
+inline int f3158_6(int x) { return x * 6; }
+inline int f3158_7(int x) { return x * 7; }
+inline int f3158_8(int x) { return x * 8; }
+inline int f3158_9(int x) { return x * 9; }
+inline int f3158_10(int x) { return x * 10; }
+inline int f3158_11(int x) { return x * 11; }
+inline int f3158_12(int x) { return x * 12; }
+inline int f3158_13(int x) { return x * 13; }
+inline int f3158_14(int x) { return x * 14; }
+inline int f3158_15(int x) { return x * 15; }
+inline int f3158_16(int x) { return x * 16; }
+inline int f3158_17(int x) { return x * 17; }
+inline int f3158_18(int x) { return x * 18; }
+inline int f3158_19(int x) { return x * 19; }
+inline int f3158_20(int x) { return x * 20; }
+inline int f3158_21(int x) { return x * 21; }
+inline int f3158_22(int x) { return x * 22; }
+inline int f3158_23(int x) { return x * 23; }
+inline int f3158_24(int x) { return x * 24; }
+inline int f3158_25(int x) { return x * 25; }
+inline int f3158_26(int x) { return x * 26; }
+inline int f3158_27(int x) { return x * 27; }
+inline int f3158_28(int x) { return x * 28; }
+inline int f3158_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3163 */
+#include <vector>
+#include "h9561.h"
+#include "h5016.h"
+#include "h4420.h"
+#include "h5833.h"
+#include "h6391.h"
+#ifdef X
+#include "h3332.h"
+#endif
+struct S3163 { int a; const char *s = "x//y"; };
+inline int f3163_0(int x) { return x * 0; }
+inline int f3163_1(int x) { return x * 1; }
+inline int f3163_2(int x) { return x * 2; }
+inline int f3163_3(int x) { return x * 3; }
+inline int f3163_4(int x) { return x * 4; }
+inline int f3163_5(int x) { return x * 5; }
+inline int f3163_6(int x) { return x * 6; }
+inline int f3163_7(int x) { return x * 7; }
+inline int f3163_8(int x) { return x * 8; }
+inline int f3163_9(int x) { return x * 9; }
+inline int f3163_10(int x) { return x * 10; }
+inline int f3163_11(int x) { return x * 11; }
+inline int f3163_12(int x) { return x * 12; }
+inline int f3163_13(int x) { return x * 13; }
+inline int f3163_14(int x) { return x * 14; }
+inline int f3163_15(int x) { return x * 15; }
+inline int f3163_16(int x) { return x * 16; }
+inline int f3163_17(int x) { return x * 17; }
+inline int f3163_18(int x) { return x * 18; }
+inline int f3163_19(int x) { return x * 19; }
+inline int f3163_20(int x) { return x * 20; }
+inline int f3163_21(int x) { return x * 21; }
+inline int f3163_22(int x) { return x * 22; }
+inline int f3163_23(int x) { return x * 23; }
+inline int f3163_24(int x) { return x * 24; }
+inline int f3163_25(int x) { return x * 25; }
+inline int f3163_26(int x) { return x * 26; }
+inline int f3163_27(int x) { return x * 27; }
+inline int f3163_28(int x) { return x * 28; }
+inline int f3163_29(int x) { return x * 29; }
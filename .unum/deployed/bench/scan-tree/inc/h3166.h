@@ -0,0 +1,42 @@
+#pragma once
+/* header 3166 */
+#include <vector>
+#include "h1085.h"
+#include "h1311.h"
+#include "h2298.h"
+#include "h2963.h"
+#include "h785.h"
+#ifdef X
+#include "h2848.h"
+#endif
+struct S3166 { int a; const char *s = "x//y"; };
+inline int f3166_0(int x) { return x * 0; }
+inline int f3166_1(int x) { return x * 1; }
+inline int f3166_2(int x) { return x * 2; }
+inline int f3166_3(int x) { return x * 3; }
+inline int f3166_4(int x) { return x * 4; }
+inline int f3166_5(int x) { return x * 5; }
+inline int f3166_6(int x) { return x * 6; }
+inline int f3166_7(int x) { return x * 7; }
+inline int f3166_8(int x) { return x * 8; }
+inline int f3166_9(int x) { return x * 9; }
+inline int f3166_10(int x) { return x * 10; }
+inline int f3166_11(int x) { return x * 11; }
+inline int f3166_12(int x) { return x * 12; }
+inline int f3166_13(int x) { return x * 13; }
+inline int f3166_14(int x) { return x * 14; }
+inline int f3166_15(int x) { return x * 15; }
+inline int f3166_16(int x) { return x * 16; }
+inline int f3166_17(int x) { return x * 17; }
+inline int f3166_18(int x) { return x * 18; }
+inline int f3166_19(int x) { return x * 19; }
+inline int f3166_20(int x) { return x * 20; }
+inline int f3166_21(int x) { return x * 21; }
+inline int f3166_22(int x) { return x * 22; }
+inline int f3166_23(int x) { return x * 23; }
+inline int f3166_24(int x) { return x * 24; }
+inline int f3166_25(int x) { return x * 25; }
+inline int f3166_26(int x) { return x * 26; }
+inline int f3166_27(int x) { return x * 27; }
+inline int f3166_28(int x) { return x * 28; }
+inline int f3166_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3171 */
+#include <vector>
+#include "h2081.h"
+#include "h4695.h"
+#include "h397.h"
+#include "h5464.h"
+#include "h2679.h"
+#ifdef X
+#include "h8776.h"
+#endif
+struct S3171 { int a; const char *s = "x//y"; };
+inline int f3171_0(int x) { return x * 0; }
+inline int f3171_1(int x) { return x * 1; }
+inline int f3171_2(int x) { return x * 2; }
+inline int f3171_3(int x) { return x * 3; }
+inline int f3171_4(int x) { return x * 4; }
+inline int f3171_5(int x) { return x * 5; }
+inline int f3171_6(int x) { return x * 6; }
+inline int f3171_7(int x) { return x * 7; }
+inline int f3171_8(int x) { return x * 8; }
+inline int f3171_9(int x) { return x * 9; }
+inline int f3171_10(int x) { return x * 10; }
+inline int f3171_11(int x) { return x * 11; }
+inline int f3171_12(int x) { return x * 12; }
+inline int f3171_13(int x) { return x * 13; }
+inline int f3171_14(int x) { return x * 14; }
+inline int f3171_15(int x) { return x * 15; }
+inline int f3171_16(int x) { return x * 16; }
+inline int f3171_17(int x) { return x * 17; }
+inline int f3171_18(int x) { return x * 18; }
+inline int f3171_19(int x) { return x * 19; }
+inline int f3171_20(int x) { return x * 20; }
+inline int f3171_21(int x) { return x * 21; }
+inline int f3171_22(int x) { return x * 22; }
+inline int f3171_23(int x) { return x * 23; }
+inline int f3171_24(int x) { return x * 24; }
+inline int f3171_25(int x) { return x * 25; }
+inline int f3171_26(int x) { return x * 26; }
+inline int f3171_27(int x) { return x * 27; }
+inline int f3171_28(int x) { return x * 28; }
+inline int f3171_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3173 */
+#include <vector>
+#include "h1295.h"
+#include "h7529.h"
+#include "h895.h"
+#include "h6457.h"
+#include "h360.h"
+#ifdef X
+#include "h3926.h"
+#endif
+struct S3173 { int a; const char *s = "x//y"; };
+inline int f3173_0(int x) { return x * 0; }
+inline int f3173_1(int x) { return x * 1; }
+inline int f3173_2(int x) { return x * 2; }
+inline int f3173_3(int x) { return x * 3; }
+inline int f3173_4(int x) { return x * 4; }
+inline int f3173_5(int x) { return x * 5; }
+inline int f3173_6(int x) { return x * 6; }
+inline int f3173_7(int x) { return x * 7; }
+inline int f3173_8(int x) { return x * 8; }
+inline int f3173_9(int x) { return x * 9; }
+inline int f3173_10(int x) { return x * 10; }
+inline int f3173_11(int x) { return x * 11; }
+inline int f3173_12(int x) { return x * 12; }
+inline int f3173_13(int x) { return x * 13; }
+inline int f3173_14(int x) { return x * 14; }
+inline int f3173_15(int x) { return x * 15; }
+inline int f3173_16(int x) { return x * 16; }
+inline int f3173_17(int x) { return x * 17; }
+inline int f3173_18(int x) { return x * 18; }
+inline int f3173_19(int x) { return x * 19; }
+inline int f3173_20(int x) { return x * 20; }
+inline int f3173_21(int x) { return x * 21; }
+inline int f3173_22(int x) { return x * 22; }
+inline int f3173_23(int x) { return x * 23; }
+inline int f3173_24(int x) { return x * 24; }
+inline int f3173_25(int x) { return x * 25; }
+inline int f3173_26(int x) { return x * 26; }
+inline int f3173_27(int x) { return x * 27; }
+inline int f3173_28(int x) { return x * 28; }
+inline int f3173_29(int x) { return x * 29; }
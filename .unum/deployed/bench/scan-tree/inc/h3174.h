@@ -0,0 +1,42 @@
+#pragma once
+/* header 3174 */
+#include <vector>
+#include "h4399.h"
+#include "h4360.h"
+#include "h9285.h"
+#include "h9350.h"
+#include "h7831.h"
+#ifdef X
+#include "h4876.h"
+#endif
+struct S3174 { int a; const char *s = "x//y"; };
+inline int f3174_0(int x) { return x * 0; }
+inline int f3174_1(int x) { return x * 1; }
+inline int f3174_2(int x) { return x * 2; }
+inline int f3174_3(int x) { return x * 3; }
+inline int f3174_4(int x) { return x * 4; }
+inline int f3174_5(int x) { return x * 5; }
+inline int f3174_6(int x) { return x * 6; }
+inline int f3174_7(int x) { return x * 7; }
+inline int f3174_8(int x) { return x * 8; }
+inline int f3174_9(int x) { return x * 9; }
+inline int f3174_10(int x) { return x * 10; }
+inline int f3174_11(int x) { return x * 11; }
+inline int f3174_12(int x) { return x * 12; }
+inline int f3174_13(int x) { return x * 13; }
+inline int f3174_14(int x) { return x * 14; }
+inline int f3174_15(int x) { return x * 15; }
+inline int f3174_16(int x) { return x * 16; }
+inline int f3174_17(int x) { return x * 17; }
+inline int f3174_18(int x) { return x * 18; }
+inline int f3174_19(int x) { return x * 19; }
+inline int f3174_20(int x) { return x * 20; }
+inline int f3174_21(int x) { return x * 21; }
+inline int f3174_22(int x) { return x * 22; }
+inline int f3174_23(int x) { return x * 23; }
+inline int f3174_24(int x) { return x * 24; }
+inline int f3174_25(int x) { return x * 25; }
+inline int f3174_26(int x) { return x * 26; }
+inline int f3174_27(int x) { return x * 27; }
+inline int f3174_28(int x) { return x * 28; }
+inline int f3174_29(int x) { return x * 29; }
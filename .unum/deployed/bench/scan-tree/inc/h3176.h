@@ -0,0 +1,42 @@
+#pragma once
+/* header 3176 */
+#include <vector>
+#include "h2254.h"
+#include "h46.h"
+#include "h2880.h"
+#include "h3911.h"
+#include "h6472.h"
+#ifdef X
+#include "h7260.h"
+#endif
+struct S3176 { int a; const char *s = "x//y"; };
+inline int f3176_0(int x) { return x * 0; }
+inline int f3176_1(int x) { return x * 1; }
+inline int f3176_2(int x) { return x * 2; }
+inline int f3176_3(int x) { return x * 3; }
+inline int f3176_4(int x) { return x * 4; }
+inline int f3176_5(int x) { return x * 5; }
+inline int f3176_6(int x) { return x * 6; }
+inline int f3176_7(int x) { return x * 7; }
+inline int f3176_8(int x) { return x * 8; }
+inline int f3176_9(int x) { return x * 9; }
+inline int f3176_10(int x) { return x * 10; }
+inline int f3176_11(int x) { return x * 11; }
+inline int f3176_12(int x) { return x * 12; }
+inline int f3176_13(int x) { return x * 13; }
+inline int f3176_14(int x) { return x * 14; }
+inline int f3176_15(int x) { return x * 15; }
+inline int f3176_16(int x) { return x * 16; }
+inline int f3176_17(int x) { return x * 17; }
+inline int f3176_18(int x) { return x * 18; }
+inline int f3176_19(int x) { return x * 19; }
+inline int f3176_20(int x) { return x * 20; }
+inline int f3176_21(int x) { return x * 21; }
+inline int f3176_22(int x) { return x * 22; }
+inline int f3176_23(int x) { return x * 23; }
+inline int f3176_24(int x) { return x * 24; }
+inline int f3176_25(int x) { return x * 25; }
+inline int f3176_26(int x) { return x * 26; }
+inline int f3176_27(int x) { return x * 27; }
+inline int f3176_28(int x) { return x * 28; }
+inline int f3176_29(int x) { return x * 29; }
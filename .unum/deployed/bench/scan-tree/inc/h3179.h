@@ -0,0 +1,42 @@
+#pragma once
+/* header 3179 */
+#include <vector>
+#include "h518.h"
+#include "h143.h"
+#include "h8262.h"
+#include "h2880.h"
+#include "h2549.h"
+#ifdef X
+#include "h6087.h"
+#endif
+struct S3179 { int a; const char *s = "x//y"; };
+inline int f3179_0(int x) { return x * 0; }
+inline int f3179_1(int x) { return x * 1; }
+inline int f3179_2(int x) { return x * 2; }
+inline int f3179_3(int x) { return x * 3; }
+inline int f3179_4(int x) { return x * 4; }
+inline int f3179_5(int x) { return x * 5; }
+inline int f3179_6(int x) { return x * 6; }
+inline int f3179_7(int x) { return x * 7; }
+inline int f3179_8(int x) { return x * 8; }
+inline int f3179_9(int x) { return x * 9; }
+inline int f3179_10(int x) { return x * 10; }
+inline int f3179_11(int x) { return x * 11; }
+inline int f3179_12(int x) { return x * 12; }
+inline int f3179_13(int x) { return x * 13; }
+inline int f3179_14(int x) { return x * 14; }
+inline int f3179_15(int x) { return x * 15; }
+inline int f3179_16(int x) { return x * 16; }
+inline int f3179_17(int x) { return x * 17; }
+inline int f3179_18(int x) { return x * 18; }
+inline int f3179_19(int x) { return x * 19; }
+inline int f3179_20(int x) { return x * 20; }
+inline int f3179_21(int x) { return x * 21; }
+inline int f3179_22(int x) { return x * 22; }
+inline int f3179_23(int x) { return x * 23; }
+inline int f3179_24(int x) { return x * 24; }
+inline int f3179_25(int x) { return x * 25; }
+inline int f3179_26(int x) { return x * 26; }
+inline int f3179_27(int x) { return x * 27; }
+inline int f3179_28(int x) { return x * 28; }
+inline int f3179_29(int x) { return x * 29; }
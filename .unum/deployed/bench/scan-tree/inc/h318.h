@@ -0,0 +1,42 @@
+#pragma once
+/* header 318 */
+#include <vector>
+#include "h7858.h"
+#include "h6691.h"
+#include "h6142.h"
+#include "h4638.h"
+#include "h5769.h"
+#ifdef X
+#include "h243.h"
+#endif
+struct S318 { int a; const char *s = "x//y"; };
+inline int f318_0(int x) { return x * 0; }
+inline int f318_1(int x) { return x * 1; }
+inline int f318_2(int x) { return x * 2; }
+inline int f318_3(int x) { return x * 3; }
+inline int f318_4(int x) { return x * 4; }
+inline int f318_5(int x) { return x * 5; }
+inline int f318_6(int x) { return x * 6; }
+inline int f318_7(int x) { return x * 7; }
+inline int f318_8(int x) { return x * 8; }
+inline int f318_9(int x) { return x * 9; }
+inline int f318_10(int x) { return x * 10; }
+inline int f318_11(int x) { return x * 11; }
+inline int f318_12(int x) { return x * 12; }
+inline int f318_13(int x) { return x * 13; }
+inline int f318_14(int x) { return x * 14; }
+inline int f318_15(int x) { return x * 15; }
+inline int f318_16(int x) { return x * 16; }
+inline int f318_17(int x) { return x * 17; }
+inline int f318_18(int x) { return x * 18; }
+inline int f318_19(int x) { return x * 19; }
+inline int f318_20(int x) { return x * 20; }
+inline int f318_21(int x) { return x * 21; }
+inline int f318_22(int x) { return x * 22; }
+inline int f318_23(int x) { return x * 23; }
+inline int f318_24(int x) { return x * 24; }
+inline int f318_25(int x) { return x * 25; }
+inline int f318_26(int x) { return x * 26; }
+inline int f318_27(int x) { return x * 27; }
+inline int f318_28(int x) { return x * 28; }
+inline int f318_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3180 */
+#include <vector>
+#include "h3953.h"
+#include "h7143.h"
+#include "h8495.h"
+#include "h1812.h"
+#include "h4171.h"
+#ifdef X
+#include "h2947.h"
+#endif
+struct S3180 { int a; const char *s = "x//y"; };
+inline int f3180_0(int x) { return x * 0; }
+inline int f3180_1(int x) { return x * 1; }
+inline int f3180_2(int x) { return x * 2; }
+inline int f3180_3(int x) { return x * 3; }
+inline int f3180_4(int x) { return x * 4; }
+inline int f3180_5(int x) { return x * 5; }
+inline int f3180_6(int x) { return x * 6; }
+inline int f3180_7(int x) { return x * 7; }
+inline int f3180_8(int x) { return x * 8; }
+inline int f3180_9(int x) { return x * 9; }
+inline int f3180_10(int x) { return x * 10; }
+inline int f3180_11(int x) { return x * 11; }
+inline int f3180_12(int x) { return x * 12; }
+inline int f3180_13(int x) { return x * 13; }
+inline int f3180_14(int x) { return x * 14; }
+inline int f3180_15(int x) { return x * 15; }
+inline int f3180_16(int x) { return x * 16; }
+inline int f3180_17(int x) { return x * 17; }
+inline int f3180_18(int x) { return x * 18; }
+inline int f3180_19(int x) { return x * 19; }
+inline int f3180_20(int x) { return x * 20; }
+inline int f3180_21(int x) { return x * 21; }
+inline int f3180_22(int x) { return x * 22; }
+inline int f3180_23(int x) { return x * 23; }
+inline int f3180_24(int x) { return x * 24; }
+inline int f3180_25(int x) { return x * 25; }
+inline int f3180_26(int x) { return x * 26; }
+inline int f3180_27(int x) { return x * 27; }
+inline int f3180_28(int x) { return x * 28; }
+inline int f3180_29(int x) { return x * 29; }
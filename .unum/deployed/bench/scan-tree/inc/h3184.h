@@ -0,0 +1,42 @@
+#pragma once
+/* header 3184 */
+#include <vector>
+#include "h8515.h"
+#include "h98.h"
+#include "h8277.h"
+#include "h8025.h"
+#include "h5511.h"
+#ifdef X
+#include "h6095.h"
+#endif
+struct S3184 { int a; const char *s = "x//y"; };
+inline int f3184_0(int x) { return x * 0; }
+inline int f3184_1(int x) { return x * 1; }
+inline int f3184_2(int x) { return x * 2; }
+inline int f3184_3(int x) { return x * 3; }
+inline int f3184_4(int x) { return x * 4; }
+inline int f3184_5(int x) { return x * 5; }
+inline int f3184_6(int x) { return x * 6; }
+inline int f3184_7(int x) { return x * 7; }
+inline int f3184_8(int x) { return x * 8; }
+inline int f3184_9(int x) { return x * 9; }
+inline int f3184_10(int x) { return x * 10; }
+inline int f3184_11(int x) { return x * 11; }
+inline int f3184_12(int x) { return x * 12; }
+inline int f3184_13(int x) { return x * 13; }
+inline int f3184_14(int x) { return x * 14; }
+inline int f3184_15(int x) { return x * 15; }
+inline int f3184_16(int x) { return x * 16; }
+inline int f3184_17(int x) { return x * 17; }
+inline int f3184_18(int x) { return x * 18; }
+inline int f3184_19(int x) { return x * 19; }
+inline int f3184_20(int x) { return x * 20; }
+inline int f3184_21(int x) { return x * 21; }
+inline int f3184_22(int x) { return x * 22; }
+inline int f3184_23(int x) { return x * 23; }
+inline int f3184_24(int x) { return x * 24; }
+inline int f3184_25(int x) { return x * 25; }
+inline int f3184_26(int x) { return x * 26; }
+inline int f3184_27(int x) { return x * 27; }
+inline int f3184_28(int x) { return x * 28; }
+inline int f3184_29(int x) { return x * 29; }
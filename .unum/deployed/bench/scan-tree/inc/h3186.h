@@ -0,0 +1,42 @@
+#pragma once
+/* header 3186 */
+#include <vector>
+#include "h9859.h"
+#include "h9857.h"
+#include "h7078.h"
+#include "h9096.h"
+#include "h970.h"
+#ifdef X
+#include "h7773.h"
+#endif
+struct S3186 { int a; const char *s = "x//y"; };
+inline int f3186_0(int x) { return x * 0; }
+inline int f3186_1(int x) { return x * 1; }
+inline int f3186_2(int x) { return x * 2; }
+inline int f3186_3(int x) { return x * 3; }
+inline int f3186_4(int x) { return x * 4; }
+inline int f3186_5(int x) { return x * 5; }
+inline int f3186_6(int x) { return x * 6; }
+inline int f3186_7(int x) { return x * 7; }
+inline int f3186_8(int x) { return x * 8; }
+inline int f3186_9(int x) { return x * 9; }
+inline int f3186_10(int x) { return x * 10; }
+inline int f3186_11(int x) { return x * 11; }
+inline int f3186_12(int x) { return x * 12; }
+inline int f3186_13(int x) { return x * 13; }
+inline int f3186_14(int x) { return x * 14; }
+inline int f3186_15(int x) { return x * 15; }
+inline int f3186_16(int x) { return x * 16; }
+inline int f3186_17(int x) { return x * 17; }
+inline int f3186_18(int x) { return x * 18; }
+inline int f3186_19(int x) { return x * 19; }
+inline int f3186_20(int x) { return x * 20; }
+inline int f3186_21(int x) { return x * 21; }
+inline int f3186_22(int x) { return x * 22; }
+inline int f3186_23(int x) { return x * 23; }
+inline int f3186_24(int x) { return x * 24; }
+inline int f3186_25(int x) { return x * 25; }
+inline int f3186_26(int x) { return x * 26; }
+inline int f3186_27(int x) { return x * 27; }
+inline int f3186_28(int x) { return x * 28; }
+inline int f3186_29(int x) { return x * 29; }
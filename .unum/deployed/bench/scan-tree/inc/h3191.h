@@ -0,0 +1,42 @@
+#pragma once
+/* header 3191 */
+#include <vector>
+#include "h7361.h"
+#include "h6094.h"
+#include "h3958.h"
+#include "h2593.h"
+#include "h6294.h"
+#ifdef X
+#include "h5419.h"
+#endif
+struct S3191 { int a; const char *s = "x//y"; };
+inline int f3191_0(int x) { return x * 0; }
+inline int f3191_1(int x) { return x * 1; }
+inline int f3191_2(int x) { return x * 2; }
+inline int f3191_3(int x) { return x * 3; }
+inline int f3191_4(int x) { return x * 4; }
+inline int f3191_5(int x) { return x * 5; }
+inline int f3191_6(int x) { return x * 6; }
+inline int f3191_7(int x) { return x * 7; }
+inline int f3191_8(int x) { return x * 8; }
+inline int f3191_9(int x) { return x * 9; }
+inline int f3191_10(int x) { return x * 10; }
+inline int f3191_11(int x) { return x * 11; }
+inline int f3191_12(int x) { return x * 12; }
+inline int f3191_13(int x) { return x * 13; }
+inline int f3191_14(int x) { return x * 14; }
+inline int f3191_15(int x) { return x * 15; }
+inline int f3191_16(int x) { return x * 16; }
+inline int f3191_17(int x) { return x * 17; }
+inline int f3191_18(int x) { return x * 18; }
+inline int f3191_19(int x) { return x * 19; }
+inline int f3191_20(int x) { return x * 20; }
+inline int f3191_21(int x) { return x * 21; }
+inline int f3191_22(int x) { return x * 22; }
+inline int f3191_23(int x) { return x * 23; }
+inline int f3191_24(int x) { return x * 24; }
+inline int f3191_25(int x) { return x * 25; }
+inline int f3191_26(int x) { return x * 26; }
+inline int f3191_27(int x) { return x * 27; }
+inline int f3191_28(int x) { return x * 28; }
+inline int f3191_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3192 */
+#include <vector>
+#include "h5359.h"
+#include "h3540.h"
+#include "h7902.h"
+#include "h6962.h"
+#include "h7929.h"
+#ifdef X
+#include "h9775.h"
+#endif
+struct S3192 { int a; const char *s = "x//y"; };
+inline int f3192_0(int x) { return x * 0; }
+inline int f3192_1(int x) { return x * 1; }
+inline int f3192_2(int x) { return x * 2; }
+inline int f3192_3(int x) { return x * 3; }
+inline int f3192_4(int x) { return x * 4; }
+inline int f3192_5(int x) { return x * 5; }
+inline int f3192_6(int x) { return x * 6; }
+inline int f3192_7(int x) { return x * 7; }
+inline int f3192_8(int x) { return x * 8; }
+inline int f3192_9(int x) { return x * 9; }
+inline int f3192_10(int x) { return x * 10; }
+inline int f3192_11(int x) { return x * 11; }
+inline int f3192_12(int x) { return x * 12; }
+inline int f3192_13(int x) { return x * 13; }
+inline int f3192_14(int x) { return x * 14; }
+inline int f3192_15(int x) { return x * 15; }
+inline int f3192_16(int x) { return x * 16; }
+inline int f3192_17(int x) { return x * 17; }
+inline int f3192_18(int x) { return x * 18; }
+inline int f3192_19(int x) { return x * 19; }
+inline int f3192_20(int x) { return x * 20; }
+inline int f3192_21(int x) { return x * 21; }
+inline int f3192_22(int x) { return x * 22; }
+inline int f3192_23(int x) { return x * 23; }
+inline int f3192_24(int x) { return x * 24; }
+inline int f3192_25(int x) { return x * 25; }
+inline int f3192_26(int x) { return x * 26; }
+inline int f3192_27(int x) { return x * 27; }
+inline int f3192_28(int x) { return x * 28; }
+inline int f3192_29(int x) { return x * 29; }
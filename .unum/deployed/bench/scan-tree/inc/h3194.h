@@ -0,0 +1,42 @@
+#pragma once
+/* header 3194 */
+#include <vector>
+#include "h8321.h"
+#include "h6587.h"
+#include "h1887.h"
+#include "h5048.h"
+#include "h5543.h"
+#ifdef X
+#include "h2000.h"
+#endif
+struct S3194 { int a; const char *s = "x//y"; };
+inline int f3194_0(int x) { return x * 0; }
+inline int f3194_1(int x) { return x * 1; }
+inline int f3194_2(int x) { return x * 2; }
+inline int f3194_3(int x) { return x * 3; }
+inline int f3194_4(int x) { return x * 4; }
+inline int f3194_5(int x) { return x * 5; }
+inline int f3194_6(int x) { return x * 6; }
+inline int f3194_7(int x) { return x * 7; }
+inline int f3194_8(int x) { return x * 8; }
+inline int f3194_9(int x) { return x * 9; }
+inline int f3194_10(int x) { return x * 10; }
+inline int f3194_11(int x) { return x * 11; }
+inline int f3194_12(int x) { return x * 12; }
+inline int f3194_13(int x) { return x * 13; }
+inline int f3194_14(int x) { return x * 14; }
+inline int f3194_15(int x) { return x * 15; }
+inline int f3194_16(int x) { return x * 16; }
+inline int f3194_17(int x) { return x * 17; }
+inline int f3194_18(int x) { return x * 18; }
+inline int f3194_19(int x) { return x * 19; }
+inline int f3194_20(int x) { return x * 20; }
+inline int f3194_21(int x) { return x * 21; }
+inline int f3194_22(int x) { return x * 22; }
+inline int f3194_23(int x) { return x * 23; }
+inline int f3194_24(int x) { return x * 24; }
+inline int f3194_25(int x) { return x * 25; }
+inline int f3194_26(int x) { return x * 26; }
+inline int f3194_27(int x) { return x * 27; }
+inline int f3194_28(int x) { return x * 28; }
+inline int f3194_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3195 */
+#include <vector>
+#include "h8891.h"
+#include "h7161.h"
+#include "h283.h"
+#include "h6627.h"
+#include "h560.h"
+#ifdef X
+#include "h8436.h"
+#endif
+struct S3195 { int a; const char *s = "x//y"; };
+inline int f3195_0(int x) { return x * 0; }
+inline int f3195_1(int x) { return x * 1; }
+inline int f3195_2(int x) { return x * 2; }
+inline int f3195_3(int x) { return x * 3; }
+inline int f3195_4(int x) { return x * 4; }
+inline int f3195_5(int x) { return x * 5; }
+inline int f3195_6(int x) { return x * 6; }
+inline int f3195_7(int x) { return x * 7; }
+inline int f3195_8(int x) { return x * 8; }
+inline int f3195_9(int x) { return x * 9; }
+inline int f3195_10(int x) { return x * 10; }
+inline int f3195_11(int x) { return x * 11; }
+inline int f3195_12(int x) { return x * 12; }
+inline int f3195_13(int x) { return x * 13; }
+inline int f3195_14(int x) { return x * 14; }
+inline int f3195_15(int x) { return x * 15; }
+inline int f3195_16(int x) { return x * 16; }
+inline int f3195_17(int x) { return x * 17; }
+inline int f3195_18(int x) { return x * 18; }
+inline int f3195_19(int x) { return x * 19; }
+inline int f3195_20(int x) { return x * 20; }
+inline int f3195_21(int x) { return x * 21; }
+inline int f3195_22(int x) { return x * 22; }
+inline int f3195_23(int x) { return x * 23; }
+inline int f3195_24(int x) { return x * 24; }
+inline int f3195_25(int x) { return x * 25; }
+inline int f3195_26(int x) { return x * 26; }
+inline int f3195_27(int x) { return x * 27; }
+inline int f3195_28(int x) { return x * 28; }
+inline int f3195_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3196 */
+#include <vector>
+#include "h1234.h"
+#include "h5001.h"
+#include "h711.h"
+#include "h1914.h"
+#include "h5628.h"
+#ifdef X
+#include "h2083.h"
+#endif
+struct S3196 { int a; const char *s = "x//y"; };
+inline int f3196_0(int x) { return x * 0; }
+inline int f3196_1(int x) { return x * 1; }
+inline int f3196_2(int x) { return x * 2; }
+inline int f3196_3(int x) { return x * 3; }
+inline int f3196_4(int x) { return x * 4; }
+inline int f3196_5(int x) { return x * 5; }
+inline int f3196_6(int x) { return x * 6; }
+inline int f3196_7(int x) { return x * 7; }
+inline int f3196_8(int x) { return x * 8; }
+inline int f3196_9(int x) { return x * 9; }
+inline int f3196_10(int x) { return x * 10; }
+inline int f3196_11(int x) { return x * 11; }
+inline int f3196_12(int x) { return x * 12; }
+inline int f3196_13(int x) { return x * 13; }
+inline int f3196_14(int x) { return x * 14; }
+inline int f3196_15(int x) { return x * 15; }
+inline int f3196_16(int x) { return x * 16; }
+inline int f3196_17(int x) { return x * 17; }
+inline int f3196_18(int x) { return x * 18; }
+inline int f3196_19(int x) { return x * 19; }
+inline int f3196_20(int x) { return x * 20; }
+inline int f3196_21(int x) { return x * 21; }
+inline int f3196_22(int x) { return x * 22; }
+inline int f3196_23(int x) { return x * 23; }
+inline int f3196_24(int x) { return x * 24; }
+inline int f3196_25(int x) { return x * 25; }
+inline int f3196_26(int x) { return x * 26; }
+inline int f3196_27(int x) { return x * 27; }
+inline int f3196_28(int x) { return x * 28; }
+inline int f3196_29(int x) { return x * 29; }
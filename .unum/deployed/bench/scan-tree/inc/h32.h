@@ -0,0 +1,42 @@
+#pragma once
+/* header 32 */
+#include <vector>
+#include "h4138.h"
+#include "h6369.h"
+#include "h5197.h"
+#include "h2685.h"
+#include "h47.h"
+#ifdef X
+#include "h9351.h"
+#endif
+struct S32 { int a; const char *s = "x//y"; };
+inline int f32_0(int x) { return x * 0; }
+inline int f32_1(int x) { return x * 1; }
+inline int f32_2(int x) { return x * 2; }
+inline int f32_3(int x) { return x * 3; }
+inline int f32_4(int x) { return x * 4; }
+inline int f32_5(int x) { return x * 5; }
+inline int f32_6(int x) { return x * 6; }
+inline int f32_7(int x) { return x * 7; }
+inline int f32_8(int x) { return x * 8; }
+inline int f32_9(int x) { return x * 9; }
+inline int f32_10(int x) { return x * 10; }
+inline int f32_11(int x) { return x * 11; }
+inline int f32_12(int x) { return x * 12; }
+inline int f32_13(int x) { return x * 13; }
+inline int f32_14(int x) { return x * 14; }
+inline int f32_15(int x) { return x * 15; }
+inline int f32_16(int x) { return x * 16; }
+inline int f32_17(int x) { return x * 17; }
+inline int f32_18(int x) { return x * 18; }
+inline int f32_19(int x) { return x * 19; }
+inline int f32_20(int x) { return x * 20; }
+inline int f32_21(int x) { return x * 21; }
+inline int f32_22(int x) { return x * 22; }
+inline int f32_23(int x) { return x * 23; }
+inline int f32_24(int x) { return x * 24; }
+inline int f32_25(int x) { return x * 25; }
+inline int f32_26(int x) { return x * 26; }
+inline int f32_27(int x) { return x * 27; }
+inline int f32_28(int x) { return x * 28; }
+inline int f32_29(int x) { return x * 29; }
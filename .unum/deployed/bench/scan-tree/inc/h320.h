@@ -0,0 +1,42 @@
+#pragma once
+/* header 320 */
+#include <vector>
+#include "h2261.h"
+#include "h5080.h"
+#include "h5423.h"
+#include "h1274.h"
+#include "h2956.h"
+#ifdef X
+#include "h9349.h"
+#endif
+struct S320 { int a; const char *s = "x//y"; };
+inline int f320_0(int x) { return x * 0; }
+inline int f320_1(int x) { return x * 1; }
+inline int f320_2(int x) { return x * 2; }
+inline int f320_3(int x) { return x * 3; }
+inline int f320_4(int x) { return x * 4; }
+inline int f320_5(int x) { return x * 5; }
+inline int f320_6(int x) { return x * 6; }
+inline int f320_7(int x) { return x * 7; }
+inline int f320_8(int x) { return x * 8; }
+inline int f320_9(int x) { return x * 9; }
+inline int f320_10(int x) { return x * 10; }
+inline int f320_11(int x) { return x * 11; }
+inline int f320_12(int x) { return x * 12; }
+inline int f320_13(int x) { return x * 13; }
+inline int f320_14(int x) { return x * 14; }
+inline int f320_15(int x) { return x * 15; }
+inline int f320_16(int x) { return x * 16; }
+inline int f320_17(int x) { return x * 17; }
+inline int f320_18(int x) { return x * 18; }
+inline int f320_19(int x) { return x * 19; }
+inline int f320_20(int x) { return x * 20; }
+inline int f320_21(int x) { return x * 21; }
+inline int f320_22(int x) { return x * 22; }
+inline int f320_23(int x) { return x * 23; }
+inline int f320_24(int x) { return x * 24; }
+inline int f320_25(int x) { return x * 25; }
+inline int f320_26(int x) { return x * 26; }
+inline int f320_27(int x) { return x * 27; }
+inline int f320_28(int x) { return x * 28; }
+inline int f320_29(int x) { return x * 29; }
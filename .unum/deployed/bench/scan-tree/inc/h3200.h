@@ -0,0 +1,42 @@
+#pragma once
+/* header 3200 */
+#include <vector>
+#include "h4567.h"
+#include "h1214.h"
+#include "h7453.h"
+#include "h2032.h"
+#include "h2637.h"
+#ifdef X
+#include "h7133.h"
+#endif
+struct S3200 { int a; const char *s = "x//y"; };
+inline int f3200_0(int x) { return x * 0; }
+inline int f3200_1(int x) { return x * 1; }
+inline int f3200_2(int x) { return x * 2; }
+inline int f3200_3(int x) { return x * 3; }
+inline int f3200_4(int x) { return x * 4; }
+inline int f3200_5(int x) { return x * 5; }
+inline int f3200_6(int x) { return x * 6; }
+inline int f3200_7(int x) { return x * 7; }
+inline int f3200_8(int x) { return x * 8; }
+inline int f3200_9(int x) { return x * 9; }
+inline int f3200_10(int x) { return x * 10; }
+inline int f3200_11(int x) { return x * 11; }
+inline int f3200_12(int x) { return x * 12; }
+inline int f3200_13(int x) { return x * 13; }
+inline int f3200_14(int x) { return x * 14; }
+inline int f3200_15(int x) { return x * 15; }
+inline int f3200_16(int x) { return x * 16; }
+inline int f3200_17(int x) { return x * 17; }
+inline int f3200_18(int x) { return x * 18; }
+inline int f3200_19(int x) { return x * 19; }
+inline int f3200_20(int x) { return x * 20; }
+inline int f3200_21(int x) { return x * 21; }
+inline int f3200_22(int x) { return x * 22; }
+inline int f3200_23(int x) { return x * 23; }
+inline int f3200_24(int x) { return x * 24; }
+inline int f3200_25(int x) { return x * 25; }
+inline int f3200_26(int x) { return x * 26; }
+inline int f3200_27(int x) { return x * 27; }
+inline int f3200_28(int x) { return x * 28; }
+inline int f3200_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3201 */
+#include <vector>
+#include "h7921.h"
+#include "h1217.h"
+#include "h7985.h"
+#include "h7740.h"
+#include "h6202.h"
+#ifdef X
+#include "h5679.h"
+#endif
+struct S3201 { int a; const char *s = "x//y"; };
+inline int f3201_0(int x) { return x * 0; }
+inline int f3201_1(int x) { return x * 1; }
+inline int f3201_2(int x) { return x * 2; }
+inline int f3201_3(int x) { return x * 3; }
+inline int f3201_4(int x) { return x * 4; }
+inline int f3201_5(int x) { return x * 5; }
+inline int f3201_6(int x) { return x * 6; }
+inline int f3201_7(int x) { return x * 7; }
+inline int f3201_8(int x) { return x * 8; }
+inline int f3201_9(int x) { return x * 9; }
+inline int f3201_10(int x) { return x * 10; }
+inline int f3201_11(int x) { return x * 11; }
+inline int f3201_12(int x) { return x * 12; }
+inline int f3201_13(int x) { return x * 13; }
+inline int f3201_14(int x) { return x * 14; }
+inline int f3201_15(int x) { return x * 15; }
+inline int f3201_16(int x) { return x * 16; }
+inline int f3201_17(int x) { return x * 17; }
+inline int f3201_18(int x) { return x * 18; }
+inline int f3201_19(int x) { return x * 19; }
+inline int f3201_20(int x) { return x * 20; }
+inline int f3201_21(int x) { return x * 21; }
+inline int f3201_22(int x) { return x * 22; }
+inline int f3201_23(int x) { return x * 23; }
+inline int f3201_24(int x) { return x * 24; }
+inline int f3201_25(int x) { return x * 25; }
+inline int f3201_26(int x) { return x * 26; }
+inline int f3201_27(int x) { return x * 27; }
+inline int f3201_28(int x) { return x * 28; }
+inline int f3201_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3202 */
+#include <vector>
+#include "h5052.h"
+#include "h5931.h"
+#include "h4571.h"
+#include "h8370.h"
+#include "h3992.h"
+#ifdef X
+#include "h7723.h"
+#endif
+struct S3202 { int a; const char *s = "x//y"; };
+inline int f3202_0(int x) { return x * 0; }
+inline int f3202_1(int x) { return x * 1; }
+inline int f3202_2(int x) { return x * 2; }
+inline int f3202_3(int x) { return x * 3; }
+inline int f3202_4(int x) { return x * 4; }
+inline int f3202_5(int x) { return x * 5; }
+inline int f3202_6(int x) { return x * 6; }
+inline int f3202_7(int x) { return x * 7; }
+inline int f3202_8(int x) { return x * 8; }
+inline int f3202_9(int x) { return x * 9; }
+inline int f3202_10(int x) { return x * 10; }
+inline int f3202_11(int x) { return x * 11; }
+inline int f3202_12(int x) { return x * 12; }
+inline int f3202_13(int x) { return x * 13; }
+inline int f3202_14(int x) { return x * 14; }
+inline int f3202_15(int x) { return x * 15; }
+inline int f3202_16(int x) { return x * 16; }
+inline int f3202_17(int x) { return x * 17; }
+inline int f3202_18(int x) { return x * 18; }
+inline int f3202_19(int x) { return x * 19; }
+inline int f3202_20(int x) { return x * 20; }
+inline int f3202_21(int x) { return x * 21; }
+inline int f3202_22(int x) { return x * 22; }
+inline int f3202_23(int x) { return x * 23; }
+inline int f3202_24(int x) { return x * 24; }
+inline int f3202_25(int x) { return x * 25; }
+inline int f3202_26(int x) { return x * 26; }
+inline int f3202_27(int x) { return x * 27; }
+inline int f3202_28(int x) { return x * 28; }
+inline int f3202_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3203 */
+#include <vector>
+#include "h3664.h"
+#include "h2902.h"
+#include "h173.h"
+#include "h6111.h"
+#include "h8400.h"
+#ifdef X
+#include "h2821.h"
+#endif
+struct S3203 { int a; const char *s = "x//y"; };
+inline int f3203_0(int x) { return x * 0; }
+inline int f3203_1(int x) { return x * 1; }
+inline int f3203_2(int x) { return x * 2; }
+inline int f3203_3(int x) { return x * 3; }
+inline int f3203_4(int x) { return x * 4; }
+inline int f3203_5(int x) { return x * 5; }
+inline int f3203_6(int x) { return x * 6; }
+inline int f3203_7(int x) { return x * 7; }
+inline int f3203_8(int x) { return x * 8; }
+inline int f3203_9(int x) { return x * 9; }
+inline int f3203_10(int x) { return x * 10; }
+inline int f3203_11(int x) { return x * 11; }
+inline int f3203_12(int x) { return x * 12; }
+inline int f3203_13(int x) { return x * 13; }
+inline int f3203_14(int x) { return x * 14; }
+inline int f3203_15(int x) { return x * 15; }
+inline int f3203_16(int x) { return x * 16; }
+inline int f3203_17(int x) { return x * 17; }
+inline int f3203_18(int x) { return x * 18; }
+inline int f3203_19(int x) { return x * 19; }
+inline int f3203_20(int x) { return x * 20; }
+inline int f3203_21(int x) { return x * 21; }
+inline int f3203_22(int x) { return x * 22; }
+inline int f3203_23(int x) { return x * 23; }
+inline int f3203_24(int x) { return x * 24; }
+inline int f3203_25(int x) { return x * 25; }
+inline int f3203_26(int x) { return x * 26; }
+inline int f3203_27(int x) { return x * 27; }
+inline int f3203_28(int x) { return x * 28; }
+inline int f3203_29(int x) { return x * 29; }
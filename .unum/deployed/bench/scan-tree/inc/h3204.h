@@ -0,0 +1,42 @@
+#pragma once
+/* header 3204 */
+#include <vector>
+#include "h5500.h"
+#include "h7897.h"
+#include "h929.h"
+#include "h5670.h"
+#include "h9554.h"
+#ifdef X
+#include "h1341.h"
+#endif
+struct S3204 { int a; const char *s = "x//y"; };
+inline int f3204_0(int x) { return x * 0; }
+inline int f3204_1(int x) { return x * 1; }
+inline int f3204_2(int x) { return x * 2; }
+inline int f3204_3(int x) { return x * 3; }
+inline int f3204_4(int x) { return x * 4; }
+inline int f3204_5(int x) { return x * 5; }
+inline int f3204_6(int x) { return x * 6; }
+inline int f3204_7(int x) { return x * 7; }
+inline int f3204_8(int x) { return x * 8; }
+inline int f3204_9(int x) { return x * 9; }
+inline int f3204_10(int x) { return x * 10; }
+inline int f3204_11(int x) { return x * 11; }
+inline int f3204_12(int x) { return x * 12; }
+inline int f3204_13(int x) { return x * 13; }
+inline int f3204_14(int x) { return x * 14; }
+inline int f3204_15(int x) { return x * 15; }
+inline int f3204_16(int x) { return x * 16; }
+inline int f3204_17(int x) { return x * 17; }
+inline int f3204_18(int x) { return x * 18; }
+inline int f3204_19(int x) { return x * 19; }
+inline int f3204_20(int x) { return x * 20; }
+inline int f3204_21(int x) { return x * 21; }
+inline int f3204_22(int x) { return x * 22; }
+inline int f3204_23(int x) { return x * 23; }
+inline int f3204_24(int x) { return x * 24; }
+inline int f3204_25(int x) { return x * 25; }
+inline int f3204_26(int x) { return x * 26; }
+inline int f3204_27(int x) { return x * 27; }
+inline int f3204_28(int x) { return x * 28; }
+inline int f3204_29(int x) { return x * 29; }
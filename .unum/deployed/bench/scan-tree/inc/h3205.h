@@ -0,0 +1,42 @@
+#pragma once
+/* header 3205 */
+#include <vector>
+#include "h8212.h"
+#include "h7702.h"
+#include "h8193.h"
+#include "h2311.h"
+#include "h8016.h"
+#ifdef X
+#include "h1196.h"
+#endif
+struct S3205 { int a; const char *s = "x//y"; };
+inline int f3205_0(int x) { return x * 0; }
+inline int f3205_1(int x) { return x * 1; }
+inline int f3205_2(int x) { return x * 2; }
+inline int f3205_3(int x) { return x * 3; }
+inline int f3205_4(int x) { return x * 4; }
+inline int f3205_5(int x) { return x * 5; }
+inline int f3205_6(int x) { return x * 6; }
+inline int f3205_7(int x) { return x * 7; }
+inline int f3205_8(int x) { return x * 8; }
+inline int f3205_9(int x) { return x * 9; }
+inline int f3205_10(int x) { return x * 10; }
+inline int f3205_11(int x) { return x * 11; }
+inline int f3205_12(int x) { return x * 12; }
+inline int f3205_13(int x) { return x * 13; }
+inline int f3205_14(int x) { return x * 14; }
+inline int f3205_15(int x) { return x * 15; }
+inline int f3205_16(int x) { return x * 16; }
+inline int f3205_17(int x) { return x * 17; }
+inline int f3205_18(int x) { return x * 18; }
+inline int f3205_19(int x) { return x * 19; }
+inline int f3205_20(int x) { return x * 20; }
+inline int f3205_21(int x) { return x * 21; }
+inline int f3205_22(int x) { return x * 22; }
+inline int f3205_23(int x) { return x * 23; }
+inline int f3205_24(int x) { return x * 24; }
+inline int f3205_25(int x) { return x * 25; }
+inline int f3205_26(int x) { return x * 26; }
+inline int f3205_27(int x) { return x * 27; }
+inline int f3205_28(int x) { return x * 28; }
+inline int f3205_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3206 */
+#include <vector>
+#include "h2276.h"
+#include "h7239.h"
+#include "h7233.h"
+#include "h6725.h"
+#include "h8728.h"
+#ifdef X
+#include "h2293.h"
+#endif
+struct S3206 { int a; const char *s = "x//y"; };
+inline int f3206_0(int x) { return x * 0; }
+inline int f3206_1(int x) { return x * 1; }
+inline int f3206_2(int x) { return x * 2; }
+inline int f3206_3(int x) { return x * 3; }
+inline int f3206_4(int x) { return x * 4; }
+inline int f3206_5(int x) { return x * 5; }
+inline int f3206_6(int x) { return x * 6; }
+inline int f3206_7(int x) { return x * 7; }
+inline int f3206_8(int x) { return x * 8; }
+inline int f3206_9(int x) { return x * 9; }
+inline int f3206_10(int x) { return x * 10; }
+inline int f3206_11(int x) { return x * 11; }
+inline int f3206_12(int x) { return x * 12; }
+inline int f3206_13(int x) { return x * 13; }
+inline int f3206_14(int x) { return x * 14; }
+inline int f3206_15(int x) { return x * 15; }
+inline int f3206_16(int x) { return x * 16; }
+inline int f3206_17(int x) { return x * 17; }
+inline int f3206_18(int x) { return x * 18; }
+inline int f3206_19(int x) { return x * 19; }
+inline int f3206_20(int x) { return x * 20; }
+inline int f3206_21(int x) { return x * 21; }
+inline int f3206_22(int x) { return x * 22; }
+inline int f3206_23(int x) { return x * 23; }
+inline int f3206_24(int x) { return x * 24; }
+inline int f3206_25(int x) { return x * 25; }
+inline int f3206_26(int x) { return x * 26; }
+inline int f3206_27(int x) { return x * 27; }
+inline int f3206_28(int x) { return x * 28; }
+inline int f3206_29(int x) { return x * 29; }
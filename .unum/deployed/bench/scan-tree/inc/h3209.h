@@ -0,0 +1,42 @@
+#pragma once
+/* header 3209 */
+#include <vector>
+#include "h3642.h"
+#include "h7601.h"
+#include "h1975.h"
+#include "h8452.h"
+#include "h4578.h"
+#ifdef X
+#include "h1412.h"
+#endif
+struct S3209 { int a; const char *s = "x//y"; };
+inline int f3209_0(int x) { return x * 0; }
+inline int f3209_1(int x) { return x * 1; }
+inline int f3209_2(int x) { return x * 2; }
+inline int f3209_3(int x) { return x * 3; }
+inline int f3209_4(int x) { return x * 4; }
+inline int f3209_5(int x) { return x * 5; }
+inline int f3209_6(int x) { return x * 6; }
+inline int f3209_7(int x) { return x * 7; }
+inline int f3209_8(int x) { return x * 8; }
+inline int f3209_9(int x) { return x * 9; }
+inline int f3209_10(int x) { return x * 10; }
+inline int f3209_11(int x) { return x * 11; }
+inline int f3209_12(int x) { return x * 12; }
+inline int f3209_13(int x) { return x * 13; }
+inline int f3209_14(int x) { return x * 14; }
+inline int f3209_15(int x) { return x * 15; }
+inline int f3209_16(int x) { return x * 16; }
+inline int f3209_17(int x) { return x * 17; }
+inline int f3209_18(int x) { return x * 18; }
+inline int f3209_19(int x) { return x * 19; }
+inline int f3209_20(int x) { return x * 20; }
+inline int f3209_21(int x) { return x * 21; }
+inline int f3209_22(int x) { return x * 22; }
+inline int f3209_23(int x) { return x * 23; }
+inline int f3209_24(int x) { return x * 24; }
+inline int f3209_25(int x) { return x * 25; }
+inline int f3209_26(int x) { return x * 26; }
+inline int f3209_27(int x) { return x * 27; }
+inline int f3209_28(int x) { return x * 28; }
+inline int f3209_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3215 */
+#include <vector>
+#include "h6331.h"
+#include "h6039.h"
+#include "h7944.h"
+#include "h986.h"
+#include "h5984.h"
+#ifdef X
+#include "h6056.h"
+#endif
+struct S3215 { int a; const char *s = "x//y"; };
+inline int f3215_0(int x) { return x * 0; }
+inline int f3215_1(int x) { return x * 1; }
+inline int f3215_2(int x) { return x * 2; }
+inline int f3215_3(int x) { return x * 3; }
+inline int f3215_4(int x) { return x * 4; }
+inline int f3215_5(int x) { return x * 5; }
+inline int f3215_6(int x) { return x * 6; }
+inline int f3215_7(int x) { return x * 7; }
+inline int f3215_8(int x) { return x * 8; }
+inline int f3215_9(int x) { return x * 9; }
+inline int f3215_10(int x) { return x * 10; }
+inline int f3215_11(int x) { return x * 11; }
+inline int f3215_12(int x) { return x * 12; }
+inline int f3215_13(int x) { return x * 13; }
+inline int f3215_14(int x) { return x * 14; }
+inline int f3215_15(int x) { return x * 15; }
+inline int f3215_16(int x) { return x * 16; }
+inline int f3215_17(int x) { return x * 17; }
+inline int f3215_18(int x) { return x * 18; }
+inline int f3215_19(int x) { return x * 19; }
+inline int f3215_20(int x) { return x * 20; }
+inline int f3215_21(int x) { return x * 21; }
+inline int f3215_22(int x) { return x * 22; }
+inline int f3215_23(int x) { return x * 23; }
+inline int f3215_24(int x) { return x * 24; }
+inline int f3215_25(int x) { return x * 25; }
+inline int f3215_26(int x) { return x * 26; }
+inline int f3215_27(int x) { return x * 27; }
+inline int f3215_28(int x) { return x * 28; }
+inline int f3215_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 322 */
+#include <vector>
+#include "h2474.h"
+#include "h8284.h"
+#include "h3954.h"
+#include "h67.h"
+#include "h2831.h"
+#ifdef X
+#include "h2509.h"
+#endif
+struct S322 { int a; const char *s = "x//y"; };
+inline int f322_0(int x) { return x * 0; }
+inline int f322_1(int x) { return x * 1; }
+inline int f322_2(int x) { return x * 2; }
+inline int f322_3(int x) { return x * 3; }
+inline int f322_4(int x) { return x * 4; }
+inline int f322_5(int x) { return x * 5; }
+inline int f322_6(int x) { return x * 6; }
+inline int f322_7(int x) { return x * 7; }
+inline int f322_8(int x) { return x * 8; }
+inline int f322_9(int x) { return x * 9; }
+inline int f322_10(int x) { return x * 10; }
+inline int f322_11(int x) { return x * 11; }
+inline int f322_12(int x) { return x * 12; }
+inline int f322_13(int x) { return x * 13; }
+inline int f322_14(int x) { return x * 14; }
+inline int f322_15(int x) { return x * 15; }
+inline int f322_16(int x) { return x * 16; }
+inline int f322_17(int x) { return x * 17; }
+inline int f322_18(int x) { return x * 18; }
+inline int f322_19(int x) { return x * 19; }
+inline int f322_20(int x) { return x * 20; }
+inline int f322_21(int x) { return x * 21; }
+inline int f322_22(int x) { return x * 22; }
+inline int f322_23(int x) { return x * 23; }
+inline int f322_24(int x) { return x * 24; }
+inline int f322_25(int x) { return x * 25; }
+inline int f322_26(int x) { return x * 26; }
+inline int f322_27(int x) { return x * 27; }
+inline int f322_28(int x) { return x * 28; }
+inline int f322_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3221 */
+#include <vector>
+#include "h1652.h"
+#include "h7185.h"
+#include "h8031.h"
+#include "h2756.h"
+#include "h1427.h"
+#ifdef X
+#include "h1116.h"
+#endif
+struct S3221 { int a; const char *s = "x//y"; };
+inline int f3221_0(int x) { return x * 0; }
+inline int f3221_1(int x) { return x * 1; }
+inline int f3221_2(int x) { return x * 2; }
+inline int f3221_3(int x) { return x * 3; }
+inline int f3221_4(int x) { return x * 4; }
+inline int f3221_5(int x) { return x * 5; }
+inline int f3221_6(int x) { return x * 6; }
+inline int f3221_7(int x) { return x * 7; }
+inline int f3221_8(int x) { return x * 8; }
+inline int f3221_9(int x) { return x * 9; }
+inline int f3221_10(int x) { return x * 10; }
+inline int f3221_11(int x) { return x * 11; }
+inline int f3221_12(int x) { return x * 12; }
+inline int f3221_13(int x) { return x * 13; }
+inline int f3221_14(int x) { return x * 14; }
+inline int f3221_15(int x) { return x * 15; }
+inline int f3221_16(int x) { return x * 16; }
+inline int f3221_17(int x) { return x * 17; }
+inline int f3221_18(int x) { return x * 18; }
+inline int f3221_19(int x) { return x * 19; }
+inline int f3221_20(int x) { return x * 20; }
+inline int f3221_21(int x) { return x * 21; }
+inline int f3221_22(int x) { return x * 22; }
+inline int f3221_23(int x) { return x * 23; }
+inline int f3221_24(int x) { return x * 24; }
+inline int f3221_25(int x) { return x * 25; }
+inline int f3221_26(int x) { return x * 26; }
+inline int f3221_27(int x) { return x * 27; }
+inline int f3221_28(int x) { return x * 28; }
+inline int f3221_29(int x) { return x * 29; }
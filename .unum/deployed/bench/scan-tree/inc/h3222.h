@@ -0,0 +1,42 @@
+#pragma once
+/* header 3222 */
+#include <vector>
+#include "h1573.h"
+#include "h5648.h"
+#include "h331.h"
+#include "h9277.h"
+#include "h5228.h"
+#ifdef X
+#include "h537.h"
+#endif
+struct S3222 { int a; const char *s = "x//y"; };
+inline int f3222_0(int x) { return x * 0; }
+inline int f3222_1(int x) { return x * 1; }
+inline int f3222_2(int x) { return x * 2; }
+inline int f3222_3(int x) { return x * 3; }
+inline int f3222_4(int x) { return x * 4; }
+inline int f3222_5(int x) { return x * 5; }
+inline int f3222_6(int x) { return x * 6; }
+inline int f3222_7(int x) { return x * 7; }
+inline int f3222_8(int x) { return x * 8; }
+inline int f3222_9(int x) { return x * 9; }
+inline int f3222_10(int x) { return x * 10; }
+inline int f3222_11(int x) { return x * 11; }
+inline int f3222_12(int x) { return x * 12; }
+inline int f3222_13(int x) { return x * 13; }
+inline int f3222_14(int x) { return x * 14; }
+inline int f3222_15(int x) { return x * 15; }
+inline int f3222_16(int x) { return x * 16; }
+inline int f3222_17(int x) { return x * 17; }
+inline int f3222_18(int x) { return x * 18; }
+inline int f3222_19(int x) { return x * 19; }
+inline int f3222_20(int x) { return x * 20; }
+inline int f3222_21(int x) { return x * 21; }
+inline int f3222_22(int x) { return x * 22; }
+inline int f3222_23(int x) { return x * 23; }
+inline int f3222_24(int x) { return x * 24; }
+inline int f3222_25(int x) { return x * 25; }
+inline int f3222_26(int x) { return x * 26; }
+inline int f3222_27(int x) { return x * 27; }
+inline int f3222_28(int x) { return x * 28; }
+inline int f3222_29(int x) { return x * 29; }
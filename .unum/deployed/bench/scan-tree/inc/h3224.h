@@ -0,0 +1,42 @@
+#pragma once
+/* header 3224 */
+#include <vector>
+#include "h23.h"
+#include "h222.h"
+#include "h9915.h"
+#include "h9318.h"
+#include "h7149.h"
+#ifdef X
+#include "h2031.h"
+#endif
+struct S3224 { int a; const char *s = "x//y"; };
+inline int f3224_0(int x) { return x * 0; }
+inline int f3224_1(int x) { return x * 1; }
+inline int f3224_2(int x) { return x * 2; }
+inline int f3224_3(int x) { return x * 3; }
+inline int f3224_4(int x) { return x * 4; }
+inline int f3224_5(int x) { return x * 5; }
+inline int f3224_6(int x) { return x * 6; }
+inline int f3224_7(int x) { return x * 7; }
+inline int f3224_8(int x) { return x * 8; }
+inline int f3224_9(int x) { return x * 9; }
+inline int f3224_10(int x) { return x * 10; }
+inline int f3224_11(int x) { return x * 11; }
+inline int f3224_12(int x) { return x * 12; }
+inline int f3224_13(int x) { return x * 13; }
+inline int f3224_14(int x) { return x * 14; }
+inline int f3224_15(int x) { return x * 15; }
+inline int f3224_16(int x) { return x * 16; }
+inline int f3224_17(int x) { return x * 17; }
+inline int f3224_18(int x) { return x * 18; }
+inline int f3224_19(int x) { return x * 19; }
+inline int f3224_20(int x) { return x * 20; }
+inline int f3224_21(int x) { return x * 21; }
+inline int f3224_22(int x) { return x * 22; }
+inline int f3224_23(int x) { return x * 23; }
+inline int f3224_24(int x) { return x * 24; }
+inline int f3224_25(int x) { return x * 25; }
+inline int f3224_26(int x) { return x * 26; }
+inline int f3224_27(int x) { return x * 27; }
+inline int f3224_28(int x) { return x * 28; }
+inline int f3224_29(int x) { return x * 29; }
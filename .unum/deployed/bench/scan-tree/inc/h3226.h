@@ -0,0 +1,42 @@
+#pragma once
+/* header 3226 */
+#include <vector>
+#include "h3409.h"
+#include "h7286.h"
+#include "h1528.h"
+#include "h9146.h"
+#include "h958.h"
+#ifdef X
+#include "h2117.h"
+#endif
+struct S3226 { int a; const char *s = "x//y"; };
+inline int f3226_0(int x) { return x * 0; }
+inline int f3226_1(int x) { return x * 1; }
+inline int f3226_2(int x) { return x * 2; }
+inline int f3226_3(int x) { return x * 3; }
+inline int f3226_4(int x) { return x * 4; }
+inline int f3226_5(int x) { return x * 5; }
+inline int f3226_6(int x) { return x * 6; }
+inline int f3226_7(int x) { return x * 7; }
+inline int f3226_8(int x) { return x * 8; }
+inline int f3226_9(int x) { return x * 9; }
+inline int f3226_10(int x) { return x * 10; }
+inline int f3226_11(int x) { return x * 11; }
+inline int f3226_12(int x) { return x * 12; }
+inline int f3226_13(int x) { return x * 13; }
+inline int f3226_14(int x) { return x * 14; }
+inline int f3226_15(int x) { return x * 15; }
+inline int f3226_16(int x) { return x * 16; }
+inline int f3226_17(int x) { return x * 17; }
+inline int f3226_18(int x) { return x * 18; }
+inline int f3226_19(int x) { return x * 19; }
+inline int f3226_20(int x) { return x * 20; }
+inline int f3226_21(int x) { return x * 21; }
+inline int f3226_22(int x) { return x * 22; }
+inline int f3226_23(int x) { return x * 23; }
+inline int f3226_24(int x) { return x * 24; }
+inline int f3226_25(int x) { return x * 25; }
+inline int f3226_26(int x) { return x * 26; }
+inline int f3226_27(int x) { return x * 27; }
+inline int f3226_28(int x) { return x * 28; }
+inline int f3226_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3231 */
+#include <vector>
+#include "h3059.h"
+#include "h8026.h"
+#include "h3762.h"
+#include "h5550.h"
+#include "h7129.h"
+#ifdef X
+#include "h2378.h"
+#endif
+struct S3231 { int a; const char *s = "x//y"; };
+inline int f3231_0(int x) { return x * 0; }
+inline int f3231_1(int x) { return x * 1; }
+inline int f3231_2(int x) { return x * 2; }
+inline int f3231_3(int x) { return x * 3; }
+inline int f3231_4(int x) { return x * 4; }
+inline int f3231_5(int x) { return x * 5; }
+inline int f3231_6(int x) { return x * 6; }
+inline int f3231_7(int x) { return x * 7; }
+inline int f3231_8(int x) { return x * 8; }
+inline int f3231_9(int x) { return x * 9; }
+inline int f3231_10(int x) { return x * 10; }
+inline int f3231_11(int x) { return x * 11; }
+inline int f3231_12(int x) { return x * 12; }
+inline int f3231_13(int x) { return x * 13; }
+inline int f3231_14(int x) { return x * 14; }
+inline int f3231_15(int x) { return x * 15; }
+inline int f3231_16(int x) { return x * 16; }
+inline int f3231_17(int x) { return x * 17; }
+inline int f3231_18(int x) { return x * 18; }
+inline int f3231_19(int x) { return x * 19; }
+inline int f3231_20(int x) { return x * 20; }
+inline int f3231_21(int x) { return x * 21; }
+inline int f3231_22(int x) { return x * 22; }
+inline int f3231_23(int x) { return x * 23; }
+inline int f3231_24(int x) { return x * 24; }
+inline int f3231_25(int x) { return x * 25; }
+inline int f3231_26(int x) { return x * 26; }
+inline int f3231_27(int x) { return x * 27; }
+inline int f3231_28(int x) { return x * 28; }
+inline int f3231_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3233 */
+#include <vector>
+#include "h1000.h"
+#include "h6273.h"
+#include "h2795.h"
+#include "h4781.h"
+#include "h727.h"
+#ifdef X
+#include "h9612.h"
+#endif
+struct S3233 { int a; const char *s = "x//y"; };
+inline int f3233_0(int x) { return x * 0; }
+inline int f3233_1(int x) { return x * 1; }
+inline int f3233_2(int x) { return x * 2; }
+inline int f3233_3(int x) { return x * 3; }
+inline int f3233_4(int x) { return x * 4; }
+inline int f3233_5(int x) { return x * 5; }
+inline int f3233_6(int x) { return x * 6; }
+inline int f3233_7(int x) { return x * 7; }
+inline int f3233_8(int x) { return x * 8; }
+inline int f3233_9(int x) { return x * 9; }
+inline int f3233_10(int x) { return x * 10; }
+inline int f3233_11(int x) { return x * 11; }
+inline int f3233_12(int x) { return x * 12; }
+inline int f3233_13(int x) { return x * 13; }
+inline int f3233_14(int x) { return x * 14; }
+inline int f3233_15(int x) { return x * 15; }
+inline int f3233_16(int x) { return x * 16; }
+inline int f3233_17(int x) { return x * 17; }
+inline int f3233_18(int x) { return x * 18; }
+inline int f3233_19(int x) { return x * 19; }
+inline int f3233_20(int x) { return x * 20; }
+inline int f3233_21(int x) { return x * 21; }
+inline int f3233_22(int x) { return x * 22; }
+inline int f3233_23(int x) { return x * 23; }
+inline int f3233_24(int x) { return x * 24; }
+inline int f3233_25(int x) { return x * 25; }
+inline int f3233_26(int x) { return x * 26; }
+inline int f3233_27(int x) { return x * 27; }
+inline int f3233_28(int x) { return x * 28; }
+inline int f3233_29(int x) { return x * 29; }
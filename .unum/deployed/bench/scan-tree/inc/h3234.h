@@ -0,0 +1,42 @@
+#pragma once
+/* header 3234 */
+#include <vector>
+#include "h8377.h"
+#include "h7.h"
+#include "h1793.h"
+#include "h8589.h"
+#include "h7605.h"
+#ifdef X
+#include "h2049.h"
+#endif
+struct S3234 { int a; const char *s = "x//y"; };
+inline int f3234_0(int x) { return x * 0; }
+inline int f3234_1(int x) { return x * 1; }
+inline int f3234_2(int x) { return x * 2; }
+inline int f3234_3(int x) { return x * 3; }
+inline int f3234_4(int x) { return x * 4; }
+inline int f3234_5(int x) { return x * 5; }
+inline int f3234_6(int x) { return x * 6; }
+inline int f3234_7(int x) { return x * 7; }
+inline int f3234_8(int x) { return x * 8; }
+inline int f3234_9(int x) { return x * 9; }
+inline int f3234_10(int x) { return x * 10; }
+inline int f3234_11(int x) { return x * 11; }
+inline int f3234_12(int x) { return x * 12; }
+inline int f3234_13(int x) { return x * 13; }
+inline int f3234_14(int x) { return x * 14; }
+inline int f3234_15(int x) { return x * 15; }
+inline int f3234_16(int x) { return x * 16; }
+inline int f3234_17(int x) { return x * 17; }
+inline int f3234_18(int x) { return x * 18; }
+inline int f3234_19(int x) { return x * 19; }
+inline int f3234_20(int x) { return x * 20; }
+inline int f3234_21(int x) { return x * 21; }
+inline int f3234_22(int x) { return x * 22; }
+inline int f3234_23(int x) { return x * 23; }
+inline int f3234_24(int x) { return x * 24; }
+inline int f3234_25(int x) { return x * 25; }
+inline int f3234_26(int x) { return x * 26; }
+inline int f3234_27(int x) { return x * 27; }
+inline int f3234_28(int x) { return x * 28; }
+inline int f3234_29(int x) { return x * 29; }
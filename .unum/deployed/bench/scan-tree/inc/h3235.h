@@ -0,0 +1,42 @@
+#pragma once
+/* header 3235 */
+#include <vector>
+#include "h4236.h"
+#include "h5879.h"
+#include "h4092.h"
+#include "h3254.h"
+#include "h7471.h"
+#ifdef X
+#include "h6447.h"
+#endif
+struct S3235 { int a; const char *s = "x//y"; };
+inline int f3235_0(int x) { return x * 0; }
+inline int f3235_1(int x) { return x * 1; }
+inline int f3235_2(int x) { return x * 2; }
+inline int f3235_3(int x) { return x * 3; }
+inline int f3235_4(int x) { return x * 4; }
+inline int f3235_5(int x) { return x * 5; }
+inline int f3235_6(int x) { return x * 6; }
+inline int f3235_7(int x) { return x * 7; }
+inline int f3235_8(int x) { return x * 8; }
+inline int f3235_9(int x) { return x * 9; }
+inline int f3235_10(int x) { return x * 10; }
+inline int f3235_11(int x) { return x * 11; }
+inline int f3235_12(int x) { return x * 12; }
+inline int f3235_13(int x) { return x * 13; }
+inline int f3235_14(int x) { return x * 14; }
+inline int f3235_15(int x) { return x * 15; }
+inline int f3235_16(int x) { return x * 16; }
+inline int f3235_17(int x) { return x * 17; }
+inline int f3235_18(int x) { return x * 18; }
+inline int f3235_19(int x) { return x * 19; }
+inline int f3235_20(int x) { return x * 20; }
+inline int f3235_21(int x) { return x * 21; }
+inline int f3235_22(int x) { return x * 22; }
+inline int f3235_23(int x) { return x * 23; }
+inline int f3235_24(int x) { return x * 24; }
+inline int f3235_25(int x) { return x * 25; }
+inline int f3235_26(int x) { return x * 26; }
+inline int f3235_27(int x) { return x * 27; }
+inline int f3235_28(int x) { return x * 28; }
+inline int f3235_29(int x) { return x * 29; }
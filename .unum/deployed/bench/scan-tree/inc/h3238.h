@@ -0,0 +1,42 @@
+#pragma once
+/* header 3238 */
+#include <vector>
+#include "h1752.h"
+#include "h3259.h"
+#include "h2779.h"
+#include "h3746.h"
+#include "h185.h"
+#ifdef X
+#include "h124.h"
+#endif
+struct S3238 { int a; const char *s = "x//y"; };
+inline int f3238_0(int x) { return x * 0; }
+inline int f3238_1(int x) { return x * 1; }
+inline int f3238_2(int x) { return x * 2; }
+inline int f3238_3(int x) { return x * 3; }
+inline int f3238_4(int x) { return x * 4; }
+inline int f3238_5(int x) { return x * 5; }
+inline int f3238_6(int x) { return x * 6; }
+inline int f3238_7(int x) { return x * 7; }
+inline int f3238_8(int x) { return x * 8; }
+inline int f3238_9(int x) { return x * 9; }
+inline int f3238_10(int x) { return x * 10; }
+inline int f3238_11(int x) { return x * 11; }
+inline int f3238_12(int x) { return x * 12; }
+inline int f3238_13(int x) { return x * 13; }
+inline int f3238_14(int x) { return x * 14; }
+inline int f3238_15(int x) { return x * 15; }
+inline int f3238_16(int x) { return x * 16; }
+inline int f3238_17(int x) { return x * 17; }
+inline int f3238_18(int x) { return x * 18; }
+inline int f3238_19(int x) { return x * 19; }
+inline int f3238_20(int x) { return x * 20; }
+inline int f3238_21(int x) { return x * 21; }
+inline int f3238_22(int x) { return x * 22; }
+inline int f3238_23(int x) { return x * 23; }
+inline int f3238_24(int x) { return x * 24; }
+inline int f3238_25(int x) { return x * 25; }
+inline int f3238_26(int x) { return x * 26; }
+inline int f3238_27(int x) { return x * 27; }
+inline int f3238_28(int x) { return x * 28; }
+inline int f3238_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3240 */
+#include <vector>
+#include "h9795.h"
+#include "h7261.h"
+#include "h1884.h"
+#include "h9312.h"
+#include "h5001.h"
+#ifdef X
+#include "h5249.h"
+#endif
+struct S3240 { int a; const char *s = "x//y"; };
+inline int f3240_0(int x) { return x * 0; }
+inline int f3240_1(int x) { return x * 1; }
+inline int f3240_2(int x) { return x * 2; }
+inline int f3240_3(int x) { return x * 3; }
+inline int f3240_4(int x) { return x * 4; }
+inline int f3240_5(int x) { return x * 5; }
+inline int f3240_6(int x) { return x * 6; }
+inline int f3240_7(int x) { return x * 7; }
+inline int f3240_8(int x) { return x * 8; }
+inline int f3240_9(int x) { return x * 9; }
+inline int f3240_10(int x) { return x * 10; }
+inline int f3240_11(int x) { return x * 11; }
+inline int f3240_12(int x) { return x * 12; }
+inline int f3240_13(int x) { return x * 13; }
+inline int f3240_14(int x) { return x * 14; }
+inline int f3240_15(int x) { return x * 15; }
+inline int f3240_16(int x) { return x * 16; }
+inline int f3240_17(int x) { return x * 17; }
+inline int f3240_18(int x) { return x * 18; }
+inline int f3240_19(int x) { return x * 19; }
+inline int f3240_20(int x) { return x * 20; }
+inline int f3240_21(int x) { return x * 21; }
+inline int f3240_22(int x) { return x * 22; }
+inline int f3240_23(int x) { return x * 23; }
+inline int f3240_24(int x) { return x * 24; }
+inline int f3240_25(int x) { return x * 25; }
+inline int f3240_26(int x) { return x * 26; }
+inline int f3240_27(int x) { return x * 27; }
+inline int f3240_28(int x) { return x * 28; }
+inline int f3240_29(int x) { return x * 29; }
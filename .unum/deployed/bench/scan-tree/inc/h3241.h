@@ -0,0 +1,42 @@
+#pragma once
+/* header 3241 */
+#include <vector>
+#include "h9066.h"
+#include "h6802.h"
+#include "h6526.h"
+#include "h7996.h"
+#include "h794.h"
+#ifdef X
+#include "h8954.h"
+#endif
+struct S3241 { int a; const char *s = "x//y"; };
+inline int f3241_0(int x) { return x * 0; }
+inline int f3241_1(int x) { return x * 1; }
+inline int f3241_2(int x) { return x * 2; }
+inline int f3241_3(int x) { return x * 3; }
+inline int f3241_4(int x) { return x * 4; }
+inline int f3241_5(int x) { return x * 5; }
+inline int f3241_6(int x) { return x * 6; }
+inline int f3241_7(int x) { return x * 7; }
+inline int f3241_8(int x) { return x * 8; }
+inline int f3241_9(int x) { return x * 9; }
+inline int f3241_10(int x) { return x * 10; }
+inline int f3241_11(int x) { return x * 11; }
+inline int f3241_12(int x) { return x * 12; }
+inline int f3241_13(int x) { return x * 13; }
+inline int f3241_14(int x) { return x * 14; }
+inline int f3241_15(int x) { return x * 15; }
+inline int f3241_16(int x) { return x * 16; }
+inline int f3241_17(int x) { return x * 17; }
+inline int f3241_18(int x) { return x * 18; }
+inline int f3241_19(int x) { return x * 19; }
+inline int f3241_20(int x) { return x * 20; }
+inline int f3241_21(int x) { return x * 21; }
+inline int f3241_22(int x) { return x * 22; }
+inline int f3241_23(int x) { return x * 23; }
+inline int f3241_24(int x) { return x * 24; }
+inline int f3241_25(int x) { return x * 25; }
+inline int f3241_26(int x) { return x * 26; }
+inline int f3241_27(int x) { return x * 27; }
+inline int f3241_28(int x) { return x * 28; }
+inline int f3241_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3242 */
+#include <vector>
+#include "h262.h"
+#include "h9489.h"
+#include "h9464.h"
+#include "h9602.h"
+#include "h8438.h"
+#ifdef X
+#include "h5979.h"
+#endif
+struct S3242 { int a; const char *s = "x//y"; };
+inline int f3242_0(int x) { return x * 0; }
+inline int f3242_1(int x) { return x * 1; }
+inline int f3242_2(int x) { return x * 2; }
+inline int f3242_3(int x) { return x * 3; }
+inline int f3242_4(int x) { return x * 4; }
+inline int f3242_5(int x) { return x * 5; }
+inline int f3242_6(int x) { return x * 6; }
+inline int f3242_7(int x) { return x * 7; }
+inline int f3242_8(int x) { return x * 8; }
+inline int f3242_9(int x) { return x * 9; }
+inline int f3242_10(int x) { return x * 10; }
+inline int f3242_11(int x) { return x * 11; }
+inline int f3242_12(int x) { return x * 12; }
+inline int f3242_13(int x) { return x * 13; }
+inline int f3242_14(int x) { return x * 14; }
+inline int f3242_15(int x) { return x * 15; }
+inline int f3242_16(int x) { return x * 16; }
+inline int f3242_17(int x) { return x * 17; }
+inline int f3242_18(int x) { return x * 18; }
+inline int f3242_19(int x) { return x * 19; }
+inline int f3242_20(int x) { return x * 20; }
+inline int f3242_21(int x) { return x * 21; }
+inline int f3242_22(int x) { return x * 22; }
+inline int f3242_23(int x) { return x * 23; }
+inline int f3242_24(int x) { return x * 24; }
+inline int f3242_25(int x) { return x * 25; }
+inline int f3242_26(int x) { return x * 26; }
+inline int f3242_27(int x) { return x * 27; }
+inline int f3242_28(int x) { return x * 28; }
+inline int f3242_29(int x) { return x * 29; }
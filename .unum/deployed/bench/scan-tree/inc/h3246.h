@@ -0,0 +1,42 @@
+#pragma once
+/* header 3246 */
+#include <vector>
+#include "h9586.h"
+#include "h6492.h"
+#include "h5536.h"
+#include "h5175.h"
+#include "h9326.h"
+#ifdef X
+#include "h2631.h"
+#endif
+struct S3246 { int a; const char *s = "x//y"; };
+inline int f3246_0(int x) { return x * 0; }
+inline int f3246_1(int x) { return x * 1; }
+inline int f3246_2(int x) { return x * 2; }
+inline int f3246_3(int x) { return x * 3; }
+inline int f3246_4(int x) { return x * 4; }
+inline int f3246_5(int x) { return x * 5; }
+inline int f3246_6(int x) { return x * 6; }
+inline int f3246_7(int x) { return x * 7; }
+inline int f3246_8(int x) { return x * 8; }
+inline int f3246_9(int x) { return x * 9; }
+inline int f3246_10(int x) { return x * 10; }
+inline int f3246_11(int x) { return x * 11; }
+inline int f3246_12(int x) { return x * 12; }
+inline int f3246_13(int x) { return x * 13; }
+inline int f3246_14(int x) { return x * 14; }
+inline int f3246_15(int x) { return x * 15; }
+inline int f3246_16(int x) { return x * 16; }
+inline int f3246_17(int x) { return x * 17; }
+inline int f3246_18(int x) { return x * 18; }
+inline int f3246_19(int x) { return x * 19; }
+inline int f3246_20(int x) { return x * 20; }
+inline int f3246_21(int x) { return x * 21; }
+inline int f3246_22(int x) { return x * 22; }
+inline int f3246_23(int x) { return x * 23; }
+inline int f3246_24(int x) { return x * 24; }
+inline int f3246_25(int x) { return x * 25; }
+inline int f3246_26(int x) { return x * 26; }
+inline int f3246_27(int x) { return x * 27; }
+inline int f3246_28(int x) { return x * 28; }
+inline int f3246_29(int x) { return x * 29; }
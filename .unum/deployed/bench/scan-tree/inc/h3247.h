@@ -0,0 +1,42 @@
+#pragma once
+/* header 3247 */
+#include <vector>
+#include "h4215.h"
+#include "h3226.h"
+#include "h5436.h"
+#include "h5062.h"
+#include "h6416.h"
+#ifdef X
+#include "h3092.h"
+#endif
+struct S3247 { int a; const char *s = "x//y"; };
+inline int f3247_0(int x) { return x * 0; }
+inline int f3247_1(int x) { return x * 1; }
+inline int f3247_2(int x) { return x * 2; }
+inline int f3247_3(int x) { return x * 3; }
+inline int f3247_4(int x) { return x * 4; }
+inline int f3247_5(int x) { return x * 5; }
+inline int f3247_6(int x) { return x * 6; }
+inline int f3247_7(int x) { return x * 7; }
+inline int f3247_8(int x) { return x * 8; }
+inline int f3247_9(int x) { return x * 9; }
+inline int f3247_10(int x) { return x * 10; }
+inline int f3247_11(int x) { return x * 11; }
+inline int f3247_12(int x) { return x * 12; }
+inline int f3247_13(int x) { return x * 13; }
+inline int f3247_14(int x) { return x * 14; }
+inline int f3247_15(int x) { return x * 15; }
+inline int f3247_16(int x) { return x * 16; }
+inline int f3247_17(int x) { return x * 17; }
+inline int f3247_18(int x) { return x * 18; }
+inline int f3247_19(int x) { return x * 19; }
+inline int f3247_20(int x) { return x * 20; }
+inline int f3247_21(int x) { return x * 21; }
+inline int f3247_22(int x) { return x * 22; }
+inline int f3247_23(int x) { return x * 23; }
+inline int f3247_24(int x) { return x * 24; }
+inline int f3247_25(int x) { return x * 25; }
+inline int f3247_26(int x) { return x * 26; }
+inline int f3247_27(int x) { return x * 27; }
+inline int f3247_28(int x) { return x * 28; }
+inline int f3247_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3248 */
+#include <vector>
+#include "h8196.h"
+#include "h1876.h"
+#include "h1777.h"
+#include "h6721.h"
+#include "h2745.h"
+#ifdef X
+#include "h4960.h"
+#endif
+struct S3248 { int a; const char *s = "x//y"; };
+inline int f3248_0(int x) { return x * 0; }
+inline int f3248_1(int x) { return x * 1; }
+inline int f3248_2(int x) { return x * 2; }
+inline int f3248_3(int x) { return x * 3; }
+inline int f3248_4(int x) { return x * 4; }
+inline int f3248_5(int x) { return x * 5; }
+inline int f3248_6(int x) { return x * 6; }
+inline int f3248_7(int x) { return x * 7; }
+inline int f3248_8(int x) { return x * 8; }
+inline int f3248_9(int x) { return x * 9; }
+inline int f3248_10(int x) { return x * 10; }
+inline int f3248_11(int x) { return x * 11; }
+inline int f3248_12(int x) { return x * 12; }
+inline int f3248_13(int x) { return x * 13; }
+inline int f3248_14(int x) { return x * 14; }
+inline int f3248_15(int x) { return x * 15; }
+inline int f3248_16(int x) { return x * 16; }
+inline int f3248_17(int x) { return x * 17; }
+inline int f3248_18(int x) { return x * 18; }
+inline int f3248_19(int x) { return x * 19; }
+inline int f3248_20(int x) { return x * 20; }
+inline int f3248_21(int x) { return x * 21; }
+inline int f3248_22(int x) { return x * 22; }
+inline int f3248_23(int x) { return x * 23; }
+inline int f3248_24(int x) { return x * 24; }
+inline int f3248_25(int x) { return x * 25; }
+inline int f3248_26(int x) { return x * 26; }
+inline int f3248_27(int x) { return x * 27; }
+inline int f3248_28(int x) { return x * 28; }
+inline int f3248_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3250 */
+#include <vector>
+#include "h4709.h"
+#include "h8204.h"
+#include "h5713.h"
+#include "h574.h"
+#include "h9442.h"
+#ifdef X
+#include "h8511.h"
+#endif
+struct S3250 { int a; const char *s = "x//y"; };
+inline int f3250_0(int x) { return x * 0; }
+inline int f3250_1(int x) { return x * 1; }
+inline int f3250_2(int x) { return x * 2; }
+inline int f3250_3(int x) { return x * 3; }
+inline int f3250_4(int x) { return x * 4; }
+inline int f3250_5(int x) { return x * 5; }
+inline int f3250_6(int x) { return x * 6; }
+inline int f3250_7(int x) { return x * 7; }
+inline int f3250_8(int x) { return x * 8; }
+inline int f3250_9(int x) { return x * 9; }
+inline int f3250_10(int x) { return x * 10; }
+inline int f3250_11(int x) { return x * 11; }
+inline int f3250_12(int x) { return x * 12; }
+inline int f3250_13(int x) { return x * 13; }
+inline int f3250_14(int x) { return x * 14; }
+inline int f3250_15(int x) { return x * 15; }
+inline int f3250_16(int x) { return x * 16; }
+inline int f3250_17(int x) { return x * 17; }
+inline int f3250_18(int x) { return x * 18; }
+inline int f3250_19(int x) { return x * 19; }
+inline int f3250_20(int x) { return x * 20; }
+inline int f3250_21(int x) { return x * 21; }
+inline int f3250_22(int x) { return x * 22; }
+inline int f3250_23(int x) { return x * 23; }
+inline int f3250_24(int x) { return x * 24; }
+inline int f3250_25(int x) { return x * 25; }
+inline int f3250_26(int x) { return x * 26; }
+inline int f3250_27(int x) { return x * 27; }
+inline int f3250_28(int x) { return x * 28; }
+inline int f3250_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3251 */
+#include <vector>
+#include "h2031.h"
+#include "h435.h"
+#include "h1352.h"
+#include "h8465.h"
+#include "h2718.h"
+#ifdef X
+#include "h4308.h"
+#endif
+struct S3251 { int a; const char *s = "x//y"; };
+inline int f3251_0(int x) { return x * 0; }
+inline int f3251_1(int x) { return x * 1; }
+inline int f3251_2(int x) { return x * 2; }
+inline int f3251_3(int x) { return x * 3; }
+inline int f3251_4(int x) { return x * 4; }
+inline int f3251_5(int x) { return x * 5; }
+inline int f3251_6(int x) { return x * 6; }
+inline int f3251_7(int x) { return x * 7; }
+inline int f3251_8(int x) { return x * 8; }
+inline int f3251_9(int x) { return x * 9; }
+inline int f3251_10(int x) { return x * 10; }
+inline int f3251_11(int x) { return x * 11; }
+inline int f3251_12(int x) { return x * 12; }
+inline int f3251_13(int x) { return x * 13; }
+inline int f3251_14(int x) { return x * 14; }
+inline int f3251_15(int x) { return x * 15; }
+inline int f3251_16(int x) { return x * 16; }
+inline int f3251_17(int x) { return x * 17; }
+inline int f3251_18(int x) { return x * 18; }
+inline int f3251_19(int x) { return x * 19; }
+inline int f3251_20(int x) { return x * 20; }
+inline int f3251_21(int x) { return x * 21; }
+inline int f3251_22(int x) { return x * 22; }
+inline int f3251_23(int x) { return x * 23; }
+inline int f3251_24(int x) { return x * 24; }
+inline int f3251_25(int x) { return x * 25; }
+inline int f3251_26(int x) { return x * 26; }
+inline int f3251_27(int x) { return x * 27; }
+inline int f3251_28(int x) { return x * 28; }
+inline int f3251_29(int x) { return x * 29; }
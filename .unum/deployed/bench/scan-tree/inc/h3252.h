@@ -0,0 +1,42 @@
+#pragma once
+/* header 3252 */
+#include <vector>
+#include "h2095.h"
+#include "h2959.h"
+#include "h3747.h"
+#include "h4007.h"
+#include "h7527.h"
+#ifdef X
+#include "h5191.h"
+#endif
+struct S3252 { int a; const char *s = "x//y"; };
+inline int f3252_0(int x) { return x * 0; }
+inline int f3252_1(int x) { return x * 1; }
+inline int f3252_2(int x) { return x * 2; }
+inline int f3252_3(int x) { return x * 3; }
+inline int f3252_4(int x) { return x * 4; }
+inline int f3252_5(int x) { return x * 5; }
+inline int f3252_6(int x) { return x * 6; }
+inline int f3252_7(int x) { return x * 7; }
+inline int f3252_8(int x) { return x * 8; }
+inline int f3252_9(int x) { return x * 9; }
+inline int f3252_10(int x) { return x * 10; }
+inline int f3252_11(int x) { return x * 11; }
+inline int f3252_12(int x) { return x * 12; }
+inline int f3252_13(int x) { return x * 13; }
+inline int f3252_14(int x) { return x * 14; }
+inline int f3252_15(int x) { return x * 15; }
+inline int f3252_16(int x) { return x * 16; }
+inline int f3252_17(int x) { return x * 17; }
+inline int f3252_18(int x) { return x * 18; }
+inline int f3252_19(int x) { return x * 19; }
+inline int f3252_20(int x) { return x * 20; }
+inline int f3252_21(int x) { return x * 21; }
+inline int f3252_22(int x) { return x * 22; }
+inline int f3252_23(int x) { return x * 23; }
+inline int f3252_24(int x) { return x * 24; }
+inline int f3252_25(int x) { return x * 25; }
+inline int f3252_26(int x) { return x * 26; }
+inline int f3252_27(int x) { return x * 27; }
+inline int f3252_28(int x) { return x * 28; }
+inline int f3252_29(int x) { return x * 29; }
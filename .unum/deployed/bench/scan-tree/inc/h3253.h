@@ -0,0 +1,42 @@
+#pragma once
+/* header 3253 */
+#include <vector>
+#include "h6050.h"
+#include "h8774.h"
+#include "h7251.h"
+#include "h3216.h"
+#include "h6421.h"
+#ifdef X
+#include "h945.h"
+#endif
+struct S3253 { int a; const char *s = "x//y"; };
+inline int f3253_0(int x) { return x * 0; }
+inline int f3253_1(int x) { return x * 1; }
+inline int f3253_2(int x) { return x * 2; }
+inline int f3253_3(int x) { return x * 3; }
+inline int f3253_4(int x) { return x * 4; }
+inline int f3253_5(int x) { return x * 5; }
+inline int f3253_6(int x) { return x * 6; }
+inline int f3253_7(int x) { return x * 7; }
+inline int f3253_8(int x) { return x * 8; }
+inline int f3253_9(int x) { return x * 9; }
+inline int f3253_10(int x) { return x * 10; }
+inline int f3253_11(int x) { return x * 11; }
+inline int f3253_12(int x) { return x * 12; }
+inline int f3253_13(int x) { return x * 13; }
+inline int f3253_14(int x) { return x * 14; }
+inline int f3253_15(int x) { return x * 15; }
+inline int f3253_16(int x) { return x * 16; }
+inline int f3253_17(int x) { return x * 17; }
+inline int f3253_18(int x) { return x * 18; }
+inline int f3253_19(int x) { return x * 19; }
+inline int f3253_20(int x) { return x * 20; }
+inline int f3253_21(int x) { return x * 21; }
+inline int f3253_22(int x) { return x * 22; }
+inline int f3253_23(int x) { return x * 23; }
+inline int f3253_24(int x) { return x * 24; }
+inline int f3253_25(int x) { return x * 25; }
+inline int f3253_26(int x) { return x * 26; }
+inline int f3253_27(int x) { return x * 27; }
+inline int f3253_28(int x) { return x * 28; }
+inline int f3253_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3257 */
+#include <vector>
+#include "h1657.h"
+#include "h4337.h"
+#include "h4771.h"
+#include "h3554.h"
+#include "h6394.h"
+#ifdef X
+#include "h7378.h"
+#endif
+struct S3257 { int a; const char *s = "x//y"; };
+inline int f3257_0(int x) { return x * 0; }
+inline int f3257_1(int x) { return x * 1; }
+inline int f3257_2(int x) { return x * 2; }
+inline int f3257_3(int x) { return x * 3; }
+inline int f3257_4(int x) { return x * 4; }
+inline int f3257_5(int x) { return x * 5; }
+inline int f3257_6(int x) { return x * 6; }
+inline int f3257_7(int x) { return x * 7; }
+inline int f3257_8(int x) { return x * 8; }
+inline int f3257_9(int x) { return x * 9; }
+inline int f3257_10(int x) { return x * 10; }
+inline int f3257_11(int x) { return x * 11; }
+inline int f3257_12(int x) { return x * 12; }
+inline int f3257_13(int x) { return x * 13; }
+inline int f3257_14(int x) { return x * 14; }
+inline int f3257_15(int x) { return x * 15; }
+inline int f3257_16(int x) { return x * 16; }
+inline int f3257_17(int x) { return x * 17; }
+inline int f3257_18(int x) { return x * 18; }
+inline int f3257_19(int x) { return x * 19; }
+inline int f3257_20(int x) { return x * 20; }
+inline int f3257_21(int x) { return x * 21; }
+inline int f3257_22(int x) { return x * 22; }
+inline int f3257_23(int x) { return x * 23; }
+inline int f3257_24(int x) { return x * 24; }
+inline int f3257_25(int x) { return x * 25; }
+inline int f3257_26(int x) { return x * 26; }
+inline int f3257_27(int x) { return x * 27; }
+inline int f3257_28(int x) { return x * 28; }
+inline int f3257_29(int x) { return x * 29; }
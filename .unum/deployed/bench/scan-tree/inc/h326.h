@@ -0,0 +1,42 @@
+#pragma once
+/* header 326 */
+#include <vector>
+#include "h4740.h"
+#include "h4995.h"
+#include "h1260.h"
+#include "h4412.h"
+#include "h6865.h"
+#ifdef X
+#include "h7135.h"
+#endif
+struct S326 { int a; const char *s = "x//y"; };
+inline int f326_0(int x) { return x * 0; }
+inline int f326_1(int x) { return x * 1; }
+inline int f326_2(int x) { return x * 2; }
+inline int f326_3(int x) { return x * 3; }
+inline int f326_4(int x) { return x * 4; }
+inline int f326_5(int x) { return x * 5; }
+inline int f326_6(int x) { return x * 6; }
+inline int f326_7(int x) { return x * 7; }
+inline int f326_8(int x) { return x * 8; }
+inline int f326_9(int x) { return x * 9; }
+inline int f326_10(int x) { return x * 10; }
+inline int f326_11(int x) { return x * 11; }
+inline int f326_12(int x) { return x * 12; }
+inline int f326_13(int x) { return x * 13; }
+inline int f326_14(int x) { return x * 14; }
+inline int f326_15(int x) { return x * 15; }
+inline int f326_16(int x) { return x * 16; }
+inline int f326_17(int x) { return x * 17; }
+inline int f326_18(int x) { return x * 18; }
+inline int f326_19(int x) { return x * 19; }
+inline int f326_20(int x) { return x * 20; }
+inline int f326_21(int x) { return x * 21; }
+inline int f326_22(int x) { return x * 22; }
+inline int f326_23(int x) { return x * 23; }
+inline int f326_24(int x) { return x * 24; }
+inline int f326_25(int x) { return x * 25; }
+inline int f326_26(int x) { return x * 26; }
+inline int f326_27(int x) { return x * 27; }
+inline int f326_28(int x) { return x * 28; }
+inline int f326_29(int x) { return x * 29; }
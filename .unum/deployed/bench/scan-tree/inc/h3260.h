@@ -0,0 +1,42 @@
+#pragma once
+/* header 3260 */
+#include <vector>
+#include "h2559.h"
+#include "h3337.h"
+#include "h3067.h"
+#include "h9028.h"
+#include "h7843.h"
+#ifdef X
+#include "h6985.h"
+#endif
+struct S3260 { int a; const char *s = "x//y"; };
+inline int f3260_0(int x) { return x * 0; }
+inline int f3260_1(int x) { return x * 1; }
+inline int f3260_2(int x) { return x * 2; }
+inline int f3260_3(int x) { return x * 3; }
+inline int f3260_4(int x) { return x * 4; }
+inline int f3260_5(int x) { return x * 5; }
+inline int f3260_6(int x) { return x * 6; }
+inline int f3260_7(int x) { return x * 7; }
+inline int f3260_8(int x) { return x * 8; }
+inline int f3260_9(int x) { return x * 9; }
+inline int f3260_10(int x) { return x * 10; }
+inline int f3260_11(int x) { return x * 11; }
+inline int f3260_12(int x) { return x * 12; }
+inline int f3260_13(int x) { return x * 13; }
+inline int f3260_14(int x) { return x * 14; }
+inline int f3260_15(int x) { return x * 15; }
+inline int f3260_16(int x) { return x * 16; }
+inline int f3260_17(int x) { return x * 17; }
+inline int f3260_18(int x) { return x * 18; }
+inline int f3260_19(int x) { return x * 19; }
+inline int f3260_20(int x) { return x * 20; }
+inline int f3260_21(int x) { return x * 21; }
+inline int f3260_22(int x) { return x * 22; }
+inline int f3260_23(int x) { return x * 23; }
+inline int f3260_24(int x) { return x * 24; }
+inline int f3260_25(int x) { return x * 25; }
+inline int f3260_26(int x) { return x * 26; }
+inline int f3260_27(int x) { return x * 27; }
+inline int f3260_28(int x) { return x * 28; }
+inline int f3260_29(int x) { return x * 29; }
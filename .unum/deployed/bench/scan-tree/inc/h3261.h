@@ -0,0 +1,42 @@
+#pragma once
+/* header 3261 */
+#include <vector>
+#include "h4207.h"
+#include "h5056.h"
+#include "h914.h"
+#include "h3567.h"
+#include "h9095.h"
+#ifdef X
+#include "h6266.h"
+#endif
+struct S3261 { int a; const char *s = "x//y"; };
+inline int f3261_0(int x) { return x * 0; }
+inline int f3261_1(int x) { return x * 1; }
+inline int f3261_2(int x) { return x * 2; }
+inline int f3261_3(int x) { return x * 3; }
+inline int f3261_4(int x) { return x * 4; }
+inline int f3261_5(int x) { return x * 5; }
+inline int f3261_6(int x) { return x * 6; }
+inline int f3261_7(int x) { return x * 7; }
+inline int f3261_8(int x) { return x * 8; }
+inline int f3261_9(int x) { return x * 9; }
+inline int f3261_10(int x) { return x * 10; }
+inline int f3261_11(int x) { return x * 11; }
+inline int f3261_12(int x) { return x * 12; }
+inline int f3261_13(int x) { return x * 13; }
+inline int f3261_14(int x) { return x * 14; }
+inline int f3261_15(int x) { return x * 15; }
+inline int f3261_16(int x) { return x * 16; }
+inline int f3261_17(int x) { return x * 17; }
+inline int f3261_18(int x) { return x * 18; }
+inline int f3261_19(int x) { return x * 19; }
+inline int f3261_20(int x) { return x * 20; }
+inline int f3261_21(int x) { return x * 21; }
+inline int f3261_22(int x) { return x * 22; }
+inline int f3261_23(int x) { return x * 23; }
+inline int f3261_24(int x) { return x * 24; }
+inline int f3261_25(int x) { return x * 25; }
+inline int f3261_26(int x) { return x * 26; }
+inline int f3261_27(int x) { return x * 27; }
+inline int f3261_28(int x) { return x * 28; }
+inline int f3261_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3263 */
+#include <vector>
+#include "h5782.h"
+#include "h585.h"
+#include "h7262.h"
+#include "h9607.h"
+#include "h5289.h"
+#ifdef X
+#include "h5328.h"
+#endif
+struct S3263 { int a; const char *s = "x//y"; };
+inline int f3263_0(int x) { return x * 0; }
+inline int f3263_1(int x) { return x * 1; }
+inline int f3263_2(int x) { return x * 2; }
+inline int f3263_3(int x) { return x * 3; }
+inline int f3263_4(int x) { return x * 4; }
+inline int f3263_5(int x) { return x * 5; }
+inline int f3263_6(int x) { return x * 6; }
+inline int f3263_7(int x) { return x * 7; }
+inline int f3263_8(int x) { return x * 8; }
+inline int f3263_9(int x) { return x * 9; }
+inline int f3263_10(int x) { return x * 10; }
+inline int f3263_11(int x) { return x * 11; }
+inline int f3263_12(int x) { return x * 12; }
+inline int f3263_13(int x) { return x * 13; }
+inline int f3263_14(int x) { return x * 14; }
+inline int f3263_15(int x) { return x * 15; }
+inline int f3263_16(int x) { return x * 16; }
+inline int f3263_17(int x) { return x * 17; }
+inline int f3263_18(int x) { return x * 18; }
+inline int f3263_19(int x) { return x * 19; }
+inline int f3263_20(int x) { return x * 20; }
+inline int f3263_21(int x) { return x * 21; }
+inline int f3263_22(int x) { return x * 22; }
+inline int f3263_23(int x) { return x * 23; }
+inline int f3263_24(int x) { return x * 24; }
+inline int f3263_25(int x) { return x * 25; }
+inline int f3263_26(int x) { return x * 26; }
+inline int f3263_27(int x) { return x * 27; }
+inline int f3263_28(int x) { return x * 28; }
+inline int f3263_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3264 */
+#include <vector>
+#include "h1241.h"
+#include "h8505.h"
+#include "h7418.h"
+#include "h6331.h"
+#include "h6983.h"
+#ifdef X
+#include "h9776.h"
+#endif
+struct S3264 { int a; const char *s = "x//y"; };
+inline int f3264_0(int x) { return x * 0; }
+inline int f3264_1(int x) { return x * 1; }
+inline int f3264_2(int x) { return x * 2; }
+inline int f3264_3(int x) { return x * 3; }
+inline int f3264_4(int x) { return x * 4; }
+inline int f3264_5(int x) { return x * 5; }
+inline int f3264_6(int x) { return x * 6; }
+inline int f3264_7(int x) { return x * 7; }
+inline int f3264_8(int x) { return x * 8; }
+inline int f3264_9(int x) { return x * 9; }
+inline int f3264_10(int x) { return x * 10; }
+inline int f3264_11(int x) { return x * 11; }
+inline int f3264_12(int x) { return x * 12; }
+inline int f3264_13(int x) { return x * 13; }
+inline int f3264_14(int x) { return x * 14; }
+inline int f3264_15(int x) { return x * 15; }
+inline int f3264_16(int x) { return x * 16; }
+inline int f3264_17(int x) { return x * 17; }
+inline int f3264_18(int x) { return x * 18; }
+inline int f3264_19(int x) { return x * 19; }
+inline int f3264_20(int x) { return x * 20; }
+inline int f3264_21(int x) { return x * 21; }
+inline int f3264_22(int x) { return x * 22; }
+inline int f3264_23(int x) { return x * 23; }
+inline int f3264_24(int x) { return x * 24; }
+inline int f3264_25(int x) { return x * 25; }
+inline int f3264_26(int x) { return x * 26; }
+inline int f3264_27(int x) { return x * 27; }
+inline int f3264_28(int x) { return x * 28; }
+inline int f3264_29(int x) { return x * 29; }
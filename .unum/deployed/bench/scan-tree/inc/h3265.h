@@ -0,0 +1,42 @@
+#pragma once
+/* header 3265 */
+#include <vector>
+#include "h6834.h"
+#include "h263.h"
+#include "h4098.h"
+#include "h8902.h"
+#include "h6738.h"
+#ifdef X
+#include "h7928.h"
+#endif
+struct S3265 { int a; const char *s = "x//y"; };
+inline int f3265_0(int x) { return x * 0; }
+inline int f3265_1(int x) { return x * 1; }
+inline int f3265_2(int x) { return x * 2; }
+inline int f3265_3(int x) { return x * 3; }
+inline int f3265_4(int x) { return x * 4; }
+inline int f3265_5(int x) { return x * 5; }
+inline int f3265_6(int x) { return x * 6; }
+inline int f3265_7(int x) { return x * 7; }
+inline int f3265_8(int x) { return x * 8; }
+inline int f3265_9(int x) { return x * 9; }
+inline int f3265_10(int x) { return x * 10; }
+inline int f3265_11(int x) { return x * 11; }
+inline int f3265_12(int x) { return x * 12; }
+inline int f3265_13(int x) { return x * 13; }
+inline int f3265_14(int x) { return x * 14; }
+inline int f3265_15(int x) { return x * 15; }
+inline int f3265_16(int x) { return x * 16; }
+inline int f3265_17(int x) { return x * 17; }
+inline int f3265_18(int x) { return x * 18; }
+inline int f3265_19(int x) { return x * 19; }
+inline int f3265_20(int x) { return x * 20; }
+inline int f3265_21(int x) { return x * 21; }
+inline int f3265_22(int x) { return x * 22; }
+inline int f3265_23(int x) { return x * 23; }
+inline int f3265_24(int x) { return x * 24; }
+inline int f3265_25(int x) { return x * 25; }
+inline int f3265_26(int x) { return x * 26; }
+inline int f3265_27(int x) { return x * 27; }
+inline int f3265_28(int x) { return x * 28; }
+inline int f3265_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3272 */
+#include <vector>
+#include "h6859.h"
+#include "h7985.h"
+#include "h5631.h"
+#include "h1709.h"
+#include "h4457.h"
+#ifdef X
+#include "h5228.h"
+#endif
+struct S3272 { int a; const char *s = "x//y"; };
+inline int f3272_0(int x) { return x * 0; }
+inline int f3272_1(int x) { return x * 1; }
+inline int f3272_2(int x) { return x * 2; }
+inline int f3272_3(int x) { return x * 3; }
+inline int f3272_4(int x) { return x * 4; }
+inline int f3272_5(int x) { return x * 5; }
+inline int f3272_6(int x) { return x * 6; }
+inline int f3272_7(int x) { return x * 7; }
+inline int f3272_8(int x) { return x * 8; }
+inline int f3272_9(int x) { return x * 9; }
+inline int f3272_10(int x) { return x * 10; }
+inline int f3272_11(int x) { return x * 11; }
+inline int f3272_12(int x) { return x * 12; }
+inline int f3272_13(int x) { return x * 13; }
+inline int f3272_14(int x) { return x * 14; }
+inline int f3272_15(int x) { return x * 15; }
+inline int f3272_16(int x) { return x * 16; }
+inline int f3272_17(int x) { return x * 17; }
+inline int f3272_18(int x) { return x * 18; }
+inline int f3272_19(int x) { return x * 19; }
+inline int f3272_20(int x) { return x * 20; }
+inline int f3272_21(int x) { return x * 21; }
+inline int f3272_22(int x) { return x * 22; }
+inline int f3272_23(int x) { return x * 23; }
+inline int f3272_24(int x) { return x * 24; }
+inline int f3272_25(int x) { return x * 25; }
+inline int f3272_26(int x) { return x * 26; }
+inline int f3272_27(int x) { return x * 27; }
+inline int f3272_28(int x) { return x * 28; }
+inline int f3272_29(int x) { return x * 29; }
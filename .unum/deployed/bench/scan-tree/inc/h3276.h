@@ -0,0 +1,42 @@
+#pragma once
+/* header 3276 */
+#include <vector>
+#include "h3742.h"
+#include "h9558.h"
+#include "h1706.h"
+#include "h1608.h"
+#include "h7800.h"
+#ifdef X
+#include "h1193.h"
+#endif
+struct S3276 { int a; const char *s = "x//y"; };
+inline int f3276_0(int x) { return x * 0; }
+inline int f3276_1(int x) { return x * 1; }
+inline int f3276_2(int x) { return x * 2; }
+inline int f3276_3(int x) { return x * 3; }
+inline int f3276_4(int x) { return x * 4; }
+inline int f3276_5(int x) { return x * 5; }
+inline int f3276_6(int x) { return x * 6; }
+inline int f3276_7(int x) { return x * 7; }
+inline int f3276_8(int x) { return x * 8; }
+inline int f3276_9(int x) { return x * 9; }
+inline int f3276_10(int x) { return x * 10; }
+inline int f3276_11(int x) { return x * 11; }
+inline int f3276_12(int x) { return x * 12; }
+inline int f3276_13(int x) { return x * 13; }
+inline int f3276_14(int x) { return x * 14; }
+inline int f3276_15(int x) { return x * 15; }
+inline int f3276_16(int x) { return x * 16; }
+inline int f3276_17(int x) { return x * 17; }
+inline int f3276_18(int x) { return x * 18; }
+inline int f3276_19(int x) { return x * 19; }
+inline int f3276_20(int x) { return x * 20; }
+inline int f3276_21(int x) { return x * 21; }
+inline int f3276_22(int x) { return x * 22; }
+inline int f3276_23(int x) { return x * 23; }
+inline int f3276_24(int x) { return x * 24; }
+inline int f3276_25(int x) { return x * 25; }
+inline int f3276_26(int x) { return x * 26; }
+inline int f3276_27(int x) { return x * 27; }
+inline int f3276_28(int x) { return x * 28; }
+inline int f3276_29(int x) { return x * 29; }
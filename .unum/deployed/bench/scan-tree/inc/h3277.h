@@ -0,0 +1,42 @@
+#pragma once
+/* header 3277 */
+#include <vector>
+#include "h9957.h"
+#include "h2716.h"
+#include "h9489.h"
+#include "h995.h"
+#include "h1811.h"
+#ifdef X
+#include "h5254.h"
+#endif
+struct S3277 { int a; const char *s = "x//y"; };
+inline int f3277_0(int x) { return x * 0; }
+inline int f3277_1(int x) { return x * 1; }
+inline int f3277_2(int x) { return x * 2; }
+inline int f3277_3(int x) { return x * 3; }
+inline int f3277_4(int x) { return x * 4; }
+inline int f3277_5(int x) { return x * 5; }
+inline int f3277_6(int x) { return x * 6; }
+inline int f3277_7(int x) { return x * 7; }
+inline int f3277_8(int x) { return x * 8; }
+inline int f3277_9(int x) { return x * 9; }
+inline int f3277_10(int x) { return x * 10; }
+inline int f3277_11(int x) { return x * 11; }
+inline int f3277_12(int x) { return x * 12; }
+inline int f3277_13(int x) { return x * 13; }
+inline int f3277_14(int x) { return x * 14; }
+inline int f3277_15(int x) { return x * 15; }
+inline int f3277_16(int x) { return x * 16; }
+inline int f3277_17(int x) { return x * 17; }
+inline int f3277_18(int x) { return x * 18; }
+inline int f3277_19(int x) { return x * 19; }
+inline int f3277_20(int x) { return x * 20; }
+inline int f3277_21(int x) { return x * 21; }
+inline int f3277_22(int x) { return x * 22; }
+inline int f3277_23(int x) { return x * 23; }
+inline int f3277_24(int x) { return x * 24; }
+inline int f3277_25(int x) { return x * 25; }
+inline int f3277_26(int x) { return x * 26; }
+inline int f3277_27(int x) { return x * 27; }
+inline int f3277_28(int x) { return x * 28; }
+inline int f3277_29(int x) { return x * 29; }
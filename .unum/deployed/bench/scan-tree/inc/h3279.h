@@ -0,0 +1,42 @@
+#pragma once
+/* header 3279 */
+#include <vector>
+#include "h4130.h"
+#include "h5027.h"
+#include "h5681.h"
+#include "h6386.h"
+#include "h5888.h"
+#ifdef X
+#include "h5710.h"
+#endif
+struct S3279 { int a; const char *s = "x//y"; };
+inline int f3279_0(int x) { return x * 0; }
+inline int f3279_1(int x) { return x * 1; }
+inline int f3279_2(int x) { return x * 2; }
+inline int f3279_3(int x) { return x * 3; }
+inline int f3279_4(int x) { return x * 4; }
+inline int f3279_5(int x) { return x * 5; }
+inline int f3279_6(int x) { return x * 6; }
+inline int f3279_7(int x) { return x * 7; }
+inline int f3279_8(int x) { return x * 8; }
+inline int f3279_9(int x) { return x * 9; }
+inline int f3279_10(int x) { return x * 10; }
+inline int f3279_11(int x) { return x * 11; }
+inline int f3279_12(int x) { return x * 12; }
+inline int f3279_13(int x) { return x * 13; }
+inline int f3279_14(int x) { return x * 14; }
+inline int f3279_15(int x) { return x * 15; }
+inline int f3279_16(int x) { return x * 16; }
+inline int f3279_17(int x) { return x * 17; }
+inline int f3279_18(int x) { return x * 18; }
+inline int f3279_19(int x) { return x * 19; }
+inline int f3279_20(int x) { return x * 20; }
+inline int f3279_21(int x) { return x * 21; }
+inline int f3279_22(int x) { return x * 22; }
+inline int f3279_23(int x) { return x * 23; }
+inline int f3279_24(int x) { return x * 24; }
+inline int f3279_25(int x) { return x * 25; }
+inline int f3279_26(int x) { return x * 26; }
+inline int f3279_27(int x) { return x * 27; }
+inline int f3279_28(int x) { return x * 28; }
+inline int f3279_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 328 */
+#include <vector>
+#include "h3078.h"
+#include "h6767.h"
+#include "h6088.h"
+#include "h6589.h"
+#include "h9524.h"
+#ifdef X
+#include "h809.h"
+#endif
+struct S328 { int a; const char *s = "x//y"; };
+inline int f328_0(int x) { return x * 0; }
+inline int f328_1(int x) { return x * 1; }
+inline int f328_2(int x) { return x * 2; }
+inline int f328_3(int x) { return x * 3; }
+inline int f328_4(int x) { return x * 4; }
+inline int f328_5(int x) { return x * 5; }
+inline int f328_6(int x) { return x * 6; }
+inline int f328_7(int x) { return x * 7; }
+inline int f328_8(int x) { return x * 8; }
+inline int f328_9(int x) { return x * 9; }
+inline int f328_10(int x) { return x * 10; }
+inline int f328_11(int x) { return x * 11; }
+inline int f328_12(int x) { return x * 12; }
+inline int f328_13(int x) { return x * 13; }
+inline int f328_14(int x) { return x * 14; }
+inline int f328_15(int x) { return x * 15; }
+inline int f328_16(int x) { return x * 16; }
+inline int f328_17(int x) { return x * 17; }
+inline int f328_18(int x) { return x * 18; }
+inline int f328_19(int x) { return x * 19; }
+inline int f328_20(int x) { return x * 20; }
+inline int f328_21(int x) { return x * 21; }
+inline int f328_22(int x) { return x * 22; }
+inline int f328_23(int x) { return x * 23; }
+inline int f328_24(int x) { return x * 24; }
+inline int f328_25(int x) { return x * 25; }
+inline int f328_26(int x) { return x * 26; }
+inline int f328_27(int x) { return x * 27; }
+inline int f328_28(int x) { return x * 28; }
+inline int f328_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3281 */
+#include <vector>
+#include "h9406.h"
+#include "h9278.h"
+#include "h7090.h"
+#include "h3423.h"
+#include "h5341.h"
+#ifdef X
+#include "h6400.h"
+#endif
+struct S3281 { int a; const char *s = "x//y"; };
+inline int f3281_0(int x) { return x * 0; }
+inline int f3281_1(int x) { return x * 1; }
+inline int f3281_2(int x) { return x * 2; }
+inline int f3281_3(int x) { return x * 3; }
+inline int f3281_4(int x) { return x * 4; }
+inline int f3281_5(int x) { return x * 5; }
+inline int f3281_6(int x) { return x * 6; }
+inline int f3281_7(int x) { return x * 7; }
+inline int f3281_8(int x) { return x * 8; }
+inline int f3281_9(int x) { return x * 9; }
+inline int f3281_10(int x) { return x * 10; }
+inline int f3281_11(int x) { return x * 11; }
+inline int f3281_12(int x) { return x * 12; }
+inline int f3281_13(int x) { return x * 13; }
+inline int f3281_14(int x) { return x * 14; }
+inline int f3281_15(int x) { return x * 15; }
+inline int f3281_16(int x) { return x * 16; }
+inline int f3281_17(int x) { return x * 17; }
+inline int f3281_18(int x) { return x * 18; }
+inline int f3281_19(int x) { return x * 19; }
+inline int f3281_20(int x) { return x * 20; }
+inline int f3281_21(int x) { return x * 21; }
+inline int f3281_22(int x) { return x * 22; }
+inline int f3281_23(int x) { return x * 23; }
+inline int f3281_24(int x) { return x * 24; }
+inline int f3281_25(int x) { return x * 25; }
+inline int f3281_26(int x) { return x * 26; }
+inline int f3281_27(int x) { return x * 27; }
+inline int f3281_28(int x) { return x * 28; }
+inline int f3281_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3283 */
+#include <vector>
+#include "h3061.h"
+#include "h1287.h"
+#include "h8089.h"
+#include "h9204.h"
+#include "h5803.h"
+#ifdef X
+#include "h7123.h"
+#endif
+struct S3283 { int a; const char *s = "x//y"; };
+inline int f3283_0(int x) { return x * 0; }
+inline int f3283_1(int x) { return x * 1; }
+inline int f3283_2(int x) { return x * 2; }
+inline int f3283_3(int x) { return x * 3; }
+inline int f3283_4(int x) { return x * 4; }
+inline int f3283_5(int x) { return x * 5; }
+inline int f3283_6(int x) { return x * 6; }
+inline int f3283_7(int x) { return x * 7; }
+inline int f3283_8(int x) { return x * 8; }
+inline int f3283_9(int x) { return x * 9; }
+inline int f3283_10(int x) { return x * 10; }
+inline int f3283_11(int x) { return x * 11; }
+inline int f3283_12(int x) { return x * 12; }
+inline int f3283_13(int x) { return x * 13; }
+inline int f3283_14(int x) { return x * 14; }
+inline int f3283_15(int x) { return x * 15; }
+inline int f3283_16(int x) { return x * 16; }
+inline int f3283_17(int x) { return x * 17; }
+inline int f3283_18(int x) { return x * 18; }
+inline int f3283_19(int x) { return x * 19; }
+inline int f3283_20(int x) { return x * 20; }
+inline int f3283_21(int x) { return x * 21; }
+inline int f3283_22(int x) { return x * 22; }
+inline int f3283_23(int x) { return x * 23; }
+inline int f3283_24(int x) { return x * 24; }
+inline int f3283_25(int x) { return x * 25; }
+inline int f3283_26(int x) { return x * 26; }
+inline int f3283_27(int x) { return x * 27; }
+inline int f3283_28(int x) { return x * 28; }
+inline int f3283_29(int x) { return x * 29; }
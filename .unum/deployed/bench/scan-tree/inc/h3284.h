@@ -0,0 +1,42 @@
+#pragma once
+/* header 3284 */
+#include <vector>
+#include "h6511.h"
+#include "h9687.h"
+#include "h168.h"
+#include "h7020.h"
+#include "h7197.h"
+#ifdef X
+#include "h8645.h"
+#endif
+struct S3284 { int a; const char *s = "x//y"; };
+inline int f3284_0(int x) { return x * 0; }
+inline int f3284_1(int x) { return x * 1; }
+inline int f3284_2(int x) { return x * 2; }
+inline int f3284_3(int x) { return x * 3; }
+inline int f3284_4(int x) { return x * 4; }
+inline int f3284_5(int x) { return x * 5; }
+inline int f3284_6(int x) { return x * 6; }
+inline int f3284_7(int x) { return x * 7; }
+inline int f3284_8(int x) { return x * 8; }
+inline int f3284_9(int x) { return x * 9; }
+inline int f3284_10(int x) { return x * 10; }
+inline int f3284_11(int x) { return x * 11; }
+inline int f3284_12(int x) { return x * 12; }
+inline int f3284_13(int x) { return x * 13; }
+inline int f3284_14(int x) { return x * 14; }
+inline int f3284_15(int x) { return x * 15; }
+inline int f3284_16(int x) { return x * 16; }
+inline int f3284_17(int x) { return x * 17; }
+inline int f3284_18(int x) { return x * 18; }
+inline int f3284_19(int x) { return x * 19; }
+inline int f3284_20(int x) { return x * 20; }
+inline int f3284_21(int x) { return x * 21; }
+inline int f3284_22(int x) { return x * 22; }
+inline int f3284_23(int x) { return x * 23; }
+inline int f3284_24(int x) { return x * 24; }
+inline int f3284_25(int x) { return x * 25; }
+inline int f3284_26(int x) { return x * 26; }
+inline int f3284_27(int x) { return x * 27; }
+inline int f3284_28(int x) { return x * 28; }
+inline int f3284_29(int x) { return x * 29; }
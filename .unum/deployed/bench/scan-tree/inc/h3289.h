@@ -0,0 +1,42 @@
+#pragma once
+/* header 3289 */
+#include <vector>
+#include "h6950.h"
+#include "h9937.h"
+#include "h4932.h"
+#include "h3932.h"
+#include "h8521.h"
+#ifdef X
+#include "h913.h"
+#endif
+struct S3289 { int a; const char *s = "x//y"; };
+inline int f3289_0(int x) { return x * 0; }
+inline int f3289_1(int x) { return x * 1; }
+inline int f3289_2(int x) { return x * 2; }
+inline int f3289_3(int x) { return x * 3; }
+inline int f3289_4(int x) { return x * 4; }
+inline int f3289_5(int x) { return x * 5; }
+inline int f3289_6(int x) { return x * 6; }
+inline int f3289_7(int x) { return x * 7; }
+inline int f3289_8(int x) { return x * 8; }
+inline int f3289_9(int x) { return x * 9; }
+inline int f3289_10(int x) { return x * 10; }
+inline int f3289_11(int x) { return x * 11; }
+inline int f3289_12(int x) { return x * 12; }
+inline int f3289_13(int x) { return x * 13; }
+inline int f3289_14(int x) { return x * 14; }
+inline int f3289_15(int x) { return x * 15; }
+inline int f3289_16(int x) { return x * 16; }
+inline int f3289_17(int x) { return x * 17; }
+inline int f3289_18(int x) { return x * 18; }
+inline int f3289_19(int x) { return x * 19; }
+inline int f3289_20(int x) { return x * 20; }
+inline int f3289_21(int x) { return x * 21; }
+inline int f3289_22(int x) { return x * 22; }
+inline int f3289_23(int x) { return x * 23; }
+inline int f3289_24(int x) { return x * 24; }
+inline int f3289_25(int x) { return x * 25; }
+inline int f3289_26(int x) { return x * 26; }
+inline int f3289_27(int x) { return x * 27; }
+inline int f3289_28(int x) { return x * 28; }
+inline int f3289_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3290 */
+#include <vector>
+#include "h7650.h"
+#include "h261.h"
+#include "h3514.h"
+#include "h2844.h"
+#include "h941.h"
+#ifdef X
+#include "h3183.h"
+#endif
+struct S3290 { int a; const char *s = "x//y"; };
+inline int f3290_0(int x) { return x * 0; }
+inline int f3290_1(int x) { return x * 1; }
+inline int f3290_2(int x) { return x * 2; }
+inline int f3290_3(int x) { return x * 3; }
+inline int f3290_4(int x) { return x * 4; }
+inline int f3290_5(int x) { return x * 5; }
+inline int f3290_6(int x) { return x * 6; }
+inline int f3290_7(int x) { return x * 7; }
+inline int f3290_8(int x) { return x * 8; }
+inline int f3290_9(int x) { return x * 9; }
+inline int f3290_10(int x) { return x * 10; }
+inline int f3290_11(int x) { return x * 11; }
+inline int f3290_12(int x) { return x * 12; }
+inline int f3290_13(int x) { return x * 13; }
+inline int f3290_14(int x) { return x * 14; }
+inline int f3290_15(int x) { return x * 15; }
+inline int f3290_16(int x) { return x * 16; }
+inline int f3290_17(int x) { return x * 17; }
+inline int f3290_18(int x) { return x * 18; }
+inline int f3290_19(int x) { return x * 19; }
+inline int f3290_20(int x) { return x * 20; }
+inline int f3290_21(int x) { return x * 21; }
+inline int f3290_22(int x) { return x * 22; }
+inline int f3290_23(int x) { return x * 23; }
+inline int f3290_24(int x) { return x * 24; }
+inline int f3290_25(int x) { return x * 25; }
+inline int f3290_26(int x) { return x * 26; }
+inline int f3290_27(int x) { return x * 27; }
+inline int f3290_28(int x) { return x * 28; }
+inline int f3290_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3291 */
+#include <vector>
+#include "h1994.h"
+#include "h6847.h"
+#include "h6621.h"
+#include "h6168.h"
+#include "h3783.h"
+#ifdef X
+#include "h5252.h"
+#endif
+struct S3291 { int a; const char *s = "x//y"; };
+inline int f3291_0(int x) { return x * 0; }
+inline int f3291_1(int x) { return x * 1; }
+inline int f3291_2(int x) { return x * 2; }
+inline int f3291_3(int x) { return x * 3; }
+inline int f3291_4(int x) { return x * 4; }
+inline int f3291_5(int x) { return x * 5; }
+inline int f3291_6(int x) { return x * 6; }
+inline int f3291_7(int x) { return x * 7; }
+inline int f3291_8(int x) { return x * 8; }
+inline int f3291_9(int x) { return x * 9; }
+inline int f3291_10(int x) { return x * 10; }
+inline int f3291_11(int x) { return x * 11; }
+inline int f3291_12(int x) { return x * 12; }
+inline int f3291_13(int x) { return x * 13; }
+inline int f3291_14(int x) { return x * 14; }
+inline int f3291_15(int x) { return x * 15; }
+inline int f3291_16(int x) { return x * 16; }
+inline int f3291_17(int x) { return x * 17; }
+inline int f3291_18(int x) { return x * 18; }
+inline int f3291_19(int x) { return x * 19; }
+inline int f3291_20(int x) { return x * 20; }
+inline int f3291_21(int x) { return x * 21; }
+inline int f3291_22(int x) { return x * 22; }
+inline int f3291_23(int x) { return x * 23; }
+inline int f3291_24(int x) { return x * 24; }
+inline int f3291_25(int x) { return x * 25; }
+inline int f3291_26(int x) { return x * 26; }
+inline int f3291_27(int x) { return x * 27; }
+inline int f3291_28(int x) { return x * 28; }
+inline int f3291_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3292 */
+#include <vector>
+#include "h3091.h"
+#include "h2659.h"
+#include "h5530.h"
+#include "h7874.h"
+#include "h9893.h"
+#ifdef X
+#include "h2138.h"
+#endif
+struct S3292 { int a; const char *s = "x//y"; };
+inline int f3292_0(int x) { return x * 0; }
+inline int f3292_1(int x) { return x * 1; }
+inline int f3292_2(int x) { return x * 2; }
+inline int f3292_3(int x) { return x * 3; }
+inline int f3292_4(int x) { return x * 4; }
+inline int f3292_5(int x) { return x * 5; }
+inline int f3292_6(int x) { return x * 6; }
+inline int f3292_7(int x) { return x * 7; }
+inline int f3292_8(int x) { return x * 8; }
+inline int f3292_9(int x) { return x * 9; }
+inline int f3292_10(int x) { return x * 10; }
+inline int f3292_11(int x) { return x * 11; }
+inline int f3292_12(int x) { return x * 12; }
+inline int f3292_13(int x) { return x * 13; }
+inline int f3292_14(int x) { return x * 14; }
+inline int f3292_15(int x) { return x * 15; }
+inline int f3292_16(int x) { return x * 16; }
+inline int f3292_17(int x) { return x * 17; }
+inline int f3292_18(int x) { return x * 18; }
+inline int f3292_19(int x) { return x * 19; }
+inline int f3292_20(int x) { return x * 20; }
+inline int f3292_21(int x) { return x * 21; }
+inline int f3292_22(int x) { return x * 22; }
+inline int f3292_23(int x) { return x * 23; }
+inline int f3292_24(int x) { return x * 24; }
+inline int f3292_25(int x) { return x * 25; }
+inline int f3292_26(int x) { return x * 26; }
+inline int f3292_27(int x) { return x * 27; }
+inline int f3292_28(int x) { return x * 28; }
+inline int f3292_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3293 */
+#include <vector>
+#include "h6382.h"
+#include "h1729.h"
+#include "h9004.h"
+#include "h8638.h"
+#include "h5846.h"
+#ifdef X
+#include "h4222.h"
+#endif
+struct S3293 { int a; const char *s = "x//y"; };
+inline int f3293_0(int x) { return x * 0; }
+inline int f3293_1(int x) { return x * 1; }
+inline int f3293_2(int x) { return x * 2; }
+inline int f3293_3(int x) { return x * 3; }
+inline int f3293_4(int x) { return x * 4; }
+inline int f3293_5(int x) { return x * 5; }
+inline int f3293_6(int x) { return x * 6; }
+inline int f3293_7(int x) { return x * 7; }
+inline int f3293_8(int x) { return x * 8; }
+inline int f3293_9(int x) { return x * 9; }
+inline int f3293_10(int x) { return x * 10; }
+inline int f3293_11(int x) { return x * 11; }
+inline int f3293_12(int x) { return x * 12; }
+inline int f3293_13(int x) { return x * 13; }
+inline int f3293_14(int x) { return x * 14; }
+inline int f3293_15(int x) { return x * 15; }
+inline int f3293_16(int x) { return x * 16; }
+inline int f3293_17(int x) { return x * 17; }
+inline int f3293_18(int x) { return x * 18; }
+inline int f3293_19(int x) { return x * 19; }
+inline int f3293_20(int x) { return x * 20; }
+inline int f3293_21(int x) { return x * 21; }
+inline int f3293_22(int x) { return x * 22; }
+inline int f3293_23(int x) { return x * 23; }
+inline int f3293_24(int x) { return x * 24; }
+inline int f3293_25(int x) { return x * 25; }
+inline int f3293_26(int x) { return x * 26; }
+inline int f3293_27(int x) { return x * 27; }
+inline int f3293_28(int x) { return x * 28; }
+inline int f3293_29(int x) { return x * 29; }
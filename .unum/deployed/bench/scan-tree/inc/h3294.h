@@ -0,0 +1,42 @@
+#pragma once
+/* header 3294 */
+#include <vector>
+#include "h9066.h"
+#include "h906.h"
+#include "h6254.h"
+#include "h98.h"
+#include "h2832.h"
+#ifdef X
+#include "h6536.h"
+#endif
+struct S3294 { int a; const char *s = "x//y"; };
+inline int f3294_0(int x) { return x * 0; }
+inline int f3294_1(int x) { return x * 1; }
+inline int f3294_2(int x) { return x * 2; }
+inline int f3294_3(int x) { return x * 3; }
+inline int f3294_4(int x) { return x * 4; }
+inline int f3294_5(int x) { return x * 5; }
+inline int f3294_6(int x) { return x * 6; }
+inline int f3294_7(int x) { return x * 7; }
+inline int f3294_8(int x) { return x * 8; }
+inline int f3294_9(int x) { return x * 9; }
+inline int f3294_10(int x) { return x * 10; }
+inline int f3294_11(int x) { return x * 11; }
+inline int f3294_12(int x) { return x * 12; }
+inline int f3294_13(int x) { return x * 13; }
+inline int f3294_14(int x) { return x * 14; }
+inline int f3294_15(int x) { return x * 15; }
+inline int f3294_16(int x) { return x * 16; }
+inline int f3294_17(int x) { return x * 17; }
+inline int f3294_18(int x) { return x * 18; }
+inline int f3294_19(int x) { return x * 19; }
+inline int f3294_20(int x) { return x * 20; }
+inline int f3294_21(int x) { return x * 21; }
+inline int f3294_22(int x) { return x * 22; }
+inline int f3294_23(int x) { return x * 23; }
+inline int f3294_24(int x) { return x * 24; }
+inline int f3294_25(int x) { return x * 25; }
+inline int f3294_26(int x) { return x * 26; }
+inline int f3294_27(int x) { return x * 27; }
+inline int f3294_28(int x) { return x * 28; }
+inline int f3294_29(int x) { return x * 29; }
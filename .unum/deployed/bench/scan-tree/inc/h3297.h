@@ -0,0 +1,42 @@
+#pragma once
+/* header 3297 */
+#include <vector>
+#include "h6318.h"
+#include "h6505.h"
+#include "h3084.h"
+#include "h6225.h"
+#include "h499.h"
+#ifdef X
+#include "h5870.h"
+#endif
+struct S3297 { int a; const char *s = "x//y"; };
+inline int f3297_0(int x) { return x * 0; }
+inline int f3297_1(int x) { return x * 1; }
+inline int f3297_2(int x) { return x * 2; }
+inline int f3297_3(int x) { return x * 3; }
+inline int f3297_4(int x) { return x * 4; }
+inline int f3297_5(int x) { return x * 5; }
+inline int f3297_6(int x) { return x * 6; }
+inline int f3297_7(int x) { return x * 7; }
+inline int f3297_8(int x) { return x * 8; }
+inline int f3297_9(int x) { return x * 9; }
+inline int f3297_10(int x) { return x * 10; }
+inline int f3297_11(int x) { return x * 11; }
+inline int f3297_12(int x) { return x * 12; }
+inline int f3297_13(int x) { return x * 13; }
+inline int f3297_14(int x) { return x * 14; }
+inline int f3297_15(int x) { return x * 15; }
+inline int f3297_16(int x) { return x * 16; }
+inline int f3297_17(int x) { return x * 17; }
+inline int f3297_18(int x) { return x * 18; }
+inline int f3297_19(int x) { return x * 19; }
+inline int f3297_20(int x) { return x * 20; }
+inline int f3297_21(int x) { return x * 21; }
+inline int f3297_22(int x) { return x * 22; }
+inline int f3297_23(int x) { return x * 23; }
+inline int f3297_24(int x) { return x * 24; }
+inline int f3297_25(int x) { return x * 25; }
+inline int f3297_26(int x) { return x * 26; }
+inline int f3297_27(int x) { return x * 27; }
+inline int f3297_28(int x) { return x * 28; }
+inline int f3297_29(int x) { return x * 29; }
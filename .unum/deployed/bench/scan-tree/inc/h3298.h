@@ -0,0 +1,42 @@
+#pragma once
+/* header 3298 */
+#include <vector>
+#include "h5305.h"
+#include "h8626.h"
+#include "h4443.h"
+#include "h8709.h"
+#include "h1089.h"
+#ifdef X
+#include "h6215.h"
+#endif
+struct S3298 { int a; const char *s = "x//y"; };
+inline int f3298_0(int x) { return x * 0; }
+inline int f3298_1(int x) { return x * 1; }
+inline int f3298_2(int x) { return x * 2; }
+inline int f3298_3(int x) { return x * 3; }
+inline int f3298_4(int x) { return x * 4; }
+inline int f3298_5(int x) { return x * 5; }
+inline int f3298_6(int x) { return x * 6; }
+inline int f3298_7(int x) { return x * 7; }
+inline int f3298_8(int x) { return x * 8; }
+inline int f3298_9(int x) { return x * 9; }
+inline int f3298_10(int x) { return x * 10; }
+inline int f3298_11(int x) { return x * 11; }
+inline int f3298_12(int x) { return x * 12; }
+inline int f3298_13(int x) { return x * 13; }
+inline int f3298_14(int x) { return x * 14; }
+inline int f3298_15(int x) { return x * 15; }
+inline int f3298_16(int x) { return x * 16; }
+inline int f3298_17(int x) { return x * 17; }
+inline int f3298_18(int x) { return x * 18; }
+inline int f3298_19(int x) { return x * 19; }
+inline int f3298_20(int x) { return x * 20; }
+inline int f3298_21(int x) { return x * 21; }
+inline int f3298_22(int x) { return x * 22; }
+inline int f3298_23(int x) { return x * 23; }
+inline int f3298_24(int x) { return x * 24; }
+inline int f3298_25(int x) { return x * 25; }
+inline int f3298_26(int x) { return x * 26; }
+inline int f3298_27(int x) { return x * 27; }
+inline int f3298_28(int x) { return x * 28; }
+inline int f3298_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 33 */
+#include <vector>
+#include "h4410.h"
+#include "h6569.h"
+#include "h6654.h"
+#include "h5653.h"
+#include "h2791.h"
+#ifdef X
+#include "h319.h"
+#endif
+struct S33 { int a; const char *s = "x//y"; };
+inline int f33_0(int x) { return x * 0; }
+inline int f33_1(int x) { return x * 1; }
+inline int f33_2(int x) { return x * 2; }
+inline int f33_3(int x) { return x * 3; }
+inline int f33_4(int x) { return x * 4; }
+inline int f33_5(int x) { return x * 5; }
+inline int f33_6(int x) { return x * 6; }
+inline int f33_7(int x) { return x * 7; }
+inline int f33_8(int x) { return x * 8; }
+inline int f33_9(int x) { return x * 9; }
+inline int f33_10(int x) { return x * 10; }
+inline int f33_11(int x) { return x * 11; }
+inline int f33_12(int x) { return x * 12; }
+inline int f33_13(int x) { return x * 13; }
+inline int f33_14(int x) { return x * 14; }
+inline int f33_15(int x) { return x * 15; }
+inline int f33_16(int x) { return x * 16; }
+inline int f33_17(int x) { return x * 17; }
+inline int f33_18(int x) { return x * 18; }
+inline int f33_19(int x) { return x * 19; }
+inline int f33_20(int x) { return x * 20; }
+inline int f33_21(int x) { return x * 21; }
+inline int f33_22(int x) { return x * 22; }
+inline int f33_23(int x) { return x * 23; }
+inline int f33_24(int x) { return x * 24; }
+inline int f33_25(int x) { return x * 25; }
+inline int f33_26(int x) { return x * 26; }
+inline int f33_27(int x) { return x * 27; }
+inline int f33_28(int x) { return x * 28; }
+inline int f33_29(int x) { return x * 29; }
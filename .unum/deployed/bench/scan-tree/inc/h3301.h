@@ -0,0 +1,42 @@
+#pragma once
+/* header 3301 */
+#include <vector>
+#include "h4734.h"
+#include "h5803.h"
+#include "h7917.h"
+#include "h328.h"
+#include "h4570.h"
+#ifdef X
+#include "h6238.h"
+#endif
+struct S3301 { int a; const char *s = "x//y"; };
+inline int f3301_0(int x) { return x * 0; }
+inline int f3301_1(int x) { return x * 1; }
+inline int f3301_2(int x) { return x * 2; }
+inline int f3301_3(int x) { return x * 3; }
+inline int f3301_4(int x) { return x * 4; }
+inline int f3301_5(int x) { return x * 5; }
+inline int f3301_6(int x) { return x * 6; }
+inline int f3301_7(int x) { return x * 7; }
+inline int f3301_8(int x) { return x * 8; }
+inline int f3301_9(int x) { return x * 9; }
+inline int f3301_10(int x) { return x * 10; }
+inline int f3301_11(int x) { return x * 11; }
+inline int f3301_12(int x) { return x * 12; }
+inline int f3301_13(int x) { return x * 13; }
+inline int f3301_14(int x) { return x * 14; }
+inline int f3301_15(int x) { return x * 15; }
+inline int f3301_16(int x) { return x * 16; }
+inline int f3301_17(int x) { return x * 17; }
+inline int f3301_18(int x) { return x * 18; }
+inline int f3301_19(int x) { return x * 19; }
+inline int f3301_20(int x) { return x * 20; }
+inline int f3301_21(int x) { return x * 21; }
+inline int f3301_22(int x) { return x * 22; }
+inline int f3301_23(int x) { return x * 23; }
+inline int f3301_24(int x) { return x * 24; }
+inline int f3301_25(int x) { return x * 25; }
+inline int f3301_26(int x) { return x * 26; }
+inline int f3301_27(int x) { return x * 27; }
+inline int f3301_28(int x) { return x * 28; }
+inline int f3301_29(int x) { return x * 29; }
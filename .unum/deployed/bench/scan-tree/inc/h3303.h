@@ -0,0 +1,42 @@
+#pragma once
+/* header 3303 */
+#include <vector>
+#include "h1734.h"
+#include "h3230.h"
+#include "h5789.h"
+#include "h3075.h"
+#include "h1678.h"
+#ifdef X
+#include "h8134.h"
+#endif
+struct S3303 { int a; const char *s = "x//y"; };
+inline int f3303_0(int x) { return x * 0; }
+inline int f3303_1(int x) { return x * 1; }
+inline int f3303_2(int x) { return x * 2; }
+inline int f3303_3(int x) { return x * 3; }
+inline int f3303_4(int x) { return x * 4; }
+inline int f3303_5(int x) { return x * 5; }
+inline int f3303_6(int x) { return x * 6; }
+inline int f3303_7(int x) { return x * 7; }
+inline int f3303_8(int x) { return x * 8; }
+inline int f3303_9(int x) { return x * 9; }
+inline int f3303_10(int x) { return x * 10; }
+inline int f3303_11(int x) { return x * 11; }
+inline int f3303_12(int x) { return x * 12; }
+inline int f3303_13(int x) { return x * 13; }
+inline int f3303_14(int x) { return x * 14; }
+inline int f3303_15(int x) { return x * 15; }
+inline int f3303_16(int x) { return x * 16; }
+inline int f3303_17(int x) { return x * 17; }
+inline int f3303_18(int x) { return x * 18; }
+inline int f3303_19(int x) { return x * 19; }
+inline int f3303_20(int x) { return x * 20; }
+inline int f3303_21(int x) { return x * 21; }
+inline int f3303_22(int x) { return x * 22; }
+inline int f3303_23(int x) { return x * 23; }
+inline int f3303_24(int x) { return x * 24; }
+inline int f3303_25(int x) { return x * 25; }
+inline int f3303_26(int x) { return x * 26; }
+inline int f3303_27(int x) { return x * 27; }
+inline int f3303_28(int x) { return x * 28; }
+inline int f3303_29(int x) { return x * 29; }
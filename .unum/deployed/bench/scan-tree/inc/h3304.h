@@ -0,0 +1,42 @@
+#pragma once
+/* header 3304 */
+#include <vector>
+#include "h7569.h"
+#include "h5257.h"
+#include "h6821.h"
+#include "h3643.h"
+#include "h6613.h"
+#ifdef X
+#include "h4317.h"
+#endif
+struct S3304 { int a; const char *s = "x//y"; };
+inline int f3304_0(int x) { return x * 0; }
+inline int f3304_1(int x) { return x * 1; }
+inline int f3304_2(int x) { return x * 2; }
+inline int f3304_3(int x) { return x * 3; }
+inline int f3304_4(int x) { return x * 4; }
+inline int f3304_5(int x) { return x * 5; }
+inline int f3304_6(int x) { return x * 6; }
+inline int f3304_7(int x) { return x * 7; }
+inline int f3304_8(int x) { return x * 8; }
+inline int f3304_9(int x) { return x * 9; }
+inline int f3304_10(int x) { return x * 10; }
+inline int f3304_11(int x) { return x * 11; }
+inline int f3304_12(int x) { return x * 12; }
+inline int f3304_13(int x) { return x * 13; }
+inline int f3304_14(int x) { return x * 14; }
+inline int f3304_15(int x) { return x * 15; }
+inline int f3304_16(int x) { return x * 16; }
+inline int f3304_17(int x) { return x * 17; }
+inline int f3304_18(int x) { return x * 18; }
+inline int f3304_19(int x) { return x * 19; }
+inline int f3304_20(int x) { return x * 20; }
+inline int f3304_21(int x) { return x * 21; }
+inline int f3304_22(int x) { return x * 22; }
+inline int f3304_23(int x) { return x * 23; }
+inline int f3304_24(int x) { return x * 24; }
+inline int f3304_25(int x) { return x * 25; }
+inline int f3304_26(int x) { return x * 26; }
+inline int f3304_27(int x) { return x * 27; }
+inline int f3304_28(int x) { return x * 28; }
+inline int f3304_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3305 */
+#include <vector>
+#include "h7919.h"
+#include "h5358.h"
+#include "h5397.h"
+#include "h1189.h"
+#include "h1629.h"
+#ifdef X
+#include "h112.h"
+#endif
+struct S3305 { int a; const char *s = "x//y"; };
+inline int f3305_0(int x) { return x * 0; }
+inline int f3305_1(int x) { return x * 1; }
+inline int f3305_2(int x) { return x * 2; }
+inline int f3305_3(int x) { return x * 3; }
+inline int f3305_4(int x) { return x * 4; }
+inline int f3305_5(int x) { return x * 5; }
+inline int f3305_6(int x) { return x * 6; }
+inline int f3305_7(int x) { return x * 7; }
+inline int f3305_8(int x) { return x * 8; }
+inline int f3305_9(int x) { return x * 9; }
+inline int f3305_10(int x) { return x * 10; }
+inline int f3305_11(int x) { return x * 11; }
+inline int f3305_12(int x) { return x * 12; }
+inline int f3305_13(int x) { return x * 13; }
+inline int f3305_14(int x) { return x * 14; }
+inline int f3305_15(int x) { return x * 15; }
+inline int f3305_16(int x) { return x * 16; }
+inline int f3305_17(int x) { return x * 17; }
+inline int f3305_18(int x) { return x * 18; }
+inline int f3305_19(int x) { return x * 19; }
+inline int f3305_20(int x) { return x * 20; }
+inline int f3305_21(int x) { return x * 21; }
+inline int f3305_22(int x) { return x * 22; }
+inline int f3305_23(int x) { return x * 23; }
+inline int f3305_24(int x) { return x * 24; }
+inline int f3305_25(int x) { return x * 25; }
+inline int f3305_26(int x) { return x * 26; }
+inline int f3305_27(int x) { return x * 27; }
+inline int f3305_28(int x) { return x * 28; }
+inline int f3305_29(int x) { return x * 29; }
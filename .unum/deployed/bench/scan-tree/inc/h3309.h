@@ -0,0 +1,42 @@
+#pragma once
+/* header 3309 */
+#include <vector>
+#include "h9269.h"
+#include "h1648.h"
+#include "h2540.h"
+#include "h8200.h"
+#include "h7682.h"
+#ifdef X
+#include "h9026.h"
+#endif
+struct S3309 { int a; const char *s = "x//y"; };
+inline int f3309_0(int x) { return x * 0; }
+inline int f3309_1(int x) { return x * 1; }
+inline int f3309_2(int x) { return x * 2; }
+inline int f3309_3(int x) { return x * 3; }
+inline int f3309_4(int x) { return x * 4; }
+inline int f3309_5(int x) { return x * 5; }
+inline int f3309_6(int x) { return x * 6; }
+inline int f3309_7(int x) { return x * 7; }
+inline int f3309_8(int x) { return x * 8; }
+inline int f3309_9(int x) { return x * 9; }
+inline int f3309_10(int x) { return x * 10; }
+inline int f3309_11(int x) { return x * 11; }
+inline int f3309_12(int x) { return x * 12; }
+inline int f3309_13(int x) { return x * 13; }
+inline int f3309_14(int x) { return x * 14; }
+inline int f3309_15(int x) { return x * 15; }
+inline int f3309_16(int x) { return x * 16; }
+inline int f3309_17(int x) { return x * 17; }
+inline int f3309_18(int x) { return x * 18; }
+inline int f3309_19(int x) { return x * 19; }
+inline int f3309_20(int x) { return x * 20; }
+inline int f3309_21(int x) { return x * 21; }
+inline int f3309_22(int x) { return x * 22; }
+inline int f3309_23(int x) { return x * 23; }
+inline int f3309_24(int x) { return x * 24; }
+inline int f3309_25(int x) { return x * 25; }
+inline int f3309_26(int x) { return x * 26; }
+inline int f3309_27(int x) { return x * 27; }
+inline int f3309_28(int x) { return x * 28; }
+inline int f3309_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 331 */
+#include <vector>
+#include "h677.h"
+#include "h7935.h"
+#include "h2011.h"
+#include "h8100.h"
+#include "h3592.h"
+#ifdef X
+#include "h4722.h"
+#endif
+struct S331 { int a; const char *s = "x//y"; };
+inline int f331_0(int x) { return x * 0; }
+inline int f331_1(int x) { return x * 1; }
+inline int f331_2(int x) { return x * 2; }
+inline int f331_3(int x) { return x * 3; }
+inline int f331_4(int x) { return x * 4; }
+inline int f331_5(int x) { return x * 5; }
+inline int f331_6(int x) { return x * 6; }
+inline int f331_7(int x) { return x * 7; }
+inline int f331_8(int x) { return x * 8; }
+inline int f331_9(int x) { return x * 9; }
+inline int f331_10(int x) { return x * 10; }
+inline int f331_11(int x) { return x * 11; }
+inline int f331_12(int x) { return x * 12; }
+inline int f331_13(int x) { return x * 13; }
+inline int f331_14(int x) { return x * 14; }
+inline int f331_15(int x) { return x * 15; }
+inline int f331_16(int x) { return x * 16; }
+inline int f331_17(int x) { return x * 17; }
+inline int f331_18(int x) { return x * 18; }
+inline int f331_19(int x) { return x * 19; }
+inline int f331_20(int x) { return x * 20; }
+inline int f331_21(int x) { return x * 21; }
+inline int f331_22(int x) { return x * 22; }
+inline int f331_23(int x) { return x * 23; }
+inline int f331_24(int x) { return x * 24; }
+inline int f331_25(int x) { return x * 25; }
+inline int f331_26(int x) { return x * 26; }
+inline int f331_27(int x) { return x * 27; }
+inline int f331_28(int x) { return x * 28; }
+inline int f331_29(int x) { return x * 29; }
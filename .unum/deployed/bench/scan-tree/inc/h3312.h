@@ -0,0 +1,42 @@
+#pragma once
+/* header 3312 */
+#include <vector>
+#include "h7988.h"
+#include "h1606.h"
+#include "h7413.h"
+#include "h8408.h"
+#include "h9805.h"
+#ifdef X
+#include "h4290.h"
+#endif
+struct S3312 { int a; const char *s = "x//y"; };
+inline int f3312_0(int x) { return x * 0; }
+inline int f3312_1(int x) { return x * 1; }
+inline int f3312_2(int x) { return x * 2; }
+inline int f3312_3(int x) { return x * 3; }
+inline int f3312_4(int x) { return x * 4; }
+inline int f3312_5(int x) { return x * 5; }
+inline int f3312_6(int x) { return x * 6; }
+inline int f3312_7(int x) { return x * 7; }
+inline int f3312_8(int x) { return x * 8; }
+inline int f3312_9(int x) { return x * 9; }
+inline int f3312_10(int x) { return x * 10; }
+inline int f3312_11(int x) { return x * 11; }
+inline int f3312_12(int x) { return x * 12; }
+inline int f3312_13(int x) { return x * 13; }
+inline int f3312_14(int x) { return x * 14; }
+inline int f3312_15(int x) { return x * 15; }
+inline int f3312_16(int x) { return x * 16; }
+inline int f3312_17(int x) { return x * 17; }
+inline int f3312_18(int x) { return x * 18; }
+inline int f3312_19(int x) { return x * 19; }
+inline int f3312_20(int x) { return x * 20; }
+inline int f3312_21(int x) { return x * 21; }
+inline int f3312_22(int x) { return x * 22; }
+inline int f3312_23(int x) { return x * 23; }
+inline int f3312_24(int x) { return x * 24; }
+inline int f3312_25(int x) { return x * 25; }
+inline int f3312_26(int x) { return x * 26; }
+inline int f3312_27(int x) { return x * 27; }
+inline int f3312_28(int x) { return x * 28; }
+inline int f3312_29(int x) { return x * 29; }
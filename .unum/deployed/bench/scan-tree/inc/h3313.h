@@ -0,0 +1,42 @@
+#pragma once
+/* header 3313 */
+#include <vector>
+#include "h5770.h"
+#include "h8619.h"
+#include "h3767.h"
+#include "h3473.h"
+#include "h1896.h"
+#ifdef X
+#include "h8250.h"
+#endif
+struct S3313 { int a; const char *s = "x//y"; };
+inline int f3313_0(int x) { return x * 0; }
+inline int f3313_1(int x) { return x * 1; }
+inline int f3313_2(int x) { return x * 2; }
+inline int f3313_3(int x) { return x * 3; }
+inline int f3313_4(int x) { return x * 4; }
+inline int f3313_5(int x) { return x * 5; }
+inline int f3313_6(int x) { return x * 6; }
+inline int f3313_7(int x) { return x * 7; }
+inline int f3313_8(int x) { return x * 8; }
+inline int f3313_9(int x) { return x * 9; }
+inline int f3313_10(int x) { return x * 10; }
+inline int f3313_11(int x) { return x * 11; }
+inline int f3313_12(int x) { return x * 12; }
+inline int f3313_13(int x) { return x * 13; }
+inline int f3313_14(int x) { return x * 14; }
+inline int f3313_15(int x) { return x * 15; }
+inline int f3313_16(int x) { return x * 16; }
+inline int f3313_17(int x) { return x * 17; }
+inline int f3313_18(int x) { return x * 18; }
+inline int f3313_19(int x) { return x * 19; }
+inline int f3313_20(int x) { return x * 20; }
+inline int f3313_21(int x) { return x * 21; }
+inline int f3313_22(int x) { return x * 22; }
+inline int f3313_23(int x) { return x * 23; }
+inline int f3313_24(int x) { return x * 24; }
+inline int f3313_25(int x) { return x * 25; }
+inline int f3313_26(int x) { return x * 26; }
+inline int f3313_27(int x) { return x * 27; }
+inline int f3313_28(int x) { return x * 28; }
+inline int f3313_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3315 */
+#include <vector>
+#include "h7975.h"
+#include "h654.h"
+#include "h6212.h"
+#include "h9068.h"
+#include "h2144.h"
+#ifdef X
+#include "h5879.h"
+#endif
+struct S3315 { int a; const char *s = "x//y"; };
+inline int f3315_0(int x) { return x * 0; }
+inline int f3315_1(int x) { return x * 1; }
+inline int f3315_2(int x) { return x * 2; }
+inline int f3315_3(int x) { return x * 3; }
+inline int f3315_4(int x) { return x * 4; }
+inline int f3315_5(int x) { return x * 5; }
+inline int f3315_6(int x) { return x * 6; }
+inline int f3315_7(int x) { return x * 7; }
+inline int f3315_8(int x) { return x * 8; }
+inline int f3315_9(int x) { return x * 9; }
+inline int f3315_10(int x) { return x * 10; }
+inline int f3315_11(int x) { return x * 11; }
+inline int f3315_12(int x) { return x * 12; }
+inline int f3315_13(int x) { return x * 13; }
+inline int f3315_14(int x) { return x * 14; }
+inline int f3315_15(int x) { return x * 15; }
+inline int f3315_16(int x) { return x * 16; }
+inline int f3315_17(int x) { return x * 17; }
+inline int f3315_18(int x) { return x * 18; }
+inline int f3315_19(int x) { return x * 19; }
+inline int f3315_20(int x) { return x * 20; }
+inline int f3315_21(int x) { return x * 21; }
+inline int f3315_22(int x) { return x * 22; }
+inline int f3315_23(int x) { return x * 23; }
+inline int f3315_24(int x) { return x * 24; }
+inline int f3315_25(int x) { return x * 25; }
+inline int f3315_26(int x) { return x * 26; }
+inline int f3315_27(int x) { return x * 27; }
+inline int f3315_28(int x) { return x * 28; }
+inline int f3315_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3317 */
+#include <vector>
+#include "h5620.h"
+#include "h100.h"
+#include "h7463.h"
+#include "h5189.h"
+#include "h2515.h"
+#ifdef X
+#include "h3826.h"
+#endif
+struct S3317 { int a; const char *s = "x//y"; };
+inline int f3317_0(int x) { return x * 0; }
+inline int f3317_1(int x) { return x * 1; }
+inline int f3317_2(int x) { return x * 2; }
+inline int f3317_3(int x) { return x * 3; }
+inline int f3317_4(int x) { return x * 4; }
+inline int f3317_5(int x) { return x * 5; }
+inline int f3317_6(int x) { return x * 6; }
+inline int f3317_7(int x) { return x * 7; }
+inline int f3317_8(int x) { return x * 8; }
+inline int f3317_9(int x) { return x * 9; }
+inline int f3317_10(int x) { return x * 10; }
+inline int f3317_11(int x) { return x * 11; }
+inline int f3317_12(int x) { return x * 12; }
+inline int f3317_13(int x) { return x * 13; }
+inline int f3317_14(int x) { return x * 14; }
+inline int f3317_15(int x) { return x * 15; }
+inline int f3317_16(int x) { return x * 16; }
+inline int f3317_17(int x) { return x * 17; }
+inline int f3317_18(int x) { return x * 18; }
+inline int f3317_19(int x) { return x * 19; }
+inline int f3317_20(int x) { return x * 20; }
+inline int f3317_21(int x) { return x * 21; }
+inline int f3317_22(int x) { return x * 22; }
+inline int f3317_23(int x) { return x * 23; }
+inline int f3317_24(int x) { return x * 24; }
+inline int f3317_25(int x) { return x * 25; }
+inline int f3317_26(int x) { return x * 26; }
+inline int f3317_27(int x) { return x * 27; }
+inline int f3317_28(int x) { return x * 28; }
+inline int f3317_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3319 */
+#include <vector>
+#include "h8271.h"
+#include "h4048.h"
+#include "h2604.h"
+#include "h2119.h"
+#include "h6059.h"
+#ifdef X
+#include "h6707.h"
+#endif
+struct S3319 { int a; const char *s = "x//y"; };
+inline int f3319_0(int x) { return x * 0; }
+inline int f3319_1(int x) { return x * 1; }
+inline int f3319_2(int x) { return x * 2; }
+inline int f3319_3(int x) { return x * 3; }
+inline int f3319_4(int x) { return x * 4; }
+inline int f3319_5(int x) { return x * 5; }
+inline int f3319_6(int x) { return x * 6; }
+inline int f3319_7(int x) { return x * 7; }
+inline int f3319_8(int x) { return x * 8; }
+inline int f3319_9(int x) { return x * 9; }
+inline int f3319_10(int x) { return x * 10; }
+inline int f3319_11(int x) { return x * 11; }
+inline int f3319_12(int x) { return x * 12; }
+inline int f3319_13(int x) { return x * 13; }
+inline int f3319_14(int x) { return x * 14; }
+inline int f3319_15(int x) { return x * 15; }
+inline int f3319_16(int x) { return x * 16; }
+inline int f3319_17(int x) { return x * 17; }
+inline int f3319_18(int x) { return x * 18; }
+inline int f3319_19(int x) { return x * 19; }
+inline int f3319_20(int x) { return x * 20; }
+inline int f3319_21(int x) { return x * 21; }
+inline int f3319_22(int x) { return x * 22; }
+inline int f3319_23(int x) { return x * 23; }
+inline int f3319_24(int x) { return x * 24; }
+inline int f3319_25(int x) { return x * 25; }
+inline int f3319_26(int x) { return x * 26; }
+inline int f3319_27(int x) { return x * 27; }
+inline int f3319_28(int x) { return x * 28; }
+inline int f3319_29(int x) { return x * 29; }
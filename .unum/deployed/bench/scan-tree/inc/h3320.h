@@ -0,0 +1,42 @@
+#pragma once
+/* header 3320 */
+#include <vector>
+#include "h7313.h"
+#include "h9706.h"
+#include "h9279.h"
+#include "h4841.h"
+#include "h7028.h"
+#ifdef X
+#include "h6561.h"
+#endif
+struct S3320 { int a; const char *s = "x//y"; };
+inline int f3320_0(int x) { return x * 0; }
+inline int f3320_1(int x) { return x * 1; }
+inline int f3320_2(int x) { return x * 2; }
+inline int f3320_3(int x) { return x * 3; }
+inline int f3320_4(int x) { return x * 4; }
+inline int f3320_5(int x) { return x * 5; }
+inline int f3320_6(int x) { return x * 6; }
+inline int f3320_7(int x) { return x * 7; }
+inline int f3320_8(int x) { return x * 8; }
+inline int f3320_9(int x) { return x * 9; }
+inline int f3320_10(int x) { return x * 10; }
+inline int f3320_11(int x) { return x * 11; }
+inline int f3320_12(int x) { return x * 12; }
+inline int f3320_13(int x) { return x * 13; }
+inline int f3320_14(int x) { return x * 14; }
+inline int f3320_15(int x) { return x * 15; }
+inline int f3320_16(int x) { return x * 16; }
+inline int f3320_17(int x) { return x * 17; }
+inline int f3320_18(int x) { return x * 18; }
+inline int f3320_19(int x) { return x * 19; }
+inline int f3320_20(int x) { return x * 20; }
+inline int f3320_21(int x) { return x * 21; }
+inline int f3320_22(int x) { return x * 22; }
+inline int f3320_23(int x) { return x * 23; }
+inline int f3320_24(int x) { return x * 24; }
+inline int f3320_25(int x) { return x * 25; }
+inline int f3320_26(int x) { return x * 26; }
+inline int f3320_27(int x) { return x * 27; }
+inline int f3320_28(int x) { return x * 28; }
+inline int f3320_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3327 */
+#include <vector>
+#include "h8188.h"
+#include "h2468.h"
+#include "h9925.h"
+#include "h6708.h"
+#include "h1233.h"
+#ifdef X
+#include "h6176.h"
+#endif
+struct S3327 { int a; const char *s = "x//y"; };
+inline int f3327_0(int x) { return x * 0; }
+inline int f3327_1(int x) { return x * 1; }
+inline int f3327_2(int x) { return x * 2; }
+inline int f3327_3(int x) { return x * 3; }
+inline int f3327_4(int x) { return x * 4; }
+inline int f3327_5(int x) { return x * 5; }
+inline int f3327_6(int x) { return x * 6; }
+inline int f3327_7(int x) { return x * 7; }
+inline int f3327_8(int x) { return x * 8; }
+inline int f3327_9(int x) { return x * 9; }
+inline int f3327_10(int x) { return x * 10; }
+inline int f3327_11(int x) { return x * 11; }
+inline int f3327_12(int x) { return x * 12; }
+inline int f3327_13(int x) { return x * 13; }
+inline int f3327_14(int x) { return x * 14; }
+inline int f3327_15(int x) { return x * 15; }
+inline int f3327_16(int x) { return x * 16; }
+inline int f3327_17(int x) { return x * 17; }
+inline int f3327_18(int x) { return x * 18; }
+inline int f3327_19(int x) { return x * 19; }
+inline int f3327_20(int x) { return x * 20; }
+inline int f3327_21(int x) { return x * 21; }
+inline int f3327_22(int x) { return x * 22; }
+inline int f3327_23(int x) { return x * 23; }
+inline int f3327_24(int x) { return x * 24; }
+inline int f3327_25(int x) { return x * 25; }
+inline int f3327_26(int x) { return x * 26; }
+inline int f3327_27(int x) { return x * 27; }
+inline int f3327_28(int x) { return x * 28; }
+inline int f3327_29(int x) { return x * 29; }
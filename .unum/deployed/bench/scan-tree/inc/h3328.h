@@ -0,0 +1,42 @@
+#pragma once
+/* header 3328 */
+#include <vector>
+#include "h6795.h"
+#include "h4245.h"
+#include "h1592.h"
+#include "h7297.h"
+#include "h7619.h"
+#ifdef X
+#include "h238.h"
+#endif
+struct S3328 { int a; const char *s = "x//y"; };
+inline int f3328_0(int x) { return x * 0; }
+inline int f3328_1(int x) { return x * 1; }
+inline int f3328_2(int x) { return x * 2; }
+inline int f3328_3(int x) { return x * 3; }
+inline int f3328_4(int x) { return x * 4; }
+inline int f3328_5(int x) { return x * 5; }
+inline int f3328_6(int x) { return x * 6; }
+inline int f3328_7(int x) { return x * 7; }
+inline int f3328_8(int x) { return x * 8; }
+inline int f3328_9(int x) { return x * 9; }
+inline int f3328_10(int x) { return x * 10; }
+inline int f3328_11(int x) { return x * 11; }
+inline int f3328_12(int x) { return x * 12; }
+inline int f3328_13(int x) { return x * 13; }
+inline int f3328_14(int x) { return x * 14; }
+inline int f3328_15(int x) { return x * 15; }
+inline int f3328_16(int x) { return x * 16; }
+inline int f3328_17(int x) { return x * 17; }
+inline int f3328_18(int x) { return x * 18; }
+inline int f3328_19(int x) { return x * 19; }
+inline int f3328_20(int x) { return x * 20; }
+inline int f3328_21(int x) { return x * 21; }
+inline int f3328_22(int x) { return x * 22; }
+inline int f3328_23(int x) { return x * 23; }
+inline int f3328_24(int x) { return x * 24; }
+inline int f3328_25(int x) { return x * 25; }
+inline int f3328_26(int x) { return x * 26; }
+inline int f3328_27(int x) { return x * 27; }
+inline int f3328_28(int x) { return x * 28; }
+inline int f3328_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 333 */
+#include <vector>
+#include "h197.h"
+#include "h1674.h"
+#include "h8801.h"
+#include "h8897.h"
+#include "h9430.h"
+#ifdef X
+#include "h9028.h"
+#endif
+struct S333 { int a; const char *s = "x//y"; };
+inline int f333_0(int x) { return x * 0; }
+inline int f333_1(int x) { return x * 1; }
+inline int f333_2(int x) { return x * 2; }
+inline int f333_3(int x) { return x * 3; }
+inline int f333_4(int x) { return x * 4; }
+inline int f333_5(int x) { return x * 5; }
+inline int f333_6(int x) { return x * 6; }
+inline int f333_7(int x) { return x * 7; }
+inline int f333_8(int x) { return x * 8; }
+inline int f333_9(int x) { return x * 9; }
+inline int f333_10(int x) { return x * 10; }
+inline int f333_11(int x) { return x * 11; }
+inline int f333_12(int x) { return x * 12; }
+inline int f333_13(int x) { return x * 13; }
+inline int f333_14(int x) { return x * 14; }
+inline int f333_15(int x) { return x * 15; }
+inline int f333_16(int x) { return x * 16; }
+inline int f333_17(int x) { return x * 17; }
+inline int f333_18(int x) { return x * 18; }
+inline int f333_19(int x) { return x * 19; }
+inline int f333_20(int x) { return x * 20; }
+inline int f333_21(int x) { return x * 21; }
+inline int f333_22(int x) { return x * 22; }
+inline int f333_23(int x) { return x * 23; }
+inline int f333_24(int x) { return x * 24; }
+inline int f333_25(int x) { return x * 25; }
+inline int f333_26(int x) { return x * 26; }
+inline int f333_27(int x) { return x * 27; }
+inline int f333_28(int x) { return x * 28; }
+inline int f333_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3330 */
+#include <vector>
+#include "h6305.h"
+#include "h8.h"
+#include "h1104.h"
+#include "h6229.h"
+#include "h7360.h"
+#ifdef X
+#include "h1826.h"
+#endif
+struct S3330 { int a; const char *s = "x//y"; };
+inline int f3330_0(int x) { return x * 0; }
+inline int f3330_1(int x) { return x * 1; }
+inline int f3330_2(int x) { return x * 2; }
+inline int f3330_3(int x) { return x * 3; }
+inline int f3330_4(int x) { return x * 4; }
+inline int f3330_5(int x) { return x * 5; }
+inline int f3330_6(int x) { return x * 6; }
+inline int f3330_7(int x) { return x * 7; }
+inline int f3330_8(int x) { return x * 8; }
+inline int f3330_9(int x) { return x * 9; }
+inline int f3330_10(int x) { return x * 10; }
+inline int f3330_11(int x) { return x * 11; }
+inline int f3330_12(int x) { return x * 12; }
+inline int f3330_13(int x) { return x * 13; }
+inline int f3330_14(int x) { return x * 14; }
+inline int f3330_15(int x) { return x * 15; }
+inline int f3330_16(int x) { return x * 16; }
+inline int f3330_17(int x) { return x * 17; }
+inline int f3330_18(int x) { return x * 18; }
+inline int f3330_19(int x) { return x * 19; }
+inline int f3330_20(int x) { return x * 20; }
+inline int f3330_21(int x) { return x * 21; }
+inline int f3330_22(int x) { return x * 22; }
+inline int f3330_23(int x) { return x * 23; }
+inline int f3330_24(int x) { return x * 24; }
+inline int f3330_25(int x) { return x * 25; }
+inline int f3330_26(int x) { return x * 26; }
+inline int f3330_27(int x) { return x * 27; }
+inline int f3330_28(int x) { return x * 28; }
+inline int f3330_29(int x) { return x * 29; }
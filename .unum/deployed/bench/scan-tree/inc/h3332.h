@@ -0,0 +1,42 @@
+#pragma once
+/* header 3332 */
+#include <vector>
+#include "h1424.h"
+#include "h2250.h"
+#include "h9936.h"
+#include "h321.h"
+#include "h2928.h"
+#ifdef X
+#include "h7731.h"
+#endif
+struct S3332 { int a; const char *s = "x//y"; };
+inline int f3332_0(int x) { return x * 0; }
+inline int f3332_1(int x) { return x * 1; }
+inline int f3332_2(int x) { return x * 2; }
+inline int f3332_3(int x) { return x * 3; }
+inline int f3332_4(int x) { return x * 4; }
+inline int f3332_5(int x) { return x * 5; }
+inline int f3332_6(int x) { return x * 6; }
+inline int f3332_7(int x) { return x * 7; }
+inline int f3332_8(int x) { return x * 8; }
+inline int f3332_9(int x) { return x * 9; }
+inline int f3332_10(int x) { return x * 10; }
+inline int f3332_11(int x) { return x * 11; }
+inline int f3332_12(int x) { return x * 12; }
+inline int f3332_13(int x) { return x * 13; }
+inline int f3332_14(int x) { return x * 14; }
+inline int f3332_15(int x) { return x * 15; }
+inline int f3332_16(int x) { return x * 16; }
+inline int f3332_17(int x) { return x * 17; }
+inline int f3332_18(int x) { return x * 18; }
+inline int f3332_19(int x) { return x * 19; }
+inline int f3332_20(int x) { return x * 20; }
+inline int f3332_21(int x) { return x * 21; }
+inline int f3332_22(int x) { return x * 22; }
+inline int f3332_23(int x) { return x * 23; }
+inline int f3332_24(int x) { return x * 24; }
+inline int f3332_25(int x) { return x * 25; }
+inline int f3332_26(int x) { return x * 26; }
+inline int f3332_27(int x) { return x * 27; }
+inline int f3332_28(int x) { return x * 28; }
+inline int f3332_29(int x) { return x * 29; }
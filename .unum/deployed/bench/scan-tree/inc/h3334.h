@@ -0,0 +1,42 @@
+#pragma once
+/* header 3334 */
+#include <vector>
+#include "h7337.h"
+#include "h7363.h"
+#include "h9293.h"
+#include "h1434.h"
+#include "h5750.h"
+#ifdef X
+#include "h7773.h"
+#endif
+struct S3334 { int a; const char *s = "x//y"; };
+inline int f3334_0(int x) { return x * 0; }
+inline int f3334_1(int x) { return x * 1; }
+inline int f3334_2(int x) { return x * 2; }
+inline int f3334_3(int x) { return x * 3; }
+inline int f3334_4(int x) { return x * 4; }
+inline int f3334_5(int x) { return x * 5; }
+inline int f3334_6(int x) { return x * 6; }
+inline int f3334_7(int x) { return x * 7; }
+inline int f3334_8(int x) { return x * 8; }
+inline int f3334_9(int x) { return x * 9; }
+inline int f3334_10(int x) { return x * 10; }
+inline int f3334_11(int x) { return x * 11; }
+inline int f3334_12(int x) { return x * 12; }
+inline int f3334_13(int x) { return x * 13; }
+inline int f3334_14(int x) { return x * 14; }
+inline int f3334_15(int x) { return x * 15; }
+inline int f3334_16(int x) { return x * 16; }
+inline int f3334_17(int x) { return x * 17; }
+inline int f3334_18(int x) { return x * 18; }
+inline int f3334_19(int x) { return x * 19; }
+inline int f3334_20(int x) { return x * 20; }
+inline int f3334_21(int x) { return x * 21; }
+inline int f3334_22(int x) { return x * 22; }
+inline int f3334_23(int x) { return x * 23; }
+inline int f3334_24(int x) { return x * 24; }
+inline int f3334_25(int x) { return x * 25; }
+inline int f3334_26(int x) { return x * 26; }
+inline int f3334_27(int x) { return x * 27; }
+inline int f3334_28(int x) { return x * 28; }
+inline int f3334_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3336 */
+#include <vector>
+#include "h2265.h"
+#include "h3476.h"
+#include "h8692.h"
+#include "h5429.h"
+#include "h7210.h"
+#ifdef X
+#include "h8663.h"
+#endif
+struct S3336 { int a; const char *s = "x//y"; };
+inline int f3336_0(int x) { return x * 0; }
+inline int f3336_1(int x) { return x * 1; }
+inline int f3336_2(int x) { return x * 2; }
+inline int f3336_3(int x) { return x * 3; }
+inline int f3336_4(int x) { return x * 4; }
+inline int f3336_5(int x) { return x * 5; }
+inline int f3336_6(int x) { return x * 6; }
+inline int f3336_7(int x) { return x * 7; }
+inline int f3336_8(int x) { return x * 8; }
+inline int f3336_9(int x) { return x * 9; }
+inline int f3336_10(int x) { return x * 10; }
+inline int f3336_11(int x) { return x * 11; }
+inline int f3336_12(int x) { return x * 12; }
+inline int f3336_13(int x) { return x * 13; }
+inline int f3336_14(int x) { return x * 14; }
+inline int f3336_15(int x) { return x * 15; }
+inline int f3336_16(int x) { return x * 16; }
+inline int f3336_17(int x) { return x * 17; }
+inline int f3336_18(int x) { return x * 18; }
+inline int f3336_19(int x) { return x * 19; }
+inline int f3336_20(int x) { return x * 20; }
+inline int f3336_21(int x) { return x * 21; }
+inline int f3336_22(int x) { return x * 22; }
+inline int f3336_23(int x) { return x * 23; }
+inline int f3336_24(int x) { return x * 24; }
+inline int f3336_25(int x) { return x * 25; }
+inline int f3336_26(int x) { return x * 26; }
+inline int f3336_27(int x) { return x * 27; }
+inline int f3336_28(int x) { return x * 28; }
+inline int f3336_29(int x) { return x * 29; }
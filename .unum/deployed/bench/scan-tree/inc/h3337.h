@@ -0,0 +1,42 @@
+#pragma once
+/* header 3337 */
+#include <vector>
+#include "h5825.h"
+#include "h832.h"
+#include "h2222.h"
+#include "h8278.h"
+#include "h1337.h"
+#ifdef X
+#include "h1172.h"
+#endif
+struct S3337 { int a; const char *s = "x//y"; };
+inline int f3337_0(int x) { return x * 0; }
+inline int f3337_1(int x) { return x * 1; }
+inline int f3337_2(int x) { return x * 2; }
+inline int f3337_3(int x) { return x * 3; }
+inline int f3337_4(int x) { return x * 4; }
+inline int f3337_5(int x) { return x * 5; }
+inline int f3337_6(int x) { return x * 6; }
+inline int f3337_7(int x) { return x * 7; }
+inline int f3337_8(int x) { return x * 8; }
+inline int f3337_9(int x) { return x * 9; }
+inline int f3337_10(int x) { return x * 10; }
+inline int f3337_11(int x) { return x * 11; }
+inline int f3337_12(int x) { return x * 12; }
+inline int f3337_13(int x) { return x * 13; }
+inline int f3337_14(int x) { return x * 14; }
+inline int f3337_15(int x) { return x * 15; }
+inline int f3337_16(int x) { return x * 16; }
+inline int f3337_17(int x) { return x * 17; }
+inline int f3337_18(int x) { return x * 18; }
+inline int f3337_19(int x) { return x * 19; }
+inline int f3337_20(int x) { return x * 20; }
+inline int f3337_21(int x) { return x * 21; }
+inline int f3337_22(int x) { return x * 22; }
+inline int f3337_23(int x) { return x * 23; }
+inline int f3337_24(int x) { return x * 24; }
+inline int f3337_25(int x) { return x * 25; }
+inline int f3337_26(int x) { return x * 26; }
+inline int f3337_27(int x) { return x * 27; }
+inline int f3337_28(int x) { return x * 28; }
+inline int f3337_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3339 */
+#include <vector>
+#include "h6732.h"
+#include "h8788.h"
+#include "h3335.h"
+#include "h4203.h"
+#include "h742.h"
+#ifdef X
+#include "h8463.h"
+#endif
+struct S3339 { int a; const char *s = "x//y"; };
+inline int f3339_0(int x) { return x * 0; }
+inline int f3339_1(int x) { return x * 1; }
+inline int f3339_2(int x) { return x * 2; }
+inline int f3339_3(int x) { return x * 3; }
+inline int f3339_4(int x) { return x * 4; }
+inline int f3339_5(int x) { return x * 5; }
+inline int f3339_6(int x) { return x * 6; }
+inline int f3339_7(int x) { return x * 7; }
+inline int f3339_8(int x) { return x * 8; }
+inline int f3339_9(int x) { return x * 9; }
+inline int f3339_10(int x) { return x * 10; }
+inline int f3339_11(int x) { return x * 11; }
+inline int f3339_12(int x) { return x * 12; }
+inline int f3339_13(int x) { return x * 13; }
+inline int f3339_14(int x) { return x * 14; }
+inline int f3339_15(int x) { return x * 15; }
+inline int f3339_16(int x) { return x * 16; }
+inline int f3339_17(int x) { return x * 17; }
+inline int f3339_18(int x) { return x * 18; }
+inline int f3339_19(int x) { return x * 19; }
+inline int f3339_20(int x) { return x * 20; }
+inline int f3339_21(int x) { return x * 21; }
+inline int f3339_22(int x) { return x * 22; }
+inline int f3339_23(int x) { return x * 23; }
+inline int f3339_24(int x) { return x * 24; }
+inline int f3339_25(int x) { return x * 25; }
+inline int f3339_26(int x) { return x * 26; }
+inline int f3339_27(int x) { return x * 27; }
+inline int f3339_28(int x) { return x * 28; }
+inline int f3339_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 334 */
+#include <vector>
+#include "h9469.h"
+#include "h7917.h"
+#include "h1766.h"
+#include "h3272.h"
+#include "h675.h"
+#ifdef X
+#include "h735.h"
+#endif
+struct S334 { int a; const char *s = "x//y"; };
+inline int f334_0(int x) { return x * 0; }
+inline int f334_1(int x) { return x * 1; }
+inline int f334_2(int x) { return x * 2; }
+inline int f334_3(int x) { return x * 3; }
+inline int f334_4(int x) { return x * 4; }
+inline int f334_5(int x) { return x * 5; }
+inline int f334_6(int x) { return x * 6; }
+inline int f334_7(int x) { return x * 7; }
+inline int f334_8(int x) { return x * 8; }
+inline int f334_9(int x) { return x * 9; }
+inline int f334_10(int x) { return x * 10; }
+inline int f334_11(int x) { return x * 11; }
+inline int f334_12(int x) { return x * 12; }
+inline int f334_13(int x) { return x * 13; }
+inline int f334_14(int x) { return x * 14; }
+inline int f334_15(int x) { return x * 15; }
+inline int f334_16(int x) { return x * 16; }
+inline int f334_17(int x) { return x * 17; }
+inline int f334_18(int x) { return x * 18; }
+inline int f334_19(int x) { return x * 19; }
+inline int f334_20(int x) { return x * 20; }
+inline int f334_21(int x) { return x * 21; }
+inline int f334_22(int x) { return x * 22; }
+inline int f334_23(int x) { return x * 23; }
+inline int f334_24(int x) { return x * 24; }
+inline int f334_25(int x) { return x * 25; }
+inline int f334_26(int x) { return x * 26; }
+inline int f334_27(int x) { return x * 27; }
+inline int f334_28(int x) { return x * 28; }
+inline int f334_29(int x) { return x * 29; }
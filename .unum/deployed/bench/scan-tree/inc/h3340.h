@@ -0,0 +1,42 @@
+#pragma once
+/* header 3340 */
+#include <vector>
+#include "h157.h"
+#include "h4649.h"
+#include "h9408.h"
+#include "h2267.h"
+#include "h1288.h"
+#ifdef X
+#include "h71.h"
+#endif
+struct S3340 { int a; const char *s = "x//y"; };
+inline int f3340_0(int x) { return x * 0; }
+inline int f3340_1(int x) { return x * 1; }
+inline int f3340_2(int x) { return x * 2; }
+inline int f3340_3(int x) { return x * 3; }
+inline int f3340_4(int x) { return x * 4; }
+inline int f3340_5(int x) { return x * 5; }
+inline int f3340_6(int x) { return x * 6; }
+inline int f3340_7(int x) { return x * 7; }
+inline int f3340_8(int x) { return x * 8; }
+inline int f3340_9(int x) { return x * 9; }
+inline int f3340_10(int x) { return x * 10; }
+inline int f3340_11(int x) { return x * 11; }
+inline int f3340_12(int x) { return x * 12; }
+inline int f3340_13(int x) { return x * 13; }
+inline int f3340_14(int x) { return x * 14; }
+inline int f3340_15(int x) { return x * 15; }
+inline int f3340_16(int x) { return x * 16; }
+inline int f3340_17(int x) { return x * 17; }
+inline int f3340_18(int x) { return x * 18; }
+inline int f3340_19(int x) { return x * 19; }
+inline int f3340_20(int x) { return x * 20; }
+inline int f3340_21(int x) { return x * 21; }
+inline int f3340_22(int x) { return x * 22; }
+inline int f3340_23(int x) { return x * 23; }
+inline int f3340_24(int x) { return x * 24; }
+inline int f3340_25(int x) { return x * 25; }
+inline int f3340_26(int x) { return x * 26; }
+inline int f3340_27(int x) { return x * 27; }
+inline int f3340_28(int x) { return x * 28; }
+inline int f3340_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3341 */
+#include <vector>
+#include "h9423.h"
+#include "h1911.h"
+#include "h2450.h"
+#include "h1961.h"
+#include "h253.h"
+#ifdef X
+#include "h7368.h"
+#endif
+struct S3341 { int a; const char *s = "x//y"; };
+inline int f3341_0(int x) { return x * 0; }
+inline int f3341_1(int x) { return x * 1; }
+inline int f3341_2(int x) { return x * 2; }
+inline int f3341_3(int x) { return x * 3; }
+inline int f3341_4(int x) { return x * 4; }
+inline int f3341_5(int x) { return x * 5; }
+inline int f3341_6(int x) { return x * 6; }
+inline int f3341_7(int x) { return x * 7; }
+inline int f3341_8(int x) { return x * 8; }
+inline int f3341_9(int x) { return x * 9; }
+inline int f3341_10(int x) { return x * 10; }
+inline int f3341_11(int x) { return x * 11; }
+inline int f3341_12(int x) { return x * 12; }
+inline int f3341_13(int x) { return x * 13; }
+inline int f3341_14(int x) { return x * 14; }
+inline int f3341_15(int x) { return x * 15; }
+inline int f3341_16(int x) { return x * 16; }
+inline int f3341_17(int x) { return x * 17; }
+inline int f3341_18(int x) { return x * 18; }
+inline int f3341_19(int x) { return x * 19; }
+inline int f3341_20(int x) { return x * 20; }
+inline int f3341_21(int x) { return x * 21; }
+inline int f3341_22(int x) { return x * 22; }
+inline int f3341_23(int x) { return x * 23; }
+inline int f3341_24(int x) { return x * 24; }
+inline int f3341_25(int x) { return x * 25; }
+inline int f3341_26(int x) { return x * 26; }
+inline int f3341_27(int x) { return x * 27; }
+inline int f3341_28(int x) { return x * 28; }
+inline int f3341_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3345 */
+#include <vector>
+#include "h5590.h"
+#include "h5434.h"
+#include "h1060.h"
+#include "h3822.h"
+#include "h4927.h"
+#ifdef X
+#include "h3436.h"
+#endif
+struct S3345 { int a; const char *s = "x//y"; };
+inline int f3345_0(int x) { return x * 0; }
+inline int f3345_1(int x) { return x * 1; }
+inline int f3345_2(int x) { return x * 2; }
+inline int f3345_3(int x) { return x * 3; }
+inline int f3345_4(int x) { return x * 4; }
+inline int f3345_5(int x) { return x * 5; }
+inline int f3345_6(int x) { return x * 6; }
+inline int f3345_7(int x) { return x * 7; }
+inline int f3345_8(int x) { return x * 8; }
+inline int f3345_9(int x) { return x * 9; }
+inline int f3345_10(int x) { return x * 10; }
+inline int f3345_11(int x) { return x * 11; }
+inline int f3345_12(int x) { return x * 12; }
+inline int f3345_13(int x) { return x * 13; }
+inline int f3345_14(int x) { return x * 14; }
+inline int f3345_15(int x) { return x * 15; }
+inline int f3345_16(int x) { return x * 16; }
+inline int f3345_17(int x) { return x * 17; }
+inline int f3345_18(int x) { return x * 18; }
+inline int f3345_19(int x) { return x * 19; }
+inline int f3345_20(int x) { return x * 20; }
+inline int f3345_21(int x) { return x * 21; }
+inline int f3345_22(int x) { return x * 22; }
+inline int f3345_23(int x) { return x * 23; }
+inline int f3345_24(int x) { return x * 24; }
+inline int f3345_25(int x) { return x * 25; }
+inline int f3345_26(int x) { return x * 26; }
+inline int f3345_27(int x) { return x * 27; }
+inline int f3345_28(int x) { return x * 28; }
+inline int f3345_29(int x) { return x * 29; }
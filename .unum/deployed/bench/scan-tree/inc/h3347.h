@@ -0,0 +1,42 @@
+#pragma once
+/* header 3347 */
+#include <vector>
+#include "h2934.h"
+#include "h375.h"
+#include "h5113.h"
+#include "h4803.h"
+#include "h6337.h"
+#ifdef X
+#include "h617.h"
+#endif
+struct S3347 { int a; const char *s = "x//y"; };
+inline int f3347_0(int x) { return x * 0; }
+inline int f3347_1(int x) { return x * 1; }
+inline int f3347_2(int x) { return x * 2; }
+inline int f3347_3(int x) { return x * 3; }
+inline int f3347_4(int x) { return x * 4; }
+inline int f3347_5(int x) { return x * 5; }
+inline int f3347_6(int x) { return x * 6; }
+inline int f3347_7(int x) { return x * 7; }
+inline int f3347_8(int x) { return x * 8; }
+inline int f3347_9(int x) { return x * 9; }
+inline int f3347_10(int x) { return x * 10; }
+inline int f3347_11(int x) { return x * 11; }
+inline int f3347_12(int x) { return x * 12; }
+inline int f3347_13(int x) { return x * 13; }
+inline int f3347_14(int x) { return x * 14; }
+inline int f3347_15(int x) { return x * 15; }
+inline int f3347_16(int x) { return x * 16; }
+inline int f3347_17(int x) { return x * 17; }
+inline int f3347_18(int x) { return x * 18; }
+inline int f3347_19(int x) { return x * 19; }
+inline int f3347_20(int x) { return x * 20; }
+inline int f3347_21(int x) { return x * 21; }
+inline int f3347_22(int x) { return x * 22; }
+inline int f3347_23(int x) { return x * 23; }
+inline int f3347_24(int x) { return x * 24; }
+inline int f3347_25(int x) { return x * 25; }
+inline int f3347_26(int x) { return x * 26; }
+inline int f3347_27(int x) { return x * 27; }
+inline int f3347_28(int x) { return x * 28; }
+inline int f3347_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3348 */
+#include <vector>
+#include "h8730.h"
+#include "h9645.h"
+#include "h2248.h"
+#include "h746.h"
+#include "h7344.h"
+#ifdef X
+#include "h4870.h"
+#endif
+struct S3348 { int a; const char *s = "x//y"; };
+inline int f3348_0(int x) { return x * 0; }
+inline int f3348_1(int x) { return x * 1; }
+inline int f3348_2(int x) { return x * 2; }
+inline int f3348_3(int x) { return x * 3; }
+inline int f3348_4(int x) { return x * 4; }
+inline int f3348_5(int x) { return x * 5; }
+inline int f3348_6(int x) { return x * 6; }
+inline int f3348_7(int x) { return x * 7; }
+inline int f3348_8(int x) { return x * 8; }
+inline int f3348_9(int x) { return x * 9; }
+inline int f3348_10(int x) { return x * 10; }
+inline int f3348_11(int x) { return x * 11; }
+inline int f3348_12(int x) { return x * 12; }
+inline int f3348_13(int x) { return x * 13; }
+inline int f3348_14(int x) { return x * 14; }
+inline int f3348_15(int x) { return x * 15; }
+inline int f3348_16(int x) { return x * 16; }
+inline int f3348_17(int x) { return x * 17; }
+inline int f3348_18(int x) { return x * 18; }
+inline int f3348_19(int x) { return x * 19; }
+inline int f3348_20(int x) { return x * 20; }
+inline int f3348_21(int x) { return x * 21; }
+inline int f3348_22(int x) { return x * 22; }
+inline int f3348_23(int x) { return x * 23; }
+inline int f3348_24(int x) { return x * 24; }
+inline int f3348_25(int x) { return x * 25; }
+inline int f3348_26(int x) { return x * 26; }
+inline int f3348_27(int x) { return x * 27; }
+inline int f3348_28(int x) { return x * 28; }
+inline int f3348_29(int x) { return x * 29; }
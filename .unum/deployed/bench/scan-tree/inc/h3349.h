@@ -0,0 +1,42 @@
+#pragma once
+/* header 3349 */
+#include <vector>
+#include "h7376.h"
+#include "h2500.h"
+#include "h1713.h"
+#include "h6866.h"
+#include "h7762.h"
+#ifdef X
+#include "h9604.h"
+#endif
+struct S3349 { int a; const char *s = "x//y"; };
+inline int f3349_0(int x) { return x * 0; }
+inline int f3349_1(int x) { return x * 1; }
+inline int f3349_2(int x) { return x * 2; }
+inline int f3349_3(int x) { return x * 3; }
+inline int f3349_4(int x) { return x * 4; }
+inline int f3349_5(int x) { return x * 5; }
+inline int f3349_6(int x) { return x * 6; }
+inline int f3349_7(int x) { return x * 7; }
+inline int f3349_8(int x) { return x * 8; }
+inline int f3349_9(int x) { return x * 9; }
+inline int f3349_10(int x) { return x * 10; }
+inline int f3349_11(int x) { return x * 11; }
+inline int f3349_12(int x) { return x * 12; }
+inline int f3349_13(int x) { return x * 13; }
+inline int f3349_14(int x) { return x * 14; }
+inline int f3349_15(int x) { return x * 15; }
+inline int f3349_16(int x) { return x * 16; }
+inline int f3349_17(int x) { return x * 17; }
+inline int f3349_18(int x) { return x * 18; }
+inline int f3349_19(int x) { return x * 19; }
+inline int f3349_20(int x) { return x * 20; }
+inline int f3349_21(int x) { return x * 21; }
+inline int f3349_22(int x) { return x * 22; }
+inline int f3349_23(int x) { return x * 23; }
+inline int f3349_24(int x) { return x * 24; }
+inline int f3349_25(int x) { return x * 25; }
+inline int f3349_26(int x) { return x * 26; }
+inline int f3349_27(int x) { return x * 27; }
+inline int f3349_28(int x) { return x * 28; }
+inline int f3349_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3350 */
+#include <vector>
+#include "h6941.h"
+#include "h3076.h"
+#include "h522.h"
+#include "h6035.h"
+#include "h7345.h"
+#ifdef X
+#include "h9957.h"
+#endif
+struct S3350 { int a; const char *s = "x//y"; };
+inline int f3350_0(int x) { return x * 0; }
+inline int f3350_1(int x) { return x * 1; }
+inline int f3350_2(int x) { return x * 2; }
+inline int f3350_3(int x) { return x * 3; }
+inline int f3350_4(int x) { return x * 4; }
+inline int f3350_5(int x) { return x * 5; }
+inline int f3350_6(int x) { return x * 6; }
+inline int f3350_7(int x) { return x * 7; }
+inline int f3350_8(int x) { return x * 8; }
+inline int f3350_9(int x) { return x * 9; }
+inline int f3350_10(int x) { return x * 10; }
+inline int f3350_11(int x) { return x * 11; }
+inline int f3350_12(int x) { return x * 12; }
+inline int f3350_13(int x) { return x * 13; }
+inline int f3350_14(int x) { return x * 14; }
+inline int f3350_15(int x) { return x * 15; }
+inline int f3350_16(int x) { return x * 16; }
+inline int f3350_17(int x) { return x * 17; }
+inline int f3350_18(int x) { return x * 18; }
+inline int f3350_19(int x) { return x * 19; }
+inline int f3350_20(int x) { return x * 20; }
+inline int f3350_21(int x) { return x * 21; }
+inline int f3350_22(int x) { return x * 22; }
+inline int f3350_23(int x) { return x * 23; }
+inline int f3350_24(int x) { return x * 24; }
+inline int f3350_25(int x) { return x * 25; }
+inline int f3350_26(int x) { return x * 26; }
+inline int f3350_27(int x) { return x * 27; }
+inline int f3350_28(int x) { return x * 28; }
+inline int f3350_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3352 */
+#include <vector>
+#include "h7096.h"
+#include "h9656.h"
+#include "h4495.h"
+#include "h7709.h"
+#include "h3662.h"
+#ifdef X
+#include "h9352.h"
+#endif
+struct S3352 { int a; const char *s = "x//y"; };
+inline int f3352_0(int x) { return x * 0; }
+inline int f3352_1(int x) { return x * 1; }
+inline int f3352_2(int x) { return x * 2; }
+inline int f3352_3(int x) { return x * 3; }
+inline int f3352_4(int x) { return x * 4; }
+inline int f3352_5(int x) { return x * 5; }
+inline int f3352_6(int x) { return x * 6; }
+inline int f3352_7(int x) { return x * 7; }
+inline int f3352_8(int x) { return x * 8; }
+inline int f3352_9(int x) { return x * 9; }
+inline int f3352_10(int x) { return x * 10; }
+inline int f3352_11(int x) { return x * 11; }
+inline int f3352_12(int x) { return x * 12; }
+inline int f3352_13(int x) { return x * 13; }
+inline int f3352_14(int x) { return x * 14; }
+inline int f3352_15(int x) { return x * 15; }
+inline int f3352_16(int x) { return x * 16; }
+inline int f3352_17(int x) { return x * 17; }
+inline int f3352_18(int x) { return x * 18; }
+inline int f3352_19(int x) { return x * 19; }
+inline int f3352_20(int x) { return x * 20; }
+inline int f3352_21(int x) { return x * 21; }
+inline int f3352_22(int x) { return x * 22; }
+inline int f3352_23(int x) { return x * 23; }
+inline int f3352_24(int x) { return x * 24; }
+inline int f3352_25(int x) { return x * 25; }
+inline int f3352_26(int x) { return x * 26; }
+inline int f3352_27(int x) { return x * 27; }
+inline int f3352_28(int x) { return x * 28; }
+inline int f3352_29(int x) { return x * 29; }
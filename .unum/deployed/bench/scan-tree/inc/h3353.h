@@ -0,0 +1,42 @@
+#pragma once
+/* header 3353 */
+#include <vector>
+#include "h4024.h"
+#include "h1647.h"
+#include "h9404.h"
+#include "h732.h"
+#include "h7755.h"
+#ifdef X
+#include "h1396.h"
+#endif
+struct S3353 { int a; const char *s = "x//y"; };
+inline int f3353_0(int x) { return x * 0; }
+inline int f3353_1(int x) { return x * 1; }
+inline int f3353_2(int x) { return x * 2; }
+inline int f3353_3(int x) { return x * 3; }
+inline int f3353_4(int x) { return x * 4; }
+inline int f3353_5(int x) { return x * 5; }
+inline int f3353_6(int x) { return x * 6; }
+inline int f3353_7(int x) { return x * 7; }
+inline int f3353_8(int x) { return x * 8; }
+inline int f3353_9(int x) { return x * 9; }
+inline int f3353_10(int x) { return x * 10; }
+inline int f3353_11(int x) { return x * 11; }
+inline int f3353_12(int x) { return x * 12; }
+inline int f3353_13(int x) { return x * 13; }
+inline int f3353_14(int x) { return x * 14; }
+inline int f3353_15(int x) { return x * 15; }
+inline int f3353_16(int x) { return x * 16; }
+inline int f3353_17(int x) { return x * 17; }
+inline int f3353_18(int x) { return x * 18; }
+inline int f3353_19(int x) { return x * 19; }
+inline int f3353_20(int x) { return x * 20; }
+inline int f3353_21(int x) { return x * 21; }
+inline int f3353_22(int x) { return x * 22; }
+inline int f3353_23(int x) { return x * 23; }
+inline int f3353_24(int x) { return x * 24; }
+inline int f3353_25(int x) { return x * 25; }
+inline int f3353_26(int x) { return x * 26; }
+inline int f3353_27(int x) { return x * 27; }
+inline int f3353_28(int x) { return x * 28; }
+inline int f3353_29(int x) { return x * 29; }
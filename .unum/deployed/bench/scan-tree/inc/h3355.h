@@ -0,0 +1,42 @@
+#pragma once
+/* header 3355 */
+#include <vector>
+#include "h1095.h"
+#include "h5810.h"
+#include "h8078.h"
+#include "h6017.h"
+#include "h4495.h"
+#ifdef X
+#include "h8450.h"
+#endif
+struct S3355 { int a; const char *s = "x//y"; };
+inline int f3355_0(int x) { return x * 0; }
+inline int f3355_1(int x) { return x * 1; }
+inline int f3355_2(int x) { return x * 2; }
+inline int f3355_3(int x) { return x * 3; }
+inline int f3355_4(int x) { return x * 4; }
+inline int f3355_5(int x) { return x * 5; }
+inline int f3355_6(int x) { return x * 6; }
+inline int f3355_7(int x) { return x * 7; }
+inline int f3355_8(int x) { return x * 8; }
+inline int f3355_9(int x) { return x * 9; }
+inline int f3355_10(int x) { return x * 10; }
+inline int f3355_11(int x) { return x * 11; }
+inline int f3355_12(int x) { return x * 12; }
+inline int f3355_13(int x) { return x * 13; }
+inline int f3355_14(int x) { return x * 14; }
+inline int f3355_15(int x) { return x * 15; }
+inline int f3355_16(int x) { return x * 16; }
+inline int f3355_17(int x) { return x * 17; }
+inline int f3355_18(int x) { return x * 18; }
+inline int f3355_19(int x) { return x * 19; }
+inline int f3355_20(int x) { return x * 20; }
+inline int f3355_21(int x) { return x * 21; }
+inline int f3355_22(int x) { return x * 22; }
+inline int f3355_23(int x) { return x * 23; }
+inline int f3355_24(int x) { return x * 24; }
+inline int f3355_25(int x) { return x * 25; }
+inline int f3355_26(int x) { return x * 26; }
+inline int f3355_27(int x) { return x * 27; }
+inline int f3355_28(int x) { return x * 28; }
+inline int f3355_29(int x) { return x * 29; }
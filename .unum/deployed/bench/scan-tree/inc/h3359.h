@@ -0,0 +1,42 @@
+#pragma once
+/* header 3359 */
+#include <vector>
+#include "h9819.h"
+#include "h2698.h"
+#include "h852.h"
+#include "h5186.h"
+#include "h8513.h"
+#ifdef X
+#include "h7807.h"
+#endif
+struct S3359 { int a; const char *s = "x//y"; };
+inline int f3359_0(int x) { return x * 0; }
+inline int f3359_1(int x) { return x * 1; }
+inline int f3359_2(int x) { return x * 2; }
+inline int f3359_3(int x) { return x * 3; }
+inline int f3359_4(int x) { return x * 4; }
+inline int f3359_5(int x) { return x * 5; }
+inline int f3359_6(int x) { return x * 6; }
+inline int f3359_7(int x) { return x * 7; }
+inline int f3359_8(int x) { return x * 8; }
+inline int f3359_9(int x) { return x * 9; }
+inline int f3359_10(int x) { return x * 10; }
+inline int f3359_11(int x) { return x * 11; }
+inline int f3359_12(int x) { return x * 12; }
+inline int f3359_13(int x) { return x * 13; }
+inline int f3359_14(int x) { return x * 14; }
+inline int f3359_15(int x) { return x * 15; }
+inline int f3359_16(int x) { return x * 16; }
+inline int f3359_17(int x) { return x * 17; }
+inline int f3359_18(int x) { return x * 18; }
+inline int f3359_19(int x) { return x * 19; }
+inline int f3359_20(int x) { return x * 20; }
+inline int f3359_21(int x) { return x * 21; }
+inline int f3359_22(int x) { return x * 22; }
+inline int f3359_23(int x) { return x * 23; }
+inline int f3359_24(int x) { return x * 24; }
+inline int f3359_25(int x) { return x * 25; }
+inline int f3359_26(int x) { return x * 26; }
+inline int f3359_27(int x) { return x * 27; }
+inline int f3359_28(int x) { return x * 28; }
+inline int f3359_29(int x) { return x * 29; }
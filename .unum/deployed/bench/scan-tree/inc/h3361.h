@@ -0,0 +1,42 @@
+#pragma once
+/* header 3361 */
+#include <vector>
+#include "h8917.h"
+#include "h73.h"
+#include "h3535.h"
+#include "h6217.h"
+#include "h4752.h"
+#ifdef X
+#include "h6126.h"
+#endif
+struct S3361 { int a; const char *s = "x//y"; };
+inline int f3361_0(int x) { return x * 0; }
+inline int f3361_1(int x) { return x * 1; }
+inline int f3361_2(int x) { return x * 2; }
+inline int f3361_3(int x) { return x * 3; }
+inline int f3361_4(int x) { return x * 4; }
+inline int f3361_5(int x) { return x * 5; }
+inline int f3361_6(int x) { return x * 6; }
+inline int f3361_7(int x) { return x * 7; }
+inline int f3361_8(int x) { return x * 8; }
+inline int f3361_9(int x) { return x * 9; }
+inline int f3361_10(int x) { return x * 10; }
+inline int f3361_11(int x) { return x * 11; }
+inline int f3361_12(int x) { return x * 12; }
+inline int f3361_13(int x) { return x * 13; }
+inline int f3361_14(int x) { return x * 14; }
+inline int f3361_15(int x) { return x * 15; }
+inline int f3361_16(int x) { return x * 16; }
+inline int f3361_17(int x) { return x * 17; }
+inline int f3361_18(int x) { return x * 18; }
+inline int f3361_19(int x) { return x * 19; }
+inline int f3361_20(int x) { return x * 20; }
+inline int f3361_21(int x) { return x * 21; }
+inline int f3361_22(int x) { return x * 22; }
+inline int f3361_23(int x) { return x * 23; }
+inline int f3361_24(int x) { return x * 24; }
+inline int f3361_25(int x) { return x * 25; }
+inline int f3361_26(int x) { return x * 26; }
+inline int f3361_27(int x) { return x * 27; }
+inline int f3361_28(int x) { return x * 28; }
+inline int f3361_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3365 */
+#include <vector>
+#include "h2471.h"
+#include "h5684.h"
+#include "h1833.h"
+#include "h7354.h"
+#include "h6403.h"
+#ifdef X
+#include "h3261.h"
+#endif
+struct S3365 { int a; const char *s = "x//y"; };
+inline int f3365_0(int x) { return x * 0; }
+inline int f3365_1(int x) { return x * 1; }
+inline int f3365_2(int x) { return x * 2; }
+inline int f3365_3(int x) { return x * 3; }
+inline int f3365_4(int x) { return x * 4; }
+inline int f3365_5(int x) { return x * 5; }
+inline int f3365_6(int x) { return x * 6; }
+inline int f3365_7(int x) { return x * 7; }
+inline int f3365_8(int x) { return x * 8; }
+inline int f3365_9(int x) { return x * 9; }
+inline int f3365_10(int x) { return x * 10; }
+inline int f3365_11(int x) { return x * 11; }
+inline int f3365_12(int x) { return x * 12; }
+inline int f3365_13(int x) { return x * 13; }
+inline int f3365_14(int x) { return x * 14; }
+inline int f3365_15(int x) { return x * 15; }
+inline int f3365_16(int x) { return x * 16; }
+inline int f3365_17(int x) { return x * 17; }
+inline int f3365_18(int x) { return x * 18; }
+inline int f3365_19(int x) { return x * 19; }
+inline int f3365_20(int x) { return x * 20; }
+inline int f3365_21(int x) { return x * 21; }
+inline int f3365_22(int x) { return x * 22; }
+inline int f3365_23(int x) { return x * 23; }
+inline int f3365_24(int x) { return x * 24; }
+inline int f3365_25(int x) { return x * 25; }
+inline int f3365_26(int x) { return x * 26; }
+inline int f3365_27(int x) { return x * 27; }
+inline int f3365_28(int x) { return x * 28; }
+inline int f3365_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3367 */
+#include <vector>
+#include "h8290.h"
+#include "h2265.h"
+#include "h1633.h"
+#include "h5962.h"
+#include "h7853.h"
+#ifdef X
+#include "h5151.h"
+#endif
+struct S3367 { int a; const char *s = "x//y"; };
+inline int f3367_0(int x) { return x * 0; }
+inline int f3367_1(int x) { return x * 1; }
+inline int f3367_2(int x) { return x * 2; }
+inline int f3367_3(int x) { return x * 3; }
+inline int f3367_4(int x) { return x * 4; }
+inline int f3367_5(int x) { return x * 5; }
+inline int f3367_6(int x) { return x * 6; }
+inline int f3367_7(int x) { return x * 7; }
+inline int f3367_8(int x) { return x * 8; }
+inline int f3367_9(int x) { return x * 9; }
+inline int f3367_10(int x) { return x * 10; }
+inline int f3367_11(int x) { return x * 11; }
+inline int f3367_12(int x) { return x * 12; }
+inline int f3367_13(int x) { return x * 13; }
+inline int f3367_14(int x) { return x * 14; }
+inline int f3367_15(int x) { return x * 15; }
+inline int f3367_16(int x) { return x * 16; }
+inline int f3367_17(int x) { return x * 17; }
+inline int f3367_18(int x) { return x * 18; }
+inline int f3367_19(int x) { return x * 19; }
+inline int f3367_20(int x) { return x * 20; }
+inline int f3367_21(int x) { return x * 21; }
+inline int f3367_22(int x) { return x * 22; }
+inline int f3367_23(int x) { return x * 23; }
+inline int f3367_24(int x) { return x * 24; }
+inline int f3367_25(int x) { return x * 25; }
+inline int f3367_26(int x) { return x * 26; }
+inline int f3367_27(int x) { return x * 27; }
+inline int f3367_28(int x) { return x * 28; }
+inline int f3367_29(int x) { return x * 29; }
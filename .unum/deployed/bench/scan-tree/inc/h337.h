@@ -0,0 +1,42 @@
+#pragma once
+/* header 337 */
+#include <vector>
+#include "h8214.h"
+#include "h7811.h"
+#include "h865.h"
+#include "h2613.h"
+#include "h8303.h"
+#ifdef X
+#include "h763.h"
+#endif
+struct S337 { int a; const char *s = "x//y"; };
+inline int f337_0(int x) { return x * 0; }
+inline int f337_1(int x) { return x * 1; }
+inline int f337_2(int x) { return x * 2; }
+inline int f337_3(int x) { return x * 3; }
+inline int f337_4(int x) { return x * 4; }
+inline int f337_5(int x) { return x * 5; }
+inline int f337_6(int x) { return x * 6; }
+inline int f337_7(int x) { return x * 7; }
+inline int f337_8(int x) { return x * 8; }
+inline int f337_9(int x) { return x * 9; }
+inline int f337_10(int x) { return x * 10; }
+inline int f337_11(int x) { return x * 11; }
+inline int f337_12(int x) { return x * 12; }
+inline int f337_13(int x) { return x * 13; }
+inline int f337_14(int x) { return x * 14; }
+inline int f337_15(int x) { return x * 15; }
+inline int f337_16(int x) { return x * 16; }
+inline int f337_17(int x) { return x * 17; }
+inline int f337_18(int x) { return x * 18; }
+inline int f337_19(int x) { return x * 19; }
+inline int f337_20(int x) { return x * 20; }
+inline int f337_21(int x) { return x * 21; }
+inline int f337_22(int x) { return x * 22; }
+inline int f337_23(int x) { return x * 23; }
+inline int f337_24(int x) { return x * 24; }
+inline int f337_25(int x) { return x * 25; }
+inline int f337_26(int x) { return x * 26; }
+inline int f337_27(int x) { return x * 27; }
+inline int f337_28(int x) { return x * 28; }
+inline int f337_29(int x) { return x * 29; }
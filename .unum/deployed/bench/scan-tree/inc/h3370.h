@@ -0,0 +1,42 @@
+#pragma once
+/* header 3370 */
+#include <vector>
+#include "h9095.h"
+#include "h7924.h"
+#include "h8635.h"
+#include "h9546.h"
+#include "h2470.h"
+#ifdef X
+#include "h3137.h"
+#endif
+struct S3370 { int a; const char *s = "x//y"; };
+inline int f3370_0(int x) { return x * 0; }
+inline int f3370_1(int x) { return x * 1; }
+inline int f3370_2(int x) { return x * 2; }
+inline int f3370_3(int x) { return x * 3; }
+inline int f3370_4(int x) { return x * 4; }
+inline int f3370_5(int x) { return x * 5; }
+inline int f3370_6(int x) { return x * 6; }
+inline int f3370_7(int x) { return x * 7; }
+inline int f3370_8(int x) { return x * 8; }
+inline int f3370_9(int x) { return x * 9; }
+inline int f3370_10(int x) { return x * 10; }
+inline int f3370_11(int x) { return x * 11; }
+inline int f3370_12(int x) { return x * 12; }
+inline int f3370_13(int x) { return x * 13; }
+inline int f3370_14(int x) { return x * 14; }
+inline int f3370_15(int x) { return x * 15; }
+inline int f3370_16(int x) { return x * 16; }
+inline int f3370_17(int x) { return x * 17; }
+inline int f3370_18(int x) { return x * 18; }
+inline int f3370_19(int x) { return x * 19; }
+inline int f3370_20(int x) { return x * 20; }
+inline int f3370_21(int x) { return x * 21; }
+inline int f3370_22(int x) { return x * 22; }
+inline int f3370_23(int x) { return x * 23; }
+inline int f3370_24(int x) { return x * 24; }
+inline int f3370_25(int x) { return x * 25; }
+inline int f3370_26(int x) { return x * 26; }
+inline int f3370_27(int x) { return x * 27; }
+inline int f3370_28(int x) { return x * 28; }
+inline int f3370_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3371 */
+#include <vector>
+#include "h9025.h"
+#include "h5829.h"
+#include "h9817.h"
+#include "h5490.h"
+#include "h8824.h"
+#ifdef X
+#include "h6187.h"
+#endif
+struct S3371 { int a; const char *s = "x//y"; };
+inline int f3371_0(int x) { return x * 0; }
+inline int f3371_1(int x) { return x * 1; }
+inline int f3371_2(int x) { return x * 2; }
+inline int f3371_3(int x) { return x * 3; }
+inline int f3371_4(int x) { return x * 4; }
+inline int f3371_5(int x) { return x * 5; }
+inline int f3371_6(int x) { return x * 6; }
+inline int f3371_7(int x) { return x * 7; }
+inline int f3371_8(int x) { return x * 8; }
+inline int f3371_9(int x) { return x * 9; }
+inline int f3371_10(int x) { return x * 10; }
+inline int f3371_11(int x) { return x * 11; }
+inline int f3371_12(int x) { return x * 12; }
+inline int f3371_13(int x) { return x * 13; }
+inline int f3371_14(int x) { return x * 14; }
+inline int f3371_15(int x) { return x * 15; }
+inline int f3371_16(int x) { return x * 16; }
+inline int f3371_17(int x) { return x * 17; }
+inline int f3371_18(int x) { return x * 18; }
+inline int f3371_19(int x) { return x * 19; }
+inline int f3371_20(int x) { return x * 20; }
+inline int f3371_21(int x) { return x * 21; }
+inline int f3371_22(int x) { return x * 22; }
+inline int f3371_23(int x) { return x * 23; }
+inline int f3371_24(int x) { return x * 24; }
+inline int f3371_25(int x) { return x * 25; }
+inline int f3371_26(int x) { return x * 26; }
+inline int f3371_27(int x) { return x * 27; }
+inline int f3371_28(int x) { return x * 28; }
+inline int f3371_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3374 */
+#include <vector>
+#include "h2120.h"
+#include "h1669.h"
+#include "h1265.h"
+#include "h387.h"
+#include "h3957.h"
+#ifdef X
+#include "h4869.h"
+#endif
+struct S3374 { int a; const char *s = "x//y"; };
+inline int f3374_0(int x) { return x * 0; }
+inline int f3374_1(int x) { return x * 1; }
+inline int f3374_2(int x) { return x * 2; }
+inline int f3374_3(int x) { return x * 3; }
+inline int f3374_4(int x) { return x * 4; }
+inline int f3374_5(int x) { return x * 5; }
+inline int f3374_6(int x) { return x * 6; }
+inline int f3374_7(int x) { return x * 7; }
+inline int f3374_8(int x) { return x * 8; }
+inline int f3374_9(int x) { return x * 9; }
+inline int f3374_10(int x) { return x * 10; }
+inline int f3374_11(int x) { return x * 11; }
+inline int f3374_12(int x) { return x * 12; }
+inline int f3374_13(int x) { return x * 13; }
+inline int f3374_14(int x) { return x * 14; }
+inline int f3374_15(int x) { return x * 15; }
+inline int f3374_16(int x) { return x * 16; }
+inline int f3374_17(int x) { return x * 17; }
+inline int f3374_18(int x) { return x * 18; }
+inline int f3374_19(int x) { return x * 19; }
+inline int f3374_20(int x) { return x * 20; }
+inline int f3374_21(int x) { return x * 21; }
+inline int f3374_22(int x) { return x * 22; }
+inline int f3374_23(int x) { return x * 23; }
+inline int f3374_24(int x) { return x * 24; }
+inline int f3374_25(int x) { return x * 25; }
+inline int f3374_26(int x) { return x * 26; }
+inline int f3374_27(int x) { return x * 27; }
+inline int f3374_28(int x) { return x * 28; }
+inline int f3374_29(int x) { return x * 29; }
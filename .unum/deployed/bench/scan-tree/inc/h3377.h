@@ -0,0 +1,42 @@
+#pragma once
+/* header 3377 */
+#include <vector>
+#include "h3132.h"
+#include "h1079.h"
+#include "h9388.h"
+#include "h3283.h"
+#include "h1038.h"
+#ifdef X
+#include "h2187.h"
+#endif
+struct S3377 { int a; const char *s = "x//y"; };
+inline int f3377_0(int x) { return x * 0; }
+inline int f3377_1(int x) { return x * 1; }
+inline int f3377_2(int x) { return x * 2; }
+inline int f3377_3(int x) { return x * 3; }
+inline int f3377_4(int x) { return x * 4; }
+inline int f3377_5(int x) { return x * 5; }
+inline int f3377_6(int x) { return x * 6; }
+inline int f3377_7(int x) { return x * 7; }
+inline int f3377_8(int x) { return x * 8; }
+inline int f3377_9(int x) { return x * 9; }
+inline int f3377_10(int x) { return x * 10; }
+inline int f3377_11(int x) { return x * 11; }
+inline int f3377_12(int x) { return x * 12; }
+inline int f3377_13(int x) { return x * 13; }
+inline int f3377_14(int x) { return x * 14; }
+inline int f3377_15(int x) { return x * 15; }
+inline int f3377_16(int x) { return x * 16; }
+inline int f3377_17(int x) { return x * 17; }
+inline int f3377_18(int x) { return x * 18; }
+inline int f3377_19(int x) { return x * 19; }
+inline int f3377_20(int x) { return x * 20; }
+inline int f3377_21(int x) { return x * 21; }
+inline int f3377_22(int x) { return x * 22; }
+inline int f3377_23(int x) { return x * 23; }
+inline int f3377_24(int x) { return x * 24; }
+inline int f3377_25(int x) { return x * 25; }
+inline int f3377_26(int x) { return x * 26; }
+inline int f3377_27(int x) { return x * 27; }
+inline int f3377_28(int x) { return x * 28; }
+inline int f3377_29(int x) { return x * 29; }
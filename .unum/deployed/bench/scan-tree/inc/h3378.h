@@ -0,0 +1,42 @@
+#pragma once
+/* header 3378 */
+#include <vector>
+#include "h1746.h"
+#include "h4989.h"
+#include "h3549.h"
+#include "h1477.h"
+#include "h898.h"
+#ifdef X
+#include "h9037.h"
+#endif
+struct S3378 { int a; const char *s = "x//y"; };
+inline int f3378_0(int x) { return x * 0; }
+inline int f3378_1(int x) { return x * 1; }
+inline int f3378_2(int x) { return x * 2; }
+inline int f3378_3(int x) { return x * 3; }
+inline int f3378_4(int x) { return x * 4; }
+inline int f3378_5(int x) { return x * 5; }
+inline int f3378_6(int x) { return x * 6; }
+inline int f3378_7(int x) { return x * 7; }
+inline int f3378_8(int x) { return x * 8; }
+inline int f3378_9(int x) { return x * 9; }
+inline int f3378_10(int x) { return x * 10; }
+inline int f3378_11(int x) { return x * 11; }
+inline int f3378_12(int x) { return x * 12; }
+inline int f3378_13(int x) { return x * 13; }
+inline int f3378_14(int x) { return x * 14; }
+inline int f3378_15(int x) { return x * 15; }
+inline int f3378_16(int x) { return x * 16; }
+inline int f3378_17(int x) { return x * 17; }
+inline int f3378_18(int x) { return x * 18; }
+inline int f3378_19(int x) { return x * 19; }
+inline int f3378_20(int x) { return x * 20; }
+inline int f3378_21(int x) { return x * 21; }
+inline int f3378_22(int x) { return x * 22; }
+inline int f3378_23(int x) { return x * 23; }
+inline int f3378_24(int x) { return x * 24; }
+inline int f3378_25(int x) { return x * 25; }
+inline int f3378_26(int x) { return x * 26; }
+inline int f3378_27(int x) { return x * 27; }
+inline int f3378_28(int x) { return x * 28; }
+inline int f3378_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3379 */
+#include <vector>
+#include "h6227.h"
+#include "h2417.h"
+#include "h5083.h"
+#include "h5372.h"
+#include "h4638.h"
+#ifdef X
+#include "h9715.h"
+#endif
+struct S3379 { int a; const char *s = "x//y"; };
+inline int f3379_0(int x) { return x * 0; }
+inline int f3379_1(int x) { return x * 1; }
+inline int f3379_2(int x) { return x * 2; }
+inline int f3379_3(int x) { return x * 3; }
+inline int f3379_4(int x) { return x * 4; }
+inline int f3379_5(int x) { return x * 5; }
+inline int f3379_6(int x) { return x * 6; }
+inline int f3379_7(int x) { return x * 7; }
+inline int f3379_8(int x) { return x * 8; }
+inline int f3379_9(int x) { return x * 9; }
+inline int f3379_10(int x) { return x * 10; }
+inline int f3379_11(int x) { return x * 11; }
+inline int f3379_12(int x) { return x * 12; }
+inline int f3379_13(int x) { return x * 13; }
+inline int f3379_14(int x) { return x * 14; }
+inline int f3379_15(int x) { return x * 15; }
+inline int f3379_16(int x) { return x * 16; }
+inline int f3379_17(int x) { return x * 17; }
+inline int f3379_18(int x) { return x * 18; }
+inline int f3379_19(int x) { return x * 19; }
+inline int f3379_20(int x) { return x * 20; }
+inline int f3379_21(int x) { return x * 21; }
+inline int f3379_22(int x) { return x * 22; }
+inline int f3379_23(int x) { return x * 23; }
+inline int f3379_24(int x) { return x * 24; }
+inline int f3379_25(int x) { return x * 25; }
+inline int f3379_26(int x) { return x * 26; }
+inline int f3379_27(int x) { return x * 27; }
+inline int f3379_28(int x) { return x * 28; }
+inline int f3379_29(int x) { return x * 29; }
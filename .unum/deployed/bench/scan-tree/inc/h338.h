@@ -0,0 +1,42 @@
+#pragma once
+/* header 338 */
+#include <vector>
+#include "h5393.h"
+#include "h7837.h"
+#include "h8403.h"
+#include "h8922.h"
+#include "h322.h"
+#ifdef X
+#include "h2804.h"
+#endif
+struct S338 { int a; const char *s = "x//y"; };
+inline int f338_0(int x) { return x * 0; }
+inline int f338_1(int x) { return x * 1; }
+inline int f338_2(int x) { return x * 2; }
+inline int f338_3(int x) { return x * 3; }
+inline int f338_4(int x) { return x * 4; }
+inline int f338_5(int x) { return x * 5; }
+inline int f338_6(int x) { return x * 6; }
+inline int f338_7(int x) { return x * 7; }
+inline int f338_8(int x) { return x * 8; }
+inline int f338_9(int x) { return x * 9; }
+inline int f338_10(int x) { return x * 10; }
+inline int f338_11(int x) { return x * 11; }
+inline int f338_12(int x) { return x * 12; }
+inline int f338_13(int x) { return x * 13; }
+inline int f338_14(int x) { return x * 14; }
+inline int f338_15(int x) { return x * 15; }
+inline int f338_16(int x) { return x * 16; }
+inline int f338_17(int x) { return x * 17; }
+inline int f338_18(int x) { return x * 18; }
+inline int f338_19(int x) { return x * 19; }
+inline int f338_20(int x) { return x * 20; }
+inline int f338_21(int x) { return x * 21; }
+inline int f338_22(int x) { return x * 22; }
+inline int f338_23(int x) { return x * 23; }
+inline int f338_24(int x) { return x * 24; }
+inline int f338_25(int x) { return x * 25; }
+inline int f338_26(int x) { return x * 26; }
+inline int f338_27(int x) { return x * 27; }
+inline int f338_28(int x) { return x * 28; }
+inline int f338_29(int x) { return x * 29; }
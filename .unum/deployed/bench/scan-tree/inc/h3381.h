@@ -0,0 +1,42 @@
+#pragma once
+/* header 3381 */
+#include <vector>
+#include "h1909.h"
+#include "h3764.h"
+#include "h8696.h"
+#include "h4755.h"
+#include "h5267.h"
+#ifdef X
+#include "h4527.h"
+#endif
+struct S3381 { int a; const char *s = "x//y"; };
+inline int f3381_0(int x) { return x * 0; }
+inline int f3381_1(int x) { return x * 1; }
+inline int f3381_2(int x) { return x * 2; }
+inline int f3381_3(int x) { return x * 3; }
+inline int f3381_4(int x) { return x * 4; }
+inline int f3381_5(int x) { return x * 5; }
+inline int f3381_6(int x) { return x * 6; }
+inline int f3381_7(int x) { return x * 7; }
+inline int f3381_8(int x) { return x * 8; }
+inline int f3381_9(int x) { return x * 9; }
+inline int f3381_10(int x) { return x * 10; }
+inline int f3381_11(int x) { return x * 11; }
+inline int f3381_12(int x) { return x * 12; }
+inline int f3381_13(int x) { return x * 13; }
+inline int f3381_14(int x) { return x * 14; }
+inline int f3381_15(int x) { return x * 15; }
+inline int f3381_16(int x) { return x * 16; }
+inline int f3381_17(int x) { return x * 17; }
+inline int f3381_18(int x) { return x * 18; }
+inline int f3381_19(int x) { return x * 19; }
+inline int f3381_20(int x) { return x * 20; }
+inline int f3381_21(int x) { return x * 21; }
+inline int f3381_22(int x) { return x * 22; }
+inline int f3381_23(int x) { return x * 23; }
+inline int f3381_24(int x) { return x * 24; }
+inline int f3381_25(int x) { return x * 25; }
+inline int f3381_26(int x) { return x * 26; }
+inline int f3381_27(int x) { return x * 27; }
+inline int f3381_28(int x) { return x * 28; }
+inline int f3381_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3385 */
+#include <vector>
+#include "h1741.h"
+#include "h7380.h"
+#include "h7814.h"
+#include "h7799.h"
+#include "h6770.h"
+#ifdef X
+#include "h2051.h"
+#endif
+struct S3385 { int a; const char *s = "x//y"; };
+inline int f3385_0(int x) { return x * 0; }
+inline int f3385_1(int x) { return x * 1; }
+inline int f3385_2(int x) { return x * 2; }
+inline int f3385_3(int x) { return x * 3; }
+inline int f3385_4(int x) { return x * 4; }
+inline int f3385_5(int x) { return x * 5; }
+inline int f3385_6(int x) { return x * 6; }
+inline int f3385_7(int x) { return x * 7; }
+inline int f3385_8(int x) { return x * 8; }
+inline int f3385_9(int x) { return x * 9; }
+inline int f3385_10(int x) { return x * 10; }
+inline int f3385_11(int x) { return x * 11; }
+inline int f3385_12(int x) { return x * 12; }
+inline int f3385_13(int x) { return x * 13; }
+inline int f3385_14(int x) { return x * 14; }
+inline int f3385_15(int x) { return x * 15; }
+inline int f3385_16(int x) { return x * 16; }
+inline int f3385_17(int x) { return x * 17; }
+inline int f3385_18(int x) { return x * 18; }
+inline int f3385_19(int x) { return x * 19; }
+inline int f3385_20(int x) { return x * 20; }
+inline int f3385_21(int x) { return x * 21; }
+inline int f3385_22(int x) { return x * 22; }
+inline int f3385_23(int x) { return x * 23; }
+inline int f3385_24(int x) { return x * 24; }
+inline int f3385_25(int x) { return x * 25; }
+inline int f3385_26(int x) { return x * 26; }
+inline int f3385_27(int x) { return x * 27; }
+inline int f3385_28(int x) { return x * 28; }
+inline int f3385_29(int x) { return x * 29; }
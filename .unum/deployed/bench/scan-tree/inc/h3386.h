@@ -0,0 +1,42 @@
+#pragma once
+/* header 3386 */
+#include <vector>
+#include "h6845.h"
+#include "h408.h"
+#include "h6084.h"
+#include "h3938.h"
+#include "h1157.h"
+#ifdef X
+#include "h4422.h"
+#endif
+struct S3386 { int a; const char *s = "x//y"; };
+inline int f3386_0(int x) { return x * 0; }
+inline int f3386_1(int x) { return x * 1; }
+inline int f3386_2(int x) { return x * 2; }
+inline int f3386_3(int x) { return x * 3; }
+inline int f3386_4(int x) { return x * 4; }
+inline int f3386_5(int x) { return x * 5; }
+inline int f3386_6(int x) { return x * 6; }
+inline int f3386_7(int x) { return x * 7; }
+inline int f3386_8(int x) { return x * 8; }
+inline int f3386_9(int x) { return x * 9; }
+inline int f3386_10(int x) { return x * 10; }
+inline int f3386_11(int x) { return x * 11; }
+inline int f3386_12(int x) { return x * 12; }
+inline int f3386_13(int x) { return x * 13; }
+inline int f3386_14(int x) { return x * 14; }
+inline int f3386_15(int x) { return x * 15; }
+inline int f3386_16(int x) { return x * 16; }
+inline int f3386_17(int x) { return x * 17; }
+inline int f3386_18(int x) { return x * 18; }
+inline int f3386_19(int x) { return x * 19; }
+inline int f3386_20(int x) { return x * 20; }
+inline int f3386_21(int x) { return x * 21; }
+inline int f3386_22(int x) { return x * 22; }
+inline int f3386_23(int x) { return x * 23; }
+inline int f3386_24(int x) { return x * 24; }
+inline int f3386_25(int x) { return x * 25; }
+inline int f3386_26(int x) { return x * 26; }
+inline int f3386_27(int x) { return x * 27; }
+inline int f3386_28(int x) { return x * 28; }
+inline int f3386_29(int x) { return x * 29; }
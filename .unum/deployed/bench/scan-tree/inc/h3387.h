@@ -0,0 +1,42 @@
+#pragma once
+/* header 3387 */
+#include <vector>
+#include "h2876.h"
+#include "h5488.h"
+#include "h4160.h"
+#include "h913.h"
+#include "h4913.h"
+#ifdef X
+#include "h7006.h"
+#endif
+struct S3387 { int a; const char *s = "x//y"; };
+inline int f3387_0(int x) { return x * 0; }
+inline int f3387_1(int x) { return x * 1; }
+inline int f3387_2(int x) { return x * 2; }
+inline int f3387_3(int x) { return x * 3; }
+inline int f3387_4(int x) { return x * 4; }
+inline int f3387_5(int x) { return x * 5; }
+inline int f3387_6(int x) { return x * 6; }
+inline int f3387_7(int x) { return x * 7; }
+inline int f3387_8(int x) { return x * 8; }
+inline int f3387_9(int x) { return x * 9; }
+inline int f3387_10(int x) { return x * 10; }
+inline int f3387_11(int x) { return x * 11; }
+inline int f3387_12(int x) { return x * 12; }
+inline int f3387_13(int x) { return x * 13; }
+inline int f3387_14(int x) { return x * 14; }
+inline int f3387_15(int x) { return x * 15; }
+inline int f3387_16(int x) { return x * 16; }
+inline int f3387_17(int x) { return x * 17; }
+inline int f3387_18(int x) { return x * 18; }
+inline int f3387_19(int x) { return x * 19; }
+inline int f3387_20(int x) { return x * 20; }
+inline int f3387_21(int x) { return x * 21; }
+inline int f3387_22(int x) { return x * 22; }
+inline int f3387_23(int x) { return x * 23; }
+inline int f3387_24(int x) { return x * 24; }
+inline int f3387_25(int x) { return x * 25; }
+inline int f3387_26(int x) { return x * 26; }
+inline int f3387_27(int x) { return x * 27; }
+inline int f3387_28(int x) { return x * 28; }
+inline int f3387_29(int x) { return x * 29; }
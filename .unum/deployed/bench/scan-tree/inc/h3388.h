@@ -0,0 +1,42 @@
+#pragma once
+/* header 3388 */
+#include <vector>
+#include "h7159.h"
+#include "h1920.h"
+#include "h241.h"
+#include "h8878.h"
+#include "h1755.h"
+#ifdef X
+#include "h4030.h"
+#endif
+struct S3388 { int a; const char *s = "x//y"; };
+inline int f3388_0(int x) { return x * 0; }
+inline int f3388_1(int x) { return x * 1; }
+inline int f3388_2(int x) { return x * 2; }
+inline int f3388_3(int x) { return x * 3; }
+inline int f3388_4(int x) { return x * 4; }
+inline int f3388_5(int x) { return x * 5; }
+inline int f3388_6(int x) { return x * 6; }
+inline int f3388_7(int x) { return x * 7; }
+inline int f3388_8(int x) { return x * 8; }
+inline int f3388_9(int x) { return x * 9; }
+inline int f3388_10(int x) { return x * 10; }
+inline int f3388_11(int x) { return x * 11; }
+inline int f3388_12(int x) { return x * 12; }
+inline int f3388_13(int x) { return x * 13; }
+inline int f3388_14(int x) { return x * 14; }
+inline int f3388_15(int x) { return x * 15; }
+inline int f3388_16(int x) { return x * 16; }
+inline int f3388_17(int x) { return x * 17; }
+inline int f3388_18(int x) { return x * 18; }
+inline int f3388_19(int x) { return x * 19; }
+inline int f3388_20(int x) { return x * 20; }
+inline int f3388_21(int x) { return x * 21; }
+inline int f3388_22(int x) { return x * 22; }
+inline int f3388_23(int x) { return x * 23; }
+inline int f3388_24(int x) { return x * 24; }
+inline int f3388_25(int x) { return x * 25; }
+inline int f3388_26(int x) { return x * 26; }
+inline int f3388_27(int x) { return x * 27; }
+inline int f3388_28(int x) { return x * 28; }
+inline int f3388_29(int x) { return x * 29; }
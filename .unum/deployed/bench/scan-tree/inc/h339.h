@@ -0,0 +1,42 @@
+#pragma once
+/* header 339 */
+#include <vector>
+#include "h2874.h"
+#include "h1437.h"
+#include "h8815.h"
+#include "h6519.h"
+#include "h3676.h"
+#ifdef X
+#include "h1108.h"
+#endif
+struct S339 { int a; const char *s = "x//y"; };
+inline int f339_0(int x) { return x * 0; }
+inline int f339_1(int x) { return x * 1; }
+inline int f339_2(int x) { return x * 2; }
+inline int f339_3(int x) { return x * 3; }
+inline int f339_4(int x) { return x * 4; }
+inline int f339_5(int x) { return x * 5; }
+inline int f339_6(int x) { return x * 6; }
+inline int f339_7(int x) { return x * 7; }
+inline int f339_8(int x) { return x * 8; }
+inline int f339_9(int x) { return x * 9; }
+inline int f339_10(int x) { return x * 10; }
+inline int f339_11(int x) { return x * 11; }
+inline int f339_12(int x) { return x * 12; }
+inline int f339_13(int x) { return x * 13; }
+inline int f339_14(int x) { return x * 14; }
+inline int f339_15(int x) { return x * 15; }
+inline int f339_16(int x) { return x * 16; }
+inline int f339_17(int x) { return x * 17; }
+inline int f339_18(int x) { return x * 18; }
+inline int f339_19(int x) { return x * 19; }
+inline int f339_20(int x) { return x * 20; }
+inline int f339_21(int x) { return x * 21; }
+inline int f339_22(int x) { return x * 22; }
+inline int f339_23(int x) { return x * 23; }
+inline int f339_24(int x) { return x * 24; }
+inline int f339_25(int x) { return x * 25; }
+inline int f339_26(int x) { return x * 26; }
+inline int f339_27(int x) { return x * 27; }
+inline int f339_28(int x) { return x * 28; }
+inline int f339_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3394 */
+#include <vector>
+#include "h3770.h"
+#include "h5276.h"
+#include "h9686.h"
+#include "h8816.h"
+#include "h6600.h"
+#ifdef X
+#include "h3457.h"
+#endif
+struct S3394 { int a; const char *s = "x//y"; };
+inline int f3394_0(int x) { return x * 0; }
+inline int f3394_1(int x) { return x * 1; }
+inline int f3394_2(int x) { return x * 2; }
+inline int f3394_3(int x) { return x * 3; }
+inline int f3394_4(int x) { return x * 4; }
+inline int f3394_5(int x) { return x * 5; }
+inline int f3394_6(int x) { return x * 6; }
+inline int f3394_7(int x) { return x * 7; }
+inline int f3394_8(int x) { return x * 8; }
+inline int f3394_9(int x) { return x * 9; }
+inline int f3394_10(int x) { return x * 10; }
+inline int f3394_11(int x) { return x * 11; }
+inline int f3394_12(int x) { return x * 12; }
+inline int f3394_13(int x) { return x * 13; }
+inline int f3394_14(int x) { return x * 14; }
+inline int f3394_15(int x) { return x * 15; }
+inline int f3394_16(int x) { return x * 16; }
+inline int f3394_17(int x) { return x * 17; }
+inline int f3394_18(int x) { return x * 18; }
+inline int f3394_19(int x) { return x * 19; }
+inline int f3394_20(int x) { return x * 20; }
+inline int f3394_21(int x) { return x * 21; }
+inline int f3394_22(int x) { return x * 22; }
+inline int f3394_23(int x) { return x * 23; }
+inline int f3394_24(int x) { return x * 24; }
+inline int f3394_25(int x) { return x * 25; }
+inline int f3394_26(int x) { return x * 26; }
+inline int f3394_27(int x) { return x * 27; }
+inline int f3394_28(int x) { return x * 28; }
+inline int f3394_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3395 */
+#include <vector>
+#include "h2472.h"
+#include "h3036.h"
+#include "h8300.h"
+#include "h179.h"
+#include "h9140.h"
+#ifdef X
+#include "h2862.h"
+#endif
+struct S3395 { int a; const char *s = "x//y"; };
+inline int f3395_0(int x) { return x * 0; }
+inline int f3395_1(int x) { return x * 1; }
+inline int f3395_2(int x) { return x * 2; }
+inline int f3395_3(int x) { return x * 3; }
+inline int f3395_4(int x) { return x * 4; }
+inline int f3395_5(int x) { return x * 5; }
+inline int f3395_6(int x) { return x * 6; }
+inline int f3395_7(int x) { return x * 7; }
+inline int f3395_8(int x) { return x * 8; }
+inline int f3395_9(int x) { return x * 9; }
+inline int f3395_10(int x) { return x * 10; }
+inline int f3395_11(int x) { return x * 11; }
+inline int f3395_12(int x) { return x * 12; }
+inline int f3395_13(int x) { return x * 13; }
+inline int f3395_14(int x) { return x * 14; }
+inline int f3395_15(int x) { return x * 15; }
+inline int f3395_16(int x) { return x * 16; }
+inline int f3395_17(int x) { return x * 17; }
+inline int f3395_18(int x) { return x * 18; }
+inline int f3395_19(int x) { return x * 19; }
+inline int f3395_20(int x) { return x * 20; }
+inline int f3395_21(int x) { return x * 21; }
+inline int f3395_22(int x) { return x * 22; }
+inline int f3395_23(int x) { return x * 23; }
+inline int f3395_24(int x) { return x * 24; }
+inline int f3395_25(int x) { return x * 25; }
+inline int f3395_26(int x) { return x * 26; }
+inline int f3395_27(int x) { return x * 27; }
+inline int f3395_28(int x) { return x * 28; }
+inline int f3395_29(int x) { return x * 29; }
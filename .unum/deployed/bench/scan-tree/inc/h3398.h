@@ -0,0 +1,42 @@
+#pragma once
+/* header 3398 */
+#include <vector>
+#include "h2849.h"
+#include "h2380.h"
+#include "h3064.h"
+#include "h5534.h"
+#include "h7021.h"
+#ifdef X
+#include "h8400.h"
+#endif
+struct S3398 { int a; const char *s = "x//y"; };
+inline int f3398_0(int x) { return x * 0; }
+inline int f3398_1(int x) { return x * 1; }
+inline int f3398_2(int x) { return x * 2; }
+inline int f3398_3(int x) { return x * 3; }
+inline int f3398_4(int x) { return x * 4; }
+inline int f3398_5(int x) { return x * 5; }
+inline int f3398_6(int x) { return x * 6; }
+inline int f3398_7(int x) { return x * 7; }
+inline int f3398_8(int x) { return x * 8; }
+inline int f3398_9(int x) { return x * 9; }
+inline int f3398_10(int x) { return x * 10; }
+inline int f3398_11(int x) { return x * 11; }
+inline int f3398_12(int x) { return x * 12; }
+inline int f3398_13(int x) { return x * 13; }
+inline int f3398_14(int x) { return x * 14; }
+inline int f3398_15(int x) { return x * 15; }
+inline int f3398_16(int x) { return x * 16; }
+inline int f3398_17(int x) { return x * 17; }
+inline int f3398_18(int x) { return x * 18; }
+inline int f3398_19(int x) { return x * 19; }
+inline int f3398_20(int x) { return x * 20; }
+inline int f3398_21(int x) { return x * 21; }
+inline int f3398_22(int x) { return x * 22; }
+inline int f3398_23(int x) { return x * 23; }
+inline int f3398_24(int x) { return x * 24; }
+inline int f3398_25(int x) { return x * 25; }
+inline int f3398_26(int x) { return x * 26; }
+inline int f3398_27(int x) { return x * 27; }
+inline int f3398_28(int x) { return x * 28; }
+inline int f3398_29(int x) { return x * 29; }
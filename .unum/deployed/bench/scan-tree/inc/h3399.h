@@ -0,0 +1,42 @@
+#pragma once
+/* header 3399 */
+#include <vector>
+#include "h5477.h"
+#include "h778.h"
+#include "h3352.h"
+#include "h9140.h"
+#include "h5479.h"
+#ifdef X
+#include "h2085.h"
+#endif
+struct S3399 { int a; const char *s = "x//y"; };
+inline int f3399_0(int x) { return x * 0; }
+inline int f3399_1(int x) { return x * 1; }
+inline int f3399_2(int x) { return x * 2; }
+inline int f3399_3(int x) { return x * 3; }
+inline int f3399_4(int x) { return x * 4; }
+inline int f3399_5(int x) { return x * 5; }
+inline int f3399_6(int x) { return x * 6; }
+inline int f3399_7(int x) { return x * 7; }
+inline int f3399_8(int x) { return x * 8; }
+inline int f3399_9(int x) { return x * 9; }
+inline int f3399_10(int x) { return x * 10; }
+inline int f3399_11(int x) { return x * 11; }
+inline int f3399_12(int x) { return x * 12; }
+inline int f3399_13(int x) { return x * 13; }
+inline int f3399_14(int x) { return x * 14; }
+inline int f3399_15(int x) { return x * 15; }
+inline int f3399_16(int x) { return x * 16; }
+inline int f3399_17(int x) { return x * 17; }
+inline int f3399_18(int x) { return x * 18; }
+inline int f3399_19(int x) { return x * 19; }
+inline int f3399_20(int x) { return x * 20; }
+inline int f3399_21(int x) { return x * 21; }
+inline int f3399_22(int x) { return x * 22; }
+inline int f3399_23(int x) { return x * 23; }
+inline int f3399_24(int x) { return x * 24; }
+inline int f3399_25(int x) { return x * 25; }
+inline int f3399_26(int x) { return x * 26; }
+inline int f3399_27(int x) { return x * 27; }
+inline int f3399_28(int x) { return x * 28; }
+inline int f3399_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 34 */
+#include <vector>
+#include "h8619.h"
+#include "h4067.h"
+#include "h6358.h"
+#include "h134.h"
+#include "h2931.h"
+#ifdef X
+#include "h3081.h"
+#endif
+struct S34 { int a; const char *s = "x//y"; };
+inline int f34_0(int x) { return x * 0; }
+inline int f34_1(int x) { return x * 1; }
+inline int f34_2(int x) { return x * 2; }
+inline int f34_3(int x) { return x * 3; }
+inline int f34_4(int x) { return x * 4; }
+inline int f34_5(int x) { return x * 5; }
+inline int f34_6(int x) { return x * 6; }
+inline int f34_7(int x) { return x * 7; }
+inline int f34_8(int x) { return x * 8; }
+inline int f34_9(int x) { return x * 9; }
+inline int f34_10(int x) { return x * 10; }
+inline int f34_11(int x) { return x * 11; }
+inline int f34_12(int x) { return x * 12; }
+inline int f34_13(int x) { return x * 13; }
+inline int f34_14(int x) { return x * 14; }
+inline int f34_15(int x) { return x * 15; }
+inline int f34_16(int x) { return x * 16; }
+inline int f34_17(int x) { return x * 17; }
+inline int f34_18(int x) { return x * 18; }
+inline int f34_19(int x) { return x * 19; }
+inline int f34_20(int x) { return x * 20; }
+inline int f34_21(int x) { return x * 21; }
+inline int f34_22(int x) { return x * 22; }
+inline int f34_23(int x) { return x * 23; }
+inline int f34_24(int x) { return x * 24; }
+inline int f34_25(int x) { return x * 25; }
+inline int f34_26(int x) { return x * 26; }
+inline int f34_27(int x) { return x * 27; }
+inline int f34_28(int x) { return x * 28; }
+inline int f34_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 340 */
+#include <vector>
+#include "h9739.h"
+#include "h202.h"
+#include "h4086.h"
+#include "h1830.h"
+#include "h4043.h"
+#ifdef X
+#include "h3033.h"
+#endif
+struct S340 { int a; const char *s = "x//y"; };
+inline int f340_0(int x) { return x * 0; }
+inline int f340_1(int x) { return x * 1; }
+inline int f340_2(int x) { return x * 2; }
+inline int f340_3(int x) { return x * 3; }
+inline int f340_4(int x) { return x * 4; }
+inline int f340_5(int x) { return x * 5; }
+inline int f340_6(int x) { return x * 6; }
+inline int f340_7(int x) { return x * 7; }
+inline int f340_8(int x) { return x * 8; }
+inline int f340_9(int x) { return x * 9; }
+inline int f340_10(int x) { return x * 10; }
+inline int f340_11(int x) { return x * 11; }
+inline int f340_12(int x) { return x * 12; }
+inline int f340_13(int x) { return x * 13; }
+inline int f340_14(int x) { return x * 14; }
+inline int f340_15(int x) { return x * 15; }
+inline int f340_16(int x) { return x * 16; }
+inline int f340_17(int x) { return x * 17; }
+inline int f340_18(int x) { return x * 18; }
+inline int f340_19(int x) { return x * 19; }
+inline int f340_20(int x) { return x * 20; }
+inline int f340_21(int x) { return x * 21; }
+inline int f340_22(int x) { return x * 22; }
+inline int f340_23(int x) { return x * 23; }
+inline int f340_24(int x) { return x * 24; }
+inline int f340_25(int x) { return x * 25; }
+inline int f340_26(int x) { return x * 26; }
+inline int f340_27(int x) { return x * 27; }
+inline int f340_28(int x) { return x * 28; }
+inline int f340_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3403 */
+#include <vector>
+#include "h2940.h"
+#include "h361.h"
+#include "h7080.h"
+#include "h927.h"
+#include "h9318.h"
+#ifdef X
+#include "h2108.h"
+#endif
+struct S3403 { int a; const char *s = "x//y"; };
+inline int f3403_0(int x) { return x * 0; }
+inline int f3403_1(int x) { return x * 1; }
+inline int f3403_2(int x) { return x * 2; }
+inline int f3403_3(int x) { return x * 3; }
+inline int f3403_4(int x) { return x * 4; }
+inline int f3403_5(int x) { return x * 5; }
+inline int f3403_6(int x) { return x * 6; }
+inline int f3403_7(int x) { return x * 7; }
+inline int f3403_8(int x) { return x * 8; }
+inline int f3403_9(int x) { return x * 9; }
+inline int f3403_10(int x) { return x * 10; }
+inline int f3403_11(int x) { return x * 11; }
+inline int f3403_12(int x) { return x * 12; }
+inline int f3403_13(int x) { return x * 13; }
+inline int f3403_14(int x) { return x * 14; }
+inline int f3403_15(int x) { return x * 15; }
+inline int f3403_16(int x) { return x * 16; }
+inline int f3403_17(int x) { return x * 17; }
+inline int f3403_18(int x) { return x * 18; }
+inline int f3403_19(int x) { return x * 19; }
+inline int f3403_20(int x) { return x * 20; }
+inline int f3403_21(int x) { return x * 21; }
+inline int f3403_22(int x) { return x * 22; }
+inline int f3403_23(int x) { return x * 23; }
+inline int f3403_24(int x) { return x * 24; }
+inline int f3403_25(int x) { return x * 25; }
+inline int f3403_26(int x) { return x * 26; }
+inline int f3403_27(int x) { return x * 27; }
+inline int f3403_28(int x) { return x * 28; }
+inline int f3403_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3407 */
+#include <vector>
+#include "h3138.h"
+#include "h289.h"
+#include "h5221.h"
+#include "h2918.h"
+#include "h4384.h"
+#ifdef X
+#include "h5555.h"
+#endif
+struct S3407 { int a; const char *s = "x//y"; };
+inline int f3407_0(int x) { return x * 0; }
+inline int f3407_1(int x) { return x * 1; }
+inline int f3407_2(int x) { return x * 2; }
+inline int f3407_3(int x) { return x * 3; }
+inline int f3407_4(int x) { return x * 4; }
+inline int f3407_5(int x) { return x * 5; }
+inline int f3407_6(int x) { return x * 6; }
+inline int f3407_7(int x) { return x * 7; }
+inline int f3407_8(int x) { return x * 8; }
+inline int f3407_9(int x) { return x * 9; }
+inline int f3407_10(int x) { return x * 10; }
+inline int f3407_11(int x) { return x * 11; }
+inline int f3407_12(int x) { return x * 12; }
+inline int f3407_13(int x) { return x * 13; }
+inline int f3407_14(int x) { return x * 14; }
+inline int f3407_15(int x) { return x * 15; }
+inline int f3407_16(int x) { return x * 16; }
+inline int f3407_17(int x) { return x * 17; }
+inline int f3407_18(int x) { return x * 18; }
+inline int f3407_19(int x) { return x * 19; }
+inline int f3407_20(int x) { return x * 20; }
+inline int f3407_21(int x) { return x * 21; }
+inline int f3407_22(int x) { return x * 22; }
+inline int f3407_23(int x) { return x * 23; }
+inline int f3407_24(int x) { return x * 24; }
+inline int f3407_25(int x) { return x * 25; }
+inline int f3407_26(int x) { return x * 26; }
+inline int f3407_27(int x) { return x * 27; }
+inline int f3407_28(int x) { return x * 28; }
+inline int f3407_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3408 */
+#include <vector>
+#include "h2383.h"
+#include "h2607.h"
+#include "h7740.h"
+#include "h1254.h"
+#include "h1342.h"
+#ifdef X
+#include "h669.h"
+#endif
+struct S3408 { int a; const char *s = "x//y"; };
+inline int f3408_0(int x) { return x * 0; }
+inline int f3408_1(int x) { return x * 1; }
+inline int f3408_2(int x) { return x * 2; }
+inline int f3408_3(int x) { return x * 3; }
+inline int f3408_4(int x) { return x * 4; }
+inline int f3408_5(int x) { return x * 5; }
+inline int f3408_6(int x) { return x * 6; }
+inline int f3408_7(int x) { return x * 7; }
+inline int f3408_8(int x) { return x * 8; }
+inline int f3408_9(int x) { return x * 9; }
+inline int f3408_10(int x) { return x * 10; }
+inline int f3408_11(int x) { return x * 11; }
+inline int f3408_12(int x) { return x * 12; }
+inline int f3408_13(int x) { return x * 13; }
+inline int f3408_14(int x) { return x * 14; }
+inline int f3408_15(int x) { return x * 15; }
+inline int f3408_16(int x) { return x * 16; }
+inline int f3408_17(int x) { return x * 17; }
+inline int f3408_18(int x) { return x * 18; }
+inline int f3408_19(int x) { return x * 19; }
+inline int f3408_20(int x) { return x * 20; }
+inline int f3408_21(int x) { return x * 21; }
+inline int f3408_22(int x) { return x * 22; }
+inline int f3408_23(int x) { return x * 23; }
+inline int f3408_24(int x) { return x * 24; }
+inline int f3408_25(int x) { return x * 25; }
+inline int f3408_26(int x) { return x * 26; }
+inline int f3408_27(int x) { return x * 27; }
+inline int f3408_28(int x) { return x * 28; }
+inline int f3408_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3409 */
+#include <vector>
+#include "h8686.h"
+#include "h8037.h"
+#include "h987.h"
+#include "h2452.h"
+#include "h2231.h"
+#ifdef X
+#include "h3721.h"
+#endif
+struct S3409 { int a; const char *s = "x//y"; };
+inline int f3409_0(int x) { return x * 0; }
+inline int f3409_1(int x) { return x * 1; }
+inline int f3409_2(int x) { return x * 2; }
+inline int f3409_3(int x) { return x * 3; }
+inline int f3409_4(int x) { return x * 4; }
+inline int f3409_5(int x) { return x * 5; }
+inline int f3409_6(int x) { return x * 6; }
+inline int f3409_7(int x) { return x * 7; }
+inline int f3409_8(int x) { return x * 8; }
+inline int f3409_9(int x) { return x * 9; }
+inline int f3409_10(int x) { return x * 10; }
+inline int f3409_11(int x) { return x * 11; }
+inline int f3409_12(int x) { return x * 12; }
+inline int f3409_13(int x) { return x * 13; }
+inline int f3409_14(int x) { return x * 14; }
+inline int f3409_15(int x) { return x * 15; }
+inline int f3409_16(int x) { return x * 16; }
+inline int f3409_17(int x) { return x * 17; }
+inline int f3409_18(int x) { return x * 18; }
+inline int f3409_19(int x) { return x * 19; }
+inline int f3409_20(int x) { return x * 20; }
+inline int f3409_21(int x) { return x * 21; }
+inline int f3409_22(int x) { return x * 22; }
+inline int f3409_23(int x) { return x * 23; }
+inline int f3409_24(int x) { return x * 24; }
+inline int f3409_25(int x) { return x * 25; }
+inline int f3409_26(int x) { return x * 26; }
+inline int f3409_27(int x) { return x * 27; }
+inline int f3409_28(int x) { return x * 28; }
+inline int f3409_29(int x) { return x * 29; }
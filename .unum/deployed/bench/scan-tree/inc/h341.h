@@ -0,0 +1,42 @@
+#pragma once
+/* header 341 */
+#include <vector>
+#include "h6487.h"
+#include "h3914.h"
+#include "h7728.h"
+#include "h9916.h"
+#include "h7636.h"
+#ifdef X
+#include "h4398.h"
+#endif
+struct S341 { int a; const char *s = "x//y"; };
+inline int f341_0(int x) { return x * 0; }
+inline int f341_1(int x) { return x * 1; }
+inline int f341_2(int x) { return x * 2; }
+inline int f341_3(int x) { return x * 3; }
+inline int f341_4(int x) { return x * 4; }
+inline int f341_5(int x) { return x * 5; }
+inline int f341_6(int x) { return x * 6; }
+inline int f341_7(int x) { return x * 7; }
+inline int f341_8(int x) { return x * 8; }
+inline int f341_9(int x) { return x * 9; }
+inline int f341_10(int x) { return x * 10; }
+inline int f341_11(int x) { return x * 11; }
+inline int f341_12(int x) { return x * 12; }
+inline int f341_13(int x) { return x * 13; }
+inline int f341_14(int x) { return x * 14; }
+inline int f341_15(int x) { return x * 15; }
+inline int f341_16(int x) { return x * 16; }
+inline int f341_17(int x) { return x * 17; }
+inline int f341_18(int x) { return x * 18; }
+inline int f341_19(int x) { return x * 19; }
+inline int f341_20(int x) { return x * 20; }
+inline int f341_21(int x) { return x * 21; }
+inline int f341_22(int x) { return x * 22; }
+inline int f341_23(int x) { return x * 23; }
+inline int f341_24(int x) { return x * 24; }
+inline int f341_25(int x) { return x * 25; }
+inline int f341_26(int x) { return x * 26; }
+inline int f341_27(int x) { return x * 27; }
+inline int f341_28(int x) { return x * 28; }
+inline int f341_29(int x) { return x * 29; }
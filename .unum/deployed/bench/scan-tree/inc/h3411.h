@@ -0,0 +1,42 @@
+#pragma once
+/* header 3411 */
+#include <vector>
+#include "h2361.h"
+#include "h8697.h"
+#include "h5012.h"
+#include "h6252.h"
+#include "h5607.h"
+#ifdef X
+#include "h1665.h"
+#endif
+struct S3411 { int a; const char *s = "x//y"; };
+inline int f3411_0(int x) { return x * 0; }
+inline int f3411_1(int x) { return x * 1; }
+inline int f3411_2(int x) { return x * 2; }
+inline int f3411_3(int x) { return x * 3; }
+inline int f3411_4(int x) { return x * 4; }
+inline int f3411_5(int x) { return x * 5; }
+inline int f3411_6(int x) { return x * 6; }
+inline int f3411_7(int x) { return x * 7; }
+inline int f3411_8(int x) { return x * 8; }
+inline int f3411_9(int x) { return x * 9; }
+inline int f3411_10(int x) { return x * 10; }
+inline int f3411_11(int x) { return x * 11; }
+inline int f3411_12(int x) { return x * 12; }
+inline int f3411_13(int x) { return x * 13; }
+inline int f3411_14(int x) { return x * 14; }
+inline int f3411_15(int x) { return x * 15; }
+inline int f3411_16(int x) { return x * 16; }
+inline int f3411_17(int x) { return x * 17; }
+inline int f3411_18(int x) { return x * 18; }
+inline int f3411_19(int x) { return x * 19; }
+inline int f3411_20(int x) { return x * 20; }
+inline int f3411_21(int x) { return x * 21; }
+inline int f3411_22(int x) { return x * 22; }
+inline int f3411_23(int x) { return x * 23; }
+inline int f3411_24(int x) { return x * 24; }
+inline int f3411_25(int x) { return x * 25; }
+inline int f3411_26(int x) { return x * 26; }
+inline int f3411_27(int x) { return x * 27; }
+inline int f3411_28(int x) { return x * 28; }
+inline int f3411_29(int x) { return x * 29; }
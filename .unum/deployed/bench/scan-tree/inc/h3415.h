@@ -0,0 +1,42 @@
+#pragma once
+/* header 3415 */
+#include <vector>
+#include "h2328.h"
+#include "h2046.h"
+#include "h4319.h"
+#include "h8153.h"
+#include "h5486.h"
+#ifdef X
+#include "h8511.h"
+#endif
+struct S3415 { int a; const char *s = "x//y"; };
+inline int f3415_0(int x) { return x * 0; }
+inline int f3415_1(int x) { return x * 1; }
+inline int f3415_2(int x) { return x * 2; }
+inline int f3415_3(int x) { return x * 3; }
+inline int f3415_4(int x) { return x * 4; }
+inline int f3415_5(int x) { return x * 5; }
+inline int f3415_6(int x) { return x * 6; }
+inline int f3415_7(int x) { return x * 7; }
+inline int f3415_8(int x) { return x * 8; }
+inline int f3415_9(int x) { return x * 9; }
+inline int f3415_10(int x) { return x * 10; }
+inline int f3415_11(int x) { return x * 11; }
+inline int f3415_12(int x) { return x * 12; }
+inline int f3415_13(int x) { return x * 13; }
+inline int f3415_14(int x) { return x * 14; }
+inline int f3415_15(int x) { return x * 15; }
+inline int f3415_16(int x) { return x * 16; }
+inline int f3415_17(int x) { return x * 17; }
+inline int f3415_18(int x) { return x * 18; }
+inline int f3415_19(int x) { return x * 19; }
+inline int f3415_20(int x) { return x * 20; }
+inline int f3415_21(int x) { return x * 21; }
+inline int f3415_22(int x) { return x * 22; }
+inline int f3415_23(int x) { return x * 23; }
+inline int f3415_24(int x) { return x * 24; }
+inline int f3415_25(int x) { return x * 25; }
+inline int f3415_26(int x) { return x * 26; }
+inline int f3415_27(int x) { return x * 27; }
+inline int f3415_28(int x) { return x * 28; }
+inline int f3415_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3417 */
+#include <vector>
+#include "h3742.h"
+#include "h9950.h"
+#include "h7571.h"
+#include "h7328.h"
+#include "h4359.h"
+#ifdef X
+#include "h6531.h"
+#endif
+struct S3417 { int a; const char *s = "x//y"; };
+inline int f3417_0(int x) { return x * 0; }
+inline int f3417_1(int x) { return x * 1; }
+inline int f3417_2(int x) { return x * 2; }
+inline int f3417_3(int x) { return x * 3; }
+inline int f3417_4(int x) { return x * 4; }
+inline int f3417_5(int x) { return x * 5; }
+inline int f3417_6(int x) { return x * 6; }
+inline int f3417_7(int x) { return x * 7; }
+inline int f3417_8(int x) { return x * 8; }
+inline int f3417_9(int x) { return x * 9; }
+inline int f3417_10(int x) { return x * 10; }
+inline int f3417_11(int x) { return x * 11; }
+inline int f3417_12(int x) { return x * 12; }
+inline int f3417_13(int x) { return x * 13; }
+inline int f3417_14(int x) { return x * 14; }
+inline int f3417_15(int x) { return x * 15; }
+inline int f3417_16(int x) { return x * 16; }
+inline int f3417_17(int x) { return x * 17; }
+inline int f3417_18(int x) { return x * 18; }
+inline int f3417_19(int x) { return x * 19; }
+inline int f3417_20(int x) { return x * 20; }
+inline int f3417_21(int x) { return x * 21; }
+inline int f3417_22(int x) { return x * 22; }
+inline int f3417_23(int x) { return x * 23; }
+inline int f3417_24(int x) { return x * 24; }
+inline int f3417_25(int x) { return x * 25; }
+inline int f3417_26(int x) { return x * 26; }
+inline int f3417_27(int x) { return x * 27; }
+inline int f3417_28(int x) { return x * 28; }
+inline int f3417_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3418 */
+#include <vector>
+#include "h2276.h"
+#include "h3324.h"
+#include "h8722.h"
+#include "h6098.h"
+#include "h3998.h"
+#ifdef X
+#include "h9210.h"
+#endif
+struct S3418 { int a; const char *s = "x//y"; };
+inline int f3418_0(int x) { return x * 0; }
+inline int f3418_1(int x) { return x * 1; }
+inline int f3418_2(int x) { return x * 2; }
+inline int f3418_3(int x) { return x * 3; }
+inline int f3418_4(int x) { return x * 4; }
+inline int f3418_5(int x) { return x * 5; }
+inline int f3418_6(int x) { return x * 6; }
+inline int f3418_7(int x) { return x * 7; }
+inline int f3418_8(int x) { return x * 8; }
+inline int f3418_9(int x) { return x * 9; }
+inline int f3418_10(int x) { return x * 10; }
+inline int f3418_11(int x) { return x * 11; }
+inline int f3418_12(int x) { return x * 12; }
+inline int f3418_13(int x) { return x * 13; }
+inline int f3418_14(int x) { return x * 14; }
+inline int f3418_15(int x) { return x * 15; }
+inline int f3418_16(int x) { return x * 16; }
+inline int f3418_17(int x) { return x * 17; }
+inline int f3418_18(int x) { return x * 18; }
+inline int f3418_19(int x) { return x * 19; }
+inline int f3418_20(int x) { return x * 20; }
+inline int f3418_21(int x) { return x * 21; }
+inline int f3418_22(int x) { return x * 22; }
+inline int f3418_23(int x) { return x * 23; }
+inline int f3418_24(int x) { return x * 24; }
+inline int f3418_25(int x) { return x * 25; }
+inline int f3418_26(int x) { return x * 26; }
+inline int f3418_27(int x) { return x * 27; }
+inline int f3418_28(int x) { return x * 28; }
+inline int f3418_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3419 */
+#include <vector>
+#include "h6877.h"
+#include "h417.h"
+#include "h6076.h"
+#include "h6803.h"
+#include "h5138.h"
+#ifdef X
+#include "h5327.h"
+#endif
+struct S3419 { int a; const char *s = "x//y"; };
+inline int f3419_0(int x) { return x * 0; }
+inline int f3419_1(int x) { return x * 1; }
+inline int f3419_2(int x) { return x * 2; }
+inline int f3419_3(int x) { return x * 3; }
+inline int f3419_4(int x) { return x * 4; }
+inline int f3419_5(int x) { return x * 5; }
+inline int f3419_6(int x) { return x * 6; }
+inline int f3419_7(int x) { return x * 7; }
+inline int f3419_8(int x) { return x * 8; }
+inline int f3419_9(int x) { return x * 9; }
+inline int f3419_10(int x) { return x * 10; }
+inline int f3419_11(int x) { return x * 11; }
+inline int f3419_12(int x) { return x * 12; }
+inline int f3419_13(int x) { return x * 13; }
+inline int f3419_14(int x) { return x * 14; }
+inline int f3419_15(int x) { return x * 15; }
+inline int f3419_16(int x) { return x * 16; }
+inline int f3419_17(int x) { return x * 17; }
+inline int f3419_18(int x) { return x * 18; }
+inline int f3419_19(int x) { return x * 19; }
+inline int f3419_20(int x) { return x * 20; }
+inline int f3419_21(int x) { return x * 21; }
+inline int f3419_22(int x) { return x * 22; }
+inline int f3419_23(int x) { return x * 23; }
+inline int f3419_24(int x) { return x * 24; }
+inline int f3419_25(int x) { return x * 25; }
+inline int f3419_26(int x) { return x * 26; }
+inline int f3419_27(int x) { return x * 27; }
+inline int f3419_28(int x) { return x * 28; }
+inline int f3419_29(int x) { return x * 29; }
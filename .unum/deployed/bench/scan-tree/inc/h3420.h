@@ -0,0 +1,42 @@
+#pragma once
+/* header 3420 */
+#include <vector>
+#include "h4304.h"
+#include "h4028.h"
+#include "h9696.h"
+#include "h2056.h"
+#include "h8380.h"
+#ifdef X
+#include "h1565.h"
+#endif
+struct S3420 { int a; const char *s = "x//y"; };
+inline int f3420_0(int x) { return x * 0; }
+inline int f3420_1(int x) { return x * 1; }
+inline int f3420_2(int x) { return x * 2; }
+inline int f3420_3(int x) { return x * 3; }
+inline int f3420_4(int x) { return x * 4; }
+inline int f3420_5(int x) { return x * 5; }
+inline int f3420_6(int x) { return x * 6; }
+inline int f3420_7(int x) { return x * 7; }
+inline int f3420_8(int x) { return x * 8; }
+inline int f3420_9(int x) { return x * 9; }
+inline int f3420_10(int x) { return x * 10; }
+inline int f3420_11(int x) { return x * 11; }
+inline int f3420_12(int x) { return x * 12; }
+inline int f3420_13(int x) { return x * 13; }
+inline int f3420_14(int x) { return x * 14; }
+inline int f3420_15(int x) { return x * 15; }
+inline int f3420_16(int x) { return x * 16; }
+inline int f3420_17(int x) { return x * 17; }
+inline int f3420_18(int x) { return x * 18; }
+inline int f3420_19(int x) { return x * 19; }
+inline int f3420_20(int x) { return x * 20; }
+inline int f3420_21(int x) { return x * 21; }
+inline int f3420_22(int x) { return x * 22; }
+inline int f3420_23(int x) { return x * 23; }
+inline int f3420_24(int x) { return x * 24; }
+inline int f3420_25(int x) { return x * 25; }
+inline int f3420_26(int x) { return x * 26; }
+inline int f3420_27(int x) { return x * 27; }
+inline int f3420_28(int x) { return x * 28; }
+inline int f3420_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3423 */
+#include <vector>
+#include "h5576.h"
+#include "h9465.h"
+#include "h2184.h"
+#include "h3290.h"
+#include "h2565.h"
+#ifdef X
+#include "h3809.h"
+#endif
+struct S3423 { int a; const char *s = "x//y"; };
+inline int f3423_0(int x) { return x * 0; }
+inline int f3423_1(int x) { return x * 1; }
+inline int f3423_2(int x) { return x * 2; }
+inline int f3423_3(int x) { return x * 3; }
+inline int f3423_4(int x) { return x * 4; }
+inline int f3423_5(int x) { return x * 5; }
+inline int f3423_6(int x) { return x * 6; }
+inline int f3423_7(int x) { return x * 7; }
+inline int f3423_8(int x) { return x * 8; }
+inline int f3423_9(int x) { return x * 9; }
+inline int f3423_10(int x) { return x * 10; }
+inline int f3423_11(int x) { return x * 11; }
+inline int f3423_12(int x) { return x * 12; }
+inline int f3423_13(int x) { return x * 13; }
+inline int f3423_14(int x) { return x * 14; }
+inline int f3423_15(int x) { return x * 15; }
+inline int f3423_16(int x) { return x * 16; }
+inline int f3423_17(int x) { return x * 17; }
+inline int f3423_18(int x) { return x * 18; }
+inline int f3423_19(int x) { return x * 19; }
+inline int f3423_20(int x) { return x * 20; }
+inline int f3423_21(int x) { return x * 21; }
+inline int f3423_22(int x) { return x * 22; }
+inline int f3423_23(int x) { return x * 23; }
+inline int f3423_24(int x) { return x * 24; }
+inline int f3423_25(int x) { return x * 25; }
+inline int f3423_26(int x) { return x * 26; }
+inline int f3423_27(int x) { return x * 27; }
+inline int f3423_28(int x) { return x * 28; }
+inline int f3423_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3424 */
+#include <vector>
+#include "h2302.h"
+#include "h9413.h"
+#include "h4617.h"
+#include "h9805.h"
+#include "h4264.h"
+#ifdef X
+#include "h5674.h"
+#endif
+struct S3424 { int a; const char *s = "x//y"; };
+inline int f3424_0(int x) { return x * 0; }
+inline int f3424_1(int x) { return x * 1; }
+inline int f3424_2(int x) { return x * 2; }
+inline int f3424_3(int x) { return x * 3; }
+inline int f3424_4(int x) { return x * 4; }
+inline int f3424_5(int x) { return x * 5; }
+inline int f3424_6(int x) { return x * 6; }
+inline int f3424_7(int x) { return x * 7; }
+inline int f3424_8(int x) { return x * 8; }
+inline int f3424_9(int x) { return x * 9; }
+inline int f3424_10(int x) { return x * 10; }
+inline int f3424_11(int x) { return x * 11; }
+inline int f3424_12(int x) { return x * 12; }
+inline int f3424_13(int x) { return x * 13; }
+inline int f3424_14(int x) { return x * 14; }
+inline int f3424_15(int x) { return x * 15; }
+inline int f3424_16(int x) { return x * 16; }
+inline int f3424_17(int x) { return x * 17; }
+inline int f3424_18(int x) { return x * 18; }
+inline int f3424_19(int x) { return x * 19; }
+inline int f3424_20(int x) { return x * 20; }
+inline int f3424_21(int x) { return x * 21; }
+inline int f3424_22(int x) { return x * 22; }
+inline int f3424_23(int x) { return x * 23; }
+inline int f3424_24(int x) { return x * 24; }
+inline int f3424_25(int x) { return x * 25; }
+inline int f3424_26(int x) { return x * 26; }
+inline int f3424_27(int x) { return x * 27; }
+inline int f3424_28(int x) { return x * 28; }
+inline int f3424_29(int x) { return x * 29; }
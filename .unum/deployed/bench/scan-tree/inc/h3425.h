@@ -0,0 +1,42 @@
+#pragma once
+/* header 3425 */
+#include <vector>
+#include "h9602.h"
+#include "h8627.h"
+#include "h1666.h"
+#include "h3388.h"
+#include "h8817.h"
+#ifdef X
+#include "h403.h"
+#endif
+struct S3425 { int a; const char *s = "x//y"; };
+inline int f3425_0(int x) { return x * 0; }
+inline int f3425_1(int x) { return x * 1; }
+inline int f3425_2(int x) { return x * 2; }
+inline int f3425_3(int x) { return x * 3; }
+inline int f3425_4(int x) { return x * 4; }
+inline int f3425_5(int x) { return x * 5; }
+inline int f3425_6(int x) { return x * 6; }
+inline int f3425_7(int x) { return x * 7; }
+inline int f3425_8(int x) { return x * 8; }
+inline int f3425_9(int x) { return x * 9; }
+inline int f3425_10(int x) { return x * 10; }
+inline int f3425_11(int x) { return x * 11; }
+inline int f3425_12(int x) { return x * 12; }
+inline int f3425_13(int x) { return x * 13; }
+inline int f3425_14(int x) { return x * 14; }
+inline int f3425_15(int x) { return x * 15; }
+inline int f3425_16(int x) { return x * 16; }
+inline int f3425_17(int x) { return x * 17; }
+inline int f3425_18(int x) { return x * 18; }
+inline int f3425_19(int x) { return x * 19; }
+inline int f3425_20(int x) { return x * 20; }
+inline int f3425_21(int x) { return x * 21; }
+inline int f3425_22(int x) { return x * 22; }
+inline int f3425_23(int x) { return x * 23; }
+inline int f3425_24(int x) { return x * 24; }
+inline int f3425_25(int x) { return x * 25; }
+inline int f3425_26(int x) { return x * 26; }
+inline int f3425_27(int x) { return x * 27; }
+inline int f3425_28(int x) { return x * 28; }
+inline int f3425_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3427 */
+#include <vector>
+#include "h8915.h"
+#include "h5997.h"
+#include "h5709.h"
+#include "h2983.h"
+#include "h4023.h"
+#ifdef X
+#include "h5296.h"
+#endif
+struct S3427 { int a; const char *s = "x//y"; };
+inline int f3427_0(int x) { return x * 0; }
+inline int f3427_1(int x) { return x * 1; }
+inline int f3427_2(int x) { return x * 2; }
+inline int f3427_3(int x) { return x * 3; }
+inline int f3427_4(int x) { return x * 4; }
+inline int f3427_5(int x) { return x * 5; }
+inline int f3427_6(int x) { return x * 6; }
+inline int f3427_7(int x) { return x * 7; }
+inline int f3427_8(int x) { return x * 8; }
+inline int f3427_9(int x) { return x * 9; }
+inline int f3427_10(int x) { return x * 10; }
+inline int f3427_11(int x) { return x * 11; }
+inline int f3427_12(int x) { return x * 12; }
+inline int f3427_13(int x) { return x * 13; }
+inline int f3427_14(int x) { return x * 14; }
+inline int f3427_15(int x) { return x * 15; }
+inline int f3427_16(int x) { return x * 16; }
+inline int f3427_17(int x) { return x * 17; }
+inline int f3427_18(int x) { return x * 18; }
+inline int f3427_19(int x) { return x * 19; }
+inline int f3427_20(int x) { return x * 20; }
+inline int f3427_21(int x) { return x * 21; }
+inline int f3427_22(int x) { return x * 22; }
+inline int f3427_23(int x) { return x * 23; }
+inline int f3427_24(int x) { return x * 24; }
+inline int f3427_25(int x) { return x * 25; }
+inline int f3427_26(int x) { return x * 26; }
+inline int f3427_27(int x) { return x * 27; }
+inline int f3427_28(int x) { return x * 28; }
+inline int f3427_29(int x) { return x * 29; }
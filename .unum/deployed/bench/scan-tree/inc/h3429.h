@@ -0,0 +1,42 @@
+#pragma once
+/* header 3429 */
+#include <vector>
+#include "h4422.h"
+#include "h707.h"
+#include "h9871.h"
+#include "h1480.h"
+#include "h4258.h"
+#ifdef X
+#include "h9182.h"
+#endif
+struct S3429 { int a; const char *s = "x//y"; };
+inline int f3429_0(int x) { return x * 0; }
+inline int f3429_1(int x) { return x * 1; }
+inline int f3429_2(int x) { return x * 2; }
+inline int f3429_3(int x) { return x * 3; }
+inline int f3429_4(int x) { return x * 4; }
+inline int f3429_5(int x) { return x * 5; }
+inline int f3429_6(int x) { return x * 6; }
+inline int f3429_7(int x) { return x * 7; }
+inline int f3429_8(int x) { return x * 8; }
+inline int f3429_9(int x) { return x * 9; }
+inline int f3429_10(int x) { return x * 10; }
+inline int f3429_11(int x) { return x * 11; }
+inline int f3429_12(int x) { return x * 12; }
+inline int f3429_13(int x) { return x * 13; }
+inline int f3429_14(int x) { return x * 14; }
+inline int f3429_15(int x) { return x * 15; }
+inline int f3429_16(int x) { return x * 16; }
+inline int f3429_17(int x) { return x * 17; }
+inline int f3429_18(int x) { return x * 18; }
+inline int f3429_19(int x) { return x * 19; }
+inline int f3429_20(int x) { return x * 20; }
+inline int f3429_21(int x) { return x * 21; }
+inline int f3429_22(int x) { return x * 22; }
+inline int f3429_23(int x) { return x * 23; }
+inline int f3429_24(int x) { return x * 24; }
+inline int f3429_25(int x) { return x * 25; }
+inline int f3429_26(int x) { return x * 26; }
+inline int f3429_27(int x) { return x * 27; }
+inline int f3429_28(int x) { return x * 28; }
+inline int f3429_29(int x) { return x * 29; }
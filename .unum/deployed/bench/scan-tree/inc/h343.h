@@ -0,0 +1,42 @@
+#pragma once
+/* header 343 */
+#include <vector>
+#include "h1430.h"
+#include "h5998.h"
+#include "h8720.h"
+#include "h7760.h"
+#include "h7066.h"
+#ifdef X
+#include "h4395.h"
+#endif
+struct S343 { int a; const char *s = "x//y"; };
+inline int f343_0(int x) { return x * 0; }
+inline int f343_1(int x) { return x * 1; }
+inline int f343_2(int x) { return x * 2; }
+inline int f343_3(int x) { return x * 3; }
+inline int f343_4(int x) { return x * 4; }
+inline int f343_5(int x) { return x * 5; }
+inline int f343_6(int x) { return x * 6; }
+inline int f343_7(int x) { return x * 7; }
+inline int f343_8(int x) { return x * 8; }
+inline int f343_9(int x) { return x * 9; }
+inline int f343_10(int x) { return x * 10; }
+inline int f343_11(int x) { return x * 11; }
+inline int f343_12(int x) { return x * 12; }
+inline int f343_13(int x) { return x * 13; }
+inline int f343_14(int x) { return x * 14; }
+inline int f343_15(int x) { return x * 15; }
+inline int f343_16(int x) { return x * 16; }
+inline int f343_17(int x) { return x * 17; }
+inline int f343_18(int x) { return x * 18; }
+inline int f343_19(int x) { return x * 19; }
+inline int f343_20(int x) { return x * 20; }
+inline int f343_21(int x) { return x * 21; }
+inline int f343_22(int x) { return x * 22; }
+inline int f343_23(int x) { return x * 23; }
+inline int f343_24(int x) { return x * 24; }
+inline int f343_25(int x) { return x * 25; }
+inline int f343_26(int x) { return x * 26; }
+inline int f343_27(int x) { return x * 27; }
+inline int f343_28(int x) { return x * 28; }
+inline int f343_29(int x) { return x * 29; }
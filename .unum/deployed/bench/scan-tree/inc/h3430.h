@@ -0,0 +1,42 @@
+#pragma once
+/* header 3430 */
+#include <vector>
+#include "h1368.h"
+#include "h6058.h"
+#include "h3244.h"
+#include "h2794.h"
+#include "h3300.h"
+#ifdef X
+#include "h9425.h"
+#endif
+struct S3430 { int a; const char *s = "x//y"; };
+inline int f3430_0(int x) { return x * 0; }
+inline int f3430_1(int x) { return x * 1; }
+inline int f3430_2(int x) { return x * 2; }
+inline int f3430_3(int x) { return x * 3; }
+inline int f3430_4(int x) { return x * 4; }
+inline int f3430_5(int x) { return x * 5; }
+inline int f3430_6(int x) { return x * 6; }
+inline int f3430_7(int x) { return x * 7; }
+inline int f3430_8(int x) { return x * 8; }
+inline int f3430_9(int x) { return x * 9; }
+inline int f3430_10(int x) { return x * 10; }
+inline int f3430_11(int x) { return x * 11; }
+inline int f3430_12(int x) { return x * 12; }
+inline int f3430_13(int x) { return x * 13; }
+inline int f3430_14(int x) { return x * 14; }
+inline int f3430_15(int x) { return x * 15; }
+inline int f3430_16(int x) { return x * 16; }
+inline int f3430_17(int x) { return x * 17; }
+inline int f3430_18(int x) { return x * 18; }
+inline int f3430_19(int x) { return x * 19; }
+inline int f3430_20(int x) { return x * 20; }
+inline int f3430_21(int x) { return x * 21; }
+inline int f3430_22(int x) { return x * 22; }
+inline int f3430_23(int x) { return x * 23; }
+inline int f3430_24(int x) { return x * 24; }
+inline int f3430_25(int x) { return x * 25; }
+inline int f3430_26(int x) { return x * 26; }
+inline int f3430_27(int x) { return x * 27; }
+inline int f3430_28(int x) { return x * 28; }
+inline int f3430_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3432 */
+#include <vector>
+#include "h2838.h"
+#include "h6108.h"
+#include "h9123.h"
+#include "h52.h"
+#include "h7218.h"
+#ifdef X
+#include "h1915.h"
+#endif
+struct S3432 { int a; const char *s = "x//y"; };
+inline int f3432_0(int x) { return x * 0; }
+inline int f3432_1(int x) { return x * 1; }
+inline int f3432_2(int x) { return x * 2; }
+inline int f3432_3(int x) { return x * 3; }
+inline int f3432_4(int x) { return x * 4; }
+inline int f3432_5(int x) { return x * 5; }
+inline int f3432_6(int x) { return x * 6; }
+inline int f3432_7(int x) { return x * 7; }
+inline int f3432_8(int x) { return x * 8; }
+inline int f3432_9(int x) { return x * 9; }
+inline int f3432_10(int x) { return x * 10; }
+inline int f3432_11(int x) { return x * 11; }
+inline int f3432_12(int x) { return x * 12; }
+inline int f3432_13(int x) { return x * 13; }
+inline int f3432_14(int x) { return x * 14; }
+inline int f3432_15(int x) { return x * 15; }
+inline int f3432_16(int x) { return x * 16; }
+inline int f3432_17(int x) { return x * 17; }
+inline int f3432_18(int x) { return x * 18; }
+inline int f3432_19(int x) { return x * 19; }
+inline int f3432_20(int x) { return x * 20; }
+inline int f3432_21(int x) { return x * 21; }
+inline int f3432_22(int x) { return x * 22; }
+inline int f3432_23(int x) { return x * 23; }
+inline int f3432_24(int x) { return x * 24; }
+inline int f3432_25(int x) { return x * 25; }
+inline int f3432_26(int x) { return x * 26; }
+inline int f3432_27(int x) { return x * 27; }
+inline int f3432_28(int x) { return x * 28; }
+inline int f3432_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3435 */
+#include <vector>
+#include "h4007.h"
+#include "h770.h"
+#include "h9393.h"
+#include "h4572.h"
+#include "h5928.h"
+#ifdef X
+#include "h8388.h"
+#endif
+struct S3435 { int a; const char *s = "x//y"; };
+inline int f3435_0(int x) { return x * 0; }
+inline int f3435_1(int x) { return x * 1; }
+inline int f3435_2(int x) { return x * 2; }
+inline int f3435_3(int x) { return x * 3; }
+inline int f3435_4(int x) { return x * 4; }
+inline int f3435_5(int x) { return x * 5; }
+inline int f3435_6(int x) { return x * 6; }
+inline int f3435_7(int x) { return x * 7; }
+inline int f3435_8(int x) { return x * 8; }
+inline int f3435_9(int x) { return x * 9; }
+inline int f3435_10(int x) { return x * 10; }
+inline int f3435_11(int x) { return x * 11; }
+inline int f3435_12(int x) { return x * 12; }
+inline int f3435_13(int x) { return x * 13; }
+inline int f3435_14(int x) { return x * 14; }
+inline int f3435_15(int x) { return x * 15; }
+inline int f3435_16(int x) { return x * 16; }
+inline int f3435_17(int x) { return x * 17; }
+inline int f3435_18(int x) { return x * 18; }
+inline int f3435_19(int x) { return x * 19; }
+inline int f3435_20(int x) { return x * 20; }
+inline int f3435_21(int x) { return x * 21; }
+inline int f3435_22(int x) { return x * 22; }
+inline int f3435_23(int x) { return x * 23; }
+inline int f3435_24(int x) { return x * 24; }
+inline int f3435_25(int x) { return x * 25; }
+inline int f3435_26(int x) { return x * 26; }
+inline int f3435_27(int x) { return x * 27; }
+inline int f3435_28(int x) { return x * 28; }
+inline int f3435_29(int x) { return x * 29; }
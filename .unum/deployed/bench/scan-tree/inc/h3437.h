@@ -0,0 +1,42 @@
+#pragma once
+/* header 3437 */
+#include <vector>
+#include "h7615.h"
+#include "h7903.h"
+#include "h9806.h"
+#include "h5325.h"
+#include "h548.h"
+#ifdef X
+#include "h6436.h"
+#endif
+struct S3437 { int a; const char *s = "x//y"; };
+inline int f3437_0(int x) { return x * 0; }
+inline int f3437_1(int x) { return x * 1; }
+inline int f3437_2(int x) { return x * 2; }
+inline int f3437_3(int x) { return x * 3; }
+inline int f3437_4(int x) { return x * 4; }
+inline int f3437_5(int x) { return x * 5; }
+inline int f3437_6(int x) { return x * 6; }
+inline int f3437_7(int x) { return x * 7; }
+inline int f3437_8(int x) { return x * 8; }
+inline int f3437_9(int x) { return x * 9; }
+inline int f3437_10(int x) { return x * 10; }
+inline int f3437_11(int x) { return x * 11; }
+inline int f3437_12(int x) { return x * 12; }
+inline int f3437_13(int x) { return x * 13; }
+inline int f3437_14(int x) { return x * 14; }
+inline int f3437_15(int x) { return x * 15; }
+inline int f3437_16(int x) { return x * 16; }
+inline int f3437_17(int x) { return x * 17; }
+inline int f3437_18(int x) { return x * 18; }
+inline int f3437_19(int x) { return x * 19; }
+inline int f3437_20(int x) { return x * 20; }
+inline int f3437_21(int x) { return x * 21; }
+inline int f3437_22(int x) { return x * 22; }
+inline int f3437_23(int x) { return x * 23; }
+inline int f3437_24(int x) { return x * 24; }
+inline int f3437_25(int x) { return x * 25; }
+inline int f3437_26(int x) { return x * 26; }
+inline int f3437_27(int x) { return x * 27; }
+inline int f3437_28(int x) { return x * 28; }
+inline int f3437_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3438 */
+#include <vector>
+#include "h4169.h"
+#include "h4238.h"
+#include "h4038.h"
+#include "h3973.h"
+#include "h1813.h"
+#ifdef X
+#include "h7861.h"
+#endif
+struct S3438 { int a; const char *s = "x//y"; };
+inline int f3438_0(int x) { return x * 0; }
+inline int f3438_1(int x) { return x * 1; }
+inline int f3438_2(int x) { return x * 2; }
+inline int f3438_3(int x) { return x * 3; }
+inline int f3438_4(int x) { return x * 4; }
+inline int f3438_5(int x) { return x * 5; }
+inline int f3438_6(int x) { return x * 6; }
+inline int f3438_7(int x) { return x * 7; }
+inline int f3438_8(int x) { return x * 8; }
+inline int f3438_9(int x) { return x * 9; }
+inline int f3438_10(int x) { return x * 10; }
+inline int f3438_11(int x) { return x * 11; }
+inline int f3438_12(int x) { return x * 12; }
+inline int f3438_13(int x) { return x * 13; }
+inline int f3438_14(int x) { return x * 14; }
+inline int f3438_15(int x) { return x * 15; }
+inline int f3438_16(int x) { return x * 16; }
+inline int f3438_17(int x) { return x * 17; }
+inline int f3438_18(int x) { return x * 18; }
+inline int f3438_19(int x) { return x * 19; }
+inline int f3438_20(int x) { return x * 20; }
+inline int f3438_21(int x) { return x * 21; }
+inline int f3438_22(int x) { return x * 22; }
+inline int f3438_23(int x) { return x * 23; }
+inline int f3438_24(int x) { return x * 24; }
+inline int f3438_25(int x) { return x * 25; }
+inline int f3438_26(int x) { return x * 26; }
+inline int f3438_27(int x) { return x * 27; }
+inline int f3438_28(int x) { return x * 28; }
+inline int f3438_29(int x) { return x * 29; }
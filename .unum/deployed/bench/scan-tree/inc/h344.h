@@ -0,0 +1,42 @@
+#pragma once
+/* header 344 */
+#include <vector>
+#include "h4528.h"
+#include "h2147.h"
+#include "h6781.h"
+#include "h7698.h"
+#include "h1698.h"
+#ifdef X
+#include "h2720.h"
+#endif
+struct S344 { int a; const char *s = "x//y"; };
+inline int f344_0(int x) { return x * 0; }
+inline int f344_1(int x) { return x * 1; }
+inline int f344_2(int x) { return x * 2; }
+inline int f344_3(int x) { return x * 3; }
+inline int f344_4(int x) { return x * 4; }
+inline int f344_5(int x) { return x * 5; }
+inline int f344_6(int x) { return x * 6; }
+inline int f344_7(int x) { return x * 7; }
+inline int f344_8(int x) { return x * 8; }
+inline int f344_9(int x) { return x * 9; }
+inline int f344_10(int x) { return x * 10; }
+inline int f344_11(int x) { return x * 11; }
+inline int f344_12(int x) { return x * 12; }
+inline int f344_13(int x) { return x * 13; }
+inline int f344_14(int x) { return x * 14; }
+inline int f344_15(int x) { return x * 15; }
+inline int f344_16(int x) { return x * 16; }
+inline int f344_17(int x) { return x * 17; }
+inline int f344_18(int x) { return x * 18; }
+inline int f344_19(int x) { return x * 19; }
+inline int f344_20(int x) { return x * 20; }
+inline int f344_21(int x) { return x * 21; }
+inline int f344_22(int x) { return x * 22; }
+inline int f344_23(int x) { return x * 23; }
+inline int f344_24(int x) { return x * 24; }
+inline int f344_25(int x) { return x * 25; }
+inline int f344_26(int x) { return x * 26; }
+inline int f344_27(int x) { return x * 27; }
+inline int f344_28(int x) { return x * 28; }
+inline int f344_29(int x) { return x * 29; }
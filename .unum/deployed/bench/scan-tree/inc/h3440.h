@@ -0,0 +1,42 @@
+#pragma once
+/* header 3440 */
+#include <vector>
+#include "h7820.h"
+#include "h8741.h"
+#include "h2446.h"
+#include "h9517.h"
+#include "h3598.h"
+#ifdef X
+#include "h2793.h"
+#endif
+struct S3440 { int a; const char *s = "x//y"; };
+inline int f3440_0(int x) { return x * 0; }
+inline int f3440_1(int x) { return x * 1; }
+inline int f3440_2(int x) { return x * 2; }
+inline int f3440_3(int x) { return x * 3; }
+inline int f3440_4(int x) { return x * 4; }
+inline int f3440_5(int x) { return x * 5; }
+inline int f3440_6(int x) { return x * 6; }
+inline int f3440_7(int x) { return x * 7; }
+inline int f3440_8(int x) { return x * 8; }
+inline int f3440_9(int x) { return x * 9; }
+inline int f3440_10(int x) { return x * 10; }
+inline int f3440_11(int x) { return x * 11; }
+inline int f3440_12(int x) { return x * 12; }
+inline int f3440_13(int x) { return x * 13; }
+inline int f3440_14(int x) { return x * 14; }
+inline int f3440_15(int x) { return x * 15; }
+inline int f3440_16(int x) { return x * 16; }
+inline int f3440_17(int x) { return x * 17; }
+inline int f3440_18(int x) { return x * 18; }
+inline int f3440_19(int x) { return x * 19; }
+inline int f3440_20(int x) { return x * 20; }
+inline int f3440_21(int x) { return x * 21; }
+inline int f3440_22(int x) { return x * 22; }
+inline int f3440_23(int x) { return x * 23; }
+inline int f3440_24(int x) { return x * 24; }
+inline int f3440_25(int x) { return x * 25; }
+inline int f3440_26(int x) { return x * 26; }
+inline int f3440_27(int x) { return x * 27; }
+inline int f3440_28(int x) { return x * 28; }
+inline int f3440_29(int x) { return x * 29; }
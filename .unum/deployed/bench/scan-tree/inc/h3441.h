@@ -0,0 +1,42 @@
+#pragma once
+/* header 3441 */
+#include <vector>
+#include "h5699.h"
+#include "h4387.h"
+#include "h1299.h"
+#include "h7644.h"
+#include "h7960.h"
+#ifdef X
+#include "h2642.h"
+#endif
+struct S3441 { int a; const char *s = "x//y"; };
+inline int f3441_0(int x) { return x * 0; }
+inline int f3441_1(int x) { return x * 1; }
+inline int f3441_2(int x) { return x * 2; }
+inline int f3441_3(int x) { return x * 3; }
+inline int f3441_4(int x) { return x * 4; }
+inline int f3441_5(int x) { return x * 5; }
+inline int f3441_6(int x) { return x * 6; }
+inline int f3441_7(int x) { return x * 7; }
+inline int f3441_8(int x) { return x * 8; }
+inline int f3441_9(int x) { return x * 9; }
+inline int f3441_10(int x) { return x * 10; }
+inline int f3441_11(int x) { return x * 11; }
+inline int f3441_12(int x) { return x * 12; }
+inline int f3441_13(int x) { return x * 13; }
+inline int f3441_14(int x) { return x * 14; }
+inline int f3441_15(int x) { return x * 15; }
+inline int f3441_16(int x) { return x * 16; }
+inline int f3441_17(int x) { return x * 17; }
+inline int f3441_18(int x) { return x * 18; }
+inline int f3441_19(int x) { return x * 19; }
+inline int f3441_20(int x) { return x * 20; }
+inline int f3441_21(int x) { return x * 21; }
+inline int f3441_22(int x) { return x * 22; }
+inline int f3441_23(int x) { return x * 23; }
+inline int f3441_24(int x) { return x * 24; }
+inline int f3441_25(int x) { return x * 25; }
+inline int f3441_26(int x) { return x * 26; }
+inline int f3441_27(int x) { return x * 27; }
+inline int f3441_28(int x) { return x * 28; }
+inline int f3441_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3443 */
+#include <vector>
+#include "h6130.h"
+#include "h7905.h"
+#include "h6611.h"
+#include "h5953.h"
+#include "h8602.h"
+#ifdef X
+#include "h5938.h"
+#endif
+struct S3443 { int a; const char *s = "x//y"; };
+inline int f3443_0(int x) { return x * 0; }
+inline int f3443_1(int x) { return x * 1; }
+inline int f3443_2(int x) { return x * 2; }
+inline int f3443_3(int x) { return x * 3; }
+inline int f3443_4(int x) { return x * 4; }
+inline int f3443_5(int x) { return x * 5; }
+inline int f3443_6(int x) { return x * 6; }
+inline int f3443_7(int x) { return x * 7; }
+inline int f3443_8(int x) { return x * 8; }
+inline int f3443_9(int x) { return x * 9; }
+inline int f3443_10(int x) { return x * 10; }
+inline int f3443_11(int x) { return x * 11; }
+inline int f3443_12(int x) { return x * 12; }
+inline int f3443_13(int x) { return x * 13; }
+inline int f3443_14(int x) { return x * 14; }
+inline int f3443_15(int x) { return x * 15; }
+inline int f3443_16(int x) { return x * 16; }
+inline int f3443_17(int x) { return x * 17; }
+inline int f3443_18(int x) { return x * 18; }
+inline int f3443_19(int x) { return x * 19; }
+inline int f3443_20(int x) { return x * 20; }
+inline int f3443_21(int x) { return x * 21; }
+inline int f3443_22(int x) { return x * 22; }
+inline int f3443_23(int x) { return x * 23; }
+inline int f3443_24(int x) { return x * 24; }
+inline int f3443_25(int x) { return x * 25; }
+inline int f3443_26(int x) { return x * 26; }
+inline int f3443_27(int x) { return x * 27; }
+inline int f3443_28(int x) { return x * 28; }
+inline int f3443_29(int x) { return x * 29; }
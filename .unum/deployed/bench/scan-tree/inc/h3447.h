@@ -0,0 +1,42 @@
+#pragma once
+/* header 3447 */
+#include <vector>
+#include "h5747.h"
+#include "h8348.h"
+#include "h6974.h"
+#include "h5880.h"
+#include "h8065.h"
+#ifdef X
+#include "h1903.h"
+#endif
+struct S3447 { int a; const char *s = "x//y"; };
+inline int f3447_0(int x) { return x * 0; }
+inline int f3447_1(int x) { return x * 1; }
+inline int f3447_2(int x) { return x * 2; }
+inline int f3447_3(int x) { return x * 3; }
+inline int f3447_4(int x) { return x * 4; }
+inline int f3447_5(int x) { return x * 5; }
+inline int f3447_6(int x) { return x * 6; }
+inline int f3447_7(int x) { return x * 7; }
+inline int f3447_8(int x) { return x * 8; }
+inline int f3447_9(int x) { return x * 9; }
+inline int f3447_10(int x) { return x * 10; }
+inline int f3447_11(int x) { return x * 11; }
+inline int f3447_12(int x) { return x * 12; }
+inline int f3447_13(int x) { return x * 13; }
+inline int f3447_14(int x) { return x * 14; }
+inline int f3447_15(int x) { return x * 15; }
+inline int f3447_16(int x) { return x * 16; }
+inline int f3447_17(int x) { return x * 17; }
+inline int f3447_18(int x) { return x * 18; }
+inline int f3447_19(int x) { return x * 19; }
+inline int f3447_20(int x) { return x * 20; }
+inline int f3447_21(int x) { return x * 21; }
+inline int f3447_22(int x) { return x * 22; }
+inline int f3447_23(int x) { return x * 23; }
+inline int f3447_24(int x) { return x * 24; }
+inline int f3447_25(int x) { return x * 25; }
+inline int f3447_26(int x) { return x * 26; }
+inline int f3447_27(int x) { return x * 27; }
+inline int f3447_28(int x) { return x * 28; }
+inline int f3447_29(int x) { return x * 29; }
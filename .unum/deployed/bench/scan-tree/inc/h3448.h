@@ -0,0 +1,42 @@
+#pragma once
+/* header 3448 */
+#include <vector>
+#include "h5202.h"
+#include "h8799.h"
+#include "h4933.h"
+#include "h4095.h"
+#include "h7459.h"
+#ifdef X
+#include "h3010.h"
+#endif
+struct S3448 { int a; const char *s = "x//y"; };
+inline int f3448_0(int x) { return x * 0; }
+inline int f3448_1(int x) { return x * 1; }
+inline int f3448_2(int x) { return x * 2; }
+inline int f3448_3(int x) { return x * 3; }
+inline int f3448_4(int x) { return x * 4; }
+inline int f3448_5(int x) { return x * 5; }
+inline int f3448_6(int x) { return x * 6; }
+inline int f3448_7(int x) { return x * 7; }
+inline int f3448_8(int x) { return x * 8; }
+inline int f3448_9(int x) { return x * 9; }
+inline int f3448_10(int x) { return x * 10; }
+inline int f3448_11(int x) { return x * 11; }
+inline int f3448_12(int x) { return x * 12; }
+inline int f3448_13(int x) { return x * 13; }
+inline int f3448_14(int x) { return x * 14; }
+inline int f3448_15(int x) { return x * 15; }
+inline int f3448_16(int x) { return x * 16; }
+inline int f3448_17(int x) { return x * 17; }
+inline int f3448_18(int x) { return x * 18; }
+inline int f3448_19(int x) { return x * 19; }
+inline int f3448_20(int x) { return x * 20; }
+inline int f3448_21(int x) { return x * 21; }
+inline int f3448_22(int x) { return x * 22; }
+inline int f3448_23(int x) { return x * 23; }
+inline int f3448_24(int x) { return x * 24; }
+inline int f3448_25(int x) { return x * 25; }
+inline int f3448_26(int x) { return x * 26; }
+inline int f3448_27(int x) { return x * 27; }
+inline int f3448_28(int x) { return x * 28; }
+inline int f3448_29(int x) { return x * 29; }
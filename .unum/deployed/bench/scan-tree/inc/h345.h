@@ -0,0 +1,42 @@
+#pragma once
+/* header 345 */
+#include <vector>
+#include "h1613.h"
+#include "h8577.h"
+#include "h8854.h"
+#include "h4418.h"
+#include "h2853.h"
+#ifdef X
+#include "h7924.h"
+#endif
+struct S345 { int a; const char *s = "x//y"; };
+inline int f345_0(int x) { return x * 0; }
+inline int f345_1(int x) { return x * 1; }
+inline int f345_2(int x) { return x * 2; }
+inline int f345_3(int x) { return x * 3; }
+inline int f345_4(int x) { return x * 4; }
+inline int f345_5(int x) { return x * 5; }
+inline int f345_6(int x) { return x * 6; }
+inline int f345_7(int x) { return x * 7; }
+inline int f345_8(int x) { return x * 8; }
+inline int f345_9(int x) { return x * 9; }
+inline int f345_10(int x) { return x * 10; }
+inline int f345_11(int x) { return x * 11; }
+inline int f345_12(int x) { return x * 12; }
+inline int f345_13(int x) { return x * 13; }
+inline int f345_14(int x) { return x * 14; }
+inline int f345_15(int x) { return x * 15; }
+inline int f345_16(int x) { return x * 16; }
+inline int f345_17(int x) { return x * 17; }
+inline int f345_18(int x) { return x * 18; }
+inline int f345_19(int x) { return x * 19; }
+inline int f345_20(int x) { return x * 20; }
+inline int f345_21(int x) { return x * 21; }
+inline int f345_22(int x) { return x * 22; }
+inline int f345_23(int x) { return x * 23; }
+inline int f345_24(int x) { return x * 24; }
+inline int f345_25(int x) { return x * 25; }
+inline int f345_26(int x) { return x * 26; }
+inline int f345_27(int x) { return x * 27; }
+inline int f345_28(int x) { return x * 28; }
+inline int f345_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3453 */
+#include <vector>
+#include "h5713.h"
+#include "h1788.h"
+#include "h5093.h"
+#include "h2729.h"
+#include "h336.h"
+#ifdef X
+#include "h4161.h"
+#endif
+struct S3453 { int a; const char *s = "x//y"; };
+inline int f3453_0(int x) { return x * 0; }
+inline int f3453_1(int x) { return x * 1; }
+inline int f3453_2(int x) { return x * 2; }
+inline int f3453_3(int x) { return x * 3; }
+inline int f3453_4(int x) { return x * 4; }
+inline int f3453_5(int x) { return x * 5; }
+inline int f3453_6(int x) { return x * 6; }
+inline int f3453_7(int x) { return x * 7; }
+inline int f3453_8(int x) { return x * 8; }
+inline int f3453_9(int x) { return x * 9; }
+inline int f3453_10(int x) { return x * 10; }
+inline int f3453_11(int x) { return x * 11; }
+inline int f3453_12(int x) { return x * 12; }
+inline int f3453_13(int x) { return x * 13; }
+inline int f3453_14(int x) { return x * 14; }
+inline int f3453_15(int x) { return x * 15; }
+inline int f3453_16(int x) { return x * 16; }
+inline int f3453_17(int x) { return x * 17; }
+inline int f3453_18(int x) { return x * 18; }
+inline int f3453_19(int x) { return x * 19; }
+inline int f3453_20(int x) { return x * 20; }
+inline int f3453_21(int x) { return x * 21; }
+inline int f3453_22(int x) { return x * 22; }
+inline int f3453_23(int x) { return x * 23; }
+inline int f3453_24(int x) { return x * 24; }
+inline int f3453_25(int x) { return x * 25; }
+inline int f3453_26(int x) { return x * 26; }
+inline int f3453_27(int x) { return x * 27; }
+inline int f3453_28(int x) { return x * 28; }
+inline int f3453_29(int x) { return x * 29; }
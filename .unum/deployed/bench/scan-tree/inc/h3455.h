@@ -0,0 +1,42 @@
+#pragma once
+/* header 3455 */
+#include <vector>
+#include "h1189.h"
+#include "h4310.h"
+#include "h2217.h"
+#include "h566.h"
+#include "h2640.h"
+#ifdef X
+#include "h5790.h"
+#endif
+struct S3455 { int a; const char *s = "x//y"; };
+inline int f3455_0(int x) { return x * 0; }
+inline int f3455_1(int x) { return x * 1; }
+inline int f3455_2(int x) { return x * 2; }
+inline int f3455_3(int x) { return x * 3; }
+inline int f3455_4(int x) { return x * 4; }
+inline int f3455_5(int x) { return x * 5; }
+inline int f3455_6(int x) { return x * 6; }
+inline int f3455_7(int x) { return x * 7; }
+inline int f3455_8(int x) { return x * 8; }
+inline int f3455_9(int x) { return x * 9; }
+inline int f3455_10(int x) { return x * 10; }
+inline int f3455_11(int x) { return x * 11; }
+inline int f3455_12(int x) { return x * 12; }
+inline int f3455_13(int x) { return x * 13; }
+inline int f3455_14(int x) { return x * 14; }
+inline int f3455_15(int x) { return x * 15; }
+inline int f3455_16(int x) { return x * 16; }
+inline int f3455_17(int x) { return x * 17; }
+inline int f3455_18(int x) { return x * 18; }
+inline int f3455_19(int x) { return x * 19; }
+inline int f3455_20(int x) { return x * 20; }
+inline int f3455_21(int x) { return x * 21; }
+inline int f3455_22(int x) { return x * 22; }
+inline int f3455_23(int x) { return x * 23; }
+inline int f3455_24(int x) { return x * 24; }
+inline int f3455_25(int x) { return x * 25; }
+inline int f3455_26(int x) { return x * 26; }
+inline int f3455_27(int x) { return x * 27; }
+inline int f3455_28(int x) { return x * 28; }
+inline int f3455_29(int x) { return x * 29; }
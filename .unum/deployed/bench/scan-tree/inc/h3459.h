@@ -0,0 +1,42 @@
+#pragma once
+/* header 3459 */
+#include <vector>
+#include "h5488.h"
+#include "h109.h"
+#include "h4059.h"
+#include "h1504.h"
+#include "h1694.h"
+#ifdef X
+#include "h3510.h"
+#endif
+struct S3459 { int a; const char *s = "x//y"; };
+inline int f3459_0(int x) { return x * 0; }
+inline int f3459_1(int x) { return x * 1; }
+inline int f3459_2(int x) { return x * 2; }
+inline int f3459_3(int x) { return x * 3; }
+inline int f3459_4(int x) { return x * 4; }
+inline int f3459_5(int x) { return x * 5; }
+inline int f3459_6(int x) { return x * 6; }
+inline int f3459_7(int x) { return x * 7; }
+inline int f3459_8(int x) { return x * 8; }
+inline int f3459_9(int x) { return x * 9; }
+inline int f3459_10(int x) { return x * 10; }
+inline int f3459_11(int x) { return x * 11; }
+inline int f3459_12(int x) { return x * 12; }
+inline int f3459_13(int x) { return x * 13; }
+inline int f3459_14(int x) { return x * 14; }
+inline int f3459_15(int x) { return x * 15; }
+inline int f3459_16(int x) { return x * 16; }
+inline int f3459_17(int x) { return x * 17; }
+inline int f3459_18(int x) { return x * 18; }
+inline int f3459_19(int x) { return x * 19; }
+inline int f3459_20(int x) { return x * 20; }
+inline int f3459_21(int x) { return x * 21; }
+inline int f3459_22(int x) { return x * 22; }
+inline int f3459_23(int x) { return x * 23; }
+inline int f3459_24(int x) { return x * 24; }
+inline int f3459_25(int x) { return x * 25; }
+inline int f3459_26(int x) { return x * 26; }
+inline int f3459_27(int x) { return x * 27; }
+inline int f3459_28(int x) { return x * 28; }
+inline int f3459_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 346 */
+#include <vector>
+#include "h1480.h"
+#include "h6014.h"
+#include "h8225.h"
+#include "h3667.h"
+#include "h1584.h"
+#ifdef X
+#include "h9668.h"
+#endif
+struct S346 { int a; const char *s = "x//y"; };
+inline int f346_0(int x) { return x * 0; }
+inline int f346_1(int x) { return x * 1; }
+inline int f346_2(int x) { return x * 2; }
+inline int f346_3(int x) { return x * 3; }
+inline int f346_4(int x) { return x * 4; }
+inline int f346_5(int x) { return x * 5; }
+inline int f346_6(int x) { return x * 6; }
+inline int f346_7(int x) { return x * 7; }
+inline int f346_8(int x) { return x * 8; }
+inline int f346_9(int x) { return x * 9; }
+inline int f346_10(int x) { return x * 10; }
+inline int f346_11(int x) { return x * 11; }
+inline int f346_12(int x) { return x * 12; }
+inline int f346_13(int x) { return x * 13; }
+inline int f346_14(int x) { return x * 14; }
+inline int f346_15(int x) { return x * 15; }
+inline int f346_16(int x) { return x * 16; }
+inline int f346_17(int x) { return x * 17; }
+inline int f346_18(int x) { return x * 18; }
+inline int f346_19(int x) { return x * 19; }
+inline int f346_20(int x) { return x * 20; }
+inline int f346_21(int x) { return x * 21; }
+inline int f346_22(int x) { return x * 22; }
+inline int f346_23(int x) { return x * 23; }
+inline int f346_24(int x) { return x * 24; }
+inline int f346_25(int x) { return x * 25; }
+inline int f346_26(int x) { return x * 26; }
+inline int f346_27(int x) { return x * 27; }
+inline int f346_28(int x) { return x * 28; }
+inline int f346_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3460 */
+#include <vector>
+#include "h380.h"
+#include "h9163.h"
+#include "h4938.h"
+#include "h9232.h"
+#include "h1075.h"
+#ifdef X
+#include "h4540.h"
+#endif
+struct S3460 { int a; const char *s = "x//y"; };
+inline int f3460_0(int x) { return x * 0; }
+inline int f3460_1(int x) { return x * 1; }
+inline int f3460_2(int x) { return x * 2; }
+inline int f3460_3(int x) { return x * 3; }
+inline int f3460_4(int x) { return x * 4; }
+inline int f3460_5(int x) { return x * 5; }
+inline int f3460_6(int x) { return x * 6; }
+inline int f3460_7(int x) { return x * 7; }
+inline int f3460_8(int x) { return x * 8; }
+inline int f3460_9(int x) { return x * 9; }
+inline int f3460_10(int x) { return x * 10; }
+inline int f3460_11(int x) { return x * 11; }
+inline int f3460_12(int x) { return x * 12; }
+inline int f3460_13(int x) { return x * 13; }
+inline int f3460_14(int x) { return x * 14; }
+inline int f3460_15(int x) { return x * 15; }
+inline int f3460_16(int x) { return x * 16; }
+inline int f3460_17(int x) { return x * 17; }
+inline int f3460_18(int x) { return x * 18; }
+inline int f3460_19(int x) { return x * 19; }
+inline int f3460_20(int x) { return x * 20; }
+inline int f3460_21(int x) { return x * 21; }
+inline int f3460_22(int x) { return x * 22; }
+inline int f3460_23(int x) { return x * 23; }
+inline int f3460_24(int x) { return x * 24; }
+inline int f3460_25(int x) { return x * 25; }
+inline int f3460_26(int x) { return x * 26; }
+inline int f3460_27(int x) { return x * 27; }
+inline int f3460_28(int x) { return x * 28; }
+inline int f3460_29(int x) { return x * 29; }
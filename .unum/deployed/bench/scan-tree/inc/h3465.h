@@ -0,0 +1,42 @@
+#pragma once
+/* header 3465 */
+#include <vector>
+#include "h4263.h"
+#include "h5758.h"
+#include "h6164.h"
+#include "h5353.h"
+#include "h4799.h"
+#ifdef X
+#include "h1393.h"
+#endif
+struct S3465 { int a; const char *s = "x//y"; };
+inline int f3465_0(int x) { return x * 0; }
+inline int f3465_1(int x) { return x * 1; }
+inline int f3465_2(int x) { return x * 2; }
+inline int f3465_3(int x) { return x * 3; }
+inline int f3465_4(int x) { return x * 4; }
+inline int f3465_5(int x) { return x * 5; }
+inline int f3465_6(int x) { return x * 6; }
+inline int f3465_7(int x) { return x * 7; }
+inline int f3465_8(int x) { return x * 8; }
+inline int f3465_9(int x) { return x * 9; }
+inline int f3465_10(int x) { return x * 10; }
+inline int f3465_11(int x) { return x * 11; }
+inline int f3465_12(int x) { return x * 12; }
+inline int f3465_13(int x) { return x * 13; }
+inline int f3465_14(int x) { return x * 14; }
+inline int f3465_15(int x) { return x * 15; }
+inline int f3465_16(int x) { return x * 16; }
+inline int f3465_17(int x) { return x * 17; }
+inline int f3465_18(int x) { return x * 18; }
+inline int f3465_19(int x) { return x * 19; }
+inline int f3465_20(int x) { return x * 20; }
+inline int f3465_21(int x) { return x * 21; }
+inline int f3465_22(int x) { return x * 22; }
+inline int f3465_23(int x) { return x * 23; }
+inline int f3465_24(int x) { return x * 24; }
+inline int f3465_25(int x) { return x * 25; }
+inline int f3465_26(int x) { return x * 26; }
+inline int f3465_27(int x) { return x * 27; }
+inline int f3465_28(int x) { return x * 28; }
+inline int f3465_29(int x) { return x * 29; }
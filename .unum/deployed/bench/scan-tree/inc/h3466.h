@@ -0,0 +1,42 @@
+#pragma once
+/* header 3466 */
+#include <vector>
+#include "h3268.h"
+#include "h4894.h"
+#include "h7001.h"
+#include "h5798.h"
+#include "h8839.h"
+#ifdef X
+#include "h5513.h"
+#endif
+struct S3466 { int a; const char *s = "x//y"; };
+inline int f3466_0(int x) { return x * 0; }
+inline int f3466_1(int x) { return x * 1; }
+inline int f3466_2(int x) { return x * 2; }
+inline int f3466_3(int x) { return x * 3; }
+inline int f3466_4(int x) { return x * 4; }
+inline int f3466_5(int x) { return x * 5; }
+inline int f3466_6(int x) { return x * 6; }
+inline int f3466_7(int x) { return x * 7; }
+inline int f3466_8(int x) { return x * 8; }
+inline int f3466_9(int x) { return x * 9; }
+inline int f3466_10(int x) { return x * 10; }
+inline int f3466_11(int x) { return x * 11; }
+inline int f3466_12(int x) { return x * 12; }
+inline int f3466_13(int x) { return x * 13; }
+inline int f3466_14(int x) { return x * 14; }
+inline int f3466_15(int x) { return x * 15; }
+inline int f3466_16(int x) { return x * 16; }
+inline int f3466_17(int x) { return x * 17; }
+inline int f3466_18(int x) { return x * 18; }
+inline int f3466_19(int x) { return x * 19; }
+inline int f3466_20(int x) { return x * 20; }
+inline int f3466_21(int x) { return x * 21; }
+inline int f3466_22(int x) { return x * 22; }
+inline int f3466_23(int x) { return x * 23; }
+inline int f3466_24(int x) { return x * 24; }
+inline int f3466_25(int x) { return x * 25; }
+inline int f3466_26(int x) { return x * 26; }
+inline int f3466_27(int x) { return x * 27; }
+inline int f3466_28(int x) { return x * 28; }
+inline int f3466_29(int x) { return x * 29; }
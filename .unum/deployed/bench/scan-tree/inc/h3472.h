@@ -0,0 +1,42 @@
+#pragma once
+/* header 3472 */
+#include <vector>
+#include "h3910.h"
+#include "h9271.h"
+#include "h1862.h"
+#include "h9888.h"
+#include "h1079.h"
+#ifdef X
+#include "h7773.h"
+#endif
+struct S3472 { int a; const char *s = "x//y"; };
+inline int f3472_0(int x) { return x * 0; }
+inline int f3472_1(int x) { return x * 1; }
+inline int f3472_2(int x) { return x * 2; }
+inline int f3472_3(int x) { return x * 3; }
+inline int f3472_4(int x) { return x * 4; }
+inline int f3472_5(int x) { return x * 5; }
+inline int f3472_6(int x) { return x * 6; }
+inline int f3472_7(int x) { return x * 7; }
+inline int f3472_8(int x) { return x * 8; }
+inline int f3472_9(int x) { return x * 9; }
+inline int f3472_10(int x) { return x * 10; }
+inline int f3472_11(int x) { return x * 11; }
+inline int f3472_12(int x) { return x * 12; }
+inline int f3472_13(int x) { return x * 13; }
+inline int f3472_14(int x) { return x * 14; }
+inline int f3472_15(int x) { return x * 15; }
+inline int f3472_16(int x) { return x * 16; }
+inline int f3472_17(int x) { return x * 17; }
+inline int f3472_18(int x) { return x * 18; }
+inline int f3472_19(int x) { return x * 19; }
+inline int f3472_20(int x) { return x * 20; }
+inline int f3472_21(int x) { return x * 21; }
+inline int f3472_22(int x) { return x * 22; }
+inline int f3472_23(int x) { return x * 23; }
+inline int f3472_24(int x) { return x * 24; }
+inline int f3472_25(int x) { return x * 25; }
+inline int f3472_26(int x) { return x * 26; }
+inline int f3472_27(int x) { return x * 27; }
+inline int f3472_28(int x) { return x * 28; }
+inline int f3472_29(int x) { return x * 29; }
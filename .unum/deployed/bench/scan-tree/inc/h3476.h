@@ -0,0 +1,42 @@
+#pragma once
+/* header 3476 */
+#include <vector>
+#include "h3156.h"
+#include "h4944.h"
+#include "h6928.h"
+#include "h7311.h"
+#include "h1299.h"
+#ifdef X
+#include "h6768.h"
+#endif
+struct S3476 { int a; const char *s = "x//y"; };
+inline int f3476_0(int x) { return x * 0; }
+inline int f3476_1(int x) { return x * 1; }
+inline int f3476_2(int x) { return x * 2; }
+inline int f3476_3(int x) { return x * 3; }
+inline int f3476_4(int x) { return x * 4; }
+inline int f3476_5(int x) { return x * 5; }
+inline int f3476_6(int x) { return x * 6; }
+inline int f3476_7(int x) { return x * 7; }
+inline int f3476_8(int x) { return x * 8; }
+inline int f3476_9(int x) { return x * 9; }
+inline int f3476_10(int x) { return x * 10; }
+inline int f3476_11(int x) { return x * 11; }
+inline int f3476_12(int x) { return x * 12; }
+inline int f3476_13(int x) { return x * 13; }
+inline int f3476_14(int x) { return x * 14; }
+inline int f3476_15(int x) { return x * 15; }
+inline int f3476_16(int x) { return x * 16; }
+inline int f3476_17(int x) { return x * 17; }
+inline int f3476_18(int x) { return x * 18; }
+inline int f3476_19(int x) { return x * 19; }
+inline int f3476_20(int x) { return x * 20; }
+inline int f3476_21(int x) { return x * 21; }
+inline int f3476_22(int x) { return x * 22; }
+inline int f3476_23(int x) { return x * 23; }
+inline int f3476_24(int x) { return x * 24; }
+inline int f3476_25(int x) { return x * 25; }
+inline int f3476_26(int x) { return x * 26; }
+inline int f3476_27(int x) { return x * 27; }
+inline int f3476_28(int x) { return x * 28; }
+inline int f3476_29(int x) { return x * 29; }
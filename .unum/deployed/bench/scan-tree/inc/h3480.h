@@ -0,0 +1,42 @@
+#pragma once
+/* header 3480 */
+#include <vector>
+#include "h4064.h"
+#include "h9109.h"
+#include "h2743.h"
+#include "h3866.h"
+#include "h7110.h"
+#ifdef X
+#include "h1739.h"
+#endif
+struct S3480 { int a; const char *s = "x//y"; };
+inline int f3480_0(int x) { return x * 0; }
+inline int f3480_1(int x) { return x * 1; }
+inline int f3480_2(int x) { return x * 2; }
+inline int f3480_3(int x) { return x * 3; }
+inline int f3480_4(int x) { return x * 4; }
+inline int f3480_5(int x) { return x * 5; }
+inline int f3480_6(int x) { return x * 6; }
+inline int f3480_7(int x) { return x * 7; }
+inline int f3480_8(int x) { return x * 8; }
+inline int f3480_9(int x) { return x * 9; }
+inline int f3480_10(int x) { return x * 10; }
+inline int f3480_11(int x) { return x * 11; }
+inline int f3480_12(int x) { return x * 12; }
+inline int f3480_13(int x) { return x * 13; }
+inline int f3480_14(int x) { return x * 14; }
+inline int f3480_15(int x) { return x * 15; }
+inline int f3480_16(int x) { return x * 16; }
+inline int f3480_17(int x) { return x * 17; }
+inline int f3480_18(int x) { return x * 18; }
+inline int f3480_19(int x) { return x * 19; }
+inline int f3480_20(int x) { return x * 20; }
+inline int f3480_21(int x) { return x * 21; }
+inline int f3480_22(int x) { return x * 22; }
+inline int f3480_23(int x) { return x * 23; }
+inline int f3480_24(int x) { return x * 24; }
+inline int f3480_25(int x) { return x * 25; }
+inline int f3480_26(int x) { return x * 26; }
+inline int f3480_27(int x) { return x * 27; }
+inline int f3480_28(int x) { return x * 28; }
+inline int f3480_29(int x) { return x * 29; }
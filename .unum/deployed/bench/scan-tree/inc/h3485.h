@@ -0,0 +1,42 @@
+#pragma once
+/* header 3485 */
+#include <vector>
+#include "h6862.h"
+#include "h2634.h"
+#include "h6099.h"
+#include "h3174.h"
+#include "h5839.h"
+#ifdef X
+#include "h5145.h"
+#endif
+struct S3485 { int a; const char *s = "x//y"; };
+inline int f3485_0(int x) { return x * 0; }
+inline int f3485_1(int x) { return x * 1; }
+inline int f3485_2(int x) { return x * 2; }
+inline int f3485_3(int x) { return x * 3; }
+inline int f3485_4(int x) { return x * 4; }
+inline int f3485_5(int x) { return x * 5; }
+inline int f3485_6(int x) { return x * 6; }
+inline int f3485_7(int x) { return x * 7; }
+inline int f3485_8(int x) { return x * 8; }
+inline int f3485_9(int x) { return x * 9; }
+inline int f3485_10(int x) { return x * 10; }
+inline int f3485_11(int x) { return x * 11; }
+inline int f3485_12(int x) { return x * 12; }
+inline int f3485_13(int x) { return x * 13; }
+inline int f3485_14(int x) { return x * 14; }
+inline int f3485_15(int x) { return x * 15; }
+inline int f3485_16(int x) { return x * 16; }
+inline int f3485_17(int x) { return x * 17; }
+inline int f3485_18(int x) { return x * 18; }
+inline int f3485_19(int x) { return x * 19; }
+inline int f3485_20(int x) { return x * 20; }
+inline int f3485_21(int x) { return x * 21; }
+inline int f3485_22(int x) { return x * 22; }
+inline int f3485_23(int x) { return x * 23; }
+inline int f3485_24(int x) { return x * 24; }
+inline int f3485_25(int x) { return x * 25; }
+inline int f3485_26(int x) { return x * 26; }
+inline int f3485_27(int x) { return x * 27; }
+inline int f3485_28(int x) { return x * 28; }
+inline int f3485_29(int x) { return x * 29; }
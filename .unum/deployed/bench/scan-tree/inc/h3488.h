@@ -0,0 +1,42 @@
+#pragma once
+/* header 3488 */
+#include <vector>
+#include "h2756.h"
+#include "h3507.h"
+#include "h8236.h"
+#include "h3239.h"
+#include "h7661.h"
+#ifdef X
+#include "h9054.h"
+#endif
+struct S3488 { int a; const char *s = "x//y"; };
+inline int f3488_0(int x) { return x * 0; }
+inline int f3488_1(int x) { return x * 1; }
+inline int f3488_2(int x) { return x * 2; }
+inline int f3488_3(int x) { return x * 3; }
+inline int f3488_4(int x) { return x * 4; }
+inline int f3488_5(int x) { return x * 5; }
+inline int f3488_6(int x) { return x * 6; }
+inline int f3488_7(int x) { return x * 7; }
+inline int f3488_8(int x) { return x * 8; }
+inline int f3488_9(int x) { return x * 9; }
+inline int f3488_10(int x) { return x * 10; }
+inline int f3488_11(int x) { return x * 11; }
+inline int f3488_12(int x) { return x * 12; }
+inline int f3488_13(int x) { return x * 13; }
+inline int f3488_14(int x) { return x * 14; }
+inline int f3488_15(int x) { return x * 15; }
+inline int f3488_16(int x) { return x * 16; }
+inline int f3488_17(int x) { return x * 17; }
+inline int f3488_18(int x) { return x * 18; }
+inline int f3488_19(int x) { return x * 19; }
+inline int f3488_20(int x) { return x * 20; }
+inline int f3488_21(int x) { return x * 21; }
+inline int f3488_22(int x) { return x * 22; }
+inline int f3488_23(int x) { return x * 23; }
+inline int f3488_24(int x) { return x * 24; }
+inline int f3488_25(int x) { return x * 25; }
+inline int f3488_26(int x) { return x * 26; }
+inline int f3488_27(int x) { return x * 27; }
+inline int f3488_28(int x) { return x * 28; }
+inline int f3488_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3489 */
+#include <vector>
+#include "h791.h"
+#include "h7934.h"
+#include "h845.h"
+#include "h9188.h"
+#include "h613.h"
+#ifdef X
+#include "h1173.h"
+#endif
+struct S3489 { int a; const char *s = "x//y"; };
+inline int f3489_0(int x) { return x * 0; }
+inline int f3489_1(int x) { return x * 1; }
+inline int f3489_2(int x) { return x * 2; }
+inline int f3489_3(int x) { return x * 3; }
+inline int f3489_4(int x) { return x * 4; }
+inline int f3489_5(int x) { return x * 5; }
+inline int f3489_6(int x) { return x * 6; }
+inline int f3489_7(int x) { return x * 7; }
+inline int f3489_8(int x) { return x * 8; }
+inline int f3489_9(int x) { return x * 9; }
+inline int f3489_10(int x) { return x * 10; }
+inline int f3489_11(int x) { return x * 11; }
+inline int f3489_12(int x) { return x * 12; }
+inline int f3489_13(int x) { return x * 13; }
+inline int f3489_14(int x) { return x * 14; }
+inline int f3489_15(int x) { return x * 15; }
+inline int f3489_16(int x) { return x * 16; }
+inline int f3489_17(int x) { return x * 17; }
+inline int f3489_18(int x) { return x * 18; }
+inline int f3489_19(int x) { return x * 19; }
+inline int f3489_20(int x) { return x * 20; }
+inline int f3489_21(int x) { return x * 21; }
+inline int f3489_22(int x) { return x * 22; }
+inline int f3489_23(int x) { return x * 23; }
+inline int f3489_24(int x) { return x * 24; }
+inline int f3489_25(int x) { return x * 25; }
+inline int f3489_26(int x) { return x * 26; }
+inline int f3489_27(int x) { return x * 27; }
+inline int f3489_28(int x) { return x * 28; }
+inline int f3489_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 349 */
+#include <vector>
+#include "h6108.h"
+#include "h7142.h"
+#include "h2869.h"
+#include "h1956.h"
+#include "h3283.h"
+#ifdef X
+#include "h9655.h"
+#endif
+struct S349 { int a; const char *s = "x//y"; };
+inline int f349_0(int x) { return x * 0; }
+inline int f349_1(int x) { return x * 1; }
+inline int f349_2(int x) { return x * 2; }
+inline int f349_3(int x) { return x * 3; }
+inline int f349_4(int x) { return x * 4; }
+inline int f349_5(int x) { return x * 5; }
+inline int f349_6(int x) { return x * 6; }
+inline int f349_7(int x) { return x * 7; }
+inline int f349_8(int x) { return x * 8; }
+inline int f349_9(int x) { return x * 9; }
+inline int f349_10(int x) { return x * 10; }
+inline int f349_11(int x) { return x * 11; }
+inline int f349_12(int x) { return x * 12; }
+inline int f349_13(int x) { return x * 13; }
+inline int f349_14(int x) { return x * 14; }
+inline int f349_15(int x) { return x * 15; }
+inline int f349_16(int x) { return x * 16; }
+inline int f349_17(int x) { return x * 17; }
+inline int f349_18(int x) { return x * 18; }
+inline int f349_19(int x) { return x * 19; }
+inline int f349_20(int x) { return x * 20; }
+inline int f349_21(int x) { return x * 21; }
+inline int f349_22(int x) { return x * 22; }
+inline int f349_23(int x) { return x * 23; }
+inline int f349_24(int x) { return x * 24; }
+inline int f349_25(int x) { return x * 25; }
+inline int f349_26(int x) { return x * 26; }
+inline int f349_27(int x) { return x * 27; }
+inline int f349_28(int x) { return x * 28; }
+inline int f349_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3490 */
+#include <vector>
+#include "h5598.h"
+#include "h5186.h"
+#include "h7482.h"
+#include "h4945.h"
+#include "h174.h"
+#ifdef X
+#include "h2107.h"
+#endif
+struct S3490 { int a; const char *s = "x//y"; };
+inline int f3490_0(int x) { return x * 0; }
+inline int f3490_1(int x) { return x * 1; }
+inline int f3490_2(int x) { return x * 2; }
+inline int f3490_3(int x) { return x * 3; }
+inline int f3490_4(int x) { return x * 4; }
+inline int f3490_5(int x) { return x * 5; }
+inline int f3490_6(int x) { return x * 6; }
+inline int f3490_7(int x) { return x * 7; }
+inline int f3490_8(int x) { return x * 8; }
+inline int f3490_9(int x) { return x * 9; }
+inline int f3490_10(int x) { return x * 10; }
+inline int f3490_11(int x) { return x * 11; }
+inline int f3490_12(int x) { return x * 12; }
+inline int f3490_13(int x) { return x * 13; }
+inline int f3490_14(int x) { return x * 14; }
+inline int f3490_15(int x) { return x * 15; }
+inline int f3490_16(int x) { return x * 16; }
+inline int f3490_17(int x) { return x * 17; }
+inline int f3490_18(int x) { return x * 18; }
+inline int f3490_19(int x) { return x * 19; }
+inline int f3490_20(int x) { return x * 20; }
+inline int f3490_21(int x) { return x * 21; }
+inline int f3490_22(int x) { return x * 22; }
+inline int f3490_23(int x) { return x * 23; }
+inline int f3490_24(int x) { return x * 24; }
+inline int f3490_25(int x) { return x * 25; }
+inline int f3490_26(int x) { return x * 26; }
+inline int f3490_27(int x) { return x * 27; }
+inline int f3490_28(int x) { return x * 28; }
+inline int f3490_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3491 */
+#include <vector>
+#include "h9991.h"
+#include "h9414.h"
+#include "h6153.h"
+#include "h2405.h"
+#include "h2354.h"
+#ifdef X
+#include "h9756.h"
+#endif
+struct S3491 { int a; const char *s = "x//y"; };
+inline int f3491_0(int x) { return x * 0; }
+inline int f3491_1(int x) { return x * 1; }
+inline int f3491_2(int x) { return x * 2; }
+inline int f3491_3(int x) { return x * 3; }
+inline int f3491_4(int x) { return x * 4; }
+inline int f3491_5(int x) { return x * 5; }
+inline int f3491_6(int x) { return x * 6; }
+inline int f3491_7(int x) { return x * 7; }
+inline int f3491_8(int x) { return x * 8; }
+inline int f3491_9(int x) { return x * 9; }
+inline int f3491_10(int x) { return x * 10; }
+inline int f3491_11(int x) { return x * 11; }
+inline int f3491_12(int x) { return x * 12; }
+inline int f3491_13(int x) { return x * 13; }
+inline int f3491_14(int x) { return x * 14; }
+inline int f3491_15(int x) { return x * 15; }
+inline int f3491_16(int x) { return x * 16; }
+inline int f3491_17(int x) { return x * 17; }
+inline int f3491_18(int x) { return x * 18; }
+inline int f3491_19(int x) { return x * 19; }
+inline int f3491_20(int x) { return x * 20; }
+inline int f3491_21(int x) { return x * 21; }
+inline int f3491_22(int x) { return x * 22; }
+inline int f3491_23(int x) { return x * 23; }
+inline int f3491_24(int x) { return x * 24; }
+inline int f3491_25(int x) { return x * 25; }
+inline int f3491_26(int x) { return x * 26; }
+inline int f3491_27(int x) { return x * 27; }
+inline int f3491_28(int x) { return x * 28; }
+inline int f3491_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3497 */
+#include <vector>
+#include "h5476.h"
+#include "h2680.h"
+#include "h4449.h"
+#include "h1959.h"
+#include "h8939.h"
+#ifdef X
+#include "h6474.h"
+#endif
+struct S3497 { int a; const char *s = "x//y"; };
+inline int f3497_0(int x) { return x * 0; }
+inline int f3497_1(int x) { return x * 1; }
+inline int f3497_2(int x) { return x * 2; }
+inline int f3497_3(int x) { return x * 3; }
+inline int f3497_4(int x) { return x * 4; }
+inline int f3497_5(int x) { return x * 5; }
+inline int f3497_6(int x) { return x * 6; }
+inline int f3497_7(int x) { return x * 7; }
+inline int f3497_8(int x) { return x * 8; }
+inline int f3497_9(int x) { return x * 9; }
+inline int f3497_10(int x) { return x * 10; }
+inline int f3497_11(int x) { return x * 11; }
+inline int f3497_12(int x) { return x * 12; }
+inline int f3497_13(int x) { return x * 13; }
+inline int f3497_14(int x) { return x * 14; }
+inline int f3497_15(int x) { return x * 15; }
+inline int f3497_16(int x) { return x * 16; }
+inline int f3497_17(int x) { return x * 17; }
+inline int f3497_18(int x) { return x * 18; }
+inline int f3497_19(int x) { return x * 19; }
+inline int f3497_20(int x) { return x * 20; }
+inline int f3497_21(int x) { return x * 21; }
+inline int f3497_22(int x) { return x * 22; }
+inline int f3497_23(int x) { return x * 23; }
+inline int f3497_24(int x) { return x * 24; }
+inline int f3497_25(int x) { return x * 25; }
+inline int f3497_26(int x) { return x * 26; }
+inline int f3497_27(int x) { return x * 27; }
+inline int f3497_28(int x) { return x * 28; }
+inline int f3497_29(int x) { return x * 29; }
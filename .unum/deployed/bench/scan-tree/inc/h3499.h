@@ -0,0 +1,42 @@
+#pragma once
+/* header 3499 */
+#include <vector>
+#include "h2576.h"
+#include "h5780.h"
+#include "h4986.h"
+#include "h8223.h"
+#include "h779.h"
+#ifdef X
+#include "h4530.h"
+#endif
+struct S3499 { int a; const char *s = "x//y"; };
+inline int f3499_0(int x) { return x * 0; }
+inline int f3499_1(int x) { return x * 1; }
+inline int f3499_2(int x) { return x * 2; }
+inline int f3499_3(int x) { return x * 3; }
+inline int f3499_4(int x) { return x * 4; }
+inline int f3499_5(int x) { return x * 5; }
+inline int f3499_6(int x) { return x * 6; }
+inline int f3499_7(int x) { return x * 7; }
+inline int f3499_8(int x) { return x * 8; }
+inline int f3499_9(int x) { return x * 9; }
+inline int f3499_10(int x) { return x * 10; }
+inline int f3499_11(int x) { return x * 11; }
+inline int f3499_12(int x) { return x * 12; }
+inline int f3499_13(int x) { return x * 13; }
+inline int f3499_14(int x) { return x * 14; }
+inline int f3499_15(int x) { return x * 15; }
+inline int f3499_16(int x) { return x * 16; }
+inline int f3499_17(int x) { return x * 17; }
+inline int f3499_18(int x) { return x * 18; }
+inline int f3499_19(int x) { return x * 19; }
+inline int f3499_20(int x) { return x * 20; }
+inline int f3499_21(int x) { return x * 21; }
+inline int f3499_22(int x) { return x * 22; }
+inline int f3499_23(int x) { return x * 23; }
+inline int f3499_24(int x) { return x * 24; }
+inline int f3499_25(int x) { return x * 25; }
+inline int f3499_26(int x) { return x * 26; }
+inline int f3499_27(int x) { return x * 27; }
+inline int f3499_28(int x) { return x * 28; }
+inline int f3499_29(int x) { return x * 29; }
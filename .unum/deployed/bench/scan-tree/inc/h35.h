@@ -0,0 +1,42 @@
+#pragma once
+/* header 35 */
+#include <vector>
+#include "h3329.h"
+#include "h1246.h"
+#include "h4592.h"
+#include "h6562.h"
+#include "h8319.h"
+#ifdef X
+#include "h1966.h"
+#endif
+struct S35 { int a; const char *s = "x//y"; };
+inline int f35_0(int x) { return x * 0; }
+inline int f35_1(int x) { return x * 1; }
+inline int f35_2(int x) { return x * 2; }
+inline int f35_3(int x) { return x * 3; }
+inline int f35_4(int x) { return x * 4; }
+inline int f35_5(int x) { return x * 5; }
+inline int f35_6(int x) { return x * 6; }
+inline int f35_7(int x) { return x * 7; }
+inline int f35_8(int x) { return x * 8; }
+inline int f35_9(int x) { return x * 9; }
+inline int f35_10(int x) { return x * 10; }
+inline int f35_11(int x) { return x * 11; }
+inline int f35_12(int x) { return x * 12; }
+inline int f35_13(int x) { return x * 13; }
+inline int f35_14(int x) { return x * 14; }
+inline int f35_15(int x) { return x * 15; }
+inline int f35_16(int x) { return x * 16; }
+inline int f35_17(int x) { return x * 17; }
+inline int f35_18(int x) { return x * 18; }
+inline int f35_19(int x) { return x * 19; }
+inline int f35_20(int x) { return x * 20; }
+inline int f35_21(int x) { return x * 21; }
+inline int f35_22(int x) { return x * 22; }
+inline int f35_23(int x) { return x * 23; }
+inline int f35_24(int x) { return x * 24; }
+inline int f35_25(int x) { return x * 25; }
+inline int f35_26(int x) { return x * 26; }
+inline int f35_27(int x) { return x * 27; }
+inline int f35_28(int x) { return x * 28; }
+inline int f35_29(int x) { return x * 29; }
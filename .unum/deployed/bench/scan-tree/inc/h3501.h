@@ -0,0 +1,42 @@
+#pragma once
+/* header 3501 */
+#include <vector>
+#include "h9078.h"
+#include "h8498.h"
+#include "h2661.h"
+#include "h8585.h"
+#include "h9950.h"
+#ifdef X
+#include "h988.h"
+#endif
+struct S3501 { int a; const char *s = "x//y"; };
+inline int f3501_0(int x) { return x * 0; }
+inline int f3501_1(int x) { return x * 1; }
+inline int f3501_2(int x) { return x * 2; }
+inline int f3501_3(int x) { return x * 3; }
+inline int f3501_4(int x) { return x * 4; }
+inline int f3501_5(int x) { return x * 5; }
+inline int f3501_6(int x) { return x * 6; }
+inline int f3501_7(int x) { return x * 7; }
+inline int f3501_8(int x) { return x * 8; }
+inline int f3501_9(int x) { return x * 9; }
+inline int f3501_10(int x) { return x * 10; }
+inline int f3501_11(int x) { return x * 11; }
+inline int f3501_12(int x) { return x * 12; }
+inline int f3501_13(int x) { return x * 13; }
+inline int f3501_14(int x) { return x * 14; }
+inline int f3501_15(int x) { return x * 15; }
+inline int f3501_16(int x) { return x * 16; }
+inline int f3501_17(int x) { return x * 17; }
+inline int f3501_18(int x) { return x * 18; }
+inline int f3501_19(int x) { return x * 19; }
+inline int f3501_20(int x) { return x * 20; }
+inline int f3501_21(int x) { return x * 21; }
+inline int f3501_22(int x) { return x * 22; }
+inline int f3501_23(int x) { return x * 23; }
+inline int f3501_24(int x) { return x * 24; }
+inline int f3501_25(int x) { return x * 25; }
+inline int f3501_26(int x) { return x * 26; }
+inline int f3501_27(int x) { return x * 27; }
+inline int f3501_28(int x) { return x * 28; }
+inline int f3501_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3507 */
+#include <vector>
+#include "h2732.h"
+#include "h8808.h"
+#include "h7582.h"
+#include "h1167.h"
+#include "h8432.h"
+#ifdef X
+#include "h464.h"
+#endif
+struct S3507 { int a; const char *s = "x//y"; };
+inline int f3507_0(int x) { return x * 0; }
+inline int f3507_1(int x) { return x * 1; }
+inline int f3507_2(int x) { return x * 2; }
+inline int f3507_3(int x) { return x * 3; }
+inline int f3507_4(int x) { return x * 4; }
+inline int f3507_5(int x) { return x * 5; }
+inline int f3507_6(int x) { return x * 6; }
+inline int f3507_7(int x) { return x * 7; }
+inline int f3507_8(int x) { return x * 8; }
+inline int f3507_9(int x) { return x * 9; }
+inline int f3507_10(int x) { return x * 10; }
+inline int f3507_11(int x) { return x * 11; }
+inline int f3507_12(int x) { return x * 12; }
+inline int f3507_13(int x) { return x * 13; }
+inline int f3507_14(int x) { return x * 14; }
+inline int f3507_15(int x) { return x * 15; }
+inline int f3507_16(int x) { return x * 16; }
+inline int f3507_17(int x) { return x * 17; }
+inline int f3507_18(int x) { return x * 18; }
+inline int f3507_19(int x) { return x * 19; }
+inline int f3507_20(int x) { return x * 20; }
+inline int f3507_21(int x) { return x * 21; }
+inline int f3507_22(int x) { return x * 22; }
+inline int f3507_23(int x) { return x * 23; }
+inline int f3507_24(int x) { return x * 24; }
+inline int f3507_25(int x) { return x * 25; }
+inline int f3507_26(int x) { return x * 26; }
+inline int f3507_27(int x) { return x * 27; }
+inline int f3507_28(int x) { return x * 28; }
+inline int f3507_29(int x) { return x * 29; }
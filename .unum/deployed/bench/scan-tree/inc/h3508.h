@@ -0,0 +1,42 @@
+#pragma once
+/* header 3508 */
+#include <vector>
+#include "h2.h"
+#include "h3546.h"
+#include "h1053.h"
+#include "h9076.h"
+#include "h6014.h"
+#ifdef X
+#include "h6752.h"
+#endif
+struct S3508 { int a; const char *s = "x//y"; };
+inline int f3508_0(int x) { return x * 0; }
+inline int f3508_1(int x) { return x * 1; }
+inline int f3508_2(int x) { return x * 2; }
+inline int f3508_3(int x) { return x * 3; }
+inline int f3508_4(int x) { return x * 4; }
+inline int f3508_5(int x) { return x * 5; }
+inline int f3508_6(int x) { return x * 6; }
+inline int f3508_7(int x) { return x * 7; }
+inline int f3508_8(int x) { return x * 8; }
+inline int f3508_9(int x) { return x * 9; }
+inline int f3508_10(int x) { return x * 10; }
+inline int f3508_11(int x) { return x * 11; }
+inline int f3508_12(int x) { return x * 12; }
+inline int f3508_13(int x) { return x * 13; }
+inline int f3508_14(int x) { return x * 14; }
+inline int f3508_15(int x) { return x * 15; }
+inline int f3508_16(int x) { return x * 16; }
+inline int f3508_17(int x) { return x * 17; }
+inline int f3508_18(int x) { return x * 18; }
+inline int f3508_19(int x) { return x * 19; }
+inline int f3508_20(int x) { return x * 20; }
+inline int f3508_21(int x) { return x * 21; }
+inline int f3508_22(int x) { return x * 22; }
+inline int f3508_23(int x) { return x * 23; }
+inline int f3508_24(int x) { return x * 24; }
+inline int f3508_25(int x) { return x * 25; }
+inline int f3508_26(int x) { return x * 26; }
+inline int f3508_27(int x) { return x * 27; }
+inline int f3508_28(int x) { return x * 28; }
+inline int f3508_29(int x) { return x * 29; }
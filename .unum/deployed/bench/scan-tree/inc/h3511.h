@@ -0,0 +1,42 @@
+#pragma once
+/* header 3511 */
+#include <vector>
+#include "h4687.h"
+#include "h2554.h"
+#include "h1631.h"
+#include "h8570.h"
+#include "h5649.h"
+#ifdef X
+#include "h3881.h"
+#endif
+struct S3511 { int a; const char *s = "x//y"; };
+inline int f3511_0(int x) { return x * 0; }
+inline int f3511_1(int x) { return x * 1; }
+inline int f3511_2(int x) { return x * 2; }
+inline int f3511_3(int x) { return x * 3; }
+inline int f3511_4(int x) { return x * 4; }
+inline int f3511_5(int x) { return x * 5; }
+inline int f3511_6(int x) { return x * 6; }
+inline int f3511_7(int x) { return x * 7; }
+inline int f3511_8(int x) { return x * 8; }
+inline int f3511_9(int x) { return x * 9; }
+inline int f3511_10(int x) { return x * 10; }
+inline int f3511_11(int x) { return x * 11; }
+inline int f3511_12(int x) { return x * 12; }
+inline int f3511_13(int x) { return x * 13; }
+inline int f3511_14(int x) { return x * 14; }
+inline int f3511_15(int x) { return x * 15; }
+inline int f3511_16(int x) { return x * 16; }
+inline int f3511_17(int x) { return x * 17; }
+inline int f3511_18(int x) { return x * 18; }
+inline int f3511_19(int x) { return x * 19; }
+inline int f3511_20(int x) { return x * 20; }
+inline int f3511_21(int x) { return x * 21; }
+inline int f3511_22(int x) { return x * 22; }
+inline int f3511_23(int x) { return x * 23; }
+inline int f3511_24(int x) { return x * 24; }
+inline int f3511_25(int x) { return x * 25; }
+inline int f3511_26(int x) { return x * 26; }
+inline int f3511_27(int x) { return x * 27; }
+inline int f3511_28(int x) { return x * 28; }
+inline int f3511_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3516 */
+#include <vector>
+#include "h285.h"
+#include "h1189.h"
+#include "h4983.h"
+#include "h1677.h"
+#include "h5940.h"
+#ifdef X
+#include "h6960.h"
+#endif
+struct S3516 { int a; const char *s = "x//y"; };
+inline int f3516_0(int x) { return x * 0; }
+inline int f3516_1(int x) { return x * 1; }
+inline int f3516_2(int x) { return x * 2; }
+inline int f3516_3(int x) { return x * 3; }
+inline int f3516_4(int x) { return x * 4; }
+inline int f3516_5(int x) { return x * 5; }
+inline int f3516_6(int x) { return x * 6; }
+inline int f3516_7(int x) { return x * 7; }
+inline int f3516_8(int x) { return x * 8; }
+inline int f3516_9(int x) { return x * 9; }
+inline int f3516_10(int x) { return x * 10; }
+inline int f3516_11(int x) { return x * 11; }
+inline int f3516_12(int x) { return x * 12; }
+inline int f3516_13(int x) { return x * 13; }
+inline int f3516_14(int x) { return x * 14; }
+inline int f3516_15(int x) { return x * 15; }
+inline int f3516_16(int x) { return x * 16; }
+inline int f3516_17(int x) { return x * 17; }
+inline int f3516_18(int x) { return x * 18; }
+inline int f3516_19(int x) { return x * 19; }
+inline int f3516_20(int x) { return x * 20; }
+inline int f3516_21(int x) { return x * 21; }
+inline int f3516_22(int x) { return x * 22; }
+inline int f3516_23(int x) { return x * 23; }
+inline int f3516_24(int x) { return x * 24; }
+inline int f3516_25(int x) { return x * 25; }
+inline int f3516_26(int x) { return x * 26; }
+inline int f3516_27(int x) { return x * 27; }
+inline int f3516_28(int x) { return x * 28; }
+inline int f3516_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3518 */
+#include <vector>
+#include "h7164.h"
+#include "h9090.h"
+#include "h9208.h"
+#include "h1087.h"
+#include "h2610.h"
+#ifdef X
+#include "h3429.h"
+#endif
+struct S3518 { int a; const char *s = "x//y"; };
+inline int f3518_0(int x) { return x * 0; }
+inline int f3518_1(int x) { return x * 1; }
+inline int f3518_2(int x) { return x * 2; }
+inline int f3518_3(int x) { return x * 3; }
+inline int f3518_4(int x) { return x * 4; }
+inline int f3518_5(int x) { return x * 5; }
+inline int f3518_6(int x) { return x * 6; }
+inline int f3518_7(int x) { return x * 7; }
+inline int f3518_8(int x) { return x * 8; }
+inline int f3518_9(int x) { return x * 9; }
+inline int f3518_10(int x) { return x * 10; }
+inline int f3518_11(int x) { return x * 11; }
+inline int f3518_12(int x) { return x * 12; }
+inline int f3518_13(int x) { return x * 13; }
+inline int f3518_14(int x) { return x * 14; }
+inline int f3518_15(int x) { return x * 15; }
+inline int f3518_16(int x) { return x * 16; }
+inline int f3518_17(int x) { return x * 17; }
+inline int f3518_18(int x) { return x * 18; }
+inline int f3518_19(int x) { return x * 19; }
+inline int f3518_20(int x) { return x * 20; }
+inline int f3518_21(int x) { return x * 21; }
+inline int f3518_22(int x) { return x * 22; }
+inline int f3518_23(int x) { return x * 23; }
+inline int f3518_24(int x) { return x * 24; }
+inline int f3518_25(int x) { return x * 25; }
+inline int f3518_26(int x) { return x * 26; }
+inline int f3518_27(int x) { return x * 27; }
+inline int f3518_28(int x) { return x * 28; }
+inline int f3518_29(int x) { return x * 29; }
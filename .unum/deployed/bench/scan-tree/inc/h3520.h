@@ -0,0 +1,42 @@
+#pragma once
+/* header 3520 */
+#include <vector>
+#include "h7573.h"
+#include "h1362.h"
+#include "h7278.h"
+#include "h2315.h"
+#include "h7917.h"
+#ifdef X
+#include "h2952.h"
+#endif
+struct S3520 { int a; const char *s = "x//y"; };
+inline int f3520_0(int x) { return x * 0; }
+inline int f3520_1(int x) { return x * 1; }
+inline int f3520_2(int x) { return x * 2; }
+inline int f3520_3(int x) { return x * 3; }
+inline int f3520_4(int x) { return x * 4; }
+inline int f3520_5(int x) { return x * 5; }
+inline int f3520_6(int x) { return x * 6; }
+inline int f3520_7(int x) { return x * 7; }
+inline int f3520_8(int x) { return x * 8; }
+inline int f3520_9(int x) { return x * 9; }
+inline int f3520_10(int x) { return x * 10; }
+inline int f3520_11(int x) { return x * 11; }
+inline int f3520_12(int x) { return x * 12; }
+inline int f3520_13(int x) { return x * 13; }
+inline int f3520_14(int x) { return x * 14; }
+inline int f3520_15(int x) { return x * 15; }
+inline int f3520_16(int x) { return x * 16; }
+inline int f3520_17(int x) { return x * 17; }
+inline int f3520_18(int x) { return x * 18; }
+inline int f3520_19(int x) { return x * 19; }
+inline int f3520_20(int x) { return x * 20; }
+inline int f3520_21(int x) { return x * 21; }
+inline int f3520_22(int x) { return x * 22; }
+inline int f3520_23(int x) { return x * 23; }
+inline int f3520_24(int x) { return x * 24; }
+inline int f3520_25(int x) { return x * 25; }
+inline int f3520_26(int x) { return x * 26; }
+inline int f3520_27(int x) { return x * 27; }
+inline int f3520_28(int x) { return x * 28; }
+inline int f3520_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3521 */
+#include <vector>
+#include "h6056.h"
+#include "h8422.h"
+#include "h8553.h"
+#include "h1140.h"
+#include "h1410.h"
+#ifdef X
+#include "h2129.h"
+#endif
+struct S3521 { int a; const char *s = "x//y"; };
+inline int f3521_0(int x) { return x * 0; }
+inline int f3521_1(int x) { return x * 1; }
+inline int f3521_2(int x) { return x * 2; }
+inline int f3521_3(int x) { return x * 3; }
+inline int f3521_4(int x) { return x * 4; }
+inline int f3521_5(int x) { return x * 5; }
+inline int f3521_6(int x) { return x * 6; }
+inline int f3521_7(int x) { return x * 7; }
+inline int f3521_8(int x) { return x * 8; }
+inline int f3521_9(int x) { return x * 9; }
+inline int f3521_10(int x) { return x * 10; }
+inline int f3521_11(int x) { return x * 11; }
+inline int f3521_12(int x) { return x * 12; }
+inline int f3521_13(int x) { return x * 13; }
+inline int f3521_14(int x) { return x * 14; }
+inline int f3521_15(int x) { return x * 15; }
+inline int f3521_16(int x) { return x * 16; }
+inline int f3521_17(int x) { return x * 17; }
+inline int f3521_18(int x) { return x * 18; }
+inline int f3521_19(int x) { return x * 19; }
+inline int f3521_20(int x) { return x * 20; }
+inline int f3521_21(int x) { return x * 21; }
+inline int f3521_22(int x) { return x * 22; }
+inline int f3521_23(int x) { return x * 23; }
+inline int f3521_24(int x) { return x * 24; }
+inline int f3521_25(int x) { return x * 25; }
+inline int f3521_26(int x) { return x * 26; }
+inline int f3521_27(int x) { return x * 27; }
+inline int f3521_28(int x) { return x * 28; }
+inline int f3521_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3522 */
+#include <vector>
+#include "h3516.h"
+#include "h3045.h"
+#include "h5736.h"
+#include "h8764.h"
+#include "h1954.h"
+#ifdef X
+#include "h6563.h"
+#endif
+struct S3522 { int a; const char *s = "x//y"; };
+inline int f3522_0(int x) { return x * 0; }
+inline int f3522_1(int x) { return x * 1; }
+inline int f3522_2(int x) { return x * 2; }
+inline int f3522_3(int x) { return x * 3; }
+inline int f3522_4(int x) { return x * 4; }
+inline int f3522_5(int x) { return x * 5; }
+inline int f3522_6(int x) { return x * 6; }
+inline int f3522_7(int x) { return x * 7; }
+inline int f3522_8(int x) { return x * 8; }
+inline int f3522_9(int x) { return x * 9; }
+inline int f3522_10(int x) { return x * 10; }
+inline int f3522_11(int x) { return x * 11; }
+inline int f3522_12(int x) { return x * 12; }
+inline int f3522_13(int x) { return x * 13; }
+inline int f3522_14(int x) { return x * 14; }
+inline int f3522_15(int x) { return x * 15; }
+inline int f3522_16(int x) { return x * 16; }
+inline int f3522_17(int x) { return x * 17; }
+inline int f3522_18(int x) { return x * 18; }
+inline int f3522_19(int x) { return x * 19; }
+inline int f3522_20(int x) { return x * 20; }
+inline int f3522_21(int x) { return x * 21; }
+inline int f3522_22(int x) { return x * 22; }
+inline int f3522_23(int x) { return x * 23; }
+inline int f3522_24(int x) { return x * 24; }
+inline int f3522_25(int x) { return x * 25; }
+inline int f3522_26(int x) { return x * 26; }
+inline int f3522_27(int x) { return x * 27; }
+inline int f3522_28(int x) { return x * 28; }
+inline int f3522_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3523 */
+#include <vector>
+#include "h9141.h"
+#include "h723.h"
+#include "h1761.h"
+#include "h6283.h"
+#include "h3241.h"
+#ifdef X
+#include "h3.h"
+#endif
+struct S3523 { int a; const char *s = "x//y"; };
+inline int f3523_0(int x) { return x * 0; }
+inline int f3523_1(int x) { return x * 1; }
+inline int f3523_2(int x) { return x * 2; }
+inline int f3523_3(int x) { return x * 3; }
+inline int f3523_4(int x) { return x * 4; }
+inline int f3523_5(int x) { return x * 5; }
+inline int f3523_6(int x) { return x * 6; }
+inline int f3523_7(int x) { return x * 7; }
+inline int f3523_8(int x) { return x * 8; }
+inline int f3523_9(int x) { return x * 9; }
+inline int f3523_10(int x) { return x * 10; }
+inline int f3523_11(int x) { return x * 11; }
+inline int f3523_12(int x) { return x * 12; }
+inline int f3523_13(int x) { return x * 13; }
+inline int f3523_14(int x) { return x * 14; }
+inline int f3523_15(int x) { return x * 15; }
+inline int f3523_16(int x) { return x * 16; }
+inline int f3523_17(int x) { return x * 17; }
+inline int f3523_18(int x) { return x * 18; }
+inline int f3523_19(int x) { return x * 19; }
+inline int f3523_20(int x) { return x * 20; }
+inline int f3523_21(int x) { return x * 21; }
+inline int f3523_22(int x) { return x * 22; }
+inline int f3523_23(int x) { return x * 23; }
+inline int f3523_24(int x) { return x * 24; }
+inline int f3523_25(int x) { return x * 25; }
+inline int f3523_26(int x) { return x * 26; }
+inline int f3523_27(int x) { return x * 27; }
+inline int f3523_28(int x) { return x * 28; }
+inline int f3523_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3525 */
+#include <vector>
+#include "h8334.h"
+#include "h8105.h"
+#include "h9645.h"
+#include "h6393.h"
+#include "h3666.h"
+#ifdef X
+#include "h6741.h"
+#endif
+struct S3525 { int a; const char *s = "x//y"; };
+inline int f3525_0(int x) { return x * 0; }
+inline int f3525_1(int x) { return x * 1; }
+inline int f3525_2(int x) { return x * 2; }
+inline int f3525_3(int x) { return x * 3; }
+inline int f3525_4(int x) { return x * 4; }
+inline int f3525_5(int x) { return x * 5; }
+inline int f3525_6(int x) { return x * 6; }
+inline int f3525_7(int x) { return x * 7; }
+inline int f3525_8(int x) { return x * 8; }
+inline int f3525_9(int x) { return x * 9; }
+inline int f3525_10(int x) { return x * 10; }
+inline int f3525_11(int x) { return x * 11; }
+inline int f3525_12(int x) { return x * 12; }
+inline int f3525_13(int x) { return x * 13; }
+inline int f3525_14(int x) { return x * 14; }
+inline int f3525_15(int x) { return x * 15; }
+inline int f3525_16(int x) { return x * 16; }
+inline int f3525_17(int x) { return x * 17; }
+inline int f3525_18(int x) { return x * 18; }
+inline int f3525_19(int x) { return x * 19; }
+inline int f3525_20(int x) { return x * 20; }
+inline int f3525_21(int x) { return x * 21; }
+inline int f3525_22(int x) { return x * 22; }
+inline int f3525_23(int x) { return x * 23; }
+inline int f3525_24(int x) { return x * 24; }
+inline int f3525_25(int x) { return x * 25; }
+inline int f3525_26(int x) { return x * 26; }
+inline int f3525_27(int x) { return x * 27; }
+inline int f3525_28(int x) { return x * 28; }
+inline int f3525_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3527 */
+#include <vector>
+#include "h4456.h"
+#include "h5559.h"
+#include "h8461.h"
+#include "h6889.h"
+#include "h4456.h"
+#ifdef X
+#include "h3722.h"
+#endif
+struct S3527 { int a; const char *s = "x//y"; };
+inline int f3527_0(int x) { return x * 0; }
+inline int f3527_1(int x) { return x * 1; }
+inline int f3527_2(int x) { return x * 2; }
+inline int f3527_3(int x) { return x * 3; }
+inline int f3527_4(int x) { return x * 4; }
+inline int f3527_5(int x) { return x * 5; }
+inline int f3527_6(int x) { return x * 6; }
+inline int f3527_7(int x) { return x * 7; }
+inline int f3527_8(int x) { return x * 8; }
+inline int f3527_9(int x) { return x * 9; }
+inline int f3527_10(int x) { return x * 10; }
+inline int f3527_11(int x) { return x * 11; }
+inline int f3527_12(int x) { return x * 12; }
+inline int f3527_13(int x) { return x * 13; }
+inline int f3527_14(int x) { return x * 14; }
+inline int f3527_15(int x) { return x * 15; }
+inline int f3527_16(int x) { return x * 16; }
+inline int f3527_17(int x) { return x * 17; }
+inline int f3527_18(int x) { return x * 18; }
+inline int f3527_19(int x) { return x * 19; }
+inline int f3527_20(int x) { return x * 20; }
+inline int f3527_21(int x) { return x * 21; }
+inline int f3527_22(int x) { return x * 22; }
+inline int f3527_23(int x) { return x * 23; }
+inline int f3527_24(int x) { return x * 24; }
+inline int f3527_25(int x) { return x * 25; }
+inline int f3527_26(int x) { return x * 26; }
+inline int f3527_27(int x) { return x * 27; }
+inline int f3527_28(int x) { return x * 28; }
+inline int f3527_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3529 */
+#include <vector>
+#include "h9128.h"
+#include "h4728.h"
+#include "h4630.h"
+#include "h7623.h"
+#include "h9961.h"
+#ifdef X
+#include "h7585.h"
+#endif
+struct S3529 { int a; const char *s = "x//y"; };
+inline int f3529_0(int x) { return x * 0; }
+inline int f3529_1(int x) { return x * 1; }
+inline int f3529_2(int x) { return x * 2; }
+inline int f3529_3(int x) { return x * 3; }
+inline int f3529_4(int x) { return x * 4; }
+inline int f3529_5(int x) { return x * 5; }
+inline int f3529_6(int x) { return x * 6; }
+inline int f3529_7(int x) { return x * 7; }
+inline int f3529_8(int x) { return x * 8; }
+inline int f3529_9(int x) { return x * 9; }
+inline int f3529_10(int x) { return x * 10; }
+inline int f3529_11(int x) { return x * 11; }
+inline int f3529_12(int x) { return x * 12; }
+inline int f3529_13(int x) { return x * 13; }
+inline int f3529_14(int x) { return x * 14; }
+inline int f3529_15(int x) { return x * 15; }
+inline int f3529_16(int x) { return x * 16; }
+inline int f3529_17(int x) { return x * 17; }
+inline int f3529_18(int x) { return x * 18; }
+inline int f3529_19(int x) { return x * 19; }
+inline int f3529_20(int x) { return x * 20; }
+inline int f3529_21(int x) { return x * 21; }
+inline int f3529_22(int x) { return x * 22; }
+inline int f3529_23(int x) { return x * 23; }
+inline int f3529_24(int x) { return x * 24; }
+inline int f3529_25(int x) { return x * 25; }
+inline int f3529_26(int x) { return x * 26; }
+inline int f3529_27(int x) { return x * 27; }
+inline int f3529_28(int x) { return x * 28; }
+inline int f3529_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3532 */
+#include <vector>
+#include "h7312.h"
+#include "h3629.h"
+#include "h738.h"
+#include "h5395.h"
+#include "h8438.h"
+#ifdef X
+#include "h1599.h"
+#endif
+struct S3532 { int a; const char *s = "x//y"; };
+inline int f3532_0(int x) { return x * 0; }
+inline int f3532_1(int x) { return x * 1; }
+inline int f3532_2(int x) { return x * 2; }
+inline int f3532_3(int x) { return x * 3; }
+inline int f3532_4(int x) { return x * 4; }
+inline int f3532_5(int x) { return x * 5; }
+inline int f3532_6(int x) { return x * 6; }
+inline int f3532_7(int x) { return x * 7; }
+inline int f3532_8(int x) { return x * 8; }
+inline int f3532_9(int x) { return x * 9; }
+inline int f3532_10(int x) { return x * 10; }
+inline int f3532_11(int x) { return x * 11; }
+inline int f3532_12(int x) { return x * 12; }
+inline int f3532_13(int x) { return x * 13; }
+inline int f3532_14(int x) { return x * 14; }
+inline int f3532_15(int x) { return x * 15; }
+inline int f3532_16(int x) { return x * 16; }
+inline int f3532_17(int x) { return x * 17; }
+inline int f3532_18(int x) { return x * 18; }
+inline int f3532_19(int x) { return x * 19; }
+inline int f3532_20(int x) { return x * 20; }
+inline int f3532_21(int x) { return x * 21; }
+inline int f3532_22(int x) { return x * 22; }
+inline int f3532_23(int x) { return x * 23; }
+inline int f3532_24(int x) { return x * 24; }
+inline int f3532_25(int x) { return x * 25; }
+inline int f3532_26(int x) { return x * 26; }
+inline int f3532_27(int x) { return x * 27; }
+inline int f3532_28(int x) { return x * 28; }
+inline int f3532_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3540 */
+#include <vector>
+#include "h5502.h"
+#include "h8483.h"
+#include "h3732.h"
+#include "h4542.h"
+#include "h4837.h"
+#ifdef X
+#include "h933.h"
+#endif
+struct S3540 { int a; const char *s = "x//y"; };
+inline int f3540_0(int x) { return x * 0; }
+inline int f3540_1(int x) { return x * 1; }
+inline int f3540_2(int x) { return x * 2; }
+inline int f3540_3(int x) { return x * 3; }
+inline int f3540_4(int x) { return x * 4; }
+inline int f3540_5(int x) { return x * 5; }
+inline int f3540_6(int x) { return x * 6; }
+inline int f3540_7(int x) { return x * 7; }
+inline int f3540_8(int x) { return x * 8; }
+inline int f3540_9(int x) { return x * 9; }
+inline int f3540_10(int x) { return x * 10; }
+inline int f3540_11(int x) { return x * 11; }
+inline int f3540_12(int x) { return x * 12; }
+inline int f3540_13(int x) { return x * 13; }
+inline int f3540_14(int x) { return x * 14; }
+inline int f3540_15(int x) { return x * 15; }
+inline int f3540_16(int x) { return x * 16; }
+inline int f3540_17(int x) { return x * 17; }
+inline int f3540_18(int x) { return x * 18; }
+inline int f3540_19(int x) { return x * 19; }
+inline int f3540_20(int x) { return x * 20; }
+inline int f3540_21(int x) { return x * 21; }
+inline int f3540_22(int x) { return x * 22; }
+inline int f3540_23(int x) { return x * 23; }
+inline int f3540_24(int x) { return x * 24; }
+inline int f3540_25(int x) { return x * 25; }
+inline int f3540_26(int x) { return x * 26; }
+inline int f3540_27(int x) { return x * 27; }
+inline int f3540_28(int x) { return x * 28; }
+inline int f3540_29(int x) { return x * 29; }
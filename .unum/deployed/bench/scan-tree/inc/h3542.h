@@ -0,0 +1,42 @@
+#pragma once
+/* header 3542 */
+#include <vector>
+#include "h6503.h"
+#include "h9624.h"
+#include "h9188.h"
+#include "h2902.h"
+#include "h7163.h"
+#ifdef X
+#include "h3918.h"
+#endif
+struct S3542 { int a; const char *s = "x//y"; };
+inline int f3542_0(int x) { return x * 0; }
+inline int f3542_1(int x) { return x * 1; }
+inline int f3542_2(int x) { return x * 2; }
+inline int f3542_3(int x) { return x * 3; }
+inline int f3542_4(int x) { return x * 4; }
+inline int f3542_5(int x) { return x * 5; }
+inline int f3542_6(int x) { return x * 6; }
+inline int f3542_7(int x) { return x * 7; }
+inline int f3542_8(int x) { return x * 8; }
+inline int f3542_9(int x) { return x * 9; }
+inline int f3542_10(int x) { return x * 10; }
+inline int f3542_11(int x) { return x * 11; }
+inline int f3542_12(int x) { return x * 12; }
+inline int f3542_13(int x) { return x * 13; }
+inline int f3542_14(int x) { return x * 14; }
+inline int f3542_15(int x) { return x * 15; }
+inline int f3542_16(int x) { return x * 16; }
+inline int f3542_17(int x) { return x * 17; }
+inline int f3542_18(int x) { return x * 18; }
+inline int f3542_19(int x) { return x * 19; }
+inline int f3542_20(int x) { return x * 20; }
+inline int f3542_21(int x) { return x * 21; }
+inline int f3542_22(int x) { return x * 22; }
+inline int f3542_23(int x) { return x * 23; }
+inline int f3542_24(int x) { return x * 24; }
+inline int f3542_25(int x) { return x * 25; }
+inline int f3542_26(int x) { return x * 26; }
+inline int f3542_27(int x) { return x * 27; }
+inline int f3542_28(int x) { return x * 28; }
+inline int f3542_29(int x) { return x * 29; }
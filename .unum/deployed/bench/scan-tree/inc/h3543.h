@@ -0,0 +1,42 @@
+#pragma once
+/* header 3543 */
+#include <vector>
+#include "h8134.h"
+#include "h6993.h"
+#include "h288.h"
+#include "h7701.h"
+#include "h6930.h"
+#ifdef X
+#include "h2381.h"
+#endif
+struct S3543 { int a; const char *s = "x//y"; };
+inline int f3543_0(int x) { return x * 0; }
+inline int f3543_1(int x) { return x * 1; }
+inline int f3543_2(int x) { return x * 2; }
+inline int f3543_3(int x) { return x * 3; }
+inline int f3543_4(int x) { return x * 4; }
+inline int f3543_5(int x) { return x * 5; }
+inline int f3543_6(int x) { return x * 6; }
+inline int f3543_7(int x) { return x * 7; }
+inline int f3543_8(int x) { return x * 8; }
+inline int f3543_9(int x) { return x * 9; }
+inline int f3543_10(int x) { return x * 10; }
+inline int f3543_11(int x) { return x * 11; }
+inline int f3543_12(int x) { return x * 12; }
+inline int f3543_13(int x) { return x * 13; }
+inline int f3543_14(int x) { return x * 14; }
+inline int f3543_15(int x) { return x * 15; }
+inline int f3543_16(int x) { return x * 16; }
+inline int f3543_17(int x) { return x * 17; }
+inline int f3543_18(int x) { return x * 18; }
+inline int f3543_19(int x) { return x * 19; }
+inline int f3543_20(int x) { return x * 20; }
+inline int f3543_21(int x) { return x * 21; }
+inline int f3543_22(int x) { return x * 22; }
+inline int f3543_23(int x) { return x * 23; }
+inline int f3543_24(int x) { return x * 24; }
+inline int f3543_25(int x) { return x * 25; }
+inline int f3543_26(int x) { return x * 26; }
+inline int f3543_27(int x) { return x * 27; }
+inline int f3543_28(int x) { return x * 28; }
+inline int f3543_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3545 */
+#include <vector>
+#include "h3143.h"
+#include "h5604.h"
+#include "h5432.h"
+#include "h2400.h"
+#include "h9747.h"
+#ifdef X
+#include "h5938.h"
+#endif
+struct S3545 { int a; const char *s = "x//y"; };
+inline int f3545_0(int x) { return x * 0; }
+inline int f3545_1(int x) { return x * 1; }
+inline int f3545_2(int x) { return x * 2; }
+inline int f3545_3(int x) { return x * 3; }
+inline int f3545_4(int x) { return x * 4; }
+inline int f3545_5(int x) { return x * 5; }
+inline int f3545_6(int x) { return x * 6; }
+inline int f3545_7(int x) { return x * 7; }
+inline int f3545_8(int x) { return x * 8; }
+inline int f3545_9(int x) { return x * 9; }
+inline int f3545_10(int x) { return x * 10; }
+inline int f3545_11(int x) { return x * 11; }
+inline int f3545_12(int x) { return x * 12; }
+inline int f3545_13(int x) { return x * 13; }
+inline int f3545_14(int x) { return x * 14; }
+inline int f3545_15(int x) { return x * 15; }
+inline int f3545_16(int x) { return x * 16; }
+inline int f3545_17(int x) { return x * 17; }
+inline int f3545_18(int x) { return x * 18; }
+inline int f3545_19(int x) { return x * 19; }
+inline int f3545_20(int x) { return x * 20; }
+inline int f3545_21(int x) { return x * 21; }
+inline int f3545_22(int x) { return x * 22; }
+inline int f3545_23(int x) { return x * 23; }
+inline int f3545_24(int x) { return x * 24; }
+inline int f3545_25(int x) { return x * 25; }
+inline int f3545_26(int x) { return x * 26; }
+inline int f3545_27(int x) { return x * 27; }
+inline int f3545_28(int x) { return x * 28; }
+inline int f3545_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3548 */
+#include <vector>
+#include "h777.h"
+#include "h2779.h"
+#include "h6303.h"
+#include "h2616.h"
+#include "h1377.h"
+#ifdef X
+#include "h4244.h"
+#endif
+struct S3548 { int a; const char *s = "x//y"; };
+inline int f3548_0(int x) { return x * 0; }
+inline int f3548_1(int x) { return x * 1; }
+inline int f3548_2(int x) { return x * 2; }
+inline int f3548_3(int x) { return x * 3; }
+inline int f3548_4(int x) { return x * 4; }
+inline int f3548_5(int x) { return x * 5; }
+inline int f3548_6(int x) { return x * 6; }
+inline int f3548_7(int x) { return x * 7; }
+inline int f3548_8(int x) { return x * 8; }
+inline int f3548_9(int x) { return x * 9; }
+inline int f3548_10(int x) { return x * 10; }
+inline int f3548_11(int x) { return x * 11; }
+inline int f3548_12(int x) { return x * 12; }
+inline int f3548_13(int x) { return x * 13; }
+inline int f3548_14(int x) { return x * 14; }
+inline int f3548_15(int x) { return x * 15; }
+inline int f3548_16(int x) { return x * 16; }
+inline int f3548_17(int x) { return x * 17; }
+inline int f3548_18(int x) { return x * 18; }
+inline int f3548_19(int x) { return x * 19; }
+inline int f3548_20(int x) { return x * 20; }
+inline int f3548_21(int x) { return x * 21; }
+inline int f3548_22(int x) { return x * 22; }
+inline int f3548_23(int x) { return x * 23; }
+inline int f3548_24(int x) { return x * 24; }
+inline int f3548_25(int x) { return x * 25; }
+inline int f3548_26(int x) { return x * 26; }
+inline int f3548_27(int x) { return x * 27; }
+inline int f3548_28(int x) { return x * 28; }
+inline int f3548_29(int x) { return x * 29; }
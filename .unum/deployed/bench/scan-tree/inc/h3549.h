@@ -0,0 +1,42 @@
+#pragma once
+/* header 3549 */
+#include <vector>
+#include "h9109.h"
+#include "h5868.h"
+#include "h3211.h"
+#include "h8631.h"
+#include "h6982.h"
+#ifdef X
+#include "h7166.h"
+#endif
+struct S3549 { int a; const char *s = "x//y"; };
+inline int f3549_0(int x) { return x * 0; }
+inline int f3549_1(int x) { return x * 1; }
+inline int f3549_2(int x) { return x * 2; }
+inline int f3549_3(int x) { return x * 3; }
+inline int f3549_4(int x) { return x * 4; }
+inline int f3549_5(int x) { return x * 5; }
+inline int f3549_6(int x) { return x * 6; }
+inline int f3549_7(int x) { return x * 7; }
+inline int f3549_8(int x) { return x * 8; }
+inline int f3549_9(int x) { return x * 9; }
+inline int f3549_10(int x) { return x * 10; }
+inline int f3549_11(int x) { return x * 11; }
+inline int f3549_12(int x) { return x * 12; }
+inline int f3549_13(int x) { return x * 13; }
+inline int f3549_14(int x) { return x * 14; }
+inline int f3549_15(int x) { return x * 15; }
+inline int f3549_16(int x) { return x * 16; }
+inline int f3549_17(int x) { return x * 17; }
+inline int f3549_18(int x) { return x * 18; }
+inline int f3549_19(int x) { return x * 19; }
+inline int f3549_20(int x) { return x * 20; }
+inline int f3549_21(int x) { return x * 21; }
+inline int f3549_22(int x) { return x * 22; }
+inline int f3549_23(int x) { return x * 23; }
+inline int f3549_24(int x) { return x * 24; }
+inline int f3549_25(int x) { return x * 25; }
+inline int f3549_26(int x) { return x * 26; }
+inline int f3549_27(int x) { return x * 27; }
+inline int f3549_28(int x) { return x * 28; }
+inline int f3549_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 355 */
+#include <vector>
+#include "h4940.h"
+#include "h8428.h"
+#include "h3398.h"
+#include "h697.h"
+#include "h7429.h"
+#ifdef X
+#include "h5923.h"
+#endif
+struct S355 { int a; const char *s = "x//y"; };
+inline int f355_0(int x) { return x * 0; }
+inline int f355_1(int x) { return x * 1; }
+inline int f355_2(int x) { return x * 2; }
+inline int f355_3(int x) { return x * 3; }
+inline int f355_4(int x) { return x * 4; }
+inline int f355_5(int x) { return x * 5; }
+inline int f355_6(int x) { return x * 6; }
+inline int f355_7(int x) { return x * 7; }
+inline int f355_8(int x) { return x * 8; }
+inline int f355_9(int x) { return x * 9; }
+inline int f355_10(int x) { return x * 10; }
+inline int f355_11(int x) { return x * 11; }
+inline int f355_12(int x) { return x * 12; }
+inline int f355_13(int x) { return x * 13; }
+inline int f355_14(int x) { return x * 14; }
+inline int f355_15(int x) { return x * 15; }
+inline int f355_16(int x) { return x * 16; }
+inline int f355_17(int x) { return x * 17; }
+inline int f355_18(int x) { return x * 18; }
+inline int f355_19(int x) { return x * 19; }
+inline int f355_20(int x) { return x * 20; }
+inline int f355_21(int x) { return x * 21; }
+inline int f355_22(int x) { return x * 22; }
+inline int f355_23(int x) { return x * 23; }
+inline int f355_24(int x) { return x * 24; }
+inline int f355_25(int x) { return x * 25; }
+inline int f355_26(int x) { return x * 26; }
+inline int f355_27(int x) { return x * 27; }
+inline int f355_28(int x) { return x * 28; }
+inline int f355_29(int x) { return x * 29; }
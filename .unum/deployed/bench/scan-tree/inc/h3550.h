@@ -0,0 +1,42 @@
+#pragma once
+/* header 3550 */
+#include <vector>
+#include "h8655.h"
+#include "h1253.h"
+#include "h8226.h"
+#include "h861.h"
+#include "h970.h"
+#ifdef X
+#include "h3279.h"
+#endif
+struct S3550 { int a; const char *s = "x//y"; };
+inline int f3550_0(int x) { return x * 0; }
+inline int f3550_1(int x) { return x * 1; }
+inline int f3550_2(int x) { return x * 2; }
+inline int f3550_3(int x) { return x * 3; }
+inline int f3550_4(int x) { return x * 4; }
+inline int f3550_5(int x) { return x * 5; }
+inline int f3550_6(int x) { return x * 6; }
+inline int f3550_7(int x) { return x * 7; }
+inline int f3550_8(int x) { return x * 8; }
+inline int f3550_9(int x) { return x * 9; }
+inline int f3550_10(int x) { return x * 10; }
+inline int f3550_11(int x) { return x * 11; }
+inline int f3550_12(int x) { return x * 12; }
+inline int f3550_13(int x) { return x * 13; }
+inline int f3550_14(int x) { return x * 14; }
+inline int f3550_15(int x) { return x * 15; }
+inline int f3550_16(int x) { return x * 16; }
+inline int f3550_17(int x) { return x * 17; }
+inline int f3550_18(int x) { return x * 18; }
+inline int f3550_19(int x) { return x * 19; }
+inline int f3550_20(int x) { return x * 20; }
+inline int f3550_21(int x) { return x * 21; }
+inline int f3550_22(int x) { return x * 22; }
+inline int f3550_23(int x) { return x * 23; }
+inline int f3550_24(int x) { return x * 24; }
+inline int f3550_25(int x) { return x * 25; }
+inline int f3550_26(int x) { return x * 26; }
+inline int f3550_27(int x) { return x * 27; }
+inline int f3550_28(int x) { return x * 28; }
+inline int f3550_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3554 */
+#include <vector>
+#include "h6014.h"
+#include "h6916.h"
+#include "h958.h"
+#include "h4457.h"
+#include "h2082.h"
+#ifdef X
+#include "h5413.h"
+#endif
+struct S3554 { int a; const char *s = "x//y"; };
+inline int f3554_0(int x) { return x * 0; }
+inline int f3554_1(int x) { return x * 1; }
+inline int f3554_2(int x) { return x * 2; }
+inline int f3554_3(int x) { return x * 3; }
+inline int f3554_4(int x) { return x * 4; }
+inline int f3554_5(int x) { return x * 5; }
+inline int f3554_6(int x) { return x * 6; }
+inline int f3554_7(int x) { return x * 7; }
+inline int f3554_8(int x) { return x * 8; }
+inline int f3554_9(int x) { return x * 9; }
+inline int f3554_10(int x) { return x * 10; }
+inline int f3554_11(int x) { return x * 11; }
+inline int f3554_12(int x) { return x * 12; }
+inline int f3554_13(int x) { return x * 13; }
+inline int f3554_14(int x) { return x * 14; }
+inline int f3554_15(int x) { return x * 15; }
+inline int f3554_16(int x) { return x * 16; }
+inline int f3554_17(int x) { return x * 17; }
+inline int f3554_18(int x) { return x * 18; }
+inline int f3554_19(int x) { return x * 19; }
+inline int f3554_20(int x) { return x * 20; }
+inline int f3554_21(int x) { return x * 21; }
+inline int f3554_22(int x) { return x * 22; }
+inline int f3554_23(int x) { return x * 23; }
+inline int f3554_24(int x) { return x * 24; }
+inline int f3554_25(int x) { return x * 25; }
+inline int f3554_26(int x) { return x * 26; }
+inline int f3554_27(int x) { return x * 27; }
+inline int f3554_28(int x) { return x * 28; }
+inline int f3554_29(int x) { return x * 29; }
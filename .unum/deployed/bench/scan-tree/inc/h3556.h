@@ -0,0 +1,42 @@
+#pragma once
+/* header 3556 */
+#include <vector>
+#include "h8729.h"
+#include "h9937.h"
+#include "h23.h"
+#include "h7856.h"
+#include "h6582.h"
+#ifdef X
+#include "h9427.h"
+#endif
+struct S3556 { int a; const char *s = "x//y"; };
+inline int f3556_0(int x) { return x * 0; }
+inline int f3556_1(int x) { return x * 1; }
+inline int f3556_2(int x) { return x * 2; }
+inline int f3556_3(int x) { return x * 3; }
+inline int f3556_4(int x) { return x * 4; }
+inline int f3556_5(int x) { return x * 5; }
+inline int f3556_6(int x) { return x * 6; }
+inline int f3556_7(int x) { return x * 7; }
+inline int f3556_8(int x) { return x * 8; }
+inline int f3556_9(int x) { return x * 9; }
+inline int f3556_10(int x) { return x * 10; }
+inline int f3556_11(int x) { return x * 11; }
+inline int f3556_12(int x) { return x * 12; }
+inline int f3556_13(int x) { return x * 13; }
+inline int f3556_14(int x) { return x * 14; }
+inline int f3556_15(int x) { return x * 15; }
+inline int f3556_16(int x) { return x * 16; }
+inline int f3556_17(int x) { return x * 17; }
+inline int f3556_18(int x) { return x * 18; }
+inline int f3556_19(int x) { return x * 19; }
+inline int f3556_20(int x) { return x * 20; }
+inline int f3556_21(int x) { return x * 21; }
+inline int f3556_22(int x) { return x * 22; }
+inline int f3556_23(int x) { return x * 23; }
+inline int f3556_24(int x) { return x * 24; }
+inline int f3556_25(int x) { return x * 25; }
+inline int f3556_26(int x) { return x * 26; }
+inline int f3556_27(int x) { return x * 27; }
+inline int f3556_28(int x) { return x * 28; }
+inline int f3556_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3558 */
+#include <vector>
+#include "h8126.h"
+#include "h5983.h"
+#include "h1099.h"
+#include "h6247.h"
+#include "h4368.h"
+#ifdef X
+#include "h1680.h"
+#endif
+struct S3558 { int a; const char *s = "x//y"; };
+inline int f3558_0(int x) { return x * 0; }
+inline int f3558_1(int x) { return x * 1; }
+inline int f3558_2(int x) { return x * 2; }
+inline int f3558_3(int x) { return x * 3; }
+inline int f3558_4(int x) { return x * 4; }
+inline int f3558_5(int x) { return x * 5; }
+inline int f3558_6(int x) { return x * 6; }
+inline int f3558_7(int x) { return x * 7; }
+inline int f3558_8(int x) { return x * 8; }
+inline int f3558_9(int x) { return x * 9; }
+inline int f3558_10(int x) { return x * 10; }
+inline int f3558_11(int x) { return x * 11; }
+inline int f3558_12(int x) { return x * 12; }
+inline int f3558_13(int x) { return x * 13; }
+inline int f3558_14(int x) { return x * 14; }
+inline int f3558_15(int x) { return x * 15; }
+inline int f3558_16(int x) { return x * 16; }
+inline int f3558_17(int x) { return x * 17; }
+inline int f3558_18(int x) { return x * 18; }
+inline int f3558_19(int x) { return x * 19; }
+inline int f3558_20(int x) { return x * 20; }
+inline int f3558_21(int x) { return x * 21; }
+inline int f3558_22(int x) { return x * 22; }
+inline int f3558_23(int x) { return x * 23; }
+inline int f3558_24(int x) { return x * 24; }
+inline int f3558_25(int x) { return x * 25; }
+inline int f3558_26(int x) { return x * 26; }
+inline int f3558_27(int x) { return x * 27; }
+inline int f3558_28(int x) { return x * 28; }
+inline int f3558_29(int x) { return x * 29; }
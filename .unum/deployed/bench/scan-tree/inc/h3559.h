@@ -0,0 +1,42 @@
+#pragma once
+/* header 3559 */
+#include <vector>
+#include "h9398.h"
+#include "h7230.h"
+#include "h5993.h"
+#include "h2887.h"
+#include "h9539.h"
+#ifdef X
+#include "h9977.h"
+#endif
+struct S3559 { int a; const char *s = "x//y"; };
+inline int f3559_0(int x) { return x * 0; }
+inline int f3559_1(int x) { return x * 1; }
+inline int f3559_2(int x) { return x * 2; }
+inline int f3559_3(int x) { return x * 3; }
+inline int f3559_4(int x) { return x * 4; }
+inline int f3559_5(int x) { return x * 5; }
+inline int f3559_6(int x) { return x * 6; }
+inline int f3559_7(int x) { return x * 7; }
+inline int f3559_8(int x) { return x * 8; }
+inline int f3559_9(int x) { return x * 9; }
+inline int f3559_10(int x) { return x * 10; }
+inline int f3559_11(int x) { return x * 11; }
+inline int f3559_12(int x) { return x * 12; }
+inline int f3559_13(int x) { return x * 13; }
+inline int f3559_14(int x) { return x * 14; }
+inline int f3559_15(int x) { return x * 15; }
+inline int f3559_16(int x) { return x * 16; }
+inline int f3559_17(int x) { return x * 17; }
+inline int f3559_18(int x) { return x * 18; }
+inline int f3559_19(int x) { return x * 19; }
+inline int f3559_20(int x) { return x * 20; }
+inline int f3559_21(int x) { return x * 21; }
+inline int f3559_22(int x) { return x * 22; }
+inline int f3559_23(int x) { return x * 23; }
+inline int f3559_24(int x) { return x * 24; }
+inline int f3559_25(int x) { return x * 25; }
+inline int f3559_26(int x) { return x * 26; }
+inline int f3559_27(int x) { return x * 27; }
+inline int f3559_28(int x) { return x * 28; }
+inline int f3559_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 356 */
+#include <vector>
+#include "h6543.h"
+#include "h6019.h"
+#include "h859.h"
+#include "h7129.h"
+#include "h9816.h"
+#ifdef X
+#include "h4651.h"
+#endif
+struct S356 { int a; const char *s = "x//y"; };
+inline int f356_0(int x) { return x * 0; }
+inline int f356_1(int x) { return x * 1; }
+inline int f356_2(int x) { return x * 2; }
+inline int f356_3(int x) { return x * 3; }
+inline int f356_4(int x) { return x * 4; }
+inline int f356_5(int x) { return x * 5; }
+inline int f356_6(int x) { return x * 6; }
+inline int f356_7(int x) { return x * 7; }
+inline int f356_8(int x) { return x * 8; }
+inline int f356_9(int x) { return x * 9; }
+inline int f356_10(int x) { return x * 10; }
+inline int f356_11(int x) { return x * 11; }
+inline int f356_12(int x) { return x * 12; }
+inline int f356_13(int x) { return x * 13; }
+inline int f356_14(int x) { return x * 14; }
+inline int f356_15(int x) { return x * 15; }
+inline int f356_16(int x) { return x * 16; }
+inline int f356_17(int x) { return x * 17; }
+inline int f356_18(int x) { return x * 18; }
+inline int f356_19(int x) { return x * 19; }
+inline int f356_20(int x) { return x * 20; }
+inline int f356_21(int x) { return x * 21; }
+inline int f356_22(int x) { return x * 22; }
+inline int f356_23(int x) { return x * 23; }
+inline int f356_24(int x) { return x * 24; }
+inline int f356_25(int x) { return x * 25; }
+inline int f356_26(int x) { return x * 26; }
+inline int f356_27(int x) { return x * 27; }
+inline int f356_28(int x) { return x * 28; }
+inline int f356_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3560 */
+#include <vector>
+#include "h9519.h"
+#include "h6573.h"
+#include "h65.h"
+#include "h5814.h"
+#include "h7434.h"
+#ifdef X
+#include "h6770.h"
+#endif
+struct S3560 { int a; const char *s = "x//y"; };
+inline int f3560_0(int x) { return x * 0; }
+inline int f3560_1(int x) { return x * 1; }
+inline int f3560_2(int x) { return x * 2; }
+inline int f3560_3(int x) { return x * 3; }
+inline int f3560_4(int x) { return x * 4; }
+inline int f3560_5(int x) { return x * 5; }
+inline int f3560_6(int x) { return x * 6; }
+inline int f3560_7(int x) { return x * 7; }
+inline int f3560_8(int x) { return x * 8; }
+inline int f3560_9(int x) { return x * 9; }
+inline int f3560_10(int x) { return x * 10; }
+inline int f3560_11(int x) { return x * 11; }
+inline int f3560_12(int x) { return x * 12; }
+inline int f3560_13(int x) { return x * 13; }
+inline int f3560_14(int x) { return x * 14; }
+inline int f3560_15(int x) { return x * 15; }
+inline int f3560_16(int x) { return x * 16; }
+inline int f3560_17(int x) { return x * 17; }
+inline int f3560_18(int x) { return x * 18; }
+inline int f3560_19(int x) { return x * 19; }
+inline int f3560_20(int x) { return x * 20; }
+inline int f3560_21(int x) { return x * 21; }
+inline int f3560_22(int x) { return x * 22; }
+inline int f3560_23(int x) { return x * 23; }
+inline int f3560_24(int x) { return x * 24; }
+inline int f3560_25(int x) { return x * 25; }
+inline int f3560_26(int x) { return x * 26; }
+inline int f3560_27(int x) { return x * 27; }
+inline int f3560_28(int x) { return x * 28; }
+inline int f3560_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3561 */
+#include <vector>
+#include "h1127.h"
+#include "h858.h"
+#include "h9398.h"
+#include "h5498.h"
+#include "h643.h"
+#ifdef X
+#include "h4095.h"
+#endif
+struct S3561 { int a; const char *s = "x//y"; };
+inline int f3561_0(int x) { return x * 0; }
+inline int f3561_1(int x) { return x * 1; }
+inline int f3561_2(int x) { return x * 2; }
+inline int f3561_3(int x) { return x * 3; }
+inline int f3561_4(int x) { return x * 4; }
+inline int f3561_5(int x) { return x * 5; }
+inline int f3561_6(int x) { return x * 6; }
+inline int f3561_7(int x) { return x * 7; }
+inline int f3561_8(int x) { return x * 8; }
+inline int f3561_9(int x) { return x * 9; }
+inline int f3561_10(int x) { return x * 10; }
+inline int f3561_11(int x) { return x * 11; }
+inline int f3561_12(int x) { return x * 12; }
+inline int f3561_13(int x) { return x * 13; }
+inline int f3561_14(int x) { return x * 14; }
+inline int f3561_15(int x) { return x * 15; }
+inline int f3561_16(int x) { return x * 16; }
+inline int f3561_17(int x) { return x * 17; }
+inline int f3561_18(int x) { return x * 18; }
+inline int f3561_19(int x) { return x * 19; }
+inline int f3561_20(int x) { return x * 20; }
+inline int f3561_21(int x) { return x * 21; }
+inline int f3561_22(int x) { return x * 22; }
+inline int f3561_23(int x) { return x * 23; }
+inline int f3561_24(int x) { return x * 24; }
+inline int f3561_25(int x) { return x * 25; }
+inline int f3561_26(int x) { return x * 26; }
+inline int f3561_27(int x) { return x * 27; }
+inline int f3561_28(int x) { return x * 28; }
+inline int f3561_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3562 */
+#include <vector>
+#include "h2851.h"
+#include "h4550.h"
+#include "h2942.h"
+#include "h1618.h"
+#include "h4146.h"
+#ifdef X
+#include "h785.h"
+#endif
+struct S3562 { int a; const char *s = "x//y"; };
+inline int f3562_0(int x) { return x * 0; }
+inline int f3562_1(int x) { return x * 1; }
+inline int f3562_2(int x) { return x * 2; }
+inline int f3562_3(int x) { return x * 3; }
+inline int f3562_4(int x) { return x * 4; }
+inline int f3562_5(int x) { return x * 5; }
+inline int f3562_6(int x) { return x * 6; }
+inline int f3562_7(int x) { return x * 7; }
+inline int f3562_8(int x) { return x * 8; }
+inline int f3562_9(int x) { return x * 9; }
+inline int f3562_10(int x) { return x * 10; }
+inline int f3562_11(int x) { return x * 11; }
+inline int f3562_12(int x) { return x * 12; }
+inline int f3562_13(int x) { return x * 13; }
+inline int f3562_14(int x) { return x * 14; }
+inline int f3562_15(int x) { return x * 15; }
+inline int f3562_16(int x) { return x * 16; }
+inline int f3562_17(int x) { return x * 17; }
+inline int f3562_18(int x) { return x * 18; }
+inline int f3562_19(int x) { return x * 19; }
+inline int f3562_20(int x) { return x * 20; }
+inline int f3562_21(int x) { return x * 21; }
+inline int f3562_22(int x) { return x * 22; }
+inline int f3562_23(int x) { return x * 23; }
+inline int f3562_24(int x) { return x * 24; }
+inline int f3562_25(int x) { return x * 25; }
+inline int f3562_26(int x) { return x * 26; }
+inline int f3562_27(int x) { return x * 27; }
+inline int f3562_28(int x) { return x * 28; }
+inline int f3562_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3563 */
+#include <vector>
+#include "h974.h"
+#include "h3772.h"
+#include "h6381.h"
+#include "h4800.h"
+#include "h9105.h"
+#ifdef X
+#include "h2309.h"
+#endif
+struct S3563 { int a; const char *s = "x//y"; };
+inline int f3563_0(int x) { return x * 0; }
+inline int f3563_1(int x) { return x * 1; }
+inline int f3563_2(int x) { return x * 2; }
+inline int f3563_3(int x) { return x * 3; }
+inline int f3563_4(int x) { return x * 4; }
+inline int f3563_5(int x) { return x * 5; }
+inline int f3563_6(int x) { return x * 6; }
+inline int f3563_7(int x) { return x * 7; }
+inline int f3563_8(int x) { return x * 8; }
+inline int f3563_9(int x) { return x * 9; }
+inline int f3563_10(int x) { return x * 10; }
+inline int f3563_11(int x) { return x * 11; }
+inline int f3563_12(int x) { return x * 12; }
+inline int f3563_13(int x) { return x * 13; }
+inline int f3563_14(int x) { return x * 14; }
+inline int f3563_15(int x) { return x * 15; }
+inline int f3563_16(int x) { return x * 16; }
+inline int f3563_17(int x) { return x * 17; }
+inline int f3563_18(int x) { return x * 18; }
+inline int f3563_19(int x) { return x * 19; }
+inline int f3563_20(int x) { return x * 20; }
+inline int f3563_21(int x) { return x * 21; }
+inline int f3563_22(int x) { return x * 22; }
+inline int f3563_23(int x) { return x * 23; }
+inline int f3563_24(int x) { return x * 24; }
+inline int f3563_25(int x) { return x * 25; }
+inline int f3563_26(int x) { return x * 26; }
+inline int f3563_27(int x) { return x * 27; }
+inline int f3563_28(int x) { return x * 28; }
+inline int f3563_29(int x) { return x * 29; }
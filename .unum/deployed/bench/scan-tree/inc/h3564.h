@@ -0,0 +1,42 @@
+#pragma once
+/* header 3564 */
+#include <vector>
+#include "h7847.h"
+#include "h8784.h"
+#include "h2235.h"
+#include "h499.h"
+#include "h5139.h"
+#ifdef X
+#include "h505.h"
+#endif
+struct S3564 { int a; const char *s = "x//y"; };
+inline int f3564_0(int x) { return x * 0; }
+inline int f3564_1(int x) { return x * 1; }
+inline int f3564_2(int x) { return x * 2; }
+inline int f3564_3(int x) { return x * 3; }
+inline int f3564_4(int x) { return x * 4; }
+inline int f3564_5(int x) { return x * 5; }
+inline int f3564_6(int x) { return x * 6; }
+inline int f3564_7(int x) { return x * 7; }
+inline int f3564_8(int x) { return x * 8; }
+inline int f3564_9(int x) { return x * 9; }
+inline int f3564_10(int x) { return x * 10; }
+inline int f3564_11(int x) { return x * 11; }
+inline int f3564_12(int x) { return x * 12; }
+inline int f3564_13(int x) { return x * 13; }
+inline int f3564_14(int x) { return x * 14; }
+inline int f3564_15(int x) { return x * 15; }
+inline int f3564_16(int x) { return x * 16; }
+inline int f3564_17(int x) { return x * 17; }
+inline int f3564_18(int x) { return x * 18; }
+inline int f3564_19(int x) { return x * 19; }
+inline int f3564_20(int x) { return x * 20; }
+inline int f3564_21(int x) { return x * 21; }
+inline int f3564_22(int x) { return x * 22; }
+inline int f3564_23(int x) { return x * 23; }
+inline int f3564_24(int x) { return x * 24; }
+inline int f3564_25(int x) { return x * 25; }
+inline int f3564_26(int x) { return x * 26; }
+inline int f3564_27(int x) { return x * 27; }
+inline int f3564_28(int x) { return x * 28; }
+inline int f3564_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3566 */
+#include <vector>
+#include "h9641.h"
+#include "h7953.h"
+#include "h9521.h"
+#include "h7996.h"
+#include "h9847.h"
+#ifdef X
+#include "h7922.h"
+#endif
+struct S3566 { int a; const char *s = "x//y"; };
+inline int f3566_0(int x) { return x * 0; }
+inline int f3566_1(int x) { return x * 1; }
+inline int f3566_2(int x) { return x * 2; }
+inline int f3566_3(int x) { return x * 3; }
+inline int f3566_4(int x) { return x * 4; }
+inline int f3566_5(int x) { return x * 5; }
+inline int f3566_6(int x) { return x * 6; }
+inline int f3566_7(int x) { return x * 7; }
+inline int f3566_8(int x) { return x * 8; }
+inline int f3566_9(int x) { return x * 9; }
+inline int f3566_10(int x) { return x * 10; }
+inline int f3566_11(int x) { return x * 11; }
+inline int f3566_12(int x) { return x * 12; }
+inline int f3566_13(int x) { return x * 13; }
+inline int f3566_14(int x) { return x * 14; }
+inline int f3566_15(int x) { return x * 15; }
+inline int f3566_16(int x) { return x * 16; }
+inline int f3566_17(int x) { return x * 17; }
+inline int f3566_18(int x) { return x * 18; }
+inline int f3566_19(int x) { return x * 19; }
+inline int f3566_20(int x) { return x * 20; }
+inline int f3566_21(int x) { return x * 21; }
+inline int f3566_22(int x) { return x * 22; }
+inline int f3566_23(int x) { return x * 23; }
+inline int f3566_24(int x) { return x * 24; }
+inline int f3566_25(int x) { return x * 25; }
+inline int f3566_26(int x) { return x * 26; }
+inline int f3566_27(int x) { return x * 27; }
+inline int f3566_28(int x) { return x * 28; }
+inline int f3566_29(int x) { return x * 29; }
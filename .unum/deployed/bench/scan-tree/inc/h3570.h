@@ -0,0 +1,42 @@
+#pragma once
+/* header 3570 */
+#include <vector>
+#include "h1752.h"
+#include "h7204.h"
+#include "h2426.h"
+#include "h1268.h"
+#include "h1660.h"
+#ifdef X
+#include "h6693.h"
+#endif
+struct S3570 { int a; const char *s = "x//y"; };
+inline int f3570_0(int x) { return x * 0; }
+inline int f3570_1(int x) { return x * 1; }
+inline int f3570_2(int x) { return x * 2; }
+inline int f3570_3(int x) { return x * 3; }
+inline int f3570_4(int x) { return x * 4; }
+inline int f3570_5(int x) { return x * 5; }
+inline int f3570_6(int x) { return x * 6; }
+inline int f3570_7(int x) { return x * 7; }
+inline int f3570_8(int x) { return x * 8; }
+inline int f3570_9(int x) { return x * 9; }
+inline int f3570_10(int x) { return x * 10; }
+inline int f3570_11(int x) { return x * 11; }
+inline int f3570_12(int x) { return x * 12; }
+inline int f3570_13(int x) { return x * 13; }
+inline int f3570_14(int x) { return x * 14; }
+inline int f3570_15(int x) { return x * 15; }
+inline int f3570_16(int x) { return x * 16; }
+inline int f3570_17(int x) { return x * 17; }
+inline int f3570_18(int x) { return x * 18; }
+inline int f3570_19(int x) { return x * 19; }
+inline int f3570_20(int x) { return x * 20; }
+inline int f3570_21(int x) { return x * 21; }
+inline int f3570_22(int x) { return x * 22; }
+inline int f3570_23(int x) { return x * 23; }
+inline int f3570_24(int x) { return x * 24; }
+inline int f3570_25(int x) { return x * 25; }
+inline int f3570_26(int x) { return x * 26; }
+inline int f3570_27(int x) { return x * 27; }
+inline int f3570_28(int x) { return x * 28; }
+inline int f3570_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3574 */
+#include <vector>
+#include "h4903.h"
+#include "h9541.h"
+#include "h5676.h"
+#include "h8544.h"
+#include "h8287.h"
+#ifdef X
+#include "h8885.h"
+#endif
+struct S3574 { int a; const char *s = "x//y"; };
+inline int f3574_0(int x) { return x * 0; }
+inline int f3574_1(int x) { return x * 1; }
+inline int f3574_2(int x) { return x * 2; }
+inline int f3574_3(int x) { return x * 3; }
+inline int f3574_4(int x) { return x * 4; }
+inline int f3574_5(int x) { return x * 5; }
+inline int f3574_6(int x) { return x * 6; }
+inline int f3574_7(int x) { return x * 7; }
+inline int f3574_8(int x) { return x * 8; }
+inline int f3574_9(int x) { return x * 9; }
+inline int f3574_10(int x) { return x * 10; }
+inline int f3574_11(int x) { return x * 11; }
+inline int f3574_12(int x) { return x * 12; }
+inline int f3574_13(int x) { return x * 13; }
+inline int f3574_14(int x) { return x * 14; }
+inline int f3574_15(int x) { return x * 15; }
+inline int f3574_16(int x) { return x * 16; }
+inline int f3574_17(int x) { return x * 17; }
+inline int f3574_18(int x) { return x * 18; }
+inline int f3574_19(int x) { return x * 19; }
+inline int f3574_20(int x) { return x * 20; }
+inline int f3574_21(int x) { return x * 21; }
+inline int f3574_22(int x) { return x * 22; }
+inline int f3574_23(int x) { return x * 23; }
+inline int f3574_24(int x) { return x * 24; }
+inline int f3574_25(int x) { return x * 25; }
+inline int f3574_26(int x) { return x * 26; }
+inline int f3574_27(int x) { return x * 27; }
+inline int f3574_28(int x) { return x * 28; }
+inline int f3574_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3575 */
+#include <vector>
+#include "h5121.h"
+#include "h9235.h"
+#include "h2992.h"
+#include "h4351.h"
+#include "h8533.h"
+#ifdef X
+#include "h5215.h"
+#endif
+struct S3575 { int a; const char *s = "x//y"; };
+inline int f3575_0(int x) { return x * 0; }
+inline int f3575_1(int x) { return x * 1; }
+inline int f3575_2(int x) { return x * 2; }
+inline int f3575_3(int x) { return x * 3; }
+inline int f3575_4(int x) { return x * 4; }
+inline int f3575_5(int x) { return x * 5; }
+inline int f3575_6(int x) { return x * 6; }
+inline int f3575_7(int x) { return x * 7; }
+inline int f3575_8(int x) { return x * 8; }
+inline int f3575_9(int x) { return x * 9; }
+inline int f3575_10(int x) { return x * 10; }
+inline int f3575_11(int x) { return x * 11; }
+inline int f3575_12(int x) { return x * 12; }
+inline int f3575_13(int x) { return x * 13; }
+inline int f3575_14(int x) { return x * 14; }
+inline int f3575_15(int x) { return x * 15; }
+inline int f3575_16(int x) { return x * 16; }
+inline int f3575_17(int x) { return x * 17; }
+inline int f3575_18(int x) { return x * 18; }
+inline int f3575_19(int x) { return x * 19; }
+inline int f3575_20(int x) { return x * 20; }
+inline int f3575_21(int x) { return x * 21; }
+inline int f3575_22(int x) { return x * 22; }
+inline int f3575_23(int x) { return x * 23; }
+inline int f3575_24(int x) { return x * 24; }
+inline int f3575_25(int x) { return x * 25; }
+inline int f3575_26(int x) { return x * 26; }
+inline int f3575_27(int x) { return x * 27; }
+inline int f3575_28(int x) { return x * 28; }
+inline int f3575_29(int x) { return x * 29; }
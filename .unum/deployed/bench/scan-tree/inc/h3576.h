@@ -0,0 +1,42 @@
+#pragma once
+/* header 3576 */
+#include <vector>
+#include "h1929.h"
+#include "h5533.h"
+#include "h412.h"
+#include "h6206.h"
+#include "h794.h"
+#ifdef X
+#include "h9918.h"
+#endif
+struct S3576 { int a; const char *s = "x//y"; };
+inline int f3576_0(int x) { return x * 0; }
+inline int f3576_1(int x) { return x * 1; }
+inline int f3576_2(int x) { return x * 2; }
+inline int f3576_3(int x) { return x * 3; }
+inline int f3576_4(int x) { return x * 4; }
+inline int f3576_5(int x) { return x * 5; }
+inline int f3576_6(int x) { return x * 6; }
+inline int f3576_7(int x) { return x * 7; }
+inline int f3576_8(int x) { return x * 8; }
+inline int f3576_9(int x) { return x * 9; }
+inline int f3576_10(int x) { return x * 10; }
+inline int f3576_11(int x) { return x * 11; }
+inline int f3576_12(int x) { return x * 12; }
+inline int f3576_13(int x) { return x * 13; }
+inline int f3576_14(int x) { return x * 14; }
+inline int f3576_15(int x) { return x * 15; }
+inline int f3576_16(int x) { return x * 16; }
+inline int f3576_17(int x) { return x * 17; }
+inline int f3576_18(int x) { return x * 18; }
+inline int f3576_19(int x) { return x * 19; }
+inline int f3576_20(int x) { return x * 20; }
+inline int f3576_21(int x) { return x * 21; }
+inline int f3576_22(int x) { return x * 22; }
+inline int f3576_23(int x) { return x * 23; }
+inline int f3576_24(int x) { return x * 24; }
+inline int f3576_25(int x) { return x * 25; }
+inline int f3576_26(int x) { return x * 26; }
+inline int f3576_27(int x) { return x * 27; }
+inline int f3576_28(int x) { return x * 28; }
+inline int f3576_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3577 */
+#include <vector>
+#include "h3337.h"
+#include "h5528.h"
+#include "h9759.h"
+#include "h9221.h"
+#include "h5874.h"
+#ifdef X
+#include "h7618.h"
+#endif
+struct S3577 { int a; const char *s = "x//y"; };
+inline int f3577_0(int x) { return x * 0; }
+inline int f3577_1(int x) { return x * 1; }
+inline int f3577_2(int x) { return x * 2; }
+inline int f3577_3(int x) { return x * 3; }
+inline int f3577_4(int x) { return x * 4; }
+inline int f3577_5(int x) { return x * 5; }
+inline int f3577_6(int x) { return x * 6; }
+inline int f3577_7(int x) { return x * 7; }
+inline int f3577_8(int x) { return x * 8; }
+inline int f3577_9(int x) { return x * 9; }
+inline int f3577_10(int x) { return x * 10; }
+inline int f3577_11(int x) { return x * 11; }
+inline int f3577_12(int x) { return x * 12; }
+inline int f3577_13(int x) { return x * 13; }
+inline int f3577_14(int x) { return x * 14; }
+inline int f3577_15(int x) { return x * 15; }
+inline int f3577_16(int x) { return x * 16; }
+inline int f3577_17(int x) { return x * 17; }
+inline int f3577_18(int x) { return x * 18; }
+inline int f3577_19(int x) { return x * 19; }
+inline int f3577_20(int x) { return x * 20; }
+inline int f3577_21(int x) { return x * 21; }
+inline int f3577_22(int x) { return x * 22; }
+inline int f3577_23(int x) { return x * 23; }
+inline int f3577_24(int x) { return x * 24; }
+inline int f3577_25(int x) { return x * 25; }
+inline int f3577_26(int x) { return x * 26; }
+inline int f3577_27(int x) { return x * 27; }
+inline int f3577_28(int x) { return x * 28; }
+inline int f3577_29(int x) { return x * 29; }
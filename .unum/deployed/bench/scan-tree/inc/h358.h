@@ -0,0 +1,42 @@
+#pragma once
+/* header 358 */
+#include <vector>
+#include "h1471.h"
+#include "h4040.h"
+#include "h8734.h"
+#include "h3021.h"
+#include "h9042.h"
+#ifdef X
+#include "h9513.h"
+#endif
+struct S358 { int a; const char *s = "x//y"; };
+inline int f358_0(int x) { return x * 0; }
+inline int f358_1(int x) { return x * 1; }
+inline int f358_2(int x) { return x * 2; }
+inline int f358_3(int x) { return x * 3; }
+inline int f358_4(int x) { return x * 4; }
+inline int f358_5(int x) { return x * 5; }
+inline int f358_6(int x) { return x * 6; }
+inline int f358_7(int x) { return x * 7; }
+inline int f358_8(int x) { return x * 8; }
+inline int f358_9(int x) { return x * 9; }
+inline int f358_10(int x) { return x * 10; }
+inline int f358_11(int x) { return x * 11; }
+inline int f358_12(int x) { return x * 12; }
+inline int f358_13(int x) { return x * 13; }
+inline int f358_14(int x) { return x * 14; }
+inline int f358_15(int x) { return x * 15; }
+inline int f358_16(int x) { return x * 16; }
+inline int f358_17(int x) { return x * 17; }
+inline int f358_18(int x) { return x * 18; }
+inline int f358_19(int x) { return x * 19; }
+inline int f358_20(int x) { return x * 20; }
+inline int f358_21(int x) { return x * 21; }
+inline int f358_22(int x) { return x * 22; }
+inline int f358_23(int x) { return x * 23; }
+inline int f358_24(int x) { return x * 24; }
+inline int f358_25(int x) { return x * 25; }
+inline int f358_26(int x) { return x * 26; }
+inline int f358_27(int x) { return x * 27; }
+inline int f358_28(int x) { return x * 28; }
+inline int f358_29(int x) { return x * 29; }
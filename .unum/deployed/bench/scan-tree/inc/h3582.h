@@ -0,0 +1,42 @@
+#pragma once
+/* header 3582 */
+#include <vector>
+#include "h9739.h"
+#include "h2592.h"
+#include "h3869.h"
+#include "h2280.h"
+#include "h3459.h"
+#ifdef X
+#include "h4393.h"
+#endif
+struct S3582 { int a; const char *s = "x//y"; };
+inline int f3582_0(int x) { return x * 0; }
+inline int f3582_1(int x) { return x * 1; }
+inline int f3582_2(int x) { return x * 2; }
+inline int f3582_3(int x) { return x * 3; }
+inline int f3582_4(int x) { return x * 4; }
+inline int f3582_5(int x) { return x * 5; }
+inline int f3582_6(int x) { return x * 6; }
+inline int f3582_7(int x) { return x * 7; }
+inline int f3582_8(int x) { return x * 8; }
+inline int f3582_9(int x) { return x * 9; }
+inline int f3582_10(int x) { return x * 10; }
+inline int f3582_11(int x) { return x * 11; }
+inline int f3582_12(int x) { return x * 12; }
+inline int f3582_13(int x) { return x * 13; }
+inline int f3582_14(int x) { return x * 14; }
+inline int f3582_15(int x) { return x * 15; }
+inline int f3582_16(int x) { return x * 16; }
+inline int f3582_17(int x) { return x * 17; }
+inline int f3582_18(int x) { return x * 18; }
+inline int f3582_19(int x) { return x * 19; }
+inline int f3582_20(int x) { return x * 20; }
+inline int f3582_21(int x) { return x * 21; }
+inline int f3582_22(int x) { return x * 22; }
+inline int f3582_23(int x) { return x * 23; }
+inline int f3582_24(int x) { return x * 24; }
+inline int f3582_25(int x) { return x * 25; }
+inline int f3582_26(int x) { return x * 26; }
+inline int f3582_27(int x) { return x * 27; }
+inline int f3582_28(int x) { return x * 28; }
+inline int f3582_29(int x) { return x * 29; }
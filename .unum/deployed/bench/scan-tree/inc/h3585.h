@@ -0,0 +1,42 @@
+#pragma once
+/* header 3585 */
+#include <vector>
+#include "h5002.h"
+#include "h4412.h"
+#include "h315.h"
+#include "h3146.h"
+#include "h3894.h"
+#ifdef X
+#include "h9768.h"
+#endif
+struct S3585 { int a; const char *s = "x//y"; };
+inline int f3585_0(int x) { return x * 0; }
+inline int f3585_1(int x) { return x * 1; }
+inline int f3585_2(int x) { return x * 2; }
+inline int f3585_3(int x) { return x * 3; }
+inline int f3585_4(int x) { return x * 4; }
+inline int f3585_5(int x) { return x * 5; }
+inline int f3585_6(int x) { return x * 6; }
+inline int f3585_7(int x) { return x * 7; }
+inline int f3585_8(int x) { return x * 8; }
+inline int f3585_9(int x) { return x * 9; }
+inline int f3585_10(int x) { return x * 10; }
+inline int f3585_11(int x) { return x * 11; }
+inline int f3585_12(int x) { return x * 12; }
+inline int f3585_13(int x) { return x * 13; }
+inline int f3585_14(int x) { return x * 14; }
+inline int f3585_15(int x) { return x * 15; }
+inline int f3585_16(int x) { return x * 16; }
+inline int f3585_17(int x) { return x * 17; }
+inline int f3585_18(int x) { return x * 18; }
+inline int f3585_19(int x) { return x * 19; }
+inline int f3585_20(int x) { return x * 20; }
+inline int f3585_21(int x) { return x * 21; }
+inline int f3585_22(int x) { return x * 22; }
+inline int f3585_23(int x) { return x * 23; }
+inline int f3585_24(int x) { return x * 24; }
+inline int f3585_25(int x) { return x * 25; }
+inline int f3585_26(int x) { return x * 26; }
+inline int f3585_27(int x) { return x * 27; }
+inline int f3585_28(int x) { return x * 28; }
+inline int f3585_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3587 */
+#include <vector>
+#include "h4637.h"
+#include "h6569.h"
+#include "h9374.h"
+#include "h9759.h"
+#include "h1926.h"
+#ifdef X
+#include "h5852.h"
+#endif
+struct S3587 { int a; const char *s = "x//y"; };
+inline int f3587_0(int x) { return x * 0; }
+inline int f3587_1(int x) { return x * 1; }
+inline int f3587_2(int x) { return x * 2; }
+inline int f3587_3(int x) { return x * 3; }
+inline int f3587_4(int x) { return x * 4; }
+inline int f3587_5(int x) { return x * 5; }
+inline int f3587_6(int x) { return x * 6; }
+inline int f3587_7(int x) { return x * 7; }
+inline int f3587_8(int x) { return x * 8; }
+inline int f3587_9(int x) { return x * 9; }
+inline int f3587_10(int x) { return x * 10; }
+inline int f3587_11(int x) { return x * 11; }
+inline int f3587_12(int x) { return x * 12; }
+inline int f3587_13(int x) { return x * 13; }
+inline int f3587_14(int x) { return x * 14; }
+inline int f3587_15(int x) { return x * 15; }
+inline int f3587_16(int x) { return x * 16; }
+inline int f3587_17(int x) { return x * 17; }
+inline int f3587_18(int x) { return x * 18; }
+inline int f3587_19(int x) { return x * 19; }
+inline int f3587_20(int x) { return x * 20; }
+inline int f3587_21(int x) { return x * 21; }
+inline int f3587_22(int x) { return x * 22; }
+inline int f3587_23(int x) { return x * 23; }
+inline int f3587_24(int x) { return x * 24; }
+inline int f3587_25(int x) { return x * 25; }
+inline int f3587_26(int x) { return x * 26; }
+inline int f3587_27(int x) { return x * 27; }
+inline int f3587_28(int x) { return x * 28; }
+inline int f3587_29(int x) { return x * 29; }
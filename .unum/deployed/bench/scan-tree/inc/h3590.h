@@ -0,0 +1,42 @@
+#pragma once
+/* header 3590 */
+#include <vector>
+#include "h4691.h"
+#include "h3660.h"
+#include "h140.h"
+#include "h4915.h"
+#include "h1340.h"
+#ifdef X
+#include "h9128.h"
+#endif
+struct S3590 { int a; const char *s = "x//y"; };
+inline int f3590_0(int x) { return x * 0; }
+inline int f3590_1(int x) { return x * 1; }
+inline int f3590_2(int x) { return x * 2; }
+inline int f3590_3(int x) { return x * 3; }
+inline int f3590_4(int x) { return x * 4; }
+inline int f3590_5(int x) { return x * 5; }
+inline int f3590_6(int x) { return x * 6; }
+inline int f3590_7(int x) { return x * 7; }
+inline int f3590_8(int x) { return x * 8; }
+inline int f3590_9(int x) { return x * 9; }
+inline int f3590_10(int x) { return x * 10; }
+inline int f3590_11(int x) { return x * 11; }
+inline int f3590_12(int x) { return x * 12; }
+inline int f3590_13(int x) { return x * 13; }
+inline int f3590_14(int x) { return x * 14; }
+inline int f3590_15(int x) { return x * 15; }
+inline int f3590_16(int x) { return x * 16; }
+inline int f3590_17(int x) { return x * 17; }
+inline int f3590_18(int x) { return x * 18; }
+inline int f3590_19(int x) { return x * 19; }
+inline int f3590_20(int x) { return x * 20; }
+inline int f3590_21(int x) { return x * 21; }
+inline int f3590_22(int x) { return x * 22; }
+inline int f3590_23(int x) { return x * 23; }
+inline int f3590_24(int x) { return x * 24; }
+inline int f3590_25(int x) { return x * 25; }
+inline int f3590_26(int x) { return x * 26; }
+inline int f3590_27(int x) { return x * 27; }
+inline int f3590_28(int x) { return x * 28; }
+inline int f3590_29(int x) { return x * 29; }
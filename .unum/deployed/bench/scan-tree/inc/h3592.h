@@ -0,0 +1,42 @@
+#pragma once
+/* header 3592 */
+#include <vector>
+#include "h6978.h"
+#include "h511.h"
+#include "h8588.h"
+#include "h4197.h"
+#include "h1680.h"
+#ifdef X
+#include "h4610.h"
+#endif
+struct S3592 { int a; const char *s = "x//y"; };
+inline int f3592_0(int x) { return x * 0; }
+inline int f3592_1(int x) { return x * 1; }
+inline int f3592_2(int x) { return x * 2; }
+inline int f3592_3(int x) { return x * 3; }
+inline int f3592_4(int x) { return x * 4; }
+inline int f3592_5(int x) { return x * 5; }
+inline int f3592_6(int x) { return x * 6; }
+inline int f3592_7(int x) { return x * 7; }
+inline int f3592_8(int x) { return x * 8; }
+inline int f3592_9(int x) { return x * 9; }
+inline int f3592_10(int x) { return x * 10; }
+inline int f3592_11(int x) { return x * 11; }
+inline int f3592_12(int x) { return x * 12; }
+inline int f3592_13(int x) { return x * 13; }
+inline int f3592_14(int x) { return x * 14; }
+inline int f3592_15(int x) { return x * 15; }
+inline int f3592_16(int x) { return x * 16; }
+inline int f3592_17(int x) { return x * 17; }
+inline int f3592_18(int x) { return x * 18; }
+inline int f3592_19(int x) { return x * 19; }
+inline int f3592_20(int x) { return x * 20; }
+inline int f3592_21(int x) { return x * 21; }
+inline int f3592_22(int x) { return x * 22; }
+inline int f3592_23(int x) { return x * 23; }
+inline int f3592_24(int x) { return x * 24; }
+inline int f3592_25(int x) { return x * 25; }
+inline int f3592_26(int x) { return x * 26; }
+inline int f3592_27(int x) { return x * 27; }
+inline int f3592_28(int x) { return x * 28; }
+inline int f3592_29(int x) { return x * 29; }
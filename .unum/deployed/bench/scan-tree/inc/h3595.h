@@ -0,0 +1,42 @@
+#pragma once
+/* header 3595 */
+#include <vector>
+#include "h2638.h"
+#include "h5448.h"
+#include "h9225.h"
+#include "h9088.h"
+#include "h8507.h"
+#ifdef X
+#include "h3284.h"
+#endif
+struct S3595 { int a; const char *s = "x//y"; };
+inline int f3595_0(int x) { return x * 0; }
+inline int f3595_1(int x) { return x * 1; }
+inline int f3595_2(int x) { return x * 2; }
+inline int f3595_3(int x) { return x * 3; }
+inline int f3595_4(int x) { return x * 4; }
+inline int f3595_5(int x) { return x * 5; }
+inline int f3595_6(int x) { return x * 6; }
+inline int f3595_7(int x) { return x * 7; }
+inline int f3595_8(int x) { return x * 8; }
+inline int f3595_9(int x) { return x * 9; }
+inline int f3595_10(int x) { return x * 10; }
+inline int f3595_11(int x) { return x * 11; }
+inline int f3595_12(int x) { return x * 12; }
+inline int f3595_13(int x) { return x * 13; }
+inline int f3595_14(int x) { return x * 14; }
+inline int f3595_15(int x) { return x * 15; }
+inline int f3595_16(int x) { return x * 16; }
+inline int f3595_17(int x) { return x * 17; }
+inline int f3595_18(int x) { return x * 18; }
+inline int f3595_19(int x) { return x * 19; }
+inline int f3595_20(int x) { return x * 20; }
+inline int f3595_21(int x) { return x * 21; }
+inline int f3595_22(int x) { return x * 22; }
+inline int f3595_23(int x) { return x * 23; }
+inline int f3595_24(int x) { return x * 24; }
+inline int f3595_25(int x) { return x * 25; }
+inline int f3595_26(int x) { return x * 26; }
+inline int f3595_27(int x) { return x * 27; }
+inline int f3595_28(int x) { return x * 28; }
+inline int f3595_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3599 */
+#include <vector>
+#include "h7237.h"
+#include "h6106.h"
+#include "h8653.h"
+#include "h5931.h"
+#include "h7057.h"
+#ifdef X
+#include "h5063.h"
+#endif
+struct S3599 { int a; const char *s = "x//y"; };
+inline int f3599_0(int x) { return x * 0; }
+inline int f3599_1(int x) { return x * 1; }
+inline int f3599_2(int x) { return x * 2; }
+inline int f3599_3(int x) { return x * 3; }
+inline int f3599_4(int x) { return x * 4; }
+inline int f3599_5(int x) { return x * 5; }
+inline int f3599_6(int x) { return x * 6; }
+inline int f3599_7(int x) { return x * 7; }
+inline int f3599_8(int x) { return x * 8; }
+inline int f3599_9(int x) { return x * 9; }
+inline int f3599_10(int x) { return x * 10; }
+inline int f3599_11(int x) { return x * 11; }
+inline int f3599_12(int x) { return x * 12; }
+inline int f3599_13(int x) { return x * 13; }
+inline int f3599_14(int x) { return x * 14; }
+inline int f3599_15(int x) { return x * 15; }
+inline int f3599_16(int x) { return x * 16; }
+inline int f3599_17(int x) { return x * 17; }
+inline int f3599_18(int x) { return x * 18; }
+inline int f3599_19(int x) { return x * 19; }
+inline int f3599_20(int x) { return x * 20; }
+inline int f3599_21(int x) { return x * 21; }
+inline int f3599_22(int x) { return x * 22; }
+inline int f3599_23(int x) { return x * 23; }
+inline int f3599_24(int x) { return x * 24; }
+inline int f3599_25(int x) { return x * 25; }
+inline int f3599_26(int x) { return x * 26; }
+inline int f3599_27(int x) { return x * 27; }
+inline int f3599_28(int x) { return x * 28; }
+inline int f3599_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 36 */
+#include <vector>
+#include "h1621.h"
+#include "h2664.h"
+#include "h4328.h"
+#include "h9807.h"
+#include "h2277.h"
+#ifdef X
+#include "h1213.h"
+#endif
+struct S36 { int a; const char *s = "x//y"; };
+inline int f36_0(int x) { return x * 0; }
+inline int f36_1(int x) { return x * 1; }
+inline int f36_2(int x) { return x * 2; }
+inline int f36_3(int x) { return x * 3; }
+inline int f36_4(int x) { return x * 4; }
+inline int f36_5(int x) { return x * 5; }
+inline int f36_6(int x) { return x * 6; }
+inline int f36_7(int x) { return x * 7; }
+inline int f36_8(int x) { return x * 8; }
+inline int f36_9(int x) { return x * 9; }
+inline int f36_10(int x) { return x * 10; }
+inline int f36_11(int x) { return x * 11; }
+inline int f36_12(int x) { return x * 12; }
+inline int f36_13(int x) { return x * 13; }
+inline int f36_14(int x) { return x * 14; }
+inline int f36_15(int x) { return x * 15; }
+inline int f36_16(int x) { return x * 16; }
+inline int f36_17(int x) { return x * 17; }
+inline int f36_18(int x) { return x * 18; }
+inline int f36_19(int x) { return x * 19; }
+inline int f36_20(int x) { return x * 20; }
+inline int f36_21(int x) { return x * 21; }
+inline int f36_22(int x) { return x * 22; }
+inline int f36_23(int x) { return x * 23; }
+inline int f36_24(int x) { return x * 24; }
+inline int f36_25(int x) { return x * 25; }
+inline int f36_26(int x) { return x * 26; }
+inline int f36_27(int x) { return x * 27; }
+inline int f36_28(int x) { return x * 28; }
+inline int f36_29(int x) { return x * 29; }
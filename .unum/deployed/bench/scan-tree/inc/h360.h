@@ -0,0 +1,42 @@
+#pragma once
+/* header 360 */
+#include <vector>
+#include "h8864.h"
+#include "h4991.h"
+#include "h1728.h"
+#include "h6652.h"
+#include "h3740.h"
+#ifdef X
+#include "h266.h"
+#endif
+struct S360 { int a; const char *s = "x//y"; };
+inline int f360_0(int x) { return x * 0; }
+inline int f360_1(int x) { return x * 1; }
+inline int f360_2(int x) { return x * 2; }
+inline int f360_3(int x) { return x * 3; }
+inline int f360_4(int x) { return x * 4; }
+inline int f360_5(int x) { return x * 5; }
+inline int f360_6(int x) { return x * 6; }
+inline int f360_7(int x) { return x * 7; }
+inline int f360_8(int x) { return x * 8; }
+inline int f360_9(int x) { return x * 9; }
+inline int f360_10(int x) { return x * 10; }
+inline int f360_11(int x) { return x * 11; }
+inline int f360_12(int x) { return x * 12; }
+inline int f360_13(int x) { return x * 13; }
+inline int f360_14(int x) { return x * 14; }
+inline int f360_15(int x) { return x * 15; }
+inline int f360_16(int x) { return x * 16; }
+inline int f360_17(int x) { return x * 17; }
+inline int f360_18(int x) { return x * 18; }
+inline int f360_19(int x) { return x * 19; }
+inline int f360_20(int x) { return x * 20; }
+inline int f360_21(int x) { return x * 21; }
+inline int f360_22(int x) { return x * 22; }
+inline int f360_23(int x) { return x * 23; }
+inline int f360_24(int x) { return x * 24; }
+inline int f360_25(int x) { return x * 25; }
+inline int f360_26(int x) { return x * 26; }
+inline int f360_27(int x) { return x * 27; }
+inline int f360_28(int x) { return x * 28; }
+inline int f360_29(int x) { return x * 29; }
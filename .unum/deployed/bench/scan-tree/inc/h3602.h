@@ -0,0 +1,42 @@
+#pragma once
+/* header 3602 */
+#include <vector>
+#include "h4892.h"
+#include "h9026.h"
+#include "h6753.h"
+#include "h3808.h"
+#include "h9553.h"
+#ifdef X
+#include "h1198.h"
+#endif
+struct S3602 { int a; const char *s = "x//y"; };
+inline int f3602_0(int x) { return x * 0; }
+inline int f3602_1(int x) { return x * 1; }
+inline int f3602_2(int x) { return x * 2; }
+inline int f3602_3(int x) { return x * 3; }
+inline int f3602_4(int x) { return x * 4; }
+inline int f3602_5(int x) { return x * 5; }
+inline int f3602_6(int x) { return x * 6; }
+inline int f3602_7(int x) { return x * 7; }
+inline int f3602_8(int x) { return x * 8; }
+inline int f3602_9(int x) { return x * 9; }
+inline int f3602_10(int x) { return x * 10; }
+inline int f3602_11(int x) { return x * 11; }
+inline int f3602_12(int x) { return x * 12; }
+inline int f3602_13(int x) { return x * 13; }
+inline int f3602_14(int x) { return x * 14; }
+inline int f3602_15(int x) { return x * 15; }
+inline int f3602_16(int x) { return x * 16; }
+inline int f3602_17(int x) { return x * 17; }
+inline int f3602_18(int x) { return x * 18; }
+inline int f3602_19(int x) { return x * 19; }
+inline int f3602_20(int x) { return x * 20; }
+inline int f3602_21(int x) { return x * 21; }
+inline int f3602_22(int x) { return x * 22; }
+inline int f3602_23(int x) { return x * 23; }
+inline int f3602_24(int x) { return x * 24; }
+inline int f3602_25(int x) { return x * 25; }
+inline int f3602_26(int x) { return x * 26; }
+inline int f3602_27(int x) { return x * 27; }
+inline int f3602_28(int x) { return x * 28; }
+inline int f3602_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3603 */
+#include <vector>
+#include "h8661.h"
+#include "h6821.h"
+#include "h2529.h"
+#include "h1992.h"
+#include "h2320.h"
+#ifdef X
+#include "h6786.h"
+#endif
+struct S3603 { int a; const char *s = "x//y"; };
+inline int f3603_0(int x) { return x * 0; }
+inline int f3603_1(int x) { return x * 1; }
+inline int f3603_2(int x) { return x * 2; }
+inline int f3603_3(int x) { return x * 3; }
+inline int f3603_4(int x) { return x * 4; }
+inline int f3603_5(int x) { return x * 5; }
+inline int f3603_6(int x) { return x * 6; }
+inline int f3603_7(int x) { return x * 7; }
+inline int f3603_8(int x) { return x * 8; }
+inline int f3603_9(int x) { return x * 9; }
+inline int f3603_10(int x) { return x * 10; }
+inline int f3603_11(int x) { return x * 11; }
+inline int f3603_12(int x) { return x * 12; }
+inline int f3603_13(int x) { return x * 13; }
+inline int f3603_14(int x) { return x * 14; }
+inline int f3603_15(int x) { return x * 15; }
+inline int f3603_16(int x) { return x * 16; }
+inline int f3603_17(int x) { return x * 17; }
+inline int f3603_18(int x) { return x * 18; }
+inline int f3603_19(int x) { return x * 19; }
+inline int f3603_20(int x) { return x * 20; }
+inline int f3603_21(int x) { return x * 21; }
+inline int f3603_22(int x) { return x * 22; }
+inline int f3603_23(int x) { return x * 23; }
+inline int f3603_24(int x) { return x * 24; }
+inline int f3603_25(int x) { return x * 25; }
+inline int f3603_26(int x) { return x * 26; }
+inline int f3603_27(int x) { return x * 27; }
+inline int f3603_28(int x) { return x * 28; }
+inline int f3603_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3604 */
+#include <vector>
+#include "h1499.h"
+#include "h3549.h"
+#include "h6709.h"
+#include "h5651.h"
+#include "h6523.h"
+#ifdef X
+#include "h8948.h"
+#endif
+struct S3604 { int a; const char *s = "x//y"; };
+inline int f3604_0(int x) { return x * 0; }
+inline int f3604_1(int x) { return x * 1; }
+inline int f3604_2(int x) { return x * 2; }
+inline int f3604_3(int x) { return x * 3; }
+inline int f3604_4(int x) { return x * 4; }
+inline int f3604_5(int x) { return x * 5; }
+inline int f3604_6(int x) { return x * 6; }
+inline int f3604_7(int x) { return x * 7; }
+inline int f3604_8(int x) { return x * 8; }
+inline int f3604_9(int x) { return x * 9; }
+inline int f3604_10(int x) { return x * 10; }
+inline int f3604_11(int x) { return x * 11; }
+inline int f3604_12(int x) { return x * 12; }
+inline int f3604_13(int x) { return x * 13; }
+inline int f3604_14(int x) { return x * 14; }
+inline int f3604_15(int x) { return x * 15; }
+inline int f3604_16(int x) { return x * 16; }
+inline int f3604_17(int x) { return x * 17; }
+inline int f3604_18(int x) { return x * 18; }
+inline int f3604_19(int x) { return x * 19; }
+inline int f3604_20(int x) { return x * 20; }
+inline int f3604_21(int x) { return x * 21; }
+inline int f3604_22(int x) { return x * 22; }
+inline int f3604_23(int x) { return x * 23; }
+inline int f3604_24(int x) { return x * 24; }
+inline int f3604_25(int x) { return x * 25; }
+inline int f3604_26(int x) { return x * 26; }
+inline int f3604_27(int x) { return x * 27; }
+inline int f3604_28(int x) { return x * 28; }
+inline int f3604_29(int x) { return x * 29; }
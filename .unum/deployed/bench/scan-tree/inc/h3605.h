@@ -0,0 +1,42 @@
+#pragma once
+/* header 3605 */
+#include <vector>
+#include "h1716.h"
+#include "h4116.h"
+#include "h8716.h"
+#include "h7538.h"
+#include "h3840.h"
+#ifdef X
+#include "h324.h"
+#endif
+struct S3605 { int a; const char *s = "x//y"; };
+inline int f3605_0(int x) { return x * 0; }
+inline int f3605_1(int x) { return x * 1; }
+inline int f3605_2(int x) { return x * 2; }
+inline int f3605_3(int x) { return x * 3; }
+inline int f3605_4(int x) { return x * 4; }
+inline int f3605_5(int x) { return x * 5; }
+inline int f3605_6(int x) { return x * 6; }
+inline int f3605_7(int x) { return x * 7; }
+inline int f3605_8(int x) { return x * 8; }
+inline int f3605_9(int x) { return x * 9; }
+inline int f3605_10(int x) { return x * 10; }
+inline int f3605_11(int x) { return x * 11; }
+inline int f3605_12(int x) { return x * 12; }
+inline int f3605_13(int x) { return x * 13; }
+inline int f3605_14(int x) { return x * 14; }
+inline int f3605_15(int x) { return x * 15; }
+inline int f3605_16(int x) { return x * 16; }
+inline int f3605_17(int x) { return x * 17; }
+inline int f3605_18(int x) { return x * 18; }
+inline int f3605_19(int x) { return x * 19; }
+inline int f3605_20(int x) { return x * 20; }
+inline int f3605_21(int x) { return x * 21; }
+inline int f3605_22(int x) { return x * 22; }
+inline int f3605_23(int x) { return x * 23; }
+inline int f3605_24(int x) { return x * 24; }
+inline int f3605_25(int x) { return x * 25; }
+inline int f3605_26(int x) { return x * 26; }
+inline int f3605_27(int x) { return x * 27; }
+inline int f3605_28(int x) { return x * 28; }
+inline int f3605_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 361 */
+#include <vector>
+#include "h498.h"
+#include "h9834.h"
+#include "h7765.h"
+#include "h2403.h"
+#include "h3462.h"
+#ifdef X
+#include "h2334.h"
+#endif
+struct S361 { int a; const char *s = "x//y"; };
+inline int f361_0(int x) { return x * 0; }
+inline int f361_1(int x) { return x * 1; }
+inline int f361_2(int x) { return x * 2; }
+inline int f361_3(int x) { return x * 3; }
+inline int f361_4(int x) { return x * 4; }
+inline int f361_5(int x) { return x * 5; }
+inline int f361_6(int x) { return x * 6; }
+inline int f361_7(int x) { return x * 7; }
+inline int f361_8(int x) { return x * 8; }
+inline int f361_9(int x) { return x * 9; }
+inline int f361_10(int x) { return x * 10; }
+inline int f361_11(int x) { return x * 11; }
+inline int f361_12(int x) { return x * 12; }
+inline int f361_13(int x) { return x * 13; }
+inline int f361_14(int x) { return x * 14; }
+inline int f361_15(int x) { return x * 15; }
+inline int f361_16(int x) { return x * 16; }
+inline int f361_17(int x) { return x * 17; }
+inline int f361_18(int x) { return x * 18; }
+inline int f361_19(int x) { return x * 19; }
+inline int f361_20(int x) { return x * 20; }
+inline int f361_21(int x) { return x * 21; }
+inline int f361_22(int x) { return x * 22; }
+inline int f361_23(int x) { return x * 23; }
+inline int f361_24(int x) { return x * 24; }
+inline int f361_25(int x) { return x * 25; }
+inline int f361_26(int x) { return x * 26; }
+inline int f361_27(int x) { return x * 27; }
+inline int f361_28(int x) { return x * 28; }
+inline int f361_29(int x) { return x * 29; }
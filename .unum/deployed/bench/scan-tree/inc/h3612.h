@@ -0,0 +1,42 @@
+#pragma once
+/* header 3612 */
+#include <vector>
+#include "h7784.h"
+#include "h8889.h"
+#include "h8877.h"
+#include "h8013.h"
+#include "h6417.h"
+#ifdef X
+#include "h7856.h"
+#endif
+struct S3612 { int a; const char *s = "x//y"; };
+inline int f3612_0(int x) { return x * 0; }
+inline int f3612_1(int x) { return x * 1; }
+inline int f3612_2(int x) { return x * 2; }
+inline int f3612_3(int x) { return x * 3; }
+inline int f3612_4(int x) { return x * 4; }
+inline int f3612_5(int x) { return x * 5; }
+inline int f3612_6(int x) { return x * 6; }
+inline int f3612_7(int x) { return x * 7; }
+inline int f3612_8(int x) { return x * 8; }
+inline int f3612_9(int x) { return x * 9; }
+inline int f3612_10(int x) { return x * 10; }
+inline int f3612_11(int x) { return x * 11; }
+inline int f3612_12(int x) { return x * 12; }
+inline int f3612_13(int x) { return x * 13; }
+inline int f3612_14(int x) { return x * 14; }
+inline int f3612_15(int x) { return x * 15; }
+inline int f3612_16(int x) { return x * 16; }
+inline int f3612_17(int x) { return x * 17; }
+inline int f3612_18(int x) { return x * 18; }
+inline int f3612_19(int x) { return x * 19; }
+inline int f3612_20(int x) { return x * 20; }
+inline int f3612_21(int x) { return x * 21; }
+inline int f3612_22(int x) { return x * 22; }
+inline int f3612_23(int x) { return x * 23; }
+inline int f3612_24(int x) { return x * 24; }
+inline int f3612_25(int x) { return x * 25; }
+inline int f3612_26(int x) { return x * 26; }
+inline int f3612_27(int x) { return x * 27; }
+inline int f3612_28(int x) { return x * 28; }
+inline int f3612_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3618 */
+#include <vector>
+#include "h6550.h"
+#include "h6354.h"
+#include "h6563.h"
+#include "h4762.h"
+#include "h2706.h"
+#ifdef X
+#include "h7446.h"
+#endif
+struct S3618 { int a; const char *s = "x//y"; };
+inline int f3618_0(int x) { return x * 0; }
+inline int f3618_1(int x) { return x * 1; }
+inline int f3618_2(int x) { return x * 2; }
+inline int f3618_3(int x) { return x * 3; }
+inline int f3618_4(int x) { return x * 4; }
+inline int f3618_5(int x) { return x * 5; }
+inline int f3618_6(int x) { return x * 6; }
+inline int f3618_7(int x) { return x * 7; }
+inline int f3618_8(int x) { return x * 8; }
+inline int f3618_9(int x) { return x * 9; }
+inline int f3618_10(int x) { return x * 10; }
+inline int f3618_11(int x) { return x * 11; }
+inline int f3618_12(int x) { return x * 12; }
+inline int f3618_13(int x) { return x * 13; }
+inline int f3618_14(int x) { return x * 14; }
+inline int f3618_15(int x) { return x * 15; }
+inline int f3618_16(int x) { return x * 16; }
+inline int f3618_17(int x) { return x * 17; }
+inline int f3618_18(int x) { return x * 18; }
+inline int f3618_19(int x) { return x * 19; }
+inline int f3618_20(int x) { return x * 20; }
+inline int f3618_21(int x) { return x * 21; }
+inline int f3618_22(int x) { return x * 22; }
+inline int f3618_23(int x) { return x * 23; }
+inline int f3618_24(int x) { return x * 24; }
+inline int f3618_25(int x) { return x * 25; }
+inline int f3618_26(int x) { return x * 26; }
+inline int f3618_27(int x) { return x * 27; }
+inline int f3618_28(int x) { return x * 28; }
+inline int f3618_29(int x) { return x * 29; }
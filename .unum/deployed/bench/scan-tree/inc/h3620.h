@@ -0,0 +1,42 @@
+#pragma once
+/* header 3620 */
+#include <vector>
+#include "h3881.h"
+#include "h3825.h"
+#include "h2843.h"
+#include "h9324.h"
+#include "h6088.h"
+#ifdef X
+#include "h7788.h"
+#endif
+struct S3620 { int a; const char *s = "x//y"; };
+inline int f3620_0(int x) { return x * 0; }
+inline int f3620_1(int x) { return x * 1; }
+inline int f3620_2(int x) { return x * 2; }
+inline int f3620_3(int x) { return x * 3; }
+inline int f3620_4(int x) { return x * 4; }
+inline int f3620_5(int x) { return x * 5; }
+inline int f3620_6(int x) { return x * 6; }
+inline int f3620_7(int x) { return x * 7; }
+inline int f3620_8(int x) { return x * 8; }
+inline int f3620_9(int x) { return x * 9; }
+inline int f3620_10(int x) { return x * 10; }
+inline int f3620_11(int x) { return x * 11; }
+inline int f3620_12(int x) { return x * 12; }
+inline int f3620_13(int x) { return x * 13; }
+inline int f3620_14(int x) { return x * 14; }
+inline int f3620_15(int x) { return x * 15; }
+inline int f3620_16(int x) { return x * 16; }
+inline int f3620_17(int x) { return x * 17; }
+inline int f3620_18(int x) { return x * 18; }
+inline int f3620_19(int x) { return x * 19; }
+inline int f3620_20(int x) { return x * 20; }
+inline int f3620_21(int x) { return x * 21; }
+inline int f3620_22(int x) { return x * 22; }
+inline int f3620_23(int x) { return x * 23; }
+inline int f3620_24(int x) { return x * 24; }
+inline int f3620_25(int x) { return x * 25; }
+inline int f3620_26(int x) { return x * 26; }
+inline int f3620_27(int x) { return x * 27; }
+inline int f3620_28(int x) { return x * 28; }
+inline int f3620_29(int x) { return x * 29; }
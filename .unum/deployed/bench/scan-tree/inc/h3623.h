@@ -0,0 +1,42 @@
+#pragma once
+/* header 3623 */
+#include <vector>
+#include "h5085.h"
+#include "h1789.h"
+#include "h5144.h"
+#include "h8609.h"
+#include "h9651.h"
+#ifdef X
+#include "h9547.h"
+#endif
+struct S3623 { int a; const char *s = "x//y"; };
+inline int f3623_0(int x) { return x * 0; }
+inline int f3623_1(int x) { return x * 1; }
+inline int f3623_2(int x) { return x * 2; }
+inline int f3623_3(int x) { return x * 3; }
+inline int f3623_4(int x) { return x * 4; }
+inline int f3623_5(int x) { return x * 5; }
+inline int f3623_6(int x) { return x * 6; }
+inline int f3623_7(int x) { return x * 7; }
+inline int f3623_8(int x) { return x * 8; }
+inline int f3623_9(int x) { return x * 9; }
+inline int f3623_10(int x) { return x * 10; }
+inline int f3623_11(int x) { return x * 11; }
+inline int f3623_12(int x) { return x * 12; }
+inline int f3623_13(int x) { return x * 13; }
+inline int f3623_14(int x) { return x * 14; }
+inline int f3623_15(int x) { return x * 15; }
+inline int f3623_16(int x) { return x * 16; }
+inline int f3623_17(int x) { return x * 17; }
+inline int f3623_18(int x) { return x * 18; }
+inline int f3623_19(int x) { return x * 19; }
+inline int f3623_20(int x) { return x * 20; }
+inline int f3623_21(int x) { return x * 21; }
+inline int f3623_22(int x) { return x * 22; }
+inline int f3623_23(int x) { return x * 23; }
+inline int f3623_24(int x) { return x * 24; }
+inline int f3623_25(int x) { return x * 25; }
+inline int f3623_26(int x) { return x * 26; }
+inline int f3623_27(int x) { return x * 27; }
+inline int f3623_28(int x) { return x * 28; }
+inline int f3623_29(int x) { return x * 29; }
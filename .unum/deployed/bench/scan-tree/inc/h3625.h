@@ -0,0 +1,42 @@
+#pragma once
+/* header 3625 */
+#include <vector>
+#include "h4383.h"
+#include "h6170.h"
+#include "h2892.h"
+#include "h9673.h"
+#include "h5366.h"
+#ifdef X
+#include "h363.h"
+#endif
+struct S3625 { int a; const char *s = "x//y"; };
+inline int f3625_0(int x) { return x * 0; }
+inline int f3625_1(int x) { return x * 1; }
+inline int f3625_2(int x) { return x * 2; }
+inline int f3625_3(int x) { return x * 3; }
+inline int f3625_4(int x) { return x * 4; }
+inline int f3625_5(int x) { return x * 5; }
+inline int f3625_6(int x) { return x * 6; }
+inline int f3625_7(int x) { return x * 7; }
+inline int f3625_8(int x) { return x * 8; }
+inline int f3625_9(int x) { return x * 9; }
+inline int f3625_10(int x) { return x * 10; }
+inline int f3625_11(int x) { return x * 11; }
+inline int f3625_12(int x) { return x * 12; }
+inline int f3625_13(int x) { return x * 13; }
+inline int f3625_14(int x) { return x * 14; }
+inline int f3625_15(int x) { return x * 15; }
+inline int f3625_16(int x) { return x * 16; }
+inline int f3625_17(int x) { return x * 17; }
+inline int f3625_18(int x) { return x * 18; }
+inline int f3625_19(int x) { return x * 19; }
+inline int f3625_20(int x) { return x * 20; }
+inline int f3625_21(int x) { return x * 21; }
+inline int f3625_22(int x) { return x * 22; }
+inline int f3625_23(int x) { return x * 23; }
+inline int f3625_24(int x) { return x * 24; }
+inline int f3625_25(int x) { return x * 25; }
+inline int f3625_26(int x) { return x * 26; }
+inline int f3625_27(int x) { return x * 27; }
+inline int f3625_28(int x) { return x * 28; }
+inline int f3625_29(int x) { return x * 29; }
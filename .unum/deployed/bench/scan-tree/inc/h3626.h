@@ -0,0 +1,42 @@
+#pragma once
+/* header 3626 */
+#include <vector>
+#include "h123.h"
+#include "h5943.h"
+#include "h6844.h"
+#include "h7008.h"
+#include "h241.h"
+#ifdef X
+#include "h6499.h"
+#endif
+struct S3626 { int a; const char *s = "x//y"; };
+inline int f3626_0(int x) { return x * 0; }
+inline int f3626_1(int x) { return x * 1; }
+inline int f3626_2(int x) { return x * 2; }
+inline int f3626_3(int x) { return x * 3; }
+inline int f3626_4(int x) { return x * 4; }
+inline int f3626_5(int x) { return x * 5; }
+inline int f3626_6(int x) { return x * 6; }
+inline int f3626_7(int x) { return x * 7; }
+inline int f3626_8(int x) { return x * 8; }
+inline int f3626_9(int x) { return x * 9; }
+inline int f3626_10(int x) { return x * 10; }
+inline int f3626_11(int x) { return x * 11; }
+inline int f3626_12(int x) { return x * 12; }
+inline int f3626_13(int x) { return x * 13; }
+inline int f3626_14(int x) { return x * 14; }
+inline int f3626_15(int x) { return x * 15; }
+inline int f3626_16(int x) { return x * 16; }
+inline int f3626_17(int x) { return x * 17; }
+inline int f3626_18(int x) { return x * 18; }
+inline int f3626_19(int x) { return x * 19; }
+inline int f3626_20(int x) { return x * 20; }
+inline int f3626_21(int x) { return x * 21; }
+inline int f3626_22(int x) { return x * 22; }
+inline int f3626_23(int x) { return x * 23; }
+inline int f3626_24(int x) { return x * 24; }
+inline int f3626_25(int x) { return x * 25; }
+inline int f3626_26(int x) { return x * 26; }
+inline int f3626_27(int x) { return x * 27; }
+inline int f3626_28(int x) { return x * 28; }
+inline int f3626_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3629 */
+#include <vector>
+#include "h9731.h"
+#include "h5979.h"
+#include "h2431.h"
+#include "h874.h"
+#include "h6088.h"
+#ifdef X
+#include "h3089.h"
+#endif
+struct S3629 { int a; const char *s = "x//y"; };
+inline int f3629_0(int x) { return x * 0; }
+inline int f3629_1(int x) { return x * 1; }
+inline int f3629_2(int x) { return x * 2; }
+inline int f3629_3(int x) { return x * 3; }
+inline int f3629_4(int x) { return x * 4; }
+inline int f3629_5(int x) { return x * 5; }
+inline int f3629_6(int x) { return x * 6; }
+inline int f3629_7(int x) { return x * 7; }
+inline int f3629_8(int x) { return x * 8; }
+inline int f3629_9(int x) { return x * 9; }
+inline int f3629_10(int x) { return x * 10; }
+inline int f3629_11(int x) { return x * 11; }
+inline int f3629_12(int x) { return x * 12; }
+inline int f3629_13(int x) { return x * 13; }
+inline int f3629_14(int x) { return x * 14; }
+inline int f3629_15(int x) { return x * 15; }
+inline int f3629_16(int x) { return x * 16; }
+inline int f3629_17(int x) { return x * 17; }
+inline int f3629_18(int x) { return x * 18; }
+inline int f3629_19(int x) { return x * 19; }
+inline int f3629_20(int x) { return x * 20; }
+inline int f3629_21(int x) { return x * 21; }
+inline int f3629_22(int x) { return x * 22; }
+inline int f3629_23(int x) { return x * 23; }
+inline int f3629_24(int x) { return x * 24; }
+inline int f3629_25(int x) { return x * 25; }
+inline int f3629_26(int x) { return x * 26; }
+inline int f3629_27(int x) { return x * 27; }
+inline int f3629_28(int x) { return x * 28; }
+inline int f3629_29(int x) { return x * 29; }
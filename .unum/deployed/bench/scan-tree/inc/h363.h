@@ -0,0 +1,42 @@
+#pragma once
+/* header 363 */
+#include <vector>
+#include "h4649.h"
+#include "h2200.h"
+#include "h4949.h"
+#include "h3470.h"
+#include "h4489.h"
+#ifdef X
+#include "h9467.h"
+#endif
+struct S363 { int a; const char *s = "x//y"; };
+inline int f363_0(int x) { return x * 0; }
+inline int f363_1(int x) { return x * 1; }
+inline int f363_2(int x) { return x * 2; }
+inline int f363_3(int x) { return x * 3; }
+inline int f363_4(int x) { return x * 4; }
+inline int f363_5(int x) { return x * 5; }
+inline int f363_6(int x) { return x * 6; }
+inline int f363_7(int x) { return x * 7; }
+inline int f363_8(int x) { return x * 8; }
+inline int f363_9(int x) { return x * 9; }
+inline int f363_10(int x) { return x * 10; }
+inline int f363_11(int x) { return x * 11; }
+inline int f363_12(int x) { return x * 12; }
+inline int f363_13(int x) { return x * 13; }
+inline int f363_14(int x) { return x * 14; }
+inline int f363_15(int x) { return x * 15; }
+inline int f363_16(int x) { return x * 16; }
+inline int f363_17(int x) { return x * 17; }
+inline int f363_18(int x) { return x * 18; }
+inline int f363_19(int x) { return x * 19; }
+inline int f363_20(int x) { return x * 20; }
+inline int f363_21(int x) { return x * 21; }
+inline int f363_22(int x) { return x * 22; }
+inline int f363_23(int x) { return x * 23; }
+inline int f363_24(int x) { return x * 24; }
+inline int f363_25(int x) { return x * 25; }
+inline int f363_26(int x) { return x * 26; }
+inline int f363_27(int x) { return x * 27; }
+inline int f363_28(int x) { return x * 28; }
+inline int f363_29(int x) { return x * 29; }
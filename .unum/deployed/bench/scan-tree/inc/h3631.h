@@ -0,0 +1,42 @@
+#pragma once
+/* header 3631 */
+#include <vector>
+#include "h9023.h"
+#include "h3443.h"
+#include "h5645.h"
+#include "h8790.h"
+#include "h6541.h"
+#ifdef X
+#include "h9996.h"
+#endif
+struct S3631 { int a; const char *s = "x//y"; };
+inline int f3631_0(int x) { return x * 0; }
+inline int f3631_1(int x) { return x * 1; }
+inline int f3631_2(int x) { return x * 2; }
+inline int f3631_3(int x) { return x * 3; }
+inline int f3631_4(int x) { return x * 4; }
+inline int f3631_5(int x) { return x * 5; }
+inline int f3631_6(int x) { return x * 6; }
+inline int f3631_7(int x) { return x * 7; }
+inline int f3631_8(int x) { return x * 8; }
+inline int f3631_9(int x) { return x * 9; }
+inline int f3631_10(int x) { return x * 10; }
+inline int f3631_11(int x) { return x * 11; }
+inline int f3631_12(int x) { return x * 12; }
+inline int f3631_13(int x) { return x * 13; }
+inline int f3631_14(int x) { return x * 14; }
+inline int f3631_15(int x) { return x * 15; }
+inline int f3631_16(int x) { return x * 16; }
+inline int f3631_17(int x) { return x * 17; }
+inline int f3631_18(int x) { return x * 18; }
+inline int f3631_19(int x) { return x * 19; }
+inline int f3631_20(int x) { return x * 20; }
+inline int f3631_21(int x) { return x * 21; }
+inline int f3631_22(int x) { return x * 22; }
+inline int f3631_23(int x) { return x * 23; }
+inline int f3631_24(int x) { return x * 24; }
+inline int f3631_25(int x) { return x * 25; }
+inline int f3631_26(int x) { return x * 26; }
+inline int f3631_27(int x) { return x * 27; }
+inline int f3631_28(int x) { return x * 28; }
+inline int f3631_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3633 */
+#include <vector>
+#include "h2173.h"
+#include "h9253.h"
+#include "h1352.h"
+#include "h3084.h"
+#include "h1129.h"
+#ifdef X
+#include "h7304.h"
+#endif
+struct S3633 { int a; const char *s = "x//y"; };
+inline int f3633_0(int x) { return x * 0; }
+inline int f3633_1(int x) { return x * 1; }
+inline int f3633_2(int x) { return x * 2; }
+inline int f3633_3(int x) { return x * 3; }
+inline int f3633_4(int x) { return x * 4; }
+inline int f3633_5(int x) { return x * 5; }
+inline int f3633_6(int x) { return x * 6; }
+inline int f3633_7(int x) { return x * 7; }
+inline int f3633_8(int x) { return x * 8; }
+inline int f3633_9(int x) { return x * 9; }
+inline int f3633_10(int x) { return x * 10; }
+inline int f3633_11(int x) { return x * 11; }
+inline int f3633_12(int x) { return x * 12; }
+inline int f3633_13(int x) { return x * 13; }
+inline int f3633_14(int x) { return x * 14; }
+inline int f3633_15(int x) { return x * 15; }
+inline int f3633_16(int x) { return x * 16; }
+inline int f3633_17(int x) { return x * 17; }
+inline int f3633_18(int x) { return x * 18; }
+inline int f3633_19(int x) { return x * 19; }
+inline int f3633_20(int x) { return x * 20; }
+inline int f3633_21(int x) { return x * 21; }
+inline int f3633_22(int x) { return x * 22; }
+inline int f3633_23(int x) { return x * 23; }
+inline int f3633_24(int x) { return x * 24; }
+inline int f3633_25(int x) { return x * 25; }
+inline int f3633_26(int x) { return x * 26; }
+inline int f3633_27(int x) { return x * 27; }
+inline int f3633_28(int x) { return x * 28; }
+inline int f3633_29(int x) { return x * 29; }
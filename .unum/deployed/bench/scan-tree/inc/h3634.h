@@ -0,0 +1,42 @@
+#pragma once
+/* header 3634 */
+#include <vector>
+#include "h4852.h"
+#include "h103.h"
+#include "h3478.h"
+#include "h6356.h"
+#include "h3192.h"
+#ifdef X
+#include "h9692.h"
+#endif
+struct S3634 { int a; const char *s = "x//y"; };
+inline int f3634_0(int x) { return x * 0; }
+inline int f3634_1(int x) { return x * 1; }
+inline int f3634_2(int x) { return x * 2; }
+inline int f3634_3(int x) { return x * 3; }
+inline int f3634_4(int x) { return x * 4; }
+inline int f3634_5(int x) { return x * 5; }
+inline int f3634_6(int x) { return x * 6; }
+inline int f3634_7(int x) { return x * 7; }
+inline int f3634_8(int x) { return x * 8; }
+inline int f3634_9(int x) { return x * 9; }
+inline int f3634_10(int x) { return x * 10; }
+inline int f3634_11(int x) { return x * 11; }
+inline int f3634_12(int x) { return x * 12; }
+inline int f3634_13(int x) { return x * 13; }
+inline int f3634_14(int x) { return x * 14; }
+inline int f3634_15(int x) { return x * 15; }
+inline int f3634_16(int x) { return x * 16; }
+inline int f3634_17(int x) { return x * 17; }
+inline int f3634_18(int x) { return x * 18; }
+inline int f3634_19(int x) { return x * 19; }
+inline int f3634_20(int x) { return x * 20; }
+inline int f3634_21(int x) { return x * 21; }
+inline int f3634_22(int x) { return x * 22; }
+inline int f3634_23(int x) { return x * 23; }
+inline int f3634_24(int x) { return x * 24; }
+inline int f3634_25(int x) { return x * 25; }
+inline int f3634_26(int x) { return x * 26; }
+inline int f3634_27(int x) { return x * 27; }
+inline int f3634_28(int x) { return x * 28; }
+inline int f3634_29(int x) { return x * 29; }
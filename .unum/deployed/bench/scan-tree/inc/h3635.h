@@ -0,0 +1,42 @@
+#pragma once
+/* header 3635 */
+#include <vector>
+#include "h8409.h"
+#include "h6006.h"
+#include "h9621.h"
+#include "h8893.h"
+#include "h1500.h"
+#ifdef X
+#include "h5388.h"
+#endif
+struct S3635 { int a; const char *s = "x//y"; };
+inline int f3635_0(int x) { return x * 0; }
+inline int f3635_1(int x) { return x * 1; }
+inline int f3635_2(int x) { return x * 2; }
+inline int f3635_3(int x) { return x * 3; }
+inline int f3635_4(int x) { return x * 4; }
+inline int f3635_5(int x) { return x * 5; }
+inline int f3635_6(int x) { return x * 6; }
+inline int f3635_7(int x) { return x * 7; }
+inline int f3635_8(int x) { return x * 8; }
+inline int f3635_9(int x) { return x * 9; }
+inline int f3635_10(int x) { return x * 10; }
+inline int f3635_11(int x) { return x * 11; }
+inline int f3635_12(int x) { return x * 12; }
+inline int f3635_13(int x) { return x * 13; }
+inline int f3635_14(int x) { return x * 14; }
+inline int f3635_15(int x) { return x * 15; }
+inline int f3635_16(int x) { return x * 16; }
+inline int f3635_17(int x) { return x * 17; }
+inline int f3635_18(int x) { return x * 18; }
+inline int f3635_19(int x) { return x * 19; }
+inline int f3635_20(int x) { return x * 20; }
+inline int f3635_21(int x) { return x * 21; }
+inline int f3635_22(int x) { return x * 22; }
+inline int f3635_23(int x) { return x * 23; }
+inline int f3635_24(int x) { return x * 24; }
+inline int f3635_25(int x) { return x * 25; }
+inline int f3635_26(int x) { return x * 26; }
+inline int f3635_27(int x) { return x * 27; }
+inline int f3635_28(int x) { return x * 28; }
+inline int f3635_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3637 */
+#include <vector>
+#include "h1340.h"
+#include "h3580.h"
+#include "h8310.h"
+#include "h4087.h"
+#include "h3041.h"
+#ifdef X
+#include "h3869.h"
+#endif
+struct S3637 { int a; const char *s = "x//y"; };
+inline int f3637_0(int x) { return x * 0; }
+inline int f3637_1(int x) { return x * 1; }
+inline int f3637_2(int x) { return x * 2; }
+inline int f3637_3(int x) { return x * 3; }
+inline int f3637_4(int x) { return x * 4; }
+inline int f3637_5(int x) { return x * 5; }
+inline int f3637_6(int x) { return x * 6; }
+inline int f3637_7(int x) { return x * 7; }
+inline int f3637_8(int x) { return x * 8; }
+inline int f3637_9(int x) { return x * 9; }
+inline int f3637_10(int x) { return x * 10; }
+inline int f3637_11(int x) { return x * 11; }
+inline int f3637_12(int x) { return x * 12; }
+inline int f3637_13(int x) { return x * 13; }
+inline int f3637_14(int x) { return x * 14; }
+inline int f3637_15(int x) { return x * 15; }
+inline int f3637_16(int x) { return x * 16; }
+inline int f3637_17(int x) { return x * 17; }
+inline int f3637_18(int x) { return x * 18; }
+inline int f3637_19(int x) { return x * 19; }
+inline int f3637_20(int x) { return x * 20; }
+inline int f3637_21(int x) { return x * 21; }
+inline int f3637_22(int x) { return x * 22; }
+inline int f3637_23(int x) { return x * 23; }
+inline int f3637_24(int x) { return x * 24; }
+inline int f3637_25(int x) { return x * 25; }
+inline int f3637_26(int x) { return x * 26; }
+inline int f3637_27(int x) { return x * 27; }
+inline int f3637_28(int x) { return x * 28; }
+inline int f3637_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3641 */
+#include <vector>
+#include "h9232.h"
+#include "h467.h"
+#include "h5126.h"
+#include "h6356.h"
+#include "h6118.h"
+#ifdef X
+#include "h492.h"
+#endif
+struct S3641 { int a; const char *s = "x//y"; };
+inline int f3641_0(int x) { return x * 0; }
+inline int f3641_1(int x) { return x * 1; }
+inline int f3641_2(int x) { return x * 2; }
+inline int f3641_3(int x) { return x * 3; }
+inline int f3641_4(int x) { return x * 4; }
+inline int f3641_5(int x) { return x * 5; }
+inline int f3641_6(int x) { return x * 6; }
+inline int f3641_7(int x) { return x * 7; }
+inline int f3641_8(int x) { return x * 8; }
+inline int f3641_9(int x) { return x * 9; }
+inline int f3641_10(int x) { return x * 10; }
+inline int f3641_11(int x) { return x * 11; }
+inline int f3641_12(int x) { return x * 12; }
+inline int f3641_13(int x) { return x * 13; }
+inline int f3641_14(int x) { return x * 14; }
+inline int f3641_15(int x) { return x * 15; }
+inline int f3641_16(int x) { return x * 16; }
+inline int f3641_17(int x) { return x * 17; }
+inline int f3641_18(int x) { return x * 18; }
+inline int f3641_19(int x) { return x * 19; }
+inline int f3641_20(int x) { return x * 20; }
+inline int f3641_21(int x) { return x * 21; }
+inline int f3641_22(int x) { return x * 22; }
+inline int f3641_23(int x) { return x * 23; }
+inline int f3641_24(int x) { return x * 24; }
+inline int f3641_25(int x) { return x * 25; }
+inline int f3641_26(int x) { return x * 26; }
+inline int f3641_27(int x) { return x * 27; }
+inline int f3641_28(int x) { return x * 28; }
+inline int f3641_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3642 */
+#include <vector>
+#include "h5120.h"
+#include "h936.h"
+#include "h3454.h"
+#include "h3403.h"
+#include "h525.h"
+#ifdef X
+#include "h3816.h"
+#endif
+struct S3642 { int a; const char *s = "x//y"; };
+inline int f3642_0(int x) { return x * 0; }
+inline int f3642_1(int x) { return x * 1; }
+inline int f3642_2(int x) { return x * 2; }
+inline int f3642_3(int x) { return x * 3; }
+inline int f3642_4(int x) { return x * 4; }
+inline int f3642_5(int x) { return x * 5; }
+inline int f3642_6(int x) { return x * 6; }
+inline int f3642_7(int x) { return x * 7; }
+inline int f3642_8(int x) { return x * 8; }
+inline int f3642_9(int x) { return x * 9; }
+inline int f3642_10(int x) { return x * 10; }
+inline int f3642_11(int x) { return x * 11; }
+inline int f3642_12(int x) { return x * 12; }
+inline int f3642_13(int x) { return x * 13; }
+inline int f3642_14(int x) { return x * 14; }
+inline int f3642_15(int x) { return x * 15; }
+inline int f3642_16(int x) { return x * 16; }
+inline int f3642_17(int x) { return x * 17; }
+inline int f3642_18(int x) { return x * 18; }
+inline int f3642_19(int x) { return x * 19; }
+inline int f3642_20(int x) { return x * 20; }
+inline int f3642_21(int x) { return x * 21; }
+inline int f3642_22(int x) { return x * 22; }
+inline int f3642_23(int x) { return x * 23; }
+inline int f3642_24(int x) { return x * 24; }
+inline int f3642_25(int x) { return x * 25; }
+inline int f3642_26(int x) { return x * 26; }
+inline int f3642_27(int x) { return x * 27; }
+inline int f3642_28(int x) { return x * 28; }
+inline int f3642_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3646 */
+#include <vector>
+#include "h4190.h"
+#include "h5345.h"
+#include "h3603.h"
+#include "h7541.h"
+#include "h6272.h"
+#ifdef X
+#include "h493.h"
+#endif
+struct S3646 { int a; const char *s = "x//y"; };
+inline int f3646_0(int x) { return x * 0; }
+inline int f3646_1(int x) { return x * 1; }
+inline int f3646_2(int x) { return x * 2; }
+inline int f3646_3(int x) { return x * 3; }
+inline int f3646_4(int x) { return x * 4; }
+inline int f3646_5(int x) { return x * 5; }
+inline int f3646_6(int x) { return x * 6; }
+inline int f3646_7(int x) { return x * 7; }
+inline int f3646_8(int x) { return x * 8; }
+inline int f3646_9(int x) { return x * 9; }
+inline int f3646_10(int x) { return x * 10; }
+inline int f3646_11(int x) { return x * 11; }
+inline int f3646_12(int x) { return x * 12; }
+inline int f3646_13(int x) { return x * 13; }
+inline int f3646_14(int x) { return x * 14; }
+inline int f3646_15(int x) { return x * 15; }
+inline int f3646_16(int x) { return x * 16; }
+inline int f3646_17(int x) { return x * 17; }
+inline int f3646_18(int x) { return x * 18; }
+inline int f3646_19(int x) { return x * 19; }
+inline int f3646_20(int x) { return x * 20; }
+inline int f3646_21(int x) { return x * 21; }
+inline int f3646_22(int x) { return x * 22; }
+inline int f3646_23(int x) { return x * 23; }
+inline int f3646_24(int x) { return x * 24; }
+inline int f3646_25(int x) { return x * 25; }
+inline int f3646_26(int x) { return x * 26; }
+inline int f3646_27(int x) { return x * 27; }
+inline int f3646_28(int x) { return x * 28; }
+inline int f3646_29(int x) { return x * 29; }
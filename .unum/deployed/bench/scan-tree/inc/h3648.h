@@ -0,0 +1,42 @@
+#pragma once
+/* header 3648 */
+#include <vector>
+#include "h7390.h"
+#include "h5756.h"
+#include "h8398.h"
+#include "h4262.h"
+#include "h1978.h"
+#ifdef X
+#include "h7715.h"
+#endif
+struct S3648 { int a; const char *s = "x//y"; };
+inline int f3648_0(int x) { return x * 0; }
+inline int f3648_1(int x) { return x * 1; }
+inline int f3648_2(int x) { return x * 2; }
+inline int f3648_3(int x) { return x * 3; }
+inline int f3648_4(int x) { return x * 4; }
+inline int f3648_5(int x) { return x * 5; }
+inline int f3648_6(int x) { return x * 6; }
+inline int f3648_7(int x) { return x * 7; }
+inline int f3648_8(int x) { return x * 8; }
+inline int f3648_9(int x) { return x * 9; }
+inline int f3648_10(int x) { return x * 10; }
+inline int f3648_11(int x) { return x * 11; }
+inline int f3648_12(int x) { return x * 12; }
+inline int f3648_13(int x) { return x * 13; }
+inline int f3648_14(int x) { return x * 14; }
+inline int f3648_15(int x) { return x * 15; }
+inline int f3648_16(int x) { return x * 16; }
+inline int f3648_17(int x) { return x * 17; }
+inline int f3648_18(int x) { return x * 18; }
+inline int f3648_19(int x) { return x * 19; }
+inline int f3648_20(int x) { return x * 20; }
+inline int f3648_21(int x) { return x * 21; }
+inline int f3648_22(int x) { return x * 22; }
+inline int f3648_23(int x) { return x * 23; }
+inline int f3648_24(int x) { return x * 24; }
+inline int f3648_25(int x) { return x * 25; }
+inline int f3648_26(int x) { return x * 26; }
+inline int f3648_27(int x) { return x * 27; }
+inline int f3648_28(int x) { return x * 28; }
+inline int f3648_29(int x) { return x * 29; }
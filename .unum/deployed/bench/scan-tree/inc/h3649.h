@@ -0,0 +1,42 @@
+#pragma once
+/* header 3649 */
+#include <vector>
+#include "h769.h"
+#include "h8669.h"
+#include "h4581.h"
+#include "h8440.h"
+#include "h1075.h"
+#ifdef X
+#include "h5284.h"
+#endif
+struct S3649 { int a; const char *s = "x//y"; };
+inline int f3649_0(int x) { return x * 0; }
+inline int f3649_1(int x) { return x * 1; }
+inline int f3649_2(int x) { return x * 2; }
+inline int f3649_3(int x) { return x * 3; }
+inline int f3649_4(int x) { return x * 4; }
+inline int f3649_5(int x) { return x * 5; }
+inline int f3649_6(int x) { return x * 6; }
+inline int f3649_7(int x) { return x * 7; }
+inline int f3649_8(int x) { return x * 8; }
+inline int f3649_9(int x) { return x * 9; }
+inline int f3649_10(int x) { return x * 10; }
+inline int f3649_11(int x) { return x * 11; }
+inline int f3649_12(int x) { return x * 12; }
+inline int f3649_13(int x) { return x * 13; }
+inline int f3649_14(int x) { return x * 14; }
+inline int f3649_15(int x) { return x * 15; }
+inline int f3649_16(int x) { return x * 16; }
+inline int f3649_17(int x) { return x * 17; }
+inline int f3649_18(int x) { return x * 18; }
+inline int f3649_19(int x) { return x * 19; }
+inline int f3649_20(int x) { return x * 20; }
+inline int f3649_21(int x) { return x * 21; }
+inline int f3649_22(int x) { return x * 22; }
+inline int f3649_23(int x) { return x * 23; }
+inline int f3649_24(int x) { return x * 24; }
+inline int f3649_25(int x) { return x * 25; }
+inline int f3649_26(int x) { return x * 26; }
+inline int f3649_27(int x) { return x * 27; }
+inline int f3649_28(int x) { return x * 28; }
+inline int f3649_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3650 */
+#include <vector>
+#include "h1569.h"
+#include "h510.h"
+#include "h6378.h"
+#include "h4973.h"
+#include "h587.h"
+#ifdef X
+#include "h7263.h"
+#endif
+struct S3650 { int a; const char *s = "x//y"; };
+inline int f3650_0(int x) { return x * 0; }
+inline int f3650_1(int x) { return x * 1; }
+inline int f3650_2(int x) { return x * 2; }
+inline int f3650_3(int x) { return x * 3; }
+inline int f3650_4(int x) { return x * 4; }
+inline int f3650_5(int x) { return x * 5; }
+inline int f3650_6(int x) { return x * 6; }
+inline int f3650_7(int x) { return x * 7; }
+inline int f3650_8(int x) { return x * 8; }
+inline int f3650_9(int x) { return x * 9; }
+inline int f3650_10(int x) { return x * 10; }
+inline int f3650_11(int x) { return x * 11; }
+inline int f3650_12(int x) { return x * 12; }
+inline int f3650_13(int x) { return x * 13; }
+inline int f3650_14(int x) { return x * 14; }
+inline int f3650_15(int x) { return x * 15; }
+inline int f3650_16(int x) { return x * 16; }
+inline int f3650_17(int x) { return x * 17; }
+inline int f3650_18(int x) { return x * 18; }
+inline int f3650_19(int x) { return x * 19; }
+inline int f3650_20(int x) { return x * 20; }
+inline int f3650_21(int x) { return x * 21; }
+inline int f3650_22(int x) { return x * 22; }
+inline int f3650_23(int x) { return x * 23; }
+inline int f3650_24(int x) { return x * 24; }
+inline int f3650_25(int x) { return x * 25; }
+inline int f3650_26(int x) { return x * 26; }
+inline int f3650_27(int x) { return x * 27; }
+inline int f3650_28(int x) { return x * 28; }
+inline int f3650_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3652 */
+#include <vector>
+#include "h1866.h"
+#include "h3620.h"
+#include "h323.h"
+#include "h8177.h"
+#include "h2830.h"
+#ifdef X
+#include "h4083.h"
+#endif
+struct S3652 { int a; const char *s = "x//y"; };
+inline int f3652_0(int x) { return x * 0; }
+inline int f3652_1(int x) { return x * 1; }
+inline int f3652_2(int x) { return x * 2; }
+inline int f3652_3(int x) { return x * 3; }
+inline int f3652_4(int x) { return x * 4; }
+inline int f3652_5(int x) { return x * 5; }
+inline int f3652_6(int x) { return x * 6; }
+inline int f3652_7(int x) { return x * 7; }
+inline int f3652_8(int x) { return x * 8; }
+inline int f3652_9(int x) { return x * 9; }
+inline int f3652_10(int x) { return x * 10; }
+inline int f3652_11(int x) { return x * 11; }
+inline int f3652_12(int x) { return x * 12; }
+inline int f3652_13(int x) { return x * 13; }
+inline int f3652_14(int x) { return x * 14; }
+inline int f3652_15(int x) { return x * 15; }
+inline int f3652_16(int x) { return x * 16; }
+inline int f3652_17(int x) { return x * 17; }
+inline int f3652_18(int x) { return x * 18; }
+inline int f3652_19(int x) { return x * 19; }
+inline int f3652_20(int x) { return x * 20; }
+inline int f3652_21(int x) { return x * 21; }
+inline int f3652_22(int x) { return x * 22; }
+inline int f3652_23(int x) { return x * 23; }
+inline int f3652_24(int x) { return x * 24; }
+inline int f3652_25(int x) { return x * 25; }
+inline int f3652_26(int x) { return x * 26; }
+inline int f3652_27(int x) { return x * 27; }
+inline int f3652_28(int x) { return x * 28; }
+inline int f3652_29(int x) { return x * 29; }
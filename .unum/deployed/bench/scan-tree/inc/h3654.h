@@ -0,0 +1,42 @@
+#pragma once
+/* header 3654 */
+#include <vector>
+#include "h7937.h"
+#include "h6874.h"
+#include "h5668.h"
+#include "h8486.h"
+#include "h926.h"
+#ifdef X
+#include "h6297.h"
+#endif
+struct S3654 { int a; const char *s = "x//y"; };
+inline int f3654_0(int x) { return x * 0; }
+inline int f3654_1(int x) { return x * 1; }
+inline int f3654_2(int x) { return x * 2; }
+inline int f3654_3(int x) { return x * 3; }
+inline int f3654_4(int x) { return x * 4; }
+inline int f3654_5(int x) { return x * 5; }
+inline int f3654_6(int x) { return x * 6; }
+inline int f3654_7(int x) { return x * 7; }
+inline int f3654_8(int x) { return x * 8; }
+inline int f3654_9(int x) { return x * 9; }
+inline int f3654_10(int x) { return x * 10; }
+inline int f3654_11(int x) { return x * 11; }
+inline int f3654_12(int x) { return x * 12; }
+inline int f3654_13(int x) { return x * 13; }
+inline int f3654_14(int x) { return x * 14; }
+inline int f3654_15(int x) { return x * 15; }
+inline int f3654_16(int x) { return x * 16; }
+inline int f3654_17(int x) { return x * 17; }
+inline int f3654_18(int x) { return x * 18; }
+inline int f3654_19(int x) { return x * 19; }
+inline int f3654_20(int x) { return x * 20; }
+inline int f3654_21(int x) { return x * 21; }
+inline int f3654_22(int x) { return x * 22; }
+inline int f3654_23(int x) { return x * 23; }
+inline int f3654_24(int x) { return x * 24; }
+inline int f3654_25(int x) { return x * 25; }
+inline int f3654_26(int x) { return x * 26; }
+inline int f3654_27(int x) { return x * 27; }
+inline int f3654_28(int x) { return x * 28; }
+inline int f3654_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3656 */
+#include <vector>
+#include "h7124.h"
+#include "h7390.h"
+#include "h7232.h"
+#include "h8043.h"
+#include "h6633.h"
+#ifdef X
+#include "h9858.h"
+#endif
+struct S3656 { int a; const char *s = "x//y"; };
+inline int f3656_0(int x) { return x * 0; }
+inline int f3656_1(int x) { return x * 1; }
+inline int f3656_2(int x) { return x * 2; }
+inline int f3656_3(int x) { return x * 3; }
+inline int f3656_4(int x) { return x * 4; }
+inline int f3656_5(int x) { return x * 5; }
+inline int f3656_6(int x) { return x * 6; }
+inline int f3656_7(int x) { return x * 7; }
+inline int f3656_8(int x) { return x * 8; }
+inline int f3656_9(int x) { return x * 9; }
+inline int f3656_10(int x) { return x * 10; }
+inline int f3656_11(int x) { return x * 11; }
+inline int f3656_12(int x) { return x * 12; }
+inline int f3656_13(int x) { return x * 13; }
+inline int f3656_14(int x) { return x * 14; }
+inline int f3656_15(int x) { return x * 15; }
+inline int f3656_16(int x) { return x * 16; }
+inline int f3656_17(int x) { return x * 17; }
+inline int f3656_18(int x) { return x * 18; }
+inline int f3656_19(int x) { return x * 19; }
+inline int f3656_20(int x) { return x * 20; }
+inline int f3656_21(int x) { return x * 21; }
+inline int f3656_22(int x) { return x * 22; }
+inline int f3656_23(int x) { return x * 23; }
+inline int f3656_24(int x) { return x * 24; }
+inline int f3656_25(int x) { return x * 25; }
+inline int f3656_26(int x) { return x * 26; }
+inline int f3656_27(int x) { return x * 27; }
+inline int f3656_28(int x) { return x * 28; }
+inline int f3656_29(int x) { return x * 29; }
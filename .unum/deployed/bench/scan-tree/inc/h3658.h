@@ -0,0 +1,42 @@
+#pragma once
+/* header 3658 */
+#include <vector>
+#include "h5372.h"
+#include "h1434.h"
+#include "h1104.h"
+#include "h456.h"
+#include "h8827.h"
+#ifdef X
+#include "h3916.h"
+#endif
+struct S3658 { int a; const char *s = "x//y"; };
+inline int f3658_0(int x) { return x * 0; }
+inline int f3658_1(int x) { return x * 1; }
+inline int f3658_2(int x) { return x * 2; }
+inline int f3658_3(int x) { return x * 3; }
+inline int f3658_4(int x) { return x * 4; }
+inline int f3658_5(int x) { return x * 5; }
+inline int f3658_6(int x) { return x * 6; }
+inline int f3658_7(int x) { return x * 7; }
+inline int f3658_8(int x) { return x * 8; }
+inline int f3658_9(int x) { return x * 9; }
+inline int f3658_10(int x) { return x * 10; }
+inline int f3658_11(int x) { return x * 11; }
+inline int f3658_12(int x) { return x * 12; }
+inline int f3658_13(int x) { return x * 13; }
+inline int f3658_14(int x) { return x * 14; }
+inline int f3658_15(int x) { return x * 15; }
+inline int f3658_16(int x) { return x * 16; }
+inline int f3658_17(int x) { return x * 17; }
+inline int f3658_18(int x) { return x * 18; }
+inline int f3658_19(int x) { return x * 19; }
+inline int f3658_20(int x) { return x * 20; }
+inline int f3658_21(int x) { return x * 21; }
+inline int f3658_22(int x) { return x * 22; }
+inline int f3658_23(int x) { return x * 23; }
+inline int f3658_24(int x) { return x * 24; }
+inline int f3658_25(int x) { return x * 25; }
+inline int f3658_26(int x) { return x * 26; }
+inline int f3658_27(int x) { return x * 27; }
+inline int f3658_28(int x) { return x * 28; }
+inline int f3658_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3659 */
+#include <vector>
+#include "h1996.h"
+#include "h3965.h"
+#include "h2400.h"
+#include "h3653.h"
+#include "h2290.h"
+#ifdef X
+#include "h8414.h"
+#endif
+struct S3659 { int a; const char *s = "x//y"; };
+inline int f3659_0(int x) { return x * 0; }
+inline int f3659_1(int x) { return x * 1; }
+inline int f3659_2(int x) { return x * 2; }
+inline int f3659_3(int x) { return x * 3; }
+inline int f3659_4(int x) { return x * 4; }
+inline int f3659_5(int x) { return x * 5; }
+inline int f3659_6(int x) { return x * 6; }
+inline int f3659_7(int x) { return x * 7; }
+inline int f3659_8(int x) { return x * 8; }
+inline int f3659_9(int x) { return x * 9; }
+inline int f3659_10(int x) { return x * 10; }
+inline int f3659_11(int x) { return x * 11; }
+inline int f3659_12(int x) { return x * 12; }
+inline int f3659_13(int x) { return x * 13; }
+inline int f3659_14(int x) { return x * 14; }
+inline int f3659_15(int x) { return x * 15; }
+inline int f3659_16(int x) { return x * 16; }
+inline int f3659_17(int x) { return x * 17; }
+inline int f3659_18(int x) { return x * 18; }
+inline int f3659_19(int x) { return x * 19; }
+inline int f3659_20(int x) { return x * 20; }
+inline int f3659_21(int x) { return x * 21; }
+inline int f3659_22(int x) { return x * 22; }
+inline int f3659_23(int x) { return x * 23; }
+inline int f3659_24(int x) { return x * 24; }
+inline int f3659_25(int x) { return x * 25; }
+inline int f3659_26(int x) { return x * 26; }
+inline int f3659_27(int x) { return x * 27; }
+inline int f3659_28(int x) { return x * 28; }
+inline int f3659_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3662 */
+#include <vector>
+#include "h800.h"
+#include "h2316.h"
+#include "h7014.h"
+#include "h8193.h"
+#include "h330.h"
+#ifdef X
+#include "h8372.h"
+#endif
+struct S3662 { int a; const char *s = "x//y"; };
+inline int f3662_0(int x) { return x * 0; }
+inline int f3662_1(int x) { return x * 1; }
+inline int f3662_2(int x) { return x * 2; }
+inline int f3662_3(int x) { return x * 3; }
+inline int f3662_4(int x) { return x * 4; }
+inline int f3662_5(int x) { return x * 5; }
+inline int f3662_6(int x) { return x * 6; }
+inline int f3662_7(int x) { return x * 7; }
+inline int f3662_8(int x) { return x * 8; }
+inline int f3662_9(int x) { return x * 9; }
+inline int f3662_10(int x) { return x * 10; }
+inline int f3662_11(int x) { return x * 11; }
+inline int f3662_12(int x) { return x * 12; }
+inline int f3662_13(int x) { return x * 13; }
+inline int f3662_14(int x) { return x * 14; }
+inline int f3662_15(int x) { return x * 15; }
+inline int f3662_16(int x) { return x * 16; }
+inline int f3662_17(int x) { return x * 17; }
+inline int f3662_18(int x) { return x * 18; }
+inline int f3662_19(int x) { return x * 19; }
+inline int f3662_20(int x) { return x * 20; }
+inline int f3662_21(int x) { return x * 21; }
+inline int f3662_22(int x) { return x * 22; }
+inline int f3662_23(int x) { return x * 23; }
+inline int f3662_24(int x) { return x * 24; }
+inline int f3662_25(int x) { return x * 25; }
+inline int f3662_26(int x) { return x * 26; }
+inline int f3662_27(int x) { return x * 27; }
+inline int f3662_28(int x) { return x * 28; }
+inline int f3662_29(int x) { return x * 29; }
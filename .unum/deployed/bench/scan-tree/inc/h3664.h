@@ -0,0 +1,42 @@
+#pragma once
+/* header 3664 */
+#include <vector>
+#include "h8624.h"
+#include "h2611.h"
+#include "h2896.h"
+#include "h6952.h"
+#include "h4930.h"
+#ifdef X
+#include "h4715.h"
+#endif
+struct S3664 { int a; const char *s = "x//y"; };
+inline int f3664_0(int x) { return x * 0; }
+inline int f3664_1(int x) { return x * 1; }
+inline int f3664_2(int x) { return x * 2; }
+inline int f3664_3(int x) { return x * 3; }
+inline int f3664_4(int x) { return x * 4; }
+inline int f3664_5(int x) { return x * 5; }
+inline int f3664_6(int x) { return x * 6; }
+inline int f3664_7(int x) { return x * 7; }
+inline int f3664_8(int x) { return x * 8; }
+inline int f3664_9(int x) { return x * 9; }
+inline int f3664_10(int x) { return x * 10; }
+inline int f3664_11(int x) { return x * 11; }
+inline int f3664_12(int x) { return x * 12; }
+inline int f3664_13(int x) { return x * 13; }
+inline int f3664_14(int x) { return x * 14; }
+inline int f3664_15(int x) { return x * 15; }
+inline int f3664_16(int x) { return x * 16; }
+inline int f3664_17(int x) { return x * 17; }
+inline int f3664_18(int x) { return x * 18; }
+inline int f3664_19(int x) { return x * 19; }
+inline int f3664_20(int x) { return x * 20; }
+inline int f3664_21(int x) { return x * 21; }
+inline int f3664_22(int x) { return x * 22; }
+inline int f3664_23(int x) { return x * 23; }
+inline int f3664_24(int x) { return x * 24; }
+inline int f3664_25(int x) { return x * 25; }
+inline int f3664_26(int x) { return x * 26; }
+inline int f3664_27(int x) { return x * 27; }
+inline int f3664_28(int x) { return x * 28; }
+inline int f3664_29(int x) { return x * 29; }
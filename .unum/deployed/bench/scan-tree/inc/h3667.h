@@ -0,0 +1,42 @@
+#pragma once
+/* header 3667 */
+#include <vector>
+#include "h2635.h"
+#include "h5953.h"
+#include "h4712.h"
+#include "h535.h"
+#include "h223.h"
+#ifdef X
+#include "h4554.h"
+#endif
+struct S3667 { int a; const char *s = "x//y"; };
+inline int f3667_0(int x) { return x * 0; }
+inline int f3667_1(int x) { return x * 1; }
+inline int f3667_2(int x) { return x * 2; }
+inline int f3667_3(int x) { return x * 3; }
+inline int f3667_4(int x) { return x * 4; }
+inline int f3667_5(int x) { return x * 5; }
+inline int f3667_6(int x) { return x * 6; }
+inline int f3667_7(int x) { return x * 7; }
+inline int f3667_8(int x) { return x * 8; }
+inline int f3667_9(int x) { return x * 9; }
+inline int f3667_10(int x) { return x * 10; }
+inline int f3667_11(int x) { return x * 11; }
+inline int f3667_12(int x) { return x * 12; }
+inline int f3667_13(int x) { return x * 13; }
+inline int f3667_14(int x) { return x * 14; }
+inline int f3667_15(int x) { return x * 15; }
+inline int f3667_16(int x) { return x * 16; }
+inline int f3667_17(int x) { return x * 17; }
+inline int f3667_18(int x) { return x * 18; }
+inline int f3667_19(int x) { return x * 19; }
+inline int f3667_20(int x) { return x * 20; }
+inline int f3667_21(int x) { return x * 21; }
+inline int f3667_22(int x) { return x * 22; }
+inline int f3667_23(int x) { return x * 23; }
+inline int f3667_24(int x) { return x * 24; }
+inline int f3667_25(int x) { return x * 25; }
+inline int f3667_26(int x) { return x * 26; }
+inline int f3667_27(int x) { return x * 27; }
+inline int f3667_28(int x) { return x * 28; }
+inline int f3667_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3670 */
+#include <vector>
+#include "h8380.h"
+#include "h835.h"
+#include "h8223.h"
+#include "h6844.h"
+#include "h6619.h"
+#ifdef X
+#include "h1742.h"
+#endif
+struct S3670 { int a; const char *s = "x//y"; };
+inline int f3670_0(int x) { return x * 0; }
+inline int f3670_1(int x) { return x * 1; }
+inline int f3670_2(int x) { return x * 2; }
+inline int f3670_3(int x) { return x * 3; }
+inline int f3670_4(int x) { return x * 4; }
+inline int f3670_5(int x) { return x * 5; }
+inline int f3670_6(int x) { return x * 6; }
+inline int f3670_7(int x) { return x * 7; }
+inline int f3670_8(int x) { return x * 8; }
+inline int f3670_9(int x) { return x * 9; }
+inline int f3670_10(int x) { return x * 10; }
+inline int f3670_11(int x) { return x * 11; }
+inline int f3670_12(int x) { return x * 12; }
+inline int f3670_13(int x) { return x * 13; }
+inline int f3670_14(int x) { return x * 14; }
+inline int f3670_15(int x) { return x * 15; }
+inline int f3670_16(int x) { return x * 16; }
+inline int f3670_17(int x) { return x * 17; }
+inline int f3670_18(int x) { return x * 18; }
+inline int f3670_19(int x) { return x * 19; }
+inline int f3670_20(int x) { return x * 20; }
+inline int f3670_21(int x) { return x * 21; }
+inline int f3670_22(int x) { return x * 22; }
+inline int f3670_23(int x) { return x * 23; }
+inline int f3670_24(int x) { return x * 24; }
+inline int f3670_25(int x) { return x * 25; }
+inline int f3670_26(int x) { return x * 26; }
+inline int f3670_27(int x) { return x * 27; }
+inline int f3670_28(int x) { return x * 28; }
+inline int f3670_29(int x) { return x * 29; }
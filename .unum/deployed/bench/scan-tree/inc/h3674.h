@@ -0,0 +1,42 @@
+#pragma once
+/* header 3674 */
+#include <vector>
+#include "h2337.h"
+#include "h4017.h"
+#include "h8610.h"
+#include "h4991.h"
+#include "h1738.h"
+#ifdef X
+#include "h8494.h"
+#endif
+struct S3674 { int a; const char *s = "x//y"; };
+inline int f3674_0(int x) { return x * 0; }
+inline int f3674_1(int x) { return x * 1; }
+inline int f3674_2(int x) { return x * 2; }
+inline int f3674_3(int x) { return x * 3; }
+inline int f3674_4(int x) { return x * 4; }
+inline int f3674_5(int x) { return x * 5; }
+inline int f3674_6(int x) { return x * 6; }
+inline int f3674_7(int x) { return x * 7; }
+inline int f3674_8(int x) { return x * 8; }
+inline int f3674_9(int x) { return x * 9; }
+inline int f3674_10(int x) { return x * 10; }
+inline int f3674_11(int x) { return x * 11; }
+inline int f3674_12(int x) { return x * 12; }
+inline int f3674_13(int x) { return x * 13; }
+inline int f3674_14(int x) { return x * 14; }
+inline int f3674_15(int x) { return x * 15; }
+inline int f3674_16(int x) { return x * 16; }
+inline int f3674_17(int x) { return x * 17; }
+inline int f3674_18(int x) { return x * 18; }
+inline int f3674_19(int x) { return x * 19; }
+inline int f3674_20(int x) { return x * 20; }
+inline int f3674_21(int x) { return x * 21; }
+inline int f3674_22(int x) { return x * 22; }
+inline int f3674_23(int x) { return x * 23; }
+inline int f3674_24(int x) { return x * 24; }
+inline int f3674_25(int x) { return x * 25; }
+inline int f3674_26(int x) { return x * 26; }
+inline int f3674_27(int x) { return x * 27; }
+inline int f3674_28(int x) { return x * 28; }
+inline int f3674_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3676 */
+#include <vector>
+#include "h1384.h"
+#include "h957.h"
+#include "h7313.h"
+#include "h9078.h"
+#include "h6169.h"
+#ifdef X
+#include "h1149.h"
+#endif
+struct S3676 { int a; const char *s = "x//y"; };
+inline int f3676_0(int x) { return x * 0; }
+inline int f3676_1(int x) { return x * 1; }
+inline int f3676_2(int x) { return x * 2; }
+inline int f3676_3(int x) { return x * 3; }
+inline int f3676_4(int x) { return x * 4; }
+inline int f3676_5(int x) { return x * 5; }
+inline int f3676_6(int x) { return x * 6; }
+inline int f3676_7(int x) { return x * 7; }
+inline int f3676_8(int x) { return x * 8; }
+inline int f3676_9(int x) { return x * 9; }
+inline int f3676_10(int x) { return x * 10; }
+inline int f3676_11(int x) { return x * 11; }
+inline int f3676_12(int x) { return x * 12; }
+inline int f3676_13(int x) { return x * 13; }
+inline int f3676_14(int x) { return x * 14; }
+inline int f3676_15(int x) { return x * 15; }
+inline int f3676_16(int x) { return x * 16; }
+inline int f3676_17(int x) { return x * 17; }
+inline int f3676_18(int x) { return x * 18; }
+inline int f3676_19(int x) { return x * 19; }
+inline int f3676_20(int x) { return x * 20; }
+inline int f3676_21(int x) { return x * 21; }
+inline int f3676_22(int x) { return x * 22; }
+inline int f3676_23(int x) { return x * 23; }
+inline int f3676_24(int x) { return x * 24; }
+inline int f3676_25(int x) { return x * 25; }
+inline int f3676_26(int x) { return x * 26; }
+inline int f3676_27(int x) { return x * 27; }
+inline int f3676_28(int x) { return x * 28; }
+inline int f3676_29(int x) { return x * 29; }
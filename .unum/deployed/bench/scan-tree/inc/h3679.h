@@ -0,0 +1,42 @@
+#pragma once
+/* header 3679 */
+#include <vector>
+#include "h875.h"
+#include "h545.h"
+#include "h3440.h"
+#include "h781.h"
+#include "h5599.h"
+#ifdef X
+#include "h130.h"
+#endif
+struct S3679 { int a; const char *s = "x//y"; };
+inline int f3679_0(int x) { return x * 0; }
+inline int f3679_1(int x) { return x * 1; }
+inline int f3679_2(int x) { return x * 2; }
+inline int f3679_3(int x) { return x * 3; }
+inline int f3679_4(int x) { return x * 4; }
+inline int f3679_5(int x) { return x * 5; }
+inline int f3679_6(int x) { return x * 6; }
+inline int f3679_7(int x) { return x * 7; }
+inline int f3679_8(int x) { return x * 8; }
+inline int f3679_9(int x) { return x * 9; }
+inline int f3679_10(int x) { return x * 10; }
+inline int f3679_11(int x) { return x * 11; }
+inline int f3679_12(int x) { return x * 12; }
+inline int f3679_13(int x) { return x * 13; }
+inline int f3679_14(int x) { return x * 14; }
+inline int f3679_15(int x) { return x * 15; }
+inline int f3679_16(int x) { return x * 16; }
+inline int f3679_17(int x) { return x * 17; }
+inline int f3679_18(int x) { return x * 18; }
+inline int f3679_19(int x) { return x * 19; }
+inline int f3679_20(int x) { return x * 20; }
+inline int f3679_21(int x) { return x * 21; }
+inline int f3679_22(int x) { return x * 22; }
+inline int f3679_23(int x) { return x * 23; }
+inline int f3679_24(int x) { return x * 24; }
+inline int f3679_25(int x) { return x * 25; }
+inline int f3679_26(int x) { return x * 26; }
+inline int f3679_27(int x) { return x * 27; }
+inline int f3679_28(int x) { return x * 28; }
+inline int f3679_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3684 */
+#include <vector>
+#include "h2685.h"
+#include "h3620.h"
+#include "h8186.h"
+#include "h3972.h"
+#include "h8709.h"
+#ifdef X
+#include "h6172.h"
+#endif
+struct S3684 { int a; const char *s = "x//y"; };
+inline int f3684_0(int x) { return x * 0; }
+inline int f3684_1(int x) { return x * 1; }
+inline int f3684_2(int x) { return x * 2; }
+inline int f3684_3(int x) { return x * 3; }
+inline int f3684_4(int x) { return x * 4; }
+inline int f3684_5(int x) { return x * 5; }
+inline int f3684_6(int x) { return x * 6; }
+inline int f3684_7(int x) { return x * 7; }
+inline int f3684_8(int x) { return x * 8; }
+inline int f3684_9(int x) { return x * 9; }
+inline int f3684_10(int x) { return x * 10; }
+inline int f3684_11(int x) { return x * 11; }
+inline int f3684_12(int x) { return x * 12; }
+inline int f3684_13(int x) { return x * 13; }
+inline int f3684_14(int x) { return x * 14; }
+inline int f3684_15(int x) { return x * 15; }
+inline int f3684_16(int x) { return x * 16; }
+inline int f3684_17(int x) { return x * 17; }
+inline int f3684_18(int x) { return x * 18; }
+inline int f3684_19(int x) { return x * 19; }
+inline int f3684_20(int x) { return x * 20; }
+inline int f3684_21(int x) { return x * 21; }
+inline int f3684_22(int x) { return x * 22; }
+inline int f3684_23(int x) { return x * 23; }
+inline int f3684_24(int x) { return x * 24; }
+inline int f3684_25(int x) { return x * 25; }
+inline int f3684_26(int x) { return x * 26; }
+inline int f3684_27(int x) { return x * 27; }
+inline int f3684_28(int x) { return x * 28; }
+inline int f3684_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3687 */
+#include <vector>
+#include "h6800.h"
+#include "h7010.h"
+#include "h2260.h"
+#include "h807.h"
+#include "h8263.h"
+#ifdef X
+#include "h3853.h"
+#endif
+struct S3687 { int a; const char *s = "x//y"; };
+inline int f3687_0(int x) { return x * 0; }
+inline int f3687_1(int x) { return x * 1; }
+inline int f3687_2(int x) { return x * 2; }
+inline int f3687_3(int x) { return x * 3; }
+inline int f3687_4(int x) { return x * 4; }
+inline int f3687_5(int x) { return x * 5; }
+inline int f3687_6(int x) { return x * 6; }
+inline int f3687_7(int x) { return x * 7; }
+inline int f3687_8(int x) { return x * 8; }
+inline int f3687_9(int x) { return x * 9; }
+inline int f3687_10(int x) { return x * 10; }
+inline int f3687_11(int x) { return x * 11; }
+inline int f3687_12(int x) { return x * 12; }
+inline int f3687_13(int x) { return x * 13; }
+inline int f3687_14(int x) { return x * 14; }
+inline int f3687_15(int x) { return x * 15; }
+inline int f3687_16(int x) { return x * 16; }
+inline int f3687_17(int x) { return x * 17; }
+inline int f3687_18(int x) { return x * 18; }
+inline int f3687_19(int x) { return x * 19; }
+inline int f3687_20(int x) { return x * 20; }
+inline int f3687_21(int x) { return x * 21; }
+inline int f3687_22(int x) { return x * 22; }
+inline int f3687_23(int x) { return x * 23; }
+inline int f3687_24(int x) { return x * 24; }
+inline int f3687_25(int x) { return x * 25; }
+inline int f3687_26(int x) { return x * 26; }
+inline int f3687_27(int x) { return x * 27; }
+inline int f3687_28(int x) { return x * 28; }
+inline int f3687_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3689 */
+#include <vector>
+#include "h3519.h"
+#include "h9729.h"
+#include "h4482.h"
+#include "h3289.h"
+#include "h154.h"
+#ifdef X
+#include "h8445.h"
+#endif
+struct S3689 { int a; const char *s = "x//y"; };
+inline int f3689_0(int x) { return x * 0; }
+inline int f3689_1(int x) { return x * 1; }
+inline int f3689_2(int x) { return x * 2; }
+inline int f3689_3(int x) { return x * 3; }
+inline int f3689_4(int x) { return x * 4; }
+inline int f3689_5(int x) { return x * 5; }
+inline int f3689_6(int x) { return x * 6; }
+inline int f3689_7(int x) { return x * 7; }
+inline int f3689_8(int x) { return x * 8; }
+inline int f3689_9(int x) { return x * 9; }
+inline int f3689_10(int x) { return x * 10; }
+inline int f3689_11(int x) { return x * 11; }
+inline int f3689_12(int x) { return x * 12; }
+inline int f3689_13(int x) { return x * 13; }
+inline int f3689_14(int x) { return x * 14; }
+inline int f3689_15(int x) { return x * 15; }
+inline int f3689_16(int x) { return x * 16; }
+inline int f3689_17(int x) { return x * 17; }
+inline int f3689_18(int x) { return x * 18; }
+inline int f3689_19(int x) { return x * 19; }
+inline int f3689_20(int x) { return x * 20; }
+inline int f3689_21(int x) { return x * 21; }
+inline int f3689_22(int x) { return x * 22; }
+inline int f3689_23(int x) { return x * 23; }
+inline int f3689_24(int x) { return x * 24; }
+inline int f3689_25(int x) { return x * 25; }
+inline int f3689_26(int x) { return x * 26; }
+inline int f3689_27(int x) { return x * 27; }
+inline int f3689_28(int x) { return x * 28; }
+inline int f3689_29(int x) { return x * 29; }
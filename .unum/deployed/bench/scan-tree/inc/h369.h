@@ -0,0 +1,42 @@
+#pragma once
+/* header 369 */
+#include <vector>
+#include "h2517.h"
+#include "h818.h"
+#include "h7710.h"
+#include "h1377.h"
+#include "h3717.h"
+#ifdef X
+#include "h3416.h"
+#endif
+struct S369 { int a; const char *s = "x//y"; };
+inline int f369_0(int x) { return x * 0; }
+inline int f369_1(int x) { return x * 1; }
+inline int f369_2(int x) { return x * 2; }
+inline int f369_3(int x) { return x * 3; }
+inline int f369_4(int x) { return x * 4; }
+inline int f369_5(int x) { return x * 5; }
+inline int f369_6(int x) { return x * 6; }
+inline int f369_7(int x) { return x * 7; }
+inline int f369_8(int x) { return x * 8; }
+inline int f369_9(int x) { return x * 9; }
+inline int f369_10(int x) { return x * 10; }
+inline int f369_11(int x) { return x * 11; }
+inline int f369_12(int x) { return x * 12; }
+inline int f369_13(int x) { return x * 13; }
+inline int f369_14(int x) { return x * 14; }
+inline int f369_15(int x) { return x * 15; }
+inline int f369_16(int x) { return x * 16; }
+inline int f369_17(int x) { return x * 17; }
+inline int f369_18(int x) { return x * 18; }
+inline int f369_19(int x) { return x * 19; }
+inline int f369_20(int x) { return x * 20; }
+inline int f369_21(int x) { return x * 21; }
+inline int f369_22(int x) { return x * 22; }
+inline int f369_23(int x) { return x * 23; }
+inline int f369_24(int x) { return x * 24; }
+inline int f369_25(int x) { return x * 25; }
+inline int f369_26(int x) { return x * 26; }
+inline int f369_27(int x) { return x * 27; }
+inline int f369_28(int x) { return x * 28; }
+inline int f369_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3691 */
+#include <vector>
+#include "h3444.h"
+#include "h7348.h"
+#include "h3922.h"
+#include "h4862.h"
+#include "h8700.h"
+#ifdef X
+#include "h5283.h"
+#endif
+struct S3691 { int a; const char *s = "x//y"; };
+inline int f3691_0(int x) { return x * 0; }
+inline int f3691_1(int x) { return x * 1; }
+inline int f3691_2(int x) { return x * 2; }
+inline int f3691_3(int x) { return x * 3; }
+inline int f3691_4(int x) { return x * 4; }
+inline int f3691_5(int x) { return x * 5; }
+inline int f3691_6(int x) { return x * 6; }
+inline int f3691_7(int x) { return x * 7; }
+inline int f3691_8(int x) { return x * 8; }
+inline int f3691_9(int x) { return x * 9; }
+inline int f3691_10(int x) { return x * 10; }
+inline int f3691_11(int x) { return x * 11; }
+inline int f3691_12(int x) { return x * 12; }
+inline int f3691_13(int x) { return x * 13; }
+inline int f3691_14(int x) { return x * 14; }
+inline int f3691_15(int x) { return x * 15; }
+inline int f3691_16(int x) { return x * 16; }
+inline int f3691_17(int x) { return x * 17; }
+inline int f3691_18(int x) { return x * 18; }
+inline int f3691_19(int x) { return x * 19; }
+inline int f3691_20(int x) { return x * 20; }
+inline int f3691_21(int x) { return x * 21; }
+inline int f3691_22(int x) { return x * 22; }
+inline int f3691_23(int x) { return x * 23; }
+inline int f3691_24(int x) { return x * 24; }
+inline int f3691_25(int x) { return x * 25; }
+inline int f3691_26(int x) { return x * 26; }
+inline int f3691_27(int x) { return x * 27; }
+inline int f3691_28(int x) { return x * 28; }
+inline int f3691_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3693 */
+#include <vector>
+#include "h7966.h"
+#include "h6767.h"
+#include "h6702.h"
+#include "h4883.h"
+#include "h9829.h"
+#ifdef X
+#include "h8944.h"
+#endif
+struct S3693 { int a; const char *s = "x//y"; };
+inline int f3693_0(int x) { return x * 0; }
+inline int f3693_1(int x) { return x * 1; }
+inline int f3693_2(int x) { return x * 2; }
+inline int f3693_3(int x) { return x * 3; }
+inline int f3693_4(int x) { return x * 4; }
+inline int f3693_5(int x) { return x * 5; }
+inline int f3693_6(int x) { return x * 6; }
+inline int f3693_7(int x) { return x * 7; }
+inline int f3693_8(int x) { return x * 8; }
+inline int f3693_9(int x) { return x * 9; }
+inline int f3693_10(int x) { return x * 10; }
+inline int f3693_11(int x) { return x * 11; }
+inline int f3693_12(int x) { return x * 12; }
+inline int f3693_13(int x) { return x * 13; }
+inline int f3693_14(int x) { return x * 14; }
+inline int f3693_15(int x) { return x * 15; }
+inline int f3693_16(int x) { return x * 16; }
+inline int f3693_17(int x) { return x * 17; }
+inline int f3693_18(int x) { return x * 18; }
+inline int f3693_19(int x) { return x * 19; }
+inline int f3693_20(int x) { return x * 20; }
+inline int f3693_21(int x) { return x * 21; }
+inline int f3693_22(int x) { return x * 22; }
+inline int f3693_23(int x) { return x * 23; }
+inline int f3693_24(int x) { return x * 24; }
+inline int f3693_25(int x) { return x * 25; }
+inline int f3693_26(int x) { return x * 26; }
+inline int f3693_27(int x) { return x * 27; }
+inline int f3693_28(int x) { return x * 28; }
+inline int f3693_29(int x) { return x * 29; }
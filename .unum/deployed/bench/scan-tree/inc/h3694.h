@@ -0,0 +1,42 @@
+#pragma once
+/* header 3694 */
+#include <vector>
+#include "h6122.h"
+#include "h7770.h"
+#include "h8301.h"
+#include "h2065.h"
+#include "h9463.h"
+#ifdef X
+#include "h513.h"
+#endif
+struct S3694 { int a; const char *s = "x//y"; };
+inline int f3694_0(int x) { return x * 0; }
+inline int f3694_1(int x) { return x * 1; }
+inline int f3694_2(int x) { return x * 2; }
+inline int f3694_3(int x) { return x * 3; }
+inline int f3694_4(int x) { return x * 4; }
+inline int f3694_5(int x) { return x * 5; }
+inline int f3694_6(int x) { return x * 6; }
+inline int f3694_7(int x) { return x * 7; }
+inline int f3694_8(int x) { return x * 8; }
+inline int f3694_9(int x) { return x * 9; }
+inline int f3694_10(int x) { return x * 10; }
+inline int f3694_11(int x) { return x * 11; }
+inline int f3694_12(int x) { return x * 12; }
+inline int f3694_13(int x) { return x * 13; }
+inline int f3694_14(int x) { return x * 14; }
+inline int f3694_15(int x) { return x * 15; }
+inline int f3694_16(int x) { return x * 16; }
+inline int f3694_17(int x) { return x * 17; }
+inline int f3694_18(int x) { return x * 18; }
+inline int f3694_19(int x) { return x * 19; }
+inline int f3694_20(int x) { return x * 20; }
+inline int f3694_21(int x) { return x * 21; }
+inline int f3694_22(int x) { return x * 22; }
+inline int f3694_23(int x) { return x * 23; }
+inline int f3694_24(int x) { return x * 24; }
+inline int f3694_25(int x) { return x * 25; }
+inline int f3694_26(int x) { return x * 26; }
+inline int f3694_27(int x) { return x * 27; }
+inline int f3694_28(int x) { return x * 28; }
+inline int f3694_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3696 */
+#include <vector>
+#include "h5153.h"
+#include "h2207.h"
+#include "h4385.h"
+#include "h2164.h"
+#include "h2030.h"
+#ifdef X
+#include "h4052.h"
+#endif
+struct S3696 { int a; const char *s = "x//y"; };
+inline int f3696_0(int x) { return x * 0; }
+inline int f3696_1(int x) { return x * 1; }
+inline int f3696_2(int x) { return x * 2; }
+inline int f3696_3(int x) { return x * 3; }
+inline int f3696_4(int x) { return x * 4; }
+inline int f3696_5(int x) { return x * 5; }
+inline int f3696_6(int x) { return x * 6; }
+inline int f3696_7(int x) { return x * 7; }
+inline int f3696_8(int x) { return x * 8; }
+inline int f3696_9(int x) { return x * 9; }
+inline int f3696_10(int x) { return x * 10; }
+inline int f3696_11(int x) { return x * 11; }
+inline int f3696_12(int x) { return x * 12; }
+inline int f3696_13(int x) { return x * 13; }
+inline int f3696_14(int x) { return x * 14; }
+inline int f3696_15(int x) { return x * 15; }
+inline int f3696_16(int x) { return x * 16; }
+inline int f3696_17(int x) { return x * 17; }
+inline int f3696_18(int x) { return x * 18; }
+inline int f3696_19(int x) { return x * 19; }
+inline int f3696_20(int x) { return x * 20; }
+inline int f3696_21(int x) { return x * 21; }
+inline int f3696_22(int x) { return x * 22; }
+inline int f3696_23(int x) { return x * 23; }
+inline int f3696_24(int x) { return x * 24; }
+inline int f3696_25(int x) { return x * 25; }
+inline int f3696_26(int x) { return x * 26; }
+inline int f3696_27(int x) { return x * 27; }
+inline int f3696_28(int x) { return x * 28; }
+inline int f3696_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3697 */
+#include <vector>
+#include "h7185.h"
+#include "h5270.h"
+#include "h1099.h"
+#include "h8421.h"
+#include "h2485.h"
+#ifdef X
+#include "h1602.h"
+#endif
+struct S3697 { int a; const char *s = "x//y"; };
+inline int f3697_0(int x) { return x * 0; }
+inline int f3697_1(int x) { return x * 1; }
+inline int f3697_2(int x) { return x * 2; }
+inline int f3697_3(int x) { return x * 3; }
+inline int f3697_4(int x) { return x * 4; }
+inline int f3697_5(int x) { return x * 5; }
+inline int f3697_6(int x) { return x * 6; }
+inline int f3697_7(int x) { return x * 7; }
+inline int f3697_8(int x) { return x * 8; }
+inline int f3697_9(int x) { return x * 9; }
+inline int f3697_10(int x) { return x * 10; }
+inline int f3697_11(int x) { return x * 11; }
+inline int f3697_12(int x) { return x * 12; }
+inline int f3697_13(int x) { return x * 13; }
+inline int f3697_14(int x) { return x * 14; }
+inline int f3697_15(int x) { return x * 15; }
+inline int f3697_16(int x) { return x * 16; }
+inline int f3697_17(int x) { return x * 17; }
+inline int f3697_18(int x) { return x * 18; }
+inline int f3697_19(int x) { return x * 19; }
+inline int f3697_20(int x) { return x * 20; }
+inline int f3697_21(int x) { return x * 21; }
+inline int f3697_22(int x) { return x * 22; }
+inline int f3697_23(int x) { return x * 23; }
+inline int f3697_24(int x) { return x * 24; }
+inline int f3697_25(int x) { return x * 25; }
+inline int f3697_26(int x) { return x * 26; }
+inline int f3697_27(int x) { return x * 27; }
+inline int f3697_28(int x) { return x * 28; }
+inline int f3697_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3698 */
+#include <vector>
+#include "h3095.h"
+#include "h7378.h"
+#include "h6229.h"
+#include "h5780.h"
+#include "h2841.h"
+#ifdef X
+#include "h2607.h"
+#endif
+struct S3698 { int a; const char *s = "x//y"; };
+inline int f3698_0(int x) { return x * 0; }
+inline int f3698_1(int x) { return x * 1; }
+inline int f3698_2(int x) { return x * 2; }
+inline int f3698_3(int x) { return x * 3; }
+inline int f3698_4(int x) { return x * 4; }
+inline int f3698_5(int x) { return x * 5; }
+inline int f3698_6(int x) { return x * 6; }
+inline int f3698_7(int x) { return x * 7; }
+inline int f3698_8(int x) { return x * 8; }
+inline int f3698_9(int x) { return x * 9; }
+inline int f3698_10(int x) { return x * 10; }
+inline int f3698_11(int x) { return x * 11; }
+inline int f3698_12(int x) { return x * 12; }
+inline int f3698_13(int x) { return x * 13; }
+inline int f3698_14(int x) { return x * 14; }
+inline int f3698_15(int x) { return x * 15; }
+inline int f3698_16(int x) { return x * 16; }
+inline int f3698_17(int x) { return x * 17; }
+inline int f3698_18(int x) { return x * 18; }
+inline int f3698_19(int x) { return x * 19; }
+inline int f3698_20(int x) { return x * 20; }
+inline int f3698_21(int x) { return x * 21; }
+inline int f3698_22(int x) { return x * 22; }
+inline int f3698_23(int x) { return x * 23; }
+inline int f3698_24(int x) { return x * 24; }
+inline int f3698_25(int x) { return x * 25; }
+inline int f3698_26(int x) { return x * 26; }
+inline int f3698_27(int x) { return x * 27; }
+inline int f3698_28(int x) { return x * 28; }
+inline int f3698_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 37 */
+#include <vector>
+#include "h6121.h"
+#include "h4722.h"
+#include "h6073.h"
+#include "h3753.h"
+#include "h4811.h"
+#ifdef X
+#include "h5703.h"
+#endif
+struct S37 { int a; const char *s = "x//y"; };
+inline int f37_0(int x) { return x * 0; }
+inline int f37_1(int x) { return x * 1; }
+inline int f37_2(int x) { return x * 2; }
+inline int f37_3(int x) { return x * 3; }
+inline int f37_4(int x) { return x * 4; }
+inline int f37_5(int x) { return x * 5; }
+inline int f37_6(int x) { return x * 6; }
+inline int f37_7(int x) { return x * 7; }
+inline int f37_8(int x) { return x * 8; }
+inline int f37_9(int x) { return x * 9; }
+inline int f37_10(int x) { return x * 10; }
+inline int f37_11(int x) { return x * 11; }
+inline int f37_12(int x) { return x * 12; }
+inline int f37_13(int x) { return x * 13; }
+inline int f37_14(int x) { return x * 14; }
+inline int f37_15(int x) { return x * 15; }
+inline int f37_16(int x) { return x * 16; }
+inline int f37_17(int x) { return x * 17; }
+inline int f37_18(int x) { return x * 18; }
+inline int f37_19(int x) { return x * 19; }
+inline int f37_20(int x) { return x * 20; }
+inline int f37_21(int x) { return x * 21; }
+inline int f37_22(int x) { return x * 22; }
+inline int f37_23(int x) { return x * 23; }
+inline int f37_24(int x) { return x * 24; }
+inline int f37_25(int x) { return x * 25; }
+inline int f37_26(int x) { return x * 26; }
+inline int f37_27(int x) { return x * 27; }
+inline int f37_28(int x) { return x * 28; }
+inline int f37_29(int x) { return x * 29; }
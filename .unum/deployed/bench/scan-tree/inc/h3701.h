@@ -0,0 +1,42 @@
+#pragma once
+/* header 3701 */
+#include <vector>
+#include "h7204.h"
+#include "h559.h"
+#include "h9153.h"
+#include "h7948.h"
+#include "h9142.h"
+#ifdef X
+#include "h3591.h"
+#endif
+struct S3701 { int a; const char *s = "x//y"; };
+inline int f3701_0(int x) { return x * 0; }
+inline int f3701_1(int x) { return x * 1; }
+inline int f3701_2(int x) { return x * 2; }
+inline int f3701_3(int x) { return x * 3; }
+inline int f3701_4(int x) { return x * 4; }
+inline int f3701_5(int x) { return x * 5; }
+inline int f3701_6(int x) { return x * 6; }
+inline int f3701_7(int x) { return x * 7; }
+inline int f3701_8(int x) { return x * 8; }
+inline int f3701_9(int x) { return x * 9; }
+inline int f3701_10(int x) { return x * 10; }
+inline int f3701_11(int x) { return x * 11; }
+inline int f3701_12(int x) { return x * 12; }
+inline int f3701_13(int x) { return x * 13; }
+inline int f3701_14(int x) { return x * 14; }
+inline int f3701_15(int x) { return x * 15; }
+inline int f3701_16(int x) { return x * 16; }
+inline int f3701_17(int x) { return x * 17; }
+inline int f3701_18(int x) { return x * 18; }
+inline int f3701_19(int x) { return x * 19; }
+inline int f3701_20(int x) { return x * 20; }
+inline int f3701_21(int x) { return x * 21; }
+inline int f3701_22(int x) { return x * 22; }
+inline int f3701_23(int x) { return x * 23; }
+inline int f3701_24(int x) { return x * 24; }
+inline int f3701_25(int x) { return x * 25; }
+inline int f3701_26(int x) { return x * 26; }
+inline int f3701_27(int x) { return x * 27; }
+inline int f3701_28(int x) { return x * 28; }
+inline int f3701_29(int x) { return x * 29; }
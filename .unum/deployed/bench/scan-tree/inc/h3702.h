@@ -0,0 +1,42 @@
+#pragma once
+/* header 3702 */
+#include <vector>
+#include "h5669.h"
+#include "h6263.h"
+#include "h5974.h"
+#include "h9717.h"
+#include "h1041.h"
+#ifdef X
+#include "h4629.h"
+#endif
+struct S3702 { int a; const char *s = "x//y"; };
+inline int f3702_0(int x) { return x * 0; }
+inline int f3702_1(int x) { return x * 1; }
+inline int f3702_2(int x) { return x * 2; }
+inline int f3702_3(int x) { return x * 3; }
+inline int f3702_4(int x) { return x * 4; }
+inline int f3702_5(int x) { return x * 5; }
+inline int f3702_6(int x) { return x * 6; }
+inline int f3702_7(int x) { return x * 7; }
+inline int f3702_8(int x) { return x * 8; }
+inline int f3702_9(int x) { return x * 9; }
+inline int f3702_10(int x) { return x * 10; }
+inline int f3702_11(int x) { return x * 11; }
+inline int f3702_12(int x) { return x * 12; }
+inline int f3702_13(int x) { return x * 13; }
+inline int f3702_14(int x) { return x * 14; }
+inline int f3702_15(int x) { return x * 15; }
+inline int f3702_16(int x) { return x * 16; }
+inline int f3702_17(int x) { return x * 17; }
+inline int f3702_18(int x) { return x * 18; }
+inline int f3702_19(int x) { return x * 19; }
+inline int f3702_20(int x) { return x * 20; }
+inline int f3702_21(int x) { return x * 21; }
+inline int f3702_22(int x) { return x * 22; }
+inline int f3702_23(int x) { return x * 23; }
+inline int f3702_24(int x) { return x * 24; }
+inline int f3702_25(int x) { return x * 25; }
+inline int f3702_26(int x) { return x * 26; }
+inline int f3702_27(int x) { return x * 27; }
+inline int f3702_28(int x) { return x * 28; }
+inline int f3702_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3705 */
+#include <vector>
+#include "h2909.h"
+#include "h6523.h"
+#include "h8573.h"
+#include "h7080.h"
+#include "h1981.h"
+#ifdef X
+#include "h4239.h"
+#endif
+struct S3705 { int a; const char *s = "x//y"; };
+inline int f3705_0(int x) { return x * 0; }
+inline int f3705_1(int x) { return x * 1; }
+inline int f3705_2(int x) { return x * 2; }
+inline int f3705_3(int x) { return x * 3; }
+inline int f3705_4(int x) { return x * 4; }
+inline int f3705_5(int x) { return x * 5; }
+inline int f3705_6(int x) { return x * 6; }
+inline int f3705_7(int x) { return x * 7; }
+inline int f3705_8(int x) { return x * 8; }
+inline int f3705_9(int x) { return x * 9; }
+inline int f3705_10(int x) { return x * 10; }
+inline int f3705_11(int x) { return x * 11; }
+inline int f3705_12(int x) { return x * 12; }
+inline int f3705_13(int x) { return x * 13; }
+inline int f3705_14(int x) { return x * 14; }
+inline int f3705_15(int x) { return x * 15; }
+inline int f3705_16(int x) { return x * 16; }
+inline int f3705_17(int x) { return x * 17; }
+inline int f3705_18(int x) { return x * 18; }
+inline int f3705_19(int x) { return x * 19; }
+inline int f3705_20(int x) { return x * 20; }
+inline int f3705_21(int x) { return x * 21; }
+inline int f3705_22(int x) { return x * 22; }
+inline int f3705_23(int x) { return x * 23; }
+inline int f3705_24(int x) { return x * 24; }
+inline int f3705_25(int x) { return x * 25; }
+inline int f3705_26(int x) { return x * 26; }
+inline int f3705_27(int x) { return x * 27; }
+inline int f3705_28(int x) { return x * 28; }
+inline int f3705_29(int x) { return x * 29; }
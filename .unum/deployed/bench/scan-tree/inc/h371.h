@@ -0,0 +1,42 @@
+#pragma once
+/* header 371 */
+#include <vector>
+#include "h2176.h"
+#include "h5440.h"
+#include "h4623.h"
+#include "h2498.h"
+#include "h8895.h"
+#ifdef X
+#include "h7091.h"
+#endif
+struct S371 { int a; const char *s = "x//y"; };
+inline int f371_0(int x) { return x * 0; }
+inline int f371_1(int x) { return x * 1; }
+inline int f371_2(int x) { return x * 2; }
+inline int f371_3(int x) { return x * 3; }
+inline int f371_4(int x) { return x * 4; }
+inline int f371_5(int x) { return x * 5; }
+inline int f371_6(int x) { return x * 6; }
+inline int f371_7(int x) { return x * 7; }
+inline int f371_8(int x) { return x * 8; }
+inline int f371_9(int x) { return x * 9; }
+inline int f371_10(int x) { return x * 10; }
+inline int f371_11(int x) { return x * 11; }
+inline int f371_12(int x) { return x * 12; }
+inline int f371_13(int x) { return x * 13; }
+inline int f371_14(int x) { return x * 14; }
+inline int f371_15(int x) { return x * 15; }
+inline int f371_16(int x) { return x * 16; }
+inline int f371_17(int x) { return x * 17; }
+inline int f371_18(int x) { return x * 18; }
+inline int f371_19(int x) { return x * 19; }
+inline int f371_20(int x) { return x * 20; }
+inline int f371_21(int x) { return x * 21; }
+inline int f371_22(int x) { return x * 22; }
+inline int f371_23(int x) { return x * 23; }
+inline int f371_24(int x) { return x * 24; }
+inline int f371_25(int x) { return x * 25; }
+inline int f371_26(int x) { return x * 26; }
+inline int f371_27(int x) { return x * 27; }
+inline int f371_28(int x) { return x * 28; }
+inline int f371_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3710 */
+#include <vector>
+#include "h6915.h"
+#include "h3810.h"
+#include "h9740.h"
+#include "h3061.h"
+#include "h4277.h"
+#ifdef X
+#include "h6991.h"
+#endif
+struct S3710 { int a; const char *s = "x//y"; };
+inline int f3710_0(int x) { return x * 0; }
+inline int f3710_1(int x) { return x * 1; }
+inline int f3710_2(int x) { return x * 2; }
+inline int f3710_3(int x) { return x * 3; }
+inline int f3710_4(int x) { return x * 4; }
+inline int f3710_5(int x) { return x * 5; }
+inline int f3710_6(int x) { return x * 6; }
+inline int f3710_7(int x) { return x * 7; }
+inline int f3710_8(int x) { return x * 8; }
+inline int f3710_9(int x) { return x * 9; }
+inline int f3710_10(int x) { return x * 10; }
+inline int f3710_11(int x) { return x * 11; }
+inline int f3710_12(int x) { return x * 12; }
+inline int f3710_13(int x) { return x * 13; }
+inline int f3710_14(int x) { return x * 14; }
+inline int f3710_15(int x) { return x * 15; }
+inline int f3710_16(int x) { return x * 16; }
+inline int f3710_17(int x) { return x * 17; }
+inline int f3710_18(int x) { return x * 18; }
+inline int f3710_19(int x) { return x * 19; }
+inline int f3710_20(int x) { return x * 20; }
+inline int f3710_21(int x) { return x * 21; }
+inline int f3710_22(int x) { return x * 22; }
+inline int f3710_23(int x) { return x * 23; }
+inline int f3710_24(int x) { return x * 24; }
+inline int f3710_25(int x) { return x * 25; }
+inline int f3710_26(int x) { return x * 26; }
+inline int f3710_27(int x) { return x * 27; }
+inline int f3710_28(int x) { return x * 28; }
+inline int f3710_29(int x) { return x * 29; }
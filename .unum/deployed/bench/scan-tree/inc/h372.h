@@ -0,0 +1,42 @@
+#pragma once
+/* header 372 */
+#include <vector>
+#include "h6950.h"
+#include "h2498.h"
+#include "h5010.h"
+#include "h7081.h"
+#include "h9735.h"
+#ifdef X
+#include "h6559.h"
+#endif
+struct S372 { int a; const char *s = "x//y"; };
+inline int f372_0(int x) { return x * 0; }
+inline int f372_1(int x) { return x * 1; }
+inline int f372_2(int x) { return x * 2; }
+inline int f372_3(int x) { return x * 3; }
+inline int f372_4(int x) { return x * 4; }
+inline int f372_5(int x) { return x * 5; }
+inline int f372_6(int x) { return x * 6; }
+inline int f372_7(int x) { return x * 7; }
+inline int f372_8(int x) { return x * 8; }
+inline int f372_9(int x) { return x * 9; }
+inline int f372_10(int x) { return x * 10; }
+inline int f372_11(int x) { return x * 11; }
+inline int f372_12(int x) { return x * 12; }
+inline int f372_13(int x) { return x * 13; }
+inline int f372_14(int x) { return x * 14; }
+inline int f372_15(int x) { return x * 15; }
+inline int f372_16(int x) { return x * 16; }
+inline int f372_17(int x) { return x * 17; }
+inline int f372_18(int x) { return x * 18; }
+inline int f372_19(int x) { return x * 19; }
+inline int f372_20(int x) { return x * 20; }
+inline int f372_21(int x) { return x * 21; }
+inline int f372_22(int x) { return x * 22; }
+inline int f372_23(int x) { return x * 23; }
+inline int f372_24(int x) { return x * 24; }
+inline int f372_25(int x) { return x * 25; }
+inline int f372_26(int x) { return x * 26; }
+inline int f372_27(int x) { return x * 27; }
+inline int f372_28(int x) { return x * 28; }
+inline int f372_29(int x) { return x * 29; }
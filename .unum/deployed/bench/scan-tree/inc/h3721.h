@@ -0,0 +1,42 @@
+#pragma once
+/* header 3721 */
+#include <vector>
+#include "h6799.h"
+#include "h8179.h"
+#include "h2352.h"
+#include "h1642.h"
+#include "h9041.h"
+#ifdef X
+#include "h4159.h"
+#endif
+struct S3721 { int a; const char *s = "x//y"; };
+inline int f3721_0(int x) { return x * 0; }
+inline int f3721_1(int x) { return x * 1; }
+inline int f3721_2(int x) { return x * 2; }
+inline int f3721_3(int x) { return x * 3; }
+inline int f3721_4(int x) { return x * 4; }
+inline int f3721_5(int x) { return x * 5; }
+inline int f3721_6(int x) { return x * 6; }
+inline int f3721_7(int x) { return x * 7; }
+inline int f3721_8(int x) { return x * 8; }
+inline int f3721_9(int x) { return x * 9; }
+inline int f3721_10(int x) { return x * 10; }
+inline int f3721_11(int x) { return x * 11; }
+inline int f3721_12(int x) { return x * 12; }
+inline int f3721_13(int x) { return x * 13; }
+inline int f3721_14(int x) { return x * 14; }
+inline int f3721_15(int x) { return x * 15; }
+inline int f3721_16(int x) { return x * 16; }
+inline int f3721_17(int x) { return x * 17; }
+inline int f3721_18(int x) { return x * 18; }
+inline int f3721_19(int x) { return x * 19; }
+inline int f3721_20(int x) { return x * 20; }
+inline int f3721_21(int x) { return x * 21; }
+inline int f3721_22(int x) { return x * 22; }
+inline int f3721_23(int x) { return x * 23; }
+inline int f3721_24(int x) { return x * 24; }
+inline int f3721_25(int x) { return x * 25; }
+inline int f3721_26(int x) { return x * 26; }
+inline int f3721_27(int x) { return x * 27; }
+inline int f3721_28(int x) { return x * 28; }
+inline int f3721_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3723 */
+#include <vector>
+#include "h862.h"
+#include "h9296.h"
+#include "h7335.h"
+#include "h2950.h"
+#include "h8229.h"
+#ifdef X
+#include "h1809.h"
+#endif
+struct S3723 { int a; const char *s = "x//y"; };
+inline int f3723_0(int x) { return x * 0; }
+inline int f3723_1(int x) { return x * 1; }
+inline int f3723_2(int x) { return x * 2; }
+inline int f3723_3(int x) { return x * 3; }
+inline int f3723_4(int x) { return x * 4; }
+inline int f3723_5(int x) { return x * 5; }
+inline int f3723_6(int x) { return x * 6; }
+inline int f3723_7(int x) { return x * 7; }
+inline int f3723_8(int x) { return x * 8; }
+inline int f3723_9(int x) { return x * 9; }
+inline int f3723_10(int x) { return x * 10; }
+inline int f3723_11(int x) { return x * 11; }
+inline int f3723_12(int x) { return x * 12; }
+inline int f3723_13(int x) { return x * 13; }
+inline int f3723_14(int x) { return x * 14; }
+inline int f3723_15(int x) { return x * 15; }
+inline int f3723_16(int x) { return x * 16; }
+inline int f3723_17(int x) { return x * 17; }
+inline int f3723_18(int x) { return x * 18; }
+inline int f3723_19(int x) { return x * 19; }
+inline int f3723_20(int x) { return x * 20; }
+inline int f3723_21(int x) { return x * 21; }
+inline int f3723_22(int x) { return x * 22; }
+inline int f3723_23(int x) { return x * 23; }
+inline int f3723_24(int x) { return x * 24; }
+inline int f3723_25(int x) { return x * 25; }
+inline int f3723_26(int x) { return x * 26; }
+inline int f3723_27(int x) { return x * 27; }
+inline int f3723_28(int x) { return x * 28; }
+inline int f3723_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3724 */
+#include <vector>
+#include "h1520.h"
+#include "h1558.h"
+#include "h3049.h"
+#include "h1981.h"
+#include "h7718.h"
+#ifdef X
+#include "h3215.h"
+#endif
+struct S3724 { int a; const char *s = "x//y"; };
+inline int f3724_0(int x) { return x * 0; }
+inline int f3724_1(int x) { return x * 1; }
+inline int f3724_2(int x) { return x * 2; }
+inline int f3724_3(int x) { return x * 3; }
+inline int f3724_4(int x) { return x * 4; }
+inline int f3724_5(int x) { return x * 5; }
+inline int f3724_6(int x) { return x * 6; }
+inline int f3724_7(int x) { return x * 7; }
+inline int f3724_8(int x) { return x * 8; }
+inline int f3724_9(int x) { return x * 9; }
+inline int f3724_10(int x) { return x * 10; }
+inline int f3724_11(int x) { return x * 11; }
+inline int f3724_12(int x) { return x * 12; }
+inline int f3724_13(int x) { return x * 13; }
+inline int f3724_14(int x) { return x * 14; }
+inline int f3724_15(int x) { return x * 15; }
+inline int f3724_16(int x) { return x * 16; }
+inline int f3724_17(int x) { return x * 17; }
+inline int f3724_18(int x) { return x * 18; }
+inline int f3724_19(int x) { return x * 19; }
+inline int f3724_20(int x) { return x * 20; }
+inline int f3724_21(int x) { return x * 21; }
+inline int f3724_22(int x) { return x * 22; }
+inline int f3724_23(int x) { return x * 23; }
+inline int f3724_24(int x) { return x * 24; }
+inline int f3724_25(int x) { return x * 25; }
+inline int f3724_26(int x) { return x * 26; }
+inline int f3724_27(int x) { return x * 27; }
+inline int f3724_28(int x) { return x * 28; }
+inline int f3724_29(int x) { return x * 29; }
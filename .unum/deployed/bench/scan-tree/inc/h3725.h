@@ -0,0 +1,42 @@
+#pragma once
+/* header 3725 */
+#include <vector>
+#include "h7297.h"
+#include "h9118.h"
+#include "h3448.h"
+#include "h762.h"
+#include "h3658.h"
+#ifdef X
+#include "h4002.h"
+#endif
+struct S3725 { int a; const char *s = "x//y"; };
+inline int f3725_0(int x) { return x * 0; }
+inline int f3725_1(int x) { return x * 1; }
+inline int f3725_2(int x) { return x * 2; }
+inline int f3725_3(int x) { return x * 3; }
+inline int f3725_4(int x) { return x * 4; }
+inline int f3725_5(int x) { return x * 5; }
+inline int f3725_6(int x) { return x * 6; }
+inline int f3725_7(int x) { return x * 7; }
+inline int f3725_8(int x) { return x * 8; }
+inline int f3725_9(int x) { return x * 9; }
+inline int f3725_10(int x) { return x * 10; }
+inline int f3725_11(int x) { return x * 11; }
+inline int f3725_12(int x) { return x * 12; }
+inline int f3725_13(int x) { return x * 13; }
+inline int f3725_14(int x) { return x * 14; }
+inline int f3725_15(int x) { return x * 15; }
+inline int f3725_16(int x) { return x * 16; }
+inline int f3725_17(int x) { return x * 17; }
+inline int f3725_18(int x) { return x * 18; }
+inline int f3725_19(int x) { return x * 19; }
+inline int f3725_20(int x) { return x * 20; }
+inline int f3725_21(int x) { return x * 21; }
+inline int f3725_22(int x) { return x * 22; }
+inline int f3725_23(int x) { return x * 23; }
+inline int f3725_24(int x) { return x * 24; }
+inline int f3725_25(int x) { return x * 25; }
+inline int f3725_26(int x) { return x * 26; }
+inline int f3725_27(int x) { return x * 27; }
+inline int f3725_28(int x) { return x * 28; }
+inline int f3725_29(int x) { return x * 29; }
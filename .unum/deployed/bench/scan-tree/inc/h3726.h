@@ -0,0 +1,42 @@
+#pragma once
+/* header 3726 */
+#include <vector>
+#include "h3543.h"
+#include "h8536.h"
+#include "h8353.h"
+#include "h2974.h"
+#include "h2470.h"
+#ifdef X
+#include "h4470.h"
+#endif
+struct S3726 { int a; const char *s = "x//y"; };
+inline int f3726_0(int x) { return x * 0; }
+inline int f3726_1(int x) { return x * 1; }
+inline int f3726_2(int x) { return x * 2; }
+inline int f3726_3(int x) { return x * 3; }
+inline int f3726_4(int x) { return x * 4; }
+inline int f3726_5(int x) { return x * 5; }
+inline int f3726_6(int x) { return x * 6; }
+inline int f3726_7(int x) { return x * 7; }
+inline int f3726_8(int x) { return x * 8; }
+inline int f3726_9(int x) { return x * 9; }
+inline int f3726_10(int x) { return x * 10; }
+inline int f3726_11(int x) { return x * 11; }
+inline int f3726_12(int x) { return x * 12; }
+inline int f3726_13(int x) { return x * 13; }
+inline int f3726_14(int x) { return x * 14; }
+inline int f3726_15(int x) { return x * 15; }
+inline int f3726_16(int x) { return x * 16; }
+inline int f3726_17(int x) { return x * 17; }
+inline int f3726_18(int x) { return x * 18; }
+inline int f3726_19(int x) { return x * 19; }
+inline int f3726_20(int x) { return x * 20; }
+inline int f3726_21(int x) { return x * 21; }
+inline int f3726_22(int x) { return x * 22; }
+inline int f3726_23(int x) { return x * 23; }
+inline int f3726_24(int x) { return x * 24; }
+inline int f3726_25(int x) { return x * 25; }
+inline int f3726_26(int x) { return x * 26; }
+inline int f3726_27(int x) { return x * 27; }
+inline int f3726_28(int x) { return x * 28; }
+inline int f3726_29(int x) { return x * 29; }
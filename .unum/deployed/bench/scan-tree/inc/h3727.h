@@ -0,0 +1,42 @@
+#pragma once
+/* header 3727 */
+#include <vector>
+#include "h7781.h"
+#include "h5296.h"
+#include "h1663.h"
+#include "h5468.h"
+#include "h5648.h"
+#ifdef X
+#include "h3660.h"
+#endif
+struct S3727 { int a; const char *s = "x//y"; };
+inline int f3727_0(int x) { return x * 0; }
+inline int f3727_1(int x) { return x * 1; }
+inline int f3727_2(int x) { return x * 2; }
+inline int f3727_3(int x) { return x * 3; }
+inline int f3727_4(int x) { return x * 4; }
+inline int f3727_5(int x) { return x * 5; }
+inline int f3727_6(int x) { return x * 6; }
+inline int f3727_7(int x) { return x * 7; }
+inline int f3727_8(int x) { return x * 8; }
+inline int f3727_9(int x) { return x * 9; }
+inline int f3727_10(int x) { return x * 10; }
+inline int f3727_11(int x) { return x * 11; }
+inline int f3727_12(int x) { return x * 12; }
+inline int f3727_13(int x) { return x * 13; }
+inline int f3727_14(int x) { return x * 14; }
+inline int f3727_15(int x) { return x * 15; }
+inline int f3727_16(int x) { return x * 16; }
+inline int f3727_17(int x) { return x * 17; }
+inline int f3727_18(int x) { return x * 18; }
+inline int f3727_19(int x) { return x * 19; }
+inline int f3727_20(int x) { return x * 20; }
+inline int f3727_21(int x) { return x * 21; }
+inline int f3727_22(int x) { return x * 22; }
+inline int f3727_23(int x) { return x * 23; }
+inline int f3727_24(int x) { return x * 24; }
+inline int f3727_25(int x) { return x * 25; }
+inline int f3727_26(int x) { return x * 26; }
+inline int f3727_27(int x) { return x * 27; }
+inline int f3727_28(int x) { return x * 28; }
+inline int f3727_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3728 */
+#include <vector>
+#include "h6780.h"
+#include "h6079.h"
+#include "h1445.h"
+#include "h4696.h"
+#include "h8972.h"
+#ifdef X
+#include "h5763.h"
+#endif
+struct S3728 { int a; const char *s = "x//y"; };
+inline int f3728_0(int x) { return x * 0; }
+inline int f3728_1(int x) { return x * 1; }
+inline int f3728_2(int x) { return x * 2; }
+inline int f3728_3(int x) { return x * 3; }
+inline int f3728_4(int x) { return x * 4; }
+inline int f3728_5(int x) { return x * 5; }
+inline int f3728_6(int x) { return x * 6; }
+inline int f3728_7(int x) { return x * 7; }
+inline int f3728_8(int x) { return x * 8; }
+inline int f3728_9(int x) { return x * 9; }
+inline int f3728_10(int x) { return x * 10; }
+inline int f3728_11(int x) { return x * 11; }
+inline int f3728_12(int x) { return x * 12; }
+inline int f3728_13(int x) { return x * 13; }
+inline int f3728_14(int x) { return x * 14; }
+inline int f3728_15(int x) { return x * 15; }
+inline int f3728_16(int x) { return x * 16; }
+inline int f3728_17(int x) { return x * 17; }
+inline int f3728_18(int x) { return x * 18; }
+inline int f3728_19(int x) { return x * 19; }
+inline int f3728_20(int x) { return x * 20; }
+inline int f3728_21(int x) { return x * 21; }
+inline int f3728_22(int x) { return x * 22; }
+inline int f3728_23(int x) { return x * 23; }
+inline int f3728_24(int x) { return x * 24; }
+inline int f3728_25(int x) { return x * 25; }
+inline int f3728_26(int x) { return x * 26; }
+inline int f3728_27(int x) { return x * 27; }
+inline int f3728_28(int x) { return x * 28; }
+inline int f3728_29(int x) { return x * 29; }
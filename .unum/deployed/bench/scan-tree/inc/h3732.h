@@ -0,0 +1,42 @@
+#pragma once
+/* header 3732 */
+#include <vector>
+#include "h3552.h"
+#include "h8094.h"
+#include "h1640.h"
+#include "h1767.h"
+#include "h3748.h"
+#ifdef X
+#include "h1265.h"
+#endif
+struct S3732 { int a; const char *s = "x//y"; };
+inline int f3732_0(int x) { return x * 0; }
+inline int f3732_1(int x) { return x * 1; }
+inline int f3732_2(int x) { return x * 2; }
+inline int f3732_3(int x) { return x * 3; }
+inline int f3732_4(int x) { return x * 4; }
+inline int f3732_5(int x) { return x * 5; }
+inline int f3732_6(int x) { return x * 6; }
+inline int f3732_7(int x) { return x * 7; }
+inline int f3732_8(int x) { return x * 8; }
+inline int f3732_9(int x) { return x * 9; }
+inline int f3732_10(int x) { return x * 10; }
+inline int f3732_11(int x) { return x * 11; }
+inline int f3732_12(int x) { return x * 12; }
+inline int f3732_13(int x) { return x * 13; }
+inline int f3732_14(int x) { return x * 14; }
+inline int f3732_15(int x) { return x * 15; }
+inline int f3732_16(int x) { return x * 16; }
+inline int f3732_17(int x) { return x * 17; }
+inline int f3732_18(int x) { return x * 18; }
+inline int f3732_19(int x) { return x * 19; }
+inline int f3732_20(int x) { return x * 20; }
+inline int f3732_21(int x) { return x * 21; }
+inline int f3732_22(int x) { return x * 22; }
+inline int f3732_23(int x) { return x * 23; }
+inline int f3732_24(int x) { return x * 24; }
+inline int f3732_25(int x) { return x * 25; }
+inline int f3732_26(int x) { return x * 26; }
+inline int f3732_27(int x) { return x * 27; }
+inline int f3732_28(int x) { return x * 28; }
+inline int f3732_29(int x) { return x * 29; }
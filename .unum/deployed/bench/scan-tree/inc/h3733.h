@@ -0,0 +1,42 @@
+#pragma once
+/* header 3733 */
+#include <vector>
+#include "h4618.h"
+#include "h6100.h"
+#include "h7493.h"
+#include "h7739.h"
+#include "h4844.h"
+#ifdef X
+#include "h7010.h"
+#endif
+struct S3733 { int a; const char *s = "x//y"; };
+inline int f3733_0(int x) { return x * 0; }
+inline int f3733_1(int x) { return x * 1; }
+inline int f3733_2(int x) { return x * 2; }
+inline int f3733_3(int x) { return x * 3; }
+inline int f3733_4(int x) { return x * 4; }
+inline int f3733_5(int x) { return x * 5; }
+inline int f3733_6(int x) { return x * 6; }
+inline int f3733_7(int x) { return x * 7; }
+inline int f3733_8(int x) { return x * 8; }
+inline int f3733_9(int x) { return x * 9; }
+inline int f3733_10(int x) { return x * 10; }
+inline int f3733_11(int x) { return x * 11; }
+inline int f3733_12(int x) { return x * 12; }
+inline int f3733_13(int x) { return x * 13; }
+inline int f3733_14(int x) { return x * 14; }
+inline int f3733_15(int x) { return x * 15; }
+inline int f3733_16(int x) { return x * 16; }
+inline int f3733_17(int x) { return x * 17; }
+inline int f3733_18(int x) { return x * 18; }
+inline int f3733_19(int x) { return x * 19; }
+inline int f3733_20(int x) { return x * 20; }
+inline int f3733_21(int x) { return x * 21; }
+inline int f3733_22(int x) { return x * 22; }
+inline int f3733_23(int x) { return x * 23; }
+inline int f3733_24(int x) { return x * 24; }
+inline int f3733_25(int x) { return x * 25; }
+inline int f3733_26(int x) { return x * 26; }
+inline int f3733_27(int x) { return x * 27; }
+inline int f3733_28(int x) { return x * 28; }
+inline int f3733_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3735 */
+#include <vector>
+#include "h7808.h"
+#include "h8993.h"
+#include "h5372.h"
+#include "h1486.h"
+#include "h8950.h"
+#ifdef X
+#include "h2350.h"
+#endif
+struct S3735 { int a; const char *s = "x//y"; };
+inline int f3735_0(int x) { return x * 0; }
+inline int f3735_1(int x) { return x * 1; }
+inline int f3735_2(int x) { return x * 2; }
+inline int f3735_3(int x) { return x * 3; }
+inline int f3735_4(int x) { return x * 4; }
+inline int f3735_5(int x) { return x * 5; }
+inline int f3735_6(int x) { return x * 6; }
+inline int f3735_7(int x) { return x * 7; }
+inline int f3735_8(int x) { return x * 8; }
+inline int f3735_9(int x) { return x * 9; }
+inline int f3735_10(int x) { return x * 10; }
+inline int f3735_11(int x) { return x * 11; }
+inline int f3735_12(int x) { return x * 12; }
+inline int f3735_13(int x) { return x * 13; }
+inline int f3735_14(int x) { return x * 14; }
+inline int f3735_15(int x) { return x * 15; }
+inline int f3735_16(int x) { return x * 16; }
+inline int f3735_17(int x) { return x * 17; }
+inline int f3735_18(int x) { return x * 18; }
+inline int f3735_19(int x) { return x * 19; }
+inline int f3735_20(int x) { return x * 20; }
+inline int f3735_21(int x) { return x * 21; }
+inline int f3735_22(int x) { return x * 22; }
+inline int f3735_23(int x) { return x * 23; }
+inline int f3735_24(int x) { return x * 24; }
+inline int f3735_25(int x) { return x * 25; }
+inline int f3735_26(int x) { return x * 26; }
+inline int f3735_27(int x) { return x * 27; }
+inline int f3735_28(int x) { return x * 28; }
+inline int f3735_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3736 */
+#include <vector>
+#include "h728.h"
+#include "h1741.h"
+#include "h6536.h"
+#include "h2541.h"
+#include "h5744.h"
+#ifdef X
+#include "h3179.h"
+#endif
+struct S3736 { int a; const char *s = "x//y"; };
+inline int f3736_0(int x) { return x * 0; }
+inline int f3736_1(int x) { return x * 1; }
+inline int f3736_2(int x) { return x * 2; }
+inline int f3736_3(int x) { return x * 3; }
+inline int f3736_4(int x) { return x * 4; }
+inline int f3736_5(int x) { return x * 5; }
+inline int f3736_6(int x) { return x * 6; }
+inline int f3736_7(int x) { return x * 7; }
+inline int f3736_8(int x) { return x * 8; }
+inline int f3736_9(int x) { return x * 9; }
+inline int f3736_10(int x) { return x * 10; }
+inline int f3736_11(int x) { return x * 11; }
+inline int f3736_12(int x) { return x * 12; }
+inline int f3736_13(int x) { return x * 13; }
+inline int f3736_14(int x) { return x * 14; }
+inline int f3736_15(int x) { return x * 15; }
+inline int f3736_16(int x) { return x * 16; }
+inline int f3736_17(int x) { return x * 17; }
+inline int f3736_18(int x) { return x * 18; }
+inline int f3736_19(int x) { return x * 19; }
+inline int f3736_20(int x) { return x * 20; }
+inline int f3736_21(int x) { return x * 21; }
+inline int f3736_22(int x) { return x * 22; }
+inline int f3736_23(int x) { return x * 23; }
+inline int f3736_24(int x) { return x * 24; }
+inline int f3736_25(int x) { return x * 25; }
+inline int f3736_26(int x) { return x * 26; }
+inline int f3736_27(int x) { return x * 27; }
+inline int f3736_28(int x) { return x * 28; }
+inline int f3736_29(int x) { return x * 29; }
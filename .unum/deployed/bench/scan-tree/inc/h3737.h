@@ -0,0 +1,42 @@
+#pragma once
+/* header 3737 */
+#include <vector>
+#include "h7672.h"
+#include "h6137.h"
+#include "h3486.h"
+#include "h3635.h"
+#include "h3496.h"
+#ifdef X
+#include "h3077.h"
+#endif
+struct S3737 { int a; const char *s = "x//y"; };
+inline int f3737_0(int x) { return x * 0; }
+inline int f3737_1(int x) { return x * 1; }
+inline int f3737_2(int x) { return x * 2; }
+inline int f3737_3(int x) { return x * 3; }
+inline int f3737_4(int x) { return x * 4; }
+inline int f3737_5(int x) { return x * 5; }
+inline int f3737_6(int x) { return x * 6; }
+inline int f3737_7(int x) { return x * 7; }
+inline int f3737_8(int x) { return x * 8; }
+inline int f3737_9(int x) { return x * 9; }
+inline int f3737_10(int x) { return x * 10; }
+inline int f3737_11(int x) { return x * 11; }
+inline int f3737_12(int x) { return x * 12; }
+inline int f3737_13(int x) { return x * 13; }
+inline int f3737_14(int x) { return x * 14; }
+inline int f3737_15(int x) { return x * 15; }
+inline int f3737_16(int x) { return x * 16; }
+inline int f3737_17(int x) { return x * 17; }
+inline int f3737_18(int x) { return x * 18; }
+inline int f3737_19(int x) { return x * 19; }
+inline int f3737_20(int x) { return x * 20; }
+inline int f3737_21(int x) { return x * 21; }
+inline int f3737_22(int x) { return x * 22; }
+inline int f3737_23(int x) { return x * 23; }
+inline int f3737_24(int x) { return x * 24; }
+inline int f3737_25(int x) { return x * 25; }
+inline int f3737_26(int x) { return x * 26; }
+inline int f3737_27(int x) { return x * 27; }
+inline int f3737_28(int x) { return x * 28; }
+inline int f3737_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3739 */
+#include <vector>
+#include "h6986.h"
+#include "h821.h"
+#include "h9975.h"
+#include "h4106.h"
+#include "h6078.h"
+#ifdef X
+#include "h7189.h"
+#endif
+struct S3739 { int a; const char *s = "x//y"; };
+inline int f3739_0(int x) { return x * 0; }
+inline int f3739_1(int x) { return x * 1; }
+inline int f3739_2(int x) { return x * 2; }
+inline int f3739_3(int x) { return x * 3; }
+inline int f3739_4(int x) { return x * 4; }
+inline int f3739_5(int x) { return x * 5; }
+inline int f3739_6(int x) { return x * 6; }
+inline int f3739_7(int x) { return x * 7; }
+inline int f3739_8(int x) { return x * 8; }
+inline int f3739_9(int x) { return x * 9; }
+inline int f3739_10(int x) { return x * 10; }
+inline int f3739_11(int x) { return x * 11; }
+inline int f3739_12(int x) { return x * 12; }
+inline int f3739_13(int x) { return x * 13; }
+inline int f3739_14(int x) { return x * 14; }
+inline int f3739_15(int x) { return x * 15; }
+inline int f3739_16(int x) { return x * 16; }
+inline int f3739_17(int x) { return x * 17; }
+inline int f3739_18(int x) { return x * 18; }
+inline int f3739_19(int x) { return x * 19; }
+inline int f3739_20(int x) { return x * 20; }
+inline int f3739_21(int x) { return x * 21; }
+inline int f3739_22(int x) { return x * 22; }
+inline int f3739_23(int x) { return x * 23; }
+inline int f3739_24(int x) { return x * 24; }
+inline int f3739_25(int x) { return x * 25; }
+inline int f3739_26(int x) { return x * 26; }
+inline int f3739_27(int x) { return x * 27; }
+inline int f3739_28(int x) { return x * 28; }
+inline int f3739_29(int x) { return x * 29; }
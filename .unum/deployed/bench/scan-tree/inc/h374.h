@@ -0,0 +1,42 @@
+#pragma once
+/* header 374 */
+#include <vector>
+#include "h5303.h"
+#include "h7332.h"
+#include "h7043.h"
+#include "h2152.h"
+#include "h5954.h"
+#ifdef X
+#include "h3348.h"
+#endif
+struct S374 { int a; const char *s = "x//y"; };
+inline int f374_0(int x) { return x * 0; }
+inline int f374_1(int x) { return x * 1; }
+inline int f374_2(int x) { return x * 2; }
+inline int f374_3(int x) { return x * 3; }
+inline int f374_4(int x) { return x * 4; }
+inline int f374_5(int x) { return x * 5; }
+inline int f374_6(int x) { return x * 6; }
+inline int f374_7(int x) { return x * 7; }
+inline int f374_8(int x) { return x * 8; }
+inline int f374_9(int x) { return x * 9; }
+inline int f374_10(int x) { return x * 10; }
+inline int f374_11(int x) { return x * 11; }
+inline int f374_12(int x) { return x * 12; }
+inline int f374_13(int x) { return x * 13; }
+inline int f374_14(int x) { return x * 14; }
+inline int f374_15(int x) { return x * 15; }
+inline int f374_16(int x) { return x * 16; }
+inline int f374_17(int x) { return x * 17; }
+inline int f374_18(int x) { return x * 18; }
+inline int f374_19(int x) { return x * 19; }
+inline int f374_20(int x) { return x * 20; }
+inline int f374_21(int x) { return x * 21; }
+inline int f374_22(int x) { return x * 22; }
+inline int f374_23(int x) { return x * 23; }
+inline int f374_24(int x) { return x * 24; }
+inline int f374_25(int x) { return x * 25; }
+inline int f374_26(int x) { return x * 26; }
+inline int f374_27(int x) { return x * 27; }
+inline int f374_28(int x) { return x * 28; }
+inline int f374_29(int x) { return x * 29; }
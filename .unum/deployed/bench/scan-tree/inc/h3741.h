@@ -0,0 +1,42 @@
+#pragma once
+/* header 3741 */
+#include <vector>
+#include "h9854.h"
+#include "h4286.h"
+#include "h5263.h"
+#include "h636.h"
+#include "h6743.h"
+#ifdef X
+#include "h336.h"
+#endif
+struct S3741 { int a; const char *s = "x//y"; };
+inline int f3741_0(int x) { return x * 0; }
+inline int f3741_1(int x) { return x * 1; }
+inline int f3741_2(int x) { return x * 2; }
+inline int f3741_3(int x) { return x * 3; }
+inline int f3741_4(int x) { return x * 4; }
+inline int f3741_5(int x) { return x * 5; }
+inline int f3741_6(int x) { return x * 6; }
+inline int f3741_7(int x) { return x * 7; }
+inline int f3741_8(int x) { return x * 8; }
+inline int f3741_9(int x) { return x * 9; }
+inline int f3741_10(int x) { return x * 10; }
+inline int f3741_11(int x) { return x * 11; }
+inline int f3741_12(int x) { return x * 12; }
+inline int f3741_13(int x) { return x * 13; }
+inline int f3741_14(int x) { return x * 14; }
+inline int f3741_15(int x) { return x * 15; }
+inline int f3741_16(int x) { return x * 16; }
+inline int f3741_17(int x) { return x * 17; }
+inline int f3741_18(int x) { return x * 18; }
+inline int f3741_19(int x) { return x * 19; }
+inline int f3741_20(int x) { return x * 20; }
+inline int f3741_21(int x) { return x * 21; }
+inline int f3741_22(int x) { return x * 22; }
+inline int f3741_23(int x) { return x * 23; }
+inline int f3741_24(int x) { return x * 24; }
+inline int f3741_25(int x) { return x * 25; }
+inline int f3741_26(int x) { return x * 26; }
+inline int f3741_27(int x) { return x * 27; }
+inline int f3741_28(int x) { return x * 28; }
+inline int f3741_29(int x) { return x * 29; }
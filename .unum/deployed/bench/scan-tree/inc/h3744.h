@@ -0,0 +1,42 @@
+#pragma once
+/* header 3744 */
+#include <vector>
+#include "h6329.h"
+#include "h960.h"
+#include "h8746.h"
+#include "h6898.h"
+#include "h641.h"
+#ifdef X
+#include "h3870.h"
+#endif
+struct S3744 { int a; const char *s = "x//y"; };
+inline int f3744_0(int x) { return x * 0; }
+inline int f3744_1(int x) { return x * 1; }
+inline int f3744_2(int x) { return x * 2; }
+inline int f3744_3(int x) { return x * 3; }
+inline int f3744_4(int x) { return x * 4; }
+inline int f3744_5(int x) { return x * 5; }
+inline int f3744_6(int x) { return x * 6; }
+inline int f3744_7(int x) { return x * 7; }
+inline int f3744_8(int x) { return x * 8; }
+inline int f3744_9(int x) { return x * 9; }
+inline int f3744_10(int x) { return x * 10; }
+inline int f3744_11(int x) { return x * 11; }
+inline int f3744_12(int x) { return x * 12; }
+inline int f3744_13(int x) { return x * 13; }
+inline int f3744_14(int x) { return x * 14; }
+inline int f3744_15(int x) { return x * 15; }
+inline int f3744_16(int x) { return x * 16; }
+inline int f3744_17(int x) { return x * 17; }
+inline int f3744_18(int x) { return x * 18; }
+inline int f3744_19(int x) { return x * 19; }
+inline int f3744_20(int x) { return x * 20; }
+inline int f3744_21(int x) { return x * 21; }
+inline int f3744_22(int x) { return x * 22; }
+inline int f3744_23(int x) { return x * 23; }
+inline int f3744_24(int x) { return x * 24; }
+inline int f3744_25(int x) { return x * 25; }
+inline int f3744_26(int x) { return x * 26; }
+inline int f3744_27(int x) { return x * 27; }
+inline int f3744_28(int x) { return x * 28; }
+inline int f3744_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3745 */
+#include <vector>
+#include "h3251.h"
+#include "h4736.h"
+#include "h4236.h"
+#include "h7380.h"
+#include "h6281.h"
+#ifdef X
+#include "h619.h"
+#endif
+struct S3745 { int a; const char *s = "x//y"; };
+inline int f3745_0(int x) { return x * 0; }
+inline int f3745_1(int x) { return x * 1; }
+inline int f3745_2(int x) { return x * 2; }
+inline int f3745_3(int x) { return x * 3; }
+inline int f3745_4(int x) { return x * 4; }
+inline int f3745_5(int x) { return x * 5; }
+inline int f3745_6(int x) { return x * 6; }
+inline int f3745_7(int x) { return x * 7; }
+inline int f3745_8(int x) { return x * 8; }
+inline int f3745_9(int x) { return x * 9; }
+inline int f3745_10(int x) { return x * 10; }
+inline int f3745_11(int x) { return x * 11; }
+inline int f3745_12(int x) { return x * 12; }
+inline int f3745_13(int x) { return x * 13; }
+inline int f3745_14(int x) { return x * 14; }
+inline int f3745_15(int x) { return x * 15; }
+inline int f3745_16(int x) { return x * 16; }
+inline int f3745_17(int x) { return x * 17; }
+inline int f3745_18(int x) { return x * 18; }
+inline int f3745_19(int x) { return x * 19; }
+inline int f3745_20(int x) { return x * 20; }
+inline int f3745_21(int x) { return x * 21; }
+inline int f3745_22(int x) { return x * 22; }
+inline int f3745_23(int x) { return x * 23; }
+inline int f3745_24(int x) { return x * 24; }
+inline int f3745_25(int x) { return x * 25; }
+inline int f3745_26(int x) { return x * 26; }
+inline int f3745_27(int x) { return x * 27; }
+inline int f3745_28(int x) { return x * 28; }
+inline int f3745_29(int x) { return x * 29; }
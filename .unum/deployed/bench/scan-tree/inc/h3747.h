@@ -0,0 +1,42 @@
+#pragma once
+/* header 3747 */
+#include <vector>
+#include "h7960.h"
+#include "h7954.h"
+#include "h676.h"
+#include "h7423.h"
+#include "h9940.h"
+#ifdef X
+#include "h7665.h"
+#endif
+struct S3747 { int a; const char *s = "x//y"; };
+inline int f3747_0(int x) { return x * 0; }
+inline int f3747_1(int x) { return x * 1; }
+inline int f3747_2(int x) { return x * 2; }
+inline int f3747_3(int x) { return x * 3; }
+inline int f3747_4(int x) { return x * 4; }
+inline int f3747_5(int x) { return x * 5; }
+inline int f3747_6(int x) { return x * 6; }
+inline int f3747_7(int x) { return x * 7; }
+inline int f3747_8(int x) { return x * 8; }
+inline int f3747_9(int x) { return x * 9; }
+inline int f3747_10(int x) { return x * 10; }
+inline int f3747_11(int x) { return x * 11; }
+inline int f3747_12(int x) { return x * 12; }
+inline int f3747_13(int x) { return x * 13; }
+inline int f3747_14(int x) { return x * 14; }
+inline int f3747_15(int x) { return x * 15; }
+inline int f3747_16(int x) { return x * 16; }
+inline int f3747_17(int x) { return x * 17; }
+inline int f3747_18(int x) { return x * 18; }
+inline int f3747_19(int x) { return x * 19; }
+inline int f3747_20(int x) { return x * 20; }
+inline int f3747_21(int x) { return x * 21; }
+inline int f3747_22(int x) { return x * 22; }
+inline int f3747_23(int x) { return x * 23; }
+inline int f3747_24(int x) { return x * 24; }
+inline int f3747_25(int x) { return x * 25; }
+inline int f3747_26(int x) { return x * 26; }
+inline int f3747_27(int x) { return x * 27; }
+inline int f3747_28(int x) { return x * 28; }
+inline int f3747_29(int x) { return x * 29; }
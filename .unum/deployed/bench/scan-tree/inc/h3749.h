@@ -0,0 +1,42 @@
+#pragma once
+/* header 3749 */
+#include <vector>
+#include "h7678.h"
+#include "h2851.h"
+#include "h9522.h"
+#include "h9913.h"
+#include "h1346.h"
+#ifdef X
+#include "h6745.h"
+#endif
+struct S3749 { int a; const char *s = "x//y"; };
+inline int f3749_0(int x) { return x * 0; }
+inline int f3749_1(int x) { return x * 1; }
+inline int f3749_2(int x) { return x * 2; }
+inline int f3749_3(int x) { return x * 3; }
+inline int f3749_4(int x) { return x * 4; }
+inline int f3749_5(int x) { return x * 5; }
+inline int f3749_6(int x) { return x * 6; }
+inline int f3749_7(int x) { return x * 7; }
+inline int f3749_8(int x) { return x * 8; }
+inline int f3749_9(int x) { return x * 9; }
+inline int f3749_10(int x) { return x * 10; }
+inline int f3749_11(int x) { return x * 11; }
+inline int f3749_12(int x) { return x * 12; }
+inline int f3749_13(int x) { return x * 13; }
+inline int f3749_14(int x) { return x * 14; }
+inline int f3749_15(int x) { return x * 15; }
+inline int f3749_16(int x) { return x * 16; }
+inline int f3749_17(int x) { return x * 17; }
+inline int f3749_18(int x) { return x * 18; }
+inline int f3749_19(int x) { return x * 19; }
+inline int f3749_20(int x) { return x * 20; }
+inline int f3749_21(int x) { return x * 21; }
+inline int f3749_22(int x) { return x * 22; }
+inline int f3749_23(int x) { return x * 23; }
+inline int f3749_24(int x) { return x * 24; }
+inline int f3749_25(int x) { return x * 25; }
+inline int f3749_26(int x) { return x * 26; }
+inline int f3749_27(int x) { return x * 27; }
+inline int f3749_28(int x) { return x * 28; }
+inline int f3749_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3750 */
+#include <vector>
+#include "h3171.h"
+#include "h705.h"
+#include "h3031.h"
+#include "h4287.h"
+#include "h343.h"
+#ifdef X
+#include "h5511.h"
+#endif
+struct S3750 { int a; const char *s = "x//y"; };
+inline int f3750_0(int x) { return x * 0; }
+inline int f3750_1(int x) { return x * 1; }
+inline int f3750_2(int x) { return x * 2; }
+inline int f3750_3(int x) { return x * 3; }
+inline int f3750_4(int x) { return x * 4; }
+inline int f3750_5(int x) { return x * 5; }
+inline int f3750_6(int x) { return x * 6; }
+inline int f3750_7(int x) { return x * 7; }
+inline int f3750_8(int x) { return x * 8; }
+inline int f3750_9(int x) { return x * 9; }
+inline int f3750_10(int x) { return x * 10; }
+inline int f3750_11(int x) { return x * 11; }
+inline int f3750_12(int x) { return x * 12; }
+inline int f3750_13(int x) { return x * 13; }
+inline int f3750_14(int x) { return x * 14; }
+inline int f3750_15(int x) { return x * 15; }
+inline int f3750_16(int x) { return x * 16; }
+inline int f3750_17(int x) { return x * 17; }
+inline int f3750_18(int x) { return x * 18; }
+inline int f3750_19(int x) { return x * 19; }
+inline int f3750_20(int x) { return x * 20; }
+inline int f3750_21(int x) { return x * 21; }
+inline int f3750_22(int x) { return x * 22; }
+inline int f3750_23(int x) { return x * 23; }
+inline int f3750_24(int x) { return x * 24; }
+inline int f3750_25(int x) { return x * 25; }
+inline int f3750_26(int x) { return x * 26; }
+inline int f3750_27(int x) { return x * 27; }
+inline int f3750_28(int x) { return x * 28; }
+inline int f3750_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3753 */
+#include <vector>
+#include "h6565.h"
+#include "h5177.h"
+#include "h3199.h"
+#include "h8306.h"
+#include "h9693.h"
+#ifdef X
+#include "h6279.h"
+#endif
+struct S3753 { int a; const char *s = "x//y"; };
+inline int f3753_0(int x) { return x * 0; }
+inline int f3753_1(int x) { return x * 1; }
+inline int f3753_2(int x) { return x * 2; }
+inline int f3753_3(int x) { return x * 3; }
+inline int f3753_4(int x) { return x * 4; }
+inline int f3753_5(int x) { return x * 5; }
+inline int f3753_6(int x) { return x * 6; }
+inline int f3753_7(int x) { return x * 7; }
+inline int f3753_8(int x) { return x * 8; }
+inline int f3753_9(int x) { return x * 9; }
+inline int f3753_10(int x) { return x * 10; }
+inline int f3753_11(int x) { return x * 11; }
+inline int f3753_12(int x) { return x * 12; }
+inline int f3753_13(int x) { return x * 13; }
+inline int f3753_14(int x) { return x * 14; }
+inline int f3753_15(int x) { return x * 15; }
+inline int f3753_16(int x) { return x * 16; }
+inline int f3753_17(int x) { return x * 17; }
+inline int f3753_18(int x) { return x * 18; }
+inline int f3753_19(int x) { return x * 19; }
+inline int f3753_20(int x) { return x * 20; }
+inline int f3753_21(int x) { return x * 21; }
+inline int f3753_22(int x) { return x * 22; }
+inline int f3753_23(int x) { return x * 23; }
+inline int f3753_24(int x) { return x * 24; }
+inline int f3753_25(int x) { return x * 25; }
+inline int f3753_26(int x) { return x * 26; }
+inline int f3753_27(int x) { return x * 27; }
+inline int f3753_28(int x) { return x * 28; }
+inline int f3753_29(int x) { return x * 29; }
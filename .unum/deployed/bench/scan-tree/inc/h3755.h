@@ -0,0 +1,42 @@
+#pragma once
+/* header 3755 */
+#include <vector>
+#include "h7488.h"
+#include "h723.h"
+#include "h7062.h"
+#include "h3788.h"
+#include "h1045.h"
+#ifdef X
+#include "h1997.h"
+#endif
+struct S3755 { int a; const char *s = "x//y"; };
+inline int f3755_0(int x) { return x * 0; }
+inline int f3755_1(int x) { return x * 1; }
+inline int f3755_2(int x) { return x * 2; }
+inline int f3755_3(int x) { return x * 3; }
+inline int f3755_4(int x) { return x * 4; }
+inline int f3755_5(int x) { return x * 5; }
+inline int f3755_6(int x) { return x * 6; }
+inline int f3755_7(int x) { return x * 7; }
+inline int f3755_8(int x) { return x * 8; }
+inline int f3755_9(int x) { return x * 9; }
+inline int f3755_10(int x) { return x * 10; }
+inline int f3755_11(int x) { return x * 11; }
+inline int f3755_12(int x) { return x * 12; }
+inline int f3755_13(int x) { return x * 13; }
+inline int f3755_14(int x) { return x * 14; }
+inline int f3755_15(int x) { return x * 15; }
+inline int f3755_16(int x) { return x * 16; }
+inline int f3755_17(int x) { return x * 17; }
+inline int f3755_18(int x) { return x * 18; }
+inline int f3755_19(int x) { return x * 19; }
+inline int f3755_20(int x) { return x * 20; }
+inline int f3755_21(int x) { return x * 21; }
+inline int f3755_22(int x) { return x * 22; }
+inline int f3755_23(int x) { return x * 23; }
+inline int f3755_24(int x) { return x * 24; }
+inline int f3755_25(int x) { return x * 25; }
+inline int f3755_26(int x) { return x * 26; }
+inline int f3755_27(int x) { return x * 27; }
+inline int f3755_28(int x) { return x * 28; }
+inline int f3755_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3757 */
+#include <vector>
+#include "h7168.h"
+#include "h1146.h"
+#include "h4252.h"
+#include "h7.h"
+#include "h5378.h"
+#ifdef X
+#include "h5785.h"
+#endif
+struct S3757 { int a; const char *s = "x//y"; };
+inline int f3757_0(int x) { return x * 0; }
+inline int f3757_1(int x) { return x * 1; }
+inline int f3757_2(int x) { return x * 2; }
+inline int f3757_3(int x) { return x * 3; }
+inline int f3757_4(int x) { return x * 4; }
+inline int f3757_5(int x) { return x * 5; }
+inline int f3757_6(int x) { return x * 6; }
+inline int f3757_7(int x) { return x * 7; }
+inline int f3757_8(int x) { return x * 8; }
+inline int f3757_9(int x) { return x * 9; }
+inline int f3757_10(int x) { return x * 10; }
+inline int f3757_11(int x) { return x * 11; }
+inline int f3757_12(int x) { return x * 12; }
+inline int f3757_13(int x) { return x * 13; }
+inline int f3757_14(int x) { return x * 14; }
+inline int f3757_15(int x) { return x * 15; }
+inline int f3757_16(int x) { return x * 16; }
+inline int f3757_17(int x) { return x * 17; }
+inline int f3757_18(int x) { return x * 18; }
+inline int f3757_19(int x) { return x * 19; }
+inline int f3757_20(int x) { return x * 20; }
+inline int f3757_21(int x) { return x * 21; }
+inline int f3757_22(int x) { return x * 22; }
+inline int f3757_23(int x) { return x * 23; }
+inline int f3757_24(int x) { return x * 24; }
+inline int f3757_25(int x) { return x * 25; }
+inline int f3757_26(int x) { return x * 26; }
+inline int f3757_27(int x) { return x * 27; }
+inline int f3757_28(int x) { return x * 28; }
+inline int f3757_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3759 */
+#include <vector>
+#include "h2543.h"
+#include "h1161.h"
+#include "h2259.h"
+#include "h2509.h"
+#include "h8874.h"
+#ifdef X
+#include "h9543.h"
+#endif
+struct S3759 { int a; const char *s = "x//y"; };
+inline int f3759_0(int x) { return x * 0; }
+inline int f3759_1(int x) { return x * 1; }
+inline int f3759_2(int x) { return x * 2; }
+inline int f3759_3(int x) { return x * 3; }
+inline int f3759_4(int x) { return x * 4; }
+inline int f3759_5(int x) { return x * 5; }
+inline int f3759_6(int x) { return x * 6; }
+inline int f3759_7(int x) { return x * 7; }
+inline int f3759_8(int x) { return x * 8; }
+inline int f3759_9(int x) { return x * 9; }
+inline int f3759_10(int x) { return x * 10; }
+inline int f3759_11(int x) { return x * 11; }
+inline int f3759_12(int x) { return x * 12; }
+inline int f3759_13(int x) { return x * 13; }
+inline int f3759_14(int x) { return x * 14; }
+inline int f3759_15(int x) { return x * 15; }
+inline int f3759_16(int x) { return x * 16; }
+inline int f3759_17(int x) { return x * 17; }
+inline int f3759_18(int x) { return x * 18; }
+inline int f3759_19(int x) { return x * 19; }
+inline int f3759_20(int x) { return x * 20; }
+inline int f3759_21(int x) { return x * 21; }
+inline int f3759_22(int x) { return x * 22; }
+inline int f3759_23(int x) { return x * 23; }
+inline int f3759_24(int x) { return x * 24; }
+inline int f3759_25(int x) { return x * 25; }
+inline int f3759_26(int x) { return x * 26; }
+inline int f3759_27(int x) { return x * 27; }
+inline int f3759_28(int x) { return x * 28; }
+inline int f3759_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 376 */
+#include <vector>
+#include "h1368.h"
+#include "h868.h"
+#include "h3396.h"
+#include "h692.h"
+#include "h5979.h"
+#ifdef X
+#include "h2533.h"
+#endif
+struct S376 { int a; const char *s = "x//y"; };
+inline int f376_0(int x) { return x * 0; }
+inline int f376_1(int x) { return x * 1; }
+inline int f376_2(int x) { return x * 2; }
+inline int f376_3(int x) { return x * 3; }
+inline int f376_4(int x) { return x * 4; }
+inline int f376_5(int x) { return x * 5; }
+inline int f376_6(int x) { return x * 6; }
+inline int f376_7(int x) { return x * 7; }
+inline int f376_8(int x) { return x * 8; }
+inline int f376_9(int x) { return x * 9; }
+inline int f376_10(int x) { return x * 10; }
+inline int f376_11(int x) { return x * 11; }
+inline int f376_12(int x) { return x * 12; }
+inline int f376_13(int x) { return x * 13; }
+inline int f376_14(int x) { return x * 14; }
+inline int f376_15(int x) { return x * 15; }
+inline int f376_16(int x) { return x * 16; }
+inline int f376_17(int x) { return x * 17; }
+inline int f376_18(int x) { return x * 18; }
+inline int f376_19(int x) { return x * 19; }
+inline int f376_20(int x) { return x * 20; }
+inline int f376_21(int x) { return x * 21; }
+inline int f376_22(int x) { return x * 22; }
+inline int f376_23(int x) { return x * 23; }
+inline int f376_24(int x) { return x * 24; }
+inline int f376_25(int x) { return x * 25; }
+inline int f376_26(int x) { return x * 26; }
+inline int f376_27(int x) { return x * 27; }
+inline int f376_28(int x) { return x * 28; }
+inline int f376_29(int x) { return x * 29; }
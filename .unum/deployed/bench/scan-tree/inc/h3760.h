@@ -0,0 +1,42 @@
+#pragma once
+/* header 3760 */
+#include <vector>
+#include "h8726.h"
+#include "h6760.h"
+#include "h5468.h"
+#include "h4170.h"
+#include "h40.h"
+#ifdef X
+#include "h9323.h"
+#endif
+struct S3760 { int a; const char *s = "x//y"; };
+inline int f3760_0(int x) { return x * 0; }
+inline int f3760_1(int x) { return x * 1; }
+inline int f3760_2(int x) { return x * 2; }
+inline int f3760_3(int x) { return x * 3; }
+inline int f3760_4(int x) { return x * 4; }
+inline int f3760_5(int x) { return x * 5; }
+inline int f3760_6(int x) { return x * 6; }
+inline int f3760_7(int x) { return x * 7; }
+inline int f3760_8(int x) { return x * 8; }
+inline int f3760_9(int x) { return x * 9; }
+inline int f3760_10(int x) { return x * 10; }
+inline int f3760_11(int x) { return x * 11; }
+inline int f3760_12(int x) { return x * 12; }
+inline int f3760_13(int x) { return x * 13; }
+inline int f3760_14(int x) { return x * 14; }
+inline int f3760_15(int x) { return x * 15; }
+inline int f3760_16(int x) { return x * 16; }
+inline int f3760_17(int x) { return x * 17; }
+inline int f3760_18(int x) { return x * 18; }
+inline int f3760_19(int x) { return x * 19; }
+inline int f3760_20(int x) { return x * 20; }
+inline int f3760_21(int x) { return x * 21; }
+inline int f3760_22(int x) { return x * 22; }
+inline int f3760_23(int x) { return x * 23; }
+inline int f3760_24(int x) { return x * 24; }
+inline int f3760_25(int x) { return x * 25; }
+inline int f3760_26(int x) { return x * 26; }
+inline int f3760_27(int x) { return x * 27; }
+inline int f3760_28(int x) { return x * 28; }
+inline int f3760_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3761 */
+#include <vector>
+#include "h3506.h"
+#include "h6338.h"
+#include "h6741.h"
+#include "h8328.h"
+#include "h4168.h"
+#ifdef X
+#include "h3107.h"
+#endif
+struct S3761 { int a; const char *s = "x//y"; };
+inline int f3761_0(int x) { return x * 0; }
+inline int f3761_1(int x) { return x * 1; }
+inline int f3761_2(int x) { return x * 2; }
+inline int f3761_3(int x) { return x * 3; }
+inline int f3761_4(int x) { return x * 4; }
+inline int f3761_5(int x) { return x * 5; }
+inline int f3761_6(int x) { return x * 6; }
+inline int f3761_7(int x) { return x * 7; }
+inline int f3761_8(int x) { return x * 8; }
+inline int f3761_9(int x) { return x * 9; }
+inline int f3761_10(int x) { return x * 10; }
+inline int f3761_11(int x) { return x * 11; }
+inline int f3761_12(int x) { return x * 12; }
+inline int f3761_13(int x) { return x * 13; }
+inline int f3761_14(int x) { return x * 14; }
+inline int f3761_15(int x) { return x * 15; }
+inline int f3761_16(int x) { return x * 16; }
+inline int f3761_17(int x) { return x * 17; }
+inline int f3761_18(int x) { return x * 18; }
+inline int f3761_19(int x) { return x * 19; }
+inline int f3761_20(int x) { return x * 20; }
+inline int f3761_21(int x) { return x * 21; }
+inline int f3761_22(int x) { return x * 22; }
+inline int f3761_23(int x) { return x * 23; }
+inline int f3761_24(int x) { return x * 24; }
+inline int f3761_25(int x) { return x * 25; }
+inline int f3761_26(int x) { return x * 26; }
+inline int f3761_27(int x) { return x * 27; }
+inline int f3761_28(int x) { return x * 28; }
+inline int f3761_29(int x) { return x * 29; }
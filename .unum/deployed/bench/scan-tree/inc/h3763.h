@@ -0,0 +1,42 @@
+#pragma once
+/* header 3763 */
+#include <vector>
+#include "h5130.h"
+#include "h6871.h"
+#include "h38.h"
+#include "h40.h"
+#include "h3337.h"
+#ifdef X
+#include "h7251.h"
+#endif
+struct S3763 { int a; const char *s = "x//y"; };
+inline int f3763_0(int x) { return x * 0; }
+inline int f3763_1(int x) { return x * 1; }
+inline int f3763_2(int x) { return x * 2; }
+inline int f3763_3(int x) { return x * 3; }
+inline int f3763_4(int x) { return x * 4; }
+inline int f3763_5(int x) { return x * 5; }
+inline int f3763_6(int x) { return x * 6; }
+inline int f3763_7(int x) { return x * 7; }
+inline int f3763_8(int x) { return x * 8; }
+inline int f3763_9(int x) { return x * 9; }
+inline int f3763_10(int x) { return x * 10; }
+inline int f3763_11(int x) { return x * 11; }
+inline int f3763_12(int x) { return x * 12; }
+inline int f3763_13(int x) { return x * 13; }
+inline int f3763_14(int x) { return x * 14; }
+inline int f3763_15(int x) { return x * 15; }
+inline int f3763_16(int x) { return x * 16; }
+inline int f3763_17(int x) { return x * 17; }
+inline int f3763_18(int x) { return x * 18; }
+inline int f3763_19(int x) { return x * 19; }
+inline int f3763_20(int x) { return x * 20; }
+inline int f3763_21(int x) { return x * 21; }
+inline int f3763_22(int x) { return x * 22; }
+inline int f3763_23(int x) { return x * 23; }
+inline int f3763_24(int x) { return x * 24; }
+inline int f3763_25(int x) { return x * 25; }
+inline int f3763_26(int x) { return x * 26; }
+inline int f3763_27(int x) { return x * 27; }
+inline int f3763_28(int x) { return x * 28; }
+inline int f3763_29(int x) { return x * 29; }
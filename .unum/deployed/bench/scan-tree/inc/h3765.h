@@ -0,0 +1,42 @@
+#pragma once
+/* header 3765 */
+#include <vector>
+#include "h3070.h"
+#include "h6042.h"
+#include "h5821.h"
+#include "h4112.h"
+#include "h6239.h"
+#ifdef X
+#include "h835.h"
+#endif
+struct S3765 { int a; const char *s = "x//y"; };
+inline int f3765_0(int x) { return x * 0; }
+inline int f3765_1(int x) { return x * 1; }
+inline int f3765_2(int x) { return x * 2; }
+inline int f3765_3(int x) { return x * 3; }
+inline int f3765_4(int x) { return x * 4; }
+inline int f3765_5(int x) { return x * 5; }
+inline int f3765_6(int x) { return x * 6; }
+inline int f3765_7(int x) { return x * 7; }
+inline int f3765_8(int x) { return x * 8; }
+inline int f3765_9(int x) { return x * 9; }
+inline int f3765_10(int x) { return x * 10; }
+inline int f3765_11(int x) { return x * 11; }
+inline int f3765_12(int x) { return x * 12; }
+inline int f3765_13(int x) { return x * 13; }
+inline int f3765_14(int x) { return x * 14; }
+inline int f3765_15(int x) { return x * 15; }
+inline int f3765_16(int x) { return x * 16; }
+inline int f3765_17(int x) { return x * 17; }
+inline int f3765_18(int x) { return x * 18; }
+inline int f3765_19(int x) { return x * 19; }
+inline int f3765_20(int x) { return x * 20; }
+inline int f3765_21(int x) { return x * 21; }
+inline int f3765_22(int x) { return x * 22; }
+inline int f3765_23(int x) { return x * 23; }
+inline int f3765_24(int x) { return x * 24; }
+inline int f3765_25(int x) { return x * 25; }
+inline int f3765_26(int x) { return x * 26; }
+inline int f3765_27(int x) { return x * 27; }
+inline int f3765_28(int x) { return x * 28; }
+inline int f3765_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3766 */
+#include <vector>
+#include "h6910.h"
+#include "h1514.h"
+#include "h64.h"
+#include "h3946.h"
+#include "h1153.h"
+#ifdef X
+#include "h7449.h"
+#endif
+struct S3766 { int a; const char *s = "x//y"; };
+inline int f3766_0(int x) { return x * 0; }
+inline int f3766_1(int x) { return x * 1; }
+inline int f3766_2(int x) { return x * 2; }
+inline int f3766_3(int x) { return x * 3; }
+inline int f3766_4(int x) { return x * 4; }
+inline int f3766_5(int x) { return x * 5; }
+inline int f3766_6(int x) { return x * 6; }
+inline int f3766_7(int x) { return x * 7; }
+inline int f3766_8(int x) { return x * 8; }
+inline int f3766_9(int x) { return x * 9; }
+inline int f3766_10(int x) { return x * 10; }
+inline int f3766_11(int x) { return x * 11; }
+inline int f3766_12(int x) { return x * 12; }
+inline int f3766_13(int x) { return x * 13; }
+inline int f3766_14(int x) { return x * 14; }
+inline int f3766_15(int x) { return x * 15; }
+inline int f3766_16(int x) { return x * 16; }
+inline int f3766_17(int x) { return x * 17; }
+inline int f3766_18(int x) { return x * 18; }
+inline int f3766_19(int x) { return x * 19; }
+inline int f3766_20(int x) { return x * 20; }
+inline int f3766_21(int x) { return x * 21; }
+inline int f3766_22(int x) { return x * 22; }
+inline int f3766_23(int x) { return x * 23; }
+inline int f3766_24(int x) { return x * 24; }
+inline int f3766_25(int x) { return x * 25; }
+inline int f3766_26(int x) { return x * 26; }
+inline int f3766_27(int x) { return x * 27; }
+inline int f3766_28(int x) { return x * 28; }
+inline int f3766_29(int x) { return x * 29; }
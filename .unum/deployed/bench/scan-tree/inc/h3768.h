@@ -0,0 +1,42 @@
+#pragma once
+/* header 3768 */
+#include <vector>
+#include "h8105.h"
+#include "h6583.h"
+#include "h8140.h"
+#include "h9189.h"
+#include "h3945.h"
+#ifdef X
+#include "h9972.h"
+#endif
+struct S3768 { int a; const char *s = "x//y"; };
+inline int f3768_0(int x) { return x * 0; }
+inline int f3768_1(int x) { return x * 1; }
+inline int f3768_2(int x) { return x * 2; }
+inline int f3768_3(int x) { return x * 3; }
+inline int f3768_4(int x) { return x * 4; }
+inline int f3768_5(int x) { return x * 5; }
+inline int f3768_6(int x) { return x * 6; }
+inline int f3768_7(int x) { return x * 7; }
+inline int f3768_8(int x) { return x * 8; }
+inline int f3768_9(int x) { return x * 9; }
+inline int f3768_10(int x) { return x * 10; }
+inline int f3768_11(int x) { return x * 11; }
+inline int f3768_12(int x) { return x * 12; }
+inline int f3768_13(int x) { return x * 13; }
+inline int f3768_14(int x) { return x * 14; }
+inline int f3768_15(int x) { return x * 15; }
+inline int f3768_16(int x) { return x * 16; }
+inline int f3768_17(int x) { return x * 17; }
+inline int f3768_18(int x) { return x * 18; }
+inline int f3768_19(int x) { return x * 19; }
+inline int f3768_20(int x) { return x * 20; }
+inline int f3768_21(int x) { return x * 21; }
+inline int f3768_22(int x) { return x * 22; }
+inline int f3768_23(int x) { return x * 23; }
+inline int f3768_24(int x) { return x * 24; }
+inline int f3768_25(int x) { return x * 25; }
+inline int f3768_26(int x) { return x * 26; }
+inline int f3768_27(int x) { return x * 27; }
+inline int f3768_28(int x) { return x * 28; }
+inline int f3768_29(int x) { return x * 29; }
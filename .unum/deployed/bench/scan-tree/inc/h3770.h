@@ -0,0 +1,42 @@
+#pragma once
+/* header 3770 */
+#include <vector>
+#include "h4579.h"
+#include "h4730.h"
+#include "h8005.h"
+#include "h7005.h"
+#include "h3419.h"
+#ifdef X
+#include "h5033.h"
+#endif
+struct S3770 { int a; const char *s = "x//y"; };
+inline int f3770_0(int x) { return x * 0; }
+inline int f3770_1(int x) { return x * 1; }
+inline int f3770_2(int x) { return x * 2; }
+inline int f3770_3(int x) { return x * 3; }
+inline int f3770_4(int x) { return x * 4; }
+inline int f3770_5(int x) { return x * 5; }
+inline int f3770_6(int x) { return x * 6; }
+inline int f3770_7(int x) { return x * 7; }
+inline int f3770_8(int x) { return x * 8; }
+inline int f3770_9(int x) { return x * 9; }
+inline int f3770_10(int x) { return x * 10; }
+inline int f3770_11(int x) { return x * 11; }
+inline int f3770_12(int x) { return x * 12; }
+inline int f3770_13(int x) { return x * 13; }
+inline int f3770_14(int x) { return x * 14; }
+inline int f3770_15(int x) { return x * 15; }
+inline int f3770_16(int x) { return x * 16; }
+inline int f3770_17(int x) { return x * 17; }
+inline int f3770_18(int x) { return x * 18; }
+inline int f3770_19(int x) { return x * 19; }
+inline int f3770_20(int x) { return x * 20; }
+inline int f3770_21(int x) { return x * 21; }
+inline int f3770_22(int x) { return x * 22; }
+inline int f3770_23(int x) { return x * 23; }
+inline int f3770_24(int x) { return x * 24; }
+inline int f3770_25(int x) { return x * 25; }
+inline int f3770_26(int x) { return x * 26; }
+inline int f3770_27(int x) { return x * 27; }
+inline int f3770_28(int x) { return x * 28; }
+inline int f3770_29(int x) { return x * 29; }
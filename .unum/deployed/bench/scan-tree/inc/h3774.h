@@ -0,0 +1,42 @@
+#pragma once
+/* header 3774 */
+#include <vector>
+#include "h1794.h"
+#include "h4385.h"
+#include "h5201.h"
+#include "h1800.h"
+#include "h3238.h"
+#ifdef X
+#include "h7163.h"
+#endif
+struct S3774 { int a; const char *s = "x//y"; };
+inline int f3774_0(int x) { return x * 0; }
+inline int f3774_1(int x) { return x * 1; }
+inline int f3774_2(int x) { return x * 2; }
+inline int f3774_3(int x) { return x * 3; }
+inline int f3774_4(int x) { return x * 4; }
+inline int f3774_5(int x) { return x * 5; }
+inline int f3774_6(int x) { return x * 6; }
+inline int f3774_7(int x) { return x * 7; }
+inline int f3774_8(int x) { return x * 8; }
+inline int f3774_9(int x) { return x * 9; }
+inline int f3774_10(int x) { return x * 10; }
+inline int f3774_11(int x) { return x * 11; }
+inline int f3774_12(int x) { return x * 12; }
+inline int f3774_13(int x) { return x * 13; }
+inline int f3774_14(int x) { return x * 14; }
+inline int f3774_15(int x) { return x * 15; }
+inline int f3774_16(int x) { return x * 16; }
+inline int f3774_17(int x) { return x * 17; }
+inline int f3774_18(int x) { return x * 18; }
+inline int f3774_19(int x) { return x * 19; }
+inline int f3774_20(int x) { return x * 20; }
+inline int f3774_21(int x) { return x * 21; }
+inline int f3774_22(int x) { return x * 22; }
+inline int f3774_23(int x) { return x * 23; }
+inline int f3774_24(int x) { return x * 24; }
+inline int f3774_25(int x) { return x * 25; }
+inline int f3774_26(int x) { return x * 26; }
+inline int f3774_27(int x) { return x * 27; }
+inline int f3774_28(int x) { return x * 28; }
+inline int f3774_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3778 */
+#include <vector>
+#include "h6964.h"
+#include "h6171.h"
+#include "h6273.h"
+#include "h8089.h"
+#include "h2927.h"
+#ifdef X
+#include "h4918.h"
+#endif
+struct S3778 { int a; const char *s = "x//y"; };
+inline int f3778_0(int x) { return x * 0; }
+inline int f3778_1(int x) { return x * 1; }
+inline int f3778_2(int x) { return x * 2; }
+inline int f3778_3(int x) { return x * 3; }
+inline int f3778_4(int x) { return x * 4; }
+inline int f3778_5(int x) { return x * 5; }
+inline int f3778_6(int x) { return x * 6; }
+inline int f3778_7(int x) { return x * 7; }
+inline int f3778_8(int x) { return x * 8; }
+inline int f3778_9(int x) { return x * 9; }
+inline int f3778_10(int x) { return x * 10; }
+inline int f3778_11(int x) { return x * 11; }
+inline int f3778_12(int x) { return x * 12; }
+inline int f3778_13(int x) { return x * 13; }
+inline int f3778_14(int x) { return x * 14; }
+inline int f3778_15(int x) { return x * 15; }
+inline int f3778_16(int x) { return x * 16; }
+inline int f3778_17(int x) { return x * 17; }
+inline int f3778_18(int x) { return x * 18; }
+inline int f3778_19(int x) { return x * 19; }
+inline int f3778_20(int x) { return x * 20; }
+inline int f3778_21(int x) { return x * 21; }
+inline int f3778_22(int x) { return x * 22; }
+inline int f3778_23(int x) { return x * 23; }
+inline int f3778_24(int x) { return x * 24; }
+inline int f3778_25(int x) { return x * 25; }
+inline int f3778_26(int x) { return x * 26; }
+inline int f3778_27(int x) { return x * 27; }
+inline int f3778_28(int x) { return x * 28; }
+inline int f3778_29(int x) { return x * 29; }
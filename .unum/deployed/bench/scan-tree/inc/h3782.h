@@ -0,0 +1,42 @@
+#pragma once
+/* header 3782 */
+#include <vector>
+#include "h2179.h"
+#include "h8707.h"
+#include "h8039.h"
+#include "h8552.h"
+#include "h375.h"
+#ifdef X
+#include "h3295.h"
+#endif
+struct S3782 { int a; const char *s = "x//y"; };
+inline int f3782_0(int x) { return x * 0; }
+inline int f3782_1(int x) { return x * 1; }
+inline int f3782_2(int x) { return x * 2; }
+inline int f3782_3(int x) { return x * 3; }
+inline int f3782_4(int x) { return x * 4; }
+inline int f3782_5(int x) { return x * 5; }
+inline int f3782_6(int x) { return x * 6; }
+inline int f3782_7(int x) { return x * 7; }
+inline int f3782_8(int x) { return x * 8; }
+inline int f3782_9(int x) { return x * 9; }
+inline int f3782_10(int x) { return x * 10; }
+inline int f3782_11(int x) { return x * 11; }
+inline int f3782_12(int x) { return x * 12; }
+inline int f3782_13(int x) { return x * 13; }
+inline int f3782_14(int x) { return x * 14; }
+inline int f3782_15(int x) { return x * 15; }
+inline int f3782_16(int x) { return x * 16; }
+inline int f3782_17(int x) { return x * 17; }
+inline int f3782_18(int x) { return x * 18; }
+inline int f3782_19(int x) { return x * 19; }
+inline int f3782_20(int x) { return x * 20; }
+inline int f3782_21(int x) { return x * 21; }
+inline int f3782_22(int x) { return x * 22; }
+inline int f3782_23(int x) { return x * 23; }
+inline int f3782_24(int x) { return x * 24; }
+inline int f3782_25(int x) { return x * 25; }
+inline int f3782_26(int x) { return x * 26; }
+inline int f3782_27(int x) { return x * 27; }
+inline int f3782_28(int x) { return x * 28; }
+inline int f3782_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3784 */
+#include <vector>
+#include "h8655.h"
+#include "h6689.h"
+#include "h2960.h"
+#include "h2653.h"
+#include "h2938.h"
+#ifdef X
+#include "h6100.h"
+#endif
+struct S3784 { int a; const char *s = "x//y"; };
+inline int f3784_0(int x) { return x * 0; }
+inline int f3784_1(int x) { return x * 1; }
+inline int f3784_2(int x) { return x * 2; }
+inline int f3784_3(int x) { return x * 3; }
+inline int f3784_4(int x) { return x * 4; }
+inline int f3784_5(int x) { return x * 5; }
+inline int f3784_6(int x) { return x * 6; }
+inline int f3784_7(int x) { return x * 7; }
+inline int f3784_8(int x) { return x * 8; }
+inline int f3784_9(int x) { return x * 9; }
+inline int f3784_10(int x) { return x * 10; }
+inline int f3784_11(int x) { return x * 11; }
+inline int f3784_12(int x) { return x * 12; }
+inline int f3784_13(int x) { return x * 13; }
+inline int f3784_14(int x) { return x * 14; }
+inline int f3784_15(int x) { return x * 15; }
+inline int f3784_16(int x) { return x * 16; }
+inline int f3784_17(int x) { return x * 17; }
+inline int f3784_18(int x) { return x * 18; }
+inline int f3784_19(int x) { return x * 19; }
+inline int f3784_20(int x) { return x * 20; }
+inline int f3784_21(int x) { return x * 21; }
+inline int f3784_22(int x) { return x * 22; }
+inline int f3784_23(int x) { return x * 23; }
+inline int f3784_24(int x) { return x * 24; }
+inline int f3784_25(int x) { return x * 25; }
+inline int f3784_26(int x) { return x * 26; }
+inline int f3784_27(int x) { return x * 27; }
+inline int f3784_28(int x) { return x * 28; }
+inline int f3784_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3785 */
+#include <vector>
+#include "h7801.h"
+#include "h1469.h"
+#include "h6208.h"
+#include "h3579.h"
+#include "h9238.h"
+#ifdef X
+#include "h7245.h"
+#endif
+struct S3785 { int a; const char *s = "x//y"; };
+inline int f3785_0(int x) { return x * 0; }
+inline int f3785_1(int x) { return x * 1; }
+inline int f3785_2(int x) { return x * 2; }
+inline int f3785_3(int x) { return x * 3; }
+inline int f3785_4(int x) { return x * 4; }
+inline int f3785_5(int x) { return x * 5; }
+inline int f3785_6(int x) { return x * 6; }
+inline int f3785_7(int x) { return x * 7; }
+inline int f3785_8(int x) { return x * 8; }
+inline int f3785_9(int x) { return x * 9; }
+inline int f3785_10(int x) { return x * 10; }
+inline int f3785_11(int x) { return x * 11; }
+inline int f3785_12(int x) { return x * 12; }
+inline int f3785_13(int x) { return x * 13; }
+inline int f3785_14(int x) { return x * 14; }
+inline int f3785_15(int x) { return x * 15; }
+inline int f3785_16(int x) { return x * 16; }
+inline int f3785_17(int x) { return x * 17; }
+inline int f3785_18(int x) { return x * 18; }
+inline int f3785_19(int x) { return x * 19; }
+inline int f3785_20(int x) { return x * 20; }
+inline int f3785_21(int x) { return x * 21; }
+inline int f3785_22(int x) { return x * 22; }
+inline int f3785_23(int x) { return x * 23; }
+inline int f3785_24(int x) { return x * 24; }
+inline int f3785_25(int x) { return x * 25; }
+inline int f3785_26(int x) { return x * 26; }
+inline int f3785_27(int x) { return x * 27; }
+inline int f3785_28(int x) { return x * 28; }
+inline int f3785_29(int x) { return x * 29; }
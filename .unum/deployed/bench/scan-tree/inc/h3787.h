@@ -0,0 +1,42 @@
+#pragma once
+/* header 3787 */
+#include <vector>
+#include "h27.h"
+#include "h3161.h"
+#include "h3650.h"
+#include "h2580.h"
+#include "h9081.h"
+#ifdef X
+#include "h664.h"
+#endif
+struct S3787 { int a; const char *s = "x//y"; };
+inline int f3787_0(int x) { return x * 0; }
+inline int f3787_1(int x) { return x * 1; }
+inline int f3787_2(int x) { return x * 2; }
+inline int f3787_3(int x) { return x * 3; }
+inline int f3787_4(int x) { return x * 4; }
+inline int f3787_5(int x) { return x * 5; }
+inline int f3787_6(int x) { return x * 6; }
+inline int f3787_7(int x) { return x * 7; }
+inline int f3787_8(int x) { return x * 8; }
+inline int f3787_9(int x) { return x * 9; }
+inline int f3787_10(int x) { return x * 10; }
+inline int f3787_11(int x) { return x * 11; }
+inline int f3787_12(int x) { return x * 12; }
+inline int f3787_13(int x) { return x * 13; }
+inline int f3787_14(int x) { return x * 14; }
+inline int f3787_15(int x) { return x * 15; }
+inline int f3787_16(int x) { return x * 16; }
+inline int f3787_17(int x) { return x * 17; }
+inline int f3787_18(int x) { return x * 18; }
+inline int f3787_19(int x) { return x * 19; }
+inline int f3787_20(int x) { return x * 20; }
+inline int f3787_21(int x) { return x * 21; }
+inline int f3787_22(int x) { return x * 22; }
+inline int f3787_23(int x) { return x * 23; }
+inline int f3787_24(int x) { return x * 24; }
+inline int f3787_25(int x) { return x * 25; }
+inline int f3787_26(int x) { return x * 26; }
+inline int f3787_27(int x) { return x * 27; }
+inline int f3787_28(int x) { return x * 28; }
+inline int f3787_29(int x) { return x * 29; }
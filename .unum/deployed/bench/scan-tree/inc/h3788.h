@@ -0,0 +1,42 @@
+#pragma once
+/* header 3788 */
+#include <vector>
+#include "h5203.h"
+#include "h5374.h"
+#include "h3661.h"
+#include "h7331.h"
+#include "h8426.h"
+#ifdef X
+#include "h2778.h"
+#endif
+struct S3788 { int a; const char *s = "x//y"; };
+inline int f3788_0(int x) { return x * 0; }
+inline int f3788_1(int x) { return x * 1; }
+inline int f3788_2(int x) { return x * 2; }
+inline int f3788_3(int x) { return x * 3; }
+inline int f3788_4(int x) { return x * 4; }
+inline int f3788_5(int x) { return x * 5; }
+inline int f3788_6(int x) { return x * 6; }
+inline int f3788_7(int x) { return x * 7; }
+inline int f3788_8(int x) { return x * 8; }
+inline int f3788_9(int x) { return x * 9; }
+inline int f3788_10(int x) { return x * 10; }
+inline int f3788_11(int x) { return x * 11; }
+inline int f3788_12(int x) { return x * 12; }
+inline int f3788_13(int x) { return x * 13; }
+inline int f3788_14(int x) { return x * 14; }
+inline int f3788_15(int x) { return x * 15; }
+inline int f3788_16(int x) { return x * 16; }
+inline int f3788_17(int x) { return x * 17; }
+inline int f3788_18(int x) { return x * 18; }
+inline int f3788_19(int x) { return x * 19; }
+inline int f3788_20(int x) { return x * 20; }
+inline int f3788_21(int x) { return x * 21; }
+inline int f3788_22(int x) { return x * 22; }
+inline int f3788_23(int x) { return x * 23; }
+inline int f3788_24(int x) { return x * 24; }
+inline int f3788_25(int x) { return x * 25; }
+inline int f3788_26(int x) { return x * 26; }
+inline int f3788_27(int x) { return x * 27; }
+inline int f3788_28(int x) { return x * 28; }
+inline int f3788_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3789 */
+#include <vector>
+#include "h4727.h"
+#include "h9746.h"
+#include "h7435.h"
+#include "h697.h"
+#include "h3156.h"
+#ifdef X
+#include "h6391.h"
+#endif
+struct S3789 { int a; const char *s = "x//y"; };
+inline int f3789_0(int x) { return x * 0; }
+inline int f3789_1(int x) { return x * 1; }
+inline int f3789_2(int x) { return x * 2; }
+inline int f3789_3(int x) { return x * 3; }
+inline int f3789_4(int x) { return x * 4; }
+inline int f3789_5(int x) { return x * 5; }
+inline int f3789_6(int x) { return x * 6; }
+inline int f3789_7(int x) { return x * 7; }
+inline int f3789_8(int x) { return x * 8; }
+inline int f3789_9(int x) { return x * 9; }
+inline int f3789_10(int x) { return x * 10; }
+inline int f3789_11(int x) { return x * 11; }
+inline int f3789_12(int x) { return x * 12; }
+inline int f3789_13(int x) { return x * 13; }
+inline int f3789_14(int x) { return x * 14; }
+inline int f3789_15(int x) { return x * 15; }
+inline int f3789_16(int x) { return x * 16; }
+inline int f3789_17(int x) { return x * 17; }
+inline int f3789_18(int x) { return x * 18; }
+inline int f3789_19(int x) { return x * 19; }
+inline int f3789_20(int x) { return x * 20; }
+inline int f3789_21(int x) { return x * 21; }
+inline int f3789_22(int x) { return x * 22; }
+inline int f3789_23(int x) { return x * 23; }
+inline int f3789_24(int x) { return x * 24; }
+inline int f3789_25(int x) { return x * 25; }
+inline int f3789_26(int x) { return x * 26; }
+inline int f3789_27(int x) { return x * 27; }
+inline int f3789_28(int x) { return x * 28; }
+inline int f3789_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 379 */
+#include <vector>
+#include "h6331.h"
+#include "h3406.h"
+#include "h4141.h"
+#include "h7276.h"
+#include "h5412.h"
+#ifdef X
+#include "h5652.h"
+#endif
+struct S379 { int a; const char *s = "x//y"; };
+inline int f379_0(int x) { return x * 0; }
+inline int f379_1(int x) { return x * 1; }
+inline int f379_2(int x) { return x * 2; }
+inline int f379_3(int x) { return x * 3; }
+inline int f379_4(int x) { return x * 4; }
+inline int f379_5(int x) { return x * 5; }
+inline int f379_6(int x) { return x * 6; }
+inline int f379_7(int x) { return x * 7; }
+inline int f379_8(int x) { return x * 8; }
+inline int f379_9(int x) { return x * 9; }
+inline int f379_10(int x) { return x * 10; }
+inline int f379_11(int x) { return x * 11; }
+inline int f379_12(int x) { return x * 12; }
+inline int f379_13(int x) { return x * 13; }
+inline int f379_14(int x) { return x * 14; }
+inline int f379_15(int x) { return x * 15; }
+inline int f379_16(int x) { return x * 16; }
+inline int f379_17(int x) { return x * 17; }
+inline int f379_18(int x) { return x * 18; }
+inline int f379_19(int x) { return x * 19; }
+inline int f379_20(int x) { return x * 20; }
+inline int f379_21(int x) { return x * 21; }
+inline int f379_22(int x) { return x * 22; }
+inline int f379_23(int x) { return x * 23; }
+inline int f379_24(int x) { return x * 24; }
+inline int f379_25(int x) { return x * 25; }
+inline int f379_26(int x) { return x * 26; }
+inline int f379_27(int x) { return x * 27; }
+inline int f379_28(int x) { return x * 28; }
+inline int f379_29(int x) { return x * 29; }
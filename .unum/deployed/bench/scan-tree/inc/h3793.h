@@ -0,0 +1,42 @@
+#pragma once
+/* header 3793 */
+#include <vector>
+#include "h578.h"
+#include "h8446.h"
+#include "h4961.h"
+#include "h3243.h"
+#include "h4515.h"
+#ifdef X
+#include "h1284.h"
+#endif
+struct S3793 { int a; const char *s = "x//y"; };
+inline int f3793_0(int x) { return x * 0; }
+inline int f3793_1(int x) { return x * 1; }
+inline int f3793_2(int x) { return x * 2; }
+inline int f3793_3(int x) { return x * 3; }
+inline int f3793_4(int x) { return x * 4; }
+inline int f3793_5(int x) { return x * 5; }
+inline int f3793_6(int x) { return x * 6; }
+inline int f3793_7(int x) { return x * 7; }
+inline int f3793_8(int x) { return x * 8; }
+inline int f3793_9(int x) { return x * 9; }
+inline int f3793_10(int x) { return x * 10; }
+inline int f3793_11(int x) { return x * 11; }
+inline int f3793_12(int x) { return x * 12; }
+inline int f3793_13(int x) { return x * 13; }
+inline int f3793_14(int x) { return x * 14; }
+inline int f3793_15(int x) { return x * 15; }
+inline int f3793_16(int x) { return x * 16; }
+inline int f3793_17(int x) { return x * 17; }
+inline int f3793_18(int x) { return x * 18; }
+inline int f3793_19(int x) { return x * 19; }
+inline int f3793_20(int x) { return x * 20; }
+inline int f3793_21(int x) { return x * 21; }
+inline int f3793_22(int x) { return x * 22; }
+inline int f3793_23(int x) { return x * 23; }
+inline int f3793_24(int x) { return x * 24; }
+inline int f3793_25(int x) { return x * 25; }
+inline int f3793_26(int x) { return x * 26; }
+inline int f3793_27(int x) { return x * 27; }
+inline int f3793_28(int x) { return x * 28; }
+inline int f3793_29(int x) { return x * 29; }
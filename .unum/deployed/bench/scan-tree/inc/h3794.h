@@ -0,0 +1,42 @@
+#pragma once
+/* header 3794 */
+#include <vector>
+#include "h9419.h"
+#include "h1518.h"
+#include "h7366.h"
+#include "h7931.h"
+#include "h6088.h"
+#ifdef X
+#include "h8719.h"
+#endif
+struct S3794 { int a; const char *s = "x//y"; };
+inline int f3794_0(int x) { return x * 0; }
+inline int f3794_1(int x) { return x * 1; }
+inline int f3794_2(int x) { return x * 2; }
+inline int f3794_3(int x) { return x * 3; }
+inline int f3794_4(int x) { return x * 4; }
+inline int f3794_5(int x) { return x * 5; }
+inline int f3794_6(int x) { return x * 6; }
+inline int f3794_7(int x) { return x * 7; }
+inline int f3794_8(int x) { return x * 8; }
+inline int f3794_9(int x) { return x * 9; }
+inline int f3794_10(int x) { return x * 10; }
+inline int f3794_11(int x) { return x * 11; }
+inline int f3794_12(int x) { return x * 12; }
+inline int f3794_13(int x) { return x * 13; }
+inline int f3794_14(int x) { return x * 14; }
+inline int f3794_15(int x) { return x * 15; }
+inline int f3794_16(int x) { return x * 16; }
+inline int f3794_17(int x) { return x * 17; }
+inline int f3794_18(int x) { return x * 18; }
+inline int f3794_19(int x) { return x * 19; }
+inline int f3794_20(int x) { return x * 20; }
+inline int f3794_21(int x) { return x * 21; }
+inline int f3794_22(int x) { return x * 22; }
+inline int f3794_23(int x) { return x * 23; }
+inline int f3794_24(int x) { return x * 24; }
+inline int f3794_25(int x) { return x * 25; }
+inline int f3794_26(int x) { return x * 26; }
+inline int f3794_27(int x) { return x * 27; }
+inline int f3794_28(int x) { return x * 28; }
+inline int f3794_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3796 */
+#include <vector>
+#include "h4997.h"
+#include "h6745.h"
+#include "h6325.h"
+#include "h6605.h"
+#include "h4475.h"
+#ifdef X
+#include "h906.h"
+#endif
+struct S3796 { int a; const char *s = "x//y"; };
+inline int f3796_0(int x) { return x * 0; }
+inline int f3796_1(int x) { return x * 1; }
+inline int f3796_2(int x) { return x * 2; }
+inline int f3796_3(int x) { return x * 3; }
+inline int f3796_4(int x) { return x * 4; }
+inline int f3796_5(int x) { return x * 5; }
+inline int f3796_6(int x) { return x * 6; }
+inline int f3796_7(int x) { return x * 7; }
+inline int f3796_8(int x) { return x * 8; }
+inline int f3796_9(int x) { return x * 9; }
+inline int f3796_10(int x) { return x * 10; }
+inline int f3796_11(int x) { return x * 11; }
+inline int f3796_12(int x) { return x * 12; }
+inline int f3796_13(int x) { return x * 13; }
+inline int f3796_14(int x) { return x * 14; }
+inline int f3796_15(int x) { return x * 15; }
+inline int f3796_16(int x) { return x * 16; }
+inline int f3796_17(int x) { return x * 17; }
+inline int f3796_18(int x) { return x * 18; }
+inline int f3796_19(int x) { return x * 19; }
+inline int f3796_20(int x) { return x * 20; }
+inline int f3796_21(int x) { return x * 21; }
+inline int f3796_22(int x) { return x * 22; }
+inline int f3796_23(int x) { return x * 23; }
+inline int f3796_24(int x) { return x * 24; }
+inline int f3796_25(int x) { return x * 25; }
+inline int f3796_26(int x) { return x * 26; }
+inline int f3796_27(int x) { return x * 27; }
+inline int f3796_28(int x) { return x * 28; }
+inline int f3796_29(int x) { return x * 29; }
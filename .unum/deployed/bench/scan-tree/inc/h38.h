@@ -0,0 +1,42 @@
+#pragma once
+/* header 38 */
+#include <vector>
+#include "h8784.h"
+#include "h1443.h"
+#include "h323.h"
+#include "h9261.h"
+#include "h8077.h"
+#ifdef X
+#include "h5856.h"
+#endif
+struct S38 { int a; const char *s = "x//y"; };
+inline int f38_0(int x) { return x * 0; }
+inline int f38_1(int x) { return x * 1; }
+inline int f38_2(int x) { return x * 2; }
+inline int f38_3(int x) { return x * 3; }
+inline int f38_4(int x) { return x * 4; }
+inline int f38_5(int x) { return x * 5; }
+inline int f38_6(int x) { return x * 6; }
+inline int f38_7(int x) { return x * 7; }
+inline int f38_8(int x) { return x * 8; }
+inline int f38_9(int x) { return x * 9; }
+inline int f38_10(int x) { return x * 10; }
+inline int f38_11(int x) { return x * 11; }
+inline int f38_12(int x) { return x * 12; }
+inline int f38_13(int x) { return x * 13; }
+inline int f38_14(int x) { return x * 14; }
+inline int f38_15(int x) { return x * 15; }
+inline int f38_16(int x) { return x * 16; }
+inline int f38_17(int x) { return x * 17; }
+inline int f38_18(int x) { return x * 18; }
+inline int f38_19(int x) { return x * 19; }
+inline int f38_20(int x) { return x * 20; }
+inline int f38_21(int x) { return x * 21; }
+inline int f38_22(int x) { return x * 22; }
+inline int f38_23(int x) { return x * 23; }
+inline int f38_24(int x) { return x * 24; }
+inline int f38_25(int x) { return x * 25; }
+inline int f38_26(int x) { return x * 26; }
+inline int f38_27(int x) { return x * 27; }
+inline int f38_28(int x) { return x * 28; }
+inline int f38_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3803 */
+#include <vector>
+#include "h9828.h"
+#include "h2609.h"
+#include "h7030.h"
+#include "h1172.h"
+#include "h7521.h"
+#ifdef X
+#include "h1315.h"
+#endif
+struct S3803 { int a; const char *s = "x//y"; };
+inline int f3803_0(int x) { return x * 0; }
+inline int f3803_1(int x) { return x * 1; }
+inline int f3803_2(int x) { return x * 2; }
+inline int f3803_3(int x) { return x * 3; }
+inline int f3803_4(int x) { return x * 4; }
+inline int f3803_5(int x) { return x * 5; }
+inline int f3803_6(int x) { return x * 6; }
+inline int f3803_7(int x) { return x * 7; }
+inline int f3803_8(int x) { return x * 8; }
+inline int f3803_9(int x) { return x * 9; }
+inline int f3803_10(int x) { return x * 10; }
+inline int f3803_11(int x) { return x * 11; }
+inline int f3803_12(int x) { return x * 12; }
+inline int f3803_13(int x) { return x * 13; }
+inline int f3803_14(int x) { return x * 14; }
+inline int f3803_15(int x) { return x * 15; }
+inline int f3803_16(int x) { return x * 16; }
+inline int f3803_17(int x) { return x * 17; }
+inline int f3803_18(int x) { return x * 18; }
+inline int f3803_19(int x) { return x * 19; }
+inline int f3803_20(int x) { return x * 20; }
+inline int f3803_21(int x) { return x * 21; }
+inline int f3803_22(int x) { return x * 22; }
+inline int f3803_23(int x) { return x * 23; }
+inline int f3803_24(int x) { return x * 24; }
+inline int f3803_25(int x) { return x * 25; }
+inline int f3803_26(int x) { return x * 26; }
+inline int f3803_27(int x) { return x * 27; }
+inline int f3803_28(int x) { return x * 28; }
+inline int f3803_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3807 */
+#include <vector>
+#include "h491.h"
+#include "h3476.h"
+#include "h9720.h"
+#include "h8876.h"
+#include "h738.h"
+#ifdef X
+#include "h345.h"
+#endif
+struct S3807 { int a; const char *s = "x//y"; };
+inline int f3807_0(int x) { return x * 0; }
+inline int f3807_1(int x) { return x * 1; }
+inline int f3807_2(int x) { return x * 2; }
+inline int f3807_3(int x) { return x * 3; }
+inline int f3807_4(int x) { return x * 4; }
+inline int f3807_5(int x) { return x * 5; }
+inline int f3807_6(int x) { return x * 6; }
+inline int f3807_7(int x) { return x * 7; }
+inline int f3807_8(int x) { return x * 8; }
+inline int f3807_9(int x) { return x * 9; }
+inline int f3807_10(int x) { return x * 10; }
+inline int f3807_11(int x) { return x * 11; }
+inline int f3807_12(int x) { return x * 12; }
+inline int f3807_13(int x) { return x * 13; }
+inline int f3807_14(int x) { return x * 14; }
+inline int f3807_15(int x) { return x * 15; }
+inline int f3807_16(int x) { return x * 16; }
+inline int f3807_17(int x) { return x * 17; }
+inline int f3807_18(int x) { return x * 18; }
+inline int f3807_19(int x) { return x * 19; }
+inline int f3807_20(int x) { return x * 20; }
+inline int f3807_21(int x) { return x * 21; }
+inline int f3807_22(int x) { return x * 22; }
+inline int f3807_23(int x) { return x * 23; }
+inline int f3807_24(int x) { return x * 24; }
+inline int f3807_25(int x) { return x * 25; }
+inline int f3807_26(int x) { return x * 26; }
+inline int f3807_27(int x) { return x * 27; }
+inline int f3807_28(int x) { return x * 28; }
+inline int f3807_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3813 */
+#include <vector>
+#include "h6617.h"
+#include "h3389.h"
+#include "h1291.h"
+#include "h9835.h"
+#include "h9988.h"
+#ifdef X
+#include "h4739.h"
+#endif
+struct S3813 { int a; const char *s = "x//y"; };
+inline int f3813_0(int x) { return x * 0; }
+inline int f3813_1(int x) { return x * 1; }
+inline int f3813_2(int x) { return x * 2; }
+inline int f3813_3(int x) { return x * 3; }
+inline int f3813_4(int x) { return x * 4; }
+inline int f3813_5(int x) { return x * 5; }
+inline int f3813_6(int x) { return x * 6; }
+inline int f3813_7(int x) { return x * 7; }
+inline int f3813_8(int x) { return x * 8; }
+inline int f3813_9(int x) { return x * 9; }
+inline int f3813_10(int x) { return x * 10; }
+inline int f3813_11(int x) { return x * 11; }
+inline int f3813_12(int x) { return x * 12; }
+inline int f3813_13(int x) { return x * 13; }
+inline int f3813_14(int x) { return x * 14; }
+inline int f3813_15(int x) { return x * 15; }
+inline int f3813_16(int x) { return x * 16; }
+inline int f3813_17(int x) { return x * 17; }
+inline int f3813_18(int x) { return x * 18; }
+inline int f3813_19(int x) { return x * 19; }
+inline int f3813_20(int x) { return x * 20; }
+inline int f3813_21(int x) { return x * 21; }
+inline int f3813_22(int x) { return x * 22; }
+inline int f3813_23(int x) { return x * 23; }
+inline int f3813_24(int x) { return x * 24; }
+inline int f3813_25(int x) { return x * 25; }
+inline int f3813_26(int x) { return x * 26; }
+inline int f3813_27(int x) { return x * 27; }
+inline int f3813_28(int x) { return x * 28; }
+inline int f3813_29(int x) { return x * 29; }
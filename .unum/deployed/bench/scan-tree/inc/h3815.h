@@ -0,0 +1,42 @@
+#pragma once
+/* header 3815 */
+#include <vector>
+#include "h1432.h"
+#include "h3917.h"
+#include "h3549.h"
+#include "h8719.h"
+#include "h3427.h"
+#ifdef X
+#include "h6212.h"
+#endif
+struct S3815 { int a; const char *s = "x//y"; };
+inline int f3815_0(int x) { return x * 0; }
+inline int f3815_1(int x) { return x * 1; }
+inline int f3815_2(int x) { return x * 2; }
+inline int f3815_3(int x) { return x * 3; }
+inline int f3815_4(int x) { return x * 4; }
+inline int f3815_5(int x) { return x * 5; }
+inline int f3815_6(int x) { return x * 6; }
+inline int f3815_7(int x) { return x * 7; }
+inline int f3815_8(int x) { return x * 8; }
+inline int f3815_9(int x) { return x * 9; }
+inline int f3815_10(int x) { return x * 10; }
+inline int f3815_11(int x) { return x * 11; }
+inline int f3815_12(int x) { return x * 12; }
+inline int f3815_13(int x) { return x * 13; }
+inline int f3815_14(int x) { return x * 14; }
+inline int f3815_15(int x) { return x * 15; }
+inline int f3815_16(int x) { return x * 16; }
+inline int f3815_17(int x) { return x * 17; }
+inline int f3815_18(int x) { return x * 18; }
+inline int f3815_19(int x) { return x * 19; }
+inline int f3815_20(int x) { return x * 20; }
+inline int f3815_21(int x) { return x * 21; }
+inline int f3815_22(int x) { return x * 22; }
+inline int f3815_23(int x) { return x * 23; }
+inline int f3815_24(int x) { return x * 24; }
+inline int f3815_25(int x) { return x * 25; }
+inline int f3815_26(int x) { return x * 26; }
+inline int f3815_27(int x) { return x * 27; }
+inline int f3815_28(int x) { return x * 28; }
+inline int f3815_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3816 */
+#include <vector>
+#include "h8660.h"
+#include "h9519.h"
+#include "h4627.h"
+#include "h4779.h"
+#include "h3315.h"
+#ifdef X
+#include "h2422.h"
+#endif
+struct S3816 { int a; const char *s = "x//y"; };
+inline int f3816_0(int x) { return x * 0; }
+inline int f3816_1(int x) { return x * 1; }
+inline int f3816_2(int x) { return x * 2; }
+inline int f3816_3(int x) { return x * 3; }
+inline int f3816_4(int x) { return x * 4; }
+inline int f3816_5(int x) { return x * 5; }
+inline int f3816_6(int x) { return x * 6; }
+inline int f3816_7(int x) { return x * 7; }
+inline int f3816_8(int x) { return x * 8; }
+inline int f3816_9(int x) { return x * 9; }
+inline int f3816_10(int x) { return x * 10; }
+inline int f3816_11(int x) { return x * 11; }
+inline int f3816_12(int x) { return x * 12; }
+inline int f3816_13(int x) { return x * 13; }
+inline int f3816_14(int x) { return x * 14; }
+inline int f3816_15(int x) { return x * 15; }
+inline int f3816_16(int x) { return x * 16; }
+inline int f3816_17(int x) { return x * 17; }
+inline int f3816_18(int x) { return x * 18; }
+inline int f3816_19(int x) { return x * 19; }
+inline int f3816_20(int x) { return x * 20; }
+inline int f3816_21(int x) { return x * 21; }
+inline int f3816_22(int x) { return x * 22; }
+inline int f3816_23(int x) { return x * 23; }
+inline int f3816_24(int x) { return x * 24; }
+inline int f3816_25(int x) { return x * 25; }
+inline int f3816_26(int x) { return x * 26; }
+inline int f3816_27(int x) { return x * 27; }
+inline int f3816_28(int x) { return x * 28; }
+inline int f3816_29(int x) { return x * 29; }
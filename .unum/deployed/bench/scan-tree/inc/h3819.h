@@ -0,0 +1,42 @@
+#pragma once
+/* header 3819 */
+#include <vector>
+#include "h5581.h"
+#include "h5670.h"
+#include "h3418.h"
+#include "h2280.h"
+#include "h4567.h"
+#ifdef X
+#include "h7883.h"
+#endif
+struct S3819 { int a; const char *s = "x//y"; };
+inline int f3819_0(int x) { return x * 0; }
+inline int f3819_1(int x) { return x * 1; }
+inline int f3819_2(int x) { return x * 2; }
+inline int f3819_3(int x) { return x * 3; }
+inline int f3819_4(int x) { return x * 4; }
+inline int f3819_5(int x) { return x * 5; }
+inline int f3819_6(int x) { return x * 6; }
+inline int f3819_7(int x) { return x * 7; }
+inline int f3819_8(int x) { return x * 8; }
+inline int f3819_9(int x) { return x * 9; }
+inline int f3819_10(int x) { return x * 10; }
+inline int f3819_11(int x) { return x * 11; }
+inline int f3819_12(int x) { return x * 12; }
+inline int f3819_13(int x) { return x * 13; }
+inline int f3819_14(int x) { return x * 14; }
+inline int f3819_15(int x) { return x * 15; }
+inline int f3819_16(int x) { return x * 16; }
+inline int f3819_17(int x) { return x * 17; }
+inline int f3819_18(int x) { return x * 18; }
+inline int f3819_19(int x) { return x * 19; }
+inline int f3819_20(int x) { return x * 20; }
+inline int f3819_21(int x) { return x * 21; }
+inline int f3819_22(int x) { return x * 22; }
+inline int f3819_23(int x) { return x * 23; }
+inline int f3819_24(int x) { return x * 24; }
+inline int f3819_25(int x) { return x * 25; }
+inline int f3819_26(int x) { return x * 26; }
+inline int f3819_27(int x) { return x * 27; }
+inline int f3819_28(int x) { return x * 28; }
+inline int f3819_29(int x) { return x * 29; }
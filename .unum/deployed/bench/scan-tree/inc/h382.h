@@ -0,0 +1,42 @@
+#pragma once
+/* header 382 */
+#include <vector>
+#include "h1628.h"
+#include "h2883.h"
+#include "h2992.h"
+#include "h4898.h"
+#include "h6820.h"
+#ifdef X
+#include "h3198.h"
+#endif
+struct S382 { int a; const char *s = "x//y"; };
+inline int f382_0(int x) { return x * 0; }
+inline int f382_1(int x) { return x * 1; }
+inline int f382_2(int x) { return x * 2; }
+inline int f382_3(int x) { return x * 3; }
+inline int f382_4(int x) { return x * 4; }
+inline int f382_5(int x) { return x * 5; }
+inline int f382_6(int x) { return x * 6; }
+inline int f382_7(int x) { return x * 7; }
+inline int f382_8(int x) { return x * 8; }
+inline int f382_9(int x) { return x * 9; }
+inline int f382_10(int x) { return x * 10; }
+inline int f382_11(int x) { return x * 11; }
+inline int f382_12(int x) { return x * 12; }
+inline int f382_13(int x) { return x * 13; }
+inline int f382_14(int x) { return x * 14; }
+inline int f382_15(int x) { return x * 15; }
+inline int f382_16(int x) { return x * 16; }
+inline int f382_17(int x) { return x * 17; }
+inline int f382_18(int x) { return x * 18; }
+inline int f382_19(int x) { return x * 19; }
+inline int f382_20(int x) { return x * 20; }
+inline int f382_21(int x) { return x * 21; }
+inline int f382_22(int x) { return x * 22; }
+inline int f382_23(int x) { return x * 23; }
+inline int f382_24(int x) { return x * 24; }
+inline int f382_25(int x) { return x * 25; }
+inline int f382_26(int x) { return x * 26; }
+inline int f382_27(int x) { return x * 27; }
+inline int f382_28(int x) { return x * 28; }
+inline int f382_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3822 */
+#include <vector>
+#include "h8213.h"
+#include "h1455.h"
+#include "h7317.h"
+#include "h1701.h"
+#include "h6609.h"
+#ifdef X
+#include "h6708.h"
+#endif
+struct S3822 { int a; const char *s = "x//y"; };
+inline int f3822_0(int x) { return x * 0; }
+inline int f3822_1(int x) { return x * 1; }
+inline int f3822_2(int x) { return x * 2; }
+inline int f3822_3(int x) { return x * 3; }
+inline int f3822_4(int x) { return x * 4; }
+inline int f3822_5(int x) { return x * 5; }
+inline int f3822_6(int x) { return x * 6; }
+inline int f3822_7(int x) { return x * 7; }
+inline int f3822_8(int x) { return x * 8; }
+inline int f3822_9(int x) { return x * 9; }
+inline int f3822_10(int x) { return x * 10; }
+inline int f3822_11(int x) { return x * 11; }
+inline int f3822_12(int x) { return x * 12; }
+inline int f3822_13(int x) { return x * 13; }
+inline int f3822_14(int x) { return x * 14; }
+inline int f3822_15(int x) { return x * 15; }
+inline int f3822_16(int x) { return x * 16; }
+inline int f3822_17(int x) { return x * 17; }
+inline int f3822_18(int x) { return x * 18; }
+inline int f3822_19(int x) { return x * 19; }
+inline int f3822_20(int x) { return x * 20; }
+inline int f3822_21(int x) { return x * 21; }
+inline int f3822_22(int x) { return x * 22; }
+inline int f3822_23(int x) { return x * 23; }
+inline int f3822_24(int x) { return x * 24; }
+inline int f3822_25(int x) { return x * 25; }
+inline int f3822_26(int x) { return x * 26; }
+inline int f3822_27(int x) { return x * 27; }
+inline int f3822_28(int x) { return x * 28; }
+inline int f3822_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3827 */
+#include <vector>
+#include "h2739.h"
+#include "h6951.h"
+#include "h4071.h"
+#include "h2203.h"
+#include "h1155.h"
+#ifdef X
+#include "h5977.h"
+#endif
+struct S3827 { int a; const char *s = "x//y"; };
+inline int f3827_0(int x) { return x * 0; }
+inline int f3827_1(int x) { return x * 1; }
+inline int f3827_2(int x) { return x * 2; }
+inline int f3827_3(int x) { return x * 3; }
+inline int f3827_4(int x) { return x * 4; }
+inline int f3827_5(int x) { return x * 5; }
+inline int f3827_6(int x) { return x * 6; }
+inline int f3827_7(int x) { return x * 7; }
+inline int f3827_8(int x) { return x * 8; }
+inline int f3827_9(int x) { return x * 9; }
+inline int f3827_10(int x) { return x * 10; }
+inline int f3827_11(int x) { return x * 11; }
+inline int f3827_12(int x) { return x * 12; }
+inline int f3827_13(int x) { return x * 13; }
+inline int f3827_14(int x) { return x * 14; }
+inline int f3827_15(int x) { return x * 15; }
+inline int f3827_16(int x) { return x * 16; }
+inline int f3827_17(int x) { return x * 17; }
+inline int f3827_18(int x) { return x * 18; }
+inline int f3827_19(int x) { return x * 19; }
+inline int f3827_20(int x) { return x * 20; }
+inline int f3827_21(int x) { return x * 21; }
+inline int f3827_22(int x) { return x * 22; }
+inline int f3827_23(int x) { return x * 23; }
+inline int f3827_24(int x) { return x * 24; }
+inline int f3827_25(int x) { return x * 25; }
+inline int f3827_26(int x) { return x * 26; }
+inline int f3827_27(int x) { return x * 27; }
+inline int f3827_28(int x) { return x * 28; }
+inline int f3827_29(int x) { return x * 29; }
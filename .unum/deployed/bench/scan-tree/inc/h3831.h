@@ -0,0 +1,42 @@
+#pragma once
+/* header 3831 */
+#include <vector>
+#include "h7155.h"
+#include "h1107.h"
+#include "h4488.h"
+#include "h4991.h"
+#include "h8075.h"
+#ifdef X
+#include "h2748.h"
+#endif
+struct S3831 { int a; const char *s = "x//y"; };
+inline int f3831_0(int x) { return x * 0; }
+inline int f3831_1(int x) { return x * 1; }
+inline int f3831_2(int x) { return x * 2; }
+inline int f3831_3(int x) { return x * 3; }
+inline int f3831_4(int x) { return x * 4; }
+inline int f3831_5(int x) { return x * 5; }
+inline int f3831_6(int x) { return x * 6; }
+inline int f3831_7(int x) { return x * 7; }
+inline int f3831_8(int x) { return x * 8; }
+inline int f3831_9(int x) { return x * 9; }
+inline int f3831_10(int x) { return x * 10; }
+inline int f3831_11(int x) { return x * 11; }
+inline int f3831_12(int x) { return x * 12; }
+inline int f3831_13(int x) { return x * 13; }
+inline int f3831_14(int x) { return x * 14; }
+inline int f3831_15(int x) { return x * 15; }
+inline int f3831_16(int x) { return x * 16; }
+inline int f3831_17(int x) { return x * 17; }
+inline int f3831_18(int x) { return x * 18; }
+inline int f3831_19(int x) { return x * 19; }
+inline int f3831_20(int x) { return x * 20; }
+inline int f3831_21(int x) { return x * 21; }
+inline int f3831_22(int x) { return x * 22; }
+inline int f3831_23(int x) { return x * 23; }
+inline int f3831_24(int x) { return x * 24; }
+inline int f3831_25(int x) { return x * 25; }
+inline int f3831_26(int x) { return x * 26; }
+inline int f3831_27(int x) { return x * 27; }
+inline int f3831_28(int x) { return x * 28; }
+inline int f3831_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3834 */
+#include <vector>
+#include "h8083.h"
+#include "h88.h"
+#include "h569.h"
+#include "h4657.h"
+#include "h8577.h"
+#ifdef X
+#include "h2379.h"
+#endif
+struct S3834 { int a; const char *s = "x//y"; };
+inline int f3834_0(int x) { return x * 0; }
+inline int f3834_1(int x) { return x * 1; }
+inline int f3834_2(int x) { return x * 2; }
+inline int f3834_3(int x) { return x * 3; }
+inline int f3834_4(int x) { return x * 4; }
+inline int f3834_5(int x) { return x * 5; }
+inline int f3834_6(int x) { return x * 6; }
+inline int f3834_7(int x) { return x * 7; }
+inline int f3834_8(int x) { return x * 8; }
+inline int f3834_9(int x) { return x * 9; }
+inline int f3834_10(int x) { return x * 10; }
+inline int f3834_11(int x) { return x * 11; }
+inline int f3834_12(int x) { return x * 12; }
+inline int f3834_13(int x) { return x * 13; }
+inline int f3834_14(int x) { return x * 14; }
+inline int f3834_15(int x) { return x * 15; }
+inline int f3834_16(int x) { return x * 16; }
+inline int f3834_17(int x) { return x * 17; }
+inline int f3834_18(int x) { return x * 18; }
+inline int f3834_19(int x) { return x * 19; }
+inline int f3834_20(int x) { return x * 20; }
+inline int f3834_21(int x) { return x * 21; }
+inline int f3834_22(int x) { return x * 22; }
+inline int f3834_23(int x) { return x * 23; }
+inline int f3834_24(int x) { return x * 24; }
+inline int f3834_25(int x) { return x * 25; }
+inline int f3834_26(int x) { return x * 26; }
+inline int f3834_27(int x) { return x * 27; }
+inline int f3834_28(int x) { return x * 28; }
+inline int f3834_29(int x) { return x * 29; }
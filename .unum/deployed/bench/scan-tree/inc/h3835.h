@@ -0,0 +1,42 @@
+#pragma once
+/* header 3835 */
+#include <vector>
+#include "h4790.h"
+#include "h2992.h"
+#include "h6225.h"
+#include "h7749.h"
+#include "h2252.h"
+#ifdef X
+#include "h2510.h"
+#endif
+struct S3835 { int a; const char *s = "x//y"; };
+inline int f3835_0(int x) { return x * 0; }
+inline int f3835_1(int x) { return x * 1; }
+inline int f3835_2(int x) { return x * 2; }
+inline int f3835_3(int x) { return x * 3; }
+inline int f3835_4(int x) { return x * 4; }
+inline int f3835_5(int x) { return x * 5; }
+inline int f3835_6(int x) { return x * 6; }
+inline int f3835_7(int x) { return x * 7; }
+inline int f3835_8(int x) { return x * 8; }
+inline int f3835_9(int x) { return x * 9; }
+inline int f3835_10(int x) { return x * 10; }
+inline int f3835_11(int x) { return x * 11; }
+inline int f3835_12(int x) { return x * 12; }
+inline int f3835_13(int x) { return x * 13; }
+inline int f3835_14(int x) { return x * 14; }
+inline int f3835_15(int x) { return x * 15; }
+inline int f3835_16(int x) { return x * 16; }
+inline int f3835_17(int x) { return x * 17; }
+inline int f3835_18(int x) { return x * 18; }
+inline int f3835_19(int x) { return x * 19; }
+inline int f3835_20(int x) { return x * 20; }
+inline int f3835_21(int x) { return x * 21; }
+inline int f3835_22(int x) { return x * 22; }
+inline int f3835_23(int x) { return x * 23; }
+inline int f3835_24(int x) { return x * 24; }
+inline int f3835_25(int x) { return x * 25; }
+inline int f3835_26(int x) { return x * 26; }
+inline int f3835_27(int x) { return x * 27; }
+inline int f3835_28(int x) { return x * 28; }
+inline int f3835_29(int x) { return x * 29; }
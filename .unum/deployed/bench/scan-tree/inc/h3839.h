@@ -0,0 +1,42 @@
+#pragma once
+/* header 3839 */
+#include <vector>
+#include "h2841.h"
+#include "h8943.h"
+#include "h5956.h"
+#include "h2591.h"
+#include "h8801.h"
+#ifdef X
+#include "h9821.h"
+#endif
+struct S3839 { int a; const char *s = "x//y"; };
+inline int f3839_0(int x) { return x * 0; }
+inline int f3839_1(int x) { return x * 1; }
+inline int f3839_2(int x) { return x * 2; }
+inline int f3839_3(int x) { return x * 3; }
+inline int f3839_4(int x) { return x * 4; }
+inline int f3839_5(int x) { return x * 5; }
+inline int f3839_6(int x) { return x * 6; }
+inline int f3839_7(int x) { return x * 7; }
+inline int f3839_8(int x) { return x * 8; }
+inline int f3839_9(int x) { return x * 9; }
+inline int f3839_10(int x) { return x * 10; }
+inline int f3839_11(int x) { return x * 11; }
+inline int f3839_12(int x) { return x * 12; }
+inline int f3839_13(int x) { return x * 13; }
+inline int f3839_14(int x) { return x * 14; }
+inline int f3839_15(int x) { return x * 15; }
+inline int f3839_16(int x) { return x * 16; }
+inline int f3839_17(int x) { return x * 17; }
+inline int f3839_18(int x) { return x * 18; }
+inline int f3839_19(int x) { return x * 19; }
+inline int f3839_20(int x) { return x * 20; }
+inline int f3839_21(int x) { return x * 21; }
+inline int f3839_22(int x) { return x * 22; }
+inline int f3839_23(int x) { return x * 23; }
+inline int f3839_24(int x) { return x * 24; }
+inline int f3839_25(int x) { return x * 25; }
+inline int f3839_26(int x) { return x * 26; }
+inline int f3839_27(int x) { return x * 27; }
+inline int f3839_28(int x) { return x * 28; }
+inline int f3839_29(int x) { return x * 29; }
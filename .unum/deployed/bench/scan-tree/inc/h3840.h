@@ -0,0 +1,42 @@
+#pragma once
+/* header 3840 */
+#include <vector>
+#include "h6831.h"
+#include "h4561.h"
+#include "h5265.h"
+#include "h4049.h"
+#include "h7939.h"
+#ifdef X
+#include "h1771.h"
+#endif
+struct S3840 { int a; const char *s = "x//y"; };
+inline int f3840_0(int x) { return x * 0; }
+inline int f3840_1(int x) { return x * 1; }
+inline int f3840_2(int x) { return x * 2; }
+inline int f3840_3(int x) { return x * 3; }
+inline int f3840_4(int x) { return x * 4; }
+inline int f3840_5(int x) { return x * 5; }
+inline int f3840_6(int x) { return x * 6; }
+inline int f3840_7(int x) { return x * 7; }
+inline int f3840_8(int x) { return x * 8; }
+inline int f3840_9(int x) { return x * 9; }
+inline int f3840_10(int x) { return x * 10; }
+inline int f3840_11(int x) { return x * 11; }
+inline int f3840_12(int x) { return x * 12; }
+inline int f3840_13(int x) { return x * 13; }
+inline int f3840_14(int x) { return x * 14; }
+inline int f3840_15(int x) { return x * 15; }
+inline int f3840_16(int x) { return x * 16; }
+inline int f3840_17(int x) { return x * 17; }
+inline int f3840_18(int x) { return x * 18; }
+inline int f3840_19(int x) { return x * 19; }
+inline int f3840_20(int x) { return x * 20; }
+inline int f3840_21(int x) { return x * 21; }
+inline int f3840_22(int x) { return x * 22; }
+inline int f3840_23(int x) { return x * 23; }
+inline int f3840_24(int x) { return x * 24; }
+inline int f3840_25(int x) { return x * 25; }
+inline int f3840_26(int x) { return x * 26; }
+inline int f3840_27(int x) { return x * 27; }
+inline int f3840_28(int x) { return x * 28; }
+inline int f3840_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3841 */
+#include <vector>
+#include "h4966.h"
+#include "h6584.h"
+#include "h5447.h"
+#include "h5208.h"
+#include "h7843.h"
+#ifdef X
+#include "h5864.h"
+#endif
+struct S3841 { int a; const char *s = "x//y"; };
+inline int f3841_0(int x) { return x * 0; }
+inline int f3841_1(int x) { return x * 1; }
+inline int f3841_2(int x) { return x * 2; }
+inline int f3841_3(int x) { return x * 3; }
+inline int f3841_4(int x) { return x * 4; }
+inline int f3841_5(int x) { return x * 5; }
+inline int f3841_6(int x) { return x * 6; }
+inline int f3841_7(int x) { return x * 7; }
+inline int f3841_8(int x) { return x * 8; }
+inline int f3841_9(int x) { return x * 9; }
+inline int f3841_10(int x) { return x * 10; }
+inline int f3841_11(int x) { return x * 11; }
+inline int f3841_12(int x) { return x * 12; }
+inline int f3841_13(int x) { return x * 13; }
+inline int f3841_14(int x) { return x * 14; }
+inline int f3841_15(int x) { return x * 15; }
+inline int f3841_16(int x) { return x * 16; }
+inline int f3841_17(int x) { return x * 17; }
+inline int f3841_18(int x) { return x * 18; }
+inline int f3841_19(int x) { return x * 19; }
+inline int f3841_20(int x) { return x * 20; }
+inline int f3841_21(int x) { return x * 21; }
+inline int f3841_22(int x) { return x * 22; }
+inline int f3841_23(int x) { return x * 23; }
+inline int f3841_24(int x) { return x * 24; }
+inline int f3841_25(int x) { return x * 25; }
+inline int f3841_26(int x) { return x * 26; }
+inline int f3841_27(int x) { return x * 27; }
+inline int f3841_28(int x) { return x * 28; }
+inline int f3841_29(int x) { return x * 29; }
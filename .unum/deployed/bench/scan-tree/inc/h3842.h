@@ -0,0 +1,42 @@
+#pragma once
+/* header 3842 */
+#include <vector>
+#include "h3600.h"
+#include "h1661.h"
+#include "h628.h"
+#include "h6602.h"
+#include "h4732.h"
+#ifdef X
+#include "h2820.h"
+#endif
+struct S3842 { int a; const char *s = "x//y"; };
+inline int f3842_0(int x) { return x * 0; }
+inline int f3842_1(int x) { return x * 1; }
+inline int f3842_2(int x) { return x * 2; }
+inline int f3842_3(int x) { return x * 3; }
+inline int f3842_4(int x) { return x * 4; }
+inline int f3842_5(int x) { return x * 5; }
+inline int f3842_6(int x) { return x * 6; }
+inline int f3842_7(int x) { return x * 7; }
+inline int f3842_8(int x) { return x * 8; }
+inline int f3842_9(int x) { return x * 9; }
+inline int f3842_10(int x) { return x * 10; }
+inline int f3842_11(int x) { return x * 11; }
+inline int f3842_12(int x) { return x * 12; }
+inline int f3842_13(int x) { return x * 13; }
+inline int f3842_14(int x) { return x * 14; }
+inline int f3842_15(int x) { return x * 15; }
+inline int f3842_16(int x) { return x * 16; }
+inline int f3842_17(int x) { return x * 17; }
+inline int f3842_18(int x) { return x * 18; }
+inline int f3842_19(int x) { return x * 19; }
+inline int f3842_20(int x) { return x * 20; }
+inline int f3842_21(int x) { return x * 21; }
+inline int f3842_22(int x) { return x * 22; }
+inline int f3842_23(int x) { return x * 23; }
+inline int f3842_24(int x) { return x * 24; }
+inline int f3842_25(int x) { return x * 25; }
+inline int f3842_26(int x) { return x * 26; }
+inline int f3842_27(int x) { return x * 27; }
+inline int f3842_28(int x) { return x * 28; }
+inline int f3842_29(int x) { return x * 29; }
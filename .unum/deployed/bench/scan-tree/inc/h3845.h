@@ -0,0 +1,42 @@
+#pragma once
+/* header 3845 */
+#include <vector>
+#include "h1423.h"
+#include "h9698.h"
+#include "h5353.h"
+#include "h2966.h"
+#include "h6742.h"
+#ifdef X
+#include "h969.h"
+#endif
+struct S3845 { int a; const char *s = "x//y"; };
+inline int f3845_0(int x) { return x * 0; }
+inline int f3845_1(int x) { return x * 1; }
+inline int f3845_2(int x) { return x * 2; }
+inline int f3845_3(int x) { return x * 3; }
+inline int f3845_4(int x) { return x * 4; }
+inline int f3845_5(int x) { return x * 5; }
+inline int f3845_6(int x) { return x * 6; }
+inline int f3845_7(int x) { return x * 7; }
+inline int f3845_8(int x) { return x * 8; }
+inline int f3845_9(int x) { return x * 9; }
+inline int f3845_10(int x) { return x * 10; }
+inline int f3845_11(int x) { return x * 11; }
+inline int f3845_12(int x) { return x * 12; }
+inline int f3845_13(int x) { return x * 13; }
+inline int f3845_14(int x) { return x * 14; }
+inline int f3845_15(int x) { return x * 15; }
+inline int f3845_16(int x) { return x * 16; }
+inline int f3845_17(int x) { return x * 17; }
+inline int f3845_18(int x) { return x * 18; }
+inline int f3845_19(int x) { return x * 19; }
+inline int f3845_20(int x) { return x * 20; }
+inline int f3845_21(int x) { return x * 21; }
+inline int f3845_22(int x) { return x * 22; }
+inline int f3845_23(int x) { return x * 23; }
+inline int f3845_24(int x) { return x * 24; }
+inline int f3845_25(int x) { return x * 25; }
+inline int f3845_26(int x) { return x * 26; }
+inline int f3845_27(int x) { return x * 27; }
+inline int f3845_28(int x) { return x * 28; }
+inline int f3845_29(int x) { return x * 29; }
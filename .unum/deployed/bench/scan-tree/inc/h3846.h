@@ -0,0 +1,42 @@
+#pragma once
+/* header 3846 */
+#include <vector>
+#include "h8441.h"
+#include "h7712.h"
+#include "h908.h"
+#include "h5345.h"
+#include "h5391.h"
+#ifdef X
+#include "h5069.h"
+#endif
+struct S3846 { int a; const char *s = "x//y"; };
+inline int f3846_0(int x) { return x * 0; }
+inline int f3846_1(int x) { return x * 1; }
+inline int f3846_2(int x) { return x * 2; }
+inline int f3846_3(int x) { return x * 3; }
+inline int f3846_4(int x) { return x * 4; }
+inline int f3846_5(int x) { return x * 5; }
+inline int f3846_6(int x) { return x * 6; }
+inline int f3846_7(int x) { return x * 7; }
+inline int f3846_8(int x) { return x * 8; }
+inline int f3846_9(int x) { return x * 9; }
+inline int f3846_10(int x) { return x * 10; }
+inline int f3846_11(int x) { return x * 11; }
+inline int f3846_12(int x) { return x * 12; }
+inline int f3846_13(int x) { return x * 13; }
+inline int f3846_14(int x) { return x * 14; }
+inline int f3846_15(int x) { return x * 15; }
+inline int f3846_16(int x) { return x * 16; }
+inline int f3846_17(int x) { return x * 17; }
+inline int f3846_18(int x) { return x * 18; }
+inline int f3846_19(int x) { return x * 19; }
+inline int f3846_20(int x) { return x * 20; }
+inline int f3846_21(int x) { return x * 21; }
+inline int f3846_22(int x) { return x * 22; }
+inline int f3846_23(int x) { return x * 23; }
+inline int f3846_24(int x) { return x * 24; }
+inline int f3846_25(int x) { return x * 25; }
+inline int f3846_26(int x) { return x * 26; }
+inline int f3846_27(int x) { return x * 27; }
+inline int f3846_28(int x) { return x * 28; }
+inline int f3846_29(int x) { return x * 29; }
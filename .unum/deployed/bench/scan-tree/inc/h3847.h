@@ -0,0 +1,42 @@
+#pragma once
+/* header 3847 */
+#include <vector>
+#include "h8840.h"
+#include "h3389.h"
+#include "h8715.h"
+#include "h8327.h"
+#include "h475.h"
+#ifdef X
+#include "h3019.h"
+#endif
+struct S3847 { int a; const char *s = "x//y"; };
+inline int f3847_0(int x) { return x * 0; }
+inline int f3847_1(int x) { return x * 1; }
+inline int f3847_2(int x) { return x * 2; }
+inline int f3847_3(int x) { return x * 3; }
+inline int f3847_4(int x) { return x * 4; }
+inline int f3847_5(int x) { return x * 5; }
+inline int f3847_6(int x) { return x * 6; }
+inline int f3847_7(int x) { return x * 7; }
+inline int f3847_8(int x) { return x * 8; }
+inline int f3847_9(int x) { return x * 9; }
+inline int f3847_10(int x) { return x * 10; }
+inline int f3847_11(int x) { return x * 11; }
+inline int f3847_12(int x) { return x * 12; }
+inline int f3847_13(int x) { return x * 13; }
+inline int f3847_14(int x) { return x * 14; }
+inline int f3847_15(int x) { return x * 15; }
+inline int f3847_16(int x) { return x * 16; }
+inline int f3847_17(int x) { return x * 17; }
+inline int f3847_18(int x) { return x * 18; }
+inline int f3847_19(int x) { return x * 19; }
+inline int f3847_20(int x) { return x * 20; }
+inline int f3847_21(int x) { return x * 21; }
+inline int f3847_22(int x) { return x * 22; }
+inline int f3847_23(int x) { return x * 23; }
+inline int f3847_24(int x) { return x * 24; }
+inline int f3847_25(int x) { return x * 25; }
+inline int f3847_26(int x) { return x * 26; }
+inline int f3847_27(int x) { return x * 27; }
+inline int f3847_28(int x) { return x * 28; }
+inline int f3847_29(int x) { return x * 29; }
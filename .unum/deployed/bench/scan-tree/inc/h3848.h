@@ -0,0 +1,42 @@
+#pragma once
+/* header 3848 */
+#include <vector>
+#include "h6055.h"
+#include "h7488.h"
+#include "h5670.h"
+#include "h4281.h"
+#include "h252.h"
+#ifdef X
+#include "h1083.h"
+#endif
+struct S3848 { int a; const char *s = "x//y"; };
+inline int f3848_0(int x) { return x * 0; }
+inline int f3848_1(int x) { return x * 1; }
+inline int f3848_2(int x) { return x * 2; }
+inline int f3848_3(int x) { return x * 3; }
+inline int f3848_4(int x) { return x * 4; }
+inline int f3848_5(int x) { return x * 5; }
+inline int f3848_6(int x) { return x * 6; }
+inline int f3848_7(int x) { return x * 7; }
+inline int f3848_8(int x) { return x * 8; }
+inline int f3848_9(int x) { return x * 9; }
+inline int f3848_10(int x) { return x * 10; }
+inline int f3848_11(int x) { return x * 11; }
+inline int f3848_12(int x) { return x * 12; }
+inline int f3848_13(int x) { return x * 13; }
+inline int f3848_14(int x) { return x * 14; }
+inline int f3848_15(int x) { return x * 15; }
+inline int f3848_16(int x) { return x * 16; }
+inline int f3848_17(int x) { return x * 17; }
+inline int f3848_18(int x) { return x * 18; }
+inline int f3848_19(int x) { return x * 19; }
+inline int f3848_20(int x) { return x * 20; }
+inline int f3848_21(int x) { return x * 21; }
+inline int f3848_22(int x) { return x * 22; }
+inline int f3848_23(int x) { return x * 23; }
+inline int f3848_24(int x) { return x * 24; }
+inline int f3848_25(int x) { return x * 25; }
+inline int f3848_26(int x) { return x * 26; }
+inline int f3848_27(int x) { return x * 27; }
+inline int f3848_28(int x) { return x * 28; }
+inline int f3848_29(int x) { return x * 29; }
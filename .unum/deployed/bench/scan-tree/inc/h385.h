@@ -0,0 +1,42 @@
+#pragma once
+/* header 385 */
+#include <vector>
+#include "h781.h"
+#include "h7656.h"
+#include "h395.h"
+#include "h6180.h"
+#include "h4604.h"
+#ifdef X
+#include "h3435.h"
+#endif
+struct S385 { int a; const char *s = "x//y"; };
+inline int f385_0(int x) { return x * 0; }
+inline int f385_1(int x) { return x * 1; }
+inline int f385_2(int x) { return x * 2; }
+inline int f385_3(int x) { return x * 3; }
+inline int f385_4(int x) { return x * 4; }
+inline int f385_5(int x) { return x * 5; }
+inline int f385_6(int x) { return x * 6; }
+inline int f385_7(int x) { return x * 7; }
+inline int f385_8(int x) { return x * 8; }
+inline int f385_9(int x) { return x * 9; }
+inline int f385_10(int x) { return x * 10; }
+inline int f385_11(int x) { return x * 11; }
+inline int f385_12(int x) { return x * 12; }
+inline int f385_13(int x) { return x * 13; }
+inline int f385_14(int x) { return x * 14; }
+inline int f385_15(int x) { return x * 15; }
+inline int f385_16(int x) { return x * 16; }
+inline int f385_17(int x) { return x * 17; }
+inline int f385_18(int x) { return x * 18; }
+inline int f385_19(int x) { return x * 19; }
+inline int f385_20(int x) { return x * 20; }
+inline int f385_21(int x) { return x * 21; }
+inline int f385_22(int x) { return x * 22; }
+inline int f385_23(int x) { return x * 23; }
+inline int f385_24(int x) { return x * 24; }
+inline int f385_25(int x) { return x * 25; }
+inline int f385_26(int x) { return x * 26; }
+inline int f385_27(int x) { return x * 27; }
+inline int f385_28(int x) { return x * 28; }
+inline int f385_29(int x) { return x * 29; }
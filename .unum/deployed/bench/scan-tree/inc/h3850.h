@@ -0,0 +1,42 @@
+#pragma once
+/* header 3850 */
+#include <vector>
+#include "h4467.h"
+#include "h6216.h"
+#include "h3242.h"
+#include "h648.h"
+#include "h3268.h"
+#ifdef X
+#include "h9018.h"
+#endif
+struct S3850 { int a; const char *s = "x//y"; };
+inline int f3850_0(int x) { return x * 0; }
+inline int f3850_1(int x) { return x * 1; }
+inline int f3850_2(int x) { return x * 2; }
+inline int f3850_3(int x) { return x * 3; }
+inline int f3850_4(int x) { return x * 4; }
+inline int f3850_5(int x) { return x * 5; }
+inline int f3850_6(int x) { return x * 6; }
+inline int f3850_7(int x) { return x * 7; }
+inline int f3850_8(int x) { return x * 8; }
+inline int f3850_9(int x) { return x * 9; }
+inline int f3850_10(int x) { return x * 10; }
+inline int f3850_11(int x) { return x * 11; }
+inline int f3850_12(int x) { return x * 12; }
+inline int f3850_13(int x) { return x * 13; }
+inline int f3850_14(int x) { return x * 14; }
+inline int f3850_15(int x) { return x * 15; }
+inline int f3850_16(int x) { return x * 16; }
+inline int f3850_17(int x) { return x * 17; }
+inline int f3850_18(int x) { return x * 18; }
+inline int f3850_19(int x) { return x * 19; }
+inline int f3850_20(int x) { return x * 20; }
+inline int f3850_21(int x) { return x * 21; }
+inline int f3850_22(int x) { return x * 22; }
+inline int f3850_23(int x) { return x * 23; }
+inline int f3850_24(int x) { return x * 24; }
+inline int f3850_25(int x) { return x * 25; }
+inline int f3850_26(int x) { return x * 26; }
+inline int f3850_27(int x) { return x * 27; }
+inline int f3850_28(int x) { return x * 28; }
+inline int f3850_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3851 */
+#include <vector>
+#include "h4529.h"
+#include "h3941.h"
+#include "h7341.h"
+#include "h6756.h"
+#include "h508.h"
+#ifdef X
+#include "h4556.h"
+#endif
+struct S3851 { int a; const char *s = "x//y"; };
+inline int f3851_0(int x) { return x * 0; }
+inline int f3851_1(int x) { return x * 1; }
+inline int f3851_2(int x) { return x * 2; }
+inline int f3851_3(int x) { return x * 3; }
+inline int f3851_4(int x) { return x * 4; }
+inline int f3851_5(int x) { return x * 5; }
+inline int f3851_6(int x) { return x * 6; }
+inline int f3851_7(int x) { return x * 7; }
+inline int f3851_8(int x) { return x * 8; }
+inline int f3851_9(int x) { return x * 9; }
+inline int f3851_10(int x) { return x * 10; }
+inline int f3851_11(int x) { return x * 11; }
+inline int f3851_12(int x) { return x * 12; }
+inline int f3851_13(int x) { return x * 13; }
+inline int f3851_14(int x) { return x * 14; }
+inline int f3851_15(int x) { return x * 15; }
+inline int f3851_16(int x) { return x * 16; }
+inline int f3851_17(int x) { return x * 17; }
+inline int f3851_18(int x) { return x * 18; }
+inline int f3851_19(int x) { return x * 19; }
+inline int f3851_20(int x) { return x * 20; }
+inline int f3851_21(int x) { return x * 21; }
+inline int f3851_22(int x) { return x * 22; }
+inline int f3851_23(int x) { return x * 23; }
+inline int f3851_24(int x) { return x * 24; }
+inline int f3851_25(int x) { return x * 25; }
+inline int f3851_26(int x) { return x * 26; }
+inline int f3851_27(int x) { return x * 27; }
+inline int f3851_28(int x) { return x * 28; }
+inline int f3851_29(int x) { return x * 29; }
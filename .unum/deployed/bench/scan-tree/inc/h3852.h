@@ -0,0 +1,42 @@
+#pragma once
+/* header 3852 */
+#include <vector>
+#include "h5117.h"
+#include "h1106.h"
+#include "h9919.h"
+#include "h9863.h"
+#include "h1719.h"
+#ifdef X
+#include "h6688.h"
+#endif
+struct S3852 { int a; const char *s = "x//y"; };
+inline int f3852_0(int x) { return x * 0; }
+inline int f3852_1(int x) { return x * 1; }
+inline int f3852_2(int x) { return x * 2; }
+inline int f3852_3(int x) { return x * 3; }
+inline int f3852_4(int x) { return x * 4; }
+inline int f3852_5(int x) { return x * 5; }
+inline int f3852_6(int x) { return x * 6; }
+inline int f3852_7(int x) { return x * 7; }
+inline int f3852_8(int x) { return x * 8; }
+inline int f3852_9(int x) { return x * 9; }
+inline int f3852_10(int x) { return x * 10; }
+inline int f3852_11(int x) { return x * 11; }
+inline int f3852_12(int x) { return x * 12; }
+inline int f3852_13(int x) { return x * 13; }
+inline int f3852_14(int x) { return x * 14; }
+inline int f3852_15(int x) { return x * 15; }
+inline int f3852_16(int x) { return x * 16; }
+inline int f3852_17(int x) { return x * 17; }
+inline int f3852_18(int x) { return x * 18; }
+inline int f3852_19(int x) { return x * 19; }
+inline int f3852_20(int x) { return x * 20; }
+inline int f3852_21(int x) { return x * 21; }
+inline int f3852_22(int x) { return x * 22; }
+inline int f3852_23(int x) { return x * 23; }
+inline int f3852_24(int x) { return x * 24; }
+inline int f3852_25(int x) { return x * 25; }
+inline int f3852_26(int x) { return x * 26; }
+inline int f3852_27(int x) { return x * 27; }
+inline int f3852_28(int x) { return x * 28; }
+inline int f3852_29(int x) { return x * 29; }
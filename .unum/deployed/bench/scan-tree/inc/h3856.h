@@ -0,0 +1,42 @@
+#pragma once
+/* header 3856 */
+#include <vector>
+#include "h8869.h"
+#include "h4490.h"
+#include "h6784.h"
+#include "h3012.h"
+#include "h9508.h"
+#ifdef X
+#include "h5770.h"
+#endif
+struct S3856 { int a; const char *s = "x//y"; };
+inline int f3856_0(int x) { return x * 0; }
+inline int f3856_1(int x) { return x * 1; }
+inline int f3856_2(int x) { return x * 2; }
+inline int f3856_3(int x) { return x * 3; }
+inline int f3856_4(int x) { return x * 4; }
+inline int f3856_5(int x) { return x * 5; }
+inline int f3856_6(int x) { return x * 6; }
+inline int f3856_7(int x) { return x * 7; }
+inline int f3856_8(int x) { return x * 8; }
+inline int f3856_9(int x) { return x * 9; }
+inline int f3856_10(int x) { return x * 10; }
+inline int f3856_11(int x) { return x * 11; }
+inline int f3856_12(int x) { return x * 12; }
+inline int f3856_13(int x) { return x * 13; }
+inline int f3856_14(int x) { return x * 14; }
+inline int f3856_15(int x) { return x * 15; }
+inline int f3856_16(int x) { return x * 16; }
+inline int f3856_17(int x) { return x * 17; }
+inline int f3856_18(int x) { return x * 18; }
+inline int f3856_19(int x) { return x * 19; }
+inline int f3856_20(int x) { return x * 20; }
+inline int f3856_21(int x) { return x * 21; }
+inline int f3856_22(int x) { return x * 22; }
+inline int f3856_23(int x) { return x * 23; }
+inline int f3856_24(int x) { return x * 24; }
+inline int f3856_25(int x) { return x * 25; }
+inline int f3856_26(int x) { return x * 26; }
+inline int f3856_27(int x) { return x * 27; }
+inline int f3856_28(int x) { return x * 28; }
+inline int f3856_29(int x) { return x * 29; }
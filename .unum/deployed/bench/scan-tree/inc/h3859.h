@@ -0,0 +1,42 @@
+#pragma once
+/* header 3859 */
+#include <vector>
+#include "h2987.h"
+#include "h6698.h"
+#include "h3184.h"
+#include "h2148.h"
+#include "h7809.h"
+#ifdef X
+#include "h8128.h"
+#endif
+struct S3859 { int a; const char *s = "x//y"; };
+inline int f3859_0(int x) { return x * 0; }
+inline int f3859_1(int x) { return x * 1; }
+inline int f3859_2(int x) { return x * 2; }
+inline int f3859_3(int x) { return x * 3; }
+inline int f3859_4(int x) { return x * 4; }
+inline int f3859_5(int x) { return x * 5; }
+inline int f3859_6(int x) { return x * 6; }
+inline int f3859_7(int x) { return x * 7; }
+inline int f3859_8(int x) { return x * 8; }
+inline int f3859_9(int x) { return x * 9; }
+inline int f3859_10(int x) { return x * 10; }
+inline int f3859_11(int x) { return x * 11; }
+inline int f3859_12(int x) { return x * 12; }
+inline int f3859_13(int x) { return x * 13; }
+inline int f3859_14(int x) { return x * 14; }
+inline int f3859_15(int x) { return x * 15; }
+inline int f3859_16(int x) { return x * 16; }
+inline int f3859_17(int x) { return x * 17; }
+inline int f3859_18(int x) { return x * 18; }
+inline int f3859_19(int x) { return x * 19; }
+inline int f3859_20(int x) { return x * 20; }
+inline int f3859_21(int x) { return x * 21; }
+inline int f3859_22(int x) { return x * 22; }
+inline int f3859_23(int x) { return x * 23; }
+inline int f3859_24(int x) { return x * 24; }
+inline int f3859_25(int x) { return x * 25; }
+inline int f3859_26(int x) { return x * 26; }
+inline int f3859_27(int x) { return x * 27; }
+inline int f3859_28(int x) { return x * 28; }
+inline int f3859_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 386 */
+#include <vector>
+#include "h9556.h"
+#include "h1489.h"
+#include "h4029.h"
+#include "h252.h"
+#include "h6411.h"
+#ifdef X
+#include "h4479.h"
+#endif
+struct S386 { int a; const char *s = "x//y"; };
+inline int f386_0(int x) { return x * 0; }
+inline int f386_1(int x) { return x * 1; }
+inline int f386_2(int x) { return x * 2; }
+inline int f386_3(int x) { return x * 3; }
+inline int f386_4(int x) { return x * 4; }
+inline int f386_5(int x) { return x * 5; }
+inline int f386_6(int x) { return x * 6; }
+inline int f386_7(int x) { return x * 7; }
+inline int f386_8(int x) { return x * 8; }
+inline int f386_9(int x) { return x * 9; }
+inline int f386_10(int x) { return x * 10; }
+inline int f386_11(int x) { return x * 11; }
+inline int f386_12(int x) { return x * 12; }
+inline int f386_13(int x) { return x * 13; }
+inline int f386_14(int x) { return x * 14; }
+inline int f386_15(int x) { return x * 15; }
+inline int f386_16(int x) { return x * 16; }
+inline int f386_17(int x) { return x * 17; }
+inline int f386_18(int x) { return x * 18; }
+inline int f386_19(int x) { return x * 19; }
+inline int f386_20(int x) { return x * 20; }
+inline int f386_21(int x) { return x * 21; }
+inline int f386_22(int x) { return x * 22; }
+inline int f386_23(int x) { return x * 23; }
+inline int f386_24(int x) { return x * 24; }
+inline int f386_25(int x) { return x * 25; }
+inline int f386_26(int x) { return x * 26; }
+inline int f386_27(int x) { return x * 27; }
+inline int f386_28(int x) { return x * 28; }
+inline int f386_29(int x) { return x * 29; }
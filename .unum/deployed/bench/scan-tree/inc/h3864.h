@@ -0,0 +1,42 @@
+#pragma once
+/* header 3864 */
+#include <vector>
+#include "h244.h"
+#include "h6090.h"
+#include "h4137.h"
+#include "h9653.h"
+#include "h8532.h"
+#ifdef X
+#include "h3462.h"
+#endif
+struct S3864 { int a; const char *s = "x//y"; };
+inline int f3864_0(int x) { return x * 0; }
+inline int f3864_1(int x) { return x * 1; }
+inline int f3864_2(int x) { return x * 2; }
+inline int f3864_3(int x) { return x * 3; }
+inline int f3864_4(int x) { return x * 4; }
+inline int f3864_5(int x) { return x * 5; }
+inline int f3864_6(int x) { return x * 6; }
+inline int f3864_7(int x) { return x * 7; }
+inline int f3864_8(int x) { return x * 8; }
+inline int f3864_9(int x) { return x * 9; }
+inline int f3864_10(int x) { return x * 10; }
+inline int f3864_11(int x) { return x * 11; }
+inline int f3864_12(int x) { return x * 12; }
+inline int f3864_13(int x) { return x * 13; }
+inline int f3864_14(int x) { return x * 14; }
+inline int f3864_15(int x) { return x * 15; }
+inline int f3864_16(int x) { return x * 16; }
+inline int f3864_17(int x) { return x * 17; }
+inline int f3864_18(int x) { return x * 18; }
+inline int f3864_19(int x) { return x * 19; }
+inline int f3864_20(int x) { return x * 20; }
+inline int f3864_21(int x) { return x * 21; }
+inline int f3864_22(int x) { return x * 22; }
+inline int f3864_23(int x) { return x * 23; }
+inline int f3864_24(int x) { return x * 24; }
+inline int f3864_25(int x) { return x * 25; }
+inline int f3864_26(int x) { return x * 26; }
+inline int f3864_27(int x) { return x * 27; }
+inline int f3864_28(int x) { return x * 28; }
+inline int f3864_29(int x) { return x * 29; }
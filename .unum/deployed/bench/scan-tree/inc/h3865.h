@@ -0,0 +1,42 @@
+#pragma once
+/* header 3865 */
+#include <vector>
+#include "h3870.h"
+#include "h2970.h"
+#include "h8736.h"
+#include "h1496.h"
+#include "h197.h"
+#ifdef X
+#include "h7199.h"
+#endif
+struct S3865 { int a; const char *s = "x//y"; };
+inline int f3865_0(int x) { return x * 0; }
+inline int f3865_1(int x) { return x * 1; }
+inline int f3865_2(int x) { return x * 2; }
+inline int f3865_3(int x) { return x * 3; }
+inline int f3865_4(int x) { return x * 4; }
+inline int f3865_5(int x) { return x * 5; }
+inline int f3865_6(int x) { return x * 6; }
+inline int f3865_7(int x) { return x * 7; }
+inline int f3865_8(int x) { return x * 8; }
+inline int f3865_9(int x) { return x * 9; }
+inline int f3865_10(int x) { return x * 10; }
+inline int f3865_11(int x) { return x * 11; }
+inline int f3865_12(int x) { return x * 12; }
+inline int f3865_13(int x) { return x * 13; }
+inline int f3865_14(int x) { return x * 14; }
+inline int f3865_15(int x) { return x * 15; }
+inline int f3865_16(int x) { return x * 16; }
+inline int f3865_17(int x) { return x * 17; }
+inline int f3865_18(int x) { return x * 18; }
+inline int f3865_19(int x) { return x * 19; }
+inline int f3865_20(int x) { return x * 20; }
+inline int f3865_21(int x) { return x * 21; }
+inline int f3865_22(int x) { return x * 22; }
+inline int f3865_23(int x) { return x * 23; }
+inline int f3865_24(int x) { return x * 24; }
+inline int f3865_25(int x) { return x * 25; }
+inline int f3865_26(int x) { return x * 26; }
+inline int f3865_27(int x) { return x * 27; }
+inline int f3865_28(int x) { return x * 28; }
+inline int f3865_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3866 */
+#include <vector>
+#include "h4664.h"
+#include "h9989.h"
+#include "h726.h"
+#include "h2511.h"
+#include "h9586.h"
+#ifdef X
+#include "h4575.h"
+#endif
+struct S3866 { int a; const char *s = "x//y"; };
+inline int f3866_0(int x) { return x * 0; }
+inline int f3866_1(int x) { return x * 1; }
+inline int f3866_2(int x) { return x * 2; }
+inline int f3866_3(int x) { return x * 3; }
+inline int f3866_4(int x) { return x * 4; }
+inline int f3866_5(int x) { return x * 5; }
+inline int f3866_6(int x) { return x * 6; }
+inline int f3866_7(int x) { return x * 7; }
+inline int f3866_8(int x) { return x * 8; }
+inline int f3866_9(int x) { return x * 9; }
+inline int f3866_10(int x) { return x * 10; }
+inline int f3866_11(int x) { return x * 11; }
+inline int f3866_12(int x) { return x * 12; }
+inline int f3866_13(int x) { return x * 13; }
+inline int f3866_14(int x) { return x * 14; }
+inline int f3866_15(int x) { return x * 15; }
+inline int f3866_16(int x) { return x * 16; }
+inline int f3866_17(int x) { return x * 17; }
+inline int f3866_18(int x) { return x * 18; }
+inline int f3866_19(int x) { return x * 19; }
+inline int f3866_20(int x) { return x * 20; }
+inline int f3866_21(int x) { return x * 21; }
+inline int f3866_22(int x) { return x * 22; }
+inline int f3866_23(int x) { return x * 23; }
+inline int f3866_24(int x) { return x * 24; }
+inline int f3866_25(int x) { return x * 25; }
+inline int f3866_26(int x) { return x * 26; }
+inline int f3866_27(int x) { return x * 27; }
+inline int f3866_28(int x) { return x * 28; }
+inline int f3866_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3869 */
+#include <vector>
+#include "h7848.h"
+#include "h6309.h"
+#include "h7233.h"
+#include "h4394.h"
+#include "h5241.h"
+#ifdef X
+#include "h262.h"
+#endif
+struct S3869 { int a; const char *s = "x//y"; };
+inline int f3869_0(int x) { return x * 0; }
+inline int f3869_1(int x) { return x * 1; }
+inline int f3869_2(int x) { return x * 2; }
+inline int f3869_3(int x) { return x * 3; }
+inline int f3869_4(int x) { return x * 4; }
+inline int f3869_5(int x) { return x * 5; }
+inline int f3869_6(int x) { return x * 6; }
+inline int f3869_7(int x) { return x * 7; }
+inline int f3869_8(int x) { return x * 8; }
+inline int f3869_9(int x) { return x * 9; }
+inline int f3869_10(int x) { return x * 10; }
+inline int f3869_11(int x) { return x * 11; }
+inline int f3869_12(int x) { return x * 12; }
+inline int f3869_13(int x) { return x * 13; }
+inline int f3869_14(int x) { return x * 14; }
+inline int f3869_15(int x) { return x * 15; }
+inline int f3869_16(int x) { return x * 16; }
+inline int f3869_17(int x) { return x * 17; }
+inline int f3869_18(int x) { return x * 18; }
+inline int f3869_19(int x) { return x * 19; }
+inline int f3869_20(int x) { return x * 20; }
+inline int f3869_21(int x) { return x * 21; }
+inline int f3869_22(int x) { return x * 22; }
+inline int f3869_23(int x) { return x * 23; }
+inline int f3869_24(int x) { return x * 24; }
+inline int f3869_25(int x) { return x * 25; }
+inline int f3869_26(int x) { return x * 26; }
+inline int f3869_27(int x) { return x * 27; }
+inline int f3869_28(int x) { return x * 28; }
+inline int f3869_29(int x) { return x * 29; }
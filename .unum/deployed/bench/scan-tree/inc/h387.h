@@ -0,0 +1,42 @@
+#pragma once
+/* header 387 */
+#include <vector>
+#include "h2393.h"
+#include "h8480.h"
+#include "h2273.h"
+#include "h8522.h"
+#include "h7366.h"
+#ifdef X
+#include "h7821.h"
+#endif
+struct S387 { int a; const char *s = "x//y"; };
+inline int f387_0(int x) { return x * 0; }
+inline int f387_1(int x) { return x * 1; }
+inline int f387_2(int x) { return x * 2; }
+inline int f387_3(int x) { return x * 3; }
+inline int f387_4(int x) { return x * 4; }
+inline int f387_5(int x) { return x * 5; }
+inline int f387_6(int x) { return x * 6; }
+inline int f387_7(int x) { return x * 7; }
+inline int f387_8(int x) { return x * 8; }
+inline int f387_9(int x) { return x * 9; }
+inline int f387_10(int x) { return x * 10; }
+inline int f387_11(int x) { return x * 11; }
+inline int f387_12(int x) { return x * 12; }
+inline int f387_13(int x) { return x * 13; }
+inline int f387_14(int x) { return x * 14; }
+inline int f387_15(int x) { return x * 15; }
+inline int f387_16(int x) { return x * 16; }
+inline int f387_17(int x) { return x * 17; }
+inline int f387_18(int x) { return x * 18; }
+inline int f387_19(int x) { return x * 19; }
+inline int f387_20(int x) { return x * 20; }
+inline int f387_21(int x) { return x * 21; }
+inline int f387_22(int x) { return x * 22; }
+inline int f387_23(int x) { return x * 23; }
+inline int f387_24(int x) { return x * 24; }
+inline int f387_25(int x) { return x * 25; }
+inline int f387_26(int x) { return x * 26; }
+inline int f387_27(int x) { return x * 27; }
+inline int f387_28(int x) { return x * 28; }
+inline int f387_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3871 */
+#include <vector>
+#include "h28.h"
+#include "h3671.h"
+#include "h9372.h"
+#include "h2931.h"
+#include "h876.h"
+#ifdef X
+#include "h3650.h"
+#endif
+struct S3871 { int a; const char *s = "x//y"; };
+inline int f3871_0(int x) { return x * 0; }
+inline int f3871_1(int x) { return x * 1; }
+inline int f3871_2(int x) { return x * 2; }
+inline int f3871_3(int x) { return x * 3; }
+inline int f3871_4(int x) { return x * 4; }
+inline int f3871_5(int x) { return x * 5; }
+inline int f3871_6(int x) { return x * 6; }
+inline int f3871_7(int x) { return x * 7; }
+inline int f3871_8(int x) { return x * 8; }
+inline int f3871_9(int x) { return x * 9; }
+inline int f3871_10(int x) { return x * 10; }
+inline int f3871_11(int x) { return x * 11; }
+inline int f3871_12(int x) { return x * 12; }
+inline int f3871_13(int x) { return x * 13; }
+inline int f3871_14(int x) { return x * 14; }
+inline int f3871_15(int x) { return x * 15; }
+inline int f3871_16(int x) { return x * 16; }
+inline int f3871_17(int x) { return x * 17; }
+inline int f3871_18(int x) { return x * 18; }
+inline int f3871_19(int x) { return x * 19; }
+inline int f3871_20(int x) { return x * 20; }
+inline int f3871_21(int x) { return x * 21; }
+inline int f3871_22(int x) { return x * 22; }
+inline int f3871_23(int x) { return x * 23; }
+inline int f3871_24(int x) { return x * 24; }
+inline int f3871_25(int x) { return x * 25; }
+inline int f3871_26(int x) { return x * 26; }
+inline int f3871_27(int x) { return x * 27; }
+inline int f3871_28(int x) { return x * 28; }
+inline int f3871_29(int x) { return x * 29; }
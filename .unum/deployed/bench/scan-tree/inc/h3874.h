@@ -0,0 +1,42 @@
+#pragma once
+/* header 3874 */
+#include <vector>
+#include "h6671.h"
+#include "h7231.h"
+#include "h1554.h"
+#include "h5000.h"
+#include "h728.h"
+#ifdef X
+#include "h8132.h"
+#endif
+struct S3874 { int a; const char *s = "x//y"; };
+inline int f3874_0(int x) { return x * 0; }
+inline int f3874_1(int x) { return x * 1; }
+inline int f3874_2(int x) { return x * 2; }
+inline int f3874_3(int x) { return x * 3; }
+inline int f3874_4(int x) { return x * 4; }
+inline int f3874_5(int x) { return x * 5; }
+inline int f3874_6(int x) { return x * 6; }
+inline int f3874_7(int x) { return x * 7; }
+inline int f3874_8(int x) { return x * 8; }
+inline int f3874_9(int x) { return x * 9; }
+inline int f3874_10(int x) { return x * 10; }
+inline int f3874_11(int x) { return x * 11; }
+inline int f3874_12(int x) { return x * 12; }
+inline int f3874_13(int x) { return x * 13; }
+inline int f3874_14(int x) { return x * 14; }
+inline int f3874_15(int x) { return x * 15; }
+inline int f3874_16(int x) { return x * 16; }
+inline int f3874_17(int x) { return x * 17; }
+inline int f3874_18(int x) { return x * 18; }
+inline int f3874_19(int x) { return x * 19; }
+inline int f3874_20(int x) { return x * 20; }
+inline int f3874_21(int x) { return x * 21; }
+inline int f3874_22(int x) { return x * 22; }
+inline int f3874_23(int x) { return x * 23; }
+inline int f3874_24(int x) { return x * 24; }
+inline int f3874_25(int x) { return x * 25; }
+inline int f3874_26(int x) { return x * 26; }
+inline int f3874_27(int x) { return x * 27; }
+inline int f3874_28(int x) { return x * 28; }
+inline int f3874_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3875 */
+#include <vector>
+#include "h5112.h"
+#include "h5656.h"
+#include "h7023.h"
+#include "h6571.h"
+#include "h2552.h"
+#ifdef X
+#include "h4240.h"
+#endif
+struct S3875 { int a; const char *s = "x//y"; };
+inline int f3875_0(int x) { return x * 0; }
+inline int f3875_1(int x) { return x * 1; }
+inline int f3875_2(int x) { return x * 2; }
+inline int f3875_3(int x) { return x * 3; }
+inline int f3875_4(int x) { return x * 4; }
+inline int f3875_5(int x) { return x * 5; }
+inline int f3875_6(int x) { return x * 6; }
+inline int f3875_7(int x) { return x * 7; }
+inline int f3875_8(int x) { return x * 8; }
+inline int f3875_9(int x) { return x * 9; }
+inline int f3875_10(int x) { return x * 10; }
+inline int f3875_11(int x) { return x * 11; }
+inline int f3875_12(int x) { return x * 12; }
+inline int f3875_13(int x) { return x * 13; }
+inline int f3875_14(int x) { return x * 14; }
+inline int f3875_15(int x) { return x * 15; }
+inline int f3875_16(int x) { return x * 16; }
+inline int f3875_17(int x) { return x * 17; }
+inline int f3875_18(int x) { return x * 18; }
+inline int f3875_19(int x) { return x * 19; }
+inline int f3875_20(int x) { return x * 20; }
+inline int f3875_21(int x) { return x * 21; }
+inline int f3875_22(int x) { return x * 22; }
+inline int f3875_23(int x) { return x * 23; }
+inline int f3875_24(int x) { return x * 24; }
+inline int f3875_25(int x) { return x * 25; }
+inline int f3875_26(int x) { return x * 26; }
+inline int f3875_27(int x) { return x * 27; }
+inline int f3875_28(int x) { return x * 28; }
+inline int f3875_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3877 */
+#include <vector>
+#include "h7291.h"
+#include "h8734.h"
+#include "h9566.h"
+#include "h1061.h"
+#include "h6260.h"
+#ifdef X
+#include "h4709.h"
+#endif
+struct S3877 { int a; const char *s = "x//y"; };
+inline int f3877_0(int x) { return x * 0; }
+inline int f3877_1(int x) { return x * 1; }
+inline int f3877_2(int x) { return x * 2; }
+inline int f3877_3(int x) { return x * 3; }
+inline int f3877_4(int x) { return x * 4; }
+inline int f3877_5(int x) { return x * 5; }
+inline int f3877_6(int x) { return x * 6; }
+inline int f3877_7(int x) { return x * 7; }
+inline int f3877_8(int x) { return x * 8; }
+inline int f3877_9(int x) { return x * 9; }
+inline int f3877_10(int x) { return x * 10; }
+inline int f3877_11(int x) { return x * 11; }
+inline int f3877_12(int x) { return x * 12; }
+inline int f3877_13(int x) { return x * 13; }
+inline int f3877_14(int x) { return x * 14; }
+inline int f3877_15(int x) { return x * 15; }
+inline int f3877_16(int x) { return x * 16; }
+inline int f3877_17(int x) { return x * 17; }
+inline int f3877_18(int x) { return x * 18; }
+inline int f3877_19(int x) { return x * 19; }
+inline int f3877_20(int x) { return x * 20; }
+inline int f3877_21(int x) { return x * 21; }
+inline int f3877_22(int x) { return x * 22; }
+inline int f3877_23(int x) { return x * 23; }
+inline int f3877_24(int x) { return x * 24; }
+inline int f3877_25(int x) { return x * 25; }
+inline int f3877_26(int x) { return x * 26; }
+inline int f3877_27(int x) { return x * 27; }
+inline int f3877_28(int x) { return x * 28; }
+inline int f3877_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3879 */
+#include <vector>
+#include "h350.h"
+#include "h196.h"
+#include "h7443.h"
+#include "h2716.h"
+#include "h4549.h"
+#ifdef X
+#include "h3672.h"
+#endif
+struct S3879 { int a; const char *s = "x//y"; };
+inline int f3879_0(int x) { return x * 0; }
+inline int f3879_1(int x) { return x * 1; }
+inline int f3879_2(int x) { return x * 2; }
+inline int f3879_3(int x) { return x * 3; }
+inline int f3879_4(int x) { return x * 4; }
+inline int f3879_5(int x) { return x * 5; }
+inline int f3879_6(int x) { return x * 6; }
+inline int f3879_7(int x) { return x * 7; }
+inline int f3879_8(int x) { return x * 8; }
+inline int f3879_9(int x) { return x * 9; }
+inline int f3879_10(int x) { return x * 10; }
+inline int f3879_11(int x) { return x * 11; }
+inline int f3879_12(int x) { return x * 12; }
+inline int f3879_13(int x) { return x * 13; }
+inline int f3879_14(int x) { return x * 14; }
+inline int f3879_15(int x) { return x * 15; }
+inline int f3879_16(int x) { return x * 16; }
+inline int f3879_17(int x) { return x * 17; }
+inline int f3879_18(int x) { return x * 18; }
+inline int f3879_19(int x) { return x * 19; }
+inline int f3879_20(int x) { return x * 20; }
+inline int f3879_21(int x) { return x * 21; }
+inline int f3879_22(int x) { return x * 22; }
+inline int f3879_23(int x) { return x * 23; }
+inline int f3879_24(int x) { return x * 24; }
+inline int f3879_25(int x) { return x * 25; }
+inline int f3879_26(int x) { return x * 26; }
+inline int f3879_27(int x) { return x * 27; }
+inline int f3879_28(int x) { return x * 28; }
+inline int f3879_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3881 */
+#include <vector>
+#include "h1988.h"
+#include "h5276.h"
+#include "h3818.h"
+#include "h6444.h"
+#include "h9728.h"
+#ifdef X
+#include "h7614.h"
+#endif
+struct S3881 { int a; const char *s = "x//y"; };
+inline int f3881_0(int x) { return x * 0; }
+inline int f3881_1(int x) { return x * 1; }
+inline int f3881_2(int x) { return x * 2; }
+inline int f3881_3(int x) { return x * 3; }
+inline int f3881_4(int x) { return x * 4; }
+inline int f3881_5(int x) { return x * 5; }
+inline int f3881_6(int x) { return x * 6; }
+inline int f3881_7(int x) { return x * 7; }
+inline int f3881_8(int x) { return x * 8; }
+inline int f3881_9(int x) { return x * 9; }
+inline int f3881_10(int x) { return x * 10; }
+inline int f3881_11(int x) { return x * 11; }
+inline int f3881_12(int x) { return x * 12; }
+inline int f3881_13(int x) { return x * 13; }
+inline int f3881_14(int x) { return x * 14; }
+inline int f3881_15(int x) { return x * 15; }
+inline int f3881_16(int x) { return x * 16; }
+inline int f3881_17(int x) { return x * 17; }
+inline int f3881_18(int x) { return x * 18; }
+inline int f3881_19(int x) { return x * 19; }
+inline int f3881_20(int x) { return x * 20; }
+inline int f3881_21(int x) { return x * 21; }
+inline int f3881_22(int x) { return x * 22; }
+inline int f3881_23(int x) { return x * 23; }
+inline int f3881_24(int x) { return x * 24; }
+inline int f3881_25(int x) { return x * 25; }
+inline int f3881_26(int x) { return x * 26; }
+inline int f3881_27(int x) { return x * 27; }
+inline int f3881_28(int x) { return x * 28; }
+inline int f3881_29(int x) { return x * 29; }
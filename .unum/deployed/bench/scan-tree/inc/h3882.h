@@ -0,0 +1,42 @@
+#pragma once
+/* header 3882 */
+#include <vector>
+#include "h7080.h"
+#include "h2410.h"
+#include "h3346.h"
+#include "h344.h"
+#include "h1625.h"
+#ifdef X
+#include "h3437.h"
+#endif
+struct S3882 { int a; const char *s = "x//y"; };
+inline int f3882_0(int x) { return x * 0; }
+inline int f3882_1(int x) { return x * 1; }
+inline int f3882_2(int x) { return x * 2; }
+inline int f3882_3(int x) { return x * 3; }
+inline int f3882_4(int x) { return x * 4; }
+inline int f3882_5(int x) { return x * 5; }
+inline int f3882_6(int x) { return x * 6; }
+inline int f3882_7(int x) { return x * 7; }
+inline int f3882_8(int x) { return x * 8; }
+inline int f3882_9(int x) { return x * 9; }
+inline int f3882_10(int x) { return x * 10; }
+inline int f3882_11(int x) { return x * 11; }
+inline int f3882_12(int x) { return x * 12; }
+inline int f3882_13(int x) { return x * 13; }
+inline int f3882_14(int x) { return x * 14; }
+inline int f3882_15(int x) { return x * 15; }
+inline int f3882_16(int x) { return x * 16; }
+inline int f3882_17(int x) { return x * 17; }
+inline int f3882_18(int x) { return x * 18; }
+inline int f3882_19(int x) { return x * 19; }
+inline int f3882_20(int x) { return x * 20; }
+inline int f3882_21(int x) { return x * 21; }
+inline int f3882_22(int x) { return x * 22; }
+inline int f3882_23(int x) { return x * 23; }
+inline int f3882_24(int x) { return x * 24; }
+inline int f3882_25(int x) { return x * 25; }
+inline int f3882_26(int x) { return x * 26; }
+inline int f3882_27(int x) { return x * 27; }
+inline int f3882_28(int x) { return x * 28; }
+inline int f3882_29(int x) { return x * 29; }
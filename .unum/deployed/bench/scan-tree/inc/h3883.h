@@ -0,0 +1,42 @@
+#pragma once
+/* header 3883 */
+#include <vector>
+#include "h654.h"
+#include "h7882.h"
+#include "h7543.h"
+#include "h5550.h"
+#include "h1303.h"
+#ifdef X
+#include "h1098.h"
+#endif
+struct S3883 { int a; const char *s = "x//y"; };
+inline int f3883_0(int x) { return x * 0; }
+inline int f3883_1(int x) { return x * 1; }
+inline int f3883_2(int x) { return x * 2; }
+inline int f3883_3(int x) { return x * 3; }
+inline int f3883_4(int x) { return x * 4; }
+inline int f3883_5(int x) { return x * 5; }
+inline int f3883_6(int x) { return x * 6; }
+inline int f3883_7(int x) { return x * 7; }
+inline int f3883_8(int x) { return x * 8; }
+inline int f3883_9(int x) { return x * 9; }
+inline int f3883_10(int x) { return x * 10; }
+inline int f3883_11(int x) { return x * 11; }
+inline int f3883_12(int x) { return x * 12; }
+inline int f3883_13(int x) { return x * 13; }
+inline int f3883_14(int x) { return x * 14; }
+inline int f3883_15(int x) { return x * 15; }
+inline int f3883_16(int x) { return x * 16; }
+inline int f3883_17(int x) { return x * 17; }
+inline int f3883_18(int x) { return x * 18; }
+inline int f3883_19(int x) { return x * 19; }
+inline int f3883_20(int x) { return x * 20; }
+inline int f3883_21(int x) { return x * 21; }
+inline int f3883_22(int x) { return x * 22; }
+inline int f3883_23(int x) { return x * 23; }
+inline int f3883_24(int x) { return x * 24; }
+inline int f3883_25(int x) { return x * 25; }
+inline int f3883_26(int x) { return x * 26; }
+inline int f3883_27(int x) { return x * 27; }
+inline int f3883_28(int x) { return x * 28; }
+inline int f3883_29(int x) { return x * 29; }
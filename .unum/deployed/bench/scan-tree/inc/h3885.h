@@ -0,0 +1,42 @@
+#pragma once
+/* header 3885 */
+#include <vector>
+#include "h2066.h"
+#include "h9079.h"
+#include "h8312.h"
+#include "h82.h"
+#include "h3936.h"
+#ifdef X
+#include "h8005.h"
+#endif
+struct S3885 { int a; const char *s = "x//y"; };
+inline int f3885_0(int x) { return x * 0; }
+inline int f3885_1(int x) { return x * 1; }
+inline int f3885_2(int x) { return x * 2; }
+inline int f3885_3(int x) { return x * 3; }
+inline int f3885_4(int x) { return x * 4; }
+inline int f3885_5(int x) { return x * 5; }
+inline int f3885_6(int x) { return x * 6; }
+inline int f3885_7(int x) { return x * 7; }
+inline int f3885_8(int x) { return x * 8; }
+inline int f3885_9(int x) { return x * 9; }
+inline int f3885_10(int x) { return x * 10; }
+inline int f3885_11(int x) { return x * 11; }
+inline int f3885_12(int x) { return x * 12; }
+inline int f3885_13(int x) { return x * 13; }
+inline int f3885_14(int x) { return x * 14; }
+inline int f3885_15(int x) { return x * 15; }
+inline int f3885_16(int x) { return x * 16; }
+inline int f3885_17(int x) { return x * 17; }
+inline int f3885_18(int x) { return x * 18; }
+inline int f3885_19(int x) { return x * 19; }
+inline int f3885_20(int x) { return x * 20; }
+inline int f3885_21(int x) { return x * 21; }
+inline int f3885_22(int x) { return x * 22; }
+inline int f3885_23(int x) { return x * 23; }
+inline int f3885_24(int x) { return x * 24; }
+inline int f3885_25(int x) { return x * 25; }
+inline int f3885_26(int x) { return x * 26; }
+inline int f3885_27(int x) { return x * 27; }
+inline int f3885_28(int x) { return x * 28; }
+inline int f3885_29(int x) { return x * 29; }
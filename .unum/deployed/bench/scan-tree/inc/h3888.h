@@ -0,0 +1,42 @@
+#pragma once
+/* header 3888 */
+#include <vector>
+#include "h2887.h"
+#include "h1960.h"
+#include "h9649.h"
+#include "h5769.h"
+#include "h6556.h"
+#ifdef X
+#include "h820.h"
+#endif
+struct S3888 { int a; const char *s = "x//y"; };
+inline int f3888_0(int x) { return x * 0; }
+inline int f3888_1(int x) { return x * 1; }
+inline int f3888_2(int x) { return x * 2; }
+inline int f3888_3(int x) { return x * 3; }
+inline int f3888_4(int x) { return x * 4; }
+inline int f3888_5(int x) { return x * 5; }
+inline int f3888_6(int x) { return x * 6; }
+inline int f3888_7(int x) { return x * 7; }
+inline int f3888_8(int x) { return x * 8; }
+inline int f3888_9(int x) { return x * 9; }
+inline int f3888_10(int x) { return x * 10; }
+inline int f3888_11(int x) { return x * 11; }
+inline int f3888_12(int x) { return x * 12; }
+inline int f3888_13(int x) { return x * 13; }
+inline int f3888_14(int x) { return x * 14; }
+inline int f3888_15(int x) { return x * 15; }
+inline int f3888_16(int x) { return x * 16; }
+inline int f3888_17(int x) { return x * 17; }
+inline int f3888_18(int x) { return x * 18; }
+inline int f3888_19(int x) { return x * 19; }
+inline int f3888_20(int x) { return x * 20; }
+inline int f3888_21(int x) { return x * 21; }
+inline int f3888_22(int x) { return x * 22; }
+inline int f3888_23(int x) { return x * 23; }
+inline int f3888_24(int x) { return x * 24; }
+inline int f3888_25(int x) { return x * 25; }
+inline int f3888_26(int x) { return x * 26; }
+inline int f3888_27(int x) { return x * 27; }
+inline int f3888_28(int x) { return x * 28; }
+inline int f3888_29(int x) { return x * 29; }
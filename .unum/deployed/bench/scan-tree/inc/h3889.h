@@ -0,0 +1,42 @@
+#pragma once
+/* header 3889 */
+#include <vector>
+#include "h4466.h"
+#include "h4734.h"
+#include "h2261.h"
+#include "h9298.h"
+#include "h8056.h"
+#ifdef X
+#include "h2858.h"
+#endif
+struct S3889 { int a; const char *s = "x//y"; };
+inline int f3889_0(int x) { return x * 0; }
+inline int f3889_1(int x) { return x * 1; }
+inline int f3889_2(int x) { return x * 2; }
+inline int f3889_3(int x) { return x * 3; }
+inline int f3889_4(int x) { return x * 4; }
+inline int f3889_5(int x) { return x * 5; }
+inline int f3889_6(int x) { return x * 6; }
+inline int f3889_7(int x) { return x * 7; }
+inline int f3889_8(int x) { return x * 8; }
+inline int f3889_9(int x) { return x * 9; }
+inline int f3889_10(int x) { return x * 10; }
+inline int f3889_11(int x) { return x * 11; }
+inline int f3889_12(int x) { return x * 12; }
+inline int f3889_13(int x) { return x * 13; }
+inline int f3889_14(int x) { return x * 14; }
+inline int f3889_15(int x) { return x * 15; }
+inline int f3889_16(int x) { return x * 16; }
+inline int f3889_17(int x) { return x * 17; }
+inline int f3889_18(int x) { return x * 18; }
+inline int f3889_19(int x) { return x * 19; }
+inline int f3889_20(int x) { return x * 20; }
+inline int f3889_21(int x) { return x * 21; }
+inline int f3889_22(int x) { return x * 22; }
+inline int f3889_23(int x) { return x * 23; }
+inline int f3889_24(int x) { return x * 24; }
+inline int f3889_25(int x) { return x * 25; }
+inline int f3889_26(int x) { return x * 26; }
+inline int f3889_27(int x) { return x * 27; }
+inline int f3889_28(int x) { return x * 28; }
+inline int f3889_29(int x) { return x * 29; }
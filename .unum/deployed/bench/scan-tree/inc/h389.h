@@ -0,0 +1,42 @@
+#pragma once
+/* header 389 */
+#include <vector>
+#include "h5328.h"
+#include "h172.h"
+#include "h2114.h"
+#include "h4270.h"
+#include "h4896.h"
+#ifdef X
+#include "h6629.h"
+#endif
+struct S389 { int a; const char *s = "x//y"; };
+inline int f389_0(int x) { return x * 0; }
+inline int f389_1(int x) { return x * 1; }
+inline int f389_2(int x) { return x * 2; }
+inline int f389_3(int x) { return x * 3; }
+inline int f389_4(int x) { return x * 4; }
+inline int f389_5(int x) { return x * 5; }
+inline int f389_6(int x) { return x * 6; }
+inline int f389_7(int x) { return x * 7; }
+inline int f389_8(int x) { return x * 8; }
+inline int f389_9(int x) { return x * 9; }
+inline int f389_10(int x) { return x * 10; }
+inline int f389_11(int x) { return x * 11; }
+inline int f389_12(int x) { return x * 12; }
+inline int f389_13(int x) { return x * 13; }
+inline int f389_14(int x) { return x * 14; }
+inline int f389_15(int x) { return x * 15; }
+inline int f389_16(int x) { return x * 16; }
+inline int f389_17(int x) { return x * 17; }
+inline int f389_18(int x) { return x * 18; }
+inline int f389_19(int x) { return x * 19; }
+inline int f389_20(int x) { return x * 20; }
+inline int f389_21(int x) { return x * 21; }
+inline int f389_22(int x) { return x * 22; }
+inline int f389_23(int x) { return x * 23; }
+inline int f389_24(int x) { return x * 24; }
+inline int f389_25(int x) { return x * 25; }
+inline int f389_26(int x) { return x * 26; }
+inline int f389_27(int x) { return x * 27; }
+inline int f389_28(int x) { return x * 28; }
+inline int f389_29(int x) { return x * 29; }
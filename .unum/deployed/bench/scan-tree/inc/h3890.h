@@ -0,0 +1,42 @@
+#pragma once
+/* header 3890 */
+#include <vector>
+#include "h9887.h"
+#include "h9319.h"
+#include "h5390.h"
+#include "h3878.h"
+#include "h3714.h"
+#ifdef X
+#include "h2424.h"
+#endif
+struct S3890 { int a; const char *s = "x//y"; };
+inline int f3890_0(int x) { return x * 0; }
+inline int f3890_1(int x) { return x * 1; }
+inline int f3890_2(int x) { return x * 2; }
+inline int f3890_3(int x) { return x * 3; }
+inline int f3890_4(int x) { return x * 4; }
+inline int f3890_5(int x) { return x * 5; }
+inline int f3890_6(int x) { return x * 6; }
+inline int f3890_7(int x) { return x * 7; }
+inline int f3890_8(int x) { return x * 8; }
+inline int f3890_9(int x) { return x * 9; }
+inline int f3890_10(int x) { return x * 10; }
+inline int f3890_11(int x) { return x * 11; }
+inline int f3890_12(int x) { return x * 12; }
+inline int f3890_13(int x) { return x * 13; }
+inline int f3890_14(int x) { return x * 14; }
+inline int f3890_15(int x) { return x * 15; }
+inline int f3890_16(int x) { return x * 16; }
+inline int f3890_17(int x) { return x * 17; }
+inline int f3890_18(int x) { return x * 18; }
+inline int f3890_19(int x) { return x * 19; }
+inline int f3890_20(int x) { return x * 20; }
+inline int f3890_21(int x) { return x * 21; }
+inline int f3890_22(int x) { return x * 22; }
+inline int f3890_23(int x) { return x * 23; }
+inline int f3890_24(int x) { return x * 24; }
+inline int f3890_25(int x) { return x * 25; }
+inline int f3890_26(int x) { return x * 26; }
+inline int f3890_27(int x) { return x * 27; }
+inline int f3890_28(int x) { return x * 28; }
+inline int f3890_29(int x) { return x * 29; }
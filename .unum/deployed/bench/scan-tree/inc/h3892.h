@@ -0,0 +1,42 @@
+#pragma once
+/* header 3892 */
+#include <vector>
+#include "h1099.h"
+#include "h2945.h"
+#include "h9938.h"
+#include "h367.h"
+#include "h8492.h"
+#ifdef X
+#include "h1770.h"
+#endif
+struct S3892 { int a; const char *s = "x//y"; };
+inline int f3892_0(int x) { return x * 0; }
+inline int f3892_1(int x) { return x * 1; }
+inline int f3892_2(int x) { return x * 2; }
+inline int f3892_3(int x) { return x * 3; }
+inline int f3892_4(int x) { return x * 4; }
+inline int f3892_5(int x) { return x * 5; }
+inline int f3892_6(int x) { return x * 6; }
+inline int f3892_7(int x) { return x * 7; }
+inline int f3892_8(int x) { return x * 8; }
+inline int f3892_9(int x) { return x * 9; }
+inline int f3892_10(int x) { return x * 10; }
+inline int f3892_11(int x) { return x * 11; }
+inline int f3892_12(int x) { return x * 12; }
+inline int f3892_13(int x) { return x * 13; }
+inline int f3892_14(int x) { return x * 14; }
+inline int f3892_15(int x) { return x * 15; }
+inline int f3892_16(int x) { return x * 16; }
+inline int f3892_17(int x) { return x * 17; }
+inline int f3892_18(int x) { return x * 18; }
+inline int f3892_19(int x) { return x * 19; }
+inline int f3892_20(int x) { return x * 20; }
+inline int f3892_21(int x) { return x * 21; }
+inline int f3892_22(int x) { return x * 22; }
+inline int f3892_23(int x) { return x * 23; }
+inline int f3892_24(int x) { return x * 24; }
+inline int f3892_25(int x) { return x * 25; }
+inline int f3892_26(int x) { return x * 26; }
+inline int f3892_27(int x) { return x * 27; }
+inline int f3892_28(int x) { return x * 28; }
+inline int f3892_29(int x) { return x * 29; }
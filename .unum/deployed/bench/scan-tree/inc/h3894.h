@@ -0,0 +1,42 @@
+#pragma once
+/* header 3894 */
+#include <vector>
+#include "h4432.h"
+#include "h4843.h"
+#include "h5230.h"
+#include "h6725.h"
+#include "h2264.h"
+#ifdef X
+#include "h4136.h"
+#endif
+struct S3894 { int a; const char *s = "x//y"; };
+inline int f3894_0(int x) { return x * 0; }
+inline int f3894_1(int x) { return x * 1; }
+inline int f3894_2(int x) { return x * 2; }
+inline int f3894_3(int x) { return x * 3; }
+inline int f3894_4(int x) { return x * 4; }
+inline int f3894_5(int x) { return x * 5; }
+inline int f3894_6(int x) { return x * 6; }
+inline int f3894_7(int x) { return x * 7; }
+inline int f3894_8(int x) { return x * 8; }
+inline int f3894_9(int x) { return x * 9; }
+inline int f3894_10(int x) { return x * 10; }
+inline int f3894_11(int x) { return x * 11; }
+inline int f3894_12(int x) { return x * 12; }
+inline int f3894_13(int x) { return x * 13; }
+inline int f3894_14(int x) { return x * 14; }
+inline int f3894_15(int x) { return x * 15; }
+inline int f3894_16(int x) { return x * 16; }
+inline int f3894_17(int x) { return x * 17; }
+inline int f3894_18(int x) { return x * 18; }
+inline int f3894_19(int x) { return x * 19; }
+inline int f3894_20(int x) { return x * 20; }
+inline int f3894_21(int x) { return x * 21; }
+inline int f3894_22(int x) { return x * 22; }
+inline int f3894_23(int x) { return x * 23; }
+inline int f3894_24(int x) { return x * 24; }
+inline int f3894_25(int x) { return x * 25; }
+inline int f3894_26(int x) { return x * 26; }
+inline int f3894_27(int x) { return x * 27; }
+inline int f3894_28(int x) { return x * 28; }
+inline int f3894_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3896 */
+#include <vector>
+#include "h98.h"
+#include "h7673.h"
+#include "h9817.h"
+#include "h615.h"
+#include "h5748.h"
+#ifdef X
+#include "h3745.h"
+#endif
+struct S3896 { int a; const char *s = "x//y"; };
+inline int f3896_0(int x) { return x * 0; }
+inline int f3896_1(int x) { return x * 1; }
+inline int f3896_2(int x) { return x * 2; }
+inline int f3896_3(int x) { return x * 3; }
+inline int f3896_4(int x) { return x * 4; }
+inline int f3896_5(int x) { return x * 5; }
+inline int f3896_6(int x) { return x * 6; }
+inline int f3896_7(int x) { return x * 7; }
+inline int f3896_8(int x) { return x * 8; }
+inline int f3896_9(int x) { return x * 9; }
+inline int f3896_10(int x) { return x * 10; }
+inline int f3896_11(int x) { return x * 11; }
+inline int f3896_12(int x) { return x * 12; }
+inline int f3896_13(int x) { return x * 13; }
+inline int f3896_14(int x) { return x * 14; }
+inline int f3896_15(int x) { return x * 15; }
+inline int f3896_16(int x) { return x * 16; }
+inline int f3896_17(int x) { return x * 17; }
+inline int f3896_18(int x) { return x * 18; }
+inline int f3896_19(int x) { return x * 19; }
+inline int f3896_20(int x) { return x * 20; }
+inline int f3896_21(int x) { return x * 21; }
+inline int f3896_22(int x) { return x * 22; }
+inline int f3896_23(int x) { return x * 23; }
+inline int f3896_24(int x) { return x * 24; }
+inline int f3896_25(int x) { return x * 25; }
+inline int f3896_26(int x) { return x * 26; }
+inline int f3896_27(int x) { return x * 27; }
+inline int f3896_28(int x) { return x * 28; }
+inline int f3896_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3897 */
+#include <vector>
+#include "h8943.h"
+#include "h8075.h"
+#include "h9257.h"
+#include "h8295.h"
+#include "h293.h"
+#ifdef X
+#include "h3284.h"
+#endif
+struct S3897 { int a; const char *s = "x//y"; };
+inline int f3897_0(int x) { return x * 0; }
+inline int f3897_1(int x) { return x * 1; }
+inline int f3897_2(int x) { return x * 2; }
+inline int f3897_3(int x) { return x * 3; }
+inline int f3897_4(int x) { return x * 4; }
+inline int f3897_5(int x) { return x * 5; }
+inline int f3897_6(int x) { return x * 6; }
+inline int f3897_7(int x) { return x * 7; }
+inline int f3897_8(int x) { return x * 8; }
+inline int f3897_9(int x) { return x * 9; }
+inline int f3897_10(int x) { return x * 10; }
+inline int f3897_11(int x) { return x * 11; }
+inline int f3897_12(int x) { return x * 12; }
+inline int f3897_13(int x) { return x * 13; }
+inline int f3897_14(int x) { return x * 14; }
+inline int f3897_15(int x) { return x * 15; }
+inline int f3897_16(int x) { return x * 16; }
+inline int f3897_17(int x) { return x * 17; }
+inline int f3897_18(int x) { return x * 18; }
+inline int f3897_19(int x) { return x * 19; }
+inline int f3897_20(int x) { return x * 20; }
+inline int f3897_21(int x) { return x * 21; }
+inline int f3897_22(int x) { return x * 22; }
+inline int f3897_23(int x) { return x * 23; }
+inline int f3897_24(int x) { return x * 24; }
+inline int f3897_25(int x) { return x * 25; }
+inline int f3897_26(int x) { return x * 26; }
+inline int f3897_27(int x) { return x * 27; }
+inline int f3897_28(int x) { return x * 28; }
+inline int f3897_29(int x) { return x * 29; }
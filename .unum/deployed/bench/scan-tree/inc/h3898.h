@@ -0,0 +1,42 @@
+#pragma once
+/* header 3898 */
+#include <vector>
+#include "h1249.h"
+#include "h8743.h"
+#include "h589.h"
+#include "h3633.h"
+#include "h2254.h"
+#ifdef X
+#include "h1065.h"
+#endif
+struct S3898 { int a; const char *s = "x//y"; };
+inline int f3898_0(int x) { return x * 0; }
+inline int f3898_1(int x) { return x * 1; }
+inline int f3898_2(int x) { return x * 2; }
+inline int f3898_3(int x) { return x * 3; }
+inline int f3898_4(int x) { return x * 4; }
+inline int f3898_5(int x) { return x * 5; }
+inline int f3898_6(int x) { return x * 6; }
+inline int f3898_7(int x) { return x * 7; }
+inline int f3898_8(int x) { return x * 8; }
+inline int f3898_9(int x) { return x * 9; }
+inline int f3898_10(int x) { return x * 10; }
+inline int f3898_11(int x) { return x * 11; }
+inline int f3898_12(int x) { return x * 12; }
+inline int f3898_13(int x) { return x * 13; }
+inline int f3898_14(int x) { return x * 14; }
+inline int f3898_15(int x) { return x * 15; }
+inline int f3898_16(int x) { return x * 16; }
+inline int f3898_17(int x) { return x * 17; }
+inline int f3898_18(int x) { return x * 18; }
+inline int f3898_19(int x) { return x * 19; }
+inline int f3898_20(int x) { return x * 20; }
+inline int f3898_21(int x) { return x * 21; }
+inline int f3898_22(int x) { return x * 22; }
+inline int f3898_23(int x) { return x * 23; }
+inline int f3898_24(int x) { return x * 24; }
+inline int f3898_25(int x) { return x * 25; }
+inline int f3898_26(int x) { return x * 26; }
+inline int f3898_27(int x) { return x * 27; }
+inline int f3898_28(int x) { return x * 28; }
+inline int f3898_29(int x) { return x * 29; }
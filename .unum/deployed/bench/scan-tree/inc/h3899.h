@@ -0,0 +1,42 @@
+#pragma once
+/* header 3899 */
+#include <vector>
+#include "h222.h"
+#include "h3915.h"
+#include "h6292.h"
+#include "h2496.h"
+#include "h4799.h"
+#ifdef X
+#include "h6758.h"
+#endif
+struct S3899 { int a; const char *s = "x//y"; };
+inline int f3899_0(int x) { return x * 0; }
+inline int f3899_1(int x) { return x * 1; }
+inline int f3899_2(int x) { return x * 2; }
+inline int f3899_3(int x) { return x * 3; }
+inline int f3899_4(int x) { return x * 4; }
+inline int f3899_5(int x) { return x * 5; }
+inline int f3899_6(int x) { return x * 6; }
+inline int f3899_7(int x) { return x * 7; }
+inline int f3899_8(int x) { return x * 8; }
+inline int f3899_9(int x) { return x * 9; }
+inline int f3899_10(int x) { return x * 10; }
+inline int f3899_11(int x) { return x * 11; }
+inline int f3899_12(int x) { return x * 12; }
+inline int f3899_13(int x) { return x * 13; }
+inline int f3899_14(int x) { return x * 14; }
+inline int f3899_15(int x) { return x * 15; }
+inline int f3899_16(int x) { return x * 16; }
+inline int f3899_17(int x) { return x * 17; }
+inline int f3899_18(int x) { return x * 18; }
+inline int f3899_19(int x) { return x * 19; }
+inline int f3899_20(int x) { return x * 20; }
+inline int f3899_21(int x) { return x * 21; }
+inline int f3899_22(int x) { return x * 22; }
+inline int f3899_23(int x) { return x * 23; }
+inline int f3899_24(int x) { return x * 24; }
+inline int f3899_25(int x) { return x * 25; }
+inline int f3899_26(int x) { return x * 26; }
+inline int f3899_27(int x) { return x * 27; }
+inline int f3899_28(int x) { return x * 28; }
+inline int f3899_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 39 */
+#include <vector>
+#include "h9652.h"
+#include "h3606.h"
+#include "h9010.h"
+#include "h8645.h"
+#include "h3371.h"
+#ifdef X
+#include "h7057.h"
+#endif
+struct S39 { int a; const char *s = "x//y"; };
+inline int f39_0(int x) { return x * 0; }
+inline int f39_1(int x) { return x * 1; }
+inline int f39_2(int x) { return x * 2; }
+inline int f39_3(int x) { return x * 3; }
+inline int f39_4(int x) { return x * 4; }
+inline int f39_5(int x) { return x * 5; }
+inline int f39_6(int x) { return x * 6; }
+inline int f39_7(int x) { return x * 7; }
+inline int f39_8(int x) { return x * 8; }
+inline int f39_9(int x) { return x * 9; }
+inline int f39_10(int x) { return x * 10; }
+inline int f39_11(int x) { return x * 11; }
+inline int f39_12(int x) { return x * 12; }
+inline int f39_13(int x) { return x * 13; }
+inline int f39_14(int x) { return x * 14; }
+inline int f39_15(int x) { return x * 15; }
+inline int f39_16(int x) { return x * 16; }
+inline int f39_17(int x) { return x * 17; }
+inline int f39_18(int x) { return x * 18; }
+inline int f39_19(int x) { return x * 19; }
+inline int f39_20(int x) { return x * 20; }
+inline int f39_21(int x) { return x * 21; }
+inline int f39_22(int x) { return x * 22; }
+inline int f39_23(int x) { return x * 23; }
+inline int f39_24(int x) { return x * 24; }
+inline int f39_25(int x) { return x * 25; }
+inline int f39_26(int x) { return x * 26; }
+inline int f39_27(int x) { return x * 27; }
+inline int f39_28(int x) { return x * 28; }
+inline int f39_29(int x) { return x * 29; }
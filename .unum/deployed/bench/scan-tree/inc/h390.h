@@ -0,0 +1,42 @@
+#pragma once
+/* header 390 */
+#include <vector>
+#include "h7378.h"
+#include "h910.h"
+#include "h9723.h"
+#include "h7036.h"
+#include "h7505.h"
+#ifdef X
+#include "h5207.h"
+#endif
+struct S390 { int a; const char *s = "x//y"; };
+inline int f390_0(int x) { return x * 0; }
+inline int f390_1(int x) { return x * 1; }
+inline int f390_2(int x) { return x * 2; }
+inline int f390_3(int x) { return x * 3; }
+inline int f390_4(int x) { return x * 4; }
+inline int f390_5(int x) { return x * 5; }
+inline int f390_6(int x) { return x * 6; }
+inline int f390_7(int x) { return x * 7; }
+inline int f390_8(int x) { return x * 8; }
+inline int f390_9(int x) { return x * 9; }
+inline int f390_10(int x) { return x * 10; }
+inline int f390_11(int x) { return x * 11; }
+inline int f390_12(int x) { return x * 12; }
+inline int f390_13(int x) { return x * 13; }
+inline int f390_14(int x) { return x * 14; }
+inline int f390_15(int x) { return x * 15; }
+inline int f390_16(int x) { return x * 16; }
+inline int f390_17(int x) { return x * 17; }
+inline int f390_18(int x) { return x * 18; }
+inline int f390_19(int x) { return x * 19; }
+inline int f390_20(int x) { return x * 20; }
+inline int f390_21(int x) { return x * 21; }
+inline int f390_22(int x) { return x * 22; }
+inline int f390_23(int x) { return x * 23; }
+inline int f390_24(int x) { return x * 24; }
+inline int f390_25(int x) { return x * 25; }
+inline int f390_26(int x) { return x * 26; }
+inline int f390_27(int x) { return x * 27; }
+inline int f390_28(int x) { return x * 28; }
+inline int f390_29(int x) { return x * 29; }
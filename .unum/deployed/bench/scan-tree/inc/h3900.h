@@ -0,0 +1,42 @@
+#pragma once
+/* header 3900 */
+#include <vector>
+#include "h33.h"
+#include "h494.h"
+#include "h1848.h"
+#include "h7651.h"
+#include "h5006.h"
+#ifdef X
+#include "h1563.h"
+#endif
+struct S3900 { int a; const char *s = "x//y"; };
+inline int f3900_0(int x) { return x * 0; }
+inline int f3900_1(int x) { return x * 1; }
+inline int f3900_2(int x) { return x * 2; }
+inline int f3900_3(int x) { return x * 3; }
+inline int f3900_4(int x) { return x * 4; }
+inline int f3900_5(int x) { return x * 5; }
+inline int f3900_6(int x) { return x * 6; }
+inline int f3900_7(int x) { return x * 7; }
+inline int f3900_8(int x) { return x * 8; }
+inline int f3900_9(int x) { return x * 9; }
+inline int f3900_10(int x) { return x * 10; }
+inline int f3900_11(int x) { return x * 11; }
+inline int f3900_12(int x) { return x * 12; }
+inline int f3900_13(int x) { return x * 13; }
+inline int f3900_14(int x) { return x * 14; }
+inline int f3900_15(int x) { return x * 15; }
+inline int f3900_16(int x) { return x * 16; }
+inline int f3900_17(int x) { return x * 17; }
+inline int f3900_18(int x) { return x * 18; }
+inline int f3900_19(int x) { return x * 19; }
+inline int f3900_20(int x) { return x * 20; }
+inline int f3900_21(int x) { return x * 21; }
+inline int f3900_22(int x) { return x * 22; }
+inline int f3900_23(int x) { return x * 23; }
+inline int f3900_24(int x) { return x * 24; }
+inline int f3900_25(int x) { return x * 25; }
+inline int f3900_26(int x) { return x * 26; }
+inline int f3900_27(int x) { return x * 27; }
+inline int f3900_28(int x) { return x * 28; }
+inline int f3900_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3907 */
+#include <vector>
+#include "h654.h"
+#include "h4573.h"
+#include "h585.h"
+#include "h3363.h"
+#include "h1811.h"
+#ifdef X
+#include "h3991.h"
+#endif
+struct S3907 { int a; const char *s = "x//y"; };
+inline int f3907_0(int x) { return x * 0; }
+inline int f3907_1(int x) { return x * 1; }
+inline int f3907_2(int x) { return x * 2; }
+inline int f3907_3(int x) { return x * 3; }
+inline int f3907_4(int x) { return x * 4; }
+inline int f3907_5(int x) { return x * 5; }
+inline int f3907_6(int x) { return x * 6; }
+inline int f3907_7(int x) { return x * 7; }
+inline int f3907_8(int x) { return x * 8; }
+inline int f3907_9(int x) { return x * 9; }
+inline int f3907_10(int x) { return x * 10; }
+inline int f3907_11(int x) { return x * 11; }
+inline int f3907_12(int x) { return x * 12; }
+inline int f3907_13(int x) { return x * 13; }
+inline int f3907_14(int x) { return x * 14; }
+inline int f3907_15(int x) { return x * 15; }
+inline int f3907_16(int x) { return x * 16; }
+inline int f3907_17(int x) { return x * 17; }
+inline int f3907_18(int x) { return x * 18; }
+inline int f3907_19(int x) { return x * 19; }
+inline int f3907_20(int x) { return x * 20; }
+inline int f3907_21(int x) { return x * 21; }
+inline int f3907_22(int x) { return x * 22; }
+inline int f3907_23(int x) { return x * 23; }
+inline int f3907_24(int x) { return x * 24; }
+inline int f3907_25(int x) { return x * 25; }
+inline int f3907_26(int x) { return x * 26; }
+inline int f3907_27(int x) { return x * 27; }
+inline int f3907_28(int x) { return x * 28; }
+inline int f3907_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3908 */
+#include <vector>
+#include "h2032.h"
+#include "h6027.h"
+#include "h6021.h"
+#include "h8497.h"
+#include "h1379.h"
+#ifdef X
+#include "h7177.h"
+#endif
+struct S3908 { int a; const char *s = "x//y"; };
+inline int f3908_0(int x) { return x * 0; }
+inline int f3908_1(int x) { return x * 1; }
+inline int f3908_2(int x) { return x * 2; }
+inline int f3908_3(int x) { return x * 3; }
+inline int f3908_4(int x) { return x * 4; }
+inline int f3908_5(int x) { return x * 5; }
+inline int f3908_6(int x) { return x * 6; }
+inline int f3908_7(int x) { return x * 7; }
+inline int f3908_8(int x) { return x * 8; }
+inline int f3908_9(int x) { return x * 9; }
+inline int f3908_10(int x) { return x * 10; }
+inline int f3908_11(int x) { return x * 11; }
+inline int f3908_12(int x) { return x * 12; }
+inline int f3908_13(int x) { return x * 13; }
+inline int f3908_14(int x) { return x * 14; }
+inline int f3908_15(int x) { return x * 15; }
+inline int f3908_16(int x) { return x * 16; }
+inline int f3908_17(int x) { return x * 17; }
+inline int f3908_18(int x) { return x * 18; }
+inline int f3908_19(int x) { return x * 19; }
+inline int f3908_20(int x) { return x * 20; }
+inline int f3908_21(int x) { return x * 21; }
+inline int f3908_22(int x) { return x * 22; }
+inline int f3908_23(int x) { return x * 23; }
+inline int f3908_24(int x) { return x * 24; }
+inline int f3908_25(int x) { return x * 25; }
+inline int f3908_26(int x) { return x * 26; }
+inline int f3908_27(int x) { return x * 27; }
+inline int f3908_28(int x) { return x * 28; }
+inline int f3908_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3909 */
+#include <vector>
+#include "h594.h"
+#include "h1535.h"
+#include "h2726.h"
+#include "h9543.h"
+#include "h207.h"
+#ifdef X
+#include "h5911.h"
+#endif
+struct S3909 { int a; const char *s = "x//y"; };
+inline int f3909_0(int x) { return x * 0; }
+inline int f3909_1(int x) { return x * 1; }
+inline int f3909_2(int x) { return x * 2; }
+inline int f3909_3(int x) { return x * 3; }
+inline int f3909_4(int x) { return x * 4; }
+inline int f3909_5(int x) { return x * 5; }
+inline int f3909_6(int x) { return x * 6; }
+inline int f3909_7(int x) { return x * 7; }
+inline int f3909_8(int x) { return x * 8; }
+inline int f3909_9(int x) { return x * 9; }
+inline int f3909_10(int x) { return x * 10; }
+inline int f3909_11(int x) { return x * 11; }
+inline int f3909_12(int x) { return x * 12; }
+inline int f3909_13(int x) { return x * 13; }
+inline int f3909_14(int x) { return x * 14; }
+inline int f3909_15(int x) { return x * 15; }
+inline int f3909_16(int x) { return x * 16; }
+inline int f3909_17(int x) { return x * 17; }
+inline int f3909_18(int x) { return x * 18; }
+inline int f3909_19(int x) { return x * 19; }
+inline int f3909_20(int x) { return x * 20; }
+inline int f3909_21(int x) { return x * 21; }
+inline int f3909_22(int x) { return x * 22; }
+inline int f3909_23(int x) { return x * 23; }
+inline int f3909_24(int x) { return x * 24; }
+inline int f3909_25(int x) { return x * 25; }
+inline int f3909_26(int x) { return x * 26; }
+inline int f3909_27(int x) { return x * 27; }
+inline int f3909_28(int x) { return x * 28; }
+inline int f3909_29(int x) { return x * 29; }
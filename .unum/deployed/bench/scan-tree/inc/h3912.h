@@ -0,0 +1,42 @@
+#pragma once
+/* header 3912 */
+#include <vector>
+#include "h8644.h"
+#include "h7930.h"
+#include "h6314.h"
+#include "h7956.h"
+#include "h5028.h"
+#ifdef X
+#include "h6861.h"
+#endif
+struct S3912 { int a; const char *s = "x//y"; };
+inline int f3912_0(int x) { return x * 0; }
+inline int f3912_1(int x) { return x * 1; }
+inline int f3912_2(int x) { return x * 2; }
+inline int f3912_3(int x) { return x * 3; }
+inline int f3912_4(int x) { return x * 4; }
+inline int f3912_5(int x) { return x * 5; }
+inline int f3912_6(int x) { return x * 6; }
+inline int f3912_7(int x) { return x * 7; }
+inline int f3912_8(int x) { return x * 8; }
+inline int f3912_9(int x) { return x * 9; }
+inline int f3912_10(int x) { return x * 10; }
+inline int f3912_11(int x) { return x * 11; }
+inline int f3912_12(int x) { return x * 12; }
+inline int f3912_13(int x) { return x * 13; }
+inline int f3912_14(int x) { return x * 14; }
+inline int f3912_15(int x) { return x * 15; }
+inline int f3912_16(int x) { return x * 16; }
+inline int f3912_17(int x) { return x * 17; }
+inline int f3912_18(int x) { return x * 18; }
+inline int f3912_19(int x) { return x * 19; }
+inline int f3912_20(int x) { return x * 20; }
+inline int f3912_21(int x) { return x * 21; }
+inline int f3912_22(int x) { return x * 22; }
+inline int f3912_23(int x) { return x * 23; }
+inline int f3912_24(int x) { return x * 24; }
+inline int f3912_25(int x) { return x * 25; }
+inline int f3912_26(int x) { return x * 26; }
+inline int f3912_27(int x) { return x * 27; }
+inline int f3912_28(int x) { return x * 28; }
+inline int f3912_29(int x) { return x * 29; }
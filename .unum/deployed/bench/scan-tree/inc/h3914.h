@@ -0,0 +1,42 @@
+#pragma once
+/* header 3914 */
+#include <vector>
+#include "h6225.h"
+#include "h8670.h"
+#include "h4906.h"
+#include "h4508.h"
+#include "h9845.h"
+#ifdef X
+#include "h8088.h"
+#endif
+struct S3914 { int a; const char *s = "x//y"; };
+inline int f3914_0(int x) { return x * 0; }
+inline int f3914_1(int x) { return x * 1; }
+inline int f3914_2(int x) { return x * 2; }
+inline int f3914_3(int x) { return x * 3; }
+inline int f3914_4(int x) { return x * 4; }
+inline int f3914_5(int x) { return x * 5; }
+inline int f3914_6(int x) { return x * 6; }
+inline int f3914_7(int x) { return x * 7; }
+inline int f3914_8(int x) { return x * 8; }
+inline int f3914_9(int x) { return x * 9; }
+inline int f3914_10(int x) { return x * 10; }
+inline int f3914_11(int x) { return x * 11; }
+inline int f3914_12(int x) { return x * 12; }
+inline int f3914_13(int x) { return x * 13; }
+inline int f3914_14(int x) { return x * 14; }
+inline int f3914_15(int x) { return x * 15; }
+inline int f3914_16(int x) { return x * 16; }
+inline int f3914_17(int x) { return x * 17; }
+inline int f3914_18(int x) { return x * 18; }
+inline int f3914_19(int x) { return x * 19; }
+inline int f3914_20(int x) { return x * 20; }
+inline int f3914_21(int x) { return x * 21; }
+inline int f3914_22(int x) { return x * 22; }
+inline int f3914_23(int x) { return x * 23; }
+inline int f3914_24(int x) { return x * 24; }
+inline int f3914_25(int x) { return x * 25; }
+inline int f3914_26(int x) { return x * 26; }
+inline int f3914_27(int x) { return x * 27; }
+inline int f3914_28(int x) { return x * 28; }
+inline int f3914_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3916 */
+#include <vector>
+#include "h5360.h"
+#include "h259.h"
+#include "h8726.h"
+#include "h4234.h"
+#include "h4554.h"
+#ifdef X
+#include "h2474.h"
+#endif
+struct S3916 { int a; const char *s = "x//y"; };
+inline int f3916_0(int x) { return x * 0; }
+inline int f3916_1(int x) { return x * 1; }
+inline int f3916_2(int x) { return x * 2; }
+inline int f3916_3(int x) { return x * 3; }
+inline int f3916_4(int x) { return x * 4; }
+inline int f3916_5(int x) { return x * 5; }
+inline int f3916_6(int x) { return x * 6; }
+inline int f3916_7(int x) { return x * 7; }
+inline int f3916_8(int x) { return x * 8; }
+inline int f3916_9(int x) { return x * 9; }
+inline int f3916_10(int x) { return x * 10; }
+inline int f3916_11(int x) { return x * 11; }
+inline int f3916_12(int x) { return x * 12; }
+inline int f3916_13(int x) { return x * 13; }
+inline int f3916_14(int x) { return x * 14; }
+inline int f3916_15(int x) { return x * 15; }
+inline int f3916_16(int x) { return x * 16; }
+inline int f3916_17(int x) { return x * 17; }
+inline int f3916_18(int x) { return x * 18; }
+inline int f3916_19(int x) { return x * 19; }
+inline int f3916_20(int x) { return x * 20; }
+inline int f3916_21(int x) { return x * 21; }
+inline int f3916_22(int x) { return x * 22; }
+inline int f3916_23(int x) { return x * 23; }
+inline int f3916_24(int x) { return x * 24; }
+inline int f3916_25(int x) { return x * 25; }
+inline int f3916_26(int x) { return x * 26; }
+inline int f3916_27(int x) { return x * 27; }
+inline int f3916_28(int x) { return x * 28; }
+inline int f3916_29(int x) { return x * 29; }
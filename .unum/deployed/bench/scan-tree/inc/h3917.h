@@ -0,0 +1,42 @@
+#pragma once
+/* header 3917 */
+#include <vector>
+#include "h8660.h"
+#include "h4734.h"
+#include "h951.h"
+#include "h9497.h"
+#include "h6091.h"
+#ifdef X
+#include "h7326.h"
+#endif
+struct S3917 { int a; const char *s = "x//y"; };
+inline int f3917_0(int x) { return x * 0; }
+inline int f3917_1(int x) { return x * 1; }
+inline int f3917_2(int x) { return x * 2; }
+inline int f3917_3(int x) { return x * 3; }
+inline int f3917_4(int x) { return x * 4; }
+inline int f3917_5(int x) { return x * 5; }
+inline int f3917_6(int x) { return x * 6; }
+inline int f3917_7(int x) { return x * 7; }
+inline int f3917_8(int x) { return x * 8; }
+inline int f3917_9(int x) { return x * 9; }
+inline int f3917_10(int x) { return x * 10; }
+inline int f3917_11(int x) { return x * 11; }
+inline int f3917_12(int x) { return x * 12; }
+inline int f3917_13(int x) { return x * 13; }
+inline int f3917_14(int x) { return x * 14; }
+inline int f3917_15(int x) { return x * 15; }
+inline int f3917_16(int x) { return x * 16; }
+inline int f3917_17(int x) { return x * 17; }
+inline int f3917_18(int x) { return x * 18; }
+inline int f3917_19(int x) { return x * 19; }
+inline int f3917_20(int x) { return x * 20; }
+inline int f3917_21(int x) { return x * 21; }
+inline int f3917_22(int x) { return x * 22; }
+inline int f3917_23(int x) { return x * 23; }
+inline int f3917_24(int x) { return x * 24; }
+inline int f3917_25(int x) { return x * 25; }
+inline int f3917_26(int x) { return x * 26; }
+inline int f3917_27(int x) { return x * 27; }
+inline int f3917_28(int x) { return x * 28; }
+inline int f3917_29(int x) { return x * 29; }
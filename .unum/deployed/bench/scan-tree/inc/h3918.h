@@ -0,0 +1,42 @@
+#pragma once
+/* header 3918 */
+#include <vector>
+#include "h4285.h"
+#include "h1830.h"
+#include "h5376.h"
+#include "h4239.h"
+#include "h2299.h"
+#ifdef X
+#include "h2937.h"
+#endif
+struct S3918 { int a; const char *s = "x//y"; };
+inline int f3918_0(int x) { return x * 0; }
+inline int f3918_1(int x) { return x * 1; }
+inline int f3918_2(int x) { return x * 2; }
+inline int f3918_3(int x) { return x * 3; }
+inline int f3918_4(int x) { return x * 4; }
+inline int f3918_5(int x) { return x * 5; }
+inline int f3918_6(int x) { return x * 6; }
+inline int f3918_7(int x) { return x * 7; }
+inline int f3918_8(int x) { return x * 8; }
+inline int f3918_9(int x) { return x * 9; }
+inline int f3918_10(int x) { return x * 10; }
+inline int f3918_11(int x) { return x * 11; }
+inline int f3918_12(int x) { return x * 12; }
+inline int f3918_13(int x) { return x * 13; }
+inline int f3918_14(int x) { return x * 14; }
+inline int f3918_15(int x) { return x * 15; }
+inline int f3918_16(int x) { return x * 16; }
+inline int f3918_17(int x) { return x * 17; }
+inline int f3918_18(int x) { return x * 18; }
+inline int f3918_19(int x) { return x * 19; }
+inline int f3918_20(int x) { return x * 20; }
+inline int f3918_21(int x) { return x * 21; }
+inline int f3918_22(int x) { return x * 22; }
+inline int f3918_23(int x) { return x * 23; }
+inline int f3918_24(int x) { return x * 24; }
+inline int f3918_25(int x) { return x * 25; }
+inline int f3918_26(int x) { return x * 26; }
+inline int f3918_27(int x) { return x * 27; }
+inline int f3918_28(int x) { return x * 28; }
+inline int f3918_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 392 */
+#include <vector>
+#include "h5314.h"
+#include "h8548.h"
+#include "h5179.h"
+#include "h8429.h"
+#include "h6172.h"
+#ifdef X
+#include "h8840.h"
+#endif
+struct S392 { int a; const char *s = "x//y"; };
+inline int f392_0(int x) { return x * 0; }
+inline int f392_1(int x) { return x * 1; }
+inline int f392_2(int x) { return x * 2; }
+inline int f392_3(int x) { return x * 3; }
+inline int f392_4(int x) { return x * 4; }
+inline int f392_5(int x) { return x * 5; }
+inline int f392_6(int x) { return x * 6; }
+inline int f392_7(int x) { return x * 7; }
+inline int f392_8(int x) { return x * 8; }
+inline int f392_9(int x) { return x * 9; }
+inline int f392_10(int x) { return x * 10; }
+inline int f392_11(int x) { return x * 11; }
+inline int f392_12(int x) { return x * 12; }
+inline int f392_13(int x) { return x * 13; }
+inline int f392_14(int x) { return x * 14; }
+inline int f392_15(int x) { return x * 15; }
+inline int f392_16(int x) { return x * 16; }
+inline int f392_17(int x) { return x * 17; }
+inline int f392_18(int x) { return x * 18; }
+inline int f392_19(int x) { return x * 19; }
+inline int f392_20(int x) { return x * 20; }
+inline int f392_21(int x) { return x * 21; }
+inline int f392_22(int x) { return x * 22; }
+inline int f392_23(int x) { return x * 23; }
+inline int f392_24(int x) { return x * 24; }
+inline int f392_25(int x) { return x * 25; }
+inline int f392_26(int x) { return x * 26; }
+inline int f392_27(int x) { return x * 27; }
+inline int f392_28(int x) { return x * 28; }
+inline int f392_29(int x) { return x * 29; }
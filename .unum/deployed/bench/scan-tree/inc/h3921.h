@@ -0,0 +1,42 @@
+#pragma once
+/* header 3921 */
+#include <vector>
+#include "h1905.h"
+#include "h7387.h"
+#include "h6516.h"
+#include "h1431.h"
+#include "h1100.h"
+#ifdef X
+#include "h1573.h"
+#endif
+struct S3921 { int a; const char *s = "x//y"; };
+inline int f3921_0(int x) { return x * 0; }
+inline int f3921_1(int x) { return x * 1; }
+inline int f3921_2(int x) { return x * 2; }
+inline int f3921_3(int x) { return x * 3; }
+inline int f3921_4(int x) { return x * 4; }
+inline int f3921_5(int x) { return x * 5; }
+inline int f3921_6(int x) { return x * 6; }
+inline int f3921_7(int x) { return x * 7; }
+inline int f3921_8(int x) { return x * 8; }
+inline int f3921_9(int x) { return x * 9; }
+inline int f3921_10(int x) { return x * 10; }
+inline int f3921_11(int x) { return x * 11; }
+inline int f3921_12(int x) { return x * 12; }
+inline int f3921_13(int x) { return x * 13; }
+inline int f3921_14(int x) { return x * 14; }
+inline int f3921_15(int x) { return x * 15; }
+inline int f3921_16(int x) { return x * 16; }
+inline int f3921_17(int x) { return x * 17; }
+inline int f3921_18(int x) { return x * 18; }
+inline int f3921_19(int x) { return x * 19; }
+inline int f3921_20(int x) { return x * 20; }
+inline int f3921_21(int x) { return x * 21; }
+inline int f3921_22(int x) { return x * 22; }
+inline int f3921_23(int x) { return x * 23; }
+inline int f3921_24(int x) { return x * 24; }
+inline int f3921_25(int x) { return x * 25; }
+inline int f3921_26(int x) { return x * 26; }
+inline int f3921_27(int x) { return x * 27; }
+inline int f3921_28(int x) { return x * 28; }
+inline int f3921_29(int x) { return x * 29; }
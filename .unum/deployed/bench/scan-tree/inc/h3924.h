@@ -0,0 +1,42 @@
+#pragma once
+/* header 3924 */
+#include <vector>
+#include "h372.h"
+#include "h6117.h"
+#include "h4143.h"
+#include "h8318.h"
+#include "h2625.h"
+#ifdef X
+#include "h4435.h"
+#endif
+struct S3924 { int a; const char *s = "x//y"; };
+inline int f3924_0(int x) { return x * 0; }
+inline int f3924_1(int x) { return x * 1; }
+inline int f3924_2(int x) { return x * 2; }
+inline int f3924_3(int x) { return x * 3; }
+inline int f3924_4(int x) { return x * 4; }
+inline int f3924_5(int x) { return x * 5; }
+inline int f3924_6(int x) { return x * 6; }
+inline int f3924_7(int x) { return x * 7; }
+inline int f3924_8(int x) { return x * 8; }
+inline int f3924_9(int x) { return x * 9; }
+inline int f3924_10(int x) { return x * 10; }
+inline int f3924_11(int x) { return x * 11; }
+inline int f3924_12(int x) { return x * 12; }
+inline int f3924_13(int x) { return x * 13; }
+inline int f3924_14(int x) { return x * 14; }
+inline int f3924_15(int x) { return x * 15; }
+inline int f3924_16(int x) { return x * 16; }
+inline int f3924_17(int x) { return x * 17; }
+inline int f3924_18(int x) { return x * 18; }
+inline int f3924_19(int x) { return x * 19; }
+inline int f3924_20(int x) { return x * 20; }
+inline int f3924_21(int x) { return x * 21; }
+inline int f3924_22(int x) { return x * 22; }
+inline int f3924_23(int x) { return x * 23; }
+inline int f3924_24(int x) { return x * 24; }
+inline int f3924_25(int x) { return x * 25; }
+inline int f3924_26(int x) { return x * 26; }
+inline int f3924_27(int x) { return x * 27; }
+inline int f3924_28(int x) { return x * 28; }
+inline int f3924_29(int x) { return x * 29; }
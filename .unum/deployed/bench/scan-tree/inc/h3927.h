@@ -0,0 +1,42 @@
+#pragma once
+/* header 3927 */
+#include <vector>
+#include "h4155.h"
+#include "h5178.h"
+#include "h2692.h"
+#include "h7777.h"
+#include "h3890.h"
+#ifdef X
+#include "h3118.h"
+#endif
+struct S3927 { int a; const char *s = "x//y"; };
+inline int f3927_0(int x) { return x * 0; }
+inline int f3927_1(int x) { return x * 1; }
+inline int f3927_2(int x) { return x * 2; }
+inline int f3927_3(int x) { return x * 3; }
+inline int f3927_4(int x) { return x * 4; }
+inline int f3927_5(int x) { return x * 5; }
+inline int f3927_6(int x) { return x * 6; }
+inline int f3927_7(int x) { return x * 7; }
+inline int f3927_8(int x) { return x * 8; }
+inline int f3927_9(int x) { return x * 9; }
+inline int f3927_10(int x) { return x * 10; }
+inline int f3927_11(int x) { return x * 11; }
+inline int f3927_12(int x) { return x * 12; }
+inline int f3927_13(int x) { return x * 13; }
+inline int f3927_14(int x) { return x * 14; }
+inline int f3927_15(int x) { return x * 15; }
+inline int f3927_16(int x) { return x * 16; }
+inline int f3927_17(int x) { return x * 17; }
+inline int f3927_18(int x) { return x * 18; }
+inline int f3927_19(int x) { return x * 19; }
+inline int f3927_20(int x) { return x * 20; }
+inline int f3927_21(int x) { return x * 21; }
+inline int f3927_22(int x) { return x * 22; }
+inline int f3927_23(int x) { return x * 23; }
+inline int f3927_24(int x) { return x * 24; }
+inline int f3927_25(int x) { return x * 25; }
+inline int f3927_26(int x) { return x * 26; }
+inline int f3927_27(int x) { return x * 27; }
+inline int f3927_28(int x) { return x * 28; }
+inline int f3927_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3928 */
+#include <vector>
+#include "h2941.h"
+#include "h5725.h"
+#include "h5776.h"
+#include "h4821.h"
+#include "h9137.h"
+#ifdef X
+#include "h9106.h"
+#endif
+struct S3928 { int a; const char *s = "x//y"; };
+inline int f3928_0(int x) { return x * 0; }
+inline int f3928_1(int x) { return x * 1; }
+inline int f3928_2(int x) { return x * 2; }
+inline int f3928_3(int x) { return x * 3; }
+inline int f3928_4(int x) { return x * 4; }
+inline int f3928_5(int x) { return x * 5; }
+inline int f3928_6(int x) { return x * 6; }
+inline int f3928_7(int x) { return x * 7; }
+inline int f3928_8(int x) { return x * 8; }
+inline int f3928_9(int x) { return x * 9; }
+inline int f3928_10(int x) { return x * 10; }
+inline int f3928_11(int x) { return x * 11; }
+inline int f3928_12(int x) { return x * 12; }
+inline int f3928_13(int x) { return x * 13; }
+inline int f3928_14(int x) { return x * 14; }
+inline int f3928_15(int x) { return x * 15; }
+inline int f3928_16(int x) { return x * 16; }
+inline int f3928_17(int x) { return x * 17; }
+inline int f3928_18(int x) { return x * 18; }
+inline int f3928_19(int x) { return x * 19; }
+inline int f3928_20(int x) { return x * 20; }
+inline int f3928_21(int x) { return x * 21; }
+inline int f3928_22(int x) { return x * 22; }
+inline int f3928_23(int x) { return x * 23; }
+inline int f3928_24(int x) { return x * 24; }
+inline int f3928_25(int x) { return x * 25; }
+inline int f3928_26(int x) { return x * 26; }
+inline int f3928_27(int x) { return x * 27; }
+inline int f3928_28(int x) { return x * 28; }
+inline int f3928_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 393 */
+#include <vector>
+#include "h5697.h"
+#include "h6836.h"
+#include "h400.h"
+#include "h8210.h"
+#include "h7893.h"
+#ifdef X
+#include "h7612.h"
+#endif
+struct S393 { int a; const char *s = "x//y"; };
+inline int f393_0(int x) { return x * 0; }
+inline int f393_1(int x) { return x * 1; }
+inline int f393_2(int x) { return x * 2; }
+inline int f393_3(int x) { return x * 3; }
+inline int f393_4(int x) { return x * 4; }
+inline int f393_5(int x) { return x * 5; }
+inline int f393_6(int x) { return x * 6; }
+inline int f393_7(int x) { return x * 7; }
+inline int f393_8(int x) { return x * 8; }
+inline int f393_9(int x) { return x * 9; }
+inline int f393_10(int x) { return x * 10; }
+inline int f393_11(int x) { return x * 11; }
+inline int f393_12(int x) { return x * 12; }
+inline int f393_13(int x) { return x * 13; }
+inline int f393_14(int x) { return x * 14; }
+inline int f393_15(int x) { return x * 15; }
+inline int f393_16(int x) { return x * 16; }
+inline int f393_17(int x) { return x * 17; }
+inline int f393_18(int x) { return x * 18; }
+inline int f393_19(int x) { return x * 19; }
+inline int f393_20(int x) { return x * 20; }
+inline int f393_21(int x) { return x * 21; }
+inline int f393_22(int x) { return x * 22; }
+inline int f393_23(int x) { return x * 23; }
+inline int f393_24(int x) { return x * 24; }
+inline int f393_25(int x) { return x * 25; }
+inline int f393_26(int x) { return x * 26; }
+inline int f393_27(int x) { return x * 27; }
+inline int f393_28(int x) { return x * 28; }
+inline int f393_29(int x) { return x * 29; }
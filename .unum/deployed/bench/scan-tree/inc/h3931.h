@@ -0,0 +1,42 @@
+#pragma once
+/* header 3931 */
+#include <vector>
+#include "h84.h"
+#include "h1527.h"
+#include "h1174.h"
+#include "h1347.h"
+#include "h9264.h"
+#ifdef X
+#include "h7054.h"
+#endif
+struct S3931 { int a; const char *s = "x//y"; };
+inline int f3931_0(int x) { return x * 0; }
+inline int f3931_1(int x) { return x * 1; }
+inline int f3931_2(int x) { return x * 2; }
+inline int f3931_3(int x) { return x * 3; }
+inline int f3931_4(int x) { return x * 4; }
+inline int f3931_5(int x) { return x * 5; }
+inline int f3931_6(int x) { return x * 6; }
+inline int f3931_7(int x) { return x * 7; }
+inline int f3931_8(int x) { return x * 8; }
+inline int f3931_9(int x) { return x * 9; }
+inline int f3931_10(int x) { return x * 10; }
+inline int f3931_11(int x) { return x * 11; }
+inline int f3931_12(int x) { return x * 12; }
+inline int f3931_13(int x) { return x * 13; }
+inline int f3931_14(int x) { return x * 14; }
+inline int f3931_15(int x) { return x * 15; }
+inline int f3931_16(int x) { return x * 16; }
+inline int f3931_17(int x) { return x * 17; }
+inline int f3931_18(int x) { return x * 18; }
+inline int f3931_19(int x) { return x * 19; }
+inline int f3931_20(int x) { return x * 20; }
+inline int f3931_21(int x) { return x * 21; }
+inline int f3931_22(int x) { return x * 22; }
+inline int f3931_23(int x) { return x * 23; }
+inline int f3931_24(int x) { return x * 24; }
+inline int f3931_25(int x) { return x * 25; }
+inline int f3931_26(int x) { return x * 26; }
+inline int f3931_27(int x) { return x * 27; }
+inline int f3931_28(int x) { return x * 28; }
+inline int f3931_29(int x) { return x * 29; }
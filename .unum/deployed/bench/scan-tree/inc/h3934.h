@@ -0,0 +1,42 @@
+#pragma once
+/* header 3934 */
+#include <vector>
+#include "h3994.h"
+#include "h644.h"
+#include "h297.h"
+#include "h9054.h"
+#include "h7068.h"
+#ifdef X
+#include "h6938.h"
+#endif
+struct S3934 { int a; const char *s = "x//y"; };
+inline int f3934_0(int x) { return x * 0; }
+inline int f3934_1(int x) { return x * 1; }
+inline int f3934_2(int x) { return x * 2; }
+inline int f3934_3(int x) { return x * 3; }
+inline int f3934_4(int x) { return x * 4; }
+inline int f3934_5(int x) { return x * 5; }
+inline int f3934_6(int x) { return x * 6; }
+inline int f3934_7(int x) { return x * 7; }
+inline int f3934_8(int x) { return x * 8; }
+inline int f3934_9(int x) { return x * 9; }
+inline int f3934_10(int x) { return x * 10; }
+inline int f3934_11(int x) { return x * 11; }
+inline int f3934_12(int x) { return x * 12; }
+inline int f3934_13(int x) { return x * 13; }
+inline int f3934_14(int x) { return x * 14; }
+inline int f3934_15(int x) { return x * 15; }
+inline int f3934_16(int x) { return x * 16; }
+inline int f3934_17(int x) { return x * 17; }
+inline int f3934_18(int x) { return x * 18; }
+inline int f3934_19(int x) { return x * 19; }
+inline int f3934_20(int x) { return x * 20; }
+inline int f3934_21(int x) { return x * 21; }
+inline int f3934_22(int x) { return x * 22; }
+inline int f3934_23(int x) { return x * 23; }
+inline int f3934_24(int x) { return x * 24; }
+inline int f3934_25(int x) { return x * 25; }
+inline int f3934_26(int x) { return x * 26; }
+inline int f3934_27(int x) { return x * 27; }
+inline int f3934_28(int x) { return x * 28; }
+inline int f3934_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3936 */
+#include <vector>
+#include "h5332.h"
+#include "h8059.h"
+#include "h8276.h"
+#include "h1682.h"
+#include "h7089.h"
+#ifdef X
+#include "h6536.h"
+#endif
+struct S3936 { int a; const char *s = "x//y"; };
+inline int f3936_0(int x) { return x * 0; }
+inline int f3936_1(int x) { return x * 1; }
+inline int f3936_2(int x) { return x * 2; }
+inline int f3936_3(int x) { return x * 3; }
+inline int f3936_4(int x) { return x * 4; }
+inline int f3936_5(int x) { return x * 5; }
+inline int f3936_6(int x) { return x * 6; }
+inline int f3936_7(int x) { return x * 7; }
+inline int f3936_8(int x) { return x * 8; }
+inline int f3936_9(int x) { return x * 9; }
+inline int f3936_10(int x) { return x * 10; }
+inline int f3936_11(int x) { return x * 11; }
+inline int f3936_12(int x) { return x * 12; }
+inline int f3936_13(int x) { return x * 13; }
+inline int f3936_14(int x) { return x * 14; }
+inline int f3936_15(int x) { return x * 15; }
+inline int f3936_16(int x) { return x * 16; }
+inline int f3936_17(int x) { return x * 17; }
+inline int f3936_18(int x) { return x * 18; }
+inline int f3936_19(int x) { return x * 19; }
+inline int f3936_20(int x) { return x * 20; }
+inline int f3936_21(int x) { return x * 21; }
+inline int f3936_22(int x) { return x * 22; }
+inline int f3936_23(int x) { return x * 23; }
+inline int f3936_24(int x) { return x * 24; }
+inline int f3936_25(int x) { return x * 25; }
+inline int f3936_26(int x) { return x * 26; }
+inline int f3936_27(int x) { return x * 27; }
+inline int f3936_28(int x) { return x * 28; }
+inline int f3936_29(int x) { return x * 29; }
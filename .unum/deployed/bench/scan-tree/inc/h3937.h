@@ -0,0 +1,42 @@
+#pragma once
+/* header 3937 */
+#include <vector>
+#include "h9436.h"
+#include "h9495.h"
+#include "h4063.h"
+#include "h6652.h"
+#include "h3854.h"
+#ifdef X
+#include "h3269.h"
+#endif
+struct S3937 { int a; const char *s = "x//y"; };
+inline int f3937_0(int x) { return x * 0; }
+inline int f3937_1(int x) { return x * 1; }
+inline int f3937_2(int x) { return x * 2; }
+inline int f3937_3(int x) { return x * 3; }
+inline int f3937_4(int x) { return x * 4; }
+inline int f3937_5(int x) { return x * 5; }
+inline int f3937_6(int x) { return x * 6; }
+inline int f3937_7(int x) { return x * 7; }
+inline int f3937_8(int x) { return x * 8; }
+inline int f3937_9(int x) { return x * 9; }
+inline int f3937_10(int x) { return x * 10; }
+inline int f3937_11(int x) { return x * 11; }
+inline int f3937_12(int x) { return x * 12; }
+inline int f3937_13(int x) { return x * 13; }
+inline int f3937_14(int x) { return x * 14; }
+inline int f3937_15(int x) { return x * 15; }
+inline int f3937_16(int x) { return x * 16; }
+inline int f3937_17(int x) { return x * 17; }
+inline int f3937_18(int x) { return x * 18; }
+inline int f3937_19(int x) { return x * 19; }
+inline int f3937_20(int x) { return x * 20; }
+inline int f3937_21(int x) { return x * 21; }
+inline int f3937_22(int x) { return x * 22; }
+inline int f3937_23(int x) { return x * 23; }
+inline int f3937_24(int x) { return x * 24; }
+inline int f3937_25(int x) { return x * 25; }
+inline int f3937_26(int x) { return x * 26; }
+inline int f3937_27(int x) { return x * 27; }
+inline int f3937_28(int x) { return x * 28; }
+inline int f3937_29(int x) { return x * 29; }
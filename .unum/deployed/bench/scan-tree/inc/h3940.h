@@ -0,0 +1,42 @@
+#pragma once
+/* header 3940 */
+#include <vector>
+#include "h5841.h"
+#include "h8579.h"
+#include "h5948.h"
+#include "h7952.h"
+#include "h2148.h"
+#ifdef X
+#include "h8860.h"
+#endif
+struct S3940 { int a; const char *s = "x//y"; };
+inline int f3940_0(int x) { return x * 0; }
+inline int f3940_1(int x) { return x * 1; }
+inline int f3940_2(int x) { return x * 2; }
+inline int f3940_3(int x) { return x * 3; }
+inline int f3940_4(int x) { return x * 4; }
+inline int f3940_5(int x) { return x * 5; }
+inline int f3940_6(int x) { return x * 6; }
+inline int f3940_7(int x) { return x * 7; }
+inline int f3940_8(int x) { return x * 8; }
+inline int f3940_9(int x) { return x * 9; }
+inline int f3940_10(int x) { return x * 10; }
+inline int f3940_11(int x) { return x * 11; }
+inline int f3940_12(int x) { return x * 12; }
+inline int f3940_13(int x) { return x * 13; }
+inline int f3940_14(int x) { return x * 14; }
+inline int f3940_15(int x) { return x * 15; }
+inline int f3940_16(int x) { return x * 16; }
+inline int f3940_17(int x) { return x * 17; }
+inline int f3940_18(int x) { return x * 18; }
+inline int f3940_19(int x) { return x * 19; }
+inline int f3940_20(int x) { return x * 20; }
+inline int f3940_21(int x) { return x * 21; }
+inline int f3940_22(int x) { return x * 22; }
+inline int f3940_23(int x) { return x * 23; }
+inline int f3940_24(int x) { return x * 24; }
+inline int f3940_25(int x) { return x * 25; }
+inline int f3940_26(int x) { return x * 26; }
+inline int f3940_27(int x) { return x * 27; }
+inline int f3940_28(int x) { return x * 28; }
+inline int f3940_29(int x) { return x * 29; }
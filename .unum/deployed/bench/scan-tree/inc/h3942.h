@@ -0,0 +1,42 @@
+#pragma once
+/* header 3942 */
+#include <vector>
+#include "h919.h"
+#include "h5700.h"
+#include "h6789.h"
+#include "h864.h"
+#include "h6217.h"
+#ifdef X
+#include "h2205.h"
+#endif
+struct S3942 { int a; const char *s = "x//y"; };
+inline int f3942_0(int x) { return x * 0; }
+inline int f3942_1(int x) { return x * 1; }
+inline int f3942_2(int x) { return x * 2; }
+inline int f3942_3(int x) { return x * 3; }
+inline int f3942_4(int x) { return x * 4; }
+inline int f3942_5(int x) { return x * 5; }
+inline int f3942_6(int x) { return x * 6; }
+inline int f3942_7(int x) { return x * 7; }
+inline int f3942_8(int x) { return x * 8; }
+inline int f3942_9(int x) { return x * 9; }
+inline int f3942_10(int x) { return x * 10; }
+inline int f3942_11(int x) { return x * 11; }
+inline int f3942_12(int x) { return x * 12; }
+inline int f3942_13(int x) { return x * 13; }
+inline int f3942_14(int x) { return x * 14; }
+inline int f3942_15(int x) { return x * 15; }
+inline int f3942_16(int x) { return x * 16; }
+inline int f3942_17(int x) { return x * 17; }
+inline int f3942_18(int x) { return x * 18; }
+inline int f3942_19(int x) { return x * 19; }
+inline int f3942_20(int x) { return x * 20; }
+inline int f3942_21(int x) { return x * 21; }
+inline int f3942_22(int x) { return x * 22; }
+inline int f3942_23(int x) { return x * 23; }
+inline int f3942_24(int x) { return x * 24; }
+inline int f3942_25(int x) { return x * 25; }
+inline int f3942_26(int x) { return x * 26; }
+inline int f3942_27(int x) { return x * 27; }
+inline int f3942_28(int x) { return x * 28; }
+inline int f3942_29(int x) { return x * 29; }
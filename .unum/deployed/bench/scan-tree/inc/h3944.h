@@ -0,0 +1,42 @@
+#pragma once
+/* header 3944 */
+#include <vector>
+#include "h7587.h"
+#include "h9658.h"
+#include "h6231.h"
+#include "h4536.h"
+#include "h7838.h"
+#ifdef X
+#include "h9880.h"
+#endif
+struct S3944 { int a; const char *s = "x//y"; };
+inline int f3944_0(int x) { return x * 0; }
+inline int f3944_1(int x) { return x * 1; }
+inline int f3944_2(int x) { return x * 2; }
+inline int f3944_3(int x) { return x * 3; }
+inline int f3944_4(int x) { return x * 4; }
+inline int f3944_5(int x) { return x * 5; }
+inline int f3944_6(int x) { return x * 6; }
+inline int f3944_7(int x) { return x * 7; }
+inline int f3944_8(int x) { return x * 8; }
+inline int f3944_9(int x) { return x * 9; }
+inline int f3944_10(int x) { return x * 10; }
+inline int f3944_11(int x) { return x * 11; }
+inline int f3944_12(int x) { return x * 12; }
+inline int f3944_13(int x) { return x * 13; }
+inline int f3944_14(int x) { return x * 14; }
+inline int f3944_15(int x) { return x * 15; }
+inline int f3944_16(int x) { return x * 16; }
+inline int f3944_17(int x) { return x * 17; }
+inline int f3944_18(int x) { return x * 18; }
+inline int f3944_19(int x) { return x * 19; }
+inline int f3944_20(int x) { return x * 20; }
+inline int f3944_21(int x) { return x * 21; }
+inline int f3944_22(int x) { return x * 22; }
+inline int f3944_23(int x) { return x * 23; }
+inline int f3944_24(int x) { return x * 24; }
+inline int f3944_25(int x) { return x * 25; }
+inline int f3944_26(int x) { return x * 26; }
+inline int f3944_27(int x) { return x * 27; }
+inline int f3944_28(int x) { return x * 28; }
+inline int f3944_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3945 */
+#include <vector>
+#include "h3050.h"
+#include "h5941.h"
+#include "h7208.h"
+#include "h4135.h"
+#include "h5423.h"
+#ifdef X
+#include "h9144.h"
+#endif
+struct S3945 { int a; const char *s = "x//y"; };
+inline int f3945_0(int x) { return x * 0; }
+inline int f3945_1(int x) { return x * 1; }
+inline int f3945_2(int x) { return x * 2; }
+inline int f3945_3(int x) { return x * 3; }
+inline int f3945_4(int x) { return x * 4; }
+inline int f3945_5(int x) { return x * 5; }
+inline int f3945_6(int x) { return x * 6; }
+inline int f3945_7(int x) { return x * 7; }
+inline int f3945_8(int x) { return x * 8; }
+inline int f3945_9(int x) { return x * 9; }
+inline int f3945_10(int x) { return x * 10; }
+inline int f3945_11(int x) { return x * 11; }
+inline int f3945_12(int x) { return x * 12; }
+inline int f3945_13(int x) { return x * 13; }
+inline int f3945_14(int x) { return x * 14; }
+inline int f3945_15(int x) { return x * 15; }
+inline int f3945_16(int x) { return x * 16; }
+inline int f3945_17(int x) { return x * 17; }
+inline int f3945_18(int x) { return x * 18; }
+inline int f3945_19(int x) { return x * 19; }
+inline int f3945_20(int x) { return x * 20; }
+inline int f3945_21(int x) { return x * 21; }
+inline int f3945_22(int x) { return x * 22; }
+inline int f3945_23(int x) { return x * 23; }
+inline int f3945_24(int x) { return x * 24; }
+inline int f3945_25(int x) { return x * 25; }
+inline int f3945_26(int x) { return x * 26; }
+inline int f3945_27(int x) { return x * 27; }
+inline int f3945_28(int x) { return x * 28; }
+inline int f3945_29(int x) { return x * 29; }
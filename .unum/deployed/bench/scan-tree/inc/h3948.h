@@ -0,0 +1,42 @@
+#pragma once
+/* header 3948 */
+#include <vector>
+#include "h5366.h"
+#include "h1761.h"
+#include "h9024.h"
+#include "h1582.h"
+#include "h7852.h"
+#ifdef X
+#include "h8072.h"
+#endif
+struct S3948 { int a; const char *s = "x//y"; };
+inline int f3948_0(int x) { return x * 0; }
+inline int f3948_1(int x) { return x * 1; }
+inline int f3948_2(int x) { return x * 2; }
+inline int f3948_3(int x) { return x * 3; }
+inline int f3948_4(int x) { return x * 4; }
+inline int f3948_5(int x) { return x * 5; }
+inline int f3948_6(int x) { return x * 6; }
+inline int f3948_7(int x) { return x * 7; }
+inline int f3948_8(int x) { return x * 8; }
+inline int f3948_9(int x) { return x * 9; }
+inline int f3948_10(int x) { return x * 10; }
+inline int f3948_11(int x) { return x * 11; }
+inline int f3948_12(int x) { return x * 12; }
+inline int f3948_13(int x) { return x * 13; }
+inline int f3948_14(int x) { return x * 14; }
+inline int f3948_15(int x) { return x * 15; }
+inline int f3948_16(int x) { return x * 16; }
+inline int f3948_17(int x) { return x * 17; }
+inline int f3948_18(int x) { return x * 18; }
+inline int f3948_19(int x) { return x * 19; }
+inline int f3948_20(int x) { return x * 20; }
+inline int f3948_21(int x) { return x * 21; }
+inline int f3948_22(int x) { return x * 22; }
+inline int f3948_23(int x) { return x * 23; }
+inline int f3948_24(int x) { return x * 24; }
+inline int f3948_25(int x) { return x * 25; }
+inline int f3948_26(int x) { return x * 26; }
+inline int f3948_27(int x) { return x * 27; }
+inline int f3948_28(int x) { return x * 28; }
+inline int f3948_29(int x) { return x * 29; }
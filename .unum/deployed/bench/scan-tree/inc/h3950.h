@@ -0,0 +1,42 @@
+#pragma once
+/* header 3950 */
+#include <vector>
+#include "h4404.h"
+#include "h2792.h"
+#include "h5878.h"
+#include "h3291.h"
+#include "h4530.h"
+#ifdef X
+#include "h385.h"
+#endif
+struct S3950 { int a; const char *s = "x//y"; };
+inline int f3950_0(int x) { return x * 0; }
+inline int f3950_1(int x) { return x * 1; }
+inline int f3950_2(int x) { return x * 2; }
+inline int f3950_3(int x) { return x * 3; }
+inline int f3950_4(int x) { return x * 4; }
+inline int f3950_5(int x) { return x * 5; }
+inline int f3950_6(int x) { return x * 6; }
+inline int f3950_7(int x) { return x * 7; }
+inline int f3950_8(int x) { return x * 8; }
+inline int f3950_9(int x) { return x * 9; }
+inline int f3950_10(int x) { return x * 10; }
+inline int f3950_11(int x) { return x * 11; }
+inline int f3950_12(int x) { return x * 12; }
+inline int f3950_13(int x) { return x * 13; }
+inline int f3950_14(int x) { return x * 14; }
+inline int f3950_15(int x) { return x * 15; }
+inline int f3950_16(int x) { return x * 16; }
+inline int f3950_17(int x) { return x * 17; }
+inline int f3950_18(int x) { return x * 18; }
+inline int f3950_19(int x) { return x * 19; }
+inline int f3950_20(int x) { return x * 20; }
+inline int f3950_21(int x) { return x * 21; }
+inline int f3950_22(int x) { return x * 22; }
+inline int f3950_23(int x) { return x * 23; }
+inline int f3950_24(int x) { return x * 24; }
+inline int f3950_25(int x) { return x * 25; }
+inline int f3950_26(int x) { return x * 26; }
+inline int f3950_27(int x) { return x * 27; }
+inline int f3950_28(int x) { return x * 28; }
+inline int f3950_29(int x) { return x * 29; }
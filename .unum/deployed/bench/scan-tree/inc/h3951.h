@@ -0,0 +1,42 @@
+#pragma once
+/* header 3951 */
+#include <vector>
+#include "h4415.h"
+#include "h9596.h"
+#include "h5306.h"
+#include "h7305.h"
+#include "h5242.h"
+#ifdef X
+#include "h8079.h"
+#endif
+struct S3951 { int a; const char *s = "x//y"; };
+inline int f3951_0(int x) { return x * 0; }
+inline int f3951_1(int x) { return x * 1; }
+inline int f3951_2(int x) { return x * 2; }
+inline int f3951_3(int x) { return x * 3; }
+inline int f3951_4(int x) { return x * 4; }
+inline int f3951_5(int x) { return x * 5; }
+inline int f3951_6(int x) { return x * 6; }
+inline int f3951_7(int x) { return x * 7; }
+inline int f3951_8(int x) { return x * 8; }
+inline int f3951_9(int x) { return x * 9; }
+inline int f3951_10(int x) { return x * 10; }
+inline int f3951_11(int x) { return x * 11; }
+inline int f3951_12(int x) { return x * 12; }
+inline int f3951_13(int x) { return x * 13; }
+inline int f3951_14(int x) { return x * 14; }
+inline int f3951_15(int x) { return x * 15; }
+inline int f3951_16(int x) { return x * 16; }
+inline int f3951_17(int x) { return x * 17; }
+inline int f3951_18(int x) { return x * 18; }
+inline int f3951_19(int x) { return x * 19; }
+inline int f3951_20(int x) { return x * 20; }
+inline int f3951_21(int x) { return x * 21; }
+inline int f3951_22(int x) { return x * 22; }
+inline int f3951_23(int x) { return x * 23; }
+inline int f3951_24(int x) { return x * 24; }
+inline int f3951_25(int x) { return x * 25; }
+inline int f3951_26(int x) { return x * 26; }
+inline int f3951_27(int x) { return x * 27; }
+inline int f3951_28(int x) { return x * 28; }
+inline int f3951_29(int x) { return x * 29; }
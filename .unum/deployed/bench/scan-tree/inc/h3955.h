@@ -0,0 +1,42 @@
+#pragma once
+/* header 3955 */
+#include <vector>
+#include "h2528.h"
+#include "h425.h"
+#include "h9148.h"
+#include "h4326.h"
+#include "h4899.h"
+#ifdef X
+#include "h7316.h"
+#endif
+struct S3955 { int a; const char *s = "x//y"; };
+inline int f3955_0(int x) { return x * 0; }
+inline int f3955_1(int x) { return x * 1; }
+inline int f3955_2(int x) { return x * 2; }
+inline int f3955_3(int x) { return x * 3; }
+inline int f3955_4(int x) { return x * 4; }
+inline int f3955_5(int x) { return x * 5; }
+inline int f3955_6(int x) { return x * 6; }
+inline int f3955_7(int x) { return x * 7; }
+inline int f3955_8(int x) { return x * 8; }
+inline int f3955_9(int x) { return x * 9; }
+inline int f3955_10(int x) { return x * 10; }
+inline int f3955_11(int x) { return x * 11; }
+inline int f3955_12(int x) { return x * 12; }
+inline int f3955_13(int x) { return x * 13; }
+inline int f3955_14(int x) { return x * 14; }
+inline int f3955_15(int x) { return x * 15; }
+inline int f3955_16(int x) { return x * 16; }
+inline int f3955_17(int x) { return x * 17; }
+inline int f3955_18(int x) { return x * 18; }
+inline int f3955_19(int x) { return x * 19; }
+inline int f3955_20(int x) { return x * 20; }
+inline int f3955_21(int x) { return x * 21; }
+inline int f3955_22(int x) { return x * 22; }
+inline int f3955_23(int x) { return x * 23; }
+inline int f3955_24(int x) { return x * 24; }
+inline int f3955_25(int x) { return x * 25; }
+inline int f3955_26(int x) { return x * 26; }
+inline int f3955_27(int x) { return x * 27; }
+inline int f3955_28(int x) { return x * 28; }
+inline int f3955_29(int x) { return x * 29; }
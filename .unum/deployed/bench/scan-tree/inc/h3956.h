@@ -0,0 +1,42 @@
+#pragma once
+/* header 3956 */
+#include <vector>
+#include "h7791.h"
+#include "h3080.h"
+#include "h9680.h"
+#include "h6610.h"
+#include "h7017.h"
+#ifdef X
+#include "h5202.h"
+#endif
+struct S3956 { int a; const char *s = "x//y"; };
+inline int f3956_0(int x) { return x * 0; }
+inline int f3956_1(int x) { return x * 1; }
+inline int f3956_2(int x) { return x * 2; }
+inline int f3956_3(int x) { return x * 3; }
+inline int f3956_4(int x) { return x * 4; }
+inline int f3956_5(int x) { return x * 5; }
+inline int f3956_6(int x) { return x * 6; }
+inline int f3956_7(int x) { return x * 7; }
+inline int f3956_8(int x) { return x * 8; }
+inline int f3956_9(int x) { return x * 9; }
+inline int f3956_10(int x) { return x * 10; }
+inline int f3956_11(int x) { return x * 11; }
+inline int f3956_12(int x) { return x * 12; }
+inline int f3956_13(int x) { return x * 13; }
+inline int f3956_14(int x) { return x * 14; }
+inline int f3956_15(int x) { return x * 15; }
+inline int f3956_16(int x) { return x * 16; }
+inline int f3956_17(int x) { return x * 17; }
+inline int f3956_18(int x) { return x * 18; }
+inline int f3956_19(int x) { return x * 19; }
+inline int f3956_20(int x) { return x * 20; }
+inline int f3956_21(int x) { return x * 21; }
+inline int f3956_22(int x) { return x * 22; }
+inline int f3956_23(int x) { return x * 23; }
+inline int f3956_24(int x) { return x * 24; }
+inline int f3956_25(int x) { return x * 25; }
+inline int f3956_26(int x) { return x * 26; }
+inline int f3956_27(int x) { return x * 27; }
+inline int f3956_28(int x) { return x * 28; }
+inline int f3956_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3957 */
+#include <vector>
+#include "h2957.h"
+#include "h7449.h"
+#include "h9177.h"
+#include "h7461.h"
+#include "h1419.h"
+#ifdef X
+#include "h7378.h"
+#endif
+struct S3957 { int a; const char *s = "x//y"; };
+inline int f3957_0(int x) { return x * 0; }
+inline int f3957_1(int x) { return x * 1; }
+inline int f3957_2(int x) { return x * 2; }
+inline int f3957_3(int x) { return x * 3; }
+inline int f3957_4(int x) { return x * 4; }
+inline int f3957_5(int x) { return x * 5; }
+inline int f3957_6(int x) { return x * 6; }
+inline int f3957_7(int x) { return x * 7; }
+inline int f3957_8(int x) { return x * 8; }
+inline int f3957_9(int x) { return x * 9; }
+inline int f3957_10(int x) { return x * 10; }
+inline int f3957_11(int x) { return x * 11; }
+inline int f3957_12(int x) { return x * 12; }
+inline int f3957_13(int x) { return x * 13; }
+inline int f3957_14(int x) { return x * 14; }
+inline int f3957_15(int x) { return x * 15; }
+inline int f3957_16(int x) { return x * 16; }
+inline int f3957_17(int x) { return x * 17; }
+inline int f3957_18(int x) { return x * 18; }
+inline int f3957_19(int x) { return x * 19; }
+inline int f3957_20(int x) { return x * 20; }
+inline int f3957_21(int x) { return x * 21; }
+inline int f3957_22(int x) { return x * 22; }
+inline int f3957_23(int x) { return x * 23; }
+inline int f3957_24(int x) { return x * 24; }
+inline int f3957_25(int x) { return x * 25; }
+inline int f3957_26(int x) { return x * 26; }
+inline int f3957_27(int x) { return x * 27; }
+inline int f3957_28(int x) { return x * 28; }
+inline int f3957_29(int x) { return x * 29; }
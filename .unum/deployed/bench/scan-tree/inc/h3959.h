@@ -0,0 +1,42 @@
+#pragma once
+/* header 3959 */
+#include <vector>
+#include "h6898.h"
+#include "h7321.h"
+#include "h6419.h"
+#include "h641.h"
+#include "h1063.h"
+#ifdef X
+#include "h6423.h"
+#endif
+struct S3959 { int a; const char *s = "x//y"; };
+inline int f3959_0(int x) { return x * 0; }
+inline int f3959_1(int x) { return x * 1; }
+inline int f3959_2(int x) { return x * 2; }
+inline int f3959_3(int x) { return x * 3; }
+inline int f3959_4(int x) { return x * 4; }
+inline int f3959_5(int x) { return x * 5; }
+inline int f3959_6(int x) { return x * 6; }
+inline int f3959_7(int x) { return x * 7; }
+inline int f3959_8(int x) { return x * 8; }
+inline int f3959_9(int x) { return x * 9; }
+inline int f3959_10(int x) { return x * 10; }
+inline int f3959_11(int x) { return x * 11; }
+inline int f3959_12(int x) { return x * 12; }
+inline int f3959_13(int x) { return x * 13; }
+inline int f3959_14(int x) { return x * 14; }
+inline int f3959_15(int x) { return x * 15; }
+inline int f3959_16(int x) { return x * 16; }
+inline int f3959_17(int x) { return x * 17; }
+inline int f3959_18(int x) { return x * 18; }
+inline int f3959_19(int x) { return x * 19; }
+inline int f3959_20(int x) { return x * 20; }
+inline int f3959_21(int x) { return x * 21; }
+inline int f3959_22(int x) { return x * 22; }
+inline int f3959_23(int x) { return x * 23; }
+inline int f3959_24(int x) { return x * 24; }
+inline int f3959_25(int x) { return x * 25; }
+inline int f3959_26(int x) { return x * 26; }
+inline int f3959_27(int x) { return x * 27; }
+inline int f3959_28(int x) { return x * 28; }
+inline int f3959_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 396 */
+#include <vector>
+#include "h7582.h"
+#include "h2934.h"
+#include "h1903.h"
+#include "h5462.h"
+#include "h1039.h"
+#ifdef X
+#include "h2363.h"
+#endif
+struct S396 { int a; const char *s = "x//y"; };
+inline int f396_0(int x) { return x * 0; }
+inline int f396_1(int x) { return x * 1; }
+inline int f396_2(int x) { return x * 2; }
+inline int f396_3(int x) { return x * 3; }
+inline int f396_4(int x) { return x * 4; }
+inline int f396_5(int x) { return x * 5; }
+inline int f396_6(int x) { return x * 6; }
+inline int f396_7(int x) { return x * 7; }
+inline int f396_8(int x) { return x * 8; }
+inline int f396_9(int x) { return x * 9; }
+inline int f396_10(int x) { return x * 10; }
+inline int f396_11(int x) { return x * 11; }
+inline int f396_12(int x) { return x * 12; }
+inline int f396_13(int x) { return x * 13; }
+inline int f396_14(int x) { return x * 14; }
+inline int f396_15(int x) { return x * 15; }
+inline int f396_16(int x) { return x * 16; }
+inline int f396_17(int x) { return x * 17; }
+inline int f396_18(int x) { return x * 18; }
+inline int f396_19(int x) { return x * 19; }
+inline int f396_20(int x) { return x * 20; }
+inline int f396_21(int x) { return x * 21; }
+inline int f396_22(int x) { return x * 22; }
+inline int f396_23(int x) { return x * 23; }
+inline int f396_24(int x) { return x * 24; }
+inline int f396_25(int x) { return x * 25; }
+inline int f396_26(int x) { return x * 26; }
+inline int f396_27(int x) { return x * 27; }
+inline int f396_28(int x) { return x * 28; }
+inline int f396_29(int x) { return x * 29; }
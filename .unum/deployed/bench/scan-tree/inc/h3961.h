@@ -0,0 +1,42 @@
+#pragma once
+/* header 3961 */
+#include <vector>
+#include "h2240.h"
+#include "h855.h"
+#include "h4803.h"
+#include "h5216.h"
+#include "h9947.h"
+#ifdef X
+#include "h2844.h"
+#endif
+struct S3961 { int a; const char *s = "x//y"; };
+inline int f3961_0(int x) { return x * 0; }
+inline int f3961_1(int x) { return x * 1; }
+inline int f3961_2(int x) { return x * 2; }
+inline int f3961_3(int x) { return x * 3; }
+inline int f3961_4(int x) { return x * 4; }
+inline int f3961_5(int x) { return x * 5; }
+inline int f3961_6(int x) { return x * 6; }
+inline int f3961_7(int x) { return x * 7; }
+inline int f3961_8(int x) { return x * 8; }
+inline int f3961_9(int x) { return x * 9; }
+inline int f3961_10(int x) { return x * 10; }
+inline int f3961_11(int x) { return x * 11; }
+inline int f3961_12(int x) { return x * 12; }
+inline int f3961_13(int x) { return x * 13; }
+inline int f3961_14(int x) { return x * 14; }
+inline int f3961_15(int x) { return x * 15; }
+inline int f3961_16(int x) { return x * 16; }
+inline int f3961_17(int x) { return x * 17; }
+inline int f3961_18(int x) { return x * 18; }
+inline int f3961_19(int x) { return x * 19; }
+inline int f3961_20(int x) { return x * 20; }
+inline int f3961_21(int x) { return x * 21; }
+inline int f3961_22(int x) { return x * 22; }
+inline int f3961_23(int x) { return x * 23; }
+inline int f3961_24(int x) { return x * 24; }
+inline int f3961_25(int x) { return x * 25; }
+inline int f3961_26(int x) { return x * 26; }
+inline int f3961_27(int x) { return x * 27; }
+inline int f3961_28(int x) { return x * 28; }
+inline int f3961_29(int x) { return x * 29; }
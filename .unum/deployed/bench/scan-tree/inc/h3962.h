@@ -0,0 +1,42 @@
+#pragma once
+/* header 3962 */
+#include <vector>
+#include "h171.h"
+#include "h9844.h"
+#include "h3272.h"
+#include "h8805.h"
+#include "h3620.h"
+#ifdef X
+#include "h3070.h"
+#endif
+struct S3962 { int a; const char *s = "x//y"; };
+inline int f3962_0(int x) { return x * 0; }
+inline int f3962_1(int x) { return x * 1; }
+inline int f3962_2(int x) { return x * 2; }
+inline int f3962_3(int x) { return x * 3; }
+inline int f3962_4(int x) { return x * 4; }
+inline int f3962_5(int x) { return x * 5; }
+inline int f3962_6(int x) { return x * 6; }
+inline int f3962_7(int x) { return x * 7; }
+inline int f3962_8(int x) { return x * 8; }
+inline int f3962_9(int x) { return x * 9; }
+inline int f3962_10(int x) { return x * 10; }
+inline int f3962_11(int x) { return x * 11; }
+inline int f3962_12(int x) { return x * 12; }
+inline int f3962_13(int x) { return x * 13; }
+inline int f3962_14(int x) { return x * 14; }
+inline int f3962_15(int x) { return x * 15; }
+inline int f3962_16(int x) { return x * 16; }
+inline int f3962_17(int x) { return x * 17; }
+inline int f3962_18(int x) { return x * 18; }
+inline int f3962_19(int x) { return x * 19; }
+inline int f3962_20(int x) { return x * 20; }
+inline int f3962_21(int x) { return x * 21; }
+inline int f3962_22(int x) { return x * 22; }
+inline int f3962_23(int x) { return x * 23; }
+inline int f3962_24(int x) { return x * 24; }
+inline int f3962_25(int x) { return x * 25; }
+inline int f3962_26(int x) { return x * 26; }
+inline int f3962_27(int x) { return x * 27; }
+inline int f3962_28(int x) { return x * 28; }
+inline int f3962_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3963 */
+#include <vector>
+#include "h1035.h"
+#include "h5946.h"
+#include "h2043.h"
+#include "h4942.h"
+#include "h7895.h"
+#ifdef X
+#include "h9295.h"
+#endif
+struct S3963 { int a; const char *s = "x//y"; };
+inline int f3963_0(int x) { return x * 0; }
+inline int f3963_1(int x) { return x * 1; }
+inline int f3963_2(int x) { return x * 2; }
+inline int f3963_3(int x) { return x * 3; }
+inline int f3963_4(int x) { return x * 4; }
+inline int f3963_5(int x) { return x * 5; }
+inline int f3963_6(int x) { return x * 6; }
+inline int f3963_7(int x) { return x * 7; }
+inline int f3963_8(int x) { return x * 8; }
+inline int f3963_9(int x) { return x * 9; }
+inline int f3963_10(int x) { return x * 10; }
+inline int f3963_11(int x) { return x * 11; }
+inline int f3963_12(int x) { return x * 12; }
+inline int f3963_13(int x) { return x * 13; }
+inline int f3963_14(int x) { return x * 14; }
+inline int f3963_15(int x) { return x * 15; }
+inline int f3963_16(int x) { return x * 16; }
+inline int f3963_17(int x) { return x * 17; }
+inline int f3963_18(int x) { return x * 18; }
+inline int f3963_19(int x) { return x * 19; }
+inline int f3963_20(int x) { return x * 20; }
+inline int f3963_21(int x) { return x * 21; }
+inline int f3963_22(int x) { return x * 22; }
+inline int f3963_23(int x) { return x * 23; }
+inline int f3963_24(int x) { return x * 24; }
+inline int f3963_25(int x) { return x * 25; }
+inline int f3963_26(int x) { return x * 26; }
+inline int f3963_27(int x) { return x * 27; }
+inline int f3963_28(int x) { return x * 28; }
+inline int f3963_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3966 */
+#include <vector>
+#include "h317.h"
+#include "h1277.h"
+#include "h3398.h"
+#include "h4748.h"
+#include "h3601.h"
+#ifdef X
+#include "h4524.h"
+#endif
+struct S3966 { int a; const char *s = "x//y"; };
+inline int f3966_0(int x) { return x * 0; }
+inline int f3966_1(int x) { return x * 1; }
+inline int f3966_2(int x) { return x * 2; }
+inline int f3966_3(int x) { return x * 3; }
+inline int f3966_4(int x) { return x * 4; }
+inline int f3966_5(int x) { return x * 5; }
+inline int f3966_6(int x) { return x * 6; }
+inline int f3966_7(int x) { return x * 7; }
+inline int f3966_8(int x) { return x * 8; }
+inline int f3966_9(int x) { return x * 9; }
+inline int f3966_10(int x) { return x * 10; }
+inline int f3966_11(int x) { return x * 11; }
+inline int f3966_12(int x) { return x * 12; }
+inline int f3966_13(int x) { return x * 13; }
+inline int f3966_14(int x) { return x * 14; }
+inline int f3966_15(int x) { return x * 15; }
+inline int f3966_16(int x) { return x * 16; }
+inline int f3966_17(int x) { return x * 17; }
+inline int f3966_18(int x) { return x * 18; }
+inline int f3966_19(int x) { return x * 19; }
+inline int f3966_20(int x) { return x * 20; }
+inline int f3966_21(int x) { return x * 21; }
+inline int f3966_22(int x) { return x * 22; }
+inline int f3966_23(int x) { return x * 23; }
+inline int f3966_24(int x) { return x * 24; }
+inline int f3966_25(int x) { return x * 25; }
+inline int f3966_26(int x) { return x * 26; }
+inline int f3966_27(int x) { return x * 27; }
+inline int f3966_28(int x) { return x * 28; }
+inline int f3966_29(int x) { return x * 29; }
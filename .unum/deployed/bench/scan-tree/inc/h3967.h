@@ -0,0 +1,42 @@
+#pragma once
+/* header 3967 */
+#include <vector>
+#include "h876.h"
+#include "h5902.h"
+#include "h2117.h"
+#include "h3728.h"
+#include "h8691.h"
+#ifdef X
+#include "h4655.h"
+#endif
+struct S3967 { int a; const char *s = "x//y"; };
+inline int f3967_0(int x) { return x * 0; }
+inline int f3967_1(int x) { return x * 1; }
+inline int f3967_2(int x) { return x * 2; }
+inline int f3967_3(int x) { return x * 3; }
+inline int f3967_4(int x) { return x * 4; }
+inline int f3967_5(int x) { return x * 5; }
+inline int f3967_6(int x) { return x * 6; }
+inline int f3967_7(int x) { return x * 7; }
+inline int f3967_8(int x) { return x * 8; }
+inline int f3967_9(int x) { return x * 9; }
+inline int f3967_10(int x) { return x * 10; }
+inline int f3967_11(int x) { return x * 11; }
+inline int f3967_12(int x) { return x * 12; }
+inline int f3967_13(int x) { return x * 13; }
+inline int f3967_14(int x) { return x * 14; }
+inline int f3967_15(int x) { return x * 15; }
+inline int f3967_16(int x) { return x * 16; }
+inline int f3967_17(int x) { return x * 17; }
+inline int f3967_18(int x) { return x * 18; }
+inline int f3967_19(int x) { return x * 19; }
+inline int f3967_20(int x) { return x * 20; }
+inline int f3967_21(int x) { return x * 21; }
+inline int f3967_22(int x) { return x * 22; }
+inline int f3967_23(int x) { return x * 23; }
+inline int f3967_24(int x) { return x * 24; }
+inline int f3967_25(int x) { return x * 25; }
+inline int f3967_26(int x) { return x * 26; }
+inline int f3967_27(int x) { return x * 27; }
+inline int f3967_28(int x) { return x * 28; }
+inline int f3967_29(int x) { return x * 29; }
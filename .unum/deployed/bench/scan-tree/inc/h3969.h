@@ -0,0 +1,42 @@
+#pragma once
+/* header 3969 */
+#include <vector>
+#include "h2329.h"
+#include "h3891.h"
+#include "h9343.h"
+#include "h5849.h"
+#include "h1027.h"
+#ifdef X
+#include "h3884.h"
+#endif
+struct S3969 { int a; const char *s = "x//y"; };
+inline int f3969_0(int x) { return x * 0; }
+inline int f3969_1(int x) { return x * 1; }
+inline int f3969_2(int x) { return x * 2; }
+inline int f3969_3(int x) { return x * 3; }
+inline int f3969_4(int x) { return x * 4; }
+inline int f3969_5(int x) { return x * 5; }
+inline int f3969_6(int x) { return x * 6; }
+inline int f3969_7(int x) { return x * 7; }
+inline int f3969_8(int x) { return x * 8; }
+inline int f3969_9(int x) { return x * 9; }
+inline int f3969_10(int x) { return x * 10; }
+inline int f3969_11(int x) { return x * 11; }
+inline int f3969_12(int x) { return x * 12; }
+inline int f3969_13(int x) { return x * 13; }
+inline int f3969_14(int x) { return x * 14; }
+inline int f3969_15(int x) { return x * 15; }
+inline int f3969_16(int x) { return x * 16; }
+inline int f3969_17(int x) { return x * 17; }
+inline int f3969_18(int x) { return x * 18; }
+inline int f3969_19(int x) { return x * 19; }
+inline int f3969_20(int x) { return x * 20; }
+inline int f3969_21(int x) { return x * 21; }
+inline int f3969_22(int x) { return x * 22; }
+inline int f3969_23(int x) { return x * 23; }
+inline int f3969_24(int x) { return x * 24; }
+inline int f3969_25(int x) { return x * 25; }
+inline int f3969_26(int x) { return x * 26; }
+inline int f3969_27(int x) { return x * 27; }
+inline int f3969_28(int x) { return x * 28; }
+inline int f3969_29(int x) { return x * 29; }
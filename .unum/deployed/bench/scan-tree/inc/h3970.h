@@ -0,0 +1,42 @@
+#pragma once
+/* header 3970 */
+#include <vector>
+#include "h3838.h"
+#include "h1639.h"
+#include "h290.h"
+#include "h3535.h"
+#include "h6543.h"
+#ifdef X
+#include "h2877.h"
+#endif
+struct S3970 { int a; const char *s = "x//y"; };
+inline int f3970_0(int x) { return x * 0; }
+inline int f3970_1(int x) { return x * 1; }
+inline int f3970_2(int x) { return x * 2; }
+inline int f3970_3(int x) { return x * 3; }
+inline int f3970_4(int x) { return x * 4; }
+inline int f3970_5(int x) { return x * 5; }
+inline int f3970_6(int x) { return x * 6; }
+inline int f3970_7(int x) { return x * 7; }
+inline int f3970_8(int x) { return x * 8; }
+inline int f3970_9(int x) { return x * 9; }
+inline int f3970_10(int x) { return x * 10; }
+inline int f3970_11(int x) { return x * 11; }
+inline int f3970_12(int x) { return x * 12; }
+inline int f3970_13(int x) { return x * 13; }
+inline int f3970_14(int x) { return x * 14; }
+inline int f3970_15(int x) { return x * 15; }
+inline int f3970_16(int x) { return x * 16; }
+inline int f3970_17(int x) { return x * 17; }
+inline int f3970_18(int x) { return x * 18; }
+inline int f3970_19(int x) { return x * 19; }
+inline int f3970_20(int x) { return x * 20; }
+inline int f3970_21(int x) { return x * 21; }
+inline int f3970_22(int x) { return x * 22; }
+inline int f3970_23(int x) { return x * 23; }
+inline int f3970_24(int x) { return x * 24; }
+inline int f3970_25(int x) { return x * 25; }
+inline int f3970_26(int x) { return x * 26; }
+inline int f3970_27(int x) { return x * 27; }
+inline int f3970_28(int x) { return x * 28; }
+inline int f3970_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3973 */
+#include <vector>
+#include "h3114.h"
+#include "h2165.h"
+#include "h953.h"
+#include "h2872.h"
+#include "h8718.h"
+#ifdef X
+#include "h1947.h"
+#endif
+struct S3973 { int a; const char *s = "x//y"; };
+inline int f3973_0(int x) { return x * 0; }
+inline int f3973_1(int x) { return x * 1; }
+inline int f3973_2(int x) { return x * 2; }
+inline int f3973_3(int x) { return x * 3; }
+inline int f3973_4(int x) { return x * 4; }
+inline int f3973_5(int x) { return x * 5; }
+inline int f3973_6(int x) { return x * 6; }
+inline int f3973_7(int x) { return x * 7; }
+inline int f3973_8(int x) { return x * 8; }
+inline int f3973_9(int x) { return x * 9; }
+inline int f3973_10(int x) { return x * 10; }
+inline int f3973_11(int x) { return x * 11; }
+inline int f3973_12(int x) { return x * 12; }
+inline int f3973_13(int x) { return x * 13; }
+inline int f3973_14(int x) { return x * 14; }
+inline int f3973_15(int x) { return x * 15; }
+inline int f3973_16(int x) { return x * 16; }
+inline int f3973_17(int x) { return x * 17; }
+inline int f3973_18(int x) { return x * 18; }
+inline int f3973_19(int x) { return x * 19; }
+inline int f3973_20(int x) { return x * 20; }
+inline int f3973_21(int x) { return x * 21; }
+inline int f3973_22(int x) { return x * 22; }
+inline int f3973_23(int x) { return x * 23; }
+inline int f3973_24(int x) { return x * 24; }
+inline int f3973_25(int x) { return x * 25; }
+inline int f3973_26(int x) { return x * 26; }
+inline int f3973_27(int x) { return x * 27; }
+inline int f3973_28(int x) { return x * 28; }
+inline int f3973_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3979 */
+#include <vector>
+#include "h965.h"
+#include "h8027.h"
+#include "h8302.h"
+#include "h4580.h"
+#include "h5173.h"
+#ifdef X
+#include "h2106.h"
+#endif
+struct S3979 { int a; const char *s = "x//y"; };
+inline int f3979_0(int x) { return x * 0; }
+inline int f3979_1(int x) { return x * 1; }
+inline int f3979_2(int x) { return x * 2; }
+inline int f3979_3(int x) { return x * 3; }
+inline int f3979_4(int x) { return x * 4; }
+inline int f3979_5(int x) { return x * 5; }
+inline int f3979_6(int x) { return x * 6; }
+inline int f3979_7(int x) { return x * 7; }
+inline int f3979_8(int x) { return x * 8; }
+inline int f3979_9(int x) { return x * 9; }
+inline int f3979_10(int x) { return x * 10; }
+inline int f3979_11(int x) { return x * 11; }
+inline int f3979_12(int x) { return x * 12; }
+inline int f3979_13(int x) { return x * 13; }
+inline int f3979_14(int x) { return x * 14; }
+inline int f3979_15(int x) { return x * 15; }
+inline int f3979_16(int x) { return x * 16; }
+inline int f3979_17(int x) { return x * 17; }
+inline int f3979_18(int x) { return x * 18; }
+inline int f3979_19(int x) { return x * 19; }
+inline int f3979_20(int x) { return x * 20; }
+inline int f3979_21(int x) { return x * 21; }
+inline int f3979_22(int x) { return x * 22; }
+inline int f3979_23(int x) { return x * 23; }
+inline int f3979_24(int x) { return x * 24; }
+inline int f3979_25(int x) { return x * 25; }
+inline int f3979_26(int x) { return x * 26; }
+inline int f3979_27(int x) { return x * 27; }
+inline int f3979_28(int x) { return x * 28; }
+inline int f3979_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3980 */
+#include <vector>
+#include "h7508.h"
+#include "h421.h"
+#include "h8800.h"
+#include "h9311.h"
+#include "h879.h"
+#ifdef X
+#include "h4531.h"
+#endif
+struct S3980 { int a; const char *s = "x//y"; };
+inline int f3980_0(int x) { return x * 0; }
+inline int f3980_1(int x) { return x * 1; }
+inline int f3980_2(int x) { return x * 2; }
+inline int f3980_3(int x) { return x * 3; }
+inline int f3980_4(int x) { return x * 4; }
+inline int f3980_5(int x) { return x * 5; }
+inline int f3980_6(int x) { return x * 6; }
+inline int f3980_7(int x) { return x * 7; }
+inline int f3980_8(int x) { return x * 8; }
+inline int f3980_9(int x) { return x * 9; }
+inline int f3980_10(int x) { return x * 10; }
+inline int f3980_11(int x) { return x * 11; }
+inline int f3980_12(int x) { return x * 12; }
+inline int f3980_13(int x) { return x * 13; }
+inline int f3980_14(int x) { return x * 14; }
+inline int f3980_15(int x) { return x * 15; }
+inline int f3980_16(int x) { return x * 16; }
+inline int f3980_17(int x) { return x * 17; }
+inline int f3980_18(int x) { return x * 18; }
+inline int f3980_19(int x) { return x * 19; }
+inline int f3980_20(int x) { return x * 20; }
+inline int f3980_21(int x) { return x * 21; }
+inline int f3980_22(int x) { return x * 22; }
+inline int f3980_23(int x) { return x * 23; }
+inline int f3980_24(int x) { return x * 24; }
+inline int f3980_25(int x) { return x * 25; }
+inline int f3980_26(int x) { return x * 26; }
+inline int f3980_27(int x) { return x * 27; }
+inline int f3980_28(int x) { return x * 28; }
+inline int f3980_29(int x) { return x * 29; }
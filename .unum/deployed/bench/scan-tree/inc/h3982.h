@@ -0,0 +1,42 @@
+#pragma once
+/* header 3982 */
+#include <vector>
+#include "h9327.h"
+#include "h112.h"
+#include "h2291.h"
+#include "h8449.h"
+#include "h1301.h"
+#ifdef X
+#include "h5727.h"
+#endif
+struct S3982 { int a; const char *s = "x//y"; };
+inline int f3982_0(int x) { return x * 0; }
+inline int f3982_1(int x) { return x * 1; }
+inline int f3982_2(int x) { return x * 2; }
+inline int f3982_3(int x) { return x * 3; }
+inline int f3982_4(int x) { return x * 4; }
+inline int f3982_5(int x) { return x * 5; }
+inline int f3982_6(int x) { return x * 6; }
+inline int f3982_7(int x) { return x * 7; }
+inline int f3982_8(int x) { return x * 8; }
+inline int f3982_9(int x) { return x * 9; }
+inline int f3982_10(int x) { return x * 10; }
+inline int f3982_11(int x) { return x * 11; }
+inline int f3982_12(int x) { return x * 12; }
+inline int f3982_13(int x) { return x * 13; }
+inline int f3982_14(int x) { return x * 14; }
+inline int f3982_15(int x) { return x * 15; }
+inline int f3982_16(int x) { return x * 16; }
+inline int f3982_17(int x) { return x * 17; }
+inline int f3982_18(int x) { return x * 18; }
+inline int f3982_19(int x) { return x * 19; }
+inline int f3982_20(int x) { return x * 20; }
+inline int f3982_21(int x) { return x * 21; }
+inline int f3982_22(int x) { return x * 22; }
+inline int f3982_23(int x) { return x * 23; }
+inline int f3982_24(int x) { return x * 24; }
+inline int f3982_25(int x) { return x * 25; }
+inline int f3982_26(int x) { return x * 26; }
+inline int f3982_27(int x) { return x * 27; }
+inline int f3982_28(int x) { return x * 28; }
+inline int f3982_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3983 */
+#include <vector>
+#include "h7620.h"
+#include "h3938.h"
+#include "h8310.h"
+#include "h2461.h"
+#include "h6942.h"
+#ifdef X
+#include "h7752.h"
+#endif
+struct S3983 { int a; const char *s = "x//y"; };
+inline int f3983_0(int x) { return x * 0; }
+inline int f3983_1(int x) { return x * 1; }
+inline int f3983_2(int x) { return x * 2; }
+inline int f3983_3(int x) { return x * 3; }
+inline int f3983_4(int x) { return x * 4; }
+inline int f3983_5(int x) { return x * 5; }
+inline int f3983_6(int x) { return x * 6; }
+inline int f3983_7(int x) { return x * 7; }
+inline int f3983_8(int x) { return x * 8; }
+inline int f3983_9(int x) { return x * 9; }
+inline int f3983_10(int x) { return x * 10; }
+inline int f3983_11(int x) { return x * 11; }
+inline int f3983_12(int x) { return x * 12; }
+inline int f3983_13(int x) { return x * 13; }
+inline int f3983_14(int x) { return x * 14; }
+inline int f3983_15(int x) { return x * 15; }
+inline int f3983_16(int x) { return x * 16; }
+inline int f3983_17(int x) { return x * 17; }
+inline int f3983_18(int x) { return x * 18; }
+inline int f3983_19(int x) { return x * 19; }
+inline int f3983_20(int x) { return x * 20; }
+inline int f3983_21(int x) { return x * 21; }
+inline int f3983_22(int x) { return x * 22; }
+inline int f3983_23(int x) { return x * 23; }
+inline int f3983_24(int x) { return x * 24; }
+inline int f3983_25(int x) { return x * 25; }
+inline int f3983_26(int x) { return x * 26; }
+inline int f3983_27(int x) { return x * 27; }
+inline int f3983_28(int x) { return x * 28; }
+inline int f3983_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3984 */
+#include <vector>
+#include "h2155.h"
+#include "h1044.h"
+#include "h7290.h"
+#include "h8953.h"
+#include "h5679.h"
+#ifdef X
+#include "h5441.h"
+#endif
+struct S3984 { int a; const char *s = "x//y"; };
+inline int f3984_0(int x) { return x * 0; }
+inline int f3984_1(int x) { return x * 1; }
+inline int f3984_2(int x) { return x * 2; }
+inline int f3984_3(int x) { return x * 3; }
+inline int f3984_4(int x) { return x * 4; }
+inline int f3984_5(int x) { return x * 5; }
+inline int f3984_6(int x) { return x * 6; }
+inline int f3984_7(int x) { return x * 7; }
+inline int f3984_8(int x) { return x * 8; }
+inline int f3984_9(int x) { return x * 9; }
+inline int f3984_10(int x) { return x * 10; }
+inline int f3984_11(int x) { return x * 11; }
+inline int f3984_12(int x) { return x * 12; }
+inline int f3984_13(int x) { return x * 13; }
+inline int f3984_14(int x) { return x * 14; }
+inline int f3984_15(int x) { return x * 15; }
+inline int f3984_16(int x) { return x * 16; }
+inline int f3984_17(int x) { return x * 17; }
+inline int f3984_18(int x) { return x * 18; }
+inline int f3984_19(int x) { return x * 19; }
+inline int f3984_20(int x) { return x * 20; }
+inline int f3984_21(int x) { return x * 21; }
+inline int f3984_22(int x) { return x * 22; }
+inline int f3984_23(int x) { return x * 23; }
+inline int f3984_24(int x) { return x * 24; }
+inline int f3984_25(int x) { return x * 25; }
+inline int f3984_26(int x) { return x * 26; }
+inline int f3984_27(int x) { return x * 27; }
+inline int f3984_28(int x) { return x * 28; }
+inline int f3984_29(int x) { return x * 29; }
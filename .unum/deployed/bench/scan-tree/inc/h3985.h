@@ -0,0 +1,42 @@
+#pragma once
+/* header 3985 */
+#include <vector>
+#include "h1408.h"
+#include "h5957.h"
+#include "h9067.h"
+#include "h2016.h"
+#include "h72.h"
+#ifdef X
+#include "h1518.h"
+#endif
+struct S3985 { int a; const char *s = "x//y"; };
+inline int f3985_0(int x) { return x * 0; }
+inline int f3985_1(int x) { return x * 1; }
+inline int f3985_2(int x) { return x * 2; }
+inline int f3985_3(int x) { return x * 3; }
+inline int f3985_4(int x) { return x * 4; }
+inline int f3985_5(int x) { return x * 5; }
+inline int f3985_6(int x) { return x * 6; }
+inline int f3985_7(int x) { return x * 7; }
+inline int f3985_8(int x) { return x * 8; }
+inline int f3985_9(int x) { return x * 9; }
+inline int f3985_10(int x) { return x * 10; }
+inline int f3985_11(int x) { return x * 11; }
+inline int f3985_12(int x) { return x * 12; }
+inline int f3985_13(int x) { return x * 13; }
+inline int f3985_14(int x) { return x * 14; }
+inline int f3985_15(int x) { return x * 15; }
+inline int f3985_16(int x) { return x * 16; }
+inline int f3985_17(int x) { return x * 17; }
+inline int f3985_18(int x) { return x * 18; }
+inline int f3985_19(int x) { return x * 19; }
+inline int f3985_20(int x) { return x * 20; }
+inline int f3985_21(int x) { return x * 21; }
+inline int f3985_22(int x) { return x * 22; }
+inline int f3985_23(int x) { return x * 23; }
+inline int f3985_24(int x) { return x * 24; }
+inline int f3985_25(int x) { return x * 25; }
+inline int f3985_26(int x) { return x * 26; }
+inline int f3985_27(int x) { return x * 27; }
+inline int f3985_28(int x) { return x * 28; }
+inline int f3985_29(int x) { return x * 29; }
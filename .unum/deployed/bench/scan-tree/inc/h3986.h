@@ -0,0 +1,42 @@
+#pragma once
+/* header 3986 */
+#include <vector>
+#include "h6717.h"
+#include "h5623.h"
+#include "h7618.h"
+#include "h6783.h"
+#include "h1880.h"
+#ifdef X
+#include "h6567.h"
+#endif
+struct S3986 { int a; const char *s = "x//y"; };
+inline int f3986_0(int x) { return x * 0; }
+inline int f3986_1(int x) { return x * 1; }
+inline int f3986_2(int x) { return x * 2; }
+inline int f3986_3(int x) { return x * 3; }
+inline int f3986_4(int x) { return x * 4; }
+inline int f3986_5(int x) { return x * 5; }
+inline int f3986_6(int x) { return x * 6; }
+inline int f3986_7(int x) { return x * 7; }
+inline int f3986_8(int x) { return x * 8; }
+inline int f3986_9(int x) { return x * 9; }
+inline int f3986_10(int x) { return x * 10; }
+inline int f3986_11(int x) { return x * 11; }
+inline int f3986_12(int x) { return x * 12; }
+inline int f3986_13(int x) { return x * 13; }
+inline int f3986_14(int x) { return x * 14; }
+inline int f3986_15(int x) { return x * 15; }
+inline int f3986_16(int x) { return x * 16; }
+inline int f3986_17(int x) { return x * 17; }
+inline int f3986_18(int x) { return x * 18; }
+inline int f3986_19(int x) { return x * 19; }
+inline int f3986_20(int x) { return x * 20; }
+inline int f3986_21(int x) { return x * 21; }
+inline int f3986_22(int x) { return x * 22; }
+inline int f3986_23(int x) { return x * 23; }
+inline int f3986_24(int x) { return x * 24; }
+inline int f3986_25(int x) { return x * 25; }
+inline int f3986_26(int x) { return x * 26; }
+inline int f3986_27(int x) { return x * 27; }
+inline int f3986_28(int x) { return x * 28; }
+inline int f3986_29(int x) { return x * 29; }
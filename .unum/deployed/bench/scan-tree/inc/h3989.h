@@ -0,0 +1,42 @@
+#pragma once
+/* header 3989 */
+#include <vector>
+#include "h7938.h"
+#include "h8202.h"
+#include "h1546.h"
+#include "h982.h"
+#include "h8700.h"
+#ifdef X
+#include "h4113.h"
+#endif
+struct S3989 { int a; const char *s = "x//y"; };
+inline int f3989_0(int x) { return x * 0; }
+inline int f3989_1(int x) { return x * 1; }
+inline int f3989_2(int x) { return x * 2; }
+inline int f3989_3(int x) { return x * 3; }
+inline int f3989_4(int x) { return x * 4; }
+inline int f3989_5(int x) { return x * 5; }
+inline int f3989_6(int x) { return x * 6; }
+inline int f3989_7(int x) { return x * 7; }
+inline int f3989_8(int x) { return x * 8; }
+inline int f3989_9(int x) { return x * 9; }
+inline int f3989_10(int x) { return x * 10; }
+inline int f3989_11(int x) { return x * 11; }
+inline int f3989_12(int x) { return x * 12; }
+inline int f3989_13(int x) { return x * 13; }
+inline int f3989_14(int x) { return x * 14; }
+inline int f3989_15(int x) { return x * 15; }
+inline int f3989_16(int x) { return x * 16; }
+inline int f3989_17(int x) { return x * 17; }
+inline int f3989_18(int x) { return x * 18; }
+inline int f3989_19(int x) { return x * 19; }
+inline int f3989_20(int x) { return x * 20; }
+inline int f3989_21(int x) { return x * 21; }
+inline int f3989_22(int x) { return x * 22; }
+inline int f3989_23(int x) { return x * 23; }
+inline int f3989_24(int x) { return x * 24; }
+inline int f3989_25(int x) { return x * 25; }
+inline int f3989_26(int x) { return x * 26; }
+inline int f3989_27(int x) { return x * 27; }
+inline int f3989_28(int x) { return x * 28; }
+inline int f3989_29(int x) { return x * 29; }
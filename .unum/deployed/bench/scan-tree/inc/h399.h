@@ -0,0 +1,42 @@
+#pragma once
+/* header 399 */
+#include <vector>
+#include "h380.h"
+#include "h7852.h"
+#include "h9422.h"
+#include "h3742.h"
+#include "h8400.h"
+#ifdef X
+#include "h2859.h"
+#endif
+struct S399 { int a; const char *s = "x//y"; };
+inline int f399_0(int x) { return x * 0; }
+inline int f399_1(int x) { return x * 1; }
+inline int f399_2(int x) { return x * 2; }
+inline int f399_3(int x) { return x * 3; }
+inline int f399_4(int x) { return x * 4; }
+inline int f399_5(int x) { return x * 5; }
+inline int f399_6(int x) { return x * 6; }
+inline int f399_7(int x) { return x * 7; }
+inline int f399_8(int x) { return x * 8; }
+inline int f399_9(int x) { return x * 9; }
+inline int f399_10(int x) { return x * 10; }
+inline int f399_11(int x) { return x * 11; }
+inline int f399_12(int x) { return x * 12; }
+inline int f399_13(int x) { return x * 13; }
+inline int f399_14(int x) { return x * 14; }
+inline int f399_15(int x) { return x * 15; }
+inline int f399_16(int x) { return x * 16; }
+inline int f399_17(int x) { return x * 17; }
+inline int f399_18(int x) { return x * 18; }
+inline int f399_19(int x) { return x * 19; }
+inline int f399_20(int x) { return x * 20; }
+inline int f399_21(int x) { return x * 21; }
+inline int f399_22(int x) { return x * 22; }
+inline int f399_23(int x) { return x * 23; }
+inline int f399_24(int x) { return x * 24; }
+inline int f399_25(int x) { return x * 25; }
+inline int f399_26(int x) { return x * 26; }
+inline int f399_27(int x) { return x * 27; }
+inline int f399_28(int x) { return x * 28; }
+inline int f399_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3992 */
+#include <vector>
+#include "h7822.h"
+#include "h8240.h"
+#include "h3329.h"
+#include "h5000.h"
+#include "h3747.h"
+#ifdef X
+#include "h5271.h"
+#endif
+struct S3992 { int a; const char *s = "x//y"; };
+inline int f3992_0(int x) { return x * 0; }
+inline int f3992_1(int x) { return x * 1; }
+inline int f3992_2(int x) { return x * 2; }
+inline int f3992_3(int x) { return x * 3; }
+inline int f3992_4(int x) { return x * 4; }
+inline int f3992_5(int x) { return x * 5; }
+inline int f3992_6(int x) { return x * 6; }
+inline int f3992_7(int x) { return x * 7; }
+inline int f3992_8(int x) { return x * 8; }
+inline int f3992_9(int x) { return x * 9; }
+inline int f3992_10(int x) { return x * 10; }
+inline int f3992_11(int x) { return x * 11; }
+inline int f3992_12(int x) { return x * 12; }
+inline int f3992_13(int x) { return x * 13; }
+inline int f3992_14(int x) { return x * 14; }
+inline int f3992_15(int x) { return x * 15; }
+inline int f3992_16(int x) { return x * 16; }
+inline int f3992_17(int x) { return x * 17; }
+inline int f3992_18(int x) { return x * 18; }
+inline int f3992_19(int x) { return x * 19; }
+inline int f3992_20(int x) { return x * 20; }
+inline int f3992_21(int x) { return x * 21; }
+inline int f3992_22(int x) { return x * 22; }
+inline int f3992_23(int x) { return x * 23; }
+inline int f3992_24(int x) { return x * 24; }
+inline int f3992_25(int x) { return x * 25; }
+inline int f3992_26(int x) { return x * 26; }
+inline int f3992_27(int x) { return x * 27; }
+inline int f3992_28(int x) { return x * 28; }
+inline int f3992_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3997 */
+#include <vector>
+#include "h1013.h"
+#include "h5014.h"
+#include "h9401.h"
+#include "h1122.h"
+#include "h2084.h"
+#ifdef X
+#include "h3326.h"
+#endif
+struct S3997 { int a; const char *s = "x//y"; };
+inline int f3997_0(int x) { return x * 0; }
+inline int f3997_1(int x) { return x * 1; }
+inline int f3997_2(int x) { return x * 2; }
+inline int f3997_3(int x) { return x * 3; }
+inline int f3997_4(int x) { return x * 4; }
+inline int f3997_5(int x) { return x * 5; }
+inline int f3997_6(int x) { return x * 6; }
+inline int f3997_7(int x) { return x * 7; }
+inline int f3997_8(int x) { return x * 8; }
+inline int f3997_9(int x) { return x * 9; }
+inline int f3997_10(int x) { return x * 10; }
+inline int f3997_11(int x) { return x * 11; }
+inline int f3997_12(int x) { return x * 12; }
+inline int f3997_13(int x) { return x * 13; }
+inline int f3997_14(int x) { return x * 14; }
+inline int f3997_15(int x) { return x * 15; }
+inline int f3997_16(int x) { return x * 16; }
+inline int f3997_17(int x) { return x * 17; }
+inline int f3997_18(int x) { return x * 18; }
+inline int f3997_19(int x) { return x * 19; }
+inline int f3997_20(int x) { return x * 20; }
+inline int f3997_21(int x) { return x * 21; }
+inline int f3997_22(int x) { return x * 22; }
+inline int f3997_23(int x) { return x * 23; }
+inline int f3997_24(int x) { return x * 24; }
+inline int f3997_25(int x) { return x * 25; }
+inline int f3997_26(int x) { return x * 26; }
+inline int f3997_27(int x) { return x * 27; }
+inline int f3997_28(int x) { return x * 28; }
+inline int f3997_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 3998 */
+#include <vector>
+#include "h4782.h"
+#include "h4506.h"
+#include "h4824.h"
+#include "h7127.h"
+#include "h8148.h"
+#ifdef X
+#include "h7641.h"
+#endif
+struct S3998 { int a; const char *s = "x//y"; };
+inline int f3998_0(int x) { return x * 0; }
+inline int f3998_1(int x) { return x * 1; }
+inline int f3998_2(int x) { return x * 2; }
+inline int f3998_3(int x) { return x * 3; }
+inline int f3998_4(int x) { return x * 4; }
+inline int f3998_5(int x) { return x * 5; }
+inline int f3998_6(int x) { return x * 6; }
+inline int f3998_7(int x) { return x * 7; }
+inline int f3998_8(int x) { return x * 8; }
+inline int f3998_9(int x) { return x * 9; }
+inline int f3998_10(int x) { return x * 10; }
+inline int f3998_11(int x) { return x * 11; }
+inline int f3998_12(int x) { return x * 12; }
+inline int f3998_13(int x) { return x * 13; }
+inline int f3998_14(int x) { return x * 14; }
+inline int f3998_15(int x) { return x * 15; }
+inline int f3998_16(int x) { return x * 16; }
+inline int f3998_17(int x) { return x * 17; }
+inline int f3998_18(int x) { return x * 18; }
+inline int f3998_19(int x) { return x * 19; }
+inline int f3998_20(int x) { return x * 20; }
+inline int f3998_21(int x) { return x * 21; }
+inline int f3998_22(int x) { return x * 22; }
+inline int f3998_23(int x) { return x * 23; }
+inline int f3998_24(int x) { return x * 24; }
+inline int f3998_25(int x) { return x * 25; }
+inline int f3998_26(int x) { return x * 26; }
+inline int f3998_27(int x) { return x * 27; }
+inline int f3998_28(int x) { return x * 28; }
+inline int f3998_29(int x) { return x * 29; }
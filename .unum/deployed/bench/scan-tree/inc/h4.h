@@ -0,0 +1,42 @@
+#pragma once
+/* header 4 */
+#include <vector>
+#include "h9804.h"
+#include "h7874.h"
+#include "h2282.h"
+#include "h8146.h"
+#include "h9609.h"
+#ifdef X
+#include "h2462.h"
+#endif
+struct S4 { int a; const char *s = "x//y"; };
+inline int f4_0(int x) { return x * 0; }
+inline int f4_1(int x) { return x * 1; }
+inline int f4_2(int x) { return x * 2; }
+inline int f4_3(int x) { return x * 3; }
+inline int f4_4(int x) { return x * 4; }
+inline int f4_5(int x) { return x * 5; }
+inline int f4_6(int x) { return x * 6; }
+inline int f4_7(int x) { return x * 7; }
+inline int f4_8(int x) { return x * 8; }
+inline int f4_9(int x) { return x * 9; }
+inline int f4_10(int x) { return x * 10; }
+inline int f4_11(int x) { return x * 11; }
+inline int f4_12(int x) { return x * 12; }
+inline int f4_13(int x) { return x * 13; }
+inline int f4_14(int x) { return x * 14; }
+inline int f4_15(int x) { return x * 15; }
+inline int f4_16(int x) { return x * 16; }
+inline int f4_17(int x) { return x * 17; }
+inline int f4_18(int x) { return x * 18; }
+inline int f4_19(int x) { return x * 19; }
+inline int f4_20(int x) { return x * 20; }
+inline int f4_21(int x) { return x * 21; }
+inline int f4_22(int x) { return x * 22; }
+inline int f4_23(int x) { return x * 23; }
+inline int f4_24(int x) { return x * 24; }
+inline int f4_25(int x) { return x * 25; }
+inline int f4_26(int x) { return x * 26; }
+inline int f4_27(int x) { return x * 27; }
+inline int f4_28(int x) { return x * 28; }
+inline int f4_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 40 */
+#include <vector>
+#include "h4305.h"
+#include "h6519.h"
+#include "h7169.h"
+#include "h496.h"
+#include "h1796.h"
+#ifdef X
+#include "h944.h"
+#endif
+struct S40 { int a; const char *s = "x//y"; };
+inline int f40_0(int x) { return x * 0; }
+inline int f40_1(int x) { return x * 1; }
+inline int f40_2(int x) { return x * 2; }
+inline int f40_3(int x) { return x * 3; }
+inline int f40_4(int x) { return x * 4; }
+inline int f40_5(int x) { return x * 5; }
+inline int f40_6(int x) { return x * 6; }
+inline int f40_7(int x) { return x * 7; }
+inline int f40_8(int x) { return x * 8; }
+inline int f40_9(int x) { return x * 9; }
+inline int f40_10(int x) { return x * 10; }
+inline int f40_11(int x) { return x * 11; }
+inline int f40_12(int x) { return x * 12; }
+inline int f40_13(int x) { return x * 13; }
+inline int f40_14(int x) { return x * 14; }
+inline int f40_15(int x) { return x * 15; }
+inline int f40_16(int x) { return x * 16; }
+inline int f40_17(int x) { return x * 17; }
+inline int f40_18(int x) { return x * 18; }
+inline int f40_19(int x) { return x * 19; }
+inline int f40_20(int x) { return x * 20; }
+inline int f40_21(int x) { return x * 21; }
+inline int f40_22(int x) { return x * 22; }
+inline int f40_23(int x) { return x * 23; }
+inline int f40_24(int x) { return x * 24; }
+inline int f40_25(int x) { return x * 25; }
+inline int f40_26(int x) { return x * 26; }
+inline int f40_27(int x) { return x * 27; }
+inline int f40_28(int x) { return x * 28; }
+inline int f40_29(int x) { return x * 29; }
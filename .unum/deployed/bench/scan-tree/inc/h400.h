@@ -0,0 +1,42 @@
+#pragma once
+/* header 400 */
+#include <vector>
+#include "h2299.h"
+#include "h1492.h"
+#include "h3050.h"
+#include "h5666.h"
+#include "h2930.h"
+#ifdef X
+#include "h4172.h"
+#endif
+struct S400 { int a; const char *s = "x//y"; };
+inline int f400_0(int x) { return x * 0; }
+inline int f400_1(int x) { return x * 1; }
+inline int f400_2(int x) { return x * 2; }
+inline int f400_3(int x) { return x * 3; }
+inline int f400_4(int x) { return x * 4; }
+inline int f400_5(int x) { return x * 5; }
+inline int f400_6(int x) { return x * 6; }
+inline int f400_7(int x) { return x * 7; }
+inline int f400_8(int x) { return x * 8; }
+inline int f400_9(int x) { return x * 9; }
+inline int f400_10(int x) { return x * 10; }
+inline int f400_11(int x) { return x * 11; }
+inline int f400_12(int x) { return x * 12; }
+inline int f400_13(int x) { return x * 13; }
+inline int f400_14(int x) { return x * 14; }
+inline int f400_15(int x) { return x * 15; }
+inline int f400_16(int x) { return x * 16; }
+inline int f400_17(int x) { return x * 17; }
+inline int f400_18(int x) { return x * 18; }
+inline int f400_19(int x) { return x * 19; }
+inline int f400_20(int x) { return x * 20; }
+inline int f400_21(int x) { return x * 21; }
+inline int f400_22(int x) { return x * 22; }
+inline int f400_23(int x) { return x * 23; }
+inline int f400_24(int x) { return x * 24; }
+inline int f400_25(int x) { return x * 25; }
+inline int f400_26(int x) { return x * 26; }
+inline int f400_27(int x) { return x * 27; }
+inline int f400_28(int x) { return x * 28; }
+inline int f400_29(int x) { return x * 29; }
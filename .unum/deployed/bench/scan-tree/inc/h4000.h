@@ -0,0 +1,42 @@
+#pragma once
+/* header 4000 */
+#include <vector>
+#include "h4734.h"
+#include "h2947.h"
+#include "h408.h"
+#include "h486.h"
+#include "h6130.h"
+#ifdef X
+#include "h8610.h"
+#endif
+struct S4000 { int a; const char *s = "x//y"; };
+inline int f4000_0(int x) { return x * 0; }
+inline int f4000_1(int x) { return x * 1; }
+inline int f4000_2(int x) { return x * 2; }
+inline int f4000_3(int x) { return x * 3; }
+inline int f4000_4(int x) { return x * 4; }
+inline int f4000_5(int x) { return x * 5; }
+inline int f4000_6(int x) { return x * 6; }
+inline int f4000_7(int x) { return x * 7; }
+inline int f4000_8(int x) { return x * 8; }
+inline int f4000_9(int x) { return x * 9; }
+inline int f4000_10(int x) { return x * 10; }
+inline int f4000_11(int x) { return x * 11; }
+inline int f4000_12(int x) { return x * 12; }
+inline int f4000_13(int x) { return x * 13; }
+inline int f4000_14(int x) { return x * 14; }
+inline int f4000_15(int x) { return x * 15; }
+inline int f4000_16(int x) { return x * 16; }
+inline int f4000_17(int x) { return x * 17; }
+inline int f4000_18(int x) { return x * 18; }
+inline int f4000_19(int x) { return x * 19; }
+inline int f4000_20(int x) { return x * 20; }
+inline int f4000_21(int x) { return x * 21; }
+inline int f4000_22(int x) { return x * 22; }
+inline int f4000_23(int x) { return x * 23; }
+inline int f4000_24(int x) { return x * 24; }
+inline int f4000_25(int x) { return x * 25; }
+inline int f4000_26(int x) { return x * 26; }
+inline int f4000_27(int x) { return x * 27; }
+inline int f4000_28(int x) { return x * 28; }
+inline int f4000_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4005 */
+#include <vector>
+#include "h9253.h"
+#include "h9604.h"
+#include "h7114.h"
+#include "h5732.h"
+#include "h1185.h"
+#ifdef X
+#include "h5096.h"
+#endif
+struct S4005 { int a; const char *s = "x//y"; };
+inline int f4005_0(int x) { return x * 0; }
+inline int f4005_1(int x) { return x * 1; }
+inline int f4005_2(int x) { return x * 2; }
+inline int f4005_3(int x) { return x * 3; }
+inline int f4005_4(int x) { return x * 4; }
+inline int f4005_5(int x) { return x * 5; }
+inline int f4005_6(int x) { return x * 6; }
+inline int f4005_7(int x) { return x * 7; }
+inline int f4005_8(int x) { return x * 8; }
+inline int f4005_9(int x) { return x * 9; }
+inline int f4005_10(int x) { return x * 10; }
+inline int f4005_11(int x) { return x * 11; }
+inline int f4005_12(int x) { return x * 12; }
+inline int f4005_13(int x) { return x * 13; }
+inline int f4005_14(int x) { return x * 14; }
+inline int f4005_15(int x) { return x * 15; }
+inline int f4005_16(int x) { return x * 16; }
+inline int f4005_17(int x) { return x * 17; }
+inline int f4005_18(int x) { return x * 18; }
+inline int f4005_19(int x) { return x * 19; }
+inline int f4005_20(int x) { return x * 20; }
+inline int f4005_21(int x) { return x * 21; }
+inline int f4005_22(int x) { return x * 22; }
+inline int f4005_23(int x) { return x * 23; }
+inline int f4005_24(int x) { return x * 24; }
+inline int f4005_25(int x) { return x * 25; }
+inline int f4005_26(int x) { return x * 26; }
+inline int f4005_27(int x) { return x * 27; }
+inline int f4005_28(int x) { return x * 28; }
+inline int f4005_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4007 */
+#include <vector>
+#include "h3559.h"
+#include "h3989.h"
+#include "h4670.h"
+#include "h4551.h"
+#include "h739.h"
+#ifdef X
+#include "h8307.h"
+#endif
+struct S4007 { int a; const char *s = "x//y"; };
+inline int f4007_0(int x) { return x * 0; }
+inline int f4007_1(int x) { return x * 1; }
+inline int f4007_2(int x) { return x * 2; }
+inline int f4007_3(int x) { return x * 3; }
+inline int f4007_4(int x) { return x * 4; }
+inline int f4007_5(int x) { return x * 5; }
+inline int f4007_6(int x) { return x * 6; }
+inline int f4007_7(int x) { return x * 7; }
+inline int f4007_8(int x) { return x * 8; }
+inline int f4007_9(int x) { return x * 9; }
+inline int f4007_10(int x) { return x * 10; }
+inline int f4007_11(int x) { return x * 11; }
+inline int f4007_12(int x) { return x * 12; }
+inline int f4007_13(int x) { return x * 13; }
+inline int f4007_14(int x) { return x * 14; }
+inline int f4007_15(int x) { return x * 15; }
+inline int f4007_16(int x) { return x * 16; }
+inline int f4007_17(int x) { return x * 17; }
+inline int f4007_18(int x) { return x * 18; }
+inline int f4007_19(int x) { return x * 19; }
+inline int f4007_20(int x) { return x * 20; }
+inline int f4007_21(int x) { return x * 21; }
+inline int f4007_22(int x) { return x * 22; }
+inline int f4007_23(int x) { return x * 23; }
+inline int f4007_24(int x) { return x * 24; }
+inline int f4007_25(int x) { return x * 25; }
+inline int f4007_26(int x) { return x * 26; }
+inline int f4007_27(int x) { return x * 27; }
+inline int f4007_28(int x) { return x * 28; }
+inline int f4007_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4008 */
+#include <vector>
+#include "h858.h"
+#include "h5986.h"
+#include "h2941.h"
+#include "h6713.h"
+#include "h2429.h"
+#ifdef X
+#include "h7939.h"
+#endif
+struct S4008 { int a; const char *s = "x//y"; };
+inline int f4008_0(int x) { return x * 0; }
+inline int f4008_1(int x) { return x * 1; }
+inline int f4008_2(int x) { return x * 2; }
+inline int f4008_3(int x) { return x * 3; }
+inline int f4008_4(int x) { return x * 4; }
+inline int f4008_5(int x) { return x * 5; }
+inline int f4008_6(int x) { return x * 6; }
+inline int f4008_7(int x) { return x * 7; }
+inline int f4008_8(int x) { return x * 8; }
+inline int f4008_9(int x) { return x * 9; }
+inline int f4008_10(int x) { return x * 10; }
+inline int f4008_11(int x) { return x * 11; }
+inline int f4008_12(int x) { return x * 12; }
+inline int f4008_13(int x) { return x * 13; }
+inline int f4008_14(int x) { return x * 14; }
+inline int f4008_15(int x) { return x * 15; }
+inline int f4008_16(int x) { return x * 16; }
+inline int f4008_17(int x) { return x * 17; }
+inline int f4008_18(int x) { return x * 18; }
+inline int f4008_19(int x) { return x * 19; }
+inline int f4008_20(int x) { return x * 20; }
+inline int f4008_21(int x) { return x * 21; }
+inline int f4008_22(int x) { return x * 22; }
+inline int f4008_23(int x) { return x * 23; }
+inline int f4008_24(int x) { return x * 24; }
+inline int f4008_25(int x) { return x * 25; }
+inline int f4008_26(int x) { return x * 26; }
+inline int f4008_27(int x) { return x * 27; }
+inline int f4008_28(int x) { return x * 28; }
+inline int f4008_29(int x) { return x * 29; }
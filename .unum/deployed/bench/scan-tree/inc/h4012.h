@@ -0,0 +1,42 @@
+#pragma once
+/* header 4012 */
+#include <vector>
+#include "h9437.h"
+#include "h2628.h"
+#include "h7975.h"
+#include "h7945.h"
+#include "h3886.h"
+#ifdef X
+#include "h5050.h"
+#endif
+struct S4012 { int a; const char *s = "x//y"; };
+inline int f4012_0(int x) { return x * 0; }
+inline int f4012_1(int x) { return x * 1; }
+inline int f4012_2(int x) { return x * 2; }
+inline int f4012_3(int x) { return x * 3; }
+inline int f4012_4(int x) { return x * 4; }
+inline int f4012_5(int x) { return x * 5; }
+inline int f4012_6(int x) { return x * 6; }
+inline int f4012_7(int x) { return x * 7; }
+inline int f4012_8(int x) { return x * 8; }
+inline int f4012_9(int x) { return x * 9; }
+inline int f4012_10(int x) { return x * 10; }
+inline int f4012_11(int x) { return x * 11; }
+inline int f4012_12(int x) { return x * 12; }
+inline int f4012_13(int x) { return x * 13; }
+inline int f4012_14(int x) { return x * 14; }
+inline int f4012_15(int x) { return x * 15; }
+inline int f4012_16(int x) { return x * 16; }
+inline int f4012_17(int x) { return x * 17; }
+inline int f4012_18(int x) { return x * 18; }
+inline int f4012_19(int x) { return x * 19; }
+inline int f4012_20(int x) { return x * 20; }
+inline int f4012_21(int x) { return x * 21; }
+inline int f4012_22(int x) { return x * 22; }
+inline int f4012_23(int x) { return x * 23; }
+inline int f4012_24(int x) { return x * 24; }
+inline int f4012_25(int x) { return x * 25; }
+inline int f4012_26(int x) { return x * 26; }
+inline int f4012_27(int x) { return x * 27; }
+inline int f4012_28(int x) { return x * 28; }
+inline int f4012_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4014 */
+#include <vector>
+#include "h8209.h"
+#include "h9916.h"
+#include "h4860.h"
+#include "h2364.h"
+#include "h9084.h"
+#ifdef X
+#include "h5795.h"
+#endif
+struct S4014 { int a; const char *s = "x//y"; };
+inline int f4014_0(int x) { return x * 0; }
+inline int f4014_1(int x) { return x * 1; }
+inline int f4014_2(int x) { return x * 2; }
+inline int f4014_3(int x) { return x * 3; }
+inline int f4014_4(int x) { return x * 4; }
+inline int f4014_5(int x) { return x * 5; }
+inline int f4014_6(int x) { return x * 6; }
+inline int f4014_7(int x) { return x * 7; }
+inline int f4014_8(int x) { return x * 8; }
+inline int f4014_9(int x) { return x * 9; }
+inline int f4014_10(int x) { return x * 10; }
+inline int f4014_11(int x) { return x * 11; }
+inline int f4014_12(int x) { return x * 12; }
+inline int f4014_13(int x) { return x * 13; }
+inline int f4014_14(int x) { return x * 14; }
+inline int f4014_15(int x) { return x * 15; }
+inline int f4014_16(int x) { return x * 16; }
+inline int f4014_17(int x) { return x * 17; }
+inline int f4014_18(int x) { return x * 18; }
+inline int f4014_19(int x) { return x * 19; }
+inline int f4014_20(int x) { return x * 20; }
+inline int f4014_21(int x) { return x * 21; }
+inline int f4014_22(int x) { return x * 22; }
+inline int f4014_23(int x) { return x * 23; }
+inline int f4014_24(int x) { return x * 24; }
+inline int f4014_25(int x) { return x * 25; }
+inline int f4014_26(int x) { return x * 26; }
+inline int f4014_27(int x) { return x * 27; }
+inline int f4014_28(int x) { return x * 28; }
+inline int f4014_29(int x) { return x * 29; }
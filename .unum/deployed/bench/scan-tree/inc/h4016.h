@@ -0,0 +1,42 @@
+#pragma once
+/* header 4016 */
+#include <vector>
+#include "h9673.h"
+#include "h5358.h"
+#include "h2205.h"
+#include "h2074.h"
+#include "h6759.h"
+#ifdef X
+#include "h1637.h"
+#endif
+struct S4016 { int a; const char *s = "x//y"; };
+inline int f4016_0(int x) { return x * 0; }
+inline int f4016_1(int x) { return x * 1; }
+inline int f4016_2(int x) { return x * 2; }
+inline int f4016_3(int x) { return x * 3; }
+inline int f4016_4(int x) { return x * 4; }
+inline int f4016_5(int x) { return x * 5; }
+inline int f4016_6(int x) { return x * 6; }
+inline int f4016_7(int x) { return x * 7; }
+inline int f4016_8(int x) { return x * 8; }
+inline int f4016_9(int x) { return x * 9; }
+inline int f4016_10(int x) { return x * 10; }
+inline int f4016_11(int x) { return x * 11; }
+inline int f4016_12(int x) { return x * 12; }
+inline int f4016_13(int x) { return x * 13; }
+inline int f4016_14(int x) { return x * 14; }
+inline int f4016_15(int x) { return x * 15; }
+inline int f4016_16(int x) { return x * 16; }
+inline int f4016_17(int x) { return x * 17; }
+inline int f4016_18(int x) { return x * 18; }
+inline int f4016_19(int x) { return x * 19; }
+inline int f4016_20(int x) { return x * 20; }
+inline int f4016_21(int x) { return x * 21; }
+inline int f4016_22(int x) { return x * 22; }
+inline int f4016_23(int x) { return x * 23; }
+inline int f4016_24(int x) { return x * 24; }
+inline int f4016_25(int x) { return x * 25; }
+inline int f4016_26(int x) { return x * 26; }
+inline int f4016_27(int x) { return x * 27; }
+inline int f4016_28(int x) { return x * 28; }
+inline int f4016_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4019 */
+#include <vector>
+#include "h1212.h"
+#include "h1788.h"
+#include "h1338.h"
+#include "h4611.h"
+#include "h2184.h"
+#ifdef X
+#include "h1121.h"
+#endif
+struct S4019 { int a; const char *s = "x//y"; };
+inline int f4019_0(int x) { return x * 0; }
+inline int f4019_1(int x) { return x * 1; }
+inline int f4019_2(int x) { return x * 2; }
+inline int f4019_3(int x) { return x * 3; }
+inline int f4019_4(int x) { return x * 4; }
+inline int f4019_5(int x) { return x * 5; }
+inline int f4019_6(int x) { return x * 6; }
+inline int f4019_7(int x) { return x * 7; }
+inline int f4019_8(int x) { return x * 8; }
+inline int f4019_9(int x) { return x * 9; }
+inline int f4019_10(int x) { return x * 10; }
+inline int f4019_11(int x) { return x * 11; }
+inline int f4019_12(int x) { return x * 12; }
+inline int f4019_13(int x) { return x * 13; }
+inline int f4019_14(int x) { return x * 14; }
+inline int f4019_15(int x) { return x * 15; }
+inline int f4019_16(int x) { return x * 16; }
+inline int f4019_17(int x) { return x * 17; }
+inline int f4019_18(int x) { return x * 18; }
+inline int f4019_19(int x) { return x * 19; }
+inline int f4019_20(int x) { return x * 20; }
+inline int f4019_21(int x) { return x * 21; }
+inline int f4019_22(int x) { return x * 22; }
+inline int f4019_23(int x) { return x * 23; }
+inline int f4019_24(int x) { return x * 24; }
+inline int f4019_25(int x) { return x * 25; }
+inline int f4019_26(int x) { return x * 26; }
+inline int f4019_27(int x) { return x * 27; }
+inline int f4019_28(int x) { return x * 28; }
+inline int f4019_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4022 */
+#include <vector>
+#include "h4852.h"
+#include "h3286.h"
+#include "h8748.h"
+#include "h2517.h"
+#include "h8692.h"
+#ifdef X
+#include "h5387.h"
+#endif
+struct S4022 { int a; const char *s = "x//y"; };
+inline int f4022_0(int x) { return x * 0; }
+inline int f4022_1(int x) { return x * 1; }
+inline int f4022_2(int x) { return x * 2; }
+inline int f4022_3(int x) { return x * 3; }
+inline int f4022_4(int x) { return x * 4; }
+inline int f4022_5(int x) { return x * 5; }
+inline int f4022_6(int x) { return x * 6; }
+inline int f4022_7(int x) { return x * 7; }
+inline int f4022_8(int x) { return x * 8; }
+inline int f4022_9(int x) { return x * 9; }
+inline int f4022_10(int x) { return x * 10; }
+inline int f4022_11(int x) { return x * 11; }
+inline int f4022_12(int x) { return x * 12; }
+inline int f4022_13(int x) { return x * 13; }
+inline int f4022_14(int x) { return x * 14; }
+inline int f4022_15(int x) { return x * 15; }
+inline int f4022_16(int x) { return x * 16; }
+inline int f4022_17(int x) { return x * 17; }
+inline int f4022_18(int x) { return x * 18; }
+inline int f4022_19(int x) { return x * 19; }
+inline int f4022_20(int x) { return x * 20; }
+inline int f4022_21(int x) { return x * 21; }
+inline int f4022_22(int x) { return x * 22; }
+inline int f4022_23(int x) { return x * 23; }
+inline int f4022_24(int x) { return x * 24; }
+inline int f4022_25(int x) { return x * 25; }
+inline int f4022_26(int x) { return x * 26; }
+inline int f4022_27(int x) { return x * 27; }
+inline int f4022_28(int x) { return x * 28; }
+inline int f4022_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4023 */
+#include <vector>
+#include "h4580.h"
+#include "h6361.h"
+#include "h8203.h"
+#include "h8166.h"
+#include "h1862.h"
+#ifdef X
+#include "h7417.h"
+#endif
+struct S4023 { int a; const char *s = "x//y"; };
+inline int f4023_0(int x) { return x * 0; }
+inline int f4023_1(int x) { return x * 1; }
+inline int f4023_2(int x) { return x * 2; }
+inline int f4023_3(int x) { return x * 3; }
+inline int f4023_4(int x) { return x * 4; }
+inline int f4023_5(int x) { return x * 5; }
+inline int f4023_6(int x) { return x * 6; }
+inline int f4023_7(int x) { return x * 7; }
+inline int f4023_8(int x) { return x * 8; }
+inline int f4023_9(int x) { return x * 9; }
+inline int f4023_10(int x) { return x * 10; }
+inline int f4023_11(int x) { return x * 11; }
+inline int f4023_12(int x) { return x * 12; }
+inline int f4023_13(int x) { return x * 13; }
+inline int f4023_14(int x) { return x * 14; }
+inline int f4023_15(int x) { return x * 15; }
+inline int f4023_16(int x) { return x * 16; }
+inline int f4023_17(int x) { return x * 17; }
+inline int f4023_18(int x) { return x * 18; }
+inline int f4023_19(int x) { return x * 19; }
+inline int f4023_20(int x) { return x * 20; }
+inline int f4023_21(int x) { return x * 21; }
+inline int f4023_22(int x) { return x * 22; }
+inline int f4023_23(int x) { return x * 23; }
+inline int f4023_24(int x) { return x * 24; }
+inline int f4023_25(int x) { return x * 25; }
+inline int f4023_26(int x) { return x * 26; }
+inline int f4023_27(int x) { return x * 27; }
+inline int f4023_28(int x) { return x * 28; }
+inline int f4023_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4025 */
+#include <vector>
+#include "h9983.h"
+#include "h9137.h"
+#include "h4176.h"
+#include "h8744.h"
+#include "h1856.h"
+#ifdef X
+#include "h9095.h"
+#endif
+struct S4025 { int a; const char *s = "x//y"; };
+inline int f4025_0(int x) { return x * 0; }
+inline int f4025_1(int x) { return x * 1; }
+inline int f4025_2(int x) { return x * 2; }
+inline int f4025_3(int x) { return x * 3; }
+inline int f4025_4(int x) { return x * 4; }
+inline int f4025_5(int x) { return x * 5; }
+inline int f4025_6(int x) { return x * 6; }
+inline int f4025_7(int x) { return x * 7; }
+inline int f4025_8(int x) { return x * 8; }
+inline int f4025_9(int x) { return x * 9; }
+inline int f4025_10(int x) { return x * 10; }
+inline int f4025_11(int x) { return x * 11; }
+inline int f4025_12(int x) { return x * 12; }
+inline int f4025_13(int x) { return x * 13; }
+inline int f4025_14(int x) { return x * 14; }
+inline int f4025_15(int x) { return x * 15; }
+inline int f4025_16(int x) { return x * 16; }
+inline int f4025_17(int x) { return x * 17; }
+inline int f4025_18(int x) { return x * 18; }
+inline int f4025_19(int x) { return x * 19; }
+inline int f4025_20(int x) { return x * 20; }
+inline int f4025_21(int x) { return x * 21; }
+inline int f4025_22(int x) { return x * 22; }
+inline int f4025_23(int x) { return x * 23; }
+inline int f4025_24(int x) { return x * 24; }
+inline int f4025_25(int x) { return x * 25; }
+inline int f4025_26(int x) { return x * 26; }
+inline int f4025_27(int x) { return x * 27; }
+inline int f4025_28(int x) { return x * 28; }
+inline int f4025_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4026 */
+#include <vector>
+#include "h2106.h"
+#include "h9839.h"
+#include "h6895.h"
+#include "h8346.h"
+#include "h508.h"
+#ifdef X
+#include "h1464.h"
+#endif
+struct S4026 { int a; const char *s = "x//y"; };
+inline int f4026_0(int x) { return x * 0; }
+inline int f4026_1(int x) { return x * 1; }
+inline int f4026_2(int x) { return x * 2; }
+inline int f4026_3(int x) { return x * 3; }
+inline int f4026_4(int x) { return x * 4; }
+inline int f4026_5(int x) { return x * 5; }
+inline int f4026_6(int x) { return x * 6; }
+inline int f4026_7(int x) { return x * 7; }
+inline int f4026_8(int x) { return x * 8; }
+inline int f4026_9(int x) { return x * 9; }
+inline int f4026_10(int x) { return x * 10; }
+inline int f4026_11(int x) { return x * 11; }
+inline int f4026_12(int x) { return x * 12; }
+inline int f4026_13(int x) { return x * 13; }
+inline int f4026_14(int x) { return x * 14; }
+inline int f4026_15(int x) { return x * 15; }
+inline int f4026_16(int x) { return x * 16; }
+inline int f4026_17(int x) { return x * 17; }
+inline int f4026_18(int x) { return x * 18; }
+inline int f4026_19(int x) { return x * 19; }
+inline int f4026_20(int x) { return x * 20; }
+inline int f4026_21(int x) { return x * 21; }
+inline int f4026_22(int x) { return x * 22; }
+inline int f4026_23(int x) { return x * 23; }
+inline int f4026_24(int x) { return x * 24; }
+inline int f4026_25(int x) { return x * 25; }
+inline int f4026_26(int x) { return x * 26; }
+inline int f4026_27(int x) { return x * 27; }
+inline int f4026_28(int x) { return x * 28; }
+inline int f4026_29(int x) { return x * 29; }
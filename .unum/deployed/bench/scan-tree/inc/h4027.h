@@ -0,0 +1,42 @@
+#pragma once
+/* header 4027 */
+#include <vector>
+#include "h1495.h"
+#include "h8300.h"
+#include "h3452.h"
+#include "h9571.h"
+#include "h1670.h"
+#ifdef X
+#include "h7314.h"
+#endif
+struct S4027 { int a; const char *s = "x//y"; };
+inline int f4027_0(int x) { return x * 0; }
+inline int f4027_1(int x) { return x * 1; }
+inline int f4027_2(int x) { return x * 2; }
+inline int f4027_3(int x) { return x * 3; }
+inline int f4027_4(int x) { return x * 4; }
+inline int f4027_5(int x) { return x * 5; }
+inline int f4027_6(int x) { return x * 6; }
+inline int f4027_7(int x) { return x * 7; }
+inline int f4027_8(int x) { return x * 8; }
+inline int f4027_9(int x) { return x * 9; }
+inline int f4027_10(int x) { return x * 10; }
+inline int f4027_11(int x) { return x * 11; }
+inline int f4027_12(int x) { return x * 12; }
+inline int f4027_13(int x) { return x * 13; }
+inline int f4027_14(int x) { return x * 14; }
+inline int f4027_15(int x) { return x * 15; }
+inline int f4027_16(int x) { return x * 16; }
+inline int f4027_17(int x) { return x * 17; }
+inline int f4027_18(int x) { return x * 18; }
+inline int f4027_19(int x) { return x * 19; }
+inline int f4027_20(int x) { return x * 20; }
+inline int f4027_21(int x) { return x * 21; }
+inline int f4027_22(int x) { return x * 22; }
+inline int f4027_23(int x) { return x * 23; }
+inline int f4027_24(int x) { return x * 24; }
+inline int f4027_25(int x) { return x * 25; }
+inline int f4027_26(int x) { return x * 26; }
+inline int f4027_27(int x) { return x * 27; }
+inline int f4027_28(int x) { return x * 28; }
+inline int f4027_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4037 */
+#include <vector>
+#include "h8737.h"
+#include "h9819.h"
+#include "h379.h"
+#include "h8027.h"
+#include "h3250.h"
+#ifdef X
+#include "h8913.h"
+#endif
+struct S4037 { int a; const char *s = "x//y"; };
+inline int f4037_0(int x) { return x * 0; }
+inline int f4037_1(int x) { return x * 1; }
+inline int f4037_2(int x) { return x * 2; }
+inline int f4037_3(int x) { return x * 3; }
+inline int f4037_4(int x) { return x * 4; }
+inline int f4037_5(int x) { return x * 5; }
+inline int f4037_6(int x) { return x * 6; }
+inline int f4037_7(int x) { return x * 7; }
+inline int f4037_8(int x) { return x * 8; }
+inline int f4037_9(int x) { return x * 9; }
+inline int f4037_10(int x) { return x * 10; }
+inline int f4037_11(int x) { return x * 11; }
+inline int f4037_12(int x) { return x * 12; }
+inline int f4037_13(int x) { return x * 13; }
+inline int f4037_14(int x) { return x * 14; }
+inline int f4037_15(int x) { return x * 15; }
+inline int f4037_16(int x) { return x * 16; }
+inline int f4037_17(int x) { return x * 17; }
+inline int f4037_18(int x) { return x * 18; }
+inline int f4037_19(int x) { return x * 19; }
+inline int f4037_20(int x) { return x * 20; }
+inline int f4037_21(int x) { return x * 21; }
+inline int f4037_22(int x) { return x * 22; }
+inline int f4037_23(int x) { return x * 23; }
+inline int f4037_24(int x) { return x * 24; }
+inline int f4037_25(int x) { return x * 25; }
+inline int f4037_26(int x) { return x * 26; }
+inline int f4037_27(int x) { return x * 27; }
+inline int f4037_28(int x) { return x * 28; }
+inline int f4037_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4039 */
+#include <vector>
+#include "h9990.h"
+#include "h350.h"
+#include "h6293.h"
+#include "h8776.h"
+#include "h1163.h"
+#ifdef X
+#include "h3633.h"
+#endif
+struct S4039 { int a; const char *s = "x//y"; };
+inline int f4039_0(int x) { return x * 0; }
+inline int f4039_1(int x) { return x * 1; }
+inline int f4039_2(int x) { return x * 2; }
+inline int f4039_3(int x) { return x * 3; }
+inline int f4039_4(int x) { return x * 4; }
+inline int f4039_5(int x) { return x * 5; }
+inline int f4039_6(int x) { return x * 6; }
+inline int f4039_7(int x) { return x * 7; }
+inline int f4039_8(int x) { return x * 8; }
+inline int f4039_9(int x) { return x * 9; }
+inline int f4039_10(int x) { return x * 10; }
+inline int f4039_11(int x) { return x * 11; }
+inline int f4039_12(int x) { return x * 12; }
+inline int f4039_13(int x) { return x * 13; }
+inline int f4039_14(int x) { return x * 14; }
+inline int f4039_15(int x) { return x * 15; }
+inline int f4039_16(int x) { return x * 16; }
+inline int f4039_17(int x) { return x * 17; }
+inline int f4039_18(int x) { return x * 18; }
+inline int f4039_19(int x) { return x * 19; }
+inline int f4039_20(int x) { return x * 20; }
+inline int f4039_21(int x) { return x * 21; }
+inline int f4039_22(int x) { return x * 22; }
+inline int f4039_23(int x) { return x * 23; }
+inline int f4039_24(int x) { return x * 24; }
+inline int f4039_25(int x) { return x * 25; }
+inline int f4039_26(int x) { return x * 26; }
+inline int f4039_27(int x) { return x * 27; }
+inline int f4039_28(int x) { return x * 28; }
+inline int f4039_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4040 */
+#include <vector>
+#include "h9612.h"
+#include "h117.h"
+#include "h1406.h"
+#include "h4893.h"
+#include "h4509.h"
+#ifdef X
+#include "h4113.h"
+#endif
+struct S4040 { int a; const char *s = "x//y"; };
+inline int f4040_0(int x) { return x * 0; }
+inline int f4040_1(int x) { return x * 1; }
+inline int f4040_2(int x) { return x * 2; }
+inline int f4040_3(int x) { return x * 3; }
+inline int f4040_4(int x) { return x * 4; }
+inline int f4040_5(int x) { return x * 5; }
+inline int f4040_6(int x) { return x * 6; }
+inline int f4040_7(int x) { return x * 7; }
+inline int f4040_8(int x) { return x * 8; }
+inline int f4040_9(int x) { return x * 9; }
+inline int f4040_10(int x) { return x * 10; }
+inline int f4040_11(int x) { return x * 11; }
+inline int f4040_12(int x) { return x * 12; }
+inline int f4040_13(int x) { return x * 13; }
+inline int f4040_14(int x) { return x * 14; }
+inline int f4040_15(int x) { return x * 15; }
+inline int f4040_16(int x) { return x * 16; }
+inline int f4040_17(int x) { return x * 17; }
+inline int f4040_18(int x) { return x * 18; }
+inline int f4040_19(int x) { return x * 19; }
+inline int f4040_20(int x) { return x * 20; }
+inline int f4040_21(int x) { return x * 21; }
+inline int f4040_22(int x) { return x * 22; }
+inline int f4040_23(int x) { return x * 23; }
+inline int f4040_24(int x) { return x * 24; }
+inline int f4040_25(int x) { return x * 25; }
+inline int f4040_26(int x) { return x * 26; }
+inline int f4040_27(int x) { return x * 27; }
+inline int f4040_28(int x) { return x * 28; }
+inline int f4040_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4041 */
+#include <vector>
+#include "h6454.h"
+#include "h9501.h"
+#include "h5056.h"
+#include "h9806.h"
+#include "h7555.h"
+#ifdef X
+#include "h4859.h"
+#endif
+struct S4041 { int a; const char *s = "x//y"; };
+inline int f4041_0(int x) { return x * 0; }
+inline int f4041_1(int x) { return x * 1; }
+inline int f4041_2(int x) { return x * 2; }
+inline int f4041_3(int x) { return x * 3; }
+inline int f4041_4(int x) { return x * 4; }
+inline int f4041_5(int x) { return x * 5; }
+inline int f4041_6(int x) { return x * 6; }
+inline int f4041_7(int x) { return x * 7; }
+inline int f4041_8(int x) { return x * 8; }
+inline int f4041_9(int x) { return x * 9; }
+inline int f4041_10(int x) { return x * 10; }
+inline int f4041_11(int x) { return x * 11; }
+inline int f4041_12(int x) { return x * 12; }
+inline int f4041_13(int x) { return x * 13; }
+inline int f4041_14(int x) { return x * 14; }
+inline int f4041_15(int x) { return x * 15; }
+inline int f4041_16(int x) { return x * 16; }
+inline int f4041_17(int x) { return x * 17; }
+inline int f4041_18(int x) { return x * 18; }
+inline int f4041_19(int x) { return x * 19; }
+inline int f4041_20(int x) { return x * 20; }
+inline int f4041_21(int x) { return x * 21; }
+inline int f4041_22(int x) { return x * 22; }
+inline int f4041_23(int x) { return x * 23; }
+inline int f4041_24(int x) { return x * 24; }
+inline int f4041_25(int x) { return x * 25; }
+inline int f4041_26(int x) { return x * 26; }
+inline int f4041_27(int x) { return x * 27; }
+inline int f4041_28(int x) { return x * 28; }
+inline int f4041_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4044 */
+#include <vector>
+#include "h1645.h"
+#include "h1549.h"
+#include "h5512.h"
+#include "h8969.h"
+#include "h2935.h"
+#ifdef X
+#include "h6535.h"
+#endif
+struct S4044 { int a; const char *s = "x//y"; };
+inline int f4044_0(int x) { return x * 0; }
+inline int f4044_1(int x) { return x * 1; }
+inline int f4044_2(int x) { return x * 2; }
+inline int f4044_3(int x) { return x * 3; }
+inline int f4044_4(int x) { return x * 4; }
+inline int f4044_5(int x) { return x * 5; }
+inline int f4044_6(int x) { return x * 6; }
+inline int f4044_7(int x) { return x * 7; }
+inline int f4044_8(int x) { return x * 8; }
+inline int f4044_9(int x) { return x * 9; }
+inline int f4044_10(int x) { return x * 10; }
+inline int f4044_11(int x) { return x * 11; }
+inline int f4044_12(int x) { return x * 12; }
+inline int f4044_13(int x) { return x * 13; }
+inline int f4044_14(int x) { return x * 14; }
+inline int f4044_15(int x) { return x * 15; }
+inline int f4044_16(int x) { return x * 16; }
+inline int f4044_17(int x) { return x * 17; }
+inline int f4044_18(int x) { return x * 18; }
+inline int f4044_19(int x) { return x * 19; }
+inline int f4044_20(int x) { return x * 20; }
+inline int f4044_21(int x) { return x * 21; }
+inline int f4044_22(int x) { return x * 22; }
+inline int f4044_23(int x) { return x * 23; }
+inline int f4044_24(int x) { return x * 24; }
+inline int f4044_25(int x) { return x * 25; }
+inline int f4044_26(int x) { return x * 26; }
+inline int f4044_27(int x) { return x * 27; }
+inline int f4044_28(int x) { return x * 28; }
+inline int f4044_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4046 */
+#include <vector>
+#include "h2157.h"
+#include "h1271.h"
+#include "h6872.h"
+#include "h441.h"
+#include "h4959.h"
+#ifdef X
+#include "h7192.h"
+#endif
+struct S4046 { int a; const char *s = "x//y"; };
+inline int f4046_0(int x) { return x * 0; }
+inline int f4046_1(int x) { return x * 1; }
+inline int f4046_2(int x) { return x * 2; }
+inline int f4046_3(int x) { return x * 3; }
+inline int f4046_4(int x) { return x * 4; }
+inline int f4046_5(int x) { return x * 5; }
+inline int f4046_6(int x) { return x * 6; }
+inline int f4046_7(int x) { return x * 7; }
+inline int f4046_8(int x) { return x * 8; }
+inline int f4046_9(int x) { return x * 9; }
+inline int f4046_10(int x) { return x * 10; }
+inline int f4046_11(int x) { return x * 11; }
+inline int f4046_12(int x) { return x * 12; }
+inline int f4046_13(int x) { return x * 13; }
+inline int f4046_14(int x) { return x * 14; }
+inline int f4046_15(int x) { return x * 15; }
+inline int f4046_16(int x) { return x * 16; }
+inline int f4046_17(int x) { return x * 17; }
+inline int f4046_18(int x) { return x * 18; }
+inline int f4046_19(int x) { return x * 19; }
+inline int f4046_20(int x) { return x * 20; }
+inline int f4046_21(int x) { return x * 21; }
+inline int f4046_22(int x) { return x * 22; }
+inline int f4046_23(int x) { return x * 23; }
+inline int f4046_24(int x) { return x * 24; }
+inline int f4046_25(int x) { return x * 25; }
+inline int f4046_26(int x) { return x * 26; }
+inline int f4046_27(int x) { return x * 27; }
+inline int f4046_28(int x) { return x * 28; }
+inline int f4046_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4047 */
+#include <vector>
+#include "h5772.h"
+#include "h219.h"
+#include "h4204.h"
+#include "h4293.h"
+#include "h262.h"
+#ifdef X
+#include "h110.h"
+#endif
+struct S4047 { int a; const char *s = "x//y"; };
+inline int f4047_0(int x) { return x * 0; }
+inline int f4047_1(int x) { return x * 1; }
+inline int f4047_2(int x) { return x * 2; }
+inline int f4047_3(int x) { return x * 3; }
+inline int f4047_4(int x) { return x * 4; }
+inline int f4047_5(int x) { return x * 5; }
+inline int f4047_6(int x) { return x * 6; }
+inline int f4047_7(int x) { return x * 7; }
+inline int f4047_8(int x) { return x * 8; }
+inline int f4047_9(int x) { return x * 9; }
+inline int f4047_10(int x) { return x * 10; }
+inline int f4047_11(int x) { return x * 11; }
+inline int f4047_12(int x) { return x * 12; }
+inline int f4047_13(int x) { return x * 13; }
+inline int f4047_14(int x) { return x * 14; }
+inline int f4047_15(int x) { return x * 15; }
+inline int f4047_16(int x) { return x * 16; }
+inline int f4047_17(int x) { return x * 17; }
+inline int f4047_18(int x) { return x * 18; }
+inline int f4047_19(int x) { return x * 19; }
+inline int f4047_20(int x) { return x * 20; }
+inline int f4047_21(int x) { return x * 21; }
+inline int f4047_22(int x) { return x * 22; }
+inline int f4047_23(int x) { return x * 23; }
+inline int f4047_24(int x) { return x * 24; }
+inline int f4047_25(int x) { return x * 25; }
+inline int f4047_26(int x) { return x * 26; }
+inline int f4047_27(int x) { return x * 27; }
+inline int f4047_28(int x) { return x * 28; }
+inline int f4047_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 405 */
+#include <vector>
+#include "h9010.h"
+#include "h900.h"
+#include "h9004.h"
+#include "h7201.h"
+#include "h7474.h"
+#ifdef X
+#include "h1675.h"
+#endif
+struct S405 { int a; const char *s = "x//y"; };
+inline int f405_0(int x) { return x * 0; }
+inline int f405_1(int x) { return x * 1; }
+inline int f405_2(int x) { return x * 2; }
+inline int f405_3(int x) { return x * 3; }
+inline int f405_4(int x) { return x * 4; }
+inline int f405_5(int x) { return x * 5; }
+inline int f405_6(int x) { return x * 6; }
+inline int f405_7(int x) { return x * 7; }
+inline int f405_8(int x) { return x * 8; }
+inline int f405_9(int x) { return x * 9; }
+inline int f405_10(int x) { return x * 10; }
+inline int f405_11(int x) { return x * 11; }
+inline int f405_12(int x) { return x * 12; }
+inline int f405_13(int x) { return x * 13; }
+inline int f405_14(int x) { return x * 14; }
+inline int f405_15(int x) { return x * 15; }
+inline int f405_16(int x) { return x * 16; }
+inline int f405_17(int x) { return x * 17; }
+inline int f405_18(int x) { return x * 18; }
+inline int f405_19(int x) { return x * 19; }
+inline int f405_20(int x) { return x * 20; }
+inline int f405_21(int x) { return x * 21; }
+inline int f405_22(int x) { return x * 22; }
+inline int f405_23(int x) { return x * 23; }
+inline int f405_24(int x) { return x * 24; }
+inline int f405_25(int x) { return x * 25; }
+inline int f405_26(int x) { return x * 26; }
+inline int f405_27(int x) { return x * 27; }
+inline int f405_28(int x) { return x * 28; }
+inline int f405_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4052 */
+#include <vector>
+#include "h2920.h"
+#include "h7373.h"
+#include "h9736.h"
+#include "h1850.h"
+#include "h5314.h"
+#ifdef X
+#include "h3795.h"
+#endif
+struct S4052 { int a; const char *s = "x//y"; };
+inline int f4052_0(int x) { return x * 0; }
+inline int f4052_1(int x) { return x * 1; }
+inline int f4052_2(int x) { return x * 2; }
+inline int f4052_3(int x) { return x * 3; }
+inline int f4052_4(int x) { return x * 4; }
+inline int f4052_5(int x) { return x * 5; }
+inline int f4052_6(int x) { return x * 6; }
+inline int f4052_7(int x) { return x * 7; }
+inline int f4052_8(int x) { return x * 8; }
+inline int f4052_9(int x) { return x * 9; }
+inline int f4052_10(int x) { return x * 10; }
+inline int f4052_11(int x) { return x * 11; }
+inline int f4052_12(int x) { return x * 12; }
+inline int f4052_13(int x) { return x * 13; }
+inline int f4052_14(int x) { return x * 14; }
+inline int f4052_15(int x) { return x * 15; }
+inline int f4052_16(int x) { return x * 16; }
+inline int f4052_17(int x) { return x * 17; }
+inline int f4052_18(int x) { return x * 18; }
+inline int f4052_19(int x) { return x * 19; }
+inline int f4052_20(int x) { return x * 20; }
+inline int f4052_21(int x) { return x * 21; }
+inline int f4052_22(int x) { return x * 22; }
+inline int f4052_23(int x) { return x * 23; }
+inline int f4052_24(int x) { return x * 24; }
+inline int f4052_25(int x) { return x * 25; }
+inline int f4052_26(int x) { return x * 26; }
+inline int f4052_27(int x) { return x * 27; }
+inline int f4052_28(int x) { return x * 28; }
+inline int f4052_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4054 */
+#include <vector>
+#include "h9692.h"
+#include "h7777.h"
+#include "h4626.h"
+#include "h3911.h"
+#include "h9152.h"
+#ifdef X
+#include "h9225.h"
+#endif
+struct S4054 { int a; const char *s = "x//y"; };
+inline int f4054_0(int x) { return x * 0; }
+inline int f4054_1(int x) { return x * 1; }
+inline int f4054_2(int x) { return x * 2; }
+inline int f4054_3(int x) { return x * 3; }
+inline int f4054_4(int x) { return x * 4; }
+inline int f4054_5(int x) { return x * 5; }
+inline int f4054_6(int x) { return x * 6; }
+inline int f4054_7(int x) { return x * 7; }
+inline int f4054_8(int x) { return x * 8; }
+inline int f4054_9(int x) { return x * 9; }
+inline int f4054_10(int x) { return x * 10; }
+inline int f4054_11(int x) { return x * 11; }
+inline int f4054_12(int x) { return x * 12; }
+inline int f4054_13(int x) { return x * 13; }
+inline int f4054_14(int x) { return x * 14; }
+inline int f4054_15(int x) { return x * 15; }
+inline int f4054_16(int x) { return x * 16; }
+inline int f4054_17(int x) { return x * 17; }
+inline int f4054_18(int x) { return x * 18; }
+inline int f4054_19(int x) { return x * 19; }
+inline int f4054_20(int x) { return x * 20; }
+inline int f4054_21(int x) { return x * 21; }
+inline int f4054_22(int x) { return x * 22; }
+inline int f4054_23(int x) { return x * 23; }
+inline int f4054_24(int x) { return x * 24; }
+inline int f4054_25(int x) { return x * 25; }
+inline int f4054_26(int x) { return x * 26; }
+inline int f4054_27(int x) { return x * 27; }
+inline int f4054_28(int x) { return x * 28; }
+inline int f4054_29(int x) { return x * 29; }
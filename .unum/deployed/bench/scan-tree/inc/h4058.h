@@ -0,0 +1,42 @@
+#pragma once
+/* header 4058 */
+#include <vector>
+#include "h8322.h"
+#include "h391.h"
+#include "h2180.h"
+#include "h5903.h"
+#include "h8742.h"
+#ifdef X
+#include "h5219.h"
+#endif
+struct S4058 { int a; const char *s = "x//y"; };
+inline int f4058_0(int x) { return x * 0; }
+inline int f4058_1(int x) { return x * 1; }
+inline int f4058_2(int x) { return x * 2; }
+inline int f4058_3(int x) { return x * 3; }
+inline int f4058_4(int x) { return x * 4; }
+inline int f4058_5(int x) { return x * 5; }
+inline int f4058_6(int x) { return x * 6; }
+inline int f4058_7(int x) { return x * 7; }
+inline int f4058_8(int x) { return x * 8; }
+inline int f4058_9(int x) { return x * 9; }
+inline int f4058_10(int x) { return x * 10; }
+inline int f4058_11(int x) { return x * 11; }
+inline int f4058_12(int x) { return x * 12; }
+inline int f4058_13(int x) { return x * 13; }
+inline int f4058_14(int x) { return x * 14; }
+inline int f4058_15(int x) { return x * 15; }
+inline int f4058_16(int x) { return x * 16; }
+inline int f4058_17(int x) { return x * 17; }
+inline int f4058_18(int x) { return x * 18; }
+inline int f4058_19(int x) { return x * 19; }
+inline int f4058_20(int x) { return x * 20; }
+inline int f4058_21(int x) { return x * 21; }
+inline int f4058_22(int x) { return x * 22; }
+inline int f4058_23(int x) { return x * 23; }
+inline int f4058_24(int x) { return x * 24; }
+inline int f4058_25(int x) { return x * 25; }
+inline int f4058_26(int x) { return x * 26; }
+inline int f4058_27(int x) { return x * 27; }
+inline int f4058_28(int x) { return x * 28; }
+inline int f4058_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4060 */
+#include <vector>
+#include "h8904.h"
+#include "h3716.h"
+#include "h6934.h"
+#include "h2276.h"
+#include "h8674.h"
+#ifdef X
+#include "h9704.h"
+#endif
+struct S4060 { int a; const char *s = "x//y"; };
+inline int f4060_0(int x) { return x * 0; }
+inline int f4060_1(int x) { return x * 1; }
+inline int f4060_2(int x) { return x * 2; }
+inline int f4060_3(int x) { return x * 3; }
+inline int f4060_4(int x) { return x * 4; }
+inline int f4060_5(int x) { return x * 5; }
+inline int f4060_6(int x) { return x * 6; }
+inline int f4060_7(int x) { return x * 7; }
+inline int f4060_8(int x) { return x * 8; }
+inline int f4060_9(int x) { return x * 9; }
+inline int f4060_10(int x) { return x * 10; }
+inline int f4060_11(int x) { return x * 11; }
+inline int f4060_12(int x) { return x * 12; }
+inline int f4060_13(int x) { return x * 13; }
+inline int f4060_14(int x) { return x * 14; }
+inline int f4060_15(int x) { return x * 15; }
+inline int f4060_16(int x) { return x * 16; }
+inline int f4060_17(int x) { return x * 17; }
+inline int f4060_18(int x) { return x * 18; }
+inline int f4060_19(int x) { return x * 19; }
+inline int f4060_20(int x) { return x * 20; }
+inline int f4060_21(int x) { return x * 21; }
+inline int f4060_22(int x) { return x * 22; }
+inline int f4060_23(int x) { return x * 23; }
+inline int f4060_24(int x) { return x * 24; }
+inline int f4060_25(int x) { return x * 25; }
+inline int f4060_26(int x) { return x * 26; }
+inline int f4060_27(int x) { return x * 27; }
+inline int f4060_28(int x) { return x * 28; }
+inline int f4060_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4061 */
+#include <vector>
+#include "h2625.h"
+#include "h2092.h"
+#include "h2389.h"
+#include "h1122.h"
+#include "h6205.h"
+#ifdef X
+#include "h8046.h"
+#endif
+struct S4061 { int a; const char *s = "x//y"; };
+inline int f4061_0(int x) { return x * 0; }
+inline int f4061_1(int x) { return x * 1; }
+inline int f4061_2(int x) { return x * 2; }
+inline int f4061_3(int x) { return x * 3; }
+inline int f4061_4(int x) { return x * 4; }
+inline int f4061_5(int x) { return x * 5; }
+inline int f4061_6(int x) { return x * 6; }
+inline int f4061_7(int x) { return x * 7; }
+inline int f4061_8(int x) { return x * 8; }
+inline int f4061_9(int x) { return x * 9; }
+inline int f4061_10(int x) { return x * 10; }
+inline int f4061_11(int x) { return x * 11; }
+inline int f4061_12(int x) { return x * 12; }
+inline int f4061_13(int x) { return x * 13; }
+inline int f4061_14(int x) { return x * 14; }
+inline int f4061_15(int x) { return x * 15; }
+inline int f4061_16(int x) { return x * 16; }
+inline int f4061_17(int x) { return x * 17; }
+inline int f4061_18(int x) { return x * 18; }
+inline int f4061_19(int x) { return x * 19; }
+inline int f4061_20(int x) { return x * 20; }
+inline int f4061_21(int x) { return x * 21; }
+inline int f4061_22(int x) { return x * 22; }
+inline int f4061_23(int x) { return x * 23; }
+inline int f4061_24(int x) { return x * 24; }
+inline int f4061_25(int x) { return x * 25; }
+inline int f4061_26(int x) { return x * 26; }
+inline int f4061_27(int x) { return x * 27; }
+inline int f4061_28(int x) { return x * 28; }
+inline int f4061_29(int x) { return x * 29; }
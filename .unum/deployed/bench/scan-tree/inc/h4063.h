@@ -0,0 +1,42 @@
+#pragma once
+/* header 4063 */
+#include <vector>
+#include "h6592.h"
+#include "h1647.h"
+#include "h7032.h"
+#include "h8352.h"
+#include "h4878.h"
+#ifdef X
+#include "h6677.h"
+#endif
+struct S4063 { int a; const char *s = "x//y"; };
+inline int f4063_0(int x) { return x * 0; }
+inline int f4063_1(int x) { return x * 1; }
+inline int f4063_2(int x) { return x * 2; }
+inline int f4063_3(int x) { return x * 3; }
+inline int f4063_4(int x) { return x * 4; }
+inline int f4063_5(int x) { return x * 5; }
+inline int f4063_6(int x) { return x * 6; }
+inline int f4063_7(int x) { return x * 7; }
+inline int f4063_8(int x) { return x * 8; }
+inline int f4063_9(int x) { return x * 9; }
+inline int f4063_10(int x) { return x * 10; }
+inline int f4063_11(int x) { return x * 11; }
+inline int f4063_12(int x) { return x * 12; }
+inline int f4063_13(int x) { return x * 13; }
+inline int f4063_14(int x) { return x * 14; }
+inline int f4063_15(int x) { return x * 15; }
+inline int f4063_16(int x) { return x * 16; }
+inline int f4063_17(int x) { return x * 17; }
+inline int f4063_18(int x) { return x * 18; }
+inline int f4063_19(int x) { return x * 19; }
+inline int f4063_20(int x) { return x * 20; }
+inline int f4063_21(int x) { return x * 21; }
+inline int f4063_22(int x) { return x * 22; }
+inline int f4063_23(int x) { return x * 23; }
+inline int f4063_24(int x) { return x * 24; }
+inline int f4063_25(int x) { return x * 25; }
+inline int f4063_26(int x) { return x * 26; }
+inline int f4063_27(int x) { return x * 27; }
+inline int f4063_28(int x) { return x * 28; }
+inline int f4063_29(int x) { return x * 29; }
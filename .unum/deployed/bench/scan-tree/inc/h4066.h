@@ -0,0 +1,42 @@
+#pragma once
+/* header 4066 */
+#include <vector>
+#include "h9795.h"
+#include "h6396.h"
+#include "h5063.h"
+#include "h4671.h"
+#include "h4553.h"
+#ifdef X
+#include "h5491.h"
+#endif
+struct S4066 { int a; const char *s = "x//y"; };
+inline int f4066_0(int x) { return x * 0; }
+inline int f4066_1(int x) { return x * 1; }
+inline int f4066_2(int x) { return x * 2; }
+inline int f4066_3(int x) { return x * 3; }
+inline int f4066_4(int x) { return x * 4; }
+inline int f4066_5(int x) { return x * 5; }
+inline int f4066_6(int x) { return x * 6; }
+inline int f4066_7(int x) { return x * 7; }
+inline int f4066_8(int x) { return x * 8; }
+inline int f4066_9(int x) { return x * 9; }
+inline int f4066_10(int x) { return x * 10; }
+inline int f4066_11(int x) { return x * 11; }
+inline int f4066_12(int x) { return x * 12; }
+inline int f4066_13(int x) { return x * 13; }
+inline int f4066_14(int x) { return x * 14; }
+inline int f4066_15(int x) { return x * 15; }
+inline int f4066_16(int x) { return x * 16; }
+inline int f4066_17(int x) { return x * 17; }
+inline int f4066_18(int x) { return x * 18; }
+inline int f4066_19(int x) { return x * 19; }
+inline int f4066_20(int x) { return x * 20; }
+inline int f4066_21(int x) { return x * 21; }
+inline int f4066_22(int x) { return x * 22; }
+inline int f4066_23(int x) { return x * 23; }
+inline int f4066_24(int x) { return x * 24; }
+inline int f4066_25(int x) { return x * 25; }
+inline int f4066_26(int x) { return x * 26; }
+inline int f4066_27(int x) { return x * 27; }
+inline int f4066_28(int x) { return x * 28; }
+inline int f4066_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4068 */
+#include <vector>
+#include "h6330.h"
+#include "h472.h"
+#include "h1217.h"
+#include "h5871.h"
+#include "h7701.h"
+#ifdef X
+#include "h293.h"
+#endif
+struct S4068 { int a; const char *s = "x//y"; };
+inline int f4068_0(int x) { return x * 0; }
+inline int f4068_1(int x) { return x * 1; }
+inline int f4068_2(int x) { return x * 2; }
+inline int f4068_3(int x) { return x * 3; }
+inline int f4068_4(int x) { return x * 4; }
+inline int f4068_5(int x) { return x * 5; }
+inline int f4068_6(int x) { return x * 6; }
+inline int f4068_7(int x) { return x * 7; }
+inline int f4068_8(int x) { return x * 8; }
+inline int f4068_9(int x) { return x * 9; }
+inline int f4068_10(int x) { return x * 10; }
+inline int f4068_11(int x) { return x * 11; }
+inline int f4068_12(int x) { return x * 12; }
+inline int f4068_13(int x) { return x * 13; }
+inline int f4068_14(int x) { return x * 14; }
+inline int f4068_15(int x) { return x * 15; }
+inline int f4068_16(int x) { return x * 16; }
+inline int f4068_17(int x) { return x * 17; }
+inline int f4068_18(int x) { return x * 18; }
+inline int f4068_19(int x) { return x * 19; }
+inline int f4068_20(int x) { return x * 20; }
+inline int f4068_21(int x) { return x * 21; }
+inline int f4068_22(int x) { return x * 22; }
+inline int f4068_23(int x) { return x * 23; }
+inline int f4068_24(int x) { return x * 24; }
+inline int f4068_25(int x) { return x * 25; }
+inline int f4068_26(int x) { return x * 26; }
+inline int f4068_27(int x) { return x * 27; }
+inline int f4068_28(int x) { return x * 28; }
+inline int f4068_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4069 */
+#include <vector>
+#include "h1536.h"
+#include "h5287.h"
+#include "h1975.h"
+#include "h3609.h"
+#include "h3537.h"
+#ifdef X
+#include "h6512.h"
+#endif
+struct S4069 { int a; const char *s = "x//y"; };
+inline int f4069_0(int x) { return x * 0; }
+inline int f4069_1(int x) { return x * 1; }
+inline int f4069_2(int x) { return x * 2; }
+inline int f4069_3(int x) { return x * 3; }
+inline int f4069_4(int x) { return x * 4; }
+inline int f4069_5(int x) { return x * 5; }
+inline int f4069_6(int x) { return x * 6; }
+inline int f4069_7(int x) { return x * 7; }
+inline int f4069_8(int x) { return x * 8; }
+inline int f4069_9(int x) { return x * 9; }
+inline int f4069_10(int x) { return x * 10; }
+inline int f4069_11(int x) { return x * 11; }
+inline int f4069_12(int x) { return x * 12; }
+inline int f4069_13(int x) { return x * 13; }
+inline int f4069_14(int x) { return x * 14; }
+inline int f4069_15(int x) { return x * 15; }
+inline int f4069_16(int x) { return x * 16; }
+inline int f4069_17(int x) { return x * 17; }
+inline int f4069_18(int x) { return x * 18; }
+inline int f4069_19(int x) { return x * 19; }
+inline int f4069_20(int x) { return x * 20; }
+inline int f4069_21(int x) { return x * 21; }
+inline int f4069_22(int x) { return x * 22; }
+inline int f4069_23(int x) { return x * 23; }
+inline int f4069_24(int x) { return x * 24; }
+inline int f4069_25(int x) { return x * 25; }
+inline int f4069_26(int x) { return x * 26; }
+inline int f4069_27(int x) { return x * 27; }
+inline int f4069_28(int x) { return x * 28; }
+inline int f4069_29(int x) { return x * 29; }
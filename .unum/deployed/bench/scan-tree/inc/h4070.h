@@ -0,0 +1,42 @@
+#pragma once
+/* header 4070 */
+#include <vector>
+#include "h2912.h"
+#include "h6632.h"
+#include "h828.h"
+#include "h1440.h"
+#include "h6668.h"
+#ifdef X
+#include "h3039.h"
+#endif
+struct S4070 { int a; const char *s = "x//y"; };
+inline int f4070_0(int x) { return x * 0; }
+inline int f4070_1(int x) { return x * 1; }
+inline int f4070_2(int x) { return x * 2; }
+inline int f4070_3(int x) { return x * 3; }
+inline int f4070_4(int x) { return x * 4; }
+inline int f4070_5(int x) { return x * 5; }
+inline int f4070_6(int x) { return x * 6; }
+inline int f4070_7(int x) { return x * 7; }
+inline int f4070_8(int x) { return x * 8; }
+inline int f4070_9(int x) { return x * 9; }
+inline int f4070_10(int x) { return x * 10; }
+inline int f4070_11(int x) { return x * 11; }
+inline int f4070_12(int x) { return x * 12; }
+inline int f4070_13(int x) { return x * 13; }
+inline int f4070_14(int x) { return x * 14; }
+inline int f4070_15(int x) { return x * 15; }
+inline int f4070_16(int x) { return x * 16; }
+inline int f4070_17(int x) { return x * 17; }
+inline int f4070_18(int x) { return x * 18; }
+inline int f4070_19(int x) { return x * 19; }
+inline int f4070_20(int x) { return x * 20; }
+inline int f4070_21(int x) { return x * 21; }
+inline int f4070_22(int x) { return x * 22; }
+inline int f4070_23(int x) { return x * 23; }
+inline int f4070_24(int x) { return x * 24; }
+inline int f4070_25(int x) { return x * 25; }
+inline int f4070_26(int x) { return x * 26; }
+inline int f4070_27(int x) { return x * 27; }
+inline int f4070_28(int x) { return x * 28; }
+inline int f4070_29(int x) { return x * 29; }
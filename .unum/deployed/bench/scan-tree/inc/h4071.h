@@ -0,0 +1,42 @@
+#pragma once
+/* header 4071 */
+#include <vector>
+#include "h9416.h"
+#include "h1996.h"
+#include "h6842.h"
+#include "h3818.h"
+#include "h4183.h"
+#ifdef X
+#include "h1206.h"
+#endif
+struct S4071 { int a; const char *s = "x//y"; };
+inline int f4071_0(int x) { return x * 0; }
+inline int f4071_1(int x) { return x * 1; }
+inline int f4071_2(int x) { return x * 2; }
+inline int f4071_3(int x) { return x * 3; }
+inline int f4071_4(int x) { return x * 4; }
+inline int f4071_5(int x) { return x * 5; }
+inline int f4071_6(int x) { return x * 6; }
+inline int f4071_7(int x) { return x * 7; }
+inline int f4071_8(int x) { return x * 8; }
+inline int f4071_9(int x) { return x * 9; }
+inline int f4071_10(int x) { return x * 10; }
+inline int f4071_11(int x) { return x * 11; }
+inline int f4071_12(int x) { return x * 12; }
+inline int f4071_13(int x) { return x * 13; }
+inline int f4071_14(int x) { return x * 14; }
+inline int f4071_15(int x) { return x * 15; }
+inline int f4071_16(int x) { return x * 16; }
+inline int f4071_17(int x) { return x * 17; }
+inline int f4071_18(int x) { return x * 18; }
+inline int f4071_19(int x) { return x * 19; }
+inline int f4071_20(int x) { return x * 20; }
+inline int f4071_21(int x) { return x * 21; }
+inline int f4071_22(int x) { return x * 22; }
+inline int f4071_23(int x) { return x * 23; }
+inline int f4071_24(int x) { return x * 24; }
+inline int f4071_25(int x) { return x * 25; }
+inline int f4071_26(int x) { return x * 26; }
+inline int f4071_27(int x) { return x * 27; }
+inline int f4071_28(int x) { return x * 28; }
+inline int f4071_29(int x) { return x * 29; }
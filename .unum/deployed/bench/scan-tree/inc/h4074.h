@@ -0,0 +1,42 @@
+#pragma once
+/* header 4074 */
+#include <vector>
+#include "h2145.h"
+#include "h3034.h"
+#include "h1954.h"
+#include "h9843.h"
+#include "h718.h"
+#ifdef X
+#include "h7389.h"
+#endif
+struct S4074 { int a; const char *s = "x//y"; };
+inline int f4074_0(int x) { return x * 0; }
+inline int f4074_1(int x) { return x * 1; }
+inline int f4074_2(int x) { return x * 2; }
+inline int f4074_3(int x) { return x * 3; }
+inline int f4074_4(int x) { return x * 4; }
+inline int f4074_5(int x) { return x * 5; }
+inline int f4074_6(int x) { return x * 6; }
+inline int f4074_7(int x) { return x * 7; }
+inline int f4074_8(int x) { return x * 8; }
+inline int f4074_9(int x) { return x * 9; }
+inline int f4074_10(int x) { return x * 10; }
+inline int f4074_11(int x) { return x * 11; }
+inline int f4074_12(int x) { return x * 12; }
+inline int f4074_13(int x) { return x * 13; }
+inline int f4074_14(int x) { return x * 14; }
+inline int f4074_15(int x) { return x * 15; }
+inline int f4074_16(int x) { return x * 16; }
+inline int f4074_17(int x) { return x * 17; }
+inline int f4074_18(int x) { return x * 18; }
+inline int f4074_19(int x) { return x * 19; }
+inline int f4074_20(int x) { return x * 20; }
+inline int f4074_21(int x) { return x * 21; }
+inline int f4074_22(int x) { return x * 22; }
+inline int f4074_23(int x) { return x * 23; }
+inline int f4074_24(int x) { return x * 24; }
+inline int f4074_25(int x) { return x * 25; }
+inline int f4074_26(int x) { return x * 26; }
+inline int f4074_27(int x) { return x * 27; }
+inline int f4074_28(int x) { return x * 28; }
+inline int f4074_29(int x) { return x * 29; }
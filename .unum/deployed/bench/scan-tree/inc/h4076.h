@@ -0,0 +1,42 @@
+#pragma once
+/* header 4076 */
+#include <vector>
+#include "h7017.h"
+#include "h7556.h"
+#include "h9092.h"
+#include "h8293.h"
+#include "h9432.h"
+#ifdef X
+#include "h6940.h"
+#endif
+struct S4076 { int a; const char *s = "x//y"; };
+inline int f4076_0(int x) { return x * 0; }
+inline int f4076_1(int x) { return x * 1; }
+inline int f4076_2(int x) { return x * 2; }
+inline int f4076_3(int x) { return x * 3; }
+inline int f4076_4(int x) { return x * 4; }
+inline int f4076_5(int x) { return x * 5; }
+inline int f4076_6(int x) { return x * 6; }
+inline int f4076_7(int x) { return x * 7; }
+inline int f4076_8(int x) { return x * 8; }
+inline int f4076_9(int x) { return x * 9; }
+inline int f4076_10(int x) { return x * 10; }
+inline int f4076_11(int x) { return x * 11; }
+inline int f4076_12(int x) { return x * 12; }
+inline int f4076_13(int x) { return x * 13; }
+inline int f4076_14(int x) { return x * 14; }
+inline int f4076_15(int x) { return x * 15; }
+inline int f4076_16(int x) { return x * 16; }
+inline int f4076_17(int x) { return x * 17; }
+inline int f4076_18(int x) { return x * 18; }
+inline int f4076_19(int x) { return x * 19; }
+inline int f4076_20(int x) { return x * 20; }
+inline int f4076_21(int x) { return x * 21; }
+inline int f4076_22(int x) { return x * 22; }
+inline int f4076_23(int x) { return x * 23; }
+inline int f4076_24(int x) { return x * 24; }
+inline int f4076_25(int x) { return x * 25; }
+inline int f4076_26(int x) { return x * 26; }
+inline int f4076_27(int x) { return x * 27; }
+inline int f4076_28(int x) { return x * 28; }
+inline int f4076_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4077 */
+#include <vector>
+#include "h1043.h"
+#include "h3692.h"
+#include "h7872.h"
+#include "h3992.h"
+#include "h5328.h"
+#ifdef X
+#include "h1764.h"
+#endif
+struct S4077 { int a; const char *s = "x//y"; };
+inline int f4077_0(int x) { return x * 0; }
+inline int f4077_1(int x) { return x * 1; }
+inline int f4077_2(int x) { return x * 2; }
+inline int f4077_3(int x) { return x * 3; }
+inline int f4077_4(int x) { return x * 4; }
+inline int f4077_5(int x) { return x * 5; }
+inline int f4077_6(int x) { return x * 6; }
+inline int f4077_7(int x) { return x * 7; }
+inline int f4077_8(int x) { return x * 8; }
+inline int f4077_9(int x) { return x * 9; }
+inline int f4077_10(int x) { return x * 10; }
+inline int f4077_11(int x) { return x * 11; }
+inline int f4077_12(int x) { return x * 12; }
+inline int f4077_13(int x) { return x * 13; }
+inline int f4077_14(int x) { return x * 14; }
+inline int f4077_15(int x) { return x * 15; }
+inline int f4077_16(int x) { return x * 16; }
+inline int f4077_17(int x) { return x * 17; }
+inline int f4077_18(int x) { return x * 18; }
+inline int f4077_19(int x) { return x * 19; }
+inline int f4077_20(int x) { return x * 20; }
+inline int f4077_21(int x) { return x * 21; }
+inline int f4077_22(int x) { return x * 22; }
+inline int f4077_23(int x) { return x * 23; }
+inline int f4077_24(int x) { return x * 24; }
+inline int f4077_25(int x) { return x * 25; }
+inline int f4077_26(int x) { return x * 26; }
+inline int f4077_27(int x) { return x * 27; }
+inline int f4077_28(int x) { return x * 28; }
+inline int f4077_29(int x) { return x * 29; }
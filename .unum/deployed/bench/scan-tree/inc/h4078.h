@@ -0,0 +1,42 @@
+#pragma once
+/* header 4078 */
+#include <vector>
+#include "h2511.h"
+#include "h5562.h"
+#include "h8475.h"
+#include "h2439.h"
+#include "h4328.h"
+#ifdef X
+#include "h9547.h"
+#endif
+struct S4078 { int a; const char *s = "x//y"; };
+inline int f4078_0(int x) { return x * 0; }
+inline int f4078_1(int x) { return x * 1; }
+inline int f4078_2(int x) { return x * 2; }
+inline int f4078_3(int x) { return x * 3; }
+inline int f4078_4(int x) { return x * 4; }
+inline int f4078_5(int x) { return x * 5; }
+inline int f4078_6(int x) { return x * 6; }
+inline int f4078_7(int x) { return x * 7; }
+inline int f4078_8(int x) { return x * 8; }
+inline int f4078_9(int x) { return x * 9; }
+inline int f4078_10(int x) { return x * 10; }
+inline int f4078_11(int x) { return x * 11; }
+inline int f4078_12(int x) { return x * 12; }
+inline int f4078_13(int x) { return x * 13; }
+inline int f4078_14(int x) { return x * 14; }
+inline int f4078_15(int x) { return x * 15; }
+inline int f4078_16(int x) { return x * 16; }
+inline int f4078_17(int x) { return x * 17; }
+inline int f4078_18(int x) { return x * 18; }
+inline int f4078_19(int x) { return x * 19; }
+inline int f4078_20(int x) { return x * 20; }
+inline int f4078_21(int x) { return x * 21; }
+inline int f4078_22(int x) { return x * 22; }
+inline int f4078_23(int x) { return x * 23; }
+inline int f4078_24(int x) { return x * 24; }
+inline int f4078_25(int x) { return x * 25; }
+inline int f4078_26(int x) { return x * 26; }
+inline int f4078_27(int x) { return x * 27; }
+inline int f4078_28(int x) { return x * 28; }
+inline int f4078_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4079 */
+#include <vector>
+#include "h4470.h"
+#include "h6907.h"
+#include "h8195.h"
+#include "h3486.h"
+#include "h3153.h"
+#ifdef X
+#include "h9436.h"
+#endif
+struct S4079 { int a; const char *s = "x//y"; };
+inline int f4079_0(int x) { return x * 0; }
+inline int f4079_1(int x) { return x * 1; }
+inline int f4079_2(int x) { return x * 2; }
+inline int f4079_3(int x) { return x * 3; }
+inline int f4079_4(int x) { return x * 4; }
+inline int f4079_5(int x) { return x * 5; }
+inline int f4079_6(int x) { return x * 6; }
+inline int f4079_7(int x) { return x * 7; }
+inline int f4079_8(int x) { return x * 8; }
+inline int f4079_9(int x) { return x * 9; }
+inline int f4079_10(int x) { return x * 10; }
+inline int f4079_11(int x) { return x * 11; }
+inline int f4079_12(int x) { return x * 12; }
+inline int f4079_13(int x) { return x * 13; }
+inline int f4079_14(int x) { return x * 14; }
+inline int f4079_15(int x) { return x * 15; }
+inline int f4079_16(int x) { return x * 16; }
+inline int f4079_17(int x) { return x * 17; }
+inline int f4079_18(int x) { return x * 18; }
+inline int f4079_19(int x) { return x * 19; }
+inline int f4079_20(int x) { return x * 20; }
+inline int f4079_21(int x) { return x * 21; }
+inline int f4079_22(int x) { return x * 22; }
+inline int f4079_23(int x) { return x * 23; }
+inline int f4079_24(int x) { return x * 24; }
+inline int f4079_25(int x) { return x * 25; }
+inline int f4079_26(int x) { return x * 26; }
+inline int f4079_27(int x) { return x * 27; }
+inline int f4079_28(int x) { return x * 28; }
+inline int f4079_29(int x) { return x * 29; }
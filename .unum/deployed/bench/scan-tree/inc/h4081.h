@@ -0,0 +1,42 @@
+#pragma once
+/* header 4081 */
+#include <vector>
+#include "h9172.h"
+#include "h4536.h"
+#include "h8879.h"
+#include "h1225.h"
+#include "h1577.h"
+#ifdef X
+#include "h6765.h"
+#endif
+struct S4081 { int a; const char *s = "x//y"; };
+inline int f4081_0(int x) { return x * 0; }
+inline int f4081_1(int x) { return x * 1; }
+inline int f4081_2(int x) { return x * 2; }
+inline int f4081_3(int x) { return x * 3; }
+inline int f4081_4(int x) { return x * 4; }
+inline int f4081_5(int x) { return x * 5; }
+inline int f4081_6(int x) { return x * 6; }
+inline int f4081_7(int x) { return x * 7; }
+inline int f4081_8(int x) { return x * 8; }
+inline int f4081_9(int x) { return x * 9; }
+inline int f4081_10(int x) { return x * 10; }
+inline int f4081_11(int x) { return x * 11; }
+inline int f4081_12(int x) { return x * 12; }
+inline int f4081_13(int x) { return x * 13; }
+inline int f4081_14(int x) { return x * 14; }
+inline int f4081_15(int x) { return x * 15; }
+inline int f4081_16(int x) { return x * 16; }
+inline int f4081_17(int x) { return x * 17; }
+inline int f4081_18(int x) { return x * 18; }
+inline int f4081_19(int x) { return x * 19; }
+inline int f4081_20(int x) { return x * 20; }
+inline int f4081_21(int x) { return x * 21; }
+inline int f4081_22(int x) { return x * 22; }
+inline int f4081_23(int x) { return x * 23; }
+inline int f4081_24(int x) { return x * 24; }
+inline int f4081_25(int x) { return x * 25; }
+inline int f4081_26(int x) { return x * 26; }
+inline int f4081_27(int x) { return x * 27; }
+inline int f4081_28(int x) { return x * 28; }
+inline int f4081_29(int x) { return x * 29; }
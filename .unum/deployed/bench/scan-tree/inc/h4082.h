@@ -0,0 +1,42 @@
+#pragma once
+/* header 4082 */
+#include <vector>
+#include "h4181.h"
+#include "h341.h"
+#include "h2245.h"
+#include "h5273.h"
+#include "h6486.h"
+#ifdef X
+#include "h7568.h"
+#endif
+struct S4082 { int a; const char *s = "x//y"; };
+inline int f4082_0(int x) { return x * 0; }
+inline int f4082_1(int x) { return x * 1; }
+inline int f4082_2(int x) { return x * 2; }
+inline int f4082_3(int x) { return x * 3; }
+inline int f4082_4(int x) { return x * 4; }
+inline int f4082_5(int x) { return x * 5; }
+inline int f4082_6(int x) { return x * 6; }
+inline int f4082_7(int x) { return x * 7; }
+inline int f4082_8(int x) { return x * 8; }
+inline int f4082_9(int x) { return x * 9; }
+inline int f4082_10(int x) { return x * 10; }
+inline int f4082_11(int x) { return x * 11; }
+inline int f4082_12(int x) { return x * 12; }
+inline int f4082_13(int x) { return x * 13; }
+inline int f4082_14(int x) { return x * 14; }
+inline int f4082_15(int x) { return x * 15; }
+inline int f4082_16(int x) { return x * 16; }
+inline int f4082_17(int x) { return x * 17; }
+inline int f4082_18(int x) { return x * 18; }
+inline int f4082_19(int x) { return x * 19; }
+inline int f4082_20(int x) { return x * 20; }
+inline int f4082_21(int x) { return x * 21; }
+inline int f4082_22(int x) { return x * 22; }
+inline int f4082_23(int x) { return x * 23; }
+inline int f4082_24(int x) { return x * 24; }
+inline int f4082_25(int x) { return x * 25; }
+inline int f4082_26(int x) { return x * 26; }
+inline int f4082_27(int x) { return x * 27; }
+inline int f4082_28(int x) { return x * 28; }
+inline int f4082_29(int x) { return x * 29; }
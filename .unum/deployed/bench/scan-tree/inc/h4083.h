@@ -0,0 +1,42 @@
+#pragma once
+/* header 4083 */
+#include <vector>
+#include "h8487.h"
+#include "h3276.h"
+#include "h1901.h"
+#include "h2241.h"
+#include "h7941.h"
+#ifdef X
+#include "h3051.h"
+#endif
+struct S4083 { int a; const char *s = "x//y"; };
+inline int f4083_0(int x) { return x * 0; }
+inline int f4083_1(int x) { return x * 1; }
+inline int f4083_2(int x) { return x * 2; }
+inline int f4083_3(int x) { return x * 3; }
+inline int f4083_4(int x) { return x * 4; }
+inline int f4083_5(int x) { return x * 5; }
+inline int f4083_6(int x) { return x * 6; }
+inline int f4083_7(int x) { return x * 7; }
+inline int f4083_8(int x) { return x * 8; }
+inline int f4083_9(int x) { return x * 9; }
+inline int f4083_10(int x) { return x * 10; }
+inline int f4083_11(int x) { return x * 11; }
+inline int f4083_12(int x) { return x * 12; }
+inline int f4083_13(int x) { return x * 13; }
+inline int f4083_14(int x) { return x * 14; }
+inline int f4083_15(int x) { return x * 15; }
+inline int f4083_16(int x) { return x * 16; }
+inline int f4083_17(int x) { return x * 17; }
+inline int f4083_18(int x) { return x * 18; }
+inline int f4083_19(int x) { return x * 19; }
+inline int f4083_20(int x) { return x * 20; }
+inline int f4083_21(int x) { return x * 21; }
+inline int f4083_22(int x) { return x * 22; }
+inline int f4083_23(int x) { return x * 23; }
+inline int f4083_24(int x) { return x * 24; }
+inline int f4083_25(int x) { return x * 25; }
+inline int f4083_26(int x) { return x * 26; }
+inline int f4083_27(int x) { return x * 27; }
+inline int f4083_28(int x) { return x * 28; }
+inline int f4083_29(int x) { return x * 29; }
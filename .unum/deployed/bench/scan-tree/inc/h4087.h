@@ -0,0 +1,42 @@
+#pragma once
+/* header 4087 */
+#include <vector>
+#include "h5185.h"
+#include "h5473.h"
+#include "h2470.h"
+#include "h5464.h"
+#include "h309.h"
+#ifdef X
+#include "h1093.h"
+#endif
+struct S4087 { int a; const char *s = "x//y"; };
+inline int f4087_0(int x) { return x * 0; }
+inline int f4087_1(int x) { return x * 1; }
+inline int f4087_2(int x) { return x * 2; }
+inline int f4087_3(int x) { return x * 3; }
+inline int f4087_4(int x) { return x * 4; }
+inline int f4087_5(int x) { return x * 5; }
+inline int f4087_6(int x) { return x * 6; }
+inline int f4087_7(int x) { return x * 7; }
+inline int f4087_8(int x) { return x * 8; }
+inline int f4087_9(int x) { return x * 9; }
+inline int f4087_10(int x) { return x * 10; }
+inline int f4087_11(int x) { return x * 11; }
+inline int f4087_12(int x) { return x * 12; }
+inline int f4087_13(int x) { return x * 13; }
+inline int f4087_14(int x) { return x * 14; }
+inline int f4087_15(int x) { return x * 15; }
+inline int f4087_16(int x) { return x * 16; }
+inline int f4087_17(int x) { return x * 17; }
+inline int f4087_18(int x) { return x * 18; }
+inline int f4087_19(int x) { return x * 19; }
+inline int f4087_20(int x) { return x * 20; }
+inline int f4087_21(int x) { return x * 21; }
+inline int f4087_22(int x) { return x * 22; }
+inline int f4087_23(int x) { return x * 23; }
+inline int f4087_24(int x) { return x * 24; }
+inline int f4087_25(int x) { return x * 25; }
+inline int f4087_26(int x) { return x * 26; }
+inline int f4087_27(int x) { return x * 27; }
+inline int f4087_28(int x) { return x * 28; }
+inline int f4087_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4089 */
+#include <vector>
+#include "h9447.h"
+#include "h1493.h"
+#include "h1509.h"
+#include "h4239.h"
+#include "h8758.h"
+#ifdef X
+#include "h7363.h"
+#endif
+struct S4089 { int a; const char *s = "x//y"; };
+inline int f4089_0(int x) { return x * 0; }
+inline int f4089_1(int x) { return x * 1; }
+inline int f4089_2(int x) { return x * 2; }
+inline int f4089_3(int x) { return x * 3; }
+inline int f4089_4(int x) { return x * 4; }
+inline int f4089_5(int x) { return x * 5; }
+inline int f4089_6(int x) { return x * 6; }
+inline int f4089_7(int x) { return x * 7; }
+inline int f4089_8(int x) { return x * 8; }
+inline int f4089_9(int x) { return x * 9; }
+inline int f4089_10(int x) { return x * 10; }
+inline int f4089_11(int x) { return x * 11; }
+inline int f4089_12(int x) { return x * 12; }
+inline int f4089_13(int x) { return x * 13; }
+inline int f4089_14(int x) { return x * 14; }
+inline int f4089_15(int x) { return x * 15; }
+inline int f4089_16(int x) { return x * 16; }
+inline int f4089_17(int x) { return x * 17; }
+inline int f4089_18(int x) { return x * 18; }
+inline int f4089_19(int x) { return x * 19; }
+inline int f4089_20(int x) { return x * 20; }
+inline int f4089_21(int x) { return x * 21; }
+inline int f4089_22(int x) { return x * 22; }
+inline int f4089_23(int x) { return x * 23; }
+inline int f4089_24(int x) { return x * 24; }
+inline int f4089_25(int x) { return x * 25; }
+inline int f4089_26(int x) { return x * 26; }
+inline int f4089_27(int x) { return x * 27; }
+inline int f4089_28(int x) { return x * 28; }
+inline int f4089_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4091 */
+#include <vector>
+#include "h1079.h"
+#include "h3669.h"
+#include "h5174.h"
+#include "h936.h"
+#include "h295.h"
+#ifdef X
+#include "h5705.h"
+#endif
+struct S4091 { int a; const char *s = "x//y"; };
+inline int f4091_0(int x) { return x * 0; }
+inline int f4091_1(int x) { return x * 1; }
+inline int f4091_2(int x) { return x * 2; }
+inline int f4091_3(int x) { return x * 3; }
+inline int f4091_4(int x) { return x * 4; }
+inline int f4091_5(int x) { return x * 5; }
+inline int f4091_6(int x) { return x * 6; }
+inline int f4091_7(int x) { return x * 7; }
+inline int f4091_8(int x) { return x * 8; }
+inline int f4091_9(int x) { return x * 9; }
+inline int f4091_10(int x) { return x * 10; }
+inline int f4091_11(int x) { return x * 11; }
+inline int f4091_12(int x) { return x * 12; }
+inline int f4091_13(int x) { return x * 13; }
+inline int f4091_14(int x) { return x * 14; }
+inline int f4091_15(int x) { return x * 15; }
+inline int f4091_16(int x) { return x * 16; }
+inline int f4091_17(int x) { return x * 17; }
+inline int f4091_18(int x) { return x * 18; }
+inline int f4091_19(int x) { return x * 19; }
+inline int f4091_20(int x) { return x * 20; }
+inline int f4091_21(int x) { return x * 21; }
+inline int f4091_22(int x) { return x * 22; }
+inline int f4091_23(int x) { return x * 23; }
+inline int f4091_24(int x) { return x * 24; }
+inline int f4091_25(int x) { return x * 25; }
+inline int f4091_26(int x) { return x * 26; }
+inline int f4091_27(int x) { return x * 27; }
+inline int f4091_28(int x) { return x * 28; }
+inline int f4091_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4096 */
+#include <vector>
+#include "h8090.h"
+#include "h7480.h"
+#include "h5289.h"
+#include "h3564.h"
+#include "h6868.h"
+#ifdef X
+#include "h7656.h"
+#endif
+struct S4096 { int a; const char *s = "x//y"; };
+inline int f4096_0(int x) { return x * 0; }
+inline int f4096_1(int x) { return x * 1; }
+inline int f4096_2(int x) { return x * 2; }
+inline int f4096_3(int x) { return x * 3; }
+inline int f4096_4(int x) { return x * 4; }
+inline int f4096_5(int x) { return x * 5; }
+inline int f4096_6(int x) { return x * 6; }
+inline int f4096_7(int x) { return x * 7; }
+inline int f4096_8(int x) { return x * 8; }
+inline int f4096_9(int x) { return x * 9; }
+inline int f4096_10(int x) { return x * 10; }
+inline int f4096_11(int x) { return x * 11; }
+inline int f4096_12(int x) { return x * 12; }
+inline int f4096_13(int x) { return x * 13; }
+inline int f4096_14(int x) { return x * 14; }
+inline int f4096_15(int x) { return x * 15; }
+inline int f4096_16(int x) { return x * 16; }
+inline int f4096_17(int x) { return x * 17; }
+inline int f4096_18(int x) { return x * 18; }
+inline int f4096_19(int x) { return x * 19; }
+inline int f4096_20(int x) { return x * 20; }
+inline int f4096_21(int x) { return x * 21; }
+inline int f4096_22(int x) { return x * 22; }
+inline int f4096_23(int x) { return x * 23; }
+inline int f4096_24(int x) { return x * 24; }
+inline int f4096_25(int x) { return x * 25; }
+inline int f4096_26(int x) { return x * 26; }
+inline int f4096_27(int x) { return x * 27; }
+inline int f4096_28(int x) { return x * 28; }
+inline int f4096_29(int x) { return x * 29; }
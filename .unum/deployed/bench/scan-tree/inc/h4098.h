@@ -0,0 +1,42 @@
+#pragma once
+/* header 4098 */
+#include <vector>
+#include "h5279.h"
+#include "h8513.h"
+#include "h3661.h"
+#include "h5631.h"
+#include "h4548.h"
+#ifdef X
+#include "h5472.h"
+#endif
+struct S4098 { int a; const char *s = "x//y"; };
+inline int f4098_0(int x) { return x * 0; }
+inline int f4098_1(int x) { return x * 1; }
+inline int f4098_2(int x) { return x * 2; }
+inline int f4098_3(int x) { return x * 3; }
+inline int f4098_4(int x) { return x * 4; }
+inline int f4098_5(int x) { return x * 5; }
+inline int f4098_6(int x) { return x * 6; }
+inline int f4098_7(int x) { return x * 7; }
+inline int f4098_8(int x) { return x * 8; }
+inline int f4098_9(int x) { return x * 9; }
+inline int f4098_10(int x) { return x * 10; }
+inline int f4098_11(int x) { return x * 11; }
+inline int f4098_12(int x) { return x * 12; }
+inline int f4098_13(int x) { return x * 13; }
+inline int f4098_14(int x) { return x * 14; }
+inline int f4098_15(int x) { return x * 15; }
+inline int f4098_16(int x) { return x * 16; }
+inline int f4098_17(int x) { return x * 17; }
+inline int f4098_18(int x) { return x * 18; }
+inline int f4098_19(int x) { return x * 19; }
+inline int f4098_20(int x) { return x * 20; }
+inline int f4098_21(int x) { return x * 21; }
+inline int f4098_22(int x) { return x * 22; }
+inline int f4098_23(int x) { return x * 23; }
+inline int f4098_24(int x) { return x * 24; }
+inline int f4098_25(int x) { return x * 25; }
+inline int f4098_26(int x) { return x * 26; }
+inline int f4098_27(int x) { return x * 27; }
+inline int f4098_28(int x) { return x * 28; }
+inline int f4098_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 41 */
+#include <vector>
+#include "h6814.h"
+#include "h2266.h"
+#include "h7492.h"
+#include "h6432.h"
+#include "h2975.h"
+#ifdef X
+#include "h4735.h"
+#endif
+struct S41 { int a; const char *s = "x//y"; };
+inline int f41_0(int x) { return x * 0; }
+inline int f41_1(int x) { return x * 1; }
+inline int f41_2(int x) { return x * 2; }
+inline int f41_3(int x) { return x * 3; }
+inline int f41_4(int x) { return x * 4; }
+inline int f41_5(int x) { return x * 5; }
+inline int f41_6(int x) { return x * 6; }
+inline int f41_7(int x) { return x * 7; }
+inline int f41_8(int x) { return x * 8; }
+inline int f41_9(int x) { return x * 9; }
+inline int f41_10(int x) { return x * 10; }
+inline int f41_11(int x) { return x * 11; }
+inline int f41_12(int x) { return x * 12; }
+inline int f41_13(int x) { return x * 13; }
+inline int f41_14(int x) { return x * 14; }
+inline int f41_15(int x) { return x * 15; }
+inline int f41_16(int x) { return x * 16; }
+inline int f41_17(int x) { return x * 17; }
+inline int f41_18(int x) { return x * 18; }
+inline int f41_19(int x) { return x * 19; }
+inline int f41_20(int x) { return x * 20; }
+inline int f41_21(int x) { return x * 21; }
+inline int f41_22(int x) { return x * 22; }
+inline int f41_23(int x) { return x * 23; }
+inline int f41_24(int x) { return x * 24; }
+inline int f41_25(int x) { return x * 25; }
+inline int f41_26(int x) { return x * 26; }
+inline int f41_27(int x) { return x * 27; }
+inline int f41_28(int x) { return x * 28; }
+inline int f41_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4100 */
+#include <vector>
+#include "h3082.h"
+#include "h7325.h"
+#include "h6972.h"
+#include "h6760.h"
+#include "h3054.h"
+#ifdef X
+#include "h6467.h"
+#endif
+struct S4100 { int a; const char *s = "x//y"; };
+inline int f4100_0(int x) { return x * 0; }
+inline int f4100_1(int x) { return x * 1; }
+inline int f4100_2(int x) { return x * 2; }
+inline int f4100_3(int x) { return x * 3; }
+inline int f4100_4(int x) { return x * 4; }
+inline int f4100_5(int x) { return x * 5; }
+inline int f4100_6(int x) { return x * 6; }
+inline int f4100_7(int x) { return x * 7; }
+inline int f4100_8(int x) { return x * 8; }
+inline int f4100_9(int x) { return x * 9; }
+inline int f4100_10(int x) { return x * 10; }
+inline int f4100_11(int x) { return x * 11; }
+inline int f4100_12(int x) { return x * 12; }
+inline int f4100_13(int x) { return x * 13; }
+inline int f4100_14(int x) { return x * 14; }
+inline int f4100_15(int x) { return x * 15; }
+inline int f4100_16(int x) { return x * 16; }
+inline int f4100_17(int x) { return x * 17; }
+inline int f4100_18(int x) { return x * 18; }
+inline int f4100_19(int x) { return x * 19; }
+inline int f4100_20(int x) { return x * 20; }
+inline int f4100_21(int x) { return x * 21; }
+inline int f4100_22(int x) { return x * 22; }
+inline int f4100_23(int x) { return x * 23; }
+inline int f4100_24(int x) { return x * 24; }
+inline int f4100_25(int x) { return x * 25; }
+inline int f4100_26(int x) { return x * 26; }
+inline int f4100_27(int x) { return x * 27; }
+inline int f4100_28(int x) { return x * 28; }
+inline int f4100_29(int x) { return x * 29; }
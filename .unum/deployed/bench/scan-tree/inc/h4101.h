@@ -0,0 +1,42 @@
+#pragma once
+/* header 4101 */
+#include <vector>
+#include "h890.h"
+#include "h346.h"
+#include "h4432.h"
+#include "h289.h"
+#include "h3657.h"
+#ifdef X
+#include "h952.h"
+#endif
+struct S4101 { int a; const char *s = "x//y"; };
+inline int f4101_0(int x) { return x * 0; }
+inline int f4101_1(int x) { return x * 1; }
+inline int f4101_2(int x) { return x * 2; }
+inline int f4101_3(int x) { return x * 3; }
+inline int f4101_4(int x) { return x * 4; }
+inline int f4101_5(int x) { return x * 5; }
+inline int f4101_6(int x) { return x * 6; }
+inline int f4101_7(int x) { return x * 7; }
+inline int f4101_8(int x) { return x * 8; }
+inline int f4101_9(int x) { return x * 9; }
+inline int f4101_10(int x) { return x * 10; }
+inline int f4101_11(int x) { return x * 11; }
+inline int f4101_12(int x) { return x * 12; }
+inline int f4101_13(int x) { return x * 13; }
+inline int f4101_14(int x) { return x * 14; }
+inline int f4101_15(int x) { return x * 15; }
+inline int f4101_16(int x) { return x * 16; }
+inline int f4101_17(int x) { return x * 17; }
+inline int f4101_18(int x) { return x * 18; }
+inline int f4101_19(int x) { return x * 19; }
+inline int f4101_20(int x) { return x * 20; }
+inline int f4101_21(int x) { return x * 21; }
+inline int f4101_22(int x) { return x * 22; }
+inline int f4101_23(int x) { return x * 23; }
+inline int f4101_24(int x) { return x * 24; }
+inline int f4101_25(int x) { return x * 25; }
+inline int f4101_26(int x) { return x * 26; }
+inline int f4101_27(int x) { return x * 27; }
+inline int f4101_28(int x) { return x * 28; }
+inline int f4101_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4102 */
+#include <vector>
+#include "h4981.h"
+#include "h103.h"
+#include "h2463.h"
+#include "h6361.h"
+#include "h2838.h"
+#ifdef X
+#include "h2319.h"
+#endif
+struct S4102 { int a; const char *s = "x//y"; };
+inline int f4102_0(int x) { return x * 0; }
+inline int f4102_1(int x) { return x * 1; }
+inline int f4102_2(int x) { return x * 2; }
+inline int f4102_3(int x) { return x * 3; }
+inline int f4102_4(int x) { return x * 4; }
+inline int f4102_5(int x) { return x * 5; }
+inline int f4102_6(int x) { return x * 6; }
+inline int f4102_7(int x) { return x * 7; }
+inline int f4102_8(int x) { return x * 8; }
+inline int f4102_9(int x) { return x * 9; }
+inline int f4102_10(int x) { return x * 10; }
+inline int f4102_11(int x) { return x * 11; }
+inline int f4102_12(int x) { return x * 12; }
+inline int f4102_13(int x) { return x * 13; }
+inline int f4102_14(int x) { return x * 14; }
+inline int f4102_15(int x) { return x * 15; }
+inline int f4102_16(int x) { return x * 16; }
+inline int f4102_17(int x) { return x * 17; }
+inline int f4102_18(int x) { return x * 18; }
+inline int f4102_19(int x) { return x * 19; }
+inline int f4102_20(int x) { return x * 20; }
+inline int f4102_21(int x) { return x * 21; }
+inline int f4102_22(int x) { return x * 22; }
+inline int f4102_23(int x) { return x * 23; }
+inline int f4102_24(int x) { return x * 24; }
+inline int f4102_25(int x) { return x * 25; }
+inline int f4102_26(int x) { return x * 26; }
+inline int f4102_27(int x) { return x * 27; }
+inline int f4102_28(int x) { return x * 28; }
+inline int f4102_29(int x) { return x * 29; }
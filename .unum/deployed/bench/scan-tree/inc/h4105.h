@@ -0,0 +1,42 @@
+#pragma once
+/* header 4105 */
+#include <vector>
+#include "h7500.h"
+#include "h6859.h"
+#include "h5459.h"
+#include "h7006.h"
+#include "h3935.h"
+#ifdef X
+#include "h2848.h"
+#endif
+struct S4105 { int a; const char *s = "x//y"; };
+inline int f4105_0(int x) { return x * 0; }
+inline int f4105_1(int x) { return x * 1; }
+inline int f4105_2(int x) { return x * 2; }
+inline int f4105_3(int x) { return x * 3; }
+inline int f4105_4(int x) { return x * 4; }
+inline int f4105_5(int x) { return x * 5; }
+inline int f4105_6(int x) { return x * 6; }
+inline int f4105_7(int x) { return x * 7; }
+inline int f4105_8(int x) { return x * 8; }
+inline int f4105_9(int x) { return x * 9; }
+inline int f4105_10(int x) { return x * 10; }
+inline int f4105_11(int x) { return x * 11; }
+inline int f4105_12(int x) { return x * 12; }
+inline int f4105_13(int x) { return x * 13; }
+inline int f4105_14(int x) { return x * 14; }
+inline int f4105_15(int x) { return x * 15; }
+inline int f4105_16(int x) { return x * 16; }
+inline int f4105_17(int x) { return x * 17; }
+inline int f4105_18(int x) { return x * 18; }
+inline int f4105_19(int x) { return x * 19; }
+inline int f4105_20(int x) { return x * 20; }
+inline int f4105_21(int x) { return x * 21; }
+inline int f4105_22(int x) { return x * 22; }
+inline int f4105_23(int x) { return x * 23; }
+inline int f4105_24(int x) { return x * 24; }
+inline int f4105_25(int x) { return x * 25; }
+inline int f4105_26(int x) { return x * 26; }
+inline int f4105_27(int x) { return x * 27; }
+inline int f4105_28(int x) { return x * 28; }
+inline int f4105_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4106 */
+#include <vector>
+#include "h9709.h"
+#include "h8653.h"
+#include "h4962.h"
+#include "h8228.h"
+#include "h7411.h"
+#ifdef X
+#include "h6002.h"
+#endif
+struct S4106 { int a; const char *s = "x//y"; };
+inline int f4106_0(int x) { return x * 0; }
+inline int f4106_1(int x) { return x * 1; }
+inline int f4106_2(int x) { return x * 2; }
+inline int f4106_3(int x) { return x * 3; }
+inline int f4106_4(int x) { return x * 4; }
+inline int f4106_5(int x) { return x * 5; }
+inline int f4106_6(int x) { return x * 6; }
+inline int f4106_7(int x) { return x * 7; }
+inline int f4106_8(int x) { return x * 8; }
+inline int f4106_9(int x) { return x * 9; }
+inline int f4106_10(int x) { return x * 10; }
+inline int f4106_11(int x) { return x * 11; }
+inline int f4106_12(int x) { return x * 12; }
+inline int f4106_13(int x) { return x * 13; }
+inline int f4106_14(int x) { return x * 14; }
+inline int f4106_15(int x) { return x * 15; }
+inline int f4106_16(int x) { return x * 16; }
+inline int f4106_17(int x) { return x * 17; }
+inline int f4106_18(int x) { return x * 18; }
+inline int f4106_19(int x) { return x * 19; }
+inline int f4106_20(int x) { return x * 20; }
+inline int f4106_21(int x) { return x * 21; }
+inline int f4106_22(int x) { return x * 22; }
+inline int f4106_23(int x) { return x * 23; }
+inline int f4106_24(int x) { return x * 24; }
+inline int f4106_25(int x) { return x * 25; }
+inline int f4106_26(int x) { return x * 26; }
+inline int f4106_27(int x) { return x * 27; }
+inline int f4106_28(int x) { return x * 28; }
+inline int f4106_29(int x) { return x * 29; }
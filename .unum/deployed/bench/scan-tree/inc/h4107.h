@@ -0,0 +1,42 @@
+#pragma once
+/* header 4107 */
+#include <vector>
+#include "h4569.h"
+#include "h3637.h"
+#include "h6589.h"
+#include "h4830.h"
+#include "h5159.h"
+#ifdef X
+#include "h5998.h"
+#endif
+struct S4107 { int a; const char *s = "x//y"; };
+inline int f4107_0(int x) { return x * 0; }
+inline int f4107_1(int x) { return x * 1; }
+inline int f4107_2(int x) { return x * 2; }
+inline int f4107_3(int x) { return x * 3; }
+inline int f4107_4(int x) { return x * 4; }
+inline int f4107_5(int x) { return x * 5; }
+inline int f4107_6(int x) { return x * 6; }
+inline int f4107_7(int x) { return x * 7; }
+inline int f4107_8(int x) { return x * 8; }
+inline int f4107_9(int x) { return x * 9; }
+inline int f4107_10(int x) { return x * 10; }
+inline int f4107_11(int x) { return x * 11; }
+inline int f4107_12(int x) { return x * 12; }
+inline int f4107_13(int x) { return x * 13; }
+inline int f4107_14(int x) { return x * 14; }
+inline int f4107_15(int x) { return x * 15; }
+inline int f4107_16(int x) { return x * 16; }
+inline int f4107_17(int x) { return x * 17; }
+inline int f4107_18(int x) { return x * 18; }
+inline int f4107_19(int x) { return x * 19; }
+inline int f4107_20(int x) { return x * 20; }
+inline int f4107_21(int x) { return x * 21; }
+inline int f4107_22(int x) { return x * 22; }
+inline int f4107_23(int x) { return x * 23; }
+inline int f4107_24(int x) { return x * 24; }
+inline int f4107_25(int x) { return x * 25; }
+inline int f4107_26(int x) { return x * 26; }
+inline int f4107_27(int x) { return x * 27; }
+inline int f4107_28(int x) { return x * 28; }
+inline int f4107_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4109 */
+#include <vector>
+#include "h803.h"
+#include "h3488.h"
+#include "h9107.h"
+#include "h5460.h"
+#include "h3770.h"
+#ifdef X
+#include "h5303.h"
+#endif
+struct S4109 { int a; const char *s = "x//y"; };
+inline int f4109_0(int x) { return x * 0; }
+inline int f4109_1(int x) { return x * 1; }
+inline int f4109_2(int x) { return x * 2; }
+inline int f4109_3(int x) { return x * 3; }
+inline int f4109_4(int x) { return x * 4; }
+inline int f4109_5(int x) { return x * 5; }
+inline int f4109_6(int x) { return x * 6; }
+inline int f4109_7(int x) { return x * 7; }
+inline int f4109_8(int x) { return x * 8; }
+inline int f4109_9(int x) { return x * 9; }
+inline int f4109_10(int x) { return x * 10; }
+inline int f4109_11(int x) { return x * 11; }
+inline int f4109_12(int x) { return x * 12; }
+inline int f4109_13(int x) { return x * 13; }
+inline int f4109_14(int x) { return x * 14; }
+inline int f4109_15(int x) { return x * 15; }
+inline int f4109_16(int x) { return x * 16; }
+inline int f4109_17(int x) { return x * 17; }
+inline int f4109_18(int x) { return x * 18; }
+inline int f4109_19(int x) { return x * 19; }
+inline int f4109_20(int x) { return x * 20; }
+inline int f4109_21(int x) { return x * 21; }
+inline int f4109_22(int x) { return x * 22; }
+inline int f4109_23(int x) { return x * 23; }
+inline int f4109_24(int x) { return x * 24; }
+inline int f4109_25(int x) { return x * 25; }
+inline int f4109_26(int x) { return x * 26; }
+inline int f4109_27(int x) { return x * 27; }
+inline int f4109_28(int x) { return x * 28; }
+inline int f4109_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 411 */
+#include <vector>
+#include "h9502.h"
+#include "h261.h"
+#include "h6740.h"
+#include "h6725.h"
+#include "h5943.h"
+#ifdef X
+#include "h7911.h"
+#endif
+struct S411 { int a; const char *s = "x//y"; };
+inline int f411_0(int x) { return x * 0; }
+inline int f411_1(int x) { return x * 1; }
+inline int f411_2(int x) { return x * 2; }
+inline int f411_3(int x) { return x * 3; }
+inline int f411_4(int x) { return x * 4; }
+inline int f411_5(int x) { return x * 5; }
+inline int f411_6(int x) { return x * 6; }
+inline int f411_7(int x) { return x * 7; }
+inline int f411_8(int x) { return x * 8; }
+inline int f411_9(int x) { return x * 9; }
+inline int f411_10(int x) { return x * 10; }
+inline int f411_11(int x) { return x * 11; }
+inline int f411_12(int x) { return x * 12; }
+inline int f411_13(int x) { return x * 13; }
+inline int f411_14(int x) { return x * 14; }
+inline int f411_15(int x) { return x * 15; }
+inline int f411_16(int x) { return x * 16; }
+inline int f411_17(int x) { return x * 17; }
+inline int f411_18(int x) { return x * 18; }
+inline int f411_19(int x) { return x * 19; }
+inline int f411_20(int x) { return x * 20; }
+inline int f411_21(int x) { return x * 21; }
+inline int f411_22(int x) { return x * 22; }
+inline int f411_23(int x) { return x * 23; }
+inline int f411_24(int x) { return x * 24; }
+inline int f411_25(int x) { return x * 25; }
+inline int f411_26(int x) { return x * 26; }
+inline int f411_27(int x) { return x * 27; }
+inline int f411_28(int x) { return x * 28; }
+inline int f411_29(int x) { return x * 29; }
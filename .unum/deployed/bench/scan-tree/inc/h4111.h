@@ -0,0 +1,42 @@
+#pragma once
+/* header 4111 */
+#include <vector>
+#include "h378.h"
+#include "h7174.h"
+#include "h6219.h"
+#include "h144.h"
+#include "h8627.h"
+#ifdef X
+#include "h8443.h"
+#endif
+struct S4111 { int a; const char *s = "x//y"; };
+inline int f4111_0(int x) { return x * 0; }
+inline int f4111_1(int x) { return x * 1; }
+inline int f4111_2(int x) { return x * 2; }
+inline int f4111_3(int x) { return x * 3; }
+inline int f4111_4(int x) { return x * 4; }
+inline int f4111_5(int x) { return x * 5; }
+inline int f4111_6(int x) { return x * 6; }
+inline int f4111_7(int x) { return x * 7; }
+inline int f4111_8(int x) { return x * 8; }
+inline int f4111_9(int x) { return x * 9; }
+inline int f4111_10(int x) { return x * 10; }
+inline int f4111_11(int x) { return x * 11; }
+inline int f4111_12(int x) { return x * 12; }
+inline int f4111_13(int x) { return x * 13; }
+inline int f4111_14(int x) { return x * 14; }
+inline int f4111_15(int x) { return x * 15; }
+inline int f4111_16(int x) { return x * 16; }
+inline int f4111_17(int x) { return x * 17; }
+inline int f4111_18(int x) { return x * 18; }
+inline int f4111_19(int x) { return x * 19; }
+inline int f4111_20(int x) { return x * 20; }
+inline int f4111_21(int x) { return x * 21; }
+inline int f4111_22(int x) { return x * 22; }
+inline int f4111_23(int x) { return x * 23; }
+inline int f4111_24(int x) { return x * 24; }
+inline int f4111_25(int x) { return x * 25; }
+inline int f4111_26(int x) { return x * 26; }
+inline int f4111_27(int x) { return x * 27; }
+inline int f4111_28(int x) { return x * 28; }
+inline int f4111_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4112 */
+#include <vector>
+#include "h2244.h"
+#include "h5292.h"
+#include "h3535.h"
+#include "h8261.h"
+#include "h7004.h"
+#ifdef X
+#include "h3226.h"
+#endif
+struct S4112 { int a; const char *s = "x//y"; };
+inline int f4112_0(int x) { return x * 0; }
+inline int f4112_1(int x) { return x * 1; }
+inline int f4112_2(int x) { return x * 2; }
+inline int f4112_3(int x) { return x * 3; }
+inline int f4112_4(int x) { return x * 4; }
+inline int f4112_5(int x) { return x * 5; }
+inline int f4112_6(int x) { return x * 6; }
+inline int f4112_7(int x) { return x * 7; }
+inline int f4112_8(int x) { return x * 8; }
+inline int f4112_9(int x) { return x * 9; }
+inline int f4112_10(int x) { return x * 10; }
+inline int f4112_11(int x) { return x * 11; }
+inline int f4112_12(int x) { return x * 12; }
+inline int f4112_13(int x) { return x * 13; }
+inline int f4112_14(int x) { return x * 14; }
+inline int f4112_15(int x) { return x * 15; }
+inline int f4112_16(int x) { return x * 16; }
+inline int f4112_17(int x) { return x * 17; }
+inline int f4112_18(int x) { return x * 18; }
+inline int f4112_19(int x) { return x * 19; }
+inline int f4112_20(int x) { return x * 20; }
+inline int f4112_21(int x) { return x * 21; }
+inline int f4112_22(int x) { return x * 22; }
+inline int f4112_23(int x) { return x * 23; }
+inline int f4112_24(int x) { return x * 24; }
+inline int f4112_25(int x) { return x * 25; }
+inline int f4112_26(int x) { return x * 26; }
+inline int f4112_27(int x) { return x * 27; }
+inline int f4112_28(int x) { return x * 28; }
+inline int f4112_29(int x) { return x * 29; }
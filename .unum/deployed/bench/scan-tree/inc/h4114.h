@@ -0,0 +1,42 @@
+#pragma once
+/* header 4114 */
+#include <vector>
+#include "h2230.h"
+#include "h2906.h"
+#include "h8991.h"
+#include "h4063.h"
+#include "h1438.h"
+#ifdef X
+#include "h5031.h"
+#endif
+struct S4114 { int a; const char *s = "x//y"; };
+inline int f4114_0(int x) { return x * 0; }
+inline int f4114_1(int x) { return x * 1; }
+inline int f4114_2(int x) { return x * 2; }
+inline int f4114_3(int x) { return x * 3; }
+inline int f4114_4(int x) { return x * 4; }
+inline int f4114_5(int x) { return x * 5; }
+inline int f4114_6(int x) { return x * 6; }
+inline int f4114_7(int x) { return x * 7; }
+inline int f4114_8(int x) { return x * 8; }
+inline int f4114_9(int x) { return x * 9; }
+inline int f4114_10(int x) { return x * 10; }
+inline int f4114_11(int x) { return x * 11; }
+inline int f4114_12(int x) { return x * 12; }
+inline int f4114_13(int x) { return x * 13; }
+inline int f4114_14(int x) { return x * 14; }
+inline int f4114_15(int x) { return x * 15; }
+inline int f4114_16(int x) { return x * 16; }
+inline int f4114_17(int x) { return x * 17; }
+inline int f4114_18(int x) { return x * 18; }
+inline int f4114_19(int x) { return x * 19; }
+inline int f4114_20(int x) { return x * 20; }
+inline int f4114_21(int x) { return x * 21; }
+inline int f4114_22(int x) { return x * 22; }
+inline int f4114_23(int x) { return x * 23; }
+inline int f4114_24(int x) { return x * 24; }
+inline int f4114_25(int x) { return x * 25; }
+inline int f4114_26(int x) { return x * 26; }
+inline int f4114_27(int x) { return x * 27; }
+inline int f4114_28(int x) { return x * 28; }
+inline int f4114_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4115 */
+#include <vector>
+#include "h2858.h"
+#include "h7502.h"
+#include "h7774.h"
+#include "h2863.h"
+#include "h4132.h"
+#ifdef X
+#include "h7626.h"
+#endif
+struct S4115 { int a; const char *s = "x//y"; };
+inline int f4115_0(int x) { return x * 0; }
+inline int f4115_1(int x) { return x * 1; }
+inline int f4115_2(int x) { return x * 2; }
+inline int f4115_3(int x) { return x * 3; }
+inline int f4115_4(int x) { return x * 4; }
+inline int f4115_5(int x) { return x * 5; }
+inline int f4115_6(int x) { return x * 6; }
+inline int f4115_7(int x) { return x * 7; }
+inline int f4115_8(int x) { return x * 8; }
+inline int f4115_9(int x) { return x * 9; }
+inline int f4115_10(int x) { return x * 10; }
+inline int f4115_11(int x) { return x * 11; }
+inline int f4115_12(int x) { return x * 12; }
+inline int f4115_13(int x) { return x * 13; }
+inline int f4115_14(int x) { return x * 14; }
+inline int f4115_15(int x) { return x * 15; }
+inline int f4115_16(int x) { return x * 16; }
+inline int f4115_17(int x) { return x * 17; }
+inline int f4115_18(int x) { return x * 18; }
+inline int f4115_19(int x) { return x * 19; }
+inline int f4115_20(int x) { return x * 20; }
+inline int f4115_21(int x) { return x * 21; }
+inline int f4115_22(int x) { return x * 22; }
+inline int f4115_23(int x) { return x * 23; }
+inline int f4115_24(int x) { return x * 24; }
+inline int f4115_25(int x) { return x * 25; }
+inline int f4115_26(int x) { return x * 26; }
+inline int f4115_27(int x) { return x * 27; }
+inline int f4115_28(int x) { return x * 28; }
+inline int f4115_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4116 */
+#include <vector>
+#include "h2075.h"
+#include "h227.h"
+#include "h4938.h"
+#include "h6702.h"
+#include "h8918.h"
+#ifdef X
+#include "h6964.h"
+#endif
+struct S4116 { int a; const char *s = "x//y"; };
+inline int f4116_0(int x) { return x * 0; }
+inline int f4116_1(int x) { return x * 1; }
+inline int f4116_2(int x) { return x * 2; }
+inline int f4116_3(int x) { return x * 3; }
+inline int f4116_4(int x) { return x * 4; }
+inline int f4116_5(int x) { return x * 5; }
+inline int f4116_6(int x) { return x * 6; }
+inline int f4116_7(int x) { return x * 7; }
+inline int f4116_8(int x) { return x * 8; }
+inline int f4116_9(int x) { return x * 9; }
+inline int f4116_10(int x) { return x * 10; }
+inline int f4116_11(int x) { return x * 11; }
+inline int f4116_12(int x) { return x * 12; }
+inline int f4116_13(int x) { return x * 13; }
+inline int f4116_14(int x) { return x * 14; }
+inline int f4116_15(int x) { return x * 15; }
+inline int f4116_16(int x) { return x * 16; }
+inline int f4116_17(int x) { return x * 17; }
+inline int f4116_18(int x) { return x * 18; }
+inline int f4116_19(int x) { return x * 19; }
+inline int f4116_20(int x) { return x * 20; }
+inline int f4116_21(int x) { return x * 21; }
+inline int f4116_22(int x) { return x * 22; }
+inline int f4116_23(int x) { return x * 23; }
+inline int f4116_24(int x) { return x * 24; }
+inline int f4116_25(int x) { return x * 25; }
+inline int f4116_26(int x) { return x * 26; }
+inline int f4116_27(int x) { return x * 27; }
+inline int f4116_28(int x) { return x * 28; }
+inline int f4116_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 412 */
+#include <vector>
+#include "h2783.h"
+#include "h2882.h"
+#include "h3903.h"
+#include "h3859.h"
+#include "h7316.h"
+#ifdef X
+#include "h635.h"
+#endif
+struct S412 { int a; const char *s = "x//y"; };
+inline int f412_0(int x) { return x * 0; }
+inline int f412_1(int x) { return x * 1; }
+inline int f412_2(int x) { return x * 2; }
+inline int f412_3(int x) { return x * 3; }
+inline int f412_4(int x) { return x * 4; }
+inline int f412_5(int x) { return x * 5; }
+inline int f412_6(int x) { return x * 6; }
+inline int f412_7(int x) { return x * 7; }
+inline int f412_8(int x) { return x * 8; }
+inline int f412_9(int x) { return x * 9; }
+inline int f412_10(int x) { return x * 10; }
+inline int f412_11(int x) { return x * 11; }
+inline int f412_12(int x) { return x * 12; }
+inline int f412_13(int x) { return x * 13; }
+inline int f412_14(int x) { return x * 14; }
+inline int f412_15(int x) { return x * 15; }
+inline int f412_16(int x) { return x * 16; }
+inline int f412_17(int x) { return x * 17; }
+inline int f412_18(int x) { return x * 18; }
+inline int f412_19(int x) { return x * 19; }
+inline int f412_20(int x) { return x * 20; }
+inline int f412_21(int x) { return x * 21; }
+inline int f412_22(int x) { return x * 22; }
+inline int f412_23(int x) { return x * 23; }
+inline int f412_24(int x) { return x * 24; }
+inline int f412_25(int x) { return x * 25; }
+inline int f412_26(int x) { return x * 26; }
+inline int f412_27(int x) { return x * 27; }
+inline int f412_28(int x) { return x * 28; }
+inline int f412_29(int x) { return x * 29; }
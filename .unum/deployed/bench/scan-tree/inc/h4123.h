@@ -0,0 +1,42 @@
+#pragma once
+/* header 4123 */
+#include <vector>
+#include "h1633.h"
+#include "h8178.h"
+#include "h4365.h"
+#include "h3857.h"
+#include "h3894.h"
+#ifdef X
+#include "h8378.h"
+#endif
+struct S4123 { int a; const char *s = "x//y"; };
+inline int f4123_0(int x) { return x * 0; }
+inline int f4123_1(int x) { return x * 1; }
+inline int f4123_2(int x) { return x * 2; }
+inline int f4123_3(int x) { return x * 3; }
+inline int f4123_4(int x) { return x * 4; }
+inline int f4123_5(int x) { return x * 5; }
+inline int f4123_6(int x) { return x * 6; }
+inline int f4123_7(int x) { return x * 7; }
+inline int f4123_8(int x) { return x * 8; }
+inline int f4123_9(int x) { return x * 9; }
+inline int f4123_10(int x) { return x * 10; }
+inline int f4123_11(int x) { return x * 11; }
+inline int f4123_12(int x) { return x * 12; }
+inline int f4123_13(int x) { return x * 13; }
+inline int f4123_14(int x) { return x * 14; }
+inline int f4123_15(int x) { return x * 15; }
+inline int f4123_16(int x) { return x * 16; }
+inline int f4123_17(int x) { return x * 17; }
+inline int f4123_18(int x) { return x * 18; }
+inline int f4123_19(int x) { return x * 19; }
+inline int f4123_20(int x) { return x * 20; }
+inline int f4123_21(int x) { return x * 21; }
+inline int f4123_22(int x) { return x * 22; }
+inline int f4123_23(int x) { return x * 23; }
+inline int f4123_24(int x) { return x * 24; }
+inline int f4123_25(int x) { return x * 25; }
+inline int f4123_26(int x) { return x * 26; }
+inline int f4123_27(int x) { return x * 27; }
+inline int f4123_28(int x) { return x * 28; }
+inline int f4123_29(int x) { return x * 29; }
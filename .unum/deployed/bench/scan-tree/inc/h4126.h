@@ -0,0 +1,42 @@
+#pragma once
+/* header 4126 */
+#include <vector>
+#include "h880.h"
+#include "h4336.h"
+#include "h3964.h"
+#include "h2920.h"
+#include "h148.h"
+#ifdef X
+#include "h4367.h"
+#endif
+struct S4126 { int a; const char *s = "x//y"; };
+inline int f4126_0(int x) { return x * 0; }
+inline int f4126_1(int x) { return x * 1; }
+inline int f4126_2(int x) { return x * 2; }
+inline int f4126_3(int x) { return x * 3; }
+inline int f4126_4(int x) { return x * 4; }
+inline int f4126_5(int x) { return x * 5; }
+inline int f4126_6(int x) { return x * 6; }
+inline int f4126_7(int x) { return x * 7; }
+inline int f4126_8(int x) { return x * 8; }
+inline int f4126_9(int x) { return x * 9; }
+inline int f4126_10(int x) { return x * 10; }
+inline int f4126_11(int x) { return x * 11; }
+inline int f4126_12(int x) { return x * 12; }
+inline int f4126_13(int x) { return x * 13; }
+inline int f4126_14(int x) { return x * 14; }
+inline int f4126_15(int x) { return x * 15; }
+inline int f4126_16(int x) { return x * 16; }
+inline int f4126_17(int x) { return x * 17; }
+inline int f4126_18(int x) { return x * 18; }
+inline int f4126_19(int x) { return x * 19; }
+inline int f4126_20(int x) { return x * 20; }
+inline int f4126_21(int x) { return x * 21; }
+inline int f4126_22(int x) { return x * 22; }
+inline int f4126_23(int x) { return x * 23; }
+inline int f4126_24(int x) { return x * 24; }
+inline int f4126_25(int x) { return x * 25; }
+inline int f4126_26(int x) { return x * 26; }
+inline int f4126_27(int x) { return x * 27; }
+inline int f4126_28(int x) { return x * 28; }
+inline int f4126_29(int x) { return x * 29; }
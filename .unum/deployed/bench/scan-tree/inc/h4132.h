@@ -0,0 +1,42 @@
+#pragma once
+/* header 4132 */
+#include <vector>
+#include "h285.h"
+#include "h6431.h"
+#include "h1990.h"
+#include "h701.h"
+#include "h1185.h"
+#ifdef X
+#include "h7145.h"
+#endif
+struct S4132 { int a; const char *s = "x//y"; };
+inline int f4132_0(int x) { return x * 0; }
+inline int f4132_1(int x) { return x * 1; }
+inline int f4132_2(int x) { return x * 2; }
+inline int f4132_3(int x) { return x * 3; }
+inline int f4132_4(int x) { return x * 4; }
+inline int f4132_5(int x) { return x * 5; }
+inline int f4132_6(int x) { return x * 6; }
+inline int f4132_7(int x) { return x * 7; }
+inline int f4132_8(int x) { return x * 8; }
+inline int f4132_9(int x) { return x * 9; }
+inline int f4132_10(int x) { return x * 10; }
+inline int f4132_11(int x) { return x * 11; }
+inline int f4132_12(int x) { return x * 12; }
+inline int f4132_13(int x) { return x * 13; }
+inline int f4132_14(int x) { return x * 14; }
+inline int f4132_15(int x) { return x * 15; }
+inline int f4132_16(int x) { return x * 16; }
+inline int f4132_17(int x) { return x * 17; }
+inline int f4132_18(int x) { return x * 18; }
+inline int f4132_19(int x) { return x * 19; }
+inline int f4132_20(int x) { return x * 20; }
+inline int f4132_21(int x) { return x * 21; }
+inline int f4132_22(int x) { return x * 22; }
+inline int f4132_23(int x) { return x * 23; }
+inline int f4132_24(int x) { return x * 24; }
+inline int f4132_25(int x) { return x * 25; }
+inline int f4132_26(int x) { return x * 26; }
+inline int f4132_27(int x) { return x * 27; }
+inline int f4132_28(int x) { return x * 28; }
+inline int f4132_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4135 */
+#include <vector>
+#include "h2703.h"
+#include "h9472.h"
+#include "h6021.h"
+#include "h8522.h"
+#include "h7212.h"
+#ifdef X
+#include "h2546.h"
+#endif
+struct S4135 { int a; const char *s = "x//y"; };
+inline int f4135_0(int x) { return x * 0; }
+inline int f4135_1(int x) { return x * 1; }
+inline int f4135_2(int x) { return x * 2; }
+inline int f4135_3(int x) { return x * 3; }
+inline int f4135_4(int x) { return x * 4; }
+inline int f4135_5(int x) { return x * 5; }
+inline int f4135_6(int x) { return x * 6; }
+inline int f4135_7(int x) { return x * 7; }
+inline int f4135_8(int x) { return x * 8; }
+inline int f4135_9(int x) { return x * 9; }
+inline int f4135_10(int x) { return x * 10; }
+inline int f4135_11(int x) { return x * 11; }
+inline int f4135_12(int x) { return x * 12; }
+inline int f4135_13(int x) { return x * 13; }
+inline int f4135_14(int x) { return x * 14; }
+inline int f4135_15(int x) { return x * 15; }
+inline int f4135_16(int x) { return x * 16; }
+inline int f4135_17(int x) { return x * 17; }
+inline int f4135_18(int x) { return x * 18; }
+inline int f4135_19(int x) { return x * 19; }
+inline int f4135_20(int x) { return x * 20; }
+inline int f4135_21(int x) { return x * 21; }
+inline int f4135_22(int x) { return x * 22; }
+inline int f4135_23(int x) { return x * 23; }
+inline int f4135_24(int x) { return x * 24; }
+inline int f4135_25(int x) { return x * 25; }
+inline int f4135_26(int x) { return x * 26; }
+inline int f4135_27(int x) { return x * 27; }
+inline int f4135_28(int x) { return x * 28; }
+inline int f4135_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4136 */
+#include <vector>
+#include "h7996.h"
+#include "h4332.h"
+#include "h3903.h"
+#include "h4187.h"
+#include "h4076.h"
+#ifdef X
+#include "h4380.h"
+#endif
+struct S4136 { int a; const char *s = "x//y"; };
+inline int f4136_0(int x) { return x * 0; }
+inline int f4136_1(int x) { return x * 1; }
+inline int f4136_2(int x) { return x * 2; }
+inline int f4136_3(int x) { return x * 3; }
+inline int f4136_4(int x) { return x * 4; }
+inline int f4136_5(int x) { return x * 5; }
+inline int f4136_6(int x) { return x * 6; }
+inline int f4136_7(int x) { return x * 7; }
+inline int f4136_8(int x) { return x * 8; }
+inline int f4136_9(int x) { return x * 9; }
+inline int f4136_10(int x) { return x * 10; }
+inline int f4136_11(int x) { return x * 11; }
+inline int f4136_12(int x) { return x * 12; }
+inline int f4136_13(int x) { return x * 13; }
+inline int f4136_14(int x) { return x * 14; }
+inline int f4136_15(int x) { return x * 15; }
+inline int f4136_16(int x) { return x * 16; }
+inline int f4136_17(int x) { return x * 17; }
+inline int f4136_18(int x) { return x * 18; }
+inline int f4136_19(int x) { return x * 19; }
+inline int f4136_20(int x) { return x * 20; }
+inline int f4136_21(int x) { return x * 21; }
+inline int f4136_22(int x) { return x * 22; }
+inline int f4136_23(int x) { return x * 23; }
+inline int f4136_24(int x) { return x * 24; }
+inline int f4136_25(int x) { return x * 25; }
+inline int f4136_26(int x) { return x * 26; }
+inline int f4136_27(int x) { return x * 27; }
+inline int f4136_28(int x) { return x * 28; }
+inline int f4136_29(int x) { return x * 29; }
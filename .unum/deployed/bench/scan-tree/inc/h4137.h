@@ -0,0 +1,42 @@
+#pragma once
+/* header 4137 */
+#include <vector>
+#include "h3648.h"
+#include "h6888.h"
+#include "h5915.h"
+#include "h4468.h"
+#include "h6692.h"
+#ifdef X
+#include "h6160.h"
+#endif
+struct S4137 { int a; const char *s = "x//y"; };
+inline int f4137_0(int x) { return x * 0; }
+inline int f4137_1(int x) { return x * 1; }
+inline int f4137_2(int x) { return x * 2; }
+inline int f4137_3(int x) { return x * 3; }
+inline int f4137_4(int x) { return x * 4; }
+inline int f4137_5(int x) { return x * 5; }
+inline int f4137_6(int x) { return x * 6; }
+inline int f4137_7(int x) { return x * 7; }
+inline int f4137_8(int x) { return x * 8; }
+inline int f4137_9(int x) { return x * 9; }
+inline int f4137_10(int x) { return x * 10; }
+inline int f4137_11(int x) { return x * 11; }
+inline int f4137_12(int x) { return x * 12; }
+inline int f4137_13(int x) { return x * 13; }
+inline int f4137_14(int x) { return x * 14; }
+inline int f4137_15(int x) { return x * 15; }
+inline int f4137_16(int x) { return x * 16; }
+inline int f4137_17(int x) { return x * 17; }
+inline int f4137_18(int x) { return x * 18; }
+inline int f4137_19(int x) { return x * 19; }
+inline int f4137_20(int x) { return x * 20; }
+inline int f4137_21(int x) { return x * 21; }
+inline int f4137_22(int x) { return x * 22; }
+inline int f4137_23(int x) { return x * 23; }
+inline int f4137_24(int x) { return x * 24; }
+inline int f4137_25(int x) { return x * 25; }
+inline int f4137_26(int x) { return x * 26; }
+inline int f4137_27(int x) { return x * 27; }
+inline int f4137_28(int x) { return x * 28; }
+inline int f4137_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4138 */
+#include <vector>
+#include "h8065.h"
+#include "h7468.h"
+#include "h5298.h"
+#include "h8576.h"
+#include "h8619.h"
+#ifdef X
+#include "h6107.h"
+#endif
+struct S4138 { int a; const char *s = "x//y"; };
+inline int f4138_0(int x) { return x * 0; }
+inline int f4138_1(int x) { return x * 1; }
+inline int f4138_2(int x) { return x * 2; }
+inline int f4138_3(int x) { return x * 3; }
+inline int f4138_4(int x) { return x * 4; }
+inline int f4138_5(int x) { return x * 5; }
+inline int f4138_6(int x) { return x * 6; }
+inline int f4138_7(int x) { return x * 7; }
+inline int f4138_8(int x) { return x * 8; }
+inline int f4138_9(int x) { return x * 9; }
+inline int f4138_10(int x) { return x * 10; }
+inline int f4138_11(int x) { return x * 11; }
+inline int f4138_12(int x) { return x * 12; }
+inline int f4138_13(int x) { return x * 13; }
+inline int f4138_14(int x) { return x * 14; }
+inline int f4138_15(int x) { return x * 15; }
+inline int f4138_16(int x) { return x * 16; }
+inline int f4138_17(int x) { return x * 17; }
+inline int f4138_18(int x) { return x * 18; }
+inline int f4138_19(int x) { return x * 19; }
+inline int f4138_20(int x) { return x * 20; }
+inline int f4138_21(int x) { return x * 21; }
+inline int f4138_22(int x) { return x * 22; }
+inline int f4138_23(int x) { return x * 23; }
+inline int f4138_24(int x) { return x * 24; }
+inline int f4138_25(int x) { return x * 25; }
+inline int f4138_26(int x) { return x * 26; }
+inline int f4138_27(int x) { return x * 27; }
+inline int f4138_28(int x) { return x * 28; }
+inline int f4138_29(int x) { return x * 29; }
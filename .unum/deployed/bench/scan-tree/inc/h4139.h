@@ -0,0 +1,42 @@
+#pragma once
+/* header 4139 */
+#include <vector>
+#include "h6694.h"
+#include "h286.h"
+#include "h8454.h"
+#include "h5548.h"
+#include "h7295.h"
+#ifdef X
+#include "h1362.h"
+#endif
+struct S4139 { int a; const char *s = "x//y"; };
+inline int f4139_0(int x) { return x * 0; }
+inline int f4139_1(int x) { return x * 1; }
+inline int f4139_2(int x) { return x * 2; }
+inline int f4139_3(int x) { return x * 3; }
+inline int f4139_4(int x) { return x * 4; }
+inline int f4139_5(int x) { return x * 5; }
+inline int f4139_6(int x) { return x * 6; }
+inline int f4139_7(int x) { return x * 7; }
+inline int f4139_8(int x) { return x * 8; }
+inline int f4139_9(int x) { return x * 9; }
+inline int f4139_10(int x) { return x * 10; }
+inline int f4139_11(int x) { return x * 11; }
+inline int f4139_12(int x) { return x * 12; }
+inline int f4139_13(int x) { return x * 13; }
+inline int f4139_14(int x) { return x * 14; }
+inline int f4139_15(int x) { return x * 15; }
+inline int f4139_16(int x) { return x * 16; }
+inline int f4139_17(int x) { return x * 17; }
+inline int f4139_18(int x) { return x * 18; }
+inline int f4139_19(int x) { return x * 19; }
+inline int f4139_20(int x) { return x * 20; }
+inline int f4139_21(int x) { return x * 21; }
+inline int f4139_22(int x) { return x * 22; }
+inline int f4139_23(int x) { return x * 23; }
+inline int f4139_24(int x) { return x * 24; }
+inline int f4139_25(int x) { return x * 25; }
+inline int f4139_26(int x) { return x * 26; }
+inline int f4139_27(int x) { return x * 27; }
+inline int f4139_28(int x) { return x * 28; }
+inline int f4139_29(int x) { return x * 29; }
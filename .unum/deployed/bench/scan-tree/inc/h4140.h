@@ -0,0 +1,42 @@
+#pragma once
+/* header 4140 */
+#include <vector>
+#include "h5380.h"
+#include "h2449.h"
+#include "h5760.h"
+#include "h7306.h"
+#include "h8723.h"
+#ifdef X
+#include "h9814.h"
+#endif
+struct S4140 { int a; const char *s = "x//y"; };
+inline int f4140_0(int x) { return x * 0; }
+inline int f4140_1(int x) { return x * 1; }
+inline int f4140_2(int x) { return x * 2; }
+inline int f4140_3(int x) { return x * 3; }
+inline int f4140_4(int x) { return x * 4; }
+inline int f4140_5(int x) { return x * 5; }
+inline int f4140_6(int x) { return x * 6; }
+inline int f4140_7(int x) { return x * 7; }
+inline int f4140_8(int x) { return x * 8; }
+inline int f4140_9(int x) { return x * 9; }
+inline int f4140_10(int x) { return x * 10; }
+inline int f4140_11(int x) { return x * 11; }
+inline int f4140_12(int x) { return x * 12; }
+inline int f4140_13(int x) { return x * 13; }
+inline int f4140_14(int x) { return x * 14; }
+inline int f4140_15(int x) { return x * 15; }
+inline int f4140_16(int x) { return x * 16; }
+inline int f4140_17(int x) { return x * 17; }
+inline int f4140_18(int x) { return x * 18; }
+inline int f4140_19(int x) { return x * 19; }
+inline int f4140_20(int x) { return x * 20; }
+inline int f4140_21(int x) { return x * 21; }
+inline int f4140_22(int x) { return x * 22; }
+inline int f4140_23(int x) { return x * 23; }
+inline int f4140_24(int x) { return x * 24; }
+inline int f4140_25(int x) { return x * 25; }
+inline int f4140_26(int x) { return x * 26; }
+inline int f4140_27(int x) { return x * 27; }
+inline int f4140_28(int x) { return x * 28; }
+inline int f4140_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4142 */
+#include <vector>
+#include "h1195.h"
+#include "h8984.h"
+#include "h5312.h"
+#include "h2415.h"
+#include "h9290.h"
+#ifdef X
+#include "h952.h"
+#endif
+struct S4142 { int a; const char *s = "x//y"; };
+inline int f4142_0(int x) { return x * 0; }
+inline int f4142_1(int x) { return x * 1; }
+inline int f4142_2(int x) { return x * 2; }
+inline int f4142_3(int x) { return x * 3; }
+inline int f4142_4(int x) { return x * 4; }
+inline int f4142_5(int x) { return x * 5; }
+inline int f4142_6(int x) { return x * 6; }
+inline int f4142_7(int x) { return x * 7; }
+inline int f4142_8(int x) { return x * 8; }
+inline int f4142_9(int x) { return x * 9; }
+inline int f4142_10(int x) { return x * 10; }
+inline int f4142_11(int x) { return x * 11; }
+inline int f4142_12(int x) { return x * 12; }
+inline int f4142_13(int x) { return x * 13; }
+inline int f4142_14(int x) { return x * 14; }
+inline int f4142_15(int x) { return x * 15; }
+inline int f4142_16(int x) { return x * 16; }
+inline int f4142_17(int x) { return x * 17; }
+inline int f4142_18(int x) { return x * 18; }
+inline int f4142_19(int x) { return x * 19; }
+inline int f4142_20(int x) { return x * 20; }
+inline int f4142_21(int x) { return x * 21; }
+inline int f4142_22(int x) { return x * 22; }
+inline int f4142_23(int x) { return x * 23; }
+inline int f4142_24(int x) { return x * 24; }
+inline int f4142_25(int x) { return x * 25; }
+inline int f4142_26(int x) { return x * 26; }
+inline int f4142_27(int x) { return x * 27; }
+inline int f4142_28(int x) { return x * 28; }
+inline int f4142_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4144 */
+#include <vector>
+#include "h8565.h"
+#include "h356.h"
+#include "h9299.h"
+#include "h5476.h"
+#include "h2849.h"
+#ifdef X
+#include "h7581.h"
+#endif
+struct S4144 { int a; const char *s = "x//y"; };
+inline int f4144_0(int x) { return x * 0; }
+inline int f4144_1(int x) { return x * 1; }
+inline int f4144_2(int x) { return x * 2; }
+inline int f4144_3(int x) { return x * 3; }
+inline int f4144_4(int x) { return x * 4; }
+inline int f4144_5(int x) { return x * 5; }
+inline int f4144_6(int x) { return x * 6; }
+inline int f4144_7(int x) { return x * 7; }
+inline int f4144_8(int x) { return x * 8; }
+inline int f4144_9(int x) { return x * 9; }
+inline int f4144_10(int x) { return x * 10; }
+inline int f4144_11(int x) { return x * 11; }
+inline int f4144_12(int x) { return x * 12; }
+inline int f4144_13(int x) { return x * 13; }
+inline int f4144_14(int x) { return x * 14; }
+inline int f4144_15(int x) { return x * 15; }
+inline int f4144_16(int x) { return x * 16; }
+inline int f4144_17(int x) { return x * 17; }
+inline int f4144_18(int x) { return x * 18; }
+inline int f4144_19(int x) { return x * 19; }
+inline int f4144_20(int x) { return x * 20; }
+inline int f4144_21(int x) { return x * 21; }
+inline int f4144_22(int x) { return x * 22; }
+inline int f4144_23(int x) { return x * 23; }
+inline int f4144_24(int x) { return x * 24; }
+inline int f4144_25(int x) { return x * 25; }
+inline int f4144_26(int x) { return x * 26; }
+inline int f4144_27(int x) { return x * 27; }
+inline int f4144_28(int x) { return x * 28; }
+inline int f4144_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4146 */
+#include <vector>
+#include "h9315.h"
+#include "h6076.h"
+#include "h2140.h"
+#include "h7367.h"
+#include "h2478.h"
+#ifdef X
+#include "h2444.h"
+#endif
+struct S4146 { int a; const char *s = "x//y"; };
+inline int f4146_0(int x) { return x * 0; }
+inline int f4146_1(int x) { return x * 1; }
+inline int f4146_2(int x) { return x * 2; }
+inline int f4146_3(int x) { return x * 3; }
+inline int f4146_4(int x) { return x * 4; }
+inline int f4146_5(int x) { return x * 5; }
+inline int f4146_6(int x) { return x * 6; }
+inline int f4146_7(int x) { return x * 7; }
+inline int f4146_8(int x) { return x * 8; }
+inline int f4146_9(int x) { return x * 9; }
+inline int f4146_10(int x) { return x * 10; }
+inline int f4146_11(int x) { return x * 11; }
+inline int f4146_12(int x) { return x * 12; }
+inline int f4146_13(int x) { return x * 13; }
+inline int f4146_14(int x) { return x * 14; }
+inline int f4146_15(int x) { return x * 15; }
+inline int f4146_16(int x) { return x * 16; }
+inline int f4146_17(int x) { return x * 17; }
+inline int f4146_18(int x) { return x * 18; }
+inline int f4146_19(int x) { return x * 19; }
+inline int f4146_20(int x) { return x * 20; }
+inline int f4146_21(int x) { return x * 21; }
+inline int f4146_22(int x) { return x * 22; }
+inline int f4146_23(int x) { return x * 23; }
+inline int f4146_24(int x) { return x * 24; }
+inline int f4146_25(int x) { return x * 25; }
+inline int f4146_26(int x) { return x * 26; }
+inline int f4146_27(int x) { return x * 27; }
+inline int f4146_28(int x) { return x * 28; }
+inline int f4146_29(int x) { return x * 29; }
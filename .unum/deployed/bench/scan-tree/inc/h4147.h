@@ -0,0 +1,42 @@
+#pragma once
+/* header 4147 */
+#include <vector>
+#include "h6526.h"
+#include "h6376.h"
+#include "h8344.h"
+#include "h3720.h"
+#include "h730.h"
+#ifdef X
+#include "h2164.h"
+#endif
+struct S4147 { int a; const char *s = "x//y"; };
+inline int f4147_0(int x) { return x * 0; }
+inline int f4147_1(int x) { return x * 1; }
+inline int f4147_2(int x) { return x * 2; }
+inline int f4147_3(int x) { return x * 3; }
+inline int f4147_4(int x) { return x * 4; }
+inline int f4147_5(int x) { return x * 5; }
+inline int f4147_6(int x) { return x * 6; }
+inline int f4147_7(int x) { return x * 7; }
+inline int f4147_8(int x) { return x * 8; }
+inline int f4147_9(int x) { return x * 9; }
+inline int f4147_10(int x) { return x * 10; }
+inline int f4147_11(int x) { return x * 11; }
+inline int f4147_12(int x) { return x * 12; }
+inline int f4147_13(int x) { return x * 13; }
+inline int f4147_14(int x) { return x * 14; }
+inline int f4147_15(int x) { return x * 15; }
+inline int f4147_16(int x) { return x * 16; }
+inline int f4147_17(int x) { return x * 17; }
+inline int f4147_18(int x) { return x * 18; }
+inline int f4147_19(int x) { return x * 19; }
+inline int f4147_20(int x) { return x * 20; }
+inline int f4147_21(int x) { return x * 21; }
+inline int f4147_22(int x) { return x * 22; }
+inline int f4147_23(int x) { return x * 23; }
+inline int f4147_24(int x) { return x * 24; }
+inline int f4147_25(int x) { return x * 25; }
+inline int f4147_26(int x) { return x * 26; }
+inline int f4147_27(int x) { return x * 27; }
+inline int f4147_28(int x) { return x * 28; }
+inline int f4147_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4150 */
+#include <vector>
+#include "h5644.h"
+#include "h6836.h"
+#include "h5566.h"
+#include "h9820.h"
+#include "h5438.h"
+#ifdef X
+#include "h8392.h"
+#endif
+struct S4150 { int a; const char *s = "x//y"; };
+inline int f4150_0(int x) { return x * 0; }
+inline int f4150_1(int x) { return x * 1; }
+inline int f4150_2(int x) { return x * 2; }
+inline int f4150_3(int x) { return x * 3; }
+inline int f4150_4(int x) { return x * 4; }
+inline int f4150_5(int x) { return x * 5; }
+inline int f4150_6(int x) { return x * 6; }
+inline int f4150_7(int x) { return x * 7; }
+inline int f4150_8(int x) { return x * 8; }
+inline int f4150_9(int x) { return x * 9; }
+inline int f4150_10(int x) { return x * 10; }
+inline int f4150_11(int x) { return x * 11; }
+inline int f4150_12(int x) { return x * 12; }
+inline int f4150_13(int x) { return x * 13; }
+inline int f4150_14(int x) { return x * 14; }
+inline int f4150_15(int x) { return x * 15; }
+inline int f4150_16(int x) { return x * 16; }
+inline int f4150_17(int x) { return x * 17; }
+inline int f4150_18(int x) { return x * 18; }
+inline int f4150_19(int x) { return x * 19; }
+inline int f4150_20(int x) { return x * 20; }
+inline int f4150_21(int x) { return x * 21; }
+inline int f4150_22(int x) { return x * 22; }
+inline int f4150_23(int x) { return x * 23; }
+inline int f4150_24(int x) { return x * 24; }
+inline int f4150_25(int x) { return x * 25; }
+inline int f4150_26(int x) { return x * 26; }
+inline int f4150_27(int x) { return x * 27; }
+inline int f4150_28(int x) { return x * 28; }
+inline int f4150_29(int x) { return x * 29; }
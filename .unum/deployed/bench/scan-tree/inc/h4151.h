@@ -0,0 +1,42 @@
+#pragma once
+/* header 4151 */
+#include <vector>
+#include "h1145.h"
+#include "h517.h"
+#include "h8813.h"
+#include "h7331.h"
+#include "h6578.h"
+#ifdef X
+#include "h518.h"
+#endif
+struct S4151 { int a; const char *s = "x//y"; };
+inline int f4151_0(int x) { return x * 0; }
+inline int f4151_1(int x) { return x * 1; }
+inline int f4151_2(int x) { return x * 2; }
+inline int f4151_3(int x) { return x * 3; }
+inline int f4151_4(int x) { return x * 4; }
+inline int f4151_5(int x) { return x * 5; }
+inline int f4151_6(int x) { return x * 6; }
+inline int f4151_7(int x) { return x * 7; }
+inline int f4151_8(int x) { return x * 8; }
+inline int f4151_9(int x) { return x * 9; }
+inline int f4151_10(int x) { return x * 10; }
+inline int f4151_11(int x) { return x * 11; }
+inline int f4151_12(int x) { return x * 12; }
+inline int f4151_13(int x) { return x * 13; }
+inline int f4151_14(int x) { return x * 14; }
+inline int f4151_15(int x) { return x * 15; }
+inline int f4151_16(int x) { return x * 16; }
+inline int f4151_17(int x) { return x * 17; }
+inline int f4151_18(int x) { return x * 18; }
+inline int f4151_19(int x) { return x * 19; }
+inline int f4151_20(int x) { return x * 20; }
+inline int f4151_21(int x) { return x * 21; }
+inline int f4151_22(int x) { return x * 22; }
+inline int f4151_23(int x) { return x * 23; }
+inline int f4151_24(int x) { return x * 24; }
+inline int f4151_25(int x) { return x * 25; }
+inline int f4151_26(int x) { return x * 26; }
+inline int f4151_27(int x) { return x * 27; }
+inline int f4151_28(int x) { return x * 28; }
+inline int f4151_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4154 */
+#include <vector>
+#include "h479.h"
+#include "h6245.h"
+#include "h5335.h"
+#include "h2975.h"
+#include "h9991.h"
+#ifdef X
+#include "h1604.h"
+#endif
+struct S4154 { int a; const char *s = "x//y"; };
+inline int f4154_0(int x) { return x * 0; }
+inline int f4154_1(int x) { return x * 1; }
+inline int f4154_2(int x) { return x * 2; }
+inline int f4154_3(int x) { return x * 3; }
+inline int f4154_4(int x) { return x * 4; }
+inline int f4154_5(int x) { return x * 5; }
+inline int f4154_6(int x) { return x * 6; }
+inline int f4154_7(int x) { return x * 7; }
+inline int f4154_8(int x) { return x * 8; }
+inline int f4154_9(int x) { return x * 9; }
+inline int f4154_10(int x) { return x * 10; }
+inline int f4154_11(int x) { return x * 11; }
+inline int f4154_12(int x) { return x * 12; }
+inline int f4154_13(int x) { return x * 13; }
+inline int f4154_14(int x) { return x * 14; }
+inline int f4154_15(int x) { return x * 15; }
+inline int f4154_16(int x) { return x * 16; }
+inline int f4154_17(int x) { return x * 17; }
+inline int f4154_18(int x) { return x * 18; }
+inline int f4154_19(int x) { return x * 19; }
+inline int f4154_20(int x) { return x * 20; }
+inline int f4154_21(int x) { return x * 21; }
+inline int f4154_22(int x) { return x * 22; }
+inline int f4154_23(int x) { return x * 23; }
+inline int f4154_24(int x) { return x * 24; }
+inline int f4154_25(int x) { return x * 25; }
+inline int f4154_26(int x) { return x * 26; }
+inline int f4154_27(int x) { return x * 27; }
+inline int f4154_28(int x) { return x * 28; }
+inline int f4154_29(int x) { return x * 29; }
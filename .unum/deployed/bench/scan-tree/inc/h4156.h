@@ -0,0 +1,42 @@
+#pragma once
+/* header 4156 */
+#include <vector>
+#include "h4785.h"
+#include "h4367.h"
+#include "h8280.h"
+#include "h9101.h"
+#include "h6039.h"
+#ifdef X
+#include "h7374.h"
+#endif
+struct S4156 { int a; const char *s = "x//y"; };
+inline int f4156_0(int x) { return x * 0; }
+inline int f4156_1(int x) { return x * 1; }
+inline int f4156_2(int x) { return x * 2; }
+inline int f4156_3(int x) { return x * 3; }
+inline int f4156_4(int x) { return x * 4; }
+inline int f4156_5(int x) { return x * 5; }
+inline int f4156_6(int x) { return x * 6; }
+inline int f4156_7(int x) { return x * 7; }
+inline int f4156_8(int x) { return x * 8; }
+inline int f4156_9(int x) { return x * 9; }
+inline int f4156_10(int x) { return x * 10; }
+inline int f4156_11(int x) { return x * 11; }
+inline int f4156_12(int x) { return x * 12; }
+inline int f4156_13(int x) { return x * 13; }
+inline int f4156_14(int x) { return x * 14; }
+inline int f4156_15(int x) { return x * 15; }
+inline int f4156_16(int x) { return x * 16; }
+inline int f4156_17(int x) { return x * 17; }
+inline int f4156_18(int x) { return x * 18; }
+inline int f4156_19(int x) { return x * 19; }
+inline int f4156_20(int x) { return x * 20; }
+inline int f4156_21(int x) { return x * 21; }
+inline int f4156_22(int x) { return x * 22; }
+inline int f4156_23(int x) { return x * 23; }
+inline int f4156_24(int x) { return x * 24; }
+inline int f4156_25(int x) { return x * 25; }
+inline int f4156_26(int x) { return x * 26; }
+inline int f4156_27(int x) { return x * 27; }
+inline int f4156_28(int x) { return x * 28; }
+inline int f4156_29(int x) { return x * 29; }
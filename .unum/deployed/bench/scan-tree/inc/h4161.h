@@ -0,0 +1,42 @@
+#pragma once
+/* header 4161 */
+#include <vector>
+#include "h6149.h"
+#include "h1813.h"
+#include "h6671.h"
+#include "h8862.h"
+#include "h149.h"
+#ifdef X
+#include "h2321.h"
+#endif
+struct S4161 { int a; const char *s = "x//y"; };
+inline int f4161_0(int x) { return x * 0; }
+inline int f4161_1(int x) { return x * 1; }
+inline int f4161_2(int x) { return x * 2; }
+inline int f4161_3(int x) { return x * 3; }
+inline int f4161_4(int x) { return x * 4; }
+inline int f4161_5(int x) { return x * 5; }
+inline int f4161_6(int x) { return x * 6; }
+inline int f4161_7(int x) { return x * 7; }
+inline int f4161_8(int x) { return x * 8; }
+inline int f4161_9(int x) { return x * 9; }
+inline int f4161_10(int x) { return x * 10; }
+inline int f4161_11(int x) { return x * 11; }
+inline int f4161_12(int x) { return x * 12; }
+inline int f4161_13(int x) { return x * 13; }
+inline int f4161_14(int x) { return x * 14; }
+inline int f4161_15(int x) { return x * 15; }
+inline int f4161_16(int x) { return x * 16; }
+inline int f4161_17(int x) { return x * 17; }
+inline int f4161_18(int x) { return x * 18; }
+inline int f4161_19(int x) { return x * 19; }
+inline int f4161_20(int x) { return x * 20; }
+inline int f4161_21(int x) { return x * 21; }
+inline int f4161_22(int x) { return x * 22; }
+inline int f4161_23(int x) { return x * 23; }
+inline int f4161_24(int x) { return x * 24; }
+inline int f4161_25(int x) { return x * 25; }
+inline int f4161_26(int x) { return x * 26; }
+inline int f4161_27(int x) { return x * 27; }
+inline int f4161_28(int x) { return x * 28; }
+inline int f4161_29(int x) { return x * 29; }
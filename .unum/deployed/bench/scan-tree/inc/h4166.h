@@ -0,0 +1,42 @@
+#pragma once
+/* header 4166 */
+#include <vector>
+#include "h7177.h"
+#include "h2669.h"
+#include "h8477.h"
+#include "h9981.h"
+#include "h6048.h"
+#ifdef X
+#include "h301.h"
+#endif
+struct S4166 { int a; const char *s = "x//y"; };
+inline int f4166_0(int x) { return x * 0; }
+inline int f4166_1(int x) { return x * 1; }
+inline int f4166_2(int x) { return x * 2; }
+inline int f4166_3(int x) { return x * 3; }
+inline int f4166_4(int x) { return x * 4; }
+inline int f4166_5(int x) { return x * 5; }
+inline int f4166_6(int x) { return x * 6; }
+inline int f4166_7(int x) { return x * 7; }
+inline int f4166_8(int x) { return x * 8; }
+inline int f4166_9(int x) { return x * 9; }
+inline int f4166_10(int x) { return x * 10; }
+inline int f4166_11(int x) { return x * 11; }
+inline int f4166_12(int x) { return x * 12; }
+inline int f4166_13(int x) { return x * 13; }
+inline int f4166_14(int x) { return x * 14; }
+inline int f4166_15(int x) { return x * 15; }
+inline int f4166_16(int x) { return x * 16; }
+inline int f4166_17(int x) { return x * 17; }
+inline int f4166_18(int x) { return x * 18; }
+inline int f4166_19(int x) { return x * 19; }
+inline int f4166_20(int x) { return x * 20; }
+inline int f4166_21(int x) { return x * 21; }
+inline int f4166_22(int x) { return x * 22; }
+inline int f4166_23(int x) { return x * 23; }
+inline int f4166_24(int x) { return x * 24; }
+inline int f4166_25(int x) { return x * 25; }
+inline int f4166_26(int x) { return x * 26; }
+inline int f4166_27(int x) { return x * 27; }
+inline int f4166_28(int x) { return x * 28; }
+inline int f4166_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4167 */
+#include <vector>
+#include "h8970.h"
+#include "h5455.h"
+#include "h2227.h"
+#include "h3513.h"
+#include "h2705.h"
+#ifdef X
+#include "h5649.h"
+#endif
+struct S4167 { int a; const char *s = "x//y"; };
+inline int f4167_0(int x) { return x * 0; }
+inline int f4167_1(int x) { return x * 1; }
+inline int f4167_2(int x) { return x * 2; }
+inline int f4167_3(int x) { return x * 3; }
+inline int f4167_4(int x) { return x * 4; }
+inline int f4167_5(int x) { return x * 5; }
+inline int f4167_6(int x) { return x * 6; }
+inline int f4167_7(int x) { return x * 7; }
+inline int f4167_8(int x) { return x * 8; }
+inline int f4167_9(int x) { return x * 9; }
+inline int f4167_10(int x) { return x * 10; }
+inline int f4167_11(int x) { return x * 11; }
+inline int f4167_12(int x) { return x * 12; }
+inline int f4167_13(int x) { return x * 13; }
+inline int f4167_14(int x) { return x * 14; }
+inline int f4167_15(int x) { return x * 15; }
+inline int f4167_16(int x) { return x * 16; }
+inline int f4167_17(int x) { return x * 17; }
+inline int f4167_18(int x) { return x * 18; }
+inline int f4167_19(int x) { return x * 19; }
+inline int f4167_20(int x) { return x * 20; }
+inline int f4167_21(int x) { return x * 21; }
+inline int f4167_22(int x) { return x * 22; }
+inline int f4167_23(int x) { return x * 23; }
+inline int f4167_24(int x) { return x * 24; }
+inline int f4167_25(int x) { return x * 25; }
+inline int f4167_26(int x) { return x * 26; }
+inline int f4167_27(int x) { return x * 27; }
+inline int f4167_28(int x) { return x * 28; }
+inline int f4167_29(int x) { return x * 29; }
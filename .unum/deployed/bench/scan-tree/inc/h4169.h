@@ -0,0 +1,42 @@
+#pragma once
+/* header 4169 */
+#include <vector>
+#include "h163.h"
+#include "h9863.h"
+#include "h4808.h"
+#include "h1032.h"
+#include "h2695.h"
+#ifdef X
+#include "h8236.h"
+#endif
+struct S4169 { int a; const char *s = "x//y"; };
+inline int f4169_0(int x) { return x * 0; }
+inline int f4169_1(int x) { return x * 1; }
+inline int f4169_2(int x) { return x * 2; }
+inline int f4169_3(int x) { return x * 3; }
+inline int f4169_4(int x) { return x * 4; }
+inline int f4169_5(int x) { return x * 5; }
+inline int f4169_6(int x) { return x * 6; }
+inline int f4169_7(int x) { return x * 7; }
+inline int f4169_8(int x) { return x * 8; }
+inline int f4169_9(int x) { return x * 9; }
+inline int f4169_10(int x) { return x * 10; }
+inline int f4169_11(int x) { return x * 11; }
+inline int f4169_12(int x) { return x * 12; }
+inline int f4169_13(int x) { return x * 13; }
+inline int f4169_14(int x) { return x * 14; }
+inline int f4169_15(int x) { return x * 15; }
+inline int f4169_16(int x) { return x * 16; }
+inline int f4169_17(int x) { return x * 17; }
+inline int f4169_18(int x) { return x * 18; }
+inline int f4169_19(int x) { return x * 19; }
+inline int f4169_20(int x) { return x * 20; }
+inline int f4169_21(int x) { return x * 21; }
+inline int f4169_22(int x) { return x * 22; }
+inline int f4169_23(int x) { return x * 23; }
+inline int f4169_24(int x) { return x * 24; }
+inline int f4169_25(int x) { return x * 25; }
+inline int f4169_26(int x) { return x * 26; }
+inline int f4169_27(int x) { return x * 27; }
+inline int f4169_28(int x) { return x * 28; }
+inline int f4169_29(int x) { return x * 29; }
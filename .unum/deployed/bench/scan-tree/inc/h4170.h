@@ -0,0 +1,42 @@
+#pragma once
+/* header 4170 */
+#include <vector>
+#include "h9298.h"
+#include "h3523.h"
+#include "h9642.h"
+#include "h6373.h"
+#include "h8302.h"
+#ifdef X
+#include "h9575.h"
+#endif
+struct S4170 { int a; const char *s = "x//y"; };
+inline int f4170_0(int x) { return x * 0; }
+inline int f4170_1(int x) { return x * 1; }
+inline int f4170_2(int x) { return x * 2; }
+inline int f4170_3(int x) { return x * 3; }
+inline int f4170_4(int x) { return x * 4; }
+inline int f4170_5(int x) { return x * 5; }
+inline int f4170_6(int x) { return x * 6; }
+inline int f4170_7(int x) { return x * 7; }
+inline int f4170_8(int x) { return x * 8; }
+inline int f4170_9(int x) { return x * 9; }
+inline int f4170_10(int x) { return x * 10; }
+inline int f4170_11(int x) { return x * 11; }
+inline int f4170_12(int x) { return x * 12; }
+inline int f4170_13(int x) { return x * 13; }
+inline int f4170_14(int x) { return x * 14; }
+inline int f4170_15(int x) { return x * 15; }
+inline int f4170_16(int x) { return x * 16; }
+inline int f4170_17(int x) { return x * 17; }
+inline int f4170_18(int x) { return x * 18; }
+inline int f4170_19(int x) { return x * 19; }
+inline int f4170_20(int x) { return x * 20; }
+inline int f4170_21(int x) { return x * 21; }
+inline int f4170_22(int x) { return x * 22; }
+inline int f4170_23(int x) { return x * 23; }
+inline int f4170_24(int x) { return x * 24; }
+inline int f4170_25(int x) { return x * 25; }
+inline int f4170_26(int x) { return x * 26; }
+inline int f4170_27(int x) { return x * 27; }
+inline int f4170_28(int x) { return x * 28; }
+inline int f4170_29(int x) { return x * 29; }
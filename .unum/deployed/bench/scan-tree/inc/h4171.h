@@ -0,0 +1,42 @@
+#pragma once
+/* header 4171 */
+#include <vector>
+#include "h8984.h"
+#include "h5005.h"
+#include "h3028.h"
+#include "h7611.h"
+#include "h9566.h"
+#ifdef X
+#include "h1871.h"
+#endif
+struct S4171 { int a; const char *s = "x//y"; };
+inline int f4171_0(int x) { return x * 0; }
+inline int f4171_1(int x) { return x * 1; }
+inline int f4171_2(int x) { return x * 2; }
+inline int f4171_3(int x) { return x * 3; }
+inline int f4171_4(int x) { return x * 4; }
+inline int f4171_5(int x) { return x * 5; }
+inline int f4171_6(int x) { return x * 6; }
+inline int f4171_7(int x) { return x * 7; }
+inline int f4171_8(int x) { return x * 8; }
+inline int f4171_9(int x) { return x * 9; }
+inline int f4171_10(int x) { return x * 10; }
+inline int f4171_11(int x) { return x * 11; }
+inline int f4171_12(int x) { return x * 12; }
+inline int f4171_13(int x) { return x * 13; }
+inline int f4171_14(int x) { return x * 14; }
+inline int f4171_15(int x) { return x * 15; }
+inline int f4171_16(int x) { return x * 16; }
+inline int f4171_17(int x) { return x * 17; }
+inline int f4171_18(int x) { return x * 18; }
+inline int f4171_19(int x) { return x * 19; }
+inline int f4171_20(int x) { return x * 20; }
+inline int f4171_21(int x) { return x * 21; }
+inline int f4171_22(int x) { return x * 22; }
+inline int f4171_23(int x) { return x * 23; }
+inline int f4171_24(int x) { return x * 24; }
+inline int f4171_25(int x) { return x * 25; }
+inline int f4171_26(int x) { return x * 26; }
+inline int f4171_27(int x) { return x * 27; }
+inline int f4171_28(int x) { return x * 28; }
+inline int f4171_29(int x) { return x * 29; }
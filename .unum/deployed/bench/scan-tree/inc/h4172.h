@@ -0,0 +1,42 @@
+#pragma once
+/* header 4172 */
+#include <vector>
+#include "h1218.h"
+#include "h2900.h"
+#include "h9112.h"
+#include "h1998.h"
+#include "h1714.h"
+#ifdef X
+#include "h1165.h"
+#endif
+struct S4172 { int a; const char *s = "x//y"; };
+inline int f4172_0(int x) { return x * 0; }
+inline int f4172_1(int x) { return x * 1; }
+inline int f4172_2(int x) { return x * 2; }
+inline int f4172_3(int x) { return x * 3; }
+inline int f4172_4(int x) { return x * 4; }
+inline int f4172_5(int x) { return x * 5; }
+inline int f4172_6(int x) { return x * 6; }
+inline int f4172_7(int x) { return x * 7; }
+inline int f4172_8(int x) { return x * 8; }
+inline int f4172_9(int x) { return x * 9; }
+inline int f4172_10(int x) { return x * 10; }
+inline int f4172_11(int x) { return x * 11; }
+inline int f4172_12(int x) { return x * 12; }
+inline int f4172_13(int x) { return x * 13; }
+inline int f4172_14(int x) { return x * 14; }
+inline int f4172_15(int x) { return x * 15; }
+inline int f4172_16(int x) { return x * 16; }
+inline int f4172_17(int x) { return x * 17; }
+inline int f4172_18(int x) { return x * 18; }
+inline int f4172_19(int x) { return x * 19; }
+inline int f4172_20(int x) { return x * 20; }
+inline int f4172_21(int x) { return x * 21; }
+inline int f4172_22(int x) { return x * 22; }
+inline int f4172_23(int x) { return x * 23; }
+inline int f4172_24(int x) { return x * 24; }
+inline int f4172_25(int x) { return x * 25; }
+inline int f4172_26(int x) { return x * 26; }
+inline int f4172_27(int x) { return x * 27; }
+inline int f4172_28(int x) { return x * 28; }
+inline int f4172_29(int x) { return x * 29; }
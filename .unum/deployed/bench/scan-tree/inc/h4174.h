@@ -0,0 +1,42 @@
+#pragma once
+/* header 4174 */
+#include <vector>
+#include "h1464.h"
+#include "h4261.h"
+#include "h7683.h"
+#include "h9762.h"
+#include "h7202.h"
+#ifdef X
+#include "h2069.h"
+#endif
+struct S4174 { int a; const char *s = "x//y"; };
+inline int f4174_0(int x) { return x * 0; }
+inline int f4174_1(int x) { return x * 1; }
+inline int f4174_2(int x) { return x * 2; }
+inline int f4174_3(int x) { return x * 3; }
+inline int f4174_4(int x) { return x * 4; }
+inline int f4174_5(int x) { return x * 5; }
+inline int f4174_6(int x) { return x * 6; }
+inline int f4174_7(int x) { return x * 7; }
+inline int f4174_8(int x) { return x * 8; }
+inline int f4174_9(int x) { return x * 9; }
+inline int f4174_10(int x) { return x * 10; }
+inline int f4174_11(int x) { return x * 11; }
+inline int f4174_12(int x) { return x * 12; }
+inline int f4174_13(int x) { return x * 13; }
+inline int f4174_14(int x) { return x * 14; }
+inline int f4174_15(int x) { return x * 15; }
+inline int f4174_16(int x) { return x * 16; }
+inline int f4174_17(int x) { return x * 17; }
+inline int f4174_18(int x) { return x * 18; }
+inline int f4174_19(int x) { return x * 19; }
+inline int f4174_20(int x) { return x * 20; }
+inline int f4174_21(int x) { return x * 21; }
+inline int f4174_22(int x) { return x * 22; }
+inline int f4174_23(int x) { return x * 23; }
+inline int f4174_24(int x) { return x * 24; }
+inline int f4174_25(int x) { return x * 25; }
+inline int f4174_26(int x) { return x * 26; }
+inline int f4174_27(int x) { return x * 27; }
+inline int f4174_28(int x) { return x * 28; }
+inline int f4174_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4175 */
+#include <vector>
+#include "h4011.h"
+#include "h5607.h"
+#include "h5180.h"
+#include "h200.h"
+#include "h8408.h"
+#ifdef X
+#include "h2916.h"
+#endif
+struct S4175 { int a; const char *s = "x//y"; };
+inline int f4175_0(int x) { return x * 0; }
+inline int f4175_1(int x) { return x * 1; }
+inline int f4175_2(int x) { return x * 2; }
+inline int f4175_3(int x) { return x * 3; }
+inline int f4175_4(int x) { return x * 4; }
+inline int f4175_5(int x) { return x * 5; }
+inline int f4175_6(int x) { return x * 6; }
+inline int f4175_7(int x) { return x * 7; }
+inline int f4175_8(int x) { return x * 8; }
+inline int f4175_9(int x) { return x * 9; }
+inline int f4175_10(int x) { return x * 10; }
+inline int f4175_11(int x) { return x * 11; }
+inline int f4175_12(int x) { return x * 12; }
+inline int f4175_13(int x) { return x * 13; }
+inline int f4175_14(int x) { return x * 14; }
+inline int f4175_15(int x) { return x * 15; }
+inline int f4175_16(int x) { return x * 16; }
+inline int f4175_17(int x) { return x * 17; }
+inline int f4175_18(int x) { return x * 18; }
+inline int f4175_19(int x) { return x * 19; }
+inline int f4175_20(int x) { return x * 20; }
+inline int f4175_21(int x) { return x * 21; }
+inline int f4175_22(int x) { return x * 22; }
+inline int f4175_23(int x) { return x * 23; }
+inline int f4175_24(int x) { return x * 24; }
+inline int f4175_25(int x) { return x * 25; }
+inline int f4175_26(int x) { return x * 26; }
+inline int f4175_27(int x) { return x * 27; }
+inline int f4175_28(int x) { return x * 28; }
+inline int f4175_29(int x) { return x * 29; }
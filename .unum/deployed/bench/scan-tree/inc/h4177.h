@@ -0,0 +1,42 @@
+#pragma once
+/* header 4177 */
+#include <vector>
+#include "h4943.h"
+#include "h6462.h"
+#include "h8423.h"
+#include "h8932.h"
+#include "h9781.h"
+#ifdef X
+#include "h509.h"
+#endif
+struct S4177 { int a; const char *s = "x//y"; };
+inline int f4177_0(int x) { return x * 0; }
+inline int f4177_1(int x) { return x * 1; }
+inline int f4177_2(int x) { return x * 2; }
+inline int f4177_3(int x) { return x * 3; }
+inline int f4177_4(int x) { return x * 4; }
+inline int f4177_5(int x) { return x * 5; }
+inline int f4177_6(int x) { return x * 6; }
+inline int f4177_7(int x) { return x * 7; }
+inline int f4177_8(int x) { return x * 8; }
+inline int f4177_9(int x) { return x * 9; }
+inline int f4177_10(int x) { return x * 10; }
+inline int f4177_11(int x) { return x * 11; }
+inline int f4177_12(int x) { return x * 12; }
+inline int f4177_13(int x) { return x * 13; }
+inline int f4177_14(int x) { return x * 14; }
+inline int f4177_15(int x) { return x * 15; }
+inline int f4177_16(int x) { return x * 16; }
+inline int f4177_17(int x) { return x * 17; }
+inline int f4177_18(int x) { return x * 18; }
+inline int f4177_19(int x) { return x * 19; }
+inline int f4177_20(int x) { return x * 20; }
+inline int f4177_21(int x) { return x * 21; }
+inline int f4177_22(int x) { return x * 22; }
+inline int f4177_23(int x) { return x * 23; }
+inline int f4177_24(int x) { return x * 24; }
+inline int f4177_25(int x) { return x * 25; }
+inline int f4177_26(int x) { return x * 26; }
+inline int f4177_27(int x) { return x * 27; }
+inline int f4177_28(int x) { return x * 28; }
+inline int f4177_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4178 */
+#include <vector>
+#include "h5191.h"
+#include "h497.h"
+#include "h9895.h"
+#include "h6349.h"
+#include "h1578.h"
+#ifdef X
+#include "h3565.h"
+#endif
+struct S4178 { int a; const char *s = "x//y"; };
+inline int f4178_0(int x) { return x * 0; }
+inline int f4178_1(int x) { return x * 1; }
+inline int f4178_2(int x) { return x * 2; }
+inline int f4178_3(int x) { return x * 3; }
+inline int f4178_4(int x) { return x * 4; }
+inline int f4178_5(int x) { return x * 5; }
+inline int f4178_6(int x) { return x * 6; }
+inline int f4178_7(int x) { return x * 7; }
+inline int f4178_8(int x) { return x * 8; }
+inline int f4178_9(int x) { return x * 9; }
+inline int f4178_10(int x) { return x * 10; }
+inline int f4178_11(int x) { return x * 11; }
+inline int f4178_12(int x) { return x * 12; }
+inline int f4178_13(int x) { return x * 13; }
+inline int f4178_14(int x) { return x * 14; }
+inline int f4178_15(int x) { return x * 15; }
+inline int f4178_16(int x) { return x * 16; }
+inline int f4178_17(int x) { return x * 17; }
+inline int f4178_18(int x) { return x * 18; }
+inline int f4178_19(int x) { return x * 19; }
+inline int f4178_20(int x) { return x * 20; }
+inline int f4178_21(int x) { return x * 21; }
+inline int f4178_22(int x) { return x * 22; }
+inline int f4178_23(int x) { return x * 23; }
+inline int f4178_24(int x) { return x * 24; }
+inline int f4178_25(int x) { return x * 25; }
+inline int f4178_26(int x) { return x * 26; }
+inline int f4178_27(int x) { return x * 27; }
+inline int f4178_28(int x) { return x * 28; }
+inline int f4178_29(int x) { return x * 29; }
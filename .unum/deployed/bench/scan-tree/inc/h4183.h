@@ -0,0 +1,42 @@
+#pragma once
+/* header 4183 */
+#include <vector>
+#include "h1063.h"
+#include "h8810.h"
+#include "h7927.h"
+#include "h7133.h"
+#include "h3503.h"
+#ifdef X
+#include "h7808.h"
+#endif
+struct S4183 { int a; const char *s = "x//y"; };
+inline int f4183_0(int x) { return x * 0; }
+inline int f4183_1(int x) { return x * 1; }
+inline int f4183_2(int x) { return x * 2; }
+inline int f4183_3(int x) { return x * 3; }
+inline int f4183_4(int x) { return x * 4; }
+inline int f4183_5(int x) { return x * 5; }
+inline int f4183_6(int x) { return x * 6; }
+inline int f4183_7(int x) { return x * 7; }
+inline int f4183_8(int x) { return x * 8; }
+inline int f4183_9(int x) { return x * 9; }
+inline int f4183_10(int x) { return x * 10; }
+inline int f4183_11(int x) { return x * 11; }
+inline int f4183_12(int x) { return x * 12; }
+inline int f4183_13(int x) { return x * 13; }
+inline int f4183_14(int x) { return x * 14; }
+inline int f4183_15(int x) { return x * 15; }
+inline int f4183_16(int x) { return x * 16; }
+inline int f4183_17(int x) { return x * 17; }
+inline int f4183_18(int x) { return x * 18; }
+inline int f4183_19(int x) { return x * 19; }
+inline int f4183_20(int x) { return x * 20; }
+inline int f4183_21(int x) { return x * 21; }
+inline int f4183_22(int x) { return x * 22; }
+inline int f4183_23(int x) { return x * 23; }
+inline int f4183_24(int x) { return x * 24; }
+inline int f4183_25(int x) { return x * 25; }
+inline int f4183_26(int x) { return x * 26; }
+inline int f4183_27(int x) { return x * 27; }
+inline int f4183_28(int x) { return x * 28; }
+inline int f4183_29(int x) { return x * 29; }
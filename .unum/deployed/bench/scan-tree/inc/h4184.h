@@ -0,0 +1,42 @@
+#pragma once
+/* header 4184 */
+#include <vector>
+#include "h9796.h"
+#include "h8180.h"
+#include "h9032.h"
+#include "h456.h"
+#include "h1237.h"
+#ifdef X
+#include "h5629.h"
+#endif
+struct S4184 { int a; const char *s = "x//y"; };
+inline int f4184_0(int x) { return x * 0; }
+inline int f4184_1(int x) { return x * 1; }
+inline int f4184_2(int x) { return x * 2; }
+inline int f4184_3(int x) { return x * 3; }
+inline int f4184_4(int x) { return x * 4; }
+inline int f4184_5(int x) { return x * 5; }
+inline int f4184_6(int x) { return x * 6; }
+inline int f4184_7(int x) { return x * 7; }
+inline int f4184_8(int x) { return x * 8; }
+inline int f4184_9(int x) { return x * 9; }
+inline int f4184_10(int x) { return x * 10; }
+inline int f4184_11(int x) { return x * 11; }
+inline int f4184_12(int x) { return x * 12; }
+inline int f4184_13(int x) { return x * 13; }
+inline int f4184_14(int x) { return x * 14; }
+inline int f4184_15(int x) { return x * 15; }
+inline int f4184_16(int x) { return x * 16; }
+inline int f4184_17(int x) { return x * 17; }
+inline int f4184_18(int x) { return x * 18; }
+inline int f4184_19(int x) { return x * 19; }
+inline int f4184_20(int x) { return x * 20; }
+inline int f4184_21(int x) { return x * 21; }
+inline int f4184_22(int x) { return x * 22; }
+inline int f4184_23(int x) { return x * 23; }
+inline int f4184_24(int x) { return x * 24; }
+inline int f4184_25(int x) { return x * 25; }
+inline int f4184_26(int x) { return x * 26; }
+inline int f4184_27(int x) { return x * 27; }
+inline int f4184_28(int x) { return x * 28; }
+inline int f4184_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4186 */
+#include <vector>
+#include "h6206.h"
+#include "h6636.h"
+#include "h1090.h"
+#include "h5399.h"
+#include "h1412.h"
+#ifdef X
+#include "h2632.h"
+#endif
+struct S4186 { int a; const char *s = "x//y"; };
+inline int f4186_0(int x) { return x * 0; }
+inline int f4186_1(int x) { return x * 1; }
+inline int f4186_2(int x) { return x * 2; }
+inline int f4186_3(int x) { return x * 3; }
+inline int f4186_4(int x) { return x * 4; }
+inline int f4186_5(int x) { return x * 5; }
+inline int f4186_6(int x) { return x * 6; }
+inline int f4186_7(int x) { return x * 7; }
+inline int f4186_8(int x) { return x * 8; }
+inline int f4186_9(int x) { return x * 9; }
+inline int f4186_10(int x) { return x * 10; }
+inline int f4186_11(int x) { return x * 11; }
+inline int f4186_12(int x) { return x * 12; }
+inline int f4186_13(int x) { return x * 13; }
+inline int f4186_14(int x) { return x * 14; }
+inline int f4186_15(int x) { return x * 15; }
+inline int f4186_16(int x) { return x * 16; }
+inline int f4186_17(int x) { return x * 17; }
+inline int f4186_18(int x) { return x * 18; }
+inline int f4186_19(int x) { return x * 19; }
+inline int f4186_20(int x) { return x * 20; }
+inline int f4186_21(int x) { return x * 21; }
+inline int f4186_22(int x) { return x * 22; }
+inline int f4186_23(int x) { return x * 23; }
+inline int f4186_24(int x) { return x * 24; }
+inline int f4186_25(int x) { return x * 25; }
+inline int f4186_26(int x) { return x * 26; }
+inline int f4186_27(int x) { return x * 27; }
+inline int f4186_28(int x) { return x * 28; }
+inline int f4186_29(int x) { return x * 29; }
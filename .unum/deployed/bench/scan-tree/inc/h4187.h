@@ -0,0 +1,42 @@
+#pragma once
+/* header 4187 */
+#include <vector>
+#include "h9374.h"
+#include "h5591.h"
+#include "h8107.h"
+#include "h4823.h"
+#include "h353.h"
+#ifdef X
+#include "h8059.h"
+#endif
+struct S4187 { int a; const char *s = "x//y"; };
+inline int f4187_0(int x) { return x * 0; }
+inline int f4187_1(int x) { return x * 1; }
+inline int f4187_2(int x) { return x * 2; }
+inline int f4187_3(int x) { return x * 3; }
+inline int f4187_4(int x) { return x * 4; }
+inline int f4187_5(int x) { return x * 5; }
+inline int f4187_6(int x) { return x * 6; }
+inline int f4187_7(int x) { return x * 7; }
+inline int f4187_8(int x) { return x * 8; }
+inline int f4187_9(int x) { return x * 9; }
+inline int f4187_10(int x) { return x * 10; }
+inline int f4187_11(int x) { return x * 11; }
+inline int f4187_12(int x) { return x * 12; }
+inline int f4187_13(int x) { return x * 13; }
+inline int f4187_14(int x) { return x * 14; }
+inline int f4187_15(int x) { return x * 15; }
+inline int f4187_16(int x) { return x * 16; }
+inline int f4187_17(int x) { return x * 17; }
+inline int f4187_18(int x) { return x * 18; }
+inline int f4187_19(int x) { return x * 19; }
+inline int f4187_20(int x) { return x * 20; }
+inline int f4187_21(int x) { return x * 21; }
+inline int f4187_22(int x) { return x * 22; }
+inline int f4187_23(int x) { return x * 23; }
+inline int f4187_24(int x) { return x * 24; }
+inline int f4187_25(int x) { return x * 25; }
+inline int f4187_26(int x) { return x * 26; }
+inline int f4187_27(int x) { return x * 27; }
+inline int f4187_28(int x) { return x * 28; }
+inline int f4187_29(int x) { return x * 29; }
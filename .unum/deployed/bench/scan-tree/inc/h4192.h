@@ -0,0 +1,42 @@
+#pragma once
+/* header 4192 */
+#include <vector>
+#include "h109.h"
+#include "h6736.h"
+#include "h1353.h"
+#include "h7544.h"
+#include "h1800.h"
+#ifdef X
+#include "h256.h"
+#endif
+struct S4192 { int a; const char *s = "x//y"; };
+inline int f4192_0(int x) { return x * 0; }
+inline int f4192_1(int x) { return x * 1; }
+inline int f4192_2(int x) { return x * 2; }
+inline int f4192_3(int x) { return x * 3; }
+inline int f4192_4(int x) { return x * 4; }
+inline int f4192_5(int x) { return x * 5; }
+inline int f4192_6(int x) { return x * 6; }
+inline int f4192_7(int x) { return x * 7; }
+inline int f4192_8(int x) { return x * 8; }
+inline int f4192_9(int x) { return x * 9; }
+inline int f4192_10(int x) { return x * 10; }
+inline int f4192_11(int x) { return x * 11; }
+inline int f4192_12(int x) { return x * 12; }
+inline int f4192_13(int x) { return x * 13; }
+inline int f4192_14(int x) { return x * 14; }
+inline int f4192_15(int x) { return x * 15; }
+inline int f4192_16(int x) { return x * 16; }
+inline int f4192_17(int x) { return x * 17; }
+inline int f4192_18(int x) { return x * 18; }
+inline int f4192_19(int x) { return x * 19; }
+inline int f4192_20(int x) { return x * 20; }
+inline int f4192_21(int x) { return x * 21; }
+inline int f4192_22(int x) { return x * 22; }
+inline int f4192_23(int x) { return x * 23; }
+inline int f4192_24(int x) { return x * 24; }
+inline int f4192_25(int x) { return x * 25; }
+inline int f4192_26(int x) { return x * 26; }
+inline int f4192_27(int x) { return x * 27; }
+inline int f4192_28(int x) { return x * 28; }
+inline int f4192_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4194 */
+#include <vector>
+#include "h260.h"
+#include "h2311.h"
+#include "h2952.h"
+#include "h2152.h"
+#include "h4325.h"
+#ifdef X
+#include "h5295.h"
+#endif
+struct S4194 { int a; const char *s = "x//y"; };
+inline int f4194_0(int x) { return x * 0; }
+inline int f4194_1(int x) { return x * 1; }
+inline int f4194_2(int x) { return x * 2; }
+inline int f4194_3(int x) { return x * 3; }
+inline int f4194_4(int x) { return x * 4; }
+inline int f4194_5(int x) { return x * 5; }
+inline int f4194_6(int x) { return x * 6; }
+inline int f4194_7(int x) { return x * 7; }
+inline int f4194_8(int x) { return x * 8; }
+inline int f4194_9(int x) { return x * 9; }
+inline int f4194_10(int x) { return x * 10; }
+inline int f4194_11(int x) { return x * 11; }
+inline int f4194_12(int x) { return x * 12; }
+inline int f4194_13(int x) { return x * 13; }
+inline int f4194_14(int x) { return x * 14; }
+inline int f4194_15(int x) { return x * 15; }
+inline int f4194_16(int x) { return x * 16; }
+inline int f4194_17(int x) { return x * 17; }
+inline int f4194_18(int x) { return x * 18; }
+inline int f4194_19(int x) { return x * 19; }
+inline int f4194_20(int x) { return x * 20; }
+inline int f4194_21(int x) { return x * 21; }
+inline int f4194_22(int x) { return x * 22; }
+inline int f4194_23(int x) { return x * 23; }
+inline int f4194_24(int x) { return x * 24; }
+inline int f4194_25(int x) { return x * 25; }
+inline int f4194_26(int x) { return x * 26; }
+inline int f4194_27(int x) { return x * 27; }
+inline int f4194_28(int x) { return x * 28; }
+inline int f4194_29(int x) { return x * 29; }
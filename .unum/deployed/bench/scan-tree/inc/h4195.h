@@ -0,0 +1,42 @@
+#pragma once
+/* header 4195 */
+#include <vector>
+#include "h7746.h"
+#include "h7113.h"
+#include "h2627.h"
+#include "h9277.h"
+#include "h9297.h"
+#ifdef X
+#include "h5467.h"
+#endif
+struct S4195 { int a; const char *s = "x//y"; };
+inline int f4195_0(int x) { return x * 0; }
+inline int f4195_1(int x) { return x * 1; }
+inline int f4195_2(int x) { return x * 2; }
+inline int f4195_3(int x) { return x * 3; }
+inline int f4195_4(int x) { return x * 4; }
+inline int f4195_5(int x) { return x * 5; }
+inline int f4195_6(int x) { return x * 6; }
+inline int f4195_7(int x) { return x * 7; }
+inline int f4195_8(int x) { return x * 8; }
+inline int f4195_9(int x) { return x * 9; }
+inline int f4195_10(int x) { return x * 10; }
+inline int f4195_11(int x) { return x * 11; }
+inline int f4195_12(int x) { return x * 12; }
+inline int f4195_13(int x) { return x * 13; }
+inline int f4195_14(int x) { return x * 14; }
+inline int f4195_15(int x) { return x * 15; }
+inline int f4195_16(int x) { return x * 16; }
+inline int f4195_17(int x) { return x * 17; }
+inline int f4195_18(int x) { return x * 18; }
+inline int f4195_19(int x) { return x * 19; }
+inline int f4195_20(int x) { return x * 20; }
+inline int f4195_21(int x) { return x * 21; }
+inline int f4195_22(int x) { return x * 22; }
+inline int f4195_23(int x) { return x * 23; }
+inline int f4195_24(int x) { return x * 24; }
+inline int f4195_25(int x) { return x * 25; }
+inline int f4195_26(int x) { return x * 26; }
+inline int f4195_27(int x) { return x * 27; }
+inline int f4195_28(int x) { return x * 28; }
+inline int f4195_29(int x) { return x * 29; }
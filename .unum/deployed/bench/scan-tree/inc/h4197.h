@@ -0,0 +1,42 @@
+#pragma once
+/* header 4197 */
+#include <vector>
+#include "h4941.h"
+#include "h1118.h"
+#include "h9466.h"
+#include "h8277.h"
+#include "h4340.h"
+#ifdef X
+#include "h4523.h"
+#endif
+struct S4197 { int a; const char *s = "x//y"; };
+inline int f4197_0(int x) { return x * 0; }
+inline int f4197_1(int x) { return x * 1; }
+inline int f4197_2(int x) { return x * 2; }
+inline int f4197_3(int x) { return x * 3; }
+inline int f4197_4(int x) { return x * 4; }
+inline int f4197_5(int x) { return x * 5; }
+inline int f4197_6(int x) { return x * 6; }
+inline int f4197_7(int x) { return x * 7; }
+inline int f4197_8(int x) { return x * 8; }
+inline int f4197_9(int x) { return x * 9; }
+inline int f4197_10(int x) { return x * 10; }
+inline int f4197_11(int x) { return x * 11; }
+inline int f4197_12(int x) { return x * 12; }
+inline int f4197_13(int x) { return x * 13; }
+inline int f4197_14(int x) { return x * 14; }
+inline int f4197_15(int x) { return x * 15; }
+inline int f4197_16(int x) { return x * 16; }
+inline int f4197_17(int x) { return x * 17; }
+inline int f4197_18(int x) { return x * 18; }
+inline int f4197_19(int x) { return x * 19; }
+inline int f4197_20(int x) { return x * 20; }
+inline int f4197_21(int x) { return x * 21; }
+inline int f4197_22(int x) { return x * 22; }
+inline int f4197_23(int x) { return x * 23; }
+inline int f4197_24(int x) { return x * 24; }
+inline int f4197_25(int x) { return x * 25; }
+inline int f4197_26(int x) { return x * 26; }
+inline int f4197_27(int x) { return x * 27; }
+inline int f4197_28(int x) { return x * 28; }
+inline int f4197_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 42 */
+#include <vector>
+#include "h3107.h"
+#include "h760.h"
+#include "h5785.h"
+#include "h4119.h"
+#include "h3578.h"
+#ifdef X
+#include "h6303.h"
+#endif
+struct S42 { int a; const char *s = "x//y"; };
+inline int f42_0(int x) { return x * 0; }
+inline int f42_1(int x) { return x * 1; }
+inline int f42_2(int x) { return x * 2; }
+inline int f42_3(int x) { return x * 3; }
+inline int f42_4(int x) { return x * 4; }
+inline int f42_5(int x) { return x * 5; }
+inline int f42_6(int x) { return x * 6; }
+inline int f42_7(int x) { return x * 7; }
+inline int f42_8(int x) { return x * 8; }
+inline int f42_9(int x) { return x * 9; }
+inline int f42_10(int x) { return x * 10; }
+inline int f42_11(int x) { return x * 11; }
+inline int f42_12(int x) { return x * 12; }
+inline int f42_13(int x) { return x * 13; }
+inline int f42_14(int x) { return x * 14; }
+inline int f42_15(int x) { return x * 15; }
+inline int f42_16(int x) { return x * 16; }
+inline int f42_17(int x) { return x * 17; }
+inline int f42_18(int x) { return x * 18; }
+inline int f42_19(int x) { return x * 19; }
+inline int f42_20(int x) { return x * 20; }
+inline int f42_21(int x) { return x * 21; }
+inline int f42_22(int x) { return x * 22; }
+inline int f42_23(int x) { return x * 23; }
+inline int f42_24(int x) { return x * 24; }
+inline int f42_25(int x) { return x * 25; }
+inline int f42_26(int x) { return x * 26; }
+inline int f42_27(int x) { return x * 27; }
+inline int f42_28(int x) { return x * 28; }
+inline int f42_29(int x) { return x * 29; }
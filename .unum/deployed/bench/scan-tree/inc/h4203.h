@@ -0,0 +1,42 @@
+#pragma once
+/* header 4203 */
+#include <vector>
+#include "h7827.h"
+#include "h2181.h"
+#include "h955.h"
+#include "h6433.h"
+#include "h9656.h"
+#ifdef X
+#include "h7001.h"
+#endif
+struct S4203 { int a; const char *s = "x//y"; };
+inline int f4203_0(int x) { return x * 0; }
+inline int f4203_1(int x) { return x * 1; }
+inline int f4203_2(int x) { return x * 2; }
+inline int f4203_3(int x) { return x * 3; }
+inline int f4203_4(int x) { return x * 4; }
+inline int f4203_5(int x) { return x * 5; }
+inline int f4203_6(int x) { return x * 6; }
+inline int f4203_7(int x) { return x * 7; }
+inline int f4203_8(int x) { return x * 8; }
+inline int f4203_9(int x) { return x * 9; }
+inline int f4203_10(int x) { return x * 10; }
+inline int f4203_11(int x) { return x * 11; }
+inline int f4203_12(int x) { return x * 12; }
+inline int f4203_13(int x) { return x * 13; }
+inline int f4203_14(int x) { return x * 14; }
+inline int f4203_15(int x) { return x * 15; }
+inline int f4203_16(int x) { return x * 16; }
+inline int f4203_17(int x) { return x * 17; }
+inline int f4203_18(int x) { return x * 18; }
+inline int f4203_19(int x) { return x * 19; }
+inline int f4203_20(int x) { return x * 20; }
+inline int f4203_21(int x) { return x * 21; }
+inline int f4203_22(int x) { return x * 22; }
+inline int f4203_23(int x) { return x * 23; }
+inline int f4203_24(int x) { return x * 24; }
+inline int f4203_25(int x) { return x * 25; }
+inline int f4203_26(int x) { return x * 26; }
+inline int f4203_27(int x) { return x * 27; }
+inline int f4203_28(int x) { return x * 28; }
+inline int f4203_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4205 */
+#include <vector>
+#include "h2756.h"
+#include "h85.h"
+#include "h7595.h"
+#include "h6231.h"
+#include "h4084.h"
+#ifdef X
+#include "h8403.h"
+#endif
+struct S4205 { int a; const char *s = "x//y"; };
+inline int f4205_0(int x) { return x * 0; }
+inline int f4205_1(int x) { return x * 1; }
+inline int f4205_2(int x) { return x * 2; }
+inline int f4205_3(int x) { return x * 3; }
+inline int f4205_4(int x) { return x * 4; }
+inline int f4205_5(int x) { return x * 5; }
+inline int f4205_6(int x) { return x * 6; }
+inline int f4205_7(int x) { return x * 7; }
+inline int f4205_8(int x) { return x * 8; }
+inline int f4205_9(int x) { return x * 9; }
+inline int f4205_10(int x) { return x * 10; }
+inline int f4205_11(int x) { return x * 11; }
+inline int f4205_12(int x) { return x * 12; }
+inline int f4205_13(int x) { return x * 13; }
+inline int f4205_14(int x) { return x * 14; }
+inline int f4205_15(int x) { return x * 15; }
+inline int f4205_16(int x) { return x * 16; }
+inline int f4205_17(int x) { return x * 17; }
+inline int f4205_18(int x) { return x * 18; }
+inline int f4205_19(int x) { return x * 19; }
+inline int f4205_20(int x) { return x * 20; }
+inline int f4205_21(int x) { return x * 21; }
+inline int f4205_22(int x) { return x * 22; }
+inline int f4205_23(int x) { return x * 23; }
+inline int f4205_24(int x) { return x * 24; }
+inline int f4205_25(int x) { return x * 25; }
+inline int f4205_26(int x) { return x * 26; }
+inline int f4205_27(int x) { return x * 27; }
+inline int f4205_28(int x) { return x * 28; }
+inline int f4205_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4206 */
+#include <vector>
+#include "h1999.h"
+#include "h7438.h"
+#include "h753.h"
+#include "h3146.h"
+#include "h3054.h"
+#ifdef X
+#include "h3880.h"
+#endif
+struct S4206 { int a; const char *s = "x//y"; };
+inline int f4206_0(int x) { return x * 0; }
+inline int f4206_1(int x) { return x * 1; }
+inline int f4206_2(int x) { return x * 2; }
+inline int f4206_3(int x) { return x * 3; }
+inline int f4206_4(int x) { return x * 4; }
+inline int f4206_5(int x) { return x * 5; }
+inline int f4206_6(int x) { return x * 6; }
+inline int f4206_7(int x) { return x * 7; }
+inline int f4206_8(int x) { return x * 8; }
+inline int f4206_9(int x) { return x * 9; }
+inline int f4206_10(int x) { return x * 10; }
+inline int f4206_11(int x) { return x * 11; }
+inline int f4206_12(int x) { return x * 12; }
+inline int f4206_13(int x) { return x * 13; }
+inline int f4206_14(int x) { return x * 14; }
+inline int f4206_15(int x) { return x * 15; }
+inline int f4206_16(int x) { return x * 16; }
+inline int f4206_17(int x) { return x * 17; }
+inline int f4206_18(int x) { return x * 18; }
+inline int f4206_19(int x) { return x * 19; }
+inline int f4206_20(int x) { return x * 20; }
+inline int f4206_21(int x) { return x * 21; }
+inline int f4206_22(int x) { return x * 22; }
+inline int f4206_23(int x) { return x * 23; }
+inline int f4206_24(int x) { return x * 24; }
+inline int f4206_25(int x) { return x * 25; }
+inline int f4206_26(int x) { return x * 26; }
+inline int f4206_27(int x) { return x * 27; }
+inline int f4206_28(int x) { return x * 28; }
+inline int f4206_29(int x) { return x * 29; }
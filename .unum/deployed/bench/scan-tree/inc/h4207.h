@@ -0,0 +1,42 @@
+#pragma once
+/* header 4207 */
+#include <vector>
+#include "h230.h"
+#include "h8186.h"
+#include "h8528.h"
+#include "h5276.h"
+#include "h6551.h"
+#ifdef X
+#include "h5840.h"
+#endif
+struct S4207 { int a; const char *s = "x//y"; };
+inline int f4207_0(int x) { return x * 0; }
+inline int f4207_1(int x) { return x * 1; }
+inline int f4207_2(int x) { return x * 2; }
+inline int f4207_3(int x) { return x * 3; }
+inline int f4207_4(int x) { return x * 4; }
+inline int f4207_5(int x) { return x * 5; }
+inline int f4207_6(int x) { return x * 6; }
+inline int f4207_7(int x) { return x * 7; }
+inline int f4207_8(int x) { return x * 8; }
+inline int f4207_9(int x) { return x * 9; }
+inline int f4207_10(int x) { return x * 10; }
+inline int f4207_11(int x) { return x * 11; }
+inline int f4207_12(int x) { return x * 12; }
+inline int f4207_13(int x) { return x * 13; }
+inline int f4207_14(int x) { return x * 14; }
+inline int f4207_15(int x) { return x * 15; }
+inline int f4207_16(int x) { return x * 16; }
+inline int f4207_17(int x) { return x * 17; }
+inline int f4207_18(int x) { return x * 18; }
+inline int f4207_19(int x) { return x * 19; }
+inline int f4207_20(int x) { return x * 20; }
+inline int f4207_21(int x) { return x * 21; }
+inline int f4207_22(int x) { return x * 22; }
+inline int f4207_23(int x) { return x * 23; }
+inline int f4207_24(int x) { return x * 24; }
+inline int f4207_25(int x) { return x * 25; }
+inline int f4207_26(int x) { return x * 26; }
+inline int f4207_27(int x) { return x * 27; }
+inline int f4207_28(int x) { return x * 28; }
+inline int f4207_29(int x) { return x * 29; }
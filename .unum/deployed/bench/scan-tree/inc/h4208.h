@@ -0,0 +1,42 @@
+#pragma once
+/* header 4208 */
+#include <vector>
+#include "h4692.h"
+#include "h4388.h"
+#include "h2328.h"
+#include "h2466.h"
+#include "h2596.h"
+#ifdef X
+#include "h5315.h"
+#endif
+struct S4208 { int a; const char *s = "x//y"; };
+inline int f4208_0(int x) { return x * 0; }
+inline int f4208_1(int x) { return x * 1; }
+inline int f4208_2(int x) { return x * 2; }
+inline int f4208_3(int x) { return x * 3; }
+inline int f4208_4(int x) { return x * 4; }
+inline int f4208_5(int x) { return x * 5; }
+inline int f4208_6(int x) { return x * 6; }
+inline int f4208_7(int x) { return x * 7; }
+inline int f4208_8(int x) { return x * 8; }
+inline int f4208_9(int x) { return x * 9; }
+inline int f4208_10(int x) { return x * 10; }
+inline int f4208_11(int x) { return x * 11; }
+inline int f4208_12(int x) { return x * 12; }
+inline int f4208_13(int x) { return x * 13; }
+inline int f4208_14(int x) { return x * 14; }
+inline int f4208_15(int x) { return x * 15; }
+inline int f4208_16(int x) { return x * 16; }
+inline int f4208_17(int x) { return x * 17; }
+inline int f4208_18(int x) { return x * 18; }
+inline int f4208_19(int x) { return x * 19; }
+inline int f4208_20(int x) { return x * 20; }
+inline int f4208_21(int x) { return x * 21; }
+inline int f4208_22(int x) { return x * 22; }
+inline int f4208_23(int x) { return x * 23; }
+inline int f4208_24(int x) { return x * 24; }
+inline int f4208_25(int x) { return x * 25; }
+inline int f4208_26(int x) { return x * 26; }
+inline int f4208_27(int x) { return x * 27; }
+inline int f4208_28(int x) { return x * 28; }
+inline int f4208_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4210 */
+#include <vector>
+#include "h2302.h"
+#include "h5880.h"
+#include "h6007.h"
+#include "h6857.h"
+#include "h708.h"
+#ifdef X
+#include "h6003.h"
+#endif
+struct S4210 { int a; const char *s = "x//y"; };
+inline int f4210_0(int x) { return x * 0; }
+inline int f4210_1(int x) { return x * 1; }
+inline int f4210_2(int x) { return x * 2; }
+inline int f4210_3(int x) { return x * 3; }
+inline int f4210_4(int x) { return x * 4; }
+inline int f4210_5(int x) { return x * 5; }
+inline int f4210_6(int x) { return x * 6; }
+inline int f4210_7(int x) { return x * 7; }
+inline int f4210_8(int x) { return x * 8; }
+inline int f4210_9(int x) { return x * 9; }
+inline int f4210_10(int x) { return x * 10; }
+inline int f4210_11(int x) { return x * 11; }
+inline int f4210_12(int x) { return x * 12; }
+inline int f4210_13(int x) { return x * 13; }
+inline int f4210_14(int x) { return x * 14; }
+inline int f4210_15(int x) { return x * 15; }
+inline int f4210_16(int x) { return x * 16; }
+inline int f4210_17(int x) { return x * 17; }
+inline int f4210_18(int x) { return x * 18; }
+inline int f4210_19(int x) { return x * 19; }
+inline int f4210_20(int x) { return x * 20; }
+inline int f4210_21(int x) { return x * 21; }
+inline int f4210_22(int x) { return x * 22; }
+inline int f4210_23(int x) { return x * 23; }
+inline int f4210_24(int x) { return x * 24; }
+inline int f4210_25(int x) { return x * 25; }
+inline int f4210_26(int x) { return x * 26; }
+inline int f4210_27(int x) { return x * 27; }
+inline int f4210_28(int x) { return x * 28; }
+inline int f4210_29(int x) { return x * 29; }
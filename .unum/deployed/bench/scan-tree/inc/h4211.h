@@ -0,0 +1,42 @@
+#pragma once
+/* header 4211 */
+#include <vector>
+#include "h3960.h"
+#include "h4093.h"
+#include "h3613.h"
+#include "h6864.h"
+#include "h5232.h"
+#ifdef X
+#include "h7454.h"
+#endif
+struct S4211 { int a; const char *s = "x//y"; };
+inline int f4211_0(int x) { return x * 0; }
+inline int f4211_1(int x) { return x * 1; }
+inline int f4211_2(int x) { return x * 2; }
+inline int f4211_3(int x) { return x * 3; }
+inline int f4211_4(int x) { return x * 4; }
+inline int f4211_5(int x) { return x * 5; }
+inline int f4211_6(int x) { return x * 6; }
+inline int f4211_7(int x) { return x * 7; }
+inline int f4211_8(int x) { return x * 8; }
+inline int f4211_9(int x) { return x * 9; }
+inline int f4211_10(int x) { return x * 10; }
+inline int f4211_11(int x) { return x * 11; }
+inline int f4211_12(int x) { return x * 12; }
+inline int f4211_13(int x) { return x * 13; }
+inline int f4211_14(int x) { return x * 14; }
+inline int f4211_15(int x) { return x * 15; }
+inline int f4211_16(int x) { return x * 16; }
+inline int f4211_17(int x) { return x * 17; }
+inline int f4211_18(int x) { return x * 18; }
+inline int f4211_19(int x) { return x * 19; }
+inline int f4211_20(int x) { return x * 20; }
+inline int f4211_21(int x) { return x * 21; }
+inline int f4211_22(int x) { return x * 22; }
+inline int f4211_23(int x) { return x * 23; }
+inline int f4211_24(int x) { return x * 24; }
+inline int f4211_25(int x) { return x * 25; }
+inline int f4211_26(int x) { return x * 26; }
+inline int f4211_27(int x) { return x * 27; }
+inline int f4211_28(int x) { return x * 28; }
+inline int f4211_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4212 */
+#include <vector>
+#include "h7593.h"
+#include "h7695.h"
+#include "h7330.h"
+#include "h3937.h"
+#include "h9071.h"
+#ifdef X
+#include "h4176.h"
+#endif
+struct S4212 { int a; const char *s = "x//y"; };
+inline int f4212_0(int x) { return x * 0; }
+inline int f4212_1(int x) { return x * 1; }
+inline int f4212_2(int x) { return x * 2; }
+inline int f4212_3(int x) { return x * 3; }
+inline int f4212_4(int x) { return x * 4; }
+inline int f4212_5(int x) { return x * 5; }
+inline int f4212_6(int x) { return x * 6; }
+inline int f4212_7(int x) { return x * 7; }
+inline int f4212_8(int x) { return x * 8; }
+inline int f4212_9(int x) { return x * 9; }
+inline int f4212_10(int x) { return x * 10; }
+inline int f4212_11(int x) { return x * 11; }
+inline int f4212_12(int x) { return x * 12; }
+inline int f4212_13(int x) { return x * 13; }
+inline int f4212_14(int x) { return x * 14; }
+inline int f4212_15(int x) { return x * 15; }
+inline int f4212_16(int x) { return x * 16; }
+inline int f4212_17(int x) { return x * 17; }
+inline int f4212_18(int x) { return x * 18; }
+inline int f4212_19(int x) { return x * 19; }
+inline int f4212_20(int x) { return x * 20; }
+inline int f4212_21(int x) { return x * 21; }
+inline int f4212_22(int x) { return x * 22; }
+inline int f4212_23(int x) { return x * 23; }
+inline int f4212_24(int x) { return x * 24; }
+inline int f4212_25(int x) { return x * 25; }
+inline int f4212_26(int x) { return x * 26; }
+inline int f4212_27(int x) { return x * 27; }
+inline int f4212_28(int x) { return x * 28; }
+inline int f4212_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4215 */
+#include <vector>
+#include "h6614.h"
+#include "h6057.h"
+#include "h2003.h"
+#include "h2274.h"
+#include "h6930.h"
+#ifdef X
+#include "h1206.h"
+#endif
+struct S4215 { int a; const char *s = "x//y"; };
+inline int f4215_0(int x) { return x * 0; }
+inline int f4215_1(int x) { return x * 1; }
+inline int f4215_2(int x) { return x * 2; }
+inline int f4215_3(int x) { return x * 3; }
+inline int f4215_4(int x) { return x * 4; }
+inline int f4215_5(int x) { return x * 5; }
+inline int f4215_6(int x) { return x * 6; }
+inline int f4215_7(int x) { return x * 7; }
+inline int f4215_8(int x) { return x * 8; }
+inline int f4215_9(int x) { return x * 9; }
+inline int f4215_10(int x) { return x * 10; }
+inline int f4215_11(int x) { return x * 11; }
+inline int f4215_12(int x) { return x * 12; }
+inline int f4215_13(int x) { return x * 13; }
+inline int f4215_14(int x) { return x * 14; }
+inline int f4215_15(int x) { return x * 15; }
+inline int f4215_16(int x) { return x * 16; }
+inline int f4215_17(int x) { return x * 17; }
+inline int f4215_18(int x) { return x * 18; }
+inline int f4215_19(int x) { return x * 19; }
+inline int f4215_20(int x) { return x * 20; }
+inline int f4215_21(int x) { return x * 21; }
+inline int f4215_22(int x) { return x * 22; }
+inline int f4215_23(int x) { return x * 23; }
+inline int f4215_24(int x) { return x * 24; }
+inline int f4215_25(int x) { return x * 25; }
+inline int f4215_26(int x) { return x * 26; }
+inline int f4215_27(int x) { return x * 27; }
+inline int f4215_28(int x) { return x * 28; }
+inline int f4215_29(int x) { return x * 29; }
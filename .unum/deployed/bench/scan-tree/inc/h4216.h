@@ -0,0 +1,42 @@
+#pragma once
+/* header 4216 */
+#include <vector>
+#include "h6516.h"
+#include "h3200.h"
+#include "h4485.h"
+#include "h8662.h"
+#include "h4779.h"
+#ifdef X
+#include "h5965.h"
+#endif
+struct S4216 { int a; const char *s = "x//y"; };
+inline int f4216_0(int x) { return x * 0; }
+inline int f4216_1(int x) { return x * 1; }
+inline int f4216_2(int x) { return x * 2; }
+inline int f4216_3(int x) { return x * 3; }
+inline int f4216_4(int x) { return x * 4; }
+inline int f4216_5(int x) { return x * 5; }
+inline int f4216_6(int x) { return x * 6; }
+inline int f4216_7(int x) { return x * 7; }
+inline int f4216_8(int x) { return x * 8; }
+inline int f4216_9(int x) { return x * 9; }
+inline int f4216_10(int x) { return x * 10; }
+inline int f4216_11(int x) { return x * 11; }
+inline int f4216_12(int x) { return x * 12; }
+inline int f4216_13(int x) { return x * 13; }
+inline int f4216_14(int x) { return x * 14; }
+inline int f4216_15(int x) { return x * 15; }
+inline int f4216_16(int x) { return x * 16; }
+inline int f4216_17(int x) { return x * 17; }
+inline int f4216_18(int x) { return x * 18; }
+inline int f4216_19(int x) { return x * 19; }
+inline int f4216_20(int x) { return x * 20; }
+inline int f4216_21(int x) { return x * 21; }
+inline int f4216_22(int x) { return x * 22; }
+inline int f4216_23(int x) { return x * 23; }
+inline int f4216_24(int x) { return x * 24; }
+inline int f4216_25(int x) { return x * 25; }
+inline int f4216_26(int x) { return x * 26; }
+inline int f4216_27(int x) { return x * 27; }
+inline int f4216_28(int x) { return x * 28; }
+inline int f4216_29(int x) { return x * 29; }
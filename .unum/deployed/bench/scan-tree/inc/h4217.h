@@ -0,0 +1,42 @@
+#pragma once
+/* header 4217 */
+#include <vector>
+#include "h9079.h"
+#include "h6006.h"
+#include "h6188.h"
+#include "h7738.h"
+#include "h2809.h"
+#ifdef X
+#include "h4447.h"
+#endif
+struct S4217 { int a; const char *s = "x//y"; };
+inline int f4217_0(int x) { return x * 0; }
+inline int f4217_1(int x) { return x * 1; }
+inline int f4217_2(int x) { return x * 2; }
+inline int f4217_3(int x) { return x * 3; }
+inline int f4217_4(int x) { return x * 4; }
+inline int f4217_5(int x) { return x * 5; }
+inline int f4217_6(int x) { return x * 6; }
+inline int f4217_7(int x) { return x * 7; }
+inline int f4217_8(int x) { return x * 8; }
+inline int f4217_9(int x) { return x * 9; }
+inline int f4217_10(int x) { return x * 10; }
+inline int f4217_11(int x) { return x * 11; }
+inline int f4217_12(int x) { return x * 12; }
+inline int f4217_13(int x) { return x * 13; }
+inline int f4217_14(int x) { return x * 14; }
+inline int f4217_15(int x) { return x * 15; }
+inline int f4217_16(int x) { return x * 16; }
+inline int f4217_17(int x) { return x * 17; }
+inline int f4217_18(int x) { return x * 18; }
+inline int f4217_19(int x) { return x * 19; }
+inline int f4217_20(int x) { return x * 20; }
+inline int f4217_21(int x) { return x * 21; }
+inline int f4217_22(int x) { return x * 22; }
+inline int f4217_23(int x) { return x * 23; }
+inline int f4217_24(int x) { return x * 24; }
+inline int f4217_25(int x) { return x * 25; }
+inline int f4217_26(int x) { return x * 26; }
+inline int f4217_27(int x) { return x * 27; }
+inline int f4217_28(int x) { return x * 28; }
+inline int f4217_29(int x) { return x * 29; }
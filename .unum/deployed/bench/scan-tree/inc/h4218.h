@@ -0,0 +1,42 @@
+#pragma once
+/* header 4218 */
+#include <vector>
+#include "h4873.h"
+#include "h7400.h"
+#include "h7103.h"
+#include "h2481.h"
+#include "h5011.h"
+#ifdef X
+#include "h3403.h"
+#endif
+struct S4218 { int a; const char *s = "x//y"; };
+inline int f4218_0(int x) { return x * 0; }
+inline int f4218_1(int x) { return x * 1; }
+inline int f4218_2(int x) { return x * 2; }
+inline int f4218_3(int x) { return x * 3; }
+inline int f4218_4(int x) { return x * 4; }
+inline int f4218_5(int x) { return x * 5; }
+inline int f4218_6(int x) { return x * 6; }
+inline int f4218_7(int x) { return x * 7; }
+inline int f4218_8(int x) { return x * 8; }
+inline int f4218_9(int x) { return x * 9; }
+inline int f4218_10(int x) { return x * 10; }
+inline int f4218_11(int x) { return x * 11; }
+inline int f4218_12(int x) { return x * 12; }
+inline int f4218_13(int x) { return x * 13; }
+inline int f4218_14(int x) { return x * 14; }
+inline int f4218_15(int x) { return x * 15; }
+inline int f4218_16(int x) { return x * 16; }
+inline int f4218_17(int x) { return x * 17; }
+inline int f4218_18(int x) { return x * 18; }
+inline int f4218_19(int x) { return x * 19; }
+inline int f4218_20(int x) { return x * 20; }
+inline int f4218_21(int x) { return x * 21; }
+inline int f4218_22(int x) { return x * 22; }
+inline int f4218_23(int x) { return x * 23; }
+inline int f4218_24(int x) { return x * 24; }
+inline int f4218_25(int x) { return x * 25; }
+inline int f4218_26(int x) { return x * 26; }
+inline int f4218_27(int x) { return x * 27; }
+inline int f4218_28(int x) { return x * 28; }
+inline int f4218_29(int x) { return x * 29; }
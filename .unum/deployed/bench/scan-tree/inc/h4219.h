@@ -0,0 +1,42 @@
+#pragma once
+/* header 4219 */
+#include <vector>
+#include "h3156.h"
+#include "h8592.h"
+#include "h4465.h"
+#include "h9353.h"
+#include "h3438.h"
+#ifdef X
+#include "h4604.h"
+#endif
+struct S4219 { int a; const char *s = "x//y"; };
+inline int f4219_0(int x) { return x * 0; }
+inline int f4219_1(int x) { return x * 1; }
+inline int f4219_2(int x) { return x * 2; }
+inline int f4219_3(int x) { return x * 3; }
+inline int f4219_4(int x) { return x * 4; }
+inline int f4219_5(int x) { return x * 5; }
+inline int f4219_6(int x) { return x * 6; }
+inline int f4219_7(int x) { return x * 7; }
+inline int f4219_8(int x) { return x * 8; }
+inline int f4219_9(int x) { return x * 9; }
+inline int f4219_10(int x) { return x * 10; }
+inline int f4219_11(int x) { return x * 11; }
+inline int f4219_12(int x) { return x * 12; }
+inline int f4219_13(int x) { return x * 13; }
+inline int f4219_14(int x) { return x * 14; }
+inline int f4219_15(int x) { return x * 15; }
+inline int f4219_16(int x) { return x * 16; }
+inline int f4219_17(int x) { return x * 17; }
+inline int f4219_18(int x) { return x * 18; }
+inline int f4219_19(int x) { return x * 19; }
+inline int f4219_20(int x) { return x * 20; }
+inline int f4219_21(int x) { return x * 21; }
+inline int f4219_22(int x) { return x * 22; }
+inline int f4219_23(int x) { return x * 23; }
+inline int f4219_24(int x) { return x * 24; }
+inline int f4219_25(int x) { return x * 25; }
+inline int f4219_26(int x) { return x * 26; }
+inline int f4219_27(int x) { return x * 27; }
+inline int f4219_28(int x) { return x * 28; }
+inline int f4219_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4222 */
+#include <vector>
+#include "h7202.h"
+#include "h4278.h"
+#include "h1486.h"
+#include "h5064.h"
+#include "h3913.h"
+#ifdef X
+#include "h3508.h"
+#endif
+struct S4222 { int a; const char *s = "x//y"; };
+inline int f4222_0(int x) { return x * 0; }
+inline int f4222_1(int x) { return x * 1; }
+inline int f4222_2(int x) { return x * 2; }
+inline int f4222_3(int x) { return x * 3; }
+inline int f4222_4(int x) { return x * 4; }
+inline int f4222_5(int x) { return x * 5; }
+inline int f4222_6(int x) { return x * 6; }
+inline int f4222_7(int x) { return x * 7; }
+inline int f4222_8(int x) { return x * 8; }
+inline int f4222_9(int x) { return x * 9; }
+inline int f4222_10(int x) { return x * 10; }
+inline int f4222_11(int x) { return x * 11; }
+inline int f4222_12(int x) { return x * 12; }
+inline int f4222_13(int x) { return x * 13; }
+inline int f4222_14(int x) { return x * 14; }
+inline int f4222_15(int x) { return x * 15; }
+inline int f4222_16(int x) { return x * 16; }
+inline int f4222_17(int x) { return x * 17; }
+inline int f4222_18(int x) { return x * 18; }
+inline int f4222_19(int x) { return x * 19; }
+inline int f4222_20(int x) { return x * 20; }
+inline int f4222_21(int x) { return x * 21; }
+inline int f4222_22(int x) { return x * 22; }
+inline int f4222_23(int x) { return x * 23; }
+inline int f4222_24(int x) { return x * 24; }
+inline int f4222_25(int x) { return x * 25; }
+inline int f4222_26(int x) { return x * 26; }
+inline int f4222_27(int x) { return x * 27; }
+inline int f4222_28(int x) { return x * 28; }
+inline int f4222_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4224 */
+#include <vector>
+#include "h2643.h"
+#include "h91.h"
+#include "h293.h"
+#include "h1894.h"
+#include "h2140.h"
+#ifdef X
+#include "h6397.h"
+#endif
+struct S4224 { int a; const char *s = "x//y"; };
+inline int f4224_0(int x) { return x * 0; }
+inline int f4224_1(int x) { return x * 1; }
+inline int f4224_2(int x) { return x * 2; }
+inline int f4224_3(int x) { return x * 3; }
+inline int f4224_4(int x) { return x * 4; }
+inline int f4224_5(int x) { return x * 5; }
+inline int f4224_6(int x) { return x * 6; }
+inline int f4224_7(int x) { return x * 7; }
+inline int f4224_8(int x) { return x * 8; }
+inline int f4224_9(int x) { return x * 9; }
+inline int f4224_10(int x) { return x * 10; }
+inline int f4224_11(int x) { return x * 11; }
+inline int f4224_12(int x) { return x * 12; }
+inline int f4224_13(int x) { return x * 13; }
+inline int f4224_14(int x) { return x * 14; }
+inline int f4224_15(int x) { return x * 15; }
+inline int f4224_16(int x) { return x * 16; }
+inline int f4224_17(int x) { return x * 17; }
+inline int f4224_18(int x) { return x * 18; }
+inline int f4224_19(int x) { return x * 19; }
+inline int f4224_20(int x) { return x * 20; }
+inline int f4224_21(int x) { return x * 21; }
+inline int f4224_22(int x) { return x * 22; }
+inline int f4224_23(int x) { return x * 23; }
+inline int f4224_24(int x) { return x * 24; }
+inline int f4224_25(int x) { return x * 25; }
+inline int f4224_26(int x) { return x * 26; }
+inline int f4224_27(int x) { return x * 27; }
+inline int f4224_28(int x) { return x * 28; }
+inline int f4224_29(int x) { return x * 29; }
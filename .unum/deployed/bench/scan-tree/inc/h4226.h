@@ -0,0 +1,42 @@
+#pragma once
+/* header 4226 */
+#include <vector>
+#include "h3038.h"
+#include "h4064.h"
+#include "h8475.h"
+#include "h7201.h"
+#include "h8552.h"
+#ifdef X
+#include "h2479.h"
+#endif
+struct S4226 { int a; const char *s = "x//y"; };
+inline int f4226_0(int x) { return x * 0; }
+inline int f4226_1(int x) { return x * 1; }
+inline int f4226_2(int x) { return x * 2; }
+inline int f4226_3(int x) { return x * 3; }
+inline int f4226_4(int x) { return x * 4; }
+inline int f4226_5(int x) { return x * 5; }
+inline int f4226_6(int x) { return x * 6; }
+inline int f4226_7(int x) { return x * 7; }
+inline int f4226_8(int x) { return x * 8; }
+inline int f4226_9(int x) { return x * 9; }
+inline int f4226_10(int x) { return x * 10; }
+inline int f4226_11(int x) { return x * 11; }
+inline int f4226_12(int x) { return x * 12; }
+inline int f4226_13(int x) { return x * 13; }
+inline int f4226_14(int x) { return x * 14; }
+inline int f4226_15(int x) { return x * 15; }
+inline int f4226_16(int x) { return x * 16; }
+inline int f4226_17(int x) { return x * 17; }
+inline int f4226_18(int x) { return x * 18; }
+inline int f4226_19(int x) { return x * 19; }
+inline int f4226_20(int x) { return x * 20; }
+inline int f4226_21(int x) { return x * 21; }
+inline int f4226_22(int x) { return x * 22; }
+inline int f4226_23(int x) { return x * 23; }
+inline int f4226_24(int x) { return x * 24; }
+inline int f4226_25(int x) { return x * 25; }
+inline int f4226_26(int x) { return x * 26; }
+inline int f4226_27(int x) { return x * 27; }
+inline int f4226_28(int x) { return x * 28; }
+inline int f4226_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4227 */
+#include <vector>
+#include "h8237.h"
+#include "h5514.h"
+#include "h8539.h"
+#include "h3419.h"
+#include "h721.h"
+#ifdef X
+#include "h3620.h"
+#endif
+struct S4227 { int a; const char *s = "x//y"; };
+inline int f4227_0(int x) { return x * 0; }
+inline int f4227_1(int x) { return x * 1; }
+inline int f4227_2(int x) { return x * 2; }
+inline int f4227_3(int x) { return x * 3; }
+inline int f4227_4(int x) { return x * 4; }
+inline int f4227_5(int x) { return x * 5; }
+inline int f4227_6(int x) { return x * 6; }
+inline int f4227_7(int x) { return x * 7; }
+inline int f4227_8(int x) { return x * 8; }
+inline int f4227_9(int x) { return x * 9; }
+inline int f4227_10(int x) { return x * 10; }
+inline int f4227_11(int x) { return x * 11; }
+inline int f4227_12(int x) { return x * 12; }
+inline int f4227_13(int x) { return x * 13; }
+inline int f4227_14(int x) { return x * 14; }
+inline int f4227_15(int x) { return x * 15; }
+inline int f4227_16(int x) { return x * 16; }
+inline int f4227_17(int x) { return x * 17; }
+inline int f4227_18(int x) { return x * 18; }
+inline int f4227_19(int x) { return x * 19; }
+inline int f4227_20(int x) { return x * 20; }
+inline int f4227_21(int x) { return x * 21; }
+inline int f4227_22(int x) { return x * 22; }
+inline int f4227_23(int x) { return x * 23; }
+inline int f4227_24(int x) { return x * 24; }
+inline int f4227_25(int x) { return x * 25; }
+inline int f4227_26(int x) { return x * 26; }
+inline int f4227_27(int x) { return x * 27; }
+inline int f4227_28(int x) { return x * 28; }
+inline int f4227_29(int x) { return x * 29; }
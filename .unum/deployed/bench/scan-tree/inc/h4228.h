@@ -0,0 +1,42 @@
+#pragma once
+/* header 4228 */
+#include <vector>
+#include "h4880.h"
+#include "h1141.h"
+#include "h4973.h"
+#include "h5414.h"
+#include "h6908.h"
+#ifdef X
+#include "h9710.h"
+#endif
+struct S4228 { int a; const char *s = "x//y"; };
+inline int f4228_0(int x) { return x * 0; }
+inline int f4228_1(int x) { return x * 1; }
+inline int f4228_2(int x) { return x * 2; }
+inline int f4228_3(int x) { return x * 3; }
+inline int f4228_4(int x) { return x * 4; }
+inline int f4228_5(int x) { return x * 5; }
+inline int f4228_6(int x) { return x * 6; }
+inline int f4228_7(int x) { return x * 7; }
+inline int f4228_8(int x) { return x * 8; }
+inline int f4228_9(int x) { return x * 9; }
+inline int f4228_10(int x) { return x * 10; }
+inline int f4228_11(int x) { return x * 11; }
+inline int f4228_12(int x) { return x * 12; }
+inline int f4228_13(int x) { return x * 13; }
+inline int f4228_14(int x) { return x * 14; }
+inline int f4228_15(int x) { return x * 15; }
+inline int f4228_16(int x) { return x * 16; }
+inline int f4228_17(int x) { return x * 17; }
+inline int f4228_18(int x) { return x * 18; }
+inline int f4228_19(int x) { return x * 19; }
+inline int f4228_20(int x) { return x * 20; }
+inline int f4228_21(int x) { return x * 21; }
+inline int f4228_22(int x) { return x * 22; }
+inline int f4228_23(int x) { return x * 23; }
+inline int f4228_24(int x) { return x * 24; }
+inline int f4228_25(int x) { return x * 25; }
+inline int f4228_26(int x) { return x * 26; }
+inline int f4228_27(int x) { return x * 27; }
+inline int f4228_28(int x) { return x * 28; }
+inline int f4228_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4229 */
+#include <vector>
+#include "h5908.h"
+#include "h1294.h"
+#include "h8587.h"
+#include "h8904.h"
+#include "h5818.h"
+#ifdef X
+#include "h1256.h"
+#endif
+struct S4229 { int a; const char *s = "x//y"; };
+inline int f4229_0(int x) { return x * 0; }
+inline int f4229_1(int x) { return x * 1; }
+inline int f4229_2(int x) { return x * 2; }
+inline int f4229_3(int x) { return x * 3; }
+inline int f4229_4(int x) { return x * 4; }
+inline int f4229_5(int x) { return x * 5; }
+inline int f4229_6(int x) { return x * 6; }
+inline int f4229_7(int x) { return x * 7; }
+inline int f4229_8(int x) { return x * 8; }
+inline int f4229_9(int x) { return x * 9; }
+inline int f4229_10(int x) { return x * 10; }
+inline int f4229_11(int x) { return x * 11; }
+inline int f4229_12(int x) { return x * 12; }
+inline int f4229_13(int x) { return x * 13; }
+inline int f4229_14(int x) { return x * 14; }
+inline int f4229_15(int x) { return x * 15; }
+inline int f4229_16(int x) { return x * 16; }
+inline int f4229_17(int x) { return x * 17; }
+inline int f4229_18(int x) { return x * 18; }
+inline int f4229_19(int x) { return x * 19; }
+inline int f4229_20(int x) { return x * 20; }
+inline int f4229_21(int x) { return x * 21; }
+inline int f4229_22(int x) { return x * 22; }
+inline int f4229_23(int x) { return x * 23; }
+inline int f4229_24(int x) { return x * 24; }
+inline int f4229_25(int x) { return x * 25; }
+inline int f4229_26(int x) { return x * 26; }
+inline int f4229_27(int x) { return x * 27; }
+inline int f4229_28(int x) { return x * 28; }
+inline int f4229_29(int x) { return x * 29; }
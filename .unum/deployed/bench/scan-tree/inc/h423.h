@@ -0,0 +1,42 @@
+#pragma once
+/* header 423 */
+#include <vector>
+#include "h635.h"
+#include "h7753.h"
+#include "h8153.h"
+#include "h5375.h"
+#include "h7125.h"
+#ifdef X
+#include "h3130.h"
+#endif
+struct S423 { int a; const char *s = "x//y"; };
+inline int f423_0(int x) { return x * 0; }
+inline int f423_1(int x) { return x * 1; }
+inline int f423_2(int x) { return x * 2; }
+inline int f423_3(int x) { return x * 3; }
+inline int f423_4(int x) { return x * 4; }
+inline int f423_5(int x) { return x * 5; }
+inline int f423_6(int x) { return x * 6; }
+inline int f423_7(int x) { return x * 7; }
+inline int f423_8(int x) { return x * 8; }
+inline int f423_9(int x) { return x * 9; }
+inline int f423_10(int x) { return x * 10; }
+inline int f423_11(int x) { return x * 11; }
+inline int f423_12(int x) { return x * 12; }
+inline int f423_13(int x) { return x * 13; }
+inline int f423_14(int x) { return x * 14; }
+inline int f423_15(int x) { return x * 15; }
+inline int f423_16(int x) { return x * 16; }
+inline int f423_17(int x) { return x * 17; }
+inline int f423_18(int x) { return x * 18; }
+inline int f423_19(int x) { return x * 19; }
+inline int f423_20(int x) { return x * 20; }
+inline int f423_21(int x) { return x * 21; }
+inline int f423_22(int x) { return x * 22; }
+inline int f423_23(int x) { return x * 23; }
+inline int f423_24(int x) { return x * 24; }
+inline int f423_25(int x) { return x * 25; }
+inline int f423_26(int x) { return x * 26; }
+inline int f423_27(int x) { return x * 27; }
+inline int f423_28(int x) { return x * 28; }
+inline int f423_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4232 */
+#include <vector>
+#include "h8121.h"
+#include "h6906.h"
+#include "h7318.h"
+#include "h4737.h"
+#include "h6421.h"
+#ifdef X
+#include "h7073.h"
+#endif
+struct S4232 { int a; const char *s = "x//y"; };
+inline int f4232_0(int x) { return x * 0; }
+inline int f4232_1(int x) { return x * 1; }
+inline int f4232_2(int x) { return x * 2; }
+inline int f4232_3(int x) { return x * 3; }
+inline int f4232_4(int x) { return x * 4; }
+inline int f4232_5(int x) { return x * 5; }
+inline int f4232_6(int x) { return x * 6; }
+inline int f4232_7(int x) { return x * 7; }
+inline int f4232_8(int x) { return x * 8; }
+inline int f4232_9(int x) { return x * 9; }
+inline int f4232_10(int x) { return x * 10; }
+inline int f4232_11(int x) { return x * 11; }
+inline int f4232_12(int x) { return x * 12; }
+inline int f4232_13(int x) { return x * 13; }
+inline int f4232_14(int x) { return x * 14; }
+inline int f4232_15(int x) { return x * 15; }
+inline int f4232_16(int x) { return x * 16; }
+inline int f4232_17(int x) { return x * 17; }
+inline int f4232_18(int x) { return x * 18; }
+inline int f4232_19(int x) { return x * 19; }
+inline int f4232_20(int x) { return x * 20; }
+inline int f4232_21(int x) { return x * 21; }
+inline int f4232_22(int x) { return x * 22; }
+inline int f4232_23(int x) { return x * 23; }
+inline int f4232_24(int x) { return x * 24; }
+inline int f4232_25(int x) { return x * 25; }
+inline int f4232_26(int x) { return x * 26; }
+inline int f4232_27(int x) { return x * 27; }
+inline int f4232_28(int x) { return x * 28; }
+inline int f4232_29(int x) { return x * 29; }
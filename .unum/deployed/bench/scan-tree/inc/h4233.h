@@ -0,0 +1,42 @@
+#pragma once
+/* header 4233 */
+#include <vector>
+#include "h227.h"
+#include "h1352.h"
+#include "h2617.h"
+#include "h3801.h"
+#include "h725.h"
+#ifdef X
+#include "h3871.h"
+#endif
+struct S4233 { int a; const char *s = "x//y"; };
+inline int f4233_0(int x) { return x * 0; }
+inline int f4233_1(int x) { return x * 1; }
+inline int f4233_2(int x) { return x * 2; }
+inline int f4233_3(int x) { return x * 3; }
+inline int f4233_4(int x) { return x * 4; }
+inline int f4233_5(int x) { return x * 5; }
+inline int f4233_6(int x) { return x * 6; }
+inline int f4233_7(int x) { return x * 7; }
+inline int f4233_8(int x) { return x * 8; }
+inline int f4233_9(int x) { return x * 9; }
+inline int f4233_10(int x) { return x * 10; }
+inline int f4233_11(int x) { return x * 11; }
+inline int f4233_12(int x) { return x * 12; }
+inline int f4233_13(int x) { return x * 13; }
+inline int f4233_14(int x) { return x * 14; }
+inline int f4233_15(int x) { return x * 15; }
+inline int f4233_16(int x) { return x * 16; }
+inline int f4233_17(int x) { return x * 17; }
+inline int f4233_18(int x) { return x * 18; }
+inline int f4233_19(int x) { return x * 19; }
+inline int f4233_20(int x) { return x * 20; }
+inline int f4233_21(int x) { return x * 21; }
+inline int f4233_22(int x) { return x * 22; }
+inline int f4233_23(int x) { return x * 23; }
+inline int f4233_24(int x) { return x * 24; }
+inline int f4233_25(int x) { return x * 25; }
+inline int f4233_26(int x) { return x * 26; }
+inline int f4233_27(int x) { return x * 27; }
+inline int f4233_28(int x) { return x * 28; }
+inline int f4233_29(int x) { return x * 29; }
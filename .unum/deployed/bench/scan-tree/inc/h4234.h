@@ -0,0 +1,42 @@
+#pragma once
+/* header 4234 */
+#include <vector>
+#include "h4781.h"
+#include "h4953.h"
+#include "h5806.h"
+#include "h4161.h"
+#include "h8190.h"
+#ifdef X
+#include "h8303.h"
+#endif
+struct S4234 { int a; const char *s = "x//y"; };
+inline int f4234_0(int x) { return x * 0; }
+inline int f4234_1(int x) { return x * 1; }
+inline int f4234_2(int x) { return x * 2; }
+inline int f4234_3(int x) { return x * 3; }
+inline int f4234_4(int x) { return x * 4; }
+inline int f4234_5(int x) { return x * 5; }
+inline int f4234_6(int x) { return x * 6; }
+inline int f4234_7(int x) { return x * 7; }
+inline int f4234_8(int x) { return x * 8; }
+inline int f4234_9(int x) { return x * 9; }
+inline int f4234_10(int x) { return x * 10; }
+inline int f4234_11(int x) { return x * 11; }
+inline int f4234_12(int x) { return x * 12; }
+inline int f4234_13(int x) { return x * 13; }
+inline int f4234_14(int x) { return x * 14; }
+inline int f4234_15(int x) { return x * 15; }
+inline int f4234_16(int x) { return x * 16; }
+inline int f4234_17(int x) { return x * 17; }
+inline int f4234_18(int x) { return x * 18; }
+inline int f4234_19(int x) { return x * 19; }
+inline int f4234_20(int x) { return x * 20; }
+inline int f4234_21(int x) { return x * 21; }
+inline int f4234_22(int x) { return x * 22; }
+inline int f4234_23(int x) { return x * 23; }
+inline int f4234_24(int x) { return x * 24; }
+inline int f4234_25(int x) { return x * 25; }
+inline int f4234_26(int x) { return x * 26; }
+inline int f4234_27(int x) { return x * 27; }
+inline int f4234_28(int x) { return x * 28; }
+inline int f4234_29(int x) { return x * 29; }
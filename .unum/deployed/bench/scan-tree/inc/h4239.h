@@ -0,0 +1,42 @@
+#pragma once
+/* header 4239 */
+#include <vector>
+#include "h8004.h"
+#include "h7603.h"
+#include "h6886.h"
+#include "h983.h"
+#include "h197.h"
+#ifdef X
+#include "h3202.h"
+#endif
+struct S4239 { int a; const char *s = "x//y"; };
+inline int f4239_0(int x) { return x * 0; }
+inline int f4239_1(int x) { return x * 1; }
+inline int f4239_2(int x) { return x * 2; }
+inline int f4239_3(int x) { return x * 3; }
+inline int f4239_4(int x) { return x * 4; }
+inline int f4239_5(int x) { return x * 5; }
+inline int f4239_6(int x) { return x * 6; }
+inline int f4239_7(int x) { return x * 7; }
+inline int f4239_8(int x) { return x * 8; }
+inline int f4239_9(int x) { return x * 9; }
+inline int f4239_10(int x) { return x * 10; }
+inline int f4239_11(int x) { return x * 11; }
+inline int f4239_12(int x) { return x * 12; }
+inline int f4239_13(int x) { return x * 13; }
+inline int f4239_14(int x) { return x * 14; }
+inline int f4239_15(int x) { return x * 15; }
+inline int f4239_16(int x) { return x * 16; }
+inline int f4239_17(int x) { return x * 17; }
+inline int f4239_18(int x) { return x * 18; }
+inline int f4239_19(int x) { return x * 19; }
+inline int f4239_20(int x) { return x * 20; }
+inline int f4239_21(int x) { return x * 21; }
+inline int f4239_22(int x) { return x * 22; }
+inline int f4239_23(int x) { return x * 23; }
+inline int f4239_24(int x) { return x * 24; }
+inline int f4239_25(int x) { return x * 25; }
+inline int f4239_26(int x) { return x * 26; }
+inline int f4239_27(int x) { return x * 27; }
+inline int f4239_28(int x) { return x * 28; }
+inline int f4239_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 424 */
+#include <vector>
+#include "h3276.h"
+#include "h5078.h"
+#include "h1982.h"
+#include "h5405.h"
+#include "h4673.h"
+#ifdef X
+#include "h1324.h"
+#endif
+struct S424 { int a; const char *s = "x//y"; };
+inline int f424_0(int x) { return x * 0; }
+inline int f424_1(int x) { return x * 1; }
+inline int f424_2(int x) { return x * 2; }
+inline int f424_3(int x) { return x * 3; }
+inline int f424_4(int x) { return x * 4; }
+inline int f424_5(int x) { return x * 5; }
+inline int f424_6(int x) { return x * 6; }
+inline int f424_7(int x) { return x * 7; }
+inline int f424_8(int x) { return x * 8; }
+inline int f424_9(int x) { return x * 9; }
+inline int f424_10(int x) { return x * 10; }
+inline int f424_11(int x) { return x * 11; }
+inline int f424_12(int x) { return x * 12; }
+inline int f424_13(int x) { return x * 13; }
+inline int f424_14(int x) { return x * 14; }
+inline int f424_15(int x) { return x * 15; }
+inline int f424_16(int x) { return x * 16; }
+inline int f424_17(int x) { return x * 17; }
+inline int f424_18(int x) { return x * 18; }
+inline int f424_19(int x) { return x * 19; }
+inline int f424_20(int x) { return x * 20; }
+inline int f424_21(int x) { return x * 21; }
+inline int f424_22(int x) { return x * 22; }
+inline int f424_23(int x) { return x * 23; }
+inline int f424_24(int x) { return x * 24; }
+inline int f424_25(int x) { return x * 25; }
+inline int f424_26(int x) { return x * 26; }
+inline int f424_27(int x) { return x * 27; }
+inline int f424_28(int x) { return x * 28; }
+inline int f424_29(int x) { return x * 29; }
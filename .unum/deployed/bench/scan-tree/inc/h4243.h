@@ -0,0 +1,42 @@
+#pragma once
+/* header 4243 */
+#include <vector>
+#include "h4955.h"
+#include "h8205.h"
+#include "h3419.h"
+#include "h2851.h"
+#include "h8250.h"
+#ifdef X
+#include "h5091.h"
+#endif
+struct S4243 { int a; const char *s = "x//y"; };
+inline int f4243_0(int x) { return x * 0; }
+inline int f4243_1(int x) { return x * 1; }
+inline int f4243_2(int x) { return x * 2; }
+inline int f4243_3(int x) { return x * 3; }
+inline int f4243_4(int x) { return x * 4; }
+inline int f4243_5(int x) { return x * 5; }
+inline int f4243_6(int x) { return x * 6; }
+inline int f4243_7(int x) { return x * 7; }
+inline int f4243_8(int x) { return x * 8; }
+inline int f4243_9(int x) { return x * 9; }
+inline int f4243_10(int x) { return x * 10; }
+inline int f4243_11(int x) { return x * 11; }
+inline int f4243_12(int x) { return x * 12; }
+inline int f4243_13(int x) { return x * 13; }
+inline int f4243_14(int x) { return x * 14; }
+inline int f4243_15(int x) { return x * 15; }
+inline int f4243_16(int x) { return x * 16; }
+inline int f4243_17(int x) { return x * 17; }
+inline int f4243_18(int x) { return x * 18; }
+inline int f4243_19(int x) { return x * 19; }
+inline int f4243_20(int x) { return x * 20; }
+inline int f4243_21(int x) { return x * 21; }
+inline int f4243_22(int x) { return x * 22; }
+inline int f4243_23(int x) { return x * 23; }
+inline int f4243_24(int x) { return x * 24; }
+inline int f4243_25(int x) { return x * 25; }
+inline int f4243_26(int x) { return x * 26; }
+inline int f4243_27(int x) { return x * 27; }
+inline int f4243_28(int x) { return x * 28; }
+inline int f4243_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4245 */
+#include <vector>
+#include "h4929.h"
+#include "h8821.h"
+#include "h7593.h"
+#include "h8874.h"
+#include "h8617.h"
+#ifdef X
+#include "h612.h"
+#endif
+struct S4245 { int a; const char *s = "x//y"; };
+inline int f4245_0(int x) { return x * 0; }
+inline int f4245_1(int x) { return x * 1; }
+inline int f4245_2(int x) { return x * 2; }
+inline int f4245_3(int x) { return x * 3; }
+inline int f4245_4(int x) { return x * 4; }
+inline int f4245_5(int x) { return x * 5; }
+inline int f4245_6(int x) { return x * 6; }
+inline int f4245_7(int x) { return x * 7; }
+inline int f4245_8(int x) { return x * 8; }
+inline int f4245_9(int x) { return x * 9; }
+inline int f4245_10(int x) { return x * 10; }
+inline int f4245_11(int x) { return x * 11; }
+inline int f4245_12(int x) { return x * 12; }
+inline int f4245_13(int x) { return x * 13; }
+inline int f4245_14(int x) { return x * 14; }
+inline int f4245_15(int x) { return x * 15; }
+inline int f4245_16(int x) { return x * 16; }
+inline int f4245_17(int x) { return x * 17; }
+inline int f4245_18(int x) { return x * 18; }
+inline int f4245_19(int x) { return x * 19; }
+inline int f4245_20(int x) { return x * 20; }
+inline int f4245_21(int x) { return x * 21; }
+inline int f4245_22(int x) { return x * 22; }
+inline int f4245_23(int x) { return x * 23; }
+inline int f4245_24(int x) { return x * 24; }
+inline int f4245_25(int x) { return x * 25; }
+inline int f4245_26(int x) { return x * 26; }
+inline int f4245_27(int x) { return x * 27; }
+inline int f4245_28(int x) { return x * 28; }
+inline int f4245_29(int x) { return x * 29; }
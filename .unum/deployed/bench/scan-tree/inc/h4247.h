@@ -0,0 +1,42 @@
+#pragma once
+/* header 4247 */
+#include <vector>
+#include "h5910.h"
+#include "h3295.h"
+#include "h7886.h"
+#include "h3128.h"
+#include "h9012.h"
+#ifdef X
+#include "h9452.h"
+#endif
+struct S4247 { int a; const char *s = "x//y"; };
+inline int f4247_0(int x) { return x * 0; }
+inline int f4247_1(int x) { return x * 1; }
+inline int f4247_2(int x) { return x * 2; }
+inline int f4247_3(int x) { return x * 3; }
+inline int f4247_4(int x) { return x * 4; }
+inline int f4247_5(int x) { return x * 5; }
+inline int f4247_6(int x) { return x * 6; }
+inline int f4247_7(int x) { return x * 7; }
+inline int f4247_8(int x) { return x * 8; }
+inline int f4247_9(int x) { return x * 9; }
+inline int f4247_10(int x) { return x * 10; }
+inline int f4247_11(int x) { return x * 11; }
+inline int f4247_12(int x) { return x * 12; }
+inline int f4247_13(int x) { return x * 13; }
+inline int f4247_14(int x) { return x * 14; }
+inline int f4247_15(int x) { return x * 15; }
+inline int f4247_16(int x) { return x * 16; }
+inline int f4247_17(int x) { return x * 17; }
+inline int f4247_18(int x) { return x * 18; }
+inline int f4247_19(int x) { return x * 19; }
+inline int f4247_20(int x) { return x * 20; }
+inline int f4247_21(int x) { return x * 21; }
+inline int f4247_22(int x) { return x * 22; }
+inline int f4247_23(int x) { return x * 23; }
+inline int f4247_24(int x) { return x * 24; }
+inline int f4247_25(int x) { return x * 25; }
+inline int f4247_26(int x) { return x * 26; }
+inline int f4247_27(int x) { return x * 27; }
+inline int f4247_28(int x) { return x * 28; }
+inline int f4247_29(int x) { return x * 29; }
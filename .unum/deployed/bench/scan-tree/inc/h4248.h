@@ -0,0 +1,42 @@
+#pragma once
+/* header 4248 */
+#include <vector>
+#include "h2941.h"
+#include "h5690.h"
+#include "h8952.h"
+#include "h3108.h"
+#include "h9067.h"
+#ifdef X
+#include "h9907.h"
+#endif
+struct S4248 { int a; const char *s = "x//y"; };
+inline int f4248_0(int x) { return x * 0; }
+inline int f4248_1(int x) { return x * 1; }
+inline int f4248_2(int x) { return x * 2; }
+inline int f4248_3(int x) { return x * 3; }
+inline int f4248_4(int x) { return x * 4; }
+inline int f4248_5(int x) { return x * 5; }
+inline int f4248_6(int x) { return x * 6; }
+inline int f4248_7(int x) { return x * 7; }
+inline int f4248_8(int x) { return x * 8; }
+inline int f4248_9(int x) { return x * 9; }
+inline int f4248_10(int x) { return x * 10; }
+inline int f4248_11(int x) { return x * 11; }
+inline int f4248_12(int x) { return x * 12; }
+inline int f4248_13(int x) { return x * 13; }
+inline int f4248_14(int x) { return x * 14; }
+inline int f4248_15(int x) { return x * 15; }
+inline int f4248_16(int x) { return x * 16; }
+inline int f4248_17(int x) { return x * 17; }
+inline int f4248_18(int x) { return x * 18; }
+inline int f4248_19(int x) { return x * 19; }
+inline int f4248_20(int x) { return x * 20; }
+inline int f4248_21(int x) { return x * 21; }
+inline int f4248_22(int x) { return x * 22; }
+inline int f4248_23(int x) { return x * 23; }
+inline int f4248_24(int x) { return x * 24; }
+inline int f4248_25(int x) { return x * 25; }
+inline int f4248_26(int x) { return x * 26; }
+inline int f4248_27(int x) { return x * 27; }
+inline int f4248_28(int x) { return x * 28; }
+inline int f4248_29(int x) { return x * 29; }
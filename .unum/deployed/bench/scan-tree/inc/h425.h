@@ -0,0 +1,42 @@
+#pragma once
+/* header 425 */
+#include <vector>
+#include "h4334.h"
+#include "h7900.h"
+#include "h2850.h"
+#include "h4058.h"
+#include "h7387.h"
+#ifdef X
+#include "h4127.h"
+#endif
+struct S425 { int a; const char *s = "x//y"; };
+inline int f425_0(int x) { return x * 0; }
+inline int f425_1(int x) { return x * 1; }
+inline int f425_2(int x) { return x * 2; }
+inline int f425_3(int x) { return x * 3; }
+inline int f425_4(int x) { return x * 4; }
+inline int f425_5(int x) { return x * 5; }
+inline int f425_6(int x) { return x * 6; }
+inline int f425_7(int x) { return x * 7; }
+inline int f425_8(int x) { return x * 8; }
+inline int f425_9(int x) { return x * 9; }
+inline int f425_10(int x) { return x * 10; }
+inline int f425_11(int x) { return x * 11; }
+inline int f425_12(int x) { return x * 12; }
+inline int f425_13(int x) { return x * 13; }
+inline int f425_14(int x) { return x * 14; }
+inline int f425_15(int x) { return x * 15; }
+inline int f425_16(int x) { return x * 16; }
+inline int f425_17(int x) { return x * 17; }
+inline int f425_18(int x) { return x * 18; }
+inline int f425_19(int x) { return x * 19; }
+inline int f425_20(int x) { return x * 20; }
+inline int f425_21(int x) { return x * 21; }
+inline int f425_22(int x) { return x * 22; }
+inline int f425_23(int x) { return x * 23; }
+inline int f425_24(int x) { return x * 24; }
+inline int f425_25(int x) { return x * 25; }
+inline int f425_26(int x) { return x * 26; }
+inline int f425_27(int x) { return x * 27; }
+inline int f425_28(int x) { return x * 28; }
+inline int f425_29(int x) { return x * 29; }
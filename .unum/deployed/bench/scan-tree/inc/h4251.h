@@ -0,0 +1,42 @@
+#pragma once
+/* header 4251 */
+#include <vector>
+#include "h6502.h"
+#include "h4163.h"
+#include "h7928.h"
+#include "h5990.h"
+#include "h2322.h"
+#ifdef X
+#include "h3634.h"
+#endif
+struct S4251 { int a; const char *s = "x//y"; };
+inline int f4251_0(int x) { return x * 0; }
+inline int f4251_1(int x) { return x * 1; }
+inline int f4251_2(int x) { return x * 2; }
+inline int f4251_3(int x) { return x * 3; }
+inline int f4251_4(int x) { return x * 4; }
+inline int f4251_5(int x) { return x * 5; }
+inline int f4251_6(int x) { return x * 6; }
+inline int f4251_7(int x) { return x * 7; }
+inline int f4251_8(int x) { return x * 8; }
+inline int f4251_9(int x) { return x * 9; }
+inline int f4251_10(int x) { return x * 10; }
+inline int f4251_11(int x) { return x * 11; }
+inline int f4251_12(int x) { return x * 12; }
+inline int f4251_13(int x) { return x * 13; }
+inline int f4251_14(int x) { return x * 14; }
+inline int f4251_15(int x) { return x * 15; }
+inline int f4251_16(int x) { return x * 16; }
+inline int f4251_17(int x) { return x * 17; }
+inline int f4251_18(int x) { return x * 18; }
+inline int f4251_19(int x) { return x * 19; }
+inline int f4251_20(int x) { return x * 20; }
+inline int f4251_21(int x) { return x * 21; }
+inline int f4251_22(int x) { return x * 22; }
+inline int f4251_23(int x) { return x * 23; }
+inline int f4251_24(int x) { return x * 24; }
+inline int f4251_25(int x) { return x * 25; }
+inline int f4251_26(int x) { return x * 26; }
+inline int f4251_27(int x) { return x * 27; }
+inline int f4251_28(int x) { return x * 28; }
+inline int f4251_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4255 */
+#include <vector>
+#include "h2341.h"
+#include "h2664.h"
+#include "h5168.h"
+#include "h5229.h"
+#include "h2235.h"
+#ifdef X
+#include "h8140.h"
+#endif
+struct S4255 { int a; const char *s = "x//y"; };
+inline int f4255_0(int x) { return x * 0; }
+inline int f4255_1(int x) { return x * 1; }
+inline int f4255_2(int x) { return x * 2; }
+inline int f4255_3(int x) { return x * 3; }
+inline int f4255_4(int x) { return x * 4; }
+inline int f4255_5(int x) { return x * 5; }
+inline int f4255_6(int x) { return x * 6; }
+inline int f4255_7(int x) { return x * 7; }
+inline int f4255_8(int x) { return x * 8; }
+inline int f4255_9(int x) { return x * 9; }
+inline int f4255_10(int x) { return x * 10; }
+inline int f4255_11(int x) { return x * 11; }
+inline int f4255_12(int x) { return x * 12; }
+inline int f4255_13(int x) { return x * 13; }
+inline int f4255_14(int x) { return x * 14; }
+inline int f4255_15(int x) { return x * 15; }
+inline int f4255_16(int x) { return x * 16; }
+inline int f4255_17(int x) { return x * 17; }
+inline int f4255_18(int x) { return x * 18; }
+inline int f4255_19(int x) { return x * 19; }
+inline int f4255_20(int x) { return x * 20; }
+inline int f4255_21(int x) { return x * 21; }
+inline int f4255_22(int x) { return x * 22; }
+inline int f4255_23(int x) { return x * 23; }
+inline int f4255_24(int x) { return x * 24; }
+inline int f4255_25(int x) { return x * 25; }
+inline int f4255_26(int x) { return x * 26; }
+inline int f4255_27(int x) { return x * 27; }
+inline int f4255_28(int x) { return x * 28; }
+inline int f4255_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4256 */
+#include <vector>
+#include "h1136.h"
+#include "h1063.h"
+#include "h3704.h"
+#include "h731.h"
+#include "h1592.h"
+#ifdef X
+#include "h1599.h"
+#endif
+struct S4256 { int a; const char *s = "x//y"; };
+inline int f4256_0(int x) { return x * 0; }
+inline int f4256_1(int x) { return x * 1; }
+inline int f4256_2(int x) { return x * 2; }
+inline int f4256_3(int x) { return x * 3; }
+inline int f4256_4(int x) { return x * 4; }
+inline int f4256_5(int x) { return x * 5; }
+inline int f4256_6(int x) { return x * 6; }
+inline int f4256_7(int x) { return x * 7; }
+inline int f4256_8(int x) { return x * 8; }
+inline int f4256_9(int x) { return x * 9; }
+inline int f4256_10(int x) { return x * 10; }
+inline int f4256_11(int x) { return x * 11; }
+inline int f4256_12(int x) { return x * 12; }
+inline int f4256_13(int x) { return x * 13; }
+inline int f4256_14(int x) { return x * 14; }
+inline int f4256_15(int x) { return x * 15; }
+inline int f4256_16(int x) { return x * 16; }
+inline int f4256_17(int x) { return x * 17; }
+inline int f4256_18(int x) { return x * 18; }
+inline int f4256_19(int x) { return x * 19; }
+inline int f4256_20(int x) { return x * 20; }
+inline int f4256_21(int x) { return x * 21; }
+inline int f4256_22(int x) { return x * 22; }
+inline int f4256_23(int x) { return x * 23; }
+inline int f4256_24(int x) { return x * 24; }
+inline int f4256_25(int x) { return x * 25; }
+inline int f4256_26(int x) { return x * 26; }
+inline int f4256_27(int x) { return x * 27; }
+inline int f4256_28(int x) { return x * 28; }
+inline int f4256_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4262 */
+#include <vector>
+#include "h1918.h"
+#include "h1526.h"
+#include "h9699.h"
+#include "h7723.h"
+#include "h1986.h"
+#ifdef X
+#include "h8555.h"
+#endif
+struct S4262 { int a; const char *s = "x//y"; };
+inline int f4262_0(int x) { return x * 0; }
+inline int f4262_1(int x) { return x * 1; }
+inline int f4262_2(int x) { return x * 2; }
+inline int f4262_3(int x) { return x * 3; }
+inline int f4262_4(int x) { return x * 4; }
+inline int f4262_5(int x) { return x * 5; }
+inline int f4262_6(int x) { return x * 6; }
+inline int f4262_7(int x) { return x * 7; }
+inline int f4262_8(int x) { return x * 8; }
+inline int f4262_9(int x) { return x * 9; }
+inline int f4262_10(int x) { return x * 10; }
+inline int f4262_11(int x) { return x * 11; }
+inline int f4262_12(int x) { return x * 12; }
+inline int f4262_13(int x) { return x * 13; }
+inline int f4262_14(int x) { return x * 14; }
+inline int f4262_15(int x) { return x * 15; }
+inline int f4262_16(int x) { return x * 16; }
+inline int f4262_17(int x) { return x * 17; }
+inline int f4262_18(int x) { return x * 18; }
+inline int f4262_19(int x) { return x * 19; }
+inline int f4262_20(int x) { return x * 20; }
+inline int f4262_21(int x) { return x * 21; }
+inline int f4262_22(int x) { return x * 22; }
+inline int f4262_23(int x) { return x * 23; }
+inline int f4262_24(int x) { return x * 24; }
+inline int f4262_25(int x) { return x * 25; }
+inline int f4262_26(int x) { return x * 26; }
+inline int f4262_27(int x) { return x * 27; }
+inline int f4262_28(int x) { return x * 28; }
+inline int f4262_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4265 */
+#include <vector>
+#include "h909.h"
+#include "h4718.h"
+#include "h6451.h"
+#include "h6818.h"
+#include "h3749.h"
+#ifdef X
+#include "h6554.h"
+#endif
+struct S4265 { int a; const char *s = "x//y"; };
+inline int f4265_0(int x) { return x * 0; }
+inline int f4265_1(int x) { return x * 1; }
+inline int f4265_2(int x) { return x * 2; }
+inline int f4265_3(int x) { return x * 3; }
+inline int f4265_4(int x) { return x * 4; }
+inline int f4265_5(int x) { return x * 5; }
+inline int f4265_6(int x) { return x * 6; }
+inline int f4265_7(int x) { return x * 7; }
+inline int f4265_8(int x) { return x * 8; }
+inline int f4265_9(int x) { return x * 9; }
+inline int f4265_10(int x) { return x * 10; }
+inline int f4265_11(int x) { return x * 11; }
+inline int f4265_12(int x) { return x * 12; }
+inline int f4265_13(int x) { return x * 13; }
+inline int f4265_14(int x) { return x * 14; }
+inline int f4265_15(int x) { return x * 15; }
+inline int f4265_16(int x) { return x * 16; }
+inline int f4265_17(int x) { return x * 17; }
+inline int f4265_18(int x) { return x * 18; }
+inline int f4265_19(int x) { return x * 19; }
+inline int f4265_20(int x) { return x * 20; }
+inline int f4265_21(int x) { return x * 21; }
+inline int f4265_22(int x) { return x * 22; }
+inline int f4265_23(int x) { return x * 23; }
+inline int f4265_24(int x) { return x * 24; }
+inline int f4265_25(int x) { return x * 25; }
+inline int f4265_26(int x) { return x * 26; }
+inline int f4265_27(int x) { return x * 27; }
+inline int f4265_28(int x) { return x * 28; }
+inline int f4265_29(int x) { return x * 29; }
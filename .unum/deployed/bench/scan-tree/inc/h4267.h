@@ -0,0 +1,42 @@
+#pragma once
+/* header 4267 */
+#include <vector>
+#include "h7869.h"
+#include "h8338.h"
+#include "h1851.h"
+#include "h1178.h"
+#include "h528.h"
+#ifdef X
+#include "h9511.h"
+#endif
+struct S4267 { int a; const char *s = "x//y"; };
+inline int f4267_0(int x) { return x * 0; }
+inline int f4267_1(int x) { return x * 1; }
+inline int f4267_2(int x) { return x * 2; }
+inline int f4267_3(int x) { return x * 3; }
+inline int f4267_4(int x) { return x * 4; }
+inline int f4267_5(int x) { return x * 5; }
+inline int f4267_6(int x) { return x * 6; }
+inline int f4267_7(int x) { return x * 7; }
+inline int f4267_8(int x) { return x * 8; }
+inline int f4267_9(int x) { return x * 9; }
+inline int f4267_10(int x) { return x * 10; }
+inline int f4267_11(int x) { return x * 11; }
+inline int f4267_12(int x) { return x * 12; }
+inline int f4267_13(int x) { return x * 13; }
+inline int f4267_14(int x) { return x * 14; }
+inline int f4267_15(int x) { return x * 15; }
+inline int f4267_16(int x) { return x * 16; }
+inline int f4267_17(int x) { return x * 17; }
+inline int f4267_18(int x) { return x * 18; }
+inline int f4267_19(int x) { return x * 19; }
+inline int f4267_20(int x) { return x * 20; }
+inline int f4267_21(int x) { return x * 21; }
+inline int f4267_22(int x) { return x * 22; }
+inline int f4267_23(int x) { return x * 23; }
+inline int f4267_24(int x) { return x * 24; }
+inline int f4267_25(int x) { return x * 25; }
+inline int f4267_26(int x) { return x * 26; }
+inline int f4267_27(int x) { return x * 27; }
+inline int f4267_28(int x) { return x * 28; }
+inline int f4267_29(int x) { return x * 29; }
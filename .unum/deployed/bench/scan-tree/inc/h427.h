@@ -0,0 +1,42 @@
+#pragma once
+/* header 427 */
+#include <vector>
+#include "h3292.h"
+#include "h6234.h"
+#include "h6283.h"
+#include "h9141.h"
+#include "h1865.h"
+#ifdef X
+#include "h1203.h"
+#endif
+struct S427 { int a; const char *s = "x//y"; };
+inline int f427_0(int x) { return x * 0; }
+inline int f427_1(int x) { return x * 1; }
+inline int f427_2(int x) { return x * 2; }
+inline int f427_3(int x) { return x * 3; }
+inline int f427_4(int x) { return x * 4; }
+inline int f427_5(int x) { return x * 5; }
+inline int f427_6(int x) { return x * 6; }
+inline int f427_7(int x) { return x * 7; }
+inline int f427_8(int x) { return x * 8; }
+inline int f427_9(int x) { return x * 9; }
+inline int f427_10(int x) { return x * 10; }
+inline int f427_11(int x) { return x * 11; }
+inline int f427_12(int x) { return x * 12; }
+inline int f427_13(int x) { return x * 13; }
+inline int f427_14(int x) { return x * 14; }
+inline int f427_15(int x) { return x * 15; }
+inline int f427_16(int x) { return x * 16; }
+inline int f427_17(int x) { return x * 17; }
+inline int f427_18(int x) { return x * 18; }
+inline int f427_19(int x) { return x * 19; }
+inline int f427_20(int x) { return x * 20; }
+inline int f427_21(int x) { return x * 21; }
+inline int f427_22(int x) { return x * 22; }
+inline int f427_23(int x) { return x * 23; }
+inline int f427_24(int x) { return x * 24; }
+inline int f427_25(int x) { return x * 25; }
+inline int f427_26(int x) { return x * 26; }
+inline int f427_27(int x) { return x * 27; }
+inline int f427_28(int x) { return x * 28; }
+inline int f427_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4270 */
+#include <vector>
+#include "h1597.h"
+#include "h7061.h"
+#include "h6798.h"
+#include "h9230.h"
+#include "h1707.h"
+#ifdef X
+#include "h5549.h"
+#endif
+struct S4270 { int a; const char *s = "x//y"; };
+inline int f4270_0(int x) { return x * 0; }
+inline int f4270_1(int x) { return x * 1; }
+inline int f4270_2(int x) { return x * 2; }
+inline int f4270_3(int x) { return x * 3; }
+inline int f4270_4(int x) { return x * 4; }
+inline int f4270_5(int x) { return x * 5; }
+inline int f4270_6(int x) { return x * 6; }
+inline int f4270_7(int x) { return x * 7; }
+inline int f4270_8(int x) { return x * 8; }
+inline int f4270_9(int x) { return x * 9; }
+inline int f4270_10(int x) { return x * 10; }
+inline int f4270_11(int x) { return x * 11; }
+inline int f4270_12(int x) { return x * 12; }
+inline int f4270_13(int x) { return x * 13; }
+inline int f4270_14(int x) { return x * 14; }
+inline int f4270_15(int x) { return x * 15; }
+inline int f4270_16(int x) { return x * 16; }
+inline int f4270_17(int x) { return x * 17; }
+inline int f4270_18(int x) { return x * 18; }
+inline int f4270_19(int x) { return x * 19; }
+inline int f4270_20(int x) { return x * 20; }
+inline int f4270_21(int x) { return x * 21; }
+inline int f4270_22(int x) { return x * 22; }
+inline int f4270_23(int x) { return x * 23; }
+inline int f4270_24(int x) { return x * 24; }
+inline int f4270_25(int x) { return x * 25; }
+inline int f4270_26(int x) { return x * 26; }
+inline int f4270_27(int x) { return x * 27; }
+inline int f4270_28(int x) { return x * 28; }
+inline int f4270_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4271 */
+#include <vector>
+#include "h393.h"
+#include "h3268.h"
+#include "h5420.h"
+#include "h1347.h"
+#include "h3782.h"
+#ifdef X
+#include "h3938.h"
+#endif
+struct S4271 { int a; const char *s = "x//y"; };
+inline int f4271_0(int x) { return x * 0; }
+inline int f4271_1(int x) { return x * 1; }
+inline int f4271_2(int x) { return x * 2; }
+inline int f4271_3(int x) { return x * 3; }
+inline int f4271_4(int x) { return x * 4; }
+inline int f4271_5(int x) { return x * 5; }
+inline int f4271_6(int x) { return x * 6; }
+inline int f4271_7(int x) { return x * 7; }
+inline int f4271_8(int x) { return x * 8; }
+inline int f4271_9(int x) { return x * 9; }
+inline int f4271_10(int x) { return x * 10; }
+inline int f4271_11(int x) { return x * 11; }
+inline int f4271_12(int x) { return x * 12; }
+inline int f4271_13(int x) { return x * 13; }
+inline int f4271_14(int x) { return x * 14; }
+inline int f4271_15(int x) { return x * 15; }
+inline int f4271_16(int x) { return x * 16; }
+inline int f4271_17(int x) { return x * 17; }
+inline int f4271_18(int x) { return x * 18; }
+inline int f4271_19(int x) { return x * 19; }
+inline int f4271_20(int x) { return x * 20; }
+inline int f4271_21(int x) { return x * 21; }
+inline int f4271_22(int x) { return x * 22; }
+inline int f4271_23(int x) { return x * 23; }
+inline int f4271_24(int x) { return x * 24; }
+inline int f4271_25(int x) { return x * 25; }
+inline int f4271_26(int x) { return x * 26; }
+inline int f4271_27(int x) { return x * 27; }
+inline int f4271_28(int x) { return x * 28; }
+inline int f4271_29(int x) { return x * 29; }
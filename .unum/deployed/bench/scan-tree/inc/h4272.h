@@ -0,0 +1,42 @@
+#pragma once
+/* header 4272 */
+#include <vector>
+#include "h4650.h"
+#include "h1792.h"
+#include "h3813.h"
+#include "h8542.h"
+#include "h2097.h"
+#ifdef X
+#include "h6759.h"
+#endif
+struct S4272 { int a; const char *s = "x//y"; };
+inline int f4272_0(int x) { return x * 0; }
+inline int f4272_1(int x) { return x * 1; }
+inline int f4272_2(int x) { return x * 2; }
+inline int f4272_3(int x) { return x * 3; }
+inline int f4272_4(int x) { return x * 4; }
+inline int f4272_5(int x) { return x * 5; }
+inline int f4272_6(int x) { return x * 6; }
+inline int f4272_7(int x) { return x * 7; }
+inline int f4272_8(int x) { return x * 8; }
+inline int f4272_9(int x) { return x * 9; }
+inline int f4272_10(int x) { return x * 10; }
+inline int f4272_11(int x) { return x * 11; }
+inline int f4272_12(int x) { return x * 12; }
+inline int f4272_13(int x) { return x * 13; }
+inline int f4272_14(int x) { return x * 14; }
+inline int f4272_15(int x) { return x * 15; }
+inline int f4272_16(int x) { return x * 16; }
+inline int f4272_17(int x) { return x * 17; }
+inline int f4272_18(int x) { return x * 18; }
+inline int f4272_19(int x) { return x * 19; }
+inline int f4272_20(int x) { return x * 20; }
+inline int f4272_21(int x) { return x * 21; }
+inline int f4272_22(int x) { return x * 22; }
+inline int f4272_23(int x) { return x * 23; }
+inline int f4272_24(int x) { return x * 24; }
+inline int f4272_25(int x) { return x * 25; }
+inline int f4272_26(int x) { return x * 26; }
+inline int f4272_27(int x) { return x * 27; }
+inline int f4272_28(int x) { return x * 28; }
+inline int f4272_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4274 */
+#include <vector>
+#include "h4218.h"
+#include "h5833.h"
+#include "h8660.h"
+#include "h8445.h"
+#include "h3709.h"
+#ifdef X
+#include "h4843.h"
+#endif
+struct S4274 { int a; const char *s = "x//y"; };
+inline int f4274_0(int x) { return x * 0; }
+inline int f4274_1(int x) { return x * 1; }
+inline int f4274_2(int x) { return x * 2; }
+inline int f4274_3(int x) { return x * 3; }
+inline int f4274_4(int x) { return x * 4; }
+inline int f4274_5(int x) { return x * 5; }
+inline int f4274_6(int x) { return x * 6; }
+inline int f4274_7(int x) { return x * 7; }
+inline int f4274_8(int x) { return x * 8; }
+inline int f4274_9(int x) { return x * 9; }
+inline int f4274_10(int x) { return x * 10; }
+inline int f4274_11(int x) { return x * 11; }
+inline int f4274_12(int x) { return x * 12; }
+inline int f4274_13(int x) { return x * 13; }
+inline int f4274_14(int x) { return x * 14; }
+inline int f4274_15(int x) { return x * 15; }
+inline int f4274_16(int x) { return x * 16; }
+inline int f4274_17(int x) { return x * 17; }
+inline int f4274_18(int x) { return x * 18; }
+inline int f4274_19(int x) { return x * 19; }
+inline int f4274_20(int x) { return x * 20; }
+inline int f4274_21(int x) { return x * 21; }
+inline int f4274_22(int x) { return x * 22; }
+inline int f4274_23(int x) { return x * 23; }
+inline int f4274_24(int x) { return x * 24; }
+inline int f4274_25(int x) { return x * 25; }
+inline int f4274_26(int x) { return x * 26; }
+inline int f4274_27(int x) { return x * 27; }
+inline int f4274_28(int x) { return x * 28; }
+inline int f4274_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4276 */
+#include <vector>
+#include "h510.h"
+#include "h7579.h"
+#include "h6200.h"
+#include "h8419.h"
+#include "h4354.h"
+#ifdef X
+#include "h6381.h"
+#endif
+struct S4276 { int a; const char *s = "x//y"; };
+inline int f4276_0(int x) { return x * 0; }
+inline int f4276_1(int x) { return x * 1; }
+inline int f4276_2(int x) { return x * 2; }
+inline int f4276_3(int x) { return x * 3; }
+inline int f4276_4(int x) { return x * 4; }
+inline int f4276_5(int x) { return x * 5; }
+inline int f4276_6(int x) { return x * 6; }
+inline int f4276_7(int x) { return x * 7; }
+inline int f4276_8(int x) { return x * 8; }
+inline int f4276_9(int x) { return x * 9; }
+inline int f4276_10(int x) { return x * 10; }
+inline int f4276_11(int x) { return x * 11; }
+inline int f4276_12(int x) { return x * 12; }
+inline int f4276_13(int x) { return x * 13; }
+inline int f4276_14(int x) { return x * 14; }
+inline int f4276_15(int x) { return x * 15; }
+inline int f4276_16(int x) { return x * 16; }
+inline int f4276_17(int x) { return x * 17; }
+inline int f4276_18(int x) { return x * 18; }
+inline int f4276_19(int x) { return x * 19; }
+inline int f4276_20(int x) { return x * 20; }
+inline int f4276_21(int x) { return x * 21; }
+inline int f4276_22(int x) { return x * 22; }
+inline int f4276_23(int x) { return x * 23; }
+inline int f4276_24(int x) { return x * 24; }
+inline int f4276_25(int x) { return x * 25; }
+inline int f4276_26(int x) { return x * 26; }
+inline int f4276_27(int x) { return x * 27; }
+inline int f4276_28(int x) { return x * 28; }
+inline int f4276_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4279 */
+#include <vector>
+#include "h9083.h"
+#include "h7620.h"
+#include "h3462.h"
+#include "h9267.h"
+#include "h4631.h"
+#ifdef X
+#include "h3090.h"
+#endif
+struct S4279 { int a; const char *s = "x//y"; };
+inline int f4279_0(int x) { return x * 0; }
+inline int f4279_1(int x) { return x * 1; }
+inline int f4279_2(int x) { return x * 2; }
+inline int f4279_3(int x) { return x * 3; }
+inline int f4279_4(int x) { return x * 4; }
+inline int f4279_5(int x) { return x * 5; }
+inline int f4279_6(int x) { return x * 6; }
+inline int f4279_7(int x) { return x * 7; }
+inline int f4279_8(int x) { return x * 8; }
+inline int f4279_9(int x) { return x * 9; }
+inline int f4279_10(int x) { return x * 10; }
+inline int f4279_11(int x) { return x * 11; }
+inline int f4279_12(int x) { return x * 12; }
+inline int f4279_13(int x) { return x * 13; }
+inline int f4279_14(int x) { return x * 14; }
+inline int f4279_15(int x) { return x * 15; }
+inline int f4279_16(int x) { return x * 16; }
+inline int f4279_17(int x) { return x * 17; }
+inline int f4279_18(int x) { return x * 18; }
+inline int f4279_19(int x) { return x * 19; }
+inline int f4279_20(int x) { return x * 20; }
+inline int f4279_21(int x) { return x * 21; }
+inline int f4279_22(int x) { return x * 22; }
+inline int f4279_23(int x) { return x * 23; }
+inline int f4279_24(int x) { return x * 24; }
+inline int f4279_25(int x) { return x * 25; }
+inline int f4279_26(int x) { return x * 26; }
+inline int f4279_27(int x) { return x * 27; }
+inline int f4279_28(int x) { return x * 28; }
+inline int f4279_29(int x) { return x * 29; }
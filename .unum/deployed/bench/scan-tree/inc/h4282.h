@@ -0,0 +1,42 @@
+#pragma once
+/* header 4282 */
+#include <vector>
+#include "h3265.h"
+#include "h7482.h"
+#include "h9696.h"
+#include "h1062.h"
+#include "h5828.h"
+#ifdef X
+#include "h4350.h"
+#endif
+struct S4282 { int a; const char *s = "x//y"; };
+inline int f4282_0(int x) { return x * 0; }
+inline int f4282_1(int x) { return x * 1; }
+inline int f4282_2(int x) { return x * 2; }
+inline int f4282_3(int x) { return x * 3; }
+inline int f4282_4(int x) { return x * 4; }
+inline int f4282_5(int x) { return x * 5; }
+inline int f4282_6(int x) { return x * 6; }
+inline int f4282_7(int x) { return x * 7; }
+inline int f4282_8(int x) { return x * 8; }
+inline int f4282_9(int x) { return x * 9; }
+inline int f4282_10(int x) { return x * 10; }
+inline int f4282_11(int x) { return x * 11; }
+inline int f4282_12(int x) { return x * 12; }
+inline int f4282_13(int x) { return x * 13; }
+inline int f4282_14(int x) { return x * 14; }
+inline int f4282_15(int x) { return x * 15; }
+inline int f4282_16(int x) { return x * 16; }
+inline int f4282_17(int x) { return x * 17; }
+inline int f4282_18(int x) { return x * 18; }
+inline int f4282_19(int x) { return x * 19; }
+inline int f4282_20(int x) { return x * 20; }
+inline int f4282_21(int x) { return x * 21; }
+inline int f4282_22(int x) { return x * 22; }
+inline int f4282_23(int x) { return x * 23; }
+inline int f4282_24(int x) { return x * 24; }
+inline int f4282_25(int x) { return x * 25; }
+inline int f4282_26(int x) { return x * 26; }
+inline int f4282_27(int x) { return x * 27; }
+inline int f4282_28(int x) { return x * 28; }
+inline int f4282_29(int x) { return x * 29; }
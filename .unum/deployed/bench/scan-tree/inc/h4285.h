@@ -0,0 +1,42 @@
+#pragma once
+/* header 4285 */
+#include <vector>
+#include "h4075.h"
+#include "h9577.h"
+#include "h3113.h"
+#include "h3122.h"
+#include "h7772.h"
+#ifdef X
+#include "h3620.h"
+#endif
+struct S4285 { int a; const char *s = "x//y"; };
+inline int f4285_0(int x) { return x * 0; }
+inline int f4285_1(int x) { return x * 1; }
+inline int f4285_2(int x) { return x * 2; }
+inline int f4285_3(int x) { return x * 3; }
+inline int f4285_4(int x) { return x * 4; }
+inline int f4285_5(int x) { return x * 5; }
+inline int f4285_6(int x) { return x * 6; }
+inline int f4285_7(int x) { return x * 7; }
+inline int f4285_8(int x) { return x * 8; }
+inline int f4285_9(int x) { return x * 9; }
+inline int f4285_10(int x) { return x * 10; }
+inline int f4285_11(int x) { return x * 11; }
+inline int f4285_12(int x) { return x * 12; }
+inline int f4285_13(int x) { return x * 13; }
+inline int f4285_14(int x) { return x * 14; }
+inline int f4285_15(int x) { return x * 15; }
+inline int f4285_16(int x) { return x * 16; }
+inline int f4285_17(int x) { return x * 17; }
+inline int f4285_18(int x) { return x * 18; }
+inline int f4285_19(int x) { return x * 19; }
+inline int f4285_20(int x) { return x * 20; }
+inline int f4285_21(int x) { return x * 21; }
+inline int f4285_22(int x) { return x * 22; }
+inline int f4285_23(int x) { return x * 23; }
+inline int f4285_24(int x) { return x * 24; }
+inline int f4285_25(int x) { return x * 25; }
+inline int f4285_26(int x) { return x * 26; }
+inline int f4285_27(int x) { return x * 27; }
+inline int f4285_28(int x) { return x * 28; }
+inline int f4285_29(int x) { return x * 29; }
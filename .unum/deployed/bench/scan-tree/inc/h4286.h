@@ -0,0 +1,42 @@
+#pragma once
+/* header 4286 */
+#include <vector>
+#include "h4318.h"
+#include "h1192.h"
+#include "h4650.h"
+#include "h7673.h"
+#include "h6920.h"
+#ifdef X
+#include "h7297.h"
+#endif
+struct S4286 { int a; const char *s = "x//y"; };
+inline int f4286_0(int x) { return x * 0; }
+inline int f4286_1(int x) { return x * 1; }
+inline int f4286_2(int x) { return x * 2; }
+inline int f4286_3(int x) { return x * 3; }
+inline int f4286_4(int x) { return x * 4; }
+inline int f4286_5(int x) { return x * 5; }
+inline int f4286_6(int x) { return x * 6; }
+inline int f4286_7(int x) { return x * 7; }
+inline int f4286_8(int x) { return x * 8; }
+inline int f4286_9(int x) { return x * 9; }
+inline int f4286_10(int x) { return x * 10; }
+inline int f4286_11(int x) { return x * 11; }
+inline int f4286_12(int x) { return x * 12; }
+inline int f4286_13(int x) { return x * 13; }
+inline int f4286_14(int x) { return x * 14; }
+inline int f4286_15(int x) { return x * 15; }
+inline int f4286_16(int x) { return x * 16; }
+inline int f4286_17(int x) { return x * 17; }
+inline int f4286_18(int x) { return x * 18; }
+inline int f4286_19(int x) { return x * 19; }
+inline int f4286_20(int x) { return x * 20; }
+inline int f4286_21(int x) { return x * 21; }
+inline int f4286_22(int x) { return x * 22; }
+inline int f4286_23(int x) { return x * 23; }
+inline int f4286_24(int x) { return x * 24; }
+inline int f4286_25(int x) { return x * 25; }
+inline int f4286_26(int x) { return x * 26; }
+inline int f4286_27(int x) { return x * 27; }
+inline int f4286_28(int x) { return x * 28; }
+inline int f4286_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4287 */
+#include <vector>
+#include "h7490.h"
+#include "h3112.h"
+#include "h1017.h"
+#include "h9360.h"
+#include "h3942.h"
+#ifdef X
+#include "h1877.h"
+#endif
+struct S4287 { int a; const char *s = "x//y"; };
+inline int f4287_0(int x) { return x * 0; }
+inline int f4287_1(int x) { return x * 1; }
+inline int f4287_2(int x) { return x * 2; }
+inline int f4287_3(int x) { return x * 3; }
+inline int f4287_4(int x) { return x * 4; }
+inline int f4287_5(int x) { return x * 5; }
+inline int f4287_6(int x) { return x * 6; }
+inline int f4287_7(int x) { return x * 7; }
+inline int f4287_8(int x) { return x * 8; }
+inline int f4287_9(int x) { return x * 9; }
+inline int f4287_10(int x) { return x * 10; }
+inline int f4287_11(int x) { return x * 11; }
+inline int f4287_12(int x) { return x * 12; }
+inline int f4287_13(int x) { return x * 13; }
+inline int f4287_14(int x) { return x * 14; }
+inline int f4287_15(int x) { return x * 15; }
+inline int f4287_16(int x) { return x * 16; }
+inline int f4287_17(int x) { return x * 17; }
+inline int f4287_18(int x) { return x * 18; }
+inline int f4287_19(int x) { return x * 19; }
+inline int f4287_20(int x) { return x * 20; }
+inline int f4287_21(int x) { return x * 21; }
+inline int f4287_22(int x) { return x * 22; }
+inline int f4287_23(int x) { return x * 23; }
+inline int f4287_24(int x) { return x * 24; }
+inline int f4287_25(int x) { return x * 25; }
+inline int f4287_26(int x) { return x * 26; }
+inline int f4287_27(int x) { return x * 27; }
+inline int f4287_28(int x) { return x * 28; }
+inline int f4287_29(int x) { return x * 29; }
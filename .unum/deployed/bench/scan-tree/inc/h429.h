@@ -0,0 +1,42 @@
+#pragma once
+/* header 429 */
+#include <vector>
+#include "h2884.h"
+#include "h5951.h"
+#include "h4849.h"
+#include "h971.h"
+#include "h90.h"
+#ifdef X
+#include "h1898.h"
+#endif
+struct S429 { int a; const char *s = "x//y"; };
+inline int f429_0(int x) { return x * 0; }
+inline int f429_1(int x) { return x * 1; }
+inline int f429_2(int x) { return x * 2; }
+inline int f429_3(int x) { return x * 3; }
+inline int f429_4(int x) { return x * 4; }
+inline int f429_5(int x) { return x * 5; }
+inline int f429_6(int x) { return x * 6; }
+inline int f429_7(int x) { return x * 7; }
+inline int f429_8(int x) { return x * 8; }
+inline int f429_9(int x) { return x * 9; }
+inline int f429_10(int x) { return x * 10; }
+inline int f429_11(int x) { return x * 11; }
+inline int f429_12(int x) { return x * 12; }
+inline int f429_13(int x) { return x * 13; }
+inline int f429_14(int x) { return x * 14; }
+inline int f429_15(int x) { return x * 15; }
+inline int f429_16(int x) { return x * 16; }
+inline int f429_17(int x) { return x * 17; }
+inline int f429_18(int x) { return x * 18; }
+inline int f429_19(int x) { return x * 19; }
+inline int f429_20(int x) { return x * 20; }
+inline int f429_21(int x) { return x * 21; }
+inline int f429_22(int x) { return x * 22; }
+inline int f429_23(int x) { return x * 23; }
+inline int f429_24(int x) { return x * 24; }
+inline int f429_25(int x) { return x * 25; }
+inline int f429_26(int x) { return x * 26; }
+inline int f429_27(int x) { return x * 27; }
+inline int f429_28(int x) { return x * 28; }
+inline int f429_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4290 */
+#include <vector>
+#include "h2362.h"
+#include "h558.h"
+#include "h8931.h"
+#include "h8163.h"
+#include "h484.h"
+#ifdef X
+#include "h3006.h"
+#endif
+struct S4290 { int a; const char *s = "x//y"; };
+inline int f4290_0(int x) { return x * 0; }
+inline int f4290_1(int x) { return x * 1; }
+inline int f4290_2(int x) { return x * 2; }
+inline int f4290_3(int x) { return x * 3; }
+inline int f4290_4(int x) { return x * 4; }
+inline int f4290_5(int x) { return x * 5; }
+inline int f4290_6(int x) { return x * 6; }
+inline int f4290_7(int x) { return x * 7; }
+inline int f4290_8(int x) { return x * 8; }
+inline int f4290_9(int x) { return x * 9; }
+inline int f4290_10(int x) { return x * 10; }
+inline int f4290_11(int x) { return x * 11; }
+inline int f4290_12(int x) { return x * 12; }
+inline int f4290_13(int x) { return x * 13; }
+inline int f4290_14(int x) { return x * 14; }
+inline int f4290_15(int x) { return x * 15; }
+inline int f4290_16(int x) { return x * 16; }
+inline int f4290_17(int x) { return x * 17; }
+inline int f4290_18(int x) { return x * 18; }
+inline int f4290_19(int x) { return x * 19; }
+inline int f4290_20(int x) { return x * 20; }
+inline int f4290_21(int x) { return x * 21; }
+inline int f4290_22(int x) { return x * 22; }
+inline int f4290_23(int x) { return x * 23; }
+inline int f4290_24(int x) { return x * 24; }
+inline int f4290_25(int x) { return x * 25; }
+inline int f4290_26(int x) { return x * 26; }
+inline int f4290_27(int x) { return x * 27; }
+inline int f4290_28(int x) { return x * 28; }
+inline int f4290_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4291 */
+#include <vector>
+#include "h6912.h"
+#include "h4110.h"
+#include "h3462.h"
+#include "h1921.h"
+#include "h8000.h"
+#ifdef X
+#include "h7279.h"
+#endif
+struct S4291 { int a; const char *s = "x//y"; };
+inline int f4291_0(int x) { return x * 0; }
+inline int f4291_1(int x) { return x * 1; }
+inline int f4291_2(int x) { return x * 2; }
+inline int f4291_3(int x) { return x * 3; }
+inline int f4291_4(int x) { return x * 4; }
+inline int f4291_5(int x) { return x * 5; }
+inline int f4291_6(int x) { return x * 6; }
+inline int f4291_7(int x) { return x * 7; }
+inline int f4291_8(int x) { return x * 8; }
+inline int f4291_9(int x) { return x * 9; }
+inline int f4291_10(int x) { return x * 10; }
+inline int f4291_11(int x) { return x * 11; }
+inline int f4291_12(int x) { return x * 12; }
+inline int f4291_13(int x) { return x * 13; }
+inline int f4291_14(int x) { return x * 14; }
+inline int f4291_15(int x) { return x * 15; }
+inline int f4291_16(int x) { return x * 16; }
+inline int f4291_17(int x) { return x * 17; }
+inline int f4291_18(int x) { return x * 18; }
+inline int f4291_19(int x) { return x * 19; }
+inline int f4291_20(int x) { return x * 20; }
+inline int f4291_21(int x) { return x * 21; }
+inline int f4291_22(int x) { return x * 22; }
+inline int f4291_23(int x) { return x * 23; }
+inline int f4291_24(int x) { return x * 24; }
+inline int f4291_25(int x) { return x * 25; }
+inline int f4291_26(int x) { return x * 26; }
+inline int f4291_27(int x) { return x * 27; }
+inline int f4291_28(int x) { return x * 28; }
+inline int f4291_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4292 */
+#include <vector>
+#include "h8063.h"
+#include "h4108.h"
+#include "h1678.h"
+#include "h2278.h"
+#include "h8480.h"
+#ifdef X
+#include "h7760.h"
+#endif
+struct S4292 { int a; const char *s = "x//y"; };
+inline int f4292_0(int x) { return x * 0; }
+inline int f4292_1(int x) { return x * 1; }
+inline int f4292_2(int x) { return x * 2; }
+inline int f4292_3(int x) { return x * 3; }
+inline int f4292_4(int x) { return x * 4; }
+inline int f4292_5(int x) { return x * 5; }
+inline int f4292_6(int x) { return x * 6; }
+inline int f4292_7(int x) { return x * 7; }
+inline int f4292_8(int x) { return x * 8; }
+inline int f4292_9(int x) { return x * 9; }
+inline int f4292_10(int x) { return x * 10; }
+inline int f4292_11(int x) { return x * 11; }
+inline int f4292_12(int x) { return x * 12; }
+inline int f4292_13(int x) { return x * 13; }
+inline int f4292_14(int x) { return x * 14; }
+inline int f4292_15(int x) { return x * 15; }
+inline int f4292_16(int x) { return x * 16; }
+inline int f4292_17(int x) { return x * 17; }
+inline int f4292_18(int x) { return x * 18; }
+inline int f4292_19(int x) { return x * 19; }
+inline int f4292_20(int x) { return x * 20; }
+inline int f4292_21(int x) { return x * 21; }
+inline int f4292_22(int x) { return x * 22; }
+inline int f4292_23(int x) { return x * 23; }
+inline int f4292_24(int x) { return x * 24; }
+inline int f4292_25(int x) { return x * 25; }
+inline int f4292_26(int x) { return x * 26; }
+inline int f4292_27(int x) { return x * 27; }
+inline int f4292_28(int x) { return x * 28; }
+inline int f4292_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4293 */
+#include <vector>
+#include "h2621.h"
+#include "h4318.h"
+#include "h4044.h"
+#include "h6839.h"
+#include "h3758.h"
+#ifdef X
+#include "h6887.h"
+#endif
+struct S4293 { int a; const char *s = "x//y"; };
+inline int f4293_0(int x) { return x * 0; }
+inline int f4293_1(int x) { return x * 1; }
+inline int f4293_2(int x) { return x * 2; }
+inline int f4293_3(int x) { return x * 3; }
+inline int f4293_4(int x) { return x * 4; }
+inline int f4293_5(int x) { return x * 5; }
+inline int f4293_6(int x) { return x * 6; }
+inline int f4293_7(int x) { return x * 7; }
+inline int f4293_8(int x) { return x * 8; }
+inline int f4293_9(int x) { return x * 9; }
+inline int f4293_10(int x) { return x * 10; }
+inline int f4293_11(int x) { return x * 11; }
+inline int f4293_12(int x) { return x * 12; }
+inline int f4293_13(int x) { return x * 13; }
+inline int f4293_14(int x) { return x * 14; }
+inline int f4293_15(int x) { return x * 15; }
+inline int f4293_16(int x) { return x * 16; }
+inline int f4293_17(int x) { return x * 17; }
+inline int f4293_18(int x) { return x * 18; }
+inline int f4293_19(int x) { return x * 19; }
+inline int f4293_20(int x) { return x * 20; }
+inline int f4293_21(int x) { return x * 21; }
+inline int f4293_22(int x) { return x * 22; }
+inline int f4293_23(int x) { return x * 23; }
+inline int f4293_24(int x) { return x * 24; }
+inline int f4293_25(int x) { return x * 25; }
+inline int f4293_26(int x) { return x * 26; }
+inline int f4293_27(int x) { return x * 27; }
+inline int f4293_28(int x) { return x * 28; }
+inline int f4293_29(int x) { return x * 29; }
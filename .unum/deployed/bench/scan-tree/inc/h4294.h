@@ -0,0 +1,42 @@
+#pragma once
+/* header 4294 */
+#include <vector>
+#include "h6862.h"
+#include "h3339.h"
+#include "h2842.h"
+#include "h7243.h"
+#include "h6295.h"
+#ifdef X
+#include "h6536.h"
+#endif
+struct S4294 { int a; const char *s = "x//y"; };
+inline int f4294_0(int x) { return x * 0; }
+inline int f4294_1(int x) { return x * 1; }
+inline int f4294_2(int x) { return x * 2; }
+inline int f4294_3(int x) { return x * 3; }
+inline int f4294_4(int x) { return x * 4; }
+inline int f4294_5(int x) { return x * 5; }
+inline int f4294_6(int x) { return x * 6; }
+inline int f4294_7(int x) { return x * 7; }
+inline int f4294_8(int x) { return x * 8; }
+inline int f4294_9(int x) { return x * 9; }
+inline int f4294_10(int x) { return x * 10; }
+inline int f4294_11(int x) { return x * 11; }
+inline int f4294_12(int x) { return x * 12; }
+inline int f4294_13(int x) { return x * 13; }
+inline int f4294_14(int x) { return x * 14; }
+inline int f4294_15(int x) { return x * 15; }
+inline int f4294_16(int x) { return x * 16; }
+inline int f4294_17(int x) { return x * 17; }
+inline int f4294_18(int x) { return x * 18; }
+inline int f4294_19(int x) { return x * 19; }
+inline int f4294_20(int x) { return x * 20; }
+inline int f4294_21(int x) { return x * 21; }
+inline int f4294_22(int x) { return x * 22; }
+inline int f4294_23(int x) { return x * 23; }
+inline int f4294_24(int x) { return x * 24; }
+inline int f4294_25(int x) { return x * 25; }
+inline int f4294_26(int x) { return x * 26; }
+inline int f4294_27(int x) { return x * 27; }
+inline int f4294_28(int x) { return x * 28; }
+inline int f4294_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4297 */
+#include <vector>
+#include "h1662.h"
+#include "h4875.h"
+#include "h8331.h"
+#include "h194.h"
+#include "h877.h"
+#ifdef X
+#include "h4507.h"
+#endif
+struct S4297 { int a; const char *s = "x//y"; };
+inline int f4297_0(int x) { return x * 0; }
+inline int f4297_1(int x) { return x * 1; }
+inline int f4297_2(int x) { return x * 2; }
+inline int f4297_3(int x) { return x * 3; }
+inline int f4297_4(int x) { return x * 4; }
+inline int f4297_5(int x) { return x * 5; }
+inline int f4297_6(int x) { return x * 6; }
+inline int f4297_7(int x) { return x * 7; }
+inline int f4297_8(int x) { return x * 8; }
+inline int f4297_9(int x) { return x * 9; }
+inline int f4297_10(int x) { return x * 10; }
+inline int f4297_11(int x) { return x * 11; }
+inline int f4297_12(int x) { return x * 12; }
+inline int f4297_13(int x) { return x * 13; }
+inline int f4297_14(int x) { return x * 14; }
+inline int f4297_15(int x) { return x * 15; }
+inline int f4297_16(int x) { return x * 16; }
+inline int f4297_17(int x) { return x * 17; }
+inline int f4297_18(int x) { return x * 18; }
+inline int f4297_19(int x) { return x * 19; }
+inline int f4297_20(int x) { return x * 20; }
+inline int f4297_21(int x) { return x * 21; }
+inline int f4297_22(int x) { return x * 22; }
+inline int f4297_23(int x) { return x * 23; }
+inline int f4297_24(int x) { return x * 24; }
+inline int f4297_25(int x) { return x * 25; }
+inline int f4297_26(int x) { return x * 26; }
+inline int f4297_27(int x) { return x * 27; }
+inline int f4297_28(int x) { return x * 28; }
+inline int f4297_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4299 */
+#include <vector>
+#include "h4758.h"
+#include "h3608.h"
+#include "h2302.h"
+#include "h5235.h"
+#include "h7272.h"
+#ifdef X
+#include "h197.h"
+#endif
+struct S4299 { int a; const char *s = "x//y"; };
+inline int f4299_0(int x) { return x * 0; }
+inline int f4299_1(int x) { return x * 1; }
+inline int f4299_2(int x) { return x * 2; }
+inline int f4299_3(int x) { return x * 3; }
+inline int f4299_4(int x) { return x * 4; }
+inline int f4299_5(int x) { return x * 5; }
+inline int f4299_6(int x) { return x * 6; }
+inline int f4299_7(int x) { return x * 7; }
+inline int f4299_8(int x) { return x * 8; }
+inline int f4299_9(int x) { return x * 9; }
+inline int f4299_10(int x) { return x * 10; }
+inline int f4299_11(int x) { return x * 11; }
+inline int f4299_12(int x) { return x * 12; }
+inline int f4299_13(int x) { return x * 13; }
+inline int f4299_14(int x) { return x * 14; }
+inline int f4299_15(int x) { return x * 15; }
+inline int f4299_16(int x) { return x * 16; }
+inline int f4299_17(int x) { return x * 17; }
+inline int f4299_18(int x) { return x * 18; }
+inline int f4299_19(int x) { return x * 19; }
+inline int f4299_20(int x) { return x * 20; }
+inline int f4299_21(int x) { return x * 21; }
+inline int f4299_22(int x) { return x * 22; }
+inline int f4299_23(int x) { return x * 23; }
+inline int f4299_24(int x) { return x * 24; }
+inline int f4299_25(int x) { return x * 25; }
+inline int f4299_26(int x) { return x * 26; }
+inline int f4299_27(int x) { return x * 27; }
+inline int f4299_28(int x) { return x * 28; }
+inline int f4299_29(int x) { return x * 29; }
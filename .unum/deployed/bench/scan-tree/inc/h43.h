@@ -0,0 +1,42 @@
+#pragma once
+/* header 43 */
+#include <vector>
+#include "h6606.h"
+#include "h5405.h"
+#include "h9436.h"
+#include "h799.h"
+#include "h1480.h"
+#ifdef X
+#include "h6427.h"
+#endif
+struct S43 { int a; const char *s = "x//y"; };
+inline int f43_0(int x) { return x * 0; }
+inline int f43_1(int x) { return x * 1; }
+inline int f43_2(int x) { return x * 2; }
+inline int f43_3(int x) { return x * 3; }
+inline int f43_4(int x) { return x * 4; }
+inline int f43_5(int x) { return x * 5; }
+inline int f43_6(int x) { return x * 6; }
+inline int f43_7(int x) { return x * 7; }
+inline int f43_8(int x) { return x * 8; }
+inline int f43_9(int x) { return x * 9; }
+inline int f43_10(int x) { return x * 10; }
+inline int f43_11(int x) { return x * 11; }
+inline int f43_12(int x) { return x * 12; }
+inline int f43_13(int x) { return x * 13; }
+inline int f43_14(int x) { return x * 14; }
+inline int f43_15(int x) { return x * 15; }
+inline int f43_16(int x) { return x * 16; }
+inline int f43_17(int x) { return x * 17; }
+inline int f43_18(int x) { return x * 18; }
+inline int f43_19(int x) { return x * 19; }
+inline int f43_20(int x) { return x * 20; }
+inline int f43_21(int x) { return x * 21; }
+inline int f43_22(int x) { return x * 22; }
+inline int f43_23(int x) { return x * 23; }
+inline int f43_24(int x) { return x * 24; }
+inline int f43_25(int x) { return x * 25; }
+inline int f43_26(int x) { return x * 26; }
+inline int f43_27(int x) { return x * 27; }
+inline int f43_28(int x) { return x * 28; }
+inline int f43_29(int x) { return x * 29; }
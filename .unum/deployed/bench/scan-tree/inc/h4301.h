@@ -0,0 +1,42 @@
+#pragma once
+/* header 4301 */
+#include <vector>
+#include "h6640.h"
+#include "h6627.h"
+#include "h6896.h"
+#include "h8337.h"
+#include "h4651.h"
+#ifdef X
+#include "h5939.h"
+#endif
+struct S4301 { int a; const char *s = "x//y"; };
+inline int f4301_0(int x) { return x * 0; }
+inline int f4301_1(int x) { return x * 1; }
+inline int f4301_2(int x) { return x * 2; }
+inline int f4301_3(int x) { return x * 3; }
+inline int f4301_4(int x) { return x * 4; }
+inline int f4301_5(int x) { return x * 5; }
+inline int f4301_6(int x) { return x * 6; }
+inline int f4301_7(int x) { return x * 7; }
+inline int f4301_8(int x) { return x * 8; }
+inline int f4301_9(int x) { return x * 9; }
+inline int f4301_10(int x) { return x * 10; }
+inline int f4301_11(int x) { return x * 11; }
+inline int f4301_12(int x) { return x * 12; }
+inline int f4301_13(int x) { return x * 13; }
+inline int f4301_14(int x) { return x * 14; }
+inline int f4301_15(int x) { return x * 15; }
+inline int f4301_16(int x) { return x * 16; }
+inline int f4301_17(int x) { return x * 17; }
+inline int f4301_18(int x) { return x * 18; }
+inline int f4301_19(int x) { return x * 19; }
+inline int f4301_20(int x) { return x * 20; }
+inline int f4301_21(int x) { return x * 21; }
+inline int f4301_22(int x) { return x * 22; }
+inline int f4301_23(int x) { return x * 23; }
+inline int f4301_24(int x) { return x * 24; }
+inline int f4301_25(int x) { return x * 25; }
+inline int f4301_26(int x) { return x * 26; }
+inline int f4301_27(int x) { return x * 27; }
+inline int f4301_28(int x) { return x * 28; }
+inline int f4301_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4302 */
+#include <vector>
+#include "h6290.h"
+#include "h1342.h"
+#include "h4997.h"
+#include "h8502.h"
+#include "h4984.h"
+#ifdef X
+#include "h7500.h"
+#endif
+struct S4302 { int a; const char *s = "x//y"; };
+inline int f4302_0(int x) { return x * 0; }
+inline int f4302_1(int x) { return x * 1; }
+inline int f4302_2(int x) { return x * 2; }
+inline int f4302_3(int x) { return x * 3; }
+inline int f4302_4(int x) { return x * 4; }
+inline int f4302_5(int x) { return x * 5; }
+inline int f4302_6(int x) { return x * 6; }
+inline int f4302_7(int x) { return x * 7; }
+inline int f4302_8(int x) { return x * 8; }
+inline int f4302_9(int x) { return x * 9; }
+inline int f4302_10(int x) { return x * 10; }
+inline int f4302_11(int x) { return x * 11; }
+inline int f4302_12(int x) { return x * 12; }
+inline int f4302_13(int x) { return x * 13; }
+inline int f4302_14(int x) { return x * 14; }
+inline int f4302_15(int x) { return x * 15; }
+inline int f4302_16(int x) { return x * 16; }
+inline int f4302_17(int x) { return x * 17; }
+inline int f4302_18(int x) { return x * 18; }
+inline int f4302_19(int x) { return x * 19; }
+inline int f4302_20(int x) { return x * 20; }
+inline int f4302_21(int x) { return x * 21; }
+inline int f4302_22(int x) { return x * 22; }
+inline int f4302_23(int x) { return x * 23; }
+inline int f4302_24(int x) { return x * 24; }
+inline int f4302_25(int x) { return x * 25; }
+inline int f4302_26(int x) { return x * 26; }
+inline int f4302_27(int x) { return x * 27; }
+inline int f4302_28(int x) { return x * 28; }
+inline int f4302_29(int x) { return x * 29; }
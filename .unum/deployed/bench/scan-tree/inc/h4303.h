@@ -0,0 +1,42 @@
+#pragma once
+/* header 4303 */
+#include <vector>
+#include "h9940.h"
+#include "h833.h"
+#include "h5735.h"
+#include "h6443.h"
+#include "h3777.h"
+#ifdef X
+#include "h5054.h"
+#endif
+struct S4303 { int a; const char *s = "x//y"; };
+inline int f4303_0(int x) { return x * 0; }
+inline int f4303_1(int x) { return x * 1; }
+inline int f4303_2(int x) { return x * 2; }
+inline int f4303_3(int x) { return x * 3; }
+inline int f4303_4(int x) { return x * 4; }
+inline int f4303_5(int x) { return x * 5; }
+inline int f4303_6(int x) { return x * 6; }
+inline int f4303_7(int x) { return x * 7; }
+inline int f4303_8(int x) { return x * 8; }
+inline int f4303_9(int x) { return x * 9; }
+inline int f4303_10(int x) { return x * 10; }
+inline int f4303_11(int x) { return x * 11; }
+inline int f4303_12(int x) { return x * 12; }
+inline int f4303_13(int x) { return x * 13; }
+inline int f4303_14(int x) { return x * 14; }
+inline int f4303_15(int x) { return x * 15; }
+inline int f4303_16(int x) { return x * 16; }
+inline int f4303_17(int x) { return x * 17; }
+inline int f4303_18(int x) { return x * 18; }
+inline int f4303_19(int x) { return x * 19; }
+inline int f4303_20(int x) { return x * 20; }
+inline int f4303_21(int x) { return x * 21; }
+inline int f4303_22(int x) { return x * 22; }
+inline int f4303_23(int x) { return x * 23; }
+inline int f4303_24(int x) { return x * 24; }
+inline int f4303_25(int x) { return x * 25; }
+inline int f4303_26(int x) { return x * 26; }
+inline int f4303_27(int x) { return x * 27; }
+inline int f4303_28(int x) { return x * 28; }
+inline int f4303_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4304 */
+#include <vector>
+#include "h9583.h"
+#include "h1561.h"
+#include "h3286.h"
+#include "h3199.h"
+#include "h7228.h"
+#ifdef X
+#include "h1051.h"
+#endif
+struct S4304 { int a; const char *s = "x//y"; };
+inline int f4304_0(int x) { return x * 0; }
+inline int f4304_1(int x) { return x * 1; }
+inline int f4304_2(int x) { return x * 2; }
+inline int f4304_3(int x) { return x * 3; }
+inline int f4304_4(int x) { return x * 4; }
+inline int f4304_5(int x) { return x * 5; }
+inline int f4304_6(int x) { return x * 6; }
+inline int f4304_7(int x) { return x * 7; }
+inline int f4304_8(int x) { return x * 8; }
+inline int f4304_9(int x) { return x * 9; }
+inline int f4304_10(int x) { return x * 10; }
+inline int f4304_11(int x) { return x * 11; }
+inline int f4304_12(int x) { return x * 12; }
+inline int f4304_13(int x) { return x * 13; }
+inline int f4304_14(int x) { return x * 14; }
+inline int f4304_15(int x) { return x * 15; }
+inline int f4304_16(int x) { return x * 16; }
+inline int f4304_17(int x) { return x * 17; }
+inline int f4304_18(int x) { return x * 18; }
+inline int f4304_19(int x) { return x * 19; }
+inline int f4304_20(int x) { return x * 20; }
+inline int f4304_21(int x) { return x * 21; }
+inline int f4304_22(int x) { return x * 22; }
+inline int f4304_23(int x) { return x * 23; }
+inline int f4304_24(int x) { return x * 24; }
+inline int f4304_25(int x) { return x * 25; }
+inline int f4304_26(int x) { return x * 26; }
+inline int f4304_27(int x) { return x * 27; }
+inline int f4304_28(int x) { return x * 28; }
+inline int f4304_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4305 */
+#include <vector>
+#include "h6673.h"
+#include "h6518.h"
+#include "h3324.h"
+#include "h7082.h"
+#include "h8312.h"
+#ifdef X
+#include "h5561.h"
+#endif
+struct S4305 { int a; const char *s = "x//y"; };
+inline int f4305_0(int x) { return x * 0; }
+inline int f4305_1(int x) { return x * 1; }
+inline int f4305_2(int x) { return x * 2; }
+inline int f4305_3(int x) { return x * 3; }
+inline int f4305_4(int x) { return x * 4; }
+inline int f4305_5(int x) { return x * 5; }
+inline int f4305_6(int x) { return x * 6; }
+inline int f4305_7(int x) { return x * 7; }
+inline int f4305_8(int x) { return x * 8; }
+inline int f4305_9(int x) { return x * 9; }
+inline int f4305_10(int x) { return x * 10; }
+inline int f4305_11(int x) { return x * 11; }
+inline int f4305_12(int x) { return x * 12; }
+inline int f4305_13(int x) { return x * 13; }
+inline int f4305_14(int x) { return x * 14; }
+inline int f4305_15(int x) { return x * 15; }
+inline int f4305_16(int x) { return x * 16; }
+inline int f4305_17(int x) { return x * 17; }
+inline int f4305_18(int x) { return x * 18; }
+inline int f4305_19(int x) { return x * 19; }
+inline int f4305_20(int x) { return x * 20; }
+inline int f4305_21(int x) { return x * 21; }
+inline int f4305_22(int x) { return x * 22; }
+inline int f4305_23(int x) { return x * 23; }
+inline int f4305_24(int x) { return x * 24; }
+inline int f4305_25(int x) { return x * 25; }
+inline int f4305_26(int x) { return x * 26; }
+inline int f4305_27(int x) { return x * 27; }
+inline int f4305_28(int x) { return x * 28; }
+inline int f4305_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4306 */
+#include <vector>
+#include "h3648.h"
+#include "h2701.h"
+#include "h5666.h"
+#include "h2494.h"
+#include "h8071.h"
+#ifdef X
+#include "h8695.h"
+#endif
+struct S4306 { int a; const char *s = "x//y"; };
+inline int f4306_0(int x) { return x * 0; }
+inline int f4306_1(int x) { return x * 1; }
+inline int f4306_2(int x) { return x * 2; }
+inline int f4306_3(int x) { return x * 3; }
+inline int f4306_4(int x) { return x * 4; }
+inline int f4306_5(int x) { return x * 5; }
+inline int f4306_6(int x) { return x * 6; }
+inline int f4306_7(int x) { return x * 7; }
+inline int f4306_8(int x) { return x * 8; }
+inline int f4306_9(int x) { return x * 9; }
+inline int f4306_10(int x) { return x * 10; }
+inline int f4306_11(int x) { return x * 11; }
+inline int f4306_12(int x) { return x * 12; }
+inline int f4306_13(int x) { return x * 13; }
+inline int f4306_14(int x) { return x * 14; }
+inline int f4306_15(int x) { return x * 15; }
+inline int f4306_16(int x) { return x * 16; }
+inline int f4306_17(int x) { return x * 17; }
+inline int f4306_18(int x) { return x * 18; }
+inline int f4306_19(int x) { return x * 19; }
+inline int f4306_20(int x) { return x * 20; }
+inline int f4306_21(int x) { return x * 21; }
+inline int f4306_22(int x) { return x * 22; }
+inline int f4306_23(int x) { return x * 23; }
+inline int f4306_24(int x) { return x * 24; }
+inline int f4306_25(int x) { return x * 25; }
+inline int f4306_26(int x) { return x * 26; }
+inline int f4306_27(int x) { return x * 27; }
+inline int f4306_28(int x) { return x * 28; }
+inline int f4306_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4307 */
+#include <vector>
+#include "h9301.h"
+#include "h160.h"
+#include "h7635.h"
+#include "h3965.h"
+#include "h4048.h"
+#ifdef X
+#include "h8664.h"
+#endif
+struct S4307 { int a; const char *s = "x//y"; };
+inline int f4307_0(int x) { return x * 0; }
+inline int f4307_1(int x) { return x * 1; }
+inline int f4307_2(int x) { return x * 2; }
+inline int f4307_3(int x) { return x * 3; }
+inline int f4307_4(int x) { return x * 4; }
+inline int f4307_5(int x) { return x * 5; }
+inline int f4307_6(int x) { return x * 6; }
+inline int f4307_7(int x) { return x * 7; }
+inline int f4307_8(int x) { return x * 8; }
+inline int f4307_9(int x) { return x * 9; }
+inline int f4307_10(int x) { return x * 10; }
+inline int f4307_11(int x) { return x * 11; }
+inline int f4307_12(int x) { return x * 12; }
+inline int f4307_13(int x) { return x * 13; }
+inline int f4307_14(int x) { return x * 14; }
+inline int f4307_15(int x) { return x * 15; }
+inline int f4307_16(int x) { return x * 16; }
+inline int f4307_17(int x) { return x * 17; }
+inline int f4307_18(int x) { return x * 18; }
+inline int f4307_19(int x) { return x * 19; }
+inline int f4307_20(int x) { return x * 20; }
+inline int f4307_21(int x) { return x * 21; }
+inline int f4307_22(int x) { return x * 22; }
+inline int f4307_23(int x) { return x * 23; }
+inline int f4307_24(int x) { return x * 24; }
+inline int f4307_25(int x) { return x * 25; }
+inline int f4307_26(int x) { return x * 26; }
+inline int f4307_27(int x) { return x * 27; }
+inline int f4307_28(int x) { return x * 28; }
+inline int f4307_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4311 */
+#include <vector>
+#include "h9828.h"
+#include "h6958.h"
+#include "h9002.h"
+#include "h6381.h"
+#include "h844.h"
+#ifdef X
+#include "h8775.h"
+#endif
+struct S4311 { int a; const char *s = "x//y"; };
+inline int f4311_0(int x) { return x * 0; }
+inline int f4311_1(int x) { return x * 1; }
+inline int f4311_2(int x) { return x * 2; }
+inline int f4311_3(int x) { return x * 3; }
+inline int f4311_4(int x) { return x * 4; }
+inline int f4311_5(int x) { return x * 5; }
+inline int f4311_6(int x) { return x * 6; }
+inline int f4311_7(int x) { return x * 7; }
+inline int f4311_8(int x) { return x * 8; }
+inline int f4311_9(int x) { return x * 9; }
+inline int f4311_10(int x) { return x * 10; }
+inline int f4311_11(int x) { return x * 11; }
+inline int f4311_12(int x) { return x * 12; }
+inline int f4311_13(int x) { return x * 13; }
+inline int f4311_14(int x) { return x * 14; }
+inline int f4311_15(int x) { return x * 15; }
+inline int f4311_16(int x) { return x * 16; }
+inline int f4311_17(int x) { return x * 17; }
+inline int f4311_18(int x) { return x * 18; }
+inline int f4311_19(int x) { return x * 19; }
+inline int f4311_20(int x) { return x * 20; }
+inline int f4311_21(int x) { return x * 21; }
+inline int f4311_22(int x) { return x * 22; }
+inline int f4311_23(int x) { return x * 23; }
+inline int f4311_24(int x) { return x * 24; }
+inline int f4311_25(int x) { return x * 25; }
+inline int f4311_26(int x) { return x * 26; }
+inline int f4311_27(int x) { return x * 27; }
+inline int f4311_28(int x) { return x * 28; }
+inline int f4311_29(int x) { return x * 29; }
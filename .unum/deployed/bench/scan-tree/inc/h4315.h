@@ -0,0 +1,42 @@
+#pragma once
+/* header 4315 */
+#include <vector>
+#include "h5518.h"
+#include "h5327.h"
+#include "h4175.h"
+#include "h277.h"
+#include "h9255.h"
+#ifdef X
+#include "h608.h"
+#endif
+struct S4315 { int a; const char *s = "x//y"; };
+inline int f4315_0(int x) { return x * 0; }
+inline int f4315_1(int x) { return x * 1; }
+inline int f4315_2(int x) { return x * 2; }
+inline int f4315_3(int x) { return x * 3; }
+inline int f4315_4(int x) { return x * 4; }
+inline int f4315_5(int x) { return x * 5; }
+inline int f4315_6(int x) { return x * 6; }
+inline int f4315_7(int x) { return x * 7; }
+inline int f4315_8(int x) { return x * 8; }
+inline int f4315_9(int x) { return x * 9; }
+inline int f4315_10(int x) { return x * 10; }
+inline int f4315_11(int x) { return x * 11; }
+inline int f4315_12(int x) { return x * 12; }
+inline int f4315_13(int x) { return x * 13; }
+inline int f4315_14(int x) { return x * 14; }
+inline int f4315_15(int x) { return x * 15; }
+inline int f4315_16(int x) { return x * 16; }
+inline int f4315_17(int x) { return x * 17; }
+inline int f4315_18(int x) { return x * 18; }
+inline int f4315_19(int x) { return x * 19; }
+inline int f4315_20(int x) { return x * 20; }
+inline int f4315_21(int x) { return x * 21; }
+inline int f4315_22(int x) { return x * 22; }
+inline int f4315_23(int x) { return x * 23; }
+inline int f4315_24(int x) { return x * 24; }
+inline int f4315_25(int x) { return x * 25; }
+inline int f4315_26(int x) { return x * 26; }
+inline int f4315_27(int x) { return x * 27; }
+inline int f4315_28(int x) { return x * 28; }
+inline int f4315_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4318 */
+#include <vector>
+#include "h619.h"
+#include "h6025.h"
+#include "h2276.h"
+#include "h2717.h"
+#include "h866.h"
+#ifdef X
+#include "h4649.h"
+#endif
+struct S4318 { int a; const char *s = "x//y"; };
+inline int f4318_0(int x) { return x * 0; }
+inline int f4318_1(int x) { return x * 1; }
+inline int f4318_2(int x) { return x * 2; }
+inline int f4318_3(int x) { return x * 3; }
+inline int f4318_4(int x) { return x * 4; }
+inline int f4318_5(int x) { return x * 5; }
+inline int f4318_6(int x) { return x * 6; }
+inline int f4318_7(int x) { return x * 7; }
+inline int f4318_8(int x) { return x * 8; }
+inline int f4318_9(int x) { return x * 9; }
+inline int f4318_10(int x) { return x * 10; }
+inline int f4318_11(int x) { return x * 11; }
+inline int f4318_12(int x) { return x * 12; }
+inline int f4318_13(int x) { return x * 13; }
+inline int f4318_14(int x) { return x * 14; }
+inline int f4318_15(int x) { return x * 15; }
+inline int f4318_16(int x) { return x * 16; }
+inline int f4318_17(int x) { return x * 17; }
+inline int f4318_18(int x) { return x * 18; }
+inline int f4318_19(int x) { return x * 19; }
+inline int f4318_20(int x) { return x * 20; }
+inline int f4318_21(int x) { return x * 21; }
+inline int f4318_22(int x) { return x * 22; }
+inline int f4318_23(int x) { return x * 23; }
+inline int f4318_24(int x) { return x * 24; }
+inline int f4318_25(int x) { return x * 25; }
+inline int f4318_26(int x) { return x * 26; }
+inline int f4318_27(int x) { return x * 27; }
+inline int f4318_28(int x) { return x * 28; }
+inline int f4318_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 432 */
+#include <vector>
+#include "h8899.h"
+#include "h6595.h"
+#include "h5657.h"
+#include "h2797.h"
+#include "h1094.h"
+#ifdef X
+#include "h6125.h"
+#endif
+struct S432 { int a; const char *s = "x//y"; };
+inline int f432_0(int x) { return x * 0; }
+inline int f432_1(int x) { return x * 1; }
+inline int f432_2(int x) { return x * 2; }
+inline int f432_3(int x) { return x * 3; }
+inline int f432_4(int x) { return x * 4; }
+inline int f432_5(int x) { return x * 5; }
+inline int f432_6(int x) { return x * 6; }
+inline int f432_7(int x) { return x * 7; }
+inline int f432_8(int x) { return x * 8; }
+inline int f432_9(int x) { return x * 9; }
+inline int f432_10(int x) { return x * 10; }
+inline int f432_11(int x) { return x * 11; }
+inline int f432_12(int x) { return x * 12; }
+inline int f432_13(int x) { return x * 13; }
+inline int f432_14(int x) { return x * 14; }
+inline int f432_15(int x) { return x * 15; }
+inline int f432_16(int x) { return x * 16; }
+inline int f432_17(int x) { return x * 17; }
+inline int f432_18(int x) { return x * 18; }
+inline int f432_19(int x) { return x * 19; }
+inline int f432_20(int x) { return x * 20; }
+inline int f432_21(int x) { return x * 21; }
+inline int f432_22(int x) { return x * 22; }
+inline int f432_23(int x) { return x * 23; }
+inline int f432_24(int x) { return x * 24; }
+inline int f432_25(int x) { return x * 25; }
+inline int f432_26(int x) { return x * 26; }
+inline int f432_27(int x) { return x * 27; }
+inline int f432_28(int x) { return x * 28; }
+inline int f432_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4320 */
+#include <vector>
+#include "h3540.h"
+#include "h7.h"
+#include "h4288.h"
+#include "h6511.h"
+#include "h8766.h"
+#ifdef X
+#include "h3197.h"
+#endif
+struct S4320 { int a; const char *s = "x//y"; };
+inline int f4320_0(int x) { return x * 0; }
+inline int f4320_1(int x) { return x * 1; }
+inline int f4320_2(int x) { return x * 2; }
+inline int f4320_3(int x) { return x * 3; }
+inline int f4320_4(int x) { return x * 4; }
+inline int f4320_5(int x) { return x * 5; }
+inline int f4320_6(int x) { return x * 6; }
+inline int f4320_7(int x) { return x * 7; }
+inline int f4320_8(int x) { return x * 8; }
+inline int f4320_9(int x) { return x * 9; }
+inline int f4320_10(int x) { return x * 10; }
+inline int f4320_11(int x) { return x * 11; }
+inline int f4320_12(int x) { return x * 12; }
+inline int f4320_13(int x) { return x * 13; }
+inline int f4320_14(int x) { return x * 14; }
+inline int f4320_15(int x) { return x * 15; }
+inline int f4320_16(int x) { return x * 16; }
+inline int f4320_17(int x) { return x * 17; }
+inline int f4320_18(int x) { return x * 18; }
+inline int f4320_19(int x) { return x * 19; }
+inline int f4320_20(int x) { return x * 20; }
+inline int f4320_21(int x) { return x * 21; }
+inline int f4320_22(int x) { return x * 22; }
+inline int f4320_23(int x) { return x * 23; }
+inline int f4320_24(int x) { return x * 24; }
+inline int f4320_25(int x) { return x * 25; }
+inline int f4320_26(int x) { return x * 26; }
+inline int f4320_27(int x) { return x * 27; }
+inline int f4320_28(int x) { return x * 28; }
+inline int f4320_29(int x) { return x * 29; }
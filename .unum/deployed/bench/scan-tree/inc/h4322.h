@@ -0,0 +1,42 @@
+#pragma once
+/* header 4322 */
+#include <vector>
+#include "h6870.h"
+#include "h5022.h"
+#include "h461.h"
+#include "h2618.h"
+#include "h8764.h"
+#ifdef X
+#include "h3752.h"
+#endif
+struct S4322 { int a; const char *s = "x//y"; };
+inline int f4322_0(int x) { return x * 0; }
+inline int f4322_1(int x) { return x * 1; }
+inline int f4322_2(int x) { return x * 2; }
+inline int f4322_3(int x) { return x * 3; }
+inline int f4322_4(int x) { return x * 4; }
+inline int f4322_5(int x) { return x * 5; }
+inline int f4322_6(int x) { return x * 6; }
+inline int f4322_7(int x) { return x * 7; }
+inline int f4322_8(int x) { return x * 8; }
+inline int f4322_9(int x) { return x * 9; }
+inline int f4322_10(int x) { return x * 10; }
+inline int f4322_11(int x) { return x * 11; }
+inline int f4322_12(int x) { return x * 12; }
+inline int f4322_13(int x) { return x * 13; }
+inline int f4322_14(int x) { return x * 14; }
+inline int f4322_15(int x) { return x * 15; }
+inline int f4322_16(int x) { return x * 16; }
+inline int f4322_17(int x) { return x * 17; }
+inline int f4322_18(int x) { return x * 18; }
+inline int f4322_19(int x) { return x * 19; }
+inline int f4322_20(int x) { return x * 20; }
+inline int f4322_21(int x) { return x * 21; }
+inline int f4322_22(int x) { return x * 22; }
+inline int f4322_23(int x) { return x * 23; }
+inline int f4322_24(int x) { return x * 24; }
+inline int f4322_25(int x) { return x * 25; }
+inline int f4322_26(int x) { return x * 26; }
+inline int f4322_27(int x) { return x * 27; }
+inline int f4322_28(int x) { return x * 28; }
+inline int f4322_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4323 */
+#include <vector>
+#include "h4033.h"
+#include "h4445.h"
+#include "h2335.h"
+#include "h6021.h"
+#include "h6970.h"
+#ifdef X
+#include "h4617.h"
+#endif
+struct S4323 { int a; const char *s = "x//y"; };
+inline int f4323_0(int x) { return x * 0; }
+inline int f4323_1(int x) { return x * 1; }
+inline int f4323_2(int x) { return x * 2; }
+inline int f4323_3(int x) { return x * 3; }
+inline int f4323_4(int x) { return x * 4; }
+inline int f4323_5(int x) { return x * 5; }
+inline int f4323_6(int x) { return x * 6; }
+inline int f4323_7(int x) { return x * 7; }
+inline int f4323_8(int x) { return x * 8; }
+inline int f4323_9(int x) { return x * 9; }
+inline int f4323_10(int x) { return x * 10; }
+inline int f4323_11(int x) { return x * 11; }
+inline int f4323_12(int x) { return x * 12; }
+inline int f4323_13(int x) { return x * 13; }
+inline int f4323_14(int x) { return x * 14; }
+inline int f4323_15(int x) { return x * 15; }
+inline int f4323_16(int x) { return x * 16; }
+inline int f4323_17(int x) { return x * 17; }
+inline int f4323_18(int x) { return x * 18; }
+inline int f4323_19(int x) { return x * 19; }
+inline int f4323_20(int x) { return x * 20; }
+inline int f4323_21(int x) { return x * 21; }
+inline int f4323_22(int x) { return x * 22; }
+inline int f4323_23(int x) { return x * 23; }
+inline int f4323_24(int x) { return x * 24; }
+inline int f4323_25(int x) { return x * 25; }
+inline int f4323_26(int x) { return x * 26; }
+inline int f4323_27(int x) { return x * 27; }
+inline int f4323_28(int x) { return x * 28; }
+inline int f4323_29(int x) { return x * 29; }
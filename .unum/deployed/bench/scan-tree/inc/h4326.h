@@ -0,0 +1,42 @@
+#pragma once
+/* header 4326 */
+#include <vector>
+#include "h7543.h"
+#include "h2586.h"
+#include "h6807.h"
+#include "h817.h"
+#include "h4475.h"
+#ifdef X
+#include "h5235.h"
+#endif
+struct S4326 { int a; const char *s = "x//y"; };
+inline int f4326_0(int x) { return x * 0; }
+inline int f4326_1(int x) { return x * 1; }
+inline int f4326_2(int x) { return x * 2; }
+inline int f4326_3(int x) { return x * 3; }
+inline int f4326_4(int x) { return x * 4; }
+inline int f4326_5(int x) { return x * 5; }
+inline int f4326_6(int x) { return x * 6; }
+inline int f4326_7(int x) { return x * 7; }
+inline int f4326_8(int x) { return x * 8; }
+inline int f4326_9(int x) { return x * 9; }
+inline int f4326_10(int x) { return x * 10; }
+inline int f4326_11(int x) { return x * 11; }
+inline int f4326_12(int x) { return x * 12; }
+inline int f4326_13(int x) { return x * 13; }
+inline int f4326_14(int x) { return x * 14; }
+inline int f4326_15(int x) { return x * 15; }
+inline int f4326_16(int x) { return x * 16; }
+inline int f4326_17(int x) { return x * 17; }
+inline int f4326_18(int x) { return x * 18; }
+inline int f4326_19(int x) { return x * 19; }
+inline int f4326_20(int x) { return x * 20; }
+inline int f4326_21(int x) { return x * 21; }
+inline int f4326_22(int x) { return x * 22; }
+inline int f4326_23(int x) { return x * 23; }
+inline int f4326_24(int x) { return x * 24; }
+inline int f4326_25(int x) { return x * 25; }
+inline int f4326_26(int x) { return x * 26; }
+inline int f4326_27(int x) { return x * 27; }
+inline int f4326_28(int x) { return x * 28; }
+inline int f4326_29(int x) { return x * 29; }
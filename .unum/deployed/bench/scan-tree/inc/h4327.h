@@ -0,0 +1,42 @@
+#pragma once
+/* header 4327 */
+#include <vector>
+#include "h6274.h"
+#include "h3804.h"
+#include "h5252.h"
+#include "h6216.h"
+#include "h8612.h"
+#ifdef X
+#include "h7067.h"
+#endif
+struct S4327 { int a; const char *s = "x//y"; };
+inline int f4327_0(int x) { return x * 0; }
+inline int f4327_1(int x) { return x * 1; }
+inline int f4327_2(int x) { return x * 2; }
+inline int f4327_3(int x) { return x * 3; }
+inline int f4327_4(int x) { return x * 4; }
+inline int f4327_5(int x) { return x * 5; }
+inline int f4327_6(int x) { return x * 6; }
+inline int f4327_7(int x) { return x * 7; }
+inline int f4327_8(int x) { return x * 8; }
+inline int f4327_9(int x) { return x * 9; }
+inline int f4327_10(int x) { return x * 10; }
+inline int f4327_11(int x) { return x * 11; }
+inline int f4327_12(int x) { return x * 12; }
+inline int f4327_13(int x) { return x * 13; }
+inline int f4327_14(int x) { return x * 14; }
+inline int f4327_15(int x) { return x * 15; }
+inline int f4327_16(int x) { return x * 16; }
+inline int f4327_17(int x) { return x * 17; }
+inline int f4327_18(int x) { return x * 18; }
+inline int f4327_19(int x) { return x * 19; }
+inline int f4327_20(int x) { return x * 20; }
+inline int f4327_21(int x) { return x * 21; }
+inline int f4327_22(int x) { return x * 22; }
+inline int f4327_23(int x) { return x * 23; }
+inline int f4327_24(int x) { return x * 24; }
+inline int f4327_25(int x) { return x * 25; }
+inline int f4327_26(int x) { return x * 26; }
+inline int f4327_27(int x) { return x * 27; }
+inline int f4327_28(int x) { return x * 28; }
+inline int f4327_29(int x) { return x * 29; }
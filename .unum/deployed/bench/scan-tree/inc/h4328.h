@@ -0,0 +1,42 @@
+#pragma once
+/* header 4328 */
+#include <vector>
+#include "h7208.h"
+#include "h2676.h"
+#include "h2629.h"
+#include "h4008.h"
+#include "h617.h"
+#ifdef X
+#include "h4114.h"
+#endif
+struct S4328 { int a; const char *s = "x//y"; };
+inline int f4328_0(int x) { return x * 0; }
+inline int f4328_1(int x) { return x * 1; }
+inline int f4328_2(int x) { return x * 2; }
+inline int f4328_3(int x) { return x * 3; }
+inline int f4328_4(int x) { return x * 4; }
+inline int f4328_5(int x) { return x * 5; }
+inline int f4328_6(int x) { return x * 6; }
+inline int f4328_7(int x) { return x * 7; }
+inline int f4328_8(int x) { return x * 8; }
+inline int f4328_9(int x) { return x * 9; }
+inline int f4328_10(int x) { return x * 10; }
+inline int f4328_11(int x) { return x * 11; }
+inline int f4328_12(int x) { return x * 12; }
+inline int f4328_13(int x) { return x * 13; }
+inline int f4328_14(int x) { return x * 14; }
+inline int f4328_15(int x) { return x * 15; }
+inline int f4328_16(int x) { return x * 16; }
+inline int f4328_17(int x) { return x * 17; }
+inline int f4328_18(int x) { return x * 18; }
+inline int f4328_19(int x) { return x * 19; }
+inline int f4328_20(int x) { return x * 20; }
+inline int f4328_21(int x) { return x * 21; }
+inline int f4328_22(int x) { return x * 22; }
+inline int f4328_23(int x) { return x * 23; }
+inline int f4328_24(int x) { return x * 24; }
+inline int f4328_25(int x) { return x * 25; }
+inline int f4328_26(int x) { return x * 26; }
+inline int f4328_27(int x) { return x * 27; }
+inline int f4328_28(int x) { return x * 28; }
+inline int f4328_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4329 */
+#include <vector>
+#include "h8009.h"
+#include "h8911.h"
+#include "h123.h"
+#include "h166.h"
+#include "h6021.h"
+#ifdef X
+#include "h734.h"
+#endif
+struct S4329 { int a; const char *s = "x//y"; };
+inline int f4329_0(int x) { return x * 0; }
+inline int f4329_1(int x) { return x * 1; }
+inline int f4329_2(int x) { return x * 2; }
+inline int f4329_3(int x) { return x * 3; }
+inline int f4329_4(int x) { return x * 4; }
+inline int f4329_5(int x) { return x * 5; }
+inline int f4329_6(int x) { return x * 6; }
+inline int f4329_7(int x) { return x * 7; }
+inline int f4329_8(int x) { return x * 8; }
+inline int f4329_9(int x) { return x * 9; }
+inline int f4329_10(int x) { return x * 10; }
+inline int f4329_11(int x) { return x * 11; }
+inline int f4329_12(int x) { return x * 12; }
+inline int f4329_13(int x) { return x * 13; }
+inline int f4329_14(int x) { return x * 14; }
+inline int f4329_15(int x) { return x * 15; }
+inline int f4329_16(int x) { return x * 16; }
+inline int f4329_17(int x) { return x * 17; }
+inline int f4329_18(int x) { return x * 18; }
+inline int f4329_19(int x) { return x * 19; }
+inline int f4329_20(int x) { return x * 20; }
+inline int f4329_21(int x) { return x * 21; }
+inline int f4329_22(int x) { return x * 22; }
+inline int f4329_23(int x) { return x * 23; }
+inline int f4329_24(int x) { return x * 24; }
+inline int f4329_25(int x) { return x * 25; }
+inline int f4329_26(int x) { return x * 26; }
+inline int f4329_27(int x) { return x * 27; }
+inline int f4329_28(int x) { return x * 28; }
+inline int f4329_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 433 */
+#include <vector>
+#include "h5293.h"
+#include "h7315.h"
+#include "h7121.h"
+#include "h8668.h"
+#include "h4903.h"
+#ifdef X
+#include "h8329.h"
+#endif
+struct S433 { int a; const char *s = "x//y"; };
+inline int f433_0(int x) { return x * 0; }
+inline int f433_1(int x) { return x * 1; }
+inline int f433_2(int x) { return x * 2; }
+inline int f433_3(int x) { return x * 3; }
+inline int f433_4(int x) { return x * 4; }
+inline int f433_5(int x) { return x * 5; }
+inline int f433_6(int x) { return x * 6; }
+inline int f433_7(int x) { return x * 7; }
+inline int f433_8(int x) { return x * 8; }
+inline int f433_9(int x) { return x * 9; }
+inline int f433_10(int x) { return x * 10; }
+inline int f433_11(int x) { return x * 11; }
+inline int f433_12(int x) { return x * 12; }
+inline int f433_13(int x) { return x * 13; }
+inline int f433_14(int x) { return x * 14; }
+inline int f433_15(int x) { return x * 15; }
+inline int f433_16(int x) { return x * 16; }
+inline int f433_17(int x) { return x * 17; }
+inline int f433_18(int x) { return x * 18; }
+inline int f433_19(int x) { return x * 19; }
+inline int f433_20(int x) { return x * 20; }
+inline int f433_21(int x) { return x * 21; }
+inline int f433_22(int x) { return x * 22; }
+inline int f433_23(int x) { return x * 23; }
+inline int f433_24(int x) { return x * 24; }
+inline int f433_25(int x) { return x * 25; }
+inline int f433_26(int x) { return x * 26; }
+inline int f433_27(int x) { return x * 27; }
+inline int f433_28(int x) { return x * 28; }
+inline int f433_29(int x) { return x * 29; }
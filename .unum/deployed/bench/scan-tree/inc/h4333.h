@@ -0,0 +1,42 @@
+#pragma once
+/* header 4333 */
+#include <vector>
+#include "h2592.h"
+#include "h5914.h"
+#include "h3107.h"
+#include "h301.h"
+#include "h2832.h"
+#ifdef X
+#include "h5157.h"
+#endif
+struct S4333 { int a; const char *s = "x//y"; };
+inline int f4333_0(int x) { return x * 0; }
+inline int f4333_1(int x) { return x * 1; }
+inline int f4333_2(int x) { return x * 2; }
+inline int f4333_3(int x) { return x * 3; }
+inline int f4333_4(int x) { return x * 4; }
+inline int f4333_5(int x) { return x * 5; }
+inline int f4333_6(int x) { return x * 6; }
+inline int f4333_7(int x) { return x * 7; }
+inline int f4333_8(int x) { return x * 8; }
+inline int f4333_9(int x) { return x * 9; }
+inline int f4333_10(int x) { return x * 10; }
+inline int f4333_11(int x) { return x * 11; }
+inline int f4333_12(int x) { return x * 12; }
+inline int f4333_13(int x) { return x * 13; }
+inline int f4333_14(int x) { return x * 14; }
+inline int f4333_15(int x) { return x * 15; }
+inline int f4333_16(int x) { return x * 16; }
+inline int f4333_17(int x) { return x * 17; }
+inline int f4333_18(int x) { return x * 18; }
+inline int f4333_19(int x) { return x * 19; }
+inline int f4333_20(int x) { return x * 20; }
+inline int f4333_21(int x) { return x * 21; }
+inline int f4333_22(int x) { return x * 22; }
+inline int f4333_23(int x) { return x * 23; }
+inline int f4333_24(int x) { return x * 24; }
+inline int f4333_25(int x) { return x * 25; }
+inline int f4333_26(int x) { return x * 26; }
+inline int f4333_27(int x) { return x * 27; }
+inline int f4333_28(int x) { return x * 28; }
+inline int f4333_29(int x) { return x * 29; }
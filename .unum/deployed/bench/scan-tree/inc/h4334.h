@@ -0,0 +1,42 @@
+#pragma once
+/* header 4334 */
+#include <vector>
+#include "h5631.h"
+#include "h5529.h"
+#include "h1330.h"
+#include "h3239.h"
+#include "h9601.h"
+#ifdef X
+#include "h1355.h"
+#endif
+struct S4334 { int a; const char *s = "x//y"; };
+inline int f4334_0(int x) { return x * 0; }
+inline int f4334_1(int x) { return x * 1; }
+inline int f4334_2(int x) { return x * 2; }
+inline int f4334_3(int x) { return x * 3; }
+inline int f4334_4(int x) { return x * 4; }
+inline int f4334_5(int x) { return x * 5; }
+inline int f4334_6(int x) { return x * 6; }
+inline int f4334_7(int x) { return x * 7; }
+inline int f4334_8(int x) { return x * 8; }
+inline int f4334_9(int x) { return x * 9; }
+inline int f4334_10(int x) { return x * 10; }
+inline int f4334_11(int x) { return x * 11; }
+inline int f4334_12(int x) { return x * 12; }
+inline int f4334_13(int x) { return x * 13; }
+inline int f4334_14(int x) { return x * 14; }
+inline int f4334_15(int x) { return x * 15; }
+inline int f4334_16(int x) { return x * 16; }
+inline int f4334_17(int x) { return x * 17; }
+inline int f4334_18(int x) { return x * 18; }
+inline int f4334_19(int x) { return x * 19; }
+inline int f4334_20(int x) { return x * 20; }
+inline int f4334_21(int x) { return x * 21; }
+inline int f4334_22(int x) { return x * 22; }
+inline int f4334_23(int x) { return x * 23; }
+inline int f4334_24(int x) { return x * 24; }
+inline int f4334_25(int x) { return x * 25; }
+inline int f4334_26(int x) { return x * 26; }
+inline int f4334_27(int x) { return x * 27; }
+inline int f4334_28(int x) { return x * 28; }
+inline int f4334_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4336 */
+#include <vector>
+#include "h2758.h"
+#include "h8298.h"
+#include "h2623.h"
+#include "h6775.h"
+#include "h1455.h"
+#ifdef X
+#include "h9303.h"
+#endif
+struct S4336 { int a; const char *s = "x//y"; };
+inline int f4336_0(int x) { return x * 0; }
+inline int f4336_1(int x) { return x * 1; }
+inline int f4336_2(int x) { return x * 2; }
+inline int f4336_3(int x) { return x * 3; }
+inline int f4336_4(int x) { return x * 4; }
+inline int f4336_5(int x) { return x * 5; }
+inline int f4336_6(int x) { return x * 6; }
+inline int f4336_7(int x) { return x * 7; }
+inline int f4336_8(int x) { return x * 8; }
+inline int f4336_9(int x) { return x * 9; }
+inline int f4336_10(int x) { return x * 10; }
+inline int f4336_11(int x) { return x * 11; }
+inline int f4336_12(int x) { return x * 12; }
+inline int f4336_13(int x) { return x * 13; }
+inline int f4336_14(int x) { return x * 14; }
+inline int f4336_15(int x) { return x * 15; }
+inline int f4336_16(int x) { return x * 16; }
+inline int f4336_17(int x) { return x * 17; }
+inline int f4336_18(int x) { return x * 18; }
+inline int f4336_19(int x) { return x * 19; }
+inline int f4336_20(int x) { return x * 20; }
+inline int f4336_21(int x) { return x * 21; }
+inline int f4336_22(int x) { return x * 22; }
+inline int f4336_23(int x) { return x * 23; }
+inline int f4336_24(int x) { return x * 24; }
+inline int f4336_25(int x) { return x * 25; }
+inline int f4336_26(int x) { return x * 26; }
+inline int f4336_27(int x) { return x * 27; }
+inline int f4336_28(int x) { return x * 28; }
+inline int f4336_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4337 */
+#include <vector>
+#include "h813.h"
+#include "h4081.h"
+#include "h5033.h"
+#include "h1226.h"
+#include "h6854.h"
+#ifdef X
+#include "h2413.h"
+#endif
+struct S4337 { int a; const char *s = "x//y"; };
+inline int f4337_0(int x) { return x * 0; }
+inline int f4337_1(int x) { return x * 1; }
+inline int f4337_2(int x) { return x * 2; }
+inline int f4337_3(int x) { return x * 3; }
+inline int f4337_4(int x) { return x * 4; }
+inline int f4337_5(int x) { return x * 5; }
+inline int f4337_6(int x) { return x * 6; }
+inline int f4337_7(int x) { return x * 7; }
+inline int f4337_8(int x) { return x * 8; }
+inline int f4337_9(int x) { return x * 9; }
+inline int f4337_10(int x) { return x * 10; }
+inline int f4337_11(int x) { return x * 11; }
+inline int f4337_12(int x) { return x * 12; }
+inline int f4337_13(int x) { return x * 13; }
+inline int f4337_14(int x) { return x * 14; }
+inline int f4337_15(int x) { return x * 15; }
+inline int f4337_16(int x) { return x * 16; }
+inline int f4337_17(int x) { return x * 17; }
+inline int f4337_18(int x) { return x * 18; }
+inline int f4337_19(int x) { return x * 19; }
+inline int f4337_20(int x) { return x * 20; }
+inline int f4337_21(int x) { return x * 21; }
+inline int f4337_22(int x) { return x * 22; }
+inline int f4337_23(int x) { return x * 23; }
+inline int f4337_24(int x) { return x * 24; }
+inline int f4337_25(int x) { return x * 25; }
+inline int f4337_26(int x) { return x * 26; }
+inline int f4337_27(int x) { return x * 27; }
+inline int f4337_28(int x) { return x * 28; }
+inline int f4337_29(int x) { return x * 29; }
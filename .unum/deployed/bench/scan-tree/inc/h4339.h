@@ -0,0 +1,42 @@
+#pragma once
+/* header 4339 */
+#include <vector>
+#include "h8340.h"
+#include "h3609.h"
+#include "h403.h"
+#include "h9062.h"
+#include "h2973.h"
+#ifdef X
+#include "h4907.h"
+#endif
+struct S4339 { int a; const char *s = "x//y"; };
+inline int f4339_0(int x) { return x * 0; }
+inline int f4339_1(int x) { return x * 1; }
+inline int f4339_2(int x) { return x * 2; }
+inline int f4339_3(int x) { return x * 3; }
+inline int f4339_4(int x) { return x * 4; }
+inline int f4339_5(int x) { return x * 5; }
+inline int f4339_6(int x) { return x * 6; }
+inline int f4339_7(int x) { return x * 7; }
+inline int f4339_8(int x) { return x * 8; }
+inline int f4339_9(int x) { return x * 9; }
+inline int f4339_10(int x) { return x * 10; }
+inline int f4339_11(int x) { return x * 11; }
+inline int f4339_12(int x) { return x * 12; }
+inline int f4339_13(int x) { return x * 13; }
+inline int f4339_14(int x) { return x * 14; }
+inline int f4339_15(int x) { return x * 15; }
+inline int f4339_16(int x) { return x * 16; }
+inline int f4339_17(int x) { return x * 17; }
+inline int f4339_18(int x) { return x * 18; }
+inline int f4339_19(int x) { return x * 19; }
+inline int f4339_20(int x) { return x * 20; }
+inline int f4339_21(int x) { return x * 21; }
+inline int f4339_22(int x) { return x * 22; }
+inline int f4339_23(int x) { return x * 23; }
+inline int f4339_24(int x) { return x * 24; }
+inline int f4339_25(int x) { return x * 25; }
+inline int f4339_26(int x) { return x * 26; }
+inline int f4339_27(int x) { return x * 27; }
+inline int f4339_28(int x) { return x * 28; }
+inline int f4339_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 434 */
+#include <vector>
+#include "h4433.h"
+#include "h5738.h"
+#include "h7040.h"
+#include "h3749.h"
+#include "h1013.h"
+#ifdef X
+#include "h8113.h"
+#endif
+struct S434 { int a; const char *s = "x//y"; };
+inline int f434_0(int x) { return x * 0; }
+inline int f434_1(int x) { return x * 1; }
+inline int f434_2(int x) { return x * 2; }
+inline int f434_3(int x) { return x * 3; }
+inline int f434_4(int x) { return x * 4; }
+inline int f434_5(int x) { return x * 5; }
+inline int f434_6(int x) { return x * 6; }
+inline int f434_7(int x) { return x * 7; }
+inline int f434_8(int x) { return x * 8; }
+inline int f434_9(int x) { return x * 9; }
+inline int f434_10(int x) { return x * 10; }
+inline int f434_11(int x) { return x * 11; }
+inline int f434_12(int x) { return x * 12; }
+inline int f434_13(int x) { return x * 13; }
+inline int f434_14(int x) { return x * 14; }
+inline int f434_15(int x) { return x * 15; }
+inline int f434_16(int x) { return x * 16; }
+inline int f434_17(int x) { return x * 17; }
+inline int f434_18(int x) { return x * 18; }
+inline int f434_19(int x) { return x * 19; }
+inline int f434_20(int x) { return x * 20; }
+inline int f434_21(int x) { return x * 21; }
+inline int f434_22(int x) { return x * 22; }
+inline int f434_23(int x) { return x * 23; }
+inline int f434_24(int x) { return x * 24; }
+inline int f434_25(int x) { return x * 25; }
+inline int f434_26(int x) { return x * 26; }
+inline int f434_27(int x) { return x * 27; }
+inline int f434_28(int x) { return x * 28; }
+inline int f434_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4340 */
+#include <vector>
+#include "h2023.h"
+#include "h1531.h"
+#include "h9607.h"
+#include "h7908.h"
+#include "h6079.h"
+#ifdef X
+#include "h6886.h"
+#endif
+struct S4340 { int a; const char *s = "x//y"; };
+inline int f4340_0(int x) { return x * 0; }
+inline int f4340_1(int x) { return x * 1; }
+inline int f4340_2(int x) { return x * 2; }
+inline int f4340_3(int x) { return x * 3; }
+inline int f4340_4(int x) { return x * 4; }
+inline int f4340_5(int x) { return x * 5; }
+inline int f4340_6(int x) { return x * 6; }
+inline int f4340_7(int x) { return x * 7; }
+inline int f4340_8(int x) { return x * 8; }
+inline int f4340_9(int x) { return x * 9; }
+inline int f4340_10(int x) { return x * 10; }
+inline int f4340_11(int x) { return x * 11; }
+inline int f4340_12(int x) { return x * 12; }
+inline int f4340_13(int x) { return x * 13; }
+inline int f4340_14(int x) { return x * 14; }
+inline int f4340_15(int x) { return x * 15; }
+inline int f4340_16(int x) { return x * 16; }
+inline int f4340_17(int x) { return x * 17; }
+inline int f4340_18(int x) { return x * 18; }
+inline int f4340_19(int x) { return x * 19; }
+inline int f4340_20(int x) { return x * 20; }
+inline int f4340_21(int x) { return x * 21; }
+inline int f4340_22(int x) { return x * 22; }
+inline int f4340_23(int x) { return x * 23; }
+inline int f4340_24(int x) { return x * 24; }
+inline int f4340_25(int x) { return x * 25; }
+inline int f4340_26(int x) { return x * 26; }
+inline int f4340_27(int x) { return x * 27; }
+inline int f4340_28(int x) { return x * 28; }
+inline int f4340_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4341 */
+#include <vector>
+#include "h4324.h"
+#include "h1226.h"
+#include "h5376.h"
+#include "h5868.h"
+#include "h1383.h"
+#ifdef X
+#include "h9005.h"
+#endif
+struct S4341 { int a; const char *s = "x//y"; };
+inline int f4341_0(int x) { return x * 0; }
+inline int f4341_1(int x) { return x * 1; }
+inline int f4341_2(int x) { return x * 2; }
+inline int f4341_3(int x) { return x * 3; }
+inline int f4341_4(int x) { return x * 4; }
+inline int f4341_5(int x) { return x * 5; }
+inline int f4341_6(int x) { return x * 6; }
+inline int f4341_7(int x) { return x * 7; }
+inline int f4341_8(int x) { return x * 8; }
+inline int f4341_9(int x) { return x * 9; }
+inline int f4341_10(int x) { return x * 10; }
+inline int f4341_11(int x) { return x * 11; }
+inline int f4341_12(int x) { return x * 12; }
+inline int f4341_13(int x) { return x * 13; }
+inline int f4341_14(int x) { return x * 14; }
+inline int f4341_15(int x) { return x * 15; }
+inline int f4341_16(int x) { return x * 16; }
+inline int f4341_17(int x) { return x * 17; }
+inline int f4341_18(int x) { return x * 18; }
+inline int f4341_19(int x) { return x * 19; }
+inline int f4341_20(int x) { return x * 20; }
+inline int f4341_21(int x) { return x * 21; }
+inline int f4341_22(int x) { return x * 22; }
+inline int f4341_23(int x) { return x * 23; }
+inline int f4341_24(int x) { return x * 24; }
+inline int f4341_25(int x) { return x * 25; }
+inline int f4341_26(int x) { return x * 26; }
+inline int f4341_27(int x) { return x * 27; }
+inline int f4341_28(int x) { return x * 28; }
+inline int f4341_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4344 */
+#include <vector>
+#include "h4452.h"
+#include "h4808.h"
+#include "h6841.h"
+#include "h1255.h"
+#include "h5364.h"
+#ifdef X
+#include "h8043.h"
+#endif
+struct S4344 { int a; const char *s = "x//y"; };
+inline int f4344_0(int x) { return x * 0; }
+inline int f4344_1(int x) { return x * 1; }
+inline int f4344_2(int x) { return x * 2; }
+inline int f4344_3(int x) { return x * 3; }
+inline int f4344_4(int x) { return x * 4; }
+inline int f4344_5(int x) { return x * 5; }
+inline int f4344_6(int x) { return x * 6; }
+inline int f4344_7(int x) { return x * 7; }
+inline int f4344_8(int x) { return x * 8; }
+inline int f4344_9(int x) { return x * 9; }
+inline int f4344_10(int x) { return x * 10; }
+inline int f4344_11(int x) { return x * 11; }
+inline int f4344_12(int x) { return x * 12; }
+inline int f4344_13(int x) { return x * 13; }
+inline int f4344_14(int x) { return x * 14; }
+inline int f4344_15(int x) { return x * 15; }
+inline int f4344_16(int x) { return x * 16; }
+inline int f4344_17(int x) { return x * 17; }
+inline int f4344_18(int x) { return x * 18; }
+inline int f4344_19(int x) { return x * 19; }
+inline int f4344_20(int x) { return x * 20; }
+inline int f4344_21(int x) { return x * 21; }
+inline int f4344_22(int x) { return x * 22; }
+inline int f4344_23(int x) { return x * 23; }
+inline int f4344_24(int x) { return x * 24; }
+inline int f4344_25(int x) { return x * 25; }
+inline int f4344_26(int x) { return x * 26; }
+inline int f4344_27(int x) { return x * 27; }
+inline int f4344_28(int x) { return x * 28; }
+inline int f4344_29(int x) { return x * 29; }
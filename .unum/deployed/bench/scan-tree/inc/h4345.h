@@ -0,0 +1,42 @@
+#pragma once
+/* header 4345 */
+#include <vector>
+#include "h133.h"
+#include "h4981.h"
+#include "h5997.h"
+#include "h1583.h"
+#include "h6837.h"
+#ifdef X
+#include "h9942.h"
+#endif
+struct S4345 { int a; const char *s = "x//y"; };
+inline int f4345_0(int x) { return x * 0; }
+inline int f4345_1(int x) { return x * 1; }
+inline int f4345_2(int x) { return x * 2; }
+inline int f4345_3(int x) { return x * 3; }
+inline int f4345_4(int x) { return x * 4; }
+inline int f4345_5(int x) { return x * 5; }
+inline int f4345_6(int x) { return x * 6; }
+inline int f4345_7(int x) { return x * 7; }
+inline int f4345_8(int x) { return x * 8; }
+inline int f4345_9(int x) { return x * 9; }
+inline int f4345_10(int x) { return x * 10; }
+inline int f4345_11(int x) { return x * 11; }
+inline int f4345_12(int x) { return x * 12; }
+inline int f4345_13(int x) { return x * 13; }
+inline int f4345_14(int x) { return x * 14; }
+inline int f4345_15(int x) { return x * 15; }
+inline int f4345_16(int x) { return x * 16; }
+inline int f4345_17(int x) { return x * 17; }
+inline int f4345_18(int x) { return x * 18; }
+inline int f4345_19(int x) { return x * 19; }
+inline int f4345_20(int x) { return x * 20; }
+inline int f4345_21(int x) { return x * 21; }
+inline int f4345_22(int x) { return x * 22; }
+inline int f4345_23(int x) { return x * 23; }
+inline int f4345_24(int x) { return x * 24; }
+inline int f4345_25(int x) { return x * 25; }
+inline int f4345_26(int x) { return x * 26; }
+inline int f4345_27(int x) { return x * 27; }
+inline int f4345_28(int x) { return x * 28; }
+inline int f4345_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4348 */
+#include <vector>
+#include "h642.h"
+#include "h2483.h"
+#include "h5356.h"
+#include "h4116.h"
+#include "h1348.h"
+#ifdef X
+#include "h4197.h"
+#endif
+struct S4348 { int a; const char *s = "x//y"; };
+inline int f4348_0(int x) { return x * 0; }
+inline int f4348_1(int x) { return x * 1; }
+inline int f4348_2(int x) { return x * 2; }
+inline int f4348_3(int x) { return x * 3; }
+inline int f4348_4(int x) { return x * 4; }
+inline int f4348_5(int x) { return x * 5; }
+inline int f4348_6(int x) { return x * 6; }
+inline int f4348_7(int x) { return x * 7; }
+inline int f4348_8(int x) { return x * 8; }
+inline int f4348_9(int x) { return x * 9; }
+inline int f4348_10(int x) { return x * 10; }
+inline int f4348_11(int x) { return x * 11; }
+inline int f4348_12(int x) { return x * 12; }
+inline int f4348_13(int x) { return x * 13; }
+inline int f4348_14(int x) { return x * 14; }
+inline int f4348_15(int x) { return x * 15; }
+inline int f4348_16(int x) { return x * 16; }
+inline int f4348_17(int x) { return x * 17; }
+inline int f4348_18(int x) { return x * 18; }
+inline int f4348_19(int x) { return x * 19; }
+inline int f4348_20(int x) { return x * 20; }
+inline int f4348_21(int x) { return x * 21; }
+inline int f4348_22(int x) { return x * 22; }
+inline int f4348_23(int x) { return x * 23; }
+inline int f4348_24(int x) { return x * 24; }
+inline int f4348_25(int x) { return x * 25; }
+inline int f4348_26(int x) { return x * 26; }
+inline int f4348_27(int x) { return x * 27; }
+inline int f4348_28(int x) { return x * 28; }
+inline int f4348_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4353 */
+#include <vector>
+#include "h8983.h"
+#include "h729.h"
+#include "h3930.h"
+#include "h6332.h"
+#include "h972.h"
+#ifdef X
+#include "h8846.h"
+#endif
+struct S4353 { int a; const char *s = "x//y"; };
+inline int f4353_0(int x) { return x * 0; }
+inline int f4353_1(int x) { return x * 1; }
+inline int f4353_2(int x) { return x * 2; }
+inline int f4353_3(int x) { return x * 3; }
+inline int f4353_4(int x) { return x * 4; }
+inline int f4353_5(int x) { return x * 5; }
+inline int f4353_6(int x) { return x * 6; }
+inline int f4353_7(int x) { return x * 7; }
+inline int f4353_8(int x) { return x * 8; }
+inline int f4353_9(int x) { return x * 9; }
+inline int f4353_10(int x) { return x * 10; }
+inline int f4353_11(int x) { return x * 11; }
+inline int f4353_12(int x) { return x * 12; }
+inline int f4353_13(int x) { return x * 13; }
+inline int f4353_14(int x) { return x * 14; }
+inline int f4353_15(int x) { return x * 15; }
+inline int f4353_16(int x) { return x * 16; }
+inline int f4353_17(int x) { return x * 17; }
+inline int f4353_18(int x) { return x * 18; }
+inline int f4353_19(int x) { return x * 19; }
+inline int f4353_20(int x) { return x * 20; }
+inline int f4353_21(int x) { return x * 21; }
+inline int f4353_22(int x) { return x * 22; }
+inline int f4353_23(int x) { return x * 23; }
+inline int f4353_24(int x) { return x * 24; }
+inline int f4353_25(int x) { return x * 25; }
+inline int f4353_26(int x) { return x * 26; }
+inline int f4353_27(int x) { return x * 27; }
+inline int f4353_28(int x) { return x * 28; }
+inline int f4353_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4354 */
+#include <vector>
+#include "h3717.h"
+#include "h9176.h"
+#include "h6416.h"
+#include "h1725.h"
+#include "h7977.h"
+#ifdef X
+#include "h1580.h"
+#endif
+struct S4354 { int a; const char *s = "x//y"; };
+inline int f4354_0(int x) { return x * 0; }
+inline int f4354_1(int x) { return x * 1; }
+inline int f4354_2(int x) { return x * 2; }
+inline int f4354_3(int x) { return x * 3; }
+inline int f4354_4(int x) { return x * 4; }
+inline int f4354_5(int x) { return x * 5; }
+inline int f4354_6(int x) { return x * 6; }
+inline int f4354_7(int x) { return x * 7; }
+inline int f4354_8(int x) { return x * 8; }
+inline int f4354_9(int x) { return x * 9; }
+inline int f4354_10(int x) { return x * 10; }
+inline int f4354_11(int x) { return x * 11; }
+inline int f4354_12(int x) { return x * 12; }
+inline int f4354_13(int x) { return x * 13; }
+inline int f4354_14(int x) { return x * 14; }
+inline int f4354_15(int x) { return x * 15; }
+inline int f4354_16(int x) { return x * 16; }
+inline int f4354_17(int x) { return x * 17; }
+inline int f4354_18(int x) { return x * 18; }
+inline int f4354_19(int x) { return x * 19; }
+inline int f4354_20(int x) { return x * 20; }
+inline int f4354_21(int x) { return x * 21; }
+inline int f4354_22(int x) { return x * 22; }
+inline int f4354_23(int x) { return x * 23; }
+inline int f4354_24(int x) { return x * 24; }
+inline int f4354_25(int x) { return x * 25; }
+inline int f4354_26(int x) { return x * 26; }
+inline int f4354_27(int x) { return x * 27; }
+inline int f4354_28(int x) { return x * 28; }
+inline int f4354_29(int x) { return x * 29; }
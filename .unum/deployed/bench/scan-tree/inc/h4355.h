@@ -0,0 +1,42 @@
+#pragma once
+/* header 4355 */
+#include <vector>
+#include "h5331.h"
+#include "h4883.h"
+#include "h3774.h"
+#include "h2753.h"
+#include "h899.h"
+#ifdef X
+#include "h3770.h"
+#endif
+struct S4355 { int a; const char *s = "x//y"; };
+inline int f4355_0(int x) { return x * 0; }
+inline int f4355_1(int x) { return x * 1; }
+inline int f4355_2(int x) { return x * 2; }
+inline int f4355_3(int x) { return x * 3; }
+inline int f4355_4(int x) { return x * 4; }
+inline int f4355_5(int x) { return x * 5; }
+inline int f4355_6(int x) { return x * 6; }
+inline int f4355_7(int x) { return x * 7; }
+inline int f4355_8(int x) { return x * 8; }
+inline int f4355_9(int x) { return x * 9; }
+inline int f4355_10(int x) { return x * 10; }
+inline int f4355_11(int x) { return x * 11; }
+inline int f4355_12(int x) { return x * 12; }
+inline int f4355_13(int x) { return x * 13; }
+inline int f4355_14(int x) { return x * 14; }
+inline int f4355_15(int x) { return x * 15; }
+inline int f4355_16(int x) { return x * 16; }
+inline int f4355_17(int x) { return x * 17; }
+inline int f4355_18(int x) { return x * 18; }
+inline int f4355_19(int x) { return x * 19; }
+inline int f4355_20(int x) { return x * 20; }
+inline int f4355_21(int x) { return x * 21; }
+inline int f4355_22(int x) { return x * 22; }
+inline int f4355_23(int x) { return x * 23; }
+inline int f4355_24(int x) { return x * 24; }
+inline int f4355_25(int x) { return x * 25; }
+inline int f4355_26(int x) { return x * 26; }
+inline int f4355_27(int x) { return x * 27; }
+inline int f4355_28(int x) { return x * 28; }
+inline int f4355_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4358 */
+#include <vector>
+#include "h9713.h"
+#include "h7015.h"
+#include "h2067.h"
+#include "h431.h"
+#include "h9079.h"
+#ifdef X
+#include "h6865.h"
+#endif
+struct S4358 { int a; const char *s = "x//y"; };
+inline int f4358_0(int x) { return x * 0; }
+inline int f4358_1(int x) { return x * 1; }
+inline int f4358_2(int x) { return x * 2; }
+inline int f4358_3(int x) { return x * 3; }
+inline int f4358_4(int x) { return x * 4; }
+inline int f4358_5(int x) { return x * 5; }
+inline int f4358_6(int x) { return x * 6; }
+inline int f4358_7(int x) { return x * 7; }
+inline int f4358_8(int x) { return x * 8; }
+inline int f4358_9(int x) { return x * 9; }
+inline int f4358_10(int x) { return x * 10; }
+inline int f4358_11(int x) { return x * 11; }
+inline int f4358_12(int x) { return x * 12; }
+inline int f4358_13(int x) { return x * 13; }
+inline int f4358_14(int x) { return x * 14; }
+inline int f4358_15(int x) { return x * 15; }
+inline int f4358_16(int x) { return x * 16; }
+inline int f4358_17(int x) { return x * 17; }
+inline int f4358_18(int x) { return x * 18; }
+inline int f4358_19(int x) { return x * 19; }
+inline int f4358_20(int x) { return x * 20; }
+inline int f4358_21(int x) { return x * 21; }
+inline int f4358_22(int x) { return x * 22; }
+inline int f4358_23(int x) { return x * 23; }
+inline int f4358_24(int x) { return x * 24; }
+inline int f4358_25(int x) { return x * 25; }
+inline int f4358_26(int x) { return x * 26; }
+inline int f4358_27(int x) { return x * 27; }
+inline int f4358_28(int x) { return x * 28; }
+inline int f4358_29(int x) { return x * 29; }
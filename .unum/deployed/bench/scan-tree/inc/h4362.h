@@ -0,0 +1,42 @@
+#pragma once
+/* header 4362 */
+#include <vector>
+#include "h6397.h"
+#include "h8964.h"
+#include "h2490.h"
+#include "h7855.h"
+#include "h1743.h"
+#ifdef X
+#include "h9632.h"
+#endif
+struct S4362 { int a; const char *s = "x//y"; };
+inline int f4362_0(int x) { return x * 0; }
+inline int f4362_1(int x) { return x * 1; }
+inline int f4362_2(int x) { return x * 2; }
+inline int f4362_3(int x) { return x * 3; }
+inline int f4362_4(int x) { return x * 4; }
+inline int f4362_5(int x) { return x * 5; }
+inline int f4362_6(int x) { return x * 6; }
+inline int f4362_7(int x) { return x * 7; }
+inline int f4362_8(int x) { return x * 8; }
+inline int f4362_9(int x) { return x * 9; }
+inline int f4362_10(int x) { return x * 10; }
+inline int f4362_11(int x) { return x * 11; }
+inline int f4362_12(int x) { return x * 12; }
+inline int f4362_13(int x) { return x * 13; }
+inline int f4362_14(int x) { return x * 14; }
+inline int f4362_15(int x) { return x * 15; }
+inline int f4362_16(int x) { return x * 16; }
+inline int f4362_17(int x) { return x * 17; }
+inline int f4362_18(int x) { return x * 18; }
+inline int f4362_19(int x) { return x * 19; }
+inline int f4362_20(int x) { return x * 20; }
+inline int f4362_21(int x) { return x * 21; }
+inline int f4362_22(int x) { return x * 22; }
+inline int f4362_23(int x) { return x * 23; }
+inline int f4362_24(int x) { return x * 24; }
+inline int f4362_25(int x) { return x * 25; }
+inline int f4362_26(int x) { return x * 26; }
+inline int f4362_27(int x) { return x * 27; }
+inline int f4362_28(int x) { return x * 28; }
+inline int f4362_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4364 */
+#include <vector>
+#include "h882.h"
+#include "h2468.h"
+#include "h2887.h"
+#include "h9709.h"
+#include "h2425.h"
+#ifdef X
+#include "h3667.h"
+#endif
+struct S4364 { int a; const char *s = "x//y"; };
+inline int f4364_0(int x) { return x * 0; }
+inline int f4364_1(int x) { return x * 1; }
+inline int f4364_2(int x) { return x * 2; }
+inline int f4364_3(int x) { return x * 3; }
+inline int f4364_4(int x) { return x * 4; }
+inline int f4364_5(int x) { return x * 5; }
+inline int f4364_6(int x) { return x * 6; }
+inline int f4364_7(int x) { return x * 7; }
+inline int f4364_8(int x) { return x * 8; }
+inline int f4364_9(int x) { return x * 9; }
+inline int f4364_10(int x) { return x * 10; }
+inline int f4364_11(int x) { return x * 11; }
+inline int f4364_12(int x) { return x * 12; }
+inline int f4364_13(int x) { return x * 13; }
+inline int f4364_14(int x) { return x * 14; }
+inline int f4364_15(int x) { return x * 15; }
+inline int f4364_16(int x) { return x * 16; }
+inline int f4364_17(int x) { return x * 17; }
+inline int f4364_18(int x) { return x * 18; }
+inline int f4364_19(int x) { return x * 19; }
+inline int f4364_20(int x) { return x * 20; }
+inline int f4364_21(int x) { return x * 21; }
+inline int f4364_22(int x) { return x * 22; }
+inline int f4364_23(int x) { return x * 23; }
+inline int f4364_24(int x) { return x * 24; }
+inline int f4364_25(int x) { return x * 25; }
+inline int f4364_26(int x) { return x * 26; }
+inline int f4364_27(int x) { return x * 27; }
+inline int f4364_28(int x) { return x * 28; }
+inline int f4364_29(int x) { return x * 29; }
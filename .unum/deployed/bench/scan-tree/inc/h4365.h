@@ -0,0 +1,42 @@
+#pragma once
+/* header 4365 */
+#include <vector>
+#include "h8692.h"
+#include "h6544.h"
+#include "h824.h"
+#include "h2029.h"
+#include "h4171.h"
+#ifdef X
+#include "h5569.h"
+#endif
+struct S4365 { int a; const char *s = "x//y"; };
+inline int f4365_0(int x) { return x * 0; }
+inline int f4365_1(int x) { return x * 1; }
+inline int f4365_2(int x) { return x * 2; }
+inline int f4365_3(int x) { return x * 3; }
+inline int f4365_4(int x) { return x * 4; }
+inline int f4365_5(int x) { return x * 5; }
+inline int f4365_6(int x) { return x * 6; }
+inline int f4365_7(int x) { return x * 7; }
+inline int f4365_8(int x) { return x * 8; }
+inline int f4365_9(int x) { return x * 9; }
+inline int f4365_10(int x) { return x * 10; }
+inline int f4365_11(int x) { return x * 11; }
+inline int f4365_12(int x) { return x * 12; }
+inline int f4365_13(int x) { return x * 13; }
+inline int f4365_14(int x) { return x * 14; }
+inline int f4365_15(int x) { return x * 15; }
+inline int f4365_16(int x) { return x * 16; }
+inline int f4365_17(int x) { return x * 17; }
+inline int f4365_18(int x) { return x * 18; }
+inline int f4365_19(int x) { return x * 19; }
+inline int f4365_20(int x) { return x * 20; }
+inline int f4365_21(int x) { return x * 21; }
+inline int f4365_22(int x) { return x * 22; }
+inline int f4365_23(int x) { return x * 23; }
+inline int f4365_24(int x) { return x * 24; }
+inline int f4365_25(int x) { return x * 25; }
+inline int f4365_26(int x) { return x * 26; }
+inline int f4365_27(int x) { return x * 27; }
+inline int f4365_28(int x) { return x * 28; }
+inline int f4365_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4366 */
+#include <vector>
+#include "h402.h"
+#include "h9411.h"
+#include "h6192.h"
+#include "h6306.h"
+#include "h8331.h"
+#ifdef X
+#include "h2621.h"
+#endif
+struct S4366 { int a; const char *s = "x//y"; };
+inline int f4366_0(int x) { return x * 0; }
+inline int f4366_1(int x) { return x * 1; }
+inline int f4366_2(int x) { return x * 2; }
+inline int f4366_3(int x) { return x * 3; }
+inline int f4366_4(int x) { return x * 4; }
+inline int f4366_5(int x) { return x * 5; }
+inline int f4366_6(int x) { return x * 6; }
+inline int f4366_7(int x) { return x * 7; }
+inline int f4366_8(int x) { return x * 8; }
+inline int f4366_9(int x) { return x * 9; }
+inline int f4366_10(int x) { return x * 10; }
+inline int f4366_11(int x) { return x * 11; }
+inline int f4366_12(int x) { return x * 12; }
+inline int f4366_13(int x) { return x * 13; }
+inline int f4366_14(int x) { return x * 14; }
+inline int f4366_15(int x) { return x * 15; }
+inline int f4366_16(int x) { return x * 16; }
+inline int f4366_17(int x) { return x * 17; }
+inline int f4366_18(int x) { return x * 18; }
+inline int f4366_19(int x) { return x * 19; }
+inline int f4366_20(int x) { return x * 20; }
+inline int f4366_21(int x) { return x * 21; }
+inline int f4366_22(int x) { return x * 22; }
+inline int f4366_23(int x) { return x * 23; }
+inline int f4366_24(int x) { return x * 24; }
+inline int f4366_25(int x) { return x * 25; }
+inline int f4366_26(int x) { return x * 26; }
+inline int f4366_27(int x) { return x * 27; }
+inline int f4366_28(int x) { return x * 28; }
+inline int f4366_29(int x) { return x * 29; }
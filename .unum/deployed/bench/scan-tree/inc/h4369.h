@@ -0,0 +1,42 @@
+#pragma once
+/* header 4369 */
+#include <vector>
+#include "h5078.h"
+#include "h2444.h"
+#include "h7483.h"
+#include "h5985.h"
+#include "h8179.h"
+#ifdef X
+#include "h6355.h"
+#endif
+struct S4369 { int a; const char *s = "x//y"; };
+inline int f4369_0(int x) { return x * 0; }
+inline int f4369_1(int x) { return x * 1; }
+inline int f4369_2(int x) { return x * 2; }
+inline int f4369_3(int x) { return x * 3; }
+inline int f4369_4(int x) { return x * 4; }
+inline int f4369_5(int x) { return x * 5; }
+inline int f4369_6(int x) { return x * 6; }
+inline int f4369_7(int x) { return x * 7; }
+inline int f4369_8(int x) { return x * 8; }
+inline int f4369_9(int x) { return x * 9; }
+inline int f4369_10(int x) { return x * 10; }
+inline int f4369_11(int x) { return x * 11; }
+inline int f4369_12(int x) { return x * 12; }
+inline int f4369_13(int x) { return x * 13; }
+inline int f4369_14(int x) { return x * 14; }
+inline int f4369_15(int x) { return x * 15; }
+inline int f4369_16(int x) { return x * 16; }
+inline int f4369_17(int x) { return x * 17; }
+inline int f4369_18(int x) { return x * 18; }
+inline int f4369_19(int x) { return x * 19; }
+inline int f4369_20(int x) { return x * 20; }
+inline int f4369_21(int x) { return x * 21; }
+inline int f4369_22(int x) { return x * 22; }
+inline int f4369_23(int x) { return x * 23; }
+inline int f4369_24(int x) { return x * 24; }
+inline int f4369_25(int x) { return x * 25; }
+inline int f4369_26(int x) { return x * 26; }
+inline int f4369_27(int x) { return x * 27; }
+inline int f4369_28(int x) { return x * 28; }
+inline int f4369_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 437 */
+#include <vector>
+#include "h7600.h"
+#include "h62.h"
+#include "h8617.h"
+#include "h411.h"
+#include "h9274.h"
+#ifdef X
+#include "h608.h"
+#endif
+struct S437 { int a; const char *s = "x//y"; };
+inline int f437_0(int x) { return x * 0; }
+inline int f437_1(int x) { return x * 1; }
+inline int f437_2(int x) { return x * 2; }
+inline int f437_3(int x) { return x * 3; }
+inline int f437_4(int x) { return x * 4; }
+inline int f437_5(int x) { return x * 5; }
+inline int f437_6(int x) { return x * 6; }
+inline int f437_7(int x) { return x * 7; }
+inline int f437_8(int x) { return x * 8; }
+inline int f437_9(int x) { return x * 9; }
+inline int f437_10(int x) { return x * 10; }
+inline int f437_11(int x) { return x * 11; }
+inline int f437_12(int x) { return x * 12; }
+inline int f437_13(int x) { return x * 13; }
+inline int f437_14(int x) { return x * 14; }
+inline int f437_15(int x) { return x * 15; }
+inline int f437_16(int x) { return x * 16; }
+inline int f437_17(int x) { return x * 17; }
+inline int f437_18(int x) { return x * 18; }
+inline int f437_19(int x) { return x * 19; }
+inline int f437_20(int x) { return x * 20; }
+inline int f437_21(int x) { return x * 21; }
+inline int f437_22(int x) { return x * 22; }
+inline int f437_23(int x) { return x * 23; }
+inline int f437_24(int x) { return x * 24; }
+inline int f437_25(int x) { return x * 25; }
+inline int f437_26(int x) { return x * 26; }
+inline int f437_27(int x) { return x * 27; }
+inline int f437_28(int x) { return x * 28; }
+inline int f437_29(int x) { return x * 29; }
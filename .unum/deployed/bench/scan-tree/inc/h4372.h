@@ -0,0 +1,42 @@
+#pragma once
+/* header 4372 */
+#include <vector>
+#include "h6710.h"
+#include "h5710.h"
+#include "h857.h"
+#include "h49.h"
+#include "h2138.h"
+#ifdef X
+#include "h850.h"
+#endif
+struct S4372 { int a; const char *s = "x//y"; };
+inline int f4372_0(int x) { return x * 0; }
+inline int f4372_1(int x) { return x * 1; }
+inline int f4372_2(int x) { return x * 2; }
+inline int f4372_3(int x) { return x * 3; }
+inline int f4372_4(int x) { return x * 4; }
+inline int f4372_5(int x) { return x * 5; }
+inline int f4372_6(int x) { return x * 6; }
+inline int f4372_7(int x) { return x * 7; }
+inline int f4372_8(int x) { return x * 8; }
+inline int f4372_9(int x) { return x * 9; }
+inline int f4372_10(int x) { return x * 10; }
+inline int f4372_11(int x) { return x * 11; }
+inline int f4372_12(int x) { return x * 12; }
+inline int f4372_13(int x) { return x * 13; }
+inline int f4372_14(int x) { return x * 14; }
+inline int f4372_15(int x) { return x * 15; }
+inline int f4372_16(int x) { return x * 16; }
+inline int f4372_17(int x) { return x * 17; }
+inline int f4372_18(int x) { return x * 18; }
+inline int f4372_19(int x) { return x * 19; }
+inline int f4372_20(int x) { return x * 20; }
+inline int f4372_21(int x) { return x * 21; }
+inline int f4372_22(int x) { return x * 22; }
+inline int f4372_23(int x) { return x * 23; }
+inline int f4372_24(int x) { return x * 24; }
+inline int f4372_25(int x) { return x * 25; }
+inline int f4372_26(int x) { return x * 26; }
+inline int f4372_27(int x) { return x * 27; }
+inline int f4372_28(int x) { return x * 28; }
+inline int f4372_29(int x) { return x * 29; }
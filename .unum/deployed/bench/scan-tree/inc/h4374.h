@@ -0,0 +1,42 @@
+#pragma once
+/* header 4374 */
+#include <vector>
+#include "h9204.h"
+#include "h1684.h"
+#include "h4115.h"
+#include "h9505.h"
+#include "h3053.h"
+#ifdef X
+#include "h8414.h"
+#endif
+struct S4374 { int a; const char *s = "x//y"; };
+inline int f4374_0(int x) { return x * 0; }
+inline int f4374_1(int x) { return x * 1; }
+inline int f4374_2(int x) { return x * 2; }
+inline int f4374_3(int x) { return x * 3; }
+inline int f4374_4(int x) { return x * 4; }
+inline int f4374_5(int x) { return x * 5; }
+inline int f4374_6(int x) { return x * 6; }
+inline int f4374_7(int x) { return x * 7; }
+inline int f4374_8(int x) { return x * 8; }
+inline int f4374_9(int x) { return x * 9; }
+inline int f4374_10(int x) { return x * 10; }
+inline int f4374_11(int x) { return x * 11; }
+inline int f4374_12(int x) { return x * 12; }
+inline int f4374_13(int x) { return x * 13; }
+inline int f4374_14(int x) { return x * 14; }
+inline int f4374_15(int x) { return x * 15; }
+inline int f4374_16(int x) { return x * 16; }
+inline int f4374_17(int x) { return x * 17; }
+inline int f4374_18(int x) { return x * 18; }
+inline int f4374_19(int x) { return x * 19; }
+inline int f4374_20(int x) { return x * 20; }
+inline int f4374_21(int x) { return x * 21; }
+inline int f4374_22(int x) { return x * 22; }
+inline int f4374_23(int x) { return x * 23; }
+inline int f4374_24(int x) { return x * 24; }
+inline int f4374_25(int x) { return x * 25; }
+inline int f4374_26(int x) { return x * 26; }
+inline int f4374_27(int x) { return x * 27; }
+inline int f4374_28(int x) { return x * 28; }
+inline int f4374_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4375 */
+#include <vector>
+#include "h6210.h"
+#include "h51.h"
+#include "h8304.h"
+#include "h1011.h"
+#include "h5193.h"
+#ifdef X
+#include "h7842.h"
+#endif
+struct S4375 { int a; const char *s = "x//y"; };
+inline int f4375_0(int x) { return x * 0; }
+inline int f4375_1(int x) { return x * 1; }
+inline int f4375_2(int x) { return x * 2; }
+inline int f4375_3(int x) { return x * 3; }
+inline int f4375_4(int x) { return x * 4; }
+inline int f4375_5(int x) { return x * 5; }
+inline int f4375_6(int x) { return x * 6; }
+inline int f4375_7(int x) { return x * 7; }
+inline int f4375_8(int x) { return x * 8; }
+inline int f4375_9(int x) { return x * 9; }
+inline int f4375_10(int x) { return x * 10; }
+inline int f4375_11(int x) { return x * 11; }
+inline int f4375_12(int x) { return x * 12; }
+inline int f4375_13(int x) { return x * 13; }
+inline int f4375_14(int x) { return x * 14; }
+inline int f4375_15(int x) { return x * 15; }
+inline int f4375_16(int x) { return x * 16; }
+inline int f4375_17(int x) { return x * 17; }
+inline int f4375_18(int x) { return x * 18; }
+inline int f4375_19(int x) { return x * 19; }
+inline int f4375_20(int x) { return x * 20; }
+inline int f4375_21(int x) { return x * 21; }
+inline int f4375_22(int x) { return x * 22; }
+inline int f4375_23(int x) { return x * 23; }
+inline int f4375_24(int x) { return x * 24; }
+inline int f4375_25(int x) { return x * 25; }
+inline int f4375_26(int x) { return x * 26; }
+inline int f4375_27(int x) { return x * 27; }
+inline int f4375_28(int x) { return x * 28; }
+inline int f4375_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4376 */
+#include <vector>
+#include "h432.h"
+#include "h864.h"
+#include "h591.h"
+#include "h1407.h"
+#include "h4966.h"
+#ifdef X
+#include "h5197.h"
+#endif
+struct S4376 { int a; const char *s = "x//y"; };
+inline int f4376_0(int x) { return x * 0; }
+inline int f4376_1(int x) { return x * 1; }
+inline int f4376_2(int x) { return x * 2; }
+inline int f4376_3(int x) { return x * 3; }
+inline int f4376_4(int x) { return x * 4; }
+inline int f4376_5(int x) { return x * 5; }
+inline int f4376_6(int x) { return x * 6; }
+inline int f4376_7(int x) { return x * 7; }
+inline int f4376_8(int x) { return x * 8; }
+inline int f4376_9(int x) { return x * 9; }
+inline int f4376_10(int x) { return x * 10; }
+inline int f4376_11(int x) { return x * 11; }
+inline int f4376_12(int x) { return x * 12; }
+inline int f4376_13(int x) { return x * 13; }
+inline int f4376_14(int x) { return x * 14; }
+inline int f4376_15(int x) { return x * 15; }
+inline int f4376_16(int x) { return x * 16; }
+inline int f4376_17(int x) { return x * 17; }
+inline int f4376_18(int x) { return x * 18; }
+inline int f4376_19(int x) { return x * 19; }
+inline int f4376_20(int x) { return x * 20; }
+inline int f4376_21(int x) { return x * 21; }
+inline int f4376_22(int x) { return x * 22; }
+inline int f4376_23(int x) { return x * 23; }
+inline int f4376_24(int x) { return x * 24; }
+inline int f4376_25(int x) { return x * 25; }
+inline int f4376_26(int x) { return x * 26; }
+inline int f4376_27(int x) { return x * 27; }
+inline int f4376_28(int x) { return x * 28; }
+inline int f4376_29(int x) { return x * 29; }
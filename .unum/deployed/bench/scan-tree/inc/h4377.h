@@ -0,0 +1,42 @@
+#pragma once
+/* header 4377 */
+#include <vector>
+#include "h6998.h"
+#include "h1779.h"
+#include "h4326.h"
+#include "h5862.h"
+#include "h8335.h"
+#ifdef X
+#include "h2166.h"
+#endif
+struct S4377 { int a; const char *s = "x//y"; };
+inline int f4377_0(int x) { return x * 0; }
+inline int f4377_1(int x) { return x * 1; }
+inline int f4377_2(int x) { return x * 2; }
+inline int f4377_3(int x) { return x * 3; }
+inline int f4377_4(int x) { return x * 4; }
+inline int f4377_5(int x) { return x * 5; }
+inline int f4377_6(int x) { return x * 6; }
+inline int f4377_7(int x) { return x * 7; }
+inline int f4377_8(int x) { return x * 8; }
+inline int f4377_9(int x) { return x * 9; }
+inline int f4377_10(int x) { return x * 10; }
+inline int f4377_11(int x) { return x * 11; }
+inline int f4377_12(int x) { return x * 12; }
+inline int f4377_13(int x) { return x * 13; }
+inline int f4377_14(int x) { return x * 14; }
+inline int f4377_15(int x) { return x * 15; }
+inline int f4377_16(int x) { return x * 16; }
+inline int f4377_17(int x) { return x * 17; }
+inline int f4377_18(int x) { return x * 18; }
+inline int f4377_19(int x) { return x * 19; }
+inline int f4377_20(int x) { return x * 20; }
+inline int f4377_21(int x) { return x * 21; }
+inline int f4377_22(int x) { return x * 22; }
+inline int f4377_23(int x) { return x * 23; }
+inline int f4377_24(int x) { return x * 24; }
+inline int f4377_25(int x) { return x * 25; }
+inline int f4377_26(int x) { return x * 26; }
+inline int f4377_27(int x) { return x * 27; }
+inline int f4377_28(int x) { return x * 28; }
+inline int f4377_29(int x) { return x * 29; }
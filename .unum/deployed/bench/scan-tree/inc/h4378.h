@@ -0,0 +1,42 @@
+#pragma once
+/* header 4378 */
+#include <vector>
+#include "h3607.h"
+#include "h9410.h"
+#include "h4740.h"
+#include "h6800.h"
+#include "h5224.h"
+#ifdef X
+#include "h926.h"
+#endif
+struct S4378 { int a; const char *s = "x//y"; };
+inline int f4378_0(int x) { return x * 0; }
+inline int f4378_1(int x) { return x * 1; }
+inline int f4378_2(int x) { return x * 2; }
+inline int f4378_3(int x) { return x * 3; }
+inline int f4378_4(int x) { return x * 4; }
+inline int f4378_5(int x) { return x * 5; }
+inline int f4378_6(int x) { return x * 6; }
+inline int f4378_7(int x) { return x * 7; }
+inline int f4378_8(int x) { return x * 8; }
+inline int f4378_9(int x) { return x * 9; }
+inline int f4378_10(int x) { return x * 10; }
+inline int f4378_11(int x) { return x * 11; }
+inline int f4378_12(int x) { return x * 12; }
+inline int f4378_13(int x) { return x * 13; }
+inline int f4378_14(int x) { return x * 14; }
+inline int f4378_15(int x) { return x * 15; }
+inline int f4378_16(int x) { return x * 16; }
+inline int f4378_17(int x) { return x * 17; }
+inline int f4378_18(int x) { return x * 18; }
+inline int f4378_19(int x) { return x * 19; }
+inline int f4378_20(int x) { return x * 20; }
+inline int f4378_21(int x) { return x * 21; }
+inline int f4378_22(int x) { return x * 22; }
+inline int f4378_23(int x) { return x * 23; }
+inline int f4378_24(int x) { return x * 24; }
+inline int f4378_25(int x) { return x * 25; }
+inline int f4378_26(int x) { return x * 26; }
+inline int f4378_27(int x) { return x * 27; }
+inline int f4378_28(int x) { return x * 28; }
+inline int f4378_29(int x) { return x * 29; }
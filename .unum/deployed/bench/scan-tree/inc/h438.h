@@ -0,0 +1,42 @@
+#pragma once
+/* header 438 */
+#include <vector>
+#include "h7038.h"
+#include "h4016.h"
+#include "h5843.h"
+#include "h8734.h"
+#include "h875.h"
+#ifdef X
+#include "h7051.h"
+#endif
+struct S438 { int a; const char *s = "x//y"; };
+inline int f438_0(int x) { return x * 0; }
+inline int f438_1(int x) { return x * 1; }
+inline int f438_2(int x) { return x * 2; }
+inline int f438_3(int x) { return x * 3; }
+inline int f438_4(int x) { return x * 4; }
+inline int f438_5(int x) { return x * 5; }
+inline int f438_6(int x) { return x * 6; }
+inline int f438_7(int x) { return x * 7; }
+inline int f438_8(int x) { return x * 8; }
+inline int f438_9(int x) { return x * 9; }
+inline int f438_10(int x) { return x * 10; }
+inline int f438_11(int x) { return x * 11; }
+inline int f438_12(int x) { return x * 12; }
+inline int f438_13(int x) { return x * 13; }
+inline int f438_14(int x) { return x * 14; }
+inline int f438_15(int x) { return x * 15; }
+inline int f438_16(int x) { return x * 16; }
+inline int f438_17(int x) { return x * 17; }
+inline int f438_18(int x) { return x * 18; }
+inline int f438_19(int x) { return x * 19; }
+inline int f438_20(int x) { return x * 20; }
+inline int f438_21(int x) { return x * 21; }
+inline int f438_22(int x) { return x * 22; }
+inline int f438_23(int x) { return x * 23; }
+inline int f438_24(int x) { return x * 24; }
+inline int f438_25(int x) { return x * 25; }
+inline int f438_26(int x) { return x * 26; }
+inline int f438_27(int x) { return x * 27; }
+inline int f438_28(int x) { return x * 28; }
+inline int f438_29(int x) { return x * 29; }
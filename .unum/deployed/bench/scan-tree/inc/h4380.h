@@ -0,0 +1,42 @@
+#pragma once
+/* header 4380 */
+#include <vector>
+#include "h1244.h"
+#include "h8063.h"
+#include "h8545.h"
+#include "h6609.h"
+#include "h9396.h"
+#ifdef X
+#include "h7151.h"
+#endif
+struct S4380 { int a; const char *s = "x//y"; };
+inline int f4380_0(int x) { return x * 0; }
+inline int f4380_1(int x) { return x * 1; }
+inline int f4380_2(int x) { return x * 2; }
+inline int f4380_3(int x) { return x * 3; }
+inline int f4380_4(int x) { return x * 4; }
+inline int f4380_5(int x) { return x * 5; }
+inline int f4380_6(int x) { return x * 6; }
+inline int f4380_7(int x) { return x * 7; }
+inline int f4380_8(int x) { return x * 8; }
+inline int f4380_9(int x) { return x * 9; }
+inline int f4380_10(int x) { return x * 10; }
+inline int f4380_11(int x) { return x * 11; }
+inline int f4380_12(int x) { return x * 12; }
+inline int f4380_13(int x) { return x * 13; }
+inline int f4380_14(int x) { return x * 14; }
+inline int f4380_15(int x) { return x * 15; }
+inline int f4380_16(int x) { return x * 16; }
+inline int f4380_17(int x) { return x * 17; }
+inline int f4380_18(int x) { return x * 18; }
+inline int f4380_19(int x) { return x * 19; }
+inline int f4380_20(int x) { return x * 20; }
+inline int f4380_21(int x) { return x * 21; }
+inline int f4380_22(int x) { return x * 22; }
+inline int f4380_23(int x) { return x * 23; }
+inline int f4380_24(int x) { return x * 24; }
+inline int f4380_25(int x) { return x * 25; }
+inline int f4380_26(int x) { return x * 26; }
+inline int f4380_27(int x) { return x * 27; }
+inline int f4380_28(int x) { return x * 28; }
+inline int f4380_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4383 */
+#include <vector>
+#include "h2819.h"
+#include "h3116.h"
+#include "h9165.h"
+#include "h3472.h"
+#include "h9142.h"
+#ifdef X
+#include "h5617.h"
+#endif
+struct S4383 { int a; const char *s = "x//y"; };
+inline int f4383_0(int x) { return x * 0; }
+inline int f4383_1(int x) { return x * 1; }
+inline int f4383_2(int x) { return x * 2; }
+inline int f4383_3(int x) { return x * 3; }
+inline int f4383_4(int x) { return x * 4; }
+inline int f4383_5(int x) { return x * 5; }
+inline int f4383_6(int x) { return x * 6; }
+inline int f4383_7(int x) { return x * 7; }
+inline int f4383_8(int x) { return x * 8; }
+inline int f4383_9(int x) { return x * 9; }
+inline int f4383_10(int x) { return x * 10; }
+inline int f4383_11(int x) { return x * 11; }
+inline int f4383_12(int x) { return x * 12; }
+inline int f4383_13(int x) { return x * 13; }
+inline int f4383_14(int x) { return x * 14; }
+inline int f4383_15(int x) { return x * 15; }
+inline int f4383_16(int x) { return x * 16; }
+inline int f4383_17(int x) { return x * 17; }
+inline int f4383_18(int x) { return x * 18; }
+inline int f4383_19(int x) { return x * 19; }
+inline int f4383_20(int x) { return x * 20; }
+inline int f4383_21(int x) { return x * 21; }
+inline int f4383_22(int x) { return x * 22; }
+inline int f4383_23(int x) { return x * 23; }
+inline int f4383_24(int x) { return x * 24; }
+inline int f4383_25(int x) { return x * 25; }
+inline int f4383_26(int x) { return x * 26; }
+inline int f4383_27(int x) { return x * 27; }
+inline int f4383_28(int x) { return x * 28; }
+inline int f4383_29(int x) { return x * 29; }
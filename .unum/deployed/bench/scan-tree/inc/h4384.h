@@ -0,0 +1,42 @@
+#pragma once
+/* header 4384 */
+#include <vector>
+#include "h6515.h"
+#include "h8378.h"
+#include "h782.h"
+#include "h9045.h"
+#include "h9079.h"
+#ifdef X
+#include "h7319.h"
+#endif
+struct S4384 { int a; const char *s = "x//y"; };
+inline int f4384_0(int x) { return x * 0; }
+inline int f4384_1(int x) { return x * 1; }
+inline int f4384_2(int x) { return x * 2; }
+inline int f4384_3(int x) { return x * 3; }
+inline int f4384_4(int x) { return x * 4; }
+inline int f4384_5(int x) { return x * 5; }
+inline int f4384_6(int x) { return x * 6; }
+inline int f4384_7(int x) { return x * 7; }
+inline int f4384_8(int x) { return x * 8; }
+inline int f4384_9(int x) { return x * 9; }
+inline int f4384_10(int x) { return x * 10; }
+inline int f4384_11(int x) { return x * 11; }
+inline int f4384_12(int x) { return x * 12; }
+inline int f4384_13(int x) { return x * 13; }
+inline int f4384_14(int x) { return x * 14; }
+inline int f4384_15(int x) { return x * 15; }
+inline int f4384_16(int x) { return x * 16; }
+inline int f4384_17(int x) { return x * 17; }
+inline int f4384_18(int x) { return x * 18; }
+inline int f4384_19(int x) { return x * 19; }
+inline int f4384_20(int x) { return x * 20; }
+inline int f4384_21(int x) { return x * 21; }
+inline int f4384_22(int x) { return x * 22; }
+inline int f4384_23(int x) { return x * 23; }
+inline int f4384_24(int x) { return x * 24; }
+inline int f4384_25(int x) { return x * 25; }
+inline int f4384_26(int x) { return x * 26; }
+inline int f4384_27(int x) { return x * 27; }
+inline int f4384_28(int x) { return x * 28; }
+inline int f4384_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4385 */
+#include <vector>
+#include "h206.h"
+#include "h9254.h"
+#include "h8357.h"
+#include "h4593.h"
+#include "h9736.h"
+#ifdef X
+#include "h4809.h"
+#endif
+struct S4385 { int a; const char *s = "x//y"; };
+inline int f4385_0(int x) { return x * 0; }
+inline int f4385_1(int x) { return x * 1; }
+inline int f4385_2(int x) { return x * 2; }
+inline int f4385_3(int x) { return x * 3; }
+inline int f4385_4(int x) { return x * 4; }
+inline int f4385_5(int x) { return x * 5; }
+inline int f4385_6(int x) { return x * 6; }
+inline int f4385_7(int x) { return x * 7; }
+inline int f4385_8(int x) { return x * 8; }
+inline int f4385_9(int x) { return x * 9; }
+inline int f4385_10(int x) { return x * 10; }
+inline int f4385_11(int x) { return x * 11; }
+inline int f4385_12(int x) { return x * 12; }
+inline int f4385_13(int x) { return x * 13; }
+inline int f4385_14(int x) { return x * 14; }
+inline int f4385_15(int x) { return x * 15; }
+inline int f4385_16(int x) { return x * 16; }
+inline int f4385_17(int x) { return x * 17; }
+inline int f4385_18(int x) { return x * 18; }
+inline int f4385_19(int x) { return x * 19; }
+inline int f4385_20(int x) { return x * 20; }
+inline int f4385_21(int x) { return x * 21; }
+inline int f4385_22(int x) { return x * 22; }
+inline int f4385_23(int x) { return x * 23; }
+inline int f4385_24(int x) { return x * 24; }
+inline int f4385_25(int x) { return x * 25; }
+inline int f4385_26(int x) { return x * 26; }
+inline int f4385_27(int x) { return x * 27; }
+inline int f4385_28(int x) { return x * 28; }
+inline int f4385_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4393 */
+#include <vector>
+#include "h6051.h"
+#include "h8498.h"
+#include "h5830.h"
+#include "h674.h"
+#include "h9743.h"
+#ifdef X
+#include "h5073.h"
+#endif
+struct S4393 { int a; const char *s = "x//y"; };
+inline int f4393_0(int x) { return x * 0; }
+inline int f4393_1(int x) { return x * 1; }
+inline int f4393_2(int x) { return x * 2; }
+inline int f4393_3(int x) { return x * 3; }
+inline int f4393_4(int x) { return x * 4; }
+inline int f4393_5(int x) { return x * 5; }
+inline int f4393_6(int x) { return x * 6; }
+inline int f4393_7(int x) { return x * 7; }
+inline int f4393_8(int x) { return x * 8; }
+inline int f4393_9(int x) { return x * 9; }
+inline int f4393_10(int x) { return x * 10; }
+inline int f4393_11(int x) { return x * 11; }
+inline int f4393_12(int x) { return x * 12; }
+inline int f4393_13(int x) { return x * 13; }
+inline int f4393_14(int x) { return x * 14; }
+inline int f4393_15(int x) { return x * 15; }
+inline int f4393_16(int x) { return x * 16; }
+inline int f4393_17(int x) { return x * 17; }
+inline int f4393_18(int x) { return x * 18; }
+inline int f4393_19(int x) { return x * 19; }
+inline int f4393_20(int x) { return x * 20; }
+inline int f4393_21(int x) { return x * 21; }
+inline int f4393_22(int x) { return x * 22; }
+inline int f4393_23(int x) { return x * 23; }
+inline int f4393_24(int x) { return x * 24; }
+inline int f4393_25(int x) { return x * 25; }
+inline int f4393_26(int x) { return x * 26; }
+inline int f4393_27(int x) { return x * 27; }
+inline int f4393_28(int x) { return x * 28; }
+inline int f4393_29(int x) { return x * 29; }
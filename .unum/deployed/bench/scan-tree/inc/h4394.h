@@ -0,0 +1,42 @@
+#pragma once
+/* header 4394 */
+#include <vector>
+#include "h6792.h"
+#include "h2075.h"
+#include "h6902.h"
+#include "h68.h"
+#include "h6949.h"
+#ifdef X
+#include "h886.h"
+#endif
+struct S4394 { int a; const char *s = "x//y"; };
+inline int f4394_0(int x) { return x * 0; }
+inline int f4394_1(int x) { return x * 1; }
+inline int f4394_2(int x) { return x * 2; }
+inline int f4394_3(int x) { return x * 3; }
+inline int f4394_4(int x) { return x * 4; }
+inline int f4394_5(int x) { return x * 5; }
+inline int f4394_6(int x) { return x * 6; }
+inline int f4394_7(int x) { return x * 7; }
+inline int f4394_8(int x) { return x * 8; }
+inline int f4394_9(int x) { return x * 9; }
+inline int f4394_10(int x) { return x * 10; }
+inline int f4394_11(int x) { return x * 11; }
+inline int f4394_12(int x) { return x * 12; }
+inline int f4394_13(int x) { return x * 13; }
+inline int f4394_14(int x) { return x * 14; }
+inline int f4394_15(int x) { return x * 15; }
+inline int f4394_16(int x) { return x * 16; }
+inline int f4394_17(int x) { return x * 17; }
+inline int f4394_18(int x) { return x * 18; }
+inline int f4394_19(int x) { return x * 19; }
+inline int f4394_20(int x) { return x * 20; }
+inline int f4394_21(int x) { return x * 21; }
+inline int f4394_22(int x) { return x * 22; }
+inline int f4394_23(int x) { return x * 23; }
+inline int f4394_24(int x) { return x * 24; }
+inline int f4394_25(int x) { return x * 25; }
+inline int f4394_26(int x) { return x * 26; }
+inline int f4394_27(int x) { return x * 27; }
+inline int f4394_28(int x) { return x * 28; }
+inline int f4394_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4395 */
+#include <vector>
+#include "h3001.h"
+#include "h8245.h"
+#include "h5362.h"
+#include "h6387.h"
+#include "h908.h"
+#ifdef X
+#include "h5697.h"
+#endif
+struct S4395 { int a; const char *s = "x//y"; };
+inline int f4395_0(int x) { return x * 0; }
+inline int f4395_1(int x) { return x * 1; }
+inline int f4395_2(int x) { return x * 2; }
+inline int f4395_3(int x) { return x * 3; }
+inline int f4395_4(int x) { return x * 4; }
+inline int f4395_5(int x) { return x * 5; }
+inline int f4395_6(int x) { return x * 6; }
+inline int f4395_7(int x) { return x * 7; }
+inline int f4395_8(int x) { return x * 8; }
+inline int f4395_9(int x) { return x * 9; }
+inline int f4395_10(int x) { return x * 10; }
+inline int f4395_11(int x) { return x * 11; }
+inline int f4395_12(int x) { return x * 12; }
+inline int f4395_13(int x) { return x * 13; }
+inline int f4395_14(int x) { return x * 14; }
+inline int f4395_15(int x) { return x * 15; }
+inline int f4395_16(int x) { return x * 16; }
+inline int f4395_17(int x) { return x * 17; }
+inline int f4395_18(int x) { return x * 18; }
+inline int f4395_19(int x) { return x * 19; }
+inline int f4395_20(int x) { return x * 20; }
+inline int f4395_21(int x) { return x * 21; }
+inline int f4395_22(int x) { return x * 22; }
+inline int f4395_23(int x) { return x * 23; }
+inline int f4395_24(int x) { return x * 24; }
+inline int f4395_25(int x) { return x * 25; }
+inline int f4395_26(int x) { return x * 26; }
+inline int f4395_27(int x) { return x * 27; }
+inline int f4395_28(int x) { return x * 28; }
+inline int f4395_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4396 */
+#include <vector>
+#include "h6939.h"
+#include "h9966.h"
+#include "h9471.h"
+#include "h6586.h"
+#include "h5338.h"
+#ifdef X
+#include "h1956.h"
+#endif
+struct S4396 { int a; const char *s = "x//y"; };
+inline int f4396_0(int x) { return x * 0; }
+inline int f4396_1(int x) { return x * 1; }
+inline int f4396_2(int x) { return x * 2; }
+inline int f4396_3(int x) { return x * 3; }
+inline int f4396_4(int x) { return x * 4; }
+inline int f4396_5(int x) { return x * 5; }
+inline int f4396_6(int x) { return x * 6; }
+inline int f4396_7(int x) { return x * 7; }
+inline int f4396_8(int x) { return x * 8; }
+inline int f4396_9(int x) { return x * 9; }
+inline int f4396_10(int x) { return x * 10; }
+inline int f4396_11(int x) { return x * 11; }
+inline int f4396_12(int x) { return x * 12; }
+inline int f4396_13(int x) { return x * 13; }
+inline int f4396_14(int x) { return x * 14; }
+inline int f4396_15(int x) { return x * 15; }
+inline int f4396_16(int x) { return x * 16; }
+inline int f4396_17(int x) { return x * 17; }
+inline int f4396_18(int x) { return x * 18; }
+inline int f4396_19(int x) { return x * 19; }
+inline int f4396_20(int x) { return x * 20; }
+inline int f4396_21(int x) { return x * 21; }
+inline int f4396_22(int x) { return x * 22; }
+inline int f4396_23(int x) { return x * 23; }
+inline int f4396_24(int x) { return x * 24; }
+inline int f4396_25(int x) { return x * 25; }
+inline int f4396_26(int x) { return x * 26; }
+inline int f4396_27(int x) { return x * 27; }
+inline int f4396_28(int x) { return x * 28; }
+inline int f4396_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4398 */
+#include <vector>
+#include "h1069.h"
+#include "h3241.h"
+#include "h8786.h"
+#include "h1053.h"
+#include "h4204.h"
+#ifdef X
+#include "h2119.h"
+#endif
+struct S4398 { int a; const char *s = "x//y"; };
+inline int f4398_0(int x) { return x * 0; }
+inline int f4398_1(int x) { return x * 1; }
+inline int f4398_2(int x) { return x * 2; }
+inline int f4398_3(int x) { return x * 3; }
+inline int f4398_4(int x) { return x * 4; }
+inline int f4398_5(int x) { return x * 5; }
+inline int f4398_6(int x) { return x * 6; }
+inline int f4398_7(int x) { return x * 7; }
+inline int f4398_8(int x) { return x * 8; }
+inline int f4398_9(int x) { return x * 9; }
+inline int f4398_10(int x) { return x * 10; }
+inline int f4398_11(int x) { return x * 11; }
+inline int f4398_12(int x) { return x * 12; }
+inline int f4398_13(int x) { return x * 13; }
+inline int f4398_14(int x) { return x * 14; }
+inline int f4398_15(int x) { return x * 15; }
+inline int f4398_16(int x) { return x * 16; }
+inline int f4398_17(int x) { return x * 17; }
+inline int f4398_18(int x) { return x * 18; }
+inline int f4398_19(int x) { return x * 19; }
+inline int f4398_20(int x) { return x * 20; }
+inline int f4398_21(int x) { return x * 21; }
+inline int f4398_22(int x) { return x * 22; }
+inline int f4398_23(int x) { return x * 23; }
+inline int f4398_24(int x) { return x * 24; }
+inline int f4398_25(int x) { return x * 25; }
+inline int f4398_26(int x) { return x * 26; }
+inline int f4398_27(int x) { return x * 27; }
+inline int f4398_28(int x) { return x * 28; }
+inline int f4398_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4399 */
+#include <vector>
+#include "h4976.h"
+#include "h2439.h"
+#include "h5468.h"
+#include "h7808.h"
+#include "h4413.h"
+#ifdef X
+#include "h8681.h"
+#endif
+struct S4399 { int a; const char *s = "x//y"; };
+inline int f4399_0(int x) { return x * 0; }
+inline int f4399_1(int x) { return x * 1; }
+inline int f4399_2(int x) { return x * 2; }
+inline int f4399_3(int x) { return x * 3; }
+inline int f4399_4(int x) { return x * 4; }
+inline int f4399_5(int x) { return x * 5; }
+inline int f4399_6(int x) { return x * 6; }
+inline int f4399_7(int x) { return x * 7; }
+inline int f4399_8(int x) { return x * 8; }
+inline int f4399_9(int x) { return x * 9; }
+inline int f4399_10(int x) { return x * 10; }
+inline int f4399_11(int x) { return x * 11; }
+inline int f4399_12(int x) { return x * 12; }
+inline int f4399_13(int x) { return x * 13; }
+inline int f4399_14(int x) { return x * 14; }
+inline int f4399_15(int x) { return x * 15; }
+inline int f4399_16(int x) { return x * 16; }
+inline int f4399_17(int x) { return x * 17; }
+inline int f4399_18(int x) { return x * 18; }
+inline int f4399_19(int x) { return x * 19; }
+inline int f4399_20(int x) { return x * 20; }
+inline int f4399_21(int x) { return x * 21; }
+inline int f4399_22(int x) { return x * 22; }
+inline int f4399_23(int x) { return x * 23; }
+inline int f4399_24(int x) { return x * 24; }
+inline int f4399_25(int x) { return x * 25; }
+inline int f4399_26(int x) { return x * 26; }
+inline int f4399_27(int x) { return x * 27; }
+inline int f4399_28(int x) { return x * 28; }
+inline int f4399_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 44 */
+#include <vector>
+#include "h467.h"
+#include "h3735.h"
+#include "h1093.h"
+#include "h9267.h"
+#include "h305.h"
+#ifdef X
+#include "h8411.h"
+#endif
+struct S44 { int a; const char *s = "x//y"; };
+inline int f44_0(int x) { return x * 0; }
+inline int f44_1(int x) { return x * 1; }
+inline int f44_2(int x) { return x * 2; }
+inline int f44_3(int x) { return x * 3; }
+inline int f44_4(int x) { return x * 4; }
+inline int f44_5(int x) { return x * 5; }
+inline int f44_6(int x) { return x * 6; }
+inline int f44_7(int x) { return x * 7; }
+inline int f44_8(int x) { return x * 8; }
+inline int f44_9(int x) { return x * 9; }
+inline int f44_10(int x) { return x * 10; }
+inline int f44_11(int x) { return x * 11; }
+inline int f44_12(int x) { return x * 12; }
+inline int f44_13(int x) { return x * 13; }
+inline int f44_14(int x) { return x * 14; }
+inline int f44_15(int x) { return x * 15; }
+inline int f44_16(int x) { return x * 16; }
+inline int f44_17(int x) { return x * 17; }
+inline int f44_18(int x) { return x * 18; }
+inline int f44_19(int x) { return x * 19; }
+inline int f44_20(int x) { return x * 20; }
+inline int f44_21(int x) { return x * 21; }
+inline int f44_22(int x) { return x * 22; }
+inline int f44_23(int x) { return x * 23; }
+inline int f44_24(int x) { return x * 24; }
+inline int f44_25(int x) { return x * 25; }
+inline int f44_26(int x) { return x * 26; }
+inline int f44_27(int x) { return x * 27; }
+inline int f44_28(int x) { return x * 28; }
+inline int f44_29(int x) { return x * 29; }
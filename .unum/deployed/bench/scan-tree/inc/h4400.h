@@ -0,0 +1,42 @@
+#pragma once
+/* header 4400 */
+#include <vector>
+#include "h5569.h"
+#include "h8585.h"
+#include "h6166.h"
+#include "h975.h"
+#include "h6623.h"
+#ifdef X
+#include "h3968.h"
+#endif
+struct S4400 { int a; const char *s = "x//y"; };
+inline int f4400_0(int x) { return x * 0; }
+inline int f4400_1(int x) { return x * 1; }
+inline int f4400_2(int x) { return x * 2; }
+inline int f4400_3(int x) { return x * 3; }
+inline int f4400_4(int x) { return x * 4; }
+inline int f4400_5(int x) { return x * 5; }
+inline int f4400_6(int x) { return x * 6; }
+inline int f4400_7(int x) { return x * 7; }
+inline int f4400_8(int x) { return x * 8; }
+inline int f4400_9(int x) { return x * 9; }
+inline int f4400_10(int x) { return x * 10; }
+inline int f4400_11(int x) { return x * 11; }
+inline int f4400_12(int x) { return x * 12; }
+inline int f4400_13(int x) { return x * 13; }
+inline int f4400_14(int x) { return x * 14; }
+inline int f4400_15(int x) { return x * 15; }
+inline int f4400_16(int x) { return x * 16; }
+inline int f4400_17(int x) { return x * 17; }
+inline int f4400_18(int x) { return x * 18; }
+inline int f4400_19(int x) { return x * 19; }
+inline int f4400_20(int x) { return x * 20; }
+inline int f4400_21(int x) { return x * 21; }
+inline int f4400_22(int x) { return x * 22; }
+inline int f4400_23(int x) { return x * 23; }
+inline int f4400_24(int x) { return x * 24; }
+inline int f4400_25(int x) { return x * 25; }
+inline int f4400_26(int x) { return x * 26; }
+inline int f4400_27(int x) { return x * 27; }
+inline int f4400_28(int x) { return x * 28; }
+inline int f4400_29(int x) { return x * 29; }
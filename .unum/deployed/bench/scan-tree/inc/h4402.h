@@ -0,0 +1,42 @@
+#pragma once
+/* header 4402 */
+#include <vector>
+#include "h6355.h"
+#include "h5171.h"
+#include "h4792.h"
+#include "h9510.h"
+#include "h7897.h"
+#ifdef X
+#include "h1684.h"
+#endif
+struct S4402 { int a; const char *s = "x//y"; };
+inline int f4402_0(int x) { return x * 0; }
+inline int f4402_1(int x) { return x * 1; }
+inline int f4402_2(int x) { return x * 2; }
+inline int f4402_3(int x) { return x * 3; }
+inline int f4402_4(int x) { return x * 4; }
+inline int f4402_5(int x) { return x * 5; }
+inline int f4402_6(int x) { return x * 6; }
+inline int f4402_7(int x) { return x * 7; }
+inline int f4402_8(int x) { return x * 8; }
+inline int f4402_9(int x) { return x * 9; }
+inline int f4402_10(int x) { return x * 10; }
+inline int f4402_11(int x) { return x * 11; }
+inline int f4402_12(int x) { return x * 12; }
+inline int f4402_13(int x) { return x * 13; }
+inline int f4402_14(int x) { return x * 14; }
+inline int f4402_15(int x) { return x * 15; }
+inline int f4402_16(int x) { return x * 16; }
+inline int f4402_17(int x) { return x * 17; }
+inline int f4402_18(int x) { return x * 18; }
+inline int f4402_19(int x) { return x * 19; }
+inline int f4402_20(int x) { return x * 20; }
+inline int f4402_21(int x) { return x * 21; }
+inline int f4402_22(int x) { return x * 22; }
+inline int f4402_23(int x) { return x * 23; }
+inline int f4402_24(int x) { return x * 24; }
+inline int f4402_25(int x) { return x * 25; }
+inline int f4402_26(int x) { return x * 26; }
+inline int f4402_27(int x) { return x * 27; }
+inline int f4402_28(int x) { return x * 28; }
+inline int f4402_29(int x) { return x * 29; }
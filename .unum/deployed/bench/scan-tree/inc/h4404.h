@@ -0,0 +1,42 @@
+#pragma once
+/* header 4404 */
+#include <vector>
+#include "h7473.h"
+#include "h7998.h"
+#include "h7738.h"
+#include "h9603.h"
+#include "h308.h"
+#ifdef X
+#include "h5943.h"
+#endif
+struct S4404 { int a; const char *s = "x//y"; };
+inline int f4404_0(int x) { return x * 0; }
+inline int f4404_1(int x) { return x * 1; }
+inline int f4404_2(int x) { return x * 2; }
+inline int f4404_3(int x) { return x * 3; }
+inline int f4404_4(int x) { return x * 4; }
+inline int f4404_5(int x) { return x * 5; }
+inline int f4404_6(int x) { return x * 6; }
+inline int f4404_7(int x) { return x * 7; }
+inline int f4404_8(int x) { return x * 8; }
+inline int f4404_9(int x) { return x * 9; }
+inline int f4404_10(int x) { return x * 10; }
+inline int f4404_11(int x) { return x * 11; }
+inline int f4404_12(int x) { return x * 12; }
+inline int f4404_13(int x) { return x * 13; }
+inline int f4404_14(int x) { return x * 14; }
+inline int f4404_15(int x) { return x * 15; }
+inline int f4404_16(int x) { return x * 16; }
+inline int f4404_17(int x) { return x * 17; }
+inline int f4404_18(int x) { return x * 18; }
+inline int f4404_19(int x) { return x * 19; }
+inline int f4404_20(int x) { return x * 20; }
+inline int f4404_21(int x) { return x * 21; }
+inline int f4404_22(int x) { return x * 22; }
+inline int f4404_23(int x) { return x * 23; }
+inline int f4404_24(int x) { return x * 24; }
+inline int f4404_25(int x) { return x * 25; }
+inline int f4404_26(int x) { return x * 26; }
+inline int f4404_27(int x) { return x * 27; }
+inline int f4404_28(int x) { return x * 28; }
+inline int f4404_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4405 */
+#include <vector>
+#include "h4124.h"
+#include "h5875.h"
+#include "h4232.h"
+#include "h1041.h"
+#include "h438.h"
+#ifdef X
+#include "h7325.h"
+#endif
+struct S4405 { int a; const char *s = "x//y"; };
+inline int f4405_0(int x) { return x * 0; }
+inline int f4405_1(int x) { return x * 1; }
+inline int f4405_2(int x) { return x * 2; }
+inline int f4405_3(int x) { return x * 3; }
+inline int f4405_4(int x) { return x * 4; }
+inline int f4405_5(int x) { return x * 5; }
+inline int f4405_6(int x) { return x * 6; }
+inline int f4405_7(int x) { return x * 7; }
+inline int f4405_8(int x) { return x * 8; }
+inline int f4405_9(int x) { return x * 9; }
+inline int f4405_10(int x) { return x * 10; }
+inline int f4405_11(int x) { return x * 11; }
+inline int f4405_12(int x) { return x * 12; }
+inline int f4405_13(int x) { return x * 13; }
+inline int f4405_14(int x) { return x * 14; }
+inline int f4405_15(int x) { return x * 15; }
+inline int f4405_16(int x) { return x * 16; }
+inline int f4405_17(int x) { return x * 17; }
+inline int f4405_18(int x) { return x * 18; }
+inline int f4405_19(int x) { return x * 19; }
+inline int f4405_20(int x) { return x * 20; }
+inline int f4405_21(int x) { return x * 21; }
+inline int f4405_22(int x) { return x * 22; }
+inline int f4405_23(int x) { return x * 23; }
+inline int f4405_24(int x) { return x * 24; }
+inline int f4405_25(int x) { return x * 25; }
+inline int f4405_26(int x) { return x * 26; }
+inline int f4405_27(int x) { return x * 27; }
+inline int f4405_28(int x) { return x * 28; }
+inline int f4405_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4408 */
+#include <vector>
+#include "h2327.h"
+#include "h6722.h"
+#include "h4768.h"
+#include "h5508.h"
+#include "h914.h"
+#ifdef X
+#include "h4641.h"
+#endif
+struct S4408 { int a; const char *s = "x//y"; };
+inline int f4408_0(int x) { return x * 0; }
+inline int f4408_1(int x) { return x * 1; }
+inline int f4408_2(int x) { return x * 2; }
+inline int f4408_3(int x) { return x * 3; }
+inline int f4408_4(int x) { return x * 4; }
+inline int f4408_5(int x) { return x * 5; }
+inline int f4408_6(int x) { return x * 6; }
+inline int f4408_7(int x) { return x * 7; }
+inline int f4408_8(int x) { return x * 8; }
+inline int f4408_9(int x) { return x * 9; }
+inline int f4408_10(int x) { return x * 10; }
+inline int f4408_11(int x) { return x * 11; }
+inline int f4408_12(int x) { return x * 12; }
+inline int f4408_13(int x) { return x * 13; }
+inline int f4408_14(int x) { return x * 14; }
+inline int f4408_15(int x) { return x * 15; }
+inline int f4408_16(int x) { return x * 16; }
+inline int f4408_17(int x) { return x * 17; }
+inline int f4408_18(int x) { return x * 18; }
+inline int f4408_19(int x) { return x * 19; }
+inline int f4408_20(int x) { return x * 20; }
+inline int f4408_21(int x) { return x * 21; }
+inline int f4408_22(int x) { return x * 22; }
+inline int f4408_23(int x) { return x * 23; }
+inline int f4408_24(int x) { return x * 24; }
+inline int f4408_25(int x) { return x * 25; }
+inline int f4408_26(int x) { return x * 26; }
+inline int f4408_27(int x) { return x * 27; }
+inline int f4408_28(int x) { return x * 28; }
+inline int f4408_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4409 */
+#include <vector>
+#include "h1138.h"
+#include "h1290.h"
+#include "h9201.h"
+#include "h6332.h"
+#include "h9446.h"
+#ifdef X
+#include "h5233.h"
+#endif
+struct S4409 { int a; const char *s = "x//y"; };
+inline int f4409_0(int x) { return x * 0; }
+inline int f4409_1(int x) { return x * 1; }
+inline int f4409_2(int x) { return x * 2; }
+inline int f4409_3(int x) { return x * 3; }
+inline int f4409_4(int x) { return x * 4; }
+inline int f4409_5(int x) { return x * 5; }
+inline int f4409_6(int x) { return x * 6; }
+inline int f4409_7(int x) { return x * 7; }
+inline int f4409_8(int x) { return x * 8; }
+inline int f4409_9(int x) { return x * 9; }
+inline int f4409_10(int x) { return x * 10; }
+inline int f4409_11(int x) { return x * 11; }
+inline int f4409_12(int x) { return x * 12; }
+inline int f4409_13(int x) { return x * 13; }
+inline int f4409_14(int x) { return x * 14; }
+inline int f4409_15(int x) { return x * 15; }
+inline int f4409_16(int x) { return x * 16; }
+inline int f4409_17(int x) { return x * 17; }
+inline int f4409_18(int x) { return x * 18; }
+inline int f4409_19(int x) { return x * 19; }
+inline int f4409_20(int x) { return x * 20; }
+inline int f4409_21(int x) { return x * 21; }
+inline int f4409_22(int x) { return x * 22; }
+inline int f4409_23(int x) { return x * 23; }
+inline int f4409_24(int x) { return x * 24; }
+inline int f4409_25(int x) { return x * 25; }
+inline int f4409_26(int x) { return x * 26; }
+inline int f4409_27(int x) { return x * 27; }
+inline int f4409_28(int x) { return x * 28; }
+inline int f4409_29(int x) { return x * 29; }
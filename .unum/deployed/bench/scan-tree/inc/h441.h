@@ -0,0 +1,42 @@
+#pragma once
+/* header 441 */
+#include <vector>
+#include "h410.h"
+#include "h7693.h"
+#include "h4238.h"
+#include "h9009.h"
+#include "h5488.h"
+#ifdef X
+#include "h1772.h"
+#endif
+struct S441 { int a; const char *s = "x//y"; };
+inline int f441_0(int x) { return x * 0; }
+inline int f441_1(int x) { return x * 1; }
+inline int f441_2(int x) { return x * 2; }
+inline int f441_3(int x) { return x * 3; }
+inline int f441_4(int x) { return x * 4; }
+inline int f441_5(int x) { return x * 5; }
+inline int f441_6(int x) { return x * 6; }
+inline int f441_7(int x) { return x * 7; }
+inline int f441_8(int x) { return x * 8; }
+inline int f441_9(int x) { return x * 9; }
+inline int f441_10(int x) { return x * 10; }
+inline int f441_11(int x) { return x * 11; }
+inline int f441_12(int x) { return x * 12; }
+inline int f441_13(int x) { return x * 13; }
+inline int f441_14(int x) { return x * 14; }
+inline int f441_15(int x) { return x * 15; }
+inline int f441_16(int x) { return x * 16; }
+inline int f441_17(int x) { return x * 17; }
+inline int f441_18(int x) { return x * 18; }
+inline int f441_19(int x) { return x * 19; }
+inline int f441_20(int x) { return x * 20; }
+inline int f441_21(int x) { return x * 21; }
+inline int f441_22(int x) { return x * 22; }
+inline int f441_23(int x) { return x * 23; }
+inline int f441_24(int x) { return x * 24; }
+inline int f441_25(int x) { return x * 25; }
+inline int f441_26(int x) { return x * 26; }
+inline int f441_27(int x) { return x * 27; }
+inline int f441_28(int x) { return x * 28; }
+inline int f441_29(int x) { return x * 29; }
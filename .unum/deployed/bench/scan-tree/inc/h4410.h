@@ -0,0 +1,42 @@
+#pragma once
+/* header 4410 */
+#include <vector>
+#include "h7663.h"
+#include "h1440.h"
+#include "h3125.h"
+#include "h2883.h"
+#include "h918.h"
+#ifdef X
+#include "h1652.h"
+#endif
+struct S4410 { int a; const char *s = "x//y"; };
+inline int f4410_0(int x) { return x * 0; }
+inline int f4410_1(int x) { return x * 1; }
+inline int f4410_2(int x) { return x * 2; }
+inline int f4410_3(int x) { return x * 3; }
+inline int f4410_4(int x) { return x * 4; }
+inline int f4410_5(int x) { return x * 5; }
+inline int f4410_6(int x) { return x * 6; }
+inline int f4410_7(int x) { return x * 7; }
+inline int f4410_8(int x) { return x * 8; }
+inline int f4410_9(int x) { return x * 9; }
+inline int f4410_10(int x) { return x * 10; }
+inline int f4410_11(int x) { return x * 11; }
+inline int f4410_12(int x) { return x * 12; }
+inline int f4410_13(int x) { return x * 13; }
+inline int f4410_14(int x) { return x * 14; }
+inline int f4410_15(int x) { return x * 15; }
+inline int f4410_16(int x) { return x * 16; }
+inline int f4410_17(int x) { return x * 17; }
+inline int f4410_18(int x) { return x * 18; }
+inline int f4410_19(int x) { return x * 19; }
+inline int f4410_20(int x) { return x * 20; }
+inline int f4410_21(int x) { return x * 21; }
+inline int f4410_22(int x) { return x * 22; }
+inline int f4410_23(int x) { return x * 23; }
+inline int f4410_24(int x) { return x * 24; }
+inline int f4410_25(int x) { return x * 25; }
+inline int f4410_26(int x) { return x * 26; }
+inline int f4410_27(int x) { return x * 27; }
+inline int f4410_28(int x) { return x * 28; }
+inline int f4410_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4411 */
+#include <vector>
+#include "h9582.h"
+#include "h5240.h"
+#include "h3598.h"
+#include "h1327.h"
+#include "h3169.h"
+#ifdef X
+#include "h7555.h"
+#endif
+struct S4411 { int a; const char *s = "x//y"; };
+inline int f4411_0(int x) { return x * 0; }
+inline int f4411_1(int x) { return x * 1; }
+inline int f4411_2(int x) { return x * 2; }
+inline int f4411_3(int x) { return x * 3; }
+inline int f4411_4(int x) { return x * 4; }
+inline int f4411_5(int x) { return x * 5; }
+inline int f4411_6(int x) { return x * 6; }
+inline int f4411_7(int x) { return x * 7; }
+inline int f4411_8(int x) { return x * 8; }
+inline int f4411_9(int x) { return x * 9; }
+inline int f4411_10(int x) { return x * 10; }
+inline int f4411_11(int x) { return x * 11; }
+inline int f4411_12(int x) { return x * 12; }
+inline int f4411_13(int x) { return x * 13; }
+inline int f4411_14(int x) { return x * 14; }
+inline int f4411_15(int x) { return x * 15; }
+inline int f4411_16(int x) { return x * 16; }
+inline int f4411_17(int x) { return x * 17; }
+inline int f4411_18(int x) { return x * 18; }
+inline int f4411_19(int x) { return x * 19; }
+inline int f4411_20(int x) { return x * 20; }
+inline int f4411_21(int x) { return x * 21; }
+inline int f4411_22(int x) { return x * 22; }
+inline int f4411_23(int x) { return x * 23; }
+inline int f4411_24(int x) { return x * 24; }
+inline int f4411_25(int x) { return x * 25; }
+inline int f4411_26(int x) { return x * 26; }
+inline int f4411_27(int x) { return x * 27; }
+inline int f4411_28(int x) { return x * 28; }
+inline int f4411_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4413 */
+#include <vector>
+#include "h7411.h"
+#include "h5359.h"
+#include "h7313.h"
+#include "h5203.h"
+#include "h2866.h"
+#ifdef X
+#include "h5788.h"
+#endif
+struct S4413 { int a; const char *s = "x//y"; };
+inline int f4413_0(int x) { return x * 0; }
+inline int f4413_1(int x) { return x * 1; }
+inline int f4413_2(int x) { return x * 2; }
+inline int f4413_3(int x) { return x * 3; }
+inline int f4413_4(int x) { return x * 4; }
+inline int f4413_5(int x) { return x * 5; }
+inline int f4413_6(int x) { return x * 6; }
+inline int f4413_7(int x) { return x * 7; }
+inline int f4413_8(int x) { return x * 8; }
+inline int f4413_9(int x) { return x * 9; }
+inline int f4413_10(int x) { return x * 10; }
+inline int f4413_11(int x) { return x * 11; }
+inline int f4413_12(int x) { return x * 12; }
+inline int f4413_13(int x) { return x * 13; }
+inline int f4413_14(int x) { return x * 14; }
+inline int f4413_15(int x) { return x * 15; }
+inline int f4413_16(int x) { return x * 16; }
+inline int f4413_17(int x) { return x * 17; }
+inline int f4413_18(int x) { return x * 18; }
+inline int f4413_19(int x) { return x * 19; }
+inline int f4413_20(int x) { return x * 20; }
+inline int f4413_21(int x) { return x * 21; }
+inline int f4413_22(int x) { return x * 22; }
+inline int f4413_23(int x) { return x * 23; }
+inline int f4413_24(int x) { return x * 24; }
+inline int f4413_25(int x) { return x * 25; }
+inline int f4413_26(int x) { return x * 26; }
+inline int f4413_27(int x) { return x * 27; }
+inline int f4413_28(int x) { return x * 28; }
+inline int f4413_29(int x) { return x * 29; }
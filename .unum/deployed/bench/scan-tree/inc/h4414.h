@@ -0,0 +1,42 @@
+#pragma once
+/* header 4414 */
+#include <vector>
+#include "h8658.h"
+#include "h7867.h"
+#include "h1479.h"
+#include "h9792.h"
+#include "h2550.h"
+#ifdef X
+#include "h6888.h"
+#endif
+struct S4414 { int a; const char *s = "x//y"; };
+inline int f4414_0(int x) { return x * 0; }
+inline int f4414_1(int x) { return x * 1; }
+inline int f4414_2(int x) { return x * 2; }
+inline int f4414_3(int x) { return x * 3; }
+inline int f4414_4(int x) { return x * 4; }
+inline int f4414_5(int x) { return x * 5; }
+inline int f4414_6(int x) { return x * 6; }
+inline int f4414_7(int x) { return x * 7; }
+inline int f4414_8(int x) { return x * 8; }
+inline int f4414_9(int x) { return x * 9; }
+inline int f4414_10(int x) { return x * 10; }
+inline int f4414_11(int x) { return x * 11; }
+inline int f4414_12(int x) { return x * 12; }
+inline int f4414_13(int x) { return x * 13; }
+inline int f4414_14(int x) { return x * 14; }
+inline int f4414_15(int x) { return x * 15; }
+inline int f4414_16(int x) { return x * 16; }
+inline int f4414_17(int x) { return x * 17; }
+inline int f4414_18(int x) { return x * 18; }
+inline int f4414_19(int x) { return x * 19; }
+inline int f4414_20(int x) { return x * 20; }
+inline int f4414_21(int x) { return x * 21; }
+inline int f4414_22(int x) { return x * 22; }
+inline int f4414_23(int x) { return x * 23; }
+inline int f4414_24(int x) { return x * 24; }
+inline int f4414_25(int x) { return x * 25; }
+inline int f4414_26(int x) { return x * 26; }
+inline int f4414_27(int x) { return x * 27; }
+inline int f4414_28(int x) { return x * 28; }
+inline int f4414_29(int x) { return x * 29; }
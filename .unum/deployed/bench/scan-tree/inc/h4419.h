@@ -0,0 +1,42 @@
+#pragma once
+/* header 4419 */
+#include <vector>
+#include "h9408.h"
+#include "h4639.h"
+#include "h1016.h"
+#include "h6768.h"
+#include "h1693.h"
+#ifdef X
+#include "h3158.h"
+#endif
+struct S4419 { int a; const char *s = "x//y"; };
+inline int f4419_0(int x) { return x * 0; }
+inline int f4419_1(int x) { return x * 1; }
+inline int f4419_2(int x) { return x * 2; }
+inline int f4419_3(int x) { return x * 3; }
+inline int f4419_4(int x) { return x * 4; }
+inline int f4419_5(int x) { return x * 5; }
+inline int f4419_6(int x) { return x * 6; }
+inline int f4419_7(int x) { return x * 7; }
+inline int f4419_8(int x) { return x * 8; }
+inline int f4419_9(int x) { return x * 9; }
+inline int f4419_10(int x) { return x * 10; }
+inline int f4419_11(int x) { return x * 11; }
+inline int f4419_12(int x) { return x * 12; }
+inline int f4419_13(int x) { return x * 13; }
+inline int f4419_14(int x) { return x * 14; }
+inline int f4419_15(int x) { return x * 15; }
+inline int f4419_16(int x) { return x * 16; }
+inline int f4419_17(int x) { return x * 17; }
+inline int f4419_18(int x) { return x * 18; }
+inline int f4419_19(int x) { return x * 19; }
+inline int f4419_20(int x) { return x * 20; }
+inline int f4419_21(int x) { return x * 21; }
+inline int f4419_22(int x) { return x * 22; }
+inline int f4419_23(int x) { return x * 23; }
+inline int f4419_24(int x) { return x * 24; }
+inline int f4419_25(int x) { return x * 25; }
+inline int f4419_26(int x) { return x * 26; }
+inline int f4419_27(int x) { return x * 27; }
+inline int f4419_28(int x) { return x * 28; }
+inline int f4419_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 442 */
+#include <vector>
+#include "h2633.h"
+#include "h9299.h"
+#include "h2147.h"
+#include "h7438.h"
+#include "h9366.h"
+#ifdef X
+#include "h4928.h"
+#endif
+struct S442 { int a; const char *s = "x//y"; };
+inline int f442_0(int x) { return x * 0; }
+inline int f442_1(int x) { return x * 1; }
+inline int f442_2(int x) { return x * 2; }
+inline int f442_3(int x) { return x * 3; }
+inline int f442_4(int x) { return x * 4; }
+inline int f442_5(int x) { return x * 5; }
+inline int f442_6(int x) { return x * 6; }
+inline int f442_7(int x) { return x * 7; }
+inline int f442_8(int x) { return x * 8; }
+inline int f442_9(int x) { return x * 9; }
+inline int f442_10(int x) { return x * 10; }
+inline int f442_11(int x) { return x * 11; }
+inline int f442_12(int x) { return x * 12; }
+inline int f442_13(int x) { return x * 13; }
+inline int f442_14(int x) { return x * 14; }
+inline int f442_15(int x) { return x * 15; }
+inline int f442_16(int x) { return x * 16; }
+inline int f442_17(int x) { return x * 17; }
+inline int f442_18(int x) { return x * 18; }
+inline int f442_19(int x) { return x * 19; }
+inline int f442_20(int x) { return x * 20; }
+inline int f442_21(int x) { return x * 21; }
+inline int f442_22(int x) { return x * 22; }
+inline int f442_23(int x) { return x * 23; }
+inline int f442_24(int x) { return x * 24; }
+inline int f442_25(int x) { return x * 25; }
+inline int f442_26(int x) { return x * 26; }
+inline int f442_27(int x) { return x * 27; }
+inline int f442_28(int x) { return x * 28; }
+inline int f442_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4421 */
+#include <vector>
+#include "h9841.h"
+#include "h5615.h"
+#include "h9632.h"
+#include "h4830.h"
+#include "h2059.h"
+#ifdef X
+#include "h8177.h"
+#endif
+struct S4421 { int a; const char *s = "x//y"; };
+inline int f4421_0(int x) { return x * 0; }
+inline int f4421_1(int x) { return x * 1; }
+inline int f4421_2(int x) { return x * 2; }
+inline int f4421_3(int x) { return x * 3; }
+inline int f4421_4(int x) { return x * 4; }
+inline int f4421_5(int x) { return x * 5; }
+inline int f4421_6(int x) { return x * 6; }
+inline int f4421_7(int x) { return x * 7; }
+inline int f4421_8(int x) { return x * 8; }
+inline int f4421_9(int x) { return x * 9; }
+inline int f4421_10(int x) { return x * 10; }
+inline int f4421_11(int x) { return x * 11; }
+inline int f4421_12(int x) { return x * 12; }
+inline int f4421_13(int x) { return x * 13; }
+inline int f4421_14(int x) { return x * 14; }
+inline int f4421_15(int x) { return x * 15; }
+inline int f4421_16(int x) { return x * 16; }
+inline int f4421_17(int x) { return x * 17; }
+inline int f4421_18(int x) { return x * 18; }
+inline int f4421_19(int x) { return x * 19; }
+inline int f4421_20(int x) { return x * 20; }
+inline int f4421_21(int x) { return x * 21; }
+inline int f4421_22(int x) { return x * 22; }
+inline int f4421_23(int x) { return x * 23; }
+inline int f4421_24(int x) { return x * 24; }
+inline int f4421_25(int x) { return x * 25; }
+inline int f4421_26(int x) { return x * 26; }
+inline int f4421_27(int x) { return x * 27; }
+inline int f4421_28(int x) { return x * 28; }
+inline int f4421_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4422 */
+#include <vector>
+#include "h69.h"
+#include "h4863.h"
+#include "h8234.h"
+#include "h3813.h"
+#include "h7804.h"
+#ifdef X
+#include "h7708.h"
+#endif
+struct S4422 { int a; const char *s = "x//y"; };
+inline int f4422_0(int x) { return x * 0; }
+inline int f4422_1(int x) { return x * 1; }
+inline int f4422_2(int x) { return x * 2; }
+inline int f4422_3(int x) { return x * 3; }
+inline int f4422_4(int x) { return x * 4; }
+inline int f4422_5(int x) { return x * 5; }
+inline int f4422_6(int x) { return x * 6; }
+inline int f4422_7(int x) { return x * 7; }
+inline int f4422_8(int x) { return x * 8; }
+inline int f4422_9(int x) { return x * 9; }
+inline int f4422_10(int x) { return x * 10; }
+inline int f4422_11(int x) { return x * 11; }
+inline int f4422_12(int x) { return x * 12; }
+inline int f4422_13(int x) { return x * 13; }
+inline int f4422_14(int x) { return x * 14; }
+inline int f4422_15(int x) { return x * 15; }
+inline int f4422_16(int x) { return x * 16; }
+inline int f4422_17(int x) { return x * 17; }
+inline int f4422_18(int x) { return x * 18; }
+inline int f4422_19(int x) { return x * 19; }
+inline int f4422_20(int x) { return x * 20; }
+inline int f4422_21(int x) { return x * 21; }
+inline int f4422_22(int x) { return x * 22; }
+inline int f4422_23(int x) { return x * 23; }
+inline int f4422_24(int x) { return x * 24; }
+inline int f4422_25(int x) { return x * 25; }
+inline int f4422_26(int x) { return x * 26; }
+inline int f4422_27(int x) { return x * 27; }
+inline int f4422_28(int x) { return x * 28; }
+inline int f4422_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4423 */
+#include <vector>
+#include "h1647.h"
+#include "h550.h"
+#include "h5843.h"
+#include "h1164.h"
+#include "h1932.h"
+#ifdef X
+#include "h1447.h"
+#endif
+struct S4423 { int a; const char *s = "x//y"; };
+inline int f4423_0(int x) { return x * 0; }
+inline int f4423_1(int x) { return x * 1; }
+inline int f4423_2(int x) { return x * 2; }
+inline int f4423_3(int x) { return x * 3; }
+inline int f4423_4(int x) { return x * 4; }
+inline int f4423_5(int x) { return x * 5; }
+inline int f4423_6(int x) { return x * 6; }
+inline int f4423_7(int x) { return x * 7; }
+inline int f4423_8(int x) { return x * 8; }
+inline int f4423_9(int x) { return x * 9; }
+inline int f4423_10(int x) { return x * 10; }
+inline int f4423_11(int x) { return x * 11; }
+inline int f4423_12(int x) { return x * 12; }
+inline int f4423_13(int x) { return x * 13; }
+inline int f4423_14(int x) { return x * 14; }
+inline int f4423_15(int x) { return x * 15; }
+inline int f4423_16(int x) { return x * 16; }
+inline int f4423_17(int x) { return x * 17; }
+inline int f4423_18(int x) { return x * 18; }
+inline int f4423_19(int x) { return x * 19; }
+inline int f4423_20(int x) { return x * 20; }
+inline int f4423_21(int x) { return x * 21; }
+inline int f4423_22(int x) { return x * 22; }
+inline int f4423_23(int x) { return x * 23; }
+inline int f4423_24(int x) { return x * 24; }
+inline int f4423_25(int x) { return x * 25; }
+inline int f4423_26(int x) { return x * 26; }
+inline int f4423_27(int x) { return x * 27; }
+inline int f4423_28(int x) { return x * 28; }
+inline int f4423_29(int x) { return x * 29; }
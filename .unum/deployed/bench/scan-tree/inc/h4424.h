@@ -0,0 +1,42 @@
+#pragma once
+/* header 4424 */
+#include <vector>
+#include "h3563.h"
+#include "h3952.h"
+#include "h967.h"
+#include "h355.h"
+#include "h7362.h"
+#ifdef X
+#include "h5880.h"
+#endif
+struct S4424 { int a; const char *s = "x//y"; };
+inline int f4424_0(int x) { return x * 0; }
+inline int f4424_1(int x) { return x * 1; }
+inline int f4424_2(int x) { return x * 2; }
+inline int f4424_3(int x) { return x * 3; }
+inline int f4424_4(int x) { return x * 4; }
+inline int f4424_5(int x) { return x * 5; }
+inline int f4424_6(int x) { return x * 6; }
+inline int f4424_7(int x) { return x * 7; }
+inline int f4424_8(int x) { return x * 8; }
+inline int f4424_9(int x) { return x * 9; }
+inline int f4424_10(int x) { return x * 10; }
+inline int f4424_11(int x) { return x * 11; }
+inline int f4424_12(int x) { return x * 12; }
+inline int f4424_13(int x) { return x * 13; }
+inline int f4424_14(int x) { return x * 14; }
+inline int f4424_15(int x) { return x * 15; }
+inline int f4424_16(int x) { return x * 16; }
+inline int f4424_17(int x) { return x * 17; }
+inline int f4424_18(int x) { return x * 18; }
+inline int f4424_19(int x) { return x * 19; }
+inline int f4424_20(int x) { return x * 20; }
+inline int f4424_21(int x) { return x * 21; }
+inline int f4424_22(int x) { return x * 22; }
+inline int f4424_23(int x) { return x * 23; }
+inline int f4424_24(int x) { return x * 24; }
+inline int f4424_25(int x) { return x * 25; }
+inline int f4424_26(int x) { return x * 26; }
+inline int f4424_27(int x) { return x * 27; }
+inline int f4424_28(int x) { return x * 28; }
+inline int f4424_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4431 */
+#include <vector>
+#include "h5289.h"
+#include "h3821.h"
+#include "h4430.h"
+#include "h8241.h"
+#include "h2844.h"
+#ifdef X
+#include "h3041.h"
+#endif
+struct S4431 { int a; const char *s = "x//y"; };
+inline int f4431_0(int x) { return x * 0; }
+inline int f4431_1(int x) { return x * 1; }
+inline int f4431_2(int x) { return x * 2; }
+inline int f4431_3(int x) { return x * 3; }
+inline int f4431_4(int x) { return x * 4; }
+inline int f4431_5(int x) { return x * 5; }
+inline int f4431_6(int x) { return x * 6; }
+inline int f4431_7(int x) { return x * 7; }
+inline int f4431_8(int x) { return x * 8; }
+inline int f4431_9(int x) { return x * 9; }
+inline int f4431_10(int x) { return x * 10; }
+inline int f4431_11(int x) { return x * 11; }
+inline int f4431_12(int x) { return x * 12; }
+inline int f4431_13(int x) { return x * 13; }
+inline int f4431_14(int x) { return x * 14; }
+inline int f4431_15(int x) { return x * 15; }
+inline int f4431_16(int x) { return x * 16; }
+inline int f4431_17(int x) { return x * 17; }
+inline int f4431_18(int x) { return x * 18; }
+inline int f4431_19(int x) { return x * 19; }
+inline int f4431_20(int x) { return x * 20; }
+inline int f4431_21(int x) { return x * 21; }
+inline int f4431_22(int x) { return x * 22; }
+inline int f4431_23(int x) { return x * 23; }
+inline int f4431_24(int x) { return x * 24; }
+inline int f4431_25(int x) { return x * 25; }
+inline int f4431_26(int x) { return x * 26; }
+inline int f4431_27(int x) { return x * 27; }
+inline int f4431_28(int x) { return x * 28; }
+inline int f4431_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4432 */
+#include <vector>
+#include "h2353.h"
+#include "h4977.h"
+#include "h730.h"
+#include "h6073.h"
+#include "h6439.h"
+#ifdef X
+#include "h7347.h"
+#endif
+struct S4432 { int a; const char *s = "x//y"; };
+inline int f4432_0(int x) { return x * 0; }
+inline int f4432_1(int x) { return x * 1; }
+inline int f4432_2(int x) { return x * 2; }
+inline int f4432_3(int x) { return x * 3; }
+inline int f4432_4(int x) { return x * 4; }
+inline int f4432_5(int x) { return x * 5; }
+inline int f4432_6(int x) { return x * 6; }
+inline int f4432_7(int x) { return x * 7; }
+inline int f4432_8(int x) { return x * 8; }
+inline int f4432_9(int x) { return x * 9; }
+inline int f4432_10(int x) { return x * 10; }
+inline int f4432_11(int x) { return x * 11; }
+inline int f4432_12(int x) { return x * 12; }
+inline int f4432_13(int x) { return x * 13; }
+inline int f4432_14(int x) { return x * 14; }
+inline int f4432_15(int x) { return x * 15; }
+inline int f4432_16(int x) { return x * 16; }
+inline int f4432_17(int x) { return x * 17; }
+inline int f4432_18(int x) { return x * 18; }
+inline int f4432_19(int x) { return x * 19; }
+inline int f4432_20(int x) { return x * 20; }
+inline int f4432_21(int x) { return x * 21; }
+inline int f4432_22(int x) { return x * 22; }
+inline int f4432_23(int x) { return x * 23; }
+inline int f4432_24(int x) { return x * 24; }
+inline int f4432_25(int x) { return x * 25; }
+inline int f4432_26(int x) { return x * 26; }
+inline int f4432_27(int x) { return x * 27; }
+inline int f4432_28(int x) { return x * 28; }
+inline int f4432_29(int x) { return x * 29; }
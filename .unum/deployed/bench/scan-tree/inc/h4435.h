@@ -0,0 +1,42 @@
+#pragma once
+/* header 4435 */
+#include <vector>
+#include "h9820.h"
+#include "h6818.h"
+#include "h7118.h"
+#include "h3072.h"
+#include "h5489.h"
+#ifdef X
+#include "h619.h"
+#endif
+struct S4435 { int a; const char *s = "x//y"; };
+inline int f4435_0(int x) { return x * 0; }
+inline int f4435_1(int x) { return x * 1; }
+inline int f4435_2(int x) { return x * 2; }
+inline int f4435_3(int x) { return x * 3; }
+inline int f4435_4(int x) { return x * 4; }
+inline int f4435_5(int x) { return x * 5; }
+inline int f4435_6(int x) { return x * 6; }
+inline int f4435_7(int x) { return x * 7; }
+inline int f4435_8(int x) { return x * 8; }
+inline int f4435_9(int x) { return x * 9; }
+inline int f4435_10(int x) { return x * 10; }
+inline int f4435_11(int x) { return x * 11; }
+inline int f4435_12(int x) { return x * 12; }
+inline int f4435_13(int x) { return x * 13; }
+inline int f4435_14(int x) { return x * 14; }
+inline int f4435_15(int x) { return x * 15; }
+inline int f4435_16(int x) { return x * 16; }
+inline int f4435_17(int x) { return x * 17; }
+inline int f4435_18(int x) { return x * 18; }
+inline int f4435_19(int x) { return x * 19; }
+inline int f4435_20(int x) { return x * 20; }
+inline int f4435_21(int x) { return x * 21; }
+inline int f4435_22(int x) { return x * 22; }
+inline int f4435_23(int x) { return x * 23; }
+inline int f4435_24(int x) { return x * 24; }
+inline int f4435_25(int x) { return x * 25; }
+inline int f4435_26(int x) { return x * 26; }
+inline int f4435_27(int x) { return x * 27; }
+inline int f4435_28(int x) { return x * 28; }
+inline int f4435_29(int x) { return x * 29; }
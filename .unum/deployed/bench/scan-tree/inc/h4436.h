@@ -0,0 +1,42 @@
+#pragma once
+/* header 4436 */
+#include <vector>
+#include "h128.h"
+#include "h6527.h"
+#include "h8750.h"
+#include "h8981.h"
+#include "h5898.h"
+#ifdef X
+#include "h2856.h"
+#endif
+struct S4436 { int a; const char *s = "x//y"; };
+inline int f4436_0(int x) { return x * 0; }
+inline int f4436_1(int x) { return x * 1; }
+inline int f4436_2(int x) { return x * 2; }
+inline int f4436_3(int x) { return x * 3; }
+inline int f4436_4(int x) { return x * 4; }
+inline int f4436_5(int x) { return x * 5; }
+inline int f4436_6(int x) { return x * 6; }
+inline int f4436_7(int x) { return x * 7; }
+inline int f4436_8(int x) { return x * 8; }
+inline int f4436_9(int x) { return x * 9; }
+inline int f4436_10(int x) { return x * 10; }
+inline int f4436_11(int x) { return x * 11; }
+inline int f4436_12(int x) { return x * 12; }
+inline int f4436_13(int x) { return x * 13; }
+inline int f4436_14(int x) { return x * 14; }
+inline int f4436_15(int x) { return x * 15; }
+inline int f4436_16(int x) { return x * 16; }
+inline int f4436_17(int x) { return x * 17; }
+inline int f4436_18(int x) { return x * 18; }
+inline int f4436_19(int x) { return x * 19; }
+inline int f4436_20(int x) { return x * 20; }
+inline int f4436_21(int x) { return x * 21; }
+inline int f4436_22(int x) { return x * 22; }
+inline int f4436_23(int x) { return x * 23; }
+inline int f4436_24(int x) { return x * 24; }
+inline int f4436_25(int x) { return x * 25; }
+inline int f4436_26(int x) { return x * 26; }
+inline int f4436_27(int x) { return x * 27; }
+inline int f4436_28(int x) { return x * 28; }
+inline int f4436_29(int x) { return x * 29; }
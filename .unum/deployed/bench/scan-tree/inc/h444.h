@@ -0,0 +1,42 @@
+#pragma once
+/* header 444 */
+#include <vector>
+#include "h7461.h"
+#include "h1464.h"
+#include "h1851.h"
+#include "h3247.h"
+#include "h3233.h"
+#ifdef X
+#include "h8804.h"
+#endif
+struct S444 { int a; const char *s = "x//y"; };
+inline int f444_0(int x) { return x * 0; }
+inline int f444_1(int x) { return x * 1; }
+inline int f444_2(int x) { return x * 2; }
+inline int f444_3(int x) { return x * 3; }
+inline int f444_4(int x) { return x * 4; }
+inline int f444_5(int x) { return x * 5; }
+inline int f444_6(int x) { return x * 6; }
+inline int f444_7(int x) { return x * 7; }
+inline int f444_8(int x) { return x * 8; }
+inline int f444_9(int x) { return x * 9; }
+inline int f444_10(int x) { return x * 10; }
+inline int f444_11(int x) { return x * 11; }
+inline int f444_12(int x) { return x * 12; }
+inline int f444_13(int x) { return x * 13; }
+inline int f444_14(int x) { return x * 14; }
+inline int f444_15(int x) { return x * 15; }
+inline int f444_16(int x) { return x * 16; }
+inline int f444_17(int x) { return x * 17; }
+inline int f444_18(int x) { return x * 18; }
+inline int f444_19(int x) { return x * 19; }
+inline int f444_20(int x) { return x * 20; }
+inline int f444_21(int x) { return x * 21; }
+inline int f444_22(int x) { return x * 22; }
+inline int f444_23(int x) { return x * 23; }
+inline int f444_24(int x) { return x * 24; }
+inline int f444_25(int x) { return x * 25; }
+inline int f444_26(int x) { return x * 26; }
+inline int f444_27(int x) { return x * 27; }
+inline int f444_28(int x) { return x * 28; }
+inline int f444_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4440 */
+#include <vector>
+#include "h152.h"
+#include "h3481.h"
+#include "h7959.h"
+#include "h8737.h"
+#include "h7492.h"
+#ifdef X
+#include "h5315.h"
+#endif
+struct S4440 { int a; const char *s = "x//y"; };
+inline int f4440_0(int x) { return x * 0; }
+inline int f4440_1(int x) { return x * 1; }
+inline int f4440_2(int x) { return x * 2; }
+inline int f4440_3(int x) { return x * 3; }
+inline int f4440_4(int x) { return x * 4; }
+inline int f4440_5(int x) { return x * 5; }
+inline int f4440_6(int x) { return x * 6; }
+inline int f4440_7(int x) { return x * 7; }
+inline int f4440_8(int x) { return x * 8; }
+inline int f4440_9(int x) { return x * 9; }
+inline int f4440_10(int x) { return x * 10; }
+inline int f4440_11(int x) { return x * 11; }
+inline int f4440_12(int x) { return x * 12; }
+inline int f4440_13(int x) { return x * 13; }
+inline int f4440_14(int x) { return x * 14; }
+inline int f4440_15(int x) { return x * 15; }
+inline int f4440_16(int x) { return x * 16; }
+inline int f4440_17(int x) { return x * 17; }
+inline int f4440_18(int x) { return x * 18; }
+inline int f4440_19(int x) { return x * 19; }
+inline int f4440_20(int x) { return x * 20; }
+inline int f4440_21(int x) { return x * 21; }
+inline int f4440_22(int x) { return x * 22; }
+inline int f4440_23(int x) { return x * 23; }
+inline int f4440_24(int x) { return x * 24; }
+inline int f4440_25(int x) { return x * 25; }
+inline int f4440_26(int x) { return x * 26; }
+inline int f4440_27(int x) { return x * 27; }
+inline int f4440_28(int x) { return x * 28; }
+inline int f4440_29(int x) { return x * 29; }
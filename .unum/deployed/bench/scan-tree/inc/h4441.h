@@ -0,0 +1,42 @@
+#pragma once
+/* header 4441 */
+#include <vector>
+#include "h9363.h"
+#include "h8748.h"
+#include "h5570.h"
+#include "h7726.h"
+#include "h8526.h"
+#ifdef X
+#include "h5967.h"
+#endif
+struct S4441 { int a; const char *s = "x//y"; };
+inline int f4441_0(int x) { return x * 0; }
+inline int f4441_1(int x) { return x * 1; }
+inline int f4441_2(int x) { return x * 2; }
+inline int f4441_3(int x) { return x * 3; }
+inline int f4441_4(int x) { return x * 4; }
+inline int f4441_5(int x) { return x * 5; }
+inline int f4441_6(int x) { return x * 6; }
+inline int f4441_7(int x) { return x * 7; }
+inline int f4441_8(int x) { return x * 8; }
+inline int f4441_9(int x) { return x * 9; }
+inline int f4441_10(int x) { return x * 10; }
+inline int f4441_11(int x) { return x * 11; }
+inline int f4441_12(int x) { return x * 12; }
+inline int f4441_13(int x) { return x * 13; }
+inline int f4441_14(int x) { return x * 14; }
+inline int f4441_15(int x) { return x * 15; }
+inline int f4441_16(int x) { return x * 16; }
+inline int f4441_17(int x) { return x * 17; }
+inline int f4441_18(int x) { return x * 18; }
+inline int f4441_19(int x) { return x * 19; }
+inline int f4441_20(int x) { return x * 20; }
+inline int f4441_21(int x) { return x * 21; }
+inline int f4441_22(int x) { return x * 22; }
+inline int f4441_23(int x) { return x * 23; }
+inline int f4441_24(int x) { return x * 24; }
+inline int f4441_25(int x) { return x * 25; }
+inline int f4441_26(int x) { return x * 26; }
+inline int f4441_27(int x) { return x * 27; }
+inline int f4441_28(int x) { return x * 28; }
+inline int f4441_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4443 */
+#include <vector>
+#include "h6851.h"
+#include "h8795.h"
+#include "h7139.h"
+#include "h8694.h"
+#include "h9561.h"
+#ifdef X
+#include "h8676.h"
+#endif
+struct S4443 { int a; const char *s = "x//y"; };
+inline int f4443_0(int x) { return x * 0; }
+inline int f4443_1(int x) { return x * 1; }
+inline int f4443_2(int x) { return x * 2; }
+inline int f4443_3(int x) { return x * 3; }
+inline int f4443_4(int x) { return x * 4; }
+inline int f4443_5(int x) { return x * 5; }
+inline int f4443_6(int x) { return x * 6; }
+inline int f4443_7(int x) { return x * 7; }
+inline int f4443_8(int x) { return x * 8; }
+inline int f4443_9(int x) { return x * 9; }
+inline int f4443_10(int x) { return x * 10; }
+inline int f4443_11(int x) { return x * 11; }
+inline int f4443_12(int x) { return x * 12; }
+inline int f4443_13(int x) { return x * 13; }
+inline int f4443_14(int x) { return x * 14; }
+inline int f4443_15(int x) { return x * 15; }
+inline int f4443_16(int x) { return x * 16; }
+inline int f4443_17(int x) { return x * 17; }
+inline int f4443_18(int x) { return x * 18; }
+inline int f4443_19(int x) { return x * 19; }
+inline int f4443_20(int x) { return x * 20; }
+inline int f4443_21(int x) { return x * 21; }
+inline int f4443_22(int x) { return x * 22; }
+inline int f4443_23(int x) { return x * 23; }
+inline int f4443_24(int x) { return x * 24; }
+inline int f4443_25(int x) { return x * 25; }
+inline int f4443_26(int x) { return x * 26; }
+inline int f4443_27(int x) { return x * 27; }
+inline int f4443_28(int x) { return x * 28; }
+inline int f4443_29(int x) { return x * 29; }
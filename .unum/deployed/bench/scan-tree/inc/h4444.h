@@ -0,0 +1,42 @@
+#pragma once
+/* header 4444 */
+#include <vector>
+#include "h2309.h"
+#include "h5520.h"
+#include "h2408.h"
+#include "h9494.h"
+#include "h2776.h"
+#ifdef X
+#include "h7079.h"
+#endif
+struct S4444 { int a; const char *s = "x//y"; };
+inline int f4444_0(int x) { return x * 0; }
+inline int f4444_1(int x) { return x * 1; }
+inline int f4444_2(int x) { return x * 2; }
+inline int f4444_3(int x) { return x * 3; }
+inline int f4444_4(int x) { return x * 4; }
+inline int f4444_5(int x) { return x * 5; }
+inline int f4444_6(int x) { return x * 6; }
+inline int f4444_7(int x) { return x * 7; }
+inline int f4444_8(int x) { return x * 8; }
+inline int f4444_9(int x) { return x * 9; }
+inline int f4444_10(int x) { return x * 10; }
+inline int f4444_11(int x) { return x * 11; }
+inline int f4444_12(int x) { return x * 12; }
+inline int f4444_13(int x) { return x * 13; }
+inline int f4444_14(int x) { return x * 14; }
+inline int f4444_15(int x) { return x * 15; }
+inline int f4444_16(int x) { return x * 16; }
+inline int f4444_17(int x) { return x * 17; }
+inline int f4444_18(int x) { return x * 18; }
+inline int f4444_19(int x) { return x * 19; }
+inline int f4444_20(int x) { return x * 20; }
+inline int f4444_21(int x) { return x * 21; }
+inline int f4444_22(int x) { return x * 22; }
+inline int f4444_23(int x) { return x * 23; }
+inline int f4444_24(int x) { return x * 24; }
+inline int f4444_25(int x) { return x * 25; }
+inline int f4444_26(int x) { return x * 26; }
+inline int f4444_27(int x) { return x * 27; }
+inline int f4444_28(int x) { return x * 28; }
+inline int f4444_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4446 */
+#include <vector>
+#include "h6272.h"
+#include "h2112.h"
+#include "h9733.h"
+#include "h8984.h"
+#include "h6566.h"
+#ifdef X
+#include "h2498.h"
+#endif
+struct S4446 { int a; const char *s = "x//y"; };
+inline int f4446_0(int x) { return x * 0; }
+inline int f4446_1(int x) { return x * 1; }
+inline int f4446_2(int x) { return x * 2; }
+inline int f4446_3(int x) { return x * 3; }
+inline int f4446_4(int x) { return x * 4; }
+inline int f4446_5(int x) { return x * 5; }
+inline int f4446_6(int x) { return x * 6; }
+inline int f4446_7(int x) { return x * 7; }
+inline int f4446_8(int x) { return x * 8; }
+inline int f4446_9(int x) { return x * 9; }
+inline int f4446_10(int x) { return x * 10; }
+inline int f4446_11(int x) { return x * 11; }
+inline int f4446_12(int x) { return x * 12; }
+inline int f4446_13(int x) { return x * 13; }
+inline int f4446_14(int x) { return x * 14; }
+inline int f4446_15(int x) { return x * 15; }
+inline int f4446_16(int x) { return x * 16; }
+inline int f4446_17(int x) { return x * 17; }
+inline int f4446_18(int x) { return x * 18; }
+inline int f4446_19(int x) { return x * 19; }
+inline int f4446_20(int x) { return x * 20; }
+inline int f4446_21(int x) { return x * 21; }
+inline int f4446_22(int x) { return x * 22; }
+inline int f4446_23(int x) { return x * 23; }
+inline int f4446_24(int x) { return x * 24; }
+inline int f4446_25(int x) { return x * 25; }
+inline int f4446_26(int x) { return x * 26; }
+inline int f4446_27(int x) { return x * 27; }
+inline int f4446_28(int x) { return x * 28; }
+inline int f4446_29(int x) { return x * 29; }
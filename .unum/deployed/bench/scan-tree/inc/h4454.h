@@ -0,0 +1,42 @@
+#pragma once
+/* header 4454 */
+#include <vector>
+#include "h7795.h"
+#include "h8385.h"
+#include "h2797.h"
+#include "h227.h"
+#include "h4748.h"
+#ifdef X
+#include "h3082.h"
+#endif
+struct S4454 { int a; const char *s = "x//y"; };
+inline int f4454_0(int x) { return x * 0; }
+inline int f4454_1(int x) { return x * 1; }
+inline int f4454_2(int x) { return x * 2; }
+inline int f4454_3(int x) { return x * 3; }
+inline int f4454_4(int x) { return x * 4; }
+inline int f4454_5(int x) { return x * 5; }
+inline int f4454_6(int x) { return x * 6; }
+inline int f4454_7(int x) { return x * 7; }
+inline int f4454_8(int x) { return x * 8; }
+inline int f4454_9(int x) { return x * 9; }
+inline int f4454_10(int x) { return x * 10; }
+inline int f4454_11(int x) { return x * 11; }
+inline int f4454_12(int x) { return x * 12; }
+inline int f4454_13(int x) { return x * 13; }
+inline int f4454_14(int x) { return x * 14; }
+inline int f4454_15(int x) { return x * 15; }
+inline int f4454_16(int x) { return x * 16; }
+inline int f4454_17(int x) { return x * 17; }
+inline int f4454_18(int x) { return x * 18; }
+inline int f4454_19(int x) { return x * 19; }
+inline int f4454_20(int x) { return x * 20; }
+inline int f4454_21(int x) { return x * 21; }
+inline int f4454_22(int x) { return x * 22; }
+inline int f4454_23(int x) { return x * 23; }
+inline int f4454_24(int x) { return x * 24; }
+inline int f4454_25(int x) { return x * 25; }
+inline int f4454_26(int x) { return x * 26; }
+inline int f4454_27(int x) { return x * 27; }
+inline int f4454_28(int x) { return x * 28; }
+inline int f4454_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4458 */
+#include <vector>
+#include "h2770.h"
+#include "h557.h"
+#include "h6593.h"
+#include "h8088.h"
+#include "h5617.h"
+#ifdef X
+#include "h6431.h"
+#endif
+struct S4458 { int a; const char *s = "x//y"; };
+inline int f4458_0(int x) { return x * 0; }
+inline int f4458_1(int x) { return x * 1; }
+inline int f4458_2(int x) { return x * 2; }
+inline int f4458_3(int x) { return x * 3; }
+inline int f4458_4(int x) { return x * 4; }
+inline int f4458_5(int x) { return x * 5; }
+inline int f4458_6(int x) { return x * 6; }
+inline int f4458_7(int x) { return x * 7; }
+inline int f4458_8(int x) { return x * 8; }
+inline int f4458_9(int x) { return x * 9; }
+inline int f4458_10(int x) { return x * 10; }
+inline int f4458_11(int x) { return x * 11; }
+inline int f4458_12(int x) { return x * 12; }
+inline int f4458_13(int x) { return x * 13; }
+inline int f4458_14(int x) { return x * 14; }
+inline int f4458_15(int x) { return x * 15; }
+inline int f4458_16(int x) { return x * 16; }
+inline int f4458_17(int x) { return x * 17; }
+inline int f4458_18(int x) { return x * 18; }
+inline int f4458_19(int x) { return x * 19; }
+inline int f4458_20(int x) { return x * 20; }
+inline int f4458_21(int x) { return x * 21; }
+inline int f4458_22(int x) { return x * 22; }
+inline int f4458_23(int x) { return x * 23; }
+inline int f4458_24(int x) { return x * 24; }
+inline int f4458_25(int x) { return x * 25; }
+inline int f4458_26(int x) { return x * 26; }
+inline int f4458_27(int x) { return x * 27; }
+inline int f4458_28(int x) { return x * 28; }
+inline int f4458_29(int x) { return x * 29; }
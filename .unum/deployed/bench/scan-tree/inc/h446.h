@@ -0,0 +1,42 @@
+#pragma once
+/* header 446 */
+#include <vector>
+#include "h2828.h"
+#include "h8707.h"
+#include "h1407.h"
+#include "h4365.h"
+#include "h4464.h"
+#ifdef X
+#include "h6757.h"
+#endif
+struct S446 { int a; const char *s = "x//y"; };
+inline int f446_0(int x) { return x * 0; }
+inline int f446_1(int x) { return x * 1; }
+inline int f446_2(int x) { return x * 2; }
+inline int f446_3(int x) { return x * 3; }
+inline int f446_4(int x) { return x * 4; }
+inline int f446_5(int x) { return x * 5; }
+inline int f446_6(int x) { return x * 6; }
+inline int f446_7(int x) { return x * 7; }
+inline int f446_8(int x) { return x * 8; }
+inline int f446_9(int x) { return x * 9; }
+inline int f446_10(int x) { return x * 10; }
+inline int f446_11(int x) { return x * 11; }
+inline int f446_12(int x) { return x * 12; }
+inline int f446_13(int x) { return x * 13; }
+inline int f446_14(int x) { return x * 14; }
+inline int f446_15(int x) { return x * 15; }
+inline int f446_16(int x) { return x * 16; }
+inline int f446_17(int x) { return x * 17; }
+inline int f446_18(int x) { return x * 18; }
+inline int f446_19(int x) { return x * 19; }
+inline int f446_20(int x) { return x * 20; }
+inline int f446_21(int x) { return x * 21; }
+inline int f446_22(int x) { return x * 22; }
+inline int f446_23(int x) { return x * 23; }
+inline int f446_24(int x) { return x * 24; }
+inline int f446_25(int x) { return x * 25; }
+inline int f446_26(int x) { return x * 26; }
+inline int f446_27(int x) { return x * 27; }
+inline int f446_28(int x) { return x * 28; }
+inline int f446_29(int x) { return x * 29; }
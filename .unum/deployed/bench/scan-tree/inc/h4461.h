@@ -0,0 +1,42 @@
+#pragma once
+/* header 4461 */
+#include <vector>
+#include "h6955.h"
+#include "h7251.h"
+#include "h5989.h"
+#include "h7770.h"
+#include "h5993.h"
+#ifdef X
+#include "h9324.h"
+#endif
+struct S4461 { int a; const char *s = "x//y"; };
+inline int f4461_0(int x) { return x * 0; }
+inline int f4461_1(int x) { return x * 1; }
+inline int f4461_2(int x) { return x * 2; }
+inline int f4461_3(int x) { return x * 3; }
+inline int f4461_4(int x) { return x * 4; }
+inline int f4461_5(int x) { return x * 5; }
+inline int f4461_6(int x) { return x * 6; }
+inline int f4461_7(int x) { return x * 7; }
+inline int f4461_8(int x) { return x * 8; }
+inline int f4461_9(int x) { return x * 9; }
+inline int f4461_10(int x) { return x * 10; }
+inline int f4461_11(int x) { return x * 11; }
+inline int f4461_12(int x) { return x * 12; }
+inline int f4461_13(int x) { return x * 13; }
+inline int f4461_14(int x) { return x * 14; }
+inline int f4461_15(int x) { return x * 15; }
+inline int f4461_16(int x) { return x * 16; }
+inline int f4461_17(int x) { return x * 17; }
+inline int f4461_18(int x) { return x * 18; }
+inline int f4461_19(int x) { return x * 19; }
+inline int f4461_20(int x) { return x * 20; }
+inline int f4461_21(int x) { return x * 21; }
+inline int f4461_22(int x) { return x * 22; }
+inline int f4461_23(int x) { return x * 23; }
+inline int f4461_24(int x) { return x * 24; }
+inline int f4461_25(int x) { return x * 25; }
+inline int f4461_26(int x) { return x * 26; }
+inline int f4461_27(int x) { return x * 27; }
+inline int f4461_28(int x) { return x * 28; }
+inline int f4461_29(int x) { return x * 29; }
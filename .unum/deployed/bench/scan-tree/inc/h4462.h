@@ -0,0 +1,42 @@
+#pragma once
+/* header 4462 */
+#include <vector>
+#include "h7863.h"
+#include "h7251.h"
+#include "h4764.h"
+#include "h1440.h"
+#include "h7055.h"
+#ifdef X
+#include "h4585.h"
+#endif
+struct S4462 { int a; const char *s = "x//y"; };
+inline int f4462_0(int x) { return x * 0; }
+inline int f4462_1(int x) { return x * 1; }
+inline int f4462_2(int x) { return x * 2; }
+inline int f4462_3(int x) { return x * 3; }
+inline int f4462_4(int x) { return x * 4; }
+inline int f4462_5(int x) { return x * 5; }
+inline int f4462_6(int x) { return x * 6; }
+inline int f4462_7(int x) { return x * 7; }
+inline int f4462_8(int x) { return x * 8; }
+inline int f4462_9(int x) { return x * 9; }
+inline int f4462_10(int x) { return x * 10; }
+inline int f4462_11(int x) { return x * 11; }
+inline int f4462_12(int x) { return x * 12; }
+inline int f4462_13(int x) { return x * 13; }
+inline int f4462_14(int x) { return x * 14; }
+inline int f4462_15(int x) { return x * 15; }
+inline int f4462_16(int x) { return x * 16; }
+inline int f4462_17(int x) { return x * 17; }
+inline int f4462_18(int x) { return x * 18; }
+inline int f4462_19(int x) { return x * 19; }
+inline int f4462_20(int x) { return x * 20; }
+inline int f4462_21(int x) { return x * 21; }
+inline int f4462_22(int x) { return x * 22; }
+inline int f4462_23(int x) { return x * 23; }
+inline int f4462_24(int x) { return x * 24; }
+inline int f4462_25(int x) { return x * 25; }
+inline int f4462_26(int x) { return x * 26; }
+inline int f4462_27(int x) { return x * 27; }
+inline int f4462_28(int x) { return x * 28; }
+inline int f4462_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4463 */
+#include <vector>
+#include "h5849.h"
+#include "h9576.h"
+#include "h2389.h"
+#include "h5017.h"
+#include "h6351.h"
+#ifdef X
+#include "h730.h"
+#endif
+struct S4463 { int a; const char *s = "x//y"; };
+inline int f4463_0(int x) { return x * 0; }
+inline int f4463_1(int x) { return x * 1; }
+inline int f4463_2(int x) { return x * 2; }
+inline int f4463_3(int x) { return x * 3; }
+inline int f4463_4(int x) { return x * 4; }
+inline int f4463_5(int x) { return x * 5; }
+inline int f4463_6(int x) { return x * 6; }
+inline int f4463_7(int x) { return x * 7; }
+inline int f4463_8(int x) { return x * 8; }
+inline int f4463_9(int x) { return x * 9; }
+inline int f4463_10(int x) { return x * 10; }
+inline int f4463_11(int x) { return x * 11; }
+inline int f4463_12(int x) { return x * 12; }
+inline int f4463_13(int x) { return x * 13; }
+inline int f4463_14(int x) { return x * 14; }
+inline int f4463_15(int x) { return x * 15; }
+inline int f4463_16(int x) { return x * 16; }
+inline int f4463_17(int x) { return x * 17; }
+inline int f4463_18(int x) { return x * 18; }
+inline int f4463_19(int x) { return x * 19; }
+inline int f4463_20(int x) { return x * 20; }
+inline int f4463_21(int x) { return x * 21; }
+inline int f4463_22(int x) { return x * 22; }
+inline int f4463_23(int x) { return x * 23; }
+inline int f4463_24(int x) { return x * 24; }
+inline int f4463_25(int x) { return x * 25; }
+inline int f4463_26(int x) { return x * 26; }
+inline int f4463_27(int x) { return x * 27; }
+inline int f4463_28(int x) { return x * 28; }
+inline int f4463_29(int x) { return x * 29; }
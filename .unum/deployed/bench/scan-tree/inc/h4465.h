@@ -0,0 +1,42 @@
+#pragma once
+/* header 4465 */
+#include <vector>
+#include "h4607.h"
+#include "h921.h"
+#include "h1460.h"
+#include "h3045.h"
+#include "h9989.h"
+#ifdef X
+#include "h3538.h"
+#endif
+struct S4465 { int a; const char *s = "x//y"; };
+inline int f4465_0(int x) { return x * 0; }
+inline int f4465_1(int x) { return x * 1; }
+inline int f4465_2(int x) { return x * 2; }
+inline int f4465_3(int x) { return x * 3; }
+inline int f4465_4(int x) { return x * 4; }
+inline int f4465_5(int x) { return x * 5; }
+inline int f4465_6(int x) { return x * 6; }
+inline int f4465_7(int x) { return x * 7; }
+inline int f4465_8(int x) { return x * 8; }
+inline int f4465_9(int x) { return x * 9; }
+inline int f4465_10(int x) { return x * 10; }
+inline int f4465_11(int x) { return x * 11; }
+inline int f4465_12(int x) { return x * 12; }
+inline int f4465_13(int x) { return x * 13; }
+inline int f4465_14(int x) { return x * 14; }
+inline int f4465_15(int x) { return x * 15; }
+inline int f4465_16(int x) { return x * 16; }
+inline int f4465_17(int x) { return x * 17; }
+inline int f4465_18(int x) { return x * 18; }
+inline int f4465_19(int x) { return x * 19; }
+inline int f4465_20(int x) { return x * 20; }
+inline int f4465_21(int x) { return x * 21; }
+inline int f4465_22(int x) { return x * 22; }
+inline int f4465_23(int x) { return x * 23; }
+inline int f4465_24(int x) { return x * 24; }
+inline int f4465_25(int x) { return x * 25; }
+inline int f4465_26(int x) { return x * 26; }
+inline int f4465_27(int x) { return x * 27; }
+inline int f4465_28(int x) { return x * 28; }
+inline int f4465_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4466 */
+#include <vector>
+#include "h7580.h"
+#include "h2528.h"
+#include "h2540.h"
+#include "h3347.h"
+#include "h6679.h"
+#ifdef X
+#include "h316.h"
+#endif
+struct S4466 { int a; const char *s = "x//y"; };
+inline int f4466_0(int x) { return x * 0; }
+inline int f4466_1(int x) { return x * 1; }
+inline int f4466_2(int x) { return x * 2; }
+inline int f4466_3(int x) { return x * 3; }
+inline int f4466_4(int x) { return x * 4; }
+inline int f4466_5(int x) { return x * 5; }
+inline int f4466_6(int x) { return x * 6; }
+inline int f4466_7(int x) { return x * 7; }
+inline int f4466_8(int x) { return x * 8; }
+inline int f4466_9(int x) { return x * 9; }
+inline int f4466_10(int x) { return x * 10; }
+inline int f4466_11(int x) { return x * 11; }
+inline int f4466_12(int x) { return x * 12; }
+inline int f4466_13(int x) { return x * 13; }
+inline int f4466_14(int x) { return x * 14; }
+inline int f4466_15(int x) { return x * 15; }
+inline int f4466_16(int x) { return x * 16; }
+inline int f4466_17(int x) { return x * 17; }
+inline int f4466_18(int x) { return x * 18; }
+inline int f4466_19(int x) { return x * 19; }
+inline int f4466_20(int x) { return x * 20; }
+inline int f4466_21(int x) { return x * 21; }
+inline int f4466_22(int x) { return x * 22; }
+inline int f4466_23(int x) { return x * 23; }
+inline int f4466_24(int x) { return x * 24; }
+inline int f4466_25(int x) { return x * 25; }
+inline int f4466_26(int x) { return x * 26; }
+inline int f4466_27(int x) { return x * 27; }
+inline int f4466_28(int x) { return x * 28; }
+inline int f4466_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4467 */
+#include <vector>
+#include "h4347.h"
+#include "h7453.h"
+#include "h7860.h"
+#include "h5237.h"
+#include "h5779.h"
+#ifdef X
+#include "h8144.h"
+#endif
+struct S4467 { int a; const char *s = "x//y"; };
+inline int f4467_0(int x) { return x * 0; }
+inline int f4467_1(int x) { return x * 1; }
+inline int f4467_2(int x) { return x * 2; }
+inline int f4467_3(int x) { return x * 3; }
+inline int f4467_4(int x) { return x * 4; }
+inline int f4467_5(int x) { return x * 5; }
+inline int f4467_6(int x) { return x * 6; }
+inline int f4467_7(int x) { return x * 7; }
+inline int f4467_8(int x) { return x * 8; }
+inline int f4467_9(int x) { return x * 9; }
+inline int f4467_10(int x) { return x * 10; }
+inline int f4467_11(int x) { return x * 11; }
+inline int f4467_12(int x) { return x * 12; }
+inline int f4467_13(int x) { return x * 13; }
+inline int f4467_14(int x) { return x * 14; }
+inline int f4467_15(int x) { return x * 15; }
+inline int f4467_16(int x) { return x * 16; }
+inline int f4467_17(int x) { return x * 17; }
+inline int f4467_18(int x) { return x * 18; }
+inline int f4467_19(int x) { return x * 19; }
+inline int f4467_20(int x) { return x * 20; }
+inline int f4467_21(int x) { return x * 21; }
+inline int f4467_22(int x) { return x * 22; }
+inline int f4467_23(int x) { return x * 23; }
+inline int f4467_24(int x) { return x * 24; }
+inline int f4467_25(int x) { return x * 25; }
+inline int f4467_26(int x) { return x * 26; }
+inline int f4467_27(int x) { return x * 27; }
+inline int f4467_28(int x) { return x * 28; }
+inline int f4467_29(int x) { return x * 29; }
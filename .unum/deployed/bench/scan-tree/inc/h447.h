@@ -0,0 +1,42 @@
+#pragma once
+/* header 447 */
+#include <vector>
+#include "h873.h"
+#include "h7045.h"
+#include "h8050.h"
+#include "h9038.h"
+#include "h4919.h"
+#ifdef X
+#include "h1148.h"
+#endif
+struct S447 { int a; const char *s = "x//y"; };
+inline int f447_0(int x) { return x * 0; }
+inline int f447_1(int x) { return x * 1; }
+inline int f447_2(int x) { return x * 2; }
+inline int f447_3(int x) { return x * 3; }
+inline int f447_4(int x) { return x * 4; }
+inline int f447_5(int x) { return x * 5; }
+inline int f447_6(int x) { return x * 6; }
+inline int f447_7(int x) { return x * 7; }
+inline int f447_8(int x) { return x * 8; }
+inline int f447_9(int x) { return x * 9; }
+inline int f447_10(int x) { return x * 10; }
+inline int f447_11(int x) { return x * 11; }
+inline int f447_12(int x) { return x * 12; }
+inline int f447_13(int x) { return x * 13; }
+inline int f447_14(int x) { return x * 14; }
+inline int f447_15(int x) { return x * 15; }
+inline int f447_16(int x) { return x * 16; }
+inline int f447_17(int x) { return x * 17; }
+inline int f447_18(int x) { return x * 18; }
+inline int f447_19(int x) { return x * 19; }
+inline int f447_20(int x) { return x * 20; }
+inline int f447_21(int x) { return x * 21; }
+inline int f447_22(int x) { return x * 22; }
+inline int f447_23(int x) { return x * 23; }
+inline int f447_24(int x) { return x * 24; }
+inline int f447_25(int x) { return x * 25; }
+inline int f447_26(int x) { return x * 26; }
+inline int f447_27(int x) { return x * 27; }
+inline int f447_28(int x) { return x * 28; }
+inline int f447_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4470 */
+#include <vector>
+#include "h3094.h"
+#include "h8038.h"
+#include "h6815.h"
+#include "h5004.h"
+#include "h2138.h"
+#ifdef X
+#include "h2576.h"
+#endif
+struct S4470 { int a; const char *s = "x//y"; };
+inline int f4470_0(int x) { return x * 0; }
+inline int f4470_1(int x) { return x * 1; }
+inline int f4470_2(int x) { return x * 2; }
+inline int f4470_3(int x) { return x * 3; }
+inline int f4470_4(int x) { return x * 4; }
+inline int f4470_5(int x) { return x * 5; }
+inline int f4470_6(int x) { return x * 6; }
+inline int f4470_7(int x) { return x * 7; }
+inline int f4470_8(int x) { return x * 8; }
+inline int f4470_9(int x) { return x * 9; }
+inline int f4470_10(int x) { return x * 10; }
+inline int f4470_11(int x) { return x * 11; }
+inline int f4470_12(int x) { return x * 12; }
+inline int f4470_13(int x) { return x * 13; }
+inline int f4470_14(int x) { return x * 14; }
+inline int f4470_15(int x) { return x * 15; }
+inline int f4470_16(int x) { return x * 16; }
+inline int f4470_17(int x) { return x * 17; }
+inline int f4470_18(int x) { return x * 18; }
+inline int f4470_19(int x) { return x * 19; }
+inline int f4470_20(int x) { return x * 20; }
+inline int f4470_21(int x) { return x * 21; }
+inline int f4470_22(int x) { return x * 22; }
+inline int f4470_23(int x) { return x * 23; }
+inline int f4470_24(int x) { return x * 24; }
+inline int f4470_25(int x) { return x * 25; }
+inline int f4470_26(int x) { return x * 26; }
+inline int f4470_27(int x) { return x * 27; }
+inline int f4470_28(int x) { return x * 28; }
+inline int f4470_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4472 */
+#include <vector>
+#include "h9696.h"
+#include "h6425.h"
+#include "h6773.h"
+#include "h9152.h"
+#include "h9116.h"
+#ifdef X
+#include "h5310.h"
+#endif
+struct S4472 { int a; const char *s = "x//y"; };
+inline int f4472_0(int x) { return x * 0; }
+inline int f4472_1(int x) { return x * 1; }
+inline int f4472_2(int x) { return x * 2; }
+inline int f4472_3(int x) { return x * 3; }
+inline int f4472_4(int x) { return x * 4; }
+inline int f4472_5(int x) { return x * 5; }
+inline int f4472_6(int x) { return x * 6; }
+inline int f4472_7(int x) { return x * 7; }
+inline int f4472_8(int x) { return x * 8; }
+inline int f4472_9(int x) { return x * 9; }
+inline int f4472_10(int x) { return x * 10; }
+inline int f4472_11(int x) { return x * 11; }
+inline int f4472_12(int x) { return x * 12; }
+inline int f4472_13(int x) { return x * 13; }
+inline int f4472_14(int x) { return x * 14; }
+inline int f4472_15(int x) { return x * 15; }
+inline int f4472_16(int x) { return x * 16; }
+inline int f4472_17(int x) { return x * 17; }
+inline int f4472_18(int x) { return x * 18; }
+inline int f4472_19(int x) { return x * 19; }
+inline int f4472_20(int x) { return x * 20; }
+inline int f4472_21(int x) { return x * 21; }
+inline int f4472_22(int x) { return x * 22; }
+inline int f4472_23(int x) { return x * 23; }
+inline int f4472_24(int x) { return x * 24; }
+inline int f4472_25(int x) { return x * 25; }
+inline int f4472_26(int x) { return x * 26; }
+inline int f4472_27(int x) { return x * 27; }
+inline int f4472_28(int x) { return x * 28; }
+inline int f4472_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4474 */
+#include <vector>
+#include "h9641.h"
+#include "h6285.h"
+#include "h4352.h"
+#include "h6429.h"
+#include "h5007.h"
+#ifdef X
+#include "h2843.h"
+#endif
+struct S4474 { int a; const char *s = "x//y"; };
+inline int f4474_0(int x) { return x * 0; }
+inline int f4474_1(int x) { return x * 1; }
+inline int f4474_2(int x) { return x * 2; }
+inline int f4474_3(int x) { return x * 3; }
+inline int f4474_4(int x) { return x * 4; }
+inline int f4474_5(int x) { return x * 5; }
+inline int f4474_6(int x) { return x * 6; }
+inline int f4474_7(int x) { return x * 7; }
+inline int f4474_8(int x) { return x * 8; }
+inline int f4474_9(int x) { return x * 9; }
+inline int f4474_10(int x) { return x * 10; }
+inline int f4474_11(int x) { return x * 11; }
+inline int f4474_12(int x) { return x * 12; }
+inline int f4474_13(int x) { return x * 13; }
+inline int f4474_14(int x) { return x * 14; }
+inline int f4474_15(int x) { return x * 15; }
+inline int f4474_16(int x) { return x * 16; }
+inline int f4474_17(int x) { return x * 17; }
+inline int f4474_18(int x) { return x * 18; }
+inline int f4474_19(int x) { return x * 19; }
+inline int f4474_20(int x) { return x * 20; }
+inline int f4474_21(int x) { return x * 21; }
+inline int f4474_22(int x) { return x * 22; }
+inline int f4474_23(int x) { return x * 23; }
+inline int f4474_24(int x) { return x * 24; }
+inline int f4474_25(int x) { return x * 25; }
+inline int f4474_26(int x) { return x * 26; }
+inline int f4474_27(int x) { return x * 27; }
+inline int f4474_28(int x) { return x * 28; }
+inline int f4474_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4475 */
+#include <vector>
+#include "h366.h"
+#include "h4326.h"
+#include "h5477.h"
+#include "h7648.h"
+#include "h1579.h"
+#ifdef X
+#include "h2224.h"
+#endif
+struct S4475 { int a; const char *s = "x//y"; };
+inline int f4475_0(int x) { return x * 0; }
+inline int f4475_1(int x) { return x * 1; }
+inline int f4475_2(int x) { return x * 2; }
+inline int f4475_3(int x) { return x * 3; }
+inline int f4475_4(int x) { return x * 4; }
+inline int f4475_5(int x) { return x * 5; }
+inline int f4475_6(int x) { return x * 6; }
+inline int f4475_7(int x) { return x * 7; }
+inline int f4475_8(int x) { return x * 8; }
+inline int f4475_9(int x) { return x * 9; }
+inline int f4475_10(int x) { return x * 10; }
+inline int f4475_11(int x) { return x * 11; }
+inline int f4475_12(int x) { return x * 12; }
+inline int f4475_13(int x) { return x * 13; }
+inline int f4475_14(int x) { return x * 14; }
+inline int f4475_15(int x) { return x * 15; }
+inline int f4475_16(int x) { return x * 16; }
+inline int f4475_17(int x) { return x * 17; }
+inline int f4475_18(int x) { return x * 18; }
+inline int f4475_19(int x) { return x * 19; }
+inline int f4475_20(int x) { return x * 20; }
+inline int f4475_21(int x) { return x * 21; }
+inline int f4475_22(int x) { return x * 22; }
+inline int f4475_23(int x) { return x * 23; }
+inline int f4475_24(int x) { return x * 24; }
+inline int f4475_25(int x) { return x * 25; }
+inline int f4475_26(int x) { return x * 26; }
+inline int f4475_27(int x) { return x * 27; }
+inline int f4475_28(int x) { return x * 28; }
+inline int f4475_29(int x) { return x * 29; }
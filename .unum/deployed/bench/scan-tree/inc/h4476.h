@@ -0,0 +1,42 @@
+#pragma once
+/* header 4476 */
+#include <vector>
+#include "h5081.h"
+#include "h9363.h"
+#include "h3622.h"
+#include "h2309.h"
+#include "h1415.h"
+#ifdef X
+#include "h541.h"
+#endif
+struct S4476 { int a; const char *s = "x//y"; };
+inline int f4476_0(int x) { return x * 0; }
+inline int f4476_1(int x) { return x * 1; }
+inline int f4476_2(int x) { return x * 2; }
+inline int f4476_3(int x) { return x * 3; }
+inline int f4476_4(int x) { return x * 4; }
+inline int f4476_5(int x) { return x * 5; }
+inline int f4476_6(int x) { return x * 6; }
+inline int f4476_7(int x) { return x * 7; }
+inline int f4476_8(int x) { return x * 8; }
+inline int f4476_9(int x) { return x * 9; }
+inline int f4476_10(int x) { return x * 10; }
+inline int f4476_11(int x) { return x * 11; }
+inline int f4476_12(int x) { return x * 12; }
+inline int f4476_13(int x) { return x * 13; }
+inline int f4476_14(int x) { return x * 14; }
+inline int f4476_15(int x) { return x * 15; }
+inline int f4476_16(int x) { return x * 16; }
+inline int f4476_17(int x) { return x * 17; }
+inline int f4476_18(int x) { return x * 18; }
+inline int f4476_19(int x) { return x * 19; }
+inline int f4476_20(int x) { return x * 20; }
+inline int f4476_21(int x) { return x * 21; }
+inline int f4476_22(int x) { return x * 22; }
+inline int f4476_23(int x) { return x * 23; }
+inline int f4476_24(int x) { return x * 24; }
+inline int f4476_25(int x) { return x * 25; }
+inline int f4476_26(int x) { return x * 26; }
+inline int f4476_27(int x) { return x * 27; }
+inline int f4476_28(int x) { return x * 28; }
+inline int f4476_29(int x) { return x * 29; }
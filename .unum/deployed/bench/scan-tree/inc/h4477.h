@@ -0,0 +1,42 @@
+#pragma once
+/* header 4477 */
+#include <vector>
+#include "h306.h"
+#include "h2098.h"
+#include "h2529.h"
+#include "h9454.h"
+#include "h3499.h"
+#ifdef X
+#include "h5086.h"
+#endif
+struct S4477 { int a; const char *s = "x//y"; };
+inline int f4477_0(int x) { return x * 0; }
+inline int f4477_1(int x) { return x * 1; }
+inline int f4477_2(int x) { return x * 2; }
+inline int f4477_3(int x) { return x * 3; }
+inline int f4477_4(int x) { return x * 4; }
+inline int f4477_5(int x) { return x * 5; }
+inline int f4477_6(int x) { return x * 6; }
+inline int f4477_7(int x) { return x * 7; }
+inline int f4477_8(int x) { return x * 8; }
+inline int f4477_9(int x) { return x * 9; }
+inline int f4477_10(int x) { return x * 10; }
+inline int f4477_11(int x) { return x * 11; }
+inline int f4477_12(int x) { return x * 12; }
+inline int f4477_13(int x) { return x * 13; }
+inline int f4477_14(int x) { return x * 14; }
+inline int f4477_15(int x) { return x * 15; }
+inline int f4477_16(int x) { return x * 16; }
+inline int f4477_17(int x) { return x * 17; }
+inline int f4477_18(int x) { return x * 18; }
+inline int f4477_19(int x) { return x * 19; }
+inline int f4477_20(int x) { return x * 20; }
+inline int f4477_21(int x) { return x * 21; }
+inline int f4477_22(int x) { return x * 22; }
+inline int f4477_23(int x) { return x * 23; }
+inline int f4477_24(int x) { return x * 24; }
+inline int f4477_25(int x) { return x * 25; }
+inline int f4477_26(int x) { return x * 26; }
+inline int f4477_27(int x) { return x * 27; }
+inline int f4477_28(int x) { return x * 28; }
+inline int f4477_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4478 */
+#include <vector>
+#include "h9549.h"
+#include "h4722.h"
+#include "h8369.h"
+#include "h1615.h"
+#include "h2049.h"
+#ifdef X
+#include "h1112.h"
+#endif
+struct S4478 { int a; const char *s = "x//y"; };
+inline int f4478_0(int x) { return x * 0; }
+inline int f4478_1(int x) { return x * 1; }
+inline int f4478_2(int x) { return x * 2; }
+inline int f4478_3(int x) { return x * 3; }
+inline int f4478_4(int x) { return x * 4; }
+inline int f4478_5(int x) { return x * 5; }
+inline int f4478_6(int x) { return x * 6; }
+inline int f4478_7(int x) { return x * 7; }
+inline int f4478_8(int x) { return x * 8; }
+inline int f4478_9(int x) { return x * 9; }
+inline int f4478_10(int x) { return x * 10; }
+inline int f4478_11(int x) { return x * 11; }
+inline int f4478_12(int x) { return x * 12; }
+inline int f4478_13(int x) { return x * 13; }
+inline int f4478_14(int x) { return x * 14; }
+inline int f4478_15(int x) { return x * 15; }
+inline int f4478_16(int x) { return x * 16; }
+inline int f4478_17(int x) { return x * 17; }
+inline int f4478_18(int x) { return x * 18; }
+inline int f4478_19(int x) { return x * 19; }
+inline int f4478_20(int x) { return x * 20; }
+inline int f4478_21(int x) { return x * 21; }
+inline int f4478_22(int x) { return x * 22; }
+inline int f4478_23(int x) { return x * 23; }
+inline int f4478_24(int x) { return x * 24; }
+inline int f4478_25(int x) { return x * 25; }
+inline int f4478_26(int x) { return x * 26; }
+inline int f4478_27(int x) { return x * 27; }
+inline int f4478_28(int x) { return x * 28; }
+inline int f4478_29(int x) { return x * 29; }
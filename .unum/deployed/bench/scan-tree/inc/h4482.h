@@ -0,0 +1,42 @@
+#pragma once
+/* header 4482 */
+#include <vector>
+#include "h5342.h"
+#include "h605.h"
+#include "h4385.h"
+#include "h9753.h"
+#include "h6197.h"
+#ifdef X
+#include "h7319.h"
+#endif
+struct S4482 { int a; const char *s = "x//y"; };
+inline int f4482_0(int x) { return x * 0; }
+inline int f4482_1(int x) { return x * 1; }
+inline int f4482_2(int x) { return x * 2; }
+inline int f4482_3(int x) { return x * 3; }
+inline int f4482_4(int x) { return x * 4; }
+inline int f4482_5(int x) { return x * 5; }
+inline int f4482_6(int x) { return x * 6; }
+inline int f4482_7(int x) { return x * 7; }
+inline int f4482_8(int x) { return x * 8; }
+inline int f4482_9(int x) { return x * 9; }
+inline int f4482_10(int x) { return x * 10; }
+inline int f4482_11(int x) { return x * 11; }
+inline int f4482_12(int x) { return x * 12; }
+inline int f4482_13(int x) { return x * 13; }
+inline int f4482_14(int x) { return x * 14; }
+inline int f4482_15(int x) { return x * 15; }
+inline int f4482_16(int x) { return x * 16; }
+inline int f4482_17(int x) { return x * 17; }
+inline int f4482_18(int x) { return x * 18; }
+inline int f4482_19(int x) { return x * 19; }
+inline int f4482_20(int x) { return x * 20; }
+inline int f4482_21(int x) { return x * 21; }
+inline int f4482_22(int x) { return x * 22; }
+inline int f4482_23(int x) { return x * 23; }
+inline int f4482_24(int x) { return x * 24; }
+inline int f4482_25(int x) { return x * 25; }
+inline int f4482_26(int x) { return x * 26; }
+inline int f4482_27(int x) { return x * 27; }
+inline int f4482_28(int x) { return x * 28; }
+inline int f4482_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4485 */
+#include <vector>
+#include "h4624.h"
+#include "h6887.h"
+#include "h8043.h"
+#include "h3807.h"
+#include "h137.h"
+#ifdef X
+#include "h9470.h"
+#endif
+struct S4485 { int a; const char *s = "x//y"; };
+inline int f4485_0(int x) { return x * 0; }
+inline int f4485_1(int x) { return x * 1; }
+inline int f4485_2(int x) { return x * 2; }
+inline int f4485_3(int x) { return x * 3; }
+inline int f4485_4(int x) { return x * 4; }
+inline int f4485_5(int x) { return x * 5; }
+inline int f4485_6(int x) { return x * 6; }
+inline int f4485_7(int x) { return x * 7; }
+inline int f4485_8(int x) { return x * 8; }
+inline int f4485_9(int x) { return x * 9; }
+inline int f4485_10(int x) { return x * 10; }
+inline int f4485_11(int x) { return x * 11; }
+inline int f4485_12(int x) { return x * 12; }
+inline int f4485_13(int x) { return x * 13; }
+inline int f4485_14(int x) { return x * 14; }
+inline int f4485_15(int x) { return x * 15; }
+inline int f4485_16(int x) { return x * 16; }
+inline int f4485_17(int x) { return x * 17; }
+inline int f4485_18(int x) { return x * 18; }
+inline int f4485_19(int x) { return x * 19; }
+inline int f4485_20(int x) { return x * 20; }
+inline int f4485_21(int x) { return x * 21; }
+inline int f4485_22(int x) { return x * 22; }
+inline int f4485_23(int x) { return x * 23; }
+inline int f4485_24(int x) { return x * 24; }
+inline int f4485_25(int x) { return x * 25; }
+inline int f4485_26(int x) { return x * 26; }
+inline int f4485_27(int x) { return x * 27; }
+inline int f4485_28(int x) { return x * 28; }
+inline int f4485_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4486 */
+#include <vector>
+#include "h6454.h"
+#include "h940.h"
+#include "h9279.h"
+#include "h4176.h"
+#include "h2545.h"
+#ifdef X
+#include "h7298.h"
+#endif
+struct S4486 { int a; const char *s = "x//y"; };
+inline int f4486_0(int x) { return x * 0; }
+inline int f4486_1(int x) { return x * 1; }
+inline int f4486_2(int x) { return x * 2; }
+inline int f4486_3(int x) { return x * 3; }
+inline int f4486_4(int x) { return x * 4; }
+inline int f4486_5(int x) { return x * 5; }
+inline int f4486_6(int x) { return x * 6; }
+inline int f4486_7(int x) { return x * 7; }
+inline int f4486_8(int x) { return x * 8; }
+inline int f4486_9(int x) { return x * 9; }
+inline int f4486_10(int x) { return x * 10; }
+inline int f4486_11(int x) { return x * 11; }
+inline int f4486_12(int x) { return x * 12; }
+inline int f4486_13(int x) { return x * 13; }
+inline int f4486_14(int x) { return x * 14; }
+inline int f4486_15(int x) { return x * 15; }
+inline int f4486_16(int x) { return x * 16; }
+inline int f4486_17(int x) { return x * 17; }
+inline int f4486_18(int x) { return x * 18; }
+inline int f4486_19(int x) { return x * 19; }
+inline int f4486_20(int x) { return x * 20; }
+inline int f4486_21(int x) { return x * 21; }
+inline int f4486_22(int x) { return x * 22; }
+inline int f4486_23(int x) { return x * 23; }
+inline int f4486_24(int x) { return x * 24; }
+inline int f4486_25(int x) { return x * 25; }
+inline int f4486_26(int x) { return x * 26; }
+inline int f4486_27(int x) { return x * 27; }
+inline int f4486_28(int x) { return x * 28; }
+inline int f4486_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4488 */
+#include <vector>
+#include "h2601.h"
+#include "h7095.h"
+#include "h4092.h"
+#include "h2145.h"
+#include "h8253.h"
+#ifdef X
+#include "h422.h"
+#endif
+struct S4488 { int a; const char *s = "x//y"; };
+inline int f4488_0(int x) { return x * 0; }
+inline int f4488_1(int x) { return x * 1; }
+inline int f4488_2(int x) { return x * 2; }
+inline int f4488_3(int x) { return x * 3; }
+inline int f4488_4(int x) { return x * 4; }
+inline int f4488_5(int x) { return x * 5; }
+inline int f4488_6(int x) { return x * 6; }
+inline int f4488_7(int x) { return x * 7; }
+inline int f4488_8(int x) { return x * 8; }
+inline int f4488_9(int x) { return x * 9; }
+inline int f4488_10(int x) { return x * 10; }
+inline int f4488_11(int x) { return x * 11; }
+inline int f4488_12(int x) { return x * 12; }
+inline int f4488_13(int x) { return x * 13; }
+inline int f4488_14(int x) { return x * 14; }
+inline int f4488_15(int x) { return x * 15; }
+inline int f4488_16(int x) { return x * 16; }
+inline int f4488_17(int x) { return x * 17; }
+inline int f4488_18(int x) { return x * 18; }
+inline int f4488_19(int x) { return x * 19; }
+inline int f4488_20(int x) { return x * 20; }
+inline int f4488_21(int x) { return x * 21; }
+inline int f4488_22(int x) { return x * 22; }
+inline int f4488_23(int x) { return x * 23; }
+inline int f4488_24(int x) { return x * 24; }
+inline int f4488_25(int x) { return x * 25; }
+inline int f4488_26(int x) { return x * 26; }
+inline int f4488_27(int x) { return x * 27; }
+inline int f4488_28(int x) { return x * 28; }
+inline int f4488_29(int x) { return x * 29; }
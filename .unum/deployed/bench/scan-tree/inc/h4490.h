@@ -0,0 +1,42 @@
+#pragma once
+/* header 4490 */
+#include <vector>
+#include "h2035.h"
+#include "h2436.h"
+#include "h5811.h"
+#include "h1944.h"
+#include "h8687.h"
+#ifdef X
+#include "h7098.h"
+#endif
+struct S4490 { int a; const char *s = "x//y"; };
+inline int f4490_0(int x) { return x * 0; }
+inline int f4490_1(int x) { return x * 1; }
+inline int f4490_2(int x) { return x * 2; }
+inline int f4490_3(int x) { return x * 3; }
+inline int f4490_4(int x) { return x * 4; }
+inline int f4490_5(int x) { return x * 5; }
+inline int f4490_6(int x) { return x * 6; }
+inline int f4490_7(int x) { return x * 7; }
+inline int f4490_8(int x) { return x * 8; }
+inline int f4490_9(int x) { return x * 9; }
+inline int f4490_10(int x) { return x * 10; }
+inline int f4490_11(int x) { return x * 11; }
+inline int f4490_12(int x) { return x * 12; }
+inline int f4490_13(int x) { return x * 13; }
+inline int f4490_14(int x) { return x * 14; }
+inline int f4490_15(int x) { return x * 15; }
+inline int f4490_16(int x) { return x * 16; }
+inline int f4490_17(int x) { return x * 17; }
+inline int f4490_18(int x) { return x * 18; }
+inline int f4490_19(int x) { return x * 19; }
+inline int f4490_20(int x) { return x * 20; }
+inline int f4490_21(int x) { return x * 21; }
+inline int f4490_22(int x) { return x * 22; }
+inline int f4490_23(int x) { return x * 23; }
+inline int f4490_24(int x) { return x * 24; }
+inline int f4490_25(int x) { return x * 25; }
+inline int f4490_26(int x) { return x * 26; }
+inline int f4490_27(int x) { return x * 27; }
+inline int f4490_28(int x) { return x * 28; }
+inline int f4490_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4492 */
+#include <vector>
+#include "h5344.h"
+#include "h2193.h"
+#include "h8792.h"
+#include "h4099.h"
+#include "h4596.h"
+#ifdef X
+#include "h8616.h"
+#endif
+struct S4492 { int a; const char *s = "x//y"; };
+inline int f4492_0(int x) { return x * 0; }
+inline int f4492_1(int x) { return x * 1; }
+inline int f4492_2(int x) { return x * 2; }
+inline int f4492_3(int x) { return x * 3; }
+inline int f4492_4(int x) { return x * 4; }
+inline int f4492_5(int x) { return x * 5; }
+inline int f4492_6(int x) { return x * 6; }
+inline int f4492_7(int x) { return x * 7; }
+inline int f4492_8(int x) { return x * 8; }
+inline int f4492_9(int x) { return x * 9; }
+inline int f4492_10(int x) { return x * 10; }
+inline int f4492_11(int x) { return x * 11; }
+inline int f4492_12(int x) { return x * 12; }
+inline int f4492_13(int x) { return x * 13; }
+inline int f4492_14(int x) { return x * 14; }
+inline int f4492_15(int x) { return x * 15; }
+inline int f4492_16(int x) { return x * 16; }
+inline int f4492_17(int x) { return x * 17; }
+inline int f4492_18(int x) { return x * 18; }
+inline int f4492_19(int x) { return x * 19; }
+inline int f4492_20(int x) { return x * 20; }
+inline int f4492_21(int x) { return x * 21; }
+inline int f4492_22(int x) { return x * 22; }
+inline int f4492_23(int x) { return x * 23; }
+inline int f4492_24(int x) { return x * 24; }
+inline int f4492_25(int x) { return x * 25; }
+inline int f4492_26(int x) { return x * 26; }
+inline int f4492_27(int x) { return x * 27; }
+inline int f4492_28(int x) { return x * 28; }
+inline int f4492_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4493 */
+#include <vector>
+#include "h8484.h"
+#include "h7284.h"
+#include "h8268.h"
+#include "h6501.h"
+#include "h8076.h"
+#ifdef X
+#include "h4778.h"
+#endif
+struct S4493 { int a; const char *s = "x//y"; };
+inline int f4493_0(int x) { return x * 0; }
+inline int f4493_1(int x) { return x * 1; }
+inline int f4493_2(int x) { return x * 2; }
+inline int f4493_3(int x) { return x * 3; }
+inline int f4493_4(int x) { return x * 4; }
+inline int f4493_5(int x) { return x * 5; }
+inline int f4493_6(int x) { return x * 6; }
+inline int f4493_7(int x) { return x * 7; }
+inline int f4493_8(int x) { return x * 8; }
+inline int f4493_9(int x) { return x * 9; }
+inline int f4493_10(int x) { return x * 10; }
+inline int f4493_11(int x) { return x * 11; }
+inline int f4493_12(int x) { return x * 12; }
+inline int f4493_13(int x) { return x * 13; }
+inline int f4493_14(int x) { return x * 14; }
+inline int f4493_15(int x) { return x * 15; }
+inline int f4493_16(int x) { return x * 16; }
+inline int f4493_17(int x) { return x * 17; }
+inline int f4493_18(int x) { return x * 18; }
+inline int f4493_19(int x) { return x * 19; }
+inline int f4493_20(int x) { return x * 20; }
+inline int f4493_21(int x) { return x * 21; }
+inline int f4493_22(int x) { return x * 22; }
+inline int f4493_23(int x) { return x * 23; }
+inline int f4493_24(int x) { return x * 24; }
+inline int f4493_25(int x) { return x * 25; }
+inline int f4493_26(int x) { return x * 26; }
+inline int f4493_27(int x) { return x * 27; }
+inline int f4493_28(int x) { return x * 28; }
+inline int f4493_29(int x) { return x * 29; }
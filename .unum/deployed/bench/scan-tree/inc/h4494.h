@@ -0,0 +1,42 @@
+#pragma once
+/* header 4494 */
+#include <vector>
+#include "h7768.h"
+#include "h9889.h"
+#include "h5114.h"
+#include "h8220.h"
+#include "h6105.h"
+#ifdef X
+#include "h8243.h"
+#endif
+struct S4494 { int a; const char *s = "x//y"; };
+inline int f4494_0(int x) { return x * 0; }
+inline int f4494_1(int x) { return x * 1; }
+inline int f4494_2(int x) { return x * 2; }
+inline int f4494_3(int x) { return x * 3; }
+inline int f4494_4(int x) { return x * 4; }
+inline int f4494_5(int x) { return x * 5; }
+inline int f4494_6(int x) { return x * 6; }
+inline int f4494_7(int x) { return x * 7; }
+inline int f4494_8(int x) { return x * 8; }
+inline int f4494_9(int x) { return x * 9; }
+inline int f4494_10(int x) { return x * 10; }
+inline int f4494_11(int x) { return x * 11; }
+inline int f4494_12(int x) { return x * 12; }
+inline int f4494_13(int x) { return x * 13; }
+inline int f4494_14(int x) { return x * 14; }
+inline int f4494_15(int x) { return x * 15; }
+inline int f4494_16(int x) { return x * 16; }
+inline int f4494_17(int x) { return x * 17; }
+inline int f4494_18(int x) { return x * 18; }
+inline int f4494_19(int x) { return x * 19; }
+inline int f4494_20(int x) { return x * 20; }
+inline int f4494_21(int x) { return x * 21; }
+inline int f4494_22(int x) { return x * 22; }
+inline int f4494_23(int x) { return x * 23; }
+inline int f4494_24(int x) { return x * 24; }
+inline int f4494_25(int x) { return x * 25; }
+inline int f4494_26(int x) { return x * 26; }
+inline int f4494_27(int x) { return x * 27; }
+inline int f4494_28(int x) { return x * 28; }
+inline int f4494_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4497 */
+#include <vector>
+#include "h9887.h"
+#include "h741.h"
+#include "h9187.h"
+#include "h3550.h"
+#include "h7440.h"
+#ifdef X
+#include "h2943.h"
+#endif
+struct S4497 { int a; const char *s = "x//y"; };
+inline int f4497_0(int x) { return x * 0; }
+inline int f4497_1(int x) { return x * 1; }
+inline int f4497_2(int x) { return x * 2; }
+inline int f4497_3(int x) { return x * 3; }
+inline int f4497_4(int x) { return x * 4; }
+inline int f4497_5(int x) { return x * 5; }
+inline int f4497_6(int x) { return x * 6; }
+inline int f4497_7(int x) { return x * 7; }
+inline int f4497_8(int x) { return x * 8; }
+inline int f4497_9(int x) { return x * 9; }
+inline int f4497_10(int x) { return x * 10; }
+inline int f4497_11(int x) { return x * 11; }
+inline int f4497_12(int x) { return x * 12; }
+inline int f4497_13(int x) { return x * 13; }
+inline int f4497_14(int x) { return x * 14; }
+inline int f4497_15(int x) { return x * 15; }
+inline int f4497_16(int x) { return x * 16; }
+inline int f4497_17(int x) { return x * 17; }
+inline int f4497_18(int x) { return x * 18; }
+inline int f4497_19(int x) { return x * 19; }
+inline int f4497_20(int x) { return x * 20; }
+inline int f4497_21(int x) { return x * 21; }
+inline int f4497_22(int x) { return x * 22; }
+inline int f4497_23(int x) { return x * 23; }
+inline int f4497_24(int x) { return x * 24; }
+inline int f4497_25(int x) { return x * 25; }
+inline int f4497_26(int x) { return x * 26; }
+inline int f4497_27(int x) { return x * 27; }
+inline int f4497_28(int x) { return x * 28; }
+inline int f4497_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 45 */
+#include <vector>
+#include "h9479.h"
+#include "h4900.h"
+#include "h2664.h"
+#include "h1880.h"
+#include "h3945.h"
+#ifdef X
+#include "h656.h"
+#endif
+struct S45 { int a; const char *s = "x//y"; };
+inline int f45_0(int x) { return x * 0; }
+inline int f45_1(int x) { return x * 1; }
+inline int f45_2(int x) { return x * 2; }
+inline int f45_3(int x) { return x * 3; }
+inline int f45_4(int x) { return x * 4; }
+inline int f45_5(int x) { return x * 5; }
+inline int f45_6(int x) { return x * 6; }
+inline int f45_7(int x) { return x * 7; }
+inline int f45_8(int x) { return x * 8; }
+inline int f45_9(int x) { return x * 9; }
+inline int f45_10(int x) { return x * 10; }
+inline int f45_11(int x) { return x * 11; }
+inline int f45_12(int x) { return x * 12; }
+inline int f45_13(int x) { return x * 13; }
+inline int f45_14(int x) { return x * 14; }
+inline int f45_15(int x) { return x * 15; }
+inline int f45_16(int x) { return x * 16; }
+inline int f45_17(int x) { return x * 17; }
+inline int f45_18(int x) { return x * 18; }
+inline int f45_19(int x) { return x * 19; }
+inline int f45_20(int x) { return x * 20; }
+inline int f45_21(int x) { return x * 21; }
+inline int f45_22(int x) { return x * 22; }
+inline int f45_23(int x) { return x * 23; }
+inline int f45_24(int x) { return x * 24; }
+inline int f45_25(int x) { return x * 25; }
+inline int f45_26(int x) { return x * 26; }
+inline int f45_27(int x) { return x * 27; }
+inline int f45_28(int x) { return x * 28; }
+inline int f45_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4500 */
+#include <vector>
+#include "h9022.h"
+#include "h4143.h"
+#include "h8928.h"
+#include "h9411.h"
+#include "h5359.h"
+#ifdef X
+#include "h5732.h"
+#endif
+struct S4500 { int a; const char *s = "x//y"; };
+inline int f4500_0(int x) { return x * 0; }
+inline int f4500_1(int x) { return x * 1; }
+inline int f4500_2(int x) { return x * 2; }
+inline int f4500_3(int x) { return x * 3; }
+inline int f4500_4(int x) { return x * 4; }
+inline int f4500_5(int x) { return x * 5; }
+inline int f4500_6(int x) { return x * 6; }
+inline int f4500_7(int x) { return x * 7; }
+inline int f4500_8(int x) { return x * 8; }
+inline int f4500_9(int x) { return x * 9; }
+inline int f4500_10(int x) { return x * 10; }
+inline int f4500_11(int x) { return x * 11; }
+inline int f4500_12(int x) { return x * 12; }
+inline int f4500_13(int x) { return x * 13; }
+inline int f4500_14(int x) { return x * 14; }
+inline int f4500_15(int x) { return x * 15; }
+inline int f4500_16(int x) { return x * 16; }
+inline int f4500_17(int x) { return x * 17; }
+inline int f4500_18(int x) { return x * 18; }
+inline int f4500_19(int x) { return x * 19; }
+inline int f4500_20(int x) { return x * 20; }
+inline int f4500_21(int x) { return x * 21; }
+inline int f4500_22(int x) { return x * 22; }
+inline int f4500_23(int x) { return x * 23; }
+inline int f4500_24(int x) { return x * 24; }
+inline int f4500_25(int x) { return x * 25; }
+inline int f4500_26(int x) { return x * 26; }
+inline int f4500_27(int x) { return x * 27; }
+inline int f4500_28(int x) { return x * 28; }
+inline int f4500_29(int x) { return x * 29; }
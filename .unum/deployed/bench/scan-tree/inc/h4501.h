@@ -0,0 +1,42 @@
+#pragma once
+/* header 4501 */
+#include <vector>
+#include "h2704.h"
+#include "h4146.h"
+#include "h1823.h"
+#include "h8322.h"
+#include "h1030.h"
+#ifdef X
+#include "h420.h"
+#endif
+struct S4501 { int a; const char *s = "x//y"; };
+inline int f4501_0(int x) { return x * 0; }
+inline int f4501_1(int x) { return x * 1; }
+inline int f4501_2(int x) { return x * 2; }
+inline int f4501_3(int x) { return x * 3; }
+inline int f4501_4(int x) { return x * 4; }
+inline int f4501_5(int x) { return x * 5; }
+inline int f4501_6(int x) { return x * 6; }
+inline int f4501_7(int x) { return x * 7; }
+inline int f4501_8(int x) { return x * 8; }
+inline int f4501_9(int x) { return x * 9; }
+inline int f4501_10(int x) { return x * 10; }
+inline int f4501_11(int x) { return x * 11; }
+inline int f4501_12(int x) { return x * 12; }
+inline int f4501_13(int x) { return x * 13; }
+inline int f4501_14(int x) { return x * 14; }
+inline int f4501_15(int x) { return x * 15; }
+inline int f4501_16(int x) { return x * 16; }
+inline int f4501_17(int x) { return x * 17; }
+inline int f4501_18(int x) { return x * 18; }
+inline int f4501_19(int x) { return x * 19; }
+inline int f4501_20(int x) { return x * 20; }
+inline int f4501_21(int x) { return x * 21; }
+inline int f4501_22(int x) { return x * 22; }
+inline int f4501_23(int x) { return x * 23; }
+inline int f4501_24(int x) { return x * 24; }
+inline int f4501_25(int x) { return x * 25; }
+inline int f4501_26(int x) { return x * 26; }
+inline int f4501_27(int x) { return x * 27; }
+inline int f4501_28(int x) { return x * 28; }
+inline int f4501_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4502 */
+#include <vector>
+#include "h6358.h"
+#include "h8.h"
+#include "h1036.h"
+#include "h2484.h"
+#include "h207.h"
+#ifdef X
+#include "h976.h"
+#endif
+struct S4502 { int a; const char *s = "x//y"; };
+inline int f4502_0(int x) { return x * 0; }
+inline int f4502_1(int x) { return x * 1; }
+inline int f4502_2(int x) { return x * 2; }
+inline int f4502_3(int x) { return x * 3; }
+inline int f4502_4(int x) { return x * 4; }
+inline int f4502_5(int x) { return x * 5; }
+inline int f4502_6(int x) { return x * 6; }
+inline int f4502_7(int x) { return x * 7; }
+inline int f4502_8(int x) { return x * 8; }
+inline int f4502_9(int x) { return x * 9; }
+inline int f4502_10(int x) { return x * 10; }
+inline int f4502_11(int x) { return x * 11; }
+inline int f4502_12(int x) { return x * 12; }
+inline int f4502_13(int x) { return x * 13; }
+inline int f4502_14(int x) { return x * 14; }
+inline int f4502_15(int x) { return x * 15; }
+inline int f4502_16(int x) { return x * 16; }
+inline int f4502_17(int x) { return x * 17; }
+inline int f4502_18(int x) { return x * 18; }
+inline int f4502_19(int x) { return x * 19; }
+inline int f4502_20(int x) { return x * 20; }
+inline int f4502_21(int x) { return x * 21; }
+inline int f4502_22(int x) { return x * 22; }
+inline int f4502_23(int x) { return x * 23; }
+inline int f4502_24(int x) { return x * 24; }
+inline int f4502_25(int x) { return x * 25; }
+inline int f4502_26(int x) { return x * 26; }
+inline int f4502_27(int x) { return x * 27; }
+inline int f4502_28(int x) { return x * 28; }
+inline int f4502_29(int x) { return x * 29; }
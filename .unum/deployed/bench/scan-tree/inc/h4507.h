@@ -0,0 +1,42 @@
+#pragma once
+/* header 4507 */
+#include <vector>
+#include "h7776.h"
+#include "h3448.h"
+#include "h3910.h"
+#include "h1664.h"
+#include "h8277.h"
+#ifdef X
+#include "h2088.h"
+#endif
+struct S4507 { int a; const char *s = "x//y"; };
+inline int f4507_0(int x) { return x * 0; }
+inline int f4507_1(int x) { return x * 1; }
+inline int f4507_2(int x) { return x * 2; }
+inline int f4507_3(int x) { return x * 3; }
+inline int f4507_4(int x) { return x * 4; }
+inline int f4507_5(int x) { return x * 5; }
+inline int f4507_6(int x) { return x * 6; }
+inline int f4507_7(int x) { return x * 7; }
+inline int f4507_8(int x) { return x * 8; }
+inline int f4507_9(int x) { return x * 9; }
+inline int f4507_10(int x) { return x * 10; }
+inline int f4507_11(int x) { return x * 11; }
+inline int f4507_12(int x) { return x * 12; }
+inline int f4507_13(int x) { return x * 13; }
+inline int f4507_14(int x) { return x * 14; }
+inline int f4507_15(int x) { return x * 15; }
+inline int f4507_16(int x) { return x * 16; }
+inline int f4507_17(int x) { return x * 17; }
+inline int f4507_18(int x) { return x * 18; }
+inline int f4507_19(int x) { return x * 19; }
+inline int f4507_20(int x) { return x * 20; }
+inline int f4507_21(int x) { return x * 21; }
+inline int f4507_22(int x) { return x * 22; }
+inline int f4507_23(int x) { return x * 23; }
+inline int f4507_24(int x) { return x * 24; }
+inline int f4507_25(int x) { return x * 25; }
+inline int f4507_26(int x) { return x * 26; }
+inline int f4507_27(int x) { return x * 27; }
+inline int f4507_28(int x) { return x * 28; }
+inline int f4507_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4508 */
+#include <vector>
+#include "h7087.h"
+#include "h9488.h"
+#include "h9621.h"
+#include "h8445.h"
+#include "h8645.h"
+#ifdef X
+#include "h9687.h"
+#endif
+struct S4508 { int a; const char *s = "x//y"; };
+inline int f4508_0(int x) { return x * 0; }
+inline int f4508_1(int x) { return x * 1; }
+inline int f4508_2(int x) { return x * 2; }
+inline int f4508_3(int x) { return x * 3; }
+inline int f4508_4(int x) { return x * 4; }
+inline int f4508_5(int x) { return x * 5; }
+inline int f4508_6(int x) { return x * 6; }
+inline int f4508_7(int x) { return x * 7; }
+inline int f4508_8(int x) { return x * 8; }
+inline int f4508_9(int x) { return x * 9; }
+inline int f4508_10(int x) { return x * 10; }
+inline int f4508_11(int x) { return x * 11; }
+inline int f4508_12(int x) { return x * 12; }
+inline int f4508_13(int x) { return x * 13; }
+inline int f4508_14(int x) { return x * 14; }
+inline int f4508_15(int x) { return x * 15; }
+inline int f4508_16(int x) { return x * 16; }
+inline int f4508_17(int x) { return x * 17; }
+inline int f4508_18(int x) { return x * 18; }
+inline int f4508_19(int x) { return x * 19; }
+inline int f4508_20(int x) { return x * 20; }
+inline int f4508_21(int x) { return x * 21; }
+inline int f4508_22(int x) { return x * 22; }
+inline int f4508_23(int x) { return x * 23; }
+inline int f4508_24(int x) { return x * 24; }
+inline int f4508_25(int x) { return x * 25; }
+inline int f4508_26(int x) { return x * 26; }
+inline int f4508_27(int x) { return x * 27; }
+inline int f4508_28(int x) { return x * 28; }
+inline int f4508_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4509 */
+#include <vector>
+#include "h7448.h"
+#include "h9510.h"
+#include "h9537.h"
+#include "h6966.h"
+#include "h5527.h"
+#ifdef X
+#include "h2224.h"
+#endif
+struct S4509 { int a; const char *s = "x//y"; };
+inline int f4509_0(int x) { return x * 0; }
+inline int f4509_1(int x) { return x * 1; }
+inline int f4509_2(int x) { return x * 2; }
+inline int f4509_3(int x) { return x * 3; }
+inline int f4509_4(int x) { return x * 4; }
+inline int f4509_5(int x) { return x * 5; }
+inline int f4509_6(int x) { return x * 6; }
+inline int f4509_7(int x) { return x * 7; }
+inline int f4509_8(int x) { return x * 8; }
+inline int f4509_9(int x) { return x * 9; }
+inline int f4509_10(int x) { return x * 10; }
+inline int f4509_11(int x) { return x * 11; }
+inline int f4509_12(int x) { return x * 12; }
+inline int f4509_13(int x) { return x * 13; }
+inline int f4509_14(int x) { return x * 14; }
+inline int f4509_15(int x) { return x * 15; }
+inline int f4509_16(int x) { return x * 16; }
+inline int f4509_17(int x) { return x * 17; }
+inline int f4509_18(int x) { return x * 18; }
+inline int f4509_19(int x) { return x * 19; }
+inline int f4509_20(int x) { return x * 20; }
+inline int f4509_21(int x) { return x * 21; }
+inline int f4509_22(int x) { return x * 22; }
+inline int f4509_23(int x) { return x * 23; }
+inline int f4509_24(int x) { return x * 24; }
+inline int f4509_25(int x) { return x * 25; }
+inline int f4509_26(int x) { return x * 26; }
+inline int f4509_27(int x) { return x * 27; }
+inline int f4509_28(int x) { return x * 28; }
+inline int f4509_29(int x) { return x * 29; }
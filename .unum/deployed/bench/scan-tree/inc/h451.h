@@ -0,0 +1,42 @@
+#pragma once
+/* header 451 */
+#include <vector>
+#include "h3822.h"
+#include "h4038.h"
+#include "h5755.h"
+#include "h9884.h"
+#include "h3691.h"
+#ifdef X
+#include "h4036.h"
+#endif
+struct S451 { int a; const char *s = "x//y"; };
+inline int f451_0(int x) { return x * 0; }
+inline int f451_1(int x) { return x * 1; }
+inline int f451_2(int x) { return x * 2; }
+inline int f451_3(int x) { return x * 3; }
+inline int f451_4(int x) { return x * 4; }
+inline int f451_5(int x) { return x * 5; }
+inline int f451_6(int x) { return x * 6; }
+inline int f451_7(int x) { return x * 7; }
+inline int f451_8(int x) { return x * 8; }
+inline int f451_9(int x) { return x * 9; }
+inline int f451_10(int x) { return x * 10; }
+inline int f451_11(int x) { return x * 11; }
+inline int f451_12(int x) { return x * 12; }
+inline int f451_13(int x) { return x * 13; }
+inline int f451_14(int x) { return x * 14; }
+inline int f451_15(int x) { return x * 15; }
+inline int f451_16(int x) { return x * 16; }
+inline int f451_17(int x) { return x * 17; }
+inline int f451_18(int x) { return x * 18; }
+inline int f451_19(int x) { return x * 19; }
+inline int f451_20(int x) { return x * 20; }
+inline int f451_21(int x) { return x * 21; }
+inline int f451_22(int x) { return x * 22; }
+inline int f451_23(int x) { return x * 23; }
+inline int f451_24(int x) { return x * 24; }
+inline int f451_25(int x) { return x * 25; }
+inline int f451_26(int x) { return x * 26; }
+inline int f451_27(int x) { return x * 27; }
+inline int f451_28(int x) { return x * 28; }
+inline int f451_29(int x) { return x * 29; }
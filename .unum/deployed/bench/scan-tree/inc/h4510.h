@@ -0,0 +1,42 @@
+#pragma once
+/* header 4510 */
+#include <vector>
+#include "h7797.h"
+#include "h5190.h"
+#include "h5345.h"
+#include "h5605.h"
+#include "h9869.h"
+#ifdef X
+#include "h2614.h"
+#endif
+struct S4510 { int a; const char *s = "x//y"; };
+inline int f4510_0(int x) { return x * 0; }
+inline int f4510_1(int x) { return x * 1; }
+inline int f4510_2(int x) { return x * 2; }
+inline int f4510_3(int x) { return x * 3; }
+inline int f4510_4(int x) { return x * 4; }
+inline int f4510_5(int x) { return x * 5; }
+inline int f4510_6(int x) { return x * 6; }
+inline int f4510_7(int x) { return x * 7; }
+inline int f4510_8(int x) { return x * 8; }
+inline int f4510_9(int x) { return x * 9; }
+inline int f4510_10(int x) { return x * 10; }
+inline int f4510_11(int x) { return x * 11; }
+inline int f4510_12(int x) { return x * 12; }
+inline int f4510_13(int x) { return x * 13; }
+inline int f4510_14(int x) { return x * 14; }
+inline int f4510_15(int x) { return x * 15; }
+inline int f4510_16(int x) { return x * 16; }
+inline int f4510_17(int x) { return x * 17; }
+inline int f4510_18(int x) { return x * 18; }
+inline int f4510_19(int x) { return x * 19; }
+inline int f4510_20(int x) { return x * 20; }
+inline int f4510_21(int x) { return x * 21; }
+inline int f4510_22(int x) { return x * 22; }
+inline int f4510_23(int x) { return x * 23; }
+inline int f4510_24(int x) { return x * 24; }
+inline int f4510_25(int x) { return x * 25; }
+inline int f4510_26(int x) { return x * 26; }
+inline int f4510_27(int x) { return x * 27; }
+inline int f4510_28(int x) { return x * 28; }
+inline int f4510_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4513 */
+#include <vector>
+#include "h6241.h"
+#include "h8358.h"
+#include "h8235.h"
+#include "h5758.h"
+#include "h7555.h"
+#ifdef X
+#include "h3413.h"
+#endif
+struct S4513 { int a; const char *s = "x//y"; };
+inline int f4513_0(int x) { return x * 0; }
+inline int f4513_1(int x) { return x * 1; }
+inline int f4513_2(int x) { return x * 2; }
+inline int f4513_3(int x) { return x * 3; }
+inline int f4513_4(int x) { return x * 4; }
+inline int f4513_5(int x) { return x * 5; }
+inline int f4513_6(int x) { return x * 6; }
+inline int f4513_7(int x) { return x * 7; }
+inline int f4513_8(int x) { return x * 8; }
+inline int f4513_9(int x) { return x * 9; }
+inline int f4513_10(int x) { return x * 10; }
+inline int f4513_11(int x) { return x * 11; }
+inline int f4513_12(int x) { return x * 12; }
+inline int f4513_13(int x) { return x * 13; }
+inline int f4513_14(int x) { return x * 14; }
+inline int f4513_15(int x) { return x * 15; }
+inline int f4513_16(int x) { return x * 16; }
+inline int f4513_17(int x) { return x * 17; }
+inline int f4513_18(int x) { return x * 18; }
+inline int f4513_19(int x) { return x * 19; }
+inline int f4513_20(int x) { return x * 20; }
+inline int f4513_21(int x) { return x * 21; }
+inline int f4513_22(int x) { return x * 22; }
+inline int f4513_23(int x) { return x * 23; }
+inline int f4513_24(int x) { return x * 24; }
+inline int f4513_25(int x) { return x * 25; }
+inline int f4513_26(int x) { return x * 26; }
+inline int f4513_27(int x) { return x * 27; }
+inline int f4513_28(int x) { return x * 28; }
+inline int f4513_29(int x) { return x * 29; }
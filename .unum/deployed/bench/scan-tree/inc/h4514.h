@@ -0,0 +1,42 @@
+#pragma once
+/* header 4514 */
+#include <vector>
+#include "h8157.h"
+#include "h7450.h"
+#include "h8643.h"
+#include "h891.h"
+#include "h6015.h"
+#ifdef X
+#include "h2921.h"
+#endif
+struct S4514 { int a; const char *s = "x//y"; };
+inline int f4514_0(int x) { return x * 0; }
+inline int f4514_1(int x) { return x * 1; }
+inline int f4514_2(int x) { return x * 2; }
+inline int f4514_3(int x) { return x * 3; }
+inline int f4514_4(int x) { return x * 4; }
+inline int f4514_5(int x) { return x * 5; }
+inline int f4514_6(int x) { return x * 6; }
+inline int f4514_7(int x) { return x * 7; }
+inline int f4514_8(int x) { return x * 8; }
+inline int f4514_9(int x) { return x * 9; }
+inline int f4514_10(int x) { return x * 10; }
+inline int f4514_11(int x) { return x * 11; }
+inline int f4514_12(int x) { return x * 12; }
+inline int f4514_13(int x) { return x * 13; }
+inline int f4514_14(int x) { return x * 14; }
+inline int f4514_15(int x) { return x * 15; }
+inline int f4514_16(int x) { return x * 16; }
+inline int f4514_17(int x) { return x * 17; }
+inline int f4514_18(int x) { return x * 18; }
+inline int f4514_19(int x) { return x * 19; }
+inline int f4514_20(int x) { return x * 20; }
+inline int f4514_21(int x) { return x * 21; }
+inline int f4514_22(int x) { return x * 22; }
+inline int f4514_23(int x) { return x * 23; }
+inline int f4514_24(int x) { return x * 24; }
+inline int f4514_25(int x) { return x * 25; }
+inline int f4514_26(int x) { return x * 26; }
+inline int f4514_27(int x) { return x * 27; }
+inline int f4514_28(int x) { return x * 28; }
+inline int f4514_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4515 */
+#include <vector>
+#include "h528.h"
+#include "h4786.h"
+#include "h6338.h"
+#include "h6398.h"
+#include "h1346.h"
+#ifdef X
+#include "h3373.h"
+#endif
+struct S4515 { int a; const char *s = "x//y"; };
+inline int f4515_0(int x) { return x * 0; }
+inline int f4515_1(int x) { return x * 1; }
+inline int f4515_2(int x) { return x * 2; }
+inline int f4515_3(int x) { return x * 3; }
+inline int f4515_4(int x) { return x * 4; }
+inline int f4515_5(int x) { return x * 5; }
+inline int f4515_6(int x) { return x * 6; }
+inline int f4515_7(int x) { return x * 7; }
+inline int f4515_8(int x) { return x * 8; }
+inline int f4515_9(int x) { return x * 9; }
+inline int f4515_10(int x) { return x * 10; }
+inline int f4515_11(int x) { return x * 11; }
+inline int f4515_12(int x) { return x * 12; }
+inline int f4515_13(int x) { return x * 13; }
+inline int f4515_14(int x) { return x * 14; }
+inline int f4515_15(int x) { return x * 15; }
+inline int f4515_16(int x) { return x * 16; }
+inline int f4515_17(int x) { return x * 17; }
+inline int f4515_18(int x) { return x * 18; }
+inline int f4515_19(int x) { return x * 19; }
+inline int f4515_20(int x) { return x * 20; }
+inline int f4515_21(int x) { return x * 21; }
+inline int f4515_22(int x) { return x * 22; }
+inline int f4515_23(int x) { return x * 23; }
+inline int f4515_24(int x) { return x * 24; }
+inline int f4515_25(int x) { return x * 25; }
+inline int f4515_26(int x) { return x * 26; }
+inline int f4515_27(int x) { return x * 27; }
+inline int f4515_28(int x) { return x * 28; }
+inline int f4515_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4517 */
+#include <vector>
+#include "h9949.h"
+#include "h6197.h"
+#include "h3809.h"
+#include "h1277.h"
+#include "h8867.h"
+#ifdef X
+#include "h6621.h"
+#endif
+struct S4517 { int a; const char *s = "x//y"; };
+inline int f4517_0(int x) { return x * 0; }
+inline int f4517_1(int x) { return x * 1; }
+inline int f4517_2(int x) { return x * 2; }
+inline int f4517_3(int x) { return x * 3; }
+inline int f4517_4(int x) { return x * 4; }
+inline int f4517_5(int x) { return x * 5; }
+inline int f4517_6(int x) { return x * 6; }
+inline int f4517_7(int x) { return x * 7; }
+inline int f4517_8(int x) { return x * 8; }
+inline int f4517_9(int x) { return x * 9; }
+inline int f4517_10(int x) { return x * 10; }
+inline int f4517_11(int x) { return x * 11; }
+inline int f4517_12(int x) { return x * 12; }
+inline int f4517_13(int x) { return x * 13; }
+inline int f4517_14(int x) { return x * 14; }
+inline int f4517_15(int x) { return x * 15; }
+inline int f4517_16(int x) { return x * 16; }
+inline int f4517_17(int x) { return x * 17; }
+inline int f4517_18(int x) { return x * 18; }
+inline int f4517_19(int x) { return x * 19; }
+inline int f4517_20(int x) { return x * 20; }
+inline int f4517_21(int x) { return x * 21; }
+inline int f4517_22(int x) { return x * 22; }
+inline int f4517_23(int x) { return x * 23; }
+inline int f4517_24(int x) { return x * 24; }
+inline int f4517_25(int x) { return x * 25; }
+inline int f4517_26(int x) { return x * 26; }
+inline int f4517_27(int x) { return x * 27; }
+inline int f4517_28(int x) { return x * 28; }
+inline int f4517_29(int x) { return x * 29; }
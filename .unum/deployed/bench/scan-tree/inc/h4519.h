@@ -0,0 +1,42 @@
+#pragma once
+/* header 4519 */
+#include <vector>
+#include "h4582.h"
+#include "h395.h"
+#include "h8799.h"
+#include "h8901.h"
+#include "h7068.h"
+#ifdef X
+#include "h7971.h"
+#endif
+struct S4519 { int a; const char *s = "x//y"; };
+inline int f4519_0(int x) { return x * 0; }
+inline int f4519_1(int x) { return x * 1; }
+inline int f4519_2(int x) { return x * 2; }
+inline int f4519_3(int x) { return x * 3; }
+inline int f4519_4(int x) { return x * 4; }
+inline int f4519_5(int x) { return x * 5; }
+inline int f4519_6(int x) { return x * 6; }
+inline int f4519_7(int x) { return x * 7; }
+inline int f4519_8(int x) { return x * 8; }
+inline int f4519_9(int x) { return x * 9; }
+inline int f4519_10(int x) { return x * 10; }
+inline int f4519_11(int x) { return x * 11; }
+inline int f4519_12(int x) { return x * 12; }
+inline int f4519_13(int x) { return x * 13; }
+inline int f4519_14(int x) { return x * 14; }
+inline int f4519_15(int x) { return x * 15; }
+inline int f4519_16(int x) { return x * 16; }
+inline int f4519_17(int x) { return x * 17; }
+inline int f4519_18(int x) { return x * 18; }
+inline int f4519_19(int x) { return x * 19; }
+inline int f4519_20(int x) { return x * 20; }
+inline int f4519_21(int x) { return x * 21; }
+inline int f4519_22(int x) { return x * 22; }
+inline int f4519_23(int x) { return x * 23; }
+inline int f4519_24(int x) { return x * 24; }
+inline int f4519_25(int x) { return x * 25; }
+inline int f4519_26(int x) { return x * 26; }
+inline int f4519_27(int x) { return x * 27; }
+inline int f4519_28(int x) { return x * 28; }
+inline int f4519_29(int x) { return x * 29; }
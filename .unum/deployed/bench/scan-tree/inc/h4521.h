@@ -0,0 +1,42 @@
+#pragma once
+/* header 4521 */
+#include <vector>
+#include "h611.h"
+#include "h3067.h"
+#include "h3077.h"
+#include "h5596.h"
+#include "h4034.h"
+#ifdef X
+#include "h9571.h"
+#endif
+struct S4521 { int a; const char *s = "x//y"; };
+inline int f4521_0(int x) { return x * 0; }
+inline int f4521_1(int x) { return x * 1; }
+inline int f4521_2(int x) { return x * 2; }
+inline int f4521_3(int x) { return x * 3; }
+inline int f4521_4(int x) { return x * 4; }
+inline int f4521_5(int x) { return x * 5; }
+inline int f4521_6(int x) { return x * 6; }
+inline int f4521_7(int x) { return x * 7; }
+inline int f4521_8(int x) { return x * 8; }
+inline int f4521_9(int x) { return x * 9; }
+inline int f4521_10(int x) { return x * 10; }
+inline int f4521_11(int x) { return x * 11; }
+inline int f4521_12(int x) { return x * 12; }
+inline int f4521_13(int x) { return x * 13; }
+inline int f4521_14(int x) { return x * 14; }
+inline int f4521_15(int x) { return x * 15; }
+inline int f4521_16(int x) { return x * 16; }
+inline int f4521_17(int x) { return x * 17; }
+inline int f4521_18(int x) { return x * 18; }
+inline int f4521_19(int x) { return x * 19; }
+inline int f4521_20(int x) { return x * 20; }
+inline int f4521_21(int x) { return x * 21; }
+inline int f4521_22(int x) { return x * 22; }
+inline int f4521_23(int x) { return x * 23; }
+inline int f4521_24(int x) { return x * 24; }
+inline int f4521_25(int x) { return x * 25; }
+inline int f4521_26(int x) { return x * 26; }
+inline int f4521_27(int x) { return x * 27; }
+inline int f4521_28(int x) { return x * 28; }
+inline int f4521_29(int x) { return x * 29; }
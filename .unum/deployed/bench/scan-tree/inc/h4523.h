@@ -0,0 +1,42 @@
+#pragma once
+/* header 4523 */
+#include <vector>
+#include "h9505.h"
+#include "h7875.h"
+#include "h1654.h"
+#include "h7592.h"
+#include "h4321.h"
+#ifdef X
+#include "h15.h"
+#endif
+struct S4523 { int a; const char *s = "x//y"; };
+inline int f4523_0(int x) { return x * 0; }
+inline int f4523_1(int x) { return x * 1; }
+inline int f4523_2(int x) { return x * 2; }
+inline int f4523_3(int x) { return x * 3; }
+inline int f4523_4(int x) { return x * 4; }
+inline int f4523_5(int x) { return x * 5; }
+inline int f4523_6(int x) { return x * 6; }
+inline int f4523_7(int x) { return x * 7; }
+inline int f4523_8(int x) { return x * 8; }
+inline int f4523_9(int x) { return x * 9; }
+inline int f4523_10(int x) { return x * 10; }
+inline int f4523_11(int x) { return x * 11; }
+inline int f4523_12(int x) { return x * 12; }
+inline int f4523_13(int x) { return x * 13; }
+inline int f4523_14(int x) { return x * 14; }
+inline int f4523_15(int x) { return x * 15; }
+inline int f4523_16(int x) { return x * 16; }
+inline int f4523_17(int x) { return x * 17; }
+inline int f4523_18(int x) { return x * 18; }
+inline int f4523_19(int x) { return x * 19; }
+inline int f4523_20(int x) { return x * 20; }
+inline int f4523_21(int x) { return x * 21; }
+inline int f4523_22(int x) { return x * 22; }
+inline int f4523_23(int x) { return x * 23; }
+inline int f4523_24(int x) { return x * 24; }
+inline int f4523_25(int x) { return x * 25; }
+inline int f4523_26(int x) { return x * 26; }
+inline int f4523_27(int x) { return x * 27; }
+inline int f4523_28(int x) { return x * 28; }
+inline int f4523_29(int x) { return x * 29; }
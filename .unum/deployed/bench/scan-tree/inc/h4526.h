@@ -0,0 +1,42 @@
+#pragma once
+/* header 4526 */
+#include <vector>
+#include "h6743.h"
+#include "h9866.h"
+#include "h6537.h"
+#include "h1359.h"
+#include "h5385.h"
+#ifdef X
+#include "h8826.h"
+#endif
+struct S4526 { int a; const char *s = "x//y"; };
+inline int f4526_0(int x) { return x * 0; }
+inline int f4526_1(int x) { return x * 1; }
+inline int f4526_2(int x) { return x * 2; }
+inline int f4526_3(int x) { return x * 3; }
+inline int f4526_4(int x) { return x * 4; }
+inline int f4526_5(int x) { return x * 5; }
+inline int f4526_6(int x) { return x * 6; }
+inline int f4526_7(int x) { return x * 7; }
+inline int f4526_8(int x) { return x * 8; }
+inline int f4526_9(int x) { return x * 9; }
+inline int f4526_10(int x) { return x * 10; }
+inline int f4526_11(int x) { return x * 11; }
+inline int f4526_12(int x) { return x * 12; }
+inline int f4526_13(int x) { return x * 13; }
+inline int f4526_14(int x) { return x * 14; }
+inline int f4526_15(int x) { return x * 15; }
+inline int f4526_16(int x) { return x * 16; }
+inline int f4526_17(int x) { return x * 17; }
+inline int f4526_18(int x) { return x * 18; }
+inline int f4526_19(int x) { return x * 19; }
+inline int f4526_20(int x) { return x * 20; }
+inline int f4526_21(int x) { return x * 21; }
+inline int f4526_22(int x) { return x * 22; }
+inline int f4526_23(int x) { return x * 23; }
+inline int f4526_24(int x) { return x * 24; }
+inline int f4526_25(int x) { return x * 25; }
+inline int f4526_26(int x) { return x * 26; }
+inline int f4526_27(int x) { return x * 27; }
+inline int f4526_28(int x) { return x * 28; }
+inline int f4526_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4527 */
+#include <vector>
+#include "h1895.h"
+#include "h7557.h"
+#include "h1983.h"
+#include "h6786.h"
+#include "h8224.h"
+#ifdef X
+#include "h6623.h"
+#endif
+struct S4527 { int a; const char *s = "x//y"; };
+inline int f4527_0(int x) { return x * 0; }
+inline int f4527_1(int x) { return x * 1; }
+inline int f4527_2(int x) { return x * 2; }
+inline int f4527_3(int x) { return x * 3; }
+inline int f4527_4(int x) { return x * 4; }
+inline int f4527_5(int x) { return x * 5; }
+inline int f4527_6(int x) { return x * 6; }
+inline int f4527_7(int x) { return x * 7; }
+inline int f4527_8(int x) { return x * 8; }
+inline int f4527_9(int x) { return x * 9; }
+inline int f4527_10(int x) { return x * 10; }
+inline int f4527_11(int x) { return x * 11; }
+inline int f4527_12(int x) { return x * 12; }
+inline int f4527_13(int x) { return x * 13; }
+inline int f4527_14(int x) { return x * 14; }
+inline int f4527_15(int x) { return x * 15; }
+inline int f4527_16(int x) { return x * 16; }
+inline int f4527_17(int x) { return x * 17; }
+inline int f4527_18(int x) { return x * 18; }
+inline int f4527_19(int x) { return x * 19; }
+inline int f4527_20(int x) { return x * 20; }
+inline int f4527_21(int x) { return x * 21; }
+inline int f4527_22(int x) { return x * 22; }
+inline int f4527_23(int x) { return x * 23; }
+inline int f4527_24(int x) { return x * 24; }
+inline int f4527_25(int x) { return x * 25; }
+inline int f4527_26(int x) { return x * 26; }
+inline int f4527_27(int x) { return x * 27; }
+inline int f4527_28(int x) { return x * 28; }
+inline int f4527_29(int x) { return x * 29; }
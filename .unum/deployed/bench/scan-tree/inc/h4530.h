@@ -0,0 +1,42 @@
+#pragma once
+/* header 4530 */
+#include <vector>
+#include "h962.h"
+#include "h5865.h"
+#include "h778.h"
+#include "h3077.h"
+#include "h813.h"
+#ifdef X
+#include "h5988.h"
+#endif
+struct S4530 { int a; const char *s = "x//y"; };
+inline int f4530_0(int x) { return x * 0; }
+inline int f4530_1(int x) { return x * 1; }
+inline int f4530_2(int x) { return x * 2; }
+inline int f4530_3(int x) { return x * 3; }
+inline int f4530_4(int x) { return x * 4; }
+inline int f4530_5(int x) { return x * 5; }
+inline int f4530_6(int x) { return x * 6; }
+inline int f4530_7(int x) { return x * 7; }
+inline int f4530_8(int x) { return x * 8; }
+inline int f4530_9(int x) { return x * 9; }
+inline int f4530_10(int x) { return x * 10; }
+inline int f4530_11(int x) { return x * 11; }
+inline int f4530_12(int x) { return x * 12; }
+inline int f4530_13(int x) { return x * 13; }
+inline int f4530_14(int x) { return x * 14; }
+inline int f4530_15(int x) { return x * 15; }
+inline int f4530_16(int x) { return x * 16; }
+inline int f4530_17(int x) { return x * 17; }
+inline int f4530_18(int x) { return x * 18; }
+inline int f4530_19(int x) { return x * 19; }
+inline int f4530_20(int x) { return x * 20; }
+inline int f4530_21(int x) { return x * 21; }
+inline int f4530_22(int x) { return x * 22; }
+inline int f4530_23(int x) { return x * 23; }
+inline int f4530_24(int x) { return x * 24; }
+inline int f4530_25(int x) { return x * 25; }
+inline int f4530_26(int x) { return x * 26; }
+inline int f4530_27(int x) { return x * 27; }
+inline int f4530_28(int x) { return x * 28; }
+inline int f4530_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4531 */
+#include <vector>
+#include "h1660.h"
+#include "h2116.h"
+#include "h5199.h"
+#include "h1624.h"
+#include "h5303.h"
+#ifdef X
+#include "h1696.h"
+#endif
+struct S4531 { int a; const char *s = "x//y"; };
+inline int f4531_0(int x) { return x * 0; }
+inline int f4531_1(int x) { return x * 1; }
+inline int f4531_2(int x) { return x * 2; }
+inline int f4531_3(int x) { return x * 3; }
+inline int f4531_4(int x) { return x * 4; }
+inline int f4531_5(int x) { return x * 5; }
+inline int f4531_6(int x) { return x * 6; }
+inline int f4531_7(int x) { return x * 7; }
+inline int f4531_8(int x) { return x * 8; }
+inline int f4531_9(int x) { return x * 9; }
+inline int f4531_10(int x) { return x * 10; }
+inline int f4531_11(int x) { return x * 11; }
+inline int f4531_12(int x) { return x * 12; }
+inline int f4531_13(int x) { return x * 13; }
+inline int f4531_14(int x) { return x * 14; }
+inline int f4531_15(int x) { return x * 15; }
+inline int f4531_16(int x) { return x * 16; }
+inline int f4531_17(int x) { return x * 17; }
+inline int f4531_18(int x) { return x * 18; }
+inline int f4531_19(int x) { return x * 19; }
+inline int f4531_20(int x) { return x * 20; }
+inline int f4531_21(int x) { return x * 21; }
+inline int f4531_22(int x) { return x * 22; }
+inline int f4531_23(int x) { return x * 23; }
+inline int f4531_24(int x) { return x * 24; }
+inline int f4531_25(int x) { return x * 25; }
+inline int f4531_26(int x) { return x * 26; }
+inline int f4531_27(int x) { return x * 27; }
+inline int f4531_28(int x) { return x * 28; }
+inline int f4531_29(int x) { return x * 29; }
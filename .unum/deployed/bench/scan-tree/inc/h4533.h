@@ -0,0 +1,42 @@
+#pragma once
+/* header 4533 */
+#include <vector>
+#include "h1072.h"
+#include "h1734.h"
+#include "h3570.h"
+#include "h7905.h"
+#include "h3610.h"
+#ifdef X
+#include "h2122.h"
+#endif
+struct S4533 { int a; const char *s = "x//y"; };
+inline int f4533_0(int x) { return x * 0; }
+inline int f4533_1(int x) { return x * 1; }
+inline int f4533_2(int x) { return x * 2; }
+inline int f4533_3(int x) { return x * 3; }
+inline int f4533_4(int x) { return x * 4; }
+inline int f4533_5(int x) { return x * 5; }
+inline int f4533_6(int x) { return x * 6; }
+inline int f4533_7(int x) { return x * 7; }
+inline int f4533_8(int x) { return x * 8; }
+inline int f4533_9(int x) { return x * 9; }
+inline int f4533_10(int x) { return x * 10; }
+inline int f4533_11(int x) { return x * 11; }
+inline int f4533_12(int x) { return x * 12; }
+inline int f4533_13(int x) { return x * 13; }
+inline int f4533_14(int x) { return x * 14; }
+inline int f4533_15(int x) { return x * 15; }
+inline int f4533_16(int x) { return x * 16; }
+inline int f4533_17(int x) { return x * 17; }
+inline int f4533_18(int x) { return x * 18; }
+inline int f4533_19(int x) { return x * 19; }
+inline int f4533_20(int x) { return x * 20; }
+inline int f4533_21(int x) { return x * 21; }
+inline int f4533_22(int x) { return x * 22; }
+inline int f4533_23(int x) { return x * 23; }
+inline int f4533_24(int x) { return x * 24; }
+inline int f4533_25(int x) { return x * 25; }
+inline int f4533_26(int x) { return x * 26; }
+inline int f4533_27(int x) { return x * 27; }
+inline int f4533_28(int x) { return x * 28; }
+inline int f4533_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4534 */
+#include <vector>
+#include "h2496.h"
+#include "h8437.h"
+#include "h2323.h"
+#include "h4420.h"
+#include "h7148.h"
+#ifdef X
+#include "h2599.h"
+#endif
+struct S4534 { int a; const char *s = "x//y"; };
+inline int f4534_0(int x) { return x * 0; }
+inline int f4534_1(int x) { return x * 1; }
+inline int f4534_2(int x) { return x * 2; }
+inline int f4534_3(int x) { return x * 3; }
+inline int f4534_4(int x) { return x * 4; }
+inline int f4534_5(int x) { return x * 5; }
+inline int f4534_6(int x) { return x * 6; }
+inline int f4534_7(int x) { return x * 7; }
+inline int f4534_8(int x) { return x * 8; }
+inline int f4534_9(int x) { return x * 9; }
+inline int f4534_10(int x) { return x * 10; }
+inline int f4534_11(int x) { return x * 11; }
+inline int f4534_12(int x) { return x * 12; }
+inline int f4534_13(int x) { return x * 13; }
+inline int f4534_14(int x) { return x * 14; }
+inline int f4534_15(int x) { return x * 15; }
+inline int f4534_16(int x) { return x * 16; }
+inline int f4534_17(int x) { return x * 17; }
+inline int f4534_18(int x) { return x * 18; }
+inline int f4534_19(int x) { return x * 19; }
+inline int f4534_20(int x) { return x * 20; }
+inline int f4534_21(int x) { return x * 21; }
+inline int f4534_22(int x) { return x * 22; }
+inline int f4534_23(int x) { return x * 23; }
+inline int f4534_24(int x) { return x * 24; }
+inline int f4534_25(int x) { return x * 25; }
+inline int f4534_26(int x) { return x * 26; }
+inline int f4534_27(int x) { return x * 27; }
+inline int f4534_28(int x) { return x * 28; }
+inline int f4534_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4535 */
+#include <vector>
+#include "h6474.h"
+#include "h9491.h"
+#include "h8278.h"
+#include "h6767.h"
+#include "h8979.h"
+#ifdef X
+#include "h7170.h"
+#endif
+struct S4535 { int a; const char *s = "x//y"; };
+inline int f4535_0(int x) { return x * 0; }
+inline int f4535_1(int x) { return x * 1; }
+inline int f4535_2(int x) { return x * 2; }
+inline int f4535_3(int x) { return x * 3; }
+inline int f4535_4(int x) { return x * 4; }
+inline int f4535_5(int x) { return x * 5; }
+inline int f4535_6(int x) { return x * 6; }
+inline int f4535_7(int x) { return x * 7; }
+inline int f4535_8(int x) { return x * 8; }
+inline int f4535_9(int x) { return x * 9; }
+inline int f4535_10(int x) { return x * 10; }
+inline int f4535_11(int x) { return x * 11; }
+inline int f4535_12(int x) { return x * 12; }
+inline int f4535_13(int x) { return x * 13; }
+inline int f4535_14(int x) { return x * 14; }
+inline int f4535_15(int x) { return x * 15; }
+inline int f4535_16(int x) { return x * 16; }
+inline int f4535_17(int x) { return x * 17; }
+inline int f4535_18(int x) { return x * 18; }
+inline int f4535_19(int x) { return x * 19; }
+inline int f4535_20(int x) { return x * 20; }
+inline int f4535_21(int x) { return x * 21; }
+inline int f4535_22(int x) { return x * 22; }
+inline int f4535_23(int x) { return x * 23; }
+inline int f4535_24(int x) { return x * 24; }
+inline int f4535_25(int x) { return x * 25; }
+inline int f4535_26(int x) { return x * 26; }
+inline int f4535_27(int x) { return x * 27; }
+inline int f4535_28(int x) { return x * 28; }
+inline int f4535_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4537 */
+#include <vector>
+#include "h3862.h"
+#include "h8712.h"
+#include "h6944.h"
+#include "h465.h"
+#include "h1244.h"
+#ifdef X
+#include "h6877.h"
+#endif
+struct S4537 { int a; const char *s = "x//y"; };
+inline int f4537_0(int x) { return x * 0; }
+inline int f4537_1(int x) { return x * 1; }
+inline int f4537_2(int x) { return x * 2; }
+inline int f4537_3(int x) { return x * 3; }
+inline int f4537_4(int x) { return x * 4; }
+inline int f4537_5(int x) { return x * 5; }
+inline int f4537_6(int x) { return x * 6; }
+inline int f4537_7(int x) { return x * 7; }
+inline int f4537_8(int x) { return x * 8; }
+inline int f4537_9(int x) { return x * 9; }
+inline int f4537_10(int x) { return x * 10; }
+inline int f4537_11(int x) { return x * 11; }
+inline int f4537_12(int x) { return x * 12; }
+inline int f4537_13(int x) { return x * 13; }
+inline int f4537_14(int x) { return x * 14; }
+inline int f4537_15(int x) { return x * 15; }
+inline int f4537_16(int x) { return x * 16; }
+inline int f4537_17(int x) { return x * 17; }
+inline int f4537_18(int x) { return x * 18; }
+inline int f4537_19(int x) { return x * 19; }
+inline int f4537_20(int x) { return x * 20; }
+inline int f4537_21(int x) { return x * 21; }
+inline int f4537_22(int x) { return x * 22; }
+inline int f4537_23(int x) { return x * 23; }
+inline int f4537_24(int x) { return x * 24; }
+inline int f4537_25(int x) { return x * 25; }
+inline int f4537_26(int x) { return x * 26; }
+inline int f4537_27(int x) { return x * 27; }
+inline int f4537_28(int x) { return x * 28; }
+inline int f4537_29(int x) { return x * 29; }
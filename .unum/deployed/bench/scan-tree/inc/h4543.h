@@ -0,0 +1,42 @@
+#pragma once
+/* header 4543 */
+#include <vector>
+#include "h5673.h"
+#include "h4385.h"
+#include "h1266.h"
+#include "h2569.h"
+#include "h5954.h"
+#ifdef X
+#include "h5730.h"
+#endif
+struct S4543 { int a; const char *s = "x//y"; };
+inline int f4543_0(int x) { return x * 0; }
+inline int f4543_1(int x) { return x * 1; }
+inline int f4543_2(int x) { return x * 2; }
+inline int f4543_3(int x) { return x * 3; }
+inline int f4543_4(int x) { return x * 4; }
+inline int f4543_5(int x) { return x * 5; }
+inline int f4543_6(int x) { return x * 6; }
+inline int f4543_7(int x) { return x * 7; }
+inline int f4543_8(int x) { return x * 8; }
+inline int f4543_9(int x) { return x * 9; }
+inline int f4543_10(int x) { return x * 10; }
+inline int f4543_11(int x) { return x * 11; }
+inline int f4543_12(int x) { return x * 12; }
+inline int f4543_13(int x) { return x * 13; }
+inline int f4543_14(int x) { return x * 14; }
+inline int f4543_15(int x) { return x * 15; }
+inline int f4543_16(int x) { return x * 16; }
+inline int f4543_17(int x) { return x * 17; }
+inline int f4543_18(int x) { return x * 18; }
+inline int f4543_19(int x) { return x * 19; }
+inline int f4543_20(int x) { return x * 20; }
+inline int f4543_21(int x) { return x * 21; }
+inline int f4543_22(int x) { return x * 22; }
+inline int f4543_23(int x) { return x * 23; }
+inline int f4543_24(int x) { return x * 24; }
+inline int f4543_25(int x) { return x * 25; }
+inline int f4543_26(int x) { return x * 26; }
+inline int f4543_27(int x) { return x * 27; }
+inline int f4543_28(int x) { return x * 28; }
+inline int f4543_29(int x) { return x * 29; }
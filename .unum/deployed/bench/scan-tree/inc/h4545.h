@@ -0,0 +1,42 @@
+#pragma once
+/* header 4545 */
+#include <vector>
+#include "h2052.h"
+#include "h9789.h"
+#include "h8104.h"
+#include "h763.h"
+#include "h1750.h"
+#ifdef X
+#include "h5542.h"
+#endif
+struct S4545 { int a; const char *s = "x//y"; };
+inline int f4545_0(int x) { return x * 0; }
+inline int f4545_1(int x) { return x * 1; }
+inline int f4545_2(int x) { return x * 2; }
+inline int f4545_3(int x) { return x * 3; }
+inline int f4545_4(int x) { return x * 4; }
+inline int f4545_5(int x) { return x * 5; }
+inline int f4545_6(int x) { return x * 6; }
+inline int f4545_7(int x) { return x * 7; }
+inline int f4545_8(int x) { return x * 8; }
+inline int f4545_9(int x) { return x * 9; }
+inline int f4545_10(int x) { return x * 10; }
+inline int f4545_11(int x) { return x * 11; }
+inline int f4545_12(int x) { return x * 12; }
+inline int f4545_13(int x) { return x * 13; }
+inline int f4545_14(int x) { return x * 14; }
+inline int f4545_15(int x) { return x * 15; }
+inline int f4545_16(int x) { return x * 16; }
+inline int f4545_17(int x) { return x * 17; }
+inline int f4545_18(int x) { return x * 18; }
+inline int f4545_19(int x) { return x * 19; }
+inline int f4545_20(int x) { return x * 20; }
+inline int f4545_21(int x) { return x * 21; }
+inline int f4545_22(int x) { return x * 22; }
+inline int f4545_23(int x) { return x * 23; }
+inline int f4545_24(int x) { return x * 24; }
+inline int f4545_25(int x) { return x * 25; }
+inline int f4545_26(int x) { return x * 26; }
+inline int f4545_27(int x) { return x * 27; }
+inline int f4545_28(int x) { return x * 28; }
+inline int f4545_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4546 */
+#include <vector>
+#include "h9515.h"
+#include "h393.h"
+#include "h4571.h"
+#include "h3258.h"
+#include "h3495.h"
+#ifdef X
+#include "h8648.h"
+#endif
+struct S4546 { int a; const char *s = "x//y"; };
+inline int f4546_0(int x) { return x * 0; }
+inline int f4546_1(int x) { return x * 1; }
+inline int f4546_2(int x) { return x * 2; }
+inline int f4546_3(int x) { return x * 3; }
+inline int f4546_4(int x) { return x * 4; }
+inline int f4546_5(int x) { return x * 5; }
+inline int f4546_6(int x) { return x * 6; }
+inline int f4546_7(int x) { return x * 7; }
+inline int f4546_8(int x) { return x * 8; }
+inline int f4546_9(int x) { return x * 9; }
+inline int f4546_10(int x) { return x * 10; }
+inline int f4546_11(int x) { return x * 11; }
+inline int f4546_12(int x) { return x * 12; }
+inline int f4546_13(int x) { return x * 13; }
+inline int f4546_14(int x) { return x * 14; }
+inline int f4546_15(int x) { return x * 15; }
+inline int f4546_16(int x) { return x * 16; }
+inline int f4546_17(int x) { return x * 17; }
+inline int f4546_18(int x) { return x * 18; }
+inline int f4546_19(int x) { return x * 19; }
+inline int f4546_20(int x) { return x * 20; }
+inline int f4546_21(int x) { return x * 21; }
+inline int f4546_22(int x) { return x * 22; }
+inline int f4546_23(int x) { return x * 23; }
+inline int f4546_24(int x) { return x * 24; }
+inline int f4546_25(int x) { return x * 25; }
+inline int f4546_26(int x) { return x * 26; }
+inline int f4546_27(int x) { return x * 27; }
+inline int f4546_28(int x) { return x * 28; }
+inline int f4546_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4547 */
+#include <vector>
+#include "h4981.h"
+#include "h9307.h"
+#include "h2292.h"
+#include "h2210.h"
+#include "h7024.h"
+#ifdef X
+#include "h9585.h"
+#endif
+struct S4547 { int a; const char *s = "x//y"; };
+inline int f4547_0(int x) { return x * 0; }
+inline int f4547_1(int x) { return x * 1; }
+inline int f4547_2(int x) { return x * 2; }
+inline int f4547_3(int x) { return x * 3; }
+inline int f4547_4(int x) { return x * 4; }
+inline int f4547_5(int x) { return x * 5; }
+inline int f4547_6(int x) { return x * 6; }
+inline int f4547_7(int x) { return x * 7; }
+inline int f4547_8(int x) { return x * 8; }
+inline int f4547_9(int x) { return x * 9; }
+inline int f4547_10(int x) { return x * 10; }
+inline int f4547_11(int x) { return x * 11; }
+inline int f4547_12(int x) { return x * 12; }
+inline int f4547_13(int x) { return x * 13; }
+inline int f4547_14(int x) { return x * 14; }
+inline int f4547_15(int x) { return x * 15; }
+inline int f4547_16(int x) { return x * 16; }
+inline int f4547_17(int x) { return x * 17; }
+inline int f4547_18(int x) { return x * 18; }
+inline int f4547_19(int x) { return x * 19; }
+inline int f4547_20(int x) { return x * 20; }
+inline int f4547_21(int x) { return x * 21; }
+inline int f4547_22(int x) { return x * 22; }
+inline int f4547_23(int x) { return x * 23; }
+inline int f4547_24(int x) { return x * 24; }
+inline int f4547_25(int x) { return x * 25; }
+inline int f4547_26(int x) { return x * 26; }
+inline int f4547_27(int x) { return x * 27; }
+inline int f4547_28(int x) { return x * 28; }
+inline int f4547_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4549 */
+#include <vector>
+#include "h4865.h"
+#include "h7629.h"
+#include "h7777.h"
+#include "h1065.h"
+#include "h7024.h"
+#ifdef X
+#include "h7588.h"
+#endif
+struct S4549 { int a; const char *s = "x//y"; };
+inline int f4549_0(int x) { return x * 0; }
+inline int f4549_1(int x) { return x * 1; }
+inline int f4549_2(int x) { return x * 2; }
+inline int f4549_3(int x) { return x * 3; }
+inline int f4549_4(int x) { return x * 4; }
+inline int f4549_5(int x) { return x * 5; }
+inline int f4549_6(int x) { return x * 6; }
+inline int f4549_7(int x) { return x * 7; }
+inline int f4549_8(int x) { return x * 8; }
+inline int f4549_9(int x) { return x * 9; }
+inline int f4549_10(int x) { return x * 10; }
+inline int f4549_11(int x) { return x * 11; }
+inline int f4549_12(int x) { return x * 12; }
+inline int f4549_13(int x) { return x * 13; }
+inline int f4549_14(int x) { return x * 14; }
+inline int f4549_15(int x) { return x * 15; }
+inline int f4549_16(int x) { return x * 16; }
+inline int f4549_17(int x) { return x * 17; }
+inline int f4549_18(int x) { return x * 18; }
+inline int f4549_19(int x) { return x * 19; }
+inline int f4549_20(int x) { return x * 20; }
+inline int f4549_21(int x) { return x * 21; }
+inline int f4549_22(int x) { return x * 22; }
+inline int f4549_23(int x) { return x * 23; }
+inline int f4549_24(int x) { return x * 24; }
+inline int f4549_25(int x) { return x * 25; }
+inline int f4549_26(int x) { return x * 26; }
+inline int f4549_27(int x) { return x * 27; }
+inline int f4549_28(int x) { return x * 28; }
+inline int f4549_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 455 */
+#include <vector>
+#include "h4704.h"
+#include "h5115.h"
+#include "h797.h"
+#include "h5781.h"
+#include "h360.h"
+#ifdef X
+#include "h2074.h"
+#endif
+struct S455 { int a; const char *s = "x//y"; };
+inline int f455_0(int x) { return x * 0; }
+inline int f455_1(int x) { return x * 1; }
+inline int f455_2(int x) { return x * 2; }
+inline int f455_3(int x) { return x * 3; }
+inline int f455_4(int x) { return x * 4; }
+inline int f455_5(int x) { return x * 5; }
+inline int f455_6(int x) { return x * 6; }
+inline int f455_7(int x) { return x * 7; }
+inline int f455_8(int x) { return x * 8; }
+inline int f455_9(int x) { return x * 9; }
+inline int f455_10(int x) { return x * 10; }
+inline int f455_11(int x) { return x * 11; }
+inline int f455_12(int x) { return x * 12; }
+inline int f455_13(int x) { return x * 13; }
+inline int f455_14(int x) { return x * 14; }
+inline int f455_15(int x) { return x * 15; }
+inline int f455_16(int x) { return x * 16; }
+inline int f455_17(int x) { return x * 17; }
+inline int f455_18(int x) { return x * 18; }
+inline int f455_19(int x) { return x * 19; }
+inline int f455_20(int x) { return x * 20; }
+inline int f455_21(int x) { return x * 21; }
+inline int f455_22(int x) { return x * 22; }
+inline int f455_23(int x) { return x * 23; }
+inline int f455_24(int x) { return x * 24; }
+inline int f455_25(int x) { return x * 25; }
+inline int f455_26(int x) { return x * 26; }
+inline int f455_27(int x) { return x * 27; }
+inline int f455_28(int x) { return x * 28; }
+inline int f455_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4551 */
+#include <vector>
+#include "h3349.h"
+#include "h9680.h"
+#include "h4771.h"
+#include "h5055.h"
+#include "h5860.h"
+#ifdef X
+#include "h6405.h"
+#endif
+struct S4551 { int a; const char *s = "x//y"; };
+inline int f4551_0(int x) { return x * 0; }
+inline int f4551_1(int x) { return x * 1; }
+inline int f4551_2(int x) { return x * 2; }
+inline int f4551_3(int x) { return x * 3; }
+inline int f4551_4(int x) { return x * 4; }
+inline int f4551_5(int x) { return x * 5; }
+inline int f4551_6(int x) { return x * 6; }
+inline int f4551_7(int x) { return x * 7; }
+inline int f4551_8(int x) { return x * 8; }
+inline int f4551_9(int x) { return x * 9; }
+inline int f4551_10(int x) { return x * 10; }
+inline int f4551_11(int x) { return x * 11; }
+inline int f4551_12(int x) { return x * 12; }
+inline int f4551_13(int x) { return x * 13; }
+inline int f4551_14(int x) { return x * 14; }
+inline int f4551_15(int x) { return x * 15; }
+inline int f4551_16(int x) { return x * 16; }
+inline int f4551_17(int x) { return x * 17; }
+inline int f4551_18(int x) { return x * 18; }
+inline int f4551_19(int x) { return x * 19; }
+inline int f4551_20(int x) { return x * 20; }
+inline int f4551_21(int x) { return x * 21; }
+inline int f4551_22(int x) { return x * 22; }
+inline int f4551_23(int x) { return x * 23; }
+inline int f4551_24(int x) { return x * 24; }
+inline int f4551_25(int x) { return x * 25; }
+inline int f4551_26(int x) { return x * 26; }
+inline int f4551_27(int x) { return x * 27; }
+inline int f4551_28(int x) { return x * 28; }
+inline int f4551_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4553 */
+#include <vector>
+#include "h8049.h"
+#include "h6220.h"
+#include "h407.h"
+#include "h3627.h"
+#include "h4206.h"
+#ifdef X
+#include "h9279.h"
+#endif
+struct S4553 { int a; const char *s = "x//y"; };
+inline int f4553_0(int x) { return x * 0; }
+inline int f4553_1(int x) { return x * 1; }
+inline int f4553_2(int x) { return x * 2; }
+inline int f4553_3(int x) { return x * 3; }
+inline int f4553_4(int x) { return x * 4; }
+inline int f4553_5(int x) { return x * 5; }
+inline int f4553_6(int x) { return x * 6; }
+inline int f4553_7(int x) { return x * 7; }
+inline int f4553_8(int x) { return x * 8; }
+inline int f4553_9(int x) { return x * 9; }
+inline int f4553_10(int x) { return x * 10; }
+inline int f4553_11(int x) { return x * 11; }
+inline int f4553_12(int x) { return x * 12; }
+inline int f4553_13(int x) { return x * 13; }
+inline int f4553_14(int x) { return x * 14; }
+inline int f4553_15(int x) { return x * 15; }
+inline int f4553_16(int x) { return x * 16; }
+inline int f4553_17(int x) { return x * 17; }
+inline int f4553_18(int x) { return x * 18; }
+inline int f4553_19(int x) { return x * 19; }
+inline int f4553_20(int x) { return x * 20; }
+inline int f4553_21(int x) { return x * 21; }
+inline int f4553_22(int x) { return x * 22; }
+inline int f4553_23(int x) { return x * 23; }
+inline int f4553_24(int x) { return x * 24; }
+inline int f4553_25(int x) { return x * 25; }
+inline int f4553_26(int x) { return x * 26; }
+inline int f4553_27(int x) { return x * 27; }
+inline int f4553_28(int x) { return x * 28; }
+inline int f4553_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4554 */
+#include <vector>
+#include "h9223.h"
+#include "h6687.h"
+#include "h3846.h"
+#include "h9597.h"
+#include "h5262.h"
+#ifdef X
+#include "h9632.h"
+#endif
+struct S4554 { int a; const char *s = "x//y"; };
+inline int f4554_0(int x) { return x * 0; }
+inline int f4554_1(int x) { return x * 1; }
+inline int f4554_2(int x) { return x * 2; }
+inline int f4554_3(int x) { return x * 3; }
+inline int f4554_4(int x) { return x * 4; }
+inline int f4554_5(int x) { return x * 5; }
+inline int f4554_6(int x) { return x * 6; }
+inline int f4554_7(int x) { return x * 7; }
+inline int f4554_8(int x) { return x * 8; }
+inline int f4554_9(int x) { return x * 9; }
+inline int f4554_10(int x) { return x * 10; }
+inline int f4554_11(int x) { return x * 11; }
+inline int f4554_12(int x) { return x * 12; }
+inline int f4554_13(int x) { return x * 13; }
+inline int f4554_14(int x) { return x * 14; }
+inline int f4554_15(int x) { return x * 15; }
+inline int f4554_16(int x) { return x * 16; }
+inline int f4554_17(int x) { return x * 17; }
+inline int f4554_18(int x) { return x * 18; }
+inline int f4554_19(int x) { return x * 19; }
+inline int f4554_20(int x) { return x * 20; }
+inline int f4554_21(int x) { return x * 21; }
+inline int f4554_22(int x) { return x * 22; }
+inline int f4554_23(int x) { return x * 23; }
+inline int f4554_24(int x) { return x * 24; }
+inline int f4554_25(int x) { return x * 25; }
+inline int f4554_26(int x) { return x * 26; }
+inline int f4554_27(int x) { return x * 27; }
+inline int f4554_28(int x) { return x * 28; }
+inline int f4554_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4555 */
+#include <vector>
+#include "h1913.h"
+#include "h3848.h"
+#include "h9461.h"
+#include "h7424.h"
+#include "h6950.h"
+#ifdef X
+#include "h208.h"
+#endif
+struct S4555 { int a; const char *s = "x//y"; };
+inline int f4555_0(int x) { return x * 0; }
+inline int f4555_1(int x) { return x * 1; }
+inline int f4555_2(int x) { return x * 2; }
+inline int f4555_3(int x) { return x * 3; }
+inline int f4555_4(int x) { return x * 4; }
+inline int f4555_5(int x) { return x * 5; }
+inline int f4555_6(int x) { return x * 6; }
+inline int f4555_7(int x) { return x * 7; }
+inline int f4555_8(int x) { return x * 8; }
+inline int f4555_9(int x) { return x * 9; }
+inline int f4555_10(int x) { return x * 10; }
+inline int f4555_11(int x) { return x * 11; }
+inline int f4555_12(int x) { return x * 12; }
+inline int f4555_13(int x) { return x * 13; }
+inline int f4555_14(int x) { return x * 14; }
+inline int f4555_15(int x) { return x * 15; }
+inline int f4555_16(int x) { return x * 16; }
+inline int f4555_17(int x) { return x * 17; }
+inline int f4555_18(int x) { return x * 18; }
+inline int f4555_19(int x) { return x * 19; }
+inline int f4555_20(int x) { return x * 20; }
+inline int f4555_21(int x) { return x * 21; }
+inline int f4555_22(int x) { return x * 22; }
+inline int f4555_23(int x) { return x * 23; }
+inline int f4555_24(int x) { return x * 24; }
+inline int f4555_25(int x) { return x * 25; }
+inline int f4555_26(int x) { return x * 26; }
+inline int f4555_27(int x) { return x * 27; }
+inline int f4555_28(int x) { return x * 28; }
+inline int f4555_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4558 */
+#include <vector>
+#include "h8883.h"
+#include "h909.h"
+#include "h3082.h"
+#include "h216.h"
+#include "h3041.h"
+#ifdef X
+#include "h1739.h"
+#endif
+struct S4558 { int a; const char *s = "x//y"; };
+inline int f4558_0(int x) { return x * 0; }
+inline int f4558_1(int x) { return x * 1; }
+inline int f4558_2(int x) { return x * 2; }
+inline int f4558_3(int x) { return x * 3; }
+inline int f4558_4(int x) { return x * 4; }
+inline int f4558_5(int x) { return x * 5; }
+inline int f4558_6(int x) { return x * 6; }
+inline int f4558_7(int x) { return x * 7; }
+inline int f4558_8(int x) { return x * 8; }
+inline int f4558_9(int x) { return x * 9; }
+inline int f4558_10(int x) { return x * 10; }
+inline int f4558_11(int x) { return x * 11; }
+inline int f4558_12(int x) { return x * 12; }
+inline int f4558_13(int x) { return x * 13; }
+inline int f4558_14(int x) { return x * 14; }
+inline int f4558_15(int x) { return x * 15; }
+inline int f4558_16(int x) { return x * 16; }
+inline int f4558_17(int x) { return x * 17; }
+inline int f4558_18(int x) { return x * 18; }
+inline int f4558_19(int x) { return x * 19; }
+inline int f4558_20(int x) { return x * 20; }
+inline int f4558_21(int x) { return x * 21; }
+inline int f4558_22(int x) { return x * 22; }
+inline int f4558_23(int x) { return x * 23; }
+inline int f4558_24(int x) { return x * 24; }
+inline int f4558_25(int x) { return x * 25; }
+inline int f4558_26(int x) { return x * 26; }
+inline int f4558_27(int x) { return x * 27; }
+inline int f4558_28(int x) { return x * 28; }
+inline int f4558_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4560 */
+#include <vector>
+#include "h5886.h"
+#include "h4329.h"
+#include "h3057.h"
+#include "h3755.h"
+#include "h9510.h"
+#ifdef X
+#include "h5923.h"
+#endif
+struct S4560 { int a; const char *s = "x//y"; };
+inline int f4560_0(int x) { return x * 0; }
+inline int f4560_1(int x) { return x * 1; }
+inline int f4560_2(int x) { return x * 2; }
+inline int f4560_3(int x) { return x * 3; }
+inline int f4560_4(int x) { return x * 4; }
+inline int f4560_5(int x) { return x * 5; }
+inline int f4560_6(int x) { return x * 6; }
+inline int f4560_7(int x) { return x * 7; }
+inline int f4560_8(int x) { return x * 8; }
+inline int f4560_9(int x) { return x * 9; }
+inline int f4560_10(int x) { return x * 10; }
+inline int f4560_11(int x) { return x * 11; }
+inline int f4560_12(int x) { return x * 12; }
+inline int f4560_13(int x) { return x * 13; }
+inline int f4560_14(int x) { return x * 14; }
+inline int f4560_15(int x) { return x * 15; }
+inline int f4560_16(int x) { return x * 16; }
+inline int f4560_17(int x) { return x * 17; }
+inline int f4560_18(int x) { return x * 18; }
+inline int f4560_19(int x) { return x * 19; }
+inline int f4560_20(int x) { return x * 20; }
+inline int f4560_21(int x) { return x * 21; }
+inline int f4560_22(int x) { return x * 22; }
+inline int f4560_23(int x) { return x * 23; }
+inline int f4560_24(int x) { return x * 24; }
+inline int f4560_25(int x) { return x * 25; }
+inline int f4560_26(int x) { return x * 26; }
+inline int f4560_27(int x) { return x * 27; }
+inline int f4560_28(int x) { return x * 28; }
+inline int f4560_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4561 */
+#include <vector>
+#include "h840.h"
+#include "h9652.h"
+#include "h4552.h"
+#include "h81.h"
+#include "h7155.h"
+#ifdef X
+#include "h3395.h"
+#endif
+struct S4561 { int a; const char *s = "x//y"; };
+inline int f4561_0(int x) { return x * 0; }
+inline int f4561_1(int x) { return x * 1; }
+inline int f4561_2(int x) { return x * 2; }
+inline int f4561_3(int x) { return x * 3; }
+inline int f4561_4(int x) { return x * 4; }
+inline int f4561_5(int x) { return x * 5; }
+inline int f4561_6(int x) { return x * 6; }
+inline int f4561_7(int x) { return x * 7; }
+inline int f4561_8(int x) { return x * 8; }
+inline int f4561_9(int x) { return x * 9; }
+inline int f4561_10(int x) { return x * 10; }
+inline int f4561_11(int x) { return x * 11; }
+inline int f4561_12(int x) { return x * 12; }
+inline int f4561_13(int x) { return x * 13; }
+inline int f4561_14(int x) { return x * 14; }
+inline int f4561_15(int x) { return x * 15; }
+inline int f4561_16(int x) { return x * 16; }
+inline int f4561_17(int x) { return x * 17; }
+inline int f4561_18(int x) { return x * 18; }
+inline int f4561_19(int x) { return x * 19; }
+inline int f4561_20(int x) { return x * 20; }
+inline int f4561_21(int x) { return x * 21; }
+inline int f4561_22(int x) { return x * 22; }
+inline int f4561_23(int x) { return x * 23; }
+inline int f4561_24(int x) { return x * 24; }
+inline int f4561_25(int x) { return x * 25; }
+inline int f4561_26(int x) { return x * 26; }
+inline int f4561_27(int x) { return x * 27; }
+inline int f4561_28(int x) { return x * 28; }
+inline int f4561_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4565 */
+#include <vector>
+#include "h8828.h"
+#include "h2455.h"
+#include "h9640.h"
+#include "h6957.h"
+#include "h1648.h"
+#ifdef X
+#include "h6567.h"
+#endif
+struct S4565 { int a; const char *s = "x//y"; };
+inline int f4565_0(int x) { return x * 0; }
+inline int f4565_1(int x) { return x * 1; }
+inline int f4565_2(int x) { return x * 2; }
+inline int f4565_3(int x) { return x * 3; }
+inline int f4565_4(int x) { return x * 4; }
+inline int f4565_5(int x) { return x * 5; }
+inline int f4565_6(int x) { return x * 6; }
+inline int f4565_7(int x) { return x * 7; }
+inline int f4565_8(int x) { return x * 8; }
+inline int f4565_9(int x) { return x * 9; }
+inline int f4565_10(int x) { return x * 10; }
+inline int f4565_11(int x) { return x * 11; }
+inline int f4565_12(int x) { return x * 12; }
+inline int f4565_13(int x) { return x * 13; }
+inline int f4565_14(int x) { return x * 14; }
+inline int f4565_15(int x) { return x * 15; }
+inline int f4565_16(int x) { return x * 16; }
+inline int f4565_17(int x) { return x * 17; }
+inline int f4565_18(int x) { return x * 18; }
+inline int f4565_19(int x) { return x * 19; }
+inline int f4565_20(int x) { return x * 20; }
+inline int f4565_21(int x) { return x * 21; }
+inline int f4565_22(int x) { return x * 22; }
+inline int f4565_23(int x) { return x * 23; }
+inline int f4565_24(int x) { return x * 24; }
+inline int f4565_25(int x) { return x * 25; }
+inline int f4565_26(int x) { return x * 26; }
+inline int f4565_27(int x) { return x * 27; }
+inline int f4565_28(int x) { return x * 28; }
+inline int f4565_29(int x) { return x * 29; }
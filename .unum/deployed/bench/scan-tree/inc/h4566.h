@@ -0,0 +1,42 @@
+#pragma once
+/* header 4566 */
+#include <vector>
+#include "h103.h"
+#include "h4022.h"
+#include "h5631.h"
+#include "h2386.h"
+#include "h2093.h"
+#ifdef X
+#include "h4586.h"
+#endif
+struct S4566 { int a; const char *s = "x//y"; };
+inline int f4566_0(int x) { return x * 0; }
+inline int f4566_1(int x) { return x * 1; }
+inline int f4566_2(int x) { return x * 2; }
+inline int f4566_3(int x) { return x * 3; }
+inline int f4566_4(int x) { return x * 4; }
+inline int f4566_5(int x) { return x * 5; }
+inline int f4566_6(int x) { return x * 6; }
+inline int f4566_7(int x) { return x * 7; }
+inline int f4566_8(int x) { return x * 8; }
+inline int f4566_9(int x) { return x * 9; }
+inline int f4566_10(int x) { return x * 10; }
+inline int f4566_11(int x) { return x * 11; }
+inline int f4566_12(int x) { return x * 12; }
+inline int f4566_13(int x) { return x * 13; }
+inline int f4566_14(int x) { return x * 14; }
+inline int f4566_15(int x) { return x * 15; }
+inline int f4566_16(int x) { return x * 16; }
+inline int f4566_17(int x) { return x * 17; }
+inline int f4566_18(int x) { return x * 18; }
+inline int f4566_19(int x) { return x * 19; }
+inline int f4566_20(int x) { return x * 20; }
+inline int f4566_21(int x) { return x * 21; }
+inline int f4566_22(int x) { return x * 22; }
+inline int f4566_23(int x) { return x * 23; }
+inline int f4566_24(int x) { return x * 24; }
+inline int f4566_25(int x) { return x * 25; }
+inline int f4566_26(int x) { return x * 26; }
+inline int f4566_27(int x) { return x * 27; }
+inline int f4566_28(int x) { return x * 28; }
+inline int f4566_29(int x) { return x * 29; }
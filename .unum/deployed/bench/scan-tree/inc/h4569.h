@@ -0,0 +1,42 @@
+#pragma once
+/* header 4569 */
+#include <vector>
+#include "h2277.h"
+#include "h7477.h"
+#include "h1389.h"
+#include "h7251.h"
+#include "h8934.h"
+#ifdef X
+#include "h4158.h"
+#endif
+struct S4569 { int a; const char *s = "x//y"; };
+inline int f4569_0(int x) { return x * 0; }
+inline int f4569_1(int x) { return x * 1; }
+inline int f4569_2(int x) { return x * 2; }
+inline int f4569_3(int x) { return x * 3; }
+inline int f4569_4(int x) { return x * 4; }
+inline int f4569_5(int x) { return x * 5; }
+inline int f4569_6(int x) { return x * 6; }
+inline int f4569_7(int x) { return x * 7; }
+inline int f4569_8(int x) { return x * 8; }
+inline int f4569_9(int x) { return x * 9; }
+inline int f4569_10(int x) { return x * 10; }
+inline int f4569_11(int x) { return x * 11; }
+inline int f4569_12(int x) { return x * 12; }
+inline int f4569_13(int x) { return x * 13; }
+inline int f4569_14(int x) { return x * 14; }
+inline int f4569_15(int x) { return x * 15; }
+inline int f4569_16(int x) { return x * 16; }
+inline int f4569_17(int x) { return x * 17; }
+inline int f4569_18(int x) { return x * 18; }
+inline int f4569_19(int x) { return x * 19; }
+inline int f4569_20(int x) { return x * 20; }
+inline int f4569_21(int x) { return x * 21; }
+inline int f4569_22(int x) { return x * 22; }
+inline int f4569_23(int x) { return x * 23; }
+inline int f4569_24(int x) { return x * 24; }
+inline int f4569_25(int x) { return x * 25; }
+inline int f4569_26(int x) { return x * 26; }
+inline int f4569_27(int x) { return x * 27; }
+inline int f4569_28(int x) { return x * 28; }
+inline int f4569_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 457 */
+#include <vector>
+#include "h6099.h"
+#include "h2943.h"
+#include "h6084.h"
+#include "h4574.h"
+#include "h5020.h"
+#ifdef X
+#include "h3023.h"
+#endif
+struct S457 { int a; const char *s = "x//y"; };
+inline int f457_0(int x) { return x * 0; }
+inline int f457_1(int x) { return x * 1; }
+inline int f457_2(int x) { return x * 2; }
+inline int f457_3(int x) { return x * 3; }
+inline int f457_4(int x) { return x * 4; }
+inline int f457_5(int x) { return x * 5; }
+inline int f457_6(int x) { return x * 6; }
+inline int f457_7(int x) { return x * 7; }
+inline int f457_8(int x) { return x * 8; }
+inline int f457_9(int x) { return x * 9; }
+inline int f457_10(int x) { return x * 10; }
+inline int f457_11(int x) { return x * 11; }
+inline int f457_12(int x) { return x * 12; }
+inline int f457_13(int x) { return x * 13; }
+inline int f457_14(int x) { return x * 14; }
+inline int f457_15(int x) { return x * 15; }
+inline int f457_16(int x) { return x * 16; }
+inline int f457_17(int x) { return x * 17; }
+inline int f457_18(int x) { return x * 18; }
+inline int f457_19(int x) { return x * 19; }
+inline int f457_20(int x) { return x * 20; }
+inline int f457_21(int x) { return x * 21; }
+inline int f457_22(int x) { return x * 22; }
+inline int f457_23(int x) { return x * 23; }
+inline int f457_24(int x) { return x * 24; }
+inline int f457_25(int x) { return x * 25; }
+inline int f457_26(int x) { return x * 26; }
+inline int f457_27(int x) { return x * 27; }
+inline int f457_28(int x) { return x * 28; }
+inline int f457_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4570 */
+#include <vector>
+#include "h1580.h"
+#include "h5263.h"
+#include "h282.h"
+#include "h4084.h"
+#include "h1136.h"
+#ifdef X
+#include "h8008.h"
+#endif
+struct S4570 { int a; const char *s = "x//y"; };
+inline int f4570_0(int x) { return x * 0; }
+inline int f4570_1(int x) { return x * 1; }
+inline int f4570_2(int x) { return x * 2; }
+inline int f4570_3(int x) { return x * 3; }
+inline int f4570_4(int x) { return x * 4; }
+inline int f4570_5(int x) { return x * 5; }
+inline int f4570_6(int x) { return x * 6; }
+inline int f4570_7(int x) { return x * 7; }
+inline int f4570_8(int x) { return x * 8; }
+inline int f4570_9(int x) { return x * 9; }
+inline int f4570_10(int x) { return x * 10; }
+inline int f4570_11(int x) { return x * 11; }
+inline int f4570_12(int x) { return x * 12; }
+inline int f4570_13(int x) { return x * 13; }
+inline int f4570_14(int x) { return x * 14; }
+inline int f4570_15(int x) { return x * 15; }
+inline int f4570_16(int x) { return x * 16; }
+inline int f4570_17(int x) { return x * 17; }
+inline int f4570_18(int x) { return x * 18; }
+inline int f4570_19(int x) { return x * 19; }
+inline int f4570_20(int x) { return x * 20; }
+inline int f4570_21(int x) { return x * 21; }
+inline int f4570_22(int x) { return x * 22; }
+inline int f4570_23(int x) { return x * 23; }
+inline int f4570_24(int x) { return x * 24; }
+inline int f4570_25(int x) { return x * 25; }
+inline int f4570_26(int x) { return x * 26; }
+inline int f4570_27(int x) { return x * 27; }
+inline int f4570_28(int x) { return x * 28; }
+inline int f4570_29(int x) { return x * 29; }
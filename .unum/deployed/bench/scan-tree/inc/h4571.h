@@ -0,0 +1,42 @@
+#pragma once
+/* header 4571 */
+#include <vector>
+#include "h5023.h"
+#include "h7922.h"
+#include "h1006.h"
+#include "h6568.h"
+#include "h209.h"
+#ifdef X
+#include "h9999.h"
+#endif
+struct S4571 { int a; const char *s = "x//y"; };
+inline int f4571_0(int x) { return x * 0; }
+inline int f4571_1(int x) { return x * 1; }
+inline int f4571_2(int x) { return x * 2; }
+inline int f4571_3(int x) { return x * 3; }
+inline int f4571_4(int x) { return x * 4; }
+inline int f4571_5(int x) { return x * 5; }
+inline int f4571_6(int x) { return x * 6; }
+inline int f4571_7(int x) { return x * 7; }
+inline int f4571_8(int x) { return x * 8; }
+inline int f4571_9(int x) { return x * 9; }
+inline int f4571_10(int x) { return x * 10; }
+inline int f4571_11(int x) { return x * 11; }
+inline int f4571_12(int x) { return x * 12; }
+inline int f4571_13(int x) { return x * 13; }
+inline int f4571_14(int x) { return x * 14; }
+inline int f4571_15(int x) { return x * 15; }
+inline int f4571_16(int x) { return x * 16; }
+inline int f4571_17(int x) { return x * 17; }
+inline int f4571_18(int x) { return x * 18; }
+inline int f4571_19(int x) { return x * 19; }
+inline int f4571_20(int x) { return x * 20; }
+inline int f4571_21(int x) { return x * 21; }
+inline int f4571_22(int x) { return x * 22; }
+inline int f4571_23(int x) { return x * 23; }
+inline int f4571_24(int x) { return x * 24; }
+inline int f4571_25(int x) { return x * 25; }
+inline int f4571_26(int x) { return x * 26; }
+inline int f4571_27(int x) { return x * 27; }
+inline int f4571_28(int x) { return x * 28; }
+inline int f4571_29(int x) { return x * 29; }
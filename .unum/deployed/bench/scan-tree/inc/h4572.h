@@ -0,0 +1,42 @@
+#pragma once
+/* header 4572 */
+#include <vector>
+#include "h6670.h"
+#include "h5904.h"
+#include "h5126.h"
+#include "h9052.h"
+#include "h4900.h"
+#ifdef X
+#include "h6656.h"
+#endif
+struct S4572 { int a; const char *s = "x//y"; };
+inline int f4572_0(int x) { return x * 0; }
+inline int f4572_1(int x) { return x * 1; }
+inline int f4572_2(int x) { return x * 2; }
+inline int f4572_3(int x) { return x * 3; }
+inline int f4572_4(int x) { return x * 4; }
+inline int f4572_5(int x) { return x * 5; }
+inline int f4572_6(int x) { return x * 6; }
+inline int f4572_7(int x) { return x * 7; }
+inline int f4572_8(int x) { return x * 8; }
+inline int f4572_9(int x) { return x * 9; }
+inline int f4572_10(int x) { return x * 10; }
+inline int f4572_11(int x) { return x * 11; }
+inline int f4572_12(int x) { return x * 12; }
+inline int f4572_13(int x) { return x * 13; }
+inline int f4572_14(int x) { return x * 14; }
+inline int f4572_15(int x) { return x * 15; }
+inline int f4572_16(int x) { return x * 16; }
+inline int f4572_17(int x) { return x * 17; }
+inline int f4572_18(int x) { return x * 18; }
+inline int f4572_19(int x) { return x * 19; }
+inline int f4572_20(int x) { return x * 20; }
+inline int f4572_21(int x) { return x * 21; }
+inline int f4572_22(int x) { return x * 22; }
+inline int f4572_23(int x) { return x * 23; }
+inline int f4572_24(int x) { return x * 24; }
+inline int f4572_25(int x) { return x * 25; }
+inline int f4572_26(int x) { return x * 26; }
+inline int f4572_27(int x) { return x * 27; }
+inline int f4572_28(int x) { return x * 28; }
+inline int f4572_29(int x) { return x * 29; }
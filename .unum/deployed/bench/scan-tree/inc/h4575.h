@@ -0,0 +1,42 @@
+#pragma once
+/* header 4575 */
+#include <vector>
+#include "h617.h"
+#include "h748.h"
+#include "h6216.h"
+#include "h8587.h"
+#include "h3635.h"
+#ifdef X
+#include "h4125.h"
+#endif
+struct S4575 { int a; const char *s = "x//y"; };
+inline int f4575_0(int x) { return x * 0; }
+inline int f4575_1(int x) { return x * 1; }
+inline int f4575_2(int x) { return x * 2; }
+inline int f4575_3(int x) { return x * 3; }
+inline int f4575_4(int x) { return x * 4; }
+inline int f4575_5(int x) { return x * 5; }
+inline int f4575_6(int x) { return x * 6; }
+inline int f4575_7(int x) { return x * 7; }
+inline int f4575_8(int x) { return x * 8; }
+inline int f4575_9(int x) { return x * 9; }
+inline int f4575_10(int x) { return x * 10; }
+inline int f4575_11(int x) { return x * 11; }
+inline int f4575_12(int x) { return x * 12; }
+inline int f4575_13(int x) { return x * 13; }
+inline int f4575_14(int x) { return x * 14; }
+inline int f4575_15(int x) { return x * 15; }
+inline int f4575_16(int x) { return x * 16; }
+inline int f4575_17(int x) { return x * 17; }
+inline int f4575_18(int x) { return x * 18; }
+inline int f4575_19(int x) { return x * 19; }
+inline int f4575_20(int x) { return x * 20; }
+inline int f4575_21(int x) { return x * 21; }
+inline int f4575_22(int x) { return x * 22; }
+inline int f4575_23(int x) { return x * 23; }
+inline int f4575_24(int x) { return x * 24; }
+inline int f4575_25(int x) { return x * 25; }
+inline int f4575_26(int x) { return x * 26; }
+inline int f4575_27(int x) { return x * 27; }
+inline int f4575_28(int x) { return x * 28; }
+inline int f4575_29(int x) { return x * 29; }
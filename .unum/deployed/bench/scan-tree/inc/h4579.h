@@ -0,0 +1,42 @@
+#pragma once
+/* header 4579 */
+#include <vector>
+#include "h5580.h"
+#include "h261.h"
+#include "h4587.h"
+#include "h4692.h"
+#include "h8140.h"
+#ifdef X
+#include "h4776.h"
+#endif
+struct S4579 { int a; const char *s = "x//y"; };
+inline int f4579_0(int x) { return x * 0; }
+inline int f4579_1(int x) { return x * 1; }
+inline int f4579_2(int x) { return x * 2; }
+inline int f4579_3(int x) { return x * 3; }
+inline int f4579_4(int x) { return x * 4; }
+inline int f4579_5(int x) { return x * 5; }
+inline int f4579_6(int x) { return x * 6; }
+inline int f4579_7(int x) { return x * 7; }
+inline int f4579_8(int x) { return x * 8; }
+inline int f4579_9(int x) { return x * 9; }
+inline int f4579_10(int x) { return x * 10; }
+inline int f4579_11(int x) { return x * 11; }
+inline int f4579_12(int x) { return x * 12; }
+inline int f4579_13(int x) { return x * 13; }
+inline int f4579_14(int x) { return x * 14; }
+inline int f4579_15(int x) { return x * 15; }
+inline int f4579_16(int x) { return x * 16; }
+inline int f4579_17(int x) { return x * 17; }
+inline int f4579_18(int x) { return x * 18; }
+inline int f4579_19(int x) { return x * 19; }
+inline int f4579_20(int x) { return x * 20; }
+inline int f4579_21(int x) { return x * 21; }
+inline int f4579_22(int x) { return x * 22; }
+inline int f4579_23(int x) { return x * 23; }
+inline int f4579_24(int x) { return x * 24; }
+inline int f4579_25(int x) { return x * 25; }
+inline int f4579_26(int x) { return x * 26; }
+inline int f4579_27(int x) { return x * 27; }
+inline int f4579_28(int x) { return x * 28; }
+inline int f4579_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4583 */
+#include <vector>
+#include "h2401.h"
+#include "h6286.h"
+#include "h4235.h"
+#include "h9302.h"
+#include "h3540.h"
+#ifdef X
+#include "h6768.h"
+#endif
+struct S4583 { int a; const char *s = "x//y"; };
+inline int f4583_0(int x) { return x * 0; }
+inline int f4583_1(int x) { return x * 1; }
+inline int f4583_2(int x) { return x * 2; }
+inline int f4583_3(int x) { return x * 3; }
+inline int f4583_4(int x) { return x * 4; }
+inline int f4583_5(int x) { return x * 5; }
+inline int f4583_6(int x) { return x * 6; }
+inline int f4583_7(int x) { return x * 7; }
+inline int f4583_8(int x) { return x * 8; }
+inline int f4583_9(int x) { return x * 9; }
+inline int f4583_10(int x) { return x * 10; }
+inline int f4583_11(int x) { return x * 11; }
+inline int f4583_12(int x) { return x * 12; }
+inline int f4583_13(int x) { return x * 13; }
+inline int f4583_14(int x) { return x * 14; }
+inline int f4583_15(int x) { return x * 15; }
+inline int f4583_16(int x) { return x * 16; }
+inline int f4583_17(int x) { return x * 17; }
+inline int f4583_18(int x) { return x * 18; }
+inline int f4583_19(int x) { return x * 19; }
+inline int f4583_20(int x) { return x * 20; }
+inline int f4583_21(int x) { return x * 21; }
+inline int f4583_22(int x) { return x * 22; }
+inline int f4583_23(int x) { return x * 23; }
+inline int f4583_24(int x) { return x * 24; }
+inline int f4583_25(int x) { return x * 25; }
+inline int f4583_26(int x) { return x * 26; }
+inline int f4583_27(int x) { return x * 27; }
+inline int f4583_28(int x) { return x * 28; }
+inline int f4583_29(int x) { return x * 29; }
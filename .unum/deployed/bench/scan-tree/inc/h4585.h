@@ -0,0 +1,42 @@
+#pragma once
+/* header 4585 */
+#include <vector>
+#include "h2829.h"
+#include "h3431.h"
+#include "h1537.h"
+#include "h3388.h"
+#include "h6178.h"
+#ifdef X
+#include "h54.h"
+#endif
+struct S4585 { int a; const char *s = "x//y"; };
+inline int f4585_0(int x) { return x * 0; }
+inline int f4585_1(int x) { return x * 1; }
+inline int f4585_2(int x) { return x * 2; }
+inline int f4585_3(int x) { return x * 3; }
+inline int f4585_4(int x) { return x * 4; }
+inline int f4585_5(int x) { return x * 5; }
+inline int f4585_6(int x) { return x * 6; }
+inline int f4585_7(int x) { return x * 7; }
+inline int f4585_8(int x) { return x * 8; }
+inline int f4585_9(int x) { return x * 9; }
+inline int f4585_10(int x) { return x * 10; }
+inline int f4585_11(int x) { return x * 11; }
+inline int f4585_12(int x) { return x * 12; }
+inline int f4585_13(int x) { return x * 13; }
+inline int f4585_14(int x) { return x * 14; }
+inline int f4585_15(int x) { return x * 15; }
+inline int f4585_16(int x) { return x * 16; }
+inline int f4585_17(int x) { return x * 17; }
+inline int f4585_18(int x) { return x * 18; }
+inline int f4585_19(int x) { return x * 19; }
+inline int f4585_20(int x) { return x * 20; }
+inline int f4585_21(int x) { return x * 21; }
+inline int f4585_22(int x) { return x * 22; }
+inline int f4585_23(int x) { return x * 23; }
+inline int f4585_24(int x) { return x * 24; }
+inline int f4585_25(int x) { return x * 25; }
+inline int f4585_26(int x) { return x * 26; }
+inline int f4585_27(int x) { return x * 27; }
+inline int f4585_28(int x) { return x * 28; }
+inline int f4585_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4586 */
+#include <vector>
+#include "h2195.h"
+#include "h37.h"
+#include "h8250.h"
+#include "h4328.h"
+#include "h6813.h"
+#ifdef X
+#include "h8086.h"
+#endif
+struct S4586 { int a; const char *s = "x//y"; };
+inline int f4586_0(int x) { return x * 0; }
+inline int f4586_1(int x) { return x * 1; }
+inline int f4586_2(int x) { return x * 2; }
+inline int f4586_3(int x) { return x * 3; }
+inline int f4586_4(int x) { return x * 4; }
+inline int f4586_5(int x) { return x * 5; }
+inline int f4586_6(int x) { return x * 6; }
+inline int f4586_7(int x) { return x * 7; }
+inline int f4586_8(int x) { return x * 8; }
+inline int f4586_9(int x) { return x * 9; }
+inline int f4586_10(int x) { return x * 10; }
+inline int f4586_11(int x) { return x * 11; }
+inline int f4586_12(int x) { return x * 12; }
+inline int f4586_13(int x) { return x * 13; }
+inline int f4586_14(int x) { return x * 14; }
+inline int f4586_15(int x) { return x * 15; }
+inline int f4586_16(int x) { return x * 16; }
+inline int f4586_17(int x) { return x * 17; }
+inline int f4586_18(int x) { return x * 18; }
+inline int f4586_19(int x) { return x * 19; }
+inline int f4586_20(int x) { return x * 20; }
+inline int f4586_21(int x) { return x * 21; }
+inline int f4586_22(int x) { return x * 22; }
+inline int f4586_23(int x) { return x * 23; }
+inline int f4586_24(int x) { return x * 24; }
+inline int f4586_25(int x) { return x * 25; }
+inline int f4586_26(int x) { return x * 26; }
+inline int f4586_27(int x) { return x * 27; }
+inline int f4586_28(int x) { return x * 28; }
+inline int f4586_29(int x) { return x * 29; }
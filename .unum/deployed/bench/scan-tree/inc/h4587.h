@@ -0,0 +1,42 @@
+#pragma once
+/* header 4587 */
+#include <vector>
+#include "h71.h"
+#include "h6572.h"
+#include "h8660.h"
+#include "h4943.h"
+#include "h1522.h"
+#ifdef X
+#include "h6019.h"
+#endif
+struct S4587 { int a; const char *s = "x//y"; };
+inline int f4587_0(int x) { return x * 0; }
+inline int f4587_1(int x) { return x * 1; }
+inline int f4587_2(int x) { return x * 2; }
+inline int f4587_3(int x) { return x * 3; }
+inline int f4587_4(int x) { return x * 4; }
+inline int f4587_5(int x) { return x * 5; }
+inline int f4587_6(int x) { return x * 6; }
+inline int f4587_7(int x) { return x * 7; }
+inline int f4587_8(int x) { return x * 8; }
+inline int f4587_9(int x) { return x * 9; }
+inline int f4587_10(int x) { return x * 10; }
+inline int f4587_11(int x) { return x * 11; }
+inline int f4587_12(int x) { return x * 12; }
+inline int f4587_13(int x) { return x * 13; }
+inline int f4587_14(int x) { return x * 14; }
+inline int f4587_15(int x) { return x * 15; }
+inline int f4587_16(int x) { return x * 16; }
+inline int f4587_17(int x) { return x * 17; }
+inline int f4587_18(int x) { return x * 18; }
+inline int f4587_19(int x) { return x * 19; }
+inline int f4587_20(int x) { return x * 20; }
+inline int f4587_21(int x) { return x * 21; }
+inline int f4587_22(int x) { return x * 22; }
+inline int f4587_23(int x) { return x * 23; }
+inline int f4587_24(int x) { return x * 24; }
+inline int f4587_25(int x) { return x * 25; }
+inline int f4587_26(int x) { return x * 26; }
+inline int f4587_27(int x) { return x * 27; }
+inline int f4587_28(int x) { return x * 28; }
+inline int f4587_29(int x) { return x * 29; }
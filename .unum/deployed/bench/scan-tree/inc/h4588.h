@@ -0,0 +1,42 @@
+#pragma once
+/* header 4588 */
+#include <vector>
+#include "h8330.h"
+#include "h2739.h"
+#include "h2622.h"
+#include "h8459.h"
+#include "h9134.h"
+#ifdef X
+#include "h6998.h"
+#endif
+struct S4588 { int a; const char *s = "x//y"; };
+inline int f4588_0(int x) { return x * 0; }
+inline int f4588_1(int x) { return x * 1; }
+inline int f4588_2(int x) { return x * 2; }
+inline int f4588_3(int x) { return x * 3; }
+inline int f4588_4(int x) { return x * 4; }
+inline int f4588_5(int x) { return x * 5; }
+inline int f4588_6(int x) { return x * 6; }
+inline int f4588_7(int x) { return x * 7; }
+inline int f4588_8(int x) { return x * 8; }
+inline int f4588_9(int x) { return x * 9; }
+inline int f4588_10(int x) { return x * 10; }
+inline int f4588_11(int x) { return x * 11; }
+inline int f4588_12(int x) { return x * 12; }
+inline int f4588_13(int x) { return x * 13; }
+inline int f4588_14(int x) { return x * 14; }
+inline int f4588_15(int x) { return x * 15; }
+inline int f4588_16(int x) { return x * 16; }
+inline int f4588_17(int x) { return x * 17; }
+inline int f4588_18(int x) { return x * 18; }
+inline int f4588_19(int x) { return x * 19; }
+inline int f4588_20(int x) { return x * 20; }
+inline int f4588_21(int x) { return x * 21; }
+inline int f4588_22(int x) { return x * 22; }
+inline int f4588_23(int x) { return x * 23; }
+inline int f4588_24(int x) { return x * 24; }
+inline int f4588_25(int x) { return x * 25; }
+inline int f4588_26(int x) { return x * 26; }
+inline int f4588_27(int x) { return x * 27; }
+inline int f4588_28(int x) { return x * 28; }
+inline int f4588_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4591 */
+#include <vector>
+#include "h2501.h"
+#include "h4703.h"
+#include "h6350.h"
+#include "h2507.h"
+#include "h6517.h"
+#ifdef X
+#include "h7962.h"
+#endif
+struct S4591 { int a; const char *s = "x//y"; };
+inline int f4591_0(int x) { return x * 0; }
+inline int f4591_1(int x) { return x * 1; }
+inline int f4591_2(int x) { return x * 2; }
+inline int f4591_3(int x) { return x * 3; }
+inline int f4591_4(int x) { return x * 4; }
+inline int f4591_5(int x) { return x * 5; }
+inline int f4591_6(int x) { return x * 6; }
+inline int f4591_7(int x) { return x * 7; }
+inline int f4591_8(int x) { return x * 8; }
+inline int f4591_9(int x) { return x * 9; }
+inline int f4591_10(int x) { return x * 10; }
+inline int f4591_11(int x) { return x * 11; }
+inline int f4591_12(int x) { return x * 12; }
+inline int f4591_13(int x) { return x * 13; }
+inline int f4591_14(int x) { return x * 14; }
+inline int f4591_15(int x) { return x * 15; }
+inline int f4591_16(int x) { return x * 16; }
+inline int f4591_17(int x) { return x * 17; }
+inline int f4591_18(int x) { return x * 18; }
+inline int f4591_19(int x) { return x * 19; }
+inline int f4591_20(int x) { return x * 20; }
+inline int f4591_21(int x) { return x * 21; }
+inline int f4591_22(int x) { return x * 22; }
+inline int f4591_23(int x) { return x * 23; }
+inline int f4591_24(int x) { return x * 24; }
+inline int f4591_25(int x) { return x * 25; }
+inline int f4591_26(int x) { return x * 26; }
+inline int f4591_27(int x) { return x * 27; }
+inline int f4591_28(int x) { return x * 28; }
+inline int f4591_29(int x) { return x * 29; }
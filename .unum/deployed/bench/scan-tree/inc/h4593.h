@@ -0,0 +1,42 @@
+#pragma once
+/* header 4593 */
+#include <vector>
+#include "h9399.h"
+#include "h8611.h"
+#include "h2080.h"
+#include "h5691.h"
+#include "h3015.h"
+#ifdef X
+#include "h6401.h"
+#endif
+struct S4593 { int a; const char *s = "x//y"; };
+inline int f4593_0(int x) { return x * 0; }
+inline int f4593_1(int x) { return x * 1; }
+inline int f4593_2(int x) { return x * 2; }
+inline int f4593_3(int x) { return x * 3; }
+inline int f4593_4(int x) { return x * 4; }
+inline int f4593_5(int x) { return x * 5; }
+inline int f4593_6(int x) { return x * 6; }
+inline int f4593_7(int x) { return x * 7; }
+inline int f4593_8(int x) { return x * 8; }
+inline int f4593_9(int x) { return x * 9; }
+inline int f4593_10(int x) { return x * 10; }
+inline int f4593_11(int x) { return x * 11; }
+inline int f4593_12(int x) { return x * 12; }
+inline int f4593_13(int x) { return x * 13; }
+inline int f4593_14(int x) { return x * 14; }
+inline int f4593_15(int x) { return x * 15; }
+inline int f4593_16(int x) { return x * 16; }
+inline int f4593_17(int x) { return x * 17; }
+inline int f4593_18(int x) { return x * 18; }
+inline int f4593_19(int x) { return x * 19; }
+inline int f4593_20(int x) { return x * 20; }
+inline int f4593_21(int x) { return x * 21; }
+inline int f4593_22(int x) { return x * 22; }
+inline int f4593_23(int x) { return x * 23; }
+inline int f4593_24(int x) { return x * 24; }
+inline int f4593_25(int x) { return x * 25; }
+inline int f4593_26(int x) { return x * 26; }
+inline int f4593_27(int x) { return x * 27; }
+inline int f4593_28(int x) { return x * 28; }
+inline int f4593_29(int x) { return x * 29; }
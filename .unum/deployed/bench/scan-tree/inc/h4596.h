@@ -0,0 +1,42 @@
+#pragma once
+/* header 4596 */
+#include <vector>
+#include "h6691.h"
+#include "h4696.h"
+#include "h1486.h"
+#include "h4568.h"
+#include "h5454.h"
+#ifdef X
+#include "h4048.h"
+#endif
+struct S4596 { int a; const char *s = "x//y"; };
+inline int f4596_0(int x) { return x * 0; }
+inline int f4596_1(int x) { return x * 1; }
+inline int f4596_2(int x) { return x * 2; }
+inline int f4596_3(int x) { return x * 3; }
+inline int f4596_4(int x) { return x * 4; }
+inline int f4596_5(int x) { return x * 5; }
+inline int f4596_6(int x) { return x * 6; }
+inline int f4596_7(int x) { return x * 7; }
+inline int f4596_8(int x) { return x * 8; }
+inline int f4596_9(int x) { return x * 9; }
+inline int f4596_10(int x) { return x * 10; }
+inline int f4596_11(int x) { return x * 11; }
+inline int f4596_12(int x) { return x * 12; }
+inline int f4596_13(int x) { return x * 13; }
+inline int f4596_14(int x) { return x * 14; }
+inline int f4596_15(int x) { return x * 15; }
+inline int f4596_16(int x) { return x * 16; }
+inline int f4596_17(int x) { return x * 17; }
+inline int f4596_18(int x) { return x * 18; }
+inline int f4596_19(int x) { return x * 19; }
+inline int f4596_20(int x) { return x * 20; }
+inline int f4596_21(int x) { return x * 21; }
+inline int f4596_22(int x) { return x * 22; }
+inline int f4596_23(int x) { return x * 23; }
+inline int f4596_24(int x) { return x * 24; }
+inline int f4596_25(int x) { return x * 25; }
+inline int f4596_26(int x) { return x * 26; }
+inline int f4596_27(int x) { return x * 27; }
+inline int f4596_28(int x) { return x * 28; }
+inline int f4596_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 46 */
+#include <vector>
+#include "h2418.h"
+#include "h2693.h"
+#include "h6594.h"
+#include "h7920.h"
+#include "h480.h"
+#ifdef X
+#include "h1705.h"
+#endif
+struct S46 { int a; const char *s = "x//y"; };
+inline int f46_0(int x) { return x * 0; }
+inline int f46_1(int x) { return x * 1; }
+inline int f46_2(int x) { return x * 2; }
+inline int f46_3(int x) { return x * 3; }
+inline int f46_4(int x) { return x * 4; }
+inline int f46_5(int x) { return x * 5; }
+inline int f46_6(int x) { return x * 6; }
+inline int f46_7(int x) { return x * 7; }
+inline int f46_8(int x) { return x * 8; }
+inline int f46_9(int x) { return x * 9; }
+inline int f46_10(int x) { return x * 10; }
+inline int f46_11(int x) { return x * 11; }
+inline int f46_12(int x) { return x * 12; }
+inline int f46_13(int x) { return x * 13; }
+inline int f46_14(int x) { return x * 14; }
+inline int f46_15(int x) { return x * 15; }
+inline int f46_16(int x) { return x * 16; }
+inline int f46_17(int x) { return x * 17; }
+inline int f46_18(int x) { return x * 18; }
+inline int f46_19(int x) { return x * 19; }
+inline int f46_20(int x) { return x * 20; }
+inline int f46_21(int x) { return x * 21; }
+inline int f46_22(int x) { return x * 22; }
+inline int f46_23(int x) { return x * 23; }
+inline int f46_24(int x) { return x * 24; }
+inline int f46_25(int x) { return x * 25; }
+inline int f46_26(int x) { return x * 26; }
+inline int f46_27(int x) { return x * 27; }
+inline int f46_28(int x) { return x * 28; }
+inline int f46_29(int x) { return x * 29; }
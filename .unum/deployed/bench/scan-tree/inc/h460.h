@@ -0,0 +1,42 @@
+#pragma once
+/* header 460 */
+#include <vector>
+#include "h9213.h"
+#include "h1775.h"
+#include "h9780.h"
+#include "h1933.h"
+#include "h5798.h"
+#ifdef X
+#include "h324.h"
+#endif
+struct S460 { int a; const char *s = "x//y"; };
+inline int f460_0(int x) { return x * 0; }
+inline int f460_1(int x) { return x * 1; }
+inline int f460_2(int x) { return x * 2; }
+inline int f460_3(int x) { return x * 3; }
+inline int f460_4(int x) { return x * 4; }
+inline int f460_5(int x) { return x * 5; }
+inline int f460_6(int x) { return x * 6; }
+inline int f460_7(int x) { return x * 7; }
+inline int f460_8(int x) { return x * 8; }
+inline int f460_9(int x) { return x * 9; }
+inline int f460_10(int x) { return x * 10; }
+inline int f460_11(int x) { return x * 11; }
+inline int f460_12(int x) { return x * 12; }
+inline int f460_13(int x) { return x * 13; }
+inline int f460_14(int x) { return x * 14; }
+inline int f460_15(int x) { return x * 15; }
+inline int f460_16(int x) { return x * 16; }
+inline int f460_17(int x) { return x * 17; }
+inline int f460_18(int x) { return x * 18; }
+inline int f460_19(int x) { return x * 19; }
+inline int f460_20(int x) { return x * 20; }
+inline int f460_21(int x) { return x * 21; }
+inline int f460_22(int x) { return x * 22; }
+inline int f460_23(int x) { return x * 23; }
+inline int f460_24(int x) { return x * 24; }
+inline int f460_25(int x) { return x * 25; }
+inline int f460_26(int x) { return x * 26; }
+inline int f460_27(int x) { return x * 27; }
+inline int f460_28(int x) { return x * 28; }
+inline int f460_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4600 */
+#include <vector>
+#include "h7424.h"
+#include "h191.h"
+#include "h7398.h"
+#include "h4522.h"
+#include "h1077.h"
+#ifdef X
+#include "h5651.h"
+#endif
+struct S4600 { int a; const char *s = "x//y"; };
+inline int f4600_0(int x) { return x * 0; }
+inline int f4600_1(int x) { return x * 1; }
+inline int f4600_2(int x) { return x * 2; }
+inline int f4600_3(int x) { return x * 3; }
+inline int f4600_4(int x) { return x * 4; }
+inline int f4600_5(int x) { return x * 5; }
+inline int f4600_6(int x) { return x * 6; }
+inline int f4600_7(int x) { return x * 7; }
+inline int f4600_8(int x) { return x * 8; }
+inline int f4600_9(int x) { return x * 9; }
+inline int f4600_10(int x) { return x * 10; }
+inline int f4600_11(int x) { return x * 11; }
+inline int f4600_12(int x) { return x * 12; }
+inline int f4600_13(int x) { return x * 13; }
+inline int f4600_14(int x) { return x * 14; }
+inline int f4600_15(int x) { return x * 15; }
+inline int f4600_16(int x) { return x * 16; }
+inline int f4600_17(int x) { return x * 17; }
+inline int f4600_18(int x) { return x * 18; }
+inline int f4600_19(int x) { return x * 19; }
+inline int f4600_20(int x) { return x * 20; }
+inline int f4600_21(int x) { return x * 21; }
+inline int f4600_22(int x) { return x * 22; }
+inline int f4600_23(int x) { return x * 23; }
+inline int f4600_24(int x) { return x * 24; }
+inline int f4600_25(int x) { return x * 25; }
+inline int f4600_26(int x) { return x * 26; }
+inline int f4600_27(int x) { return x * 27; }
+inline int f4600_28(int x) { return x * 28; }
+inline int f4600_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4602 */
+#include <vector>
+#include "h8722.h"
+#include "h9830.h"
+#include "h2883.h"
+#include "h7570.h"
+#include "h4893.h"
+#ifdef X
+#include "h9955.h"
+#endif
+struct S4602 { int a; const char *s = "x//y"; };
+inline int f4602_0(int x) { return x * 0; }
+inline int f4602_1(int x) { return x * 1; }
+inline int f4602_2(int x) { return x * 2; }
+inline int f4602_3(int x) { return x * 3; }
+inline int f4602_4(int x) { return x * 4; }
+inline int f4602_5(int x) { return x * 5; }
+inline int f4602_6(int x) { return x * 6; }
+inline int f4602_7(int x) { return x * 7; }
+inline int f4602_8(int x) { return x * 8; }
+inline int f4602_9(int x) { return x * 9; }
+inline int f4602_10(int x) { return x * 10; }
+inline int f4602_11(int x) { return x * 11; }
+inline int f4602_12(int x) { return x * 12; }
+inline int f4602_13(int x) { return x * 13; }
+inline int f4602_14(int x) { return x * 14; }
+inline int f4602_15(int x) { return x * 15; }
+inline int f4602_16(int x) { return x * 16; }
+inline int f4602_17(int x) { return x * 17; }
+inline int f4602_18(int x) { return x * 18; }
+inline int f4602_19(int x) { return x * 19; }
+inline int f4602_20(int x) { return x * 20; }
+inline int f4602_21(int x) { return x * 21; }
+inline int f4602_22(int x) { return x * 22; }
+inline int f4602_23(int x) { return x * 23; }
+inline int f4602_24(int x) { return x * 24; }
+inline int f4602_25(int x) { return x * 25; }
+inline int f4602_26(int x) { return x * 26; }
+inline int f4602_27(int x) { return x * 27; }
+inline int f4602_28(int x) { return x * 28; }
+inline int f4602_29(int x) { return x * 29; }
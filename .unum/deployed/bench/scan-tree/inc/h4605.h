@@ -0,0 +1,42 @@
+#pragma once
+/* header 4605 */
+#include <vector>
+#include "h1556.h"
+#include "h8646.h"
+#include "h6561.h"
+#include "h9967.h"
+#include "h2840.h"
+#ifdef X
+#include "h5539.h"
+#endif
+struct S4605 { int a; const char *s = "x//y"; };
+inline int f4605_0(int x) { return x * 0; }
+inline int f4605_1(int x) { return x * 1; }
+inline int f4605_2(int x) { return x * 2; }
+inline int f4605_3(int x) { return x * 3; }
+inline int f4605_4(int x) { return x * 4; }
+inline int f4605_5(int x) { return x * 5; }
+inline int f4605_6(int x) { return x * 6; }
+inline int f4605_7(int x) { return x * 7; }
+inline int f4605_8(int x) { return x * 8; }
+inline int f4605_9(int x) { return x * 9; }
+inline int f4605_10(int x) { return x * 10; }
+inline int f4605_11(int x) { return x * 11; }
+inline int f4605_12(int x) { return x * 12; }
+inline int f4605_13(int x) { return x * 13; }
+inline int f4605_14(int x) { return x * 14; }
+inline int f4605_15(int x) { return x * 15; }
+inline int f4605_16(int x) { return x * 16; }
+inline int f4605_17(int x) { return x * 17; }
+inline int f4605_18(int x) { return x * 18; }
+inline int f4605_19(int x) { return x * 19; }
+inline int f4605_20(int x) { return x * 20; }
+inline int f4605_21(int x) { return x * 21; }
+inline int f4605_22(int x) { return x * 22; }
+inline int f4605_23(int x) { return x * 23; }
+inline int f4605_24(int x) { return x * 24; }
+inline int f4605_25(int x) { return x * 25; }
+inline int f4605_26(int x) { return x * 26; }
+inline int f4605_27(int x) { return x * 27; }
+inline int f4605_28(int x) { return x * 28; }
+inline int f4605_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4608 */
+#include <vector>
+#include "h4199.h"
+#include "h861.h"
+#include "h437.h"
+#include "h2023.h"
+#include "h5353.h"
+#ifdef X
+#include "h2993.h"
+#endif
+struct S4608 { int a; const char *s = "x//y"; };
+inline int f4608_0(int x) { return x * 0; }
+inline int f4608_1(int x) { return x * 1; }
+inline int f4608_2(int x) { return x * 2; }
+inline int f4608_3(int x) { return x * 3; }
+inline int f4608_4(int x) { return x * 4; }
+inline int f4608_5(int x) { return x * 5; }
+inline int f4608_6(int x) { return x * 6; }
+inline int f4608_7(int x) { return x * 7; }
+inline int f4608_8(int x) { return x * 8; }
+inline int f4608_9(int x) { return x * 9; }
+inline int f4608_10(int x) { return x * 10; }
+inline int f4608_11(int x) { return x * 11; }
+inline int f4608_12(int x) { return x * 12; }
+inline int f4608_13(int x) { return x * 13; }
+inline int f4608_14(int x) { return x * 14; }
+inline int f4608_15(int x) { return x * 15; }
+inline int f4608_16(int x) { return x * 16; }
+inline int f4608_17(int x) { return x * 17; }
+inline int f4608_18(int x) { return x * 18; }
+inline int f4608_19(int x) { return x * 19; }
+inline int f4608_20(int x) { return x * 20; }
+inline int f4608_21(int x) { return x * 21; }
+inline int f4608_22(int x) { return x * 22; }
+inline int f4608_23(int x) { return x * 23; }
+inline int f4608_24(int x) { return x * 24; }
+inline int f4608_25(int x) { return x * 25; }
+inline int f4608_26(int x) { return x * 26; }
+inline int f4608_27(int x) { return x * 27; }
+inline int f4608_28(int x) { return x * 28; }
+inline int f4608_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4609 */
+#include <vector>
+#include "h5210.h"
+#include "h871.h"
+#include "h5549.h"
+#include "h8360.h"
+#include "h6976.h"
+#ifdef X
+#include "h2229.h"
+#endif
+struct S4609 { int a; const char *s = "x//y"; };
+inline int f4609_0(int x) { return x * 0; }
+inline int f4609_1(int x) { return x * 1; }
+inline int f4609_2(int x) { return x * 2; }
+inline int f4609_3(int x) { return x * 3; }
+inline int f4609_4(int x) { return x * 4; }
+inline int f4609_5(int x) { return x * 5; }
+inline int f4609_6(int x) { return x * 6; }
+inline int f4609_7(int x) { return x * 7; }
+inline int f4609_8(int x) { return x * 8; }
+inline int f4609_9(int x) { return x * 9; }
+inline int f4609_10(int x) { return x * 10; }
+inline int f4609_11(int x) { return x * 11; }
+inline int f4609_12(int x) { return x * 12; }
+inline int f4609_13(int x) { return x * 13; }
+inline int f4609_14(int x) { return x * 14; }
+inline int f4609_15(int x) { return x * 15; }
+inline int f4609_16(int x) { return x * 16; }
+inline int f4609_17(int x) { return x * 17; }
+inline int f4609_18(int x) { return x * 18; }
+inline int f4609_19(int x) { return x * 19; }
+inline int f4609_20(int x) { return x * 20; }
+inline int f4609_21(int x) { return x * 21; }
+inline int f4609_22(int x) { return x * 22; }
+inline int f4609_23(int x) { return x * 23; }
+inline int f4609_24(int x) { return x * 24; }
+inline int f4609_25(int x) { return x * 25; }
+inline int f4609_26(int x) { return x * 26; }
+inline int f4609_27(int x) { return x * 27; }
+inline int f4609_28(int x) { return x * 28; }
+inline int f4609_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 461 */
+#include <vector>
+#include "h1606.h"
+#include "h5180.h"
+#include "h3079.h"
+#include "h4594.h"
+#include "h1108.h"
+#ifdef X
+#include "h3856.h"
+#endif
+struct S461 { int a; const char *s = "x//y"; };
+inline int f461_0(int x) { return x * 0; }
+inline int f461_1(int x) { return x * 1; }
+inline int f461_2(int x) { return x * 2; }
+inline int f461_3(int x) { return x * 3; }
+inline int f461_4(int x) { return x * 4; }
+inline int f461_5(int x) { return x * 5; }
+inline int f461_6(int x) { return x * 6; }
+inline int f461_7(int x) { return x * 7; }
+inline int f461_8(int x) { return x * 8; }
+inline int f461_9(int x) { return x * 9; }
+inline int f461_10(int x) { return x * 10; }
+inline int f461_11(int x) { return x * 11; }
+inline int f461_12(int x) { return x * 12; }
+inline int f461_13(int x) { return x * 13; }
+inline int f461_14(int x) { return x * 14; }
+inline int f461_15(int x) { return x * 15; }
+inline int f461_16(int x) { return x * 16; }
+inline int f461_17(int x) { return x * 17; }
+inline int f461_18(int x) { return x * 18; }
+inline int f461_19(int x) { return x * 19; }
+inline int f461_20(int x) { return x * 20; }
+inline int f461_21(int x) { return x * 21; }
+inline int f461_22(int x) { return x * 22; }
+inline int f461_23(int x) { return x * 23; }
+inline int f461_24(int x) { return x * 24; }
+inline int f461_25(int x) { return x * 25; }
+inline int f461_26(int x) { return x * 26; }
+inline int f461_27(int x) { return x * 27; }
+inline int f461_28(int x) { return x * 28; }
+inline int f461_29(int x) { return x * 29; }
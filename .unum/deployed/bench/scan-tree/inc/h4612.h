@@ -0,0 +1,42 @@
+#pragma once
+/* header 4612 */
+#include <vector>
+#include "h9721.h"
+#include "h2370.h"
+#include "h3795.h"
+#include "h8733.h"
+#include "h8525.h"
+#ifdef X
+#include "h5782.h"
+#endif
+struct S4612 { int a; const char *s = "x//y"; };
+inline int f4612_0(int x) { return x * 0; }
+inline int f4612_1(int x) { return x * 1; }
+inline int f4612_2(int x) { return x * 2; }
+inline int f4612_3(int x) { return x * 3; }
+inline int f4612_4(int x) { return x * 4; }
+inline int f4612_5(int x) { return x * 5; }
+inline int f4612_6(int x) { return x * 6; }
+inline int f4612_7(int x) { return x * 7; }
+inline int f4612_8(int x) { return x * 8; }
+inline int f4612_9(int x) { return x * 9; }
+inline int f4612_10(int x) { return x * 10; }
+inline int f4612_11(int x) { return x * 11; }
+inline int f4612_12(int x) { return x * 12; }
+inline int f4612_13(int x) { return x * 13; }
+inline int f4612_14(int x) { return x * 14; }
+inline int f4612_15(int x) { return x * 15; }
+inline int f4612_16(int x) { return x * 16; }
+inline int f4612_17(int x) { return x * 17; }
+inline int f4612_18(int x) { return x * 18; }
+inline int f4612_19(int x) { return x * 19; }
+inline int f4612_20(int x) { return x * 20; }
+inline int f4612_21(int x) { return x * 21; }
+inline int f4612_22(int x) { return x * 22; }
+inline int f4612_23(int x) { return x * 23; }
+inline int f4612_24(int x) { return x * 24; }
+inline int f4612_25(int x) { return x * 25; }
+inline int f4612_26(int x) { return x * 26; }
+inline int f4612_27(int x) { return x * 27; }
+inline int f4612_28(int x) { return x * 28; }
+inline int f4612_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4613 */
+#include <vector>
+#include "h5719.h"
+#include "h8841.h"
+#include "h4198.h"
+#include "h189.h"
+#include "h3596.h"
+#ifdef X
+#include "h1793.h"
+#endif
+struct S4613 { int a; const char *s = "x//y"; };
+inline int f4613_0(int x) { return x * 0; }
+inline int f4613_1(int x) { return x * 1; }
+inline int f4613_2(int x) { return x * 2; }
+inline int f4613_3(int x) { return x * 3; }
+inline int f4613_4(int x) { return x * 4; }
+inline int f4613_5(int x) { return x * 5; }
+inline int f4613_6(int x) { return x * 6; }
+inline int f4613_7(int x) { return x * 7; }
+inline int f4613_8(int x) { return x * 8; }
+inline int f4613_9(int x) { return x * 9; }
+inline int f4613_10(int x) { return x * 10; }
+inline int f4613_11(int x) { return x * 11; }
+inline int f4613_12(int x) { return x * 12; }
+inline int f4613_13(int x) { return x * 13; }
+inline int f4613_14(int x) { return x * 14; }
+inline int f4613_15(int x) { return x * 15; }
+inline int f4613_16(int x) { return x * 16; }
+inline int f4613_17(int x) { return x * 17; }
+inline int f4613_18(int x) { return x * 18; }
+inline int f4613_19(int x) { return x * 19; }
+inline int f4613_20(int x) { return x * 20; }
+inline int f4613_21(int x) { return x * 21; }
+inline int f4613_22(int x) { return x * 22; }
+inline int f4613_23(int x) { return x * 23; }
+inline int f4613_24(int x) { return x * 24; }
+inline int f4613_25(int x) { return x * 25; }
+inline int f4613_26(int x) { return x * 26; }
+inline int f4613_27(int x) { return x * 27; }
+inline int f4613_28(int x) { return x * 28; }
+inline int f4613_29(int x) { return x * 29; }
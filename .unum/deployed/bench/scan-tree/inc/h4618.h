@@ -0,0 +1,42 @@
+#pragma once
+/* header 4618 */
+#include <vector>
+#include "h1620.h"
+#include "h6718.h"
+#include "h9321.h"
+#include "h8677.h"
+#include "h9381.h"
+#ifdef X
+#include "h8336.h"
+#endif
+struct S4618 { int a; const char *s = "x//y"; };
+inline int f4618_0(int x) { return x * 0; }
+inline int f4618_1(int x) { return x * 1; }
+inline int f4618_2(int x) { return x * 2; }
+inline int f4618_3(int x) { return x * 3; }
+inline int f4618_4(int x) { return x * 4; }
+inline int f4618_5(int x) { return x * 5; }
+inline int f4618_6(int x) { return x * 6; }
+inline int f4618_7(int x) { return x * 7; }
+inline int f4618_8(int x) { return x * 8; }
+inline int f4618_9(int x) { return x * 9; }
+inline int f4618_10(int x) { return x * 10; }
+inline int f4618_11(int x) { return x * 11; }
+inline int f4618_12(int x) { return x * 12; }
+inline int f4618_13(int x) { return x * 13; }
+inline int f4618_14(int x) { return x * 14; }
+inline int f4618_15(int x) { return x * 15; }
+inline int f4618_16(int x) { return x * 16; }
+inline int f4618_17(int x) { return x * 17; }
+inline int f4618_18(int x) { return x * 18; }
+inline int f4618_19(int x) { return x * 19; }
+inline int f4618_20(int x) { return x * 20; }
+inline int f4618_21(int x) { return x * 21; }
+inline int f4618_22(int x) { return x * 22; }
+inline int f4618_23(int x) { return x * 23; }
+inline int f4618_24(int x) { return x * 24; }
+inline int f4618_25(int x) { return x * 25; }
+inline int f4618_26(int x) { return x * 26; }
+inline int f4618_27(int x) { return x * 27; }
+inline int f4618_28(int x) { return x * 28; }
+inline int f4618_29(int x) { return x * 29; }
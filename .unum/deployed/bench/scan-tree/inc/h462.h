@@ -0,0 +1,42 @@
+#pragma once
+/* header 462 */
+#include <vector>
+#include "h221.h"
+#include "h3842.h"
+#include "h6376.h"
+#include "h1987.h"
+#include "h1422.h"
+#ifdef X
+#include "h3706.h"
+#endif
+struct S462 { int a; const char *s = "x//y"; };
+inline int f462_0(int x) { return x * 0; }
+inline int f462_1(int x) { return x * 1; }
+inline int f462_2(int x) { return x * 2; }
+inline int f462_3(int x) { return x * 3; }
+inline int f462_4(int x) { return x * 4; }
+inline int f462_5(int x) { return x * 5; }
+inline int f462_6(int x) { return x * 6; }
+inline int f462_7(int x) { return x * 7; }
+inline int f462_8(int x) { return x * 8; }
+inline int f462_9(int x) { return x * 9; }
+inline int f462_10(int x) { return x * 10; }
+inline int f462_11(int x) { return x * 11; }
+inline int f462_12(int x) { return x * 12; }
+inline int f462_13(int x) { return x * 13; }
+inline int f462_14(int x) { return x * 14; }
+inline int f462_15(int x) { return x * 15; }
+inline int f462_16(int x) { return x * 16; }
+inline int f462_17(int x) { return x * 17; }
+inline int f462_18(int x) { return x * 18; }
+inline int f462_19(int x) { return x * 19; }
+inline int f462_20(int x) { return x * 20; }
+inline int f462_21(int x) { return x * 21; }
+inline int f462_22(int x) { return x * 22; }
+inline int f462_23(int x) { return x * 23; }
+inline int f462_24(int x) { return x * 24; }
+inline int f462_25(int x) { return x * 25; }
+inline int f462_26(int x) { return x * 26; }
+inline int f462_27(int x) { return x * 27; }
+inline int f462_28(int x) { return x * 28; }
+inline int f462_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4620 */
+#include <vector>
+#include "h7002.h"
+#include "h932.h"
+#include "h95.h"
+#include "h797.h"
+#include "h6738.h"
+#ifdef X
+#include "h5034.h"
+#endif
+struct S4620 { int a; const char *s = "x//y"; };
+inline int f4620_0(int x) { return x * 0; }
+inline int f4620_1(int x) { return x * 1; }
+inline int f4620_2(int x) { return x * 2; }
+inline int f4620_3(int x) { return x * 3; }
+inline int f4620_4(int x) { return x * 4; }
+inline int f4620_5(int x) { return x * 5; }
+inline int f4620_6(int x) { return x * 6; }
+inline int f4620_7(int x) { return x * 7; }
+inline int f4620_8(int x) { return x * 8; }
+inline int f4620_9(int x) { return x * 9; }
+inline int f4620_10(int x) { return x * 10; }
+inline int f4620_11(int x) { return x * 11; }
+inline int f4620_12(int x) { return x * 12; }
+inline int f4620_13(int x) { return x * 13; }
+inline int f4620_14(int x) { return x * 14; }
+inline int f4620_15(int x) { return x * 15; }
+inline int f4620_16(int x) { return x * 16; }
+inline int f4620_17(int x) { return x * 17; }
+inline int f4620_18(int x) { return x * 18; }
+inline int f4620_19(int x) { return x * 19; }
+inline int f4620_20(int x) { return x * 20; }
+inline int f4620_21(int x) { return x * 21; }
+inline int f4620_22(int x) { return x * 22; }
+inline int f4620_23(int x) { return x * 23; }
+inline int f4620_24(int x) { return x * 24; }
+inline int f4620_25(int x) { return x * 25; }
+inline int f4620_26(int x) { return x * 26; }
+inline int f4620_27(int x) { return x * 27; }
+inline int f4620_28(int x) { return x * 28; }
+inline int f4620_29(int x) { return x * 29; }
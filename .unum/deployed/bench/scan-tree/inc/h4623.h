@@ -0,0 +1,42 @@
+#pragma once
+/* header 4623 */
+#include <vector>
+#include "h1530.h"
+#include "h2401.h"
+#include "h1012.h"
+#include "h3206.h"
+#include "h8232.h"
+#ifdef X
+#include "h8462.h"
+#endif
+struct S4623 { int a; const char *s = "x//y"; };
+inline int f4623_0(int x) { return x * 0; }
+inline int f4623_1(int x) { return x * 1; }
+inline int f4623_2(int x) { return x * 2; }
+inline int f4623_3(int x) { return x * 3; }
+inline int f4623_4(int x) { return x * 4; }
+inline int f4623_5(int x) { return x * 5; }
+inline int f4623_6(int x) { return x * 6; }
+inline int f4623_7(int x) { return x * 7; }
+inline int f4623_8(int x) { return x * 8; }
+inline int f4623_9(int x) { return x * 9; }
+inline int f4623_10(int x) { return x * 10; }
+inline int f4623_11(int x) { return x * 11; }
+inline int f4623_12(int x) { return x * 12; }
+inline int f4623_13(int x) { return x * 13; }
+inline int f4623_14(int x) { return x * 14; }
+inline int f4623_15(int x) { return x * 15; }
+inline int f4623_16(int x) { return x * 16; }
+inline int f4623_17(int x) { return x * 17; }
+inline int f4623_18(int x) { return x * 18; }
+inline int f4623_19(int x) { return x * 19; }
+inline int f4623_20(int x) { return x * 20; }
+inline int f4623_21(int x) { return x * 21; }
+inline int f4623_22(int x) { return x * 22; }
+inline int f4623_23(int x) { return x * 23; }
+inline int f4623_24(int x) { return x * 24; }
+inline int f4623_25(int x) { return x * 25; }
+inline int f4623_26(int x) { return x * 26; }
+inline int f4623_27(int x) { return x * 27; }
+inline int f4623_28(int x) { return x * 28; }
+inline int f4623_29(int x) { return x * 29; }
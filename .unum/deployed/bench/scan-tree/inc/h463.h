@@ -0,0 +1,42 @@
+#pragma once
+/* header 463 */
+#include <vector>
+#include "h6548.h"
+#include "h5979.h"
+#include "h9084.h"
+#include "h7194.h"
+#include "h3184.h"
+#ifdef X
+#include "h5039.h"
+#endif
+struct S463 { int a; const char *s = "x//y"; };
+inline int f463_0(int x) { return x * 0; }
+inline int f463_1(int x) { return x * 1; }
+inline int f463_2(int x) { return x * 2; }
+inline int f463_3(int x) { return x * 3; }
+inline int f463_4(int x) { return x * 4; }
+inline int f463_5(int x) { return x * 5; }
+inline int f463_6(int x) { return x * 6; }
+inline int f463_7(int x) { return x * 7; }
+inline int f463_8(int x) { return x * 8; }
+inline int f463_9(int x) { return x * 9; }
+inline int f463_10(int x) { return x * 10; }
+inline int f463_11(int x) { return x * 11; }
+inline int f463_12(int x) { return x * 12; }
+inline int f463_13(int x) { return x * 13; }
+inline int f463_14(int x) { return x * 14; }
+inline int f463_15(int x) { return x * 15; }
+inline int f463_16(int x) { return x * 16; }
+inline int f463_17(int x) { return x * 17; }
+inline int f463_18(int x) { return x * 18; }
+inline int f463_19(int x) { return x * 19; }
+inline int f463_20(int x) { return x * 20; }
+inline int f463_21(int x) { return x * 21; }
+inline int f463_22(int x) { return x * 22; }
+inline int f463_23(int x) { return x * 23; }
+inline int f463_24(int x) { return x * 24; }
+inline int f463_25(int x) { return x * 25; }
+inline int f463_26(int x) { return x * 26; }
+inline int f463_27(int x) { return x * 27; }
+inline int f463_28(int x) { return x * 28; }
+inline int f463_29(int x) { return x * 29; }
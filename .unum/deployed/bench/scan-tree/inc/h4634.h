@@ -0,0 +1,42 @@
+#pragma once
+/* header 4634 */
+#include <vector>
+#include "h4894.h"
+#include "h9286.h"
+#include "h3853.h"
+#include "h7884.h"
+#include "h7320.h"
+#ifdef X
+#include "h4246.h"
+#endif
+struct S4634 { int a; const char *s = "x//y"; };
+inline int f4634_0(int x) { return x * 0; }
+inline int f4634_1(int x) { return x * 1; }
+inline int f4634_2(int x) { return x * 2; }
+inline int f4634_3(int x) { return x * 3; }
+inline int f4634_4(int x) { return x * 4; }
+inline int f4634_5(int x) { return x * 5; }
+inline int f4634_6(int x) { return x * 6; }
+inline int f4634_7(int x) { return x * 7; }
+inline int f4634_8(int x) { return x * 8; }
+inline int f4634_9(int x) { return x * 9; }
+inline int f4634_10(int x) { return x * 10; }
+inline int f4634_11(int x) { return x * 11; }
+inline int f4634_12(int x) { return x * 12; }
+inline int f4634_13(int x) { return x * 13; }
+inline int f4634_14(int x) { return x * 14; }
+inline int f4634_15(int x) { return x * 15; }
+inline int f4634_16(int x) { return x * 16; }
+inline int f4634_17(int x) { return x * 17; }
+inline int f4634_18(int x) { return x * 18; }
+inline int f4634_19(int x) { return x * 19; }
+inline int f4634_20(int x) { return x * 20; }
+inline int f4634_21(int x) { return x * 21; }
+inline int f4634_22(int x) { return x * 22; }
+inline int f4634_23(int x) { return x * 23; }
+inline int f4634_24(int x) { return x * 24; }
+inline int f4634_25(int x) { return x * 25; }
+inline int f4634_26(int x) { return x * 26; }
+inline int f4634_27(int x) { return x * 27; }
+inline int f4634_28(int x) { return x * 28; }
+inline int f4634_29(int x) { return x * 29; }
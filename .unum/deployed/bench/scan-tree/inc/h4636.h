@@ -0,0 +1,42 @@
+#pragma once
+/* header 4636 */
+#include <vector>
+#include "h1037.h"
+#include "h1829.h"
+#include "h4704.h"
+#include "h7594.h"
+#include "h8843.h"
+#ifdef X
+#include "h7028.h"
+#endif
+struct S4636 { int a; const char *s = "x//y"; };
+inline int f4636_0(int x) { return x * 0; }
+inline int f4636_1(int x) { return x * 1; }
+inline int f4636_2(int x) { return x * 2; }
+inline int f4636_3(int x) { return x * 3; }
+inline int f4636_4(int x) { return x * 4; }
+inline int f4636_5(int x) { return x * 5; }
+inline int f4636_6(int x) { return x * 6; }
+inline int f4636_7(int x) { return x * 7; }
+inline int f4636_8(int x) { return x * 8; }
+inline int f4636_9(int x) { return x * 9; }
+inline int f4636_10(int x) { return x * 10; }
+inline int f4636_11(int x) { return x * 11; }
+inline int f4636_12(int x) { return x * 12; }
+inline int f4636_13(int x) { return x * 13; }
+inline int f4636_14(int x) { return x * 14; }
+inline int f4636_15(int x) { return x * 15; }
+inline int f4636_16(int x) { return x * 16; }
+inline int f4636_17(int x) { return x * 17; }
+inline int f4636_18(int x) { return x * 18; }
+inline int f4636_19(int x) { return x * 19; }
+inline int f4636_20(int x) { return x * 20; }
+inline int f4636_21(int x) { return x * 21; }
+inline int f4636_22(int x) { return x * 22; }
+inline int f4636_23(int x) { return x * 23; }
+inline int f4636_24(int x) { return x * 24; }
+inline int f4636_25(int x) { return x * 25; }
+inline int f4636_26(int x) { return x * 26; }
+inline int f4636_27(int x) { return x * 27; }
+inline int f4636_28(int x) { return x * 28; }
+inline int f4636_29(int x) { return x * 29; }
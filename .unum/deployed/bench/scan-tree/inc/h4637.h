@@ -0,0 +1,42 @@
+#pragma once
+/* header 4637 */
+#include <vector>
+#include "h706.h"
+#include "h5848.h"
+#include "h774.h"
+#include "h1588.h"
+#include "h5881.h"
+#ifdef X
+#include "h2842.h"
+#endif
+struct S4637 { int a; const char *s = "x//y"; };
+inline int f4637_0(int x) { return x * 0; }
+inline int f4637_1(int x) { return x * 1; }
+inline int f4637_2(int x) { return x * 2; }
+inline int f4637_3(int x) { return x * 3; }
+inline int f4637_4(int x) { return x * 4; }
+inline int f4637_5(int x) { return x * 5; }
+inline int f4637_6(int x) { return x * 6; }
+inline int f4637_7(int x) { return x * 7; }
+inline int f4637_8(int x) { return x * 8; }
+inline int f4637_9(int x) { return x * 9; }
+inline int f4637_10(int x) { return x * 10; }
+inline int f4637_11(int x) { return x * 11; }
+inline int f4637_12(int x) { return x * 12; }
+inline int f4637_13(int x) { return x * 13; }
+inline int f4637_14(int x) { return x * 14; }
+inline int f4637_15(int x) { return x * 15; }
+inline int f4637_16(int x) { return x * 16; }
+inline int f4637_17(int x) { return x * 17; }
+inline int f4637_18(int x) { return x * 18; }
+inline int f4637_19(int x) { return x * 19; }
+inline int f4637_20(int x) { return x * 20; }
+inline int f4637_21(int x) { return x * 21; }
+inline int f4637_22(int x) { return x * 22; }
+inline int f4637_23(int x) { return x * 23; }
+inline int f4637_24(int x) { return x * 24; }
+inline int f4637_25(int x) { return x * 25; }
+inline int f4637_26(int x) { return x * 26; }
+inline int f4637_27(int x) { return x * 27; }
+inline int f4637_28(int x) { return x * 28; }
+inline int f4637_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4638 */
+#include <vector>
+#include "h9464.h"
+#include "h2899.h"
+#include "h2933.h"
+#include "h4968.h"
+#include "h5572.h"
+#ifdef X
+#include "h6854.h"
+#endif
+struct S4638 { int a; const char *s = "x//y"; };
+inline int f4638_0(int x) { return x * 0; }
+inline int f4638_1(int x) { return x * 1; }
+inline int f4638_2(int x) { return x * 2; }
+inline int f4638_3(int x) { return x * 3; }
+inline int f4638_4(int x) { return x * 4; }
+inline int f4638_5(int x) { return x * 5; }
+inline int f4638_6(int x) { return x * 6; }
+inline int f4638_7(int x) { return x * 7; }
+inline int f4638_8(int x) { return x * 8; }
+inline int f4638_9(int x) { return x * 9; }
+inline int f4638_10(int x) { return x * 10; }
+inline int f4638_11(int x) { return x * 11; }
+inline int f4638_12(int x) { return x * 12; }
+inline int f4638_13(int x) { return x * 13; }
+inline int f4638_14(int x) { return x * 14; }
+inline int f4638_15(int x) { return x * 15; }
+inline int f4638_16(int x) { return x * 16; }
+inline int f4638_17(int x) { return x * 17; }
+inline int f4638_18(int x) { return x * 18; }
+inline int f4638_19(int x) { return x * 19; }
+inline int f4638_20(int x) { return x * 20; }
+inline int f4638_21(int x) { return x * 21; }
+inline int f4638_22(int x) { return x * 22; }
+inline int f4638_23(int x) { return x * 23; }
+inline int f4638_24(int x) { return x * 24; }
+inline int f4638_25(int x) { return x * 25; }
+inline int f4638_26(int x) { return x * 26; }
+inline int f4638_27(int x) { return x * 27; }
+inline int f4638_28(int x) { return x * 28; }
+inline int f4638_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4641 */
+#include <vector>
+#include "h3247.h"
+#include "h940.h"
+#include "h7654.h"
+#include "h2372.h"
+#include "h7788.h"
+#ifdef X
+#include "h709.h"
+#endif
+struct S4641 { int a; const char *s = "x//y"; };
+inline int f4641_0(int x) { return x * 0; }
+inline int f4641_1(int x) { return x * 1; }
+inline int f4641_2(int x) { return x * 2; }
+inline int f4641_3(int x) { return x * 3; }
+inline int f4641_4(int x) { return x * 4; }
+inline int f4641_5(int x) { return x * 5; }
+inline int f4641_6(int x) { return x * 6; }
+inline int f4641_7(int x) { return x * 7; }
+inline int f4641_8(int x) { return x * 8; }
+inline int f4641_9(int x) { return x * 9; }
+inline int f4641_10(int x) { return x * 10; }
+inline int f4641_11(int x) { return x * 11; }
+inline int f4641_12(int x) { return x * 12; }
+inline int f4641_13(int x) { return x * 13; }
+inline int f4641_14(int x) { return x * 14; }
+inline int f4641_15(int x) { return x * 15; }
+inline int f4641_16(int x) { return x * 16; }
+inline int f4641_17(int x) { return x * 17; }
+inline int f4641_18(int x) { return x * 18; }
+inline int f4641_19(int x) { return x * 19; }
+inline int f4641_20(int x) { return x * 20; }
+inline int f4641_21(int x) { return x * 21; }
+inline int f4641_22(int x) { return x * 22; }
+inline int f4641_23(int x) { return x * 23; }
+inline int f4641_24(int x) { return x * 24; }
+inline int f4641_25(int x) { return x * 25; }
+inline int f4641_26(int x) { return x * 26; }
+inline int f4641_27(int x) { return x * 27; }
+inline int f4641_28(int x) { return x * 28; }
+inline int f4641_29(int x) { return x * 29; }
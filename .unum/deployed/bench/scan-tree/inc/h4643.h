@@ -0,0 +1,42 @@
+#pragma once
+/* header 4643 */
+#include <vector>
+#include "h7835.h"
+#include "h841.h"
+#include "h2305.h"
+#include "h748.h"
+#include "h4033.h"
+#ifdef X
+#include "h1462.h"
+#endif
+struct S4643 { int a; const char *s = "x//y"; };
+inline int f4643_0(int x) { return x * 0; }
+inline int f4643_1(int x) { return x * 1; }
+inline int f4643_2(int x) { return x * 2; }
+inline int f4643_3(int x) { return x * 3; }
+inline int f4643_4(int x) { return x * 4; }
+inline int f4643_5(int x) { return x * 5; }
+inline int f4643_6(int x) { return x * 6; }
+inline int f4643_7(int x) { return x * 7; }
+inline int f4643_8(int x) { return x * 8; }
+inline int f4643_9(int x) { return x * 9; }
+inline int f4643_10(int x) { return x * 10; }
+inline int f4643_11(int x) { return x * 11; }
+inline int f4643_12(int x) { return x * 12; }
+inline int f4643_13(int x) { return x * 13; }
+inline int f4643_14(int x) { return x * 14; }
+inline int f4643_15(int x) { return x * 15; }
+inline int f4643_16(int x) { return x * 16; }
+inline int f4643_17(int x) { return x * 17; }
+inline int f4643_18(int x) { return x * 18; }
+inline int f4643_19(int x) { return x * 19; }
+inline int f4643_20(int x) { return x * 20; }
+inline int f4643_21(int x) { return x * 21; }
+inline int f4643_22(int x) { return x * 22; }
+inline int f4643_23(int x) { return x * 23; }
+inline int f4643_24(int x) { return x * 24; }
+inline int f4643_25(int x) { return x * 25; }
+inline int f4643_26(int x) { return x * 26; }
+inline int f4643_27(int x) { return x * 27; }
+inline int f4643_28(int x) { return x * 28; }
+inline int f4643_29(int x) { return x * 29; }
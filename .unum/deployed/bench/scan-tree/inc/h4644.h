@@ -0,0 +1,42 @@
+#pragma once
+/* header 4644 */
+#include <vector>
+#include "h3126.h"
+#include "h2374.h"
+#include "h9652.h"
+#include "h6621.h"
+#include "h5471.h"
+#ifdef X
+#include "h7072.h"
+#endif
+struct S4644 { int a; const char *s = "x//y"; };
+inline int f4644_0(int x) { return x * 0; }
+inline int f4644_1(int x) { return x * 1; }
+inline int f4644_2(int x) { return x * 2; }
+inline int f4644_3(int x) { return x * 3; }
+inline int f4644_4(int x) { return x * 4; }
+inline int f4644_5(int x) { return x * 5; }
+inline int f4644_6(int x) { return x * 6; }
+inline int f4644_7(int x) { return x * 7; }
+inline int f4644_8(int x) { return x * 8; }
+inline int f4644_9(int x) { return x * 9; }
+inline int f4644_10(int x) { return x * 10; }
+inline int f4644_11(int x) { return x * 11; }
+inline int f4644_12(int x) { return x * 12; }
+inline int f4644_13(int x) { return x * 13; }
+inline int f4644_14(int x) { return x * 14; }
+inline int f4644_15(int x) { return x * 15; }
+inline int f4644_16(int x) { return x * 16; }
+inline int f4644_17(int x) { return x * 17; }
+inline int f4644_18(int x) { return x * 18; }
+inline int f4644_19(int x) { return x * 19; }
+inline int f4644_20(int x) { return x * 20; }
+inline int f4644_21(int x) { return x * 21; }
+inline int f4644_22(int x) { return x * 22; }
+inline int f4644_23(int x) { return x * 23; }
+inline int f4644_24(int x) { return x * 24; }
+inline int f4644_25(int x) { return x * 25; }
+inline int f4644_26(int x) { return x * 26; }
+inline int f4644_27(int x) { return x * 27; }
+inline int f4644_28(int x) { return x * 28; }
+inline int f4644_29(int x) { return x * 29; }
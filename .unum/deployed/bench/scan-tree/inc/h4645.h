@@ -0,0 +1,42 @@
+#pragma once
+/* header 4645 */
+#include <vector>
+#include "h6637.h"
+#include "h1211.h"
+#include "h2564.h"
+#include "h1743.h"
+#include "h7523.h"
+#ifdef X
+#include "h9368.h"
+#endif
+struct S4645 { int a; const char *s = "x//y"; };
+inline int f4645_0(int x) { return x * 0; }
+inline int f4645_1(int x) { return x * 1; }
+inline int f4645_2(int x) { return x * 2; }
+inline int f4645_3(int x) { return x * 3; }
+inline int f4645_4(int x) { return x * 4; }
+inline int f4645_5(int x) { return x * 5; }
+inline int f4645_6(int x) { return x * 6; }
+inline int f4645_7(int x) { return x * 7; }
+inline int f4645_8(int x) { return x * 8; }
+inline int f4645_9(int x) { return x * 9; }
+inline int f4645_10(int x) { return x * 10; }
+inline int f4645_11(int x) { return x * 11; }
+inline int f4645_12(int x) { return x * 12; }
+inline int f4645_13(int x) { return x * 13; }
+inline int f4645_14(int x) { return x * 14; }
+inline int f4645_15(int x) { return x * 15; }
+inline int f4645_16(int x) { return x * 16; }
+inline int f4645_17(int x) { return x * 17; }
+inline int f4645_18(int x) { return x * 18; }
+inline int f4645_19(int x) { return x * 19; }
+inline int f4645_20(int x) { return x * 20; }
+inline int f4645_21(int x) { return x * 21; }
+inline int f4645_22(int x) { return x * 22; }
+inline int f4645_23(int x) { return x * 23; }
+inline int f4645_24(int x) { return x * 24; }
+inline int f4645_25(int x) { return x * 25; }
+inline int f4645_26(int x) { return x * 26; }
+inline int f4645_27(int x) { return x * 27; }
+inline int f4645_28(int x) { return x * 28; }
+inline int f4645_29(int x) { return x * 29; }
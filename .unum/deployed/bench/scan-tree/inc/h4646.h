@@ -0,0 +1,42 @@
+#pragma once
+/* header 4646 */
+#include <vector>
+#include "h4876.h"
+#include "h9847.h"
+#include "h9524.h"
+#include "h9366.h"
+#include "h4770.h"
+#ifdef X
+#include "h5728.h"
+#endif
+struct S4646 { int a; const char *s = "x//y"; };
+inline int f4646_0(int x) { return x * 0; }
+inline int f4646_1(int x) { return x * 1; }
+inline int f4646_2(int x) { return x * 2; }
+inline int f4646_3(int x) { return x * 3; }
+inline int f4646_4(int x) { return x * 4; }
+inline int f4646_5(int x) { return x * 5; }
+inline int f4646_6(int x) { return x * 6; }
+inline int f4646_7(int x) { return x * 7; }
+inline int f4646_8(int x) { return x * 8; }
+inline int f4646_9(int x) { return x * 9; }
+inline int f4646_10(int x) { return x * 10; }
+inline int f4646_11(int x) { return x * 11; }
+inline int f4646_12(int x) { return x * 12; }
+inline int f4646_13(int x) { return x * 13; }
+inline int f4646_14(int x) { return x * 14; }
+inline int f4646_15(int x) { return x * 15; }
+inline int f4646_16(int x) { return x * 16; }
+inline int f4646_17(int x) { return x * 17; }
+inline int f4646_18(int x) { return x * 18; }
+inline int f4646_19(int x) { return x * 19; }
+inline int f4646_20(int x) { return x * 20; }
+inline int f4646_21(int x) { return x * 21; }
+inline int f4646_22(int x) { return x * 22; }
+inline int f4646_23(int x) { return x * 23; }
+inline int f4646_24(int x) { return x * 24; }
+inline int f4646_25(int x) { return x * 25; }
+inline int f4646_26(int x) { return x * 26; }
+inline int f4646_27(int x) { return x * 27; }
+inline int f4646_28(int x) { return x * 28; }
+inline int f4646_29(int x) { return x * 29; }
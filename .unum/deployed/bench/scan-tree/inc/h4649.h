@@ -0,0 +1,42 @@
+#pragma once
+/* header 4649 */
+#include <vector>
+#include "h7485.h"
+#include "h5231.h"
+#include "h8240.h"
+#include "h2105.h"
+#include "h5388.h"
+#ifdef X
+#include "h7265.h"
+#endif
+struct S4649 { int a; const char *s = "x//y"; };
+inline int f4649_0(int x) { return x * 0; }
+inline int f4649_1(int x) { return x * 1; }
+inline int f4649_2(int x) { return x * 2; }
+inline int f4649_3(int x) { return x * 3; }
+inline int f4649_4(int x) { return x * 4; }
+inline int f4649_5(int x) { return x * 5; }
+inline int f4649_6(int x) { return x * 6; }
+inline int f4649_7(int x) { return x * 7; }
+inline int f4649_8(int x) { return x * 8; }
+inline int f4649_9(int x) { return x * 9; }
+inline int f4649_10(int x) { return x * 10; }
+inline int f4649_11(int x) { return x * 11; }
+inline int f4649_12(int x) { return x * 12; }
+inline int f4649_13(int x) { return x * 13; }
+inline int f4649_14(int x) { return x * 14; }
+inline int f4649_15(int x) { return x * 15; }
+inline int f4649_16(int x) { return x * 16; }
+inline int f4649_17(int x) { return x * 17; }
+inline int f4649_18(int x) { return x * 18; }
+inline int f4649_19(int x) { return x * 19; }
+inline int f4649_20(int x) { return x * 20; }
+inline int f4649_21(int x) { return x * 21; }
+inline int f4649_22(int x) { return x * 22; }
+inline int f4649_23(int x) { return x * 23; }
+inline int f4649_24(int x) { return x * 24; }
+inline int f4649_25(int x) { return x * 25; }
+inline int f4649_26(int x) { return x * 26; }
+inline int f4649_27(int x) { return x * 27; }
+inline int f4649_28(int x) { return x * 28; }
+inline int f4649_29(int x) { return x * 29; }
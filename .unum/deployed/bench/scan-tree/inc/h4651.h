@@ -0,0 +1,42 @@
+#pragma once
+/* header 4651 */
+#include <vector>
+#include "h9211.h"
+#include "h5847.h"
+#include "h8356.h"
+#include "h3274.h"
+#include "h397.h"
+#ifdef X
+#include "h5308.h"
+#endif
+struct S4651 { int a; const char *s = "x//y"; };
+inline int f4651_0(int x) { return x * 0; }
+inline int f4651_1(int x) { return x * 1; }
+inline int f4651_2(int x) { return x * 2; }
+inline int f4651_3(int x) { return x * 3; }
+inline int f4651_4(int x) { return x * 4; }
+inline int f4651_5(int x) { return x * 5; }
+inline int f4651_6(int x) { return x * 6; }
+inline int f4651_7(int x) { return x * 7; }
+inline int f4651_8(int x) { return x * 8; }
+inline int f4651_9(int x) { return x * 9; }
+inline int f4651_10(int x) { return x * 10; }
+inline int f4651_11(int x) { return x * 11; }
+inline int f4651_12(int x) { return x * 12; }
+inline int f4651_13(int x) { return x * 13; }
+inline int f4651_14(int x) { return x * 14; }
+inline int f4651_15(int x) { return x * 15; }
+inline int f4651_16(int x) { return x * 16; }
+inline int f4651_17(int x) { return x * 17; }
+inline int f4651_18(int x) { return x * 18; }
+inline int f4651_19(int x) { return x * 19; }
+inline int f4651_20(int x) { return x * 20; }
+inline int f4651_21(int x) { return x * 21; }
+inline int f4651_22(int x) { return x * 22; }
+inline int f4651_23(int x) { return x * 23; }
+inline int f4651_24(int x) { return x * 24; }
+inline int f4651_25(int x) { return x * 25; }
+inline int f4651_26(int x) { return x * 26; }
+inline int f4651_27(int x) { return x * 27; }
+inline int f4651_28(int x) { return x * 28; }
+inline int f4651_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4652 */
+#include <vector>
+#include "h3772.h"
+#include "h8614.h"
+#include "h5449.h"
+#include "h7920.h"
+#include "h1192.h"
+#ifdef X
+#include "h8266.h"
+#endif
+struct S4652 { int a; const char *s = "x//y"; };
+inline int f4652_0(int x) { return x * 0; }
+inline int f4652_1(int x) { return x * 1; }
+inline int f4652_2(int x) { return x * 2; }
+inline int f4652_3(int x) { return x * 3; }
+inline int f4652_4(int x) { return x * 4; }
+inline int f4652_5(int x) { return x * 5; }
+inline int f4652_6(int x) { return x * 6; }
+inline int f4652_7(int x) { return x * 7; }
+inline int f4652_8(int x) { return x * 8; }
+inline int f4652_9(int x) { return x * 9; }
+inline int f4652_10(int x) { return x * 10; }
+inline int f4652_11(int x) { return x * 11; }
+inline int f4652_12(int x) { return x * 12; }
+inline int f4652_13(int x) { return x * 13; }
+inline int f4652_14(int x) { return x * 14; }
+inline int f4652_15(int x) { return x * 15; }
+inline int f4652_16(int x) { return x * 16; }
+inline int f4652_17(int x) { return x * 17; }
+inline int f4652_18(int x) { return x * 18; }
+inline int f4652_19(int x) { return x * 19; }
+inline int f4652_20(int x) { return x * 20; }
+inline int f4652_21(int x) { return x * 21; }
+inline int f4652_22(int x) { return x * 22; }
+inline int f4652_23(int x) { return x * 23; }
+inline int f4652_24(int x) { return x * 24; }
+inline int f4652_25(int x) { return x * 25; }
+inline int f4652_26(int x) { return x * 26; }
+inline int f4652_27(int x) { return x * 27; }
+inline int f4652_28(int x) { return x * 28; }
+inline int f4652_29(int x) { return x * 29; }
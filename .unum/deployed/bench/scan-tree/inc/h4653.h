@@ -0,0 +1,42 @@
+#pragma once
+/* header 4653 */
+#include <vector>
+#include "h8787.h"
+#include "h2274.h"
+#include "h5994.h"
+#include "h3185.h"
+#include "h8297.h"
+#ifdef X
+#include "h8944.h"
+#endif
+struct S4653 { int a; const char *s = "x//y"; };
+inline int f4653_0(int x) { return x * 0; }
+inline int f4653_1(int x) { return x * 1; }
+inline int f4653_2(int x) { return x * 2; }
+inline int f4653_3(int x) { return x * 3; }
+inline int f4653_4(int x) { return x * 4; }
+inline int f4653_5(int x) { return x * 5; }
+inline int f4653_6(int x) { return x * 6; }
+inline int f4653_7(int x) { return x * 7; }
+inline int f4653_8(int x) { return x * 8; }
+inline int f4653_9(int x) { return x * 9; }
+inline int f4653_10(int x) { return x * 10; }
+inline int f4653_11(int x) { return x * 11; }
+inline int f4653_12(int x) { return x * 12; }
+inline int f4653_13(int x) { return x * 13; }
+inline int f4653_14(int x) { return x * 14; }
+inline int f4653_15(int x) { return x * 15; }
+inline int f4653_16(int x) { return x * 16; }
+inline int f4653_17(int x) { return x * 17; }
+inline int f4653_18(int x) { return x * 18; }
+inline int f4653_19(int x) { return x * 19; }
+inline int f4653_20(int x) { return x * 20; }
+inline int f4653_21(int x) { return x * 21; }
+inline int f4653_22(int x) { return x * 22; }
+inline int f4653_23(int x) { return x * 23; }
+inline int f4653_24(int x) { return x * 24; }
+inline int f4653_25(int x) { return x * 25; }
+inline int f4653_26(int x) { return x * 26; }
+inline int f4653_27(int x) { return x * 27; }
+inline int f4653_28(int x) { return x * 28; }
+inline int f4653_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4654 */
+#include <vector>
+#include "h1442.h"
+#include "h1425.h"
+#include "h6366.h"
+#include "h2644.h"
+#include "h735.h"
+#ifdef X
+#include "h218.h"
+#endif
+struct S4654 { int a; const char *s = "x//y"; };
+inline int f4654_0(int x) { return x * 0; }
+inline int f4654_1(int x) { return x * 1; }
+inline int f4654_2(int x) { return x * 2; }
+inline int f4654_3(int x) { return x * 3; }
+inline int f4654_4(int x) { return x * 4; }
+inline int f4654_5(int x) { return x * 5; }
+inline int f4654_6(int x) { return x * 6; }
+inline int f4654_7(int x) { return x * 7; }
+inline int f4654_8(int x) { return x * 8; }
+inline int f4654_9(int x) { return x * 9; }
+inline int f4654_10(int x) { return x * 10; }
+inline int f4654_11(int x) { return x * 11; }
+inline int f4654_12(int x) { return x * 12; }
+inline int f4654_13(int x) { return x * 13; }
+inline int f4654_14(int x) { return x * 14; }
+inline int f4654_15(int x) { return x * 15; }
+inline int f4654_16(int x) { return x * 16; }
+inline int f4654_17(int x) { return x * 17; }
+inline int f4654_18(int x) { return x * 18; }
+inline int f4654_19(int x) { return x * 19; }
+inline int f4654_20(int x) { return x * 20; }
+inline int f4654_21(int x) { return x * 21; }
+inline int f4654_22(int x) { return x * 22; }
+inline int f4654_23(int x) { return x * 23; }
+inline int f4654_24(int x) { return x * 24; }
+inline int f4654_25(int x) { return x * 25; }
+inline int f4654_26(int x) { return x * 26; }
+inline int f4654_27(int x) { return x * 27; }
+inline int f4654_28(int x) { return x * 28; }
+inline int f4654_29(int x) { return x * 29; }
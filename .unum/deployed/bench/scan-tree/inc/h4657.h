@@ -0,0 +1,42 @@
+#pragma once
+/* header 4657 */
+#include <vector>
+#include "h4220.h"
+#include "h2074.h"
+#include "h7774.h"
+#include "h6576.h"
+#include "h2164.h"
+#ifdef X
+#include "h3659.h"
+#endif
+struct S4657 { int a; const char *s = "x//y"; };
+inline int f4657_0(int x) { return x * 0; }
+inline int f4657_1(int x) { return x * 1; }
+inline int f4657_2(int x) { return x * 2; }
+inline int f4657_3(int x) { return x * 3; }
+inline int f4657_4(int x) { return x * 4; }
+inline int f4657_5(int x) { return x * 5; }
+inline int f4657_6(int x) { return x * 6; }
+inline int f4657_7(int x) { return x * 7; }
+inline int f4657_8(int x) { return x * 8; }
+inline int f4657_9(int x) { return x * 9; }
+inline int f4657_10(int x) { return x * 10; }
+inline int f4657_11(int x) { return x * 11; }
+inline int f4657_12(int x) { return x * 12; }
+inline int f4657_13(int x) { return x * 13; }
+inline int f4657_14(int x) { return x * 14; }
+inline int f4657_15(int x) { return x * 15; }
+inline int f4657_16(int x) { return x * 16; }
+inline int f4657_17(int x) { return x * 17; }
+inline int f4657_18(int x) { return x * 18; }
+inline int f4657_19(int x) { return x * 19; }
+inline int f4657_20(int x) { return x * 20; }
+inline int f4657_21(int x) { return x * 21; }
+inline int f4657_22(int x) { return x * 22; }
+inline int f4657_23(int x) { return x * 23; }
+inline int f4657_24(int x) { return x * 24; }
+inline int f4657_25(int x) { return x * 25; }
+inline int f4657_26(int x) { return x * 26; }
+inline int f4657_27(int x) { return x * 27; }
+inline int f4657_28(int x) { return x * 28; }
+inline int f4657_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4658 */
+#include <vector>
+#include "h9984.h"
+#include "h747.h"
+#include "h6586.h"
+#include "h7342.h"
+#include "h8241.h"
+#ifdef X
+#include "h1065.h"
+#endif
+struct S4658 { int a; const char *s = "x//y"; };
+inline int f4658_0(int x) { return x * 0; }
+inline int f4658_1(int x) { return x * 1; }
+inline int f4658_2(int x) { return x * 2; }
+inline int f4658_3(int x) { return x * 3; }
+inline int f4658_4(int x) { return x * 4; }
+inline int f4658_5(int x) { return x * 5; }
+inline int f4658_6(int x) { return x * 6; }
+inline int f4658_7(int x) { return x * 7; }
+inline int f4658_8(int x) { return x * 8; }
+inline int f4658_9(int x) { return x * 9; }
+inline int f4658_10(int x) { return x * 10; }
+inline int f4658_11(int x) { return x * 11; }
+inline int f4658_12(int x) { return x * 12; }
+inline int f4658_13(int x) { return x * 13; }
+inline int f4658_14(int x) { return x * 14; }
+inline int f4658_15(int x) { return x * 15; }
+inline int f4658_16(int x) { return x * 16; }
+inline int f4658_17(int x) { return x * 17; }
+inline int f4658_18(int x) { return x * 18; }
+inline int f4658_19(int x) { return x * 19; }
+inline int f4658_20(int x) { return x * 20; }
+inline int f4658_21(int x) { return x * 21; }
+inline int f4658_22(int x) { return x * 22; }
+inline int f4658_23(int x) { return x * 23; }
+inline int f4658_24(int x) { return x * 24; }
+inline int f4658_25(int x) { return x * 25; }
+inline int f4658_26(int x) { return x * 26; }
+inline int f4658_27(int x) { return x * 27; }
+inline int f4658_28(int x) { return x * 28; }
+inline int f4658_29(int x) { return x * 29; }
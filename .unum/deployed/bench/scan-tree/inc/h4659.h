@@ -0,0 +1,42 @@
+#pragma once
+/* header 4659 */
+#include <vector>
+#include "h6731.h"
+#include "h992.h"
+#include "h6951.h"
+#include "h7666.h"
+#include "h2590.h"
+#ifdef X
+#include "h7717.h"
+#endif
+struct S4659 { int a; const char *s = "x//y"; };
+inline int f4659_0(int x) { return x * 0; }
+inline int f4659_1(int x) { return x * 1; }
+inline int f4659_2(int x) { return x * 2; }
+inline int f4659_3(int x) { return x * 3; }
+inline int f4659_4(int x) { return x * 4; }
+inline int f4659_5(int x) { return x * 5; }
+inline int f4659_6(int x) { return x * 6; }
+inline int f4659_7(int x) { return x * 7; }
+inline int f4659_8(int x) { return x * 8; }
+inline int f4659_9(int x) { return x * 9; }
+inline int f4659_10(int x) { return x * 10; }
+inline int f4659_11(int x) { return x * 11; }
+inline int f4659_12(int x) { return x * 12; }
+inline int f4659_13(int x) { return x * 13; }
+inline int f4659_14(int x) { return x * 14; }
+inline int f4659_15(int x) { return x * 15; }
+inline int f4659_16(int x) { return x * 16; }
+inline int f4659_17(int x) { return x * 17; }
+inline int f4659_18(int x) { return x * 18; }
+inline int f4659_19(int x) { return x * 19; }
+inline int f4659_20(int x) { return x * 20; }
+inline int f4659_21(int x) { return x * 21; }
+inline int f4659_22(int x) { return x * 22; }
+inline int f4659_23(int x) { return x * 23; }
+inline int f4659_24(int x) { return x * 24; }
+inline int f4659_25(int x) { return x * 25; }
+inline int f4659_26(int x) { return x * 26; }
+inline int f4659_27(int x) { return x * 27; }
+inline int f4659_28(int x) { return x * 28; }
+inline int f4659_29(int x) { return x * 29; }
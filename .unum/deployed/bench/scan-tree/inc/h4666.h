@@ -0,0 +1,42 @@
+#pragma once
+/* header 4666 */
+#include <vector>
+#include "h8464.h"
+#include "h7335.h"
+#include "h7934.h"
+#include "h9034.h"
+#include "h7814.h"
+#ifdef X
+#include "h3059.h"
+#endif
+struct S4666 { int a; const char *s = "x//y"; };
+inline int f4666_0(int x) { return x * 0; }
+inline int f4666_1(int x) { return x * 1; }
+inline int f4666_2(int x) { return x * 2; }
+inline int f4666_3(int x) { return x * 3; }
+inline int f4666_4(int x) { return x * 4; }
+inline int f4666_5(int x) { return x * 5; }
+inline int f4666_6(int x) { return x * 6; }
+inline int f4666_7(int x) { return x * 7; }
+inline int f4666_8(int x) { return x * 8; }
+inline int f4666_9(int x) { return x * 9; }
+inline int f4666_10(int x) { return x * 10; }
+inline int f4666_11(int x) { return x * 11; }
+inline int f4666_12(int x) { return x * 12; }
+inline int f4666_13(int x) { return x * 13; }
+inline int f4666_14(int x) { return x * 14; }
+inline int f4666_15(int x) { return x * 15; }
+inline int f4666_16(int x) { return x * 16; }
+inline int f4666_17(int x) { return x * 17; }
+inline int f4666_18(int x) { return x * 18; }
+inline int f4666_19(int x) { return x * 19; }
+inline int f4666_20(int x) { return x * 20; }
+inline int f4666_21(int x) { return x * 21; }
+inline int f4666_22(int x) { return x * 22; }
+inline int f4666_23(int x) { return x * 23; }
+inline int f4666_24(int x) { return x * 24; }
+inline int f4666_25(int x) { return x * 25; }
+inline int f4666_26(int x) { return x * 26; }
+inline int f4666_27(int x) { return x * 27; }
+inline int f4666_28(int x) { return x * 28; }
+inline int f4666_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 467 */
+#include <vector>
+#include "h4990.h"
+#include "h3077.h"
+#include "h3031.h"
+#include "h3551.h"
+#include "h8103.h"
+#ifdef X
+#include "h287.h"
+#endif
+struct S467 { int a; const char *s = "x//y"; };
+inline int f467_0(int x) { return x * 0; }
+inline int f467_1(int x) { return x * 1; }
+inline int f467_2(int x) { return x * 2; }
+inline int f467_3(int x) { return x * 3; }
+inline int f467_4(int x) { return x * 4; }
+inline int f467_5(int x) { return x * 5; }
+inline int f467_6(int x) { return x * 6; }
+inline int f467_7(int x) { return x * 7; }
+inline int f467_8(int x) { return x * 8; }
+inline int f467_9(int x) { return x * 9; }
+inline int f467_10(int x) { return x * 10; }
+inline int f467_11(int x) { return x * 11; }
+inline int f467_12(int x) { return x * 12; }
+inline int f467_13(int x) { return x * 13; }
+inline int f467_14(int x) { return x * 14; }
+inline int f467_15(int x) { return x * 15; }
+inline int f467_16(int x) { return x * 16; }
+inline int f467_17(int x) { return x * 17; }
+inline int f467_18(int x) { return x * 18; }
+inline int f467_19(int x) { return x * 19; }
+inline int f467_20(int x) { return x * 20; }
+inline int f467_21(int x) { return x * 21; }
+inline int f467_22(int x) { return x * 22; }
+inline int f467_23(int x) { return x * 23; }
+inline int f467_24(int x) { return x * 24; }
+inline int f467_25(int x) { return x * 25; }
+inline int f467_26(int x) { return x * 26; }
+inline int f467_27(int x) { return x * 27; }
+inline int f467_28(int x) { return x * 28; }
+inline int f467_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4670 */
+#include <vector>
+#include "h1595.h"
+#include "h2606.h"
+#include "h9468.h"
+#include "h3346.h"
+#include "h8779.h"
+#ifdef X
+#include "h6902.h"
+#endif
+struct S4670 { int a; const char *s = "x//y"; };
+inline int f4670_0(int x) { return x * 0; }
+inline int f4670_1(int x) { return x * 1; }
+inline int f4670_2(int x) { return x * 2; }
+inline int f4670_3(int x) { return x * 3; }
+inline int f4670_4(int x) { return x * 4; }
+inline int f4670_5(int x) { return x * 5; }
+inline int f4670_6(int x) { return x * 6; }
+inline int f4670_7(int x) { return x * 7; }
+inline int f4670_8(int x) { return x * 8; }
+inline int f4670_9(int x) { return x * 9; }
+inline int f4670_10(int x) { return x * 10; }
+inline int f4670_11(int x) { return x * 11; }
+inline int f4670_12(int x) { return x * 12; }
+inline int f4670_13(int x) { return x * 13; }
+inline int f4670_14(int x) { return x * 14; }
+inline int f4670_15(int x) { return x * 15; }
+inline int f4670_16(int x) { return x * 16; }
+inline int f4670_17(int x) { return x * 17; }
+inline int f4670_18(int x) { return x * 18; }
+inline int f4670_19(int x) { return x * 19; }
+inline int f4670_20(int x) { return x * 20; }
+inline int f4670_21(int x) { return x * 21; }
+inline int f4670_22(int x) { return x * 22; }
+inline int f4670_23(int x) { return x * 23; }
+inline int f4670_24(int x) { return x * 24; }
+inline int f4670_25(int x) { return x * 25; }
+inline int f4670_26(int x) { return x * 26; }
+inline int f4670_27(int x) { return x * 27; }
+inline int f4670_28(int x) { return x * 28; }
+inline int f4670_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4671 */
+#include <vector>
+#include "h8122.h"
+#include "h7805.h"
+#include "h1042.h"
+#include "h9276.h"
+#include "h9120.h"
+#ifdef X
+#include "h5163.h"
+#endif
+struct S4671 { int a; const char *s = "x//y"; };
+inline int f4671_0(int x) { return x * 0; }
+inline int f4671_1(int x) { return x * 1; }
+inline int f4671_2(int x) { return x * 2; }
+inline int f4671_3(int x) { return x * 3; }
+inline int f4671_4(int x) { return x * 4; }
+inline int f4671_5(int x) { return x * 5; }
+inline int f4671_6(int x) { return x * 6; }
+inline int f4671_7(int x) { return x * 7; }
+inline int f4671_8(int x) { return x * 8; }
+inline int f4671_9(int x) { return x * 9; }
+inline int f4671_10(int x) { return x * 10; }
+inline int f4671_11(int x) { return x * 11; }
+inline int f4671_12(int x) { return x * 12; }
+inline int f4671_13(int x) { return x * 13; }
+inline int f4671_14(int x) { return x * 14; }
+inline int f4671_15(int x) { return x * 15; }
+inline int f4671_16(int x) { return x * 16; }
+inline int f4671_17(int x) { return x * 17; }
+inline int f4671_18(int x) { return x * 18; }
+inline int f4671_19(int x) { return x * 19; }
+inline int f4671_20(int x) { return x * 20; }
+inline int f4671_21(int x) { return x * 21; }
+inline int f4671_22(int x) { return x * 22; }
+inline int f4671_23(int x) { return x * 23; }
+inline int f4671_24(int x) { return x * 24; }
+inline int f4671_25(int x) { return x * 25; }
+inline int f4671_26(int x) { return x * 26; }
+inline int f4671_27(int x) { return x * 27; }
+inline int f4671_28(int x) { return x * 28; }
+inline int f4671_29(int x) { return x * 29; }
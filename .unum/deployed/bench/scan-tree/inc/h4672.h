@@ -0,0 +1,42 @@
+#pragma once
+/* header 4672 */
+#include <vector>
+#include "h8159.h"
+#include "h1572.h"
+#include "h7366.h"
+#include "h5772.h"
+#include "h422.h"
+#ifdef X
+#include "h6718.h"
+#endif
+struct S4672 { int a; const char *s = "x//y"; };
+inline int f4672_0(int x) { return x * 0; }
+inline int f4672_1(int x) { return x * 1; }
+inline int f4672_2(int x) { return x * 2; }
+inline int f4672_3(int x) { return x * 3; }
+inline int f4672_4(int x) { return x * 4; }
+inline int f4672_5(int x) { return x * 5; }
+inline int f4672_6(int x) { return x * 6; }
+inline int f4672_7(int x) { return x * 7; }
+inline int f4672_8(int x) { return x * 8; }
+inline int f4672_9(int x) { return x * 9; }
+inline int f4672_10(int x) { return x * 10; }
+inline int f4672_11(int x) { return x * 11; }
+inline int f4672_12(int x) { return x * 12; }
+inline int f4672_13(int x) { return x * 13; }
+inline int f4672_14(int x) { return x * 14; }
+inline int f4672_15(int x) { return x * 15; }
+inline int f4672_16(int x) { return x * 16; }
+inline int f4672_17(int x) { return x * 17; }
+inline int f4672_18(int x) { return x * 18; }
+inline int f4672_19(int x) { return x * 19; }
+inline int f4672_20(int x) { return x * 20; }
+inline int f4672_21(int x) { return x * 21; }
+inline int f4672_22(int x) { return x * 22; }
+inline int f4672_23(int x) { return x * 23; }
+inline int f4672_24(int x) { return x * 24; }
+inline int f4672_25(int x) { return x * 25; }
+inline int f4672_26(int x) { return x * 26; }
+inline int f4672_27(int x) { return x * 27; }
+inline int f4672_28(int x) { return x * 28; }
+inline int f4672_29(int x) { return x * 29; }
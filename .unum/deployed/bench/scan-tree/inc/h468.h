@@ -0,0 +1,42 @@
+#pragma once
+/* header 468 */
+#include <vector>
+#include "h963.h"
+#include "h4411.h"
+#include "h3466.h"
+#include "h514.h"
+#include "h3215.h"
+#ifdef X
+#include "h5625.h"
+#endif
+struct S468 { int a; const char *s = "x//y"; };
+inline int f468_0(int x) { return x * 0; }
+inline int f468_1(int x) { return x * 1; }
+inline int f468_2(int x) { return x * 2; }
+inline int f468_3(int x) { return x * 3; }
+inline int f468_4(int x) { return x * 4; }
+inline int f468_5(int x) { return x * 5; }
+inline int f468_6(int x) { return x * 6; }
+inline int f468_7(int x) { return x * 7; }
+inline int f468_8(int x) { return x * 8; }
+inline int f468_9(int x) { return x * 9; }
+inline int f468_10(int x) { return x * 10; }
+inline int f468_11(int x) { return x * 11; }
+inline int f468_12(int x) { return x * 12; }
+inline int f468_13(int x) { return x * 13; }
+inline int f468_14(int x) { return x * 14; }
+inline int f468_15(int x) { return x * 15; }
+inline int f468_16(int x) { return x * 16; }
+inline int f468_17(int x) { return x * 17; }
+inline int f468_18(int x) { return x * 18; }
+inline int f468_19(int x) { return x * 19; }
+inline int f468_20(int x) { return x * 20; }
+inline int f468_21(int x) { return x * 21; }
+inline int f468_22(int x) { return x * 22; }
+inline int f468_23(int x) { return x * 23; }
+inline int f468_24(int x) { return x * 24; }
+inline int f468_25(int x) { return x * 25; }
+inline int f468_26(int x) { return x * 26; }
+inline int f468_27(int x) { return x * 27; }
+inline int f468_28(int x) { return x * 28; }
+inline int f468_29(int x) { return x * 29; }
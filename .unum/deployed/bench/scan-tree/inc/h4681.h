@@ -0,0 +1,42 @@
+#pragma once
+/* header 4681 */
+#include <vector>
+#include "h5944.h"
+#include "h8727.h"
+#include "h1250.h"
+#include "h2553.h"
+#include "h5720.h"
+#ifdef X
+#include "h1876.h"
+#endif
+struct S4681 { int a; const char *s = "x//y"; };
+inline int f4681_0(int x) { return x * 0; }
+inline int f4681_1(int x) { return x * 1; }
+inline int f4681_2(int x) { return x * 2; }
+inline int f4681_3(int x) { return x * 3; }
+inline int f4681_4(int x) { return x * 4; }
+inline int f4681_5(int x) { return x * 5; }
+inline int f4681_6(int x) { return x * 6; }
+inline int f4681_7(int x) { return x * 7; }
+inline int f4681_8(int x) { return x * 8; }
+inline int f4681_9(int x) { return x * 9; }
+inline int f4681_10(int x) { return x * 10; }
+inline int f4681_11(int x) { return x * 11; }
+inline int f4681_12(int x) { return x * 12; }
+inline int f4681_13(int x) { return x * 13; }
+inline int f4681_14(int x) { return x * 14; }
+inline int f4681_15(int x) { return x * 15; }
+inline int f4681_16(int x) { return x * 16; }
+inline int f4681_17(int x) { return x * 17; }
+inline int f4681_18(int x) { return x * 18; }
+inline int f4681_19(int x) { return x * 19; }
+inline int f4681_20(int x) { return x * 20; }
+inline int f4681_21(int x) { return x * 21; }
+inline int f4681_22(int x) { return x * 22; }
+inline int f4681_23(int x) { return x * 23; }
+inline int f4681_24(int x) { return x * 24; }
+inline int f4681_25(int x) { return x * 25; }
+inline int f4681_26(int x) { return x * 26; }
+inline int f4681_27(int x) { return x * 27; }
+inline int f4681_28(int x) { return x * 28; }
+inline int f4681_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4682 */
+#include <vector>
+#include "h510.h"
+#include "h7929.h"
+#include "h8301.h"
+#include "h1433.h"
+#include "h2177.h"
+#ifdef X
+#include "h8471.h"
+#endif
+struct S4682 { int a; const char *s = "x//y"; };
+inline int f4682_0(int x) { return x * 0; }
+inline int f4682_1(int x) { return x * 1; }
+inline int f4682_2(int x) { return x * 2; }
+inline int f4682_3(int x) { return x * 3; }
+inline int f4682_4(int x) { return x * 4; }
+inline int f4682_5(int x) { return x * 5; }
+inline int f4682_6(int x) { return x * 6; }
+inline int f4682_7(int x) { return x * 7; }
+inline int f4682_8(int x) { return x * 8; }
+inline int f4682_9(int x) { return x * 9; }
+inline int f4682_10(int x) { return x * 10; }
+inline int f4682_11(int x) { return x * 11; }
+inline int f4682_12(int x) { return x * 12; }
+inline int f4682_13(int x) { return x * 13; }
+inline int f4682_14(int x) { return x * 14; }
+inline int f4682_15(int x) { return x * 15; }
+inline int f4682_16(int x) { return x * 16; }
+inline int f4682_17(int x) { return x * 17; }
+inline int f4682_18(int x) { return x * 18; }
+inline int f4682_19(int x) { return x * 19; }
+inline int f4682_20(int x) { return x * 20; }
+inline int f4682_21(int x) { return x * 21; }
+inline int f4682_22(int x) { return x * 22; }
+inline int f4682_23(int x) { return x * 23; }
+inline int f4682_24(int x) { return x * 24; }
+inline int f4682_25(int x) { return x * 25; }
+inline int f4682_26(int x) { return x * 26; }
+inline int f4682_27(int x) { return x * 27; }
+inline int f4682_28(int x) { return x * 28; }
+inline int f4682_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4683 */
+#include <vector>
+#include "h6474.h"
+#include "h1267.h"
+#include "h4056.h"
+#include "h9944.h"
+#include "h2997.h"
+#ifdef X
+#include "h1102.h"
+#endif
+struct S4683 { int a; const char *s = "x//y"; };
+inline int f4683_0(int x) { return x * 0; }
+inline int f4683_1(int x) { return x * 1; }
+inline int f4683_2(int x) { return x * 2; }
+inline int f4683_3(int x) { return x * 3; }
+inline int f4683_4(int x) { return x * 4; }
+inline int f4683_5(int x) { return x * 5; }
+inline int f4683_6(int x) { return x * 6; }
+inline int f4683_7(int x) { return x * 7; }
+inline int f4683_8(int x) { return x * 8; }
+inline int f4683_9(int x) { return x * 9; }
+inline int f4683_10(int x) { return x * 10; }
+inline int f4683_11(int x) { return x * 11; }
+inline int f4683_12(int x) { return x * 12; }
+inline int f4683_13(int x) { return x * 13; }
+inline int f4683_14(int x) { return x * 14; }
+inline int f4683_15(int x) { return x * 15; }
+inline int f4683_16(int x) { return x * 16; }
+inline int f4683_17(int x) { return x * 17; }
+inline int f4683_18(int x) { return x * 18; }
+inline int f4683_19(int x) { return x * 19; }
+inline int f4683_20(int x) { return x * 20; }
+inline int f4683_21(int x) { return x * 21; }
+inline int f4683_22(int x) { return x * 22; }
+inline int f4683_23(int x) { return x * 23; }
+inline int f4683_24(int x) { return x * 24; }
+inline int f4683_25(int x) { return x * 25; }
+inline int f4683_26(int x) { return x * 26; }
+inline int f4683_27(int x) { return x * 27; }
+inline int f4683_28(int x) { return x * 28; }
+inline int f4683_29(int x) { return x * 29; }
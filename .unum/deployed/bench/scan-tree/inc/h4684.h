@@ -0,0 +1,42 @@
+#pragma once
+/* header 4684 */
+#include <vector>
+#include "h134.h"
+#include "h2374.h"
+#include "h1146.h"
+#include "h275.h"
+#include "h9741.h"
+#ifdef X
+#include "h3988.h"
+#endif
+struct S4684 { int a; const char *s = "x//y"; };
+inline int f4684_0(int x) { return x * 0; }
+inline int f4684_1(int x) { return x * 1; }
+inline int f4684_2(int x) { return x * 2; }
+inline int f4684_3(int x) { return x * 3; }
+inline int f4684_4(int x) { return x * 4; }
+inline int f4684_5(int x) { return x * 5; }
+inline int f4684_6(int x) { return x * 6; }
+inline int f4684_7(int x) { return x * 7; }
+inline int f4684_8(int x) { return x * 8; }
+inline int f4684_9(int x) { return x * 9; }
+inline int f4684_10(int x) { return x * 10; }
+inline int f4684_11(int x) { return x * 11; }
+inline int f4684_12(int x) { return x * 12; }
+inline int f4684_13(int x) { return x * 13; }
+inline int f4684_14(int x) { return x * 14; }
+inline int f4684_15(int x) { return x * 15; }
+inline int f4684_16(int x) { return x * 16; }
+inline int f4684_17(int x) { return x * 17; }
+inline int f4684_18(int x) { return x * 18; }
+inline int f4684_19(int x) { return x * 19; }
+inline int f4684_20(int x) { return x * 20; }
+inline int f4684_21(int x) { return x * 21; }
+inline int f4684_22(int x) { return x * 22; }
+inline int f4684_23(int x) { return x * 23; }
+inline int f4684_24(int x) { return x * 24; }
+inline int f4684_25(int x) { return x * 25; }
+inline int f4684_26(int x) { return x * 26; }
+inline int f4684_27(int x) { return x * 27; }
+inline int f4684_28(int x) { return x * 28; }
+inline int f4684_29(int x) { return x * 29; }
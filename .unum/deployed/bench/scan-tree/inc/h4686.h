@@ -0,0 +1,42 @@
+#pragma once
+/* header 4686 */
+#include <vector>
+#include "h9501.h"
+#include "h5392.h"
+#include "h3510.h"
+#include "h4987.h"
+#include "h236.h"
+#ifdef X
+#include "h5755.h"
+#endif
+struct S4686 { int a; const char *s = "x//y"; };
+inline int f4686_0(int x) { return x * 0; }
+inline int f4686_1(int x) { return x * 1; }
+inline int f4686_2(int x) { return x * 2; }
+inline int f4686_3(int x) { return x * 3; }
+inline int f4686_4(int x) { return x * 4; }
+inline int f4686_5(int x) { return x * 5; }
+inline int f4686_6(int x) { return x * 6; }
+inline int f4686_7(int x) { return x * 7; }
+inline int f4686_8(int x) { return x * 8; }
+inline int f4686_9(int x) { return x * 9; }
+inline int f4686_10(int x) { return x * 10; }
+inline int f4686_11(int x) { return x * 11; }
+inline int f4686_12(int x) { return x * 12; }
+inline int f4686_13(int x) { return x * 13; }
+inline int f4686_14(int x) { return x * 14; }
+inline int f4686_15(int x) { return x * 15; }
+inline int f4686_16(int x) { return x * 16; }
+inline int f4686_17(int x) { return x * 17; }
+inline int f4686_18(int x) { return x * 18; }
+inline int f4686_19(int x) { return x * 19; }
+inline int f4686_20(int x) { return x * 20; }
+inline int f4686_21(int x) { return x * 21; }
+inline int f4686_22(int x) { return x * 22; }
+inline int f4686_23(int x) { return x * 23; }
+inline int f4686_24(int x) { return x * 24; }
+inline int f4686_25(int x) { return x * 25; }
+inline int f4686_26(int x) { return x * 26; }
+inline int f4686_27(int x) { return x * 27; }
+inline int f4686_28(int x) { return x * 28; }
+inline int f4686_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4687 */
+#include <vector>
+#include "h5769.h"
+#include "h7276.h"
+#include "h2380.h"
+#include "h1053.h"
+#include "h3586.h"
+#ifdef X
+#include "h1146.h"
+#endif
+struct S4687 { int a; const char *s = "x//y"; };
+inline int f4687_0(int x) { return x * 0; }
+inline int f4687_1(int x) { return x * 1; }
+inline int f4687_2(int x) { return x * 2; }
+inline int f4687_3(int x) { return x * 3; }
+inline int f4687_4(int x) { return x * 4; }
+inline int f4687_5(int x) { return x * 5; }
+inline int f4687_6(int x) { return x * 6; }
+inline int f4687_7(int x) { return x * 7; }
+inline int f4687_8(int x) { return x * 8; }
+inline int f4687_9(int x) { return x * 9; }
+inline int f4687_10(int x) { return x * 10; }
+inline int f4687_11(int x) { return x * 11; }
+inline int f4687_12(int x) { return x * 12; }
+inline int f4687_13(int x) { return x * 13; }
+inline int f4687_14(int x) { return x * 14; }
+inline int f4687_15(int x) { return x * 15; }
+inline int f4687_16(int x) { return x * 16; }
+inline int f4687_17(int x) { return x * 17; }
+inline int f4687_18(int x) { return x * 18; }
+inline int f4687_19(int x) { return x * 19; }
+inline int f4687_20(int x) { return x * 20; }
+inline int f4687_21(int x) { return x * 21; }
+inline int f4687_22(int x) { return x * 22; }
+inline int f4687_23(int x) { return x * 23; }
+inline int f4687_24(int x) { return x * 24; }
+inline int f4687_25(int x) { return x * 25; }
+inline int f4687_26(int x) { return x * 26; }
+inline int f4687_27(int x) { return x * 27; }
+inline int f4687_28(int x) { return x * 28; }
+inline int f4687_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4691 */
+#include <vector>
+#include "h49.h"
+#include "h4802.h"
+#include "h7375.h"
+#include "h5880.h"
+#include "h8751.h"
+#ifdef X
+#include "h2302.h"
+#endif
+struct S4691 { int a; const char *s = "x//y"; };
+inline int f4691_0(int x) { return x * 0; }
+inline int f4691_1(int x) { return x * 1; }
+inline int f4691_2(int x) { return x * 2; }
+inline int f4691_3(int x) { return x * 3; }
+inline int f4691_4(int x) { return x * 4; }
+inline int f4691_5(int x) { return x * 5; }
+inline int f4691_6(int x) { return x * 6; }
+inline int f4691_7(int x) { return x * 7; }
+inline int f4691_8(int x) { return x * 8; }
+inline int f4691_9(int x) { return x * 9; }
+inline int f4691_10(int x) { return x * 10; }
+inline int f4691_11(int x) { return x * 11; }
+inline int f4691_12(int x) { return x * 12; }
+inline int f4691_13(int x) { return x * 13; }
+inline int f4691_14(int x) { return x * 14; }
+inline int f4691_15(int x) { return x * 15; }
+inline int f4691_16(int x) { return x * 16; }
+inline int f4691_17(int x) { return x * 17; }
+inline int f4691_18(int x) { return x * 18; }
+inline int f4691_19(int x) { return x * 19; }
+inline int f4691_20(int x) { return x * 20; }
+inline int f4691_21(int x) { return x * 21; }
+inline int f4691_22(int x) { return x * 22; }
+inline int f4691_23(int x) { return x * 23; }
+inline int f4691_24(int x) { return x * 24; }
+inline int f4691_25(int x) { return x * 25; }
+inline int f4691_26(int x) { return x * 26; }
+inline int f4691_27(int x) { return x * 27; }
+inline int f4691_28(int x) { return x * 28; }
+inline int f4691_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4692 */
+#include <vector>
+#include "h5292.h"
+#include "h1353.h"
+#include "h5938.h"
+#include "h1399.h"
+#include "h6493.h"
+#ifdef X
+#include "h6384.h"
+#endif
+struct S4692 { int a; const char *s = "x//y"; };
+inline int f4692_0(int x) { return x * 0; }
+inline int f4692_1(int x) { return x * 1; }
+inline int f4692_2(int x) { return x * 2; }
+inline int f4692_3(int x) { return x * 3; }
+inline int f4692_4(int x) { return x * 4; }
+inline int f4692_5(int x) { return x * 5; }
+inline int f4692_6(int x) { return x * 6; }
+inline int f4692_7(int x) { return x * 7; }
+inline int f4692_8(int x) { return x * 8; }
+inline int f4692_9(int x) { return x * 9; }
+inline int f4692_10(int x) { return x * 10; }
+inline int f4692_11(int x) { return x * 11; }
+inline int f4692_12(int x) { return x * 12; }
+inline int f4692_13(int x) { return x * 13; }
+inline int f4692_14(int x) { return x * 14; }
+inline int f4692_15(int x) { return x * 15; }
+inline int f4692_16(int x) { return x * 16; }
+inline int f4692_17(int x) { return x * 17; }
+inline int f4692_18(int x) { return x * 18; }
+inline int f4692_19(int x) { return x * 19; }
+inline int f4692_20(int x) { return x * 20; }
+inline int f4692_21(int x) { return x * 21; }
+inline int f4692_22(int x) { return x * 22; }
+inline int f4692_23(int x) { return x * 23; }
+inline int f4692_24(int x) { return x * 24; }
+inline int f4692_25(int x) { return x * 25; }
+inline int f4692_26(int x) { return x * 26; }
+inline int f4692_27(int x) { return x * 27; }
+inline int f4692_28(int x) { return x * 28; }
+inline int f4692_29(int x) { return x * 29; }
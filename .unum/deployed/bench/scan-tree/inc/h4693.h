@@ -0,0 +1,42 @@
+#pragma once
+/* header 4693 */
+#include <vector>
+#include "h2619.h"
+#include "h4848.h"
+#include "h572.h"
+#include "h6703.h"
+#include "h7949.h"
+#ifdef X
+#include "h1656.h"
+#endif
+struct S4693 { int a; const char *s = "x//y"; };
+inline int f4693_0(int x) { return x * 0; }
+inline int f4693_1(int x) { return x * 1; }
+inline int f4693_2(int x) { return x * 2; }
+inline int f4693_3(int x) { return x * 3; }
+inline int f4693_4(int x) { return x * 4; }
+inline int f4693_5(int x) { return x * 5; }
+inline int f4693_6(int x) { return x * 6; }
+inline int f4693_7(int x) { return x * 7; }
+inline int f4693_8(int x) { return x * 8; }
+inline int f4693_9(int x) { return x * 9; }
+inline int f4693_10(int x) { return x * 10; }
+inline int f4693_11(int x) { return x * 11; }
+inline int f4693_12(int x) { return x * 12; }
+inline int f4693_13(int x) { return x * 13; }
+inline int f4693_14(int x) { return x * 14; }
+inline int f4693_15(int x) { return x * 15; }
+inline int f4693_16(int x) { return x * 16; }
+inline int f4693_17(int x) { return x * 17; }
+inline int f4693_18(int x) { return x * 18; }
+inline int f4693_19(int x) { return x * 19; }
+inline int f4693_20(int x) { return x * 20; }
+inline int f4693_21(int x) { return x * 21; }
+inline int f4693_22(int x) { return x * 22; }
+inline int f4693_23(int x) { return x * 23; }
+inline int f4693_24(int x) { return x * 24; }
+inline int f4693_25(int x) { return x * 25; }
+inline int f4693_26(int x) { return x * 26; }
+inline int f4693_27(int x) { return x * 27; }
+inline int f4693_28(int x) { return x * 28; }
+inline int f4693_29(int x) { return x * 29; }
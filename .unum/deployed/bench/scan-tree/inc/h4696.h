@@ -0,0 +1,42 @@
+#pragma once
+/* header 4696 */
+#include <vector>
+#include "h3511.h"
+#include "h7431.h"
+#include "h4914.h"
+#include "h3115.h"
+#include "h1944.h"
+#ifdef X
+#include "h5610.h"
+#endif
+struct S4696 { int a; const char *s = "x//y"; };
+inline int f4696_0(int x) { return x * 0; }
+inline int f4696_1(int x) { return x * 1; }
+inline int f4696_2(int x) { return x * 2; }
+inline int f4696_3(int x) { return x * 3; }
+inline int f4696_4(int x) { return x * 4; }
+inline int f4696_5(int x) { return x * 5; }
+inline int f4696_6(int x) { return x * 6; }
+inline int f4696_7(int x) { return x * 7; }
+inline int f4696_8(int x) { return x * 8; }
+inline int f4696_9(int x) { return x * 9; }
+inline int f4696_10(int x) { return x * 10; }
+inline int f4696_11(int x) { return x * 11; }
+inline int f4696_12(int x) { return x * 12; }
+inline int f4696_13(int x) { return x * 13; }
+inline int f4696_14(int x) { return x * 14; }
+inline int f4696_15(int x) { return x * 15; }
+inline int f4696_16(int x) { return x * 16; }
+inline int f4696_17(int x) { return x * 17; }
+inline int f4696_18(int x) { return x * 18; }
+inline int f4696_19(int x) { return x * 19; }
+inline int f4696_20(int x) { return x * 20; }
+inline int f4696_21(int x) { return x * 21; }
+inline int f4696_22(int x) { return x * 22; }
+inline int f4696_23(int x) { return x * 23; }
+inline int f4696_24(int x) { return x * 24; }
+inline int f4696_25(int x) { return x * 25; }
+inline int f4696_26(int x) { return x * 26; }
+inline int f4696_27(int x) { return x * 27; }
+inline int f4696_28(int x) { return x * 28; }
+inline int f4696_29(int x) { return x * 29; }
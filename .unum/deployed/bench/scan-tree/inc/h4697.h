@@ -0,0 +1,42 @@
+#pragma once
+/* header 4697 */
+#include <vector>
+#include "h6883.h"
+#include "h2623.h"
+#include "h2192.h"
+#include "h4204.h"
+#include "h6707.h"
+#ifdef X
+#include "h5639.h"
+#endif
+struct S4697 { int a; const char *s = "x//y"; };
+inline int f4697_0(int x) { return x * 0; }
+inline int f4697_1(int x) { return x * 1; }
+inline int f4697_2(int x) { return x * 2; }
+inline int f4697_3(int x) { return x * 3; }
+inline int f4697_4(int x) { return x * 4; }
+inline int f4697_5(int x) { return x * 5; }
+inline int f4697_6(int x) { return x * 6; }
+inline int f4697_7(int x) { return x * 7; }
+inline int f4697_8(int x) { return x * 8; }
+inline int f4697_9(int x) { return x * 9; }
+inline int f4697_10(int x) { return x * 10; }
+inline int f4697_11(int x) { return x * 11; }
+inline int f4697_12(int x) { return x * 12; }
+inline int f4697_13(int x) { return x * 13; }
+inline int f4697_14(int x) { return x * 14; }
+inline int f4697_15(int x) { return x * 15; }
+inline int f4697_16(int x) { return x * 16; }
+inline int f4697_17(int x) { return x * 17; }
+inline int f4697_18(int x) { return x * 18; }
+inline int f4697_19(int x) { return x * 19; }
+inline int f4697_20(int x) { return x * 20; }
+inline int f4697_21(int x) { return x * 21; }
+inline int f4697_22(int x) { return x * 22; }
+inline int f4697_23(int x) { return x * 23; }
+inline int f4697_24(int x) { return x * 24; }
+inline int f4697_25(int x) { return x * 25; }
+inline int f4697_26(int x) { return x * 26; }
+inline int f4697_27(int x) { return x * 27; }
+inline int f4697_28(int x) { return x * 28; }
+inline int f4697_29(int x) { return x * 29; }
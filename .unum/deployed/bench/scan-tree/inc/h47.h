@@ -0,0 +1,42 @@
+#pragma once
+/* header 47 */
+#include <vector>
+#include "h9483.h"
+#include "h9566.h"
+#include "h7908.h"
+#include "h1811.h"
+#include "h4667.h"
+#ifdef X
+#include "h7046.h"
+#endif
+struct S47 { int a; const char *s = "x//y"; };
+inline int f47_0(int x) { return x * 0; }
+inline int f47_1(int x) { return x * 1; }
+inline int f47_2(int x) { return x * 2; }
+inline int f47_3(int x) { return x * 3; }
+inline int f47_4(int x) { return x * 4; }
+inline int f47_5(int x) { return x * 5; }
+inline int f47_6(int x) { return x * 6; }
+inline int f47_7(int x) { return x * 7; }
+inline int f47_8(int x) { return x * 8; }
+inline int f47_9(int x) { return x * 9; }
+inline int f47_10(int x) { return x * 10; }
+inline int f47_11(int x) { return x * 11; }
+inline int f47_12(int x) { return x * 12; }
+inline int f47_13(int x) { return x * 13; }
+inline int f47_14(int x) { return x * 14; }
+inline int f47_15(int x) { return x * 15; }
+inline int f47_16(int x) { return x * 16; }
+inline int f47_17(int x) { return x * 17; }
+inline int f47_18(int x) { return x * 18; }
+inline int f47_19(int x) { return x * 19; }
+inline int f47_20(int x) { return x * 20; }
+inline int f47_21(int x) { return x * 21; }
+inline int f47_22(int x) { return x * 22; }
+inline int f47_23(int x) { return x * 23; }
+inline int f47_24(int x) { return x * 24; }
+inline int f47_25(int x) { return x * 25; }
+inline int f47_26(int x) { return x * 26; }
+inline int f47_27(int x) { return x * 27; }
+inline int f47_28(int x) { return x * 28; }
+inline int f47_29(int x) { return x * 29; }
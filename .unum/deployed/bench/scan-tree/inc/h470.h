@@ -0,0 +1,42 @@
+#pragma once
+/* header 470 */
+#include <vector>
+#include "h7722.h"
+#include "h941.h"
+#include "h5170.h"
+#include "h4004.h"
+#include "h8252.h"
+#ifdef X
+#include "h5426.h"
+#endif
+struct S470 { int a; const char *s = "x//y"; };
+inline int f470_0(int x) { return x * 0; }
+inline int f470_1(int x) { return x * 1; }
+inline int f470_2(int x) { return x * 2; }
+inline int f470_3(int x) { return x * 3; }
+inline int f470_4(int x) { return x * 4; }
+inline int f470_5(int x) { return x * 5; }
+inline int f470_6(int x) { return x * 6; }
+inline int f470_7(int x) { return x * 7; }
+inline int f470_8(int x) { return x * 8; }
+inline int f470_9(int x) { return x * 9; }
+inline int f470_10(int x) { return x * 10; }
+inline int f470_11(int x) { return x * 11; }
+inline int f470_12(int x) { return x * 12; }
+inline int f470_13(int x) { return x * 13; }
+inline int f470_14(int x) { return x * 14; }
+inline int f470_15(int x) { return x * 15; }
+inline int f470_16(int x) { return x * 16; }
+inline int f470_17(int x) { return x * 17; }
+inline int f470_18(int x) { return x * 18; }
+inline int f470_19(int x) { return x * 19; }
+inline int f470_20(int x) { return x * 20; }
+inline int f470_21(int x) { return x * 21; }
+inline int f470_22(int x) { return x * 22; }
+inline int f470_23(int x) { return x * 23; }
+inline int f470_24(int x) { return x * 24; }
+inline int f470_25(int x) { return x * 25; }
+inline int f470_26(int x) { return x * 26; }
+inline int f470_27(int x) { return x * 27; }
+inline int f470_28(int x) { return x * 28; }
+inline int f470_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4700 */
+#include <vector>
+#include "h3443.h"
+#include "h3124.h"
+#include "h3315.h"
+#include "h3584.h"
+#include "h8166.h"
+#ifdef X
+#include "h9754.h"
+#endif
+struct S4700 { int a; const char *s = "x//y"; };
+inline int f4700_0(int x) { return x * 0; }
+inline int f4700_1(int x) { return x * 1; }
+inline int f4700_2(int x) { return x * 2; }
+inline int f4700_3(int x) { return x * 3; }
+inline int f4700_4(int x) { return x * 4; }
+inline int f4700_5(int x) { return x * 5; }
+inline int f4700_6(int x) { return x * 6; }
+inline int f4700_7(int x) { return x * 7; }
+inline int f4700_8(int x) { return x * 8; }
+inline int f4700_9(int x) { return x * 9; }
+inline int f4700_10(int x) { return x * 10; }
+inline int f4700_11(int x) { return x * 11; }
+inline int f4700_12(int x) { return x * 12; }
+inline int f4700_13(int x) { return x * 13; }
+inline int f4700_14(int x) { return x * 14; }
+inline int f4700_15(int x) { return x * 15; }
+inline int f4700_16(int x) { return x * 16; }
+inline int f4700_17(int x) { return x * 17; }
+inline int f4700_18(int x) { return x * 18; }
+inline int f4700_19(int x) { return x * 19; }
+inline int f4700_20(int x) { return x * 20; }
+inline int f4700_21(int x) { return x * 21; }
+inline int f4700_22(int x) { return x * 22; }
+inline int f4700_23(int x) { return x * 23; }
+inline int f4700_24(int x) { return x * 24; }
+inline int f4700_25(int x) { return x * 25; }
+inline int f4700_26(int x) { return x * 26; }
+inline int f4700_27(int x) { return x * 27; }
+inline int f4700_28(int x) { return x * 28; }
+inline int f4700_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4701 */
+#include <vector>
+#include "h6899.h"
+#include "h7790.h"
+#include "h8339.h"
+#include "h5682.h"
+#include "h2712.h"
+#ifdef X
+#include "h9059.h"
+#endif
+struct S4701 { int a; const char *s = "x//y"; };
+inline int f4701_0(int x) { return x * 0; }
+inline int f4701_1(int x) { return x * 1; }
+inline int f4701_2(int x) { return x * 2; }
+inline int f4701_3(int x) { return x * 3; }
+inline int f4701_4(int x) { return x * 4; }
+inline int f4701_5(int x) { return x * 5; }
+inline int f4701_6(int x) { return x * 6; }
+inline int f4701_7(int x) { return x * 7; }
+inline int f4701_8(int x) { return x * 8; }
+inline int f4701_9(int x) { return x * 9; }
+inline int f4701_10(int x) { return x * 10; }
+inline int f4701_11(int x) { return x * 11; }
+inline int f4701_12(int x) { return x * 12; }
+inline int f4701_13(int x) { return x * 13; }
+inline int f4701_14(int x) { return x * 14; }
+inline int f4701_15(int x) { return x * 15; }
+inline int f4701_16(int x) { return x * 16; }
+inline int f4701_17(int x) { return x * 17; }
+inline int f4701_18(int x) { return x * 18; }
+inline int f4701_19(int x) { return x * 19; }
+inline int f4701_20(int x) { return x * 20; }
+inline int f4701_21(int x) { return x * 21; }
+inline int f4701_22(int x) { return x * 22; }
+inline int f4701_23(int x) { return x * 23; }
+inline int f4701_24(int x) { return x * 24; }
+inline int f4701_25(int x) { return x * 25; }
+inline int f4701_26(int x) { return x * 26; }
+inline int f4701_27(int x) { return x * 27; }
+inline int f4701_28(int x) { return x * 28; }
+inline int f4701_29(int x) { return x * 29; }
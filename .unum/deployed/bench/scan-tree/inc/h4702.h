@@ -0,0 +1,42 @@
+#pragma once
+/* header 4702 */
+#include <vector>
+#include "h8815.h"
+#include "h2784.h"
+#include "h8940.h"
+#include "h6471.h"
+#include "h4487.h"
+#ifdef X
+#include "h2086.h"
+#endif
+struct S4702 { int a; const char *s = "x//y"; };
+inline int f4702_0(int x) { return x * 0; }
+inline int f4702_1(int x) { return x * 1; }
+inline int f4702_2(int x) { return x * 2; }
+inline int f4702_3(int x) { return x * 3; }
+inline int f4702_4(int x) { return x * 4; }
+inline int f4702_5(int x) { return x * 5; }
+inline int f4702_6(int x) { return x * 6; }
+inline int f4702_7(int x) { return x * 7; }
+inline int f4702_8(int x) { return x * 8; }
+inline int f4702_9(int x) { return x * 9; }
+inline int f4702_10(int x) { return x * 10; }
+inline int f4702_11(int x) { return x * 11; }
+inline int f4702_12(int x) { return x * 12; }
+inline int f4702_13(int x) { return x * 13; }
+inline int f4702_14(int x) { return x * 14; }
+inline int f4702_15(int x) { return x * 15; }
+inline int f4702_16(int x) { return x * 16; }
+inline int f4702_17(int x) { return x * 17; }
+inline int f4702_18(int x) { return x * 18; }
+inline int f4702_19(int x) { return x * 19; }
+inline int f4702_20(int x) { return x * 20; }
+inline int f4702_21(int x) { return x * 21; }
+inline int f4702_22(int x) { return x * 22; }
+inline int f4702_23(int x) { return x * 23; }
+inline int f4702_24(int x) { return x * 24; }
+inline int f4702_25(int x) { return x * 25; }
+inline int f4702_26(int x) { return x * 26; }
+inline int f4702_27(int x) { return x * 27; }
+inline int f4702_28(int x) { return x * 28; }
+inline int f4702_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4703 */
+#include <vector>
+#include "h9422.h"
+#include "h3176.h"
+#include "h7745.h"
+#include "h7982.h"
+#include "h2353.h"
+#ifdef X
+#include "h5393.h"
+#endif
+struct S4703 { int a; const char *s = "x//y"; };
+inline int f4703_0(int x) { return x * 0; }
+inline int f4703_1(int x) { return x * 1; }
+inline int f4703_2(int x) { return x * 2; }
+inline int f4703_3(int x) { return x * 3; }
+inline int f4703_4(int x) { return x * 4; }
+inline int f4703_5(int x) { return x * 5; }
+inline int f4703_6(int x) { return x * 6; }
+inline int f4703_7(int x) { return x * 7; }
+inline int f4703_8(int x) { return x * 8; }
+inline int f4703_9(int x) { return x * 9; }
+inline int f4703_10(int x) { return x * 10; }
+inline int f4703_11(int x) { return x * 11; }
+inline int f4703_12(int x) { return x * 12; }
+inline int f4703_13(int x) { return x * 13; }
+inline int f4703_14(int x) { return x * 14; }
+inline int f4703_15(int x) { return x * 15; }
+inline int f4703_16(int x) { return x * 16; }
+inline int f4703_17(int x) { return x * 17; }
+inline int f4703_18(int x) { return x * 18; }
+inline int f4703_19(int x) { return x * 19; }
+inline int f4703_20(int x) { return x * 20; }
+inline int f4703_21(int x) { return x * 21; }
+inline int f4703_22(int x) { return x * 22; }
+inline int f4703_23(int x) { return x * 23; }
+inline int f4703_24(int x) { return x * 24; }
+inline int f4703_25(int x) { return x * 25; }
+inline int f4703_26(int x) { return x * 26; }
+inline int f4703_27(int x) { return x * 27; }
+inline int f4703_28(int x) { return x * 28; }
+inline int f4703_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4708 */
+#include <vector>
+#include "h5840.h"
+#include "h7251.h"
+#include "h6360.h"
+#include "h5617.h"
+#include "h8786.h"
+#ifdef X
+#include "h4185.h"
+#endif
+struct S4708 { int a; const char *s = "x//y"; };
+inline int f4708_0(int x) { return x * 0; }
+inline int f4708_1(int x) { return x * 1; }
+inline int f4708_2(int x) { return x * 2; }
+inline int f4708_3(int x) { return x * 3; }
+inline int f4708_4(int x) { return x * 4; }
+inline int f4708_5(int x) { return x * 5; }
+inline int f4708_6(int x) { return x * 6; }
+inline int f4708_7(int x) { return x * 7; }
+inline int f4708_8(int x) { return x * 8; }
+inline int f4708_9(int x) { return x * 9; }
+inline int f4708_10(int x) { return x * 10; }
+inline int f4708_11(int x) { return x * 11; }
+inline int f4708_12(int x) { return x * 12; }
+inline int f4708_13(int x) { return x * 13; }
+inline int f4708_14(int x) { return x * 14; }
+inline int f4708_15(int x) { return x * 15; }
+inline int f4708_16(int x) { return x * 16; }
+inline int f4708_17(int x) { return x * 17; }
+inline int f4708_18(int x) { return x * 18; }
+inline int f4708_19(int x) { return x * 19; }
+inline int f4708_20(int x) { return x * 20; }
+inline int f4708_21(int x) { return x * 21; }
+inline int f4708_22(int x) { return x * 22; }
+inline int f4708_23(int x) { return x * 23; }
+inline int f4708_24(int x) { return x * 24; }
+inline int f4708_25(int x) { return x * 25; }
+inline int f4708_26(int x) { return x * 26; }
+inline int f4708_27(int x) { return x * 27; }
+inline int f4708_28(int x) { return x * 28; }
+inline int f4708_29(int x) { return x * 29; }
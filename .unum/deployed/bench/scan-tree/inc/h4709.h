@@ -0,0 +1,42 @@
+#pragma once
+/* header 4709 */
+#include <vector>
+#include "h6762.h"
+#include "h7949.h"
+#include "h9068.h"
+#include "h8990.h"
+#include "h7426.h"
+#ifdef X
+#include "h6505.h"
+#endif
+struct S4709 { int a; const char *s = "x//y"; };
+inline int f4709_0(int x) { return x * 0; }
+inline int f4709_1(int x) { return x * 1; }
+inline int f4709_2(int x) { return x * 2; }
+inline int f4709_3(int x) { return x * 3; }
+inline int f4709_4(int x) { return x * 4; }
+inline int f4709_5(int x) { return x * 5; }
+inline int f4709_6(int x) { return x * 6; }
+inline int f4709_7(int x) { return x * 7; }
+inline int f4709_8(int x) { return x * 8; }
+inline int f4709_9(int x) { return x * 9; }
+inline int f4709_10(int x) { return x * 10; }
+inline int f4709_11(int x) { return x * 11; }
+inline int f4709_12(int x) { return x * 12; }
+inline int f4709_13(int x) { return x * 13; }
+inline int f4709_14(int x) { return x * 14; }
+inline int f4709_15(int x) { return x * 15; }
+inline int f4709_16(int x) { return x * 16; }
+inline int f4709_17(int x) { return x * 17; }
+inline int f4709_18(int x) { return x * 18; }
+inline int f4709_19(int x) { return x * 19; }
+inline int f4709_20(int x) { return x * 20; }
+inline int f4709_21(int x) { return x * 21; }
+inline int f4709_22(int x) { return x * 22; }
+inline int f4709_23(int x) { return x * 23; }
+inline int f4709_24(int x) { return x * 24; }
+inline int f4709_25(int x) { return x * 25; }
+inline int f4709_26(int x) { return x * 26; }
+inline int f4709_27(int x) { return x * 27; }
+inline int f4709_28(int x) { return x * 28; }
+inline int f4709_29(int x) { return x * 29; }
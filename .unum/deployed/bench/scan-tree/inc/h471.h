@@ -0,0 +1,42 @@
+#pragma once
+/* header 471 */
+#include <vector>
+#include "h4918.h"
+#include "h8818.h"
+#include "h1030.h"
+#include "h4771.h"
+#include "h9484.h"
+#ifdef X
+#include "h7620.h"
+#endif
+struct S471 { int a; const char *s = "x//y"; };
+inline int f471_0(int x) { return x * 0; }
+inline int f471_1(int x) { return x * 1; }
+inline int f471_2(int x) { return x * 2; }
+inline int f471_3(int x) { return x * 3; }
+inline int f471_4(int x) { return x * 4; }
+inline int f471_5(int x) { return x * 5; }
+inline int f471_6(int x) { return x * 6; }
+inline int f471_7(int x) { return x * 7; }
+inline int f471_8(int x) { return x * 8; }
+inline int f471_9(int x) { return x * 9; }
+inline int f471_10(int x) { return x * 10; }
+inline int f471_11(int x) { return x * 11; }
+inline int f471_12(int x) { return x * 12; }
+inline int f471_13(int x) { return x * 13; }
+inline int f471_14(int x) { return x * 14; }
+inline int f471_15(int x) { return x * 15; }
+inline int f471_16(int x) { return x * 16; }
+inline int f471_17(int x) { return x * 17; }
+inline int f471_18(int x) { return x * 18; }
+inline int f471_19(int x) { return x * 19; }
+inline int f471_20(int x) { return x * 20; }
+inline int f471_21(int x) { return x * 21; }
+inline int f471_22(int x) { return x * 22; }
+inline int f471_23(int x) { return x * 23; }
+inline int f471_24(int x) { return x * 24; }
+inline int f471_25(int x) { return x * 25; }
+inline int f471_26(int x) { return x * 26; }
+inline int f471_27(int x) { return x * 27; }
+inline int f471_28(int x) { return x * 28; }
+inline int f471_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4710 */
+#include <vector>
+#include "h8392.h"
+#include "h5924.h"
+#include "h2566.h"
+#include "h5659.h"
+#include "h3232.h"
+#ifdef X
+#include "h751.h"
+#endif
+struct S4710 { int a; const char *s = "x//y"; };
+inline int f4710_0(int x) { return x * 0; }
+inline int f4710_1(int x) { return x * 1; }
+inline int f4710_2(int x) { return x * 2; }
+inline int f4710_3(int x) { return x * 3; }
+inline int f4710_4(int x) { return x * 4; }
+inline int f4710_5(int x) { return x * 5; }
+inline int f4710_6(int x) { return x * 6; }
+inline int f4710_7(int x) { return x * 7; }
+inline int f4710_8(int x) { return x * 8; }
+inline int f4710_9(int x) { return x * 9; }
+inline int f4710_10(int x) { return x * 10; }
+inline int f4710_11(int x) { return x * 11; }
+inline int f4710_12(int x) { return x * 12; }
+inline int f4710_13(int x) { return x * 13; }
+inline int f4710_14(int x) { return x * 14; }
+inline int f4710_15(int x) { return x * 15; }
+inline int f4710_16(int x) { return x * 16; }
+inline int f4710_17(int x) { return x * 17; }
+inline int f4710_18(int x) { return x * 18; }
+inline int f4710_19(int x) { return x * 19; }
+inline int f4710_20(int x) { return x * 20; }
+inline int f4710_21(int x) { return x * 21; }
+inline int f4710_22(int x) { return x * 22; }
+inline int f4710_23(int x) { return x * 23; }
+inline int f4710_24(int x) { return x * 24; }
+inline int f4710_25(int x) { return x * 25; }
+inline int f4710_26(int x) { return x * 26; }
+inline int f4710_27(int x) { return x * 27; }
+inline int f4710_28(int x) { return x * 28; }
+inline int f4710_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4711 */
+#include <vector>
+#include "h8340.h"
+#include "h13.h"
+#include "h7031.h"
+#include "h505.h"
+#include "h9329.h"
+#ifdef X
+#include "h8409.h"
+#endif
+struct S4711 { int a; const char *s = "x//y"; };
+inline int f4711_0(int x) { return x * 0; }
+inline int f4711_1(int x) { return x * 1; }
+inline int f4711_2(int x) { return x * 2; }
+inline int f4711_3(int x) { return x * 3; }
+inline int f4711_4(int x) { return x * 4; }
+inline int f4711_5(int x) { return x * 5; }
+inline int f4711_6(int x) { return x * 6; }
+inline int f4711_7(int x) { return x * 7; }
+inline int f4711_8(int x) { return x * 8; }
+inline int f4711_9(int x) { return x * 9; }
+inline int f4711_10(int x) { return x * 10; }
+inline int f4711_11(int x) { return x * 11; }
+inline int f4711_12(int x) { return x * 12; }
+inline int f4711_13(int x) { return x * 13; }
+inline int f4711_14(int x) { return x * 14; }
+inline int f4711_15(int x) { return x * 15; }
+inline int f4711_16(int x) { return x * 16; }
+inline int f4711_17(int x) { return x * 17; }
+inline int f4711_18(int x) { return x * 18; }
+inline int f4711_19(int x) { return x * 19; }
+inline int f4711_20(int x) { return x * 20; }
+inline int f4711_21(int x) { return x * 21; }
+inline int f4711_22(int x) { return x * 22; }
+inline int f4711_23(int x) { return x * 23; }
+inline int f4711_24(int x) { return x * 24; }
+inline int f4711_25(int x) { return x * 25; }
+inline int f4711_26(int x) { return x * 26; }
+inline int f4711_27(int x) { return x * 27; }
+inline int f4711_28(int x) { return x * 28; }
+inline int f4711_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4714 */
+#include <vector>
+#include "h6895.h"
+#include "h4533.h"
+#include "h6231.h"
+#include "h8469.h"
+#include "h9326.h"
+#ifdef X
+#include "h8952.h"
+#endif
+struct S4714 { int a; const char *s = "x//y"; };
+inline int f4714_0(int x) { return x * 0; }
+inline int f4714_1(int x) { return x * 1; }
+inline int f4714_2(int x) { return x * 2; }
+inline int f4714_3(int x) { return x * 3; }
+inline int f4714_4(int x) { return x * 4; }
+inline int f4714_5(int x) { return x * 5; }
+inline int f4714_6(int x) { return x * 6; }
+inline int f4714_7(int x) { return x * 7; }
+inline int f4714_8(int x) { return x * 8; }
+inline int f4714_9(int x) { return x * 9; }
+inline int f4714_10(int x) { return x * 10; }
+inline int f4714_11(int x) { return x * 11; }
+inline int f4714_12(int x) { return x * 12; }
+inline int f4714_13(int x) { return x * 13; }
+inline int f4714_14(int x) { return x * 14; }
+inline int f4714_15(int x) { return x * 15; }
+inline int f4714_16(int x) { return x * 16; }
+inline int f4714_17(int x) { return x * 17; }
+inline int f4714_18(int x) { return x * 18; }
+inline int f4714_19(int x) { return x * 19; }
+inline int f4714_20(int x) { return x * 20; }
+inline int f4714_21(int x) { return x * 21; }
+inline int f4714_22(int x) { return x * 22; }
+inline int f4714_23(int x) { return x * 23; }
+inline int f4714_24(int x) { return x * 24; }
+inline int f4714_25(int x) { return x * 25; }
+inline int f4714_26(int x) { return x * 26; }
+inline int f4714_27(int x) { return x * 27; }
+inline int f4714_28(int x) { return x * 28; }
+inline int f4714_29(int x) { return x * 29; }
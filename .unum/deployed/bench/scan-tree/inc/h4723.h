@@ -0,0 +1,42 @@
+#pragma once
+/* header 4723 */
+#include <vector>
+#include "h7532.h"
+#include "h7473.h"
+#include "h3113.h"
+#include "h8521.h"
+#include "h6715.h"
+#ifdef X
+#include "h4013.h"
+#endif
+struct S4723 { int a; const char *s = "x//y"; };
+inline int f4723_0(int x) { return x * 0; }
+inline int f4723_1(int x) { return x * 1; }
+inline int f4723_2(int x) { return x * 2; }
+inline int f4723_3(int x) { return x * 3; }
+inline int f4723_4(int x) { return x * 4; }
+inline int f4723_5(int x) { return x * 5; }
+inline int f4723_6(int x) { return x * 6; }
+inline int f4723_7(int x) { return x * 7; }
+inline int f4723_8(int x) { return x * 8; }
+inline int f4723_9(int x) { return x * 9; }
+inline int f4723_10(int x) { return x * 10; }
+inline int f4723_11(int x) { return x * 11; }
+inline int f4723_12(int x) { return x * 12; }
+inline int f4723_13(int x) { return x * 13; }
+inline int f4723_14(int x) { return x * 14; }
+inline int f4723_15(int x) { return x * 15; }
+inline int f4723_16(int x) { return x * 16; }
+inline int f4723_17(int x) { return x * 17; }
+inline int f4723_18(int x) { return x * 18; }
+inline int f4723_19(int x) { return x * 19; }
+inline int f4723_20(int x) { return x * 20; }
+inline int f4723_21(int x) { return x * 21; }
+inline int f4723_22(int x) { return x * 22; }
+inline int f4723_23(int x) { return x * 23; }
+inline int f4723_24(int x) { return x * 24; }
+inline int f4723_25(int x) { return x * 25; }
+inline int f4723_26(int x) { return x * 26; }
+inline int f4723_27(int x) { return x * 27; }
+inline int f4723_28(int x) { return x * 28; }
+inline int f4723_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4724 */
+#include <vector>
+#include "h9697.h"
+#include "h4298.h"
+#include "h5007.h"
+#include "h9338.h"
+#include "h2246.h"
+#ifdef X
+#include "h1055.h"
+#endif
+struct S4724 { int a; const char *s = "x//y"; };
+inline int f4724_0(int x) { return x * 0; }
+inline int f4724_1(int x) { return x * 1; }
+inline int f4724_2(int x) { return x * 2; }
+inline int f4724_3(int x) { return x * 3; }
+inline int f4724_4(int x) { return x * 4; }
+inline int f4724_5(int x) { return x * 5; }
+inline int f4724_6(int x) { return x * 6; }
+inline int f4724_7(int x) { return x * 7; }
+inline int f4724_8(int x) { return x * 8; }
+inline int f4724_9(int x) { return x * 9; }
+inline int f4724_10(int x) { return x * 10; }
+inline int f4724_11(int x) { return x * 11; }
+inline int f4724_12(int x) { return x * 12; }
+inline int f4724_13(int x) { return x * 13; }
+inline int f4724_14(int x) { return x * 14; }
+inline int f4724_15(int x) { return x * 15; }
+inline int f4724_16(int x) { return x * 16; }
+inline int f4724_17(int x) { return x * 17; }
+inline int f4724_18(int x) { return x * 18; }
+inline int f4724_19(int x) { return x * 19; }
+inline int f4724_20(int x) { return x * 20; }
+inline int f4724_21(int x) { return x * 21; }
+inline int f4724_22(int x) { return x * 22; }
+inline int f4724_23(int x) { return x * 23; }
+inline int f4724_24(int x) { return x * 24; }
+inline int f4724_25(int x) { return x * 25; }
+inline int f4724_26(int x) { return x * 26; }
+inline int f4724_27(int x) { return x * 27; }
+inline int f4724_28(int x) { return x * 28; }
+inline int f4724_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4725 */
+#include <vector>
+#include "h4485.h"
+#include "h3426.h"
+#include "h1050.h"
+#include "h8357.h"
+#include "h4390.h"
+#ifdef X
+#include "h7941.h"
+#endif
+struct S4725 { int a; const char *s = "x//y"; };
+inline int f4725_0(int x) { return x * 0; }
+inline int f4725_1(int x) { return x * 1; }
+inline int f4725_2(int x) { return x * 2; }
+inline int f4725_3(int x) { return x * 3; }
+inline int f4725_4(int x) { return x * 4; }
+inline int f4725_5(int x) { return x * 5; }
+inline int f4725_6(int x) { return x * 6; }
+inline int f4725_7(int x) { return x * 7; }
+inline int f4725_8(int x) { return x * 8; }
+inline int f4725_9(int x) { return x * 9; }
+inline int f4725_10(int x) { return x * 10; }
+inline int f4725_11(int x) { return x * 11; }
+inline int f4725_12(int x) { return x * 12; }
+inline int f4725_13(int x) { return x * 13; }
+inline int f4725_14(int x) { return x * 14; }
+inline int f4725_15(int x) { return x * 15; }
+inline int f4725_16(int x) { return x * 16; }
+inline int f4725_17(int x) { return x * 17; }
+inline int f4725_18(int x) { return x * 18; }
+inline int f4725_19(int x) { return x * 19; }
+inline int f4725_20(int x) { return x * 20; }
+inline int f4725_21(int x) { return x * 21; }
+inline int f4725_22(int x) { return x * 22; }
+inline int f4725_23(int x) { return x * 23; }
+inline int f4725_24(int x) { return x * 24; }
+inline int f4725_25(int x) { return x * 25; }
+inline int f4725_26(int x) { return x * 26; }
+inline int f4725_27(int x) { return x * 27; }
+inline int f4725_28(int x) { return x * 28; }
+inline int f4725_29(int x) { return x * 29; }
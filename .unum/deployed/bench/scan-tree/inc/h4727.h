@@ -0,0 +1,42 @@
+#pragma once
+/* header 4727 */
+#include <vector>
+#include "h9872.h"
+#include "h7136.h"
+#include "h2231.h"
+#include "h3844.h"
+#include "h976.h"
+#ifdef X
+#include "h7033.h"
+#endif
+struct S4727 { int a; const char *s = "x//y"; };
+inline int f4727_0(int x) { return x * 0; }
+inline int f4727_1(int x) { return x * 1; }
+inline int f4727_2(int x) { return x * 2; }
+inline int f4727_3(int x) { return x * 3; }
+inline int f4727_4(int x) { return x * 4; }
+inline int f4727_5(int x) { return x * 5; }
+inline int f4727_6(int x) { return x * 6; }
+inline int f4727_7(int x) { return x * 7; }
+inline int f4727_8(int x) { return x * 8; }
+inline int f4727_9(int x) { return x * 9; }
+inline int f4727_10(int x) { return x * 10; }
+inline int f4727_11(int x) { return x * 11; }
+inline int f4727_12(int x) { return x * 12; }
+inline int f4727_13(int x) { return x * 13; }
+inline int f4727_14(int x) { return x * 14; }
+inline int f4727_15(int x) { return x * 15; }
+inline int f4727_16(int x) { return x * 16; }
+inline int f4727_17(int x) { return x * 17; }
+inline int f4727_18(int x) { return x * 18; }
+inline int f4727_19(int x) { return x * 19; }
+inline int f4727_20(int x) { return x * 20; }
+inline int f4727_21(int x) { return x * 21; }
+inline int f4727_22(int x) { return x * 22; }
+inline int f4727_23(int x) { return x * 23; }
+inline int f4727_24(int x) { return x * 24; }
+inline int f4727_25(int x) { return x * 25; }
+inline int f4727_26(int x) { return x * 26; }
+inline int f4727_27(int x) { return x * 27; }
+inline int f4727_28(int x) { return x * 28; }
+inline int f4727_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4728 */
+#include <vector>
+#include "h5913.h"
+#include "h8081.h"
+#include "h2617.h"
+#include "h7982.h"
+#include "h2672.h"
+#ifdef X
+#include "h7147.h"
+#endif
+struct S4728 { int a; const char *s = "x//y"; };
+inline int f4728_0(int x) { return x * 0; }
+inline int f4728_1(int x) { return x * 1; }
+inline int f4728_2(int x) { return x * 2; }
+inline int f4728_3(int x) { return x * 3; }
+inline int f4728_4(int x) { return x * 4; }
+inline int f4728_5(int x) { return x * 5; }
+inline int f4728_6(int x) { return x * 6; }
+inline int f4728_7(int x) { return x * 7; }
+inline int f4728_8(int x) { return x * 8; }
+inline int f4728_9(int x) { return x * 9; }
+inline int f4728_10(int x) { return x * 10; }
+inline int f4728_11(int x) { return x * 11; }
+inline int f4728_12(int x) { return x * 12; }
+inline int f4728_13(int x) { return x * 13; }
+inline int f4728_14(int x) { return x * 14; }
+inline int f4728_15(int x) { return x * 15; }
+inline int f4728_16(int x) { return x * 16; }
+inline int f4728_17(int x) { return x * 17; }
+inline int f4728_18(int x) { return x * 18; }
+inline int f4728_19(int x) { return x * 19; }
+inline int f4728_20(int x) { return x * 20; }
+inline int f4728_21(int x) { return x * 21; }
+inline int f4728_22(int x) { return x * 22; }
+inline int f4728_23(int x) { return x * 23; }
+inline int f4728_24(int x) { return x * 24; }
+inline int f4728_25(int x) { return x * 25; }
+inline int f4728_26(int x) { return x * 26; }
+inline int f4728_27(int x) { return x * 27; }
+inline int f4728_28(int x) { return x * 28; }
+inline int f4728_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4731 */
+#include <vector>
+#include "h811.h"
+#include "h8724.h"
+#include "h4448.h"
+#include "h2555.h"
+#include "h2731.h"
+#ifdef X
+#include "h6319.h"
+#endif
+struct S4731 { int a; const char *s = "x//y"; };
+inline int f4731_0(int x) { return x * 0; }
+inline int f4731_1(int x) { return x * 1; }
+inline int f4731_2(int x) { return x * 2; }
+inline int f4731_3(int x) { return x * 3; }
+inline int f4731_4(int x) { return x * 4; }
+inline int f4731_5(int x) { return x * 5; }
+inline int f4731_6(int x) { return x * 6; }
+inline int f4731_7(int x) { return x * 7; }
+inline int f4731_8(int x) { return x * 8; }
+inline int f4731_9(int x) { return x * 9; }
+inline int f4731_10(int x) { return x * 10; }
+inline int f4731_11(int x) { return x * 11; }
+inline int f4731_12(int x) { return x * 12; }
+inline int f4731_13(int x) { return x * 13; }
+inline int f4731_14(int x) { return x * 14; }
+inline int f4731_15(int x) { return x * 15; }
+inline int f4731_16(int x) { return x * 16; }
+inline int f4731_17(int x) { return x * 17; }
+inline int f4731_18(int x) { return x * 18; }
+inline int f4731_19(int x) { return x * 19; }
+inline int f4731_20(int x) { return x * 20; }
+inline int f4731_21(int x) { return x * 21; }
+inline int f4731_22(int x) { return x * 22; }
+inline int f4731_23(int x) { return x * 23; }
+inline int f4731_24(int x) { return x * 24; }
+inline int f4731_25(int x) { return x * 25; }
+inline int f4731_26(int x) { return x * 26; }
+inline int f4731_27(int x) { return x * 27; }
+inline int f4731_28(int x) { return x * 28; }
+inline int f4731_29(int x) { return x * 29; }
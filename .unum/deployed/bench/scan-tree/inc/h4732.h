@@ -0,0 +1,42 @@
+#pragma once
+/* header 4732 */
+#include <vector>
+#include "h5078.h"
+#include "h1509.h"
+#include "h2661.h"
+#include "h836.h"
+#include "h411.h"
+#ifdef X
+#include "h8596.h"
+#endif
+struct S4732 { int a; const char *s = "x//y"; };
+inline int f4732_0(int x) { return x * 0; }
+inline int f4732_1(int x) { return x * 1; }
+inline int f4732_2(int x) { return x * 2; }
+inline int f4732_3(int x) { return x * 3; }
+inline int f4732_4(int x) { return x * 4; }
+inline int f4732_5(int x) { return x * 5; }
+inline int f4732_6(int x) { return x * 6; }
+inline int f4732_7(int x) { return x * 7; }
+inline int f4732_8(int x) { return x * 8; }
+inline int f4732_9(int x) { return x * 9; }
+inline int f4732_10(int x) { return x * 10; }
+inline int f4732_11(int x) { return x * 11; }
+inline int f4732_12(int x) { return x * 12; }
+inline int f4732_13(int x) { return x * 13; }
+inline int f4732_14(int x) { return x * 14; }
+inline int f4732_15(int x) { return x * 15; }
+inline int f4732_16(int x) { return x * 16; }
+inline int f4732_17(int x) { return x * 17; }
+inline int f4732_18(int x) { return x * 18; }
+inline int f4732_19(int x) { return x * 19; }
+inline int f4732_20(int x) { return x * 20; }
+inline int f4732_21(int x) { return x * 21; }
+inline int f4732_22(int x) { return x * 22; }
+inline int f4732_23(int x) { return x * 23; }
+inline int f4732_24(int x) { return x * 24; }
+inline int f4732_25(int x) { return x * 25; }
+inline int f4732_26(int x) { return x * 26; }
+inline int f4732_27(int x) { return x * 27; }
+inline int f4732_28(int x) { return x * 28; }
+inline int f4732_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4733 */
+#include <vector>
+#include "h9855.h"
+#include "h6344.h"
+#include "h1580.h"
+#include "h4916.h"
+#include "h5579.h"
+#ifdef X
+#include "h7270.h"
+#endif
+struct S4733 { int a; const char *s = "x//y"; };
+inline int f4733_0(int x) { return x * 0; }
+inline int f4733_1(int x) { return x * 1; }
+inline int f4733_2(int x) { return x * 2; }
+inline int f4733_3(int x) { return x * 3; }
+inline int f4733_4(int x) { return x * 4; }
+inline int f4733_5(int x) { return x * 5; }
+inline int f4733_6(int x) { return x * 6; }
+inline int f4733_7(int x) { return x * 7; }
+inline int f4733_8(int x) { return x * 8; }
+inline int f4733_9(int x) { return x * 9; }
+inline int f4733_10(int x) { return x * 10; }
+inline int f4733_11(int x) { return x * 11; }
+inline int f4733_12(int x) { return x * 12; }
+inline int f4733_13(int x) { return x * 13; }
+inline int f4733_14(int x) { return x * 14; }
+inline int f4733_15(int x) { return x * 15; }
+inline int f4733_16(int x) { return x * 16; }
+inline int f4733_17(int x) { return x * 17; }
+inline int f4733_18(int x) { return x * 18; }
+inline int f4733_19(int x) { return x * 19; }
+inline int f4733_20(int x) { return x * 20; }
+inline int f4733_21(int x) { return x * 21; }
+inline int f4733_22(int x) { return x * 22; }
+inline int f4733_23(int x) { return x * 23; }
+inline int f4733_24(int x) { return x * 24; }
+inline int f4733_25(int x) { return x * 25; }
+inline int f4733_26(int x) { return x * 26; }
+inline int f4733_27(int x) { return x * 27; }
+inline int f4733_28(int x) { return x * 28; }
+inline int f4733_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4735 */
+#include <vector>
+#include "h8929.h"
+#include "h6224.h"
+#include "h3117.h"
+#include "h9293.h"
+#include "h6419.h"
+#ifdef X
+#include "h4124.h"
+#endif
+struct S4735 { int a; const char *s = "x//y"; };
+inline int f4735_0(int x) { return x * 0; }
+inline int f4735_1(int x) { return x * 1; }
+inline int f4735_2(int x) { return x * 2; }
+inline int f4735_3(int x) { return x * 3; }
+inline int f4735_4(int x) { return x * 4; }
+inline int f4735_5(int x) { return x * 5; }
+inline int f4735_6(int x) { return x * 6; }
+inline int f4735_7(int x) { return x * 7; }
+inline int f4735_8(int x) { return x * 8; }
+inline int f4735_9(int x) { return x * 9; }
+inline int f4735_10(int x) { return x * 10; }
+inline int f4735_11(int x) { return x * 11; }
+inline int f4735_12(int x) { return x * 12; }
+inline int f4735_13(int x) { return x * 13; }
+inline int f4735_14(int x) { return x * 14; }
+inline int f4735_15(int x) { return x * 15; }
+inline int f4735_16(int x) { return x * 16; }
+inline int f4735_17(int x) { return x * 17; }
+inline int f4735_18(int x) { return x * 18; }
+inline int f4735_19(int x) { return x * 19; }
+inline int f4735_20(int x) { return x * 20; }
+inline int f4735_21(int x) { return x * 21; }
+inline int f4735_22(int x) { return x * 22; }
+inline int f4735_23(int x) { return x * 23; }
+inline int f4735_24(int x) { return x * 24; }
+inline int f4735_25(int x) { return x * 25; }
+inline int f4735_26(int x) { return x * 26; }
+inline int f4735_27(int x) { return x * 27; }
+inline int f4735_28(int x) { return x * 28; }
+inline int f4735_29(int x) { return x * 29; }
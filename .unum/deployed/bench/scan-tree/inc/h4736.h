@@ -0,0 +1,42 @@
+#pragma once
+/* header 4736 */
+#include <vector>
+#include "h3606.h"
+#include "h7664.h"
+#include "h6180.h"
+#include "h8766.h"
+#include "h5989.h"
+#ifdef X
+#include "h1335.h"
+#endif
+struct S4736 { int a; const char *s = "x//y"; };
+inline int f4736_0(int x) { return x * 0; }
+inline int f4736_1(int x) { return x * 1; }
+inline int f4736_2(int x) { return x * 2; }
+inline int f4736_3(int x) { return x * 3; }
+inline int f4736_4(int x) { return x * 4; }
+inline int f4736_5(int x) { return x * 5; }
+inline int f4736_6(int x) { return x * 6; }
+inline int f4736_7(int x) { return x * 7; }
+inline int f4736_8(int x) { return x * 8; }
+inline int f4736_9(int x) { return x * 9; }
+inline int f4736_10(int x) { return x * 10; }
+inline int f4736_11(int x) { return x * 11; }
+inline int f4736_12(int x) { return x * 12; }
+inline int f4736_13(int x) { return x * 13; }
+inline int f4736_14(int x) { return x * 14; }
+inline int f4736_15(int x) { return x * 15; }
+inline int f4736_16(int x) { return x * 16; }
+inline int f4736_17(int x) { return x * 17; }
+inline int f4736_18(int x) { return x * 18; }
+inline int f4736_19(int x) { return x * 19; }
+inline int f4736_20(int x) { return x * 20; }
+inline int f4736_21(int x) { return x * 21; }
+inline int f4736_22(int x) { return x * 22; }
+inline int f4736_23(int x) { return x * 23; }
+inline int f4736_24(int x) { return x * 24; }
+inline int f4736_25(int x) { return x * 25; }
+inline int f4736_26(int x) { return x * 26; }
+inline int f4736_27(int x) { return x * 27; }
+inline int f4736_28(int x) { return x * 28; }
+inline int f4736_29(int x) { return x * 29; }
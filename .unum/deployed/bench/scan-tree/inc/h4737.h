@@ -0,0 +1,42 @@
+#pragma once
+/* header 4737 */
+#include <vector>
+#include "h1069.h"
+#include "h2883.h"
+#include "h3963.h"
+#include "h4920.h"
+#include "h5325.h"
+#ifdef X
+#include "h8482.h"
+#endif
+struct S4737 { int a; const char *s = "x//y"; };
+inline int f4737_0(int x) { return x * 0; }
+inline int f4737_1(int x) { return x * 1; }
+inline int f4737_2(int x) { return x * 2; }
+inline int f4737_3(int x) { return x * 3; }
+inline int f4737_4(int x) { return x * 4; }
+inline int f4737_5(int x) { return x * 5; }
+inline int f4737_6(int x) { return x * 6; }
+inline int f4737_7(int x) { return x * 7; }
+inline int f4737_8(int x) { return x * 8; }
+inline int f4737_9(int x) { return x * 9; }
+inline int f4737_10(int x) { return x * 10; }
+inline int f4737_11(int x) { return x * 11; }
+inline int f4737_12(int x) { return x * 12; }
+inline int f4737_13(int x) { return x * 13; }
+inline int f4737_14(int x) { return x * 14; }
+inline int f4737_15(int x) { return x * 15; }
+inline int f4737_16(int x) { return x * 16; }
+inline int f4737_17(int x) { return x * 17; }
+inline int f4737_18(int x) { return x * 18; }
+inline int f4737_19(int x) { return x * 19; }
+inline int f4737_20(int x) { return x * 20; }
+inline int f4737_21(int x) { return x * 21; }
+inline int f4737_22(int x) { return x * 22; }
+inline int f4737_23(int x) { return x * 23; }
+inline int f4737_24(int x) { return x * 24; }
+inline int f4737_25(int x) { return x * 25; }
+inline int f4737_26(int x) { return x * 26; }
+inline int f4737_27(int x) { return x * 27; }
+inline int f4737_28(int x) { return x * 28; }
+inline int f4737_29(int x) { return x * 29; }
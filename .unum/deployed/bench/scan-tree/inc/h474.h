@@ -0,0 +1,42 @@
+#pragma once
+/* header 474 */
+#include <vector>
+#include "h266.h"
+#include "h8004.h"
+#include "h7704.h"
+#include "h7121.h"
+#include "h5427.h"
+#ifdef X
+#include "h1677.h"
+#endif
+struct S474 { int a; const char *s = "x//y"; };
+inline int f474_0(int x) { return x * 0; }
+inline int f474_1(int x) { return x * 1; }
+inline int f474_2(int x) { return x * 2; }
+inline int f474_3(int x) { return x * 3; }
+inline int f474_4(int x) { return x * 4; }
+inline int f474_5(int x) { return x * 5; }
+inline int f474_6(int x) { return x * 6; }
+inline int f474_7(int x) { return x * 7; }
+inline int f474_8(int x) { return x * 8; }
+inline int f474_9(int x) { return x * 9; }
+inline int f474_10(int x) { return x * 10; }
+inline int f474_11(int x) { return x * 11; }
+inline int f474_12(int x) { return x * 12; }
+inline int f474_13(int x) { return x * 13; }
+inline int f474_14(int x) { return x * 14; }
+inline int f474_15(int x) { return x * 15; }
+inline int f474_16(int x) { return x * 16; }
+inline int f474_17(int x) { return x * 17; }
+inline int f474_18(int x) { return x * 18; }
+inline int f474_19(int x) { return x * 19; }
+inline int f474_20(int x) { return x * 20; }
+inline int f474_21(int x) { return x * 21; }
+inline int f474_22(int x) { return x * 22; }
+inline int f474_23(int x) { return x * 23; }
+inline int f474_24(int x) { return x * 24; }
+inline int f474_25(int x) { return x * 25; }
+inline int f474_26(int x) { return x * 26; }
+inline int f474_27(int x) { return x * 27; }
+inline int f474_28(int x) { return x * 28; }
+inline int f474_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4740 */
+#include <vector>
+#include "h4511.h"
+#include "h2028.h"
+#include "h1464.h"
+#include "h876.h"
+#include "h7415.h"
+#ifdef X
+#include "h2828.h"
+#endif
+struct S4740 { int a; const char *s = "x//y"; };
+inline int f4740_0(int x) { return x * 0; }
+inline int f4740_1(int x) { return x * 1; }
+inline int f4740_2(int x) { return x * 2; }
+inline int f4740_3(int x) { return x * 3; }
+inline int f4740_4(int x) { return x * 4; }
+inline int f4740_5(int x) { return x * 5; }
+inline int f4740_6(int x) { return x * 6; }
+inline int f4740_7(int x) { return x * 7; }
+inline int f4740_8(int x) { return x * 8; }
+inline int f4740_9(int x) { return x * 9; }
+inline int f4740_10(int x) { return x * 10; }
+inline int f4740_11(int x) { return x * 11; }
+inline int f4740_12(int x) { return x * 12; }
+inline int f4740_13(int x) { return x * 13; }
+inline int f4740_14(int x) { return x * 14; }
+inline int f4740_15(int x) { return x * 15; }
+inline int f4740_16(int x) { return x * 16; }
+inline int f4740_17(int x) { return x * 17; }
+inline int f4740_18(int x) { return x * 18; }
+inline int f4740_19(int x) { return x * 19; }
+inline int f4740_20(int x) { return x * 20; }
+inline int f4740_21(int x) { return x * 21; }
+inline int f4740_22(int x) { return x * 22; }
+inline int f4740_23(int x) { return x * 23; }
+inline int f4740_24(int x) { return x * 24; }
+inline int f4740_25(int x) { return x * 25; }
+inline int f4740_26(int x) { return x * 26; }
+inline int f4740_27(int x) { return x * 27; }
+inline int f4740_28(int x) { return x * 28; }
+inline int f4740_29(int x) { return x * 29; }
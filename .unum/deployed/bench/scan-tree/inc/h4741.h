@@ -0,0 +1,42 @@
+#pragma once
+/* header 4741 */
+#include <vector>
+#include "h9108.h"
+#include "h3791.h"
+#include "h6260.h"
+#include "h7240.h"
+#include "h8062.h"
+#ifdef X
+#include "h5828.h"
+#endif
+struct S4741 { int a; const char *s = "x//y"; };
+inline int f4741_0(int x) { return x * 0; }
+inline int f4741_1(int x) { return x * 1; }
+inline int f4741_2(int x) { return x * 2; }
+inline int f4741_3(int x) { return x * 3; }
+inline int f4741_4(int x) { return x * 4; }
+inline int f4741_5(int x) { return x * 5; }
+inline int f4741_6(int x) { return x * 6; }
+inline int f4741_7(int x) { return x * 7; }
+inline int f4741_8(int x) { return x * 8; }
+inline int f4741_9(int x) { return x * 9; }
+inline int f4741_10(int x) { return x * 10; }
+inline int f4741_11(int x) { return x * 11; }
+inline int f4741_12(int x) { return x * 12; }
+inline int f4741_13(int x) { return x * 13; }
+inline int f4741_14(int x) { return x * 14; }
+inline int f4741_15(int x) { return x * 15; }
+inline int f4741_16(int x) { return x * 16; }
+inline int f4741_17(int x) { return x * 17; }
+inline int f4741_18(int x) { return x * 18; }
+inline int f4741_19(int x) { return x * 19; }
+inline int f4741_20(int x) { return x * 20; }
+inline int f4741_21(int x) { return x * 21; }
+inline int f4741_22(int x) { return x * 22; }
+inline int f4741_23(int x) { return x * 23; }
+inline int f4741_24(int x) { return x * 24; }
+inline int f4741_25(int x) { return x * 25; }
+inline int f4741_26(int x) { return x * 26; }
+inline int f4741_27(int x) { return x * 27; }
+inline int f4741_28(int x) { return x * 28; }
+inline int f4741_29(int x) { return x * 29; }
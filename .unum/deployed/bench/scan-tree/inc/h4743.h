@@ -0,0 +1,42 @@
+#pragma once
+/* header 4743 */
+#include <vector>
+#include "h7925.h"
+#include "h8595.h"
+#include "h249.h"
+#include "h7680.h"
+#include "h626.h"
+#ifdef X
+#include "h5081.h"
+#endif
+struct S4743 { int a; const char *s = "x//y"; };
+inline int f4743_0(int x) { return x * 0; }
+inline int f4743_1(int x) { return x * 1; }
+inline int f4743_2(int x) { return x * 2; }
+inline int f4743_3(int x) { return x * 3; }
+inline int f4743_4(int x) { return x * 4; }
+inline int f4743_5(int x) { return x * 5; }
+inline int f4743_6(int x) { return x * 6; }
+inline int f4743_7(int x) { return x * 7; }
+inline int f4743_8(int x) { return x * 8; }
+inline int f4743_9(int x) { return x * 9; }
+inline int f4743_10(int x) { return x * 10; }
+inline int f4743_11(int x) { return x * 11; }
+inline int f4743_12(int x) { return x * 12; }
+inline int f4743_13(int x) { return x * 13; }
+inline int f4743_14(int x) { return x * 14; }
+inline int f4743_15(int x) { return x * 15; }
+inline int f4743_16(int x) { return x * 16; }
+inline int f4743_17(int x) { return x * 17; }
+inline int f4743_18(int x) { return x * 18; }
+inline int f4743_19(int x) { return x * 19; }
+inline int f4743_20(int x) { return x * 20; }
+inline int f4743_21(int x) { return x * 21; }
+inline int f4743_22(int x) { return x * 22; }
+inline int f4743_23(int x) { return x * 23; }
+inline int f4743_24(int x) { return x * 24; }
+inline int f4743_25(int x) { return x * 25; }
+inline int f4743_26(int x) { return x * 26; }
+inline int f4743_27(int x) { return x * 27; }
+inline int f4743_28(int x) { return x * 28; }
+inline int f4743_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4745 */
+#include <vector>
+#include "h5089.h"
+#include "h4647.h"
+#include "h1121.h"
+#include "h3749.h"
+#include "h3965.h"
+#ifdef X
+#include "h5677.h"
+#endif
+struct S4745 { int a; const char *s = "x//y"; };
+inline int f4745_0(int x) { return x * 0; }
+inline int f4745_1(int x) { return x * 1; }
+inline int f4745_2(int x) { return x * 2; }
+inline int f4745_3(int x) { return x * 3; }
+inline int f4745_4(int x) { return x * 4; }
+inline int f4745_5(int x) { return x * 5; }
+inline int f4745_6(int x) { return x * 6; }
+inline int f4745_7(int x) { return x * 7; }
+inline int f4745_8(int x) { return x * 8; }
+inline int f4745_9(int x) { return x * 9; }
+inline int f4745_10(int x) { return x * 10; }
+inline int f4745_11(int x) { return x * 11; }
+inline int f4745_12(int x) { return x * 12; }
+inline int f4745_13(int x) { return x * 13; }
+inline int f4745_14(int x) { return x * 14; }
+inline int f4745_15(int x) { return x * 15; }
+inline int f4745_16(int x) { return x * 16; }
+inline int f4745_17(int x) { return x * 17; }
+inline int f4745_18(int x) { return x * 18; }
+inline int f4745_19(int x) { return x * 19; }
+inline int f4745_20(int x) { return x * 20; }
+inline int f4745_21(int x) { return x * 21; }
+inline int f4745_22(int x) { return x * 22; }
+inline int f4745_23(int x) { return x * 23; }
+inline int f4745_24(int x) { return x * 24; }
+inline int f4745_25(int x) { return x * 25; }
+inline int f4745_26(int x) { return x * 26; }
+inline int f4745_27(int x) { return x * 27; }
+inline int f4745_28(int x) { return x * 28; }
+inline int f4745_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4749 */
+#include <vector>
+#include "h1462.h"
+#include "h2436.h"
+#include "h9873.h"
+#include "h8632.h"
+#include "h4346.h"
+#ifdef X
+#include "h3362.h"
+#endif
+struct S4749 { int a; const char *s = "x//y"; };
+inline int f4749_0(int x) { return x * 0; }
+inline int f4749_1(int x) { return x * 1; }
+inline int f4749_2(int x) { return x * 2; }
+inline int f4749_3(int x) { return x * 3; }
+inline int f4749_4(int x) { return x * 4; }
+inline int f4749_5(int x) { return x * 5; }
+inline int f4749_6(int x) { return x * 6; }
+inline int f4749_7(int x) { return x * 7; }
+inline int f4749_8(int x) { return x * 8; }
+inline int f4749_9(int x) { return x * 9; }
+inline int f4749_10(int x) { return x * 10; }
+inline int f4749_11(int x) { return x * 11; }
+inline int f4749_12(int x) { return x * 12; }
+inline int f4749_13(int x) { return x * 13; }
+inline int f4749_14(int x) { return x * 14; }
+inline int f4749_15(int x) { return x * 15; }
+inline int f4749_16(int x) { return x * 16; }
+inline int f4749_17(int x) { return x * 17; }
+inline int f4749_18(int x) { return x * 18; }
+inline int f4749_19(int x) { return x * 19; }
+inline int f4749_20(int x) { return x * 20; }
+inline int f4749_21(int x) { return x * 21; }
+inline int f4749_22(int x) { return x * 22; }
+inline int f4749_23(int x) { return x * 23; }
+inline int f4749_24(int x) { return x * 24; }
+inline int f4749_25(int x) { return x * 25; }
+inline int f4749_26(int x) { return x * 26; }
+inline int f4749_27(int x) { return x * 27; }
+inline int f4749_28(int x) { return x * 28; }
+inline int f4749_29(int x) { return x * 29; }
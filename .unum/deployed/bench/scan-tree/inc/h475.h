@@ -0,0 +1,42 @@
+#pragma once
+/* header 475 */
+#include <vector>
+#include "h7730.h"
+#include "h9999.h"
+#include "h4716.h"
+#include "h2258.h"
+#include "h6377.h"
+#ifdef X
+#include "h7523.h"
+#endif
+struct S475 { int a; const char *s = "x//y"; };
+inline int f475_0(int x) { return x * 0; }
+inline int f475_1(int x) { return x * 1; }
+inline int f475_2(int x) { return x * 2; }
+inline int f475_3(int x) { return x * 3; }
+inline int f475_4(int x) { return x * 4; }
+inline int f475_5(int x) { return x * 5; }
+inline int f475_6(int x) { return x * 6; }
+inline int f475_7(int x) { return x * 7; }
+inline int f475_8(int x) { return x * 8; }
+inline int f475_9(int x) { return x * 9; }
+inline int f475_10(int x) { return x * 10; }
+inline int f475_11(int x) { return x * 11; }
+inline int f475_12(int x) { return x * 12; }
+inline int f475_13(int x) { return x * 13; }
+inline int f475_14(int x) { return x * 14; }
+inline int f475_15(int x) { return x * 15; }
+inline int f475_16(int x) { return x * 16; }
+inline int f475_17(int x) { return x * 17; }
+inline int f475_18(int x) { return x * 18; }
+inline int f475_19(int x) { return x * 19; }
+inline int f475_20(int x) { return x * 20; }
+inline int f475_21(int x) { return x * 21; }
+inline int f475_22(int x) { return x * 22; }
+inline int f475_23(int x) { return x * 23; }
+inline int f475_24(int x) { return x * 24; }
+inline int f475_25(int x) { return x * 25; }
+inline int f475_26(int x) { return x * 26; }
+inline int f475_27(int x) { return x * 27; }
+inline int f475_28(int x) { return x * 28; }
+inline int f475_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4751 */
+#include <vector>
+#include "h7797.h"
+#include "h7207.h"
+#include "h2556.h"
+#include "h2751.h"
+#include "h9325.h"
+#ifdef X
+#include "h4288.h"
+#endif
+struct S4751 { int a; const char *s = "x//y"; };
+inline int f4751_0(int x) { return x * 0; }
+inline int f4751_1(int x) { return x * 1; }
+inline int f4751_2(int x) { return x * 2; }
+inline int f4751_3(int x) { return x * 3; }
+inline int f4751_4(int x) { return x * 4; }
+inline int f4751_5(int x) { return x * 5; }
+inline int f4751_6(int x) { return x * 6; }
+inline int f4751_7(int x) { return x * 7; }
+inline int f4751_8(int x) { return x * 8; }
+inline int f4751_9(int x) { return x * 9; }
+inline int f4751_10(int x) { return x * 10; }
+inline int f4751_11(int x) { return x * 11; }
+inline int f4751_12(int x) { return x * 12; }
+inline int f4751_13(int x) { return x * 13; }
+inline int f4751_14(int x) { return x * 14; }
+inline int f4751_15(int x) { return x * 15; }
+inline int f4751_16(int x) { return x * 16; }
+inline int f4751_17(int x) { return x * 17; }
+inline int f4751_18(int x) { return x * 18; }
+inline int f4751_19(int x) { return x * 19; }
+inline int f4751_20(int x) { return x * 20; }
+inline int f4751_21(int x) { return x * 21; }
+inline int f4751_22(int x) { return x * 22; }
+inline int f4751_23(int x) { return x * 23; }
+inline int f4751_24(int x) { return x * 24; }
+inline int f4751_25(int x) { return x * 25; }
+inline int f4751_26(int x) { return x * 26; }
+inline int f4751_27(int x) { return x * 27; }
+inline int f4751_28(int x) { return x * 28; }
+inline int f4751_29(int x) { return x * 29; }
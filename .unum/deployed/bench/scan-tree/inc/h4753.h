@@ -0,0 +1,42 @@
+#pragma once
+/* header 4753 */
+#include <vector>
+#include "h6704.h"
+#include "h2141.h"
+#include "h4183.h"
+#include "h8257.h"
+#include "h2482.h"
+#ifdef X
+#include "h8498.h"
+#endif
+struct S4753 { int a; const char *s = "x//y"; };
+inline int f4753_0(int x) { return x * 0; }
+inline int f4753_1(int x) { return x * 1; }
+inline int f4753_2(int x) { return x * 2; }
+inline int f4753_3(int x) { return x * 3; }
+inline int f4753_4(int x) { return x * 4; }
+inline int f4753_5(int x) { return x * 5; }
+inline int f4753_6(int x) { return x * 6; }
+inline int f4753_7(int x) { return x * 7; }
+inline int f4753_8(int x) { return x * 8; }
+inline int f4753_9(int x) { return x * 9; }
+inline int f4753_10(int x) { return x * 10; }
+inline int f4753_11(int x) { return x * 11; }
+inline int f4753_12(int x) { return x * 12; }
+inline int f4753_13(int x) { return x * 13; }
+inline int f4753_14(int x) { return x * 14; }
+inline int f4753_15(int x) { return x * 15; }
+inline int f4753_16(int x) { return x * 16; }
+inline int f4753_17(int x) { return x * 17; }
+inline int f4753_18(int x) { return x * 18; }
+inline int f4753_19(int x) { return x * 19; }
+inline int f4753_20(int x) { return x * 20; }
+inline int f4753_21(int x) { return x * 21; }
+inline int f4753_22(int x) { return x * 22; }
+inline int f4753_23(int x) { return x * 23; }
+inline int f4753_24(int x) { return x * 24; }
+inline int f4753_25(int x) { return x * 25; }
+inline int f4753_26(int x) { return x * 26; }
+inline int f4753_27(int x) { return x * 27; }
+inline int f4753_28(int x) { return x * 28; }
+inline int f4753_29(int x) { return x * 29; }
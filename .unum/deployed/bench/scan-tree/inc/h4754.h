@@ -0,0 +1,42 @@
+#pragma once
+/* header 4754 */
+#include <vector>
+#include "h2011.h"
+#include "h1237.h"
+#include "h9465.h"
+#include "h5510.h"
+#include "h1239.h"
+#ifdef X
+#include "h8145.h"
+#endif
+struct S4754 { int a; const char *s = "x//y"; };
+inline int f4754_0(int x) { return x * 0; }
+inline int f4754_1(int x) { return x * 1; }
+inline int f4754_2(int x) { return x * 2; }
+inline int f4754_3(int x) { return x * 3; }
+inline int f4754_4(int x) { return x * 4; }
+inline int f4754_5(int x) { return x * 5; }
+inline int f4754_6(int x) { return x * 6; }
+inline int f4754_7(int x) { return x * 7; }
+inline int f4754_8(int x) { return x * 8; }
+inline int f4754_9(int x) { return x * 9; }
+inline int f4754_10(int x) { return x * 10; }
+inline int f4754_11(int x) { return x * 11; }
+inline int f4754_12(int x) { return x * 12; }
+inline int f4754_13(int x) { return x * 13; }
+inline int f4754_14(int x) { return x * 14; }
+inline int f4754_15(int x) { return x * 15; }
+inline int f4754_16(int x) { return x * 16; }
+inline int f4754_17(int x) { return x * 17; }
+inline int f4754_18(int x) { return x * 18; }
+inline int f4754_19(int x) { return x * 19; }
+inline int f4754_20(int x) { return x * 20; }
+inline int f4754_21(int x) { return x * 21; }
+inline int f4754_22(int x) { return x * 22; }
+inline int f4754_23(int x) { return x * 23; }
+inline int f4754_24(int x) { return x * 24; }
+inline int f4754_25(int x) { return x * 25; }
+inline int f4754_26(int x) { return x * 26; }
+inline int f4754_27(int x) { return x * 27; }
+inline int f4754_28(int x) { return x * 28; }
+inline int f4754_29(int x) { return x * 29; }
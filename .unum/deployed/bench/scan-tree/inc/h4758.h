@@ -0,0 +1,42 @@
+#pragma once
+/* header 4758 */
+#include <vector>
+#include "h8647.h"
+#include "h8980.h"
+#include "h7462.h"
+#include "h9459.h"
+#include "h7076.h"
+#ifdef X
+#include "h3476.h"
+#endif
+struct S4758 { int a; const char *s = "x//y"; };
+inline int f4758_0(int x) { return x * 0; }
+inline int f4758_1(int x) { return x * 1; }
+inline int f4758_2(int x) { return x * 2; }
+inline int f4758_3(int x) { return x * 3; }
+inline int f4758_4(int x) { return x * 4; }
+inline int f4758_5(int x) { return x * 5; }
+inline int f4758_6(int x) { return x * 6; }
+inline int f4758_7(int x) { return x * 7; }
+inline int f4758_8(int x) { return x * 8; }
+inline int f4758_9(int x) { return x * 9; }
+inline int f4758_10(int x) { return x * 10; }
+inline int f4758_11(int x) { return x * 11; }
+inline int f4758_12(int x) { return x * 12; }
+inline int f4758_13(int x) { return x * 13; }
+inline int f4758_14(int x) { return x * 14; }
+inline int f4758_15(int x) { return x * 15; }
+inline int f4758_16(int x) { return x * 16; }
+inline int f4758_17(int x) { return x * 17; }
+inline int f4758_18(int x) { return x * 18; }
+inline int f4758_19(int x) { return x * 19; }
+inline int f4758_20(int x) { return x * 20; }
+inline int f4758_21(int x) { return x * 21; }
+inline int f4758_22(int x) { return x * 22; }
+inline int f4758_23(int x) { return x * 23; }
+inline int f4758_24(int x) { return x * 24; }
+inline int f4758_25(int x) { return x * 25; }
+inline int f4758_26(int x) { return x * 26; }
+inline int f4758_27(int x) { return x * 27; }
+inline int f4758_28(int x) { return x * 28; }
+inline int f4758_29(int x) { return x * 29; }
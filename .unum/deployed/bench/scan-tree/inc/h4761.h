@@ -0,0 +1,42 @@
+#pragma once
+/* header 4761 */
+#include <vector>
+#include "h958.h"
+#include "h471.h"
+#include "h2724.h"
+#include "h7453.h"
+#include "h569.h"
+#ifdef X
+#include "h900.h"
+#endif
+struct S4761 { int a; const char *s = "x//y"; };
+inline int f4761_0(int x) { return x * 0; }
+inline int f4761_1(int x) { return x * 1; }
+inline int f4761_2(int x) { return x * 2; }
+inline int f4761_3(int x) { return x * 3; }
+inline int f4761_4(int x) { return x * 4; }
+inline int f4761_5(int x) { return x * 5; }
+inline int f4761_6(int x) { return x * 6; }
+inline int f4761_7(int x) { return x * 7; }
+inline int f4761_8(int x) { return x * 8; }
+inline int f4761_9(int x) { return x * 9; }
+inline int f4761_10(int x) { return x * 10; }
+inline int f4761_11(int x) { return x * 11; }
+inline int f4761_12(int x) { return x * 12; }
+inline int f4761_13(int x) { return x * 13; }
+inline int f4761_14(int x) { return x * 14; }
+inline int f4761_15(int x) { return x * 15; }
+inline int f4761_16(int x) { return x * 16; }
+inline int f4761_17(int x) { return x * 17; }
+inline int f4761_18(int x) { return x * 18; }
+inline int f4761_19(int x) { return x * 19; }
+inline int f4761_20(int x) { return x * 20; }
+inline int f4761_21(int x) { return x * 21; }
+inline int f4761_22(int x) { return x * 22; }
+inline int f4761_23(int x) { return x * 23; }
+inline int f4761_24(int x) { return x * 24; }
+inline int f4761_25(int x) { return x * 25; }
+inline int f4761_26(int x) { return x * 26; }
+inline int f4761_27(int x) { return x * 27; }
+inline int f4761_28(int x) { return x * 28; }
+inline int f4761_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4766 */
+#include <vector>
+#include "h1436.h"
+#include "h86.h"
+#include "h4581.h"
+#include "h4481.h"
+#include "h807.h"
+#ifdef X
+#include "h4189.h"
+#endif
+struct S4766 { int a; const char *s = "x//y"; };
+inline int f4766_0(int x) { return x * 0; }
+inline int f4766_1(int x) { return x * 1; }
+inline int f4766_2(int x) { return x * 2; }
+inline int f4766_3(int x) { return x * 3; }
+inline int f4766_4(int x) { return x * 4; }
+inline int f4766_5(int x) { return x * 5; }
+inline int f4766_6(int x) { return x * 6; }
+inline int f4766_7(int x) { return x * 7; }
+inline int f4766_8(int x) { return x * 8; }
+inline int f4766_9(int x) { return x * 9; }
+inline int f4766_10(int x) { return x * 10; }
+inline int f4766_11(int x) { return x * 11; }
+inline int f4766_12(int x) { return x * 12; }
+inline int f4766_13(int x) { return x * 13; }
+inline int f4766_14(int x) { return x * 14; }
+inline int f4766_15(int x) { return x * 15; }
+inline int f4766_16(int x) { return x * 16; }
+inline int f4766_17(int x) { return x * 17; }
+inline int f4766_18(int x) { return x * 18; }
+inline int f4766_19(int x) { return x * 19; }
+inline int f4766_20(int x) { return x * 20; }
+inline int f4766_21(int x) { return x * 21; }
+inline int f4766_22(int x) { return x * 22; }
+inline int f4766_23(int x) { return x * 23; }
+inline int f4766_24(int x) { return x * 24; }
+inline int f4766_25(int x) { return x * 25; }
+inline int f4766_26(int x) { return x * 26; }
+inline int f4766_27(int x) { return x * 27; }
+inline int f4766_28(int x) { return x * 28; }
+inline int f4766_29(int x) { return x * 29; }
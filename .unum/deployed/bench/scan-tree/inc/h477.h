@@ -0,0 +1,42 @@
+#pragma once
+/* header 477 */
+#include <vector>
+#include "h7368.h"
+#include "h4176.h"
+#include "h1496.h"
+#include "h2747.h"
+#include "h1091.h"
+#ifdef X
+#include "h9141.h"
+#endif
+struct S477 { int a; const char *s = "x//y"; };
+inline int f477_0(int x) { return x * 0; }
+inline int f477_1(int x) { return x * 1; }
+inline int f477_2(int x) { return x * 2; }
+inline int f477_3(int x) { return x * 3; }
+inline int f477_4(int x) { return x * 4; }
+inline int f477_5(int x) { return x * 5; }
+inline int f477_6(int x) { return x * 6; }
+inline int f477_7(int x) { return x * 7; }
+inline int f477_8(int x) { return x * 8; }
+inline int f477_9(int x) { return x * 9; }
+inline int f477_10(int x) { return x * 10; }
+inline int f477_11(int x) { return x * 11; }
+inline int f477_12(int x) { return x * 12; }
+inline int f477_13(int x) { return x * 13; }
+inline int f477_14(int x) { return x * 14; }
+inline int f477_15(int x) { return x * 15; }
+inline int f477_16(int x) { return x * 16; }
+inline int f477_17(int x) { return x * 17; }
+inline int f477_18(int x) { return x * 18; }
+inline int f477_19(int x) { return x * 19; }
+inline int f477_20(int x) { return x * 20; }
+inline int f477_21(int x) { return x * 21; }
+inline int f477_22(int x) { return x * 22; }
+inline int f477_23(int x) { return x * 23; }
+inline int f477_24(int x) { return x * 24; }
+inline int f477_25(int x) { return x * 25; }
+inline int f477_26(int x) { return x * 26; }
+inline int f477_27(int x) { return x * 27; }
+inline int f477_28(int x) { return x * 28; }
+inline int f477_29(int x) { return x * 29; }
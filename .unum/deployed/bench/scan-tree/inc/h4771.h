@@ -0,0 +1,42 @@
+#pragma once
+/* header 4771 */
+#include <vector>
+#include "h140.h"
+#include "h478.h"
+#include "h7217.h"
+#include "h9365.h"
+#include "h670.h"
+#ifdef X
+#include "h992.h"
+#endif
+struct S4771 { int a; const char *s = "x//y"; };
+inline int f4771_0(int x) { return x * 0; }
+inline int f4771_1(int x) { return x * 1; }
+inline int f4771_2(int x) { return x * 2; }
+inline int f4771_3(int x) { return x * 3; }
+inline int f4771_4(int x) { return x * 4; }
+inline int f4771_5(int x) { return x * 5; }
+inline int f4771_6(int x) { return x * 6; }
+inline int f4771_7(int x) { return x * 7; }
+inline int f4771_8(int x) { return x * 8; }
+inline int f4771_9(int x) { return x * 9; }
+inline int f4771_10(int x) { return x * 10; }
+inline int f4771_11(int x) { return x * 11; }
+inline int f4771_12(int x) { return x * 12; }
+inline int f4771_13(int x) { return x * 13; }
+inline int f4771_14(int x) { return x * 14; }
+inline int f4771_15(int x) { return x * 15; }
+inline int f4771_16(int x) { return x * 16; }
+inline int f4771_17(int x) { return x * 17; }
+inline int f4771_18(int x) { return x * 18; }
+inline int f4771_19(int x) { return x * 19; }
+inline int f4771_20(int x) { return x * 20; }
+inline int f4771_21(int x) { return x * 21; }
+inline int f4771_22(int x) { return x * 22; }
+inline int f4771_23(int x) { return x * 23; }
+inline int f4771_24(int x) { return x * 24; }
+inline int f4771_25(int x) { return x * 25; }
+inline int f4771_26(int x) { return x * 26; }
+inline int f4771_27(int x) { return x * 27; }
+inline int f4771_28(int x) { return x * 28; }
+inline int f4771_29(int x) { return x * 29; }
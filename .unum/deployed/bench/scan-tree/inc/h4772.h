@@ -0,0 +1,42 @@
+#pragma once
+/* header 4772 */
+#include <vector>
+#include "h9135.h"
+#include "h9177.h"
+#include "h131.h"
+#include "h7636.h"
+#include "h3586.h"
+#ifdef X
+#include "h6302.h"
+#endif
+struct S4772 { int a; const char *s = "x//y"; };
+inline int f4772_0(int x) { return x * 0; }
+inline int f4772_1(int x) { return x * 1; }
+inline int f4772_2(int x) { return x * 2; }
+inline int f4772_3(int x) { return x * 3; }
+inline int f4772_4(int x) { return x * 4; }
+inline int f4772_5(int x) { return x * 5; }
+inline int f4772_6(int x) { return x * 6; }
+inline int f4772_7(int x) { return x * 7; }
+inline int f4772_8(int x) { return x * 8; }
+inline int f4772_9(int x) { return x * 9; }
+inline int f4772_10(int x) { return x * 10; }
+inline int f4772_11(int x) { return x * 11; }
+inline int f4772_12(int x) { return x * 12; }
+inline int f4772_13(int x) { return x * 13; }
+inline int f4772_14(int x) { return x * 14; }
+inline int f4772_15(int x) { return x * 15; }
+inline int f4772_16(int x) { return x * 16; }
+inline int f4772_17(int x) { return x * 17; }
+inline int f4772_18(int x) { return x * 18; }
+inline int f4772_19(int x) { return x * 19; }
+inline int f4772_20(int x) { return x * 20; }
+inline int f4772_21(int x) { return x * 21; }
+inline int f4772_22(int x) { return x * 22; }
+inline int f4772_23(int x) { return x * 23; }
+inline int f4772_24(int x) { return x * 24; }
+inline int f4772_25(int x) { return x * 25; }
+inline int f4772_26(int x) { return x * 26; }
+inline int f4772_27(int x) { return x * 27; }
+inline int f4772_28(int x) { return x * 28; }
+inline int f4772_29(int x) { return x * 29; }
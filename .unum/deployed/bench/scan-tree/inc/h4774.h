@@ -0,0 +1,42 @@
+#pragma once
+/* header 4774 */
+#include <vector>
+#include "h3846.h"
+#include "h9457.h"
+#include "h4300.h"
+#include "h6987.h"
+#include "h393.h"
+#ifdef X
+#include "h7228.h"
+#endif
+struct S4774 { int a; const char *s = "x//y"; };
+inline int f4774_0(int x) { return x * 0; }
+inline int f4774_1(int x) { return x * 1; }
+inline int f4774_2(int x) { return x * 2; }
+inline int f4774_3(int x) { return x * 3; }
+inline int f4774_4(int x) { return x * 4; }
+inline int f4774_5(int x) { return x * 5; }
+inline int f4774_6(int x) { return x * 6; }
+inline int f4774_7(int x) { return x * 7; }
+inline int f4774_8(int x) { return x * 8; }
+inline int f4774_9(int x) { return x * 9; }
+inline int f4774_10(int x) { return x * 10; }
+inline int f4774_11(int x) { return x * 11; }
+inline int f4774_12(int x) { return x * 12; }
+inline int f4774_13(int x) { return x * 13; }
+inline int f4774_14(int x) { return x * 14; }
+inline int f4774_15(int x) { return x * 15; }
+inline int f4774_16(int x) { return x * 16; }
+inline int f4774_17(int x) { return x * 17; }
+inline int f4774_18(int x) { return x * 18; }
+inline int f4774_19(int x) { return x * 19; }
+inline int f4774_20(int x) { return x * 20; }
+inline int f4774_21(int x) { return x * 21; }
+inline int f4774_22(int x) { return x * 22; }
+inline int f4774_23(int x) { return x * 23; }
+inline int f4774_24(int x) { return x * 24; }
+inline int f4774_25(int x) { return x * 25; }
+inline int f4774_26(int x) { return x * 26; }
+inline int f4774_27(int x) { return x * 27; }
+inline int f4774_28(int x) { return x * 28; }
+inline int f4774_29(int x) { return x * 29; }
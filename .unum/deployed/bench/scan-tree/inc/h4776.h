@@ -0,0 +1,42 @@
+#pragma once
+/* header 4776 */
+#include <vector>
+#include "h741.h"
+#include "h5518.h"
+#include "h6378.h"
+#include "h1796.h"
+#include "h5066.h"
+#ifdef X
+#include "h7532.h"
+#endif
+struct S4776 { int a; const char *s = "x//y"; };
+inline int f4776_0(int x) { return x * 0; }
+inline int f4776_1(int x) { return x * 1; }
+inline int f4776_2(int x) { return x * 2; }
+inline int f4776_3(int x) { return x * 3; }
+inline int f4776_4(int x) { return x * 4; }
+inline int f4776_5(int x) { return x * 5; }
+inline int f4776_6(int x) { return x * 6; }
+inline int f4776_7(int x) { return x * 7; }
+inline int f4776_8(int x) { return x * 8; }
+inline int f4776_9(int x) { return x * 9; }
+inline int f4776_10(int x) { return x * 10; }
+inline int f4776_11(int x) { return x * 11; }
+inline int f4776_12(int x) { return x * 12; }
+inline int f4776_13(int x) { return x * 13; }
+inline int f4776_14(int x) { return x * 14; }
+inline int f4776_15(int x) { return x * 15; }
+inline int f4776_16(int x) { return x * 16; }
+inline int f4776_17(int x) { return x * 17; }
+inline int f4776_18(int x) { return x * 18; }
+inline int f4776_19(int x) { return x * 19; }
+inline int f4776_20(int x) { return x * 20; }
+inline int f4776_21(int x) { return x * 21; }
+inline int f4776_22(int x) { return x * 22; }
+inline int f4776_23(int x) { return x * 23; }
+inline int f4776_24(int x) { return x * 24; }
+inline int f4776_25(int x) { return x * 25; }
+inline int f4776_26(int x) { return x * 26; }
+inline int f4776_27(int x) { return x * 27; }
+inline int f4776_28(int x) { return x * 28; }
+inline int f4776_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 478 */
+#include <vector>
+#include "h9458.h"
+#include "h7498.h"
+#include "h1390.h"
+#include "h6909.h"
+#include "h9432.h"
+#ifdef X
+#include "h2656.h"
+#endif
+struct S478 { int a; const char *s = "x//y"; };
+inline int f478_0(int x) { return x * 0; }
+inline int f478_1(int x) { return x * 1; }
+inline int f478_2(int x) { return x * 2; }
+inline int f478_3(int x) { return x * 3; }
+inline int f478_4(int x) { return x * 4; }
+inline int f478_5(int x) { return x * 5; }
+inline int f478_6(int x) { return x * 6; }
+inline int f478_7(int x) { return x * 7; }
+inline int f478_8(int x) { return x * 8; }
+inline int f478_9(int x) { return x * 9; }
+inline int f478_10(int x) { return x * 10; }
+inline int f478_11(int x) { return x * 11; }
+inline int f478_12(int x) { return x * 12; }
+inline int f478_13(int x) { return x * 13; }
+inline int f478_14(int x) { return x * 14; }
+inline int f478_15(int x) { return x * 15; }
+inline int f478_16(int x) { return x * 16; }
+inline int f478_17(int x) { return x * 17; }
+inline int f478_18(int x) { return x * 18; }
+inline int f478_19(int x) { return x * 19; }
+inline int f478_20(int x) { return x * 20; }
+inline int f478_21(int x) { return x * 21; }
+inline int f478_22(int x) { return x * 22; }
+inline int f478_23(int x) { return x * 23; }
+inline int f478_24(int x) { return x * 24; }
+inline int f478_25(int x) { return x * 25; }
+inline int f478_26(int x) { return x * 26; }
+inline int f478_27(int x) { return x * 27; }
+inline int f478_28(int x) { return x * 28; }
+inline int f478_29(int x) { return x * 29; }
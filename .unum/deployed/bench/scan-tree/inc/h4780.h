@@ -0,0 +1,42 @@
+#pragma once
+/* header 4780 */
+#include <vector>
+#include "h9690.h"
+#include "h2188.h"
+#include "h6647.h"
+#include "h7521.h"
+#include "h281.h"
+#ifdef X
+#include "h9291.h"
+#endif
+struct S4780 { int a; const char *s = "x//y"; };
+inline int f4780_0(int x) { return x * 0; }
+inline int f4780_1(int x) { return x * 1; }
+inline int f4780_2(int x) { return x * 2; }
+inline int f4780_3(int x) { return x * 3; }
+inline int f4780_4(int x) { return x * 4; }
+inline int f4780_5(int x) { return x * 5; }
+inline int f4780_6(int x) { return x * 6; }
+inline int f4780_7(int x) { return x * 7; }
+inline int f4780_8(int x) { return x * 8; }
+inline int f4780_9(int x) { return x * 9; }
+inline int f4780_10(int x) { return x * 10; }
+inline int f4780_11(int x) { return x * 11; }
+inline int f4780_12(int x) { return x * 12; }
+inline int f4780_13(int x) { return x * 13; }
+inline int f4780_14(int x) { return x * 14; }
+inline int f4780_15(int x) { return x * 15; }
+inline int f4780_16(int x) { return x * 16; }
+inline int f4780_17(int x) { return x * 17; }
+inline int f4780_18(int x) { return x * 18; }
+inline int f4780_19(int x) { return x * 19; }
+inline int f4780_20(int x) { return x * 20; }
+inline int f4780_21(int x) { return x * 21; }
+inline int f4780_22(int x) { return x * 22; }
+inline int f4780_23(int x) { return x * 23; }
+inline int f4780_24(int x) { return x * 24; }
+inline int f4780_25(int x) { return x * 25; }
+inline int f4780_26(int x) { return x * 26; }
+inline int f4780_27(int x) { return x * 27; }
+inline int f4780_28(int x) { return x * 28; }
+inline int f4780_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4783 */
+#include <vector>
+#include "h7604.h"
+#include "h5279.h"
+#include "h2628.h"
+#include "h4686.h"
+#include "h5249.h"
+#ifdef X
+#include "h9804.h"
+#endif
+struct S4783 { int a; const char *s = "x//y"; };
+inline int f4783_0(int x) { return x * 0; }
+inline int f4783_1(int x) { return x * 1; }
+inline int f4783_2(int x) { return x * 2; }
+inline int f4783_3(int x) { return x * 3; }
+inline int f4783_4(int x) { return x * 4; }
+inline int f4783_5(int x) { return x * 5; }
+inline int f4783_6(int x) { return x * 6; }
+inline int f4783_7(int x) { return x * 7; }
+inline int f4783_8(int x) { return x * 8; }
+inline int f4783_9(int x) { return x * 9; }
+inline int f4783_10(int x) { return x * 10; }
+inline int f4783_11(int x) { return x * 11; }
+inline int f4783_12(int x) { return x * 12; }
+inline int f4783_13(int x) { return x * 13; }
+inline int f4783_14(int x) { return x * 14; }
+inline int f4783_15(int x) { return x * 15; }
+inline int f4783_16(int x) { return x * 16; }
+inline int f4783_17(int x) { return x * 17; }
+inline int f4783_18(int x) { return x * 18; }
+inline int f4783_19(int x) { return x * 19; }
+inline int f4783_20(int x) { return x * 20; }
+inline int f4783_21(int x) { return x * 21; }
+inline int f4783_22(int x) { return x * 22; }
+inline int f4783_23(int x) { return x * 23; }
+inline int f4783_24(int x) { return x * 24; }
+inline int f4783_25(int x) { return x * 25; }
+inline int f4783_26(int x) { return x * 26; }
+inline int f4783_27(int x) { return x * 27; }
+inline int f4783_28(int x) { return x * 28; }
+inline int f4783_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4787 */
+#include <vector>
+#include "h3666.h"
+#include "h4282.h"
+#include "h883.h"
+#include "h5584.h"
+#include "h3286.h"
+#ifdef X
+#include "h971.h"
+#endif
+struct S4787 { int a; const char *s = "x//y"; };
+inline int f4787_0(int x) { return x * 0; }
+inline int f4787_1(int x) { return x * 1; }
+inline int f4787_2(int x) { return x * 2; }
+inline int f4787_3(int x) { return x * 3; }
+inline int f4787_4(int x) { return x * 4; }
+inline int f4787_5(int x) { return x * 5; }
+inline int f4787_6(int x) { return x * 6; }
+inline int f4787_7(int x) { return x * 7; }
+inline int f4787_8(int x) { return x * 8; }
+inline int f4787_9(int x) { return x * 9; }
+inline int f4787_10(int x) { return x * 10; }
+inline int f4787_11(int x) { return x * 11; }
+inline int f4787_12(int x) { return x * 12; }
+inline int f4787_13(int x) { return x * 13; }
+inline int f4787_14(int x) { return x * 14; }
+inline int f4787_15(int x) { return x * 15; }
+inline int f4787_16(int x) { return x * 16; }
+inline int f4787_17(int x) { return x * 17; }
+inline int f4787_18(int x) { return x * 18; }
+inline int f4787_19(int x) { return x * 19; }
+inline int f4787_20(int x) { return x * 20; }
+inline int f4787_21(int x) { return x * 21; }
+inline int f4787_22(int x) { return x * 22; }
+inline int f4787_23(int x) { return x * 23; }
+inline int f4787_24(int x) { return x * 24; }
+inline int f4787_25(int x) { return x * 25; }
+inline int f4787_26(int x) { return x * 26; }
+inline int f4787_27(int x) { return x * 27; }
+inline int f4787_28(int x) { return x * 28; }
+inline int f4787_29(int x) { return x * 29; }
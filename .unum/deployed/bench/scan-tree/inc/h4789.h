@@ -0,0 +1,42 @@
+#pragma once
+/* header 4789 */
+#include <vector>
+#include "h7514.h"
+#include "h250.h"
+#include "h4840.h"
+#include "h2905.h"
+#include "h1291.h"
+#ifdef X
+#include "h346.h"
+#endif
+struct S4789 { int a; const char *s = "x//y"; };
+inline int f4789_0(int x) { return x * 0; }
+inline int f4789_1(int x) { return x * 1; }
+inline int f4789_2(int x) { return x * 2; }
+inline int f4789_3(int x) { return x * 3; }
+inline int f4789_4(int x) { return x * 4; }
+inline int f4789_5(int x) { return x * 5; }
+inline int f4789_6(int x) { return x * 6; }
+inline int f4789_7(int x) { return x * 7; }
+inline int f4789_8(int x) { return x * 8; }
+inline int f4789_9(int x) { return x * 9; }
+inline int f4789_10(int x) { return x * 10; }
+inline int f4789_11(int x) { return x * 11; }
+inline int f4789_12(int x) { return x * 12; }
+inline int f4789_13(int x) { return x * 13; }
+inline int f4789_14(int x) { return x * 14; }
+inline int f4789_15(int x) { return x * 15; }
+inline int f4789_16(int x) { return x * 16; }
+inline int f4789_17(int x) { return x * 17; }
+inline int f4789_18(int x) { return x * 18; }
+inline int f4789_19(int x) { return x * 19; }
+inline int f4789_20(int x) { return x * 20; }
+inline int f4789_21(int x) { return x * 21; }
+inline int f4789_22(int x) { return x * 22; }
+inline int f4789_23(int x) { return x * 23; }
+inline int f4789_24(int x) { return x * 24; }
+inline int f4789_25(int x) { return x * 25; }
+inline int f4789_26(int x) { return x * 26; }
+inline int f4789_27(int x) { return x * 27; }
+inline int f4789_28(int x) { return x * 28; }
+inline int f4789_29(int x) { return x * 29; }
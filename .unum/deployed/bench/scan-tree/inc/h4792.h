@@ -0,0 +1,42 @@
+#pragma once
+/* header 4792 */
+#include <vector>
+#include "h1611.h"
+#include "h2328.h"
+#include "h7953.h"
+#include "h2234.h"
+#include "h6570.h"
+#ifdef X
+#include "h5101.h"
+#endif
+struct S4792 { int a; const char *s = "x//y"; };
+inline int f4792_0(int x) { return x * 0; }
+inline int f4792_1(int x) { return x * 1; }
+inline int f4792_2(int x) { return x * 2; }
+inline int f4792_3(int x) { return x * 3; }
+inline int f4792_4(int x) { return x * 4; }
+inline int f4792_5(int x) { return x * 5; }
+inline int f4792_6(int x) { return x * 6; }
+inline int f4792_7(int x) { return x * 7; }
+inline int f4792_8(int x) { return x * 8; }
+inline int f4792_9(int x) { return x * 9; }
+inline int f4792_10(int x) { return x * 10; }
+inline int f4792_11(int x) { return x * 11; }
+inline int f4792_12(int x) { return x * 12; }
+inline int f4792_13(int x) { return x * 13; }
+inline int f4792_14(int x) { return x * 14; }
+inline int f4792_15(int x) { return x * 15; }
+inline int f4792_16(int x) { return x * 16; }
+inline int f4792_17(int x) { return x * 17; }
+inline int f4792_18(int x) { return x * 18; }
+inline int f4792_19(int x) { return x * 19; }
+inline int f4792_20(int x) { return x * 20; }
+inline int f4792_21(int x) { return x * 21; }
+inline int f4792_22(int x) { return x * 22; }
+inline int f4792_23(int x) { return x * 23; }
+inline int f4792_24(int x) { return x * 24; }
+inline int f4792_25(int x) { return x * 25; }
+inline int f4792_26(int x) { return x * 26; }
+inline int f4792_27(int x) { return x * 27; }
+inline int f4792_28(int x) { return x * 28; }
+inline int f4792_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4793 */
+#include <vector>
+#include "h819.h"
+#include "h9068.h"
+#include "h2264.h"
+#include "h4652.h"
+#include "h2967.h"
+#ifdef X
+#include "h3849.h"
+#endif
+struct S4793 { int a; const char *s = "x//y"; };
+inline int f4793_0(int x) { return x * 0; }
+inline int f4793_1(int x) { return x * 1; }
+inline int f4793_2(int x) { return x * 2; }
+inline int f4793_3(int x) { return x * 3; }
+inline int f4793_4(int x) { return x * 4; }
+inline int f4793_5(int x) { return x * 5; }
+inline int f4793_6(int x) { return x * 6; }
+inline int f4793_7(int x) { return x * 7; }
+inline int f4793_8(int x) { return x * 8; }
+inline int f4793_9(int x) { return x * 9; }
+inline int f4793_10(int x) { return x * 10; }
+inline int f4793_11(int x) { return x * 11; }
+inline int f4793_12(int x) { return x * 12; }
+inline int f4793_13(int x) { return x * 13; }
+inline int f4793_14(int x) { return x * 14; }
+inline int f4793_15(int x) { return x * 15; }
+inline int f4793_16(int x) { return x * 16; }
+inline int f4793_17(int x) { return x * 17; }
+inline int f4793_18(int x) { return x * 18; }
+inline int f4793_19(int x) { return x * 19; }
+inline int f4793_20(int x) { return x * 20; }
+inline int f4793_21(int x) { return x * 21; }
+inline int f4793_22(int x) { return x * 22; }
+inline int f4793_23(int x) { return x * 23; }
+inline int f4793_24(int x) { return x * 24; }
+inline int f4793_25(int x) { return x * 25; }
+inline int f4793_26(int x) { return x * 26; }
+inline int f4793_27(int x) { return x * 27; }
+inline int f4793_28(int x) { return x * 28; }
+inline int f4793_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4796 */
+#include <vector>
+#include "h2766.h"
+#include "h4659.h"
+#include "h2978.h"
+#include "h1044.h"
+#include "h474.h"
+#ifdef X
+#include "h1441.h"
+#endif
+struct S4796 { int a; const char *s = "x//y"; };
+inline int f4796_0(int x) { return x * 0; }
+inline int f4796_1(int x) { return x * 1; }
+inline int f4796_2(int x) { return x * 2; }
+inline int f4796_3(int x) { return x * 3; }
+inline int f4796_4(int x) { return x * 4; }
+inline int f4796_5(int x) { return x * 5; }
+inline int f4796_6(int x) { return x * 6; }
+inline int f4796_7(int x) { return x * 7; }
+inline int f4796_8(int x) { return x * 8; }
+inline int f4796_9(int x) { return x * 9; }
+inline int f4796_10(int x) { return x * 10; }
+inline int f4796_11(int x) { return x * 11; }
+inline int f4796_12(int x) { return x * 12; }
+inline int f4796_13(int x) { return x * 13; }
+inline int f4796_14(int x) { return x * 14; }
+inline int f4796_15(int x) { return x * 15; }
+inline int f4796_16(int x) { return x * 16; }
+inline int f4796_17(int x) { return x * 17; }
+inline int f4796_18(int x) { return x * 18; }
+inline int f4796_19(int x) { return x * 19; }
+inline int f4796_20(int x) { return x * 20; }
+inline int f4796_21(int x) { return x * 21; }
+inline int f4796_22(int x) { return x * 22; }
+inline int f4796_23(int x) { return x * 23; }
+inline int f4796_24(int x) { return x * 24; }
+inline int f4796_25(int x) { return x * 25; }
+inline int f4796_26(int x) { return x * 26; }
+inline int f4796_27(int x) { return x * 27; }
+inline int f4796_28(int x) { return x * 28; }
+inline int f4796_29(int x) { return x * 29; }
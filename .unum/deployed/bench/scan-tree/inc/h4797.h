@@ -0,0 +1,42 @@
+#pragma once
+/* header 4797 */
+#include <vector>
+#include "h6815.h"
+#include "h3525.h"
+#include "h8742.h"
+#include "h2470.h"
+#include "h2816.h"
+#ifdef X
+#include "h5083.h"
+#endif
+struct S4797 { int a; const char *s = "x//y"; };
+inline int f4797_0(int x) { return x * 0; }
+inline int f4797_1(int x) { return x * 1; }
+inline int f4797_2(int x) { return x * 2; }
+inline int f4797_3(int x) { return x * 3; }
+inline int f4797_4(int x) { return x * 4; }
+inline int f4797_5(int x) { return x * 5; }
+inline int f4797_6(int x) { return x * 6; }
+inline int f4797_7(int x) { return x * 7; }
+inline int f4797_8(int x) { return x * 8; }
+inline int f4797_9(int x) { return x * 9; }
+inline int f4797_10(int x) { return x * 10; }
+inline int f4797_11(int x) { return x * 11; }
+inline int f4797_12(int x) { return x * 12; }
+inline int f4797_13(int x) { return x * 13; }
+inline int f4797_14(int x) { return x * 14; }
+inline int f4797_15(int x) { return x * 15; }
+inline int f4797_16(int x) { return x * 16; }
+inline int f4797_17(int x) { return x * 17; }
+inline int f4797_18(int x) { return x * 18; }
+inline int f4797_19(int x) { return x * 19; }
+inline int f4797_20(int x) { return x * 20; }
+inline int f4797_21(int x) { return x * 21; }
+inline int f4797_22(int x) { return x * 22; }
+inline int f4797_23(int x) { return x * 23; }
+inline int f4797_24(int x) { return x * 24; }
+inline int f4797_25(int x) { return x * 25; }
+inline int f4797_26(int x) { return x * 26; }
+inline int f4797_27(int x) { return x * 27; }
+inline int f4797_28(int x) { return x * 28; }
+inline int f4797_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4798 */
+#include <vector>
+#include "h9674.h"
+#include "h8325.h"
+#include "h2530.h"
+#include "h3994.h"
+#include "h8531.h"
+#ifdef X
+#include "h94.h"
+#endif
+struct S4798 { int a; const char *s = "x//y"; };
+inline int f4798_0(int x) { return x * 0; }
+inline int f4798_1(int x) { return x * 1; }
+inline int f4798_2(int x) { return x * 2; }
+inline int f4798_3(int x) { return x * 3; }
+inline int f4798_4(int x) { return x * 4; }
+inline int f4798_5(int x) { return x * 5; }
+inline int f4798_6(int x) { return x * 6; }
+inline int f4798_7(int x) { return x * 7; }
+inline int f4798_8(int x) { return x * 8; }
+inline int f4798_9(int x) { return x * 9; }
+inline int f4798_10(int x) { return x * 10; }
+inline int f4798_11(int x) { return x * 11; }
+inline int f4798_12(int x) { return x * 12; }
+inline int f4798_13(int x) { return x * 13; }
+inline int f4798_14(int x) { return x * 14; }
+inline int f4798_15(int x) { return x * 15; }
+inline int f4798_16(int x) { return x * 16; }
+inline int f4798_17(int x) { return x * 17; }
+inline int f4798_18(int x) { return x * 18; }
+inline int f4798_19(int x) { return x * 19; }
+inline int f4798_20(int x) { return x * 20; }
+inline int f4798_21(int x) { return x * 21; }
+inline int f4798_22(int x) { return x * 22; }
+inline int f4798_23(int x) { return x * 23; }
+inline int f4798_24(int x) { return x * 24; }
+inline int f4798_25(int x) { return x * 25; }
+inline int f4798_26(int x) { return x * 26; }
+inline int f4798_27(int x) { return x * 27; }
+inline int f4798_28(int x) { return x * 28; }
+inline int f4798_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 48 */
+#include <vector>
+#include "h4261.h"
+#include "h2630.h"
+#include "h4098.h"
+#include "h1519.h"
+#include "h8395.h"
+#ifdef X
+#include "h6902.h"
+#endif
+struct S48 { int a; const char *s = "x//y"; };
+inline int f48_0(int x) { return x * 0; }
+inline int f48_1(int x) { return x * 1; }
+inline int f48_2(int x) { return x * 2; }
+inline int f48_3(int x) { return x * 3; }
+inline int f48_4(int x) { return x * 4; }
+inline int f48_5(int x) { return x * 5; }
+inline int f48_6(int x) { return x * 6; }
+inline int f48_7(int x) { return x * 7; }
+inline int f48_8(int x) { return x * 8; }
+inline int f48_9(int x) { return x * 9; }
+inline int f48_10(int x) { return x * 10; }
+inline int f48_11(int x) { return x * 11; }
+inline int f48_12(int x) { return x * 12; }
+inline int f48_13(int x) { return x * 13; }
+inline int f48_14(int x) { return x * 14; }
+inline int f48_15(int x) { return x * 15; }
+inline int f48_16(int x) { return x * 16; }
+inline int f48_17(int x) { return x * 17; }
+inline int f48_18(int x) { return x * 18; }
+inline int f48_19(int x) { return x * 19; }
+inline int f48_20(int x) { return x * 20; }
+inline int f48_21(int x) { return x * 21; }
+inline int f48_22(int x) { return x * 22; }
+inline int f48_23(int x) { return x * 23; }
+inline int f48_24(int x) { return x * 24; }
+inline int f48_25(int x) { return x * 25; }
+inline int f48_26(int x) { return x * 26; }
+inline int f48_27(int x) { return x * 27; }
+inline int f48_28(int x) { return x * 28; }
+inline int f48_29(int x) { return x * 29; }
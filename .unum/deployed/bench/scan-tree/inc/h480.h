@@ -0,0 +1,42 @@
+#pragma once
+/* header 480 */
+#include <vector>
+#include "h6948.h"
+#include "h9455.h"
+#include "h8551.h"
+#include "h4589.h"
+#include "h8374.h"
+#ifdef X
+#include "h4635.h"
+#endif
+struct S480 { int a; const char *s = "x//y"; };
+inline int f480_0(int x) { return x * 0; }
+inline int f480_1(int x) { return x * 1; }
+inline int f480_2(int x) { return x * 2; }
+inline int f480_3(int x) { return x * 3; }
+inline int f480_4(int x) { return x * 4; }
+inline int f480_5(int x) { return x * 5; }
+inline int f480_6(int x) { return x * 6; }
+inline int f480_7(int x) { return x * 7; }
+inline int f480_8(int x) { return x * 8; }
+inline int f480_9(int x) { return x * 9; }
+inline int f480_10(int x) { return x * 10; }
+inline int f480_11(int x) { return x * 11; }
+inline int f480_12(int x) { return x * 12; }
+inline int f480_13(int x) { return x * 13; }
+inline int f480_14(int x) { return x * 14; }
+inline int f480_15(int x) { return x * 15; }
+inline int f480_16(int x) { return x * 16; }
+inline int f480_17(int x) { return x * 17; }
+inline int f480_18(int x) { return x * 18; }
+inline int f480_19(int x) { return x * 19; }
+inline int f480_20(int x) { return x * 20; }
+inline int f480_21(int x) { return x * 21; }
+inline int f480_22(int x) { return x * 22; }
+inline int f480_23(int x) { return x * 23; }
+inline int f480_24(int x) { return x * 24; }
+inline int f480_25(int x) { return x * 25; }
+inline int f480_26(int x) { return x * 26; }
+inline int f480_27(int x) { return x * 27; }
+inline int f480_28(int x) { return x * 28; }
+inline int f480_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4801 */
+#include <vector>
+#include "h7018.h"
+#include "h8993.h"
+#include "h7749.h"
+#include "h6287.h"
+#include "h2299.h"
+#ifdef X
+#include "h5347.h"
+#endif
+struct S4801 { int a; const char *s = "x//y"; };
+inline int f4801_0(int x) { return x * 0; }
+inline int f4801_1(int x) { return x * 1; }
+inline int f4801_2(int x) { return x * 2; }
+inline int f4801_3(int x) { return x * 3; }
+inline int f4801_4(int x) { return x * 4; }
+inline int f4801_5(int x) { return x * 5; }
+inline int f4801_6(int x) { return x * 6; }
+inline int f4801_7(int x) { return x * 7; }
+inline int f4801_8(int x) { return x * 8; }
+inline int f4801_9(int x) { return x * 9; }
+inline int f4801_10(int x) { return x * 10; }
+inline int f4801_11(int x) { return x * 11; }
+inline int f4801_12(int x) { return x * 12; }
+inline int f4801_13(int x) { return x * 13; }
+inline int f4801_14(int x) { return x * 14; }
+inline int f4801_15(int x) { return x * 15; }
+inline int f4801_16(int x) { return x * 16; }
+inline int f4801_17(int x) { return x * 17; }
+inline int f4801_18(int x) { return x * 18; }
+inline int f4801_19(int x) { return x * 19; }
+inline int f4801_20(int x) { return x * 20; }
+inline int f4801_21(int x) { return x * 21; }
+inline int f4801_22(int x) { return x * 22; }
+inline int f4801_23(int x) { return x * 23; }
+inline int f4801_24(int x) { return x * 24; }
+inline int f4801_25(int x) { return x * 25; }
+inline int f4801_26(int x) { return x * 26; }
+inline int f4801_27(int x) { return x * 27; }
+inline int f4801_28(int x) { return x * 28; }
+inline int f4801_29(int x) { return x * 29; }
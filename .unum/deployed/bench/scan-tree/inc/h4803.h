@@ -0,0 +1,42 @@
+#pragma once
+/* header 4803 */
+#include <vector>
+#include "h4256.h"
+#include "h4871.h"
+#include "h8251.h"
+#include "h5436.h"
+#include "h5542.h"
+#ifdef X
+#include "h9164.h"
+#endif
+struct S4803 { int a; const char *s = "x//y"; };
+inline int f4803_0(int x) { return x * 0; }
+inline int f4803_1(int x) { return x * 1; }
+inline int f4803_2(int x) { return x * 2; }
+inline int f4803_3(int x) { return x * 3; }
+inline int f4803_4(int x) { return x * 4; }
+inline int f4803_5(int x) { return x * 5; }
+inline int f4803_6(int x) { return x * 6; }
+inline int f4803_7(int x) { return x * 7; }
+inline int f4803_8(int x) { return x * 8; }
+inline int f4803_9(int x) { return x * 9; }
+inline int f4803_10(int x) { return x * 10; }
+inline int f4803_11(int x) { return x * 11; }
+inline int f4803_12(int x) { return x * 12; }
+inline int f4803_13(int x) { return x * 13; }
+inline int f4803_14(int x) { return x * 14; }
+inline int f4803_15(int x) { return x * 15; }
+inline int f4803_16(int x) { return x * 16; }
+inline int f4803_17(int x) { return x * 17; }
+inline int f4803_18(int x) { return x * 18; }
+inline int f4803_19(int x) { return x * 19; }
+inline int f4803_20(int x) { return x * 20; }
+inline int f4803_21(int x) { return x * 21; }
+inline int f4803_22(int x) { return x * 22; }
+inline int f4803_23(int x) { return x * 23; }
+inline int f4803_24(int x) { return x * 24; }
+inline int f4803_25(int x) { return x * 25; }
+inline int f4803_26(int x) { return x * 26; }
+inline int f4803_27(int x) { return x * 27; }
+inline int f4803_28(int x) { return x * 28; }
+inline int f4803_29(int x) { return x * 29; }
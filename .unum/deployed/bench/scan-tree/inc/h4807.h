@@ -0,0 +1,42 @@
+#pragma once
+/* header 4807 */
+#include <vector>
+#include "h8740.h"
+#include "h2443.h"
+#include "h5825.h"
+#include "h4773.h"
+#include "h8908.h"
+#ifdef X
+#include "h856.h"
+#endif
+struct S4807 { int a; const char *s = "x//y"; };
+inline int f4807_0(int x) { return x * 0; }
+inline int f4807_1(int x) { return x * 1; }
+inline int f4807_2(int x) { return x * 2; }
+inline int f4807_3(int x) { return x * 3; }
+inline int f4807_4(int x) { return x * 4; }
+inline int f4807_5(int x) { return x * 5; }
+inline int f4807_6(int x) { return x * 6; }
+inline int f4807_7(int x) { return x * 7; }
+inline int f4807_8(int x) { return x * 8; }
+inline int f4807_9(int x) { return x * 9; }
+inline int f4807_10(int x) { return x * 10; }
+inline int f4807_11(int x) { return x * 11; }
+inline int f4807_12(int x) { return x * 12; }
+inline int f4807_13(int x) { return x * 13; }
+inline int f4807_14(int x) { return x * 14; }
+inline int f4807_15(int x) { return x * 15; }
+inline int f4807_16(int x) { return x * 16; }
+inline int f4807_17(int x) { return x * 17; }
+inline int f4807_18(int x) { return x * 18; }
+inline int f4807_19(int x) { return x * 19; }
+inline int f4807_20(int x) { return x * 20; }
+inline int f4807_21(int x) { return x * 21; }
+inline int f4807_22(int x) { return x * 22; }
+inline int f4807_23(int x) { return x * 23; }
+inline int f4807_24(int x) { return x * 24; }
+inline int f4807_25(int x) { return x * 25; }
+inline int f4807_26(int x) { return x * 26; }
+inline int f4807_27(int x) { return x * 27; }
+inline int f4807_28(int x) { return x * 28; }
+inline int f4807_29(int x) { return x * 29; }
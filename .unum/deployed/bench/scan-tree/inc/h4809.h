@@ -0,0 +1,42 @@
+#pragma once
+/* header 4809 */
+#include <vector>
+#include "h622.h"
+#include "h3910.h"
+#include "h3530.h"
+#include "h6858.h"
+#include "h9939.h"
+#ifdef X
+#include "h6150.h"
+#endif
+struct S4809 { int a; const char *s = "x//y"; };
+inline int f4809_0(int x) { return x * 0; }
+inline int f4809_1(int x) { return x * 1; }
+inline int f4809_2(int x) { return x * 2; }
+inline int f4809_3(int x) { return x * 3; }
+inline int f4809_4(int x) { return x * 4; }
+inline int f4809_5(int x) { return x * 5; }
+inline int f4809_6(int x) { return x * 6; }
+inline int f4809_7(int x) { return x * 7; }
+inline int f4809_8(int x) { return x * 8; }
+inline int f4809_9(int x) { return x * 9; }
+inline int f4809_10(int x) { return x * 10; }
+inline int f4809_11(int x) { return x * 11; }
+inline int f4809_12(int x) { return x * 12; }
+inline int f4809_13(int x) { return x * 13; }
+inline int f4809_14(int x) { return x * 14; }
+inline int f4809_15(int x) { return x * 15; }
+inline int f4809_16(int x) { return x * 16; }
+inline int f4809_17(int x) { return x * 17; }
+inline int f4809_18(int x) { return x * 18; }
+inline int f4809_19(int x) { return x * 19; }
+inline int f4809_20(int x) { return x * 20; }
+inline int f4809_21(int x) { return x * 21; }
+inline int f4809_22(int x) { return x * 22; }
+inline int f4809_23(int x) { return x * 23; }
+inline int f4809_24(int x) { return x * 24; }
+inline int f4809_25(int x) { return x * 25; }
+inline int f4809_26(int x) { return x * 26; }
+inline int f4809_27(int x) { return x * 27; }
+inline int f4809_28(int x) { return x * 28; }
+inline int f4809_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4816 */
+#include <vector>
+#include "h807.h"
+#include "h629.h"
+#include "h8960.h"
+#include "h8358.h"
+#include "h555.h"
+#ifdef X
+#include "h704.h"
+#endif
+struct S4816 { int a; const char *s = "x//y"; };
+inline int f4816_0(int x) { return x * 0; }
+inline int f4816_1(int x) { return x * 1; }
+inline int f4816_2(int x) { return x * 2; }
+inline int f4816_3(int x) { return x * 3; }
+inline int f4816_4(int x) { return x * 4; }
+inline int f4816_5(int x) { return x * 5; }
+inline int f4816_6(int x) { return x * 6; }
+inline int f4816_7(int x) { return x * 7; }
+inline int f4816_8(int x) { return x * 8; }
+inline int f4816_9(int x) { return x * 9; }
+inline int f4816_10(int x) { return x * 10; }
+inline int f4816_11(int x) { return x * 11; }
+inline int f4816_12(int x) { return x * 12; }
+inline int f4816_13(int x) { return x * 13; }
+inline int f4816_14(int x) { return x * 14; }
+inline int f4816_15(int x) { return x * 15; }
+inline int f4816_16(int x) { return x * 16; }
+inline int f4816_17(int x) { return x * 17; }
+inline int f4816_18(int x) { return x * 18; }
+inline int f4816_19(int x) { return x * 19; }
+inline int f4816_20(int x) { return x * 20; }
+inline int f4816_21(int x) { return x * 21; }
+inline int f4816_22(int x) { return x * 22; }
+inline int f4816_23(int x) { return x * 23; }
+inline int f4816_24(int x) { return x * 24; }
+inline int f4816_25(int x) { return x * 25; }
+inline int f4816_26(int x) { return x * 26; }
+inline int f4816_27(int x) { return x * 27; }
+inline int f4816_28(int x) { return x * 28; }
+inline int f4816_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4819 */
+#include <vector>
+#include "h6783.h"
+#include "h8267.h"
+#include "h5295.h"
+#include "h241.h"
+#include "h7901.h"
+#ifdef X
+#include "h7754.h"
+#endif
+struct S4819 { int a; const char *s = "x//y"; };
+inline int f4819_0(int x) { return x * 0; }
+inline int f4819_1(int x) { return x * 1; }
+inline int f4819_2(int x) { return x * 2; }
+inline int f4819_3(int x) { return x * 3; }
+inline int f4819_4(int x) { return x * 4; }
+inline int f4819_5(int x) { return x * 5; }
+inline int f4819_6(int x) { return x * 6; }
+inline int f4819_7(int x) { return x * 7; }
+inline int f4819_8(int x) { return x * 8; }
+inline int f4819_9(int x) { return x * 9; }
+inline int f4819_10(int x) { return x * 10; }
+inline int f4819_11(int x) { return x * 11; }
+inline int f4819_12(int x) { return x * 12; }
+inline int f4819_13(int x) { return x * 13; }
+inline int f4819_14(int x) { return x * 14; }
+inline int f4819_15(int x) { return x * 15; }
+inline int f4819_16(int x) { return x * 16; }
+inline int f4819_17(int x) { return x * 17; }
+inline int f4819_18(int x) { return x * 18; }
+inline int f4819_19(int x) { return x * 19; }
+inline int f4819_20(int x) { return x * 20; }
+inline int f4819_21(int x) { return x * 21; }
+inline int f4819_22(int x) { return x * 22; }
+inline int f4819_23(int x) { return x * 23; }
+inline int f4819_24(int x) { return x * 24; }
+inline int f4819_25(int x) { return x * 25; }
+inline int f4819_26(int x) { return x * 26; }
+inline int f4819_27(int x) { return x * 27; }
+inline int f4819_28(int x) { return x * 28; }
+inline int f4819_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 482 */
+#include <vector>
+#include "h7911.h"
+#include "h4180.h"
+#include "h8543.h"
+#include "h9533.h"
+#include "h8953.h"
+#ifdef X
+#include "h835.h"
+#endif
+struct S482 { int a; const char *s = "x//y"; };
+inline int f482_0(int x) { return x * 0; }
+inline int f482_1(int x) { return x * 1; }
+inline int f482_2(int x) { return x * 2; }
+inline int f482_3(int x) { return x * 3; }
+inline int f482_4(int x) { return x * 4; }
+inline int f482_5(int x) { return x * 5; }
+inline int f482_6(int x) { return x * 6; }
+inline int f482_7(int x) { return x * 7; }
+inline int f482_8(int x) { return x * 8; }
+inline int f482_9(int x) { return x * 9; }
+inline int f482_10(int x) { return x * 10; }
+inline int f482_11(int x) { return x * 11; }
+inline int f482_12(int x) { return x * 12; }
+inline int f482_13(int x) { return x * 13; }
+inline int f482_14(int x) { return x * 14; }
+inline int f482_15(int x) { return x * 15; }
+inline int f482_16(int x) { return x * 16; }
+inline int f482_17(int x) { return x * 17; }
+inline int f482_18(int x) { return x * 18; }
+inline int f482_19(int x) { return x * 19; }
+inline int f482_20(int x) { return x * 20; }
+inline int f482_21(int x) { return x * 21; }
+inline int f482_22(int x) { return x * 22; }
+inline int f482_23(int x) { return x * 23; }
+inline int f482_24(int x) { return x * 24; }
+inline int f482_25(int x) { return x * 25; }
+inline int f482_26(int x) { return x * 26; }
+inline int f482_27(int x) { return x * 27; }
+inline int f482_28(int x) { return x * 28; }
+inline int f482_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4821 */
+#include <vector>
+#include "h957.h"
+#include "h9147.h"
+#include "h2240.h"
+#include "h7801.h"
+#include "h8788.h"
+#ifdef X
+#include "h4772.h"
+#endif
+struct S4821 { int a; const char *s = "x//y"; };
+inline int f4821_0(int x) { return x * 0; }
+inline int f4821_1(int x) { return x * 1; }
+inline int f4821_2(int x) { return x * 2; }
+inline int f4821_3(int x) { return x * 3; }
+inline int f4821_4(int x) { return x * 4; }
+inline int f4821_5(int x) { return x * 5; }
+inline int f4821_6(int x) { return x * 6; }
+inline int f4821_7(int x) { return x * 7; }
+inline int f4821_8(int x) { return x * 8; }
+inline int f4821_9(int x) { return x * 9; }
+inline int f4821_10(int x) { return x * 10; }
+inline int f4821_11(int x) { return x * 11; }
+inline int f4821_12(int x) { return x * 12; }
+inline int f4821_13(int x) { return x * 13; }
+inline int f4821_14(int x) { return x * 14; }
+inline int f4821_15(int x) { return x * 15; }
+inline int f4821_16(int x) { return x * 16; }
+inline int f4821_17(int x) { return x * 17; }
+inline int f4821_18(int x) { return x * 18; }
+inline int f4821_19(int x) { return x * 19; }
+inline int f4821_20(int x) { return x * 20; }
+inline int f4821_21(int x) { return x * 21; }
+inline int f4821_22(int x) { return x * 22; }
+inline int f4821_23(int x) { return x * 23; }
+inline int f4821_24(int x) { return x * 24; }
+inline int f4821_25(int x) { return x * 25; }
+inline int f4821_26(int x) { return x * 26; }
+inline int f4821_27(int x) { return x * 27; }
+inline int f4821_28(int x) { return x * 28; }
+inline int f4821_29(int x) { return x * 29; }
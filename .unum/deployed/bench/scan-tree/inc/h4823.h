@@ -0,0 +1,42 @@
+#pragma once
+/* header 4823 */
+#include <vector>
+#include "h1229.h"
+#include "h5186.h"
+#include "h386.h"
+#include "h2404.h"
+#include "h8428.h"
+#ifdef X
+#include "h4948.h"
+#endif
+struct S4823 { int a; const char *s = "x//y"; };
+inline int f4823_0(int x) { return x * 0; }
+inline int f4823_1(int x) { return x * 1; }
+inline int f4823_2(int x) { return x * 2; }
+inline int f4823_3(int x) { return x * 3; }
+inline int f4823_4(int x) { return x * 4; }
+inline int f4823_5(int x) { return x * 5; }
+inline int f4823_6(int x) { return x * 6; }
+inline int f4823_7(int x) { return x * 7; }
+inline int f4823_8(int x) { return x * 8; }
+inline int f4823_9(int x) { return x * 9; }
+inline int f4823_10(int x) { return x * 10; }
+inline int f4823_11(int x) { return x * 11; }
+inline int f4823_12(int x) { return x * 12; }
+inline int f4823_13(int x) { return x * 13; }
+inline int f4823_14(int x) { return x * 14; }
+inline int f4823_15(int x) { return x * 15; }
+inline int f4823_16(int x) { return x * 16; }
+inline int f4823_17(int x) { return x * 17; }
+inline int f4823_18(int x) { return x * 18; }
+inline int f4823_19(int x) { return x * 19; }
+inline int f4823_20(int x) { return x * 20; }
+inline int f4823_21(int x) { return x * 21; }
+inline int f4823_22(int x) { return x * 22; }
+inline int f4823_23(int x) { return x * 23; }
+inline int f4823_24(int x) { return x * 24; }
+inline int f4823_25(int x) { return x * 25; }
+inline int f4823_26(int x) { return x * 26; }
+inline int f4823_27(int x) { return x * 27; }
+inline int f4823_28(int x) { return x * 28; }
+inline int f4823_29(int x) { return x * 29; }
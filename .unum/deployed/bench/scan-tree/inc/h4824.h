@@ -0,0 +1,42 @@
+#pragma once
+/* header 4824 */
+#include <vector>
+#include "h9383.h"
+#include "h9065.h"
+#include "h6468.h"
+#include "h2216.h"
+#include "h9139.h"
+#ifdef X
+#include "h2584.h"
+#endif
+struct S4824 { int a; const char *s = "x//y"; };
+inline int f4824_0(int x) { return x * 0; }
+inline int f4824_1(int x) { return x * 1; }
+inline int f4824_2(int x) { return x * 2; }
+inline int f4824_3(int x) { return x * 3; }
+inline int f4824_4(int x) { return x * 4; }
+inline int f4824_5(int x) { return x * 5; }
+inline int f4824_6(int x) { return x * 6; }
+inline int f4824_7(int x) { return x * 7; }
+inline int f4824_8(int x) { return x * 8; }
+inline int f4824_9(int x) { return x * 9; }
+inline int f4824_10(int x) { return x * 10; }
+inline int f4824_11(int x) { return x * 11; }
+inline int f4824_12(int x) { return x * 12; }
+inline int f4824_13(int x) { return x * 13; }
+inline int f4824_14(int x) { return x * 14; }
+inline int f4824_15(int x) { return x * 15; }
+inline int f4824_16(int x) { return x * 16; }
+inline int f4824_17(int x) { return x * 17; }
+inline int f4824_18(int x) { return x * 18; }
+inline int f4824_19(int x) { return x * 19; }
+inline int f4824_20(int x) { return x * 20; }
+inline int f4824_21(int x) { return x * 21; }
+inline int f4824_22(int x) { return x * 22; }
+inline int f4824_23(int x) { return x * 23; }
+inline int f4824_24(int x) { return x * 24; }
+inline int f4824_25(int x) { return x * 25; }
+inline int f4824_26(int x) { return x * 26; }
+inline int f4824_27(int x) { return x * 27; }
+inline int f4824_28(int x) { return x * 28; }
+inline int f4824_29(int x) { return x * 29; }
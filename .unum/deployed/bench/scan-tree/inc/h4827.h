@@ -0,0 +1,42 @@
+#pragma once
+/* header 4827 */
+#include <vector>
+#include "h679.h"
+#include "h8591.h"
+#include "h7158.h"
+#include "h961.h"
+#include "h4649.h"
+#ifdef X
+#include "h6944.h"
+#endif
+struct S4827 { int a; const char *s = "x//y"; };
+inline int f4827_0(int x) { return x * 0; }
+inline int f4827_1(int x) { return x * 1; }
+inline int f4827_2(int x) { return x * 2; }
+inline int f4827_3(int x) { return x * 3; }
+inline int f4827_4(int x) { return x * 4; }
+inline int f4827_5(int x) { return x * 5; }
+inline int f4827_6(int x) { return x * 6; }
+inline int f4827_7(int x) { return x * 7; }
+inline int f4827_8(int x) { return x * 8; }
+inline int f4827_9(int x) { return x * 9; }
+inline int f4827_10(int x) { return x * 10; }
+inline int f4827_11(int x) { return x * 11; }
+inline int f4827_12(int x) { return x * 12; }
+inline int f4827_13(int x) { return x * 13; }
+inline int f4827_14(int x) { return x * 14; }
+inline int f4827_15(int x) { return x * 15; }
+inline int f4827_16(int x) { return x * 16; }
+inline int f4827_17(int x) { return x * 17; }
+inline int f4827_18(int x) { return x * 18; }
+inline int f4827_19(int x) { return x * 19; }
+inline int f4827_20(int x) { return x * 20; }
+inline int f4827_21(int x) { return x * 21; }
+inline int f4827_22(int x) { return x * 22; }
+inline int f4827_23(int x) { return x * 23; }
+inline int f4827_24(int x) { return x * 24; }
+inline int f4827_25(int x) { return x * 25; }
+inline int f4827_26(int x) { return x * 26; }
+inline int f4827_27(int x) { return x * 27; }
+inline int f4827_28(int x) { return x * 28; }
+inline int f4827_29(int x) { return x * 29; }
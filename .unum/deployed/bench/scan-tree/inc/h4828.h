@@ -0,0 +1,42 @@
+#pragma once
+/* header 4828 */
+#include <vector>
+#include "h5728.h"
+#include "h2648.h"
+#include "h4151.h"
+#include "h6756.h"
+#include "h9538.h"
+#ifdef X
+#include "h182.h"
+#endif
+struct S4828 { int a; const char *s = "x//y"; };
+inline int f4828_0(int x) { return x * 0; }
+inline int f4828_1(int x) { return x * 1; }
+inline int f4828_2(int x) { return x * 2; }
+inline int f4828_3(int x) { return x * 3; }
+inline int f4828_4(int x) { return x * 4; }
+inline int f4828_5(int x) { return x * 5; }
+inline int f4828_6(int x) { return x * 6; }
+inline int f4828_7(int x) { return x * 7; }
+inline int f4828_8(int x) { return x * 8; }
+inline int f4828_9(int x) { return x * 9; }
+inline int f4828_10(int x) { return x * 10; }
+inline int f4828_11(int x) { return x * 11; }
+inline int f4828_12(int x) { return x * 12; }
+inline int f4828_13(int x) { return x * 13; }
+inline int f4828_14(int x) { return x * 14; }
+inline int f4828_15(int x) { return x * 15; }
+inline int f4828_16(int x) { return x * 16; }
+inline int f4828_17(int x) { return x * 17; }
+inline int f4828_18(int x) { return x * 18; }
+inline int f4828_19(int x) { return x * 19; }
+inline int f4828_20(int x) { return x * 20; }
+inline int f4828_21(int x) { return x * 21; }
+inline int f4828_22(int x) { return x * 22; }
+inline int f4828_23(int x) { return x * 23; }
+inline int f4828_24(int x) { return x * 24; }
+inline int f4828_25(int x) { return x * 25; }
+inline int f4828_26(int x) { return x * 26; }
+inline int f4828_27(int x) { return x * 27; }
+inline int f4828_28(int x) { return x * 28; }
+inline int f4828_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4829 */
+#include <vector>
+#include "h1324.h"
+#include "h4242.h"
+#include "h4175.h"
+#include "h1504.h"
+#include "h5794.h"
+#ifdef X
+#include "h688.h"
+#endif
+struct S4829 { int a; const char *s = "x//y"; };
+inline int f4829_0(int x) { return x * 0; }
+inline int f4829_1(int x) { return x * 1; }
+inline int f4829_2(int x) { return x * 2; }
+inline int f4829_3(int x) { return x * 3; }
+inline int f4829_4(int x) { return x * 4; }
+inline int f4829_5(int x) { return x * 5; }
+inline int f4829_6(int x) { return x * 6; }
+inline int f4829_7(int x) { return x * 7; }
+inline int f4829_8(int x) { return x * 8; }
+inline int f4829_9(int x) { return x * 9; }
+inline int f4829_10(int x) { return x * 10; }
+inline int f4829_11(int x) { return x * 11; }
+inline int f4829_12(int x) { return x * 12; }
+inline int f4829_13(int x) { return x * 13; }
+inline int f4829_14(int x) { return x * 14; }
+inline int f4829_15(int x) { return x * 15; }
+inline int f4829_16(int x) { return x * 16; }
+inline int f4829_17(int x) { return x * 17; }
+inline int f4829_18(int x) { return x * 18; }
+inline int f4829_19(int x) { return x * 19; }
+inline int f4829_20(int x) { return x * 20; }
+inline int f4829_21(int x) { return x * 21; }
+inline int f4829_22(int x) { return x * 22; }
+inline int f4829_23(int x) { return x * 23; }
+inline int f4829_24(int x) { return x * 24; }
+inline int f4829_25(int x) { return x * 25; }
+inline int f4829_26(int x) { return x * 26; }
+inline int f4829_27(int x) { return x * 27; }
+inline int f4829_28(int x) { return x * 28; }
+inline int f4829_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 483 */
+#include <vector>
+#include "h6971.h"
+#include "h3030.h"
+#include "h667.h"
+#include "h2331.h"
+#include "h5315.h"
+#ifdef X
+#include "h6058.h"
+#endif
+struct S483 { int a; const char *s = "x//y"; };
+inline int f483_0(int x) { return x * 0; }
+inline int f483_1(int x) { return x * 1; }
+inline int f483_2(int x) { return x * 2; }
+inline int f483_3(int x) { return x * 3; }
+inline int f483_4(int x) { return x * 4; }
+inline int f483_5(int x) { return x * 5; }
+inline int f483_6(int x) { return x * 6; }
+inline int f483_7(int x) { return x * 7; }
+inline int f483_8(int x) { return x * 8; }
+inline int f483_9(int x) { return x * 9; }
+inline int f483_10(int x) { return x * 10; }
+inline int f483_11(int x) { return x * 11; }
+inline int f483_12(int x) { return x * 12; }
+inline int f483_13(int x) { return x * 13; }
+inline int f483_14(int x) { return x * 14; }
+inline int f483_15(int x) { return x * 15; }
+inline int f483_16(int x) { return x * 16; }
+inline int f483_17(int x) { return x * 17; }
+inline int f483_18(int x) { return x * 18; }
+inline int f483_19(int x) { return x * 19; }
+inline int f483_20(int x) { return x * 20; }
+inline int f483_21(int x) { return x * 21; }
+inline int f483_22(int x) { return x * 22; }
+inline int f483_23(int x) { return x * 23; }
+inline int f483_24(int x) { return x * 24; }
+inline int f483_25(int x) { return x * 25; }
+inline int f483_26(int x) { return x * 26; }
+inline int f483_27(int x) { return x * 27; }
+inline int f483_28(int x) { return x * 28; }
+inline int f483_29(int x) { return x * 29; }
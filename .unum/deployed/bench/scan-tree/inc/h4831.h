@@ -0,0 +1,42 @@
+#pragma once
+/* header 4831 */
+#include <vector>
+#include "h9029.h"
+#include "h6929.h"
+#include "h8155.h"
+#include "h4991.h"
+#include "h2011.h"
+#ifdef X
+#include "h5668.h"
+#endif
+struct S4831 { int a; const char *s = "x//y"; };
+inline int f4831_0(int x) { return x * 0; }
+inline int f4831_1(int x) { return x * 1; }
+inline int f4831_2(int x) { return x * 2; }
+inline int f4831_3(int x) { return x * 3; }
+inline int f4831_4(int x) { return x * 4; }
+inline int f4831_5(int x) { return x * 5; }
+inline int f4831_6(int x) { return x * 6; }
+inline int f4831_7(int x) { return x * 7; }
+inline int f4831_8(int x) { return x * 8; }
+inline int f4831_9(int x) { return x * 9; }
+inline int f4831_10(int x) { return x * 10; }
+inline int f4831_11(int x) { return x * 11; }
+inline int f4831_12(int x) { return x * 12; }
+inline int f4831_13(int x) { return x * 13; }
+inline int f4831_14(int x) { return x * 14; }
+inline int f4831_15(int x) { return x * 15; }
+inline int f4831_16(int x) { return x * 16; }
+inline int f4831_17(int x) { return x * 17; }
+inline int f4831_18(int x) { return x * 18; }
+inline int f4831_19(int x) { return x * 19; }
+inline int f4831_20(int x) { return x * 20; }
+inline int f4831_21(int x) { return x * 21; }
+inline int f4831_22(int x) { return x * 22; }
+inline int f4831_23(int x) { return x * 23; }
+inline int f4831_24(int x) { return x * 24; }
+inline int f4831_25(int x) { return x * 25; }
+inline int f4831_26(int x) { return x * 26; }
+inline int f4831_27(int x) { return x * 27; }
+inline int f4831_28(int x) { return x * 28; }
+inline int f4831_29(int x) { return x * 29; }
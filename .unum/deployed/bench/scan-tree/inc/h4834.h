@@ -0,0 +1,42 @@
+#pragma once
+/* header 4834 */
+#include <vector>
+#include "h9159.h"
+#include "h3260.h"
+#include "h3281.h"
+#include "h1554.h"
+#include "h758.h"
+#ifdef X
+#include "h727.h"
+#endif
+struct S4834 { int a; const char *s = "x//y"; };
+inline int f4834_0(int x) { return x * 0; }
+inline int f4834_1(int x) { return x * 1; }
+inline int f4834_2(int x) { return x * 2; }
+inline int f4834_3(int x) { return x * 3; }
+inline int f4834_4(int x) { return x * 4; }
+inline int f4834_5(int x) { return x * 5; }
+inline int f4834_6(int x) { return x * 6; }
+inline int f4834_7(int x) { return x * 7; }
+inline int f4834_8(int x) { return x * 8; }
+inline int f4834_9(int x) { return x * 9; }
+inline int f4834_10(int x) { return x * 10; }
+inline int f4834_11(int x) { return x * 11; }
+inline int f4834_12(int x) { return x * 12; }
+inline int f4834_13(int x) { return x * 13; }
+inline int f4834_14(int x) { return x * 14; }
+inline int f4834_15(int x) { return x * 15; }
+inline int f4834_16(int x) { return x * 16; }
+inline int f4834_17(int x) { return x * 17; }
+inline int f4834_18(int x) { return x * 18; }
+inline int f4834_19(int x) { return x * 19; }
+inline int f4834_20(int x) { return x * 20; }
+inline int f4834_21(int x) { return x * 21; }
+inline int f4834_22(int x) { return x * 22; }
+inline int f4834_23(int x) { return x * 23; }
+inline int f4834_24(int x) { return x * 24; }
+inline int f4834_25(int x) { return x * 25; }
+inline int f4834_26(int x) { return x * 26; }
+inline int f4834_27(int x) { return x * 27; }
+inline int f4834_28(int x) { return x * 28; }
+inline int f4834_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4835 */
+#include <vector>
+#include "h1397.h"
+#include "h8032.h"
+#include "h5853.h"
+#include "h8887.h"
+#include "h7653.h"
+#ifdef X
+#include "h5832.h"
+#endif
+struct S4835 { int a; const char *s = "x//y"; };
+inline int f4835_0(int x) { return x * 0; }
+inline int f4835_1(int x) { return x * 1; }
+inline int f4835_2(int x) { return x * 2; }
+inline int f4835_3(int x) { return x * 3; }
+inline int f4835_4(int x) { return x * 4; }
+inline int f4835_5(int x) { return x * 5; }
+inline int f4835_6(int x) { return x * 6; }
+inline int f4835_7(int x) { return x * 7; }
+inline int f4835_8(int x) { return x * 8; }
+inline int f4835_9(int x) { return x * 9; }
+inline int f4835_10(int x) { return x * 10; }
+inline int f4835_11(int x) { return x * 11; }
+inline int f4835_12(int x) { return x * 12; }
+inline int f4835_13(int x) { return x * 13; }
+inline int f4835_14(int x) { return x * 14; }
+inline int f4835_15(int x) { return x * 15; }
+inline int f4835_16(int x) { return x * 16; }
+inline int f4835_17(int x) { return x * 17; }
+inline int f4835_18(int x) { return x * 18; }
+inline int f4835_19(int x) { return x * 19; }
+inline int f4835_20(int x) { return x * 20; }
+inline int f4835_21(int x) { return x * 21; }
+inline int f4835_22(int x) { return x * 22; }
+inline int f4835_23(int x) { return x * 23; }
+inline int f4835_24(int x) { return x * 24; }
+inline int f4835_25(int x) { return x * 25; }
+inline int f4835_26(int x) { return x * 26; }
+inline int f4835_27(int x) { return x * 27; }
+inline int f4835_28(int x) { return x * 28; }
+inline int f4835_29(int x) { return x * 29; }
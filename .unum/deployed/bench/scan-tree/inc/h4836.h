@@ -0,0 +1,42 @@
+#pragma once
+/* header 4836 */
+#include <vector>
+#include "h5444.h"
+#include "h5609.h"
+#include "h369.h"
+#include "h5125.h"
+#include "h6029.h"
+#ifdef X
+#include "h6418.h"
+#endif
+struct S4836 { int a; const char *s = "x//y"; };
+inline int f4836_0(int x) { return x * 0; }
+inline int f4836_1(int x) { return x * 1; }
+inline int f4836_2(int x) { return x * 2; }
+inline int f4836_3(int x) { return x * 3; }
+inline int f4836_4(int x) { return x * 4; }
+inline int f4836_5(int x) { return x * 5; }
+inline int f4836_6(int x) { return x * 6; }
+inline int f4836_7(int x) { return x * 7; }
+inline int f4836_8(int x) { return x * 8; }
+inline int f4836_9(int x) { return x * 9; }
+inline int f4836_10(int x) { return x * 10; }
+inline int f4836_11(int x) { return x * 11; }
+inline int f4836_12(int x) { return x * 12; }
+inline int f4836_13(int x) { return x * 13; }
+inline int f4836_14(int x) { return x * 14; }
+inline int f4836_15(int x) { return x * 15; }
+inline int f4836_16(int x) { return x * 16; }
+inline int f4836_17(int x) { return x * 17; }
+inline int f4836_18(int x) { return x * 18; }
+inline int f4836_19(int x) { return x * 19; }
+inline int f4836_20(int x) { return x * 20; }
+inline int f4836_21(int x) { return x * 21; }
+inline int f4836_22(int x) { return x * 22; }
+inline int f4836_23(int x) { return x * 23; }
+inline int f4836_24(int x) { return x * 24; }
+inline int f4836_25(int x) { return x * 25; }
+inline int f4836_26(int x) { return x * 26; }
+inline int f4836_27(int x) { return x * 27; }
+inline int f4836_28(int x) { return x * 28; }
+inline int f4836_29(int x) { return x * 29; }
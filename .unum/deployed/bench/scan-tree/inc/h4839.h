@@ -0,0 +1,42 @@
+#pragma once
+/* header 4839 */
+#include <vector>
+#include "h6513.h"
+#include "h2099.h"
+#include "h2993.h"
+#include "h5235.h"
+#include "h4318.h"
+#ifdef X
+#include "h1857.h"
+#endif
+struct S4839 { int a; const char *s = "x//y"; };
+inline int f4839_0(int x) { return x * 0; }
+inline int f4839_1(int x) { return x * 1; }
+inline int f4839_2(int x) { return x * 2; }
+inline int f4839_3(int x) { return x * 3; }
+inline int f4839_4(int x) { return x * 4; }
+inline int f4839_5(int x) { return x * 5; }
+inline int f4839_6(int x) { return x * 6; }
+inline int f4839_7(int x) { return x * 7; }
+inline int f4839_8(int x) { return x * 8; }
+inline int f4839_9(int x) { return x * 9; }
+inline int f4839_10(int x) { return x * 10; }
+inline int f4839_11(int x) { return x * 11; }
+inline int f4839_12(int x) { return x * 12; }
+inline int f4839_13(int x) { return x * 13; }
+inline int f4839_14(int x) { return x * 14; }
+inline int f4839_15(int x) { return x * 15; }
+inline int f4839_16(int x) { return x * 16; }
+inline int f4839_17(int x) { return x * 17; }
+inline int f4839_18(int x) { return x * 18; }
+inline int f4839_19(int x) { return x * 19; }
+inline int f4839_20(int x) { return x * 20; }
+inline int f4839_21(int x) { return x * 21; }
+inline int f4839_22(int x) { return x * 22; }
+inline int f4839_23(int x) { return x * 23; }
+inline int f4839_24(int x) { return x * 24; }
+inline int f4839_25(int x) { return x * 25; }
+inline int f4839_26(int x) { return x * 26; }
+inline int f4839_27(int x) { return x * 27; }
+inline int f4839_28(int x) { return x * 28; }
+inline int f4839_29(int x) { return x * 29; }
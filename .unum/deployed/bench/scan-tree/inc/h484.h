@@ -0,0 +1,42 @@
+#pragma once
+/* header 484 */
+#include <vector>
+#include "h2815.h"
+#include "h5797.h"
+#include "h2346.h"
+#include "h4361.h"
+#include "h6350.h"
+#ifdef X
+#include "h4508.h"
+#endif
+struct S484 { int a; const char *s = "x//y"; };
+inline int f484_0(int x) { return x * 0; }
+inline int f484_1(int x) { return x * 1; }
+inline int f484_2(int x) { return x * 2; }
+inline int f484_3(int x) { return x * 3; }
+inline int f484_4(int x) { return x * 4; }
+inline int f484_5(int x) { return x * 5; }
+inline int f484_6(int x) { return x * 6; }
+inline int f484_7(int x) { return x * 7; }
+inline int f484_8(int x) { return x * 8; }
+inline int f484_9(int x) { return x * 9; }
+inline int f484_10(int x) { return x * 10; }
+inline int f484_11(int x) { return x * 11; }
+inline int f484_12(int x) { return x * 12; }
+inline int f484_13(int x) { return x * 13; }
+inline int f484_14(int x) { return x * 14; }
+inline int f484_15(int x) { return x * 15; }
+inline int f484_16(int x) { return x * 16; }
+inline int f484_17(int x) { return x * 17; }
+inline int f484_18(int x) { return x * 18; }
+inline int f484_19(int x) { return x * 19; }
+inline int f484_20(int x) { return x * 20; }
+inline int f484_21(int x) { return x * 21; }
+inline int f484_22(int x) { return x * 22; }
+inline int f484_23(int x) { return x * 23; }
+inline int f484_24(int x) { return x * 24; }
+inline int f484_25(int x) { return x * 25; }
+inline int f484_26(int x) { return x * 26; }
+inline int f484_27(int x) { return x * 27; }
+inline int f484_28(int x) { return x * 28; }
+inline int f484_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4840 */
+#include <vector>
+#include "h5883.h"
+#include "h7886.h"
+#include "h7850.h"
+#include "h1850.h"
+#include "h1014.h"
+#ifdef X
+#include "h1529.h"
+#endif
+struct S4840 { int a; const char *s = "x//y"; };
+inline int f4840_0(int x) { return x * 0; }
+inline int f4840_1(int x) { return x * 1; }
+inline int f4840_2(int x) { return x * 2; }
+inline int f4840_3(int x) { return x * 3; }
+inline int f4840_4(int x) { return x * 4; }
+inline int f4840_5(int x) { return x * 5; }
+inline int f4840_6(int x) { return x * 6; }
+inline int f4840_7(int x) { return x * 7; }
+inline int f4840_8(int x) { return x * 8; }
+inline int f4840_9(int x) { return x * 9; }
+inline int f4840_10(int x) { return x * 10; }
+inline int f4840_11(int x) { return x * 11; }
+inline int f4840_12(int x) { return x * 12; }
+inline int f4840_13(int x) { return x * 13; }
+inline int f4840_14(int x) { return x * 14; }
+inline int f4840_15(int x) { return x * 15; }
+inline int f4840_16(int x) { return x * 16; }
+inline int f4840_17(int x) { return x * 17; }
+inline int f4840_18(int x) { return x * 18; }
+inline int f4840_19(int x) { return x * 19; }
+inline int f4840_20(int x) { return x * 20; }
+inline int f4840_21(int x) { return x * 21; }
+inline int f4840_22(int x) { return x * 22; }
+inline int f4840_23(int x) { return x * 23; }
+inline int f4840_24(int x) { return x * 24; }
+inline int f4840_25(int x) { return x * 25; }
+inline int f4840_26(int x) { return x * 26; }
+inline int f4840_27(int x) { return x * 27; }
+inline int f4840_28(int x) { return x * 28; }
+inline int f4840_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4841 */
+#include <vector>
+#include "h8872.h"
+#include "h697.h"
+#include "h4186.h"
+#include "h3887.h"
+#include "h2142.h"
+#ifdef X
+#include "h6494.h"
+#endif
+struct S4841 { int a; const char *s = "x//y"; };
+inline int f4841_0(int x) { return x * 0; }
+inline int f4841_1(int x) { return x * 1; }
+inline int f4841_2(int x) { return x * 2; }
+inline int f4841_3(int x) { return x * 3; }
+inline int f4841_4(int x) { return x * 4; }
+inline int f4841_5(int x) { return x * 5; }
+inline int f4841_6(int x) { return x * 6; }
+inline int f4841_7(int x) { return x * 7; }
+inline int f4841_8(int x) { return x * 8; }
+inline int f4841_9(int x) { return x * 9; }
+inline int f4841_10(int x) { return x * 10; }
+inline int f4841_11(int x) { return x * 11; }
+inline int f4841_12(int x) { return x * 12; }
+inline int f4841_13(int x) { return x * 13; }
+inline int f4841_14(int x) { return x * 14; }
+inline int f4841_15(int x) { return x * 15; }
+inline int f4841_16(int x) { return x * 16; }
+inline int f4841_17(int x) { return x * 17; }
+inline int f4841_18(int x) { return x * 18; }
+inline int f4841_19(int x) { return x * 19; }
+inline int f4841_20(int x) { return x * 20; }
+inline int f4841_21(int x) { return x * 21; }
+inline int f4841_22(int x) { return x * 22; }
+inline int f4841_23(int x) { return x * 23; }
+inline int f4841_24(int x) { return x * 24; }
+inline int f4841_25(int x) { return x * 25; }
+inline int f4841_26(int x) { return x * 26; }
+inline int f4841_27(int x) { return x * 27; }
+inline int f4841_28(int x) { return x * 28; }
+inline int f4841_29(int x) { return x * 29; }
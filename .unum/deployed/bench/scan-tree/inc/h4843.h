@@ -0,0 +1,42 @@
+#pragma once
+/* header 4843 */
+#include <vector>
+#include "h2198.h"
+#include "h3977.h"
+#include "h8782.h"
+#include "h2035.h"
+#include "h3436.h"
+#ifdef X
+#include "h7528.h"
+#endif
+struct S4843 { int a; const char *s = "x//y"; };
+inline int f4843_0(int x) { return x * 0; }
+inline int f4843_1(int x) { return x * 1; }
+inline int f4843_2(int x) { return x * 2; }
+inline int f4843_3(int x) { return x * 3; }
+inline int f4843_4(int x) { return x * 4; }
+inline int f4843_5(int x) { return x * 5; }
+inline int f4843_6(int x) { return x * 6; }
+inline int f4843_7(int x) { return x * 7; }
+inline int f4843_8(int x) { return x * 8; }
+inline int f4843_9(int x) { return x * 9; }
+inline int f4843_10(int x) { return x * 10; }
+inline int f4843_11(int x) { return x * 11; }
+inline int f4843_12(int x) { return x * 12; }
+inline int f4843_13(int x) { return x * 13; }
+inline int f4843_14(int x) { return x * 14; }
+inline int f4843_15(int x) { return x * 15; }
+inline int f4843_16(int x) { return x * 16; }
+inline int f4843_17(int x) { return x * 17; }
+inline int f4843_18(int x) { return x * 18; }
+inline int f4843_19(int x) { return x * 19; }
+inline int f4843_20(int x) { return x * 20; }
+inline int f4843_21(int x) { return x * 21; }
+inline int f4843_22(int x) { return x * 22; }
+inline int f4843_23(int x) { return x * 23; }
+inline int f4843_24(int x) { return x * 24; }
+inline int f4843_25(int x) { return x * 25; }
+inline int f4843_26(int x) { return x * 26; }
+inline int f4843_27(int x) { return x * 27; }
+inline int f4843_28(int x) { return x * 28; }
+inline int f4843_29(int x) { return x * 29; }
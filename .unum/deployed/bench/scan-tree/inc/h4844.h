@@ -0,0 +1,42 @@
+#pragma once
+/* header 4844 */
+#include <vector>
+#include "h477.h"
+#include "h74.h"
+#include "h2879.h"
+#include "h6725.h"
+#include "h903.h"
+#ifdef X
+#include "h274.h"
+#endif
+struct S4844 { int a; const char *s = "x//y"; };
+inline int f4844_0(int x) { return x * 0; }
+inline int f4844_1(int x) { return x * 1; }
+inline int f4844_2(int x) { return x * 2; }
+inline int f4844_3(int x) { return x * 3; }
+inline int f4844_4(int x) { return x * 4; }
+inline int f4844_5(int x) { return x * 5; }
+inline int f4844_6(int x) { return x * 6; }
+inline int f4844_7(int x) { return x * 7; }
+inline int f4844_8(int x) { return x * 8; }
+inline int f4844_9(int x) { return x * 9; }
+inline int f4844_10(int x) { return x * 10; }
+inline int f4844_11(int x) { return x * 11; }
+inline int f4844_12(int x) { return x * 12; }
+inline int f4844_13(int x) { return x * 13; }
+inline int f4844_14(int x) { return x * 14; }
+inline int f4844_15(int x) { return x * 15; }
+inline int f4844_16(int x) { return x * 16; }
+inline int f4844_17(int x) { return x * 17; }
+inline int f4844_18(int x) { return x * 18; }
+inline int f4844_19(int x) { return x * 19; }
+inline int f4844_20(int x) { return x * 20; }
+inline int f4844_21(int x) { return x * 21; }
+inline int f4844_22(int x) { return x * 22; }
+inline int f4844_23(int x) { return x * 23; }
+inline int f4844_24(int x) { return x * 24; }
+inline int f4844_25(int x) { return x * 25; }
+inline int f4844_26(int x) { return x * 26; }
+inline int f4844_27(int x) { return x * 27; }
+inline int f4844_28(int x) { return x * 28; }
+inline int f4844_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4846 */
+#include <vector>
+#include "h3357.h"
+#include "h7501.h"
+#include "h6068.h"
+#include "h2404.h"
+#include "h2978.h"
+#ifdef X
+#include "h5646.h"
+#endif
+struct S4846 { int a; const char *s = "x//y"; };
+inline int f4846_0(int x) { return x * 0; }
+inline int f4846_1(int x) { return x * 1; }
+inline int f4846_2(int x) { return x * 2; }
+inline int f4846_3(int x) { return x * 3; }
+inline int f4846_4(int x) { return x * 4; }
+inline int f4846_5(int x) { return x * 5; }
+inline int f4846_6(int x) { return x * 6; }
+inline int f4846_7(int x) { return x * 7; }
+inline int f4846_8(int x) { return x * 8; }
+inline int f4846_9(int x) { return x * 9; }
+inline int f4846_10(int x) { return x * 10; }
+inline int f4846_11(int x) { return x * 11; }
+inline int f4846_12(int x) { return x * 12; }
+inline int f4846_13(int x) { return x * 13; }
+inline int f4846_14(int x) { return x * 14; }
+inline int f4846_15(int x) { return x * 15; }
+inline int f4846_16(int x) { return x * 16; }
+inline int f4846_17(int x) { return x * 17; }
+inline int f4846_18(int x) { return x * 18; }
+inline int f4846_19(int x) { return x * 19; }
+inline int f4846_20(int x) { return x * 20; }
+inline int f4846_21(int x) { return x * 21; }
+inline int f4846_22(int x) { return x * 22; }
+inline int f4846_23(int x) { return x * 23; }
+inline int f4846_24(int x) { return x * 24; }
+inline int f4846_25(int x) { return x * 25; }
+inline int f4846_26(int x) { return x * 26; }
+inline int f4846_27(int x) { return x * 27; }
+inline int f4846_28(int x) { return x * 28; }
+inline int f4846_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4847 */
+#include <vector>
+#include "h1112.h"
+#include "h4075.h"
+#include "h2854.h"
+#include "h6810.h"
+#include "h6360.h"
+#ifdef X
+#include "h3828.h"
+#endif
+struct S4847 { int a; const char *s = "x//y"; };
+inline int f4847_0(int x) { return x * 0; }
+inline int f4847_1(int x) { return x * 1; }
+inline int f4847_2(int x) { return x * 2; }
+inline int f4847_3(int x) { return x * 3; }
+inline int f4847_4(int x) { return x * 4; }
+inline int f4847_5(int x) { return x * 5; }
+inline int f4847_6(int x) { return x * 6; }
+inline int f4847_7(int x) { return x * 7; }
+inline int f4847_8(int x) { return x * 8; }
+inline int f4847_9(int x) { return x * 9; }
+inline int f4847_10(int x) { return x * 10; }
+inline int f4847_11(int x) { return x * 11; }
+inline int f4847_12(int x) { return x * 12; }
+inline int f4847_13(int x) { return x * 13; }
+inline int f4847_14(int x) { return x * 14; }
+inline int f4847_15(int x) { return x * 15; }
+inline int f4847_16(int x) { return x * 16; }
+inline int f4847_17(int x) { return x * 17; }
+inline int f4847_18(int x) { return x * 18; }
+inline int f4847_19(int x) { return x * 19; }
+inline int f4847_20(int x) { return x * 20; }
+inline int f4847_21(int x) { return x * 21; }
+inline int f4847_22(int x) { return x * 22; }
+inline int f4847_23(int x) { return x * 23; }
+inline int f4847_24(int x) { return x * 24; }
+inline int f4847_25(int x) { return x * 25; }
+inline int f4847_26(int x) { return x * 26; }
+inline int f4847_27(int x) { return x * 27; }
+inline int f4847_28(int x) { return x * 28; }
+inline int f4847_29(int x) { return x * 29; }
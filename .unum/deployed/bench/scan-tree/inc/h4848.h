@@ -0,0 +1,42 @@
+#pragma once
+/* header 4848 */
+#include <vector>
+#include "h3028.h"
+#include "h127.h"
+#include "h653.h"
+#include "h7490.h"
+#include "h8834.h"
+#ifdef X
+#include "h5930.h"
+#endif
+struct S4848 { int a; const char *s = "x//y"; };
+inline int f4848_0(int x) { return x * 0; }
+inline int f4848_1(int x) { return x * 1; }
+inline int f4848_2(int x) { return x * 2; }
+inline int f4848_3(int x) { return x * 3; }
+inline int f4848_4(int x) { return x * 4; }
+inline int f4848_5(int x) { return x * 5; }
+inline int f4848_6(int x) { return x * 6; }
+inline int f4848_7(int x) { return x * 7; }
+inline int f4848_8(int x) { return x * 8; }
+inline int f4848_9(int x) { return x * 9; }
+inline int f4848_10(int x) { return x * 10; }
+inline int f4848_11(int x) { return x * 11; }
+inline int f4848_12(int x) { return x * 12; }
+inline int f4848_13(int x) { return x * 13; }
+inline int f4848_14(int x) { return x * 14; }
+inline int f4848_15(int x) { return x * 15; }
+inline int f4848_16(int x) { return x * 16; }
+inline int f4848_17(int x) { return x * 17; }
+inline int f4848_18(int x) { return x * 18; }
+inline int f4848_19(int x) { return x * 19; }
+inline int f4848_20(int x) { return x * 20; }
+inline int f4848_21(int x) { return x * 21; }
+inline int f4848_22(int x) { return x * 22; }
+inline int f4848_23(int x) { return x * 23; }
+inline int f4848_24(int x) { return x * 24; }
+inline int f4848_25(int x) { return x * 25; }
+inline int f4848_26(int x) { return x * 26; }
+inline int f4848_27(int x) { return x * 27; }
+inline int f4848_28(int x) { return x * 28; }
+inline int f4848_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 485 */
+#include <vector>
+#include "h1526.h"
+#include "h1533.h"
+#include "h9820.h"
+#include "h8481.h"
+#include "h1140.h"
+#ifdef X
+#include "h2157.h"
+#endif
+struct S485 { int a; const char *s = "x//y"; };
+inline int f485_0(int x) { return x * 0; }
+inline int f485_1(int x) { return x * 1; }
+inline int f485_2(int x) { return x * 2; }
+inline int f485_3(int x) { return x * 3; }
+inline int f485_4(int x) { return x * 4; }
+inline int f485_5(int x) { return x * 5; }
+inline int f485_6(int x) { return x * 6; }
+inline int f485_7(int x) { return x * 7; }
+inline int f485_8(int x) { return x * 8; }
+inline int f485_9(int x) { return x * 9; }
+inline int f485_10(int x) { return x * 10; }
+inline int f485_11(int x) { return x * 11; }
+inline int f485_12(int x) { return x * 12; }
+inline int f485_13(int x) { return x * 13; }
+inline int f485_14(int x) { return x * 14; }
+inline int f485_15(int x) { return x * 15; }
+inline int f485_16(int x) { return x * 16; }
+inline int f485_17(int x) { return x * 17; }
+inline int f485_18(int x) { return x * 18; }
+inline int f485_19(int x) { return x * 19; }
+inline int f485_20(int x) { return x * 20; }
+inline int f485_21(int x) { return x * 21; }
+inline int f485_22(int x) { return x * 22; }
+inline int f485_23(int x) { return x * 23; }
+inline int f485_24(int x) { return x * 24; }
+inline int f485_25(int x) { return x * 25; }
+inline int f485_26(int x) { return x * 26; }
+inline int f485_27(int x) { return x * 27; }
+inline int f485_28(int x) { return x * 28; }
+inline int f485_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4850 */
+#include <vector>
+#include "h2773.h"
+#include "h1486.h"
+#include "h7764.h"
+#include "h482.h"
+#include "h7793.h"
+#ifdef X
+#include "h4058.h"
+#endif
+struct S4850 { int a; const char *s = "x//y"; };
+inline int f4850_0(int x) { return x * 0; }
+inline int f4850_1(int x) { return x * 1; }
+inline int f4850_2(int x) { return x * 2; }
+inline int f4850_3(int x) { return x * 3; }
+inline int f4850_4(int x) { return x * 4; }
+inline int f4850_5(int x) { return x * 5; }
+inline int f4850_6(int x) { return x * 6; }
+inline int f4850_7(int x) { return x * 7; }
+inline int f4850_8(int x) { return x * 8; }
+inline int f4850_9(int x) { return x * 9; }
+inline int f4850_10(int x) { return x * 10; }
+inline int f4850_11(int x) { return x * 11; }
+inline int f4850_12(int x) { return x * 12; }
+inline int f4850_13(int x) { return x * 13; }
+inline int f4850_14(int x) { return x * 14; }
+inline int f4850_15(int x) { return x * 15; }
+inline int f4850_16(int x) { return x * 16; }
+inline int f4850_17(int x) { return x * 17; }
+inline int f4850_18(int x) { return x * 18; }
+inline int f4850_19(int x) { return x * 19; }
+inline int f4850_20(int x) { return x * 20; }
+inline int f4850_21(int x) { return x * 21; }
+inline int f4850_22(int x) { return x * 22; }
+inline int f4850_23(int x) { return x * 23; }
+inline int f4850_24(int x) { return x * 24; }
+inline int f4850_25(int x) { return x * 25; }
+inline int f4850_26(int x) { return x * 26; }
+inline int f4850_27(int x) { return x * 27; }
+inline int f4850_28(int x) { return x * 28; }
+inline int f4850_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4851 */
+#include <vector>
+#include "h8664.h"
+#include "h6348.h"
+#include "h5224.h"
+#include "h7652.h"
+#include "h2189.h"
+#ifdef X
+#include "h1619.h"
+#endif
+struct S4851 { int a; const char *s = "x//y"; };
+inline int f4851_0(int x) { return x * 0; }
+inline int f4851_1(int x) { return x * 1; }
+inline int f4851_2(int x) { return x * 2; }
+inline int f4851_3(int x) { return x * 3; }
+inline int f4851_4(int x) { return x * 4; }
+inline int f4851_5(int x) { return x * 5; }
+inline int f4851_6(int x) { return x * 6; }
+inline int f4851_7(int x) { return x * 7; }
+inline int f4851_8(int x) { return x * 8; }
+inline int f4851_9(int x) { return x * 9; }
+inline int f4851_10(int x) { return x * 10; }
+inline int f4851_11(int x) { return x * 11; }
+inline int f4851_12(int x) { return x * 12; }
+inline int f4851_13(int x) { return x * 13; }
+inline int f4851_14(int x) { return x * 14; }
+inline int f4851_15(int x) { return x * 15; }
+inline int f4851_16(int x) { return x * 16; }
+inline int f4851_17(int x) { return x * 17; }
+inline int f4851_18(int x) { return x * 18; }
+inline int f4851_19(int x) { return x * 19; }
+inline int f4851_20(int x) { return x * 20; }
+inline int f4851_21(int x) { return x * 21; }
+inline int f4851_22(int x) { return x * 22; }
+inline int f4851_23(int x) { return x * 23; }
+inline int f4851_24(int x) { return x * 24; }
+inline int f4851_25(int x) { return x * 25; }
+inline int f4851_26(int x) { return x * 26; }
+inline int f4851_27(int x) { return x * 27; }
+inline int f4851_28(int x) { return x * 28; }
+inline int f4851_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4854 */
+#include <vector>
+#include "h3599.h"
+#include "h6708.h"
+#include "h132.h"
+#include "h4134.h"
+#include "h925.h"
+#ifdef X
+#include "h345.h"
+#endif
+struct S4854 { int a; const char *s = "x//y"; };
+inline int f4854_0(int x) { return x * 0; }
+inline int f4854_1(int x) { return x * 1; }
+inline int f4854_2(int x) { return x * 2; }
+inline int f4854_3(int x) { return x * 3; }
+inline int f4854_4(int x) { return x * 4; }
+inline int f4854_5(int x) { return x * 5; }
+inline int f4854_6(int x) { return x * 6; }
+inline int f4854_7(int x) { return x * 7; }
+inline int f4854_8(int x) { return x * 8; }
+inline int f4854_9(int x) { return x * 9; }
+inline int f4854_10(int x) { return x * 10; }
+inline int f4854_11(int x) { return x * 11; }
+inline int f4854_12(int x) { return x * 12; }
+inline int f4854_13(int x) { return x * 13; }
+inline int f4854_14(int x) { return x * 14; }
+inline int f4854_15(int x) { return x * 15; }
+inline int f4854_16(int x) { return x * 16; }
+inline int f4854_17(int x) { return x * 17; }
+inline int f4854_18(int x) { return x * 18; }
+inline int f4854_19(int x) { return x * 19; }
+inline int f4854_20(int x) { return x * 20; }
+inline int f4854_21(int x) { return x * 21; }
+inline int f4854_22(int x) { return x * 22; }
+inline int f4854_23(int x) { return x * 23; }
+inline int f4854_24(int x) { return x * 24; }
+inline int f4854_25(int x) { return x * 25; }
+inline int f4854_26(int x) { return x * 26; }
+inline int f4854_27(int x) { return x * 27; }
+inline int f4854_28(int x) { return x * 28; }
+inline int f4854_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4857 */
+#include <vector>
+#include "h554.h"
+#include "h978.h"
+#include "h7797.h"
+#include "h3618.h"
+#include "h9639.h"
+#ifdef X
+#include "h3880.h"
+#endif
+struct S4857 { int a; const char *s = "x//y"; };
+inline int f4857_0(int x) { return x * 0; }
+inline int f4857_1(int x) { return x * 1; }
+inline int f4857_2(int x) { return x * 2; }
+inline int f4857_3(int x) { return x * 3; }
+inline int f4857_4(int x) { return x * 4; }
+inline int f4857_5(int x) { return x * 5; }
+inline int f4857_6(int x) { return x * 6; }
+inline int f4857_7(int x) { return x * 7; }
+inline int f4857_8(int x) { return x * 8; }
+inline int f4857_9(int x) { return x * 9; }
+inline int f4857_10(int x) { return x * 10; }
+inline int f4857_11(int x) { return x * 11; }
+inline int f4857_12(int x) { return x * 12; }
+inline int f4857_13(int x) { return x * 13; }
+inline int f4857_14(int x) { return x * 14; }
+inline int f4857_15(int x) { return x * 15; }
+inline int f4857_16(int x) { return x * 16; }
+inline int f4857_17(int x) { return x * 17; }
+inline int f4857_18(int x) { return x * 18; }
+inline int f4857_19(int x) { return x * 19; }
+inline int f4857_20(int x) { return x * 20; }
+inline int f4857_21(int x) { return x * 21; }
+inline int f4857_22(int x) { return x * 22; }
+inline int f4857_23(int x) { return x * 23; }
+inline int f4857_24(int x) { return x * 24; }
+inline int f4857_25(int x) { return x * 25; }
+inline int f4857_26(int x) { return x * 26; }
+inline int f4857_27(int x) { return x * 27; }
+inline int f4857_28(int x) { return x * 28; }
+inline int f4857_29(int x) { return x * 29; }
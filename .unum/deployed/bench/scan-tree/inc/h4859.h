@@ -0,0 +1,42 @@
+#pragma once
+/* header 4859 */
+#include <vector>
+#include "h1069.h"
+#include "h5958.h"
+#include "h6273.h"
+#include "h755.h"
+#include "h7140.h"
+#ifdef X
+#include "h6857.h"
+#endif
+struct S4859 { int a; const char *s = "x//y"; };
+inline int f4859_0(int x) { return x * 0; }
+inline int f4859_1(int x) { return x * 1; }
+inline int f4859_2(int x) { return x * 2; }
+inline int f4859_3(int x) { return x * 3; }
+inline int f4859_4(int x) { return x * 4; }
+inline int f4859_5(int x) { return x * 5; }
+inline int f4859_6(int x) { return x * 6; }
+inline int f4859_7(int x) { return x * 7; }
+inline int f4859_8(int x) { return x * 8; }
+inline int f4859_9(int x) { return x * 9; }
+inline int f4859_10(int x) { return x * 10; }
+inline int f4859_11(int x) { return x * 11; }
+inline int f4859_12(int x) { return x * 12; }
+inline int f4859_13(int x) { return x * 13; }
+inline int f4859_14(int x) { return x * 14; }
+inline int f4859_15(int x) { return x * 15; }
+inline int f4859_16(int x) { return x * 16; }
+inline int f4859_17(int x) { return x * 17; }
+inline int f4859_18(int x) { return x * 18; }
+inline int f4859_19(int x) { return x * 19; }
+inline int f4859_20(int x) { return x * 20; }
+inline int f4859_21(int x) { return x * 21; }
+inline int f4859_22(int x) { return x * 22; }
+inline int f4859_23(int x) { return x * 23; }
+inline int f4859_24(int x) { return x * 24; }
+inline int f4859_25(int x) { return x * 25; }
+inline int f4859_26(int x) { return x * 26; }
+inline int f4859_27(int x) { return x * 27; }
+inline int f4859_28(int x) { return x * 28; }
+inline int f4859_29(int x) { return x * 29; }
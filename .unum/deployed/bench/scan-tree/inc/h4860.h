@@ -0,0 +1,42 @@
+#pragma once
+/* header 4860 */
+#include <vector>
+#include "h6145.h"
+#include "h2477.h"
+#include "h3101.h"
+#include "h229.h"
+#include "h1641.h"
+#ifdef X
+#include "h6387.h"
+#endif
+struct S4860 { int a; const char *s = "x//y"; };
+inline int f4860_0(int x) { return x * 0; }
+inline int f4860_1(int x) { return x * 1; }
+inline int f4860_2(int x) { return x * 2; }
+inline int f4860_3(int x) { return x * 3; }
+inline int f4860_4(int x) { return x * 4; }
+inline int f4860_5(int x) { return x * 5; }
+inline int f4860_6(int x) { return x * 6; }
+inline int f4860_7(int x) { return x * 7; }
+inline int f4860_8(int x) { return x * 8; }
+inline int f4860_9(int x) { return x * 9; }
+inline int f4860_10(int x) { return x * 10; }
+inline int f4860_11(int x) { return x * 11; }
+inline int f4860_12(int x) { return x * 12; }
+inline int f4860_13(int x) { return x * 13; }
+inline int f4860_14(int x) { return x * 14; }
+inline int f4860_15(int x) { return x * 15; }
+inline int f4860_16(int x) { return x * 16; }
+inline int f4860_17(int x) { return x * 17; }
+inline int f4860_18(int x) { return x * 18; }
+inline int f4860_19(int x) { return x * 19; }
+inline int f4860_20(int x) { return x * 20; }
+inline int f4860_21(int x) { return x * 21; }
+inline int f4860_22(int x) { return x * 22; }
+inline int f4860_23(int x) { return x * 23; }
+inline int f4860_24(int x) { return x * 24; }
+inline int f4860_25(int x) { return x * 25; }
+inline int f4860_26(int x) { return x * 26; }
+inline int f4860_27(int x) { return x * 27; }
+inline int f4860_28(int x) { return x * 28; }
+inline int f4860_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4866 */
+#include <vector>
+#include "h2413.h"
+#include "h3983.h"
+#include "h3329.h"
+#include "h1427.h"
+#include "h2036.h"
+#ifdef X
+#include "h3310.h"
+#endif
+struct S4866 { int a; const char *s = "x//y"; };
+inline int f4866_0(int x) { return x * 0; }
+inline int f4866_1(int x) { return x * 1; }
+inline int f4866_2(int x) { return x * 2; }
+inline int f4866_3(int x) { return x * 3; }
+inline int f4866_4(int x) { return x * 4; }
+inline int f4866_5(int x) { return x * 5; }
+inline int f4866_6(int x) { return x * 6; }
+inline int f4866_7(int x) { return x * 7; }
+inline int f4866_8(int x) { return x * 8; }
+inline int f4866_9(int x) { return x * 9; }
+inline int f4866_10(int x) { return x * 10; }
+inline int f4866_11(int x) { return x * 11; }
+inline int f4866_12(int x) { return x * 12; }
+inline int f4866_13(int x) { return x * 13; }
+inline int f4866_14(int x) { return x * 14; }
+inline int f4866_15(int x) { return x * 15; }
+inline int f4866_16(int x) { return x * 16; }
+inline int f4866_17(int x) { return x * 17; }
+inline int f4866_18(int x) { return x * 18; }
+inline int f4866_19(int x) { return x * 19; }
+inline int f4866_20(int x) { return x * 20; }
+inline int f4866_21(int x) { return x * 21; }
+inline int f4866_22(int x) { return x * 22; }
+inline int f4866_23(int x) { return x * 23; }
+inline int f4866_24(int x) { return x * 24; }
+inline int f4866_25(int x) { return x * 25; }
+inline int f4866_26(int x) { return x * 26; }
+inline int f4866_27(int x) { return x * 27; }
+inline int f4866_28(int x) { return x * 28; }
+inline int f4866_29(int x) { return x * 29; }
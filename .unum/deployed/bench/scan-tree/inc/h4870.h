@@ -0,0 +1,42 @@
+#pragma once
+/* header 4870 */
+#include <vector>
+#include "h8508.h"
+#include "h2765.h"
+#include "h1599.h"
+#include "h5656.h"
+#include "h8026.h"
+#ifdef X
+#include "h7471.h"
+#endif
+struct S4870 { int a; const char *s = "x//y"; };
+inline int f4870_0(int x) { return x * 0; }
+inline int f4870_1(int x) { return x * 1; }
+inline int f4870_2(int x) { return x * 2; }
+inline int f4870_3(int x) { return x * 3; }
+inline int f4870_4(int x) { return x * 4; }
+inline int f4870_5(int x) { return x * 5; }
+inline int f4870_6(int x) { return x * 6; }
+inline int f4870_7(int x) { return x * 7; }
+inline int f4870_8(int x) { return x * 8; }
+inline int f4870_9(int x) { return x * 9; }
+inline int f4870_10(int x) { return x * 10; }
+inline int f4870_11(int x) { return x * 11; }
+inline int f4870_12(int x) { return x * 12; }
+inline int f4870_13(int x) { return x * 13; }
+inline int f4870_14(int x) { return x * 14; }
+inline int f4870_15(int x) { return x * 15; }
+inline int f4870_16(int x) { return x * 16; }
+inline int f4870_17(int x) { return x * 17; }
+inline int f4870_18(int x) { return x * 18; }
+inline int f4870_19(int x) { return x * 19; }
+inline int f4870_20(int x) { return x * 20; }
+inline int f4870_21(int x) { return x * 21; }
+inline int f4870_22(int x) { return x * 22; }
+inline int f4870_23(int x) { return x * 23; }
+inline int f4870_24(int x) { return x * 24; }
+inline int f4870_25(int x) { return x * 25; }
+inline int f4870_26(int x) { return x * 26; }
+inline int f4870_27(int x) { return x * 27; }
+inline int f4870_28(int x) { return x * 28; }
+inline int f4870_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4871 */
+#include <vector>
+#include "h318.h"
+#include "h2177.h"
+#include "h4612.h"
+#include "h1151.h"
+#include "h7019.h"
+#ifdef X
+#include "h7369.h"
+#endif
+struct S4871 { int a; const char *s = "x//y"; };
+inline int f4871_0(int x) { return x * 0; }
+inline int f4871_1(int x) { return x * 1; }
+inline int f4871_2(int x) { return x * 2; }
+inline int f4871_3(int x) { return x * 3; }
+inline int f4871_4(int x) { return x * 4; }
+inline int f4871_5(int x) { return x * 5; }
+inline int f4871_6(int x) { return x * 6; }
+inline int f4871_7(int x) { return x * 7; }
+inline int f4871_8(int x) { return x * 8; }
+inline int f4871_9(int x) { return x * 9; }
+inline int f4871_10(int x) { return x * 10; }
+inline int f4871_11(int x) { return x * 11; }
+inline int f4871_12(int x) { return x * 12; }
+inline int f4871_13(int x) { return x * 13; }
+inline int f4871_14(int x) { return x * 14; }
+inline int f4871_15(int x) { return x * 15; }
+inline int f4871_16(int x) { return x * 16; }
+inline int f4871_17(int x) { return x * 17; }
+inline int f4871_18(int x) { return x * 18; }
+inline int f4871_19(int x) { return x * 19; }
+inline int f4871_20(int x) { return x * 20; }
+inline int f4871_21(int x) { return x * 21; }
+inline int f4871_22(int x) { return x * 22; }
+inline int f4871_23(int x) { return x * 23; }
+inline int f4871_24(int x) { return x * 24; }
+inline int f4871_25(int x) { return x * 25; }
+inline int f4871_26(int x) { return x * 26; }
+inline int f4871_27(int x) { return x * 27; }
+inline int f4871_28(int x) { return x * 28; }
+inline int f4871_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4875 */
+#include <vector>
+#include "h1555.h"
+#include "h6747.h"
+#include "h566.h"
+#include "h6449.h"
+#include "h7898.h"
+#ifdef X
+#include "h1660.h"
+#endif
+struct S4875 { int a; const char *s = "x//y"; };
+inline int f4875_0(int x) { return x * 0; }
+inline int f4875_1(int x) { return x * 1; }
+inline int f4875_2(int x) { return x * 2; }
+inline int f4875_3(int x) { return x * 3; }
+inline int f4875_4(int x) { return x * 4; }
+inline int f4875_5(int x) { return x * 5; }
+inline int f4875_6(int x) { return x * 6; }
+inline int f4875_7(int x) { return x * 7; }
+inline int f4875_8(int x) { return x * 8; }
+inline int f4875_9(int x) { return x * 9; }
+inline int f4875_10(int x) { return x * 10; }
+inline int f4875_11(int x) { return x * 11; }
+inline int f4875_12(int x) { return x * 12; }
+inline int f4875_13(int x) { return x * 13; }
+inline int f4875_14(int x) { return x * 14; }
+inline int f4875_15(int x) { return x * 15; }
+inline int f4875_16(int x) { return x * 16; }
+inline int f4875_17(int x) { return x * 17; }
+inline int f4875_18(int x) { return x * 18; }
+inline int f4875_19(int x) { return x * 19; }
+inline int f4875_20(int x) { return x * 20; }
+inline int f4875_21(int x) { return x * 21; }
+inline int f4875_22(int x) { return x * 22; }
+inline int f4875_23(int x) { return x * 23; }
+inline int f4875_24(int x) { return x * 24; }
+inline int f4875_25(int x) { return x * 25; }
+inline int f4875_26(int x) { return x * 26; }
+inline int f4875_27(int x) { return x * 27; }
+inline int f4875_28(int x) { return x * 28; }
+inline int f4875_29(int x) { return x * 29; }
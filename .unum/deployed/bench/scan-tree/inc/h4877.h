@@ -0,0 +1,42 @@
+#pragma once
+/* header 4877 */
+#include <vector>
+#include "h9506.h"
+#include "h7599.h"
+#include "h5086.h"
+#include "h3719.h"
+#include "h320.h"
+#ifdef X
+#include "h3090.h"
+#endif
+struct S4877 { int a; const char *s = "x//y"; };
+inline int f4877_0(int x) { return x * 0; }
+inline int f4877_1(int x) { return x * 1; }
+inline int f4877_2(int x) { return x * 2; }
+inline int f4877_3(int x) { return x * 3; }
+inline int f4877_4(int x) { return x * 4; }
+inline int f4877_5(int x) { return x * 5; }
+inline int f4877_6(int x) { return x * 6; }
+inline int f4877_7(int x) { return x * 7; }
+inline int f4877_8(int x) { return x * 8; }
+inline int f4877_9(int x) { return x * 9; }
+inline int f4877_10(int x) { return x * 10; }
+inline int f4877_11(int x) { return x * 11; }
+inline int f4877_12(int x) { return x * 12; }
+inline int f4877_13(int x) { return x * 13; }
+inline int f4877_14(int x) { return x * 14; }
+inline int f4877_15(int x) { return x * 15; }
+inline int f4877_16(int x) { return x * 16; }
+inline int f4877_17(int x) { return x * 17; }
+inline int f4877_18(int x) { return x * 18; }
+inline int f4877_19(int x) { return x * 19; }
+inline int f4877_20(int x) { return x * 20; }
+inline int f4877_21(int x) { return x * 21; }
+inline int f4877_22(int x) { return x * 22; }
+inline int f4877_23(int x) { return x * 23; }
+inline int f4877_24(int x) { return x * 24; }
+inline int f4877_25(int x) { return x * 25; }
+inline int f4877_26(int x) { return x * 26; }
+inline int f4877_27(int x) { return x * 27; }
+inline int f4877_28(int x) { return x * 28; }
+inline int f4877_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4878 */
+#include <vector>
+#include "h2412.h"
+#include "h3262.h"
+#include "h5858.h"
+#include "h5993.h"
+#include "h8551.h"
+#ifdef X
+#include "h2773.h"
+#endif
+struct S4878 { int a; const char *s = "x//y"; };
+inline int f4878_0(int x) { return x * 0; }
+inline int f4878_1(int x) { return x * 1; }
+inline int f4878_2(int x) { return x * 2; }
+inline int f4878_3(int x) { return x * 3; }
+inline int f4878_4(int x) { return x * 4; }
+inline int f4878_5(int x) { return x * 5; }
+inline int f4878_6(int x) { return x * 6; }
+inline int f4878_7(int x) { return x * 7; }
+inline int f4878_8(int x) { return x * 8; }
+inline int f4878_9(int x) { return x * 9; }
+inline int f4878_10(int x) { return x * 10; }
+inline int f4878_11(int x) { return x * 11; }
+inline int f4878_12(int x) { return x * 12; }
+inline int f4878_13(int x) { return x * 13; }
+inline int f4878_14(int x) { return x * 14; }
+inline int f4878_15(int x) { return x * 15; }
+inline int f4878_16(int x) { return x * 16; }
+inline int f4878_17(int x) { return x * 17; }
+inline int f4878_18(int x) { return x * 18; }
+inline int f4878_19(int x) { return x * 19; }
+inline int f4878_20(int x) { return x * 20; }
+inline int f4878_21(int x) { return x * 21; }
+inline int f4878_22(int x) { return x * 22; }
+inline int f4878_23(int x) { return x * 23; }
+inline int f4878_24(int x) { return x * 24; }
+inline int f4878_25(int x) { return x * 25; }
+inline int f4878_26(int x) { return x * 26; }
+inline int f4878_27(int x) { return x * 27; }
+inline int f4878_28(int x) { return x * 28; }
+inline int f4878_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4882 */
+#include <vector>
+#include "h4063.h"
+#include "h784.h"
+#include "h8335.h"
+#include "h1255.h"
+#include "h2534.h"
+#ifdef X
+#include "h1553.h"
+#endif
+struct S4882 { int a; const char *s = "x//y"; };
+inline int f4882_0(int x) { return x * 0; }
+inline int f4882_1(int x) { return x * 1; }
+inline int f4882_2(int x) { return x * 2; }
+inline int f4882_3(int x) { return x * 3; }
+inline int f4882_4(int x) { return x * 4; }
+inline int f4882_5(int x) { return x * 5; }
+inline int f4882_6(int x) { return x * 6; }
+inline int f4882_7(int x) { return x * 7; }
+inline int f4882_8(int x) { return x * 8; }
+inline int f4882_9(int x) { return x * 9; }
+inline int f4882_10(int x) { return x * 10; }
+inline int f4882_11(int x) { return x * 11; }
+inline int f4882_12(int x) { return x * 12; }
+inline int f4882_13(int x) { return x * 13; }
+inline int f4882_14(int x) { return x * 14; }
+inline int f4882_15(int x) { return x * 15; }
+inline int f4882_16(int x) { return x * 16; }
+inline int f4882_17(int x) { return x * 17; }
+inline int f4882_18(int x) { return x * 18; }
+inline int f4882_19(int x) { return x * 19; }
+inline int f4882_20(int x) { return x * 20; }
+inline int f4882_21(int x) { return x * 21; }
+inline int f4882_22(int x) { return x * 22; }
+inline int f4882_23(int x) { return x * 23; }
+inline int f4882_24(int x) { return x * 24; }
+inline int f4882_25(int x) { return x * 25; }
+inline int f4882_26(int x) { return x * 26; }
+inline int f4882_27(int x) { return x * 27; }
+inline int f4882_28(int x) { return x * 28; }
+inline int f4882_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4889 */
+#include <vector>
+#include "h9756.h"
+#include "h2544.h"
+#include "h3211.h"
+#include "h3932.h"
+#include "h2903.h"
+#ifdef X
+#include "h4575.h"
+#endif
+struct S4889 { int a; const char *s = "x//y"; };
+inline int f4889_0(int x) { return x * 0; }
+inline int f4889_1(int x) { return x * 1; }
+inline int f4889_2(int x) { return x * 2; }
+inline int f4889_3(int x) { return x * 3; }
+inline int f4889_4(int x) { return x * 4; }
+inline int f4889_5(int x) { return x * 5; }
+inline int f4889_6(int x) { return x * 6; }
+inline int f4889_7(int x) { return x * 7; }
+inline int f4889_8(int x) { return x * 8; }
+inline int f4889_9(int x) { return x * 9; }
+inline int f4889_10(int x) { return x * 10; }
+inline int f4889_11(int x) { return x * 11; }
+inline int f4889_12(int x) { return x * 12; }
+inline int f4889_13(int x) { return x * 13; }
+inline int f4889_14(int x) { return x * 14; }
+inline int f4889_15(int x) { return x * 15; }
+inline int f4889_16(int x) { return x * 16; }
+inline int f4889_17(int x) { return x * 17; }
+inline int f4889_18(int x) { return x * 18; }
+inline int f4889_19(int x) { return x * 19; }
+inline int f4889_20(int x) { return x * 20; }
+inline int f4889_21(int x) { return x * 21; }
+inline int f4889_22(int x) { return x * 22; }
+inline int f4889_23(int x) { return x * 23; }
+inline int f4889_24(int x) { return x * 24; }
+inline int f4889_25(int x) { return x * 25; }
+inline int f4889_26(int x) { return x * 26; }
+inline int f4889_27(int x) { return x * 27; }
+inline int f4889_28(int x) { return x * 28; }
+inline int f4889_29(int x) { return x * 29; }
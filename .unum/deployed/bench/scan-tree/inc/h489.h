@@ -0,0 +1,42 @@
+#pragma once
+/* header 489 */
+#include <vector>
+#include "h4278.h"
+#include "h9215.h"
+#include "h8987.h"
+#include "h7350.h"
+#include "h6885.h"
+#ifdef X
+#include "h2986.h"
+#endif
+struct S489 { int a; const char *s = "x//y"; };
+inline int f489_0(int x) { return x * 0; }
+inline int f489_1(int x) { return x * 1; }
+inline int f489_2(int x) { return x * 2; }
+inline int f489_3(int x) { return x * 3; }
+inline int f489_4(int x) { return x * 4; }
+inline int f489_5(int x) { return x * 5; }
+inline int f489_6(int x) { return x * 6; }
+inline int f489_7(int x) { return x * 7; }
+inline int f489_8(int x) { return x * 8; }
+inline int f489_9(int x) { return x * 9; }
+inline int f489_10(int x) { return x * 10; }
+inline int f489_11(int x) { return x * 11; }
+inline int f489_12(int x) { return x * 12; }
+inline int f489_13(int x) { return x * 13; }
+inline int f489_14(int x) { return x * 14; }
+inline int f489_15(int x) { return x * 15; }
+inline int f489_16(int x) { return x * 16; }
+inline int f489_17(int x) { return x * 17; }
+inline int f489_18(int x) { return x * 18; }
+inline int f489_19(int x) { return x * 19; }
+inline int f489_20(int x) { return x * 20; }
+inline int f489_21(int x) { return x * 21; }
+inline int f489_22(int x) { return x * 22; }
+inline int f489_23(int x) { return x * 23; }
+inline int f489_24(int x) { return x * 24; }
+inline int f489_25(int x) { return x * 25; }
+inline int f489_26(int x) { return x * 26; }
+inline int f489_27(int x) { return x * 27; }
+inline int f489_28(int x) { return x * 28; }
+inline int f489_29(int x) { return x * 29; }
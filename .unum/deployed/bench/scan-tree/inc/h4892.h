@@ -0,0 +1,42 @@
+#pragma once
+/* header 4892 */
+#include <vector>
+#include "h5093.h"
+#include "h4946.h"
+#include "h2075.h"
+#include "h2190.h"
+#include "h8561.h"
+#ifdef X
+#include "h6576.h"
+#endif
+struct S4892 { int a; const char *s = "x//y"; };
+inline int f4892_0(int x) { return x * 0; }
+inline int f4892_1(int x) { return x * 1; }
+inline int f4892_2(int x) { return x * 2; }
+inline int f4892_3(int x) { return x * 3; }
+inline int f4892_4(int x) { return x * 4; }
+inline int f4892_5(int x) { return x * 5; }
+inline int f4892_6(int x) { return x * 6; }
+inline int f4892_7(int x) { return x * 7; }
+inline int f4892_8(int x) { return x * 8; }
+inline int f4892_9(int x) { return x * 9; }
+inline int f4892_10(int x) { return x * 10; }
+inline int f4892_11(int x) { return x * 11; }
+inline int f4892_12(int x) { return x * 12; }
+inline int f4892_13(int x) { return x * 13; }
+inline int f4892_14(int x) { return x * 14; }
+inline int f4892_15(int x) { return x * 15; }
+inline int f4892_16(int x) { return x * 16; }
+inline int f4892_17(int x) { return x * 17; }
+inline int f4892_18(int x) { return x * 18; }
+inline int f4892_19(int x) { return x * 19; }
+inline int f4892_20(int x) { return x * 20; }
+inline int f4892_21(int x) { return x * 21; }
+inline int f4892_22(int x) { return x * 22; }
+inline int f4892_23(int x) { return x * 23; }
+inline int f4892_24(int x) { return x * 24; }
+inline int f4892_25(int x) { return x * 25; }
+inline int f4892_26(int x) { return x * 26; }
+inline int f4892_27(int x) { return x * 27; }
+inline int f4892_28(int x) { return x * 28; }
+inline int f4892_29(int x) { return x * 29; }
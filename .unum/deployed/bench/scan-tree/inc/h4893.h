@@ -0,0 +1,42 @@
+#pragma once
+/* header 4893 */
+#include <vector>
+#include "h4335.h"
+#include "h8858.h"
+#include "h6137.h"
+#include "h9720.h"
+#include "h8753.h"
+#ifdef X
+#include "h463.h"
+#endif
+struct S4893 { int a; const char *s = "x//y"; };
+inline int f4893_0(int x) { return x * 0; }
+inline int f4893_1(int x) { return x * 1; }
+inline int f4893_2(int x) { return x * 2; }
+inline int f4893_3(int x) { return x * 3; }
+inline int f4893_4(int x) { return x * 4; }
+inline int f4893_5(int x) { return x * 5; }
+inline int f4893_6(int x) { return x * 6; }
+inline int f4893_7(int x) { return x * 7; }
+inline int f4893_8(int x) { return x * 8; }
+inline int f4893_9(int x) { return x * 9; }
+inline int f4893_10(int x) { return x * 10; }
+inline int f4893_11(int x) { return x * 11; }
+inline int f4893_12(int x) { return x * 12; }
+inline int f4893_13(int x) { return x * 13; }
+inline int f4893_14(int x) { return x * 14; }
+inline int f4893_15(int x) { return x * 15; }
+inline int f4893_16(int x) { return x * 16; }
+inline int f4893_17(int x) { return x * 17; }
+inline int f4893_18(int x) { return x * 18; }
+inline int f4893_19(int x) { return x * 19; }
+inline int f4893_20(int x) { return x * 20; }
+inline int f4893_21(int x) { return x * 21; }
+inline int f4893_22(int x) { return x * 22; }
+inline int f4893_23(int x) { return x * 23; }
+inline int f4893_24(int x) { return x * 24; }
+inline int f4893_25(int x) { return x * 25; }
+inline int f4893_26(int x) { return x * 26; }
+inline int f4893_27(int x) { return x * 27; }
+inline int f4893_28(int x) { return x * 28; }
+inline int f4893_29(int x) { return x * 29; }
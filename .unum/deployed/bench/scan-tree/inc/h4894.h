@@ -0,0 +1,42 @@
+#pragma once
+/* header 4894 */
+#include <vector>
+#include "h6615.h"
+#include "h5793.h"
+#include "h377.h"
+#include "h573.h"
+#include "h1070.h"
+#ifdef X
+#include "h7388.h"
+#endif
+struct S4894 { int a; const char *s = "x//y"; };
+inline int f4894_0(int x) { return x * 0; }
+inline int f4894_1(int x) { return x * 1; }
+inline int f4894_2(int x) { return x * 2; }
+inline int f4894_3(int x) { return x * 3; }
+inline int f4894_4(int x) { return x * 4; }
+inline int f4894_5(int x) { return x * 5; }
+inline int f4894_6(int x) { return x * 6; }
+inline int f4894_7(int x) { return x * 7; }
+inline int f4894_8(int x) { return x * 8; }
+inline int f4894_9(int x) { return x * 9; }
+inline int f4894_10(int x) { return x * 10; }
+inline int f4894_11(int x) { return x * 11; }
+inline int f4894_12(int x) { return x * 12; }
+inline int f4894_13(int x) { return x * 13; }
+inline int f4894_14(int x) { return x * 14; }
+inline int f4894_15(int x) { return x * 15; }
+inline int f4894_16(int x) { return x * 16; }
+inline int f4894_17(int x) { return x * 17; }
+inline int f4894_18(int x) { return x * 18; }
+inline int f4894_19(int x) { return x * 19; }
+inline int f4894_20(int x) { return x * 20; }
+inline int f4894_21(int x) { return x * 21; }
+inline int f4894_22(int x) { return x * 22; }
+inline int f4894_23(int x) { return x * 23; }
+inline int f4894_24(int x) { return x * 24; }
+inline int f4894_25(int x) { return x * 25; }
+inline int f4894_26(int x) { return x * 26; }
+inline int f4894_27(int x) { return x * 27; }
+inline int f4894_28(int x) { return x * 28; }
+inline int f4894_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4896 */
+#include <vector>
+#include "h1775.h"
+#include "h7484.h"
+#include "h7102.h"
+#include "h3085.h"
+#include "h2474.h"
+#ifdef X
+#include "h2769.h"
+#endif
+struct S4896 { int a; const char *s = "x//y"; };
+inline int f4896_0(int x) { return x * 0; }
+inline int f4896_1(int x) { return x * 1; }
+inline int f4896_2(int x) { return x * 2; }
+inline int f4896_3(int x) { return x * 3; }
+inline int f4896_4(int x) { return x * 4; }
+inline int f4896_5(int x) { return x * 5; }
+inline int f4896_6(int x) { return x * 6; }
+inline int f4896_7(int x) { return x * 7; }
+inline int f4896_8(int x) { return x * 8; }
+inline int f4896_9(int x) { return x * 9; }
+inline int f4896_10(int x) { return x * 10; }
+inline int f4896_11(int x) { return x * 11; }
+inline int f4896_12(int x) { return x * 12; }
+inline int f4896_13(int x) { return x * 13; }
+inline int f4896_14(int x) { return x * 14; }
+inline int f4896_15(int x) { return x * 15; }
+inline int f4896_16(int x) { return x * 16; }
+inline int f4896_17(int x) { return x * 17; }
+inline int f4896_18(int x) { return x * 18; }
+inline int f4896_19(int x) { return x * 19; }
+inline int f4896_20(int x) { return x * 20; }
+inline int f4896_21(int x) { return x * 21; }
+inline int f4896_22(int x) { return x * 22; }
+inline int f4896_23(int x) { return x * 23; }
+inline int f4896_24(int x) { return x * 24; }
+inline int f4896_25(int x) { return x * 25; }
+inline int f4896_26(int x) { return x * 26; }
+inline int f4896_27(int x) { return x * 27; }
+inline int f4896_28(int x) { return x * 28; }
+inline int f4896_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4898 */
+#include <vector>
+#include "h1498.h"
+#include "h9085.h"
+#include "h9495.h"
+#include "h8499.h"
+#include "h5387.h"
+#ifdef X
+#include "h1601.h"
+#endif
+struct S4898 { int a; const char *s = "x//y"; };
+inline int f4898_0(int x) { return x * 0; }
+inline int f4898_1(int x) { return x * 1; }
+inline int f4898_2(int x) { return x * 2; }
+inline int f4898_3(int x) { return x * 3; }
+inline int f4898_4(int x) { return x * 4; }
+inline int f4898_5(int x) { return x * 5; }
+inline int f4898_6(int x) { return x * 6; }
+inline int f4898_7(int x) { return x * 7; }
+inline int f4898_8(int x) { return x * 8; }
+inline int f4898_9(int x) { return x * 9; }
+inline int f4898_10(int x) { return x * 10; }
+inline int f4898_11(int x) { return x * 11; }
+inline int f4898_12(int x) { return x * 12; }
+inline int f4898_13(int x) { return x * 13; }
+inline int f4898_14(int x) { return x * 14; }
+inline int f4898_15(int x) { return x * 15; }
+inline int f4898_16(int x) { return x * 16; }
+inline int f4898_17(int x) { return x * 17; }
+inline int f4898_18(int x) { return x * 18; }
+inline int f4898_19(int x) { return x * 19; }
+inline int f4898_20(int x) { return x * 20; }
+inline int f4898_21(int x) { return x * 21; }
+inline int f4898_22(int x) { return x * 22; }
+inline int f4898_23(int x) { return x * 23; }
+inline int f4898_24(int x) { return x * 24; }
+inline int f4898_25(int x) { return x * 25; }
+inline int f4898_26(int x) { return x * 26; }
+inline int f4898_27(int x) { return x * 27; }
+inline int f4898_28(int x) { return x * 28; }
+inline int f4898_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4899 */
+#include <vector>
+#include "h9294.h"
+#include "h2393.h"
+#include "h2006.h"
+#include "h9690.h"
+#include "h9408.h"
+#ifdef X
+#include "h9750.h"
+#endif
+struct S4899 { int a; const char *s = "x//y"; };
+inline int f4899_0(int x) { return x * 0; }
+inline int f4899_1(int x) { return x * 1; }
+inline int f4899_2(int x) { return x * 2; }
+inline int f4899_3(int x) { return x * 3; }
+inline int f4899_4(int x) { return x * 4; }
+inline int f4899_5(int x) { return x * 5; }
+inline int f4899_6(int x) { return x * 6; }
+inline int f4899_7(int x) { return x * 7; }
+inline int f4899_8(int x) { return x * 8; }
+inline int f4899_9(int x) { return x * 9; }
+inline int f4899_10(int x) { return x * 10; }
+inline int f4899_11(int x) { return x * 11; }
+inline int f4899_12(int x) { return x * 12; }
+inline int f4899_13(int x) { return x * 13; }
+inline int f4899_14(int x) { return x * 14; }
+inline int f4899_15(int x) { return x * 15; }
+inline int f4899_16(int x) { return x * 16; }
+inline int f4899_17(int x) { return x * 17; }
+inline int f4899_18(int x) { return x * 18; }
+inline int f4899_19(int x) { return x * 19; }
+inline int f4899_20(int x) { return x * 20; }
+inline int f4899_21(int x) { return x * 21; }
+inline int f4899_22(int x) { return x * 22; }
+inline int f4899_23(int x) { return x * 23; }
+inline int f4899_24(int x) { return x * 24; }
+inline int f4899_25(int x) { return x * 25; }
+inline int f4899_26(int x) { return x * 26; }
+inline int f4899_27(int x) { return x * 27; }
+inline int f4899_28(int x) { return x * 28; }
+inline int f4899_29(int x) { return x * 29; }
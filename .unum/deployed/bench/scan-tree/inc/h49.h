@@ -0,0 +1,42 @@
+#pragma once
+/* header 49 */
+#include <vector>
+#include "h8946.h"
+#include "h2331.h"
+#include "h3486.h"
+#include "h1520.h"
+#include "h4301.h"
+#ifdef X
+#include "h6178.h"
+#endif
+struct S49 { int a; const char *s = "x//y"; };
+inline int f49_0(int x) { return x * 0; }
+inline int f49_1(int x) { return x * 1; }
+inline int f49_2(int x) { return x * 2; }
+inline int f49_3(int x) { return x * 3; }
+inline int f49_4(int x) { return x * 4; }
+inline int f49_5(int x) { return x * 5; }
+inline int f49_6(int x) { return x * 6; }
+inline int f49_7(int x) { return x * 7; }
+inline int f49_8(int x) { return x * 8; }
+inline int f49_9(int x) { return x * 9; }
+inline int f49_10(int x) { return x * 10; }
+inline int f49_11(int x) { return x * 11; }
+inline int f49_12(int x) { return x * 12; }
+inline int f49_13(int x) { return x * 13; }
+inline int f49_14(int x) { return x * 14; }
+inline int f49_15(int x) { return x * 15; }
+inline int f49_16(int x) { return x * 16; }
+inline int f49_17(int x) { return x * 17; }
+inline int f49_18(int x) { return x * 18; }
+inline int f49_19(int x) { return x * 19; }
+inline int f49_20(int x) { return x * 20; }
+inline int f49_21(int x) { return x * 21; }
+inline int f49_22(int x) { return x * 22; }
+inline int f49_23(int x) { return x * 23; }
+inline int f49_24(int x) { return x * 24; }
+inline int f49_25(int x) { return x * 25; }
+inline int f49_26(int x) { return x * 26; }
+inline int f49_27(int x) { return x * 27; }
+inline int f49_28(int x) { return x * 28; }
+inline int f49_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4902 */
+#include <vector>
+#include "h1687.h"
+#include "h3511.h"
+#include "h3238.h"
+#include "h9650.h"
+#include "h1327.h"
+#ifdef X
+#include "h8946.h"
+#endif
+struct S4902 { int a; const char *s = "x//y"; };
+inline int f4902_0(int x) { return x * 0; }
+inline int f4902_1(int x) { return x * 1; }
+inline int f4902_2(int x) { return x * 2; }
+inline int f4902_3(int x) { return x * 3; }
+inline int f4902_4(int x) { return x * 4; }
+inline int f4902_5(int x) { return x * 5; }
+inline int f4902_6(int x) { return x * 6; }
+inline int f4902_7(int x) { return x * 7; }
+inline int f4902_8(int x) { return x * 8; }
+inline int f4902_9(int x) { return x * 9; }
+inline int f4902_10(int x) { return x * 10; }
+inline int f4902_11(int x) { return x * 11; }
+inline int f4902_12(int x) { return x * 12; }
+inline int f4902_13(int x) { return x * 13; }
+inline int f4902_14(int x) { return x * 14; }
+inline int f4902_15(int x) { return x * 15; }
+inline int f4902_16(int x) { return x * 16; }
+inline int f4902_17(int x) { return x * 17; }
+inline int f4902_18(int x) { return x * 18; }
+inline int f4902_19(int x) { return x * 19; }
+inline int f4902_20(int x) { return x * 20; }
+inline int f4902_21(int x) { return x * 21; }
+inline int f4902_22(int x) { return x * 22; }
+inline int f4902_23(int x) { return x * 23; }
+inline int f4902_24(int x) { return x * 24; }
+inline int f4902_25(int x) { return x * 25; }
+inline int f4902_26(int x) { return x * 26; }
+inline int f4902_27(int x) { return x * 27; }
+inline int f4902_28(int x) { return x * 28; }
+inline int f4902_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4903 */
+#include <vector>
+#include "h1197.h"
+#include "h9382.h"
+#include "h1795.h"
+#include "h8153.h"
+#include "h8059.h"
+#ifdef X
+#include "h3008.h"
+#endif
+struct S4903 { int a; const char *s = "x//y"; };
+inline int f4903_0(int x) { return x * 0; }
+inline int f4903_1(int x) { return x * 1; }
+inline int f4903_2(int x) { return x * 2; }
+inline int f4903_3(int x) { return x * 3; }
+inline int f4903_4(int x) { return x * 4; }
+inline int f4903_5(int x) { return x * 5; }
+inline int f4903_6(int x) { return x * 6; }
+inline int f4903_7(int x) { return x * 7; }
+inline int f4903_8(int x) { return x * 8; }
+inline int f4903_9(int x) { return x * 9; }
+inline int f4903_10(int x) { return x * 10; }
+inline int f4903_11(int x) { return x * 11; }
+inline int f4903_12(int x) { return x * 12; }
+inline int f4903_13(int x) { return x * 13; }
+inline int f4903_14(int x) { return x * 14; }
+inline int f4903_15(int x) { return x * 15; }
+inline int f4903_16(int x) { return x * 16; }
+inline int f4903_17(int x) { return x * 17; }
+inline int f4903_18(int x) { return x * 18; }
+inline int f4903_19(int x) { return x * 19; }
+inline int f4903_20(int x) { return x * 20; }
+inline int f4903_21(int x) { return x * 21; }
+inline int f4903_22(int x) { return x * 22; }
+inline int f4903_23(int x) { return x * 23; }
+inline int f4903_24(int x) { return x * 24; }
+inline int f4903_25(int x) { return x * 25; }
+inline int f4903_26(int x) { return x * 26; }
+inline int f4903_27(int x) { return x * 27; }
+inline int f4903_28(int x) { return x * 28; }
+inline int f4903_29(int x) { return x * 29; }
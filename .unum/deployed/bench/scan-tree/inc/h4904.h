@@ -0,0 +1,42 @@
+#pragma once
+/* header 4904 */
+#include <vector>
+#include "h4376.h"
+#include "h1124.h"
+#include "h4895.h"
+#include "h5260.h"
+#include "h3811.h"
+#ifdef X
+#include "h2345.h"
+#endif
+struct S4904 { int a; const char *s = "x//y"; };
+inline int f4904_0(int x) { return x * 0; }
+inline int f4904_1(int x) { return x * 1; }
+inline int f4904_2(int x) { return x * 2; }
+inline int f4904_3(int x) { return x * 3; }
+inline int f4904_4(int x) { return x * 4; }
+inline int f4904_5(int x) { return x * 5; }
+inline int f4904_6(int x) { return x * 6; }
+inline int f4904_7(int x) { return x * 7; }
+inline int f4904_8(int x) { return x * 8; }
+inline int f4904_9(int x) { return x * 9; }
+inline int f4904_10(int x) { return x * 10; }
+inline int f4904_11(int x) { return x * 11; }
+inline int f4904_12(int x) { return x * 12; }
+inline int f4904_13(int x) { return x * 13; }
+inline int f4904_14(int x) { return x * 14; }
+inline int f4904_15(int x) { return x * 15; }
+inline int f4904_16(int x) { return x * 16; }
+inline int f4904_17(int x) { return x * 17; }
+inline int f4904_18(int x) { return x * 18; }
+inline int f4904_19(int x) { return x * 19; }
+inline int f4904_20(int x) { return x * 20; }
+inline int f4904_21(int x) { return x * 21; }
+inline int f4904_22(int x) { return x * 22; }
+inline int f4904_23(int x) { return x * 23; }
+inline int f4904_24(int x) { return x * 24; }
+inline int f4904_25(int x) { return x * 25; }
+inline int f4904_26(int x) { return x * 26; }
+inline int f4904_27(int x) { return x * 27; }
+inline int f4904_28(int x) { return x * 28; }
+inline int f4904_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4905 */
+#include <vector>
+#include "h3773.h"
+#include "h7269.h"
+#include "h7279.h"
+#include "h572.h"
+#include "h7815.h"
+#ifdef X
+#include "h8033.h"
+#endif
+struct S4905 { int a; const char *s = "x//y"; };
+inline int f4905_0(int x) { return x * 0; }
+inline int f4905_1(int x) { return x * 1; }
+inline int f4905_2(int x) { return x * 2; }
+inline int f4905_3(int x) { return x * 3; }
+inline int f4905_4(int x) { return x * 4; }
+inline int f4905_5(int x) { return x * 5; }
+inline int f4905_6(int x) { return x * 6; }
+inline int f4905_7(int x) { return x * 7; }
+inline int f4905_8(int x) { return x * 8; }
+inline int f4905_9(int x) { return x * 9; }
+inline int f4905_10(int x) { return x * 10; }
+inline int f4905_11(int x) { return x * 11; }
+inline int f4905_12(int x) { return x * 12; }
+inline int f4905_13(int x) { return x * 13; }
+inline int f4905_14(int x) { return x * 14; }
+inline int f4905_15(int x) { return x * 15; }
+inline int f4905_16(int x) { return x * 16; }
+inline int f4905_17(int x) { return x * 17; }
+inline int f4905_18(int x) { return x * 18; }
+inline int f4905_19(int x) { return x * 19; }
+inline int f4905_20(int x) { return x * 20; }
+inline int f4905_21(int x) { return x * 21; }
+inline int f4905_22(int x) { return x * 22; }
+inline int f4905_23(int x) { return x * 23; }
+inline int f4905_24(int x) { return x * 24; }
+inline int f4905_25(int x) { return x * 25; }
+inline int f4905_26(int x) { return x * 26; }
+inline int f4905_27(int x) { return x * 27; }
+inline int f4905_28(int x) { return x * 28; }
+inline int f4905_29(int x) { return x * 29; }
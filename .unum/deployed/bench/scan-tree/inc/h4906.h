@@ -0,0 +1,42 @@
+#pragma once
+/* header 4906 */
+#include <vector>
+#include "h883.h"
+#include "h6267.h"
+#include "h2917.h"
+#include "h8898.h"
+#include "h5369.h"
+#ifdef X
+#include "h3730.h"
+#endif
+struct S4906 { int a; const char *s = "x//y"; };
+inline int f4906_0(int x) { return x * 0; }
+inline int f4906_1(int x) { return x * 1; }
+inline int f4906_2(int x) { return x * 2; }
+inline int f4906_3(int x) { return x * 3; }
+inline int f4906_4(int x) { return x * 4; }
+inline int f4906_5(int x) { return x * 5; }
+inline int f4906_6(int x) { return x * 6; }
+inline int f4906_7(int x) { return x * 7; }
+inline int f4906_8(int x) { return x * 8; }
+inline int f4906_9(int x) { return x * 9; }
+inline int f4906_10(int x) { return x * 10; }
+inline int f4906_11(int x) { return x * 11; }
+inline int f4906_12(int x) { return x * 12; }
+inline int f4906_13(int x) { return x * 13; }
+inline int f4906_14(int x) { return x * 14; }
+inline int f4906_15(int x) { return x * 15; }
+inline int f4906_16(int x) { return x * 16; }
+inline int f4906_17(int x) { return x * 17; }
+inline int f4906_18(int x) { return x * 18; }
+inline int f4906_19(int x) { return x * 19; }
+inline int f4906_20(int x) { return x * 20; }
+inline int f4906_21(int x) { return x * 21; }
+inline int f4906_22(int x) { return x * 22; }
+inline int f4906_23(int x) { return x * 23; }
+inline int f4906_24(int x) { return x * 24; }
+inline int f4906_25(int x) { return x * 25; }
+inline int f4906_26(int x) { return x * 26; }
+inline int f4906_27(int x) { return x * 27; }
+inline int f4906_28(int x) { return x * 28; }
+inline int f4906_29(int x) { return x * 29; }
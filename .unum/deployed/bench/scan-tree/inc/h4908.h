@@ -0,0 +1,42 @@
+#pragma once
+/* header 4908 */
+#include <vector>
+#include "h8959.h"
+#include "h6955.h"
+#include "h3225.h"
+#include "h9917.h"
+#include "h1582.h"
+#ifdef X
+#include "h6486.h"
+#endif
+struct S4908 { int a; const char *s = "x//y"; };
+inline int f4908_0(int x) { return x * 0; }
+inline int f4908_1(int x) { return x * 1; }
+inline int f4908_2(int x) { return x * 2; }
+inline int f4908_3(int x) { return x * 3; }
+inline int f4908_4(int x) { return x * 4; }
+inline int f4908_5(int x) { return x * 5; }
+inline int f4908_6(int x) { return x * 6; }
+inline int f4908_7(int x) { return x * 7; }
+inline int f4908_8(int x) { return x * 8; }
+inline int f4908_9(int x) { return x * 9; }
+inline int f4908_10(int x) { return x * 10; }
+inline int f4908_11(int x) { return x * 11; }
+inline int f4908_12(int x) { return x * 12; }
+inline int f4908_13(int x) { return x * 13; }
+inline int f4908_14(int x) { return x * 14; }
+inline int f4908_15(int x) { return x * 15; }
+inline int f4908_16(int x) { return x * 16; }
+inline int f4908_17(int x) { return x * 17; }
+inline int f4908_18(int x) { return x * 18; }
+inline int f4908_19(int x) { return x * 19; }
+inline int f4908_20(int x) { return x * 20; }
+inline int f4908_21(int x) { return x * 21; }
+inline int f4908_22(int x) { return x * 22; }
+inline int f4908_23(int x) { return x * 23; }
+inline int f4908_24(int x) { return x * 24; }
+inline int f4908_25(int x) { return x * 25; }
+inline int f4908_26(int x) { return x * 26; }
+inline int f4908_27(int x) { return x * 27; }
+inline int f4908_28(int x) { return x * 28; }
+inline int f4908_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4909 */
+#include <vector>
+#include "h1475.h"
+#include "h5842.h"
+#include "h4213.h"
+#include "h8267.h"
+#include "h1028.h"
+#ifdef X
+#include "h2785.h"
+#endif
+struct S4909 { int a; const char *s = "x//y"; };
+inline int f4909_0(int x) { return x * 0; }
+inline int f4909_1(int x) { return x * 1; }
+inline int f4909_2(int x) { return x * 2; }
+inline int f4909_3(int x) { return x * 3; }
+inline int f4909_4(int x) { return x * 4; }
+inline int f4909_5(int x) { return x * 5; }
+inline int f4909_6(int x) { return x * 6; }
+inline int f4909_7(int x) { return x * 7; }
+inline int f4909_8(int x) { return x * 8; }
+inline int f4909_9(int x) { return x * 9; }
+inline int f4909_10(int x) { return x * 10; }
+inline int f4909_11(int x) { return x * 11; }
+inline int f4909_12(int x) { return x * 12; }
+inline int f4909_13(int x) { return x * 13; }
+inline int f4909_14(int x) { return x * 14; }
+inline int f4909_15(int x) { return x * 15; }
+inline int f4909_16(int x) { return x * 16; }
+inline int f4909_17(int x) { return x * 17; }
+inline int f4909_18(int x) { return x * 18; }
+inline int f4909_19(int x) { return x * 19; }
+inline int f4909_20(int x) { return x * 20; }
+inline int f4909_21(int x) { return x * 21; }
+inline int f4909_22(int x) { return x * 22; }
+inline int f4909_23(int x) { return x * 23; }
+inline int f4909_24(int x) { return x * 24; }
+inline int f4909_25(int x) { return x * 25; }
+inline int f4909_26(int x) { return x * 26; }
+inline int f4909_27(int x) { return x * 27; }
+inline int f4909_28(int x) { return x * 28; }
+inline int f4909_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 491 */
+#include <vector>
+#include "h1197.h"
+#include "h5313.h"
+#include "h8566.h"
+#include "h515.h"
+#include "h2872.h"
+#ifdef X
+#include "h4166.h"
+#endif
+struct S491 { int a; const char *s = "x//y"; };
+inline int f491_0(int x) { return x * 0; }
+inline int f491_1(int x) { return x * 1; }
+inline int f491_2(int x) { return x * 2; }
+inline int f491_3(int x) { return x * 3; }
+inline int f491_4(int x) { return x * 4; }
+inline int f491_5(int x) { return x * 5; }
+inline int f491_6(int x) { return x * 6; }
+inline int f491_7(int x) { return x * 7; }
+inline int f491_8(int x) { return x * 8; }
+inline int f491_9(int x) { return x * 9; }
+inline int f491_10(int x) { return x * 10; }
+inline int f491_11(int x) { return x * 11; }
+inline int f491_12(int x) { return x * 12; }
+inline int f491_13(int x) { return x * 13; }
+inline int f491_14(int x) { return x * 14; }
+inline int f491_15(int x) { return x * 15; }
+inline int f491_16(int x) { return x * 16; }
+inline int f491_17(int x) { return x * 17; }
+inline int f491_18(int x) { return x * 18; }
+inline int f491_19(int x) { return x * 19; }
+inline int f491_20(int x) { return x * 20; }
+inline int f491_21(int x) { return x * 21; }
+inline int f491_22(int x) { return x * 22; }
+inline int f491_23(int x) { return x * 23; }
+inline int f491_24(int x) { return x * 24; }
+inline int f491_25(int x) { return x * 25; }
+inline int f491_26(int x) { return x * 26; }
+inline int f491_27(int x) { return x * 27; }
+inline int f491_28(int x) { return x * 28; }
+inline int f491_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4910 */
+#include <vector>
+#include "h9829.h"
+#include "h8953.h"
+#include "h2242.h"
+#include "h1336.h"
+#include "h5258.h"
+#ifdef X
+#include "h3187.h"
+#endif
+struct S4910 { int a; const char *s = "x//y"; };
+inline int f4910_0(int x) { return x * 0; }
+inline int f4910_1(int x) { return x * 1; }
+inline int f4910_2(int x) { return x * 2; }
+inline int f4910_3(int x) { return x * 3; }
+inline int f4910_4(int x) { return x * 4; }
+inline int f4910_5(int x) { return x * 5; }
+inline int f4910_6(int x) { return x * 6; }
+inline int f4910_7(int x) { return x * 7; }
+inline int f4910_8(int x) { return x * 8; }
+inline int f4910_9(int x) { return x * 9; }
+inline int f4910_10(int x) { return x * 10; }
+inline int f4910_11(int x) { return x * 11; }
+inline int f4910_12(int x) { return x * 12; }
+inline int f4910_13(int x) { return x * 13; }
+inline int f4910_14(int x) { return x * 14; }
+inline int f4910_15(int x) { return x * 15; }
+inline int f4910_16(int x) { return x * 16; }
+inline int f4910_17(int x) { return x * 17; }
+inline int f4910_18(int x) { return x * 18; }
+inline int f4910_19(int x) { return x * 19; }
+inline int f4910_20(int x) { return x * 20; }
+inline int f4910_21(int x) { return x * 21; }
+inline int f4910_22(int x) { return x * 22; }
+inline int f4910_23(int x) { return x * 23; }
+inline int f4910_24(int x) { return x * 24; }
+inline int f4910_25(int x) { return x * 25; }
+inline int f4910_26(int x) { return x * 26; }
+inline int f4910_27(int x) { return x * 27; }
+inline int f4910_28(int x) { return x * 28; }
+inline int f4910_29(int x) { return x * 29; }
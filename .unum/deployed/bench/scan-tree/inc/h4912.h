@@ -0,0 +1,42 @@
+#pragma once
+/* header 4912 */
+#include <vector>
+#include "h4534.h"
+#include "h7977.h"
+#include "h5167.h"
+#include "h6343.h"
+#include "h1261.h"
+#ifdef X
+#include "h2034.h"
+#endif
+struct S4912 { int a; const char *s = "x//y"; };
+inline int f4912_0(int x) { return x * 0; }
+inline int f4912_1(int x) { return x * 1; }
+inline int f4912_2(int x) { return x * 2; }
+inline int f4912_3(int x) { return x * 3; }
+inline int f4912_4(int x) { return x * 4; }
+inline int f4912_5(int x) { return x * 5; }
+inline int f4912_6(int x) { return x * 6; }
+inline int f4912_7(int x) { return x * 7; }
+inline int f4912_8(int x) { return x * 8; }
+inline int f4912_9(int x) { return x * 9; }
+inline int f4912_10(int x) { return x * 10; }
+inline int f4912_11(int x) { return x * 11; }
+inline int f4912_12(int x) { return x * 12; }
+inline int f4912_13(int x) { return x * 13; }
+inline int f4912_14(int x) { return x * 14; }
+inline int f4912_15(int x) { return x * 15; }
+inline int f4912_16(int x) { return x * 16; }
+inline int f4912_17(int x) { return x * 17; }
+inline int f4912_18(int x) { return x * 18; }
+inline int f4912_19(int x) { return x * 19; }
+inline int f4912_20(int x) { return x * 20; }
+inline int f4912_21(int x) { return x * 21; }
+inline int f4912_22(int x) { return x * 22; }
+inline int f4912_23(int x) { return x * 23; }
+inline int f4912_24(int x) { return x * 24; }
+inline int f4912_25(int x) { return x * 25; }
+inline int f4912_26(int x) { return x * 26; }
+inline int f4912_27(int x) { return x * 27; }
+inline int f4912_28(int x) { return x * 28; }
+inline int f4912_29(int x) { return x * 29; }
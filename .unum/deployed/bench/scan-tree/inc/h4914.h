@@ -0,0 +1,42 @@
+#pragma once
+/* header 4914 */
+#include <vector>
+#include "h7244.h"
+#include "h9557.h"
+#include "h9738.h"
+#include "h3595.h"
+#include "h7557.h"
+#ifdef X
+#include "h71.h"
+#endif
+struct S4914 { int a; const char *s = "x//y"; };
+inline int f4914_0(int x) { return x * 0; }
+inline int f4914_1(int x) { return x * 1; }
+inline int f4914_2(int x) { return x * 2; }
+inline int f4914_3(int x) { return x * 3; }
+inline int f4914_4(int x) { return x * 4; }
+inline int f4914_5(int x) { return x * 5; }
+inline int f4914_6(int x) { return x * 6; }
+inline int f4914_7(int x) { return x * 7; }
+inline int f4914_8(int x) { return x * 8; }
+inline int f4914_9(int x) { return x * 9; }
+inline int f4914_10(int x) { return x * 10; }
+inline int f4914_11(int x) { return x * 11; }
+inline int f4914_12(int x) { return x * 12; }
+inline int f4914_13(int x) { return x * 13; }
+inline int f4914_14(int x) { return x * 14; }
+inline int f4914_15(int x) { return x * 15; }
+inline int f4914_16(int x) { return x * 16; }
+inline int f4914_17(int x) { return x * 17; }
+inline int f4914_18(int x) { return x * 18; }
+inline int f4914_19(int x) { return x * 19; }
+inline int f4914_20(int x) { return x * 20; }
+inline int f4914_21(int x) { return x * 21; }
+inline int f4914_22(int x) { return x * 22; }
+inline int f4914_23(int x) { return x * 23; }
+inline int f4914_24(int x) { return x * 24; }
+inline int f4914_25(int x) { return x * 25; }
+inline int f4914_26(int x) { return x * 26; }
+inline int f4914_27(int x) { return x * 27; }
+inline int f4914_28(int x) { return x * 28; }
+inline int f4914_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4916 */
+#include <vector>
+#include "h79.h"
+#include "h939.h"
+#include "h9791.h"
+#include "h1878.h"
+#include "h6973.h"
+#ifdef X
+#include "h6336.h"
+#endif
+struct S4916 { int a; const char *s = "x//y"; };
+inline int f4916_0(int x) { return x * 0; }
+inline int f4916_1(int x) { return x * 1; }
+inline int f4916_2(int x) { return x * 2; }
+inline int f4916_3(int x) { return x * 3; }
+inline int f4916_4(int x) { return x * 4; }
+inline int f4916_5(int x) { return x * 5; }
+inline int f4916_6(int x) { return x * 6; }
+inline int f4916_7(int x) { return x * 7; }
+inline int f4916_8(int x) { return x * 8; }
+inline int f4916_9(int x) { return x * 9; }
+inline int f4916_10(int x) { return x * 10; }
+inline int f4916_11(int x) { return x * 11; }
+inline int f4916_12(int x) { return x * 12; }
+inline int f4916_13(int x) { return x * 13; }
+inline int f4916_14(int x) { return x * 14; }
+inline int f4916_15(int x) { return x * 15; }
+inline int f4916_16(int x) { return x * 16; }
+inline int f4916_17(int x) { return x * 17; }
+inline int f4916_18(int x) { return x * 18; }
+inline int f4916_19(int x) { return x * 19; }
+inline int f4916_20(int x) { return x * 20; }
+inline int f4916_21(int x) { return x * 21; }
+inline int f4916_22(int x) { return x * 22; }
+inline int f4916_23(int x) { return x * 23; }
+inline int f4916_24(int x) { return x * 24; }
+inline int f4916_25(int x) { return x * 25; }
+inline int f4916_26(int x) { return x * 26; }
+inline int f4916_27(int x) { return x * 27; }
+inline int f4916_28(int x) { return x * 28; }
+inline int f4916_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4919 */
+#include <vector>
+#include "h3455.h"
+#include "h6854.h"
+#include "h890.h"
+#include "h2987.h"
+#include "h7607.h"
+#ifdef X
+#include "h4084.h"
+#endif
+struct S4919 { int a; const char *s = "x//y"; };
+inline int f4919_0(int x) { return x * 0; }
+inline int f4919_1(int x) { return x * 1; }
+inline int f4919_2(int x) { return x * 2; }
+inline int f4919_3(int x) { return x * 3; }
+inline int f4919_4(int x) { return x * 4; }
+inline int f4919_5(int x) { return x * 5; }
+inline int f4919_6(int x) { return x * 6; }
+inline int f4919_7(int x) { return x * 7; }
+inline int f4919_8(int x) { return x * 8; }
+inline int f4919_9(int x) { return x * 9; }
+inline int f4919_10(int x) { return x * 10; }
+inline int f4919_11(int x) { return x * 11; }
+inline int f4919_12(int x) { return x * 12; }
+inline int f4919_13(int x) { return x * 13; }
+inline int f4919_14(int x) { return x * 14; }
+inline int f4919_15(int x) { return x * 15; }
+inline int f4919_16(int x) { return x * 16; }
+inline int f4919_17(int x) { return x * 17; }
+inline int f4919_18(int x) { return x * 18; }
+inline int f4919_19(int x) { return x * 19; }
+inline int f4919_20(int x) { return x * 20; }
+inline int f4919_21(int x) { return x * 21; }
+inline int f4919_22(int x) { return x * 22; }
+inline int f4919_23(int x) { return x * 23; }
+inline int f4919_24(int x) { return x * 24; }
+inline int f4919_25(int x) { return x * 25; }
+inline int f4919_26(int x) { return x * 26; }
+inline int f4919_27(int x) { return x * 27; }
+inline int f4919_28(int x) { return x * 28; }
+inline int f4919_29(int x) { return x * 29; }
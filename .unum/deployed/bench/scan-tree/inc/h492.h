@@ -0,0 +1,42 @@
+#pragma once
+/* header 492 */
+#include <vector>
+#include "h7763.h"
+#include "h3972.h"
+#include "h1236.h"
+#include "h7011.h"
+#include "h3961.h"
+#ifdef X
+#include "h1005.h"
+#endif
+struct S492 { int a; const char *s = "x//y"; };
+inline int f492_0(int x) { return x * 0; }
+inline int f492_1(int x) { return x * 1; }
+inline int f492_2(int x) { return x * 2; }
+inline int f492_3(int x) { return x * 3; }
+inline int f492_4(int x) { return x * 4; }
+inline int f492_5(int x) { return x * 5; }
+inline int f492_6(int x) { return x * 6; }
+inline int f492_7(int x) { return x * 7; }
+inline int f492_8(int x) { return x * 8; }
+inline int f492_9(int x) { return x * 9; }
+inline int f492_10(int x) { return x * 10; }
+inline int f492_11(int x) { return x * 11; }
+inline int f492_12(int x) { return x * 12; }
+inline int f492_13(int x) { return x * 13; }
+inline int f492_14(int x) { return x * 14; }
+inline int f492_15(int x) { return x * 15; }
+inline int f492_16(int x) { return x * 16; }
+inline int f492_17(int x) { return x * 17; }
+inline int f492_18(int x) { return x * 18; }
+inline int f492_19(int x) { return x * 19; }
+inline int f492_20(int x) { return x * 20; }
+inline int f492_21(int x) { return x * 21; }
+inline int f492_22(int x) { return x * 22; }
+inline int f492_23(int x) { return x * 23; }
+inline int f492_24(int x) { return x * 24; }
+inline int f492_25(int x) { return x * 25; }
+inline int f492_26(int x) { return x * 26; }
+inline int f492_27(int x) { return x * 27; }
+inline int f492_28(int x) { return x * 28; }
+inline int f492_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4920 */
+#include <vector>
+#include "h1935.h"
+#include "h7211.h"
+#include "h5826.h"
+#include "h7453.h"
+#include "h5935.h"
+#ifdef X
+#include "h5003.h"
+#endif
+struct S4920 { int a; const char *s = "x//y"; };
+inline int f4920_0(int x) { return x * 0; }
+inline int f4920_1(int x) { return x * 1; }
+inline int f4920_2(int x) { return x * 2; }
+inline int f4920_3(int x) { return x * 3; }
+inline int f4920_4(int x) { return x * 4; }
+inline int f4920_5(int x) { return x * 5; }
+inline int f4920_6(int x) { return x * 6; }
+inline int f4920_7(int x) { return x * 7; }
+inline int f4920_8(int x) { return x * 8; }
+inline int f4920_9(int x) { return x * 9; }
+inline int f4920_10(int x) { return x * 10; }
+inline int f4920_11(int x) { return x * 11; }
+inline int f4920_12(int x) { return x * 12; }
+inline int f4920_13(int x) { return x * 13; }
+inline int f4920_14(int x) { return x * 14; }
+inline int f4920_15(int x) { return x * 15; }
+inline int f4920_16(int x) { return x * 16; }
+inline int f4920_17(int x) { return x * 17; }
+inline int f4920_18(int x) { return x * 18; }
+inline int f4920_19(int x) { return x * 19; }
+inline int f4920_20(int x) { return x * 20; }
+inline int f4920_21(int x) { return x * 21; }
+inline int f4920_22(int x) { return x * 22; }
+inline int f4920_23(int x) { return x * 23; }
+inline int f4920_24(int x) { return x * 24; }
+inline int f4920_25(int x) { return x * 25; }
+inline int f4920_26(int x) { return x * 26; }
+inline int f4920_27(int x) { return x * 27; }
+inline int f4920_28(int x) { return x * 28; }
+inline int f4920_29(int x) { return x * 29; }
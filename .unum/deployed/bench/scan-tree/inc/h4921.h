@@ -0,0 +1,42 @@
+#pragma once
+/* header 4921 */
+#include <vector>
+#include "h9427.h"
+#include "h247.h"
+#include "h8251.h"
+#include "h2410.h"
+#include "h8692.h"
+#ifdef X
+#include "h433.h"
+#endif
+struct S4921 { int a; const char *s = "x//y"; };
+inline int f4921_0(int x) { return x * 0; }
+inline int f4921_1(int x) { return x * 1; }
+inline int f4921_2(int x) { return x * 2; }
+inline int f4921_3(int x) { return x * 3; }
+inline int f4921_4(int x) { return x * 4; }
+inline int f4921_5(int x) { return x * 5; }
+inline int f4921_6(int x) { return x * 6; }
+inline int f4921_7(int x) { return x * 7; }
+inline int f4921_8(int x) { return x * 8; }
+inline int f4921_9(int x) { return x * 9; }
+inline int f4921_10(int x) { return x * 10; }
+inline int f4921_11(int x) { return x * 11; }
+inline int f4921_12(int x) { return x * 12; }
+inline int f4921_13(int x) { return x * 13; }
+inline int f4921_14(int x) { return x * 14; }
+inline int f4921_15(int x) { return x * 15; }
+inline int f4921_16(int x) { return x * 16; }
+inline int f4921_17(int x) { return x * 17; }
+inline int f4921_18(int x) { return x * 18; }
+inline int f4921_19(int x) { return x * 19; }
+inline int f4921_20(int x) { return x * 20; }
+inline int f4921_21(int x) { return x * 21; }
+inline int f4921_22(int x) { return x * 22; }
+inline int f4921_23(int x) { return x * 23; }
+inline int f4921_24(int x) { return x * 24; }
+inline int f4921_25(int x) { return x * 25; }
+inline int f4921_26(int x) { return x * 26; }
+inline int f4921_27(int x) { return x * 27; }
+inline int f4921_28(int x) { return x * 28; }
+inline int f4921_29(int x) { return x * 29; }
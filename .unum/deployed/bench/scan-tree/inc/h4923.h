@@ -0,0 +1,42 @@
+#pragma once
+/* header 4923 */
+#include <vector>
+#include "h5578.h"
+#include "h3660.h"
+#include "h1821.h"
+#include "h4947.h"
+#include "h9990.h"
+#ifdef X
+#include "h4603.h"
+#endif
+struct S4923 { int a; const char *s = "x//y"; };
+inline int f4923_0(int x) { return x * 0; }
+inline int f4923_1(int x) { return x * 1; }
+inline int f4923_2(int x) { return x * 2; }
+inline int f4923_3(int x) { return x * 3; }
+inline int f4923_4(int x) { return x * 4; }
+inline int f4923_5(int x) { return x * 5; }
+inline int f4923_6(int x) { return x * 6; }
+inline int f4923_7(int x) { return x * 7; }
+inline int f4923_8(int x) { return x * 8; }
+inline int f4923_9(int x) { return x * 9; }
+inline int f4923_10(int x) { return x * 10; }
+inline int f4923_11(int x) { return x * 11; }
+inline int f4923_12(int x) { return x * 12; }
+inline int f4923_13(int x) { return x * 13; }
+inline int f4923_14(int x) { return x * 14; }
+inline int f4923_15(int x) { return x * 15; }
+inline int f4923_16(int x) { return x * 16; }
+inline int f4923_17(int x) { return x * 17; }
+inline int f4923_18(int x) { return x * 18; }
+inline int f4923_19(int x) { return x * 19; }
+inline int f4923_20(int x) { return x * 20; }
+inline int f4923_21(int x) { return x * 21; }
+inline int f4923_22(int x) { return x * 22; }
+inline int f4923_23(int x) { return x * 23; }
+inline int f4923_24(int x) { return x * 24; }
+inline int f4923_25(int x) { return x * 25; }
+inline int f4923_26(int x) { return x * 26; }
+inline int f4923_27(int x) { return x * 27; }
+inline int f4923_28(int x) { return x * 28; }
+inline int f4923_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4927 */
+#include <vector>
+#include "h5047.h"
+#include "h7221.h"
+#include "h8051.h"
+#include "h8241.h"
+#include "h5618.h"
+#ifdef X
+#include "h5526.h"
+#endif
+struct S4927 { int a; const char *s = "x//y"; };
+inline int f4927_0(int x) { return x * 0; }
+inline int f4927_1(int x) { return x * 1; }
+inline int f4927_2(int x) { return x * 2; }
+inline int f4927_3(int x) { return x * 3; }
+inline int f4927_4(int x) { return x * 4; }
+inline int f4927_5(int x) { return x * 5; }
+inline int f4927_6(int x) { return x * 6; }
+inline int f4927_7(int x) { return x * 7; }
+inline int f4927_8(int x) { return x * 8; }
+inline int f4927_9(int x) { return x * 9; }
+inline int f4927_10(int x) { return x * 10; }
+inline int f4927_11(int x) { return x * 11; }
+inline int f4927_12(int x) { return x * 12; }
+inline int f4927_13(int x) { return x * 13; }
+inline int f4927_14(int x) { return x * 14; }
+inline int f4927_15(int x) { return x * 15; }
+inline int f4927_16(int x) { return x * 16; }
+inline int f4927_17(int x) { return x * 17; }
+inline int f4927_18(int x) { return x * 18; }
+inline int f4927_19(int x) { return x * 19; }
+inline int f4927_20(int x) { return x * 20; }
+inline int f4927_21(int x) { return x * 21; }
+inline int f4927_22(int x) { return x * 22; }
+inline int f4927_23(int x) { return x * 23; }
+inline int f4927_24(int x) { return x * 24; }
+inline int f4927_25(int x) { return x * 25; }
+inline int f4927_26(int x) { return x * 26; }
+inline int f4927_27(int x) { return x * 27; }
+inline int f4927_28(int x) { return x * 28; }
+inline int f4927_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4928 */
+#include <vector>
+#include "h8274.h"
+#include "h4087.h"
+#include "h4775.h"
+#include "h7955.h"
+#include "h5510.h"
+#ifdef X
+#include "h458.h"
+#endif
+struct S4928 { int a; const char *s = "x//y"; };
+inline int f4928_0(int x) { return x * 0; }
+inline int f4928_1(int x) { return x * 1; }
+inline int f4928_2(int x) { return x * 2; }
+inline int f4928_3(int x) { return x * 3; }
+inline int f4928_4(int x) { return x * 4; }
+inline int f4928_5(int x) { return x * 5; }
+inline int f4928_6(int x) { return x * 6; }
+inline int f4928_7(int x) { return x * 7; }
+inline int f4928_8(int x) { return x * 8; }
+inline int f4928_9(int x) { return x * 9; }
+inline int f4928_10(int x) { return x * 10; }
+inline int f4928_11(int x) { return x * 11; }
+inline int f4928_12(int x) { return x * 12; }
+inline int f4928_13(int x) { return x * 13; }
+inline int f4928_14(int x) { return x * 14; }
+inline int f4928_15(int x) { return x * 15; }
+inline int f4928_16(int x) { return x * 16; }
+inline int f4928_17(int x) { return x * 17; }
+inline int f4928_18(int x) { return x * 18; }
+inline int f4928_19(int x) { return x * 19; }
+inline int f4928_20(int x) { return x * 20; }
+inline int f4928_21(int x) { return x * 21; }
+inline int f4928_22(int x) { return x * 22; }
+inline int f4928_23(int x) { return x * 23; }
+inline int f4928_24(int x) { return x * 24; }
+inline int f4928_25(int x) { return x * 25; }
+inline int f4928_26(int x) { return x * 26; }
+inline int f4928_27(int x) { return x * 27; }
+inline int f4928_28(int x) { return x * 28; }
+inline int f4928_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4929 */
+#include <vector>
+#include "h2477.h"
+#include "h9567.h"
+#include "h9713.h"
+#include "h7294.h"
+#include "h4001.h"
+#ifdef X
+#include "h4700.h"
+#endif
+struct S4929 { int a; const char *s = "x//y"; };
+inline int f4929_0(int x) { return x * 0; }
+inline int f4929_1(int x) { return x * 1; }
+inline int f4929_2(int x) { return x * 2; }
+inline int f4929_3(int x) { return x * 3; }
+inline int f4929_4(int x) { return x * 4; }
+inline int f4929_5(int x) { return x * 5; }
+inline int f4929_6(int x) { return x * 6; }
+inline int f4929_7(int x) { return x * 7; }
+inline int f4929_8(int x) { return x * 8; }
+inline int f4929_9(int x) { return x * 9; }
+inline int f4929_10(int x) { return x * 10; }
+inline int f4929_11(int x) { return x * 11; }
+inline int f4929_12(int x) { return x * 12; }
+inline int f4929_13(int x) { return x * 13; }
+inline int f4929_14(int x) { return x * 14; }
+inline int f4929_15(int x) { return x * 15; }
+inline int f4929_16(int x) { return x * 16; }
+inline int f4929_17(int x) { return x * 17; }
+inline int f4929_18(int x) { return x * 18; }
+inline int f4929_19(int x) { return x * 19; }
+inline int f4929_20(int x) { return x * 20; }
+inline int f4929_21(int x) { return x * 21; }
+inline int f4929_22(int x) { return x * 22; }
+inline int f4929_23(int x) { return x * 23; }
+inline int f4929_24(int x) { return x * 24; }
+inline int f4929_25(int x) { return x * 25; }
+inline int f4929_26(int x) { return x * 26; }
+inline int f4929_27(int x) { return x * 27; }
+inline int f4929_28(int x) { return x * 28; }
+inline int f4929_29(int x) { return x * 29; }
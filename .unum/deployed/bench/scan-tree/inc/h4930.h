@@ -0,0 +1,42 @@
+#pragma once
+/* header 4930 */
+#include <vector>
+#include "h7584.h"
+#include "h8599.h"
+#include "h7174.h"
+#include "h2589.h"
+#include "h5789.h"
+#ifdef X
+#include "h479.h"
+#endif
+struct S4930 { int a; const char *s = "x//y"; };
+inline int f4930_0(int x) { return x * 0; }
+inline int f4930_1(int x) { return x * 1; }
+inline int f4930_2(int x) { return x * 2; }
+inline int f4930_3(int x) { return x * 3; }
+inline int f4930_4(int x) { return x * 4; }
+inline int f4930_5(int x) { return x * 5; }
+inline int f4930_6(int x) { return x * 6; }
+inline int f4930_7(int x) { return x * 7; }
+inline int f4930_8(int x) { return x * 8; }
+inline int f4930_9(int x) { return x * 9; }
+inline int f4930_10(int x) { return x * 10; }
+inline int f4930_11(int x) { return x * 11; }
+inline int f4930_12(int x) { return x * 12; }
+inline int f4930_13(int x) { return x * 13; }
+inline int f4930_14(int x) { return x * 14; }
+inline int f4930_15(int x) { return x * 15; }
+inline int f4930_16(int x) { return x * 16; }
+inline int f4930_17(int x) { return x * 17; }
+inline int f4930_18(int x) { return x * 18; }
+inline int f4930_19(int x) { return x * 19; }
+inline int f4930_20(int x) { return x * 20; }
+inline int f4930_21(int x) { return x * 21; }
+inline int f4930_22(int x) { return x * 22; }
+inline int f4930_23(int x) { return x * 23; }
+inline int f4930_24(int x) { return x * 24; }
+inline int f4930_25(int x) { return x * 25; }
+inline int f4930_26(int x) { return x * 26; }
+inline int f4930_27(int x) { return x * 27; }
+inline int f4930_28(int x) { return x * 28; }
+inline int f4930_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4932 */
+#include <vector>
+#include "h1772.h"
+#include "h9079.h"
+#include "h9348.h"
+#include "h2897.h"
+#include "h3369.h"
+#ifdef X
+#include "h8782.h"
+#endif
+struct S4932 { int a; const char *s = "x//y"; };
+inline int f4932_0(int x) { return x * 0; }
+inline int f4932_1(int x) { return x * 1; }
+inline int f4932_2(int x) { return x * 2; }
+inline int f4932_3(int x) { return x * 3; }
+inline int f4932_4(int x) { return x * 4; }
+inline int f4932_5(int x) { return x * 5; }
+inline int f4932_6(int x) { return x * 6; }
+inline int f4932_7(int x) { return x * 7; }
+inline int f4932_8(int x) { return x * 8; }
+inline int f4932_9(int x) { return x * 9; }
+inline int f4932_10(int x) { return x * 10; }
+inline int f4932_11(int x) { return x * 11; }
+inline int f4932_12(int x) { return x * 12; }
+inline int f4932_13(int x) { return x * 13; }
+inline int f4932_14(int x) { return x * 14; }
+inline int f4932_15(int x) { return x * 15; }
+inline int f4932_16(int x) { return x * 16; }
+inline int f4932_17(int x) { return x * 17; }
+inline int f4932_18(int x) { return x * 18; }
+inline int f4932_19(int x) { return x * 19; }
+inline int f4932_20(int x) { return x * 20; }
+inline int f4932_21(int x) { return x * 21; }
+inline int f4932_22(int x) { return x * 22; }
+inline int f4932_23(int x) { return x * 23; }
+inline int f4932_24(int x) { return x * 24; }
+inline int f4932_25(int x) { return x * 25; }
+inline int f4932_26(int x) { return x * 26; }
+inline int f4932_27(int x) { return x * 27; }
+inline int f4932_28(int x) { return x * 28; }
+inline int f4932_29(int x) { return x * 29; }
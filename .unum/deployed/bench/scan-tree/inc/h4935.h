@@ -0,0 +1,42 @@
+#pragma once
+/* header 4935 */
+#include <vector>
+#include "h1088.h"
+#include "h9472.h"
+#include "h1275.h"
+#include "h2663.h"
+#include "h7006.h"
+#ifdef X
+#include "h7268.h"
+#endif
+struct S4935 { int a; const char *s = "x//y"; };
+inline int f4935_0(int x) { return x * 0; }
+inline int f4935_1(int x) { return x * 1; }
+inline int f4935_2(int x) { return x * 2; }
+inline int f4935_3(int x) { return x * 3; }
+inline int f4935_4(int x) { return x * 4; }
+inline int f4935_5(int x) { return x * 5; }
+inline int f4935_6(int x) { return x * 6; }
+inline int f4935_7(int x) { return x * 7; }
+inline int f4935_8(int x) { return x * 8; }
+inline int f4935_9(int x) { return x * 9; }
+inline int f4935_10(int x) { return x * 10; }
+inline int f4935_11(int x) { return x * 11; }
+inline int f4935_12(int x) { return x * 12; }
+inline int f4935_13(int x) { return x * 13; }
+inline int f4935_14(int x) { return x * 14; }
+inline int f4935_15(int x) { return x * 15; }
+inline int f4935_16(int x) { return x * 16; }
+inline int f4935_17(int x) { return x * 17; }
+inline int f4935_18(int x) { return x * 18; }
+inline int f4935_19(int x) { return x * 19; }
+inline int f4935_20(int x) { return x * 20; }
+inline int f4935_21(int x) { return x * 21; }
+inline int f4935_22(int x) { return x * 22; }
+inline int f4935_23(int x) { return x * 23; }
+inline int f4935_24(int x) { return x * 24; }
+inline int f4935_25(int x) { return x * 25; }
+inline int f4935_26(int x) { return x * 26; }
+inline int f4935_27(int x) { return x * 27; }
+inline int f4935_28(int x) { return x * 28; }
+inline int f4935_29(int x) { return x * 29; }
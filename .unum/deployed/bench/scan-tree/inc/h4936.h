@@ -0,0 +1,42 @@
+#pragma once
+/* header 4936 */
+#include <vector>
+#include "h3349.h"
+#include "h1019.h"
+#include "h5003.h"
+#include "h4788.h"
+#include "h9622.h"
+#ifdef X
+#include "h3695.h"
+#endif
+struct S4936 { int a; const char *s = "x//y"; };
+inline int f4936_0(int x) { return x * 0; }
+inline int f4936_1(int x) { return x * 1; }
+inline int f4936_2(int x) { return x * 2; }
+inline int f4936_3(int x) { return x * 3; }
+inline int f4936_4(int x) { return x * 4; }
+inline int f4936_5(int x) { return x * 5; }
+inline int f4936_6(int x) { return x * 6; }
+inline int f4936_7(int x) { return x * 7; }
+inline int f4936_8(int x) { return x * 8; }
+inline int f4936_9(int x) { return x * 9; }
+inline int f4936_10(int x) { return x * 10; }
+inline int f4936_11(int x) { return x * 11; }
+inline int f4936_12(int x) { return x * 12; }
+inline int f4936_13(int x) { return x * 13; }
+inline int f4936_14(int x) { return x * 14; }
+inline int f4936_15(int x) { return x * 15; }
+inline int f4936_16(int x) { return x * 16; }
+inline int f4936_17(int x) { return x * 17; }
+inline int f4936_18(int x) { return x * 18; }
+inline int f4936_19(int x) { return x * 19; }
+inline int f4936_20(int x) { return x * 20; }
+inline int f4936_21(int x) { return x * 21; }
+inline int f4936_22(int x) { return x * 22; }
+inline int f4936_23(int x) { return x * 23; }
+inline int f4936_24(int x) { return x * 24; }
+inline int f4936_25(int x) { return x * 25; }
+inline int f4936_26(int x) { return x * 26; }
+inline int f4936_27(int x) { return x * 27; }
+inline int f4936_28(int x) { return x * 28; }
+inline int f4936_29(int x) { return x * 29; }
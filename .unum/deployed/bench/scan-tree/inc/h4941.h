@@ -0,0 +1,42 @@
+#pragma once
+/* header 4941 */
+#include <vector>
+#include "h1096.h"
+#include "h5768.h"
+#include "h427.h"
+#include "h1929.h"
+#include "h7267.h"
+#ifdef X
+#include "h3670.h"
+#endif
+struct S4941 { int a; const char *s = "x//y"; };
+inline int f4941_0(int x) { return x * 0; }
+inline int f4941_1(int x) { return x * 1; }
+inline int f4941_2(int x) { return x * 2; }
+inline int f4941_3(int x) { return x * 3; }
+inline int f4941_4(int x) { return x * 4; }
+inline int f4941_5(int x) { return x * 5; }
+inline int f4941_6(int x) { return x * 6; }
+inline int f4941_7(int x) { return x * 7; }
+inline int f4941_8(int x) { return x * 8; }
+inline int f4941_9(int x) { return x * 9; }
+inline int f4941_10(int x) { return x * 10; }
+inline int f4941_11(int x) { return x * 11; }
+inline int f4941_12(int x) { return x * 12; }
+inline int f4941_13(int x) { return x * 13; }
+inline int f4941_14(int x) { return x * 14; }
+inline int f4941_15(int x) { return x * 15; }
+inline int f4941_16(int x) { return x * 16; }
+inline int f4941_17(int x) { return x * 17; }
+inline int f4941_18(int x) { return x * 18; }
+inline int f4941_19(int x) { return x * 19; }
+inline int f4941_20(int x) { return x * 20; }
+inline int f4941_21(int x) { return x * 21; }
+inline int f4941_22(int x) { return x * 22; }
+inline int f4941_23(int x) { return x * 23; }
+inline int f4941_24(int x) { return x * 24; }
+inline int f4941_25(int x) { return x * 25; }
+inline int f4941_26(int x) { return x * 26; }
+inline int f4941_27(int x) { return x * 27; }
+inline int f4941_28(int x) { return x * 28; }
+inline int f4941_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4942 */
+#include <vector>
+#include "h6617.h"
+#include "h5145.h"
+#include "h1477.h"
+#include "h9658.h"
+#include "h6187.h"
+#ifdef X
+#include "h6155.h"
+#endif
+struct S4942 { int a; const char *s = "x//y"; };
+inline int f4942_0(int x) { return x * 0; }
+inline int f4942_1(int x) { return x * 1; }
+inline int f4942_2(int x) { return x * 2; }
+inline int f4942_3(int x) { return x * 3; }
+inline int f4942_4(int x) { return x * 4; }
+inline int f4942_5(int x) { return x * 5; }
+inline int f4942_6(int x) { return x * 6; }
+inline int f4942_7(int x) { return x * 7; }
+inline int f4942_8(int x) { return x * 8; }
+inline int f4942_9(int x) { return x * 9; }
+inline int f4942_10(int x) { return x * 10; }
+inline int f4942_11(int x) { return x * 11; }
+inline int f4942_12(int x) { return x * 12; }
+inline int f4942_13(int x) { return x * 13; }
+inline int f4942_14(int x) { return x * 14; }
+inline int f4942_15(int x) { return x * 15; }
+inline int f4942_16(int x) { return x * 16; }
+inline int f4942_17(int x) { return x * 17; }
+inline int f4942_18(int x) { return x * 18; }
+inline int f4942_19(int x) { return x * 19; }
+inline int f4942_20(int x) { return x * 20; }
+inline int f4942_21(int x) { return x * 21; }
+inline int f4942_22(int x) { return x * 22; }
+inline int f4942_23(int x) { return x * 23; }
+inline int f4942_24(int x) { return x * 24; }
+inline int f4942_25(int x) { return x * 25; }
+inline int f4942_26(int x) { return x * 26; }
+inline int f4942_27(int x) { return x * 27; }
+inline int f4942_28(int x) { return x * 28; }
+inline int f4942_29(int x) { return x * 29; }
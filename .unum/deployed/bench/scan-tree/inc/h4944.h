@@ -0,0 +1,42 @@
+#pragma once
+/* header 4944 */
+#include <vector>
+#include "h7803.h"
+#include "h5753.h"
+#include "h798.h"
+#include "h7021.h"
+#include "h7936.h"
+#ifdef X
+#include "h4327.h"
+#endif
+struct S4944 { int a; const char *s = "x//y"; };
+inline int f4944_0(int x) { return x * 0; }
+inline int f4944_1(int x) { return x * 1; }
+inline int f4944_2(int x) { return x * 2; }
+inline int f4944_3(int x) { return x * 3; }
+inline int f4944_4(int x) { return x * 4; }
+inline int f4944_5(int x) { return x * 5; }
+inline int f4944_6(int x) { return x * 6; }
+inline int f4944_7(int x) { return x * 7; }
+inline int f4944_8(int x) { return x * 8; }
+inline int f4944_9(int x) { return x * 9; }
+inline int f4944_10(int x) { return x * 10; }
+inline int f4944_11(int x) { return x * 11; }
+inline int f4944_12(int x) { return x * 12; }
+inline int f4944_13(int x) { return x * 13; }
+inline int f4944_14(int x) { return x * 14; }
+inline int f4944_15(int x) { return x * 15; }
+inline int f4944_16(int x) { return x * 16; }
+inline int f4944_17(int x) { return x * 17; }
+inline int f4944_18(int x) { return x * 18; }
+inline int f4944_19(int x) { return x * 19; }
+inline int f4944_20(int x) { return x * 20; }
+inline int f4944_21(int x) { return x * 21; }
+inline int f4944_22(int x) { return x * 22; }
+inline int f4944_23(int x) { return x * 23; }
+inline int f4944_24(int x) { return x * 24; }
+inline int f4944_25(int x) { return x * 25; }
+inline int f4944_26(int x) { return x * 26; }
+inline int f4944_27(int x) { return x * 27; }
+inline int f4944_28(int x) { return x * 28; }
+inline int f4944_29(int x) { return x * 29; }
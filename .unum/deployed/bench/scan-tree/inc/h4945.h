@@ -0,0 +1,42 @@
+#pragma once
+/* header 4945 */
+#include <vector>
+#include "h1299.h"
+#include "h3152.h"
+#include "h524.h"
+#include "h4431.h"
+#include "h8950.h"
+#ifdef X
+#include "h9128.h"
+#endif
+struct S4945 { int a; const char *s = "x//y"; };
+inline int f4945_0(int x) { return x * 0; }
+inline int f4945_1(int x) { return x * 1; }
+inline int f4945_2(int x) { return x * 2; }
+inline int f4945_3(int x) { return x * 3; }
+inline int f4945_4(int x) { return x * 4; }
+inline int f4945_5(int x) { return x * 5; }
+inline int f4945_6(int x) { return x * 6; }
+inline int f4945_7(int x) { return x * 7; }
+inline int f4945_8(int x) { return x * 8; }
+inline int f4945_9(int x) { return x * 9; }
+inline int f4945_10(int x) { return x * 10; }
+inline int f4945_11(int x) { return x * 11; }
+inline int f4945_12(int x) { return x * 12; }
+inline int f4945_13(int x) { return x * 13; }
+inline int f4945_14(int x) { return x * 14; }
+inline int f4945_15(int x) { return x * 15; }
+inline int f4945_16(int x) { return x * 16; }
+inline int f4945_17(int x) { return x * 17; }
+inline int f4945_18(int x) { return x * 18; }
+inline int f4945_19(int x) { return x * 19; }
+inline int f4945_20(int x) { return x * 20; }
+inline int f4945_21(int x) { return x * 21; }
+inline int f4945_22(int x) { return x * 22; }
+inline int f4945_23(int x) { return x * 23; }
+inline int f4945_24(int x) { return x * 24; }
+inline int f4945_25(int x) { return x * 25; }
+inline int f4945_26(int x) { return x * 26; }
+inline int f4945_27(int x) { return x * 27; }
+inline int f4945_28(int x) { return x * 28; }
+inline int f4945_29(int x) { return x * 29; }
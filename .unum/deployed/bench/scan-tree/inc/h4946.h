@@ -0,0 +1,42 @@
+#pragma once
+/* header 4946 */
+#include <vector>
+#include "h4126.h"
+#include "h9197.h"
+#include "h3071.h"
+#include "h7052.h"
+#include "h7418.h"
+#ifdef X
+#include "h5894.h"
+#endif
+struct S4946 { int a; const char *s = "x//y"; };
+inline int f4946_0(int x) { return x * 0; }
+inline int f4946_1(int x) { return x * 1; }
+inline int f4946_2(int x) { return x * 2; }
+inline int f4946_3(int x) { return x * 3; }
+inline int f4946_4(int x) { return x * 4; }
+inline int f4946_5(int x) { return x * 5; }
+inline int f4946_6(int x) { return x * 6; }
+inline int f4946_7(int x) { return x * 7; }
+inline int f4946_8(int x) { return x * 8; }
+inline int f4946_9(int x) { return x * 9; }
+inline int f4946_10(int x) { return x * 10; }
+inline int f4946_11(int x) { return x * 11; }
+inline int f4946_12(int x) { return x * 12; }
+inline int f4946_13(int x) { return x * 13; }
+inline int f4946_14(int x) { return x * 14; }
+inline int f4946_15(int x) { return x * 15; }
+inline int f4946_16(int x) { return x * 16; }
+inline int f4946_17(int x) { return x * 17; }
+inline int f4946_18(int x) { return x * 18; }
+inline int f4946_19(int x) { return x * 19; }
+inline int f4946_20(int x) { return x * 20; }
+inline int f4946_21(int x) { return x * 21; }
+inline int f4946_22(int x) { return x * 22; }
+inline int f4946_23(int x) { return x * 23; }
+inline int f4946_24(int x) { return x * 24; }
+inline int f4946_25(int x) { return x * 25; }
+inline int f4946_26(int x) { return x * 26; }
+inline int f4946_27(int x) { return x * 27; }
+inline int f4946_28(int x) { return x * 28; }
+inline int f4946_29(int x) { return x * 29; }
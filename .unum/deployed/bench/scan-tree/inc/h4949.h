@@ -0,0 +1,42 @@
+#pragma once
+/* header 4949 */
+#include <vector>
+#include "h587.h"
+#include "h1162.h"
+#include "h7381.h"
+#include "h104.h"
+#include "h8188.h"
+#ifdef X
+#include "h8212.h"
+#endif
+struct S4949 { int a; const char *s = "x//y"; };
+inline int f4949_0(int x) { return x * 0; }
+inline int f4949_1(int x) { return x * 1; }
+inline int f4949_2(int x) { return x * 2; }
+inline int f4949_3(int x) { return x * 3; }
+inline int f4949_4(int x) { return x * 4; }
+inline int f4949_5(int x) { return x * 5; }
+inline int f4949_6(int x) { return x * 6; }
+inline int f4949_7(int x) { return x * 7; }
+inline int f4949_8(int x) { return x * 8; }
+inline int f4949_9(int x) { return x * 9; }
+inline int f4949_10(int x) { return x * 10; }
+inline int f4949_11(int x) { return x * 11; }
+inline int f4949_12(int x) { return x * 12; }
+inline int f4949_13(int x) { return x * 13; }
+inline int f4949_14(int x) { return x * 14; }
+inline int f4949_15(int x) { return x * 15; }
+inline int f4949_16(int x) { return x * 16; }
+inline int f4949_17(int x) { return x * 17; }
+inline int f4949_18(int x) { return x * 18; }
+inline int f4949_19(int x) { return x * 19; }
+inline int f4949_20(int x) { return x * 20; }
+inline int f4949_21(int x) { return x * 21; }
+inline int f4949_22(int x) { return x * 22; }
+inline int f4949_23(int x) { return x * 23; }
+inline int f4949_24(int x) { return x * 24; }
+inline int f4949_25(int x) { return x * 25; }
+inline int f4949_26(int x) { return x * 26; }
+inline int f4949_27(int x) { return x * 27; }
+inline int f4949_28(int x) { return x * 28; }
+inline int f4949_29(int x) { return x * 29; }
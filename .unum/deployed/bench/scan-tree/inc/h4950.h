@@ -0,0 +1,42 @@
+#pragma once
+/* header 4950 */
+#include <vector>
+#include "h1463.h"
+#include "h2516.h"
+#include "h3279.h"
+#include "h4073.h"
+#include "h1639.h"
+#ifdef X
+#include "h2109.h"
+#endif
+struct S4950 { int a; const char *s = "x//y"; };
+inline int f4950_0(int x) { return x * 0; }
+inline int f4950_1(int x) { return x * 1; }
+inline int f4950_2(int x) { return x * 2; }
+inline int f4950_3(int x) { return x * 3; }
+inline int f4950_4(int x) { return x * 4; }
+inline int f4950_5(int x) { return x * 5; }
+inline int f4950_6(int x) { return x * 6; }
+inline int f4950_7(int x) { return x * 7; }
+inline int f4950_8(int x) { return x * 8; }
+inline int f4950_9(int x) { return x * 9; }
+inline int f4950_10(int x) { return x * 10; }
+inline int f4950_11(int x) { return x * 11; }
+inline int f4950_12(int x) { return x * 12; }
+inline int f4950_13(int x) { return x * 13; }
+inline int f4950_14(int x) { return x * 14; }
+inline int f4950_15(int x) { return x * 15; }
+inline int f4950_16(int x) { return x * 16; }
+inline int f4950_17(int x) { return x * 17; }
+inline int f4950_18(int x) { return x * 18; }
+inline int f4950_19(int x) { return x * 19; }
+inline int f4950_20(int x) { return x * 20; }
+inline int f4950_21(int x) { return x * 21; }
+inline int f4950_22(int x) { return x * 22; }
+inline int f4950_23(int x) { return x * 23; }
+inline int f4950_24(int x) { return x * 24; }
+inline int f4950_25(int x) { return x * 25; }
+inline int f4950_26(int x) { return x * 26; }
+inline int f4950_27(int x) { return x * 27; }
+inline int f4950_28(int x) { return x * 28; }
+inline int f4950_29(int x) { return x * 29; }
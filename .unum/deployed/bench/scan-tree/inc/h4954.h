@@ -0,0 +1,42 @@
+#pragma once
+/* header 4954 */
+#include <vector>
+#include "h850.h"
+#include "h6230.h"
+#include "h4568.h"
+#include "h4950.h"
+#include "h2221.h"
+#ifdef X
+#include "h8653.h"
+#endif
+struct S4954 { int a; const char *s = "x//y"; };
+inline int f4954_0(int x) { return x * 0; }
+inline int f4954_1(int x) { return x * 1; }
+inline int f4954_2(int x) { return x * 2; }
+inline int f4954_3(int x) { return x * 3; }
+inline int f4954_4(int x) { return x * 4; }
+inline int f4954_5(int x) { return x * 5; }
+inline int f4954_6(int x) { return x * 6; }
+inline int f4954_7(int x) { return x * 7; }
+inline int f4954_8(int x) { return x * 8; }
+inline int f4954_9(int x) { return x * 9; }
+inline int f4954_10(int x) { return x * 10; }
+inline int f4954_11(int x) { return x * 11; }
+inline int f4954_12(int x) { return x * 12; }
+inline int f4954_13(int x) { return x * 13; }
+inline int f4954_14(int x) { return x * 14; }
+inline int f4954_15(int x) { return x * 15; }
+inline int f4954_16(int x) { return x * 16; }
+inline int f4954_17(int x) { return x * 17; }
+inline int f4954_18(int x) { return x * 18; }
+inline int f4954_19(int x) { return x * 19; }
+inline int f4954_20(int x) { return x * 20; }
+inline int f4954_21(int x) { return x * 21; }
+inline int f4954_22(int x) { return x * 22; }
+inline int f4954_23(int x) { return x * 23; }
+inline int f4954_24(int x) { return x * 24; }
+inline int f4954_25(int x) { return x * 25; }
+inline int f4954_26(int x) { return x * 26; }
+inline int f4954_27(int x) { return x * 27; }
+inline int f4954_28(int x) { return x * 28; }
+inline int f4954_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4958 */
+#include <vector>
+#include "h3311.h"
+#include "h8746.h"
+#include "h8530.h"
+#include "h8455.h"
+#include "h2408.h"
+#ifdef X
+#include "h4696.h"
+#endif
+struct S4958 { int a; const char *s = "x//y"; };
+inline int f4958_0(int x) { return x * 0; }
+inline int f4958_1(int x) { return x * 1; }
+inline int f4958_2(int x) { return x * 2; }
+inline int f4958_3(int x) { return x * 3; }
+inline int f4958_4(int x) { return x * 4; }
+inline int f4958_5(int x) { return x * 5; }
+inline int f4958_6(int x) { return x * 6; }
+inline int f4958_7(int x) { return x * 7; }
+inline int f4958_8(int x) { return x * 8; }
+inline int f4958_9(int x) { return x * 9; }
+inline int f4958_10(int x) { return x * 10; }
+inline int f4958_11(int x) { return x * 11; }
+inline int f4958_12(int x) { return x * 12; }
+inline int f4958_13(int x) { return x * 13; }
+inline int f4958_14(int x) { return x * 14; }
+inline int f4958_15(int x) { return x * 15; }
+inline int f4958_16(int x) { return x * 16; }
+inline int f4958_17(int x) { return x * 17; }
+inline int f4958_18(int x) { return x * 18; }
+inline int f4958_19(int x) { return x * 19; }
+inline int f4958_20(int x) { return x * 20; }
+inline int f4958_21(int x) { return x * 21; }
+inline int f4958_22(int x) { return x * 22; }
+inline int f4958_23(int x) { return x * 23; }
+inline int f4958_24(int x) { return x * 24; }
+inline int f4958_25(int x) { return x * 25; }
+inline int f4958_26(int x) { return x * 26; }
+inline int f4958_27(int x) { return x * 27; }
+inline int f4958_28(int x) { return x * 28; }
+inline int f4958_29(int x) { return x * 29; }
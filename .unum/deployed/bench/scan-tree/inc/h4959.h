@@ -0,0 +1,42 @@
+#pragma once
+/* header 4959 */
+#include <vector>
+#include "h9574.h"
+#include "h7311.h"
+#include "h4154.h"
+#include "h7909.h"
+#include "h2622.h"
+#ifdef X
+#include "h5951.h"
+#endif
+struct S4959 { int a; const char *s = "x//y"; };
+inline int f4959_0(int x) { return x * 0; }
+inline int f4959_1(int x) { return x * 1; }
+inline int f4959_2(int x) { return x * 2; }
+inline int f4959_3(int x) { return x * 3; }
+inline int f4959_4(int x) { return x * 4; }
+inline int f4959_5(int x) { return x * 5; }
+inline int f4959_6(int x) { return x * 6; }
+inline int f4959_7(int x) { return x * 7; }
+inline int f4959_8(int x) { return x * 8; }
+inline int f4959_9(int x) { return x * 9; }
+inline int f4959_10(int x) { return x * 10; }
+inline int f4959_11(int x) { return x * 11; }
+inline int f4959_12(int x) { return x * 12; }
+inline int f4959_13(int x) { return x * 13; }
+inline int f4959_14(int x) { return x * 14; }
+inline int f4959_15(int x) { return x * 15; }
+inline int f4959_16(int x) { return x * 16; }
+inline int f4959_17(int x) { return x * 17; }
+inline int f4959_18(int x) { return x * 18; }
+inline int f4959_19(int x) { return x * 19; }
+inline int f4959_20(int x) { return x * 20; }
+inline int f4959_21(int x) { return x * 21; }
+inline int f4959_22(int x) { return x * 22; }
+inline int f4959_23(int x) { return x * 23; }
+inline int f4959_24(int x) { return x * 24; }
+inline int f4959_25(int x) { return x * 25; }
+inline int f4959_26(int x) { return x * 26; }
+inline int f4959_27(int x) { return x * 27; }
+inline int f4959_28(int x) { return x * 28; }
+inline int f4959_29(int x) { return x * 29; }
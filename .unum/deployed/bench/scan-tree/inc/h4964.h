@@ -0,0 +1,42 @@
+#pragma once
+/* header 4964 */
+#include <vector>
+#include "h2106.h"
+#include "h3235.h"
+#include "h737.h"
+#include "h6814.h"
+#include "h8604.h"
+#ifdef X
+#include "h6063.h"
+#endif
+struct S4964 { int a; const char *s = "x//y"; };
+inline int f4964_0(int x) { return x * 0; }
+inline int f4964_1(int x) { return x * 1; }
+inline int f4964_2(int x) { return x * 2; }
+inline int f4964_3(int x) { return x * 3; }
+inline int f4964_4(int x) { return x * 4; }
+inline int f4964_5(int x) { return x * 5; }
+inline int f4964_6(int x) { return x * 6; }
+inline int f4964_7(int x) { return x * 7; }
+inline int f4964_8(int x) { return x * 8; }
+inline int f4964_9(int x) { return x * 9; }
+inline int f4964_10(int x) { return x * 10; }
+inline int f4964_11(int x) { return x * 11; }
+inline int f4964_12(int x) { return x * 12; }
+inline int f4964_13(int x) { return x * 13; }
+inline int f4964_14(int x) { return x * 14; }
+inline int f4964_15(int x) { return x * 15; }
+inline int f4964_16(int x) { return x * 16; }
+inline int f4964_17(int x) { return x * 17; }
+inline int f4964_18(int x) { return x * 18; }
+inline int f4964_19(int x) { return x * 19; }
+inline int f4964_20(int x) { return x * 20; }
+inline int f4964_21(int x) { return x * 21; }
+inline int f4964_22(int x) { return x * 22; }
+inline int f4964_23(int x) { return x * 23; }
+inline int f4964_24(int x) { return x * 24; }
+inline int f4964_25(int x) { return x * 25; }
+inline int f4964_26(int x) { return x * 26; }
+inline int f4964_27(int x) { return x * 27; }
+inline int f4964_28(int x) { return x * 28; }
+inline int f4964_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4969 */
+#include <vector>
+#include "h4169.h"
+#include "h5623.h"
+#include "h7406.h"
+#include "h5545.h"
+#include "h312.h"
+#ifdef X
+#include "h3915.h"
+#endif
+struct S4969 { int a; const char *s = "x//y"; };
+inline int f4969_0(int x) { return x * 0; }
+inline int f4969_1(int x) { return x * 1; }
+inline int f4969_2(int x) { return x * 2; }
+inline int f4969_3(int x) { return x * 3; }
+inline int f4969_4(int x) { return x * 4; }
+inline int f4969_5(int x) { return x * 5; }
+inline int f4969_6(int x) { return x * 6; }
+inline int f4969_7(int x) { return x * 7; }
+inline int f4969_8(int x) { return x * 8; }
+inline int f4969_9(int x) { return x * 9; }
+inline int f4969_10(int x) { return x * 10; }
+inline int f4969_11(int x) { return x * 11; }
+inline int f4969_12(int x) { return x * 12; }
+inline int f4969_13(int x) { return x * 13; }
+inline int f4969_14(int x) { return x * 14; }
+inline int f4969_15(int x) { return x * 15; }
+inline int f4969_16(int x) { return x * 16; }
+inline int f4969_17(int x) { return x * 17; }
+inline int f4969_18(int x) { return x * 18; }
+inline int f4969_19(int x) { return x * 19; }
+inline int f4969_20(int x) { return x * 20; }
+inline int f4969_21(int x) { return x * 21; }
+inline int f4969_22(int x) { return x * 22; }
+inline int f4969_23(int x) { return x * 23; }
+inline int f4969_24(int x) { return x * 24; }
+inline int f4969_25(int x) { return x * 25; }
+inline int f4969_26(int x) { return x * 26; }
+inline int f4969_27(int x) { return x * 27; }
+inline int f4969_28(int x) { return x * 28; }
+inline int f4969_29(int x) { return x * 29; }
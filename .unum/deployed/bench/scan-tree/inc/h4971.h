@@ -0,0 +1,42 @@
+#pragma once
+/* header 4971 */
+#include <vector>
+#include "h8392.h"
+#include "h9334.h"
+#include "h5027.h"
+#include "h1881.h"
+#include "h9599.h"
+#ifdef X
+#include "h2573.h"
+#endif
+struct S4971 { int a; const char *s = "x//y"; };
+inline int f4971_0(int x) { return x * 0; }
+inline int f4971_1(int x) { return x * 1; }
+inline int f4971_2(int x) { return x * 2; }
+inline int f4971_3(int x) { return x * 3; }
+inline int f4971_4(int x) { return x * 4; }
+inline int f4971_5(int x) { return x * 5; }
+inline int f4971_6(int x) { return x * 6; }
+inline int f4971_7(int x) { return x * 7; }
+inline int f4971_8(int x) { return x * 8; }
+inline int f4971_9(int x) { return x * 9; }
+inline int f4971_10(int x) { return x * 10; }
+inline int f4971_11(int x) { return x * 11; }
+inline int f4971_12(int x) { return x * 12; }
+inline int f4971_13(int x) { return x * 13; }
+inline int f4971_14(int x) { return x * 14; }
+inline int f4971_15(int x) { return x * 15; }
+inline int f4971_16(int x) { return x * 16; }
+inline int f4971_17(int x) { return x * 17; }
+inline int f4971_18(int x) { return x * 18; }
+inline int f4971_19(int x) { return x * 19; }
+inline int f4971_20(int x) { return x * 20; }
+inline int f4971_21(int x) { return x * 21; }
+inline int f4971_22(int x) { return x * 22; }
+inline int f4971_23(int x) { return x * 23; }
+inline int f4971_24(int x) { return x * 24; }
+inline int f4971_25(int x) { return x * 25; }
+inline int f4971_26(int x) { return x * 26; }
+inline int f4971_27(int x) { return x * 27; }
+inline int f4971_28(int x) { return x * 28; }
+inline int f4971_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4974 */
+#include <vector>
+#include "h9842.h"
+#include "h7286.h"
+#include "h3575.h"
+#include "h4570.h"
+#include "h1303.h"
+#ifdef X
+#include "h18.h"
+#endif
+struct S4974 { int a; const char *s = "x//y"; };
+inline int f4974_0(int x) { return x * 0; }
+inline int f4974_1(int x) { return x * 1; }
+inline int f4974_2(int x) { return x * 2; }
+inline int f4974_3(int x) { return x * 3; }
+inline int f4974_4(int x) { return x * 4; }
+inline int f4974_5(int x) { return x * 5; }
+inline int f4974_6(int x) { return x * 6; }
+inline int f4974_7(int x) { return x * 7; }
+inline int f4974_8(int x) { return x * 8; }
+inline int f4974_9(int x) { return x * 9; }
+inline int f4974_10(int x) { return x * 10; }
+inline int f4974_11(int x) { return x * 11; }
+inline int f4974_12(int x) { return x * 12; }
+inline int f4974_13(int x) { return x * 13; }
+inline int f4974_14(int x) { return x * 14; }
+inline int f4974_15(int x) { return x * 15; }
+inline int f4974_16(int x) { return x * 16; }
+inline int f4974_17(int x) { return x * 17; }
+inline int f4974_18(int x) { return x * 18; }
+inline int f4974_19(int x) { return x * 19; }
+inline int f4974_20(int x) { return x * 20; }
+inline int f4974_21(int x) { return x * 21; }
+inline int f4974_22(int x) { return x * 22; }
+inline int f4974_23(int x) { return x * 23; }
+inline int f4974_24(int x) { return x * 24; }
+inline int f4974_25(int x) { return x * 25; }
+inline int f4974_26(int x) { return x * 26; }
+inline int f4974_27(int x) { return x * 27; }
+inline int f4974_28(int x) { return x * 28; }
+inline int f4974_29(int x) { return x * 29; }
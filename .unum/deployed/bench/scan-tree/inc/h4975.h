@@ -0,0 +1,42 @@
+#pragma once
+/* header 4975 */
+#include <vector>
+#include "h9463.h"
+#include "h2615.h"
+#include "h405.h"
+#include "h5786.h"
+#include "h6762.h"
+#ifdef X
+#include "h3065.h"
+#endif
+struct S4975 { int a; const char *s = "x//y"; };
+inline int f4975_0(int x) { return x * 0; }
+inline int f4975_1(int x) { return x * 1; }
+inline int f4975_2(int x) { return x * 2; }
+inline int f4975_3(int x) { return x * 3; }
+inline int f4975_4(int x) { return x * 4; }
+inline int f4975_5(int x) { return x * 5; }
+inline int f4975_6(int x) { return x * 6; }
+inline int f4975_7(int x) { return x * 7; }
+inline int f4975_8(int x) { return x * 8; }
+inline int f4975_9(int x) { return x * 9; }
+inline int f4975_10(int x) { return x * 10; }
+inline int f4975_11(int x) { return x * 11; }
+inline int f4975_12(int x) { return x * 12; }
+inline int f4975_13(int x) { return x * 13; }
+inline int f4975_14(int x) { return x * 14; }
+inline int f4975_15(int x) { return x * 15; }
+inline int f4975_16(int x) { return x * 16; }
+inline int f4975_17(int x) { return x * 17; }
+inline int f4975_18(int x) { return x * 18; }
+inline int f4975_19(int x) { return x * 19; }
+inline int f4975_20(int x) { return x * 20; }
+inline int f4975_21(int x) { return x * 21; }
+inline int f4975_22(int x) { return x * 22; }
+inline int f4975_23(int x) { return x * 23; }
+inline int f4975_24(int x) { return x * 24; }
+inline int f4975_25(int x) { return x * 25; }
+inline int f4975_26(int x) { return x * 26; }
+inline int f4975_27(int x) { return x * 27; }
+inline int f4975_28(int x) { return x * 28; }
+inline int f4975_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4976 */
+#include <vector>
+#include "h4356.h"
+#include "h8088.h"
+#include "h7961.h"
+#include "h983.h"
+#include "h6046.h"
+#ifdef X
+#include "h7408.h"
+#endif
+struct S4976 { int a; const char *s = "x//y"; };
+inline int f4976_0(int x) { return x * 0; }
+inline int f4976_1(int x) { return x * 1; }
+inline int f4976_2(int x) { return x * 2; }
+inline int f4976_3(int x) { return x * 3; }
+inline int f4976_4(int x) { return x * 4; }
+inline int f4976_5(int x) { return x * 5; }
+inline int f4976_6(int x) { return x * 6; }
+inline int f4976_7(int x) { return x * 7; }
+inline int f4976_8(int x) { return x * 8; }
+inline int f4976_9(int x) { return x * 9; }
+inline int f4976_10(int x) { return x * 10; }
+inline int f4976_11(int x) { return x * 11; }
+inline int f4976_12(int x) { return x * 12; }
+inline int f4976_13(int x) { return x * 13; }
+inline int f4976_14(int x) { return x * 14; }
+inline int f4976_15(int x) { return x * 15; }
+inline int f4976_16(int x) { return x * 16; }
+inline int f4976_17(int x) { return x * 17; }
+inline int f4976_18(int x) { return x * 18; }
+inline int f4976_19(int x) { return x * 19; }
+inline int f4976_20(int x) { return x * 20; }
+inline int f4976_21(int x) { return x * 21; }
+inline int f4976_22(int x) { return x * 22; }
+inline int f4976_23(int x) { return x * 23; }
+inline int f4976_24(int x) { return x * 24; }
+inline int f4976_25(int x) { return x * 25; }
+inline int f4976_26(int x) { return x * 26; }
+inline int f4976_27(int x) { return x * 27; }
+inline int f4976_28(int x) { return x * 28; }
+inline int f4976_29(int x) { return x * 29; }
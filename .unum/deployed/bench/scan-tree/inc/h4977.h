@@ -0,0 +1,42 @@
+#pragma once
+/* header 4977 */
+#include <vector>
+#include "h2454.h"
+#include "h1079.h"
+#include "h558.h"
+#include "h5380.h"
+#include "h2011.h"
+#ifdef X
+#include "h263.h"
+#endif
+struct S4977 { int a; const char *s = "x//y"; };
+inline int f4977_0(int x) { return x * 0; }
+inline int f4977_1(int x) { return x * 1; }
+inline int f4977_2(int x) { return x * 2; }
+inline int f4977_3(int x) { return x * 3; }
+inline int f4977_4(int x) { return x * 4; }
+inline int f4977_5(int x) { return x * 5; }
+inline int f4977_6(int x) { return x * 6; }
+inline int f4977_7(int x) { return x * 7; }
+inline int f4977_8(int x) { return x * 8; }
+inline int f4977_9(int x) { return x * 9; }
+inline int f4977_10(int x) { return x * 10; }
+inline int f4977_11(int x) { return x * 11; }
+inline int f4977_12(int x) { return x * 12; }
+inline int f4977_13(int x) { return x * 13; }
+inline int f4977_14(int x) { return x * 14; }
+inline int f4977_15(int x) { return x * 15; }
+inline int f4977_16(int x) { return x * 16; }
+inline int f4977_17(int x) { return x * 17; }
+inline int f4977_18(int x) { return x * 18; }
+inline int f4977_19(int x) { return x * 19; }
+inline int f4977_20(int x) { return x * 20; }
+inline int f4977_21(int x) { return x * 21; }
+inline int f4977_22(int x) { return x * 22; }
+inline int f4977_23(int x) { return x * 23; }
+inline int f4977_24(int x) { return x * 24; }
+inline int f4977_25(int x) { return x * 25; }
+inline int f4977_26(int x) { return x * 26; }
+inline int f4977_27(int x) { return x * 27; }
+inline int f4977_28(int x) { return x * 28; }
+inline int f4977_29(int x) { return x * 29; }
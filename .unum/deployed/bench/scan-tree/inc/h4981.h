@@ -0,0 +1,42 @@
+#pragma once
+/* header 4981 */
+#include <vector>
+#include "h7408.h"
+#include "h5780.h"
+#include "h299.h"
+#include "h5990.h"
+#include "h9578.h"
+#ifdef X
+#include "h3976.h"
+#endif
+struct S4981 { int a; const char *s = "x//y"; };
+inline int f4981_0(int x) { return x * 0; }
+inline int f4981_1(int x) { return x * 1; }
+inline int f4981_2(int x) { return x * 2; }
+inline int f4981_3(int x) { return x * 3; }
+inline int f4981_4(int x) { return x * 4; }
+inline int f4981_5(int x) { return x * 5; }
+inline int f4981_6(int x) { return x * 6; }
+inline int f4981_7(int x) { return x * 7; }
+inline int f4981_8(int x) { return x * 8; }
+inline int f4981_9(int x) { return x * 9; }
+inline int f4981_10(int x) { return x * 10; }
+inline int f4981_11(int x) { return x * 11; }
+inline int f4981_12(int x) { return x * 12; }
+inline int f4981_13(int x) { return x * 13; }
+inline int f4981_14(int x) { return x * 14; }
+inline int f4981_15(int x) { return x * 15; }
+inline int f4981_16(int x) { return x * 16; }
+inline int f4981_17(int x) { return x * 17; }
+inline int f4981_18(int x) { return x * 18; }
+inline int f4981_19(int x) { return x * 19; }
+inline int f4981_20(int x) { return x * 20; }
+inline int f4981_21(int x) { return x * 21; }
+inline int f4981_22(int x) { return x * 22; }
+inline int f4981_23(int x) { return x * 23; }
+inline int f4981_24(int x) { return x * 24; }
+inline int f4981_25(int x) { return x * 25; }
+inline int f4981_26(int x) { return x * 26; }
+inline int f4981_27(int x) { return x * 27; }
+inline int f4981_28(int x) { return x * 28; }
+inline int f4981_29(int x) { return x * 29; }
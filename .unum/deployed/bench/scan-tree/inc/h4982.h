@@ -0,0 +1,42 @@
+#pragma once
+/* header 4982 */
+#include <vector>
+#include "h7923.h"
+#include "h3832.h"
+#include "h9315.h"
+#include "h2259.h"
+#include "h3998.h"
+#ifdef X
+#include "h658.h"
+#endif
+struct S4982 { int a; const char *s = "x//y"; };
+inline int f4982_0(int x) { return x * 0; }
+inline int f4982_1(int x) { return x * 1; }
+inline int f4982_2(int x) { return x * 2; }
+inline int f4982_3(int x) { return x * 3; }
+inline int f4982_4(int x) { return x * 4; }
+inline int f4982_5(int x) { return x * 5; }
+inline int f4982_6(int x) { return x * 6; }
+inline int f4982_7(int x) { return x * 7; }
+inline int f4982_8(int x) { return x * 8; }
+inline int f4982_9(int x) { return x * 9; }
+inline int f4982_10(int x) { return x * 10; }
+inline int f4982_11(int x) { return x * 11; }
+inline int f4982_12(int x) { return x * 12; }
+inline int f4982_13(int x) { return x * 13; }
+inline int f4982_14(int x) { return x * 14; }
+inline int f4982_15(int x) { return x * 15; }
+inline int f4982_16(int x) { return x * 16; }
+inline int f4982_17(int x) { return x * 17; }
+inline int f4982_18(int x) { return x * 18; }
+inline int f4982_19(int x) { return x * 19; }
+inline int f4982_20(int x) { return x * 20; }
+inline int f4982_21(int x) { return x * 21; }
+inline int f4982_22(int x) { return x * 22; }
+inline int f4982_23(int x) { return x * 23; }
+inline int f4982_24(int x) { return x * 24; }
+inline int f4982_25(int x) { return x * 25; }
+inline int f4982_26(int x) { return x * 26; }
+inline int f4982_27(int x) { return x * 27; }
+inline int f4982_28(int x) { return x * 28; }
+inline int f4982_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4983 */
+#include <vector>
+#include "h2719.h"
+#include "h3416.h"
+#include "h9391.h"
+#include "h7780.h"
+#include "h2675.h"
+#ifdef X
+#include "h2886.h"
+#endif
+struct S4983 { int a; const char *s = "x//y"; };
+inline int f4983_0(int x) { return x * 0; }
+inline int f4983_1(int x) { return x * 1; }
+inline int f4983_2(int x) { return x * 2; }
+inline int f4983_3(int x) { return x * 3; }
+inline int f4983_4(int x) { return x * 4; }
+inline int f4983_5(int x) { return x * 5; }
+inline int f4983_6(int x) { return x * 6; }
+inline int f4983_7(int x) { return x * 7; }
+inline int f4983_8(int x) { return x * 8; }
+inline int f4983_9(int x) { return x * 9; }
+inline int f4983_10(int x) { return x * 10; }
+inline int f4983_11(int x) { return x * 11; }
+inline int f4983_12(int x) { return x * 12; }
+inline int f4983_13(int x) { return x * 13; }
+inline int f4983_14(int x) { return x * 14; }
+inline int f4983_15(int x) { return x * 15; }
+inline int f4983_16(int x) { return x * 16; }
+inline int f4983_17(int x) { return x * 17; }
+inline int f4983_18(int x) { return x * 18; }
+inline int f4983_19(int x) { return x * 19; }
+inline int f4983_20(int x) { return x * 20; }
+inline int f4983_21(int x) { return x * 21; }
+inline int f4983_22(int x) { return x * 22; }
+inline int f4983_23(int x) { return x * 23; }
+inline int f4983_24(int x) { return x * 24; }
+inline int f4983_25(int x) { return x * 25; }
+inline int f4983_26(int x) { return x * 26; }
+inline int f4983_27(int x) { return x * 27; }
+inline int f4983_28(int x) { return x * 28; }
+inline int f4983_29(int x) { return x * 29; }
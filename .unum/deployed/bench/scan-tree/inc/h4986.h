@@ -0,0 +1,42 @@
+#pragma once
+/* header 4986 */
+#include <vector>
+#include "h2418.h"
+#include "h532.h"
+#include "h2892.h"
+#include "h8429.h"
+#include "h6643.h"
+#ifdef X
+#include "h2465.h"
+#endif
+struct S4986 { int a; const char *s = "x//y"; };
+inline int f4986_0(int x) { return x * 0; }
+inline int f4986_1(int x) { return x * 1; }
+inline int f4986_2(int x) { return x * 2; }
+inline int f4986_3(int x) { return x * 3; }
+inline int f4986_4(int x) { return x * 4; }
+inline int f4986_5(int x) { return x * 5; }
+inline int f4986_6(int x) { return x * 6; }
+inline int f4986_7(int x) { return x * 7; }
+inline int f4986_8(int x) { return x * 8; }
+inline int f4986_9(int x) { return x * 9; }
+inline int f4986_10(int x) { return x * 10; }
+inline int f4986_11(int x) { return x * 11; }
+inline int f4986_12(int x) { return x * 12; }
+inline int f4986_13(int x) { return x * 13; }
+inline int f4986_14(int x) { return x * 14; }
+inline int f4986_15(int x) { return x * 15; }
+inline int f4986_16(int x) { return x * 16; }
+inline int f4986_17(int x) { return x * 17; }
+inline int f4986_18(int x) { return x * 18; }
+inline int f4986_19(int x) { return x * 19; }
+inline int f4986_20(int x) { return x * 20; }
+inline int f4986_21(int x) { return x * 21; }
+inline int f4986_22(int x) { return x * 22; }
+inline int f4986_23(int x) { return x * 23; }
+inline int f4986_24(int x) { return x * 24; }
+inline int f4986_25(int x) { return x * 25; }
+inline int f4986_26(int x) { return x * 26; }
+inline int f4986_27(int x) { return x * 27; }
+inline int f4986_28(int x) { return x * 28; }
+inline int f4986_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4987 */
+#include <vector>
+#include "h256.h"
+#include "h3875.h"
+#include "h5549.h"
+#include "h31.h"
+#include "h4000.h"
+#ifdef X
+#include "h3184.h"
+#endif
+struct S4987 { int a; const char *s = "x//y"; };
+inline int f4987_0(int x) { return x * 0; }
+inline int f4987_1(int x) { return x * 1; }
+inline int f4987_2(int x) { return x * 2; }
+inline int f4987_3(int x) { return x * 3; }
+inline int f4987_4(int x) { return x * 4; }
+inline int f4987_5(int x) { return x * 5; }
+inline int f4987_6(int x) { return x * 6; }
+inline int f4987_7(int x) { return x * 7; }
+inline int f4987_8(int x) { return x * 8; }
+inline int f4987_9(int x) { return x * 9; }
+inline int f4987_10(int x) { return x * 10; }
+inline int f4987_11(int x) { return x * 11; }
+inline int f4987_12(int x) { return x * 12; }
+inline int f4987_13(int x) { return x * 13; }
+inline int f4987_14(int x) { return x * 14; }
+inline int f4987_15(int x) { return x * 15; }
+inline int f4987_16(int x) { return x * 16; }
+inline int f4987_17(int x) { return x * 17; }
+inline int f4987_18(int x) { return x * 18; }
+inline int f4987_19(int x) { return x * 19; }
+inline int f4987_20(int x) { return x * 20; }
+inline int f4987_21(int x) { return x * 21; }
+inline int f4987_22(int x) { return x * 22; }
+inline int f4987_23(int x) { return x * 23; }
+inline int f4987_24(int x) { return x * 24; }
+inline int f4987_25(int x) { return x * 25; }
+inline int f4987_26(int x) { return x * 26; }
+inline int f4987_27(int x) { return x * 27; }
+inline int f4987_28(int x) { return x * 28; }
+inline int f4987_29(int x) { return x * 29; }
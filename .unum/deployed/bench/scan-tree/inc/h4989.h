@@ -0,0 +1,42 @@
+#pragma once
+/* header 4989 */
+#include <vector>
+#include "h629.h"
+#include "h3717.h"
+#include "h3895.h"
+#include "h6363.h"
+#include "h7890.h"
+#ifdef X
+#include "h3678.h"
+#endif
+struct S4989 { int a; const char *s = "x//y"; };
+inline int f4989_0(int x) { return x * 0; }
+inline int f4989_1(int x) { return x * 1; }
+inline int f4989_2(int x) { return x * 2; }
+inline int f4989_3(int x) { return x * 3; }
+inline int f4989_4(int x) { return x * 4; }
+inline int f4989_5(int x) { return x * 5; }
+inline int f4989_6(int x) { return x * 6; }
+inline int f4989_7(int x) { return x * 7; }
+inline int f4989_8(int x) { return x * 8; }
+inline int f4989_9(int x) { return x * 9; }
+inline int f4989_10(int x) { return x * 10; }
+inline int f4989_11(int x) { return x * 11; }
+inline int f4989_12(int x) { return x * 12; }
+inline int f4989_13(int x) { return x * 13; }
+inline int f4989_14(int x) { return x * 14; }
+inline int f4989_15(int x) { return x * 15; }
+inline int f4989_16(int x) { return x * 16; }
+inline int f4989_17(int x) { return x * 17; }
+inline int f4989_18(int x) { return x * 18; }
+inline int f4989_19(int x) { return x * 19; }
+inline int f4989_20(int x) { return x * 20; }
+inline int f4989_21(int x) { return x * 21; }
+inline int f4989_22(int x) { return x * 22; }
+inline int f4989_23(int x) { return x * 23; }
+inline int f4989_24(int x) { return x * 24; }
+inline int f4989_25(int x) { return x * 25; }
+inline int f4989_26(int x) { return x * 26; }
+inline int f4989_27(int x) { return x * 27; }
+inline int f4989_28(int x) { return x * 28; }
+inline int f4989_29(int x) { return x * 29; }
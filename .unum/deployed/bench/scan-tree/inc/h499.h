@@ -0,0 +1,42 @@
+#pragma once
+/* header 499 */
+#include <vector>
+#include "h7143.h"
+#include "h53.h"
+#include "h3220.h"
+#include "h9854.h"
+#include "h4077.h"
+#ifdef X
+#include "h7158.h"
+#endif
+struct S499 { int a; const char *s = "x//y"; };
+inline int f499_0(int x) { return x * 0; }
+inline int f499_1(int x) { return x * 1; }
+inline int f499_2(int x) { return x * 2; }
+inline int f499_3(int x) { return x * 3; }
+inline int f499_4(int x) { return x * 4; }
+inline int f499_5(int x) { return x * 5; }
+inline int f499_6(int x) { return x * 6; }
+inline int f499_7(int x) { return x * 7; }
+inline int f499_8(int x) { return x * 8; }
+inline int f499_9(int x) { return x * 9; }
+inline int f499_10(int x) { return x * 10; }
+inline int f499_11(int x) { return x * 11; }
+inline int f499_12(int x) { return x * 12; }
+inline int f499_13(int x) { return x * 13; }
+inline int f499_14(int x) { return x * 14; }
+inline int f499_15(int x) { return x * 15; }
+inline int f499_16(int x) { return x * 16; }
+inline int f499_17(int x) { return x * 17; }
+inline int f499_18(int x) { return x * 18; }
+inline int f499_19(int x) { return x * 19; }
+inline int f499_20(int x) { return x * 20; }
+inline int f499_21(int x) { return x * 21; }
+inline int f499_22(int x) { return x * 22; }
+inline int f499_23(int x) { return x * 23; }
+inline int f499_24(int x) { return x * 24; }
+inline int f499_25(int x) { return x * 25; }
+inline int f499_26(int x) { return x * 26; }
+inline int f499_27(int x) { return x * 27; }
+inline int f499_28(int x) { return x * 28; }
+inline int f499_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4991 */
+#include <vector>
+#include "h4663.h"
+#include "h6032.h"
+#include "h2539.h"
+#include "h2227.h"
+#include "h2526.h"
+#ifdef X
+#include "h2178.h"
+#endif
+struct S4991 { int a; const char *s = "x//y"; };
+inline int f4991_0(int x) { return x * 0; }
+inline int f4991_1(int x) { return x * 1; }
+inline int f4991_2(int x) { return x * 2; }
+inline int f4991_3(int x) { return x * 3; }
+inline int f4991_4(int x) { return x * 4; }
+inline int f4991_5(int x) { return x * 5; }
+inline int f4991_6(int x) { return x * 6; }
+inline int f4991_7(int x) { return x * 7; }
+inline int f4991_8(int x) { return x * 8; }
+inline int f4991_9(int x) { return x * 9; }
+inline int f4991_10(int x) { return x * 10; }
+inline int f4991_11(int x) { return x * 11; }
+inline int f4991_12(int x) { return x * 12; }
+inline int f4991_13(int x) { return x * 13; }
+inline int f4991_14(int x) { return x * 14; }
+inline int f4991_15(int x) { return x * 15; }
+inline int f4991_16(int x) { return x * 16; }
+inline int f4991_17(int x) { return x * 17; }
+inline int f4991_18(int x) { return x * 18; }
+inline int f4991_19(int x) { return x * 19; }
+inline int f4991_20(int x) { return x * 20; }
+inline int f4991_21(int x) { return x * 21; }
+inline int f4991_22(int x) { return x * 22; }
+inline int f4991_23(int x) { return x * 23; }
+inline int f4991_24(int x) { return x * 24; }
+inline int f4991_25(int x) { return x * 25; }
+inline int f4991_26(int x) { return x * 26; }
+inline int f4991_27(int x) { return x * 27; }
+inline int f4991_28(int x) { return x * 28; }
+inline int f4991_29(int x) { return x * 29; }
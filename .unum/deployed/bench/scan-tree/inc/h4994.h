@@ -0,0 +1,42 @@
+#pragma once
+/* header 4994 */
+#include <vector>
+#include "h5686.h"
+#include "h2317.h"
+#include "h5669.h"
+#include "h2273.h"
+#include "h7189.h"
+#ifdef X
+#include "h5346.h"
+#endif
+struct S4994 { int a; const char *s = "x//y"; };
+inline int f4994_0(int x) { return x * 0; }
+inline int f4994_1(int x) { return x * 1; }
+inline int f4994_2(int x) { return x * 2; }
+inline int f4994_3(int x) { return x * 3; }
+inline int f4994_4(int x) { return x * 4; }
+inline int f4994_5(int x) { return x * 5; }
+inline int f4994_6(int x) { return x * 6; }
+inline int f4994_7(int x) { return x * 7; }
+inline int f4994_8(int x) { return x * 8; }
+inline int f4994_9(int x) { return x * 9; }
+inline int f4994_10(int x) { return x * 10; }
+inline int f4994_11(int x) { return x * 11; }
+inline int f4994_12(int x) { return x * 12; }
+inline int f4994_13(int x) { return x * 13; }
+inline int f4994_14(int x) { return x * 14; }
+inline int f4994_15(int x) { return x * 15; }
+inline int f4994_16(int x) { return x * 16; }
+inline int f4994_17(int x) { return x * 17; }
+inline int f4994_18(int x) { return x * 18; }
+inline int f4994_19(int x) { return x * 19; }
+inline int f4994_20(int x) { return x * 20; }
+inline int f4994_21(int x) { return x * 21; }
+inline int f4994_22(int x) { return x * 22; }
+inline int f4994_23(int x) { return x * 23; }
+inline int f4994_24(int x) { return x * 24; }
+inline int f4994_25(int x) { return x * 25; }
+inline int f4994_26(int x) { return x * 26; }
+inline int f4994_27(int x) { return x * 27; }
+inline int f4994_28(int x) { return x * 28; }
+inline int f4994_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4996 */
+#include <vector>
+#include "h337.h"
+#include "h6944.h"
+#include "h9898.h"
+#include "h1301.h"
+#include "h2400.h"
+#ifdef X
+#include "h80.h"
+#endif
+struct S4996 { int a; const char *s = "x//y"; };
+inline int f4996_0(int x) { return x * 0; }
+inline int f4996_1(int x) { return x * 1; }
+inline int f4996_2(int x) { return x * 2; }
+inline int f4996_3(int x) { return x * 3; }
+inline int f4996_4(int x) { return x * 4; }
+inline int f4996_5(int x) { return x * 5; }
+inline int f4996_6(int x) { return x * 6; }
+inline int f4996_7(int x) { return x * 7; }
+inline int f4996_8(int x) { return x * 8; }
+inline int f4996_9(int x) { return x * 9; }
+inline int f4996_10(int x) { return x * 10; }
+inline int f4996_11(int x) { return x * 11; }
+inline int f4996_12(int x) { return x * 12; }
+inline int f4996_13(int x) { return x * 13; }
+inline int f4996_14(int x) { return x * 14; }
+inline int f4996_15(int x) { return x * 15; }
+inline int f4996_16(int x) { return x * 16; }
+inline int f4996_17(int x) { return x * 17; }
+inline int f4996_18(int x) { return x * 18; }
+inline int f4996_19(int x) { return x * 19; }
+inline int f4996_20(int x) { return x * 20; }
+inline int f4996_21(int x) { return x * 21; }
+inline int f4996_22(int x) { return x * 22; }
+inline int f4996_23(int x) { return x * 23; }
+inline int f4996_24(int x) { return x * 24; }
+inline int f4996_25(int x) { return x * 25; }
+inline int f4996_26(int x) { return x * 26; }
+inline int f4996_27(int x) { return x * 27; }
+inline int f4996_28(int x) { return x * 28; }
+inline int f4996_29(int x) { return x * 29; }
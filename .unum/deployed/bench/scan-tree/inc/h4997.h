@@ -0,0 +1,42 @@
+#pragma once
+/* header 4997 */
+#include <vector>
+#include "h6153.h"
+#include "h1747.h"
+#include "h2581.h"
+#include "h4061.h"
+#include "h3678.h"
+#ifdef X
+#include "h7013.h"
+#endif
+struct S4997 { int a; const char *s = "x//y"; };
+inline int f4997_0(int x) { return x * 0; }
+inline int f4997_1(int x) { return x * 1; }
+inline int f4997_2(int x) { return x * 2; }
+inline int f4997_3(int x) { return x * 3; }
+inline int f4997_4(int x) { return x * 4; }
+inline int f4997_5(int x) { return x * 5; }
+inline int f4997_6(int x) { return x * 6; }
+inline int f4997_7(int x) { return x * 7; }
+inline int f4997_8(int x) { return x * 8; }
+inline int f4997_9(int x) { return x * 9; }
+inline int f4997_10(int x) { return x * 10; }
+inline int f4997_11(int x) { return x * 11; }
+inline int f4997_12(int x) { return x * 12; }
+inline int f4997_13(int x) { return x * 13; }
+inline int f4997_14(int x) { return x * 14; }
+inline int f4997_15(int x) { return x * 15; }
+inline int f4997_16(int x) { return x * 16; }
+inline int f4997_17(int x) { return x * 17; }
+inline int f4997_18(int x) { return x * 18; }
+inline int f4997_19(int x) { return x * 19; }
+inline int f4997_20(int x) { return x * 20; }
+inline int f4997_21(int x) { return x * 21; }
+inline int f4997_22(int x) { return x * 22; }
+inline int f4997_23(int x) { return x * 23; }
+inline int f4997_24(int x) { return x * 24; }
+inline int f4997_25(int x) { return x * 25; }
+inline int f4997_26(int x) { return x * 26; }
+inline int f4997_27(int x) { return x * 27; }
+inline int f4997_28(int x) { return x * 28; }
+inline int f4997_29(int x) { return x * 29; }
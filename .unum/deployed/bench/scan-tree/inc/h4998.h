@@ -0,0 +1,42 @@
+#pragma once
+/* header 4998 */
+#include <vector>
+#include "h8499.h"
+#include "h6051.h"
+#include "h7168.h"
+#include "h7091.h"
+#include "h3631.h"
+#ifdef X
+#include "h1306.h"
+#endif
+struct S4998 { int a; const char *s = "x//y"; };
+inline int f4998_0(int x) { return x * 0; }
+inline int f4998_1(int x) { return x * 1; }
+inline int f4998_2(int x) { return x * 2; }
+inline int f4998_3(int x) { return x * 3; }
+inline int f4998_4(int x) { return x * 4; }
+inline int f4998_5(int x) { return x * 5; }
+inline int f4998_6(int x) { return x * 6; }
+inline int f4998_7(int x) { return x * 7; }
+inline int f4998_8(int x) { return x * 8; }
+inline int f4998_9(int x) { return x * 9; }
+inline int f4998_10(int x) { return x * 10; }
+inline int f4998_11(int x) { return x * 11; }
+inline int f4998_12(int x) { return x * 12; }
+inline int f4998_13(int x) { return x * 13; }
+inline int f4998_14(int x) { return x * 14; }
+inline int f4998_15(int x) { return x * 15; }
+inline int f4998_16(int x) { return x * 16; }
+inline int f4998_17(int x) { return x * 17; }
+inline int f4998_18(int x) { return x * 18; }
+inline int f4998_19(int x) { return x * 19; }
+inline int f4998_20(int x) { return x * 20; }
+inline int f4998_21(int x) { return x * 21; }
+inline int f4998_22(int x) { return x * 22; }
+inline int f4998_23(int x) { return x * 23; }
+inline int f4998_24(int x) { return x * 24; }
+inline int f4998_25(int x) { return x * 25; }
+inline int f4998_26(int x) { return x * 26; }
+inline int f4998_27(int x) { return x * 27; }
+inline int f4998_28(int x) { return x * 28; }
+inline int f4998_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 4999 */
+#include <vector>
+#include "h4284.h"
+#include "h1463.h"
+#include "h4471.h"
+#include "h4629.h"
+#include "h4623.h"
+#ifdef X
+#include "h9399.h"
+#endif
+struct S4999 { int a; const char *s = "x//y"; };
+inline int f4999_0(int x) { return x * 0; }
+inline int f4999_1(int x) { return x * 1; }
+inline int f4999_2(int x) { return x * 2; }
+inline int f4999_3(int x) { return x * 3; }
+inline int f4999_4(int x) { return x * 4; }
+inline int f4999_5(int x) { return x * 5; }
+inline int f4999_6(int x) { return x * 6; }
+inline int f4999_7(int x) { return x * 7; }
+inline int f4999_8(int x) { return x * 8; }
+inline int f4999_9(int x) { return x * 9; }
+inline int f4999_10(int x) { return x * 10; }
+inline int f4999_11(int x) { return x * 11; }
+inline int f4999_12(int x) { return x * 12; }
+inline int f4999_13(int x) { return x * 13; }
+inline int f4999_14(int x) { return x * 14; }
+inline int f4999_15(int x) { return x * 15; }
+inline int f4999_16(int x) { return x * 16; }
+inline int f4999_17(int x) { return x * 17; }
+inline int f4999_18(int x) { return x * 18; }
+inline int f4999_19(int x) { return x * 19; }
+inline int f4999_20(int x) { return x * 20; }
+inline int f4999_21(int x) { return x * 21; }
+inline int f4999_22(int x) { return x * 22; }
+inline int f4999_23(int x) { return x * 23; }
+inline int f4999_24(int x) { return x * 24; }
+inline int f4999_25(int x) { return x * 25; }
+inline int f4999_26(int x) { return x * 26; }
+inline int f4999_27(int x) { return x * 27; }
+inline int f4999_28(int x) { return x * 28; }
+inline int f4999_29(int x) { return x * 29; }
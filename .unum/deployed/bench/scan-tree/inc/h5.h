@@ -0,0 +1,42 @@
+#pragma once
+/* header 5 */
+#include <vector>
+#include "h5542.h"
+#include "h4415.h"
+#include "h8307.h"
+#include "h8123.h"
+#include "h4303.h"
+#ifdef X
+#include "h8472.h"
+#endif
+struct S5 { int a; const char *s = "x//y"; };
+inline int f5_0(int x) { return x * 0; }
+inline int f5_1(int x) { return x * 1; }
+inline int f5_2(int x) { return x * 2; }
+inline int f5_3(int x) { return x * 3; }
+inline int f5_4(int x) { return x * 4; }
+inline int f5_5(int x) { return x * 5; }
+inline int f5_6(int x) { return x * 6; }
+inline int f5_7(int x) { return x * 7; }
+inline int f5_8(int x) { return x * 8; }
+inline int f5_9(int x) { return x * 9; }
+inline int f5_10(int x) { return x * 10; }
+inline int f5_11(int x) { return x * 11; }
+inline int f5_12(int x) { return x * 12; }
+inline int f5_13(int x) { return x * 13; }
+inline int f5_14(int x) { return x * 14; }
+inline int f5_15(int x) { return x * 15; }
+inline int f5_16(int x) { return x * 16; }
+inline int f5_17(int x) { return x * 17; }
+inline int f5_18(int x) { return x * 18; }
+inline int f5_19(int x) { return x * 19; }
+inline int f5_20(int x) { return x * 20; }
+inline int f5_21(int x) { return x * 21; }
+inline int f5_22(int x) { return x * 22; }
+inline int f5_23(int x) { return x * 23; }
+inline int f5_24(int x) { return x * 24; }
+inline int f5_25(int x) { return x * 25; }
+inline int f5_26(int x) { return x * 26; }
+inline int f5_27(int x) { return x * 27; }
+inline int f5_28(int x) { return x * 28; }
+inline int f5_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 50 */
+#include <vector>
+#include "h6471.h"
+#include "h9133.h"
+#include "h9200.h"
+#include "h7981.h"
+#include "h4959.h"
+#ifdef X
+#include "h4804.h"
+#endif
+struct S50 { int a; const char *s = "x//y"; };
+inline int f50_0(int x) { return x * 0; }
+inline int f50_1(int x) { return x * 1; }
+inline int f50_2(int x) { return x * 2; }
+inline int f50_3(int x) { return x * 3; }
+inline int f50_4(int x) { return x * 4; }
+inline int f50_5(int x) { return x * 5; }
+inline int f50_6(int x) { return x * 6; }
+inline int f50_7(int x) { return x * 7; }
+inline int f50_8(int x) { return x * 8; }
+inline int f50_9(int x) { return x * 9; }
+inline int f50_10(int x) { return x * 10; }
+inline int f50_11(int x) { return x * 11; }
+inline int f50_12(int x) { return x * 12; }
+inline int f50_13(int x) { return x * 13; }
+inline int f50_14(int x) { return x * 14; }
+inline int f50_15(int x) { return x * 15; }
+inline int f50_16(int x) { return x * 16; }
+inline int f50_17(int x) { return x * 17; }
+inline int f50_18(int x) { return x * 18; }
+inline int f50_19(int x) { return x * 19; }
+inline int f50_20(int x) { return x * 20; }
+inline int f50_21(int x) { return x * 21; }
+inline int f50_22(int x) { return x * 22; }
+inline int f50_23(int x) { return x * 23; }
+inline int f50_24(int x) { return x * 24; }
+inline int f50_25(int x) { return x * 25; }
+inline int f50_26(int x) { return x * 26; }
+inline int f50_27(int x) { return x * 27; }
+inline int f50_28(int x) { return x * 28; }
+inline int f50_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5000 */
+#include <vector>
+#include "h2187.h"
+#include "h3695.h"
+#include "h8874.h"
+#include "h1712.h"
+#include "h1166.h"
+#ifdef X
+#include "h3453.h"
+#endif
+struct S5000 { int a; const char *s = "x//y"; };
+inline int f5000_0(int x) { return x * 0; }
+inline int f5000_1(int x) { return x * 1; }
+inline int f5000_2(int x) { return x * 2; }
+inline int f5000_3(int x) { return x * 3; }
+inline int f5000_4(int x) { return x * 4; }
+inline int f5000_5(int x) { return x * 5; }
+inline int f5000_6(int x) { return x * 6; }
+inline int f5000_7(int x) { return x * 7; }
+inline int f5000_8(int x) { return x * 8; }
+inline int f5000_9(int x) { return x * 9; }
+inline int f5000_10(int x) { return x * 10; }
+inline int f5000_11(int x) { return x * 11; }
+inline int f5000_12(int x) { return x * 12; }
+inline int f5000_13(int x) { return x * 13; }
+inline int f5000_14(int x) { return x * 14; }
+inline int f5000_15(int x) { return x * 15; }
+inline int f5000_16(int x) { return x * 16; }
+inline int f5000_17(int x) { return x * 17; }
+inline int f5000_18(int x) { return x * 18; }
+inline int f5000_19(int x) { return x * 19; }
+inline int f5000_20(int x) { return x * 20; }
+inline int f5000_21(int x) { return x * 21; }
+inline int f5000_22(int x) { return x * 22; }
+inline int f5000_23(int x) { return x * 23; }
+inline int f5000_24(int x) { return x * 24; }
+inline int f5000_25(int x) { return x * 25; }
+inline int f5000_26(int x) { return x * 26; }
+inline int f5000_27(int x) { return x * 27; }
+inline int f5000_28(int x) { return x * 28; }
+inline int f5000_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5003 */
+#include <vector>
+#include "h1033.h"
+#include "h1030.h"
+#include "h4834.h"
+#include "h6474.h"
+#include "h6320.h"
+#ifdef X
+#include "h753.h"
+#endif
+struct S5003 { int a; const char *s = "x//y"; };
+inline int f5003_0(int x) { return x * 0; }
+inline int f5003_1(int x) { return x * 1; }
+inline int f5003_2(int x) { return x * 2; }
+inline int f5003_3(int x) { return x * 3; }
+inline int f5003_4(int x) { return x * 4; }
+inline int f5003_5(int x) { return x * 5; }
+inline int f5003_6(int x) { return x * 6; }
+inline int f5003_7(int x) { return x * 7; }
+inline int f5003_8(int x) { return x * 8; }
+inline int f5003_9(int x) { return x * 9; }
+inline int f5003_10(int x) { return x * 10; }
+inline int f5003_11(int x) { return x * 11; }
+inline int f5003_12(int x) { return x * 12; }
+inline int f5003_13(int x) { return x * 13; }
+inline int f5003_14(int x) { return x * 14; }
+inline int f5003_15(int x) { return x * 15; }
+inline int f5003_16(int x) { return x * 16; }
+inline int f5003_17(int x) { return x * 17; }
+inline int f5003_18(int x) { return x * 18; }
+inline int f5003_19(int x) { return x * 19; }
+inline int f5003_20(int x) { return x * 20; }
+inline int f5003_21(int x) { return x * 21; }
+inline int f5003_22(int x) { return x * 22; }
+inline int f5003_23(int x) { return x * 23; }
+inline int f5003_24(int x) { return x * 24; }
+inline int f5003_25(int x) { return x * 25; }
+inline int f5003_26(int x) { return x * 26; }
+inline int f5003_27(int x) { return x * 27; }
+inline int f5003_28(int x) { return x * 28; }
+inline int f5003_29(int x) { return x * 29; }
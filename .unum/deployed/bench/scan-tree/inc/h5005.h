@@ -0,0 +1,42 @@
+#pragma once
+/* header 5005 */
+#include <vector>
+#include "h843.h"
+#include "h8106.h"
+#include "h8308.h"
+#include "h3825.h"
+#include "h3896.h"
+#ifdef X
+#include "h4653.h"
+#endif
+struct S5005 { int a; const char *s = "x//y"; };
+inline int f5005_0(int x) { return x * 0; }
+inline int f5005_1(int x) { return x * 1; }
+inline int f5005_2(int x) { return x * 2; }
+inline int f5005_3(int x) { return x * 3; }
+inline int f5005_4(int x) { return x * 4; }
+inline int f5005_5(int x) { return x * 5; }
+inline int f5005_6(int x) { return x * 6; }
+inline int f5005_7(int x) { return x * 7; }
+inline int f5005_8(int x) { return x * 8; }
+inline int f5005_9(int x) { return x * 9; }
+inline int f5005_10(int x) { return x * 10; }
+inline int f5005_11(int x) { return x * 11; }
+inline int f5005_12(int x) { return x * 12; }
+inline int f5005_13(int x) { return x * 13; }
+inline int f5005_14(int x) { return x * 14; }
+inline int f5005_15(int x) { return x * 15; }
+inline int f5005_16(int x) { return x * 16; }
+inline int f5005_17(int x) { return x * 17; }
+inline int f5005_18(int x) { return x * 18; }
+inline int f5005_19(int x) { return x * 19; }
+inline int f5005_20(int x) { return x * 20; }
+inline int f5005_21(int x) { return x * 21; }
+inline int f5005_22(int x) { return x * 22; }
+inline int f5005_23(int x) { return x * 23; }
+inline int f5005_24(int x) { return x * 24; }
+inline int f5005_25(int x) { return x * 25; }
+inline int f5005_26(int x) { return x * 26; }
+inline int f5005_27(int x) { return x * 27; }
+inline int f5005_28(int x) { return x * 28; }
+inline int f5005_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5006 */
+#include <vector>
+#include "h5581.h"
+#include "h4549.h"
+#include "h7701.h"
+#include "h6261.h"
+#include "h6445.h"
+#ifdef X
+#include "h2442.h"
+#endif
+struct S5006 { int a; const char *s = "x//y"; };
+inline int f5006_0(int x) { return x * 0; }
+inline int f5006_1(int x) { return x * 1; }
+inline int f5006_2(int x) { return x * 2; }
+inline int f5006_3(int x) { return x * 3; }
+inline int f5006_4(int x) { return x * 4; }
+inline int f5006_5(int x) { return x * 5; }
+inline int f5006_6(int x) { return x * 6; }
+inline int f5006_7(int x) { return x * 7; }
+inline int f5006_8(int x) { return x * 8; }
+inline int f5006_9(int x) { return x * 9; }
+inline int f5006_10(int x) { return x * 10; }
+inline int f5006_11(int x) { return x * 11; }
+inline int f5006_12(int x) { return x * 12; }
+inline int f5006_13(int x) { return x * 13; }
+inline int f5006_14(int x) { return x * 14; }
+inline int f5006_15(int x) { return x * 15; }
+inline int f5006_16(int x) { return x * 16; }
+inline int f5006_17(int x) { return x * 17; }
+inline int f5006_18(int x) { return x * 18; }
+inline int f5006_19(int x) { return x * 19; }
+inline int f5006_20(int x) { return x * 20; }
+inline int f5006_21(int x) { return x * 21; }
+inline int f5006_22(int x) { return x * 22; }
+inline int f5006_23(int x) { return x * 23; }
+inline int f5006_24(int x) { return x * 24; }
+inline int f5006_25(int x) { return x * 25; }
+inline int f5006_26(int x) { return x * 26; }
+inline int f5006_27(int x) { return x * 27; }
+inline int f5006_28(int x) { return x * 28; }
+inline int f5006_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5007 */
+#include <vector>
+#include "h4301.h"
+#include "h443.h"
+#include "h8181.h"
+#include "h4011.h"
+#include "h9710.h"
+#ifdef X
+#include "h5919.h"
+#endif
+struct S5007 { int a; const char *s = "x//y"; };
+inline int f5007_0(int x) { return x * 0; }
+inline int f5007_1(int x) { return x * 1; }
+inline int f5007_2(int x) { return x * 2; }
+inline int f5007_3(int x) { return x * 3; }
+inline int f5007_4(int x) { return x * 4; }
+inline int f5007_5(int x) { return x * 5; }
+inline int f5007_6(int x) { return x * 6; }
+inline int f5007_7(int x) { return x * 7; }
+inline int f5007_8(int x) { return x * 8; }
+inline int f5007_9(int x) { return x * 9; }
+inline int f5007_10(int x) { return x * 10; }
+inline int f5007_11(int x) { return x * 11; }
+inline int f5007_12(int x) { return x * 12; }
+inline int f5007_13(int x) { return x * 13; }
+inline int f5007_14(int x) { return x * 14; }
+inline int f5007_15(int x) { return x * 15; }
+inline int f5007_16(int x) { return x * 16; }
+inline int f5007_17(int x) { return x * 17; }
+inline int f5007_18(int x) { return x * 18; }
+inline int f5007_19(int x) { return x * 19; }
+inline int f5007_20(int x) { return x * 20; }
+inline int f5007_21(int x) { return x * 21; }
+inline int f5007_22(int x) { return x * 22; }
+inline int f5007_23(int x) { return x * 23; }
+inline int f5007_24(int x) { return x * 24; }
+inline int f5007_25(int x) { return x * 25; }
+inline int f5007_26(int x) { return x * 26; }
+inline int f5007_27(int x) { return x * 27; }
+inline int f5007_28(int x) { return x * 28; }
+inline int f5007_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5008 */
+#include <vector>
+#include "h6483.h"
+#include "h8342.h"
+#include "h8571.h"
+#include "h6022.h"
+#include "h5063.h"
+#ifdef X
+#include "h6935.h"
+#endif
+struct S5008 { int a; const char *s = "x//y"; };
+inline int f5008_0(int x) { return x * 0; }
+inline int f5008_1(int x) { return x * 1; }
+inline int f5008_2(int x) { return x * 2; }
+inline int f5008_3(int x) { return x * 3; }
+inline int f5008_4(int x) { return x * 4; }
+inline int f5008_5(int x) { return x * 5; }
+inline int f5008_6(int x) { return x * 6; }
+inline int f5008_7(int x) { return x * 7; }
+inline int f5008_8(int x) { return x * 8; }
+inline int f5008_9(int x) { return x * 9; }
+inline int f5008_10(int x) { return x * 10; }
+inline int f5008_11(int x) { return x * 11; }
+inline int f5008_12(int x) { return x * 12; }
+inline int f5008_13(int x) { return x * 13; }
+inline int f5008_14(int x) { return x * 14; }
+inline int f5008_15(int x) { return x * 15; }
+inline int f5008_16(int x) { return x * 16; }
+inline int f5008_17(int x) { return x * 17; }
+inline int f5008_18(int x) { return x * 18; }
+inline int f5008_19(int x) { return x * 19; }
+inline int f5008_20(int x) { return x * 20; }
+inline int f5008_21(int x) { return x * 21; }
+inline int f5008_22(int x) { return x * 22; }
+inline int f5008_23(int x) { return x * 23; }
+inline int f5008_24(int x) { return x * 24; }
+inline int f5008_25(int x) { return x * 25; }
+inline int f5008_26(int x) { return x * 26; }
+inline int f5008_27(int x) { return x * 27; }
+inline int f5008_28(int x) { return x * 28; }
+inline int f5008_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5010 */
+#include <vector>
+#include "h5262.h"
+#include "h4616.h"
+#include "h6971.h"
+#include "h1825.h"
+#include "h802.h"
+#ifdef X
+#include "h7418.h"
+#endif
+struct S5010 { int a; const char *s = "x//y"; };
+inline int f5010_0(int x) { return x * 0; }
+inline int f5010_1(int x) { return x * 1; }
+inline int f5010_2(int x) { return x * 2; }
+inline int f5010_3(int x) { return x * 3; }
+inline int f5010_4(int x) { return x * 4; }
+inline int f5010_5(int x) { return x * 5; }
+inline int f5010_6(int x) { return x * 6; }
+inline int f5010_7(int x) { return x * 7; }
+inline int f5010_8(int x) { return x * 8; }
+inline int f5010_9(int x) { return x * 9; }
+inline int f5010_10(int x) { return x * 10; }
+inline int f5010_11(int x) { return x * 11; }
+inline int f5010_12(int x) { return x * 12; }
+inline int f5010_13(int x) { return x * 13; }
+inline int f5010_14(int x) { return x * 14; }
+inline int f5010_15(int x) { return x * 15; }
+inline int f5010_16(int x) { return x * 16; }
+inline int f5010_17(int x) { return x * 17; }
+inline int f5010_18(int x) { return x * 18; }
+inline int f5010_19(int x) { return x * 19; }
+inline int f5010_20(int x) { return x * 20; }
+inline int f5010_21(int x) { return x * 21; }
+inline int f5010_22(int x) { return x * 22; }
+inline int f5010_23(int x) { return x * 23; }
+inline int f5010_24(int x) { return x * 24; }
+inline int f5010_25(int x) { return x * 25; }
+inline int f5010_26(int x) { return x * 26; }
+inline int f5010_27(int x) { return x * 27; }
+inline int f5010_28(int x) { return x * 28; }
+inline int f5010_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5015 */
+#include <vector>
+#include "h6751.h"
+#include "h4484.h"
+#include "h1626.h"
+#include "h7954.h"
+#include "h9817.h"
+#ifdef X
+#include "h5417.h"
+#endif
+struct S5015 { int a; const char *s = "x//y"; };
+inline int f5015_0(int x) { return x * 0; }
+inline int f5015_1(int x) { return x * 1; }
+inline int f5015_2(int x) { return x * 2; }
+inline int f5015_3(int x) { return x * 3; }
+inline int f5015_4(int x) { return x * 4; }
+inline int f5015_5(int x) { return x * 5; }
+inline int f5015_6(int x) { return x * 6; }
+inline int f5015_7(int x) { return x * 7; }
+inline int f5015_8(int x) { return x * 8; }
+inline int f5015_9(int x) { return x * 9; }
+inline int f5015_10(int x) { return x * 10; }
+inline int f5015_11(int x) { return x * 11; }
+inline int f5015_12(int x) { return x * 12; }
+inline int f5015_13(int x) { return x * 13; }
+inline int f5015_14(int x) { return x * 14; }
+inline int f5015_15(int x) { return x * 15; }
+inline int f5015_16(int x) { return x * 16; }
+inline int f5015_17(int x) { return x * 17; }
+inline int f5015_18(int x) { return x * 18; }
+inline int f5015_19(int x) { return x * 19; }
+inline int f5015_20(int x) { return x * 20; }
+inline int f5015_21(int x) { return x * 21; }
+inline int f5015_22(int x) { return x * 22; }
+inline int f5015_23(int x) { return x * 23; }
+inline int f5015_24(int x) { return x * 24; }
+inline int f5015_25(int x) { return x * 25; }
+inline int f5015_26(int x) { return x * 26; }
+inline int f5015_27(int x) { return x * 27; }
+inline int f5015_28(int x) { return x * 28; }
+inline int f5015_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5016 */
+#include <vector>
+#include "h1127.h"
+#include "h8151.h"
+#include "h1052.h"
+#include "h8737.h"
+#include "h6651.h"
+#ifdef X
+#include "h4087.h"
+#endif
+struct S5016 { int a; const char *s = "x//y"; };
+inline int f5016_0(int x) { return x * 0; }
+inline int f5016_1(int x) { return x * 1; }
+inline int f5016_2(int x) { return x * 2; }
+inline int f5016_3(int x) { return x * 3; }
+inline int f5016_4(int x) { return x * 4; }
+inline int f5016_5(int x) { return x * 5; }
+inline int f5016_6(int x) { return x * 6; }
+inline int f5016_7(int x) { return x * 7; }
+inline int f5016_8(int x) { return x * 8; }
+inline int f5016_9(int x) { return x * 9; }
+inline int f5016_10(int x) { return x * 10; }
+inline int f5016_11(int x) { return x * 11; }
+inline int f5016_12(int x) { return x * 12; }
+inline int f5016_13(int x) { return x * 13; }
+inline int f5016_14(int x) { return x * 14; }
+inline int f5016_15(int x) { return x * 15; }
+inline int f5016_16(int x) { return x * 16; }
+inline int f5016_17(int x) { return x * 17; }
+inline int f5016_18(int x) { return x * 18; }
+inline int f5016_19(int x) { return x * 19; }
+inline int f5016_20(int x) { return x * 20; }
+inline int f5016_21(int x) { return x * 21; }
+inline int f5016_22(int x) { return x * 22; }
+inline int f5016_23(int x) { return x * 23; }
+inline int f5016_24(int x) { return x * 24; }
+inline int f5016_25(int x) { return x * 25; }
+inline int f5016_26(int x) { return x * 26; }
+inline int f5016_27(int x) { return x * 27; }
+inline int f5016_28(int x) { return x * 28; }
+inline int f5016_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5017 */
+#include <vector>
+#include "h112.h"
+#include "h5387.h"
+#include "h2286.h"
+#include "h3374.h"
+#include "h1675.h"
+#ifdef X
+#include "h8742.h"
+#endif
+struct S5017 { int a; const char *s = "x//y"; };
+inline int f5017_0(int x) { return x * 0; }
+inline int f5017_1(int x) { return x * 1; }
+inline int f5017_2(int x) { return x * 2; }
+inline int f5017_3(int x) { return x * 3; }
+inline int f5017_4(int x) { return x * 4; }
+inline int f5017_5(int x) { return x * 5; }
+inline int f5017_6(int x) { return x * 6; }
+inline int f5017_7(int x) { return x * 7; }
+inline int f5017_8(int x) { return x * 8; }
+inline int f5017_9(int x) { return x * 9; }
+inline int f5017_10(int x) { return x * 10; }
+inline int f5017_11(int x) { return x * 11; }
+inline int f5017_12(int x) { return x * 12; }
+inline int f5017_13(int x) { return x * 13; }
+inline int f5017_14(int x) { return x * 14; }
+inline int f5017_15(int x) { return x * 15; }
+inline int f5017_16(int x) { return x * 16; }
+inline int f5017_17(int x) { return x * 17; }
+inline int f5017_18(int x) { return x * 18; }
+inline int f5017_19(int x) { return x * 19; }
+inline int f5017_20(int x) { return x * 20; }
+inline int f5017_21(int x) { return x * 21; }
+inline int f5017_22(int x) { return x * 22; }
+inline int f5017_23(int x) { return x * 23; }
+inline int f5017_24(int x) { return x * 24; }
+inline int f5017_25(int x) { return x * 25; }
+inline int f5017_26(int x) { return x * 26; }
+inline int f5017_27(int x) { return x * 27; }
+inline int f5017_28(int x) { return x * 28; }
+inline int f5017_29(int x) { return x * 29; }
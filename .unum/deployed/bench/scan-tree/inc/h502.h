@@ -0,0 +1,42 @@
+#pragma once
+/* header 502 */
+#include <vector>
+#include "h2270.h"
+#include "h2750.h"
+#include "h939.h"
+#include "h9201.h"
+#include "h3258.h"
+#ifdef X
+#include "h4927.h"
+#endif
+struct S502 { int a; const char *s = "x//y"; };
+inline int f502_0(int x) { return x * 0; }
+inline int f502_1(int x) { return x * 1; }
+inline int f502_2(int x) { return x * 2; }
+inline int f502_3(int x) { return x * 3; }
+inline int f502_4(int x) { return x * 4; }
+inline int f502_5(int x) { return x * 5; }
+inline int f502_6(int x) { return x * 6; }
+inline int f502_7(int x) { return x * 7; }
+inline int f502_8(int x) { return x * 8; }
+inline int f502_9(int x) { return x * 9; }
+inline int f502_10(int x) { return x * 10; }
+inline int f502_11(int x) { return x * 11; }
+inline int f502_12(int x) { return x * 12; }
+inline int f502_13(int x) { return x * 13; }
+inline int f502_14(int x) { return x * 14; }
+inline int f502_15(int x) { return x * 15; }
+inline int f502_16(int x) { return x * 16; }
+inline int f502_17(int x) { return x * 17; }
+inline int f502_18(int x) { return x * 18; }
+inline int f502_19(int x) { return x * 19; }
+inline int f502_20(int x) { return x * 20; }
+inline int f502_21(int x) { return x * 21; }
+inline int f502_22(int x) { return x * 22; }
+inline int f502_23(int x) { return x * 23; }
+inline int f502_24(int x) { return x * 24; }
+inline int f502_25(int x) { return x * 25; }
+inline int f502_26(int x) { return x * 26; }
+inline int f502_27(int x) { return x * 27; }
+inline int f502_28(int x) { return x * 28; }
+inline int f502_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5025 */
+#include <vector>
+#include "h7862.h"
+#include "h3617.h"
+#include "h5466.h"
+#include "h3641.h"
+#include "h6189.h"
+#ifdef X
+#include "h6124.h"
+#endif
+struct S5025 { int a; const char *s = "x//y"; };
+inline int f5025_0(int x) { return x * 0; }
+inline int f5025_1(int x) { return x * 1; }
+inline int f5025_2(int x) { return x * 2; }
+inline int f5025_3(int x) { return x * 3; }
+inline int f5025_4(int x) { return x * 4; }
+inline int f5025_5(int x) { return x * 5; }
+inline int f5025_6(int x) { return x * 6; }
+inline int f5025_7(int x) { return x * 7; }
+inline int f5025_8(int x) { return x * 8; }
+inline int f5025_9(int x) { return x * 9; }
+inline int f5025_10(int x) { return x * 10; }
+inline int f5025_11(int x) { return x * 11; }
+inline int f5025_12(int x) { return x * 12; }
+inline int f5025_13(int x) { return x * 13; }
+inline int f5025_14(int x) { return x * 14; }
+inline int f5025_15(int x) { return x * 15; }
+inline int f5025_16(int x) { return x * 16; }
+inline int f5025_17(int x) { return x * 17; }
+inline int f5025_18(int x) { return x * 18; }
+inline int f5025_19(int x) { return x * 19; }
+inline int f5025_20(int x) { return x * 20; }
+inline int f5025_21(int x) { return x * 21; }
+inline int f5025_22(int x) { return x * 22; }
+inline int f5025_23(int x) { return x * 23; }
+inline int f5025_24(int x) { return x * 24; }
+inline int f5025_25(int x) { return x * 25; }
+inline int f5025_26(int x) { return x * 26; }
+inline int f5025_27(int x) { return x * 27; }
+inline int f5025_28(int x) { return x * 28; }
+inline int f5025_29(int x) { return x * 29; }
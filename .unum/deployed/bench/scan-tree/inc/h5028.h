@@ -0,0 +1,42 @@
+#pragma once
+/* header 5028 */
+#include <vector>
+#include "h7472.h"
+#include "h7304.h"
+#include "h7904.h"
+#include "h2491.h"
+#include "h5211.h"
+#ifdef X
+#include "h5096.h"
+#endif
+struct S5028 { int a; const char *s = "x//y"; };
+inline int f5028_0(int x) { return x * 0; }
+inline int f5028_1(int x) { return x * 1; }
+inline int f5028_2(int x) { return x * 2; }
+inline int f5028_3(int x) { return x * 3; }
+inline int f5028_4(int x) { return x * 4; }
+inline int f5028_5(int x) { return x * 5; }
+inline int f5028_6(int x) { return x * 6; }
+inline int f5028_7(int x) { return x * 7; }
+inline int f5028_8(int x) { return x * 8; }
+inline int f5028_9(int x) { return x * 9; }
+inline int f5028_10(int x) { return x * 10; }
+inline int f5028_11(int x) { return x * 11; }
+inline int f5028_12(int x) { return x * 12; }
+inline int f5028_13(int x) { return x * 13; }
+inline int f5028_14(int x) { return x * 14; }
+inline int f5028_15(int x) { return x * 15; }
+inline int f5028_16(int x) { return x * 16; }
+inline int f5028_17(int x) { return x * 17; }
+inline int f5028_18(int x) { return x * 18; }
+inline int f5028_19(int x) { return x * 19; }
+inline int f5028_20(int x) { return x * 20; }
+inline int f5028_21(int x) { return x * 21; }
+inline int f5028_22(int x) { return x * 22; }
+inline int f5028_23(int x) { return x * 23; }
+inline int f5028_24(int x) { return x * 24; }
+inline int f5028_25(int x) { return x * 25; }
+inline int f5028_26(int x) { return x * 26; }
+inline int f5028_27(int x) { return x * 27; }
+inline int f5028_28(int x) { return x * 28; }
+inline int f5028_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5034 */
+#include <vector>
+#include "h1303.h"
+#include "h521.h"
+#include "h9202.h"
+#include "h8441.h"
+#include "h8947.h"
+#ifdef X
+#include "h314.h"
+#endif
+struct S5034 { int a; const char *s = "x//y"; };
+inline int f5034_0(int x) { return x * 0; }
+inline int f5034_1(int x) { return x * 1; }
+inline int f5034_2(int x) { return x * 2; }
+inline int f5034_3(int x) { return x * 3; }
+inline int f5034_4(int x) { return x * 4; }
+inline int f5034_5(int x) { return x * 5; }
+inline int f5034_6(int x) { return x * 6; }
+inline int f5034_7(int x) { return x * 7; }
+inline int f5034_8(int x) { return x * 8; }
+inline int f5034_9(int x) { return x * 9; }
+inline int f5034_10(int x) { return x * 10; }
+inline int f5034_11(int x) { return x * 11; }
+inline int f5034_12(int x) { return x * 12; }
+inline int f5034_13(int x) { return x * 13; }
+inline int f5034_14(int x) { return x * 14; }
+inline int f5034_15(int x) { return x * 15; }
+inline int f5034_16(int x) { return x * 16; }
+inline int f5034_17(int x) { return x * 17; }
+inline int f5034_18(int x) { return x * 18; }
+inline int f5034_19(int x) { return x * 19; }
+inline int f5034_20(int x) { return x * 20; }
+inline int f5034_21(int x) { return x * 21; }
+inline int f5034_22(int x) { return x * 22; }
+inline int f5034_23(int x) { return x * 23; }
+inline int f5034_24(int x) { return x * 24; }
+inline int f5034_25(int x) { return x * 25; }
+inline int f5034_26(int x) { return x * 26; }
+inline int f5034_27(int x) { return x * 27; }
+inline int f5034_28(int x) { return x * 28; }
+inline int f5034_29(int x) { return x * 29; }
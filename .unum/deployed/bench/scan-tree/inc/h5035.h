@@ -0,0 +1,42 @@
+#pragma once
+/* header 5035 */
+#include <vector>
+#include "h5719.h"
+#include "h7205.h"
+#include "h4450.h"
+#include "h2982.h"
+#include "h2632.h"
+#ifdef X
+#include "h5485.h"
+#endif
+struct S5035 { int a; const char *s = "x//y"; };
+inline int f5035_0(int x) { return x * 0; }
+inline int f5035_1(int x) { return x * 1; }
+inline int f5035_2(int x) { return x * 2; }
+inline int f5035_3(int x) { return x * 3; }
+inline int f5035_4(int x) { return x * 4; }
+inline int f5035_5(int x) { return x * 5; }
+inline int f5035_6(int x) { return x * 6; }
+inline int f5035_7(int x) { return x * 7; }
+inline int f5035_8(int x) { return x * 8; }
+inline int f5035_9(int x) { return x * 9; }
+inline int f5035_10(int x) { return x * 10; }
+inline int f5035_11(int x) { return x * 11; }
+inline int f5035_12(int x) { return x * 12; }
+inline int f5035_13(int x) { return x * 13; }
+inline int f5035_14(int x) { return x * 14; }
+inline int f5035_15(int x) { return x * 15; }
+inline int f5035_16(int x) { return x * 16; }
+inline int f5035_17(int x) { return x * 17; }
+inline int f5035_18(int x) { return x * 18; }
+inline int f5035_19(int x) { return x * 19; }
+inline int f5035_20(int x) { return x * 20; }
+inline int f5035_21(int x) { return x * 21; }
+inline int f5035_22(int x) { return x * 22; }
+inline int f5035_23(int x) { return x * 23; }
+inline int f5035_24(int x) { return x * 24; }
+inline int f5035_25(int x) { return x * 25; }
+inline int f5035_26(int x) { return x * 26; }
+inline int f5035_27(int x) { return x * 27; }
+inline int f5035_28(int x) { return x * 28; }
+inline int f5035_29(int x) { return x * 29; }
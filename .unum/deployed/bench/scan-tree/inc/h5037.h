@@ -0,0 +1,42 @@
+#pragma once
+/* header 5037 */
+#include <vector>
+#include "h8307.h"
+#include "h2609.h"
+#include "h3357.h"
+#include "h6095.h"
+#include "h8402.h"
+#ifdef X
+#include "h8829.h"
+#endif
+struct S5037 { int a; const char *s = "x//y"; };
+inline int f5037_0(int x) { return x * 0; }
+inline int f5037_1(int x) { return x * 1; }
+inline int f5037_2(int x) { return x * 2; }
+inline int f5037_3(int x) { return x * 3; }
+inline int f5037_4(int x) { return x * 4; }
+inline int f5037_5(int x) { return x * 5; }
+inline int f5037_6(int x) { return x * 6; }
+inline int f5037_7(int x) { return x * 7; }
+inline int f5037_8(int x) { return x * 8; }
+inline int f5037_9(int x) { return x * 9; }
+inline int f5037_10(int x) { return x * 10; }
+inline int f5037_11(int x) { return x * 11; }
+inline int f5037_12(int x) { return x * 12; }
+inline int f5037_13(int x) { return x * 13; }
+inline int f5037_14(int x) { return x * 14; }
+inline int f5037_15(int x) { return x * 15; }
+inline int f5037_16(int x) { return x * 16; }
+inline int f5037_17(int x) { return x * 17; }
+inline int f5037_18(int x) { return x * 18; }
+inline int f5037_19(int x) { return x * 19; }
+inline int f5037_20(int x) { return x * 20; }
+inline int f5037_21(int x) { return x * 21; }
+inline int f5037_22(int x) { return x * 22; }
+inline int f5037_23(int x) { return x * 23; }
+inline int f5037_24(int x) { return x * 24; }
+inline int f5037_25(int x) { return x * 25; }
+inline int f5037_26(int x) { return x * 26; }
+inline int f5037_27(int x) { return x * 27; }
+inline int f5037_28(int x) { return x * 28; }
+inline int f5037_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5038 */
+#include <vector>
+#include "h4750.h"
+#include "h6983.h"
+#include "h282.h"
+#include "h8331.h"
+#include "h5656.h"
+#ifdef X
+#include "h7061.h"
+#endif
+struct S5038 { int a; const char *s = "x//y"; };
+inline int f5038_0(int x) { return x * 0; }
+inline int f5038_1(int x) { return x * 1; }
+inline int f5038_2(int x) { return x * 2; }
+inline int f5038_3(int x) { return x * 3; }
+inline int f5038_4(int x) { return x * 4; }
+inline int f5038_5(int x) { return x * 5; }
+inline int f5038_6(int x) { return x * 6; }
+inline int f5038_7(int x) { return x * 7; }
+inline int f5038_8(int x) { return x * 8; }
+inline int f5038_9(int x) { return x * 9; }
+inline int f5038_10(int x) { return x * 10; }
+inline int f5038_11(int x) { return x * 11; }
+inline int f5038_12(int x) { return x * 12; }
+inline int f5038_13(int x) { return x * 13; }
+inline int f5038_14(int x) { return x * 14; }
+inline int f5038_15(int x) { return x * 15; }
+inline int f5038_16(int x) { return x * 16; }
+inline int f5038_17(int x) { return x * 17; }
+inline int f5038_18(int x) { return x * 18; }
+inline int f5038_19(int x) { return x * 19; }
+inline int f5038_20(int x) { return x * 20; }
+inline int f5038_21(int x) { return x * 21; }
+inline int f5038_22(int x) { return x * 22; }
+inline int f5038_23(int x) { return x * 23; }
+inline int f5038_24(int x) { return x * 24; }
+inline int f5038_25(int x) { return x * 25; }
+inline int f5038_26(int x) { return x * 26; }
+inline int f5038_27(int x) { return x * 27; }
+inline int f5038_28(int x) { return x * 28; }
+inline int f5038_29(int x) { return x * 29; }
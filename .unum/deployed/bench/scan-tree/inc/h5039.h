@@ -0,0 +1,42 @@
+#pragma once
+/* header 5039 */
+#include <vector>
+#include "h3148.h"
+#include "h4995.h"
+#include "h1916.h"
+#include "h3172.h"
+#include "h9089.h"
+#ifdef X
+#include "h4790.h"
+#endif
+struct S5039 { int a; const char *s = "x//y"; };
+inline int f5039_0(int x) { return x * 0; }
+inline int f5039_1(int x) { return x * 1; }
+inline int f5039_2(int x) { return x * 2; }
+inline int f5039_3(int x) { return x * 3; }
+inline int f5039_4(int x) { return x * 4; }
+inline int f5039_5(int x) { return x * 5; }
+inline int f5039_6(int x) { return x * 6; }
+inline int f5039_7(int x) { return x * 7; }
+inline int f5039_8(int x) { return x * 8; }
+inline int f5039_9(int x) { return x * 9; }
+inline int f5039_10(int x) { return x * 10; }
+inline int f5039_11(int x) { return x * 11; }
+inline int f5039_12(int x) { return x * 12; }
+inline int f5039_13(int x) { return x * 13; }
+inline int f5039_14(int x) { return x * 14; }
+inline int f5039_15(int x) { return x * 15; }
+inline int f5039_16(int x) { return x * 16; }
+inline int f5039_17(int x) { return x * 17; }
+inline int f5039_18(int x) { return x * 18; }
+inline int f5039_19(int x) { return x * 19; }
+inline int f5039_20(int x) { return x * 20; }
+inline int f5039_21(int x) { return x * 21; }
+inline int f5039_22(int x) { return x * 22; }
+inline int f5039_23(int x) { return x * 23; }
+inline int f5039_24(int x) { return x * 24; }
+inline int f5039_25(int x) { return x * 25; }
+inline int f5039_26(int x) { return x * 26; }
+inline int f5039_27(int x) { return x * 27; }
+inline int f5039_28(int x) { return x * 28; }
+inline int f5039_29(int x) { return x * 29; }
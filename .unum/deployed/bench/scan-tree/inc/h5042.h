@@ -0,0 +1,42 @@
+#pragma once
+/* header 5042 */
+#include <vector>
+#include "h9335.h"
+#include "h4619.h"
+#include "h4651.h"
+#include "h4648.h"
+#include "h6471.h"
+#ifdef X
+#include "h1530.h"
+#endif
+struct S5042 { int a; const char *s = "x//y"; };
+inline int f5042_0(int x) { return x * 0; }
+inline int f5042_1(int x) { return x * 1; }
+inline int f5042_2(int x) { return x * 2; }
+inline int f5042_3(int x) { return x * 3; }
+inline int f5042_4(int x) { return x * 4; }
+inline int f5042_5(int x) { return x * 5; }
+inline int f5042_6(int x) { return x * 6; }
+inline int f5042_7(int x) { return x * 7; }
+inline int f5042_8(int x) { return x * 8; }
+inline int f5042_9(int x) { return x * 9; }
+inline int f5042_10(int x) { return x * 10; }
+inline int f5042_11(int x) { return x * 11; }
+inline int f5042_12(int x) { return x * 12; }
+inline int f5042_13(int x) { return x * 13; }
+inline int f5042_14(int x) { return x * 14; }
+inline int f5042_15(int x) { return x * 15; }
+inline int f5042_16(int x) { return x * 16; }
+inline int f5042_17(int x) { return x * 17; }
+inline int f5042_18(int x) { return x * 18; }
+inline int f5042_19(int x) { return x * 19; }
+inline int f5042_20(int x) { return x * 20; }
+inline int f5042_21(int x) { return x * 21; }
+inline int f5042_22(int x) { return x * 22; }
+inline int f5042_23(int x) { return x * 23; }
+inline int f5042_24(int x) { return x * 24; }
+inline int f5042_25(int x) { return x * 25; }
+inline int f5042_26(int x) { return x * 26; }
+inline int f5042_27(int x) { return x * 27; }
+inline int f5042_28(int x) { return x * 28; }
+inline int f5042_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5043 */
+#include <vector>
+#include "h5483.h"
+#include "h3687.h"
+#include "h1834.h"
+#include "h1556.h"
+#include "h4538.h"
+#ifdef X
+#include "h5331.h"
+#endif
+struct S5043 { int a; const char *s = "x//y"; };
+inline int f5043_0(int x) { return x * 0; }
+inline int f5043_1(int x) { return x * 1; }
+inline int f5043_2(int x) { return x * 2; }
+inline int f5043_3(int x) { return x * 3; }
+inline int f5043_4(int x) { return x * 4; }
+inline int f5043_5(int x) { return x * 5; }
+inline int f5043_6(int x) { return x * 6; }
+inline int f5043_7(int x) { return x * 7; }
+inline int f5043_8(int x) { return x * 8; }
+inline int f5043_9(int x) { return x * 9; }
+inline int f5043_10(int x) { return x * 10; }
+inline int f5043_11(int x) { return x * 11; }
+inline int f5043_12(int x) { return x * 12; }
+inline int f5043_13(int x) { return x * 13; }
+inline int f5043_14(int x) { return x * 14; }
+inline int f5043_15(int x) { return x * 15; }
+inline int f5043_16(int x) { return x * 16; }
+inline int f5043_17(int x) { return x * 17; }
+inline int f5043_18(int x) { return x * 18; }
+inline int f5043_19(int x) { return x * 19; }
+inline int f5043_20(int x) { return x * 20; }
+inline int f5043_21(int x) { return x * 21; }
+inline int f5043_22(int x) { return x * 22; }
+inline int f5043_23(int x) { return x * 23; }
+inline int f5043_24(int x) { return x * 24; }
+inline int f5043_25(int x) { return x * 25; }
+inline int f5043_26(int x) { return x * 26; }
+inline int f5043_27(int x) { return x * 27; }
+inline int f5043_28(int x) { return x * 28; }
+inline int f5043_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5044 */
+#include <vector>
+#include "h6559.h"
+#include "h6465.h"
+#include "h1870.h"
+#include "h4704.h"
+#include "h957.h"
+#ifdef X
+#include "h8496.h"
+#endif
+struct S5044 { int a; const char *s = "x//y"; };
+inline int f5044_0(int x) { return x * 0; }
+inline int f5044_1(int x) { return x * 1; }
+inline int f5044_2(int x) { return x * 2; }
+inline int f5044_3(int x) { return x * 3; }
+inline int f5044_4(int x) { return x * 4; }
+inline int f5044_5(int x) { return x * 5; }
+inline int f5044_6(int x) { return x * 6; }
+inline int f5044_7(int x) { return x * 7; }
+inline int f5044_8(int x) { return x * 8; }
+inline int f5044_9(int x) { return x * 9; }
+inline int f5044_10(int x) { return x * 10; }
+inline int f5044_11(int x) { return x * 11; }
+inline int f5044_12(int x) { return x * 12; }
+inline int f5044_13(int x) { return x * 13; }
+inline int f5044_14(int x) { return x * 14; }
+inline int f5044_15(int x) { return x * 15; }
+inline int f5044_16(int x) { return x * 16; }
+inline int f5044_17(int x) { return x * 17; }
+inline int f5044_18(int x) { return x * 18; }
+inline int f5044_19(int x) { return x * 19; }
+inline int f5044_20(int x) { return x * 20; }
+inline int f5044_21(int x) { return x * 21; }
+inline int f5044_22(int x) { return x * 22; }
+inline int f5044_23(int x) { return x * 23; }
+inline int f5044_24(int x) { return x * 24; }
+inline int f5044_25(int x) { return x * 25; }
+inline int f5044_26(int x) { return x * 26; }
+inline int f5044_27(int x) { return x * 27; }
+inline int f5044_28(int x) { return x * 28; }
+inline int f5044_29(int x) { return x * 29; }
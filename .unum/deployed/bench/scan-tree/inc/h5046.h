@@ -0,0 +1,42 @@
+#pragma once
+/* header 5046 */
+#include <vector>
+#include "h1635.h"
+#include "h3073.h"
+#include "h4863.h"
+#include "h6065.h"
+#include "h5807.h"
+#ifdef X
+#include "h261.h"
+#endif
+struct S5046 { int a; const char *s = "x//y"; };
+inline int f5046_0(int x) { return x * 0; }
+inline int f5046_1(int x) { return x * 1; }
+inline int f5046_2(int x) { return x * 2; }
+inline int f5046_3(int x) { return x * 3; }
+inline int f5046_4(int x) { return x * 4; }
+inline int f5046_5(int x) { return x * 5; }
+inline int f5046_6(int x) { return x * 6; }
+inline int f5046_7(int x) { return x * 7; }
+inline int f5046_8(int x) { return x * 8; }
+inline int f5046_9(int x) { return x * 9; }
+inline int f5046_10(int x) { return x * 10; }
+inline int f5046_11(int x) { return x * 11; }
+inline int f5046_12(int x) { return x * 12; }
+inline int f5046_13(int x) { return x * 13; }
+inline int f5046_14(int x) { return x * 14; }
+inline int f5046_15(int x) { return x * 15; }
+inline int f5046_16(int x) { return x * 16; }
+inline int f5046_17(int x) { return x * 17; }
+inline int f5046_18(int x) { return x * 18; }
+inline int f5046_19(int x) { return x * 19; }
+inline int f5046_20(int x) { return x * 20; }
+inline int f5046_21(int x) { return x * 21; }
+inline int f5046_22(int x) { return x * 22; }
+inline int f5046_23(int x) { return x * 23; }
+inline int f5046_24(int x) { return x * 24; }
+inline int f5046_25(int x) { return x * 25; }
+inline int f5046_26(int x) { return x * 26; }
+inline int f5046_27(int x) { return x * 27; }
+inline int f5046_28(int x) { return x * 28; }
+inline int f5046_29(int x) { return x * 29; }
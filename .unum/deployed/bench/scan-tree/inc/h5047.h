@@ -0,0 +1,42 @@
+#pragma once
+/* header 5047 */
+#include <vector>
+#include "h9487.h"
+#include "h9166.h"
+#include "h8332.h"
+#include "h8954.h"
+#include "h4614.h"
+#ifdef X
+#include "h828.h"
+#endif
+struct S5047 { int a; const char *s = "x//y"; };
+inline int f5047_0(int x) { return x * 0; }
+inline int f5047_1(int x) { return x * 1; }
+inline int f5047_2(int x) { return x * 2; }
+inline int f5047_3(int x) { return x * 3; }
+inline int f5047_4(int x) { return x * 4; }
+inline int f5047_5(int x) { return x * 5; }
+inline int f5047_6(int x) { return x * 6; }
+inline int f5047_7(int x) { return x * 7; }
+inline int f5047_8(int x) { return x * 8; }
+inline int f5047_9(int x) { return x * 9; }
+inline int f5047_10(int x) { return x * 10; }
+inline int f5047_11(int x) { return x * 11; }
+inline int f5047_12(int x) { return x * 12; }
+inline int f5047_13(int x) { return x * 13; }
+inline int f5047_14(int x) { return x * 14; }
+inline int f5047_15(int x) { return x * 15; }
+inline int f5047_16(int x) { return x * 16; }
+inline int f5047_17(int x) { return x * 17; }
+inline int f5047_18(int x) { return x * 18; }
+inline int f5047_19(int x) { return x * 19; }
+inline int f5047_20(int x) { return x * 20; }
+inline int f5047_21(int x) { return x * 21; }
+inline int f5047_22(int x) { return x * 22; }
+inline int f5047_23(int x) { return x * 23; }
+inline int f5047_24(int x) { return x * 24; }
+inline int f5047_25(int x) { return x * 25; }
+inline int f5047_26(int x) { return x * 26; }
+inline int f5047_27(int x) { return x * 27; }
+inline int f5047_28(int x) { return x * 28; }
+inline int f5047_29(int x) { return x * 29; }
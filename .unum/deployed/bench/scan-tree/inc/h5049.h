@@ -0,0 +1,42 @@
+#pragma once
+/* header 5049 */
+#include <vector>
+#include "h3707.h"
+#include "h5975.h"
+#include "h5470.h"
+#include "h7001.h"
+#include "h1931.h"
+#ifdef X
+#include "h7719.h"
+#endif
+struct S5049 { int a; const char *s = "x//y"; };
+inline int f5049_0(int x) { return x * 0; }
+inline int f5049_1(int x) { return x * 1; }
+inline int f5049_2(int x) { return x * 2; }
+inline int f5049_3(int x) { return x * 3; }
+inline int f5049_4(int x) { return x * 4; }
+inline int f5049_5(int x) { return x * 5; }
+inline int f5049_6(int x) { return x * 6; }
+inline int f5049_7(int x) { return x * 7; }
+inline int f5049_8(int x) { return x * 8; }
+inline int f5049_9(int x) { return x * 9; }
+inline int f5049_10(int x) { return x * 10; }
+inline int f5049_11(int x) { return x * 11; }
+inline int f5049_12(int x) { return x * 12; }
+inline int f5049_13(int x) { return x * 13; }
+inline int f5049_14(int x) { return x * 14; }
+inline int f5049_15(int x) { return x * 15; }
+inline int f5049_16(int x) { return x * 16; }
+inline int f5049_17(int x) { return x * 17; }
+inline int f5049_18(int x) { return x * 18; }
+inline int f5049_19(int x) { return x * 19; }
+inline int f5049_20(int x) { return x * 20; }
+inline int f5049_21(int x) { return x * 21; }
+inline int f5049_22(int x) { return x * 22; }
+inline int f5049_23(int x) { return x * 23; }
+inline int f5049_24(int x) { return x * 24; }
+inline int f5049_25(int x) { return x * 25; }
+inline int f5049_26(int x) { return x * 26; }
+inline int f5049_27(int x) { return x * 27; }
+inline int f5049_28(int x) { return x * 28; }
+inline int f5049_29(int x) { return x * 29; }
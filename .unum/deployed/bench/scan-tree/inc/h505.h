@@ -0,0 +1,42 @@
+#pragma once
+/* header 505 */
+#include <vector>
+#include "h7315.h"
+#include "h2354.h"
+#include "h4726.h"
+#include "h1019.h"
+#include "h4087.h"
+#ifdef X
+#include "h3605.h"
+#endif
+struct S505 { int a; const char *s = "x//y"; };
+inline int f505_0(int x) { return x * 0; }
+inline int f505_1(int x) { return x * 1; }
+inline int f505_2(int x) { return x * 2; }
+inline int f505_3(int x) { return x * 3; }
+inline int f505_4(int x) { return x * 4; }
+inline int f505_5(int x) { return x * 5; }
+inline int f505_6(int x) { return x * 6; }
+inline int f505_7(int x) { return x * 7; }
+inline int f505_8(int x) { return x * 8; }
+inline int f505_9(int x) { return x * 9; }
+inline int f505_10(int x) { return x * 10; }
+inline int f505_11(int x) { return x * 11; }
+inline int f505_12(int x) { return x * 12; }
+inline int f505_13(int x) { return x * 13; }
+inline int f505_14(int x) { return x * 14; }
+inline int f505_15(int x) { return x * 15; }
+inline int f505_16(int x) { return x * 16; }
+inline int f505_17(int x) { return x * 17; }
+inline int f505_18(int x) { return x * 18; }
+inline int f505_19(int x) { return x * 19; }
+inline int f505_20(int x) { return x * 20; }
+inline int f505_21(int x) { return x * 21; }
+inline int f505_22(int x) { return x * 22; }
+inline int f505_23(int x) { return x * 23; }
+inline int f505_24(int x) { return x * 24; }
+inline int f505_25(int x) { return x * 25; }
+inline int f505_26(int x) { return x * 26; }
+inline int f505_27(int x) { return x * 27; }
+inline int f505_28(int x) { return x * 28; }
+inline int f505_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5051 */
+#include <vector>
+#include "h4875.h"
+#include "h6268.h"
+#include "h405.h"
+#include "h9613.h"
+#include "h3078.h"
+#ifdef X
+#include "h5887.h"
+#endif
+struct S5051 { int a; const char *s = "x//y"; };
+inline int f5051_0(int x) { return x * 0; }
+inline int f5051_1(int x) { return x * 1; }
+inline int f5051_2(int x) { return x * 2; }
+inline int f5051_3(int x) { return x * 3; }
+inline int f5051_4(int x) { return x * 4; }
+inline int f5051_5(int x) { return x * 5; }
+inline int f5051_6(int x) { return x * 6; }
+inline int f5051_7(int x) { return x * 7; }
+inline int f5051_8(int x) { return x * 8; }
+inline int f5051_9(int x) { return x * 9; }
+inline int f5051_10(int x) { return x * 10; }
+inline int f5051_11(int x) { return x * 11; }
+inline int f5051_12(int x) { return x * 12; }
+inline int f5051_13(int x) { return x * 13; }
+inline int f5051_14(int x) { return x * 14; }
+inline int f5051_15(int x) { return x * 15; }
+inline int f5051_16(int x) { return x * 16; }
+inline int f5051_17(int x) { return x * 17; }
+inline int f5051_18(int x) { return x * 18; }
+inline int f5051_19(int x) { return x * 19; }
+inline int f5051_20(int x) { return x * 20; }
+inline int f5051_21(int x) { return x * 21; }
+inline int f5051_22(int x) { return x * 22; }
+inline int f5051_23(int x) { return x * 23; }
+inline int f5051_24(int x) { return x * 24; }
+inline int f5051_25(int x) { return x * 25; }
+inline int f5051_26(int x) { return x * 26; }
+inline int f5051_27(int x) { return x * 27; }
+inline int f5051_28(int x) { return x * 28; }
+inline int f5051_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5054 */
+#include <vector>
+#include "h3985.h"
+#include "h4466.h"
+#include "h2440.h"
+#include "h2474.h"
+#include "h1665.h"
+#ifdef X
+#include "h599.h"
+#endif
+struct S5054 { int a; const char *s = "x//y"; };
+inline int f5054_0(int x) { return x * 0; }
+inline int f5054_1(int x) { return x * 1; }
+inline int f5054_2(int x) { return x * 2; }
+inline int f5054_3(int x) { return x * 3; }
+inline int f5054_4(int x) { return x * 4; }
+inline int f5054_5(int x) { return x * 5; }
+inline int f5054_6(int x) { return x * 6; }
+inline int f5054_7(int x) { return x * 7; }
+inline int f5054_8(int x) { return x * 8; }
+inline int f5054_9(int x) { return x * 9; }
+inline int f5054_10(int x) { return x * 10; }
+inline int f5054_11(int x) { return x * 11; }
+inline int f5054_12(int x) { return x * 12; }
+inline int f5054_13(int x) { return x * 13; }
+inline int f5054_14(int x) { return x * 14; }
+inline int f5054_15(int x) { return x * 15; }
+inline int f5054_16(int x) { return x * 16; }
+inline int f5054_17(int x) { return x * 17; }
+inline int f5054_18(int x) { return x * 18; }
+inline int f5054_19(int x) { return x * 19; }
+inline int f5054_20(int x) { return x * 20; }
+inline int f5054_21(int x) { return x * 21; }
+inline int f5054_22(int x) { return x * 22; }
+inline int f5054_23(int x) { return x * 23; }
+inline int f5054_24(int x) { return x * 24; }
+inline int f5054_25(int x) { return x * 25; }
+inline int f5054_26(int x) { return x * 26; }
+inline int f5054_27(int x) { return x * 27; }
+inline int f5054_28(int x) { return x * 28; }
+inline int f5054_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5056 */
+#include <vector>
+#include "h9162.h"
+#include "h4985.h"
+#include "h8545.h"
+#include "h9192.h"
+#include "h8600.h"
+#ifdef X
+#include "h45.h"
+#endif
+struct S5056 { int a; const char *s = "x//y"; };
+inline int f5056_0(int x) { return x * 0; }
+inline int f5056_1(int x) { return x * 1; }
+inline int f5056_2(int x) { return x * 2; }
+inline int f5056_3(int x) { return x * 3; }
+inline int f5056_4(int x) { return x * 4; }
+inline int f5056_5(int x) { return x * 5; }
+inline int f5056_6(int x) { return x * 6; }
+inline int f5056_7(int x) { return x * 7; }
+inline int f5056_8(int x) { return x * 8; }
+inline int f5056_9(int x) { return x * 9; }
+inline int f5056_10(int x) { return x * 10; }
+inline int f5056_11(int x) { return x * 11; }
+inline int f5056_12(int x) { return x * 12; }
+inline int f5056_13(int x) { return x * 13; }
+inline int f5056_14(int x) { return x * 14; }
+inline int f5056_15(int x) { return x * 15; }
+inline int f5056_16(int x) { return x * 16; }
+inline int f5056_17(int x) { return x * 17; }
+inline int f5056_18(int x) { return x * 18; }
+inline int f5056_19(int x) { return x * 19; }
+inline int f5056_20(int x) { return x * 20; }
+inline int f5056_21(int x) { return x * 21; }
+inline int f5056_22(int x) { return x * 22; }
+inline int f5056_23(int x) { return x * 23; }
+inline int f5056_24(int x) { return x * 24; }
+inline int f5056_25(int x) { return x * 25; }
+inline int f5056_26(int x) { return x * 26; }
+inline int f5056_27(int x) { return x * 27; }
+inline int f5056_28(int x) { return x * 28; }
+inline int f5056_29(int x) { return x * 29; }
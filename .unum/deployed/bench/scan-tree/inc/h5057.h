@@ -0,0 +1,42 @@
+#pragma once
+/* header 5057 */
+#include <vector>
+#include "h8422.h"
+#include "h5675.h"
+#include "h5144.h"
+#include "h5475.h"
+#include "h8108.h"
+#ifdef X
+#include "h9059.h"
+#endif
+struct S5057 { int a; const char *s = "x//y"; };
+inline int f5057_0(int x) { return x * 0; }
+inline int f5057_1(int x) { return x * 1; }
+inline int f5057_2(int x) { return x * 2; }
+inline int f5057_3(int x) { return x * 3; }
+inline int f5057_4(int x) { return x * 4; }
+inline int f5057_5(int x) { return x * 5; }
+inline int f5057_6(int x) { return x * 6; }
+inline int f5057_7(int x) { return x * 7; }
+inline int f5057_8(int x) { return x * 8; }
+inline int f5057_9(int x) { return x * 9; }
+inline int f5057_10(int x) { return x * 10; }
+inline int f5057_11(int x) { return x * 11; }
+inline int f5057_12(int x) { return x * 12; }
+inline int f5057_13(int x) { return x * 13; }
+inline int f5057_14(int x) { return x * 14; }
+inline int f5057_15(int x) { return x * 15; }
+inline int f5057_16(int x) { return x * 16; }
+inline int f5057_17(int x) { return x * 17; }
+inline int f5057_18(int x) { return x * 18; }
+inline int f5057_19(int x) { return x * 19; }
+inline int f5057_20(int x) { return x * 20; }
+inline int f5057_21(int x) { return x * 21; }
+inline int f5057_22(int x) { return x * 22; }
+inline int f5057_23(int x) { return x * 23; }
+inline int f5057_24(int x) { return x * 24; }
+inline int f5057_25(int x) { return x * 25; }
+inline int f5057_26(int x) { return x * 26; }
+inline int f5057_27(int x) { return x * 27; }
+inline int f5057_28(int x) { return x * 28; }
+inline int f5057_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5062 */
+#include <vector>
+#include "h2495.h"
+#include "h3384.h"
+#include "h8795.h"
+#include "h3345.h"
+#include "h2005.h"
+#ifdef X
+#include "h4485.h"
+#endif
+struct S5062 { int a; const char *s = "x//y"; };
+inline int f5062_0(int x) { return x * 0; }
+inline int f5062_1(int x) { return x * 1; }
+inline int f5062_2(int x) { return x * 2; }
+inline int f5062_3(int x) { return x * 3; }
+inline int f5062_4(int x) { return x * 4; }
+inline int f5062_5(int x) { return x * 5; }
+inline int f5062_6(int x) { return x * 6; }
+inline int f5062_7(int x) { return x * 7; }
+inline int f5062_8(int x) { return x * 8; }
+inline int f5062_9(int x) { return x * 9; }
+inline int f5062_10(int x) { return x * 10; }
+inline int f5062_11(int x) { return x * 11; }
+inline int f5062_12(int x) { return x * 12; }
+inline int f5062_13(int x) { return x * 13; }
+inline int f5062_14(int x) { return x * 14; }
+inline int f5062_15(int x) { return x * 15; }
+inline int f5062_16(int x) { return x * 16; }
+inline int f5062_17(int x) { return x * 17; }
+inline int f5062_18(int x) { return x * 18; }
+inline int f5062_19(int x) { return x * 19; }
+inline int f5062_20(int x) { return x * 20; }
+inline int f5062_21(int x) { return x * 21; }
+inline int f5062_22(int x) { return x * 22; }
+inline int f5062_23(int x) { return x * 23; }
+inline int f5062_24(int x) { return x * 24; }
+inline int f5062_25(int x) { return x * 25; }
+inline int f5062_26(int x) { return x * 26; }
+inline int f5062_27(int x) { return x * 27; }
+inline int f5062_28(int x) { return x * 28; }
+inline int f5062_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5064 */
+#include <vector>
+#include "h9270.h"
+#include "h5759.h"
+#include "h108.h"
+#include "h4769.h"
+#include "h1198.h"
+#ifdef X
+#include "h6044.h"
+#endif
+struct S5064 { int a; const char *s = "x//y"; };
+inline int f5064_0(int x) { return x * 0; }
+inline int f5064_1(int x) { return x * 1; }
+inline int f5064_2(int x) { return x * 2; }
+inline int f5064_3(int x) { return x * 3; }
+inline int f5064_4(int x) { return x * 4; }
+inline int f5064_5(int x) { return x * 5; }
+inline int f5064_6(int x) { return x * 6; }
+inline int f5064_7(int x) { return x * 7; }
+inline int f5064_8(int x) { return x * 8; }
+inline int f5064_9(int x) { return x * 9; }
+inline int f5064_10(int x) { return x * 10; }
+inline int f5064_11(int x) { return x * 11; }
+inline int f5064_12(int x) { return x * 12; }
+inline int f5064_13(int x) { return x * 13; }
+inline int f5064_14(int x) { return x * 14; }
+inline int f5064_15(int x) { return x * 15; }
+inline int f5064_16(int x) { return x * 16; }
+inline int f5064_17(int x) { return x * 17; }
+inline int f5064_18(int x) { return x * 18; }
+inline int f5064_19(int x) { return x * 19; }
+inline int f5064_20(int x) { return x * 20; }
+inline int f5064_21(int x) { return x * 21; }
+inline int f5064_22(int x) { return x * 22; }
+inline int f5064_23(int x) { return x * 23; }
+inline int f5064_24(int x) { return x * 24; }
+inline int f5064_25(int x) { return x * 25; }
+inline int f5064_26(int x) { return x * 26; }
+inline int f5064_27(int x) { return x * 27; }
+inline int f5064_28(int x) { return x * 28; }
+inline int f5064_29(int x) { return x * 29; }
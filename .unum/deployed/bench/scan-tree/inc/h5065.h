@@ -0,0 +1,42 @@
+#pragma once
+/* header 5065 */
+#include <vector>
+#include "h1573.h"
+#include "h6525.h"
+#include "h1178.h"
+#include "h1859.h"
+#include "h2440.h"
+#ifdef X
+#include "h4515.h"
+#endif
+struct S5065 { int a; const char *s = "x//y"; };
+inline int f5065_0(int x) { return x * 0; }
+inline int f5065_1(int x) { return x * 1; }
+inline int f5065_2(int x) { return x * 2; }
+inline int f5065_3(int x) { return x * 3; }
+inline int f5065_4(int x) { return x * 4; }
+inline int f5065_5(int x) { return x * 5; }
+inline int f5065_6(int x) { return x * 6; }
+inline int f5065_7(int x) { return x * 7; }
+inline int f5065_8(int x) { return x * 8; }
+inline int f5065_9(int x) { return x * 9; }
+inline int f5065_10(int x) { return x * 10; }
+inline int f5065_11(int x) { return x * 11; }
+inline int f5065_12(int x) { return x * 12; }
+inline int f5065_13(int x) { return x * 13; }
+inline int f5065_14(int x) { return x * 14; }
+inline int f5065_15(int x) { return x * 15; }
+inline int f5065_16(int x) { return x * 16; }
+inline int f5065_17(int x) { return x * 17; }
+inline int f5065_18(int x) { return x * 18; }
+inline int f5065_19(int x) { return x * 19; }
+inline int f5065_20(int x) { return x * 20; }
+inline int f5065_21(int x) { return x * 21; }
+inline int f5065_22(int x) { return x * 22; }
+inline int f5065_23(int x) { return x * 23; }
+inline int f5065_24(int x) { return x * 24; }
+inline int f5065_25(int x) { return x * 25; }
+inline int f5065_26(int x) { return x * 26; }
+inline int f5065_27(int x) { return x * 27; }
+inline int f5065_28(int x) { return x * 28; }
+inline int f5065_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5066 */
+#include <vector>
+#include "h2428.h"
+#include "h7895.h"
+#include "h8968.h"
+#include "h7033.h"
+#include "h8057.h"
+#ifdef X
+#include "h7429.h"
+#endif
+struct S5066 { int a; const char *s = "x//y"; };
+inline int f5066_0(int x) { return x * 0; }
+inline int f5066_1(int x) { return x * 1; }
+inline int f5066_2(int x) { return x * 2; }
+inline int f5066_3(int x) { return x * 3; }
+inline int f5066_4(int x) { return x * 4; }
+inline int f5066_5(int x) { return x * 5; }
+inline int f5066_6(int x) { return x * 6; }
+inline int f5066_7(int x) { return x * 7; }
+inline int f5066_8(int x) { return x * 8; }
+inline int f5066_9(int x) { return x * 9; }
+inline int f5066_10(int x) { return x * 10; }
+inline int f5066_11(int x) { return x * 11; }
+inline int f5066_12(int x) { return x * 12; }
+inline int f5066_13(int x) { return x * 13; }
+inline int f5066_14(int x) { return x * 14; }
+inline int f5066_15(int x) { return x * 15; }
+inline int f5066_16(int x) { return x * 16; }
+inline int f5066_17(int x) { return x * 17; }
+inline int f5066_18(int x) { return x * 18; }
+inline int f5066_19(int x) { return x * 19; }
+inline int f5066_20(int x) { return x * 20; }
+inline int f5066_21(int x) { return x * 21; }
+inline int f5066_22(int x) { return x * 22; }
+inline int f5066_23(int x) { return x * 23; }
+inline int f5066_24(int x) { return x * 24; }
+inline int f5066_25(int x) { return x * 25; }
+inline int f5066_26(int x) { return x * 26; }
+inline int f5066_27(int x) { return x * 27; }
+inline int f5066_28(int x) { return x * 28; }
+inline int f5066_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5070 */
+#include <vector>
+#include "h5502.h"
+#include "h6924.h"
+#include "h7967.h"
+#include "h4747.h"
+#include "h7111.h"
+#ifdef X
+#include "h8195.h"
+#endif
+struct S5070 { int a; const char *s = "x//y"; };
+inline int f5070_0(int x) { return x * 0; }
+inline int f5070_1(int x) { return x * 1; }
+inline int f5070_2(int x) { return x * 2; }
+inline int f5070_3(int x) { return x * 3; }
+inline int f5070_4(int x) { return x * 4; }
+inline int f5070_5(int x) { return x * 5; }
+inline int f5070_6(int x) { return x * 6; }
+inline int f5070_7(int x) { return x * 7; }
+inline int f5070_8(int x) { return x * 8; }
+inline int f5070_9(int x) { return x * 9; }
+inline int f5070_10(int x) { return x * 10; }
+inline int f5070_11(int x) { return x * 11; }
+inline int f5070_12(int x) { return x * 12; }
+inline int f5070_13(int x) { return x * 13; }
+inline int f5070_14(int x) { return x * 14; }
+inline int f5070_15(int x) { return x * 15; }
+inline int f5070_16(int x) { return x * 16; }
+inline int f5070_17(int x) { return x * 17; }
+inline int f5070_18(int x) { return x * 18; }
+inline int f5070_19(int x) { return x * 19; }
+inline int f5070_20(int x) { return x * 20; }
+inline int f5070_21(int x) { return x * 21; }
+inline int f5070_22(int x) { return x * 22; }
+inline int f5070_23(int x) { return x * 23; }
+inline int f5070_24(int x) { return x * 24; }
+inline int f5070_25(int x) { return x * 25; }
+inline int f5070_26(int x) { return x * 26; }
+inline int f5070_27(int x) { return x * 27; }
+inline int f5070_28(int x) { return x * 28; }
+inline int f5070_29(int x) { return x * 29; }
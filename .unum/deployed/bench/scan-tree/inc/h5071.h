@@ -0,0 +1,42 @@
+#pragma once
+/* header 5071 */
+#include <vector>
+#include "h4097.h"
+#include "h825.h"
+#include "h6921.h"
+#include "h5723.h"
+#include "h8778.h"
+#ifdef X
+#include "h7921.h"
+#endif
+struct S5071 { int a; const char *s = "x//y"; };
+inline int f5071_0(int x) { return x * 0; }
+inline int f5071_1(int x) { return x * 1; }
+inline int f5071_2(int x) { return x * 2; }
+inline int f5071_3(int x) { return x * 3; }
+inline int f5071_4(int x) { return x * 4; }
+inline int f5071_5(int x) { return x * 5; }
+inline int f5071_6(int x) { return x * 6; }
+inline int f5071_7(int x) { return x * 7; }
+inline int f5071_8(int x) { return x * 8; }
+inline int f5071_9(int x) { return x * 9; }
+inline int f5071_10(int x) { return x * 10; }
+inline int f5071_11(int x) { return x * 11; }
+inline int f5071_12(int x) { return x * 12; }
+inline int f5071_13(int x) { return x * 13; }
+inline int f5071_14(int x) { return x * 14; }
+inline int f5071_15(int x) { return x * 15; }
+inline int f5071_16(int x) { return x * 16; }
+inline int f5071_17(int x) { return x * 17; }
+inline int f5071_18(int x) { return x * 18; }
+inline int f5071_19(int x) { return x * 19; }
+inline int f5071_20(int x) { return x * 20; }
+inline int f5071_21(int x) { return x * 21; }
+inline int f5071_22(int x) { return x * 22; }
+inline int f5071_23(int x) { return x * 23; }
+inline int f5071_24(int x) { return x * 24; }
+inline int f5071_25(int x) { return x * 25; }
+inline int f5071_26(int x) { return x * 26; }
+inline int f5071_27(int x) { return x * 27; }
+inline int f5071_28(int x) { return x * 28; }
+inline int f5071_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5073 */
+#include <vector>
+#include "h5010.h"
+#include "h6670.h"
+#include "h8843.h"
+#include "h8329.h"
+#include "h4053.h"
+#ifdef X
+#include "h2507.h"
+#endif
+struct S5073 { int a; const char *s = "x//y"; };
+inline int f5073_0(int x) { return x * 0; }
+inline int f5073_1(int x) { return x * 1; }
+inline int f5073_2(int x) { return x * 2; }
+inline int f5073_3(int x) { return x * 3; }
+inline int f5073_4(int x) { return x * 4; }
+inline int f5073_5(int x) { return x * 5; }
+inline int f5073_6(int x) { return x * 6; }
+inline int f5073_7(int x) { return x * 7; }
+inline int f5073_8(int x) { return x * 8; }
+inline int f5073_9(int x) { return x * 9; }
+inline int f5073_10(int x) { return x * 10; }
+inline int f5073_11(int x) { return x * 11; }
+inline int f5073_12(int x) { return x * 12; }
+inline int f5073_13(int x) { return x * 13; }
+inline int f5073_14(int x) { return x * 14; }
+inline int f5073_15(int x) { return x * 15; }
+inline int f5073_16(int x) { return x * 16; }
+inline int f5073_17(int x) { return x * 17; }
+inline int f5073_18(int x) { return x * 18; }
+inline int f5073_19(int x) { return x * 19; }
+inline int f5073_20(int x) { return x * 20; }
+inline int f5073_21(int x) { return x * 21; }
+inline int f5073_22(int x) { return x * 22; }
+inline int f5073_23(int x) { return x * 23; }
+inline int f5073_24(int x) { return x * 24; }
+inline int f5073_25(int x) { return x * 25; }
+inline int f5073_26(int x) { return x * 26; }
+inline int f5073_27(int x) { return x * 27; }
+inline int f5073_28(int x) { return x * 28; }
+inline int f5073_29(int x) { return x * 29; }
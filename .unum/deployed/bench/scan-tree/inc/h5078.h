@@ -0,0 +1,42 @@
+#pragma once
+/* header 5078 */
+#include <vector>
+#include "h7813.h"
+#include "h6828.h"
+#include "h2359.h"
+#include "h2781.h"
+#include "h7522.h"
+#ifdef X
+#include "h5381.h"
+#endif
+struct S5078 { int a; const char *s = "x//y"; };
+inline int f5078_0(int x) { return x * 0; }
+inline int f5078_1(int x) { return x * 1; }
+inline int f5078_2(int x) { return x * 2; }
+inline int f5078_3(int x) { return x * 3; }
+inline int f5078_4(int x) { return x * 4; }
+inline int f5078_5(int x) { return x * 5; }
+inline int f5078_6(int x) { return x * 6; }
+inline int f5078_7(int x) { return x * 7; }
+inline int f5078_8(int x) { return x * 8; }
+inline int f5078_9(int x) { return x * 9; }
+inline int f5078_10(int x) { return x * 10; }
+inline int f5078_11(int x) { return x * 11; }
+inline int f5078_12(int x) { return x * 12; }
+inline int f5078_13(int x) { return x * 13; }
+inline int f5078_14(int x) { return x * 14; }
+inline int f5078_15(int x) { return x * 15; }
+inline int f5078_16(int x) { return x * 16; }
+inline int f5078_17(int x) { return x * 17; }
+inline int f5078_18(int x) { return x * 18; }
+inline int f5078_19(int x) { return x * 19; }
+inline int f5078_20(int x) { return x * 20; }
+inline int f5078_21(int x) { return x * 21; }
+inline int f5078_22(int x) { return x * 22; }
+inline int f5078_23(int x) { return x * 23; }
+inline int f5078_24(int x) { return x * 24; }
+inline int f5078_25(int x) { return x * 25; }
+inline int f5078_26(int x) { return x * 26; }
+inline int f5078_27(int x) { return x * 27; }
+inline int f5078_28(int x) { return x * 28; }
+inline int f5078_29(int x) { return x * 29; }
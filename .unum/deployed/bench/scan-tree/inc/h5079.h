@@ -0,0 +1,42 @@
+#pragma once
+/* header 5079 */
+#include <vector>
+#include "h2177.h"
+#include "h1678.h"
+#include "h5931.h"
+#include "h929.h"
+#include "h55.h"
+#ifdef X
+#include "h2243.h"
+#endif
+struct S5079 { int a; const char *s = "x//y"; };
+inline int f5079_0(int x) { return x * 0; }
+inline int f5079_1(int x) { return x * 1; }
+inline int f5079_2(int x) { return x * 2; }
+inline int f5079_3(int x) { return x * 3; }
+inline int f5079_4(int x) { return x * 4; }
+inline int f5079_5(int x) { return x * 5; }
+inline int f5079_6(int x) { return x * 6; }
+inline int f5079_7(int x) { return x * 7; }
+inline int f5079_8(int x) { return x * 8; }
+inline int f5079_9(int x) { return x * 9; }
+inline int f5079_10(int x) { return x * 10; }
+inline int f5079_11(int x) { return x * 11; }
+inline int f5079_12(int x) { return x * 12; }
+inline int f5079_13(int x) { return x * 13; }
+inline int f5079_14(int x) { return x * 14; }
+inline int f5079_15(int x) { return x * 15; }
+inline int f5079_16(int x) { return x * 16; }
+inline int f5079_17(int x) { return x * 17; }
+inline int f5079_18(int x) { return x * 18; }
+inline int f5079_19(int x) { return x * 19; }
+inline int f5079_20(int x) { return x * 20; }
+inline int f5079_21(int x) { return x * 21; }
+inline int f5079_22(int x) { return x * 22; }
+inline int f5079_23(int x) { return x * 23; }
+inline int f5079_24(int x) { return x * 24; }
+inline int f5079_25(int x) { return x * 25; }
+inline int f5079_26(int x) { return x * 26; }
+inline int f5079_27(int x) { return x * 27; }
+inline int f5079_28(int x) { return x * 28; }
+inline int f5079_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5081 */
+#include <vector>
+#include "h2674.h"
+#include "h7574.h"
+#include "h3866.h"
+#include "h7738.h"
+#include "h5899.h"
+#ifdef X
+#include "h6999.h"
+#endif
+struct S5081 { int a; const char *s = "x//y"; };
+inline int f5081_0(int x) { return x * 0; }
+inline int f5081_1(int x) { return x * 1; }
+inline int f5081_2(int x) { return x * 2; }
+inline int f5081_3(int x) { return x * 3; }
+inline int f5081_4(int x) { return x * 4; }
+inline int f5081_5(int x) { return x * 5; }
+inline int f5081_6(int x) { return x * 6; }
+inline int f5081_7(int x) { return x * 7; }
+inline int f5081_8(int x) { return x * 8; }
+inline int f5081_9(int x) { return x * 9; }
+inline int f5081_10(int x) { return x * 10; }
+inline int f5081_11(int x) { return x * 11; }
+inline int f5081_12(int x) { return x * 12; }
+inline int f5081_13(int x) { return x * 13; }
+inline int f5081_14(int x) { return x * 14; }
+inline int f5081_15(int x) { return x * 15; }
+inline int f5081_16(int x) { return x * 16; }
+inline int f5081_17(int x) { return x * 17; }
+inline int f5081_18(int x) { return x * 18; }
+inline int f5081_19(int x) { return x * 19; }
+inline int f5081_20(int x) { return x * 20; }
+inline int f5081_21(int x) { return x * 21; }
+inline int f5081_22(int x) { return x * 22; }
+inline int f5081_23(int x) { return x * 23; }
+inline int f5081_24(int x) { return x * 24; }
+inline int f5081_25(int x) { return x * 25; }
+inline int f5081_26(int x) { return x * 26; }
+inline int f5081_27(int x) { return x * 27; }
+inline int f5081_28(int x) { return x * 28; }
+inline int f5081_29(int x) { return x * 29; }
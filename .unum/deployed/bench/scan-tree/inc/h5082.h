@@ -0,0 +1,42 @@
+#pragma once
+/* header 5082 */
+#include <vector>
+#include "h2787.h"
+#include "h5067.h"
+#include "h185.h"
+#include "h6626.h"
+#include "h7040.h"
+#ifdef X
+#include "h2511.h"
+#endif
+struct S5082 { int a; const char *s = "x//y"; };
+inline int f5082_0(int x) { return x * 0; }
+inline int f5082_1(int x) { return x * 1; }
+inline int f5082_2(int x) { return x * 2; }
+inline int f5082_3(int x) { return x * 3; }
+inline int f5082_4(int x) { return x * 4; }
+inline int f5082_5(int x) { return x * 5; }
+inline int f5082_6(int x) { return x * 6; }
+inline int f5082_7(int x) { return x * 7; }
+inline int f5082_8(int x) { return x * 8; }
+inline int f5082_9(int x) { return x * 9; }
+inline int f5082_10(int x) { return x * 10; }
+inline int f5082_11(int x) { return x * 11; }
+inline int f5082_12(int x) { return x * 12; }
+inline int f5082_13(int x) { return x * 13; }
+inline int f5082_14(int x) { return x * 14; }
+inline int f5082_15(int x) { return x * 15; }
+inline int f5082_16(int x) { return x * 16; }
+inline int f5082_17(int x) { return x * 17; }
+inline int f5082_18(int x) { return x * 18; }
+inline int f5082_19(int x) { return x * 19; }
+inline int f5082_20(int x) { return x * 20; }
+inline int f5082_21(int x) { return x * 21; }
+inline int f5082_22(int x) { return x * 22; }
+inline int f5082_23(int x) { return x * 23; }
+inline int f5082_24(int x) { return x * 24; }
+inline int f5082_25(int x) { return x * 25; }
+inline int f5082_26(int x) { return x * 26; }
+inline int f5082_27(int x) { return x * 27; }
+inline int f5082_28(int x) { return x * 28; }
+inline int f5082_29(int x) { return x * 29; }
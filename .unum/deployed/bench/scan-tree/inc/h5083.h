@@ -0,0 +1,42 @@
+#pragma once
+/* header 5083 */
+#include <vector>
+#include "h6154.h"
+#include "h3389.h"
+#include "h7553.h"
+#include "h5511.h"
+#include "h2671.h"
+#ifdef X
+#include "h2743.h"
+#endif
+struct S5083 { int a; const char *s = "x//y"; };
+inline int f5083_0(int x) { return x * 0; }
+inline int f5083_1(int x) { return x * 1; }
+inline int f5083_2(int x) { return x * 2; }
+inline int f5083_3(int x) { return x * 3; }
+inline int f5083_4(int x) { return x * 4; }
+inline int f5083_5(int x) { return x * 5; }
+inline int f5083_6(int x) { return x * 6; }
+inline int f5083_7(int x) { return x * 7; }
+inline int f5083_8(int x) { return x * 8; }
+inline int f5083_9(int x) { return x * 9; }
+inline int f5083_10(int x) { return x * 10; }
+inline int f5083_11(int x) { return x * 11; }
+inline int f5083_12(int x) { return x * 12; }
+inline int f5083_13(int x) { return x * 13; }
+inline int f5083_14(int x) { return x * 14; }
+inline int f5083_15(int x) { return x * 15; }
+inline int f5083_16(int x) { return x * 16; }
+inline int f5083_17(int x) { return x * 17; }
+inline int f5083_18(int x) { return x * 18; }
+inline int f5083_19(int x) { return x * 19; }
+inline int f5083_20(int x) { return x * 20; }
+inline int f5083_21(int x) { return x * 21; }
+inline int f5083_22(int x) { return x * 22; }
+inline int f5083_23(int x) { return x * 23; }
+inline int f5083_24(int x) { return x * 24; }
+inline int f5083_25(int x) { return x * 25; }
+inline int f5083_26(int x) { return x * 26; }
+inline int f5083_27(int x) { return x * 27; }
+inline int f5083_28(int x) { return x * 28; }
+inline int f5083_29(int x) { return x * 29; }
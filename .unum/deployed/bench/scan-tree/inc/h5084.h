@@ -0,0 +1,42 @@
+#pragma once
+/* header 5084 */
+#include <vector>
+#include "h8808.h"
+#include "h8404.h"
+#include "h9198.h"
+#include "h1413.h"
+#include "h198.h"
+#ifdef X
+#include "h9872.h"
+#endif
+struct S5084 { int a; const char *s = "x//y"; };
+inline int f5084_0(int x) { return x * 0; }
+inline int f5084_1(int x) { return x * 1; }
+inline int f5084_2(int x) { return x * 2; }
+inline int f5084_3(int x) { return x * 3; }
+inline int f5084_4(int x) { return x * 4; }
+inline int f5084_5(int x) { return x * 5; }
+inline int f5084_6(int x) { return x * 6; }
+inline int f5084_7(int x) { return x * 7; }
+inline int f5084_8(int x) { return x * 8; }
+inline int f5084_9(int x) { return x * 9; }
+inline int f5084_10(int x) { return x * 10; }
+inline int f5084_11(int x) { return x * 11; }
+inline int f5084_12(int x) { return x * 12; }
+inline int f5084_13(int x) { return x * 13; }
+inline int f5084_14(int x) { return x * 14; }
+inline int f5084_15(int x) { return x * 15; }
+inline int f5084_16(int x) { return x * 16; }
+inline int f5084_17(int x) { return x * 17; }
+inline int f5084_18(int x) { return x * 18; }
+inline int f5084_19(int x) { return x * 19; }
+inline int f5084_20(int x) { return x * 20; }
+inline int f5084_21(int x) { return x * 21; }
+inline int f5084_22(int x) { return x * 22; }
+inline int f5084_23(int x) { return x * 23; }
+inline int f5084_24(int x) { return x * 24; }
+inline int f5084_25(int x) { return x * 25; }
+inline int f5084_26(int x) { return x * 26; }
+inline int f5084_27(int x) { return x * 27; }
+inline int f5084_28(int x) { return x * 28; }
+inline int f5084_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5085 */
+#include <vector>
+#include "h2624.h"
+#include "h9894.h"
+#include "h1000.h"
+#include "h6358.h"
+#include "h2513.h"
+#ifdef X
+#include "h4625.h"
+#endif
+struct S5085 { int a; const char *s = "x//y"; };
+inline int f5085_0(int x) { return x * 0; }
+inline int f5085_1(int x) { return x * 1; }
+inline int f5085_2(int x) { return x * 2; }
+inline int f5085_3(int x) { return x * 3; }
+inline int f5085_4(int x) { return x * 4; }
+inline int f5085_5(int x) { return x * 5; }
+inline int f5085_6(int x) { return x * 6; }
+inline int f5085_7(int x) { return x * 7; }
+inline int f5085_8(int x) { return x * 8; }
+inline int f5085_9(int x) { return x * 9; }
+inline int f5085_10(int x) { return x * 10; }
+inline int f5085_11(int x) { return x * 11; }
+inline int f5085_12(int x) { return x * 12; }
+inline int f5085_13(int x) { return x * 13; }
+inline int f5085_14(int x) { return x * 14; }
+inline int f5085_15(int x) { return x * 15; }
+inline int f5085_16(int x) { return x * 16; }
+inline int f5085_17(int x) { return x * 17; }
+inline int f5085_18(int x) { return x * 18; }
+inline int f5085_19(int x) { return x * 19; }
+inline int f5085_20(int x) { return x * 20; }
+inline int f5085_21(int x) { return x * 21; }
+inline int f5085_22(int x) { return x * 22; }
+inline int f5085_23(int x) { return x * 23; }
+inline int f5085_24(int x) { return x * 24; }
+inline int f5085_25(int x) { return x * 25; }
+inline int f5085_26(int x) { return x * 26; }
+inline int f5085_27(int x) { return x * 27; }
+inline int f5085_28(int x) { return x * 28; }
+inline int f5085_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 509 */
+#include <vector>
+#include "h4607.h"
+#include "h7606.h"
+#include "h5645.h"
+#include "h6317.h"
+#include "h3288.h"
+#ifdef X
+#include "h9944.h"
+#endif
+struct S509 { int a; const char *s = "x//y"; };
+inline int f509_0(int x) { return x * 0; }
+inline int f509_1(int x) { return x * 1; }
+inline int f509_2(int x) { return x * 2; }
+inline int f509_3(int x) { return x * 3; }
+inline int f509_4(int x) { return x * 4; }
+inline int f509_5(int x) { return x * 5; }
+inline int f509_6(int x) { return x * 6; }
+inline int f509_7(int x) { return x * 7; }
+inline int f509_8(int x) { return x * 8; }
+inline int f509_9(int x) { return x * 9; }
+inline int f509_10(int x) { return x * 10; }
+inline int f509_11(int x) { return x * 11; }
+inline int f509_12(int x) { return x * 12; }
+inline int f509_13(int x) { return x * 13; }
+inline int f509_14(int x) { return x * 14; }
+inline int f509_15(int x) { return x * 15; }
+inline int f509_16(int x) { return x * 16; }
+inline int f509_17(int x) { return x * 17; }
+inline int f509_18(int x) { return x * 18; }
+inline int f509_19(int x) { return x * 19; }
+inline int f509_20(int x) { return x * 20; }
+inline int f509_21(int x) { return x * 21; }
+inline int f509_22(int x) { return x * 22; }
+inline int f509_23(int x) { return x * 23; }
+inline int f509_24(int x) { return x * 24; }
+inline int f509_25(int x) { return x * 25; }
+inline int f509_26(int x) { return x * 26; }
+inline int f509_27(int x) { return x * 27; }
+inline int f509_28(int x) { return x * 28; }
+inline int f509_29(int x) { return x * 29; }
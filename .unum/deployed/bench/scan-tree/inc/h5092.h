@@ -0,0 +1,42 @@
+#pragma once
+/* header 5092 */
+#include <vector>
+#include "h7126.h"
+#include "h8588.h"
+#include "h9212.h"
+#include "h8863.h"
+#include "h6221.h"
+#ifdef X
+#include "h2577.h"
+#endif
+struct S5092 { int a; const char *s = "x//y"; };
+inline int f5092_0(int x) { return x * 0; }
+inline int f5092_1(int x) { return x * 1; }
+inline int f5092_2(int x) { return x * 2; }
+inline int f5092_3(int x) { return x * 3; }
+inline int f5092_4(int x) { return x * 4; }
+inline int f5092_5(int x) { return x * 5; }
+inline int f5092_6(int x) { return x * 6; }
+inline int f5092_7(int x) { return x * 7; }
+inline int f5092_8(int x) { return x * 8; }
+inline int f5092_9(int x) { return x * 9; }
+inline int f5092_10(int x) { return x * 10; }
+inline int f5092_11(int x) { return x * 11; }
+inline int f5092_12(int x) { return x * 12; }
+inline int f5092_13(int x) { return x * 13; }
+inline int f5092_14(int x) { return x * 14; }
+inline int f5092_15(int x) { return x * 15; }
+inline int f5092_16(int x) { return x * 16; }
+inline int f5092_17(int x) { return x * 17; }
+inline int f5092_18(int x) { return x * 18; }
+inline int f5092_19(int x) { return x * 19; }
+inline int f5092_20(int x) { return x * 20; }
+inline int f5092_21(int x) { return x * 21; }
+inline int f5092_22(int x) { return x * 22; }
+inline int f5092_23(int x) { return x * 23; }
+inline int f5092_24(int x) { return x * 24; }
+inline int f5092_25(int x) { return x * 25; }
+inline int f5092_26(int x) { return x * 26; }
+inline int f5092_27(int x) { return x * 27; }
+inline int f5092_28(int x) { return x * 28; }
+inline int f5092_29(int x) { return x * 29; }
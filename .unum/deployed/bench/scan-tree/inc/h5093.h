@@ -0,0 +1,42 @@
+#pragma once
+/* header 5093 */
+#include <vector>
+#include "h5946.h"
+#include "h9167.h"
+#include "h683.h"
+#include "h9836.h"
+#include "h4013.h"
+#ifdef X
+#include "h2582.h"
+#endif
+struct S5093 { int a; const char *s = "x//y"; };
+inline int f5093_0(int x) { return x * 0; }
+inline int f5093_1(int x) { return x * 1; }
+inline int f5093_2(int x) { return x * 2; }
+inline int f5093_3(int x) { return x * 3; }
+inline int f5093_4(int x) { return x * 4; }
+inline int f5093_5(int x) { return x * 5; }
+inline int f5093_6(int x) { return x * 6; }
+inline int f5093_7(int x) { return x * 7; }
+inline int f5093_8(int x) { return x * 8; }
+inline int f5093_9(int x) { return x * 9; }
+inline int f5093_10(int x) { return x * 10; }
+inline int f5093_11(int x) { return x * 11; }
+inline int f5093_12(int x) { return x * 12; }
+inline int f5093_13(int x) { return x * 13; }
+inline int f5093_14(int x) { return x * 14; }
+inline int f5093_15(int x) { return x * 15; }
+inline int f5093_16(int x) { return x * 16; }
+inline int f5093_17(int x) { return x * 17; }
+inline int f5093_18(int x) { return x * 18; }
+inline int f5093_19(int x) { return x * 19; }
+inline int f5093_20(int x) { return x * 20; }
+inline int f5093_21(int x) { return x * 21; }
+inline int f5093_22(int x) { return x * 22; }
+inline int f5093_23(int x) { return x * 23; }
+inline int f5093_24(int x) { return x * 24; }
+inline int f5093_25(int x) { return x * 25; }
+inline int f5093_26(int x) { return x * 26; }
+inline int f5093_27(int x) { return x * 27; }
+inline int f5093_28(int x) { return x * 28; }
+inline int f5093_29(int x) { return x * 29; }
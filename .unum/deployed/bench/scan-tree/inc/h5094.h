@@ -0,0 +1,42 @@
+#pragma once
+/* header 5094 */
+#include <vector>
+#include "h9253.h"
+#include "h9061.h"
+#include "h9992.h"
+#include "h7885.h"
+#include "h5569.h"
+#ifdef X
+#include "h1859.h"
+#endif
+struct S5094 { int a; const char *s = "x//y"; };
+inline int f5094_0(int x) { return x * 0; }
+inline int f5094_1(int x) { return x * 1; }
+inline int f5094_2(int x) { return x * 2; }
+inline int f5094_3(int x) { return x * 3; }
+inline int f5094_4(int x) { return x * 4; }
+inline int f5094_5(int x) { return x * 5; }
+inline int f5094_6(int x) { return x * 6; }
+inline int f5094_7(int x) { return x * 7; }
+inline int f5094_8(int x) { return x * 8; }
+inline int f5094_9(int x) { return x * 9; }
+inline int f5094_10(int x) { return x * 10; }
+inline int f5094_11(int x) { return x * 11; }
+inline int f5094_12(int x) { return x * 12; }
+inline int f5094_13(int x) { return x * 13; }
+inline int f5094_14(int x) { return x * 14; }
+inline int f5094_15(int x) { return x * 15; }
+inline int f5094_16(int x) { return x * 16; }
+inline int f5094_17(int x) { return x * 17; }
+inline int f5094_18(int x) { return x * 18; }
+inline int f5094_19(int x) { return x * 19; }
+inline int f5094_20(int x) { return x * 20; }
+inline int f5094_21(int x) { return x * 21; }
+inline int f5094_22(int x) { return x * 22; }
+inline int f5094_23(int x) { return x * 23; }
+inline int f5094_24(int x) { return x * 24; }
+inline int f5094_25(int x) { return x * 25; }
+inline int f5094_26(int x) { return x * 26; }
+inline int f5094_27(int x) { return x * 27; }
+inline int f5094_28(int x) { return x * 28; }
+inline int f5094_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5096 */
+#include <vector>
+#include "h4430.h"
+#include "h5154.h"
+#include "h6943.h"
+#include "h6824.h"
+#include "h5655.h"
+#ifdef X
+#include "h264.h"
+#endif
+struct S5096 { int a; const char *s = "x//y"; };
+inline int f5096_0(int x) { return x * 0; }
+inline int f5096_1(int x) { return x * 1; }
+inline int f5096_2(int x) { return x * 2; }
+inline int f5096_3(int x) { return x * 3; }
+inline int f5096_4(int x) { return x * 4; }
+inline int f5096_5(int x) { return x * 5; }
+inline int f5096_6(int x) { return x * 6; }
+inline int f5096_7(int x) { return x * 7; }
+inline int f5096_8(int x) { return x * 8; }
+inline int f5096_9(int x) { return x * 9; }
+inline int f5096_10(int x) { return x * 10; }
+inline int f5096_11(int x) { return x * 11; }
+inline int f5096_12(int x) { return x * 12; }
+inline int f5096_13(int x) { return x * 13; }
+inline int f5096_14(int x) { return x * 14; }
+inline int f5096_15(int x) { return x * 15; }
+inline int f5096_16(int x) { return x * 16; }
+inline int f5096_17(int x) { return x * 17; }
+inline int f5096_18(int x) { return x * 18; }
+inline int f5096_19(int x) { return x * 19; }
+inline int f5096_20(int x) { return x * 20; }
+inline int f5096_21(int x) { return x * 21; }
+inline int f5096_22(int x) { return x * 22; }
+inline int f5096_23(int x) { return x * 23; }
+inline int f5096_24(int x) { return x * 24; }
+inline int f5096_25(int x) { return x * 25; }
+inline int f5096_26(int x) { return x * 26; }
+inline int f5096_27(int x) { return x * 27; }
+inline int f5096_28(int x) { return x * 28; }
+inline int f5096_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5098 */
+#include <vector>
+#include "h3479.h"
+#include "h7772.h"
+#include "h5717.h"
+#include "h2502.h"
+#include "h2125.h"
+#ifdef X
+#include "h6066.h"
+#endif
+struct S5098 { int a; const char *s = "x//y"; };
+inline int f5098_0(int x) { return x * 0; }
+inline int f5098_1(int x) { return x * 1; }
+inline int f5098_2(int x) { return x * 2; }
+inline int f5098_3(int x) { return x * 3; }
+inline int f5098_4(int x) { return x * 4; }
+inline int f5098_5(int x) { return x * 5; }
+inline int f5098_6(int x) { return x * 6; }
+inline int f5098_7(int x) { return x * 7; }
+inline int f5098_8(int x) { return x * 8; }
+inline int f5098_9(int x) { return x * 9; }
+inline int f5098_10(int x) { return x * 10; }
+inline int f5098_11(int x) { return x * 11; }
+inline int f5098_12(int x) { return x * 12; }
+inline int f5098_13(int x) { return x * 13; }
+inline int f5098_14(int x) { return x * 14; }
+inline int f5098_15(int x) { return x * 15; }
+inline int f5098_16(int x) { return x * 16; }
+inline int f5098_17(int x) { return x * 17; }
+inline int f5098_18(int x) { return x * 18; }
+inline int f5098_19(int x) { return x * 19; }
+inline int f5098_20(int x) { return x * 20; }
+inline int f5098_21(int x) { return x * 21; }
+inline int f5098_22(int x) { return x * 22; }
+inline int f5098_23(int x) { return x * 23; }
+inline int f5098_24(int x) { return x * 24; }
+inline int f5098_25(int x) { return x * 25; }
+inline int f5098_26(int x) { return x * 26; }
+inline int f5098_27(int x) { return x * 27; }
+inline int f5098_28(int x) { return x * 28; }
+inline int f5098_29(int x) { return x * 29; }
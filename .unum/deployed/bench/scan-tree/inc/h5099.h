@@ -0,0 +1,42 @@
+#pragma once
+/* header 5099 */
+#include <vector>
+#include "h2830.h"
+#include "h3468.h"
+#include "h2235.h"
+#include "h5202.h"
+#include "h5502.h"
+#ifdef X
+#include "h649.h"
+#endif
+struct S5099 { int a; const char *s = "x//y"; };
+inline int f5099_0(int x) { return x * 0; }
+inline int f5099_1(int x) { return x * 1; }
+inline int f5099_2(int x) { return x * 2; }
+inline int f5099_3(int x) { return x * 3; }
+inline int f5099_4(int x) { return x * 4; }
+inline int f5099_5(int x) { return x * 5; }
+inline int f5099_6(int x) { return x * 6; }
+inline int f5099_7(int x) { return x * 7; }
+inline int f5099_8(int x) { return x * 8; }
+inline int f5099_9(int x) { return x * 9; }
+inline int f5099_10(int x) { return x * 10; }
+inline int f5099_11(int x) { return x * 11; }
+inline int f5099_12(int x) { return x * 12; }
+inline int f5099_13(int x) { return x * 13; }
+inline int f5099_14(int x) { return x * 14; }
+inline int f5099_15(int x) { return x * 15; }
+inline int f5099_16(int x) { return x * 16; }
+inline int f5099_17(int x) { return x * 17; }
+inline int f5099_18(int x) { return x * 18; }
+inline int f5099_19(int x) { return x * 19; }
+inline int f5099_20(int x) { return x * 20; }
+inline int f5099_21(int x) { return x * 21; }
+inline int f5099_22(int x) { return x * 22; }
+inline int f5099_23(int x) { return x * 23; }
+inline int f5099_24(int x) { return x * 24; }
+inline int f5099_25(int x) { return x * 25; }
+inline int f5099_26(int x) { return x * 26; }
+inline int f5099_27(int x) { return x * 27; }
+inline int f5099_28(int x) { return x * 28; }
+inline int f5099_29(int x) { return x * 29; }
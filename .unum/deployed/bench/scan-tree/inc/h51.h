@@ -0,0 +1,42 @@
+#pragma once
+/* header 51 */
+#include <vector>
+#include "h4368.h"
+#include "h7518.h"
+#include "h7022.h"
+#include "h4851.h"
+#include "h5915.h"
+#ifdef X
+#include "h1580.h"
+#endif
+struct S51 { int a; const char *s = "x//y"; };
+inline int f51_0(int x) { return x * 0; }
+inline int f51_1(int x) { return x * 1; }
+inline int f51_2(int x) { return x * 2; }
+inline int f51_3(int x) { return x * 3; }
+inline int f51_4(int x) { return x * 4; }
+inline int f51_5(int x) { return x * 5; }
+inline int f51_6(int x) { return x * 6; }
+inline int f51_7(int x) { return x * 7; }
+inline int f51_8(int x) { return x * 8; }
+inline int f51_9(int x) { return x * 9; }
+inline int f51_10(int x) { return x * 10; }
+inline int f51_11(int x) { return x * 11; }
+inline int f51_12(int x) { return x * 12; }
+inline int f51_13(int x) { return x * 13; }
+inline int f51_14(int x) { return x * 14; }
+inline int f51_15(int x) { return x * 15; }
+inline int f51_16(int x) { return x * 16; }
+inline int f51_17(int x) { return x * 17; }
+inline int f51_18(int x) { return x * 18; }
+inline int f51_19(int x) { return x * 19; }
+inline int f51_20(int x) { return x * 20; }
+inline int f51_21(int x) { return x * 21; }
+inline int f51_22(int x) { return x * 22; }
+inline int f51_23(int x) { return x * 23; }
+inline int f51_24(int x) { return x * 24; }
+inline int f51_25(int x) { return x * 25; }
+inline int f51_26(int x) { return x * 26; }
+inline int f51_27(int x) { return x * 27; }
+inline int f51_28(int x) { return x * 28; }
+inline int f51_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5101 */
+#include <vector>
+#include "h5656.h"
+#include "h5976.h"
+#include "h9425.h"
+#include "h5218.h"
+#include "h9259.h"
+#ifdef X
+#include "h4773.h"
+#endif
+struct S5101 { int a; const char *s = "x//y"; };
+inline int f5101_0(int x) { return x * 0; }
+inline int f5101_1(int x) { return x * 1; }
+inline int f5101_2(int x) { return x * 2; }
+inline int f5101_3(int x) { return x * 3; }
+inline int f5101_4(int x) { return x * 4; }
+inline int f5101_5(int x) { return x * 5; }
+inline int f5101_6(int x) { return x * 6; }
+inline int f5101_7(int x) { return x * 7; }
+inline int f5101_8(int x) { return x * 8; }
+inline int f5101_9(int x) { return x * 9; }
+inline int f5101_10(int x) { return x * 10; }
+inline int f5101_11(int x) { return x * 11; }
+inline int f5101_12(int x) { return x * 12; }
+inline int f5101_13(int x) { return x * 13; }
+inline int f5101_14(int x) { return x * 14; }
+inline int f5101_15(int x) { return x * 15; }
+inline int f5101_16(int x) { return x * 16; }
+inline int f5101_17(int x) { return x * 17; }
+inline int f5101_18(int x) { return x * 18; }
+inline int f5101_19(int x) { return x * 19; }
+inline int f5101_20(int x) { return x * 20; }
+inline int f5101_21(int x) { return x * 21; }
+inline int f5101_22(int x) { return x * 22; }
+inline int f5101_23(int x) { return x * 23; }
+inline int f5101_24(int x) { return x * 24; }
+inline int f5101_25(int x) { return x * 25; }
+inline int f5101_26(int x) { return x * 26; }
+inline int f5101_27(int x) { return x * 27; }
+inline int f5101_28(int x) { return x * 28; }
+inline int f5101_29(int x) { return x * 29; }
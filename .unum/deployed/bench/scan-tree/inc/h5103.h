@@ -0,0 +1,42 @@
+#pragma once
+/* header 5103 */
+#include <vector>
+#include "h9902.h"
+#include "h2808.h"
+#include "h4497.h"
+#include "h8567.h"
+#include "h7152.h"
+#ifdef X
+#include "h8166.h"
+#endif
+struct S5103 { int a; const char *s = "x//y"; };
+inline int f5103_0(int x) { return x * 0; }
+inline int f5103_1(int x) { return x * 1; }
+inline int f5103_2(int x) { return x * 2; }
+inline int f5103_3(int x) { return x * 3; }
+inline int f5103_4(int x) { return x * 4; }
+inline int f5103_5(int x) { return x * 5; }
+inline int f5103_6(int x) { return x * 6; }
+inline int f5103_7(int x) { return x * 7; }
+inline int f5103_8(int x) { return x * 8; }
+inline int f5103_9(int x) { return x * 9; }
+inline int f5103_10(int x) { return x * 10; }
+inline int f5103_11(int x) { return x * 11; }
+inline int f5103_12(int x) { return x * 12; }
+inline int f5103_13(int x) { return x * 13; }
+inline int f5103_14(int x) { return x * 14; }
+inline int f5103_15(int x) { return x * 15; }
+inline int f5103_16(int x) { return x * 16; }
+inline int f5103_17(int x) { return x * 17; }
+inline int f5103_18(int x) { return x * 18; }
+inline int f5103_19(int x) { return x * 19; }
+inline int f5103_20(int x) { return x * 20; }
+inline int f5103_21(int x) { return x * 21; }
+inline int f5103_22(int x) { return x * 22; }
+inline int f5103_23(int x) { return x * 23; }
+inline int f5103_24(int x) { return x * 24; }
+inline int f5103_25(int x) { return x * 25; }
+inline int f5103_26(int x) { return x * 26; }
+inline int f5103_27(int x) { return x * 27; }
+inline int f5103_28(int x) { return x * 28; }
+inline int f5103_29(int x) { return x * 29; }
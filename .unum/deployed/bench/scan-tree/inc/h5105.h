@@ -0,0 +1,42 @@
+#pragma once
+/* header 5105 */
+#include <vector>
+#include "h2521.h"
+#include "h7361.h"
+#include "h2878.h"
+#include "h6156.h"
+#include "h390.h"
+#ifdef X
+#include "h7656.h"
+#endif
+struct S5105 { int a; const char *s = "x//y"; };
+inline int f5105_0(int x) { return x * 0; }
+inline int f5105_1(int x) { return x * 1; }
+inline int f5105_2(int x) { return x * 2; }
+inline int f5105_3(int x) { return x * 3; }
+inline int f5105_4(int x) { return x * 4; }
+inline int f5105_5(int x) { return x * 5; }
+inline int f5105_6(int x) { return x * 6; }
+inline int f5105_7(int x) { return x * 7; }
+inline int f5105_8(int x) { return x * 8; }
+inline int f5105_9(int x) { return x * 9; }
+inline int f5105_10(int x) { return x * 10; }
+inline int f5105_11(int x) { return x * 11; }
+inline int f5105_12(int x) { return x * 12; }
+inline int f5105_13(int x) { return x * 13; }
+inline int f5105_14(int x) { return x * 14; }
+inline int f5105_15(int x) { return x * 15; }
+inline int f5105_16(int x) { return x * 16; }
+inline int f5105_17(int x) { return x * 17; }
+inline int f5105_18(int x) { return x * 18; }
+inline int f5105_19(int x) { return x * 19; }
+inline int f5105_20(int x) { return x * 20; }
+inline int f5105_21(int x) { return x * 21; }
+inline int f5105_22(int x) { return x * 22; }
+inline int f5105_23(int x) { return x * 23; }
+inline int f5105_24(int x) { return x * 24; }
+inline int f5105_25(int x) { return x * 25; }
+inline int f5105_26(int x) { return x * 26; }
+inline int f5105_27(int x) { return x * 27; }
+inline int f5105_28(int x) { return x * 28; }
+inline int f5105_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5109 */
+#include <vector>
+#include "h4262.h"
+#include "h6419.h"
+#include "h1560.h"
+#include "h6363.h"
+#include "h813.h"
+#ifdef X
+#include "h3420.h"
+#endif
+struct S5109 { int a; const char *s = "x//y"; };
+inline int f5109_0(int x) { return x * 0; }
+inline int f5109_1(int x) { return x * 1; }
+inline int f5109_2(int x) { return x * 2; }
+inline int f5109_3(int x) { return x * 3; }
+inline int f5109_4(int x) { return x * 4; }
+inline int f5109_5(int x) { return x * 5; }
+inline int f5109_6(int x) { return x * 6; }
+inline int f5109_7(int x) { return x * 7; }
+inline int f5109_8(int x) { return x * 8; }
+inline int f5109_9(int x) { return x * 9; }
+inline int f5109_10(int x) { return x * 10; }
+inline int f5109_11(int x) { return x * 11; }
+inline int f5109_12(int x) { return x * 12; }
+inline int f5109_13(int x) { return x * 13; }
+inline int f5109_14(int x) { return x * 14; }
+inline int f5109_15(int x) { return x * 15; }
+inline int f5109_16(int x) { return x * 16; }
+inline int f5109_17(int x) { return x * 17; }
+inline int f5109_18(int x) { return x * 18; }
+inline int f5109_19(int x) { return x * 19; }
+inline int f5109_20(int x) { return x * 20; }
+inline int f5109_21(int x) { return x * 21; }
+inline int f5109_22(int x) { return x * 22; }
+inline int f5109_23(int x) { return x * 23; }
+inline int f5109_24(int x) { return x * 24; }
+inline int f5109_25(int x) { return x * 25; }
+inline int f5109_26(int x) { return x * 26; }
+inline int f5109_27(int x) { return x * 27; }
+inline int f5109_28(int x) { return x * 28; }
+inline int f5109_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 511 */
+#include <vector>
+#include "h8297.h"
+#include "h5349.h"
+#include "h7535.h"
+#include "h9701.h"
+#include "h1653.h"
+#ifdef X
+#include "h1991.h"
+#endif
+struct S511 { int a; const char *s = "x//y"; };
+inline int f511_0(int x) { return x * 0; }
+inline int f511_1(int x) { return x * 1; }
+inline int f511_2(int x) { return x * 2; }
+inline int f511_3(int x) { return x * 3; }
+inline int f511_4(int x) { return x * 4; }
+inline int f511_5(int x) { return x * 5; }
+inline int f511_6(int x) { return x * 6; }
+inline int f511_7(int x) { return x * 7; }
+inline int f511_8(int x) { return x * 8; }
+inline int f511_9(int x) { return x * 9; }
+inline int f511_10(int x) { return x * 10; }
+inline int f511_11(int x) { return x * 11; }
+inline int f511_12(int x) { return x * 12; }
+inline int f511_13(int x) { return x * 13; }
+inline int f511_14(int x) { return x * 14; }
+inline int f511_15(int x) { return x * 15; }
+inline int f511_16(int x) { return x * 16; }
+inline int f511_17(int x) { return x * 17; }
+inline int f511_18(int x) { return x * 18; }
+inline int f511_19(int x) { return x * 19; }
+inline int f511_20(int x) { return x * 20; }
+inline int f511_21(int x) { return x * 21; }
+inline int f511_22(int x) { return x * 22; }
+inline int f511_23(int x) { return x * 23; }
+inline int f511_24(int x) { return x * 24; }
+inline int f511_25(int x) { return x * 25; }
+inline int f511_26(int x) { return x * 26; }
+inline int f511_27(int x) { return x * 27; }
+inline int f511_28(int x) { return x * 28; }
+inline int f511_29(int x) { return x * 29; }
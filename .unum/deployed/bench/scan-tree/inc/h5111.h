@@ -0,0 +1,42 @@
+#pragma once
+/* header 5111 */
+#include <vector>
+#include "h6502.h"
+#include "h232.h"
+#include "h8464.h"
+#include "h5157.h"
+#include "h9252.h"
+#ifdef X
+#include "h5853.h"
+#endif
+struct S5111 { int a; const char *s = "x//y"; };
+inline int f5111_0(int x) { return x * 0; }
+inline int f5111_1(int x) { return x * 1; }
+inline int f5111_2(int x) { return x * 2; }
+inline int f5111_3(int x) { return x * 3; }
+inline int f5111_4(int x) { return x * 4; }
+inline int f5111_5(int x) { return x * 5; }
+inline int f5111_6(int x) { return x * 6; }
+inline int f5111_7(int x) { return x * 7; }
+inline int f5111_8(int x) { return x * 8; }
+inline int f5111_9(int x) { return x * 9; }
+inline int f5111_10(int x) { return x * 10; }
+inline int f5111_11(int x) { return x * 11; }
+inline int f5111_12(int x) { return x * 12; }
+inline int f5111_13(int x) { return x * 13; }
+inline int f5111_14(int x) { return x * 14; }
+inline int f5111_15(int x) { return x * 15; }
+inline int f5111_16(int x) { return x * 16; }
+inline int f5111_17(int x) { return x * 17; }
+inline int f5111_18(int x) { return x * 18; }
+inline int f5111_19(int x) { return x * 19; }
+inline int f5111_20(int x) { return x * 20; }
+inline int f5111_21(int x) { return x * 21; }
+inline int f5111_22(int x) { return x * 22; }
+inline int f5111_23(int x) { return x * 23; }
+inline int f5111_24(int x) { return x * 24; }
+inline int f5111_25(int x) { return x * 25; }
+inline int f5111_26(int x) { return x * 26; }
+inline int f5111_27(int x) { return x * 27; }
+inline int f5111_28(int x) { return x * 28; }
+inline int f5111_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5114 */
+#include <vector>
+#include "h2975.h"
+#include "h1855.h"
+#include "h4574.h"
+#include "h2439.h"
+#include "h7137.h"
+#ifdef X
+#include "h5984.h"
+#endif
+struct S5114 { int a; const char *s = "x//y"; };
+inline int f5114_0(int x) { return x * 0; }
+inline int f5114_1(int x) { return x * 1; }
+inline int f5114_2(int x) { return x * 2; }
+inline int f5114_3(int x) { return x * 3; }
+inline int f5114_4(int x) { return x * 4; }
+inline int f5114_5(int x) { return x * 5; }
+inline int f5114_6(int x) { return x * 6; }
+inline int f5114_7(int x) { return x * 7; }
+inline int f5114_8(int x) { return x * 8; }
+inline int f5114_9(int x) { return x * 9; }
+inline int f5114_10(int x) { return x * 10; }
+inline int f5114_11(int x) { return x * 11; }
+inline int f5114_12(int x) { return x * 12; }
+inline int f5114_13(int x) { return x * 13; }
+inline int f5114_14(int x) { return x * 14; }
+inline int f5114_15(int x) { return x * 15; }
+inline int f5114_16(int x) { return x * 16; }
+inline int f5114_17(int x) { return x * 17; }
+inline int f5114_18(int x) { return x * 18; }
+inline int f5114_19(int x) { return x * 19; }
+inline int f5114_20(int x) { return x * 20; }
+inline int f5114_21(int x) { return x * 21; }
+inline int f5114_22(int x) { return x * 22; }
+inline int f5114_23(int x) { return x * 23; }
+inline int f5114_24(int x) { return x * 24; }
+inline int f5114_25(int x) { return x * 25; }
+inline int f5114_26(int x) { return x * 26; }
+inline int f5114_27(int x) { return x * 27; }
+inline int f5114_28(int x) { return x * 28; }
+inline int f5114_29(int x) { return x * 29; }
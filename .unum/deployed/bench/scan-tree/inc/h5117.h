@@ -0,0 +1,42 @@
+#pragma once
+/* header 5117 */
+#include <vector>
+#include "h9553.h"
+#include "h9192.h"
+#include "h171.h"
+#include "h792.h"
+#include "h6983.h"
+#ifdef X
+#include "h5741.h"
+#endif
+struct S5117 { int a; const char *s = "x//y"; };
+inline int f5117_0(int x) { return x * 0; }
+inline int f5117_1(int x) { return x * 1; }
+inline int f5117_2(int x) { return x * 2; }
+inline int f5117_3(int x) { return x * 3; }
+inline int f5117_4(int x) { return x * 4; }
+inline int f5117_5(int x) { return x * 5; }
+inline int f5117_6(int x) { return x * 6; }
+inline int f5117_7(int x) { return x * 7; }
+inline int f5117_8(int x) { return x * 8; }
+inline int f5117_9(int x) { return x * 9; }
+inline int f5117_10(int x) { return x * 10; }
+inline int f5117_11(int x) { return x * 11; }
+inline int f5117_12(int x) { return x * 12; }
+inline int f5117_13(int x) { return x * 13; }
+inline int f5117_14(int x) { return x * 14; }
+inline int f5117_15(int x) { return x * 15; }
+inline int f5117_16(int x) { return x * 16; }
+inline int f5117_17(int x) { return x * 17; }
+inline int f5117_18(int x) { return x * 18; }
+inline int f5117_19(int x) { return x * 19; }
+inline int f5117_20(int x) { return x * 20; }
+inline int f5117_21(int x) { return x * 21; }
+inline int f5117_22(int x) { return x * 22; }
+inline int f5117_23(int x) { return x * 23; }
+inline int f5117_24(int x) { return x * 24; }
+inline int f5117_25(int x) { return x * 25; }
+inline int f5117_26(int x) { return x * 26; }
+inline int f5117_27(int x) { return x * 27; }
+inline int f5117_28(int x) { return x * 28; }
+inline int f5117_29(int x) { return x * 29; }
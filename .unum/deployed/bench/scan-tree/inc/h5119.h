@@ -0,0 +1,42 @@
+#pragma once
+/* header 5119 */
+#include <vector>
+#include "h9508.h"
+#include "h2779.h"
+#include "h6375.h"
+#include "h1278.h"
+#include "h7647.h"
+#ifdef X
+#include "h8909.h"
+#endif
+struct S5119 { int a; const char *s = "x//y"; };
+inline int f5119_0(int x) { return x * 0; }
+inline int f5119_1(int x) { return x * 1; }
+inline int f5119_2(int x) { return x * 2; }
+inline int f5119_3(int x) { return x * 3; }
+inline int f5119_4(int x) { return x * 4; }
+inline int f5119_5(int x) { return x * 5; }
+inline int f5119_6(int x) { return x * 6; }
+inline int f5119_7(int x) { return x * 7; }
+inline int f5119_8(int x) { return x * 8; }
+inline int f5119_9(int x) { return x * 9; }
+inline int f5119_10(int x) { return x * 10; }
+inline int f5119_11(int x) { return x * 11; }
+inline int f5119_12(int x) { return x * 12; }
+inline int f5119_13(int x) { return x * 13; }
+inline int f5119_14(int x) { return x * 14; }
+inline int f5119_15(int x) { return x * 15; }
+inline int f5119_16(int x) { return x * 16; }
+inline int f5119_17(int x) { return x * 17; }
+inline int f5119_18(int x) { return x * 18; }
+inline int f5119_19(int x) { return x * 19; }
+inline int f5119_20(int x) { return x * 20; }
+inline int f5119_21(int x) { return x * 21; }
+inline int f5119_22(int x) { return x * 22; }
+inline int f5119_23(int x) { return x * 23; }
+inline int f5119_24(int x) { return x * 24; }
+inline int f5119_25(int x) { return x * 25; }
+inline int f5119_26(int x) { return x * 26; }
+inline int f5119_27(int x) { return x * 27; }
+inline int f5119_28(int x) { return x * 28; }
+inline int f5119_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 512 */
+#include <vector>
+#include "h9625.h"
+#include "h7301.h"
+#include "h8452.h"
+#include "h2592.h"
+#include "h7598.h"
+#ifdef X
+#include "h3120.h"
+#endif
+struct S512 { int a; const char *s = "x//y"; };
+inline int f512_0(int x) { return x * 0; }
+inline int f512_1(int x) { return x * 1; }
+inline int f512_2(int x) { return x * 2; }
+inline int f512_3(int x) { return x * 3; }
+inline int f512_4(int x) { return x * 4; }
+inline int f512_5(int x) { return x * 5; }
+inline int f512_6(int x) { return x * 6; }
+inline int f512_7(int x) { return x * 7; }
+inline int f512_8(int x) { return x * 8; }
+inline int f512_9(int x) { return x * 9; }
+inline int f512_10(int x) { return x * 10; }
+inline int f512_11(int x) { return x * 11; }
+inline int f512_12(int x) { return x * 12; }
+inline int f512_13(int x) { return x * 13; }
+inline int f512_14(int x) { return x * 14; }
+inline int f512_15(int x) { return x * 15; }
+inline int f512_16(int x) { return x * 16; }
+inline int f512_17(int x) { return x * 17; }
+inline int f512_18(int x) { return x * 18; }
+inline int f512_19(int x) { return x * 19; }
+inline int f512_20(int x) { return x * 20; }
+inline int f512_21(int x) { return x * 21; }
+inline int f512_22(int x) { return x * 22; }
+inline int f512_23(int x) { return x * 23; }
+inline int f512_24(int x) { return x * 24; }
+inline int f512_25(int x) { return x * 25; }
+inline int f512_26(int x) { return x * 26; }
+inline int f512_27(int x) { return x * 27; }
+inline int f512_28(int x) { return x * 28; }
+inline int f512_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5120 */
+#include <vector>
+#include "h6197.h"
+#include "h5427.h"
+#include "h1177.h"
+#include "h1250.h"
+#include "h1609.h"
+#ifdef X
+#include "h9921.h"
+#endif
+struct S5120 { int a; const char *s = "x//y"; };
+inline int f5120_0(int x) { return x * 0; }
+inline int f5120_1(int x) { return x * 1; }
+inline int f5120_2(int x) { return x * 2; }
+inline int f5120_3(int x) { return x * 3; }
+inline int f5120_4(int x) { return x * 4; }
+inline int f5120_5(int x) { return x * 5; }
+inline int f5120_6(int x) { return x * 6; }
+inline int f5120_7(int x) { return x * 7; }
+inline int f5120_8(int x) { return x * 8; }
+inline int f5120_9(int x) { return x * 9; }
+inline int f5120_10(int x) { return x * 10; }
+inline int f5120_11(int x) { return x * 11; }
+inline int f5120_12(int x) { return x * 12; }
+inline int f5120_13(int x) { return x * 13; }
+inline int f5120_14(int x) { return x * 14; }
+inline int f5120_15(int x) { return x * 15; }
+inline int f5120_16(int x) { return x * 16; }
+inline int f5120_17(int x) { return x * 17; }
+inline int f5120_18(int x) { return x * 18; }
+inline int f5120_19(int x) { return x * 19; }
+inline int f5120_20(int x) { return x * 20; }
+inline int f5120_21(int x) { return x * 21; }
+inline int f5120_22(int x) { return x * 22; }
+inline int f5120_23(int x) { return x * 23; }
+inline int f5120_24(int x) { return x * 24; }
+inline int f5120_25(int x) { return x * 25; }
+inline int f5120_26(int x) { return x * 26; }
+inline int f5120_27(int x) { return x * 27; }
+inline int f5120_28(int x) { return x * 28; }
+inline int f5120_29(int x) { return x * 29; }
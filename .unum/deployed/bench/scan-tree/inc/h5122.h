@@ -0,0 +1,42 @@
+#pragma once
+/* header 5122 */
+#include <vector>
+#include "h8180.h"
+#include "h4124.h"
+#include "h9407.h"
+#include "h5990.h"
+#include "h5493.h"
+#ifdef X
+#include "h8955.h"
+#endif
+struct S5122 { int a; const char *s = "x//y"; };
+inline int f5122_0(int x) { return x * 0; }
+inline int f5122_1(int x) { return x * 1; }
+inline int f5122_2(int x) { return x * 2; }
+inline int f5122_3(int x) { return x * 3; }
+inline int f5122_4(int x) { return x * 4; }
+inline int f5122_5(int x) { return x * 5; }
+inline int f5122_6(int x) { return x * 6; }
+inline int f5122_7(int x) { return x * 7; }
+inline int f5122_8(int x) { return x * 8; }
+inline int f5122_9(int x) { return x * 9; }
+inline int f5122_10(int x) { return x * 10; }
+inline int f5122_11(int x) { return x * 11; }
+inline int f5122_12(int x) { return x * 12; }
+inline int f5122_13(int x) { return x * 13; }
+inline int f5122_14(int x) { return x * 14; }
+inline int f5122_15(int x) { return x * 15; }
+inline int f5122_16(int x) { return x * 16; }
+inline int f5122_17(int x) { return x * 17; }
+inline int f5122_18(int x) { return x * 18; }
+inline int f5122_19(int x) { return x * 19; }
+inline int f5122_20(int x) { return x * 20; }
+inline int f5122_21(int x) { return x * 21; }
+inline int f5122_22(int x) { return x * 22; }
+inline int f5122_23(int x) { return x * 23; }
+inline int f5122_24(int x) { return x * 24; }
+inline int f5122_25(int x) { return x * 25; }
+inline int f5122_26(int x) { return x * 26; }
+inline int f5122_27(int x) { return x * 27; }
+inline int f5122_28(int x) { return x * 28; }
+inline int f5122_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5123 */
+#include <vector>
+#include "h2419.h"
+#include "h4897.h"
+#include "h2767.h"
+#include "h4028.h"
+#include "h6178.h"
+#ifdef X
+#include "h1633.h"
+#endif
+struct S5123 { int a; const char *s = "x//y"; };
+inline int f5123_0(int x) { return x * 0; }
+inline int f5123_1(int x) { return x * 1; }
+inline int f5123_2(int x) { return x * 2; }
+inline int f5123_3(int x) { return x * 3; }
+inline int f5123_4(int x) { return x * 4; }
+inline int f5123_5(int x) { return x * 5; }
+inline int f5123_6(int x) { return x * 6; }
+inline int f5123_7(int x) { return x * 7; }
+inline int f5123_8(int x) { return x * 8; }
+inline int f5123_9(int x) { return x * 9; }
+inline int f5123_10(int x) { return x * 10; }
+inline int f5123_11(int x) { return x * 11; }
+inline int f5123_12(int x) { return x * 12; }
+inline int f5123_13(int x) { return x * 13; }
+inline int f5123_14(int x) { return x * 14; }
+inline int f5123_15(int x) { return x * 15; }
+inline int f5123_16(int x) { return x * 16; }
+inline int f5123_17(int x) { return x * 17; }
+inline int f5123_18(int x) { return x * 18; }
+inline int f5123_19(int x) { return x * 19; }
+inline int f5123_20(int x) { return x * 20; }
+inline int f5123_21(int x) { return x * 21; }
+inline int f5123_22(int x) { return x * 22; }
+inline int f5123_23(int x) { return x * 23; }
+inline int f5123_24(int x) { return x * 24; }
+inline int f5123_25(int x) { return x * 25; }
+inline int f5123_26(int x) { return x * 26; }
+inline int f5123_27(int x) { return x * 27; }
+inline int f5123_28(int x) { return x * 28; }
+inline int f5123_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5125 */
+#include <vector>
+#include "h7320.h"
+#include "h682.h"
+#include "h3280.h"
+#include "h7047.h"
+#include "h6271.h"
+#ifdef X
+#include "h6528.h"
+#endif
+struct S5125 { int a; const char *s = "x//y"; };
+inline int f5125_0(int x) { return x * 0; }
+inline int f5125_1(int x) { return x * 1; }
+inline int f5125_2(int x) { return x * 2; }
+inline int f5125_3(int x) { return x * 3; }
+inline int f5125_4(int x) { return x * 4; }
+inline int f5125_5(int x) { return x * 5; }
+inline int f5125_6(int x) { return x * 6; }
+inline int f5125_7(int x) { return x * 7; }
+inline int f5125_8(int x) { return x * 8; }
+inline int f5125_9(int x) { return x * 9; }
+inline int f5125_10(int x) { return x * 10; }
+inline int f5125_11(int x) { return x * 11; }
+inline int f5125_12(int x) { return x * 12; }
+inline int f5125_13(int x) { return x * 13; }
+inline int f5125_14(int x) { return x * 14; }
+inline int f5125_15(int x) { return x * 15; }
+inline int f5125_16(int x) { return x * 16; }
+inline int f5125_17(int x) { return x * 17; }
+inline int f5125_18(int x) { return x * 18; }
+inline int f5125_19(int x) { return x * 19; }
+inline int f5125_20(int x) { return x * 20; }
+inline int f5125_21(int x) { return x * 21; }
+inline int f5125_22(int x) { return x * 22; }
+inline int f5125_23(int x) { return x * 23; }
+inline int f5125_24(int x) { return x * 24; }
+inline int f5125_25(int x) { return x * 25; }
+inline int f5125_26(int x) { return x * 26; }
+inline int f5125_27(int x) { return x * 27; }
+inline int f5125_28(int x) { return x * 28; }
+inline int f5125_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5127 */
+#include <vector>
+#include "h6328.h"
+#include "h6567.h"
+#include "h7658.h"
+#include "h7346.h"
+#include "h5296.h"
+#ifdef X
+#include "h4614.h"
+#endif
+struct S5127 { int a; const char *s = "x//y"; };
+inline int f5127_0(int x) { return x * 0; }
+inline int f5127_1(int x) { return x * 1; }
+inline int f5127_2(int x) { return x * 2; }
+inline int f5127_3(int x) { return x * 3; }
+inline int f5127_4(int x) { return x * 4; }
+inline int f5127_5(int x) { return x * 5; }
+inline int f5127_6(int x) { return x * 6; }
+inline int f5127_7(int x) { return x * 7; }
+inline int f5127_8(int x) { return x * 8; }
+inline int f5127_9(int x) { return x * 9; }
+inline int f5127_10(int x) { return x * 10; }
+inline int f5127_11(int x) { return x * 11; }
+inline int f5127_12(int x) { return x * 12; }
+inline int f5127_13(int x) { return x * 13; }
+inline int f5127_14(int x) { return x * 14; }
+inline int f5127_15(int x) { return x * 15; }
+inline int f5127_16(int x) { return x * 16; }
+inline int f5127_17(int x) { return x * 17; }
+inline int f5127_18(int x) { return x * 18; }
+inline int f5127_19(int x) { return x * 19; }
+inline int f5127_20(int x) { return x * 20; }
+inline int f5127_21(int x) { return x * 21; }
+inline int f5127_22(int x) { return x * 22; }
+inline int f5127_23(int x) { return x * 23; }
+inline int f5127_24(int x) { return x * 24; }
+inline int f5127_25(int x) { return x * 25; }
+inline int f5127_26(int x) { return x * 26; }
+inline int f5127_27(int x) { return x * 27; }
+inline int f5127_28(int x) { return x * 28; }
+inline int f5127_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5129 */
+#include <vector>
+#include "h8510.h"
+#include "h7410.h"
+#include "h60.h"
+#include "h2987.h"
+#include "h6382.h"
+#ifdef X
+#include "h69.h"
+#endif
+struct S5129 { int a; const char *s = "x//y"; };
+inline int f5129_0(int x) { return x * 0; }
+inline int f5129_1(int x) { return x * 1; }
+inline int f5129_2(int x) { return x * 2; }
+inline int f5129_3(int x) { return x * 3; }
+inline int f5129_4(int x) { return x * 4; }
+inline int f5129_5(int x) { return x * 5; }
+inline int f5129_6(int x) { return x * 6; }
+inline int f5129_7(int x) { return x * 7; }
+inline int f5129_8(int x) { return x * 8; }
+inline int f5129_9(int x) { return x * 9; }
+inline int f5129_10(int x) { return x * 10; }
+inline int f5129_11(int x) { return x * 11; }
+inline int f5129_12(int x) { return x * 12; }
+inline int f5129_13(int x) { return x * 13; }
+inline int f5129_14(int x) { return x * 14; }
+inline int f5129_15(int x) { return x * 15; }
+inline int f5129_16(int x) { return x * 16; }
+inline int f5129_17(int x) { return x * 17; }
+inline int f5129_18(int x) { return x * 18; }
+inline int f5129_19(int x) { return x * 19; }
+inline int f5129_20(int x) { return x * 20; }
+inline int f5129_21(int x) { return x * 21; }
+inline int f5129_22(int x) { return x * 22; }
+inline int f5129_23(int x) { return x * 23; }
+inline int f5129_24(int x) { return x * 24; }
+inline int f5129_25(int x) { return x * 25; }
+inline int f5129_26(int x) { return x * 26; }
+inline int f5129_27(int x) { return x * 27; }
+inline int f5129_28(int x) { return x * 28; }
+inline int f5129_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5132 */
+#include <vector>
+#include "h4611.h"
+#include "h2782.h"
+#include "h3906.h"
+#include "h3067.h"
+#include "h6220.h"
+#ifdef X
+#include "h107.h"
+#endif
+struct S5132 { int a; const char *s = "x//y"; };
+inline int f5132_0(int x) { return x * 0; }
+inline int f5132_1(int x) { return x * 1; }
+inline int f5132_2(int x) { return x * 2; }
+inline int f5132_3(int x) { return x * 3; }
+inline int f5132_4(int x) { return x * 4; }
+inline int f5132_5(int x) { return x * 5; }
+inline int f5132_6(int x) { return x * 6; }
+inline int f5132_7(int x) { return x * 7; }
+inline int f5132_8(int x) { return x * 8; }
+inline int f5132_9(int x) { return x * 9; }
+inline int f5132_10(int x) { return x * 10; }
+inline int f5132_11(int x) { return x * 11; }
+inline int f5132_12(int x) { return x * 12; }
+inline int f5132_13(int x) { return x * 13; }
+inline int f5132_14(int x) { return x * 14; }
+inline int f5132_15(int x) { return x * 15; }
+inline int f5132_16(int x) { return x * 16; }
+inline int f5132_17(int x) { return x * 17; }
+inline int f5132_18(int x) { return x * 18; }
+inline int f5132_19(int x) { return x * 19; }
+inline int f5132_20(int x) { return x * 20; }
+inline int f5132_21(int x) { return x * 21; }
+inline int f5132_22(int x) { return x * 22; }
+inline int f5132_23(int x) { return x * 23; }
+inline int f5132_24(int x) { return x * 24; }
+inline int f5132_25(int x) { return x * 25; }
+inline int f5132_26(int x) { return x * 26; }
+inline int f5132_27(int x) { return x * 27; }
+inline int f5132_28(int x) { return x * 28; }
+inline int f5132_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5135 */
+#include <vector>
+#include "h1762.h"
+#include "h1922.h"
+#include "h2341.h"
+#include "h2817.h"
+#include "h640.h"
+#ifdef X
+#include "h8853.h"
+#endif
+struct S5135 { int a; const char *s = "x//y"; };
+inline int f5135_0(int x) { return x * 0; }
+inline int f5135_1(int x) { return x * 1; }
+inline int f5135_2(int x) { return x * 2; }
+inline int f5135_3(int x) { return x * 3; }
+inline int f5135_4(int x) { return x * 4; }
+inline int f5135_5(int x) { return x * 5; }
+inline int f5135_6(int x) { return x * 6; }
+inline int f5135_7(int x) { return x * 7; }
+inline int f5135_8(int x) { return x * 8; }
+inline int f5135_9(int x) { return x * 9; }
+inline int f5135_10(int x) { return x * 10; }
+inline int f5135_11(int x) { return x * 11; }
+inline int f5135_12(int x) { return x * 12; }
+inline int f5135_13(int x) { return x * 13; }
+inline int f5135_14(int x) { return x * 14; }
+inline int f5135_15(int x) { return x * 15; }
+inline int f5135_16(int x) { return x * 16; }
+inline int f5135_17(int x) { return x * 17; }
+inline int f5135_18(int x) { return x * 18; }
+inline int f5135_19(int x) { return x * 19; }
+inline int f5135_20(int x) { return x * 20; }
+inline int f5135_21(int x) { return x * 21; }
+inline int f5135_22(int x) { return x * 22; }
+inline int f5135_23(int x) { return x * 23; }
+inline int f5135_24(int x) { return x * 24; }
+inline int f5135_25(int x) { return x * 25; }
+inline int f5135_26(int x) { return x * 26; }
+inline int f5135_27(int x) { return x * 27; }
+inline int f5135_28(int x) { return x * 28; }
+inline int f5135_29(int x) { return x * 29; }
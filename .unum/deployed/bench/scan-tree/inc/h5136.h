@@ -0,0 +1,42 @@
+#pragma once
+/* header 5136 */
+#include <vector>
+#include "h6878.h"
+#include "h4374.h"
+#include "h5770.h"
+#include "h467.h"
+#include "h4266.h"
+#ifdef X
+#include "h9051.h"
+#endif
+struct S5136 { int a; const char *s = "x//y"; };
+inline int f5136_0(int x) { return x * 0; }
+inline int f5136_1(int x) { return x * 1; }
+inline int f5136_2(int x) { return x * 2; }
+inline int f5136_3(int x) { return x * 3; }
+inline int f5136_4(int x) { return x * 4; }
+inline int f5136_5(int x) { return x * 5; }
+inline int f5136_6(int x) { return x * 6; }
+inline int f5136_7(int x) { return x * 7; }
+inline int f5136_8(int x) { return x * 8; }
+inline int f5136_9(int x) { return x * 9; }
+inline int f5136_10(int x) { return x * 10; }
+inline int f5136_11(int x) { return x * 11; }
+inline int f5136_12(int x) { return x * 12; }
+inline int f5136_13(int x) { return x * 13; }
+inline int f5136_14(int x) { return x * 14; }
+inline int f5136_15(int x) { return x * 15; }
+inline int f5136_16(int x) { return x * 16; }
+inline int f5136_17(int x) { return x * 17; }
+inline int f5136_18(int x) { return x * 18; }
+inline int f5136_19(int x) { return x * 19; }
+inline int f5136_20(int x) { return x * 20; }
+inline int f5136_21(int x) { return x * 21; }
+inline int f5136_22(int x) { return x * 22; }
+inline int f5136_23(int x) { return x * 23; }
+inline int f5136_24(int x) { return x * 24; }
+inline int f5136_25(int x) { return x * 25; }
+inline int f5136_26(int x) { return x * 26; }
+inline int f5136_27(int x) { return x * 27; }
+inline int f5136_28(int x) { return x * 28; }
+inline int f5136_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5138 */
+#include <vector>
+#include "h3447.h"
+#include "h5893.h"
+#include "h8789.h"
+#include "h5296.h"
+#include "h8876.h"
+#ifdef X
+#include "h1428.h"
+#endif
+struct S5138 { int a; const char *s = "x//y"; };
+inline int f5138_0(int x) { return x * 0; }
+inline int f5138_1(int x) { return x * 1; }
+inline int f5138_2(int x) { return x * 2; }
+inline int f5138_3(int x) { return x * 3; }
+inline int f5138_4(int x) { return x * 4; }
+inline int f5138_5(int x) { return x * 5; }
+inline int f5138_6(int x) { return x * 6; }
+inline int f5138_7(int x) { return x * 7; }
+inline int f5138_8(int x) { return x * 8; }
+inline int f5138_9(int x) { return x * 9; }
+inline int f5138_10(int x) { return x * 10; }
+inline int f5138_11(int x) { return x * 11; }
+inline int f5138_12(int x) { return x * 12; }
+inline int f5138_13(int x) { return x * 13; }
+inline int f5138_14(int x) { return x * 14; }
+inline int f5138_15(int x) { return x * 15; }
+inline int f5138_16(int x) { return x * 16; }
+inline int f5138_17(int x) { return x * 17; }
+inline int f5138_18(int x) { return x * 18; }
+inline int f5138_19(int x) { return x * 19; }
+inline int f5138_20(int x) { return x * 20; }
+inline int f5138_21(int x) { return x * 21; }
+inline int f5138_22(int x) { return x * 22; }
+inline int f5138_23(int x) { return x * 23; }
+inline int f5138_24(int x) { return x * 24; }
+inline int f5138_25(int x) { return x * 25; }
+inline int f5138_26(int x) { return x * 26; }
+inline int f5138_27(int x) { return x * 27; }
+inline int f5138_28(int x) { return x * 28; }
+inline int f5138_29(int x) { return x * 29; }
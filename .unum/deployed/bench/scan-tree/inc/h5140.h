@@ -0,0 +1,42 @@
+#pragma once
+/* header 5140 */
+#include <vector>
+#include "h54.h"
+#include "h4352.h"
+#include "h7621.h"
+#include "h1371.h"
+#include "h6056.h"
+#ifdef X
+#include "h2361.h"
+#endif
+struct S5140 { int a; const char *s = "x//y"; };
+inline int f5140_0(int x) { return x * 0; }
+inline int f5140_1(int x) { return x * 1; }
+inline int f5140_2(int x) { return x * 2; }
+inline int f5140_3(int x) { return x * 3; }
+inline int f5140_4(int x) { return x * 4; }
+inline int f5140_5(int x) { return x * 5; }
+inline int f5140_6(int x) { return x * 6; }
+inline int f5140_7(int x) { return x * 7; }
+inline int f5140_8(int x) { return x * 8; }
+inline int f5140_9(int x) { return x * 9; }
+inline int f5140_10(int x) { return x * 10; }
+inline int f5140_11(int x) { return x * 11; }
+inline int f5140_12(int x) { return x * 12; }
+inline int f5140_13(int x) { return x * 13; }
+inline int f5140_14(int x) { return x * 14; }
+inline int f5140_15(int x) { return x * 15; }
+inline int f5140_16(int x) { return x * 16; }
+inline int f5140_17(int x) { return x * 17; }
+inline int f5140_18(int x) { return x * 18; }
+inline int f5140_19(int x) { return x * 19; }
+inline int f5140_20(int x) { return x * 20; }
+inline int f5140_21(int x) { return x * 21; }
+inline int f5140_22(int x) { return x * 22; }
+inline int f5140_23(int x) { return x * 23; }
+inline int f5140_24(int x) { return x * 24; }
+inline int f5140_25(int x) { return x * 25; }
+inline int f5140_26(int x) { return x * 26; }
+inline int f5140_27(int x) { return x * 27; }
+inline int f5140_28(int x) { return x * 28; }
+inline int f5140_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5143 */
+#include <vector>
+#include "h3168.h"
+#include "h6094.h"
+#include "h644.h"
+#include "h8943.h"
+#include "h176.h"
+#ifdef X
+#include "h8904.h"
+#endif
+struct S5143 { int a; const char *s = "x//y"; };
+inline int f5143_0(int x) { return x * 0; }
+inline int f5143_1(int x) { return x * 1; }
+inline int f5143_2(int x) { return x * 2; }
+inline int f5143_3(int x) { return x * 3; }
+inline int f5143_4(int x) { return x * 4; }
+inline int f5143_5(int x) { return x * 5; }
+inline int f5143_6(int x) { return x * 6; }
+inline int f5143_7(int x) { return x * 7; }
+inline int f5143_8(int x) { return x * 8; }
+inline int f5143_9(int x) { return x * 9; }
+inline int f5143_10(int x) { return x * 10; }
+inline int f5143_11(int x) { return x * 11; }
+inline int f5143_12(int x) { return x * 12; }
+inline int f5143_13(int x) { return x * 13; }
+inline int f5143_14(int x) { return x * 14; }
+inline int f5143_15(int x) { return x * 15; }
+inline int f5143_16(int x) { return x * 16; }
+inline int f5143_17(int x) { return x * 17; }
+inline int f5143_18(int x) { return x * 18; }
+inline int f5143_19(int x) { return x * 19; }
+inline int f5143_20(int x) { return x * 20; }
+inline int f5143_21(int x) { return x * 21; }
+inline int f5143_22(int x) { return x * 22; }
+inline int f5143_23(int x) { return x * 23; }
+inline int f5143_24(int x) { return x * 24; }
+inline int f5143_25(int x) { return x * 25; }
+inline int f5143_26(int x) { return x * 26; }
+inline int f5143_27(int x) { return x * 27; }
+inline int f5143_28(int x) { return x * 28; }
+inline int f5143_29(int x) { return x * 29; }
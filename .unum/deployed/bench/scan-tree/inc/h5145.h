@@ -0,0 +1,42 @@
+#pragma once
+/* header 5145 */
+#include <vector>
+#include "h5144.h"
+#include "h1387.h"
+#include "h170.h"
+#include "h3111.h"
+#include "h3152.h"
+#ifdef X
+#include "h9462.h"
+#endif
+struct S5145 { int a; const char *s = "x//y"; };
+inline int f5145_0(int x) { return x * 0; }
+inline int f5145_1(int x) { return x * 1; }
+inline int f5145_2(int x) { return x * 2; }
+inline int f5145_3(int x) { return x * 3; }
+inline int f5145_4(int x) { return x * 4; }
+inline int f5145_5(int x) { return x * 5; }
+inline int f5145_6(int x) { return x * 6; }
+inline int f5145_7(int x) { return x * 7; }
+inline int f5145_8(int x) { return x * 8; }
+inline int f5145_9(int x) { return x * 9; }
+inline int f5145_10(int x) { return x * 10; }
+inline int f5145_11(int x) { return x * 11; }
+inline int f5145_12(int x) { return x * 12; }
+inline int f5145_13(int x) { return x * 13; }
+inline int f5145_14(int x) { return x * 14; }
+inline int f5145_15(int x) { return x * 15; }
+inline int f5145_16(int x) { return x * 16; }
+inline int f5145_17(int x) { return x * 17; }
+inline int f5145_18(int x) { return x * 18; }
+inline int f5145_19(int x) { return x * 19; }
+inline int f5145_20(int x) { return x * 20; }
+inline int f5145_21(int x) { return x * 21; }
+inline int f5145_22(int x) { return x * 22; }
+inline int f5145_23(int x) { return x * 23; }
+inline int f5145_24(int x) { return x * 24; }
+inline int f5145_25(int x) { return x * 25; }
+inline int f5145_26(int x) { return x * 26; }
+inline int f5145_27(int x) { return x * 27; }
+inline int f5145_28(int x) { return x * 28; }
+inline int f5145_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5146 */
+#include <vector>
+#include "h1510.h"
+#include "h8884.h"
+#include "h3132.h"
+#include "h8905.h"
+#include "h5881.h"
+#ifdef X
+#include "h8205.h"
+#endif
+struct S5146 { int a; const char *s = "x//y"; };
+inline int f5146_0(int x) { return x * 0; }
+inline int f5146_1(int x) { return x * 1; }
+inline int f5146_2(int x) { return x * 2; }
+inline int f5146_3(int x) { return x * 3; }
+inline int f5146_4(int x) { return x * 4; }
+inline int f5146_5(int x) { return x * 5; }
+inline int f5146_6(int x) { return x * 6; }
+inline int f5146_7(int x) { return x * 7; }
+inline int f5146_8(int x) { return x * 8; }
+inline int f5146_9(int x) { return x * 9; }
+inline int f5146_10(int x) { return x * 10; }
+inline int f5146_11(int x) { return x * 11; }
+inline int f5146_12(int x) { return x * 12; }
+inline int f5146_13(int x) { return x * 13; }
+inline int f5146_14(int x) { return x * 14; }
+inline int f5146_15(int x) { return x * 15; }
+inline int f5146_16(int x) { return x * 16; }
+inline int f5146_17(int x) { return x * 17; }
+inline int f5146_18(int x) { return x * 18; }
+inline int f5146_19(int x) { return x * 19; }
+inline int f5146_20(int x) { return x * 20; }
+inline int f5146_21(int x) { return x * 21; }
+inline int f5146_22(int x) { return x * 22; }
+inline int f5146_23(int x) { return x * 23; }
+inline int f5146_24(int x) { return x * 24; }
+inline int f5146_25(int x) { return x * 25; }
+inline int f5146_26(int x) { return x * 26; }
+inline int f5146_27(int x) { return x * 27; }
+inline int f5146_28(int x) { return x * 28; }
+inline int f5146_29(int x) { return x * 29; }
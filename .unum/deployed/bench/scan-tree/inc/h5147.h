@@ -0,0 +1,42 @@
+#pragma once
+/* header 5147 */
+#include <vector>
+#include "h7380.h"
+#include "h7491.h"
+#include "h8607.h"
+#include "h8619.h"
+#include "h8545.h"
+#ifdef X
+#include "h2622.h"
+#endif
+struct S5147 { int a; const char *s = "x//y"; };
+inline int f5147_0(int x) { return x * 0; }
+inline int f5147_1(int x) { return x * 1; }
+inline int f5147_2(int x) { return x * 2; }
+inline int f5147_3(int x) { return x * 3; }
+inline int f5147_4(int x) { return x * 4; }
+inline int f5147_5(int x) { return x * 5; }
+inline int f5147_6(int x) { return x * 6; }
+inline int f5147_7(int x) { return x * 7; }
+inline int f5147_8(int x) { return x * 8; }
+inline int f5147_9(int x) { return x * 9; }
+inline int f5147_10(int x) { return x * 10; }
+inline int f5147_11(int x) { return x * 11; }
+inline int f5147_12(int x) { return x * 12; }
+inline int f5147_13(int x) { return x * 13; }
+inline int f5147_14(int x) { return x * 14; }
+inline int f5147_15(int x) { return x * 15; }
+inline int f5147_16(int x) { return x * 16; }
+inline int f5147_17(int x) { return x * 17; }
+inline int f5147_18(int x) { return x * 18; }
+inline int f5147_19(int x) { return x * 19; }
+inline int f5147_20(int x) { return x * 20; }
+inline int f5147_21(int x) { return x * 21; }
+inline int f5147_22(int x) { return x * 22; }
+inline int f5147_23(int x) { return x * 23; }
+inline int f5147_24(int x) { return x * 24; }
+inline int f5147_25(int x) { return x * 25; }
+inline int f5147_26(int x) { return x * 26; }
+inline int f5147_27(int x) { return x * 27; }
+inline int f5147_28(int x) { return x * 28; }
+inline int f5147_29(int x) { return x * 29; }
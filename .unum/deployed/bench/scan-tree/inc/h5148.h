@@ -0,0 +1,42 @@
+#pragma once
+/* header 5148 */
+#include <vector>
+#include "h6313.h"
+#include "h2664.h"
+#include "h4431.h"
+#include "h4592.h"
+#include "h730.h"
+#ifdef X
+#include "h8591.h"
+#endif
+struct S5148 { int a; const char *s = "x//y"; };
+inline int f5148_0(int x) { return x * 0; }
+inline int f5148_1(int x) { return x * 1; }
+inline int f5148_2(int x) { return x * 2; }
+inline int f5148_3(int x) { return x * 3; }
+inline int f5148_4(int x) { return x * 4; }
+inline int f5148_5(int x) { return x * 5; }
+inline int f5148_6(int x) { return x * 6; }
+inline int f5148_7(int x) { return x * 7; }
+inline int f5148_8(int x) { return x * 8; }
+inline int f5148_9(int x) { return x * 9; }
+inline int f5148_10(int x) { return x * 10; }
+inline int f5148_11(int x) { return x * 11; }
+inline int f5148_12(int x) { return x * 12; }
+inline int f5148_13(int x) { return x * 13; }
+inline int f5148_14(int x) { return x * 14; }
+inline int f5148_15(int x) { return x * 15; }
+inline int f5148_16(int x) { return x * 16; }
+inline int f5148_17(int x) { return x * 17; }
+inline int f5148_18(int x) { return x * 18; }
+inline int f5148_19(int x) { return x * 19; }
+inline int f5148_20(int x) { return x * 20; }
+inline int f5148_21(int x) { return x * 21; }
+inline int f5148_22(int x) { return x * 22; }
+inline int f5148_23(int x) { return x * 23; }
+inline int f5148_24(int x) { return x * 24; }
+inline int f5148_25(int x) { return x * 25; }
+inline int f5148_26(int x) { return x * 26; }
+inline int f5148_27(int x) { return x * 27; }
+inline int f5148_28(int x) { return x * 28; }
+inline int f5148_29(int x) { return x * 29; }
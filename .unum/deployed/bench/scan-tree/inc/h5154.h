@@ -0,0 +1,42 @@
+#pragma once
+/* header 5154 */
+#include <vector>
+#include "h8503.h"
+#include "h5745.h"
+#include "h4842.h"
+#include "h6372.h"
+#include "h9683.h"
+#ifdef X
+#include "h1024.h"
+#endif
+struct S5154 { int a; const char *s = "x//y"; };
+inline int f5154_0(int x) { return x * 0; }
+inline int f5154_1(int x) { return x * 1; }
+inline int f5154_2(int x) { return x * 2; }
+inline int f5154_3(int x) { return x * 3; }
+inline int f5154_4(int x) { return x * 4; }
+inline int f5154_5(int x) { return x * 5; }
+inline int f5154_6(int x) { return x * 6; }
+inline int f5154_7(int x) { return x * 7; }
+inline int f5154_8(int x) { return x * 8; }
+inline int f5154_9(int x) { return x * 9; }
+inline int f5154_10(int x) { return x * 10; }
+inline int f5154_11(int x) { return x * 11; }
+inline int f5154_12(int x) { return x * 12; }
+inline int f5154_13(int x) { return x * 13; }
+inline int f5154_14(int x) { return x * 14; }
+inline int f5154_15(int x) { return x * 15; }
+inline int f5154_16(int x) { return x * 16; }
+inline int f5154_17(int x) { return x * 17; }
+inline int f5154_18(int x) { return x * 18; }
+inline int f5154_19(int x) { return x * 19; }
+inline int f5154_20(int x) { return x * 20; }
+inline int f5154_21(int x) { return x * 21; }
+inline int f5154_22(int x) { return x * 22; }
+inline int f5154_23(int x) { return x * 23; }
+inline int f5154_24(int x) { return x * 24; }
+inline int f5154_25(int x) { return x * 25; }
+inline int f5154_26(int x) { return x * 26; }
+inline int f5154_27(int x) { return x * 27; }
+inline int f5154_28(int x) { return x * 28; }
+inline int f5154_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5155 */
+#include <vector>
+#include "h43.h"
+#include "h6134.h"
+#include "h6413.h"
+#include "h8031.h"
+#include "h5005.h"
+#ifdef X
+#include "h4561.h"
+#endif
+struct S5155 { int a; const char *s = "x//y"; };
+inline int f5155_0(int x) { return x * 0; }
+inline int f5155_1(int x) { return x * 1; }
+inline int f5155_2(int x) { return x * 2; }
+inline int f5155_3(int x) { return x * 3; }
+inline int f5155_4(int x) { return x * 4; }
+inline int f5155_5(int x) { return x * 5; }
+inline int f5155_6(int x) { return x * 6; }
+inline int f5155_7(int x) { return x * 7; }
+inline int f5155_8(int x) { return x * 8; }
+inline int f5155_9(int x) { return x * 9; }
+inline int f5155_10(int x) { return x * 10; }
+inline int f5155_11(int x) { return x * 11; }
+inline int f5155_12(int x) { return x * 12; }
+inline int f5155_13(int x) { return x * 13; }
+inline int f5155_14(int x) { return x * 14; }
+inline int f5155_15(int x) { return x * 15; }
+inline int f5155_16(int x) { return x * 16; }
+inline int f5155_17(int x) { return x * 17; }
+inline int f5155_18(int x) { return x * 18; }
+inline int f5155_19(int x) { return x * 19; }
+inline int f5155_20(int x) { return x * 20; }
+inline int f5155_21(int x) { return x * 21; }
+inline int f5155_22(int x) { return x * 22; }
+inline int f5155_23(int x) { return x * 23; }
+inline int f5155_24(int x) { return x * 24; }
+inline int f5155_25(int x) { return x * 25; }
+inline int f5155_26(int x) { return x * 26; }
+inline int f5155_27(int x) { return x * 27; }
+inline int f5155_28(int x) { return x * 28; }
+inline int f5155_29(int x) { return x * 29; }
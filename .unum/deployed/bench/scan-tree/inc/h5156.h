@@ -0,0 +1,42 @@
+#pragma once
+/* header 5156 */
+#include <vector>
+#include "h4594.h"
+#include "h7067.h"
+#include "h421.h"
+#include "h1810.h"
+#include "h9890.h"
+#ifdef X
+#include "h6664.h"
+#endif
+struct S5156 { int a; const char *s = "x//y"; };
+inline int f5156_0(int x) { return x * 0; }
+inline int f5156_1(int x) { return x * 1; }
+inline int f5156_2(int x) { return x * 2; }
+inline int f5156_3(int x) { return x * 3; }
+inline int f5156_4(int x) { return x * 4; }
+inline int f5156_5(int x) { return x * 5; }
+inline int f5156_6(int x) { return x * 6; }
+inline int f5156_7(int x) { return x * 7; }
+inline int f5156_8(int x) { return x * 8; }
+inline int f5156_9(int x) { return x * 9; }
+inline int f5156_10(int x) { return x * 10; }
+inline int f5156_11(int x) { return x * 11; }
+inline int f5156_12(int x) { return x * 12; }
+inline int f5156_13(int x) { return x * 13; }
+inline int f5156_14(int x) { return x * 14; }
+inline int f5156_15(int x) { return x * 15; }
+inline int f5156_16(int x) { return x * 16; }
+inline int f5156_17(int x) { return x * 17; }
+inline int f5156_18(int x) { return x * 18; }
+inline int f5156_19(int x) { return x * 19; }
+inline int f5156_20(int x) { return x * 20; }
+inline int f5156_21(int x) { return x * 21; }
+inline int f5156_22(int x) { return x * 22; }
+inline int f5156_23(int x) { return x * 23; }
+inline int f5156_24(int x) { return x * 24; }
+inline int f5156_25(int x) { return x * 25; }
+inline int f5156_26(int x) { return x * 26; }
+inline int f5156_27(int x) { return x * 27; }
+inline int f5156_28(int x) { return x * 28; }
+inline int f5156_29(int x) { return x * 29; }
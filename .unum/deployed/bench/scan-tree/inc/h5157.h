@@ -0,0 +1,42 @@
+#pragma once
+/* header 5157 */
+#include <vector>
+#include "h4866.h"
+#include "h4900.h"
+#include "h5730.h"
+#include "h8819.h"
+#include "h9628.h"
+#ifdef X
+#include "h7280.h"
+#endif
+struct S5157 { int a; const char *s = "x//y"; };
+inline int f5157_0(int x) { return x * 0; }
+inline int f5157_1(int x) { return x * 1; }
+inline int f5157_2(int x) { return x * 2; }
+inline int f5157_3(int x) { return x * 3; }
+inline int f5157_4(int x) { return x * 4; }
+inline int f5157_5(int x) { return x * 5; }
+inline int f5157_6(int x) { return x * 6; }
+inline int f5157_7(int x) { return x * 7; }
+inline int f5157_8(int x) { return x * 8; }
+inline int f5157_9(int x) { return x * 9; }
+inline int f5157_10(int x) { return x * 10; }
+inline int f5157_11(int x) { return x * 11; }
+inline int f5157_12(int x) { return x * 12; }
+inline int f5157_13(int x) { return x * 13; }
+inline int f5157_14(int x) { return x * 14; }
+inline int f5157_15(int x) { return x * 15; }
+inline int f5157_16(int x) { return x * 16; }
+inline int f5157_17(int x) { return x * 17; }
+inline int f5157_18(int x) { return x * 18; }
+inline int f5157_19(int x) { return x * 19; }
+inline int f5157_20(int x) { return x * 20; }
+inline int f5157_21(int x) { return x * 21; }
+inline int f5157_22(int x) { return x * 22; }
+inline int f5157_23(int x) { return x * 23; }
+inline int f5157_24(int x) { return x * 24; }
+inline int f5157_25(int x) { return x * 25; }
+inline int f5157_26(int x) { return x * 26; }
+inline int f5157_27(int x) { return x * 27; }
+inline int f5157_28(int x) { return x * 28; }
+inline int f5157_29(int x) { return x * 29; }
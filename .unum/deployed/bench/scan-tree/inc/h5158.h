@@ -0,0 +1,42 @@
+#pragma once
+/* header 5158 */
+#include <vector>
+#include "h2922.h"
+#include "h6021.h"
+#include "h5495.h"
+#include "h3735.h"
+#include "h8756.h"
+#ifdef X
+#include "h7610.h"
+#endif
+struct S5158 { int a; const char *s = "x//y"; };
+inline int f5158_0(int x) { return x * 0; }
+inline int f5158_1(int x) { return x * 1; }
+inline int f5158_2(int x) { return x * 2; }
+inline int f5158_3(int x) { return x * 3; }
+inline int f5158_4(int x) { return x * 4; }
+inline int f5158_5(int x) { return x * 5; }
+inline int f5158_6(int x) { return x * 6; }
+inline int f5158_7(int x) { return x * 7; }
+inline int f5158_8(int x) { return x * 8; }
+inline int f5158_9(int x) { return x * 9; }
+inline int f5158_10(int x) { return x * 10; }
+inline int f5158_11(int x) { return x * 11; }
+inline int f5158_12(int x) { return x * 12; }
+inline int f5158_13(int x) { return x * 13; }
+inline int f5158_14(int x) { return x * 14; }
+inline int f5158_15(int x) { return x * 15; }
+inline int f5158_16(int x) { return x * 16; }
+inline int f5158_17(int x) { return x * 17; }
+inline int f5158_18(int x) { return x * 18; }
+inline int f5158_19(int x) { return x * 19; }
+inline int f5158_20(int x) { return x * 20; }
+inline int f5158_21(int x) { return x * 21; }
+inline int f5158_22(int x) { return x * 22; }
+inline int f5158_23(int x) { return x * 23; }
+inline int f5158_24(int x) { return x * 24; }
+inline int f5158_25(int x) { return x * 25; }
+inline int f5158_26(int x) { return x * 26; }
+inline int f5158_27(int x) { return x * 27; }
+inline int f5158_28(int x) { return x * 28; }
+inline int f5158_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 516 */
+#include <vector>
+#include "h7736.h"
+#include "h1493.h"
+#include "h215.h"
+#include "h5271.h"
+#include "h4502.h"
+#ifdef X
+#include "h2625.h"
+#endif
+struct S516 { int a; const char *s = "x//y"; };
+inline int f516_0(int x) { return x * 0; }
+inline int f516_1(int x) { return x * 1; }
+inline int f516_2(int x) { return x * 2; }
+inline int f516_3(int x) { return x * 3; }
+inline int f516_4(int x) { return x * 4; }
+inline int f516_5(int x) { return x * 5; }
+inline int f516_6(int x) { return x * 6; }
+inline int f516_7(int x) { return x * 7; }
+inline int f516_8(int x) { return x * 8; }
+inline int f516_9(int x) { return x * 9; }
+inline int f516_10(int x) { return x * 10; }
+inline int f516_11(int x) { return x * 11; }
+inline int f516_12(int x) { return x * 12; }
+inline int f516_13(int x) { return x * 13; }
+inline int f516_14(int x) { return x * 14; }
+inline int f516_15(int x) { return x * 15; }
+inline int f516_16(int x) { return x * 16; }
+inline int f516_17(int x) { return x * 17; }
+inline int f516_18(int x) { return x * 18; }
+inline int f516_19(int x) { return x * 19; }
+inline int f516_20(int x) { return x * 20; }
+inline int f516_21(int x) { return x * 21; }
+inline int f516_22(int x) { return x * 22; }
+inline int f516_23(int x) { return x * 23; }
+inline int f516_24(int x) { return x * 24; }
+inline int f516_25(int x) { return x * 25; }
+inline int f516_26(int x) { return x * 26; }
+inline int f516_27(int x) { return x * 27; }
+inline int f516_28(int x) { return x * 28; }
+inline int f516_29(int x) { return x * 29; }
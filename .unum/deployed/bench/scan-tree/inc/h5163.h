@@ -0,0 +1,42 @@
+#pragma once
+/* header 5163 */
+#include <vector>
+#include "h5642.h"
+#include "h6879.h"
+#include "h9843.h"
+#include "h5107.h"
+#include "h1276.h"
+#ifdef X
+#include "h2069.h"
+#endif
+struct S5163 { int a; const char *s = "x//y"; };
+inline int f5163_0(int x) { return x * 0; }
+inline int f5163_1(int x) { return x * 1; }
+inline int f5163_2(int x) { return x * 2; }
+inline int f5163_3(int x) { return x * 3; }
+inline int f5163_4(int x) { return x * 4; }
+inline int f5163_5(int x) { return x * 5; }
+inline int f5163_6(int x) { return x * 6; }
+inline int f5163_7(int x) { return x * 7; }
+inline int f5163_8(int x) { return x * 8; }
+inline int f5163_9(int x) { return x * 9; }
+inline int f5163_10(int x) { return x * 10; }
+inline int f5163_11(int x) { return x * 11; }
+inline int f5163_12(int x) { return x * 12; }
+inline int f5163_13(int x) { return x * 13; }
+inline int f5163_14(int x) { return x * 14; }
+inline int f5163_15(int x) { return x * 15; }
+inline int f5163_16(int x) { return x * 16; }
+inline int f5163_17(int x) { return x * 17; }
+inline int f5163_18(int x) { return x * 18; }
+inline int f5163_19(int x) { return x * 19; }
+inline int f5163_20(int x) { return x * 20; }
+inline int f5163_21(int x) { return x * 21; }
+inline int f5163_22(int x) { return x * 22; }
+inline int f5163_23(int x) { return x * 23; }
+inline int f5163_24(int x) { return x * 24; }
+inline int f5163_25(int x) { return x * 25; }
+inline int f5163_26(int x) { return x * 26; }
+inline int f5163_27(int x) { return x * 27; }
+inline int f5163_28(int x) { return x * 28; }
+inline int f5163_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5168 */
+#include <vector>
+#include "h5835.h"
+#include "h9705.h"
+#include "h4460.h"
+#include "h7334.h"
+#include "h7360.h"
+#ifdef X
+#include "h1261.h"
+#endif
+struct S5168 { int a; const char *s = "x//y"; };
+inline int f5168_0(int x) { return x * 0; }
+inline int f5168_1(int x) { return x * 1; }
+inline int f5168_2(int x) { return x * 2; }
+inline int f5168_3(int x) { return x * 3; }
+inline int f5168_4(int x) { return x * 4; }
+inline int f5168_5(int x) { return x * 5; }
+inline int f5168_6(int x) { return x * 6; }
+inline int f5168_7(int x) { return x * 7; }
+inline int f5168_8(int x) { return x * 8; }
+inline int f5168_9(int x) { return x * 9; }
+inline int f5168_10(int x) { return x * 10; }
+inline int f5168_11(int x) { return x * 11; }
+inline int f5168_12(int x) { return x * 12; }
+inline int f5168_13(int x) { return x * 13; }
+inline int f5168_14(int x) { return x * 14; }
+inline int f5168_15(int x) { return x * 15; }
+inline int f5168_16(int x) { return x * 16; }
+inline int f5168_17(int x) { return x * 17; }
+inline int f5168_18(int x) { return x * 18; }
+inline int f5168_19(int x) { return x * 19; }
+inline int f5168_20(int x) { return x * 20; }
+inline int f5168_21(int x) { return x * 21; }
+inline int f5168_22(int x) { return x * 22; }
+inline int f5168_23(int x) { return x * 23; }
+inline int f5168_24(int x) { return x * 24; }
+inline int f5168_25(int x) { return x * 25; }
+inline int f5168_26(int x) { return x * 26; }
+inline int f5168_27(int x) { return x * 27; }
+inline int f5168_28(int x) { return x * 28; }
+inline int f5168_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5174 */
+#include <vector>
+#include "h6468.h"
+#include "h8801.h"
+#include "h5172.h"
+#include "h2642.h"
+#include "h2818.h"
+#ifdef X
+#include "h6196.h"
+#endif
+struct S5174 { int a; const char *s = "x//y"; };
+inline int f5174_0(int x) { return x * 0; }
+inline int f5174_1(int x) { return x * 1; }
+inline int f5174_2(int x) { return x * 2; }
+inline int f5174_3(int x) { return x * 3; }
+inline int f5174_4(int x) { return x * 4; }
+inline int f5174_5(int x) { return x * 5; }
+inline int f5174_6(int x) { return x * 6; }
+inline int f5174_7(int x) { return x * 7; }
+inline int f5174_8(int x) { return x * 8; }
+inline int f5174_9(int x) { return x * 9; }
+inline int f5174_10(int x) { return x * 10; }
+inline int f5174_11(int x) { return x * 11; }
+inline int f5174_12(int x) { return x * 12; }
+inline int f5174_13(int x) { return x * 13; }
+inline int f5174_14(int x) { return x * 14; }
+inline int f5174_15(int x) { return x * 15; }
+inline int f5174_16(int x) { return x * 16; }
+inline int f5174_17(int x) { return x * 17; }
+inline int f5174_18(int x) { return x * 18; }
+inline int f5174_19(int x) { return x * 19; }
+inline int f5174_20(int x) { return x * 20; }
+inline int f5174_21(int x) { return x * 21; }
+inline int f5174_22(int x) { return x * 22; }
+inline int f5174_23(int x) { return x * 23; }
+inline int f5174_24(int x) { return x * 24; }
+inline int f5174_25(int x) { return x * 25; }
+inline int f5174_26(int x) { return x * 26; }
+inline int f5174_27(int x) { return x * 27; }
+inline int f5174_28(int x) { return x * 28; }
+inline int f5174_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5175 */
+#include <vector>
+#include "h8402.h"
+#include "h1339.h"
+#include "h932.h"
+#include "h5120.h"
+#include "h7529.h"
+#ifdef X
+#include "h5424.h"
+#endif
+struct S5175 { int a; const char *s = "x//y"; };
+inline int f5175_0(int x) { return x * 0; }
+inline int f5175_1(int x) { return x * 1; }
+inline int f5175_2(int x) { return x * 2; }
+inline int f5175_3(int x) { return x * 3; }
+inline int f5175_4(int x) { return x * 4; }
+inline int f5175_5(int x) { return x * 5; }
+inline int f5175_6(int x) { return x * 6; }
+inline int f5175_7(int x) { return x * 7; }
+inline int f5175_8(int x) { return x * 8; }
+inline int f5175_9(int x) { return x * 9; }
+inline int f5175_10(int x) { return x * 10; }
+inline int f5175_11(int x) { return x * 11; }
+inline int f5175_12(int x) { return x * 12; }
+inline int f5175_13(int x) { return x * 13; }
+inline int f5175_14(int x) { return x * 14; }
+inline int f5175_15(int x) { return x * 15; }
+inline int f5175_16(int x) { return x * 16; }
+inline int f5175_17(int x) { return x * 17; }
+inline int f5175_18(int x) { return x * 18; }
+inline int f5175_19(int x) { return x * 19; }
+inline int f5175_20(int x) { return x * 20; }
+inline int f5175_21(int x) { return x * 21; }
+inline int f5175_22(int x) { return x * 22; }
+inline int f5175_23(int x) { return x * 23; }
+inline int f5175_24(int x) { return x * 24; }
+inline int f5175_25(int x) { return x * 25; }
+inline int f5175_26(int x) { return x * 26; }
+inline int f5175_27(int x) { return x * 27; }
+inline int f5175_28(int x) { return x * 28; }
+inline int f5175_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5176 */
+#include <vector>
+#include "h6880.h"
+#include "h5908.h"
+#include "h876.h"
+#include "h9075.h"
+#include "h718.h"
+#ifdef X
+#include "h2359.h"
+#endif
+struct S5176 { int a; const char *s = "x//y"; };
+inline int f5176_0(int x) { return x * 0; }
+inline int f5176_1(int x) { return x * 1; }
+inline int f5176_2(int x) { return x * 2; }
+inline int f5176_3(int x) { return x * 3; }
+inline int f5176_4(int x) { return x * 4; }
+inline int f5176_5(int x) { return x * 5; }
+inline int f5176_6(int x) { return x * 6; }
+inline int f5176_7(int x) { return x * 7; }
+inline int f5176_8(int x) { return x * 8; }
+inline int f5176_9(int x) { return x * 9; }
+inline int f5176_10(int x) { return x * 10; }
+inline int f5176_11(int x) { return x * 11; }
+inline int f5176_12(int x) { return x * 12; }
+inline int f5176_13(int x) { return x * 13; }
+inline int f5176_14(int x) { return x * 14; }
+inline int f5176_15(int x) { return x * 15; }
+inline int f5176_16(int x) { return x * 16; }
+inline int f5176_17(int x) { return x * 17; }
+inline int f5176_18(int x) { return x * 18; }
+inline int f5176_19(int x) { return x * 19; }
+inline int f5176_20(int x) { return x * 20; }
+inline int f5176_21(int x) { return x * 21; }
+inline int f5176_22(int x) { return x * 22; }
+inline int f5176_23(int x) { return x * 23; }
+inline int f5176_24(int x) { return x * 24; }
+inline int f5176_25(int x) { return x * 25; }
+inline int f5176_26(int x) { return x * 26; }
+inline int f5176_27(int x) { return x * 27; }
+inline int f5176_28(int x) { return x * 28; }
+inline int f5176_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5177 */
+#include <vector>
+#include "h3805.h"
+#include "h9429.h"
+#include "h7029.h"
+#include "h7462.h"
+#include "h2431.h"
+#ifdef X
+#include "h2012.h"
+#endif
+struct S5177 { int a; const char *s = "x//y"; };
+inline int f5177_0(int x) { return x * 0; }
+inline int f5177_1(int x) { return x * 1; }
+inline int f5177_2(int x) { return x * 2; }
+inline int f5177_3(int x) { return x * 3; }
+inline int f5177_4(int x) { return x * 4; }
+inline int f5177_5(int x) { return x * 5; }
+inline int f5177_6(int x) { return x * 6; }
+inline int f5177_7(int x) { return x * 7; }
+inline int f5177_8(int x) { return x * 8; }
+inline int f5177_9(int x) { return x * 9; }
+inline int f5177_10(int x) { return x * 10; }
+inline int f5177_11(int x) { return x * 11; }
+inline int f5177_12(int x) { return x * 12; }
+inline int f5177_13(int x) { return x * 13; }
+inline int f5177_14(int x) { return x * 14; }
+inline int f5177_15(int x) { return x * 15; }
+inline int f5177_16(int x) { return x * 16; }
+inline int f5177_17(int x) { return x * 17; }
+inline int f5177_18(int x) { return x * 18; }
+inline int f5177_19(int x) { return x * 19; }
+inline int f5177_20(int x) { return x * 20; }
+inline int f5177_21(int x) { return x * 21; }
+inline int f5177_22(int x) { return x * 22; }
+inline int f5177_23(int x) { return x * 23; }
+inline int f5177_24(int x) { return x * 24; }
+inline int f5177_25(int x) { return x * 25; }
+inline int f5177_26(int x) { return x * 26; }
+inline int f5177_27(int x) { return x * 27; }
+inline int f5177_28(int x) { return x * 28; }
+inline int f5177_29(int x) { return x * 29; }
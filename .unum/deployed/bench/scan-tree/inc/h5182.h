@@ -0,0 +1,42 @@
+#pragma once
+/* header 5182 */
+#include <vector>
+#include "h1698.h"
+#include "h719.h"
+#include "h1096.h"
+#include "h5311.h"
+#include "h1082.h"
+#ifdef X
+#include "h9609.h"
+#endif
+struct S5182 { int a; const char *s = "x//y"; };
+inline int f5182_0(int x) { return x * 0; }
+inline int f5182_1(int x) { return x * 1; }
+inline int f5182_2(int x) { return x * 2; }
+inline int f5182_3(int x) { return x * 3; }
+inline int f5182_4(int x) { return x * 4; }
+inline int f5182_5(int x) { return x * 5; }
+inline int f5182_6(int x) { return x * 6; }
+inline int f5182_7(int x) { return x * 7; }
+inline int f5182_8(int x) { return x * 8; }
+inline int f5182_9(int x) { return x * 9; }
+inline int f5182_10(int x) { return x * 10; }
+inline int f5182_11(int x) { return x * 11; }
+inline int f5182_12(int x) { return x * 12; }
+inline int f5182_13(int x) { return x * 13; }
+inline int f5182_14(int x) { return x * 14; }
+inline int f5182_15(int x) { return x * 15; }
+inline int f5182_16(int x) { return x * 16; }
+inline int f5182_17(int x) { return x * 17; }
+inline int f5182_18(int x) { return x * 18; }
+inline int f5182_19(int x) { return x * 19; }
+inline int f5182_20(int x) { return x * 20; }
+inline int f5182_21(int x) { return x * 21; }
+inline int f5182_22(int x) { return x * 22; }
+inline int f5182_23(int x) { return x * 23; }
+inline int f5182_24(int x) { return x * 24; }
+inline int f5182_25(int x) { return x * 25; }
+inline int f5182_26(int x) { return x * 26; }
+inline int f5182_27(int x) { return x * 27; }
+inline int f5182_28(int x) { return x * 28; }
+inline int f5182_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5183 */
+#include <vector>
+#include "h5656.h"
+#include "h2399.h"
+#include "h7226.h"
+#include "h4143.h"
+#include "h9005.h"
+#ifdef X
+#include "h4580.h"
+#endif
+struct S5183 { int a; const char *s = "x//y"; };
+inline int f5183_0(int x) { return x * 0; }
+inline int f5183_1(int x) { return x * 1; }
+inline int f5183_2(int x) { return x * 2; }
+inline int f5183_3(int x) { return x * 3; }
+inline int f5183_4(int x) { return x * 4; }
+inline int f5183_5(int x) { return x * 5; }
+inline int f5183_6(int x) { return x * 6; }
+inline int f5183_7(int x) { return x * 7; }
+inline int f5183_8(int x) { return x * 8; }
+inline int f5183_9(int x) { return x * 9; }
+inline int f5183_10(int x) { return x * 10; }
+inline int f5183_11(int x) { return x * 11; }
+inline int f5183_12(int x) { return x * 12; }
+inline int f5183_13(int x) { return x * 13; }
+inline int f5183_14(int x) { return x * 14; }
+inline int f5183_15(int x) { return x * 15; }
+inline int f5183_16(int x) { return x * 16; }
+inline int f5183_17(int x) { return x * 17; }
+inline int f5183_18(int x) { return x * 18; }
+inline int f5183_19(int x) { return x * 19; }
+inline int f5183_20(int x) { return x * 20; }
+inline int f5183_21(int x) { return x * 21; }
+inline int f5183_22(int x) { return x * 22; }
+inline int f5183_23(int x) { return x * 23; }
+inline int f5183_24(int x) { return x * 24; }
+inline int f5183_25(int x) { return x * 25; }
+inline int f5183_26(int x) { return x * 26; }
+inline int f5183_27(int x) { return x * 27; }
+inline int f5183_28(int x) { return x * 28; }
+inline int f5183_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5184 */
+#include <vector>
+#include "h4070.h"
+#include "h7583.h"
+#include "h5139.h"
+#include "h8456.h"
+#include "h3996.h"
+#ifdef X
+#include "h4564.h"
+#endif
+struct S5184 { int a; const char *s = "x//y"; };
+inline int f5184_0(int x) { return x * 0; }
+inline int f5184_1(int x) { return x * 1; }
+inline int f5184_2(int x) { return x * 2; }
+inline int f5184_3(int x) { return x * 3; }
+inline int f5184_4(int x) { return x * 4; }
+inline int f5184_5(int x) { return x * 5; }
+inline int f5184_6(int x) { return x * 6; }
+inline int f5184_7(int x) { return x * 7; }
+inline int f5184_8(int x) { return x * 8; }
+inline int f5184_9(int x) { return x * 9; }
+inline int f5184_10(int x) { return x * 10; }
+inline int f5184_11(int x) { return x * 11; }
+inline int f5184_12(int x) { return x * 12; }
+inline int f5184_13(int x) { return x * 13; }
+inline int f5184_14(int x) { return x * 14; }
+inline int f5184_15(int x) { return x * 15; }
+inline int f5184_16(int x) { return x * 16; }
+inline int f5184_17(int x) { return x * 17; }
+inline int f5184_18(int x) { return x * 18; }
+inline int f5184_19(int x) { return x * 19; }
+inline int f5184_20(int x) { return x * 20; }
+inline int f5184_21(int x) { return x * 21; }
+inline int f5184_22(int x) { return x * 22; }
+inline int f5184_23(int x) { return x * 23; }
+inline int f5184_24(int x) { return x * 24; }
+inline int f5184_25(int x) { return x * 25; }
+inline int f5184_26(int x) { return x * 26; }
+inline int f5184_27(int x) { return x * 27; }
+inline int f5184_28(int x) { return x * 28; }
+inline int f5184_29(int x) { return x * 29; }
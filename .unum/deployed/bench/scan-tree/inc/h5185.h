@@ -0,0 +1,42 @@
+#pragma once
+/* header 5185 */
+#include <vector>
+#include "h9621.h"
+#include "h1073.h"
+#include "h4218.h"
+#include "h5069.h"
+#include "h7255.h"
+#ifdef X
+#include "h2800.h"
+#endif
+struct S5185 { int a; const char *s = "x//y"; };
+inline int f5185_0(int x) { return x * 0; }
+inline int f5185_1(int x) { return x * 1; }
+inline int f5185_2(int x) { return x * 2; }
+inline int f5185_3(int x) { return x * 3; }
+inline int f5185_4(int x) { return x * 4; }
+inline int f5185_5(int x) { return x * 5; }
+inline int f5185_6(int x) { return x * 6; }
+inline int f5185_7(int x) { return x * 7; }
+inline int f5185_8(int x) { return x * 8; }
+inline int f5185_9(int x) { return x * 9; }
+inline int f5185_10(int x) { return x * 10; }
+inline int f5185_11(int x) { return x * 11; }
+inline int f5185_12(int x) { return x * 12; }
+inline int f5185_13(int x) { return x * 13; }
+inline int f5185_14(int x) { return x * 14; }
+inline int f5185_15(int x) { return x * 15; }
+inline int f5185_16(int x) { return x * 16; }
+inline int f5185_17(int x) { return x * 17; }
+inline int f5185_18(int x) { return x * 18; }
+inline int f5185_19(int x) { return x * 19; }
+inline int f5185_20(int x) { return x * 20; }
+inline int f5185_21(int x) { return x * 21; }
+inline int f5185_22(int x) { return x * 22; }
+inline int f5185_23(int x) { return x * 23; }
+inline int f5185_24(int x) { return x * 24; }
+inline int f5185_25(int x) { return x * 25; }
+inline int f5185_26(int x) { return x * 26; }
+inline int f5185_27(int x) { return x * 27; }
+inline int f5185_28(int x) { return x * 28; }
+inline int f5185_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5188 */
+#include <vector>
+#include "h6352.h"
+#include "h4068.h"
+#include "h9627.h"
+#include "h7781.h"
+#include "h7800.h"
+#ifdef X
+#include "h1228.h"
+#endif
+struct S5188 { int a; const char *s = "x//y"; };
+inline int f5188_0(int x) { return x * 0; }
+inline int f5188_1(int x) { return x * 1; }
+inline int f5188_2(int x) { return x * 2; }
+inline int f5188_3(int x) { return x * 3; }
+inline int f5188_4(int x) { return x * 4; }
+inline int f5188_5(int x) { return x * 5; }
+inline int f5188_6(int x) { return x * 6; }
+inline int f5188_7(int x) { return x * 7; }
+inline int f5188_8(int x) { return x * 8; }
+inline int f5188_9(int x) { return x * 9; }
+inline int f5188_10(int x) { return x * 10; }
+inline int f5188_11(int x) { return x * 11; }
+inline int f5188_12(int x) { return x * 12; }
+inline int f5188_13(int x) { return x * 13; }
+inline int f5188_14(int x) { return x * 14; }
+inline int f5188_15(int x) { return x * 15; }
+inline int f5188_16(int x) { return x * 16; }
+inline int f5188_17(int x) { return x * 17; }
+inline int f5188_18(int x) { return x * 18; }
+inline int f5188_19(int x) { return x * 19; }
+inline int f5188_20(int x) { return x * 20; }
+inline int f5188_21(int x) { return x * 21; }
+inline int f5188_22(int x) { return x * 22; }
+inline int f5188_23(int x) { return x * 23; }
+inline int f5188_24(int x) { return x * 24; }
+inline int f5188_25(int x) { return x * 25; }
+inline int f5188_26(int x) { return x * 26; }
+inline int f5188_27(int x) { return x * 27; }
+inline int f5188_28(int x) { return x * 28; }
+inline int f5188_29(int x) { return x * 29; }
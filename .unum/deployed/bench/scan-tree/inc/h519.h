@@ -0,0 +1,42 @@
+#pragma once
+/* header 519 */
+#include <vector>
+#include "h2965.h"
+#include "h1573.h"
+#include "h9894.h"
+#include "h1111.h"
+#include "h584.h"
+#ifdef X
+#include "h2959.h"
+#endif
+struct S519 { int a; const char *s = "x//y"; };
+inline int f519_0(int x) { return x * 0; }
+inline int f519_1(int x) { return x * 1; }
+inline int f519_2(int x) { return x * 2; }
+inline int f519_3(int x) { return x * 3; }
+inline int f519_4(int x) { return x * 4; }
+inline int f519_5(int x) { return x * 5; }
+inline int f519_6(int x) { return x * 6; }
+inline int f519_7(int x) { return x * 7; }
+inline int f519_8(int x) { return x * 8; }
+inline int f519_9(int x) { return x * 9; }
+inline int f519_10(int x) { return x * 10; }
+inline int f519_11(int x) { return x * 11; }
+inline int f519_12(int x) { return x * 12; }
+inline int f519_13(int x) { return x * 13; }
+inline int f519_14(int x) { return x * 14; }
+inline int f519_15(int x) { return x * 15; }
+inline int f519_16(int x) { return x * 16; }
+inline int f519_17(int x) { return x * 17; }
+inline int f519_18(int x) { return x * 18; }
+inline int f519_19(int x) { return x * 19; }
+inline int f519_20(int x) { return x * 20; }
+inline int f519_21(int x) { return x * 21; }
+inline int f519_22(int x) { return x * 22; }
+inline int f519_23(int x) { return x * 23; }
+inline int f519_24(int x) { return x * 24; }
+inline int f519_25(int x) { return x * 25; }
+inline int f519_26(int x) { return x * 26; }
+inline int f519_27(int x) { return x * 27; }
+inline int f519_28(int x) { return x * 28; }
+inline int f519_29(int x) { return x * 29; }
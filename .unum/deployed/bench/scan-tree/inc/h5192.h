@@ -0,0 +1,42 @@
+#pragma once
+/* header 5192 */
+#include <vector>
+#include "h5890.h"
+#include "h5726.h"
+#include "h6524.h"
+#include "h5734.h"
+#include "h292.h"
+#ifdef X
+#include "h1389.h"
+#endif
+struct S5192 { int a; const char *s = "x//y"; };
+inline int f5192_0(int x) { return x * 0; }
+inline int f5192_1(int x) { return x * 1; }
+inline int f5192_2(int x) { return x * 2; }
+inline int f5192_3(int x) { return x * 3; }
+inline int f5192_4(int x) { return x * 4; }
+inline int f5192_5(int x) { return x * 5; }
+inline int f5192_6(int x) { return x * 6; }
+inline int f5192_7(int x) { return x * 7; }
+inline int f5192_8(int x) { return x * 8; }
+inline int f5192_9(int x) { return x * 9; }
+inline int f5192_10(int x) { return x * 10; }
+inline int f5192_11(int x) { return x * 11; }
+inline int f5192_12(int x) { return x * 12; }
+inline int f5192_13(int x) { return x * 13; }
+inline int f5192_14(int x) { return x * 14; }
+inline int f5192_15(int x) { return x * 15; }
+inline int f5192_16(int x) { return x * 16; }
+inline int f5192_17(int x) { return x * 17; }
+inline int f5192_18(int x) { return x * 18; }
+inline int f5192_19(int x) { return x * 19; }
+inline int f5192_20(int x) { return x * 20; }
+inline int f5192_21(int x) { return x * 21; }
+inline int f5192_22(int x) { return x * 22; }
+inline int f5192_23(int x) { return x * 23; }
+inline int f5192_24(int x) { return x * 24; }
+inline int f5192_25(int x) { return x * 25; }
+inline int f5192_26(int x) { return x * 26; }
+inline int f5192_27(int x) { return x * 27; }
+inline int f5192_28(int x) { return x * 28; }
+inline int f5192_29(int x) { return x * 29; }
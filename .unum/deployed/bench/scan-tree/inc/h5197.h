@@ -0,0 +1,42 @@
+#pragma once
+/* header 5197 */
+#include <vector>
+#include "h4730.h"
+#include "h4157.h"
+#include "h3990.h"
+#include "h614.h"
+#include "h1422.h"
+#ifdef X
+#include "h1007.h"
+#endif
+struct S5197 { int a; const char *s = "x//y"; };
+inline int f5197_0(int x) { return x * 0; }
+inline int f5197_1(int x) { return x * 1; }
+inline int f5197_2(int x) { return x * 2; }
+inline int f5197_3(int x) { return x * 3; }
+inline int f5197_4(int x) { return x * 4; }
+inline int f5197_5(int x) { return x * 5; }
+inline int f5197_6(int x) { return x * 6; }
+inline int f5197_7(int x) { return x * 7; }
+inline int f5197_8(int x) { return x * 8; }
+inline int f5197_9(int x) { return x * 9; }
+inline int f5197_10(int x) { return x * 10; }
+inline int f5197_11(int x) { return x * 11; }
+inline int f5197_12(int x) { return x * 12; }
+inline int f5197_13(int x) { return x * 13; }
+inline int f5197_14(int x) { return x * 14; }
+inline int f5197_15(int x) { return x * 15; }
+inline int f5197_16(int x) { return x * 16; }
+inline int f5197_17(int x) { return x * 17; }
+inline int f5197_18(int x) { return x * 18; }
+inline int f5197_19(int x) { return x * 19; }
+inline int f5197_20(int x) { return x * 20; }
+inline int f5197_21(int x) { return x * 21; }
+inline int f5197_22(int x) { return x * 22; }
+inline int f5197_23(int x) { return x * 23; }
+inline int f5197_24(int x) { return x * 24; }
+inline int f5197_25(int x) { return x * 25; }
+inline int f5197_26(int x) { return x * 26; }
+inline int f5197_27(int x) { return x * 27; }
+inline int f5197_28(int x) { return x * 28; }
+inline int f5197_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5199 */
+#include <vector>
+#include "h3436.h"
+#include "h2536.h"
+#include "h1910.h"
+#include "h888.h"
+#include "h2421.h"
+#ifdef X
+#include "h4801.h"
+#endif
+struct S5199 { int a; const char *s = "x//y"; };
+inline int f5199_0(int x) { return x * 0; }
+inline int f5199_1(int x) { return x * 1; }
+inline int f5199_2(int x) { return x * 2; }
+inline int f5199_3(int x) { return x * 3; }
+inline int f5199_4(int x) { return x * 4; }
+inline int f5199_5(int x) { return x * 5; }
+inline int f5199_6(int x) { return x * 6; }
+inline int f5199_7(int x) { return x * 7; }
+inline int f5199_8(int x) { return x * 8; }
+inline int f5199_9(int x) { return x * 9; }
+inline int f5199_10(int x) { return x * 10; }
+inline int f5199_11(int x) { return x * 11; }
+inline int f5199_12(int x) { return x * 12; }
+inline int f5199_13(int x) { return x * 13; }
+inline int f5199_14(int x) { return x * 14; }
+inline int f5199_15(int x) { return x * 15; }
+inline int f5199_16(int x) { return x * 16; }
+inline int f5199_17(int x) { return x * 17; }
+inline int f5199_18(int x) { return x * 18; }
+inline int f5199_19(int x) { return x * 19; }
+inline int f5199_20(int x) { return x * 20; }
+inline int f5199_21(int x) { return x * 21; }
+inline int f5199_22(int x) { return x * 22; }
+inline int f5199_23(int x) { return x * 23; }
+inline int f5199_24(int x) { return x * 24; }
+inline int f5199_25(int x) { return x * 25; }
+inline int f5199_26(int x) { return x * 26; }
+inline int f5199_27(int x) { return x * 27; }
+inline int f5199_28(int x) { return x * 28; }
+inline int f5199_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 52 */
+#include <vector>
+#include "h2570.h"
+#include "h1531.h"
+#include "h5874.h"
+#include "h944.h"
+#include "h1701.h"
+#ifdef X
+#include "h2792.h"
+#endif
+struct S52 { int a; const char *s = "x//y"; };
+inline int f52_0(int x) { return x * 0; }
+inline int f52_1(int x) { return x * 1; }
+inline int f52_2(int x) { return x * 2; }
+inline int f52_3(int x) { return x * 3; }
+inline int f52_4(int x) { return x * 4; }
+inline int f52_5(int x) { return x * 5; }
+inline int f52_6(int x) { return x * 6; }
+inline int f52_7(int x) { return x * 7; }
+inline int f52_8(int x) { return x * 8; }
+inline int f52_9(int x) { return x * 9; }
+inline int f52_10(int x) { return x * 10; }
+inline int f52_11(int x) { return x * 11; }
+inline int f52_12(int x) { return x * 12; }
+inline int f52_13(int x) { return x * 13; }
+inline int f52_14(int x) { return x * 14; }
+inline int f52_15(int x) { return x * 15; }
+inline int f52_16(int x) { return x * 16; }
+inline int f52_17(int x) { return x * 17; }
+inline int f52_18(int x) { return x * 18; }
+inline int f52_19(int x) { return x * 19; }
+inline int f52_20(int x) { return x * 20; }
+inline int f52_21(int x) { return x * 21; }
+inline int f52_22(int x) { return x * 22; }
+inline int f52_23(int x) { return x * 23; }
+inline int f52_24(int x) { return x * 24; }
+inline int f52_25(int x) { return x * 25; }
+inline int f52_26(int x) { return x * 26; }
+inline int f52_27(int x) { return x * 27; }
+inline int f52_28(int x) { return x * 28; }
+inline int f52_29(int x) { return x * 29; }
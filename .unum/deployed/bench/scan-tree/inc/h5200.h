@@ -0,0 +1,42 @@
+#pragma once
+/* header 5200 */
+#include <vector>
+#include "h8978.h"
+#include "h6486.h"
+#include "h3067.h"
+#include "h9691.h"
+#include "h1834.h"
+#ifdef X
+#include "h204.h"
+#endif
+struct S5200 { int a; const char *s = "x//y"; };
+inline int f5200_0(int x) { return x * 0; }
+inline int f5200_1(int x) { return x * 1; }
+inline int f5200_2(int x) { return x * 2; }
+inline int f5200_3(int x) { return x * 3; }
+inline int f5200_4(int x) { return x * 4; }
+inline int f5200_5(int x) { return x * 5; }
+inline int f5200_6(int x) { return x * 6; }
+inline int f5200_7(int x) { return x * 7; }
+inline int f5200_8(int x) { return x * 8; }
+inline int f5200_9(int x) { return x * 9; }
+inline int f5200_10(int x) { return x * 10; }
+inline int f5200_11(int x) { return x * 11; }
+inline int f5200_12(int x) { return x * 12; }
+inline int f5200_13(int x) { return x * 13; }
+inline int f5200_14(int x) { return x * 14; }
+inline int f5200_15(int x) { return x * 15; }
+inline int f5200_16(int x) { return x * 16; }
+inline int f5200_17(int x) { return x * 17; }
+inline int f5200_18(int x) { return x * 18; }
+inline int f5200_19(int x) { return x * 19; }
+inline int f5200_20(int x) { return x * 20; }
+inline int f5200_21(int x) { return x * 21; }
+inline int f5200_22(int x) { return x * 22; }
+inline int f5200_23(int x) { return x * 23; }
+inline int f5200_24(int x) { return x * 24; }
+inline int f5200_25(int x) { return x * 25; }
+inline int f5200_26(int x) { return x * 26; }
+inline int f5200_27(int x) { return x * 27; }
+inline int f5200_28(int x) { return x * 28; }
+inline int f5200_29(int x) { return x * 29; }
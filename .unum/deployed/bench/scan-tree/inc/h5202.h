@@ -0,0 +1,42 @@
+#pragma once
+/* header 5202 */
+#include <vector>
+#include "h6484.h"
+#include "h2024.h"
+#include "h5447.h"
+#include "h2576.h"
+#include "h2158.h"
+#ifdef X
+#include "h5726.h"
+#endif
+struct S5202 { int a; const char *s = "x//y"; };
+inline int f5202_0(int x) { return x * 0; }
+inline int f5202_1(int x) { return x * 1; }
+inline int f5202_2(int x) { return x * 2; }
+inline int f5202_3(int x) { return x * 3; }
+inline int f5202_4(int x) { return x * 4; }
+inline int f5202_5(int x) { return x * 5; }
+inline int f5202_6(int x) { return x * 6; }
+inline int f5202_7(int x) { return x * 7; }
+inline int f5202_8(int x) { return x * 8; }
+inline int f5202_9(int x) { return x * 9; }
+inline int f5202_10(int x) { return x * 10; }
+inline int f5202_11(int x) { return x * 11; }
+inline int f5202_12(int x) { return x * 12; }
+inline int f5202_13(int x) { return x * 13; }
+inline int f5202_14(int x) { return x * 14; }
+inline int f5202_15(int x) { return x * 15; }
+inline int f5202_16(int x) { return x * 16; }
+inline int f5202_17(int x) { return x * 17; }
+inline int f5202_18(int x) { return x * 18; }
+inline int f5202_19(int x) { return x * 19; }
+inline int f5202_20(int x) { return x * 20; }
+inline int f5202_21(int x) { return x * 21; }
+inline int f5202_22(int x) { return x * 22; }
+inline int f5202_23(int x) { return x * 23; }
+inline int f5202_24(int x) { return x * 24; }
+inline int f5202_25(int x) { return x * 25; }
+inline int f5202_26(int x) { return x * 26; }
+inline int f5202_27(int x) { return x * 27; }
+inline int f5202_28(int x) { return x * 28; }
+inline int f5202_29(int x) { return x * 29; }
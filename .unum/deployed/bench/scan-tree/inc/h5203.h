@@ -0,0 +1,42 @@
+#pragma once
+/* header 5203 */
+#include <vector>
+#include "h8688.h"
+#include "h3160.h"
+#include "h9008.h"
+#include "h3286.h"
+#include "h4815.h"
+#ifdef X
+#include "h1977.h"
+#endif
+struct S5203 { int a; const char *s = "x//y"; };
+inline int f5203_0(int x) { return x * 0; }
+inline int f5203_1(int x) { return x * 1; }
+inline int f5203_2(int x) { return x * 2; }
+inline int f5203_3(int x) { return x * 3; }
+inline int f5203_4(int x) { return x * 4; }
+inline int f5203_5(int x) { return x * 5; }
+inline int f5203_6(int x) { return x * 6; }
+inline int f5203_7(int x) { return x * 7; }
+inline int f5203_8(int x) { return x * 8; }
+inline int f5203_9(int x) { return x * 9; }
+inline int f5203_10(int x) { return x * 10; }
+inline int f5203_11(int x) { return x * 11; }
+inline int f5203_12(int x) { return x * 12; }
+inline int f5203_13(int x) { return x * 13; }
+inline int f5203_14(int x) { return x * 14; }
+inline int f5203_15(int x) { return x * 15; }
+inline int f5203_16(int x) { return x * 16; }
+inline int f5203_17(int x) { return x * 17; }
+inline int f5203_18(int x) { return x * 18; }
+inline int f5203_19(int x) { return x * 19; }
+inline int f5203_20(int x) { return x * 20; }
+inline int f5203_21(int x) { return x * 21; }
+inline int f5203_22(int x) { return x * 22; }
+inline int f5203_23(int x) { return x * 23; }
+inline int f5203_24(int x) { return x * 24; }
+inline int f5203_25(int x) { return x * 25; }
+inline int f5203_26(int x) { return x * 26; }
+inline int f5203_27(int x) { return x * 27; }
+inline int f5203_28(int x) { return x * 28; }
+inline int f5203_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5207 */
+#include <vector>
+#include "h2704.h"
+#include "h7224.h"
+#include "h812.h"
+#include "h1777.h"
+#include "h487.h"
+#ifdef X
+#include "h9265.h"
+#endif
+struct S5207 { int a; const char *s = "x//y"; };
+inline int f5207_0(int x) { return x * 0; }
+inline int f5207_1(int x) { return x * 1; }
+inline int f5207_2(int x) { return x * 2; }
+inline int f5207_3(int x) { return x * 3; }
+inline int f5207_4(int x) { return x * 4; }
+inline int f5207_5(int x) { return x * 5; }
+inline int f5207_6(int x) { return x * 6; }
+inline int f5207_7(int x) { return x * 7; }
+inline int f5207_8(int x) { return x * 8; }
+inline int f5207_9(int x) { return x * 9; }
+inline int f5207_10(int x) { return x * 10; }
+inline int f5207_11(int x) { return x * 11; }
+inline int f5207_12(int x) { return x * 12; }
+inline int f5207_13(int x) { return x * 13; }
+inline int f5207_14(int x) { return x * 14; }
+inline int f5207_15(int x) { return x * 15; }
+inline int f5207_16(int x) { return x * 16; }
+inline int f5207_17(int x) { return x * 17; }
+inline int f5207_18(int x) { return x * 18; }
+inline int f5207_19(int x) { return x * 19; }
+inline int f5207_20(int x) { return x * 20; }
+inline int f5207_21(int x) { return x * 21; }
+inline int f5207_22(int x) { return x * 22; }
+inline int f5207_23(int x) { return x * 23; }
+inline int f5207_24(int x) { return x * 24; }
+inline int f5207_25(int x) { return x * 25; }
+inline int f5207_26(int x) { return x * 26; }
+inline int f5207_27(int x) { return x * 27; }
+inline int f5207_28(int x) { return x * 28; }
+inline int f5207_29(int x) { return x * 29; }
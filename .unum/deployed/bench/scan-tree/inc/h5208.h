@@ -0,0 +1,42 @@
+#pragma once
+/* header 5208 */
+#include <vector>
+#include "h860.h"
+#include "h8154.h"
+#include "h3191.h"
+#include "h7728.h"
+#include "h2726.h"
+#ifdef X
+#include "h8.h"
+#endif
+struct S5208 { int a; const char *s = "x//y"; };
+inline int f5208_0(int x) { return x * 0; }
+inline int f5208_1(int x) { return x * 1; }
+inline int f5208_2(int x) { return x * 2; }
+inline int f5208_3(int x) { return x * 3; }
+inline int f5208_4(int x) { return x * 4; }
+inline int f5208_5(int x) { return x * 5; }
+inline int f5208_6(int x) { return x * 6; }
+inline int f5208_7(int x) { return x * 7; }
+inline int f5208_8(int x) { return x * 8; }
+inline int f5208_9(int x) { return x * 9; }
+inline int f5208_10(int x) { return x * 10; }
+inline int f5208_11(int x) { return x * 11; }
+inline int f5208_12(int x) { return x * 12; }
+inline int f5208_13(int x) { return x * 13; }
+inline int f5208_14(int x) { return x * 14; }
+inline int f5208_15(int x) { return x * 15; }
+inline int f5208_16(int x) { return x * 16; }
+inline int f5208_17(int x) { return x * 17; }
+inline int f5208_18(int x) { return x * 18; }
+inline int f5208_19(int x) { return x * 19; }
+inline int f5208_20(int x) { return x * 20; }
+inline int f5208_21(int x) { return x * 21; }
+inline int f5208_22(int x) { return x * 22; }
+inline int f5208_23(int x) { return x * 23; }
+inline int f5208_24(int x) { return x * 24; }
+inline int f5208_25(int x) { return x * 25; }
+inline int f5208_26(int x) { return x * 26; }
+inline int f5208_27(int x) { return x * 27; }
+inline int f5208_28(int x) { return x * 28; }
+inline int f5208_29(int x) { return x * 29; }
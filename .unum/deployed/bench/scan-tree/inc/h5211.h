@@ -0,0 +1,42 @@
+#pragma once
+/* header 5211 */
+#include <vector>
+#include "h4352.h"
+#include "h7047.h"
+#include "h1675.h"
+#include "h3308.h"
+#include "h9832.h"
+#ifdef X
+#include "h2859.h"
+#endif
+struct S5211 { int a; const char *s = "x//y"; };
+inline int f5211_0(int x) { return x * 0; }
+inline int f5211_1(int x) { return x * 1; }
+inline int f5211_2(int x) { return x * 2; }
+inline int f5211_3(int x) { return x * 3; }
+inline int f5211_4(int x) { return x * 4; }
+inline int f5211_5(int x) { return x * 5; }
+inline int f5211_6(int x) { return x * 6; }
+inline int f5211_7(int x) { return x * 7; }
+inline int f5211_8(int x) { return x * 8; }
+inline int f5211_9(int x) { return x * 9; }
+inline int f5211_10(int x) { return x * 10; }
+inline int f5211_11(int x) { return x * 11; }
+inline int f5211_12(int x) { return x * 12; }
+inline int f5211_13(int x) { return x * 13; }
+inline int f5211_14(int x) { return x * 14; }
+inline int f5211_15(int x) { return x * 15; }
+inline int f5211_16(int x) { return x * 16; }
+inline int f5211_17(int x) { return x * 17; }
+inline int f5211_18(int x) { return x * 18; }
+inline int f5211_19(int x) { return x * 19; }
+inline int f5211_20(int x) { return x * 20; }
+inline int f5211_21(int x) { return x * 21; }
+inline int f5211_22(int x) { return x * 22; }
+inline int f5211_23(int x) { return x * 23; }
+inline int f5211_24(int x) { return x * 24; }
+inline int f5211_25(int x) { return x * 25; }
+inline int f5211_26(int x) { return x * 26; }
+inline int f5211_27(int x) { return x * 27; }
+inline int f5211_28(int x) { return x * 28; }
+inline int f5211_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5219 */
+#include <vector>
+#include "h3644.h"
+#include "h2141.h"
+#include "h707.h"
+#include "h3361.h"
+#include "h6436.h"
+#ifdef X
+#include "h5692.h"
+#endif
+struct S5219 { int a; const char *s = "x//y"; };
+inline int f5219_0(int x) { return x * 0; }
+inline int f5219_1(int x) { return x * 1; }
+inline int f5219_2(int x) { return x * 2; }
+inline int f5219_3(int x) { return x * 3; }
+inline int f5219_4(int x) { return x * 4; }
+inline int f5219_5(int x) { return x * 5; }
+inline int f5219_6(int x) { return x * 6; }
+inline int f5219_7(int x) { return x * 7; }
+inline int f5219_8(int x) { return x * 8; }
+inline int f5219_9(int x) { return x * 9; }
+inline int f5219_10(int x) { return x * 10; }
+inline int f5219_11(int x) { return x * 11; }
+inline int f5219_12(int x) { return x * 12; }
+inline int f5219_13(int x) { return x * 13; }
+inline int f5219_14(int x) { return x * 14; }
+inline int f5219_15(int x) { return x * 15; }
+inline int f5219_16(int x) { return x * 16; }
+inline int f5219_17(int x) { return x * 17; }
+inline int f5219_18(int x) { return x * 18; }
+inline int f5219_19(int x) { return x * 19; }
+inline int f5219_20(int x) { return x * 20; }
+inline int f5219_21(int x) { return x * 21; }
+inline int f5219_22(int x) { return x * 22; }
+inline int f5219_23(int x) { return x * 23; }
+inline int f5219_24(int x) { return x * 24; }
+inline int f5219_25(int x) { return x * 25; }
+inline int f5219_26(int x) { return x * 26; }
+inline int f5219_27(int x) { return x * 27; }
+inline int f5219_28(int x) { return x * 28; }
+inline int f5219_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 522 */
+#include <vector>
+#include "h679.h"
+#include "h5631.h"
+#include "h3167.h"
+#include "h2345.h"
+#include "h507.h"
+#ifdef X
+#include "h9349.h"
+#endif
+struct S522 { int a; const char *s = "x//y"; };
+inline int f522_0(int x) { return x * 0; }
+inline int f522_1(int x) { return x * 1; }
+inline int f522_2(int x) { return x * 2; }
+inline int f522_3(int x) { return x * 3; }
+inline int f522_4(int x) { return x * 4; }
+inline int f522_5(int x) { return x * 5; }
+inline int f522_6(int x) { return x * 6; }
+inline int f522_7(int x) { return x * 7; }
+inline int f522_8(int x) { return x * 8; }
+inline int f522_9(int x) { return x * 9; }
+inline int f522_10(int x) { return x * 10; }
+inline int f522_11(int x) { return x * 11; }
+inline int f522_12(int x) { return x * 12; }
+inline int f522_13(int x) { return x * 13; }
+inline int f522_14(int x) { return x * 14; }
+inline int f522_15(int x) { return x * 15; }
+inline int f522_16(int x) { return x * 16; }
+inline int f522_17(int x) { return x * 17; }
+inline int f522_18(int x) { return x * 18; }
+inline int f522_19(int x) { return x * 19; }
+inline int f522_20(int x) { return x * 20; }
+inline int f522_21(int x) { return x * 21; }
+inline int f522_22(int x) { return x * 22; }
+inline int f522_23(int x) { return x * 23; }
+inline int f522_24(int x) { return x * 24; }
+inline int f522_25(int x) { return x * 25; }
+inline int f522_26(int x) { return x * 26; }
+inline int f522_27(int x) { return x * 27; }
+inline int f522_28(int x) { return x * 28; }
+inline int f522_29(int x) { return x * 29; }
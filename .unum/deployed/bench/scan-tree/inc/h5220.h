@@ -0,0 +1,42 @@
+#pragma once
+/* header 5220 */
+#include <vector>
+#include "h671.h"
+#include "h9922.h"
+#include "h6261.h"
+#include "h669.h"
+#include "h5186.h"
+#ifdef X
+#include "h667.h"
+#endif
+struct S5220 { int a; const char *s = "x//y"; };
+inline int f5220_0(int x) { return x * 0; }
+inline int f5220_1(int x) { return x * 1; }
+inline int f5220_2(int x) { return x * 2; }
+inline int f5220_3(int x) { return x * 3; }
+inline int f5220_4(int x) { return x * 4; }
+inline int f5220_5(int x) { return x * 5; }
+inline int f5220_6(int x) { return x * 6; }
+inline int f5220_7(int x) { return x * 7; }
+inline int f5220_8(int x) { return x * 8; }
+inline int f5220_9(int x) { return x * 9; }
+inline int f5220_10(int x) { return x * 10; }
+inline int f5220_11(int x) { return x * 11; }
+inline int f5220_12(int x) { return x * 12; }
+inline int f5220_13(int x) { return x * 13; }
+inline int f5220_14(int x) { return x * 14; }
+inline int f5220_15(int x) { return x * 15; }
+inline int f5220_16(int x) { return x * 16; }
+inline int f5220_17(int x) { return x * 17; }
+inline int f5220_18(int x) { return x * 18; }
+inline int f5220_19(int x) { return x * 19; }
+inline int f5220_20(int x) { return x * 20; }
+inline int f5220_21(int x) { return x * 21; }
+inline int f5220_22(int x) { return x * 22; }
+inline int f5220_23(int x) { return x * 23; }
+inline int f5220_24(int x) { return x * 24; }
+inline int f5220_25(int x) { return x * 25; }
+inline int f5220_26(int x) { return x * 26; }
+inline int f5220_27(int x) { return x * 27; }
+inline int f5220_28(int x) { return x * 28; }
+inline int f5220_29(int x) { return x * 29; }
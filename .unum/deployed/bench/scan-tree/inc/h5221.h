@@ -0,0 +1,42 @@
+#pragma once
+/* header 5221 */
+#include <vector>
+#include "h4414.h"
+#include "h8818.h"
+#include "h3359.h"
+#include "h7069.h"
+#include "h5533.h"
+#ifdef X
+#include "h6513.h"
+#endif
+struct S5221 { int a; const char *s = "x//y"; };
+inline int f5221_0(int x) { return x * 0; }
+inline int f5221_1(int x) { return x * 1; }
+inline int f5221_2(int x) { return x * 2; }
+inline int f5221_3(int x) { return x * 3; }
+inline int f5221_4(int x) { return x * 4; }
+inline int f5221_5(int x) { return x * 5; }
+inline int f5221_6(int x) { return x * 6; }
+inline int f5221_7(int x) { return x * 7; }
+inline int f5221_8(int x) { return x * 8; }
+inline int f5221_9(int x) { return x * 9; }
+inline int f5221_10(int x) { return x * 10; }
+inline int f5221_11(int x) { return x * 11; }
+inline int f5221_12(int x) { return x * 12; }
+inline int f5221_13(int x) { return x * 13; }
+inline int f5221_14(int x) { return x * 14; }
+inline int f5221_15(int x) { return x * 15; }
+inline int f5221_16(int x) { return x * 16; }
+inline int f5221_17(int x) { return x * 17; }
+inline int f5221_18(int x) { return x * 18; }
+inline int f5221_19(int x) { return x * 19; }
+inline int f5221_20(int x) { return x * 20; }
+inline int f5221_21(int x) { return x * 21; }
+inline int f5221_22(int x) { return x * 22; }
+inline int f5221_23(int x) { return x * 23; }
+inline int f5221_24(int x) { return x * 24; }
+inline int f5221_25(int x) { return x * 25; }
+inline int f5221_26(int x) { return x * 26; }
+inline int f5221_27(int x) { return x * 27; }
+inline int f5221_28(int x) { return x * 28; }
+inline int f5221_29(int x) { return x * 29; }
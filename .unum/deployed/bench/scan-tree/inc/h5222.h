@@ -0,0 +1,42 @@
+#pragma once
+/* header 5222 */
+#include <vector>
+#include "h2786.h"
+#include "h6484.h"
+#include "h241.h"
+#include "h7553.h"
+#include "h3447.h"
+#ifdef X
+#include "h6134.h"
+#endif
+struct S5222 { int a; const char *s = "x//y"; };
+inline int f5222_0(int x) { return x * 0; }
+inline int f5222_1(int x) { return x * 1; }
+inline int f5222_2(int x) { return x * 2; }
+inline int f5222_3(int x) { return x * 3; }
+inline int f5222_4(int x) { return x * 4; }
+inline int f5222_5(int x) { return x * 5; }
+inline int f5222_6(int x) { return x * 6; }
+inline int f5222_7(int x) { return x * 7; }
+inline int f5222_8(int x) { return x * 8; }
+inline int f5222_9(int x) { return x * 9; }
+inline int f5222_10(int x) { return x * 10; }
+inline int f5222_11(int x) { return x * 11; }
+inline int f5222_12(int x) { return x * 12; }
+inline int f5222_13(int x) { return x * 13; }
+inline int f5222_14(int x) { return x * 14; }
+inline int f5222_15(int x) { return x * 15; }
+inline int f5222_16(int x) { return x * 16; }
+inline int f5222_17(int x) { return x * 17; }
+inline int f5222_18(int x) { return x * 18; }
+inline int f5222_19(int x) { return x * 19; }
+inline int f5222_20(int x) { return x * 20; }
+inline int f5222_21(int x) { return x * 21; }
+inline int f5222_22(int x) { return x * 22; }
+inline int f5222_23(int x) { return x * 23; }
+inline int f5222_24(int x) { return x * 24; }
+inline int f5222_25(int x) { return x * 25; }
+inline int f5222_26(int x) { return x * 26; }
+inline int f5222_27(int x) { return x * 27; }
+inline int f5222_28(int x) { return x * 28; }
+inline int f5222_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5223 */
+#include <vector>
+#include "h1889.h"
+#include "h8544.h"
+#include "h6226.h"
+#include "h6768.h"
+#include "h7866.h"
+#ifdef X
+#include "h9349.h"
+#endif
+struct S5223 { int a; const char *s = "x//y"; };
+inline int f5223_0(int x) { return x * 0; }
+inline int f5223_1(int x) { return x * 1; }
+inline int f5223_2(int x) { return x * 2; }
+inline int f5223_3(int x) { return x * 3; }
+inline int f5223_4(int x) { return x * 4; }
+inline int f5223_5(int x) { return x * 5; }
+inline int f5223_6(int x) { return x * 6; }
+inline int f5223_7(int x) { return x * 7; }
+inline int f5223_8(int x) { return x * 8; }
+inline int f5223_9(int x) { return x * 9; }
+inline int f5223_10(int x) { return x * 10; }
+inline int f5223_11(int x) { return x * 11; }
+inline int f5223_12(int x) { return x * 12; }
+inline int f5223_13(int x) { return x * 13; }
+inline int f5223_14(int x) { return x * 14; }
+inline int f5223_15(int x) { return x * 15; }
+inline int f5223_16(int x) { return x * 16; }
+inline int f5223_17(int x) { return x * 17; }
+inline int f5223_18(int x) { return x * 18; }
+inline int f5223_19(int x) { return x * 19; }
+inline int f5223_20(int x) { return x * 20; }
+inline int f5223_21(int x) { return x * 21; }
+inline int f5223_22(int x) { return x * 22; }
+inline int f5223_23(int x) { return x * 23; }
+inline int f5223_24(int x) { return x * 24; }
+inline int f5223_25(int x) { return x * 25; }
+inline int f5223_26(int x) { return x * 26; }
+inline int f5223_27(int x) { return x * 27; }
+inline int f5223_28(int x) { return x * 28; }
+inline int f5223_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5226 */
+#include <vector>
+#include "h9493.h"
+#include "h3557.h"
+#include "h4220.h"
+#include "h9221.h"
+#include "h1168.h"
+#ifdef X
+#include "h6658.h"
+#endif
+struct S5226 { int a; const char *s = "x//y"; };
+inline int f5226_0(int x) { return x * 0; }
+inline int f5226_1(int x) { return x * 1; }
+inline int f5226_2(int x) { return x * 2; }
+inline int f5226_3(int x) { return x * 3; }
+inline int f5226_4(int x) { return x * 4; }
+inline int f5226_5(int x) { return x * 5; }
+inline int f5226_6(int x) { return x * 6; }
+inline int f5226_7(int x) { return x * 7; }
+inline int f5226_8(int x) { return x * 8; }
+inline int f5226_9(int x) { return x * 9; }
+inline int f5226_10(int x) { return x * 10; }
+inline int f5226_11(int x) { return x * 11; }
+inline int f5226_12(int x) { return x * 12; }
+inline int f5226_13(int x) { return x * 13; }
+inline int f5226_14(int x) { return x * 14; }
+inline int f5226_15(int x) { return x * 15; }
+inline int f5226_16(int x) { return x * 16; }
+inline int f5226_17(int x) { return x * 17; }
+inline int f5226_18(int x) { return x * 18; }
+inline int f5226_19(int x) { return x * 19; }
+inline int f5226_20(int x) { return x * 20; }
+inline int f5226_21(int x) { return x * 21; }
+inline int f5226_22(int x) { return x * 22; }
+inline int f5226_23(int x) { return x * 23; }
+inline int f5226_24(int x) { return x * 24; }
+inline int f5226_25(int x) { return x * 25; }
+inline int f5226_26(int x) { return x * 26; }
+inline int f5226_27(int x) { return x * 27; }
+inline int f5226_28(int x) { return x * 28; }
+inline int f5226_29(int x) { return x * 29; }
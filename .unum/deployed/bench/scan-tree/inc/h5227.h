@@ -0,0 +1,42 @@
+#pragma once
+/* header 5227 */
+#include <vector>
+#include "h9072.h"
+#include "h150.h"
+#include "h7828.h"
+#include "h2240.h"
+#include "h1687.h"
+#ifdef X
+#include "h3353.h"
+#endif
+struct S5227 { int a; const char *s = "x//y"; };
+inline int f5227_0(int x) { return x * 0; }
+inline int f5227_1(int x) { return x * 1; }
+inline int f5227_2(int x) { return x * 2; }
+inline int f5227_3(int x) { return x * 3; }
+inline int f5227_4(int x) { return x * 4; }
+inline int f5227_5(int x) { return x * 5; }
+inline int f5227_6(int x) { return x * 6; }
+inline int f5227_7(int x) { return x * 7; }
+inline int f5227_8(int x) { return x * 8; }
+inline int f5227_9(int x) { return x * 9; }
+inline int f5227_10(int x) { return x * 10; }
+inline int f5227_11(int x) { return x * 11; }
+inline int f5227_12(int x) { return x * 12; }
+inline int f5227_13(int x) { return x * 13; }
+inline int f5227_14(int x) { return x * 14; }
+inline int f5227_15(int x) { return x * 15; }
+inline int f5227_16(int x) { return x * 16; }
+inline int f5227_17(int x) { return x * 17; }
+inline int f5227_18(int x) { return x * 18; }
+inline int f5227_19(int x) { return x * 19; }
+inline int f5227_20(int x) { return x * 20; }
+inline int f5227_21(int x) { return x * 21; }
+inline int f5227_22(int x) { return x * 22; }
+inline int f5227_23(int x) { return x * 23; }
+inline int f5227_24(int x) { return x * 24; }
+inline int f5227_25(int x) { return x * 25; }
+inline int f5227_26(int x) { return x * 26; }
+inline int f5227_27(int x) { return x * 27; }
+inline int f5227_28(int x) { return x * 28; }
+inline int f5227_29(int x) { return x * 29; }
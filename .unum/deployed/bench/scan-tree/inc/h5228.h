@@ -0,0 +1,42 @@
+#pragma once
+/* header 5228 */
+#include <vector>
+#include "h4584.h"
+#include "h9256.h"
+#include "h6669.h"
+#include "h53.h"
+#include "h945.h"
+#ifdef X
+#include "h5022.h"
+#endif
+struct S5228 { int a; const char *s = "x//y"; };
+inline int f5228_0(int x) { return x * 0; }
+inline int f5228_1(int x) { return x * 1; }
+inline int f5228_2(int x) { return x * 2; }
+inline int f5228_3(int x) { return x * 3; }
+inline int f5228_4(int x) { return x * 4; }
+inline int f5228_5(int x) { return x * 5; }
+inline int f5228_6(int x) { return x * 6; }
+inline int f5228_7(int x) { return x * 7; }
+inline int f5228_8(int x) { return x * 8; }
+inline int f5228_9(int x) { return x * 9; }
+inline int f5228_10(int x) { return x * 10; }
+inline int f5228_11(int x) { return x * 11; }
+inline int f5228_12(int x) { return x * 12; }
+inline int f5228_13(int x) { return x * 13; }
+inline int f5228_14(int x) { return x * 14; }
+inline int f5228_15(int x) { return x * 15; }
+inline int f5228_16(int x) { return x * 16; }
+inline int f5228_17(int x) { return x * 17; }
+inline int f5228_18(int x) { return x * 18; }
+inline int f5228_19(int x) { return x * 19; }
+inline int f5228_20(int x) { return x * 20; }
+inline int f5228_21(int x) { return x * 21; }
+inline int f5228_22(int x) { return x * 22; }
+inline int f5228_23(int x) { return x * 23; }
+inline int f5228_24(int x) { return x * 24; }
+inline int f5228_25(int x) { return x * 25; }
+inline int f5228_26(int x) { return x * 26; }
+inline int f5228_27(int x) { return x * 27; }
+inline int f5228_28(int x) { return x * 28; }
+inline int f5228_29(int x) { return x * 29; }
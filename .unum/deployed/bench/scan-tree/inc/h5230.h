@@ -0,0 +1,42 @@
+#pragma once
+/* header 5230 */
+#include <vector>
+#include "h3864.h"
+#include "h4561.h"
+#include "h5429.h"
+#include "h2599.h"
+#include "h651.h"
+#ifdef X
+#include "h6288.h"
+#endif
+struct S5230 { int a; const char *s = "x//y"; };
+inline int f5230_0(int x) { return x * 0; }
+inline int f5230_1(int x) { return x * 1; }
+inline int f5230_2(int x) { return x * 2; }
+inline int f5230_3(int x) { return x * 3; }
+inline int f5230_4(int x) { return x * 4; }
+inline int f5230_5(int x) { return x * 5; }
+inline int f5230_6(int x) { return x * 6; }
+inline int f5230_7(int x) { return x * 7; }
+inline int f5230_8(int x) { return x * 8; }
+inline int f5230_9(int x) { return x * 9; }
+inline int f5230_10(int x) { return x * 10; }
+inline int f5230_11(int x) { return x * 11; }
+inline int f5230_12(int x) { return x * 12; }
+inline int f5230_13(int x) { return x * 13; }
+inline int f5230_14(int x) { return x * 14; }
+inline int f5230_15(int x) { return x * 15; }
+inline int f5230_16(int x) { return x * 16; }
+inline int f5230_17(int x) { return x * 17; }
+inline int f5230_18(int x) { return x * 18; }
+inline int f5230_19(int x) { return x * 19; }
+inline int f5230_20(int x) { return x * 20; }
+inline int f5230_21(int x) { return x * 21; }
+inline int f5230_22(int x) { return x * 22; }
+inline int f5230_23(int x) { return x * 23; }
+inline int f5230_24(int x) { return x * 24; }
+inline int f5230_25(int x) { return x * 25; }
+inline int f5230_26(int x) { return x * 26; }
+inline int f5230_27(int x) { return x * 27; }
+inline int f5230_28(int x) { return x * 28; }
+inline int f5230_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5232 */
+#include <vector>
+#include "h4429.h"
+#include "h4192.h"
+#include "h3308.h"
+#include "h1309.h"
+#include "h648.h"
+#ifdef X
+#include "h1047.h"
+#endif
+struct S5232 { int a; const char *s = "x//y"; };
+inline int f5232_0(int x) { return x * 0; }
+inline int f5232_1(int x) { return x * 1; }
+inline int f5232_2(int x) { return x * 2; }
+inline int f5232_3(int x) { return x * 3; }
+inline int f5232_4(int x) { return x * 4; }
+inline int f5232_5(int x) { return x * 5; }
+inline int f5232_6(int x) { return x * 6; }
+inline int f5232_7(int x) { return x * 7; }
+inline int f5232_8(int x) { return x * 8; }
+inline int f5232_9(int x) { return x * 9; }
+inline int f5232_10(int x) { return x * 10; }
+inline int f5232_11(int x) { return x * 11; }
+inline int f5232_12(int x) { return x * 12; }
+inline int f5232_13(int x) { return x * 13; }
+inline int f5232_14(int x) { return x * 14; }
+inline int f5232_15(int x) { return x * 15; }
+inline int f5232_16(int x) { return x * 16; }
+inline int f5232_17(int x) { return x * 17; }
+inline int f5232_18(int x) { return x * 18; }
+inline int f5232_19(int x) { return x * 19; }
+inline int f5232_20(int x) { return x * 20; }
+inline int f5232_21(int x) { return x * 21; }
+inline int f5232_22(int x) { return x * 22; }
+inline int f5232_23(int x) { return x * 23; }
+inline int f5232_24(int x) { return x * 24; }
+inline int f5232_25(int x) { return x * 25; }
+inline int f5232_26(int x) { return x * 26; }
+inline int f5232_27(int x) { return x * 27; }
+inline int f5232_28(int x) { return x * 28; }
+inline int f5232_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5234 */
+#include <vector>
+#include "h8281.h"
+#include "h7466.h"
+#include "h2889.h"
+#include "h103.h"
+#include "h9787.h"
+#ifdef X
+#include "h884.h"
+#endif
+struct S5234 { int a; const char *s = "x//y"; };
+inline int f5234_0(int x) { return x * 0; }
+inline int f5234_1(int x) { return x * 1; }
+inline int f5234_2(int x) { return x * 2; }
+inline int f5234_3(int x) { return x * 3; }
+inline int f5234_4(int x) { return x * 4; }
+inline int f5234_5(int x) { return x * 5; }
+inline int f5234_6(int x) { return x * 6; }
+inline int f5234_7(int x) { return x * 7; }
+inline int f5234_8(int x) { return x * 8; }
+inline int f5234_9(int x) { return x * 9; }
+inline int f5234_10(int x) { return x * 10; }
+inline int f5234_11(int x) { return x * 11; }
+inline int f5234_12(int x) { return x * 12; }
+inline int f5234_13(int x) { return x * 13; }
+inline int f5234_14(int x) { return x * 14; }
+inline int f5234_15(int x) { return x * 15; }
+inline int f5234_16(int x) { return x * 16; }
+inline int f5234_17(int x) { return x * 17; }
+inline int f5234_18(int x) { return x * 18; }
+inline int f5234_19(int x) { return x * 19; }
+inline int f5234_20(int x) { return x * 20; }
+inline int f5234_21(int x) { return x * 21; }
+inline int f5234_22(int x) { return x * 22; }
+inline int f5234_23(int x) { return x * 23; }
+inline int f5234_24(int x) { return x * 24; }
+inline int f5234_25(int x) { return x * 25; }
+inline int f5234_26(int x) { return x * 26; }
+inline int f5234_27(int x) { return x * 27; }
+inline int f5234_28(int x) { return x * 28; }
+inline int f5234_29(int x) { return x * 29; }
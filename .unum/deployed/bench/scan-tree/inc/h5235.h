@@ -0,0 +1,42 @@
+#pragma once
+/* header 5235 */
+#include <vector>
+#include "h4106.h"
+#include "h6298.h"
+#include "h24.h"
+#include "h3516.h"
+#include "h986.h"
+#ifdef X
+#include "h6224.h"
+#endif
+struct S5235 { int a; const char *s = "x//y"; };
+inline int f5235_0(int x) { return x * 0; }
+inline int f5235_1(int x) { return x * 1; }
+inline int f5235_2(int x) { return x * 2; }
+inline int f5235_3(int x) { return x * 3; }
+inline int f5235_4(int x) { return x * 4; }
+inline int f5235_5(int x) { return x * 5; }
+inline int f5235_6(int x) { return x * 6; }
+inline int f5235_7(int x) { return x * 7; }
+inline int f5235_8(int x) { return x * 8; }
+inline int f5235_9(int x) { return x * 9; }
+inline int f5235_10(int x) { return x * 10; }
+inline int f5235_11(int x) { return x * 11; }
+inline int f5235_12(int x) { return x * 12; }
+inline int f5235_13(int x) { return x * 13; }
+inline int f5235_14(int x) { return x * 14; }
+inline int f5235_15(int x) { return x * 15; }
+inline int f5235_16(int x) { return x * 16; }
+inline int f5235_17(int x) { return x * 17; }
+inline int f5235_18(int x) { return x * 18; }
+inline int f5235_19(int x) { return x * 19; }
+inline int f5235_20(int x) { return x * 20; }
+inline int f5235_21(int x) { return x * 21; }
+inline int f5235_22(int x) { return x * 22; }
+inline int f5235_23(int x) { return x * 23; }
+inline int f5235_24(int x) { return x * 24; }
+inline int f5235_25(int x) { return x * 25; }
+inline int f5235_26(int x) { return x * 26; }
+inline int f5235_27(int x) { return x * 27; }
+inline int f5235_28(int x) { return x * 28; }
+inline int f5235_29(int x) { return x * 29; }
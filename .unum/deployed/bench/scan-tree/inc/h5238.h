@@ -0,0 +1,42 @@
+#pragma once
+/* header 5238 */
+#include <vector>
+#include "h4497.h"
+#include "h555.h"
+#include "h4331.h"
+#include "h4454.h"
+#include "h7329.h"
+#ifdef X
+#include "h617.h"
+#endif
+struct S5238 { int a; const char *s = "x//y"; };
+inline int f5238_0(int x) { return x * 0; }
+inline int f5238_1(int x) { return x * 1; }
+inline int f5238_2(int x) { return x * 2; }
+inline int f5238_3(int x) { return x * 3; }
+inline int f5238_4(int x) { return x * 4; }
+inline int f5238_5(int x) { return x * 5; }
+inline int f5238_6(int x) { return x * 6; }
+inline int f5238_7(int x) { return x * 7; }
+inline int f5238_8(int x) { return x * 8; }
+inline int f5238_9(int x) { return x * 9; }
+inline int f5238_10(int x) { return x * 10; }
+inline int f5238_11(int x) { return x * 11; }
+inline int f5238_12(int x) { return x * 12; }
+inline int f5238_13(int x) { return x * 13; }
+inline int f5238_14(int x) { return x * 14; }
+inline int f5238_15(int x) { return x * 15; }
+inline int f5238_16(int x) { return x * 16; }
+inline int f5238_17(int x) { return x * 17; }
+inline int f5238_18(int x) { return x * 18; }
+inline int f5238_19(int x) { return x * 19; }
+inline int f5238_20(int x) { return x * 20; }
+inline int f5238_21(int x) { return x * 21; }
+inline int f5238_22(int x) { return x * 22; }
+inline int f5238_23(int x) { return x * 23; }
+inline int f5238_24(int x) { return x * 24; }
+inline int f5238_25(int x) { return x * 25; }
+inline int f5238_26(int x) { return x * 26; }
+inline int f5238_27(int x) { return x * 27; }
+inline int f5238_28(int x) { return x * 28; }
+inline int f5238_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 524 */
+#include <vector>
+#include "h1489.h"
+#include "h6105.h"
+#include "h3684.h"
+#include "h1213.h"
+#include "h6479.h"
+#ifdef X
+#include "h5315.h"
+#endif
+struct S524 { int a; const char *s = "x//y"; };
+inline int f524_0(int x) { return x * 0; }
+inline int f524_1(int x) { return x * 1; }
+inline int f524_2(int x) { return x * 2; }
+inline int f524_3(int x) { return x * 3; }
+inline int f524_4(int x) { return x * 4; }
+inline int f524_5(int x) { return x * 5; }
+inline int f524_6(int x) { return x * 6; }
+inline int f524_7(int x) { return x * 7; }
+inline int f524_8(int x) { return x * 8; }
+inline int f524_9(int x) { return x * 9; }
+inline int f524_10(int x) { return x * 10; }
+inline int f524_11(int x) { return x * 11; }
+inline int f524_12(int x) { return x * 12; }
+inline int f524_13(int x) { return x * 13; }
+inline int f524_14(int x) { return x * 14; }
+inline int f524_15(int x) { return x * 15; }
+inline int f524_16(int x) { return x * 16; }
+inline int f524_17(int x) { return x * 17; }
+inline int f524_18(int x) { return x * 18; }
+inline int f524_19(int x) { return x * 19; }
+inline int f524_20(int x) { return x * 20; }
+inline int f524_21(int x) { return x * 21; }
+inline int f524_22(int x) { return x * 22; }
+inline int f524_23(int x) { return x * 23; }
+inline int f524_24(int x) { return x * 24; }
+inline int f524_25(int x) { return x * 25; }
+inline int f524_26(int x) { return x * 26; }
+inline int f524_27(int x) { return x * 27; }
+inline int f524_28(int x) { return x * 28; }
+inline int f524_29(int x) { return x * 29; }
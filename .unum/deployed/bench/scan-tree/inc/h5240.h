@@ -0,0 +1,42 @@
+#pragma once
+/* header 5240 */
+#include <vector>
+#include "h5046.h"
+#include "h6806.h"
+#include "h3099.h"
+#include "h8573.h"
+#include "h2484.h"
+#ifdef X
+#include "h132.h"
+#endif
+struct S5240 { int a; const char *s = "x//y"; };
+inline int f5240_0(int x) { return x * 0; }
+inline int f5240_1(int x) { return x * 1; }
+inline int f5240_2(int x) { return x * 2; }
+inline int f5240_3(int x) { return x * 3; }
+inline int f5240_4(int x) { return x * 4; }
+inline int f5240_5(int x) { return x * 5; }
+inline int f5240_6(int x) { return x * 6; }
+inline int f5240_7(int x) { return x * 7; }
+inline int f5240_8(int x) { return x * 8; }
+inline int f5240_9(int x) { return x * 9; }
+inline int f5240_10(int x) { return x * 10; }
+inline int f5240_11(int x) { return x * 11; }
+inline int f5240_12(int x) { return x * 12; }
+inline int f5240_13(int x) { return x * 13; }
+inline int f5240_14(int x) { return x * 14; }
+inline int f5240_15(int x) { return x * 15; }
+inline int f5240_16(int x) { return x * 16; }
+inline int f5240_17(int x) { return x * 17; }
+inline int f5240_18(int x) { return x * 18; }
+inline int f5240_19(int x) { return x * 19; }
+inline int f5240_20(int x) { return x * 20; }
+inline int f5240_21(int x) { return x * 21; }
+inline int f5240_22(int x) { return x * 22; }
+inline int f5240_23(int x) { return x * 23; }
+inline int f5240_24(int x) { return x * 24; }
+inline int f5240_25(int x) { return x * 25; }
+inline int f5240_26(int x) { return x * 26; }
+inline int f5240_27(int x) { return x * 27; }
+inline int f5240_28(int x) { return x * 28; }
+inline int f5240_29(int x) { return x * 29; }
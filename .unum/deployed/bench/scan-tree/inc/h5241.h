@@ -0,0 +1,42 @@
+#pragma once
+/* header 5241 */
+#include <vector>
+#include "h841.h"
+#include "h4017.h"
+#include "h5499.h"
+#include "h1162.h"
+#include "h8490.h"
+#ifdef X
+#include "h1590.h"
+#endif
+struct S5241 { int a; const char *s = "x//y"; };
+inline int f5241_0(int x) { return x * 0; }
+inline int f5241_1(int x) { return x * 1; }
+inline int f5241_2(int x) { return x * 2; }
+inline int f5241_3(int x) { return x * 3; }
+inline int f5241_4(int x) { return x * 4; }
+inline int f5241_5(int x) { return x * 5; }
+inline int f5241_6(int x) { return x * 6; }
+inline int f5241_7(int x) { return x * 7; }
+inline int f5241_8(int x) { return x * 8; }
+inline int f5241_9(int x) { return x * 9; }
+inline int f5241_10(int x) { return x * 10; }
+inline int f5241_11(int x) { return x * 11; }
+inline int f5241_12(int x) { return x * 12; }
+inline int f5241_13(int x) { return x * 13; }
+inline int f5241_14(int x) { return x * 14; }
+inline int f5241_15(int x) { return x * 15; }
+inline int f5241_16(int x) { return x * 16; }
+inline int f5241_17(int x) { return x * 17; }
+inline int f5241_18(int x) { return x * 18; }
+inline int f5241_19(int x) { return x * 19; }
+inline int f5241_20(int x) { return x * 20; }
+inline int f5241_21(int x) { return x * 21; }
+inline int f5241_22(int x) { return x * 22; }
+inline int f5241_23(int x) { return x * 23; }
+inline int f5241_24(int x) { return x * 24; }
+inline int f5241_25(int x) { return x * 25; }
+inline int f5241_26(int x) { return x * 26; }
+inline int f5241_27(int x) { return x * 27; }
+inline int f5241_28(int x) { return x * 28; }
+inline int f5241_29(int x) { return x * 29; }
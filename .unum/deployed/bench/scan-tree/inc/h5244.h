@@ -0,0 +1,42 @@
+#pragma once
+/* header 5244 */
+#include <vector>
+#include "h6806.h"
+#include "h4475.h"
+#include "h3575.h"
+#include "h998.h"
+#include "h8602.h"
+#ifdef X
+#include "h2717.h"
+#endif
+struct S5244 { int a; const char *s = "x//y"; };
+inline int f5244_0(int x) { return x * 0; }
+inline int f5244_1(int x) { return x * 1; }
+inline int f5244_2(int x) { return x * 2; }
+inline int f5244_3(int x) { return x * 3; }
+inline int f5244_4(int x) { return x * 4; }
+inline int f5244_5(int x) { return x * 5; }
+inline int f5244_6(int x) { return x * 6; }
+inline int f5244_7(int x) { return x * 7; }
+inline int f5244_8(int x) { return x * 8; }
+inline int f5244_9(int x) { return x * 9; }
+inline int f5244_10(int x) { return x * 10; }
+inline int f5244_11(int x) { return x * 11; }
+inline int f5244_12(int x) { return x * 12; }
+inline int f5244_13(int x) { return x * 13; }
+inline int f5244_14(int x) { return x * 14; }
+inline int f5244_15(int x) { return x * 15; }
+inline int f5244_16(int x) { return x * 16; }
+inline int f5244_17(int x) { return x * 17; }
+inline int f5244_18(int x) { return x * 18; }
+inline int f5244_19(int x) { return x * 19; }
+inline int f5244_20(int x) { return x * 20; }
+inline int f5244_21(int x) { return x * 21; }
+inline int f5244_22(int x) { return x * 22; }
+inline int f5244_23(int x) { return x * 23; }
+inline int f5244_24(int x) { return x * 24; }
+inline int f5244_25(int x) { return x * 25; }
+inline int f5244_26(int x) { return x * 26; }
+inline int f5244_27(int x) { return x * 27; }
+inline int f5244_28(int x) { return x * 28; }
+inline int f5244_29(int x) { return x * 29; }
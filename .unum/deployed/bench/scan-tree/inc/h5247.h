@@ -0,0 +1,42 @@
+#pragma once
+/* header 5247 */
+#include <vector>
+#include "h864.h"
+#include "h2994.h"
+#include "h5862.h"
+#include "h7100.h"
+#include "h5489.h"
+#ifdef X
+#include "h7503.h"
+#endif
+struct S5247 { int a; const char *s = "x//y"; };
+inline int f5247_0(int x) { return x * 0; }
+inline int f5247_1(int x) { return x * 1; }
+inline int f5247_2(int x) { return x * 2; }
+inline int f5247_3(int x) { return x * 3; }
+inline int f5247_4(int x) { return x * 4; }
+inline int f5247_5(int x) { return x * 5; }
+inline int f5247_6(int x) { return x * 6; }
+inline int f5247_7(int x) { return x * 7; }
+inline int f5247_8(int x) { return x * 8; }
+inline int f5247_9(int x) { return x * 9; }
+inline int f5247_10(int x) { return x * 10; }
+inline int f5247_11(int x) { return x * 11; }
+inline int f5247_12(int x) { return x * 12; }
+inline int f5247_13(int x) { return x * 13; }
+inline int f5247_14(int x) { return x * 14; }
+inline int f5247_15(int x) { return x * 15; }
+inline int f5247_16(int x) { return x * 16; }
+inline int f5247_17(int x) { return x * 17; }
+inline int f5247_18(int x) { return x * 18; }
+inline int f5247_19(int x) { return x * 19; }
+inline int f5247_20(int x) { return x * 20; }
+inline int f5247_21(int x) { return x * 21; }
+inline int f5247_22(int x) { return x * 22; }
+inline int f5247_23(int x) { return x * 23; }
+inline int f5247_24(int x) { return x * 24; }
+inline int f5247_25(int x) { return x * 25; }
+inline int f5247_26(int x) { return x * 26; }
+inline int f5247_27(int x) { return x * 27; }
+inline int f5247_28(int x) { return x * 28; }
+inline int f5247_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5249 */
+#include <vector>
+#include "h646.h"
+#include "h4602.h"
+#include "h9870.h"
+#include "h3560.h"
+#include "h4383.h"
+#ifdef X
+#include "h3176.h"
+#endif
+struct S5249 { int a; const char *s = "x//y"; };
+inline int f5249_0(int x) { return x * 0; }
+inline int f5249_1(int x) { return x * 1; }
+inline int f5249_2(int x) { return x * 2; }
+inline int f5249_3(int x) { return x * 3; }
+inline int f5249_4(int x) { return x * 4; }
+inline int f5249_5(int x) { return x * 5; }
+inline int f5249_6(int x) { return x * 6; }
+inline int f5249_7(int x) { return x * 7; }
+inline int f5249_8(int x) { return x * 8; }
+inline int f5249_9(int x) { return x * 9; }
+inline int f5249_10(int x) { return x * 10; }
+inline int f5249_11(int x) { return x * 11; }
+inline int f5249_12(int x) { return x * 12; }
+inline int f5249_13(int x) { return x * 13; }
+inline int f5249_14(int x) { return x * 14; }
+inline int f5249_15(int x) { return x * 15; }
+inline int f5249_16(int x) { return x * 16; }
+inline int f5249_17(int x) { return x * 17; }
+inline int f5249_18(int x) { return x * 18; }
+inline int f5249_19(int x) { return x * 19; }
+inline int f5249_20(int x) { return x * 20; }
+inline int f5249_21(int x) { return x * 21; }
+inline int f5249_22(int x) { return x * 22; }
+inline int f5249_23(int x) { return x * 23; }
+inline int f5249_24(int x) { return x * 24; }
+inline int f5249_25(int x) { return x * 25; }
+inline int f5249_26(int x) { return x * 26; }
+inline int f5249_27(int x) { return x * 27; }
+inline int f5249_28(int x) { return x * 28; }
+inline int f5249_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5253 */
+#include <vector>
+#include "h8743.h"
+#include "h8253.h"
+#include "h8156.h"
+#include "h8218.h"
+#include "h3930.h"
+#ifdef X
+#include "h1287.h"
+#endif
+struct S5253 { int a; const char *s = "x//y"; };
+inline int f5253_0(int x) { return x * 0; }
+inline int f5253_1(int x) { return x * 1; }
+inline int f5253_2(int x) { return x * 2; }
+inline int f5253_3(int x) { return x * 3; }
+inline int f5253_4(int x) { return x * 4; }
+inline int f5253_5(int x) { return x * 5; }
+inline int f5253_6(int x) { return x * 6; }
+inline int f5253_7(int x) { return x * 7; }
+inline int f5253_8(int x) { return x * 8; }
+inline int f5253_9(int x) { return x * 9; }
+inline int f5253_10(int x) { return x * 10; }
+inline int f5253_11(int x) { return x * 11; }
+inline int f5253_12(int x) { return x * 12; }
+inline int f5253_13(int x) { return x * 13; }
+inline int f5253_14(int x) { return x * 14; }
+inline int f5253_15(int x) { return x * 15; }
+inline int f5253_16(int x) { return x * 16; }
+inline int f5253_17(int x) { return x * 17; }
+inline int f5253_18(int x) { return x * 18; }
+inline int f5253_19(int x) { return x * 19; }
+inline int f5253_20(int x) { return x * 20; }
+inline int f5253_21(int x) { return x * 21; }
+inline int f5253_22(int x) { return x * 22; }
+inline int f5253_23(int x) { return x * 23; }
+inline int f5253_24(int x) { return x * 24; }
+inline int f5253_25(int x) { return x * 25; }
+inline int f5253_26(int x) { return x * 26; }
+inline int f5253_27(int x) { return x * 27; }
+inline int f5253_28(int x) { return x * 28; }
+inline int f5253_29(int x) { return x * 29; }
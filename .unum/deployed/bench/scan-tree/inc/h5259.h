@@ -0,0 +1,42 @@
+#pragma once
+/* header 5259 */
+#include <vector>
+#include "h4047.h"
+#include "h963.h"
+#include "h2246.h"
+#include "h1609.h"
+#include "h8637.h"
+#ifdef X
+#include "h6788.h"
+#endif
+struct S5259 { int a; const char *s = "x//y"; };
+inline int f5259_0(int x) { return x * 0; }
+inline int f5259_1(int x) { return x * 1; }
+inline int f5259_2(int x) { return x * 2; }
+inline int f5259_3(int x) { return x * 3; }
+inline int f5259_4(int x) { return x * 4; }
+inline int f5259_5(int x) { return x * 5; }
+inline int f5259_6(int x) { return x * 6; }
+inline int f5259_7(int x) { return x * 7; }
+inline int f5259_8(int x) { return x * 8; }
+inline int f5259_9(int x) { return x * 9; }
+inline int f5259_10(int x) { return x * 10; }
+inline int f5259_11(int x) { return x * 11; }
+inline int f5259_12(int x) { return x * 12; }
+inline int f5259_13(int x) { return x * 13; }
+inline int f5259_14(int x) { return x * 14; }
+inline int f5259_15(int x) { return x * 15; }
+inline int f5259_16(int x) { return x * 16; }
+inline int f5259_17(int x) { return x * 17; }
+inline int f5259_18(int x) { return x * 18; }
+inline int f5259_19(int x) { return x * 19; }
+inline int f5259_20(int x) { return x * 20; }
+inline int f5259_21(int x) { return x * 21; }
+inline int f5259_22(int x) { return x * 22; }
+inline int f5259_23(int x) { return x * 23; }
+inline int f5259_24(int x) { return x * 24; }
+inline int f5259_25(int x) { return x * 25; }
+inline int f5259_26(int x) { return x * 26; }
+inline int f5259_27(int x) { return x * 27; }
+inline int f5259_28(int x) { return x * 28; }
+inline int f5259_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 526 */
+#include <vector>
+#include "h6691.h"
+#include "h9786.h"
+#include "h1915.h"
+#include "h331.h"
+#include "h1023.h"
+#ifdef X
+#include "h7254.h"
+#endif
+struct S526 { int a; const char *s = "x//y"; };
+inline int f526_0(int x) { return x * 0; }
+inline int f526_1(int x) { return x * 1; }
+inline int f526_2(int x) { return x * 2; }
+inline int f526_3(int x) { return x * 3; }
+inline int f526_4(int x) { return x * 4; }
+inline int f526_5(int x) { return x * 5; }
+inline int f526_6(int x) { return x * 6; }
+inline int f526_7(int x) { return x * 7; }
+inline int f526_8(int x) { return x * 8; }
+inline int f526_9(int x) { return x * 9; }
+inline int f526_10(int x) { return x * 10; }
+inline int f526_11(int x) { return x * 11; }
+inline int f526_12(int x) { return x * 12; }
+inline int f526_13(int x) { return x * 13; }
+inline int f526_14(int x) { return x * 14; }
+inline int f526_15(int x) { return x * 15; }
+inline int f526_16(int x) { return x * 16; }
+inline int f526_17(int x) { return x * 17; }
+inline int f526_18(int x) { return x * 18; }
+inline int f526_19(int x) { return x * 19; }
+inline int f526_20(int x) { return x * 20; }
+inline int f526_21(int x) { return x * 21; }
+inline int f526_22(int x) { return x * 22; }
+inline int f526_23(int x) { return x * 23; }
+inline int f526_24(int x) { return x * 24; }
+inline int f526_25(int x) { return x * 25; }
+inline int f526_26(int x) { return x * 26; }
+inline int f526_27(int x) { return x * 27; }
+inline int f526_28(int x) { return x * 28; }
+inline int f526_29(int x) { return x * 29; }
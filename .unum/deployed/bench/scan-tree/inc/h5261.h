@@ -0,0 +1,42 @@
+#pragma once
+/* header 5261 */
+#include <vector>
+#include "h1802.h"
+#include "h2260.h"
+#include "h1106.h"
+#include "h2089.h"
+#include "h457.h"
+#ifdef X
+#include "h2965.h"
+#endif
+struct S5261 { int a; const char *s = "x//y"; };
+inline int f5261_0(int x) { return x * 0; }
+inline int f5261_1(int x) { return x * 1; }
+inline int f5261_2(int x) { return x * 2; }
+inline int f5261_3(int x) { return x * 3; }
+inline int f5261_4(int x) { return x * 4; }
+inline int f5261_5(int x) { return x * 5; }
+inline int f5261_6(int x) { return x * 6; }
+inline int f5261_7(int x) { return x * 7; }
+inline int f5261_8(int x) { return x * 8; }
+inline int f5261_9(int x) { return x * 9; }
+inline int f5261_10(int x) { return x * 10; }
+inline int f5261_11(int x) { return x * 11; }
+inline int f5261_12(int x) { return x * 12; }
+inline int f5261_13(int x) { return x * 13; }
+inline int f5261_14(int x) { return x * 14; }
+inline int f5261_15(int x) { return x * 15; }
+inline int f5261_16(int x) { return x * 16; }
+inline int f5261_17(int x) { return x * 17; }
+inline int f5261_18(int x) { return x * 18; }
+inline int f5261_19(int x) { return x * 19; }
+inline int f5261_20(int x) { return x * 20; }
+inline int f5261_21(int x) { return x * 21; }
+inline int f5261_22(int x) { return x * 22; }
+inline int f5261_23(int x) { return x * 23; }
+inline int f5261_24(int x) { return x * 24; }
+inline int f5261_25(int x) { return x * 25; }
+inline int f5261_26(int x) { return x * 26; }
+inline int f5261_27(int x) { return x * 27; }
+inline int f5261_28(int x) { return x * 28; }
+inline int f5261_29(int x) { return x * 29; }
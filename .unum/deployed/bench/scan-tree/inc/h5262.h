@@ -0,0 +1,42 @@
+#pragma once
+/* header 5262 */
+#include <vector>
+#include "h6788.h"
+#include "h6817.h"
+#include "h3387.h"
+#include "h4860.h"
+#include "h9991.h"
+#ifdef X
+#include "h6843.h"
+#endif
+struct S5262 { int a; const char *s = "x//y"; };
+inline int f5262_0(int x) { return x * 0; }
+inline int f5262_1(int x) { return x * 1; }
+inline int f5262_2(int x) { return x * 2; }
+inline int f5262_3(int x) { return x * 3; }
+inline int f5262_4(int x) { return x * 4; }
+inline int f5262_5(int x) { return x * 5; }
+inline int f5262_6(int x) { return x * 6; }
+inline int f5262_7(int x) { return x * 7; }
+inline int f5262_8(int x) { return x * 8; }
+inline int f5262_9(int x) { return x * 9; }
+inline int f5262_10(int x) { return x * 10; }
+inline int f5262_11(int x) { return x * 11; }
+inline int f5262_12(int x) { return x * 12; }
+inline int f5262_13(int x) { return x * 13; }
+inline int f5262_14(int x) { return x * 14; }
+inline int f5262_15(int x) { return x * 15; }
+inline int f5262_16(int x) { return x * 16; }
+inline int f5262_17(int x) { return x * 17; }
+inline int f5262_18(int x) { return x * 18; }
+inline int f5262_19(int x) { return x * 19; }
+inline int f5262_20(int x) { return x * 20; }
+inline int f5262_21(int x) { return x * 21; }
+inline int f5262_22(int x) { return x * 22; }
+inline int f5262_23(int x) { return x * 23; }
+inline int f5262_24(int x) { return x * 24; }
+inline int f5262_25(int x) { return x * 25; }
+inline int f5262_26(int x) { return x * 26; }
+inline int f5262_27(int x) { return x * 27; }
+inline int f5262_28(int x) { return x * 28; }
+inline int f5262_29(int x) { return x * 29; }
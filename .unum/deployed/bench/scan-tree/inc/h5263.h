@@ -0,0 +1,42 @@
+#pragma once
+/* header 5263 */
+#include <vector>
+#include "h6598.h"
+#include "h1249.h"
+#include "h1454.h"
+#include "h4507.h"
+#include "h423.h"
+#ifdef X
+#include "h2189.h"
+#endif
+struct S5263 { int a; const char *s = "x//y"; };
+inline int f5263_0(int x) { return x * 0; }
+inline int f5263_1(int x) { return x * 1; }
+inline int f5263_2(int x) { return x * 2; }
+inline int f5263_3(int x) { return x * 3; }
+inline int f5263_4(int x) { return x * 4; }
+inline int f5263_5(int x) { return x * 5; }
+inline int f5263_6(int x) { return x * 6; }
+inline int f5263_7(int x) { return x * 7; }
+inline int f5263_8(int x) { return x * 8; }
+inline int f5263_9(int x) { return x * 9; }
+inline int f5263_10(int x) { return x * 10; }
+inline int f5263_11(int x) { return x * 11; }
+inline int f5263_12(int x) { return x * 12; }
+inline int f5263_13(int x) { return x * 13; }
+inline int f5263_14(int x) { return x * 14; }
+inline int f5263_15(int x) { return x * 15; }
+inline int f5263_16(int x) { return x * 16; }
+inline int f5263_17(int x) { return x * 17; }
+inline int f5263_18(int x) { return x * 18; }
+inline int f5263_19(int x) { return x * 19; }
+inline int f5263_20(int x) { return x * 20; }
+inline int f5263_21(int x) { return x * 21; }
+inline int f5263_22(int x) { return x * 22; }
+inline int f5263_23(int x) { return x * 23; }
+inline int f5263_24(int x) { return x * 24; }
+inline int f5263_25(int x) { return x * 25; }
+inline int f5263_26(int x) { return x * 26; }
+inline int f5263_27(int x) { return x * 27; }
+inline int f5263_28(int x) { return x * 28; }
+inline int f5263_29(int x) { return x * 29; }
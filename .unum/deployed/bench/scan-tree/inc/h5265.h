@@ -0,0 +1,42 @@
+#pragma once
+/* header 5265 */
+#include <vector>
+#include "h5441.h"
+#include "h7829.h"
+#include "h346.h"
+#include "h2651.h"
+#include "h5933.h"
+#ifdef X
+#include "h7027.h"
+#endif
+struct S5265 { int a; const char *s = "x//y"; };
+inline int f5265_0(int x) { return x * 0; }
+inline int f5265_1(int x) { return x * 1; }
+inline int f5265_2(int x) { return x * 2; }
+inline int f5265_3(int x) { return x * 3; }
+inline int f5265_4(int x) { return x * 4; }
+inline int f5265_5(int x) { return x * 5; }
+inline int f5265_6(int x) { return x * 6; }
+inline int f5265_7(int x) { return x * 7; }
+inline int f5265_8(int x) { return x * 8; }
+inline int f5265_9(int x) { return x * 9; }
+inline int f5265_10(int x) { return x * 10; }
+inline int f5265_11(int x) { return x * 11; }
+inline int f5265_12(int x) { return x * 12; }
+inline int f5265_13(int x) { return x * 13; }
+inline int f5265_14(int x) { return x * 14; }
+inline int f5265_15(int x) { return x * 15; }
+inline int f5265_16(int x) { return x * 16; }
+inline int f5265_17(int x) { return x * 17; }
+inline int f5265_18(int x) { return x * 18; }
+inline int f5265_19(int x) { return x * 19; }
+inline int f5265_20(int x) { return x * 20; }
+inline int f5265_21(int x) { return x * 21; }
+inline int f5265_22(int x) { return x * 22; }
+inline int f5265_23(int x) { return x * 23; }
+inline int f5265_24(int x) { return x * 24; }
+inline int f5265_25(int x) { return x * 25; }
+inline int f5265_26(int x) { return x * 26; }
+inline int f5265_27(int x) { return x * 27; }
+inline int f5265_28(int x) { return x * 28; }
+inline int f5265_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5267 */
+#include <vector>
+#include "h1232.h"
+#include "h9137.h"
+#include "h8773.h"
+#include "h5057.h"
+#include "h1094.h"
+#ifdef X
+#include "h2526.h"
+#endif
+struct S5267 { int a; const char *s = "x//y"; };
+inline int f5267_0(int x) { return x * 0; }
+inline int f5267_1(int x) { return x * 1; }
+inline int f5267_2(int x) { return x * 2; }
+inline int f5267_3(int x) { return x * 3; }
+inline int f5267_4(int x) { return x * 4; }
+inline int f5267_5(int x) { return x * 5; }
+inline int f5267_6(int x) { return x * 6; }
+inline int f5267_7(int x) { return x * 7; }
+inline int f5267_8(int x) { return x * 8; }
+inline int f5267_9(int x) { return x * 9; }
+inline int f5267_10(int x) { return x * 10; }
+inline int f5267_11(int x) { return x * 11; }
+inline int f5267_12(int x) { return x * 12; }
+inline int f5267_13(int x) { return x * 13; }
+inline int f5267_14(int x) { return x * 14; }
+inline int f5267_15(int x) { return x * 15; }
+inline int f5267_16(int x) { return x * 16; }
+inline int f5267_17(int x) { return x * 17; }
+inline int f5267_18(int x) { return x * 18; }
+inline int f5267_19(int x) { return x * 19; }
+inline int f5267_20(int x) { return x * 20; }
+inline int f5267_21(int x) { return x * 21; }
+inline int f5267_22(int x) { return x * 22; }
+inline int f5267_23(int x) { return x * 23; }
+inline int f5267_24(int x) { return x * 24; }
+inline int f5267_25(int x) { return x * 25; }
+inline int f5267_26(int x) { return x * 26; }
+inline int f5267_27(int x) { return x * 27; }
+inline int f5267_28(int x) { return x * 28; }
+inline int f5267_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5269 */
+#include <vector>
+#include "h6793.h"
+#include "h3119.h"
+#include "h8279.h"
+#include "h5933.h"
+#include "h1432.h"
+#ifdef X
+#include "h2199.h"
+#endif
+struct S5269 { int a; const char *s = "x//y"; };
+inline int f5269_0(int x) { return x * 0; }
+inline int f5269_1(int x) { return x * 1; }
+inline int f5269_2(int x) { return x * 2; }
+inline int f5269_3(int x) { return x * 3; }
+inline int f5269_4(int x) { return x * 4; }
+inline int f5269_5(int x) { return x * 5; }
+inline int f5269_6(int x) { return x * 6; }
+inline int f5269_7(int x) { return x * 7; }
+inline int f5269_8(int x) { return x * 8; }
+inline int f5269_9(int x) { return x * 9; }
+inline int f5269_10(int x) { return x * 10; }
+inline int f5269_11(int x) { return x * 11; }
+inline int f5269_12(int x) { return x * 12; }
+inline int f5269_13(int x) { return x * 13; }
+inline int f5269_14(int x) { return x * 14; }
+inline int f5269_15(int x) { return x * 15; }
+inline int f5269_16(int x) { return x * 16; }
+inline int f5269_17(int x) { return x * 17; }
+inline int f5269_18(int x) { return x * 18; }
+inline int f5269_19(int x) { return x * 19; }
+inline int f5269_20(int x) { return x * 20; }
+inline int f5269_21(int x) { return x * 21; }
+inline int f5269_22(int x) { return x * 22; }
+inline int f5269_23(int x) { return x * 23; }
+inline int f5269_24(int x) { return x * 24; }
+inline int f5269_25(int x) { return x * 25; }
+inline int f5269_26(int x) { return x * 26; }
+inline int f5269_27(int x) { return x * 27; }
+inline int f5269_28(int x) { return x * 28; }
+inline int f5269_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 527 */
+#include <vector>
+#include "h6523.h"
+#include "h8576.h"
+#include "h7456.h"
+#include "h6381.h"
+#include "h6631.h"
+#ifdef X
+#include "h627.h"
+#endif
+struct S527 { int a; const char *s = "x//y"; };
+inline int f527_0(int x) { return x * 0; }
+inline int f527_1(int x) { return x * 1; }
+inline int f527_2(int x) { return x * 2; }
+inline int f527_3(int x) { return x * 3; }
+inline int f527_4(int x) { return x * 4; }
+inline int f527_5(int x) { return x * 5; }
+inline int f527_6(int x) { return x * 6; }
+inline int f527_7(int x) { return x * 7; }
+inline int f527_8(int x) { return x * 8; }
+inline int f527_9(int x) { return x * 9; }
+inline int f527_10(int x) { return x * 10; }
+inline int f527_11(int x) { return x * 11; }
+inline int f527_12(int x) { return x * 12; }
+inline int f527_13(int x) { return x * 13; }
+inline int f527_14(int x) { return x * 14; }
+inline int f527_15(int x) { return x * 15; }
+inline int f527_16(int x) { return x * 16; }
+inline int f527_17(int x) { return x * 17; }
+inline int f527_18(int x) { return x * 18; }
+inline int f527_19(int x) { return x * 19; }
+inline int f527_20(int x) { return x * 20; }
+inline int f527_21(int x) { return x * 21; }
+inline int f527_22(int x) { return x * 22; }
+inline int f527_23(int x) { return x * 23; }
+inline int f527_24(int x) { return x * 24; }
+inline int f527_25(int x) { return x * 25; }
+inline int f527_26(int x) { return x * 26; }
+inline int f527_27(int x) { return x * 27; }
+inline int f527_28(int x) { return x * 28; }
+inline int f527_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5271 */
+#include <vector>
+#include "h4721.h"
+#include "h2369.h"
+#include "h5364.h"
+#include "h4364.h"
+#include "h1590.h"
+#ifdef X
+#include "h5227.h"
+#endif
+struct S5271 { int a; const char *s = "x//y"; };
+inline int f5271_0(int x) { return x * 0; }
+inline int f5271_1(int x) { return x * 1; }
+inline int f5271_2(int x) { return x * 2; }
+inline int f5271_3(int x) { return x * 3; }
+inline int f5271_4(int x) { return x * 4; }
+inline int f5271_5(int x) { return x * 5; }
+inline int f5271_6(int x) { return x * 6; }
+inline int f5271_7(int x) { return x * 7; }
+inline int f5271_8(int x) { return x * 8; }
+inline int f5271_9(int x) { return x * 9; }
+inline int f5271_10(int x) { return x * 10; }
+inline int f5271_11(int x) { return x * 11; }
+inline int f5271_12(int x) { return x * 12; }
+inline int f5271_13(int x) { return x * 13; }
+inline int f5271_14(int x) { return x * 14; }
+inline int f5271_15(int x) { return x * 15; }
+inline int f5271_16(int x) { return x * 16; }
+inline int f5271_17(int x) { return x * 17; }
+inline int f5271_18(int x) { return x * 18; }
+inline int f5271_19(int x) { return x * 19; }
+inline int f5271_20(int x) { return x * 20; }
+inline int f5271_21(int x) { return x * 21; }
+inline int f5271_22(int x) { return x * 22; }
+inline int f5271_23(int x) { return x * 23; }
+inline int f5271_24(int x) { return x * 24; }
+inline int f5271_25(int x) { return x * 25; }
+inline int f5271_26(int x) { return x * 26; }
+inline int f5271_27(int x) { return x * 27; }
+inline int f5271_28(int x) { return x * 28; }
+inline int f5271_29(int x) { return x * 29; }
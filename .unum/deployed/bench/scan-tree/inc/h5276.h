@@ -0,0 +1,42 @@
+#pragma once
+/* header 5276 */
+#include <vector>
+#include "h622.h"
+#include "h5721.h"
+#include "h8708.h"
+#include "h6418.h"
+#include "h7595.h"
+#ifdef X
+#include "h8054.h"
+#endif
+struct S5276 { int a; const char *s = "x//y"; };
+inline int f5276_0(int x) { return x * 0; }
+inline int f5276_1(int x) { return x * 1; }
+inline int f5276_2(int x) { return x * 2; }
+inline int f5276_3(int x) { return x * 3; }
+inline int f5276_4(int x) { return x * 4; }
+inline int f5276_5(int x) { return x * 5; }
+inline int f5276_6(int x) { return x * 6; }
+inline int f5276_7(int x) { return x * 7; }
+inline int f5276_8(int x) { return x * 8; }
+inline int f5276_9(int x) { return x * 9; }
+inline int f5276_10(int x) { return x * 10; }
+inline int f5276_11(int x) { return x * 11; }
+inline int f5276_12(int x) { return x * 12; }
+inline int f5276_13(int x) { return x * 13; }
+inline int f5276_14(int x) { return x * 14; }
+inline int f5276_15(int x) { return x * 15; }
+inline int f5276_16(int x) { return x * 16; }
+inline int f5276_17(int x) { return x * 17; }
+inline int f5276_18(int x) { return x * 18; }
+inline int f5276_19(int x) { return x * 19; }
+inline int f5276_20(int x) { return x * 20; }
+inline int f5276_21(int x) { return x * 21; }
+inline int f5276_22(int x) { return x * 22; }
+inline int f5276_23(int x) { return x * 23; }
+inline int f5276_24(int x) { return x * 24; }
+inline int f5276_25(int x) { return x * 25; }
+inline int f5276_26(int x) { return x * 26; }
+inline int f5276_27(int x) { return x * 27; }
+inline int f5276_28(int x) { return x * 28; }
+inline int f5276_29(int x) { return x * 29; }
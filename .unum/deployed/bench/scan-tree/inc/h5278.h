@@ -0,0 +1,42 @@
+#pragma once
+/* header 5278 */
+#include <vector>
+#include "h1348.h"
+#include "h589.h"
+#include "h5325.h"
+#include "h4522.h"
+#include "h5349.h"
+#ifdef X
+#include "h5066.h"
+#endif
+struct S5278 { int a; const char *s = "x//y"; };
+inline int f5278_0(int x) { return x * 0; }
+inline int f5278_1(int x) { return x * 1; }
+inline int f5278_2(int x) { return x * 2; }
+inline int f5278_3(int x) { return x * 3; }
+inline int f5278_4(int x) { return x * 4; }
+inline int f5278_5(int x) { return x * 5; }
+inline int f5278_6(int x) { return x * 6; }
+inline int f5278_7(int x) { return x * 7; }
+inline int f5278_8(int x) { return x * 8; }
+inline int f5278_9(int x) { return x * 9; }
+inline int f5278_10(int x) { return x * 10; }
+inline int f5278_11(int x) { return x * 11; }
+inline int f5278_12(int x) { return x * 12; }
+inline int f5278_13(int x) { return x * 13; }
+inline int f5278_14(int x) { return x * 14; }
+inline int f5278_15(int x) { return x * 15; }
+inline int f5278_16(int x) { return x * 16; }
+inline int f5278_17(int x) { return x * 17; }
+inline int f5278_18(int x) { return x * 18; }
+inline int f5278_19(int x) { return x * 19; }
+inline int f5278_20(int x) { return x * 20; }
+inline int f5278_21(int x) { return x * 21; }
+inline int f5278_22(int x) { return x * 22; }
+inline int f5278_23(int x) { return x * 23; }
+inline int f5278_24(int x) { return x * 24; }
+inline int f5278_25(int x) { return x * 25; }
+inline int f5278_26(int x) { return x * 26; }
+inline int f5278_27(int x) { return x * 27; }
+inline int f5278_28(int x) { return x * 28; }
+inline int f5278_29(int x) { return x * 29; }
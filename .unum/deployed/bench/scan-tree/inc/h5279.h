@@ -0,0 +1,42 @@
+#pragma once
+/* header 5279 */
+#include <vector>
+#include "h9836.h"
+#include "h442.h"
+#include "h7770.h"
+#include "h3186.h"
+#include "h833.h"
+#ifdef X
+#include "h4284.h"
+#endif
+struct S5279 { int a; const char *s = "x//y"; };
+inline int f5279_0(int x) { return x * 0; }
+inline int f5279_1(int x) { return x * 1; }
+inline int f5279_2(int x) { return x * 2; }
+inline int f5279_3(int x) { return x * 3; }
+inline int f5279_4(int x) { return x * 4; }
+inline int f5279_5(int x) { return x * 5; }
+inline int f5279_6(int x) { return x * 6; }
+inline int f5279_7(int x) { return x * 7; }
+inline int f5279_8(int x) { return x * 8; }
+inline int f5279_9(int x) { return x * 9; }
+inline int f5279_10(int x) { return x * 10; }
+inline int f5279_11(int x) { return x * 11; }
+inline int f5279_12(int x) { return x * 12; }
+inline int f5279_13(int x) { return x * 13; }
+inline int f5279_14(int x) { return x * 14; }
+inline int f5279_15(int x) { return x * 15; }
+inline int f5279_16(int x) { return x * 16; }
+inline int f5279_17(int x) { return x * 17; }
+inline int f5279_18(int x) { return x * 18; }
+inline int f5279_19(int x) { return x * 19; }
+inline int f5279_20(int x) { return x * 20; }
+inline int f5279_21(int x) { return x * 21; }
+inline int f5279_22(int x) { return x * 22; }
+inline int f5279_23(int x) { return x * 23; }
+inline int f5279_24(int x) { return x * 24; }
+inline int f5279_25(int x) { return x * 25; }
+inline int f5279_26(int x) { return x * 26; }
+inline int f5279_27(int x) { return x * 27; }
+inline int f5279_28(int x) { return x * 28; }
+inline int f5279_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 528 */
+#include <vector>
+#include "h659.h"
+#include "h9755.h"
+#include "h4982.h"
+#include "h4725.h"
+#include "h2426.h"
+#ifdef X
+#include "h1609.h"
+#endif
+struct S528 { int a; const char *s = "x//y"; };
+inline int f528_0(int x) { return x * 0; }
+inline int f528_1(int x) { return x * 1; }
+inline int f528_2(int x) { return x * 2; }
+inline int f528_3(int x) { return x * 3; }
+inline int f528_4(int x) { return x * 4; }
+inline int f528_5(int x) { return x * 5; }
+inline int f528_6(int x) { return x * 6; }
+inline int f528_7(int x) { return x * 7; }
+inline int f528_8(int x) { return x * 8; }
+inline int f528_9(int x) { return x * 9; }
+inline int f528_10(int x) { return x * 10; }
+inline int f528_11(int x) { return x * 11; }
+inline int f528_12(int x) { return x * 12; }
+inline int f528_13(int x) { return x * 13; }
+inline int f528_14(int x) { return x * 14; }
+inline int f528_15(int x) { return x * 15; }
+inline int f528_16(int x) { return x * 16; }
+inline int f528_17(int x) { return x * 17; }
+inline int f528_18(int x) { return x * 18; }
+inline int f528_19(int x) { return x * 19; }
+inline int f528_20(int x) { return x * 20; }
+inline int f528_21(int x) { return x * 21; }
+inline int f528_22(int x) { return x * 22; }
+inline int f528_23(int x) { return x * 23; }
+inline int f528_24(int x) { return x * 24; }
+inline int f528_25(int x) { return x * 25; }
+inline int f528_26(int x) { return x * 26; }
+inline int f528_27(int x) { return x * 27; }
+inline int f528_28(int x) { return x * 28; }
+inline int f528_29(int x) { return x * 29; }
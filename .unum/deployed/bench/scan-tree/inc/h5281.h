@@ -0,0 +1,42 @@
+#pragma once
+/* header 5281 */
+#include <vector>
+#include "h9322.h"
+#include "h4902.h"
+#include "h1992.h"
+#include "h5505.h"
+#include "h4079.h"
+#ifdef X
+#include "h6849.h"
+#endif
+struct S5281 { int a; const char *s = "x//y"; };
+inline int f5281_0(int x) { return x * 0; }
+inline int f5281_1(int x) { return x * 1; }
+inline int f5281_2(int x) { return x * 2; }
+inline int f5281_3(int x) { return x * 3; }
+inline int f5281_4(int x) { return x * 4; }
+inline int f5281_5(int x) { return x * 5; }
+inline int f5281_6(int x) { return x * 6; }
+inline int f5281_7(int x) { return x * 7; }
+inline int f5281_8(int x) { return x * 8; }
+inline int f5281_9(int x) { return x * 9; }
+inline int f5281_10(int x) { return x * 10; }
+inline int f5281_11(int x) { return x * 11; }
+inline int f5281_12(int x) { return x * 12; }
+inline int f5281_13(int x) { return x * 13; }
+inline int f5281_14(int x) { return x * 14; }
+inline int f5281_15(int x) { return x * 15; }
+inline int f5281_16(int x) { return x * 16; }
+inline int f5281_17(int x) { return x * 17; }
+inline int f5281_18(int x) { return x * 18; }
+inline int f5281_19(int x) { return x * 19; }
+inline int f5281_20(int x) { return x * 20; }
+inline int f5281_21(int x) { return x * 21; }
+inline int f5281_22(int x) { return x * 22; }
+inline int f5281_23(int x) { return x * 23; }
+inline int f5281_24(int x) { return x * 24; }
+inline int f5281_25(int x) { return x * 25; }
+inline int f5281_26(int x) { return x * 26; }
+inline int f5281_27(int x) { return x * 27; }
+inline int f5281_28(int x) { return x * 28; }
+inline int f5281_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5283 */
+#include <vector>
+#include "h6063.h"
+#include "h1515.h"
+#include "h9779.h"
+#include "h462.h"
+#include "h4913.h"
+#ifdef X
+#include "h4330.h"
+#endif
+struct S5283 { int a; const char *s = "x//y"; };
+inline int f5283_0(int x) { return x * 0; }
+inline int f5283_1(int x) { return x * 1; }
+inline int f5283_2(int x) { return x * 2; }
+inline int f5283_3(int x) { return x * 3; }
+inline int f5283_4(int x) { return x * 4; }
+inline int f5283_5(int x) { return x * 5; }
+inline int f5283_6(int x) { return x * 6; }
+inline int f5283_7(int x) { return x * 7; }
+inline int f5283_8(int x) { return x * 8; }
+inline int f5283_9(int x) { return x * 9; }
+inline int f5283_10(int x) { return x * 10; }
+inline int f5283_11(int x) { return x * 11; }
+inline int f5283_12(int x) { return x * 12; }
+inline int f5283_13(int x) { return x * 13; }
+inline int f5283_14(int x) { return x * 14; }
+inline int f5283_15(int x) { return x * 15; }
+inline int f5283_16(int x) { return x * 16; }
+inline int f5283_17(int x) { return x * 17; }
+inline int f5283_18(int x) { return x * 18; }
+inline int f5283_19(int x) { return x * 19; }
+inline int f5283_20(int x) { return x * 20; }
+inline int f5283_21(int x) { return x * 21; }
+inline int f5283_22(int x) { return x * 22; }
+inline int f5283_23(int x) { return x * 23; }
+inline int f5283_24(int x) { return x * 24; }
+inline int f5283_25(int x) { return x * 25; }
+inline int f5283_26(int x) { return x * 26; }
+inline int f5283_27(int x) { return x * 27; }
+inline int f5283_28(int x) { return x * 28; }
+inline int f5283_29(int x) { return x * 29; }
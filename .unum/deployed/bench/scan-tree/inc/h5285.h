@@ -0,0 +1,42 @@
+#pragma once
+/* header 5285 */
+#include <vector>
+#include "h1067.h"
+#include "h4230.h"
+#include "h1433.h"
+#include "h1848.h"
+#include "h2533.h"
+#ifdef X
+#include "h2925.h"
+#endif
+struct S5285 { int a; const char *s = "x//y"; };
+inline int f5285_0(int x) { return x * 0; }
+inline int f5285_1(int x) { return x * 1; }
+inline int f5285_2(int x) { return x * 2; }
+inline int f5285_3(int x) { return x * 3; }
+inline int f5285_4(int x) { return x * 4; }
+inline int f5285_5(int x) { return x * 5; }
+inline int f5285_6(int x) { return x * 6; }
+inline int f5285_7(int x) { return x * 7; }
+inline int f5285_8(int x) { return x * 8; }
+inline int f5285_9(int x) { return x * 9; }
+inline int f5285_10(int x) { return x * 10; }
+inline int f5285_11(int x) { return x * 11; }
+inline int f5285_12(int x) { return x * 12; }
+inline int f5285_13(int x) { return x * 13; }
+inline int f5285_14(int x) { return x * 14; }
+inline int f5285_15(int x) { return x * 15; }
+inline int f5285_16(int x) { return x * 16; }
+inline int f5285_17(int x) { return x * 17; }
+inline int f5285_18(int x) { return x * 18; }
+inline int f5285_19(int x) { return x * 19; }
+inline int f5285_20(int x) { return x * 20; }
+inline int f5285_21(int x) { return x * 21; }
+inline int f5285_22(int x) { return x * 22; }
+inline int f5285_23(int x) { return x * 23; }
+inline int f5285_24(int x) { return x * 24; }
+inline int f5285_25(int x) { return x * 25; }
+inline int f5285_26(int x) { return x * 26; }
+inline int f5285_27(int x) { return x * 27; }
+inline int f5285_28(int x) { return x * 28; }
+inline int f5285_29(int x) { return x * 29; }
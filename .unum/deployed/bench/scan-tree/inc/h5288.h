@@ -0,0 +1,42 @@
+#pragma once
+/* header 5288 */
+#include <vector>
+#include "h4977.h"
+#include "h6648.h"
+#include "h1493.h"
+#include "h5258.h"
+#include "h9619.h"
+#ifdef X
+#include "h3604.h"
+#endif
+struct S5288 { int a; const char *s = "x//y"; };
+inline int f5288_0(int x) { return x * 0; }
+inline int f5288_1(int x) { return x * 1; }
+inline int f5288_2(int x) { return x * 2; }
+inline int f5288_3(int x) { return x * 3; }
+inline int f5288_4(int x) { return x * 4; }
+inline int f5288_5(int x) { return x * 5; }
+inline int f5288_6(int x) { return x * 6; }
+inline int f5288_7(int x) { return x * 7; }
+inline int f5288_8(int x) { return x * 8; }
+inline int f5288_9(int x) { return x * 9; }
+inline int f5288_10(int x) { return x * 10; }
+inline int f5288_11(int x) { return x * 11; }
+inline int f5288_12(int x) { return x * 12; }
+inline int f5288_13(int x) { return x * 13; }
+inline int f5288_14(int x) { return x * 14; }
+inline int f5288_15(int x) { return x * 15; }
+inline int f5288_16(int x) { return x * 16; }
+inline int f5288_17(int x) { return x * 17; }
+inline int f5288_18(int x) { return x * 18; }
+inline int f5288_19(int x) { return x * 19; }
+inline int f5288_20(int x) { return x * 20; }
+inline int f5288_21(int x) { return x * 21; }
+inline int f5288_22(int x) { return x * 22; }
+inline int f5288_23(int x) { return x * 23; }
+inline int f5288_24(int x) { return x * 24; }
+inline int f5288_25(int x) { return x * 25; }
+inline int f5288_26(int x) { return x * 26; }
+inline int f5288_27(int x) { return x * 27; }
+inline int f5288_28(int x) { return x * 28; }
+inline int f5288_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5289 */
+#include <vector>
+#include "h6700.h"
+#include "h583.h"
+#include "h3582.h"
+#include "h5014.h"
+#include "h2503.h"
+#ifdef X
+#include "h1182.h"
+#endif
+struct S5289 { int a; const char *s = "x//y"; };
+inline int f5289_0(int x) { return x * 0; }
+inline int f5289_1(int x) { return x * 1; }
+inline int f5289_2(int x) { return x * 2; }
+inline int f5289_3(int x) { return x * 3; }
+inline int f5289_4(int x) { return x * 4; }
+inline int f5289_5(int x) { return x * 5; }
+inline int f5289_6(int x) { return x * 6; }
+inline int f5289_7(int x) { return x * 7; }
+inline int f5289_8(int x) { return x * 8; }
+inline int f5289_9(int x) { return x * 9; }
+inline int f5289_10(int x) { return x * 10; }
+inline int f5289_11(int x) { return x * 11; }
+inline int f5289_12(int x) { return x * 12; }
+inline int f5289_13(int x) { return x * 13; }
+inline int f5289_14(int x) { return x * 14; }
+inline int f5289_15(int x) { return x * 15; }
+inline int f5289_16(int x) { return x * 16; }
+inline int f5289_17(int x) { return x * 17; }
+inline int f5289_18(int x) { return x * 18; }
+inline int f5289_19(int x) { return x * 19; }
+inline int f5289_20(int x) { return x * 20; }
+inline int f5289_21(int x) { return x * 21; }
+inline int f5289_22(int x) { return x * 22; }
+inline int f5289_23(int x) { return x * 23; }
+inline int f5289_24(int x) { return x * 24; }
+inline int f5289_25(int x) { return x * 25; }
+inline int f5289_26(int x) { return x * 26; }
+inline int f5289_27(int x) { return x * 27; }
+inline int f5289_28(int x) { return x * 28; }
+inline int f5289_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5290 */
+#include <vector>
+#include "h4973.h"
+#include "h6830.h"
+#include "h9816.h"
+#include "h4667.h"
+#include "h9144.h"
+#ifdef X
+#include "h5833.h"
+#endif
+struct S5290 { int a; const char *s = "x//y"; };
+inline int f5290_0(int x) { return x * 0; }
+inline int f5290_1(int x) { return x * 1; }
+inline int f5290_2(int x) { return x * 2; }
+inline int f5290_3(int x) { return x * 3; }
+inline int f5290_4(int x) { return x * 4; }
+inline int f5290_5(int x) { return x * 5; }
+inline int f5290_6(int x) { return x * 6; }
+inline int f5290_7(int x) { return x * 7; }
+inline int f5290_8(int x) { return x * 8; }
+inline int f5290_9(int x) { return x * 9; }
+inline int f5290_10(int x) { return x * 10; }
+inline int f5290_11(int x) { return x * 11; }
+inline int f5290_12(int x) { return x * 12; }
+inline int f5290_13(int x) { return x * 13; }
+inline int f5290_14(int x) { return x * 14; }
+inline int f5290_15(int x) { return x * 15; }
+inline int f5290_16(int x) { return x * 16; }
+inline int f5290_17(int x) { return x * 17; }
+inline int f5290_18(int x) { return x * 18; }
+inline int f5290_19(int x) { return x * 19; }
+inline int f5290_20(int x) { return x * 20; }
+inline int f5290_21(int x) { return x * 21; }
+inline int f5290_22(int x) { return x * 22; }
+inline int f5290_23(int x) { return x * 23; }
+inline int f5290_24(int x) { return x * 24; }
+inline int f5290_25(int x) { return x * 25; }
+inline int f5290_26(int x) { return x * 26; }
+inline int f5290_27(int x) { return x * 27; }
+inline int f5290_28(int x) { return x * 28; }
+inline int f5290_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5292 */
+#include <vector>
+#include "h2890.h"
+#include "h4801.h"
+#include "h1368.h"
+#include "h3684.h"
+#include "h1693.h"
+#ifdef X
+#include "h7656.h"
+#endif
+struct S5292 { int a; const char *s = "x//y"; };
+inline int f5292_0(int x) { return x * 0; }
+inline int f5292_1(int x) { return x * 1; }
+inline int f5292_2(int x) { return x * 2; }
+inline int f5292_3(int x) { return x * 3; }
+inline int f5292_4(int x) { return x * 4; }
+inline int f5292_5(int x) { return x * 5; }
+inline int f5292_6(int x) { return x * 6; }
+inline int f5292_7(int x) { return x * 7; }
+inline int f5292_8(int x) { return x * 8; }
+inline int f5292_9(int x) { return x * 9; }
+inline int f5292_10(int x) { return x * 10; }
+inline int f5292_11(int x) { return x * 11; }
+inline int f5292_12(int x) { return x * 12; }
+inline int f5292_13(int x) { return x * 13; }
+inline int f5292_14(int x) { return x * 14; }
+inline int f5292_15(int x) { return x * 15; }
+inline int f5292_16(int x) { return x * 16; }
+inline int f5292_17(int x) { return x * 17; }
+inline int f5292_18(int x) { return x * 18; }
+inline int f5292_19(int x) { return x * 19; }
+inline int f5292_20(int x) { return x * 20; }
+inline int f5292_21(int x) { return x * 21; }
+inline int f5292_22(int x) { return x * 22; }
+inline int f5292_23(int x) { return x * 23; }
+inline int f5292_24(int x) { return x * 24; }
+inline int f5292_25(int x) { return x * 25; }
+inline int f5292_26(int x) { return x * 26; }
+inline int f5292_27(int x) { return x * 27; }
+inline int f5292_28(int x) { return x * 28; }
+inline int f5292_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5293 */
+#include <vector>
+#include "h7197.h"
+#include "h5941.h"
+#include "h775.h"
+#include "h1880.h"
+#include "h6533.h"
+#ifdef X
+#include "h9520.h"
+#endif
+struct S5293 { int a; const char *s = "x//y"; };
+inline int f5293_0(int x) { return x * 0; }
+inline int f5293_1(int x) { return x * 1; }
+inline int f5293_2(int x) { return x * 2; }
+inline int f5293_3(int x) { return x * 3; }
+inline int f5293_4(int x) { return x * 4; }
+inline int f5293_5(int x) { return x * 5; }
+inline int f5293_6(int x) { return x * 6; }
+inline int f5293_7(int x) { return x * 7; }
+inline int f5293_8(int x) { return x * 8; }
+inline int f5293_9(int x) { return x * 9; }
+inline int f5293_10(int x) { return x * 10; }
+inline int f5293_11(int x) { return x * 11; }
+inline int f5293_12(int x) { return x * 12; }
+inline int f5293_13(int x) { return x * 13; }
+inline int f5293_14(int x) { return x * 14; }
+inline int f5293_15(int x) { return x * 15; }
+inline int f5293_16(int x) { return x * 16; }
+inline int f5293_17(int x) { return x * 17; }
+inline int f5293_18(int x) { return x * 18; }
+inline int f5293_19(int x) { return x * 19; }
+inline int f5293_20(int x) { return x * 20; }
+inline int f5293_21(int x) { return x * 21; }
+inline int f5293_22(int x) { return x * 22; }
+inline int f5293_23(int x) { return x * 23; }
+inline int f5293_24(int x) { return x * 24; }
+inline int f5293_25(int x) { return x * 25; }
+inline int f5293_26(int x) { return x * 26; }
+inline int f5293_27(int x) { return x * 27; }
+inline int f5293_28(int x) { return x * 28; }
+inline int f5293_29(int x) { return x * 29; }
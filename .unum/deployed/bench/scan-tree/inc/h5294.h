@@ -0,0 +1,42 @@
+#pragma once
+/* header 5294 */
+#include <vector>
+#include "h6814.h"
+#include "h4460.h"
+#include "h5919.h"
+#include "h9488.h"
+#include "h9525.h"
+#ifdef X
+#include "h6265.h"
+#endif
+struct S5294 { int a; const char *s = "x//y"; };
+inline int f5294_0(int x) { return x * 0; }
+inline int f5294_1(int x) { return x * 1; }
+inline int f5294_2(int x) { return x * 2; }
+inline int f5294_3(int x) { return x * 3; }
+inline int f5294_4(int x) { return x * 4; }
+inline int f5294_5(int x) { return x * 5; }
+inline int f5294_6(int x) { return x * 6; }
+inline int f5294_7(int x) { return x * 7; }
+inline int f5294_8(int x) { return x * 8; }
+inline int f5294_9(int x) { return x * 9; }
+inline int f5294_10(int x) { return x * 10; }
+inline int f5294_11(int x) { return x * 11; }
+inline int f5294_12(int x) { return x * 12; }
+inline int f5294_13(int x) { return x * 13; }
+inline int f5294_14(int x) { return x * 14; }
+inline int f5294_15(int x) { return x * 15; }
+inline int f5294_16(int x) { return x * 16; }
+inline int f5294_17(int x) { return x * 17; }
+inline int f5294_18(int x) { return x * 18; }
+inline int f5294_19(int x) { return x * 19; }
+inline int f5294_20(int x) { return x * 20; }
+inline int f5294_21(int x) { return x * 21; }
+inline int f5294_22(int x) { return x * 22; }
+inline int f5294_23(int x) { return x * 23; }
+inline int f5294_24(int x) { return x * 24; }
+inline int f5294_25(int x) { return x * 25; }
+inline int f5294_26(int x) { return x * 26; }
+inline int f5294_27(int x) { return x * 27; }
+inline int f5294_28(int x) { return x * 28; }
+inline int f5294_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5299 */
+#include <vector>
+#include "h2603.h"
+#include "h1380.h"
+#include "h7453.h"
+#include "h7724.h"
+#include "h5491.h"
+#ifdef X
+#include "h431.h"
+#endif
+struct S5299 { int a; const char *s = "x//y"; };
+inline int f5299_0(int x) { return x * 0; }
+inline int f5299_1(int x) { return x * 1; }
+inline int f5299_2(int x) { return x * 2; }
+inline int f5299_3(int x) { return x * 3; }
+inline int f5299_4(int x) { return x * 4; }
+inline int f5299_5(int x) { return x * 5; }
+inline int f5299_6(int x) { return x * 6; }
+inline int f5299_7(int x) { return x * 7; }
+inline int f5299_8(int x) { return x * 8; }
+inline int f5299_9(int x) { return x * 9; }
+inline int f5299_10(int x) { return x * 10; }
+inline int f5299_11(int x) { return x * 11; }
+inline int f5299_12(int x) { return x * 12; }
+inline int f5299_13(int x) { return x * 13; }
+inline int f5299_14(int x) { return x * 14; }
+inline int f5299_15(int x) { return x * 15; }
+inline int f5299_16(int x) { return x * 16; }
+inline int f5299_17(int x) { return x * 17; }
+inline int f5299_18(int x) { return x * 18; }
+inline int f5299_19(int x) { return x * 19; }
+inline int f5299_20(int x) { return x * 20; }
+inline int f5299_21(int x) { return x * 21; }
+inline int f5299_22(int x) { return x * 22; }
+inline int f5299_23(int x) { return x * 23; }
+inline int f5299_24(int x) { return x * 24; }
+inline int f5299_25(int x) { return x * 25; }
+inline int f5299_26(int x) { return x * 26; }
+inline int f5299_27(int x) { return x * 27; }
+inline int f5299_28(int x) { return x * 28; }
+inline int f5299_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 53 */
+#include <vector>
+#include "h6318.h"
+#include "h5754.h"
+#include "h1665.h"
+#include "h9618.h"
+#include "h6607.h"
+#ifdef X
+#include "h1409.h"
+#endif
+struct S53 { int a; const char *s = "x//y"; };
+inline int f53_0(int x) { return x * 0; }
+inline int f53_1(int x) { return x * 1; }
+inline int f53_2(int x) { return x * 2; }
+inline int f53_3(int x) { return x * 3; }
+inline int f53_4(int x) { return x * 4; }
+inline int f53_5(int x) { return x * 5; }
+inline int f53_6(int x) { return x * 6; }
+inline int f53_7(int x) { return x * 7; }
+inline int f53_8(int x) { return x * 8; }
+inline int f53_9(int x) { return x * 9; }
+inline int f53_10(int x) { return x * 10; }
+inline int f53_11(int x) { return x * 11; }
+inline int f53_12(int x) { return x * 12; }
+inline int f53_13(int x) { return x * 13; }
+inline int f53_14(int x) { return x * 14; }
+inline int f53_15(int x) { return x * 15; }
+inline int f53_16(int x) { return x * 16; }
+inline int f53_17(int x) { return x * 17; }
+inline int f53_18(int x) { return x * 18; }
+inline int f53_19(int x) { return x * 19; }
+inline int f53_20(int x) { return x * 20; }
+inline int f53_21(int x) { return x * 21; }
+inline int f53_22(int x) { return x * 22; }
+inline int f53_23(int x) { return x * 23; }
+inline int f53_24(int x) { return x * 24; }
+inline int f53_25(int x) { return x * 25; }
+inline int f53_26(int x) { return x * 26; }
+inline int f53_27(int x) { return x * 27; }
+inline int f53_28(int x) { return x * 28; }
+inline int f53_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5300 */
+#include <vector>
+#include "h5089.h"
+#include "h5107.h"
+#include "h5111.h"
+#include "h7188.h"
+#include "h965.h"
+#ifdef X
+#include "h8705.h"
+#endif
+struct S5300 { int a; const char *s = "x//y"; };
+inline int f5300_0(int x) { return x * 0; }
+inline int f5300_1(int x) { return x * 1; }
+inline int f5300_2(int x) { return x * 2; }
+inline int f5300_3(int x) { return x * 3; }
+inline int f5300_4(int x) { return x * 4; }
+inline int f5300_5(int x) { return x * 5; }
+inline int f5300_6(int x) { return x * 6; }
+inline int f5300_7(int x) { return x * 7; }
+inline int f5300_8(int x) { return x * 8; }
+inline int f5300_9(int x) { return x * 9; }
+inline int f5300_10(int x) { return x * 10; }
+inline int f5300_11(int x) { return x * 11; }
+inline int f5300_12(int x) { return x * 12; }
+inline int f5300_13(int x) { return x * 13; }
+inline int f5300_14(int x) { return x * 14; }
+inline int f5300_15(int x) { return x * 15; }
+inline int f5300_16(int x) { return x * 16; }
+inline int f5300_17(int x) { return x * 17; }
+inline int f5300_18(int x) { return x * 18; }
+inline int f5300_19(int x) { return x * 19; }
+inline int f5300_20(int x) { return x * 20; }
+inline int f5300_21(int x) { return x * 21; }
+inline int f5300_22(int x) { return x * 22; }
+inline int f5300_23(int x) { return x * 23; }
+inline int f5300_24(int x) { return x * 24; }
+inline int f5300_25(int x) { return x * 25; }
+inline int f5300_26(int x) { return x * 26; }
+inline int f5300_27(int x) { return x * 27; }
+inline int f5300_28(int x) { return x * 28; }
+inline int f5300_29(int x) { return x * 29; }
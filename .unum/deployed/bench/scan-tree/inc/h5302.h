@@ -0,0 +1,42 @@
+#pragma once
+/* header 5302 */
+#include <vector>
+#include "h8742.h"
+#include "h6580.h"
+#include "h4004.h"
+#include "h7189.h"
+#include "h1549.h"
+#ifdef X
+#include "h5430.h"
+#endif
+struct S5302 { int a; const char *s = "x//y"; };
+inline int f5302_0(int x) { return x * 0; }
+inline int f5302_1(int x) { return x * 1; }
+inline int f5302_2(int x) { return x * 2; }
+inline int f5302_3(int x) { return x * 3; }
+inline int f5302_4(int x) { return x * 4; }
+inline int f5302_5(int x) { return x * 5; }
+inline int f5302_6(int x) { return x * 6; }
+inline int f5302_7(int x) { return x * 7; }
+inline int f5302_8(int x) { return x * 8; }
+inline int f5302_9(int x) { return x * 9; }
+inline int f5302_10(int x) { return x * 10; }
+inline int f5302_11(int x) { return x * 11; }
+inline int f5302_12(int x) { return x * 12; }
+inline int f5302_13(int x) { return x * 13; }
+inline int f5302_14(int x) { return x * 14; }
+inline int f5302_15(int x) { return x * 15; }
+inline int f5302_16(int x) { return x * 16; }
+inline int f5302_17(int x) { return x * 17; }
+inline int f5302_18(int x) { return x * 18; }
+inline int f5302_19(int x) { return x * 19; }
+inline int f5302_20(int x) { return x * 20; }
+inline int f5302_21(int x) { return x * 21; }
+inline int f5302_22(int x) { return x * 22; }
+inline int f5302_23(int x) { return x * 23; }
+inline int f5302_24(int x) { return x * 24; }
+inline int f5302_25(int x) { return x * 25; }
+inline int f5302_26(int x) { return x * 26; }
+inline int f5302_27(int x) { return x * 27; }
+inline int f5302_28(int x) { return x * 28; }
+inline int f5302_29(int x) { return x * 29; }
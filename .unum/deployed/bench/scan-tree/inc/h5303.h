@@ -0,0 +1,42 @@
+#pragma once
+/* header 5303 */
+#include <vector>
+#include "h6029.h"
+#include "h5899.h"
+#include "h4869.h"
+#include "h2696.h"
+#include "h909.h"
+#ifdef X
+#include "h671.h"
+#endif
+struct S5303 { int a; const char *s = "x//y"; };
+inline int f5303_0(int x) { return x * 0; }
+inline int f5303_1(int x) { return x * 1; }
+inline int f5303_2(int x) { return x * 2; }
+inline int f5303_3(int x) { return x * 3; }
+inline int f5303_4(int x) { return x * 4; }
+inline int f5303_5(int x) { return x * 5; }
+inline int f5303_6(int x) { return x * 6; }
+inline int f5303_7(int x) { return x * 7; }
+inline int f5303_8(int x) { return x * 8; }
+inline int f5303_9(int x) { return x * 9; }
+inline int f5303_10(int x) { return x * 10; }
+inline int f5303_11(int x) { return x * 11; }
+inline int f5303_12(int x) { return x * 12; }
+inline int f5303_13(int x) { return x * 13; }
+inline int f5303_14(int x) { return x * 14; }
+inline int f5303_15(int x) { return x * 15; }
+inline int f5303_16(int x) { return x * 16; }
+inline int f5303_17(int x) { return x * 17; }
+inline int f5303_18(int x) { return x * 18; }
+inline int f5303_19(int x) { return x * 19; }
+inline int f5303_20(int x) { return x * 20; }
+inline int f5303_21(int x) { return x * 21; }
+inline int f5303_22(int x) { return x * 22; }
+inline int f5303_23(int x) { return x * 23; }
+inline int f5303_24(int x) { return x * 24; }
+inline int f5303_25(int x) { return x * 25; }
+inline int f5303_26(int x) { return x * 26; }
+inline int f5303_27(int x) { return x * 27; }
+inline int f5303_28(int x) { return x * 28; }
+inline int f5303_29(int x) { return x * 29; }
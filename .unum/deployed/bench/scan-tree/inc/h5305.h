@@ -0,0 +1,42 @@
+#pragma once
+/* header 5305 */
+#include <vector>
+#include "h5678.h"
+#include "h4893.h"
+#include "h4614.h"
+#include "h4876.h"
+#include "h5187.h"
+#ifdef X
+#include "h4311.h"
+#endif
+struct S5305 { int a; const char *s = "x//y"; };
+inline int f5305_0(int x) { return x * 0; }
+inline int f5305_1(int x) { return x * 1; }
+inline int f5305_2(int x) { return x * 2; }
+inline int f5305_3(int x) { return x * 3; }
+inline int f5305_4(int x) { return x * 4; }
+inline int f5305_5(int x) { return x * 5; }
+inline int f5305_6(int x) { return x * 6; }
+inline int f5305_7(int x) { return x * 7; }
+inline int f5305_8(int x) { return x * 8; }
+inline int f5305_9(int x) { return x * 9; }
+inline int f5305_10(int x) { return x * 10; }
+inline int f5305_11(int x) { return x * 11; }
+inline int f5305_12(int x) { return x * 12; }
+inline int f5305_13(int x) { return x * 13; }
+inline int f5305_14(int x) { return x * 14; }
+inline int f5305_15(int x) { return x * 15; }
+inline int f5305_16(int x) { return x * 16; }
+inline int f5305_17(int x) { return x * 17; }
+inline int f5305_18(int x) { return x * 18; }
+inline int f5305_19(int x) { return x * 19; }
+inline int f5305_20(int x) { return x * 20; }
+inline int f5305_21(int x) { return x * 21; }
+inline int f5305_22(int x) { return x * 22; }
+inline int f5305_23(int x) { return x * 23; }
+inline int f5305_24(int x) { return x * 24; }
+inline int f5305_25(int x) { return x * 25; }
+inline int f5305_26(int x) { return x * 26; }
+inline int f5305_27(int x) { return x * 27; }
+inline int f5305_28(int x) { return x * 28; }
+inline int f5305_29(int x) { return x * 29; }
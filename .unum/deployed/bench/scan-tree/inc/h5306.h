@@ -0,0 +1,42 @@
+#pragma once
+/* header 5306 */
+#include <vector>
+#include "h698.h"
+#include "h2885.h"
+#include "h8332.h"
+#include "h9070.h"
+#include "h4836.h"
+#ifdef X
+#include "h8374.h"
+#endif
+struct S5306 { int a; const char *s = "x//y"; };
+inline int f5306_0(int x) { return x * 0; }
+inline int f5306_1(int x) { return x * 1; }
+inline int f5306_2(int x) { return x * 2; }
+inline int f5306_3(int x) { return x * 3; }
+inline int f5306_4(int x) { return x * 4; }
+inline int f5306_5(int x) { return x * 5; }
+inline int f5306_6(int x) { return x * 6; }
+inline int f5306_7(int x) { return x * 7; }
+inline int f5306_8(int x) { return x * 8; }
+inline int f5306_9(int x) { return x * 9; }
+inline int f5306_10(int x) { return x * 10; }
+inline int f5306_11(int x) { return x * 11; }
+inline int f5306_12(int x) { return x * 12; }
+inline int f5306_13(int x) { return x * 13; }
+inline int f5306_14(int x) { return x * 14; }
+inline int f5306_15(int x) { return x * 15; }
+inline int f5306_16(int x) { return x * 16; }
+inline int f5306_17(int x) { return x * 17; }
+inline int f5306_18(int x) { return x * 18; }
+inline int f5306_19(int x) { return x * 19; }
+inline int f5306_20(int x) { return x * 20; }
+inline int f5306_21(int x) { return x * 21; }
+inline int f5306_22(int x) { return x * 22; }
+inline int f5306_23(int x) { return x * 23; }
+inline int f5306_24(int x) { return x * 24; }
+inline int f5306_25(int x) { return x * 25; }
+inline int f5306_26(int x) { return x * 26; }
+inline int f5306_27(int x) { return x * 27; }
+inline int f5306_28(int x) { return x * 28; }
+inline int f5306_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5308 */
+#include <vector>
+#include "h9735.h"
+#include "h840.h"
+#include "h7610.h"
+#include "h9759.h"
+#include "h724.h"
+#ifdef X
+#include "h4938.h"
+#endif
+struct S5308 { int a; const char *s = "x//y"; };
+inline int f5308_0(int x) { return x * 0; }
+inline int f5308_1(int x) { return x * 1; }
+inline int f5308_2(int x) { return x * 2; }
+inline int f5308_3(int x) { return x * 3; }
+inline int f5308_4(int x) { return x * 4; }
+inline int f5308_5(int x) { return x * 5; }
+inline int f5308_6(int x) { return x * 6; }
+inline int f5308_7(int x) { return x * 7; }
+inline int f5308_8(int x) { return x * 8; }
+inline int f5308_9(int x) { return x * 9; }
+inline int f5308_10(int x) { return x * 10; }
+inline int f5308_11(int x) { return x * 11; }
+inline int f5308_12(int x) { return x * 12; }
+inline int f5308_13(int x) { return x * 13; }
+inline int f5308_14(int x) { return x * 14; }
+inline int f5308_15(int x) { return x * 15; }
+inline int f5308_16(int x) { return x * 16; }
+inline int f5308_17(int x) { return x * 17; }
+inline int f5308_18(int x) { return x * 18; }
+inline int f5308_19(int x) { return x * 19; }
+inline int f5308_20(int x) { return x * 20; }
+inline int f5308_21(int x) { return x * 21; }
+inline int f5308_22(int x) { return x * 22; }
+inline int f5308_23(int x) { return x * 23; }
+inline int f5308_24(int x) { return x * 24; }
+inline int f5308_25(int x) { return x * 25; }
+inline int f5308_26(int x) { return x * 26; }
+inline int f5308_27(int x) { return x * 27; }
+inline int f5308_28(int x) { return x * 28; }
+inline int f5308_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5310 */
+#include <vector>
+#include "h9828.h"
+#include "h5597.h"
+#include "h3386.h"
+#include "h2241.h"
+#include "h3476.h"
+#ifdef X
+#include "h6822.h"
+#endif
+struct S5310 { int a; const char *s = "x//y"; };
+inline int f5310_0(int x) { return x * 0; }
+inline int f5310_1(int x) { return x * 1; }
+inline int f5310_2(int x) { return x * 2; }
+inline int f5310_3(int x) { return x * 3; }
+inline int f5310_4(int x) { return x * 4; }
+inline int f5310_5(int x) { return x * 5; }
+inline int f5310_6(int x) { return x * 6; }
+inline int f5310_7(int x) { return x * 7; }
+inline int f5310_8(int x) { return x * 8; }
+inline int f5310_9(int x) { return x * 9; }
+inline int f5310_10(int x) { return x * 10; }
+inline int f5310_11(int x) { return x * 11; }
+inline int f5310_12(int x) { return x * 12; }
+inline int f5310_13(int x) { return x * 13; }
+inline int f5310_14(int x) { return x * 14; }
+inline int f5310_15(int x) { return x * 15; }
+inline int f5310_16(int x) { return x * 16; }
+inline int f5310_17(int x) { return x * 17; }
+inline int f5310_18(int x) { return x * 18; }
+inline int f5310_19(int x) { return x * 19; }
+inline int f5310_20(int x) { return x * 20; }
+inline int f5310_21(int x) { return x * 21; }
+inline int f5310_22(int x) { return x * 22; }
+inline int f5310_23(int x) { return x * 23; }
+inline int f5310_24(int x) { return x * 24; }
+inline int f5310_25(int x) { return x * 25; }
+inline int f5310_26(int x) { return x * 26; }
+inline int f5310_27(int x) { return x * 27; }
+inline int f5310_28(int x) { return x * 28; }
+inline int f5310_29(int x) { return x * 29; }
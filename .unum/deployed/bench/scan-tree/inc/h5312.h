@@ -0,0 +1,42 @@
+#pragma once
+/* header 5312 */
+#include <vector>
+#include "h2806.h"
+#include "h6310.h"
+#include "h8245.h"
+#include "h1262.h"
+#include "h204.h"
+#ifdef X
+#include "h7360.h"
+#endif
+struct S5312 { int a; const char *s = "x//y"; };
+inline int f5312_0(int x) { return x * 0; }
+inline int f5312_1(int x) { return x * 1; }
+inline int f5312_2(int x) { return x * 2; }
+inline int f5312_3(int x) { return x * 3; }
+inline int f5312_4(int x) { return x * 4; }
+inline int f5312_5(int x) { return x * 5; }
+inline int f5312_6(int x) { return x * 6; }
+inline int f5312_7(int x) { return x * 7; }
+inline int f5312_8(int x) { return x * 8; }
+inline int f5312_9(int x) { return x * 9; }
+inline int f5312_10(int x) { return x * 10; }
+inline int f5312_11(int x) { return x * 11; }
+inline int f5312_12(int x) { return x * 12; }
+inline int f5312_13(int x) { return x * 13; }
+inline int f5312_14(int x) { return x * 14; }
+inline int f5312_15(int x) { return x * 15; }
+inline int f5312_16(int x) { return x * 16; }
+inline int f5312_17(int x) { return x * 17; }
+inline int f5312_18(int x) { return x * 18; }
+inline int f5312_19(int x) { return x * 19; }
+inline int f5312_20(int x) { return x * 20; }
+inline int f5312_21(int x) { return x * 21; }
+inline int f5312_22(int x) { return x * 22; }
+inline int f5312_23(int x) { return x * 23; }
+inline int f5312_24(int x) { return x * 24; }
+inline int f5312_25(int x) { return x * 25; }
+inline int f5312_26(int x) { return x * 26; }
+inline int f5312_27(int x) { return x * 27; }
+inline int f5312_28(int x) { return x * 28; }
+inline int f5312_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5313 */
+#include <vector>
+#include "h7431.h"
+#include "h1646.h"
+#include "h2230.h"
+#include "h1786.h"
+#include "h5202.h"
+#ifdef X
+#include "h4536.h"
+#endif
+struct S5313 { int a; const char *s = "x//y"; };
+inline int f5313_0(int x) { return x * 0; }
+inline int f5313_1(int x) { return x * 1; }
+inline int f5313_2(int x) { return x * 2; }
+inline int f5313_3(int x) { return x * 3; }
+inline int f5313_4(int x) { return x * 4; }
+inline int f5313_5(int x) { return x * 5; }
+inline int f5313_6(int x) { return x * 6; }
+inline int f5313_7(int x) { return x * 7; }
+inline int f5313_8(int x) { return x * 8; }
+inline int f5313_9(int x) { return x * 9; }
+inline int f5313_10(int x) { return x * 10; }
+inline int f5313_11(int x) { return x * 11; }
+inline int f5313_12(int x) { return x * 12; }
+inline int f5313_13(int x) { return x * 13; }
+inline int f5313_14(int x) { return x * 14; }
+inline int f5313_15(int x) { return x * 15; }
+inline int f5313_16(int x) { return x * 16; }
+inline int f5313_17(int x) { return x * 17; }
+inline int f5313_18(int x) { return x * 18; }
+inline int f5313_19(int x) { return x * 19; }
+inline int f5313_20(int x) { return x * 20; }
+inline int f5313_21(int x) { return x * 21; }
+inline int f5313_22(int x) { return x * 22; }
+inline int f5313_23(int x) { return x * 23; }
+inline int f5313_24(int x) { return x * 24; }
+inline int f5313_25(int x) { return x * 25; }
+inline int f5313_26(int x) { return x * 26; }
+inline int f5313_27(int x) { return x * 27; }
+inline int f5313_28(int x) { return x * 28; }
+inline int f5313_29(int x) { return x * 29; }
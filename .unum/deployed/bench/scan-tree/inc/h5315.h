@@ -0,0 +1,42 @@
+#pragma once
+/* header 5315 */
+#include <vector>
+#include "h7443.h"
+#include "h9419.h"
+#include "h8859.h"
+#include "h4082.h"
+#include "h2339.h"
+#ifdef X
+#include "h6818.h"
+#endif
+struct S5315 { int a; const char *s = "x//y"; };
+inline int f5315_0(int x) { return x * 0; }
+inline int f5315_1(int x) { return x * 1; }
+inline int f5315_2(int x) { return x * 2; }
+inline int f5315_3(int x) { return x * 3; }
+inline int f5315_4(int x) { return x * 4; }
+inline int f5315_5(int x) { return x * 5; }
+inline int f5315_6(int x) { return x * 6; }
+inline int f5315_7(int x) { return x * 7; }
+inline int f5315_8(int x) { return x * 8; }
+inline int f5315_9(int x) { return x * 9; }
+inline int f5315_10(int x) { return x * 10; }
+inline int f5315_11(int x) { return x * 11; }
+inline int f5315_12(int x) { return x * 12; }
+inline int f5315_13(int x) { return x * 13; }
+inline int f5315_14(int x) { return x * 14; }
+inline int f5315_15(int x) { return x * 15; }
+inline int f5315_16(int x) { return x * 16; }
+inline int f5315_17(int x) { return x * 17; }
+inline int f5315_18(int x) { return x * 18; }
+inline int f5315_19(int x) { return x * 19; }
+inline int f5315_20(int x) { return x * 20; }
+inline int f5315_21(int x) { return x * 21; }
+inline int f5315_22(int x) { return x * 22; }
+inline int f5315_23(int x) { return x * 23; }
+inline int f5315_24(int x) { return x * 24; }
+inline int f5315_25(int x) { return x * 25; }
+inline int f5315_26(int x) { return x * 26; }
+inline int f5315_27(int x) { return x * 27; }
+inline int f5315_28(int x) { return x * 28; }
+inline int f5315_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5317 */
+#include <vector>
+#include "h2260.h"
+#include "h9062.h"
+#include "h640.h"
+#include "h9661.h"
+#include "h9578.h"
+#ifdef X
+#include "h5623.h"
+#endif
+struct S5317 { int a; const char *s = "x//y"; };
+inline int f5317_0(int x) { return x * 0; }
+inline int f5317_1(int x) { return x * 1; }
+inline int f5317_2(int x) { return x * 2; }
+inline int f5317_3(int x) { return x * 3; }
+inline int f5317_4(int x) { return x * 4; }
+inline int f5317_5(int x) { return x * 5; }
+inline int f5317_6(int x) { return x * 6; }
+inline int f5317_7(int x) { return x * 7; }
+inline int f5317_8(int x) { return x * 8; }
+inline int f5317_9(int x) { return x * 9; }
+inline int f5317_10(int x) { return x * 10; }
+inline int f5317_11(int x) { return x * 11; }
+inline int f5317_12(int x) { return x * 12; }
+inline int f5317_13(int x) { return x * 13; }
+inline int f5317_14(int x) { return x * 14; }
+inline int f5317_15(int x) { return x * 15; }
+inline int f5317_16(int x) { return x * 16; }
+inline int f5317_17(int x) { return x * 17; }
+inline int f5317_18(int x) { return x * 18; }
+inline int f5317_19(int x) { return x * 19; }
+inline int f5317_20(int x) { return x * 20; }
+inline int f5317_21(int x) { return x * 21; }
+inline int f5317_22(int x) { return x * 22; }
+inline int f5317_23(int x) { return x * 23; }
+inline int f5317_24(int x) { return x * 24; }
+inline int f5317_25(int x) { return x * 25; }
+inline int f5317_26(int x) { return x * 26; }
+inline int f5317_27(int x) { return x * 27; }
+inline int f5317_28(int x) { return x * 28; }
+inline int f5317_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5318 */
+#include <vector>
+#include "h7154.h"
+#include "h3534.h"
+#include "h8063.h"
+#include "h8508.h"
+#include "h6072.h"
+#ifdef X
+#include "h5175.h"
+#endif
+struct S5318 { int a; const char *s = "x//y"; };
+inline int f5318_0(int x) { return x * 0; }
+inline int f5318_1(int x) { return x * 1; }
+inline int f5318_2(int x) { return x * 2; }
+inline int f5318_3(int x) { return x * 3; }
+inline int f5318_4(int x) { return x * 4; }
+inline int f5318_5(int x) { return x * 5; }
+inline int f5318_6(int x) { return x * 6; }
+inline int f5318_7(int x) { return x * 7; }
+inline int f5318_8(int x) { return x * 8; }
+inline int f5318_9(int x) { return x * 9; }
+inline int f5318_10(int x) { return x * 10; }
+inline int f5318_11(int x) { return x * 11; }
+inline int f5318_12(int x) { return x * 12; }
+inline int f5318_13(int x) { return x * 13; }
+inline int f5318_14(int x) { return x * 14; }
+inline int f5318_15(int x) { return x * 15; }
+inline int f5318_16(int x) { return x * 16; }
+inline int f5318_17(int x) { return x * 17; }
+inline int f5318_18(int x) { return x * 18; }
+inline int f5318_19(int x) { return x * 19; }
+inline int f5318_20(int x) { return x * 20; }
+inline int f5318_21(int x) { return x * 21; }
+inline int f5318_22(int x) { return x * 22; }
+inline int f5318_23(int x) { return x * 23; }
+inline int f5318_24(int x) { return x * 24; }
+inline int f5318_25(int x) { return x * 25; }
+inline int f5318_26(int x) { return x * 26; }
+inline int f5318_27(int x) { return x * 27; }
+inline int f5318_28(int x) { return x * 28; }
+inline int f5318_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5319 */
+#include <vector>
+#include "h9819.h"
+#include "h2041.h"
+#include "h3746.h"
+#include "h7006.h"
+#include "h3675.h"
+#ifdef X
+#include "h4111.h"
+#endif
+struct S5319 { int a; const char *s = "x//y"; };
+inline int f5319_0(int x) { return x * 0; }
+inline int f5319_1(int x) { return x * 1; }
+inline int f5319_2(int x) { return x * 2; }
+inline int f5319_3(int x) { return x * 3; }
+inline int f5319_4(int x) { return x * 4; }
+inline int f5319_5(int x) { return x * 5; }
+inline int f5319_6(int x) { return x * 6; }
+inline int f5319_7(int x) { return x * 7; }
+inline int f5319_8(int x) { return x * 8; }
+inline int f5319_9(int x) { return x * 9; }
+inline int f5319_10(int x) { return x * 10; }
+inline int f5319_11(int x) { return x * 11; }
+inline int f5319_12(int x) { return x * 12; }
+inline int f5319_13(int x) { return x * 13; }
+inline int f5319_14(int x) { return x * 14; }
+inline int f5319_15(int x) { return x * 15; }
+inline int f5319_16(int x) { return x * 16; }
+inline int f5319_17(int x) { return x * 17; }
+inline int f5319_18(int x) { return x * 18; }
+inline int f5319_19(int x) { return x * 19; }
+inline int f5319_20(int x) { return x * 20; }
+inline int f5319_21(int x) { return x * 21; }
+inline int f5319_22(int x) { return x * 22; }
+inline int f5319_23(int x) { return x * 23; }
+inline int f5319_24(int x) { return x * 24; }
+inline int f5319_25(int x) { return x * 25; }
+inline int f5319_26(int x) { return x * 26; }
+inline int f5319_27(int x) { return x * 27; }
+inline int f5319_28(int x) { return x * 28; }
+inline int f5319_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5320 */
+#include <vector>
+#include "h5074.h"
+#include "h9589.h"
+#include "h5961.h"
+#include "h3728.h"
+#include "h9516.h"
+#ifdef X
+#include "h2405.h"
+#endif
+struct S5320 { int a; const char *s = "x//y"; };
+inline int f5320_0(int x) { return x * 0; }
+inline int f5320_1(int x) { return x * 1; }
+inline int f5320_2(int x) { return x * 2; }
+inline int f5320_3(int x) { return x * 3; }
+inline int f5320_4(int x) { return x * 4; }
+inline int f5320_5(int x) { return x * 5; }
+inline int f5320_6(int x) { return x * 6; }
+inline int f5320_7(int x) { return x * 7; }
+inline int f5320_8(int x) { return x * 8; }
+inline int f5320_9(int x) { return x * 9; }
+inline int f5320_10(int x) { return x * 10; }
+inline int f5320_11(int x) { return x * 11; }
+inline int f5320_12(int x) { return x * 12; }
+inline int f5320_13(int x) { return x * 13; }
+inline int f5320_14(int x) { return x * 14; }
+inline int f5320_15(int x) { return x * 15; }
+inline int f5320_16(int x) { return x * 16; }
+inline int f5320_17(int x) { return x * 17; }
+inline int f5320_18(int x) { return x * 18; }
+inline int f5320_19(int x) { return x * 19; }
+inline int f5320_20(int x) { return x * 20; }
+inline int f5320_21(int x) { return x * 21; }
+inline int f5320_22(int x) { return x * 22; }
+inline int f5320_23(int x) { return x * 23; }
+inline int f5320_24(int x) { return x * 24; }
+inline int f5320_25(int x) { return x * 25; }
+inline int f5320_26(int x) { return x * 26; }
+inline int f5320_27(int x) { return x * 27; }
+inline int f5320_28(int x) { return x * 28; }
+inline int f5320_29(int x) { return x * 29; }
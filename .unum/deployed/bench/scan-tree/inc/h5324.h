@@ -0,0 +1,42 @@
+#pragma once
+/* header 5324 */
+#include <vector>
+#include "h4605.h"
+#include "h7815.h"
+#include "h6935.h"
+#include "h9645.h"
+#include "h3716.h"
+#ifdef X
+#include "h1036.h"
+#endif
+struct S5324 { int a; const char *s = "x//y"; };
+inline int f5324_0(int x) { return x * 0; }
+inline int f5324_1(int x) { return x * 1; }
+inline int f5324_2(int x) { return x * 2; }
+inline int f5324_3(int x) { return x * 3; }
+inline int f5324_4(int x) { return x * 4; }
+inline int f5324_5(int x) { return x * 5; }
+inline int f5324_6(int x) { return x * 6; }
+inline int f5324_7(int x) { return x * 7; }
+inline int f5324_8(int x) { return x * 8; }
+inline int f5324_9(int x) { return x * 9; }
+inline int f5324_10(int x) { return x * 10; }
+inline int f5324_11(int x) { return x * 11; }
+inline int f5324_12(int x) { return x * 12; }
+inline int f5324_13(int x) { return x * 13; }
+inline int f5324_14(int x) { return x * 14; }
+inline int f5324_15(int x) { return x * 15; }
+inline int f5324_16(int x) { return x * 16; }
+inline int f5324_17(int x) { return x * 17; }
+inline int f5324_18(int x) { return x * 18; }
+inline int f5324_19(int x) { return x * 19; }
+inline int f5324_20(int x) { return x * 20; }
+inline int f5324_21(int x) { return x * 21; }
+inline int f5324_22(int x) { return x * 22; }
+inline int f5324_23(int x) { return x * 23; }
+inline int f5324_24(int x) { return x * 24; }
+inline int f5324_25(int x) { return x * 25; }
+inline int f5324_26(int x) { return x * 26; }
+inline int f5324_27(int x) { return x * 27; }
+inline int f5324_28(int x) { return x * 28; }
+inline int f5324_29(int x) { return x * 29; }
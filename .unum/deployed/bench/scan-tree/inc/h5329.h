@@ -0,0 +1,42 @@
+#pragma once
+/* header 5329 */
+#include <vector>
+#include "h7013.h"
+#include "h7779.h"
+#include "h3070.h"
+#include "h9903.h"
+#include "h6596.h"
+#ifdef X
+#include "h9499.h"
+#endif
+struct S5329 { int a; const char *s = "x//y"; };
+inline int f5329_0(int x) { return x * 0; }
+inline int f5329_1(int x) { return x * 1; }
+inline int f5329_2(int x) { return x * 2; }
+inline int f5329_3(int x) { return x * 3; }
+inline int f5329_4(int x) { return x * 4; }
+inline int f5329_5(int x) { return x * 5; }
+inline int f5329_6(int x) { return x * 6; }
+inline int f5329_7(int x) { return x * 7; }
+inline int f5329_8(int x) { return x * 8; }
+inline int f5329_9(int x) { return x * 9; }
+inline int f5329_10(int x) { return x * 10; }
+inline int f5329_11(int x) { return x * 11; }
+inline int f5329_12(int x) { return x * 12; }
+inline int f5329_13(int x) { return x * 13; }
+inline int f5329_14(int x) { return x * 14; }
+inline int f5329_15(int x) { return x * 15; }
+inline int f5329_16(int x) { return x * 16; }
+inline int f5329_17(int x) { return x * 17; }
+inline int f5329_18(int x) { return x * 18; }
+inline int f5329_19(int x) { return x * 19; }
+inline int f5329_20(int x) { return x * 20; }
+inline int f5329_21(int x) { return x * 21; }
+inline int f5329_22(int x) { return x * 22; }
+inline int f5329_23(int x) { return x * 23; }
+inline int f5329_24(int x) { return x * 24; }
+inline int f5329_25(int x) { return x * 25; }
+inline int f5329_26(int x) { return x * 26; }
+inline int f5329_27(int x) { return x * 27; }
+inline int f5329_28(int x) { return x * 28; }
+inline int f5329_29(int x) { return x * 29; }
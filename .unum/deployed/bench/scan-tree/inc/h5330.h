@@ -0,0 +1,42 @@
+#pragma once
+/* header 5330 */
+#include <vector>
+#include "h3321.h"
+#include "h6125.h"
+#include "h3307.h"
+#include "h267.h"
+#include "h1748.h"
+#ifdef X
+#include "h8482.h"
+#endif
+struct S5330 { int a; const char *s = "x//y"; };
+inline int f5330_0(int x) { return x * 0; }
+inline int f5330_1(int x) { return x * 1; }
+inline int f5330_2(int x) { return x * 2; }
+inline int f5330_3(int x) { return x * 3; }
+inline int f5330_4(int x) { return x * 4; }
+inline int f5330_5(int x) { return x * 5; }
+inline int f5330_6(int x) { return x * 6; }
+inline int f5330_7(int x) { return x * 7; }
+inline int f5330_8(int x) { return x * 8; }
+inline int f5330_9(int x) { return x * 9; }
+inline int f5330_10(int x) { return x * 10; }
+inline int f5330_11(int x) { return x * 11; }
+inline int f5330_12(int x) { return x * 12; }
+inline int f5330_13(int x) { return x * 13; }
+inline int f5330_14(int x) { return x * 14; }
+inline int f5330_15(int x) { return x * 15; }
+inline int f5330_16(int x) { return x * 16; }
+inline int f5330_17(int x) { return x * 17; }
+inline int f5330_18(int x) { return x * 18; }
+inline int f5330_19(int x) { return x * 19; }
+inline int f5330_20(int x) { return x * 20; }
+inline int f5330_21(int x) { return x * 21; }
+inline int f5330_22(int x) { return x * 22; }
+inline int f5330_23(int x) { return x * 23; }
+inline int f5330_24(int x) { return x * 24; }
+inline int f5330_25(int x) { return x * 25; }
+inline int f5330_26(int x) { return x * 26; }
+inline int f5330_27(int x) { return x * 27; }
+inline int f5330_28(int x) { return x * 28; }
+inline int f5330_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5331 */
+#include <vector>
+#include "h7593.h"
+#include "h8856.h"
+#include "h621.h"
+#include "h2835.h"
+#include "h6013.h"
+#ifdef X
+#include "h3085.h"
+#endif
+struct S5331 { int a; const char *s = "x//y"; };
+inline int f5331_0(int x) { return x * 0; }
+inline int f5331_1(int x) { return x * 1; }
+inline int f5331_2(int x) { return x * 2; }
+inline int f5331_3(int x) { return x * 3; }
+inline int f5331_4(int x) { return x * 4; }
+inline int f5331_5(int x) { return x * 5; }
+inline int f5331_6(int x) { return x * 6; }
+inline int f5331_7(int x) { return x * 7; }
+inline int f5331_8(int x) { return x * 8; }
+inline int f5331_9(int x) { return x * 9; }
+inline int f5331_10(int x) { return x * 10; }
+inline int f5331_11(int x) { return x * 11; }
+inline int f5331_12(int x) { return x * 12; }
+inline int f5331_13(int x) { return x * 13; }
+inline int f5331_14(int x) { return x * 14; }
+inline int f5331_15(int x) { return x * 15; }
+inline int f5331_16(int x) { return x * 16; }
+inline int f5331_17(int x) { return x * 17; }
+inline int f5331_18(int x) { return x * 18; }
+inline int f5331_19(int x) { return x * 19; }
+inline int f5331_20(int x) { return x * 20; }
+inline int f5331_21(int x) { return x * 21; }
+inline int f5331_22(int x) { return x * 22; }
+inline int f5331_23(int x) { return x * 23; }
+inline int f5331_24(int x) { return x * 24; }
+inline int f5331_25(int x) { return x * 25; }
+inline int f5331_26(int x) { return x * 26; }
+inline int f5331_27(int x) { return x * 27; }
+inline int f5331_28(int x) { return x * 28; }
+inline int f5331_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5332 */
+#include <vector>
+#include "h5420.h"
+#include "h2125.h"
+#include "h1146.h"
+#include "h1940.h"
+#include "h8357.h"
+#ifdef X
+#include "h5798.h"
+#endif
+struct S5332 { int a; const char *s = "x//y"; };
+inline int f5332_0(int x) { return x * 0; }
+inline int f5332_1(int x) { return x * 1; }
+inline int f5332_2(int x) { return x * 2; }
+inline int f5332_3(int x) { return x * 3; }
+inline int f5332_4(int x) { return x * 4; }
+inline int f5332_5(int x) { return x * 5; }
+inline int f5332_6(int x) { return x * 6; }
+inline int f5332_7(int x) { return x * 7; }
+inline int f5332_8(int x) { return x * 8; }
+inline int f5332_9(int x) { return x * 9; }
+inline int f5332_10(int x) { return x * 10; }
+inline int f5332_11(int x) { return x * 11; }
+inline int f5332_12(int x) { return x * 12; }
+inline int f5332_13(int x) { return x * 13; }
+inline int f5332_14(int x) { return x * 14; }
+inline int f5332_15(int x) { return x * 15; }
+inline int f5332_16(int x) { return x * 16; }
+inline int f5332_17(int x) { return x * 17; }
+inline int f5332_18(int x) { return x * 18; }
+inline int f5332_19(int x) { return x * 19; }
+inline int f5332_20(int x) { return x * 20; }
+inline int f5332_21(int x) { return x * 21; }
+inline int f5332_22(int x) { return x * 22; }
+inline int f5332_23(int x) { return x * 23; }
+inline int f5332_24(int x) { return x * 24; }
+inline int f5332_25(int x) { return x * 25; }
+inline int f5332_26(int x) { return x * 26; }
+inline int f5332_27(int x) { return x * 27; }
+inline int f5332_28(int x) { return x * 28; }
+inline int f5332_29(int x) { return x * 29; }
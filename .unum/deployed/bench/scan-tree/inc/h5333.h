@@ -0,0 +1,42 @@
+#pragma once
+/* header 5333 */
+#include <vector>
+#include "h9775.h"
+#include "h1962.h"
+#include "h9125.h"
+#include "h7885.h"
+#include "h8813.h"
+#ifdef X
+#include "h3891.h"
+#endif
+struct S5333 { int a; const char *s = "x//y"; };
+inline int f5333_0(int x) { return x * 0; }
+inline int f5333_1(int x) { return x * 1; }
+inline int f5333_2(int x) { return x * 2; }
+inline int f5333_3(int x) { return x * 3; }
+inline int f5333_4(int x) { return x * 4; }
+inline int f5333_5(int x) { return x * 5; }
+inline int f5333_6(int x) { return x * 6; }
+inline int f5333_7(int x) { return x * 7; }
+inline int f5333_8(int x) { return x * 8; }
+inline int f5333_9(int x) { return x * 9; }
+inline int f5333_10(int x) { return x * 10; }
+inline int f5333_11(int x) { return x * 11; }
+inline int f5333_12(int x) { return x * 12; }
+inline int f5333_13(int x) { return x * 13; }
+inline int f5333_14(int x) { return x * 14; }
+inline int f5333_15(int x) { return x * 15; }
+inline int f5333_16(int x) { return x * 16; }
+inline int f5333_17(int x) { return x * 17; }
+inline int f5333_18(int x) { return x * 18; }
+inline int f5333_19(int x) { return x * 19; }
+inline int f5333_20(int x) { return x * 20; }
+inline int f5333_21(int x) { return x * 21; }
+inline int f5333_22(int x) { return x * 22; }
+inline int f5333_23(int x) { return x * 23; }
+inline int f5333_24(int x) { return x * 24; }
+inline int f5333_25(int x) { return x * 25; }
+inline int f5333_26(int x) { return x * 26; }
+inline int f5333_27(int x) { return x * 27; }
+inline int f5333_28(int x) { return x * 28; }
+inline int f5333_29(int x) { return x * 29; }
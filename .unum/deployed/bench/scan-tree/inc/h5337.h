@@ -0,0 +1,42 @@
+#pragma once
+/* header 5337 */
+#include <vector>
+#include "h1117.h"
+#include "h7867.h"
+#include "h2983.h"
+#include "h8765.h"
+#include "h8193.h"
+#ifdef X
+#include "h7444.h"
+#endif
+struct S5337 { int a; const char *s = "x//y"; };
+inline int f5337_0(int x) { return x * 0; }
+inline int f5337_1(int x) { return x * 1; }
+inline int f5337_2(int x) { return x * 2; }
+inline int f5337_3(int x) { return x * 3; }
+inline int f5337_4(int x) { return x * 4; }
+inline int f5337_5(int x) { return x * 5; }
+inline int f5337_6(int x) { return x * 6; }
+inline int f5337_7(int x) { return x * 7; }
+inline int f5337_8(int x) { return x * 8; }
+inline int f5337_9(int x) { return x * 9; }
+inline int f5337_10(int x) { return x * 10; }
+inline int f5337_11(int x) { return x * 11; }
+inline int f5337_12(int x) { return x * 12; }
+inline int f5337_13(int x) { return x * 13; }
+inline int f5337_14(int x) { return x * 14; }
+inline int f5337_15(int x) { return x * 15; }
+inline int f5337_16(int x) { return x * 16; }
+inline int f5337_17(int x) { return x * 17; }
+inline int f5337_18(int x) { return x * 18; }
+inline int f5337_19(int x) { return x * 19; }
+inline int f5337_20(int x) { return x * 20; }
+inline int f5337_21(int x) { return x * 21; }
+inline int f5337_22(int x) { return x * 22; }
+inline int f5337_23(int x) { return x * 23; }
+inline int f5337_24(int x) { return x * 24; }
+inline int f5337_25(int x) { return x * 25; }
+inline int f5337_26(int x) { return x * 26; }
+inline int f5337_27(int x) { return x * 27; }
+inline int f5337_28(int x) { return x * 28; }
+inline int f5337_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 534 */
+#include <vector>
+#include "h4953.h"
+#include "h1016.h"
+#include "h3781.h"
+#include "h5966.h"
+#include "h7298.h"
+#ifdef X
+#include "h9907.h"
+#endif
+struct S534 { int a; const char *s = "x//y"; };
+inline int f534_0(int x) { return x * 0; }
+inline int f534_1(int x) { return x * 1; }
+inline int f534_2(int x) { return x * 2; }
+inline int f534_3(int x) { return x * 3; }
+inline int f534_4(int x) { return x * 4; }
+inline int f534_5(int x) { return x * 5; }
+inline int f534_6(int x) { return x * 6; }
+inline int f534_7(int x) { return x * 7; }
+inline int f534_8(int x) { return x * 8; }
+inline int f534_9(int x) { return x * 9; }
+inline int f534_10(int x) { return x * 10; }
+inline int f534_11(int x) { return x * 11; }
+inline int f534_12(int x) { return x * 12; }
+inline int f534_13(int x) { return x * 13; }
+inline int f534_14(int x) { return x * 14; }
+inline int f534_15(int x) { return x * 15; }
+inline int f534_16(int x) { return x * 16; }
+inline int f534_17(int x) { return x * 17; }
+inline int f534_18(int x) { return x * 18; }
+inline int f534_19(int x) { return x * 19; }
+inline int f534_20(int x) { return x * 20; }
+inline int f534_21(int x) { return x * 21; }
+inline int f534_22(int x) { return x * 22; }
+inline int f534_23(int x) { return x * 23; }
+inline int f534_24(int x) { return x * 24; }
+inline int f534_25(int x) { return x * 25; }
+inline int f534_26(int x) { return x * 26; }
+inline int f534_27(int x) { return x * 27; }
+inline int f534_28(int x) { return x * 28; }
+inline int f534_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5340 */
+#include <vector>
+#include "h5614.h"
+#include "h9112.h"
+#include "h5415.h"
+#include "h1152.h"
+#include "h7441.h"
+#ifdef X
+#include "h1182.h"
+#endif
+struct S5340 { int a; const char *s = "x//y"; };
+inline int f5340_0(int x) { return x * 0; }
+inline int f5340_1(int x) { return x * 1; }
+inline int f5340_2(int x) { return x * 2; }
+inline int f5340_3(int x) { return x * 3; }
+inline int f5340_4(int x) { return x * 4; }
+inline int f5340_5(int x) { return x * 5; }
+inline int f5340_6(int x) { return x * 6; }
+inline int f5340_7(int x) { return x * 7; }
+inline int f5340_8(int x) { return x * 8; }
+inline int f5340_9(int x) { return x * 9; }
+inline int f5340_10(int x) { return x * 10; }
+inline int f5340_11(int x) { return x * 11; }
+inline int f5340_12(int x) { return x * 12; }
+inline int f5340_13(int x) { return x * 13; }
+inline int f5340_14(int x) { return x * 14; }
+inline int f5340_15(int x) { return x * 15; }
+inline int f5340_16(int x) { return x * 16; }
+inline int f5340_17(int x) { return x * 17; }
+inline int f5340_18(int x) { return x * 18; }
+inline int f5340_19(int x) { return x * 19; }
+inline int f5340_20(int x) { return x * 20; }
+inline int f5340_21(int x) { return x * 21; }
+inline int f5340_22(int x) { return x * 22; }
+inline int f5340_23(int x) { return x * 23; }
+inline int f5340_24(int x) { return x * 24; }
+inline int f5340_25(int x) { return x * 25; }
+inline int f5340_26(int x) { return x * 26; }
+inline int f5340_27(int x) { return x * 27; }
+inline int f5340_28(int x) { return x * 28; }
+inline int f5340_29(int x) { return x * 29; }
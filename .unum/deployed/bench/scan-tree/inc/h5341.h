@@ -0,0 +1,42 @@
+#pragma once
+/* header 5341 */
+#include <vector>
+#include "h2084.h"
+#include "h2869.h"
+#include "h5640.h"
+#include "h4332.h"
+#include "h5815.h"
+#ifdef X
+#include "h4670.h"
+#endif
+struct S5341 { int a; const char *s = "x//y"; };
+inline int f5341_0(int x) { return x * 0; }
+inline int f5341_1(int x) { return x * 1; }
+inline int f5341_2(int x) { return x * 2; }
+inline int f5341_3(int x) { return x * 3; }
+inline int f5341_4(int x) { return x * 4; }
+inline int f5341_5(int x) { return x * 5; }
+inline int f5341_6(int x) { return x * 6; }
+inline int f5341_7(int x) { return x * 7; }
+inline int f5341_8(int x) { return x * 8; }
+inline int f5341_9(int x) { return x * 9; }
+inline int f5341_10(int x) { return x * 10; }
+inline int f5341_11(int x) { return x * 11; }
+inline int f5341_12(int x) { return x * 12; }
+inline int f5341_13(int x) { return x * 13; }
+inline int f5341_14(int x) { return x * 14; }
+inline int f5341_15(int x) { return x * 15; }
+inline int f5341_16(int x) { return x * 16; }
+inline int f5341_17(int x) { return x * 17; }
+inline int f5341_18(int x) { return x * 18; }
+inline int f5341_19(int x) { return x * 19; }
+inline int f5341_20(int x) { return x * 20; }
+inline int f5341_21(int x) { return x * 21; }
+inline int f5341_22(int x) { return x * 22; }
+inline int f5341_23(int x) { return x * 23; }
+inline int f5341_24(int x) { return x * 24; }
+inline int f5341_25(int x) { return x * 25; }
+inline int f5341_26(int x) { return x * 26; }
+inline int f5341_27(int x) { return x * 27; }
+inline int f5341_28(int x) { return x * 28; }
+inline int f5341_29(int x) { return x * 29; }
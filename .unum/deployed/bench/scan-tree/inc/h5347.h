@@ -0,0 +1,42 @@
+#pragma once
+/* header 5347 */
+#include <vector>
+#include "h7564.h"
+#include "h1460.h"
+#include "h1994.h"
+#include "h6625.h"
+#include "h6713.h"
+#ifdef X
+#include "h8106.h"
+#endif
+struct S5347 { int a; const char *s = "x//y"; };
+inline int f5347_0(int x) { return x * 0; }
+inline int f5347_1(int x) { return x * 1; }
+inline int f5347_2(int x) { return x * 2; }
+inline int f5347_3(int x) { return x * 3; }
+inline int f5347_4(int x) { return x * 4; }
+inline int f5347_5(int x) { return x * 5; }
+inline int f5347_6(int x) { return x * 6; }
+inline int f5347_7(int x) { return x * 7; }
+inline int f5347_8(int x) { return x * 8; }
+inline int f5347_9(int x) { return x * 9; }
+inline int f5347_10(int x) { return x * 10; }
+inline int f5347_11(int x) { return x * 11; }
+inline int f5347_12(int x) { return x * 12; }
+inline int f5347_13(int x) { return x * 13; }
+inline int f5347_14(int x) { return x * 14; }
+inline int f5347_15(int x) { return x * 15; }
+inline int f5347_16(int x) { return x * 16; }
+inline int f5347_17(int x) { return x * 17; }
+inline int f5347_18(int x) { return x * 18; }
+inline int f5347_19(int x) { return x * 19; }
+inline int f5347_20(int x) { return x * 20; }
+inline int f5347_21(int x) { return x * 21; }
+inline int f5347_22(int x) { return x * 22; }
+inline int f5347_23(int x) { return x * 23; }
+inline int f5347_24(int x) { return x * 24; }
+inline int f5347_25(int x) { return x * 25; }
+inline int f5347_26(int x) { return x * 26; }
+inline int f5347_27(int x) { return x * 27; }
+inline int f5347_28(int x) { return x * 28; }
+inline int f5347_29(int x) { return x * 29; }
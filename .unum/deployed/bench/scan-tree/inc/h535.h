@@ -0,0 +1,42 @@
+#pragma once
+/* header 535 */
+#include <vector>
+#include "h3702.h"
+#include "h8602.h"
+#include "h6573.h"
+#include "h8849.h"
+#include "h8696.h"
+#ifdef X
+#include "h5406.h"
+#endif
+struct S535 { int a; const char *s = "x//y"; };
+inline int f535_0(int x) { return x * 0; }
+inline int f535_1(int x) { return x * 1; }
+inline int f535_2(int x) { return x * 2; }
+inline int f535_3(int x) { return x * 3; }
+inline int f535_4(int x) { return x * 4; }
+inline int f535_5(int x) { return x * 5; }
+inline int f535_6(int x) { return x * 6; }
+inline int f535_7(int x) { return x * 7; }
+inline int f535_8(int x) { return x * 8; }
+inline int f535_9(int x) { return x * 9; }
+inline int f535_10(int x) { return x * 10; }
+inline int f535_11(int x) { return x * 11; }
+inline int f535_12(int x) { return x * 12; }
+inline int f535_13(int x) { return x * 13; }
+inline int f535_14(int x) { return x * 14; }
+inline int f535_15(int x) { return x * 15; }
+inline int f535_16(int x) { return x * 16; }
+inline int f535_17(int x) { return x * 17; }
+inline int f535_18(int x) { return x * 18; }
+inline int f535_19(int x) { return x * 19; }
+inline int f535_20(int x) { return x * 20; }
+inline int f535_21(int x) { return x * 21; }
+inline int f535_22(int x) { return x * 22; }
+inline int f535_23(int x) { return x * 23; }
+inline int f535_24(int x) { return x * 24; }
+inline int f535_25(int x) { return x * 25; }
+inline int f535_26(int x) { return x * 26; }
+inline int f535_27(int x) { return x * 27; }
+inline int f535_28(int x) { return x * 28; }
+inline int f535_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5350 */
+#include <vector>
+#include "h3502.h"
+#include "h9931.h"
+#include "h4910.h"
+#include "h4948.h"
+#include "h8003.h"
+#ifdef X
+#include "h2984.h"
+#endif
+struct S5350 { int a; const char *s = "x//y"; };
+inline int f5350_0(int x) { return x * 0; }
+inline int f5350_1(int x) { return x * 1; }
+inline int f5350_2(int x) { return x * 2; }
+inline int f5350_3(int x) { return x * 3; }
+inline int f5350_4(int x) { return x * 4; }
+inline int f5350_5(int x) { return x * 5; }
+inline int f5350_6(int x) { return x * 6; }
+inline int f5350_7(int x) { return x * 7; }
+inline int f5350_8(int x) { return x * 8; }
+inline int f5350_9(int x) { return x * 9; }
+inline int f5350_10(int x) { return x * 10; }
+inline int f5350_11(int x) { return x * 11; }
+inline int f5350_12(int x) { return x * 12; }
+inline int f5350_13(int x) { return x * 13; }
+inline int f5350_14(int x) { return x * 14; }
+inline int f5350_15(int x) { return x * 15; }
+inline int f5350_16(int x) { return x * 16; }
+inline int f5350_17(int x) { return x * 17; }
+inline int f5350_18(int x) { return x * 18; }
+inline int f5350_19(int x) { return x * 19; }
+inline int f5350_20(int x) { return x * 20; }
+inline int f5350_21(int x) { return x * 21; }
+inline int f5350_22(int x) { return x * 22; }
+inline int f5350_23(int x) { return x * 23; }
+inline int f5350_24(int x) { return x * 24; }
+inline int f5350_25(int x) { return x * 25; }
+inline int f5350_26(int x) { return x * 26; }
+inline int f5350_27(int x) { return x * 27; }
+inline int f5350_28(int x) { return x * 28; }
+inline int f5350_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5354 */
+#include <vector>
+#include "h2937.h"
+#include "h9163.h"
+#include "h2140.h"
+#include "h5192.h"
+#include "h4006.h"
+#ifdef X
+#include "h966.h"
+#endif
+struct S5354 { int a; const char *s = "x//y"; };
+inline int f5354_0(int x) { return x * 0; }
+inline int f5354_1(int x) { return x * 1; }
+inline int f5354_2(int x) { return x * 2; }
+inline int f5354_3(int x) { return x * 3; }
+inline int f5354_4(int x) { return x * 4; }
+inline int f5354_5(int x) { return x * 5; }
+inline int f5354_6(int x) { return x * 6; }
+inline int f5354_7(int x) { return x * 7; }
+inline int f5354_8(int x) { return x * 8; }
+inline int f5354_9(int x) { return x * 9; }
+inline int f5354_10(int x) { return x * 10; }
+inline int f5354_11(int x) { return x * 11; }
+inline int f5354_12(int x) { return x * 12; }
+inline int f5354_13(int x) { return x * 13; }
+inline int f5354_14(int x) { return x * 14; }
+inline int f5354_15(int x) { return x * 15; }
+inline int f5354_16(int x) { return x * 16; }
+inline int f5354_17(int x) { return x * 17; }
+inline int f5354_18(int x) { return x * 18; }
+inline int f5354_19(int x) { return x * 19; }
+inline int f5354_20(int x) { return x * 20; }
+inline int f5354_21(int x) { return x * 21; }
+inline int f5354_22(int x) { return x * 22; }
+inline int f5354_23(int x) { return x * 23; }
+inline int f5354_24(int x) { return x * 24; }
+inline int f5354_25(int x) { return x * 25; }
+inline int f5354_26(int x) { return x * 26; }
+inline int f5354_27(int x) { return x * 27; }
+inline int f5354_28(int x) { return x * 28; }
+inline int f5354_29(int x) { return x * 29; }
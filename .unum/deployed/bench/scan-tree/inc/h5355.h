@@ -0,0 +1,42 @@
+#pragma once
+/* header 5355 */
+#include <vector>
+#include "h9364.h"
+#include "h5902.h"
+#include "h838.h"
+#include "h6068.h"
+#include "h3832.h"
+#ifdef X
+#include "h9578.h"
+#endif
+struct S5355 { int a; const char *s = "x//y"; };
+inline int f5355_0(int x) { return x * 0; }
+inline int f5355_1(int x) { return x * 1; }
+inline int f5355_2(int x) { return x * 2; }
+inline int f5355_3(int x) { return x * 3; }
+inline int f5355_4(int x) { return x * 4; }
+inline int f5355_5(int x) { return x * 5; }
+inline int f5355_6(int x) { return x * 6; }
+inline int f5355_7(int x) { return x * 7; }
+inline int f5355_8(int x) { return x * 8; }
+inline int f5355_9(int x) { return x * 9; }
+inline int f5355_10(int x) { return x * 10; }
+inline int f5355_11(int x) { return x * 11; }
+inline int f5355_12(int x) { return x * 12; }
+inline int f5355_13(int x) { return x * 13; }
+inline int f5355_14(int x) { return x * 14; }
+inline int f5355_15(int x) { return x * 15; }
+inline int f5355_16(int x) { return x * 16; }
+inline int f5355_17(int x) { return x * 17; }
+inline int f5355_18(int x) { return x * 18; }
+inline int f5355_19(int x) { return x * 19; }
+inline int f5355_20(int x) { return x * 20; }
+inline int f5355_21(int x) { return x * 21; }
+inline int f5355_22(int x) { return x * 22; }
+inline int f5355_23(int x) { return x * 23; }
+inline int f5355_24(int x) { return x * 24; }
+inline int f5355_25(int x) { return x * 25; }
+inline int f5355_26(int x) { return x * 26; }
+inline int f5355_27(int x) { return x * 27; }
+inline int f5355_28(int x) { return x * 28; }
+inline int f5355_29(int x) { return x * 29; }
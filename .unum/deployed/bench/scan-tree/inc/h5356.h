@@ -0,0 +1,42 @@
+#pragma once
+/* header 5356 */
+#include <vector>
+#include "h3349.h"
+#include "h1507.h"
+#include "h1490.h"
+#include "h2236.h"
+#include "h4490.h"
+#ifdef X
+#include "h4979.h"
+#endif
+struct S5356 { int a; const char *s = "x//y"; };
+inline int f5356_0(int x) { return x * 0; }
+inline int f5356_1(int x) { return x * 1; }
+inline int f5356_2(int x) { return x * 2; }
+inline int f5356_3(int x) { return x * 3; }
+inline int f5356_4(int x) { return x * 4; }
+inline int f5356_5(int x) { return x * 5; }
+inline int f5356_6(int x) { return x * 6; }
+inline int f5356_7(int x) { return x * 7; }
+inline int f5356_8(int x) { return x * 8; }
+inline int f5356_9(int x) { return x * 9; }
+inline int f5356_10(int x) { return x * 10; }
+inline int f5356_11(int x) { return x * 11; }
+inline int f5356_12(int x) { return x * 12; }
+inline int f5356_13(int x) { return x * 13; }
+inline int f5356_14(int x) { return x * 14; }
+inline int f5356_15(int x) { return x * 15; }
+inline int f5356_16(int x) { return x * 16; }
+inline int f5356_17(int x) { return x * 17; }
+inline int f5356_18(int x) { return x * 18; }
+inline int f5356_19(int x) { return x * 19; }
+inline int f5356_20(int x) { return x * 20; }
+inline int f5356_21(int x) { return x * 21; }
+inline int f5356_22(int x) { return x * 22; }
+inline int f5356_23(int x) { return x * 23; }
+inline int f5356_24(int x) { return x * 24; }
+inline int f5356_25(int x) { return x * 25; }
+inline int f5356_26(int x) { return x * 26; }
+inline int f5356_27(int x) { return x * 27; }
+inline int f5356_28(int x) { return x * 28; }
+inline int f5356_29(int x) { return x * 29; }
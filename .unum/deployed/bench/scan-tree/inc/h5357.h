@@ -0,0 +1,42 @@
+#pragma once
+/* header 5357 */
+#include <vector>
+#include "h4651.h"
+#include "h6371.h"
+#include "h8422.h"
+#include "h5205.h"
+#include "h4057.h"
+#ifdef X
+#include "h1984.h"
+#endif
+struct S5357 { int a; const char *s = "x//y"; };
+inline int f5357_0(int x) { return x * 0; }
+inline int f5357_1(int x) { return x * 1; }
+inline int f5357_2(int x) { return x * 2; }
+inline int f5357_3(int x) { return x * 3; }
+inline int f5357_4(int x) { return x * 4; }
+inline int f5357_5(int x) { return x * 5; }
+inline int f5357_6(int x) { return x * 6; }
+inline int f5357_7(int x) { return x * 7; }
+inline int f5357_8(int x) { return x * 8; }
+inline int f5357_9(int x) { return x * 9; }
+inline int f5357_10(int x) { return x * 10; }
+inline int f5357_11(int x) { return x * 11; }
+inline int f5357_12(int x) { return x * 12; }
+inline int f5357_13(int x) { return x * 13; }
+inline int f5357_14(int x) { return x * 14; }
+inline int f5357_15(int x) { return x * 15; }
+inline int f5357_16(int x) { return x * 16; }
+inline int f5357_17(int x) { return x * 17; }
+inline int f5357_18(int x) { return x * 18; }
+inline int f5357_19(int x) { return x * 19; }
+inline int f5357_20(int x) { return x * 20; }
+inline int f5357_21(int x) { return x * 21; }
+inline int f5357_22(int x) { return x * 22; }
+inline int f5357_23(int x) { return x * 23; }
+inline int f5357_24(int x) { return x * 24; }
+inline int f5357_25(int x) { return x * 25; }
+inline int f5357_26(int x) { return x * 26; }
+inline int f5357_27(int x) { return x * 27; }
+inline int f5357_28(int x) { return x * 28; }
+inline int f5357_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 536 */
+#include <vector>
+#include "h2206.h"
+#include "h6572.h"
+#include "h8930.h"
+#include "h9111.h"
+#include "h2820.h"
+#ifdef X
+#include "h9192.h"
+#endif
+struct S536 { int a; const char *s = "x//y"; };
+inline int f536_0(int x) { return x * 0; }
+inline int f536_1(int x) { return x * 1; }
+inline int f536_2(int x) { return x * 2; }
+inline int f536_3(int x) { return x * 3; }
+inline int f536_4(int x) { return x * 4; }
+inline int f536_5(int x) { return x * 5; }
+inline int f536_6(int x) { return x * 6; }
+inline int f536_7(int x) { return x * 7; }
+inline int f536_8(int x) { return x * 8; }
+inline int f536_9(int x) { return x * 9; }
+inline int f536_10(int x) { return x * 10; }
+inline int f536_11(int x) { return x * 11; }
+inline int f536_12(int x) { return x * 12; }
+inline int f536_13(int x) { return x * 13; }
+inline int f536_14(int x) { return x * 14; }
+inline int f536_15(int x) { return x * 15; }
+inline int f536_16(int x) { return x * 16; }
+inline int f536_17(int x) { return x * 17; }
+inline int f536_18(int x) { return x * 18; }
+inline int f536_19(int x) { return x * 19; }
+inline int f536_20(int x) { return x * 20; }
+inline int f536_21(int x) { return x * 21; }
+inline int f536_22(int x) { return x * 22; }
+inline int f536_23(int x) { return x * 23; }
+inline int f536_24(int x) { return x * 24; }
+inline int f536_25(int x) { return x * 25; }
+inline int f536_26(int x) { return x * 26; }
+inline int f536_27(int x) { return x * 27; }
+inline int f536_28(int x) { return x * 28; }
+inline int f536_29(int x) { return x * 29; }
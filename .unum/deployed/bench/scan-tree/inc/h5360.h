@@ -0,0 +1,42 @@
+#pragma once
+/* header 5360 */
+#include <vector>
+#include "h4447.h"
+#include "h7997.h"
+#include "h424.h"
+#include "h445.h"
+#include "h8276.h"
+#ifdef X
+#include "h9266.h"
+#endif
+struct S5360 { int a; const char *s = "x//y"; };
+inline int f5360_0(int x) { return x * 0; }
+inline int f5360_1(int x) { return x * 1; }
+inline int f5360_2(int x) { return x * 2; }
+inline int f5360_3(int x) { return x * 3; }
+inline int f5360_4(int x) { return x * 4; }
+inline int f5360_5(int x) { return x * 5; }
+inline int f5360_6(int x) { return x * 6; }
+inline int f5360_7(int x) { return x * 7; }
+inline int f5360_8(int x) { return x * 8; }
+inline int f5360_9(int x) { return x * 9; }
+inline int f5360_10(int x) { return x * 10; }
+inline int f5360_11(int x) { return x * 11; }
+inline int f5360_12(int x) { return x * 12; }
+inline int f5360_13(int x) { return x * 13; }
+inline int f5360_14(int x) { return x * 14; }
+inline int f5360_15(int x) { return x * 15; }
+inline int f5360_16(int x) { return x * 16; }
+inline int f5360_17(int x) { return x * 17; }
+inline int f5360_18(int x) { return x * 18; }
+inline int f5360_19(int x) { return x * 19; }
+inline int f5360_20(int x) { return x * 20; }
+inline int f5360_21(int x) { return x * 21; }
+inline int f5360_22(int x) { return x * 22; }
+inline int f5360_23(int x) { return x * 23; }
+inline int f5360_24(int x) { return x * 24; }
+inline int f5360_25(int x) { return x * 25; }
+inline int f5360_26(int x) { return x * 26; }
+inline int f5360_27(int x) { return x * 27; }
+inline int f5360_28(int x) { return x * 28; }
+inline int f5360_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5362 */
+#include <vector>
+#include "h9524.h"
+#include "h6749.h"
+#include "h5453.h"
+#include "h4189.h"
+#include "h8097.h"
+#ifdef X
+#include "h7994.h"
+#endif
+struct S5362 { int a; const char *s = "x//y"; };
+inline int f5362_0(int x) { return x * 0; }
+inline int f5362_1(int x) { return x * 1; }
+inline int f5362_2(int x) { return x * 2; }
+inline int f5362_3(int x) { return x * 3; }
+inline int f5362_4(int x) { return x * 4; }
+inline int f5362_5(int x) { return x * 5; }
+inline int f5362_6(int x) { return x * 6; }
+inline int f5362_7(int x) { return x * 7; }
+inline int f5362_8(int x) { return x * 8; }
+inline int f5362_9(int x) { return x * 9; }
+inline int f5362_10(int x) { return x * 10; }
+inline int f5362_11(int x) { return x * 11; }
+inline int f5362_12(int x) { return x * 12; }
+inline int f5362_13(int x) { return x * 13; }
+inline int f5362_14(int x) { return x * 14; }
+inline int f5362_15(int x) { return x * 15; }
+inline int f5362_16(int x) { return x * 16; }
+inline int f5362_17(int x) { return x * 17; }
+inline int f5362_18(int x) { return x * 18; }
+inline int f5362_19(int x) { return x * 19; }
+inline int f5362_20(int x) { return x * 20; }
+inline int f5362_21(int x) { return x * 21; }
+inline int f5362_22(int x) { return x * 22; }
+inline int f5362_23(int x) { return x * 23; }
+inline int f5362_24(int x) { return x * 24; }
+inline int f5362_25(int x) { return x * 25; }
+inline int f5362_26(int x) { return x * 26; }
+inline int f5362_27(int x) { return x * 27; }
+inline int f5362_28(int x) { return x * 28; }
+inline int f5362_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5365 */
+#include <vector>
+#include "h268.h"
+#include "h7217.h"
+#include "h1391.h"
+#include "h6240.h"
+#include "h9019.h"
+#ifdef X
+#include "h3817.h"
+#endif
+struct S5365 { int a; const char *s = "x//y"; };
+inline int f5365_0(int x) { return x * 0; }
+inline int f5365_1(int x) { return x * 1; }
+inline int f5365_2(int x) { return x * 2; }
+inline int f5365_3(int x) { return x * 3; }
+inline int f5365_4(int x) { return x * 4; }
+inline int f5365_5(int x) { return x * 5; }
+inline int f5365_6(int x) { return x * 6; }
+inline int f5365_7(int x) { return x * 7; }
+inline int f5365_8(int x) { return x * 8; }
+inline int f5365_9(int x) { return x * 9; }
+inline int f5365_10(int x) { return x * 10; }
+inline int f5365_11(int x) { return x * 11; }
+inline int f5365_12(int x) { return x * 12; }
+inline int f5365_13(int x) { return x * 13; }
+inline int f5365_14(int x) { return x * 14; }
+inline int f5365_15(int x) { return x * 15; }
+inline int f5365_16(int x) { return x * 16; }
+inline int f5365_17(int x) { return x * 17; }
+inline int f5365_18(int x) { return x * 18; }
+inline int f5365_19(int x) { return x * 19; }
+inline int f5365_20(int x) { return x * 20; }
+inline int f5365_21(int x) { return x * 21; }
+inline int f5365_22(int x) { return x * 22; }
+inline int f5365_23(int x) { return x * 23; }
+inline int f5365_24(int x) { return x * 24; }
+inline int f5365_25(int x) { return x * 25; }
+inline int f5365_26(int x) { return x * 26; }
+inline int f5365_27(int x) { return x * 27; }
+inline int f5365_28(int x) { return x * 28; }
+inline int f5365_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5369 */
+#include <vector>
+#include "h8861.h"
+#include "h1310.h"
+#include "h5943.h"
+#include "h3363.h"
+#include "h4216.h"
+#ifdef X
+#include "h7409.h"
+#endif
+struct S5369 { int a; const char *s = "x//y"; };
+inline int f5369_0(int x) { return x * 0; }
+inline int f5369_1(int x) { return x * 1; }
+inline int f5369_2(int x) { return x * 2; }
+inline int f5369_3(int x) { return x * 3; }
+inline int f5369_4(int x) { return x * 4; }
+inline int f5369_5(int x) { return x * 5; }
+inline int f5369_6(int x) { return x * 6; }
+inline int f5369_7(int x) { return x * 7; }
+inline int f5369_8(int x) { return x * 8; }
+inline int f5369_9(int x) { return x * 9; }
+inline int f5369_10(int x) { return x * 10; }
+inline int f5369_11(int x) { return x * 11; }
+inline int f5369_12(int x) { return x * 12; }
+inline int f5369_13(int x) { return x * 13; }
+inline int f5369_14(int x) { return x * 14; }
+inline int f5369_15(int x) { return x * 15; }
+inline int f5369_16(int x) { return x * 16; }
+inline int f5369_17(int x) { return x * 17; }
+inline int f5369_18(int x) { return x * 18; }
+inline int f5369_19(int x) { return x * 19; }
+inline int f5369_20(int x) { return x * 20; }
+inline int f5369_21(int x) { return x * 21; }
+inline int f5369_22(int x) { return x * 22; }
+inline int f5369_23(int x) { return x * 23; }
+inline int f5369_24(int x) { return x * 24; }
+inline int f5369_25(int x) { return x * 25; }
+inline int f5369_26(int x) { return x * 26; }
+inline int f5369_27(int x) { return x * 27; }
+inline int f5369_28(int x) { return x * 28; }
+inline int f5369_29(int x) { return x * 29; }
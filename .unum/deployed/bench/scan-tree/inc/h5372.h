@@ -0,0 +1,42 @@
+#pragma once
+/* header 5372 */
+#include <vector>
+#include "h8647.h"
+#include "h2324.h"
+#include "h2411.h"
+#include "h6066.h"
+#include "h5341.h"
+#ifdef X
+#include "h7283.h"
+#endif
+struct S5372 { int a; const char *s = "x//y"; };
+inline int f5372_0(int x) { return x * 0; }
+inline int f5372_1(int x) { return x * 1; }
+inline int f5372_2(int x) { return x * 2; }
+inline int f5372_3(int x) { return x * 3; }
+inline int f5372_4(int x) { return x * 4; }
+inline int f5372_5(int x) { return x * 5; }
+inline int f5372_6(int x) { return x * 6; }
+inline int f5372_7(int x) { return x * 7; }
+inline int f5372_8(int x) { return x * 8; }
+inline int f5372_9(int x) { return x * 9; }
+inline int f5372_10(int x) { return x * 10; }
+inline int f5372_11(int x) { return x * 11; }
+inline int f5372_12(int x) { return x * 12; }
+inline int f5372_13(int x) { return x * 13; }
+inline int f5372_14(int x) { return x * 14; }
+inline int f5372_15(int x) { return x * 15; }
+inline int f5372_16(int x) { return x * 16; }
+inline int f5372_17(int x) { return x * 17; }
+inline int f5372_18(int x) { return x * 18; }
+inline int f5372_19(int x) { return x * 19; }
+inline int f5372_20(int x) { return x * 20; }
+inline int f5372_21(int x) { return x * 21; }
+inline int f5372_22(int x) { return x * 22; }
+inline int f5372_23(int x) { return x * 23; }
+inline int f5372_24(int x) { return x * 24; }
+inline int f5372_25(int x) { return x * 25; }
+inline int f5372_26(int x) { return x * 26; }
+inline int f5372_27(int x) { return x * 27; }
+inline int f5372_28(int x) { return x * 28; }
+inline int f5372_29(int x) { return x * 29; }
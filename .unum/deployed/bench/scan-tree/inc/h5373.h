@@ -0,0 +1,42 @@
+#pragma once
+/* header 5373 */
+#include <vector>
+#include "h4763.h"
+#include "h9455.h"
+#include "h5224.h"
+#include "h6689.h"
+#include "h2750.h"
+#ifdef X
+#include "h3434.h"
+#endif
+struct S5373 { int a; const char *s = "x//y"; };
+inline int f5373_0(int x) { return x * 0; }
+inline int f5373_1(int x) { return x * 1; }
+inline int f5373_2(int x) { return x * 2; }
+inline int f5373_3(int x) { return x * 3; }
+inline int f5373_4(int x) { return x * 4; }
+inline int f5373_5(int x) { return x * 5; }
+inline int f5373_6(int x) { return x * 6; }
+inline int f5373_7(int x) { return x * 7; }
+inline int f5373_8(int x) { return x * 8; }
+inline int f5373_9(int x) { return x * 9; }
+inline int f5373_10(int x) { return x * 10; }
+inline int f5373_11(int x) { return x * 11; }
+inline int f5373_12(int x) { return x * 12; }
+inline int f5373_13(int x) { return x * 13; }
+inline int f5373_14(int x) { return x * 14; }
+inline int f5373_15(int x) { return x * 15; }
+inline int f5373_16(int x) { return x * 16; }
+inline int f5373_17(int x) { return x * 17; }
+inline int f5373_18(int x) { return x * 18; }
+inline int f5373_19(int x) { return x * 19; }
+inline int f5373_20(int x) { return x * 20; }
+inline int f5373_21(int x) { return x * 21; }
+inline int f5373_22(int x) { return x * 22; }
+inline int f5373_23(int x) { return x * 23; }
+inline int f5373_24(int x) { return x * 24; }
+inline int f5373_25(int x) { return x * 25; }
+inline int f5373_26(int x) { return x * 26; }
+inline int f5373_27(int x) { return x * 27; }
+inline int f5373_28(int x) { return x * 28; }
+inline int f5373_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5378 */
+#include <vector>
+#include "h3544.h"
+#include "h8599.h"
+#include "h7974.h"
+#include "h8548.h"
+#include "h9291.h"
+#ifdef X
+#include "h2626.h"
+#endif
+struct S5378 { int a; const char *s = "x//y"; };
+inline int f5378_0(int x) { return x * 0; }
+inline int f5378_1(int x) { return x * 1; }
+inline int f5378_2(int x) { return x * 2; }
+inline int f5378_3(int x) { return x * 3; }
+inline int f5378_4(int x) { return x * 4; }
+inline int f5378_5(int x) { return x * 5; }
+inline int f5378_6(int x) { return x * 6; }
+inline int f5378_7(int x) { return x * 7; }
+inline int f5378_8(int x) { return x * 8; }
+inline int f5378_9(int x) { return x * 9; }
+inline int f5378_10(int x) { return x * 10; }
+inline int f5378_11(int x) { return x * 11; }
+inline int f5378_12(int x) { return x * 12; }
+inline int f5378_13(int x) { return x * 13; }
+inline int f5378_14(int x) { return x * 14; }
+inline int f5378_15(int x) { return x * 15; }
+inline int f5378_16(int x) { return x * 16; }
+inline int f5378_17(int x) { return x * 17; }
+inline int f5378_18(int x) { return x * 18; }
+inline int f5378_19(int x) { return x * 19; }
+inline int f5378_20(int x) { return x * 20; }
+inline int f5378_21(int x) { return x * 21; }
+inline int f5378_22(int x) { return x * 22; }
+inline int f5378_23(int x) { return x * 23; }
+inline int f5378_24(int x) { return x * 24; }
+inline int f5378_25(int x) { return x * 25; }
+inline int f5378_26(int x) { return x * 26; }
+inline int f5378_27(int x) { return x * 27; }
+inline int f5378_28(int x) { return x * 28; }
+inline int f5378_29(int x) { return x * 29; }
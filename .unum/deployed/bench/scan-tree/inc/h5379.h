@@ -0,0 +1,42 @@
+#pragma once
+/* header 5379 */
+#include <vector>
+#include "h275.h"
+#include "h3352.h"
+#include "h8880.h"
+#include "h2552.h"
+#include "h8184.h"
+#ifdef X
+#include "h877.h"
+#endif
+struct S5379 { int a; const char *s = "x//y"; };
+inline int f5379_0(int x) { return x * 0; }
+inline int f5379_1(int x) { return x * 1; }
+inline int f5379_2(int x) { return x * 2; }
+inline int f5379_3(int x) { return x * 3; }
+inline int f5379_4(int x) { return x * 4; }
+inline int f5379_5(int x) { return x * 5; }
+inline int f5379_6(int x) { return x * 6; }
+inline int f5379_7(int x) { return x * 7; }
+inline int f5379_8(int x) { return x * 8; }
+inline int f5379_9(int x) { return x * 9; }
+inline int f5379_10(int x) { return x * 10; }
+inline int f5379_11(int x) { return x * 11; }
+inline int f5379_12(int x) { return x * 12; }
+inline int f5379_13(int x) { return x * 13; }
+inline int f5379_14(int x) { return x * 14; }
+inline int f5379_15(int x) { return x * 15; }
+inline int f5379_16(int x) { return x * 16; }
+inline int f5379_17(int x) { return x * 17; }
+inline int f5379_18(int x) { return x * 18; }
+inline int f5379_19(int x) { return x * 19; }
+inline int f5379_20(int x) { return x * 20; }
+inline int f5379_21(int x) { return x * 21; }
+inline int f5379_22(int x) { return x * 22; }
+inline int f5379_23(int x) { return x * 23; }
+inline int f5379_24(int x) { return x * 24; }
+inline int f5379_25(int x) { return x * 25; }
+inline int f5379_26(int x) { return x * 26; }
+inline int f5379_27(int x) { return x * 27; }
+inline int f5379_28(int x) { return x * 28; }
+inline int f5379_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 538 */
+#include <vector>
+#include "h343.h"
+#include "h6391.h"
+#include "h3326.h"
+#include "h5041.h"
+#include "h5727.h"
+#ifdef X
+#include "h6917.h"
+#endif
+struct S538 { int a; const char *s = "x//y"; };
+inline int f538_0(int x) { return x * 0; }
+inline int f538_1(int x) { return x * 1; }
+inline int f538_2(int x) { return x * 2; }
+inline int f538_3(int x) { return x * 3; }
+inline int f538_4(int x) { return x * 4; }
+inline int f538_5(int x) { return x * 5; }
+inline int f538_6(int x) { return x * 6; }
+inline int f538_7(int x) { return x * 7; }
+inline int f538_8(int x) { return x * 8; }
+inline int f538_9(int x) { return x * 9; }
+inline int f538_10(int x) { return x * 10; }
+inline int f538_11(int x) { return x * 11; }
+inline int f538_12(int x) { return x * 12; }
+inline int f538_13(int x) { return x * 13; }
+inline int f538_14(int x) { return x * 14; }
+inline int f538_15(int x) { return x * 15; }
+inline int f538_16(int x) { return x * 16; }
+inline int f538_17(int x) { return x * 17; }
+inline int f538_18(int x) { return x * 18; }
+inline int f538_19(int x) { return x * 19; }
+inline int f538_20(int x) { return x * 20; }
+inline int f538_21(int x) { return x * 21; }
+inline int f538_22(int x) { return x * 22; }
+inline int f538_23(int x) { return x * 23; }
+inline int f538_24(int x) { return x * 24; }
+inline int f538_25(int x) { return x * 25; }
+inline int f538_26(int x) { return x * 26; }
+inline int f538_27(int x) { return x * 27; }
+inline int f538_28(int x) { return x * 28; }
+inline int f538_29(int x) { return x * 29; }
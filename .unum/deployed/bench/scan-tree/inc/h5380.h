@@ -0,0 +1,42 @@
+#pragma once
+/* header 5380 */
+#include <vector>
+#include "h2815.h"
+#include "h4005.h"
+#include "h87.h"
+#include "h5668.h"
+#include "h1378.h"
+#ifdef X
+#include "h4279.h"
+#endif
+struct S5380 { int a; const char *s = "x//y"; };
+inline int f5380_0(int x) { return x * 0; }
+inline int f5380_1(int x) { return x * 1; }
+inline int f5380_2(int x) { return x * 2; }
+inline int f5380_3(int x) { return x * 3; }
+inline int f5380_4(int x) { return x * 4; }
+inline int f5380_5(int x) { return x * 5; }
+inline int f5380_6(int x) { return x * 6; }
+inline int f5380_7(int x) { return x * 7; }
+inline int f5380_8(int x) { return x * 8; }
+inline int f5380_9(int x) { return x * 9; }
+inline int f5380_10(int x) { return x * 10; }
+inline int f5380_11(int x) { return x * 11; }
+inline int f5380_12(int x) { return x * 12; }
+inline int f5380_13(int x) { return x * 13; }
+inline int f5380_14(int x) { return x * 14; }
+inline int f5380_15(int x) { return x * 15; }
+inline int f5380_16(int x) { return x * 16; }
+inline int f5380_17(int x) { return x * 17; }
+inline int f5380_18(int x) { return x * 18; }
+inline int f5380_19(int x) { return x * 19; }
+inline int f5380_20(int x) { return x * 20; }
+inline int f5380_21(int x) { return x * 21; }
+inline int f5380_22(int x) { return x * 22; }
+inline int f5380_23(int x) { return x * 23; }
+inline int f5380_24(int x) { return x * 24; }
+inline int f5380_25(int x) { return x * 25; }
+inline int f5380_26(int x) { return x * 26; }
+inline int f5380_27(int x) { return x * 27; }
+inline int f5380_28(int x) { return x * 28; }
+inline int f5380_29(int x) { return x * 29; }
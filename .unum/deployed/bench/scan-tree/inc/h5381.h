@@ -0,0 +1,42 @@
+#pragma once
+/* header 5381 */
+#include <vector>
+#include "h2698.h"
+#include "h9578.h"
+#include "h6821.h"
+#include "h6542.h"
+#include "h946.h"
+#ifdef X
+#include "h1185.h"
+#endif
+struct S5381 { int a; const char *s = "x//y"; };
+inline int f5381_0(int x) { return x * 0; }
+inline int f5381_1(int x) { return x * 1; }
+inline int f5381_2(int x) { return x * 2; }
+inline int f5381_3(int x) { return x * 3; }
+inline int f5381_4(int x) { return x * 4; }
+inline int f5381_5(int x) { return x * 5; }
+inline int f5381_6(int x) { return x * 6; }
+inline int f5381_7(int x) { return x * 7; }
+inline int f5381_8(int x) { return x * 8; }
+inline int f5381_9(int x) { return x * 9; }
+inline int f5381_10(int x) { return x * 10; }
+inline int f5381_11(int x) { return x * 11; }
+inline int f5381_12(int x) { return x * 12; }
+inline int f5381_13(int x) { return x * 13; }
+inline int f5381_14(int x) { return x * 14; }
+inline int f5381_15(int x) { return x * 15; }
+inline int f5381_16(int x) { return x * 16; }
+inline int f5381_17(int x) { return x * 17; }
+inline int f5381_18(int x) { return x * 18; }
+inline int f5381_19(int x) { return x * 19; }
+inline int f5381_20(int x) { return x * 20; }
+inline int f5381_21(int x) { return x * 21; }
+inline int f5381_22(int x) { return x * 22; }
+inline int f5381_23(int x) { return x * 23; }
+inline int f5381_24(int x) { return x * 24; }
+inline int f5381_25(int x) { return x * 25; }
+inline int f5381_26(int x) { return x * 26; }
+inline int f5381_27(int x) { return x * 27; }
+inline int f5381_28(int x) { return x * 28; }
+inline int f5381_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5385 */
+#include <vector>
+#include "h8156.h"
+#include "h993.h"
+#include "h866.h"
+#include "h3721.h"
+#include "h5950.h"
+#ifdef X
+#include "h6202.h"
+#endif
+struct S5385 { int a; const char *s = "x//y"; };
+inline int f5385_0(int x) { return x * 0; }
+inline int f5385_1(int x) { return x * 1; }
+inline int f5385_2(int x) { return x * 2; }
+inline int f5385_3(int x) { return x * 3; }
+inline int f5385_4(int x) { return x * 4; }
+inline int f5385_5(int x) { return x * 5; }
+inline int f5385_6(int x) { return x * 6; }
+inline int f5385_7(int x) { return x * 7; }
+inline int f5385_8(int x) { return x * 8; }
+inline int f5385_9(int x) { return x * 9; }
+inline int f5385_10(int x) { return x * 10; }
+inline int f5385_11(int x) { return x * 11; }
+inline int f5385_12(int x) { return x * 12; }
+inline int f5385_13(int x) { return x * 13; }
+inline int f5385_14(int x) { return x * 14; }
+inline int f5385_15(int x) { return x * 15; }
+inline int f5385_16(int x) { return x * 16; }
+inline int f5385_17(int x) { return x * 17; }
+inline int f5385_18(int x) { return x * 18; }
+inline int f5385_19(int x) { return x * 19; }
+inline int f5385_20(int x) { return x * 20; }
+inline int f5385_21(int x) { return x * 21; }
+inline int f5385_22(int x) { return x * 22; }
+inline int f5385_23(int x) { return x * 23; }
+inline int f5385_24(int x) { return x * 24; }
+inline int f5385_25(int x) { return x * 25; }
+inline int f5385_26(int x) { return x * 26; }
+inline int f5385_27(int x) { return x * 27; }
+inline int f5385_28(int x) { return x * 28; }
+inline int f5385_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5386 */
+#include <vector>
+#include "h3106.h"
+#include "h8364.h"
+#include "h5797.h"
+#include "h6330.h"
+#include "h6974.h"
+#ifdef X
+#include "h2883.h"
+#endif
+struct S5386 { int a; const char *s = "x//y"; };
+inline int f5386_0(int x) { return x * 0; }
+inline int f5386_1(int x) { return x * 1; }
+inline int f5386_2(int x) { return x * 2; }
+inline int f5386_3(int x) { return x * 3; }
+inline int f5386_4(int x) { return x * 4; }
+inline int f5386_5(int x) { return x * 5; }
+inline int f5386_6(int x) { return x * 6; }
+inline int f5386_7(int x) { return x * 7; }
+inline int f5386_8(int x) { return x * 8; }
+inline int f5386_9(int x) { return x * 9; }
+inline int f5386_10(int x) { return x * 10; }
+inline int f5386_11(int x) { return x * 11; }
+inline int f5386_12(int x) { return x * 12; }
+inline int f5386_13(int x) { return x * 13; }
+inline int f5386_14(int x) { return x * 14; }
+inline int f5386_15(int x) { return x * 15; }
+inline int f5386_16(int x) { return x * 16; }
+inline int f5386_17(int x) { return x * 17; }
+inline int f5386_18(int x) { return x * 18; }
+inline int f5386_19(int x) { return x * 19; }
+inline int f5386_20(int x) { return x * 20; }
+inline int f5386_21(int x) { return x * 21; }
+inline int f5386_22(int x) { return x * 22; }
+inline int f5386_23(int x) { return x * 23; }
+inline int f5386_24(int x) { return x * 24; }
+inline int f5386_25(int x) { return x * 25; }
+inline int f5386_26(int x) { return x * 26; }
+inline int f5386_27(int x) { return x * 27; }
+inline int f5386_28(int x) { return x * 28; }
+inline int f5386_29(int x) { return x * 29; }
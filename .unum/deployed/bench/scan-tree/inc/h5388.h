@@ -0,0 +1,42 @@
+#pragma once
+/* header 5388 */
+#include <vector>
+#include "h9775.h"
+#include "h9758.h"
+#include "h6053.h"
+#include "h8779.h"
+#include "h337.h"
+#ifdef X
+#include "h3171.h"
+#endif
+struct S5388 { int a; const char *s = "x//y"; };
+inline int f5388_0(int x) { return x * 0; }
+inline int f5388_1(int x) { return x * 1; }
+inline int f5388_2(int x) { return x * 2; }
+inline int f5388_3(int x) { return x * 3; }
+inline int f5388_4(int x) { return x * 4; }
+inline int f5388_5(int x) { return x * 5; }
+inline int f5388_6(int x) { return x * 6; }
+inline int f5388_7(int x) { return x * 7; }
+inline int f5388_8(int x) { return x * 8; }
+inline int f5388_9(int x) { return x * 9; }
+inline int f5388_10(int x) { return x * 10; }
+inline int f5388_11(int x) { return x * 11; }
+inline int f5388_12(int x) { return x * 12; }
+inline int f5388_13(int x) { return x * 13; }
+inline int f5388_14(int x) { return x * 14; }
+inline int f5388_15(int x) { return x * 15; }
+inline int f5388_16(int x) { return x * 16; }
+inline int f5388_17(int x) { return x * 17; }
+inline int f5388_18(int x) { return x * 18; }
+inline int f5388_19(int x) { return x * 19; }
+inline int f5388_20(int x) { return x * 20; }
+inline int f5388_21(int x) { return x * 21; }
+inline int f5388_22(int x) { return x * 22; }
+inline int f5388_23(int x) { return x * 23; }
+inline int f5388_24(int x) { return x * 24; }
+inline int f5388_25(int x) { return x * 25; }
+inline int f5388_26(int x) { return x * 26; }
+inline int f5388_27(int x) { return x * 27; }
+inline int f5388_28(int x) { return x * 28; }
+inline int f5388_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5395 */
+#include <vector>
+#include "h1211.h"
+#include "h2688.h"
+#include "h2665.h"
+#include "h6115.h"
+#include "h967.h"
+#ifdef X
+#include "h959.h"
+#endif
+struct S5395 { int a; const char *s = "x//y"; };
+inline int f5395_0(int x) { return x * 0; }
+inline int f5395_1(int x) { return x * 1; }
+inline int f5395_2(int x) { return x * 2; }
+inline int f5395_3(int x) { return x * 3; }
+inline int f5395_4(int x) { return x * 4; }
+inline int f5395_5(int x) { return x * 5; }
+inline int f5395_6(int x) { return x * 6; }
+inline int f5395_7(int x) { return x * 7; }
+inline int f5395_8(int x) { return x * 8; }
+inline int f5395_9(int x) { return x * 9; }
+inline int f5395_10(int x) { return x * 10; }
+inline int f5395_11(int x) { return x * 11; }
+inline int f5395_12(int x) { return x * 12; }
+inline int f5395_13(int x) { return x * 13; }
+inline int f5395_14(int x) { return x * 14; }
+inline int f5395_15(int x) { return x * 15; }
+inline int f5395_16(int x) { return x * 16; }
+inline int f5395_17(int x) { return x * 17; }
+inline int f5395_18(int x) { return x * 18; }
+inline int f5395_19(int x) { return x * 19; }
+inline int f5395_20(int x) { return x * 20; }
+inline int f5395_21(int x) { return x * 21; }
+inline int f5395_22(int x) { return x * 22; }
+inline int f5395_23(int x) { return x * 23; }
+inline int f5395_24(int x) { return x * 24; }
+inline int f5395_25(int x) { return x * 25; }
+inline int f5395_26(int x) { return x * 26; }
+inline int f5395_27(int x) { return x * 27; }
+inline int f5395_28(int x) { return x * 28; }
+inline int f5395_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5396 */
+#include <vector>
+#include "h2425.h"
+#include "h6634.h"
+#include "h2299.h"
+#include "h3505.h"
+#include "h5736.h"
+#ifdef X
+#include "h6262.h"
+#endif
+struct S5396 { int a; const char *s = "x//y"; };
+inline int f5396_0(int x) { return x * 0; }
+inline int f5396_1(int x) { return x * 1; }
+inline int f5396_2(int x) { return x * 2; }
+inline int f5396_3(int x) { return x * 3; }
+inline int f5396_4(int x) { return x * 4; }
+inline int f5396_5(int x) { return x * 5; }
+inline int f5396_6(int x) { return x * 6; }
+inline int f5396_7(int x) { return x * 7; }
+inline int f5396_8(int x) { return x * 8; }
+inline int f5396_9(int x) { return x * 9; }
+inline int f5396_10(int x) { return x * 10; }
+inline int f5396_11(int x) { return x * 11; }
+inline int f5396_12(int x) { return x * 12; }
+inline int f5396_13(int x) { return x * 13; }
+inline int f5396_14(int x) { return x * 14; }
+inline int f5396_15(int x) { return x * 15; }
+inline int f5396_16(int x) { return x * 16; }
+inline int f5396_17(int x) { return x * 17; }
+inline int f5396_18(int x) { return x * 18; }
+inline int f5396_19(int x) { return x * 19; }
+inline int f5396_20(int x) { return x * 20; }
+inline int f5396_21(int x) { return x * 21; }
+inline int f5396_22(int x) { return x * 22; }
+inline int f5396_23(int x) { return x * 23; }
+inline int f5396_24(int x) { return x * 24; }
+inline int f5396_25(int x) { return x * 25; }
+inline int f5396_26(int x) { return x * 26; }
+inline int f5396_27(int x) { return x * 27; }
+inline int f5396_28(int x) { return x * 28; }
+inline int f5396_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5398 */
+#include <vector>
+#include "h3799.h"
+#include "h1162.h"
+#include "h7361.h"
+#include "h8549.h"
+#include "h7215.h"
+#ifdef X
+#include "h9586.h"
+#endif
+struct S5398 { int a; const char *s = "x//y"; };
+inline int f5398_0(int x) { return x * 0; }
+inline int f5398_1(int x) { return x * 1; }
+inline int f5398_2(int x) { return x * 2; }
+inline int f5398_3(int x) { return x * 3; }
+inline int f5398_4(int x) { return x * 4; }
+inline int f5398_5(int x) { return x * 5; }
+inline int f5398_6(int x) { return x * 6; }
+inline int f5398_7(int x) { return x * 7; }
+inline int f5398_8(int x) { return x * 8; }
+inline int f5398_9(int x) { return x * 9; }
+inline int f5398_10(int x) { return x * 10; }
+inline int f5398_11(int x) { return x * 11; }
+inline int f5398_12(int x) { return x * 12; }
+inline int f5398_13(int x) { return x * 13; }
+inline int f5398_14(int x) { return x * 14; }
+inline int f5398_15(int x) { return x * 15; }
+inline int f5398_16(int x) { return x * 16; }
+inline int f5398_17(int x) { return x * 17; }
+inline int f5398_18(int x) { return x * 18; }
+inline int f5398_19(int x) { return x * 19; }
+inline int f5398_20(int x) { return x * 20; }
+inline int f5398_21(int x) { return x * 21; }
+inline int f5398_22(int x) { return x * 22; }
+inline int f5398_23(int x) { return x * 23; }
+inline int f5398_24(int x) { return x * 24; }
+inline int f5398_25(int x) { return x * 25; }
+inline int f5398_26(int x) { return x * 26; }
+inline int f5398_27(int x) { return x * 27; }
+inline int f5398_28(int x) { return x * 28; }
+inline int f5398_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5399 */
+#include <vector>
+#include "h3279.h"
+#include "h3331.h"
+#include "h4003.h"
+#include "h9806.h"
+#include "h3872.h"
+#ifdef X
+#include "h4697.h"
+#endif
+struct S5399 { int a; const char *s = "x//y"; };
+inline int f5399_0(int x) { return x * 0; }
+inline int f5399_1(int x) { return x * 1; }
+inline int f5399_2(int x) { return x * 2; }
+inline int f5399_3(int x) { return x * 3; }
+inline int f5399_4(int x) { return x * 4; }
+inline int f5399_5(int x) { return x * 5; }
+inline int f5399_6(int x) { return x * 6; }
+inline int f5399_7(int x) { return x * 7; }
+inline int f5399_8(int x) { return x * 8; }
+inline int f5399_9(int x) { return x * 9; }
+inline int f5399_10(int x) { return x * 10; }
+inline int f5399_11(int x) { return x * 11; }
+inline int f5399_12(int x) { return x * 12; }
+inline int f5399_13(int x) { return x * 13; }
+inline int f5399_14(int x) { return x * 14; }
+inline int f5399_15(int x) { return x * 15; }
+inline int f5399_16(int x) { return x * 16; }
+inline int f5399_17(int x) { return x * 17; }
+inline int f5399_18(int x) { return x * 18; }
+inline int f5399_19(int x) { return x * 19; }
+inline int f5399_20(int x) { return x * 20; }
+inline int f5399_21(int x) { return x * 21; }
+inline int f5399_22(int x) { return x * 22; }
+inline int f5399_23(int x) { return x * 23; }
+inline int f5399_24(int x) { return x * 24; }
+inline int f5399_25(int x) { return x * 25; }
+inline int f5399_26(int x) { return x * 26; }
+inline int f5399_27(int x) { return x * 27; }
+inline int f5399_28(int x) { return x * 28; }
+inline int f5399_29(int x) { return x * 29; }
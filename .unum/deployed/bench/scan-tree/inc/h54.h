@@ -0,0 +1,42 @@
+#pragma once
+/* header 54 */
+#include <vector>
+#include "h4486.h"
+#include "h6669.h"
+#include "h1406.h"
+#include "h1007.h"
+#include "h6303.h"
+#ifdef X
+#include "h3331.h"
+#endif
+struct S54 { int a; const char *s = "x//y"; };
+inline int f54_0(int x) { return x * 0; }
+inline int f54_1(int x) { return x * 1; }
+inline int f54_2(int x) { return x * 2; }
+inline int f54_3(int x) { return x * 3; }
+inline int f54_4(int x) { return x * 4; }
+inline int f54_5(int x) { return x * 5; }
+inline int f54_6(int x) { return x * 6; }
+inline int f54_7(int x) { return x * 7; }
+inline int f54_8(int x) { return x * 8; }
+inline int f54_9(int x) { return x * 9; }
+inline int f54_10(int x) { return x * 10; }
+inline int f54_11(int x) { return x * 11; }
+inline int f54_12(int x) { return x * 12; }
+inline int f54_13(int x) { return x * 13; }
+inline int f54_14(int x) { return x * 14; }
+inline int f54_15(int x) { return x * 15; }
+inline int f54_16(int x) { return x * 16; }
+inline int f54_17(int x) { return x * 17; }
+inline int f54_18(int x) { return x * 18; }
+inline int f54_19(int x) { return x * 19; }
+inline int f54_20(int x) { return x * 20; }
+inline int f54_21(int x) { return x * 21; }
+inline int f54_22(int x) { return x * 22; }
+inline int f54_23(int x) { return x * 23; }
+inline int f54_24(int x) { return x * 24; }
+inline int f54_25(int x) { return x * 25; }
+inline int f54_26(int x) { return x * 26; }
+inline int f54_27(int x) { return x * 27; }
+inline int f54_28(int x) { return x * 28; }
+inline int f54_29(int x) { return x * 29; }
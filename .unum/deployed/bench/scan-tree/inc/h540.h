@@ -0,0 +1,42 @@
+#pragma once
+/* header 540 */
+#include <vector>
+#include "h4531.h"
+#include "h2101.h"
+#include "h2217.h"
+#include "h3421.h"
+#include "h8668.h"
+#ifdef X
+#include "h375.h"
+#endif
+struct S540 { int a; const char *s = "x//y"; };
+inline int f540_0(int x) { return x * 0; }
+inline int f540_1(int x) { return x * 1; }
+inline int f540_2(int x) { return x * 2; }
+inline int f540_3(int x) { return x * 3; }
+inline int f540_4(int x) { return x * 4; }
+inline int f540_5(int x) { return x * 5; }
+inline int f540_6(int x) { return x * 6; }
+inline int f540_7(int x) { return x * 7; }
+inline int f540_8(int x) { return x * 8; }
+inline int f540_9(int x) { return x * 9; }
+inline int f540_10(int x) { return x * 10; }
+inline int f540_11(int x) { return x * 11; }
+inline int f540_12(int x) { return x * 12; }
+inline int f540_13(int x) { return x * 13; }
+inline int f540_14(int x) { return x * 14; }
+inline int f540_15(int x) { return x * 15; }
+inline int f540_16(int x) { return x * 16; }
+inline int f540_17(int x) { return x * 17; }
+inline int f540_18(int x) { return x * 18; }
+inline int f540_19(int x) { return x * 19; }
+inline int f540_20(int x) { return x * 20; }
+inline int f540_21(int x) { return x * 21; }
+inline int f540_22(int x) { return x * 22; }
+inline int f540_23(int x) { return x * 23; }
+inline int f540_24(int x) { return x * 24; }
+inline int f540_25(int x) { return x * 25; }
+inline int f540_26(int x) { return x * 26; }
+inline int f540_27(int x) { return x * 27; }
+inline int f540_28(int x) { return x * 28; }
+inline int f540_29(int x) { return x * 29; }
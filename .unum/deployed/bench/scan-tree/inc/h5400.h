@@ -0,0 +1,42 @@
+#pragma once
+/* header 5400 */
+#include <vector>
+#include "h1741.h"
+#include "h7230.h"
+#include "h6259.h"
+#include "h6490.h"
+#include "h7622.h"
+#ifdef X
+#include "h7950.h"
+#endif
+struct S5400 { int a; const char *s = "x//y"; };
+inline int f5400_0(int x) { return x * 0; }
+inline int f5400_1(int x) { return x * 1; }
+inline int f5400_2(int x) { return x * 2; }
+inline int f5400_3(int x) { return x * 3; }
+inline int f5400_4(int x) { return x * 4; }
+inline int f5400_5(int x) { return x * 5; }
+inline int f5400_6(int x) { return x * 6; }
+inline int f5400_7(int x) { return x * 7; }
+inline int f5400_8(int x) { return x * 8; }
+inline int f5400_9(int x) { return x * 9; }
+inline int f5400_10(int x) { return x * 10; }
+inline int f5400_11(int x) { return x * 11; }
+inline int f5400_12(int x) { return x * 12; }
+inline int f5400_13(int x) { return x * 13; }
+inline int f5400_14(int x) { return x * 14; }
+inline int f5400_15(int x) { return x * 15; }
+inline int f5400_16(int x) { return x * 16; }
+inline int f5400_17(int x) { return x * 17; }
+inline int f5400_18(int x) { return x * 18; }
+inline int f5400_19(int x) { return x * 19; }
+inline int f5400_20(int x) { return x * 20; }
+inline int f5400_21(int x) { return x * 21; }
+inline int f5400_22(int x) { return x * 22; }
+inline int f5400_23(int x) { return x * 23; }
+inline int f5400_24(int x) { return x * 24; }
+inline int f5400_25(int x) { return x * 25; }
+inline int f5400_26(int x) { return x * 26; }
+inline int f5400_27(int x) { return x * 27; }
+inline int f5400_28(int x) { return x * 28; }
+inline int f5400_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5404 */
+#include <vector>
+#include "h5007.h"
+#include "h6587.h"
+#include "h3960.h"
+#include "h3457.h"
+#include "h4007.h"
+#ifdef X
+#include "h9826.h"
+#endif
+struct S5404 { int a; const char *s = "x//y"; };
+inline int f5404_0(int x) { return x * 0; }
+inline int f5404_1(int x) { return x * 1; }
+inline int f5404_2(int x) { return x * 2; }
+inline int f5404_3(int x) { return x * 3; }
+inline int f5404_4(int x) { return x * 4; }
+inline int f5404_5(int x) { return x * 5; }
+inline int f5404_6(int x) { return x * 6; }
+inline int f5404_7(int x) { return x * 7; }
+inline int f5404_8(int x) { return x * 8; }
+inline int f5404_9(int x) { return x * 9; }
+inline int f5404_10(int x) { return x * 10; }
+inline int f5404_11(int x) { return x * 11; }
+inline int f5404_12(int x) { return x * 12; }
+inline int f5404_13(int x) { return x * 13; }
+inline int f5404_14(int x) { return x * 14; }
+inline int f5404_15(int x) { return x * 15; }
+inline int f5404_16(int x) { return x * 16; }
+inline int f5404_17(int x) { return x * 17; }
+inline int f5404_18(int x) { return x * 18; }
+inline int f5404_19(int x) { return x * 19; }
+inline int f5404_20(int x) { return x * 20; }
+inline int f5404_21(int x) { return x * 21; }
+inline int f5404_22(int x) { return x * 22; }
+inline int f5404_23(int x) { return x * 23; }
+inline int f5404_24(int x) { return x * 24; }
+inline int f5404_25(int x) { return x * 25; }
+inline int f5404_26(int x) { return x * 26; }
+inline int f5404_27(int x) { return x * 27; }
+inline int f5404_28(int x) { return x * 28; }
+inline int f5404_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5405 */
+#include <vector>
+#include "h1104.h"
+#include "h524.h"
+#include "h2083.h"
+#include "h8346.h"
+#include "h723.h"
+#ifdef X
+#include "h7675.h"
+#endif
+struct S5405 { int a; const char *s = "x//y"; };
+inline int f5405_0(int x) { return x * 0; }
+inline int f5405_1(int x) { return x * 1; }
+inline int f5405_2(int x) { return x * 2; }
+inline int f5405_3(int x) { return x * 3; }
+inline int f5405_4(int x) { return x * 4; }
+inline int f5405_5(int x) { return x * 5; }
+inline int f5405_6(int x) { return x * 6; }
+inline int f5405_7(int x) { return x * 7; }
+inline int f5405_8(int x) { return x * 8; }
+inline int f5405_9(int x) { return x * 9; }
+inline int f5405_10(int x) { return x * 10; }
+inline int f5405_11(int x) { return x * 11; }
+inline int f5405_12(int x) { return x * 12; }
+inline int f5405_13(int x) { return x * 13; }
+inline int f5405_14(int x) { return x * 14; }
+inline int f5405_15(int x) { return x * 15; }
+inline int f5405_16(int x) { return x * 16; }
+inline int f5405_17(int x) { return x * 17; }
+inline int f5405_18(int x) { return x * 18; }
+inline int f5405_19(int x) { return x * 19; }
+inline int f5405_20(int x) { return x * 20; }
+inline int f5405_21(int x) { return x * 21; }
+inline int f5405_22(int x) { return x * 22; }
+inline int f5405_23(int x) { return x * 23; }
+inline int f5405_24(int x) { return x * 24; }
+inline int f5405_25(int x) { return x * 25; }
+inline int f5405_26(int x) { return x * 26; }
+inline int f5405_27(int x) { return x * 27; }
+inline int f5405_28(int x) { return x * 28; }
+inline int f5405_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5408 */
+#include <vector>
+#include "h4433.h"
+#include "h3847.h"
+#include "h5151.h"
+#include "h3380.h"
+#include "h6427.h"
+#ifdef X
+#include "h8176.h"
+#endif
+struct S5408 { int a; const char *s = "x//y"; };
+inline int f5408_0(int x) { return x * 0; }
+inline int f5408_1(int x) { return x * 1; }
+inline int f5408_2(int x) { return x * 2; }
+inline int f5408_3(int x) { return x * 3; }
+inline int f5408_4(int x) { return x * 4; }
+inline int f5408_5(int x) { return x * 5; }
+inline int f5408_6(int x) { return x * 6; }
+inline int f5408_7(int x) { return x * 7; }
+inline int f5408_8(int x) { return x * 8; }
+inline int f5408_9(int x) { return x * 9; }
+inline int f5408_10(int x) { return x * 10; }
+inline int f5408_11(int x) { return x * 11; }
+inline int f5408_12(int x) { return x * 12; }
+inline int f5408_13(int x) { return x * 13; }
+inline int f5408_14(int x) { return x * 14; }
+inline int f5408_15(int x) { return x * 15; }
+inline int f5408_16(int x) { return x * 16; }
+inline int f5408_17(int x) { return x * 17; }
+inline int f5408_18(int x) { return x * 18; }
+inline int f5408_19(int x) { return x * 19; }
+inline int f5408_20(int x) { return x * 20; }
+inline int f5408_21(int x) { return x * 21; }
+inline int f5408_22(int x) { return x * 22; }
+inline int f5408_23(int x) { return x * 23; }
+inline int f5408_24(int x) { return x * 24; }
+inline int f5408_25(int x) { return x * 25; }
+inline int f5408_26(int x) { return x * 26; }
+inline int f5408_27(int x) { return x * 27; }
+inline int f5408_28(int x) { return x * 28; }
+inline int f5408_29(int x) { return x * 29; }
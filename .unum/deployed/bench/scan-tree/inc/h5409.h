@@ -0,0 +1,42 @@
+#pragma once
+/* header 5409 */
+#include <vector>
+#include "h4999.h"
+#include "h2209.h"
+#include "h5824.h"
+#include "h9312.h"
+#include "h9419.h"
+#ifdef X
+#include "h9634.h"
+#endif
+struct S5409 { int a; const char *s = "x//y"; };
+inline int f5409_0(int x) { return x * 0; }
+inline int f5409_1(int x) { return x * 1; }
+inline int f5409_2(int x) { return x * 2; }
+inline int f5409_3(int x) { return x * 3; }
+inline int f5409_4(int x) { return x * 4; }
+inline int f5409_5(int x) { return x * 5; }
+inline int f5409_6(int x) { return x * 6; }
+inline int f5409_7(int x) { return x * 7; }
+inline int f5409_8(int x) { return x * 8; }
+inline int f5409_9(int x) { return x * 9; }
+inline int f5409_10(int x) { return x * 10; }
+inline int f5409_11(int x) { return x * 11; }
+inline int f5409_12(int x) { return x * 12; }
+inline int f5409_13(int x) { return x * 13; }
+inline int f5409_14(int x) { return x * 14; }
+inline int f5409_15(int x) { return x * 15; }
+inline int f5409_16(int x) { return x * 16; }
+inline int f5409_17(int x) { return x * 17; }
+inline int f5409_18(int x) { return x * 18; }
+inline int f5409_19(int x) { return x * 19; }
+inline int f5409_20(int x) { return x * 20; }
+inline int f5409_21(int x) { return x * 21; }
+inline int f5409_22(int x) { return x * 22; }
+inline int f5409_23(int x) { return x * 23; }
+inline int f5409_24(int x) { return x * 24; }
+inline int f5409_25(int x) { return x * 25; }
+inline int f5409_26(int x) { return x * 26; }
+inline int f5409_27(int x) { return x * 27; }
+inline int f5409_28(int x) { return x * 28; }
+inline int f5409_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5414 */
+#include <vector>
+#include "h4943.h"
+#include "h617.h"
+#include "h8502.h"
+#include "h3210.h"
+#include "h9305.h"
+#ifdef X
+#include "h3755.h"
+#endif
+struct S5414 { int a; const char *s = "x//y"; };
+inline int f5414_0(int x) { return x * 0; }
+inline int f5414_1(int x) { return x * 1; }
+inline int f5414_2(int x) { return x * 2; }
+inline int f5414_3(int x) { return x * 3; }
+inline int f5414_4(int x) { return x * 4; }
+inline int f5414_5(int x) { return x * 5; }
+inline int f5414_6(int x) { return x * 6; }
+inline int f5414_7(int x) { return x * 7; }
+inline int f5414_8(int x) { return x * 8; }
+inline int f5414_9(int x) { return x * 9; }
+inline int f5414_10(int x) { return x * 10; }
+inline int f5414_11(int x) { return x * 11; }
+inline int f5414_12(int x) { return x * 12; }
+inline int f5414_13(int x) { return x * 13; }
+inline int f5414_14(int x) { return x * 14; }
+inline int f5414_15(int x) { return x * 15; }
+inline int f5414_16(int x) { return x * 16; }
+inline int f5414_17(int x) { return x * 17; }
+inline int f5414_18(int x) { return x * 18; }
+inline int f5414_19(int x) { return x * 19; }
+inline int f5414_20(int x) { return x * 20; }
+inline int f5414_21(int x) { return x * 21; }
+inline int f5414_22(int x) { return x * 22; }
+inline int f5414_23(int x) { return x * 23; }
+inline int f5414_24(int x) { return x * 24; }
+inline int f5414_25(int x) { return x * 25; }
+inline int f5414_26(int x) { return x * 26; }
+inline int f5414_27(int x) { return x * 27; }
+inline int f5414_28(int x) { return x * 28; }
+inline int f5414_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5416 */
+#include <vector>
+#include "h8062.h"
+#include "h9451.h"
+#include "h1782.h"
+#include "h6657.h"
+#include "h6635.h"
+#ifdef X
+#include "h3608.h"
+#endif
+struct S5416 { int a; const char *s = "x//y"; };
+inline int f5416_0(int x) { return x * 0; }
+inline int f5416_1(int x) { return x * 1; }
+inline int f5416_2(int x) { return x * 2; }
+inline int f5416_3(int x) { return x * 3; }
+inline int f5416_4(int x) { return x * 4; }
+inline int f5416_5(int x) { return x * 5; }
+inline int f5416_6(int x) { return x * 6; }
+inline int f5416_7(int x) { return x * 7; }
+inline int f5416_8(int x) { return x * 8; }
+inline int f5416_9(int x) { return x * 9; }
+inline int f5416_10(int x) { return x * 10; }
+inline int f5416_11(int x) { return x * 11; }
+inline int f5416_12(int x) { return x * 12; }
+inline int f5416_13(int x) { return x * 13; }
+inline int f5416_14(int x) { return x * 14; }
+inline int f5416_15(int x) { return x * 15; }
+inline int f5416_16(int x) { return x * 16; }
+inline int f5416_17(int x) { return x * 17; }
+inline int f5416_18(int x) { return x * 18; }
+inline int f5416_19(int x) { return x * 19; }
+inline int f5416_20(int x) { return x * 20; }
+inline int f5416_21(int x) { return x * 21; }
+inline int f5416_22(int x) { return x * 22; }
+inline int f5416_23(int x) { return x * 23; }
+inline int f5416_24(int x) { return x * 24; }
+inline int f5416_25(int x) { return x * 25; }
+inline int f5416_26(int x) { return x * 26; }
+inline int f5416_27(int x) { return x * 27; }
+inline int f5416_28(int x) { return x * 28; }
+inline int f5416_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5417 */
+#include <vector>
+#include "h1967.h"
+#include "h8922.h"
+#include "h8756.h"
+#include "h8450.h"
+#include "h2199.h"
+#ifdef X
+#include "h5078.h"
+#endif
+struct S5417 { int a; const char *s = "x//y"; };
+inline int f5417_0(int x) { return x * 0; }
+inline int f5417_1(int x) { return x * 1; }
+inline int f5417_2(int x) { return x * 2; }
+inline int f5417_3(int x) { return x * 3; }
+inline int f5417_4(int x) { return x * 4; }
+inline int f5417_5(int x) { return x * 5; }
+inline int f5417_6(int x) { return x * 6; }
+inline int f5417_7(int x) { return x * 7; }
+inline int f5417_8(int x) { return x * 8; }
+inline int f5417_9(int x) { return x * 9; }
+inline int f5417_10(int x) { return x * 10; }
+inline int f5417_11(int x) { return x * 11; }
+inline int f5417_12(int x) { return x * 12; }
+inline int f5417_13(int x) { return x * 13; }
+inline int f5417_14(int x) { return x * 14; }
+inline int f5417_15(int x) { return x * 15; }
+inline int f5417_16(int x) { return x * 16; }
+inline int f5417_17(int x) { return x * 17; }
+inline int f5417_18(int x) { return x * 18; }
+inline int f5417_19(int x) { return x * 19; }
+inline int f5417_20(int x) { return x * 20; }
+inline int f5417_21(int x) { return x * 21; }
+inline int f5417_22(int x) { return x * 22; }
+inline int f5417_23(int x) { return x * 23; }
+inline int f5417_24(int x) { return x * 24; }
+inline int f5417_25(int x) { return x * 25; }
+inline int f5417_26(int x) { return x * 26; }
+inline int f5417_27(int x) { return x * 27; }
+inline int f5417_28(int x) { return x * 28; }
+inline int f5417_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5418 */
+#include <vector>
+#include "h2120.h"
+#include "h370.h"
+#include "h2638.h"
+#include "h346.h"
+#include "h5250.h"
+#ifdef X
+#include "h8231.h"
+#endif
+struct S5418 { int a; const char *s = "x//y"; };
+inline int f5418_0(int x) { return x * 0; }
+inline int f5418_1(int x) { return x * 1; }
+inline int f5418_2(int x) { return x * 2; }
+inline int f5418_3(int x) { return x * 3; }
+inline int f5418_4(int x) { return x * 4; }
+inline int f5418_5(int x) { return x * 5; }
+inline int f5418_6(int x) { return x * 6; }
+inline int f5418_7(int x) { return x * 7; }
+inline int f5418_8(int x) { return x * 8; }
+inline int f5418_9(int x) { return x * 9; }
+inline int f5418_10(int x) { return x * 10; }
+inline int f5418_11(int x) { return x * 11; }
+inline int f5418_12(int x) { return x * 12; }
+inline int f5418_13(int x) { return x * 13; }
+inline int f5418_14(int x) { return x * 14; }
+inline int f5418_15(int x) { return x * 15; }
+inline int f5418_16(int x) { return x * 16; }
+inline int f5418_17(int x) { return x * 17; }
+inline int f5418_18(int x) { return x * 18; }
+inline int f5418_19(int x) { return x * 19; }
+inline int f5418_20(int x) { return x * 20; }
+inline int f5418_21(int x) { return x * 21; }
+inline int f5418_22(int x) { return x * 22; }
+inline int f5418_23(int x) { return x * 23; }
+inline int f5418_24(int x) { return x * 24; }
+inline int f5418_25(int x) { return x * 25; }
+inline int f5418_26(int x) { return x * 26; }
+inline int f5418_27(int x) { return x * 27; }
+inline int f5418_28(int x) { return x * 28; }
+inline int f5418_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5420 */
+#include <vector>
+#include "h1870.h"
+#include "h6070.h"
+#include "h492.h"
+#include "h3101.h"
+#include "h10.h"
+#ifdef X
+#include "h1679.h"
+#endif
+struct S5420 { int a; const char *s = "x//y"; };
+inline int f5420_0(int x) { return x * 0; }
+inline int f5420_1(int x) { return x * 1; }
+inline int f5420_2(int x) { return x * 2; }
+inline int f5420_3(int x) { return x * 3; }
+inline int f5420_4(int x) { return x * 4; }
+inline int f5420_5(int x) { return x * 5; }
+inline int f5420_6(int x) { return x * 6; }
+inline int f5420_7(int x) { return x * 7; }
+inline int f5420_8(int x) { return x * 8; }
+inline int f5420_9(int x) { return x * 9; }
+inline int f5420_10(int x) { return x * 10; }
+inline int f5420_11(int x) { return x * 11; }
+inline int f5420_12(int x) { return x * 12; }
+inline int f5420_13(int x) { return x * 13; }
+inline int f5420_14(int x) { return x * 14; }
+inline int f5420_15(int x) { return x * 15; }
+inline int f5420_16(int x) { return x * 16; }
+inline int f5420_17(int x) { return x * 17; }
+inline int f5420_18(int x) { return x * 18; }
+inline int f5420_19(int x) { return x * 19; }
+inline int f5420_20(int x) { return x * 20; }
+inline int f5420_21(int x) { return x * 21; }
+inline int f5420_22(int x) { return x * 22; }
+inline int f5420_23(int x) { return x * 23; }
+inline int f5420_24(int x) { return x * 24; }
+inline int f5420_25(int x) { return x * 25; }
+inline int f5420_26(int x) { return x * 26; }
+inline int f5420_27(int x) { return x * 27; }
+inline int f5420_28(int x) { return x * 28; }
+inline int f5420_29(int x) { return x * 29; }
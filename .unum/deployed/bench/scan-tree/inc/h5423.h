@@ -0,0 +1,42 @@
+#pragma once
+/* header 5423 */
+#include <vector>
+#include "h6872.h"
+#include "h8873.h"
+#include "h8209.h"
+#include "h1485.h"
+#include "h8987.h"
+#ifdef X
+#include "h9138.h"
+#endif
+struct S5423 { int a; const char *s = "x//y"; };
+inline int f5423_0(int x) { return x * 0; }
+inline int f5423_1(int x) { return x * 1; }
+inline int f5423_2(int x) { return x * 2; }
+inline int f5423_3(int x) { return x * 3; }
+inline int f5423_4(int x) { return x * 4; }
+inline int f5423_5(int x) { return x * 5; }
+inline int f5423_6(int x) { return x * 6; }
+inline int f5423_7(int x) { return x * 7; }
+inline int f5423_8(int x) { return x * 8; }
+inline int f5423_9(int x) { return x * 9; }
+inline int f5423_10(int x) { return x * 10; }
+inline int f5423_11(int x) { return x * 11; }
+inline int f5423_12(int x) { return x * 12; }
+inline int f5423_13(int x) { return x * 13; }
+inline int f5423_14(int x) { return x * 14; }
+inline int f5423_15(int x) { return x * 15; }
+inline int f5423_16(int x) { return x * 16; }
+inline int f5423_17(int x) { return x * 17; }
+inline int f5423_18(int x) { return x * 18; }
+inline int f5423_19(int x) { return x * 19; }
+inline int f5423_20(int x) { return x * 20; }
+inline int f5423_21(int x) { return x * 21; }
+inline int f5423_22(int x) { return x * 22; }
+inline int f5423_23(int x) { return x * 23; }
+inline int f5423_24(int x) { return x * 24; }
+inline int f5423_25(int x) { return x * 25; }
+inline int f5423_26(int x) { return x * 26; }
+inline int f5423_27(int x) { return x * 27; }
+inline int f5423_28(int x) { return x * 28; }
+inline int f5423_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5424 */
+#include <vector>
+#include "h6772.h"
+#include "h990.h"
+#include "h1161.h"
+#include "h2761.h"
+#include "h5732.h"
+#ifdef X
+#include "h5245.h"
+#endif
+struct S5424 { int a; const char *s = "x//y"; };
+inline int f5424_0(int x) { return x * 0; }
+inline int f5424_1(int x) { return x * 1; }
+inline int f5424_2(int x) { return x * 2; }
+inline int f5424_3(int x) { return x * 3; }
+inline int f5424_4(int x) { return x * 4; }
+inline int f5424_5(int x) { return x * 5; }
+inline int f5424_6(int x) { return x * 6; }
+inline int f5424_7(int x) { return x * 7; }
+inline int f5424_8(int x) { return x * 8; }
+inline int f5424_9(int x) { return x * 9; }
+inline int f5424_10(int x) { return x * 10; }
+inline int f5424_11(int x) { return x * 11; }
+inline int f5424_12(int x) { return x * 12; }
+inline int f5424_13(int x) { return x * 13; }
+inline int f5424_14(int x) { return x * 14; }
+inline int f5424_15(int x) { return x * 15; }
+inline int f5424_16(int x) { return x * 16; }
+inline int f5424_17(int x) { return x * 17; }
+inline int f5424_18(int x) { return x * 18; }
+inline int f5424_19(int x) { return x * 19; }
+inline int f5424_20(int x) { return x * 20; }
+inline int f5424_21(int x) { return x * 21; }
+inline int f5424_22(int x) { return x * 22; }
+inline int f5424_23(int x) { return x * 23; }
+inline int f5424_24(int x) { return x * 24; }
+inline int f5424_25(int x) { return x * 25; }
+inline int f5424_26(int x) { return x * 26; }
+inline int f5424_27(int x) { return x * 27; }
+inline int f5424_28(int x) { return x * 28; }
+inline int f5424_29(int x) { return x * 29; }
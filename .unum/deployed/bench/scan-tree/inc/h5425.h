@@ -0,0 +1,42 @@
+#pragma once
+/* header 5425 */
+#include <vector>
+#include "h8343.h"
+#include "h8548.h"
+#include "h9076.h"
+#include "h4170.h"
+#include "h3549.h"
+#ifdef X
+#include "h4088.h"
+#endif
+struct S5425 { int a; const char *s = "x//y"; };
+inline int f5425_0(int x) { return x * 0; }
+inline int f5425_1(int x) { return x * 1; }
+inline int f5425_2(int x) { return x * 2; }
+inline int f5425_3(int x) { return x * 3; }
+inline int f5425_4(int x) { return x * 4; }
+inline int f5425_5(int x) { return x * 5; }
+inline int f5425_6(int x) { return x * 6; }
+inline int f5425_7(int x) { return x * 7; }
+inline int f5425_8(int x) { return x * 8; }
+inline int f5425_9(int x) { return x * 9; }
+inline int f5425_10(int x) { return x * 10; }
+inline int f5425_11(int x) { return x * 11; }
+inline int f5425_12(int x) { return x * 12; }
+inline int f5425_13(int x) { return x * 13; }
+inline int f5425_14(int x) { return x * 14; }
+inline int f5425_15(int x) { return x * 15; }
+inline int f5425_16(int x) { return x * 16; }
+inline int f5425_17(int x) { return x * 17; }
+inline int f5425_18(int x) { return x * 18; }
+inline int f5425_19(int x) { return x * 19; }
+inline int f5425_20(int x) { return x * 20; }
+inline int f5425_21(int x) { return x * 21; }
+inline int f5425_22(int x) { return x * 22; }
+inline int f5425_23(int x) { return x * 23; }
+inline int f5425_24(int x) { return x * 24; }
+inline int f5425_25(int x) { return x * 25; }
+inline int f5425_26(int x) { return x * 26; }
+inline int f5425_27(int x) { return x * 27; }
+inline int f5425_28(int x) { return x * 28; }
+inline int f5425_29(int x) { return x * 29; }
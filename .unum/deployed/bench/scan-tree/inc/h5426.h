@@ -0,0 +1,42 @@
+#pragma once
+/* header 5426 */
+#include <vector>
+#include "h8360.h"
+#include "h8083.h"
+#include "h3073.h"
+#include "h5885.h"
+#include "h8786.h"
+#ifdef X
+#include "h4583.h"
+#endif
+struct S5426 { int a; const char *s = "x//y"; };
+inline int f5426_0(int x) { return x * 0; }
+inline int f5426_1(int x) { return x * 1; }
+inline int f5426_2(int x) { return x * 2; }
+inline int f5426_3(int x) { return x * 3; }
+inline int f5426_4(int x) { return x * 4; }
+inline int f5426_5(int x) { return x * 5; }
+inline int f5426_6(int x) { return x * 6; }
+inline int f5426_7(int x) { return x * 7; }
+inline int f5426_8(int x) { return x * 8; }
+inline int f5426_9(int x) { return x * 9; }
+inline int f5426_10(int x) { return x * 10; }
+inline int f5426_11(int x) { return x * 11; }
+inline int f5426_12(int x) { return x * 12; }
+inline int f5426_13(int x) { return x * 13; }
+inline int f5426_14(int x) { return x * 14; }
+inline int f5426_15(int x) { return x * 15; }
+inline int f5426_16(int x) { return x * 16; }
+inline int f5426_17(int x) { return x * 17; }
+inline int f5426_18(int x) { return x * 18; }
+inline int f5426_19(int x) { return x * 19; }
+inline int f5426_20(int x) { return x * 20; }
+inline int f5426_21(int x) { return x * 21; }
+inline int f5426_22(int x) { return x * 22; }
+inline int f5426_23(int x) { return x * 23; }
+inline int f5426_24(int x) { return x * 24; }
+inline int f5426_25(int x) { return x * 25; }
+inline int f5426_26(int x) { return x * 26; }
+inline int f5426_27(int x) { return x * 27; }
+inline int f5426_28(int x) { return x * 28; }
+inline int f5426_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5427 */
+#include <vector>
+#include "h5859.h"
+#include "h8241.h"
+#include "h7401.h"
+#include "h6618.h"
+#include "h5145.h"
+#ifdef X
+#include "h6644.h"
+#endif
+struct S5427 { int a; const char *s = "x//y"; };
+inline int f5427_0(int x) { return x * 0; }
+inline int f5427_1(int x) { return x * 1; }
+inline int f5427_2(int x) { return x * 2; }
+inline int f5427_3(int x) { return x * 3; }
+inline int f5427_4(int x) { return x * 4; }
+inline int f5427_5(int x) { return x * 5; }
+inline int f5427_6(int x) { return x * 6; }
+inline int f5427_7(int x) { return x * 7; }
+inline int f5427_8(int x) { return x * 8; }
+inline int f5427_9(int x) { return x * 9; }
+inline int f5427_10(int x) { return x * 10; }
+inline int f5427_11(int x) { return x * 11; }
+inline int f5427_12(int x) { return x * 12; }
+inline int f5427_13(int x) { return x * 13; }
+inline int f5427_14(int x) { return x * 14; }
+inline int f5427_15(int x) { return x * 15; }
+inline int f5427_16(int x) { return x * 16; }
+inline int f5427_17(int x) { return x * 17; }
+inline int f5427_18(int x) { return x * 18; }
+inline int f5427_19(int x) { return x * 19; }
+inline int f5427_20(int x) { return x * 20; }
+inline int f5427_21(int x) { return x * 21; }
+inline int f5427_22(int x) { return x * 22; }
+inline int f5427_23(int x) { return x * 23; }
+inline int f5427_24(int x) { return x * 24; }
+inline int f5427_25(int x) { return x * 25; }
+inline int f5427_26(int x) { return x * 26; }
+inline int f5427_27(int x) { return x * 27; }
+inline int f5427_28(int x) { return x * 28; }
+inline int f5427_29(int x) { return x * 29; }
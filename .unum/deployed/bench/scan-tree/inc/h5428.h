@@ -0,0 +1,42 @@
+#pragma once
+/* header 5428 */
+#include <vector>
+#include "h1508.h"
+#include "h4671.h"
+#include "h8257.h"
+#include "h3374.h"
+#include "h9334.h"
+#ifdef X
+#include "h9149.h"
+#endif
+struct S5428 { int a; const char *s = "x//y"; };
+inline int f5428_0(int x) { return x * 0; }
+inline int f5428_1(int x) { return x * 1; }
+inline int f5428_2(int x) { return x * 2; }
+inline int f5428_3(int x) { return x * 3; }
+inline int f5428_4(int x) { return x * 4; }
+inline int f5428_5(int x) { return x * 5; }
+inline int f5428_6(int x) { return x * 6; }
+inline int f5428_7(int x) { return x * 7; }
+inline int f5428_8(int x) { return x * 8; }
+inline int f5428_9(int x) { return x * 9; }
+inline int f5428_10(int x) { return x * 10; }
+inline int f5428_11(int x) { return x * 11; }
+inline int f5428_12(int x) { return x * 12; }
+inline int f5428_13(int x) { return x * 13; }
+inline int f5428_14(int x) { return x * 14; }
+inline int f5428_15(int x) { return x * 15; }
+inline int f5428_16(int x) { return x * 16; }
+inline int f5428_17(int x) { return x * 17; }
+inline int f5428_18(int x) { return x * 18; }
+inline int f5428_19(int x) { return x * 19; }
+inline int f5428_20(int x) { return x * 20; }
+inline int f5428_21(int x) { return x * 21; }
+inline int f5428_22(int x) { return x * 22; }
+inline int f5428_23(int x) { return x * 23; }
+inline int f5428_24(int x) { return x * 24; }
+inline int f5428_25(int x) { return x * 25; }
+inline int f5428_26(int x) { return x * 26; }
+inline int f5428_27(int x) { return x * 27; }
+inline int f5428_28(int x) { return x * 28; }
+inline int f5428_29(int x) { return x * 29; }
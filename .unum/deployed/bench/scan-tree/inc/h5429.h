@@ -0,0 +1,42 @@
+#pragma once
+/* header 5429 */
+#include <vector>
+#include "h5228.h"
+#include "h8328.h"
+#include "h4805.h"
+#include "h7832.h"
+#include "h6584.h"
+#ifdef X
+#include "h879.h"
+#endif
+struct S5429 { int a; const char *s = "x//y"; };
+inline int f5429_0(int x) { return x * 0; }
+inline int f5429_1(int x) { return x * 1; }
+inline int f5429_2(int x) { return x * 2; }
+inline int f5429_3(int x) { return x * 3; }
+inline int f5429_4(int x) { return x * 4; }
+inline int f5429_5(int x) { return x * 5; }
+inline int f5429_6(int x) { return x * 6; }
+inline int f5429_7(int x) { return x * 7; }
+inline int f5429_8(int x) { return x * 8; }
+inline int f5429_9(int x) { return x * 9; }
+inline int f5429_10(int x) { return x * 10; }
+inline int f5429_11(int x) { return x * 11; }
+inline int f5429_12(int x) { return x * 12; }
+inline int f5429_13(int x) { return x * 13; }
+inline int f5429_14(int x) { return x * 14; }
+inline int f5429_15(int x) { return x * 15; }
+inline int f5429_16(int x) { return x * 16; }
+inline int f5429_17(int x) { return x * 17; }
+inline int f5429_18(int x) { return x * 18; }
+inline int f5429_19(int x) { return x * 19; }
+inline int f5429_20(int x) { return x * 20; }
+inline int f5429_21(int x) { return x * 21; }
+inline int f5429_22(int x) { return x * 22; }
+inline int f5429_23(int x) { return x * 23; }
+inline int f5429_24(int x) { return x * 24; }
+inline int f5429_25(int x) { return x * 25; }
+inline int f5429_26(int x) { return x * 26; }
+inline int f5429_27(int x) { return x * 27; }
+inline int f5429_28(int x) { return x * 28; }
+inline int f5429_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 543 */
+#include <vector>
+#include "h1428.h"
+#include "h6875.h"
+#include "h4105.h"
+#include "h7713.h"
+#include "h6345.h"
+#ifdef X
+#include "h8266.h"
+#endif
+struct S543 { int a; const char *s = "x//y"; };
+inline int f543_0(int x) { return x * 0; }
+inline int f543_1(int x) { return x * 1; }
+inline int f543_2(int x) { return x * 2; }
+inline int f543_3(int x) { return x * 3; }
+inline int f543_4(int x) { return x * 4; }
+inline int f543_5(int x) { return x * 5; }
+inline int f543_6(int x) { return x * 6; }
+inline int f543_7(int x) { return x * 7; }
+inline int f543_8(int x) { return x * 8; }
+inline int f543_9(int x) { return x * 9; }
+inline int f543_10(int x) { return x * 10; }
+inline int f543_11(int x) { return x * 11; }
+inline int f543_12(int x) { return x * 12; }
+inline int f543_13(int x) { return x * 13; }
+inline int f543_14(int x) { return x * 14; }
+inline int f543_15(int x) { return x * 15; }
+inline int f543_16(int x) { return x * 16; }
+inline int f543_17(int x) { return x * 17; }
+inline int f543_18(int x) { return x * 18; }
+inline int f543_19(int x) { return x * 19; }
+inline int f543_20(int x) { return x * 20; }
+inline int f543_21(int x) { return x * 21; }
+inline int f543_22(int x) { return x * 22; }
+inline int f543_23(int x) { return x * 23; }
+inline int f543_24(int x) { return x * 24; }
+inline int f543_25(int x) { return x * 25; }
+inline int f543_26(int x) { return x * 26; }
+inline int f543_27(int x) { return x * 27; }
+inline int f543_28(int x) { return x * 28; }
+inline int f543_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5430 */
+#include <vector>
+#include "h829.h"
+#include "h1489.h"
+#include "h4117.h"
+#include "h9774.h"
+#include "h5993.h"
+#ifdef X
+#include "h3984.h"
+#endif
+struct S5430 { int a; const char *s = "x//y"; };
+inline int f5430_0(int x) { return x * 0; }
+inline int f5430_1(int x) { return x * 1; }
+inline int f5430_2(int x) { return x * 2; }
+inline int f5430_3(int x) { return x * 3; }
+inline int f5430_4(int x) { return x * 4; }
+inline int f5430_5(int x) { return x * 5; }
+inline int f5430_6(int x) { return x * 6; }
+inline int f5430_7(int x) { return x * 7; }
+inline int f5430_8(int x) { return x * 8; }
+inline int f5430_9(int x) { return x * 9; }
+inline int f5430_10(int x) { return x * 10; }
+inline int f5430_11(int x) { return x * 11; }
+inline int f5430_12(int x) { return x * 12; }
+inline int f5430_13(int x) { return x * 13; }
+inline int f5430_14(int x) { return x * 14; }
+inline int f5430_15(int x) { return x * 15; }
+inline int f5430_16(int x) { return x * 16; }
+inline int f5430_17(int x) { return x * 17; }
+inline int f5430_18(int x) { return x * 18; }
+inline int f5430_19(int x) { return x * 19; }
+inline int f5430_20(int x) { return x * 20; }
+inline int f5430_21(int x) { return x * 21; }
+inline int f5430_22(int x) { return x * 22; }
+inline int f5430_23(int x) { return x * 23; }
+inline int f5430_24(int x) { return x * 24; }
+inline int f5430_25(int x) { return x * 25; }
+inline int f5430_26(int x) { return x * 26; }
+inline int f5430_27(int x) { return x * 27; }
+inline int f5430_28(int x) { return x * 28; }
+inline int f5430_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5434 */
+#include <vector>
+#include "h3506.h"
+#include "h4663.h"
+#include "h7387.h"
+#include "h6366.h"
+#include "h1971.h"
+#ifdef X
+#include "h6729.h"
+#endif
+struct S5434 { int a; const char *s = "x//y"; };
+inline int f5434_0(int x) { return x * 0; }
+inline int f5434_1(int x) { return x * 1; }
+inline int f5434_2(int x) { return x * 2; }
+inline int f5434_3(int x) { return x * 3; }
+inline int f5434_4(int x) { return x * 4; }
+inline int f5434_5(int x) { return x * 5; }
+inline int f5434_6(int x) { return x * 6; }
+inline int f5434_7(int x) { return x * 7; }
+inline int f5434_8(int x) { return x * 8; }
+inline int f5434_9(int x) { return x * 9; }
+inline int f5434_10(int x) { return x * 10; }
+inline int f5434_11(int x) { return x * 11; }
+inline int f5434_12(int x) { return x * 12; }
+inline int f5434_13(int x) { return x * 13; }
+inline int f5434_14(int x) { return x * 14; }
+inline int f5434_15(int x) { return x * 15; }
+inline int f5434_16(int x) { return x * 16; }
+inline int f5434_17(int x) { return x * 17; }
+inline int f5434_18(int x) { return x * 18; }
+inline int f5434_19(int x) { return x * 19; }
+inline int f5434_20(int x) { return x * 20; }
+inline int f5434_21(int x) { return x * 21; }
+inline int f5434_22(int x) { return x * 22; }
+inline int f5434_23(int x) { return x * 23; }
+inline int f5434_24(int x) { return x * 24; }
+inline int f5434_25(int x) { return x * 25; }
+inline int f5434_26(int x) { return x * 26; }
+inline int f5434_27(int x) { return x * 27; }
+inline int f5434_28(int x) { return x * 28; }
+inline int f5434_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5435 */
+#include <vector>
+#include "h1952.h"
+#include "h7212.h"
+#include "h1214.h"
+#include "h4099.h"
+#include "h7995.h"
+#ifdef X
+#include "h5348.h"
+#endif
+struct S5435 { int a; const char *s = "x//y"; };
+inline int f5435_0(int x) { return x * 0; }
+inline int f5435_1(int x) { return x * 1; }
+inline int f5435_2(int x) { return x * 2; }
+inline int f5435_3(int x) { return x * 3; }
+inline int f5435_4(int x) { return x * 4; }
+inline int f5435_5(int x) { return x * 5; }
+inline int f5435_6(int x) { return x * 6; }
+inline int f5435_7(int x) { return x * 7; }
+inline int f5435_8(int x) { return x * 8; }
+inline int f5435_9(int x) { return x * 9; }
+inline int f5435_10(int x) { return x * 10; }
+inline int f5435_11(int x) { return x * 11; }
+inline int f5435_12(int x) { return x * 12; }
+inline int f5435_13(int x) { return x * 13; }
+inline int f5435_14(int x) { return x * 14; }
+inline int f5435_15(int x) { return x * 15; }
+inline int f5435_16(int x) { return x * 16; }
+inline int f5435_17(int x) { return x * 17; }
+inline int f5435_18(int x) { return x * 18; }
+inline int f5435_19(int x) { return x * 19; }
+inline int f5435_20(int x) { return x * 20; }
+inline int f5435_21(int x) { return x * 21; }
+inline int f5435_22(int x) { return x * 22; }
+inline int f5435_23(int x) { return x * 23; }
+inline int f5435_24(int x) { return x * 24; }
+inline int f5435_25(int x) { return x * 25; }
+inline int f5435_26(int x) { return x * 26; }
+inline int f5435_27(int x) { return x * 27; }
+inline int f5435_28(int x) { return x * 28; }
+inline int f5435_29(int x) { return x * 29; }
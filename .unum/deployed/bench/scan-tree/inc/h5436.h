@@ -0,0 +1,42 @@
+#pragma once
+/* header 5436 */
+#include <vector>
+#include "h9032.h"
+#include "h4406.h"
+#include "h175.h"
+#include "h2080.h"
+#include "h9870.h"
+#ifdef X
+#include "h9293.h"
+#endif
+struct S5436 { int a; const char *s = "x//y"; };
+inline int f5436_0(int x) { return x * 0; }
+inline int f5436_1(int x) { return x * 1; }
+inline int f5436_2(int x) { return x * 2; }
+inline int f5436_3(int x) { return x * 3; }
+inline int f5436_4(int x) { return x * 4; }
+inline int f5436_5(int x) { return x * 5; }
+inline int f5436_6(int x) { return x * 6; }
+inline int f5436_7(int x) { return x * 7; }
+inline int f5436_8(int x) { return x * 8; }
+inline int f5436_9(int x) { return x * 9; }
+inline int f5436_10(int x) { return x * 10; }
+inline int f5436_11(int x) { return x * 11; }
+inline int f5436_12(int x) { return x * 12; }
+inline int f5436_13(int x) { return x * 13; }
+inline int f5436_14(int x) { return x * 14; }
+inline int f5436_15(int x) { return x * 15; }
+inline int f5436_16(int x) { return x * 16; }
+inline int f5436_17(int x) { return x * 17; }
+inline int f5436_18(int x) { return x * 18; }
+inline int f5436_19(int x) { return x * 19; }
+inline int f5436_20(int x) { return x * 20; }
+inline int f5436_21(int x) { return x * 21; }
+inline int f5436_22(int x) { return x * 22; }
+inline int f5436_23(int x) { return x * 23; }
+inline int f5436_24(int x) { return x * 24; }
+inline int f5436_25(int x) { return x * 25; }
+inline int f5436_26(int x) { return x * 26; }
+inline int f5436_27(int x) { return x * 27; }
+inline int f5436_28(int x) { return x * 28; }
+inline int f5436_29(int x) { return x * 29; }
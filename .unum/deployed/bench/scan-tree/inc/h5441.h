@@ -0,0 +1,42 @@
+#pragma once
+/* header 5441 */
+#include <vector>
+#include "h3611.h"
+#include "h3392.h"
+#include "h1210.h"
+#include "h1512.h"
+#include "h4602.h"
+#ifdef X
+#include "h5584.h"
+#endif
+struct S5441 { int a; const char *s = "x//y"; };
+inline int f5441_0(int x) { return x * 0; }
+inline int f5441_1(int x) { return x * 1; }
+inline int f5441_2(int x) { return x * 2; }
+inline int f5441_3(int x) { return x * 3; }
+inline int f5441_4(int x) { return x * 4; }
+inline int f5441_5(int x) { return x * 5; }
+inline int f5441_6(int x) { return x * 6; }
+inline int f5441_7(int x) { return x * 7; }
+inline int f5441_8(int x) { return x * 8; }
+inline int f5441_9(int x) { return x * 9; }
+inline int f5441_10(int x) { return x * 10; }
+inline int f5441_11(int x) { return x * 11; }
+inline int f5441_12(int x) { return x * 12; }
+inline int f5441_13(int x) { return x * 13; }
+inline int f5441_14(int x) { return x * 14; }
+inline int f5441_15(int x) { return x * 15; }
+inline int f5441_16(int x) { return x * 16; }
+inline int f5441_17(int x) { return x * 17; }
+inline int f5441_18(int x) { return x * 18; }
+inline int f5441_19(int x) { return x * 19; }
+inline int f5441_20(int x) { return x * 20; }
+inline int f5441_21(int x) { return x * 21; }
+inline int f5441_22(int x) { return x * 22; }
+inline int f5441_23(int x) { return x * 23; }
+inline int f5441_24(int x) { return x * 24; }
+inline int f5441_25(int x) { return x * 25; }
+inline int f5441_26(int x) { return x * 26; }
+inline int f5441_27(int x) { return x * 27; }
+inline int f5441_28(int x) { return x * 28; }
+inline int f5441_29(int x) { return x * 29; }
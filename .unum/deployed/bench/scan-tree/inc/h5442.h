@@ -0,0 +1,42 @@
+#pragma once
+/* header 5442 */
+#include <vector>
+#include "h3639.h"
+#include "h889.h"
+#include "h9065.h"
+#include "h1863.h"
+#include "h5653.h"
+#ifdef X
+#include "h8809.h"
+#endif
+struct S5442 { int a; const char *s = "x//y"; };
+inline int f5442_0(int x) { return x * 0; }
+inline int f5442_1(int x) { return x * 1; }
+inline int f5442_2(int x) { return x * 2; }
+inline int f5442_3(int x) { return x * 3; }
+inline int f5442_4(int x) { return x * 4; }
+inline int f5442_5(int x) { return x * 5; }
+inline int f5442_6(int x) { return x * 6; }
+inline int f5442_7(int x) { return x * 7; }
+inline int f5442_8(int x) { return x * 8; }
+inline int f5442_9(int x) { return x * 9; }
+inline int f5442_10(int x) { return x * 10; }
+inline int f5442_11(int x) { return x * 11; }
+inline int f5442_12(int x) { return x * 12; }
+inline int f5442_13(int x) { return x * 13; }
+inline int f5442_14(int x) { return x * 14; }
+inline int f5442_15(int x) { return x * 15; }
+inline int f5442_16(int x) { return x * 16; }
+inline int f5442_17(int x) { return x * 17; }
+inline int f5442_18(int x) { return x * 18; }
+inline int f5442_19(int x) { return x * 19; }
+inline int f5442_20(int x) { return x * 20; }
+inline int f5442_21(int x) { return x * 21; }
+inline int f5442_22(int x) { return x * 22; }
+inline int f5442_23(int x) { return x * 23; }
+inline int f5442_24(int x) { return x * 24; }
+inline int f5442_25(int x) { return x * 25; }
+inline int f5442_26(int x) { return x * 26; }
+inline int f5442_27(int x) { return x * 27; }
+inline int f5442_28(int x) { return x * 28; }
+inline int f5442_29(int x) { return x * 29; }
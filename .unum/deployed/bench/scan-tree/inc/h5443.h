@@ -0,0 +1,42 @@
+#pragma once
+/* header 5443 */
+#include <vector>
+#include "h1558.h"
+#include "h2111.h"
+#include "h8184.h"
+#include "h6234.h"
+#include "h4188.h"
+#ifdef X
+#include "h6432.h"
+#endif
+struct S5443 { int a; const char *s = "x//y"; };
+inline int f5443_0(int x) { return x * 0; }
+inline int f5443_1(int x) { return x * 1; }
+inline int f5443_2(int x) { return x * 2; }
+inline int f5443_3(int x) { return x * 3; }
+inline int f5443_4(int x) { return x * 4; }
+inline int f5443_5(int x) { return x * 5; }
+inline int f5443_6(int x) { return x * 6; }
+inline int f5443_7(int x) { return x * 7; }
+inline int f5443_8(int x) { return x * 8; }
+inline int f5443_9(int x) { return x * 9; }
+inline int f5443_10(int x) { return x * 10; }
+inline int f5443_11(int x) { return x * 11; }
+inline int f5443_12(int x) { return x * 12; }
+inline int f5443_13(int x) { return x * 13; }
+inline int f5443_14(int x) { return x * 14; }
+inline int f5443_15(int x) { return x * 15; }
+inline int f5443_16(int x) { return x * 16; }
+inline int f5443_17(int x) { return x * 17; }
+inline int f5443_18(int x) { return x * 18; }
+inline int f5443_19(int x) { return x * 19; }
+inline int f5443_20(int x) { return x * 20; }
+inline int f5443_21(int x) { return x * 21; }
+inline int f5443_22(int x) { return x * 22; }
+inline int f5443_23(int x) { return x * 23; }
+inline int f5443_24(int x) { return x * 24; }
+inline int f5443_25(int x) { return x * 25; }
+inline int f5443_26(int x) { return x * 26; }
+inline int f5443_27(int x) { return x * 27; }
+inline int f5443_28(int x) { return x * 28; }
+inline int f5443_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5444 */
+#include <vector>
+#include "h6149.h"
+#include "h9563.h"
+#include "h7882.h"
+#include "h8028.h"
+#include "h343.h"
+#ifdef X
+#include "h3730.h"
+#endif
+struct S5444 { int a; const char *s = "x//y"; };
+inline int f5444_0(int x) { return x * 0; }
+inline int f5444_1(int x) { return x * 1; }
+inline int f5444_2(int x) { return x * 2; }
+inline int f5444_3(int x) { return x * 3; }
+inline int f5444_4(int x) { return x * 4; }
+inline int f5444_5(int x) { return x * 5; }
+inline int f5444_6(int x) { return x * 6; }
+inline int f5444_7(int x) { return x * 7; }
+inline int f5444_8(int x) { return x * 8; }
+inline int f5444_9(int x) { return x * 9; }
+inline int f5444_10(int x) { return x * 10; }
+inline int f5444_11(int x) { return x * 11; }
+inline int f5444_12(int x) { return x * 12; }
+inline int f5444_13(int x) { return x * 13; }
+inline int f5444_14(int x) { return x * 14; }
+inline int f5444_15(int x) { return x * 15; }
+inline int f5444_16(int x) { return x * 16; }
+inline int f5444_17(int x) { return x * 17; }
+inline int f5444_18(int x) { return x * 18; }
+inline int f5444_19(int x) { return x * 19; }
+inline int f5444_20(int x) { return x * 20; }
+inline int f5444_21(int x) { return x * 21; }
+inline int f5444_22(int x) { return x * 22; }
+inline int f5444_23(int x) { return x * 23; }
+inline int f5444_24(int x) { return x * 24; }
+inline int f5444_25(int x) { return x * 25; }
+inline int f5444_26(int x) { return x * 26; }
+inline int f5444_27(int x) { return x * 27; }
+inline int f5444_28(int x) { return x * 28; }
+inline int f5444_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5445 */
+#include <vector>
+#include "h5584.h"
+#include "h4634.h"
+#include "h1985.h"
+#include "h5480.h"
+#include "h1375.h"
+#ifdef X
+#include "h5117.h"
+#endif
+struct S5445 { int a; const char *s = "x//y"; };
+inline int f5445_0(int x) { return x * 0; }
+inline int f5445_1(int x) { return x * 1; }
+inline int f5445_2(int x) { return x * 2; }
+inline int f5445_3(int x) { return x * 3; }
+inline int f5445_4(int x) { return x * 4; }
+inline int f5445_5(int x) { return x * 5; }
+inline int f5445_6(int x) { return x * 6; }
+inline int f5445_7(int x) { return x * 7; }
+inline int f5445_8(int x) { return x * 8; }
+inline int f5445_9(int x) { return x * 9; }
+inline int f5445_10(int x) { return x * 10; }
+inline int f5445_11(int x) { return x * 11; }
+inline int f5445_12(int x) { return x * 12; }
+inline int f5445_13(int x) { return x * 13; }
+inline int f5445_14(int x) { return x * 14; }
+inline int f5445_15(int x) { return x * 15; }
+inline int f5445_16(int x) { return x * 16; }
+inline int f5445_17(int x) { return x * 17; }
+inline int f5445_18(int x) { return x * 18; }
+inline int f5445_19(int x) { return x * 19; }
+inline int f5445_20(int x) { return x * 20; }
+inline int f5445_21(int x) { return x * 21; }
+inline int f5445_22(int x) { return x * 22; }
+inline int f5445_23(int x) { return x * 23; }
+inline int f5445_24(int x) { return x * 24; }
+inline int f5445_25(int x) { return x * 25; }
+inline int f5445_26(int x) { return x * 26; }
+inline int f5445_27(int x) { return x * 27; }
+inline int f5445_28(int x) { return x * 28; }
+inline int f5445_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5446 */
+#include <vector>
+#include "h4146.h"
+#include "h2797.h"
+#include "h9697.h"
+#include "h8416.h"
+#include "h3138.h"
+#ifdef X
+#include "h4939.h"
+#endif
+struct S5446 { int a; const char *s = "x//y"; };
+inline int f5446_0(int x) { return x * 0; }
+inline int f5446_1(int x) { return x * 1; }
+inline int f5446_2(int x) { return x * 2; }
+inline int f5446_3(int x) { return x * 3; }
+inline int f5446_4(int x) { return x * 4; }
+inline int f5446_5(int x) { return x * 5; }
+inline int f5446_6(int x) { return x * 6; }
+inline int f5446_7(int x) { return x * 7; }
+inline int f5446_8(int x) { return x * 8; }
+inline int f5446_9(int x) { return x * 9; }
+inline int f5446_10(int x) { return x * 10; }
+inline int f5446_11(int x) { return x * 11; }
+inline int f5446_12(int x) { return x * 12; }
+inline int f5446_13(int x) { return x * 13; }
+inline int f5446_14(int x) { return x * 14; }
+inline int f5446_15(int x) { return x * 15; }
+inline int f5446_16(int x) { return x * 16; }
+inline int f5446_17(int x) { return x * 17; }
+inline int f5446_18(int x) { return x * 18; }
+inline int f5446_19(int x) { return x * 19; }
+inline int f5446_20(int x) { return x * 20; }
+inline int f5446_21(int x) { return x * 21; }
+inline int f5446_22(int x) { return x * 22; }
+inline int f5446_23(int x) { return x * 23; }
+inline int f5446_24(int x) { return x * 24; }
+inline int f5446_25(int x) { return x * 25; }
+inline int f5446_26(int x) { return x * 26; }
+inline int f5446_27(int x) { return x * 27; }
+inline int f5446_28(int x) { return x * 28; }
+inline int f5446_29(int x) { return x * 29; }
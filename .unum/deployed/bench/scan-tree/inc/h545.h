@@ -0,0 +1,42 @@
+#pragma once
+/* header 545 */
+#include <vector>
+#include "h2233.h"
+#include "h9013.h"
+#include "h1723.h"
+#include "h2610.h"
+#include "h9000.h"
+#ifdef X
+#include "h5253.h"
+#endif
+struct S545 { int a; const char *s = "x//y"; };
+inline int f545_0(int x) { return x * 0; }
+inline int f545_1(int x) { return x * 1; }
+inline int f545_2(int x) { return x * 2; }
+inline int f545_3(int x) { return x * 3; }
+inline int f545_4(int x) { return x * 4; }
+inline int f545_5(int x) { return x * 5; }
+inline int f545_6(int x) { return x * 6; }
+inline int f545_7(int x) { return x * 7; }
+inline int f545_8(int x) { return x * 8; }
+inline int f545_9(int x) { return x * 9; }
+inline int f545_10(int x) { return x * 10; }
+inline int f545_11(int x) { return x * 11; }
+inline int f545_12(int x) { return x * 12; }
+inline int f545_13(int x) { return x * 13; }
+inline int f545_14(int x) { return x * 14; }
+inline int f545_15(int x) { return x * 15; }
+inline int f545_16(int x) { return x * 16; }
+inline int f545_17(int x) { return x * 17; }
+inline int f545_18(int x) { return x * 18; }
+inline int f545_19(int x) { return x * 19; }
+inline int f545_20(int x) { return x * 20; }
+inline int f545_21(int x) { return x * 21; }
+inline int f545_22(int x) { return x * 22; }
+inline int f545_23(int x) { return x * 23; }
+inline int f545_24(int x) { return x * 24; }
+inline int f545_25(int x) { return x * 25; }
+inline int f545_26(int x) { return x * 26; }
+inline int f545_27(int x) { return x * 27; }
+inline int f545_28(int x) { return x * 28; }
+inline int f545_29(int x) { return x * 29; }
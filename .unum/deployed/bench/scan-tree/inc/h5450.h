@@ -0,0 +1,42 @@
+#pragma once
+/* header 5450 */
+#include <vector>
+#include "h1763.h"
+#include "h1956.h"
+#include "h9306.h"
+#include "h2345.h"
+#include "h7375.h"
+#ifdef X
+#include "h9279.h"
+#endif
+struct S5450 { int a; const char *s = "x//y"; };
+inline int f5450_0(int x) { return x * 0; }
+inline int f5450_1(int x) { return x * 1; }
+inline int f5450_2(int x) { return x * 2; }
+inline int f5450_3(int x) { return x * 3; }
+inline int f5450_4(int x) { return x * 4; }
+inline int f5450_5(int x) { return x * 5; }
+inline int f5450_6(int x) { return x * 6; }
+inline int f5450_7(int x) { return x * 7; }
+inline int f5450_8(int x) { return x * 8; }
+inline int f5450_9(int x) { return x * 9; }
+inline int f5450_10(int x) { return x * 10; }
+inline int f5450_11(int x) { return x * 11; }
+inline int f5450_12(int x) { return x * 12; }
+inline int f5450_13(int x) { return x * 13; }
+inline int f5450_14(int x) { return x * 14; }
+inline int f5450_15(int x) { return x * 15; }
+inline int f5450_16(int x) { return x * 16; }
+inline int f5450_17(int x) { return x * 17; }
+inline int f5450_18(int x) { return x * 18; }
+inline int f5450_19(int x) { return x * 19; }
+inline int f5450_20(int x) { return x * 20; }
+inline int f5450_21(int x) { return x * 21; }
+inline int f5450_22(int x) { return x * 22; }
+inline int f5450_23(int x) { return x * 23; }
+inline int f5450_24(int x) { return x * 24; }
+inline int f5450_25(int x) { return x * 25; }
+inline int f5450_26(int x) { return x * 26; }
+inline int f5450_27(int x) { return x * 27; }
+inline int f5450_28(int x) { return x * 28; }
+inline int f5450_29(int x) { return x * 29; }
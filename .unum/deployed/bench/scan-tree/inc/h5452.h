@@ -0,0 +1,42 @@
+#pragma once
+/* header 5452 */
+#include <vector>
+#include "h8605.h"
+#include "h3892.h"
+#include "h1575.h"
+#include "h4562.h"
+#include "h1995.h"
+#ifdef X
+#include "h1090.h"
+#endif
+struct S5452 { int a; const char *s = "x//y"; };
+inline int f5452_0(int x) { return x * 0; }
+inline int f5452_1(int x) { return x * 1; }
+inline int f5452_2(int x) { return x * 2; }
+inline int f5452_3(int x) { return x * 3; }
+inline int f5452_4(int x) { return x * 4; }
+inline int f5452_5(int x) { return x * 5; }
+inline int f5452_6(int x) { return x * 6; }
+inline int f5452_7(int x) { return x * 7; }
+inline int f5452_8(int x) { return x * 8; }
+inline int f5452_9(int x) { return x * 9; }
+inline int f5452_10(int x) { return x * 10; }
+inline int f5452_11(int x) { return x * 11; }
+inline int f5452_12(int x) { return x * 12; }
+inline int f5452_13(int x) { return x * 13; }
+inline int f5452_14(int x) { return x * 14; }
+inline int f5452_15(int x) { return x * 15; }
+inline int f5452_16(int x) { return x * 16; }
+inline int f5452_17(int x) { return x * 17; }
+inline int f5452_18(int x) { return x * 18; }
+inline int f5452_19(int x) { return x * 19; }
+inline int f5452_20(int x) { return x * 20; }
+inline int f5452_21(int x) { return x * 21; }
+inline int f5452_22(int x) { return x * 22; }
+inline int f5452_23(int x) { return x * 23; }
+inline int f5452_24(int x) { return x * 24; }
+inline int f5452_25(int x) { return x * 25; }
+inline int f5452_26(int x) { return x * 26; }
+inline int f5452_27(int x) { return x * 27; }
+inline int f5452_28(int x) { return x * 28; }
+inline int f5452_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5453 */
+#include <vector>
+#include "h4149.h"
+#include "h1732.h"
+#include "h2176.h"
+#include "h3546.h"
+#include "h2487.h"
+#ifdef X
+#include "h5356.h"
+#endif
+struct S5453 { int a; const char *s = "x//y"; };
+inline int f5453_0(int x) { return x * 0; }
+inline int f5453_1(int x) { return x * 1; }
+inline int f5453_2(int x) { return x * 2; }
+inline int f5453_3(int x) { return x * 3; }
+inline int f5453_4(int x) { return x * 4; }
+inline int f5453_5(int x) { return x * 5; }
+inline int f5453_6(int x) { return x * 6; }
+inline int f5453_7(int x) { return x * 7; }
+inline int f5453_8(int x) { return x * 8; }
+inline int f5453_9(int x) { return x * 9; }
+inline int f5453_10(int x) { return x * 10; }
+inline int f5453_11(int x) { return x * 11; }
+inline int f5453_12(int x) { return x * 12; }
+inline int f5453_13(int x) { return x * 13; }
+inline int f5453_14(int x) { return x * 14; }
+inline int f5453_15(int x) { return x * 15; }
+inline int f5453_16(int x) { return x * 16; }
+inline int f5453_17(int x) { return x * 17; }
+inline int f5453_18(int x) { return x * 18; }
+inline int f5453_19(int x) { return x * 19; }
+inline int f5453_20(int x) { return x * 20; }
+inline int f5453_21(int x) { return x * 21; }
+inline int f5453_22(int x) { return x * 22; }
+inline int f5453_23(int x) { return x * 23; }
+inline int f5453_24(int x) { return x * 24; }
+inline int f5453_25(int x) { return x * 25; }
+inline int f5453_26(int x) { return x * 26; }
+inline int f5453_27(int x) { return x * 27; }
+inline int f5453_28(int x) { return x * 28; }
+inline int f5453_29(int x) { return x * 29; }
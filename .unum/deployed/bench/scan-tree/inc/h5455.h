@@ -0,0 +1,42 @@
+#pragma once
+/* header 5455 */
+#include <vector>
+#include "h4343.h"
+#include "h4405.h"
+#include "h4789.h"
+#include "h6196.h"
+#include "h8578.h"
+#ifdef X
+#include "h4041.h"
+#endif
+struct S5455 { int a; const char *s = "x//y"; };
+inline int f5455_0(int x) { return x * 0; }
+inline int f5455_1(int x) { return x * 1; }
+inline int f5455_2(int x) { return x * 2; }
+inline int f5455_3(int x) { return x * 3; }
+inline int f5455_4(int x) { return x * 4; }
+inline int f5455_5(int x) { return x * 5; }
+inline int f5455_6(int x) { return x * 6; }
+inline int f5455_7(int x) { return x * 7; }
+inline int f5455_8(int x) { return x * 8; }
+inline int f5455_9(int x) { return x * 9; }
+inline int f5455_10(int x) { return x * 10; }
+inline int f5455_11(int x) { return x * 11; }
+inline int f5455_12(int x) { return x * 12; }
+inline int f5455_13(int x) { return x * 13; }
+inline int f5455_14(int x) { return x * 14; }
+inline int f5455_15(int x) { return x * 15; }
+inline int f5455_16(int x) { return x * 16; }
+inline int f5455_17(int x) { return x * 17; }
+inline int f5455_18(int x) { return x * 18; }
+inline int f5455_19(int x) { return x * 19; }
+inline int f5455_20(int x) { return x * 20; }
+inline int f5455_21(int x) { return x * 21; }
+inline int f5455_22(int x) { return x * 22; }
+inline int f5455_23(int x) { return x * 23; }
+inline int f5455_24(int x) { return x * 24; }
+inline int f5455_25(int x) { return x * 25; }
+inline int f5455_26(int x) { return x * 26; }
+inline int f5455_27(int x) { return x * 27; }
+inline int f5455_28(int x) { return x * 28; }
+inline int f5455_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 546 */
+#include <vector>
+#include "h2159.h"
+#include "h2563.h"
+#include "h4813.h"
+#include "h4692.h"
+#include "h310.h"
+#ifdef X
+#include "h6753.h"
+#endif
+struct S546 { int a; const char *s = "x//y"; };
+inline int f546_0(int x) { return x * 0; }
+inline int f546_1(int x) { return x * 1; }
+inline int f546_2(int x) { return x * 2; }
+inline int f546_3(int x) { return x * 3; }
+inline int f546_4(int x) { return x * 4; }
+inline int f546_5(int x) { return x * 5; }
+inline int f546_6(int x) { return x * 6; }
+inline int f546_7(int x) { return x * 7; }
+inline int f546_8(int x) { return x * 8; }
+inline int f546_9(int x) { return x * 9; }
+inline int f546_10(int x) { return x * 10; }
+inline int f546_11(int x) { return x * 11; }
+inline int f546_12(int x) { return x * 12; }
+inline int f546_13(int x) { return x * 13; }
+inline int f546_14(int x) { return x * 14; }
+inline int f546_15(int x) { return x * 15; }
+inline int f546_16(int x) { return x * 16; }
+inline int f546_17(int x) { return x * 17; }
+inline int f546_18(int x) { return x * 18; }
+inline int f546_19(int x) { return x * 19; }
+inline int f546_20(int x) { return x * 20; }
+inline int f546_21(int x) { return x * 21; }
+inline int f546_22(int x) { return x * 22; }
+inline int f546_23(int x) { return x * 23; }
+inline int f546_24(int x) { return x * 24; }
+inline int f546_25(int x) { return x * 25; }
+inline int f546_26(int x) { return x * 26; }
+inline int f546_27(int x) { return x * 27; }
+inline int f546_28(int x) { return x * 28; }
+inline int f546_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5463 */
+#include <vector>
+#include "h1916.h"
+#include "h8258.h"
+#include "h3389.h"
+#include "h2249.h"
+#include "h5524.h"
+#ifdef X
+#include "h3584.h"
+#endif
+struct S5463 { int a; const char *s = "x//y"; };
+inline int f5463_0(int x) { return x * 0; }
+inline int f5463_1(int x) { return x * 1; }
+inline int f5463_2(int x) { return x * 2; }
+inline int f5463_3(int x) { return x * 3; }
+inline int f5463_4(int x) { return x * 4; }
+inline int f5463_5(int x) { return x * 5; }
+inline int f5463_6(int x) { return x * 6; }
+inline int f5463_7(int x) { return x * 7; }
+inline int f5463_8(int x) { return x * 8; }
+inline int f5463_9(int x) { return x * 9; }
+inline int f5463_10(int x) { return x * 10; }
+inline int f5463_11(int x) { return x * 11; }
+inline int f5463_12(int x) { return x * 12; }
+inline int f5463_13(int x) { return x * 13; }
+inline int f5463_14(int x) { return x * 14; }
+inline int f5463_15(int x) { return x * 15; }
+inline int f5463_16(int x) { return x * 16; }
+inline int f5463_17(int x) { return x * 17; }
+inline int f5463_18(int x) { return x * 18; }
+inline int f5463_19(int x) { return x * 19; }
+inline int f5463_20(int x) { return x * 20; }
+inline int f5463_21(int x) { return x * 21; }
+inline int f5463_22(int x) { return x * 22; }
+inline int f5463_23(int x) { return x * 23; }
+inline int f5463_24(int x) { return x * 24; }
+inline int f5463_25(int x) { return x * 25; }
+inline int f5463_26(int x) { return x * 26; }
+inline int f5463_27(int x) { return x * 27; }
+inline int f5463_28(int x) { return x * 28; }
+inline int f5463_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5465 */
+#include <vector>
+#include "h9556.h"
+#include "h236.h"
+#include "h3254.h"
+#include "h794.h"
+#include "h6333.h"
+#ifdef X
+#include "h1928.h"
+#endif
+struct S5465 { int a; const char *s = "x//y"; };
+inline int f5465_0(int x) { return x * 0; }
+inline int f5465_1(int x) { return x * 1; }
+inline int f5465_2(int x) { return x * 2; }
+inline int f5465_3(int x) { return x * 3; }
+inline int f5465_4(int x) { return x * 4; }
+inline int f5465_5(int x) { return x * 5; }
+inline int f5465_6(int x) { return x * 6; }
+inline int f5465_7(int x) { return x * 7; }
+inline int f5465_8(int x) { return x * 8; }
+inline int f5465_9(int x) { return x * 9; }
+inline int f5465_10(int x) { return x * 10; }
+inline int f5465_11(int x) { return x * 11; }
+inline int f5465_12(int x) { return x * 12; }
+inline int f5465_13(int x) { return x * 13; }
+inline int f5465_14(int x) { return x * 14; }
+inline int f5465_15(int x) { return x * 15; }
+inline int f5465_16(int x) { return x * 16; }
+inline int f5465_17(int x) { return x * 17; }
+inline int f5465_18(int x) { return x * 18; }
+inline int f5465_19(int x) { return x * 19; }
+inline int f5465_20(int x) { return x * 20; }
+inline int f5465_21(int x) { return x * 21; }
+inline int f5465_22(int x) { return x * 22; }
+inline int f5465_23(int x) { return x * 23; }
+inline int f5465_24(int x) { return x * 24; }
+inline int f5465_25(int x) { return x * 25; }
+inline int f5465_26(int x) { return x * 26; }
+inline int f5465_27(int x) { return x * 27; }
+inline int f5465_28(int x) { return x * 28; }
+inline int f5465_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5468 */
+#include <vector>
+#include "h4750.h"
+#include "h3953.h"
+#include "h9921.h"
+#include "h820.h"
+#include "h8243.h"
+#ifdef X
+#include "h3951.h"
+#endif
+struct S5468 { int a; const char *s = "x//y"; };
+inline int f5468_0(int x) { return x * 0; }
+inline int f5468_1(int x) { return x * 1; }
+inline int f5468_2(int x) { return x * 2; }
+inline int f5468_3(int x) { return x * 3; }
+inline int f5468_4(int x) { return x * 4; }
+inline int f5468_5(int x) { return x * 5; }
+inline int f5468_6(int x) { return x * 6; }
+inline int f5468_7(int x) { return x * 7; }
+inline int f5468_8(int x) { return x * 8; }
+inline int f5468_9(int x) { return x * 9; }
+inline int f5468_10(int x) { return x * 10; }
+inline int f5468_11(int x) { return x * 11; }
+inline int f5468_12(int x) { return x * 12; }
+inline int f5468_13(int x) { return x * 13; }
+inline int f5468_14(int x) { return x * 14; }
+inline int f5468_15(int x) { return x * 15; }
+inline int f5468_16(int x) { return x * 16; }
+inline int f5468_17(int x) { return x * 17; }
+inline int f5468_18(int x) { return x * 18; }
+inline int f5468_19(int x) { return x * 19; }
+inline int f5468_20(int x) { return x * 20; }
+inline int f5468_21(int x) { return x * 21; }
+inline int f5468_22(int x) { return x * 22; }
+inline int f5468_23(int x) { return x * 23; }
+inline int f5468_24(int x) { return x * 24; }
+inline int f5468_25(int x) { return x * 25; }
+inline int f5468_26(int x) { return x * 26; }
+inline int f5468_27(int x) { return x * 27; }
+inline int f5468_28(int x) { return x * 28; }
+inline int f5468_29(int x) { return x * 29; }
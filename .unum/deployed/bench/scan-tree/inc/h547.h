@@ -0,0 +1,42 @@
+#pragma once
+/* header 547 */
+#include <vector>
+#include "h2923.h"
+#include "h1153.h"
+#include "h779.h"
+#include "h7043.h"
+#include "h9622.h"
+#ifdef X
+#include "h1509.h"
+#endif
+struct S547 { int a; const char *s = "x//y"; };
+inline int f547_0(int x) { return x * 0; }
+inline int f547_1(int x) { return x * 1; }
+inline int f547_2(int x) { return x * 2; }
+inline int f547_3(int x) { return x * 3; }
+inline int f547_4(int x) { return x * 4; }
+inline int f547_5(int x) { return x * 5; }
+inline int f547_6(int x) { return x * 6; }
+inline int f547_7(int x) { return x * 7; }
+inline int f547_8(int x) { return x * 8; }
+inline int f547_9(int x) { return x * 9; }
+inline int f547_10(int x) { return x * 10; }
+inline int f547_11(int x) { return x * 11; }
+inline int f547_12(int x) { return x * 12; }
+inline int f547_13(int x) { return x * 13; }
+inline int f547_14(int x) { return x * 14; }
+inline int f547_15(int x) { return x * 15; }
+inline int f547_16(int x) { return x * 16; }
+inline int f547_17(int x) { return x * 17; }
+inline int f547_18(int x) { return x * 18; }
+inline int f547_19(int x) { return x * 19; }
+inline int f547_20(int x) { return x * 20; }
+inline int f547_21(int x) { return x * 21; }
+inline int f547_22(int x) { return x * 22; }
+inline int f547_23(int x) { return x * 23; }
+inline int f547_24(int x) { return x * 24; }
+inline int f547_25(int x) { return x * 25; }
+inline int f547_26(int x) { return x * 26; }
+inline int f547_27(int x) { return x * 27; }
+inline int f547_28(int x) { return x * 28; }
+inline int f547_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5470 */
+#include <vector>
+#include "h180.h"
+#include "h5384.h"
+#include "h3740.h"
+#include "h3855.h"
+#include "h4991.h"
+#ifdef X
+#include "h9840.h"
+#endif
+struct S5470 { int a; const char *s = "x//y"; };
+inline int f5470_0(int x) { return x * 0; }
+inline int f5470_1(int x) { return x * 1; }
+inline int f5470_2(int x) { return x * 2; }
+inline int f5470_3(int x) { return x * 3; }
+inline int f5470_4(int x) { return x * 4; }
+inline int f5470_5(int x) { return x * 5; }
+inline int f5470_6(int x) { return x * 6; }
+inline int f5470_7(int x) { return x * 7; }
+inline int f5470_8(int x) { return x * 8; }
+inline int f5470_9(int x) { return x * 9; }
+inline int f5470_10(int x) { return x * 10; }
+inline int f5470_11(int x) { return x * 11; }
+inline int f5470_12(int x) { return x * 12; }
+inline int f5470_13(int x) { return x * 13; }
+inline int f5470_14(int x) { return x * 14; }
+inline int f5470_15(int x) { return x * 15; }
+inline int f5470_16(int x) { return x * 16; }
+inline int f5470_17(int x) { return x * 17; }
+inline int f5470_18(int x) { return x * 18; }
+inline int f5470_19(int x) { return x * 19; }
+inline int f5470_20(int x) { return x * 20; }
+inline int f5470_21(int x) { return x * 21; }
+inline int f5470_22(int x) { return x * 22; }
+inline int f5470_23(int x) { return x * 23; }
+inline int f5470_24(int x) { return x * 24; }
+inline int f5470_25(int x) { return x * 25; }
+inline int f5470_26(int x) { return x * 26; }
+inline int f5470_27(int x) { return x * 27; }
+inline int f5470_28(int x) { return x * 28; }
+inline int f5470_29(int x) { return x * 29; }
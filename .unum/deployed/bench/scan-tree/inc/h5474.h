@@ -0,0 +1,42 @@
+#pragma once
+/* header 5474 */
+#include <vector>
+#include "h4701.h"
+#include "h3021.h"
+#include "h286.h"
+#include "h2037.h"
+#include "h7725.h"
+#ifdef X
+#include "h2749.h"
+#endif
+struct S5474 { int a; const char *s = "x//y"; };
+inline int f5474_0(int x) { return x * 0; }
+inline int f5474_1(int x) { return x * 1; }
+inline int f5474_2(int x) { return x * 2; }
+inline int f5474_3(int x) { return x * 3; }
+inline int f5474_4(int x) { return x * 4; }
+inline int f5474_5(int x) { return x * 5; }
+inline int f5474_6(int x) { return x * 6; }
+inline int f5474_7(int x) { return x * 7; }
+inline int f5474_8(int x) { return x * 8; }
+inline int f5474_9(int x) { return x * 9; }
+inline int f5474_10(int x) { return x * 10; }
+inline int f5474_11(int x) { return x * 11; }
+inline int f5474_12(int x) { return x * 12; }
+inline int f5474_13(int x) { return x * 13; }
+inline int f5474_14(int x) { return x * 14; }
+inline int f5474_15(int x) { return x * 15; }
+inline int f5474_16(int x) { return x * 16; }
+inline int f5474_17(int x) { return x * 17; }
+inline int f5474_18(int x) { return x * 18; }
+inline int f5474_19(int x) { return x * 19; }
+inline int f5474_20(int x) { return x * 20; }
+inline int f5474_21(int x) { return x * 21; }
+inline int f5474_22(int x) { return x * 22; }
+inline int f5474_23(int x) { return x * 23; }
+inline int f5474_24(int x) { return x * 24; }
+inline int f5474_25(int x) { return x * 25; }
+inline int f5474_26(int x) { return x * 26; }
+inline int f5474_27(int x) { return x * 27; }
+inline int f5474_28(int x) { return x * 28; }
+inline int f5474_29(int x) { return x * 29; }
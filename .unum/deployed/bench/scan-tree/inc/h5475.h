@@ -0,0 +1,42 @@
+#pragma once
+/* header 5475 */
+#include <vector>
+#include "h9002.h"
+#include "h9718.h"
+#include "h4551.h"
+#include "h4050.h"
+#include "h7703.h"
+#ifdef X
+#include "h1247.h"
+#endif
+struct S5475 { int a; const char *s = "x//y"; };
+inline int f5475_0(int x) { return x * 0; }
+inline int f5475_1(int x) { return x * 1; }
+inline int f5475_2(int x) { return x * 2; }
+inline int f5475_3(int x) { return x * 3; }
+inline int f5475_4(int x) { return x * 4; }
+inline int f5475_5(int x) { return x * 5; }
+inline int f5475_6(int x) { return x * 6; }
+inline int f5475_7(int x) { return x * 7; }
+inline int f5475_8(int x) { return x * 8; }
+inline int f5475_9(int x) { return x * 9; }
+inline int f5475_10(int x) { return x * 10; }
+inline int f5475_11(int x) { return x * 11; }
+inline int f5475_12(int x) { return x * 12; }
+inline int f5475_13(int x) { return x * 13; }
+inline int f5475_14(int x) { return x * 14; }
+inline int f5475_15(int x) { return x * 15; }
+inline int f5475_16(int x) { return x * 16; }
+inline int f5475_17(int x) { return x * 17; }
+inline int f5475_18(int x) { return x * 18; }
+inline int f5475_19(int x) { return x * 19; }
+inline int f5475_20(int x) { return x * 20; }
+inline int f5475_21(int x) { return x * 21; }
+inline int f5475_22(int x) { return x * 22; }
+inline int f5475_23(int x) { return x * 23; }
+inline int f5475_24(int x) { return x * 24; }
+inline int f5475_25(int x) { return x * 25; }
+inline int f5475_26(int x) { return x * 26; }
+inline int f5475_27(int x) { return x * 27; }
+inline int f5475_28(int x) { return x * 28; }
+inline int f5475_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5476 */
+#include <vector>
+#include "h3622.h"
+#include "h914.h"
+#include "h64.h"
+#include "h7231.h"
+#include "h7909.h"
+#ifdef X
+#include "h5117.h"
+#endif
+struct S5476 { int a; const char *s = "x//y"; };
+inline int f5476_0(int x) { return x * 0; }
+inline int f5476_1(int x) { return x * 1; }
+inline int f5476_2(int x) { return x * 2; }
+inline int f5476_3(int x) { return x * 3; }
+inline int f5476_4(int x) { return x * 4; }
+inline int f5476_5(int x) { return x * 5; }
+inline int f5476_6(int x) { return x * 6; }
+inline int f5476_7(int x) { return x * 7; }
+inline int f5476_8(int x) { return x * 8; }
+inline int f5476_9(int x) { return x * 9; }
+inline int f5476_10(int x) { return x * 10; }
+inline int f5476_11(int x) { return x * 11; }
+inline int f5476_12(int x) { return x * 12; }
+inline int f5476_13(int x) { return x * 13; }
+inline int f5476_14(int x) { return x * 14; }
+inline int f5476_15(int x) { return x * 15; }
+inline int f5476_16(int x) { return x * 16; }
+inline int f5476_17(int x) { return x * 17; }
+inline int f5476_18(int x) { return x * 18; }
+inline int f5476_19(int x) { return x * 19; }
+inline int f5476_20(int x) { return x * 20; }
+inline int f5476_21(int x) { return x * 21; }
+inline int f5476_22(int x) { return x * 22; }
+inline int f5476_23(int x) { return x * 23; }
+inline int f5476_24(int x) { return x * 24; }
+inline int f5476_25(int x) { return x * 25; }
+inline int f5476_26(int x) { return x * 26; }
+inline int f5476_27(int x) { return x * 27; }
+inline int f5476_28(int x) { return x * 28; }
+inline int f5476_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5477 */
+#include <vector>
+#include "h7462.h"
+#include "h1422.h"
+#include "h3211.h"
+#include "h1045.h"
+#include "h8166.h"
+#ifdef X
+#include "h7285.h"
+#endif
+struct S5477 { int a; const char *s = "x//y"; };
+inline int f5477_0(int x) { return x * 0; }
+inline int f5477_1(int x) { return x * 1; }
+inline int f5477_2(int x) { return x * 2; }
+inline int f5477_3(int x) { return x * 3; }
+inline int f5477_4(int x) { return x * 4; }
+inline int f5477_5(int x) { return x * 5; }
+inline int f5477_6(int x) { return x * 6; }
+inline int f5477_7(int x) { return x * 7; }
+inline int f5477_8(int x) { return x * 8; }
+inline int f5477_9(int x) { return x * 9; }
+inline int f5477_10(int x) { return x * 10; }
+inline int f5477_11(int x) { return x * 11; }
+inline int f5477_12(int x) { return x * 12; }
+inline int f5477_13(int x) { return x * 13; }
+inline int f5477_14(int x) { return x * 14; }
+inline int f5477_15(int x) { return x * 15; }
+inline int f5477_16(int x) { return x * 16; }
+inline int f5477_17(int x) { return x * 17; }
+inline int f5477_18(int x) { return x * 18; }
+inline int f5477_19(int x) { return x * 19; }
+inline int f5477_20(int x) { return x * 20; }
+inline int f5477_21(int x) { return x * 21; }
+inline int f5477_22(int x) { return x * 22; }
+inline int f5477_23(int x) { return x * 23; }
+inline int f5477_24(int x) { return x * 24; }
+inline int f5477_25(int x) { return x * 25; }
+inline int f5477_26(int x) { return x * 26; }
+inline int f5477_27(int x) { return x * 27; }
+inline int f5477_28(int x) { return x * 28; }
+inline int f5477_29(int x) { return x * 29; }
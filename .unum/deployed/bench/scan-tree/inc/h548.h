@@ -0,0 +1,42 @@
+#pragma once
+/* header 548 */
+#include <vector>
+#include "h9125.h"
+#include "h2690.h"
+#include "h5263.h"
+#include "h9324.h"
+#include "h4682.h"
+#ifdef X
+#include "h4345.h"
+#endif
+struct S548 { int a; const char *s = "x//y"; };
+inline int f548_0(int x) { return x * 0; }
+inline int f548_1(int x) { return x * 1; }
+inline int f548_2(int x) { return x * 2; }
+inline int f548_3(int x) { return x * 3; }
+inline int f548_4(int x) { return x * 4; }
+inline int f548_5(int x) { return x * 5; }
+inline int f548_6(int x) { return x * 6; }
+inline int f548_7(int x) { return x * 7; }
+inline int f548_8(int x) { return x * 8; }
+inline int f548_9(int x) { return x * 9; }
+inline int f548_10(int x) { return x * 10; }
+inline int f548_11(int x) { return x * 11; }
+inline int f548_12(int x) { return x * 12; }
+inline int f548_13(int x) { return x * 13; }
+inline int f548_14(int x) { return x * 14; }
+inline int f548_15(int x) { return x * 15; }
+inline int f548_16(int x) { return x * 16; }
+inline int f548_17(int x) { return x * 17; }
+inline int f548_18(int x) { return x * 18; }
+inline int f548_19(int x) { return x * 19; }
+inline int f548_20(int x) { return x * 20; }
+inline int f548_21(int x) { return x * 21; }
+inline int f548_22(int x) { return x * 22; }
+inline int f548_23(int x) { return x * 23; }
+inline int f548_24(int x) { return x * 24; }
+inline int f548_25(int x) { return x * 25; }
+inline int f548_26(int x) { return x * 26; }
+inline int f548_27(int x) { return x * 27; }
+inline int f548_28(int x) { return x * 28; }
+inline int f548_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5483 */
+#include <vector>
+#include "h2623.h"
+#include "h1121.h"
+#include "h527.h"
+#include "h6862.h"
+#include "h9327.h"
+#ifdef X
+#include "h3272.h"
+#endif
+struct S5483 { int a; const char *s = "x//y"; };
+inline int f5483_0(int x) { return x * 0; }
+inline int f5483_1(int x) { return x * 1; }
+inline int f5483_2(int x) { return x * 2; }
+inline int f5483_3(int x) { return x * 3; }
+inline int f5483_4(int x) { return x * 4; }
+inline int f5483_5(int x) { return x * 5; }
+inline int f5483_6(int x) { return x * 6; }
+inline int f5483_7(int x) { return x * 7; }
+inline int f5483_8(int x) { return x * 8; }
+inline int f5483_9(int x) { return x * 9; }
+inline int f5483_10(int x) { return x * 10; }
+inline int f5483_11(int x) { return x * 11; }
+inline int f5483_12(int x) { return x * 12; }
+inline int f5483_13(int x) { return x * 13; }
+inline int f5483_14(int x) { return x * 14; }
+inline int f5483_15(int x) { return x * 15; }
+inline int f5483_16(int x) { return x * 16; }
+inline int f5483_17(int x) { return x * 17; }
+inline int f5483_18(int x) { return x * 18; }
+inline int f5483_19(int x) { return x * 19; }
+inline int f5483_20(int x) { return x * 20; }
+inline int f5483_21(int x) { return x * 21; }
+inline int f5483_22(int x) { return x * 22; }
+inline int f5483_23(int x) { return x * 23; }
+inline int f5483_24(int x) { return x * 24; }
+inline int f5483_25(int x) { return x * 25; }
+inline int f5483_26(int x) { return x * 26; }
+inline int f5483_27(int x) { return x * 27; }
+inline int f5483_28(int x) { return x * 28; }
+inline int f5483_29(int x) { return x * 29; }
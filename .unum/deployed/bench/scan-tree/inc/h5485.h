@@ -0,0 +1,42 @@
+#pragma once
+/* header 5485 */
+#include <vector>
+#include "h5653.h"
+#include "h9229.h"
+#include "h3061.h"
+#include "h9281.h"
+#include "h5350.h"
+#ifdef X
+#include "h8337.h"
+#endif
+struct S5485 { int a; const char *s = "x//y"; };
+inline int f5485_0(int x) { return x * 0; }
+inline int f5485_1(int x) { return x * 1; }
+inline int f5485_2(int x) { return x * 2; }
+inline int f5485_3(int x) { return x * 3; }
+inline int f5485_4(int x) { return x * 4; }
+inline int f5485_5(int x) { return x * 5; }
+inline int f5485_6(int x) { return x * 6; }
+inline int f5485_7(int x) { return x * 7; }
+inline int f5485_8(int x) { return x * 8; }
+inline int f5485_9(int x) { return x * 9; }
+inline int f5485_10(int x) { return x * 10; }
+inline int f5485_11(int x) { return x * 11; }
+inline int f5485_12(int x) { return x * 12; }
+inline int f5485_13(int x) { return x * 13; }
+inline int f5485_14(int x) { return x * 14; }
+inline int f5485_15(int x) { return x * 15; }
+inline int f5485_16(int x) { return x * 16; }
+inline int f5485_17(int x) { return x * 17; }
+inline int f5485_18(int x) { return x * 18; }
+inline int f5485_19(int x) { return x * 19; }
+inline int f5485_20(int x) { return x * 20; }
+inline int f5485_21(int x) { return x * 21; }
+inline int f5485_22(int x) { return x * 22; }
+inline int f5485_23(int x) { return x * 23; }
+inline int f5485_24(int x) { return x * 24; }
+inline int f5485_25(int x) { return x * 25; }
+inline int f5485_26(int x) { return x * 26; }
+inline int f5485_27(int x) { return x * 27; }
+inline int f5485_28(int x) { return x * 28; }
+inline int f5485_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5487 */
+#include <vector>
+#include "h3654.h"
+#include "h3040.h"
+#include "h6135.h"
+#include "h1762.h"
+#include "h1994.h"
+#ifdef X
+#include "h852.h"
+#endif
+struct S5487 { int a; const char *s = "x//y"; };
+inline int f5487_0(int x) { return x * 0; }
+inline int f5487_1(int x) { return x * 1; }
+inline int f5487_2(int x) { return x * 2; }
+inline int f5487_3(int x) { return x * 3; }
+inline int f5487_4(int x) { return x * 4; }
+inline int f5487_5(int x) { return x * 5; }
+inline int f5487_6(int x) { return x * 6; }
+inline int f5487_7(int x) { return x * 7; }
+inline int f5487_8(int x) { return x * 8; }
+inline int f5487_9(int x) { return x * 9; }
+inline int f5487_10(int x) { return x * 10; }
+inline int f5487_11(int x) { return x * 11; }
+inline int f5487_12(int x) { return x * 12; }
+inline int f5487_13(int x) { return x * 13; }
+inline int f5487_14(int x) { return x * 14; }
+inline int f5487_15(int x) { return x * 15; }
+inline int f5487_16(int x) { return x * 16; }
+inline int f5487_17(int x) { return x * 17; }
+inline int f5487_18(int x) { return x * 18; }
+inline int f5487_19(int x) { return x * 19; }
+inline int f5487_20(int x) { return x * 20; }
+inline int f5487_21(int x) { return x * 21; }
+inline int f5487_22(int x) { return x * 22; }
+inline int f5487_23(int x) { return x * 23; }
+inline int f5487_24(int x) { return x * 24; }
+inline int f5487_25(int x) { return x * 25; }
+inline int f5487_26(int x) { return x * 26; }
+inline int f5487_27(int x) { return x * 27; }
+inline int f5487_28(int x) { return x * 28; }
+inline int f5487_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5488 */
+#include <vector>
+#include "h4498.h"
+#include "h3594.h"
+#include "h2692.h"
+#include "h8565.h"
+#include "h640.h"
+#ifdef X
+#include "h9933.h"
+#endif
+struct S5488 { int a; const char *s = "x//y"; };
+inline int f5488_0(int x) { return x * 0; }
+inline int f5488_1(int x) { return x * 1; }
+inline int f5488_2(int x) { return x * 2; }
+inline int f5488_3(int x) { return x * 3; }
+inline int f5488_4(int x) { return x * 4; }
+inline int f5488_5(int x) { return x * 5; }
+inline int f5488_6(int x) { return x * 6; }
+inline int f5488_7(int x) { return x * 7; }
+inline int f5488_8(int x) { return x * 8; }
+inline int f5488_9(int x) { return x * 9; }
+inline int f5488_10(int x) { return x * 10; }
+inline int f5488_11(int x) { return x * 11; }
+inline int f5488_12(int x) { return x * 12; }
+inline int f5488_13(int x) { return x * 13; }
+inline int f5488_14(int x) { return x * 14; }
+inline int f5488_15(int x) { return x * 15; }
+inline int f5488_16(int x) { return x * 16; }
+inline int f5488_17(int x) { return x * 17; }
+inline int f5488_18(int x) { return x * 18; }
+inline int f5488_19(int x) { return x * 19; }
+inline int f5488_20(int x) { return x * 20; }
+inline int f5488_21(int x) { return x * 21; }
+inline int f5488_22(int x) { return x * 22; }
+inline int f5488_23(int x) { return x * 23; }
+inline int f5488_24(int x) { return x * 24; }
+inline int f5488_25(int x) { return x * 25; }
+inline int f5488_26(int x) { return x * 26; }
+inline int f5488_27(int x) { return x * 27; }
+inline int f5488_28(int x) { return x * 28; }
+inline int f5488_29(int x) { return x * 29; }
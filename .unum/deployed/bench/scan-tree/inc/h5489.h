@@ -0,0 +1,42 @@
+#pragma once
+/* header 5489 */
+#include <vector>
+#include "h3306.h"
+#include "h4308.h"
+#include "h6566.h"
+#include "h9283.h"
+#include "h6280.h"
+#ifdef X
+#include "h1299.h"
+#endif
+struct S5489 { int a; const char *s = "x//y"; };
+inline int f5489_0(int x) { return x * 0; }
+inline int f5489_1(int x) { return x * 1; }
+inline int f5489_2(int x) { return x * 2; }
+inline int f5489_3(int x) { return x * 3; }
+inline int f5489_4(int x) { return x * 4; }
+inline int f5489_5(int x) { return x * 5; }
+inline int f5489_6(int x) { return x * 6; }
+inline int f5489_7(int x) { return x * 7; }
+inline int f5489_8(int x) { return x * 8; }
+inline int f5489_9(int x) { return x * 9; }
+inline int f5489_10(int x) { return x * 10; }
+inline int f5489_11(int x) { return x * 11; }
+inline int f5489_12(int x) { return x * 12; }
+inline int f5489_13(int x) { return x * 13; }
+inline int f5489_14(int x) { return x * 14; }
+inline int f5489_15(int x) { return x * 15; }
+inline int f5489_16(int x) { return x * 16; }
+inline int f5489_17(int x) { return x * 17; }
+inline int f5489_18(int x) { return x * 18; }
+inline int f5489_19(int x) { return x * 19; }
+inline int f5489_20(int x) { return x * 20; }
+inline int f5489_21(int x) { return x * 21; }
+inline int f5489_22(int x) { return x * 22; }
+inline int f5489_23(int x) { return x * 23; }
+inline int f5489_24(int x) { return x * 24; }
+inline int f5489_25(int x) { return x * 25; }
+inline int f5489_26(int x) { return x * 26; }
+inline int f5489_27(int x) { return x * 27; }
+inline int f5489_28(int x) { return x * 28; }
+inline int f5489_29(int x) { return x * 29; }
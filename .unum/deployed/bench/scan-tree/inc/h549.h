@@ -0,0 +1,42 @@
+#pragma once
+/* header 549 */
+#include <vector>
+#include "h5614.h"
+#include "h9858.h"
+#include "h9989.h"
+#include "h8472.h"
+#include "h5779.h"
+#ifdef X
+#include "h6425.h"
+#endif
+struct S549 { int a; const char *s = "x//y"; };
+inline int f549_0(int x) { return x * 0; }
+inline int f549_1(int x) { return x * 1; }
+inline int f549_2(int x) { return x * 2; }
+inline int f549_3(int x) { return x * 3; }
+inline int f549_4(int x) { return x * 4; }
+inline int f549_5(int x) { return x * 5; }
+inline int f549_6(int x) { return x * 6; }
+inline int f549_7(int x) { return x * 7; }
+inline int f549_8(int x) { return x * 8; }
+inline int f549_9(int x) { return x * 9; }
+inline int f549_10(int x) { return x * 10; }
+inline int f549_11(int x) { return x * 11; }
+inline int f549_12(int x) { return x * 12; }
+inline int f549_13(int x) { return x * 13; }
+inline int f549_14(int x) { return x * 14; }
+inline int f549_15(int x) { return x * 15; }
+inline int f549_16(int x) { return x * 16; }
+inline int f549_17(int x) { return x * 17; }
+inline int f549_18(int x) { return x * 18; }
+inline int f549_19(int x) { return x * 19; }
+inline int f549_20(int x) { return x * 20; }
+inline int f549_21(int x) { return x * 21; }
+inline int f549_22(int x) { return x * 22; }
+inline int f549_23(int x) { return x * 23; }
+inline int f549_24(int x) { return x * 24; }
+inline int f549_25(int x) { return x * 25; }
+inline int f549_26(int x) { return x * 26; }
+inline int f549_27(int x) { return x * 27; }
+inline int f549_28(int x) { return x * 28; }
+inline int f549_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5490 */
+#include <vector>
+#include "h569.h"
+#include "h4976.h"
+#include "h5227.h"
+#include "h6832.h"
+#include "h8259.h"
+#ifdef X
+#include "h3696.h"
+#endif
+struct S5490 { int a; const char *s = "x//y"; };
+inline int f5490_0(int x) { return x * 0; }
+inline int f5490_1(int x) { return x * 1; }
+inline int f5490_2(int x) { return x * 2; }
+inline int f5490_3(int x) { return x * 3; }
+inline int f5490_4(int x) { return x * 4; }
+inline int f5490_5(int x) { return x * 5; }
+inline int f5490_6(int x) { return x * 6; }
+inline int f5490_7(int x) { return x * 7; }
+inline int f5490_8(int x) { return x * 8; }
+inline int f5490_9(int x) { return x * 9; }
+inline int f5490_10(int x) { return x * 10; }
+inline int f5490_11(int x) { return x * 11; }
+inline int f5490_12(int x) { return x * 12; }
+inline int f5490_13(int x) { return x * 13; }
+inline int f5490_14(int x) { return x * 14; }
+inline int f5490_15(int x) { return x * 15; }
+inline int f5490_16(int x) { return x * 16; }
+inline int f5490_17(int x) { return x * 17; }
+inline int f5490_18(int x) { return x * 18; }
+inline int f5490_19(int x) { return x * 19; }
+inline int f5490_20(int x) { return x * 20; }
+inline int f5490_21(int x) { return x * 21; }
+inline int f5490_22(int x) { return x * 22; }
+inline int f5490_23(int x) { return x * 23; }
+inline int f5490_24(int x) { return x * 24; }
+inline int f5490_25(int x) { return x * 25; }
+inline int f5490_26(int x) { return x * 26; }
+inline int f5490_27(int x) { return x * 27; }
+inline int f5490_28(int x) { return x * 28; }
+inline int f5490_29(int x) { return x * 29; }
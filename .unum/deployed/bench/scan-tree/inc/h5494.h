@@ -0,0 +1,42 @@
+#pragma once
+/* header 5494 */
+#include <vector>
+#include "h7260.h"
+#include "h8135.h"
+#include "h3515.h"
+#include "h7241.h"
+#include "h3862.h"
+#ifdef X
+#include "h9928.h"
+#endif
+struct S5494 { int a; const char *s = "x//y"; };
+inline int f5494_0(int x) { return x * 0; }
+inline int f5494_1(int x) { return x * 1; }
+inline int f5494_2(int x) { return x * 2; }
+inline int f5494_3(int x) { return x * 3; }
+inline int f5494_4(int x) { return x * 4; }
+inline int f5494_5(int x) { return x * 5; }
+inline int f5494_6(int x) { return x * 6; }
+inline int f5494_7(int x) { return x * 7; }
+inline int f5494_8(int x) { return x * 8; }
+inline int f5494_9(int x) { return x * 9; }
+inline int f5494_10(int x) { return x * 10; }
+inline int f5494_11(int x) { return x * 11; }
+inline int f5494_12(int x) { return x * 12; }
+inline int f5494_13(int x) { return x * 13; }
+inline int f5494_14(int x) { return x * 14; }
+inline int f5494_15(int x) { return x * 15; }
+inline int f5494_16(int x) { return x * 16; }
+inline int f5494_17(int x) { return x * 17; }
+inline int f5494_18(int x) { return x * 18; }
+inline int f5494_19(int x) { return x * 19; }
+inline int f5494_20(int x) { return x * 20; }
+inline int f5494_21(int x) { return x * 21; }
+inline int f5494_22(int x) { return x * 22; }
+inline int f5494_23(int x) { return x * 23; }
+inline int f5494_24(int x) { return x * 24; }
+inline int f5494_25(int x) { return x * 25; }
+inline int f5494_26(int x) { return x * 26; }
+inline int f5494_27(int x) { return x * 27; }
+inline int f5494_28(int x) { return x * 28; }
+inline int f5494_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5497 */
+#include <vector>
+#include "h6882.h"
+#include "h6296.h"
+#include "h6311.h"
+#include "h3909.h"
+#include "h192.h"
+#ifdef X
+#include "h9290.h"
+#endif
+struct S5497 { int a; const char *s = "x//y"; };
+inline int f5497_0(int x) { return x * 0; }
+inline int f5497_1(int x) { return x * 1; }
+inline int f5497_2(int x) { return x * 2; }
+inline int f5497_3(int x) { return x * 3; }
+inline int f5497_4(int x) { return x * 4; }
+inline int f5497_5(int x) { return x * 5; }
+inline int f5497_6(int x) { return x * 6; }
+inline int f5497_7(int x) { return x * 7; }
+inline int f5497_8(int x) { return x * 8; }
+inline int f5497_9(int x) { return x * 9; }
+inline int f5497_10(int x) { return x * 10; }
+inline int f5497_11(int x) { return x * 11; }
+inline int f5497_12(int x) { return x * 12; }
+inline int f5497_13(int x) { return x * 13; }
+inline int f5497_14(int x) { return x * 14; }
+inline int f5497_15(int x) { return x * 15; }
+inline int f5497_16(int x) { return x * 16; }
+inline int f5497_17(int x) { return x * 17; }
+inline int f5497_18(int x) { return x * 18; }
+inline int f5497_19(int x) { return x * 19; }
+inline int f5497_20(int x) { return x * 20; }
+inline int f5497_21(int x) { return x * 21; }
+inline int f5497_22(int x) { return x * 22; }
+inline int f5497_23(int x) { return x * 23; }
+inline int f5497_24(int x) { return x * 24; }
+inline int f5497_25(int x) { return x * 25; }
+inline int f5497_26(int x) { return x * 26; }
+inline int f5497_27(int x) { return x * 27; }
+inline int f5497_28(int x) { return x * 28; }
+inline int f5497_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 55 */
+#include <vector>
+#include "h4144.h"
+#include "h8262.h"
+#include "h2317.h"
+#include "h2317.h"
+#include "h1049.h"
+#ifdef X
+#include "h31.h"
+#endif
+struct S55 { int a; const char *s = "x//y"; };
+inline int f55_0(int x) { return x * 0; }
+inline int f55_1(int x) { return x * 1; }
+inline int f55_2(int x) { return x * 2; }
+inline int f55_3(int x) { return x * 3; }
+inline int f55_4(int x) { return x * 4; }
+inline int f55_5(int x) { return x * 5; }
+inline int f55_6(int x) { return x * 6; }
+inline int f55_7(int x) { return x * 7; }
+inline int f55_8(int x) { return x * 8; }
+inline int f55_9(int x) { return x * 9; }
+inline int f55_10(int x) { return x * 10; }
+inline int f55_11(int x) { return x * 11; }
+inline int f55_12(int x) { return x * 12; }
+inline int f55_13(int x) { return x * 13; }
+inline int f55_14(int x) { return x * 14; }
+inline int f55_15(int x) { return x * 15; }
+inline int f55_16(int x) { return x * 16; }
+inline int f55_17(int x) { return x * 17; }
+inline int f55_18(int x) { return x * 18; }
+inline int f55_19(int x) { return x * 19; }
+inline int f55_20(int x) { return x * 20; }
+inline int f55_21(int x) { return x * 21; }
+inline int f55_22(int x) { return x * 22; }
+inline int f55_23(int x) { return x * 23; }
+inline int f55_24(int x) { return x * 24; }
+inline int f55_25(int x) { return x * 25; }
+inline int f55_26(int x) { return x * 26; }
+inline int f55_27(int x) { return x * 27; }
+inline int f55_28(int x) { return x * 28; }
+inline int f55_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 550 */
+#include <vector>
+#include "h2956.h"
+#include "h3465.h"
+#include "h8576.h"
+#include "h6009.h"
+#include "h5848.h"
+#ifdef X
+#include "h7296.h"
+#endif
+struct S550 { int a; const char *s = "x//y"; };
+inline int f550_0(int x) { return x * 0; }
+inline int f550_1(int x) { return x * 1; }
+inline int f550_2(int x) { return x * 2; }
+inline int f550_3(int x) { return x * 3; }
+inline int f550_4(int x) { return x * 4; }
+inline int f550_5(int x) { return x * 5; }
+inline int f550_6(int x) { return x * 6; }
+inline int f550_7(int x) { return x * 7; }
+inline int f550_8(int x) { return x * 8; }
+inline int f550_9(int x) { return x * 9; }
+inline int f550_10(int x) { return x * 10; }
+inline int f550_11(int x) { return x * 11; }
+inline int f550_12(int x) { return x * 12; }
+inline int f550_13(int x) { return x * 13; }
+inline int f550_14(int x) { return x * 14; }
+inline int f550_15(int x) { return x * 15; }
+inline int f550_16(int x) { return x * 16; }
+inline int f550_17(int x) { return x * 17; }
+inline int f550_18(int x) { return x * 18; }
+inline int f550_19(int x) { return x * 19; }
+inline int f550_20(int x) { return x * 20; }
+inline int f550_21(int x) { return x * 21; }
+inline int f550_22(int x) { return x * 22; }
+inline int f550_23(int x) { return x * 23; }
+inline int f550_24(int x) { return x * 24; }
+inline int f550_25(int x) { return x * 25; }
+inline int f550_26(int x) { return x * 26; }
+inline int f550_27(int x) { return x * 27; }
+inline int f550_28(int x) { return x * 28; }
+inline int f550_29(int x) { return x * 29; }
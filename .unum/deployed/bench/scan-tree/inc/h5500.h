@@ -0,0 +1,42 @@
+#pragma once
+/* header 5500 */
+#include <vector>
+#include "h8100.h"
+#include "h6547.h"
+#include "h274.h"
+#include "h859.h"
+#include "h777.h"
+#ifdef X
+#include "h6620.h"
+#endif
+struct S5500 { int a; const char *s = "x//y"; };
+inline int f5500_0(int x) { return x * 0; }
+inline int f5500_1(int x) { return x * 1; }
+inline int f5500_2(int x) { return x * 2; }
+inline int f5500_3(int x) { return x * 3; }
+inline int f5500_4(int x) { return x * 4; }
+inline int f5500_5(int x) { return x * 5; }
+inline int f5500_6(int x) { return x * 6; }
+inline int f5500_7(int x) { return x * 7; }
+inline int f5500_8(int x) { return x * 8; }
+inline int f5500_9(int x) { return x * 9; }
+inline int f5500_10(int x) { return x * 10; }
+inline int f5500_11(int x) { return x * 11; }
+inline int f5500_12(int x) { return x * 12; }
+inline int f5500_13(int x) { return x * 13; }
+inline int f5500_14(int x) { return x * 14; }
+inline int f5500_15(int x) { return x * 15; }
+inline int f5500_16(int x) { return x * 16; }
+inline int f5500_17(int x) { return x * 17; }
+inline int f5500_18(int x) { return x * 18; }
+inline int f5500_19(int x) { return x * 19; }
+inline int f5500_20(int x) { return x * 20; }
+inline int f5500_21(int x) { return x * 21; }
+inline int f5500_22(int x) { return x * 22; }
+inline int f5500_23(int x) { return x * 23; }
+inline int f5500_24(int x) { return x * 24; }
+inline int f5500_25(int x) { return x * 25; }
+inline int f5500_26(int x) { return x * 26; }
+inline int f5500_27(int x) { return x * 27; }
+inline int f5500_28(int x) { return x * 28; }
+inline int f5500_29(int x) { return x * 29; }
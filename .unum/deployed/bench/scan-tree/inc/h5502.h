@@ -0,0 +1,42 @@
+#pragma once
+/* header 5502 */
+#include <vector>
+#include "h9046.h"
+#include "h3277.h"
+#include "h5412.h"
+#include "h391.h"
+#include "h4748.h"
+#ifdef X
+#include "h2465.h"
+#endif
+struct S5502 { int a; const char *s = "x//y"; };
+inline int f5502_0(int x) { return x * 0; }
+inline int f5502_1(int x) { return x * 1; }
+inline int f5502_2(int x) { return x * 2; }
+inline int f5502_3(int x) { return x * 3; }
+inline int f5502_4(int x) { return x * 4; }
+inline int f5502_5(int x) { return x * 5; }
+inline int f5502_6(int x) { return x * 6; }
+inline int f5502_7(int x) { return x * 7; }
+inline int f5502_8(int x) { return x * 8; }
+inline int f5502_9(int x) { return x * 9; }
+inline int f5502_10(int x) { return x * 10; }
+inline int f5502_11(int x) { return x * 11; }
+inline int f5502_12(int x) { return x * 12; }
+inline int f5502_13(int x) { return x * 13; }
+inline int f5502_14(int x) { return x * 14; }
+inline int f5502_15(int x) { return x * 15; }
+inline int f5502_16(int x) { return x * 16; }
+inline int f5502_17(int x) { return x * 17; }
+inline int f5502_18(int x) { return x * 18; }
+inline int f5502_19(int x) { return x * 19; }
+inline int f5502_20(int x) { return x * 20; }
+inline int f5502_21(int x) { return x * 21; }
+inline int f5502_22(int x) { return x * 22; }
+inline int f5502_23(int x) { return x * 23; }
+inline int f5502_24(int x) { return x * 24; }
+inline int f5502_25(int x) { return x * 25; }
+inline int f5502_26(int x) { return x * 26; }
+inline int f5502_27(int x) { return x * 27; }
+inline int f5502_28(int x) { return x * 28; }
+inline int f5502_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5504 */
+#include <vector>
+#include "h6003.h"
+#include "h5767.h"
+#include "h4977.h"
+#include "h604.h"
+#include "h2436.h"
+#ifdef X
+#include "h9361.h"
+#endif
+struct S5504 { int a; const char *s = "x//y"; };
+inline int f5504_0(int x) { return x * 0; }
+inline int f5504_1(int x) { return x * 1; }
+inline int f5504_2(int x) { return x * 2; }
+inline int f5504_3(int x) { return x * 3; }
+inline int f5504_4(int x) { return x * 4; }
+inline int f5504_5(int x) { return x * 5; }
+inline int f5504_6(int x) { return x * 6; }
+inline int f5504_7(int x) { return x * 7; }
+inline int f5504_8(int x) { return x * 8; }
+inline int f5504_9(int x) { return x * 9; }
+inline int f5504_10(int x) { return x * 10; }
+inline int f5504_11(int x) { return x * 11; }
+inline int f5504_12(int x) { return x * 12; }
+inline int f5504_13(int x) { return x * 13; }
+inline int f5504_14(int x) { return x * 14; }
+inline int f5504_15(int x) { return x * 15; }
+inline int f5504_16(int x) { return x * 16; }
+inline int f5504_17(int x) { return x * 17; }
+inline int f5504_18(int x) { return x * 18; }
+inline int f5504_19(int x) { return x * 19; }
+inline int f5504_20(int x) { return x * 20; }
+inline int f5504_21(int x) { return x * 21; }
+inline int f5504_22(int x) { return x * 22; }
+inline int f5504_23(int x) { return x * 23; }
+inline int f5504_24(int x) { return x * 24; }
+inline int f5504_25(int x) { return x * 25; }
+inline int f5504_26(int x) { return x * 26; }
+inline int f5504_27(int x) { return x * 27; }
+inline int f5504_28(int x) { return x * 28; }
+inline int f5504_29(int x) { return x * 29; }
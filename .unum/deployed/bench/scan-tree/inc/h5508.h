@@ -0,0 +1,42 @@
+#pragma once
+/* header 5508 */
+#include <vector>
+#include "h2249.h"
+#include "h651.h"
+#include "h8034.h"
+#include "h3031.h"
+#include "h5891.h"
+#ifdef X
+#include "h109.h"
+#endif
+struct S5508 { int a; const char *s = "x//y"; };
+inline int f5508_0(int x) { return x * 0; }
+inline int f5508_1(int x) { return x * 1; }
+inline int f5508_2(int x) { return x * 2; }
+inline int f5508_3(int x) { return x * 3; }
+inline int f5508_4(int x) { return x * 4; }
+inline int f5508_5(int x) { return x * 5; }
+inline int f5508_6(int x) { return x * 6; }
+inline int f5508_7(int x) { return x * 7; }
+inline int f5508_8(int x) { return x * 8; }
+inline int f5508_9(int x) { return x * 9; }
+inline int f5508_10(int x) { return x * 10; }
+inline int f5508_11(int x) { return x * 11; }
+inline int f5508_12(int x) { return x * 12; }
+inline int f5508_13(int x) { return x * 13; }
+inline int f5508_14(int x) { return x * 14; }
+inline int f5508_15(int x) { return x * 15; }
+inline int f5508_16(int x) { return x * 16; }
+inline int f5508_17(int x) { return x * 17; }
+inline int f5508_18(int x) { return x * 18; }
+inline int f5508_19(int x) { return x * 19; }
+inline int f5508_20(int x) { return x * 20; }
+inline int f5508_21(int x) { return x * 21; }
+inline int f5508_22(int x) { return x * 22; }
+inline int f5508_23(int x) { return x * 23; }
+inline int f5508_24(int x) { return x * 24; }
+inline int f5508_25(int x) { return x * 25; }
+inline int f5508_26(int x) { return x * 26; }
+inline int f5508_27(int x) { return x * 27; }
+inline int f5508_28(int x) { return x * 28; }
+inline int f5508_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5509 */
+#include <vector>
+#include "h4357.h"
+#include "h4269.h"
+#include "h4406.h"
+#include "h7449.h"
+#include "h2040.h"
+#ifdef X
+#include "h6165.h"
+#endif
+struct S5509 { int a; const char *s = "x//y"; };
+inline int f5509_0(int x) { return x * 0; }
+inline int f5509_1(int x) { return x * 1; }
+inline int f5509_2(int x) { return x * 2; }
+inline int f5509_3(int x) { return x * 3; }
+inline int f5509_4(int x) { return x * 4; }
+inline int f5509_5(int x) { return x * 5; }
+inline int f5509_6(int x) { return x * 6; }
+inline int f5509_7(int x) { return x * 7; }
+inline int f5509_8(int x) { return x * 8; }
+inline int f5509_9(int x) { return x * 9; }
+inline int f5509_10(int x) { return x * 10; }
+inline int f5509_11(int x) { return x * 11; }
+inline int f5509_12(int x) { return x * 12; }
+inline int f5509_13(int x) { return x * 13; }
+inline int f5509_14(int x) { return x * 14; }
+inline int f5509_15(int x) { return x * 15; }
+inline int f5509_16(int x) { return x * 16; }
+inline int f5509_17(int x) { return x * 17; }
+inline int f5509_18(int x) { return x * 18; }
+inline int f5509_19(int x) { return x * 19; }
+inline int f5509_20(int x) { return x * 20; }
+inline int f5509_21(int x) { return x * 21; }
+inline int f5509_22(int x) { return x * 22; }
+inline int f5509_23(int x) { return x * 23; }
+inline int f5509_24(int x) { return x * 24; }
+inline int f5509_25(int x) { return x * 25; }
+inline int f5509_26(int x) { return x * 26; }
+inline int f5509_27(int x) { return x * 27; }
+inline int f5509_28(int x) { return x * 28; }
+inline int f5509_29(int x) { return x * 29; }
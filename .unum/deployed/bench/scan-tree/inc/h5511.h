@@ -0,0 +1,42 @@
+#pragma once
+/* header 5511 */
+#include <vector>
+#include "h4863.h"
+#include "h9467.h"
+#include "h521.h"
+#include "h8492.h"
+#include "h1401.h"
+#ifdef X
+#include "h9860.h"
+#endif
+struct S5511 { int a; const char *s = "x//y"; };
+inline int f5511_0(int x) { return x * 0; }
+inline int f5511_1(int x) { return x * 1; }
+inline int f5511_2(int x) { return x * 2; }
+inline int f5511_3(int x) { return x * 3; }
+inline int f5511_4(int x) { return x * 4; }
+inline int f5511_5(int x) { return x * 5; }
+inline int f5511_6(int x) { return x * 6; }
+inline int f5511_7(int x) { return x * 7; }
+inline int f5511_8(int x) { return x * 8; }
+inline int f5511_9(int x) { return x * 9; }
+inline int f5511_10(int x) { return x * 10; }
+inline int f5511_11(int x) { return x * 11; }
+inline int f5511_12(int x) { return x * 12; }
+inline int f5511_13(int x) { return x * 13; }
+inline int f5511_14(int x) { return x * 14; }
+inline int f5511_15(int x) { return x * 15; }
+inline int f5511_16(int x) { return x * 16; }
+inline int f5511_17(int x) { return x * 17; }
+inline int f5511_18(int x) { return x * 18; }
+inline int f5511_19(int x) { return x * 19; }
+inline int f5511_20(int x) { return x * 20; }
+inline int f5511_21(int x) { return x * 21; }
+inline int f5511_22(int x) { return x * 22; }
+inline int f5511_23(int x) { return x * 23; }
+inline int f5511_24(int x) { return x * 24; }
+inline int f5511_25(int x) { return x * 25; }
+inline int f5511_26(int x) { return x * 26; }
+inline int f5511_27(int x) { return x * 27; }
+inline int f5511_28(int x) { return x * 28; }
+inline int f5511_29(int x) { return x * 29; }
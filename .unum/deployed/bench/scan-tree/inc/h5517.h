@@ -0,0 +1,42 @@
+#pragma once
+/* header 5517 */
+#include <vector>
+#include "h6795.h"
+#include "h4014.h"
+#include "h6539.h"
+#include "h2139.h"
+#include "h9233.h"
+#ifdef X
+#include "h8930.h"
+#endif
+struct S5517 { int a; const char *s = "x//y"; };
+inline int f5517_0(int x) { return x * 0; }
+inline int f5517_1(int x) { return x * 1; }
+inline int f5517_2(int x) { return x * 2; }
+inline int f5517_3(int x) { return x * 3; }
+inline int f5517_4(int x) { return x * 4; }
+inline int f5517_5(int x) { return x * 5; }
+inline int f5517_6(int x) { return x * 6; }
+inline int f5517_7(int x) { return x * 7; }
+inline int f5517_8(int x) { return x * 8; }
+inline int f5517_9(int x) { return x * 9; }
+inline int f5517_10(int x) { return x * 10; }
+inline int f5517_11(int x) { return x * 11; }
+inline int f5517_12(int x) { return x * 12; }
+inline int f5517_13(int x) { return x * 13; }
+inline int f5517_14(int x) { return x * 14; }
+inline int f5517_15(int x) { return x * 15; }
+inline int f5517_16(int x) { return x * 16; }
+inline int f5517_17(int x) { return x * 17; }
+inline int f5517_18(int x) { return x * 18; }
+inline int f5517_19(int x) { return x * 19; }
+inline int f5517_20(int x) { return x * 20; }
+inline int f5517_21(int x) { return x * 21; }
+inline int f5517_22(int x) { return x * 22; }
+inline int f5517_23(int x) { return x * 23; }
+inline int f5517_24(int x) { return x * 24; }
+inline int f5517_25(int x) { return x * 25; }
+inline int f5517_26(int x) { return x * 26; }
+inline int f5517_27(int x) { return x * 27; }
+inline int f5517_28(int x) { return x * 28; }
+inline int f5517_29(int x) { return x * 29; }
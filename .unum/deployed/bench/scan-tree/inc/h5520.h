@@ -0,0 +1,42 @@
+#pragma once
+/* header 5520 */
+#include <vector>
+#include "h6032.h"
+#include "h2982.h"
+#include "h1155.h"
+#include "h9318.h"
+#include "h4130.h"
+#ifdef X
+#include "h8758.h"
+#endif
+struct S5520 { int a; const char *s = "x//y"; };
+inline int f5520_0(int x) { return x * 0; }
+inline int f5520_1(int x) { return x * 1; }
+inline int f5520_2(int x) { return x * 2; }
+inline int f5520_3(int x) { return x * 3; }
+inline int f5520_4(int x) { return x * 4; }
+inline int f5520_5(int x) { return x * 5; }
+inline int f5520_6(int x) { return x * 6; }
+inline int f5520_7(int x) { return x * 7; }
+inline int f5520_8(int x) { return x * 8; }
+inline int f5520_9(int x) { return x * 9; }
+inline int f5520_10(int x) { return x * 10; }
+inline int f5520_11(int x) { return x * 11; }
+inline int f5520_12(int x) { return x * 12; }
+inline int f5520_13(int x) { return x * 13; }
+inline int f5520_14(int x) { return x * 14; }
+inline int f5520_15(int x) { return x * 15; }
+inline int f5520_16(int x) { return x * 16; }
+inline int f5520_17(int x) { return x * 17; }
+inline int f5520_18(int x) { return x * 18; }
+inline int f5520_19(int x) { return x * 19; }
+inline int f5520_20(int x) { return x * 20; }
+inline int f5520_21(int x) { return x * 21; }
+inline int f5520_22(int x) { return x * 22; }
+inline int f5520_23(int x) { return x * 23; }
+inline int f5520_24(int x) { return x * 24; }
+inline int f5520_25(int x) { return x * 25; }
+inline int f5520_26(int x) { return x * 26; }
+inline int f5520_27(int x) { return x * 27; }
+inline int f5520_28(int x) { return x * 28; }
+inline int f5520_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5521 */
+#include <vector>
+#include "h5858.h"
+#include "h4382.h"
+#include "h5780.h"
+#include "h9720.h"
+#include "h9421.h"
+#ifdef X
+#include "h1057.h"
+#endif
+struct S5521 { int a; const char *s = "x//y"; };
+inline int f5521_0(int x) { return x * 0; }
+inline int f5521_1(int x) { return x * 1; }
+inline int f5521_2(int x) { return x * 2; }
+inline int f5521_3(int x) { return x * 3; }
+inline int f5521_4(int x) { return x * 4; }
+inline int f5521_5(int x) { return x * 5; }
+inline int f5521_6(int x) { return x * 6; }
+inline int f5521_7(int x) { return x * 7; }
+inline int f5521_8(int x) { return x * 8; }
+inline int f5521_9(int x) { return x * 9; }
+inline int f5521_10(int x) { return x * 10; }
+inline int f5521_11(int x) { return x * 11; }
+inline int f5521_12(int x) { return x * 12; }
+inline int f5521_13(int x) { return x * 13; }
+inline int f5521_14(int x) { return x * 14; }
+inline int f5521_15(int x) { return x * 15; }
+inline int f5521_16(int x) { return x * 16; }
+inline int f5521_17(int x) { return x * 17; }
+inline int f5521_18(int x) { return x * 18; }
+inline int f5521_19(int x) { return x * 19; }
+inline int f5521_20(int x) { return x * 20; }
+inline int f5521_21(int x) { return x * 21; }
+inline int f5521_22(int x) { return x * 22; }
+inline int f5521_23(int x) { return x * 23; }
+inline int f5521_24(int x) { return x * 24; }
+inline int f5521_25(int x) { return x * 25; }
+inline int f5521_26(int x) { return x * 26; }
+inline int f5521_27(int x) { return x * 27; }
+inline int f5521_28(int x) { return x * 28; }
+inline int f5521_29(int x) { return x * 29; }
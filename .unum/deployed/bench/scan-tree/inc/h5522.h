@@ -0,0 +1,42 @@
+#pragma once
+/* header 5522 */
+#include <vector>
+#include "h989.h"
+#include "h2678.h"
+#include "h9466.h"
+#include "h4073.h"
+#include "h3602.h"
+#ifdef X
+#include "h1077.h"
+#endif
+struct S5522 { int a; const char *s = "x//y"; };
+inline int f5522_0(int x) { return x * 0; }
+inline int f5522_1(int x) { return x * 1; }
+inline int f5522_2(int x) { return x * 2; }
+inline int f5522_3(int x) { return x * 3; }
+inline int f5522_4(int x) { return x * 4; }
+inline int f5522_5(int x) { return x * 5; }
+inline int f5522_6(int x) { return x * 6; }
+inline int f5522_7(int x) { return x * 7; }
+inline int f5522_8(int x) { return x * 8; }
+inline int f5522_9(int x) { return x * 9; }
+inline int f5522_10(int x) { return x * 10; }
+inline int f5522_11(int x) { return x * 11; }
+inline int f5522_12(int x) { return x * 12; }
+inline int f5522_13(int x) { return x * 13; }
+inline int f5522_14(int x) { return x * 14; }
+inline int f5522_15(int x) { return x * 15; }
+inline int f5522_16(int x) { return x * 16; }
+inline int f5522_17(int x) { return x * 17; }
+inline int f5522_18(int x) { return x * 18; }
+inline int f5522_19(int x) { return x * 19; }
+inline int f5522_20(int x) { return x * 20; }
+inline int f5522_21(int x) { return x * 21; }
+inline int f5522_22(int x) { return x * 22; }
+inline int f5522_23(int x) { return x * 23; }
+inline int f5522_24(int x) { return x * 24; }
+inline int f5522_25(int x) { return x * 25; }
+inline int f5522_26(int x) { return x * 26; }
+inline int f5522_27(int x) { return x * 27; }
+inline int f5522_28(int x) { return x * 28; }
+inline int f5522_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5524 */
+#include <vector>
+#include "h4462.h"
+#include "h5199.h"
+#include "h2862.h"
+#include "h2437.h"
+#include "h6429.h"
+#ifdef X
+#include "h436.h"
+#endif
+struct S5524 { int a; const char *s = "x//y"; };
+inline int f5524_0(int x) { return x * 0; }
+inline int f5524_1(int x) { return x * 1; }
+inline int f5524_2(int x) { return x * 2; }
+inline int f5524_3(int x) { return x * 3; }
+inline int f5524_4(int x) { return x * 4; }
+inline int f5524_5(int x) { return x * 5; }
+inline int f5524_6(int x) { return x * 6; }
+inline int f5524_7(int x) { return x * 7; }
+inline int f5524_8(int x) { return x * 8; }
+inline int f5524_9(int x) { return x * 9; }
+inline int f5524_10(int x) { return x * 10; }
+inline int f5524_11(int x) { return x * 11; }
+inline int f5524_12(int x) { return x * 12; }
+inline int f5524_13(int x) { return x * 13; }
+inline int f5524_14(int x) { return x * 14; }
+inline int f5524_15(int x) { return x * 15; }
+inline int f5524_16(int x) { return x * 16; }
+inline int f5524_17(int x) { return x * 17; }
+inline int f5524_18(int x) { return x * 18; }
+inline int f5524_19(int x) { return x * 19; }
+inline int f5524_20(int x) { return x * 20; }
+inline int f5524_21(int x) { return x * 21; }
+inline int f5524_22(int x) { return x * 22; }
+inline int f5524_23(int x) { return x * 23; }
+inline int f5524_24(int x) { return x * 24; }
+inline int f5524_25(int x) { return x * 25; }
+inline int f5524_26(int x) { return x * 26; }
+inline int f5524_27(int x) { return x * 27; }
+inline int f5524_28(int x) { return x * 28; }
+inline int f5524_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5526 */
+#include <vector>
+#include "h7152.h"
+#include "h1804.h"
+#include "h9751.h"
+#include "h8270.h"
+#include "h2134.h"
+#ifdef X
+#include "h8969.h"
+#endif
+struct S5526 { int a; const char *s = "x//y"; };
+inline int f5526_0(int x) { return x * 0; }
+inline int f5526_1(int x) { return x * 1; }
+inline int f5526_2(int x) { return x * 2; }
+inline int f5526_3(int x) { return x * 3; }
+inline int f5526_4(int x) { return x * 4; }
+inline int f5526_5(int x) { return x * 5; }
+inline int f5526_6(int x) { return x * 6; }
+inline int f5526_7(int x) { return x * 7; }
+inline int f5526_8(int x) { return x * 8; }
+inline int f5526_9(int x) { return x * 9; }
+inline int f5526_10(int x) { return x * 10; }
+inline int f5526_11(int x) { return x * 11; }
+inline int f5526_12(int x) { return x * 12; }
+inline int f5526_13(int x) { return x * 13; }
+inline int f5526_14(int x) { return x * 14; }
+inline int f5526_15(int x) { return x * 15; }
+inline int f5526_16(int x) { return x * 16; }
+inline int f5526_17(int x) { return x * 17; }
+inline int f5526_18(int x) { return x * 18; }
+inline int f5526_19(int x) { return x * 19; }
+inline int f5526_20(int x) { return x * 20; }
+inline int f5526_21(int x) { return x * 21; }
+inline int f5526_22(int x) { return x * 22; }
+inline int f5526_23(int x) { return x * 23; }
+inline int f5526_24(int x) { return x * 24; }
+inline int f5526_25(int x) { return x * 25; }
+inline int f5526_26(int x) { return x * 26; }
+inline int f5526_27(int x) { return x * 27; }
+inline int f5526_28(int x) { return x * 28; }
+inline int f5526_29(int x) { return x * 29; }
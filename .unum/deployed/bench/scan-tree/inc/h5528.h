@@ -0,0 +1,42 @@
+#pragma once
+/* header 5528 */
+#include <vector>
+#include "h3551.h"
+#include "h2415.h"
+#include "h6120.h"
+#include "h8135.h"
+#include "h5730.h"
+#ifdef X
+#include "h23.h"
+#endif
+struct S5528 { int a; const char *s = "x//y"; };
+inline int f5528_0(int x) { return x * 0; }
+inline int f5528_1(int x) { return x * 1; }
+inline int f5528_2(int x) { return x * 2; }
+inline int f5528_3(int x) { return x * 3; }
+inline int f5528_4(int x) { return x * 4; }
+inline int f5528_5(int x) { return x * 5; }
+inline int f5528_6(int x) { return x * 6; }
+inline int f5528_7(int x) { return x * 7; }
+inline int f5528_8(int x) { return x * 8; }
+inline int f5528_9(int x) { return x * 9; }
+inline int f5528_10(int x) { return x * 10; }
+inline int f5528_11(int x) { return x * 11; }
+inline int f5528_12(int x) { return x * 12; }
+inline int f5528_13(int x) { return x * 13; }
+inline int f5528_14(int x) { return x * 14; }
+inline int f5528_15(int x) { return x * 15; }
+inline int f5528_16(int x) { return x * 16; }
+inline int f5528_17(int x) { return x * 17; }
+inline int f5528_18(int x) { return x * 18; }
+inline int f5528_19(int x) { return x * 19; }
+inline int f5528_20(int x) { return x * 20; }
+inline int f5528_21(int x) { return x * 21; }
+inline int f5528_22(int x) { return x * 22; }
+inline int f5528_23(int x) { return x * 23; }
+inline int f5528_24(int x) { return x * 24; }
+inline int f5528_25(int x) { return x * 25; }
+inline int f5528_26(int x) { return x * 26; }
+inline int f5528_27(int x) { return x * 27; }
+inline int f5528_28(int x) { return x * 28; }
+inline int f5528_29(int x) { return x * 29; }
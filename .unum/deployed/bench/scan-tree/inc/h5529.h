@@ -0,0 +1,42 @@
+#pragma once
+/* header 5529 */
+#include <vector>
+#include "h7910.h"
+#include "h1222.h"
+#include "h7776.h"
+#include "h9706.h"
+#include "h9722.h"
+#ifdef X
+#include "h6483.h"
+#endif
+struct S5529 { int a; const char *s = "x//y"; };
+inline int f5529_0(int x) { return x * 0; }
+inline int f5529_1(int x) { return x * 1; }
+inline int f5529_2(int x) { return x * 2; }
+inline int f5529_3(int x) { return x * 3; }
+inline int f5529_4(int x) { return x * 4; }
+inline int f5529_5(int x) { return x * 5; }
+inline int f5529_6(int x) { return x * 6; }
+inline int f5529_7(int x) { return x * 7; }
+inline int f5529_8(int x) { return x * 8; }
+inline int f5529_9(int x) { return x * 9; }
+inline int f5529_10(int x) { return x * 10; }
+inline int f5529_11(int x) { return x * 11; }
+inline int f5529_12(int x) { return x * 12; }
+inline int f5529_13(int x) { return x * 13; }
+inline int f5529_14(int x) { return x * 14; }
+inline int f5529_15(int x) { return x * 15; }
+inline int f5529_16(int x) { return x * 16; }
+inline int f5529_17(int x) { return x * 17; }
+inline int f5529_18(int x) { return x * 18; }
+inline int f5529_19(int x) { return x * 19; }
+inline int f5529_20(int x) { return x * 20; }
+inline int f5529_21(int x) { return x * 21; }
+inline int f5529_22(int x) { return x * 22; }
+inline int f5529_23(int x) { return x * 23; }
+inline int f5529_24(int x) { return x * 24; }
+inline int f5529_25(int x) { return x * 25; }
+inline int f5529_26(int x) { return x * 26; }
+inline int f5529_27(int x) { return x * 27; }
+inline int f5529_28(int x) { return x * 28; }
+inline int f5529_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 553 */
+#include <vector>
+#include "h5924.h"
+#include "h1562.h"
+#include "h7793.h"
+#include "h2764.h"
+#include "h5757.h"
+#ifdef X
+#include "h364.h"
+#endif
+struct S553 { int a; const char *s = "x//y"; };
+inline int f553_0(int x) { return x * 0; }
+inline int f553_1(int x) { return x * 1; }
+inline int f553_2(int x) { return x * 2; }
+inline int f553_3(int x) { return x * 3; }
+inline int f553_4(int x) { return x * 4; }
+inline int f553_5(int x) { return x * 5; }
+inline int f553_6(int x) { return x * 6; }
+inline int f553_7(int x) { return x * 7; }
+inline int f553_8(int x) { return x * 8; }
+inline int f553_9(int x) { return x * 9; }
+inline int f553_10(int x) { return x * 10; }
+inline int f553_11(int x) { return x * 11; }
+inline int f553_12(int x) { return x * 12; }
+inline int f553_13(int x) { return x * 13; }
+inline int f553_14(int x) { return x * 14; }
+inline int f553_15(int x) { return x * 15; }
+inline int f553_16(int x) { return x * 16; }
+inline int f553_17(int x) { return x * 17; }
+inline int f553_18(int x) { return x * 18; }
+inline int f553_19(int x) { return x * 19; }
+inline int f553_20(int x) { return x * 20; }
+inline int f553_21(int x) { return x * 21; }
+inline int f553_22(int x) { return x * 22; }
+inline int f553_23(int x) { return x * 23; }
+inline int f553_24(int x) { return x * 24; }
+inline int f553_25(int x) { return x * 25; }
+inline int f553_26(int x) { return x * 26; }
+inline int f553_27(int x) { return x * 27; }
+inline int f553_28(int x) { return x * 28; }
+inline int f553_29(int x) { return x * 29; }
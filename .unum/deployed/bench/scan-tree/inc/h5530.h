@@ -0,0 +1,42 @@
+#pragma once
+/* header 5530 */
+#include <vector>
+#include "h6356.h"
+#include "h374.h"
+#include "h2104.h"
+#include "h2642.h"
+#include "h7271.h"
+#ifdef X
+#include "h500.h"
+#endif
+struct S5530 { int a; const char *s = "x//y"; };
+inline int f5530_0(int x) { return x * 0; }
+inline int f5530_1(int x) { return x * 1; }
+inline int f5530_2(int x) { return x * 2; }
+inline int f5530_3(int x) { return x * 3; }
+inline int f5530_4(int x) { return x * 4; }
+inline int f5530_5(int x) { return x * 5; }
+inline int f5530_6(int x) { return x * 6; }
+inline int f5530_7(int x) { return x * 7; }
+inline int f5530_8(int x) { return x * 8; }
+inline int f5530_9(int x) { return x * 9; }
+inline int f5530_10(int x) { return x * 10; }
+inline int f5530_11(int x) { return x * 11; }
+inline int f5530_12(int x) { return x * 12; }
+inline int f5530_13(int x) { return x * 13; }
+inline int f5530_14(int x) { return x * 14; }
+inline int f5530_15(int x) { return x * 15; }
+inline int f5530_16(int x) { return x * 16; }
+inline int f5530_17(int x) { return x * 17; }
+inline int f5530_18(int x) { return x * 18; }
+inline int f5530_19(int x) { return x * 19; }
+inline int f5530_20(int x) { return x * 20; }
+inline int f5530_21(int x) { return x * 21; }
+inline int f5530_22(int x) { return x * 22; }
+inline int f5530_23(int x) { return x * 23; }
+inline int f5530_24(int x) { return x * 24; }
+inline int f5530_25(int x) { return x * 25; }
+inline int f5530_26(int x) { return x * 26; }
+inline int f5530_27(int x) { return x * 27; }
+inline int f5530_28(int x) { return x * 28; }
+inline int f5530_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5532 */
+#include <vector>
+#include "h709.h"
+#include "h1369.h"
+#include "h6996.h"
+#include "h1695.h"
+#include "h9268.h"
+#ifdef X
+#include "h5555.h"
+#endif
+struct S5532 { int a; const char *s = "x//y"; };
+inline int f5532_0(int x) { return x * 0; }
+inline int f5532_1(int x) { return x * 1; }
+inline int f5532_2(int x) { return x * 2; }
+inline int f5532_3(int x) { return x * 3; }
+inline int f5532_4(int x) { return x * 4; }
+inline int f5532_5(int x) { return x * 5; }
+inline int f5532_6(int x) { return x * 6; }
+inline int f5532_7(int x) { return x * 7; }
+inline int f5532_8(int x) { return x * 8; }
+inline int f5532_9(int x) { return x * 9; }
+inline int f5532_10(int x) { return x * 10; }
+inline int f5532_11(int x) { return x * 11; }
+inline int f5532_12(int x) { return x * 12; }
+inline int f5532_13(int x) { return x * 13; }
+inline int f5532_14(int x) { return x * 14; }
+inline int f5532_15(int x) { return x * 15; }
+inline int f5532_16(int x) { return x * 16; }
+inline int f5532_17(int x) { return x * 17; }
+inline int f5532_18(int x) { return x * 18; }
+inline int f5532_19(int x) { return x * 19; }
+inline int f5532_20(int x) { return x * 20; }
+inline int f5532_21(int x) { return x * 21; }
+inline int f5532_22(int x) { return x * 22; }
+inline int f5532_23(int x) { return x * 23; }
+inline int f5532_24(int x) { return x * 24; }
+inline int f5532_25(int x) { return x * 25; }
+inline int f5532_26(int x) { return x * 26; }
+inline int f5532_27(int x) { return x * 27; }
+inline int f5532_28(int x) { return x * 28; }
+inline int f5532_29(int x) { return x * 29; }
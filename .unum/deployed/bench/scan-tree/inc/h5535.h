@@ -0,0 +1,42 @@
+#pragma once
+/* header 5535 */
+#include <vector>
+#include "h3390.h"
+#include "h4204.h"
+#include "h6339.h"
+#include "h2821.h"
+#include "h3421.h"
+#ifdef X
+#include "h1734.h"
+#endif
+struct S5535 { int a; const char *s = "x//y"; };
+inline int f5535_0(int x) { return x * 0; }
+inline int f5535_1(int x) { return x * 1; }
+inline int f5535_2(int x) { return x * 2; }
+inline int f5535_3(int x) { return x * 3; }
+inline int f5535_4(int x) { return x * 4; }
+inline int f5535_5(int x) { return x * 5; }
+inline int f5535_6(int x) { return x * 6; }
+inline int f5535_7(int x) { return x * 7; }
+inline int f5535_8(int x) { return x * 8; }
+inline int f5535_9(int x) { return x * 9; }
+inline int f5535_10(int x) { return x * 10; }
+inline int f5535_11(int x) { return x * 11; }
+inline int f5535_12(int x) { return x * 12; }
+inline int f5535_13(int x) { return x * 13; }
+inline int f5535_14(int x) { return x * 14; }
+inline int f5535_15(int x) { return x * 15; }
+inline int f5535_16(int x) { return x * 16; }
+inline int f5535_17(int x) { return x * 17; }
+inline int f5535_18(int x) { return x * 18; }
+inline int f5535_19(int x) { return x * 19; }
+inline int f5535_20(int x) { return x * 20; }
+inline int f5535_21(int x) { return x * 21; }
+inline int f5535_22(int x) { return x * 22; }
+inline int f5535_23(int x) { return x * 23; }
+inline int f5535_24(int x) { return x * 24; }
+inline int f5535_25(int x) { return x * 25; }
+inline int f5535_26(int x) { return x * 26; }
+inline int f5535_27(int x) { return x * 27; }
+inline int f5535_28(int x) { return x * 28; }
+inline int f5535_29(int x) { return x * 29; }
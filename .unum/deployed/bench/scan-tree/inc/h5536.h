@@ -0,0 +1,42 @@
+#pragma once
+/* header 5536 */
+#include <vector>
+#include "h8021.h"
+#include "h8079.h"
+#include "h7179.h"
+#include "h1236.h"
+#include "h8653.h"
+#ifdef X
+#include "h1099.h"
+#endif
+struct S5536 { int a; const char *s = "x//y"; };
+inline int f5536_0(int x) { return x * 0; }
+inline int f5536_1(int x) { return x * 1; }
+inline int f5536_2(int x) { return x * 2; }
+inline int f5536_3(int x) { return x * 3; }
+inline int f5536_4(int x) { return x * 4; }
+inline int f5536_5(int x) { return x * 5; }
+inline int f5536_6(int x) { return x * 6; }
+inline int f5536_7(int x) { return x * 7; }
+inline int f5536_8(int x) { return x * 8; }
+inline int f5536_9(int x) { return x * 9; }
+inline int f5536_10(int x) { return x * 10; }
+inline int f5536_11(int x) { return x * 11; }
+inline int f5536_12(int x) { return x * 12; }
+inline int f5536_13(int x) { return x * 13; }
+inline int f5536_14(int x) { return x * 14; }
+inline int f5536_15(int x) { return x * 15; }
+inline int f5536_16(int x) { return x * 16; }
+inline int f5536_17(int x) { return x * 17; }
+inline int f5536_18(int x) { return x * 18; }
+inline int f5536_19(int x) { return x * 19; }
+inline int f5536_20(int x) { return x * 20; }
+inline int f5536_21(int x) { return x * 21; }
+inline int f5536_22(int x) { return x * 22; }
+inline int f5536_23(int x) { return x * 23; }
+inline int f5536_24(int x) { return x * 24; }
+inline int f5536_25(int x) { return x * 25; }
+inline int f5536_26(int x) { return x * 26; }
+inline int f5536_27(int x) { return x * 27; }
+inline int f5536_28(int x) { return x * 28; }
+inline int f5536_29(int x) { return x * 29; }
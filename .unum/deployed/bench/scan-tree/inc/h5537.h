@@ -0,0 +1,42 @@
+#pragma once
+/* header 5537 */
+#include <vector>
+#include "h57.h"
+#include "h5090.h"
+#include "h2636.h"
+#include "h389.h"
+#include "h922.h"
+#ifdef X
+#include "h9785.h"
+#endif
+struct S5537 { int a; const char *s = "x//y"; };
+inline int f5537_0(int x) { return x * 0; }
+inline int f5537_1(int x) { return x * 1; }
+inline int f5537_2(int x) { return x * 2; }
+inline int f5537_3(int x) { return x * 3; }
+inline int f5537_4(int x) { return x * 4; }
+inline int f5537_5(int x) { return x * 5; }
+inline int f5537_6(int x) { return x * 6; }
+inline int f5537_7(int x) { return x * 7; }
+inline int f5537_8(int x) { return x * 8; }
+inline int f5537_9(int x) { return x * 9; }
+inline int f5537_10(int x) { return x * 10; }
+inline int f5537_11(int x) { return x * 11; }
+inline int f5537_12(int x) { return x * 12; }
+inline int f5537_13(int x) { return x * 13; }
+inline int f5537_14(int x) { return x * 14; }
+inline int f5537_15(int x) { return x * 15; }
+inline int f5537_16(int x) { return x * 16; }
+inline int f5537_17(int x) { return x * 17; }
+inline int f5537_18(int x) { return x * 18; }
+inline int f5537_19(int x) { return x * 19; }
+inline int f5537_20(int x) { return x * 20; }
+inline int f5537_21(int x) { return x * 21; }
+inline int f5537_22(int x) { return x * 22; }
+inline int f5537_23(int x) { return x * 23; }
+inline int f5537_24(int x) { return x * 24; }
+inline int f5537_25(int x) { return x * 25; }
+inline int f5537_26(int x) { return x * 26; }
+inline int f5537_27(int x) { return x * 27; }
+inline int f5537_28(int x) { return x * 28; }
+inline int f5537_29(int x) { return x * 29; }
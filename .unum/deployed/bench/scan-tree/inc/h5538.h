@@ -0,0 +1,42 @@
+#pragma once
+/* header 5538 */
+#include <vector>
+#include "h2957.h"
+#include "h708.h"
+#include "h8625.h"
+#include "h1428.h"
+#include "h7250.h"
+#ifdef X
+#include "h7662.h"
+#endif
+struct S5538 { int a; const char *s = "x//y"; };
+inline int f5538_0(int x) { return x * 0; }
+inline int f5538_1(int x) { return x * 1; }
+inline int f5538_2(int x) { return x * 2; }
+inline int f5538_3(int x) { return x * 3; }
+inline int f5538_4(int x) { return x * 4; }
+inline int f5538_5(int x) { return x * 5; }
+inline int f5538_6(int x) { return x * 6; }
+inline int f5538_7(int x) { return x * 7; }
+inline int f5538_8(int x) { return x * 8; }
+inline int f5538_9(int x) { return x * 9; }
+inline int f5538_10(int x) { return x * 10; }
+inline int f5538_11(int x) { return x * 11; }
+inline int f5538_12(int x) { return x * 12; }
+inline int f5538_13(int x) { return x * 13; }
+inline int f5538_14(int x) { return x * 14; }
+inline int f5538_15(int x) { return x * 15; }
+inline int f5538_16(int x) { return x * 16; }
+inline int f5538_17(int x) { return x * 17; }
+inline int f5538_18(int x) { return x * 18; }
+inline int f5538_19(int x) { return x * 19; }
+inline int f5538_20(int x) { return x * 20; }
+inline int f5538_21(int x) { return x * 21; }
+inline int f5538_22(int x) { return x * 22; }
+inline int f5538_23(int x) { return x * 23; }
+inline int f5538_24(int x) { return x * 24; }
+inline int f5538_25(int x) { return x * 25; }
+inline int f5538_26(int x) { return x * 26; }
+inline int f5538_27(int x) { return x * 27; }
+inline int f5538_28(int x) { return x * 28; }
+inline int f5538_29(int x) { return x * 29; }
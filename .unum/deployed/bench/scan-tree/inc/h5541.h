@@ -0,0 +1,42 @@
+#pragma once
+/* header 5541 */
+#include <vector>
+#include "h9913.h"
+#include "h8236.h"
+#include "h7109.h"
+#include "h6210.h"
+#include "h7387.h"
+#ifdef X
+#include "h6205.h"
+#endif
+struct S5541 { int a; const char *s = "x//y"; };
+inline int f5541_0(int x) { return x * 0; }
+inline int f5541_1(int x) { return x * 1; }
+inline int f5541_2(int x) { return x * 2; }
+inline int f5541_3(int x) { return x * 3; }
+inline int f5541_4(int x) { return x * 4; }
+inline int f5541_5(int x) { return x * 5; }
+inline int f5541_6(int x) { return x * 6; }
+inline int f5541_7(int x) { return x * 7; }
+inline int f5541_8(int x) { return x * 8; }
+inline int f5541_9(int x) { return x * 9; }
+inline int f5541_10(int x) { return x * 10; }
+inline int f5541_11(int x) { return x * 11; }
+inline int f5541_12(int x) { return x * 12; }
+inline int f5541_13(int x) { return x * 13; }
+inline int f5541_14(int x) { return x * 14; }
+inline int f5541_15(int x) { return x * 15; }
+inline int f5541_16(int x) { return x * 16; }
+inline int f5541_17(int x) { return x * 17; }
+inline int f5541_18(int x) { return x * 18; }
+inline int f5541_19(int x) { return x * 19; }
+inline int f5541_20(int x) { return x * 20; }
+inline int f5541_21(int x) { return x * 21; }
+inline int f5541_22(int x) { return x * 22; }
+inline int f5541_23(int x) { return x * 23; }
+inline int f5541_24(int x) { return x * 24; }
+inline int f5541_25(int x) { return x * 25; }
+inline int f5541_26(int x) { return x * 26; }
+inline int f5541_27(int x) { return x * 27; }
+inline int f5541_28(int x) { return x * 28; }
+inline int f5541_29(int x) { return x * 29; }
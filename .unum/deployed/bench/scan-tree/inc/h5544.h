@@ -0,0 +1,42 @@
+#pragma once
+/* header 5544 */
+#include <vector>
+#include "h4741.h"
+#include "h7588.h"
+#include "h2839.h"
+#include "h6333.h"
+#include "h3128.h"
+#ifdef X
+#include "h529.h"
+#endif
+struct S5544 { int a; const char *s = "x//y"; };
+inline int f5544_0(int x) { return x * 0; }
+inline int f5544_1(int x) { return x * 1; }
+inline int f5544_2(int x) { return x * 2; }
+inline int f5544_3(int x) { return x * 3; }
+inline int f5544_4(int x) { return x * 4; }
+inline int f5544_5(int x) { return x * 5; }
+inline int f5544_6(int x) { return x * 6; }
+inline int f5544_7(int x) { return x * 7; }
+inline int f5544_8(int x) { return x * 8; }
+inline int f5544_9(int x) { return x * 9; }
+inline int f5544_10(int x) { return x * 10; }
+inline int f5544_11(int x) { return x * 11; }
+inline int f5544_12(int x) { return x * 12; }
+inline int f5544_13(int x) { return x * 13; }
+inline int f5544_14(int x) { return x * 14; }
+inline int f5544_15(int x) { return x * 15; }
+inline int f5544_16(int x) { return x * 16; }
+inline int f5544_17(int x) { return x * 17; }
+inline int f5544_18(int x) { return x * 18; }
+inline int f5544_19(int x) { return x * 19; }
+inline int f5544_20(int x) { return x * 20; }
+inline int f5544_21(int x) { return x * 21; }
+inline int f5544_22(int x) { return x * 22; }
+inline int f5544_23(int x) { return x * 23; }
+inline int f5544_24(int x) { return x * 24; }
+inline int f5544_25(int x) { return x * 25; }
+inline int f5544_26(int x) { return x * 26; }
+inline int f5544_27(int x) { return x * 27; }
+inline int f5544_28(int x) { return x * 28; }
+inline int f5544_29(int x) { return x * 29; }
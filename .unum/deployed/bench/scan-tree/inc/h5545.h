@@ -0,0 +1,42 @@
+#pragma once
+/* header 5545 */
+#include <vector>
+#include "h5788.h"
+#include "h8903.h"
+#include "h731.h"
+#include "h2172.h"
+#include "h1083.h"
+#ifdef X
+#include "h6331.h"
+#endif
+struct S5545 { int a; const char *s = "x//y"; };
+inline int f5545_0(int x) { return x * 0; }
+inline int f5545_1(int x) { return x * 1; }
+inline int f5545_2(int x) { return x * 2; }
+inline int f5545_3(int x) { return x * 3; }
+inline int f5545_4(int x) { return x * 4; }
+inline int f5545_5(int x) { return x * 5; }
+inline int f5545_6(int x) { return x * 6; }
+inline int f5545_7(int x) { return x * 7; }
+inline int f5545_8(int x) { return x * 8; }
+inline int f5545_9(int x) { return x * 9; }
+inline int f5545_10(int x) { return x * 10; }
+inline int f5545_11(int x) { return x * 11; }
+inline int f5545_12(int x) { return x * 12; }
+inline int f5545_13(int x) { return x * 13; }
+inline int f5545_14(int x) { return x * 14; }
+inline int f5545_15(int x) { return x * 15; }
+inline int f5545_16(int x) { return x * 16; }
+inline int f5545_17(int x) { return x * 17; }
+inline int f5545_18(int x) { return x * 18; }
+inline int f5545_19(int x) { return x * 19; }
+inline int f5545_20(int x) { return x * 20; }
+inline int f5545_21(int x) { return x * 21; }
+inline int f5545_22(int x) { return x * 22; }
+inline int f5545_23(int x) { return x * 23; }
+inline int f5545_24(int x) { return x * 24; }
+inline int f5545_25(int x) { return x * 25; }
+inline int f5545_26(int x) { return x * 26; }
+inline int f5545_27(int x) { return x * 27; }
+inline int f5545_28(int x) { return x * 28; }
+inline int f5545_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5546 */
+#include <vector>
+#include "h3657.h"
+#include "h979.h"
+#include "h6059.h"
+#include "h9443.h"
+#include "h3932.h"
+#ifdef X
+#include "h4398.h"
+#endif
+struct S5546 { int a; const char *s = "x//y"; };
+inline int f5546_0(int x) { return x * 0; }
+inline int f5546_1(int x) { return x * 1; }
+inline int f5546_2(int x) { return x * 2; }
+inline int f5546_3(int x) { return x * 3; }
+inline int f5546_4(int x) { return x * 4; }
+inline int f5546_5(int x) { return x * 5; }
+inline int f5546_6(int x) { return x * 6; }
+inline int f5546_7(int x) { return x * 7; }
+inline int f5546_8(int x) { return x * 8; }
+inline int f5546_9(int x) { return x * 9; }
+inline int f5546_10(int x) { return x * 10; }
+inline int f5546_11(int x) { return x * 11; }
+inline int f5546_12(int x) { return x * 12; }
+inline int f5546_13(int x) { return x * 13; }
+inline int f5546_14(int x) { return x * 14; }
+inline int f5546_15(int x) { return x * 15; }
+inline int f5546_16(int x) { return x * 16; }
+inline int f5546_17(int x) { return x * 17; }
+inline int f5546_18(int x) { return x * 18; }
+inline int f5546_19(int x) { return x * 19; }
+inline int f5546_20(int x) { return x * 20; }
+inline int f5546_21(int x) { return x * 21; }
+inline int f5546_22(int x) { return x * 22; }
+inline int f5546_23(int x) { return x * 23; }
+inline int f5546_24(int x) { return x * 24; }
+inline int f5546_25(int x) { return x * 25; }
+inline int f5546_26(int x) { return x * 26; }
+inline int f5546_27(int x) { return x * 27; }
+inline int f5546_28(int x) { return x * 28; }
+inline int f5546_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5549 */
+#include <vector>
+#include "h4794.h"
+#include "h4700.h"
+#include "h6916.h"
+#include "h617.h"
+#include "h7024.h"
+#ifdef X
+#include "h6727.h"
+#endif
+struct S5549 { int a; const char *s = "x//y"; };
+inline int f5549_0(int x) { return x * 0; }
+inline int f5549_1(int x) { return x * 1; }
+inline int f5549_2(int x) { return x * 2; }
+inline int f5549_3(int x) { return x * 3; }
+inline int f5549_4(int x) { return x * 4; }
+inline int f5549_5(int x) { return x * 5; }
+inline int f5549_6(int x) { return x * 6; }
+inline int f5549_7(int x) { return x * 7; }
+inline int f5549_8(int x) { return x * 8; }
+inline int f5549_9(int x) { return x * 9; }
+inline int f5549_10(int x) { return x * 10; }
+inline int f5549_11(int x) { return x * 11; }
+inline int f5549_12(int x) { return x * 12; }
+inline int f5549_13(int x) { return x * 13; }
+inline int f5549_14(int x) { return x * 14; }
+inline int f5549_15(int x) { return x * 15; }
+inline int f5549_16(int x) { return x * 16; }
+inline int f5549_17(int x) { return x * 17; }
+inline int f5549_18(int x) { return x * 18; }
+inline int f5549_19(int x) { return x * 19; }
+inline int f5549_20(int x) { return x * 20; }
+inline int f5549_21(int x) { return x * 21; }
+inline int f5549_22(int x) { return x * 22; }
+inline int f5549_23(int x) { return x * 23; }
+inline int f5549_24(int x) { return x * 24; }
+inline int f5549_25(int x) { return x * 25; }
+inline int f5549_26(int x) { return x * 26; }
+inline int f5549_27(int x) { return x * 27; }
+inline int f5549_28(int x) { return x * 28; }
+inline int f5549_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 555 */
+#include <vector>
+#include "h3305.h"
+#include "h4752.h"
+#include "h5818.h"
+#include "h1118.h"
+#include "h9186.h"
+#ifdef X
+#include "h3368.h"
+#endif
+struct S555 { int a; const char *s = "x//y"; };
+inline int f555_0(int x) { return x * 0; }
+inline int f555_1(int x) { return x * 1; }
+inline int f555_2(int x) { return x * 2; }
+inline int f555_3(int x) { return x * 3; }
+inline int f555_4(int x) { return x * 4; }
+inline int f555_5(int x) { return x * 5; }
+inline int f555_6(int x) { return x * 6; }
+inline int f555_7(int x) { return x * 7; }
+inline int f555_8(int x) { return x * 8; }
+inline int f555_9(int x) { return x * 9; }
+inline int f555_10(int x) { return x * 10; }
+inline int f555_11(int x) { return x * 11; }
+inline int f555_12(int x) { return x * 12; }
+inline int f555_13(int x) { return x * 13; }
+inline int f555_14(int x) { return x * 14; }
+inline int f555_15(int x) { return x * 15; }
+inline int f555_16(int x) { return x * 16; }
+inline int f555_17(int x) { return x * 17; }
+inline int f555_18(int x) { return x * 18; }
+inline int f555_19(int x) { return x * 19; }
+inline int f555_20(int x) { return x * 20; }
+inline int f555_21(int x) { return x * 21; }
+inline int f555_22(int x) { return x * 22; }
+inline int f555_23(int x) { return x * 23; }
+inline int f555_24(int x) { return x * 24; }
+inline int f555_25(int x) { return x * 25; }
+inline int f555_26(int x) { return x * 26; }
+inline int f555_27(int x) { return x * 27; }
+inline int f555_28(int x) { return x * 28; }
+inline int f555_29(int x) { return x * 29; }
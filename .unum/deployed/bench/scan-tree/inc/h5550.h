@@ -0,0 +1,42 @@
+#pragma once
+/* header 5550 */
+#include <vector>
+#include "h9268.h"
+#include "h4489.h"
+#include "h5388.h"
+#include "h4086.h"
+#include "h296.h"
+#ifdef X
+#include "h4106.h"
+#endif
+struct S5550 { int a; const char *s = "x//y"; };
+inline int f5550_0(int x) { return x * 0; }
+inline int f5550_1(int x) { return x * 1; }
+inline int f5550_2(int x) { return x * 2; }
+inline int f5550_3(int x) { return x * 3; }
+inline int f5550_4(int x) { return x * 4; }
+inline int f5550_5(int x) { return x * 5; }
+inline int f5550_6(int x) { return x * 6; }
+inline int f5550_7(int x) { return x * 7; }
+inline int f5550_8(int x) { return x * 8; }
+inline int f5550_9(int x) { return x * 9; }
+inline int f5550_10(int x) { return x * 10; }
+inline int f5550_11(int x) { return x * 11; }
+inline int f5550_12(int x) { return x * 12; }
+inline int f5550_13(int x) { return x * 13; }
+inline int f5550_14(int x) { return x * 14; }
+inline int f5550_15(int x) { return x * 15; }
+inline int f5550_16(int x) { return x * 16; }
+inline int f5550_17(int x) { return x * 17; }
+inline int f5550_18(int x) { return x * 18; }
+inline int f5550_19(int x) { return x * 19; }
+inline int f5550_20(int x) { return x * 20; }
+inline int f5550_21(int x) { return x * 21; }
+inline int f5550_22(int x) { return x * 22; }
+inline int f5550_23(int x) { return x * 23; }
+inline int f5550_24(int x) { return x * 24; }
+inline int f5550_25(int x) { return x * 25; }
+inline int f5550_26(int x) { return x * 26; }
+inline int f5550_27(int x) { return x * 27; }
+inline int f5550_28(int x) { return x * 28; }
+inline int f5550_29(int x) { return x * 29; }
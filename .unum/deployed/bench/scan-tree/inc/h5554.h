@@ -0,0 +1,42 @@
+#pragma once
+/* header 5554 */
+#include <vector>
+#include "h5091.h"
+#include "h1255.h"
+#include "h7073.h"
+#include "h2384.h"
+#include "h2798.h"
+#ifdef X
+#include "h3171.h"
+#endif
+struct S5554 { int a; const char *s = "x//y"; };
+inline int f5554_0(int x) { return x * 0; }
+inline int f5554_1(int x) { return x * 1; }
+inline int f5554_2(int x) { return x * 2; }
+inline int f5554_3(int x) { return x * 3; }
+inline int f5554_4(int x) { return x * 4; }
+inline int f5554_5(int x) { return x * 5; }
+inline int f5554_6(int x) { return x * 6; }
+inline int f5554_7(int x) { return x * 7; }
+inline int f5554_8(int x) { return x * 8; }
+inline int f5554_9(int x) { return x * 9; }
+inline int f5554_10(int x) { return x * 10; }
+inline int f5554_11(int x) { return x * 11; }
+inline int f5554_12(int x) { return x * 12; }
+inline int f5554_13(int x) { return x * 13; }
+inline int f5554_14(int x) { return x * 14; }
+inline int f5554_15(int x) { return x * 15; }
+inline int f5554_16(int x) { return x * 16; }
+inline int f5554_17(int x) { return x * 17; }
+inline int f5554_18(int x) { return x * 18; }
+inline int f5554_19(int x) { return x * 19; }
+inline int f5554_20(int x) { return x * 20; }
+inline int f5554_21(int x) { return x * 21; }
+inline int f5554_22(int x) { return x * 22; }
+inline int f5554_23(int x) { return x * 23; }
+inline int f5554_24(int x) { return x * 24; }
+inline int f5554_25(int x) { return x * 25; }
+inline int f5554_26(int x) { return x * 26; }
+inline int f5554_27(int x) { return x * 27; }
+inline int f5554_28(int x) { return x * 28; }
+inline int f5554_29(int x) { return x * 29; }
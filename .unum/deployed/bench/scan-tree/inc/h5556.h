@@ -0,0 +1,42 @@
+#pragma once
+/* header 5556 */
+#include <vector>
+#include "h7973.h"
+#include "h4286.h"
+#include "h3901.h"
+#include "h8702.h"
+#include "h3280.h"
+#ifdef X
+#include "h6516.h"
+#endif
+struct S5556 { int a; const char *s = "x//y"; };
+inline int f5556_0(int x) { return x * 0; }
+inline int f5556_1(int x) { return x * 1; }
+inline int f5556_2(int x) { return x * 2; }
+inline int f5556_3(int x) { return x * 3; }
+inline int f5556_4(int x) { return x * 4; }
+inline int f5556_5(int x) { return x * 5; }
+inline int f5556_6(int x) { return x * 6; }
+inline int f5556_7(int x) { return x * 7; }
+inline int f5556_8(int x) { return x * 8; }
+inline int f5556_9(int x) { return x * 9; }
+inline int f5556_10(int x) { return x * 10; }
+inline int f5556_11(int x) { return x * 11; }
+inline int f5556_12(int x) { return x * 12; }
+inline int f5556_13(int x) { return x * 13; }
+inline int f5556_14(int x) { return x * 14; }
+inline int f5556_15(int x) { return x * 15; }
+inline int f5556_16(int x) { return x * 16; }
+inline int f5556_17(int x) { return x * 17; }
+inline int f5556_18(int x) { return x * 18; }
+inline int f5556_19(int x) { return x * 19; }
+inline int f5556_20(int x) { return x * 20; }
+inline int f5556_21(int x) { return x * 21; }
+inline int f5556_22(int x) { return x * 22; }
+inline int f5556_23(int x) { return x * 23; }
+inline int f5556_24(int x) { return x * 24; }
+inline int f5556_25(int x) { return x * 25; }
+inline int f5556_26(int x) { return x * 26; }
+inline int f5556_27(int x) { return x * 27; }
+inline int f5556_28(int x) { return x * 28; }
+inline int f5556_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5558 */
+#include <vector>
+#include "h7868.h"
+#include "h2242.h"
+#include "h2013.h"
+#include "h7057.h"
+#include "h2844.h"
+#ifdef X
+#include "h4667.h"
+#endif
+struct S5558 { int a; const char *s = "x//y"; };
+inline int f5558_0(int x) { return x * 0; }
+inline int f5558_1(int x) { return x * 1; }
+inline int f5558_2(int x) { return x * 2; }
+inline int f5558_3(int x) { return x * 3; }
+inline int f5558_4(int x) { return x * 4; }
+inline int f5558_5(int x) { return x * 5; }
+inline int f5558_6(int x) { return x * 6; }
+inline int f5558_7(int x) { return x * 7; }
+inline int f5558_8(int x) { return x * 8; }
+inline int f5558_9(int x) { return x * 9; }
+inline int f5558_10(int x) { return x * 10; }
+inline int f5558_11(int x) { return x * 11; }
+inline int f5558_12(int x) { return x * 12; }
+inline int f5558_13(int x) { return x * 13; }
+inline int f5558_14(int x) { return x * 14; }
+inline int f5558_15(int x) { return x * 15; }
+inline int f5558_16(int x) { return x * 16; }
+inline int f5558_17(int x) { return x * 17; }
+inline int f5558_18(int x) { return x * 18; }
+inline int f5558_19(int x) { return x * 19; }
+inline int f5558_20(int x) { return x * 20; }
+inline int f5558_21(int x) { return x * 21; }
+inline int f5558_22(int x) { return x * 22; }
+inline int f5558_23(int x) { return x * 23; }
+inline int f5558_24(int x) { return x * 24; }
+inline int f5558_25(int x) { return x * 25; }
+inline int f5558_26(int x) { return x * 26; }
+inline int f5558_27(int x) { return x * 27; }
+inline int f5558_28(int x) { return x * 28; }
+inline int f5558_29(int x) { return x * 29; }
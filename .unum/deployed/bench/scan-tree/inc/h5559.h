@@ -0,0 +1,42 @@
+#pragma once
+/* header 5559 */
+#include <vector>
+#include "h6083.h"
+#include "h4112.h"
+#include "h8123.h"
+#include "h4910.h"
+#include "h1405.h"
+#ifdef X
+#include "h5676.h"
+#endif
+struct S5559 { int a; const char *s = "x//y"; };
+inline int f5559_0(int x) { return x * 0; }
+inline int f5559_1(int x) { return x * 1; }
+inline int f5559_2(int x) { return x * 2; }
+inline int f5559_3(int x) { return x * 3; }
+inline int f5559_4(int x) { return x * 4; }
+inline int f5559_5(int x) { return x * 5; }
+inline int f5559_6(int x) { return x * 6; }
+inline int f5559_7(int x) { return x * 7; }
+inline int f5559_8(int x) { return x * 8; }
+inline int f5559_9(int x) { return x * 9; }
+inline int f5559_10(int x) { return x * 10; }
+inline int f5559_11(int x) { return x * 11; }
+inline int f5559_12(int x) { return x * 12; }
+inline int f5559_13(int x) { return x * 13; }
+inline int f5559_14(int x) { return x * 14; }
+inline int f5559_15(int x) { return x * 15; }
+inline int f5559_16(int x) { return x * 16; }
+inline int f5559_17(int x) { return x * 17; }
+inline int f5559_18(int x) { return x * 18; }
+inline int f5559_19(int x) { return x * 19; }
+inline int f5559_20(int x) { return x * 20; }
+inline int f5559_21(int x) { return x * 21; }
+inline int f5559_22(int x) { return x * 22; }
+inline int f5559_23(int x) { return x * 23; }
+inline int f5559_24(int x) { return x * 24; }
+inline int f5559_25(int x) { return x * 25; }
+inline int f5559_26(int x) { return x * 26; }
+inline int f5559_27(int x) { return x * 27; }
+inline int f5559_28(int x) { return x * 28; }
+inline int f5559_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 556 */
+#include <vector>
+#include "h5060.h"
+#include "h7764.h"
+#include "h1858.h"
+#include "h9789.h"
+#include "h5474.h"
+#ifdef X
+#include "h1933.h"
+#endif
+struct S556 { int a; const char *s = "x//y"; };
+inline int f556_0(int x) { return x * 0; }
+inline int f556_1(int x) { return x * 1; }
+inline int f556_2(int x) { return x * 2; }
+inline int f556_3(int x) { return x * 3; }
+inline int f556_4(int x) { return x * 4; }
+inline int f556_5(int x) { return x * 5; }
+inline int f556_6(int x) { return x * 6; }
+inline int f556_7(int x) { return x * 7; }
+inline int f556_8(int x) { return x * 8; }
+inline int f556_9(int x) { return x * 9; }
+inline int f556_10(int x) { return x * 10; }
+inline int f556_11(int x) { return x * 11; }
+inline int f556_12(int x) { return x * 12; }
+inline int f556_13(int x) { return x * 13; }
+inline int f556_14(int x) { return x * 14; }
+inline int f556_15(int x) { return x * 15; }
+inline int f556_16(int x) { return x * 16; }
+inline int f556_17(int x) { return x * 17; }
+inline int f556_18(int x) { return x * 18; }
+inline int f556_19(int x) { return x * 19; }
+inline int f556_20(int x) { return x * 20; }
+inline int f556_21(int x) { return x * 21; }
+inline int f556_22(int x) { return x * 22; }
+inline int f556_23(int x) { return x * 23; }
+inline int f556_24(int x) { return x * 24; }
+inline int f556_25(int x) { return x * 25; }
+inline int f556_26(int x) { return x * 26; }
+inline int f556_27(int x) { return x * 27; }
+inline int f556_28(int x) { return x * 28; }
+inline int f556_29(int x) { return x * 29; }
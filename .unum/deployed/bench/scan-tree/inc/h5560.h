@@ -0,0 +1,42 @@
+#pragma once
+/* header 5560 */
+#include <vector>
+#include "h1872.h"
+#include "h9474.h"
+#include "h5680.h"
+#include "h9141.h"
+#include "h5903.h"
+#ifdef X
+#include "h3872.h"
+#endif
+struct S5560 { int a; const char *s = "x//y"; };
+inline int f5560_0(int x) { return x * 0; }
+inline int f5560_1(int x) { return x * 1; }
+inline int f5560_2(int x) { return x * 2; }
+inline int f5560_3(int x) { return x * 3; }
+inline int f5560_4(int x) { return x * 4; }
+inline int f5560_5(int x) { return x * 5; }
+inline int f5560_6(int x) { return x * 6; }
+inline int f5560_7(int x) { return x * 7; }
+inline int f5560_8(int x) { return x * 8; }
+inline int f5560_9(int x) { return x * 9; }
+inline int f5560_10(int x) { return x * 10; }
+inline int f5560_11(int x) { return x * 11; }
+inline int f5560_12(int x) { return x * 12; }
+inline int f5560_13(int x) { return x * 13; }
+inline int f5560_14(int x) { return x * 14; }
+inline int f5560_15(int x) { return x * 15; }
+inline int f5560_16(int x) { return x * 16; }
+inline int f5560_17(int x) { return x * 17; }
+inline int f5560_18(int x) { return x * 18; }
+inline int f5560_19(int x) { return x * 19; }
+inline int f5560_20(int x) { return x * 20; }
+inline int f5560_21(int x) { return x * 21; }
+inline int f5560_22(int x) { return x * 22; }
+inline int f5560_23(int x) { return x * 23; }
+inline int f5560_24(int x) { return x * 24; }
+inline int f5560_25(int x) { return x * 25; }
+inline int f5560_26(int x) { return x * 26; }
+inline int f5560_27(int x) { return x * 27; }
+inline int f5560_28(int x) { return x * 28; }
+inline int f5560_29(int x) { return x * 29; }
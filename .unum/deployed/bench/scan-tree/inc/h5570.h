@@ -0,0 +1,42 @@
+#pragma once
+/* header 5570 */
+#include <vector>
+#include "h9824.h"
+#include "h3499.h"
+#include "h4768.h"
+#include "h2466.h"
+#include "h890.h"
+#ifdef X
+#include "h7164.h"
+#endif
+struct S5570 { int a; const char *s = "x//y"; };
+inline int f5570_0(int x) { return x * 0; }
+inline int f5570_1(int x) { return x * 1; }
+inline int f5570_2(int x) { return x * 2; }
+inline int f5570_3(int x) { return x * 3; }
+inline int f5570_4(int x) { return x * 4; }
+inline int f5570_5(int x) { return x * 5; }
+inline int f5570_6(int x) { return x * 6; }
+inline int f5570_7(int x) { return x * 7; }
+inline int f5570_8(int x) { return x * 8; }
+inline int f5570_9(int x) { return x * 9; }
+inline int f5570_10(int x) { return x * 10; }
+inline int f5570_11(int x) { return x * 11; }
+inline int f5570_12(int x) { return x * 12; }
+inline int f5570_13(int x) { return x * 13; }
+inline int f5570_14(int x) { return x * 14; }
+inline int f5570_15(int x) { return x * 15; }
+inline int f5570_16(int x) { return x * 16; }
+inline int f5570_17(int x) { return x * 17; }
+inline int f5570_18(int x) { return x * 18; }
+inline int f5570_19(int x) { return x * 19; }
+inline int f5570_20(int x) { return x * 20; }
+inline int f5570_21(int x) { return x * 21; }
+inline int f5570_22(int x) { return x * 22; }
+inline int f5570_23(int x) { return x * 23; }
+inline int f5570_24(int x) { return x * 24; }
+inline int f5570_25(int x) { return x * 25; }
+inline int f5570_26(int x) { return x * 26; }
+inline int f5570_27(int x) { return x * 27; }
+inline int f5570_28(int x) { return x * 28; }
+inline int f5570_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5571 */
+#include <vector>
+#include "h1042.h"
+#include "h5589.h"
+#include "h5464.h"
+#include "h2860.h"
+#include "h1754.h"
+#ifdef X
+#include "h1526.h"
+#endif
+struct S5571 { int a; const char *s = "x//y"; };
+inline int f5571_0(int x) { return x * 0; }
+inline int f5571_1(int x) { return x * 1; }
+inline int f5571_2(int x) { return x * 2; }
+inline int f5571_3(int x) { return x * 3; }
+inline int f5571_4(int x) { return x * 4; }
+inline int f5571_5(int x) { return x * 5; }
+inline int f5571_6(int x) { return x * 6; }
+inline int f5571_7(int x) { return x * 7; }
+inline int f5571_8(int x) { return x * 8; }
+inline int f5571_9(int x) { return x * 9; }
+inline int f5571_10(int x) { return x * 10; }
+inline int f5571_11(int x) { return x * 11; }
+inline int f5571_12(int x) { return x * 12; }
+inline int f5571_13(int x) { return x * 13; }
+inline int f5571_14(int x) { return x * 14; }
+inline int f5571_15(int x) { return x * 15; }
+inline int f5571_16(int x) { return x * 16; }
+inline int f5571_17(int x) { return x * 17; }
+inline int f5571_18(int x) { return x * 18; }
+inline int f5571_19(int x) { return x * 19; }
+inline int f5571_20(int x) { return x * 20; }
+inline int f5571_21(int x) { return x * 21; }
+inline int f5571_22(int x) { return x * 22; }
+inline int f5571_23(int x) { return x * 23; }
+inline int f5571_24(int x) { return x * 24; }
+inline int f5571_25(int x) { return x * 25; }
+inline int f5571_26(int x) { return x * 26; }
+inline int f5571_27(int x) { return x * 27; }
+inline int f5571_28(int x) { return x * 28; }
+inline int f5571_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5572 */
+#include <vector>
+#include "h9862.h"
+#include "h5653.h"
+#include "h8271.h"
+#include "h6330.h"
+#include "h3804.h"
+#ifdef X
+#include "h7050.h"
+#endif
+struct S5572 { int a; const char *s = "x//y"; };
+inline int f5572_0(int x) { return x * 0; }
+inline int f5572_1(int x) { return x * 1; }
+inline int f5572_2(int x) { return x * 2; }
+inline int f5572_3(int x) { return x * 3; }
+inline int f5572_4(int x) { return x * 4; }
+inline int f5572_5(int x) { return x * 5; }
+inline int f5572_6(int x) { return x * 6; }
+inline int f5572_7(int x) { return x * 7; }
+inline int f5572_8(int x) { return x * 8; }
+inline int f5572_9(int x) { return x * 9; }
+inline int f5572_10(int x) { return x * 10; }
+inline int f5572_11(int x) { return x * 11; }
+inline int f5572_12(int x) { return x * 12; }
+inline int f5572_13(int x) { return x * 13; }
+inline int f5572_14(int x) { return x * 14; }
+inline int f5572_15(int x) { return x * 15; }
+inline int f5572_16(int x) { return x * 16; }
+inline int f5572_17(int x) { return x * 17; }
+inline int f5572_18(int x) { return x * 18; }
+inline int f5572_19(int x) { return x * 19; }
+inline int f5572_20(int x) { return x * 20; }
+inline int f5572_21(int x) { return x * 21; }
+inline int f5572_22(int x) { return x * 22; }
+inline int f5572_23(int x) { return x * 23; }
+inline int f5572_24(int x) { return x * 24; }
+inline int f5572_25(int x) { return x * 25; }
+inline int f5572_26(int x) { return x * 26; }
+inline int f5572_27(int x) { return x * 27; }
+inline int f5572_28(int x) { return x * 28; }
+inline int f5572_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5575 */
+#include <vector>
+#include "h779.h"
+#include "h4318.h"
+#include "h3865.h"
+#include "h9615.h"
+#include "h2976.h"
+#ifdef X
+#include "h8893.h"
+#endif
+struct S5575 { int a; const char *s = "x//y"; };
+inline int f5575_0(int x) { return x * 0; }
+inline int f5575_1(int x) { return x * 1; }
+inline int f5575_2(int x) { return x * 2; }
+inline int f5575_3(int x) { return x * 3; }
+inline int f5575_4(int x) { return x * 4; }
+inline int f5575_5(int x) { return x * 5; }
+inline int f5575_6(int x) { return x * 6; }
+inline int f5575_7(int x) { return x * 7; }
+inline int f5575_8(int x) { return x * 8; }
+inline int f5575_9(int x) { return x * 9; }
+inline int f5575_10(int x) { return x * 10; }
+inline int f5575_11(int x) { return x * 11; }
+inline int f5575_12(int x) { return x * 12; }
+inline int f5575_13(int x) { return x * 13; }
+inline int f5575_14(int x) { return x * 14; }
+inline int f5575_15(int x) { return x * 15; }
+inline int f5575_16(int x) { return x * 16; }
+inline int f5575_17(int x) { return x * 17; }
+inline int f5575_18(int x) { return x * 18; }
+inline int f5575_19(int x) { return x * 19; }
+inline int f5575_20(int x) { return x * 20; }
+inline int f5575_21(int x) { return x * 21; }
+inline int f5575_22(int x) { return x * 22; }
+inline int f5575_23(int x) { return x * 23; }
+inline int f5575_24(int x) { return x * 24; }
+inline int f5575_25(int x) { return x * 25; }
+inline int f5575_26(int x) { return x * 26; }
+inline int f5575_27(int x) { return x * 27; }
+inline int f5575_28(int x) { return x * 28; }
+inline int f5575_29(int x) { return x * 29; }
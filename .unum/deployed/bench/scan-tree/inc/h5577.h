@@ -0,0 +1,42 @@
+#pragma once
+/* header 5577 */
+#include <vector>
+#include "h3666.h"
+#include "h8660.h"
+#include "h8262.h"
+#include "h1806.h"
+#include "h3822.h"
+#ifdef X
+#include "h5854.h"
+#endif
+struct S5577 { int a; const char *s = "x//y"; };
+inline int f5577_0(int x) { return x * 0; }
+inline int f5577_1(int x) { return x * 1; }
+inline int f5577_2(int x) { return x * 2; }
+inline int f5577_3(int x) { return x * 3; }
+inline int f5577_4(int x) { return x * 4; }
+inline int f5577_5(int x) { return x * 5; }
+inline int f5577_6(int x) { return x * 6; }
+inline int f5577_7(int x) { return x * 7; }
+inline int f5577_8(int x) { return x * 8; }
+inline int f5577_9(int x) { return x * 9; }
+inline int f5577_10(int x) { return x * 10; }
+inline int f5577_11(int x) { return x * 11; }
+inline int f5577_12(int x) { return x * 12; }
+inline int f5577_13(int x) { return x * 13; }
+inline int f5577_14(int x) { return x * 14; }
+inline int f5577_15(int x) { return x * 15; }
+inline int f5577_16(int x) { return x * 16; }
+inline int f5577_17(int x) { return x * 17; }
+inline int f5577_18(int x) { return x * 18; }
+inline int f5577_19(int x) { return x * 19; }
+inline int f5577_20(int x) { return x * 20; }
+inline int f5577_21(int x) { return x * 21; }
+inline int f5577_22(int x) { return x * 22; }
+inline int f5577_23(int x) { return x * 23; }
+inline int f5577_24(int x) { return x * 24; }
+inline int f5577_25(int x) { return x * 25; }
+inline int f5577_26(int x) { return x * 26; }
+inline int f5577_27(int x) { return x * 27; }
+inline int f5577_28(int x) { return x * 28; }
+inline int f5577_29(int x) { return x * 29; }
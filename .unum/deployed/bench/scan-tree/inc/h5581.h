@@ -0,0 +1,42 @@
+#pragma once
+/* header 5581 */
+#include <vector>
+#include "h4786.h"
+#include "h732.h"
+#include "h5856.h"
+#include "h7929.h"
+#include "h5325.h"
+#ifdef X
+#include "h8633.h"
+#endif
+struct S5581 { int a; const char *s = "x//y"; };
+inline int f5581_0(int x) { return x * 0; }
+inline int f5581_1(int x) { return x * 1; }
+inline int f5581_2(int x) { return x * 2; }
+inline int f5581_3(int x) { return x * 3; }
+inline int f5581_4(int x) { return x * 4; }
+inline int f5581_5(int x) { return x * 5; }
+inline int f5581_6(int x) { return x * 6; }
+inline int f5581_7(int x) { return x * 7; }
+inline int f5581_8(int x) { return x * 8; }
+inline int f5581_9(int x) { return x * 9; }
+inline int f5581_10(int x) { return x * 10; }
+inline int f5581_11(int x) { return x * 11; }
+inline int f5581_12(int x) { return x * 12; }
+inline int f5581_13(int x) { return x * 13; }
+inline int f5581_14(int x) { return x * 14; }
+inline int f5581_15(int x) { return x * 15; }
+inline int f5581_16(int x) { return x * 16; }
+inline int f5581_17(int x) { return x * 17; }
+inline int f5581_18(int x) { return x * 18; }
+inline int f5581_19(int x) { return x * 19; }
+inline int f5581_20(int x) { return x * 20; }
+inline int f5581_21(int x) { return x * 21; }
+inline int f5581_22(int x) { return x * 22; }
+inline int f5581_23(int x) { return x * 23; }
+inline int f5581_24(int x) { return x * 24; }
+inline int f5581_25(int x) { return x * 25; }
+inline int f5581_26(int x) { return x * 26; }
+inline int f5581_27(int x) { return x * 27; }
+inline int f5581_28(int x) { return x * 28; }
+inline int f5581_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5588 */
+#include <vector>
+#include "h1234.h"
+#include "h7628.h"
+#include "h8093.h"
+#include "h4372.h"
+#include "h162.h"
+#ifdef X
+#include "h654.h"
+#endif
+struct S5588 { int a; const char *s = "x//y"; };
+inline int f5588_0(int x) { return x * 0; }
+inline int f5588_1(int x) { return x * 1; }
+inline int f5588_2(int x) { return x * 2; }
+inline int f5588_3(int x) { return x * 3; }
+inline int f5588_4(int x) { return x * 4; }
+inline int f5588_5(int x) { return x * 5; }
+inline int f5588_6(int x) { return x * 6; }
+inline int f5588_7(int x) { return x * 7; }
+inline int f5588_8(int x) { return x * 8; }
+inline int f5588_9(int x) { return x * 9; }
+inline int f5588_10(int x) { return x * 10; }
+inline int f5588_11(int x) { return x * 11; }
+inline int f5588_12(int x) { return x * 12; }
+inline int f5588_13(int x) { return x * 13; }
+inline int f5588_14(int x) { return x * 14; }
+inline int f5588_15(int x) { return x * 15; }
+inline int f5588_16(int x) { return x * 16; }
+inline int f5588_17(int x) { return x * 17; }
+inline int f5588_18(int x) { return x * 18; }
+inline int f5588_19(int x) { return x * 19; }
+inline int f5588_20(int x) { return x * 20; }
+inline int f5588_21(int x) { return x * 21; }
+inline int f5588_22(int x) { return x * 22; }
+inline int f5588_23(int x) { return x * 23; }
+inline int f5588_24(int x) { return x * 24; }
+inline int f5588_25(int x) { return x * 25; }
+inline int f5588_26(int x) { return x * 26; }
+inline int f5588_27(int x) { return x * 27; }
+inline int f5588_28(int x) { return x * 28; }
+inline int f5588_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 559 */
+#include <vector>
+#include "h8288.h"
+#include "h3237.h"
+#include "h8116.h"
+#include "h994.h"
+#include "h2206.h"
+#ifdef X
+#include "h3770.h"
+#endif
+struct S559 { int a; const char *s = "x//y"; };
+inline int f559_0(int x) { return x * 0; }
+inline int f559_1(int x) { return x * 1; }
+inline int f559_2(int x) { return x * 2; }
+inline int f559_3(int x) { return x * 3; }
+inline int f559_4(int x) { return x * 4; }
+inline int f559_5(int x) { return x * 5; }
+inline int f559_6(int x) { return x * 6; }
+inline int f559_7(int x) { return x * 7; }
+inline int f559_8(int x) { return x * 8; }
+inline int f559_9(int x) { return x * 9; }
+inline int f559_10(int x) { return x * 10; }
+inline int f559_11(int x) { return x * 11; }
+inline int f559_12(int x) { return x * 12; }
+inline int f559_13(int x) { return x * 13; }
+inline int f559_14(int x) { return x * 14; }
+inline int f559_15(int x) { return x * 15; }
+inline int f559_16(int x) { return x * 16; }
+inline int f559_17(int x) { return x * 17; }
+inline int f559_18(int x) { return x * 18; }
+inline int f559_19(int x) { return x * 19; }
+inline int f559_20(int x) { return x * 20; }
+inline int f559_21(int x) { return x * 21; }
+inline int f559_22(int x) { return x * 22; }
+inline int f559_23(int x) { return x * 23; }
+inline int f559_24(int x) { return x * 24; }
+inline int f559_25(int x) { return x * 25; }
+inline int f559_26(int x) { return x * 26; }
+inline int f559_27(int x) { return x * 27; }
+inline int f559_28(int x) { return x * 28; }
+inline int f559_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5591 */
+#include <vector>
+#include "h3636.h"
+#include "h1950.h"
+#include "h3585.h"
+#include "h7288.h"
+#include "h3819.h"
+#ifdef X
+#include "h1617.h"
+#endif
+struct S5591 { int a; const char *s = "x//y"; };
+inline int f5591_0(int x) { return x * 0; }
+inline int f5591_1(int x) { return x * 1; }
+inline int f5591_2(int x) { return x * 2; }
+inline int f5591_3(int x) { return x * 3; }
+inline int f5591_4(int x) { return x * 4; }
+inline int f5591_5(int x) { return x * 5; }
+inline int f5591_6(int x) { return x * 6; }
+inline int f5591_7(int x) { return x * 7; }
+inline int f5591_8(int x) { return x * 8; }
+inline int f5591_9(int x) { return x * 9; }
+inline int f5591_10(int x) { return x * 10; }
+inline int f5591_11(int x) { return x * 11; }
+inline int f5591_12(int x) { return x * 12; }
+inline int f5591_13(int x) { return x * 13; }
+inline int f5591_14(int x) { return x * 14; }
+inline int f5591_15(int x) { return x * 15; }
+inline int f5591_16(int x) { return x * 16; }
+inline int f5591_17(int x) { return x * 17; }
+inline int f5591_18(int x) { return x * 18; }
+inline int f5591_19(int x) { return x * 19; }
+inline int f5591_20(int x) { return x * 20; }
+inline int f5591_21(int x) { return x * 21; }
+inline int f5591_22(int x) { return x * 22; }
+inline int f5591_23(int x) { return x * 23; }
+inline int f5591_24(int x) { return x * 24; }
+inline int f5591_25(int x) { return x * 25; }
+inline int f5591_26(int x) { return x * 26; }
+inline int f5591_27(int x) { return x * 27; }
+inline int f5591_28(int x) { return x * 28; }
+inline int f5591_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5595 */
+#include <vector>
+#include "h593.h"
+#include "h4355.h"
+#include "h7959.h"
+#include "h2002.h"
+#include "h4597.h"
+#ifdef X
+#include "h5196.h"
+#endif
+struct S5595 { int a; const char *s = "x//y"; };
+inline int f5595_0(int x) { return x * 0; }
+inline int f5595_1(int x) { return x * 1; }
+inline int f5595_2(int x) { return x * 2; }
+inline int f5595_3(int x) { return x * 3; }
+inline int f5595_4(int x) { return x * 4; }
+inline int f5595_5(int x) { return x * 5; }
+inline int f5595_6(int x) { return x * 6; }
+inline int f5595_7(int x) { return x * 7; }
+inline int f5595_8(int x) { return x * 8; }
+inline int f5595_9(int x) { return x * 9; }
+inline int f5595_10(int x) { return x * 10; }
+inline int f5595_11(int x) { return x * 11; }
+inline int f5595_12(int x) { return x * 12; }
+inline int f5595_13(int x) { return x * 13; }
+inline int f5595_14(int x) { return x * 14; }
+inline int f5595_15(int x) { return x * 15; }
+inline int f5595_16(int x) { return x * 16; }
+inline int f5595_17(int x) { return x * 17; }
+inline int f5595_18(int x) { return x * 18; }
+inline int f5595_19(int x) { return x * 19; }
+inline int f5595_20(int x) { return x * 20; }
+inline int f5595_21(int x) { return x * 21; }
+inline int f5595_22(int x) { return x * 22; }
+inline int f5595_23(int x) { return x * 23; }
+inline int f5595_24(int x) { return x * 24; }
+inline int f5595_25(int x) { return x * 25; }
+inline int f5595_26(int x) { return x * 26; }
+inline int f5595_27(int x) { return x * 27; }
+inline int f5595_28(int x) { return x * 28; }
+inline int f5595_29(int x) { return x * 29; }
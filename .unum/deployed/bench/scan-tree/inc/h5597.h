@@ -0,0 +1,42 @@
+#pragma once
+/* header 5597 */
+#include <vector>
+#include "h8464.h"
+#include "h6092.h"
+#include "h8749.h"
+#include "h908.h"
+#include "h9706.h"
+#ifdef X
+#include "h6833.h"
+#endif
+struct S5597 { int a; const char *s = "x//y"; };
+inline int f5597_0(int x) { return x * 0; }
+inline int f5597_1(int x) { return x * 1; }
+inline int f5597_2(int x) { return x * 2; }
+inline int f5597_3(int x) { return x * 3; }
+inline int f5597_4(int x) { return x * 4; }
+inline int f5597_5(int x) { return x * 5; }
+inline int f5597_6(int x) { return x * 6; }
+inline int f5597_7(int x) { return x * 7; }
+inline int f5597_8(int x) { return x * 8; }
+inline int f5597_9(int x) { return x * 9; }
+inline int f5597_10(int x) { return x * 10; }
+inline int f5597_11(int x) { return x * 11; }
+inline int f5597_12(int x) { return x * 12; }
+inline int f5597_13(int x) { return x * 13; }
+inline int f5597_14(int x) { return x * 14; }
+inline int f5597_15(int x) { return x * 15; }
+inline int f5597_16(int x) { return x * 16; }
+inline int f5597_17(int x) { return x * 17; }
+inline int f5597_18(int x) { return x * 18; }
+inline int f5597_19(int x) { return x * 19; }
+inline int f5597_20(int x) { return x * 20; }
+inline int f5597_21(int x) { return x * 21; }
+inline int f5597_22(int x) { return x * 22; }
+inline int f5597_23(int x) { return x * 23; }
+inline int f5597_24(int x) { return x * 24; }
+inline int f5597_25(int x) { return x * 25; }
+inline int f5597_26(int x) { return x * 26; }
+inline int f5597_27(int x) { return x * 27; }
+inline int f5597_28(int x) { return x * 28; }
+inline int f5597_29(int x) { return x * 29; }
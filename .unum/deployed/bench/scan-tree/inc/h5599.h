@@ -0,0 +1,42 @@
+#pragma once
+/* header 5599 */
+#include <vector>
+#include "h8241.h"
+#include "h7472.h"
+#include "h4232.h"
+#include "h8068.h"
+#include "h1430.h"
+#ifdef X
+#include "h2106.h"
+#endif
+struct S5599 { int a; const char *s = "x//y"; };
+inline int f5599_0(int x) { return x * 0; }
+inline int f5599_1(int x) { return x * 1; }
+inline int f5599_2(int x) { return x * 2; }
+inline int f5599_3(int x) { return x * 3; }
+inline int f5599_4(int x) { return x * 4; }
+inline int f5599_5(int x) { return x * 5; }
+inline int f5599_6(int x) { return x * 6; }
+inline int f5599_7(int x) { return x * 7; }
+inline int f5599_8(int x) { return x * 8; }
+inline int f5599_9(int x) { return x * 9; }
+inline int f5599_10(int x) { return x * 10; }
+inline int f5599_11(int x) { return x * 11; }
+inline int f5599_12(int x) { return x * 12; }
+inline int f5599_13(int x) { return x * 13; }
+inline int f5599_14(int x) { return x * 14; }
+inline int f5599_15(int x) { return x * 15; }
+inline int f5599_16(int x) { return x * 16; }
+inline int f5599_17(int x) { return x * 17; }
+inline int f5599_18(int x) { return x * 18; }
+inline int f5599_19(int x) { return x * 19; }
+inline int f5599_20(int x) { return x * 20; }
+inline int f5599_21(int x) { return x * 21; }
+inline int f5599_22(int x) { return x * 22; }
+inline int f5599_23(int x) { return x * 23; }
+inline int f5599_24(int x) { return x * 24; }
+inline int f5599_25(int x) { return x * 25; }
+inline int f5599_26(int x) { return x * 26; }
+inline int f5599_27(int x) { return x * 27; }
+inline int f5599_28(int x) { return x * 28; }
+inline int f5599_29(int x) { return x * 29; }
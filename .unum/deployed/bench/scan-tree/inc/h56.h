@@ -0,0 +1,42 @@
+#pragma once
+/* header 56 */
+#include <vector>
+#include "h1313.h"
+#include "h6536.h"
+#include "h9970.h"
+#include "h225.h"
+#include "h6889.h"
+#ifdef X
+#include "h7516.h"
+#endif
+struct S56 { int a; const char *s = "x//y"; };
+inline int f56_0(int x) { return x * 0; }
+inline int f56_1(int x) { return x * 1; }
+inline int f56_2(int x) { return x * 2; }
+inline int f56_3(int x) { return x * 3; }
+inline int f56_4(int x) { return x * 4; }
+inline int f56_5(int x) { return x * 5; }
+inline int f56_6(int x) { return x * 6; }
+inline int f56_7(int x) { return x * 7; }
+inline int f56_8(int x) { return x * 8; }
+inline int f56_9(int x) { return x * 9; }
+inline int f56_10(int x) { return x * 10; }
+inline int f56_11(int x) { return x * 11; }
+inline int f56_12(int x) { return x * 12; }
+inline int f56_13(int x) { return x * 13; }
+inline int f56_14(int x) { return x * 14; }
+inline int f56_15(int x) { return x * 15; }
+inline int f56_16(int x) { return x * 16; }
+inline int f56_17(int x) { return x * 17; }
+inline int f56_18(int x) { return x * 18; }
+inline int f56_19(int x) { return x * 19; }
+inline int f56_20(int x) { return x * 20; }
+inline int f56_21(int x) { return x * 21; }
+inline int f56_22(int x) { return x * 22; }
+inline int f56_23(int x) { return x * 23; }
+inline int f56_24(int x) { return x * 24; }
+inline int f56_25(int x) { return x * 25; }
+inline int f56_26(int x) { return x * 26; }
+inline int f56_27(int x) { return x * 27; }
+inline int f56_28(int x) { return x * 28; }
+inline int f56_29(int x) { return x * 29; }
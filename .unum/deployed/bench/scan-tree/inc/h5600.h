@@ -0,0 +1,42 @@
+#pragma once
+/* header 5600 */
+#include <vector>
+#include "h4674.h"
+#include "h7957.h"
+#include "h2811.h"
+#include "h4405.h"
+#include "h4771.h"
+#ifdef X
+#include "h2498.h"
+#endif
+struct S5600 { int a; const char *s = "x//y"; };
+inline int f5600_0(int x) { return x * 0; }
+inline int f5600_1(int x) { return x * 1; }
+inline int f5600_2(int x) { return x * 2; }
+inline int f5600_3(int x) { return x * 3; }
+inline int f5600_4(int x) { return x * 4; }
+inline int f5600_5(int x) { return x * 5; }
+inline int f5600_6(int x) { return x * 6; }
+inline int f5600_7(int x) { return x * 7; }
+inline int f5600_8(int x) { return x * 8; }
+inline int f5600_9(int x) { return x * 9; }
+inline int f5600_10(int x) { return x * 10; }
+inline int f5600_11(int x) { return x * 11; }
+inline int f5600_12(int x) { return x * 12; }
+inline int f5600_13(int x) { return x * 13; }
+inline int f5600_14(int x) { return x * 14; }
+inline int f5600_15(int x) { return x * 15; }
+inline int f5600_16(int x) { return x * 16; }
+inline int f5600_17(int x) { return x * 17; }
+inline int f5600_18(int x) { return x * 18; }
+inline int f5600_19(int x) { return x * 19; }
+inline int f5600_20(int x) { return x * 20; }
+inline int f5600_21(int x) { return x * 21; }
+inline int f5600_22(int x) { return x * 22; }
+inline int f5600_23(int x) { return x * 23; }
+inline int f5600_24(int x) { return x * 24; }
+inline int f5600_25(int x) { return x * 25; }
+inline int f5600_26(int x) { return x * 26; }
+inline int f5600_27(int x) { return x * 27; }
+inline int f5600_28(int x) { return x * 28; }
+inline int f5600_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5605 */
+#include <vector>
+#include "h9200.h"
+#include "h5842.h"
+#include "h5387.h"
+#include "h186.h"
+#include "h5587.h"
+#ifdef X
+#include "h7628.h"
+#endif
+struct S5605 { int a; const char *s = "x//y"; };
+inline int f5605_0(int x) { return x * 0; }
+inline int f5605_1(int x) { return x * 1; }
+inline int f5605_2(int x) { return x * 2; }
+inline int f5605_3(int x) { return x * 3; }
+inline int f5605_4(int x) { return x * 4; }
+inline int f5605_5(int x) { return x * 5; }
+inline int f5605_6(int x) { return x * 6; }
+inline int f5605_7(int x) { return x * 7; }
+inline int f5605_8(int x) { return x * 8; }
+inline int f5605_9(int x) { return x * 9; }
+inline int f5605_10(int x) { return x * 10; }
+inline int f5605_11(int x) { return x * 11; }
+inline int f5605_12(int x) { return x * 12; }
+inline int f5605_13(int x) { return x * 13; }
+inline int f5605_14(int x) { return x * 14; }
+inline int f5605_15(int x) { return x * 15; }
+inline int f5605_16(int x) { return x * 16; }
+inline int f5605_17(int x) { return x * 17; }
+inline int f5605_18(int x) { return x * 18; }
+inline int f5605_19(int x) { return x * 19; }
+inline int f5605_20(int x) { return x * 20; }
+inline int f5605_21(int x) { return x * 21; }
+inline int f5605_22(int x) { return x * 22; }
+inline int f5605_23(int x) { return x * 23; }
+inline int f5605_24(int x) { return x * 24; }
+inline int f5605_25(int x) { return x * 25; }
+inline int f5605_26(int x) { return x * 26; }
+inline int f5605_27(int x) { return x * 27; }
+inline int f5605_28(int x) { return x * 28; }
+inline int f5605_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5607 */
+#include <vector>
+#include "h8942.h"
+#include "h6678.h"
+#include "h5184.h"
+#include "h5324.h"
+#include "h9573.h"
+#ifdef X
+#include "h1246.h"
+#endif
+struct S5607 { int a; const char *s = "x//y"; };
+inline int f5607_0(int x) { return x * 0; }
+inline int f5607_1(int x) { return x * 1; }
+inline int f5607_2(int x) { return x * 2; }
+inline int f5607_3(int x) { return x * 3; }
+inline int f5607_4(int x) { return x * 4; }
+inline int f5607_5(int x) { return x * 5; }
+inline int f5607_6(int x) { return x * 6; }
+inline int f5607_7(int x) { return x * 7; }
+inline int f5607_8(int x) { return x * 8; }
+inline int f5607_9(int x) { return x * 9; }
+inline int f5607_10(int x) { return x * 10; }
+inline int f5607_11(int x) { return x * 11; }
+inline int f5607_12(int x) { return x * 12; }
+inline int f5607_13(int x) { return x * 13; }
+inline int f5607_14(int x) { return x * 14; }
+inline int f5607_15(int x) { return x * 15; }
+inline int f5607_16(int x) { return x * 16; }
+inline int f5607_17(int x) { return x * 17; }
+inline int f5607_18(int x) { return x * 18; }
+inline int f5607_19(int x) { return x * 19; }
+inline int f5607_20(int x) { return x * 20; }
+inline int f5607_21(int x) { return x * 21; }
+inline int f5607_22(int x) { return x * 22; }
+inline int f5607_23(int x) { return x * 23; }
+inline int f5607_24(int x) { return x * 24; }
+inline int f5607_25(int x) { return x * 25; }
+inline int f5607_26(int x) { return x * 26; }
+inline int f5607_27(int x) { return x * 27; }
+inline int f5607_28(int x) { return x * 28; }
+inline int f5607_29(int x) { return x * 29; }
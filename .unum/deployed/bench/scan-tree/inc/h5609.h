@@ -0,0 +1,42 @@
+#pragma once
+/* header 5609 */
+#include <vector>
+#include "h9244.h"
+#include "h5281.h"
+#include "h9429.h"
+#include "h9156.h"
+#include "h2003.h"
+#ifdef X
+#include "h8144.h"
+#endif
+struct S5609 { int a; const char *s = "x//y"; };
+inline int f5609_0(int x) { return x * 0; }
+inline int f5609_1(int x) { return x * 1; }
+inline int f5609_2(int x) { return x * 2; }
+inline int f5609_3(int x) { return x * 3; }
+inline int f5609_4(int x) { return x * 4; }
+inline int f5609_5(int x) { return x * 5; }
+inline int f5609_6(int x) { return x * 6; }
+inline int f5609_7(int x) { return x * 7; }
+inline int f5609_8(int x) { return x * 8; }
+inline int f5609_9(int x) { return x * 9; }
+inline int f5609_10(int x) { return x * 10; }
+inline int f5609_11(int x) { return x * 11; }
+inline int f5609_12(int x) { return x * 12; }
+inline int f5609_13(int x) { return x * 13; }
+inline int f5609_14(int x) { return x * 14; }
+inline int f5609_15(int x) { return x * 15; }
+inline int f5609_16(int x) { return x * 16; }
+inline int f5609_17(int x) { return x * 17; }
+inline int f5609_18(int x) { return x * 18; }
+inline int f5609_19(int x) { return x * 19; }
+inline int f5609_20(int x) { return x * 20; }
+inline int f5609_21(int x) { return x * 21; }
+inline int f5609_22(int x) { return x * 22; }
+inline int f5609_23(int x) { return x * 23; }
+inline int f5609_24(int x) { return x * 24; }
+inline int f5609_25(int x) { return x * 25; }
+inline int f5609_26(int x) { return x * 26; }
+inline int f5609_27(int x) { return x * 27; }
+inline int f5609_28(int x) { return x * 28; }
+inline int f5609_29(int x) { return x * 29; }
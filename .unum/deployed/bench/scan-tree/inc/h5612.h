@@ -0,0 +1,42 @@
+#pragma once
+/* header 5612 */
+#include <vector>
+#include "h3510.h"
+#include "h7931.h"
+#include "h3660.h"
+#include "h7450.h"
+#include "h5177.h"
+#ifdef X
+#include "h4229.h"
+#endif
+struct S5612 { int a; const char *s = "x//y"; };
+inline int f5612_0(int x) { return x * 0; }
+inline int f5612_1(int x) { return x * 1; }
+inline int f5612_2(int x) { return x * 2; }
+inline int f5612_3(int x) { return x * 3; }
+inline int f5612_4(int x) { return x * 4; }
+inline int f5612_5(int x) { return x * 5; }
+inline int f5612_6(int x) { return x * 6; }
+inline int f5612_7(int x) { return x * 7; }
+inline int f5612_8(int x) { return x * 8; }
+inline int f5612_9(int x) { return x * 9; }
+inline int f5612_10(int x) { return x * 10; }
+inline int f5612_11(int x) { return x * 11; }
+inline int f5612_12(int x) { return x * 12; }
+inline int f5612_13(int x) { return x * 13; }
+inline int f5612_14(int x) { return x * 14; }
+inline int f5612_15(int x) { return x * 15; }
+inline int f5612_16(int x) { return x * 16; }
+inline int f5612_17(int x) { return x * 17; }
+inline int f5612_18(int x) { return x * 18; }
+inline int f5612_19(int x) { return x * 19; }
+inline int f5612_20(int x) { return x * 20; }
+inline int f5612_21(int x) { return x * 21; }
+inline int f5612_22(int x) { return x * 22; }
+inline int f5612_23(int x) { return x * 23; }
+inline int f5612_24(int x) { return x * 24; }
+inline int f5612_25(int x) { return x * 25; }
+inline int f5612_26(int x) { return x * 26; }
+inline int f5612_27(int x) { return x * 27; }
+inline int f5612_28(int x) { return x * 28; }
+inline int f5612_29(int x) { return x * 29; }
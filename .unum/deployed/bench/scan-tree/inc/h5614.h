@@ -0,0 +1,42 @@
+#pragma once
+/* header 5614 */
+#include <vector>
+#include "h1235.h"
+#include "h7465.h"
+#include "h6082.h"
+#include "h832.h"
+#include "h5039.h"
+#ifdef X
+#include "h3892.h"
+#endif
+struct S5614 { int a; const char *s = "x//y"; };
+inline int f5614_0(int x) { return x * 0; }
+inline int f5614_1(int x) { return x * 1; }
+inline int f5614_2(int x) { return x * 2; }
+inline int f5614_3(int x) { return x * 3; }
+inline int f5614_4(int x) { return x * 4; }
+inline int f5614_5(int x) { return x * 5; }
+inline int f5614_6(int x) { return x * 6; }
+inline int f5614_7(int x) { return x * 7; }
+inline int f5614_8(int x) { return x * 8; }
+inline int f5614_9(int x) { return x * 9; }
+inline int f5614_10(int x) { return x * 10; }
+inline int f5614_11(int x) { return x * 11; }
+inline int f5614_12(int x) { return x * 12; }
+inline int f5614_13(int x) { return x * 13; }
+inline int f5614_14(int x) { return x * 14; }
+inline int f5614_15(int x) { return x * 15; }
+inline int f5614_16(int x) { return x * 16; }
+inline int f5614_17(int x) { return x * 17; }
+inline int f5614_18(int x) { return x * 18; }
+inline int f5614_19(int x) { return x * 19; }
+inline int f5614_20(int x) { return x * 20; }
+inline int f5614_21(int x) { return x * 21; }
+inline int f5614_22(int x) { return x * 22; }
+inline int f5614_23(int x) { return x * 23; }
+inline int f5614_24(int x) { return x * 24; }
+inline int f5614_25(int x) { return x * 25; }
+inline int f5614_26(int x) { return x * 26; }
+inline int f5614_27(int x) { return x * 27; }
+inline int f5614_28(int x) { return x * 28; }
+inline int f5614_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5617 */
+#include <vector>
+#include "h7960.h"
+#include "h7384.h"
+#include "h5221.h"
+#include "h3490.h"
+#include "h1300.h"
+#ifdef X
+#include "h1542.h"
+#endif
+struct S5617 { int a; const char *s = "x//y"; };
+inline int f5617_0(int x) { return x * 0; }
+inline int f5617_1(int x) { return x * 1; }
+inline int f5617_2(int x) { return x * 2; }
+inline int f5617_3(int x) { return x * 3; }
+inline int f5617_4(int x) { return x * 4; }
+inline int f5617_5(int x) { return x * 5; }
+inline int f5617_6(int x) { return x * 6; }
+inline int f5617_7(int x) { return x * 7; }
+inline int f5617_8(int x) { return x * 8; }
+inline int f5617_9(int x) { return x * 9; }
+inline int f5617_10(int x) { return x * 10; }
+inline int f5617_11(int x) { return x * 11; }
+inline int f5617_12(int x) { return x * 12; }
+inline int f5617_13(int x) { return x * 13; }
+inline int f5617_14(int x) { return x * 14; }
+inline int f5617_15(int x) { return x * 15; }
+inline int f5617_16(int x) { return x * 16; }
+inline int f5617_17(int x) { return x * 17; }
+inline int f5617_18(int x) { return x * 18; }
+inline int f5617_19(int x) { return x * 19; }
+inline int f5617_20(int x) { return x * 20; }
+inline int f5617_21(int x) { return x * 21; }
+inline int f5617_22(int x) { return x * 22; }
+inline int f5617_23(int x) { return x * 23; }
+inline int f5617_24(int x) { return x * 24; }
+inline int f5617_25(int x) { return x * 25; }
+inline int f5617_26(int x) { return x * 26; }
+inline int f5617_27(int x) { return x * 27; }
+inline int f5617_28(int x) { return x * 28; }
+inline int f5617_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5619 */
+#include <vector>
+#include "h5838.h"
+#include "h905.h"
+#include "h4782.h"
+#include "h9707.h"
+#include "h225.h"
+#ifdef X
+#include "h2895.h"
+#endif
+struct S5619 { int a; const char *s = "x//y"; };
+inline int f5619_0(int x) { return x * 0; }
+inline int f5619_1(int x) { return x * 1; }
+inline int f5619_2(int x) { return x * 2; }
+inline int f5619_3(int x) { return x * 3; }
+inline int f5619_4(int x) { return x * 4; }
+inline int f5619_5(int x) { return x * 5; }
+inline int f5619_6(int x) { return x * 6; }
+inline int f5619_7(int x) { return x * 7; }
+inline int f5619_8(int x) { return x * 8; }
+inline int f5619_9(int x) { return x * 9; }
+inline int f5619_10(int x) { return x * 10; }
+inline int f5619_11(int x) { return x * 11; }
+inline int f5619_12(int x) { return x * 12; }
+inline int f5619_13(int x) { return x * 13; }
+inline int f5619_14(int x) { return x * 14; }
+inline int f5619_15(int x) { return x * 15; }
+inline int f5619_16(int x) { return x * 16; }
+inline int f5619_17(int x) { return x * 17; }
+inline int f5619_18(int x) { return x * 18; }
+inline int f5619_19(int x) { return x * 19; }
+inline int f5619_20(int x) { return x * 20; }
+inline int f5619_21(int x) { return x * 21; }
+inline int f5619_22(int x) { return x * 22; }
+inline int f5619_23(int x) { return x * 23; }
+inline int f5619_24(int x) { return x * 24; }
+inline int f5619_25(int x) { return x * 25; }
+inline int f5619_26(int x) { return x * 26; }
+inline int f5619_27(int x) { return x * 27; }
+inline int f5619_28(int x) { return x * 28; }
+inline int f5619_29(int x) { return x * 29; }
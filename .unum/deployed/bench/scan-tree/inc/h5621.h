@@ -0,0 +1,42 @@
+#pragma once
+/* header 5621 */
+#include <vector>
+#include "h1162.h"
+#include "h8300.h"
+#include "h8072.h"
+#include "h6106.h"
+#include "h4496.h"
+#ifdef X
+#include "h6266.h"
+#endif
+struct S5621 { int a; const char *s = "x//y"; };
+inline int f5621_0(int x) { return x * 0; }
+inline int f5621_1(int x) { return x * 1; }
+inline int f5621_2(int x) { return x * 2; }
+inline int f5621_3(int x) { return x * 3; }
+inline int f5621_4(int x) { return x * 4; }
+inline int f5621_5(int x) { return x * 5; }
+inline int f5621_6(int x) { return x * 6; }
+inline int f5621_7(int x) { return x * 7; }
+inline int f5621_8(int x) { return x * 8; }
+inline int f5621_9(int x) { return x * 9; }
+inline int f5621_10(int x) { return x * 10; }
+inline int f5621_11(int x) { return x * 11; }
+inline int f5621_12(int x) { return x * 12; }
+inline int f5621_13(int x) { return x * 13; }
+inline int f5621_14(int x) { return x * 14; }
+inline int f5621_15(int x) { return x * 15; }
+inline int f5621_16(int x) { return x * 16; }
+inline int f5621_17(int x) { return x * 17; }
+inline int f5621_18(int x) { return x * 18; }
+inline int f5621_19(int x) { return x * 19; }
+inline int f5621_20(int x) { return x * 20; }
+inline int f5621_21(int x) { return x * 21; }
+inline int f5621_22(int x) { return x * 22; }
+inline int f5621_23(int x) { return x * 23; }
+inline int f5621_24(int x) { return x * 24; }
+inline int f5621_25(int x) { return x * 25; }
+inline int f5621_26(int x) { return x * 26; }
+inline int f5621_27(int x) { return x * 27; }
+inline int f5621_28(int x) { return x * 28; }
+inline int f5621_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5623 */
+#include <vector>
+#include "h3735.h"
+#include "h1725.h"
+#include "h6366.h"
+#include "h6820.h"
+#include "h2446.h"
+#ifdef X
+#include "h8410.h"
+#endif
+struct S5623 { int a; const char *s = "x//y"; };
+inline int f5623_0(int x) { return x * 0; }
+inline int f5623_1(int x) { return x * 1; }
+inline int f5623_2(int x) { return x * 2; }
+inline int f5623_3(int x) { return x * 3; }
+inline int f5623_4(int x) { return x * 4; }
+inline int f5623_5(int x) { return x * 5; }
+inline int f5623_6(int x) { return x * 6; }
+inline int f5623_7(int x) { return x * 7; }
+inline int f5623_8(int x) { return x * 8; }
+inline int f5623_9(int x) { return x * 9; }
+inline int f5623_10(int x) { return x * 10; }
+inline int f5623_11(int x) { return x * 11; }
+inline int f5623_12(int x) { return x * 12; }
+inline int f5623_13(int x) { return x * 13; }
+inline int f5623_14(int x) { return x * 14; }
+inline int f5623_15(int x) { return x * 15; }
+inline int f5623_16(int x) { return x * 16; }
+inline int f5623_17(int x) { return x * 17; }
+inline int f5623_18(int x) { return x * 18; }
+inline int f5623_19(int x) { return x * 19; }
+inline int f5623_20(int x) { return x * 20; }
+inline int f5623_21(int x) { return x * 21; }
+inline int f5623_22(int x) { return x * 22; }
+inline int f5623_23(int x) { return x * 23; }
+inline int f5623_24(int x) { return x * 24; }
+inline int f5623_25(int x) { return x * 25; }
+inline int f5623_26(int x) { return x * 26; }
+inline int f5623_27(int x) { return x * 27; }
+inline int f5623_28(int x) { return x * 28; }
+inline int f5623_29(int x) { return x * 29; }
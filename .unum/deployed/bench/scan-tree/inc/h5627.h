@@ -0,0 +1,42 @@
+#pragma once
+/* header 5627 */
+#include <vector>
+#include "h3731.h"
+#include "h7116.h"
+#include "h3403.h"
+#include "h6437.h"
+#include "h6815.h"
+#ifdef X
+#include "h3444.h"
+#endif
+struct S5627 { int a; const char *s = "x//y"; };
+inline int f5627_0(int x) { return x * 0; }
+inline int f5627_1(int x) { return x * 1; }
+inline int f5627_2(int x) { return x * 2; }
+inline int f5627_3(int x) { return x * 3; }
+inline int f5627_4(int x) { return x * 4; }
+inline int f5627_5(int x) { return x * 5; }
+inline int f5627_6(int x) { return x * 6; }
+inline int f5627_7(int x) { return x * 7; }
+inline int f5627_8(int x) { return x * 8; }
+inline int f5627_9(int x) { return x * 9; }
+inline int f5627_10(int x) { return x * 10; }
+inline int f5627_11(int x) { return x * 11; }
+inline int f5627_12(int x) { return x * 12; }
+inline int f5627_13(int x) { return x * 13; }
+inline int f5627_14(int x) { return x * 14; }
+inline int f5627_15(int x) { return x * 15; }
+inline int f5627_16(int x) { return x * 16; }
+inline int f5627_17(int x) { return x * 17; }
+inline int f5627_18(int x) { return x * 18; }
+inline int f5627_19(int x) { return x * 19; }
+inline int f5627_20(int x) { return x * 20; }
+inline int f5627_21(int x) { return x * 21; }
+inline int f5627_22(int x) { return x * 22; }
+inline int f5627_23(int x) { return x * 23; }
+inline int f5627_24(int x) { return x * 24; }
+inline int f5627_25(int x) { return x * 25; }
+inline int f5627_26(int x) { return x * 26; }
+inline int f5627_27(int x) { return x * 27; }
+inline int f5627_28(int x) { return x * 28; }
+inline int f5627_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 563 */
+#include <vector>
+#include "h7352.h"
+#include "h4240.h"
+#include "h7019.h"
+#include "h9135.h"
+#include "h2243.h"
+#ifdef X
+#include "h1443.h"
+#endif
+struct S563 { int a; const char *s = "x//y"; };
+inline int f563_0(int x) { return x * 0; }
+inline int f563_1(int x) { return x * 1; }
+inline int f563_2(int x) { return x * 2; }
+inline int f563_3(int x) { return x * 3; }
+inline int f563_4(int x) { return x * 4; }
+inline int f563_5(int x) { return x * 5; }
+inline int f563_6(int x) { return x * 6; }
+inline int f563_7(int x) { return x * 7; }
+inline int f563_8(int x) { return x * 8; }
+inline int f563_9(int x) { return x * 9; }
+inline int f563_10(int x) { return x * 10; }
+inline int f563_11(int x) { return x * 11; }
+inline int f563_12(int x) { return x * 12; }
+inline int f563_13(int x) { return x * 13; }
+inline int f563_14(int x) { return x * 14; }
+inline int f563_15(int x) { return x * 15; }
+inline int f563_16(int x) { return x * 16; }
+inline int f563_17(int x) { return x * 17; }
+inline int f563_18(int x) { return x * 18; }
+inline int f563_19(int x) { return x * 19; }
+inline int f563_20(int x) { return x * 20; }
+inline int f563_21(int x) { return x * 21; }
+inline int f563_22(int x) { return x * 22; }
+inline int f563_23(int x) { return x * 23; }
+inline int f563_24(int x) { return x * 24; }
+inline int f563_25(int x) { return x * 25; }
+inline int f563_26(int x) { return x * 26; }
+inline int f563_27(int x) { return x * 27; }
+inline int f563_28(int x) { return x * 28; }
+inline int f563_29(int x) { return x * 29; }
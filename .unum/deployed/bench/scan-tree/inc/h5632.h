@@ -0,0 +1,42 @@
+#pragma once
+/* header 5632 */
+#include <vector>
+#include "h5793.h"
+#include "h9888.h"
+#include "h5698.h"
+#include "h337.h"
+#include "h3697.h"
+#ifdef X
+#include "h7116.h"
+#endif
+struct S5632 { int a; const char *s = "x//y"; };
+inline int f5632_0(int x) { return x * 0; }
+inline int f5632_1(int x) { return x * 1; }
+inline int f5632_2(int x) { return x * 2; }
+inline int f5632_3(int x) { return x * 3; }
+inline int f5632_4(int x) { return x * 4; }
+inline int f5632_5(int x) { return x * 5; }
+inline int f5632_6(int x) { return x * 6; }
+inline int f5632_7(int x) { return x * 7; }
+inline int f5632_8(int x) { return x * 8; }
+inline int f5632_9(int x) { return x * 9; }
+inline int f5632_10(int x) { return x * 10; }
+inline int f5632_11(int x) { return x * 11; }
+inline int f5632_12(int x) { return x * 12; }
+inline int f5632_13(int x) { return x * 13; }
+inline int f5632_14(int x) { return x * 14; }
+inline int f5632_15(int x) { return x * 15; }
+inline int f5632_16(int x) { return x * 16; }
+inline int f5632_17(int x) { return x * 17; }
+inline int f5632_18(int x) { return x * 18; }
+inline int f5632_19(int x) { return x * 19; }
+inline int f5632_20(int x) { return x * 20; }
+inline int f5632_21(int x) { return x * 21; }
+inline int f5632_22(int x) { return x * 22; }
+inline int f5632_23(int x) { return x * 23; }
+inline int f5632_24(int x) { return x * 24; }
+inline int f5632_25(int x) { return x * 25; }
+inline int f5632_26(int x) { return x * 26; }
+inline int f5632_27(int x) { return x * 27; }
+inline int f5632_28(int x) { return x * 28; }
+inline int f5632_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5633 */
+#include <vector>
+#include "h7814.h"
+#include "h1314.h"
+#include "h5796.h"
+#include "h8099.h"
+#include "h201.h"
+#ifdef X
+#include "h5464.h"
+#endif
+struct S5633 { int a; const char *s = "x//y"; };
+inline int f5633_0(int x) { return x * 0; }
+inline int f5633_1(int x) { return x * 1; }
+inline int f5633_2(int x) { return x * 2; }
+inline int f5633_3(int x) { return x * 3; }
+inline int f5633_4(int x) { return x * 4; }
+inline int f5633_5(int x) { return x * 5; }
+inline int f5633_6(int x) { return x * 6; }
+inline int f5633_7(int x) { return x * 7; }
+inline int f5633_8(int x) { return x * 8; }
+inline int f5633_9(int x) { return x * 9; }
+inline int f5633_10(int x) { return x * 10; }
+inline int f5633_11(int x) { return x * 11; }
+inline int f5633_12(int x) { return x * 12; }
+inline int f5633_13(int x) { return x * 13; }
+inline int f5633_14(int x) { return x * 14; }
+inline int f5633_15(int x) { return x * 15; }
+inline int f5633_16(int x) { return x * 16; }
+inline int f5633_17(int x) { return x * 17; }
+inline int f5633_18(int x) { return x * 18; }
+inline int f5633_19(int x) { return x * 19; }
+inline int f5633_20(int x) { return x * 20; }
+inline int f5633_21(int x) { return x * 21; }
+inline int f5633_22(int x) { return x * 22; }
+inline int f5633_23(int x) { return x * 23; }
+inline int f5633_24(int x) { return x * 24; }
+inline int f5633_25(int x) { return x * 25; }
+inline int f5633_26(int x) { return x * 26; }
+inline int f5633_27(int x) { return x * 27; }
+inline int f5633_28(int x) { return x * 28; }
+inline int f5633_29(int x) { return x * 29; }
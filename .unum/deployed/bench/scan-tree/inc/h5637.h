@@ -0,0 +1,42 @@
+#pragma once
+/* header 5637 */
+#include <vector>
+#include "h4473.h"
+#include "h8372.h"
+#include "h860.h"
+#include "h4788.h"
+#include "h6544.h"
+#ifdef X
+#include "h2506.h"
+#endif
+struct S5637 { int a; const char *s = "x//y"; };
+inline int f5637_0(int x) { return x * 0; }
+inline int f5637_1(int x) { return x * 1; }
+inline int f5637_2(int x) { return x * 2; }
+inline int f5637_3(int x) { return x * 3; }
+inline int f5637_4(int x) { return x * 4; }
+inline int f5637_5(int x) { return x * 5; }
+inline int f5637_6(int x) { return x * 6; }
+inline int f5637_7(int x) { return x * 7; }
+inline int f5637_8(int x) { return x * 8; }
+inline int f5637_9(int x) { return x * 9; }
+inline int f5637_10(int x) { return x * 10; }
+inline int f5637_11(int x) { return x * 11; }
+inline int f5637_12(int x) { return x * 12; }
+inline int f5637_13(int x) { return x * 13; }
+inline int f5637_14(int x) { return x * 14; }
+inline int f5637_15(int x) { return x * 15; }
+inline int f5637_16(int x) { return x * 16; }
+inline int f5637_17(int x) { return x * 17; }
+inline int f5637_18(int x) { return x * 18; }
+inline int f5637_19(int x) { return x * 19; }
+inline int f5637_20(int x) { return x * 20; }
+inline int f5637_21(int x) { return x * 21; }
+inline int f5637_22(int x) { return x * 22; }
+inline int f5637_23(int x) { return x * 23; }
+inline int f5637_24(int x) { return x * 24; }
+inline int f5637_25(int x) { return x * 25; }
+inline int f5637_26(int x) { return x * 26; }
+inline int f5637_27(int x) { return x * 27; }
+inline int f5637_28(int x) { return x * 28; }
+inline int f5637_29(int x) { return x * 29; }
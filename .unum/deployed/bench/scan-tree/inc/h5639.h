@@ -0,0 +1,42 @@
+#pragma once
+/* header 5639 */
+#include <vector>
+#include "h4434.h"
+#include "h1146.h"
+#include "h5622.h"
+#include "h4208.h"
+#include "h6486.h"
+#ifdef X
+#include "h478.h"
+#endif
+struct S5639 { int a; const char *s = "x//y"; };
+inline int f5639_0(int x) { return x * 0; }
+inline int f5639_1(int x) { return x * 1; }
+inline int f5639_2(int x) { return x * 2; }
+inline int f5639_3(int x) { return x * 3; }
+inline int f5639_4(int x) { return x * 4; }
+inline int f5639_5(int x) { return x * 5; }
+inline int f5639_6(int x) { return x * 6; }
+inline int f5639_7(int x) { return x * 7; }
+inline int f5639_8(int x) { return x * 8; }
+inline int f5639_9(int x) { return x * 9; }
+inline int f5639_10(int x) { return x * 10; }
+inline int f5639_11(int x) { return x * 11; }
+inline int f5639_12(int x) { return x * 12; }
+inline int f5639_13(int x) { return x * 13; }
+inline int f5639_14(int x) { return x * 14; }
+inline int f5639_15(int x) { return x * 15; }
+inline int f5639_16(int x) { return x * 16; }
+inline int f5639_17(int x) { return x * 17; }
+inline int f5639_18(int x) { return x * 18; }
+inline int f5639_19(int x) { return x * 19; }
+inline int f5639_20(int x) { return x * 20; }
+inline int f5639_21(int x) { return x * 21; }
+inline int f5639_22(int x) { return x * 22; }
+inline int f5639_23(int x) { return x * 23; }
+inline int f5639_24(int x) { return x * 24; }
+inline int f5639_25(int x) { return x * 25; }
+inline int f5639_26(int x) { return x * 26; }
+inline int f5639_27(int x) { return x * 27; }
+inline int f5639_28(int x) { return x * 28; }
+inline int f5639_29(int x) { return x * 29; }
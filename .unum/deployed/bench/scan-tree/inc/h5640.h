@@ -0,0 +1,42 @@
+#pragma once
+/* header 5640 */
+#include <vector>
+#include "h3475.h"
+#include "h7366.h"
+#include "h4710.h"
+#include "h2910.h"
+#include "h8509.h"
+#ifdef X
+#include "h9150.h"
+#endif
+struct S5640 { int a; const char *s = "x//y"; };
+inline int f5640_0(int x) { return x * 0; }
+inline int f5640_1(int x) { return x * 1; }
+inline int f5640_2(int x) { return x * 2; }
+inline int f5640_3(int x) { return x * 3; }
+inline int f5640_4(int x) { return x * 4; }
+inline int f5640_5(int x) { return x * 5; }
+inline int f5640_6(int x) { return x * 6; }
+inline int f5640_7(int x) { return x * 7; }
+inline int f5640_8(int x) { return x * 8; }
+inline int f5640_9(int x) { return x * 9; }
+inline int f5640_10(int x) { return x * 10; }
+inline int f5640_11(int x) { return x * 11; }
+inline int f5640_12(int x) { return x * 12; }
+inline int f5640_13(int x) { return x * 13; }
+inline int f5640_14(int x) { return x * 14; }
+inline int f5640_15(int x) { return x * 15; }
+inline int f5640_16(int x) { return x * 16; }
+inline int f5640_17(int x) { return x * 17; }
+inline int f5640_18(int x) { return x * 18; }
+inline int f5640_19(int x) { return x * 19; }
+inline int f5640_20(int x) { return x * 20; }
+inline int f5640_21(int x) { return x * 21; }
+inline int f5640_22(int x) { return x * 22; }
+inline int f5640_23(int x) { return x * 23; }
+inline int f5640_24(int x) { return x * 24; }
+inline int f5640_25(int x) { return x * 25; }
+inline int f5640_26(int x) { return x * 26; }
+inline int f5640_27(int x) { return x * 27; }
+inline int f5640_28(int x) { return x * 28; }
+inline int f5640_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5641 */
+#include <vector>
+#include "h9939.h"
+#include "h6676.h"
+#include "h2593.h"
+#include "h758.h"
+#include "h8836.h"
+#ifdef X
+#include "h5335.h"
+#endif
+struct S5641 { int a; const char *s = "x//y"; };
+inline int f5641_0(int x) { return x * 0; }
+inline int f5641_1(int x) { return x * 1; }
+inline int f5641_2(int x) { return x * 2; }
+inline int f5641_3(int x) { return x * 3; }
+inline int f5641_4(int x) { return x * 4; }
+inline int f5641_5(int x) { return x * 5; }
+inline int f5641_6(int x) { return x * 6; }
+inline int f5641_7(int x) { return x * 7; }
+inline int f5641_8(int x) { return x * 8; }
+inline int f5641_9(int x) { return x * 9; }
+inline int f5641_10(int x) { return x * 10; }
+inline int f5641_11(int x) { return x * 11; }
+inline int f5641_12(int x) { return x * 12; }
+inline int f5641_13(int x) { return x * 13; }
+inline int f5641_14(int x) { return x * 14; }
+inline int f5641_15(int x) { return x * 15; }
+inline int f5641_16(int x) { return x * 16; }
+inline int f5641_17(int x) { return x * 17; }
+inline int f5641_18(int x) { return x * 18; }
+inline int f5641_19(int x) { return x * 19; }
+inline int f5641_20(int x) { return x * 20; }
+inline int f5641_21(int x) { return x * 21; }
+inline int f5641_22(int x) { return x * 22; }
+inline int f5641_23(int x) { return x * 23; }
+inline int f5641_24(int x) { return x * 24; }
+inline int f5641_25(int x) { return x * 25; }
+inline int f5641_26(int x) { return x * 26; }
+inline int f5641_27(int x) { return x * 27; }
+inline int f5641_28(int x) { return x * 28; }
+inline int f5641_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5642 */
+#include <vector>
+#include "h8293.h"
+#include "h4754.h"
+#include "h6817.h"
+#include "h9373.h"
+#include "h9766.h"
+#ifdef X
+#include "h8019.h"
+#endif
+struct S5642 { int a; const char *s = "x//y"; };
+inline int f5642_0(int x) { return x * 0; }
+inline int f5642_1(int x) { return x * 1; }
+inline int f5642_2(int x) { return x * 2; }
+inline int f5642_3(int x) { return x * 3; }
+inline int f5642_4(int x) { return x * 4; }
+inline int f5642_5(int x) { return x * 5; }
+inline int f5642_6(int x) { return x * 6; }
+inline int f5642_7(int x) { return x * 7; }
+inline int f5642_8(int x) { return x * 8; }
+inline int f5642_9(int x) { return x * 9; }
+inline int f5642_10(int x) { return x * 10; }
+inline int f5642_11(int x) { return x * 11; }
+inline int f5642_12(int x) { return x * 12; }
+inline int f5642_13(int x) { return x * 13; }
+inline int f5642_14(int x) { return x * 14; }
+inline int f5642_15(int x) { return x * 15; }
+inline int f5642_16(int x) { return x * 16; }
+inline int f5642_17(int x) { return x * 17; }
+inline int f5642_18(int x) { return x * 18; }
+inline int f5642_19(int x) { return x * 19; }
+inline int f5642_20(int x) { return x * 20; }
+inline int f5642_21(int x) { return x * 21; }
+inline int f5642_22(int x) { return x * 22; }
+inline int f5642_23(int x) { return x * 23; }
+inline int f5642_24(int x) { return x * 24; }
+inline int f5642_25(int x) { return x * 25; }
+inline int f5642_26(int x) { return x * 26; }
+inline int f5642_27(int x) { return x * 27; }
+inline int f5642_28(int x) { return x * 28; }
+inline int f5642_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5646 */
+#include <vector>
+#include "h2241.h"
+#include "h4348.h"
+#include "h7073.h"
+#include "h916.h"
+#include "h7624.h"
+#ifdef X
+#include "h6626.h"
+#endif
+struct S5646 { int a; const char *s = "x//y"; };
+inline int f5646_0(int x) { return x * 0; }
+inline int f5646_1(int x) { return x * 1; }
+inline int f5646_2(int x) { return x * 2; }
+inline int f5646_3(int x) { return x * 3; }
+inline int f5646_4(int x) { return x * 4; }
+inline int f5646_5(int x) { return x * 5; }
+inline int f5646_6(int x) { return x * 6; }
+inline int f5646_7(int x) { return x * 7; }
+inline int f5646_8(int x) { return x * 8; }
+inline int f5646_9(int x) { return x * 9; }
+inline int f5646_10(int x) { return x * 10; }
+inline int f5646_11(int x) { return x * 11; }
+inline int f5646_12(int x) { return x * 12; }
+inline int f5646_13(int x) { return x * 13; }
+inline int f5646_14(int x) { return x * 14; }
+inline int f5646_15(int x) { return x * 15; }
+inline int f5646_16(int x) { return x * 16; }
+inline int f5646_17(int x) { return x * 17; }
+inline int f5646_18(int x) { return x * 18; }
+inline int f5646_19(int x) { return x * 19; }
+inline int f5646_20(int x) { return x * 20; }
+inline int f5646_21(int x) { return x * 21; }
+inline int f5646_22(int x) { return x * 22; }
+inline int f5646_23(int x) { return x * 23; }
+inline int f5646_24(int x) { return x * 24; }
+inline int f5646_25(int x) { return x * 25; }
+inline int f5646_26(int x) { return x * 26; }
+inline int f5646_27(int x) { return x * 27; }
+inline int f5646_28(int x) { return x * 28; }
+inline int f5646_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5650 */
+#include <vector>
+#include "h6219.h"
+#include "h1780.h"
+#include "h9082.h"
+#include "h3741.h"
+#include "h4871.h"
+#ifdef X
+#include "h1700.h"
+#endif
+struct S5650 { int a; const char *s = "x//y"; };
+inline int f5650_0(int x) { return x * 0; }
+inline int f5650_1(int x) { return x * 1; }
+inline int f5650_2(int x) { return x * 2; }
+inline int f5650_3(int x) { return x * 3; }
+inline int f5650_4(int x) { return x * 4; }
+inline int f5650_5(int x) { return x * 5; }
+inline int f5650_6(int x) { return x * 6; }
+inline int f5650_7(int x) { return x * 7; }
+inline int f5650_8(int x) { return x * 8; }
+inline int f5650_9(int x) { return x * 9; }
+inline int f5650_10(int x) { return x * 10; }
+inline int f5650_11(int x) { return x * 11; }
+inline int f5650_12(int x) { return x * 12; }
+inline int f5650_13(int x) { return x * 13; }
+inline int f5650_14(int x) { return x * 14; }
+inline int f5650_15(int x) { return x * 15; }
+inline int f5650_16(int x) { return x * 16; }
+inline int f5650_17(int x) { return x * 17; }
+inline int f5650_18(int x) { return x * 18; }
+inline int f5650_19(int x) { return x * 19; }
+inline int f5650_20(int x) { return x * 20; }
+inline int f5650_21(int x) { return x * 21; }
+inline int f5650_22(int x) { return x * 22; }
+inline int f5650_23(int x) { return x * 23; }
+inline int f5650_24(int x) { return x * 24; }
+inline int f5650_25(int x) { return x * 25; }
+inline int f5650_26(int x) { return x * 26; }
+inline int f5650_27(int x) { return x * 27; }
+inline int f5650_28(int x) { return x * 28; }
+inline int f5650_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5651 */
+#include <vector>
+#include "h2404.h"
+#include "h6266.h"
+#include "h6995.h"
+#include "h2672.h"
+#include "h9712.h"
+#ifdef X
+#include "h2236.h"
+#endif
+struct S5651 { int a; const char *s = "x//y"; };
+inline int f5651_0(int x) { return x * 0; }
+inline int f5651_1(int x) { return x * 1; }
+inline int f5651_2(int x) { return x * 2; }
+inline int f5651_3(int x) { return x * 3; }
+inline int f5651_4(int x) { return x * 4; }
+inline int f5651_5(int x) { return x * 5; }
+inline int f5651_6(int x) { return x * 6; }
+inline int f5651_7(int x) { return x * 7; }
+inline int f5651_8(int x) { return x * 8; }
+inline int f5651_9(int x) { return x * 9; }
+inline int f5651_10(int x) { return x * 10; }
+inline int f5651_11(int x) { return x * 11; }
+inline int f5651_12(int x) { return x * 12; }
+inline int f5651_13(int x) { return x * 13; }
+inline int f5651_14(int x) { return x * 14; }
+inline int f5651_15(int x) { return x * 15; }
+inline int f5651_16(int x) { return x * 16; }
+inline int f5651_17(int x) { return x * 17; }
+inline int f5651_18(int x) { return x * 18; }
+inline int f5651_19(int x) { return x * 19; }
+inline int f5651_20(int x) { return x * 20; }
+inline int f5651_21(int x) { return x * 21; }
+inline int f5651_22(int x) { return x * 22; }
+inline int f5651_23(int x) { return x * 23; }
+inline int f5651_24(int x) { return x * 24; }
+inline int f5651_25(int x) { return x * 25; }
+inline int f5651_26(int x) { return x * 26; }
+inline int f5651_27(int x) { return x * 27; }
+inline int f5651_28(int x) { return x * 28; }
+inline int f5651_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5652 */
+#include <vector>
+#include "h492.h"
+#include "h5764.h"
+#include "h2423.h"
+#include "h4729.h"
+#include "h8203.h"
+#ifdef X
+#include "h8395.h"
+#endif
+struct S5652 { int a; const char *s = "x//y"; };
+inline int f5652_0(int x) { return x * 0; }
+inline int f5652_1(int x) { return x * 1; }
+inline int f5652_2(int x) { return x * 2; }
+inline int f5652_3(int x) { return x * 3; }
+inline int f5652_4(int x) { return x * 4; }
+inline int f5652_5(int x) { return x * 5; }
+inline int f5652_6(int x) { return x * 6; }
+inline int f5652_7(int x) { return x * 7; }
+inline int f5652_8(int x) { return x * 8; }
+inline int f5652_9(int x) { return x * 9; }
+inline int f5652_10(int x) { return x * 10; }
+inline int f5652_11(int x) { return x * 11; }
+inline int f5652_12(int x) { return x * 12; }
+inline int f5652_13(int x) { return x * 13; }
+inline int f5652_14(int x) { return x * 14; }
+inline int f5652_15(int x) { return x * 15; }
+inline int f5652_16(int x) { return x * 16; }
+inline int f5652_17(int x) { return x * 17; }
+inline int f5652_18(int x) { return x * 18; }
+inline int f5652_19(int x) { return x * 19; }
+inline int f5652_20(int x) { return x * 20; }
+inline int f5652_21(int x) { return x * 21; }
+inline int f5652_22(int x) { return x * 22; }
+inline int f5652_23(int x) { return x * 23; }
+inline int f5652_24(int x) { return x * 24; }
+inline int f5652_25(int x) { return x * 25; }
+inline int f5652_26(int x) { return x * 26; }
+inline int f5652_27(int x) { return x * 27; }
+inline int f5652_28(int x) { return x * 28; }
+inline int f5652_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5655 */
+#include <vector>
+#include "h2538.h"
+#include "h5470.h"
+#include "h7144.h"
+#include "h3772.h"
+#include "h2196.h"
+#ifdef X
+#include "h4632.h"
+#endif
+struct S5655 { int a; const char *s = "x//y"; };
+inline int f5655_0(int x) { return x * 0; }
+inline int f5655_1(int x) { return x * 1; }
+inline int f5655_2(int x) { return x * 2; }
+inline int f5655_3(int x) { return x * 3; }
+inline int f5655_4(int x) { return x * 4; }
+inline int f5655_5(int x) { return x * 5; }
+inline int f5655_6(int x) { return x * 6; }
+inline int f5655_7(int x) { return x * 7; }
+inline int f5655_8(int x) { return x * 8; }
+inline int f5655_9(int x) { return x * 9; }
+inline int f5655_10(int x) { return x * 10; }
+inline int f5655_11(int x) { return x * 11; }
+inline int f5655_12(int x) { return x * 12; }
+inline int f5655_13(int x) { return x * 13; }
+inline int f5655_14(int x) { return x * 14; }
+inline int f5655_15(int x) { return x * 15; }
+inline int f5655_16(int x) { return x * 16; }
+inline int f5655_17(int x) { return x * 17; }
+inline int f5655_18(int x) { return x * 18; }
+inline int f5655_19(int x) { return x * 19; }
+inline int f5655_20(int x) { return x * 20; }
+inline int f5655_21(int x) { return x * 21; }
+inline int f5655_22(int x) { return x * 22; }
+inline int f5655_23(int x) { return x * 23; }
+inline int f5655_24(int x) { return x * 24; }
+inline int f5655_25(int x) { return x * 25; }
+inline int f5655_26(int x) { return x * 26; }
+inline int f5655_27(int x) { return x * 27; }
+inline int f5655_28(int x) { return x * 28; }
+inline int f5655_29(int x) { return x * 29; }
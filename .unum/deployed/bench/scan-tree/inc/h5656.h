@@ -0,0 +1,42 @@
+#pragma once
+/* header 5656 */
+#include <vector>
+#include "h257.h"
+#include "h3721.h"
+#include "h5694.h"
+#include "h3757.h"
+#include "h5362.h"
+#ifdef X
+#include "h7327.h"
+#endif
+struct S5656 { int a; const char *s = "x//y"; };
+inline int f5656_0(int x) { return x * 0; }
+inline int f5656_1(int x) { return x * 1; }
+inline int f5656_2(int x) { return x * 2; }
+inline int f5656_3(int x) { return x * 3; }
+inline int f5656_4(int x) { return x * 4; }
+inline int f5656_5(int x) { return x * 5; }
+inline int f5656_6(int x) { return x * 6; }
+inline int f5656_7(int x) { return x * 7; }
+inline int f5656_8(int x) { return x * 8; }
+inline int f5656_9(int x) { return x * 9; }
+inline int f5656_10(int x) { return x * 10; }
+inline int f5656_11(int x) { return x * 11; }
+inline int f5656_12(int x) { return x * 12; }
+inline int f5656_13(int x) { return x * 13; }
+inline int f5656_14(int x) { return x * 14; }
+inline int f5656_15(int x) { return x * 15; }
+inline int f5656_16(int x) { return x * 16; }
+inline int f5656_17(int x) { return x * 17; }
+inline int f5656_18(int x) { return x * 18; }
+inline int f5656_19(int x) { return x * 19; }
+inline int f5656_20(int x) { return x * 20; }
+inline int f5656_21(int x) { return x * 21; }
+inline int f5656_22(int x) { return x * 22; }
+inline int f5656_23(int x) { return x * 23; }
+inline int f5656_24(int x) { return x * 24; }
+inline int f5656_25(int x) { return x * 25; }
+inline int f5656_26(int x) { return x * 26; }
+inline int f5656_27(int x) { return x * 27; }
+inline int f5656_28(int x) { return x * 28; }
+inline int f5656_29(int x) { return x * 29; }
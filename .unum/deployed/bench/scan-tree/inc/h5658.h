@@ -0,0 +1,42 @@
+#pragma once
+/* header 5658 */
+#include <vector>
+#include "h3882.h"
+#include "h8090.h"
+#include "h8874.h"
+#include "h6403.h"
+#include "h1819.h"
+#ifdef X
+#include "h2085.h"
+#endif
+struct S5658 { int a; const char *s = "x//y"; };
+inline int f5658_0(int x) { return x * 0; }
+inline int f5658_1(int x) { return x * 1; }
+inline int f5658_2(int x) { return x * 2; }
+inline int f5658_3(int x) { return x * 3; }
+inline int f5658_4(int x) { return x * 4; }
+inline int f5658_5(int x) { return x * 5; }
+inline int f5658_6(int x) { return x * 6; }
+inline int f5658_7(int x) { return x * 7; }
+inline int f5658_8(int x) { return x * 8; }
+inline int f5658_9(int x) { return x * 9; }
+inline int f5658_10(int x) { return x * 10; }
+inline int f5658_11(int x) { return x * 11; }
+inline int f5658_12(int x) { return x * 12; }
+inline int f5658_13(int x) { return x * 13; }
+inline int f5658_14(int x) { return x * 14; }
+inline int f5658_15(int x) { return x * 15; }
+inline int f5658_16(int x) { return x * 16; }
+inline int f5658_17(int x) { return x * 17; }
+inline int f5658_18(int x) { return x * 18; }
+inline int f5658_19(int x) { return x * 19; }
+inline int f5658_20(int x) { return x * 20; }
+inline int f5658_21(int x) { return x * 21; }
+inline int f5658_22(int x) { return x * 22; }
+inline int f5658_23(int x) { return x * 23; }
+inline int f5658_24(int x) { return x * 24; }
+inline int f5658_25(int x) { return x * 25; }
+inline int f5658_26(int x) { return x * 26; }
+inline int f5658_27(int x) { return x * 27; }
+inline int f5658_28(int x) { return x * 28; }
+inline int f5658_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5663 */
+#include <vector>
+#include "h6519.h"
+#include "h9325.h"
+#include "h8422.h"
+#include "h7561.h"
+#include "h8141.h"
+#ifdef X
+#include "h1945.h"
+#endif
+struct S5663 { int a; const char *s = "x//y"; };
+inline int f5663_0(int x) { return x * 0; }
+inline int f5663_1(int x) { return x * 1; }
+inline int f5663_2(int x) { return x * 2; }
+inline int f5663_3(int x) { return x * 3; }
+inline int f5663_4(int x) { return x * 4; }
+inline int f5663_5(int x) { return x * 5; }
+inline int f5663_6(int x) { return x * 6; }
+inline int f5663_7(int x) { return x * 7; }
+inline int f5663_8(int x) { return x * 8; }
+inline int f5663_9(int x) { return x * 9; }
+inline int f5663_10(int x) { return x * 10; }
+inline int f5663_11(int x) { return x * 11; }
+inline int f5663_12(int x) { return x * 12; }
+inline int f5663_13(int x) { return x * 13; }
+inline int f5663_14(int x) { return x * 14; }
+inline int f5663_15(int x) { return x * 15; }
+inline int f5663_16(int x) { return x * 16; }
+inline int f5663_17(int x) { return x * 17; }
+inline int f5663_18(int x) { return x * 18; }
+inline int f5663_19(int x) { return x * 19; }
+inline int f5663_20(int x) { return x * 20; }
+inline int f5663_21(int x) { return x * 21; }
+inline int f5663_22(int x) { return x * 22; }
+inline int f5663_23(int x) { return x * 23; }
+inline int f5663_24(int x) { return x * 24; }
+inline int f5663_25(int x) { return x * 25; }
+inline int f5663_26(int x) { return x * 26; }
+inline int f5663_27(int x) { return x * 27; }
+inline int f5663_28(int x) { return x * 28; }
+inline int f5663_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5666 */
+#include <vector>
+#include "h9272.h"
+#include "h331.h"
+#include "h3211.h"
+#include "h437.h"
+#include "h7861.h"
+#ifdef X
+#include "h6201.h"
+#endif
+struct S5666 { int a; const char *s = "x//y"; };
+inline int f5666_0(int x) { return x * 0; }
+inline int f5666_1(int x) { return x * 1; }
+inline int f5666_2(int x) { return x * 2; }
+inline int f5666_3(int x) { return x * 3; }
+inline int f5666_4(int x) { return x * 4; }
+inline int f5666_5(int x) { return x * 5; }
+inline int f5666_6(int x) { return x * 6; }
+inline int f5666_7(int x) { return x * 7; }
+inline int f5666_8(int x) { return x * 8; }
+inline int f5666_9(int x) { return x * 9; }
+inline int f5666_10(int x) { return x * 10; }
+inline int f5666_11(int x) { return x * 11; }
+inline int f5666_12(int x) { return x * 12; }
+inline int f5666_13(int x) { return x * 13; }
+inline int f5666_14(int x) { return x * 14; }
+inline int f5666_15(int x) { return x * 15; }
+inline int f5666_16(int x) { return x * 16; }
+inline int f5666_17(int x) { return x * 17; }
+inline int f5666_18(int x) { return x * 18; }
+inline int f5666_19(int x) { return x * 19; }
+inline int f5666_20(int x) { return x * 20; }
+inline int f5666_21(int x) { return x * 21; }
+inline int f5666_22(int x) { return x * 22; }
+inline int f5666_23(int x) { return x * 23; }
+inline int f5666_24(int x) { return x * 24; }
+inline int f5666_25(int x) { return x * 25; }
+inline int f5666_26(int x) { return x * 26; }
+inline int f5666_27(int x) { return x * 27; }
+inline int f5666_28(int x) { return x * 28; }
+inline int f5666_29(int x) { return x * 29; }
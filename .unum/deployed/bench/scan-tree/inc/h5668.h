@@ -0,0 +1,42 @@
+#pragma once
+/* header 5668 */
+#include <vector>
+#include "h4189.h"
+#include "h8661.h"
+#include "h8518.h"
+#include "h4162.h"
+#include "h8087.h"
+#ifdef X
+#include "h8518.h"
+#endif
+struct S5668 { int a; const char *s = "x//y"; };
+inline int f5668_0(int x) { return x * 0; }
+inline int f5668_1(int x) { return x * 1; }
+inline int f5668_2(int x) { return x * 2; }
+inline int f5668_3(int x) { return x * 3; }
+inline int f5668_4(int x) { return x * 4; }
+inline int f5668_5(int x) { return x * 5; }
+inline int f5668_6(int x) { return x * 6; }
+inline int f5668_7(int x) { return x * 7; }
+inline int f5668_8(int x) { return x * 8; }
+inline int f5668_9(int x) { return x * 9; }
+inline int f5668_10(int x) { return x * 10; }
+inline int f5668_11(int x) { return x * 11; }
+inline int f5668_12(int x) { return x * 12; }
+inline int f5668_13(int x) { return x * 13; }
+inline int f5668_14(int x) { return x * 14; }
+inline int f5668_15(int x) { return x * 15; }
+inline int f5668_16(int x) { return x * 16; }
+inline int f5668_17(int x) { return x * 17; }
+inline int f5668_18(int x) { return x * 18; }
+inline int f5668_19(int x) { return x * 19; }
+inline int f5668_20(int x) { return x * 20; }
+inline int f5668_21(int x) { return x * 21; }
+inline int f5668_22(int x) { return x * 22; }
+inline int f5668_23(int x) { return x * 23; }
+inline int f5668_24(int x) { return x * 24; }
+inline int f5668_25(int x) { return x * 25; }
+inline int f5668_26(int x) { return x * 26; }
+inline int f5668_27(int x) { return x * 27; }
+inline int f5668_28(int x) { return x * 28; }
+inline int f5668_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5669 */
+#include <vector>
+#include "h5124.h"
+#include "h1099.h"
+#include "h481.h"
+#include "h4151.h"
+#include "h7789.h"
+#ifdef X
+#include "h6096.h"
+#endif
+struct S5669 { int a; const char *s = "x//y"; };
+inline int f5669_0(int x) { return x * 0; }
+inline int f5669_1(int x) { return x * 1; }
+inline int f5669_2(int x) { return x * 2; }
+inline int f5669_3(int x) { return x * 3; }
+inline int f5669_4(int x) { return x * 4; }
+inline int f5669_5(int x) { return x * 5; }
+inline int f5669_6(int x) { return x * 6; }
+inline int f5669_7(int x) { return x * 7; }
+inline int f5669_8(int x) { return x * 8; }
+inline int f5669_9(int x) { return x * 9; }
+inline int f5669_10(int x) { return x * 10; }
+inline int f5669_11(int x) { return x * 11; }
+inline int f5669_12(int x) { return x * 12; }
+inline int f5669_13(int x) { return x * 13; }
+inline int f5669_14(int x) { return x * 14; }
+inline int f5669_15(int x) { return x * 15; }
+inline int f5669_16(int x) { return x * 16; }
+inline int f5669_17(int x) { return x * 17; }
+inline int f5669_18(int x) { return x * 18; }
+inline int f5669_19(int x) { return x * 19; }
+inline int f5669_20(int x) { return x * 20; }
+inline int f5669_21(int x) { return x * 21; }
+inline int f5669_22(int x) { return x * 22; }
+inline int f5669_23(int x) { return x * 23; }
+inline int f5669_24(int x) { return x * 24; }
+inline int f5669_25(int x) { return x * 25; }
+inline int f5669_26(int x) { return x * 26; }
+inline int f5669_27(int x) { return x * 27; }
+inline int f5669_28(int x) { return x * 28; }
+inline int f5669_29(int x) { return x * 29; }
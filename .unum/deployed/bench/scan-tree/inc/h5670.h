@@ -0,0 +1,42 @@
+#pragma once
+/* header 5670 */
+#include <vector>
+#include "h8318.h"
+#include "h5929.h"
+#include "h6659.h"
+#include "h5600.h"
+#include "h3490.h"
+#ifdef X
+#include "h5768.h"
+#endif
+struct S5670 { int a; const char *s = "x//y"; };
+inline int f5670_0(int x) { return x * 0; }
+inline int f5670_1(int x) { return x * 1; }
+inline int f5670_2(int x) { return x * 2; }
+inline int f5670_3(int x) { return x * 3; }
+inline int f5670_4(int x) { return x * 4; }
+inline int f5670_5(int x) { return x * 5; }
+inline int f5670_6(int x) { return x * 6; }
+inline int f5670_7(int x) { return x * 7; }
+inline int f5670_8(int x) { return x * 8; }
+inline int f5670_9(int x) { return x * 9; }
+inline int f5670_10(int x) { return x * 10; }
+inline int f5670_11(int x) { return x * 11; }
+inline int f5670_12(int x) { return x * 12; }
+inline int f5670_13(int x) { return x * 13; }
+inline int f5670_14(int x) { return x * 14; }
+inline int f5670_15(int x) { return x * 15; }
+inline int f5670_16(int x) { return x * 16; }
+inline int f5670_17(int x) { return x * 17; }
+inline int f5670_18(int x) { return x * 18; }
+inline int f5670_19(int x) { return x * 19; }
+inline int f5670_20(int x) { return x * 20; }
+inline int f5670_21(int x) { return x * 21; }
+inline int f5670_22(int x) { return x * 22; }
+inline int f5670_23(int x) { return x * 23; }
+inline int f5670_24(int x) { return x * 24; }
+inline int f5670_25(int x) { return x * 25; }
+inline int f5670_26(int x) { return x * 26; }
+inline int f5670_27(int x) { return x * 27; }
+inline int f5670_28(int x) { return x * 28; }
+inline int f5670_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5672 */
+#include <vector>
+#include "h6729.h"
+#include "h2262.h"
+#include "h8944.h"
+#include "h7987.h"
+#include "h8055.h"
+#ifdef X
+#include "h1897.h"
+#endif
+struct S5672 { int a; const char *s = "x//y"; };
+inline int f5672_0(int x) { return x * 0; }
+inline int f5672_1(int x) { return x * 1; }
+inline int f5672_2(int x) { return x * 2; }
+inline int f5672_3(int x) { return x * 3; }
+inline int f5672_4(int x) { return x * 4; }
+inline int f5672_5(int x) { return x * 5; }
+inline int f5672_6(int x) { return x * 6; }
+inline int f5672_7(int x) { return x * 7; }
+inline int f5672_8(int x) { return x * 8; }
+inline int f5672_9(int x) { return x * 9; }
+inline int f5672_10(int x) { return x * 10; }
+inline int f5672_11(int x) { return x * 11; }
+inline int f5672_12(int x) { return x * 12; }
+inline int f5672_13(int x) { return x * 13; }
+inline int f5672_14(int x) { return x * 14; }
+inline int f5672_15(int x) { return x * 15; }
+inline int f5672_16(int x) { return x * 16; }
+inline int f5672_17(int x) { return x * 17; }
+inline int f5672_18(int x) { return x * 18; }
+inline int f5672_19(int x) { return x * 19; }
+inline int f5672_20(int x) { return x * 20; }
+inline int f5672_21(int x) { return x * 21; }
+inline int f5672_22(int x) { return x * 22; }
+inline int f5672_23(int x) { return x * 23; }
+inline int f5672_24(int x) { return x * 24; }
+inline int f5672_25(int x) { return x * 25; }
+inline int f5672_26(int x) { return x * 26; }
+inline int f5672_27(int x) { return x * 27; }
+inline int f5672_28(int x) { return x * 28; }
+inline int f5672_29(int x) { return x * 29; }
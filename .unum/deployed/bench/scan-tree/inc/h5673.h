@@ -0,0 +1,42 @@
+#pragma once
+/* header 5673 */
+#include <vector>
+#include "h6625.h"
+#include "h7396.h"
+#include "h20.h"
+#include "h4394.h"
+#include "h8931.h"
+#ifdef X
+#include "h8876.h"
+#endif
+struct S5673 { int a; const char *s = "x//y"; };
+inline int f5673_0(int x) { return x * 0; }
+inline int f5673_1(int x) { return x * 1; }
+inline int f5673_2(int x) { return x * 2; }
+inline int f5673_3(int x) { return x * 3; }
+inline int f5673_4(int x) { return x * 4; }
+inline int f5673_5(int x) { return x * 5; }
+inline int f5673_6(int x) { return x * 6; }
+inline int f5673_7(int x) { return x * 7; }
+inline int f5673_8(int x) { return x * 8; }
+inline int f5673_9(int x) { return x * 9; }
+inline int f5673_10(int x) { return x * 10; }
+inline int f5673_11(int x) { return x * 11; }
+inline int f5673_12(int x) { return x * 12; }
+inline int f5673_13(int x) { return x * 13; }
+inline int f5673_14(int x) { return x * 14; }
+inline int f5673_15(int x) { return x * 15; }
+inline int f5673_16(int x) { return x * 16; }
+inline int f5673_17(int x) { return x * 17; }
+inline int f5673_18(int x) { return x * 18; }
+inline int f5673_19(int x) { return x * 19; }
+inline int f5673_20(int x) { return x * 20; }
+inline int f5673_21(int x) { return x * 21; }
+inline int f5673_22(int x) { return x * 22; }
+inline int f5673_23(int x) { return x * 23; }
+inline int f5673_24(int x) { return x * 24; }
+inline int f5673_25(int x) { return x * 25; }
+inline int f5673_26(int x) { return x * 26; }
+inline int f5673_27(int x) { return x * 27; }
+inline int f5673_28(int x) { return x * 28; }
+inline int f5673_29(int x) { return x * 29; }
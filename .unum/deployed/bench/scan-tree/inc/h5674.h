@@ -0,0 +1,42 @@
+#pragma once
+/* header 5674 */
+#include <vector>
+#include "h3627.h"
+#include "h8832.h"
+#include "h8198.h"
+#include "h8777.h"
+#include "h2772.h"
+#ifdef X
+#include "h6378.h"
+#endif
+struct S5674 { int a; const char *s = "x//y"; };
+inline int f5674_0(int x) { return x * 0; }
+inline int f5674_1(int x) { return x * 1; }
+inline int f5674_2(int x) { return x * 2; }
+inline int f5674_3(int x) { return x * 3; }
+inline int f5674_4(int x) { return x * 4; }
+inline int f5674_5(int x) { return x * 5; }
+inline int f5674_6(int x) { return x * 6; }
+inline int f5674_7(int x) { return x * 7; }
+inline int f5674_8(int x) { return x * 8; }
+inline int f5674_9(int x) { return x * 9; }
+inline int f5674_10(int x) { return x * 10; }
+inline int f5674_11(int x) { return x * 11; }
+inline int f5674_12(int x) { return x * 12; }
+inline int f5674_13(int x) { return x * 13; }
+inline int f5674_14(int x) { return x * 14; }
+inline int f5674_15(int x) { return x * 15; }
+inline int f5674_16(int x) { return x * 16; }
+inline int f5674_17(int x) { return x * 17; }
+inline int f5674_18(int x) { return x * 18; }
+inline int f5674_19(int x) { return x * 19; }
+inline int f5674_20(int x) { return x * 20; }
+inline int f5674_21(int x) { return x * 21; }
+inline int f5674_22(int x) { return x * 22; }
+inline int f5674_23(int x) { return x * 23; }
+inline int f5674_24(int x) { return x * 24; }
+inline int f5674_25(int x) { return x * 25; }
+inline int f5674_26(int x) { return x * 26; }
+inline int f5674_27(int x) { return x * 27; }
+inline int f5674_28(int x) { return x * 28; }
+inline int f5674_29(int x) { return x * 29; }
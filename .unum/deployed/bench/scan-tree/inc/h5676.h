@@ -0,0 +1,42 @@
+#pragma once
+/* header 5676 */
+#include <vector>
+#include "h4294.h"
+#include "h8674.h"
+#include "h967.h"
+#include "h4209.h"
+#include "h9636.h"
+#ifdef X
+#include "h2153.h"
+#endif
+struct S5676 { int a; const char *s = "x//y"; };
+inline int f5676_0(int x) { return x * 0; }
+inline int f5676_1(int x) { return x * 1; }
+inline int f5676_2(int x) { return x * 2; }
+inline int f5676_3(int x) { return x * 3; }
+inline int f5676_4(int x) { return x * 4; }
+inline int f5676_5(int x) { return x * 5; }
+inline int f5676_6(int x) { return x * 6; }
+inline int f5676_7(int x) { return x * 7; }
+inline int f5676_8(int x) { return x * 8; }
+inline int f5676_9(int x) { return x * 9; }
+inline int f5676_10(int x) { return x * 10; }
+inline int f5676_11(int x) { return x * 11; }
+inline int f5676_12(int x) { return x * 12; }
+inline int f5676_13(int x) { return x * 13; }
+inline int f5676_14(int x) { return x * 14; }
+inline int f5676_15(int x) { return x * 15; }
+inline int f5676_16(int x) { return x * 16; }
+inline int f5676_17(int x) { return x * 17; }
+inline int f5676_18(int x) { return x * 18; }
+inline int f5676_19(int x) { return x * 19; }
+inline int f5676_20(int x) { return x * 20; }
+inline int f5676_21(int x) { return x * 21; }
+inline int f5676_22(int x) { return x * 22; }
+inline int f5676_23(int x) { return x * 23; }
+inline int f5676_24(int x) { return x * 24; }
+inline int f5676_25(int x) { return x * 25; }
+inline int f5676_26(int x) { return x * 26; }
+inline int f5676_27(int x) { return x * 27; }
+inline int f5676_28(int x) { return x * 28; }
+inline int f5676_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5677 */
+#include <vector>
+#include "h8543.h"
+#include "h600.h"
+#include "h6388.h"
+#include "h450.h"
+#include "h1487.h"
+#ifdef X
+#include "h8597.h"
+#endif
+struct S5677 { int a; const char *s = "x//y"; };
+inline int f5677_0(int x) { return x * 0; }
+inline int f5677_1(int x) { return x * 1; }
+inline int f5677_2(int x) { return x * 2; }
+inline int f5677_3(int x) { return x * 3; }
+inline int f5677_4(int x) { return x * 4; }
+inline int f5677_5(int x) { return x * 5; }
+inline int f5677_6(int x) { return x * 6; }
+inline int f5677_7(int x) { return x * 7; }
+inline int f5677_8(int x) { return x * 8; }
+inline int f5677_9(int x) { return x * 9; }
+inline int f5677_10(int x) { return x * 10; }
+inline int f5677_11(int x) { return x * 11; }
+inline int f5677_12(int x) { return x * 12; }
+inline int f5677_13(int x) { return x * 13; }
+inline int f5677_14(int x) { return x * 14; }
+inline int f5677_15(int x) { return x * 15; }
+inline int f5677_16(int x) { return x * 16; }
+inline int f5677_17(int x) { return x * 17; }
+inline int f5677_18(int x) { return x * 18; }
+inline int f5677_19(int x) { return x * 19; }
+inline int f5677_20(int x) { return x * 20; }
+inline int f5677_21(int x) { return x * 21; }
+inline int f5677_22(int x) { return x * 22; }
+inline int f5677_23(int x) { return x * 23; }
+inline int f5677_24(int x) { return x * 24; }
+inline int f5677_25(int x) { return x * 25; }
+inline int f5677_26(int x) { return x * 26; }
+inline int f5677_27(int x) { return x * 27; }
+inline int f5677_28(int x) { return x * 28; }
+inline int f5677_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 568 */
+#include <vector>
+#include "h8584.h"
+#include "h5289.h"
+#include "h8339.h"
+#include "h5.h"
+#include "h7012.h"
+#ifdef X
+#include "h1937.h"
+#endif
+struct S568 { int a; const char *s = "x//y"; };
+inline int f568_0(int x) { return x * 0; }
+inline int f568_1(int x) { return x * 1; }
+inline int f568_2(int x) { return x * 2; }
+inline int f568_3(int x) { return x * 3; }
+inline int f568_4(int x) { return x * 4; }
+inline int f568_5(int x) { return x * 5; }
+inline int f568_6(int x) { return x * 6; }
+inline int f568_7(int x) { return x * 7; }
+inline int f568_8(int x) { return x * 8; }
+inline int f568_9(int x) { return x * 9; }
+inline int f568_10(int x) { return x * 10; }
+inline int f568_11(int x) { return x * 11; }
+inline int f568_12(int x) { return x * 12; }
+inline int f568_13(int x) { return x * 13; }
+inline int f568_14(int x) { return x * 14; }
+inline int f568_15(int x) { return x * 15; }
+inline int f568_16(int x) { return x * 16; }
+inline int f568_17(int x) { return x * 17; }
+inline int f568_18(int x) { return x * 18; }
+inline int f568_19(int x) { return x * 19; }
+inline int f568_20(int x) { return x * 20; }
+inline int f568_21(int x) { return x * 21; }
+inline int f568_22(int x) { return x * 22; }
+inline int f568_23(int x) { return x * 23; }
+inline int f568_24(int x) { return x * 24; }
+inline int f568_25(int x) { return x * 25; }
+inline int f568_26(int x) { return x * 26; }
+inline int f568_27(int x) { return x * 27; }
+inline int f568_28(int x) { return x * 28; }
+inline int f568_29(int x) { return x * 29; }
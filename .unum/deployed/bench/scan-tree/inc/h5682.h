@@ -0,0 +1,42 @@
+#pragma once
+/* header 5682 */
+#include <vector>
+#include "h1564.h"
+#include "h4614.h"
+#include "h3000.h"
+#include "h409.h"
+#include "h7945.h"
+#ifdef X
+#include "h7455.h"
+#endif
+struct S5682 { int a; const char *s = "x//y"; };
+inline int f5682_0(int x) { return x * 0; }
+inline int f5682_1(int x) { return x * 1; }
+inline int f5682_2(int x) { return x * 2; }
+inline int f5682_3(int x) { return x * 3; }
+inline int f5682_4(int x) { return x * 4; }
+inline int f5682_5(int x) { return x * 5; }
+inline int f5682_6(int x) { return x * 6; }
+inline int f5682_7(int x) { return x * 7; }
+inline int f5682_8(int x) { return x * 8; }
+inline int f5682_9(int x) { return x * 9; }
+inline int f5682_10(int x) { return x * 10; }
+inline int f5682_11(int x) { return x * 11; }
+inline int f5682_12(int x) { return x * 12; }
+inline int f5682_13(int x) { return x * 13; }
+inline int f5682_14(int x) { return x * 14; }
+inline int f5682_15(int x) { return x * 15; }
+inline int f5682_16(int x) { return x * 16; }
+inline int f5682_17(int x) { return x * 17; }
+inline int f5682_18(int x) { return x * 18; }
+inline int f5682_19(int x) { return x * 19; }
+inline int f5682_20(int x) { return x * 20; }
+inline int f5682_21(int x) { return x * 21; }
+inline int f5682_22(int x) { return x * 22; }
+inline int f5682_23(int x) { return x * 23; }
+inline int f5682_24(int x) { return x * 24; }
+inline int f5682_25(int x) { return x * 25; }
+inline int f5682_26(int x) { return x * 26; }
+inline int f5682_27(int x) { return x * 27; }
+inline int f5682_28(int x) { return x * 28; }
+inline int f5682_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5683 */
+#include <vector>
+#include "h8468.h"
+#include "h6843.h"
+#include "h5822.h"
+#include "h2681.h"
+#include "h1761.h"
+#ifdef X
+#include "h7654.h"
+#endif
+struct S5683 { int a; const char *s = "x//y"; };
+inline int f5683_0(int x) { return x * 0; }
+inline int f5683_1(int x) { return x * 1; }
+inline int f5683_2(int x) { return x * 2; }
+inline int f5683_3(int x) { return x * 3; }
+inline int f5683_4(int x) { return x * 4; }
+inline int f5683_5(int x) { return x * 5; }
+inline int f5683_6(int x) { return x * 6; }
+inline int f5683_7(int x) { return x * 7; }
+inline int f5683_8(int x) { return x * 8; }
+inline int f5683_9(int x) { return x * 9; }
+inline int f5683_10(int x) { return x * 10; }
+inline int f5683_11(int x) { return x * 11; }
+inline int f5683_12(int x) { return x * 12; }
+inline int f5683_13(int x) { return x * 13; }
+inline int f5683_14(int x) { return x * 14; }
+inline int f5683_15(int x) { return x * 15; }
+inline int f5683_16(int x) { return x * 16; }
+inline int f5683_17(int x) { return x * 17; }
+inline int f5683_18(int x) { return x * 18; }
+inline int f5683_19(int x) { return x * 19; }
+inline int f5683_20(int x) { return x * 20; }
+inline int f5683_21(int x) { return x * 21; }
+inline int f5683_22(int x) { return x * 22; }
+inline int f5683_23(int x) { return x * 23; }
+inline int f5683_24(int x) { return x * 24; }
+inline int f5683_25(int x) { return x * 25; }
+inline int f5683_26(int x) { return x * 26; }
+inline int f5683_27(int x) { return x * 27; }
+inline int f5683_28(int x) { return x * 28; }
+inline int f5683_29(int x) { return x * 29; }
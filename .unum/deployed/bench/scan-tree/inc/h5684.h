@@ -0,0 +1,42 @@
+#pragma once
+/* header 5684 */
+#include <vector>
+#include "h9451.h"
+#include "h1856.h"
+#include "h5075.h"
+#include "h1307.h"
+#include "h5143.h"
+#ifdef X
+#include "h9228.h"
+#endif
+struct S5684 { int a; const char *s = "x//y"; };
+inline int f5684_0(int x) { return x * 0; }
+inline int f5684_1(int x) { return x * 1; }
+inline int f5684_2(int x) { return x * 2; }
+inline int f5684_3(int x) { return x * 3; }
+inline int f5684_4(int x) { return x * 4; }
+inline int f5684_5(int x) { return x * 5; }
+inline int f5684_6(int x) { return x * 6; }
+inline int f5684_7(int x) { return x * 7; }
+inline int f5684_8(int x) { return x * 8; }
+inline int f5684_9(int x) { return x * 9; }
+inline int f5684_10(int x) { return x * 10; }
+inline int f5684_11(int x) { return x * 11; }
+inline int f5684_12(int x) { return x * 12; }
+inline int f5684_13(int x) { return x * 13; }
+inline int f5684_14(int x) { return x * 14; }
+inline int f5684_15(int x) { return x * 15; }
+inline int f5684_16(int x) { return x * 16; }
+inline int f5684_17(int x) { return x * 17; }
+inline int f5684_18(int x) { return x * 18; }
+inline int f5684_19(int x) { return x * 19; }
+inline int f5684_20(int x) { return x * 20; }
+inline int f5684_21(int x) { return x * 21; }
+inline int f5684_22(int x) { return x * 22; }
+inline int f5684_23(int x) { return x * 23; }
+inline int f5684_24(int x) { return x * 24; }
+inline int f5684_25(int x) { return x * 25; }
+inline int f5684_26(int x) { return x * 26; }
+inline int f5684_27(int x) { return x * 27; }
+inline int f5684_28(int x) { return x * 28; }
+inline int f5684_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5687 */
+#include <vector>
+#include "h9640.h"
+#include "h7743.h"
+#include "h2676.h"
+#include "h9445.h"
+#include "h6947.h"
+#ifdef X
+#include "h4202.h"
+#endif
+struct S5687 { int a; const char *s = "x//y"; };
+inline int f5687_0(int x) { return x * 0; }
+inline int f5687_1(int x) { return x * 1; }
+inline int f5687_2(int x) { return x * 2; }
+inline int f5687_3(int x) { return x * 3; }
+inline int f5687_4(int x) { return x * 4; }
+inline int f5687_5(int x) { return x * 5; }
+inline int f5687_6(int x) { return x * 6; }
+inline int f5687_7(int x) { return x * 7; }
+inline int f5687_8(int x) { return x * 8; }
+inline int f5687_9(int x) { return x * 9; }
+inline int f5687_10(int x) { return x * 10; }
+inline int f5687_11(int x) { return x * 11; }
+inline int f5687_12(int x) { return x * 12; }
+inline int f5687_13(int x) { return x * 13; }
+inline int f5687_14(int x) { return x * 14; }
+inline int f5687_15(int x) { return x * 15; }
+inline int f5687_16(int x) { return x * 16; }
+inline int f5687_17(int x) { return x * 17; }
+inline int f5687_18(int x) { return x * 18; }
+inline int f5687_19(int x) { return x * 19; }
+inline int f5687_20(int x) { return x * 20; }
+inline int f5687_21(int x) { return x * 21; }
+inline int f5687_22(int x) { return x * 22; }
+inline int f5687_23(int x) { return x * 23; }
+inline int f5687_24(int x) { return x * 24; }
+inline int f5687_25(int x) { return x * 25; }
+inline int f5687_26(int x) { return x * 26; }
+inline int f5687_27(int x) { return x * 27; }
+inline int f5687_28(int x) { return x * 28; }
+inline int f5687_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5688 */
+#include <vector>
+#include "h8541.h"
+#include "h3443.h"
+#include "h2470.h"
+#include "h8159.h"
+#include "h6524.h"
+#ifdef X
+#include "h6911.h"
+#endif
+struct S5688 { int a; const char *s = "x//y"; };
+inline int f5688_0(int x) { return x * 0; }
+inline int f5688_1(int x) { return x * 1; }
+inline int f5688_2(int x) { return x * 2; }
+inline int f5688_3(int x) { return x * 3; }
+inline int f5688_4(int x) { return x * 4; }
+inline int f5688_5(int x) { return x * 5; }
+inline int f5688_6(int x) { return x * 6; }
+inline int f5688_7(int x) { return x * 7; }
+inline int f5688_8(int x) { return x * 8; }
+inline int f5688_9(int x) { return x * 9; }
+inline int f5688_10(int x) { return x * 10; }
+inline int f5688_11(int x) { return x * 11; }
+inline int f5688_12(int x) { return x * 12; }
+inline int f5688_13(int x) { return x * 13; }
+inline int f5688_14(int x) { return x * 14; }
+inline int f5688_15(int x) { return x * 15; }
+inline int f5688_16(int x) { return x * 16; }
+inline int f5688_17(int x) { return x * 17; }
+inline int f5688_18(int x) { return x * 18; }
+inline int f5688_19(int x) { return x * 19; }
+inline int f5688_20(int x) { return x * 20; }
+inline int f5688_21(int x) { return x * 21; }
+inline int f5688_22(int x) { return x * 22; }
+inline int f5688_23(int x) { return x * 23; }
+inline int f5688_24(int x) { return x * 24; }
+inline int f5688_25(int x) { return x * 25; }
+inline int f5688_26(int x) { return x * 26; }
+inline int f5688_27(int x) { return x * 27; }
+inline int f5688_28(int x) { return x * 28; }
+inline int f5688_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 569 */
+#include <vector>
+#include "h8445.h"
+#include "h2358.h"
+#include "h8967.h"
+#include "h8718.h"
+#include "h2582.h"
+#ifdef X
+#include "h2750.h"
+#endif
+struct S569 { int a; const char *s = "x//y"; };
+inline int f569_0(int x) { return x * 0; }
+inline int f569_1(int x) { return x * 1; }
+inline int f569_2(int x) { return x * 2; }
+inline int f569_3(int x) { return x * 3; }
+inline int f569_4(int x) { return x * 4; }
+inline int f569_5(int x) { return x * 5; }
+inline int f569_6(int x) { return x * 6; }
+inline int f569_7(int x) { return x * 7; }
+inline int f569_8(int x) { return x * 8; }
+inline int f569_9(int x) { return x * 9; }
+inline int f569_10(int x) { return x * 10; }
+inline int f569_11(int x) { return x * 11; }
+inline int f569_12(int x) { return x * 12; }
+inline int f569_13(int x) { return x * 13; }
+inline int f569_14(int x) { return x * 14; }
+inline int f569_15(int x) { return x * 15; }
+inline int f569_16(int x) { return x * 16; }
+inline int f569_17(int x) { return x * 17; }
+inline int f569_18(int x) { return x * 18; }
+inline int f569_19(int x) { return x * 19; }
+inline int f569_20(int x) { return x * 20; }
+inline int f569_21(int x) { return x * 21; }
+inline int f569_22(int x) { return x * 22; }
+inline int f569_23(int x) { return x * 23; }
+inline int f569_24(int x) { return x * 24; }
+inline int f569_25(int x) { return x * 25; }
+inline int f569_26(int x) { return x * 26; }
+inline int f569_27(int x) { return x * 27; }
+inline int f569_28(int x) { return x * 28; }
+inline int f569_29(int x) { return x * 29; }
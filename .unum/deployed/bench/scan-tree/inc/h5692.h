@@ -0,0 +1,42 @@
+#pragma once
+/* header 5692 */
+#include <vector>
+#include "h2201.h"
+#include "h1518.h"
+#include "h5584.h"
+#include "h93.h"
+#include "h5946.h"
+#ifdef X
+#include "h6135.h"
+#endif
+struct S5692 { int a; const char *s = "x//y"; };
+inline int f5692_0(int x) { return x * 0; }
+inline int f5692_1(int x) { return x * 1; }
+inline int f5692_2(int x) { return x * 2; }
+inline int f5692_3(int x) { return x * 3; }
+inline int f5692_4(int x) { return x * 4; }
+inline int f5692_5(int x) { return x * 5; }
+inline int f5692_6(int x) { return x * 6; }
+inline int f5692_7(int x) { return x * 7; }
+inline int f5692_8(int x) { return x * 8; }
+inline int f5692_9(int x) { return x * 9; }
+inline int f5692_10(int x) { return x * 10; }
+inline int f5692_11(int x) { return x * 11; }
+inline int f5692_12(int x) { return x * 12; }
+inline int f5692_13(int x) { return x * 13; }
+inline int f5692_14(int x) { return x * 14; }
+inline int f5692_15(int x) { return x * 15; }
+inline int f5692_16(int x) { return x * 16; }
+inline int f5692_17(int x) { return x * 17; }
+inline int f5692_18(int x) { return x * 18; }
+inline int f5692_19(int x) { return x * 19; }
+inline int f5692_20(int x) { return x * 20; }
+inline int f5692_21(int x) { return x * 21; }
+inline int f5692_22(int x) { return x * 22; }
+inline int f5692_23(int x) { return x * 23; }
+inline int f5692_24(int x) { return x * 24; }
+inline int f5692_25(int x) { return x * 25; }
+inline int f5692_26(int x) { return x * 26; }
+inline int f5692_27(int x) { return x * 27; }
+inline int f5692_28(int x) { return x * 28; }
+inline int f5692_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5694 */
+#include <vector>
+#include "h4083.h"
+#include "h9411.h"
+#include "h3617.h"
+#include "h5167.h"
+#include "h2882.h"
+#ifdef X
+#include "h9273.h"
+#endif
+struct S5694 { int a; const char *s = "x//y"; };
+inline int f5694_0(int x) { return x * 0; }
+inline int f5694_1(int x) { return x * 1; }
+inline int f5694_2(int x) { return x * 2; }
+inline int f5694_3(int x) { return x * 3; }
+inline int f5694_4(int x) { return x * 4; }
+inline int f5694_5(int x) { return x * 5; }
+inline int f5694_6(int x) { return x * 6; }
+inline int f5694_7(int x) { return x * 7; }
+inline int f5694_8(int x) { return x * 8; }
+inline int f5694_9(int x) { return x * 9; }
+inline int f5694_10(int x) { return x * 10; }
+inline int f5694_11(int x) { return x * 11; }
+inline int f5694_12(int x) { return x * 12; }
+inline int f5694_13(int x) { return x * 13; }
+inline int f5694_14(int x) { return x * 14; }
+inline int f5694_15(int x) { return x * 15; }
+inline int f5694_16(int x) { return x * 16; }
+inline int f5694_17(int x) { return x * 17; }
+inline int f5694_18(int x) { return x * 18; }
+inline int f5694_19(int x) { return x * 19; }
+inline int f5694_20(int x) { return x * 20; }
+inline int f5694_21(int x) { return x * 21; }
+inline int f5694_22(int x) { return x * 22; }
+inline int f5694_23(int x) { return x * 23; }
+inline int f5694_24(int x) { return x * 24; }
+inline int f5694_25(int x) { return x * 25; }
+inline int f5694_26(int x) { return x * 26; }
+inline int f5694_27(int x) { return x * 27; }
+inline int f5694_28(int x) { return x * 28; }
+inline int f5694_29(int x) { return x * 29; }
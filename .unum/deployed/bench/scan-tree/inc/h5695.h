@@ -0,0 +1,42 @@
+#pragma once
+/* header 5695 */
+#include <vector>
+#include "h5925.h"
+#include "h6377.h"
+#include "h5055.h"
+#include "h2190.h"
+#include "h9088.h"
+#ifdef X
+#include "h7853.h"
+#endif
+struct S5695 { int a; const char *s = "x//y"; };
+inline int f5695_0(int x) { return x * 0; }
+inline int f5695_1(int x) { return x * 1; }
+inline int f5695_2(int x) { return x * 2; }
+inline int f5695_3(int x) { return x * 3; }
+inline int f5695_4(int x) { return x * 4; }
+inline int f5695_5(int x) { return x * 5; }
+inline int f5695_6(int x) { return x * 6; }
+inline int f5695_7(int x) { return x * 7; }
+inline int f5695_8(int x) { return x * 8; }
+inline int f5695_9(int x) { return x * 9; }
+inline int f5695_10(int x) { return x * 10; }
+inline int f5695_11(int x) { return x * 11; }
+inline int f5695_12(int x) { return x * 12; }
+inline int f5695_13(int x) { return x * 13; }
+inline int f5695_14(int x) { return x * 14; }
+inline int f5695_15(int x) { return x * 15; }
+inline int f5695_16(int x) { return x * 16; }
+inline int f5695_17(int x) { return x * 17; }
+inline int f5695_18(int x) { return x * 18; }
+inline int f5695_19(int x) { return x * 19; }
+inline int f5695_20(int x) { return x * 20; }
+inline int f5695_21(int x) { return x * 21; }
+inline int f5695_22(int x) { return x * 22; }
+inline int f5695_23(int x) { return x * 23; }
+inline int f5695_24(int x) { return x * 24; }
+inline int f5695_25(int x) { return x * 25; }
+inline int f5695_26(int x) { return x * 26; }
+inline int f5695_27(int x) { return x * 27; }
+inline int f5695_28(int x) { return x * 28; }
+inline int f5695_29(int x) { return x * 29; }
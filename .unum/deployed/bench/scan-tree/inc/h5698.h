@@ -0,0 +1,42 @@
+#pragma once
+/* header 5698 */
+#include <vector>
+#include "h8384.h"
+#include "h4491.h"
+#include "h967.h"
+#include "h6905.h"
+#include "h7480.h"
+#ifdef X
+#include "h2221.h"
+#endif
+struct S5698 { int a; const char *s = "x//y"; };
+inline int f5698_0(int x) { return x * 0; }
+inline int f5698_1(int x) { return x * 1; }
+inline int f5698_2(int x) { return x * 2; }
+inline int f5698_3(int x) { return x * 3; }
+inline int f5698_4(int x) { return x * 4; }
+inline int f5698_5(int x) { return x * 5; }
+inline int f5698_6(int x) { return x * 6; }
+inline int f5698_7(int x) { return x * 7; }
+inline int f5698_8(int x) { return x * 8; }
+inline int f5698_9(int x) { return x * 9; }
+inline int f5698_10(int x) { return x * 10; }
+inline int f5698_11(int x) { return x * 11; }
+inline int f5698_12(int x) { return x * 12; }
+inline int f5698_13(int x) { return x * 13; }
+inline int f5698_14(int x) { return x * 14; }
+inline int f5698_15(int x) { return x * 15; }
+inline int f5698_16(int x) { return x * 16; }
+inline int f5698_17(int x) { return x * 17; }
+inline int f5698_18(int x) { return x * 18; }
+inline int f5698_19(int x) { return x * 19; }
+inline int f5698_20(int x) { return x * 20; }
+inline int f5698_21(int x) { return x * 21; }
+inline int f5698_22(int x) { return x * 22; }
+inline int f5698_23(int x) { return x * 23; }
+inline int f5698_24(int x) { return x * 24; }
+inline int f5698_25(int x) { return x * 25; }
+inline int f5698_26(int x) { return x * 26; }
+inline int f5698_27(int x) { return x * 27; }
+inline int f5698_28(int x) { return x * 28; }
+inline int f5698_29(int x) { return x * 29; }
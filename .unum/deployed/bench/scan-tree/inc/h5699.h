@@ -0,0 +1,42 @@
+#pragma once
+/* header 5699 */
+#include <vector>
+#include "h2523.h"
+#include "h6848.h"
+#include "h8756.h"
+#include "h6735.h"
+#include "h4426.h"
+#ifdef X
+#include "h8951.h"
+#endif
+struct S5699 { int a; const char *s = "x//y"; };
+inline int f5699_0(int x) { return x * 0; }
+inline int f5699_1(int x) { return x * 1; }
+inline int f5699_2(int x) { return x * 2; }
+inline int f5699_3(int x) { return x * 3; }
+inline int f5699_4(int x) { return x * 4; }
+inline int f5699_5(int x) { return x * 5; }
+inline int f5699_6(int x) { return x * 6; }
+inline int f5699_7(int x) { return x * 7; }
+inline int f5699_8(int x) { return x * 8; }
+inline int f5699_9(int x) { return x * 9; }
+inline int f5699_10(int x) { return x * 10; }
+inline int f5699_11(int x) { return x * 11; }
+inline int f5699_12(int x) { return x * 12; }
+inline int f5699_13(int x) { return x * 13; }
+inline int f5699_14(int x) { return x * 14; }
+inline int f5699_15(int x) { return x * 15; }
+inline int f5699_16(int x) { return x * 16; }
+inline int f5699_17(int x) { return x * 17; }
+inline int f5699_18(int x) { return x * 18; }
+inline int f5699_19(int x) { return x * 19; }
+inline int f5699_20(int x) { return x * 20; }
+inline int f5699_21(int x) { return x * 21; }
+inline int f5699_22(int x) { return x * 22; }
+inline int f5699_23(int x) { return x * 23; }
+inline int f5699_24(int x) { return x * 24; }
+inline int f5699_25(int x) { return x * 25; }
+inline int f5699_26(int x) { return x * 26; }
+inline int f5699_27(int x) { return x * 27; }
+inline int f5699_28(int x) { return x * 28; }
+inline int f5699_29(int x) { return x * 29; }
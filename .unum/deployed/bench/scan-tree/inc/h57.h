@@ -0,0 +1,42 @@
+#pragma once
+/* header 57 */
+#include <vector>
+#include "h4489.h"
+#include "h2878.h"
+#include "h1008.h"
+#include "h5246.h"
+#include "h3940.h"
+#ifdef X
+#include "h2965.h"
+#endif
+struct S57 { int a; const char *s = "x//y"; };
+inline int f57_0(int x) { return x * 0; }
+inline int f57_1(int x) { return x * 1; }
+inline int f57_2(int x) { return x * 2; }
+inline int f57_3(int x) { return x * 3; }
+inline int f57_4(int x) { return x * 4; }
+inline int f57_5(int x) { return x * 5; }
+inline int f57_6(int x) { return x * 6; }
+inline int f57_7(int x) { return x * 7; }
+inline int f57_8(int x) { return x * 8; }
+inline int f57_9(int x) { return x * 9; }
+inline int f57_10(int x) { return x * 10; }
+inline int f57_11(int x) { return x * 11; }
+inline int f57_12(int x) { return x * 12; }
+inline int f57_13(int x) { return x * 13; }
+inline int f57_14(int x) { return x * 14; }
+inline int f57_15(int x) { return x * 15; }
+inline int f57_16(int x) { return x * 16; }
+inline int f57_17(int x) { return x * 17; }
+inline int f57_18(int x) { return x * 18; }
+inline int f57_19(int x) { return x * 19; }
+inline int f57_20(int x) { return x * 20; }
+inline int f57_21(int x) { return x * 21; }
+inline int f57_22(int x) { return x * 22; }
+inline int f57_23(int x) { return x * 23; }
+inline int f57_24(int x) { return x * 24; }
+inline int f57_25(int x) { return x * 25; }
+inline int f57_26(int x) { return x * 26; }
+inline int f57_27(int x) { return x * 27; }
+inline int f57_28(int x) { return x * 28; }
+inline int f57_29(int x) { return x * 29; }
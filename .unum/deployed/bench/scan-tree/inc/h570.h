@@ -0,0 +1,42 @@
+#pragma once
+/* header 570 */
+#include <vector>
+#include "h2533.h"
+#include "h2313.h"
+#include "h6424.h"
+#include "h8474.h"
+#include "h6772.h"
+#ifdef X
+#include "h5970.h"
+#endif
+struct S570 { int a; const char *s = "x//y"; };
+inline int f570_0(int x) { return x * 0; }
+inline int f570_1(int x) { return x * 1; }
+inline int f570_2(int x) { return x * 2; }
+inline int f570_3(int x) { return x * 3; }
+inline int f570_4(int x) { return x * 4; }
+inline int f570_5(int x) { return x * 5; }
+inline int f570_6(int x) { return x * 6; }
+inline int f570_7(int x) { return x * 7; }
+inline int f570_8(int x) { return x * 8; }
+inline int f570_9(int x) { return x * 9; }
+inline int f570_10(int x) { return x * 10; }
+inline int f570_11(int x) { return x * 11; }
+inline int f570_12(int x) { return x * 12; }
+inline int f570_13(int x) { return x * 13; }
+inline int f570_14(int x) { return x * 14; }
+inline int f570_15(int x) { return x * 15; }
+inline int f570_16(int x) { return x * 16; }
+inline int f570_17(int x) { return x * 17; }
+inline int f570_18(int x) { return x * 18; }
+inline int f570_19(int x) { return x * 19; }
+inline int f570_20(int x) { return x * 20; }
+inline int f570_21(int x) { return x * 21; }
+inline int f570_22(int x) { return x * 22; }
+inline int f570_23(int x) { return x * 23; }
+inline int f570_24(int x) { return x * 24; }
+inline int f570_25(int x) { return x * 25; }
+inline int f570_26(int x) { return x * 26; }
+inline int f570_27(int x) { return x * 27; }
+inline int f570_28(int x) { return x * 28; }
+inline int f570_29(int x) { return x * 29; }
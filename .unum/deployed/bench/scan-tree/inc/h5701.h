@@ -0,0 +1,42 @@
+#pragma once
+/* header 5701 */
+#include <vector>
+#include "h2986.h"
+#include "h4700.h"
+#include "h1296.h"
+#include "h2819.h"
+#include "h8879.h"
+#ifdef X
+#include "h3141.h"
+#endif
+struct S5701 { int a; const char *s = "x//y"; };
+inline int f5701_0(int x) { return x * 0; }
+inline int f5701_1(int x) { return x * 1; }
+inline int f5701_2(int x) { return x * 2; }
+inline int f5701_3(int x) { return x * 3; }
+inline int f5701_4(int x) { return x * 4; }
+inline int f5701_5(int x) { return x * 5; }
+inline int f5701_6(int x) { return x * 6; }
+inline int f5701_7(int x) { return x * 7; }
+inline int f5701_8(int x) { return x * 8; }
+inline int f5701_9(int x) { return x * 9; }
+inline int f5701_10(int x) { return x * 10; }
+inline int f5701_11(int x) { return x * 11; }
+inline int f5701_12(int x) { return x * 12; }
+inline int f5701_13(int x) { return x * 13; }
+inline int f5701_14(int x) { return x * 14; }
+inline int f5701_15(int x) { return x * 15; }
+inline int f5701_16(int x) { return x * 16; }
+inline int f5701_17(int x) { return x * 17; }
+inline int f5701_18(int x) { return x * 18; }
+inline int f5701_19(int x) { return x * 19; }
+inline int f5701_20(int x) { return x * 20; }
+inline int f5701_21(int x) { return x * 21; }
+inline int f5701_22(int x) { return x * 22; }
+inline int f5701_23(int x) { return x * 23; }
+inline int f5701_24(int x) { return x * 24; }
+inline int f5701_25(int x) { return x * 25; }
+inline int f5701_26(int x) { return x * 26; }
+inline int f5701_27(int x) { return x * 27; }
+inline int f5701_28(int x) { return x * 28; }
+inline int f5701_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5702 */
+#include <vector>
+#include "h5350.h"
+#include "h4083.h"
+#include "h1574.h"
+#include "h1180.h"
+#include "h798.h"
+#ifdef X
+#include "h9977.h"
+#endif
+struct S5702 { int a; const char *s = "x//y"; };
+inline int f5702_0(int x) { return x * 0; }
+inline int f5702_1(int x) { return x * 1; }
+inline int f5702_2(int x) { return x * 2; }
+inline int f5702_3(int x) { return x * 3; }
+inline int f5702_4(int x) { return x * 4; }
+inline int f5702_5(int x) { return x * 5; }
+inline int f5702_6(int x) { return x * 6; }
+inline int f5702_7(int x) { return x * 7; }
+inline int f5702_8(int x) { return x * 8; }
+inline int f5702_9(int x) { return x * 9; }
+inline int f5702_10(int x) { return x * 10; }
+inline int f5702_11(int x) { return x * 11; }
+inline int f5702_12(int x) { return x * 12; }
+inline int f5702_13(int x) { return x * 13; }
+inline int f5702_14(int x) { return x * 14; }
+inline int f5702_15(int x) { return x * 15; }
+inline int f5702_16(int x) { return x * 16; }
+inline int f5702_17(int x) { return x * 17; }
+inline int f5702_18(int x) { return x * 18; }
+inline int f5702_19(int x) { return x * 19; }
+inline int f5702_20(int x) { return x * 20; }
+inline int f5702_21(int x) { return x * 21; }
+inline int f5702_22(int x) { return x * 22; }
+inline int f5702_23(int x) { return x * 23; }
+inline int f5702_24(int x) { return x * 24; }
+inline int f5702_25(int x) { return x * 25; }
+inline int f5702_26(int x) { return x * 26; }
+inline int f5702_27(int x) { return x * 27; }
+inline int f5702_28(int x) { return x * 28; }
+inline int f5702_29(int x) { return x * 29; }
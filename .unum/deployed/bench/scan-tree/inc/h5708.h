@@ -0,0 +1,42 @@
+#pragma once
+/* header 5708 */
+#include <vector>
+#include "h4279.h"
+#include "h6809.h"
+#include "h7229.h"
+#include "h3916.h"
+#include "h5648.h"
+#ifdef X
+#include "h6425.h"
+#endif
+struct S5708 { int a; const char *s = "x//y"; };
+inline int f5708_0(int x) { return x * 0; }
+inline int f5708_1(int x) { return x * 1; }
+inline int f5708_2(int x) { return x * 2; }
+inline int f5708_3(int x) { return x * 3; }
+inline int f5708_4(int x) { return x * 4; }
+inline int f5708_5(int x) { return x * 5; }
+inline int f5708_6(int x) { return x * 6; }
+inline int f5708_7(int x) { return x * 7; }
+inline int f5708_8(int x) { return x * 8; }
+inline int f5708_9(int x) { return x * 9; }
+inline int f5708_10(int x) { return x * 10; }
+inline int f5708_11(int x) { return x * 11; }
+inline int f5708_12(int x) { return x * 12; }
+inline int f5708_13(int x) { return x * 13; }
+inline int f5708_14(int x) { return x * 14; }
+inline int f5708_15(int x) { return x * 15; }
+inline int f5708_16(int x) { return x * 16; }
+inline int f5708_17(int x) { return x * 17; }
+inline int f5708_18(int x) { return x * 18; }
+inline int f5708_19(int x) { return x * 19; }
+inline int f5708_20(int x) { return x * 20; }
+inline int f5708_21(int x) { return x * 21; }
+inline int f5708_22(int x) { return x * 22; }
+inline int f5708_23(int x) { return x * 23; }
+inline int f5708_24(int x) { return x * 24; }
+inline int f5708_25(int x) { return x * 25; }
+inline int f5708_26(int x) { return x * 26; }
+inline int f5708_27(int x) { return x * 27; }
+inline int f5708_28(int x) { return x * 28; }
+inline int f5708_29(int x) { return x * 29; }
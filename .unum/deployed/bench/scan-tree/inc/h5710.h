@@ -0,0 +1,42 @@
+#pragma once
+/* header 5710 */
+#include <vector>
+#include "h751.h"
+#include "h2786.h"
+#include "h5443.h"
+#include "h6075.h"
+#include "h3058.h"
+#ifdef X
+#include "h5519.h"
+#endif
+struct S5710 { int a; const char *s = "x//y"; };
+inline int f5710_0(int x) { return x * 0; }
+inline int f5710_1(int x) { return x * 1; }
+inline int f5710_2(int x) { return x * 2; }
+inline int f5710_3(int x) { return x * 3; }
+inline int f5710_4(int x) { return x * 4; }
+inline int f5710_5(int x) { return x * 5; }
+inline int f5710_6(int x) { return x * 6; }
+inline int f5710_7(int x) { return x * 7; }
+inline int f5710_8(int x) { return x * 8; }
+inline int f5710_9(int x) { return x * 9; }
+inline int f5710_10(int x) { return x * 10; }
+inline int f5710_11(int x) { return x * 11; }
+inline int f5710_12(int x) { return x * 12; }
+inline int f5710_13(int x) { return x * 13; }
+inline int f5710_14(int x) { return x * 14; }
+inline int f5710_15(int x) { return x * 15; }
+inline int f5710_16(int x) { return x * 16; }
+inline int f5710_17(int x) { return x * 17; }
+inline int f5710_18(int x) { return x * 18; }
+inline int f5710_19(int x) { return x * 19; }
+inline int f5710_20(int x) { return x * 20; }
+inline int f5710_21(int x) { return x * 21; }
+inline int f5710_22(int x) { return x * 22; }
+inline int f5710_23(int x) { return x * 23; }
+inline int f5710_24(int x) { return x * 24; }
+inline int f5710_25(int x) { return x * 25; }
+inline int f5710_26(int x) { return x * 26; }
+inline int f5710_27(int x) { return x * 27; }
+inline int f5710_28(int x) { return x * 28; }
+inline int f5710_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5712 */
+#include <vector>
+#include "h2441.h"
+#include "h5912.h"
+#include "h9739.h"
+#include "h698.h"
+#include "h2601.h"
+#ifdef X
+#include "h3073.h"
+#endif
+struct S5712 { int a; const char *s = "x//y"; };
+inline int f5712_0(int x) { return x * 0; }
+inline int f5712_1(int x) { return x * 1; }
+inline int f5712_2(int x) { return x * 2; }
+inline int f5712_3(int x) { return x * 3; }
+inline int f5712_4(int x) { return x * 4; }
+inline int f5712_5(int x) { return x * 5; }
+inline int f5712_6(int x) { return x * 6; }
+inline int f5712_7(int x) { return x * 7; }
+inline int f5712_8(int x) { return x * 8; }
+inline int f5712_9(int x) { return x * 9; }
+inline int f5712_10(int x) { return x * 10; }
+inline int f5712_11(int x) { return x * 11; }
+inline int f5712_12(int x) { return x * 12; }
+inline int f5712_13(int x) { return x * 13; }
+inline int f5712_14(int x) { return x * 14; }
+inline int f5712_15(int x) { return x * 15; }
+inline int f5712_16(int x) { return x * 16; }
+inline int f5712_17(int x) { return x * 17; }
+inline int f5712_18(int x) { return x * 18; }
+inline int f5712_19(int x) { return x * 19; }
+inline int f5712_20(int x) { return x * 20; }
+inline int f5712_21(int x) { return x * 21; }
+inline int f5712_22(int x) { return x * 22; }
+inline int f5712_23(int x) { return x * 23; }
+inline int f5712_24(int x) { return x * 24; }
+inline int f5712_25(int x) { return x * 25; }
+inline int f5712_26(int x) { return x * 26; }
+inline int f5712_27(int x) { return x * 27; }
+inline int f5712_28(int x) { return x * 28; }
+inline int f5712_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5714 */
+#include <vector>
+#include "h1624.h"
+#include "h7028.h"
+#include "h7620.h"
+#include "h4922.h"
+#include "h4114.h"
+#ifdef X
+#include "h8600.h"
+#endif
+struct S5714 { int a; const char *s = "x//y"; };
+inline int f5714_0(int x) { return x * 0; }
+inline int f5714_1(int x) { return x * 1; }
+inline int f5714_2(int x) { return x * 2; }
+inline int f5714_3(int x) { return x * 3; }
+inline int f5714_4(int x) { return x * 4; }
+inline int f5714_5(int x) { return x * 5; }
+inline int f5714_6(int x) { return x * 6; }
+inline int f5714_7(int x) { return x * 7; }
+inline int f5714_8(int x) { return x * 8; }
+inline int f5714_9(int x) { return x * 9; }
+inline int f5714_10(int x) { return x * 10; }
+inline int f5714_11(int x) { return x * 11; }
+inline int f5714_12(int x) { return x * 12; }
+inline int f5714_13(int x) { return x * 13; }
+inline int f5714_14(int x) { return x * 14; }
+inline int f5714_15(int x) { return x * 15; }
+inline int f5714_16(int x) { return x * 16; }
+inline int f5714_17(int x) { return x * 17; }
+inline int f5714_18(int x) { return x * 18; }
+inline int f5714_19(int x) { return x * 19; }
+inline int f5714_20(int x) { return x * 20; }
+inline int f5714_21(int x) { return x * 21; }
+inline int f5714_22(int x) { return x * 22; }
+inline int f5714_23(int x) { return x * 23; }
+inline int f5714_24(int x) { return x * 24; }
+inline int f5714_25(int x) { return x * 25; }
+inline int f5714_26(int x) { return x * 26; }
+inline int f5714_27(int x) { return x * 27; }
+inline int f5714_28(int x) { return x * 28; }
+inline int f5714_29(int x) { return x * 29; }
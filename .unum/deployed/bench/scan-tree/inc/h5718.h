@@ -0,0 +1,42 @@
+#pragma once
+/* header 5718 */
+#include <vector>
+#include "h9464.h"
+#include "h8877.h"
+#include "h9218.h"
+#include "h5000.h"
+#include "h5719.h"
+#ifdef X
+#include "h4048.h"
+#endif
+struct S5718 { int a; const char *s = "x//y"; };
+inline int f5718_0(int x) { return x * 0; }
+inline int f5718_1(int x) { return x * 1; }
+inline int f5718_2(int x) { return x * 2; }
+inline int f5718_3(int x) { return x * 3; }
+inline int f5718_4(int x) { return x * 4; }
+inline int f5718_5(int x) { return x * 5; }
+inline int f5718_6(int x) { return x * 6; }
+inline int f5718_7(int x) { return x * 7; }
+inline int f5718_8(int x) { return x * 8; }
+inline int f5718_9(int x) { return x * 9; }
+inline int f5718_10(int x) { return x * 10; }
+inline int f5718_11(int x) { return x * 11; }
+inline int f5718_12(int x) { return x * 12; }
+inline int f5718_13(int x) { return x * 13; }
+inline int f5718_14(int x) { return x * 14; }
+inline int f5718_15(int x) { return x * 15; }
+inline int f5718_16(int x) { return x * 16; }
+inline int f5718_17(int x) { return x * 17; }
+inline int f5718_18(int x) { return x * 18; }
+inline int f5718_19(int x) { return x * 19; }
+inline int f5718_20(int x) { return x * 20; }
+inline int f5718_21(int x) { return x * 21; }
+inline int f5718_22(int x) { return x * 22; }
+inline int f5718_23(int x) { return x * 23; }
+inline int f5718_24(int x) { return x * 24; }
+inline int f5718_25(int x) { return x * 25; }
+inline int f5718_26(int x) { return x * 26; }
+inline int f5718_27(int x) { return x * 27; }
+inline int f5718_28(int x) { return x * 28; }
+inline int f5718_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5723 */
+#include <vector>
+#include "h3022.h"
+#include "h4526.h"
+#include "h1174.h"
+#include "h1979.h"
+#include "h9520.h"
+#ifdef X
+#include "h8529.h"
+#endif
+struct S5723 { int a; const char *s = "x//y"; };
+inline int f5723_0(int x) { return x * 0; }
+inline int f5723_1(int x) { return x * 1; }
+inline int f5723_2(int x) { return x * 2; }
+inline int f5723_3(int x) { return x * 3; }
+inline int f5723_4(int x) { return x * 4; }
+inline int f5723_5(int x) { return x * 5; }
+inline int f5723_6(int x) { return x * 6; }
+inline int f5723_7(int x) { return x * 7; }
+inline int f5723_8(int x) { return x * 8; }
+inline int f5723_9(int x) { return x * 9; }
+inline int f5723_10(int x) { return x * 10; }
+inline int f5723_11(int x) { return x * 11; }
+inline int f5723_12(int x) { return x * 12; }
+inline int f5723_13(int x) { return x * 13; }
+inline int f5723_14(int x) { return x * 14; }
+inline int f5723_15(int x) { return x * 15; }
+inline int f5723_16(int x) { return x * 16; }
+inline int f5723_17(int x) { return x * 17; }
+inline int f5723_18(int x) { return x * 18; }
+inline int f5723_19(int x) { return x * 19; }
+inline int f5723_20(int x) { return x * 20; }
+inline int f5723_21(int x) { return x * 21; }
+inline int f5723_22(int x) { return x * 22; }
+inline int f5723_23(int x) { return x * 23; }
+inline int f5723_24(int x) { return x * 24; }
+inline int f5723_25(int x) { return x * 25; }
+inline int f5723_26(int x) { return x * 26; }
+inline int f5723_27(int x) { return x * 27; }
+inline int f5723_28(int x) { return x * 28; }
+inline int f5723_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5725 */
+#include <vector>
+#include "h1399.h"
+#include "h6738.h"
+#include "h9542.h"
+#include "h244.h"
+#include "h5180.h"
+#ifdef X
+#include "h255.h"
+#endif
+struct S5725 { int a; const char *s = "x//y"; };
+inline int f5725_0(int x) { return x * 0; }
+inline int f5725_1(int x) { return x * 1; }
+inline int f5725_2(int x) { return x * 2; }
+inline int f5725_3(int x) { return x * 3; }
+inline int f5725_4(int x) { return x * 4; }
+inline int f5725_5(int x) { return x * 5; }
+inline int f5725_6(int x) { return x * 6; }
+inline int f5725_7(int x) { return x * 7; }
+inline int f5725_8(int x) { return x * 8; }
+inline int f5725_9(int x) { return x * 9; }
+inline int f5725_10(int x) { return x * 10; }
+inline int f5725_11(int x) { return x * 11; }
+inline int f5725_12(int x) { return x * 12; }
+inline int f5725_13(int x) { return x * 13; }
+inline int f5725_14(int x) { return x * 14; }
+inline int f5725_15(int x) { return x * 15; }
+inline int f5725_16(int x) { return x * 16; }
+inline int f5725_17(int x) { return x * 17; }
+inline int f5725_18(int x) { return x * 18; }
+inline int f5725_19(int x) { return x * 19; }
+inline int f5725_20(int x) { return x * 20; }
+inline int f5725_21(int x) { return x * 21; }
+inline int f5725_22(int x) { return x * 22; }
+inline int f5725_23(int x) { return x * 23; }
+inline int f5725_24(int x) { return x * 24; }
+inline int f5725_25(int x) { return x * 25; }
+inline int f5725_26(int x) { return x * 26; }
+inline int f5725_27(int x) { return x * 27; }
+inline int f5725_28(int x) { return x * 28; }
+inline int f5725_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5727 */
+#include <vector>
+#include "h7886.h"
+#include "h4087.h"
+#include "h2127.h"
+#include "h4145.h"
+#include "h6897.h"
+#ifdef X
+#include "h962.h"
+#endif
+struct S5727 { int a; const char *s = "x//y"; };
+inline int f5727_0(int x) { return x * 0; }
+inline int f5727_1(int x) { return x * 1; }
+inline int f5727_2(int x) { return x * 2; }
+inline int f5727_3(int x) { return x * 3; }
+inline int f5727_4(int x) { return x * 4; }
+inline int f5727_5(int x) { return x * 5; }
+inline int f5727_6(int x) { return x * 6; }
+inline int f5727_7(int x) { return x * 7; }
+inline int f5727_8(int x) { return x * 8; }
+inline int f5727_9(int x) { return x * 9; }
+inline int f5727_10(int x) { return x * 10; }
+inline int f5727_11(int x) { return x * 11; }
+inline int f5727_12(int x) { return x * 12; }
+inline int f5727_13(int x) { return x * 13; }
+inline int f5727_14(int x) { return x * 14; }
+inline int f5727_15(int x) { return x * 15; }
+inline int f5727_16(int x) { return x * 16; }
+inline int f5727_17(int x) { return x * 17; }
+inline int f5727_18(int x) { return x * 18; }
+inline int f5727_19(int x) { return x * 19; }
+inline int f5727_20(int x) { return x * 20; }
+inline int f5727_21(int x) { return x * 21; }
+inline int f5727_22(int x) { return x * 22; }
+inline int f5727_23(int x) { return x * 23; }
+inline int f5727_24(int x) { return x * 24; }
+inline int f5727_25(int x) { return x * 25; }
+inline int f5727_26(int x) { return x * 26; }
+inline int f5727_27(int x) { return x * 27; }
+inline int f5727_28(int x) { return x * 28; }
+inline int f5727_29(int x) { return x * 29; }
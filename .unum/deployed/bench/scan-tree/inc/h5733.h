@@ -0,0 +1,42 @@
+#pragma once
+/* header 5733 */
+#include <vector>
+#include "h2743.h"
+#include "h7298.h"
+#include "h9393.h"
+#include "h2822.h"
+#include "h8021.h"
+#ifdef X
+#include "h874.h"
+#endif
+struct S5733 { int a; const char *s = "x//y"; };
+inline int f5733_0(int x) { return x * 0; }
+inline int f5733_1(int x) { return x * 1; }
+inline int f5733_2(int x) { return x * 2; }
+inline int f5733_3(int x) { return x * 3; }
+inline int f5733_4(int x) { return x * 4; }
+inline int f5733_5(int x) { return x * 5; }
+inline int f5733_6(int x) { return x * 6; }
+inline int f5733_7(int x) { return x * 7; }
+inline int f5733_8(int x) { return x * 8; }
+inline int f5733_9(int x) { return x * 9; }
+inline int f5733_10(int x) { return x * 10; }
+inline int f5733_11(int x) { return x * 11; }
+inline int f5733_12(int x) { return x * 12; }
+inline int f5733_13(int x) { return x * 13; }
+inline int f5733_14(int x) { return x * 14; }
+inline int f5733_15(int x) { return x * 15; }
+inline int f5733_16(int x) { return x * 16; }
+inline int f5733_17(int x) { return x * 17; }
+inline int f5733_18(int x) { return x * 18; }
+inline int f5733_19(int x) { return x * 19; }
+inline int f5733_20(int x) { return x * 20; }
+inline int f5733_21(int x) { return x * 21; }
+inline int f5733_22(int x) { return x * 22; }
+inline int f5733_23(int x) { return x * 23; }
+inline int f5733_24(int x) { return x * 24; }
+inline int f5733_25(int x) { return x * 25; }
+inline int f5733_26(int x) { return x * 26; }
+inline int f5733_27(int x) { return x * 27; }
+inline int f5733_28(int x) { return x * 28; }
+inline int f5733_29(int x) { return x * 29; }
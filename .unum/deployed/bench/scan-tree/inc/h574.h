@@ -0,0 +1,42 @@
+#pragma once
+/* header 574 */
+#include <vector>
+#include "h1261.h"
+#include "h9877.h"
+#include "h2196.h"
+#include "h6485.h"
+#include "h3998.h"
+#ifdef X
+#include "h6717.h"
+#endif
+struct S574 { int a; const char *s = "x//y"; };
+inline int f574_0(int x) { return x * 0; }
+inline int f574_1(int x) { return x * 1; }
+inline int f574_2(int x) { return x * 2; }
+inline int f574_3(int x) { return x * 3; }
+inline int f574_4(int x) { return x * 4; }
+inline int f574_5(int x) { return x * 5; }
+inline int f574_6(int x) { return x * 6; }
+inline int f574_7(int x) { return x * 7; }
+inline int f574_8(int x) { return x * 8; }
+inline int f574_9(int x) { return x * 9; }
+inline int f574_10(int x) { return x * 10; }
+inline int f574_11(int x) { return x * 11; }
+inline int f574_12(int x) { return x * 12; }
+inline int f574_13(int x) { return x * 13; }
+inline int f574_14(int x) { return x * 14; }
+inline int f574_15(int x) { return x * 15; }
+inline int f574_16(int x) { return x * 16; }
+inline int f574_17(int x) { return x * 17; }
+inline int f574_18(int x) { return x * 18; }
+inline int f574_19(int x) { return x * 19; }
+inline int f574_20(int x) { return x * 20; }
+inline int f574_21(int x) { return x * 21; }
+inline int f574_22(int x) { return x * 22; }
+inline int f574_23(int x) { return x * 23; }
+inline int f574_24(int x) { return x * 24; }
+inline int f574_25(int x) { return x * 25; }
+inline int f574_26(int x) { return x * 26; }
+inline int f574_27(int x) { return x * 27; }
+inline int f574_28(int x) { return x * 28; }
+inline int f574_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5741 */
+#include <vector>
+#include "h4579.h"
+#include "h8819.h"
+#include "h7488.h"
+#include "h7223.h"
+#include "h4834.h"
+#ifdef X
+#include "h4959.h"
+#endif
+struct S5741 { int a; const char *s = "x//y"; };
+inline int f5741_0(int x) { return x * 0; }
+inline int f5741_1(int x) { return x * 1; }
+inline int f5741_2(int x) { return x * 2; }
+inline int f5741_3(int x) { return x * 3; }
+inline int f5741_4(int x) { return x * 4; }
+inline int f5741_5(int x) { return x * 5; }
+inline int f5741_6(int x) { return x * 6; }
+inline int f5741_7(int x) { return x * 7; }
+inline int f5741_8(int x) { return x * 8; }
+inline int f5741_9(int x) { return x * 9; }
+inline int f5741_10(int x) { return x * 10; }
+inline int f5741_11(int x) { return x * 11; }
+inline int f5741_12(int x) { return x * 12; }
+inline int f5741_13(int x) { return x * 13; }
+inline int f5741_14(int x) { return x * 14; }
+inline int f5741_15(int x) { return x * 15; }
+inline int f5741_16(int x) { return x * 16; }
+inline int f5741_17(int x) { return x * 17; }
+inline int f5741_18(int x) { return x * 18; }
+inline int f5741_19(int x) { return x * 19; }
+inline int f5741_20(int x) { return x * 20; }
+inline int f5741_21(int x) { return x * 21; }
+inline int f5741_22(int x) { return x * 22; }
+inline int f5741_23(int x) { return x * 23; }
+inline int f5741_24(int x) { return x * 24; }
+inline int f5741_25(int x) { return x * 25; }
+inline int f5741_26(int x) { return x * 26; }
+inline int f5741_27(int x) { return x * 27; }
+inline int f5741_28(int x) { return x * 28; }
+inline int f5741_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5745 */
+#include <vector>
+#include "h9414.h"
+#include "h4476.h"
+#include "h4998.h"
+#include "h6009.h"
+#include "h503.h"
+#ifdef X
+#include "h8071.h"
+#endif
+struct S5745 { int a; const char *s = "x//y"; };
+inline int f5745_0(int x) { return x * 0; }
+inline int f5745_1(int x) { return x * 1; }
+inline int f5745_2(int x) { return x * 2; }
+inline int f5745_3(int x) { return x * 3; }
+inline int f5745_4(int x) { return x * 4; }
+inline int f5745_5(int x) { return x * 5; }
+inline int f5745_6(int x) { return x * 6; }
+inline int f5745_7(int x) { return x * 7; }
+inline int f5745_8(int x) { return x * 8; }
+inline int f5745_9(int x) { return x * 9; }
+inline int f5745_10(int x) { return x * 10; }
+inline int f5745_11(int x) { return x * 11; }
+inline int f5745_12(int x) { return x * 12; }
+inline int f5745_13(int x) { return x * 13; }
+inline int f5745_14(int x) { return x * 14; }
+inline int f5745_15(int x) { return x * 15; }
+inline int f5745_16(int x) { return x * 16; }
+inline int f5745_17(int x) { return x * 17; }
+inline int f5745_18(int x) { return x * 18; }
+inline int f5745_19(int x) { return x * 19; }
+inline int f5745_20(int x) { return x * 20; }
+inline int f5745_21(int x) { return x * 21; }
+inline int f5745_22(int x) { return x * 22; }
+inline int f5745_23(int x) { return x * 23; }
+inline int f5745_24(int x) { return x * 24; }
+inline int f5745_25(int x) { return x * 25; }
+inline int f5745_26(int x) { return x * 26; }
+inline int f5745_27(int x) { return x * 27; }
+inline int f5745_28(int x) { return x * 28; }
+inline int f5745_29(int x) { return x * 29; }
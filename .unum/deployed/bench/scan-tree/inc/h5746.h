@@ -0,0 +1,42 @@
+#pragma once
+/* header 5746 */
+#include <vector>
+#include "h3673.h"
+#include "h9602.h"
+#include "h7973.h"
+#include "h5549.h"
+#include "h5570.h"
+#ifdef X
+#include "h2383.h"
+#endif
+struct S5746 { int a; const char *s = "x//y"; };
+inline int f5746_0(int x) { return x * 0; }
+inline int f5746_1(int x) { return x * 1; }
+inline int f5746_2(int x) { return x * 2; }
+inline int f5746_3(int x) { return x * 3; }
+inline int f5746_4(int x) { return x * 4; }
+inline int f5746_5(int x) { return x * 5; }
+inline int f5746_6(int x) { return x * 6; }
+inline int f5746_7(int x) { return x * 7; }
+inline int f5746_8(int x) { return x * 8; }
+inline int f5746_9(int x) { return x * 9; }
+inline int f5746_10(int x) { return x * 10; }
+inline int f5746_11(int x) { return x * 11; }
+inline int f5746_12(int x) { return x * 12; }
+inline int f5746_13(int x) { return x * 13; }
+inline int f5746_14(int x) { return x * 14; }
+inline int f5746_15(int x) { return x * 15; }
+inline int f5746_16(int x) { return x * 16; }
+inline int f5746_17(int x) { return x * 17; }
+inline int f5746_18(int x) { return x * 18; }
+inline int f5746_19(int x) { return x * 19; }
+inline int f5746_20(int x) { return x * 20; }
+inline int f5746_21(int x) { return x * 21; }
+inline int f5746_22(int x) { return x * 22; }
+inline int f5746_23(int x) { return x * 23; }
+inline int f5746_24(int x) { return x * 24; }
+inline int f5746_25(int x) { return x * 25; }
+inline int f5746_26(int x) { return x * 26; }
+inline int f5746_27(int x) { return x * 27; }
+inline int f5746_28(int x) { return x * 28; }
+inline int f5746_29(int x) { return x * 29; }
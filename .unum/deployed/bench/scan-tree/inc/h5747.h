@@ -0,0 +1,42 @@
+#pragma once
+/* header 5747 */
+#include <vector>
+#include "h63.h"
+#include "h1085.h"
+#include "h5415.h"
+#include "h8770.h"
+#include "h3067.h"
+#ifdef X
+#include "h9594.h"
+#endif
+struct S5747 { int a; const char *s = "x//y"; };
+inline int f5747_0(int x) { return x * 0; }
+inline int f5747_1(int x) { return x * 1; }
+inline int f5747_2(int x) { return x * 2; }
+inline int f5747_3(int x) { return x * 3; }
+inline int f5747_4(int x) { return x * 4; }
+inline int f5747_5(int x) { return x * 5; }
+inline int f5747_6(int x) { return x * 6; }
+inline int f5747_7(int x) { return x * 7; }
+inline int f5747_8(int x) { return x * 8; }
+inline int f5747_9(int x) { return x * 9; }
+inline int f5747_10(int x) { return x * 10; }
+inline int f5747_11(int x) { return x * 11; }
+inline int f5747_12(int x) { return x * 12; }
+inline int f5747_13(int x) { return x * 13; }
+inline int f5747_14(int x) { return x * 14; }
+inline int f5747_15(int x) { return x * 15; }
+inline int f5747_16(int x) { return x * 16; }
+inline int f5747_17(int x) { return x * 17; }
+inline int f5747_18(int x) { return x * 18; }
+inline int f5747_19(int x) { return x * 19; }
+inline int f5747_20(int x) { return x * 20; }
+inline int f5747_21(int x) { return x * 21; }
+inline int f5747_22(int x) { return x * 22; }
+inline int f5747_23(int x) { return x * 23; }
+inline int f5747_24(int x) { return x * 24; }
+inline int f5747_25(int x) { return x * 25; }
+inline int f5747_26(int x) { return x * 26; }
+inline int f5747_27(int x) { return x * 27; }
+inline int f5747_28(int x) { return x * 28; }
+inline int f5747_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5748 */
+#include <vector>
+#include "h831.h"
+#include "h5119.h"
+#include "h4384.h"
+#include "h3848.h"
+#include "h2162.h"
+#ifdef X
+#include "h7335.h"
+#endif
+struct S5748 { int a; const char *s = "x//y"; };
+inline int f5748_0(int x) { return x * 0; }
+inline int f5748_1(int x) { return x * 1; }
+inline int f5748_2(int x) { return x * 2; }
+inline int f5748_3(int x) { return x * 3; }
+inline int f5748_4(int x) { return x * 4; }
+inline int f5748_5(int x) { return x * 5; }
+inline int f5748_6(int x) { return x * 6; }
+inline int f5748_7(int x) { return x * 7; }
+inline int f5748_8(int x) { return x * 8; }
+inline int f5748_9(int x) { return x * 9; }
+inline int f5748_10(int x) { return x * 10; }
+inline int f5748_11(int x) { return x * 11; }
+inline int f5748_12(int x) { return x * 12; }
+inline int f5748_13(int x) { return x * 13; }
+inline int f5748_14(int x) { return x * 14; }
+inline int f5748_15(int x) { return x * 15; }
+inline int f5748_16(int x) { return x * 16; }
+inline int f5748_17(int x) { return x * 17; }
+inline int f5748_18(int x) { return x * 18; }
+inline int f5748_19(int x) { return x * 19; }
+inline int f5748_20(int x) { return x * 20; }
+inline int f5748_21(int x) { return x * 21; }
+inline int f5748_22(int x) { return x * 22; }
+inline int f5748_23(int x) { return x * 23; }
+inline int f5748_24(int x) { return x * 24; }
+inline int f5748_25(int x) { return x * 25; }
+inline int f5748_26(int x) { return x * 26; }
+inline int f5748_27(int x) { return x * 27; }
+inline int f5748_28(int x) { return x * 28; }
+inline int f5748_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 575 */
+#include <vector>
+#include "h8271.h"
+#include "h6095.h"
+#include "h1576.h"
+#include "h2547.h"
+#include "h5046.h"
+#ifdef X
+#include "h4601.h"
+#endif
+struct S575 { int a; const char *s = "x//y"; };
+inline int f575_0(int x) { return x * 0; }
+inline int f575_1(int x) { return x * 1; }
+inline int f575_2(int x) { return x * 2; }
+inline int f575_3(int x) { return x * 3; }
+inline int f575_4(int x) { return x * 4; }
+inline int f575_5(int x) { return x * 5; }
+inline int f575_6(int x) { return x * 6; }
+inline int f575_7(int x) { return x * 7; }
+inline int f575_8(int x) { return x * 8; }
+inline int f575_9(int x) { return x * 9; }
+inline int f575_10(int x) { return x * 10; }
+inline int f575_11(int x) { return x * 11; }
+inline int f575_12(int x) { return x * 12; }
+inline int f575_13(int x) { return x * 13; }
+inline int f575_14(int x) { return x * 14; }
+inline int f575_15(int x) { return x * 15; }
+inline int f575_16(int x) { return x * 16; }
+inline int f575_17(int x) { return x * 17; }
+inline int f575_18(int x) { return x * 18; }
+inline int f575_19(int x) { return x * 19; }
+inline int f575_20(int x) { return x * 20; }
+inline int f575_21(int x) { return x * 21; }
+inline int f575_22(int x) { return x * 22; }
+inline int f575_23(int x) { return x * 23; }
+inline int f575_24(int x) { return x * 24; }
+inline int f575_25(int x) { return x * 25; }
+inline int f575_26(int x) { return x * 26; }
+inline int f575_27(int x) { return x * 27; }
+inline int f575_28(int x) { return x * 28; }
+inline int f575_29(int x) { return x * 29; }
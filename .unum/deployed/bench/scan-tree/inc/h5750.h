@@ -0,0 +1,42 @@
+#pragma once
+/* header 5750 */
+#include <vector>
+#include "h6509.h"
+#include "h933.h"
+#include "h7491.h"
+#include "h945.h"
+#include "h1525.h"
+#ifdef X
+#include "h1794.h"
+#endif
+struct S5750 { int a; const char *s = "x//y"; };
+inline int f5750_0(int x) { return x * 0; }
+inline int f5750_1(int x) { return x * 1; }
+inline int f5750_2(int x) { return x * 2; }
+inline int f5750_3(int x) { return x * 3; }
+inline int f5750_4(int x) { return x * 4; }
+inline int f5750_5(int x) { return x * 5; }
+inline int f5750_6(int x) { return x * 6; }
+inline int f5750_7(int x) { return x * 7; }
+inline int f5750_8(int x) { return x * 8; }
+inline int f5750_9(int x) { return x * 9; }
+inline int f5750_10(int x) { return x * 10; }
+inline int f5750_11(int x) { return x * 11; }
+inline int f5750_12(int x) { return x * 12; }
+inline int f5750_13(int x) { return x * 13; }
+inline int f5750_14(int x) { return x * 14; }
+inline int f5750_15(int x) { return x * 15; }
+inline int f5750_16(int x) { return x * 16; }
+inline int f5750_17(int x) { return x * 17; }
+inline int f5750_18(int x) { return x * 18; }
+inline int f5750_19(int x) { return x * 19; }
+inline int f5750_20(int x) { return x * 20; }
+inline int f5750_21(int x) { return x * 21; }
+inline int f5750_22(int x) { return x * 22; }
+inline int f5750_23(int x) { return x * 23; }
+inline int f5750_24(int x) { return x * 24; }
+inline int f5750_25(int x) { return x * 25; }
+inline int f5750_26(int x) { return x * 26; }
+inline int f5750_27(int x) { return x * 27; }
+inline int f5750_28(int x) { return x * 28; }
+inline int f5750_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5754 */
+#include <vector>
+#include "h3569.h"
+#include "h5957.h"
+#include "h3616.h"
+#include "h8138.h"
+#include "h6935.h"
+#ifdef X
+#include "h6630.h"
+#endif
+struct S5754 { int a; const char *s = "x//y"; };
+inline int f5754_0(int x) { return x * 0; }
+inline int f5754_1(int x) { return x * 1; }
+inline int f5754_2(int x) { return x * 2; }
+inline int f5754_3(int x) { return x * 3; }
+inline int f5754_4(int x) { return x * 4; }
+inline int f5754_5(int x) { return x * 5; }
+inline int f5754_6(int x) { return x * 6; }
+inline int f5754_7(int x) { return x * 7; }
+inline int f5754_8(int x) { return x * 8; }
+inline int f5754_9(int x) { return x * 9; }
+inline int f5754_10(int x) { return x * 10; }
+inline int f5754_11(int x) { return x * 11; }
+inline int f5754_12(int x) { return x * 12; }
+inline int f5754_13(int x) { return x * 13; }
+inline int f5754_14(int x) { return x * 14; }
+inline int f5754_15(int x) { return x * 15; }
+inline int f5754_16(int x) { return x * 16; }
+inline int f5754_17(int x) { return x * 17; }
+inline int f5754_18(int x) { return x * 18; }
+inline int f5754_19(int x) { return x * 19; }
+inline int f5754_20(int x) { return x * 20; }
+inline int f5754_21(int x) { return x * 21; }
+inline int f5754_22(int x) { return x * 22; }
+inline int f5754_23(int x) { return x * 23; }
+inline int f5754_24(int x) { return x * 24; }
+inline int f5754_25(int x) { return x * 25; }
+inline int f5754_26(int x) { return x * 26; }
+inline int f5754_27(int x) { return x * 27; }
+inline int f5754_28(int x) { return x * 28; }
+inline int f5754_29(int x) { return x * 29; }
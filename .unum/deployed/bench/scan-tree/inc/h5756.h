@@ -0,0 +1,42 @@
+#pragma once
+/* header 5756 */
+#include <vector>
+#include "h1535.h"
+#include "h4126.h"
+#include "h8732.h"
+#include "h1258.h"
+#include "h7363.h"
+#ifdef X
+#include "h1601.h"
+#endif
+struct S5756 { int a; const char *s = "x//y"; };
+inline int f5756_0(int x) { return x * 0; }
+inline int f5756_1(int x) { return x * 1; }
+inline int f5756_2(int x) { return x * 2; }
+inline int f5756_3(int x) { return x * 3; }
+inline int f5756_4(int x) { return x * 4; }
+inline int f5756_5(int x) { return x * 5; }
+inline int f5756_6(int x) { return x * 6; }
+inline int f5756_7(int x) { return x * 7; }
+inline int f5756_8(int x) { return x * 8; }
+inline int f5756_9(int x) { return x * 9; }
+inline int f5756_10(int x) { return x * 10; }
+inline int f5756_11(int x) { return x * 11; }
+inline int f5756_12(int x) { return x * 12; }
+inline int f5756_13(int x) { return x * 13; }
+inline int f5756_14(int x) { return x * 14; }
+inline int f5756_15(int x) { return x * 15; }
+inline int f5756_16(int x) { return x * 16; }
+inline int f5756_17(int x) { return x * 17; }
+inline int f5756_18(int x) { return x * 18; }
+inline int f5756_19(int x) { return x * 19; }
+inline int f5756_20(int x) { return x * 20; }
+inline int f5756_21(int x) { return x * 21; }
+inline int f5756_22(int x) { return x * 22; }
+inline int f5756_23(int x) { return x * 23; }
+inline int f5756_24(int x) { return x * 24; }
+inline int f5756_25(int x) { return x * 25; }
+inline int f5756_26(int x) { return x * 26; }
+inline int f5756_27(int x) { return x * 27; }
+inline int f5756_28(int x) { return x * 28; }
+inline int f5756_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5757 */
+#include <vector>
+#include "h1531.h"
+#include "h4844.h"
+#include "h8290.h"
+#include "h402.h"
+#include "h1954.h"
+#ifdef X
+#include "h8544.h"
+#endif
+struct S5757 { int a; const char *s = "x//y"; };
+inline int f5757_0(int x) { return x * 0; }
+inline int f5757_1(int x) { return x * 1; }
+inline int f5757_2(int x) { return x * 2; }
+inline int f5757_3(int x) { return x * 3; }
+inline int f5757_4(int x) { return x * 4; }
+inline int f5757_5(int x) { return x * 5; }
+inline int f5757_6(int x) { return x * 6; }
+inline int f5757_7(int x) { return x * 7; }
+inline int f5757_8(int x) { return x * 8; }
+inline int f5757_9(int x) { return x * 9; }
+inline int f5757_10(int x) { return x * 10; }
+inline int f5757_11(int x) { return x * 11; }
+inline int f5757_12(int x) { return x * 12; }
+inline int f5757_13(int x) { return x * 13; }
+inline int f5757_14(int x) { return x * 14; }
+inline int f5757_15(int x) { return x * 15; }
+inline int f5757_16(int x) { return x * 16; }
+inline int f5757_17(int x) { return x * 17; }
+inline int f5757_18(int x) { return x * 18; }
+inline int f5757_19(int x) { return x * 19; }
+inline int f5757_20(int x) { return x * 20; }
+inline int f5757_21(int x) { return x * 21; }
+inline int f5757_22(int x) { return x * 22; }
+inline int f5757_23(int x) { return x * 23; }
+inline int f5757_24(int x) { return x * 24; }
+inline int f5757_25(int x) { return x * 25; }
+inline int f5757_26(int x) { return x * 26; }
+inline int f5757_27(int x) { return x * 27; }
+inline int f5757_28(int x) { return x * 28; }
+inline int f5757_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5759 */
+#include <vector>
+#include "h2091.h"
+#include "h190.h"
+#include "h6718.h"
+#include "h9876.h"
+#include "h155.h"
+#ifdef X
+#include "h4336.h"
+#endif
+struct S5759 { int a; const char *s = "x//y"; };
+inline int f5759_0(int x) { return x * 0; }
+inline int f5759_1(int x) { return x * 1; }
+inline int f5759_2(int x) { return x * 2; }
+inline int f5759_3(int x) { return x * 3; }
+inline int f5759_4(int x) { return x * 4; }
+inline int f5759_5(int x) { return x * 5; }
+inline int f5759_6(int x) { return x * 6; }
+inline int f5759_7(int x) { return x * 7; }
+inline int f5759_8(int x) { return x * 8; }
+inline int f5759_9(int x) { return x * 9; }
+inline int f5759_10(int x) { return x * 10; }
+inline int f5759_11(int x) { return x * 11; }
+inline int f5759_12(int x) { return x * 12; }
+inline int f5759_13(int x) { return x * 13; }
+inline int f5759_14(int x) { return x * 14; }
+inline int f5759_15(int x) { return x * 15; }
+inline int f5759_16(int x) { return x * 16; }
+inline int f5759_17(int x) { return x * 17; }
+inline int f5759_18(int x) { return x * 18; }
+inline int f5759_19(int x) { return x * 19; }
+inline int f5759_20(int x) { return x * 20; }
+inline int f5759_21(int x) { return x * 21; }
+inline int f5759_22(int x) { return x * 22; }
+inline int f5759_23(int x) { return x * 23; }
+inline int f5759_24(int x) { return x * 24; }
+inline int f5759_25(int x) { return x * 25; }
+inline int f5759_26(int x) { return x * 26; }
+inline int f5759_27(int x) { return x * 27; }
+inline int f5759_28(int x) { return x * 28; }
+inline int f5759_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 576 */
+#include <vector>
+#include "h8666.h"
+#include "h8565.h"
+#include "h7899.h"
+#include "h4865.h"
+#include "h5435.h"
+#ifdef X
+#include "h11.h"
+#endif
+struct S576 { int a; const char *s = "x//y"; };
+inline int f576_0(int x) { return x * 0; }
+inline int f576_1(int x) { return x * 1; }
+inline int f576_2(int x) { return x * 2; }
+inline int f576_3(int x) { return x * 3; }
+inline int f576_4(int x) { return x * 4; }
+inline int f576_5(int x) { return x * 5; }
+inline int f576_6(int x) { return x * 6; }
+inline int f576_7(int x) { return x * 7; }
+inline int f576_8(int x) { return x * 8; }
+inline int f576_9(int x) { return x * 9; }
+inline int f576_10(int x) { return x * 10; }
+inline int f576_11(int x) { return x * 11; }
+inline int f576_12(int x) { return x * 12; }
+inline int f576_13(int x) { return x * 13; }
+inline int f576_14(int x) { return x * 14; }
+inline int f576_15(int x) { return x * 15; }
+inline int f576_16(int x) { return x * 16; }
+inline int f576_17(int x) { return x * 17; }
+inline int f576_18(int x) { return x * 18; }
+inline int f576_19(int x) { return x * 19; }
+inline int f576_20(int x) { return x * 20; }
+inline int f576_21(int x) { return x * 21; }
+inline int f576_22(int x) { return x * 22; }
+inline int f576_23(int x) { return x * 23; }
+inline int f576_24(int x) { return x * 24; }
+inline int f576_25(int x) { return x * 25; }
+inline int f576_26(int x) { return x * 26; }
+inline int f576_27(int x) { return x * 27; }
+inline int f576_28(int x) { return x * 28; }
+inline int f576_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5760 */
+#include <vector>
+#include "h2910.h"
+#include "h9876.h"
+#include "h7870.h"
+#include "h7927.h"
+#include "h5966.h"
+#ifdef X
+#include "h5196.h"
+#endif
+struct S5760 { int a; const char *s = "x//y"; };
+inline int f5760_0(int x) { return x * 0; }
+inline int f5760_1(int x) { return x * 1; }
+inline int f5760_2(int x) { return x * 2; }
+inline int f5760_3(int x) { return x * 3; }
+inline int f5760_4(int x) { return x * 4; }
+inline int f5760_5(int x) { return x * 5; }
+inline int f5760_6(int x) { return x * 6; }
+inline int f5760_7(int x) { return x * 7; }
+inline int f5760_8(int x) { return x * 8; }
+inline int f5760_9(int x) { return x * 9; }
+inline int f5760_10(int x) { return x * 10; }
+inline int f5760_11(int x) { return x * 11; }
+inline int f5760_12(int x) { return x * 12; }
+inline int f5760_13(int x) { return x * 13; }
+inline int f5760_14(int x) { return x * 14; }
+inline int f5760_15(int x) { return x * 15; }
+inline int f5760_16(int x) { return x * 16; }
+inline int f5760_17(int x) { return x * 17; }
+inline int f5760_18(int x) { return x * 18; }
+inline int f5760_19(int x) { return x * 19; }
+inline int f5760_20(int x) { return x * 20; }
+inline int f5760_21(int x) { return x * 21; }
+inline int f5760_22(int x) { return x * 22; }
+inline int f5760_23(int x) { return x * 23; }
+inline int f5760_24(int x) { return x * 24; }
+inline int f5760_25(int x) { return x * 25; }
+inline int f5760_26(int x) { return x * 26; }
+inline int f5760_27(int x) { return x * 27; }
+inline int f5760_28(int x) { return x * 28; }
+inline int f5760_29(int x) { return x * 29; }
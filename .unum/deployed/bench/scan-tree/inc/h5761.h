@@ -0,0 +1,42 @@
+#pragma once
+/* header 5761 */
+#include <vector>
+#include "h9604.h"
+#include "h8920.h"
+#include "h9103.h"
+#include "h8843.h"
+#include "h9679.h"
+#ifdef X
+#include "h8335.h"
+#endif
+struct S5761 { int a; const char *s = "x//y"; };
+inline int f5761_0(int x) { return x * 0; }
+inline int f5761_1(int x) { return x * 1; }
+inline int f5761_2(int x) { return x * 2; }
+inline int f5761_3(int x) { return x * 3; }
+inline int f5761_4(int x) { return x * 4; }
+inline int f5761_5(int x) { return x * 5; }
+inline int f5761_6(int x) { return x * 6; }
+inline int f5761_7(int x) { return x * 7; }
+inline int f5761_8(int x) { return x * 8; }
+inline int f5761_9(int x) { return x * 9; }
+inline int f5761_10(int x) { return x * 10; }
+inline int f5761_11(int x) { return x * 11; }
+inline int f5761_12(int x) { return x * 12; }
+inline int f5761_13(int x) { return x * 13; }
+inline int f5761_14(int x) { return x * 14; }
+inline int f5761_15(int x) { return x * 15; }
+inline int f5761_16(int x) { return x * 16; }
+inline int f5761_17(int x) { return x * 17; }
+inline int f5761_18(int x) { return x * 18; }
+inline int f5761_19(int x) { return x * 19; }
+inline int f5761_20(int x) { return x * 20; }
+inline int f5761_21(int x) { return x * 21; }
+inline int f5761_22(int x) { return x * 22; }
+inline int f5761_23(int x) { return x * 23; }
+inline int f5761_24(int x) { return x * 24; }
+inline int f5761_25(int x) { return x * 25; }
+inline int f5761_26(int x) { return x * 26; }
+inline int f5761_27(int x) { return x * 27; }
+inline int f5761_28(int x) { return x * 28; }
+inline int f5761_29(int x) { return x * 29; }
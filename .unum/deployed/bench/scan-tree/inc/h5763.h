@@ -0,0 +1,42 @@
+#pragma once
+/* header 5763 */
+#include <vector>
+#include "h6615.h"
+#include "h2344.h"
+#include "h1773.h"
+#include "h2750.h"
+#include "h1193.h"
+#ifdef X
+#include "h1315.h"
+#endif
+struct S5763 { int a; const char *s = "x//y"; };
+inline int f5763_0(int x) { return x * 0; }
+inline int f5763_1(int x) { return x * 1; }
+inline int f5763_2(int x) { return x * 2; }
+inline int f5763_3(int x) { return x * 3; }
+inline int f5763_4(int x) { return x * 4; }
+inline int f5763_5(int x) { return x * 5; }
+inline int f5763_6(int x) { return x * 6; }
+inline int f5763_7(int x) { return x * 7; }
+inline int f5763_8(int x) { return x * 8; }
+inline int f5763_9(int x) { return x * 9; }
+inline int f5763_10(int x) { return x * 10; }
+inline int f5763_11(int x) { return x * 11; }
+inline int f5763_12(int x) { return x * 12; }
+inline int f5763_13(int x) { return x * 13; }
+inline int f5763_14(int x) { return x * 14; }
+inline int f5763_15(int x) { return x * 15; }
+inline int f5763_16(int x) { return x * 16; }
+inline int f5763_17(int x) { return x * 17; }
+inline int f5763_18(int x) { return x * 18; }
+inline int f5763_19(int x) { return x * 19; }
+inline int f5763_20(int x) { return x * 20; }
+inline int f5763_21(int x) { return x * 21; }
+inline int f5763_22(int x) { return x * 22; }
+inline int f5763_23(int x) { return x * 23; }
+inline int f5763_24(int x) { return x * 24; }
+inline int f5763_25(int x) { return x * 25; }
+inline int f5763_26(int x) { return x * 26; }
+inline int f5763_27(int x) { return x * 27; }
+inline int f5763_28(int x) { return x * 28; }
+inline int f5763_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5766 */
+#include <vector>
+#include "h7709.h"
+#include "h8661.h"
+#include "h7426.h"
+#include "h4579.h"
+#include "h8258.h"
+#ifdef X
+#include "h1928.h"
+#endif
+struct S5766 { int a; const char *s = "x//y"; };
+inline int f5766_0(int x) { return x * 0; }
+inline int f5766_1(int x) { return x * 1; }
+inline int f5766_2(int x) { return x * 2; }
+inline int f5766_3(int x) { return x * 3; }
+inline int f5766_4(int x) { return x * 4; }
+inline int f5766_5(int x) { return x * 5; }
+inline int f5766_6(int x) { return x * 6; }
+inline int f5766_7(int x) { return x * 7; }
+inline int f5766_8(int x) { return x * 8; }
+inline int f5766_9(int x) { return x * 9; }
+inline int f5766_10(int x) { return x * 10; }
+inline int f5766_11(int x) { return x * 11; }
+inline int f5766_12(int x) { return x * 12; }
+inline int f5766_13(int x) { return x * 13; }
+inline int f5766_14(int x) { return x * 14; }
+inline int f5766_15(int x) { return x * 15; }
+inline int f5766_16(int x) { return x * 16; }
+inline int f5766_17(int x) { return x * 17; }
+inline int f5766_18(int x) { return x * 18; }
+inline int f5766_19(int x) { return x * 19; }
+inline int f5766_20(int x) { return x * 20; }
+inline int f5766_21(int x) { return x * 21; }
+inline int f5766_22(int x) { return x * 22; }
+inline int f5766_23(int x) { return x * 23; }
+inline int f5766_24(int x) { return x * 24; }
+inline int f5766_25(int x) { return x * 25; }
+inline int f5766_26(int x) { return x * 26; }
+inline int f5766_27(int x) { return x * 27; }
+inline int f5766_28(int x) { return x * 28; }
+inline int f5766_29(int x) { return x * 29; }
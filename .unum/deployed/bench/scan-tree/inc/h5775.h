@@ -0,0 +1,42 @@
+#pragma once
+/* header 5775 */
+#include <vector>
+#include "h6117.h"
+#include "h3048.h"
+#include "h9387.h"
+#include "h4560.h"
+#include "h4944.h"
+#ifdef X
+#include "h7502.h"
+#endif
+struct S5775 { int a; const char *s = "x//y"; };
+inline int f5775_0(int x) { return x * 0; }
+inline int f5775_1(int x) { return x * 1; }
+inline int f5775_2(int x) { return x * 2; }
+inline int f5775_3(int x) { return x * 3; }
+inline int f5775_4(int x) { return x * 4; }
+inline int f5775_5(int x) { return x * 5; }
+inline int f5775_6(int x) { return x * 6; }
+inline int f5775_7(int x) { return x * 7; }
+inline int f5775_8(int x) { return x * 8; }
+inline int f5775_9(int x) { return x * 9; }
+inline int f5775_10(int x) { return x * 10; }
+inline int f5775_11(int x) { return x * 11; }
+inline int f5775_12(int x) { return x * 12; }
+inline int f5775_13(int x) { return x * 13; }
+inline int f5775_14(int x) { return x * 14; }
+inline int f5775_15(int x) { return x * 15; }
+inline int f5775_16(int x) { return x * 16; }
+inline int f5775_17(int x) { return x * 17; }
+inline int f5775_18(int x) { return x * 18; }
+inline int f5775_19(int x) { return x * 19; }
+inline int f5775_20(int x) { return x * 20; }
+inline int f5775_21(int x) { return x * 21; }
+inline int f5775_22(int x) { return x * 22; }
+inline int f5775_23(int x) { return x * 23; }
+inline int f5775_24(int x) { return x * 24; }
+inline int f5775_25(int x) { return x * 25; }
+inline int f5775_26(int x) { return x * 26; }
+inline int f5775_27(int x) { return x * 27; }
+inline int f5775_28(int x) { return x * 28; }
+inline int f5775_29(int x) { return x * 29; }
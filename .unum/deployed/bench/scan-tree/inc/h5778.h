@@ -0,0 +1,42 @@
+#pragma once
+/* header 5778 */
+#include <vector>
+#include "h75.h"
+#include "h8318.h"
+#include "h2503.h"
+#include "h3855.h"
+#include "h1027.h"
+#ifdef X
+#include "h1565.h"
+#endif
+struct S5778 { int a; const char *s = "x//y"; };
+inline int f5778_0(int x) { return x * 0; }
+inline int f5778_1(int x) { return x * 1; }
+inline int f5778_2(int x) { return x * 2; }
+inline int f5778_3(int x) { return x * 3; }
+inline int f5778_4(int x) { return x * 4; }
+inline int f5778_5(int x) { return x * 5; }
+inline int f5778_6(int x) { return x * 6; }
+inline int f5778_7(int x) { return x * 7; }
+inline int f5778_8(int x) { return x * 8; }
+inline int f5778_9(int x) { return x * 9; }
+inline int f5778_10(int x) { return x * 10; }
+inline int f5778_11(int x) { return x * 11; }
+inline int f5778_12(int x) { return x * 12; }
+inline int f5778_13(int x) { return x * 13; }
+inline int f5778_14(int x) { return x * 14; }
+inline int f5778_15(int x) { return x * 15; }
+inline int f5778_16(int x) { return x * 16; }
+inline int f5778_17(int x) { return x * 17; }
+inline int f5778_18(int x) { return x * 18; }
+inline int f5778_19(int x) { return x * 19; }
+inline int f5778_20(int x) { return x * 20; }
+inline int f5778_21(int x) { return x * 21; }
+inline int f5778_22(int x) { return x * 22; }
+inline int f5778_23(int x) { return x * 23; }
+inline int f5778_24(int x) { return x * 24; }
+inline int f5778_25(int x) { return x * 25; }
+inline int f5778_26(int x) { return x * 26; }
+inline int f5778_27(int x) { return x * 27; }
+inline int f5778_28(int x) { return x * 28; }
+inline int f5778_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5779 */
+#include <vector>
+#include "h3617.h"
+#include "h4463.h"
+#include "h259.h"
+#include "h1440.h"
+#include "h2408.h"
+#ifdef X
+#include "h1862.h"
+#endif
+struct S5779 { int a; const char *s = "x//y"; };
+inline int f5779_0(int x) { return x * 0; }
+inline int f5779_1(int x) { return x * 1; }
+inline int f5779_2(int x) { return x * 2; }
+inline int f5779_3(int x) { return x * 3; }
+inline int f5779_4(int x) { return x * 4; }
+inline int f5779_5(int x) { return x * 5; }
+inline int f5779_6(int x) { return x * 6; }
+inline int f5779_7(int x) { return x * 7; }
+inline int f5779_8(int x) { return x * 8; }
+inline int f5779_9(int x) { return x * 9; }
+inline int f5779_10(int x) { return x * 10; }
+inline int f5779_11(int x) { return x * 11; }
+inline int f5779_12(int x) { return x * 12; }
+inline int f5779_13(int x) { return x * 13; }
+inline int f5779_14(int x) { return x * 14; }
+inline int f5779_15(int x) { return x * 15; }
+inline int f5779_16(int x) { return x * 16; }
+inline int f5779_17(int x) { return x * 17; }
+inline int f5779_18(int x) { return x * 18; }
+inline int f5779_19(int x) { return x * 19; }
+inline int f5779_20(int x) { return x * 20; }
+inline int f5779_21(int x) { return x * 21; }
+inline int f5779_22(int x) { return x * 22; }
+inline int f5779_23(int x) { return x * 23; }
+inline int f5779_24(int x) { return x * 24; }
+inline int f5779_25(int x) { return x * 25; }
+inline int f5779_26(int x) { return x * 26; }
+inline int f5779_27(int x) { return x * 27; }
+inline int f5779_28(int x) { return x * 28; }
+inline int f5779_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5781 */
+#include <vector>
+#include "h5126.h"
+#include "h6690.h"
+#include "h9228.h"
+#include "h8492.h"
+#include "h5398.h"
+#ifdef X
+#include "h6388.h"
+#endif
+struct S5781 { int a; const char *s = "x//y"; };
+inline int f5781_0(int x) { return x * 0; }
+inline int f5781_1(int x) { return x * 1; }
+inline int f5781_2(int x) { return x * 2; }
+inline int f5781_3(int x) { return x * 3; }
+inline int f5781_4(int x) { return x * 4; }
+inline int f5781_5(int x) { return x * 5; }
+inline int f5781_6(int x) { return x * 6; }
+inline int f5781_7(int x) { return x * 7; }
+inline int f5781_8(int x) { return x * 8; }
+inline int f5781_9(int x) { return x * 9; }
+inline int f5781_10(int x) { return x * 10; }
+inline int f5781_11(int x) { return x * 11; }
+inline int f5781_12(int x) { return x * 12; }
+inline int f5781_13(int x) { return x * 13; }
+inline int f5781_14(int x) { return x * 14; }
+inline int f5781_15(int x) { return x * 15; }
+inline int f5781_16(int x) { return x * 16; }
+inline int f5781_17(int x) { return x * 17; }
+inline int f5781_18(int x) { return x * 18; }
+inline int f5781_19(int x) { return x * 19; }
+inline int f5781_20(int x) { return x * 20; }
+inline int f5781_21(int x) { return x * 21; }
+inline int f5781_22(int x) { return x * 22; }
+inline int f5781_23(int x) { return x * 23; }
+inline int f5781_24(int x) { return x * 24; }
+inline int f5781_25(int x) { return x * 25; }
+inline int f5781_26(int x) { return x * 26; }
+inline int f5781_27(int x) { return x * 27; }
+inline int f5781_28(int x) { return x * 28; }
+inline int f5781_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5784 */
+#include <vector>
+#include "h2016.h"
+#include "h5695.h"
+#include "h2201.h"
+#include "h7853.h"
+#include "h7278.h"
+#ifdef X
+#include "h2507.h"
+#endif
+struct S5784 { int a; const char *s = "x//y"; };
+inline int f5784_0(int x) { return x * 0; }
+inline int f5784_1(int x) { return x * 1; }
+inline int f5784_2(int x) { return x * 2; }
+inline int f5784_3(int x) { return x * 3; }
+inline int f5784_4(int x) { return x * 4; }
+inline int f5784_5(int x) { return x * 5; }
+inline int f5784_6(int x) { return x * 6; }
+inline int f5784_7(int x) { return x * 7; }
+inline int f5784_8(int x) { return x * 8; }
+inline int f5784_9(int x) { return x * 9; }
+inline int f5784_10(int x) { return x * 10; }
+inline int f5784_11(int x) { return x * 11; }
+inline int f5784_12(int x) { return x * 12; }
+inline int f5784_13(int x) { return x * 13; }
+inline int f5784_14(int x) { return x * 14; }
+inline int f5784_15(int x) { return x * 15; }
+inline int f5784_16(int x) { return x * 16; }
+inline int f5784_17(int x) { return x * 17; }
+inline int f5784_18(int x) { return x * 18; }
+inline int f5784_19(int x) { return x * 19; }
+inline int f5784_20(int x) { return x * 20; }
+inline int f5784_21(int x) { return x * 21; }
+inline int f5784_22(int x) { return x * 22; }
+inline int f5784_23(int x) { return x * 23; }
+inline int f5784_24(int x) { return x * 24; }
+inline int f5784_25(int x) { return x * 25; }
+inline int f5784_26(int x) { return x * 26; }
+inline int f5784_27(int x) { return x * 27; }
+inline int f5784_28(int x) { return x * 28; }
+inline int f5784_29(int x) { return x * 29; }
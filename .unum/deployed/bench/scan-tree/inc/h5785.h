@@ -0,0 +1,42 @@
+#pragma once
+/* header 5785 */
+#include <vector>
+#include "h9273.h"
+#include "h7751.h"
+#include "h3682.h"
+#include "h9947.h"
+#include "h7710.h"
+#ifdef X
+#include "h7535.h"
+#endif
+struct S5785 { int a; const char *s = "x//y"; };
+inline int f5785_0(int x) { return x * 0; }
+inline int f5785_1(int x) { return x * 1; }
+inline int f5785_2(int x) { return x * 2; }
+inline int f5785_3(int x) { return x * 3; }
+inline int f5785_4(int x) { return x * 4; }
+inline int f5785_5(int x) { return x * 5; }
+inline int f5785_6(int x) { return x * 6; }
+inline int f5785_7(int x) { return x * 7; }
+inline int f5785_8(int x) { return x * 8; }
+inline int f5785_9(int x) { return x * 9; }
+inline int f5785_10(int x) { return x * 10; }
+inline int f5785_11(int x) { return x * 11; }
+inline int f5785_12(int x) { return x * 12; }
+inline int f5785_13(int x) { return x * 13; }
+inline int f5785_14(int x) { return x * 14; }
+inline int f5785_15(int x) { return x * 15; }
+inline int f5785_16(int x) { return x * 16; }
+inline int f5785_17(int x) { return x * 17; }
+inline int f5785_18(int x) { return x * 18; }
+inline int f5785_19(int x) { return x * 19; }
+inline int f5785_20(int x) { return x * 20; }
+inline int f5785_21(int x) { return x * 21; }
+inline int f5785_22(int x) { return x * 22; }
+inline int f5785_23(int x) { return x * 23; }
+inline int f5785_24(int x) { return x * 24; }
+inline int f5785_25(int x) { return x * 25; }
+inline int f5785_26(int x) { return x * 26; }
+inline int f5785_27(int x) { return x * 27; }
+inline int f5785_28(int x) { return x * 28; }
+inline int f5785_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5786 */
+#include <vector>
+#include "h2820.h"
+#include "h1600.h"
+#include "h123.h"
+#include "h8164.h"
+#include "h509.h"
+#ifdef X
+#include "h2797.h"
+#endif
+struct S5786 { int a; const char *s = "x//y"; };
+inline int f5786_0(int x) { return x * 0; }
+inline int f5786_1(int x) { return x * 1; }
+inline int f5786_2(int x) { return x * 2; }
+inline int f5786_3(int x) { return x * 3; }
+inline int f5786_4(int x) { return x * 4; }
+inline int f5786_5(int x) { return x * 5; }
+inline int f5786_6(int x) { return x * 6; }
+inline int f5786_7(int x) { return x * 7; }
+inline int f5786_8(int x) { return x * 8; }
+inline int f5786_9(int x) { return x * 9; }
+inline int f5786_10(int x) { return x * 10; }
+inline int f5786_11(int x) { return x * 11; }
+inline int f5786_12(int x) { return x * 12; }
+inline int f5786_13(int x) { return x * 13; }
+inline int f5786_14(int x) { return x * 14; }
+inline int f5786_15(int x) { return x * 15; }
+inline int f5786_16(int x) { return x * 16; }
+inline int f5786_17(int x) { return x * 17; }
+inline int f5786_18(int x) { return x * 18; }
+inline int f5786_19(int x) { return x * 19; }
+inline int f5786_20(int x) { return x * 20; }
+inline int f5786_21(int x) { return x * 21; }
+inline int f5786_22(int x) { return x * 22; }
+inline int f5786_23(int x) { return x * 23; }
+inline int f5786_24(int x) { return x * 24; }
+inline int f5786_25(int x) { return x * 25; }
+inline int f5786_26(int x) { return x * 26; }
+inline int f5786_27(int x) { return x * 27; }
+inline int f5786_28(int x) { return x * 28; }
+inline int f5786_29(int x) { return x * 29; }
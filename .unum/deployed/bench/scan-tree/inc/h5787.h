@@ -0,0 +1,42 @@
+#pragma once
+/* header 5787 */
+#include <vector>
+#include "h2113.h"
+#include "h6474.h"
+#include "h9358.h"
+#include "h2861.h"
+#include "h6745.h"
+#ifdef X
+#include "h1321.h"
+#endif
+struct S5787 { int a; const char *s = "x//y"; };
+inline int f5787_0(int x) { return x * 0; }
+inline int f5787_1(int x) { return x * 1; }
+inline int f5787_2(int x) { return x * 2; }
+inline int f5787_3(int x) { return x * 3; }
+inline int f5787_4(int x) { return x * 4; }
+inline int f5787_5(int x) { return x * 5; }
+inline int f5787_6(int x) { return x * 6; }
+inline int f5787_7(int x) { return x * 7; }
+inline int f5787_8(int x) { return x * 8; }
+inline int f5787_9(int x) { return x * 9; }
+inline int f5787_10(int x) { return x * 10; }
+inline int f5787_11(int x) { return x * 11; }
+inline int f5787_12(int x) { return x * 12; }
+inline int f5787_13(int x) { return x * 13; }
+inline int f5787_14(int x) { return x * 14; }
+inline int f5787_15(int x) { return x * 15; }
+inline int f5787_16(int x) { return x * 16; }
+inline int f5787_17(int x) { return x * 17; }
+inline int f5787_18(int x) { return x * 18; }
+inline int f5787_19(int x) { return x * 19; }
+inline int f5787_20(int x) { return x * 20; }
+inline int f5787_21(int x) { return x * 21; }
+inline int f5787_22(int x) { return x * 22; }
+inline int f5787_23(int x) { return x * 23; }
+inline int f5787_24(int x) { return x * 24; }
+inline int f5787_25(int x) { return x * 25; }
+inline int f5787_26(int x) { return x * 26; }
+inline int f5787_27(int x) { return x * 27; }
+inline int f5787_28(int x) { return x * 28; }
+inline int f5787_29(int x) { return x * 29; }
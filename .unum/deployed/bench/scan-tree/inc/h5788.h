@@ -0,0 +1,42 @@
+#pragma once
+/* header 5788 */
+#include <vector>
+#include "h8367.h"
+#include "h8402.h"
+#include "h5353.h"
+#include "h1012.h"
+#include "h4795.h"
+#ifdef X
+#include "h2016.h"
+#endif
+struct S5788 { int a; const char *s = "x//y"; };
+inline int f5788_0(int x) { return x * 0; }
+inline int f5788_1(int x) { return x * 1; }
+inline int f5788_2(int x) { return x * 2; }
+inline int f5788_3(int x) { return x * 3; }
+inline int f5788_4(int x) { return x * 4; }
+inline int f5788_5(int x) { return x * 5; }
+inline int f5788_6(int x) { return x * 6; }
+inline int f5788_7(int x) { return x * 7; }
+inline int f5788_8(int x) { return x * 8; }
+inline int f5788_9(int x) { return x * 9; }
+inline int f5788_10(int x) { return x * 10; }
+inline int f5788_11(int x) { return x * 11; }
+inline int f5788_12(int x) { return x * 12; }
+inline int f5788_13(int x) { return x * 13; }
+inline int f5788_14(int x) { return x * 14; }
+inline int f5788_15(int x) { return x * 15; }
+inline int f5788_16(int x) { return x * 16; }
+inline int f5788_17(int x) { return x * 17; }
+inline int f5788_18(int x) { return x * 18; }
+inline int f5788_19(int x) { return x * 19; }
+inline int f5788_20(int x) { return x * 20; }
+inline int f5788_21(int x) { return x * 21; }
+inline int f5788_22(int x) { return x * 22; }
+inline int f5788_23(int x) { return x * 23; }
+inline int f5788_24(int x) { return x * 24; }
+inline int f5788_25(int x) { return x * 25; }
+inline int f5788_26(int x) { return x * 26; }
+inline int f5788_27(int x) { return x * 27; }
+inline int f5788_28(int x) { return x * 28; }
+inline int f5788_29(int x) { return x * 29; }
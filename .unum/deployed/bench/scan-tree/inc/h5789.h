@@ -0,0 +1,42 @@
+#pragma once
+/* header 5789 */
+#include <vector>
+#include "h8780.h"
+#include "h3818.h"
+#include "h8150.h"
+#include "h8815.h"
+#include "h6005.h"
+#ifdef X
+#include "h4063.h"
+#endif
+struct S5789 { int a; const char *s = "x//y"; };
+inline int f5789_0(int x) { return x * 0; }
+inline int f5789_1(int x) { return x * 1; }
+inline int f5789_2(int x) { return x * 2; }
+inline int f5789_3(int x) { return x * 3; }
+inline int f5789_4(int x) { return x * 4; }
+inline int f5789_5(int x) { return x * 5; }
+inline int f5789_6(int x) { return x * 6; }
+inline int f5789_7(int x) { return x * 7; }
+inline int f5789_8(int x) { return x * 8; }
+inline int f5789_9(int x) { return x * 9; }
+inline int f5789_10(int x) { return x * 10; }
+inline int f5789_11(int x) { return x * 11; }
+inline int f5789_12(int x) { return x * 12; }
+inline int f5789_13(int x) { return x * 13; }
+inline int f5789_14(int x) { return x * 14; }
+inline int f5789_15(int x) { return x * 15; }
+inline int f5789_16(int x) { return x * 16; }
+inline int f5789_17(int x) { return x * 17; }
+inline int f5789_18(int x) { return x * 18; }
+inline int f5789_19(int x) { return x * 19; }
+inline int f5789_20(int x) { return x * 20; }
+inline int f5789_21(int x) { return x * 21; }
+inline int f5789_22(int x) { return x * 22; }
+inline int f5789_23(int x) { return x * 23; }
+inline int f5789_24(int x) { return x * 24; }
+inline int f5789_25(int x) { return x * 25; }
+inline int f5789_26(int x) { return x * 26; }
+inline int f5789_27(int x) { return x * 27; }
+inline int f5789_28(int x) { return x * 28; }
+inline int f5789_29(int x) { return x * 29; }
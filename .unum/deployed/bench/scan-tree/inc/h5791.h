@@ -0,0 +1,42 @@
+#pragma once
+/* header 5791 */
+#include <vector>
+#include "h1070.h"
+#include "h6357.h"
+#include "h6302.h"
+#include "h1627.h"
+#include "h3820.h"
+#ifdef X
+#include "h4742.h"
+#endif
+struct S5791 { int a; const char *s = "x//y"; };
+inline int f5791_0(int x) { return x * 0; }
+inline int f5791_1(int x) { return x * 1; }
+inline int f5791_2(int x) { return x * 2; }
+inline int f5791_3(int x) { return x * 3; }
+inline int f5791_4(int x) { return x * 4; }
+inline int f5791_5(int x) { return x * 5; }
+inline int f5791_6(int x) { return x * 6; }
+inline int f5791_7(int x) { return x * 7; }
+inline int f5791_8(int x) { return x * 8; }
+inline int f5791_9(int x) { return x * 9; }
+inline int f5791_10(int x) { return x * 10; }
+inline int f5791_11(int x) { return x * 11; }
+inline int f5791_12(int x) { return x * 12; }
+inline int f5791_13(int x) { return x * 13; }
+inline int f5791_14(int x) { return x * 14; }
+inline int f5791_15(int x) { return x * 15; }
+inline int f5791_16(int x) { return x * 16; }
+inline int f5791_17(int x) { return x * 17; }
+inline int f5791_18(int x) { return x * 18; }
+inline int f5791_19(int x) { return x * 19; }
+inline int f5791_20(int x) { return x * 20; }
+inline int f5791_21(int x) { return x * 21; }
+inline int f5791_22(int x) { return x * 22; }
+inline int f5791_23(int x) { return x * 23; }
+inline int f5791_24(int x) { return x * 24; }
+inline int f5791_25(int x) { return x * 25; }
+inline int f5791_26(int x) { return x * 26; }
+inline int f5791_27(int x) { return x * 27; }
+inline int f5791_28(int x) { return x * 28; }
+inline int f5791_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5796 */
+#include <vector>
+#include "h7208.h"
+#include "h4028.h"
+#include "h2.h"
+#include "h6192.h"
+#include "h3844.h"
+#ifdef X
+#include "h6766.h"
+#endif
+struct S5796 { int a; const char *s = "x//y"; };
+inline int f5796_0(int x) { return x * 0; }
+inline int f5796_1(int x) { return x * 1; }
+inline int f5796_2(int x) { return x * 2; }
+inline int f5796_3(int x) { return x * 3; }
+inline int f5796_4(int x) { return x * 4; }
+inline int f5796_5(int x) { return x * 5; }
+inline int f5796_6(int x) { return x * 6; }
+inline int f5796_7(int x) { return x * 7; }
+inline int f5796_8(int x) { return x * 8; }
+inline int f5796_9(int x) { return x * 9; }
+inline int f5796_10(int x) { return x * 10; }
+inline int f5796_11(int x) { return x * 11; }
+inline int f5796_12(int x) { return x * 12; }
+inline int f5796_13(int x) { return x * 13; }
+inline int f5796_14(int x) { return x * 14; }
+inline int f5796_15(int x) { return x * 15; }
+inline int f5796_16(int x) { return x * 16; }
+inline int f5796_17(int x) { return x * 17; }
+inline int f5796_18(int x) { return x * 18; }
+inline int f5796_19(int x) { return x * 19; }
+inline int f5796_20(int x) { return x * 20; }
+inline int f5796_21(int x) { return x * 21; }
+inline int f5796_22(int x) { return x * 22; }
+inline int f5796_23(int x) { return x * 23; }
+inline int f5796_24(int x) { return x * 24; }
+inline int f5796_25(int x) { return x * 25; }
+inline int f5796_26(int x) { return x * 26; }
+inline int f5796_27(int x) { return x * 27; }
+inline int f5796_28(int x) { return x * 28; }
+inline int f5796_29(int x) { return x * 29; }
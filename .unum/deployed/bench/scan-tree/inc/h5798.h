@@ -0,0 +1,42 @@
+#pragma once
+/* header 5798 */
+#include <vector>
+#include "h9784.h"
+#include "h5793.h"
+#include "h4736.h"
+#include "h2851.h"
+#include "h2498.h"
+#ifdef X
+#include "h5007.h"
+#endif
+struct S5798 { int a; const char *s = "x//y"; };
+inline int f5798_0(int x) { return x * 0; }
+inline int f5798_1(int x) { return x * 1; }
+inline int f5798_2(int x) { return x * 2; }
+inline int f5798_3(int x) { return x * 3; }
+inline int f5798_4(int x) { return x * 4; }
+inline int f5798_5(int x) { return x * 5; }
+inline int f5798_6(int x) { return x * 6; }
+inline int f5798_7(int x) { return x * 7; }
+inline int f5798_8(int x) { return x * 8; }
+inline int f5798_9(int x) { return x * 9; }
+inline int f5798_10(int x) { return x * 10; }
+inline int f5798_11(int x) { return x * 11; }
+inline int f5798_12(int x) { return x * 12; }
+inline int f5798_13(int x) { return x * 13; }
+inline int f5798_14(int x) { return x * 14; }
+inline int f5798_15(int x) { return x * 15; }
+inline int f5798_16(int x) { return x * 16; }
+inline int f5798_17(int x) { return x * 17; }
+inline int f5798_18(int x) { return x * 18; }
+inline int f5798_19(int x) { return x * 19; }
+inline int f5798_20(int x) { return x * 20; }
+inline int f5798_21(int x) { return x * 21; }
+inline int f5798_22(int x) { return x * 22; }
+inline int f5798_23(int x) { return x * 23; }
+inline int f5798_24(int x) { return x * 24; }
+inline int f5798_25(int x) { return x * 25; }
+inline int f5798_26(int x) { return x * 26; }
+inline int f5798_27(int x) { return x * 27; }
+inline int f5798_28(int x) { return x * 28; }
+inline int f5798_29(int x) { return x * 29; }
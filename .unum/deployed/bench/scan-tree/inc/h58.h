@@ -0,0 +1,42 @@
+#pragma once
+/* header 58 */
+#include <vector>
+#include "h3560.h"
+#include "h9252.h"
+#include "h7180.h"
+#include "h3520.h"
+#include "h2590.h"
+#ifdef X
+#include "h6191.h"
+#endif
+struct S58 { int a; const char *s = "x//y"; };
+inline int f58_0(int x) { return x * 0; }
+inline int f58_1(int x) { return x * 1; }
+inline int f58_2(int x) { return x * 2; }
+inline int f58_3(int x) { return x * 3; }
+inline int f58_4(int x) { return x * 4; }
+inline int f58_5(int x) { return x * 5; }
+inline int f58_6(int x) { return x * 6; }
+inline int f58_7(int x) { return x * 7; }
+inline int f58_8(int x) { return x * 8; }
+inline int f58_9(int x) { return x * 9; }
+inline int f58_10(int x) { return x * 10; }
+inline int f58_11(int x) { return x * 11; }
+inline int f58_12(int x) { return x * 12; }
+inline int f58_13(int x) { return x * 13; }
+inline int f58_14(int x) { return x * 14; }
+inline int f58_15(int x) { return x * 15; }
+inline int f58_16(int x) { return x * 16; }
+inline int f58_17(int x) { return x * 17; }
+inline int f58_18(int x) { return x * 18; }
+inline int f58_19(int x) { return x * 19; }
+inline int f58_20(int x) { return x * 20; }
+inline int f58_21(int x) { return x * 21; }
+inline int f58_22(int x) { return x * 22; }
+inline int f58_23(int x) { return x * 23; }
+inline int f58_24(int x) { return x * 24; }
+inline int f58_25(int x) { return x * 25; }
+inline int f58_26(int x) { return x * 26; }
+inline int f58_27(int x) { return x * 27; }
+inline int f58_28(int x) { return x * 28; }
+inline int f58_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5800 */
+#include <vector>
+#include "h3931.h"
+#include "h408.h"
+#include "h443.h"
+#include "h2839.h"
+#include "h2133.h"
+#ifdef X
+#include "h4587.h"
+#endif
+struct S5800 { int a; const char *s = "x//y"; };
+inline int f5800_0(int x) { return x * 0; }
+inline int f5800_1(int x) { return x * 1; }
+inline int f5800_2(int x) { return x * 2; }
+inline int f5800_3(int x) { return x * 3; }
+inline int f5800_4(int x) { return x * 4; }
+inline int f5800_5(int x) { return x * 5; }
+inline int f5800_6(int x) { return x * 6; }
+inline int f5800_7(int x) { return x * 7; }
+inline int f5800_8(int x) { return x * 8; }
+inline int f5800_9(int x) { return x * 9; }
+inline int f5800_10(int x) { return x * 10; }
+inline int f5800_11(int x) { return x * 11; }
+inline int f5800_12(int x) { return x * 12; }
+inline int f5800_13(int x) { return x * 13; }
+inline int f5800_14(int x) { return x * 14; }
+inline int f5800_15(int x) { return x * 15; }
+inline int f5800_16(int x) { return x * 16; }
+inline int f5800_17(int x) { return x * 17; }
+inline int f5800_18(int x) { return x * 18; }
+inline int f5800_19(int x) { return x * 19; }
+inline int f5800_20(int x) { return x * 20; }
+inline int f5800_21(int x) { return x * 21; }
+inline int f5800_22(int x) { return x * 22; }
+inline int f5800_23(int x) { return x * 23; }
+inline int f5800_24(int x) { return x * 24; }
+inline int f5800_25(int x) { return x * 25; }
+inline int f5800_26(int x) { return x * 26; }
+inline int f5800_27(int x) { return x * 27; }
+inline int f5800_28(int x) { return x * 28; }
+inline int f5800_29(int x) { return x * 29; }
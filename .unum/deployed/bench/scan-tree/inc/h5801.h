@@ -0,0 +1,42 @@
+#pragma once
+/* header 5801 */
+#include <vector>
+#include "h8096.h"
+#include "h4936.h"
+#include "h2481.h"
+#include "h1959.h"
+#include "h9390.h"
+#ifdef X
+#include "h9082.h"
+#endif
+struct S5801 { int a; const char *s = "x//y"; };
+inline int f5801_0(int x) { return x * 0; }
+inline int f5801_1(int x) { return x * 1; }
+inline int f5801_2(int x) { return x * 2; }
+inline int f5801_3(int x) { return x * 3; }
+inline int f5801_4(int x) { return x * 4; }
+inline int f5801_5(int x) { return x * 5; }
+inline int f5801_6(int x) { return x * 6; }
+inline int f5801_7(int x) { return x * 7; }
+inline int f5801_8(int x) { return x * 8; }
+inline int f5801_9(int x) { return x * 9; }
+inline int f5801_10(int x) { return x * 10; }
+inline int f5801_11(int x) { return x * 11; }
+inline int f5801_12(int x) { return x * 12; }
+inline int f5801_13(int x) { return x * 13; }
+inline int f5801_14(int x) { return x * 14; }
+inline int f5801_15(int x) { return x * 15; }
+inline int f5801_16(int x) { return x * 16; }
+inline int f5801_17(int x) { return x * 17; }
+inline int f5801_18(int x) { return x * 18; }
+inline int f5801_19(int x) { return x * 19; }
+inline int f5801_20(int x) { return x * 20; }
+inline int f5801_21(int x) { return x * 21; }
+inline int f5801_22(int x) { return x * 22; }
+inline int f5801_23(int x) { return x * 23; }
+inline int f5801_24(int x) { return x * 24; }
+inline int f5801_25(int x) { return x * 25; }
+inline int f5801_26(int x) { return x * 26; }
+inline int f5801_27(int x) { return x * 27; }
+inline int f5801_28(int x) { return x * 28; }
+inline int f5801_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5802 */
+#include <vector>
+#include "h7099.h"
+#include "h2966.h"
+#include "h6341.h"
+#include "h6124.h"
+#include "h3579.h"
+#ifdef X
+#include "h5269.h"
+#endif
+struct S5802 { int a; const char *s = "x//y"; };
+inline int f5802_0(int x) { return x * 0; }
+inline int f5802_1(int x) { return x * 1; }
+inline int f5802_2(int x) { return x * 2; }
+inline int f5802_3(int x) { return x * 3; }
+inline int f5802_4(int x) { return x * 4; }
+inline int f5802_5(int x) { return x * 5; }
+inline int f5802_6(int x) { return x * 6; }
+inline int f5802_7(int x) { return x * 7; }
+inline int f5802_8(int x) { return x * 8; }
+inline int f5802_9(int x) { return x * 9; }
+inline int f5802_10(int x) { return x * 10; }
+inline int f5802_11(int x) { return x * 11; }
+inline int f5802_12(int x) { return x * 12; }
+inline int f5802_13(int x) { return x * 13; }
+inline int f5802_14(int x) { return x * 14; }
+inline int f5802_15(int x) { return x * 15; }
+inline int f5802_16(int x) { return x * 16; }
+inline int f5802_17(int x) { return x * 17; }
+inline int f5802_18(int x) { return x * 18; }
+inline int f5802_19(int x) { return x * 19; }
+inline int f5802_20(int x) { return x * 20; }
+inline int f5802_21(int x) { return x * 21; }
+inline int f5802_22(int x) { return x * 22; }
+inline int f5802_23(int x) { return x * 23; }
+inline int f5802_24(int x) { return x * 24; }
+inline int f5802_25(int x) { return x * 25; }
+inline int f5802_26(int x) { return x * 26; }
+inline int f5802_27(int x) { return x * 27; }
+inline int f5802_28(int x) { return x * 28; }
+inline int f5802_29(int x) { return x * 29; }
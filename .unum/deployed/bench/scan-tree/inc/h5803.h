@@ -0,0 +1,42 @@
+#pragma once
+/* header 5803 */
+#include <vector>
+#include "h5042.h"
+#include "h8474.h"
+#include "h4838.h"
+#include "h7017.h"
+#include "h1916.h"
+#ifdef X
+#include "h5908.h"
+#endif
+struct S5803 { int a; const char *s = "x//y"; };
+inline int f5803_0(int x) { return x * 0; }
+inline int f5803_1(int x) { return x * 1; }
+inline int f5803_2(int x) { return x * 2; }
+inline int f5803_3(int x) { return x * 3; }
+inline int f5803_4(int x) { return x * 4; }
+inline int f5803_5(int x) { return x * 5; }
+inline int f5803_6(int x) { return x * 6; }
+inline int f5803_7(int x) { return x * 7; }
+inline int f5803_8(int x) { return x * 8; }
+inline int f5803_9(int x) { return x * 9; }
+inline int f5803_10(int x) { return x * 10; }
+inline int f5803_11(int x) { return x * 11; }
+inline int f5803_12(int x) { return x * 12; }
+inline int f5803_13(int x) { return x * 13; }
+inline int f5803_14(int x) { return x * 14; }
+inline int f5803_15(int x) { return x * 15; }
+inline int f5803_16(int x) { return x * 16; }
+inline int f5803_17(int x) { return x * 17; }
+inline int f5803_18(int x) { return x * 18; }
+inline int f5803_19(int x) { return x * 19; }
+inline int f5803_20(int x) { return x * 20; }
+inline int f5803_21(int x) { return x * 21; }
+inline int f5803_22(int x) { return x * 22; }
+inline int f5803_23(int x) { return x * 23; }
+inline int f5803_24(int x) { return x * 24; }
+inline int f5803_25(int x) { return x * 25; }
+inline int f5803_26(int x) { return x * 26; }
+inline int f5803_27(int x) { return x * 27; }
+inline int f5803_28(int x) { return x * 28; }
+inline int f5803_29(int x) { return x * 29; }
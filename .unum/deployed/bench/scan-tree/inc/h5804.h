@@ -0,0 +1,42 @@
+#pragma once
+/* header 5804 */
+#include <vector>
+#include "h119.h"
+#include "h38.h"
+#include "h3080.h"
+#include "h4954.h"
+#include "h277.h"
+#ifdef X
+#include "h6867.h"
+#endif
+struct S5804 { int a; const char *s = "x//y"; };
+inline int f5804_0(int x) { return x * 0; }
+inline int f5804_1(int x) { return x * 1; }
+inline int f5804_2(int x) { return x * 2; }
+inline int f5804_3(int x) { return x * 3; }
+inline int f5804_4(int x) { return x * 4; }
+inline int f5804_5(int x) { return x * 5; }
+inline int f5804_6(int x) { return x * 6; }
+inline int f5804_7(int x) { return x * 7; }
+inline int f5804_8(int x) { return x * 8; }
+inline int f5804_9(int x) { return x * 9; }
+inline int f5804_10(int x) { return x * 10; }
+inline int f5804_11(int x) { return x * 11; }
+inline int f5804_12(int x) { return x * 12; }
+inline int f5804_13(int x) { return x * 13; }
+inline int f5804_14(int x) { return x * 14; }
+inline int f5804_15(int x) { return x * 15; }
+inline int f5804_16(int x) { return x * 16; }
+inline int f5804_17(int x) { return x * 17; }
+inline int f5804_18(int x) { return x * 18; }
+inline int f5804_19(int x) { return x * 19; }
+inline int f5804_20(int x) { return x * 20; }
+inline int f5804_21(int x) { return x * 21; }
+inline int f5804_22(int x) { return x * 22; }
+inline int f5804_23(int x) { return x * 23; }
+inline int f5804_24(int x) { return x * 24; }
+inline int f5804_25(int x) { return x * 25; }
+inline int f5804_26(int x) { return x * 26; }
+inline int f5804_27(int x) { return x * 27; }
+inline int f5804_28(int x) { return x * 28; }
+inline int f5804_29(int x) { return x * 29; }
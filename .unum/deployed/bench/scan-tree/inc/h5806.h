@@ -0,0 +1,42 @@
+#pragma once
+/* header 5806 */
+#include <vector>
+#include "h6585.h"
+#include "h1492.h"
+#include "h5377.h"
+#include "h4098.h"
+#include "h9863.h"
+#ifdef X
+#include "h2555.h"
+#endif
+struct S5806 { int a; const char *s = "x//y"; };
+inline int f5806_0(int x) { return x * 0; }
+inline int f5806_1(int x) { return x * 1; }
+inline int f5806_2(int x) { return x * 2; }
+inline int f5806_3(int x) { return x * 3; }
+inline int f5806_4(int x) { return x * 4; }
+inline int f5806_5(int x) { return x * 5; }
+inline int f5806_6(int x) { return x * 6; }
+inline int f5806_7(int x) { return x * 7; }
+inline int f5806_8(int x) { return x * 8; }
+inline int f5806_9(int x) { return x * 9; }
+inline int f5806_10(int x) { return x * 10; }
+inline int f5806_11(int x) { return x * 11; }
+inline int f5806_12(int x) { return x * 12; }
+inline int f5806_13(int x) { return x * 13; }
+inline int f5806_14(int x) { return x * 14; }
+inline int f5806_15(int x) { return x * 15; }
+inline int f5806_16(int x) { return x * 16; }
+inline int f5806_17(int x) { return x * 17; }
+inline int f5806_18(int x) { return x * 18; }
+inline int f5806_19(int x) { return x * 19; }
+inline int f5806_20(int x) { return x * 20; }
+inline int f5806_21(int x) { return x * 21; }
+inline int f5806_22(int x) { return x * 22; }
+inline int f5806_23(int x) { return x * 23; }
+inline int f5806_24(int x) { return x * 24; }
+inline int f5806_25(int x) { return x * 25; }
+inline int f5806_26(int x) { return x * 26; }
+inline int f5806_27(int x) { return x * 27; }
+inline int f5806_28(int x) { return x * 28; }
+inline int f5806_29(int x) { return x * 29; }
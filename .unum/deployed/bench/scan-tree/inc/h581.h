@@ -0,0 +1,42 @@
+#pragma once
+/* header 581 */
+#include <vector>
+#include "h8035.h"
+#include "h6989.h"
+#include "h2201.h"
+#include "h2473.h"
+#include "h270.h"
+#ifdef X
+#include "h6699.h"
+#endif
+struct S581 { int a; const char *s = "x//y"; };
+inline int f581_0(int x) { return x * 0; }
+inline int f581_1(int x) { return x * 1; }
+inline int f581_2(int x) { return x * 2; }
+inline int f581_3(int x) { return x * 3; }
+inline int f581_4(int x) { return x * 4; }
+inline int f581_5(int x) { return x * 5; }
+inline int f581_6(int x) { return x * 6; }
+inline int f581_7(int x) { return x * 7; }
+inline int f581_8(int x) { return x * 8; }
+inline int f581_9(int x) { return x * 9; }
+inline int f581_10(int x) { return x * 10; }
+inline int f581_11(int x) { return x * 11; }
+inline int f581_12(int x) { return x * 12; }
+inline int f581_13(int x) { return x * 13; }
+inline int f581_14(int x) { return x * 14; }
+inline int f581_15(int x) { return x * 15; }
+inline int f581_16(int x) { return x * 16; }
+inline int f581_17(int x) { return x * 17; }
+inline int f581_18(int x) { return x * 18; }
+inline int f581_19(int x) { return x * 19; }
+inline int f581_20(int x) { return x * 20; }
+inline int f581_21(int x) { return x * 21; }
+inline int f581_22(int x) { return x * 22; }
+inline int f581_23(int x) { return x * 23; }
+inline int f581_24(int x) { return x * 24; }
+inline int f581_25(int x) { return x * 25; }
+inline int f581_26(int x) { return x * 26; }
+inline int f581_27(int x) { return x * 27; }
+inline int f581_28(int x) { return x * 28; }
+inline int f581_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5815 */
+#include <vector>
+#include "h8539.h"
+#include "h2795.h"
+#include "h5103.h"
+#include "h7757.h"
+#include "h8990.h"
+#ifdef X
+#include "h1793.h"
+#endif
+struct S5815 { int a; const char *s = "x//y"; };
+inline int f5815_0(int x) { return x * 0; }
+inline int f5815_1(int x) { return x * 1; }
+inline int f5815_2(int x) { return x * 2; }
+inline int f5815_3(int x) { return x * 3; }
+inline int f5815_4(int x) { return x * 4; }
+inline int f5815_5(int x) { return x * 5; }
+inline int f5815_6(int x) { return x * 6; }
+inline int f5815_7(int x) { return x * 7; }
+inline int f5815_8(int x) { return x * 8; }
+inline int f5815_9(int x) { return x * 9; }
+inline int f5815_10(int x) { return x * 10; }
+inline int f5815_11(int x) { return x * 11; }
+inline int f5815_12(int x) { return x * 12; }
+inline int f5815_13(int x) { return x * 13; }
+inline int f5815_14(int x) { return x * 14; }
+inline int f5815_15(int x) { return x * 15; }
+inline int f5815_16(int x) { return x * 16; }
+inline int f5815_17(int x) { return x * 17; }
+inline int f5815_18(int x) { return x * 18; }
+inline int f5815_19(int x) { return x * 19; }
+inline int f5815_20(int x) { return x * 20; }
+inline int f5815_21(int x) { return x * 21; }
+inline int f5815_22(int x) { return x * 22; }
+inline int f5815_23(int x) { return x * 23; }
+inline int f5815_24(int x) { return x * 24; }
+inline int f5815_25(int x) { return x * 25; }
+inline int f5815_26(int x) { return x * 26; }
+inline int f5815_27(int x) { return x * 27; }
+inline int f5815_28(int x) { return x * 28; }
+inline int f5815_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5818 */
+#include <vector>
+#include "h6833.h"
+#include "h2157.h"
+#include "h4090.h"
+#include "h1994.h"
+#include "h598.h"
+#ifdef X
+#include "h2117.h"
+#endif
+struct S5818 { int a; const char *s = "x//y"; };
+inline int f5818_0(int x) { return x * 0; }
+inline int f5818_1(int x) { return x * 1; }
+inline int f5818_2(int x) { return x * 2; }
+inline int f5818_3(int x) { return x * 3; }
+inline int f5818_4(int x) { return x * 4; }
+inline int f5818_5(int x) { return x * 5; }
+inline int f5818_6(int x) { return x * 6; }
+inline int f5818_7(int x) { return x * 7; }
+inline int f5818_8(int x) { return x * 8; }
+inline int f5818_9(int x) { return x * 9; }
+inline int f5818_10(int x) { return x * 10; }
+inline int f5818_11(int x) { return x * 11; }
+inline int f5818_12(int x) { return x * 12; }
+inline int f5818_13(int x) { return x * 13; }
+inline int f5818_14(int x) { return x * 14; }
+inline int f5818_15(int x) { return x * 15; }
+inline int f5818_16(int x) { return x * 16; }
+inline int f5818_17(int x) { return x * 17; }
+inline int f5818_18(int x) { return x * 18; }
+inline int f5818_19(int x) { return x * 19; }
+inline int f5818_20(int x) { return x * 20; }
+inline int f5818_21(int x) { return x * 21; }
+inline int f5818_22(int x) { return x * 22; }
+inline int f5818_23(int x) { return x * 23; }
+inline int f5818_24(int x) { return x * 24; }
+inline int f5818_25(int x) { return x * 25; }
+inline int f5818_26(int x) { return x * 26; }
+inline int f5818_27(int x) { return x * 27; }
+inline int f5818_28(int x) { return x * 28; }
+inline int f5818_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5819 */
+#include <vector>
+#include "h877.h"
+#include "h4649.h"
+#include "h8844.h"
+#include "h7480.h"
+#include "h534.h"
+#ifdef X
+#include "h144.h"
+#endif
+struct S5819 { int a; const char *s = "x//y"; };
+inline int f5819_0(int x) { return x * 0; }
+inline int f5819_1(int x) { return x * 1; }
+inline int f5819_2(int x) { return x * 2; }
+inline int f5819_3(int x) { return x * 3; }
+inline int f5819_4(int x) { return x * 4; }
+inline int f5819_5(int x) { return x * 5; }
+inline int f5819_6(int x) { return x * 6; }
+inline int f5819_7(int x) { return x * 7; }
+inline int f5819_8(int x) { return x * 8; }
+inline int f5819_9(int x) { return x * 9; }
+inline int f5819_10(int x) { return x * 10; }
+inline int f5819_11(int x) { return x * 11; }
+inline int f5819_12(int x) { return x * 12; }
+inline int f5819_13(int x) { return x * 13; }
+inline int f5819_14(int x) { return x * 14; }
+inline int f5819_15(int x) { return x * 15; }
+inline int f5819_16(int x) { return x * 16; }
+inline int f5819_17(int x) { return x * 17; }
+inline int f5819_18(int x) { return x * 18; }
+inline int f5819_19(int x) { return x * 19; }
+inline int f5819_20(int x) { return x * 20; }
+inline int f5819_21(int x) { return x * 21; }
+inline int f5819_22(int x) { return x * 22; }
+inline int f5819_23(int x) { return x * 23; }
+inline int f5819_24(int x) { return x * 24; }
+inline int f5819_25(int x) { return x * 25; }
+inline int f5819_26(int x) { return x * 26; }
+inline int f5819_27(int x) { return x * 27; }
+inline int f5819_28(int x) { return x * 28; }
+inline int f5819_29(int x) { return x * 29; }
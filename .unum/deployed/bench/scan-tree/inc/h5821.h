@@ -0,0 +1,42 @@
+#pragma once
+/* header 5821 */
+#include <vector>
+#include "h7405.h"
+#include "h5942.h"
+#include "h7082.h"
+#include "h8735.h"
+#include "h9085.h"
+#ifdef X
+#include "h2763.h"
+#endif
+struct S5821 { int a; const char *s = "x//y"; };
+inline int f5821_0(int x) { return x * 0; }
+inline int f5821_1(int x) { return x * 1; }
+inline int f5821_2(int x) { return x * 2; }
+inline int f5821_3(int x) { return x * 3; }
+inline int f5821_4(int x) { return x * 4; }
+inline int f5821_5(int x) { return x * 5; }
+inline int f5821_6(int x) { return x * 6; }
+inline int f5821_7(int x) { return x * 7; }
+inline int f5821_8(int x) { return x * 8; }
+inline int f5821_9(int x) { return x * 9; }
+inline int f5821_10(int x) { return x * 10; }
+inline int f5821_11(int x) { return x * 11; }
+inline int f5821_12(int x) { return x * 12; }
+inline int f5821_13(int x) { return x * 13; }
+inline int f5821_14(int x) { return x * 14; }
+inline int f5821_15(int x) { return x * 15; }
+inline int f5821_16(int x) { return x * 16; }
+inline int f5821_17(int x) { return x * 17; }
+inline int f5821_18(int x) { return x * 18; }
+inline int f5821_19(int x) { return x * 19; }
+inline int f5821_20(int x) { return x * 20; }
+inline int f5821_21(int x) { return x * 21; }
+inline int f5821_22(int x) { return x * 22; }
+inline int f5821_23(int x) { return x * 23; }
+inline int f5821_24(int x) { return x * 24; }
+inline int f5821_25(int x) { return x * 25; }
+inline int f5821_26(int x) { return x * 26; }
+inline int f5821_27(int x) { return x * 27; }
+inline int f5821_28(int x) { return x * 28; }
+inline int f5821_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5823 */
+#include <vector>
+#include "h6338.h"
+#include "h8745.h"
+#include "h6058.h"
+#include "h9196.h"
+#include "h1889.h"
+#ifdef X
+#include "h8026.h"
+#endif
+struct S5823 { int a; const char *s = "x//y"; };
+inline int f5823_0(int x) { return x * 0; }
+inline int f5823_1(int x) { return x * 1; }
+inline int f5823_2(int x) { return x * 2; }
+inline int f5823_3(int x) { return x * 3; }
+inline int f5823_4(int x) { return x * 4; }
+inline int f5823_5(int x) { return x * 5; }
+inline int f5823_6(int x) { return x * 6; }
+inline int f5823_7(int x) { return x * 7; }
+inline int f5823_8(int x) { return x * 8; }
+inline int f5823_9(int x) { return x * 9; }
+inline int f5823_10(int x) { return x * 10; }
+inline int f5823_11(int x) { return x * 11; }
+inline int f5823_12(int x) { return x * 12; }
+inline int f5823_13(int x) { return x * 13; }
+inline int f5823_14(int x) { return x * 14; }
+inline int f5823_15(int x) { return x * 15; }
+inline int f5823_16(int x) { return x * 16; }
+inline int f5823_17(int x) { return x * 17; }
+inline int f5823_18(int x) { return x * 18; }
+inline int f5823_19(int x) { return x * 19; }
+inline int f5823_20(int x) { return x * 20; }
+inline int f5823_21(int x) { return x * 21; }
+inline int f5823_22(int x) { return x * 22; }
+inline int f5823_23(int x) { return x * 23; }
+inline int f5823_24(int x) { return x * 24; }
+inline int f5823_25(int x) { return x * 25; }
+inline int f5823_26(int x) { return x * 26; }
+inline int f5823_27(int x) { return x * 27; }
+inline int f5823_28(int x) { return x * 28; }
+inline int f5823_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5824 */
+#include <vector>
+#include "h9732.h"
+#include "h3557.h"
+#include "h668.h"
+#include "h7294.h"
+#include "h5108.h"
+#ifdef X
+#include "h7015.h"
+#endif
+struct S5824 { int a; const char *s = "x//y"; };
+inline int f5824_0(int x) { return x * 0; }
+inline int f5824_1(int x) { return x * 1; }
+inline int f5824_2(int x) { return x * 2; }
+inline int f5824_3(int x) { return x * 3; }
+inline int f5824_4(int x) { return x * 4; }
+inline int f5824_5(int x) { return x * 5; }
+inline int f5824_6(int x) { return x * 6; }
+inline int f5824_7(int x) { return x * 7; }
+inline int f5824_8(int x) { return x * 8; }
+inline int f5824_9(int x) { return x * 9; }
+inline int f5824_10(int x) { return x * 10; }
+inline int f5824_11(int x) { return x * 11; }
+inline int f5824_12(int x) { return x * 12; }
+inline int f5824_13(int x) { return x * 13; }
+inline int f5824_14(int x) { return x * 14; }
+inline int f5824_15(int x) { return x * 15; }
+inline int f5824_16(int x) { return x * 16; }
+inline int f5824_17(int x) { return x * 17; }
+inline int f5824_18(int x) { return x * 18; }
+inline int f5824_19(int x) { return x * 19; }
+inline int f5824_20(int x) { return x * 20; }
+inline int f5824_21(int x) { return x * 21; }
+inline int f5824_22(int x) { return x * 22; }
+inline int f5824_23(int x) { return x * 23; }
+inline int f5824_24(int x) { return x * 24; }
+inline int f5824_25(int x) { return x * 25; }
+inline int f5824_26(int x) { return x * 26; }
+inline int f5824_27(int x) { return x * 27; }
+inline int f5824_28(int x) { return x * 28; }
+inline int f5824_29(int x) { return x * 29; }
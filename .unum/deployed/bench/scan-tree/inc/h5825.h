@@ -0,0 +1,42 @@
+#pragma once
+/* header 5825 */
+#include <vector>
+#include "h9720.h"
+#include "h8344.h"
+#include "h9596.h"
+#include "h8810.h"
+#include "h4867.h"
+#ifdef X
+#include "h2590.h"
+#endif
+struct S5825 { int a; const char *s = "x//y"; };
+inline int f5825_0(int x) { return x * 0; }
+inline int f5825_1(int x) { return x * 1; }
+inline int f5825_2(int x) { return x * 2; }
+inline int f5825_3(int x) { return x * 3; }
+inline int f5825_4(int x) { return x * 4; }
+inline int f5825_5(int x) { return x * 5; }
+inline int f5825_6(int x) { return x * 6; }
+inline int f5825_7(int x) { return x * 7; }
+inline int f5825_8(int x) { return x * 8; }
+inline int f5825_9(int x) { return x * 9; }
+inline int f5825_10(int x) { return x * 10; }
+inline int f5825_11(int x) { return x * 11; }
+inline int f5825_12(int x) { return x * 12; }
+inline int f5825_13(int x) { return x * 13; }
+inline int f5825_14(int x) { return x * 14; }
+inline int f5825_15(int x) { return x * 15; }
+inline int f5825_16(int x) { return x * 16; }
+inline int f5825_17(int x) { return x * 17; }
+inline int f5825_18(int x) { return x * 18; }
+inline int f5825_19(int x) { return x * 19; }
+inline int f5825_20(int x) { return x * 20; }
+inline int f5825_21(int x) { return x * 21; }
+inline int f5825_22(int x) { return x * 22; }
+inline int f5825_23(int x) { return x * 23; }
+inline int f5825_24(int x) { return x * 24; }
+inline int f5825_25(int x) { return x * 25; }
+inline int f5825_26(int x) { return x * 26; }
+inline int f5825_27(int x) { return x * 27; }
+inline int f5825_28(int x) { return x * 28; }
+inline int f5825_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5826 */
+#include <vector>
+#include "h6034.h"
+#include "h7116.h"
+#include "h9458.h"
+#include "h485.h"
+#include "h9164.h"
+#ifdef X
+#include "h9840.h"
+#endif
+struct S5826 { int a; const char *s = "x//y"; };
+inline int f5826_0(int x) { return x * 0; }
+inline int f5826_1(int x) { return x * 1; }
+inline int f5826_2(int x) { return x * 2; }
+inline int f5826_3(int x) { return x * 3; }
+inline int f5826_4(int x) { return x * 4; }
+inline int f5826_5(int x) { return x * 5; }
+inline int f5826_6(int x) { return x * 6; }
+inline int f5826_7(int x) { return x * 7; }
+inline int f5826_8(int x) { return x * 8; }
+inline int f5826_9(int x) { return x * 9; }
+inline int f5826_10(int x) { return x * 10; }
+inline int f5826_11(int x) { return x * 11; }
+inline int f5826_12(int x) { return x * 12; }
+inline int f5826_13(int x) { return x * 13; }
+inline int f5826_14(int x) { return x * 14; }
+inline int f5826_15(int x) { return x * 15; }
+inline int f5826_16(int x) { return x * 16; }
+inline int f5826_17(int x) { return x * 17; }
+inline int f5826_18(int x) { return x * 18; }
+inline int f5826_19(int x) { return x * 19; }
+inline int f5826_20(int x) { return x * 20; }
+inline int f5826_21(int x) { return x * 21; }
+inline int f5826_22(int x) { return x * 22; }
+inline int f5826_23(int x) { return x * 23; }
+inline int f5826_24(int x) { return x * 24; }
+inline int f5826_25(int x) { return x * 25; }
+inline int f5826_26(int x) { return x * 26; }
+inline int f5826_27(int x) { return x * 27; }
+inline int f5826_28(int x) { return x * 28; }
+inline int f5826_29(int x) { return x * 29; }
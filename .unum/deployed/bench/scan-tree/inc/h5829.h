@@ -0,0 +1,42 @@
+#pragma once
+/* header 5829 */
+#include <vector>
+#include "h237.h"
+#include "h694.h"
+#include "h5860.h"
+#include "h9826.h"
+#include "h7935.h"
+#ifdef X
+#include "h4197.h"
+#endif
+struct S5829 { int a; const char *s = "x//y"; };
+inline int f5829_0(int x) { return x * 0; }
+inline int f5829_1(int x) { return x * 1; }
+inline int f5829_2(int x) { return x * 2; }
+inline int f5829_3(int x) { return x * 3; }
+inline int f5829_4(int x) { return x * 4; }
+inline int f5829_5(int x) { return x * 5; }
+inline int f5829_6(int x) { return x * 6; }
+inline int f5829_7(int x) { return x * 7; }
+inline int f5829_8(int x) { return x * 8; }
+inline int f5829_9(int x) { return x * 9; }
+inline int f5829_10(int x) { return x * 10; }
+inline int f5829_11(int x) { return x * 11; }
+inline int f5829_12(int x) { return x * 12; }
+inline int f5829_13(int x) { return x * 13; }
+inline int f5829_14(int x) { return x * 14; }
+inline int f5829_15(int x) { return x * 15; }
+inline int f5829_16(int x) { return x * 16; }
+inline int f5829_17(int x) { return x * 17; }
+inline int f5829_18(int x) { return x * 18; }
+inline int f5829_19(int x) { return x * 19; }
+inline int f5829_20(int x) { return x * 20; }
+inline int f5829_21(int x) { return x * 21; }
+inline int f5829_22(int x) { return x * 22; }
+inline int f5829_23(int x) { return x * 23; }
+inline int f5829_24(int x) { return x * 24; }
+inline int f5829_25(int x) { return x * 25; }
+inline int f5829_26(int x) { return x * 26; }
+inline int f5829_27(int x) { return x * 27; }
+inline int f5829_28(int x) { return x * 28; }
+inline int f5829_29(int x) { return x * 29; }
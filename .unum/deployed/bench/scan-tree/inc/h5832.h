@@ -0,0 +1,42 @@
+#pragma once
+/* header 5832 */
+#include <vector>
+#include "h3459.h"
+#include "h8273.h"
+#include "h2663.h"
+#include "h3451.h"
+#include "h7521.h"
+#ifdef X
+#include "h1475.h"
+#endif
+struct S5832 { int a; const char *s = "x//y"; };
+inline int f5832_0(int x) { return x * 0; }
+inline int f5832_1(int x) { return x * 1; }
+inline int f5832_2(int x) { return x * 2; }
+inline int f5832_3(int x) { return x * 3; }
+inline int f5832_4(int x) { return x * 4; }
+inline int f5832_5(int x) { return x * 5; }
+inline int f5832_6(int x) { return x * 6; }
+inline int f5832_7(int x) { return x * 7; }
+inline int f5832_8(int x) { return x * 8; }
+inline int f5832_9(int x) { return x * 9; }
+inline int f5832_10(int x) { return x * 10; }
+inline int f5832_11(int x) { return x * 11; }
+inline int f5832_12(int x) { return x * 12; }
+inline int f5832_13(int x) { return x * 13; }
+inline int f5832_14(int x) { return x * 14; }
+inline int f5832_15(int x) { return x * 15; }
+inline int f5832_16(int x) { return x * 16; }
+inline int f5832_17(int x) { return x * 17; }
+inline int f5832_18(int x) { return x * 18; }
+inline int f5832_19(int x) { return x * 19; }
+inline int f5832_20(int x) { return x * 20; }
+inline int f5832_21(int x) { return x * 21; }
+inline int f5832_22(int x) { return x * 22; }
+inline int f5832_23(int x) { return x * 23; }
+inline int f5832_24(int x) { return x * 24; }
+inline int f5832_25(int x) { return x * 25; }
+inline int f5832_26(int x) { return x * 26; }
+inline int f5832_27(int x) { return x * 27; }
+inline int f5832_28(int x) { return x * 28; }
+inline int f5832_29(int x) { return x * 29; }
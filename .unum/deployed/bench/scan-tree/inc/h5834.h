@@ -0,0 +1,42 @@
+#pragma once
+/* header 5834 */
+#include <vector>
+#include "h3188.h"
+#include "h9901.h"
+#include "h1111.h"
+#include "h2316.h"
+#include "h1649.h"
+#ifdef X
+#include "h5521.h"
+#endif
+struct S5834 { int a; const char *s = "x//y"; };
+inline int f5834_0(int x) { return x * 0; }
+inline int f5834_1(int x) { return x * 1; }
+inline int f5834_2(int x) { return x * 2; }
+inline int f5834_3(int x) { return x * 3; }
+inline int f5834_4(int x) { return x * 4; }
+inline int f5834_5(int x) { return x * 5; }
+inline int f5834_6(int x) { return x * 6; }
+inline int f5834_7(int x) { return x * 7; }
+inline int f5834_8(int x) { return x * 8; }
+inline int f5834_9(int x) { return x * 9; }
+inline int f5834_10(int x) { return x * 10; }
+inline int f5834_11(int x) { return x * 11; }
+inline int f5834_12(int x) { return x * 12; }
+inline int f5834_13(int x) { return x * 13; }
+inline int f5834_14(int x) { return x * 14; }
+inline int f5834_15(int x) { return x * 15; }
+inline int f5834_16(int x) { return x * 16; }
+inline int f5834_17(int x) { return x * 17; }
+inline int f5834_18(int x) { return x * 18; }
+inline int f5834_19(int x) { return x * 19; }
+inline int f5834_20(int x) { return x * 20; }
+inline int f5834_21(int x) { return x * 21; }
+inline int f5834_22(int x) { return x * 22; }
+inline int f5834_23(int x) { return x * 23; }
+inline int f5834_24(int x) { return x * 24; }
+inline int f5834_25(int x) { return x * 25; }
+inline int f5834_26(int x) { return x * 26; }
+inline int f5834_27(int x) { return x * 27; }
+inline int f5834_28(int x) { return x * 28; }
+inline int f5834_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5837 */
+#include <vector>
+#include "h2476.h"
+#include "h8182.h"
+#include "h6405.h"
+#include "h1597.h"
+#include "h3270.h"
+#ifdef X
+#include "h8970.h"
+#endif
+struct S5837 { int a; const char *s = "x//y"; };
+inline int f5837_0(int x) { return x * 0; }
+inline int f5837_1(int x) { return x * 1; }
+inline int f5837_2(int x) { return x * 2; }
+inline int f5837_3(int x) { return x * 3; }
+inline int f5837_4(int x) { return x * 4; }
+inline int f5837_5(int x) { return x * 5; }
+inline int f5837_6(int x) { return x * 6; }
+inline int f5837_7(int x) { return x * 7; }
+inline int f5837_8(int x) { return x * 8; }
+inline int f5837_9(int x) { return x * 9; }
+inline int f5837_10(int x) { return x * 10; }
+inline int f5837_11(int x) { return x * 11; }
+inline int f5837_12(int x) { return x * 12; }
+inline int f5837_13(int x) { return x * 13; }
+inline int f5837_14(int x) { return x * 14; }
+inline int f5837_15(int x) { return x * 15; }
+inline int f5837_16(int x) { return x * 16; }
+inline int f5837_17(int x) { return x * 17; }
+inline int f5837_18(int x) { return x * 18; }
+inline int f5837_19(int x) { return x * 19; }
+inline int f5837_20(int x) { return x * 20; }
+inline int f5837_21(int x) { return x * 21; }
+inline int f5837_22(int x) { return x * 22; }
+inline int f5837_23(int x) { return x * 23; }
+inline int f5837_24(int x) { return x * 24; }
+inline int f5837_25(int x) { return x * 25; }
+inline int f5837_26(int x) { return x * 26; }
+inline int f5837_27(int x) { return x * 27; }
+inline int f5837_28(int x) { return x * 28; }
+inline int f5837_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5838 */
+#include <vector>
+#include "h1372.h"
+#include "h6198.h"
+#include "h1285.h"
+#include "h6151.h"
+#include "h8574.h"
+#ifdef X
+#include "h1173.h"
+#endif
+struct S5838 { int a; const char *s = "x//y"; };
+inline int f5838_0(int x) { return x * 0; }
+inline int f5838_1(int x) { return x * 1; }
+inline int f5838_2(int x) { return x * 2; }
+inline int f5838_3(int x) { return x * 3; }
+inline int f5838_4(int x) { return x * 4; }
+inline int f5838_5(int x) { return x * 5; }
+inline int f5838_6(int x) { return x * 6; }
+inline int f5838_7(int x) { return x * 7; }
+inline int f5838_8(int x) { return x * 8; }
+inline int f5838_9(int x) { return x * 9; }
+inline int f5838_10(int x) { return x * 10; }
+inline int f5838_11(int x) { return x * 11; }
+inline int f5838_12(int x) { return x * 12; }
+inline int f5838_13(int x) { return x * 13; }
+inline int f5838_14(int x) { return x * 14; }
+inline int f5838_15(int x) { return x * 15; }
+inline int f5838_16(int x) { return x * 16; }
+inline int f5838_17(int x) { return x * 17; }
+inline int f5838_18(int x) { return x * 18; }
+inline int f5838_19(int x) { return x * 19; }
+inline int f5838_20(int x) { return x * 20; }
+inline int f5838_21(int x) { return x * 21; }
+inline int f5838_22(int x) { return x * 22; }
+inline int f5838_23(int x) { return x * 23; }
+inline int f5838_24(int x) { return x * 24; }
+inline int f5838_25(int x) { return x * 25; }
+inline int f5838_26(int x) { return x * 26; }
+inline int f5838_27(int x) { return x * 27; }
+inline int f5838_28(int x) { return x * 28; }
+inline int f5838_29(int x) { return x * 29; }
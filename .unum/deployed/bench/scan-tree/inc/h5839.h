@@ -0,0 +1,42 @@
+#pragma once
+/* header 5839 */
+#include <vector>
+#include "h1914.h"
+#include "h6704.h"
+#include "h4534.h"
+#include "h108.h"
+#include "h7569.h"
+#ifdef X
+#include "h4602.h"
+#endif
+struct S5839 { int a; const char *s = "x//y"; };
+inline int f5839_0(int x) { return x * 0; }
+inline int f5839_1(int x) { return x * 1; }
+inline int f5839_2(int x) { return x * 2; }
+inline int f5839_3(int x) { return x * 3; }
+inline int f5839_4(int x) { return x * 4; }
+inline int f5839_5(int x) { return x * 5; }
+inline int f5839_6(int x) { return x * 6; }
+inline int f5839_7(int x) { return x * 7; }
+inline int f5839_8(int x) { return x * 8; }
+inline int f5839_9(int x) { return x * 9; }
+inline int f5839_10(int x) { return x * 10; }
+inline int f5839_11(int x) { return x * 11; }
+inline int f5839_12(int x) { return x * 12; }
+inline int f5839_13(int x) { return x * 13; }
+inline int f5839_14(int x) { return x * 14; }
+inline int f5839_15(int x) { return x * 15; }
+inline int f5839_16(int x) { return x * 16; }
+inline int f5839_17(int x) { return x * 17; }
+inline int f5839_18(int x) { return x * 18; }
+inline int f5839_19(int x) { return x * 19; }
+inline int f5839_20(int x) { return x * 20; }
+inline int f5839_21(int x) { return x * 21; }
+inline int f5839_22(int x) { return x * 22; }
+inline int f5839_23(int x) { return x * 23; }
+inline int f5839_24(int x) { return x * 24; }
+inline int f5839_25(int x) { return x * 25; }
+inline int f5839_26(int x) { return x * 26; }
+inline int f5839_27(int x) { return x * 27; }
+inline int f5839_28(int x) { return x * 28; }
+inline int f5839_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 584 */
+#include <vector>
+#include "h6235.h"
+#include "h9299.h"
+#include "h7571.h"
+#include "h5722.h"
+#include "h2454.h"
+#ifdef X
+#include "h1856.h"
+#endif
+struct S584 { int a; const char *s = "x//y"; };
+inline int f584_0(int x) { return x * 0; }
+inline int f584_1(int x) { return x * 1; }
+inline int f584_2(int x) { return x * 2; }
+inline int f584_3(int x) { return x * 3; }
+inline int f584_4(int x) { return x * 4; }
+inline int f584_5(int x) { return x * 5; }
+inline int f584_6(int x) { return x * 6; }
+inline int f584_7(int x) { return x * 7; }
+inline int f584_8(int x) { return x * 8; }
+inline int f584_9(int x) { return x * 9; }
+inline int f584_10(int x) { return x * 10; }
+inline int f584_11(int x) { return x * 11; }
+inline int f584_12(int x) { return x * 12; }
+inline int f584_13(int x) { return x * 13; }
+inline int f584_14(int x) { return x * 14; }
+inline int f584_15(int x) { return x * 15; }
+inline int f584_16(int x) { return x * 16; }
+inline int f584_17(int x) { return x * 17; }
+inline int f584_18(int x) { return x * 18; }
+inline int f584_19(int x) { return x * 19; }
+inline int f584_20(int x) { return x * 20; }
+inline int f584_21(int x) { return x * 21; }
+inline int f584_22(int x) { return x * 22; }
+inline int f584_23(int x) { return x * 23; }
+inline int f584_24(int x) { return x * 24; }
+inline int f584_25(int x) { return x * 25; }
+inline int f584_26(int x) { return x * 26; }
+inline int f584_27(int x) { return x * 27; }
+inline int f584_28(int x) { return x * 28; }
+inline int f584_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5842 */
+#include <vector>
+#include "h7240.h"
+#include "h2201.h"
+#include "h7140.h"
+#include "h7823.h"
+#include "h8332.h"
+#ifdef X
+#include "h3840.h"
+#endif
+struct S5842 { int a; const char *s = "x//y"; };
+inline int f5842_0(int x) { return x * 0; }
+inline int f5842_1(int x) { return x * 1; }
+inline int f5842_2(int x) { return x * 2; }
+inline int f5842_3(int x) { return x * 3; }
+inline int f5842_4(int x) { return x * 4; }
+inline int f5842_5(int x) { return x * 5; }
+inline int f5842_6(int x) { return x * 6; }
+inline int f5842_7(int x) { return x * 7; }
+inline int f5842_8(int x) { return x * 8; }
+inline int f5842_9(int x) { return x * 9; }
+inline int f5842_10(int x) { return x * 10; }
+inline int f5842_11(int x) { return x * 11; }
+inline int f5842_12(int x) { return x * 12; }
+inline int f5842_13(int x) { return x * 13; }
+inline int f5842_14(int x) { return x * 14; }
+inline int f5842_15(int x) { return x * 15; }
+inline int f5842_16(int x) { return x * 16; }
+inline int f5842_17(int x) { return x * 17; }
+inline int f5842_18(int x) { return x * 18; }
+inline int f5842_19(int x) { return x * 19; }
+inline int f5842_20(int x) { return x * 20; }
+inline int f5842_21(int x) { return x * 21; }
+inline int f5842_22(int x) { return x * 22; }
+inline int f5842_23(int x) { return x * 23; }
+inline int f5842_24(int x) { return x * 24; }
+inline int f5842_25(int x) { return x * 25; }
+inline int f5842_26(int x) { return x * 26; }
+inline int f5842_27(int x) { return x * 27; }
+inline int f5842_28(int x) { return x * 28; }
+inline int f5842_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5843 */
+#include <vector>
+#include "h6847.h"
+#include "h700.h"
+#include "h6154.h"
+#include "h9945.h"
+#include "h7023.h"
+#ifdef X
+#include "h5049.h"
+#endif
+struct S5843 { int a; const char *s = "x//y"; };
+inline int f5843_0(int x) { return x * 0; }
+inline int f5843_1(int x) { return x * 1; }
+inline int f5843_2(int x) { return x * 2; }
+inline int f5843_3(int x) { return x * 3; }
+inline int f5843_4(int x) { return x * 4; }
+inline int f5843_5(int x) { return x * 5; }
+inline int f5843_6(int x) { return x * 6; }
+inline int f5843_7(int x) { return x * 7; }
+inline int f5843_8(int x) { return x * 8; }
+inline int f5843_9(int x) { return x * 9; }
+inline int f5843_10(int x) { return x * 10; }
+inline int f5843_11(int x) { return x * 11; }
+inline int f5843_12(int x) { return x * 12; }
+inline int f5843_13(int x) { return x * 13; }
+inline int f5843_14(int x) { return x * 14; }
+inline int f5843_15(int x) { return x * 15; }
+inline int f5843_16(int x) { return x * 16; }
+inline int f5843_17(int x) { return x * 17; }
+inline int f5843_18(int x) { return x * 18; }
+inline int f5843_19(int x) { return x * 19; }
+inline int f5843_20(int x) { return x * 20; }
+inline int f5843_21(int x) { return x * 21; }
+inline int f5843_22(int x) { return x * 22; }
+inline int f5843_23(int x) { return x * 23; }
+inline int f5843_24(int x) { return x * 24; }
+inline int f5843_25(int x) { return x * 25; }
+inline int f5843_26(int x) { return x * 26; }
+inline int f5843_27(int x) { return x * 27; }
+inline int f5843_28(int x) { return x * 28; }
+inline int f5843_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5845 */
+#include <vector>
+#include "h2643.h"
+#include "h2647.h"
+#include "h4384.h"
+#include "h6998.h"
+#include "h4344.h"
+#ifdef X
+#include "h9417.h"
+#endif
+struct S5845 { int a; const char *s = "x//y"; };
+inline int f5845_0(int x) { return x * 0; }
+inline int f5845_1(int x) { return x * 1; }
+inline int f5845_2(int x) { return x * 2; }
+inline int f5845_3(int x) { return x * 3; }
+inline int f5845_4(int x) { return x * 4; }
+inline int f5845_5(int x) { return x * 5; }
+inline int f5845_6(int x) { return x * 6; }
+inline int f5845_7(int x) { return x * 7; }
+inline int f5845_8(int x) { return x * 8; }
+inline int f5845_9(int x) { return x * 9; }
+inline int f5845_10(int x) { return x * 10; }
+inline int f5845_11(int x) { return x * 11; }
+inline int f5845_12(int x) { return x * 12; }
+inline int f5845_13(int x) { return x * 13; }
+inline int f5845_14(int x) { return x * 14; }
+inline int f5845_15(int x) { return x * 15; }
+inline int f5845_16(int x) { return x * 16; }
+inline int f5845_17(int x) { return x * 17; }
+inline int f5845_18(int x) { return x * 18; }
+inline int f5845_19(int x) { return x * 19; }
+inline int f5845_20(int x) { return x * 20; }
+inline int f5845_21(int x) { return x * 21; }
+inline int f5845_22(int x) { return x * 22; }
+inline int f5845_23(int x) { return x * 23; }
+inline int f5845_24(int x) { return x * 24; }
+inline int f5845_25(int x) { return x * 25; }
+inline int f5845_26(int x) { return x * 26; }
+inline int f5845_27(int x) { return x * 27; }
+inline int f5845_28(int x) { return x * 28; }
+inline int f5845_29(int x) { return x * 29; }
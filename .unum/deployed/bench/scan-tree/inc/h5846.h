@@ -0,0 +1,42 @@
+#pragma once
+/* header 5846 */
+#include <vector>
+#include "h3463.h"
+#include "h2181.h"
+#include "h514.h"
+#include "h4493.h"
+#include "h6662.h"
+#ifdef X
+#include "h1969.h"
+#endif
+struct S5846 { int a; const char *s = "x//y"; };
+inline int f5846_0(int x) { return x * 0; }
+inline int f5846_1(int x) { return x * 1; }
+inline int f5846_2(int x) { return x * 2; }
+inline int f5846_3(int x) { return x * 3; }
+inline int f5846_4(int x) { return x * 4; }
+inline int f5846_5(int x) { return x * 5; }
+inline int f5846_6(int x) { return x * 6; }
+inline int f5846_7(int x) { return x * 7; }
+inline int f5846_8(int x) { return x * 8; }
+inline int f5846_9(int x) { return x * 9; }
+inline int f5846_10(int x) { return x * 10; }
+inline int f5846_11(int x) { return x * 11; }
+inline int f5846_12(int x) { return x * 12; }
+inline int f5846_13(int x) { return x * 13; }
+inline int f5846_14(int x) { return x * 14; }
+inline int f5846_15(int x) { return x * 15; }
+inline int f5846_16(int x) { return x * 16; }
+inline int f5846_17(int x) { return x * 17; }
+inline int f5846_18(int x) { return x * 18; }
+inline int f5846_19(int x) { return x * 19; }
+inline int f5846_20(int x) { return x * 20; }
+inline int f5846_21(int x) { return x * 21; }
+inline int f5846_22(int x) { return x * 22; }
+inline int f5846_23(int x) { return x * 23; }
+inline int f5846_24(int x) { return x * 24; }
+inline int f5846_25(int x) { return x * 25; }
+inline int f5846_26(int x) { return x * 26; }
+inline int f5846_27(int x) { return x * 27; }
+inline int f5846_28(int x) { return x * 28; }
+inline int f5846_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5849 */
+#include <vector>
+#include "h3148.h"
+#include "h4823.h"
+#include "h5628.h"
+#include "h5343.h"
+#include "h5073.h"
+#ifdef X
+#include "h9967.h"
+#endif
+struct S5849 { int a; const char *s = "x//y"; };
+inline int f5849_0(int x) { return x * 0; }
+inline int f5849_1(int x) { return x * 1; }
+inline int f5849_2(int x) { return x * 2; }
+inline int f5849_3(int x) { return x * 3; }
+inline int f5849_4(int x) { return x * 4; }
+inline int f5849_5(int x) { return x * 5; }
+inline int f5849_6(int x) { return x * 6; }
+inline int f5849_7(int x) { return x * 7; }
+inline int f5849_8(int x) { return x * 8; }
+inline int f5849_9(int x) { return x * 9; }
+inline int f5849_10(int x) { return x * 10; }
+inline int f5849_11(int x) { return x * 11; }
+inline int f5849_12(int x) { return x * 12; }
+inline int f5849_13(int x) { return x * 13; }
+inline int f5849_14(int x) { return x * 14; }
+inline int f5849_15(int x) { return x * 15; }
+inline int f5849_16(int x) { return x * 16; }
+inline int f5849_17(int x) { return x * 17; }
+inline int f5849_18(int x) { return x * 18; }
+inline int f5849_19(int x) { return x * 19; }
+inline int f5849_20(int x) { return x * 20; }
+inline int f5849_21(int x) { return x * 21; }
+inline int f5849_22(int x) { return x * 22; }
+inline int f5849_23(int x) { return x * 23; }
+inline int f5849_24(int x) { return x * 24; }
+inline int f5849_25(int x) { return x * 25; }
+inline int f5849_26(int x) { return x * 26; }
+inline int f5849_27(int x) { return x * 27; }
+inline int f5849_28(int x) { return x * 28; }
+inline int f5849_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5852 */
+#include <vector>
+#include "h9222.h"
+#include "h4562.h"
+#include "h5803.h"
+#include "h8615.h"
+#include "h2564.h"
+#ifdef X
+#include "h9153.h"
+#endif
+struct S5852 { int a; const char *s = "x//y"; };
+inline int f5852_0(int x) { return x * 0; }
+inline int f5852_1(int x) { return x * 1; }
+inline int f5852_2(int x) { return x * 2; }
+inline int f5852_3(int x) { return x * 3; }
+inline int f5852_4(int x) { return x * 4; }
+inline int f5852_5(int x) { return x * 5; }
+inline int f5852_6(int x) { return x * 6; }
+inline int f5852_7(int x) { return x * 7; }
+inline int f5852_8(int x) { return x * 8; }
+inline int f5852_9(int x) { return x * 9; }
+inline int f5852_10(int x) { return x * 10; }
+inline int f5852_11(int x) { return x * 11; }
+inline int f5852_12(int x) { return x * 12; }
+inline int f5852_13(int x) { return x * 13; }
+inline int f5852_14(int x) { return x * 14; }
+inline int f5852_15(int x) { return x * 15; }
+inline int f5852_16(int x) { return x * 16; }
+inline int f5852_17(int x) { return x * 17; }
+inline int f5852_18(int x) { return x * 18; }
+inline int f5852_19(int x) { return x * 19; }
+inline int f5852_20(int x) { return x * 20; }
+inline int f5852_21(int x) { return x * 21; }
+inline int f5852_22(int x) { return x * 22; }
+inline int f5852_23(int x) { return x * 23; }
+inline int f5852_24(int x) { return x * 24; }
+inline int f5852_25(int x) { return x * 25; }
+inline int f5852_26(int x) { return x * 26; }
+inline int f5852_27(int x) { return x * 27; }
+inline int f5852_28(int x) { return x * 28; }
+inline int f5852_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5855 */
+#include <vector>
+#include "h9130.h"
+#include "h541.h"
+#include "h8088.h"
+#include "h8715.h"
+#include "h8047.h"
+#ifdef X
+#include "h7943.h"
+#endif
+struct S5855 { int a; const char *s = "x//y"; };
+inline int f5855_0(int x) { return x * 0; }
+inline int f5855_1(int x) { return x * 1; }
+inline int f5855_2(int x) { return x * 2; }
+inline int f5855_3(int x) { return x * 3; }
+inline int f5855_4(int x) { return x * 4; }
+inline int f5855_5(int x) { return x * 5; }
+inline int f5855_6(int x) { return x * 6; }
+inline int f5855_7(int x) { return x * 7; }
+inline int f5855_8(int x) { return x * 8; }
+inline int f5855_9(int x) { return x * 9; }
+inline int f5855_10(int x) { return x * 10; }
+inline int f5855_11(int x) { return x * 11; }
+inline int f5855_12(int x) { return x * 12; }
+inline int f5855_13(int x) { return x * 13; }
+inline int f5855_14(int x) { return x * 14; }
+inline int f5855_15(int x) { return x * 15; }
+inline int f5855_16(int x) { return x * 16; }
+inline int f5855_17(int x) { return x * 17; }
+inline int f5855_18(int x) { return x * 18; }
+inline int f5855_19(int x) { return x * 19; }
+inline int f5855_20(int x) { return x * 20; }
+inline int f5855_21(int x) { return x * 21; }
+inline int f5855_22(int x) { return x * 22; }
+inline int f5855_23(int x) { return x * 23; }
+inline int f5855_24(int x) { return x * 24; }
+inline int f5855_25(int x) { return x * 25; }
+inline int f5855_26(int x) { return x * 26; }
+inline int f5855_27(int x) { return x * 27; }
+inline int f5855_28(int x) { return x * 28; }
+inline int f5855_29(int x) { return x * 29; }
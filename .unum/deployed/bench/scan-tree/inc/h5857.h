@@ -0,0 +1,42 @@
+#pragma once
+/* header 5857 */
+#include <vector>
+#include "h6389.h"
+#include "h498.h"
+#include "h4548.h"
+#include "h6313.h"
+#include "h418.h"
+#ifdef X
+#include "h130.h"
+#endif
+struct S5857 { int a; const char *s = "x//y"; };
+inline int f5857_0(int x) { return x * 0; }
+inline int f5857_1(int x) { return x * 1; }
+inline int f5857_2(int x) { return x * 2; }
+inline int f5857_3(int x) { return x * 3; }
+inline int f5857_4(int x) { return x * 4; }
+inline int f5857_5(int x) { return x * 5; }
+inline int f5857_6(int x) { return x * 6; }
+inline int f5857_7(int x) { return x * 7; }
+inline int f5857_8(int x) { return x * 8; }
+inline int f5857_9(int x) { return x * 9; }
+inline int f5857_10(int x) { return x * 10; }
+inline int f5857_11(int x) { return x * 11; }
+inline int f5857_12(int x) { return x * 12; }
+inline int f5857_13(int x) { return x * 13; }
+inline int f5857_14(int x) { return x * 14; }
+inline int f5857_15(int x) { return x * 15; }
+inline int f5857_16(int x) { return x * 16; }
+inline int f5857_17(int x) { return x * 17; }
+inline int f5857_18(int x) { return x * 18; }
+inline int f5857_19(int x) { return x * 19; }
+inline int f5857_20(int x) { return x * 20; }
+inline int f5857_21(int x) { return x * 21; }
+inline int f5857_22(int x) { return x * 22; }
+inline int f5857_23(int x) { return x * 23; }
+inline int f5857_24(int x) { return x * 24; }
+inline int f5857_25(int x) { return x * 25; }
+inline int f5857_26(int x) { return x * 26; }
+inline int f5857_27(int x) { return x * 27; }
+inline int f5857_28(int x) { return x * 28; }
+inline int f5857_29(int x) { return x * 29; }
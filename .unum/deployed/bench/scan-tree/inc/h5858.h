@@ -0,0 +1,42 @@
+#pragma once
+/* header 5858 */
+#include <vector>
+#include "h4864.h"
+#include "h8549.h"
+#include "h8424.h"
+#include "h4588.h"
+#include "h4070.h"
+#ifdef X
+#include "h557.h"
+#endif
+struct S5858 { int a; const char *s = "x//y"; };
+inline int f5858_0(int x) { return x * 0; }
+inline int f5858_1(int x) { return x * 1; }
+inline int f5858_2(int x) { return x * 2; }
+inline int f5858_3(int x) { return x * 3; }
+inline int f5858_4(int x) { return x * 4; }
+inline int f5858_5(int x) { return x * 5; }
+inline int f5858_6(int x) { return x * 6; }
+inline int f5858_7(int x) { return x * 7; }
+inline int f5858_8(int x) { return x * 8; }
+inline int f5858_9(int x) { return x * 9; }
+inline int f5858_10(int x) { return x * 10; }
+inline int f5858_11(int x) { return x * 11; }
+inline int f5858_12(int x) { return x * 12; }
+inline int f5858_13(int x) { return x * 13; }
+inline int f5858_14(int x) { return x * 14; }
+inline int f5858_15(int x) { return x * 15; }
+inline int f5858_16(int x) { return x * 16; }
+inline int f5858_17(int x) { return x * 17; }
+inline int f5858_18(int x) { return x * 18; }
+inline int f5858_19(int x) { return x * 19; }
+inline int f5858_20(int x) { return x * 20; }
+inline int f5858_21(int x) { return x * 21; }
+inline int f5858_22(int x) { return x * 22; }
+inline int f5858_23(int x) { return x * 23; }
+inline int f5858_24(int x) { return x * 24; }
+inline int f5858_25(int x) { return x * 25; }
+inline int f5858_26(int x) { return x * 26; }
+inline int f5858_27(int x) { return x * 27; }
+inline int f5858_28(int x) { return x * 28; }
+inline int f5858_29(int x) { return x * 29; }
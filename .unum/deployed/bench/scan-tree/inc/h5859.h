@@ -0,0 +1,42 @@
+#pragma once
+/* header 5859 */
+#include <vector>
+#include "h2789.h"
+#include "h1613.h"
+#include "h2854.h"
+#include "h9975.h"
+#include "h5922.h"
+#ifdef X
+#include "h4485.h"
+#endif
+struct S5859 { int a; const char *s = "x//y"; };
+inline int f5859_0(int x) { return x * 0; }
+inline int f5859_1(int x) { return x * 1; }
+inline int f5859_2(int x) { return x * 2; }
+inline int f5859_3(int x) { return x * 3; }
+inline int f5859_4(int x) { return x * 4; }
+inline int f5859_5(int x) { return x * 5; }
+inline int f5859_6(int x) { return x * 6; }
+inline int f5859_7(int x) { return x * 7; }
+inline int f5859_8(int x) { return x * 8; }
+inline int f5859_9(int x) { return x * 9; }
+inline int f5859_10(int x) { return x * 10; }
+inline int f5859_11(int x) { return x * 11; }
+inline int f5859_12(int x) { return x * 12; }
+inline int f5859_13(int x) { return x * 13; }
+inline int f5859_14(int x) { return x * 14; }
+inline int f5859_15(int x) { return x * 15; }
+inline int f5859_16(int x) { return x * 16; }
+inline int f5859_17(int x) { return x * 17; }
+inline int f5859_18(int x) { return x * 18; }
+inline int f5859_19(int x) { return x * 19; }
+inline int f5859_20(int x) { return x * 20; }
+inline int f5859_21(int x) { return x * 21; }
+inline int f5859_22(int x) { return x * 22; }
+inline int f5859_23(int x) { return x * 23; }
+inline int f5859_24(int x) { return x * 24; }
+inline int f5859_25(int x) { return x * 25; }
+inline int f5859_26(int x) { return x * 26; }
+inline int f5859_27(int x) { return x * 27; }
+inline int f5859_28(int x) { return x * 28; }
+inline int f5859_29(int x) { return x * 29; }
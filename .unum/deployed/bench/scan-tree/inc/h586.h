@@ -0,0 +1,42 @@
+#pragma once
+/* header 586 */
+#include <vector>
+#include "h8469.h"
+#include "h6518.h"
+#include "h8944.h"
+#include "h9359.h"
+#include "h5087.h"
+#ifdef X
+#include "h3974.h"
+#endif
+struct S586 { int a; const char *s = "x//y"; };
+inline int f586_0(int x) { return x * 0; }
+inline int f586_1(int x) { return x * 1; }
+inline int f586_2(int x) { return x * 2; }
+inline int f586_3(int x) { return x * 3; }
+inline int f586_4(int x) { return x * 4; }
+inline int f586_5(int x) { return x * 5; }
+inline int f586_6(int x) { return x * 6; }
+inline int f586_7(int x) { return x * 7; }
+inline int f586_8(int x) { return x * 8; }
+inline int f586_9(int x) { return x * 9; }
+inline int f586_10(int x) { return x * 10; }
+inline int f586_11(int x) { return x * 11; }
+inline int f586_12(int x) { return x * 12; }
+inline int f586_13(int x) { return x * 13; }
+inline int f586_14(int x) { return x * 14; }
+inline int f586_15(int x) { return x * 15; }
+inline int f586_16(int x) { return x * 16; }
+inline int f586_17(int x) { return x * 17; }
+inline int f586_18(int x) { return x * 18; }
+inline int f586_19(int x) { return x * 19; }
+inline int f586_20(int x) { return x * 20; }
+inline int f586_21(int x) { return x * 21; }
+inline int f586_22(int x) { return x * 22; }
+inline int f586_23(int x) { return x * 23; }
+inline int f586_24(int x) { return x * 24; }
+inline int f586_25(int x) { return x * 25; }
+inline int f586_26(int x) { return x * 26; }
+inline int f586_27(int x) { return x * 27; }
+inline int f586_28(int x) { return x * 28; }
+inline int f586_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5860 */
+#include <vector>
+#include "h2733.h"
+#include "h4643.h"
+#include "h5810.h"
+#include "h1840.h"
+#include "h8541.h"
+#ifdef X
+#include "h7981.h"
+#endif
+struct S5860 { int a; const char *s = "x//y"; };
+inline int f5860_0(int x) { return x * 0; }
+inline int f5860_1(int x) { return x * 1; }
+inline int f5860_2(int x) { return x * 2; }
+inline int f5860_3(int x) { return x * 3; }
+inline int f5860_4(int x) { return x * 4; }
+inline int f5860_5(int x) { return x * 5; }
+inline int f5860_6(int x) { return x * 6; }
+inline int f5860_7(int x) { return x * 7; }
+inline int f5860_8(int x) { return x * 8; }
+inline int f5860_9(int x) { return x * 9; }
+inline int f5860_10(int x) { return x * 10; }
+inline int f5860_11(int x) { return x * 11; }
+inline int f5860_12(int x) { return x * 12; }
+inline int f5860_13(int x) { return x * 13; }
+inline int f5860_14(int x) { return x * 14; }
+inline int f5860_15(int x) { return x * 15; }
+inline int f5860_16(int x) { return x * 16; }
+inline int f5860_17(int x) { return x * 17; }
+inline int f5860_18(int x) { return x * 18; }
+inline int f5860_19(int x) { return x * 19; }
+inline int f5860_20(int x) { return x * 20; }
+inline int f5860_21(int x) { return x * 21; }
+inline int f5860_22(int x) { return x * 22; }
+inline int f5860_23(int x) { return x * 23; }
+inline int f5860_24(int x) { return x * 24; }
+inline int f5860_25(int x) { return x * 25; }
+inline int f5860_26(int x) { return x * 26; }
+inline int f5860_27(int x) { return x * 27; }
+inline int f5860_28(int x) { return x * 28; }
+inline int f5860_29(int x) { return x * 29; }
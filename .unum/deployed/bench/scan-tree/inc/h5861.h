@@ -0,0 +1,42 @@
+#pragma once
+/* header 5861 */
+#include <vector>
+#include "h7670.h"
+#include "h6195.h"
+#include "h6929.h"
+#include "h3047.h"
+#include "h5717.h"
+#ifdef X
+#include "h4206.h"
+#endif
+struct S5861 { int a; const char *s = "x//y"; };
+inline int f5861_0(int x) { return x * 0; }
+inline int f5861_1(int x) { return x * 1; }
+inline int f5861_2(int x) { return x * 2; }
+inline int f5861_3(int x) { return x * 3; }
+inline int f5861_4(int x) { return x * 4; }
+inline int f5861_5(int x) { return x * 5; }
+inline int f5861_6(int x) { return x * 6; }
+inline int f5861_7(int x) { return x * 7; }
+inline int f5861_8(int x) { return x * 8; }
+inline int f5861_9(int x) { return x * 9; }
+inline int f5861_10(int x) { return x * 10; }
+inline int f5861_11(int x) { return x * 11; }
+inline int f5861_12(int x) { return x * 12; }
+inline int f5861_13(int x) { return x * 13; }
+inline int f5861_14(int x) { return x * 14; }
+inline int f5861_15(int x) { return x * 15; }
+inline int f5861_16(int x) { return x * 16; }
+inline int f5861_17(int x) { return x * 17; }
+inline int f5861_18(int x) { return x * 18; }
+inline int f5861_19(int x) { return x * 19; }
+inline int f5861_20(int x) { return x * 20; }
+inline int f5861_21(int x) { return x * 21; }
+inline int f5861_22(int x) { return x * 22; }
+inline int f5861_23(int x) { return x * 23; }
+inline int f5861_24(int x) { return x * 24; }
+inline int f5861_25(int x) { return x * 25; }
+inline int f5861_26(int x) { return x * 26; }
+inline int f5861_27(int x) { return x * 27; }
+inline int f5861_28(int x) { return x * 28; }
+inline int f5861_29(int x) { return x * 29; }
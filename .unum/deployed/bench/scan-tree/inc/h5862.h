@@ -0,0 +1,42 @@
+#pragma once
+/* header 5862 */
+#include <vector>
+#include "h4719.h"
+#include "h886.h"
+#include "h9785.h"
+#include "h6892.h"
+#include "h1357.h"
+#ifdef X
+#include "h1275.h"
+#endif
+struct S5862 { int a; const char *s = "x//y"; };
+inline int f5862_0(int x) { return x * 0; }
+inline int f5862_1(int x) { return x * 1; }
+inline int f5862_2(int x) { return x * 2; }
+inline int f5862_3(int x) { return x * 3; }
+inline int f5862_4(int x) { return x * 4; }
+inline int f5862_5(int x) { return x * 5; }
+inline int f5862_6(int x) { return x * 6; }
+inline int f5862_7(int x) { return x * 7; }
+inline int f5862_8(int x) { return x * 8; }
+inline int f5862_9(int x) { return x * 9; }
+inline int f5862_10(int x) { return x * 10; }
+inline int f5862_11(int x) { return x * 11; }
+inline int f5862_12(int x) { return x * 12; }
+inline int f5862_13(int x) { return x * 13; }
+inline int f5862_14(int x) { return x * 14; }
+inline int f5862_15(int x) { return x * 15; }
+inline int f5862_16(int x) { return x * 16; }
+inline int f5862_17(int x) { return x * 17; }
+inline int f5862_18(int x) { return x * 18; }
+inline int f5862_19(int x) { return x * 19; }
+inline int f5862_20(int x) { return x * 20; }
+inline int f5862_21(int x) { return x * 21; }
+inline int f5862_22(int x) { return x * 22; }
+inline int f5862_23(int x) { return x * 23; }
+inline int f5862_24(int x) { return x * 24; }
+inline int f5862_25(int x) { return x * 25; }
+inline int f5862_26(int x) { return x * 26; }
+inline int f5862_27(int x) { return x * 27; }
+inline int f5862_28(int x) { return x * 28; }
+inline int f5862_29(int x) { return x * 29; }
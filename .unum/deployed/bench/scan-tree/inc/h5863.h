@@ -0,0 +1,42 @@
+#pragma once
+/* header 5863 */
+#include <vector>
+#include "h7608.h"
+#include "h9611.h"
+#include "h8293.h"
+#include "h6491.h"
+#include "h2260.h"
+#ifdef X
+#include "h7440.h"
+#endif
+struct S5863 { int a; const char *s = "x//y"; };
+inline int f5863_0(int x) { return x * 0; }
+inline int f5863_1(int x) { return x * 1; }
+inline int f5863_2(int x) { return x * 2; }
+inline int f5863_3(int x) { return x * 3; }
+inline int f5863_4(int x) { return x * 4; }
+inline int f5863_5(int x) { return x * 5; }
+inline int f5863_6(int x) { return x * 6; }
+inline int f5863_7(int x) { return x * 7; }
+inline int f5863_8(int x) { return x * 8; }
+inline int f5863_9(int x) { return x * 9; }
+inline int f5863_10(int x) { return x * 10; }
+inline int f5863_11(int x) { return x * 11; }
+inline int f5863_12(int x) { return x * 12; }
+inline int f5863_13(int x) { return x * 13; }
+inline int f5863_14(int x) { return x * 14; }
+inline int f5863_15(int x) { return x * 15; }
+inline int f5863_16(int x) { return x * 16; }
+inline int f5863_17(int x) { return x * 17; }
+inline int f5863_18(int x) { return x * 18; }
+inline int f5863_19(int x) { return x * 19; }
+inline int f5863_20(int x) { return x * 20; }
+inline int f5863_21(int x) { return x * 21; }
+inline int f5863_22(int x) { return x * 22; }
+inline int f5863_23(int x) { return x * 23; }
+inline int f5863_24(int x) { return x * 24; }
+inline int f5863_25(int x) { return x * 25; }
+inline int f5863_26(int x) { return x * 26; }
+inline int f5863_27(int x) { return x * 27; }
+inline int f5863_28(int x) { return x * 28; }
+inline int f5863_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5865 */
+#include <vector>
+#include "h5774.h"
+#include "h7486.h"
+#include "h1830.h"
+#include "h2847.h"
+#include "h3937.h"
+#ifdef X
+#include "h4656.h"
+#endif
+struct S5865 { int a; const char *s = "x//y"; };
+inline int f5865_0(int x) { return x * 0; }
+inline int f5865_1(int x) { return x * 1; }
+inline int f5865_2(int x) { return x * 2; }
+inline int f5865_3(int x) { return x * 3; }
+inline int f5865_4(int x) { return x * 4; }
+inline int f5865_5(int x) { return x * 5; }
+inline int f5865_6(int x) { return x * 6; }
+inline int f5865_7(int x) { return x * 7; }
+inline int f5865_8(int x) { return x * 8; }
+inline int f5865_9(int x) { return x * 9; }
+inline int f5865_10(int x) { return x * 10; }
+inline int f5865_11(int x) { return x * 11; }
+inline int f5865_12(int x) { return x * 12; }
+inline int f5865_13(int x) { return x * 13; }
+inline int f5865_14(int x) { return x * 14; }
+inline int f5865_15(int x) { return x * 15; }
+inline int f5865_16(int x) { return x * 16; }
+inline int f5865_17(int x) { return x * 17; }
+inline int f5865_18(int x) { return x * 18; }
+inline int f5865_19(int x) { return x * 19; }
+inline int f5865_20(int x) { return x * 20; }
+inline int f5865_21(int x) { return x * 21; }
+inline int f5865_22(int x) { return x * 22; }
+inline int f5865_23(int x) { return x * 23; }
+inline int f5865_24(int x) { return x * 24; }
+inline int f5865_25(int x) { return x * 25; }
+inline int f5865_26(int x) { return x * 26; }
+inline int f5865_27(int x) { return x * 27; }
+inline int f5865_28(int x) { return x * 28; }
+inline int f5865_29(int x) { return x * 29; }
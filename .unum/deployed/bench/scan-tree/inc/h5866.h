@@ -0,0 +1,42 @@
+#pragma once
+/* header 5866 */
+#include <vector>
+#include "h377.h"
+#include "h9049.h"
+#include "h1800.h"
+#include "h8947.h"
+#include "h238.h"
+#ifdef X
+#include "h8704.h"
+#endif
+struct S5866 { int a; const char *s = "x//y"; };
+inline int f5866_0(int x) { return x * 0; }
+inline int f5866_1(int x) { return x * 1; }
+inline int f5866_2(int x) { return x * 2; }
+inline int f5866_3(int x) { return x * 3; }
+inline int f5866_4(int x) { return x * 4; }
+inline int f5866_5(int x) { return x * 5; }
+inline int f5866_6(int x) { return x * 6; }
+inline int f5866_7(int x) { return x * 7; }
+inline int f5866_8(int x) { return x * 8; }
+inline int f5866_9(int x) { return x * 9; }
+inline int f5866_10(int x) { return x * 10; }
+inline int f5866_11(int x) { return x * 11; }
+inline int f5866_12(int x) { return x * 12; }
+inline int f5866_13(int x) { return x * 13; }
+inline int f5866_14(int x) { return x * 14; }
+inline int f5866_15(int x) { return x * 15; }
+inline int f5866_16(int x) { return x * 16; }
+inline int f5866_17(int x) { return x * 17; }
+inline int f5866_18(int x) { return x * 18; }
+inline int f5866_19(int x) { return x * 19; }
+inline int f5866_20(int x) { return x * 20; }
+inline int f5866_21(int x) { return x * 21; }
+inline int f5866_22(int x) { return x * 22; }
+inline int f5866_23(int x) { return x * 23; }
+inline int f5866_24(int x) { return x * 24; }
+inline int f5866_25(int x) { return x * 25; }
+inline int f5866_26(int x) { return x * 26; }
+inline int f5866_27(int x) { return x * 27; }
+inline int f5866_28(int x) { return x * 28; }
+inline int f5866_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5868 */
+#include <vector>
+#include "h7073.h"
+#include "h6239.h"
+#include "h4401.h"
+#include "h6374.h"
+#include "h242.h"
+#ifdef X
+#include "h2305.h"
+#endif
+struct S5868 { int a; const char *s = "x//y"; };
+inline int f5868_0(int x) { return x * 0; }
+inline int f5868_1(int x) { return x * 1; }
+inline int f5868_2(int x) { return x * 2; }
+inline int f5868_3(int x) { return x * 3; }
+inline int f5868_4(int x) { return x * 4; }
+inline int f5868_5(int x) { return x * 5; }
+inline int f5868_6(int x) { return x * 6; }
+inline int f5868_7(int x) { return x * 7; }
+inline int f5868_8(int x) { return x * 8; }
+inline int f5868_9(int x) { return x * 9; }
+inline int f5868_10(int x) { return x * 10; }
+inline int f5868_11(int x) { return x * 11; }
+inline int f5868_12(int x) { return x * 12; }
+inline int f5868_13(int x) { return x * 13; }
+inline int f5868_14(int x) { return x * 14; }
+inline int f5868_15(int x) { return x * 15; }
+inline int f5868_16(int x) { return x * 16; }
+inline int f5868_17(int x) { return x * 17; }
+inline int f5868_18(int x) { return x * 18; }
+inline int f5868_19(int x) { return x * 19; }
+inline int f5868_20(int x) { return x * 20; }
+inline int f5868_21(int x) { return x * 21; }
+inline int f5868_22(int x) { return x * 22; }
+inline int f5868_23(int x) { return x * 23; }
+inline int f5868_24(int x) { return x * 24; }
+inline int f5868_25(int x) { return x * 25; }
+inline int f5868_26(int x) { return x * 26; }
+inline int f5868_27(int x) { return x * 27; }
+inline int f5868_28(int x) { return x * 28; }
+inline int f5868_29(int x) { return x * 29; }
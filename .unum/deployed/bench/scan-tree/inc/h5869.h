@@ -0,0 +1,42 @@
+#pragma once
+/* header 5869 */
+#include <vector>
+#include "h6945.h"
+#include "h9054.h"
+#include "h5929.h"
+#include "h4323.h"
+#include "h2538.h"
+#ifdef X
+#include "h1198.h"
+#endif
+struct S5869 { int a; const char *s = "x//y"; };
+inline int f5869_0(int x) { return x * 0; }
+inline int f5869_1(int x) { return x * 1; }
+inline int f5869_2(int x) { return x * 2; }
+inline int f5869_3(int x) { return x * 3; }
+inline int f5869_4(int x) { return x * 4; }
+inline int f5869_5(int x) { return x * 5; }
+inline int f5869_6(int x) { return x * 6; }
+inline int f5869_7(int x) { return x * 7; }
+inline int f5869_8(int x) { return x * 8; }
+inline int f5869_9(int x) { return x * 9; }
+inline int f5869_10(int x) { return x * 10; }
+inline int f5869_11(int x) { return x * 11; }
+inline int f5869_12(int x) { return x * 12; }
+inline int f5869_13(int x) { return x * 13; }
+inline int f5869_14(int x) { return x * 14; }
+inline int f5869_15(int x) { return x * 15; }
+inline int f5869_16(int x) { return x * 16; }
+inline int f5869_17(int x) { return x * 17; }
+inline int f5869_18(int x) { return x * 18; }
+inline int f5869_19(int x) { return x * 19; }
+inline int f5869_20(int x) { return x * 20; }
+inline int f5869_21(int x) { return x * 21; }
+inline int f5869_22(int x) { return x * 22; }
+inline int f5869_23(int x) { return x * 23; }
+inline int f5869_24(int x) { return x * 24; }
+inline int f5869_25(int x) { return x * 25; }
+inline int f5869_26(int x) { return x * 26; }
+inline int f5869_27(int x) { return x * 27; }
+inline int f5869_28(int x) { return x * 28; }
+inline int f5869_29(int x) { return x * 29; }
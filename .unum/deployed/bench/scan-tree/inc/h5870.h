@@ -0,0 +1,42 @@
+#pragma once
+/* header 5870 */
+#include <vector>
+#include "h3083.h"
+#include "h2524.h"
+#include "h7724.h"
+#include "h5464.h"
+#include "h6224.h"
+#ifdef X
+#include "h3295.h"
+#endif
+struct S5870 { int a; const char *s = "x//y"; };
+inline int f5870_0(int x) { return x * 0; }
+inline int f5870_1(int x) { return x * 1; }
+inline int f5870_2(int x) { return x * 2; }
+inline int f5870_3(int x) { return x * 3; }
+inline int f5870_4(int x) { return x * 4; }
+inline int f5870_5(int x) { return x * 5; }
+inline int f5870_6(int x) { return x * 6; }
+inline int f5870_7(int x) { return x * 7; }
+inline int f5870_8(int x) { return x * 8; }
+inline int f5870_9(int x) { return x * 9; }
+inline int f5870_10(int x) { return x * 10; }
+inline int f5870_11(int x) { return x * 11; }
+inline int f5870_12(int x) { return x * 12; }
+inline int f5870_13(int x) { return x * 13; }
+inline int f5870_14(int x) { return x * 14; }
+inline int f5870_15(int x) { return x * 15; }
+inline int f5870_16(int x) { return x * 16; }
+inline int f5870_17(int x) { return x * 17; }
+inline int f5870_18(int x) { return x * 18; }
+inline int f5870_19(int x) { return x * 19; }
+inline int f5870_20(int x) { return x * 20; }
+inline int f5870_21(int x) { return x * 21; }
+inline int f5870_22(int x) { return x * 22; }
+inline int f5870_23(int x) { return x * 23; }
+inline int f5870_24(int x) { return x * 24; }
+inline int f5870_25(int x) { return x * 25; }
+inline int f5870_26(int x) { return x * 26; }
+inline int f5870_27(int x) { return x * 27; }
+inline int f5870_28(int x) { return x * 28; }
+inline int f5870_29(int x) { return x * 29; }
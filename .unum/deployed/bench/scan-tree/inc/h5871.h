@@ -0,0 +1,42 @@
+#pragma once
+/* header 5871 */
+#include <vector>
+#include "h4644.h"
+#include "h3188.h"
+#include "h9083.h"
+#include "h1209.h"
+#include "h3286.h"
+#ifdef X
+#include "h4351.h"
+#endif
+struct S5871 { int a; const char *s = "x//y"; };
+inline int f5871_0(int x) { return x * 0; }
+inline int f5871_1(int x) { return x * 1; }
+inline int f5871_2(int x) { return x * 2; }
+inline int f5871_3(int x) { return x * 3; }
+inline int f5871_4(int x) { return x * 4; }
+inline int f5871_5(int x) { return x * 5; }
+inline int f5871_6(int x) { return x * 6; }
+inline int f5871_7(int x) { return x * 7; }
+inline int f5871_8(int x) { return x * 8; }
+inline int f5871_9(int x) { return x * 9; }
+inline int f5871_10(int x) { return x * 10; }
+inline int f5871_11(int x) { return x * 11; }
+inline int f5871_12(int x) { return x * 12; }
+inline int f5871_13(int x) { return x * 13; }
+inline int f5871_14(int x) { return x * 14; }
+inline int f5871_15(int x) { return x * 15; }
+inline int f5871_16(int x) { return x * 16; }
+inline int f5871_17(int x) { return x * 17; }
+inline int f5871_18(int x) { return x * 18; }
+inline int f5871_19(int x) { return x * 19; }
+inline int f5871_20(int x) { return x * 20; }
+inline int f5871_21(int x) { return x * 21; }
+inline int f5871_22(int x) { return x * 22; }
+inline int f5871_23(int x) { return x * 23; }
+inline int f5871_24(int x) { return x * 24; }
+inline int f5871_25(int x) { return x * 25; }
+inline int f5871_26(int x) { return x * 26; }
+inline int f5871_27(int x) { return x * 27; }
+inline int f5871_28(int x) { return x * 28; }
+inline int f5871_29(int x) { return x * 29; }
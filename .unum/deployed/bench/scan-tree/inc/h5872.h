@@ -0,0 +1,42 @@
+#pragma once
+/* header 5872 */
+#include <vector>
+#include "h8691.h"
+#include "h1243.h"
+#include "h5200.h"
+#include "h3599.h"
+#include "h9636.h"
+#ifdef X
+#include "h6899.h"
+#endif
+struct S5872 { int a; const char *s = "x//y"; };
+inline int f5872_0(int x) { return x * 0; }
+inline int f5872_1(int x) { return x * 1; }
+inline int f5872_2(int x) { return x * 2; }
+inline int f5872_3(int x) { return x * 3; }
+inline int f5872_4(int x) { return x * 4; }
+inline int f5872_5(int x) { return x * 5; }
+inline int f5872_6(int x) { return x * 6; }
+inline int f5872_7(int x) { return x * 7; }
+inline int f5872_8(int x) { return x * 8; }
+inline int f5872_9(int x) { return x * 9; }
+inline int f5872_10(int x) { return x * 10; }
+inline int f5872_11(int x) { return x * 11; }
+inline int f5872_12(int x) { return x * 12; }
+inline int f5872_13(int x) { return x * 13; }
+inline int f5872_14(int x) { return x * 14; }
+inline int f5872_15(int x) { return x * 15; }
+inline int f5872_16(int x) { return x * 16; }
+inline int f5872_17(int x) { return x * 17; }
+inline int f5872_18(int x) { return x * 18; }
+inline int f5872_19(int x) { return x * 19; }
+inline int f5872_20(int x) { return x * 20; }
+inline int f5872_21(int x) { return x * 21; }
+inline int f5872_22(int x) { return x * 22; }
+inline int f5872_23(int x) { return x * 23; }
+inline int f5872_24(int x) { return x * 24; }
+inline int f5872_25(int x) { return x * 25; }
+inline int f5872_26(int x) { return x * 26; }
+inline int f5872_27(int x) { return x * 27; }
+inline int f5872_28(int x) { return x * 28; }
+inline int f5872_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5878 */
+#include <vector>
+#include "h1866.h"
+#include "h1305.h"
+#include "h2315.h"
+#include "h8302.h"
+#include "h5722.h"
+#ifdef X
+#include "h2836.h"
+#endif
+struct S5878 { int a; const char *s = "x//y"; };
+inline int f5878_0(int x) { return x * 0; }
+inline int f5878_1(int x) { return x * 1; }
+inline int f5878_2(int x) { return x * 2; }
+inline int f5878_3(int x) { return x * 3; }
+inline int f5878_4(int x) { return x * 4; }
+inline int f5878_5(int x) { return x * 5; }
+inline int f5878_6(int x) { return x * 6; }
+inline int f5878_7(int x) { return x * 7; }
+inline int f5878_8(int x) { return x * 8; }
+inline int f5878_9(int x) { return x * 9; }
+inline int f5878_10(int x) { return x * 10; }
+inline int f5878_11(int x) { return x * 11; }
+inline int f5878_12(int x) { return x * 12; }
+inline int f5878_13(int x) { return x * 13; }
+inline int f5878_14(int x) { return x * 14; }
+inline int f5878_15(int x) { return x * 15; }
+inline int f5878_16(int x) { return x * 16; }
+inline int f5878_17(int x) { return x * 17; }
+inline int f5878_18(int x) { return x * 18; }
+inline int f5878_19(int x) { return x * 19; }
+inline int f5878_20(int x) { return x * 20; }
+inline int f5878_21(int x) { return x * 21; }
+inline int f5878_22(int x) { return x * 22; }
+inline int f5878_23(int x) { return x * 23; }
+inline int f5878_24(int x) { return x * 24; }
+inline int f5878_25(int x) { return x * 25; }
+inline int f5878_26(int x) { return x * 26; }
+inline int f5878_27(int x) { return x * 27; }
+inline int f5878_28(int x) { return x * 28; }
+inline int f5878_29(int x) { return x * 29; }
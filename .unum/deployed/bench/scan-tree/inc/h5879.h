@@ -0,0 +1,42 @@
+#pragma once
+/* header 5879 */
+#include <vector>
+#include "h7023.h"
+#include "h20.h"
+#include "h168.h"
+#include "h9139.h"
+#include "h943.h"
+#ifdef X
+#include "h9171.h"
+#endif
+struct S5879 { int a; const char *s = "x//y"; };
+inline int f5879_0(int x) { return x * 0; }
+inline int f5879_1(int x) { return x * 1; }
+inline int f5879_2(int x) { return x * 2; }
+inline int f5879_3(int x) { return x * 3; }
+inline int f5879_4(int x) { return x * 4; }
+inline int f5879_5(int x) { return x * 5; }
+inline int f5879_6(int x) { return x * 6; }
+inline int f5879_7(int x) { return x * 7; }
+inline int f5879_8(int x) { return x * 8; }
+inline int f5879_9(int x) { return x * 9; }
+inline int f5879_10(int x) { return x * 10; }
+inline int f5879_11(int x) { return x * 11; }
+inline int f5879_12(int x) { return x * 12; }
+inline int f5879_13(int x) { return x * 13; }
+inline int f5879_14(int x) { return x * 14; }
+inline int f5879_15(int x) { return x * 15; }
+inline int f5879_16(int x) { return x * 16; }
+inline int f5879_17(int x) { return x * 17; }
+inline int f5879_18(int x) { return x * 18; }
+inline int f5879_19(int x) { return x * 19; }
+inline int f5879_20(int x) { return x * 20; }
+inline int f5879_21(int x) { return x * 21; }
+inline int f5879_22(int x) { return x * 22; }
+inline int f5879_23(int x) { return x * 23; }
+inline int f5879_24(int x) { return x * 24; }
+inline int f5879_25(int x) { return x * 25; }
+inline int f5879_26(int x) { return x * 26; }
+inline int f5879_27(int x) { return x * 27; }
+inline int f5879_28(int x) { return x * 28; }
+inline int f5879_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5883 */
+#include <vector>
+#include "h2846.h"
+#include "h7692.h"
+#include "h9523.h"
+#include "h6021.h"
+#include "h9087.h"
+#ifdef X
+#include "h7252.h"
+#endif
+struct S5883 { int a; const char *s = "x//y"; };
+inline int f5883_0(int x) { return x * 0; }
+inline int f5883_1(int x) { return x * 1; }
+inline int f5883_2(int x) { return x * 2; }
+inline int f5883_3(int x) { return x * 3; }
+inline int f5883_4(int x) { return x * 4; }
+inline int f5883_5(int x) { return x * 5; }
+inline int f5883_6(int x) { return x * 6; }
+inline int f5883_7(int x) { return x * 7; }
+inline int f5883_8(int x) { return x * 8; }
+inline int f5883_9(int x) { return x * 9; }
+inline int f5883_10(int x) { return x * 10; }
+inline int f5883_11(int x) { return x * 11; }
+inline int f5883_12(int x) { return x * 12; }
+inline int f5883_13(int x) { return x * 13; }
+inline int f5883_14(int x) { return x * 14; }
+inline int f5883_15(int x) { return x * 15; }
+inline int f5883_16(int x) { return x * 16; }
+inline int f5883_17(int x) { return x * 17; }
+inline int f5883_18(int x) { return x * 18; }
+inline int f5883_19(int x) { return x * 19; }
+inline int f5883_20(int x) { return x * 20; }
+inline int f5883_21(int x) { return x * 21; }
+inline int f5883_22(int x) { return x * 22; }
+inline int f5883_23(int x) { return x * 23; }
+inline int f5883_24(int x) { return x * 24; }
+inline int f5883_25(int x) { return x * 25; }
+inline int f5883_26(int x) { return x * 26; }
+inline int f5883_27(int x) { return x * 27; }
+inline int f5883_28(int x) { return x * 28; }
+inline int f5883_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5884 */
+#include <vector>
+#include "h897.h"
+#include "h4638.h"
+#include "h7540.h"
+#include "h7843.h"
+#include "h8270.h"
+#ifdef X
+#include "h3549.h"
+#endif
+struct S5884 { int a; const char *s = "x//y"; };
+inline int f5884_0(int x) { return x * 0; }
+inline int f5884_1(int x) { return x * 1; }
+inline int f5884_2(int x) { return x * 2; }
+inline int f5884_3(int x) { return x * 3; }
+inline int f5884_4(int x) { return x * 4; }
+inline int f5884_5(int x) { return x * 5; }
+inline int f5884_6(int x) { return x * 6; }
+inline int f5884_7(int x) { return x * 7; }
+inline int f5884_8(int x) { return x * 8; }
+inline int f5884_9(int x) { return x * 9; }
+inline int f5884_10(int x) { return x * 10; }
+inline int f5884_11(int x) { return x * 11; }
+inline int f5884_12(int x) { return x * 12; }
+inline int f5884_13(int x) { return x * 13; }
+inline int f5884_14(int x) { return x * 14; }
+inline int f5884_15(int x) { return x * 15; }
+inline int f5884_16(int x) { return x * 16; }
+inline int f5884_17(int x) { return x * 17; }
+inline int f5884_18(int x) { return x * 18; }
+inline int f5884_19(int x) { return x * 19; }
+inline int f5884_20(int x) { return x * 20; }
+inline int f5884_21(int x) { return x * 21; }
+inline int f5884_22(int x) { return x * 22; }
+inline int f5884_23(int x) { return x * 23; }
+inline int f5884_24(int x) { return x * 24; }
+inline int f5884_25(int x) { return x * 25; }
+inline int f5884_26(int x) { return x * 26; }
+inline int f5884_27(int x) { return x * 27; }
+inline int f5884_28(int x) { return x * 28; }
+inline int f5884_29(int x) { return x * 29; }
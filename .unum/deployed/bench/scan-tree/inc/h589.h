@@ -0,0 +1,42 @@
+#pragma once
+/* header 589 */
+#include <vector>
+#include "h48.h"
+#include "h8082.h"
+#include "h5390.h"
+#include "h1974.h"
+#include "h3697.h"
+#ifdef X
+#include "h4367.h"
+#endif
+struct S589 { int a; const char *s = "x//y"; };
+inline int f589_0(int x) { return x * 0; }
+inline int f589_1(int x) { return x * 1; }
+inline int f589_2(int x) { return x * 2; }
+inline int f589_3(int x) { return x * 3; }
+inline int f589_4(int x) { return x * 4; }
+inline int f589_5(int x) { return x * 5; }
+inline int f589_6(int x) { return x * 6; }
+inline int f589_7(int x) { return x * 7; }
+inline int f589_8(int x) { return x * 8; }
+inline int f589_9(int x) { return x * 9; }
+inline int f589_10(int x) { return x * 10; }
+inline int f589_11(int x) { return x * 11; }
+inline int f589_12(int x) { return x * 12; }
+inline int f589_13(int x) { return x * 13; }
+inline int f589_14(int x) { return x * 14; }
+inline int f589_15(int x) { return x * 15; }
+inline int f589_16(int x) { return x * 16; }
+inline int f589_17(int x) { return x * 17; }
+inline int f589_18(int x) { return x * 18; }
+inline int f589_19(int x) { return x * 19; }
+inline int f589_20(int x) { return x * 20; }
+inline int f589_21(int x) { return x * 21; }
+inline int f589_22(int x) { return x * 22; }
+inline int f589_23(int x) { return x * 23; }
+inline int f589_24(int x) { return x * 24; }
+inline int f589_25(int x) { return x * 25; }
+inline int f589_26(int x) { return x * 26; }
+inline int f589_27(int x) { return x * 27; }
+inline int f589_28(int x) { return x * 28; }
+inline int f589_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5890 */
+#include <vector>
+#include "h8242.h"
+#include "h2696.h"
+#include "h9660.h"
+#include "h4949.h"
+#include "h4316.h"
+#ifdef X
+#include "h2349.h"
+#endif
+struct S5890 { int a; const char *s = "x//y"; };
+inline int f5890_0(int x) { return x * 0; }
+inline int f5890_1(int x) { return x * 1; }
+inline int f5890_2(int x) { return x * 2; }
+inline int f5890_3(int x) { return x * 3; }
+inline int f5890_4(int x) { return x * 4; }
+inline int f5890_5(int x) { return x * 5; }
+inline int f5890_6(int x) { return x * 6; }
+inline int f5890_7(int x) { return x * 7; }
+inline int f5890_8(int x) { return x * 8; }
+inline int f5890_9(int x) { return x * 9; }
+inline int f5890_10(int x) { return x * 10; }
+inline int f5890_11(int x) { return x * 11; }
+inline int f5890_12(int x) { return x * 12; }
+inline int f5890_13(int x) { return x * 13; }
+inline int f5890_14(int x) { return x * 14; }
+inline int f5890_15(int x) { return x * 15; }
+inline int f5890_16(int x) { return x * 16; }
+inline int f5890_17(int x) { return x * 17; }
+inline int f5890_18(int x) { return x * 18; }
+inline int f5890_19(int x) { return x * 19; }
+inline int f5890_20(int x) { return x * 20; }
+inline int f5890_21(int x) { return x * 21; }
+inline int f5890_22(int x) { return x * 22; }
+inline int f5890_23(int x) { return x * 23; }
+inline int f5890_24(int x) { return x * 24; }
+inline int f5890_25(int x) { return x * 25; }
+inline int f5890_26(int x) { return x * 26; }
+inline int f5890_27(int x) { return x * 27; }
+inline int f5890_28(int x) { return x * 28; }
+inline int f5890_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5891 */
+#include <vector>
+#include "h50.h"
+#include "h5679.h"
+#include "h5670.h"
+#include "h8309.h"
+#include "h2812.h"
+#ifdef X
+#include "h4674.h"
+#endif
+struct S5891 { int a; const char *s = "x//y"; };
+inline int f5891_0(int x) { return x * 0; }
+inline int f5891_1(int x) { return x * 1; }
+inline int f5891_2(int x) { return x * 2; }
+inline int f5891_3(int x) { return x * 3; }
+inline int f5891_4(int x) { return x * 4; }
+inline int f5891_5(int x) { return x * 5; }
+inline int f5891_6(int x) { return x * 6; }
+inline int f5891_7(int x) { return x * 7; }
+inline int f5891_8(int x) { return x * 8; }
+inline int f5891_9(int x) { return x * 9; }
+inline int f5891_10(int x) { return x * 10; }
+inline int f5891_11(int x) { return x * 11; }
+inline int f5891_12(int x) { return x * 12; }
+inline int f5891_13(int x) { return x * 13; }
+inline int f5891_14(int x) { return x * 14; }
+inline int f5891_15(int x) { return x * 15; }
+inline int f5891_16(int x) { return x * 16; }
+inline int f5891_17(int x) { return x * 17; }
+inline int f5891_18(int x) { return x * 18; }
+inline int f5891_19(int x) { return x * 19; }
+inline int f5891_20(int x) { return x * 20; }
+inline int f5891_21(int x) { return x * 21; }
+inline int f5891_22(int x) { return x * 22; }
+inline int f5891_23(int x) { return x * 23; }
+inline int f5891_24(int x) { return x * 24; }
+inline int f5891_25(int x) { return x * 25; }
+inline int f5891_26(int x) { return x * 26; }
+inline int f5891_27(int x) { return x * 27; }
+inline int f5891_28(int x) { return x * 28; }
+inline int f5891_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5895 */
+#include <vector>
+#include "h8058.h"
+#include "h8312.h"
+#include "h2144.h"
+#include "h4921.h"
+#include "h2214.h"
+#ifdef X
+#include "h5394.h"
+#endif
+struct S5895 { int a; const char *s = "x//y"; };
+inline int f5895_0(int x) { return x * 0; }
+inline int f5895_1(int x) { return x * 1; }
+inline int f5895_2(int x) { return x * 2; }
+inline int f5895_3(int x) { return x * 3; }
+inline int f5895_4(int x) { return x * 4; }
+inline int f5895_5(int x) { return x * 5; }
+inline int f5895_6(int x) { return x * 6; }
+inline int f5895_7(int x) { return x * 7; }
+inline int f5895_8(int x) { return x * 8; }
+inline int f5895_9(int x) { return x * 9; }
+inline int f5895_10(int x) { return x * 10; }
+inline int f5895_11(int x) { return x * 11; }
+inline int f5895_12(int x) { return x * 12; }
+inline int f5895_13(int x) { return x * 13; }
+inline int f5895_14(int x) { return x * 14; }
+inline int f5895_15(int x) { return x * 15; }
+inline int f5895_16(int x) { return x * 16; }
+inline int f5895_17(int x) { return x * 17; }
+inline int f5895_18(int x) { return x * 18; }
+inline int f5895_19(int x) { return x * 19; }
+inline int f5895_20(int x) { return x * 20; }
+inline int f5895_21(int x) { return x * 21; }
+inline int f5895_22(int x) { return x * 22; }
+inline int f5895_23(int x) { return x * 23; }
+inline int f5895_24(int x) { return x * 24; }
+inline int f5895_25(int x) { return x * 25; }
+inline int f5895_26(int x) { return x * 26; }
+inline int f5895_27(int x) { return x * 27; }
+inline int f5895_28(int x) { return x * 28; }
+inline int f5895_29(int x) { return x * 29; }
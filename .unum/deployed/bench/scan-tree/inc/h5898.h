@@ -0,0 +1,42 @@
+#pragma once
+/* header 5898 */
+#include <vector>
+#include "h5368.h"
+#include "h2483.h"
+#include "h29.h"
+#include "h6730.h"
+#include "h6493.h"
+#ifdef X
+#include "h5419.h"
+#endif
+struct S5898 { int a; const char *s = "x//y"; };
+inline int f5898_0(int x) { return x * 0; }
+inline int f5898_1(int x) { return x * 1; }
+inline int f5898_2(int x) { return x * 2; }
+inline int f5898_3(int x) { return x * 3; }
+inline int f5898_4(int x) { return x * 4; }
+inline int f5898_5(int x) { return x * 5; }
+inline int f5898_6(int x) { return x * 6; }
+inline int f5898_7(int x) { return x * 7; }
+inline int f5898_8(int x) { return x * 8; }
+inline int f5898_9(int x) { return x * 9; }
+inline int f5898_10(int x) { return x * 10; }
+inline int f5898_11(int x) { return x * 11; }
+inline int f5898_12(int x) { return x * 12; }
+inline int f5898_13(int x) { return x * 13; }
+inline int f5898_14(int x) { return x * 14; }
+inline int f5898_15(int x) { return x * 15; }
+inline int f5898_16(int x) { return x * 16; }
+inline int f5898_17(int x) { return x * 17; }
+inline int f5898_18(int x) { return x * 18; }
+inline int f5898_19(int x) { return x * 19; }
+inline int f5898_20(int x) { return x * 20; }
+inline int f5898_21(int x) { return x * 21; }
+inline int f5898_22(int x) { return x * 22; }
+inline int f5898_23(int x) { return x * 23; }
+inline int f5898_24(int x) { return x * 24; }
+inline int f5898_25(int x) { return x * 25; }
+inline int f5898_26(int x) { return x * 26; }
+inline int f5898_27(int x) { return x * 27; }
+inline int f5898_28(int x) { return x * 28; }
+inline int f5898_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 59 */
+#include <vector>
+#include "h2262.h"
+#include "h5298.h"
+#include "h7095.h"
+#include "h1219.h"
+#include "h3463.h"
+#ifdef X
+#include "h4128.h"
+#endif
+struct S59 { int a; const char *s = "x//y"; };
+inline int f59_0(int x) { return x * 0; }
+inline int f59_1(int x) { return x * 1; }
+inline int f59_2(int x) { return x * 2; }
+inline int f59_3(int x) { return x * 3; }
+inline int f59_4(int x) { return x * 4; }
+inline int f59_5(int x) { return x * 5; }
+inline int f59_6(int x) { return x * 6; }
+inline int f59_7(int x) { return x * 7; }
+inline int f59_8(int x) { return x * 8; }
+inline int f59_9(int x) { return x * 9; }
+inline int f59_10(int x) { return x * 10; }
+inline int f59_11(int x) { return x * 11; }
+inline int f59_12(int x) { return x * 12; }
+inline int f59_13(int x) { return x * 13; }
+inline int f59_14(int x) { return x * 14; }
+inline int f59_15(int x) { return x * 15; }
+inline int f59_16(int x) { return x * 16; }
+inline int f59_17(int x) { return x * 17; }
+inline int f59_18(int x) { return x * 18; }
+inline int f59_19(int x) { return x * 19; }
+inline int f59_20(int x) { return x * 20; }
+inline int f59_21(int x) { return x * 21; }
+inline int f59_22(int x) { return x * 22; }
+inline int f59_23(int x) { return x * 23; }
+inline int f59_24(int x) { return x * 24; }
+inline int f59_25(int x) { return x * 25; }
+inline int f59_26(int x) { return x * 26; }
+inline int f59_27(int x) { return x * 27; }
+inline int f59_28(int x) { return x * 28; }
+inline int f59_29(int x) { return x * 29; }
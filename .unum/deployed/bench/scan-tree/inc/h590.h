@@ -0,0 +1,42 @@
+#pragma once
+/* header 590 */
+#include <vector>
+#include "h7576.h"
+#include "h5844.h"
+#include "h7293.h"
+#include "h8308.h"
+#include "h3204.h"
+#ifdef X
+#include "h1641.h"
+#endif
+struct S590 { int a; const char *s = "x//y"; };
+inline int f590_0(int x) { return x * 0; }
+inline int f590_1(int x) { return x * 1; }
+inline int f590_2(int x) { return x * 2; }
+inline int f590_3(int x) { return x * 3; }
+inline int f590_4(int x) { return x * 4; }
+inline int f590_5(int x) { return x * 5; }
+inline int f590_6(int x) { return x * 6; }
+inline int f590_7(int x) { return x * 7; }
+inline int f590_8(int x) { return x * 8; }
+inline int f590_9(int x) { return x * 9; }
+inline int f590_10(int x) { return x * 10; }
+inline int f590_11(int x) { return x * 11; }
+inline int f590_12(int x) { return x * 12; }
+inline int f590_13(int x) { return x * 13; }
+inline int f590_14(int x) { return x * 14; }
+inline int f590_15(int x) { return x * 15; }
+inline int f590_16(int x) { return x * 16; }
+inline int f590_17(int x) { return x * 17; }
+inline int f590_18(int x) { return x * 18; }
+inline int f590_19(int x) { return x * 19; }
+inline int f590_20(int x) { return x * 20; }
+inline int f590_21(int x) { return x * 21; }
+inline int f590_22(int x) { return x * 22; }
+inline int f590_23(int x) { return x * 23; }
+inline int f590_24(int x) { return x * 24; }
+inline int f590_25(int x) { return x * 25; }
+inline int f590_26(int x) { return x * 26; }
+inline int f590_27(int x) { return x * 27; }
+inline int f590_28(int x) { return x * 28; }
+inline int f590_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5901 */
+#include <vector>
+#include "h2426.h"
+#include "h5262.h"
+#include "h8337.h"
+#include "h7035.h"
+#include "h2716.h"
+#ifdef X
+#include "h4684.h"
+#endif
+struct S5901 { int a; const char *s = "x//y"; };
+inline int f5901_0(int x) { return x * 0; }
+inline int f5901_1(int x) { return x * 1; }
+inline int f5901_2(int x) { return x * 2; }
+inline int f5901_3(int x) { return x * 3; }
+inline int f5901_4(int x) { return x * 4; }
+inline int f5901_5(int x) { return x * 5; }
+inline int f5901_6(int x) { return x * 6; }
+inline int f5901_7(int x) { return x * 7; }
+inline int f5901_8(int x) { return x * 8; }
+inline int f5901_9(int x) { return x * 9; }
+inline int f5901_10(int x) { return x * 10; }
+inline int f5901_11(int x) { return x * 11; }
+inline int f5901_12(int x) { return x * 12; }
+inline int f5901_13(int x) { return x * 13; }
+inline int f5901_14(int x) { return x * 14; }
+inline int f5901_15(int x) { return x * 15; }
+inline int f5901_16(int x) { return x * 16; }
+inline int f5901_17(int x) { return x * 17; }
+inline int f5901_18(int x) { return x * 18; }
+inline int f5901_19(int x) { return x * 19; }
+inline int f5901_20(int x) { return x * 20; }
+inline int f5901_21(int x) { return x * 21; }
+inline int f5901_22(int x) { return x * 22; }
+inline int f5901_23(int x) { return x * 23; }
+inline int f5901_24(int x) { return x * 24; }
+inline int f5901_25(int x) { return x * 25; }
+inline int f5901_26(int x) { return x * 26; }
+inline int f5901_27(int x) { return x * 27; }
+inline int f5901_28(int x) { return x * 28; }
+inline int f5901_29(int x) { return x * 29; }
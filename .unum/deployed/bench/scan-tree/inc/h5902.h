@@ -0,0 +1,42 @@
+#pragma once
+/* header 5902 */
+#include <vector>
+#include "h1507.h"
+#include "h2299.h"
+#include "h1531.h"
+#include "h5246.h"
+#include "h2289.h"
+#ifdef X
+#include "h2357.h"
+#endif
+struct S5902 { int a; const char *s = "x//y"; };
+inline int f5902_0(int x) { return x * 0; }
+inline int f5902_1(int x) { return x * 1; }
+inline int f5902_2(int x) { return x * 2; }
+inline int f5902_3(int x) { return x * 3; }
+inline int f5902_4(int x) { return x * 4; }
+inline int f5902_5(int x) { return x * 5; }
+inline int f5902_6(int x) { return x * 6; }
+inline int f5902_7(int x) { return x * 7; }
+inline int f5902_8(int x) { return x * 8; }
+inline int f5902_9(int x) { return x * 9; }
+inline int f5902_10(int x) { return x * 10; }
+inline int f5902_11(int x) { return x * 11; }
+inline int f5902_12(int x) { return x * 12; }
+inline int f5902_13(int x) { return x * 13; }
+inline int f5902_14(int x) { return x * 14; }
+inline int f5902_15(int x) { return x * 15; }
+inline int f5902_16(int x) { return x * 16; }
+inline int f5902_17(int x) { return x * 17; }
+inline int f5902_18(int x) { return x * 18; }
+inline int f5902_19(int x) { return x * 19; }
+inline int f5902_20(int x) { return x * 20; }
+inline int f5902_21(int x) { return x * 21; }
+inline int f5902_22(int x) { return x * 22; }
+inline int f5902_23(int x) { return x * 23; }
+inline int f5902_24(int x) { return x * 24; }
+inline int f5902_25(int x) { return x * 25; }
+inline int f5902_26(int x) { return x * 26; }
+inline int f5902_27(int x) { return x * 27; }
+inline int f5902_28(int x) { return x * 28; }
+inline int f5902_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5903 */
+#include <vector>
+#include "h4682.h"
+#include "h5856.h"
+#include "h6962.h"
+#include "h3970.h"
+#include "h677.h"
+#ifdef X
+#include "h7714.h"
+#endif
+struct S5903 { int a; const char *s = "x//y"; };
+inline int f5903_0(int x) { return x * 0; }
+inline int f5903_1(int x) { return x * 1; }
+inline int f5903_2(int x) { return x * 2; }
+inline int f5903_3(int x) { return x * 3; }
+inline int f5903_4(int x) { return x * 4; }
+inline int f5903_5(int x) { return x * 5; }
+inline int f5903_6(int x) { return x * 6; }
+inline int f5903_7(int x) { return x * 7; }
+inline int f5903_8(int x) { return x * 8; }
+inline int f5903_9(int x) { return x * 9; }
+inline int f5903_10(int x) { return x * 10; }
+inline int f5903_11(int x) { return x * 11; }
+inline int f5903_12(int x) { return x * 12; }
+inline int f5903_13(int x) { return x * 13; }
+inline int f5903_14(int x) { return x * 14; }
+inline int f5903_15(int x) { return x * 15; }
+inline int f5903_16(int x) { return x * 16; }
+inline int f5903_17(int x) { return x * 17; }
+inline int f5903_18(int x) { return x * 18; }
+inline int f5903_19(int x) { return x * 19; }
+inline int f5903_20(int x) { return x * 20; }
+inline int f5903_21(int x) { return x * 21; }
+inline int f5903_22(int x) { return x * 22; }
+inline int f5903_23(int x) { return x * 23; }
+inline int f5903_24(int x) { return x * 24; }
+inline int f5903_25(int x) { return x * 25; }
+inline int f5903_26(int x) { return x * 26; }
+inline int f5903_27(int x) { return x * 27; }
+inline int f5903_28(int x) { return x * 28; }
+inline int f5903_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5905 */
+#include <vector>
+#include "h6789.h"
+#include "h3886.h"
+#include "h4697.h"
+#include "h2639.h"
+#include "h3992.h"
+#ifdef X
+#include "h6738.h"
+#endif
+struct S5905 { int a; const char *s = "x//y"; };
+inline int f5905_0(int x) { return x * 0; }
+inline int f5905_1(int x) { return x * 1; }
+inline int f5905_2(int x) { return x * 2; }
+inline int f5905_3(int x) { return x * 3; }
+inline int f5905_4(int x) { return x * 4; }
+inline int f5905_5(int x) { return x * 5; }
+inline int f5905_6(int x) { return x * 6; }
+inline int f5905_7(int x) { return x * 7; }
+inline int f5905_8(int x) { return x * 8; }
+inline int f5905_9(int x) { return x * 9; }
+inline int f5905_10(int x) { return x * 10; }
+inline int f5905_11(int x) { return x * 11; }
+inline int f5905_12(int x) { return x * 12; }
+inline int f5905_13(int x) { return x * 13; }
+inline int f5905_14(int x) { return x * 14; }
+inline int f5905_15(int x) { return x * 15; }
+inline int f5905_16(int x) { return x * 16; }
+inline int f5905_17(int x) { return x * 17; }
+inline int f5905_18(int x) { return x * 18; }
+inline int f5905_19(int x) { return x * 19; }
+inline int f5905_20(int x) { return x * 20; }
+inline int f5905_21(int x) { return x * 21; }
+inline int f5905_22(int x) { return x * 22; }
+inline int f5905_23(int x) { return x * 23; }
+inline int f5905_24(int x) { return x * 24; }
+inline int f5905_25(int x) { return x * 25; }
+inline int f5905_26(int x) { return x * 26; }
+inline int f5905_27(int x) { return x * 27; }
+inline int f5905_28(int x) { return x * 28; }
+inline int f5905_29(int x) { return x * 29; }
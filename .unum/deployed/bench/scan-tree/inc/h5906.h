@@ -0,0 +1,42 @@
+#pragma once
+/* header 5906 */
+#include <vector>
+#include "h7914.h"
+#include "h8892.h"
+#include "h3577.h"
+#include "h6300.h"
+#include "h3608.h"
+#ifdef X
+#include "h3077.h"
+#endif
+struct S5906 { int a; const char *s = "x//y"; };
+inline int f5906_0(int x) { return x * 0; }
+inline int f5906_1(int x) { return x * 1; }
+inline int f5906_2(int x) { return x * 2; }
+inline int f5906_3(int x) { return x * 3; }
+inline int f5906_4(int x) { return x * 4; }
+inline int f5906_5(int x) { return x * 5; }
+inline int f5906_6(int x) { return x * 6; }
+inline int f5906_7(int x) { return x * 7; }
+inline int f5906_8(int x) { return x * 8; }
+inline int f5906_9(int x) { return x * 9; }
+inline int f5906_10(int x) { return x * 10; }
+inline int f5906_11(int x) { return x * 11; }
+inline int f5906_12(int x) { return x * 12; }
+inline int f5906_13(int x) { return x * 13; }
+inline int f5906_14(int x) { return x * 14; }
+inline int f5906_15(int x) { return x * 15; }
+inline int f5906_16(int x) { return x * 16; }
+inline int f5906_17(int x) { return x * 17; }
+inline int f5906_18(int x) { return x * 18; }
+inline int f5906_19(int x) { return x * 19; }
+inline int f5906_20(int x) { return x * 20; }
+inline int f5906_21(int x) { return x * 21; }
+inline int f5906_22(int x) { return x * 22; }
+inline int f5906_23(int x) { return x * 23; }
+inline int f5906_24(int x) { return x * 24; }
+inline int f5906_25(int x) { return x * 25; }
+inline int f5906_26(int x) { return x * 26; }
+inline int f5906_27(int x) { return x * 27; }
+inline int f5906_28(int x) { return x * 28; }
+inline int f5906_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5907 */
+#include <vector>
+#include "h2080.h"
+#include "h9664.h"
+#include "h6498.h"
+#include "h2570.h"
+#include "h2633.h"
+#ifdef X
+#include "h2277.h"
+#endif
+struct S5907 { int a; const char *s = "x//y"; };
+inline int f5907_0(int x) { return x * 0; }
+inline int f5907_1(int x) { return x * 1; }
+inline int f5907_2(int x) { return x * 2; }
+inline int f5907_3(int x) { return x * 3; }
+inline int f5907_4(int x) { return x * 4; }
+inline int f5907_5(int x) { return x * 5; }
+inline int f5907_6(int x) { return x * 6; }
+inline int f5907_7(int x) { return x * 7; }
+inline int f5907_8(int x) { return x * 8; }
+inline int f5907_9(int x) { return x * 9; }
+inline int f5907_10(int x) { return x * 10; }
+inline int f5907_11(int x) { return x * 11; }
+inline int f5907_12(int x) { return x * 12; }
+inline int f5907_13(int x) { return x * 13; }
+inline int f5907_14(int x) { return x * 14; }
+inline int f5907_15(int x) { return x * 15; }
+inline int f5907_16(int x) { return x * 16; }
+inline int f5907_17(int x) { return x * 17; }
+inline int f5907_18(int x) { return x * 18; }
+inline int f5907_19(int x) { return x * 19; }
+inline int f5907_20(int x) { return x * 20; }
+inline int f5907_21(int x) { return x * 21; }
+inline int f5907_22(int x) { return x * 22; }
+inline int f5907_23(int x) { return x * 23; }
+inline int f5907_24(int x) { return x * 24; }
+inline int f5907_25(int x) { return x * 25; }
+inline int f5907_26(int x) { return x * 26; }
+inline int f5907_27(int x) { return x * 27; }
+inline int f5907_28(int x) { return x * 28; }
+inline int f5907_29(int x) { return x * 29; }
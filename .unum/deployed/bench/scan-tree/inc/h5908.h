@@ -0,0 +1,42 @@
+#pragma once
+/* header 5908 */
+#include <vector>
+#include "h6582.h"
+#include "h4990.h"
+#include "h9622.h"
+#include "h981.h"
+#include "h8931.h"
+#ifdef X
+#include "h6807.h"
+#endif
+struct S5908 { int a; const char *s = "x//y"; };
+inline int f5908_0(int x) { return x * 0; }
+inline int f5908_1(int x) { return x * 1; }
+inline int f5908_2(int x) { return x * 2; }
+inline int f5908_3(int x) { return x * 3; }
+inline int f5908_4(int x) { return x * 4; }
+inline int f5908_5(int x) { return x * 5; }
+inline int f5908_6(int x) { return x * 6; }
+inline int f5908_7(int x) { return x * 7; }
+inline int f5908_8(int x) { return x * 8; }
+inline int f5908_9(int x) { return x * 9; }
+inline int f5908_10(int x) { return x * 10; }
+inline int f5908_11(int x) { return x * 11; }
+inline int f5908_12(int x) { return x * 12; }
+inline int f5908_13(int x) { return x * 13; }
+inline int f5908_14(int x) { return x * 14; }
+inline int f5908_15(int x) { return x * 15; }
+inline int f5908_16(int x) { return x * 16; }
+inline int f5908_17(int x) { return x * 17; }
+inline int f5908_18(int x) { return x * 18; }
+inline int f5908_19(int x) { return x * 19; }
+inline int f5908_20(int x) { return x * 20; }
+inline int f5908_21(int x) { return x * 21; }
+inline int f5908_22(int x) { return x * 22; }
+inline int f5908_23(int x) { return x * 23; }
+inline int f5908_24(int x) { return x * 24; }
+inline int f5908_25(int x) { return x * 25; }
+inline int f5908_26(int x) { return x * 26; }
+inline int f5908_27(int x) { return x * 27; }
+inline int f5908_28(int x) { return x * 28; }
+inline int f5908_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5912 */
+#include <vector>
+#include "h7562.h"
+#include "h5185.h"
+#include "h6526.h"
+#include "h3881.h"
+#include "h4528.h"
+#ifdef X
+#include "h8804.h"
+#endif
+struct S5912 { int a; const char *s = "x//y"; };
+inline int f5912_0(int x) { return x * 0; }
+inline int f5912_1(int x) { return x * 1; }
+inline int f5912_2(int x) { return x * 2; }
+inline int f5912_3(int x) { return x * 3; }
+inline int f5912_4(int x) { return x * 4; }
+inline int f5912_5(int x) { return x * 5; }
+inline int f5912_6(int x) { return x * 6; }
+inline int f5912_7(int x) { return x * 7; }
+inline int f5912_8(int x) { return x * 8; }
+inline int f5912_9(int x) { return x * 9; }
+inline int f5912_10(int x) { return x * 10; }
+inline int f5912_11(int x) { return x * 11; }
+inline int f5912_12(int x) { return x * 12; }
+inline int f5912_13(int x) { return x * 13; }
+inline int f5912_14(int x) { return x * 14; }
+inline int f5912_15(int x) { return x * 15; }
+inline int f5912_16(int x) { return x * 16; }
+inline int f5912_17(int x) { return x * 17; }
+inline int f5912_18(int x) { return x * 18; }
+inline int f5912_19(int x) { return x * 19; }
+inline int f5912_20(int x) { return x * 20; }
+inline int f5912_21(int x) { return x * 21; }
+inline int f5912_22(int x) { return x * 22; }
+inline int f5912_23(int x) { return x * 23; }
+inline int f5912_24(int x) { return x * 24; }
+inline int f5912_25(int x) { return x * 25; }
+inline int f5912_26(int x) { return x * 26; }
+inline int f5912_27(int x) { return x * 27; }
+inline int f5912_28(int x) { return x * 28; }
+inline int f5912_29(int x) { return x * 29; }
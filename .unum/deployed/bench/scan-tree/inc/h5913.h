@@ -0,0 +1,42 @@
+#pragma once
+/* header 5913 */
+#include <vector>
+#include "h2205.h"
+#include "h1421.h"
+#include "h780.h"
+#include "h1483.h"
+#include "h5483.h"
+#ifdef X
+#include "h8384.h"
+#endif
+struct S5913 { int a; const char *s = "x//y"; };
+inline int f5913_0(int x) { return x * 0; }
+inline int f5913_1(int x) { return x * 1; }
+inline int f5913_2(int x) { return x * 2; }
+inline int f5913_3(int x) { return x * 3; }
+inline int f5913_4(int x) { return x * 4; }
+inline int f5913_5(int x) { return x * 5; }
+inline int f5913_6(int x) { return x * 6; }
+inline int f5913_7(int x) { return x * 7; }
+inline int f5913_8(int x) { return x * 8; }
+inline int f5913_9(int x) { return x * 9; }
+inline int f5913_10(int x) { return x * 10; }
+inline int f5913_11(int x) { return x * 11; }
+inline int f5913_12(int x) { return x * 12; }
+inline int f5913_13(int x) { return x * 13; }
+inline int f5913_14(int x) { return x * 14; }
+inline int f5913_15(int x) { return x * 15; }
+inline int f5913_16(int x) { return x * 16; }
+inline int f5913_17(int x) { return x * 17; }
+inline int f5913_18(int x) { return x * 18; }
+inline int f5913_19(int x) { return x * 19; }
+inline int f5913_20(int x) { return x * 20; }
+inline int f5913_21(int x) { return x * 21; }
+inline int f5913_22(int x) { return x * 22; }
+inline int f5913_23(int x) { return x * 23; }
+inline int f5913_24(int x) { return x * 24; }
+inline int f5913_25(int x) { return x * 25; }
+inline int f5913_26(int x) { return x * 26; }
+inline int f5913_27(int x) { return x * 27; }
+inline int f5913_28(int x) { return x * 28; }
+inline int f5913_29(int x) { return x * 29; }
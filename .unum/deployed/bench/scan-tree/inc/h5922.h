@@ -0,0 +1,42 @@
+#pragma once
+/* header 5922 */
+#include <vector>
+#include "h6207.h"
+#include "h8128.h"
+#include "h2138.h"
+#include "h6305.h"
+#include "h122.h"
+#ifdef X
+#include "h1401.h"
+#endif
+struct S5922 { int a; const char *s = "x//y"; };
+inline int f5922_0(int x) { return x * 0; }
+inline int f5922_1(int x) { return x * 1; }
+inline int f5922_2(int x) { return x * 2; }
+inline int f5922_3(int x) { return x * 3; }
+inline int f5922_4(int x) { return x * 4; }
+inline int f5922_5(int x) { return x * 5; }
+inline int f5922_6(int x) { return x * 6; }
+inline int f5922_7(int x) { return x * 7; }
+inline int f5922_8(int x) { return x * 8; }
+inline int f5922_9(int x) { return x * 9; }
+inline int f5922_10(int x) { return x * 10; }
+inline int f5922_11(int x) { return x * 11; }
+inline int f5922_12(int x) { return x * 12; }
+inline int f5922_13(int x) { return x * 13; }
+inline int f5922_14(int x) { return x * 14; }
+inline int f5922_15(int x) { return x * 15; }
+inline int f5922_16(int x) { return x * 16; }
+inline int f5922_17(int x) { return x * 17; }
+inline int f5922_18(int x) { return x * 18; }
+inline int f5922_19(int x) { return x * 19; }
+inline int f5922_20(int x) { return x * 20; }
+inline int f5922_21(int x) { return x * 21; }
+inline int f5922_22(int x) { return x * 22; }
+inline int f5922_23(int x) { return x * 23; }
+inline int f5922_24(int x) { return x * 24; }
+inline int f5922_25(int x) { return x * 25; }
+inline int f5922_26(int x) { return x * 26; }
+inline int f5922_27(int x) { return x * 27; }
+inline int f5922_28(int x) { return x * 28; }
+inline int f5922_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5923 */
+#include <vector>
+#include "h5283.h"
+#include "h908.h"
+#include "h8803.h"
+#include "h3088.h"
+#include "h7958.h"
+#ifdef X
+#include "h6332.h"
+#endif
+struct S5923 { int a; const char *s = "x//y"; };
+inline int f5923_0(int x) { return x * 0; }
+inline int f5923_1(int x) { return x * 1; }
+inline int f5923_2(int x) { return x * 2; }
+inline int f5923_3(int x) { return x * 3; }
+inline int f5923_4(int x) { return x * 4; }
+inline int f5923_5(int x) { return x * 5; }
+inline int f5923_6(int x) { return x * 6; }
+inline int f5923_7(int x) { return x * 7; }
+inline int f5923_8(int x) { return x * 8; }
+inline int f5923_9(int x) { return x * 9; }
+inline int f5923_10(int x) { return x * 10; }
+inline int f5923_11(int x) { return x * 11; }
+inline int f5923_12(int x) { return x * 12; }
+inline int f5923_13(int x) { return x * 13; }
+inline int f5923_14(int x) { return x * 14; }
+inline int f5923_15(int x) { return x * 15; }
+inline int f5923_16(int x) { return x * 16; }
+inline int f5923_17(int x) { return x * 17; }
+inline int f5923_18(int x) { return x * 18; }
+inline int f5923_19(int x) { return x * 19; }
+inline int f5923_20(int x) { return x * 20; }
+inline int f5923_21(int x) { return x * 21; }
+inline int f5923_22(int x) { return x * 22; }
+inline int f5923_23(int x) { return x * 23; }
+inline int f5923_24(int x) { return x * 24; }
+inline int f5923_25(int x) { return x * 25; }
+inline int f5923_26(int x) { return x * 26; }
+inline int f5923_27(int x) { return x * 27; }
+inline int f5923_28(int x) { return x * 28; }
+inline int f5923_29(int x) { return x * 29; }
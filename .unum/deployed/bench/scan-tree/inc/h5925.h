@@ -0,0 +1,42 @@
+#pragma once
+/* header 5925 */
+#include <vector>
+#include "h1353.h"
+#include "h9758.h"
+#include "h3529.h"
+#include "h5004.h"
+#include "h2500.h"
+#ifdef X
+#include "h1733.h"
+#endif
+struct S5925 { int a; const char *s = "x//y"; };
+inline int f5925_0(int x) { return x * 0; }
+inline int f5925_1(int x) { return x * 1; }
+inline int f5925_2(int x) { return x * 2; }
+inline int f5925_3(int x) { return x * 3; }
+inline int f5925_4(int x) { return x * 4; }
+inline int f5925_5(int x) { return x * 5; }
+inline int f5925_6(int x) { return x * 6; }
+inline int f5925_7(int x) { return x * 7; }
+inline int f5925_8(int x) { return x * 8; }
+inline int f5925_9(int x) { return x * 9; }
+inline int f5925_10(int x) { return x * 10; }
+inline int f5925_11(int x) { return x * 11; }
+inline int f5925_12(int x) { return x * 12; }
+inline int f5925_13(int x) { return x * 13; }
+inline int f5925_14(int x) { return x * 14; }
+inline int f5925_15(int x) { return x * 15; }
+inline int f5925_16(int x) { return x * 16; }
+inline int f5925_17(int x) { return x * 17; }
+inline int f5925_18(int x) { return x * 18; }
+inline int f5925_19(int x) { return x * 19; }
+inline int f5925_20(int x) { return x * 20; }
+inline int f5925_21(int x) { return x * 21; }
+inline int f5925_22(int x) { return x * 22; }
+inline int f5925_23(int x) { return x * 23; }
+inline int f5925_24(int x) { return x * 24; }
+inline int f5925_25(int x) { return x * 25; }
+inline int f5925_26(int x) { return x * 26; }
+inline int f5925_27(int x) { return x * 27; }
+inline int f5925_28(int x) { return x * 28; }
+inline int f5925_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5927 */
+#include <vector>
+#include "h2474.h"
+#include "h6781.h"
+#include "h9610.h"
+#include "h3044.h"
+#include "h1467.h"
+#ifdef X
+#include "h3405.h"
+#endif
+struct S5927 { int a; const char *s = "x//y"; };
+inline int f5927_0(int x) { return x * 0; }
+inline int f5927_1(int x) { return x * 1; }
+inline int f5927_2(int x) { return x * 2; }
+inline int f5927_3(int x) { return x * 3; }
+inline int f5927_4(int x) { return x * 4; }
+inline int f5927_5(int x) { return x * 5; }
+inline int f5927_6(int x) { return x * 6; }
+inline int f5927_7(int x) { return x * 7; }
+inline int f5927_8(int x) { return x * 8; }
+inline int f5927_9(int x) { return x * 9; }
+inline int f5927_10(int x) { return x * 10; }
+inline int f5927_11(int x) { return x * 11; }
+inline int f5927_12(int x) { return x * 12; }
+inline int f5927_13(int x) { return x * 13; }
+inline int f5927_14(int x) { return x * 14; }
+inline int f5927_15(int x) { return x * 15; }
+inline int f5927_16(int x) { return x * 16; }
+inline int f5927_17(int x) { return x * 17; }
+inline int f5927_18(int x) { return x * 18; }
+inline int f5927_19(int x) { return x * 19; }
+inline int f5927_20(int x) { return x * 20; }
+inline int f5927_21(int x) { return x * 21; }
+inline int f5927_22(int x) { return x * 22; }
+inline int f5927_23(int x) { return x * 23; }
+inline int f5927_24(int x) { return x * 24; }
+inline int f5927_25(int x) { return x * 25; }
+inline int f5927_26(int x) { return x * 26; }
+inline int f5927_27(int x) { return x * 27; }
+inline int f5927_28(int x) { return x * 28; }
+inline int f5927_29(int x) { return x * 29; }
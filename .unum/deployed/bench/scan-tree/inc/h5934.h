@@ -0,0 +1,42 @@
+#pragma once
+/* header 5934 */
+#include <vector>
+#include "h5636.h"
+#include "h5316.h"
+#include "h2694.h"
+#include "h3812.h"
+#include "h6980.h"
+#ifdef X
+#include "h4351.h"
+#endif
+struct S5934 { int a; const char *s = "x//y"; };
+inline int f5934_0(int x) { return x * 0; }
+inline int f5934_1(int x) { return x * 1; }
+inline int f5934_2(int x) { return x * 2; }
+inline int f5934_3(int x) { return x * 3; }
+inline int f5934_4(int x) { return x * 4; }
+inline int f5934_5(int x) { return x * 5; }
+inline int f5934_6(int x) { return x * 6; }
+inline int f5934_7(int x) { return x * 7; }
+inline int f5934_8(int x) { return x * 8; }
+inline int f5934_9(int x) { return x * 9; }
+inline int f5934_10(int x) { return x * 10; }
+inline int f5934_11(int x) { return x * 11; }
+inline int f5934_12(int x) { return x * 12; }
+inline int f5934_13(int x) { return x * 13; }
+inline int f5934_14(int x) { return x * 14; }
+inline int f5934_15(int x) { return x * 15; }
+inline int f5934_16(int x) { return x * 16; }
+inline int f5934_17(int x) { return x * 17; }
+inline int f5934_18(int x) { return x * 18; }
+inline int f5934_19(int x) { return x * 19; }
+inline int f5934_20(int x) { return x * 20; }
+inline int f5934_21(int x) { return x * 21; }
+inline int f5934_22(int x) { return x * 22; }
+inline int f5934_23(int x) { return x * 23; }
+inline int f5934_24(int x) { return x * 24; }
+inline int f5934_25(int x) { return x * 25; }
+inline int f5934_26(int x) { return x * 26; }
+inline int f5934_27(int x) { return x * 27; }
+inline int f5934_28(int x) { return x * 28; }
+inline int f5934_29(int x) { return x * 29; }
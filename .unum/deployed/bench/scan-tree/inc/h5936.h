@@ -0,0 +1,42 @@
+#pragma once
+/* header 5936 */
+#include <vector>
+#include "h5738.h"
+#include "h3372.h"
+#include "h2323.h"
+#include "h7689.h"
+#include "h3041.h"
+#ifdef X
+#include "h2745.h"
+#endif
+struct S5936 { int a; const char *s = "x//y"; };
+inline int f5936_0(int x) { return x * 0; }
+inline int f5936_1(int x) { return x * 1; }
+inline int f5936_2(int x) { return x * 2; }
+inline int f5936_3(int x) { return x * 3; }
+inline int f5936_4(int x) { return x * 4; }
+inline int f5936_5(int x) { return x * 5; }
+inline int f5936_6(int x) { return x * 6; }
+inline int f5936_7(int x) { return x * 7; }
+inline int f5936_8(int x) { return x * 8; }
+inline int f5936_9(int x) { return x * 9; }
+inline int f5936_10(int x) { return x * 10; }
+inline int f5936_11(int x) { return x * 11; }
+inline int f5936_12(int x) { return x * 12; }
+inline int f5936_13(int x) { return x * 13; }
+inline int f5936_14(int x) { return x * 14; }
+inline int f5936_15(int x) { return x * 15; }
+inline int f5936_16(int x) { return x * 16; }
+inline int f5936_17(int x) { return x * 17; }
+inline int f5936_18(int x) { return x * 18; }
+inline int f5936_19(int x) { return x * 19; }
+inline int f5936_20(int x) { return x * 20; }
+inline int f5936_21(int x) { return x * 21; }
+inline int f5936_22(int x) { return x * 22; }
+inline int f5936_23(int x) { return x * 23; }
+inline int f5936_24(int x) { return x * 24; }
+inline int f5936_25(int x) { return x * 25; }
+inline int f5936_26(int x) { return x * 26; }
+inline int f5936_27(int x) { return x * 27; }
+inline int f5936_28(int x) { return x * 28; }
+inline int f5936_29(int x) { return x * 29; }
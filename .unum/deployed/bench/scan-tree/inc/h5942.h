@@ -0,0 +1,42 @@
+#pragma once
+/* header 5942 */
+#include <vector>
+#include "h8184.h"
+#include "h3653.h"
+#include "h7404.h"
+#include "h2029.h"
+#include "h6480.h"
+#ifdef X
+#include "h4614.h"
+#endif
+struct S5942 { int a; const char *s = "x//y"; };
+inline int f5942_0(int x) { return x * 0; }
+inline int f5942_1(int x) { return x * 1; }
+inline int f5942_2(int x) { return x * 2; }
+inline int f5942_3(int x) { return x * 3; }
+inline int f5942_4(int x) { return x * 4; }
+inline int f5942_5(int x) { return x * 5; }
+inline int f5942_6(int x) { return x * 6; }
+inline int f5942_7(int x) { return x * 7; }
+inline int f5942_8(int x) { return x * 8; }
+inline int f5942_9(int x) { return x * 9; }
+inline int f5942_10(int x) { return x * 10; }
+inline int f5942_11(int x) { return x * 11; }
+inline int f5942_12(int x) { return x * 12; }
+inline int f5942_13(int x) { return x * 13; }
+inline int f5942_14(int x) { return x * 14; }
+inline int f5942_15(int x) { return x * 15; }
+inline int f5942_16(int x) { return x * 16; }
+inline int f5942_17(int x) { return x * 17; }
+inline int f5942_18(int x) { return x * 18; }
+inline int f5942_19(int x) { return x * 19; }
+inline int f5942_20(int x) { return x * 20; }
+inline int f5942_21(int x) { return x * 21; }
+inline int f5942_22(int x) { return x * 22; }
+inline int f5942_23(int x) { return x * 23; }
+inline int f5942_24(int x) { return x * 24; }
+inline int f5942_25(int x) { return x * 25; }
+inline int f5942_26(int x) { return x * 26; }
+inline int f5942_27(int x) { return x * 27; }
+inline int f5942_28(int x) { return x * 28; }
+inline int f5942_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5943 */
+#include <vector>
+#include "h369.h"
+#include "h3937.h"
+#include "h893.h"
+#include "h3682.h"
+#include "h2475.h"
+#ifdef X
+#include "h2592.h"
+#endif
+struct S5943 { int a; const char *s = "x//y"; };
+inline int f5943_0(int x) { return x * 0; }
+inline int f5943_1(int x) { return x * 1; }
+inline int f5943_2(int x) { return x * 2; }
+inline int f5943_3(int x) { return x * 3; }
+inline int f5943_4(int x) { return x * 4; }
+inline int f5943_5(int x) { return x * 5; }
+inline int f5943_6(int x) { return x * 6; }
+inline int f5943_7(int x) { return x * 7; }
+inline int f5943_8(int x) { return x * 8; }
+inline int f5943_9(int x) { return x * 9; }
+inline int f5943_10(int x) { return x * 10; }
+inline int f5943_11(int x) { return x * 11; }
+inline int f5943_12(int x) { return x * 12; }
+inline int f5943_13(int x) { return x * 13; }
+inline int f5943_14(int x) { return x * 14; }
+inline int f5943_15(int x) { return x * 15; }
+inline int f5943_16(int x) { return x * 16; }
+inline int f5943_17(int x) { return x * 17; }
+inline int f5943_18(int x) { return x * 18; }
+inline int f5943_19(int x) { return x * 19; }
+inline int f5943_20(int x) { return x * 20; }
+inline int f5943_21(int x) { return x * 21; }
+inline int f5943_22(int x) { return x * 22; }
+inline int f5943_23(int x) { return x * 23; }
+inline int f5943_24(int x) { return x * 24; }
+inline int f5943_25(int x) { return x * 25; }
+inline int f5943_26(int x) { return x * 26; }
+inline int f5943_27(int x) { return x * 27; }
+inline int f5943_28(int x) { return x * 28; }
+inline int f5943_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5945 */
+#include <vector>
+#include "h955.h"
+#include "h885.h"
+#include "h5007.h"
+#include "h7148.h"
+#include "h3772.h"
+#ifdef X
+#include "h4177.h"
+#endif
+struct S5945 { int a; const char *s = "x//y"; };
+inline int f5945_0(int x) { return x * 0; }
+inline int f5945_1(int x) { return x * 1; }
+inline int f5945_2(int x) { return x * 2; }
+inline int f5945_3(int x) { return x * 3; }
+inline int f5945_4(int x) { return x * 4; }
+inline int f5945_5(int x) { return x * 5; }
+inline int f5945_6(int x) { return x * 6; }
+inline int f5945_7(int x) { return x * 7; }
+inline int f5945_8(int x) { return x * 8; }
+inline int f5945_9(int x) { return x * 9; }
+inline int f5945_10(int x) { return x * 10; }
+inline int f5945_11(int x) { return x * 11; }
+inline int f5945_12(int x) { return x * 12; }
+inline int f5945_13(int x) { return x * 13; }
+inline int f5945_14(int x) { return x * 14; }
+inline int f5945_15(int x) { return x * 15; }
+inline int f5945_16(int x) { return x * 16; }
+inline int f5945_17(int x) { return x * 17; }
+inline int f5945_18(int x) { return x * 18; }
+inline int f5945_19(int x) { return x * 19; }
+inline int f5945_20(int x) { return x * 20; }
+inline int f5945_21(int x) { return x * 21; }
+inline int f5945_22(int x) { return x * 22; }
+inline int f5945_23(int x) { return x * 23; }
+inline int f5945_24(int x) { return x * 24; }
+inline int f5945_25(int x) { return x * 25; }
+inline int f5945_26(int x) { return x * 26; }
+inline int f5945_27(int x) { return x * 27; }
+inline int f5945_28(int x) { return x * 28; }
+inline int f5945_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5948 */
+#include <vector>
+#include "h3335.h"
+#include "h9830.h"
+#include "h9419.h"
+#include "h5919.h"
+#include "h1384.h"
+#ifdef X
+#include "h8373.h"
+#endif
+struct S5948 { int a; const char *s = "x//y"; };
+inline int f5948_0(int x) { return x * 0; }
+inline int f5948_1(int x) { return x * 1; }
+inline int f5948_2(int x) { return x * 2; }
+inline int f5948_3(int x) { return x * 3; }
+inline int f5948_4(int x) { return x * 4; }
+inline int f5948_5(int x) { return x * 5; }
+inline int f5948_6(int x) { return x * 6; }
+inline int f5948_7(int x) { return x * 7; }
+inline int f5948_8(int x) { return x * 8; }
+inline int f5948_9(int x) { return x * 9; }
+inline int f5948_10(int x) { return x * 10; }
+inline int f5948_11(int x) { return x * 11; }
+inline int f5948_12(int x) { return x * 12; }
+inline int f5948_13(int x) { return x * 13; }
+inline int f5948_14(int x) { return x * 14; }
+inline int f5948_15(int x) { return x * 15; }
+inline int f5948_16(int x) { return x * 16; }
+inline int f5948_17(int x) { return x * 17; }
+inline int f5948_18(int x) { return x * 18; }
+inline int f5948_19(int x) { return x * 19; }
+inline int f5948_20(int x) { return x * 20; }
+inline int f5948_21(int x) { return x * 21; }
+inline int f5948_22(int x) { return x * 22; }
+inline int f5948_23(int x) { return x * 23; }
+inline int f5948_24(int x) { return x * 24; }
+inline int f5948_25(int x) { return x * 25; }
+inline int f5948_26(int x) { return x * 26; }
+inline int f5948_27(int x) { return x * 27; }
+inline int f5948_28(int x) { return x * 28; }
+inline int f5948_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5950 */
+#include <vector>
+#include "h311.h"
+#include "h3107.h"
+#include "h1022.h"
+#include "h1508.h"
+#include "h3190.h"
+#ifdef X
+#include "h7770.h"
+#endif
+struct S5950 { int a; const char *s = "x//y"; };
+inline int f5950_0(int x) { return x * 0; }
+inline int f5950_1(int x) { return x * 1; }
+inline int f5950_2(int x) { return x * 2; }
+inline int f5950_3(int x) { return x * 3; }
+inline int f5950_4(int x) { return x * 4; }
+inline int f5950_5(int x) { return x * 5; }
+inline int f5950_6(int x) { return x * 6; }
+inline int f5950_7(int x) { return x * 7; }
+inline int f5950_8(int x) { return x * 8; }
+inline int f5950_9(int x) { return x * 9; }
+inline int f5950_10(int x) { return x * 10; }
+inline int f5950_11(int x) { return x * 11; }
+inline int f5950_12(int x) { return x * 12; }
+inline int f5950_13(int x) { return x * 13; }
+inline int f5950_14(int x) { return x * 14; }
+inline int f5950_15(int x) { return x * 15; }
+inline int f5950_16(int x) { return x * 16; }
+inline int f5950_17(int x) { return x * 17; }
+inline int f5950_18(int x) { return x * 18; }
+inline int f5950_19(int x) { return x * 19; }
+inline int f5950_20(int x) { return x * 20; }
+inline int f5950_21(int x) { return x * 21; }
+inline int f5950_22(int x) { return x * 22; }
+inline int f5950_23(int x) { return x * 23; }
+inline int f5950_24(int x) { return x * 24; }
+inline int f5950_25(int x) { return x * 25; }
+inline int f5950_26(int x) { return x * 26; }
+inline int f5950_27(int x) { return x * 27; }
+inline int f5950_28(int x) { return x * 28; }
+inline int f5950_29(int x) { return x * 29; }
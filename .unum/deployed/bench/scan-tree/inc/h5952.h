@@ -0,0 +1,42 @@
+#pragma once
+/* header 5952 */
+#include <vector>
+#include "h4323.h"
+#include "h6119.h"
+#include "h8653.h"
+#include "h4712.h"
+#include "h3225.h"
+#ifdef X
+#include "h2746.h"
+#endif
+struct S5952 { int a; const char *s = "x//y"; };
+inline int f5952_0(int x) { return x * 0; }
+inline int f5952_1(int x) { return x * 1; }
+inline int f5952_2(int x) { return x * 2; }
+inline int f5952_3(int x) { return x * 3; }
+inline int f5952_4(int x) { return x * 4; }
+inline int f5952_5(int x) { return x * 5; }
+inline int f5952_6(int x) { return x * 6; }
+inline int f5952_7(int x) { return x * 7; }
+inline int f5952_8(int x) { return x * 8; }
+inline int f5952_9(int x) { return x * 9; }
+inline int f5952_10(int x) { return x * 10; }
+inline int f5952_11(int x) { return x * 11; }
+inline int f5952_12(int x) { return x * 12; }
+inline int f5952_13(int x) { return x * 13; }
+inline int f5952_14(int x) { return x * 14; }
+inline int f5952_15(int x) { return x * 15; }
+inline int f5952_16(int x) { return x * 16; }
+inline int f5952_17(int x) { return x * 17; }
+inline int f5952_18(int x) { return x * 18; }
+inline int f5952_19(int x) { return x * 19; }
+inline int f5952_20(int x) { return x * 20; }
+inline int f5952_21(int x) { return x * 21; }
+inline int f5952_22(int x) { return x * 22; }
+inline int f5952_23(int x) { return x * 23; }
+inline int f5952_24(int x) { return x * 24; }
+inline int f5952_25(int x) { return x * 25; }
+inline int f5952_26(int x) { return x * 26; }
+inline int f5952_27(int x) { return x * 27; }
+inline int f5952_28(int x) { return x * 28; }
+inline int f5952_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5954 */
+#include <vector>
+#include "h9424.h"
+#include "h753.h"
+#include "h3142.h"
+#include "h3246.h"
+#include "h5398.h"
+#ifdef X
+#include "h3141.h"
+#endif
+struct S5954 { int a; const char *s = "x//y"; };
+inline int f5954_0(int x) { return x * 0; }
+inline int f5954_1(int x) { return x * 1; }
+inline int f5954_2(int x) { return x * 2; }
+inline int f5954_3(int x) { return x * 3; }
+inline int f5954_4(int x) { return x * 4; }
+inline int f5954_5(int x) { return x * 5; }
+inline int f5954_6(int x) { return x * 6; }
+inline int f5954_7(int x) { return x * 7; }
+inline int f5954_8(int x) { return x * 8; }
+inline int f5954_9(int x) { return x * 9; }
+inline int f5954_10(int x) { return x * 10; }
+inline int f5954_11(int x) { return x * 11; }
+inline int f5954_12(int x) { return x * 12; }
+inline int f5954_13(int x) { return x * 13; }
+inline int f5954_14(int x) { return x * 14; }
+inline int f5954_15(int x) { return x * 15; }
+inline int f5954_16(int x) { return x * 16; }
+inline int f5954_17(int x) { return x * 17; }
+inline int f5954_18(int x) { return x * 18; }
+inline int f5954_19(int x) { return x * 19; }
+inline int f5954_20(int x) { return x * 20; }
+inline int f5954_21(int x) { return x * 21; }
+inline int f5954_22(int x) { return x * 22; }
+inline int f5954_23(int x) { return x * 23; }
+inline int f5954_24(int x) { return x * 24; }
+inline int f5954_25(int x) { return x * 25; }
+inline int f5954_26(int x) { return x * 26; }
+inline int f5954_27(int x) { return x * 27; }
+inline int f5954_28(int x) { return x * 28; }
+inline int f5954_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5955 */
+#include <vector>
+#include "h1749.h"
+#include "h4504.h"
+#include "h5764.h"
+#include "h531.h"
+#include "h8493.h"
+#ifdef X
+#include "h7622.h"
+#endif
+struct S5955 { int a; const char *s = "x//y"; };
+inline int f5955_0(int x) { return x * 0; }
+inline int f5955_1(int x) { return x * 1; }
+inline int f5955_2(int x) { return x * 2; }
+inline int f5955_3(int x) { return x * 3; }
+inline int f5955_4(int x) { return x * 4; }
+inline int f5955_5(int x) { return x * 5; }
+inline int f5955_6(int x) { return x * 6; }
+inline int f5955_7(int x) { return x * 7; }
+inline int f5955_8(int x) { return x * 8; }
+inline int f5955_9(int x) { return x * 9; }
+inline int f5955_10(int x) { return x * 10; }
+inline int f5955_11(int x) { return x * 11; }
+inline int f5955_12(int x) { return x * 12; }
+inline int f5955_13(int x) { return x * 13; }
+inline int f5955_14(int x) { return x * 14; }
+inline int f5955_15(int x) { return x * 15; }
+inline int f5955_16(int x) { return x * 16; }
+inline int f5955_17(int x) { return x * 17; }
+inline int f5955_18(int x) { return x * 18; }
+inline int f5955_19(int x) { return x * 19; }
+inline int f5955_20(int x) { return x * 20; }
+inline int f5955_21(int x) { return x * 21; }
+inline int f5955_22(int x) { return x * 22; }
+inline int f5955_23(int x) { return x * 23; }
+inline int f5955_24(int x) { return x * 24; }
+inline int f5955_25(int x) { return x * 25; }
+inline int f5955_26(int x) { return x * 26; }
+inline int f5955_27(int x) { return x * 27; }
+inline int f5955_28(int x) { return x * 28; }
+inline int f5955_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5956 */
+#include <vector>
+#include "h9064.h"
+#include "h3088.h"
+#include "h733.h"
+#include "h9061.h"
+#include "h7312.h"
+#ifdef X
+#include "h3182.h"
+#endif
+struct S5956 { int a; const char *s = "x//y"; };
+inline int f5956_0(int x) { return x * 0; }
+inline int f5956_1(int x) { return x * 1; }
+inline int f5956_2(int x) { return x * 2; }
+inline int f5956_3(int x) { return x * 3; }
+inline int f5956_4(int x) { return x * 4; }
+inline int f5956_5(int x) { return x * 5; }
+inline int f5956_6(int x) { return x * 6; }
+inline int f5956_7(int x) { return x * 7; }
+inline int f5956_8(int x) { return x * 8; }
+inline int f5956_9(int x) { return x * 9; }
+inline int f5956_10(int x) { return x * 10; }
+inline int f5956_11(int x) { return x * 11; }
+inline int f5956_12(int x) { return x * 12; }
+inline int f5956_13(int x) { return x * 13; }
+inline int f5956_14(int x) { return x * 14; }
+inline int f5956_15(int x) { return x * 15; }
+inline int f5956_16(int x) { return x * 16; }
+inline int f5956_17(int x) { return x * 17; }
+inline int f5956_18(int x) { return x * 18; }
+inline int f5956_19(int x) { return x * 19; }
+inline int f5956_20(int x) { return x * 20; }
+inline int f5956_21(int x) { return x * 21; }
+inline int f5956_22(int x) { return x * 22; }
+inline int f5956_23(int x) { return x * 23; }
+inline int f5956_24(int x) { return x * 24; }
+inline int f5956_25(int x) { return x * 25; }
+inline int f5956_26(int x) { return x * 26; }
+inline int f5956_27(int x) { return x * 27; }
+inline int f5956_28(int x) { return x * 28; }
+inline int f5956_29(int x) { return x * 29; }
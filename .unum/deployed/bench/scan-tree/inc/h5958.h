@@ -0,0 +1,42 @@
+#pragma once
+/* header 5958 */
+#include <vector>
+#include "h4497.h"
+#include "h133.h"
+#include "h575.h"
+#include "h2165.h"
+#include "h7468.h"
+#ifdef X
+#include "h2940.h"
+#endif
+struct S5958 { int a; const char *s = "x//y"; };
+inline int f5958_0(int x) { return x * 0; }
+inline int f5958_1(int x) { return x * 1; }
+inline int f5958_2(int x) { return x * 2; }
+inline int f5958_3(int x) { return x * 3; }
+inline int f5958_4(int x) { return x * 4; }
+inline int f5958_5(int x) { return x * 5; }
+inline int f5958_6(int x) { return x * 6; }
+inline int f5958_7(int x) { return x * 7; }
+inline int f5958_8(int x) { return x * 8; }
+inline int f5958_9(int x) { return x * 9; }
+inline int f5958_10(int x) { return x * 10; }
+inline int f5958_11(int x) { return x * 11; }
+inline int f5958_12(int x) { return x * 12; }
+inline int f5958_13(int x) { return x * 13; }
+inline int f5958_14(int x) { return x * 14; }
+inline int f5958_15(int x) { return x * 15; }
+inline int f5958_16(int x) { return x * 16; }
+inline int f5958_17(int x) { return x * 17; }
+inline int f5958_18(int x) { return x * 18; }
+inline int f5958_19(int x) { return x * 19; }
+inline int f5958_20(int x) { return x * 20; }
+inline int f5958_21(int x) { return x * 21; }
+inline int f5958_22(int x) { return x * 22; }
+inline int f5958_23(int x) { return x * 23; }
+inline int f5958_24(int x) { return x * 24; }
+inline int f5958_25(int x) { return x * 25; }
+inline int f5958_26(int x) { return x * 26; }
+inline int f5958_27(int x) { return x * 27; }
+inline int f5958_28(int x) { return x * 28; }
+inline int f5958_29(int x) { return x * 29; }
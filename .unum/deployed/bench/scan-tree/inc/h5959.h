@@ -0,0 +1,42 @@
+#pragma once
+/* header 5959 */
+#include <vector>
+#include "h8623.h"
+#include "h3404.h"
+#include "h6852.h"
+#include "h7944.h"
+#include "h3449.h"
+#ifdef X
+#include "h6644.h"
+#endif
+struct S5959 { int a; const char *s = "x//y"; };
+inline int f5959_0(int x) { return x * 0; }
+inline int f5959_1(int x) { return x * 1; }
+inline int f5959_2(int x) { return x * 2; }
+inline int f5959_3(int x) { return x * 3; }
+inline int f5959_4(int x) { return x * 4; }
+inline int f5959_5(int x) { return x * 5; }
+inline int f5959_6(int x) { return x * 6; }
+inline int f5959_7(int x) { return x * 7; }
+inline int f5959_8(int x) { return x * 8; }
+inline int f5959_9(int x) { return x * 9; }
+inline int f5959_10(int x) { return x * 10; }
+inline int f5959_11(int x) { return x * 11; }
+inline int f5959_12(int x) { return x * 12; }
+inline int f5959_13(int x) { return x * 13; }
+inline int f5959_14(int x) { return x * 14; }
+inline int f5959_15(int x) { return x * 15; }
+inline int f5959_16(int x) { return x * 16; }
+inline int f5959_17(int x) { return x * 17; }
+inline int f5959_18(int x) { return x * 18; }
+inline int f5959_19(int x) { return x * 19; }
+inline int f5959_20(int x) { return x * 20; }
+inline int f5959_21(int x) { return x * 21; }
+inline int f5959_22(int x) { return x * 22; }
+inline int f5959_23(int x) { return x * 23; }
+inline int f5959_24(int x) { return x * 24; }
+inline int f5959_25(int x) { return x * 25; }
+inline int f5959_26(int x) { return x * 26; }
+inline int f5959_27(int x) { return x * 27; }
+inline int f5959_28(int x) { return x * 28; }
+inline int f5959_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5961 */
+#include <vector>
+#include "h3127.h"
+#include "h9496.h"
+#include "h5393.h"
+#include "h873.h"
+#include "h3813.h"
+#ifdef X
+#include "h8962.h"
+#endif
+struct S5961 { int a; const char *s = "x//y"; };
+inline int f5961_0(int x) { return x * 0; }
+inline int f5961_1(int x) { return x * 1; }
+inline int f5961_2(int x) { return x * 2; }
+inline int f5961_3(int x) { return x * 3; }
+inline int f5961_4(int x) { return x * 4; }
+inline int f5961_5(int x) { return x * 5; }
+inline int f5961_6(int x) { return x * 6; }
+inline int f5961_7(int x) { return x * 7; }
+inline int f5961_8(int x) { return x * 8; }
+inline int f5961_9(int x) { return x * 9; }
+inline int f5961_10(int x) { return x * 10; }
+inline int f5961_11(int x) { return x * 11; }
+inline int f5961_12(int x) { return x * 12; }
+inline int f5961_13(int x) { return x * 13; }
+inline int f5961_14(int x) { return x * 14; }
+inline int f5961_15(int x) { return x * 15; }
+inline int f5961_16(int x) { return x * 16; }
+inline int f5961_17(int x) { return x * 17; }
+inline int f5961_18(int x) { return x * 18; }
+inline int f5961_19(int x) { return x * 19; }
+inline int f5961_20(int x) { return x * 20; }
+inline int f5961_21(int x) { return x * 21; }
+inline int f5961_22(int x) { return x * 22; }
+inline int f5961_23(int x) { return x * 23; }
+inline int f5961_24(int x) { return x * 24; }
+inline int f5961_25(int x) { return x * 25; }
+inline int f5961_26(int x) { return x * 26; }
+inline int f5961_27(int x) { return x * 27; }
+inline int f5961_28(int x) { return x * 28; }
+inline int f5961_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5962 */
+#include <vector>
+#include "h291.h"
+#include "h2501.h"
+#include "h2745.h"
+#include "h6379.h"
+#include "h7401.h"
+#ifdef X
+#include "h7421.h"
+#endif
+struct S5962 { int a; const char *s = "x//y"; };
+inline int f5962_0(int x) { return x * 0; }
+inline int f5962_1(int x) { return x * 1; }
+inline int f5962_2(int x) { return x * 2; }
+inline int f5962_3(int x) { return x * 3; }
+inline int f5962_4(int x) { return x * 4; }
+inline int f5962_5(int x) { return x * 5; }
+inline int f5962_6(int x) { return x * 6; }
+inline int f5962_7(int x) { return x * 7; }
+inline int f5962_8(int x) { return x * 8; }
+inline int f5962_9(int x) { return x * 9; }
+inline int f5962_10(int x) { return x * 10; }
+inline int f5962_11(int x) { return x * 11; }
+inline int f5962_12(int x) { return x * 12; }
+inline int f5962_13(int x) { return x * 13; }
+inline int f5962_14(int x) { return x * 14; }
+inline int f5962_15(int x) { return x * 15; }
+inline int f5962_16(int x) { return x * 16; }
+inline int f5962_17(int x) { return x * 17; }
+inline int f5962_18(int x) { return x * 18; }
+inline int f5962_19(int x) { return x * 19; }
+inline int f5962_20(int x) { return x * 20; }
+inline int f5962_21(int x) { return x * 21; }
+inline int f5962_22(int x) { return x * 22; }
+inline int f5962_23(int x) { return x * 23; }
+inline int f5962_24(int x) { return x * 24; }
+inline int f5962_25(int x) { return x * 25; }
+inline int f5962_26(int x) { return x * 26; }
+inline int f5962_27(int x) { return x * 27; }
+inline int f5962_28(int x) { return x * 28; }
+inline int f5962_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5969 */
+#include <vector>
+#include "h1388.h"
+#include "h4505.h"
+#include "h8995.h"
+#include "h6048.h"
+#include "h774.h"
+#ifdef X
+#include "h9426.h"
+#endif
+struct S5969 { int a; const char *s = "x//y"; };
+inline int f5969_0(int x) { return x * 0; }
+inline int f5969_1(int x) { return x * 1; }
+inline int f5969_2(int x) { return x * 2; }
+inline int f5969_3(int x) { return x * 3; }
+inline int f5969_4(int x) { return x * 4; }
+inline int f5969_5(int x) { return x * 5; }
+inline int f5969_6(int x) { return x * 6; }
+inline int f5969_7(int x) { return x * 7; }
+inline int f5969_8(int x) { return x * 8; }
+inline int f5969_9(int x) { return x * 9; }
+inline int f5969_10(int x) { return x * 10; }
+inline int f5969_11(int x) { return x * 11; }
+inline int f5969_12(int x) { return x * 12; }
+inline int f5969_13(int x) { return x * 13; }
+inline int f5969_14(int x) { return x * 14; }
+inline int f5969_15(int x) { return x * 15; }
+inline int f5969_16(int x) { return x * 16; }
+inline int f5969_17(int x) { return x * 17; }
+inline int f5969_18(int x) { return x * 18; }
+inline int f5969_19(int x) { return x * 19; }
+inline int f5969_20(int x) { return x * 20; }
+inline int f5969_21(int x) { return x * 21; }
+inline int f5969_22(int x) { return x * 22; }
+inline int f5969_23(int x) { return x * 23; }
+inline int f5969_24(int x) { return x * 24; }
+inline int f5969_25(int x) { return x * 25; }
+inline int f5969_26(int x) { return x * 26; }
+inline int f5969_27(int x) { return x * 27; }
+inline int f5969_28(int x) { return x * 28; }
+inline int f5969_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5970 */
+#include <vector>
+#include "h9274.h"
+#include "h9601.h"
+#include "h9578.h"
+#include "h1193.h"
+#include "h8700.h"
+#ifdef X
+#include "h4255.h"
+#endif
+struct S5970 { int a; const char *s = "x//y"; };
+inline int f5970_0(int x) { return x * 0; }
+inline int f5970_1(int x) { return x * 1; }
+inline int f5970_2(int x) { return x * 2; }
+inline int f5970_3(int x) { return x * 3; }
+inline int f5970_4(int x) { return x * 4; }
+inline int f5970_5(int x) { return x * 5; }
+inline int f5970_6(int x) { return x * 6; }
+inline int f5970_7(int x) { return x * 7; }
+inline int f5970_8(int x) { return x * 8; }
+inline int f5970_9(int x) { return x * 9; }
+inline int f5970_10(int x) { return x * 10; }
+inline int f5970_11(int x) { return x * 11; }
+inline int f5970_12(int x) { return x * 12; }
+inline int f5970_13(int x) { return x * 13; }
+inline int f5970_14(int x) { return x * 14; }
+inline int f5970_15(int x) { return x * 15; }
+inline int f5970_16(int x) { return x * 16; }
+inline int f5970_17(int x) { return x * 17; }
+inline int f5970_18(int x) { return x * 18; }
+inline int f5970_19(int x) { return x * 19; }
+inline int f5970_20(int x) { return x * 20; }
+inline int f5970_21(int x) { return x * 21; }
+inline int f5970_22(int x) { return x * 22; }
+inline int f5970_23(int x) { return x * 23; }
+inline int f5970_24(int x) { return x * 24; }
+inline int f5970_25(int x) { return x * 25; }
+inline int f5970_26(int x) { return x * 26; }
+inline int f5970_27(int x) { return x * 27; }
+inline int f5970_28(int x) { return x * 28; }
+inline int f5970_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5974 */
+#include <vector>
+#include "h5917.h"
+#include "h8146.h"
+#include "h9306.h"
+#include "h6793.h"
+#include "h5190.h"
+#ifdef X
+#include "h1203.h"
+#endif
+struct S5974 { int a; const char *s = "x//y"; };
+inline int f5974_0(int x) { return x * 0; }
+inline int f5974_1(int x) { return x * 1; }
+inline int f5974_2(int x) { return x * 2; }
+inline int f5974_3(int x) { return x * 3; }
+inline int f5974_4(int x) { return x * 4; }
+inline int f5974_5(int x) { return x * 5; }
+inline int f5974_6(int x) { return x * 6; }
+inline int f5974_7(int x) { return x * 7; }
+inline int f5974_8(int x) { return x * 8; }
+inline int f5974_9(int x) { return x * 9; }
+inline int f5974_10(int x) { return x * 10; }
+inline int f5974_11(int x) { return x * 11; }
+inline int f5974_12(int x) { return x * 12; }
+inline int f5974_13(int x) { return x * 13; }
+inline int f5974_14(int x) { return x * 14; }
+inline int f5974_15(int x) { return x * 15; }
+inline int f5974_16(int x) { return x * 16; }
+inline int f5974_17(int x) { return x * 17; }
+inline int f5974_18(int x) { return x * 18; }
+inline int f5974_19(int x) { return x * 19; }
+inline int f5974_20(int x) { return x * 20; }
+inline int f5974_21(int x) { return x * 21; }
+inline int f5974_22(int x) { return x * 22; }
+inline int f5974_23(int x) { return x * 23; }
+inline int f5974_24(int x) { return x * 24; }
+inline int f5974_25(int x) { return x * 25; }
+inline int f5974_26(int x) { return x * 26; }
+inline int f5974_27(int x) { return x * 27; }
+inline int f5974_28(int x) { return x * 28; }
+inline int f5974_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5975 */
+#include <vector>
+#include "h6947.h"
+#include "h6330.h"
+#include "h9890.h"
+#include "h4959.h"
+#include "h5103.h"
+#ifdef X
+#include "h9024.h"
+#endif
+struct S5975 { int a; const char *s = "x//y"; };
+inline int f5975_0(int x) { return x * 0; }
+inline int f5975_1(int x) { return x * 1; }
+inline int f5975_2(int x) { return x * 2; }
+inline int f5975_3(int x) { return x * 3; }
+inline int f5975_4(int x) { return x * 4; }
+inline int f5975_5(int x) { return x * 5; }
+inline int f5975_6(int x) { return x * 6; }
+inline int f5975_7(int x) { return x * 7; }
+inline int f5975_8(int x) { return x * 8; }
+inline int f5975_9(int x) { return x * 9; }
+inline int f5975_10(int x) { return x * 10; }
+inline int f5975_11(int x) { return x * 11; }
+inline int f5975_12(int x) { return x * 12; }
+inline int f5975_13(int x) { return x * 13; }
+inline int f5975_14(int x) { return x * 14; }
+inline int f5975_15(int x) { return x * 15; }
+inline int f5975_16(int x) { return x * 16; }
+inline int f5975_17(int x) { return x * 17; }
+inline int f5975_18(int x) { return x * 18; }
+inline int f5975_19(int x) { return x * 19; }
+inline int f5975_20(int x) { return x * 20; }
+inline int f5975_21(int x) { return x * 21; }
+inline int f5975_22(int x) { return x * 22; }
+inline int f5975_23(int x) { return x * 23; }
+inline int f5975_24(int x) { return x * 24; }
+inline int f5975_25(int x) { return x * 25; }
+inline int f5975_26(int x) { return x * 26; }
+inline int f5975_27(int x) { return x * 27; }
+inline int f5975_28(int x) { return x * 28; }
+inline int f5975_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5976 */
+#include <vector>
+#include "h9204.h"
+#include "h5758.h"
+#include "h4145.h"
+#include "h761.h"
+#include "h7245.h"
+#ifdef X
+#include "h1968.h"
+#endif
+struct S5976 { int a; const char *s = "x//y"; };
+inline int f5976_0(int x) { return x * 0; }
+inline int f5976_1(int x) { return x * 1; }
+inline int f5976_2(int x) { return x * 2; }
+inline int f5976_3(int x) { return x * 3; }
+inline int f5976_4(int x) { return x * 4; }
+inline int f5976_5(int x) { return x * 5; }
+inline int f5976_6(int x) { return x * 6; }
+inline int f5976_7(int x) { return x * 7; }
+inline int f5976_8(int x) { return x * 8; }
+inline int f5976_9(int x) { return x * 9; }
+inline int f5976_10(int x) { return x * 10; }
+inline int f5976_11(int x) { return x * 11; }
+inline int f5976_12(int x) { return x * 12; }
+inline int f5976_13(int x) { return x * 13; }
+inline int f5976_14(int x) { return x * 14; }
+inline int f5976_15(int x) { return x * 15; }
+inline int f5976_16(int x) { return x * 16; }
+inline int f5976_17(int x) { return x * 17; }
+inline int f5976_18(int x) { return x * 18; }
+inline int f5976_19(int x) { return x * 19; }
+inline int f5976_20(int x) { return x * 20; }
+inline int f5976_21(int x) { return x * 21; }
+inline int f5976_22(int x) { return x * 22; }
+inline int f5976_23(int x) { return x * 23; }
+inline int f5976_24(int x) { return x * 24; }
+inline int f5976_25(int x) { return x * 25; }
+inline int f5976_26(int x) { return x * 26; }
+inline int f5976_27(int x) { return x * 27; }
+inline int f5976_28(int x) { return x * 28; }
+inline int f5976_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5979 */
+#include <vector>
+#include "h652.h"
+#include "h8114.h"
+#include "h474.h"
+#include "h6781.h"
+#include "h284.h"
+#ifdef X
+#include "h396.h"
+#endif
+struct S5979 { int a; const char *s = "x//y"; };
+inline int f5979_0(int x) { return x * 0; }
+inline int f5979_1(int x) { return x * 1; }
+inline int f5979_2(int x) { return x * 2; }
+inline int f5979_3(int x) { return x * 3; }
+inline int f5979_4(int x) { return x * 4; }
+inline int f5979_5(int x) { return x * 5; }
+inline int f5979_6(int x) { return x * 6; }
+inline int f5979_7(int x) { return x * 7; }
+inline int f5979_8(int x) { return x * 8; }
+inline int f5979_9(int x) { return x * 9; }
+inline int f5979_10(int x) { return x * 10; }
+inline int f5979_11(int x) { return x * 11; }
+inline int f5979_12(int x) { return x * 12; }
+inline int f5979_13(int x) { return x * 13; }
+inline int f5979_14(int x) { return x * 14; }
+inline int f5979_15(int x) { return x * 15; }
+inline int f5979_16(int x) { return x * 16; }
+inline int f5979_17(int x) { return x * 17; }
+inline int f5979_18(int x) { return x * 18; }
+inline int f5979_19(int x) { return x * 19; }
+inline int f5979_20(int x) { return x * 20; }
+inline int f5979_21(int x) { return x * 21; }
+inline int f5979_22(int x) { return x * 22; }
+inline int f5979_23(int x) { return x * 23; }
+inline int f5979_24(int x) { return x * 24; }
+inline int f5979_25(int x) { return x * 25; }
+inline int f5979_26(int x) { return x * 26; }
+inline int f5979_27(int x) { return x * 27; }
+inline int f5979_28(int x) { return x * 28; }
+inline int f5979_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 598 */
+#include <vector>
+#include "h1747.h"
+#include "h4136.h"
+#include "h7707.h"
+#include "h3018.h"
+#include "h9145.h"
+#ifdef X
+#include "h5459.h"
+#endif
+struct S598 { int a; const char *s = "x//y"; };
+inline int f598_0(int x) { return x * 0; }
+inline int f598_1(int x) { return x * 1; }
+inline int f598_2(int x) { return x * 2; }
+inline int f598_3(int x) { return x * 3; }
+inline int f598_4(int x) { return x * 4; }
+inline int f598_5(int x) { return x * 5; }
+inline int f598_6(int x) { return x * 6; }
+inline int f598_7(int x) { return x * 7; }
+inline int f598_8(int x) { return x * 8; }
+inline int f598_9(int x) { return x * 9; }
+inline int f598_10(int x) { return x * 10; }
+inline int f598_11(int x) { return x * 11; }
+inline int f598_12(int x) { return x * 12; }
+inline int f598_13(int x) { return x * 13; }
+inline int f598_14(int x) { return x * 14; }
+inline int f598_15(int x) { return x * 15; }
+inline int f598_16(int x) { return x * 16; }
+inline int f598_17(int x) { return x * 17; }
+inline int f598_18(int x) { return x * 18; }
+inline int f598_19(int x) { return x * 19; }
+inline int f598_20(int x) { return x * 20; }
+inline int f598_21(int x) { return x * 21; }
+inline int f598_22(int x) { return x * 22; }
+inline int f598_23(int x) { return x * 23; }
+inline int f598_24(int x) { return x * 24; }
+inline int f598_25(int x) { return x * 25; }
+inline int f598_26(int x) { return x * 26; }
+inline int f598_27(int x) { return x * 27; }
+inline int f598_28(int x) { return x * 28; }
+inline int f598_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5984 */
+#include <vector>
+#include "h9958.h"
+#include "h8806.h"
+#include "h8400.h"
+#include "h6497.h"
+#include "h507.h"
+#ifdef X
+#include "h5387.h"
+#endif
+struct S5984 { int a; const char *s = "x//y"; };
+inline int f5984_0(int x) { return x * 0; }
+inline int f5984_1(int x) { return x * 1; }
+inline int f5984_2(int x) { return x * 2; }
+inline int f5984_3(int x) { return x * 3; }
+inline int f5984_4(int x) { return x * 4; }
+inline int f5984_5(int x) { return x * 5; }
+inline int f5984_6(int x) { return x * 6; }
+inline int f5984_7(int x) { return x * 7; }
+inline int f5984_8(int x) { return x * 8; }
+inline int f5984_9(int x) { return x * 9; }
+inline int f5984_10(int x) { return x * 10; }
+inline int f5984_11(int x) { return x * 11; }
+inline int f5984_12(int x) { return x * 12; }
+inline int f5984_13(int x) { return x * 13; }
+inline int f5984_14(int x) { return x * 14; }
+inline int f5984_15(int x) { return x * 15; }
+inline int f5984_16(int x) { return x * 16; }
+inline int f5984_17(int x) { return x * 17; }
+inline int f5984_18(int x) { return x * 18; }
+inline int f5984_19(int x) { return x * 19; }
+inline int f5984_20(int x) { return x * 20; }
+inline int f5984_21(int x) { return x * 21; }
+inline int f5984_22(int x) { return x * 22; }
+inline int f5984_23(int x) { return x * 23; }
+inline int f5984_24(int x) { return x * 24; }
+inline int f5984_25(int x) { return x * 25; }
+inline int f5984_26(int x) { return x * 26; }
+inline int f5984_27(int x) { return x * 27; }
+inline int f5984_28(int x) { return x * 28; }
+inline int f5984_29(int x) { return x * 29; }
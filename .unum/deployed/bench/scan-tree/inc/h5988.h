@@ -0,0 +1,42 @@
+#pragma once
+/* header 5988 */
+#include <vector>
+#include "h8030.h"
+#include "h6244.h"
+#include "h4393.h"
+#include "h176.h"
+#include "h7176.h"
+#ifdef X
+#include "h7738.h"
+#endif
+struct S5988 { int a; const char *s = "x//y"; };
+inline int f5988_0(int x) { return x * 0; }
+inline int f5988_1(int x) { return x * 1; }
+inline int f5988_2(int x) { return x * 2; }
+inline int f5988_3(int x) { return x * 3; }
+inline int f5988_4(int x) { return x * 4; }
+inline int f5988_5(int x) { return x * 5; }
+inline int f5988_6(int x) { return x * 6; }
+inline int f5988_7(int x) { return x * 7; }
+inline int f5988_8(int x) { return x * 8; }
+inline int f5988_9(int x) { return x * 9; }
+inline int f5988_10(int x) { return x * 10; }
+inline int f5988_11(int x) { return x * 11; }
+inline int f5988_12(int x) { return x * 12; }
+inline int f5988_13(int x) { return x * 13; }
+inline int f5988_14(int x) { return x * 14; }
+inline int f5988_15(int x) { return x * 15; }
+inline int f5988_16(int x) { return x * 16; }
+inline int f5988_17(int x) { return x * 17; }
+inline int f5988_18(int x) { return x * 18; }
+inline int f5988_19(int x) { return x * 19; }
+inline int f5988_20(int x) { return x * 20; }
+inline int f5988_21(int x) { return x * 21; }
+inline int f5988_22(int x) { return x * 22; }
+inline int f5988_23(int x) { return x * 23; }
+inline int f5988_24(int x) { return x * 24; }
+inline int f5988_25(int x) { return x * 25; }
+inline int f5988_26(int x) { return x * 26; }
+inline int f5988_27(int x) { return x * 27; }
+inline int f5988_28(int x) { return x * 28; }
+inline int f5988_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5990 */
+#include <vector>
+#include "h1504.h"
+#include "h5100.h"
+#include "h6683.h"
+#include "h503.h"
+#include "h1339.h"
+#ifdef X
+#include "h2221.h"
+#endif
+struct S5990 { int a; const char *s = "x//y"; };
+inline int f5990_0(int x) { return x * 0; }
+inline int f5990_1(int x) { return x * 1; }
+inline int f5990_2(int x) { return x * 2; }
+inline int f5990_3(int x) { return x * 3; }
+inline int f5990_4(int x) { return x * 4; }
+inline int f5990_5(int x) { return x * 5; }
+inline int f5990_6(int x) { return x * 6; }
+inline int f5990_7(int x) { return x * 7; }
+inline int f5990_8(int x) { return x * 8; }
+inline int f5990_9(int x) { return x * 9; }
+inline int f5990_10(int x) { return x * 10; }
+inline int f5990_11(int x) { return x * 11; }
+inline int f5990_12(int x) { return x * 12; }
+inline int f5990_13(int x) { return x * 13; }
+inline int f5990_14(int x) { return x * 14; }
+inline int f5990_15(int x) { return x * 15; }
+inline int f5990_16(int x) { return x * 16; }
+inline int f5990_17(int x) { return x * 17; }
+inline int f5990_18(int x) { return x * 18; }
+inline int f5990_19(int x) { return x * 19; }
+inline int f5990_20(int x) { return x * 20; }
+inline int f5990_21(int x) { return x * 21; }
+inline int f5990_22(int x) { return x * 22; }
+inline int f5990_23(int x) { return x * 23; }
+inline int f5990_24(int x) { return x * 24; }
+inline int f5990_25(int x) { return x * 25; }
+inline int f5990_26(int x) { return x * 26; }
+inline int f5990_27(int x) { return x * 27; }
+inline int f5990_28(int x) { return x * 28; }
+inline int f5990_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5993 */
+#include <vector>
+#include "h3739.h"
+#include "h2393.h"
+#include "h2310.h"
+#include "h2.h"
+#include "h6542.h"
+#ifdef X
+#include "h5474.h"
+#endif
+struct S5993 { int a; const char *s = "x//y"; };
+inline int f5993_0(int x) { return x * 0; }
+inline int f5993_1(int x) { return x * 1; }
+inline int f5993_2(int x) { return x * 2; }
+inline int f5993_3(int x) { return x * 3; }
+inline int f5993_4(int x) { return x * 4; }
+inline int f5993_5(int x) { return x * 5; }
+inline int f5993_6(int x) { return x * 6; }
+inline int f5993_7(int x) { return x * 7; }
+inline int f5993_8(int x) { return x * 8; }
+inline int f5993_9(int x) { return x * 9; }
+inline int f5993_10(int x) { return x * 10; }
+inline int f5993_11(int x) { return x * 11; }
+inline int f5993_12(int x) { return x * 12; }
+inline int f5993_13(int x) { return x * 13; }
+inline int f5993_14(int x) { return x * 14; }
+inline int f5993_15(int x) { return x * 15; }
+inline int f5993_16(int x) { return x * 16; }
+inline int f5993_17(int x) { return x * 17; }
+inline int f5993_18(int x) { return x * 18; }
+inline int f5993_19(int x) { return x * 19; }
+inline int f5993_20(int x) { return x * 20; }
+inline int f5993_21(int x) { return x * 21; }
+inline int f5993_22(int x) { return x * 22; }
+inline int f5993_23(int x) { return x * 23; }
+inline int f5993_24(int x) { return x * 24; }
+inline int f5993_25(int x) { return x * 25; }
+inline int f5993_26(int x) { return x * 26; }
+inline int f5993_27(int x) { return x * 27; }
+inline int f5993_28(int x) { return x * 28; }
+inline int f5993_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5996 */
+#include <vector>
+#include "h1523.h"
+#include "h3208.h"
+#include "h391.h"
+#include "h2010.h"
+#include "h865.h"
+#ifdef X
+#include "h8479.h"
+#endif
+struct S5996 { int a; const char *s = "x//y"; };
+inline int f5996_0(int x) { return x * 0; }
+inline int f5996_1(int x) { return x * 1; }
+inline int f5996_2(int x) { return x * 2; }
+inline int f5996_3(int x) { return x * 3; }
+inline int f5996_4(int x) { return x * 4; }
+inline int f5996_5(int x) { return x * 5; }
+inline int f5996_6(int x) { return x * 6; }
+inline int f5996_7(int x) { return x * 7; }
+inline int f5996_8(int x) { return x * 8; }
+inline int f5996_9(int x) { return x * 9; }
+inline int f5996_10(int x) { return x * 10; }
+inline int f5996_11(int x) { return x * 11; }
+inline int f5996_12(int x) { return x * 12; }
+inline int f5996_13(int x) { return x * 13; }
+inline int f5996_14(int x) { return x * 14; }
+inline int f5996_15(int x) { return x * 15; }
+inline int f5996_16(int x) { return x * 16; }
+inline int f5996_17(int x) { return x * 17; }
+inline int f5996_18(int x) { return x * 18; }
+inline int f5996_19(int x) { return x * 19; }
+inline int f5996_20(int x) { return x * 20; }
+inline int f5996_21(int x) { return x * 21; }
+inline int f5996_22(int x) { return x * 22; }
+inline int f5996_23(int x) { return x * 23; }
+inline int f5996_24(int x) { return x * 24; }
+inline int f5996_25(int x) { return x * 25; }
+inline int f5996_26(int x) { return x * 26; }
+inline int f5996_27(int x) { return x * 27; }
+inline int f5996_28(int x) { return x * 28; }
+inline int f5996_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5997 */
+#include <vector>
+#include "h1274.h"
+#include "h7079.h"
+#include "h2319.h"
+#include "h4087.h"
+#include "h6805.h"
+#ifdef X
+#include "h9022.h"
+#endif
+struct S5997 { int a; const char *s = "x//y"; };
+inline int f5997_0(int x) { return x * 0; }
+inline int f5997_1(int x) { return x * 1; }
+inline int f5997_2(int x) { return x * 2; }
+inline int f5997_3(int x) { return x * 3; }
+inline int f5997_4(int x) { return x * 4; }
+inline int f5997_5(int x) { return x * 5; }
+inline int f5997_6(int x) { return x * 6; }
+inline int f5997_7(int x) { return x * 7; }
+inline int f5997_8(int x) { return x * 8; }
+inline int f5997_9(int x) { return x * 9; }
+inline int f5997_10(int x) { return x * 10; }
+inline int f5997_11(int x) { return x * 11; }
+inline int f5997_12(int x) { return x * 12; }
+inline int f5997_13(int x) { return x * 13; }
+inline int f5997_14(int x) { return x * 14; }
+inline int f5997_15(int x) { return x * 15; }
+inline int f5997_16(int x) { return x * 16; }
+inline int f5997_17(int x) { return x * 17; }
+inline int f5997_18(int x) { return x * 18; }
+inline int f5997_19(int x) { return x * 19; }
+inline int f5997_20(int x) { return x * 20; }
+inline int f5997_21(int x) { return x * 21; }
+inline int f5997_22(int x) { return x * 22; }
+inline int f5997_23(int x) { return x * 23; }
+inline int f5997_24(int x) { return x * 24; }
+inline int f5997_25(int x) { return x * 25; }
+inline int f5997_26(int x) { return x * 26; }
+inline int f5997_27(int x) { return x * 27; }
+inline int f5997_28(int x) { return x * 28; }
+inline int f5997_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 5998 */
+#include <vector>
+#include "h6165.h"
+#include "h5980.h"
+#include "h5199.h"
+#include "h4948.h"
+#include "h6711.h"
+#ifdef X
+#include "h785.h"
+#endif
+struct S5998 { int a; const char *s = "x//y"; };
+inline int f5998_0(int x) { return x * 0; }
+inline int f5998_1(int x) { return x * 1; }
+inline int f5998_2(int x) { return x * 2; }
+inline int f5998_3(int x) { return x * 3; }
+inline int f5998_4(int x) { return x * 4; }
+inline int f5998_5(int x) { return x * 5; }
+inline int f5998_6(int x) { return x * 6; }
+inline int f5998_7(int x) { return x * 7; }
+inline int f5998_8(int x) { return x * 8; }
+inline int f5998_9(int x) { return x * 9; }
+inline int f5998_10(int x) { return x * 10; }
+inline int f5998_11(int x) { return x * 11; }
+inline int f5998_12(int x) { return x * 12; }
+inline int f5998_13(int x) { return x * 13; }
+inline int f5998_14(int x) { return x * 14; }
+inline int f5998_15(int x) { return x * 15; }
+inline int f5998_16(int x) { return x * 16; }
+inline int f5998_17(int x) { return x * 17; }
+inline int f5998_18(int x) { return x * 18; }
+inline int f5998_19(int x) { return x * 19; }
+inline int f5998_20(int x) { return x * 20; }
+inline int f5998_21(int x) { return x * 21; }
+inline int f5998_22(int x) { return x * 22; }
+inline int f5998_23(int x) { return x * 23; }
+inline int f5998_24(int x) { return x * 24; }
+inline int f5998_25(int x) { return x * 25; }
+inline int f5998_26(int x) { return x * 26; }
+inline int f5998_27(int x) { return x * 27; }
+inline int f5998_28(int x) { return x * 28; }
+inline int f5998_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6 */
+#include <vector>
+#include "h8368.h"
+#include "h15.h"
+#include "h7005.h"
+#include "h3888.h"
+#include "h1678.h"
+#ifdef X
+#include "h3056.h"
+#endif
+struct S6 { int a; const char *s = "x//y"; };
+inline int f6_0(int x) { return x * 0; }
+inline int f6_1(int x) { return x * 1; }
+inline int f6_2(int x) { return x * 2; }
+inline int f6_3(int x) { return x * 3; }
+inline int f6_4(int x) { return x * 4; }
+inline int f6_5(int x) { return x * 5; }
+inline int f6_6(int x) { return x * 6; }
+inline int f6_7(int x) { return x * 7; }
+inline int f6_8(int x) { return x * 8; }
+inline int f6_9(int x) { return x * 9; }
+inline int f6_10(int x) { return x * 10; }
+inline int f6_11(int x) { return x * 11; }
+inline int f6_12(int x) { return x * 12; }
+inline int f6_13(int x) { return x * 13; }
+inline int f6_14(int x) { return x * 14; }
+inline int f6_15(int x) { return x * 15; }
+inline int f6_16(int x) { return x * 16; }
+inline int f6_17(int x) { return x * 17; }
+inline int f6_18(int x) { return x * 18; }
+inline int f6_19(int x) { return x * 19; }
+inline int f6_20(int x) { return x * 20; }
+inline int f6_21(int x) { return x * 21; }
+inline int f6_22(int x) { return x * 22; }
+inline int f6_23(int x) { return x * 23; }
+inline int f6_24(int x) { return x * 24; }
+inline int f6_25(int x) { return x * 25; }
+inline int f6_26(int x) { return x * 26; }
+inline int f6_27(int x) { return x * 27; }
+inline int f6_28(int x) { return x * 28; }
+inline int f6_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 60 */
+#include <vector>
+#include "h3302.h"
+#include "h8680.h"
+#include "h9142.h"
+#include "h2678.h"
+#include "h1628.h"
+#ifdef X
+#include "h5624.h"
+#endif
+struct S60 { int a; const char *s = "x//y"; };
+inline int f60_0(int x) { return x * 0; }
+inline int f60_1(int x) { return x * 1; }
+inline int f60_2(int x) { return x * 2; }
+inline int f60_3(int x) { return x * 3; }
+inline int f60_4(int x) { return x * 4; }
+inline int f60_5(int x) { return x * 5; }
+inline int f60_6(int x) { return x * 6; }
+inline int f60_7(int x) { return x * 7; }
+inline int f60_8(int x) { return x * 8; }
+inline int f60_9(int x) { return x * 9; }
+inline int f60_10(int x) { return x * 10; }
+inline int f60_11(int x) { return x * 11; }
+inline int f60_12(int x) { return x * 12; }
+inline int f60_13(int x) { return x * 13; }
+inline int f60_14(int x) { return x * 14; }
+inline int f60_15(int x) { return x * 15; }
+inline int f60_16(int x) { return x * 16; }
+inline int f60_17(int x) { return x * 17; }
+inline int f60_18(int x) { return x * 18; }
+inline int f60_19(int x) { return x * 19; }
+inline int f60_20(int x) { return x * 20; }
+inline int f60_21(int x) { return x * 21; }
+inline int f60_22(int x) { return x * 22; }
+inline int f60_23(int x) { return x * 23; }
+inline int f60_24(int x) { return x * 24; }
+inline int f60_25(int x) { return x * 25; }
+inline int f60_26(int x) { return x * 26; }
+inline int f60_27(int x) { return x * 27; }
+inline int f60_28(int x) { return x * 28; }
+inline int f60_29(int x) { return x * 29; }
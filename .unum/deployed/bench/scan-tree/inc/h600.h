@@ -0,0 +1,42 @@
+#pragma once
+/* header 600 */
+#include <vector>
+#include "h6196.h"
+#include "h8890.h"
+#include "h2598.h"
+#include "h8857.h"
+#include "h6713.h"
+#ifdef X
+#include "h2682.h"
+#endif
+struct S600 { int a; const char *s = "x//y"; };
+inline int f600_0(int x) { return x * 0; }
+inline int f600_1(int x) { return x * 1; }
+inline int f600_2(int x) { return x * 2; }
+inline int f600_3(int x) { return x * 3; }
+inline int f600_4(int x) { return x * 4; }
+inline int f600_5(int x) { return x * 5; }
+inline int f600_6(int x) { return x * 6; }
+inline int f600_7(int x) { return x * 7; }
+inline int f600_8(int x) { return x * 8; }
+inline int f600_9(int x) { return x * 9; }
+inline int f600_10(int x) { return x * 10; }
+inline int f600_11(int x) { return x * 11; }
+inline int f600_12(int x) { return x * 12; }
+inline int f600_13(int x) { return x * 13; }
+inline int f600_14(int x) { return x * 14; }
+inline int f600_15(int x) { return x * 15; }
+inline int f600_16(int x) { return x * 16; }
+inline int f600_17(int x) { return x * 17; }
+inline int f600_18(int x) { return x * 18; }
+inline int f600_19(int x) { return x * 19; }
+inline int f600_20(int x) { return x * 20; }
+inline int f600_21(int x) { return x * 21; }
+inline int f600_22(int x) { return x * 22; }
+inline int f600_23(int x) { return x * 23; }
+inline int f600_24(int x) { return x * 24; }
+inline int f600_25(int x) { return x * 25; }
+inline int f600_26(int x) { return x * 26; }
+inline int f600_27(int x) { return x * 27; }
+inline int f600_28(int x) { return x * 28; }
+inline int f600_29(int x) { return x * 29; }
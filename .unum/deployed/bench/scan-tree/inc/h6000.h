@@ -0,0 +1,42 @@
+#pragma once
+/* header 6000 */
+#include <vector>
+#include "h3638.h"
+#include "h3073.h"
+#include "h3843.h"
+#include "h1851.h"
+#include "h2243.h"
+#ifdef X
+#include "h6497.h"
+#endif
+struct S6000 { int a; const char *s = "x//y"; };
+inline int f6000_0(int x) { return x * 0; }
+inline int f6000_1(int x) { return x * 1; }
+inline int f6000_2(int x) { return x * 2; }
+inline int f6000_3(int x) { return x * 3; }
+inline int f6000_4(int x) { return x * 4; }
+inline int f6000_5(int x) { return x * 5; }
+inline int f6000_6(int x) { return x * 6; }
+inline int f6000_7(int x) { return x * 7; }
+inline int f6000_8(int x) { return x * 8; }
+inline int f6000_9(int x) { return x * 9; }
+inline int f6000_10(int x) { return x * 10; }
+inline int f6000_11(int x) { return x * 11; }
+inline int f6000_12(int x) { return x * 12; }
+inline int f6000_13(int x) { return x * 13; }
+inline int f6000_14(int x) { return x * 14; }
+inline int f6000_15(int x) { return x * 15; }
+inline int f6000_16(int x) { return x * 16; }
+inline int f6000_17(int x) { return x * 17; }
+inline int f6000_18(int x) { return x * 18; }
+inline int f6000_19(int x) { return x * 19; }
+inline int f6000_20(int x) { return x * 20; }
+inline int f6000_21(int x) { return x * 21; }
+inline int f6000_22(int x) { return x * 22; }
+inline int f6000_23(int x) { return x * 23; }
+inline int f6000_24(int x) { return x * 24; }
+inline int f6000_25(int x) { return x * 25; }
+inline int f6000_26(int x) { return x * 26; }
+inline int f6000_27(int x) { return x * 27; }
+inline int f6000_28(int x) { return x * 28; }
+inline int f6000_29(int x) { return x * 29; }
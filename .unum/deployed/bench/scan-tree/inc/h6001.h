@@ -0,0 +1,42 @@
+#pragma once
+/* header 6001 */
+#include <vector>
+#include "h6761.h"
+#include "h4102.h"
+#include "h8123.h"
+#include "h7223.h"
+#include "h8171.h"
+#ifdef X
+#include "h3211.h"
+#endif
+struct S6001 { int a; const char *s = "x//y"; };
+inline int f6001_0(int x) { return x * 0; }
+inline int f6001_1(int x) { return x * 1; }
+inline int f6001_2(int x) { return x * 2; }
+inline int f6001_3(int x) { return x * 3; }
+inline int f6001_4(int x) { return x * 4; }
+inline int f6001_5(int x) { return x * 5; }
+inline int f6001_6(int x) { return x * 6; }
+inline int f6001_7(int x) { return x * 7; }
+inline int f6001_8(int x) { return x * 8; }
+inline int f6001_9(int x) { return x * 9; }
+inline int f6001_10(int x) { return x * 10; }
+inline int f6001_11(int x) { return x * 11; }
+inline int f6001_12(int x) { return x * 12; }
+inline int f6001_13(int x) { return x * 13; }
+inline int f6001_14(int x) { return x * 14; }
+inline int f6001_15(int x) { return x * 15; }
+inline int f6001_16(int x) { return x * 16; }
+inline int f6001_17(int x) { return x * 17; }
+inline int f6001_18(int x) { return x * 18; }
+inline int f6001_19(int x) { return x * 19; }
+inline int f6001_20(int x) { return x * 20; }
+inline int f6001_21(int x) { return x * 21; }
+inline int f6001_22(int x) { return x * 22; }
+inline int f6001_23(int x) { return x * 23; }
+inline int f6001_24(int x) { return x * 24; }
+inline int f6001_25(int x) { return x * 25; }
+inline int f6001_26(int x) { return x * 26; }
+inline int f6001_27(int x) { return x * 27; }
+inline int f6001_28(int x) { return x * 28; }
+inline int f6001_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6002 */
+#include <vector>
+#include "h7229.h"
+#include "h4527.h"
+#include "h3837.h"
+#include "h8281.h"
+#include "h567.h"
+#ifdef X
+#include "h6060.h"
+#endif
+struct S6002 { int a; const char *s = "x//y"; };
+inline int f6002_0(int x) { return x * 0; }
+inline int f6002_1(int x) { return x * 1; }
+inline int f6002_2(int x) { return x * 2; }
+inline int f6002_3(int x) { return x * 3; }
+inline int f6002_4(int x) { return x * 4; }
+inline int f6002_5(int x) { return x * 5; }
+inline int f6002_6(int x) { return x * 6; }
+inline int f6002_7(int x) { return x * 7; }
+inline int f6002_8(int x) { return x * 8; }
+inline int f6002_9(int x) { return x * 9; }
+inline int f6002_10(int x) { return x * 10; }
+inline int f6002_11(int x) { return x * 11; }
+inline int f6002_12(int x) { return x * 12; }
+inline int f6002_13(int x) { return x * 13; }
+inline int f6002_14(int x) { return x * 14; }
+inline int f6002_15(int x) { return x * 15; }
+inline int f6002_16(int x) { return x * 16; }
+inline int f6002_17(int x) { return x * 17; }
+inline int f6002_18(int x) { return x * 18; }
+inline int f6002_19(int x) { return x * 19; }
+inline int f6002_20(int x) { return x * 20; }
+inline int f6002_21(int x) { return x * 21; }
+inline int f6002_22(int x) { return x * 22; }
+inline int f6002_23(int x) { return x * 23; }
+inline int f6002_24(int x) { return x * 24; }
+inline int f6002_25(int x) { return x * 25; }
+inline int f6002_26(int x) { return x * 26; }
+inline int f6002_27(int x) { return x * 27; }
+inline int f6002_28(int x) { return x * 28; }
+inline int f6002_29(int x) { return x * 29; }
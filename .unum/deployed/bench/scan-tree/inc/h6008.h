@@ -0,0 +1,42 @@
+#pragma once
+/* header 6008 */
+#include <vector>
+#include "h3871.h"
+#include "h7959.h"
+#include "h5143.h"
+#include "h1938.h"
+#include "h8759.h"
+#ifdef X
+#include "h6191.h"
+#endif
+struct S6008 { int a; const char *s = "x//y"; };
+inline int f6008_0(int x) { return x * 0; }
+inline int f6008_1(int x) { return x * 1; }
+inline int f6008_2(int x) { return x * 2; }
+inline int f6008_3(int x) { return x * 3; }
+inline int f6008_4(int x) { return x * 4; }
+inline int f6008_5(int x) { return x * 5; }
+inline int f6008_6(int x) { return x * 6; }
+inline int f6008_7(int x) { return x * 7; }
+inline int f6008_8(int x) { return x * 8; }
+inline int f6008_9(int x) { return x * 9; }
+inline int f6008_10(int x) { return x * 10; }
+inline int f6008_11(int x) { return x * 11; }
+inline int f6008_12(int x) { return x * 12; }
+inline int f6008_13(int x) { return x * 13; }
+inline int f6008_14(int x) { return x * 14; }
+inline int f6008_15(int x) { return x * 15; }
+inline int f6008_16(int x) { return x * 16; }
+inline int f6008_17(int x) { return x * 17; }
+inline int f6008_18(int x) { return x * 18; }
+inline int f6008_19(int x) { return x * 19; }
+inline int f6008_20(int x) { return x * 20; }
+inline int f6008_21(int x) { return x * 21; }
+inline int f6008_22(int x) { return x * 22; }
+inline int f6008_23(int x) { return x * 23; }
+inline int f6008_24(int x) { return x * 24; }
+inline int f6008_25(int x) { return x * 25; }
+inline int f6008_26(int x) { return x * 26; }
+inline int f6008_27(int x) { return x * 27; }
+inline int f6008_28(int x) { return x * 28; }
+inline int f6008_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6010 */
+#include <vector>
+#include "h3642.h"
+#include "h1604.h"
+#include "h8493.h"
+#include "h9369.h"
+#include "h8047.h"
+#ifdef X
+#include "h9628.h"
+#endif
+struct S6010 { int a; const char *s = "x//y"; };
+inline int f6010_0(int x) { return x * 0; }
+inline int f6010_1(int x) { return x * 1; }
+inline int f6010_2(int x) { return x * 2; }
+inline int f6010_3(int x) { return x * 3; }
+inline int f6010_4(int x) { return x * 4; }
+inline int f6010_5(int x) { return x * 5; }
+inline int f6010_6(int x) { return x * 6; }
+inline int f6010_7(int x) { return x * 7; }
+inline int f6010_8(int x) { return x * 8; }
+inline int f6010_9(int x) { return x * 9; }
+inline int f6010_10(int x) { return x * 10; }
+inline int f6010_11(int x) { return x * 11; }
+inline int f6010_12(int x) { return x * 12; }
+inline int f6010_13(int x) { return x * 13; }
+inline int f6010_14(int x) { return x * 14; }
+inline int f6010_15(int x) { return x * 15; }
+inline int f6010_16(int x) { return x * 16; }
+inline int f6010_17(int x) { return x * 17; }
+inline int f6010_18(int x) { return x * 18; }
+inline int f6010_19(int x) { return x * 19; }
+inline int f6010_20(int x) { return x * 20; }
+inline int f6010_21(int x) { return x * 21; }
+inline int f6010_22(int x) { return x * 22; }
+inline int f6010_23(int x) { return x * 23; }
+inline int f6010_24(int x) { return x * 24; }
+inline int f6010_25(int x) { return x * 25; }
+inline int f6010_26(int x) { return x * 26; }
+inline int f6010_27(int x) { return x * 27; }
+inline int f6010_28(int x) { return x * 28; }
+inline int f6010_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6014 */
+#include <vector>
+#include "h3017.h"
+#include "h1040.h"
+#include "h8360.h"
+#include "h406.h"
+#include "h4228.h"
+#ifdef X
+#include "h3865.h"
+#endif
+struct S6014 { int a; const char *s = "x//y"; };
+inline int f6014_0(int x) { return x * 0; }
+inline int f6014_1(int x) { return x * 1; }
+inline int f6014_2(int x) { return x * 2; }
+inline int f6014_3(int x) { return x * 3; }
+inline int f6014_4(int x) { return x * 4; }
+inline int f6014_5(int x) { return x * 5; }
+inline int f6014_6(int x) { return x * 6; }
+inline int f6014_7(int x) { return x * 7; }
+inline int f6014_8(int x) { return x * 8; }
+inline int f6014_9(int x) { return x * 9; }
+inline int f6014_10(int x) { return x * 10; }
+inline int f6014_11(int x) { return x * 11; }
+inline int f6014_12(int x) { return x * 12; }
+inline int f6014_13(int x) { return x * 13; }
+inline int f6014_14(int x) { return x * 14; }
+inline int f6014_15(int x) { return x * 15; }
+inline int f6014_16(int x) { return x * 16; }
+inline int f6014_17(int x) { return x * 17; }
+inline int f6014_18(int x) { return x * 18; }
+inline int f6014_19(int x) { return x * 19; }
+inline int f6014_20(int x) { return x * 20; }
+inline int f6014_21(int x) { return x * 21; }
+inline int f6014_22(int x) { return x * 22; }
+inline int f6014_23(int x) { return x * 23; }
+inline int f6014_24(int x) { return x * 24; }
+inline int f6014_25(int x) { return x * 25; }
+inline int f6014_26(int x) { return x * 26; }
+inline int f6014_27(int x) { return x * 27; }
+inline int f6014_28(int x) { return x * 28; }
+inline int f6014_29(int x) { return x * 29; }
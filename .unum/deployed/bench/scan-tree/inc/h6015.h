@@ -0,0 +1,42 @@
+#pragma once
+/* header 6015 */
+#include <vector>
+#include "h9172.h"
+#include "h4600.h"
+#include "h7693.h"
+#include "h7201.h"
+#include "h5075.h"
+#ifdef X
+#include "h7677.h"
+#endif
+struct S6015 { int a; const char *s = "x//y"; };
+inline int f6015_0(int x) { return x * 0; }
+inline int f6015_1(int x) { return x * 1; }
+inline int f6015_2(int x) { return x * 2; }
+inline int f6015_3(int x) { return x * 3; }
+inline int f6015_4(int x) { return x * 4; }
+inline int f6015_5(int x) { return x * 5; }
+inline int f6015_6(int x) { return x * 6; }
+inline int f6015_7(int x) { return x * 7; }
+inline int f6015_8(int x) { return x * 8; }
+inline int f6015_9(int x) { return x * 9; }
+inline int f6015_10(int x) { return x * 10; }
+inline int f6015_11(int x) { return x * 11; }
+inline int f6015_12(int x) { return x * 12; }
+inline int f6015_13(int x) { return x * 13; }
+inline int f6015_14(int x) { return x * 14; }
+inline int f6015_15(int x) { return x * 15; }
+inline int f6015_16(int x) { return x * 16; }
+inline int f6015_17(int x) { return x * 17; }
+inline int f6015_18(int x) { return x * 18; }
+inline int f6015_19(int x) { return x * 19; }
+inline int f6015_20(int x) { return x * 20; }
+inline int f6015_21(int x) { return x * 21; }
+inline int f6015_22(int x) { return x * 22; }
+inline int f6015_23(int x) { return x * 23; }
+inline int f6015_24(int x) { return x * 24; }
+inline int f6015_25(int x) { return x * 25; }
+inline int f6015_26(int x) { return x * 26; }
+inline int f6015_27(int x) { return x * 27; }
+inline int f6015_28(int x) { return x * 28; }
+inline int f6015_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6017 */
+#include <vector>
+#include "h2888.h"
+#include "h2699.h"
+#include "h9804.h"
+#include "h7041.h"
+#include "h5399.h"
+#ifdef X
+#include "h2256.h"
+#endif
+struct S6017 { int a; const char *s = "x//y"; };
+inline int f6017_0(int x) { return x * 0; }
+inline int f6017_1(int x) { return x * 1; }
+inline int f6017_2(int x) { return x * 2; }
+inline int f6017_3(int x) { return x * 3; }
+inline int f6017_4(int x) { return x * 4; }
+inline int f6017_5(int x) { return x * 5; }
+inline int f6017_6(int x) { return x * 6; }
+inline int f6017_7(int x) { return x * 7; }
+inline int f6017_8(int x) { return x * 8; }
+inline int f6017_9(int x) { return x * 9; }
+inline int f6017_10(int x) { return x * 10; }
+inline int f6017_11(int x) { return x * 11; }
+inline int f6017_12(int x) { return x * 12; }
+inline int f6017_13(int x) { return x * 13; }
+inline int f6017_14(int x) { return x * 14; }
+inline int f6017_15(int x) { return x * 15; }
+inline int f6017_16(int x) { return x * 16; }
+inline int f6017_17(int x) { return x * 17; }
+inline int f6017_18(int x) { return x * 18; }
+inline int f6017_19(int x) { return x * 19; }
+inline int f6017_20(int x) { return x * 20; }
+inline int f6017_21(int x) { return x * 21; }
+inline int f6017_22(int x) { return x * 22; }
+inline int f6017_23(int x) { return x * 23; }
+inline int f6017_24(int x) { return x * 24; }
+inline int f6017_25(int x) { return x * 25; }
+inline int f6017_26(int x) { return x * 26; }
+inline int f6017_27(int x) { return x * 27; }
+inline int f6017_28(int x) { return x * 28; }
+inline int f6017_29(int x) { return x * 29; }
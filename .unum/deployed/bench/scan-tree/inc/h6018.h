@@ -0,0 +1,42 @@
+#pragma once
+/* header 6018 */
+#include <vector>
+#include "h9220.h"
+#include "h7649.h"
+#include "h6486.h"
+#include "h2161.h"
+#include "h4137.h"
+#ifdef X
+#include "h8913.h"
+#endif
+struct S6018 { int a; const char *s = "x//y"; };
+inline int f6018_0(int x) { return x * 0; }
+inline int f6018_1(int x) { return x * 1; }
+inline int f6018_2(int x) { return x * 2; }
+inline int f6018_3(int x) { return x * 3; }
+inline int f6018_4(int x) { return x * 4; }
+inline int f6018_5(int x) { return x * 5; }
+inline int f6018_6(int x) { return x * 6; }
+inline int f6018_7(int x) { return x * 7; }
+inline int f6018_8(int x) { return x * 8; }
+inline int f6018_9(int x) { return x * 9; }
+inline int f6018_10(int x) { return x * 10; }
+inline int f6018_11(int x) { return x * 11; }
+inline int f6018_12(int x) { return x * 12; }
+inline int f6018_13(int x) { return x * 13; }
+inline int f6018_14(int x) { return x * 14; }
+inline int f6018_15(int x) { return x * 15; }
+inline int f6018_16(int x) { return x * 16; }
+inline int f6018_17(int x) { return x * 17; }
+inline int f6018_18(int x) { return x * 18; }
+inline int f6018_19(int x) { return x * 19; }
+inline int f6018_20(int x) { return x * 20; }
+inline int f6018_21(int x) { return x * 21; }
+inline int f6018_22(int x) { return x * 22; }
+inline int f6018_23(int x) { return x * 23; }
+inline int f6018_24(int x) { return x * 24; }
+inline int f6018_25(int x) { return x * 25; }
+inline int f6018_26(int x) { return x * 26; }
+inline int f6018_27(int x) { return x * 27; }
+inline int f6018_28(int x) { return x * 28; }
+inline int f6018_29(int x) { return x * 29; }
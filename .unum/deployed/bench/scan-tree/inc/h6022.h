@@ -0,0 +1,42 @@
+#pragma once
+/* header 6022 */
+#include <vector>
+#include "h5788.h"
+#include "h1810.h"
+#include "h1481.h"
+#include "h5009.h"
+#include "h41.h"
+#ifdef X
+#include "h8849.h"
+#endif
+struct S6022 { int a; const char *s = "x//y"; };
+inline int f6022_0(int x) { return x * 0; }
+inline int f6022_1(int x) { return x * 1; }
+inline int f6022_2(int x) { return x * 2; }
+inline int f6022_3(int x) { return x * 3; }
+inline int f6022_4(int x) { return x * 4; }
+inline int f6022_5(int x) { return x * 5; }
+inline int f6022_6(int x) { return x * 6; }
+inline int f6022_7(int x) { return x * 7; }
+inline int f6022_8(int x) { return x * 8; }
+inline int f6022_9(int x) { return x * 9; }
+inline int f6022_10(int x) { return x * 10; }
+inline int f6022_11(int x) { return x * 11; }
+inline int f6022_12(int x) { return x * 12; }
+inline int f6022_13(int x) { return x * 13; }
+inline int f6022_14(int x) { return x * 14; }
+inline int f6022_15(int x) { return x * 15; }
+inline int f6022_16(int x) { return x * 16; }
+inline int f6022_17(int x) { return x * 17; }
+inline int f6022_18(int x) { return x * 18; }
+inline int f6022_19(int x) { return x * 19; }
+inline int f6022_20(int x) { return x * 20; }
+inline int f6022_21(int x) { return x * 21; }
+inline int f6022_22(int x) { return x * 22; }
+inline int f6022_23(int x) { return x * 23; }
+inline int f6022_24(int x) { return x * 24; }
+inline int f6022_25(int x) { return x * 25; }
+inline int f6022_26(int x) { return x * 26; }
+inline int f6022_27(int x) { return x * 27; }
+inline int f6022_28(int x) { return x * 28; }
+inline int f6022_29(int x) { return x * 29; }
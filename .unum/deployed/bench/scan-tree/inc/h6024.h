@@ -0,0 +1,42 @@
+#pragma once
+/* header 6024 */
+#include <vector>
+#include "h2300.h"
+#include "h4136.h"
+#include "h9392.h"
+#include "h6805.h"
+#include "h5831.h"
+#ifdef X
+#include "h8906.h"
+#endif
+struct S6024 { int a; const char *s = "x//y"; };
+inline int f6024_0(int x) { return x * 0; }
+inline int f6024_1(int x) { return x * 1; }
+inline int f6024_2(int x) { return x * 2; }
+inline int f6024_3(int x) { return x * 3; }
+inline int f6024_4(int x) { return x * 4; }
+inline int f6024_5(int x) { return x * 5; }
+inline int f6024_6(int x) { return x * 6; }
+inline int f6024_7(int x) { return x * 7; }
+inline int f6024_8(int x) { return x * 8; }
+inline int f6024_9(int x) { return x * 9; }
+inline int f6024_10(int x) { return x * 10; }
+inline int f6024_11(int x) { return x * 11; }
+inline int f6024_12(int x) { return x * 12; }
+inline int f6024_13(int x) { return x * 13; }
+inline int f6024_14(int x) { return x * 14; }
+inline int f6024_15(int x) { return x * 15; }
+inline int f6024_16(int x) { return x * 16; }
+inline int f6024_17(int x) { return x * 17; }
+inline int f6024_18(int x) { return x * 18; }
+inline int f6024_19(int x) { return x * 19; }
+inline int f6024_20(int x) { return x * 20; }
+inline int f6024_21(int x) { return x * 21; }
+inline int f6024_22(int x) { return x * 22; }
+inline int f6024_23(int x) { return x * 23; }
+inline int f6024_24(int x) { return x * 24; }
+inline int f6024_25(int x) { return x * 25; }
+inline int f6024_26(int x) { return x * 26; }
+inline int f6024_27(int x) { return x * 27; }
+inline int f6024_28(int x) { return x * 28; }
+inline int f6024_29(int x) { return x * 29; }
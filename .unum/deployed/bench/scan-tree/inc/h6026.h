@@ -0,0 +1,42 @@
+#pragma once
+/* header 6026 */
+#include <vector>
+#include "h4187.h"
+#include "h6017.h"
+#include "h3053.h"
+#include "h3569.h"
+#include "h6054.h"
+#ifdef X
+#include "h5934.h"
+#endif
+struct S6026 { int a; const char *s = "x//y"; };
+inline int f6026_0(int x) { return x * 0; }
+inline int f6026_1(int x) { return x * 1; }
+inline int f6026_2(int x) { return x * 2; }
+inline int f6026_3(int x) { return x * 3; }
+inline int f6026_4(int x) { return x * 4; }
+inline int f6026_5(int x) { return x * 5; }
+inline int f6026_6(int x) { return x * 6; }
+inline int f6026_7(int x) { return x * 7; }
+inline int f6026_8(int x) { return x * 8; }
+inline int f6026_9(int x) { return x * 9; }
+inline int f6026_10(int x) { return x * 10; }
+inline int f6026_11(int x) { return x * 11; }
+inline int f6026_12(int x) { return x * 12; }
+inline int f6026_13(int x) { return x * 13; }
+inline int f6026_14(int x) { return x * 14; }
+inline int f6026_15(int x) { return x * 15; }
+inline int f6026_16(int x) { return x * 16; }
+inline int f6026_17(int x) { return x * 17; }
+inline int f6026_18(int x) { return x * 18; }
+inline int f6026_19(int x) { return x * 19; }
+inline int f6026_20(int x) { return x * 20; }
+inline int f6026_21(int x) { return x * 21; }
+inline int f6026_22(int x) { return x * 22; }
+inline int f6026_23(int x) { return x * 23; }
+inline int f6026_24(int x) { return x * 24; }
+inline int f6026_25(int x) { return x * 25; }
+inline int f6026_26(int x) { return x * 26; }
+inline int f6026_27(int x) { return x * 27; }
+inline int f6026_28(int x) { return x * 28; }
+inline int f6026_29(int x) { return x * 29; }
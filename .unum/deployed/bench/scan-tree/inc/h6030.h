@@ -0,0 +1,42 @@
+#pragma once
+/* header 6030 */
+#include <vector>
+#include "h3971.h"
+#include "h7919.h"
+#include "h8574.h"
+#include "h3182.h"
+#include "h2250.h"
+#ifdef X
+#include "h6999.h"
+#endif
+struct S6030 { int a; const char *s = "x//y"; };
+inline int f6030_0(int x) { return x * 0; }
+inline int f6030_1(int x) { return x * 1; }
+inline int f6030_2(int x) { return x * 2; }
+inline int f6030_3(int x) { return x * 3; }
+inline int f6030_4(int x) { return x * 4; }
+inline int f6030_5(int x) { return x * 5; }
+inline int f6030_6(int x) { return x * 6; }
+inline int f6030_7(int x) { return x * 7; }
+inline int f6030_8(int x) { return x * 8; }
+inline int f6030_9(int x) { return x * 9; }
+inline int f6030_10(int x) { return x * 10; }
+inline int f6030_11(int x) { return x * 11; }
+inline int f6030_12(int x) { return x * 12; }
+inline int f6030_13(int x) { return x * 13; }
+inline int f6030_14(int x) { return x * 14; }
+inline int f6030_15(int x) { return x * 15; }
+inline int f6030_16(int x) { return x * 16; }
+inline int f6030_17(int x) { return x * 17; }
+inline int f6030_18(int x) { return x * 18; }
+inline int f6030_19(int x) { return x * 19; }
+inline int f6030_20(int x) { return x * 20; }
+inline int f6030_21(int x) { return x * 21; }
+inline int f6030_22(int x) { return x * 22; }
+inline int f6030_23(int x) { return x * 23; }
+inline int f6030_24(int x) { return x * 24; }
+inline int f6030_25(int x) { return x * 25; }
+inline int f6030_26(int x) { return x * 26; }
+inline int f6030_27(int x) { return x * 27; }
+inline int f6030_28(int x) { return x * 28; }
+inline int f6030_29(int x) { return x * 29; }
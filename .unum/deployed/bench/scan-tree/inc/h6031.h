@@ -0,0 +1,42 @@
+#pragma once
+/* header 6031 */
+#include <vector>
+#include "h5044.h"
+#include "h10.h"
+#include "h946.h"
+#include "h9315.h"
+#include "h8272.h"
+#ifdef X
+#include "h4441.h"
+#endif
+struct S6031 { int a; const char *s = "x//y"; };
+inline int f6031_0(int x) { return x * 0; }
+inline int f6031_1(int x) { return x * 1; }
+inline int f6031_2(int x) { return x * 2; }
+inline int f6031_3(int x) { return x * 3; }
+inline int f6031_4(int x) { return x * 4; }
+inline int f6031_5(int x) { return x * 5; }
+inline int f6031_6(int x) { return x * 6; }
+inline int f6031_7(int x) { return x * 7; }
+inline int f6031_8(int x) { return x * 8; }
+inline int f6031_9(int x) { return x * 9; }
+inline int f6031_10(int x) { return x * 10; }
+inline int f6031_11(int x) { return x * 11; }
+inline int f6031_12(int x) { return x * 12; }
+inline int f6031_13(int x) { return x * 13; }
+inline int f6031_14(int x) { return x * 14; }
+inline int f6031_15(int x) { return x * 15; }
+inline int f6031_16(int x) { return x * 16; }
+inline int f6031_17(int x) { return x * 17; }
+inline int f6031_18(int x) { return x * 18; }
+inline int f6031_19(int x) { return x * 19; }
+inline int f6031_20(int x) { return x * 20; }
+inline int f6031_21(int x) { return x * 21; }
+inline int f6031_22(int x) { return x * 22; }
+inline int f6031_23(int x) { return x * 23; }
+inline int f6031_24(int x) { return x * 24; }
+inline int f6031_25(int x) { return x * 25; }
+inline int f6031_26(int x) { return x * 26; }
+inline int f6031_27(int x) { return x * 27; }
+inline int f6031_28(int x) { return x * 28; }
+inline int f6031_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6034 */
+#include <vector>
+#include "h9991.h"
+#include "h7429.h"
+#include "h3864.h"
+#include "h4078.h"
+#include "h5144.h"
+#ifdef X
+#include "h2915.h"
+#endif
+struct S6034 { int a; const char *s = "x//y"; };
+inline int f6034_0(int x) { return x * 0; }
+inline int f6034_1(int x) { return x * 1; }
+inline int f6034_2(int x) { return x * 2; }
+inline int f6034_3(int x) { return x * 3; }
+inline int f6034_4(int x) { return x * 4; }
+inline int f6034_5(int x) { return x * 5; }
+inline int f6034_6(int x) { return x * 6; }
+inline int f6034_7(int x) { return x * 7; }
+inline int f6034_8(int x) { return x * 8; }
+inline int f6034_9(int x) { return x * 9; }
+inline int f6034_10(int x) { return x * 10; }
+inline int f6034_11(int x) { return x * 11; }
+inline int f6034_12(int x) { return x * 12; }
+inline int f6034_13(int x) { return x * 13; }
+inline int f6034_14(int x) { return x * 14; }
+inline int f6034_15(int x) { return x * 15; }
+inline int f6034_16(int x) { return x * 16; }
+inline int f6034_17(int x) { return x * 17; }
+inline int f6034_18(int x) { return x * 18; }
+inline int f6034_19(int x) { return x * 19; }
+inline int f6034_20(int x) { return x * 20; }
+inline int f6034_21(int x) { return x * 21; }
+inline int f6034_22(int x) { return x * 22; }
+inline int f6034_23(int x) { return x * 23; }
+inline int f6034_24(int x) { return x * 24; }
+inline int f6034_25(int x) { return x * 25; }
+inline int f6034_26(int x) { return x * 26; }
+inline int f6034_27(int x) { return x * 27; }
+inline int f6034_28(int x) { return x * 28; }
+inline int f6034_29(int x) { return x * 29; }
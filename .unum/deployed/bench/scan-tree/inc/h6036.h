@@ -0,0 +1,42 @@
+#pragma once
+/* header 6036 */
+#include <vector>
+#include "h9827.h"
+#include "h8469.h"
+#include "h4348.h"
+#include "h5469.h"
+#include "h1301.h"
+#ifdef X
+#include "h3272.h"
+#endif
+struct S6036 { int a; const char *s = "x//y"; };
+inline int f6036_0(int x) { return x * 0; }
+inline int f6036_1(int x) { return x * 1; }
+inline int f6036_2(int x) { return x * 2; }
+inline int f6036_3(int x) { return x * 3; }
+inline int f6036_4(int x) { return x * 4; }
+inline int f6036_5(int x) { return x * 5; }
+inline int f6036_6(int x) { return x * 6; }
+inline int f6036_7(int x) { return x * 7; }
+inline int f6036_8(int x) { return x * 8; }
+inline int f6036_9(int x) { return x * 9; }
+inline int f6036_10(int x) { return x * 10; }
+inline int f6036_11(int x) { return x * 11; }
+inline int f6036_12(int x) { return x * 12; }
+inline int f6036_13(int x) { return x * 13; }
+inline int f6036_14(int x) { return x * 14; }
+inline int f6036_15(int x) { return x * 15; }
+inline int f6036_16(int x) { return x * 16; }
+inline int f6036_17(int x) { return x * 17; }
+inline int f6036_18(int x) { return x * 18; }
+inline int f6036_19(int x) { return x * 19; }
+inline int f6036_20(int x) { return x * 20; }
+inline int f6036_21(int x) { return x * 21; }
+inline int f6036_22(int x) { return x * 22; }
+inline int f6036_23(int x) { return x * 23; }
+inline int f6036_24(int x) { return x * 24; }
+inline int f6036_25(int x) { return x * 25; }
+inline int f6036_26(int x) { return x * 26; }
+inline int f6036_27(int x) { return x * 27; }
+inline int f6036_28(int x) { return x * 28; }
+inline int f6036_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6037 */
+#include <vector>
+#include "h566.h"
+#include "h5810.h"
+#include "h9183.h"
+#include "h2188.h"
+#include "h4214.h"
+#ifdef X
+#include "h9592.h"
+#endif
+struct S6037 { int a; const char *s = "x//y"; };
+inline int f6037_0(int x) { return x * 0; }
+inline int f6037_1(int x) { return x * 1; }
+inline int f6037_2(int x) { return x * 2; }
+inline int f6037_3(int x) { return x * 3; }
+inline int f6037_4(int x) { return x * 4; }
+inline int f6037_5(int x) { return x * 5; }
+inline int f6037_6(int x) { return x * 6; }
+inline int f6037_7(int x) { return x * 7; }
+inline int f6037_8(int x) { return x * 8; }
+inline int f6037_9(int x) { return x * 9; }
+inline int f6037_10(int x) { return x * 10; }
+inline int f6037_11(int x) { return x * 11; }
+inline int f6037_12(int x) { return x * 12; }
+inline int f6037_13(int x) { return x * 13; }
+inline int f6037_14(int x) { return x * 14; }
+inline int f6037_15(int x) { return x * 15; }
+inline int f6037_16(int x) { return x * 16; }
+inline int f6037_17(int x) { return x * 17; }
+inline int f6037_18(int x) { return x * 18; }
+inline int f6037_19(int x) { return x * 19; }
+inline int f6037_20(int x) { return x * 20; }
+inline int f6037_21(int x) { return x * 21; }
+inline int f6037_22(int x) { return x * 22; }
+inline int f6037_23(int x) { return x * 23; }
+inline int f6037_24(int x) { return x * 24; }
+inline int f6037_25(int x) { return x * 25; }
+inline int f6037_26(int x) { return x * 26; }
+inline int f6037_27(int x) { return x * 27; }
+inline int f6037_28(int x) { return x * 28; }
+inline int f6037_29(int x) { return x * 29; }
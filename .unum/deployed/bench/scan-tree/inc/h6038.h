@@ -0,0 +1,42 @@
+#pragma once
+/* header 6038 */
+#include <vector>
+#include "h4784.h"
+#include "h8357.h"
+#include "h1571.h"
+#include "h2418.h"
+#include "h2734.h"
+#ifdef X
+#include "h530.h"
+#endif
+struct S6038 { int a; const char *s = "x//y"; };
+inline int f6038_0(int x) { return x * 0; }
+inline int f6038_1(int x) { return x * 1; }
+inline int f6038_2(int x) { return x * 2; }
+inline int f6038_3(int x) { return x * 3; }
+inline int f6038_4(int x) { return x * 4; }
+inline int f6038_5(int x) { return x * 5; }
+inline int f6038_6(int x) { return x * 6; }
+inline int f6038_7(int x) { return x * 7; }
+inline int f6038_8(int x) { return x * 8; }
+inline int f6038_9(int x) { return x * 9; }
+inline int f6038_10(int x) { return x * 10; }
+inline int f6038_11(int x) { return x * 11; }
+inline int f6038_12(int x) { return x * 12; }
+inline int f6038_13(int x) { return x * 13; }
+inline int f6038_14(int x) { return x * 14; }
+inline int f6038_15(int x) { return x * 15; }
+inline int f6038_16(int x) { return x * 16; }
+inline int f6038_17(int x) { return x * 17; }
+inline int f6038_18(int x) { return x * 18; }
+inline int f6038_19(int x) { return x * 19; }
+inline int f6038_20(int x) { return x * 20; }
+inline int f6038_21(int x) { return x * 21; }
+inline int f6038_22(int x) { return x * 22; }
+inline int f6038_23(int x) { return x * 23; }
+inline int f6038_24(int x) { return x * 24; }
+inline int f6038_25(int x) { return x * 25; }
+inline int f6038_26(int x) { return x * 26; }
+inline int f6038_27(int x) { return x * 27; }
+inline int f6038_28(int x) { return x * 28; }
+inline int f6038_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 604 */
+#include <vector>
+#include "h604.h"
+#include "h9560.h"
+#include "h5339.h"
+#include "h5584.h"
+#include "h1189.h"
+#ifdef X
+#include "h669.h"
+#endif
+struct S604 { int a; const char *s = "x//y"; };
+inline int f604_0(int x) { return x * 0; }
+inline int f604_1(int x) { return x * 1; }
+inline int f604_2(int x) { return x * 2; }
+inline int f604_3(int x) { return x * 3; }
+inline int f604_4(int x) { return x * 4; }
+inline int f604_5(int x) { return x * 5; }
+inline int f604_6(int x) { return x * 6; }
+inline int f604_7(int x) { return x * 7; }
+inline int f604_8(int x) { return x * 8; }
+inline int f604_9(int x) { return x * 9; }
+inline int f604_10(int x) { return x * 10; }
+inline int f604_11(int x) { return x * 11; }
+inline int f604_12(int x) { return x * 12; }
+inline int f604_13(int x) { return x * 13; }
+inline int f604_14(int x) { return x * 14; }
+inline int f604_15(int x) { return x * 15; }
+inline int f604_16(int x) { return x * 16; }
+inline int f604_17(int x) { return x * 17; }
+inline int f604_18(int x) { return x * 18; }
+inline int f604_19(int x) { return x * 19; }
+inline int f604_20(int x) { return x * 20; }
+inline int f604_21(int x) { return x * 21; }
+inline int f604_22(int x) { return x * 22; }
+inline int f604_23(int x) { return x * 23; }
+inline int f604_24(int x) { return x * 24; }
+inline int f604_25(int x) { return x * 25; }
+inline int f604_26(int x) { return x * 26; }
+inline int f604_27(int x) { return x * 27; }
+inline int f604_28(int x) { return x * 28; }
+inline int f604_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6043 */
+#include <vector>
+#include "h753.h"
+#include "h7765.h"
+#include "h4046.h"
+#include "h4996.h"
+#include "h6215.h"
+#ifdef X
+#include "h2233.h"
+#endif
+struct S6043 { int a; const char *s = "x//y"; };
+inline int f6043_0(int x) { return x * 0; }
+inline int f6043_1(int x) { return x * 1; }
+inline int f6043_2(int x) { return x * 2; }
+inline int f6043_3(int x) { return x * 3; }
+inline int f6043_4(int x) { return x * 4; }
+inline int f6043_5(int x) { return x * 5; }
+inline int f6043_6(int x) { return x * 6; }
+inline int f6043_7(int x) { return x * 7; }
+inline int f6043_8(int x) { return x * 8; }
+inline int f6043_9(int x) { return x * 9; }
+inline int f6043_10(int x) { return x * 10; }
+inline int f6043_11(int x) { return x * 11; }
+inline int f6043_12(int x) { return x * 12; }
+inline int f6043_13(int x) { return x * 13; }
+inline int f6043_14(int x) { return x * 14; }
+inline int f6043_15(int x) { return x * 15; }
+inline int f6043_16(int x) { return x * 16; }
+inline int f6043_17(int x) { return x * 17; }
+inline int f6043_18(int x) { return x * 18; }
+inline int f6043_19(int x) { return x * 19; }
+inline int f6043_20(int x) { return x * 20; }
+inline int f6043_21(int x) { return x * 21; }
+inline int f6043_22(int x) { return x * 22; }
+inline int f6043_23(int x) { return x * 23; }
+inline int f6043_24(int x) { return x * 24; }
+inline int f6043_25(int x) { return x * 25; }
+inline int f6043_26(int x) { return x * 26; }
+inline int f6043_27(int x) { return x * 27; }
+inline int f6043_28(int x) { return x * 28; }
+inline int f6043_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6049 */
+#include <vector>
+#include "h7399.h"
+#include "h4177.h"
+#include "h2527.h"
+#include "h9752.h"
+#include "h1451.h"
+#ifdef X
+#include "h8515.h"
+#endif
+struct S6049 { int a; const char *s = "x//y"; };
+inline int f6049_0(int x) { return x * 0; }
+inline int f6049_1(int x) { return x * 1; }
+inline int f6049_2(int x) { return x * 2; }
+inline int f6049_3(int x) { return x * 3; }
+inline int f6049_4(int x) { return x * 4; }
+inline int f6049_5(int x) { return x * 5; }
+inline int f6049_6(int x) { return x * 6; }
+inline int f6049_7(int x) { return x * 7; }
+inline int f6049_8(int x) { return x * 8; }
+inline int f6049_9(int x) { return x * 9; }
+inline int f6049_10(int x) { return x * 10; }
+inline int f6049_11(int x) { return x * 11; }
+inline int f6049_12(int x) { return x * 12; }
+inline int f6049_13(int x) { return x * 13; }
+inline int f6049_14(int x) { return x * 14; }
+inline int f6049_15(int x) { return x * 15; }
+inline int f6049_16(int x) { return x * 16; }
+inline int f6049_17(int x) { return x * 17; }
+inline int f6049_18(int x) { return x * 18; }
+inline int f6049_19(int x) { return x * 19; }
+inline int f6049_20(int x) { return x * 20; }
+inline int f6049_21(int x) { return x * 21; }
+inline int f6049_22(int x) { return x * 22; }
+inline int f6049_23(int x) { return x * 23; }
+inline int f6049_24(int x) { return x * 24; }
+inline int f6049_25(int x) { return x * 25; }
+inline int f6049_26(int x) { return x * 26; }
+inline int f6049_27(int x) { return x * 27; }
+inline int f6049_28(int x) { return x * 28; }
+inline int f6049_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 605 */
+#include <vector>
+#include "h5545.h"
+#include "h2024.h"
+#include "h5364.h"
+#include "h2486.h"
+#include "h1371.h"
+#ifdef X
+#include "h8623.h"
+#endif
+struct S605 { int a; const char *s = "x//y"; };
+inline int f605_0(int x) { return x * 0; }
+inline int f605_1(int x) { return x * 1; }
+inline int f605_2(int x) { return x * 2; }
+inline int f605_3(int x) { return x * 3; }
+inline int f605_4(int x) { return x * 4; }
+inline int f605_5(int x) { return x * 5; }
+inline int f605_6(int x) { return x * 6; }
+inline int f605_7(int x) { return x * 7; }
+inline int f605_8(int x) { return x * 8; }
+inline int f605_9(int x) { return x * 9; }
+inline int f605_10(int x) { return x * 10; }
+inline int f605_11(int x) { return x * 11; }
+inline int f605_12(int x) { return x * 12; }
+inline int f605_13(int x) { return x * 13; }
+inline int f605_14(int x) { return x * 14; }
+inline int f605_15(int x) { return x * 15; }
+inline int f605_16(int x) { return x * 16; }
+inline int f605_17(int x) { return x * 17; }
+inline int f605_18(int x) { return x * 18; }
+inline int f605_19(int x) { return x * 19; }
+inline int f605_20(int x) { return x * 20; }
+inline int f605_21(int x) { return x * 21; }
+inline int f605_22(int x) { return x * 22; }
+inline int f605_23(int x) { return x * 23; }
+inline int f605_24(int x) { return x * 24; }
+inline int f605_25(int x) { return x * 25; }
+inline int f605_26(int x) { return x * 26; }
+inline int f605_27(int x) { return x * 27; }
+inline int f605_28(int x) { return x * 28; }
+inline int f605_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6051 */
+#include <vector>
+#include "h8633.h"
+#include "h9178.h"
+#include "h8893.h"
+#include "h1540.h"
+#include "h458.h"
+#ifdef X
+#include "h4378.h"
+#endif
+struct S6051 { int a; const char *s = "x//y"; };
+inline int f6051_0(int x) { return x * 0; }
+inline int f6051_1(int x) { return x * 1; }
+inline int f6051_2(int x) { return x * 2; }
+inline int f6051_3(int x) { return x * 3; }
+inline int f6051_4(int x) { return x * 4; }
+inline int f6051_5(int x) { return x * 5; }
+inline int f6051_6(int x) { return x * 6; }
+inline int f6051_7(int x) { return x * 7; }
+inline int f6051_8(int x) { return x * 8; }
+inline int f6051_9(int x) { return x * 9; }
+inline int f6051_10(int x) { return x * 10; }
+inline int f6051_11(int x) { return x * 11; }
+inline int f6051_12(int x) { return x * 12; }
+inline int f6051_13(int x) { return x * 13; }
+inline int f6051_14(int x) { return x * 14; }
+inline int f6051_15(int x) { return x * 15; }
+inline int f6051_16(int x) { return x * 16; }
+inline int f6051_17(int x) { return x * 17; }
+inline int f6051_18(int x) { return x * 18; }
+inline int f6051_19(int x) { return x * 19; }
+inline int f6051_20(int x) { return x * 20; }
+inline int f6051_21(int x) { return x * 21; }
+inline int f6051_22(int x) { return x * 22; }
+inline int f6051_23(int x) { return x * 23; }
+inline int f6051_24(int x) { return x * 24; }
+inline int f6051_25(int x) { return x * 25; }
+inline int f6051_26(int x) { return x * 26; }
+inline int f6051_27(int x) { return x * 27; }
+inline int f6051_28(int x) { return x * 28; }
+inline int f6051_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6054 */
+#include <vector>
+#include "h5373.h"
+#include "h3275.h"
+#include "h5553.h"
+#include "h445.h"
+#include "h915.h"
+#ifdef X
+#include "h4249.h"
+#endif
+struct S6054 { int a; const char *s = "x//y"; };
+inline int f6054_0(int x) { return x * 0; }
+inline int f6054_1(int x) { return x * 1; }
+inline int f6054_2(int x) { return x * 2; }
+inline int f6054_3(int x) { return x * 3; }
+inline int f6054_4(int x) { return x * 4; }
+inline int f6054_5(int x) { return x * 5; }
+inline int f6054_6(int x) { return x * 6; }
+inline int f6054_7(int x) { return x * 7; }
+inline int f6054_8(int x) { return x * 8; }
+inline int f6054_9(int x) { return x * 9; }
+inline int f6054_10(int x) { return x * 10; }
+inline int f6054_11(int x) { return x * 11; }
+inline int f6054_12(int x) { return x * 12; }
+inline int f6054_13(int x) { return x * 13; }
+inline int f6054_14(int x) { return x * 14; }
+inline int f6054_15(int x) { return x * 15; }
+inline int f6054_16(int x) { return x * 16; }
+inline int f6054_17(int x) { return x * 17; }
+inline int f6054_18(int x) { return x * 18; }
+inline int f6054_19(int x) { return x * 19; }
+inline int f6054_20(int x) { return x * 20; }
+inline int f6054_21(int x) { return x * 21; }
+inline int f6054_22(int x) { return x * 22; }
+inline int f6054_23(int x) { return x * 23; }
+inline int f6054_24(int x) { return x * 24; }
+inline int f6054_25(int x) { return x * 25; }
+inline int f6054_26(int x) { return x * 26; }
+inline int f6054_27(int x) { return x * 27; }
+inline int f6054_28(int x) { return x * 28; }
+inline int f6054_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6055 */
+#include <vector>
+#include "h9151.h"
+#include "h2508.h"
+#include "h3501.h"
+#include "h4533.h"
+#include "h4528.h"
+#ifdef X
+#include "h3847.h"
+#endif
+struct S6055 { int a; const char *s = "x//y"; };
+inline int f6055_0(int x) { return x * 0; }
+inline int f6055_1(int x) { return x * 1; }
+inline int f6055_2(int x) { return x * 2; }
+inline int f6055_3(int x) { return x * 3; }
+inline int f6055_4(int x) { return x * 4; }
+inline int f6055_5(int x) { return x * 5; }
+inline int f6055_6(int x) { return x * 6; }
+inline int f6055_7(int x) { return x * 7; }
+inline int f6055_8(int x) { return x * 8; }
+inline int f6055_9(int x) { return x * 9; }
+inline int f6055_10(int x) { return x * 10; }
+inline int f6055_11(int x) { return x * 11; }
+inline int f6055_12(int x) { return x * 12; }
+inline int f6055_13(int x) { return x * 13; }
+inline int f6055_14(int x) { return x * 14; }
+inline int f6055_15(int x) { return x * 15; }
+inline int f6055_16(int x) { return x * 16; }
+inline int f6055_17(int x) { return x * 17; }
+inline int f6055_18(int x) { return x * 18; }
+inline int f6055_19(int x) { return x * 19; }
+inline int f6055_20(int x) { return x * 20; }
+inline int f6055_21(int x) { return x * 21; }
+inline int f6055_22(int x) { return x * 22; }
+inline int f6055_23(int x) { return x * 23; }
+inline int f6055_24(int x) { return x * 24; }
+inline int f6055_25(int x) { return x * 25; }
+inline int f6055_26(int x) { return x * 26; }
+inline int f6055_27(int x) { return x * 27; }
+inline int f6055_28(int x) { return x * 28; }
+inline int f6055_29(int x) { return x * 29; }
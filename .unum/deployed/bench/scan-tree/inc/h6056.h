@@ -0,0 +1,42 @@
+#pragma once
+/* header 6056 */
+#include <vector>
+#include "h4687.h"
+#include "h8415.h"
+#include "h5845.h"
+#include "h8081.h"
+#include "h4195.h"
+#ifdef X
+#include "h8108.h"
+#endif
+struct S6056 { int a; const char *s = "x//y"; };
+inline int f6056_0(int x) { return x * 0; }
+inline int f6056_1(int x) { return x * 1; }
+inline int f6056_2(int x) { return x * 2; }
+inline int f6056_3(int x) { return x * 3; }
+inline int f6056_4(int x) { return x * 4; }
+inline int f6056_5(int x) { return x * 5; }
+inline int f6056_6(int x) { return x * 6; }
+inline int f6056_7(int x) { return x * 7; }
+inline int f6056_8(int x) { return x * 8; }
+inline int f6056_9(int x) { return x * 9; }
+inline int f6056_10(int x) { return x * 10; }
+inline int f6056_11(int x) { return x * 11; }
+inline int f6056_12(int x) { return x * 12; }
+inline int f6056_13(int x) { return x * 13; }
+inline int f6056_14(int x) { return x * 14; }
+inline int f6056_15(int x) { return x * 15; }
+inline int f6056_16(int x) { return x * 16; }
+inline int f6056_17(int x) { return x * 17; }
+inline int f6056_18(int x) { return x * 18; }
+inline int f6056_19(int x) { return x * 19; }
+inline int f6056_20(int x) { return x * 20; }
+inline int f6056_21(int x) { return x * 21; }
+inline int f6056_22(int x) { return x * 22; }
+inline int f6056_23(int x) { return x * 23; }
+inline int f6056_24(int x) { return x * 24; }
+inline int f6056_25(int x) { return x * 25; }
+inline int f6056_26(int x) { return x * 26; }
+inline int f6056_27(int x) { return x * 27; }
+inline int f6056_28(int x) { return x * 28; }
+inline int f6056_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6059 */
+#include <vector>
+#include "h7218.h"
+#include "h1820.h"
+#include "h3785.h"
+#include "h7537.h"
+#include "h6772.h"
+#ifdef X
+#include "h3174.h"
+#endif
+struct S6059 { int a; const char *s = "x//y"; };
+inline int f6059_0(int x) { return x * 0; }
+inline int f6059_1(int x) { return x * 1; }
+inline int f6059_2(int x) { return x * 2; }
+inline int f6059_3(int x) { return x * 3; }
+inline int f6059_4(int x) { return x * 4; }
+inline int f6059_5(int x) { return x * 5; }
+inline int f6059_6(int x) { return x * 6; }
+inline int f6059_7(int x) { return x * 7; }
+inline int f6059_8(int x) { return x * 8; }
+inline int f6059_9(int x) { return x * 9; }
+inline int f6059_10(int x) { return x * 10; }
+inline int f6059_11(int x) { return x * 11; }
+inline int f6059_12(int x) { return x * 12; }
+inline int f6059_13(int x) { return x * 13; }
+inline int f6059_14(int x) { return x * 14; }
+inline int f6059_15(int x) { return x * 15; }
+inline int f6059_16(int x) { return x * 16; }
+inline int f6059_17(int x) { return x * 17; }
+inline int f6059_18(int x) { return x * 18; }
+inline int f6059_19(int x) { return x * 19; }
+inline int f6059_20(int x) { return x * 20; }
+inline int f6059_21(int x) { return x * 21; }
+inline int f6059_22(int x) { return x * 22; }
+inline int f6059_23(int x) { return x * 23; }
+inline int f6059_24(int x) { return x * 24; }
+inline int f6059_25(int x) { return x * 25; }
+inline int f6059_26(int x) { return x * 26; }
+inline int f6059_27(int x) { return x * 27; }
+inline int f6059_28(int x) { return x * 28; }
+inline int f6059_29(int x) { return x * 29; }
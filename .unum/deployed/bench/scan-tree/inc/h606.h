@@ -0,0 +1,42 @@
+#pragma once
+/* header 606 */
+#include <vector>
+#include "h9947.h"
+#include "h9704.h"
+#include "h5904.h"
+#include "h3161.h"
+#include "h4601.h"
+#ifdef X
+#include "h2117.h"
+#endif
+struct S606 { int a; const char *s = "x//y"; };
+inline int f606_0(int x) { return x * 0; }
+inline int f606_1(int x) { return x * 1; }
+inline int f606_2(int x) { return x * 2; }
+inline int f606_3(int x) { return x * 3; }
+inline int f606_4(int x) { return x * 4; }
+inline int f606_5(int x) { return x * 5; }
+inline int f606_6(int x) { return x * 6; }
+inline int f606_7(int x) { return x * 7; }
+inline int f606_8(int x) { return x * 8; }
+inline int f606_9(int x) { return x * 9; }
+inline int f606_10(int x) { return x * 10; }
+inline int f606_11(int x) { return x * 11; }
+inline int f606_12(int x) { return x * 12; }
+inline int f606_13(int x) { return x * 13; }
+inline int f606_14(int x) { return x * 14; }
+inline int f606_15(int x) { return x * 15; }
+inline int f606_16(int x) { return x * 16; }
+inline int f606_17(int x) { return x * 17; }
+inline int f606_18(int x) { return x * 18; }
+inline int f606_19(int x) { return x * 19; }
+inline int f606_20(int x) { return x * 20; }
+inline int f606_21(int x) { return x * 21; }
+inline int f606_22(int x) { return x * 22; }
+inline int f606_23(int x) { return x * 23; }
+inline int f606_24(int x) { return x * 24; }
+inline int f606_25(int x) { return x * 25; }
+inline int f606_26(int x) { return x * 26; }
+inline int f606_27(int x) { return x * 27; }
+inline int f606_28(int x) { return x * 28; }
+inline int f606_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6061 */
+#include <vector>
+#include "h4750.h"
+#include "h2937.h"
+#include "h4959.h"
+#include "h5133.h"
+#include "h4972.h"
+#ifdef X
+#include "h653.h"
+#endif
+struct S6061 { int a; const char *s = "x//y"; };
+inline int f6061_0(int x) { return x * 0; }
+inline int f6061_1(int x) { return x * 1; }
+inline int f6061_2(int x) { return x * 2; }
+inline int f6061_3(int x) { return x * 3; }
+inline int f6061_4(int x) { return x * 4; }
+inline int f6061_5(int x) { return x * 5; }
+inline int f6061_6(int x) { return x * 6; }
+inline int f6061_7(int x) { return x * 7; }
+inline int f6061_8(int x) { return x * 8; }
+inline int f6061_9(int x) { return x * 9; }
+inline int f6061_10(int x) { return x * 10; }
+inline int f6061_11(int x) { return x * 11; }
+inline int f6061_12(int x) { return x * 12; }
+inline int f6061_13(int x) { return x * 13; }
+inline int f6061_14(int x) { return x * 14; }
+inline int f6061_15(int x) { return x * 15; }
+inline int f6061_16(int x) { return x * 16; }
+inline int f6061_17(int x) { return x * 17; }
+inline int f6061_18(int x) { return x * 18; }
+inline int f6061_19(int x) { return x * 19; }
+inline int f6061_20(int x) { return x * 20; }
+inline int f6061_21(int x) { return x * 21; }
+inline int f6061_22(int x) { return x * 22; }
+inline int f6061_23(int x) { return x * 23; }
+inline int f6061_24(int x) { return x * 24; }
+inline int f6061_25(int x) { return x * 25; }
+inline int f6061_26(int x) { return x * 26; }
+inline int f6061_27(int x) { return x * 27; }
+inline int f6061_28(int x) { return x * 28; }
+inline int f6061_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6062 */
+#include <vector>
+#include "h2647.h"
+#include "h4533.h"
+#include "h4062.h"
+#include "h5272.h"
+#include "h1686.h"
+#ifdef X
+#include "h3119.h"
+#endif
+struct S6062 { int a; const char *s = "x//y"; };
+inline int f6062_0(int x) { return x * 0; }
+inline int f6062_1(int x) { return x * 1; }
+inline int f6062_2(int x) { return x * 2; }
+inline int f6062_3(int x) { return x * 3; }
+inline int f6062_4(int x) { return x * 4; }
+inline int f6062_5(int x) { return x * 5; }
+inline int f6062_6(int x) { return x * 6; }
+inline int f6062_7(int x) { return x * 7; }
+inline int f6062_8(int x) { return x * 8; }
+inline int f6062_9(int x) { return x * 9; }
+inline int f6062_10(int x) { return x * 10; }
+inline int f6062_11(int x) { return x * 11; }
+inline int f6062_12(int x) { return x * 12; }
+inline int f6062_13(int x) { return x * 13; }
+inline int f6062_14(int x) { return x * 14; }
+inline int f6062_15(int x) { return x * 15; }
+inline int f6062_16(int x) { return x * 16; }
+inline int f6062_17(int x) { return x * 17; }
+inline int f6062_18(int x) { return x * 18; }
+inline int f6062_19(int x) { return x * 19; }
+inline int f6062_20(int x) { return x * 20; }
+inline int f6062_21(int x) { return x * 21; }
+inline int f6062_22(int x) { return x * 22; }
+inline int f6062_23(int x) { return x * 23; }
+inline int f6062_24(int x) { return x * 24; }
+inline int f6062_25(int x) { return x * 25; }
+inline int f6062_26(int x) { return x * 26; }
+inline int f6062_27(int x) { return x * 27; }
+inline int f6062_28(int x) { return x * 28; }
+inline int f6062_29(int x) { return x * 29; }
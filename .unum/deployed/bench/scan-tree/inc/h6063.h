@@ -0,0 +1,42 @@
+#pragma once
+/* header 6063 */
+#include <vector>
+#include "h8525.h"
+#include "h420.h"
+#include "h4866.h"
+#include "h3039.h"
+#include "h4872.h"
+#ifdef X
+#include "h1841.h"
+#endif
+struct S6063 { int a; const char *s = "x//y"; };
+inline int f6063_0(int x) { return x * 0; }
+inline int f6063_1(int x) { return x * 1; }
+inline int f6063_2(int x) { return x * 2; }
+inline int f6063_3(int x) { return x * 3; }
+inline int f6063_4(int x) { return x * 4; }
+inline int f6063_5(int x) { return x * 5; }
+inline int f6063_6(int x) { return x * 6; }
+inline int f6063_7(int x) { return x * 7; }
+inline int f6063_8(int x) { return x * 8; }
+inline int f6063_9(int x) { return x * 9; }
+inline int f6063_10(int x) { return x * 10; }
+inline int f6063_11(int x) { return x * 11; }
+inline int f6063_12(int x) { return x * 12; }
+inline int f6063_13(int x) { return x * 13; }
+inline int f6063_14(int x) { return x * 14; }
+inline int f6063_15(int x) { return x * 15; }
+inline int f6063_16(int x) { return x * 16; }
+inline int f6063_17(int x) { return x * 17; }
+inline int f6063_18(int x) { return x * 18; }
+inline int f6063_19(int x) { return x * 19; }
+inline int f6063_20(int x) { return x * 20; }
+inline int f6063_21(int x) { return x * 21; }
+inline int f6063_22(int x) { return x * 22; }
+inline int f6063_23(int x) { return x * 23; }
+inline int f6063_24(int x) { return x * 24; }
+inline int f6063_25(int x) { return x * 25; }
+inline int f6063_26(int x) { return x * 26; }
+inline int f6063_27(int x) { return x * 27; }
+inline int f6063_28(int x) { return x * 28; }
+inline int f6063_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6065 */
+#include <vector>
+#include "h1659.h"
+#include "h6333.h"
+#include "h7472.h"
+#include "h3712.h"
+#include "h7695.h"
+#ifdef X
+#include "h8636.h"
+#endif
+struct S6065 { int a; const char *s = "x//y"; };
+inline int f6065_0(int x) { return x * 0; }
+inline int f6065_1(int x) { return x * 1; }
+inline int f6065_2(int x) { return x * 2; }
+inline int f6065_3(int x) { return x * 3; }
+inline int f6065_4(int x) { return x * 4; }
+inline int f6065_5(int x) { return x * 5; }
+inline int f6065_6(int x) { return x * 6; }
+inline int f6065_7(int x) { return x * 7; }
+inline int f6065_8(int x) { return x * 8; }
+inline int f6065_9(int x) { return x * 9; }
+inline int f6065_10(int x) { return x * 10; }
+inline int f6065_11(int x) { return x * 11; }
+inline int f6065_12(int x) { return x * 12; }
+inline int f6065_13(int x) { return x * 13; }
+inline int f6065_14(int x) { return x * 14; }
+inline int f6065_15(int x) { return x * 15; }
+inline int f6065_16(int x) { return x * 16; }
+inline int f6065_17(int x) { return x * 17; }
+inline int f6065_18(int x) { return x * 18; }
+inline int f6065_19(int x) { return x * 19; }
+inline int f6065_20(int x) { return x * 20; }
+inline int f6065_21(int x) { return x * 21; }
+inline int f6065_22(int x) { return x * 22; }
+inline int f6065_23(int x) { return x * 23; }
+inline int f6065_24(int x) { return x * 24; }
+inline int f6065_25(int x) { return x * 25; }
+inline int f6065_26(int x) { return x * 26; }
+inline int f6065_27(int x) { return x * 27; }
+inline int f6065_28(int x) { return x * 28; }
+inline int f6065_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6068 */
+#include <vector>
+#include "h3499.h"
+#include "h3197.h"
+#include "h2622.h"
+#include "h1671.h"
+#include "h7701.h"
+#ifdef X
+#include "h7391.h"
+#endif
+struct S6068 { int a; const char *s = "x//y"; };
+inline int f6068_0(int x) { return x * 0; }
+inline int f6068_1(int x) { return x * 1; }
+inline int f6068_2(int x) { return x * 2; }
+inline int f6068_3(int x) { return x * 3; }
+inline int f6068_4(int x) { return x * 4; }
+inline int f6068_5(int x) { return x * 5; }
+inline int f6068_6(int x) { return x * 6; }
+inline int f6068_7(int x) { return x * 7; }
+inline int f6068_8(int x) { return x * 8; }
+inline int f6068_9(int x) { return x * 9; }
+inline int f6068_10(int x) { return x * 10; }
+inline int f6068_11(int x) { return x * 11; }
+inline int f6068_12(int x) { return x * 12; }
+inline int f6068_13(int x) { return x * 13; }
+inline int f6068_14(int x) { return x * 14; }
+inline int f6068_15(int x) { return x * 15; }
+inline int f6068_16(int x) { return x * 16; }
+inline int f6068_17(int x) { return x * 17; }
+inline int f6068_18(int x) { return x * 18; }
+inline int f6068_19(int x) { return x * 19; }
+inline int f6068_20(int x) { return x * 20; }
+inline int f6068_21(int x) { return x * 21; }
+inline int f6068_22(int x) { return x * 22; }
+inline int f6068_23(int x) { return x * 23; }
+inline int f6068_24(int x) { return x * 24; }
+inline int f6068_25(int x) { return x * 25; }
+inline int f6068_26(int x) { return x * 26; }
+inline int f6068_27(int x) { return x * 27; }
+inline int f6068_28(int x) { return x * 28; }
+inline int f6068_29(int x) { return x * 29; }
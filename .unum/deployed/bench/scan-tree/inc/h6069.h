@@ -0,0 +1,42 @@
+#pragma once
+/* header 6069 */
+#include <vector>
+#include "h9332.h"
+#include "h7271.h"
+#include "h4203.h"
+#include "h7195.h"
+#include "h5477.h"
+#ifdef X
+#include "h383.h"
+#endif
+struct S6069 { int a; const char *s = "x//y"; };
+inline int f6069_0(int x) { return x * 0; }
+inline int f6069_1(int x) { return x * 1; }
+inline int f6069_2(int x) { return x * 2; }
+inline int f6069_3(int x) { return x * 3; }
+inline int f6069_4(int x) { return x * 4; }
+inline int f6069_5(int x) { return x * 5; }
+inline int f6069_6(int x) { return x * 6; }
+inline int f6069_7(int x) { return x * 7; }
+inline int f6069_8(int x) { return x * 8; }
+inline int f6069_9(int x) { return x * 9; }
+inline int f6069_10(int x) { return x * 10; }
+inline int f6069_11(int x) { return x * 11; }
+inline int f6069_12(int x) { return x * 12; }
+inline int f6069_13(int x) { return x * 13; }
+inline int f6069_14(int x) { return x * 14; }
+inline int f6069_15(int x) { return x * 15; }
+inline int f6069_16(int x) { return x * 16; }
+inline int f6069_17(int x) { return x * 17; }
+inline int f6069_18(int x) { return x * 18; }
+inline int f6069_19(int x) { return x * 19; }
+inline int f6069_20(int x) { return x * 20; }
+inline int f6069_21(int x) { return x * 21; }
+inline int f6069_22(int x) { return x * 22; }
+inline int f6069_23(int x) { return x * 23; }
+inline int f6069_24(int x) { return x * 24; }
+inline int f6069_25(int x) { return x * 25; }
+inline int f6069_26(int x) { return x * 26; }
+inline int f6069_27(int x) { return x * 27; }
+inline int f6069_28(int x) { return x * 28; }
+inline int f6069_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 607 */
+#include <vector>
+#include "h5078.h"
+#include "h1870.h"
+#include "h5528.h"
+#include "h1705.h"
+#include "h4912.h"
+#ifdef X
+#include "h1685.h"
+#endif
+struct S607 { int a; const char *s = "x//y"; };
+inline int f607_0(int x) { return x * 0; }
+inline int f607_1(int x) { return x * 1; }
+inline int f607_2(int x) { return x * 2; }
+inline int f607_3(int x) { return x * 3; }
+inline int f607_4(int x) { return x * 4; }
+inline int f607_5(int x) { return x * 5; }
+inline int f607_6(int x) { return x * 6; }
+inline int f607_7(int x) { return x * 7; }
+inline int f607_8(int x) { return x * 8; }
+inline int f607_9(int x) { return x * 9; }
+inline int f607_10(int x) { return x * 10; }
+inline int f607_11(int x) { return x * 11; }
+inline int f607_12(int x) { return x * 12; }
+inline int f607_13(int x) { return x * 13; }
+inline int f607_14(int x) { return x * 14; }
+inline int f607_15(int x) { return x * 15; }
+inline int f607_16(int x) { return x * 16; }
+inline int f607_17(int x) { return x * 17; }
+inline int f607_18(int x) { return x * 18; }
+inline int f607_19(int x) { return x * 19; }
+inline int f607_20(int x) { return x * 20; }
+inline int f607_21(int x) { return x * 21; }
+inline int f607_22(int x) { return x * 22; }
+inline int f607_23(int x) { return x * 23; }
+inline int f607_24(int x) { return x * 24; }
+inline int f607_25(int x) { return x * 25; }
+inline int f607_26(int x) { return x * 26; }
+inline int f607_27(int x) { return x * 27; }
+inline int f607_28(int x) { return x * 28; }
+inline int f607_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6071 */
+#include <vector>
+#include "h6769.h"
+#include "h4191.h"
+#include "h818.h"
+#include "h3778.h"
+#include "h9863.h"
+#ifdef X
+#include "h8137.h"
+#endif
+struct S6071 { int a; const char *s = "x//y"; };
+inline int f6071_0(int x) { return x * 0; }
+inline int f6071_1(int x) { return x * 1; }
+inline int f6071_2(int x) { return x * 2; }
+inline int f6071_3(int x) { return x * 3; }
+inline int f6071_4(int x) { return x * 4; }
+inline int f6071_5(int x) { return x * 5; }
+inline int f6071_6(int x) { return x * 6; }
+inline int f6071_7(int x) { return x * 7; }
+inline int f6071_8(int x) { return x * 8; }
+inline int f6071_9(int x) { return x * 9; }
+inline int f6071_10(int x) { return x * 10; }
+inline int f6071_11(int x) { return x * 11; }
+inline int f6071_12(int x) { return x * 12; }
+inline int f6071_13(int x) { return x * 13; }
+inline int f6071_14(int x) { return x * 14; }
+inline int f6071_15(int x) { return x * 15; }
+inline int f6071_16(int x) { return x * 16; }
+inline int f6071_17(int x) { return x * 17; }
+inline int f6071_18(int x) { return x * 18; }
+inline int f6071_19(int x) { return x * 19; }
+inline int f6071_20(int x) { return x * 20; }
+inline int f6071_21(int x) { return x * 21; }
+inline int f6071_22(int x) { return x * 22; }
+inline int f6071_23(int x) { return x * 23; }
+inline int f6071_24(int x) { return x * 24; }
+inline int f6071_25(int x) { return x * 25; }
+inline int f6071_26(int x) { return x * 26; }
+inline int f6071_27(int x) { return x * 27; }
+inline int f6071_28(int x) { return x * 28; }
+inline int f6071_29(int x) { return x * 29; }
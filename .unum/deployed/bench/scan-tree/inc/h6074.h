@@ -0,0 +1,42 @@
+#pragma once
+/* header 6074 */
+#include <vector>
+#include "h5062.h"
+#include "h4429.h"
+#include "h9547.h"
+#include "h5111.h"
+#include "h1450.h"
+#ifdef X
+#include "h5131.h"
+#endif
+struct S6074 { int a; const char *s = "x//y"; };
+inline int f6074_0(int x) { return x * 0; }
+inline int f6074_1(int x) { return x * 1; }
+inline int f6074_2(int x) { return x * 2; }
+inline int f6074_3(int x) { return x * 3; }
+inline int f6074_4(int x) { return x * 4; }
+inline int f6074_5(int x) { return x * 5; }
+inline int f6074_6(int x) { return x * 6; }
+inline int f6074_7(int x) { return x * 7; }
+inline int f6074_8(int x) { return x * 8; }
+inline int f6074_9(int x) { return x * 9; }
+inline int f6074_10(int x) { return x * 10; }
+inline int f6074_11(int x) { return x * 11; }
+inline int f6074_12(int x) { return x * 12; }
+inline int f6074_13(int x) { return x * 13; }
+inline int f6074_14(int x) { return x * 14; }
+inline int f6074_15(int x) { return x * 15; }
+inline int f6074_16(int x) { return x * 16; }
+inline int f6074_17(int x) { return x * 17; }
+inline int f6074_18(int x) { return x * 18; }
+inline int f6074_19(int x) { return x * 19; }
+inline int f6074_20(int x) { return x * 20; }
+inline int f6074_21(int x) { return x * 21; }
+inline int f6074_22(int x) { return x * 22; }
+inline int f6074_23(int x) { return x * 23; }
+inline int f6074_24(int x) { return x * 24; }
+inline int f6074_25(int x) { return x * 25; }
+inline int f6074_26(int x) { return x * 26; }
+inline int f6074_27(int x) { return x * 27; }
+inline int f6074_28(int x) { return x * 28; }
+inline int f6074_29(int x) { return x * 29; }
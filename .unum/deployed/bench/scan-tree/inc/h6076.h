@@ -0,0 +1,42 @@
+#pragma once
+/* header 6076 */
+#include <vector>
+#include "h5059.h"
+#include "h5180.h"
+#include "h2612.h"
+#include "h399.h"
+#include "h180.h"
+#ifdef X
+#include "h7302.h"
+#endif
+struct S6076 { int a; const char *s = "x//y"; };
+inline int f6076_0(int x) { return x * 0; }
+inline int f6076_1(int x) { return x * 1; }
+inline int f6076_2(int x) { return x * 2; }
+inline int f6076_3(int x) { return x * 3; }
+inline int f6076_4(int x) { return x * 4; }
+inline int f6076_5(int x) { return x * 5; }
+inline int f6076_6(int x) { return x * 6; }
+inline int f6076_7(int x) { return x * 7; }
+inline int f6076_8(int x) { return x * 8; }
+inline int f6076_9(int x) { return x * 9; }
+inline int f6076_10(int x) { return x * 10; }
+inline int f6076_11(int x) { return x * 11; }
+inline int f6076_12(int x) { return x * 12; }
+inline int f6076_13(int x) { return x * 13; }
+inline int f6076_14(int x) { return x * 14; }
+inline int f6076_15(int x) { return x * 15; }
+inline int f6076_16(int x) { return x * 16; }
+inline int f6076_17(int x) { return x * 17; }
+inline int f6076_18(int x) { return x * 18; }
+inline int f6076_19(int x) { return x * 19; }
+inline int f6076_20(int x) { return x * 20; }
+inline int f6076_21(int x) { return x * 21; }
+inline int f6076_22(int x) { return x * 22; }
+inline int f6076_23(int x) { return x * 23; }
+inline int f6076_24(int x) { return x * 24; }
+inline int f6076_25(int x) { return x * 25; }
+inline int f6076_26(int x) { return x * 26; }
+inline int f6076_27(int x) { return x * 27; }
+inline int f6076_28(int x) { return x * 28; }
+inline int f6076_29(int x) { return x * 29; }
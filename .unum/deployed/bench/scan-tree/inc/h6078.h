@@ -0,0 +1,42 @@
+#pragma once
+/* header 6078 */
+#include <vector>
+#include "h4994.h"
+#include "h8307.h"
+#include "h4080.h"
+#include "h2713.h"
+#include "h777.h"
+#ifdef X
+#include "h8704.h"
+#endif
+struct S6078 { int a; const char *s = "x//y"; };
+inline int f6078_0(int x) { return x * 0; }
+inline int f6078_1(int x) { return x * 1; }
+inline int f6078_2(int x) { return x * 2; }
+inline int f6078_3(int x) { return x * 3; }
+inline int f6078_4(int x) { return x * 4; }
+inline int f6078_5(int x) { return x * 5; }
+inline int f6078_6(int x) { return x * 6; }
+inline int f6078_7(int x) { return x * 7; }
+inline int f6078_8(int x) { return x * 8; }
+inline int f6078_9(int x) { return x * 9; }
+inline int f6078_10(int x) { return x * 10; }
+inline int f6078_11(int x) { return x * 11; }
+inline int f6078_12(int x) { return x * 12; }
+inline int f6078_13(int x) { return x * 13; }
+inline int f6078_14(int x) { return x * 14; }
+inline int f6078_15(int x) { return x * 15; }
+inline int f6078_16(int x) { return x * 16; }
+inline int f6078_17(int x) { return x * 17; }
+inline int f6078_18(int x) { return x * 18; }
+inline int f6078_19(int x) { return x * 19; }
+inline int f6078_20(int x) { return x * 20; }
+inline int f6078_21(int x) { return x * 21; }
+inline int f6078_22(int x) { return x * 22; }
+inline int f6078_23(int x) { return x * 23; }
+inline int f6078_24(int x) { return x * 24; }
+inline int f6078_25(int x) { return x * 25; }
+inline int f6078_26(int x) { return x * 26; }
+inline int f6078_27(int x) { return x * 27; }
+inline int f6078_28(int x) { return x * 28; }
+inline int f6078_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6079 */
+#include <vector>
+#include "h1320.h"
+#include "h9421.h"
+#include "h3838.h"
+#include "h7678.h"
+#include "h6566.h"
+#ifdef X
+#include "h4520.h"
+#endif
+struct S6079 { int a; const char *s = "x//y"; };
+inline int f6079_0(int x) { return x * 0; }
+inline int f6079_1(int x) { return x * 1; }
+inline int f6079_2(int x) { return x * 2; }
+inline int f6079_3(int x) { return x * 3; }
+inline int f6079_4(int x) { return x * 4; }
+inline int f6079_5(int x) { return x * 5; }
+inline int f6079_6(int x) { return x * 6; }
+inline int f6079_7(int x) { return x * 7; }
+inline int f6079_8(int x) { return x * 8; }
+inline int f6079_9(int x) { return x * 9; }
+inline int f6079_10(int x) { return x * 10; }
+inline int f6079_11(int x) { return x * 11; }
+inline int f6079_12(int x) { return x * 12; }
+inline int f6079_13(int x) { return x * 13; }
+inline int f6079_14(int x) { return x * 14; }
+inline int f6079_15(int x) { return x * 15; }
+inline int f6079_16(int x) { return x * 16; }
+inline int f6079_17(int x) { return x * 17; }
+inline int f6079_18(int x) { return x * 18; }
+inline int f6079_19(int x) { return x * 19; }
+inline int f6079_20(int x) { return x * 20; }
+inline int f6079_21(int x) { return x * 21; }
+inline int f6079_22(int x) { return x * 22; }
+inline int f6079_23(int x) { return x * 23; }
+inline int f6079_24(int x) { return x * 24; }
+inline int f6079_25(int x) { return x * 25; }
+inline int f6079_26(int x) { return x * 26; }
+inline int f6079_27(int x) { return x * 27; }
+inline int f6079_28(int x) { return x * 28; }
+inline int f6079_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 608 */
+#include <vector>
+#include "h120.h"
+#include "h7592.h"
+#include "h9625.h"
+#include "h4666.h"
+#include "h2556.h"
+#ifdef X
+#include "h9589.h"
+#endif
+struct S608 { int a; const char *s = "x//y"; };
+inline int f608_0(int x) { return x * 0; }
+inline int f608_1(int x) { return x * 1; }
+inline int f608_2(int x) { return x * 2; }
+inline int f608_3(int x) { return x * 3; }
+inline int f608_4(int x) { return x * 4; }
+inline int f608_5(int x) { return x * 5; }
+inline int f608_6(int x) { return x * 6; }
+inline int f608_7(int x) { return x * 7; }
+inline int f608_8(int x) { return x * 8; }
+inline int f608_9(int x) { return x * 9; }
+inline int f608_10(int x) { return x * 10; }
+inline int f608_11(int x) { return x * 11; }
+inline int f608_12(int x) { return x * 12; }
+inline int f608_13(int x) { return x * 13; }
+inline int f608_14(int x) { return x * 14; }
+inline int f608_15(int x) { return x * 15; }
+inline int f608_16(int x) { return x * 16; }
+inline int f608_17(int x) { return x * 17; }
+inline int f608_18(int x) { return x * 18; }
+inline int f608_19(int x) { return x * 19; }
+inline int f608_20(int x) { return x * 20; }
+inline int f608_21(int x) { return x * 21; }
+inline int f608_22(int x) { return x * 22; }
+inline int f608_23(int x) { return x * 23; }
+inline int f608_24(int x) { return x * 24; }
+inline int f608_25(int x) { return x * 25; }
+inline int f608_26(int x) { return x * 26; }
+inline int f608_27(int x) { return x * 27; }
+inline int f608_28(int x) { return x * 28; }
+inline int f608_29(int x) { return x * 29; }
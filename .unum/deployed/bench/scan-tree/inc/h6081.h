@@ -0,0 +1,42 @@
+#pragma once
+/* header 6081 */
+#include <vector>
+#include "h6008.h"
+#include "h1447.h"
+#include "h6351.h"
+#include "h5609.h"
+#include "h5219.h"
+#ifdef X
+#include "h7586.h"
+#endif
+struct S6081 { int a; const char *s = "x//y"; };
+inline int f6081_0(int x) { return x * 0; }
+inline int f6081_1(int x) { return x * 1; }
+inline int f6081_2(int x) { return x * 2; }
+inline int f6081_3(int x) { return x * 3; }
+inline int f6081_4(int x) { return x * 4; }
+inline int f6081_5(int x) { return x * 5; }
+inline int f6081_6(int x) { return x * 6; }
+inline int f6081_7(int x) { return x * 7; }
+inline int f6081_8(int x) { return x * 8; }
+inline int f6081_9(int x) { return x * 9; }
+inline int f6081_10(int x) { return x * 10; }
+inline int f6081_11(int x) { return x * 11; }
+inline int f6081_12(int x) { return x * 12; }
+inline int f6081_13(int x) { return x * 13; }
+inline int f6081_14(int x) { return x * 14; }
+inline int f6081_15(int x) { return x * 15; }
+inline int f6081_16(int x) { return x * 16; }
+inline int f6081_17(int x) { return x * 17; }
+inline int f6081_18(int x) { return x * 18; }
+inline int f6081_19(int x) { return x * 19; }
+inline int f6081_20(int x) { return x * 20; }
+inline int f6081_21(int x) { return x * 21; }
+inline int f6081_22(int x) { return x * 22; }
+inline int f6081_23(int x) { return x * 23; }
+inline int f6081_24(int x) { return x * 24; }
+inline int f6081_25(int x) { return x * 25; }
+inline int f6081_26(int x) { return x * 26; }
+inline int f6081_27(int x) { return x * 27; }
+inline int f6081_28(int x) { return x * 28; }
+inline int f6081_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6082 */
+#include <vector>
+#include "h6099.h"
+#include "h4304.h"
+#include "h7865.h"
+#include "h4076.h"
+#include "h465.h"
+#ifdef X
+#include "h4829.h"
+#endif
+struct S6082 { int a; const char *s = "x//y"; };
+inline int f6082_0(int x) { return x * 0; }
+inline int f6082_1(int x) { return x * 1; }
+inline int f6082_2(int x) { return x * 2; }
+inline int f6082_3(int x) { return x * 3; }
+inline int f6082_4(int x) { return x * 4; }
+inline int f6082_5(int x) { return x * 5; }
+inline int f6082_6(int x) { return x * 6; }
+inline int f6082_7(int x) { return x * 7; }
+inline int f6082_8(int x) { return x * 8; }
+inline int f6082_9(int x) { return x * 9; }
+inline int f6082_10(int x) { return x * 10; }
+inline int f6082_11(int x) { return x * 11; }
+inline int f6082_12(int x) { return x * 12; }
+inline int f6082_13(int x) { return x * 13; }
+inline int f6082_14(int x) { return x * 14; }
+inline int f6082_15(int x) { return x * 15; }
+inline int f6082_16(int x) { return x * 16; }
+inline int f6082_17(int x) { return x * 17; }
+inline int f6082_18(int x) { return x * 18; }
+inline int f6082_19(int x) { return x * 19; }
+inline int f6082_20(int x) { return x * 20; }
+inline int f6082_21(int x) { return x * 21; }
+inline int f6082_22(int x) { return x * 22; }
+inline int f6082_23(int x) { return x * 23; }
+inline int f6082_24(int x) { return x * 24; }
+inline int f6082_25(int x) { return x * 25; }
+inline int f6082_26(int x) { return x * 26; }
+inline int f6082_27(int x) { return x * 27; }
+inline int f6082_28(int x) { return x * 28; }
+inline int f6082_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6083 */
+#include <vector>
+#include "h6832.h"
+#include "h2790.h"
+#include "h8587.h"
+#include "h8642.h"
+#include "h4056.h"
+#ifdef X
+#include "h2952.h"
+#endif
+struct S6083 { int a; const char *s = "x//y"; };
+inline int f6083_0(int x) { return x * 0; }
+inline int f6083_1(int x) { return x * 1; }
+inline int f6083_2(int x) { return x * 2; }
+inline int f6083_3(int x) { return x * 3; }
+inline int f6083_4(int x) { return x * 4; }
+inline int f6083_5(int x) { return x * 5; }
+inline int f6083_6(int x) { return x * 6; }
+inline int f6083_7(int x) { return x * 7; }
+inline int f6083_8(int x) { return x * 8; }
+inline int f6083_9(int x) { return x * 9; }
+inline int f6083_10(int x) { return x * 10; }
+inline int f6083_11(int x) { return x * 11; }
+inline int f6083_12(int x) { return x * 12; }
+inline int f6083_13(int x) { return x * 13; }
+inline int f6083_14(int x) { return x * 14; }
+inline int f6083_15(int x) { return x * 15; }
+inline int f6083_16(int x) { return x * 16; }
+inline int f6083_17(int x) { return x * 17; }
+inline int f6083_18(int x) { return x * 18; }
+inline int f6083_19(int x) { return x * 19; }
+inline int f6083_20(int x) { return x * 20; }
+inline int f6083_21(int x) { return x * 21; }
+inline int f6083_22(int x) { return x * 22; }
+inline int f6083_23(int x) { return x * 23; }
+inline int f6083_24(int x) { return x * 24; }
+inline int f6083_25(int x) { return x * 25; }
+inline int f6083_26(int x) { return x * 26; }
+inline int f6083_27(int x) { return x * 27; }
+inline int f6083_28(int x) { return x * 28; }
+inline int f6083_29(int x) { return x * 29; }
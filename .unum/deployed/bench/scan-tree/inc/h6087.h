@@ -0,0 +1,42 @@
+#pragma once
+/* header 6087 */
+#include <vector>
+#include "h9888.h"
+#include "h5573.h"
+#include "h5053.h"
+#include "h5875.h"
+#include "h1488.h"
+#ifdef X
+#include "h9725.h"
+#endif
+struct S6087 { int a; const char *s = "x//y"; };
+inline int f6087_0(int x) { return x * 0; }
+inline int f6087_1(int x) { return x * 1; }
+inline int f6087_2(int x) { return x * 2; }
+inline int f6087_3(int x) { return x * 3; }
+inline int f6087_4(int x) { return x * 4; }
+inline int f6087_5(int x) { return x * 5; }
+inline int f6087_6(int x) { return x * 6; }
+inline int f6087_7(int x) { return x * 7; }
+inline int f6087_8(int x) { return x * 8; }
+inline int f6087_9(int x) { return x * 9; }
+inline int f6087_10(int x) { return x * 10; }
+inline int f6087_11(int x) { return x * 11; }
+inline int f6087_12(int x) { return x * 12; }
+inline int f6087_13(int x) { return x * 13; }
+inline int f6087_14(int x) { return x * 14; }
+inline int f6087_15(int x) { return x * 15; }
+inline int f6087_16(int x) { return x * 16; }
+inline int f6087_17(int x) { return x * 17; }
+inline int f6087_18(int x) { return x * 18; }
+inline int f6087_19(int x) { return x * 19; }
+inline int f6087_20(int x) { return x * 20; }
+inline int f6087_21(int x) { return x * 21; }
+inline int f6087_22(int x) { return x * 22; }
+inline int f6087_23(int x) { return x * 23; }
+inline int f6087_24(int x) { return x * 24; }
+inline int f6087_25(int x) { return x * 25; }
+inline int f6087_26(int x) { return x * 26; }
+inline int f6087_27(int x) { return x * 27; }
+inline int f6087_28(int x) { return x * 28; }
+inline int f6087_29(int x) { return x * 29; }
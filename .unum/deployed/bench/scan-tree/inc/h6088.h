@@ -0,0 +1,42 @@
+#pragma once
+/* header 6088 */
+#include <vector>
+#include "h9620.h"
+#include "h9628.h"
+#include "h8865.h"
+#include "h9880.h"
+#include "h7851.h"
+#ifdef X
+#include "h260.h"
+#endif
+struct S6088 { int a; const char *s = "x//y"; };
+inline int f6088_0(int x) { return x * 0; }
+inline int f6088_1(int x) { return x * 1; }
+inline int f6088_2(int x) { return x * 2; }
+inline int f6088_3(int x) { return x * 3; }
+inline int f6088_4(int x) { return x * 4; }
+inline int f6088_5(int x) { return x * 5; }
+inline int f6088_6(int x) { return x * 6; }
+inline int f6088_7(int x) { return x * 7; }
+inline int f6088_8(int x) { return x * 8; }
+inline int f6088_9(int x) { return x * 9; }
+inline int f6088_10(int x) { return x * 10; }
+inline int f6088_11(int x) { return x * 11; }
+inline int f6088_12(int x) { return x * 12; }
+inline int f6088_13(int x) { return x * 13; }
+inline int f6088_14(int x) { return x * 14; }
+inline int f6088_15(int x) { return x * 15; }
+inline int f6088_16(int x) { return x * 16; }
+inline int f6088_17(int x) { return x * 17; }
+inline int f6088_18(int x) { return x * 18; }
+inline int f6088_19(int x) { return x * 19; }
+inline int f6088_20(int x) { return x * 20; }
+inline int f6088_21(int x) { return x * 21; }
+inline int f6088_22(int x) { return x * 22; }
+inline int f6088_23(int x) { return x * 23; }
+inline int f6088_24(int x) { return x * 24; }
+inline int f6088_25(int x) { return x * 25; }
+inline int f6088_26(int x) { return x * 26; }
+inline int f6088_27(int x) { return x * 27; }
+inline int f6088_28(int x) { return x * 28; }
+inline int f6088_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6089 */
+#include <vector>
+#include "h5558.h"
+#include "h3432.h"
+#include "h9402.h"
+#include "h6737.h"
+#include "h9071.h"
+#ifdef X
+#include "h3604.h"
+#endif
+struct S6089 { int a; const char *s = "x//y"; };
+inline int f6089_0(int x) { return x * 0; }
+inline int f6089_1(int x) { return x * 1; }
+inline int f6089_2(int x) { return x * 2; }
+inline int f6089_3(int x) { return x * 3; }
+inline int f6089_4(int x) { return x * 4; }
+inline int f6089_5(int x) { return x * 5; }
+inline int f6089_6(int x) { return x * 6; }
+inline int f6089_7(int x) { return x * 7; }
+inline int f6089_8(int x) { return x * 8; }
+inline int f6089_9(int x) { return x * 9; }
+inline int f6089_10(int x) { return x * 10; }
+inline int f6089_11(int x) { return x * 11; }
+inline int f6089_12(int x) { return x * 12; }
+inline int f6089_13(int x) { return x * 13; }
+inline int f6089_14(int x) { return x * 14; }
+inline int f6089_15(int x) { return x * 15; }
+inline int f6089_16(int x) { return x * 16; }
+inline int f6089_17(int x) { return x * 17; }
+inline int f6089_18(int x) { return x * 18; }
+inline int f6089_19(int x) { return x * 19; }
+inline int f6089_20(int x) { return x * 20; }
+inline int f6089_21(int x) { return x * 21; }
+inline int f6089_22(int x) { return x * 22; }
+inline int f6089_23(int x) { return x * 23; }
+inline int f6089_24(int x) { return x * 24; }
+inline int f6089_25(int x) { return x * 25; }
+inline int f6089_26(int x) { return x * 26; }
+inline int f6089_27(int x) { return x * 27; }
+inline int f6089_28(int x) { return x * 28; }
+inline int f6089_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 609 */
+#include <vector>
+#include "h6575.h"
+#include "h4982.h"
+#include "h3783.h"
+#include "h5908.h"
+#include "h6230.h"
+#ifdef X
+#include "h2795.h"
+#endif
+struct S609 { int a; const char *s = "x//y"; };
+inline int f609_0(int x) { return x * 0; }
+inline int f609_1(int x) { return x * 1; }
+inline int f609_2(int x) { return x * 2; }
+inline int f609_3(int x) { return x * 3; }
+inline int f609_4(int x) { return x * 4; }
+inline int f609_5(int x) { return x * 5; }
+inline int f609_6(int x) { return x * 6; }
+inline int f609_7(int x) { return x * 7; }
+inline int f609_8(int x) { return x * 8; }
+inline int f609_9(int x) { return x * 9; }
+inline int f609_10(int x) { return x * 10; }
+inline int f609_11(int x) { return x * 11; }
+inline int f609_12(int x) { return x * 12; }
+inline int f609_13(int x) { return x * 13; }
+inline int f609_14(int x) { return x * 14; }
+inline int f609_15(int x) { return x * 15; }
+inline int f609_16(int x) { return x * 16; }
+inline int f609_17(int x) { return x * 17; }
+inline int f609_18(int x) { return x * 18; }
+inline int f609_19(int x) { return x * 19; }
+inline int f609_20(int x) { return x * 20; }
+inline int f609_21(int x) { return x * 21; }
+inline int f609_22(int x) { return x * 22; }
+inline int f609_23(int x) { return x * 23; }
+inline int f609_24(int x) { return x * 24; }
+inline int f609_25(int x) { return x * 25; }
+inline int f609_26(int x) { return x * 26; }
+inline int f609_27(int x) { return x * 27; }
+inline int f609_28(int x) { return x * 28; }
+inline int f609_29(int x) { return x * 29; }
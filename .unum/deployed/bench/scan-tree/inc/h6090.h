@@ -0,0 +1,42 @@
+#pragma once
+/* header 6090 */
+#include <vector>
+#include "h5024.h"
+#include "h926.h"
+#include "h2728.h"
+#include "h2400.h"
+#include "h349.h"
+#ifdef X
+#include "h615.h"
+#endif
+struct S6090 { int a; const char *s = "x//y"; };
+inline int f6090_0(int x) { return x * 0; }
+inline int f6090_1(int x) { return x * 1; }
+inline int f6090_2(int x) { return x * 2; }
+inline int f6090_3(int x) { return x * 3; }
+inline int f6090_4(int x) { return x * 4; }
+inline int f6090_5(int x) { return x * 5; }
+inline int f6090_6(int x) { return x * 6; }
+inline int f6090_7(int x) { return x * 7; }
+inline int f6090_8(int x) { return x * 8; }
+inline int f6090_9(int x) { return x * 9; }
+inline int f6090_10(int x) { return x * 10; }
+inline int f6090_11(int x) { return x * 11; }
+inline int f6090_12(int x) { return x * 12; }
+inline int f6090_13(int x) { return x * 13; }
+inline int f6090_14(int x) { return x * 14; }
+inline int f6090_15(int x) { return x * 15; }
+inline int f6090_16(int x) { return x * 16; }
+inline int f6090_17(int x) { return x * 17; }
+inline int f6090_18(int x) { return x * 18; }
+inline int f6090_19(int x) { return x * 19; }
+inline int f6090_20(int x) { return x * 20; }
+inline int f6090_21(int x) { return x * 21; }
+inline int f6090_22(int x) { return x * 22; }
+inline int f6090_23(int x) { return x * 23; }
+inline int f6090_24(int x) { return x * 24; }
+inline int f6090_25(int x) { return x * 25; }
+inline int f6090_26(int x) { return x * 26; }
+inline int f6090_27(int x) { return x * 27; }
+inline int f6090_28(int x) { return x * 28; }
+inline int f6090_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6091 */
+#include <vector>
+#include "h6718.h"
+#include "h3269.h"
+#include "h2249.h"
+#include "h1484.h"
+#include "h5104.h"
+#ifdef X
+#include "h803.h"
+#endif
+struct S6091 { int a; const char *s = "x//y"; };
+inline int f6091_0(int x) { return x * 0; }
+inline int f6091_1(int x) { return x * 1; }
+inline int f6091_2(int x) { return x * 2; }
+inline int f6091_3(int x) { return x * 3; }
+inline int f6091_4(int x) { return x * 4; }
+inline int f6091_5(int x) { return x * 5; }
+inline int f6091_6(int x) { return x * 6; }
+inline int f6091_7(int x) { return x * 7; }
+inline int f6091_8(int x) { return x * 8; }
+inline int f6091_9(int x) { return x * 9; }
+inline int f6091_10(int x) { return x * 10; }
+inline int f6091_11(int x) { return x * 11; }
+inline int f6091_12(int x) { return x * 12; }
+inline int f6091_13(int x) { return x * 13; }
+inline int f6091_14(int x) { return x * 14; }
+inline int f6091_15(int x) { return x * 15; }
+inline int f6091_16(int x) { return x * 16; }
+inline int f6091_17(int x) { return x * 17; }
+inline int f6091_18(int x) { return x * 18; }
+inline int f6091_19(int x) { return x * 19; }
+inline int f6091_20(int x) { return x * 20; }
+inline int f6091_21(int x) { return x * 21; }
+inline int f6091_22(int x) { return x * 22; }
+inline int f6091_23(int x) { return x * 23; }
+inline int f6091_24(int x) { return x * 24; }
+inline int f6091_25(int x) { return x * 25; }
+inline int f6091_26(int x) { return x * 26; }
+inline int f6091_27(int x) { return x * 27; }
+inline int f6091_28(int x) { return x * 28; }
+inline int f6091_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6092 */
+#include <vector>
+#include "h3573.h"
+#include "h3055.h"
+#include "h2519.h"
+#include "h655.h"
+#include "h4546.h"
+#ifdef X
+#include "h6298.h"
+#endif
+struct S6092 { int a; const char *s = "x//y"; };
+inline int f6092_0(int x) { return x * 0; }
+inline int f6092_1(int x) { return x * 1; }
+inline int f6092_2(int x) { return x * 2; }
+inline int f6092_3(int x) { return x * 3; }
+inline int f6092_4(int x) { return x * 4; }
+inline int f6092_5(int x) { return x * 5; }
+inline int f6092_6(int x) { return x * 6; }
+inline int f6092_7(int x) { return x * 7; }
+inline int f6092_8(int x) { return x * 8; }
+inline int f6092_9(int x) { return x * 9; }
+inline int f6092_10(int x) { return x * 10; }
+inline int f6092_11(int x) { return x * 11; }
+inline int f6092_12(int x) { return x * 12; }
+inline int f6092_13(int x) { return x * 13; }
+inline int f6092_14(int x) { return x * 14; }
+inline int f6092_15(int x) { return x * 15; }
+inline int f6092_16(int x) { return x * 16; }
+inline int f6092_17(int x) { return x * 17; }
+inline int f6092_18(int x) { return x * 18; }
+inline int f6092_19(int x) { return x * 19; }
+inline int f6092_20(int x) { return x * 20; }
+inline int f6092_21(int x) { return x * 21; }
+inline int f6092_22(int x) { return x * 22; }
+inline int f6092_23(int x) { return x * 23; }
+inline int f6092_24(int x) { return x * 24; }
+inline int f6092_25(int x) { return x * 25; }
+inline int f6092_26(int x) { return x * 26; }
+inline int f6092_27(int x) { return x * 27; }
+inline int f6092_28(int x) { return x * 28; }
+inline int f6092_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6094 */
+#include <vector>
+#include "h6671.h"
+#include "h8609.h"
+#include "h4780.h"
+#include "h9446.h"
+#include "h652.h"
+#ifdef X
+#include "h1373.h"
+#endif
+struct S6094 { int a; const char *s = "x//y"; };
+inline int f6094_0(int x) { return x * 0; }
+inline int f6094_1(int x) { return x * 1; }
+inline int f6094_2(int x) { return x * 2; }
+inline int f6094_3(int x) { return x * 3; }
+inline int f6094_4(int x) { return x * 4; }
+inline int f6094_5(int x) { return x * 5; }
+inline int f6094_6(int x) { return x * 6; }
+inline int f6094_7(int x) { return x * 7; }
+inline int f6094_8(int x) { return x * 8; }
+inline int f6094_9(int x) { return x * 9; }
+inline int f6094_10(int x) { return x * 10; }
+inline int f6094_11(int x) { return x * 11; }
+inline int f6094_12(int x) { return x * 12; }
+inline int f6094_13(int x) { return x * 13; }
+inline int f6094_14(int x) { return x * 14; }
+inline int f6094_15(int x) { return x * 15; }
+inline int f6094_16(int x) { return x * 16; }
+inline int f6094_17(int x) { return x * 17; }
+inline int f6094_18(int x) { return x * 18; }
+inline int f6094_19(int x) { return x * 19; }
+inline int f6094_20(int x) { return x * 20; }
+inline int f6094_21(int x) { return x * 21; }
+inline int f6094_22(int x) { return x * 22; }
+inline int f6094_23(int x) { return x * 23; }
+inline int f6094_24(int x) { return x * 24; }
+inline int f6094_25(int x) { return x * 25; }
+inline int f6094_26(int x) { return x * 26; }
+inline int f6094_27(int x) { return x * 27; }
+inline int f6094_28(int x) { return x * 28; }
+inline int f6094_29(int x) { return x * 29; }
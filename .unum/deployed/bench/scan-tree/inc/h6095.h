@@ -0,0 +1,42 @@
+#pragma once
+/* header 6095 */
+#include <vector>
+#include "h3042.h"
+#include "h5761.h"
+#include "h715.h"
+#include "h1126.h"
+#include "h6670.h"
+#ifdef X
+#include "h8635.h"
+#endif
+struct S6095 { int a; const char *s = "x//y"; };
+inline int f6095_0(int x) { return x * 0; }
+inline int f6095_1(int x) { return x * 1; }
+inline int f6095_2(int x) { return x * 2; }
+inline int f6095_3(int x) { return x * 3; }
+inline int f6095_4(int x) { return x * 4; }
+inline int f6095_5(int x) { return x * 5; }
+inline int f6095_6(int x) { return x * 6; }
+inline int f6095_7(int x) { return x * 7; }
+inline int f6095_8(int x) { return x * 8; }
+inline int f6095_9(int x) { return x * 9; }
+inline int f6095_10(int x) { return x * 10; }
+inline int f6095_11(int x) { return x * 11; }
+inline int f6095_12(int x) { return x * 12; }
+inline int f6095_13(int x) { return x * 13; }
+inline int f6095_14(int x) { return x * 14; }
+inline int f6095_15(int x) { return x * 15; }
+inline int f6095_16(int x) { return x * 16; }
+inline int f6095_17(int x) { return x * 17; }
+inline int f6095_18(int x) { return x * 18; }
+inline int f6095_19(int x) { return x * 19; }
+inline int f6095_20(int x) { return x * 20; }
+inline int f6095_21(int x) { return x * 21; }
+inline int f6095_22(int x) { return x * 22; }
+inline int f6095_23(int x) { return x * 23; }
+inline int f6095_24(int x) { return x * 24; }
+inline int f6095_25(int x) { return x * 25; }
+inline int f6095_26(int x) { return x * 26; }
+inline int f6095_27(int x) { return x * 27; }
+inline int f6095_28(int x) { return x * 28; }
+inline int f6095_29(int x) { return x * 29; }
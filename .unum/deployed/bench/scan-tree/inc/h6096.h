@@ -0,0 +1,42 @@
+#pragma once
+/* header 6096 */
+#include <vector>
+#include "h8340.h"
+#include "h7684.h"
+#include "h2752.h"
+#include "h5427.h"
+#include "h4861.h"
+#ifdef X
+#include "h2845.h"
+#endif
+struct S6096 { int a; const char *s = "x//y"; };
+inline int f6096_0(int x) { return x * 0; }
+inline int f6096_1(int x) { return x * 1; }
+inline int f6096_2(int x) { return x * 2; }
+inline int f6096_3(int x) { return x * 3; }
+inline int f6096_4(int x) { return x * 4; }
+inline int f6096_5(int x) { return x * 5; }
+inline int f6096_6(int x) { return x * 6; }
+inline int f6096_7(int x) { return x * 7; }
+inline int f6096_8(int x) { return x * 8; }
+inline int f6096_9(int x) { return x * 9; }
+inline int f6096_10(int x) { return x * 10; }
+inline int f6096_11(int x) { return x * 11; }
+inline int f6096_12(int x) { return x * 12; }
+inline int f6096_13(int x) { return x * 13; }
+inline int f6096_14(int x) { return x * 14; }
+inline int f6096_15(int x) { return x * 15; }
+inline int f6096_16(int x) { return x * 16; }
+inline int f6096_17(int x) { return x * 17; }
+inline int f6096_18(int x) { return x * 18; }
+inline int f6096_19(int x) { return x * 19; }
+inline int f6096_20(int x) { return x * 20; }
+inline int f6096_21(int x) { return x * 21; }
+inline int f6096_22(int x) { return x * 22; }
+inline int f6096_23(int x) { return x * 23; }
+inline int f6096_24(int x) { return x * 24; }
+inline int f6096_25(int x) { return x * 25; }
+inline int f6096_26(int x) { return x * 26; }
+inline int f6096_27(int x) { return x * 27; }
+inline int f6096_28(int x) { return x * 28; }
+inline int f6096_29(int x) { return x * 29; }
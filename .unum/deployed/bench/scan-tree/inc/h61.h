@@ -0,0 +1,42 @@
+#pragma once
+/* header 61 */
+#include <vector>
+#include "h6147.h"
+#include "h4146.h"
+#include "h7588.h"
+#include "h6743.h"
+#include "h6840.h"
+#ifdef X
+#include "h9763.h"
+#endif
+struct S61 { int a; const char *s = "x//y"; };
+inline int f61_0(int x) { return x * 0; }
+inline int f61_1(int x) { return x * 1; }
+inline int f61_2(int x) { return x * 2; }
+inline int f61_3(int x) { return x * 3; }
+inline int f61_4(int x) { return x * 4; }
+inline int f61_5(int x) { return x * 5; }
+inline int f61_6(int x) { return x * 6; }
+inline int f61_7(int x) { return x * 7; }
+inline int f61_8(int x) { return x * 8; }
+inline int f61_9(int x) { return x * 9; }
+inline int f61_10(int x) { return x * 10; }
+inline int f61_11(int x) { return x * 11; }
+inline int f61_12(int x) { return x * 12; }
+inline int f61_13(int x) { return x * 13; }
+inline int f61_14(int x) { return x * 14; }
+inline int f61_15(int x) { return x * 15; }
+inline int f61_16(int x) { return x * 16; }
+inline int f61_17(int x) { return x * 17; }
+inline int f61_18(int x) { return x * 18; }
+inline int f61_19(int x) { return x * 19; }
+inline int f61_20(int x) { return x * 20; }
+inline int f61_21(int x) { return x * 21; }
+inline int f61_22(int x) { return x * 22; }
+inline int f61_23(int x) { return x * 23; }
+inline int f61_24(int x) { return x * 24; }
+inline int f61_25(int x) { return x * 25; }
+inline int f61_26(int x) { return x * 26; }
+inline int f61_27(int x) { return x * 27; }
+inline int f61_28(int x) { return x * 28; }
+inline int f61_29(int x) { return x * 29; }
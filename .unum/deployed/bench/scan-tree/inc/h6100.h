@@ -0,0 +1,42 @@
+#pragma once
+/* header 6100 */
+#include <vector>
+#include "h6068.h"
+#include "h8704.h"
+#include "h7370.h"
+#include "h6285.h"
+#include "h3651.h"
+#ifdef X
+#include "h7857.h"
+#endif
+struct S6100 { int a; const char *s = "x//y"; };
+inline int f6100_0(int x) { return x * 0; }
+inline int f6100_1(int x) { return x * 1; }
+inline int f6100_2(int x) { return x * 2; }
+inline int f6100_3(int x) { return x * 3; }
+inline int f6100_4(int x) { return x * 4; }
+inline int f6100_5(int x) { return x * 5; }
+inline int f6100_6(int x) { return x * 6; }
+inline int f6100_7(int x) { return x * 7; }
+inline int f6100_8(int x) { return x * 8; }
+inline int f6100_9(int x) { return x * 9; }
+inline int f6100_10(int x) { return x * 10; }
+inline int f6100_11(int x) { return x * 11; }
+inline int f6100_12(int x) { return x * 12; }
+inline int f6100_13(int x) { return x * 13; }
+inline int f6100_14(int x) { return x * 14; }
+inline int f6100_15(int x) { return x * 15; }
+inline int f6100_16(int x) { return x * 16; }
+inline int f6100_17(int x) { return x * 17; }
+inline int f6100_18(int x) { return x * 18; }
+inline int f6100_19(int x) { return x * 19; }
+inline int f6100_20(int x) { return x * 20; }
+inline int f6100_21(int x) { return x * 21; }
+inline int f6100_22(int x) { return x * 22; }
+inline int f6100_23(int x) { return x * 23; }
+inline int f6100_24(int x) { return x * 24; }
+inline int f6100_25(int x) { return x * 25; }
+inline int f6100_26(int x) { return x * 26; }
+inline int f6100_27(int x) { return x * 27; }
+inline int f6100_28(int x) { return x * 28; }
+inline int f6100_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6102 */
+#include <vector>
+#include "h4438.h"
+#include "h9110.h"
+#include "h4167.h"
+#include "h6921.h"
+#include "h983.h"
+#ifdef X
+#include "h2629.h"
+#endif
+struct S6102 { int a; const char *s = "x//y"; };
+inline int f6102_0(int x) { return x * 0; }
+inline int f6102_1(int x) { return x * 1; }
+inline int f6102_2(int x) { return x * 2; }
+inline int f6102_3(int x) { return x * 3; }
+inline int f6102_4(int x) { return x * 4; }
+inline int f6102_5(int x) { return x * 5; }
+inline int f6102_6(int x) { return x * 6; }
+inline int f6102_7(int x) { return x * 7; }
+inline int f6102_8(int x) { return x * 8; }
+inline int f6102_9(int x) { return x * 9; }
+inline int f6102_10(int x) { return x * 10; }
+inline int f6102_11(int x) { return x * 11; }
+inline int f6102_12(int x) { return x * 12; }
+inline int f6102_13(int x) { return x * 13; }
+inline int f6102_14(int x) { return x * 14; }
+inline int f6102_15(int x) { return x * 15; }
+inline int f6102_16(int x) { return x * 16; }
+inline int f6102_17(int x) { return x * 17; }
+inline int f6102_18(int x) { return x * 18; }
+inline int f6102_19(int x) { return x * 19; }
+inline int f6102_20(int x) { return x * 20; }
+inline int f6102_21(int x) { return x * 21; }
+inline int f6102_22(int x) { return x * 22; }
+inline int f6102_23(int x) { return x * 23; }
+inline int f6102_24(int x) { return x * 24; }
+inline int f6102_25(int x) { return x * 25; }
+inline int f6102_26(int x) { return x * 26; }
+inline int f6102_27(int x) { return x * 27; }
+inline int f6102_28(int x) { return x * 28; }
+inline int f6102_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6103 */
+#include <vector>
+#include "h2616.h"
+#include "h2500.h"
+#include "h823.h"
+#include "h4269.h"
+#include "h645.h"
+#ifdef X
+#include "h3785.h"
+#endif
+struct S6103 { int a; const char *s = "x//y"; };
+inline int f6103_0(int x) { return x * 0; }
+inline int f6103_1(int x) { return x * 1; }
+inline int f6103_2(int x) { return x * 2; }
+inline int f6103_3(int x) { return x * 3; }
+inline int f6103_4(int x) { return x * 4; }
+inline int f6103_5(int x) { return x * 5; }
+inline int f6103_6(int x) { return x * 6; }
+inline int f6103_7(int x) { return x * 7; }
+inline int f6103_8(int x) { return x * 8; }
+inline int f6103_9(int x) { return x * 9; }
+inline int f6103_10(int x) { return x * 10; }
+inline int f6103_11(int x) { return x * 11; }
+inline int f6103_12(int x) { return x * 12; }
+inline int f6103_13(int x) { return x * 13; }
+inline int f6103_14(int x) { return x * 14; }
+inline int f6103_15(int x) { return x * 15; }
+inline int f6103_16(int x) { return x * 16; }
+inline int f6103_17(int x) { return x * 17; }
+inline int f6103_18(int x) { return x * 18; }
+inline int f6103_19(int x) { return x * 19; }
+inline int f6103_20(int x) { return x * 20; }
+inline int f6103_21(int x) { return x * 21; }
+inline int f6103_22(int x) { return x * 22; }
+inline int f6103_23(int x) { return x * 23; }
+inline int f6103_24(int x) { return x * 24; }
+inline int f6103_25(int x) { return x * 25; }
+inline int f6103_26(int x) { return x * 26; }
+inline int f6103_27(int x) { return x * 27; }
+inline int f6103_28(int x) { return x * 28; }
+inline int f6103_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6107 */
+#include <vector>
+#include "h4593.h"
+#include "h377.h"
+#include "h9565.h"
+#include "h5071.h"
+#include "h6577.h"
+#ifdef X
+#include "h2131.h"
+#endif
+struct S6107 { int a; const char *s = "x//y"; };
+inline int f6107_0(int x) { return x * 0; }
+inline int f6107_1(int x) { return x * 1; }
+inline int f6107_2(int x) { return x * 2; }
+inline int f6107_3(int x) { return x * 3; }
+inline int f6107_4(int x) { return x * 4; }
+inline int f6107_5(int x) { return x * 5; }
+inline int f6107_6(int x) { return x * 6; }
+inline int f6107_7(int x) { return x * 7; }
+inline int f6107_8(int x) { return x * 8; }
+inline int f6107_9(int x) { return x * 9; }
+inline int f6107_10(int x) { return x * 10; }
+inline int f6107_11(int x) { return x * 11; }
+inline int f6107_12(int x) { return x * 12; }
+inline int f6107_13(int x) { return x * 13; }
+inline int f6107_14(int x) { return x * 14; }
+inline int f6107_15(int x) { return x * 15; }
+inline int f6107_16(int x) { return x * 16; }
+inline int f6107_17(int x) { return x * 17; }
+inline int f6107_18(int x) { return x * 18; }
+inline int f6107_19(int x) { return x * 19; }
+inline int f6107_20(int x) { return x * 20; }
+inline int f6107_21(int x) { return x * 21; }
+inline int f6107_22(int x) { return x * 22; }
+inline int f6107_23(int x) { return x * 23; }
+inline int f6107_24(int x) { return x * 24; }
+inline int f6107_25(int x) { return x * 25; }
+inline int f6107_26(int x) { return x * 26; }
+inline int f6107_27(int x) { return x * 27; }
+inline int f6107_28(int x) { return x * 28; }
+inline int f6107_29(int x) { return x * 29; }
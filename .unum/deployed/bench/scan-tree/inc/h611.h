@@ -0,0 +1,42 @@
+#pragma once
+/* header 611 */
+#include <vector>
+#include "h7326.h"
+#include "h3058.h"
+#include "h3415.h"
+#include "h4090.h"
+#include "h9908.h"
+#ifdef X
+#include "h8135.h"
+#endif
+struct S611 { int a; const char *s = "x//y"; };
+inline int f611_0(int x) { return x * 0; }
+inline int f611_1(int x) { return x * 1; }
+inline int f611_2(int x) { return x * 2; }
+inline int f611_3(int x) { return x * 3; }
+inline int f611_4(int x) { return x * 4; }
+inline int f611_5(int x) { return x * 5; }
+inline int f611_6(int x) { return x * 6; }
+inline int f611_7(int x) { return x * 7; }
+inline int f611_8(int x) { return x * 8; }
+inline int f611_9(int x) { return x * 9; }
+inline int f611_10(int x) { return x * 10; }
+inline int f611_11(int x) { return x * 11; }
+inline int f611_12(int x) { return x * 12; }
+inline int f611_13(int x) { return x * 13; }
+inline int f611_14(int x) { return x * 14; }
+inline int f611_15(int x) { return x * 15; }
+inline int f611_16(int x) { return x * 16; }
+inline int f611_17(int x) { return x * 17; }
+inline int f611_18(int x) { return x * 18; }
+inline int f611_19(int x) { return x * 19; }
+inline int f611_20(int x) { return x * 20; }
+inline int f611_21(int x) { return x * 21; }
+inline int f611_22(int x) { return x * 22; }
+inline int f611_23(int x) { return x * 23; }
+inline int f611_24(int x) { return x * 24; }
+inline int f611_25(int x) { return x * 25; }
+inline int f611_26(int x) { return x * 26; }
+inline int f611_27(int x) { return x * 27; }
+inline int f611_28(int x) { return x * 28; }
+inline int f611_29(int x) { return x * 29; }
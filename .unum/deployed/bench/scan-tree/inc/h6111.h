@@ -0,0 +1,42 @@
+#pragma once
+/* header 6111 */
+#include <vector>
+#include "h9084.h"
+#include "h8481.h"
+#include "h1045.h"
+#include "h2142.h"
+#include "h7232.h"
+#ifdef X
+#include "h8361.h"
+#endif
+struct S6111 { int a; const char *s = "x//y"; };
+inline int f6111_0(int x) { return x * 0; }
+inline int f6111_1(int x) { return x * 1; }
+inline int f6111_2(int x) { return x * 2; }
+inline int f6111_3(int x) { return x * 3; }
+inline int f6111_4(int x) { return x * 4; }
+inline int f6111_5(int x) { return x * 5; }
+inline int f6111_6(int x) { return x * 6; }
+inline int f6111_7(int x) { return x * 7; }
+inline int f6111_8(int x) { return x * 8; }
+inline int f6111_9(int x) { return x * 9; }
+inline int f6111_10(int x) { return x * 10; }
+inline int f6111_11(int x) { return x * 11; }
+inline int f6111_12(int x) { return x * 12; }
+inline int f6111_13(int x) { return x * 13; }
+inline int f6111_14(int x) { return x * 14; }
+inline int f6111_15(int x) { return x * 15; }
+inline int f6111_16(int x) { return x * 16; }
+inline int f6111_17(int x) { return x * 17; }
+inline int f6111_18(int x) { return x * 18; }
+inline int f6111_19(int x) { return x * 19; }
+inline int f6111_20(int x) { return x * 20; }
+inline int f6111_21(int x) { return x * 21; }
+inline int f6111_22(int x) { return x * 22; }
+inline int f6111_23(int x) { return x * 23; }
+inline int f6111_24(int x) { return x * 24; }
+inline int f6111_25(int x) { return x * 25; }
+inline int f6111_26(int x) { return x * 26; }
+inline int f6111_27(int x) { return x * 27; }
+inline int f6111_28(int x) { return x * 28; }
+inline int f6111_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6119 */
+#include <vector>
+#include "h9118.h"
+#include "h9847.h"
+#include "h1570.h"
+#include "h4563.h"
+#include "h3429.h"
+#ifdef X
+#include "h6191.h"
+#endif
+struct S6119 { int a; const char *s = "x//y"; };
+inline int f6119_0(int x) { return x * 0; }
+inline int f6119_1(int x) { return x * 1; }
+inline int f6119_2(int x) { return x * 2; }
+inline int f6119_3(int x) { return x * 3; }
+inline int f6119_4(int x) { return x * 4; }
+inline int f6119_5(int x) { return x * 5; }
+inline int f6119_6(int x) { return x * 6; }
+inline int f6119_7(int x) { return x * 7; }
+inline int f6119_8(int x) { return x * 8; }
+inline int f6119_9(int x) { return x * 9; }
+inline int f6119_10(int x) { return x * 10; }
+inline int f6119_11(int x) { return x * 11; }
+inline int f6119_12(int x) { return x * 12; }
+inline int f6119_13(int x) { return x * 13; }
+inline int f6119_14(int x) { return x * 14; }
+inline int f6119_15(int x) { return x * 15; }
+inline int f6119_16(int x) { return x * 16; }
+inline int f6119_17(int x) { return x * 17; }
+inline int f6119_18(int x) { return x * 18; }
+inline int f6119_19(int x) { return x * 19; }
+inline int f6119_20(int x) { return x * 20; }
+inline int f6119_21(int x) { return x * 21; }
+inline int f6119_22(int x) { return x * 22; }
+inline int f6119_23(int x) { return x * 23; }
+inline int f6119_24(int x) { return x * 24; }
+inline int f6119_25(int x) { return x * 25; }
+inline int f6119_26(int x) { return x * 26; }
+inline int f6119_27(int x) { return x * 27; }
+inline int f6119_28(int x) { return x * 28; }
+inline int f6119_29(int x) { return x * 29; }
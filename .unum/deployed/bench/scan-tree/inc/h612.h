@@ -0,0 +1,42 @@
+#pragma once
+/* header 612 */
+#include <vector>
+#include "h353.h"
+#include "h5447.h"
+#include "h5755.h"
+#include "h8578.h"
+#include "h9583.h"
+#ifdef X
+#include "h7538.h"
+#endif
+struct S612 { int a; const char *s = "x//y"; };
+inline int f612_0(int x) { return x * 0; }
+inline int f612_1(int x) { return x * 1; }
+inline int f612_2(int x) { return x * 2; }
+inline int f612_3(int x) { return x * 3; }
+inline int f612_4(int x) { return x * 4; }
+inline int f612_5(int x) { return x * 5; }
+inline int f612_6(int x) { return x * 6; }
+inline int f612_7(int x) { return x * 7; }
+inline int f612_8(int x) { return x * 8; }
+inline int f612_9(int x) { return x * 9; }
+inline int f612_10(int x) { return x * 10; }
+inline int f612_11(int x) { return x * 11; }
+inline int f612_12(int x) { return x * 12; }
+inline int f612_13(int x) { return x * 13; }
+inline int f612_14(int x) { return x * 14; }
+inline int f612_15(int x) { return x * 15; }
+inline int f612_16(int x) { return x * 16; }
+inline int f612_17(int x) { return x * 17; }
+inline int f612_18(int x) { return x * 18; }
+inline int f612_19(int x) { return x * 19; }
+inline int f612_20(int x) { return x * 20; }
+inline int f612_21(int x) { return x * 21; }
+inline int f612_22(int x) { return x * 22; }
+inline int f612_23(int x) { return x * 23; }
+inline int f612_24(int x) { return x * 24; }
+inline int f612_25(int x) { return x * 25; }
+inline int f612_26(int x) { return x * 26; }
+inline int f612_27(int x) { return x * 27; }
+inline int f612_28(int x) { return x * 28; }
+inline int f612_29(int x) { return x * 29; }
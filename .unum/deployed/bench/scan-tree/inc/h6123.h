@@ -0,0 +1,42 @@
+#pragma once
+/* header 6123 */
+#include <vector>
+#include "h8808.h"
+#include "h1784.h"
+#include "h3528.h"
+#include "h956.h"
+#include "h6547.h"
+#ifdef X
+#include "h9471.h"
+#endif
+struct S6123 { int a; const char *s = "x//y"; };
+inline int f6123_0(int x) { return x * 0; }
+inline int f6123_1(int x) { return x * 1; }
+inline int f6123_2(int x) { return x * 2; }
+inline int f6123_3(int x) { return x * 3; }
+inline int f6123_4(int x) { return x * 4; }
+inline int f6123_5(int x) { return x * 5; }
+inline int f6123_6(int x) { return x * 6; }
+inline int f6123_7(int x) { return x * 7; }
+inline int f6123_8(int x) { return x * 8; }
+inline int f6123_9(int x) { return x * 9; }
+inline int f6123_10(int x) { return x * 10; }
+inline int f6123_11(int x) { return x * 11; }
+inline int f6123_12(int x) { return x * 12; }
+inline int f6123_13(int x) { return x * 13; }
+inline int f6123_14(int x) { return x * 14; }
+inline int f6123_15(int x) { return x * 15; }
+inline int f6123_16(int x) { return x * 16; }
+inline int f6123_17(int x) { return x * 17; }
+inline int f6123_18(int x) { return x * 18; }
+inline int f6123_19(int x) { return x * 19; }
+inline int f6123_20(int x) { return x * 20; }
+inline int f6123_21(int x) { return x * 21; }
+inline int f6123_22(int x) { return x * 22; }
+inline int f6123_23(int x) { return x * 23; }
+inline int f6123_24(int x) { return x * 24; }
+inline int f6123_25(int x) { return x * 25; }
+inline int f6123_26(int x) { return x * 26; }
+inline int f6123_27(int x) { return x * 27; }
+inline int f6123_28(int x) { return x * 28; }
+inline int f6123_29(int x) { return x * 29; }
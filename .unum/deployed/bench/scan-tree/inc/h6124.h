@@ -0,0 +1,42 @@
+#pragma once
+/* header 6124 */
+#include <vector>
+#include "h2972.h"
+#include "h7872.h"
+#include "h9996.h"
+#include "h3552.h"
+#include "h3401.h"
+#ifdef X
+#include "h5958.h"
+#endif
+struct S6124 { int a; const char *s = "x//y"; };
+inline int f6124_0(int x) { return x * 0; }
+inline int f6124_1(int x) { return x * 1; }
+inline int f6124_2(int x) { return x * 2; }
+inline int f6124_3(int x) { return x * 3; }
+inline int f6124_4(int x) { return x * 4; }
+inline int f6124_5(int x) { return x * 5; }
+inline int f6124_6(int x) { return x * 6; }
+inline int f6124_7(int x) { return x * 7; }
+inline int f6124_8(int x) { return x * 8; }
+inline int f6124_9(int x) { return x * 9; }
+inline int f6124_10(int x) { return x * 10; }
+inline int f6124_11(int x) { return x * 11; }
+inline int f6124_12(int x) { return x * 12; }
+inline int f6124_13(int x) { return x * 13; }
+inline int f6124_14(int x) { return x * 14; }
+inline int f6124_15(int x) { return x * 15; }
+inline int f6124_16(int x) { return x * 16; }
+inline int f6124_17(int x) { return x * 17; }
+inline int f6124_18(int x) { return x * 18; }
+inline int f6124_19(int x) { return x * 19; }
+inline int f6124_20(int x) { return x * 20; }
+inline int f6124_21(int x) { return x * 21; }
+inline int f6124_22(int x) { return x * 22; }
+inline int f6124_23(int x) { return x * 23; }
+inline int f6124_24(int x) { return x * 24; }
+inline int f6124_25(int x) { return x * 25; }
+inline int f6124_26(int x) { return x * 26; }
+inline int f6124_27(int x) { return x * 27; }
+inline int f6124_28(int x) { return x * 28; }
+inline int f6124_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6125 */
+#include <vector>
+#include "h4499.h"
+#include "h5511.h"
+#include "h4418.h"
+#include "h7892.h"
+#include "h9861.h"
+#ifdef X
+#include "h8145.h"
+#endif
+struct S6125 { int a; const char *s = "x//y"; };
+inline int f6125_0(int x) { return x * 0; }
+inline int f6125_1(int x) { return x * 1; }
+inline int f6125_2(int x) { return x * 2; }
+inline int f6125_3(int x) { return x * 3; }
+inline int f6125_4(int x) { return x * 4; }
+inline int f6125_5(int x) { return x * 5; }
+inline int f6125_6(int x) { return x * 6; }
+inline int f6125_7(int x) { return x * 7; }
+inline int f6125_8(int x) { return x * 8; }
+inline int f6125_9(int x) { return x * 9; }
+inline int f6125_10(int x) { return x * 10; }
+inline int f6125_11(int x) { return x * 11; }
+inline int f6125_12(int x) { return x * 12; }
+inline int f6125_13(int x) { return x * 13; }
+inline int f6125_14(int x) { return x * 14; }
+inline int f6125_15(int x) { return x * 15; }
+inline int f6125_16(int x) { return x * 16; }
+inline int f6125_17(int x) { return x * 17; }
+inline int f6125_18(int x) { return x * 18; }
+inline int f6125_19(int x) { return x * 19; }
+inline int f6125_20(int x) { return x * 20; }
+inline int f6125_21(int x) { return x * 21; }
+inline int f6125_22(int x) { return x * 22; }
+inline int f6125_23(int x) { return x * 23; }
+inline int f6125_24(int x) { return x * 24; }
+inline int f6125_25(int x) { return x * 25; }
+inline int f6125_26(int x) { return x * 26; }
+inline int f6125_27(int x) { return x * 27; }
+inline int f6125_28(int x) { return x * 28; }
+inline int f6125_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6126 */
+#include <vector>
+#include "h1839.h"
+#include "h9795.h"
+#include "h6294.h"
+#include "h1007.h"
+#include "h8876.h"
+#ifdef X
+#include "h1654.h"
+#endif
+struct S6126 { int a; const char *s = "x//y"; };
+inline int f6126_0(int x) { return x * 0; }
+inline int f6126_1(int x) { return x * 1; }
+inline int f6126_2(int x) { return x * 2; }
+inline int f6126_3(int x) { return x * 3; }
+inline int f6126_4(int x) { return x * 4; }
+inline int f6126_5(int x) { return x * 5; }
+inline int f6126_6(int x) { return x * 6; }
+inline int f6126_7(int x) { return x * 7; }
+inline int f6126_8(int x) { return x * 8; }
+inline int f6126_9(int x) { return x * 9; }
+inline int f6126_10(int x) { return x * 10; }
+inline int f6126_11(int x) { return x * 11; }
+inline int f6126_12(int x) { return x * 12; }
+inline int f6126_13(int x) { return x * 13; }
+inline int f6126_14(int x) { return x * 14; }
+inline int f6126_15(int x) { return x * 15; }
+inline int f6126_16(int x) { return x * 16; }
+inline int f6126_17(int x) { return x * 17; }
+inline int f6126_18(int x) { return x * 18; }
+inline int f6126_19(int x) { return x * 19; }
+inline int f6126_20(int x) { return x * 20; }
+inline int f6126_21(int x) { return x * 21; }
+inline int f6126_22(int x) { return x * 22; }
+inline int f6126_23(int x) { return x * 23; }
+inline int f6126_24(int x) { return x * 24; }
+inline int f6126_25(int x) { return x * 25; }
+inline int f6126_26(int x) { return x * 26; }
+inline int f6126_27(int x) { return x * 27; }
+inline int f6126_28(int x) { return x * 28; }
+inline int f6126_29(int x) { return x * 29; }
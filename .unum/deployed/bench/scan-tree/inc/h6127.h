@@ -0,0 +1,42 @@
+#pragma once
+/* header 6127 */
+#include <vector>
+#include "h6873.h"
+#include "h6385.h"
+#include "h1367.h"
+#include "h8931.h"
+#include "h8512.h"
+#ifdef X
+#include "h9139.h"
+#endif
+struct S6127 { int a; const char *s = "x//y"; };
+inline int f6127_0(int x) { return x * 0; }
+inline int f6127_1(int x) { return x * 1; }
+inline int f6127_2(int x) { return x * 2; }
+inline int f6127_3(int x) { return x * 3; }
+inline int f6127_4(int x) { return x * 4; }
+inline int f6127_5(int x) { return x * 5; }
+inline int f6127_6(int x) { return x * 6; }
+inline int f6127_7(int x) { return x * 7; }
+inline int f6127_8(int x) { return x * 8; }
+inline int f6127_9(int x) { return x * 9; }
+inline int f6127_10(int x) { return x * 10; }
+inline int f6127_11(int x) { return x * 11; }
+inline int f6127_12(int x) { return x * 12; }
+inline int f6127_13(int x) { return x * 13; }
+inline int f6127_14(int x) { return x * 14; }
+inline int f6127_15(int x) { return x * 15; }
+inline int f6127_16(int x) { return x * 16; }
+inline int f6127_17(int x) { return x * 17; }
+inline int f6127_18(int x) { return x * 18; }
+inline int f6127_19(int x) { return x * 19; }
+inline int f6127_20(int x) { return x * 20; }
+inline int f6127_21(int x) { return x * 21; }
+inline int f6127_22(int x) { return x * 22; }
+inline int f6127_23(int x) { return x * 23; }
+inline int f6127_24(int x) { return x * 24; }
+inline int f6127_25(int x) { return x * 25; }
+inline int f6127_26(int x) { return x * 26; }
+inline int f6127_27(int x) { return x * 27; }
+inline int f6127_28(int x) { return x * 28; }
+inline int f6127_29(int x) { return x * 29; }
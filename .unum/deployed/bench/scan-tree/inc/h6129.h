@@ -0,0 +1,42 @@
+#pragma once
+/* header 6129 */
+#include <vector>
+#include "h3378.h"
+#include "h270.h"
+#include "h3028.h"
+#include "h2931.h"
+#include "h2863.h"
+#ifdef X
+#include "h9442.h"
+#endif
+struct S6129 { int a; const char *s = "x//y"; };
+inline int f6129_0(int x) { return x * 0; }
+inline int f6129_1(int x) { return x * 1; }
+inline int f6129_2(int x) { return x * 2; }
+inline int f6129_3(int x) { return x * 3; }
+inline int f6129_4(int x) { return x * 4; }
+inline int f6129_5(int x) { return x * 5; }
+inline int f6129_6(int x) { return x * 6; }
+inline int f6129_7(int x) { return x * 7; }
+inline int f6129_8(int x) { return x * 8; }
+inline int f6129_9(int x) { return x * 9; }
+inline int f6129_10(int x) { return x * 10; }
+inline int f6129_11(int x) { return x * 11; }
+inline int f6129_12(int x) { return x * 12; }
+inline int f6129_13(int x) { return x * 13; }
+inline int f6129_14(int x) { return x * 14; }
+inline int f6129_15(int x) { return x * 15; }
+inline int f6129_16(int x) { return x * 16; }
+inline int f6129_17(int x) { return x * 17; }
+inline int f6129_18(int x) { return x * 18; }
+inline int f6129_19(int x) { return x * 19; }
+inline int f6129_20(int x) { return x * 20; }
+inline int f6129_21(int x) { return x * 21; }
+inline int f6129_22(int x) { return x * 22; }
+inline int f6129_23(int x) { return x * 23; }
+inline int f6129_24(int x) { return x * 24; }
+inline int f6129_25(int x) { return x * 25; }
+inline int f6129_26(int x) { return x * 26; }
+inline int f6129_27(int x) { return x * 27; }
+inline int f6129_28(int x) { return x * 28; }
+inline int f6129_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 613 */
+#include <vector>
+#include "h9400.h"
+#include "h3068.h"
+#include "h4835.h"
+#include "h9688.h"
+#include "h5766.h"
+#ifdef X
+#include "h3172.h"
+#endif
+struct S613 { int a; const char *s = "x//y"; };
+inline int f613_0(int x) { return x * 0; }
+inline int f613_1(int x) { return x * 1; }
+inline int f613_2(int x) { return x * 2; }
+inline int f613_3(int x) { return x * 3; }
+inline int f613_4(int x) { return x * 4; }
+inline int f613_5(int x) { return x * 5; }
+inline int f613_6(int x) { return x * 6; }
+inline int f613_7(int x) { return x * 7; }
+inline int f613_8(int x) { return x * 8; }
+inline int f613_9(int x) { return x * 9; }
+inline int f613_10(int x) { return x * 10; }
+inline int f613_11(int x) { return x * 11; }
+inline int f613_12(int x) { return x * 12; }
+inline int f613_13(int x) { return x * 13; }
+inline int f613_14(int x) { return x * 14; }
+inline int f613_15(int x) { return x * 15; }
+inline int f613_16(int x) { return x * 16; }
+inline int f613_17(int x) { return x * 17; }
+inline int f613_18(int x) { return x * 18; }
+inline int f613_19(int x) { return x * 19; }
+inline int f613_20(int x) { return x * 20; }
+inline int f613_21(int x) { return x * 21; }
+inline int f613_22(int x) { return x * 22; }
+inline int f613_23(int x) { return x * 23; }
+inline int f613_24(int x) { return x * 24; }
+inline int f613_25(int x) { return x * 25; }
+inline int f613_26(int x) { return x * 26; }
+inline int f613_27(int x) { return x * 27; }
+inline int f613_28(int x) { return x * 28; }
+inline int f613_29(int x) { return x * 29; }
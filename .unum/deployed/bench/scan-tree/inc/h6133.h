@@ -0,0 +1,42 @@
+#pragma once
+/* header 6133 */
+#include <vector>
+#include "h2747.h"
+#include "h3467.h"
+#include "h3925.h"
+#include "h1032.h"
+#include "h3647.h"
+#ifdef X
+#include "h5279.h"
+#endif
+struct S6133 { int a; const char *s = "x//y"; };
+inline int f6133_0(int x) { return x * 0; }
+inline int f6133_1(int x) { return x * 1; }
+inline int f6133_2(int x) { return x * 2; }
+inline int f6133_3(int x) { return x * 3; }
+inline int f6133_4(int x) { return x * 4; }
+inline int f6133_5(int x) { return x * 5; }
+inline int f6133_6(int x) { return x * 6; }
+inline int f6133_7(int x) { return x * 7; }
+inline int f6133_8(int x) { return x * 8; }
+inline int f6133_9(int x) { return x * 9; }
+inline int f6133_10(int x) { return x * 10; }
+inline int f6133_11(int x) { return x * 11; }
+inline int f6133_12(int x) { return x * 12; }
+inline int f6133_13(int x) { return x * 13; }
+inline int f6133_14(int x) { return x * 14; }
+inline int f6133_15(int x) { return x * 15; }
+inline int f6133_16(int x) { return x * 16; }
+inline int f6133_17(int x) { return x * 17; }
+inline int f6133_18(int x) { return x * 18; }
+inline int f6133_19(int x) { return x * 19; }
+inline int f6133_20(int x) { return x * 20; }
+inline int f6133_21(int x) { return x * 21; }
+inline int f6133_22(int x) { return x * 22; }
+inline int f6133_23(int x) { return x * 23; }
+inline int f6133_24(int x) { return x * 24; }
+inline int f6133_25(int x) { return x * 25; }
+inline int f6133_26(int x) { return x * 26; }
+inline int f6133_27(int x) { return x * 27; }
+inline int f6133_28(int x) { return x * 28; }
+inline int f6133_29(int x) { return x * 29; }
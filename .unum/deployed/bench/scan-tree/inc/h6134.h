@@ -0,0 +1,42 @@
+#pragma once
+/* header 6134 */
+#include <vector>
+#include "h2988.h"
+#include "h1172.h"
+#include "h4865.h"
+#include "h835.h"
+#include "h8562.h"
+#ifdef X
+#include "h8534.h"
+#endif
+struct S6134 { int a; const char *s = "x//y"; };
+inline int f6134_0(int x) { return x * 0; }
+inline int f6134_1(int x) { return x * 1; }
+inline int f6134_2(int x) { return x * 2; }
+inline int f6134_3(int x) { return x * 3; }
+inline int f6134_4(int x) { return x * 4; }
+inline int f6134_5(int x) { return x * 5; }
+inline int f6134_6(int x) { return x * 6; }
+inline int f6134_7(int x) { return x * 7; }
+inline int f6134_8(int x) { return x * 8; }
+inline int f6134_9(int x) { return x * 9; }
+inline int f6134_10(int x) { return x * 10; }
+inline int f6134_11(int x) { return x * 11; }
+inline int f6134_12(int x) { return x * 12; }
+inline int f6134_13(int x) { return x * 13; }
+inline int f6134_14(int x) { return x * 14; }
+inline int f6134_15(int x) { return x * 15; }
+inline int f6134_16(int x) { return x * 16; }
+inline int f6134_17(int x) { return x * 17; }
+inline int f6134_18(int x) { return x * 18; }
+inline int f6134_19(int x) { return x * 19; }
+inline int f6134_20(int x) { return x * 20; }
+inline int f6134_21(int x) { return x * 21; }
+inline int f6134_22(int x) { return x * 22; }
+inline int f6134_23(int x) { return x * 23; }
+inline int f6134_24(int x) { return x * 24; }
+inline int f6134_25(int x) { return x * 25; }
+inline int f6134_26(int x) { return x * 26; }
+inline int f6134_27(int x) { return x * 27; }
+inline int f6134_28(int x) { return x * 28; }
+inline int f6134_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6138 */
+#include <vector>
+#include "h5755.h"
+#include "h3436.h"
+#include "h8923.h"
+#include "h827.h"
+#include "h9214.h"
+#ifdef X
+#include "h7019.h"
+#endif
+struct S6138 { int a; const char *s = "x//y"; };
+inline int f6138_0(int x) { return x * 0; }
+inline int f6138_1(int x) { return x * 1; }
+inline int f6138_2(int x) { return x * 2; }
+inline int f6138_3(int x) { return x * 3; }
+inline int f6138_4(int x) { return x * 4; }
+inline int f6138_5(int x) { return x * 5; }
+inline int f6138_6(int x) { return x * 6; }
+inline int f6138_7(int x) { return x * 7; }
+inline int f6138_8(int x) { return x * 8; }
+inline int f6138_9(int x) { return x * 9; }
+inline int f6138_10(int x) { return x * 10; }
+inline int f6138_11(int x) { return x * 11; }
+inline int f6138_12(int x) { return x * 12; }
+inline int f6138_13(int x) { return x * 13; }
+inline int f6138_14(int x) { return x * 14; }
+inline int f6138_15(int x) { return x * 15; }
+inline int f6138_16(int x) { return x * 16; }
+inline int f6138_17(int x) { return x * 17; }
+inline int f6138_18(int x) { return x * 18; }
+inline int f6138_19(int x) { return x * 19; }
+inline int f6138_20(int x) { return x * 20; }
+inline int f6138_21(int x) { return x * 21; }
+inline int f6138_22(int x) { return x * 22; }
+inline int f6138_23(int x) { return x * 23; }
+inline int f6138_24(int x) { return x * 24; }
+inline int f6138_25(int x) { return x * 25; }
+inline int f6138_26(int x) { return x * 26; }
+inline int f6138_27(int x) { return x * 27; }
+inline int f6138_28(int x) { return x * 28; }
+inline int f6138_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6143 */
+#include <vector>
+#include "h7188.h"
+#include "h5529.h"
+#include "h6188.h"
+#include "h3830.h"
+#include "h6990.h"
+#ifdef X
+#include "h8238.h"
+#endif
+struct S6143 { int a; const char *s = "x//y"; };
+inline int f6143_0(int x) { return x * 0; }
+inline int f6143_1(int x) { return x * 1; }
+inline int f6143_2(int x) { return x * 2; }
+inline int f6143_3(int x) { return x * 3; }
+inline int f6143_4(int x) { return x * 4; }
+inline int f6143_5(int x) { return x * 5; }
+inline int f6143_6(int x) { return x * 6; }
+inline int f6143_7(int x) { return x * 7; }
+inline int f6143_8(int x) { return x * 8; }
+inline int f6143_9(int x) { return x * 9; }
+inline int f6143_10(int x) { return x * 10; }
+inline int f6143_11(int x) { return x * 11; }
+inline int f6143_12(int x) { return x * 12; }
+inline int f6143_13(int x) { return x * 13; }
+inline int f6143_14(int x) { return x * 14; }
+inline int f6143_15(int x) { return x * 15; }
+inline int f6143_16(int x) { return x * 16; }
+inline int f6143_17(int x) { return x * 17; }
+inline int f6143_18(int x) { return x * 18; }
+inline int f6143_19(int x) { return x * 19; }
+inline int f6143_20(int x) { return x * 20; }
+inline int f6143_21(int x) { return x * 21; }
+inline int f6143_22(int x) { return x * 22; }
+inline int f6143_23(int x) { return x * 23; }
+inline int f6143_24(int x) { return x * 24; }
+inline int f6143_25(int x) { return x * 25; }
+inline int f6143_26(int x) { return x * 26; }
+inline int f6143_27(int x) { return x * 27; }
+inline int f6143_28(int x) { return x * 28; }
+inline int f6143_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6145 */
+#include <vector>
+#include "h2570.h"
+#include "h5202.h"
+#include "h2571.h"
+#include "h1227.h"
+#include "h9061.h"
+#ifdef X
+#include "h5448.h"
+#endif
+struct S6145 { int a; const char *s = "x//y"; };
+inline int f6145_0(int x) { return x * 0; }
+inline int f6145_1(int x) { return x * 1; }
+inline int f6145_2(int x) { return x * 2; }
+inline int f6145_3(int x) { return x * 3; }
+inline int f6145_4(int x) { return x * 4; }
+inline int f6145_5(int x) { return x * 5; }
+inline int f6145_6(int x) { return x * 6; }
+inline int f6145_7(int x) { return x * 7; }
+inline int f6145_8(int x) { return x * 8; }
+inline int f6145_9(int x) { return x * 9; }
+inline int f6145_10(int x) { return x * 10; }
+inline int f6145_11(int x) { return x * 11; }
+inline int f6145_12(int x) { return x * 12; }
+inline int f6145_13(int x) { return x * 13; }
+inline int f6145_14(int x) { return x * 14; }
+inline int f6145_15(int x) { return x * 15; }
+inline int f6145_16(int x) { return x * 16; }
+inline int f6145_17(int x) { return x * 17; }
+inline int f6145_18(int x) { return x * 18; }
+inline int f6145_19(int x) { return x * 19; }
+inline int f6145_20(int x) { return x * 20; }
+inline int f6145_21(int x) { return x * 21; }
+inline int f6145_22(int x) { return x * 22; }
+inline int f6145_23(int x) { return x * 23; }
+inline int f6145_24(int x) { return x * 24; }
+inline int f6145_25(int x) { return x * 25; }
+inline int f6145_26(int x) { return x * 26; }
+inline int f6145_27(int x) { return x * 27; }
+inline int f6145_28(int x) { return x * 28; }
+inline int f6145_29(int x) { return x * 29; }
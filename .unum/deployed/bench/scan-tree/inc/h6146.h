@@ -0,0 +1,42 @@
+#pragma once
+/* header 6146 */
+#include <vector>
+#include "h6316.h"
+#include "h2697.h"
+#include "h4060.h"
+#include "h7585.h"
+#include "h7683.h"
+#ifdef X
+#include "h2870.h"
+#endif
+struct S6146 { int a; const char *s = "x//y"; };
+inline int f6146_0(int x) { return x * 0; }
+inline int f6146_1(int x) { return x * 1; }
+inline int f6146_2(int x) { return x * 2; }
+inline int f6146_3(int x) { return x * 3; }
+inline int f6146_4(int x) { return x * 4; }
+inline int f6146_5(int x) { return x * 5; }
+inline int f6146_6(int x) { return x * 6; }
+inline int f6146_7(int x) { return x * 7; }
+inline int f6146_8(int x) { return x * 8; }
+inline int f6146_9(int x) { return x * 9; }
+inline int f6146_10(int x) { return x * 10; }
+inline int f6146_11(int x) { return x * 11; }
+inline int f6146_12(int x) { return x * 12; }
+inline int f6146_13(int x) { return x * 13; }
+inline int f6146_14(int x) { return x * 14; }
+inline int f6146_15(int x) { return x * 15; }
+inline int f6146_16(int x) { return x * 16; }
+inline int f6146_17(int x) { return x * 17; }
+inline int f6146_18(int x) { return x * 18; }
+inline int f6146_19(int x) { return x * 19; }
+inline int f6146_20(int x) { return x * 20; }
+inline int f6146_21(int x) { return x * 21; }
+inline int f6146_22(int x) { return x * 22; }
+inline int f6146_23(int x) { return x * 23; }
+inline int f6146_24(int x) { return x * 24; }
+inline int f6146_25(int x) { return x * 25; }
+inline int f6146_26(int x) { return x * 26; }
+inline int f6146_27(int x) { return x * 27; }
+inline int f6146_28(int x) { return x * 28; }
+inline int f6146_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6148 */
+#include <vector>
+#include "h1530.h"
+#include "h9737.h"
+#include "h7753.h"
+#include "h3139.h"
+#include "h1481.h"
+#ifdef X
+#include "h1726.h"
+#endif
+struct S6148 { int a; const char *s = "x//y"; };
+inline int f6148_0(int x) { return x * 0; }
+inline int f6148_1(int x) { return x * 1; }
+inline int f6148_2(int x) { return x * 2; }
+inline int f6148_3(int x) { return x * 3; }
+inline int f6148_4(int x) { return x * 4; }
+inline int f6148_5(int x) { return x * 5; }
+inline int f6148_6(int x) { return x * 6; }
+inline int f6148_7(int x) { return x * 7; }
+inline int f6148_8(int x) { return x * 8; }
+inline int f6148_9(int x) { return x * 9; }
+inline int f6148_10(int x) { return x * 10; }
+inline int f6148_11(int x) { return x * 11; }
+inline int f6148_12(int x) { return x * 12; }
+inline int f6148_13(int x) { return x * 13; }
+inline int f6148_14(int x) { return x * 14; }
+inline int f6148_15(int x) { return x * 15; }
+inline int f6148_16(int x) { return x * 16; }
+inline int f6148_17(int x) { return x * 17; }
+inline int f6148_18(int x) { return x * 18; }
+inline int f6148_19(int x) { return x * 19; }
+inline int f6148_20(int x) { return x * 20; }
+inline int f6148_21(int x) { return x * 21; }
+inline int f6148_22(int x) { return x * 22; }
+inline int f6148_23(int x) { return x * 23; }
+inline int f6148_24(int x) { return x * 24; }
+inline int f6148_25(int x) { return x * 25; }
+inline int f6148_26(int x) { return x * 26; }
+inline int f6148_27(int x) { return x * 27; }
+inline int f6148_28(int x) { return x * 28; }
+inline int f6148_29(int x) { return x * 29; }
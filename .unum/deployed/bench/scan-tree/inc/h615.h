@@ -0,0 +1,42 @@
+#pragma once
+/* header 615 */
+#include <vector>
+#include "h8306.h"
+#include "h3517.h"
+#include "h215.h"
+#include "h4562.h"
+#include "h9727.h"
+#ifdef X
+#include "h8456.h"
+#endif
+struct S615 { int a; const char *s = "x//y"; };
+inline int f615_0(int x) { return x * 0; }
+inline int f615_1(int x) { return x * 1; }
+inline int f615_2(int x) { return x * 2; }
+inline int f615_3(int x) { return x * 3; }
+inline int f615_4(int x) { return x * 4; }
+inline int f615_5(int x) { return x * 5; }
+inline int f615_6(int x) { return x * 6; }
+inline int f615_7(int x) { return x * 7; }
+inline int f615_8(int x) { return x * 8; }
+inline int f615_9(int x) { return x * 9; }
+inline int f615_10(int x) { return x * 10; }
+inline int f615_11(int x) { return x * 11; }
+inline int f615_12(int x) { return x * 12; }
+inline int f615_13(int x) { return x * 13; }
+inline int f615_14(int x) { return x * 14; }
+inline int f615_15(int x) { return x * 15; }
+inline int f615_16(int x) { return x * 16; }
+inline int f615_17(int x) { return x * 17; }
+inline int f615_18(int x) { return x * 18; }
+inline int f615_19(int x) { return x * 19; }
+inline int f615_20(int x) { return x * 20; }
+inline int f615_21(int x) { return x * 21; }
+inline int f615_22(int x) { return x * 22; }
+inline int f615_23(int x) { return x * 23; }
+inline int f615_24(int x) { return x * 24; }
+inline int f615_25(int x) { return x * 25; }
+inline int f615_26(int x) { return x * 26; }
+inline int f615_27(int x) { return x * 27; }
+inline int f615_28(int x) { return x * 28; }
+inline int f615_29(int x) { return x * 29; }
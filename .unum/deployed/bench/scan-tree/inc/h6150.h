@@ -0,0 +1,42 @@
+#pragma once
+/* header 6150 */
+#include <vector>
+#include "h6400.h"
+#include "h3440.h"
+#include "h968.h"
+#include "h3831.h"
+#include "h5104.h"
+#ifdef X
+#include "h8399.h"
+#endif
+struct S6150 { int a; const char *s = "x//y"; };
+inline int f6150_0(int x) { return x * 0; }
+inline int f6150_1(int x) { return x * 1; }
+inline int f6150_2(int x) { return x * 2; }
+inline int f6150_3(int x) { return x * 3; }
+inline int f6150_4(int x) { return x * 4; }
+inline int f6150_5(int x) { return x * 5; }
+inline int f6150_6(int x) { return x * 6; }
+inline int f6150_7(int x) { return x * 7; }
+inline int f6150_8(int x) { return x * 8; }
+inline int f6150_9(int x) { return x * 9; }
+inline int f6150_10(int x) { return x * 10; }
+inline int f6150_11(int x) { return x * 11; }
+inline int f6150_12(int x) { return x * 12; }
+inline int f6150_13(int x) { return x * 13; }
+inline int f6150_14(int x) { return x * 14; }
+inline int f6150_15(int x) { return x * 15; }
+inline int f6150_16(int x) { return x * 16; }
+inline int f6150_17(int x) { return x * 17; }
+inline int f6150_18(int x) { return x * 18; }
+inline int f6150_19(int x) { return x * 19; }
+inline int f6150_20(int x) { return x * 20; }
+inline int f6150_21(int x) { return x * 21; }
+inline int f6150_22(int x) { return x * 22; }
+inline int f6150_23(int x) { return x * 23; }
+inline int f6150_24(int x) { return x * 24; }
+inline int f6150_25(int x) { return x * 25; }
+inline int f6150_26(int x) { return x * 26; }
+inline int f6150_27(int x) { return x * 27; }
+inline int f6150_28(int x) { return x * 28; }
+inline int f6150_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6151 */
+#include <vector>
+#include "h2914.h"
+#include "h8683.h"
+#include "h9412.h"
+#include "h7063.h"
+#include "h6356.h"
+#ifdef X
+#include "h5202.h"
+#endif
+struct S6151 { int a; const char *s = "x//y"; };
+inline int f6151_0(int x) { return x * 0; }
+inline int f6151_1(int x) { return x * 1; }
+inline int f6151_2(int x) { return x * 2; }
+inline int f6151_3(int x) { return x * 3; }
+inline int f6151_4(int x) { return x * 4; }
+inline int f6151_5(int x) { return x * 5; }
+inline int f6151_6(int x) { return x * 6; }
+inline int f6151_7(int x) { return x * 7; }
+inline int f6151_8(int x) { return x * 8; }
+inline int f6151_9(int x) { return x * 9; }
+inline int f6151_10(int x) { return x * 10; }
+inline int f6151_11(int x) { return x * 11; }
+inline int f6151_12(int x) { return x * 12; }
+inline int f6151_13(int x) { return x * 13; }
+inline int f6151_14(int x) { return x * 14; }
+inline int f6151_15(int x) { return x * 15; }
+inline int f6151_16(int x) { return x * 16; }
+inline int f6151_17(int x) { return x * 17; }
+inline int f6151_18(int x) { return x * 18; }
+inline int f6151_19(int x) { return x * 19; }
+inline int f6151_20(int x) { return x * 20; }
+inline int f6151_21(int x) { return x * 21; }
+inline int f6151_22(int x) { return x * 22; }
+inline int f6151_23(int x) { return x * 23; }
+inline int f6151_24(int x) { return x * 24; }
+inline int f6151_25(int x) { return x * 25; }
+inline int f6151_26(int x) { return x * 26; }
+inline int f6151_27(int x) { return x * 27; }
+inline int f6151_28(int x) { return x * 28; }
+inline int f6151_29(int x) { return x * 29; }
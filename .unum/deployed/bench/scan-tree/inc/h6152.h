@@ -0,0 +1,42 @@
+#pragma once
+/* header 6152 */
+#include <vector>
+#include "h3319.h"
+#include "h1245.h"
+#include "h791.h"
+#include "h3196.h"
+#include "h4682.h"
+#ifdef X
+#include "h816.h"
+#endif
+struct S6152 { int a; const char *s = "x//y"; };
+inline int f6152_0(int x) { return x * 0; }
+inline int f6152_1(int x) { return x * 1; }
+inline int f6152_2(int x) { return x * 2; }
+inline int f6152_3(int x) { return x * 3; }
+inline int f6152_4(int x) { return x * 4; }
+inline int f6152_5(int x) { return x * 5; }
+inline int f6152_6(int x) { return x * 6; }
+inline int f6152_7(int x) { return x * 7; }
+inline int f6152_8(int x) { return x * 8; }
+inline int f6152_9(int x) { return x * 9; }
+inline int f6152_10(int x) { return x * 10; }
+inline int f6152_11(int x) { return x * 11; }
+inline int f6152_12(int x) { return x * 12; }
+inline int f6152_13(int x) { return x * 13; }
+inline int f6152_14(int x) { return x * 14; }
+inline int f6152_15(int x) { return x * 15; }
+inline int f6152_16(int x) { return x * 16; }
+inline int f6152_17(int x) { return x * 17; }
+inline int f6152_18(int x) { return x * 18; }
+inline int f6152_19(int x) { return x * 19; }
+inline int f6152_20(int x) { return x * 20; }
+inline int f6152_21(int x) { return x * 21; }
+inline int f6152_22(int x) { return x * 22; }
+inline int f6152_23(int x) { return x * 23; }
+inline int f6152_24(int x) { return x * 24; }
+inline int f6152_25(int x) { return x * 25; }
+inline int f6152_26(int x) { return x * 26; }
+inline int f6152_27(int x) { return x * 27; }
+inline int f6152_28(int x) { return x * 28; }
+inline int f6152_29(int x) { return x * 29; }
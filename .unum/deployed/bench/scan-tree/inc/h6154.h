@@ -0,0 +1,42 @@
+#pragma once
+/* header 6154 */
+#include <vector>
+#include "h3004.h"
+#include "h5584.h"
+#include "h6910.h"
+#include "h2831.h"
+#include "h9681.h"
+#ifdef X
+#include "h7860.h"
+#endif
+struct S6154 { int a; const char *s = "x//y"; };
+inline int f6154_0(int x) { return x * 0; }
+inline int f6154_1(int x) { return x * 1; }
+inline int f6154_2(int x) { return x * 2; }
+inline int f6154_3(int x) { return x * 3; }
+inline int f6154_4(int x) { return x * 4; }
+inline int f6154_5(int x) { return x * 5; }
+inline int f6154_6(int x) { return x * 6; }
+inline int f6154_7(int x) { return x * 7; }
+inline int f6154_8(int x) { return x * 8; }
+inline int f6154_9(int x) { return x * 9; }
+inline int f6154_10(int x) { return x * 10; }
+inline int f6154_11(int x) { return x * 11; }
+inline int f6154_12(int x) { return x * 12; }
+inline int f6154_13(int x) { return x * 13; }
+inline int f6154_14(int x) { return x * 14; }
+inline int f6154_15(int x) { return x * 15; }
+inline int f6154_16(int x) { return x * 16; }
+inline int f6154_17(int x) { return x * 17; }
+inline int f6154_18(int x) { return x * 18; }
+inline int f6154_19(int x) { return x * 19; }
+inline int f6154_20(int x) { return x * 20; }
+inline int f6154_21(int x) { return x * 21; }
+inline int f6154_22(int x) { return x * 22; }
+inline int f6154_23(int x) { return x * 23; }
+inline int f6154_24(int x) { return x * 24; }
+inline int f6154_25(int x) { return x * 25; }
+inline int f6154_26(int x) { return x * 26; }
+inline int f6154_27(int x) { return x * 27; }
+inline int f6154_28(int x) { return x * 28; }
+inline int f6154_29(int x) { return x * 29; }
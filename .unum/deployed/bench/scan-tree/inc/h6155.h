@@ -0,0 +1,42 @@
+#pragma once
+/* header 6155 */
+#include <vector>
+#include "h3894.h"
+#include "h9610.h"
+#include "h7977.h"
+#include "h145.h"
+#include "h9862.h"
+#ifdef X
+#include "h3767.h"
+#endif
+struct S6155 { int a; const char *s = "x//y"; };
+inline int f6155_0(int x) { return x * 0; }
+inline int f6155_1(int x) { return x * 1; }
+inline int f6155_2(int x) { return x * 2; }
+inline int f6155_3(int x) { return x * 3; }
+inline int f6155_4(int x) { return x * 4; }
+inline int f6155_5(int x) { return x * 5; }
+inline int f6155_6(int x) { return x * 6; }
+inline int f6155_7(int x) { return x * 7; }
+inline int f6155_8(int x) { return x * 8; }
+inline int f6155_9(int x) { return x * 9; }
+inline int f6155_10(int x) { return x * 10; }
+inline int f6155_11(int x) { return x * 11; }
+inline int f6155_12(int x) { return x * 12; }
+inline int f6155_13(int x) { return x * 13; }
+inline int f6155_14(int x) { return x * 14; }
+inline int f6155_15(int x) { return x * 15; }
+inline int f6155_16(int x) { return x * 16; }
+inline int f6155_17(int x) { return x * 17; }
+inline int f6155_18(int x) { return x * 18; }
+inline int f6155_19(int x) { return x * 19; }
+inline int f6155_20(int x) { return x * 20; }
+inline int f6155_21(int x) { return x * 21; }
+inline int f6155_22(int x) { return x * 22; }
+inline int f6155_23(int x) { return x * 23; }
+inline int f6155_24(int x) { return x * 24; }
+inline int f6155_25(int x) { return x * 25; }
+inline int f6155_26(int x) { return x * 26; }
+inline int f6155_27(int x) { return x * 27; }
+inline int f6155_28(int x) { return x * 28; }
+inline int f6155_29(int x) { return x * 29; }
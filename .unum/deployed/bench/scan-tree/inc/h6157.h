@@ -0,0 +1,42 @@
+#pragma once
+/* header 6157 */
+#include <vector>
+#include "h1503.h"
+#include "h2826.h"
+#include "h521.h"
+#include "h1237.h"
+#include "h3763.h"
+#ifdef X
+#include "h3884.h"
+#endif
+struct S6157 { int a; const char *s = "x//y"; };
+inline int f6157_0(int x) { return x * 0; }
+inline int f6157_1(int x) { return x * 1; }
+inline int f6157_2(int x) { return x * 2; }
+inline int f6157_3(int x) { return x * 3; }
+inline int f6157_4(int x) { return x * 4; }
+inline int f6157_5(int x) { return x * 5; }
+inline int f6157_6(int x) { return x * 6; }
+inline int f6157_7(int x) { return x * 7; }
+inline int f6157_8(int x) { return x * 8; }
+inline int f6157_9(int x) { return x * 9; }
+inline int f6157_10(int x) { return x * 10; }
+inline int f6157_11(int x) { return x * 11; }
+inline int f6157_12(int x) { return x * 12; }
+inline int f6157_13(int x) { return x * 13; }
+inline int f6157_14(int x) { return x * 14; }
+inline int f6157_15(int x) { return x * 15; }
+inline int f6157_16(int x) { return x * 16; }
+inline int f6157_17(int x) { return x * 17; }
+inline int f6157_18(int x) { return x * 18; }
+inline int f6157_19(int x) { return x * 19; }
+inline int f6157_20(int x) { return x * 20; }
+inline int f6157_21(int x) { return x * 21; }
+inline int f6157_22(int x) { return x * 22; }
+inline int f6157_23(int x) { return x * 23; }
+inline int f6157_24(int x) { return x * 24; }
+inline int f6157_25(int x) { return x * 25; }
+inline int f6157_26(int x) { return x * 26; }
+inline int f6157_27(int x) { return x * 27; }
+inline int f6157_28(int x) { return x * 28; }
+inline int f6157_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6159 */
+#include <vector>
+#include "h8437.h"
+#include "h3193.h"
+#include "h2476.h"
+#include "h1363.h"
+#include "h4237.h"
+#ifdef X
+#include "h6330.h"
+#endif
+struct S6159 { int a; const char *s = "x//y"; };
+inline int f6159_0(int x) { return x * 0; }
+inline int f6159_1(int x) { return x * 1; }
+inline int f6159_2(int x) { return x * 2; }
+inline int f6159_3(int x) { return x * 3; }
+inline int f6159_4(int x) { return x * 4; }
+inline int f6159_5(int x) { return x * 5; }
+inline int f6159_6(int x) { return x * 6; }
+inline int f6159_7(int x) { return x * 7; }
+inline int f6159_8(int x) { return x * 8; }
+inline int f6159_9(int x) { return x * 9; }
+inline int f6159_10(int x) { return x * 10; }
+inline int f6159_11(int x) { return x * 11; }
+inline int f6159_12(int x) { return x * 12; }
+inline int f6159_13(int x) { return x * 13; }
+inline int f6159_14(int x) { return x * 14; }
+inline int f6159_15(int x) { return x * 15; }
+inline int f6159_16(int x) { return x * 16; }
+inline int f6159_17(int x) { return x * 17; }
+inline int f6159_18(int x) { return x * 18; }
+inline int f6159_19(int x) { return x * 19; }
+inline int f6159_20(int x) { return x * 20; }
+inline int f6159_21(int x) { return x * 21; }
+inline int f6159_22(int x) { return x * 22; }
+inline int f6159_23(int x) { return x * 23; }
+inline int f6159_24(int x) { return x * 24; }
+inline int f6159_25(int x) { return x * 25; }
+inline int f6159_26(int x) { return x * 26; }
+inline int f6159_27(int x) { return x * 27; }
+inline int f6159_28(int x) { return x * 28; }
+inline int f6159_29(int x) { return x * 29; }
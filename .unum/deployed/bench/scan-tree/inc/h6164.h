@@ -0,0 +1,42 @@
+#pragma once
+/* header 6164 */
+#include <vector>
+#include "h9531.h"
+#include "h2317.h"
+#include "h1892.h"
+#include "h7893.h"
+#include "h930.h"
+#ifdef X
+#include "h6585.h"
+#endif
+struct S6164 { int a; const char *s = "x//y"; };
+inline int f6164_0(int x) { return x * 0; }
+inline int f6164_1(int x) { return x * 1; }
+inline int f6164_2(int x) { return x * 2; }
+inline int f6164_3(int x) { return x * 3; }
+inline int f6164_4(int x) { return x * 4; }
+inline int f6164_5(int x) { return x * 5; }
+inline int f6164_6(int x) { return x * 6; }
+inline int f6164_7(int x) { return x * 7; }
+inline int f6164_8(int x) { return x * 8; }
+inline int f6164_9(int x) { return x * 9; }
+inline int f6164_10(int x) { return x * 10; }
+inline int f6164_11(int x) { return x * 11; }
+inline int f6164_12(int x) { return x * 12; }
+inline int f6164_13(int x) { return x * 13; }
+inline int f6164_14(int x) { return x * 14; }
+inline int f6164_15(int x) { return x * 15; }
+inline int f6164_16(int x) { return x * 16; }
+inline int f6164_17(int x) { return x * 17; }
+inline int f6164_18(int x) { return x * 18; }
+inline int f6164_19(int x) { return x * 19; }
+inline int f6164_20(int x) { return x * 20; }
+inline int f6164_21(int x) { return x * 21; }
+inline int f6164_22(int x) { return x * 22; }
+inline int f6164_23(int x) { return x * 23; }
+inline int f6164_24(int x) { return x * 24; }
+inline int f6164_25(int x) { return x * 25; }
+inline int f6164_26(int x) { return x * 26; }
+inline int f6164_27(int x) { return x * 27; }
+inline int f6164_28(int x) { return x * 28; }
+inline int f6164_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6166 */
+#include <vector>
+#include "h2854.h"
+#include "h5796.h"
+#include "h5552.h"
+#include "h3322.h"
+#include "h3133.h"
+#ifdef X
+#include "h7718.h"
+#endif
+struct S6166 { int a; const char *s = "x//y"; };
+inline int f6166_0(int x) { return x * 0; }
+inline int f6166_1(int x) { return x * 1; }
+inline int f6166_2(int x) { return x * 2; }
+inline int f6166_3(int x) { return x * 3; }
+inline int f6166_4(int x) { return x * 4; }
+inline int f6166_5(int x) { return x * 5; }
+inline int f6166_6(int x) { return x * 6; }
+inline int f6166_7(int x) { return x * 7; }
+inline int f6166_8(int x) { return x * 8; }
+inline int f6166_9(int x) { return x * 9; }
+inline int f6166_10(int x) { return x * 10; }
+inline int f6166_11(int x) { return x * 11; }
+inline int f6166_12(int x) { return x * 12; }
+inline int f6166_13(int x) { return x * 13; }
+inline int f6166_14(int x) { return x * 14; }
+inline int f6166_15(int x) { return x * 15; }
+inline int f6166_16(int x) { return x * 16; }
+inline int f6166_17(int x) { return x * 17; }
+inline int f6166_18(int x) { return x * 18; }
+inline int f6166_19(int x) { return x * 19; }
+inline int f6166_20(int x) { return x * 20; }
+inline int f6166_21(int x) { return x * 21; }
+inline int f6166_22(int x) { return x * 22; }
+inline int f6166_23(int x) { return x * 23; }
+inline int f6166_24(int x) { return x * 24; }
+inline int f6166_25(int x) { return x * 25; }
+inline int f6166_26(int x) { return x * 26; }
+inline int f6166_27(int x) { return x * 27; }
+inline int f6166_28(int x) { return x * 28; }
+inline int f6166_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6168 */
+#include <vector>
+#include "h7141.h"
+#include "h7984.h"
+#include "h4583.h"
+#include "h8151.h"
+#include "h6860.h"
+#ifdef X
+#include "h6806.h"
+#endif
+struct S6168 { int a; const char *s = "x//y"; };
+inline int f6168_0(int x) { return x * 0; }
+inline int f6168_1(int x) { return x * 1; }
+inline int f6168_2(int x) { return x * 2; }
+inline int f6168_3(int x) { return x * 3; }
+inline int f6168_4(int x) { return x * 4; }
+inline int f6168_5(int x) { return x * 5; }
+inline int f6168_6(int x) { return x * 6; }
+inline int f6168_7(int x) { return x * 7; }
+inline int f6168_8(int x) { return x * 8; }
+inline int f6168_9(int x) { return x * 9; }
+inline int f6168_10(int x) { return x * 10; }
+inline int f6168_11(int x) { return x * 11; }
+inline int f6168_12(int x) { return x * 12; }
+inline int f6168_13(int x) { return x * 13; }
+inline int f6168_14(int x) { return x * 14; }
+inline int f6168_15(int x) { return x * 15; }
+inline int f6168_16(int x) { return x * 16; }
+inline int f6168_17(int x) { return x * 17; }
+inline int f6168_18(int x) { return x * 18; }
+inline int f6168_19(int x) { return x * 19; }
+inline int f6168_20(int x) { return x * 20; }
+inline int f6168_21(int x) { return x * 21; }
+inline int f6168_22(int x) { return x * 22; }
+inline int f6168_23(int x) { return x * 23; }
+inline int f6168_24(int x) { return x * 24; }
+inline int f6168_25(int x) { return x * 25; }
+inline int f6168_26(int x) { return x * 26; }
+inline int f6168_27(int x) { return x * 27; }
+inline int f6168_28(int x) { return x * 28; }
+inline int f6168_29(int x) { return x * 29; }
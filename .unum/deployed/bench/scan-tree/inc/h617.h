@@ -0,0 +1,42 @@
+#pragma once
+/* header 617 */
+#include <vector>
+#include "h2297.h"
+#include "h1843.h"
+#include "h9987.h"
+#include "h7681.h"
+#include "h9593.h"
+#ifdef X
+#include "h5571.h"
+#endif
+struct S617 { int a; const char *s = "x//y"; };
+inline int f617_0(int x) { return x * 0; }
+inline int f617_1(int x) { return x * 1; }
+inline int f617_2(int x) { return x * 2; }
+inline int f617_3(int x) { return x * 3; }
+inline int f617_4(int x) { return x * 4; }
+inline int f617_5(int x) { return x * 5; }
+inline int f617_6(int x) { return x * 6; }
+inline int f617_7(int x) { return x * 7; }
+inline int f617_8(int x) { return x * 8; }
+inline int f617_9(int x) { return x * 9; }
+inline int f617_10(int x) { return x * 10; }
+inline int f617_11(int x) { return x * 11; }
+inline int f617_12(int x) { return x * 12; }
+inline int f617_13(int x) { return x * 13; }
+inline int f617_14(int x) { return x * 14; }
+inline int f617_15(int x) { return x * 15; }
+inline int f617_16(int x) { return x * 16; }
+inline int f617_17(int x) { return x * 17; }
+inline int f617_18(int x) { return x * 18; }
+inline int f617_19(int x) { return x * 19; }
+inline int f617_20(int x) { return x * 20; }
+inline int f617_21(int x) { return x * 21; }
+inline int f617_22(int x) { return x * 22; }
+inline int f617_23(int x) { return x * 23; }
+inline int f617_24(int x) { return x * 24; }
+inline int f617_25(int x) { return x * 25; }
+inline int f617_26(int x) { return x * 26; }
+inline int f617_27(int x) { return x * 27; }
+inline int f617_28(int x) { return x * 28; }
+inline int f617_29(int x) { return x * 29; }
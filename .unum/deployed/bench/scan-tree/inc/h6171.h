@@ -0,0 +1,42 @@
+#pragma once
+/* header 6171 */
+#include <vector>
+#include "h8868.h"
+#include "h370.h"
+#include "h2259.h"
+#include "h9504.h"
+#include "h7754.h"
+#ifdef X
+#include "h1063.h"
+#endif
+struct S6171 { int a; const char *s = "x//y"; };
+inline int f6171_0(int x) { return x * 0; }
+inline int f6171_1(int x) { return x * 1; }
+inline int f6171_2(int x) { return x * 2; }
+inline int f6171_3(int x) { return x * 3; }
+inline int f6171_4(int x) { return x * 4; }
+inline int f6171_5(int x) { return x * 5; }
+inline int f6171_6(int x) { return x * 6; }
+inline int f6171_7(int x) { return x * 7; }
+inline int f6171_8(int x) { return x * 8; }
+inline int f6171_9(int x) { return x * 9; }
+inline int f6171_10(int x) { return x * 10; }
+inline int f6171_11(int x) { return x * 11; }
+inline int f6171_12(int x) { return x * 12; }
+inline int f6171_13(int x) { return x * 13; }
+inline int f6171_14(int x) { return x * 14; }
+inline int f6171_15(int x) { return x * 15; }
+inline int f6171_16(int x) { return x * 16; }
+inline int f6171_17(int x) { return x * 17; }
+inline int f6171_18(int x) { return x * 18; }
+inline int f6171_19(int x) { return x * 19; }
+inline int f6171_20(int x) { return x * 20; }
+inline int f6171_21(int x) { return x * 21; }
+inline int f6171_22(int x) { return x * 22; }
+inline int f6171_23(int x) { return x * 23; }
+inline int f6171_24(int x) { return x * 24; }
+inline int f6171_25(int x) { return x * 25; }
+inline int f6171_26(int x) { return x * 26; }
+inline int f6171_27(int x) { return x * 27; }
+inline int f6171_28(int x) { return x * 28; }
+inline int f6171_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6172 */
+#include <vector>
+#include "h2807.h"
+#include "h7402.h"
+#include "h226.h"
+#include "h5341.h"
+#include "h4596.h"
+#ifdef X
+#include "h2675.h"
+#endif
+struct S6172 { int a; const char *s = "x//y"; };
+inline int f6172_0(int x) { return x * 0; }
+inline int f6172_1(int x) { return x * 1; }
+inline int f6172_2(int x) { return x * 2; }
+inline int f6172_3(int x) { return x * 3; }
+inline int f6172_4(int x) { return x * 4; }
+inline int f6172_5(int x) { return x * 5; }
+inline int f6172_6(int x) { return x * 6; }
+inline int f6172_7(int x) { return x * 7; }
+inline int f6172_8(int x) { return x * 8; }
+inline int f6172_9(int x) { return x * 9; }
+inline int f6172_10(int x) { return x * 10; }
+inline int f6172_11(int x) { return x * 11; }
+inline int f6172_12(int x) { return x * 12; }
+inline int f6172_13(int x) { return x * 13; }
+inline int f6172_14(int x) { return x * 14; }
+inline int f6172_15(int x) { return x * 15; }
+inline int f6172_16(int x) { return x * 16; }
+inline int f6172_17(int x) { return x * 17; }
+inline int f6172_18(int x) { return x * 18; }
+inline int f6172_19(int x) { return x * 19; }
+inline int f6172_20(int x) { return x * 20; }
+inline int f6172_21(int x) { return x * 21; }
+inline int f6172_22(int x) { return x * 22; }
+inline int f6172_23(int x) { return x * 23; }
+inline int f6172_24(int x) { return x * 24; }
+inline int f6172_25(int x) { return x * 25; }
+inline int f6172_26(int x) { return x * 26; }
+inline int f6172_27(int x) { return x * 27; }
+inline int f6172_28(int x) { return x * 28; }
+inline int f6172_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6174 */
+#include <vector>
+#include "h7452.h"
+#include "h6101.h"
+#include "h851.h"
+#include "h7325.h"
+#include "h9198.h"
+#ifdef X
+#include "h4001.h"
+#endif
+struct S6174 { int a; const char *s = "x//y"; };
+inline int f6174_0(int x) { return x * 0; }
+inline int f6174_1(int x) { return x * 1; }
+inline int f6174_2(int x) { return x * 2; }
+inline int f6174_3(int x) { return x * 3; }
+inline int f6174_4(int x) { return x * 4; }
+inline int f6174_5(int x) { return x * 5; }
+inline int f6174_6(int x) { return x * 6; }
+inline int f6174_7(int x) { return x * 7; }
+inline int f6174_8(int x) { return x * 8; }
+inline int f6174_9(int x) { return x * 9; }
+inline int f6174_10(int x) { return x * 10; }
+inline int f6174_11(int x) { return x * 11; }
+inline int f6174_12(int x) { return x * 12; }
+inline int f6174_13(int x) { return x * 13; }
+inline int f6174_14(int x) { return x * 14; }
+inline int f6174_15(int x) { return x * 15; }
+inline int f6174_16(int x) { return x * 16; }
+inline int f6174_17(int x) { return x * 17; }
+inline int f6174_18(int x) { return x * 18; }
+inline int f6174_19(int x) { return x * 19; }
+inline int f6174_20(int x) { return x * 20; }
+inline int f6174_21(int x) { return x * 21; }
+inline int f6174_22(int x) { return x * 22; }
+inline int f6174_23(int x) { return x * 23; }
+inline int f6174_24(int x) { return x * 24; }
+inline int f6174_25(int x) { return x * 25; }
+inline int f6174_26(int x) { return x * 26; }
+inline int f6174_27(int x) { return x * 27; }
+inline int f6174_28(int x) { return x * 28; }
+inline int f6174_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6176 */
+#include <vector>
+#include "h1766.h"
+#include "h1569.h"
+#include "h8063.h"
+#include "h3073.h"
+#include "h2756.h"
+#ifdef X
+#include "h8877.h"
+#endif
+struct S6176 { int a; const char *s = "x//y"; };
+inline int f6176_0(int x) { return x * 0; }
+inline int f6176_1(int x) { return x * 1; }
+inline int f6176_2(int x) { return x * 2; }
+inline int f6176_3(int x) { return x * 3; }
+inline int f6176_4(int x) { return x * 4; }
+inline int f6176_5(int x) { return x * 5; }
+inline int f6176_6(int x) { return x * 6; }
+inline int f6176_7(int x) { return x * 7; }
+inline int f6176_8(int x) { return x * 8; }
+inline int f6176_9(int x) { return x * 9; }
+inline int f6176_10(int x) { return x * 10; }
+inline int f6176_11(int x) { return x * 11; }
+inline int f6176_12(int x) { return x * 12; }
+inline int f6176_13(int x) { return x * 13; }
+inline int f6176_14(int x) { return x * 14; }
+inline int f6176_15(int x) { return x * 15; }
+inline int f6176_16(int x) { return x * 16; }
+inline int f6176_17(int x) { return x * 17; }
+inline int f6176_18(int x) { return x * 18; }
+inline int f6176_19(int x) { return x * 19; }
+inline int f6176_20(int x) { return x * 20; }
+inline int f6176_21(int x) { return x * 21; }
+inline int f6176_22(int x) { return x * 22; }
+inline int f6176_23(int x) { return x * 23; }
+inline int f6176_24(int x) { return x * 24; }
+inline int f6176_25(int x) { return x * 25; }
+inline int f6176_26(int x) { return x * 26; }
+inline int f6176_27(int x) { return x * 27; }
+inline int f6176_28(int x) { return x * 28; }
+inline int f6176_29(int x) { return x * 29; }
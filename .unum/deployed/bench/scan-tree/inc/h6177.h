@@ -0,0 +1,42 @@
+#pragma once
+/* header 6177 */
+#include <vector>
+#include "h90.h"
+#include "h7686.h"
+#include "h3910.h"
+#include "h1957.h"
+#include "h8687.h"
+#ifdef X
+#include "h7919.h"
+#endif
+struct S6177 { int a; const char *s = "x//y"; };
+inline int f6177_0(int x) { return x * 0; }
+inline int f6177_1(int x) { return x * 1; }
+inline int f6177_2(int x) { return x * 2; }
+inline int f6177_3(int x) { return x * 3; }
+inline int f6177_4(int x) { return x * 4; }
+inline int f6177_5(int x) { return x * 5; }
+inline int f6177_6(int x) { return x * 6; }
+inline int f6177_7(int x) { return x * 7; }
+inline int f6177_8(int x) { return x * 8; }
+inline int f6177_9(int x) { return x * 9; }
+inline int f6177_10(int x) { return x * 10; }
+inline int f6177_11(int x) { return x * 11; }
+inline int f6177_12(int x) { return x * 12; }
+inline int f6177_13(int x) { return x * 13; }
+inline int f6177_14(int x) { return x * 14; }
+inline int f6177_15(int x) { return x * 15; }
+inline int f6177_16(int x) { return x * 16; }
+inline int f6177_17(int x) { return x * 17; }
+inline int f6177_18(int x) { return x * 18; }
+inline int f6177_19(int x) { return x * 19; }
+inline int f6177_20(int x) { return x * 20; }
+inline int f6177_21(int x) { return x * 21; }
+inline int f6177_22(int x) { return x * 22; }
+inline int f6177_23(int x) { return x * 23; }
+inline int f6177_24(int x) { return x * 24; }
+inline int f6177_25(int x) { return x * 25; }
+inline int f6177_26(int x) { return x * 26; }
+inline int f6177_27(int x) { return x * 27; }
+inline int f6177_28(int x) { return x * 28; }
+inline int f6177_29(int x) { return x * 29; }
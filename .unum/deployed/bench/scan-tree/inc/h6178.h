@@ -0,0 +1,42 @@
+#pragma once
+/* header 6178 */
+#include <vector>
+#include "h7401.h"
+#include "h9384.h"
+#include "h3378.h"
+#include "h233.h"
+#include "h4495.h"
+#ifdef X
+#include "h426.h"
+#endif
+struct S6178 { int a; const char *s = "x//y"; };
+inline int f6178_0(int x) { return x * 0; }
+inline int f6178_1(int x) { return x * 1; }
+inline int f6178_2(int x) { return x * 2; }
+inline int f6178_3(int x) { return x * 3; }
+inline int f6178_4(int x) { return x * 4; }
+inline int f6178_5(int x) { return x * 5; }
+inline int f6178_6(int x) { return x * 6; }
+inline int f6178_7(int x) { return x * 7; }
+inline int f6178_8(int x) { return x * 8; }
+inline int f6178_9(int x) { return x * 9; }
+inline int f6178_10(int x) { return x * 10; }
+inline int f6178_11(int x) { return x * 11; }
+inline int f6178_12(int x) { return x * 12; }
+inline int f6178_13(int x) { return x * 13; }
+inline int f6178_14(int x) { return x * 14; }
+inline int f6178_15(int x) { return x * 15; }
+inline int f6178_16(int x) { return x * 16; }
+inline int f6178_17(int x) { return x * 17; }
+inline int f6178_18(int x) { return x * 18; }
+inline int f6178_19(int x) { return x * 19; }
+inline int f6178_20(int x) { return x * 20; }
+inline int f6178_21(int x) { return x * 21; }
+inline int f6178_22(int x) { return x * 22; }
+inline int f6178_23(int x) { return x * 23; }
+inline int f6178_24(int x) { return x * 24; }
+inline int f6178_25(int x) { return x * 25; }
+inline int f6178_26(int x) { return x * 26; }
+inline int f6178_27(int x) { return x * 27; }
+inline int f6178_28(int x) { return x * 28; }
+inline int f6178_29(int x) { return x * 29; }
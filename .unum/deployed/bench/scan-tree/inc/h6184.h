@@ -0,0 +1,42 @@
+#pragma once
+/* header 6184 */
+#include <vector>
+#include "h741.h"
+#include "h3039.h"
+#include "h2278.h"
+#include "h8160.h"
+#include "h7151.h"
+#ifdef X
+#include "h7391.h"
+#endif
+struct S6184 { int a; const char *s = "x//y"; };
+inline int f6184_0(int x) { return x * 0; }
+inline int f6184_1(int x) { return x * 1; }
+inline int f6184_2(int x) { return x * 2; }
+inline int f6184_3(int x) { return x * 3; }
+inline int f6184_4(int x) { return x * 4; }
+inline int f6184_5(int x) { return x * 5; }
+inline int f6184_6(int x) { return x * 6; }
+inline int f6184_7(int x) { return x * 7; }
+inline int f6184_8(int x) { return x * 8; }
+inline int f6184_9(int x) { return x * 9; }
+inline int f6184_10(int x) { return x * 10; }
+inline int f6184_11(int x) { return x * 11; }
+inline int f6184_12(int x) { return x * 12; }
+inline int f6184_13(int x) { return x * 13; }
+inline int f6184_14(int x) { return x * 14; }
+inline int f6184_15(int x) { return x * 15; }
+inline int f6184_16(int x) { return x * 16; }
+inline int f6184_17(int x) { return x * 17; }
+inline int f6184_18(int x) { return x * 18; }
+inline int f6184_19(int x) { return x * 19; }
+inline int f6184_20(int x) { return x * 20; }
+inline int f6184_21(int x) { return x * 21; }
+inline int f6184_22(int x) { return x * 22; }
+inline int f6184_23(int x) { return x * 23; }
+inline int f6184_24(int x) { return x * 24; }
+inline int f6184_25(int x) { return x * 25; }
+inline int f6184_26(int x) { return x * 26; }
+inline int f6184_27(int x) { return x * 27; }
+inline int f6184_28(int x) { return x * 28; }
+inline int f6184_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6185 */
+#include <vector>
+#include "h710.h"
+#include "h1086.h"
+#include "h479.h"
+#include "h706.h"
+#include "h3006.h"
+#ifdef X
+#include "h323.h"
+#endif
+struct S6185 { int a; const char *s = "x//y"; };
+inline int f6185_0(int x) { return x * 0; }
+inline int f6185_1(int x) { return x * 1; }
+inline int f6185_2(int x) { return x * 2; }
+inline int f6185_3(int x) { return x * 3; }
+inline int f6185_4(int x) { return x * 4; }
+inline int f6185_5(int x) { return x * 5; }
+inline int f6185_6(int x) { return x * 6; }
+inline int f6185_7(int x) { return x * 7; }
+inline int f6185_8(int x) { return x * 8; }
+inline int f6185_9(int x) { return x * 9; }
+inline int f6185_10(int x) { return x * 10; }
+inline int f6185_11(int x) { return x * 11; }
+inline int f6185_12(int x) { return x * 12; }
+inline int f6185_13(int x) { return x * 13; }
+inline int f6185_14(int x) { return x * 14; }
+inline int f6185_15(int x) { return x * 15; }
+inline int f6185_16(int x) { return x * 16; }
+inline int f6185_17(int x) { return x * 17; }
+inline int f6185_18(int x) { return x * 18; }
+inline int f6185_19(int x) { return x * 19; }
+inline int f6185_20(int x) { return x * 20; }
+inline int f6185_21(int x) { return x * 21; }
+inline int f6185_22(int x) { return x * 22; }
+inline int f6185_23(int x) { return x * 23; }
+inline int f6185_24(int x) { return x * 24; }
+inline int f6185_25(int x) { return x * 25; }
+inline int f6185_26(int x) { return x * 26; }
+inline int f6185_27(int x) { return x * 27; }
+inline int f6185_28(int x) { return x * 28; }
+inline int f6185_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6187 */
+#include <vector>
+#include "h6335.h"
+#include "h5111.h"
+#include "h4571.h"
+#include "h8558.h"
+#include "h5831.h"
+#ifdef X
+#include "h4050.h"
+#endif
+struct S6187 { int a; const char *s = "x//y"; };
+inline int f6187_0(int x) { return x * 0; }
+inline int f6187_1(int x) { return x * 1; }
+inline int f6187_2(int x) { return x * 2; }
+inline int f6187_3(int x) { return x * 3; }
+inline int f6187_4(int x) { return x * 4; }
+inline int f6187_5(int x) { return x * 5; }
+inline int f6187_6(int x) { return x * 6; }
+inline int f6187_7(int x) { return x * 7; }
+inline int f6187_8(int x) { return x * 8; }
+inline int f6187_9(int x) { return x * 9; }
+inline int f6187_10(int x) { return x * 10; }
+inline int f6187_11(int x) { return x * 11; }
+inline int f6187_12(int x) { return x * 12; }
+inline int f6187_13(int x) { return x * 13; }
+inline int f6187_14(int x) { return x * 14; }
+inline int f6187_15(int x) { return x * 15; }
+inline int f6187_16(int x) { return x * 16; }
+inline int f6187_17(int x) { return x * 17; }
+inline int f6187_18(int x) { return x * 18; }
+inline int f6187_19(int x) { return x * 19; }
+inline int f6187_20(int x) { return x * 20; }
+inline int f6187_21(int x) { return x * 21; }
+inline int f6187_22(int x) { return x * 22; }
+inline int f6187_23(int x) { return x * 23; }
+inline int f6187_24(int x) { return x * 24; }
+inline int f6187_25(int x) { return x * 25; }
+inline int f6187_26(int x) { return x * 26; }
+inline int f6187_27(int x) { return x * 27; }
+inline int f6187_28(int x) { return x * 28; }
+inline int f6187_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6190 */
+#include <vector>
+#include "h2234.h"
+#include "h8972.h"
+#include "h6227.h"
+#include "h8751.h"
+#include "h9419.h"
+#ifdef X
+#include "h7729.h"
+#endif
+struct S6190 { int a; const char *s = "x//y"; };
+inline int f6190_0(int x) { return x * 0; }
+inline int f6190_1(int x) { return x * 1; }
+inline int f6190_2(int x) { return x * 2; }
+inline int f6190_3(int x) { return x * 3; }
+inline int f6190_4(int x) { return x * 4; }
+inline int f6190_5(int x) { return x * 5; }
+inline int f6190_6(int x) { return x * 6; }
+inline int f6190_7(int x) { return x * 7; }
+inline int f6190_8(int x) { return x * 8; }
+inline int f6190_9(int x) { return x * 9; }
+inline int f6190_10(int x) { return x * 10; }
+inline int f6190_11(int x) { return x * 11; }
+inline int f6190_12(int x) { return x * 12; }
+inline int f6190_13(int x) { return x * 13; }
+inline int f6190_14(int x) { return x * 14; }
+inline int f6190_15(int x) { return x * 15; }
+inline int f6190_16(int x) { return x * 16; }
+inline int f6190_17(int x) { return x * 17; }
+inline int f6190_18(int x) { return x * 18; }
+inline int f6190_19(int x) { return x * 19; }
+inline int f6190_20(int x) { return x * 20; }
+inline int f6190_21(int x) { return x * 21; }
+inline int f6190_22(int x) { return x * 22; }
+inline int f6190_23(int x) { return x * 23; }
+inline int f6190_24(int x) { return x * 24; }
+inline int f6190_25(int x) { return x * 25; }
+inline int f6190_26(int x) { return x * 26; }
+inline int f6190_27(int x) { return x * 27; }
+inline int f6190_28(int x) { return x * 28; }
+inline int f6190_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6193 */
+#include <vector>
+#include "h5581.h"
+#include "h1355.h"
+#include "h2145.h"
+#include "h5865.h"
+#include "h3536.h"
+#ifdef X
+#include "h8728.h"
+#endif
+struct S6193 { int a; const char *s = "x//y"; };
+inline int f6193_0(int x) { return x * 0; }
+inline int f6193_1(int x) { return x * 1; }
+inline int f6193_2(int x) { return x * 2; }
+inline int f6193_3(int x) { return x * 3; }
+inline int f6193_4(int x) { return x * 4; }
+inline int f6193_5(int x) { return x * 5; }
+inline int f6193_6(int x) { return x * 6; }
+inline int f6193_7(int x) { return x * 7; }
+inline int f6193_8(int x) { return x * 8; }
+inline int f6193_9(int x) { return x * 9; }
+inline int f6193_10(int x) { return x * 10; }
+inline int f6193_11(int x) { return x * 11; }
+inline int f6193_12(int x) { return x * 12; }
+inline int f6193_13(int x) { return x * 13; }
+inline int f6193_14(int x) { return x * 14; }
+inline int f6193_15(int x) { return x * 15; }
+inline int f6193_16(int x) { return x * 16; }
+inline int f6193_17(int x) { return x * 17; }
+inline int f6193_18(int x) { return x * 18; }
+inline int f6193_19(int x) { return x * 19; }
+inline int f6193_20(int x) { return x * 20; }
+inline int f6193_21(int x) { return x * 21; }
+inline int f6193_22(int x) { return x * 22; }
+inline int f6193_23(int x) { return x * 23; }
+inline int f6193_24(int x) { return x * 24; }
+inline int f6193_25(int x) { return x * 25; }
+inline int f6193_26(int x) { return x * 26; }
+inline int f6193_27(int x) { return x * 27; }
+inline int f6193_28(int x) { return x * 28; }
+inline int f6193_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6194 */
+#include <vector>
+#include "h4648.h"
+#include "h4734.h"
+#include "h4563.h"
+#include "h1883.h"
+#include "h1512.h"
+#ifdef X
+#include "h8580.h"
+#endif
+struct S6194 { int a; const char *s = "x//y"; };
+inline int f6194_0(int x) { return x * 0; }
+inline int f6194_1(int x) { return x * 1; }
+inline int f6194_2(int x) { return x * 2; }
+inline int f6194_3(int x) { return x * 3; }
+inline int f6194_4(int x) { return x * 4; }
+inline int f6194_5(int x) { return x * 5; }
+inline int f6194_6(int x) { return x * 6; }
+inline int f6194_7(int x) { return x * 7; }
+inline int f6194_8(int x) { return x * 8; }
+inline int f6194_9(int x) { return x * 9; }
+inline int f6194_10(int x) { return x * 10; }
+inline int f6194_11(int x) { return x * 11; }
+inline int f6194_12(int x) { return x * 12; }
+inline int f6194_13(int x) { return x * 13; }
+inline int f6194_14(int x) { return x * 14; }
+inline int f6194_15(int x) { return x * 15; }
+inline int f6194_16(int x) { return x * 16; }
+inline int f6194_17(int x) { return x * 17; }
+inline int f6194_18(int x) { return x * 18; }
+inline int f6194_19(int x) { return x * 19; }
+inline int f6194_20(int x) { return x * 20; }
+inline int f6194_21(int x) { return x * 21; }
+inline int f6194_22(int x) { return x * 22; }
+inline int f6194_23(int x) { return x * 23; }
+inline int f6194_24(int x) { return x * 24; }
+inline int f6194_25(int x) { return x * 25; }
+inline int f6194_26(int x) { return x * 26; }
+inline int f6194_27(int x) { return x * 27; }
+inline int f6194_28(int x) { return x * 28; }
+inline int f6194_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6195 */
+#include <vector>
+#include "h9292.h"
+#include "h504.h"
+#include "h3027.h"
+#include "h7587.h"
+#include "h7852.h"
+#ifdef X
+#include "h9683.h"
+#endif
+struct S6195 { int a; const char *s = "x//y"; };
+inline int f6195_0(int x) { return x * 0; }
+inline int f6195_1(int x) { return x * 1; }
+inline int f6195_2(int x) { return x * 2; }
+inline int f6195_3(int x) { return x * 3; }
+inline int f6195_4(int x) { return x * 4; }
+inline int f6195_5(int x) { return x * 5; }
+inline int f6195_6(int x) { return x * 6; }
+inline int f6195_7(int x) { return x * 7; }
+inline int f6195_8(int x) { return x * 8; }
+inline int f6195_9(int x) { return x * 9; }
+inline int f6195_10(int x) { return x * 10; }
+inline int f6195_11(int x) { return x * 11; }
+inline int f6195_12(int x) { return x * 12; }
+inline int f6195_13(int x) { return x * 13; }
+inline int f6195_14(int x) { return x * 14; }
+inline int f6195_15(int x) { return x * 15; }
+inline int f6195_16(int x) { return x * 16; }
+inline int f6195_17(int x) { return x * 17; }
+inline int f6195_18(int x) { return x * 18; }
+inline int f6195_19(int x) { return x * 19; }
+inline int f6195_20(int x) { return x * 20; }
+inline int f6195_21(int x) { return x * 21; }
+inline int f6195_22(int x) { return x * 22; }
+inline int f6195_23(int x) { return x * 23; }
+inline int f6195_24(int x) { return x * 24; }
+inline int f6195_25(int x) { return x * 25; }
+inline int f6195_26(int x) { return x * 26; }
+inline int f6195_27(int x) { return x * 27; }
+inline int f6195_28(int x) { return x * 28; }
+inline int f6195_29(int x) { return x * 29; }
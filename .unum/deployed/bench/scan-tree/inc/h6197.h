@@ -0,0 +1,42 @@
+#pragma once
+/* header 6197 */
+#include <vector>
+#include "h5979.h"
+#include "h5069.h"
+#include "h7464.h"
+#include "h5984.h"
+#include "h385.h"
+#ifdef X
+#include "h5804.h"
+#endif
+struct S6197 { int a; const char *s = "x//y"; };
+inline int f6197_0(int x) { return x * 0; }
+inline int f6197_1(int x) { return x * 1; }
+inline int f6197_2(int x) { return x * 2; }
+inline int f6197_3(int x) { return x * 3; }
+inline int f6197_4(int x) { return x * 4; }
+inline int f6197_5(int x) { return x * 5; }
+inline int f6197_6(int x) { return x * 6; }
+inline int f6197_7(int x) { return x * 7; }
+inline int f6197_8(int x) { return x * 8; }
+inline int f6197_9(int x) { return x * 9; }
+inline int f6197_10(int x) { return x * 10; }
+inline int f6197_11(int x) { return x * 11; }
+inline int f6197_12(int x) { return x * 12; }
+inline int f6197_13(int x) { return x * 13; }
+inline int f6197_14(int x) { return x * 14; }
+inline int f6197_15(int x) { return x * 15; }
+inline int f6197_16(int x) { return x * 16; }
+inline int f6197_17(int x) { return x * 17; }
+inline int f6197_18(int x) { return x * 18; }
+inline int f6197_19(int x) { return x * 19; }
+inline int f6197_20(int x) { return x * 20; }
+inline int f6197_21(int x) { return x * 21; }
+inline int f6197_22(int x) { return x * 22; }
+inline int f6197_23(int x) { return x * 23; }
+inline int f6197_24(int x) { return x * 24; }
+inline int f6197_25(int x) { return x * 25; }
+inline int f6197_26(int x) { return x * 26; }
+inline int f6197_27(int x) { return x * 27; }
+inline int f6197_28(int x) { return x * 28; }
+inline int f6197_29(int x) { return x * 29; }
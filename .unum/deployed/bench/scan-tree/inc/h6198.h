@@ -0,0 +1,42 @@
+#pragma once
+/* header 6198 */
+#include <vector>
+#include "h2222.h"
+#include "h8519.h"
+#include "h5458.h"
+#include "h6906.h"
+#include "h235.h"
+#ifdef X
+#include "h4645.h"
+#endif
+struct S6198 { int a; const char *s = "x//y"; };
+inline int f6198_0(int x) { return x * 0; }
+inline int f6198_1(int x) { return x * 1; }
+inline int f6198_2(int x) { return x * 2; }
+inline int f6198_3(int x) { return x * 3; }
+inline int f6198_4(int x) { return x * 4; }
+inline int f6198_5(int x) { return x * 5; }
+inline int f6198_6(int x) { return x * 6; }
+inline int f6198_7(int x) { return x * 7; }
+inline int f6198_8(int x) { return x * 8; }
+inline int f6198_9(int x) { return x * 9; }
+inline int f6198_10(int x) { return x * 10; }
+inline int f6198_11(int x) { return x * 11; }
+inline int f6198_12(int x) { return x * 12; }
+inline int f6198_13(int x) { return x * 13; }
+inline int f6198_14(int x) { return x * 14; }
+inline int f6198_15(int x) { return x * 15; }
+inline int f6198_16(int x) { return x * 16; }
+inline int f6198_17(int x) { return x * 17; }
+inline int f6198_18(int x) { return x * 18; }
+inline int f6198_19(int x) { return x * 19; }
+inline int f6198_20(int x) { return x * 20; }
+inline int f6198_21(int x) { return x * 21; }
+inline int f6198_22(int x) { return x * 22; }
+inline int f6198_23(int x) { return x * 23; }
+inline int f6198_24(int x) { return x * 24; }
+inline int f6198_25(int x) { return x * 25; }
+inline int f6198_26(int x) { return x * 26; }
+inline int f6198_27(int x) { return x * 27; }
+inline int f6198_28(int x) { return x * 28; }
+inline int f6198_29(int x) { return x * 29; }
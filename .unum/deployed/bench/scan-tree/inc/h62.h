@@ -0,0 +1,42 @@
+#pragma once
+/* header 62 */
+#include <vector>
+#include "h7295.h"
+#include "h5785.h"
+#include "h9320.h"
+#include "h4605.h"
+#include "h7197.h"
+#ifdef X
+#include "h7084.h"
+#endif
+struct S62 { int a; const char *s = "x//y"; };
+inline int f62_0(int x) { return x * 0; }
+inline int f62_1(int x) { return x * 1; }
+inline int f62_2(int x) { return x * 2; }
+inline int f62_3(int x) { return x * 3; }
+inline int f62_4(int x) { return x * 4; }
+inline int f62_5(int x) { return x * 5; }
+inline int f62_6(int x) { return x * 6; }
+inline int f62_7(int x) { return x * 7; }
+inline int f62_8(int x) { return x * 8; }
+inline int f62_9(int x) { return x * 9; }
+inline int f62_10(int x) { return x * 10; }
+inline int f62_11(int x) { return x * 11; }
+inline int f62_12(int x) { return x * 12; }
+inline int f62_13(int x) { return x * 13; }
+inline int f62_14(int x) { return x * 14; }
+inline int f62_15(int x) { return x * 15; }
+inline int f62_16(int x) { return x * 16; }
+inline int f62_17(int x) { return x * 17; }
+inline int f62_18(int x) { return x * 18; }
+inline int f62_19(int x) { return x * 19; }
+inline int f62_20(int x) { return x * 20; }
+inline int f62_21(int x) { return x * 21; }
+inline int f62_22(int x) { return x * 22; }
+inline int f62_23(int x) { return x * 23; }
+inline int f62_24(int x) { return x * 24; }
+inline int f62_25(int x) { return x * 25; }
+inline int f62_26(int x) { return x * 26; }
+inline int f62_27(int x) { return x * 27; }
+inline int f62_28(int x) { return x * 28; }
+inline int f62_29(int x) { return x * 29; }
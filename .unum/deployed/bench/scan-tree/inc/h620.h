@@ -0,0 +1,42 @@
+#pragma once
+/* header 620 */
+#include <vector>
+#include "h8691.h"
+#include "h6512.h"
+#include "h7747.h"
+#include "h9456.h"
+#include "h4713.h"
+#ifdef X
+#include "h1923.h"
+#endif
+struct S620 { int a; const char *s = "x//y"; };
+inline int f620_0(int x) { return x * 0; }
+inline int f620_1(int x) { return x * 1; }
+inline int f620_2(int x) { return x * 2; }
+inline int f620_3(int x) { return x * 3; }
+inline int f620_4(int x) { return x * 4; }
+inline int f620_5(int x) { return x * 5; }
+inline int f620_6(int x) { return x * 6; }
+inline int f620_7(int x) { return x * 7; }
+inline int f620_8(int x) { return x * 8; }
+inline int f620_9(int x) { return x * 9; }
+inline int f620_10(int x) { return x * 10; }
+inline int f620_11(int x) { return x * 11; }
+inline int f620_12(int x) { return x * 12; }
+inline int f620_13(int x) { return x * 13; }
+inline int f620_14(int x) { return x * 14; }
+inline int f620_15(int x) { return x * 15; }
+inline int f620_16(int x) { return x * 16; }
+inline int f620_17(int x) { return x * 17; }
+inline int f620_18(int x) { return x * 18; }
+inline int f620_19(int x) { return x * 19; }
+inline int f620_20(int x) { return x * 20; }
+inline int f620_21(int x) { return x * 21; }
+inline int f620_22(int x) { return x * 22; }
+inline int f620_23(int x) { return x * 23; }
+inline int f620_24(int x) { return x * 24; }
+inline int f620_25(int x) { return x * 25; }
+inline int f620_26(int x) { return x * 26; }
+inline int f620_27(int x) { return x * 27; }
+inline int f620_28(int x) { return x * 28; }
+inline int f620_29(int x) { return x * 29; }
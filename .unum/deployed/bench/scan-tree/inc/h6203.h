@@ -0,0 +1,42 @@
+#pragma once
+/* header 6203 */
+#include <vector>
+#include "h9356.h"
+#include "h5338.h"
+#include "h5210.h"
+#include "h5997.h"
+#include "h9855.h"
+#ifdef X
+#include "h5508.h"
+#endif
+struct S6203 { int a; const char *s = "x//y"; };
+inline int f6203_0(int x) { return x * 0; }
+inline int f6203_1(int x) { return x * 1; }
+inline int f6203_2(int x) { return x * 2; }
+inline int f6203_3(int x) { return x * 3; }
+inline int f6203_4(int x) { return x * 4; }
+inline int f6203_5(int x) { return x * 5; }
+inline int f6203_6(int x) { return x * 6; }
+inline int f6203_7(int x) { return x * 7; }
+inline int f6203_8(int x) { return x * 8; }
+inline int f6203_9(int x) { return x * 9; }
+inline int f6203_10(int x) { return x * 10; }
+inline int f6203_11(int x) { return x * 11; }
+inline int f6203_12(int x) { return x * 12; }
+inline int f6203_13(int x) { return x * 13; }
+inline int f6203_14(int x) { return x * 14; }
+inline int f6203_15(int x) { return x * 15; }
+inline int f6203_16(int x) { return x * 16; }
+inline int f6203_17(int x) { return x * 17; }
+inline int f6203_18(int x) { return x * 18; }
+inline int f6203_19(int x) { return x * 19; }
+inline int f6203_20(int x) { return x * 20; }
+inline int f6203_21(int x) { return x * 21; }
+inline int f6203_22(int x) { return x * 22; }
+inline int f6203_23(int x) { return x * 23; }
+inline int f6203_24(int x) { return x * 24; }
+inline int f6203_25(int x) { return x * 25; }
+inline int f6203_26(int x) { return x * 26; }
+inline int f6203_27(int x) { return x * 27; }
+inline int f6203_28(int x) { return x * 28; }
+inline int f6203_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6206 */
+#include <vector>
+#include "h1738.h"
+#include "h3777.h"
+#include "h3637.h"
+#include "h8967.h"
+#include "h2562.h"
+#ifdef X
+#include "h2987.h"
+#endif
+struct S6206 { int a; const char *s = "x//y"; };
+inline int f6206_0(int x) { return x * 0; }
+inline int f6206_1(int x) { return x * 1; }
+inline int f6206_2(int x) { return x * 2; }
+inline int f6206_3(int x) { return x * 3; }
+inline int f6206_4(int x) { return x * 4; }
+inline int f6206_5(int x) { return x * 5; }
+inline int f6206_6(int x) { return x * 6; }
+inline int f6206_7(int x) { return x * 7; }
+inline int f6206_8(int x) { return x * 8; }
+inline int f6206_9(int x) { return x * 9; }
+inline int f6206_10(int x) { return x * 10; }
+inline int f6206_11(int x) { return x * 11; }
+inline int f6206_12(int x) { return x * 12; }
+inline int f6206_13(int x) { return x * 13; }
+inline int f6206_14(int x) { return x * 14; }
+inline int f6206_15(int x) { return x * 15; }
+inline int f6206_16(int x) { return x * 16; }
+inline int f6206_17(int x) { return x * 17; }
+inline int f6206_18(int x) { return x * 18; }
+inline int f6206_19(int x) { return x * 19; }
+inline int f6206_20(int x) { return x * 20; }
+inline int f6206_21(int x) { return x * 21; }
+inline int f6206_22(int x) { return x * 22; }
+inline int f6206_23(int x) { return x * 23; }
+inline int f6206_24(int x) { return x * 24; }
+inline int f6206_25(int x) { return x * 25; }
+inline int f6206_26(int x) { return x * 26; }
+inline int f6206_27(int x) { return x * 27; }
+inline int f6206_28(int x) { return x * 28; }
+inline int f6206_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6209 */
+#include <vector>
+#include "h7208.h"
+#include "h983.h"
+#include "h6794.h"
+#include "h3677.h"
+#include "h5553.h"
+#ifdef X
+#include "h1649.h"
+#endif
+struct S6209 { int a; const char *s = "x//y"; };
+inline int f6209_0(int x) { return x * 0; }
+inline int f6209_1(int x) { return x * 1; }
+inline int f6209_2(int x) { return x * 2; }
+inline int f6209_3(int x) { return x * 3; }
+inline int f6209_4(int x) { return x * 4; }
+inline int f6209_5(int x) { return x * 5; }
+inline int f6209_6(int x) { return x * 6; }
+inline int f6209_7(int x) { return x * 7; }
+inline int f6209_8(int x) { return x * 8; }
+inline int f6209_9(int x) { return x * 9; }
+inline int f6209_10(int x) { return x * 10; }
+inline int f6209_11(int x) { return x * 11; }
+inline int f6209_12(int x) { return x * 12; }
+inline int f6209_13(int x) { return x * 13; }
+inline int f6209_14(int x) { return x * 14; }
+inline int f6209_15(int x) { return x * 15; }
+inline int f6209_16(int x) { return x * 16; }
+inline int f6209_17(int x) { return x * 17; }
+inline int f6209_18(int x) { return x * 18; }
+inline int f6209_19(int x) { return x * 19; }
+inline int f6209_20(int x) { return x * 20; }
+inline int f6209_21(int x) { return x * 21; }
+inline int f6209_22(int x) { return x * 22; }
+inline int f6209_23(int x) { return x * 23; }
+inline int f6209_24(int x) { return x * 24; }
+inline int f6209_25(int x) { return x * 25; }
+inline int f6209_26(int x) { return x * 26; }
+inline int f6209_27(int x) { return x * 27; }
+inline int f6209_28(int x) { return x * 28; }
+inline int f6209_29(int x) { return x * 29; }
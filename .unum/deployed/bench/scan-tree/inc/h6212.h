@@ -0,0 +1,42 @@
+#pragma once
+/* header 6212 */
+#include <vector>
+#include "h8594.h"
+#include "h9267.h"
+#include "h8265.h"
+#include "h441.h"
+#include "h7020.h"
+#ifdef X
+#include "h4179.h"
+#endif
+struct S6212 { int a; const char *s = "x//y"; };
+inline int f6212_0(int x) { return x * 0; }
+inline int f6212_1(int x) { return x * 1; }
+inline int f6212_2(int x) { return x * 2; }
+inline int f6212_3(int x) { return x * 3; }
+inline int f6212_4(int x) { return x * 4; }
+inline int f6212_5(int x) { return x * 5; }
+inline int f6212_6(int x) { return x * 6; }
+inline int f6212_7(int x) { return x * 7; }
+inline int f6212_8(int x) { return x * 8; }
+inline int f6212_9(int x) { return x * 9; }
+inline int f6212_10(int x) { return x * 10; }
+inline int f6212_11(int x) { return x * 11; }
+inline int f6212_12(int x) { return x * 12; }
+inline int f6212_13(int x) { return x * 13; }
+inline int f6212_14(int x) { return x * 14; }
+inline int f6212_15(int x) { return x * 15; }
+inline int f6212_16(int x) { return x * 16; }
+inline int f6212_17(int x) { return x * 17; }
+inline int f6212_18(int x) { return x * 18; }
+inline int f6212_19(int x) { return x * 19; }
+inline int f6212_20(int x) { return x * 20; }
+inline int f6212_21(int x) { return x * 21; }
+inline int f6212_22(int x) { return x * 22; }
+inline int f6212_23(int x) { return x * 23; }
+inline int f6212_24(int x) { return x * 24; }
+inline int f6212_25(int x) { return x * 25; }
+inline int f6212_26(int x) { return x * 26; }
+inline int f6212_27(int x) { return x * 27; }
+inline int f6212_28(int x) { return x * 28; }
+inline int f6212_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6215 */
+#include <vector>
+#include "h875.h"
+#include "h8271.h"
+#include "h3134.h"
+#include "h6728.h"
+#include "h2239.h"
+#ifdef X
+#include "h1411.h"
+#endif
+struct S6215 { int a; const char *s = "x//y"; };
+inline int f6215_0(int x) { return x * 0; }
+inline int f6215_1(int x) { return x * 1; }
+inline int f6215_2(int x) { return x * 2; }
+inline int f6215_3(int x) { return x * 3; }
+inline int f6215_4(int x) { return x * 4; }
+inline int f6215_5(int x) { return x * 5; }
+inline int f6215_6(int x) { return x * 6; }
+inline int f6215_7(int x) { return x * 7; }
+inline int f6215_8(int x) { return x * 8; }
+inline int f6215_9(int x) { return x * 9; }
+inline int f6215_10(int x) { return x * 10; }
+inline int f6215_11(int x) { return x * 11; }
+inline int f6215_12(int x) { return x * 12; }
+inline int f6215_13(int x) { return x * 13; }
+inline int f6215_14(int x) { return x * 14; }
+inline int f6215_15(int x) { return x * 15; }
+inline int f6215_16(int x) { return x * 16; }
+inline int f6215_17(int x) { return x * 17; }
+inline int f6215_18(int x) { return x * 18; }
+inline int f6215_19(int x) { return x * 19; }
+inline int f6215_20(int x) { return x * 20; }
+inline int f6215_21(int x) { return x * 21; }
+inline int f6215_22(int x) { return x * 22; }
+inline int f6215_23(int x) { return x * 23; }
+inline int f6215_24(int x) { return x * 24; }
+inline int f6215_25(int x) { return x * 25; }
+inline int f6215_26(int x) { return x * 26; }
+inline int f6215_27(int x) { return x * 27; }
+inline int f6215_28(int x) { return x * 28; }
+inline int f6215_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6218 */
+#include <vector>
+#include "h8689.h"
+#include "h6975.h"
+#include "h7635.h"
+#include "h6661.h"
+#include "h2562.h"
+#ifdef X
+#include "h4867.h"
+#endif
+struct S6218 { int a; const char *s = "x//y"; };
+inline int f6218_0(int x) { return x * 0; }
+inline int f6218_1(int x) { return x * 1; }
+inline int f6218_2(int x) { return x * 2; }
+inline int f6218_3(int x) { return x * 3; }
+inline int f6218_4(int x) { return x * 4; }
+inline int f6218_5(int x) { return x * 5; }
+inline int f6218_6(int x) { return x * 6; }
+inline int f6218_7(int x) { return x * 7; }
+inline int f6218_8(int x) { return x * 8; }
+inline int f6218_9(int x) { return x * 9; }
+inline int f6218_10(int x) { return x * 10; }
+inline int f6218_11(int x) { return x * 11; }
+inline int f6218_12(int x) { return x * 12; }
+inline int f6218_13(int x) { return x * 13; }
+inline int f6218_14(int x) { return x * 14; }
+inline int f6218_15(int x) { return x * 15; }
+inline int f6218_16(int x) { return x * 16; }
+inline int f6218_17(int x) { return x * 17; }
+inline int f6218_18(int x) { return x * 18; }
+inline int f6218_19(int x) { return x * 19; }
+inline int f6218_20(int x) { return x * 20; }
+inline int f6218_21(int x) { return x * 21; }
+inline int f6218_22(int x) { return x * 22; }
+inline int f6218_23(int x) { return x * 23; }
+inline int f6218_24(int x) { return x * 24; }
+inline int f6218_25(int x) { return x * 25; }
+inline int f6218_26(int x) { return x * 26; }
+inline int f6218_27(int x) { return x * 27; }
+inline int f6218_28(int x) { return x * 28; }
+inline int f6218_29(int x) { return x * 29; }
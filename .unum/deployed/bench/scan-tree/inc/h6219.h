@@ -0,0 +1,42 @@
+#pragma once
+/* header 6219 */
+#include <vector>
+#include "h6770.h"
+#include "h2789.h"
+#include "h5295.h"
+#include "h7550.h"
+#include "h4237.h"
+#ifdef X
+#include "h9571.h"
+#endif
+struct S6219 { int a; const char *s = "x//y"; };
+inline int f6219_0(int x) { return x * 0; }
+inline int f6219_1(int x) { return x * 1; }
+inline int f6219_2(int x) { return x * 2; }
+inline int f6219_3(int x) { return x * 3; }
+inline int f6219_4(int x) { return x * 4; }
+inline int f6219_5(int x) { return x * 5; }
+inline int f6219_6(int x) { return x * 6; }
+inline int f6219_7(int x) { return x * 7; }
+inline int f6219_8(int x) { return x * 8; }
+inline int f6219_9(int x) { return x * 9; }
+inline int f6219_10(int x) { return x * 10; }
+inline int f6219_11(int x) { return x * 11; }
+inline int f6219_12(int x) { return x * 12; }
+inline int f6219_13(int x) { return x * 13; }
+inline int f6219_14(int x) { return x * 14; }
+inline int f6219_15(int x) { return x * 15; }
+inline int f6219_16(int x) { return x * 16; }
+inline int f6219_17(int x) { return x * 17; }
+inline int f6219_18(int x) { return x * 18; }
+inline int f6219_19(int x) { return x * 19; }
+inline int f6219_20(int x) { return x * 20; }
+inline int f6219_21(int x) { return x * 21; }
+inline int f6219_22(int x) { return x * 22; }
+inline int f6219_23(int x) { return x * 23; }
+inline int f6219_24(int x) { return x * 24; }
+inline int f6219_25(int x) { return x * 25; }
+inline int f6219_26(int x) { return x * 26; }
+inline int f6219_27(int x) { return x * 27; }
+inline int f6219_28(int x) { return x * 28; }
+inline int f6219_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6222 */
+#include <vector>
+#include "h2985.h"
+#include "h8901.h"
+#include "h9640.h"
+#include "h7006.h"
+#include "h4200.h"
+#ifdef X
+#include "h3784.h"
+#endif
+struct S6222 { int a; const char *s = "x//y"; };
+inline int f6222_0(int x) { return x * 0; }
+inline int f6222_1(int x) { return x * 1; }
+inline int f6222_2(int x) { return x * 2; }
+inline int f6222_3(int x) { return x * 3; }
+inline int f6222_4(int x) { return x * 4; }
+inline int f6222_5(int x) { return x * 5; }
+inline int f6222_6(int x) { return x * 6; }
+inline int f6222_7(int x) { return x * 7; }
+inline int f6222_8(int x) { return x * 8; }
+inline int f6222_9(int x) { return x * 9; }
+inline int f6222_10(int x) { return x * 10; }
+inline int f6222_11(int x) { return x * 11; }
+inline int f6222_12(int x) { return x * 12; }
+inline int f6222_13(int x) { return x * 13; }
+inline int f6222_14(int x) { return x * 14; }
+inline int f6222_15(int x) { return x * 15; }
+inline int f6222_16(int x) { return x * 16; }
+inline int f6222_17(int x) { return x * 17; }
+inline int f6222_18(int x) { return x * 18; }
+inline int f6222_19(int x) { return x * 19; }
+inline int f6222_20(int x) { return x * 20; }
+inline int f6222_21(int x) { return x * 21; }
+inline int f6222_22(int x) { return x * 22; }
+inline int f6222_23(int x) { return x * 23; }
+inline int f6222_24(int x) { return x * 24; }
+inline int f6222_25(int x) { return x * 25; }
+inline int f6222_26(int x) { return x * 26; }
+inline int f6222_27(int x) { return x * 27; }
+inline int f6222_28(int x) { return x * 28; }
+inline int f6222_29(int x) { return x * 29; }
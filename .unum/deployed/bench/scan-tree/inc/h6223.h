@@ -0,0 +1,42 @@
+#pragma once
+/* header 6223 */
+#include <vector>
+#include "h7864.h"
+#include "h40.h"
+#include "h9026.h"
+#include "h228.h"
+#include "h1152.h"
+#ifdef X
+#include "h8716.h"
+#endif
+struct S6223 { int a; const char *s = "x//y"; };
+inline int f6223_0(int x) { return x * 0; }
+inline int f6223_1(int x) { return x * 1; }
+inline int f6223_2(int x) { return x * 2; }
+inline int f6223_3(int x) { return x * 3; }
+inline int f6223_4(int x) { return x * 4; }
+inline int f6223_5(int x) { return x * 5; }
+inline int f6223_6(int x) { return x * 6; }
+inline int f6223_7(int x) { return x * 7; }
+inline int f6223_8(int x) { return x * 8; }
+inline int f6223_9(int x) { return x * 9; }
+inline int f6223_10(int x) { return x * 10; }
+inline int f6223_11(int x) { return x * 11; }
+inline int f6223_12(int x) { return x * 12; }
+inline int f6223_13(int x) { return x * 13; }
+inline int f6223_14(int x) { return x * 14; }
+inline int f6223_15(int x) { return x * 15; }
+inline int f6223_16(int x) { return x * 16; }
+inline int f6223_17(int x) { return x * 17; }
+inline int f6223_18(int x) { return x * 18; }
+inline int f6223_19(int x) { return x * 19; }
+inline int f6223_20(int x) { return x * 20; }
+inline int f6223_21(int x) { return x * 21; }
+inline int f6223_22(int x) { return x * 22; }
+inline int f6223_23(int x) { return x * 23; }
+inline int f6223_24(int x) { return x * 24; }
+inline int f6223_25(int x) { return x * 25; }
+inline int f6223_26(int x) { return x * 26; }
+inline int f6223_27(int x) { return x * 27; }
+inline int f6223_28(int x) { return x * 28; }
+inline int f6223_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6224 */
+#include <vector>
+#include "h9806.h"
+#include "h9421.h"
+#include "h9892.h"
+#include "h1975.h"
+#include "h4738.h"
+#ifdef X
+#include "h7732.h"
+#endif
+struct S6224 { int a; const char *s = "x//y"; };
+inline int f6224_0(int x) { return x * 0; }
+inline int f6224_1(int x) { return x * 1; }
+inline int f6224_2(int x) { return x * 2; }
+inline int f6224_3(int x) { return x * 3; }
+inline int f6224_4(int x) { return x * 4; }
+inline int f6224_5(int x) { return x * 5; }
+inline int f6224_6(int x) { return x * 6; }
+inline int f6224_7(int x) { return x * 7; }
+inline int f6224_8(int x) { return x * 8; }
+inline int f6224_9(int x) { return x * 9; }
+inline int f6224_10(int x) { return x * 10; }
+inline int f6224_11(int x) { return x * 11; }
+inline int f6224_12(int x) { return x * 12; }
+inline int f6224_13(int x) { return x * 13; }
+inline int f6224_14(int x) { return x * 14; }
+inline int f6224_15(int x) { return x * 15; }
+inline int f6224_16(int x) { return x * 16; }
+inline int f6224_17(int x) { return x * 17; }
+inline int f6224_18(int x) { return x * 18; }
+inline int f6224_19(int x) { return x * 19; }
+inline int f6224_20(int x) { return x * 20; }
+inline int f6224_21(int x) { return x * 21; }
+inline int f6224_22(int x) { return x * 22; }
+inline int f6224_23(int x) { return x * 23; }
+inline int f6224_24(int x) { return x * 24; }
+inline int f6224_25(int x) { return x * 25; }
+inline int f6224_26(int x) { return x * 26; }
+inline int f6224_27(int x) { return x * 27; }
+inline int f6224_28(int x) { return x * 28; }
+inline int f6224_29(int x) { return x * 29; }
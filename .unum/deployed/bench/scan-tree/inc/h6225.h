@@ -0,0 +1,42 @@
+#pragma once
+/* header 6225 */
+#include <vector>
+#include "h35.h"
+#include "h1993.h"
+#include "h868.h"
+#include "h564.h"
+#include "h6401.h"
+#ifdef X
+#include "h2041.h"
+#endif
+struct S6225 { int a; const char *s = "x//y"; };
+inline int f6225_0(int x) { return x * 0; }
+inline int f6225_1(int x) { return x * 1; }
+inline int f6225_2(int x) { return x * 2; }
+inline int f6225_3(int x) { return x * 3; }
+inline int f6225_4(int x) { return x * 4; }
+inline int f6225_5(int x) { return x * 5; }
+inline int f6225_6(int x) { return x * 6; }
+inline int f6225_7(int x) { return x * 7; }
+inline int f6225_8(int x) { return x * 8; }
+inline int f6225_9(int x) { return x * 9; }
+inline int f6225_10(int x) { return x * 10; }
+inline int f6225_11(int x) { return x * 11; }
+inline int f6225_12(int x) { return x * 12; }
+inline int f6225_13(int x) { return x * 13; }
+inline int f6225_14(int x) { return x * 14; }
+inline int f6225_15(int x) { return x * 15; }
+inline int f6225_16(int x) { return x * 16; }
+inline int f6225_17(int x) { return x * 17; }
+inline int f6225_18(int x) { return x * 18; }
+inline int f6225_19(int x) { return x * 19; }
+inline int f6225_20(int x) { return x * 20; }
+inline int f6225_21(int x) { return x * 21; }
+inline int f6225_22(int x) { return x * 22; }
+inline int f6225_23(int x) { return x * 23; }
+inline int f6225_24(int x) { return x * 24; }
+inline int f6225_25(int x) { return x * 25; }
+inline int f6225_26(int x) { return x * 26; }
+inline int f6225_27(int x) { return x * 27; }
+inline int f6225_28(int x) { return x * 28; }
+inline int f6225_29(int x) { return x * 29; }
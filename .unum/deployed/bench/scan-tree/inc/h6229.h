@@ -0,0 +1,42 @@
+#pragma once
+/* header 6229 */
+#include <vector>
+#include "h8833.h"
+#include "h4938.h"
+#include "h6328.h"
+#include "h2308.h"
+#include "h4482.h"
+#ifdef X
+#include "h4809.h"
+#endif
+struct S6229 { int a; const char *s = "x//y"; };
+inline int f6229_0(int x) { return x * 0; }
+inline int f6229_1(int x) { return x * 1; }
+inline int f6229_2(int x) { return x * 2; }
+inline int f6229_3(int x) { return x * 3; }
+inline int f6229_4(int x) { return x * 4; }
+inline int f6229_5(int x) { return x * 5; }
+inline int f6229_6(int x) { return x * 6; }
+inline int f6229_7(int x) { return x * 7; }
+inline int f6229_8(int x) { return x * 8; }
+inline int f6229_9(int x) { return x * 9; }
+inline int f6229_10(int x) { return x * 10; }
+inline int f6229_11(int x) { return x * 11; }
+inline int f6229_12(int x) { return x * 12; }
+inline int f6229_13(int x) { return x * 13; }
+inline int f6229_14(int x) { return x * 14; }
+inline int f6229_15(int x) { return x * 15; }
+inline int f6229_16(int x) { return x * 16; }
+inline int f6229_17(int x) { return x * 17; }
+inline int f6229_18(int x) { return x * 18; }
+inline int f6229_19(int x) { return x * 19; }
+inline int f6229_20(int x) { return x * 20; }
+inline int f6229_21(int x) { return x * 21; }
+inline int f6229_22(int x) { return x * 22; }
+inline int f6229_23(int x) { return x * 23; }
+inline int f6229_24(int x) { return x * 24; }
+inline int f6229_25(int x) { return x * 25; }
+inline int f6229_26(int x) { return x * 26; }
+inline int f6229_27(int x) { return x * 27; }
+inline int f6229_28(int x) { return x * 28; }
+inline int f6229_29(int x) { return x * 29; }
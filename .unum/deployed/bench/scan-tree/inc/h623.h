@@ -0,0 +1,42 @@
+#pragma once
+/* header 623 */
+#include <vector>
+#include "h911.h"
+#include "h4405.h"
+#include "h3469.h"
+#include "h5135.h"
+#include "h7045.h"
+#ifdef X
+#include "h4057.h"
+#endif
+struct S623 { int a; const char *s = "x//y"; };
+inline int f623_0(int x) { return x * 0; }
+inline int f623_1(int x) { return x * 1; }
+inline int f623_2(int x) { return x * 2; }
+inline int f623_3(int x) { return x * 3; }
+inline int f623_4(int x) { return x * 4; }
+inline int f623_5(int x) { return x * 5; }
+inline int f623_6(int x) { return x * 6; }
+inline int f623_7(int x) { return x * 7; }
+inline int f623_8(int x) { return x * 8; }
+inline int f623_9(int x) { return x * 9; }
+inline int f623_10(int x) { return x * 10; }
+inline int f623_11(int x) { return x * 11; }
+inline int f623_12(int x) { return x * 12; }
+inline int f623_13(int x) { return x * 13; }
+inline int f623_14(int x) { return x * 14; }
+inline int f623_15(int x) { return x * 15; }
+inline int f623_16(int x) { return x * 16; }
+inline int f623_17(int x) { return x * 17; }
+inline int f623_18(int x) { return x * 18; }
+inline int f623_19(int x) { return x * 19; }
+inline int f623_20(int x) { return x * 20; }
+inline int f623_21(int x) { return x * 21; }
+inline int f623_22(int x) { return x * 22; }
+inline int f623_23(int x) { return x * 23; }
+inline int f623_24(int x) { return x * 24; }
+inline int f623_25(int x) { return x * 25; }
+inline int f623_26(int x) { return x * 26; }
+inline int f623_27(int x) { return x * 27; }
+inline int f623_28(int x) { return x * 28; }
+inline int f623_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6230 */
+#include <vector>
+#include "h7709.h"
+#include "h3313.h"
+#include "h4007.h"
+#include "h8920.h"
+#include "h3255.h"
+#ifdef X
+#include "h8388.h"
+#endif
+struct S6230 { int a; const char *s = "x//y"; };
+inline int f6230_0(int x) { return x * 0; }
+inline int f6230_1(int x) { return x * 1; }
+inline int f6230_2(int x) { return x * 2; }
+inline int f6230_3(int x) { return x * 3; }
+inline int f6230_4(int x) { return x * 4; }
+inline int f6230_5(int x) { return x * 5; }
+inline int f6230_6(int x) { return x * 6; }
+inline int f6230_7(int x) { return x * 7; }
+inline int f6230_8(int x) { return x * 8; }
+inline int f6230_9(int x) { return x * 9; }
+inline int f6230_10(int x) { return x * 10; }
+inline int f6230_11(int x) { return x * 11; }
+inline int f6230_12(int x) { return x * 12; }
+inline int f6230_13(int x) { return x * 13; }
+inline int f6230_14(int x) { return x * 14; }
+inline int f6230_15(int x) { return x * 15; }
+inline int f6230_16(int x) { return x * 16; }
+inline int f6230_17(int x) { return x * 17; }
+inline int f6230_18(int x) { return x * 18; }
+inline int f6230_19(int x) { return x * 19; }
+inline int f6230_20(int x) { return x * 20; }
+inline int f6230_21(int x) { return x * 21; }
+inline int f6230_22(int x) { return x * 22; }
+inline int f6230_23(int x) { return x * 23; }
+inline int f6230_24(int x) { return x * 24; }
+inline int f6230_25(int x) { return x * 25; }
+inline int f6230_26(int x) { return x * 26; }
+inline int f6230_27(int x) { return x * 27; }
+inline int f6230_28(int x) { return x * 28; }
+inline int f6230_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6231 */
+#include <vector>
+#include "h7318.h"
+#include "h4057.h"
+#include "h3162.h"
+#include "h1068.h"
+#include "h7612.h"
+#ifdef X
+#include "h7178.h"
+#endif
+struct S6231 { int a; const char *s = "x//y"; };
+inline int f6231_0(int x) { return x * 0; }
+inline int f6231_1(int x) { return x * 1; }
+inline int f6231_2(int x) { return x * 2; }
+inline int f6231_3(int x) { return x * 3; }
+inline int f6231_4(int x) { return x * 4; }
+inline int f6231_5(int x) { return x * 5; }
+inline int f6231_6(int x) { return x * 6; }
+inline int f6231_7(int x) { return x * 7; }
+inline int f6231_8(int x) { return x * 8; }
+inline int f6231_9(int x) { return x * 9; }
+inline int f6231_10(int x) { return x * 10; }
+inline int f6231_11(int x) { return x * 11; }
+inline int f6231_12(int x) { return x * 12; }
+inline int f6231_13(int x) { return x * 13; }
+inline int f6231_14(int x) { return x * 14; }
+inline int f6231_15(int x) { return x * 15; }
+inline int f6231_16(int x) { return x * 16; }
+inline int f6231_17(int x) { return x * 17; }
+inline int f6231_18(int x) { return x * 18; }
+inline int f6231_19(int x) { return x * 19; }
+inline int f6231_20(int x) { return x * 20; }
+inline int f6231_21(int x) { return x * 21; }
+inline int f6231_22(int x) { return x * 22; }
+inline int f6231_23(int x) { return x * 23; }
+inline int f6231_24(int x) { return x * 24; }
+inline int f6231_25(int x) { return x * 25; }
+inline int f6231_26(int x) { return x * 26; }
+inline int f6231_27(int x) { return x * 27; }
+inline int f6231_28(int x) { return x * 28; }
+inline int f6231_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6232 */
+#include <vector>
+#include "h4500.h"
+#include "h5684.h"
+#include "h4782.h"
+#include "h1001.h"
+#include "h1931.h"
+#ifdef X
+#include "h3166.h"
+#endif
+struct S6232 { int a; const char *s = "x//y"; };
+inline int f6232_0(int x) { return x * 0; }
+inline int f6232_1(int x) { return x * 1; }
+inline int f6232_2(int x) { return x * 2; }
+inline int f6232_3(int x) { return x * 3; }
+inline int f6232_4(int x) { return x * 4; }
+inline int f6232_5(int x) { return x * 5; }
+inline int f6232_6(int x) { return x * 6; }
+inline int f6232_7(int x) { return x * 7; }
+inline int f6232_8(int x) { return x * 8; }
+inline int f6232_9(int x) { return x * 9; }
+inline int f6232_10(int x) { return x * 10; }
+inline int f6232_11(int x) { return x * 11; }
+inline int f6232_12(int x) { return x * 12; }
+inline int f6232_13(int x) { return x * 13; }
+inline int f6232_14(int x) { return x * 14; }
+inline int f6232_15(int x) { return x * 15; }
+inline int f6232_16(int x) { return x * 16; }
+inline int f6232_17(int x) { return x * 17; }
+inline int f6232_18(int x) { return x * 18; }
+inline int f6232_19(int x) { return x * 19; }
+inline int f6232_20(int x) { return x * 20; }
+inline int f6232_21(int x) { return x * 21; }
+inline int f6232_22(int x) { return x * 22; }
+inline int f6232_23(int x) { return x * 23; }
+inline int f6232_24(int x) { return x * 24; }
+inline int f6232_25(int x) { return x * 25; }
+inline int f6232_26(int x) { return x * 26; }
+inline int f6232_27(int x) { return x * 27; }
+inline int f6232_28(int x) { return x * 28; }
+inline int f6232_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6233 */
+#include <vector>
+#include "h9757.h"
+#include "h3612.h"
+#include "h562.h"
+#include "h1328.h"
+#include "h9066.h"
+#ifdef X
+#include "h9875.h"
+#endif
+struct S6233 { int a; const char *s = "x//y"; };
+inline int f6233_0(int x) { return x * 0; }
+inline int f6233_1(int x) { return x * 1; }
+inline int f6233_2(int x) { return x * 2; }
+inline int f6233_3(int x) { return x * 3; }
+inline int f6233_4(int x) { return x * 4; }
+inline int f6233_5(int x) { return x * 5; }
+inline int f6233_6(int x) { return x * 6; }
+inline int f6233_7(int x) { return x * 7; }
+inline int f6233_8(int x) { return x * 8; }
+inline int f6233_9(int x) { return x * 9; }
+inline int f6233_10(int x) { return x * 10; }
+inline int f6233_11(int x) { return x * 11; }
+inline int f6233_12(int x) { return x * 12; }
+inline int f6233_13(int x) { return x * 13; }
+inline int f6233_14(int x) { return x * 14; }
+inline int f6233_15(int x) { return x * 15; }
+inline int f6233_16(int x) { return x * 16; }
+inline int f6233_17(int x) { return x * 17; }
+inline int f6233_18(int x) { return x * 18; }
+inline int f6233_19(int x) { return x * 19; }
+inline int f6233_20(int x) { return x * 20; }
+inline int f6233_21(int x) { return x * 21; }
+inline int f6233_22(int x) { return x * 22; }
+inline int f6233_23(int x) { return x * 23; }
+inline int f6233_24(int x) { return x * 24; }
+inline int f6233_25(int x) { return x * 25; }
+inline int f6233_26(int x) { return x * 26; }
+inline int f6233_27(int x) { return x * 27; }
+inline int f6233_28(int x) { return x * 28; }
+inline int f6233_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6237 */
+#include <vector>
+#include "h8989.h"
+#include "h9397.h"
+#include "h7273.h"
+#include "h6490.h"
+#include "h8902.h"
+#ifdef X
+#include "h7030.h"
+#endif
+struct S6237 { int a; const char *s = "x//y"; };
+inline int f6237_0(int x) { return x * 0; }
+inline int f6237_1(int x) { return x * 1; }
+inline int f6237_2(int x) { return x * 2; }
+inline int f6237_3(int x) { return x * 3; }
+inline int f6237_4(int x) { return x * 4; }
+inline int f6237_5(int x) { return x * 5; }
+inline int f6237_6(int x) { return x * 6; }
+inline int f6237_7(int x) { return x * 7; }
+inline int f6237_8(int x) { return x * 8; }
+inline int f6237_9(int x) { return x * 9; }
+inline int f6237_10(int x) { return x * 10; }
+inline int f6237_11(int x) { return x * 11; }
+inline int f6237_12(int x) { return x * 12; }
+inline int f6237_13(int x) { return x * 13; }
+inline int f6237_14(int x) { return x * 14; }
+inline int f6237_15(int x) { return x * 15; }
+inline int f6237_16(int x) { return x * 16; }
+inline int f6237_17(int x) { return x * 17; }
+inline int f6237_18(int x) { return x * 18; }
+inline int f6237_19(int x) { return x * 19; }
+inline int f6237_20(int x) { return x * 20; }
+inline int f6237_21(int x) { return x * 21; }
+inline int f6237_22(int x) { return x * 22; }
+inline int f6237_23(int x) { return x * 23; }
+inline int f6237_24(int x) { return x * 24; }
+inline int f6237_25(int x) { return x * 25; }
+inline int f6237_26(int x) { return x * 26; }
+inline int f6237_27(int x) { return x * 27; }
+inline int f6237_28(int x) { return x * 28; }
+inline int f6237_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6238 */
+#include <vector>
+#include "h9391.h"
+#include "h9395.h"
+#include "h2468.h"
+#include "h5750.h"
+#include "h557.h"
+#ifdef X
+#include "h7506.h"
+#endif
+struct S6238 { int a; const char *s = "x//y"; };
+inline int f6238_0(int x) { return x * 0; }
+inline int f6238_1(int x) { return x * 1; }
+inline int f6238_2(int x) { return x * 2; }
+inline int f6238_3(int x) { return x * 3; }
+inline int f6238_4(int x) { return x * 4; }
+inline int f6238_5(int x) { return x * 5; }
+inline int f6238_6(int x) { return x * 6; }
+inline int f6238_7(int x) { return x * 7; }
+inline int f6238_8(int x) { return x * 8; }
+inline int f6238_9(int x) { return x * 9; }
+inline int f6238_10(int x) { return x * 10; }
+inline int f6238_11(int x) { return x * 11; }
+inline int f6238_12(int x) { return x * 12; }
+inline int f6238_13(int x) { return x * 13; }
+inline int f6238_14(int x) { return x * 14; }
+inline int f6238_15(int x) { return x * 15; }
+inline int f6238_16(int x) { return x * 16; }
+inline int f6238_17(int x) { return x * 17; }
+inline int f6238_18(int x) { return x * 18; }
+inline int f6238_19(int x) { return x * 19; }
+inline int f6238_20(int x) { return x * 20; }
+inline int f6238_21(int x) { return x * 21; }
+inline int f6238_22(int x) { return x * 22; }
+inline int f6238_23(int x) { return x * 23; }
+inline int f6238_24(int x) { return x * 24; }
+inline int f6238_25(int x) { return x * 25; }
+inline int f6238_26(int x) { return x * 26; }
+inline int f6238_27(int x) { return x * 27; }
+inline int f6238_28(int x) { return x * 28; }
+inline int f6238_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6241 */
+#include <vector>
+#include "h7796.h"
+#include "h3808.h"
+#include "h7353.h"
+#include "h4697.h"
+#include "h5215.h"
+#ifdef X
+#include "h2869.h"
+#endif
+struct S6241 { int a; const char *s = "x//y"; };
+inline int f6241_0(int x) { return x * 0; }
+inline int f6241_1(int x) { return x * 1; }
+inline int f6241_2(int x) { return x * 2; }
+inline int f6241_3(int x) { return x * 3; }
+inline int f6241_4(int x) { return x * 4; }
+inline int f6241_5(int x) { return x * 5; }
+inline int f6241_6(int x) { return x * 6; }
+inline int f6241_7(int x) { return x * 7; }
+inline int f6241_8(int x) { return x * 8; }
+inline int f6241_9(int x) { return x * 9; }
+inline int f6241_10(int x) { return x * 10; }
+inline int f6241_11(int x) { return x * 11; }
+inline int f6241_12(int x) { return x * 12; }
+inline int f6241_13(int x) { return x * 13; }
+inline int f6241_14(int x) { return x * 14; }
+inline int f6241_15(int x) { return x * 15; }
+inline int f6241_16(int x) { return x * 16; }
+inline int f6241_17(int x) { return x * 17; }
+inline int f6241_18(int x) { return x * 18; }
+inline int f6241_19(int x) { return x * 19; }
+inline int f6241_20(int x) { return x * 20; }
+inline int f6241_21(int x) { return x * 21; }
+inline int f6241_22(int x) { return x * 22; }
+inline int f6241_23(int x) { return x * 23; }
+inline int f6241_24(int x) { return x * 24; }
+inline int f6241_25(int x) { return x * 25; }
+inline int f6241_26(int x) { return x * 26; }
+inline int f6241_27(int x) { return x * 27; }
+inline int f6241_28(int x) { return x * 28; }
+inline int f6241_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6243 */
+#include <vector>
+#include "h6112.h"
+#include "h7249.h"
+#include "h6013.h"
+#include "h4115.h"
+#include "h9168.h"
+#ifdef X
+#include "h9404.h"
+#endif
+struct S6243 { int a; const char *s = "x//y"; };
+inline int f6243_0(int x) { return x * 0; }
+inline int f6243_1(int x) { return x * 1; }
+inline int f6243_2(int x) { return x * 2; }
+inline int f6243_3(int x) { return x * 3; }
+inline int f6243_4(int x) { return x * 4; }
+inline int f6243_5(int x) { return x * 5; }
+inline int f6243_6(int x) { return x * 6; }
+inline int f6243_7(int x) { return x * 7; }
+inline int f6243_8(int x) { return x * 8; }
+inline int f6243_9(int x) { return x * 9; }
+inline int f6243_10(int x) { return x * 10; }
+inline int f6243_11(int x) { return x * 11; }
+inline int f6243_12(int x) { return x * 12; }
+inline int f6243_13(int x) { return x * 13; }
+inline int f6243_14(int x) { return x * 14; }
+inline int f6243_15(int x) { return x * 15; }
+inline int f6243_16(int x) { return x * 16; }
+inline int f6243_17(int x) { return x * 17; }
+inline int f6243_18(int x) { return x * 18; }
+inline int f6243_19(int x) { return x * 19; }
+inline int f6243_20(int x) { return x * 20; }
+inline int f6243_21(int x) { return x * 21; }
+inline int f6243_22(int x) { return x * 22; }
+inline int f6243_23(int x) { return x * 23; }
+inline int f6243_24(int x) { return x * 24; }
+inline int f6243_25(int x) { return x * 25; }
+inline int f6243_26(int x) { return x * 26; }
+inline int f6243_27(int x) { return x * 27; }
+inline int f6243_28(int x) { return x * 28; }
+inline int f6243_29(int x) { return x * 29; }
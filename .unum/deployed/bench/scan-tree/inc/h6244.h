@@ -0,0 +1,42 @@
+#pragma once
+/* header 6244 */
+#include <vector>
+#include "h3884.h"
+#include "h9131.h"
+#include "h5135.h"
+#include "h4272.h"
+#include "h4636.h"
+#ifdef X
+#include "h548.h"
+#endif
+struct S6244 { int a; const char *s = "x//y"; };
+inline int f6244_0(int x) { return x * 0; }
+inline int f6244_1(int x) { return x * 1; }
+inline int f6244_2(int x) { return x * 2; }
+inline int f6244_3(int x) { return x * 3; }
+inline int f6244_4(int x) { return x * 4; }
+inline int f6244_5(int x) { return x * 5; }
+inline int f6244_6(int x) { return x * 6; }
+inline int f6244_7(int x) { return x * 7; }
+inline int f6244_8(int x) { return x * 8; }
+inline int f6244_9(int x) { return x * 9; }
+inline int f6244_10(int x) { return x * 10; }
+inline int f6244_11(int x) { return x * 11; }
+inline int f6244_12(int x) { return x * 12; }
+inline int f6244_13(int x) { return x * 13; }
+inline int f6244_14(int x) { return x * 14; }
+inline int f6244_15(int x) { return x * 15; }
+inline int f6244_16(int x) { return x * 16; }
+inline int f6244_17(int x) { return x * 17; }
+inline int f6244_18(int x) { return x * 18; }
+inline int f6244_19(int x) { return x * 19; }
+inline int f6244_20(int x) { return x * 20; }
+inline int f6244_21(int x) { return x * 21; }
+inline int f6244_22(int x) { return x * 22; }
+inline int f6244_23(int x) { return x * 23; }
+inline int f6244_24(int x) { return x * 24; }
+inline int f6244_25(int x) { return x * 25; }
+inline int f6244_26(int x) { return x * 26; }
+inline int f6244_27(int x) { return x * 27; }
+inline int f6244_28(int x) { return x * 28; }
+inline int f6244_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6246 */
+#include <vector>
+#include "h1442.h"
+#include "h6268.h"
+#include "h1682.h"
+#include "h7768.h"
+#include "h7499.h"
+#ifdef X
+#include "h2174.h"
+#endif
+struct S6246 { int a; const char *s = "x//y"; };
+inline int f6246_0(int x) { return x * 0; }
+inline int f6246_1(int x) { return x * 1; }
+inline int f6246_2(int x) { return x * 2; }
+inline int f6246_3(int x) { return x * 3; }
+inline int f6246_4(int x) { return x * 4; }
+inline int f6246_5(int x) { return x * 5; }
+inline int f6246_6(int x) { return x * 6; }
+inline int f6246_7(int x) { return x * 7; }
+inline int f6246_8(int x) { return x * 8; }
+inline int f6246_9(int x) { return x * 9; }
+inline int f6246_10(int x) { return x * 10; }
+inline int f6246_11(int x) { return x * 11; }
+inline int f6246_12(int x) { return x * 12; }
+inline int f6246_13(int x) { return x * 13; }
+inline int f6246_14(int x) { return x * 14; }
+inline int f6246_15(int x) { return x * 15; }
+inline int f6246_16(int x) { return x * 16; }
+inline int f6246_17(int x) { return x * 17; }
+inline int f6246_18(int x) { return x * 18; }
+inline int f6246_19(int x) { return x * 19; }
+inline int f6246_20(int x) { return x * 20; }
+inline int f6246_21(int x) { return x * 21; }
+inline int f6246_22(int x) { return x * 22; }
+inline int f6246_23(int x) { return x * 23; }
+inline int f6246_24(int x) { return x * 24; }
+inline int f6246_25(int x) { return x * 25; }
+inline int f6246_26(int x) { return x * 26; }
+inline int f6246_27(int x) { return x * 27; }
+inline int f6246_28(int x) { return x * 28; }
+inline int f6246_29(int x) { return x * 29; }
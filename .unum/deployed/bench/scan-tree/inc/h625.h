@@ -0,0 +1,42 @@
+#pragma once
+/* header 625 */
+#include <vector>
+#include "h4120.h"
+#include "h7654.h"
+#include "h1444.h"
+#include "h7671.h"
+#include "h8273.h"
+#ifdef X
+#include "h7534.h"
+#endif
+struct S625 { int a; const char *s = "x//y"; };
+inline int f625_0(int x) { return x * 0; }
+inline int f625_1(int x) { return x * 1; }
+inline int f625_2(int x) { return x * 2; }
+inline int f625_3(int x) { return x * 3; }
+inline int f625_4(int x) { return x * 4; }
+inline int f625_5(int x) { return x * 5; }
+inline int f625_6(int x) { return x * 6; }
+inline int f625_7(int x) { return x * 7; }
+inline int f625_8(int x) { return x * 8; }
+inline int f625_9(int x) { return x * 9; }
+inline int f625_10(int x) { return x * 10; }
+inline int f625_11(int x) { return x * 11; }
+inline int f625_12(int x) { return x * 12; }
+inline int f625_13(int x) { return x * 13; }
+inline int f625_14(int x) { return x * 14; }
+inline int f625_15(int x) { return x * 15; }
+inline int f625_16(int x) { return x * 16; }
+inline int f625_17(int x) { return x * 17; }
+inline int f625_18(int x) { return x * 18; }
+inline int f625_19(int x) { return x * 19; }
+inline int f625_20(int x) { return x * 20; }
+inline int f625_21(int x) { return x * 21; }
+inline int f625_22(int x) { return x * 22; }
+inline int f625_23(int x) { return x * 23; }
+inline int f625_24(int x) { return x * 24; }
+inline int f625_25(int x) { return x * 25; }
+inline int f625_26(int x) { return x * 26; }
+inline int f625_27(int x) { return x * 27; }
+inline int f625_28(int x) { return x * 28; }
+inline int f625_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6250 */
+#include <vector>
+#include "h6919.h"
+#include "h7099.h"
+#include "h7541.h"
+#include "h261.h"
+#include "h9249.h"
+#ifdef X
+#include "h5001.h"
+#endif
+struct S6250 { int a; const char *s = "x//y"; };
+inline int f6250_0(int x) { return x * 0; }
+inline int f6250_1(int x) { return x * 1; }
+inline int f6250_2(int x) { return x * 2; }
+inline int f6250_3(int x) { return x * 3; }
+inline int f6250_4(int x) { return x * 4; }
+inline int f6250_5(int x) { return x * 5; }
+inline int f6250_6(int x) { return x * 6; }
+inline int f6250_7(int x) { return x * 7; }
+inline int f6250_8(int x) { return x * 8; }
+inline int f6250_9(int x) { return x * 9; }
+inline int f6250_10(int x) { return x * 10; }
+inline int f6250_11(int x) { return x * 11; }
+inline int f6250_12(int x) { return x * 12; }
+inline int f6250_13(int x) { return x * 13; }
+inline int f6250_14(int x) { return x * 14; }
+inline int f6250_15(int x) { return x * 15; }
+inline int f6250_16(int x) { return x * 16; }
+inline int f6250_17(int x) { return x * 17; }
+inline int f6250_18(int x) { return x * 18; }
+inline int f6250_19(int x) { return x * 19; }
+inline int f6250_20(int x) { return x * 20; }
+inline int f6250_21(int x) { return x * 21; }
+inline int f6250_22(int x) { return x * 22; }
+inline int f6250_23(int x) { return x * 23; }
+inline int f6250_24(int x) { return x * 24; }
+inline int f6250_25(int x) { return x * 25; }
+inline int f6250_26(int x) { return x * 26; }
+inline int f6250_27(int x) { return x * 27; }
+inline int f6250_28(int x) { return x * 28; }
+inline int f6250_29(int x) { return x * 29; }
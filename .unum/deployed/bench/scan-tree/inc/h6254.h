@@ -0,0 +1,42 @@
+#pragma once
+/* header 6254 */
+#include <vector>
+#include "h4898.h"
+#include "h6409.h"
+#include "h5132.h"
+#include "h1931.h"
+#include "h7198.h"
+#ifdef X
+#include "h1010.h"
+#endif
+struct S6254 { int a; const char *s = "x//y"; };
+inline int f6254_0(int x) { return x * 0; }
+inline int f6254_1(int x) { return x * 1; }
+inline int f6254_2(int x) { return x * 2; }
+inline int f6254_3(int x) { return x * 3; }
+inline int f6254_4(int x) { return x * 4; }
+inline int f6254_5(int x) { return x * 5; }
+inline int f6254_6(int x) { return x * 6; }
+inline int f6254_7(int x) { return x * 7; }
+inline int f6254_8(int x) { return x * 8; }
+inline int f6254_9(int x) { return x * 9; }
+inline int f6254_10(int x) { return x * 10; }
+inline int f6254_11(int x) { return x * 11; }
+inline int f6254_12(int x) { return x * 12; }
+inline int f6254_13(int x) { return x * 13; }
+inline int f6254_14(int x) { return x * 14; }
+inline int f6254_15(int x) { return x * 15; }
+inline int f6254_16(int x) { return x * 16; }
+inline int f6254_17(int x) { return x * 17; }
+inline int f6254_18(int x) { return x * 18; }
+inline int f6254_19(int x) { return x * 19; }
+inline int f6254_20(int x) { return x * 20; }
+inline int f6254_21(int x) { return x * 21; }
+inline int f6254_22(int x) { return x * 22; }
+inline int f6254_23(int x) { return x * 23; }
+inline int f6254_24(int x) { return x * 24; }
+inline int f6254_25(int x) { return x * 25; }
+inline int f6254_26(int x) { return x * 26; }
+inline int f6254_27(int x) { return x * 27; }
+inline int f6254_28(int x) { return x * 28; }
+inline int f6254_29(int x) { return x * 29; }
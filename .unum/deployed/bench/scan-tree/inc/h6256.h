@@ -0,0 +1,42 @@
+#pragma once
+/* header 6256 */
+#include <vector>
+#include "h7440.h"
+#include "h8931.h"
+#include "h7489.h"
+#include "h7034.h"
+#include "h5873.h"
+#ifdef X
+#include "h8668.h"
+#endif
+struct S6256 { int a; const char *s = "x//y"; };
+inline int f6256_0(int x) { return x * 0; }
+inline int f6256_1(int x) { return x * 1; }
+inline int f6256_2(int x) { return x * 2; }
+inline int f6256_3(int x) { return x * 3; }
+inline int f6256_4(int x) { return x * 4; }
+inline int f6256_5(int x) { return x * 5; }
+inline int f6256_6(int x) { return x * 6; }
+inline int f6256_7(int x) { return x * 7; }
+inline int f6256_8(int x) { return x * 8; }
+inline int f6256_9(int x) { return x * 9; }
+inline int f6256_10(int x) { return x * 10; }
+inline int f6256_11(int x) { return x * 11; }
+inline int f6256_12(int x) { return x * 12; }
+inline int f6256_13(int x) { return x * 13; }
+inline int f6256_14(int x) { return x * 14; }
+inline int f6256_15(int x) { return x * 15; }
+inline int f6256_16(int x) { return x * 16; }
+inline int f6256_17(int x) { return x * 17; }
+inline int f6256_18(int x) { return x * 18; }
+inline int f6256_19(int x) { return x * 19; }
+inline int f6256_20(int x) { return x * 20; }
+inline int f6256_21(int x) { return x * 21; }
+inline int f6256_22(int x) { return x * 22; }
+inline int f6256_23(int x) { return x * 23; }
+inline int f6256_24(int x) { return x * 24; }
+inline int f6256_25(int x) { return x * 25; }
+inline int f6256_26(int x) { return x * 26; }
+inline int f6256_27(int x) { return x * 27; }
+inline int f6256_28(int x) { return x * 28; }
+inline int f6256_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6260 */
+#include <vector>
+#include "h6496.h"
+#include "h5670.h"
+#include "h1568.h"
+#include "h346.h"
+#include "h658.h"
+#ifdef X
+#include "h876.h"
+#endif
+struct S6260 { int a; const char *s = "x//y"; };
+inline int f6260_0(int x) { return x * 0; }
+inline int f6260_1(int x) { return x * 1; }
+inline int f6260_2(int x) { return x * 2; }
+inline int f6260_3(int x) { return x * 3; }
+inline int f6260_4(int x) { return x * 4; }
+inline int f6260_5(int x) { return x * 5; }
+inline int f6260_6(int x) { return x * 6; }
+inline int f6260_7(int x) { return x * 7; }
+inline int f6260_8(int x) { return x * 8; }
+inline int f6260_9(int x) { return x * 9; }
+inline int f6260_10(int x) { return x * 10; }
+inline int f6260_11(int x) { return x * 11; }
+inline int f6260_12(int x) { return x * 12; }
+inline int f6260_13(int x) { return x * 13; }
+inline int f6260_14(int x) { return x * 14; }
+inline int f6260_15(int x) { return x * 15; }
+inline int f6260_16(int x) { return x * 16; }
+inline int f6260_17(int x) { return x * 17; }
+inline int f6260_18(int x) { return x * 18; }
+inline int f6260_19(int x) { return x * 19; }
+inline int f6260_20(int x) { return x * 20; }
+inline int f6260_21(int x) { return x * 21; }
+inline int f6260_22(int x) { return x * 22; }
+inline int f6260_23(int x) { return x * 23; }
+inline int f6260_24(int x) { return x * 24; }
+inline int f6260_25(int x) { return x * 25; }
+inline int f6260_26(int x) { return x * 26; }
+inline int f6260_27(int x) { return x * 27; }
+inline int f6260_28(int x) { return x * 28; }
+inline int f6260_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6264 */
+#include <vector>
+#include "h307.h"
+#include "h7703.h"
+#include "h1648.h"
+#include "h5990.h"
+#include "h9444.h"
+#ifdef X
+#include "h6163.h"
+#endif
+struct S6264 { int a; const char *s = "x//y"; };
+inline int f6264_0(int x) { return x * 0; }
+inline int f6264_1(int x) { return x * 1; }
+inline int f6264_2(int x) { return x * 2; }
+inline int f6264_3(int x) { return x * 3; }
+inline int f6264_4(int x) { return x * 4; }
+inline int f6264_5(int x) { return x * 5; }
+inline int f6264_6(int x) { return x * 6; }
+inline int f6264_7(int x) { return x * 7; }
+inline int f6264_8(int x) { return x * 8; }
+inline int f6264_9(int x) { return x * 9; }
+inline int f6264_10(int x) { return x * 10; }
+inline int f6264_11(int x) { return x * 11; }
+inline int f6264_12(int x) { return x * 12; }
+inline int f6264_13(int x) { return x * 13; }
+inline int f6264_14(int x) { return x * 14; }
+inline int f6264_15(int x) { return x * 15; }
+inline int f6264_16(int x) { return x * 16; }
+inline int f6264_17(int x) { return x * 17; }
+inline int f6264_18(int x) { return x * 18; }
+inline int f6264_19(int x) { return x * 19; }
+inline int f6264_20(int x) { return x * 20; }
+inline int f6264_21(int x) { return x * 21; }
+inline int f6264_22(int x) { return x * 22; }
+inline int f6264_23(int x) { return x * 23; }
+inline int f6264_24(int x) { return x * 24; }
+inline int f6264_25(int x) { return x * 25; }
+inline int f6264_26(int x) { return x * 26; }
+inline int f6264_27(int x) { return x * 27; }
+inline int f6264_28(int x) { return x * 28; }
+inline int f6264_29(int x) { return x * 29; }
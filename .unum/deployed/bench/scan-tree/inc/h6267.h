@@ -0,0 +1,42 @@
+#pragma once
+/* header 6267 */
+#include <vector>
+#include "h1009.h"
+#include "h9239.h"
+#include "h3476.h"
+#include "h2516.h"
+#include "h3393.h"
+#ifdef X
+#include "h8657.h"
+#endif
+struct S6267 { int a; const char *s = "x//y"; };
+inline int f6267_0(int x) { return x * 0; }
+inline int f6267_1(int x) { return x * 1; }
+inline int f6267_2(int x) { return x * 2; }
+inline int f6267_3(int x) { return x * 3; }
+inline int f6267_4(int x) { return x * 4; }
+inline int f6267_5(int x) { return x * 5; }
+inline int f6267_6(int x) { return x * 6; }
+inline int f6267_7(int x) { return x * 7; }
+inline int f6267_8(int x) { return x * 8; }
+inline int f6267_9(int x) { return x * 9; }
+inline int f6267_10(int x) { return x * 10; }
+inline int f6267_11(int x) { return x * 11; }
+inline int f6267_12(int x) { return x * 12; }
+inline int f6267_13(int x) { return x * 13; }
+inline int f6267_14(int x) { return x * 14; }
+inline int f6267_15(int x) { return x * 15; }
+inline int f6267_16(int x) { return x * 16; }
+inline int f6267_17(int x) { return x * 17; }
+inline int f6267_18(int x) { return x * 18; }
+inline int f6267_19(int x) { return x * 19; }
+inline int f6267_20(int x) { return x * 20; }
+inline int f6267_21(int x) { return x * 21; }
+inline int f6267_22(int x) { return x * 22; }
+inline int f6267_23(int x) { return x * 23; }
+inline int f6267_24(int x) { return x * 24; }
+inline int f6267_25(int x) { return x * 25; }
+inline int f6267_26(int x) { return x * 26; }
+inline int f6267_27(int x) { return x * 27; }
+inline int f6267_28(int x) { return x * 28; }
+inline int f6267_29(int x) { return x * 29; }
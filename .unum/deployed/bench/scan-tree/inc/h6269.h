@@ -0,0 +1,42 @@
+#pragma once
+/* header 6269 */
+#include <vector>
+#include "h6379.h"
+#include "h9020.h"
+#include "h882.h"
+#include "h4246.h"
+#include "h1992.h"
+#ifdef X
+#include "h6652.h"
+#endif
+struct S6269 { int a; const char *s = "x//y"; };
+inline int f6269_0(int x) { return x * 0; }
+inline int f6269_1(int x) { return x * 1; }
+inline int f6269_2(int x) { return x * 2; }
+inline int f6269_3(int x) { return x * 3; }
+inline int f6269_4(int x) { return x * 4; }
+inline int f6269_5(int x) { return x * 5; }
+inline int f6269_6(int x) { return x * 6; }
+inline int f6269_7(int x) { return x * 7; }
+inline int f6269_8(int x) { return x * 8; }
+inline int f6269_9(int x) { return x * 9; }
+inline int f6269_10(int x) { return x * 10; }
+inline int f6269_11(int x) { return x * 11; }
+inline int f6269_12(int x) { return x * 12; }
+inline int f6269_13(int x) { return x * 13; }
+inline int f6269_14(int x) { return x * 14; }
+inline int f6269_15(int x) { return x * 15; }
+inline int f6269_16(int x) { return x * 16; }
+inline int f6269_17(int x) { return x * 17; }
+inline int f6269_18(int x) { return x * 18; }
+inline int f6269_19(int x) { return x * 19; }
+inline int f6269_20(int x) { return x * 20; }
+inline int f6269_21(int x) { return x * 21; }
+inline int f6269_22(int x) { return x * 22; }
+inline int f6269_23(int x) { return x * 23; }
+inline int f6269_24(int x) { return x * 24; }
+inline int f6269_25(int x) { return x * 25; }
+inline int f6269_26(int x) { return x * 26; }
+inline int f6269_27(int x) { return x * 27; }
+inline int f6269_28(int x) { return x * 28; }
+inline int f6269_29(int x) { return x * 29; }
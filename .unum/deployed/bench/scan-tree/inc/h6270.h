@@ -0,0 +1,42 @@
+#pragma once
+/* header 6270 */
+#include <vector>
+#include "h4237.h"
+#include "h4674.h"
+#include "h3114.h"
+#include "h6766.h"
+#include "h5506.h"
+#ifdef X
+#include "h4916.h"
+#endif
+struct S6270 { int a; const char *s = "x//y"; };
+inline int f6270_0(int x) { return x * 0; }
+inline int f6270_1(int x) { return x * 1; }
+inline int f6270_2(int x) { return x * 2; }
+inline int f6270_3(int x) { return x * 3; }
+inline int f6270_4(int x) { return x * 4; }
+inline int f6270_5(int x) { return x * 5; }
+inline int f6270_6(int x) { return x * 6; }
+inline int f6270_7(int x) { return x * 7; }
+inline int f6270_8(int x) { return x * 8; }
+inline int f6270_9(int x) { return x * 9; }
+inline int f6270_10(int x) { return x * 10; }
+inline int f6270_11(int x) { return x * 11; }
+inline int f6270_12(int x) { return x * 12; }
+inline int f6270_13(int x) { return x * 13; }
+inline int f6270_14(int x) { return x * 14; }
+inline int f6270_15(int x) { return x * 15; }
+inline int f6270_16(int x) { return x * 16; }
+inline int f6270_17(int x) { return x * 17; }
+inline int f6270_18(int x) { return x * 18; }
+inline int f6270_19(int x) { return x * 19; }
+inline int f6270_20(int x) { return x * 20; }
+inline int f6270_21(int x) { return x * 21; }
+inline int f6270_22(int x) { return x * 22; }
+inline int f6270_23(int x) { return x * 23; }
+inline int f6270_24(int x) { return x * 24; }
+inline int f6270_25(int x) { return x * 25; }
+inline int f6270_26(int x) { return x * 26; }
+inline int f6270_27(int x) { return x * 27; }
+inline int f6270_28(int x) { return x * 28; }
+inline int f6270_29(int x) { return x * 29; }
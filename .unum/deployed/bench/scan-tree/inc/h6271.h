@@ -0,0 +1,42 @@
+#pragma once
+/* header 6271 */
+#include <vector>
+#include "h8255.h"
+#include "h3367.h"
+#include "h8129.h"
+#include "h2476.h"
+#include "h2641.h"
+#ifdef X
+#include "h6852.h"
+#endif
+struct S6271 { int a; const char *s = "x//y"; };
+inline int f6271_0(int x) { return x * 0; }
+inline int f6271_1(int x) { return x * 1; }
+inline int f6271_2(int x) { return x * 2; }
+inline int f6271_3(int x) { return x * 3; }
+inline int f6271_4(int x) { return x * 4; }
+inline int f6271_5(int x) { return x * 5; }
+inline int f6271_6(int x) { return x * 6; }
+inline int f6271_7(int x) { return x * 7; }
+inline int f6271_8(int x) { return x * 8; }
+inline int f6271_9(int x) { return x * 9; }
+inline int f6271_10(int x) { return x * 10; }
+inline int f6271_11(int x) { return x * 11; }
+inline int f6271_12(int x) { return x * 12; }
+inline int f6271_13(int x) { return x * 13; }
+inline int f6271_14(int x) { return x * 14; }
+inline int f6271_15(int x) { return x * 15; }
+inline int f6271_16(int x) { return x * 16; }
+inline int f6271_17(int x) { return x * 17; }
+inline int f6271_18(int x) { return x * 18; }
+inline int f6271_19(int x) { return x * 19; }
+inline int f6271_20(int x) { return x * 20; }
+inline int f6271_21(int x) { return x * 21; }
+inline int f6271_22(int x) { return x * 22; }
+inline int f6271_23(int x) { return x * 23; }
+inline int f6271_24(int x) { return x * 24; }
+inline int f6271_25(int x) { return x * 25; }
+inline int f6271_26(int x) { return x * 26; }
+inline int f6271_27(int x) { return x * 27; }
+inline int f6271_28(int x) { return x * 28; }
+inline int f6271_29(int x) { return x * 29; }
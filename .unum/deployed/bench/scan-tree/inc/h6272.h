@@ -0,0 +1,42 @@
+#pragma once
+/* header 6272 */
+#include <vector>
+#include "h4238.h"
+#include "h400.h"
+#include "h6565.h"
+#include "h8963.h"
+#include "h2346.h"
+#ifdef X
+#include "h6387.h"
+#endif
+struct S6272 { int a; const char *s = "x//y"; };
+inline int f6272_0(int x) { return x * 0; }
+inline int f6272_1(int x) { return x * 1; }
+inline int f6272_2(int x) { return x * 2; }
+inline int f6272_3(int x) { return x * 3; }
+inline int f6272_4(int x) { return x * 4; }
+inline int f6272_5(int x) { return x * 5; }
+inline int f6272_6(int x) { return x * 6; }
+inline int f6272_7(int x) { return x * 7; }
+inline int f6272_8(int x) { return x * 8; }
+inline int f6272_9(int x) { return x * 9; }
+inline int f6272_10(int x) { return x * 10; }
+inline int f6272_11(int x) { return x * 11; }
+inline int f6272_12(int x) { return x * 12; }
+inline int f6272_13(int x) { return x * 13; }
+inline int f6272_14(int x) { return x * 14; }
+inline int f6272_15(int x) { return x * 15; }
+inline int f6272_16(int x) { return x * 16; }
+inline int f6272_17(int x) { return x * 17; }
+inline int f6272_18(int x) { return x * 18; }
+inline int f6272_19(int x) { return x * 19; }
+inline int f6272_20(int x) { return x * 20; }
+inline int f6272_21(int x) { return x * 21; }
+inline int f6272_22(int x) { return x * 22; }
+inline int f6272_23(int x) { return x * 23; }
+inline int f6272_24(int x) { return x * 24; }
+inline int f6272_25(int x) { return x * 25; }
+inline int f6272_26(int x) { return x * 26; }
+inline int f6272_27(int x) { return x * 27; }
+inline int f6272_28(int x) { return x * 28; }
+inline int f6272_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6273 */
+#include <vector>
+#include "h1572.h"
+#include "h5699.h"
+#include "h2414.h"
+#include "h5512.h"
+#include "h7306.h"
+#ifdef X
+#include "h2397.h"
+#endif
+struct S6273 { int a; const char *s = "x//y"; };
+inline int f6273_0(int x) { return x * 0; }
+inline int f6273_1(int x) { return x * 1; }
+inline int f6273_2(int x) { return x * 2; }
+inline int f6273_3(int x) { return x * 3; }
+inline int f6273_4(int x) { return x * 4; }
+inline int f6273_5(int x) { return x * 5; }
+inline int f6273_6(int x) { return x * 6; }
+inline int f6273_7(int x) { return x * 7; }
+inline int f6273_8(int x) { return x * 8; }
+inline int f6273_9(int x) { return x * 9; }
+inline int f6273_10(int x) { return x * 10; }
+inline int f6273_11(int x) { return x * 11; }
+inline int f6273_12(int x) { return x * 12; }
+inline int f6273_13(int x) { return x * 13; }
+inline int f6273_14(int x) { return x * 14; }
+inline int f6273_15(int x) { return x * 15; }
+inline int f6273_16(int x) { return x * 16; }
+inline int f6273_17(int x) { return x * 17; }
+inline int f6273_18(int x) { return x * 18; }
+inline int f6273_19(int x) { return x * 19; }
+inline int f6273_20(int x) { return x * 20; }
+inline int f6273_21(int x) { return x * 21; }
+inline int f6273_22(int x) { return x * 22; }
+inline int f6273_23(int x) { return x * 23; }
+inline int f6273_24(int x) { return x * 24; }
+inline int f6273_25(int x) { return x * 25; }
+inline int f6273_26(int x) { return x * 26; }
+inline int f6273_27(int x) { return x * 27; }
+inline int f6273_28(int x) { return x * 28; }
+inline int f6273_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6274 */
+#include <vector>
+#include "h7062.h"
+#include "h9636.h"
+#include "h6868.h"
+#include "h7452.h"
+#include "h8856.h"
+#ifdef X
+#include "h988.h"
+#endif
+struct S6274 { int a; const char *s = "x//y"; };
+inline int f6274_0(int x) { return x * 0; }
+inline int f6274_1(int x) { return x * 1; }
+inline int f6274_2(int x) { return x * 2; }
+inline int f6274_3(int x) { return x * 3; }
+inline int f6274_4(int x) { return x * 4; }
+inline int f6274_5(int x) { return x * 5; }
+inline int f6274_6(int x) { return x * 6; }
+inline int f6274_7(int x) { return x * 7; }
+inline int f6274_8(int x) { return x * 8; }
+inline int f6274_9(int x) { return x * 9; }
+inline int f6274_10(int x) { return x * 10; }
+inline int f6274_11(int x) { return x * 11; }
+inline int f6274_12(int x) { return x * 12; }
+inline int f6274_13(int x) { return x * 13; }
+inline int f6274_14(int x) { return x * 14; }
+inline int f6274_15(int x) { return x * 15; }
+inline int f6274_16(int x) { return x * 16; }
+inline int f6274_17(int x) { return x * 17; }
+inline int f6274_18(int x) { return x * 18; }
+inline int f6274_19(int x) { return x * 19; }
+inline int f6274_20(int x) { return x * 20; }
+inline int f6274_21(int x) { return x * 21; }
+inline int f6274_22(int x) { return x * 22; }
+inline int f6274_23(int x) { return x * 23; }
+inline int f6274_24(int x) { return x * 24; }
+inline int f6274_25(int x) { return x * 25; }
+inline int f6274_26(int x) { return x * 26; }
+inline int f6274_27(int x) { return x * 27; }
+inline int f6274_28(int x) { return x * 28; }
+inline int f6274_29(int x) { return x * 29; }
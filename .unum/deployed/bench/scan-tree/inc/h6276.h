@@ -0,0 +1,42 @@
+#pragma once
+/* header 6276 */
+#include <vector>
+#include "h2531.h"
+#include "h8951.h"
+#include "h4984.h"
+#include "h6909.h"
+#include "h7402.h"
+#ifdef X
+#include "h5366.h"
+#endif
+struct S6276 { int a; const char *s = "x//y"; };
+inline int f6276_0(int x) { return x * 0; }
+inline int f6276_1(int x) { return x * 1; }
+inline int f6276_2(int x) { return x * 2; }
+inline int f6276_3(int x) { return x * 3; }
+inline int f6276_4(int x) { return x * 4; }
+inline int f6276_5(int x) { return x * 5; }
+inline int f6276_6(int x) { return x * 6; }
+inline int f6276_7(int x) { return x * 7; }
+inline int f6276_8(int x) { return x * 8; }
+inline int f6276_9(int x) { return x * 9; }
+inline int f6276_10(int x) { return x * 10; }
+inline int f6276_11(int x) { return x * 11; }
+inline int f6276_12(int x) { return x * 12; }
+inline int f6276_13(int x) { return x * 13; }
+inline int f6276_14(int x) { return x * 14; }
+inline int f6276_15(int x) { return x * 15; }
+inline int f6276_16(int x) { return x * 16; }
+inline int f6276_17(int x) { return x * 17; }
+inline int f6276_18(int x) { return x * 18; }
+inline int f6276_19(int x) { return x * 19; }
+inline int f6276_20(int x) { return x * 20; }
+inline int f6276_21(int x) { return x * 21; }
+inline int f6276_22(int x) { return x * 22; }
+inline int f6276_23(int x) { return x * 23; }
+inline int f6276_24(int x) { return x * 24; }
+inline int f6276_25(int x) { return x * 25; }
+inline int f6276_26(int x) { return x * 26; }
+inline int f6276_27(int x) { return x * 27; }
+inline int f6276_28(int x) { return x * 28; }
+inline int f6276_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6278 */
+#include <vector>
+#include "h8107.h"
+#include "h7738.h"
+#include "h8903.h"
+#include "h7921.h"
+#include "h5229.h"
+#ifdef X
+#include "h5111.h"
+#endif
+struct S6278 { int a; const char *s = "x//y"; };
+inline int f6278_0(int x) { return x * 0; }
+inline int f6278_1(int x) { return x * 1; }
+inline int f6278_2(int x) { return x * 2; }
+inline int f6278_3(int x) { return x * 3; }
+inline int f6278_4(int x) { return x * 4; }
+inline int f6278_5(int x) { return x * 5; }
+inline int f6278_6(int x) { return x * 6; }
+inline int f6278_7(int x) { return x * 7; }
+inline int f6278_8(int x) { return x * 8; }
+inline int f6278_9(int x) { return x * 9; }
+inline int f6278_10(int x) { return x * 10; }
+inline int f6278_11(int x) { return x * 11; }
+inline int f6278_12(int x) { return x * 12; }
+inline int f6278_13(int x) { return x * 13; }
+inline int f6278_14(int x) { return x * 14; }
+inline int f6278_15(int x) { return x * 15; }
+inline int f6278_16(int x) { return x * 16; }
+inline int f6278_17(int x) { return x * 17; }
+inline int f6278_18(int x) { return x * 18; }
+inline int f6278_19(int x) { return x * 19; }
+inline int f6278_20(int x) { return x * 20; }
+inline int f6278_21(int x) { return x * 21; }
+inline int f6278_22(int x) { return x * 22; }
+inline int f6278_23(int x) { return x * 23; }
+inline int f6278_24(int x) { return x * 24; }
+inline int f6278_25(int x) { return x * 25; }
+inline int f6278_26(int x) { return x * 26; }
+inline int f6278_27(int x) { return x * 27; }
+inline int f6278_28(int x) { return x * 28; }
+inline int f6278_29(int x) { return x * 29; }
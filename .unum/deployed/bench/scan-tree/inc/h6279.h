@@ -0,0 +1,42 @@
+#pragma once
+/* header 6279 */
+#include <vector>
+#include "h9031.h"
+#include "h455.h"
+#include "h9461.h"
+#include "h8710.h"
+#include "h1203.h"
+#ifdef X
+#include "h9620.h"
+#endif
+struct S6279 { int a; const char *s = "x//y"; };
+inline int f6279_0(int x) { return x * 0; }
+inline int f6279_1(int x) { return x * 1; }
+inline int f6279_2(int x) { return x * 2; }
+inline int f6279_3(int x) { return x * 3; }
+inline int f6279_4(int x) { return x * 4; }
+inline int f6279_5(int x) { return x * 5; }
+inline int f6279_6(int x) { return x * 6; }
+inline int f6279_7(int x) { return x * 7; }
+inline int f6279_8(int x) { return x * 8; }
+inline int f6279_9(int x) { return x * 9; }
+inline int f6279_10(int x) { return x * 10; }
+inline int f6279_11(int x) { return x * 11; }
+inline int f6279_12(int x) { return x * 12; }
+inline int f6279_13(int x) { return x * 13; }
+inline int f6279_14(int x) { return x * 14; }
+inline int f6279_15(int x) { return x * 15; }
+inline int f6279_16(int x) { return x * 16; }
+inline int f6279_17(int x) { return x * 17; }
+inline int f6279_18(int x) { return x * 18; }
+inline int f6279_19(int x) { return x * 19; }
+inline int f6279_20(int x) { return x * 20; }
+inline int f6279_21(int x) { return x * 21; }
+inline int f6279_22(int x) { return x * 22; }
+inline int f6279_23(int x) { return x * 23; }
+inline int f6279_24(int x) { return x * 24; }
+inline int f6279_25(int x) { return x * 25; }
+inline int f6279_26(int x) { return x * 26; }
+inline int f6279_27(int x) { return x * 27; }
+inline int f6279_28(int x) { return x * 28; }
+inline int f6279_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 628 */
+#include <vector>
+#include "h754.h"
+#include "h6405.h"
+#include "h9688.h"
+#include "h5516.h"
+#include "h1545.h"
+#ifdef X
+#include "h7951.h"
+#endif
+struct S628 { int a; const char *s = "x//y"; };
+inline int f628_0(int x) { return x * 0; }
+inline int f628_1(int x) { return x * 1; }
+inline int f628_2(int x) { return x * 2; }
+inline int f628_3(int x) { return x * 3; }
+inline int f628_4(int x) { return x * 4; }
+inline int f628_5(int x) { return x * 5; }
+inline int f628_6(int x) { return x * 6; }
+inline int f628_7(int x) { return x * 7; }
+inline int f628_8(int x) { return x * 8; }
+inline int f628_9(int x) { return x * 9; }
+inline int f628_10(int x) { return x * 10; }
+inline int f628_11(int x) { return x * 11; }
+inline int f628_12(int x) { return x * 12; }
+inline int f628_13(int x) { return x * 13; }
+inline int f628_14(int x) { return x * 14; }
+inline int f628_15(int x) { return x * 15; }
+inline int f628_16(int x) { return x * 16; }
+inline int f628_17(int x) { return x * 17; }
+inline int f628_18(int x) { return x * 18; }
+inline int f628_19(int x) { return x * 19; }
+inline int f628_20(int x) { return x * 20; }
+inline int f628_21(int x) { return x * 21; }
+inline int f628_22(int x) { return x * 22; }
+inline int f628_23(int x) { return x * 23; }
+inline int f628_24(int x) { return x * 24; }
+inline int f628_25(int x) { return x * 25; }
+inline int f628_26(int x) { return x * 26; }
+inline int f628_27(int x) { return x * 27; }
+inline int f628_28(int x) { return x * 28; }
+inline int f628_29(int x) { return x * 29; }
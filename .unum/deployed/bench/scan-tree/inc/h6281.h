@@ -0,0 +1,42 @@
+#pragma once
+/* header 6281 */
+#include <vector>
+#include "h8094.h"
+#include "h5397.h"
+#include "h8030.h"
+#include "h5773.h"
+#include "h9786.h"
+#ifdef X
+#include "h6732.h"
+#endif
+struct S6281 { int a; const char *s = "x//y"; };
+inline int f6281_0(int x) { return x * 0; }
+inline int f6281_1(int x) { return x * 1; }
+inline int f6281_2(int x) { return x * 2; }
+inline int f6281_3(int x) { return x * 3; }
+inline int f6281_4(int x) { return x * 4; }
+inline int f6281_5(int x) { return x * 5; }
+inline int f6281_6(int x) { return x * 6; }
+inline int f6281_7(int x) { return x * 7; }
+inline int f6281_8(int x) { return x * 8; }
+inline int f6281_9(int x) { return x * 9; }
+inline int f6281_10(int x) { return x * 10; }
+inline int f6281_11(int x) { return x * 11; }
+inline int f6281_12(int x) { return x * 12; }
+inline int f6281_13(int x) { return x * 13; }
+inline int f6281_14(int x) { return x * 14; }
+inline int f6281_15(int x) { return x * 15; }
+inline int f6281_16(int x) { return x * 16; }
+inline int f6281_17(int x) { return x * 17; }
+inline int f6281_18(int x) { return x * 18; }
+inline int f6281_19(int x) { return x * 19; }
+inline int f6281_20(int x) { return x * 20; }
+inline int f6281_21(int x) { return x * 21; }
+inline int f6281_22(int x) { return x * 22; }
+inline int f6281_23(int x) { return x * 23; }
+inline int f6281_24(int x) { return x * 24; }
+inline int f6281_25(int x) { return x * 25; }
+inline int f6281_26(int x) { return x * 26; }
+inline int f6281_27(int x) { return x * 27; }
+inline int f6281_28(int x) { return x * 28; }
+inline int f6281_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6283 */
+#include <vector>
+#include "h9818.h"
+#include "h7629.h"
+#include "h3125.h"
+#include "h7234.h"
+#include "h6398.h"
+#ifdef X
+#include "h2016.h"
+#endif
+struct S6283 { int a; const char *s = "x//y"; };
+inline int f6283_0(int x) { return x * 0; }
+inline int f6283_1(int x) { return x * 1; }
+inline int f6283_2(int x) { return x * 2; }
+inline int f6283_3(int x) { return x * 3; }
+inline int f6283_4(int x) { return x * 4; }
+inline int f6283_5(int x) { return x * 5; }
+inline int f6283_6(int x) { return x * 6; }
+inline int f6283_7(int x) { return x * 7; }
+inline int f6283_8(int x) { return x * 8; }
+inline int f6283_9(int x) { return x * 9; }
+inline int f6283_10(int x) { return x * 10; }
+inline int f6283_11(int x) { return x * 11; }
+inline int f6283_12(int x) { return x * 12; }
+inline int f6283_13(int x) { return x * 13; }
+inline int f6283_14(int x) { return x * 14; }
+inline int f6283_15(int x) { return x * 15; }
+inline int f6283_16(int x) { return x * 16; }
+inline int f6283_17(int x) { return x * 17; }
+inline int f6283_18(int x) { return x * 18; }
+inline int f6283_19(int x) { return x * 19; }
+inline int f6283_20(int x) { return x * 20; }
+inline int f6283_21(int x) { return x * 21; }
+inline int f6283_22(int x) { return x * 22; }
+inline int f6283_23(int x) { return x * 23; }
+inline int f6283_24(int x) { return x * 24; }
+inline int f6283_25(int x) { return x * 25; }
+inline int f6283_26(int x) { return x * 26; }
+inline int f6283_27(int x) { return x * 27; }
+inline int f6283_28(int x) { return x * 28; }
+inline int f6283_29(int x) { return x * 29; }
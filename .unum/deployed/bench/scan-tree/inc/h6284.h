@@ -0,0 +1,42 @@
+#pragma once
+/* header 6284 */
+#include <vector>
+#include "h1921.h"
+#include "h5952.h"
+#include "h4610.h"
+#include "h8857.h"
+#include "h8520.h"
+#ifdef X
+#include "h5622.h"
+#endif
+struct S6284 { int a; const char *s = "x//y"; };
+inline int f6284_0(int x) { return x * 0; }
+inline int f6284_1(int x) { return x * 1; }
+inline int f6284_2(int x) { return x * 2; }
+inline int f6284_3(int x) { return x * 3; }
+inline int f6284_4(int x) { return x * 4; }
+inline int f6284_5(int x) { return x * 5; }
+inline int f6284_6(int x) { return x * 6; }
+inline int f6284_7(int x) { return x * 7; }
+inline int f6284_8(int x) { return x * 8; }
+inline int f6284_9(int x) { return x * 9; }
+inline int f6284_10(int x) { return x * 10; }
+inline int f6284_11(int x) { return x * 11; }
+inline int f6284_12(int x) { return x * 12; }
+inline int f6284_13(int x) { return x * 13; }
+inline int f6284_14(int x) { return x * 14; }
+inline int f6284_15(int x) { return x * 15; }
+inline int f6284_16(int x) { return x * 16; }
+inline int f6284_17(int x) { return x * 17; }
+inline int f6284_18(int x) { return x * 18; }
+inline int f6284_19(int x) { return x * 19; }
+inline int f6284_20(int x) { return x * 20; }
+inline int f6284_21(int x) { return x * 21; }
+inline int f6284_22(int x) { return x * 22; }
+inline int f6284_23(int x) { return x * 23; }
+inline int f6284_24(int x) { return x * 24; }
+inline int f6284_25(int x) { return x * 25; }
+inline int f6284_26(int x) { return x * 26; }
+inline int f6284_27(int x) { return x * 27; }
+inline int f6284_28(int x) { return x * 28; }
+inline int f6284_29(int x) { return x * 29; }
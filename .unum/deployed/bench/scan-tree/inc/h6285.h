@@ -0,0 +1,42 @@
+#pragma once
+/* header 6285 */
+#include <vector>
+#include "h3737.h"
+#include "h5884.h"
+#include "h3430.h"
+#include "h3642.h"
+#include "h8044.h"
+#ifdef X
+#include "h8623.h"
+#endif
+struct S6285 { int a; const char *s = "x//y"; };
+inline int f6285_0(int x) { return x * 0; }
+inline int f6285_1(int x) { return x * 1; }
+inline int f6285_2(int x) { return x * 2; }
+inline int f6285_3(int x) { return x * 3; }
+inline int f6285_4(int x) { return x * 4; }
+inline int f6285_5(int x) { return x * 5; }
+inline int f6285_6(int x) { return x * 6; }
+inline int f6285_7(int x) { return x * 7; }
+inline int f6285_8(int x) { return x * 8; }
+inline int f6285_9(int x) { return x * 9; }
+inline int f6285_10(int x) { return x * 10; }
+inline int f6285_11(int x) { return x * 11; }
+inline int f6285_12(int x) { return x * 12; }
+inline int f6285_13(int x) { return x * 13; }
+inline int f6285_14(int x) { return x * 14; }
+inline int f6285_15(int x) { return x * 15; }
+inline int f6285_16(int x) { return x * 16; }
+inline int f6285_17(int x) { return x * 17; }
+inline int f6285_18(int x) { return x * 18; }
+inline int f6285_19(int x) { return x * 19; }
+inline int f6285_20(int x) { return x * 20; }
+inline int f6285_21(int x) { return x * 21; }
+inline int f6285_22(int x) { return x * 22; }
+inline int f6285_23(int x) { return x * 23; }
+inline int f6285_24(int x) { return x * 24; }
+inline int f6285_25(int x) { return x * 25; }
+inline int f6285_26(int x) { return x * 26; }
+inline int f6285_27(int x) { return x * 27; }
+inline int f6285_28(int x) { return x * 28; }
+inline int f6285_29(int x) { return x * 29; }
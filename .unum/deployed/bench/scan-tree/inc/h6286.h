@@ -0,0 +1,42 @@
+#pragma once
+/* header 6286 */
+#include <vector>
+#include "h2469.h"
+#include "h7768.h"
+#include "h4211.h"
+#include "h6426.h"
+#include "h5515.h"
+#ifdef X
+#include "h3709.h"
+#endif
+struct S6286 { int a; const char *s = "x//y"; };
+inline int f6286_0(int x) { return x * 0; }
+inline int f6286_1(int x) { return x * 1; }
+inline int f6286_2(int x) { return x * 2; }
+inline int f6286_3(int x) { return x * 3; }
+inline int f6286_4(int x) { return x * 4; }
+inline int f6286_5(int x) { return x * 5; }
+inline int f6286_6(int x) { return x * 6; }
+inline int f6286_7(int x) { return x * 7; }
+inline int f6286_8(int x) { return x * 8; }
+inline int f6286_9(int x) { return x * 9; }
+inline int f6286_10(int x) { return x * 10; }
+inline int f6286_11(int x) { return x * 11; }
+inline int f6286_12(int x) { return x * 12; }
+inline int f6286_13(int x) { return x * 13; }
+inline int f6286_14(int x) { return x * 14; }
+inline int f6286_15(int x) { return x * 15; }
+inline int f6286_16(int x) { return x * 16; }
+inline int f6286_17(int x) { return x * 17; }
+inline int f6286_18(int x) { return x * 18; }
+inline int f6286_19(int x) { return x * 19; }
+inline int f6286_20(int x) { return x * 20; }
+inline int f6286_21(int x) { return x * 21; }
+inline int f6286_22(int x) { return x * 22; }
+inline int f6286_23(int x) { return x * 23; }
+inline int f6286_24(int x) { return x * 24; }
+inline int f6286_25(int x) { return x * 25; }
+inline int f6286_26(int x) { return x * 26; }
+inline int f6286_27(int x) { return x * 27; }
+inline int f6286_28(int x) { return x * 28; }
+inline int f6286_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6288 */
+#include <vector>
+#include "h8715.h"
+#include "h9323.h"
+#include "h4387.h"
+#include "h2458.h"
+#include "h1710.h"
+#ifdef X
+#include "h8607.h"
+#endif
+struct S6288 { int a; const char *s = "x//y"; };
+inline int f6288_0(int x) { return x * 0; }
+inline int f6288_1(int x) { return x * 1; }
+inline int f6288_2(int x) { return x * 2; }
+inline int f6288_3(int x) { return x * 3; }
+inline int f6288_4(int x) { return x * 4; }
+inline int f6288_5(int x) { return x * 5; }
+inline int f6288_6(int x) { return x * 6; }
+inline int f6288_7(int x) { return x * 7; }
+inline int f6288_8(int x) { return x * 8; }
+inline int f6288_9(int x) { return x * 9; }
+inline int f6288_10(int x) { return x * 10; }
+inline int f6288_11(int x) { return x * 11; }
+inline int f6288_12(int x) { return x * 12; }
+inline int f6288_13(int x) { return x * 13; }
+inline int f6288_14(int x) { return x * 14; }
+inline int f6288_15(int x) { return x * 15; }
+inline int f6288_16(int x) { return x * 16; }
+inline int f6288_17(int x) { return x * 17; }
+inline int f6288_18(int x) { return x * 18; }
+inline int f6288_19(int x) { return x * 19; }
+inline int f6288_20(int x) { return x * 20; }
+inline int f6288_21(int x) { return x * 21; }
+inline int f6288_22(int x) { return x * 22; }
+inline int f6288_23(int x) { return x * 23; }
+inline int f6288_24(int x) { return x * 24; }
+inline int f6288_25(int x) { return x * 25; }
+inline int f6288_26(int x) { return x * 26; }
+inline int f6288_27(int x) { return x * 27; }
+inline int f6288_28(int x) { return x * 28; }
+inline int f6288_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 629 */
+#include <vector>
+#include "h7942.h"
+#include "h4733.h"
+#include "h9563.h"
+#include "h6889.h"
+#include "h5347.h"
+#ifdef X
+#include "h7164.h"
+#endif
+struct S629 { int a; const char *s = "x//y"; };
+inline int f629_0(int x) { return x * 0; }
+inline int f629_1(int x) { return x * 1; }
+inline int f629_2(int x) { return x * 2; }
+inline int f629_3(int x) { return x * 3; }
+inline int f629_4(int x) { return x * 4; }
+inline int f629_5(int x) { return x * 5; }
+inline int f629_6(int x) { return x * 6; }
+inline int f629_7(int x) { return x * 7; }
+inline int f629_8(int x) { return x * 8; }
+inline int f629_9(int x) { return x * 9; }
+inline int f629_10(int x) { return x * 10; }
+inline int f629_11(int x) { return x * 11; }
+inline int f629_12(int x) { return x * 12; }
+inline int f629_13(int x) { return x * 13; }
+inline int f629_14(int x) { return x * 14; }
+inline int f629_15(int x) { return x * 15; }
+inline int f629_16(int x) { return x * 16; }
+inline int f629_17(int x) { return x * 17; }
+inline int f629_18(int x) { return x * 18; }
+inline int f629_19(int x) { return x * 19; }
+inline int f629_20(int x) { return x * 20; }
+inline int f629_21(int x) { return x * 21; }
+inline int f629_22(int x) { return x * 22; }
+inline int f629_23(int x) { return x * 23; }
+inline int f629_24(int x) { return x * 24; }
+inline int f629_25(int x) { return x * 25; }
+inline int f629_26(int x) { return x * 26; }
+inline int f629_27(int x) { return x * 27; }
+inline int f629_28(int x) { return x * 28; }
+inline int f629_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6290 */
+#include <vector>
+#include "h6305.h"
+#include "h6762.h"
+#include "h5284.h"
+#include "h2673.h"
+#include "h7277.h"
+#ifdef X
+#include "h8965.h"
+#endif
+struct S6290 { int a; const char *s = "x//y"; };
+inline int f6290_0(int x) { return x * 0; }
+inline int f6290_1(int x) { return x * 1; }
+inline int f6290_2(int x) { return x * 2; }
+inline int f6290_3(int x) { return x * 3; }
+inline int f6290_4(int x) { return x * 4; }
+inline int f6290_5(int x) { return x * 5; }
+inline int f6290_6(int x) { return x * 6; }
+inline int f6290_7(int x) { return x * 7; }
+inline int f6290_8(int x) { return x * 8; }
+inline int f6290_9(int x) { return x * 9; }
+inline int f6290_10(int x) { return x * 10; }
+inline int f6290_11(int x) { return x * 11; }
+inline int f6290_12(int x) { return x * 12; }
+inline int f6290_13(int x) { return x * 13; }
+inline int f6290_14(int x) { return x * 14; }
+inline int f6290_15(int x) { return x * 15; }
+inline int f6290_16(int x) { return x * 16; }
+inline int f6290_17(int x) { return x * 17; }
+inline int f6290_18(int x) { return x * 18; }
+inline int f6290_19(int x) { return x * 19; }
+inline int f6290_20(int x) { return x * 20; }
+inline int f6290_21(int x) { return x * 21; }
+inline int f6290_22(int x) { return x * 22; }
+inline int f6290_23(int x) { return x * 23; }
+inline int f6290_24(int x) { return x * 24; }
+inline int f6290_25(int x) { return x * 25; }
+inline int f6290_26(int x) { return x * 26; }
+inline int f6290_27(int x) { return x * 27; }
+inline int f6290_28(int x) { return x * 28; }
+inline int f6290_29(int x) { return x * 29; }
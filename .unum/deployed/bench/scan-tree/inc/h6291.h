@@ -0,0 +1,42 @@
+#pragma once
+/* header 6291 */
+#include <vector>
+#include "h6122.h"
+#include "h8801.h"
+#include "h6438.h"
+#include "h1954.h"
+#include "h7883.h"
+#ifdef X
+#include "h6294.h"
+#endif
+struct S6291 { int a; const char *s = "x//y"; };
+inline int f6291_0(int x) { return x * 0; }
+inline int f6291_1(int x) { return x * 1; }
+inline int f6291_2(int x) { return x * 2; }
+inline int f6291_3(int x) { return x * 3; }
+inline int f6291_4(int x) { return x * 4; }
+inline int f6291_5(int x) { return x * 5; }
+inline int f6291_6(int x) { return x * 6; }
+inline int f6291_7(int x) { return x * 7; }
+inline int f6291_8(int x) { return x * 8; }
+inline int f6291_9(int x) { return x * 9; }
+inline int f6291_10(int x) { return x * 10; }
+inline int f6291_11(int x) { return x * 11; }
+inline int f6291_12(int x) { return x * 12; }
+inline int f6291_13(int x) { return x * 13; }
+inline int f6291_14(int x) { return x * 14; }
+inline int f6291_15(int x) { return x * 15; }
+inline int f6291_16(int x) { return x * 16; }
+inline int f6291_17(int x) { return x * 17; }
+inline int f6291_18(int x) { return x * 18; }
+inline int f6291_19(int x) { return x * 19; }
+inline int f6291_20(int x) { return x * 20; }
+inline int f6291_21(int x) { return x * 21; }
+inline int f6291_22(int x) { return x * 22; }
+inline int f6291_23(int x) { return x * 23; }
+inline int f6291_24(int x) { return x * 24; }
+inline int f6291_25(int x) { return x * 25; }
+inline int f6291_26(int x) { return x * 26; }
+inline int f6291_27(int x) { return x * 27; }
+inline int f6291_28(int x) { return x * 28; }
+inline int f6291_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6293 */
+#include <vector>
+#include "h7356.h"
+#include "h3741.h"
+#include "h4569.h"
+#include "h2540.h"
+#include "h9793.h"
+#ifdef X
+#include "h902.h"
+#endif
+struct S6293 { int a; const char *s = "x//y"; };
+inline int f6293_0(int x) { return x * 0; }
+inline int f6293_1(int x) { return x * 1; }
+inline int f6293_2(int x) { return x * 2; }
+inline int f6293_3(int x) { return x * 3; }
+inline int f6293_4(int x) { return x * 4; }
+inline int f6293_5(int x) { return x * 5; }
+inline int f6293_6(int x) { return x * 6; }
+inline int f6293_7(int x) { return x * 7; }
+inline int f6293_8(int x) { return x * 8; }
+inline int f6293_9(int x) { return x * 9; }
+inline int f6293_10(int x) { return x * 10; }
+inline int f6293_11(int x) { return x * 11; }
+inline int f6293_12(int x) { return x * 12; }
+inline int f6293_13(int x) { return x * 13; }
+inline int f6293_14(int x) { return x * 14; }
+inline int f6293_15(int x) { return x * 15; }
+inline int f6293_16(int x) { return x * 16; }
+inline int f6293_17(int x) { return x * 17; }
+inline int f6293_18(int x) { return x * 18; }
+inline int f6293_19(int x) { return x * 19; }
+inline int f6293_20(int x) { return x * 20; }
+inline int f6293_21(int x) { return x * 21; }
+inline int f6293_22(int x) { return x * 22; }
+inline int f6293_23(int x) { return x * 23; }
+inline int f6293_24(int x) { return x * 24; }
+inline int f6293_25(int x) { return x * 25; }
+inline int f6293_26(int x) { return x * 26; }
+inline int f6293_27(int x) { return x * 27; }
+inline int f6293_28(int x) { return x * 28; }
+inline int f6293_29(int x) { return x * 29; }
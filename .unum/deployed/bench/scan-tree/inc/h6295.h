@@ -0,0 +1,42 @@
+#pragma once
+/* header 6295 */
+#include <vector>
+#include "h7910.h"
+#include "h5850.h"
+#include "h4728.h"
+#include "h6354.h"
+#include "h6854.h"
+#ifdef X
+#include "h373.h"
+#endif
+struct S6295 { int a; const char *s = "x//y"; };
+inline int f6295_0(int x) { return x * 0; }
+inline int f6295_1(int x) { return x * 1; }
+inline int f6295_2(int x) { return x * 2; }
+inline int f6295_3(int x) { return x * 3; }
+inline int f6295_4(int x) { return x * 4; }
+inline int f6295_5(int x) { return x * 5; }
+inline int f6295_6(int x) { return x * 6; }
+inline int f6295_7(int x) { return x * 7; }
+inline int f6295_8(int x) { return x * 8; }
+inline int f6295_9(int x) { return x * 9; }
+inline int f6295_10(int x) { return x * 10; }
+inline int f6295_11(int x) { return x * 11; }
+inline int f6295_12(int x) { return x * 12; }
+inline int f6295_13(int x) { return x * 13; }
+inline int f6295_14(int x) { return x * 14; }
+inline int f6295_15(int x) { return x * 15; }
+inline int f6295_16(int x) { return x * 16; }
+inline int f6295_17(int x) { return x * 17; }
+inline int f6295_18(int x) { return x * 18; }
+inline int f6295_19(int x) { return x * 19; }
+inline int f6295_20(int x) { return x * 20; }
+inline int f6295_21(int x) { return x * 21; }
+inline int f6295_22(int x) { return x * 22; }
+inline int f6295_23(int x) { return x * 23; }
+inline int f6295_24(int x) { return x * 24; }
+inline int f6295_25(int x) { return x * 25; }
+inline int f6295_26(int x) { return x * 26; }
+inline int f6295_27(int x) { return x * 27; }
+inline int f6295_28(int x) { return x * 28; }
+inline int f6295_29(int x) { return x * 29; }
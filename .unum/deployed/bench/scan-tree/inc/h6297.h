@@ -0,0 +1,42 @@
+#pragma once
+/* header 6297 */
+#include <vector>
+#include "h5230.h"
+#include "h4806.h"
+#include "h3735.h"
+#include "h3150.h"
+#include "h1098.h"
+#ifdef X
+#include "h5013.h"
+#endif
+struct S6297 { int a; const char *s = "x//y"; };
+inline int f6297_0(int x) { return x * 0; }
+inline int f6297_1(int x) { return x * 1; }
+inline int f6297_2(int x) { return x * 2; }
+inline int f6297_3(int x) { return x * 3; }
+inline int f6297_4(int x) { return x * 4; }
+inline int f6297_5(int x) { return x * 5; }
+inline int f6297_6(int x) { return x * 6; }
+inline int f6297_7(int x) { return x * 7; }
+inline int f6297_8(int x) { return x * 8; }
+inline int f6297_9(int x) { return x * 9; }
+inline int f6297_10(int x) { return x * 10; }
+inline int f6297_11(int x) { return x * 11; }
+inline int f6297_12(int x) { return x * 12; }
+inline int f6297_13(int x) { return x * 13; }
+inline int f6297_14(int x) { return x * 14; }
+inline int f6297_15(int x) { return x * 15; }
+inline int f6297_16(int x) { return x * 16; }
+inline int f6297_17(int x) { return x * 17; }
+inline int f6297_18(int x) { return x * 18; }
+inline int f6297_19(int x) { return x * 19; }
+inline int f6297_20(int x) { return x * 20; }
+inline int f6297_21(int x) { return x * 21; }
+inline int f6297_22(int x) { return x * 22; }
+inline int f6297_23(int x) { return x * 23; }
+inline int f6297_24(int x) { return x * 24; }
+inline int f6297_25(int x) { return x * 25; }
+inline int f6297_26(int x) { return x * 26; }
+inline int f6297_27(int x) { return x * 27; }
+inline int f6297_28(int x) { return x * 28; }
+inline int f6297_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6298 */
+#include <vector>
+#include "h2436.h"
+#include "h3137.h"
+#include "h4526.h"
+#include "h8873.h"
+#include "h236.h"
+#ifdef X
+#include "h3008.h"
+#endif
+struct S6298 { int a; const char *s = "x//y"; };
+inline int f6298_0(int x) { return x * 0; }
+inline int f6298_1(int x) { return x * 1; }
+inline int f6298_2(int x) { return x * 2; }
+inline int f6298_3(int x) { return x * 3; }
+inline int f6298_4(int x) { return x * 4; }
+inline int f6298_5(int x) { return x * 5; }
+inline int f6298_6(int x) { return x * 6; }
+inline int f6298_7(int x) { return x * 7; }
+inline int f6298_8(int x) { return x * 8; }
+inline int f6298_9(int x) { return x * 9; }
+inline int f6298_10(int x) { return x * 10; }
+inline int f6298_11(int x) { return x * 11; }
+inline int f6298_12(int x) { return x * 12; }
+inline int f6298_13(int x) { return x * 13; }
+inline int f6298_14(int x) { return x * 14; }
+inline int f6298_15(int x) { return x * 15; }
+inline int f6298_16(int x) { return x * 16; }
+inline int f6298_17(int x) { return x * 17; }
+inline int f6298_18(int x) { return x * 18; }
+inline int f6298_19(int x) { return x * 19; }
+inline int f6298_20(int x) { return x * 20; }
+inline int f6298_21(int x) { return x * 21; }
+inline int f6298_22(int x) { return x * 22; }
+inline int f6298_23(int x) { return x * 23; }
+inline int f6298_24(int x) { return x * 24; }
+inline int f6298_25(int x) { return x * 25; }
+inline int f6298_26(int x) { return x * 26; }
+inline int f6298_27(int x) { return x * 27; }
+inline int f6298_28(int x) { return x * 28; }
+inline int f6298_29(int x) { return x * 29; }
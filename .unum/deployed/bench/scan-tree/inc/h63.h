@@ -0,0 +1,42 @@
+#pragma once
+/* header 63 */
+#include <vector>
+#include "h4503.h"
+#include "h788.h"
+#include "h3128.h"
+#include "h2663.h"
+#include "h2694.h"
+#ifdef X
+#include "h2724.h"
+#endif
+struct S63 { int a; const char *s = "x//y"; };
+inline int f63_0(int x) { return x * 0; }
+inline int f63_1(int x) { return x * 1; }
+inline int f63_2(int x) { return x * 2; }
+inline int f63_3(int x) { return x * 3; }
+inline int f63_4(int x) { return x * 4; }
+inline int f63_5(int x) { return x * 5; }
+inline int f63_6(int x) { return x * 6; }
+inline int f63_7(int x) { return x * 7; }
+inline int f63_8(int x) { return x * 8; }
+inline int f63_9(int x) { return x * 9; }
+inline int f63_10(int x) { return x * 10; }
+inline int f63_11(int x) { return x * 11; }
+inline int f63_12(int x) { return x * 12; }
+inline int f63_13(int x) { return x * 13; }
+inline int f63_14(int x) { return x * 14; }
+inline int f63_15(int x) { return x * 15; }
+inline int f63_16(int x) { return x * 16; }
+inline int f63_17(int x) { return x * 17; }
+inline int f63_18(int x) { return x * 18; }
+inline int f63_19(int x) { return x * 19; }
+inline int f63_20(int x) { return x * 20; }
+inline int f63_21(int x) { return x * 21; }
+inline int f63_22(int x) { return x * 22; }
+inline int f63_23(int x) { return x * 23; }
+inline int f63_24(int x) { return x * 24; }
+inline int f63_25(int x) { return x * 25; }
+inline int f63_26(int x) { return x * 26; }
+inline int f63_27(int x) { return x * 27; }
+inline int f63_28(int x) { return x * 28; }
+inline int f63_29(int x) { return x * 29; }
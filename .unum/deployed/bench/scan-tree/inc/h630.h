@@ -0,0 +1,42 @@
+#pragma once
+/* header 630 */
+#include <vector>
+#include "h821.h"
+#include "h7474.h"
+#include "h1608.h"
+#include "h400.h"
+#include "h7290.h"
+#ifdef X
+#include "h4706.h"
+#endif
+struct S630 { int a; const char *s = "x//y"; };
+inline int f630_0(int x) { return x * 0; }
+inline int f630_1(int x) { return x * 1; }
+inline int f630_2(int x) { return x * 2; }
+inline int f630_3(int x) { return x * 3; }
+inline int f630_4(int x) { return x * 4; }
+inline int f630_5(int x) { return x * 5; }
+inline int f630_6(int x) { return x * 6; }
+inline int f630_7(int x) { return x * 7; }
+inline int f630_8(int x) { return x * 8; }
+inline int f630_9(int x) { return x * 9; }
+inline int f630_10(int x) { return x * 10; }
+inline int f630_11(int x) { return x * 11; }
+inline int f630_12(int x) { return x * 12; }
+inline int f630_13(int x) { return x * 13; }
+inline int f630_14(int x) { return x * 14; }
+inline int f630_15(int x) { return x * 15; }
+inline int f630_16(int x) { return x * 16; }
+inline int f630_17(int x) { return x * 17; }
+inline int f630_18(int x) { return x * 18; }
+inline int f630_19(int x) { return x * 19; }
+inline int f630_20(int x) { return x * 20; }
+inline int f630_21(int x) { return x * 21; }
+inline int f630_22(int x) { return x * 22; }
+inline int f630_23(int x) { return x * 23; }
+inline int f630_24(int x) { return x * 24; }
+inline int f630_25(int x) { return x * 25; }
+inline int f630_26(int x) { return x * 26; }
+inline int f630_27(int x) { return x * 27; }
+inline int f630_28(int x) { return x * 28; }
+inline int f630_29(int x) { return x * 29; }
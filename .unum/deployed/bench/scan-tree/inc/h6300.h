@@ -0,0 +1,42 @@
+#pragma once
+/* header 6300 */
+#include <vector>
+#include "h5970.h"
+#include "h9304.h"
+#include "h244.h"
+#include "h9350.h"
+#include "h5916.h"
+#ifdef X
+#include "h891.h"
+#endif
+struct S6300 { int a; const char *s = "x//y"; };
+inline int f6300_0(int x) { return x * 0; }
+inline int f6300_1(int x) { return x * 1; }
+inline int f6300_2(int x) { return x * 2; }
+inline int f6300_3(int x) { return x * 3; }
+inline int f6300_4(int x) { return x * 4; }
+inline int f6300_5(int x) { return x * 5; }
+inline int f6300_6(int x) { return x * 6; }
+inline int f6300_7(int x) { return x * 7; }
+inline int f6300_8(int x) { return x * 8; }
+inline int f6300_9(int x) { return x * 9; }
+inline int f6300_10(int x) { return x * 10; }
+inline int f6300_11(int x) { return x * 11; }
+inline int f6300_12(int x) { return x * 12; }
+inline int f6300_13(int x) { return x * 13; }
+inline int f6300_14(int x) { return x * 14; }
+inline int f6300_15(int x) { return x * 15; }
+inline int f6300_16(int x) { return x * 16; }
+inline int f6300_17(int x) { return x * 17; }
+inline int f6300_18(int x) { return x * 18; }
+inline int f6300_19(int x) { return x * 19; }
+inline int f6300_20(int x) { return x * 20; }
+inline int f6300_21(int x) { return x * 21; }
+inline int f6300_22(int x) { return x * 22; }
+inline int f6300_23(int x) { return x * 23; }
+inline int f6300_24(int x) { return x * 24; }
+inline int f6300_25(int x) { return x * 25; }
+inline int f6300_26(int x) { return x * 26; }
+inline int f6300_27(int x) { return x * 27; }
+inline int f6300_28(int x) { return x * 28; }
+inline int f6300_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6301 */
+#include <vector>
+#include "h1080.h"
+#include "h1662.h"
+#include "h9346.h"
+#include "h4246.h"
+#include "h8833.h"
+#ifdef X
+#include "h9434.h"
+#endif
+struct S6301 { int a; const char *s = "x//y"; };
+inline int f6301_0(int x) { return x * 0; }
+inline int f6301_1(int x) { return x * 1; }
+inline int f6301_2(int x) { return x * 2; }
+inline int f6301_3(int x) { return x * 3; }
+inline int f6301_4(int x) { return x * 4; }
+inline int f6301_5(int x) { return x * 5; }
+inline int f6301_6(int x) { return x * 6; }
+inline int f6301_7(int x) { return x * 7; }
+inline int f6301_8(int x) { return x * 8; }
+inline int f6301_9(int x) { return x * 9; }
+inline int f6301_10(int x) { return x * 10; }
+inline int f6301_11(int x) { return x * 11; }
+inline int f6301_12(int x) { return x * 12; }
+inline int f6301_13(int x) { return x * 13; }
+inline int f6301_14(int x) { return x * 14; }
+inline int f6301_15(int x) { return x * 15; }
+inline int f6301_16(int x) { return x * 16; }
+inline int f6301_17(int x) { return x * 17; }
+inline int f6301_18(int x) { return x * 18; }
+inline int f6301_19(int x) { return x * 19; }
+inline int f6301_20(int x) { return x * 20; }
+inline int f6301_21(int x) { return x * 21; }
+inline int f6301_22(int x) { return x * 22; }
+inline int f6301_23(int x) { return x * 23; }
+inline int f6301_24(int x) { return x * 24; }
+inline int f6301_25(int x) { return x * 25; }
+inline int f6301_26(int x) { return x * 26; }
+inline int f6301_27(int x) { return x * 27; }
+inline int f6301_28(int x) { return x * 28; }
+inline int f6301_29(int x) { return x * 29; }
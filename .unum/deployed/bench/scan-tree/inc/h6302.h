@@ -0,0 +1,42 @@
+#pragma once
+/* header 6302 */
+#include <vector>
+#include "h2680.h"
+#include "h8227.h"
+#include "h8192.h"
+#include "h1846.h"
+#include "h4547.h"
+#ifdef X
+#include "h1067.h"
+#endif
+struct S6302 { int a; const char *s = "x//y"; };
+inline int f6302_0(int x) { return x * 0; }
+inline int f6302_1(int x) { return x * 1; }
+inline int f6302_2(int x) { return x * 2; }
+inline int f6302_3(int x) { return x * 3; }
+inline int f6302_4(int x) { return x * 4; }
+inline int f6302_5(int x) { return x * 5; }
+inline int f6302_6(int x) { return x * 6; }
+inline int f6302_7(int x) { return x * 7; }
+inline int f6302_8(int x) { return x * 8; }
+inline int f6302_9(int x) { return x * 9; }
+inline int f6302_10(int x) { return x * 10; }
+inline int f6302_11(int x) { return x * 11; }
+inline int f6302_12(int x) { return x * 12; }
+inline int f6302_13(int x) { return x * 13; }
+inline int f6302_14(int x) { return x * 14; }
+inline int f6302_15(int x) { return x * 15; }
+inline int f6302_16(int x) { return x * 16; }
+inline int f6302_17(int x) { return x * 17; }
+inline int f6302_18(int x) { return x * 18; }
+inline int f6302_19(int x) { return x * 19; }
+inline int f6302_20(int x) { return x * 20; }
+inline int f6302_21(int x) { return x * 21; }
+inline int f6302_22(int x) { return x * 22; }
+inline int f6302_23(int x) { return x * 23; }
+inline int f6302_24(int x) { return x * 24; }
+inline int f6302_25(int x) { return x * 25; }
+inline int f6302_26(int x) { return x * 26; }
+inline int f6302_27(int x) { return x * 27; }
+inline int f6302_28(int x) { return x * 28; }
+inline int f6302_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6303 */
+#include <vector>
+#include "h2520.h"
+#include "h6958.h"
+#include "h8719.h"
+#include "h9644.h"
+#include "h3741.h"
+#ifdef X
+#include "h1737.h"
+#endif
+struct S6303 { int a; const char *s = "x//y"; };
+inline int f6303_0(int x) { return x * 0; }
+inline int f6303_1(int x) { return x * 1; }
+inline int f6303_2(int x) { return x * 2; }
+inline int f6303_3(int x) { return x * 3; }
+inline int f6303_4(int x) { return x * 4; }
+inline int f6303_5(int x) { return x * 5; }
+inline int f6303_6(int x) { return x * 6; }
+inline int f6303_7(int x) { return x * 7; }
+inline int f6303_8(int x) { return x * 8; }
+inline int f6303_9(int x) { return x * 9; }
+inline int f6303_10(int x) { return x * 10; }
+inline int f6303_11(int x) { return x * 11; }
+inline int f6303_12(int x) { return x * 12; }
+inline int f6303_13(int x) { return x * 13; }
+inline int f6303_14(int x) { return x * 14; }
+inline int f6303_15(int x) { return x * 15; }
+inline int f6303_16(int x) { return x * 16; }
+inline int f6303_17(int x) { return x * 17; }
+inline int f6303_18(int x) { return x * 18; }
+inline int f6303_19(int x) { return x * 19; }
+inline int f6303_20(int x) { return x * 20; }
+inline int f6303_21(int x) { return x * 21; }
+inline int f6303_22(int x) { return x * 22; }
+inline int f6303_23(int x) { return x * 23; }
+inline int f6303_24(int x) { return x * 24; }
+inline int f6303_25(int x) { return x * 25; }
+inline int f6303_26(int x) { return x * 26; }
+inline int f6303_27(int x) { return x * 27; }
+inline int f6303_28(int x) { return x * 28; }
+inline int f6303_29(int x) { return x * 29; }
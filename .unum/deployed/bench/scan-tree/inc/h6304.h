@@ -0,0 +1,42 @@
+#pragma once
+/* header 6304 */
+#include <vector>
+#include "h6662.h"
+#include "h7085.h"
+#include "h7770.h"
+#include "h8639.h"
+#include "h9375.h"
+#ifdef X
+#include "h7912.h"
+#endif
+struct S6304 { int a; const char *s = "x//y"; };
+inline int f6304_0(int x) { return x * 0; }
+inline int f6304_1(int x) { return x * 1; }
+inline int f6304_2(int x) { return x * 2; }
+inline int f6304_3(int x) { return x * 3; }
+inline int f6304_4(int x) { return x * 4; }
+inline int f6304_5(int x) { return x * 5; }
+inline int f6304_6(int x) { return x * 6; }
+inline int f6304_7(int x) { return x * 7; }
+inline int f6304_8(int x) { return x * 8; }
+inline int f6304_9(int x) { return x * 9; }
+inline int f6304_10(int x) { return x * 10; }
+inline int f6304_11(int x) { return x * 11; }
+inline int f6304_12(int x) { return x * 12; }
+inline int f6304_13(int x) { return x * 13; }
+inline int f6304_14(int x) { return x * 14; }
+inline int f6304_15(int x) { return x * 15; }
+inline int f6304_16(int x) { return x * 16; }
+inline int f6304_17(int x) { return x * 17; }
+inline int f6304_18(int x) { return x * 18; }
+inline int f6304_19(int x) { return x * 19; }
+inline int f6304_20(int x) { return x * 20; }
+inline int f6304_21(int x) { return x * 21; }
+inline int f6304_22(int x) { return x * 22; }
+inline int f6304_23(int x) { return x * 23; }
+inline int f6304_24(int x) { return x * 24; }
+inline int f6304_25(int x) { return x * 25; }
+inline int f6304_26(int x) { return x * 26; }
+inline int f6304_27(int x) { return x * 27; }
+inline int f6304_28(int x) { return x * 28; }
+inline int f6304_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6306 */
+#include <vector>
+#include "h6426.h"
+#include "h7426.h"
+#include "h2483.h"
+#include "h8287.h"
+#include "h7237.h"
+#ifdef X
+#include "h7053.h"
+#endif
+struct S6306 { int a; const char *s = "x//y"; };
+inline int f6306_0(int x) { return x * 0; }
+inline int f6306_1(int x) { return x * 1; }
+inline int f6306_2(int x) { return x * 2; }
+inline int f6306_3(int x) { return x * 3; }
+inline int f6306_4(int x) { return x * 4; }
+inline int f6306_5(int x) { return x * 5; }
+inline int f6306_6(int x) { return x * 6; }
+inline int f6306_7(int x) { return x * 7; }
+inline int f6306_8(int x) { return x * 8; }
+inline int f6306_9(int x) { return x * 9; }
+inline int f6306_10(int x) { return x * 10; }
+inline int f6306_11(int x) { return x * 11; }
+inline int f6306_12(int x) { return x * 12; }
+inline int f6306_13(int x) { return x * 13; }
+inline int f6306_14(int x) { return x * 14; }
+inline int f6306_15(int x) { return x * 15; }
+inline int f6306_16(int x) { return x * 16; }
+inline int f6306_17(int x) { return x * 17; }
+inline int f6306_18(int x) { return x * 18; }
+inline int f6306_19(int x) { return x * 19; }
+inline int f6306_20(int x) { return x * 20; }
+inline int f6306_21(int x) { return x * 21; }
+inline int f6306_22(int x) { return x * 22; }
+inline int f6306_23(int x) { return x * 23; }
+inline int f6306_24(int x) { return x * 24; }
+inline int f6306_25(int x) { return x * 25; }
+inline int f6306_26(int x) { return x * 26; }
+inline int f6306_27(int x) { return x * 27; }
+inline int f6306_28(int x) { return x * 28; }
+inline int f6306_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6308 */
+#include <vector>
+#include "h9125.h"
+#include "h6091.h"
+#include "h523.h"
+#include "h6727.h"
+#include "h9643.h"
+#ifdef X
+#include "h442.h"
+#endif
+struct S6308 { int a; const char *s = "x//y"; };
+inline int f6308_0(int x) { return x * 0; }
+inline int f6308_1(int x) { return x * 1; }
+inline int f6308_2(int x) { return x * 2; }
+inline int f6308_3(int x) { return x * 3; }
+inline int f6308_4(int x) { return x * 4; }
+inline int f6308_5(int x) { return x * 5; }
+inline int f6308_6(int x) { return x * 6; }
+inline int f6308_7(int x) { return x * 7; }
+inline int f6308_8(int x) { return x * 8; }
+inline int f6308_9(int x) { return x * 9; }
+inline int f6308_10(int x) { return x * 10; }
+inline int f6308_11(int x) { return x * 11; }
+inline int f6308_12(int x) { return x * 12; }
+inline int f6308_13(int x) { return x * 13; }
+inline int f6308_14(int x) { return x * 14; }
+inline int f6308_15(int x) { return x * 15; }
+inline int f6308_16(int x) { return x * 16; }
+inline int f6308_17(int x) { return x * 17; }
+inline int f6308_18(int x) { return x * 18; }
+inline int f6308_19(int x) { return x * 19; }
+inline int f6308_20(int x) { return x * 20; }
+inline int f6308_21(int x) { return x * 21; }
+inline int f6308_22(int x) { return x * 22; }
+inline int f6308_23(int x) { return x * 23; }
+inline int f6308_24(int x) { return x * 24; }
+inline int f6308_25(int x) { return x * 25; }
+inline int f6308_26(int x) { return x * 26; }
+inline int f6308_27(int x) { return x * 27; }
+inline int f6308_28(int x) { return x * 28; }
+inline int f6308_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6309 */
+#include <vector>
+#include "h1339.h"
+#include "h6482.h"
+#include "h2964.h"
+#include "h6527.h"
+#include "h8930.h"
+#ifdef X
+#include "h3549.h"
+#endif
+struct S6309 { int a; const char *s = "x//y"; };
+inline int f6309_0(int x) { return x * 0; }
+inline int f6309_1(int x) { return x * 1; }
+inline int f6309_2(int x) { return x * 2; }
+inline int f6309_3(int x) { return x * 3; }
+inline int f6309_4(int x) { return x * 4; }
+inline int f6309_5(int x) { return x * 5; }
+inline int f6309_6(int x) { return x * 6; }
+inline int f6309_7(int x) { return x * 7; }
+inline int f6309_8(int x) { return x * 8; }
+inline int f6309_9(int x) { return x * 9; }
+inline int f6309_10(int x) { return x * 10; }
+inline int f6309_11(int x) { return x * 11; }
+inline int f6309_12(int x) { return x * 12; }
+inline int f6309_13(int x) { return x * 13; }
+inline int f6309_14(int x) { return x * 14; }
+inline int f6309_15(int x) { return x * 15; }
+inline int f6309_16(int x) { return x * 16; }
+inline int f6309_17(int x) { return x * 17; }
+inline int f6309_18(int x) { return x * 18; }
+inline int f6309_19(int x) { return x * 19; }
+inline int f6309_20(int x) { return x * 20; }
+inline int f6309_21(int x) { return x * 21; }
+inline int f6309_22(int x) { return x * 22; }
+inline int f6309_23(int x) { return x * 23; }
+inline int f6309_24(int x) { return x * 24; }
+inline int f6309_25(int x) { return x * 25; }
+inline int f6309_26(int x) { return x * 26; }
+inline int f6309_27(int x) { return x * 27; }
+inline int f6309_28(int x) { return x * 28; }
+inline int f6309_29(int x) { return x * 29; }
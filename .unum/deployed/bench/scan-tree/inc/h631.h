@@ -0,0 +1,42 @@
+#pragma once
+/* header 631 */
+#include <vector>
+#include "h4562.h"
+#include "h7537.h"
+#include "h6151.h"
+#include "h9660.h"
+#include "h8513.h"
+#ifdef X
+#include "h1021.h"
+#endif
+struct S631 { int a; const char *s = "x//y"; };
+inline int f631_0(int x) { return x * 0; }
+inline int f631_1(int x) { return x * 1; }
+inline int f631_2(int x) { return x * 2; }
+inline int f631_3(int x) { return x * 3; }
+inline int f631_4(int x) { return x * 4; }
+inline int f631_5(int x) { return x * 5; }
+inline int f631_6(int x) { return x * 6; }
+inline int f631_7(int x) { return x * 7; }
+inline int f631_8(int x) { return x * 8; }
+inline int f631_9(int x) { return x * 9; }
+inline int f631_10(int x) { return x * 10; }
+inline int f631_11(int x) { return x * 11; }
+inline int f631_12(int x) { return x * 12; }
+inline int f631_13(int x) { return x * 13; }
+inline int f631_14(int x) { return x * 14; }
+inline int f631_15(int x) { return x * 15; }
+inline int f631_16(int x) { return x * 16; }
+inline int f631_17(int x) { return x * 17; }
+inline int f631_18(int x) { return x * 18; }
+inline int f631_19(int x) { return x * 19; }
+inline int f631_20(int x) { return x * 20; }
+inline int f631_21(int x) { return x * 21; }
+inline int f631_22(int x) { return x * 22; }
+inline int f631_23(int x) { return x * 23; }
+inline int f631_24(int x) { return x * 24; }
+inline int f631_25(int x) { return x * 25; }
+inline int f631_26(int x) { return x * 26; }
+inline int f631_27(int x) { return x * 27; }
+inline int f631_28(int x) { return x * 28; }
+inline int f631_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6310 */
+#include <vector>
+#include "h7774.h"
+#include "h8593.h"
+#include "h3575.h"
+#include "h5190.h"
+#include "h6463.h"
+#ifdef X
+#include "h5342.h"
+#endif
+struct S6310 { int a; const char *s = "x//y"; };
+inline int f6310_0(int x) { return x * 0; }
+inline int f6310_1(int x) { return x * 1; }
+inline int f6310_2(int x) { return x * 2; }
+inline int f6310_3(int x) { return x * 3; }
+inline int f6310_4(int x) { return x * 4; }
+inline int f6310_5(int x) { return x * 5; }
+inline int f6310_6(int x) { return x * 6; }
+inline int f6310_7(int x) { return x * 7; }
+inline int f6310_8(int x) { return x * 8; }
+inline int f6310_9(int x) { return x * 9; }
+inline int f6310_10(int x) { return x * 10; }
+inline int f6310_11(int x) { return x * 11; }
+inline int f6310_12(int x) { return x * 12; }
+inline int f6310_13(int x) { return x * 13; }
+inline int f6310_14(int x) { return x * 14; }
+inline int f6310_15(int x) { return x * 15; }
+inline int f6310_16(int x) { return x * 16; }
+inline int f6310_17(int x) { return x * 17; }
+inline int f6310_18(int x) { return x * 18; }
+inline int f6310_19(int x) { return x * 19; }
+inline int f6310_20(int x) { return x * 20; }
+inline int f6310_21(int x) { return x * 21; }
+inline int f6310_22(int x) { return x * 22; }
+inline int f6310_23(int x) { return x * 23; }
+inline int f6310_24(int x) { return x * 24; }
+inline int f6310_25(int x) { return x * 25; }
+inline int f6310_26(int x) { return x * 26; }
+inline int f6310_27(int x) { return x * 27; }
+inline int f6310_28(int x) { return x * 28; }
+inline int f6310_29(int x) { return x * 29; }
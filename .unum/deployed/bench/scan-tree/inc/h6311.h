@@ -0,0 +1,42 @@
+#pragma once
+/* header 6311 */
+#include <vector>
+#include "h9305.h"
+#include "h2793.h"
+#include "h9982.h"
+#include "h9201.h"
+#include "h8720.h"
+#ifdef X
+#include "h4220.h"
+#endif
+struct S6311 { int a; const char *s = "x//y"; };
+inline int f6311_0(int x) { return x * 0; }
+inline int f6311_1(int x) { return x * 1; }
+inline int f6311_2(int x) { return x * 2; }
+inline int f6311_3(int x) { return x * 3; }
+inline int f6311_4(int x) { return x * 4; }
+inline int f6311_5(int x) { return x * 5; }
+inline int f6311_6(int x) { return x * 6; }
+inline int f6311_7(int x) { return x * 7; }
+inline int f6311_8(int x) { return x * 8; }
+inline int f6311_9(int x) { return x * 9; }
+inline int f6311_10(int x) { return x * 10; }
+inline int f6311_11(int x) { return x * 11; }
+inline int f6311_12(int x) { return x * 12; }
+inline int f6311_13(int x) { return x * 13; }
+inline int f6311_14(int x) { return x * 14; }
+inline int f6311_15(int x) { return x * 15; }
+inline int f6311_16(int x) { return x * 16; }
+inline int f6311_17(int x) { return x * 17; }
+inline int f6311_18(int x) { return x * 18; }
+inline int f6311_19(int x) { return x * 19; }
+inline int f6311_20(int x) { return x * 20; }
+inline int f6311_21(int x) { return x * 21; }
+inline int f6311_22(int x) { return x * 22; }
+inline int f6311_23(int x) { return x * 23; }
+inline int f6311_24(int x) { return x * 24; }
+inline int f6311_25(int x) { return x * 25; }
+inline int f6311_26(int x) { return x * 26; }
+inline int f6311_27(int x) { return x * 27; }
+inline int f6311_28(int x) { return x * 28; }
+inline int f6311_29(int x) { return x * 29; }
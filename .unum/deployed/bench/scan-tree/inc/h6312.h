@@ -0,0 +1,42 @@
+#pragma once
+/* header 6312 */
+#include <vector>
+#include "h6752.h"
+#include "h2020.h"
+#include "h2985.h"
+#include "h9538.h"
+#include "h6638.h"
+#ifdef X
+#include "h7960.h"
+#endif
+struct S6312 { int a; const char *s = "x//y"; };
+inline int f6312_0(int x) { return x * 0; }
+inline int f6312_1(int x) { return x * 1; }
+inline int f6312_2(int x) { return x * 2; }
+inline int f6312_3(int x) { return x * 3; }
+inline int f6312_4(int x) { return x * 4; }
+inline int f6312_5(int x) { return x * 5; }
+inline int f6312_6(int x) { return x * 6; }
+inline int f6312_7(int x) { return x * 7; }
+inline int f6312_8(int x) { return x * 8; }
+inline int f6312_9(int x) { return x * 9; }
+inline int f6312_10(int x) { return x * 10; }
+inline int f6312_11(int x) { return x * 11; }
+inline int f6312_12(int x) { return x * 12; }
+inline int f6312_13(int x) { return x * 13; }
+inline int f6312_14(int x) { return x * 14; }
+inline int f6312_15(int x) { return x * 15; }
+inline int f6312_16(int x) { return x * 16; }
+inline int f6312_17(int x) { return x * 17; }
+inline int f6312_18(int x) { return x * 18; }
+inline int f6312_19(int x) { return x * 19; }
+inline int f6312_20(int x) { return x * 20; }
+inline int f6312_21(int x) { return x * 21; }
+inline int f6312_22(int x) { return x * 22; }
+inline int f6312_23(int x) { return x * 23; }
+inline int f6312_24(int x) { return x * 24; }
+inline int f6312_25(int x) { return x * 25; }
+inline int f6312_26(int x) { return x * 26; }
+inline int f6312_27(int x) { return x * 27; }
+inline int f6312_28(int x) { return x * 28; }
+inline int f6312_29(int x) { return x * 29; }
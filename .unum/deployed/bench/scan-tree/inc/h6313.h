@@ -0,0 +1,42 @@
+#pragma once
+/* header 6313 */
+#include <vector>
+#include "h3690.h"
+#include "h4895.h"
+#include "h5487.h"
+#include "h7337.h"
+#include "h4273.h"
+#ifdef X
+#include "h6294.h"
+#endif
+struct S6313 { int a; const char *s = "x//y"; };
+inline int f6313_0(int x) { return x * 0; }
+inline int f6313_1(int x) { return x * 1; }
+inline int f6313_2(int x) { return x * 2; }
+inline int f6313_3(int x) { return x * 3; }
+inline int f6313_4(int x) { return x * 4; }
+inline int f6313_5(int x) { return x * 5; }
+inline int f6313_6(int x) { return x * 6; }
+inline int f6313_7(int x) { return x * 7; }
+inline int f6313_8(int x) { return x * 8; }
+inline int f6313_9(int x) { return x * 9; }
+inline int f6313_10(int x) { return x * 10; }
+inline int f6313_11(int x) { return x * 11; }
+inline int f6313_12(int x) { return x * 12; }
+inline int f6313_13(int x) { return x * 13; }
+inline int f6313_14(int x) { return x * 14; }
+inline int f6313_15(int x) { return x * 15; }
+inline int f6313_16(int x) { return x * 16; }
+inline int f6313_17(int x) { return x * 17; }
+inline int f6313_18(int x) { return x * 18; }
+inline int f6313_19(int x) { return x * 19; }
+inline int f6313_20(int x) { return x * 20; }
+inline int f6313_21(int x) { return x * 21; }
+inline int f6313_22(int x) { return x * 22; }
+inline int f6313_23(int x) { return x * 23; }
+inline int f6313_24(int x) { return x * 24; }
+inline int f6313_25(int x) { return x * 25; }
+inline int f6313_26(int x) { return x * 26; }
+inline int f6313_27(int x) { return x * 27; }
+inline int f6313_28(int x) { return x * 28; }
+inline int f6313_29(int x) { return x * 29; }
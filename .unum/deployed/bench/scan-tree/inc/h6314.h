@@ -0,0 +1,42 @@
+#pragma once
+/* header 6314 */
+#include <vector>
+#include "h4140.h"
+#include "h6739.h"
+#include "h8535.h"
+#include "h2985.h"
+#include "h9587.h"
+#ifdef X
+#include "h7328.h"
+#endif
+struct S6314 { int a; const char *s = "x//y"; };
+inline int f6314_0(int x) { return x * 0; }
+inline int f6314_1(int x) { return x * 1; }
+inline int f6314_2(int x) { return x * 2; }
+inline int f6314_3(int x) { return x * 3; }
+inline int f6314_4(int x) { return x * 4; }
+inline int f6314_5(int x) { return x * 5; }
+inline int f6314_6(int x) { return x * 6; }
+inline int f6314_7(int x) { return x * 7; }
+inline int f6314_8(int x) { return x * 8; }
+inline int f6314_9(int x) { return x * 9; }
+inline int f6314_10(int x) { return x * 10; }
+inline int f6314_11(int x) { return x * 11; }
+inline int f6314_12(int x) { return x * 12; }
+inline int f6314_13(int x) { return x * 13; }
+inline int f6314_14(int x) { return x * 14; }
+inline int f6314_15(int x) { return x * 15; }
+inline int f6314_16(int x) { return x * 16; }
+inline int f6314_17(int x) { return x * 17; }
+inline int f6314_18(int x) { return x * 18; }
+inline int f6314_19(int x) { return x * 19; }
+inline int f6314_20(int x) { return x * 20; }
+inline int f6314_21(int x) { return x * 21; }
+inline int f6314_22(int x) { return x * 22; }
+inline int f6314_23(int x) { return x * 23; }
+inline int f6314_24(int x) { return x * 24; }
+inline int f6314_25(int x) { return x * 25; }
+inline int f6314_26(int x) { return x * 26; }
+inline int f6314_27(int x) { return x * 27; }
+inline int f6314_28(int x) { return x * 28; }
+inline int f6314_29(int x) { return x * 29; }
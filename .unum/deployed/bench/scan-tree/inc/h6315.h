@@ -0,0 +1,42 @@
+#pragma once
+/* header 6315 */
+#include <vector>
+#include "h8209.h"
+#include "h1273.h"
+#include "h8473.h"
+#include "h5140.h"
+#include "h4231.h"
+#ifdef X
+#include "h4290.h"
+#endif
+struct S6315 { int a; const char *s = "x//y"; };
+inline int f6315_0(int x) { return x * 0; }
+inline int f6315_1(int x) { return x * 1; }
+inline int f6315_2(int x) { return x * 2; }
+inline int f6315_3(int x) { return x * 3; }
+inline int f6315_4(int x) { return x * 4; }
+inline int f6315_5(int x) { return x * 5; }
+inline int f6315_6(int x) { return x * 6; }
+inline int f6315_7(int x) { return x * 7; }
+inline int f6315_8(int x) { return x * 8; }
+inline int f6315_9(int x) { return x * 9; }
+inline int f6315_10(int x) { return x * 10; }
+inline int f6315_11(int x) { return x * 11; }
+inline int f6315_12(int x) { return x * 12; }
+inline int f6315_13(int x) { return x * 13; }
+inline int f6315_14(int x) { return x * 14; }
+inline int f6315_15(int x) { return x * 15; }
+inline int f6315_16(int x) { return x * 16; }
+inline int f6315_17(int x) { return x * 17; }
+inline int f6315_18(int x) { return x * 18; }
+inline int f6315_19(int x) { return x * 19; }
+inline int f6315_20(int x) { return x * 20; }
+inline int f6315_21(int x) { return x * 21; }
+inline int f6315_22(int x) { return x * 22; }
+inline int f6315_23(int x) { return x * 23; }
+inline int f6315_24(int x) { return x * 24; }
+inline int f6315_25(int x) { return x * 25; }
+inline int f6315_26(int x) { return x * 26; }
+inline int f6315_27(int x) { return x * 27; }
+inline int f6315_28(int x) { return x * 28; }
+inline int f6315_29(int x) { return x * 29; }
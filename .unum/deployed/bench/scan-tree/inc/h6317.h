@@ -0,0 +1,42 @@
+#pragma once
+/* header 6317 */
+#include <vector>
+#include "h5187.h"
+#include "h8648.h"
+#include "h5385.h"
+#include "h8533.h"
+#include "h1924.h"
+#ifdef X
+#include "h239.h"
+#endif
+struct S6317 { int a; const char *s = "x//y"; };
+inline int f6317_0(int x) { return x * 0; }
+inline int f6317_1(int x) { return x * 1; }
+inline int f6317_2(int x) { return x * 2; }
+inline int f6317_3(int x) { return x * 3; }
+inline int f6317_4(int x) { return x * 4; }
+inline int f6317_5(int x) { return x * 5; }
+inline int f6317_6(int x) { return x * 6; }
+inline int f6317_7(int x) { return x * 7; }
+inline int f6317_8(int x) { return x * 8; }
+inline int f6317_9(int x) { return x * 9; }
+inline int f6317_10(int x) { return x * 10; }
+inline int f6317_11(int x) { return x * 11; }
+inline int f6317_12(int x) { return x * 12; }
+inline int f6317_13(int x) { return x * 13; }
+inline int f6317_14(int x) { return x * 14; }
+inline int f6317_15(int x) { return x * 15; }
+inline int f6317_16(int x) { return x * 16; }
+inline int f6317_17(int x) { return x * 17; }
+inline int f6317_18(int x) { return x * 18; }
+inline int f6317_19(int x) { return x * 19; }
+inline int f6317_20(int x) { return x * 20; }
+inline int f6317_21(int x) { return x * 21; }
+inline int f6317_22(int x) { return x * 22; }
+inline int f6317_23(int x) { return x * 23; }
+inline int f6317_24(int x) { return x * 24; }
+inline int f6317_25(int x) { return x * 25; }
+inline int f6317_26(int x) { return x * 26; }
+inline int f6317_27(int x) { return x * 27; }
+inline int f6317_28(int x) { return x * 28; }
+inline int f6317_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6318 */
+#include <vector>
+#include "h4568.h"
+#include "h1650.h"
+#include "h8434.h"
+#include "h2140.h"
+#include "h9213.h"
+#ifdef X
+#include "h9145.h"
+#endif
+struct S6318 { int a; const char *s = "x//y"; };
+inline int f6318_0(int x) { return x * 0; }
+inline int f6318_1(int x) { return x * 1; }
+inline int f6318_2(int x) { return x * 2; }
+inline int f6318_3(int x) { return x * 3; }
+inline int f6318_4(int x) { return x * 4; }
+inline int f6318_5(int x) { return x * 5; }
+inline int f6318_6(int x) { return x * 6; }
+inline int f6318_7(int x) { return x * 7; }
+inline int f6318_8(int x) { return x * 8; }
+inline int f6318_9(int x) { return x * 9; }
+inline int f6318_10(int x) { return x * 10; }
+inline int f6318_11(int x) { return x * 11; }
+inline int f6318_12(int x) { return x * 12; }
+inline int f6318_13(int x) { return x * 13; }
+inline int f6318_14(int x) { return x * 14; }
+inline int f6318_15(int x) { return x * 15; }
+inline int f6318_16(int x) { return x * 16; }
+inline int f6318_17(int x) { return x * 17; }
+inline int f6318_18(int x) { return x * 18; }
+inline int f6318_19(int x) { return x * 19; }
+inline int f6318_20(int x) { return x * 20; }
+inline int f6318_21(int x) { return x * 21; }
+inline int f6318_22(int x) { return x * 22; }
+inline int f6318_23(int x) { return x * 23; }
+inline int f6318_24(int x) { return x * 24; }
+inline int f6318_25(int x) { return x * 25; }
+inline int f6318_26(int x) { return x * 26; }
+inline int f6318_27(int x) { return x * 27; }
+inline int f6318_28(int x) { return x * 28; }
+inline int f6318_29(int x) { return x * 29; }
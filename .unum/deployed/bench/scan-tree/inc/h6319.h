@@ -0,0 +1,42 @@
+#pragma once
+/* header 6319 */
+#include <vector>
+#include "h3856.h"
+#include "h8932.h"
+#include "h4421.h"
+#include "h5800.h"
+#include "h6889.h"
+#ifdef X
+#include "h8412.h"
+#endif
+struct S6319 { int a; const char *s = "x//y"; };
+inline int f6319_0(int x) { return x * 0; }
+inline int f6319_1(int x) { return x * 1; }
+inline int f6319_2(int x) { return x * 2; }
+inline int f6319_3(int x) { return x * 3; }
+inline int f6319_4(int x) { return x * 4; }
+inline int f6319_5(int x) { return x * 5; }
+inline int f6319_6(int x) { return x * 6; }
+inline int f6319_7(int x) { return x * 7; }
+inline int f6319_8(int x) { return x * 8; }
+inline int f6319_9(int x) { return x * 9; }
+inline int f6319_10(int x) { return x * 10; }
+inline int f6319_11(int x) { return x * 11; }
+inline int f6319_12(int x) { return x * 12; }
+inline int f6319_13(int x) { return x * 13; }
+inline int f6319_14(int x) { return x * 14; }
+inline int f6319_15(int x) { return x * 15; }
+inline int f6319_16(int x) { return x * 16; }
+inline int f6319_17(int x) { return x * 17; }
+inline int f6319_18(int x) { return x * 18; }
+inline int f6319_19(int x) { return x * 19; }
+inline int f6319_20(int x) { return x * 20; }
+inline int f6319_21(int x) { return x * 21; }
+inline int f6319_22(int x) { return x * 22; }
+inline int f6319_23(int x) { return x * 23; }
+inline int f6319_24(int x) { return x * 24; }
+inline int f6319_25(int x) { return x * 25; }
+inline int f6319_26(int x) { return x * 26; }
+inline int f6319_27(int x) { return x * 27; }
+inline int f6319_28(int x) { return x * 28; }
+inline int f6319_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6321 */
+#include <vector>
+#include "h7703.h"
+#include "h3003.h"
+#include "h4608.h"
+#include "h2324.h"
+#include "h1960.h"
+#ifdef X
+#include "h9303.h"
+#endif
+struct S6321 { int a; const char *s = "x//y"; };
+inline int f6321_0(int x) { return x * 0; }
+inline int f6321_1(int x) { return x * 1; }
+inline int f6321_2(int x) { return x * 2; }
+inline int f6321_3(int x) { return x * 3; }
+inline int f6321_4(int x) { return x * 4; }
+inline int f6321_5(int x) { return x * 5; }
+inline int f6321_6(int x) { return x * 6; }
+inline int f6321_7(int x) { return x * 7; }
+inline int f6321_8(int x) { return x * 8; }
+inline int f6321_9(int x) { return x * 9; }
+inline int f6321_10(int x) { return x * 10; }
+inline int f6321_11(int x) { return x * 11; }
+inline int f6321_12(int x) { return x * 12; }
+inline int f6321_13(int x) { return x * 13; }
+inline int f6321_14(int x) { return x * 14; }
+inline int f6321_15(int x) { return x * 15; }
+inline int f6321_16(int x) { return x * 16; }
+inline int f6321_17(int x) { return x * 17; }
+inline int f6321_18(int x) { return x * 18; }
+inline int f6321_19(int x) { return x * 19; }
+inline int f6321_20(int x) { return x * 20; }
+inline int f6321_21(int x) { return x * 21; }
+inline int f6321_22(int x) { return x * 22; }
+inline int f6321_23(int x) { return x * 23; }
+inline int f6321_24(int x) { return x * 24; }
+inline int f6321_25(int x) { return x * 25; }
+inline int f6321_26(int x) { return x * 26; }
+inline int f6321_27(int x) { return x * 27; }
+inline int f6321_28(int x) { return x * 28; }
+inline int f6321_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6327 */
+#include <vector>
+#include "h9843.h"
+#include "h1643.h"
+#include "h5559.h"
+#include "h3420.h"
+#include "h1600.h"
+#ifdef X
+#include "h2401.h"
+#endif
+struct S6327 { int a; const char *s = "x//y"; };
+inline int f6327_0(int x) { return x * 0; }
+inline int f6327_1(int x) { return x * 1; }
+inline int f6327_2(int x) { return x * 2; }
+inline int f6327_3(int x) { return x * 3; }
+inline int f6327_4(int x) { return x * 4; }
+inline int f6327_5(int x) { return x * 5; }
+inline int f6327_6(int x) { return x * 6; }
+inline int f6327_7(int x) { return x * 7; }
+inline int f6327_8(int x) { return x * 8; }
+inline int f6327_9(int x) { return x * 9; }
+inline int f6327_10(int x) { return x * 10; }
+inline int f6327_11(int x) { return x * 11; }
+inline int f6327_12(int x) { return x * 12; }
+inline int f6327_13(int x) { return x * 13; }
+inline int f6327_14(int x) { return x * 14; }
+inline int f6327_15(int x) { return x * 15; }
+inline int f6327_16(int x) { return x * 16; }
+inline int f6327_17(int x) { return x * 17; }
+inline int f6327_18(int x) { return x * 18; }
+inline int f6327_19(int x) { return x * 19; }
+inline int f6327_20(int x) { return x * 20; }
+inline int f6327_21(int x) { return x * 21; }
+inline int f6327_22(int x) { return x * 22; }
+inline int f6327_23(int x) { return x * 23; }
+inline int f6327_24(int x) { return x * 24; }
+inline int f6327_25(int x) { return x * 25; }
+inline int f6327_26(int x) { return x * 26; }
+inline int f6327_27(int x) { return x * 27; }
+inline int f6327_28(int x) { return x * 28; }
+inline int f6327_29(int x) { return x * 29; }
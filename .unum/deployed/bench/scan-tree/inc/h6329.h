@@ -0,0 +1,42 @@
+#pragma once
+/* header 6329 */
+#include <vector>
+#include "h4756.h"
+#include "h1783.h"
+#include "h5290.h"
+#include "h9348.h"
+#include "h77.h"
+#ifdef X
+#include "h9104.h"
+#endif
+struct S6329 { int a; const char *s = "x//y"; };
+inline int f6329_0(int x) { return x * 0; }
+inline int f6329_1(int x) { return x * 1; }
+inline int f6329_2(int x) { return x * 2; }
+inline int f6329_3(int x) { return x * 3; }
+inline int f6329_4(int x) { return x * 4; }
+inline int f6329_5(int x) { return x * 5; }
+inline int f6329_6(int x) { return x * 6; }
+inline int f6329_7(int x) { return x * 7; }
+inline int f6329_8(int x) { return x * 8; }
+inline int f6329_9(int x) { return x * 9; }
+inline int f6329_10(int x) { return x * 10; }
+inline int f6329_11(int x) { return x * 11; }
+inline int f6329_12(int x) { return x * 12; }
+inline int f6329_13(int x) { return x * 13; }
+inline int f6329_14(int x) { return x * 14; }
+inline int f6329_15(int x) { return x * 15; }
+inline int f6329_16(int x) { return x * 16; }
+inline int f6329_17(int x) { return x * 17; }
+inline int f6329_18(int x) { return x * 18; }
+inline int f6329_19(int x) { return x * 19; }
+inline int f6329_20(int x) { return x * 20; }
+inline int f6329_21(int x) { return x * 21; }
+inline int f6329_22(int x) { return x * 22; }
+inline int f6329_23(int x) { return x * 23; }
+inline int f6329_24(int x) { return x * 24; }
+inline int f6329_25(int x) { return x * 25; }
+inline int f6329_26(int x) { return x * 26; }
+inline int f6329_27(int x) { return x * 27; }
+inline int f6329_28(int x) { return x * 28; }
+inline int f6329_29(int x) { return x * 29; }
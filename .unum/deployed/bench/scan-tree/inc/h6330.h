@@ -0,0 +1,42 @@
+#pragma once
+/* header 6330 */
+#include <vector>
+#include "h8264.h"
+#include "h6073.h"
+#include "h4416.h"
+#include "h2057.h"
+#include "h4258.h"
+#ifdef X
+#include "h6638.h"
+#endif
+struct S6330 { int a; const char *s = "x//y"; };
+inline int f6330_0(int x) { return x * 0; }
+inline int f6330_1(int x) { return x * 1; }
+inline int f6330_2(int x) { return x * 2; }
+inline int f6330_3(int x) { return x * 3; }
+inline int f6330_4(int x) { return x * 4; }
+inline int f6330_5(int x) { return x * 5; }
+inline int f6330_6(int x) { return x * 6; }
+inline int f6330_7(int x) { return x * 7; }
+inline int f6330_8(int x) { return x * 8; }
+inline int f6330_9(int x) { return x * 9; }
+inline int f6330_10(int x) { return x * 10; }
+inline int f6330_11(int x) { return x * 11; }
+inline int f6330_12(int x) { return x * 12; }
+inline int f6330_13(int x) { return x * 13; }
+inline int f6330_14(int x) { return x * 14; }
+inline int f6330_15(int x) { return x * 15; }
+inline int f6330_16(int x) { return x * 16; }
+inline int f6330_17(int x) { return x * 17; }
+inline int f6330_18(int x) { return x * 18; }
+inline int f6330_19(int x) { return x * 19; }
+inline int f6330_20(int x) { return x * 20; }
+inline int f6330_21(int x) { return x * 21; }
+inline int f6330_22(int x) { return x * 22; }
+inline int f6330_23(int x) { return x * 23; }
+inline int f6330_24(int x) { return x * 24; }
+inline int f6330_25(int x) { return x * 25; }
+inline int f6330_26(int x) { return x * 26; }
+inline int f6330_27(int x) { return x * 27; }
+inline int f6330_28(int x) { return x * 28; }
+inline int f6330_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6331 */
+#include <vector>
+#include "h8877.h"
+#include "h6460.h"
+#include "h3454.h"
+#include "h6529.h"
+#include "h4587.h"
+#ifdef X
+#include "h290.h"
+#endif
+struct S6331 { int a; const char *s = "x//y"; };
+inline int f6331_0(int x) { return x * 0; }
+inline int f6331_1(int x) { return x * 1; }
+inline int f6331_2(int x) { return x * 2; }
+inline int f6331_3(int x) { return x * 3; }
+inline int f6331_4(int x) { return x * 4; }
+inline int f6331_5(int x) { return x * 5; }
+inline int f6331_6(int x) { return x * 6; }
+inline int f6331_7(int x) { return x * 7; }
+inline int f6331_8(int x) { return x * 8; }
+inline int f6331_9(int x) { return x * 9; }
+inline int f6331_10(int x) { return x * 10; }
+inline int f6331_11(int x) { return x * 11; }
+inline int f6331_12(int x) { return x * 12; }
+inline int f6331_13(int x) { return x * 13; }
+inline int f6331_14(int x) { return x * 14; }
+inline int f6331_15(int x) { return x * 15; }
+inline int f6331_16(int x) { return x * 16; }
+inline int f6331_17(int x) { return x * 17; }
+inline int f6331_18(int x) { return x * 18; }
+inline int f6331_19(int x) { return x * 19; }
+inline int f6331_20(int x) { return x * 20; }
+inline int f6331_21(int x) { return x * 21; }
+inline int f6331_22(int x) { return x * 22; }
+inline int f6331_23(int x) { return x * 23; }
+inline int f6331_24(int x) { return x * 24; }
+inline int f6331_25(int x) { return x * 25; }
+inline int f6331_26(int x) { return x * 26; }
+inline int f6331_27(int x) { return x * 27; }
+inline int f6331_28(int x) { return x * 28; }
+inline int f6331_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6333 */
+#include <vector>
+#include "h4625.h"
+#include "h3624.h"
+#include "h2957.h"
+#include "h4081.h"
+#include "h9812.h"
+#ifdef X
+#include "h8192.h"
+#endif
+struct S6333 { int a; const char *s = "x//y"; };
+inline int f6333_0(int x) { return x * 0; }
+inline int f6333_1(int x) { return x * 1; }
+inline int f6333_2(int x) { return x * 2; }
+inline int f6333_3(int x) { return x * 3; }
+inline int f6333_4(int x) { return x * 4; }
+inline int f6333_5(int x) { return x * 5; }
+inline int f6333_6(int x) { return x * 6; }
+inline int f6333_7(int x) { return x * 7; }
+inline int f6333_8(int x) { return x * 8; }
+inline int f6333_9(int x) { return x * 9; }
+inline int f6333_10(int x) { return x * 10; }
+inline int f6333_11(int x) { return x * 11; }
+inline int f6333_12(int x) { return x * 12; }
+inline int f6333_13(int x) { return x * 13; }
+inline int f6333_14(int x) { return x * 14; }
+inline int f6333_15(int x) { return x * 15; }
+inline int f6333_16(int x) { return x * 16; }
+inline int f6333_17(int x) { return x * 17; }
+inline int f6333_18(int x) { return x * 18; }
+inline int f6333_19(int x) { return x * 19; }
+inline int f6333_20(int x) { return x * 20; }
+inline int f6333_21(int x) { return x * 21; }
+inline int f6333_22(int x) { return x * 22; }
+inline int f6333_23(int x) { return x * 23; }
+inline int f6333_24(int x) { return x * 24; }
+inline int f6333_25(int x) { return x * 25; }
+inline int f6333_26(int x) { return x * 26; }
+inline int f6333_27(int x) { return x * 27; }
+inline int f6333_28(int x) { return x * 28; }
+inline int f6333_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6335 */
+#include <vector>
+#include "h6479.h"
+#include "h7893.h"
+#include "h1838.h"
+#include "h8858.h"
+#include "h9630.h"
+#ifdef X
+#include "h6515.h"
+#endif
+struct S6335 { int a; const char *s = "x//y"; };
+inline int f6335_0(int x) { return x * 0; }
+inline int f6335_1(int x) { return x * 1; }
+inline int f6335_2(int x) { return x * 2; }
+inline int f6335_3(int x) { return x * 3; }
+inline int f6335_4(int x) { return x * 4; }
+inline int f6335_5(int x) { return x * 5; }
+inline int f6335_6(int x) { return x * 6; }
+inline int f6335_7(int x) { return x * 7; }
+inline int f6335_8(int x) { return x * 8; }
+inline int f6335_9(int x) { return x * 9; }
+inline int f6335_10(int x) { return x * 10; }
+inline int f6335_11(int x) { return x * 11; }
+inline int f6335_12(int x) { return x * 12; }
+inline int f6335_13(int x) { return x * 13; }
+inline int f6335_14(int x) { return x * 14; }
+inline int f6335_15(int x) { return x * 15; }
+inline int f6335_16(int x) { return x * 16; }
+inline int f6335_17(int x) { return x * 17; }
+inline int f6335_18(int x) { return x * 18; }
+inline int f6335_19(int x) { return x * 19; }
+inline int f6335_20(int x) { return x * 20; }
+inline int f6335_21(int x) { return x * 21; }
+inline int f6335_22(int x) { return x * 22; }
+inline int f6335_23(int x) { return x * 23; }
+inline int f6335_24(int x) { return x * 24; }
+inline int f6335_25(int x) { return x * 25; }
+inline int f6335_26(int x) { return x * 26; }
+inline int f6335_27(int x) { return x * 27; }
+inline int f6335_28(int x) { return x * 28; }
+inline int f6335_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6336 */
+#include <vector>
+#include "h5928.h"
+#include "h3074.h"
+#include "h8337.h"
+#include "h3700.h"
+#include "h8257.h"
+#ifdef X
+#include "h3684.h"
+#endif
+struct S6336 { int a; const char *s = "x//y"; };
+inline int f6336_0(int x) { return x * 0; }
+inline int f6336_1(int x) { return x * 1; }
+inline int f6336_2(int x) { return x * 2; }
+inline int f6336_3(int x) { return x * 3; }
+inline int f6336_4(int x) { return x * 4; }
+inline int f6336_5(int x) { return x * 5; }
+inline int f6336_6(int x) { return x * 6; }
+inline int f6336_7(int x) { return x * 7; }
+inline int f6336_8(int x) { return x * 8; }
+inline int f6336_9(int x) { return x * 9; }
+inline int f6336_10(int x) { return x * 10; }
+inline int f6336_11(int x) { return x * 11; }
+inline int f6336_12(int x) { return x * 12; }
+inline int f6336_13(int x) { return x * 13; }
+inline int f6336_14(int x) { return x * 14; }
+inline int f6336_15(int x) { return x * 15; }
+inline int f6336_16(int x) { return x * 16; }
+inline int f6336_17(int x) { return x * 17; }
+inline int f6336_18(int x) { return x * 18; }
+inline int f6336_19(int x) { return x * 19; }
+inline int f6336_20(int x) { return x * 20; }
+inline int f6336_21(int x) { return x * 21; }
+inline int f6336_22(int x) { return x * 22; }
+inline int f6336_23(int x) { return x * 23; }
+inline int f6336_24(int x) { return x * 24; }
+inline int f6336_25(int x) { return x * 25; }
+inline int f6336_26(int x) { return x * 26; }
+inline int f6336_27(int x) { return x * 27; }
+inline int f6336_28(int x) { return x * 28; }
+inline int f6336_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6339 */
+#include <vector>
+#include "h1350.h"
+#include "h4830.h"
+#include "h7893.h"
+#include "h410.h"
+#include "h1966.h"
+#ifdef X
+#include "h9776.h"
+#endif
+struct S6339 { int a; const char *s = "x//y"; };
+inline int f6339_0(int x) { return x * 0; }
+inline int f6339_1(int x) { return x * 1; }
+inline int f6339_2(int x) { return x * 2; }
+inline int f6339_3(int x) { return x * 3; }
+inline int f6339_4(int x) { return x * 4; }
+inline int f6339_5(int x) { return x * 5; }
+inline int f6339_6(int x) { return x * 6; }
+inline int f6339_7(int x) { return x * 7; }
+inline int f6339_8(int x) { return x * 8; }
+inline int f6339_9(int x) { return x * 9; }
+inline int f6339_10(int x) { return x * 10; }
+inline int f6339_11(int x) { return x * 11; }
+inline int f6339_12(int x) { return x * 12; }
+inline int f6339_13(int x) { return x * 13; }
+inline int f6339_14(int x) { return x * 14; }
+inline int f6339_15(int x) { return x * 15; }
+inline int f6339_16(int x) { return x * 16; }
+inline int f6339_17(int x) { return x * 17; }
+inline int f6339_18(int x) { return x * 18; }
+inline int f6339_19(int x) { return x * 19; }
+inline int f6339_20(int x) { return x * 20; }
+inline int f6339_21(int x) { return x * 21; }
+inline int f6339_22(int x) { return x * 22; }
+inline int f6339_23(int x) { return x * 23; }
+inline int f6339_24(int x) { return x * 24; }
+inline int f6339_25(int x) { return x * 25; }
+inline int f6339_26(int x) { return x * 26; }
+inline int f6339_27(int x) { return x * 27; }
+inline int f6339_28(int x) { return x * 28; }
+inline int f6339_29(int x) { return x * 29; }
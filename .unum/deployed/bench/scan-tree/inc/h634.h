@@ -0,0 +1,42 @@
+#pragma once
+/* header 634 */
+#include <vector>
+#include "h7752.h"
+#include "h7977.h"
+#include "h4043.h"
+#include "h7564.h"
+#include "h586.h"
+#ifdef X
+#include "h6170.h"
+#endif
+struct S634 { int a; const char *s = "x//y"; };
+inline int f634_0(int x) { return x * 0; }
+inline int f634_1(int x) { return x * 1; }
+inline int f634_2(int x) { return x * 2; }
+inline int f634_3(int x) { return x * 3; }
+inline int f634_4(int x) { return x * 4; }
+inline int f634_5(int x) { return x * 5; }
+inline int f634_6(int x) { return x * 6; }
+inline int f634_7(int x) { return x * 7; }
+inline int f634_8(int x) { return x * 8; }
+inline int f634_9(int x) { return x * 9; }
+inline int f634_10(int x) { return x * 10; }
+inline int f634_11(int x) { return x * 11; }
+inline int f634_12(int x) { return x * 12; }
+inline int f634_13(int x) { return x * 13; }
+inline int f634_14(int x) { return x * 14; }
+inline int f634_15(int x) { return x * 15; }
+inline int f634_16(int x) { return x * 16; }
+inline int f634_17(int x) { return x * 17; }
+inline int f634_18(int x) { return x * 18; }
+inline int f634_19(int x) { return x * 19; }
+inline int f634_20(int x) { return x * 20; }
+inline int f634_21(int x) { return x * 21; }
+inline int f634_22(int x) { return x * 22; }
+inline int f634_23(int x) { return x * 23; }
+inline int f634_24(int x) { return x * 24; }
+inline int f634_25(int x) { return x * 25; }
+inline int f634_26(int x) { return x * 26; }
+inline int f634_27(int x) { return x * 27; }
+inline int f634_28(int x) { return x * 28; }
+inline int f634_29(int x) { return x * 29; }
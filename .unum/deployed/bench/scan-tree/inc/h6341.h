@@ -0,0 +1,42 @@
+#pragma once
+/* header 6341 */
+#include <vector>
+#include "h5068.h"
+#include "h8330.h"
+#include "h5649.h"
+#include "h1216.h"
+#include "h7051.h"
+#ifdef X
+#include "h4510.h"
+#endif
+struct S6341 { int a; const char *s = "x//y"; };
+inline int f6341_0(int x) { return x * 0; }
+inline int f6341_1(int x) { return x * 1; }
+inline int f6341_2(int x) { return x * 2; }
+inline int f6341_3(int x) { return x * 3; }
+inline int f6341_4(int x) { return x * 4; }
+inline int f6341_5(int x) { return x * 5; }
+inline int f6341_6(int x) { return x * 6; }
+inline int f6341_7(int x) { return x * 7; }
+inline int f6341_8(int x) { return x * 8; }
+inline int f6341_9(int x) { return x * 9; }
+inline int f6341_10(int x) { return x * 10; }
+inline int f6341_11(int x) { return x * 11; }
+inline int f6341_12(int x) { return x * 12; }
+inline int f6341_13(int x) { return x * 13; }
+inline int f6341_14(int x) { return x * 14; }
+inline int f6341_15(int x) { return x * 15; }
+inline int f6341_16(int x) { return x * 16; }
+inline int f6341_17(int x) { return x * 17; }
+inline int f6341_18(int x) { return x * 18; }
+inline int f6341_19(int x) { return x * 19; }
+inline int f6341_20(int x) { return x * 20; }
+inline int f6341_21(int x) { return x * 21; }
+inline int f6341_22(int x) { return x * 22; }
+inline int f6341_23(int x) { return x * 23; }
+inline int f6341_24(int x) { return x * 24; }
+inline int f6341_25(int x) { return x * 25; }
+inline int f6341_26(int x) { return x * 26; }
+inline int f6341_27(int x) { return x * 27; }
+inline int f6341_28(int x) { return x * 28; }
+inline int f6341_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6343 */
+#include <vector>
+#include "h9979.h"
+#include "h4026.h"
+#include "h3885.h"
+#include "h3237.h"
+#include "h1513.h"
+#ifdef X
+#include "h1465.h"
+#endif
+struct S6343 { int a; const char *s = "x//y"; };
+inline int f6343_0(int x) { return x * 0; }
+inline int f6343_1(int x) { return x * 1; }
+inline int f6343_2(int x) { return x * 2; }
+inline int f6343_3(int x) { return x * 3; }
+inline int f6343_4(int x) { return x * 4; }
+inline int f6343_5(int x) { return x * 5; }
+inline int f6343_6(int x) { return x * 6; }
+inline int f6343_7(int x) { return x * 7; }
+inline int f6343_8(int x) { return x * 8; }
+inline int f6343_9(int x) { return x * 9; }
+inline int f6343_10(int x) { return x * 10; }
+inline int f6343_11(int x) { return x * 11; }
+inline int f6343_12(int x) { return x * 12; }
+inline int f6343_13(int x) { return x * 13; }
+inline int f6343_14(int x) { return x * 14; }
+inline int f6343_15(int x) { return x * 15; }
+inline int f6343_16(int x) { return x * 16; }
+inline int f6343_17(int x) { return x * 17; }
+inline int f6343_18(int x) { return x * 18; }
+inline int f6343_19(int x) { return x * 19; }
+inline int f6343_20(int x) { return x * 20; }
+inline int f6343_21(int x) { return x * 21; }
+inline int f6343_22(int x) { return x * 22; }
+inline int f6343_23(int x) { return x * 23; }
+inline int f6343_24(int x) { return x * 24; }
+inline int f6343_25(int x) { return x * 25; }
+inline int f6343_26(int x) { return x * 26; }
+inline int f6343_27(int x) { return x * 27; }
+inline int f6343_28(int x) { return x * 28; }
+inline int f6343_29(int x) { return x * 29; }
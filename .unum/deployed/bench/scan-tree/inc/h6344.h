@@ -0,0 +1,42 @@
+#pragma once
+/* header 6344 */
+#include <vector>
+#include "h4823.h"
+#include "h9695.h"
+#include "h6960.h"
+#include "h8743.h"
+#include "h386.h"
+#ifdef X
+#include "h2256.h"
+#endif
+struct S6344 { int a; const char *s = "x//y"; };
+inline int f6344_0(int x) { return x * 0; }
+inline int f6344_1(int x) { return x * 1; }
+inline int f6344_2(int x) { return x * 2; }
+inline int f6344_3(int x) { return x * 3; }
+inline int f6344_4(int x) { return x * 4; }
+inline int f6344_5(int x) { return x * 5; }
+inline int f6344_6(int x) { return x * 6; }
+inline int f6344_7(int x) { return x * 7; }
+inline int f6344_8(int x) { return x * 8; }
+inline int f6344_9(int x) { return x * 9; }
+inline int f6344_10(int x) { return x * 10; }
+inline int f6344_11(int x) { return x * 11; }
+inline int f6344_12(int x) { return x * 12; }
+inline int f6344_13(int x) { return x * 13; }
+inline int f6344_14(int x) { return x * 14; }
+inline int f6344_15(int x) { return x * 15; }
+inline int f6344_16(int x) { return x * 16; }
+inline int f6344_17(int x) { return x * 17; }
+inline int f6344_18(int x) { return x * 18; }
+inline int f6344_19(int x) { return x * 19; }
+inline int f6344_20(int x) { return x * 20; }
+inline int f6344_21(int x) { return x * 21; }
+inline int f6344_22(int x) { return x * 22; }
+inline int f6344_23(int x) { return x * 23; }
+inline int f6344_24(int x) { return x * 24; }
+inline int f6344_25(int x) { return x * 25; }
+inline int f6344_26(int x) { return x * 26; }
+inline int f6344_27(int x) { return x * 27; }
+inline int f6344_28(int x) { return x * 28; }
+inline int f6344_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6346 */
+#include <vector>
+#include "h2824.h"
+#include "h8045.h"
+#include "h8665.h"
+#include "h4997.h"
+#include "h8083.h"
+#ifdef X
+#include "h4756.h"
+#endif
+struct S6346 { int a; const char *s = "x//y"; };
+inline int f6346_0(int x) { return x * 0; }
+inline int f6346_1(int x) { return x * 1; }
+inline int f6346_2(int x) { return x * 2; }
+inline int f6346_3(int x) { return x * 3; }
+inline int f6346_4(int x) { return x * 4; }
+inline int f6346_5(int x) { return x * 5; }
+inline int f6346_6(int x) { return x * 6; }
+inline int f6346_7(int x) { return x * 7; }
+inline int f6346_8(int x) { return x * 8; }
+inline int f6346_9(int x) { return x * 9; }
+inline int f6346_10(int x) { return x * 10; }
+inline int f6346_11(int x) { return x * 11; }
+inline int f6346_12(int x) { return x * 12; }
+inline int f6346_13(int x) { return x * 13; }
+inline int f6346_14(int x) { return x * 14; }
+inline int f6346_15(int x) { return x * 15; }
+inline int f6346_16(int x) { return x * 16; }
+inline int f6346_17(int x) { return x * 17; }
+inline int f6346_18(int x) { return x * 18; }
+inline int f6346_19(int x) { return x * 19; }
+inline int f6346_20(int x) { return x * 20; }
+inline int f6346_21(int x) { return x * 21; }
+inline int f6346_22(int x) { return x * 22; }
+inline int f6346_23(int x) { return x * 23; }
+inline int f6346_24(int x) { return x * 24; }
+inline int f6346_25(int x) { return x * 25; }
+inline int f6346_26(int x) { return x * 26; }
+inline int f6346_27(int x) { return x * 27; }
+inline int f6346_28(int x) { return x * 28; }
+inline int f6346_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6347 */
+#include <vector>
+#include "h5878.h"
+#include "h7083.h"
+#include "h9807.h"
+#include "h5201.h"
+#include "h8638.h"
+#ifdef X
+#include "h4294.h"
+#endif
+struct S6347 { int a; const char *s = "x//y"; };
+inline int f6347_0(int x) { return x * 0; }
+inline int f6347_1(int x) { return x * 1; }
+inline int f6347_2(int x) { return x * 2; }
+inline int f6347_3(int x) { return x * 3; }
+inline int f6347_4(int x) { return x * 4; }
+inline int f6347_5(int x) { return x * 5; }
+inline int f6347_6(int x) { return x * 6; }
+inline int f6347_7(int x) { return x * 7; }
+inline int f6347_8(int x) { return x * 8; }
+inline int f6347_9(int x) { return x * 9; }
+inline int f6347_10(int x) { return x * 10; }
+inline int f6347_11(int x) { return x * 11; }
+inline int f6347_12(int x) { return x * 12; }
+inline int f6347_13(int x) { return x * 13; }
+inline int f6347_14(int x) { return x * 14; }
+inline int f6347_15(int x) { return x * 15; }
+inline int f6347_16(int x) { return x * 16; }
+inline int f6347_17(int x) { return x * 17; }
+inline int f6347_18(int x) { return x * 18; }
+inline int f6347_19(int x) { return x * 19; }
+inline int f6347_20(int x) { return x * 20; }
+inline int f6347_21(int x) { return x * 21; }
+inline int f6347_22(int x) { return x * 22; }
+inline int f6347_23(int x) { return x * 23; }
+inline int f6347_24(int x) { return x * 24; }
+inline int f6347_25(int x) { return x * 25; }
+inline int f6347_26(int x) { return x * 26; }
+inline int f6347_27(int x) { return x * 27; }
+inline int f6347_28(int x) { return x * 28; }
+inline int f6347_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6349 */
+#include <vector>
+#include "h1242.h"
+#include "h7584.h"
+#include "h285.h"
+#include "h5047.h"
+#include "h5221.h"
+#ifdef X
+#include "h193.h"
+#endif
+struct S6349 { int a; const char *s = "x//y"; };
+inline int f6349_0(int x) { return x * 0; }
+inline int f6349_1(int x) { return x * 1; }
+inline int f6349_2(int x) { return x * 2; }
+inline int f6349_3(int x) { return x * 3; }
+inline int f6349_4(int x) { return x * 4; }
+inline int f6349_5(int x) { return x * 5; }
+inline int f6349_6(int x) { return x * 6; }
+inline int f6349_7(int x) { return x * 7; }
+inline int f6349_8(int x) { return x * 8; }
+inline int f6349_9(int x) { return x * 9; }
+inline int f6349_10(int x) { return x * 10; }
+inline int f6349_11(int x) { return x * 11; }
+inline int f6349_12(int x) { return x * 12; }
+inline int f6349_13(int x) { return x * 13; }
+inline int f6349_14(int x) { return x * 14; }
+inline int f6349_15(int x) { return x * 15; }
+inline int f6349_16(int x) { return x * 16; }
+inline int f6349_17(int x) { return x * 17; }
+inline int f6349_18(int x) { return x * 18; }
+inline int f6349_19(int x) { return x * 19; }
+inline int f6349_20(int x) { return x * 20; }
+inline int f6349_21(int x) { return x * 21; }
+inline int f6349_22(int x) { return x * 22; }
+inline int f6349_23(int x) { return x * 23; }
+inline int f6349_24(int x) { return x * 24; }
+inline int f6349_25(int x) { return x * 25; }
+inline int f6349_26(int x) { return x * 26; }
+inline int f6349_27(int x) { return x * 27; }
+inline int f6349_28(int x) { return x * 28; }
+inline int f6349_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6350 */
+#include <vector>
+#include "h2691.h"
+#include "h7779.h"
+#include "h1339.h"
+#include "h4922.h"
+#include "h7779.h"
+#ifdef X
+#include "h8132.h"
+#endif
+struct S6350 { int a; const char *s = "x//y"; };
+inline int f6350_0(int x) { return x * 0; }
+inline int f6350_1(int x) { return x * 1; }
+inline int f6350_2(int x) { return x * 2; }
+inline int f6350_3(int x) { return x * 3; }
+inline int f6350_4(int x) { return x * 4; }
+inline int f6350_5(int x) { return x * 5; }
+inline int f6350_6(int x) { return x * 6; }
+inline int f6350_7(int x) { return x * 7; }
+inline int f6350_8(int x) { return x * 8; }
+inline int f6350_9(int x) { return x * 9; }
+inline int f6350_10(int x) { return x * 10; }
+inline int f6350_11(int x) { return x * 11; }
+inline int f6350_12(int x) { return x * 12; }
+inline int f6350_13(int x) { return x * 13; }
+inline int f6350_14(int x) { return x * 14; }
+inline int f6350_15(int x) { return x * 15; }
+inline int f6350_16(int x) { return x * 16; }
+inline int f6350_17(int x) { return x * 17; }
+inline int f6350_18(int x) { return x * 18; }
+inline int f6350_19(int x) { return x * 19; }
+inline int f6350_20(int x) { return x * 20; }
+inline int f6350_21(int x) { return x * 21; }
+inline int f6350_22(int x) { return x * 22; }
+inline int f6350_23(int x) { return x * 23; }
+inline int f6350_24(int x) { return x * 24; }
+inline int f6350_25(int x) { return x * 25; }
+inline int f6350_26(int x) { return x * 26; }
+inline int f6350_27(int x) { return x * 27; }
+inline int f6350_28(int x) { return x * 28; }
+inline int f6350_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6351 */
+#include <vector>
+#include "h8719.h"
+#include "h6223.h"
+#include "h2775.h"
+#include "h1937.h"
+#include "h8281.h"
+#ifdef X
+#include "h4330.h"
+#endif
+struct S6351 { int a; const char *s = "x//y"; };
+inline int f6351_0(int x) { return x * 0; }
+inline int f6351_1(int x) { return x * 1; }
+inline int f6351_2(int x) { return x * 2; }
+inline int f6351_3(int x) { return x * 3; }
+inline int f6351_4(int x) { return x * 4; }
+inline int f6351_5(int x) { return x * 5; }
+inline int f6351_6(int x) { return x * 6; }
+inline int f6351_7(int x) { return x * 7; }
+inline int f6351_8(int x) { return x * 8; }
+inline int f6351_9(int x) { return x * 9; }
+inline int f6351_10(int x) { return x * 10; }
+inline int f6351_11(int x) { return x * 11; }
+inline int f6351_12(int x) { return x * 12; }
+inline int f6351_13(int x) { return x * 13; }
+inline int f6351_14(int x) { return x * 14; }
+inline int f6351_15(int x) { return x * 15; }
+inline int f6351_16(int x) { return x * 16; }
+inline int f6351_17(int x) { return x * 17; }
+inline int f6351_18(int x) { return x * 18; }
+inline int f6351_19(int x) { return x * 19; }
+inline int f6351_20(int x) { return x * 20; }
+inline int f6351_21(int x) { return x * 21; }
+inline int f6351_22(int x) { return x * 22; }
+inline int f6351_23(int x) { return x * 23; }
+inline int f6351_24(int x) { return x * 24; }
+inline int f6351_25(int x) { return x * 25; }
+inline int f6351_26(int x) { return x * 26; }
+inline int f6351_27(int x) { return x * 27; }
+inline int f6351_28(int x) { return x * 28; }
+inline int f6351_29(int x) { return x * 29; }
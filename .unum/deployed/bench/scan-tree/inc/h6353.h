@@ -0,0 +1,42 @@
+#pragma once
+/* header 6353 */
+#include <vector>
+#include "h7930.h"
+#include "h9574.h"
+#include "h7241.h"
+#include "h910.h"
+#include "h2897.h"
+#ifdef X
+#include "h4007.h"
+#endif
+struct S6353 { int a; const char *s = "x//y"; };
+inline int f6353_0(int x) { return x * 0; }
+inline int f6353_1(int x) { return x * 1; }
+inline int f6353_2(int x) { return x * 2; }
+inline int f6353_3(int x) { return x * 3; }
+inline int f6353_4(int x) { return x * 4; }
+inline int f6353_5(int x) { return x * 5; }
+inline int f6353_6(int x) { return x * 6; }
+inline int f6353_7(int x) { return x * 7; }
+inline int f6353_8(int x) { return x * 8; }
+inline int f6353_9(int x) { return x * 9; }
+inline int f6353_10(int x) { return x * 10; }
+inline int f6353_11(int x) { return x * 11; }
+inline int f6353_12(int x) { return x * 12; }
+inline int f6353_13(int x) { return x * 13; }
+inline int f6353_14(int x) { return x * 14; }
+inline int f6353_15(int x) { return x * 15; }
+inline int f6353_16(int x) { return x * 16; }
+inline int f6353_17(int x) { return x * 17; }
+inline int f6353_18(int x) { return x * 18; }
+inline int f6353_19(int x) { return x * 19; }
+inline int f6353_20(int x) { return x * 20; }
+inline int f6353_21(int x) { return x * 21; }
+inline int f6353_22(int x) { return x * 22; }
+inline int f6353_23(int x) { return x * 23; }
+inline int f6353_24(int x) { return x * 24; }
+inline int f6353_25(int x) { return x * 25; }
+inline int f6353_26(int x) { return x * 26; }
+inline int f6353_27(int x) { return x * 27; }
+inline int f6353_28(int x) { return x * 28; }
+inline int f6353_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6355 */
+#include <vector>
+#include "h2209.h"
+#include "h9070.h"
+#include "h4372.h"
+#include "h616.h"
+#include "h1938.h"
+#ifdef X
+#include "h5123.h"
+#endif
+struct S6355 { int a; const char *s = "x//y"; };
+inline int f6355_0(int x) { return x * 0; }
+inline int f6355_1(int x) { return x * 1; }
+inline int f6355_2(int x) { return x * 2; }
+inline int f6355_3(int x) { return x * 3; }
+inline int f6355_4(int x) { return x * 4; }
+inline int f6355_5(int x) { return x * 5; }
+inline int f6355_6(int x) { return x * 6; }
+inline int f6355_7(int x) { return x * 7; }
+inline int f6355_8(int x) { return x * 8; }
+inline int f6355_9(int x) { return x * 9; }
+inline int f6355_10(int x) { return x * 10; }
+inline int f6355_11(int x) { return x * 11; }
+inline int f6355_12(int x) { return x * 12; }
+inline int f6355_13(int x) { return x * 13; }
+inline int f6355_14(int x) { return x * 14; }
+inline int f6355_15(int x) { return x * 15; }
+inline int f6355_16(int x) { return x * 16; }
+inline int f6355_17(int x) { return x * 17; }
+inline int f6355_18(int x) { return x * 18; }
+inline int f6355_19(int x) { return x * 19; }
+inline int f6355_20(int x) { return x * 20; }
+inline int f6355_21(int x) { return x * 21; }
+inline int f6355_22(int x) { return x * 22; }
+inline int f6355_23(int x) { return x * 23; }
+inline int f6355_24(int x) { return x * 24; }
+inline int f6355_25(int x) { return x * 25; }
+inline int f6355_26(int x) { return x * 26; }
+inline int f6355_27(int x) { return x * 27; }
+inline int f6355_28(int x) { return x * 28; }
+inline int f6355_29(int x) { return x * 29; }
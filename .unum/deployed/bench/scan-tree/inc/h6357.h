@@ -0,0 +1,42 @@
+#pragma once
+/* header 6357 */
+#include <vector>
+#include "h4951.h"
+#include "h9864.h"
+#include "h4816.h"
+#include "h8267.h"
+#include "h1219.h"
+#ifdef X
+#include "h6718.h"
+#endif
+struct S6357 { int a; const char *s = "x//y"; };
+inline int f6357_0(int x) { return x * 0; }
+inline int f6357_1(int x) { return x * 1; }
+inline int f6357_2(int x) { return x * 2; }
+inline int f6357_3(int x) { return x * 3; }
+inline int f6357_4(int x) { return x * 4; }
+inline int f6357_5(int x) { return x * 5; }
+inline int f6357_6(int x) { return x * 6; }
+inline int f6357_7(int x) { return x * 7; }
+inline int f6357_8(int x) { return x * 8; }
+inline int f6357_9(int x) { return x * 9; }
+inline int f6357_10(int x) { return x * 10; }
+inline int f6357_11(int x) { return x * 11; }
+inline int f6357_12(int x) { return x * 12; }
+inline int f6357_13(int x) { return x * 13; }
+inline int f6357_14(int x) { return x * 14; }
+inline int f6357_15(int x) { return x * 15; }
+inline int f6357_16(int x) { return x * 16; }
+inline int f6357_17(int x) { return x * 17; }
+inline int f6357_18(int x) { return x * 18; }
+inline int f6357_19(int x) { return x * 19; }
+inline int f6357_20(int x) { return x * 20; }
+inline int f6357_21(int x) { return x * 21; }
+inline int f6357_22(int x) { return x * 22; }
+inline int f6357_23(int x) { return x * 23; }
+inline int f6357_24(int x) { return x * 24; }
+inline int f6357_25(int x) { return x * 25; }
+inline int f6357_26(int x) { return x * 26; }
+inline int f6357_27(int x) { return x * 27; }
+inline int f6357_28(int x) { return x * 28; }
+inline int f6357_29(int x) { return x * 29; }
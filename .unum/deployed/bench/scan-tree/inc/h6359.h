@@ -0,0 +1,42 @@
+#pragma once
+/* header 6359 */
+#include <vector>
+#include "h5770.h"
+#include "h1327.h"
+#include "h5956.h"
+#include "h4736.h"
+#include "h7272.h"
+#ifdef X
+#include "h9389.h"
+#endif
+struct S6359 { int a; const char *s = "x//y"; };
+inline int f6359_0(int x) { return x * 0; }
+inline int f6359_1(int x) { return x * 1; }
+inline int f6359_2(int x) { return x * 2; }
+inline int f6359_3(int x) { return x * 3; }
+inline int f6359_4(int x) { return x * 4; }
+inline int f6359_5(int x) { return x * 5; }
+inline int f6359_6(int x) { return x * 6; }
+inline int f6359_7(int x) { return x * 7; }
+inline int f6359_8(int x) { return x * 8; }
+inline int f6359_9(int x) { return x * 9; }
+inline int f6359_10(int x) { return x * 10; }
+inline int f6359_11(int x) { return x * 11; }
+inline int f6359_12(int x) { return x * 12; }
+inline int f6359_13(int x) { return x * 13; }
+inline int f6359_14(int x) { return x * 14; }
+inline int f6359_15(int x) { return x * 15; }
+inline int f6359_16(int x) { return x * 16; }
+inline int f6359_17(int x) { return x * 17; }
+inline int f6359_18(int x) { return x * 18; }
+inline int f6359_19(int x) { return x * 19; }
+inline int f6359_20(int x) { return x * 20; }
+inline int f6359_21(int x) { return x * 21; }
+inline int f6359_22(int x) { return x * 22; }
+inline int f6359_23(int x) { return x * 23; }
+inline int f6359_24(int x) { return x * 24; }
+inline int f6359_25(int x) { return x * 25; }
+inline int f6359_26(int x) { return x * 26; }
+inline int f6359_27(int x) { return x * 27; }
+inline int f6359_28(int x) { return x * 28; }
+inline int f6359_29(int x) { return x * 29; }
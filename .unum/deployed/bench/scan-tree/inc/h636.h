@@ -0,0 +1,42 @@
+#pragma once
+/* header 636 */
+#include <vector>
+#include "h6256.h"
+#include "h188.h"
+#include "h7672.h"
+#include "h709.h"
+#include "h2847.h"
+#ifdef X
+#include "h7840.h"
+#endif
+struct S636 { int a; const char *s = "x//y"; };
+inline int f636_0(int x) { return x * 0; }
+inline int f636_1(int x) { return x * 1; }
+inline int f636_2(int x) { return x * 2; }
+inline int f636_3(int x) { return x * 3; }
+inline int f636_4(int x) { return x * 4; }
+inline int f636_5(int x) { return x * 5; }
+inline int f636_6(int x) { return x * 6; }
+inline int f636_7(int x) { return x * 7; }
+inline int f636_8(int x) { return x * 8; }
+inline int f636_9(int x) { return x * 9; }
+inline int f636_10(int x) { return x * 10; }
+inline int f636_11(int x) { return x * 11; }
+inline int f636_12(int x) { return x * 12; }
+inline int f636_13(int x) { return x * 13; }
+inline int f636_14(int x) { return x * 14; }
+inline int f636_15(int x) { return x * 15; }
+inline int f636_16(int x) { return x * 16; }
+inline int f636_17(int x) { return x * 17; }
+inline int f636_18(int x) { return x * 18; }
+inline int f636_19(int x) { return x * 19; }
+inline int f636_20(int x) { return x * 20; }
+inline int f636_21(int x) { return x * 21; }
+inline int f636_22(int x) { return x * 22; }
+inline int f636_23(int x) { return x * 23; }
+inline int f636_24(int x) { return x * 24; }
+inline int f636_25(int x) { return x * 25; }
+inline int f636_26(int x) { return x * 26; }
+inline int f636_27(int x) { return x * 27; }
+inline int f636_28(int x) { return x * 28; }
+inline int f636_29(int x) { return x * 29; }
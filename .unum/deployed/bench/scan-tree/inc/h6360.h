@@ -0,0 +1,42 @@
+#pragma once
+/* header 6360 */
+#include <vector>
+#include "h8012.h"
+#include "h3610.h"
+#include "h9210.h"
+#include "h7990.h"
+#include "h401.h"
+#ifdef X
+#include "h761.h"
+#endif
+struct S6360 { int a; const char *s = "x//y"; };
+inline int f6360_0(int x) { return x * 0; }
+inline int f6360_1(int x) { return x * 1; }
+inline int f6360_2(int x) { return x * 2; }
+inline int f6360_3(int x) { return x * 3; }
+inline int f6360_4(int x) { return x * 4; }
+inline int f6360_5(int x) { return x * 5; }
+inline int f6360_6(int x) { return x * 6; }
+inline int f6360_7(int x) { return x * 7; }
+inline int f6360_8(int x) { return x * 8; }
+inline int f6360_9(int x) { return x * 9; }
+inline int f6360_10(int x) { return x * 10; }
+inline int f6360_11(int x) { return x * 11; }
+inline int f6360_12(int x) { return x * 12; }
+inline int f6360_13(int x) { return x * 13; }
+inline int f6360_14(int x) { return x * 14; }
+inline int f6360_15(int x) { return x * 15; }
+inline int f6360_16(int x) { return x * 16; }
+inline int f6360_17(int x) { return x * 17; }
+inline int f6360_18(int x) { return x * 18; }
+inline int f6360_19(int x) { return x * 19; }
+inline int f6360_20(int x) { return x * 20; }
+inline int f6360_21(int x) { return x * 21; }
+inline int f6360_22(int x) { return x * 22; }
+inline int f6360_23(int x) { return x * 23; }
+inline int f6360_24(int x) { return x * 24; }
+inline int f6360_25(int x) { return x * 25; }
+inline int f6360_26(int x) { return x * 26; }
+inline int f6360_27(int x) { return x * 27; }
+inline int f6360_28(int x) { return x * 28; }
+inline int f6360_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6363 */
+#include <vector>
+#include "h2164.h"
+#include "h4132.h"
+#include "h6569.h"
+#include "h5944.h"
+#include "h6138.h"
+#ifdef X
+#include "h4882.h"
+#endif
+struct S6363 { int a; const char *s = "x//y"; };
+inline int f6363_0(int x) { return x * 0; }
+inline int f6363_1(int x) { return x * 1; }
+inline int f6363_2(int x) { return x * 2; }
+inline int f6363_3(int x) { return x * 3; }
+inline int f6363_4(int x) { return x * 4; }
+inline int f6363_5(int x) { return x * 5; }
+inline int f6363_6(int x) { return x * 6; }
+inline int f6363_7(int x) { return x * 7; }
+inline int f6363_8(int x) { return x * 8; }
+inline int f6363_9(int x) { return x * 9; }
+inline int f6363_10(int x) { return x * 10; }
+inline int f6363_11(int x) { return x * 11; }
+inline int f6363_12(int x) { return x * 12; }
+inline int f6363_13(int x) { return x * 13; }
+inline int f6363_14(int x) { return x * 14; }
+inline int f6363_15(int x) { return x * 15; }
+inline int f6363_16(int x) { return x * 16; }
+inline int f6363_17(int x) { return x * 17; }
+inline int f6363_18(int x) { return x * 18; }
+inline int f6363_19(int x) { return x * 19; }
+inline int f6363_20(int x) { return x * 20; }
+inline int f6363_21(int x) { return x * 21; }
+inline int f6363_22(int x) { return x * 22; }
+inline int f6363_23(int x) { return x * 23; }
+inline int f6363_24(int x) { return x * 24; }
+inline int f6363_25(int x) { return x * 25; }
+inline int f6363_26(int x) { return x * 26; }
+inline int f6363_27(int x) { return x * 27; }
+inline int f6363_28(int x) { return x * 28; }
+inline int f6363_29(int x) { return x * 29; }
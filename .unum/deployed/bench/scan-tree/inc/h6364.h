@@ -0,0 +1,42 @@
+#pragma once
+/* header 6364 */
+#include <vector>
+#include "h2406.h"
+#include "h2636.h"
+#include "h2114.h"
+#include "h8030.h"
+#include "h7593.h"
+#ifdef X
+#include "h6564.h"
+#endif
+struct S6364 { int a; const char *s = "x//y"; };
+inline int f6364_0(int x) { return x * 0; }
+inline int f6364_1(int x) { return x * 1; }
+inline int f6364_2(int x) { return x * 2; }
+inline int f6364_3(int x) { return x * 3; }
+inline int f6364_4(int x) { return x * 4; }
+inline int f6364_5(int x) { return x * 5; }
+inline int f6364_6(int x) { return x * 6; }
+inline int f6364_7(int x) { return x * 7; }
+inline int f6364_8(int x) { return x * 8; }
+inline int f6364_9(int x) { return x * 9; }
+inline int f6364_10(int x) { return x * 10; }
+inline int f6364_11(int x) { return x * 11; }
+inline int f6364_12(int x) { return x * 12; }
+inline int f6364_13(int x) { return x * 13; }
+inline int f6364_14(int x) { return x * 14; }
+inline int f6364_15(int x) { return x * 15; }
+inline int f6364_16(int x) { return x * 16; }
+inline int f6364_17(int x) { return x * 17; }
+inline int f6364_18(int x) { return x * 18; }
+inline int f6364_19(int x) { return x * 19; }
+inline int f6364_20(int x) { return x * 20; }
+inline int f6364_21(int x) { return x * 21; }
+inline int f6364_22(int x) { return x * 22; }
+inline int f6364_23(int x) { return x * 23; }
+inline int f6364_24(int x) { return x * 24; }
+inline int f6364_25(int x) { return x * 25; }
+inline int f6364_26(int x) { return x * 26; }
+inline int f6364_27(int x) { return x * 27; }
+inline int f6364_28(int x) { return x * 28; }
+inline int f6364_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6366 */
+#include <vector>
+#include "h7451.h"
+#include "h9438.h"
+#include "h5622.h"
+#include "h6318.h"
+#include "h9874.h"
+#ifdef X
+#include "h7490.h"
+#endif
+struct S6366 { int a; const char *s = "x//y"; };
+inline int f6366_0(int x) { return x * 0; }
+inline int f6366_1(int x) { return x * 1; }
+inline int f6366_2(int x) { return x * 2; }
+inline int f6366_3(int x) { return x * 3; }
+inline int f6366_4(int x) { return x * 4; }
+inline int f6366_5(int x) { return x * 5; }
+inline int f6366_6(int x) { return x * 6; }
+inline int f6366_7(int x) { return x * 7; }
+inline int f6366_8(int x) { return x * 8; }
+inline int f6366_9(int x) { return x * 9; }
+inline int f6366_10(int x) { return x * 10; }
+inline int f6366_11(int x) { return x * 11; }
+inline int f6366_12(int x) { return x * 12; }
+inline int f6366_13(int x) { return x * 13; }
+inline int f6366_14(int x) { return x * 14; }
+inline int f6366_15(int x) { return x * 15; }
+inline int f6366_16(int x) { return x * 16; }
+inline int f6366_17(int x) { return x * 17; }
+inline int f6366_18(int x) { return x * 18; }
+inline int f6366_19(int x) { return x * 19; }
+inline int f6366_20(int x) { return x * 20; }
+inline int f6366_21(int x) { return x * 21; }
+inline int f6366_22(int x) { return x * 22; }
+inline int f6366_23(int x) { return x * 23; }
+inline int f6366_24(int x) { return x * 24; }
+inline int f6366_25(int x) { return x * 25; }
+inline int f6366_26(int x) { return x * 26; }
+inline int f6366_27(int x) { return x * 27; }
+inline int f6366_28(int x) { return x * 28; }
+inline int f6366_29(int x) { return x * 29; }
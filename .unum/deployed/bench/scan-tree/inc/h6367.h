@@ -0,0 +1,42 @@
+#pragma once
+/* header 6367 */
+#include <vector>
+#include "h4258.h"
+#include "h4975.h"
+#include "h222.h"
+#include "h7806.h"
+#include "h2721.h"
+#ifdef X
+#include "h2414.h"
+#endif
+struct S6367 { int a; const char *s = "x//y"; };
+inline int f6367_0(int x) { return x * 0; }
+inline int f6367_1(int x) { return x * 1; }
+inline int f6367_2(int x) { return x * 2; }
+inline int f6367_3(int x) { return x * 3; }
+inline int f6367_4(int x) { return x * 4; }
+inline int f6367_5(int x) { return x * 5; }
+inline int f6367_6(int x) { return x * 6; }
+inline int f6367_7(int x) { return x * 7; }
+inline int f6367_8(int x) { return x * 8; }
+inline int f6367_9(int x) { return x * 9; }
+inline int f6367_10(int x) { return x * 10; }
+inline int f6367_11(int x) { return x * 11; }
+inline int f6367_12(int x) { return x * 12; }
+inline int f6367_13(int x) { return x * 13; }
+inline int f6367_14(int x) { return x * 14; }
+inline int f6367_15(int x) { return x * 15; }
+inline int f6367_16(int x) { return x * 16; }
+inline int f6367_17(int x) { return x * 17; }
+inline int f6367_18(int x) { return x * 18; }
+inline int f6367_19(int x) { return x * 19; }
+inline int f6367_20(int x) { return x * 20; }
+inline int f6367_21(int x) { return x * 21; }
+inline int f6367_22(int x) { return x * 22; }
+inline int f6367_23(int x) { return x * 23; }
+inline int f6367_24(int x) { return x * 24; }
+inline int f6367_25(int x) { return x * 25; }
+inline int f6367_26(int x) { return x * 26; }
+inline int f6367_27(int x) { return x * 27; }
+inline int f6367_28(int x) { return x * 28; }
+inline int f6367_29(int x) { return x * 29; }
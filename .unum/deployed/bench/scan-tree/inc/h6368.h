@@ -0,0 +1,42 @@
+#pragma once
+/* header 6368 */
+#include <vector>
+#include "h3598.h"
+#include "h3248.h"
+#include "h5578.h"
+#include "h5571.h"
+#include "h8088.h"
+#ifdef X
+#include "h6911.h"
+#endif
+struct S6368 { int a; const char *s = "x//y"; };
+inline int f6368_0(int x) { return x * 0; }
+inline int f6368_1(int x) { return x * 1; }
+inline int f6368_2(int x) { return x * 2; }
+inline int f6368_3(int x) { return x * 3; }
+inline int f6368_4(int x) { return x * 4; }
+inline int f6368_5(int x) { return x * 5; }
+inline int f6368_6(int x) { return x * 6; }
+inline int f6368_7(int x) { return x * 7; }
+inline int f6368_8(int x) { return x * 8; }
+inline int f6368_9(int x) { return x * 9; }
+inline int f6368_10(int x) { return x * 10; }
+inline int f6368_11(int x) { return x * 11; }
+inline int f6368_12(int x) { return x * 12; }
+inline int f6368_13(int x) { return x * 13; }
+inline int f6368_14(int x) { return x * 14; }
+inline int f6368_15(int x) { return x * 15; }
+inline int f6368_16(int x) { return x * 16; }
+inline int f6368_17(int x) { return x * 17; }
+inline int f6368_18(int x) { return x * 18; }
+inline int f6368_19(int x) { return x * 19; }
+inline int f6368_20(int x) { return x * 20; }
+inline int f6368_21(int x) { return x * 21; }
+inline int f6368_22(int x) { return x * 22; }
+inline int f6368_23(int x) { return x * 23; }
+inline int f6368_24(int x) { return x * 24; }
+inline int f6368_25(int x) { return x * 25; }
+inline int f6368_26(int x) { return x * 26; }
+inline int f6368_27(int x) { return x * 27; }
+inline int f6368_28(int x) { return x * 28; }
+inline int f6368_29(int x) { return x * 29; }
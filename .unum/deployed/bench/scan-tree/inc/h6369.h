@@ -0,0 +1,42 @@
+#pragma once
+/* header 6369 */
+#include <vector>
+#include "h8032.h"
+#include "h5898.h"
+#include "h4031.h"
+#include "h4117.h"
+#include "h6455.h"
+#ifdef X
+#include "h1686.h"
+#endif
+struct S6369 { int a; const char *s = "x//y"; };
+inline int f6369_0(int x) { return x * 0; }
+inline int f6369_1(int x) { return x * 1; }
+inline int f6369_2(int x) { return x * 2; }
+inline int f6369_3(int x) { return x * 3; }
+inline int f6369_4(int x) { return x * 4; }
+inline int f6369_5(int x) { return x * 5; }
+inline int f6369_6(int x) { return x * 6; }
+inline int f6369_7(int x) { return x * 7; }
+inline int f6369_8(int x) { return x * 8; }
+inline int f6369_9(int x) { return x * 9; }
+inline int f6369_10(int x) { return x * 10; }
+inline int f6369_11(int x) { return x * 11; }
+inline int f6369_12(int x) { return x * 12; }
+inline int f6369_13(int x) { return x * 13; }
+inline int f6369_14(int x) { return x * 14; }
+inline int f6369_15(int x) { return x * 15; }
+inline int f6369_16(int x) { return x * 16; }
+inline int f6369_17(int x) { return x * 17; }
+inline int f6369_18(int x) { return x * 18; }
+inline int f6369_19(int x) { return x * 19; }
+inline int f6369_20(int x) { return x * 20; }
+inline int f6369_21(int x) { return x * 21; }
+inline int f6369_22(int x) { return x * 22; }
+inline int f6369_23(int x) { return x * 23; }
+inline int f6369_24(int x) { return x * 24; }
+inline int f6369_25(int x) { return x * 25; }
+inline int f6369_26(int x) { return x * 26; }
+inline int f6369_27(int x) { return x * 27; }
+inline int f6369_28(int x) { return x * 28; }
+inline int f6369_29(int x) { return x * 29; }
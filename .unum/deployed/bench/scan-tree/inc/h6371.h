@@ -0,0 +1,42 @@
+#pragma once
+/* header 6371 */
+#include <vector>
+#include "h6862.h"
+#include "h2306.h"
+#include "h4509.h"
+#include "h2370.h"
+#include "h6063.h"
+#ifdef X
+#include "h5295.h"
+#endif
+struct S6371 { int a; const char *s = "x//y"; };
+inline int f6371_0(int x) { return x * 0; }
+inline int f6371_1(int x) { return x * 1; }
+inline int f6371_2(int x) { return x * 2; }
+inline int f6371_3(int x) { return x * 3; }
+inline int f6371_4(int x) { return x * 4; }
+inline int f6371_5(int x) { return x * 5; }
+inline int f6371_6(int x) { return x * 6; }
+inline int f6371_7(int x) { return x * 7; }
+inline int f6371_8(int x) { return x * 8; }
+inline int f6371_9(int x) { return x * 9; }
+inline int f6371_10(int x) { return x * 10; }
+inline int f6371_11(int x) { return x * 11; }
+inline int f6371_12(int x) { return x * 12; }
+inline int f6371_13(int x) { return x * 13; }
+inline int f6371_14(int x) { return x * 14; }
+inline int f6371_15(int x) { return x * 15; }
+inline int f6371_16(int x) { return x * 16; }
+inline int f6371_17(int x) { return x * 17; }
+inline int f6371_18(int x) { return x * 18; }
+inline int f6371_19(int x) { return x * 19; }
+inline int f6371_20(int x) { return x * 20; }
+inline int f6371_21(int x) { return x * 21; }
+inline int f6371_22(int x) { return x * 22; }
+inline int f6371_23(int x) { return x * 23; }
+inline int f6371_24(int x) { return x * 24; }
+inline int f6371_25(int x) { return x * 25; }
+inline int f6371_26(int x) { return x * 26; }
+inline int f6371_27(int x) { return x * 27; }
+inline int f6371_28(int x) { return x * 28; }
+inline int f6371_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6374 */
+#include <vector>
+#include "h7538.h"
+#include "h5295.h"
+#include "h3532.h"
+#include "h8063.h"
+#include "h4753.h"
+#ifdef X
+#include "h1552.h"
+#endif
+struct S6374 { int a; const char *s = "x//y"; };
+inline int f6374_0(int x) { return x * 0; }
+inline int f6374_1(int x) { return x * 1; }
+inline int f6374_2(int x) { return x * 2; }
+inline int f6374_3(int x) { return x * 3; }
+inline int f6374_4(int x) { return x * 4; }
+inline int f6374_5(int x) { return x * 5; }
+inline int f6374_6(int x) { return x * 6; }
+inline int f6374_7(int x) { return x * 7; }
+inline int f6374_8(int x) { return x * 8; }
+inline int f6374_9(int x) { return x * 9; }
+inline int f6374_10(int x) { return x * 10; }
+inline int f6374_11(int x) { return x * 11; }
+inline int f6374_12(int x) { return x * 12; }
+inline int f6374_13(int x) { return x * 13; }
+inline int f6374_14(int x) { return x * 14; }
+inline int f6374_15(int x) { return x * 15; }
+inline int f6374_16(int x) { return x * 16; }
+inline int f6374_17(int x) { return x * 17; }
+inline int f6374_18(int x) { return x * 18; }
+inline int f6374_19(int x) { return x * 19; }
+inline int f6374_20(int x) { return x * 20; }
+inline int f6374_21(int x) { return x * 21; }
+inline int f6374_22(int x) { return x * 22; }
+inline int f6374_23(int x) { return x * 23; }
+inline int f6374_24(int x) { return x * 24; }
+inline int f6374_25(int x) { return x * 25; }
+inline int f6374_26(int x) { return x * 26; }
+inline int f6374_27(int x) { return x * 27; }
+inline int f6374_28(int x) { return x * 28; }
+inline int f6374_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6377 */
+#include <vector>
+#include "h2930.h"
+#include "h8373.h"
+#include "h2415.h"
+#include "h5636.h"
+#include "h9031.h"
+#ifdef X
+#include "h6110.h"
+#endif
+struct S6377 { int a; const char *s = "x//y"; };
+inline int f6377_0(int x) { return x * 0; }
+inline int f6377_1(int x) { return x * 1; }
+inline int f6377_2(int x) { return x * 2; }
+inline int f6377_3(int x) { return x * 3; }
+inline int f6377_4(int x) { return x * 4; }
+inline int f6377_5(int x) { return x * 5; }
+inline int f6377_6(int x) { return x * 6; }
+inline int f6377_7(int x) { return x * 7; }
+inline int f6377_8(int x) { return x * 8; }
+inline int f6377_9(int x) { return x * 9; }
+inline int f6377_10(int x) { return x * 10; }
+inline int f6377_11(int x) { return x * 11; }
+inline int f6377_12(int x) { return x * 12; }
+inline int f6377_13(int x) { return x * 13; }
+inline int f6377_14(int x) { return x * 14; }
+inline int f6377_15(int x) { return x * 15; }
+inline int f6377_16(int x) { return x * 16; }
+inline int f6377_17(int x) { return x * 17; }
+inline int f6377_18(int x) { return x * 18; }
+inline int f6377_19(int x) { return x * 19; }
+inline int f6377_20(int x) { return x * 20; }
+inline int f6377_21(int x) { return x * 21; }
+inline int f6377_22(int x) { return x * 22; }
+inline int f6377_23(int x) { return x * 23; }
+inline int f6377_24(int x) { return x * 24; }
+inline int f6377_25(int x) { return x * 25; }
+inline int f6377_26(int x) { return x * 26; }
+inline int f6377_27(int x) { return x * 27; }
+inline int f6377_28(int x) { return x * 28; }
+inline int f6377_29(int x) { return x * 29; }
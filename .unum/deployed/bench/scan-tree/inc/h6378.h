@@ -0,0 +1,42 @@
+#pragma once
+/* header 6378 */
+#include <vector>
+#include "h9661.h"
+#include "h3883.h"
+#include "h2608.h"
+#include "h4582.h"
+#include "h2842.h"
+#ifdef X
+#include "h7716.h"
+#endif
+struct S6378 { int a; const char *s = "x//y"; };
+inline int f6378_0(int x) { return x * 0; }
+inline int f6378_1(int x) { return x * 1; }
+inline int f6378_2(int x) { return x * 2; }
+inline int f6378_3(int x) { return x * 3; }
+inline int f6378_4(int x) { return x * 4; }
+inline int f6378_5(int x) { return x * 5; }
+inline int f6378_6(int x) { return x * 6; }
+inline int f6378_7(int x) { return x * 7; }
+inline int f6378_8(int x) { return x * 8; }
+inline int f6378_9(int x) { return x * 9; }
+inline int f6378_10(int x) { return x * 10; }
+inline int f6378_11(int x) { return x * 11; }
+inline int f6378_12(int x) { return x * 12; }
+inline int f6378_13(int x) { return x * 13; }
+inline int f6378_14(int x) { return x * 14; }
+inline int f6378_15(int x) { return x * 15; }
+inline int f6378_16(int x) { return x * 16; }
+inline int f6378_17(int x) { return x * 17; }
+inline int f6378_18(int x) { return x * 18; }
+inline int f6378_19(int x) { return x * 19; }
+inline int f6378_20(int x) { return x * 20; }
+inline int f6378_21(int x) { return x * 21; }
+inline int f6378_22(int x) { return x * 22; }
+inline int f6378_23(int x) { return x * 23; }
+inline int f6378_24(int x) { return x * 24; }
+inline int f6378_25(int x) { return x * 25; }
+inline int f6378_26(int x) { return x * 26; }
+inline int f6378_27(int x) { return x * 27; }
+inline int f6378_28(int x) { return x * 28; }
+inline int f6378_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6379 */
+#include <vector>
+#include "h663.h"
+#include "h7503.h"
+#include "h1674.h"
+#include "h6156.h"
+#include "h9915.h"
+#ifdef X
+#include "h6034.h"
+#endif
+struct S6379 { int a; const char *s = "x//y"; };
+inline int f6379_0(int x) { return x * 0; }
+inline int f6379_1(int x) { return x * 1; }
+inline int f6379_2(int x) { return x * 2; }
+inline int f6379_3(int x) { return x * 3; }
+inline int f6379_4(int x) { return x * 4; }
+inline int f6379_5(int x) { return x * 5; }
+inline int f6379_6(int x) { return x * 6; }
+inline int f6379_7(int x) { return x * 7; }
+inline int f6379_8(int x) { return x * 8; }
+inline int f6379_9(int x) { return x * 9; }
+inline int f6379_10(int x) { return x * 10; }
+inline int f6379_11(int x) { return x * 11; }
+inline int f6379_12(int x) { return x * 12; }
+inline int f6379_13(int x) { return x * 13; }
+inline int f6379_14(int x) { return x * 14; }
+inline int f6379_15(int x) { return x * 15; }
+inline int f6379_16(int x) { return x * 16; }
+inline int f6379_17(int x) { return x * 17; }
+inline int f6379_18(int x) { return x * 18; }
+inline int f6379_19(int x) { return x * 19; }
+inline int f6379_20(int x) { return x * 20; }
+inline int f6379_21(int x) { return x * 21; }
+inline int f6379_22(int x) { return x * 22; }
+inline int f6379_23(int x) { return x * 23; }
+inline int f6379_24(int x) { return x * 24; }
+inline int f6379_25(int x) { return x * 25; }
+inline int f6379_26(int x) { return x * 26; }
+inline int f6379_27(int x) { return x * 27; }
+inline int f6379_28(int x) { return x * 28; }
+inline int f6379_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 638 */
+#include <vector>
+#include "h2306.h"
+#include "h5549.h"
+#include "h4818.h"
+#include "h1066.h"
+#include "h3277.h"
+#ifdef X
+#include "h7859.h"
+#endif
+struct S638 { int a; const char *s = "x//y"; };
+inline int f638_0(int x) { return x * 0; }
+inline int f638_1(int x) { return x * 1; }
+inline int f638_2(int x) { return x * 2; }
+inline int f638_3(int x) { return x * 3; }
+inline int f638_4(int x) { return x * 4; }
+inline int f638_5(int x) { return x * 5; }
+inline int f638_6(int x) { return x * 6; }
+inline int f638_7(int x) { return x * 7; }
+inline int f638_8(int x) { return x * 8; }
+inline int f638_9(int x) { return x * 9; }
+inline int f638_10(int x) { return x * 10; }
+inline int f638_11(int x) { return x * 11; }
+inline int f638_12(int x) { return x * 12; }
+inline int f638_13(int x) { return x * 13; }
+inline int f638_14(int x) { return x * 14; }
+inline int f638_15(int x) { return x * 15; }
+inline int f638_16(int x) { return x * 16; }
+inline int f638_17(int x) { return x * 17; }
+inline int f638_18(int x) { return x * 18; }
+inline int f638_19(int x) { return x * 19; }
+inline int f638_20(int x) { return x * 20; }
+inline int f638_21(int x) { return x * 21; }
+inline int f638_22(int x) { return x * 22; }
+inline int f638_23(int x) { return x * 23; }
+inline int f638_24(int x) { return x * 24; }
+inline int f638_25(int x) { return x * 25; }
+inline int f638_26(int x) { return x * 26; }
+inline int f638_27(int x) { return x * 27; }
+inline int f638_28(int x) { return x * 28; }
+inline int f638_29(int x) { return x * 29; }
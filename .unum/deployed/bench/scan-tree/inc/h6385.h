@@ -0,0 +1,42 @@
+#pragma once
+/* header 6385 */
+#include <vector>
+#include "h5813.h"
+#include "h5708.h"
+#include "h6089.h"
+#include "h7320.h"
+#include "h8697.h"
+#ifdef X
+#include "h4149.h"
+#endif
+struct S6385 { int a; const char *s = "x//y"; };
+inline int f6385_0(int x) { return x * 0; }
+inline int f6385_1(int x) { return x * 1; }
+inline int f6385_2(int x) { return x * 2; }
+inline int f6385_3(int x) { return x * 3; }
+inline int f6385_4(int x) { return x * 4; }
+inline int f6385_5(int x) { return x * 5; }
+inline int f6385_6(int x) { return x * 6; }
+inline int f6385_7(int x) { return x * 7; }
+inline int f6385_8(int x) { return x * 8; }
+inline int f6385_9(int x) { return x * 9; }
+inline int f6385_10(int x) { return x * 10; }
+inline int f6385_11(int x) { return x * 11; }
+inline int f6385_12(int x) { return x * 12; }
+inline int f6385_13(int x) { return x * 13; }
+inline int f6385_14(int x) { return x * 14; }
+inline int f6385_15(int x) { return x * 15; }
+inline int f6385_16(int x) { return x * 16; }
+inline int f6385_17(int x) { return x * 17; }
+inline int f6385_18(int x) { return x * 18; }
+inline int f6385_19(int x) { return x * 19; }
+inline int f6385_20(int x) { return x * 20; }
+inline int f6385_21(int x) { return x * 21; }
+inline int f6385_22(int x) { return x * 22; }
+inline int f6385_23(int x) { return x * 23; }
+inline int f6385_24(int x) { return x * 24; }
+inline int f6385_25(int x) { return x * 25; }
+inline int f6385_26(int x) { return x * 26; }
+inline int f6385_27(int x) { return x * 27; }
+inline int f6385_28(int x) { return x * 28; }
+inline int f6385_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6389 */
+#include <vector>
+#include "h9438.h"
+#include "h6905.h"
+#include "h8005.h"
+#include "h5473.h"
+#include "h2319.h"
+#ifdef X
+#include "h548.h"
+#endif
+struct S6389 { int a; const char *s = "x//y"; };
+inline int f6389_0(int x) { return x * 0; }
+inline int f6389_1(int x) { return x * 1; }
+inline int f6389_2(int x) { return x * 2; }
+inline int f6389_3(int x) { return x * 3; }
+inline int f6389_4(int x) { return x * 4; }
+inline int f6389_5(int x) { return x * 5; }
+inline int f6389_6(int x) { return x * 6; }
+inline int f6389_7(int x) { return x * 7; }
+inline int f6389_8(int x) { return x * 8; }
+inline int f6389_9(int x) { return x * 9; }
+inline int f6389_10(int x) { return x * 10; }
+inline int f6389_11(int x) { return x * 11; }
+inline int f6389_12(int x) { return x * 12; }
+inline int f6389_13(int x) { return x * 13; }
+inline int f6389_14(int x) { return x * 14; }
+inline int f6389_15(int x) { return x * 15; }
+inline int f6389_16(int x) { return x * 16; }
+inline int f6389_17(int x) { return x * 17; }
+inline int f6389_18(int x) { return x * 18; }
+inline int f6389_19(int x) { return x * 19; }
+inline int f6389_20(int x) { return x * 20; }
+inline int f6389_21(int x) { return x * 21; }
+inline int f6389_22(int x) { return x * 22; }
+inline int f6389_23(int x) { return x * 23; }
+inline int f6389_24(int x) { return x * 24; }
+inline int f6389_25(int x) { return x * 25; }
+inline int f6389_26(int x) { return x * 26; }
+inline int f6389_27(int x) { return x * 27; }
+inline int f6389_28(int x) { return x * 28; }
+inline int f6389_29(int x) { return x * 29; }
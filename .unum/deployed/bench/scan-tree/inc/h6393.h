@@ -0,0 +1,42 @@
+#pragma once
+/* header 6393 */
+#include <vector>
+#include "h6258.h"
+#include "h7964.h"
+#include "h579.h"
+#include "h6693.h"
+#include "h8460.h"
+#ifdef X
+#include "h131.h"
+#endif
+struct S6393 { int a; const char *s = "x//y"; };
+inline int f6393_0(int x) { return x * 0; }
+inline int f6393_1(int x) { return x * 1; }
+inline int f6393_2(int x) { return x * 2; }
+inline int f6393_3(int x) { return x * 3; }
+inline int f6393_4(int x) { return x * 4; }
+inline int f6393_5(int x) { return x * 5; }
+inline int f6393_6(int x) { return x * 6; }
+inline int f6393_7(int x) { return x * 7; }
+inline int f6393_8(int x) { return x * 8; }
+inline int f6393_9(int x) { return x * 9; }
+inline int f6393_10(int x) { return x * 10; }
+inline int f6393_11(int x) { return x * 11; }
+inline int f6393_12(int x) { return x * 12; }
+inline int f6393_13(int x) { return x * 13; }
+inline int f6393_14(int x) { return x * 14; }
+inline int f6393_15(int x) { return x * 15; }
+inline int f6393_16(int x) { return x * 16; }
+inline int f6393_17(int x) { return x * 17; }
+inline int f6393_18(int x) { return x * 18; }
+inline int f6393_19(int x) { return x * 19; }
+inline int f6393_20(int x) { return x * 20; }
+inline int f6393_21(int x) { return x * 21; }
+inline int f6393_22(int x) { return x * 22; }
+inline int f6393_23(int x) { return x * 23; }
+inline int f6393_24(int x) { return x * 24; }
+inline int f6393_25(int x) { return x * 25; }
+inline int f6393_26(int x) { return x * 26; }
+inline int f6393_27(int x) { return x * 27; }
+inline int f6393_28(int x) { return x * 28; }
+inline int f6393_29(int x) { return x * 29; }
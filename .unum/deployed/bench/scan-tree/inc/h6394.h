@@ -0,0 +1,42 @@
+#pragma once
+/* header 6394 */
+#include <vector>
+#include "h2281.h"
+#include "h8037.h"
+#include "h5968.h"
+#include "h5745.h"
+#include "h7603.h"
+#ifdef X
+#include "h5724.h"
+#endif
+struct S6394 { int a; const char *s = "x//y"; };
+inline int f6394_0(int x) { return x * 0; }
+inline int f6394_1(int x) { return x * 1; }
+inline int f6394_2(int x) { return x * 2; }
+inline int f6394_3(int x) { return x * 3; }
+inline int f6394_4(int x) { return x * 4; }
+inline int f6394_5(int x) { return x * 5; }
+inline int f6394_6(int x) { return x * 6; }
+inline int f6394_7(int x) { return x * 7; }
+inline int f6394_8(int x) { return x * 8; }
+inline int f6394_9(int x) { return x * 9; }
+inline int f6394_10(int x) { return x * 10; }
+inline int f6394_11(int x) { return x * 11; }
+inline int f6394_12(int x) { return x * 12; }
+inline int f6394_13(int x) { return x * 13; }
+inline int f6394_14(int x) { return x * 14; }
+inline int f6394_15(int x) { return x * 15; }
+inline int f6394_16(int x) { return x * 16; }
+inline int f6394_17(int x) { return x * 17; }
+inline int f6394_18(int x) { return x * 18; }
+inline int f6394_19(int x) { return x * 19; }
+inline int f6394_20(int x) { return x * 20; }
+inline int f6394_21(int x) { return x * 21; }
+inline int f6394_22(int x) { return x * 22; }
+inline int f6394_23(int x) { return x * 23; }
+inline int f6394_24(int x) { return x * 24; }
+inline int f6394_25(int x) { return x * 25; }
+inline int f6394_26(int x) { return x * 26; }
+inline int f6394_27(int x) { return x * 27; }
+inline int f6394_28(int x) { return x * 28; }
+inline int f6394_29(int x) { return x * 29; }
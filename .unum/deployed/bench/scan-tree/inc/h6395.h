@@ -0,0 +1,42 @@
+#pragma once
+/* header 6395 */
+#include <vector>
+#include "h8971.h"
+#include "h7668.h"
+#include "h9004.h"
+#include "h7204.h"
+#include "h3281.h"
+#ifdef X
+#include "h9706.h"
+#endif
+struct S6395 { int a; const char *s = "x//y"; };
+inline int f6395_0(int x) { return x * 0; }
+inline int f6395_1(int x) { return x * 1; }
+inline int f6395_2(int x) { return x * 2; }
+inline int f6395_3(int x) { return x * 3; }
+inline int f6395_4(int x) { return x * 4; }
+inline int f6395_5(int x) { return x * 5; }
+inline int f6395_6(int x) { return x * 6; }
+inline int f6395_7(int x) { return x * 7; }
+inline int f6395_8(int x) { return x * 8; }
+inline int f6395_9(int x) { return x * 9; }
+inline int f6395_10(int x) { return x * 10; }
+inline int f6395_11(int x) { return x * 11; }
+inline int f6395_12(int x) { return x * 12; }
+inline int f6395_13(int x) { return x * 13; }
+inline int f6395_14(int x) { return x * 14; }
+inline int f6395_15(int x) { return x * 15; }
+inline int f6395_16(int x) { return x * 16; }
+inline int f6395_17(int x) { return x * 17; }
+inline int f6395_18(int x) { return x * 18; }
+inline int f6395_19(int x) { return x * 19; }
+inline int f6395_20(int x) { return x * 20; }
+inline int f6395_21(int x) { return x * 21; }
+inline int f6395_22(int x) { return x * 22; }
+inline int f6395_23(int x) { return x * 23; }
+inline int f6395_24(int x) { return x * 24; }
+inline int f6395_25(int x) { return x * 25; }
+inline int f6395_26(int x) { return x * 26; }
+inline int f6395_27(int x) { return x * 27; }
+inline int f6395_28(int x) { return x * 28; }
+inline int f6395_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6397 */
+#include <vector>
+#include "h127.h"
+#include "h7432.h"
+#include "h2111.h"
+#include "h5046.h"
+#include "h3616.h"
+#ifdef X
+#include "h5985.h"
+#endif
+struct S6397 { int a; const char *s = "x//y"; };
+inline int f6397_0(int x) { return x * 0; }
+inline int f6397_1(int x) { return x * 1; }
+inline int f6397_2(int x) { return x * 2; }
+inline int f6397_3(int x) { return x * 3; }
+inline int f6397_4(int x) { return x * 4; }
+inline int f6397_5(int x) { return x * 5; }
+inline int f6397_6(int x) { return x * 6; }
+inline int f6397_7(int x) { return x * 7; }
+inline int f6397_8(int x) { return x * 8; }
+inline int f6397_9(int x) { return x * 9; }
+inline int f6397_10(int x) { return x * 10; }
+inline int f6397_11(int x) { return x * 11; }
+inline int f6397_12(int x) { return x * 12; }
+inline int f6397_13(int x) { return x * 13; }
+inline int f6397_14(int x) { return x * 14; }
+inline int f6397_15(int x) { return x * 15; }
+inline int f6397_16(int x) { return x * 16; }
+inline int f6397_17(int x) { return x * 17; }
+inline int f6397_18(int x) { return x * 18; }
+inline int f6397_19(int x) { return x * 19; }
+inline int f6397_20(int x) { return x * 20; }
+inline int f6397_21(int x) { return x * 21; }
+inline int f6397_22(int x) { return x * 22; }
+inline int f6397_23(int x) { return x * 23; }
+inline int f6397_24(int x) { return x * 24; }
+inline int f6397_25(int x) { return x * 25; }
+inline int f6397_26(int x) { return x * 26; }
+inline int f6397_27(int x) { return x * 27; }
+inline int f6397_28(int x) { return x * 28; }
+inline int f6397_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 64 */
+#include <vector>
+#include "h9225.h"
+#include "h6799.h"
+#include "h1723.h"
+#include "h2437.h"
+#include "h1700.h"
+#ifdef X
+#include "h4371.h"
+#endif
+struct S64 { int a; const char *s = "x//y"; };
+inline int f64_0(int x) { return x * 0; }
+inline int f64_1(int x) { return x * 1; }
+inline int f64_2(int x) { return x * 2; }
+inline int f64_3(int x) { return x * 3; }
+inline int f64_4(int x) { return x * 4; }
+inline int f64_5(int x) { return x * 5; }
+inline int f64_6(int x) { return x * 6; }
+inline int f64_7(int x) { return x * 7; }
+inline int f64_8(int x) { return x * 8; }
+inline int f64_9(int x) { return x * 9; }
+inline int f64_10(int x) { return x * 10; }
+inline int f64_11(int x) { return x * 11; }
+inline int f64_12(int x) { return x * 12; }
+inline int f64_13(int x) { return x * 13; }
+inline int f64_14(int x) { return x * 14; }
+inline int f64_15(int x) { return x * 15; }
+inline int f64_16(int x) { return x * 16; }
+inline int f64_17(int x) { return x * 17; }
+inline int f64_18(int x) { return x * 18; }
+inline int f64_19(int x) { return x * 19; }
+inline int f64_20(int x) { return x * 20; }
+inline int f64_21(int x) { return x * 21; }
+inline int f64_22(int x) { return x * 22; }
+inline int f64_23(int x) { return x * 23; }
+inline int f64_24(int x) { return x * 24; }
+inline int f64_25(int x) { return x * 25; }
+inline int f64_26(int x) { return x * 26; }
+inline int f64_27(int x) { return x * 27; }
+inline int f64_28(int x) { return x * 28; }
+inline int f64_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 640 */
+#include <vector>
+#include "h2044.h"
+#include "h6800.h"
+#include "h3420.h"
+#include "h3591.h"
+#include "h7136.h"
+#ifdef X
+#include "h908.h"
+#endif
+struct S640 { int a; const char *s = "x//y"; };
+inline int f640_0(int x) { return x * 0; }
+inline int f640_1(int x) { return x * 1; }
+inline int f640_2(int x) { return x * 2; }
+inline int f640_3(int x) { return x * 3; }
+inline int f640_4(int x) { return x * 4; }
+inline int f640_5(int x) { return x * 5; }
+inline int f640_6(int x) { return x * 6; }
+inline int f640_7(int x) { return x * 7; }
+inline int f640_8(int x) { return x * 8; }
+inline int f640_9(int x) { return x * 9; }
+inline int f640_10(int x) { return x * 10; }
+inline int f640_11(int x) { return x * 11; }
+inline int f640_12(int x) { return x * 12; }
+inline int f640_13(int x) { return x * 13; }
+inline int f640_14(int x) { return x * 14; }
+inline int f640_15(int x) { return x * 15; }
+inline int f640_16(int x) { return x * 16; }
+inline int f640_17(int x) { return x * 17; }
+inline int f640_18(int x) { return x * 18; }
+inline int f640_19(int x) { return x * 19; }
+inline int f640_20(int x) { return x * 20; }
+inline int f640_21(int x) { return x * 21; }
+inline int f640_22(int x) { return x * 22; }
+inline int f640_23(int x) { return x * 23; }
+inline int f640_24(int x) { return x * 24; }
+inline int f640_25(int x) { return x * 25; }
+inline int f640_26(int x) { return x * 26; }
+inline int f640_27(int x) { return x * 27; }
+inline int f640_28(int x) { return x * 28; }
+inline int f640_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6401 */
+#include <vector>
+#include "h7028.h"
+#include "h3002.h"
+#include "h5731.h"
+#include "h3365.h"
+#include "h5.h"
+#ifdef X
+#include "h2980.h"
+#endif
+struct S6401 { int a; const char *s = "x//y"; };
+inline int f6401_0(int x) { return x * 0; }
+inline int f6401_1(int x) { return x * 1; }
+inline int f6401_2(int x) { return x * 2; }
+inline int f6401_3(int x) { return x * 3; }
+inline int f6401_4(int x) { return x * 4; }
+inline int f6401_5(int x) { return x * 5; }
+inline int f6401_6(int x) { return x * 6; }
+inline int f6401_7(int x) { return x * 7; }
+inline int f6401_8(int x) { return x * 8; }
+inline int f6401_9(int x) { return x * 9; }
+inline int f6401_10(int x) { return x * 10; }
+inline int f6401_11(int x) { return x * 11; }
+inline int f6401_12(int x) { return x * 12; }
+inline int f6401_13(int x) { return x * 13; }
+inline int f6401_14(int x) { return x * 14; }
+inline int f6401_15(int x) { return x * 15; }
+inline int f6401_16(int x) { return x * 16; }
+inline int f6401_17(int x) { return x * 17; }
+inline int f6401_18(int x) { return x * 18; }
+inline int f6401_19(int x) { return x * 19; }
+inline int f6401_20(int x) { return x * 20; }
+inline int f6401_21(int x) { return x * 21; }
+inline int f6401_22(int x) { return x * 22; }
+inline int f6401_23(int x) { return x * 23; }
+inline int f6401_24(int x) { return x * 24; }
+inline int f6401_25(int x) { return x * 25; }
+inline int f6401_26(int x) { return x * 26; }
+inline int f6401_27(int x) { return x * 27; }
+inline int f6401_28(int x) { return x * 28; }
+inline int f6401_29(int x) { return x * 29; }
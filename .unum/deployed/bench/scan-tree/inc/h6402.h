@@ -0,0 +1,42 @@
+#pragma once
+/* header 6402 */
+#include <vector>
+#include "h2347.h"
+#include "h2677.h"
+#include "h1490.h"
+#include "h8475.h"
+#include "h4853.h"
+#ifdef X
+#include "h2181.h"
+#endif
+struct S6402 { int a; const char *s = "x//y"; };
+inline int f6402_0(int x) { return x * 0; }
+inline int f6402_1(int x) { return x * 1; }
+inline int f6402_2(int x) { return x * 2; }
+inline int f6402_3(int x) { return x * 3; }
+inline int f6402_4(int x) { return x * 4; }
+inline int f6402_5(int x) { return x * 5; }
+inline int f6402_6(int x) { return x * 6; }
+inline int f6402_7(int x) { return x * 7; }
+inline int f6402_8(int x) { return x * 8; }
+inline int f6402_9(int x) { return x * 9; }
+inline int f6402_10(int x) { return x * 10; }
+inline int f6402_11(int x) { return x * 11; }
+inline int f6402_12(int x) { return x * 12; }
+inline int f6402_13(int x) { return x * 13; }
+inline int f6402_14(int x) { return x * 14; }
+inline int f6402_15(int x) { return x * 15; }
+inline int f6402_16(int x) { return x * 16; }
+inline int f6402_17(int x) { return x * 17; }
+inline int f6402_18(int x) { return x * 18; }
+inline int f6402_19(int x) { return x * 19; }
+inline int f6402_20(int x) { return x * 20; }
+inline int f6402_21(int x) { return x * 21; }
+inline int f6402_22(int x) { return x * 22; }
+inline int f6402_23(int x) { return x * 23; }
+inline int f6402_24(int x) { return x * 24; }
+inline int f6402_25(int x) { return x * 25; }
+inline int f6402_26(int x) { return x * 26; }
+inline int f6402_27(int x) { return x * 27; }
+inline int f6402_28(int x) { return x * 28; }
+inline int f6402_29(int x) { return x * 29; }
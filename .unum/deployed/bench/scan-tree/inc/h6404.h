@@ -0,0 +1,42 @@
+#pragma once
+/* header 6404 */
+#include <vector>
+#include "h5752.h"
+#include "h3528.h"
+#include "h8921.h"
+#include "h8338.h"
+#include "h8669.h"
+#ifdef X
+#include "h7012.h"
+#endif
+struct S6404 { int a; const char *s = "x//y"; };
+inline int f6404_0(int x) { return x * 0; }
+inline int f6404_1(int x) { return x * 1; }
+inline int f6404_2(int x) { return x * 2; }
+inline int f6404_3(int x) { return x * 3; }
+inline int f6404_4(int x) { return x * 4; }
+inline int f6404_5(int x) { return x * 5; }
+inline int f6404_6(int x) { return x * 6; }
+inline int f6404_7(int x) { return x * 7; }
+inline int f6404_8(int x) { return x * 8; }
+inline int f6404_9(int x) { return x * 9; }
+inline int f6404_10(int x) { return x * 10; }
+inline int f6404_11(int x) { return x * 11; }
+inline int f6404_12(int x) { return x * 12; }
+inline int f6404_13(int x) { return x * 13; }
+inline int f6404_14(int x) { return x * 14; }
+inline int f6404_15(int x) { return x * 15; }
+inline int f6404_16(int x) { return x * 16; }
+inline int f6404_17(int x) { return x * 17; }
+inline int f6404_18(int x) { return x * 18; }
+inline int f6404_19(int x) { return x * 19; }
+inline int f6404_20(int x) { return x * 20; }
+inline int f6404_21(int x) { return x * 21; }
+inline int f6404_22(int x) { return x * 22; }
+inline int f6404_23(int x) { return x * 23; }
+inline int f6404_24(int x) { return x * 24; }
+inline int f6404_25(int x) { return x * 25; }
+inline int f6404_26(int x) { return x * 26; }
+inline int f6404_27(int x) { return x * 27; }
+inline int f6404_28(int x) { return x * 28; }
+inline int f6404_29(int x) { return x * 29; }
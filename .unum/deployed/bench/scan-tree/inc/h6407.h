@@ -0,0 +1,42 @@
+#pragma once
+/* header 6407 */
+#include <vector>
+#include "h1704.h"
+#include "h4418.h"
+#include "h9572.h"
+#include "h7353.h"
+#include "h1448.h"
+#ifdef X
+#include "h6795.h"
+#endif
+struct S6407 { int a; const char *s = "x//y"; };
+inline int f6407_0(int x) { return x * 0; }
+inline int f6407_1(int x) { return x * 1; }
+inline int f6407_2(int x) { return x * 2; }
+inline int f6407_3(int x) { return x * 3; }
+inline int f6407_4(int x) { return x * 4; }
+inline int f6407_5(int x) { return x * 5; }
+inline int f6407_6(int x) { return x * 6; }
+inline int f6407_7(int x) { return x * 7; }
+inline int f6407_8(int x) { return x * 8; }
+inline int f6407_9(int x) { return x * 9; }
+inline int f6407_10(int x) { return x * 10; }
+inline int f6407_11(int x) { return x * 11; }
+inline int f6407_12(int x) { return x * 12; }
+inline int f6407_13(int x) { return x * 13; }
+inline int f6407_14(int x) { return x * 14; }
+inline int f6407_15(int x) { return x * 15; }
+inline int f6407_16(int x) { return x * 16; }
+inline int f6407_17(int x) { return x * 17; }
+inline int f6407_18(int x) { return x * 18; }
+inline int f6407_19(int x) { return x * 19; }
+inline int f6407_20(int x) { return x * 20; }
+inline int f6407_21(int x) { return x * 21; }
+inline int f6407_22(int x) { return x * 22; }
+inline int f6407_23(int x) { return x * 23; }
+inline int f6407_24(int x) { return x * 24; }
+inline int f6407_25(int x) { return x * 25; }
+inline int f6407_26(int x) { return x * 26; }
+inline int f6407_27(int x) { return x * 27; }
+inline int f6407_28(int x) { return x * 28; }
+inline int f6407_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6409 */
+#include <vector>
+#include "h5971.h"
+#include "h6562.h"
+#include "h2225.h"
+#include "h1561.h"
+#include "h7533.h"
+#ifdef X
+#include "h170.h"
+#endif
+struct S6409 { int a; const char *s = "x//y"; };
+inline int f6409_0(int x) { return x * 0; }
+inline int f6409_1(int x) { return x * 1; }
+inline int f6409_2(int x) { return x * 2; }
+inline int f6409_3(int x) { return x * 3; }
+inline int f6409_4(int x) { return x * 4; }
+inline int f6409_5(int x) { return x * 5; }
+inline int f6409_6(int x) { return x * 6; }
+inline int f6409_7(int x) { return x * 7; }
+inline int f6409_8(int x) { return x * 8; }
+inline int f6409_9(int x) { return x * 9; }
+inline int f6409_10(int x) { return x * 10; }
+inline int f6409_11(int x) { return x * 11; }
+inline int f6409_12(int x) { return x * 12; }
+inline int f6409_13(int x) { return x * 13; }
+inline int f6409_14(int x) { return x * 14; }
+inline int f6409_15(int x) { return x * 15; }
+inline int f6409_16(int x) { return x * 16; }
+inline int f6409_17(int x) { return x * 17; }
+inline int f6409_18(int x) { return x * 18; }
+inline int f6409_19(int x) { return x * 19; }
+inline int f6409_20(int x) { return x * 20; }
+inline int f6409_21(int x) { return x * 21; }
+inline int f6409_22(int x) { return x * 22; }
+inline int f6409_23(int x) { return x * 23; }
+inline int f6409_24(int x) { return x * 24; }
+inline int f6409_25(int x) { return x * 25; }
+inline int f6409_26(int x) { return x * 26; }
+inline int f6409_27(int x) { return x * 27; }
+inline int f6409_28(int x) { return x * 28; }
+inline int f6409_29(int x) { return x * 29; }
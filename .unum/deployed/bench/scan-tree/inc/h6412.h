@@ -0,0 +1,42 @@
+#pragma once
+/* header 6412 */
+#include <vector>
+#include "h5732.h"
+#include "h3477.h"
+#include "h2185.h"
+#include "h7253.h"
+#include "h9279.h"
+#ifdef X
+#include "h967.h"
+#endif
+struct S6412 { int a; const char *s = "x//y"; };
+inline int f6412_0(int x) { return x * 0; }
+inline int f6412_1(int x) { return x * 1; }
+inline int f6412_2(int x) { return x * 2; }
+inline int f6412_3(int x) { return x * 3; }
+inline int f6412_4(int x) { return x * 4; }
+inline int f6412_5(int x) { return x * 5; }
+inline int f6412_6(int x) { return x * 6; }
+inline int f6412_7(int x) { return x * 7; }
+inline int f6412_8(int x) { return x * 8; }
+inline int f6412_9(int x) { return x * 9; }
+inline int f6412_10(int x) { return x * 10; }
+inline int f6412_11(int x) { return x * 11; }
+inline int f6412_12(int x) { return x * 12; }
+inline int f6412_13(int x) { return x * 13; }
+inline int f6412_14(int x) { return x * 14; }
+inline int f6412_15(int x) { return x * 15; }
+inline int f6412_16(int x) { return x * 16; }
+inline int f6412_17(int x) { return x * 17; }
+inline int f6412_18(int x) { return x * 18; }
+inline int f6412_19(int x) { return x * 19; }
+inline int f6412_20(int x) { return x * 20; }
+inline int f6412_21(int x) { return x * 21; }
+inline int f6412_22(int x) { return x * 22; }
+inline int f6412_23(int x) { return x * 23; }
+inline int f6412_24(int x) { return x * 24; }
+inline int f6412_25(int x) { return x * 25; }
+inline int f6412_26(int x) { return x * 26; }
+inline int f6412_27(int x) { return x * 27; }
+inline int f6412_28(int x) { return x * 28; }
+inline int f6412_29(int x) { return x * 29; }
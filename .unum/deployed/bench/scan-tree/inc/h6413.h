@@ -0,0 +1,42 @@
+#pragma once
+/* header 6413 */
+#include <vector>
+#include "h5313.h"
+#include "h5579.h"
+#include "h9483.h"
+#include "h6495.h"
+#include "h7470.h"
+#ifdef X
+#include "h3232.h"
+#endif
+struct S6413 { int a; const char *s = "x//y"; };
+inline int f6413_0(int x) { return x * 0; }
+inline int f6413_1(int x) { return x * 1; }
+inline int f6413_2(int x) { return x * 2; }
+inline int f6413_3(int x) { return x * 3; }
+inline int f6413_4(int x) { return x * 4; }
+inline int f6413_5(int x) { return x * 5; }
+inline int f6413_6(int x) { return x * 6; }
+inline int f6413_7(int x) { return x * 7; }
+inline int f6413_8(int x) { return x * 8; }
+inline int f6413_9(int x) { return x * 9; }
+inline int f6413_10(int x) { return x * 10; }
+inline int f6413_11(int x) { return x * 11; }
+inline int f6413_12(int x) { return x * 12; }
+inline int f6413_13(int x) { return x * 13; }
+inline int f6413_14(int x) { return x * 14; }
+inline int f6413_15(int x) { return x * 15; }
+inline int f6413_16(int x) { return x * 16; }
+inline int f6413_17(int x) { return x * 17; }
+inline int f6413_18(int x) { return x * 18; }
+inline int f6413_19(int x) { return x * 19; }
+inline int f6413_20(int x) { return x * 20; }
+inline int f6413_21(int x) { return x * 21; }
+inline int f6413_22(int x) { return x * 22; }
+inline int f6413_23(int x) { return x * 23; }
+inline int f6413_24(int x) { return x * 24; }
+inline int f6413_25(int x) { return x * 25; }
+inline int f6413_26(int x) { return x * 26; }
+inline int f6413_27(int x) { return x * 27; }
+inline int f6413_28(int x) { return x * 28; }
+inline int f6413_29(int x) { return x * 29; }
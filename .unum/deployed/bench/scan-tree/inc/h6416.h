@@ -0,0 +1,42 @@
+#pragma once
+/* header 6416 */
+#include <vector>
+#include "h5453.h"
+#include "h5279.h"
+#include "h9774.h"
+#include "h5022.h"
+#include "h2334.h"
+#ifdef X
+#include "h4997.h"
+#endif
+struct S6416 { int a; const char *s = "x//y"; };
+inline int f6416_0(int x) { return x * 0; }
+inline int f6416_1(int x) { return x * 1; }
+inline int f6416_2(int x) { return x * 2; }
+inline int f6416_3(int x) { return x * 3; }
+inline int f6416_4(int x) { return x * 4; }
+inline int f6416_5(int x) { return x * 5; }
+inline int f6416_6(int x) { return x * 6; }
+inline int f6416_7(int x) { return x * 7; }
+inline int f6416_8(int x) { return x * 8; }
+inline int f6416_9(int x) { return x * 9; }
+inline int f6416_10(int x) { return x * 10; }
+inline int f6416_11(int x) { return x * 11; }
+inline int f6416_12(int x) { return x * 12; }
+inline int f6416_13(int x) { return x * 13; }
+inline int f6416_14(int x) { return x * 14; }
+inline int f6416_15(int x) { return x * 15; }
+inline int f6416_16(int x) { return x * 16; }
+inline int f6416_17(int x) { return x * 17; }
+inline int f6416_18(int x) { return x * 18; }
+inline int f6416_19(int x) { return x * 19; }
+inline int f6416_20(int x) { return x * 20; }
+inline int f6416_21(int x) { return x * 21; }
+inline int f6416_22(int x) { return x * 22; }
+inline int f6416_23(int x) { return x * 23; }
+inline int f6416_24(int x) { return x * 24; }
+inline int f6416_25(int x) { return x * 25; }
+inline int f6416_26(int x) { return x * 26; }
+inline int f6416_27(int x) { return x * 27; }
+inline int f6416_28(int x) { return x * 28; }
+inline int f6416_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6417 */
+#include <vector>
+#include "h4805.h"
+#include "h6010.h"
+#include "h2873.h"
+#include "h68.h"
+#include "h1322.h"
+#ifdef X
+#include "h7030.h"
+#endif
+struct S6417 { int a; const char *s = "x//y"; };
+inline int f6417_0(int x) { return x * 0; }
+inline int f6417_1(int x) { return x * 1; }
+inline int f6417_2(int x) { return x * 2; }
+inline int f6417_3(int x) { return x * 3; }
+inline int f6417_4(int x) { return x * 4; }
+inline int f6417_5(int x) { return x * 5; }
+inline int f6417_6(int x) { return x * 6; }
+inline int f6417_7(int x) { return x * 7; }
+inline int f6417_8(int x) { return x * 8; }
+inline int f6417_9(int x) { return x * 9; }
+inline int f6417_10(int x) { return x * 10; }
+inline int f6417_11(int x) { return x * 11; }
+inline int f6417_12(int x) { return x * 12; }
+inline int f6417_13(int x) { return x * 13; }
+inline int f6417_14(int x) { return x * 14; }
+inline int f6417_15(int x) { return x * 15; }
+inline int f6417_16(int x) { return x * 16; }
+inline int f6417_17(int x) { return x * 17; }
+inline int f6417_18(int x) { return x * 18; }
+inline int f6417_19(int x) { return x * 19; }
+inline int f6417_20(int x) { return x * 20; }
+inline int f6417_21(int x) { return x * 21; }
+inline int f6417_22(int x) { return x * 22; }
+inline int f6417_23(int x) { return x * 23; }
+inline int f6417_24(int x) { return x * 24; }
+inline int f6417_25(int x) { return x * 25; }
+inline int f6417_26(int x) { return x * 26; }
+inline int f6417_27(int x) { return x * 27; }
+inline int f6417_28(int x) { return x * 28; }
+inline int f6417_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6418 */
+#include <vector>
+#include "h5963.h"
+#include "h4357.h"
+#include "h4771.h"
+#include "h4537.h"
+#include "h6310.h"
+#ifdef X
+#include "h2770.h"
+#endif
+struct S6418 { int a; const char *s = "x//y"; };
+inline int f6418_0(int x) { return x * 0; }
+inline int f6418_1(int x) { return x * 1; }
+inline int f6418_2(int x) { return x * 2; }
+inline int f6418_3(int x) { return x * 3; }
+inline int f6418_4(int x) { return x * 4; }
+inline int f6418_5(int x) { return x * 5; }
+inline int f6418_6(int x) { return x * 6; }
+inline int f6418_7(int x) { return x * 7; }
+inline int f6418_8(int x) { return x * 8; }
+inline int f6418_9(int x) { return x * 9; }
+inline int f6418_10(int x) { return x * 10; }
+inline int f6418_11(int x) { return x * 11; }
+inline int f6418_12(int x) { return x * 12; }
+inline int f6418_13(int x) { return x * 13; }
+inline int f6418_14(int x) { return x * 14; }
+inline int f6418_15(int x) { return x * 15; }
+inline int f6418_16(int x) { return x * 16; }
+inline int f6418_17(int x) { return x * 17; }
+inline int f6418_18(int x) { return x * 18; }
+inline int f6418_19(int x) { return x * 19; }
+inline int f6418_20(int x) { return x * 20; }
+inline int f6418_21(int x) { return x * 21; }
+inline int f6418_22(int x) { return x * 22; }
+inline int f6418_23(int x) { return x * 23; }
+inline int f6418_24(int x) { return x * 24; }
+inline int f6418_25(int x) { return x * 25; }
+inline int f6418_26(int x) { return x * 26; }
+inline int f6418_27(int x) { return x * 27; }
+inline int f6418_28(int x) { return x * 28; }
+inline int f6418_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6419 */
+#include <vector>
+#include "h8755.h"
+#include "h4839.h"
+#include "h8897.h"
+#include "h2210.h"
+#include "h6155.h"
+#ifdef X
+#include "h8270.h"
+#endif
+struct S6419 { int a; const char *s = "x//y"; };
+inline int f6419_0(int x) { return x * 0; }
+inline int f6419_1(int x) { return x * 1; }
+inline int f6419_2(int x) { return x * 2; }
+inline int f6419_3(int x) { return x * 3; }
+inline int f6419_4(int x) { return x * 4; }
+inline int f6419_5(int x) { return x * 5; }
+inline int f6419_6(int x) { return x * 6; }
+inline int f6419_7(int x) { return x * 7; }
+inline int f6419_8(int x) { return x * 8; }
+inline int f6419_9(int x) { return x * 9; }
+inline int f6419_10(int x) { return x * 10; }
+inline int f6419_11(int x) { return x * 11; }
+inline int f6419_12(int x) { return x * 12; }
+inline int f6419_13(int x) { return x * 13; }
+inline int f6419_14(int x) { return x * 14; }
+inline int f6419_15(int x) { return x * 15; }
+inline int f6419_16(int x) { return x * 16; }
+inline int f6419_17(int x) { return x * 17; }
+inline int f6419_18(int x) { return x * 18; }
+inline int f6419_19(int x) { return x * 19; }
+inline int f6419_20(int x) { return x * 20; }
+inline int f6419_21(int x) { return x * 21; }
+inline int f6419_22(int x) { return x * 22; }
+inline int f6419_23(int x) { return x * 23; }
+inline int f6419_24(int x) { return x * 24; }
+inline int f6419_25(int x) { return x * 25; }
+inline int f6419_26(int x) { return x * 26; }
+inline int f6419_27(int x) { return x * 27; }
+inline int f6419_28(int x) { return x * 28; }
+inline int f6419_29(int x) { return x * 29; }
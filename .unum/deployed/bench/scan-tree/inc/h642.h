@@ -0,0 +1,42 @@
+#pragma once
+/* header 642 */
+#include <vector>
+#include "h8170.h"
+#include "h9542.h"
+#include "h22.h"
+#include "h651.h"
+#include "h9286.h"
+#ifdef X
+#include "h1919.h"
+#endif
+struct S642 { int a; const char *s = "x//y"; };
+inline int f642_0(int x) { return x * 0; }
+inline int f642_1(int x) { return x * 1; }
+inline int f642_2(int x) { return x * 2; }
+inline int f642_3(int x) { return x * 3; }
+inline int f642_4(int x) { return x * 4; }
+inline int f642_5(int x) { return x * 5; }
+inline int f642_6(int x) { return x * 6; }
+inline int f642_7(int x) { return x * 7; }
+inline int f642_8(int x) { return x * 8; }
+inline int f642_9(int x) { return x * 9; }
+inline int f642_10(int x) { return x * 10; }
+inline int f642_11(int x) { return x * 11; }
+inline int f642_12(int x) { return x * 12; }
+inline int f642_13(int x) { return x * 13; }
+inline int f642_14(int x) { return x * 14; }
+inline int f642_15(int x) { return x * 15; }
+inline int f642_16(int x) { return x * 16; }
+inline int f642_17(int x) { return x * 17; }
+inline int f642_18(int x) { return x * 18; }
+inline int f642_19(int x) { return x * 19; }
+inline int f642_20(int x) { return x * 20; }
+inline int f642_21(int x) { return x * 21; }
+inline int f642_22(int x) { return x * 22; }
+inline int f642_23(int x) { return x * 23; }
+inline int f642_24(int x) { return x * 24; }
+inline int f642_25(int x) { return x * 25; }
+inline int f642_26(int x) { return x * 26; }
+inline int f642_27(int x) { return x * 27; }
+inline int f642_28(int x) { return x * 28; }
+inline int f642_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6420 */
+#include <vector>
+#include "h4322.h"
+#include "h8771.h"
+#include "h1868.h"
+#include "h6730.h"
+#include "h9865.h"
+#ifdef X
+#include "h1648.h"
+#endif
+struct S6420 { int a; const char *s = "x//y"; };
+inline int f6420_0(int x) { return x * 0; }
+inline int f6420_1(int x) { return x * 1; }
+inline int f6420_2(int x) { return x * 2; }
+inline int f6420_3(int x) { return x * 3; }
+inline int f6420_4(int x) { return x * 4; }
+inline int f6420_5(int x) { return x * 5; }
+inline int f6420_6(int x) { return x * 6; }
+inline int f6420_7(int x) { return x * 7; }
+inline int f6420_8(int x) { return x * 8; }
+inline int f6420_9(int x) { return x * 9; }
+inline int f6420_10(int x) { return x * 10; }
+inline int f6420_11(int x) { return x * 11; }
+inline int f6420_12(int x) { return x * 12; }
+inline int f6420_13(int x) { return x * 13; }
+inline int f6420_14(int x) { return x * 14; }
+inline int f6420_15(int x) { return x * 15; }
+inline int f6420_16(int x) { return x * 16; }
+inline int f6420_17(int x) { return x * 17; }
+inline int f6420_18(int x) { return x * 18; }
+inline int f6420_19(int x) { return x * 19; }
+inline int f6420_20(int x) { return x * 20; }
+inline int f6420_21(int x) { return x * 21; }
+inline int f6420_22(int x) { return x * 22; }
+inline int f6420_23(int x) { return x * 23; }
+inline int f6420_24(int x) { return x * 24; }
+inline int f6420_25(int x) { return x * 25; }
+inline int f6420_26(int x) { return x * 26; }
+inline int f6420_27(int x) { return x * 27; }
+inline int f6420_28(int x) { return x * 28; }
+inline int f6420_29(int x) { return x * 29; }
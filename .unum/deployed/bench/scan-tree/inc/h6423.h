@@ -0,0 +1,42 @@
+#pragma once
+/* header 6423 */
+#include <vector>
+#include "h6196.h"
+#include "h2577.h"
+#include "h8243.h"
+#include "h8192.h"
+#include "h9811.h"
+#ifdef X
+#include "h9682.h"
+#endif
+struct S6423 { int a; const char *s = "x//y"; };
+inline int f6423_0(int x) { return x * 0; }
+inline int f6423_1(int x) { return x * 1; }
+inline int f6423_2(int x) { return x * 2; }
+inline int f6423_3(int x) { return x * 3; }
+inline int f6423_4(int x) { return x * 4; }
+inline int f6423_5(int x) { return x * 5; }
+inline int f6423_6(int x) { return x * 6; }
+inline int f6423_7(int x) { return x * 7; }
+inline int f6423_8(int x) { return x * 8; }
+inline int f6423_9(int x) { return x * 9; }
+inline int f6423_10(int x) { return x * 10; }
+inline int f6423_11(int x) { return x * 11; }
+inline int f6423_12(int x) { return x * 12; }
+inline int f6423_13(int x) { return x * 13; }
+inline int f6423_14(int x) { return x * 14; }
+inline int f6423_15(int x) { return x * 15; }
+inline int f6423_16(int x) { return x * 16; }
+inline int f6423_17(int x) { return x * 17; }
+inline int f6423_18(int x) { return x * 18; }
+inline int f6423_19(int x) { return x * 19; }
+inline int f6423_20(int x) { return x * 20; }
+inline int f6423_21(int x) { return x * 21; }
+inline int f6423_22(int x) { return x * 22; }
+inline int f6423_23(int x) { return x * 23; }
+inline int f6423_24(int x) { return x * 24; }
+inline int f6423_25(int x) { return x * 25; }
+inline int f6423_26(int x) { return x * 26; }
+inline int f6423_27(int x) { return x * 27; }
+inline int f6423_28(int x) { return x * 28; }
+inline int f6423_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6424 */
+#include <vector>
+#include "h959.h"
+#include "h8976.h"
+#include "h4988.h"
+#include "h2112.h"
+#include "h975.h"
+#ifdef X
+#include "h9899.h"
+#endif
+struct S6424 { int a; const char *s = "x//y"; };
+inline int f6424_0(int x) { return x * 0; }
+inline int f6424_1(int x) { return x * 1; }
+inline int f6424_2(int x) { return x * 2; }
+inline int f6424_3(int x) { return x * 3; }
+inline int f6424_4(int x) { return x * 4; }
+inline int f6424_5(int x) { return x * 5; }
+inline int f6424_6(int x) { return x * 6; }
+inline int f6424_7(int x) { return x * 7; }
+inline int f6424_8(int x) { return x * 8; }
+inline int f6424_9(int x) { return x * 9; }
+inline int f6424_10(int x) { return x * 10; }
+inline int f6424_11(int x) { return x * 11; }
+inline int f6424_12(int x) { return x * 12; }
+inline int f6424_13(int x) { return x * 13; }
+inline int f6424_14(int x) { return x * 14; }
+inline int f6424_15(int x) { return x * 15; }
+inline int f6424_16(int x) { return x * 16; }
+inline int f6424_17(int x) { return x * 17; }
+inline int f6424_18(int x) { return x * 18; }
+inline int f6424_19(int x) { return x * 19; }
+inline int f6424_20(int x) { return x * 20; }
+inline int f6424_21(int x) { return x * 21; }
+inline int f6424_22(int x) { return x * 22; }
+inline int f6424_23(int x) { return x * 23; }
+inline int f6424_24(int x) { return x * 24; }
+inline int f6424_25(int x) { return x * 25; }
+inline int f6424_26(int x) { return x * 26; }
+inline int f6424_27(int x) { return x * 27; }
+inline int f6424_28(int x) { return x * 28; }
+inline int f6424_29(int x) { return x * 29; }
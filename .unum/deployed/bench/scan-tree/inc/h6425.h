@@ -0,0 +1,42 @@
+#pragma once
+/* header 6425 */
+#include <vector>
+#include "h7604.h"
+#include "h5593.h"
+#include "h2884.h"
+#include "h1855.h"
+#include "h4627.h"
+#ifdef X
+#include "h7972.h"
+#endif
+struct S6425 { int a; const char *s = "x//y"; };
+inline int f6425_0(int x) { return x * 0; }
+inline int f6425_1(int x) { return x * 1; }
+inline int f6425_2(int x) { return x * 2; }
+inline int f6425_3(int x) { return x * 3; }
+inline int f6425_4(int x) { return x * 4; }
+inline int f6425_5(int x) { return x * 5; }
+inline int f6425_6(int x) { return x * 6; }
+inline int f6425_7(int x) { return x * 7; }
+inline int f6425_8(int x) { return x * 8; }
+inline int f6425_9(int x) { return x * 9; }
+inline int f6425_10(int x) { return x * 10; }
+inline int f6425_11(int x) { return x * 11; }
+inline int f6425_12(int x) { return x * 12; }
+inline int f6425_13(int x) { return x * 13; }
+inline int f6425_14(int x) { return x * 14; }
+inline int f6425_15(int x) { return x * 15; }
+inline int f6425_16(int x) { return x * 16; }
+inline int f6425_17(int x) { return x * 17; }
+inline int f6425_18(int x) { return x * 18; }
+inline int f6425_19(int x) { return x * 19; }
+inline int f6425_20(int x) { return x * 20; }
+inline int f6425_21(int x) { return x * 21; }
+inline int f6425_22(int x) { return x * 22; }
+inline int f6425_23(int x) { return x * 23; }
+inline int f6425_24(int x) { return x * 24; }
+inline int f6425_25(int x) { return x * 25; }
+inline int f6425_26(int x) { return x * 26; }
+inline int f6425_27(int x) { return x * 27; }
+inline int f6425_28(int x) { return x * 28; }
+inline int f6425_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6428 */
+#include <vector>
+#include "h4623.h"
+#include "h9193.h"
+#include "h321.h"
+#include "h2605.h"
+#include "h2257.h"
+#ifdef X
+#include "h9399.h"
+#endif
+struct S6428 { int a; const char *s = "x//y"; };
+inline int f6428_0(int x) { return x * 0; }
+inline int f6428_1(int x) { return x * 1; }
+inline int f6428_2(int x) { return x * 2; }
+inline int f6428_3(int x) { return x * 3; }
+inline int f6428_4(int x) { return x * 4; }
+inline int f6428_5(int x) { return x * 5; }
+inline int f6428_6(int x) { return x * 6; }
+inline int f6428_7(int x) { return x * 7; }
+inline int f6428_8(int x) { return x * 8; }
+inline int f6428_9(int x) { return x * 9; }
+inline int f6428_10(int x) { return x * 10; }
+inline int f6428_11(int x) { return x * 11; }
+inline int f6428_12(int x) { return x * 12; }
+inline int f6428_13(int x) { return x * 13; }
+inline int f6428_14(int x) { return x * 14; }
+inline int f6428_15(int x) { return x * 15; }
+inline int f6428_16(int x) { return x * 16; }
+inline int f6428_17(int x) { return x * 17; }
+inline int f6428_18(int x) { return x * 18; }
+inline int f6428_19(int x) { return x * 19; }
+inline int f6428_20(int x) { return x * 20; }
+inline int f6428_21(int x) { return x * 21; }
+inline int f6428_22(int x) { return x * 22; }
+inline int f6428_23(int x) { return x * 23; }
+inline int f6428_24(int x) { return x * 24; }
+inline int f6428_25(int x) { return x * 25; }
+inline int f6428_26(int x) { return x * 26; }
+inline int f6428_27(int x) { return x * 27; }
+inline int f6428_28(int x) { return x * 28; }
+inline int f6428_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6430 */
+#include <vector>
+#include "h5769.h"
+#include "h2604.h"
+#include "h6657.h"
+#include "h6417.h"
+#include "h5429.h"
+#ifdef X
+#include "h3937.h"
+#endif
+struct S6430 { int a; const char *s = "x//y"; };
+inline int f6430_0(int x) { return x * 0; }
+inline int f6430_1(int x) { return x * 1; }
+inline int f6430_2(int x) { return x * 2; }
+inline int f6430_3(int x) { return x * 3; }
+inline int f6430_4(int x) { return x * 4; }
+inline int f6430_5(int x) { return x * 5; }
+inline int f6430_6(int x) { return x * 6; }
+inline int f6430_7(int x) { return x * 7; }
+inline int f6430_8(int x) { return x * 8; }
+inline int f6430_9(int x) { return x * 9; }
+inline int f6430_10(int x) { return x * 10; }
+inline int f6430_11(int x) { return x * 11; }
+inline int f6430_12(int x) { return x * 12; }
+inline int f6430_13(int x) { return x * 13; }
+inline int f6430_14(int x) { return x * 14; }
+inline int f6430_15(int x) { return x * 15; }
+inline int f6430_16(int x) { return x * 16; }
+inline int f6430_17(int x) { return x * 17; }
+inline int f6430_18(int x) { return x * 18; }
+inline int f6430_19(int x) { return x * 19; }
+inline int f6430_20(int x) { return x * 20; }
+inline int f6430_21(int x) { return x * 21; }
+inline int f6430_22(int x) { return x * 22; }
+inline int f6430_23(int x) { return x * 23; }
+inline int f6430_24(int x) { return x * 24; }
+inline int f6430_25(int x) { return x * 25; }
+inline int f6430_26(int x) { return x * 26; }
+inline int f6430_27(int x) { return x * 27; }
+inline int f6430_28(int x) { return x * 28; }
+inline int f6430_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6431 */
+#include <vector>
+#include "h2058.h"
+#include "h6220.h"
+#include "h1613.h"
+#include "h2111.h"
+#include "h3722.h"
+#ifdef X
+#include "h8430.h"
+#endif
+struct S6431 { int a; const char *s = "x//y"; };
+inline int f6431_0(int x) { return x * 0; }
+inline int f6431_1(int x) { return x * 1; }
+inline int f6431_2(int x) { return x * 2; }
+inline int f6431_3(int x) { return x * 3; }
+inline int f6431_4(int x) { return x * 4; }
+inline int f6431_5(int x) { return x * 5; }
+inline int f6431_6(int x) { return x * 6; }
+inline int f6431_7(int x) { return x * 7; }
+inline int f6431_8(int x) { return x * 8; }
+inline int f6431_9(int x) { return x * 9; }
+inline int f6431_10(int x) { return x * 10; }
+inline int f6431_11(int x) { return x * 11; }
+inline int f6431_12(int x) { return x * 12; }
+inline int f6431_13(int x) { return x * 13; }
+inline int f6431_14(int x) { return x * 14; }
+inline int f6431_15(int x) { return x * 15; }
+inline int f6431_16(int x) { return x * 16; }
+inline int f6431_17(int x) { return x * 17; }
+inline int f6431_18(int x) { return x * 18; }
+inline int f6431_19(int x) { return x * 19; }
+inline int f6431_20(int x) { return x * 20; }
+inline int f6431_21(int x) { return x * 21; }
+inline int f6431_22(int x) { return x * 22; }
+inline int f6431_23(int x) { return x * 23; }
+inline int f6431_24(int x) { return x * 24; }
+inline int f6431_25(int x) { return x * 25; }
+inline int f6431_26(int x) { return x * 26; }
+inline int f6431_27(int x) { return x * 27; }
+inline int f6431_28(int x) { return x * 28; }
+inline int f6431_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6432 */
+#include <vector>
+#include "h2032.h"
+#include "h8164.h"
+#include "h4170.h"
+#include "h3350.h"
+#include "h593.h"
+#ifdef X
+#include "h3748.h"
+#endif
+struct S6432 { int a; const char *s = "x//y"; };
+inline int f6432_0(int x) { return x * 0; }
+inline int f6432_1(int x) { return x * 1; }
+inline int f6432_2(int x) { return x * 2; }
+inline int f6432_3(int x) { return x * 3; }
+inline int f6432_4(int x) { return x * 4; }
+inline int f6432_5(int x) { return x * 5; }
+inline int f6432_6(int x) { return x * 6; }
+inline int f6432_7(int x) { return x * 7; }
+inline int f6432_8(int x) { return x * 8; }
+inline int f6432_9(int x) { return x * 9; }
+inline int f6432_10(int x) { return x * 10; }
+inline int f6432_11(int x) { return x * 11; }
+inline int f6432_12(int x) { return x * 12; }
+inline int f6432_13(int x) { return x * 13; }
+inline int f6432_14(int x) { return x * 14; }
+inline int f6432_15(int x) { return x * 15; }
+inline int f6432_16(int x) { return x * 16; }
+inline int f6432_17(int x) { return x * 17; }
+inline int f6432_18(int x) { return x * 18; }
+inline int f6432_19(int x) { return x * 19; }
+inline int f6432_20(int x) { return x * 20; }
+inline int f6432_21(int x) { return x * 21; }
+inline int f6432_22(int x) { return x * 22; }
+inline int f6432_23(int x) { return x * 23; }
+inline int f6432_24(int x) { return x * 24; }
+inline int f6432_25(int x) { return x * 25; }
+inline int f6432_26(int x) { return x * 26; }
+inline int f6432_27(int x) { return x * 27; }
+inline int f6432_28(int x) { return x * 28; }
+inline int f6432_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6433 */
+#include <vector>
+#include "h5552.h"
+#include "h4138.h"
+#include "h880.h"
+#include "h391.h"
+#include "h2313.h"
+#ifdef X
+#include "h9799.h"
+#endif
+struct S6433 { int a; const char *s = "x//y"; };
+inline int f6433_0(int x) { return x * 0; }
+inline int f6433_1(int x) { return x * 1; }
+inline int f6433_2(int x) { return x * 2; }
+inline int f6433_3(int x) { return x * 3; }
+inline int f6433_4(int x) { return x * 4; }
+inline int f6433_5(int x) { return x * 5; }
+inline int f6433_6(int x) { return x * 6; }
+inline int f6433_7(int x) { return x * 7; }
+inline int f6433_8(int x) { return x * 8; }
+inline int f6433_9(int x) { return x * 9; }
+inline int f6433_10(int x) { return x * 10; }
+inline int f6433_11(int x) { return x * 11; }
+inline int f6433_12(int x) { return x * 12; }
+inline int f6433_13(int x) { return x * 13; }
+inline int f6433_14(int x) { return x * 14; }
+inline int f6433_15(int x) { return x * 15; }
+inline int f6433_16(int x) { return x * 16; }
+inline int f6433_17(int x) { return x * 17; }
+inline int f6433_18(int x) { return x * 18; }
+inline int f6433_19(int x) { return x * 19; }
+inline int f6433_20(int x) { return x * 20; }
+inline int f6433_21(int x) { return x * 21; }
+inline int f6433_22(int x) { return x * 22; }
+inline int f6433_23(int x) { return x * 23; }
+inline int f6433_24(int x) { return x * 24; }
+inline int f6433_25(int x) { return x * 25; }
+inline int f6433_26(int x) { return x * 26; }
+inline int f6433_27(int x) { return x * 27; }
+inline int f6433_28(int x) { return x * 28; }
+inline int f6433_29(int x) { return x * 29; }
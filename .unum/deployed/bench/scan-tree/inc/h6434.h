@@ -0,0 +1,42 @@
+#pragma once
+/* header 6434 */
+#include <vector>
+#include "h2950.h"
+#include "h5458.h"
+#include "h5322.h"
+#include "h5563.h"
+#include "h7361.h"
+#ifdef X
+#include "h9846.h"
+#endif
+struct S6434 { int a; const char *s = "x//y"; };
+inline int f6434_0(int x) { return x * 0; }
+inline int f6434_1(int x) { return x * 1; }
+inline int f6434_2(int x) { return x * 2; }
+inline int f6434_3(int x) { return x * 3; }
+inline int f6434_4(int x) { return x * 4; }
+inline int f6434_5(int x) { return x * 5; }
+inline int f6434_6(int x) { return x * 6; }
+inline int f6434_7(int x) { return x * 7; }
+inline int f6434_8(int x) { return x * 8; }
+inline int f6434_9(int x) { return x * 9; }
+inline int f6434_10(int x) { return x * 10; }
+inline int f6434_11(int x) { return x * 11; }
+inline int f6434_12(int x) { return x * 12; }
+inline int f6434_13(int x) { return x * 13; }
+inline int f6434_14(int x) { return x * 14; }
+inline int f6434_15(int x) { return x * 15; }
+inline int f6434_16(int x) { return x * 16; }
+inline int f6434_17(int x) { return x * 17; }
+inline int f6434_18(int x) { return x * 18; }
+inline int f6434_19(int x) { return x * 19; }
+inline int f6434_20(int x) { return x * 20; }
+inline int f6434_21(int x) { return x * 21; }
+inline int f6434_22(int x) { return x * 22; }
+inline int f6434_23(int x) { return x * 23; }
+inline int f6434_24(int x) { return x * 24; }
+inline int f6434_25(int x) { return x * 25; }
+inline int f6434_26(int x) { return x * 26; }
+inline int f6434_27(int x) { return x * 27; }
+inline int f6434_28(int x) { return x * 28; }
+inline int f6434_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6436 */
+#include <vector>
+#include "h9023.h"
+#include "h2713.h"
+#include "h8949.h"
+#include "h8290.h"
+#include "h3363.h"
+#ifdef X
+#include "h4425.h"
+#endif
+struct S6436 { int a; const char *s = "x//y"; };
+inline int f6436_0(int x) { return x * 0; }
+inline int f6436_1(int x) { return x * 1; }
+inline int f6436_2(int x) { return x * 2; }
+inline int f6436_3(int x) { return x * 3; }
+inline int f6436_4(int x) { return x * 4; }
+inline int f6436_5(int x) { return x * 5; }
+inline int f6436_6(int x) { return x * 6; }
+inline int f6436_7(int x) { return x * 7; }
+inline int f6436_8(int x) { return x * 8; }
+inline int f6436_9(int x) { return x * 9; }
+inline int f6436_10(int x) { return x * 10; }
+inline int f6436_11(int x) { return x * 11; }
+inline int f6436_12(int x) { return x * 12; }
+inline int f6436_13(int x) { return x * 13; }
+inline int f6436_14(int x) { return x * 14; }
+inline int f6436_15(int x) { return x * 15; }
+inline int f6436_16(int x) { return x * 16; }
+inline int f6436_17(int x) { return x * 17; }
+inline int f6436_18(int x) { return x * 18; }
+inline int f6436_19(int x) { return x * 19; }
+inline int f6436_20(int x) { return x * 20; }
+inline int f6436_21(int x) { return x * 21; }
+inline int f6436_22(int x) { return x * 22; }
+inline int f6436_23(int x) { return x * 23; }
+inline int f6436_24(int x) { return x * 24; }
+inline int f6436_25(int x) { return x * 25; }
+inline int f6436_26(int x) { return x * 26; }
+inline int f6436_27(int x) { return x * 27; }
+inline int f6436_28(int x) { return x * 28; }
+inline int f6436_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6437 */
+#include <vector>
+#include "h2419.h"
+#include "h2916.h"
+#include "h4624.h"
+#include "h7890.h"
+#include "h4273.h"
+#ifdef X
+#include "h7635.h"
+#endif
+struct S6437 { int a; const char *s = "x//y"; };
+inline int f6437_0(int x) { return x * 0; }
+inline int f6437_1(int x) { return x * 1; }
+inline int f6437_2(int x) { return x * 2; }
+inline int f6437_3(int x) { return x * 3; }
+inline int f6437_4(int x) { return x * 4; }
+inline int f6437_5(int x) { return x * 5; }
+inline int f6437_6(int x) { return x * 6; }
+inline int f6437_7(int x) { return x * 7; }
+inline int f6437_8(int x) { return x * 8; }
+inline int f6437_9(int x) { return x * 9; }
+inline int f6437_10(int x) { return x * 10; }
+inline int f6437_11(int x) { return x * 11; }
+inline int f6437_12(int x) { return x * 12; }
+inline int f6437_13(int x) { return x * 13; }
+inline int f6437_14(int x) { return x * 14; }
+inline int f6437_15(int x) { return x * 15; }
+inline int f6437_16(int x) { return x * 16; }
+inline int f6437_17(int x) { return x * 17; }
+inline int f6437_18(int x) { return x * 18; }
+inline int f6437_19(int x) { return x * 19; }
+inline int f6437_20(int x) { return x * 20; }
+inline int f6437_21(int x) { return x * 21; }
+inline int f6437_22(int x) { return x * 22; }
+inline int f6437_23(int x) { return x * 23; }
+inline int f6437_24(int x) { return x * 24; }
+inline int f6437_25(int x) { return x * 25; }
+inline int f6437_26(int x) { return x * 26; }
+inline int f6437_27(int x) { return x * 27; }
+inline int f6437_28(int x) { return x * 28; }
+inline int f6437_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6438 */
+#include <vector>
+#include "h803.h"
+#include "h8401.h"
+#include "h8831.h"
+#include "h6656.h"
+#include "h3877.h"
+#ifdef X
+#include "h3506.h"
+#endif
+struct S6438 { int a; const char *s = "x//y"; };
+inline int f6438_0(int x) { return x * 0; }
+inline int f6438_1(int x) { return x * 1; }
+inline int f6438_2(int x) { return x * 2; }
+inline int f6438_3(int x) { return x * 3; }
+inline int f6438_4(int x) { return x * 4; }
+inline int f6438_5(int x) { return x * 5; }
+inline int f6438_6(int x) { return x * 6; }
+inline int f6438_7(int x) { return x * 7; }
+inline int f6438_8(int x) { return x * 8; }
+inline int f6438_9(int x) { return x * 9; }
+inline int f6438_10(int x) { return x * 10; }
+inline int f6438_11(int x) { return x * 11; }
+inline int f6438_12(int x) { return x * 12; }
+inline int f6438_13(int x) { return x * 13; }
+inline int f6438_14(int x) { return x * 14; }
+inline int f6438_15(int x) { return x * 15; }
+inline int f6438_16(int x) { return x * 16; }
+inline int f6438_17(int x) { return x * 17; }
+inline int f6438_18(int x) { return x * 18; }
+inline int f6438_19(int x) { return x * 19; }
+inline int f6438_20(int x) { return x * 20; }
+inline int f6438_21(int x) { return x * 21; }
+inline int f6438_22(int x) { return x * 22; }
+inline int f6438_23(int x) { return x * 23; }
+inline int f6438_24(int x) { return x * 24; }
+inline int f6438_25(int x) { return x * 25; }
+inline int f6438_26(int x) { return x * 26; }
+inline int f6438_27(int x) { return x * 27; }
+inline int f6438_28(int x) { return x * 28; }
+inline int f6438_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6439 */
+#include <vector>
+#include "h3602.h"
+#include "h6012.h"
+#include "h9241.h"
+#include "h1356.h"
+#include "h3565.h"
+#ifdef X
+#include "h5742.h"
+#endif
+struct S6439 { int a; const char *s = "x//y"; };
+inline int f6439_0(int x) { return x * 0; }
+inline int f6439_1(int x) { return x * 1; }
+inline int f6439_2(int x) { return x * 2; }
+inline int f6439_3(int x) { return x * 3; }
+inline int f6439_4(int x) { return x * 4; }
+inline int f6439_5(int x) { return x * 5; }
+inline int f6439_6(int x) { return x * 6; }
+inline int f6439_7(int x) { return x * 7; }
+inline int f6439_8(int x) { return x * 8; }
+inline int f6439_9(int x) { return x * 9; }
+inline int f6439_10(int x) { return x * 10; }
+inline int f6439_11(int x) { return x * 11; }
+inline int f6439_12(int x) { return x * 12; }
+inline int f6439_13(int x) { return x * 13; }
+inline int f6439_14(int x) { return x * 14; }
+inline int f6439_15(int x) { return x * 15; }
+inline int f6439_16(int x) { return x * 16; }
+inline int f6439_17(int x) { return x * 17; }
+inline int f6439_18(int x) { return x * 18; }
+inline int f6439_19(int x) { return x * 19; }
+inline int f6439_20(int x) { return x * 20; }
+inline int f6439_21(int x) { return x * 21; }
+inline int f6439_22(int x) { return x * 22; }
+inline int f6439_23(int x) { return x * 23; }
+inline int f6439_24(int x) { return x * 24; }
+inline int f6439_25(int x) { return x * 25; }
+inline int f6439_26(int x) { return x * 26; }
+inline int f6439_27(int x) { return x * 27; }
+inline int f6439_28(int x) { return x * 28; }
+inline int f6439_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 644 */
+#include <vector>
+#include "h1507.h"
+#include "h7999.h"
+#include "h7980.h"
+#include "h3195.h"
+#include "h1125.h"
+#ifdef X
+#include "h5144.h"
+#endif
+struct S644 { int a; const char *s = "x//y"; };
+inline int f644_0(int x) { return x * 0; }
+inline int f644_1(int x) { return x * 1; }
+inline int f644_2(int x) { return x * 2; }
+inline int f644_3(int x) { return x * 3; }
+inline int f644_4(int x) { return x * 4; }
+inline int f644_5(int x) { return x * 5; }
+inline int f644_6(int x) { return x * 6; }
+inline int f644_7(int x) { return x * 7; }
+inline int f644_8(int x) { return x * 8; }
+inline int f644_9(int x) { return x * 9; }
+inline int f644_10(int x) { return x * 10; }
+inline int f644_11(int x) { return x * 11; }
+inline int f644_12(int x) { return x * 12; }
+inline int f644_13(int x) { return x * 13; }
+inline int f644_14(int x) { return x * 14; }
+inline int f644_15(int x) { return x * 15; }
+inline int f644_16(int x) { return x * 16; }
+inline int f644_17(int x) { return x * 17; }
+inline int f644_18(int x) { return x * 18; }
+inline int f644_19(int x) { return x * 19; }
+inline int f644_20(int x) { return x * 20; }
+inline int f644_21(int x) { return x * 21; }
+inline int f644_22(int x) { return x * 22; }
+inline int f644_23(int x) { return x * 23; }
+inline int f644_24(int x) { return x * 24; }
+inline int f644_25(int x) { return x * 25; }
+inline int f644_26(int x) { return x * 26; }
+inline int f644_27(int x) { return x * 27; }
+inline int f644_28(int x) { return x * 28; }
+inline int f644_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6442 */
+#include <vector>
+#include "h3577.h"
+#include "h1144.h"
+#include "h1285.h"
+#include "h6923.h"
+#include "h9951.h"
+#ifdef X
+#include "h8547.h"
+#endif
+struct S6442 { int a; const char *s = "x//y"; };
+inline int f6442_0(int x) { return x * 0; }
+inline int f6442_1(int x) { return x * 1; }
+inline int f6442_2(int x) { return x * 2; }
+inline int f6442_3(int x) { return x * 3; }
+inline int f6442_4(int x) { return x * 4; }
+inline int f6442_5(int x) { return x * 5; }
+inline int f6442_6(int x) { return x * 6; }
+inline int f6442_7(int x) { return x * 7; }
+inline int f6442_8(int x) { return x * 8; }
+inline int f6442_9(int x) { return x * 9; }
+inline int f6442_10(int x) { return x * 10; }
+inline int f6442_11(int x) { return x * 11; }
+inline int f6442_12(int x) { return x * 12; }
+inline int f6442_13(int x) { return x * 13; }
+inline int f6442_14(int x) { return x * 14; }
+inline int f6442_15(int x) { return x * 15; }
+inline int f6442_16(int x) { return x * 16; }
+inline int f6442_17(int x) { return x * 17; }
+inline int f6442_18(int x) { return x * 18; }
+inline int f6442_19(int x) { return x * 19; }
+inline int f6442_20(int x) { return x * 20; }
+inline int f6442_21(int x) { return x * 21; }
+inline int f6442_22(int x) { return x * 22; }
+inline int f6442_23(int x) { return x * 23; }
+inline int f6442_24(int x) { return x * 24; }
+inline int f6442_25(int x) { return x * 25; }
+inline int f6442_26(int x) { return x * 26; }
+inline int f6442_27(int x) { return x * 27; }
+inline int f6442_28(int x) { return x * 28; }
+inline int f6442_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6443 */
+#include <vector>
+#include "h9473.h"
+#include "h813.h"
+#include "h7452.h"
+#include "h5650.h"
+#include "h7074.h"
+#ifdef X
+#include "h7505.h"
+#endif
+struct S6443 { int a; const char *s = "x//y"; };
+inline int f6443_0(int x) { return x * 0; }
+inline int f6443_1(int x) { return x * 1; }
+inline int f6443_2(int x) { return x * 2; }
+inline int f6443_3(int x) { return x * 3; }
+inline int f6443_4(int x) { return x * 4; }
+inline int f6443_5(int x) { return x * 5; }
+inline int f6443_6(int x) { return x * 6; }
+inline int f6443_7(int x) { return x * 7; }
+inline int f6443_8(int x) { return x * 8; }
+inline int f6443_9(int x) { return x * 9; }
+inline int f6443_10(int x) { return x * 10; }
+inline int f6443_11(int x) { return x * 11; }
+inline int f6443_12(int x) { return x * 12; }
+inline int f6443_13(int x) { return x * 13; }
+inline int f6443_14(int x) { return x * 14; }
+inline int f6443_15(int x) { return x * 15; }
+inline int f6443_16(int x) { return x * 16; }
+inline int f6443_17(int x) { return x * 17; }
+inline int f6443_18(int x) { return x * 18; }
+inline int f6443_19(int x) { return x * 19; }
+inline int f6443_20(int x) { return x * 20; }
+inline int f6443_21(int x) { return x * 21; }
+inline int f6443_22(int x) { return x * 22; }
+inline int f6443_23(int x) { return x * 23; }
+inline int f6443_24(int x) { return x * 24; }
+inline int f6443_25(int x) { return x * 25; }
+inline int f6443_26(int x) { return x * 26; }
+inline int f6443_27(int x) { return x * 27; }
+inline int f6443_28(int x) { return x * 28; }
+inline int f6443_29(int x) { return x * 29; }
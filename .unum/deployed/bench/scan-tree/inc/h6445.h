@@ -0,0 +1,42 @@
+#pragma once
+/* header 6445 */
+#include <vector>
+#include "h8256.h"
+#include "h5796.h"
+#include "h1787.h"
+#include "h6046.h"
+#include "h4131.h"
+#ifdef X
+#include "h1429.h"
+#endif
+struct S6445 { int a; const char *s = "x//y"; };
+inline int f6445_0(int x) { return x * 0; }
+inline int f6445_1(int x) { return x * 1; }
+inline int f6445_2(int x) { return x * 2; }
+inline int f6445_3(int x) { return x * 3; }
+inline int f6445_4(int x) { return x * 4; }
+inline int f6445_5(int x) { return x * 5; }
+inline int f6445_6(int x) { return x * 6; }
+inline int f6445_7(int x) { return x * 7; }
+inline int f6445_8(int x) { return x * 8; }
+inline int f6445_9(int x) { return x * 9; }
+inline int f6445_10(int x) { return x * 10; }
+inline int f6445_11(int x) { return x * 11; }
+inline int f6445_12(int x) { return x * 12; }
+inline int f6445_13(int x) { return x * 13; }
+inline int f6445_14(int x) { return x * 14; }
+inline int f6445_15(int x) { return x * 15; }
+inline int f6445_16(int x) { return x * 16; }
+inline int f6445_17(int x) { return x * 17; }
+inline int f6445_18(int x) { return x * 18; }
+inline int f6445_19(int x) { return x * 19; }
+inline int f6445_20(int x) { return x * 20; }
+inline int f6445_21(int x) { return x * 21; }
+inline int f6445_22(int x) { return x * 22; }
+inline int f6445_23(int x) { return x * 23; }
+inline int f6445_24(int x) { return x * 24; }
+inline int f6445_25(int x) { return x * 25; }
+inline int f6445_26(int x) { return x * 26; }
+inline int f6445_27(int x) { return x * 27; }
+inline int f6445_28(int x) { return x * 28; }
+inline int f6445_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6447 */
+#include <vector>
+#include "h3166.h"
+#include "h4437.h"
+#include "h5458.h"
+#include "h6837.h"
+#include "h5971.h"
+#ifdef X
+#include "h8682.h"
+#endif
+struct S6447 { int a; const char *s = "x//y"; };
+inline int f6447_0(int x) { return x * 0; }
+inline int f6447_1(int x) { return x * 1; }
+inline int f6447_2(int x) { return x * 2; }
+inline int f6447_3(int x) { return x * 3; }
+inline int f6447_4(int x) { return x * 4; }
+inline int f6447_5(int x) { return x * 5; }
+inline int f6447_6(int x) { return x * 6; }
+inline int f6447_7(int x) { return x * 7; }
+inline int f6447_8(int x) { return x * 8; }
+inline int f6447_9(int x) { return x * 9; }
+inline int f6447_10(int x) { return x * 10; }
+inline int f6447_11(int x) { return x * 11; }
+inline int f6447_12(int x) { return x * 12; }
+inline int f6447_13(int x) { return x * 13; }
+inline int f6447_14(int x) { return x * 14; }
+inline int f6447_15(int x) { return x * 15; }
+inline int f6447_16(int x) { return x * 16; }
+inline int f6447_17(int x) { return x * 17; }
+inline int f6447_18(int x) { return x * 18; }
+inline int f6447_19(int x) { return x * 19; }
+inline int f6447_20(int x) { return x * 20; }
+inline int f6447_21(int x) { return x * 21; }
+inline int f6447_22(int x) { return x * 22; }
+inline int f6447_23(int x) { return x * 23; }
+inline int f6447_24(int x) { return x * 24; }
+inline int f6447_25(int x) { return x * 25; }
+inline int f6447_26(int x) { return x * 26; }
+inline int f6447_27(int x) { return x * 27; }
+inline int f6447_28(int x) { return x * 28; }
+inline int f6447_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6449 */
+#include <vector>
+#include "h1331.h"
+#include "h2342.h"
+#include "h9160.h"
+#include "h9404.h"
+#include "h3199.h"
+#ifdef X
+#include "h7228.h"
+#endif
+struct S6449 { int a; const char *s = "x//y"; };
+inline int f6449_0(int x) { return x * 0; }
+inline int f6449_1(int x) { return x * 1; }
+inline int f6449_2(int x) { return x * 2; }
+inline int f6449_3(int x) { return x * 3; }
+inline int f6449_4(int x) { return x * 4; }
+inline int f6449_5(int x) { return x * 5; }
+inline int f6449_6(int x) { return x * 6; }
+inline int f6449_7(int x) { return x * 7; }
+inline int f6449_8(int x) { return x * 8; }
+inline int f6449_9(int x) { return x * 9; }
+inline int f6449_10(int x) { return x * 10; }
+inline int f6449_11(int x) { return x * 11; }
+inline int f6449_12(int x) { return x * 12; }
+inline int f6449_13(int x) { return x * 13; }
+inline int f6449_14(int x) { return x * 14; }
+inline int f6449_15(int x) { return x * 15; }
+inline int f6449_16(int x) { return x * 16; }
+inline int f6449_17(int x) { return x * 17; }
+inline int f6449_18(int x) { return x * 18; }
+inline int f6449_19(int x) { return x * 19; }
+inline int f6449_20(int x) { return x * 20; }
+inline int f6449_21(int x) { return x * 21; }
+inline int f6449_22(int x) { return x * 22; }
+inline int f6449_23(int x) { return x * 23; }
+inline int f6449_24(int x) { return x * 24; }
+inline int f6449_25(int x) { return x * 25; }
+inline int f6449_26(int x) { return x * 26; }
+inline int f6449_27(int x) { return x * 27; }
+inline int f6449_28(int x) { return x * 28; }
+inline int f6449_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6451 */
+#include <vector>
+#include "h4426.h"
+#include "h4094.h"
+#include "h4485.h"
+#include "h9947.h"
+#include "h6576.h"
+#ifdef X
+#include "h8935.h"
+#endif
+struct S6451 { int a; const char *s = "x//y"; };
+inline int f6451_0(int x) { return x * 0; }
+inline int f6451_1(int x) { return x * 1; }
+inline int f6451_2(int x) { return x * 2; }
+inline int f6451_3(int x) { return x * 3; }
+inline int f6451_4(int x) { return x * 4; }
+inline int f6451_5(int x) { return x * 5; }
+inline int f6451_6(int x) { return x * 6; }
+inline int f6451_7(int x) { return x * 7; }
+inline int f6451_8(int x) { return x * 8; }
+inline int f6451_9(int x) { return x * 9; }
+inline int f6451_10(int x) { return x * 10; }
+inline int f6451_11(int x) { return x * 11; }
+inline int f6451_12(int x) { return x * 12; }
+inline int f6451_13(int x) { return x * 13; }
+inline int f6451_14(int x) { return x * 14; }
+inline int f6451_15(int x) { return x * 15; }
+inline int f6451_16(int x) { return x * 16; }
+inline int f6451_17(int x) { return x * 17; }
+inline int f6451_18(int x) { return x * 18; }
+inline int f6451_19(int x) { return x * 19; }
+inline int f6451_20(int x) { return x * 20; }
+inline int f6451_21(int x) { return x * 21; }
+inline int f6451_22(int x) { return x * 22; }
+inline int f6451_23(int x) { return x * 23; }
+inline int f6451_24(int x) { return x * 24; }
+inline int f6451_25(int x) { return x * 25; }
+inline int f6451_26(int x) { return x * 26; }
+inline int f6451_27(int x) { return x * 27; }
+inline int f6451_28(int x) { return x * 28; }
+inline int f6451_29(int x) { return x * 29; }
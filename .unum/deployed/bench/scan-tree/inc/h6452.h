@@ -0,0 +1,42 @@
+#pragma once
+/* header 6452 */
+#include <vector>
+#include "h2698.h"
+#include "h226.h"
+#include "h9840.h"
+#include "h8834.h"
+#include "h7711.h"
+#ifdef X
+#include "h9336.h"
+#endif
+struct S6452 { int a; const char *s = "x//y"; };
+inline int f6452_0(int x) { return x * 0; }
+inline int f6452_1(int x) { return x * 1; }
+inline int f6452_2(int x) { return x * 2; }
+inline int f6452_3(int x) { return x * 3; }
+inline int f6452_4(int x) { return x * 4; }
+inline int f6452_5(int x) { return x * 5; }
+inline int f6452_6(int x) { return x * 6; }
+inline int f6452_7(int x) { return x * 7; }
+inline int f6452_8(int x) { return x * 8; }
+inline int f6452_9(int x) { return x * 9; }
+inline int f6452_10(int x) { return x * 10; }
+inline int f6452_11(int x) { return x * 11; }
+inline int f6452_12(int x) { return x * 12; }
+inline int f6452_13(int x) { return x * 13; }
+inline int f6452_14(int x) { return x * 14; }
+inline int f6452_15(int x) { return x * 15; }
+inline int f6452_16(int x) { return x * 16; }
+inline int f6452_17(int x) { return x * 17; }
+inline int f6452_18(int x) { return x * 18; }
+inline int f6452_19(int x) { return x * 19; }
+inline int f6452_20(int x) { return x * 20; }
+inline int f6452_21(int x) { return x * 21; }
+inline int f6452_22(int x) { return x * 22; }
+inline int f6452_23(int x) { return x * 23; }
+inline int f6452_24(int x) { return x * 24; }
+inline int f6452_25(int x) { return x * 25; }
+inline int f6452_26(int x) { return x * 26; }
+inline int f6452_27(int x) { return x * 27; }
+inline int f6452_28(int x) { return x * 28; }
+inline int f6452_29(int x) { return x * 29; }
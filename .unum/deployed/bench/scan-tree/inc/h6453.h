@@ -0,0 +1,42 @@
+#pragma once
+/* header 6453 */
+#include <vector>
+#include "h4788.h"
+#include "h6928.h"
+#include "h6816.h"
+#include "h5574.h"
+#include "h5049.h"
+#ifdef X
+#include "h6372.h"
+#endif
+struct S6453 { int a; const char *s = "x//y"; };
+inline int f6453_0(int x) { return x * 0; }
+inline int f6453_1(int x) { return x * 1; }
+inline int f6453_2(int x) { return x * 2; }
+inline int f6453_3(int x) { return x * 3; }
+inline int f6453_4(int x) { return x * 4; }
+inline int f6453_5(int x) { return x * 5; }
+inline int f6453_6(int x) { return x * 6; }
+inline int f6453_7(int x) { return x * 7; }
+inline int f6453_8(int x) { return x * 8; }
+inline int f6453_9(int x) { return x * 9; }
+inline int f6453_10(int x) { return x * 10; }
+inline int f6453_11(int x) { return x * 11; }
+inline int f6453_12(int x) { return x * 12; }
+inline int f6453_13(int x) { return x * 13; }
+inline int f6453_14(int x) { return x * 14; }
+inline int f6453_15(int x) { return x * 15; }
+inline int f6453_16(int x) { return x * 16; }
+inline int f6453_17(int x) { return x * 17; }
+inline int f6453_18(int x) { return x * 18; }
+inline int f6453_19(int x) { return x * 19; }
+inline int f6453_20(int x) { return x * 20; }
+inline int f6453_21(int x) { return x * 21; }
+inline int f6453_22(int x) { return x * 22; }
+inline int f6453_23(int x) { return x * 23; }
+inline int f6453_24(int x) { return x * 24; }
+inline int f6453_25(int x) { return x * 25; }
+inline int f6453_26(int x) { return x * 26; }
+inline int f6453_27(int x) { return x * 27; }
+inline int f6453_28(int x) { return x * 28; }
+inline int f6453_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6455 */
+#include <vector>
+#include "h2719.h"
+#include "h8838.h"
+#include "h9003.h"
+#include "h4990.h"
+#include "h3031.h"
+#ifdef X
+#include "h3009.h"
+#endif
+struct S6455 { int a; const char *s = "x//y"; };
+inline int f6455_0(int x) { return x * 0; }
+inline int f6455_1(int x) { return x * 1; }
+inline int f6455_2(int x) { return x * 2; }
+inline int f6455_3(int x) { return x * 3; }
+inline int f6455_4(int x) { return x * 4; }
+inline int f6455_5(int x) { return x * 5; }
+inline int f6455_6(int x) { return x * 6; }
+inline int f6455_7(int x) { return x * 7; }
+inline int f6455_8(int x) { return x * 8; }
+inline int f6455_9(int x) { return x * 9; }
+inline int f6455_10(int x) { return x * 10; }
+inline int f6455_11(int x) { return x * 11; }
+inline int f6455_12(int x) { return x * 12; }
+inline int f6455_13(int x) { return x * 13; }
+inline int f6455_14(int x) { return x * 14; }
+inline int f6455_15(int x) { return x * 15; }
+inline int f6455_16(int x) { return x * 16; }
+inline int f6455_17(int x) { return x * 17; }
+inline int f6455_18(int x) { return x * 18; }
+inline int f6455_19(int x) { return x * 19; }
+inline int f6455_20(int x) { return x * 20; }
+inline int f6455_21(int x) { return x * 21; }
+inline int f6455_22(int x) { return x * 22; }
+inline int f6455_23(int x) { return x * 23; }
+inline int f6455_24(int x) { return x * 24; }
+inline int f6455_25(int x) { return x * 25; }
+inline int f6455_26(int x) { return x * 26; }
+inline int f6455_27(int x) { return x * 27; }
+inline int f6455_28(int x) { return x * 28; }
+inline int f6455_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6461 */
+#include <vector>
+#include "h5932.h"
+#include "h1292.h"
+#include "h3823.h"
+#include "h5026.h"
+#include "h6969.h"
+#ifdef X
+#include "h2160.h"
+#endif
+struct S6461 { int a; const char *s = "x//y"; };
+inline int f6461_0(int x) { return x * 0; }
+inline int f6461_1(int x) { return x * 1; }
+inline int f6461_2(int x) { return x * 2; }
+inline int f6461_3(int x) { return x * 3; }
+inline int f6461_4(int x) { return x * 4; }
+inline int f6461_5(int x) { return x * 5; }
+inline int f6461_6(int x) { return x * 6; }
+inline int f6461_7(int x) { return x * 7; }
+inline int f6461_8(int x) { return x * 8; }
+inline int f6461_9(int x) { return x * 9; }
+inline int f6461_10(int x) { return x * 10; }
+inline int f6461_11(int x) { return x * 11; }
+inline int f6461_12(int x) { return x * 12; }
+inline int f6461_13(int x) { return x * 13; }
+inline int f6461_14(int x) { return x * 14; }
+inline int f6461_15(int x) { return x * 15; }
+inline int f6461_16(int x) { return x * 16; }
+inline int f6461_17(int x) { return x * 17; }
+inline int f6461_18(int x) { return x * 18; }
+inline int f6461_19(int x) { return x * 19; }
+inline int f6461_20(int x) { return x * 20; }
+inline int f6461_21(int x) { return x * 21; }
+inline int f6461_22(int x) { return x * 22; }
+inline int f6461_23(int x) { return x * 23; }
+inline int f6461_24(int x) { return x * 24; }
+inline int f6461_25(int x) { return x * 25; }
+inline int f6461_26(int x) { return x * 26; }
+inline int f6461_27(int x) { return x * 27; }
+inline int f6461_28(int x) { return x * 28; }
+inline int f6461_29(int x) { return x * 29; }
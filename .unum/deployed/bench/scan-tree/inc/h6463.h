@@ -0,0 +1,42 @@
+#pragma once
+/* header 6463 */
+#include <vector>
+#include "h9622.h"
+#include "h8555.h"
+#include "h9306.h"
+#include "h4545.h"
+#include "h3990.h"
+#ifdef X
+#include "h7099.h"
+#endif
+struct S6463 { int a; const char *s = "x//y"; };
+inline int f6463_0(int x) { return x * 0; }
+inline int f6463_1(int x) { return x * 1; }
+inline int f6463_2(int x) { return x * 2; }
+inline int f6463_3(int x) { return x * 3; }
+inline int f6463_4(int x) { return x * 4; }
+inline int f6463_5(int x) { return x * 5; }
+inline int f6463_6(int x) { return x * 6; }
+inline int f6463_7(int x) { return x * 7; }
+inline int f6463_8(int x) { return x * 8; }
+inline int f6463_9(int x) { return x * 9; }
+inline int f6463_10(int x) { return x * 10; }
+inline int f6463_11(int x) { return x * 11; }
+inline int f6463_12(int x) { return x * 12; }
+inline int f6463_13(int x) { return x * 13; }
+inline int f6463_14(int x) { return x * 14; }
+inline int f6463_15(int x) { return x * 15; }
+inline int f6463_16(int x) { return x * 16; }
+inline int f6463_17(int x) { return x * 17; }
+inline int f6463_18(int x) { return x * 18; }
+inline int f6463_19(int x) { return x * 19; }
+inline int f6463_20(int x) { return x * 20; }
+inline int f6463_21(int x) { return x * 21; }
+inline int f6463_22(int x) { return x * 22; }
+inline int f6463_23(int x) { return x * 23; }
+inline int f6463_24(int x) { return x * 24; }
+inline int f6463_25(int x) { return x * 25; }
+inline int f6463_26(int x) { return x * 26; }
+inline int f6463_27(int x) { return x * 27; }
+inline int f6463_28(int x) { return x * 28; }
+inline int f6463_29(int x) { return x * 29; }
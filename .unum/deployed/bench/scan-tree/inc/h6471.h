@@ -0,0 +1,42 @@
+#pragma once
+/* header 6471 */
+#include <vector>
+#include "h2792.h"
+#include "h9034.h"
+#include "h2833.h"
+#include "h426.h"
+#include "h8061.h"
+#ifdef X
+#include "h2642.h"
+#endif
+struct S6471 { int a; const char *s = "x//y"; };
+inline int f6471_0(int x) { return x * 0; }
+inline int f6471_1(int x) { return x * 1; }
+inline int f6471_2(int x) { return x * 2; }
+inline int f6471_3(int x) { return x * 3; }
+inline int f6471_4(int x) { return x * 4; }
+inline int f6471_5(int x) { return x * 5; }
+inline int f6471_6(int x) { return x * 6; }
+inline int f6471_7(int x) { return x * 7; }
+inline int f6471_8(int x) { return x * 8; }
+inline int f6471_9(int x) { return x * 9; }
+inline int f6471_10(int x) { return x * 10; }
+inline int f6471_11(int x) { return x * 11; }
+inline int f6471_12(int x) { return x * 12; }
+inline int f6471_13(int x) { return x * 13; }
+inline int f6471_14(int x) { return x * 14; }
+inline int f6471_15(int x) { return x * 15; }
+inline int f6471_16(int x) { return x * 16; }
+inline int f6471_17(int x) { return x * 17; }
+inline int f6471_18(int x) { return x * 18; }
+inline int f6471_19(int x) { return x * 19; }
+inline int f6471_20(int x) { return x * 20; }
+inline int f6471_21(int x) { return x * 21; }
+inline int f6471_22(int x) { return x * 22; }
+inline int f6471_23(int x) { return x * 23; }
+inline int f6471_24(int x) { return x * 24; }
+inline int f6471_25(int x) { return x * 25; }
+inline int f6471_26(int x) { return x * 26; }
+inline int f6471_27(int x) { return x * 27; }
+inline int f6471_28(int x) { return x * 28; }
+inline int f6471_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6472 */
+#include <vector>
+#include "h9141.h"
+#include "h6714.h"
+#include "h6803.h"
+#include "h7928.h"
+#include "h4397.h"
+#ifdef X
+#include "h710.h"
+#endif
+struct S6472 { int a; const char *s = "x//y"; };
+inline int f6472_0(int x) { return x * 0; }
+inline int f6472_1(int x) { return x * 1; }
+inline int f6472_2(int x) { return x * 2; }
+inline int f6472_3(int x) { return x * 3; }
+inline int f6472_4(int x) { return x * 4; }
+inline int f6472_5(int x) { return x * 5; }
+inline int f6472_6(int x) { return x * 6; }
+inline int f6472_7(int x) { return x * 7; }
+inline int f6472_8(int x) { return x * 8; }
+inline int f6472_9(int x) { return x * 9; }
+inline int f6472_10(int x) { return x * 10; }
+inline int f6472_11(int x) { return x * 11; }
+inline int f6472_12(int x) { return x * 12; }
+inline int f6472_13(int x) { return x * 13; }
+inline int f6472_14(int x) { return x * 14; }
+inline int f6472_15(int x) { return x * 15; }
+inline int f6472_16(int x) { return x * 16; }
+inline int f6472_17(int x) { return x * 17; }
+inline int f6472_18(int x) { return x * 18; }
+inline int f6472_19(int x) { return x * 19; }
+inline int f6472_20(int x) { return x * 20; }
+inline int f6472_21(int x) { return x * 21; }
+inline int f6472_22(int x) { return x * 22; }
+inline int f6472_23(int x) { return x * 23; }
+inline int f6472_24(int x) { return x * 24; }
+inline int f6472_25(int x) { return x * 25; }
+inline int f6472_26(int x) { return x * 26; }
+inline int f6472_27(int x) { return x * 27; }
+inline int f6472_28(int x) { return x * 28; }
+inline int f6472_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6473 */
+#include <vector>
+#include "h5126.h"
+#include "h8563.h"
+#include "h6396.h"
+#include "h6896.h"
+#include "h2136.h"
+#ifdef X
+#include "h6082.h"
+#endif
+struct S6473 { int a; const char *s = "x//y"; };
+inline int f6473_0(int x) { return x * 0; }
+inline int f6473_1(int x) { return x * 1; }
+inline int f6473_2(int x) { return x * 2; }
+inline int f6473_3(int x) { return x * 3; }
+inline int f6473_4(int x) { return x * 4; }
+inline int f6473_5(int x) { return x * 5; }
+inline int f6473_6(int x) { return x * 6; }
+inline int f6473_7(int x) { return x * 7; }
+inline int f6473_8(int x) { return x * 8; }
+inline int f6473_9(int x) { return x * 9; }
+inline int f6473_10(int x) { return x * 10; }
+inline int f6473_11(int x) { return x * 11; }
+inline int f6473_12(int x) { return x * 12; }
+inline int f6473_13(int x) { return x * 13; }
+inline int f6473_14(int x) { return x * 14; }
+inline int f6473_15(int x) { return x * 15; }
+inline int f6473_16(int x) { return x * 16; }
+inline int f6473_17(int x) { return x * 17; }
+inline int f6473_18(int x) { return x * 18; }
+inline int f6473_19(int x) { return x * 19; }
+inline int f6473_20(int x) { return x * 20; }
+inline int f6473_21(int x) { return x * 21; }
+inline int f6473_22(int x) { return x * 22; }
+inline int f6473_23(int x) { return x * 23; }
+inline int f6473_24(int x) { return x * 24; }
+inline int f6473_25(int x) { return x * 25; }
+inline int f6473_26(int x) { return x * 26; }
+inline int f6473_27(int x) { return x * 27; }
+inline int f6473_28(int x) { return x * 28; }
+inline int f6473_29(int x) { return x * 29; }
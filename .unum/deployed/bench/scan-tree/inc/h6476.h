@@ -0,0 +1,42 @@
+#pragma once
+/* header 6476 */
+#include <vector>
+#include "h6508.h"
+#include "h7843.h"
+#include "h6377.h"
+#include "h5123.h"
+#include "h8790.h"
+#ifdef X
+#include "h6354.h"
+#endif
+struct S6476 { int a; const char *s = "x//y"; };
+inline int f6476_0(int x) { return x * 0; }
+inline int f6476_1(int x) { return x * 1; }
+inline int f6476_2(int x) { return x * 2; }
+inline int f6476_3(int x) { return x * 3; }
+inline int f6476_4(int x) { return x * 4; }
+inline int f6476_5(int x) { return x * 5; }
+inline int f6476_6(int x) { return x * 6; }
+inline int f6476_7(int x) { return x * 7; }
+inline int f6476_8(int x) { return x * 8; }
+inline int f6476_9(int x) { return x * 9; }
+inline int f6476_10(int x) { return x * 10; }
+inline int f6476_11(int x) { return x * 11; }
+inline int f6476_12(int x) { return x * 12; }
+inline int f6476_13(int x) { return x * 13; }
+inline int f6476_14(int x) { return x * 14; }
+inline int f6476_15(int x) { return x * 15; }
+inline int f6476_16(int x) { return x * 16; }
+inline int f6476_17(int x) { return x * 17; }
+inline int f6476_18(int x) { return x * 18; }
+inline int f6476_19(int x) { return x * 19; }
+inline int f6476_20(int x) { return x * 20; }
+inline int f6476_21(int x) { return x * 21; }
+inline int f6476_22(int x) { return x * 22; }
+inline int f6476_23(int x) { return x * 23; }
+inline int f6476_24(int x) { return x * 24; }
+inline int f6476_25(int x) { return x * 25; }
+inline int f6476_26(int x) { return x * 26; }
+inline int f6476_27(int x) { return x * 27; }
+inline int f6476_28(int x) { return x * 28; }
+inline int f6476_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6477 */
+#include <vector>
+#include "h4095.h"
+#include "h693.h"
+#include "h9814.h"
+#include "h9295.h"
+#include "h887.h"
+#ifdef X
+#include "h2941.h"
+#endif
+struct S6477 { int a; const char *s = "x//y"; };
+inline int f6477_0(int x) { return x * 0; }
+inline int f6477_1(int x) { return x * 1; }
+inline int f6477_2(int x) { return x * 2; }
+inline int f6477_3(int x) { return x * 3; }
+inline int f6477_4(int x) { return x * 4; }
+inline int f6477_5(int x) { return x * 5; }
+inline int f6477_6(int x) { return x * 6; }
+inline int f6477_7(int x) { return x * 7; }
+inline int f6477_8(int x) { return x * 8; }
+inline int f6477_9(int x) { return x * 9; }
+inline int f6477_10(int x) { return x * 10; }
+inline int f6477_11(int x) { return x * 11; }
+inline int f6477_12(int x) { return x * 12; }
+inline int f6477_13(int x) { return x * 13; }
+inline int f6477_14(int x) { return x * 14; }
+inline int f6477_15(int x) { return x * 15; }
+inline int f6477_16(int x) { return x * 16; }
+inline int f6477_17(int x) { return x * 17; }
+inline int f6477_18(int x) { return x * 18; }
+inline int f6477_19(int x) { return x * 19; }
+inline int f6477_20(int x) { return x * 20; }
+inline int f6477_21(int x) { return x * 21; }
+inline int f6477_22(int x) { return x * 22; }
+inline int f6477_23(int x) { return x * 23; }
+inline int f6477_24(int x) { return x * 24; }
+inline int f6477_25(int x) { return x * 25; }
+inline int f6477_26(int x) { return x * 26; }
+inline int f6477_27(int x) { return x * 27; }
+inline int f6477_28(int x) { return x * 28; }
+inline int f6477_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 648 */
+#include <vector>
+#include "h250.h"
+#include "h4678.h"
+#include "h612.h"
+#include "h4162.h"
+#include "h6129.h"
+#ifdef X
+#include "h5641.h"
+#endif
+struct S648 { int a; const char *s = "x//y"; };
+inline int f648_0(int x) { return x * 0; }
+inline int f648_1(int x) { return x * 1; }
+inline int f648_2(int x) { return x * 2; }
+inline int f648_3(int x) { return x * 3; }
+inline int f648_4(int x) { return x * 4; }
+inline int f648_5(int x) { return x * 5; }
+inline int f648_6(int x) { return x * 6; }
+inline int f648_7(int x) { return x * 7; }
+inline int f648_8(int x) { return x * 8; }
+inline int f648_9(int x) { return x * 9; }
+inline int f648_10(int x) { return x * 10; }
+inline int f648_11(int x) { return x * 11; }
+inline int f648_12(int x) { return x * 12; }
+inline int f648_13(int x) { return x * 13; }
+inline int f648_14(int x) { return x * 14; }
+inline int f648_15(int x) { return x * 15; }
+inline int f648_16(int x) { return x * 16; }
+inline int f648_17(int x) { return x * 17; }
+inline int f648_18(int x) { return x * 18; }
+inline int f648_19(int x) { return x * 19; }
+inline int f648_20(int x) { return x * 20; }
+inline int f648_21(int x) { return x * 21; }
+inline int f648_22(int x) { return x * 22; }
+inline int f648_23(int x) { return x * 23; }
+inline int f648_24(int x) { return x * 24; }
+inline int f648_25(int x) { return x * 25; }
+inline int f648_26(int x) { return x * 26; }
+inline int f648_27(int x) { return x * 27; }
+inline int f648_28(int x) { return x * 28; }
+inline int f648_29(int x) { return x * 29; }
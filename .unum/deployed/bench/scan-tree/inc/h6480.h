@@ -0,0 +1,42 @@
+#pragma once
+/* header 6480 */
+#include <vector>
+#include "h2402.h"
+#include "h9634.h"
+#include "h5927.h"
+#include "h1523.h"
+#include "h8454.h"
+#ifdef X
+#include "h6749.h"
+#endif
+struct S6480 { int a; const char *s = "x//y"; };
+inline int f6480_0(int x) { return x * 0; }
+inline int f6480_1(int x) { return x * 1; }
+inline int f6480_2(int x) { return x * 2; }
+inline int f6480_3(int x) { return x * 3; }
+inline int f6480_4(int x) { return x * 4; }
+inline int f6480_5(int x) { return x * 5; }
+inline int f6480_6(int x) { return x * 6; }
+inline int f6480_7(int x) { return x * 7; }
+inline int f6480_8(int x) { return x * 8; }
+inline int f6480_9(int x) { return x * 9; }
+inline int f6480_10(int x) { return x * 10; }
+inline int f6480_11(int x) { return x * 11; }
+inline int f6480_12(int x) { return x * 12; }
+inline int f6480_13(int x) { return x * 13; }
+inline int f6480_14(int x) { return x * 14; }
+inline int f6480_15(int x) { return x * 15; }
+inline int f6480_16(int x) { return x * 16; }
+inline int f6480_17(int x) { return x * 17; }
+inline int f6480_18(int x) { return x * 18; }
+inline int f6480_19(int x) { return x * 19; }
+inline int f6480_20(int x) { return x * 20; }
+inline int f6480_21(int x) { return x * 21; }
+inline int f6480_22(int x) { return x * 22; }
+inline int f6480_23(int x) { return x * 23; }
+inline int f6480_24(int x) { return x * 24; }
+inline int f6480_25(int x) { return x * 25; }
+inline int f6480_26(int x) { return x * 26; }
+inline int f6480_27(int x) { return x * 27; }
+inline int f6480_28(int x) { return x * 28; }
+inline int f6480_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6484 */
+#include <vector>
+#include "h3551.h"
+#include "h6434.h"
+#include "h5758.h"
+#include "h7730.h"
+#include "h2360.h"
+#ifdef X
+#include "h1618.h"
+#endif
+struct S6484 { int a; const char *s = "x//y"; };
+inline int f6484_0(int x) { return x * 0; }
+inline int f6484_1(int x) { return x * 1; }
+inline int f6484_2(int x) { return x * 2; }
+inline int f6484_3(int x) { return x * 3; }
+inline int f6484_4(int x) { return x * 4; }
+inline int f6484_5(int x) { return x * 5; }
+inline int f6484_6(int x) { return x * 6; }
+inline int f6484_7(int x) { return x * 7; }
+inline int f6484_8(int x) { return x * 8; }
+inline int f6484_9(int x) { return x * 9; }
+inline int f6484_10(int x) { return x * 10; }
+inline int f6484_11(int x) { return x * 11; }
+inline int f6484_12(int x) { return x * 12; }
+inline int f6484_13(int x) { return x * 13; }
+inline int f6484_14(int x) { return x * 14; }
+inline int f6484_15(int x) { return x * 15; }
+inline int f6484_16(int x) { return x * 16; }
+inline int f6484_17(int x) { return x * 17; }
+inline int f6484_18(int x) { return x * 18; }
+inline int f6484_19(int x) { return x * 19; }
+inline int f6484_20(int x) { return x * 20; }
+inline int f6484_21(int x) { return x * 21; }
+inline int f6484_22(int x) { return x * 22; }
+inline int f6484_23(int x) { return x * 23; }
+inline int f6484_24(int x) { return x * 24; }
+inline int f6484_25(int x) { return x * 25; }
+inline int f6484_26(int x) { return x * 26; }
+inline int f6484_27(int x) { return x * 27; }
+inline int f6484_28(int x) { return x * 28; }
+inline int f6484_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 649 */
+#include <vector>
+#include "h7310.h"
+#include "h4546.h"
+#include "h5530.h"
+#include "h928.h"
+#include "h5066.h"
+#ifdef X
+#include "h8001.h"
+#endif
+struct S649 { int a; const char *s = "x//y"; };
+inline int f649_0(int x) { return x * 0; }
+inline int f649_1(int x) { return x * 1; }
+inline int f649_2(int x) { return x * 2; }
+inline int f649_3(int x) { return x * 3; }
+inline int f649_4(int x) { return x * 4; }
+inline int f649_5(int x) { return x * 5; }
+inline int f649_6(int x) { return x * 6; }
+inline int f649_7(int x) { return x * 7; }
+inline int f649_8(int x) { return x * 8; }
+inline int f649_9(int x) { return x * 9; }
+inline int f649_10(int x) { return x * 10; }
+inline int f649_11(int x) { return x * 11; }
+inline int f649_12(int x) { return x * 12; }
+inline int f649_13(int x) { return x * 13; }
+inline int f649_14(int x) { return x * 14; }
+inline int f649_15(int x) { return x * 15; }
+inline int f649_16(int x) { return x * 16; }
+inline int f649_17(int x) { return x * 17; }
+inline int f649_18(int x) { return x * 18; }
+inline int f649_19(int x) { return x * 19; }
+inline int f649_20(int x) { return x * 20; }
+inline int f649_21(int x) { return x * 21; }
+inline int f649_22(int x) { return x * 22; }
+inline int f649_23(int x) { return x * 23; }
+inline int f649_24(int x) { return x * 24; }
+inline int f649_25(int x) { return x * 25; }
+inline int f649_26(int x) { return x * 26; }
+inline int f649_27(int x) { return x * 27; }
+inline int f649_28(int x) { return x * 28; }
+inline int f649_29(int x) { return x * 29; }
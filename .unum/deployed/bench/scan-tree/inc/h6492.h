@@ -0,0 +1,42 @@
+#pragma once
+/* header 6492 */
+#include <vector>
+#include "h5901.h"
+#include "h7646.h"
+#include "h3515.h"
+#include "h3523.h"
+#include "h1180.h"
+#ifdef X
+#include "h7155.h"
+#endif
+struct S6492 { int a; const char *s = "x//y"; };
+inline int f6492_0(int x) { return x * 0; }
+inline int f6492_1(int x) { return x * 1; }
+inline int f6492_2(int x) { return x * 2; }
+inline int f6492_3(int x) { return x * 3; }
+inline int f6492_4(int x) { return x * 4; }
+inline int f6492_5(int x) { return x * 5; }
+inline int f6492_6(int x) { return x * 6; }
+inline int f6492_7(int x) { return x * 7; }
+inline int f6492_8(int x) { return x * 8; }
+inline int f6492_9(int x) { return x * 9; }
+inline int f6492_10(int x) { return x * 10; }
+inline int f6492_11(int x) { return x * 11; }
+inline int f6492_12(int x) { return x * 12; }
+inline int f6492_13(int x) { return x * 13; }
+inline int f6492_14(int x) { return x * 14; }
+inline int f6492_15(int x) { return x * 15; }
+inline int f6492_16(int x) { return x * 16; }
+inline int f6492_17(int x) { return x * 17; }
+inline int f6492_18(int x) { return x * 18; }
+inline int f6492_19(int x) { return x * 19; }
+inline int f6492_20(int x) { return x * 20; }
+inline int f6492_21(int x) { return x * 21; }
+inline int f6492_22(int x) { return x * 22; }
+inline int f6492_23(int x) { return x * 23; }
+inline int f6492_24(int x) { return x * 24; }
+inline int f6492_25(int x) { return x * 25; }
+inline int f6492_26(int x) { return x * 26; }
+inline int f6492_27(int x) { return x * 27; }
+inline int f6492_28(int x) { return x * 28; }
+inline int f6492_29(int x) { return x * 29; }
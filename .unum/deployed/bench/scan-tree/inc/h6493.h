@@ -0,0 +1,42 @@
+#pragma once
+/* header 6493 */
+#include <vector>
+#include "h2592.h"
+#include "h5491.h"
+#include "h6324.h"
+#include "h7519.h"
+#include "h5069.h"
+#ifdef X
+#include "h3530.h"
+#endif
+struct S6493 { int a; const char *s = "x//y"; };
+inline int f6493_0(int x) { return x * 0; }
+inline int f6493_1(int x) { return x * 1; }
+inline int f6493_2(int x) { return x * 2; }
+inline int f6493_3(int x) { return x * 3; }
+inline int f6493_4(int x) { return x * 4; }
+inline int f6493_5(int x) { return x * 5; }
+inline int f6493_6(int x) { return x * 6; }
+inline int f6493_7(int x) { return x * 7; }
+inline int f6493_8(int x) { return x * 8; }
+inline int f6493_9(int x) { return x * 9; }
+inline int f6493_10(int x) { return x * 10; }
+inline int f6493_11(int x) { return x * 11; }
+inline int f6493_12(int x) { return x * 12; }
+inline int f6493_13(int x) { return x * 13; }
+inline int f6493_14(int x) { return x * 14; }
+inline int f6493_15(int x) { return x * 15; }
+inline int f6493_16(int x) { return x * 16; }
+inline int f6493_17(int x) { return x * 17; }
+inline int f6493_18(int x) { return x * 18; }
+inline int f6493_19(int x) { return x * 19; }
+inline int f6493_20(int x) { return x * 20; }
+inline int f6493_21(int x) { return x * 21; }
+inline int f6493_22(int x) { return x * 22; }
+inline int f6493_23(int x) { return x * 23; }
+inline int f6493_24(int x) { return x * 24; }
+inline int f6493_25(int x) { return x * 25; }
+inline int f6493_26(int x) { return x * 26; }
+inline int f6493_27(int x) { return x * 27; }
+inline int f6493_28(int x) { return x * 28; }
+inline int f6493_29(int x) { return x * 29; }
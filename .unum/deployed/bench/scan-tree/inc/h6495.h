@@ -0,0 +1,42 @@
+#pragma once
+/* header 6495 */
+#include <vector>
+#include "h7847.h"
+#include "h979.h"
+#include "h6805.h"
+#include "h8436.h"
+#include "h6063.h"
+#ifdef X
+#include "h5310.h"
+#endif
+struct S6495 { int a; const char *s = "x//y"; };
+inline int f6495_0(int x) { return x * 0; }
+inline int f6495_1(int x) { return x * 1; }
+inline int f6495_2(int x) { return x * 2; }
+inline int f6495_3(int x) { return x * 3; }
+inline int f6495_4(int x) { return x * 4; }
+inline int f6495_5(int x) { return x * 5; }
+inline int f6495_6(int x) { return x * 6; }
+inline int f6495_7(int x) { return x * 7; }
+inline int f6495_8(int x) { return x * 8; }
+inline int f6495_9(int x) { return x * 9; }
+inline int f6495_10(int x) { return x * 10; }
+inline int f6495_11(int x) { return x * 11; }
+inline int f6495_12(int x) { return x * 12; }
+inline int f6495_13(int x) { return x * 13; }
+inline int f6495_14(int x) { return x * 14; }
+inline int f6495_15(int x) { return x * 15; }
+inline int f6495_16(int x) { return x * 16; }
+inline int f6495_17(int x) { return x * 17; }
+inline int f6495_18(int x) { return x * 18; }
+inline int f6495_19(int x) { return x * 19; }
+inline int f6495_20(int x) { return x * 20; }
+inline int f6495_21(int x) { return x * 21; }
+inline int f6495_22(int x) { return x * 22; }
+inline int f6495_23(int x) { return x * 23; }
+inline int f6495_24(int x) { return x * 24; }
+inline int f6495_25(int x) { return x * 25; }
+inline int f6495_26(int x) { return x * 26; }
+inline int f6495_27(int x) { return x * 27; }
+inline int f6495_28(int x) { return x * 28; }
+inline int f6495_29(int x) { return x * 29; }
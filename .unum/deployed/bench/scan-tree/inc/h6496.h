@@ -0,0 +1,42 @@
+#pragma once
+/* header 6496 */
+#include <vector>
+#include "h4031.h"
+#include "h5619.h"
+#include "h2753.h"
+#include "h9418.h"
+#include "h4861.h"
+#ifdef X
+#include "h1763.h"
+#endif
+struct S6496 { int a; const char *s = "x//y"; };
+inline int f6496_0(int x) { return x * 0; }
+inline int f6496_1(int x) { return x * 1; }
+inline int f6496_2(int x) { return x * 2; }
+inline int f6496_3(int x) { return x * 3; }
+inline int f6496_4(int x) { return x * 4; }
+inline int f6496_5(int x) { return x * 5; }
+inline int f6496_6(int x) { return x * 6; }
+inline int f6496_7(int x) { return x * 7; }
+inline int f6496_8(int x) { return x * 8; }
+inline int f6496_9(int x) { return x * 9; }
+inline int f6496_10(int x) { return x * 10; }
+inline int f6496_11(int x) { return x * 11; }
+inline int f6496_12(int x) { return x * 12; }
+inline int f6496_13(int x) { return x * 13; }
+inline int f6496_14(int x) { return x * 14; }
+inline int f6496_15(int x) { return x * 15; }
+inline int f6496_16(int x) { return x * 16; }
+inline int f6496_17(int x) { return x * 17; }
+inline int f6496_18(int x) { return x * 18; }
+inline int f6496_19(int x) { return x * 19; }
+inline int f6496_20(int x) { return x * 20; }
+inline int f6496_21(int x) { return x * 21; }
+inline int f6496_22(int x) { return x * 22; }
+inline int f6496_23(int x) { return x * 23; }
+inline int f6496_24(int x) { return x * 24; }
+inline int f6496_25(int x) { return x * 25; }
+inline int f6496_26(int x) { return x * 26; }
+inline int f6496_27(int x) { return x * 27; }
+inline int f6496_28(int x) { return x * 28; }
+inline int f6496_29(int x) { return x * 29; }
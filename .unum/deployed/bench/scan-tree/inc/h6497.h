@@ -0,0 +1,42 @@
+#pragma once
+/* header 6497 */
+#include <vector>
+#include "h4442.h"
+#include "h9088.h"
+#include "h3208.h"
+#include "h3834.h"
+#include "h625.h"
+#ifdef X
+#include "h1651.h"
+#endif
+struct S6497 { int a; const char *s = "x//y"; };
+inline int f6497_0(int x) { return x * 0; }
+inline int f6497_1(int x) { return x * 1; }
+inline int f6497_2(int x) { return x * 2; }
+inline int f6497_3(int x) { return x * 3; }
+inline int f6497_4(int x) { return x * 4; }
+inline int f6497_5(int x) { return x * 5; }
+inline int f6497_6(int x) { return x * 6; }
+inline int f6497_7(int x) { return x * 7; }
+inline int f6497_8(int x) { return x * 8; }
+inline int f6497_9(int x) { return x * 9; }
+inline int f6497_10(int x) { return x * 10; }
+inline int f6497_11(int x) { return x * 11; }
+inline int f6497_12(int x) { return x * 12; }
+inline int f6497_13(int x) { return x * 13; }
+inline int f6497_14(int x) { return x * 14; }
+inline int f6497_15(int x) { return x * 15; }
+inline int f6497_16(int x) { return x * 16; }
+inline int f6497_17(int x) { return x * 17; }
+inline int f6497_18(int x) { return x * 18; }
+inline int f6497_19(int x) { return x * 19; }
+inline int f6497_20(int x) { return x * 20; }
+inline int f6497_21(int x) { return x * 21; }
+inline int f6497_22(int x) { return x * 22; }
+inline int f6497_23(int x) { return x * 23; }
+inline int f6497_24(int x) { return x * 24; }
+inline int f6497_25(int x) { return x * 25; }
+inline int f6497_26(int x) { return x * 26; }
+inline int f6497_27(int x) { return x * 27; }
+inline int f6497_28(int x) { return x * 28; }
+inline int f6497_29(int x) { return x * 29; }
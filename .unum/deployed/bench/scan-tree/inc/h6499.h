@@ -0,0 +1,42 @@
+#pragma once
+/* header 6499 */
+#include <vector>
+#include "h5806.h"
+#include "h9447.h"
+#include "h7933.h"
+#include "h6744.h"
+#include "h9511.h"
+#ifdef X
+#include "h4430.h"
+#endif
+struct S6499 { int a; const char *s = "x//y"; };
+inline int f6499_0(int x) { return x * 0; }
+inline int f6499_1(int x) { return x * 1; }
+inline int f6499_2(int x) { return x * 2; }
+inline int f6499_3(int x) { return x * 3; }
+inline int f6499_4(int x) { return x * 4; }
+inline int f6499_5(int x) { return x * 5; }
+inline int f6499_6(int x) { return x * 6; }
+inline int f6499_7(int x) { return x * 7; }
+inline int f6499_8(int x) { return x * 8; }
+inline int f6499_9(int x) { return x * 9; }
+inline int f6499_10(int x) { return x * 10; }
+inline int f6499_11(int x) { return x * 11; }
+inline int f6499_12(int x) { return x * 12; }
+inline int f6499_13(int x) { return x * 13; }
+inline int f6499_14(int x) { return x * 14; }
+inline int f6499_15(int x) { return x * 15; }
+inline int f6499_16(int x) { return x * 16; }
+inline int f6499_17(int x) { return x * 17; }
+inline int f6499_18(int x) { return x * 18; }
+inline int f6499_19(int x) { return x * 19; }
+inline int f6499_20(int x) { return x * 20; }
+inline int f6499_21(int x) { return x * 21; }
+inline int f6499_22(int x) { return x * 22; }
+inline int f6499_23(int x) { return x * 23; }
+inline int f6499_24(int x) { return x * 24; }
+inline int f6499_25(int x) { return x * 25; }
+inline int f6499_26(int x) { return x * 26; }
+inline int f6499_27(int x) { return x * 27; }
+inline int f6499_28(int x) { return x * 28; }
+inline int f6499_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 65 */
+#include <vector>
+#include "h9572.h"
+#include "h9926.h"
+#include "h5395.h"
+#include "h9996.h"
+#include "h2047.h"
+#ifdef X
+#include "h8292.h"
+#endif
+struct S65 { int a; const char *s = "x//y"; };
+inline int f65_0(int x) { return x * 0; }
+inline int f65_1(int x) { return x * 1; }
+inline int f65_2(int x) { return x * 2; }
+inline int f65_3(int x) { return x * 3; }
+inline int f65_4(int x) { return x * 4; }
+inline int f65_5(int x) { return x * 5; }
+inline int f65_6(int x) { return x * 6; }
+inline int f65_7(int x) { return x * 7; }
+inline int f65_8(int x) { return x * 8; }
+inline int f65_9(int x) { return x * 9; }
+inline int f65_10(int x) { return x * 10; }
+inline int f65_11(int x) { return x * 11; }
+inline int f65_12(int x) { return x * 12; }
+inline int f65_13(int x) { return x * 13; }
+inline int f65_14(int x) { return x * 14; }
+inline int f65_15(int x) { return x * 15; }
+inline int f65_16(int x) { return x * 16; }
+inline int f65_17(int x) { return x * 17; }
+inline int f65_18(int x) { return x * 18; }
+inline int f65_19(int x) { return x * 19; }
+inline int f65_20(int x) { return x * 20; }
+inline int f65_21(int x) { return x * 21; }
+inline int f65_22(int x) { return x * 22; }
+inline int f65_23(int x) { return x * 23; }
+inline int f65_24(int x) { return x * 24; }
+inline int f65_25(int x) { return x * 25; }
+inline int f65_26(int x) { return x * 26; }
+inline int f65_27(int x) { return x * 27; }
+inline int f65_28(int x) { return x * 28; }
+inline int f65_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6500 */
+#include <vector>
+#include "h3298.h"
+#include "h7247.h"
+#include "h2940.h"
+#include "h8102.h"
+#include "h6021.h"
+#ifdef X
+#include "h1454.h"
+#endif
+struct S6500 { int a; const char *s = "x//y"; };
+inline int f6500_0(int x) { return x * 0; }
+inline int f6500_1(int x) { return x * 1; }
+inline int f6500_2(int x) { return x * 2; }
+inline int f6500_3(int x) { return x * 3; }
+inline int f6500_4(int x) { return x * 4; }
+inline int f6500_5(int x) { return x * 5; }
+inline int f6500_6(int x) { return x * 6; }
+inline int f6500_7(int x) { return x * 7; }
+inline int f6500_8(int x) { return x * 8; }
+inline int f6500_9(int x) { return x * 9; }
+inline int f6500_10(int x) { return x * 10; }
+inline int f6500_11(int x) { return x * 11; }
+inline int f6500_12(int x) { return x * 12; }
+inline int f6500_13(int x) { return x * 13; }
+inline int f6500_14(int x) { return x * 14; }
+inline int f6500_15(int x) { return x * 15; }
+inline int f6500_16(int x) { return x * 16; }
+inline int f6500_17(int x) { return x * 17; }
+inline int f6500_18(int x) { return x * 18; }
+inline int f6500_19(int x) { return x * 19; }
+inline int f6500_20(int x) { return x * 20; }
+inline int f6500_21(int x) { return x * 21; }
+inline int f6500_22(int x) { return x * 22; }
+inline int f6500_23(int x) { return x * 23; }
+inline int f6500_24(int x) { return x * 24; }
+inline int f6500_25(int x) { return x * 25; }
+inline int f6500_26(int x) { return x * 26; }
+inline int f6500_27(int x) { return x * 27; }
+inline int f6500_28(int x) { return x * 28; }
+inline int f6500_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6504 */
+#include <vector>
+#include "h440.h"
+#include "h9454.h"
+#include "h7701.h"
+#include "h5838.h"
+#include "h1036.h"
+#ifdef X
+#include "h563.h"
+#endif
+struct S6504 { int a; const char *s = "x//y"; };
+inline int f6504_0(int x) { return x * 0; }
+inline int f6504_1(int x) { return x * 1; }
+inline int f6504_2(int x) { return x * 2; }
+inline int f6504_3(int x) { return x * 3; }
+inline int f6504_4(int x) { return x * 4; }
+inline int f6504_5(int x) { return x * 5; }
+inline int f6504_6(int x) { return x * 6; }
+inline int f6504_7(int x) { return x * 7; }
+inline int f6504_8(int x) { return x * 8; }
+inline int f6504_9(int x) { return x * 9; }
+inline int f6504_10(int x) { return x * 10; }
+inline int f6504_11(int x) { return x * 11; }
+inline int f6504_12(int x) { return x * 12; }
+inline int f6504_13(int x) { return x * 13; }
+inline int f6504_14(int x) { return x * 14; }
+inline int f6504_15(int x) { return x * 15; }
+inline int f6504_16(int x) { return x * 16; }
+inline int f6504_17(int x) { return x * 17; }
+inline int f6504_18(int x) { return x * 18; }
+inline int f6504_19(int x) { return x * 19; }
+inline int f6504_20(int x) { return x * 20; }
+inline int f6504_21(int x) { return x * 21; }
+inline int f6504_22(int x) { return x * 22; }
+inline int f6504_23(int x) { return x * 23; }
+inline int f6504_24(int x) { return x * 24; }
+inline int f6504_25(int x) { return x * 25; }
+inline int f6504_26(int x) { return x * 26; }
+inline int f6504_27(int x) { return x * 27; }
+inline int f6504_28(int x) { return x * 28; }
+inline int f6504_29(int x) { return x * 29; }
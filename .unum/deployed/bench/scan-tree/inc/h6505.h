@@ -0,0 +1,42 @@
+#pragma once
+/* header 6505 */
+#include <vector>
+#include "h5220.h"
+#include "h9348.h"
+#include "h1031.h"
+#include "h6387.h"
+#include "h825.h"
+#ifdef X
+#include "h3396.h"
+#endif
+struct S6505 { int a; const char *s = "x//y"; };
+inline int f6505_0(int x) { return x * 0; }
+inline int f6505_1(int x) { return x * 1; }
+inline int f6505_2(int x) { return x * 2; }
+inline int f6505_3(int x) { return x * 3; }
+inline int f6505_4(int x) { return x * 4; }
+inline int f6505_5(int x) { return x * 5; }
+inline int f6505_6(int x) { return x * 6; }
+inline int f6505_7(int x) { return x * 7; }
+inline int f6505_8(int x) { return x * 8; }
+inline int f6505_9(int x) { return x * 9; }
+inline int f6505_10(int x) { return x * 10; }
+inline int f6505_11(int x) { return x * 11; }
+inline int f6505_12(int x) { return x * 12; }
+inline int f6505_13(int x) { return x * 13; }
+inline int f6505_14(int x) { return x * 14; }
+inline int f6505_15(int x) { return x * 15; }
+inline int f6505_16(int x) { return x * 16; }
+inline int f6505_17(int x) { return x * 17; }
+inline int f6505_18(int x) { return x * 18; }
+inline int f6505_19(int x) { return x * 19; }
+inline int f6505_20(int x) { return x * 20; }
+inline int f6505_21(int x) { return x * 21; }
+inline int f6505_22(int x) { return x * 22; }
+inline int f6505_23(int x) { return x * 23; }
+inline int f6505_24(int x) { return x * 24; }
+inline int f6505_25(int x) { return x * 25; }
+inline int f6505_26(int x) { return x * 26; }
+inline int f6505_27(int x) { return x * 27; }
+inline int f6505_28(int x) { return x * 28; }
+inline int f6505_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6509 */
+#include <vector>
+#include "h4560.h"
+#include "h4524.h"
+#include "h2334.h"
+#include "h6977.h"
+#include "h8107.h"
+#ifdef X
+#include "h6373.h"
+#endif
+struct S6509 { int a; const char *s = "x//y"; };
+inline int f6509_0(int x) { return x * 0; }
+inline int f6509_1(int x) { return x * 1; }
+inline int f6509_2(int x) { return x * 2; }
+inline int f6509_3(int x) { return x * 3; }
+inline int f6509_4(int x) { return x * 4; }
+inline int f6509_5(int x) { return x * 5; }
+inline int f6509_6(int x) { return x * 6; }
+inline int f6509_7(int x) { return x * 7; }
+inline int f6509_8(int x) { return x * 8; }
+inline int f6509_9(int x) { return x * 9; }
+inline int f6509_10(int x) { return x * 10; }
+inline int f6509_11(int x) { return x * 11; }
+inline int f6509_12(int x) { return x * 12; }
+inline int f6509_13(int x) { return x * 13; }
+inline int f6509_14(int x) { return x * 14; }
+inline int f6509_15(int x) { return x * 15; }
+inline int f6509_16(int x) { return x * 16; }
+inline int f6509_17(int x) { return x * 17; }
+inline int f6509_18(int x) { return x * 18; }
+inline int f6509_19(int x) { return x * 19; }
+inline int f6509_20(int x) { return x * 20; }
+inline int f6509_21(int x) { return x * 21; }
+inline int f6509_22(int x) { return x * 22; }
+inline int f6509_23(int x) { return x * 23; }
+inline int f6509_24(int x) { return x * 24; }
+inline int f6509_25(int x) { return x * 25; }
+inline int f6509_26(int x) { return x * 26; }
+inline int f6509_27(int x) { return x * 27; }
+inline int f6509_28(int x) { return x * 28; }
+inline int f6509_29(int x) { return x * 29; }
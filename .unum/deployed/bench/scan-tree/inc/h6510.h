@@ -0,0 +1,42 @@
+#pragma once
+/* header 6510 */
+#include <vector>
+#include "h1641.h"
+#include "h5323.h"
+#include "h8617.h"
+#include "h8129.h"
+#include "h2409.h"
+#ifdef X
+#include "h7523.h"
+#endif
+struct S6510 { int a; const char *s = "x//y"; };
+inline int f6510_0(int x) { return x * 0; }
+inline int f6510_1(int x) { return x * 1; }
+inline int f6510_2(int x) { return x * 2; }
+inline int f6510_3(int x) { return x * 3; }
+inline int f6510_4(int x) { return x * 4; }
+inline int f6510_5(int x) { return x * 5; }
+inline int f6510_6(int x) { return x * 6; }
+inline int f6510_7(int x) { return x * 7; }
+inline int f6510_8(int x) { return x * 8; }
+inline int f6510_9(int x) { return x * 9; }
+inline int f6510_10(int x) { return x * 10; }
+inline int f6510_11(int x) { return x * 11; }
+inline int f6510_12(int x) { return x * 12; }
+inline int f6510_13(int x) { return x * 13; }
+inline int f6510_14(int x) { return x * 14; }
+inline int f6510_15(int x) { return x * 15; }
+inline int f6510_16(int x) { return x * 16; }
+inline int f6510_17(int x) { return x * 17; }
+inline int f6510_18(int x) { return x * 18; }
+inline int f6510_19(int x) { return x * 19; }
+inline int f6510_20(int x) { return x * 20; }
+inline int f6510_21(int x) { return x * 21; }
+inline int f6510_22(int x) { return x * 22; }
+inline int f6510_23(int x) { return x * 23; }
+inline int f6510_24(int x) { return x * 24; }
+inline int f6510_25(int x) { return x * 25; }
+inline int f6510_26(int x) { return x * 26; }
+inline int f6510_27(int x) { return x * 27; }
+inline int f6510_28(int x) { return x * 28; }
+inline int f6510_29(int x) { return x * 29; }
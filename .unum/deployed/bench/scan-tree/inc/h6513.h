@@ -0,0 +1,42 @@
+#pragma once
+/* header 6513 */
+#include <vector>
+#include "h8690.h"
+#include "h772.h"
+#include "h7082.h"
+#include "h8502.h"
+#include "h194.h"
+#ifdef X
+#include "h1541.h"
+#endif
+struct S6513 { int a; const char *s = "x//y"; };
+inline int f6513_0(int x) { return x * 0; }
+inline int f6513_1(int x) { return x * 1; }
+inline int f6513_2(int x) { return x * 2; }
+inline int f6513_3(int x) { return x * 3; }
+inline int f6513_4(int x) { return x * 4; }
+inline int f6513_5(int x) { return x * 5; }
+inline int f6513_6(int x) { return x * 6; }
+inline int f6513_7(int x) { return x * 7; }
+inline int f6513_8(int x) { return x * 8; }
+inline int f6513_9(int x) { return x * 9; }
+inline int f6513_10(int x) { return x * 10; }
+inline int f6513_11(int x) { return x * 11; }
+inline int f6513_12(int x) { return x * 12; }
+inline int f6513_13(int x) { return x * 13; }
+inline int f6513_14(int x) { return x * 14; }
+inline int f6513_15(int x) { return x * 15; }
+inline int f6513_16(int x) { return x * 16; }
+inline int f6513_17(int x) { return x * 17; }
+inline int f6513_18(int x) { return x * 18; }
+inline int f6513_19(int x) { return x * 19; }
+inline int f6513_20(int x) { return x * 20; }
+inline int f6513_21(int x) { return x * 21; }
+inline int f6513_22(int x) { return x * 22; }
+inline int f6513_23(int x) { return x * 23; }
+inline int f6513_24(int x) { return x * 24; }
+inline int f6513_25(int x) { return x * 25; }
+inline int f6513_26(int x) { return x * 26; }
+inline int f6513_27(int x) { return x * 27; }
+inline int f6513_28(int x) { return x * 28; }
+inline int f6513_29(int x) { return x * 29; }
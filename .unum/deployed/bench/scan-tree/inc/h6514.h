@@ -0,0 +1,42 @@
+#pragma once
+/* header 6514 */
+#include <vector>
+#include "h913.h"
+#include "h118.h"
+#include "h7671.h"
+#include "h9095.h"
+#include "h9175.h"
+#ifdef X
+#include "h7563.h"
+#endif
+struct S6514 { int a; const char *s = "x//y"; };
+inline int f6514_0(int x) { return x * 0; }
+inline int f6514_1(int x) { return x * 1; }
+inline int f6514_2(int x) { return x * 2; }
+inline int f6514_3(int x) { return x * 3; }
+inline int f6514_4(int x) { return x * 4; }
+inline int f6514_5(int x) { return x * 5; }
+inline int f6514_6(int x) { return x * 6; }
+inline int f6514_7(int x) { return x * 7; }
+inline int f6514_8(int x) { return x * 8; }
+inline int f6514_9(int x) { return x * 9; }
+inline int f6514_10(int x) { return x * 10; }
+inline int f6514_11(int x) { return x * 11; }
+inline int f6514_12(int x) { return x * 12; }
+inline int f6514_13(int x) { return x * 13; }
+inline int f6514_14(int x) { return x * 14; }
+inline int f6514_15(int x) { return x * 15; }
+inline int f6514_16(int x) { return x * 16; }
+inline int f6514_17(int x) { return x * 17; }
+inline int f6514_18(int x) { return x * 18; }
+inline int f6514_19(int x) { return x * 19; }
+inline int f6514_20(int x) { return x * 20; }
+inline int f6514_21(int x) { return x * 21; }
+inline int f6514_22(int x) { return x * 22; }
+inline int f6514_23(int x) { return x * 23; }
+inline int f6514_24(int x) { return x * 24; }
+inline int f6514_25(int x) { return x * 25; }
+inline int f6514_26(int x) { return x * 26; }
+inline int f6514_27(int x) { return x * 27; }
+inline int f6514_28(int x) { return x * 28; }
+inline int f6514_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6519 */
+#include <vector>
+#include "h6076.h"
+#include "h1228.h"
+#include "h5830.h"
+#include "h8572.h"
+#include "h325.h"
+#ifdef X
+#include "h5555.h"
+#endif
+struct S6519 { int a; const char *s = "x//y"; };
+inline int f6519_0(int x) { return x * 0; }
+inline int f6519_1(int x) { return x * 1; }
+inline int f6519_2(int x) { return x * 2; }
+inline int f6519_3(int x) { return x * 3; }
+inline int f6519_4(int x) { return x * 4; }
+inline int f6519_5(int x) { return x * 5; }
+inline int f6519_6(int x) { return x * 6; }
+inline int f6519_7(int x) { return x * 7; }
+inline int f6519_8(int x) { return x * 8; }
+inline int f6519_9(int x) { return x * 9; }
+inline int f6519_10(int x) { return x * 10; }
+inline int f6519_11(int x) { return x * 11; }
+inline int f6519_12(int x) { return x * 12; }
+inline int f6519_13(int x) { return x * 13; }
+inline int f6519_14(int x) { return x * 14; }
+inline int f6519_15(int x) { return x * 15; }
+inline int f6519_16(int x) { return x * 16; }
+inline int f6519_17(int x) { return x * 17; }
+inline int f6519_18(int x) { return x * 18; }
+inline int f6519_19(int x) { return x * 19; }
+inline int f6519_20(int x) { return x * 20; }
+inline int f6519_21(int x) { return x * 21; }
+inline int f6519_22(int x) { return x * 22; }
+inline int f6519_23(int x) { return x * 23; }
+inline int f6519_24(int x) { return x * 24; }
+inline int f6519_25(int x) { return x * 25; }
+inline int f6519_26(int x) { return x * 26; }
+inline int f6519_27(int x) { return x * 27; }
+inline int f6519_28(int x) { return x * 28; }
+inline int f6519_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 652 */
+#include <vector>
+#include "h1614.h"
+#include "h6350.h"
+#include "h1909.h"
+#include "h2994.h"
+#include "h2876.h"
+#ifdef X
+#include "h9930.h"
+#endif
+struct S652 { int a; const char *s = "x//y"; };
+inline int f652_0(int x) { return x * 0; }
+inline int f652_1(int x) { return x * 1; }
+inline int f652_2(int x) { return x * 2; }
+inline int f652_3(int x) { return x * 3; }
+inline int f652_4(int x) { return x * 4; }
+inline int f652_5(int x) { return x * 5; }
+inline int f652_6(int x) { return x * 6; }
+inline int f652_7(int x) { return x * 7; }
+inline int f652_8(int x) { return x * 8; }
+inline int f652_9(int x) { return x * 9; }
+inline int f652_10(int x) { return x * 10; }
+inline int f652_11(int x) { return x * 11; }
+inline int f652_12(int x) { return x * 12; }
+inline int f652_13(int x) { return x * 13; }
+inline int f652_14(int x) { return x * 14; }
+inline int f652_15(int x) { return x * 15; }
+inline int f652_16(int x) { return x * 16; }
+inline int f652_17(int x) { return x * 17; }
+inline int f652_18(int x) { return x * 18; }
+inline int f652_19(int x) { return x * 19; }
+inline int f652_20(int x) { return x * 20; }
+inline int f652_21(int x) { return x * 21; }
+inline int f652_22(int x) { return x * 22; }
+inline int f652_23(int x) { return x * 23; }
+inline int f652_24(int x) { return x * 24; }
+inline int f652_25(int x) { return x * 25; }
+inline int f652_26(int x) { return x * 26; }
+inline int f652_27(int x) { return x * 27; }
+inline int f652_28(int x) { return x * 28; }
+inline int f652_29(int x) { return x * 29; }
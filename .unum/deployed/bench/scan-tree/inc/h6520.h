@@ -0,0 +1,42 @@
+#pragma once
+/* header 6520 */
+#include <vector>
+#include "h484.h"
+#include "h5984.h"
+#include "h7894.h"
+#include "h6076.h"
+#include "h5624.h"
+#ifdef X
+#include "h7490.h"
+#endif
+struct S6520 { int a; const char *s = "x//y"; };
+inline int f6520_0(int x) { return x * 0; }
+inline int f6520_1(int x) { return x * 1; }
+inline int f6520_2(int x) { return x * 2; }
+inline int f6520_3(int x) { return x * 3; }
+inline int f6520_4(int x) { return x * 4; }
+inline int f6520_5(int x) { return x * 5; }
+inline int f6520_6(int x) { return x * 6; }
+inline int f6520_7(int x) { return x * 7; }
+inline int f6520_8(int x) { return x * 8; }
+inline int f6520_9(int x) { return x * 9; }
+inline int f6520_10(int x) { return x * 10; }
+inline int f6520_11(int x) { return x * 11; }
+inline int f6520_12(int x) { return x * 12; }
+inline int f6520_13(int x) { return x * 13; }
+inline int f6520_14(int x) { return x * 14; }
+inline int f6520_15(int x) { return x * 15; }
+inline int f6520_16(int x) { return x * 16; }
+inline int f6520_17(int x) { return x * 17; }
+inline int f6520_18(int x) { return x * 18; }
+inline int f6520_19(int x) { return x * 19; }
+inline int f6520_20(int x) { return x * 20; }
+inline int f6520_21(int x) { return x * 21; }
+inline int f6520_22(int x) { return x * 22; }
+inline int f6520_23(int x) { return x * 23; }
+inline int f6520_24(int x) { return x * 24; }
+inline int f6520_25(int x) { return x * 25; }
+inline int f6520_26(int x) { return x * 26; }
+inline int f6520_27(int x) { return x * 27; }
+inline int f6520_28(int x) { return x * 28; }
+inline int f6520_29(int x) { return x * 29; }
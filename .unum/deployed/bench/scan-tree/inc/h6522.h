@@ -0,0 +1,42 @@
+#pragma once
+/* header 6522 */
+#include <vector>
+#include "h4949.h"
+#include "h1690.h"
+#include "h2205.h"
+#include "h4305.h"
+#include "h3314.h"
+#ifdef X
+#include "h1086.h"
+#endif
+struct S6522 { int a; const char *s = "x//y"; };
+inline int f6522_0(int x) { return x * 0; }
+inline int f6522_1(int x) { return x * 1; }
+inline int f6522_2(int x) { return x * 2; }
+inline int f6522_3(int x) { return x * 3; }
+inline int f6522_4(int x) { return x * 4; }
+inline int f6522_5(int x) { return x * 5; }
+inline int f6522_6(int x) { return x * 6; }
+inline int f6522_7(int x) { return x * 7; }
+inline int f6522_8(int x) { return x * 8; }
+inline int f6522_9(int x) { return x * 9; }
+inline int f6522_10(int x) { return x * 10; }
+inline int f6522_11(int x) { return x * 11; }
+inline int f6522_12(int x) { return x * 12; }
+inline int f6522_13(int x) { return x * 13; }
+inline int f6522_14(int x) { return x * 14; }
+inline int f6522_15(int x) { return x * 15; }
+inline int f6522_16(int x) { return x * 16; }
+inline int f6522_17(int x) { return x * 17; }
+inline int f6522_18(int x) { return x * 18; }
+inline int f6522_19(int x) { return x * 19; }
+inline int f6522_20(int x) { return x * 20; }
+inline int f6522_21(int x) { return x * 21; }
+inline int f6522_22(int x) { return x * 22; }
+inline int f6522_23(int x) { return x * 23; }
+inline int f6522_24(int x) { return x * 24; }
+inline int f6522_25(int x) { return x * 25; }
+inline int f6522_26(int x) { return x * 26; }
+inline int f6522_27(int x) { return x * 27; }
+inline int f6522_28(int x) { return x * 28; }
+inline int f6522_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6523 */
+#include <vector>
+#include "h8163.h"
+#include "h2482.h"
+#include "h7926.h"
+#include "h8481.h"
+#include "h1515.h"
+#ifdef X
+#include "h8072.h"
+#endif
+struct S6523 { int a; const char *s = "x//y"; };
+inline int f6523_0(int x) { return x * 0; }
+inline int f6523_1(int x) { return x * 1; }
+inline int f6523_2(int x) { return x * 2; }
+inline int f6523_3(int x) { return x * 3; }
+inline int f6523_4(int x) { return x * 4; }
+inline int f6523_5(int x) { return x * 5; }
+inline int f6523_6(int x) { return x * 6; }
+inline int f6523_7(int x) { return x * 7; }
+inline int f6523_8(int x) { return x * 8; }
+inline int f6523_9(int x) { return x * 9; }
+inline int f6523_10(int x) { return x * 10; }
+inline int f6523_11(int x) { return x * 11; }
+inline int f6523_12(int x) { return x * 12; }
+inline int f6523_13(int x) { return x * 13; }
+inline int f6523_14(int x) { return x * 14; }
+inline int f6523_15(int x) { return x * 15; }
+inline int f6523_16(int x) { return x * 16; }
+inline int f6523_17(int x) { return x * 17; }
+inline int f6523_18(int x) { return x * 18; }
+inline int f6523_19(int x) { return x * 19; }
+inline int f6523_20(int x) { return x * 20; }
+inline int f6523_21(int x) { return x * 21; }
+inline int f6523_22(int x) { return x * 22; }
+inline int f6523_23(int x) { return x * 23; }
+inline int f6523_24(int x) { return x * 24; }
+inline int f6523_25(int x) { return x * 25; }
+inline int f6523_26(int x) { return x * 26; }
+inline int f6523_27(int x) { return x * 27; }
+inline int f6523_28(int x) { return x * 28; }
+inline int f6523_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6526 */
+#include <vector>
+#include "h4532.h"
+#include "h1614.h"
+#include "h9878.h"
+#include "h9062.h"
+#include "h479.h"
+#ifdef X
+#include "h9490.h"
+#endif
+struct S6526 { int a; const char *s = "x//y"; };
+inline int f6526_0(int x) { return x * 0; }
+inline int f6526_1(int x) { return x * 1; }
+inline int f6526_2(int x) { return x * 2; }
+inline int f6526_3(int x) { return x * 3; }
+inline int f6526_4(int x) { return x * 4; }
+inline int f6526_5(int x) { return x * 5; }
+inline int f6526_6(int x) { return x * 6; }
+inline int f6526_7(int x) { return x * 7; }
+inline int f6526_8(int x) { return x * 8; }
+inline int f6526_9(int x) { return x * 9; }
+inline int f6526_10(int x) { return x * 10; }
+inline int f6526_11(int x) { return x * 11; }
+inline int f6526_12(int x) { return x * 12; }
+inline int f6526_13(int x) { return x * 13; }
+inline int f6526_14(int x) { return x * 14; }
+inline int f6526_15(int x) { return x * 15; }
+inline int f6526_16(int x) { return x * 16; }
+inline int f6526_17(int x) { return x * 17; }
+inline int f6526_18(int x) { return x * 18; }
+inline int f6526_19(int x) { return x * 19; }
+inline int f6526_20(int x) { return x * 20; }
+inline int f6526_21(int x) { return x * 21; }
+inline int f6526_22(int x) { return x * 22; }
+inline int f6526_23(int x) { return x * 23; }
+inline int f6526_24(int x) { return x * 24; }
+inline int f6526_25(int x) { return x * 25; }
+inline int f6526_26(int x) { return x * 26; }
+inline int f6526_27(int x) { return x * 27; }
+inline int f6526_28(int x) { return x * 28; }
+inline int f6526_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6530 */
+#include <vector>
+#include "h1734.h"
+#include "h4241.h"
+#include "h6077.h"
+#include "h7605.h"
+#include "h473.h"
+#ifdef X
+#include "h3122.h"
+#endif
+struct S6530 { int a; const char *s = "x//y"; };
+inline int f6530_0(int x) { return x * 0; }
+inline int f6530_1(int x) { return x * 1; }
+inline int f6530_2(int x) { return x * 2; }
+inline int f6530_3(int x) { return x * 3; }
+inline int f6530_4(int x) { return x * 4; }
+inline int f6530_5(int x) { return x * 5; }
+inline int f6530_6(int x) { return x * 6; }
+inline int f6530_7(int x) { return x * 7; }
+inline int f6530_8(int x) { return x * 8; }
+inline int f6530_9(int x) { return x * 9; }
+inline int f6530_10(int x) { return x * 10; }
+inline int f6530_11(int x) { return x * 11; }
+inline int f6530_12(int x) { return x * 12; }
+inline int f6530_13(int x) { return x * 13; }
+inline int f6530_14(int x) { return x * 14; }
+inline int f6530_15(int x) { return x * 15; }
+inline int f6530_16(int x) { return x * 16; }
+inline int f6530_17(int x) { return x * 17; }
+inline int f6530_18(int x) { return x * 18; }
+inline int f6530_19(int x) { return x * 19; }
+inline int f6530_20(int x) { return x * 20; }
+inline int f6530_21(int x) { return x * 21; }
+inline int f6530_22(int x) { return x * 22; }
+inline int f6530_23(int x) { return x * 23; }
+inline int f6530_24(int x) { return x * 24; }
+inline int f6530_25(int x) { return x * 25; }
+inline int f6530_26(int x) { return x * 26; }
+inline int f6530_27(int x) { return x * 27; }
+inline int f6530_28(int x) { return x * 28; }
+inline int f6530_29(int x) { return x * 29; }
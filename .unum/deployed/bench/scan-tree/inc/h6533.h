@@ -0,0 +1,42 @@
+#pragma once
+/* header 6533 */
+#include <vector>
+#include "h697.h"
+#include "h3798.h"
+#include "h1188.h"
+#include "h8193.h"
+#include "h4137.h"
+#ifdef X
+#include "h1052.h"
+#endif
+struct S6533 { int a; const char *s = "x//y"; };
+inline int f6533_0(int x) { return x * 0; }
+inline int f6533_1(int x) { return x * 1; }
+inline int f6533_2(int x) { return x * 2; }
+inline int f6533_3(int x) { return x * 3; }
+inline int f6533_4(int x) { return x * 4; }
+inline int f6533_5(int x) { return x * 5; }
+inline int f6533_6(int x) { return x * 6; }
+inline int f6533_7(int x) { return x * 7; }
+inline int f6533_8(int x) { return x * 8; }
+inline int f6533_9(int x) { return x * 9; }
+inline int f6533_10(int x) { return x * 10; }
+inline int f6533_11(int x) { return x * 11; }
+inline int f6533_12(int x) { return x * 12; }
+inline int f6533_13(int x) { return x * 13; }
+inline int f6533_14(int x) { return x * 14; }
+inline int f6533_15(int x) { return x * 15; }
+inline int f6533_16(int x) { return x * 16; }
+inline int f6533_17(int x) { return x * 17; }
+inline int f6533_18(int x) { return x * 18; }
+inline int f6533_19(int x) { return x * 19; }
+inline int f6533_20(int x) { return x * 20; }
+inline int f6533_21(int x) { return x * 21; }
+inline int f6533_22(int x) { return x * 22; }
+inline int f6533_23(int x) { return x * 23; }
+inline int f6533_24(int x) { return x * 24; }
+inline int f6533_25(int x) { return x * 25; }
+inline int f6533_26(int x) { return x * 26; }
+inline int f6533_27(int x) { return x * 27; }
+inline int f6533_28(int x) { return x * 28; }
+inline int f6533_29(int x) { return x * 29; }
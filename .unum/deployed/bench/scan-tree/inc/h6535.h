@@ -0,0 +1,42 @@
+#pragma once
+/* header 6535 */
+#include <vector>
+#include "h9488.h"
+#include "h3135.h"
+#include "h3062.h"
+#include "h6369.h"
+#include "h996.h"
+#ifdef X
+#include "h5243.h"
+#endif
+struct S6535 { int a; const char *s = "x//y"; };
+inline int f6535_0(int x) { return x * 0; }
+inline int f6535_1(int x) { return x * 1; }
+inline int f6535_2(int x) { return x * 2; }
+inline int f6535_3(int x) { return x * 3; }
+inline int f6535_4(int x) { return x * 4; }
+inline int f6535_5(int x) { return x * 5; }
+inline int f6535_6(int x) { return x * 6; }
+inline int f6535_7(int x) { return x * 7; }
+inline int f6535_8(int x) { return x * 8; }
+inline int f6535_9(int x) { return x * 9; }
+inline int f6535_10(int x) { return x * 10; }
+inline int f6535_11(int x) { return x * 11; }
+inline int f6535_12(int x) { return x * 12; }
+inline int f6535_13(int x) { return x * 13; }
+inline int f6535_14(int x) { return x * 14; }
+inline int f6535_15(int x) { return x * 15; }
+inline int f6535_16(int x) { return x * 16; }
+inline int f6535_17(int x) { return x * 17; }
+inline int f6535_18(int x) { return x * 18; }
+inline int f6535_19(int x) { return x * 19; }
+inline int f6535_20(int x) { return x * 20; }
+inline int f6535_21(int x) { return x * 21; }
+inline int f6535_22(int x) { return x * 22; }
+inline int f6535_23(int x) { return x * 23; }
+inline int f6535_24(int x) { return x * 24; }
+inline int f6535_25(int x) { return x * 25; }
+inline int f6535_26(int x) { return x * 26; }
+inline int f6535_27(int x) { return x * 27; }
+inline int f6535_28(int x) { return x * 28; }
+inline int f6535_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6540 */
+#include <vector>
+#include "h3959.h"
+#include "h3488.h"
+#include "h5559.h"
+#include "h9032.h"
+#include "h6265.h"
+#ifdef X
+#include "h439.h"
+#endif
+struct S6540 { int a; const char *s = "x//y"; };
+inline int f6540_0(int x) { return x * 0; }
+inline int f6540_1(int x) { return x * 1; }
+inline int f6540_2(int x) { return x * 2; }
+inline int f6540_3(int x) { return x * 3; }
+inline int f6540_4(int x) { return x * 4; }
+inline int f6540_5(int x) { return x * 5; }
+inline int f6540_6(int x) { return x * 6; }
+inline int f6540_7(int x) { return x * 7; }
+inline int f6540_8(int x) { return x * 8; }
+inline int f6540_9(int x) { return x * 9; }
+inline int f6540_10(int x) { return x * 10; }
+inline int f6540_11(int x) { return x * 11; }
+inline int f6540_12(int x) { return x * 12; }
+inline int f6540_13(int x) { return x * 13; }
+inline int f6540_14(int x) { return x * 14; }
+inline int f6540_15(int x) { return x * 15; }
+inline int f6540_16(int x) { return x * 16; }
+inline int f6540_17(int x) { return x * 17; }
+inline int f6540_18(int x) { return x * 18; }
+inline int f6540_19(int x) { return x * 19; }
+inline int f6540_20(int x) { return x * 20; }
+inline int f6540_21(int x) { return x * 21; }
+inline int f6540_22(int x) { return x * 22; }
+inline int f6540_23(int x) { return x * 23; }
+inline int f6540_24(int x) { return x * 24; }
+inline int f6540_25(int x) { return x * 25; }
+inline int f6540_26(int x) { return x * 26; }
+inline int f6540_27(int x) { return x * 27; }
+inline int f6540_28(int x) { return x * 28; }
+inline int f6540_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6541 */
+#include <vector>
+#include "h8657.h"
+#include "h3222.h"
+#include "h6158.h"
+#include "h2064.h"
+#include "h5511.h"
+#ifdef X
+#include "h9625.h"
+#endif
+struct S6541 { int a; const char *s = "x//y"; };
+inline int f6541_0(int x) { return x * 0; }
+inline int f6541_1(int x) { return x * 1; }
+inline int f6541_2(int x) { return x * 2; }
+inline int f6541_3(int x) { return x * 3; }
+inline int f6541_4(int x) { return x * 4; }
+inline int f6541_5(int x) { return x * 5; }
+inline int f6541_6(int x) { return x * 6; }
+inline int f6541_7(int x) { return x * 7; }
+inline int f6541_8(int x) { return x * 8; }
+inline int f6541_9(int x) { return x * 9; }
+inline int f6541_10(int x) { return x * 10; }
+inline int f6541_11(int x) { return x * 11; }
+inline int f6541_12(int x) { return x * 12; }
+inline int f6541_13(int x) { return x * 13; }
+inline int f6541_14(int x) { return x * 14; }
+inline int f6541_15(int x) { return x * 15; }
+inline int f6541_16(int x) { return x * 16; }
+inline int f6541_17(int x) { return x * 17; }
+inline int f6541_18(int x) { return x * 18; }
+inline int f6541_19(int x) { return x * 19; }
+inline int f6541_20(int x) { return x * 20; }
+inline int f6541_21(int x) { return x * 21; }
+inline int f6541_22(int x) { return x * 22; }
+inline int f6541_23(int x) { return x * 23; }
+inline int f6541_24(int x) { return x * 24; }
+inline int f6541_25(int x) { return x * 25; }
+inline int f6541_26(int x) { return x * 26; }
+inline int f6541_27(int x) { return x * 27; }
+inline int f6541_28(int x) { return x * 28; }
+inline int f6541_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6542 */
+#include <vector>
+#include "h623.h"
+#include "h5601.h"
+#include "h8296.h"
+#include "h8154.h"
+#include "h9696.h"
+#ifdef X
+#include "h2203.h"
+#endif
+struct S6542 { int a; const char *s = "x//y"; };
+inline int f6542_0(int x) { return x * 0; }
+inline int f6542_1(int x) { return x * 1; }
+inline int f6542_2(int x) { return x * 2; }
+inline int f6542_3(int x) { return x * 3; }
+inline int f6542_4(int x) { return x * 4; }
+inline int f6542_5(int x) { return x * 5; }
+inline int f6542_6(int x) { return x * 6; }
+inline int f6542_7(int x) { return x * 7; }
+inline int f6542_8(int x) { return x * 8; }
+inline int f6542_9(int x) { return x * 9; }
+inline int f6542_10(int x) { return x * 10; }
+inline int f6542_11(int x) { return x * 11; }
+inline int f6542_12(int x) { return x * 12; }
+inline int f6542_13(int x) { return x * 13; }
+inline int f6542_14(int x) { return x * 14; }
+inline int f6542_15(int x) { return x * 15; }
+inline int f6542_16(int x) { return x * 16; }
+inline int f6542_17(int x) { return x * 17; }
+inline int f6542_18(int x) { return x * 18; }
+inline int f6542_19(int x) { return x * 19; }
+inline int f6542_20(int x) { return x * 20; }
+inline int f6542_21(int x) { return x * 21; }
+inline int f6542_22(int x) { return x * 22; }
+inline int f6542_23(int x) { return x * 23; }
+inline int f6542_24(int x) { return x * 24; }
+inline int f6542_25(int x) { return x * 25; }
+inline int f6542_26(int x) { return x * 26; }
+inline int f6542_27(int x) { return x * 27; }
+inline int f6542_28(int x) { return x * 28; }
+inline int f6542_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6544 */
+#include <vector>
+#include "h1351.h"
+#include "h4965.h"
+#include "h249.h"
+#include "h1881.h"
+#include "h1233.h"
+#ifdef X
+#include "h5434.h"
+#endif
+struct S6544 { int a; const char *s = "x//y"; };
+inline int f6544_0(int x) { return x * 0; }
+inline int f6544_1(int x) { return x * 1; }
+inline int f6544_2(int x) { return x * 2; }
+inline int f6544_3(int x) { return x * 3; }
+inline int f6544_4(int x) { return x * 4; }
+inline int f6544_5(int x) { return x * 5; }
+inline int f6544_6(int x) { return x * 6; }
+inline int f6544_7(int x) { return x * 7; }
+inline int f6544_8(int x) { return x * 8; }
+inline int f6544_9(int x) { return x * 9; }
+inline int f6544_10(int x) { return x * 10; }
+inline int f6544_11(int x) { return x * 11; }
+inline int f6544_12(int x) { return x * 12; }
+inline int f6544_13(int x) { return x * 13; }
+inline int f6544_14(int x) { return x * 14; }
+inline int f6544_15(int x) { return x * 15; }
+inline int f6544_16(int x) { return x * 16; }
+inline int f6544_17(int x) { return x * 17; }
+inline int f6544_18(int x) { return x * 18; }
+inline int f6544_19(int x) { return x * 19; }
+inline int f6544_20(int x) { return x * 20; }
+inline int f6544_21(int x) { return x * 21; }
+inline int f6544_22(int x) { return x * 22; }
+inline int f6544_23(int x) { return x * 23; }
+inline int f6544_24(int x) { return x * 24; }
+inline int f6544_25(int x) { return x * 25; }
+inline int f6544_26(int x) { return x * 26; }
+inline int f6544_27(int x) { return x * 27; }
+inline int f6544_28(int x) { return x * 28; }
+inline int f6544_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6545 */
+#include <vector>
+#include "h4546.h"
+#include "h3126.h"
+#include "h898.h"
+#include "h4381.h"
+#include "h6455.h"
+#ifdef X
+#include "h5254.h"
+#endif
+struct S6545 { int a; const char *s = "x//y"; };
+inline int f6545_0(int x) { return x * 0; }
+inline int f6545_1(int x) { return x * 1; }
+inline int f6545_2(int x) { return x * 2; }
+inline int f6545_3(int x) { return x * 3; }
+inline int f6545_4(int x) { return x * 4; }
+inline int f6545_5(int x) { return x * 5; }
+inline int f6545_6(int x) { return x * 6; }
+inline int f6545_7(int x) { return x * 7; }
+inline int f6545_8(int x) { return x * 8; }
+inline int f6545_9(int x) { return x * 9; }
+inline int f6545_10(int x) { return x * 10; }
+inline int f6545_11(int x) { return x * 11; }
+inline int f6545_12(int x) { return x * 12; }
+inline int f6545_13(int x) { return x * 13; }
+inline int f6545_14(int x) { return x * 14; }
+inline int f6545_15(int x) { return x * 15; }
+inline int f6545_16(int x) { return x * 16; }
+inline int f6545_17(int x) { return x * 17; }
+inline int f6545_18(int x) { return x * 18; }
+inline int f6545_19(int x) { return x * 19; }
+inline int f6545_20(int x) { return x * 20; }
+inline int f6545_21(int x) { return x * 21; }
+inline int f6545_22(int x) { return x * 22; }
+inline int f6545_23(int x) { return x * 23; }
+inline int f6545_24(int x) { return x * 24; }
+inline int f6545_25(int x) { return x * 25; }
+inline int f6545_26(int x) { return x * 26; }
+inline int f6545_27(int x) { return x * 27; }
+inline int f6545_28(int x) { return x * 28; }
+inline int f6545_29(int x) { return x * 29; }
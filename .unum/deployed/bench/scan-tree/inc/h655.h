@@ -0,0 +1,42 @@
+#pragma once
+/* header 655 */
+#include <vector>
+#include "h8557.h"
+#include "h6922.h"
+#include "h3924.h"
+#include "h6876.h"
+#include "h8345.h"
+#ifdef X
+#include "h8899.h"
+#endif
+struct S655 { int a; const char *s = "x//y"; };
+inline int f655_0(int x) { return x * 0; }
+inline int f655_1(int x) { return x * 1; }
+inline int f655_2(int x) { return x * 2; }
+inline int f655_3(int x) { return x * 3; }
+inline int f655_4(int x) { return x * 4; }
+inline int f655_5(int x) { return x * 5; }
+inline int f655_6(int x) { return x * 6; }
+inline int f655_7(int x) { return x * 7; }
+inline int f655_8(int x) { return x * 8; }
+inline int f655_9(int x) { return x * 9; }
+inline int f655_10(int x) { return x * 10; }
+inline int f655_11(int x) { return x * 11; }
+inline int f655_12(int x) { return x * 12; }
+inline int f655_13(int x) { return x * 13; }
+inline int f655_14(int x) { return x * 14; }
+inline int f655_15(int x) { return x * 15; }
+inline int f655_16(int x) { return x * 16; }
+inline int f655_17(int x) { return x * 17; }
+inline int f655_18(int x) { return x * 18; }
+inline int f655_19(int x) { return x * 19; }
+inline int f655_20(int x) { return x * 20; }
+inline int f655_21(int x) { return x * 21; }
+inline int f655_22(int x) { return x * 22; }
+inline int f655_23(int x) { return x * 23; }
+inline int f655_24(int x) { return x * 24; }
+inline int f655_25(int x) { return x * 25; }
+inline int f655_26(int x) { return x * 26; }
+inline int f655_27(int x) { return x * 27; }
+inline int f655_28(int x) { return x * 28; }
+inline int f655_29(int x) { return x * 29; }
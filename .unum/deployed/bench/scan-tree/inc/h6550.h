@@ -0,0 +1,42 @@
+#pragma once
+/* header 6550 */
+#include <vector>
+#include "h1107.h"
+#include "h4524.h"
+#include "h2342.h"
+#include "h1859.h"
+#include "h1202.h"
+#ifdef X
+#include "h7652.h"
+#endif
+struct S6550 { int a; const char *s = "x//y"; };
+inline int f6550_0(int x) { return x * 0; }
+inline int f6550_1(int x) { return x * 1; }
+inline int f6550_2(int x) { return x * 2; }
+inline int f6550_3(int x) { return x * 3; }
+inline int f6550_4(int x) { return x * 4; }
+inline int f6550_5(int x) { return x * 5; }
+inline int f6550_6(int x) { return x * 6; }
+inline int f6550_7(int x) { return x * 7; }
+inline int f6550_8(int x) { return x * 8; }
+inline int f6550_9(int x) { return x * 9; }
+inline int f6550_10(int x) { return x * 10; }
+inline int f6550_11(int x) { return x * 11; }
+inline int f6550_12(int x) { return x * 12; }
+inline int f6550_13(int x) { return x * 13; }
+inline int f6550_14(int x) { return x * 14; }
+inline int f6550_15(int x) { return x * 15; }
+inline int f6550_16(int x) { return x * 16; }
+inline int f6550_17(int x) { return x * 17; }
+inline int f6550_18(int x) { return x * 18; }
+inline int f6550_19(int x) { return x * 19; }
+inline int f6550_20(int x) { return x * 20; }
+inline int f6550_21(int x) { return x * 21; }
+inline int f6550_22(int x) { return x * 22; }
+inline int f6550_23(int x) { return x * 23; }
+inline int f6550_24(int x) { return x * 24; }
+inline int f6550_25(int x) { return x * 25; }
+inline int f6550_26(int x) { return x * 26; }
+inline int f6550_27(int x) { return x * 27; }
+inline int f6550_28(int x) { return x * 28; }
+inline int f6550_29(int x) { return x * 29; }
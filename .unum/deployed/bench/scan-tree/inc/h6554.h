@@ -0,0 +1,42 @@
+#pragma once
+/* header 6554 */
+#include <vector>
+#include "h8920.h"
+#include "h5044.h"
+#include "h573.h"
+#include "h8390.h"
+#include "h3439.h"
+#ifdef X
+#include "h4479.h"
+#endif
+struct S6554 { int a; const char *s = "x//y"; };
+inline int f6554_0(int x) { return x * 0; }
+inline int f6554_1(int x) { return x * 1; }
+inline int f6554_2(int x) { return x * 2; }
+inline int f6554_3(int x) { return x * 3; }
+inline int f6554_4(int x) { return x * 4; }
+inline int f6554_5(int x) { return x * 5; }
+inline int f6554_6(int x) { return x * 6; }
+inline int f6554_7(int x) { return x * 7; }
+inline int f6554_8(int x) { return x * 8; }
+inline int f6554_9(int x) { return x * 9; }
+inline int f6554_10(int x) { return x * 10; }
+inline int f6554_11(int x) { return x * 11; }
+inline int f6554_12(int x) { return x * 12; }
+inline int f6554_13(int x) { return x * 13; }
+inline int f6554_14(int x) { return x * 14; }
+inline int f6554_15(int x) { return x * 15; }
+inline int f6554_16(int x) { return x * 16; }
+inline int f6554_17(int x) { return x * 17; }
+inline int f6554_18(int x) { return x * 18; }
+inline int f6554_19(int x) { return x * 19; }
+inline int f6554_20(int x) { return x * 20; }
+inline int f6554_21(int x) { return x * 21; }
+inline int f6554_22(int x) { return x * 22; }
+inline int f6554_23(int x) { return x * 23; }
+inline int f6554_24(int x) { return x * 24; }
+inline int f6554_25(int x) { return x * 25; }
+inline int f6554_26(int x) { return x * 26; }
+inline int f6554_27(int x) { return x * 27; }
+inline int f6554_28(int x) { return x * 28; }
+inline int f6554_29(int x) { return x * 29; }
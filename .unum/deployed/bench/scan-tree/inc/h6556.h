@@ -0,0 +1,42 @@
+#pragma once
+/* header 6556 */
+#include <vector>
+#include "h1175.h"
+#include "h2986.h"
+#include "h626.h"
+#include "h7556.h"
+#include "h9465.h"
+#ifdef X
+#include "h4918.h"
+#endif
+struct S6556 { int a; const char *s = "x//y"; };
+inline int f6556_0(int x) { return x * 0; }
+inline int f6556_1(int x) { return x * 1; }
+inline int f6556_2(int x) { return x * 2; }
+inline int f6556_3(int x) { return x * 3; }
+inline int f6556_4(int x) { return x * 4; }
+inline int f6556_5(int x) { return x * 5; }
+inline int f6556_6(int x) { return x * 6; }
+inline int f6556_7(int x) { return x * 7; }
+inline int f6556_8(int x) { return x * 8; }
+inline int f6556_9(int x) { return x * 9; }
+inline int f6556_10(int x) { return x * 10; }
+inline int f6556_11(int x) { return x * 11; }
+inline int f6556_12(int x) { return x * 12; }
+inline int f6556_13(int x) { return x * 13; }
+inline int f6556_14(int x) { return x * 14; }
+inline int f6556_15(int x) { return x * 15; }
+inline int f6556_16(int x) { return x * 16; }
+inline int f6556_17(int x) { return x * 17; }
+inline int f6556_18(int x) { return x * 18; }
+inline int f6556_19(int x) { return x * 19; }
+inline int f6556_20(int x) { return x * 20; }
+inline int f6556_21(int x) { return x * 21; }
+inline int f6556_22(int x) { return x * 22; }
+inline int f6556_23(int x) { return x * 23; }
+inline int f6556_24(int x) { return x * 24; }
+inline int f6556_25(int x) { return x * 25; }
+inline int f6556_26(int x) { return x * 26; }
+inline int f6556_27(int x) { return x * 27; }
+inline int f6556_28(int x) { return x * 28; }
+inline int f6556_29(int x) { return x * 29; }
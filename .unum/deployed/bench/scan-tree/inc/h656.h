@@ -0,0 +1,42 @@
+#pragma once
+/* header 656 */
+#include <vector>
+#include "h3929.h"
+#include "h690.h"
+#include "h2178.h"
+#include "h3992.h"
+#include "h2170.h"
+#ifdef X
+#include "h7479.h"
+#endif
+struct S656 { int a; const char *s = "x//y"; };
+inline int f656_0(int x) { return x * 0; }
+inline int f656_1(int x) { return x * 1; }
+inline int f656_2(int x) { return x * 2; }
+inline int f656_3(int x) { return x * 3; }
+inline int f656_4(int x) { return x * 4; }
+inline int f656_5(int x) { return x * 5; }
+inline int f656_6(int x) { return x * 6; }
+inline int f656_7(int x) { return x * 7; }
+inline int f656_8(int x) { return x * 8; }
+inline int f656_9(int x) { return x * 9; }
+inline int f656_10(int x) { return x * 10; }
+inline int f656_11(int x) { return x * 11; }
+inline int f656_12(int x) { return x * 12; }
+inline int f656_13(int x) { return x * 13; }
+inline int f656_14(int x) { return x * 14; }
+inline int f656_15(int x) { return x * 15; }
+inline int f656_16(int x) { return x * 16; }
+inline int f656_17(int x) { return x * 17; }
+inline int f656_18(int x) { return x * 18; }
+inline int f656_19(int x) { return x * 19; }
+inline int f656_20(int x) { return x * 20; }
+inline int f656_21(int x) { return x * 21; }
+inline int f656_22(int x) { return x * 22; }
+inline int f656_23(int x) { return x * 23; }
+inline int f656_24(int x) { return x * 24; }
+inline int f656_25(int x) { return x * 25; }
+inline int f656_26(int x) { return x * 26; }
+inline int f656_27(int x) { return x * 27; }
+inline int f656_28(int x) { return x * 28; }
+inline int f656_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6560 */
+#include <vector>
+#include "h1995.h"
+#include "h3803.h"
+#include "h414.h"
+#include "h7527.h"
+#include "h413.h"
+#ifdef X
+#include "h5562.h"
+#endif
+struct S6560 { int a; const char *s = "x//y"; };
+inline int f6560_0(int x) { return x * 0; }
+inline int f6560_1(int x) { return x * 1; }
+inline int f6560_2(int x) { return x * 2; }
+inline int f6560_3(int x) { return x * 3; }
+inline int f6560_4(int x) { return x * 4; }
+inline int f6560_5(int x) { return x * 5; }
+inline int f6560_6(int x) { return x * 6; }
+inline int f6560_7(int x) { return x * 7; }
+inline int f6560_8(int x) { return x * 8; }
+inline int f6560_9(int x) { return x * 9; }
+inline int f6560_10(int x) { return x * 10; }
+inline int f6560_11(int x) { return x * 11; }
+inline int f6560_12(int x) { return x * 12; }
+inline int f6560_13(int x) { return x * 13; }
+inline int f6560_14(int x) { return x * 14; }
+inline int f6560_15(int x) { return x * 15; }
+inline int f6560_16(int x) { return x * 16; }
+inline int f6560_17(int x) { return x * 17; }
+inline int f6560_18(int x) { return x * 18; }
+inline int f6560_19(int x) { return x * 19; }
+inline int f6560_20(int x) { return x * 20; }
+inline int f6560_21(int x) { return x * 21; }
+inline int f6560_22(int x) { return x * 22; }
+inline int f6560_23(int x) { return x * 23; }
+inline int f6560_24(int x) { return x * 24; }
+inline int f6560_25(int x) { return x * 25; }
+inline int f6560_26(int x) { return x * 26; }
+inline int f6560_27(int x) { return x * 27; }
+inline int f6560_28(int x) { return x * 28; }
+inline int f6560_29(int x) { return x * 29; }
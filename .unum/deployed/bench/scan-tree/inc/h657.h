@@ -0,0 +1,42 @@
+#pragma once
+/* header 657 */
+#include <vector>
+#include "h4100.h"
+#include "h9768.h"
+#include "h510.h"
+#include "h289.h"
+#include "h3037.h"
+#ifdef X
+#include "h5226.h"
+#endif
+struct S657 { int a; const char *s = "x//y"; };
+inline int f657_0(int x) { return x * 0; }
+inline int f657_1(int x) { return x * 1; }
+inline int f657_2(int x) { return x * 2; }
+inline int f657_3(int x) { return x * 3; }
+inline int f657_4(int x) { return x * 4; }
+inline int f657_5(int x) { return x * 5; }
+inline int f657_6(int x) { return x * 6; }
+inline int f657_7(int x) { return x * 7; }
+inline int f657_8(int x) { return x * 8; }
+inline int f657_9(int x) { return x * 9; }
+inline int f657_10(int x) { return x * 10; }
+inline int f657_11(int x) { return x * 11; }
+inline int f657_12(int x) { return x * 12; }
+inline int f657_13(int x) { return x * 13; }
+inline int f657_14(int x) { return x * 14; }
+inline int f657_15(int x) { return x * 15; }
+inline int f657_16(int x) { return x * 16; }
+inline int f657_17(int x) { return x * 17; }
+inline int f657_18(int x) { return x * 18; }
+inline int f657_19(int x) { return x * 19; }
+inline int f657_20(int x) { return x * 20; }
+inline int f657_21(int x) { return x * 21; }
+inline int f657_22(int x) { return x * 22; }
+inline int f657_23(int x) { return x * 23; }
+inline int f657_24(int x) { return x * 24; }
+inline int f657_25(int x) { return x * 25; }
+inline int f657_26(int x) { return x * 26; }
+inline int f657_27(int x) { return x * 27; }
+inline int f657_28(int x) { return x * 28; }
+inline int f657_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6570 */
+#include <vector>
+#include "h6253.h"
+#include "h1850.h"
+#include "h368.h"
+#include "h2518.h"
+#include "h8952.h"
+#ifdef X
+#include "h794.h"
+#endif
+struct S6570 { int a; const char *s = "x//y"; };
+inline int f6570_0(int x) { return x * 0; }
+inline int f6570_1(int x) { return x * 1; }
+inline int f6570_2(int x) { return x * 2; }
+inline int f6570_3(int x) { return x * 3; }
+inline int f6570_4(int x) { return x * 4; }
+inline int f6570_5(int x) { return x * 5; }
+inline int f6570_6(int x) { return x * 6; }
+inline int f6570_7(int x) { return x * 7; }
+inline int f6570_8(int x) { return x * 8; }
+inline int f6570_9(int x) { return x * 9; }
+inline int f6570_10(int x) { return x * 10; }
+inline int f6570_11(int x) { return x * 11; }
+inline int f6570_12(int x) { return x * 12; }
+inline int f6570_13(int x) { return x * 13; }
+inline int f6570_14(int x) { return x * 14; }
+inline int f6570_15(int x) { return x * 15; }
+inline int f6570_16(int x) { return x * 16; }
+inline int f6570_17(int x) { return x * 17; }
+inline int f6570_18(int x) { return x * 18; }
+inline int f6570_19(int x) { return x * 19; }
+inline int f6570_20(int x) { return x * 20; }
+inline int f6570_21(int x) { return x * 21; }
+inline int f6570_22(int x) { return x * 22; }
+inline int f6570_23(int x) { return x * 23; }
+inline int f6570_24(int x) { return x * 24; }
+inline int f6570_25(int x) { return x * 25; }
+inline int f6570_26(int x) { return x * 26; }
+inline int f6570_27(int x) { return x * 27; }
+inline int f6570_28(int x) { return x * 28; }
+inline int f6570_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6573 */
+#include <vector>
+#include "h3066.h"
+#include "h8574.h"
+#include "h765.h"
+#include "h3712.h"
+#include "h1124.h"
+#ifdef X
+#include "h6229.h"
+#endif
+struct S6573 { int a; const char *s = "x//y"; };
+inline int f6573_0(int x) { return x * 0; }
+inline int f6573_1(int x) { return x * 1; }
+inline int f6573_2(int x) { return x * 2; }
+inline int f6573_3(int x) { return x * 3; }
+inline int f6573_4(int x) { return x * 4; }
+inline int f6573_5(int x) { return x * 5; }
+inline int f6573_6(int x) { return x * 6; }
+inline int f6573_7(int x) { return x * 7; }
+inline int f6573_8(int x) { return x * 8; }
+inline int f6573_9(int x) { return x * 9; }
+inline int f6573_10(int x) { return x * 10; }
+inline int f6573_11(int x) { return x * 11; }
+inline int f6573_12(int x) { return x * 12; }
+inline int f6573_13(int x) { return x * 13; }
+inline int f6573_14(int x) { return x * 14; }
+inline int f6573_15(int x) { return x * 15; }
+inline int f6573_16(int x) { return x * 16; }
+inline int f6573_17(int x) { return x * 17; }
+inline int f6573_18(int x) { return x * 18; }
+inline int f6573_19(int x) { return x * 19; }
+inline int f6573_20(int x) { return x * 20; }
+inline int f6573_21(int x) { return x * 21; }
+inline int f6573_22(int x) { return x * 22; }
+inline int f6573_23(int x) { return x * 23; }
+inline int f6573_24(int x) { return x * 24; }
+inline int f6573_25(int x) { return x * 25; }
+inline int f6573_26(int x) { return x * 26; }
+inline int f6573_27(int x) { return x * 27; }
+inline int f6573_28(int x) { return x * 28; }
+inline int f6573_29(int x) { return x * 29; }
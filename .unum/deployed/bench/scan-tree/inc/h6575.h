@@ -0,0 +1,42 @@
+#pragma once
+/* header 6575 */
+#include <vector>
+#include "h3540.h"
+#include "h8626.h"
+#include "h742.h"
+#include "h9604.h"
+#include "h8264.h"
+#ifdef X
+#include "h5313.h"
+#endif
+struct S6575 { int a; const char *s = "x//y"; };
+inline int f6575_0(int x) { return x * 0; }
+inline int f6575_1(int x) { return x * 1; }
+inline int f6575_2(int x) { return x * 2; }
+inline int f6575_3(int x) { return x * 3; }
+inline int f6575_4(int x) { return x * 4; }
+inline int f6575_5(int x) { return x * 5; }
+inline int f6575_6(int x) { return x * 6; }
+inline int f6575_7(int x) { return x * 7; }
+inline int f6575_8(int x) { return x * 8; }
+inline int f6575_9(int x) { return x * 9; }
+inline int f6575_10(int x) { return x * 10; }
+inline int f6575_11(int x) { return x * 11; }
+inline int f6575_12(int x) { return x * 12; }
+inline int f6575_13(int x) { return x * 13; }
+inline int f6575_14(int x) { return x * 14; }
+inline int f6575_15(int x) { return x * 15; }
+inline int f6575_16(int x) { return x * 16; }
+inline int f6575_17(int x) { return x * 17; }
+inline int f6575_18(int x) { return x * 18; }
+inline int f6575_19(int x) { return x * 19; }
+inline int f6575_20(int x) { return x * 20; }
+inline int f6575_21(int x) { return x * 21; }
+inline int f6575_22(int x) { return x * 22; }
+inline int f6575_23(int x) { return x * 23; }
+inline int f6575_24(int x) { return x * 24; }
+inline int f6575_25(int x) { return x * 25; }
+inline int f6575_26(int x) { return x * 26; }
+inline int f6575_27(int x) { return x * 27; }
+inline int f6575_28(int x) { return x * 28; }
+inline int f6575_29(int x) { return x * 29; }
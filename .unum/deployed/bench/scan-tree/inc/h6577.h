@@ -0,0 +1,42 @@
+#pragma once
+/* header 6577 */
+#include <vector>
+#include "h9900.h"
+#include "h2597.h"
+#include "h789.h"
+#include "h6971.h"
+#include "h32.h"
+#ifdef X
+#include "h4856.h"
+#endif
+struct S6577 { int a; const char *s = "x//y"; };
+inline int f6577_0(int x) { return x * 0; }
+inline int f6577_1(int x) { return x * 1; }
+inline int f6577_2(int x) { return x * 2; }
+inline int f6577_3(int x) { return x * 3; }
+inline int f6577_4(int x) { return x * 4; }
+inline int f6577_5(int x) { return x * 5; }
+inline int f6577_6(int x) { return x * 6; }
+inline int f6577_7(int x) { return x * 7; }
+inline int f6577_8(int x) { return x * 8; }
+inline int f6577_9(int x) { return x * 9; }
+inline int f6577_10(int x) { return x * 10; }
+inline int f6577_11(int x) { return x * 11; }
+inline int f6577_12(int x) { return x * 12; }
+inline int f6577_13(int x) { return x * 13; }
+inline int f6577_14(int x) { return x * 14; }
+inline int f6577_15(int x) { return x * 15; }
+inline int f6577_16(int x) { return x * 16; }
+inline int f6577_17(int x) { return x * 17; }
+inline int f6577_18(int x) { return x * 18; }
+inline int f6577_19(int x) { return x * 19; }
+inline int f6577_20(int x) { return x * 20; }
+inline int f6577_21(int x) { return x * 21; }
+inline int f6577_22(int x) { return x * 22; }
+inline int f6577_23(int x) { return x * 23; }
+inline int f6577_24(int x) { return x * 24; }
+inline int f6577_25(int x) { return x * 25; }
+inline int f6577_26(int x) { return x * 26; }
+inline int f6577_27(int x) { return x * 27; }
+inline int f6577_28(int x) { return x * 28; }
+inline int f6577_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6580 */
+#include <vector>
+#include "h8991.h"
+#include "h5891.h"
+#include "h9262.h"
+#include "h99.h"
+#include "h6472.h"
+#ifdef X
+#include "h2758.h"
+#endif
+struct S6580 { int a; const char *s = "x//y"; };
+inline int f6580_0(int x) { return x * 0; }
+inline int f6580_1(int x) { return x * 1; }
+inline int f6580_2(int x) { return x * 2; }
+inline int f6580_3(int x) { return x * 3; }
+inline int f6580_4(int x) { return x * 4; }
+inline int f6580_5(int x) { return x * 5; }
+inline int f6580_6(int x) { return x * 6; }
+inline int f6580_7(int x) { return x * 7; }
+inline int f6580_8(int x) { return x * 8; }
+inline int f6580_9(int x) { return x * 9; }
+inline int f6580_10(int x) { return x * 10; }
+inline int f6580_11(int x) { return x * 11; }
+inline int f6580_12(int x) { return x * 12; }
+inline int f6580_13(int x) { return x * 13; }
+inline int f6580_14(int x) { return x * 14; }
+inline int f6580_15(int x) { return x * 15; }
+inline int f6580_16(int x) { return x * 16; }
+inline int f6580_17(int x) { return x * 17; }
+inline int f6580_18(int x) { return x * 18; }
+inline int f6580_19(int x) { return x * 19; }
+inline int f6580_20(int x) { return x * 20; }
+inline int f6580_21(int x) { return x * 21; }
+inline int f6580_22(int x) { return x * 22; }
+inline int f6580_23(int x) { return x * 23; }
+inline int f6580_24(int x) { return x * 24; }
+inline int f6580_25(int x) { return x * 25; }
+inline int f6580_26(int x) { return x * 26; }
+inline int f6580_27(int x) { return x * 27; }
+inline int f6580_28(int x) { return x * 28; }
+inline int f6580_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6581 */
+#include <vector>
+#include "h7461.h"
+#include "h5040.h"
+#include "h4939.h"
+#include "h2606.h"
+#include "h2688.h"
+#ifdef X
+#include "h9431.h"
+#endif
+struct S6581 { int a; const char *s = "x//y"; };
+inline int f6581_0(int x) { return x * 0; }
+inline int f6581_1(int x) { return x * 1; }
+inline int f6581_2(int x) { return x * 2; }
+inline int f6581_3(int x) { return x * 3; }
+inline int f6581_4(int x) { return x * 4; }
+inline int f6581_5(int x) { return x * 5; }
+inline int f6581_6(int x) { return x * 6; }
+inline int f6581_7(int x) { return x * 7; }
+inline int f6581_8(int x) { return x * 8; }
+inline int f6581_9(int x) { return x * 9; }
+inline int f6581_10(int x) { return x * 10; }
+inline int f6581_11(int x) { return x * 11; }
+inline int f6581_12(int x) { return x * 12; }
+inline int f6581_13(int x) { return x * 13; }
+inline int f6581_14(int x) { return x * 14; }
+inline int f6581_15(int x) { return x * 15; }
+inline int f6581_16(int x) { return x * 16; }
+inline int f6581_17(int x) { return x * 17; }
+inline int f6581_18(int x) { return x * 18; }
+inline int f6581_19(int x) { return x * 19; }
+inline int f6581_20(int x) { return x * 20; }
+inline int f6581_21(int x) { return x * 21; }
+inline int f6581_22(int x) { return x * 22; }
+inline int f6581_23(int x) { return x * 23; }
+inline int f6581_24(int x) { return x * 24; }
+inline int f6581_25(int x) { return x * 25; }
+inline int f6581_26(int x) { return x * 26; }
+inline int f6581_27(int x) { return x * 27; }
+inline int f6581_28(int x) { return x * 28; }
+inline int f6581_29(int x) { return x * 29; }
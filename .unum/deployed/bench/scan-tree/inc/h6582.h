@@ -0,0 +1,42 @@
+#pragma once
+/* header 6582 */
+#include <vector>
+#include "h8260.h"
+#include "h8058.h"
+#include "h6522.h"
+#include "h7779.h"
+#include "h5965.h"
+#ifdef X
+#include "h8340.h"
+#endif
+struct S6582 { int a; const char *s = "x//y"; };
+inline int f6582_0(int x) { return x * 0; }
+inline int f6582_1(int x) { return x * 1; }
+inline int f6582_2(int x) { return x * 2; }
+inline int f6582_3(int x) { return x * 3; }
+inline int f6582_4(int x) { return x * 4; }
+inline int f6582_5(int x) { return x * 5; }
+inline int f6582_6(int x) { return x * 6; }
+inline int f6582_7(int x) { return x * 7; }
+inline int f6582_8(int x) { return x * 8; }
+inline int f6582_9(int x) { return x * 9; }
+inline int f6582_10(int x) { return x * 10; }
+inline int f6582_11(int x) { return x * 11; }
+inline int f6582_12(int x) { return x * 12; }
+inline int f6582_13(int x) { return x * 13; }
+inline int f6582_14(int x) { return x * 14; }
+inline int f6582_15(int x) { return x * 15; }
+inline int f6582_16(int x) { return x * 16; }
+inline int f6582_17(int x) { return x * 17; }
+inline int f6582_18(int x) { return x * 18; }
+inline int f6582_19(int x) { return x * 19; }
+inline int f6582_20(int x) { return x * 20; }
+inline int f6582_21(int x) { return x * 21; }
+inline int f6582_22(int x) { return x * 22; }
+inline int f6582_23(int x) { return x * 23; }
+inline int f6582_24(int x) { return x * 24; }
+inline int f6582_25(int x) { return x * 25; }
+inline int f6582_26(int x) { return x * 26; }
+inline int f6582_27(int x) { return x * 27; }
+inline int f6582_28(int x) { return x * 28; }
+inline int f6582_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6583 */
+#include <vector>
+#include "h4682.h"
+#include "h2865.h"
+#include "h2175.h"
+#include "h7834.h"
+#include "h8513.h"
+#ifdef X
+#include "h6263.h"
+#endif
+struct S6583 { int a; const char *s = "x//y"; };
+inline int f6583_0(int x) { return x * 0; }
+inline int f6583_1(int x) { return x * 1; }
+inline int f6583_2(int x) { return x * 2; }
+inline int f6583_3(int x) { return x * 3; }
+inline int f6583_4(int x) { return x * 4; }
+inline int f6583_5(int x) { return x * 5; }
+inline int f6583_6(int x) { return x * 6; }
+inline int f6583_7(int x) { return x * 7; }
+inline int f6583_8(int x) { return x * 8; }
+inline int f6583_9(int x) { return x * 9; }
+inline int f6583_10(int x) { return x * 10; }
+inline int f6583_11(int x) { return x * 11; }
+inline int f6583_12(int x) { return x * 12; }
+inline int f6583_13(int x) { return x * 13; }
+inline int f6583_14(int x) { return x * 14; }
+inline int f6583_15(int x) { return x * 15; }
+inline int f6583_16(int x) { return x * 16; }
+inline int f6583_17(int x) { return x * 17; }
+inline int f6583_18(int x) { return x * 18; }
+inline int f6583_19(int x) { return x * 19; }
+inline int f6583_20(int x) { return x * 20; }
+inline int f6583_21(int x) { return x * 21; }
+inline int f6583_22(int x) { return x * 22; }
+inline int f6583_23(int x) { return x * 23; }
+inline int f6583_24(int x) { return x * 24; }
+inline int f6583_25(int x) { return x * 25; }
+inline int f6583_26(int x) { return x * 26; }
+inline int f6583_27(int x) { return x * 27; }
+inline int f6583_28(int x) { return x * 28; }
+inline int f6583_29(int x) { return x * 29; }
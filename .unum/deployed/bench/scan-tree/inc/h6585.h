@@ -0,0 +1,42 @@
+#pragma once
+/* header 6585 */
+#include <vector>
+#include "h5275.h"
+#include "h5534.h"
+#include "h7480.h"
+#include "h3722.h"
+#include "h7884.h"
+#ifdef X
+#include "h824.h"
+#endif
+struct S6585 { int a; const char *s = "x//y"; };
+inline int f6585_0(int x) { return x * 0; }
+inline int f6585_1(int x) { return x * 1; }
+inline int f6585_2(int x) { return x * 2; }
+inline int f6585_3(int x) { return x * 3; }
+inline int f6585_4(int x) { return x * 4; }
+inline int f6585_5(int x) { return x * 5; }
+inline int f6585_6(int x) { return x * 6; }
+inline int f6585_7(int x) { return x * 7; }
+inline int f6585_8(int x) { return x * 8; }
+inline int f6585_9(int x) { return x * 9; }
+inline int f6585_10(int x) { return x * 10; }
+inline int f6585_11(int x) { return x * 11; }
+inline int f6585_12(int x) { return x * 12; }
+inline int f6585_13(int x) { return x * 13; }
+inline int f6585_14(int x) { return x * 14; }
+inline int f6585_15(int x) { return x * 15; }
+inline int f6585_16(int x) { return x * 16; }
+inline int f6585_17(int x) { return x * 17; }
+inline int f6585_18(int x) { return x * 18; }
+inline int f6585_19(int x) { return x * 19; }
+inline int f6585_20(int x) { return x * 20; }
+inline int f6585_21(int x) { return x * 21; }
+inline int f6585_22(int x) { return x * 22; }
+inline int f6585_23(int x) { return x * 23; }
+inline int f6585_24(int x) { return x * 24; }
+inline int f6585_25(int x) { return x * 25; }
+inline int f6585_26(int x) { return x * 26; }
+inline int f6585_27(int x) { return x * 27; }
+inline int f6585_28(int x) { return x * 28; }
+inline int f6585_29(int x) { return x * 29; }
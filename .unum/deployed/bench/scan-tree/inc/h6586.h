@@ -0,0 +1,42 @@
+#pragma once
+/* header 6586 */
+#include <vector>
+#include "h7369.h"
+#include "h9808.h"
+#include "h5300.h"
+#include "h7406.h"
+#include "h3804.h"
+#ifdef X
+#include "h1434.h"
+#endif
+struct S6586 { int a; const char *s = "x//y"; };
+inline int f6586_0(int x) { return x * 0; }
+inline int f6586_1(int x) { return x * 1; }
+inline int f6586_2(int x) { return x * 2; }
+inline int f6586_3(int x) { return x * 3; }
+inline int f6586_4(int x) { return x * 4; }
+inline int f6586_5(int x) { return x * 5; }
+inline int f6586_6(int x) { return x * 6; }
+inline int f6586_7(int x) { return x * 7; }
+inline int f6586_8(int x) { return x * 8; }
+inline int f6586_9(int x) { return x * 9; }
+inline int f6586_10(int x) { return x * 10; }
+inline int f6586_11(int x) { return x * 11; }
+inline int f6586_12(int x) { return x * 12; }
+inline int f6586_13(int x) { return x * 13; }
+inline int f6586_14(int x) { return x * 14; }
+inline int f6586_15(int x) { return x * 15; }
+inline int f6586_16(int x) { return x * 16; }
+inline int f6586_17(int x) { return x * 17; }
+inline int f6586_18(int x) { return x * 18; }
+inline int f6586_19(int x) { return x * 19; }
+inline int f6586_20(int x) { return x * 20; }
+inline int f6586_21(int x) { return x * 21; }
+inline int f6586_22(int x) { return x * 22; }
+inline int f6586_23(int x) { return x * 23; }
+inline int f6586_24(int x) { return x * 24; }
+inline int f6586_25(int x) { return x * 25; }
+inline int f6586_26(int x) { return x * 26; }
+inline int f6586_27(int x) { return x * 27; }
+inline int f6586_28(int x) { return x * 28; }
+inline int f6586_29(int x) { return x * 29; }
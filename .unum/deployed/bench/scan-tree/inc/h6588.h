@@ -0,0 +1,42 @@
+#pragma once
+/* header 6588 */
+#include <vector>
+#include "h2760.h"
+#include "h6259.h"
+#include "h4697.h"
+#include "h1811.h"
+#include "h9021.h"
+#ifdef X
+#include "h3038.h"
+#endif
+struct S6588 { int a; const char *s = "x//y"; };
+inline int f6588_0(int x) { return x * 0; }
+inline int f6588_1(int x) { return x * 1; }
+inline int f6588_2(int x) { return x * 2; }
+inline int f6588_3(int x) { return x * 3; }
+inline int f6588_4(int x) { return x * 4; }
+inline int f6588_5(int x) { return x * 5; }
+inline int f6588_6(int x) { return x * 6; }
+inline int f6588_7(int x) { return x * 7; }
+inline int f6588_8(int x) { return x * 8; }
+inline int f6588_9(int x) { return x * 9; }
+inline int f6588_10(int x) { return x * 10; }
+inline int f6588_11(int x) { return x * 11; }
+inline int f6588_12(int x) { return x * 12; }
+inline int f6588_13(int x) { return x * 13; }
+inline int f6588_14(int x) { return x * 14; }
+inline int f6588_15(int x) { return x * 15; }
+inline int f6588_16(int x) { return x * 16; }
+inline int f6588_17(int x) { return x * 17; }
+inline int f6588_18(int x) { return x * 18; }
+inline int f6588_19(int x) { return x * 19; }
+inline int f6588_20(int x) { return x * 20; }
+inline int f6588_21(int x) { return x * 21; }
+inline int f6588_22(int x) { return x * 22; }
+inline int f6588_23(int x) { return x * 23; }
+inline int f6588_24(int x) { return x * 24; }
+inline int f6588_25(int x) { return x * 25; }
+inline int f6588_26(int x) { return x * 26; }
+inline int f6588_27(int x) { return x * 27; }
+inline int f6588_28(int x) { return x * 28; }
+inline int f6588_29(int x) { return x * 29; }
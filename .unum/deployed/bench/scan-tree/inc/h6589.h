@@ -0,0 +1,42 @@
+#pragma once
+/* header 6589 */
+#include <vector>
+#include "h6246.h"
+#include "h8051.h"
+#include "h2953.h"
+#include "h8367.h"
+#include "h7554.h"
+#ifdef X
+#include "h8061.h"
+#endif
+struct S6589 { int a; const char *s = "x//y"; };
+inline int f6589_0(int x) { return x * 0; }
+inline int f6589_1(int x) { return x * 1; }
+inline int f6589_2(int x) { return x * 2; }
+inline int f6589_3(int x) { return x * 3; }
+inline int f6589_4(int x) { return x * 4; }
+inline int f6589_5(int x) { return x * 5; }
+inline int f6589_6(int x) { return x * 6; }
+inline int f6589_7(int x) { return x * 7; }
+inline int f6589_8(int x) { return x * 8; }
+inline int f6589_9(int x) { return x * 9; }
+inline int f6589_10(int x) { return x * 10; }
+inline int f6589_11(int x) { return x * 11; }
+inline int f6589_12(int x) { return x * 12; }
+inline int f6589_13(int x) { return x * 13; }
+inline int f6589_14(int x) { return x * 14; }
+inline int f6589_15(int x) { return x * 15; }
+inline int f6589_16(int x) { return x * 16; }
+inline int f6589_17(int x) { return x * 17; }
+inline int f6589_18(int x) { return x * 18; }
+inline int f6589_19(int x) { return x * 19; }
+inline int f6589_20(int x) { return x * 20; }
+inline int f6589_21(int x) { return x * 21; }
+inline int f6589_22(int x) { return x * 22; }
+inline int f6589_23(int x) { return x * 23; }
+inline int f6589_24(int x) { return x * 24; }
+inline int f6589_25(int x) { return x * 25; }
+inline int f6589_26(int x) { return x * 26; }
+inline int f6589_27(int x) { return x * 27; }
+inline int f6589_28(int x) { return x * 28; }
+inline int f6589_29(int x) { return x * 29; }
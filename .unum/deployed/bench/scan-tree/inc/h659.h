@@ -0,0 +1,42 @@
+#pragma once
+/* header 659 */
+#include <vector>
+#include "h6804.h"
+#include "h1446.h"
+#include "h7719.h"
+#include "h8087.h"
+#include "h3234.h"
+#ifdef X
+#include "h3628.h"
+#endif
+struct S659 { int a; const char *s = "x//y"; };
+inline int f659_0(int x) { return x * 0; }
+inline int f659_1(int x) { return x * 1; }
+inline int f659_2(int x) { return x * 2; }
+inline int f659_3(int x) { return x * 3; }
+inline int f659_4(int x) { return x * 4; }
+inline int f659_5(int x) { return x * 5; }
+inline int f659_6(int x) { return x * 6; }
+inline int f659_7(int x) { return x * 7; }
+inline int f659_8(int x) { return x * 8; }
+inline int f659_9(int x) { return x * 9; }
+inline int f659_10(int x) { return x * 10; }
+inline int f659_11(int x) { return x * 11; }
+inline int f659_12(int x) { return x * 12; }
+inline int f659_13(int x) { return x * 13; }
+inline int f659_14(int x) { return x * 14; }
+inline int f659_15(int x) { return x * 15; }
+inline int f659_16(int x) { return x * 16; }
+inline int f659_17(int x) { return x * 17; }
+inline int f659_18(int x) { return x * 18; }
+inline int f659_19(int x) { return x * 19; }
+inline int f659_20(int x) { return x * 20; }
+inline int f659_21(int x) { return x * 21; }
+inline int f659_22(int x) { return x * 22; }
+inline int f659_23(int x) { return x * 23; }
+inline int f659_24(int x) { return x * 24; }
+inline int f659_25(int x) { return x * 25; }
+inline int f659_26(int x) { return x * 26; }
+inline int f659_27(int x) { return x * 27; }
+inline int f659_28(int x) { return x * 28; }
+inline int f659_29(int x) { return x * 29; }
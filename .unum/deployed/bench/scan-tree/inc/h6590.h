@@ -0,0 +1,42 @@
+#pragma once
+/* header 6590 */
+#include <vector>
+#include "h9333.h"
+#include "h4732.h"
+#include "h1587.h"
+#include "h8708.h"
+#include "h6252.h"
+#ifdef X
+#include "h1447.h"
+#endif
+struct S6590 { int a; const char *s = "x//y"; };
+inline int f6590_0(int x) { return x * 0; }
+inline int f6590_1(int x) { return x * 1; }
+inline int f6590_2(int x) { return x * 2; }
+inline int f6590_3(int x) { return x * 3; }
+inline int f6590_4(int x) { return x * 4; }
+inline int f6590_5(int x) { return x * 5; }
+inline int f6590_6(int x) { return x * 6; }
+inline int f6590_7(int x) { return x * 7; }
+inline int f6590_8(int x) { return x * 8; }
+inline int f6590_9(int x) { return x * 9; }
+inline int f6590_10(int x) { return x * 10; }
+inline int f6590_11(int x) { return x * 11; }
+inline int f6590_12(int x) { return x * 12; }
+inline int f6590_13(int x) { return x * 13; }
+inline int f6590_14(int x) { return x * 14; }
+inline int f6590_15(int x) { return x * 15; }
+inline int f6590_16(int x) { return x * 16; }
+inline int f6590_17(int x) { return x * 17; }
+inline int f6590_18(int x) { return x * 18; }
+inline int f6590_19(int x) { return x * 19; }
+inline int f6590_20(int x) { return x * 20; }
+inline int f6590_21(int x) { return x * 21; }
+inline int f6590_22(int x) { return x * 22; }
+inline int f6590_23(int x) { return x * 23; }
+inline int f6590_24(int x) { return x * 24; }
+inline int f6590_25(int x) { return x * 25; }
+inline int f6590_26(int x) { return x * 26; }
+inline int f6590_27(int x) { return x * 27; }
+inline int f6590_28(int x) { return x * 28; }
+inline int f6590_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6594 */
+#include <vector>
+#include "h2026.h"
+#include "h4654.h"
+#include "h5161.h"
+#include "h34.h"
+#include "h5226.h"
+#ifdef X
+#include "h9100.h"
+#endif
+struct S6594 { int a; const char *s = "x//y"; };
+inline int f6594_0(int x) { return x * 0; }
+inline int f6594_1(int x) { return x * 1; }
+inline int f6594_2(int x) { return x * 2; }
+inline int f6594_3(int x) { return x * 3; }
+inline int f6594_4(int x) { return x * 4; }
+inline int f6594_5(int x) { return x * 5; }
+inline int f6594_6(int x) { return x * 6; }
+inline int f6594_7(int x) { return x * 7; }
+inline int f6594_8(int x) { return x * 8; }
+inline int f6594_9(int x) { return x * 9; }
+inline int f6594_10(int x) { return x * 10; }
+inline int f6594_11(int x) { return x * 11; }
+inline int f6594_12(int x) { return x * 12; }
+inline int f6594_13(int x) { return x * 13; }
+inline int f6594_14(int x) { return x * 14; }
+inline int f6594_15(int x) { return x * 15; }
+inline int f6594_16(int x) { return x * 16; }
+inline int f6594_17(int x) { return x * 17; }
+inline int f6594_18(int x) { return x * 18; }
+inline int f6594_19(int x) { return x * 19; }
+inline int f6594_20(int x) { return x * 20; }
+inline int f6594_21(int x) { return x * 21; }
+inline int f6594_22(int x) { return x * 22; }
+inline int f6594_23(int x) { return x * 23; }
+inline int f6594_24(int x) { return x * 24; }
+inline int f6594_25(int x) { return x * 25; }
+inline int f6594_26(int x) { return x * 26; }
+inline int f6594_27(int x) { return x * 27; }
+inline int f6594_28(int x) { return x * 28; }
+inline int f6594_29(int x) { return x * 29; }
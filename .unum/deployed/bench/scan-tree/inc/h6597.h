@@ -0,0 +1,42 @@
+#pragma once
+/* header 6597 */
+#include <vector>
+#include "h1648.h"
+#include "h3978.h"
+#include "h7795.h"
+#include "h2147.h"
+#include "h719.h"
+#ifdef X
+#include "h6504.h"
+#endif
+struct S6597 { int a; const char *s = "x//y"; };
+inline int f6597_0(int x) { return x * 0; }
+inline int f6597_1(int x) { return x * 1; }
+inline int f6597_2(int x) { return x * 2; }
+inline int f6597_3(int x) { return x * 3; }
+inline int f6597_4(int x) { return x * 4; }
+inline int f6597_5(int x) { return x * 5; }
+inline int f6597_6(int x) { return x * 6; }
+inline int f6597_7(int x) { return x * 7; }
+inline int f6597_8(int x) { return x * 8; }
+inline int f6597_9(int x) { return x * 9; }
+inline int f6597_10(int x) { return x * 10; }
+inline int f6597_11(int x) { return x * 11; }
+inline int f6597_12(int x) { return x * 12; }
+inline int f6597_13(int x) { return x * 13; }
+inline int f6597_14(int x) { return x * 14; }
+inline int f6597_15(int x) { return x * 15; }
+inline int f6597_16(int x) { return x * 16; }
+inline int f6597_17(int x) { return x * 17; }
+inline int f6597_18(int x) { return x * 18; }
+inline int f6597_19(int x) { return x * 19; }
+inline int f6597_20(int x) { return x * 20; }
+inline int f6597_21(int x) { return x * 21; }
+inline int f6597_22(int x) { return x * 22; }
+inline int f6597_23(int x) { return x * 23; }
+inline int f6597_24(int x) { return x * 24; }
+inline int f6597_25(int x) { return x * 25; }
+inline int f6597_26(int x) { return x * 26; }
+inline int f6597_27(int x) { return x * 27; }
+inline int f6597_28(int x) { return x * 28; }
+inline int f6597_29(int x) { return x * 29; }
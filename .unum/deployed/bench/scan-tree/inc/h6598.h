@@ -0,0 +1,42 @@
+#pragma once
+/* header 6598 */
+#include <vector>
+#include "h7037.h"
+#include "h5237.h"
+#include "h762.h"
+#include "h8302.h"
+#include "h5635.h"
+#ifdef X
+#include "h1933.h"
+#endif
+struct S6598 { int a; const char *s = "x//y"; };
+inline int f6598_0(int x) { return x * 0; }
+inline int f6598_1(int x) { return x * 1; }
+inline int f6598_2(int x) { return x * 2; }
+inline int f6598_3(int x) { return x * 3; }
+inline int f6598_4(int x) { return x * 4; }
+inline int f6598_5(int x) { return x * 5; }
+inline int f6598_6(int x) { return x * 6; }
+inline int f6598_7(int x) { return x * 7; }
+inline int f6598_8(int x) { return x * 8; }
+inline int f6598_9(int x) { return x * 9; }
+inline int f6598_10(int x) { return x * 10; }
+inline int f6598_11(int x) { return x * 11; }
+inline int f6598_12(int x) { return x * 12; }
+inline int f6598_13(int x) { return x * 13; }
+inline int f6598_14(int x) { return x * 14; }
+inline int f6598_15(int x) { return x * 15; }
+inline int f6598_16(int x) { return x * 16; }
+inline int f6598_17(int x) { return x * 17; }
+inline int f6598_18(int x) { return x * 18; }
+inline int f6598_19(int x) { return x * 19; }
+inline int f6598_20(int x) { return x * 20; }
+inline int f6598_21(int x) { return x * 21; }
+inline int f6598_22(int x) { return x * 22; }
+inline int f6598_23(int x) { return x * 23; }
+inline int f6598_24(int x) { return x * 24; }
+inline int f6598_25(int x) { return x * 25; }
+inline int f6598_26(int x) { return x * 26; }
+inline int f6598_27(int x) { return x * 27; }
+inline int f6598_28(int x) { return x * 28; }
+inline int f6598_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6599 */
+#include <vector>
+#include "h8060.h"
+#include "h8065.h"
+#include "h991.h"
+#include "h2729.h"
+#include "h4925.h"
+#ifdef X
+#include "h1331.h"
+#endif
+struct S6599 { int a; const char *s = "x//y"; };
+inline int f6599_0(int x) { return x * 0; }
+inline int f6599_1(int x) { return x * 1; }
+inline int f6599_2(int x) { return x * 2; }
+inline int f6599_3(int x) { return x * 3; }
+inline int f6599_4(int x) { return x * 4; }
+inline int f6599_5(int x) { return x * 5; }
+inline int f6599_6(int x) { return x * 6; }
+inline int f6599_7(int x) { return x * 7; }
+inline int f6599_8(int x) { return x * 8; }
+inline int f6599_9(int x) { return x * 9; }
+inline int f6599_10(int x) { return x * 10; }
+inline int f6599_11(int x) { return x * 11; }
+inline int f6599_12(int x) { return x * 12; }
+inline int f6599_13(int x) { return x * 13; }
+inline int f6599_14(int x) { return x * 14; }
+inline int f6599_15(int x) { return x * 15; }
+inline int f6599_16(int x) { return x * 16; }
+inline int f6599_17(int x) { return x * 17; }
+inline int f6599_18(int x) { return x * 18; }
+inline int f6599_19(int x) { return x * 19; }
+inline int f6599_20(int x) { return x * 20; }
+inline int f6599_21(int x) { return x * 21; }
+inline int f6599_22(int x) { return x * 22; }
+inline int f6599_23(int x) { return x * 23; }
+inline int f6599_24(int x) { return x * 24; }
+inline int f6599_25(int x) { return x * 25; }
+inline int f6599_26(int x) { return x * 26; }
+inline int f6599_27(int x) { return x * 27; }
+inline int f6599_28(int x) { return x * 28; }
+inline int f6599_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 66 */
+#include <vector>
+#include "h3982.h"
+#include "h5478.h"
+#include "h1186.h"
+#include "h1796.h"
+#include "h9531.h"
+#ifdef X
+#include "h1529.h"
+#endif
+struct S66 { int a; const char *s = "x//y"; };
+inline int f66_0(int x) { return x * 0; }
+inline int f66_1(int x) { return x * 1; }
+inline int f66_2(int x) { return x * 2; }
+inline int f66_3(int x) { return x * 3; }
+inline int f66_4(int x) { return x * 4; }
+inline int f66_5(int x) { return x * 5; }
+inline int f66_6(int x) { return x * 6; }
+inline int f66_7(int x) { return x * 7; }
+inline int f66_8(int x) { return x * 8; }
+inline int f66_9(int x) { return x * 9; }
+inline int f66_10(int x) { return x * 10; }
+inline int f66_11(int x) { return x * 11; }
+inline int f66_12(int x) { return x * 12; }
+inline int f66_13(int x) { return x * 13; }
+inline int f66_14(int x) { return x * 14; }
+inline int f66_15(int x) { return x * 15; }
+inline int f66_16(int x) { return x * 16; }
+inline int f66_17(int x) { return x * 17; }
+inline int f66_18(int x) { return x * 18; }
+inline int f66_19(int x) { return x * 19; }
+inline int f66_20(int x) { return x * 20; }
+inline int f66_21(int x) { return x * 21; }
+inline int f66_22(int x) { return x * 22; }
+inline int f66_23(int x) { return x * 23; }
+inline int f66_24(int x) { return x * 24; }
+inline int f66_25(int x) { return x * 25; }
+inline int f66_26(int x) { return x * 26; }
+inline int f66_27(int x) { return x * 27; }
+inline int f66_28(int x) { return x * 28; }
+inline int f66_29(int x) { return x * 29; }
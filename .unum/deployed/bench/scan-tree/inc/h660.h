@@ -0,0 +1,42 @@
+#pragma once
+/* header 660 */
+#include <vector>
+#include "h7003.h"
+#include "h200.h"
+#include "h2419.h"
+#include "h5514.h"
+#include "h8464.h"
+#ifdef X
+#include "h906.h"
+#endif
+struct S660 { int a; const char *s = "x//y"; };
+inline int f660_0(int x) { return x * 0; }
+inline int f660_1(int x) { return x * 1; }
+inline int f660_2(int x) { return x * 2; }
+inline int f660_3(int x) { return x * 3; }
+inline int f660_4(int x) { return x * 4; }
+inline int f660_5(int x) { return x * 5; }
+inline int f660_6(int x) { return x * 6; }
+inline int f660_7(int x) { return x * 7; }
+inline int f660_8(int x) { return x * 8; }
+inline int f660_9(int x) { return x * 9; }
+inline int f660_10(int x) { return x * 10; }
+inline int f660_11(int x) { return x * 11; }
+inline int f660_12(int x) { return x * 12; }
+inline int f660_13(int x) { return x * 13; }
+inline int f660_14(int x) { return x * 14; }
+inline int f660_15(int x) { return x * 15; }
+inline int f660_16(int x) { return x * 16; }
+inline int f660_17(int x) { return x * 17; }
+inline int f660_18(int x) { return x * 18; }
+inline int f660_19(int x) { return x * 19; }
+inline int f660_20(int x) { return x * 20; }
+inline int f660_21(int x) { return x * 21; }
+inline int f660_22(int x) { return x * 22; }
+inline int f660_23(int x) { return x * 23; }
+inline int f660_24(int x) { return x * 24; }
+inline int f660_25(int x) { return x * 25; }
+inline int f660_26(int x) { return x * 26; }
+inline int f660_27(int x) { return x * 27; }
+inline int f660_28(int x) { return x * 28; }
+inline int f660_29(int x) { return x * 29; }
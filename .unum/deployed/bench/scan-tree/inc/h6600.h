@@ -0,0 +1,42 @@
+#pragma once
+/* header 6600 */
+#include <vector>
+#include "h8778.h"
+#include "h9635.h"
+#include "h9210.h"
+#include "h5312.h"
+#include "h6287.h"
+#ifdef X
+#include "h4526.h"
+#endif
+struct S6600 { int a; const char *s = "x//y"; };
+inline int f6600_0(int x) { return x * 0; }
+inline int f6600_1(int x) { return x * 1; }
+inline int f6600_2(int x) { return x * 2; }
+inline int f6600_3(int x) { return x * 3; }
+inline int f6600_4(int x) { return x * 4; }
+inline int f6600_5(int x) { return x * 5; }
+inline int f6600_6(int x) { return x * 6; }
+inline int f6600_7(int x) { return x * 7; }
+inline int f6600_8(int x) { return x * 8; }
+inline int f6600_9(int x) { return x * 9; }
+inline int f6600_10(int x) { return x * 10; }
+inline int f6600_11(int x) { return x * 11; }
+inline int f6600_12(int x) { return x * 12; }
+inline int f6600_13(int x) { return x * 13; }
+inline int f6600_14(int x) { return x * 14; }
+inline int f6600_15(int x) { return x * 15; }
+inline int f6600_16(int x) { return x * 16; }
+inline int f6600_17(int x) { return x * 17; }
+inline int f6600_18(int x) { return x * 18; }
+inline int f6600_19(int x) { return x * 19; }
+inline int f6600_20(int x) { return x * 20; }
+inline int f6600_21(int x) { return x * 21; }
+inline int f6600_22(int x) { return x * 22; }
+inline int f6600_23(int x) { return x * 23; }
+inline int f6600_24(int x) { return x * 24; }
+inline int f6600_25(int x) { return x * 25; }
+inline int f6600_26(int x) { return x * 26; }
+inline int f6600_27(int x) { return x * 27; }
+inline int f6600_28(int x) { return x * 28; }
+inline int f6600_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6606 */
+#include <vector>
+#include "h1632.h"
+#include "h8370.h"
+#include "h7056.h"
+#include "h8217.h"
+#include "h7847.h"
+#ifdef X
+#include "h5691.h"
+#endif
+struct S6606 { int a; const char *s = "x//y"; };
+inline int f6606_0(int x) { return x * 0; }
+inline int f6606_1(int x) { return x * 1; }
+inline int f6606_2(int x) { return x * 2; }
+inline int f6606_3(int x) { return x * 3; }
+inline int f6606_4(int x) { return x * 4; }
+inline int f6606_5(int x) { return x * 5; }
+inline int f6606_6(int x) { return x * 6; }
+inline int f6606_7(int x) { return x * 7; }
+inline int f6606_8(int x) { return x * 8; }
+inline int f6606_9(int x) { return x * 9; }
+inline int f6606_10(int x) { return x * 10; }
+inline int f6606_11(int x) { return x * 11; }
+inline int f6606_12(int x) { return x * 12; }
+inline int f6606_13(int x) { return x * 13; }
+inline int f6606_14(int x) { return x * 14; }
+inline int f6606_15(int x) { return x * 15; }
+inline int f6606_16(int x) { return x * 16; }
+inline int f6606_17(int x) { return x * 17; }
+inline int f6606_18(int x) { return x * 18; }
+inline int f6606_19(int x) { return x * 19; }
+inline int f6606_20(int x) { return x * 20; }
+inline int f6606_21(int x) { return x * 21; }
+inline int f6606_22(int x) { return x * 22; }
+inline int f6606_23(int x) { return x * 23; }
+inline int f6606_24(int x) { return x * 24; }
+inline int f6606_25(int x) { return x * 25; }
+inline int f6606_26(int x) { return x * 26; }
+inline int f6606_27(int x) { return x * 27; }
+inline int f6606_28(int x) { return x * 28; }
+inline int f6606_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6608 */
+#include <vector>
+#include "h9075.h"
+#include "h9804.h"
+#include "h4219.h"
+#include "h8793.h"
+#include "h8850.h"
+#ifdef X
+#include "h7623.h"
+#endif
+struct S6608 { int a; const char *s = "x//y"; };
+inline int f6608_0(int x) { return x * 0; }
+inline int f6608_1(int x) { return x * 1; }
+inline int f6608_2(int x) { return x * 2; }
+inline int f6608_3(int x) { return x * 3; }
+inline int f6608_4(int x) { return x * 4; }
+inline int f6608_5(int x) { return x * 5; }
+inline int f6608_6(int x) { return x * 6; }
+inline int f6608_7(int x) { return x * 7; }
+inline int f6608_8(int x) { return x * 8; }
+inline int f6608_9(int x) { return x * 9; }
+inline int f6608_10(int x) { return x * 10; }
+inline int f6608_11(int x) { return x * 11; }
+inline int f6608_12(int x) { return x * 12; }
+inline int f6608_13(int x) { return x * 13; }
+inline int f6608_14(int x) { return x * 14; }
+inline int f6608_15(int x) { return x * 15; }
+inline int f6608_16(int x) { return x * 16; }
+inline int f6608_17(int x) { return x * 17; }
+inline int f6608_18(int x) { return x * 18; }
+inline int f6608_19(int x) { return x * 19; }
+inline int f6608_20(int x) { return x * 20; }
+inline int f6608_21(int x) { return x * 21; }
+inline int f6608_22(int x) { return x * 22; }
+inline int f6608_23(int x) { return x * 23; }
+inline int f6608_24(int x) { return x * 24; }
+inline int f6608_25(int x) { return x * 25; }
+inline int f6608_26(int x) { return x * 26; }
+inline int f6608_27(int x) { return x * 27; }
+inline int f6608_28(int x) { return x * 28; }
+inline int f6608_29(int x) { return x * 29; }
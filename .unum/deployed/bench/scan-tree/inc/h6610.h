@@ -0,0 +1,42 @@
+#pragma once
+/* header 6610 */
+#include <vector>
+#include "h2312.h"
+#include "h5333.h"
+#include "h5743.h"
+#include "h6504.h"
+#include "h3516.h"
+#ifdef X
+#include "h5110.h"
+#endif
+struct S6610 { int a; const char *s = "x//y"; };
+inline int f6610_0(int x) { return x * 0; }
+inline int f6610_1(int x) { return x * 1; }
+inline int f6610_2(int x) { return x * 2; }
+inline int f6610_3(int x) { return x * 3; }
+inline int f6610_4(int x) { return x * 4; }
+inline int f6610_5(int x) { return x * 5; }
+inline int f6610_6(int x) { return x * 6; }
+inline int f6610_7(int x) { return x * 7; }
+inline int f6610_8(int x) { return x * 8; }
+inline int f6610_9(int x) { return x * 9; }
+inline int f6610_10(int x) { return x * 10; }
+inline int f6610_11(int x) { return x * 11; }
+inline int f6610_12(int x) { return x * 12; }
+inline int f6610_13(int x) { return x * 13; }
+inline int f6610_14(int x) { return x * 14; }
+inline int f6610_15(int x) { return x * 15; }
+inline int f6610_16(int x) { return x * 16; }
+inline int f6610_17(int x) { return x * 17; }
+inline int f6610_18(int x) { return x * 18; }
+inline int f6610_19(int x) { return x * 19; }
+inline int f6610_20(int x) { return x * 20; }
+inline int f6610_21(int x) { return x * 21; }
+inline int f6610_22(int x) { return x * 22; }
+inline int f6610_23(int x) { return x * 23; }
+inline int f6610_24(int x) { return x * 24; }
+inline int f6610_25(int x) { return x * 25; }
+inline int f6610_26(int x) { return x * 26; }
+inline int f6610_27(int x) { return x * 27; }
+inline int f6610_28(int x) { return x * 28; }
+inline int f6610_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6611 */
+#include <vector>
+#include "h2685.h"
+#include "h1094.h"
+#include "h5327.h"
+#include "h2478.h"
+#include "h8922.h"
+#ifdef X
+#include "h2312.h"
+#endif
+struct S6611 { int a; const char *s = "x//y"; };
+inline int f6611_0(int x) { return x * 0; }
+inline int f6611_1(int x) { return x * 1; }
+inline int f6611_2(int x) { return x * 2; }
+inline int f6611_3(int x) { return x * 3; }
+inline int f6611_4(int x) { return x * 4; }
+inline int f6611_5(int x) { return x * 5; }
+inline int f6611_6(int x) { return x * 6; }
+inline int f6611_7(int x) { return x * 7; }
+inline int f6611_8(int x) { return x * 8; }
+inline int f6611_9(int x) { return x * 9; }
+inline int f6611_10(int x) { return x * 10; }
+inline int f6611_11(int x) { return x * 11; }
+inline int f6611_12(int x) { return x * 12; }
+inline int f6611_13(int x) { return x * 13; }
+inline int f6611_14(int x) { return x * 14; }
+inline int f6611_15(int x) { return x * 15; }
+inline int f6611_16(int x) { return x * 16; }
+inline int f6611_17(int x) { return x * 17; }
+inline int f6611_18(int x) { return x * 18; }
+inline int f6611_19(int x) { return x * 19; }
+inline int f6611_20(int x) { return x * 20; }
+inline int f6611_21(int x) { return x * 21; }
+inline int f6611_22(int x) { return x * 22; }
+inline int f6611_23(int x) { return x * 23; }
+inline int f6611_24(int x) { return x * 24; }
+inline int f6611_25(int x) { return x * 25; }
+inline int f6611_26(int x) { return x * 26; }
+inline int f6611_27(int x) { return x * 27; }
+inline int f6611_28(int x) { return x * 28; }
+inline int f6611_29(int x) { return x * 29; }
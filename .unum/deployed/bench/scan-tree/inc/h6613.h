@@ -0,0 +1,42 @@
+#pragma once
+/* header 6613 */
+#include <vector>
+#include "h6598.h"
+#include "h4522.h"
+#include "h5544.h"
+#include "h4137.h"
+#include "h6600.h"
+#ifdef X
+#include "h7201.h"
+#endif
+struct S6613 { int a; const char *s = "x//y"; };
+inline int f6613_0(int x) { return x * 0; }
+inline int f6613_1(int x) { return x * 1; }
+inline int f6613_2(int x) { return x * 2; }
+inline int f6613_3(int x) { return x * 3; }
+inline int f6613_4(int x) { return x * 4; }
+inline int f6613_5(int x) { return x * 5; }
+inline int f6613_6(int x) { return x * 6; }
+inline int f6613_7(int x) { return x * 7; }
+inline int f6613_8(int x) { return x * 8; }
+inline int f6613_9(int x) { return x * 9; }
+inline int f6613_10(int x) { return x * 10; }
+inline int f6613_11(int x) { return x * 11; }
+inline int f6613_12(int x) { return x * 12; }
+inline int f6613_13(int x) { return x * 13; }
+inline int f6613_14(int x) { return x * 14; }
+inline int f6613_15(int x) { return x * 15; }
+inline int f6613_16(int x) { return x * 16; }
+inline int f6613_17(int x) { return x * 17; }
+inline int f6613_18(int x) { return x * 18; }
+inline int f6613_19(int x) { return x * 19; }
+inline int f6613_20(int x) { return x * 20; }
+inline int f6613_21(int x) { return x * 21; }
+inline int f6613_22(int x) { return x * 22; }
+inline int f6613_23(int x) { return x * 23; }
+inline int f6613_24(int x) { return x * 24; }
+inline int f6613_25(int x) { return x * 25; }
+inline int f6613_26(int x) { return x * 26; }
+inline int f6613_27(int x) { return x * 27; }
+inline int f6613_28(int x) { return x * 28; }
+inline int f6613_29(int x) { return x * 29; }
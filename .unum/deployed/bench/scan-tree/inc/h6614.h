@@ -0,0 +1,42 @@
+#pragma once
+/* header 6614 */
+#include <vector>
+#include "h117.h"
+#include "h278.h"
+#include "h3993.h"
+#include "h166.h"
+#include "h7860.h"
+#ifdef X
+#include "h357.h"
+#endif
+struct S6614 { int a; const char *s = "x//y"; };
+inline int f6614_0(int x) { return x * 0; }
+inline int f6614_1(int x) { return x * 1; }
+inline int f6614_2(int x) { return x * 2; }
+inline int f6614_3(int x) { return x * 3; }
+inline int f6614_4(int x) { return x * 4; }
+inline int f6614_5(int x) { return x * 5; }
+inline int f6614_6(int x) { return x * 6; }
+inline int f6614_7(int x) { return x * 7; }
+inline int f6614_8(int x) { return x * 8; }
+inline int f6614_9(int x) { return x * 9; }
+inline int f6614_10(int x) { return x * 10; }
+inline int f6614_11(int x) { return x * 11; }
+inline int f6614_12(int x) { return x * 12; }
+inline int f6614_13(int x) { return x * 13; }
+inline int f6614_14(int x) { return x * 14; }
+inline int f6614_15(int x) { return x * 15; }
+inline int f6614_16(int x) { return x * 16; }
+inline int f6614_17(int x) { return x * 17; }
+inline int f6614_18(int x) { return x * 18; }
+inline int f6614_19(int x) { return x * 19; }
+inline int f6614_20(int x) { return x * 20; }
+inline int f6614_21(int x) { return x * 21; }
+inline int f6614_22(int x) { return x * 22; }
+inline int f6614_23(int x) { return x * 23; }
+inline int f6614_24(int x) { return x * 24; }
+inline int f6614_25(int x) { return x * 25; }
+inline int f6614_26(int x) { return x * 26; }
+inline int f6614_27(int x) { return x * 27; }
+inline int f6614_28(int x) { return x * 28; }
+inline int f6614_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6615 */
+#include <vector>
+#include "h6300.h"
+#include "h7893.h"
+#include "h2763.h"
+#include "h2391.h"
+#include "h9844.h"
+#ifdef X
+#include "h9969.h"
+#endif
+struct S6615 { int a; const char *s = "x//y"; };
+inline int f6615_0(int x) { return x * 0; }
+inline int f6615_1(int x) { return x * 1; }
+inline int f6615_2(int x) { return x * 2; }
+inline int f6615_3(int x) { return x * 3; }
+inline int f6615_4(int x) { return x * 4; }
+inline int f6615_5(int x) { return x * 5; }
+inline int f6615_6(int x) { return x * 6; }
+inline int f6615_7(int x) { return x * 7; }
+inline int f6615_8(int x) { return x * 8; }
+inline int f6615_9(int x) { return x * 9; }
+inline int f6615_10(int x) { return x * 10; }
+inline int f6615_11(int x) { return x * 11; }
+inline int f6615_12(int x) { return x * 12; }
+inline int f6615_13(int x) { return x * 13; }
+inline int f6615_14(int x) { return x * 14; }
+inline int f6615_15(int x) { return x * 15; }
+inline int f6615_16(int x) { return x * 16; }
+inline int f6615_17(int x) { return x * 17; }
+inline int f6615_18(int x) { return x * 18; }
+inline int f6615_19(int x) { return x * 19; }
+inline int f6615_20(int x) { return x * 20; }
+inline int f6615_21(int x) { return x * 21; }
+inline int f6615_22(int x) { return x * 22; }
+inline int f6615_23(int x) { return x * 23; }
+inline int f6615_24(int x) { return x * 24; }
+inline int f6615_25(int x) { return x * 25; }
+inline int f6615_26(int x) { return x * 26; }
+inline int f6615_27(int x) { return x * 27; }
+inline int f6615_28(int x) { return x * 28; }
+inline int f6615_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6616 */
+#include <vector>
+#include "h4174.h"
+#include "h5763.h"
+#include "h9636.h"
+#include "h9581.h"
+#include "h7370.h"
+#ifdef X
+#include "h8620.h"
+#endif
+struct S6616 { int a; const char *s = "x//y"; };
+inline int f6616_0(int x) { return x * 0; }
+inline int f6616_1(int x) { return x * 1; }
+inline int f6616_2(int x) { return x * 2; }
+inline int f6616_3(int x) { return x * 3; }
+inline int f6616_4(int x) { return x * 4; }
+inline int f6616_5(int x) { return x * 5; }
+inline int f6616_6(int x) { return x * 6; }
+inline int f6616_7(int x) { return x * 7; }
+inline int f6616_8(int x) { return x * 8; }
+inline int f6616_9(int x) { return x * 9; }
+inline int f6616_10(int x) { return x * 10; }
+inline int f6616_11(int x) { return x * 11; }
+inline int f6616_12(int x) { return x * 12; }
+inline int f6616_13(int x) { return x * 13; }
+inline int f6616_14(int x) { return x * 14; }
+inline int f6616_15(int x) { return x * 15; }
+inline int f6616_16(int x) { return x * 16; }
+inline int f6616_17(int x) { return x * 17; }
+inline int f6616_18(int x) { return x * 18; }
+inline int f6616_19(int x) { return x * 19; }
+inline int f6616_20(int x) { return x * 20; }
+inline int f6616_21(int x) { return x * 21; }
+inline int f6616_22(int x) { return x * 22; }
+inline int f6616_23(int x) { return x * 23; }
+inline int f6616_24(int x) { return x * 24; }
+inline int f6616_25(int x) { return x * 25; }
+inline int f6616_26(int x) { return x * 26; }
+inline int f6616_27(int x) { return x * 27; }
+inline int f6616_28(int x) { return x * 28; }
+inline int f6616_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6617 */
+#include <vector>
+#include "h474.h"
+#include "h2337.h"
+#include "h5522.h"
+#include "h4337.h"
+#include "h1599.h"
+#ifdef X
+#include "h5739.h"
+#endif
+struct S6617 { int a; const char *s = "x//y"; };
+inline int f6617_0(int x) { return x * 0; }
+inline int f6617_1(int x) { return x * 1; }
+inline int f6617_2(int x) { return x * 2; }
+inline int f6617_3(int x) { return x * 3; }
+inline int f6617_4(int x) { return x * 4; }
+inline int f6617_5(int x) { return x * 5; }
+inline int f6617_6(int x) { return x * 6; }
+inline int f6617_7(int x) { return x * 7; }
+inline int f6617_8(int x) { return x * 8; }
+inline int f6617_9(int x) { return x * 9; }
+inline int f6617_10(int x) { return x * 10; }
+inline int f6617_11(int x) { return x * 11; }
+inline int f6617_12(int x) { return x * 12; }
+inline int f6617_13(int x) { return x * 13; }
+inline int f6617_14(int x) { return x * 14; }
+inline int f6617_15(int x) { return x * 15; }
+inline int f6617_16(int x) { return x * 16; }
+inline int f6617_17(int x) { return x * 17; }
+inline int f6617_18(int x) { return x * 18; }
+inline int f6617_19(int x) { return x * 19; }
+inline int f6617_20(int x) { return x * 20; }
+inline int f6617_21(int x) { return x * 21; }
+inline int f6617_22(int x) { return x * 22; }
+inline int f6617_23(int x) { return x * 23; }
+inline int f6617_24(int x) { return x * 24; }
+inline int f6617_25(int x) { return x * 25; }
+inline int f6617_26(int x) { return x * 26; }
+inline int f6617_27(int x) { return x * 27; }
+inline int f6617_28(int x) { return x * 28; }
+inline int f6617_29(int x) { return x * 29; }
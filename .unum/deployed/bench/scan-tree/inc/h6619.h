@@ -0,0 +1,42 @@
+#pragma once
+/* header 6619 */
+#include <vector>
+#include "h2185.h"
+#include "h3494.h"
+#include "h7043.h"
+#include "h389.h"
+#include "h4769.h"
+#ifdef X
+#include "h9187.h"
+#endif
+struct S6619 { int a; const char *s = "x//y"; };
+inline int f6619_0(int x) { return x * 0; }
+inline int f6619_1(int x) { return x * 1; }
+inline int f6619_2(int x) { return x * 2; }
+inline int f6619_3(int x) { return x * 3; }
+inline int f6619_4(int x) { return x * 4; }
+inline int f6619_5(int x) { return x * 5; }
+inline int f6619_6(int x) { return x * 6; }
+inline int f6619_7(int x) { return x * 7; }
+inline int f6619_8(int x) { return x * 8; }
+inline int f6619_9(int x) { return x * 9; }
+inline int f6619_10(int x) { return x * 10; }
+inline int f6619_11(int x) { return x * 11; }
+inline int f6619_12(int x) { return x * 12; }
+inline int f6619_13(int x) { return x * 13; }
+inline int f6619_14(int x) { return x * 14; }
+inline int f6619_15(int x) { return x * 15; }
+inline int f6619_16(int x) { return x * 16; }
+inline int f6619_17(int x) { return x * 17; }
+inline int f6619_18(int x) { return x * 18; }
+inline int f6619_19(int x) { return x * 19; }
+inline int f6619_20(int x) { return x * 20; }
+inline int f6619_21(int x) { return x * 21; }
+inline int f6619_22(int x) { return x * 22; }
+inline int f6619_23(int x) { return x * 23; }
+inline int f6619_24(int x) { return x * 24; }
+inline int f6619_25(int x) { return x * 25; }
+inline int f6619_26(int x) { return x * 26; }
+inline int f6619_27(int x) { return x * 27; }
+inline int f6619_28(int x) { return x * 28; }
+inline int f6619_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 662 */
+#include <vector>
+#include "h2834.h"
+#include "h384.h"
+#include "h3942.h"
+#include "h3081.h"
+#include "h2724.h"
+#ifdef X
+#include "h7423.h"
+#endif
+struct S662 { int a; const char *s = "x//y"; };
+inline int f662_0(int x) { return x * 0; }
+inline int f662_1(int x) { return x * 1; }
+inline int f662_2(int x) { return x * 2; }
+inline int f662_3(int x) { return x * 3; }
+inline int f662_4(int x) { return x * 4; }
+inline int f662_5(int x) { return x * 5; }
+inline int f662_6(int x) { return x * 6; }
+inline int f662_7(int x) { return x * 7; }
+inline int f662_8(int x) { return x * 8; }
+inline int f662_9(int x) { return x * 9; }
+inline int f662_10(int x) { return x * 10; }
+inline int f662_11(int x) { return x * 11; }
+inline int f662_12(int x) { return x * 12; }
+inline int f662_13(int x) { return x * 13; }
+inline int f662_14(int x) { return x * 14; }
+inline int f662_15(int x) { return x * 15; }
+inline int f662_16(int x) { return x * 16; }
+inline int f662_17(int x) { return x * 17; }
+inline int f662_18(int x) { return x * 18; }
+inline int f662_19(int x) { return x * 19; }
+inline int f662_20(int x) { return x * 20; }
+inline int f662_21(int x) { return x * 21; }
+inline int f662_22(int x) { return x * 22; }
+inline int f662_23(int x) { return x * 23; }
+inline int f662_24(int x) { return x * 24; }
+inline int f662_25(int x) { return x * 25; }
+inline int f662_26(int x) { return x * 26; }
+inline int f662_27(int x) { return x * 27; }
+inline int f662_28(int x) { return x * 28; }
+inline int f662_29(int x) { return x * 29; }
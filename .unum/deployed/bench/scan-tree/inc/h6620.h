@@ -0,0 +1,42 @@
+#pragma once
+/* header 6620 */
+#include <vector>
+#include "h9009.h"
+#include "h3200.h"
+#include "h1346.h"
+#include "h6118.h"
+#include "h8514.h"
+#ifdef X
+#include "h1250.h"
+#endif
+struct S6620 { int a; const char *s = "x//y"; };
+inline int f6620_0(int x) { return x * 0; }
+inline int f6620_1(int x) { return x * 1; }
+inline int f6620_2(int x) { return x * 2; }
+inline int f6620_3(int x) { return x * 3; }
+inline int f6620_4(int x) { return x * 4; }
+inline int f6620_5(int x) { return x * 5; }
+inline int f6620_6(int x) { return x * 6; }
+inline int f6620_7(int x) { return x * 7; }
+inline int f6620_8(int x) { return x * 8; }
+inline int f6620_9(int x) { return x * 9; }
+inline int f6620_10(int x) { return x * 10; }
+inline int f6620_11(int x) { return x * 11; }
+inline int f6620_12(int x) { return x * 12; }
+inline int f6620_13(int x) { return x * 13; }
+inline int f6620_14(int x) { return x * 14; }
+inline int f6620_15(int x) { return x * 15; }
+inline int f6620_16(int x) { return x * 16; }
+inline int f6620_17(int x) { return x * 17; }
+inline int f6620_18(int x) { return x * 18; }
+inline int f6620_19(int x) { return x * 19; }
+inline int f6620_20(int x) { return x * 20; }
+inline int f6620_21(int x) { return x * 21; }
+inline int f6620_22(int x) { return x * 22; }
+inline int f6620_23(int x) { return x * 23; }
+inline int f6620_24(int x) { return x * 24; }
+inline int f6620_25(int x) { return x * 25; }
+inline int f6620_26(int x) { return x * 26; }
+inline int f6620_27(int x) { return x * 27; }
+inline int f6620_28(int x) { return x * 28; }
+inline int f6620_29(int x) { return x * 29; }
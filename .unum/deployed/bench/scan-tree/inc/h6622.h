@@ -0,0 +1,42 @@
+#pragma once
+/* header 6622 */
+#include <vector>
+#include "h2052.h"
+#include "h1829.h"
+#include "h8916.h"
+#include "h8838.h"
+#include "h3148.h"
+#ifdef X
+#include "h6946.h"
+#endif
+struct S6622 { int a; const char *s = "x//y"; };
+inline int f6622_0(int x) { return x * 0; }
+inline int f6622_1(int x) { return x * 1; }
+inline int f6622_2(int x) { return x * 2; }
+inline int f6622_3(int x) { return x * 3; }
+inline int f6622_4(int x) { return x * 4; }
+inline int f6622_5(int x) { return x * 5; }
+inline int f6622_6(int x) { return x * 6; }
+inline int f6622_7(int x) { return x * 7; }
+inline int f6622_8(int x) { return x * 8; }
+inline int f6622_9(int x) { return x * 9; }
+inline int f6622_10(int x) { return x * 10; }
+inline int f6622_11(int x) { return x * 11; }
+inline int f6622_12(int x) { return x * 12; }
+inline int f6622_13(int x) { return x * 13; }
+inline int f6622_14(int x) { return x * 14; }
+inline int f6622_15(int x) { return x * 15; }
+inline int f6622_16(int x) { return x * 16; }
+inline int f6622_17(int x) { return x * 17; }
+inline int f6622_18(int x) { return x * 18; }
+inline int f6622_19(int x) { return x * 19; }
+inline int f6622_20(int x) { return x * 20; }
+inline int f6622_21(int x) { return x * 21; }
+inline int f6622_22(int x) { return x * 22; }
+inline int f6622_23(int x) { return x * 23; }
+inline int f6622_24(int x) { return x * 24; }
+inline int f6622_25(int x) { return x * 25; }
+inline int f6622_26(int x) { return x * 26; }
+inline int f6622_27(int x) { return x * 27; }
+inline int f6622_28(int x) { return x * 28; }
+inline int f6622_29(int x) { return x * 29; }
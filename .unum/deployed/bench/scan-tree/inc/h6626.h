@@ -0,0 +1,42 @@
+#pragma once
+/* header 6626 */
+#include <vector>
+#include "h7841.h"
+#include "h3229.h"
+#include "h4486.h"
+#include "h7116.h"
+#include "h8715.h"
+#ifdef X
+#include "h5730.h"
+#endif
+struct S6626 { int a; const char *s = "x//y"; };
+inline int f6626_0(int x) { return x * 0; }
+inline int f6626_1(int x) { return x * 1; }
+inline int f6626_2(int x) { return x * 2; }
+inline int f6626_3(int x) { return x * 3; }
+inline int f6626_4(int x) { return x * 4; }
+inline int f6626_5(int x) { return x * 5; }
+inline int f6626_6(int x) { return x * 6; }
+inline int f6626_7(int x) { return x * 7; }
+inline int f6626_8(int x) { return x * 8; }
+inline int f6626_9(int x) { return x * 9; }
+inline int f6626_10(int x) { return x * 10; }
+inline int f6626_11(int x) { return x * 11; }
+inline int f6626_12(int x) { return x * 12; }
+inline int f6626_13(int x) { return x * 13; }
+inline int f6626_14(int x) { return x * 14; }
+inline int f6626_15(int x) { return x * 15; }
+inline int f6626_16(int x) { return x * 16; }
+inline int f6626_17(int x) { return x * 17; }
+inline int f6626_18(int x) { return x * 18; }
+inline int f6626_19(int x) { return x * 19; }
+inline int f6626_20(int x) { return x * 20; }
+inline int f6626_21(int x) { return x * 21; }
+inline int f6626_22(int x) { return x * 22; }
+inline int f6626_23(int x) { return x * 23; }
+inline int f6626_24(int x) { return x * 24; }
+inline int f6626_25(int x) { return x * 25; }
+inline int f6626_26(int x) { return x * 26; }
+inline int f6626_27(int x) { return x * 27; }
+inline int f6626_28(int x) { return x * 28; }
+inline int f6626_29(int x) { return x * 29; }
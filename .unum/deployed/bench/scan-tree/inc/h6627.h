@@ -0,0 +1,42 @@
+#pragma once
+/* header 6627 */
+#include <vector>
+#include "h3068.h"
+#include "h2121.h"
+#include "h1756.h"
+#include "h8615.h"
+#include "h9436.h"
+#ifdef X
+#include "h6660.h"
+#endif
+struct S6627 { int a; const char *s = "x//y"; };
+inline int f6627_0(int x) { return x * 0; }
+inline int f6627_1(int x) { return x * 1; }
+inline int f6627_2(int x) { return x * 2; }
+inline int f6627_3(int x) { return x * 3; }
+inline int f6627_4(int x) { return x * 4; }
+inline int f6627_5(int x) { return x * 5; }
+inline int f6627_6(int x) { return x * 6; }
+inline int f6627_7(int x) { return x * 7; }
+inline int f6627_8(int x) { return x * 8; }
+inline int f6627_9(int x) { return x * 9; }
+inline int f6627_10(int x) { return x * 10; }
+inline int f6627_11(int x) { return x * 11; }
+inline int f6627_12(int x) { return x * 12; }
+inline int f6627_13(int x) { return x * 13; }
+inline int f6627_14(int x) { return x * 14; }
+inline int f6627_15(int x) { return x * 15; }
+inline int f6627_16(int x) { return x * 16; }
+inline int f6627_17(int x) { return x * 17; }
+inline int f6627_18(int x) { return x * 18; }
+inline int f6627_19(int x) { return x * 19; }
+inline int f6627_20(int x) { return x * 20; }
+inline int f6627_21(int x) { return x * 21; }
+inline int f6627_22(int x) { return x * 22; }
+inline int f6627_23(int x) { return x * 23; }
+inline int f6627_24(int x) { return x * 24; }
+inline int f6627_25(int x) { return x * 25; }
+inline int f6627_26(int x) { return x * 26; }
+inline int f6627_27(int x) { return x * 27; }
+inline int f6627_28(int x) { return x * 28; }
+inline int f6627_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 663 */
+#include <vector>
+#include "h5454.h"
+#include "h5768.h"
+#include "h1269.h"
+#include "h3092.h"
+#include "h5533.h"
+#ifdef X
+#include "h6158.h"
+#endif
+struct S663 { int a; const char *s = "x//y"; };
+inline int f663_0(int x) { return x * 0; }
+inline int f663_1(int x) { return x * 1; }
+inline int f663_2(int x) { return x * 2; }
+inline int f663_3(int x) { return x * 3; }
+inline int f663_4(int x) { return x * 4; }
+inline int f663_5(int x) { return x * 5; }
+inline int f663_6(int x) { return x * 6; }
+inline int f663_7(int x) { return x * 7; }
+inline int f663_8(int x) { return x * 8; }
+inline int f663_9(int x) { return x * 9; }
+inline int f663_10(int x) { return x * 10; }
+inline int f663_11(int x) { return x * 11; }
+inline int f663_12(int x) { return x * 12; }
+inline int f663_13(int x) { return x * 13; }
+inline int f663_14(int x) { return x * 14; }
+inline int f663_15(int x) { return x * 15; }
+inline int f663_16(int x) { return x * 16; }
+inline int f663_17(int x) { return x * 17; }
+inline int f663_18(int x) { return x * 18; }
+inline int f663_19(int x) { return x * 19; }
+inline int f663_20(int x) { return x * 20; }
+inline int f663_21(int x) { return x * 21; }
+inline int f663_22(int x) { return x * 22; }
+inline int f663_23(int x) { return x * 23; }
+inline int f663_24(int x) { return x * 24; }
+inline int f663_25(int x) { return x * 25; }
+inline int f663_26(int x) { return x * 26; }
+inline int f663_27(int x) { return x * 27; }
+inline int f663_28(int x) { return x * 28; }
+inline int f663_29(int x) { return x * 29; }
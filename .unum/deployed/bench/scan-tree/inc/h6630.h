@@ -0,0 +1,42 @@
+#pragma once
+/* header 6630 */
+#include <vector>
+#include "h2509.h"
+#include "h6324.h"
+#include "h1251.h"
+#include "h2604.h"
+#include "h2506.h"
+#ifdef X
+#include "h2996.h"
+#endif
+struct S6630 { int a; const char *s = "x//y"; };
+inline int f6630_0(int x) { return x * 0; }
+inline int f6630_1(int x) { return x * 1; }
+inline int f6630_2(int x) { return x * 2; }
+inline int f6630_3(int x) { return x * 3; }
+inline int f6630_4(int x) { return x * 4; }
+inline int f6630_5(int x) { return x * 5; }
+inline int f6630_6(int x) { return x * 6; }
+inline int f6630_7(int x) { return x * 7; }
+inline int f6630_8(int x) { return x * 8; }
+inline int f6630_9(int x) { return x * 9; }
+inline int f6630_10(int x) { return x * 10; }
+inline int f6630_11(int x) { return x * 11; }
+inline int f6630_12(int x) { return x * 12; }
+inline int f6630_13(int x) { return x * 13; }
+inline int f6630_14(int x) { return x * 14; }
+inline int f6630_15(int x) { return x * 15; }
+inline int f6630_16(int x) { return x * 16; }
+inline int f6630_17(int x) { return x * 17; }
+inline int f6630_18(int x) { return x * 18; }
+inline int f6630_19(int x) { return x * 19; }
+inline int f6630_20(int x) { return x * 20; }
+inline int f6630_21(int x) { return x * 21; }
+inline int f6630_22(int x) { return x * 22; }
+inline int f6630_23(int x) { return x * 23; }
+inline int f6630_24(int x) { return x * 24; }
+inline int f6630_25(int x) { return x * 25; }
+inline int f6630_26(int x) { return x * 26; }
+inline int f6630_27(int x) { return x * 27; }
+inline int f6630_28(int x) { return x * 28; }
+inline int f6630_29(int x) { return x * 29; }
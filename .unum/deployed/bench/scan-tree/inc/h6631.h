@@ -0,0 +1,42 @@
+#pragma once
+/* header 6631 */
+#include <vector>
+#include "h8428.h"
+#include "h7828.h"
+#include "h410.h"
+#include "h3290.h"
+#include "h5702.h"
+#ifdef X
+#include "h3203.h"
+#endif
+struct S6631 { int a; const char *s = "x//y"; };
+inline int f6631_0(int x) { return x * 0; }
+inline int f6631_1(int x) { return x * 1; }
+inline int f6631_2(int x) { return x * 2; }
+inline int f6631_3(int x) { return x * 3; }
+inline int f6631_4(int x) { return x * 4; }
+inline int f6631_5(int x) { return x * 5; }
+inline int f6631_6(int x) { return x * 6; }
+inline int f6631_7(int x) { return x * 7; }
+inline int f6631_8(int x) { return x * 8; }
+inline int f6631_9(int x) { return x * 9; }
+inline int f6631_10(int x) { return x * 10; }
+inline int f6631_11(int x) { return x * 11; }
+inline int f6631_12(int x) { return x * 12; }
+inline int f6631_13(int x) { return x * 13; }
+inline int f6631_14(int x) { return x * 14; }
+inline int f6631_15(int x) { return x * 15; }
+inline int f6631_16(int x) { return x * 16; }
+inline int f6631_17(int x) { return x * 17; }
+inline int f6631_18(int x) { return x * 18; }
+inline int f6631_19(int x) { return x * 19; }
+inline int f6631_20(int x) { return x * 20; }
+inline int f6631_21(int x) { return x * 21; }
+inline int f6631_22(int x) { return x * 22; }
+inline int f6631_23(int x) { return x * 23; }
+inline int f6631_24(int x) { return x * 24; }
+inline int f6631_25(int x) { return x * 25; }
+inline int f6631_26(int x) { return x * 26; }
+inline int f6631_27(int x) { return x * 27; }
+inline int f6631_28(int x) { return x * 28; }
+inline int f6631_29(int x) { return x * 29; }
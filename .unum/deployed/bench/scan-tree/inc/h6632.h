@@ -0,0 +1,42 @@
+#pragma once
+/* header 6632 */
+#include <vector>
+#include "h7650.h"
+#include "h3072.h"
+#include "h9925.h"
+#include "h814.h"
+#include "h7167.h"
+#ifdef X
+#include "h8000.h"
+#endif
+struct S6632 { int a; const char *s = "x//y"; };
+inline int f6632_0(int x) { return x * 0; }
+inline int f6632_1(int x) { return x * 1; }
+inline int f6632_2(int x) { return x * 2; }
+inline int f6632_3(int x) { return x * 3; }
+inline int f6632_4(int x) { return x * 4; }
+inline int f6632_5(int x) { return x * 5; }
+inline int f6632_6(int x) { return x * 6; }
+inline int f6632_7(int x) { return x * 7; }
+inline int f6632_8(int x) { return x * 8; }
+inline int f6632_9(int x) { return x * 9; }
+inline int f6632_10(int x) { return x * 10; }
+inline int f6632_11(int x) { return x * 11; }
+inline int f6632_12(int x) { return x * 12; }
+inline int f6632_13(int x) { return x * 13; }
+inline int f6632_14(int x) { return x * 14; }
+inline int f6632_15(int x) { return x * 15; }
+inline int f6632_16(int x) { return x * 16; }
+inline int f6632_17(int x) { return x * 17; }
+inline int f6632_18(int x) { return x * 18; }
+inline int f6632_19(int x) { return x * 19; }
+inline int f6632_20(int x) { return x * 20; }
+inline int f6632_21(int x) { return x * 21; }
+inline int f6632_22(int x) { return x * 22; }
+inline int f6632_23(int x) { return x * 23; }
+inline int f6632_24(int x) { return x * 24; }
+inline int f6632_25(int x) { return x * 25; }
+inline int f6632_26(int x) { return x * 26; }
+inline int f6632_27(int x) { return x * 27; }
+inline int f6632_28(int x) { return x * 28; }
+inline int f6632_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6633 */
+#include <vector>
+#include "h7363.h"
+#include "h1432.h"
+#include "h6978.h"
+#include "h9730.h"
+#include "h3062.h"
+#ifdef X
+#include "h3244.h"
+#endif
+struct S6633 { int a; const char *s = "x//y"; };
+inline int f6633_0(int x) { return x * 0; }
+inline int f6633_1(int x) { return x * 1; }
+inline int f6633_2(int x) { return x * 2; }
+inline int f6633_3(int x) { return x * 3; }
+inline int f6633_4(int x) { return x * 4; }
+inline int f6633_5(int x) { return x * 5; }
+inline int f6633_6(int x) { return x * 6; }
+inline int f6633_7(int x) { return x * 7; }
+inline int f6633_8(int x) { return x * 8; }
+inline int f6633_9(int x) { return x * 9; }
+inline int f6633_10(int x) { return x * 10; }
+inline int f6633_11(int x) { return x * 11; }
+inline int f6633_12(int x) { return x * 12; }
+inline int f6633_13(int x) { return x * 13; }
+inline int f6633_14(int x) { return x * 14; }
+inline int f6633_15(int x) { return x * 15; }
+inline int f6633_16(int x) { return x * 16; }
+inline int f6633_17(int x) { return x * 17; }
+inline int f6633_18(int x) { return x * 18; }
+inline int f6633_19(int x) { return x * 19; }
+inline int f6633_20(int x) { return x * 20; }
+inline int f6633_21(int x) { return x * 21; }
+inline int f6633_22(int x) { return x * 22; }
+inline int f6633_23(int x) { return x * 23; }
+inline int f6633_24(int x) { return x * 24; }
+inline int f6633_25(int x) { return x * 25; }
+inline int f6633_26(int x) { return x * 26; }
+inline int f6633_27(int x) { return x * 27; }
+inline int f6633_28(int x) { return x * 28; }
+inline int f6633_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6634 */
+#include <vector>
+#include "h4709.h"
+#include "h8422.h"
+#include "h8497.h"
+#include "h1411.h"
+#include "h4480.h"
+#ifdef X
+#include "h21.h"
+#endif
+struct S6634 { int a; const char *s = "x//y"; };
+inline int f6634_0(int x) { return x * 0; }
+inline int f6634_1(int x) { return x * 1; }
+inline int f6634_2(int x) { return x * 2; }
+inline int f6634_3(int x) { return x * 3; }
+inline int f6634_4(int x) { return x * 4; }
+inline int f6634_5(int x) { return x * 5; }
+inline int f6634_6(int x) { return x * 6; }
+inline int f6634_7(int x) { return x * 7; }
+inline int f6634_8(int x) { return x * 8; }
+inline int f6634_9(int x) { return x * 9; }
+inline int f6634_10(int x) { return x * 10; }
+inline int f6634_11(int x) { return x * 11; }
+inline int f6634_12(int x) { return x * 12; }
+inline int f6634_13(int x) { return x * 13; }
+inline int f6634_14(int x) { return x * 14; }
+inline int f6634_15(int x) { return x * 15; }
+inline int f6634_16(int x) { return x * 16; }
+inline int f6634_17(int x) { return x * 17; }
+inline int f6634_18(int x) { return x * 18; }
+inline int f6634_19(int x) { return x * 19; }
+inline int f6634_20(int x) { return x * 20; }
+inline int f6634_21(int x) { return x * 21; }
+inline int f6634_22(int x) { return x * 22; }
+inline int f6634_23(int x) { return x * 23; }
+inline int f6634_24(int x) { return x * 24; }
+inline int f6634_25(int x) { return x * 25; }
+inline int f6634_26(int x) { return x * 26; }
+inline int f6634_27(int x) { return x * 27; }
+inline int f6634_28(int x) { return x * 28; }
+inline int f6634_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6637 */
+#include <vector>
+#include "h8267.h"
+#include "h8051.h"
+#include "h1868.h"
+#include "h3537.h"
+#include "h8883.h"
+#ifdef X
+#include "h9517.h"
+#endif
+struct S6637 { int a; const char *s = "x//y"; };
+inline int f6637_0(int x) { return x * 0; }
+inline int f6637_1(int x) { return x * 1; }
+inline int f6637_2(int x) { return x * 2; }
+inline int f6637_3(int x) { return x * 3; }
+inline int f6637_4(int x) { return x * 4; }
+inline int f6637_5(int x) { return x * 5; }
+inline int f6637_6(int x) { return x * 6; }
+inline int f6637_7(int x) { return x * 7; }
+inline int f6637_8(int x) { return x * 8; }
+inline int f6637_9(int x) { return x * 9; }
+inline int f6637_10(int x) { return x * 10; }
+inline int f6637_11(int x) { return x * 11; }
+inline int f6637_12(int x) { return x * 12; }
+inline int f6637_13(int x) { return x * 13; }
+inline int f6637_14(int x) { return x * 14; }
+inline int f6637_15(int x) { return x * 15; }
+inline int f6637_16(int x) { return x * 16; }
+inline int f6637_17(int x) { return x * 17; }
+inline int f6637_18(int x) { return x * 18; }
+inline int f6637_19(int x) { return x * 19; }
+inline int f6637_20(int x) { return x * 20; }
+inline int f6637_21(int x) { return x * 21; }
+inline int f6637_22(int x) { return x * 22; }
+inline int f6637_23(int x) { return x * 23; }
+inline int f6637_24(int x) { return x * 24; }
+inline int f6637_25(int x) { return x * 25; }
+inline int f6637_26(int x) { return x * 26; }
+inline int f6637_27(int x) { return x * 27; }
+inline int f6637_28(int x) { return x * 28; }
+inline int f6637_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6638 */
+#include <vector>
+#include "h8767.h"
+#include "h9045.h"
+#include "h5063.h"
+#include "h6895.h"
+#include "h7340.h"
+#ifdef X
+#include "h6832.h"
+#endif
+struct S6638 { int a; const char *s = "x//y"; };
+inline int f6638_0(int x) { return x * 0; }
+inline int f6638_1(int x) { return x * 1; }
+inline int f6638_2(int x) { return x * 2; }
+inline int f6638_3(int x) { return x * 3; }
+inline int f6638_4(int x) { return x * 4; }
+inline int f6638_5(int x) { return x * 5; }
+inline int f6638_6(int x) { return x * 6; }
+inline int f6638_7(int x) { return x * 7; }
+inline int f6638_8(int x) { return x * 8; }
+inline int f6638_9(int x) { return x * 9; }
+inline int f6638_10(int x) { return x * 10; }
+inline int f6638_11(int x) { return x * 11; }
+inline int f6638_12(int x) { return x * 12; }
+inline int f6638_13(int x) { return x * 13; }
+inline int f6638_14(int x) { return x * 14; }
+inline int f6638_15(int x) { return x * 15; }
+inline int f6638_16(int x) { return x * 16; }
+inline int f6638_17(int x) { return x * 17; }
+inline int f6638_18(int x) { return x * 18; }
+inline int f6638_19(int x) { return x * 19; }
+inline int f6638_20(int x) { return x * 20; }
+inline int f6638_21(int x) { return x * 21; }
+inline int f6638_22(int x) { return x * 22; }
+inline int f6638_23(int x) { return x * 23; }
+inline int f6638_24(int x) { return x * 24; }
+inline int f6638_25(int x) { return x * 25; }
+inline int f6638_26(int x) { return x * 26; }
+inline int f6638_27(int x) { return x * 27; }
+inline int f6638_28(int x) { return x * 28; }
+inline int f6638_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6640 */
+#include <vector>
+#include "h7400.h"
+#include "h2539.h"
+#include "h3852.h"
+#include "h7639.h"
+#include "h7594.h"
+#ifdef X
+#include "h884.h"
+#endif
+struct S6640 { int a; const char *s = "x//y"; };
+inline int f6640_0(int x) { return x * 0; }
+inline int f6640_1(int x) { return x * 1; }
+inline int f6640_2(int x) { return x * 2; }
+inline int f6640_3(int x) { return x * 3; }
+inline int f6640_4(int x) { return x * 4; }
+inline int f6640_5(int x) { return x * 5; }
+inline int f6640_6(int x) { return x * 6; }
+inline int f6640_7(int x) { return x * 7; }
+inline int f6640_8(int x) { return x * 8; }
+inline int f6640_9(int x) { return x * 9; }
+inline int f6640_10(int x) { return x * 10; }
+inline int f6640_11(int x) { return x * 11; }
+inline int f6640_12(int x) { return x * 12; }
+inline int f6640_13(int x) { return x * 13; }
+inline int f6640_14(int x) { return x * 14; }
+inline int f6640_15(int x) { return x * 15; }
+inline int f6640_16(int x) { return x * 16; }
+inline int f6640_17(int x) { return x * 17; }
+inline int f6640_18(int x) { return x * 18; }
+inline int f6640_19(int x) { return x * 19; }
+inline int f6640_20(int x) { return x * 20; }
+inline int f6640_21(int x) { return x * 21; }
+inline int f6640_22(int x) { return x * 22; }
+inline int f6640_23(int x) { return x * 23; }
+inline int f6640_24(int x) { return x * 24; }
+inline int f6640_25(int x) { return x * 25; }
+inline int f6640_26(int x) { return x * 26; }
+inline int f6640_27(int x) { return x * 27; }
+inline int f6640_28(int x) { return x * 28; }
+inline int f6640_29(int x) { return x * 29; }
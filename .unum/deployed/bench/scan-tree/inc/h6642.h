@@ -0,0 +1,42 @@
+#pragma once
+/* header 6642 */
+#include <vector>
+#include "h1320.h"
+#include "h1178.h"
+#include "h8975.h"
+#include "h9507.h"
+#include "h8620.h"
+#ifdef X
+#include "h5717.h"
+#endif
+struct S6642 { int a; const char *s = "x//y"; };
+inline int f6642_0(int x) { return x * 0; }
+inline int f6642_1(int x) { return x * 1; }
+inline int f6642_2(int x) { return x * 2; }
+inline int f6642_3(int x) { return x * 3; }
+inline int f6642_4(int x) { return x * 4; }
+inline int f6642_5(int x) { return x * 5; }
+inline int f6642_6(int x) { return x * 6; }
+inline int f6642_7(int x) { return x * 7; }
+inline int f6642_8(int x) { return x * 8; }
+inline int f6642_9(int x) { return x * 9; }
+inline int f6642_10(int x) { return x * 10; }
+inline int f6642_11(int x) { return x * 11; }
+inline int f6642_12(int x) { return x * 12; }
+inline int f6642_13(int x) { return x * 13; }
+inline int f6642_14(int x) { return x * 14; }
+inline int f6642_15(int x) { return x * 15; }
+inline int f6642_16(int x) { return x * 16; }
+inline int f6642_17(int x) { return x * 17; }
+inline int f6642_18(int x) { return x * 18; }
+inline int f6642_19(int x) { return x * 19; }
+inline int f6642_20(int x) { return x * 20; }
+inline int f6642_21(int x) { return x * 21; }
+inline int f6642_22(int x) { return x * 22; }
+inline int f6642_23(int x) { return x * 23; }
+inline int f6642_24(int x) { return x * 24; }
+inline int f6642_25(int x) { return x * 25; }
+inline int f6642_26(int x) { return x * 26; }
+inline int f6642_27(int x) { return x * 27; }
+inline int f6642_28(int x) { return x * 28; }
+inline int f6642_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6645 */
+#include <vector>
+#include "h4232.h"
+#include "h9736.h"
+#include "h2989.h"
+#include "h2746.h"
+#include "h9558.h"
+#ifdef X
+#include "h8929.h"
+#endif
+struct S6645 { int a; const char *s = "x//y"; };
+inline int f6645_0(int x) { return x * 0; }
+inline int f6645_1(int x) { return x * 1; }
+inline int f6645_2(int x) { return x * 2; }
+inline int f6645_3(int x) { return x * 3; }
+inline int f6645_4(int x) { return x * 4; }
+inline int f6645_5(int x) { return x * 5; }
+inline int f6645_6(int x) { return x * 6; }
+inline int f6645_7(int x) { return x * 7; }
+inline int f6645_8(int x) { return x * 8; }
+inline int f6645_9(int x) { return x * 9; }
+inline int f6645_10(int x) { return x * 10; }
+inline int f6645_11(int x) { return x * 11; }
+inline int f6645_12(int x) { return x * 12; }
+inline int f6645_13(int x) { return x * 13; }
+inline int f6645_14(int x) { return x * 14; }
+inline int f6645_15(int x) { return x * 15; }
+inline int f6645_16(int x) { return x * 16; }
+inline int f6645_17(int x) { return x * 17; }
+inline int f6645_18(int x) { return x * 18; }
+inline int f6645_19(int x) { return x * 19; }
+inline int f6645_20(int x) { return x * 20; }
+inline int f6645_21(int x) { return x * 21; }
+inline int f6645_22(int x) { return x * 22; }
+inline int f6645_23(int x) { return x * 23; }
+inline int f6645_24(int x) { return x * 24; }
+inline int f6645_25(int x) { return x * 25; }
+inline int f6645_26(int x) { return x * 26; }
+inline int f6645_27(int x) { return x * 27; }
+inline int f6645_28(int x) { return x * 28; }
+inline int f6645_29(int x) { return x * 29; }
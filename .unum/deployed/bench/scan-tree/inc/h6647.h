@@ -0,0 +1,42 @@
+#pragma once
+/* header 6647 */
+#include <vector>
+#include "h3951.h"
+#include "h7637.h"
+#include "h3590.h"
+#include "h3760.h"
+#include "h8687.h"
+#ifdef X
+#include "h6485.h"
+#endif
+struct S6647 { int a; const char *s = "x//y"; };
+inline int f6647_0(int x) { return x * 0; }
+inline int f6647_1(int x) { return x * 1; }
+inline int f6647_2(int x) { return x * 2; }
+inline int f6647_3(int x) { return x * 3; }
+inline int f6647_4(int x) { return x * 4; }
+inline int f6647_5(int x) { return x * 5; }
+inline int f6647_6(int x) { return x * 6; }
+inline int f6647_7(int x) { return x * 7; }
+inline int f6647_8(int x) { return x * 8; }
+inline int f6647_9(int x) { return x * 9; }
+inline int f6647_10(int x) { return x * 10; }
+inline int f6647_11(int x) { return x * 11; }
+inline int f6647_12(int x) { return x * 12; }
+inline int f6647_13(int x) { return x * 13; }
+inline int f6647_14(int x) { return x * 14; }
+inline int f6647_15(int x) { return x * 15; }
+inline int f6647_16(int x) { return x * 16; }
+inline int f6647_17(int x) { return x * 17; }
+inline int f6647_18(int x) { return x * 18; }
+inline int f6647_19(int x) { return x * 19; }
+inline int f6647_20(int x) { return x * 20; }
+inline int f6647_21(int x) { return x * 21; }
+inline int f6647_22(int x) { return x * 22; }
+inline int f6647_23(int x) { return x * 23; }
+inline int f6647_24(int x) { return x * 24; }
+inline int f6647_25(int x) { return x * 25; }
+inline int f6647_26(int x) { return x * 26; }
+inline int f6647_27(int x) { return x * 27; }
+inline int f6647_28(int x) { return x * 28; }
+inline int f6647_29(int x) { return x * 29; }
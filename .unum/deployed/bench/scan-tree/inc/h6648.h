@@ -0,0 +1,42 @@
+#pragma once
+/* header 6648 */
+#include <vector>
+#include "h7392.h"
+#include "h8581.h"
+#include "h9798.h"
+#include "h4190.h"
+#include "h4847.h"
+#ifdef X
+#include "h4491.h"
+#endif
+struct S6648 { int a; const char *s = "x//y"; };
+inline int f6648_0(int x) { return x * 0; }
+inline int f6648_1(int x) { return x * 1; }
+inline int f6648_2(int x) { return x * 2; }
+inline int f6648_3(int x) { return x * 3; }
+inline int f6648_4(int x) { return x * 4; }
+inline int f6648_5(int x) { return x * 5; }
+inline int f6648_6(int x) { return x * 6; }
+inline int f6648_7(int x) { return x * 7; }
+inline int f6648_8(int x) { return x * 8; }
+inline int f6648_9(int x) { return x * 9; }
+inline int f6648_10(int x) { return x * 10; }
+inline int f6648_11(int x) { return x * 11; }
+inline int f6648_12(int x) { return x * 12; }
+inline int f6648_13(int x) { return x * 13; }
+inline int f6648_14(int x) { return x * 14; }
+inline int f6648_15(int x) { return x * 15; }
+inline int f6648_16(int x) { return x * 16; }
+inline int f6648_17(int x) { return x * 17; }
+inline int f6648_18(int x) { return x * 18; }
+inline int f6648_19(int x) { return x * 19; }
+inline int f6648_20(int x) { return x * 20; }
+inline int f6648_21(int x) { return x * 21; }
+inline int f6648_22(int x) { return x * 22; }
+inline int f6648_23(int x) { return x * 23; }
+inline int f6648_24(int x) { return x * 24; }
+inline int f6648_25(int x) { return x * 25; }
+inline int f6648_26(int x) { return x * 26; }
+inline int f6648_27(int x) { return x * 27; }
+inline int f6648_28(int x) { return x * 28; }
+inline int f6648_29(int x) { return x * 29; }
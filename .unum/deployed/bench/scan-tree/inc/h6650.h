@@ -0,0 +1,42 @@
+#pragma once
+/* header 6650 */
+#include <vector>
+#include "h2550.h"
+#include "h5325.h"
+#include "h4281.h"
+#include "h5813.h"
+#include "h2243.h"
+#ifdef X
+#include "h6597.h"
+#endif
+struct S6650 { int a; const char *s = "x//y"; };
+inline int f6650_0(int x) { return x * 0; }
+inline int f6650_1(int x) { return x * 1; }
+inline int f6650_2(int x) { return x * 2; }
+inline int f6650_3(int x) { return x * 3; }
+inline int f6650_4(int x) { return x * 4; }
+inline int f6650_5(int x) { return x * 5; }
+inline int f6650_6(int x) { return x * 6; }
+inline int f6650_7(int x) { return x * 7; }
+inline int f6650_8(int x) { return x * 8; }
+inline int f6650_9(int x) { return x * 9; }
+inline int f6650_10(int x) { return x * 10; }
+inline int f6650_11(int x) { return x * 11; }
+inline int f6650_12(int x) { return x * 12; }
+inline int f6650_13(int x) { return x * 13; }
+inline int f6650_14(int x) { return x * 14; }
+inline int f6650_15(int x) { return x * 15; }
+inline int f6650_16(int x) { return x * 16; }
+inline int f6650_17(int x) { return x * 17; }
+inline int f6650_18(int x) { return x * 18; }
+inline int f6650_19(int x) { return x * 19; }
+inline int f6650_20(int x) { return x * 20; }
+inline int f6650_21(int x) { return x * 21; }
+inline int f6650_22(int x) { return x * 22; }
+inline int f6650_23(int x) { return x * 23; }
+inline int f6650_24(int x) { return x * 24; }
+inline int f6650_25(int x) { return x * 25; }
+inline int f6650_26(int x) { return x * 26; }
+inline int f6650_27(int x) { return x * 27; }
+inline int f6650_28(int x) { return x * 28; }
+inline int f6650_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6651 */
+#include <vector>
+#include "h2548.h"
+#include "h7806.h"
+#include "h7425.h"
+#include "h3361.h"
+#include "h466.h"
+#ifdef X
+#include "h3211.h"
+#endif
+struct S6651 { int a; const char *s = "x//y"; };
+inline int f6651_0(int x) { return x * 0; }
+inline int f6651_1(int x) { return x * 1; }
+inline int f6651_2(int x) { return x * 2; }
+inline int f6651_3(int x) { return x * 3; }
+inline int f6651_4(int x) { return x * 4; }
+inline int f6651_5(int x) { return x * 5; }
+inline int f6651_6(int x) { return x * 6; }
+inline int f6651_7(int x) { return x * 7; }
+inline int f6651_8(int x) { return x * 8; }
+inline int f6651_9(int x) { return x * 9; }
+inline int f6651_10(int x) { return x * 10; }
+inline int f6651_11(int x) { return x * 11; }
+inline int f6651_12(int x) { return x * 12; }
+inline int f6651_13(int x) { return x * 13; }
+inline int f6651_14(int x) { return x * 14; }
+inline int f6651_15(int x) { return x * 15; }
+inline int f6651_16(int x) { return x * 16; }
+inline int f6651_17(int x) { return x * 17; }
+inline int f6651_18(int x) { return x * 18; }
+inline int f6651_19(int x) { return x * 19; }
+inline int f6651_20(int x) { return x * 20; }
+inline int f6651_21(int x) { return x * 21; }
+inline int f6651_22(int x) { return x * 22; }
+inline int f6651_23(int x) { return x * 23; }
+inline int f6651_24(int x) { return x * 24; }
+inline int f6651_25(int x) { return x * 25; }
+inline int f6651_26(int x) { return x * 26; }
+inline int f6651_27(int x) { return x * 27; }
+inline int f6651_28(int x) { return x * 28; }
+inline int f6651_29(int x) { return x * 29; }
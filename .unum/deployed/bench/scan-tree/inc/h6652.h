@@ -0,0 +1,42 @@
+#pragma once
+/* header 6652 */
+#include <vector>
+#include "h4838.h"
+#include "h8998.h"
+#include "h2022.h"
+#include "h1711.h"
+#include "h8967.h"
+#ifdef X
+#include "h3182.h"
+#endif
+struct S6652 { int a; const char *s = "x//y"; };
+inline int f6652_0(int x) { return x * 0; }
+inline int f6652_1(int x) { return x * 1; }
+inline int f6652_2(int x) { return x * 2; }
+inline int f6652_3(int x) { return x * 3; }
+inline int f6652_4(int x) { return x * 4; }
+inline int f6652_5(int x) { return x * 5; }
+inline int f6652_6(int x) { return x * 6; }
+inline int f6652_7(int x) { return x * 7; }
+inline int f6652_8(int x) { return x * 8; }
+inline int f6652_9(int x) { return x * 9; }
+inline int f6652_10(int x) { return x * 10; }
+inline int f6652_11(int x) { return x * 11; }
+inline int f6652_12(int x) { return x * 12; }
+inline int f6652_13(int x) { return x * 13; }
+inline int f6652_14(int x) { return x * 14; }
+inline int f6652_15(int x) { return x * 15; }
+inline int f6652_16(int x) { return x * 16; }
+inline int f6652_17(int x) { return x * 17; }
+inline int f6652_18(int x) { return x * 18; }
+inline int f6652_19(int x) { return x * 19; }
+inline int f6652_20(int x) { return x * 20; }
+inline int f6652_21(int x) { return x * 21; }
+inline int f6652_22(int x) { return x * 22; }
+inline int f6652_23(int x) { return x * 23; }
+inline int f6652_24(int x) { return x * 24; }
+inline int f6652_25(int x) { return x * 25; }
+inline int f6652_26(int x) { return x * 26; }
+inline int f6652_27(int x) { return x * 27; }
+inline int f6652_28(int x) { return x * 28; }
+inline int f6652_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6653 */
+#include <vector>
+#include "h1925.h"
+#include "h6797.h"
+#include "h8931.h"
+#include "h1030.h"
+#include "h9645.h"
+#ifdef X
+#include "h7076.h"
+#endif
+struct S6653 { int a; const char *s = "x//y"; };
+inline int f6653_0(int x) { return x * 0; }
+inline int f6653_1(int x) { return x * 1; }
+inline int f6653_2(int x) { return x * 2; }
+inline int f6653_3(int x) { return x * 3; }
+inline int f6653_4(int x) { return x * 4; }
+inline int f6653_5(int x) { return x * 5; }
+inline int f6653_6(int x) { return x * 6; }
+inline int f6653_7(int x) { return x * 7; }
+inline int f6653_8(int x) { return x * 8; }
+inline int f6653_9(int x) { return x * 9; }
+inline int f6653_10(int x) { return x * 10; }
+inline int f6653_11(int x) { return x * 11; }
+inline int f6653_12(int x) { return x * 12; }
+inline int f6653_13(int x) { return x * 13; }
+inline int f6653_14(int x) { return x * 14; }
+inline int f6653_15(int x) { return x * 15; }
+inline int f6653_16(int x) { return x * 16; }
+inline int f6653_17(int x) { return x * 17; }
+inline int f6653_18(int x) { return x * 18; }
+inline int f6653_19(int x) { return x * 19; }
+inline int f6653_20(int x) { return x * 20; }
+inline int f6653_21(int x) { return x * 21; }
+inline int f6653_22(int x) { return x * 22; }
+inline int f6653_23(int x) { return x * 23; }
+inline int f6653_24(int x) { return x * 24; }
+inline int f6653_25(int x) { return x * 25; }
+inline int f6653_26(int x) { return x * 26; }
+inline int f6653_27(int x) { return x * 27; }
+inline int f6653_28(int x) { return x * 28; }
+inline int f6653_29(int x) { return x * 29; }
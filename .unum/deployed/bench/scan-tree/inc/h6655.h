@@ -0,0 +1,42 @@
+#pragma once
+/* header 6655 */
+#include <vector>
+#include "h5108.h"
+#include "h4530.h"
+#include "h5834.h"
+#include "h995.h"
+#include "h9349.h"
+#ifdef X
+#include "h8203.h"
+#endif
+struct S6655 { int a; const char *s = "x//y"; };
+inline int f6655_0(int x) { return x * 0; }
+inline int f6655_1(int x) { return x * 1; }
+inline int f6655_2(int x) { return x * 2; }
+inline int f6655_3(int x) { return x * 3; }
+inline int f6655_4(int x) { return x * 4; }
+inline int f6655_5(int x) { return x * 5; }
+inline int f6655_6(int x) { return x * 6; }
+inline int f6655_7(int x) { return x * 7; }
+inline int f6655_8(int x) { return x * 8; }
+inline int f6655_9(int x) { return x * 9; }
+inline int f6655_10(int x) { return x * 10; }
+inline int f6655_11(int x) { return x * 11; }
+inline int f6655_12(int x) { return x * 12; }
+inline int f6655_13(int x) { return x * 13; }
+inline int f6655_14(int x) { return x * 14; }
+inline int f6655_15(int x) { return x * 15; }
+inline int f6655_16(int x) { return x * 16; }
+inline int f6655_17(int x) { return x * 17; }
+inline int f6655_18(int x) { return x * 18; }
+inline int f6655_19(int x) { return x * 19; }
+inline int f6655_20(int x) { return x * 20; }
+inline int f6655_21(int x) { return x * 21; }
+inline int f6655_22(int x) { return x * 22; }
+inline int f6655_23(int x) { return x * 23; }
+inline int f6655_24(int x) { return x * 24; }
+inline int f6655_25(int x) { return x * 25; }
+inline int f6655_26(int x) { return x * 26; }
+inline int f6655_27(int x) { return x * 27; }
+inline int f6655_28(int x) { return x * 28; }
+inline int f6655_29(int x) { return x * 29; }
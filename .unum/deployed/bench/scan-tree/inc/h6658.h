@@ -0,0 +1,42 @@
+#pragma once
+/* header 6658 */
+#include <vector>
+#include "h6401.h"
+#include "h586.h"
+#include "h2649.h"
+#include "h6081.h"
+#include "h3794.h"
+#ifdef X
+#include "h4612.h"
+#endif
+struct S6658 { int a; const char *s = "x//y"; };
+inline int f6658_0(int x) { return x * 0; }
+inline int f6658_1(int x) { return x * 1; }
+inline int f6658_2(int x) { return x * 2; }
+inline int f6658_3(int x) { return x * 3; }
+inline int f6658_4(int x) { return x * 4; }
+inline int f6658_5(int x) { return x * 5; }
+inline int f6658_6(int x) { return x * 6; }
+inline int f6658_7(int x) { return x * 7; }
+inline int f6658_8(int x) { return x * 8; }
+inline int f6658_9(int x) { return x * 9; }
+inline int f6658_10(int x) { return x * 10; }
+inline int f6658_11(int x) { return x * 11; }
+inline int f6658_12(int x) { return x * 12; }
+inline int f6658_13(int x) { return x * 13; }
+inline int f6658_14(int x) { return x * 14; }
+inline int f6658_15(int x) { return x * 15; }
+inline int f6658_16(int x) { return x * 16; }
+inline int f6658_17(int x) { return x * 17; }
+inline int f6658_18(int x) { return x * 18; }
+inline int f6658_19(int x) { return x * 19; }
+inline int f6658_20(int x) { return x * 20; }
+inline int f6658_21(int x) { return x * 21; }
+inline int f6658_22(int x) { return x * 22; }
+inline int f6658_23(int x) { return x * 23; }
+inline int f6658_24(int x) { return x * 24; }
+inline int f6658_25(int x) { return x * 25; }
+inline int f6658_26(int x) { return x * 26; }
+inline int f6658_27(int x) { return x * 27; }
+inline int f6658_28(int x) { return x * 28; }
+inline int f6658_29(int x) { return x * 29; }
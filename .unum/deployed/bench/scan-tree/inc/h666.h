@@ -0,0 +1,42 @@
+#pragma once
+/* header 666 */
+#include <vector>
+#include "h216.h"
+#include "h5661.h"
+#include "h9164.h"
+#include "h6390.h"
+#include "h7687.h"
+#ifdef X
+#include "h9595.h"
+#endif
+struct S666 { int a; const char *s = "x//y"; };
+inline int f666_0(int x) { return x * 0; }
+inline int f666_1(int x) { return x * 1; }
+inline int f666_2(int x) { return x * 2; }
+inline int f666_3(int x) { return x * 3; }
+inline int f666_4(int x) { return x * 4; }
+inline int f666_5(int x) { return x * 5; }
+inline int f666_6(int x) { return x * 6; }
+inline int f666_7(int x) { return x * 7; }
+inline int f666_8(int x) { return x * 8; }
+inline int f666_9(int x) { return x * 9; }
+inline int f666_10(int x) { return x * 10; }
+inline int f666_11(int x) { return x * 11; }
+inline int f666_12(int x) { return x * 12; }
+inline int f666_13(int x) { return x * 13; }
+inline int f666_14(int x) { return x * 14; }
+inline int f666_15(int x) { return x * 15; }
+inline int f666_16(int x) { return x * 16; }
+inline int f666_17(int x) { return x * 17; }
+inline int f666_18(int x) { return x * 18; }
+inline int f666_19(int x) { return x * 19; }
+inline int f666_20(int x) { return x * 20; }
+inline int f666_21(int x) { return x * 21; }
+inline int f666_22(int x) { return x * 22; }
+inline int f666_23(int x) { return x * 23; }
+inline int f666_24(int x) { return x * 24; }
+inline int f666_25(int x) { return x * 25; }
+inline int f666_26(int x) { return x * 26; }
+inline int f666_27(int x) { return x * 27; }
+inline int f666_28(int x) { return x * 28; }
+inline int f666_29(int x) { return x * 29; }
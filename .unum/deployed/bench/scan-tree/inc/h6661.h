@@ -0,0 +1,42 @@
+#pragma once
+/* header 6661 */
+#include <vector>
+#include "h5160.h"
+#include "h4714.h"
+#include "h8722.h"
+#include "h1101.h"
+#include "h7556.h"
+#ifdef X
+#include "h3816.h"
+#endif
+struct S6661 { int a; const char *s = "x//y"; };
+inline int f6661_0(int x) { return x * 0; }
+inline int f6661_1(int x) { return x * 1; }
+inline int f6661_2(int x) { return x * 2; }
+inline int f6661_3(int x) { return x * 3; }
+inline int f6661_4(int x) { return x * 4; }
+inline int f6661_5(int x) { return x * 5; }
+inline int f6661_6(int x) { return x * 6; }
+inline int f6661_7(int x) { return x * 7; }
+inline int f6661_8(int x) { return x * 8; }
+inline int f6661_9(int x) { return x * 9; }
+inline int f6661_10(int x) { return x * 10; }
+inline int f6661_11(int x) { return x * 11; }
+inline int f6661_12(int x) { return x * 12; }
+inline int f6661_13(int x) { return x * 13; }
+inline int f6661_14(int x) { return x * 14; }
+inline int f6661_15(int x) { return x * 15; }
+inline int f6661_16(int x) { return x * 16; }
+inline int f6661_17(int x) { return x * 17; }
+inline int f6661_18(int x) { return x * 18; }
+inline int f6661_19(int x) { return x * 19; }
+inline int f6661_20(int x) { return x * 20; }
+inline int f6661_21(int x) { return x * 21; }
+inline int f6661_22(int x) { return x * 22; }
+inline int f6661_23(int x) { return x * 23; }
+inline int f6661_24(int x) { return x * 24; }
+inline int f6661_25(int x) { return x * 25; }
+inline int f6661_26(int x) { return x * 26; }
+inline int f6661_27(int x) { return x * 27; }
+inline int f6661_28(int x) { return x * 28; }
+inline int f6661_29(int x) { return x * 29; }
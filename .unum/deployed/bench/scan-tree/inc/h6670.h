@@ -0,0 +1,42 @@
+#pragma once
+/* header 6670 */
+#include <vector>
+#include "h5716.h"
+#include "h2168.h"
+#include "h6598.h"
+#include "h8564.h"
+#include "h7834.h"
+#ifdef X
+#include "h2175.h"
+#endif
+struct S6670 { int a; const char *s = "x//y"; };
+inline int f6670_0(int x) { return x * 0; }
+inline int f6670_1(int x) { return x * 1; }
+inline int f6670_2(int x) { return x * 2; }
+inline int f6670_3(int x) { return x * 3; }
+inline int f6670_4(int x) { return x * 4; }
+inline int f6670_5(int x) { return x * 5; }
+inline int f6670_6(int x) { return x * 6; }
+inline int f6670_7(int x) { return x * 7; }
+inline int f6670_8(int x) { return x * 8; }
+inline int f6670_9(int x) { return x * 9; }
+inline int f6670_10(int x) { return x * 10; }
+inline int f6670_11(int x) { return x * 11; }
+inline int f6670_12(int x) { return x * 12; }
+inline int f6670_13(int x) { return x * 13; }
+inline int f6670_14(int x) { return x * 14; }
+inline int f6670_15(int x) { return x * 15; }
+inline int f6670_16(int x) { return x * 16; }
+inline int f6670_17(int x) { return x * 17; }
+inline int f6670_18(int x) { return x * 18; }
+inline int f6670_19(int x) { return x * 19; }
+inline int f6670_20(int x) { return x * 20; }
+inline int f6670_21(int x) { return x * 21; }
+inline int f6670_22(int x) { return x * 22; }
+inline int f6670_23(int x) { return x * 23; }
+inline int f6670_24(int x) { return x * 24; }
+inline int f6670_25(int x) { return x * 25; }
+inline int f6670_26(int x) { return x * 26; }
+inline int f6670_27(int x) { return x * 27; }
+inline int f6670_28(int x) { return x * 28; }
+inline int f6670_29(int x) { return x * 29; }
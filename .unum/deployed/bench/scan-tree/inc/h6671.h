@@ -0,0 +1,42 @@
+#pragma once
+/* header 6671 */
+#include <vector>
+#include "h7451.h"
+#include "h7645.h"
+#include "h7261.h"
+#include "h741.h"
+#include "h4686.h"
+#ifdef X
+#include "h8627.h"
+#endif
+struct S6671 { int a; const char *s = "x//y"; };
+inline int f6671_0(int x) { return x * 0; }
+inline int f6671_1(int x) { return x * 1; }
+inline int f6671_2(int x) { return x * 2; }
+inline int f6671_3(int x) { return x * 3; }
+inline int f6671_4(int x) { return x * 4; }
+inline int f6671_5(int x) { return x * 5; }
+inline int f6671_6(int x) { return x * 6; }
+inline int f6671_7(int x) { return x * 7; }
+inline int f6671_8(int x) { return x * 8; }
+inline int f6671_9(int x) { return x * 9; }
+inline int f6671_10(int x) { return x * 10; }
+inline int f6671_11(int x) { return x * 11; }
+inline int f6671_12(int x) { return x * 12; }
+inline int f6671_13(int x) { return x * 13; }
+inline int f6671_14(int x) { return x * 14; }
+inline int f6671_15(int x) { return x * 15; }
+inline int f6671_16(int x) { return x * 16; }
+inline int f6671_17(int x) { return x * 17; }
+inline int f6671_18(int x) { return x * 18; }
+inline int f6671_19(int x) { return x * 19; }
+inline int f6671_20(int x) { return x * 20; }
+inline int f6671_21(int x) { return x * 21; }
+inline int f6671_22(int x) { return x * 22; }
+inline int f6671_23(int x) { return x * 23; }
+inline int f6671_24(int x) { return x * 24; }
+inline int f6671_25(int x) { return x * 25; }
+inline int f6671_26(int x) { return x * 26; }
+inline int f6671_27(int x) { return x * 27; }
+inline int f6671_28(int x) { return x * 28; }
+inline int f6671_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6673 */
+#include <vector>
+#include "h2808.h"
+#include "h749.h"
+#include "h7981.h"
+#include "h4622.h"
+#include "h3486.h"
+#ifdef X
+#include "h6232.h"
+#endif
+struct S6673 { int a; const char *s = "x//y"; };
+inline int f6673_0(int x) { return x * 0; }
+inline int f6673_1(int x) { return x * 1; }
+inline int f6673_2(int x) { return x * 2; }
+inline int f6673_3(int x) { return x * 3; }
+inline int f6673_4(int x) { return x * 4; }
+inline int f6673_5(int x) { return x * 5; }
+inline int f6673_6(int x) { return x * 6; }
+inline int f6673_7(int x) { return x * 7; }
+inline int f6673_8(int x) { return x * 8; }
+inline int f6673_9(int x) { return x * 9; }
+inline int f6673_10(int x) { return x * 10; }
+inline int f6673_11(int x) { return x * 11; }
+inline int f6673_12(int x) { return x * 12; }
+inline int f6673_13(int x) { return x * 13; }
+inline int f6673_14(int x) { return x * 14; }
+inline int f6673_15(int x) { return x * 15; }
+inline int f6673_16(int x) { return x * 16; }
+inline int f6673_17(int x) { return x * 17; }
+inline int f6673_18(int x) { return x * 18; }
+inline int f6673_19(int x) { return x * 19; }
+inline int f6673_20(int x) { return x * 20; }
+inline int f6673_21(int x) { return x * 21; }
+inline int f6673_22(int x) { return x * 22; }
+inline int f6673_23(int x) { return x * 23; }
+inline int f6673_24(int x) { return x * 24; }
+inline int f6673_25(int x) { return x * 25; }
+inline int f6673_26(int x) { return x * 26; }
+inline int f6673_27(int x) { return x * 27; }
+inline int f6673_28(int x) { return x * 28; }
+inline int f6673_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6677 */
+#include <vector>
+#include "h5006.h"
+#include "h7055.h"
+#include "h6009.h"
+#include "h1177.h"
+#include "h5995.h"
+#ifdef X
+#include "h3387.h"
+#endif
+struct S6677 { int a; const char *s = "x//y"; };
+inline int f6677_0(int x) { return x * 0; }
+inline int f6677_1(int x) { return x * 1; }
+inline int f6677_2(int x) { return x * 2; }
+inline int f6677_3(int x) { return x * 3; }
+inline int f6677_4(int x) { return x * 4; }
+inline int f6677_5(int x) { return x * 5; }
+inline int f6677_6(int x) { return x * 6; }
+inline int f6677_7(int x) { return x * 7; }
+inline int f6677_8(int x) { return x * 8; }
+inline int f6677_9(int x) { return x * 9; }
+inline int f6677_10(int x) { return x * 10; }
+inline int f6677_11(int x) { return x * 11; }
+inline int f6677_12(int x) { return x * 12; }
+inline int f6677_13(int x) { return x * 13; }
+inline int f6677_14(int x) { return x * 14; }
+inline int f6677_15(int x) { return x * 15; }
+inline int f6677_16(int x) { return x * 16; }
+inline int f6677_17(int x) { return x * 17; }
+inline int f6677_18(int x) { return x * 18; }
+inline int f6677_19(int x) { return x * 19; }
+inline int f6677_20(int x) { return x * 20; }
+inline int f6677_21(int x) { return x * 21; }
+inline int f6677_22(int x) { return x * 22; }
+inline int f6677_23(int x) { return x * 23; }
+inline int f6677_24(int x) { return x * 24; }
+inline int f6677_25(int x) { return x * 25; }
+inline int f6677_26(int x) { return x * 26; }
+inline int f6677_27(int x) { return x * 27; }
+inline int f6677_28(int x) { return x * 28; }
+inline int f6677_29(int x) { return x * 29; }
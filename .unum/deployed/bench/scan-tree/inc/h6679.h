@@ -0,0 +1,42 @@
+#pragma once
+/* header 6679 */
+#include <vector>
+#include "h5827.h"
+#include "h8214.h"
+#include "h853.h"
+#include "h548.h"
+#include "h1859.h"
+#ifdef X
+#include "h5061.h"
+#endif
+struct S6679 { int a; const char *s = "x//y"; };
+inline int f6679_0(int x) { return x * 0; }
+inline int f6679_1(int x) { return x * 1; }
+inline int f6679_2(int x) { return x * 2; }
+inline int f6679_3(int x) { return x * 3; }
+inline int f6679_4(int x) { return x * 4; }
+inline int f6679_5(int x) { return x * 5; }
+inline int f6679_6(int x) { return x * 6; }
+inline int f6679_7(int x) { return x * 7; }
+inline int f6679_8(int x) { return x * 8; }
+inline int f6679_9(int x) { return x * 9; }
+inline int f6679_10(int x) { return x * 10; }
+inline int f6679_11(int x) { return x * 11; }
+inline int f6679_12(int x) { return x * 12; }
+inline int f6679_13(int x) { return x * 13; }
+inline int f6679_14(int x) { return x * 14; }
+inline int f6679_15(int x) { return x * 15; }
+inline int f6679_16(int x) { return x * 16; }
+inline int f6679_17(int x) { return x * 17; }
+inline int f6679_18(int x) { return x * 18; }
+inline int f6679_19(int x) { return x * 19; }
+inline int f6679_20(int x) { return x * 20; }
+inline int f6679_21(int x) { return x * 21; }
+inline int f6679_22(int x) { return x * 22; }
+inline int f6679_23(int x) { return x * 23; }
+inline int f6679_24(int x) { return x * 24; }
+inline int f6679_25(int x) { return x * 25; }
+inline int f6679_26(int x) { return x * 26; }
+inline int f6679_27(int x) { return x * 27; }
+inline int f6679_28(int x) { return x * 28; }
+inline int f6679_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6680 */
+#include <vector>
+#include "h6791.h"
+#include "h9229.h"
+#include "h9810.h"
+#include "h9501.h"
+#include "h7042.h"
+#ifdef X
+#include "h2457.h"
+#endif
+struct S6680 { int a; const char *s = "x//y"; };
+inline int f6680_0(int x) { return x * 0; }
+inline int f6680_1(int x) { return x * 1; }
+inline int f6680_2(int x) { return x * 2; }
+inline int f6680_3(int x) { return x * 3; }
+inline int f6680_4(int x) { return x * 4; }
+inline int f6680_5(int x) { return x * 5; }
+inline int f6680_6(int x) { return x * 6; }
+inline int f6680_7(int x) { return x * 7; }
+inline int f6680_8(int x) { return x * 8; }
+inline int f6680_9(int x) { return x * 9; }
+inline int f6680_10(int x) { return x * 10; }
+inline int f6680_11(int x) { return x * 11; }
+inline int f6680_12(int x) { return x * 12; }
+inline int f6680_13(int x) { return x * 13; }
+inline int f6680_14(int x) { return x * 14; }
+inline int f6680_15(int x) { return x * 15; }
+inline int f6680_16(int x) { return x * 16; }
+inline int f6680_17(int x) { return x * 17; }
+inline int f6680_18(int x) { return x * 18; }
+inline int f6680_19(int x) { return x * 19; }
+inline int f6680_20(int x) { return x * 20; }
+inline int f6680_21(int x) { return x * 21; }
+inline int f6680_22(int x) { return x * 22; }
+inline int f6680_23(int x) { return x * 23; }
+inline int f6680_24(int x) { return x * 24; }
+inline int f6680_25(int x) { return x * 25; }
+inline int f6680_26(int x) { return x * 26; }
+inline int f6680_27(int x) { return x * 27; }
+inline int f6680_28(int x) { return x * 28; }
+inline int f6680_29(int x) { return x * 29; }
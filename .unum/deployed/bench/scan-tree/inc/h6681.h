@@ -0,0 +1,42 @@
+#pragma once
+/* header 6681 */
+#include <vector>
+#include "h2158.h"
+#include "h4935.h"
+#include "h5880.h"
+#include "h1914.h"
+#include "h4237.h"
+#ifdef X
+#include "h2311.h"
+#endif
+struct S6681 { int a; const char *s = "x//y"; };
+inline int f6681_0(int x) { return x * 0; }
+inline int f6681_1(int x) { return x * 1; }
+inline int f6681_2(int x) { return x * 2; }
+inline int f6681_3(int x) { return x * 3; }
+inline int f6681_4(int x) { return x * 4; }
+inline int f6681_5(int x) { return x * 5; }
+inline int f6681_6(int x) { return x * 6; }
+inline int f6681_7(int x) { return x * 7; }
+inline int f6681_8(int x) { return x * 8; }
+inline int f6681_9(int x) { return x * 9; }
+inline int f6681_10(int x) { return x * 10; }
+inline int f6681_11(int x) { return x * 11; }
+inline int f6681_12(int x) { return x * 12; }
+inline int f6681_13(int x) { return x * 13; }
+inline int f6681_14(int x) { return x * 14; }
+inline int f6681_15(int x) { return x * 15; }
+inline int f6681_16(int x) { return x * 16; }
+inline int f6681_17(int x) { return x * 17; }
+inline int f6681_18(int x) { return x * 18; }
+inline int f6681_19(int x) { return x * 19; }
+inline int f6681_20(int x) { return x * 20; }
+inline int f6681_21(int x) { return x * 21; }
+inline int f6681_22(int x) { return x * 22; }
+inline int f6681_23(int x) { return x * 23; }
+inline int f6681_24(int x) { return x * 24; }
+inline int f6681_25(int x) { return x * 25; }
+inline int f6681_26(int x) { return x * 26; }
+inline int f6681_27(int x) { return x * 27; }
+inline int f6681_28(int x) { return x * 28; }
+inline int f6681_29(int x) { return x * 29; }
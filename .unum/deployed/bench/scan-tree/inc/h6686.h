@@ -0,0 +1,42 @@
+#pragma once
+/* header 6686 */
+#include <vector>
+#include "h9440.h"
+#include "h7574.h"
+#include "h1612.h"
+#include "h8106.h"
+#include "h595.h"
+#ifdef X
+#include "h880.h"
+#endif
+struct S6686 { int a; const char *s = "x//y"; };
+inline int f6686_0(int x) { return x * 0; }
+inline int f6686_1(int x) { return x * 1; }
+inline int f6686_2(int x) { return x * 2; }
+inline int f6686_3(int x) { return x * 3; }
+inline int f6686_4(int x) { return x * 4; }
+inline int f6686_5(int x) { return x * 5; }
+inline int f6686_6(int x) { return x * 6; }
+inline int f6686_7(int x) { return x * 7; }
+inline int f6686_8(int x) { return x * 8; }
+inline int f6686_9(int x) { return x * 9; }
+inline int f6686_10(int x) { return x * 10; }
+inline int f6686_11(int x) { return x * 11; }
+inline int f6686_12(int x) { return x * 12; }
+inline int f6686_13(int x) { return x * 13; }
+inline int f6686_14(int x) { return x * 14; }
+inline int f6686_15(int x) { return x * 15; }
+inline int f6686_16(int x) { return x * 16; }
+inline int f6686_17(int x) { return x * 17; }
+inline int f6686_18(int x) { return x * 18; }
+inline int f6686_19(int x) { return x * 19; }
+inline int f6686_20(int x) { return x * 20; }
+inline int f6686_21(int x) { return x * 21; }
+inline int f6686_22(int x) { return x * 22; }
+inline int f6686_23(int x) { return x * 23; }
+inline int f6686_24(int x) { return x * 24; }
+inline int f6686_25(int x) { return x * 25; }
+inline int f6686_26(int x) { return x * 26; }
+inline int f6686_27(int x) { return x * 27; }
+inline int f6686_28(int x) { return x * 28; }
+inline int f6686_29(int x) { return x * 29; }
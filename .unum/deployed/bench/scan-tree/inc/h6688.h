@@ -0,0 +1,42 @@
+#pragma once
+/* header 6688 */
+#include <vector>
+#include "h4033.h"
+#include "h822.h"
+#include "h5492.h"
+#include "h4262.h"
+#include "h1031.h"
+#ifdef X
+#include "h8164.h"
+#endif
+struct S6688 { int a; const char *s = "x//y"; };
+inline int f6688_0(int x) { return x * 0; }
+inline int f6688_1(int x) { return x * 1; }
+inline int f6688_2(int x) { return x * 2; }
+inline int f6688_3(int x) { return x * 3; }
+inline int f6688_4(int x) { return x * 4; }
+inline int f6688_5(int x) { return x * 5; }
+inline int f6688_6(int x) { return x * 6; }
+inline int f6688_7(int x) { return x * 7; }
+inline int f6688_8(int x) { return x * 8; }
+inline int f6688_9(int x) { return x * 9; }
+inline int f6688_10(int x) { return x * 10; }
+inline int f6688_11(int x) { return x * 11; }
+inline int f6688_12(int x) { return x * 12; }
+inline int f6688_13(int x) { return x * 13; }
+inline int f6688_14(int x) { return x * 14; }
+inline int f6688_15(int x) { return x * 15; }
+inline int f6688_16(int x) { return x * 16; }
+inline int f6688_17(int x) { return x * 17; }
+inline int f6688_18(int x) { return x * 18; }
+inline int f6688_19(int x) { return x * 19; }
+inline int f6688_20(int x) { return x * 20; }
+inline int f6688_21(int x) { return x * 21; }
+inline int f6688_22(int x) { return x * 22; }
+inline int f6688_23(int x) { return x * 23; }
+inline int f6688_24(int x) { return x * 24; }
+inline int f6688_25(int x) { return x * 25; }
+inline int f6688_26(int x) { return x * 26; }
+inline int f6688_27(int x) { return x * 27; }
+inline int f6688_28(int x) { return x * 28; }
+inline int f6688_29(int x) { return x * 29; }
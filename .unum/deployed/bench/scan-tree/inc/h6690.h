@@ -0,0 +1,42 @@
+#pragma once
+/* header 6690 */
+#include <vector>
+#include "h9416.h"
+#include "h5100.h"
+#include "h2922.h"
+#include "h8803.h"
+#include "h7374.h"
+#ifdef X
+#include "h824.h"
+#endif
+struct S6690 { int a; const char *s = "x//y"; };
+inline int f6690_0(int x) { return x * 0; }
+inline int f6690_1(int x) { return x * 1; }
+inline int f6690_2(int x) { return x * 2; }
+inline int f6690_3(int x) { return x * 3; }
+inline int f6690_4(int x) { return x * 4; }
+inline int f6690_5(int x) { return x * 5; }
+inline int f6690_6(int x) { return x * 6; }
+inline int f6690_7(int x) { return x * 7; }
+inline int f6690_8(int x) { return x * 8; }
+inline int f6690_9(int x) { return x * 9; }
+inline int f6690_10(int x) { return x * 10; }
+inline int f6690_11(int x) { return x * 11; }
+inline int f6690_12(int x) { return x * 12; }
+inline int f6690_13(int x) { return x * 13; }
+inline int f6690_14(int x) { return x * 14; }
+inline int f6690_15(int x) { return x * 15; }
+inline int f6690_16(int x) { return x * 16; }
+inline int f6690_17(int x) { return x * 17; }
+inline int f6690_18(int x) { return x * 18; }
+inline int f6690_19(int x) { return x * 19; }
+inline int f6690_20(int x) { return x * 20; }
+inline int f6690_21(int x) { return x * 21; }
+inline int f6690_22(int x) { return x * 22; }
+inline int f6690_23(int x) { return x * 23; }
+inline int f6690_24(int x) { return x * 24; }
+inline int f6690_25(int x) { return x * 25; }
+inline int f6690_26(int x) { return x * 26; }
+inline int f6690_27(int x) { return x * 27; }
+inline int f6690_28(int x) { return x * 28; }
+inline int f6690_29(int x) { return x * 29; }
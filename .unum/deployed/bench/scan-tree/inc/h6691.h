@@ -0,0 +1,42 @@
+#pragma once
+/* header 6691 */
+#include <vector>
+#include "h7724.h"
+#include "h3819.h"
+#include "h8767.h"
+#include "h6376.h"
+#include "h5683.h"
+#ifdef X
+#include "h1868.h"
+#endif
+struct S6691 { int a; const char *s = "x//y"; };
+inline int f6691_0(int x) { return x * 0; }
+inline int f6691_1(int x) { return x * 1; }
+inline int f6691_2(int x) { return x * 2; }
+inline int f6691_3(int x) { return x * 3; }
+inline int f6691_4(int x) { return x * 4; }
+inline int f6691_5(int x) { return x * 5; }
+inline int f6691_6(int x) { return x * 6; }
+inline int f6691_7(int x) { return x * 7; }
+inline int f6691_8(int x) { return x * 8; }
+inline int f6691_9(int x) { return x * 9; }
+inline int f6691_10(int x) { return x * 10; }
+inline int f6691_11(int x) { return x * 11; }
+inline int f6691_12(int x) { return x * 12; }
+inline int f6691_13(int x) { return x * 13; }
+inline int f6691_14(int x) { return x * 14; }
+inline int f6691_15(int x) { return x * 15; }
+inline int f6691_16(int x) { return x * 16; }
+inline int f6691_17(int x) { return x * 17; }
+inline int f6691_18(int x) { return x * 18; }
+inline int f6691_19(int x) { return x * 19; }
+inline int f6691_20(int x) { return x * 20; }
+inline int f6691_21(int x) { return x * 21; }
+inline int f6691_22(int x) { return x * 22; }
+inline int f6691_23(int x) { return x * 23; }
+inline int f6691_24(int x) { return x * 24; }
+inline int f6691_25(int x) { return x * 25; }
+inline int f6691_26(int x) { return x * 26; }
+inline int f6691_27(int x) { return x * 27; }
+inline int f6691_28(int x) { return x * 28; }
+inline int f6691_29(int x) { return x * 29; }
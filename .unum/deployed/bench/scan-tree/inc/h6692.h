@@ -0,0 +1,42 @@
+#pragma once
+/* header 6692 */
+#include <vector>
+#include "h1404.h"
+#include "h5839.h"
+#include "h6879.h"
+#include "h3934.h"
+#include "h6576.h"
+#ifdef X
+#include "h6573.h"
+#endif
+struct S6692 { int a; const char *s = "x//y"; };
+inline int f6692_0(int x) { return x * 0; }
+inline int f6692_1(int x) { return x * 1; }
+inline int f6692_2(int x) { return x * 2; }
+inline int f6692_3(int x) { return x * 3; }
+inline int f6692_4(int x) { return x * 4; }
+inline int f6692_5(int x) { return x * 5; }
+inline int f6692_6(int x) { return x * 6; }
+inline int f6692_7(int x) { return x * 7; }
+inline int f6692_8(int x) { return x * 8; }
+inline int f6692_9(int x) { return x * 9; }
+inline int f6692_10(int x) { return x * 10; }
+inline int f6692_11(int x) { return x * 11; }
+inline int f6692_12(int x) { return x * 12; }
+inline int f6692_13(int x) { return x * 13; }
+inline int f6692_14(int x) { return x * 14; }
+inline int f6692_15(int x) { return x * 15; }
+inline int f6692_16(int x) { return x * 16; }
+inline int f6692_17(int x) { return x * 17; }
+inline int f6692_18(int x) { return x * 18; }
+inline int f6692_19(int x) { return x * 19; }
+inline int f6692_20(int x) { return x * 20; }
+inline int f6692_21(int x) { return x * 21; }
+inline int f6692_22(int x) { return x * 22; }
+inline int f6692_23(int x) { return x * 23; }
+inline int f6692_24(int x) { return x * 24; }
+inline int f6692_25(int x) { return x * 25; }
+inline int f6692_26(int x) { return x * 26; }
+inline int f6692_27(int x) { return x * 27; }
+inline int f6692_28(int x) { return x * 28; }
+inline int f6692_29(int x) { return x * 29; }
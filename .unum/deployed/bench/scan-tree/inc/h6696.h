@@ -0,0 +1,42 @@
+#pragma once
+/* header 6696 */
+#include <vector>
+#include "h6159.h"
+#include "h4646.h"
+#include "h5690.h"
+#include "h8990.h"
+#include "h3640.h"
+#ifdef X
+#include "h4082.h"
+#endif
+struct S6696 { int a; const char *s = "x//y"; };
+inline int f6696_0(int x) { return x * 0; }
+inline int f6696_1(int x) { return x * 1; }
+inline int f6696_2(int x) { return x * 2; }
+inline int f6696_3(int x) { return x * 3; }
+inline int f6696_4(int x) { return x * 4; }
+inline int f6696_5(int x) { return x * 5; }
+inline int f6696_6(int x) { return x * 6; }
+inline int f6696_7(int x) { return x * 7; }
+inline int f6696_8(int x) { return x * 8; }
+inline int f6696_9(int x) { return x * 9; }
+inline int f6696_10(int x) { return x * 10; }
+inline int f6696_11(int x) { return x * 11; }
+inline int f6696_12(int x) { return x * 12; }
+inline int f6696_13(int x) { return x * 13; }
+inline int f6696_14(int x) { return x * 14; }
+inline int f6696_15(int x) { return x * 15; }
+inline int f6696_16(int x) { return x * 16; }
+inline int f6696_17(int x) { return x * 17; }
+inline int f6696_18(int x) { return x * 18; }
+inline int f6696_19(int x) { return x * 19; }
+inline int f6696_20(int x) { return x * 20; }
+inline int f6696_21(int x) { return x * 21; }
+inline int f6696_22(int x) { return x * 22; }
+inline int f6696_23(int x) { return x * 23; }
+inline int f6696_24(int x) { return x * 24; }
+inline int f6696_25(int x) { return x * 25; }
+inline int f6696_26(int x) { return x * 26; }
+inline int f6696_27(int x) { return x * 27; }
+inline int f6696_28(int x) { return x * 28; }
+inline int f6696_29(int x) { return x * 29; }
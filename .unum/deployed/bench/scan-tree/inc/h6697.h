@@ -0,0 +1,42 @@
+#pragma once
+/* header 6697 */
+#include <vector>
+#include "h5326.h"
+#include "h1466.h"
+#include "h6088.h"
+#include "h6188.h"
+#include "h7724.h"
+#ifdef X
+#include "h7405.h"
+#endif
+struct S6697 { int a; const char *s = "x//y"; };
+inline int f6697_0(int x) { return x * 0; }
+inline int f6697_1(int x) { return x * 1; }
+inline int f6697_2(int x) { return x * 2; }
+inline int f6697_3(int x) { return x * 3; }
+inline int f6697_4(int x) { return x * 4; }
+inline int f6697_5(int x) { return x * 5; }
+inline int f6697_6(int x) { return x * 6; }
+inline int f6697_7(int x) { return x * 7; }
+inline int f6697_8(int x) { return x * 8; }
+inline int f6697_9(int x) { return x * 9; }
+inline int f6697_10(int x) { return x * 10; }
+inline int f6697_11(int x) { return x * 11; }
+inline int f6697_12(int x) { return x * 12; }
+inline int f6697_13(int x) { return x * 13; }
+inline int f6697_14(int x) { return x * 14; }
+inline int f6697_15(int x) { return x * 15; }
+inline int f6697_16(int x) { return x * 16; }
+inline int f6697_17(int x) { return x * 17; }
+inline int f6697_18(int x) { return x * 18; }
+inline int f6697_19(int x) { return x * 19; }
+inline int f6697_20(int x) { return x * 20; }
+inline int f6697_21(int x) { return x * 21; }
+inline int f6697_22(int x) { return x * 22; }
+inline int f6697_23(int x) { return x * 23; }
+inline int f6697_24(int x) { return x * 24; }
+inline int f6697_25(int x) { return x * 25; }
+inline int f6697_26(int x) { return x * 26; }
+inline int f6697_27(int x) { return x * 27; }
+inline int f6697_28(int x) { return x * 28; }
+inline int f6697_29(int x) { return x * 29; }
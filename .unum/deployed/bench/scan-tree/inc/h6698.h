@@ -0,0 +1,42 @@
+#pragma once
+/* header 6698 */
+#include <vector>
+#include "h6981.h"
+#include "h6678.h"
+#include "h513.h"
+#include "h4505.h"
+#include "h5309.h"
+#ifdef X
+#include "h9392.h"
+#endif
+struct S6698 { int a; const char *s = "x//y"; };
+inline int f6698_0(int x) { return x * 0; }
+inline int f6698_1(int x) { return x * 1; }
+inline int f6698_2(int x) { return x * 2; }
+inline int f6698_3(int x) { return x * 3; }
+inline int f6698_4(int x) { return x * 4; }
+inline int f6698_5(int x) { return x * 5; }
+inline int f6698_6(int x) { return x * 6; }
+inline int f6698_7(int x) { return x * 7; }
+inline int f6698_8(int x) { return x * 8; }
+inline int f6698_9(int x) { return x * 9; }
+inline int f6698_10(int x) { return x * 10; }
+inline int f6698_11(int x) { return x * 11; }
+inline int f6698_12(int x) { return x * 12; }
+inline int f6698_13(int x) { return x * 13; }
+inline int f6698_14(int x) { return x * 14; }
+inline int f6698_15(int x) { return x * 15; }
+inline int f6698_16(int x) { return x * 16; }
+inline int f6698_17(int x) { return x * 17; }
+inline int f6698_18(int x) { return x * 18; }
+inline int f6698_19(int x) { return x * 19; }
+inline int f6698_20(int x) { return x * 20; }
+inline int f6698_21(int x) { return x * 21; }
+inline int f6698_22(int x) { return x * 22; }
+inline int f6698_23(int x) { return x * 23; }
+inline int f6698_24(int x) { return x * 24; }
+inline int f6698_25(int x) { return x * 25; }
+inline int f6698_26(int x) { return x * 26; }
+inline int f6698_27(int x) { return x * 27; }
+inline int f6698_28(int x) { return x * 28; }
+inline int f6698_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 67 */
+#include <vector>
+#include "h3367.h"
+#include "h2661.h"
+#include "h4820.h"
+#include "h6804.h"
+#include "h9410.h"
+#ifdef X
+#include "h8458.h"
+#endif
+struct S67 { int a; const char *s = "x//y"; };
+inline int f67_0(int x) { return x * 0; }
+inline int f67_1(int x) { return x * 1; }
+inline int f67_2(int x) { return x * 2; }
+inline int f67_3(int x) { return x * 3; }
+inline int f67_4(int x) { return x * 4; }
+inline int f67_5(int x) { return x * 5; }
+inline int f67_6(int x) { return x * 6; }
+inline int f67_7(int x) { return x * 7; }
+inline int f67_8(int x) { return x * 8; }
+inline int f67_9(int x) { return x * 9; }
+inline int f67_10(int x) { return x * 10; }
+inline int f67_11(int x) { return x * 11; }
+inline int f67_12(int x) { return x * 12; }
+inline int f67_13(int x) { return x * 13; }
+inline int f67_14(int x) { return x * 14; }
+inline int f67_15(int x) { return x * 15; }
+inline int f67_16(int x) { return x * 16; }
+inline int f67_17(int x) { return x * 17; }
+inline int f67_18(int x) { return x * 18; }
+inline int f67_19(int x) { return x * 19; }
+inline int f67_20(int x) { return x * 20; }
+inline int f67_21(int x) { return x * 21; }
+inline int f67_22(int x) { return x * 22; }
+inline int f67_23(int x) { return x * 23; }
+inline int f67_24(int x) { return x * 24; }
+inline int f67_25(int x) { return x * 25; }
+inline int f67_26(int x) { return x * 26; }
+inline int f67_27(int x) { return x * 27; }
+inline int f67_28(int x) { return x * 28; }
+inline int f67_29(int x) { return x * 29; }
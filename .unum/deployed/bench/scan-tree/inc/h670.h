@@ -0,0 +1,42 @@
+#pragma once
+/* header 670 */
+#include <vector>
+#include "h5227.h"
+#include "h9810.h"
+#include "h5379.h"
+#include "h5482.h"
+#include "h2768.h"
+#ifdef X
+#include "h9259.h"
+#endif
+struct S670 { int a; const char *s = "x//y"; };
+inline int f670_0(int x) { return x * 0; }
+inline int f670_1(int x) { return x * 1; }
+inline int f670_2(int x) { return x * 2; }
+inline int f670_3(int x) { return x * 3; }
+inline int f670_4(int x) { return x * 4; }
+inline int f670_5(int x) { return x * 5; }
+inline int f670_6(int x) { return x * 6; }
+inline int f670_7(int x) { return x * 7; }
+inline int f670_8(int x) { return x * 8; }
+inline int f670_9(int x) { return x * 9; }
+inline int f670_10(int x) { return x * 10; }
+inline int f670_11(int x) { return x * 11; }
+inline int f670_12(int x) { return x * 12; }
+inline int f670_13(int x) { return x * 13; }
+inline int f670_14(int x) { return x * 14; }
+inline int f670_15(int x) { return x * 15; }
+inline int f670_16(int x) { return x * 16; }
+inline int f670_17(int x) { return x * 17; }
+inline int f670_18(int x) { return x * 18; }
+inline int f670_19(int x) { return x * 19; }
+inline int f670_20(int x) { return x * 20; }
+inline int f670_21(int x) { return x * 21; }
+inline int f670_22(int x) { return x * 22; }
+inline int f670_23(int x) { return x * 23; }
+inline int f670_24(int x) { return x * 24; }
+inline int f670_25(int x) { return x * 25; }
+inline int f670_26(int x) { return x * 26; }
+inline int f670_27(int x) { return x * 27; }
+inline int f670_28(int x) { return x * 28; }
+inline int f670_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6700 */
+#include <vector>
+#include "h3567.h"
+#include "h7006.h"
+#include "h1664.h"
+#include "h3532.h"
+#include "h7398.h"
+#ifdef X
+#include "h7157.h"
+#endif
+struct S6700 { int a; const char *s = "x//y"; };
+inline int f6700_0(int x) { return x * 0; }
+inline int f6700_1(int x) { return x * 1; }
+inline int f6700_2(int x) { return x * 2; }
+inline int f6700_3(int x) { return x * 3; }
+inline int f6700_4(int x) { return x * 4; }
+inline int f6700_5(int x) { return x * 5; }
+inline int f6700_6(int x) { return x * 6; }
+inline int f6700_7(int x) { return x * 7; }
+inline int f6700_8(int x) { return x * 8; }
+inline int f6700_9(int x) { return x * 9; }
+inline int f6700_10(int x) { return x * 10; }
+inline int f6700_11(int x) { return x * 11; }
+inline int f6700_12(int x) { return x * 12; }
+inline int f6700_13(int x) { return x * 13; }
+inline int f6700_14(int x) { return x * 14; }
+inline int f6700_15(int x) { return x * 15; }
+inline int f6700_16(int x) { return x * 16; }
+inline int f6700_17(int x) { return x * 17; }
+inline int f6700_18(int x) { return x * 18; }
+inline int f6700_19(int x) { return x * 19; }
+inline int f6700_20(int x) { return x * 20; }
+inline int f6700_21(int x) { return x * 21; }
+inline int f6700_22(int x) { return x * 22; }
+inline int f6700_23(int x) { return x * 23; }
+inline int f6700_24(int x) { return x * 24; }
+inline int f6700_25(int x) { return x * 25; }
+inline int f6700_26(int x) { return x * 26; }
+inline int f6700_27(int x) { return x * 27; }
+inline int f6700_28(int x) { return x * 28; }
+inline int f6700_29(int x) { return x * 29; }
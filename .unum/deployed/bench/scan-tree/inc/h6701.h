@@ -0,0 +1,42 @@
+#pragma once
+/* header 6701 */
+#include <vector>
+#include "h4951.h"
+#include "h3628.h"
+#include "h1853.h"
+#include "h7550.h"
+#include "h7819.h"
+#ifdef X
+#include "h8386.h"
+#endif
+struct S6701 { int a; const char *s = "x//y"; };
+inline int f6701_0(int x) { return x * 0; }
+inline int f6701_1(int x) { return x * 1; }
+inline int f6701_2(int x) { return x * 2; }
+inline int f6701_3(int x) { return x * 3; }
+inline int f6701_4(int x) { return x * 4; }
+inline int f6701_5(int x) { return x * 5; }
+inline int f6701_6(int x) { return x * 6; }
+inline int f6701_7(int x) { return x * 7; }
+inline int f6701_8(int x) { return x * 8; }
+inline int f6701_9(int x) { return x * 9; }
+inline int f6701_10(int x) { return x * 10; }
+inline int f6701_11(int x) { return x * 11; }
+inline int f6701_12(int x) { return x * 12; }
+inline int f6701_13(int x) { return x * 13; }
+inline int f6701_14(int x) { return x * 14; }
+inline int f6701_15(int x) { return x * 15; }
+inline int f6701_16(int x) { return x * 16; }
+inline int f6701_17(int x) { return x * 17; }
+inline int f6701_18(int x) { return x * 18; }
+inline int f6701_19(int x) { return x * 19; }
+inline int f6701_20(int x) { return x * 20; }
+inline int f6701_21(int x) { return x * 21; }
+inline int f6701_22(int x) { return x * 22; }
+inline int f6701_23(int x) { return x * 23; }
+inline int f6701_24(int x) { return x * 24; }
+inline int f6701_25(int x) { return x * 25; }
+inline int f6701_26(int x) { return x * 26; }
+inline int f6701_27(int x) { return x * 27; }
+inline int f6701_28(int x) { return x * 28; }
+inline int f6701_29(int x) { return x * 29; }
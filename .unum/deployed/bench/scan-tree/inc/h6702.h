@@ -0,0 +1,42 @@
+#pragma once
+/* header 6702 */
+#include <vector>
+#include "h839.h"
+#include "h4970.h"
+#include "h7970.h"
+#include "h9253.h"
+#include "h7451.h"
+#ifdef X
+#include "h1598.h"
+#endif
+struct S6702 { int a; const char *s = "x//y"; };
+inline int f6702_0(int x) { return x * 0; }
+inline int f6702_1(int x) { return x * 1; }
+inline int f6702_2(int x) { return x * 2; }
+inline int f6702_3(int x) { return x * 3; }
+inline int f6702_4(int x) { return x * 4; }
+inline int f6702_5(int x) { return x * 5; }
+inline int f6702_6(int x) { return x * 6; }
+inline int f6702_7(int x) { return x * 7; }
+inline int f6702_8(int x) { return x * 8; }
+inline int f6702_9(int x) { return x * 9; }
+inline int f6702_10(int x) { return x * 10; }
+inline int f6702_11(int x) { return x * 11; }
+inline int f6702_12(int x) { return x * 12; }
+inline int f6702_13(int x) { return x * 13; }
+inline int f6702_14(int x) { return x * 14; }
+inline int f6702_15(int x) { return x * 15; }
+inline int f6702_16(int x) { return x * 16; }
+inline int f6702_17(int x) { return x * 17; }
+inline int f6702_18(int x) { return x * 18; }
+inline int f6702_19(int x) { return x * 19; }
+inline int f6702_20(int x) { return x * 20; }
+inline int f6702_21(int x) { return x * 21; }
+inline int f6702_22(int x) { return x * 22; }
+inline int f6702_23(int x) { return x * 23; }
+inline int f6702_24(int x) { return x * 24; }
+inline int f6702_25(int x) { return x * 25; }
+inline int f6702_26(int x) { return x * 26; }
+inline int f6702_27(int x) { return x * 27; }
+inline int f6702_28(int x) { return x * 28; }
+inline int f6702_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6705 */
+#include <vector>
+#include "h2732.h"
+#include "h9104.h"
+#include "h8033.h"
+#include "h3211.h"
+#include "h1396.h"
+#ifdef X
+#include "h494.h"
+#endif
+struct S6705 { int a; const char *s = "x//y"; };
+inline int f6705_0(int x) { return x * 0; }
+inline int f6705_1(int x) { return x * 1; }
+inline int f6705_2(int x) { return x * 2; }
+inline int f6705_3(int x) { return x * 3; }
+inline int f6705_4(int x) { return x * 4; }
+inline int f6705_5(int x) { return x * 5; }
+inline int f6705_6(int x) { return x * 6; }
+inline int f6705_7(int x) { return x * 7; }
+inline int f6705_8(int x) { return x * 8; }
+inline int f6705_9(int x) { return x * 9; }
+inline int f6705_10(int x) { return x * 10; }
+inline int f6705_11(int x) { return x * 11; }
+inline int f6705_12(int x) { return x * 12; }
+inline int f6705_13(int x) { return x * 13; }
+inline int f6705_14(int x) { return x * 14; }
+inline int f6705_15(int x) { return x * 15; }
+inline int f6705_16(int x) { return x * 16; }
+inline int f6705_17(int x) { return x * 17; }
+inline int f6705_18(int x) { return x * 18; }
+inline int f6705_19(int x) { return x * 19; }
+inline int f6705_20(int x) { return x * 20; }
+inline int f6705_21(int x) { return x * 21; }
+inline int f6705_22(int x) { return x * 22; }
+inline int f6705_23(int x) { return x * 23; }
+inline int f6705_24(int x) { return x * 24; }
+inline int f6705_25(int x) { return x * 25; }
+inline int f6705_26(int x) { return x * 26; }
+inline int f6705_27(int x) { return x * 27; }
+inline int f6705_28(int x) { return x * 28; }
+inline int f6705_29(int x) { return x * 29; }
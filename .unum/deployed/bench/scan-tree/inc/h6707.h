@@ -0,0 +1,42 @@
+#pragma once
+/* header 6707 */
+#include <vector>
+#include "h8308.h"
+#include "h772.h"
+#include "h603.h"
+#include "h5875.h"
+#include "h1590.h"
+#ifdef X
+#include "h5104.h"
+#endif
+struct S6707 { int a; const char *s = "x//y"; };
+inline int f6707_0(int x) { return x * 0; }
+inline int f6707_1(int x) { return x * 1; }
+inline int f6707_2(int x) { return x * 2; }
+inline int f6707_3(int x) { return x * 3; }
+inline int f6707_4(int x) { return x * 4; }
+inline int f6707_5(int x) { return x * 5; }
+inline int f6707_6(int x) { return x * 6; }
+inline int f6707_7(int x) { return x * 7; }
+inline int f6707_8(int x) { return x * 8; }
+inline int f6707_9(int x) { return x * 9; }
+inline int f6707_10(int x) { return x * 10; }
+inline int f6707_11(int x) { return x * 11; }
+inline int f6707_12(int x) { return x * 12; }
+inline int f6707_13(int x) { return x * 13; }
+inline int f6707_14(int x) { return x * 14; }
+inline int f6707_15(int x) { return x * 15; }
+inline int f6707_16(int x) { return x * 16; }
+inline int f6707_17(int x) { return x * 17; }
+inline int f6707_18(int x) { return x * 18; }
+inline int f6707_19(int x) { return x * 19; }
+inline int f6707_20(int x) { return x * 20; }
+inline int f6707_21(int x) { return x * 21; }
+inline int f6707_22(int x) { return x * 22; }
+inline int f6707_23(int x) { return x * 23; }
+inline int f6707_24(int x) { return x * 24; }
+inline int f6707_25(int x) { return x * 25; }
+inline int f6707_26(int x) { return x * 26; }
+inline int f6707_27(int x) { return x * 27; }
+inline int f6707_28(int x) { return x * 28; }
+inline int f6707_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6709 */
+#include <vector>
+#include "h2418.h"
+#include "h3015.h"
+#include "h3631.h"
+#include "h8963.h"
+#include "h2371.h"
+#ifdef X
+#include "h5227.h"
+#endif
+struct S6709 { int a; const char *s = "x//y"; };
+inline int f6709_0(int x) { return x * 0; }
+inline int f6709_1(int x) { return x * 1; }
+inline int f6709_2(int x) { return x * 2; }
+inline int f6709_3(int x) { return x * 3; }
+inline int f6709_4(int x) { return x * 4; }
+inline int f6709_5(int x) { return x * 5; }
+inline int f6709_6(int x) { return x * 6; }
+inline int f6709_7(int x) { return x * 7; }
+inline int f6709_8(int x) { return x * 8; }
+inline int f6709_9(int x) { return x * 9; }
+inline int f6709_10(int x) { return x * 10; }
+inline int f6709_11(int x) { return x * 11; }
+inline int f6709_12(int x) { return x * 12; }
+inline int f6709_13(int x) { return x * 13; }
+inline int f6709_14(int x) { return x * 14; }
+inline int f6709_15(int x) { return x * 15; }
+inline int f6709_16(int x) { return x * 16; }
+inline int f6709_17(int x) { return x * 17; }
+inline int f6709_18(int x) { return x * 18; }
+inline int f6709_19(int x) { return x * 19; }
+inline int f6709_20(int x) { return x * 20; }
+inline int f6709_21(int x) { return x * 21; }
+inline int f6709_22(int x) { return x * 22; }
+inline int f6709_23(int x) { return x * 23; }
+inline int f6709_24(int x) { return x * 24; }
+inline int f6709_25(int x) { return x * 25; }
+inline int f6709_26(int x) { return x * 26; }
+inline int f6709_27(int x) { return x * 27; }
+inline int f6709_28(int x) { return x * 28; }
+inline int f6709_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6711 */
+#include <vector>
+#include "h7578.h"
+#include "h9291.h"
+#include "h9827.h"
+#include "h9418.h"
+#include "h2379.h"
+#ifdef X
+#include "h4772.h"
+#endif
+struct S6711 { int a; const char *s = "x//y"; };
+inline int f6711_0(int x) { return x * 0; }
+inline int f6711_1(int x) { return x * 1; }
+inline int f6711_2(int x) { return x * 2; }
+inline int f6711_3(int x) { return x * 3; }
+inline int f6711_4(int x) { return x * 4; }
+inline int f6711_5(int x) { return x * 5; }
+inline int f6711_6(int x) { return x * 6; }
+inline int f6711_7(int x) { return x * 7; }
+inline int f6711_8(int x) { return x * 8; }
+inline int f6711_9(int x) { return x * 9; }
+inline int f6711_10(int x) { return x * 10; }
+inline int f6711_11(int x) { return x * 11; }
+inline int f6711_12(int x) { return x * 12; }
+inline int f6711_13(int x) { return x * 13; }
+inline int f6711_14(int x) { return x * 14; }
+inline int f6711_15(int x) { return x * 15; }
+inline int f6711_16(int x) { return x * 16; }
+inline int f6711_17(int x) { return x * 17; }
+inline int f6711_18(int x) { return x * 18; }
+inline int f6711_19(int x) { return x * 19; }
+inline int f6711_20(int x) { return x * 20; }
+inline int f6711_21(int x) { return x * 21; }
+inline int f6711_22(int x) { return x * 22; }
+inline int f6711_23(int x) { return x * 23; }
+inline int f6711_24(int x) { return x * 24; }
+inline int f6711_25(int x) { return x * 25; }
+inline int f6711_26(int x) { return x * 26; }
+inline int f6711_27(int x) { return x * 27; }
+inline int f6711_28(int x) { return x * 28; }
+inline int f6711_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6713 */
+#include <vector>
+#include "h5076.h"
+#include "h7529.h"
+#include "h5656.h"
+#include "h5210.h"
+#include "h8075.h"
+#ifdef X
+#include "h2181.h"
+#endif
+struct S6713 { int a; const char *s = "x//y"; };
+inline int f6713_0(int x) { return x * 0; }
+inline int f6713_1(int x) { return x * 1; }
+inline int f6713_2(int x) { return x * 2; }
+inline int f6713_3(int x) { return x * 3; }
+inline int f6713_4(int x) { return x * 4; }
+inline int f6713_5(int x) { return x * 5; }
+inline int f6713_6(int x) { return x * 6; }
+inline int f6713_7(int x) { return x * 7; }
+inline int f6713_8(int x) { return x * 8; }
+inline int f6713_9(int x) { return x * 9; }
+inline int f6713_10(int x) { return x * 10; }
+inline int f6713_11(int x) { return x * 11; }
+inline int f6713_12(int x) { return x * 12; }
+inline int f6713_13(int x) { return x * 13; }
+inline int f6713_14(int x) { return x * 14; }
+inline int f6713_15(int x) { return x * 15; }
+inline int f6713_16(int x) { return x * 16; }
+inline int f6713_17(int x) { return x * 17; }
+inline int f6713_18(int x) { return x * 18; }
+inline int f6713_19(int x) { return x * 19; }
+inline int f6713_20(int x) { return x * 20; }
+inline int f6713_21(int x) { return x * 21; }
+inline int f6713_22(int x) { return x * 22; }
+inline int f6713_23(int x) { return x * 23; }
+inline int f6713_24(int x) { return x * 24; }
+inline int f6713_25(int x) { return x * 25; }
+inline int f6713_26(int x) { return x * 26; }
+inline int f6713_27(int x) { return x * 27; }
+inline int f6713_28(int x) { return x * 28; }
+inline int f6713_29(int x) { return x * 29; }
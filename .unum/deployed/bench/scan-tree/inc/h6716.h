@@ -0,0 +1,42 @@
+#pragma once
+/* header 6716 */
+#include <vector>
+#include "h36.h"
+#include "h2460.h"
+#include "h4522.h"
+#include "h399.h"
+#include "h4093.h"
+#ifdef X
+#include "h5425.h"
+#endif
+struct S6716 { int a; const char *s = "x//y"; };
+inline int f6716_0(int x) { return x * 0; }
+inline int f6716_1(int x) { return x * 1; }
+inline int f6716_2(int x) { return x * 2; }
+inline int f6716_3(int x) { return x * 3; }
+inline int f6716_4(int x) { return x * 4; }
+inline int f6716_5(int x) { return x * 5; }
+inline int f6716_6(int x) { return x * 6; }
+inline int f6716_7(int x) { return x * 7; }
+inline int f6716_8(int x) { return x * 8; }
+inline int f6716_9(int x) { return x * 9; }
+inline int f6716_10(int x) { return x * 10; }
+inline int f6716_11(int x) { return x * 11; }
+inline int f6716_12(int x) { return x * 12; }
+inline int f6716_13(int x) { return x * 13; }
+inline int f6716_14(int x) { return x * 14; }
+inline int f6716_15(int x) { return x * 15; }
+inline int f6716_16(int x) { return x * 16; }
+inline int f6716_17(int x) { return x * 17; }
+inline int f6716_18(int x) { return x * 18; }
+inline int f6716_19(int x) { return x * 19; }
+inline int f6716_20(int x) { return x * 20; }
+inline int f6716_21(int x) { return x * 21; }
+inline int f6716_22(int x) { return x * 22; }
+inline int f6716_23(int x) { return x * 23; }
+inline int f6716_24(int x) { return x * 24; }
+inline int f6716_25(int x) { return x * 25; }
+inline int f6716_26(int x) { return x * 26; }
+inline int f6716_27(int x) { return x * 27; }
+inline int f6716_28(int x) { return x * 28; }
+inline int f6716_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6720 */
+#include <vector>
+#include "h9497.h"
+#include "h7654.h"
+#include "h3901.h"
+#include "h9192.h"
+#include "h2082.h"
+#ifdef X
+#include "h8161.h"
+#endif
+struct S6720 { int a; const char *s = "x//y"; };
+inline int f6720_0(int x) { return x * 0; }
+inline int f6720_1(int x) { return x * 1; }
+inline int f6720_2(int x) { return x * 2; }
+inline int f6720_3(int x) { return x * 3; }
+inline int f6720_4(int x) { return x * 4; }
+inline int f6720_5(int x) { return x * 5; }
+inline int f6720_6(int x) { return x * 6; }
+inline int f6720_7(int x) { return x * 7; }
+inline int f6720_8(int x) { return x * 8; }
+inline int f6720_9(int x) { return x * 9; }
+inline int f6720_10(int x) { return x * 10; }
+inline int f6720_11(int x) { return x * 11; }
+inline int f6720_12(int x) { return x * 12; }
+inline int f6720_13(int x) { return x * 13; }
+inline int f6720_14(int x) { return x * 14; }
+inline int f6720_15(int x) { return x * 15; }
+inline int f6720_16(int x) { return x * 16; }
+inline int f6720_17(int x) { return x * 17; }
+inline int f6720_18(int x) { return x * 18; }
+inline int f6720_19(int x) { return x * 19; }
+inline int f6720_20(int x) { return x * 20; }
+inline int f6720_21(int x) { return x * 21; }
+inline int f6720_22(int x) { return x * 22; }
+inline int f6720_23(int x) { return x * 23; }
+inline int f6720_24(int x) { return x * 24; }
+inline int f6720_25(int x) { return x * 25; }
+inline int f6720_26(int x) { return x * 26; }
+inline int f6720_27(int x) { return x * 27; }
+inline int f6720_28(int x) { return x * 28; }
+inline int f6720_29(int x) { return x * 29; }
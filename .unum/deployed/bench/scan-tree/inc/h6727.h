@@ -0,0 +1,42 @@
+#pragma once
+/* header 6727 */
+#include <vector>
+#include "h3233.h"
+#include "h3136.h"
+#include "h4174.h"
+#include "h3775.h"
+#include "h3866.h"
+#ifdef X
+#include "h974.h"
+#endif
+struct S6727 { int a; const char *s = "x//y"; };
+inline int f6727_0(int x) { return x * 0; }
+inline int f6727_1(int x) { return x * 1; }
+inline int f6727_2(int x) { return x * 2; }
+inline int f6727_3(int x) { return x * 3; }
+inline int f6727_4(int x) { return x * 4; }
+inline int f6727_5(int x) { return x * 5; }
+inline int f6727_6(int x) { return x * 6; }
+inline int f6727_7(int x) { return x * 7; }
+inline int f6727_8(int x) { return x * 8; }
+inline int f6727_9(int x) { return x * 9; }
+inline int f6727_10(int x) { return x * 10; }
+inline int f6727_11(int x) { return x * 11; }
+inline int f6727_12(int x) { return x * 12; }
+inline int f6727_13(int x) { return x * 13; }
+inline int f6727_14(int x) { return x * 14; }
+inline int f6727_15(int x) { return x * 15; }
+inline int f6727_16(int x) { return x * 16; }
+inline int f6727_17(int x) { return x * 17; }
+inline int f6727_18(int x) { return x * 18; }
+inline int f6727_19(int x) { return x * 19; }
+inline int f6727_20(int x) { return x * 20; }
+inline int f6727_21(int x) { return x * 21; }
+inline int f6727_22(int x) { return x * 22; }
+inline int f6727_23(int x) { return x * 23; }
+inline int f6727_24(int x) { return x * 24; }
+inline int f6727_25(int x) { return x * 25; }
+inline int f6727_26(int x) { return x * 26; }
+inline int f6727_27(int x) { return x * 27; }
+inline int f6727_28(int x) { return x * 28; }
+inline int f6727_29(int x) { return x * 29; }
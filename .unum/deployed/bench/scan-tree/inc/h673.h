@@ -0,0 +1,42 @@
+#pragma once
+/* header 673 */
+#include <vector>
+#include "h8891.h"
+#include "h7511.h"
+#include "h454.h"
+#include "h3280.h"
+#include "h9185.h"
+#ifdef X
+#include "h4657.h"
+#endif
+struct S673 { int a; const char *s = "x//y"; };
+inline int f673_0(int x) { return x * 0; }
+inline int f673_1(int x) { return x * 1; }
+inline int f673_2(int x) { return x * 2; }
+inline int f673_3(int x) { return x * 3; }
+inline int f673_4(int x) { return x * 4; }
+inline int f673_5(int x) { return x * 5; }
+inline int f673_6(int x) { return x * 6; }
+inline int f673_7(int x) { return x * 7; }
+inline int f673_8(int x) { return x * 8; }
+inline int f673_9(int x) { return x * 9; }
+inline int f673_10(int x) { return x * 10; }
+inline int f673_11(int x) { return x * 11; }
+inline int f673_12(int x) { return x * 12; }
+inline int f673_13(int x) { return x * 13; }
+inline int f673_14(int x) { return x * 14; }
+inline int f673_15(int x) { return x * 15; }
+inline int f673_16(int x) { return x * 16; }
+inline int f673_17(int x) { return x * 17; }
+inline int f673_18(int x) { return x * 18; }
+inline int f673_19(int x) { return x * 19; }
+inline int f673_20(int x) { return x * 20; }
+inline int f673_21(int x) { return x * 21; }
+inline int f673_22(int x) { return x * 22; }
+inline int f673_23(int x) { return x * 23; }
+inline int f673_24(int x) { return x * 24; }
+inline int f673_25(int x) { return x * 25; }
+inline int f673_26(int x) { return x * 26; }
+inline int f673_27(int x) { return x * 27; }
+inline int f673_28(int x) { return x * 28; }
+inline int f673_29(int x) { return x * 29; }
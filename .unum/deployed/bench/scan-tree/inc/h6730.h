@@ -0,0 +1,42 @@
+#pragma once
+/* header 6730 */
+#include <vector>
+#include "h7936.h"
+#include "h5042.h"
+#include "h6387.h"
+#include "h9294.h"
+#include "h1823.h"
+#ifdef X
+#include "h2292.h"
+#endif
+struct S6730 { int a; const char *s = "x//y"; };
+inline int f6730_0(int x) { return x * 0; }
+inline int f6730_1(int x) { return x * 1; }
+inline int f6730_2(int x) { return x * 2; }
+inline int f6730_3(int x) { return x * 3; }
+inline int f6730_4(int x) { return x * 4; }
+inline int f6730_5(int x) { return x * 5; }
+inline int f6730_6(int x) { return x * 6; }
+inline int f6730_7(int x) { return x * 7; }
+inline int f6730_8(int x) { return x * 8; }
+inline int f6730_9(int x) { return x * 9; }
+inline int f6730_10(int x) { return x * 10; }
+inline int f6730_11(int x) { return x * 11; }
+inline int f6730_12(int x) { return x * 12; }
+inline int f6730_13(int x) { return x * 13; }
+inline int f6730_14(int x) { return x * 14; }
+inline int f6730_15(int x) { return x * 15; }
+inline int f6730_16(int x) { return x * 16; }
+inline int f6730_17(int x) { return x * 17; }
+inline int f6730_18(int x) { return x * 18; }
+inline int f6730_19(int x) { return x * 19; }
+inline int f6730_20(int x) { return x * 20; }
+inline int f6730_21(int x) { return x * 21; }
+inline int f6730_22(int x) { return x * 22; }
+inline int f6730_23(int x) { return x * 23; }
+inline int f6730_24(int x) { return x * 24; }
+inline int f6730_25(int x) { return x * 25; }
+inline int f6730_26(int x) { return x * 26; }
+inline int f6730_27(int x) { return x * 27; }
+inline int f6730_28(int x) { return x * 28; }
+inline int f6730_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6732 */
+#include <vector>
+#include "h3251.h"
+#include "h7170.h"
+#include "h3585.h"
+#include "h6448.h"
+#include "h3692.h"
+#ifdef X
+#include "h4280.h"
+#endif
+struct S6732 { int a; const char *s = "x//y"; };
+inline int f6732_0(int x) { return x * 0; }
+inline int f6732_1(int x) { return x * 1; }
+inline int f6732_2(int x) { return x * 2; }
+inline int f6732_3(int x) { return x * 3; }
+inline int f6732_4(int x) { return x * 4; }
+inline int f6732_5(int x) { return x * 5; }
+inline int f6732_6(int x) { return x * 6; }
+inline int f6732_7(int x) { return x * 7; }
+inline int f6732_8(int x) { return x * 8; }
+inline int f6732_9(int x) { return x * 9; }
+inline int f6732_10(int x) { return x * 10; }
+inline int f6732_11(int x) { return x * 11; }
+inline int f6732_12(int x) { return x * 12; }
+inline int f6732_13(int x) { return x * 13; }
+inline int f6732_14(int x) { return x * 14; }
+inline int f6732_15(int x) { return x * 15; }
+inline int f6732_16(int x) { return x * 16; }
+inline int f6732_17(int x) { return x * 17; }
+inline int f6732_18(int x) { return x * 18; }
+inline int f6732_19(int x) { return x * 19; }
+inline int f6732_20(int x) { return x * 20; }
+inline int f6732_21(int x) { return x * 21; }
+inline int f6732_22(int x) { return x * 22; }
+inline int f6732_23(int x) { return x * 23; }
+inline int f6732_24(int x) { return x * 24; }
+inline int f6732_25(int x) { return x * 25; }
+inline int f6732_26(int x) { return x * 26; }
+inline int f6732_27(int x) { return x * 27; }
+inline int f6732_28(int x) { return x * 28; }
+inline int f6732_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6733 */
+#include <vector>
+#include "h9191.h"
+#include "h8463.h"
+#include "h1541.h"
+#include "h8746.h"
+#include "h7872.h"
+#ifdef X
+#include "h8988.h"
+#endif
+struct S6733 { int a; const char *s = "x//y"; };
+inline int f6733_0(int x) { return x * 0; }
+inline int f6733_1(int x) { return x * 1; }
+inline int f6733_2(int x) { return x * 2; }
+inline int f6733_3(int x) { return x * 3; }
+inline int f6733_4(int x) { return x * 4; }
+inline int f6733_5(int x) { return x * 5; }
+inline int f6733_6(int x) { return x * 6; }
+inline int f6733_7(int x) { return x * 7; }
+inline int f6733_8(int x) { return x * 8; }
+inline int f6733_9(int x) { return x * 9; }
+inline int f6733_10(int x) { return x * 10; }
+inline int f6733_11(int x) { return x * 11; }
+inline int f6733_12(int x) { return x * 12; }
+inline int f6733_13(int x) { return x * 13; }
+inline int f6733_14(int x) { return x * 14; }
+inline int f6733_15(int x) { return x * 15; }
+inline int f6733_16(int x) { return x * 16; }
+inline int f6733_17(int x) { return x * 17; }
+inline int f6733_18(int x) { return x * 18; }
+inline int f6733_19(int x) { return x * 19; }
+inline int f6733_20(int x) { return x * 20; }
+inline int f6733_21(int x) { return x * 21; }
+inline int f6733_22(int x) { return x * 22; }
+inline int f6733_23(int x) { return x * 23; }
+inline int f6733_24(int x) { return x * 24; }
+inline int f6733_25(int x) { return x * 25; }
+inline int f6733_26(int x) { return x * 26; }
+inline int f6733_27(int x) { return x * 27; }
+inline int f6733_28(int x) { return x * 28; }
+inline int f6733_29(int x) { return x * 29; }
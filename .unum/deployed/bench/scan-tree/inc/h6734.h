@@ -0,0 +1,42 @@
+#pragma once
+/* header 6734 */
+#include <vector>
+#include "h1702.h"
+#include "h9554.h"
+#include "h7227.h"
+#include "h3760.h"
+#include "h8057.h"
+#ifdef X
+#include "h4831.h"
+#endif
+struct S6734 { int a; const char *s = "x//y"; };
+inline int f6734_0(int x) { return x * 0; }
+inline int f6734_1(int x) { return x * 1; }
+inline int f6734_2(int x) { return x * 2; }
+inline int f6734_3(int x) { return x * 3; }
+inline int f6734_4(int x) { return x * 4; }
+inline int f6734_5(int x) { return x * 5; }
+inline int f6734_6(int x) { return x * 6; }
+inline int f6734_7(int x) { return x * 7; }
+inline int f6734_8(int x) { return x * 8; }
+inline int f6734_9(int x) { return x * 9; }
+inline int f6734_10(int x) { return x * 10; }
+inline int f6734_11(int x) { return x * 11; }
+inline int f6734_12(int x) { return x * 12; }
+inline int f6734_13(int x) { return x * 13; }
+inline int f6734_14(int x) { return x * 14; }
+inline int f6734_15(int x) { return x * 15; }
+inline int f6734_16(int x) { return x * 16; }
+inline int f6734_17(int x) { return x * 17; }
+inline int f6734_18(int x) { return x * 18; }
+inline int f6734_19(int x) { return x * 19; }
+inline int f6734_20(int x) { return x * 20; }
+inline int f6734_21(int x) { return x * 21; }
+inline int f6734_22(int x) { return x * 22; }
+inline int f6734_23(int x) { return x * 23; }
+inline int f6734_24(int x) { return x * 24; }
+inline int f6734_25(int x) { return x * 25; }
+inline int f6734_26(int x) { return x * 26; }
+inline int f6734_27(int x) { return x * 27; }
+inline int f6734_28(int x) { return x * 28; }
+inline int f6734_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6735 */
+#include <vector>
+#include "h7484.h"
+#include "h4217.h"
+#include "h1904.h"
+#include "h9666.h"
+#include "h9812.h"
+#ifdef X
+#include "h1659.h"
+#endif
+struct S6735 { int a; const char *s = "x//y"; };
+inline int f6735_0(int x) { return x * 0; }
+inline int f6735_1(int x) { return x * 1; }
+inline int f6735_2(int x) { return x * 2; }
+inline int f6735_3(int x) { return x * 3; }
+inline int f6735_4(int x) { return x * 4; }
+inline int f6735_5(int x) { return x * 5; }
+inline int f6735_6(int x) { return x * 6; }
+inline int f6735_7(int x) { return x * 7; }
+inline int f6735_8(int x) { return x * 8; }
+inline int f6735_9(int x) { return x * 9; }
+inline int f6735_10(int x) { return x * 10; }
+inline int f6735_11(int x) { return x * 11; }
+inline int f6735_12(int x) { return x * 12; }
+inline int f6735_13(int x) { return x * 13; }
+inline int f6735_14(int x) { return x * 14; }
+inline int f6735_15(int x) { return x * 15; }
+inline int f6735_16(int x) { return x * 16; }
+inline int f6735_17(int x) { return x * 17; }
+inline int f6735_18(int x) { return x * 18; }
+inline int f6735_19(int x) { return x * 19; }
+inline int f6735_20(int x) { return x * 20; }
+inline int f6735_21(int x) { return x * 21; }
+inline int f6735_22(int x) { return x * 22; }
+inline int f6735_23(int x) { return x * 23; }
+inline int f6735_24(int x) { return x * 24; }
+inline int f6735_25(int x) { return x * 25; }
+inline int f6735_26(int x) { return x * 26; }
+inline int f6735_27(int x) { return x * 27; }
+inline int f6735_28(int x) { return x * 28; }
+inline int f6735_29(int x) { return x * 29; }
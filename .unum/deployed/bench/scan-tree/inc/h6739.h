@@ -0,0 +1,42 @@
+#pragma once
+/* header 6739 */
+#include <vector>
+#include "h1606.h"
+#include "h7398.h"
+#include "h4534.h"
+#include "h859.h"
+#include "h7108.h"
+#ifdef X
+#include "h9435.h"
+#endif
+struct S6739 { int a; const char *s = "x//y"; };
+inline int f6739_0(int x) { return x * 0; }
+inline int f6739_1(int x) { return x * 1; }
+inline int f6739_2(int x) { return x * 2; }
+inline int f6739_3(int x) { return x * 3; }
+inline int f6739_4(int x) { return x * 4; }
+inline int f6739_5(int x) { return x * 5; }
+inline int f6739_6(int x) { return x * 6; }
+inline int f6739_7(int x) { return x * 7; }
+inline int f6739_8(int x) { return x * 8; }
+inline int f6739_9(int x) { return x * 9; }
+inline int f6739_10(int x) { return x * 10; }
+inline int f6739_11(int x) { return x * 11; }
+inline int f6739_12(int x) { return x * 12; }
+inline int f6739_13(int x) { return x * 13; }
+inline int f6739_14(int x) { return x * 14; }
+inline int f6739_15(int x) { return x * 15; }
+inline int f6739_16(int x) { return x * 16; }
+inline int f6739_17(int x) { return x * 17; }
+inline int f6739_18(int x) { return x * 18; }
+inline int f6739_19(int x) { return x * 19; }
+inline int f6739_20(int x) { return x * 20; }
+inline int f6739_21(int x) { return x * 21; }
+inline int f6739_22(int x) { return x * 22; }
+inline int f6739_23(int x) { return x * 23; }
+inline int f6739_24(int x) { return x * 24; }
+inline int f6739_25(int x) { return x * 25; }
+inline int f6739_26(int x) { return x * 26; }
+inline int f6739_27(int x) { return x * 27; }
+inline int f6739_28(int x) { return x * 28; }
+inline int f6739_29(int x) { return x * 29; }
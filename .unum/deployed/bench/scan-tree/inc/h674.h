@@ -0,0 +1,42 @@
+#pragma once
+/* header 674 */
+#include <vector>
+#include "h6285.h"
+#include "h2188.h"
+#include "h9621.h"
+#include "h6461.h"
+#include "h9098.h"
+#ifdef X
+#include "h1967.h"
+#endif
+struct S674 { int a; const char *s = "x//y"; };
+inline int f674_0(int x) { return x * 0; }
+inline int f674_1(int x) { return x * 1; }
+inline int f674_2(int x) { return x * 2; }
+inline int f674_3(int x) { return x * 3; }
+inline int f674_4(int x) { return x * 4; }
+inline int f674_5(int x) { return x * 5; }
+inline int f674_6(int x) { return x * 6; }
+inline int f674_7(int x) { return x * 7; }
+inline int f674_8(int x) { return x * 8; }
+inline int f674_9(int x) { return x * 9; }
+inline int f674_10(int x) { return x * 10; }
+inline int f674_11(int x) { return x * 11; }
+inline int f674_12(int x) { return x * 12; }
+inline int f674_13(int x) { return x * 13; }
+inline int f674_14(int x) { return x * 14; }
+inline int f674_15(int x) { return x * 15; }
+inline int f674_16(int x) { return x * 16; }
+inline int f674_17(int x) { return x * 17; }
+inline int f674_18(int x) { return x * 18; }
+inline int f674_19(int x) { return x * 19; }
+inline int f674_20(int x) { return x * 20; }
+inline int f674_21(int x) { return x * 21; }
+inline int f674_22(int x) { return x * 22; }
+inline int f674_23(int x) { return x * 23; }
+inline int f674_24(int x) { return x * 24; }
+inline int f674_25(int x) { return x * 25; }
+inline int f674_26(int x) { return x * 26; }
+inline int f674_27(int x) { return x * 27; }
+inline int f674_28(int x) { return x * 28; }
+inline int f674_29(int x) { return x * 29; }
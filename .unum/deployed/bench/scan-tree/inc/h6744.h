@@ -0,0 +1,42 @@
+#pragma once
+/* header 6744 */
+#include <vector>
+#include "h212.h"
+#include "h2888.h"
+#include "h7275.h"
+#include "h873.h"
+#include "h1550.h"
+#ifdef X
+#include "h5057.h"
+#endif
+struct S6744 { int a; const char *s = "x//y"; };
+inline int f6744_0(int x) { return x * 0; }
+inline int f6744_1(int x) { return x * 1; }
+inline int f6744_2(int x) { return x * 2; }
+inline int f6744_3(int x) { return x * 3; }
+inline int f6744_4(int x) { return x * 4; }
+inline int f6744_5(int x) { return x * 5; }
+inline int f6744_6(int x) { return x * 6; }
+inline int f6744_7(int x) { return x * 7; }
+inline int f6744_8(int x) { return x * 8; }
+inline int f6744_9(int x) { return x * 9; }
+inline int f6744_10(int x) { return x * 10; }
+inline int f6744_11(int x) { return x * 11; }
+inline int f6744_12(int x) { return x * 12; }
+inline int f6744_13(int x) { return x * 13; }
+inline int f6744_14(int x) { return x * 14; }
+inline int f6744_15(int x) { return x * 15; }
+inline int f6744_16(int x) { return x * 16; }
+inline int f6744_17(int x) { return x * 17; }
+inline int f6744_18(int x) { return x * 18; }
+inline int f6744_19(int x) { return x * 19; }
+inline int f6744_20(int x) { return x * 20; }
+inline int f6744_21(int x) { return x * 21; }
+inline int f6744_22(int x) { return x * 22; }
+inline int f6744_23(int x) { return x * 23; }
+inline int f6744_24(int x) { return x * 24; }
+inline int f6744_25(int x) { return x * 25; }
+inline int f6744_26(int x) { return x * 26; }
+inline int f6744_27(int x) { return x * 27; }
+inline int f6744_28(int x) { return x * 28; }
+inline int f6744_29(int x) { return x * 29; }
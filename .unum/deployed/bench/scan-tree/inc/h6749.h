@@ -0,0 +1,42 @@
+#pragma once
+/* header 6749 */
+#include <vector>
+#include "h5726.h"
+#include "h1835.h"
+#include "h7105.h"
+#include "h6544.h"
+#include "h3937.h"
+#ifdef X
+#include "h9851.h"
+#endif
+struct S6749 { int a; const char *s = "x//y"; };
+inline int f6749_0(int x) { return x * 0; }
+inline int f6749_1(int x) { return x * 1; }
+inline int f6749_2(int x) { return x * 2; }
+inline int f6749_3(int x) { return x * 3; }
+inline int f6749_4(int x) { return x * 4; }
+inline int f6749_5(int x) { return x * 5; }
+inline int f6749_6(int x) { return x * 6; }
+inline int f6749_7(int x) { return x * 7; }
+inline int f6749_8(int x) { return x * 8; }
+inline int f6749_9(int x) { return x * 9; }
+inline int f6749_10(int x) { return x * 10; }
+inline int f6749_11(int x) { return x * 11; }
+inline int f6749_12(int x) { return x * 12; }
+inline int f6749_13(int x) { return x * 13; }
+inline int f6749_14(int x) { return x * 14; }
+inline int f6749_15(int x) { return x * 15; }
+inline int f6749_16(int x) { return x * 16; }
+inline int f6749_17(int x) { return x * 17; }
+inline int f6749_18(int x) { return x * 18; }
+inline int f6749_19(int x) { return x * 19; }
+inline int f6749_20(int x) { return x * 20; }
+inline int f6749_21(int x) { return x * 21; }
+inline int f6749_22(int x) { return x * 22; }
+inline int f6749_23(int x) { return x * 23; }
+inline int f6749_24(int x) { return x * 24; }
+inline int f6749_25(int x) { return x * 25; }
+inline int f6749_26(int x) { return x * 26; }
+inline int f6749_27(int x) { return x * 27; }
+inline int f6749_28(int x) { return x * 28; }
+inline int f6749_29(int x) { return x * 29; }
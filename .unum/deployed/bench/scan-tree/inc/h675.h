@@ -0,0 +1,42 @@
+#pragma once
+/* header 675 */
+#include <vector>
+#include "h3666.h"
+#include "h8297.h"
+#include "h9746.h"
+#include "h3289.h"
+#include "h7268.h"
+#ifdef X
+#include "h1996.h"
+#endif
+struct S675 { int a; const char *s = "x//y"; };
+inline int f675_0(int x) { return x * 0; }
+inline int f675_1(int x) { return x * 1; }
+inline int f675_2(int x) { return x * 2; }
+inline int f675_3(int x) { return x * 3; }
+inline int f675_4(int x) { return x * 4; }
+inline int f675_5(int x) { return x * 5; }
+inline int f675_6(int x) { return x * 6; }
+inline int f675_7(int x) { return x * 7; }
+inline int f675_8(int x) { return x * 8; }
+inline int f675_9(int x) { return x * 9; }
+inline int f675_10(int x) { return x * 10; }
+inline int f675_11(int x) { return x * 11; }
+inline int f675_12(int x) { return x * 12; }
+inline int f675_13(int x) { return x * 13; }
+inline int f675_14(int x) { return x * 14; }
+inline int f675_15(int x) { return x * 15; }
+inline int f675_16(int x) { return x * 16; }
+inline int f675_17(int x) { return x * 17; }
+inline int f675_18(int x) { return x * 18; }
+inline int f675_19(int x) { return x * 19; }
+inline int f675_20(int x) { return x * 20; }
+inline int f675_21(int x) { return x * 21; }
+inline int f675_22(int x) { return x * 22; }
+inline int f675_23(int x) { return x * 23; }
+inline int f675_24(int x) { return x * 24; }
+inline int f675_25(int x) { return x * 25; }
+inline int f675_26(int x) { return x * 26; }
+inline int f675_27(int x) { return x * 27; }
+inline int f675_28(int x) { return x * 28; }
+inline int f675_29(int x) { return x * 29; }
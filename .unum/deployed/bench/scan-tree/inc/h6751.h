@@ -0,0 +1,42 @@
+#pragma once
+/* header 6751 */
+#include <vector>
+#include "h5068.h"
+#include "h4991.h"
+#include "h2298.h"
+#include "h3110.h"
+#include "h5199.h"
+#ifdef X
+#include "h470.h"
+#endif
+struct S6751 { int a; const char *s = "x//y"; };
+inline int f6751_0(int x) { return x * 0; }
+inline int f6751_1(int x) { return x * 1; }
+inline int f6751_2(int x) { return x * 2; }
+inline int f6751_3(int x) { return x * 3; }
+inline int f6751_4(int x) { return x * 4; }
+inline int f6751_5(int x) { return x * 5; }
+inline int f6751_6(int x) { return x * 6; }
+inline int f6751_7(int x) { return x * 7; }
+inline int f6751_8(int x) { return x * 8; }
+inline int f6751_9(int x) { return x * 9; }
+inline int f6751_10(int x) { return x * 10; }
+inline int f6751_11(int x) { return x * 11; }
+inline int f6751_12(int x) { return x * 12; }
+inline int f6751_13(int x) { return x * 13; }
+inline int f6751_14(int x) { return x * 14; }
+inline int f6751_15(int x) { return x * 15; }
+inline int f6751_16(int x) { return x * 16; }
+inline int f6751_17(int x) { return x * 17; }
+inline int f6751_18(int x) { return x * 18; }
+inline int f6751_19(int x) { return x * 19; }
+inline int f6751_20(int x) { return x * 20; }
+inline int f6751_21(int x) { return x * 21; }
+inline int f6751_22(int x) { return x * 22; }
+inline int f6751_23(int x) { return x * 23; }
+inline int f6751_24(int x) { return x * 24; }
+inline int f6751_25(int x) { return x * 25; }
+inline int f6751_26(int x) { return x * 26; }
+inline int f6751_27(int x) { return x * 27; }
+inline int f6751_28(int x) { return x * 28; }
+inline int f6751_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6752 */
+#include <vector>
+#include "h3768.h"
+#include "h8141.h"
+#include "h9744.h"
+#include "h2574.h"
+#include "h4754.h"
+#ifdef X
+#include "h285.h"
+#endif
+struct S6752 { int a; const char *s = "x//y"; };
+inline int f6752_0(int x) { return x * 0; }
+inline int f6752_1(int x) { return x * 1; }
+inline int f6752_2(int x) { return x * 2; }
+inline int f6752_3(int x) { return x * 3; }
+inline int f6752_4(int x) { return x * 4; }
+inline int f6752_5(int x) { return x * 5; }
+inline int f6752_6(int x) { return x * 6; }
+inline int f6752_7(int x) { return x * 7; }
+inline int f6752_8(int x) { return x * 8; }
+inline int f6752_9(int x) { return x * 9; }
+inline int f6752_10(int x) { return x * 10; }
+inline int f6752_11(int x) { return x * 11; }
+inline int f6752_12(int x) { return x * 12; }
+inline int f6752_13(int x) { return x * 13; }
+inline int f6752_14(int x) { return x * 14; }
+inline int f6752_15(int x) { return x * 15; }
+inline int f6752_16(int x) { return x * 16; }
+inline int f6752_17(int x) { return x * 17; }
+inline int f6752_18(int x) { return x * 18; }
+inline int f6752_19(int x) { return x * 19; }
+inline int f6752_20(int x) { return x * 20; }
+inline int f6752_21(int x) { return x * 21; }
+inline int f6752_22(int x) { return x * 22; }
+inline int f6752_23(int x) { return x * 23; }
+inline int f6752_24(int x) { return x * 24; }
+inline int f6752_25(int x) { return x * 25; }
+inline int f6752_26(int x) { return x * 26; }
+inline int f6752_27(int x) { return x * 27; }
+inline int f6752_28(int x) { return x * 28; }
+inline int f6752_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6757 */
+#include <vector>
+#include "h3328.h"
+#include "h478.h"
+#include "h3128.h"
+#include "h322.h"
+#include "h7774.h"
+#ifdef X
+#include "h3557.h"
+#endif
+struct S6757 { int a; const char *s = "x//y"; };
+inline int f6757_0(int x) { return x * 0; }
+inline int f6757_1(int x) { return x * 1; }
+inline int f6757_2(int x) { return x * 2; }
+inline int f6757_3(int x) { return x * 3; }
+inline int f6757_4(int x) { return x * 4; }
+inline int f6757_5(int x) { return x * 5; }
+inline int f6757_6(int x) { return x * 6; }
+inline int f6757_7(int x) { return x * 7; }
+inline int f6757_8(int x) { return x * 8; }
+inline int f6757_9(int x) { return x * 9; }
+inline int f6757_10(int x) { return x * 10; }
+inline int f6757_11(int x) { return x * 11; }
+inline int f6757_12(int x) { return x * 12; }
+inline int f6757_13(int x) { return x * 13; }
+inline int f6757_14(int x) { return x * 14; }
+inline int f6757_15(int x) { return x * 15; }
+inline int f6757_16(int x) { return x * 16; }
+inline int f6757_17(int x) { return x * 17; }
+inline int f6757_18(int x) { return x * 18; }
+inline int f6757_19(int x) { return x * 19; }
+inline int f6757_20(int x) { return x * 20; }
+inline int f6757_21(int x) { return x * 21; }
+inline int f6757_22(int x) { return x * 22; }
+inline int f6757_23(int x) { return x * 23; }
+inline int f6757_24(int x) { return x * 24; }
+inline int f6757_25(int x) { return x * 25; }
+inline int f6757_26(int x) { return x * 26; }
+inline int f6757_27(int x) { return x * 27; }
+inline int f6757_28(int x) { return x * 28; }
+inline int f6757_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 676 */
+#include <vector>
+#include "h2093.h"
+#include "h1778.h"
+#include "h5890.h"
+#include "h9319.h"
+#include "h8385.h"
+#ifdef X
+#include "h5560.h"
+#endif
+struct S676 { int a; const char *s = "x//y"; };
+inline int f676_0(int x) { return x * 0; }
+inline int f676_1(int x) { return x * 1; }
+inline int f676_2(int x) { return x * 2; }
+inline int f676_3(int x) { return x * 3; }
+inline int f676_4(int x) { return x * 4; }
+inline int f676_5(int x) { return x * 5; }
+inline int f676_6(int x) { return x * 6; }
+inline int f676_7(int x) { return x * 7; }
+inline int f676_8(int x) { return x * 8; }
+inline int f676_9(int x) { return x * 9; }
+inline int f676_10(int x) { return x * 10; }
+inline int f676_11(int x) { return x * 11; }
+inline int f676_12(int x) { return x * 12; }
+inline int f676_13(int x) { return x * 13; }
+inline int f676_14(int x) { return x * 14; }
+inline int f676_15(int x) { return x * 15; }
+inline int f676_16(int x) { return x * 16; }
+inline int f676_17(int x) { return x * 17; }
+inline int f676_18(int x) { return x * 18; }
+inline int f676_19(int x) { return x * 19; }
+inline int f676_20(int x) { return x * 20; }
+inline int f676_21(int x) { return x * 21; }
+inline int f676_22(int x) { return x * 22; }
+inline int f676_23(int x) { return x * 23; }
+inline int f676_24(int x) { return x * 24; }
+inline int f676_25(int x) { return x * 25; }
+inline int f676_26(int x) { return x * 26; }
+inline int f676_27(int x) { return x * 27; }
+inline int f676_28(int x) { return x * 28; }
+inline int f676_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6760 */
+#include <vector>
+#include "h5740.h"
+#include "h5014.h"
+#include "h6170.h"
+#include "h6920.h"
+#include "h1977.h"
+#ifdef X
+#include "h1269.h"
+#endif
+struct S6760 { int a; const char *s = "x//y"; };
+inline int f6760_0(int x) { return x * 0; }
+inline int f6760_1(int x) { return x * 1; }
+inline int f6760_2(int x) { return x * 2; }
+inline int f6760_3(int x) { return x * 3; }
+inline int f6760_4(int x) { return x * 4; }
+inline int f6760_5(int x) { return x * 5; }
+inline int f6760_6(int x) { return x * 6; }
+inline int f6760_7(int x) { return x * 7; }
+inline int f6760_8(int x) { return x * 8; }
+inline int f6760_9(int x) { return x * 9; }
+inline int f6760_10(int x) { return x * 10; }
+inline int f6760_11(int x) { return x * 11; }
+inline int f6760_12(int x) { return x * 12; }
+inline int f6760_13(int x) { return x * 13; }
+inline int f6760_14(int x) { return x * 14; }
+inline int f6760_15(int x) { return x * 15; }
+inline int f6760_16(int x) { return x * 16; }
+inline int f6760_17(int x) { return x * 17; }
+inline int f6760_18(int x) { return x * 18; }
+inline int f6760_19(int x) { return x * 19; }
+inline int f6760_20(int x) { return x * 20; }
+inline int f6760_21(int x) { return x * 21; }
+inline int f6760_22(int x) { return x * 22; }
+inline int f6760_23(int x) { return x * 23; }
+inline int f6760_24(int x) { return x * 24; }
+inline int f6760_25(int x) { return x * 25; }
+inline int f6760_26(int x) { return x * 26; }
+inline int f6760_27(int x) { return x * 27; }
+inline int f6760_28(int x) { return x * 28; }
+inline int f6760_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6765 */
+#include <vector>
+#include "h3647.h"
+#include "h5495.h"
+#include "h9994.h"
+#include "h2769.h"
+#include "h4631.h"
+#ifdef X
+#include "h6509.h"
+#endif
+struct S6765 { int a; const char *s = "x//y"; };
+inline int f6765_0(int x) { return x * 0; }
+inline int f6765_1(int x) { return x * 1; }
+inline int f6765_2(int x) { return x * 2; }
+inline int f6765_3(int x) { return x * 3; }
+inline int f6765_4(int x) { return x * 4; }
+inline int f6765_5(int x) { return x * 5; }
+inline int f6765_6(int x) { return x * 6; }
+inline int f6765_7(int x) { return x * 7; }
+inline int f6765_8(int x) { return x * 8; }
+inline int f6765_9(int x) { return x * 9; }
+inline int f6765_10(int x) { return x * 10; }
+inline int f6765_11(int x) { return x * 11; }
+inline int f6765_12(int x) { return x * 12; }
+inline int f6765_13(int x) { return x * 13; }
+inline int f6765_14(int x) { return x * 14; }
+inline int f6765_15(int x) { return x * 15; }
+inline int f6765_16(int x) { return x * 16; }
+inline int f6765_17(int x) { return x * 17; }
+inline int f6765_18(int x) { return x * 18; }
+inline int f6765_19(int x) { return x * 19; }
+inline int f6765_20(int x) { return x * 20; }
+inline int f6765_21(int x) { return x * 21; }
+inline int f6765_22(int x) { return x * 22; }
+inline int f6765_23(int x) { return x * 23; }
+inline int f6765_24(int x) { return x * 24; }
+inline int f6765_25(int x) { return x * 25; }
+inline int f6765_26(int x) { return x * 26; }
+inline int f6765_27(int x) { return x * 27; }
+inline int f6765_28(int x) { return x * 28; }
+inline int f6765_29(int x) { return x * 29; }
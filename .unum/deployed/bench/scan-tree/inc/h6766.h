@@ -0,0 +1,42 @@
+#pragma once
+/* header 6766 */
+#include <vector>
+#include "h1620.h"
+#include "h1673.h"
+#include "h3572.h"
+#include "h2329.h"
+#include "h3213.h"
+#ifdef X
+#include "h8742.h"
+#endif
+struct S6766 { int a; const char *s = "x//y"; };
+inline int f6766_0(int x) { return x * 0; }
+inline int f6766_1(int x) { return x * 1; }
+inline int f6766_2(int x) { return x * 2; }
+inline int f6766_3(int x) { return x * 3; }
+inline int f6766_4(int x) { return x * 4; }
+inline int f6766_5(int x) { return x * 5; }
+inline int f6766_6(int x) { return x * 6; }
+inline int f6766_7(int x) { return x * 7; }
+inline int f6766_8(int x) { return x * 8; }
+inline int f6766_9(int x) { return x * 9; }
+inline int f6766_10(int x) { return x * 10; }
+inline int f6766_11(int x) { return x * 11; }
+inline int f6766_12(int x) { return x * 12; }
+inline int f6766_13(int x) { return x * 13; }
+inline int f6766_14(int x) { return x * 14; }
+inline int f6766_15(int x) { return x * 15; }
+inline int f6766_16(int x) { return x * 16; }
+inline int f6766_17(int x) { return x * 17; }
+inline int f6766_18(int x) { return x * 18; }
+inline int f6766_19(int x) { return x * 19; }
+inline int f6766_20(int x) { return x * 20; }
+inline int f6766_21(int x) { return x * 21; }
+inline int f6766_22(int x) { return x * 22; }
+inline int f6766_23(int x) { return x * 23; }
+inline int f6766_24(int x) { return x * 24; }
+inline int f6766_25(int x) { return x * 25; }
+inline int f6766_26(int x) { return x * 26; }
+inline int f6766_27(int x) { return x * 27; }
+inline int f6766_28(int x) { return x * 28; }
+inline int f6766_29(int x) { return x * 29; }
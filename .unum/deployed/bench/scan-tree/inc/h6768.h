@@ -0,0 +1,42 @@
+#pragma once
+/* header 6768 */
+#include <vector>
+#include "h618.h"
+#include "h4667.h"
+#include "h5613.h"
+#include "h959.h"
+#include "h5367.h"
+#ifdef X
+#include "h6056.h"
+#endif
+struct S6768 { int a; const char *s = "x//y"; };
+inline int f6768_0(int x) { return x * 0; }
+inline int f6768_1(int x) { return x * 1; }
+inline int f6768_2(int x) { return x * 2; }
+inline int f6768_3(int x) { return x * 3; }
+inline int f6768_4(int x) { return x * 4; }
+inline int f6768_5(int x) { return x * 5; }
+inline int f6768_6(int x) { return x * 6; }
+inline int f6768_7(int x) { return x * 7; }
+inline int f6768_8(int x) { return x * 8; }
+inline int f6768_9(int x) { return x * 9; }
+inline int f6768_10(int x) { return x * 10; }
+inline int f6768_11(int x) { return x * 11; }
+inline int f6768_12(int x) { return x * 12; }
+inline int f6768_13(int x) { return x * 13; }
+inline int f6768_14(int x) { return x * 14; }
+inline int f6768_15(int x) { return x * 15; }
+inline int f6768_16(int x) { return x * 16; }
+inline int f6768_17(int x) { return x * 17; }
+inline int f6768_18(int x) { return x * 18; }
+inline int f6768_19(int x) { return x * 19; }
+inline int f6768_20(int x) { return x * 20; }
+inline int f6768_21(int x) { return x * 21; }
+inline int f6768_22(int x) { return x * 22; }
+inline int f6768_23(int x) { return x * 23; }
+inline int f6768_24(int x) { return x * 24; }
+inline int f6768_25(int x) { return x * 25; }
+inline int f6768_26(int x) { return x * 26; }
+inline int f6768_27(int x) { return x * 27; }
+inline int f6768_28(int x) { return x * 28; }
+inline int f6768_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6770 */
+#include <vector>
+#include "h9223.h"
+#include "h285.h"
+#include "h7737.h"
+#include "h1297.h"
+#include "h3982.h"
+#ifdef X
+#include "h4004.h"
+#endif
+struct S6770 { int a; const char *s = "x//y"; };
+inline int f6770_0(int x) { return x * 0; }
+inline int f6770_1(int x) { return x * 1; }
+inline int f6770_2(int x) { return x * 2; }
+inline int f6770_3(int x) { return x * 3; }
+inline int f6770_4(int x) { return x * 4; }
+inline int f6770_5(int x) { return x * 5; }
+inline int f6770_6(int x) { return x * 6; }
+inline int f6770_7(int x) { return x * 7; }
+inline int f6770_8(int x) { return x * 8; }
+inline int f6770_9(int x) { return x * 9; }
+inline int f6770_10(int x) { return x * 10; }
+inline int f6770_11(int x) { return x * 11; }
+inline int f6770_12(int x) { return x * 12; }
+inline int f6770_13(int x) { return x * 13; }
+inline int f6770_14(int x) { return x * 14; }
+inline int f6770_15(int x) { return x * 15; }
+inline int f6770_16(int x) { return x * 16; }
+inline int f6770_17(int x) { return x * 17; }
+inline int f6770_18(int x) { return x * 18; }
+inline int f6770_19(int x) { return x * 19; }
+inline int f6770_20(int x) { return x * 20; }
+inline int f6770_21(int x) { return x * 21; }
+inline int f6770_22(int x) { return x * 22; }
+inline int f6770_23(int x) { return x * 23; }
+inline int f6770_24(int x) { return x * 24; }
+inline int f6770_25(int x) { return x * 25; }
+inline int f6770_26(int x) { return x * 26; }
+inline int f6770_27(int x) { return x * 27; }
+inline int f6770_28(int x) { return x * 28; }
+inline int f6770_29(int x) { return x * 29; }
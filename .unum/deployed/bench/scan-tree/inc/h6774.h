@@ -0,0 +1,42 @@
+#pragma once
+/* header 6774 */
+#include <vector>
+#include "h1507.h"
+#include "h1165.h"
+#include "h7568.h"
+#include "h1059.h"
+#include "h5334.h"
+#ifdef X
+#include "h3739.h"
+#endif
+struct S6774 { int a; const char *s = "x//y"; };
+inline int f6774_0(int x) { return x * 0; }
+inline int f6774_1(int x) { return x * 1; }
+inline int f6774_2(int x) { return x * 2; }
+inline int f6774_3(int x) { return x * 3; }
+inline int f6774_4(int x) { return x * 4; }
+inline int f6774_5(int x) { return x * 5; }
+inline int f6774_6(int x) { return x * 6; }
+inline int f6774_7(int x) { return x * 7; }
+inline int f6774_8(int x) { return x * 8; }
+inline int f6774_9(int x) { return x * 9; }
+inline int f6774_10(int x) { return x * 10; }
+inline int f6774_11(int x) { return x * 11; }
+inline int f6774_12(int x) { return x * 12; }
+inline int f6774_13(int x) { return x * 13; }
+inline int f6774_14(int x) { return x * 14; }
+inline int f6774_15(int x) { return x * 15; }
+inline int f6774_16(int x) { return x * 16; }
+inline int f6774_17(int x) { return x * 17; }
+inline int f6774_18(int x) { return x * 18; }
+inline int f6774_19(int x) { return x * 19; }
+inline int f6774_20(int x) { return x * 20; }
+inline int f6774_21(int x) { return x * 21; }
+inline int f6774_22(int x) { return x * 22; }
+inline int f6774_23(int x) { return x * 23; }
+inline int f6774_24(int x) { return x * 24; }
+inline int f6774_25(int x) { return x * 25; }
+inline int f6774_26(int x) { return x * 26; }
+inline int f6774_27(int x) { return x * 27; }
+inline int f6774_28(int x) { return x * 28; }
+inline int f6774_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6776 */
+#include <vector>
+#include "h5536.h"
+#include "h2109.h"
+#include "h5551.h"
+#include "h1885.h"
+#include "h3628.h"
+#ifdef X
+#include "h6036.h"
+#endif
+struct S6776 { int a; const char *s = "x//y"; };
+inline int f6776_0(int x) { return x * 0; }
+inline int f6776_1(int x) { return x * 1; }
+inline int f6776_2(int x) { return x * 2; }
+inline int f6776_3(int x) { return x * 3; }
+inline int f6776_4(int x) { return x * 4; }
+inline int f6776_5(int x) { return x * 5; }
+inline int f6776_6(int x) { return x * 6; }
+inline int f6776_7(int x) { return x * 7; }
+inline int f6776_8(int x) { return x * 8; }
+inline int f6776_9(int x) { return x * 9; }
+inline int f6776_10(int x) { return x * 10; }
+inline int f6776_11(int x) { return x * 11; }
+inline int f6776_12(int x) { return x * 12; }
+inline int f6776_13(int x) { return x * 13; }
+inline int f6776_14(int x) { return x * 14; }
+inline int f6776_15(int x) { return x * 15; }
+inline int f6776_16(int x) { return x * 16; }
+inline int f6776_17(int x) { return x * 17; }
+inline int f6776_18(int x) { return x * 18; }
+inline int f6776_19(int x) { return x * 19; }
+inline int f6776_20(int x) { return x * 20; }
+inline int f6776_21(int x) { return x * 21; }
+inline int f6776_22(int x) { return x * 22; }
+inline int f6776_23(int x) { return x * 23; }
+inline int f6776_24(int x) { return x * 24; }
+inline int f6776_25(int x) { return x * 25; }
+inline int f6776_26(int x) { return x * 26; }
+inline int f6776_27(int x) { return x * 27; }
+inline int f6776_28(int x) { return x * 28; }
+inline int f6776_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 678 */
+#include <vector>
+#include "h66.h"
+#include "h6010.h"
+#include "h7968.h"
+#include "h4434.h"
+#include "h8470.h"
+#ifdef X
+#include "h7721.h"
+#endif
+struct S678 { int a; const char *s = "x//y"; };
+inline int f678_0(int x) { return x * 0; }
+inline int f678_1(int x) { return x * 1; }
+inline int f678_2(int x) { return x * 2; }
+inline int f678_3(int x) { return x * 3; }
+inline int f678_4(int x) { return x * 4; }
+inline int f678_5(int x) { return x * 5; }
+inline int f678_6(int x) { return x * 6; }
+inline int f678_7(int x) { return x * 7; }
+inline int f678_8(int x) { return x * 8; }
+inline int f678_9(int x) { return x * 9; }
+inline int f678_10(int x) { return x * 10; }
+inline int f678_11(int x) { return x * 11; }
+inline int f678_12(int x) { return x * 12; }
+inline int f678_13(int x) { return x * 13; }
+inline int f678_14(int x) { return x * 14; }
+inline int f678_15(int x) { return x * 15; }
+inline int f678_16(int x) { return x * 16; }
+inline int f678_17(int x) { return x * 17; }
+inline int f678_18(int x) { return x * 18; }
+inline int f678_19(int x) { return x * 19; }
+inline int f678_20(int x) { return x * 20; }
+inline int f678_21(int x) { return x * 21; }
+inline int f678_22(int x) { return x * 22; }
+inline int f678_23(int x) { return x * 23; }
+inline int f678_24(int x) { return x * 24; }
+inline int f678_25(int x) { return x * 25; }
+inline int f678_26(int x) { return x * 26; }
+inline int f678_27(int x) { return x * 27; }
+inline int f678_28(int x) { return x * 28; }
+inline int f678_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6780 */
+#include <vector>
+#include "h1076.h"
+#include "h3716.h"
+#include "h7000.h"
+#include "h6269.h"
+#include "h8985.h"
+#ifdef X
+#include "h7237.h"
+#endif
+struct S6780 { int a; const char *s = "x//y"; };
+inline int f6780_0(int x) { return x * 0; }
+inline int f6780_1(int x) { return x * 1; }
+inline int f6780_2(int x) { return x * 2; }
+inline int f6780_3(int x) { return x * 3; }
+inline int f6780_4(int x) { return x * 4; }
+inline int f6780_5(int x) { return x * 5; }
+inline int f6780_6(int x) { return x * 6; }
+inline int f6780_7(int x) { return x * 7; }
+inline int f6780_8(int x) { return x * 8; }
+inline int f6780_9(int x) { return x * 9; }
+inline int f6780_10(int x) { return x * 10; }
+inline int f6780_11(int x) { return x * 11; }
+inline int f6780_12(int x) { return x * 12; }
+inline int f6780_13(int x) { return x * 13; }
+inline int f6780_14(int x) { return x * 14; }
+inline int f6780_15(int x) { return x * 15; }
+inline int f6780_16(int x) { return x * 16; }
+inline int f6780_17(int x) { return x * 17; }
+inline int f6780_18(int x) { return x * 18; }
+inline int f6780_19(int x) { return x * 19; }
+inline int f6780_20(int x) { return x * 20; }
+inline int f6780_21(int x) { return x * 21; }
+inline int f6780_22(int x) { return x * 22; }
+inline int f6780_23(int x) { return x * 23; }
+inline int f6780_24(int x) { return x * 24; }
+inline int f6780_25(int x) { return x * 25; }
+inline int f6780_26(int x) { return x * 26; }
+inline int f6780_27(int x) { return x * 27; }
+inline int f6780_28(int x) { return x * 28; }
+inline int f6780_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6782 */
+#include <vector>
+#include "h5257.h"
+#include "h6203.h"
+#include "h812.h"
+#include "h2323.h"
+#include "h1425.h"
+#ifdef X
+#include "h2501.h"
+#endif
+struct S6782 { int a; const char *s = "x//y"; };
+inline int f6782_0(int x) { return x * 0; }
+inline int f6782_1(int x) { return x * 1; }
+inline int f6782_2(int x) { return x * 2; }
+inline int f6782_3(int x) { return x * 3; }
+inline int f6782_4(int x) { return x * 4; }
+inline int f6782_5(int x) { return x * 5; }
+inline int f6782_6(int x) { return x * 6; }
+inline int f6782_7(int x) { return x * 7; }
+inline int f6782_8(int x) { return x * 8; }
+inline int f6782_9(int x) { return x * 9; }
+inline int f6782_10(int x) { return x * 10; }
+inline int f6782_11(int x) { return x * 11; }
+inline int f6782_12(int x) { return x * 12; }
+inline int f6782_13(int x) { return x * 13; }
+inline int f6782_14(int x) { return x * 14; }
+inline int f6782_15(int x) { return x * 15; }
+inline int f6782_16(int x) { return x * 16; }
+inline int f6782_17(int x) { return x * 17; }
+inline int f6782_18(int x) { return x * 18; }
+inline int f6782_19(int x) { return x * 19; }
+inline int f6782_20(int x) { return x * 20; }
+inline int f6782_21(int x) { return x * 21; }
+inline int f6782_22(int x) { return x * 22; }
+inline int f6782_23(int x) { return x * 23; }
+inline int f6782_24(int x) { return x * 24; }
+inline int f6782_25(int x) { return x * 25; }
+inline int f6782_26(int x) { return x * 26; }
+inline int f6782_27(int x) { return x * 27; }
+inline int f6782_28(int x) { return x * 28; }
+inline int f6782_29(int x) { return x * 29; }
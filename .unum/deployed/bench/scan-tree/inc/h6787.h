@@ -0,0 +1,42 @@
+#pragma once
+/* header 6787 */
+#include <vector>
+#include "h3162.h"
+#include "h8149.h"
+#include "h623.h"
+#include "h7036.h"
+#include "h8849.h"
+#ifdef X
+#include "h6264.h"
+#endif
+struct S6787 { int a; const char *s = "x//y"; };
+inline int f6787_0(int x) { return x * 0; }
+inline int f6787_1(int x) { return x * 1; }
+inline int f6787_2(int x) { return x * 2; }
+inline int f6787_3(int x) { return x * 3; }
+inline int f6787_4(int x) { return x * 4; }
+inline int f6787_5(int x) { return x * 5; }
+inline int f6787_6(int x) { return x * 6; }
+inline int f6787_7(int x) { return x * 7; }
+inline int f6787_8(int x) { return x * 8; }
+inline int f6787_9(int x) { return x * 9; }
+inline int f6787_10(int x) { return x * 10; }
+inline int f6787_11(int x) { return x * 11; }
+inline int f6787_12(int x) { return x * 12; }
+inline int f6787_13(int x) { return x * 13; }
+inline int f6787_14(int x) { return x * 14; }
+inline int f6787_15(int x) { return x * 15; }
+inline int f6787_16(int x) { return x * 16; }
+inline int f6787_17(int x) { return x * 17; }
+inline int f6787_18(int x) { return x * 18; }
+inline int f6787_19(int x) { return x * 19; }
+inline int f6787_20(int x) { return x * 20; }
+inline int f6787_21(int x) { return x * 21; }
+inline int f6787_22(int x) { return x * 22; }
+inline int f6787_23(int x) { return x * 23; }
+inline int f6787_24(int x) { return x * 24; }
+inline int f6787_25(int x) { return x * 25; }
+inline int f6787_26(int x) { return x * 26; }
+inline int f6787_27(int x) { return x * 27; }
+inline int f6787_28(int x) { return x * 28; }
+inline int f6787_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6789 */
+#include <vector>
+#include "h2428.h"
+#include "h3820.h"
+#include "h8173.h"
+#include "h971.h"
+#include "h6678.h"
+#ifdef X
+#include "h1621.h"
+#endif
+struct S6789 { int a; const char *s = "x//y"; };
+inline int f6789_0(int x) { return x * 0; }
+inline int f6789_1(int x) { return x * 1; }
+inline int f6789_2(int x) { return x * 2; }
+inline int f6789_3(int x) { return x * 3; }
+inline int f6789_4(int x) { return x * 4; }
+inline int f6789_5(int x) { return x * 5; }
+inline int f6789_6(int x) { return x * 6; }
+inline int f6789_7(int x) { return x * 7; }
+inline int f6789_8(int x) { return x * 8; }
+inline int f6789_9(int x) { return x * 9; }
+inline int f6789_10(int x) { return x * 10; }
+inline int f6789_11(int x) { return x * 11; }
+inline int f6789_12(int x) { return x * 12; }
+inline int f6789_13(int x) { return x * 13; }
+inline int f6789_14(int x) { return x * 14; }
+inline int f6789_15(int x) { return x * 15; }
+inline int f6789_16(int x) { return x * 16; }
+inline int f6789_17(int x) { return x * 17; }
+inline int f6789_18(int x) { return x * 18; }
+inline int f6789_19(int x) { return x * 19; }
+inline int f6789_20(int x) { return x * 20; }
+inline int f6789_21(int x) { return x * 21; }
+inline int f6789_22(int x) { return x * 22; }
+inline int f6789_23(int x) { return x * 23; }
+inline int f6789_24(int x) { return x * 24; }
+inline int f6789_25(int x) { return x * 25; }
+inline int f6789_26(int x) { return x * 26; }
+inline int f6789_27(int x) { return x * 27; }
+inline int f6789_28(int x) { return x * 28; }
+inline int f6789_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6791 */
+#include <vector>
+#include "h9959.h"
+#include "h2262.h"
+#include "h5181.h"
+#include "h5183.h"
+#include "h918.h"
+#ifdef X
+#include "h6422.h"
+#endif
+struct S6791 { int a; const char *s = "x//y"; };
+inline int f6791_0(int x) { return x * 0; }
+inline int f6791_1(int x) { return x * 1; }
+inline int f6791_2(int x) { return x * 2; }
+inline int f6791_3(int x) { return x * 3; }
+inline int f6791_4(int x) { return x * 4; }
+inline int f6791_5(int x) { return x * 5; }
+inline int f6791_6(int x) { return x * 6; }
+inline int f6791_7(int x) { return x * 7; }
+inline int f6791_8(int x) { return x * 8; }
+inline int f6791_9(int x) { return x * 9; }
+inline int f6791_10(int x) { return x * 10; }
+inline int f6791_11(int x) { return x * 11; }
+inline int f6791_12(int x) { return x * 12; }
+inline int f6791_13(int x) { return x * 13; }
+inline int f6791_14(int x) { return x * 14; }
+inline int f6791_15(int x) { return x * 15; }
+inline int f6791_16(int x) { return x * 16; }
+inline int f6791_17(int x) { return x * 17; }
+inline int f6791_18(int x) { return x * 18; }
+inline int f6791_19(int x) { return x * 19; }
+inline int f6791_20(int x) { return x * 20; }
+inline int f6791_21(int x) { return x * 21; }
+inline int f6791_22(int x) { return x * 22; }
+inline int f6791_23(int x) { return x * 23; }
+inline int f6791_24(int x) { return x * 24; }
+inline int f6791_25(int x) { return x * 25; }
+inline int f6791_26(int x) { return x * 26; }
+inline int f6791_27(int x) { return x * 27; }
+inline int f6791_28(int x) { return x * 28; }
+inline int f6791_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6792 */
+#include <vector>
+#include "h2677.h"
+#include "h6993.h"
+#include "h1432.h"
+#include "h4214.h"
+#include "h4344.h"
+#ifdef X
+#include "h4151.h"
+#endif
+struct S6792 { int a; const char *s = "x//y"; };
+inline int f6792_0(int x) { return x * 0; }
+inline int f6792_1(int x) { return x * 1; }
+inline int f6792_2(int x) { return x * 2; }
+inline int f6792_3(int x) { return x * 3; }
+inline int f6792_4(int x) { return x * 4; }
+inline int f6792_5(int x) { return x * 5; }
+inline int f6792_6(int x) { return x * 6; }
+inline int f6792_7(int x) { return x * 7; }
+inline int f6792_8(int x) { return x * 8; }
+inline int f6792_9(int x) { return x * 9; }
+inline int f6792_10(int x) { return x * 10; }
+inline int f6792_11(int x) { return x * 11; }
+inline int f6792_12(int x) { return x * 12; }
+inline int f6792_13(int x) { return x * 13; }
+inline int f6792_14(int x) { return x * 14; }
+inline int f6792_15(int x) { return x * 15; }
+inline int f6792_16(int x) { return x * 16; }
+inline int f6792_17(int x) { return x * 17; }
+inline int f6792_18(int x) { return x * 18; }
+inline int f6792_19(int x) { return x * 19; }
+inline int f6792_20(int x) { return x * 20; }
+inline int f6792_21(int x) { return x * 21; }
+inline int f6792_22(int x) { return x * 22; }
+inline int f6792_23(int x) { return x * 23; }
+inline int f6792_24(int x) { return x * 24; }
+inline int f6792_25(int x) { return x * 25; }
+inline int f6792_26(int x) { return x * 26; }
+inline int f6792_27(int x) { return x * 27; }
+inline int f6792_28(int x) { return x * 28; }
+inline int f6792_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 68 */
+#include <vector>
+#include "h3664.h"
+#include "h1298.h"
+#include "h1190.h"
+#include "h9939.h"
+#include "h7021.h"
+#ifdef X
+#include "h6214.h"
+#endif
+struct S68 { int a; const char *s = "x//y"; };
+inline int f68_0(int x) { return x * 0; }
+inline int f68_1(int x) { return x * 1; }
+inline int f68_2(int x) { return x * 2; }
+inline int f68_3(int x) { return x * 3; }
+inline int f68_4(int x) { return x * 4; }
+inline int f68_5(int x) { return x * 5; }
+inline int f68_6(int x) { return x * 6; }
+inline int f68_7(int x) { return x * 7; }
+inline int f68_8(int x) { return x * 8; }
+inline int f68_9(int x) { return x * 9; }
+inline int f68_10(int x) { return x * 10; }
+inline int f68_11(int x) { return x * 11; }
+inline int f68_12(int x) { return x * 12; }
+inline int f68_13(int x) { return x * 13; }
+inline int f68_14(int x) { return x * 14; }
+inline int f68_15(int x) { return x * 15; }
+inline int f68_16(int x) { return x * 16; }
+inline int f68_17(int x) { return x * 17; }
+inline int f68_18(int x) { return x * 18; }
+inline int f68_19(int x) { return x * 19; }
+inline int f68_20(int x) { return x * 20; }
+inline int f68_21(int x) { return x * 21; }
+inline int f68_22(int x) { return x * 22; }
+inline int f68_23(int x) { return x * 23; }
+inline int f68_24(int x) { return x * 24; }
+inline int f68_25(int x) { return x * 25; }
+inline int f68_26(int x) { return x * 26; }
+inline int f68_27(int x) { return x * 27; }
+inline int f68_28(int x) { return x * 28; }
+inline int f68_29(int x) { return x * 29; }
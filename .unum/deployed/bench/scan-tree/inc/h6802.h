@@ -0,0 +1,42 @@
+#pragma once
+/* header 6802 */
+#include <vector>
+#include "h9511.h"
+#include "h1783.h"
+#include "h893.h"
+#include "h3016.h"
+#include "h6400.h"
+#ifdef X
+#include "h5761.h"
+#endif
+struct S6802 { int a; const char *s = "x//y"; };
+inline int f6802_0(int x) { return x * 0; }
+inline int f6802_1(int x) { return x * 1; }
+inline int f6802_2(int x) { return x * 2; }
+inline int f6802_3(int x) { return x * 3; }
+inline int f6802_4(int x) { return x * 4; }
+inline int f6802_5(int x) { return x * 5; }
+inline int f6802_6(int x) { return x * 6; }
+inline int f6802_7(int x) { return x * 7; }
+inline int f6802_8(int x) { return x * 8; }
+inline int f6802_9(int x) { return x * 9; }
+inline int f6802_10(int x) { return x * 10; }
+inline int f6802_11(int x) { return x * 11; }
+inline int f6802_12(int x) { return x * 12; }
+inline int f6802_13(int x) { return x * 13; }
+inline int f6802_14(int x) { return x * 14; }
+inline int f6802_15(int x) { return x * 15; }
+inline int f6802_16(int x) { return x * 16; }
+inline int f6802_17(int x) { return x * 17; }
+inline int f6802_18(int x) { return x * 18; }
+inline int f6802_19(int x) { return x * 19; }
+inline int f6802_20(int x) { return x * 20; }
+inline int f6802_21(int x) { return x * 21; }
+inline int f6802_22(int x) { return x * 22; }
+inline int f6802_23(int x) { return x * 23; }
+inline int f6802_24(int x) { return x * 24; }
+inline int f6802_25(int x) { return x * 25; }
+inline int f6802_26(int x) { return x * 26; }
+inline int f6802_27(int x) { return x * 27; }
+inline int f6802_28(int x) { return x * 28; }
+inline int f6802_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 681 */
+#include <vector>
+#include "h2420.h"
+#include "h1895.h"
+#include "h4134.h"
+#include "h3390.h"
+#include "h263.h"
+#ifdef X
+#include "h5874.h"
+#endif
+struct S681 { int a; const char *s = "x//y"; };
+inline int f681_0(int x) { return x * 0; }
+inline int f681_1(int x) { return x * 1; }
+inline int f681_2(int x) { return x * 2; }
+inline int f681_3(int x) { return x * 3; }
+inline int f681_4(int x) { return x * 4; }
+inline int f681_5(int x) { return x * 5; }
+inline int f681_6(int x) { return x * 6; }
+inline int f681_7(int x) { return x * 7; }
+inline int f681_8(int x) { return x * 8; }
+inline int f681_9(int x) { return x * 9; }
+inline int f681_10(int x) { return x * 10; }
+inline int f681_11(int x) { return x * 11; }
+inline int f681_12(int x) { return x * 12; }
+inline int f681_13(int x) { return x * 13; }
+inline int f681_14(int x) { return x * 14; }
+inline int f681_15(int x) { return x * 15; }
+inline int f681_16(int x) { return x * 16; }
+inline int f681_17(int x) { return x * 17; }
+inline int f681_18(int x) { return x * 18; }
+inline int f681_19(int x) { return x * 19; }
+inline int f681_20(int x) { return x * 20; }
+inline int f681_21(int x) { return x * 21; }
+inline int f681_22(int x) { return x * 22; }
+inline int f681_23(int x) { return x * 23; }
+inline int f681_24(int x) { return x * 24; }
+inline int f681_25(int x) { return x * 25; }
+inline int f681_26(int x) { return x * 26; }
+inline int f681_27(int x) { return x * 27; }
+inline int f681_28(int x) { return x * 28; }
+inline int f681_29(int x) { return x * 29; }
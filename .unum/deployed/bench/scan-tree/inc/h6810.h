@@ -0,0 +1,42 @@
+#pragma once
+/* header 6810 */
+#include <vector>
+#include "h3952.h"
+#include "h9956.h"
+#include "h5627.h"
+#include "h3745.h"
+#include "h6403.h"
+#ifdef X
+#include "h7989.h"
+#endif
+struct S6810 { int a; const char *s = "x//y"; };
+inline int f6810_0(int x) { return x * 0; }
+inline int f6810_1(int x) { return x * 1; }
+inline int f6810_2(int x) { return x * 2; }
+inline int f6810_3(int x) { return x * 3; }
+inline int f6810_4(int x) { return x * 4; }
+inline int f6810_5(int x) { return x * 5; }
+inline int f6810_6(int x) { return x * 6; }
+inline int f6810_7(int x) { return x * 7; }
+inline int f6810_8(int x) { return x * 8; }
+inline int f6810_9(int x) { return x * 9; }
+inline int f6810_10(int x) { return x * 10; }
+inline int f6810_11(int x) { return x * 11; }
+inline int f6810_12(int x) { return x * 12; }
+inline int f6810_13(int x) { return x * 13; }
+inline int f6810_14(int x) { return x * 14; }
+inline int f6810_15(int x) { return x * 15; }
+inline int f6810_16(int x) { return x * 16; }
+inline int f6810_17(int x) { return x * 17; }
+inline int f6810_18(int x) { return x * 18; }
+inline int f6810_19(int x) { return x * 19; }
+inline int f6810_20(int x) { return x * 20; }
+inline int f6810_21(int x) { return x * 21; }
+inline int f6810_22(int x) { return x * 22; }
+inline int f6810_23(int x) { return x * 23; }
+inline int f6810_24(int x) { return x * 24; }
+inline int f6810_25(int x) { return x * 25; }
+inline int f6810_26(int x) { return x * 26; }
+inline int f6810_27(int x) { return x * 27; }
+inline int f6810_28(int x) { return x * 28; }
+inline int f6810_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6811 */
+#include <vector>
+#include "h7000.h"
+#include "h2902.h"
+#include "h7254.h"
+#include "h3854.h"
+#include "h8069.h"
+#ifdef X
+#include "h5608.h"
+#endif
+struct S6811 { int a; const char *s = "x//y"; };
+inline int f6811_0(int x) { return x * 0; }
+inline int f6811_1(int x) { return x * 1; }
+inline int f6811_2(int x) { return x * 2; }
+inline int f6811_3(int x) { return x * 3; }
+inline int f6811_4(int x) { return x * 4; }
+inline int f6811_5(int x) { return x * 5; }
+inline int f6811_6(int x) { return x * 6; }
+inline int f6811_7(int x) { return x * 7; }
+inline int f6811_8(int x) { return x * 8; }
+inline int f6811_9(int x) { return x * 9; }
+inline int f6811_10(int x) { return x * 10; }
+inline int f6811_11(int x) { return x * 11; }
+inline int f6811_12(int x) { return x * 12; }
+inline int f6811_13(int x) { return x * 13; }
+inline int f6811_14(int x) { return x * 14; }
+inline int f6811_15(int x) { return x * 15; }
+inline int f6811_16(int x) { return x * 16; }
+inline int f6811_17(int x) { return x * 17; }
+inline int f6811_18(int x) { return x * 18; }
+inline int f6811_19(int x) { return x * 19; }
+inline int f6811_20(int x) { return x * 20; }
+inline int f6811_21(int x) { return x * 21; }
+inline int f6811_22(int x) { return x * 22; }
+inline int f6811_23(int x) { return x * 23; }
+inline int f6811_24(int x) { return x * 24; }
+inline int f6811_25(int x) { return x * 25; }
+inline int f6811_26(int x) { return x * 26; }
+inline int f6811_27(int x) { return x * 27; }
+inline int f6811_28(int x) { return x * 28; }
+inline int f6811_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6813 */
+#include <vector>
+#include "h5543.h"
+#include "h2627.h"
+#include "h6079.h"
+#include "h4793.h"
+#include "h19.h"
+#ifdef X
+#include "h1389.h"
+#endif
+struct S6813 { int a; const char *s = "x//y"; };
+inline int f6813_0(int x) { return x * 0; }
+inline int f6813_1(int x) { return x * 1; }
+inline int f6813_2(int x) { return x * 2; }
+inline int f6813_3(int x) { return x * 3; }
+inline int f6813_4(int x) { return x * 4; }
+inline int f6813_5(int x) { return x * 5; }
+inline int f6813_6(int x) { return x * 6; }
+inline int f6813_7(int x) { return x * 7; }
+inline int f6813_8(int x) { return x * 8; }
+inline int f6813_9(int x) { return x * 9; }
+inline int f6813_10(int x) { return x * 10; }
+inline int f6813_11(int x) { return x * 11; }
+inline int f6813_12(int x) { return x * 12; }
+inline int f6813_13(int x) { return x * 13; }
+inline int f6813_14(int x) { return x * 14; }
+inline int f6813_15(int x) { return x * 15; }
+inline int f6813_16(int x) { return x * 16; }
+inline int f6813_17(int x) { return x * 17; }
+inline int f6813_18(int x) { return x * 18; }
+inline int f6813_19(int x) { return x * 19; }
+inline int f6813_20(int x) { return x * 20; }
+inline int f6813_21(int x) { return x * 21; }
+inline int f6813_22(int x) { return x * 22; }
+inline int f6813_23(int x) { return x * 23; }
+inline int f6813_24(int x) { return x * 24; }
+inline int f6813_25(int x) { return x * 25; }
+inline int f6813_26(int x) { return x * 26; }
+inline int f6813_27(int x) { return x * 27; }
+inline int f6813_28(int x) { return x * 28; }
+inline int f6813_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6814 */
+#include <vector>
+#include "h2656.h"
+#include "h9886.h"
+#include "h1528.h"
+#include "h6661.h"
+#include "h320.h"
+#ifdef X
+#include "h2187.h"
+#endif
+struct S6814 { int a; const char *s = "x//y"; };
+inline int f6814_0(int x) { return x * 0; }
+inline int f6814_1(int x) { return x * 1; }
+inline int f6814_2(int x) { return x * 2; }
+inline int f6814_3(int x) { return x * 3; }
+inline int f6814_4(int x) { return x * 4; }
+inline int f6814_5(int x) { return x * 5; }
+inline int f6814_6(int x) { return x * 6; }
+inline int f6814_7(int x) { return x * 7; }
+inline int f6814_8(int x) { return x * 8; }
+inline int f6814_9(int x) { return x * 9; }
+inline int f6814_10(int x) { return x * 10; }
+inline int f6814_11(int x) { return x * 11; }
+inline int f6814_12(int x) { return x * 12; }
+inline int f6814_13(int x) { return x * 13; }
+inline int f6814_14(int x) { return x * 14; }
+inline int f6814_15(int x) { return x * 15; }
+inline int f6814_16(int x) { return x * 16; }
+inline int f6814_17(int x) { return x * 17; }
+inline int f6814_18(int x) { return x * 18; }
+inline int f6814_19(int x) { return x * 19; }
+inline int f6814_20(int x) { return x * 20; }
+inline int f6814_21(int x) { return x * 21; }
+inline int f6814_22(int x) { return x * 22; }
+inline int f6814_23(int x) { return x * 23; }
+inline int f6814_24(int x) { return x * 24; }
+inline int f6814_25(int x) { return x * 25; }
+inline int f6814_26(int x) { return x * 26; }
+inline int f6814_27(int x) { return x * 27; }
+inline int f6814_28(int x) { return x * 28; }
+inline int f6814_29(int x) { return x * 29; }
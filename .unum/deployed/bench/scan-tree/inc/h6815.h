@@ -0,0 +1,42 @@
+#pragma once
+/* header 6815 */
+#include <vector>
+#include "h1431.h"
+#include "h5869.h"
+#include "h9787.h"
+#include "h1626.h"
+#include "h4948.h"
+#ifdef X
+#include "h7308.h"
+#endif
+struct S6815 { int a; const char *s = "x//y"; };
+inline int f6815_0(int x) { return x * 0; }
+inline int f6815_1(int x) { return x * 1; }
+inline int f6815_2(int x) { return x * 2; }
+inline int f6815_3(int x) { return x * 3; }
+inline int f6815_4(int x) { return x * 4; }
+inline int f6815_5(int x) { return x * 5; }
+inline int f6815_6(int x) { return x * 6; }
+inline int f6815_7(int x) { return x * 7; }
+inline int f6815_8(int x) { return x * 8; }
+inline int f6815_9(int x) { return x * 9; }
+inline int f6815_10(int x) { return x * 10; }
+inline int f6815_11(int x) { return x * 11; }
+inline int f6815_12(int x) { return x * 12; }
+inline int f6815_13(int x) { return x * 13; }
+inline int f6815_14(int x) { return x * 14; }
+inline int f6815_15(int x) { return x * 15; }
+inline int f6815_16(int x) { return x * 16; }
+inline int f6815_17(int x) { return x * 17; }
+inline int f6815_18(int x) { return x * 18; }
+inline int f6815_19(int x) { return x * 19; }
+inline int f6815_20(int x) { return x * 20; }
+inline int f6815_21(int x) { return x * 21; }
+inline int f6815_22(int x) { return x * 22; }
+inline int f6815_23(int x) { return x * 23; }
+inline int f6815_24(int x) { return x * 24; }
+inline int f6815_25(int x) { return x * 25; }
+inline int f6815_26(int x) { return x * 26; }
+inline int f6815_27(int x) { return x * 27; }
+inline int f6815_28(int x) { return x * 28; }
+inline int f6815_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6819 */
+#include <vector>
+#include "h5381.h"
+#include "h922.h"
+#include "h5704.h"
+#include "h4343.h"
+#include "h6709.h"
+#ifdef X
+#include "h2060.h"
+#endif
+struct S6819 { int a; const char *s = "x//y"; };
+inline int f6819_0(int x) { return x * 0; }
+inline int f6819_1(int x) { return x * 1; }
+inline int f6819_2(int x) { return x * 2; }
+inline int f6819_3(int x) { return x * 3; }
+inline int f6819_4(int x) { return x * 4; }
+inline int f6819_5(int x) { return x * 5; }
+inline int f6819_6(int x) { return x * 6; }
+inline int f6819_7(int x) { return x * 7; }
+inline int f6819_8(int x) { return x * 8; }
+inline int f6819_9(int x) { return x * 9; }
+inline int f6819_10(int x) { return x * 10; }
+inline int f6819_11(int x) { return x * 11; }
+inline int f6819_12(int x) { return x * 12; }
+inline int f6819_13(int x) { return x * 13; }
+inline int f6819_14(int x) { return x * 14; }
+inline int f6819_15(int x) { return x * 15; }
+inline int f6819_16(int x) { return x * 16; }
+inline int f6819_17(int x) { return x * 17; }
+inline int f6819_18(int x) { return x * 18; }
+inline int f6819_19(int x) { return x * 19; }
+inline int f6819_20(int x) { return x * 20; }
+inline int f6819_21(int x) { return x * 21; }
+inline int f6819_22(int x) { return x * 22; }
+inline int f6819_23(int x) { return x * 23; }
+inline int f6819_24(int x) { return x * 24; }
+inline int f6819_25(int x) { return x * 25; }
+inline int f6819_26(int x) { return x * 26; }
+inline int f6819_27(int x) { return x * 27; }
+inline int f6819_28(int x) { return x * 28; }
+inline int f6819_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6820 */
+#include <vector>
+#include "h4249.h"
+#include "h3616.h"
+#include "h6568.h"
+#include "h5367.h"
+#include "h6372.h"
+#ifdef X
+#include "h8742.h"
+#endif
+struct S6820 { int a; const char *s = "x//y"; };
+inline int f6820_0(int x) { return x * 0; }
+inline int f6820_1(int x) { return x * 1; }
+inline int f6820_2(int x) { return x * 2; }
+inline int f6820_3(int x) { return x * 3; }
+inline int f6820_4(int x) { return x * 4; }
+inline int f6820_5(int x) { return x * 5; }
+inline int f6820_6(int x) { return x * 6; }
+inline int f6820_7(int x) { return x * 7; }
+inline int f6820_8(int x) { return x * 8; }
+inline int f6820_9(int x) { return x * 9; }
+inline int f6820_10(int x) { return x * 10; }
+inline int f6820_11(int x) { return x * 11; }
+inline int f6820_12(int x) { return x * 12; }
+inline int f6820_13(int x) { return x * 13; }
+inline int f6820_14(int x) { return x * 14; }
+inline int f6820_15(int x) { return x * 15; }
+inline int f6820_16(int x) { return x * 16; }
+inline int f6820_17(int x) { return x * 17; }
+inline int f6820_18(int x) { return x * 18; }
+inline int f6820_19(int x) { return x * 19; }
+inline int f6820_20(int x) { return x * 20; }
+inline int f6820_21(int x) { return x * 21; }
+inline int f6820_22(int x) { return x * 22; }
+inline int f6820_23(int x) { return x * 23; }
+inline int f6820_24(int x) { return x * 24; }
+inline int f6820_25(int x) { return x * 25; }
+inline int f6820_26(int x) { return x * 26; }
+inline int f6820_27(int x) { return x * 27; }
+inline int f6820_28(int x) { return x * 28; }
+inline int f6820_29(int x) { return x * 29; }
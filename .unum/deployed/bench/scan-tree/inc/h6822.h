@@ -0,0 +1,42 @@
+#pragma once
+/* header 6822 */
+#include <vector>
+#include "h1625.h"
+#include "h5648.h"
+#include "h4755.h"
+#include "h9575.h"
+#include "h1569.h"
+#ifdef X
+#include "h291.h"
+#endif
+struct S6822 { int a; const char *s = "x//y"; };
+inline int f6822_0(int x) { return x * 0; }
+inline int f6822_1(int x) { return x * 1; }
+inline int f6822_2(int x) { return x * 2; }
+inline int f6822_3(int x) { return x * 3; }
+inline int f6822_4(int x) { return x * 4; }
+inline int f6822_5(int x) { return x * 5; }
+inline int f6822_6(int x) { return x * 6; }
+inline int f6822_7(int x) { return x * 7; }
+inline int f6822_8(int x) { return x * 8; }
+inline int f6822_9(int x) { return x * 9; }
+inline int f6822_10(int x) { return x * 10; }
+inline int f6822_11(int x) { return x * 11; }
+inline int f6822_12(int x) { return x * 12; }
+inline int f6822_13(int x) { return x * 13; }
+inline int f6822_14(int x) { return x * 14; }
+inline int f6822_15(int x) { return x * 15; }
+inline int f6822_16(int x) { return x * 16; }
+inline int f6822_17(int x) { return x * 17; }
+inline int f6822_18(int x) { return x * 18; }
+inline int f6822_19(int x) { return x * 19; }
+inline int f6822_20(int x) { return x * 20; }
+inline int f6822_21(int x) { return x * 21; }
+inline int f6822_22(int x) { return x * 22; }
+inline int f6822_23(int x) { return x * 23; }
+inline int f6822_24(int x) { return x * 24; }
+inline int f6822_25(int x) { return x * 25; }
+inline int f6822_26(int x) { return x * 26; }
+inline int f6822_27(int x) { return x * 27; }
+inline int f6822_28(int x) { return x * 28; }
+inline int f6822_29(int x) { return x * 29; }
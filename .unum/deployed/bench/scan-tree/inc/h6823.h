@@ -0,0 +1,42 @@
+#pragma once
+/* header 6823 */
+#include <vector>
+#include "h11.h"
+#include "h6575.h"
+#include "h4095.h"
+#include "h2286.h"
+#include "h8050.h"
+#ifdef X
+#include "h3965.h"
+#endif
+struct S6823 { int a; const char *s = "x//y"; };
+inline int f6823_0(int x) { return x * 0; }
+inline int f6823_1(int x) { return x * 1; }
+inline int f6823_2(int x) { return x * 2; }
+inline int f6823_3(int x) { return x * 3; }
+inline int f6823_4(int x) { return x * 4; }
+inline int f6823_5(int x) { return x * 5; }
+inline int f6823_6(int x) { return x * 6; }
+inline int f6823_7(int x) { return x * 7; }
+inline int f6823_8(int x) { return x * 8; }
+inline int f6823_9(int x) { return x * 9; }
+inline int f6823_10(int x) { return x * 10; }
+inline int f6823_11(int x) { return x * 11; }
+inline int f6823_12(int x) { return x * 12; }
+inline int f6823_13(int x) { return x * 13; }
+inline int f6823_14(int x) { return x * 14; }
+inline int f6823_15(int x) { return x * 15; }
+inline int f6823_16(int x) { return x * 16; }
+inline int f6823_17(int x) { return x * 17; }
+inline int f6823_18(int x) { return x * 18; }
+inline int f6823_19(int x) { return x * 19; }
+inline int f6823_20(int x) { return x * 20; }
+inline int f6823_21(int x) { return x * 21; }
+inline int f6823_22(int x) { return x * 22; }
+inline int f6823_23(int x) { return x * 23; }
+inline int f6823_24(int x) { return x * 24; }
+inline int f6823_25(int x) { return x * 25; }
+inline int f6823_26(int x) { return x * 26; }
+inline int f6823_27(int x) { return x * 27; }
+inline int f6823_28(int x) { return x * 28; }
+inline int f6823_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6826 */
+#include <vector>
+#include "h4237.h"
+#include "h4970.h"
+#include "h30.h"
+#include "h1207.h"
+#include "h4271.h"
+#ifdef X
+#include "h5232.h"
+#endif
+struct S6826 { int a; const char *s = "x//y"; };
+inline int f6826_0(int x) { return x * 0; }
+inline int f6826_1(int x) { return x * 1; }
+inline int f6826_2(int x) { return x * 2; }
+inline int f6826_3(int x) { return x * 3; }
+inline int f6826_4(int x) { return x * 4; }
+inline int f6826_5(int x) { return x * 5; }
+inline int f6826_6(int x) { return x * 6; }
+inline int f6826_7(int x) { return x * 7; }
+inline int f6826_8(int x) { return x * 8; }
+inline int f6826_9(int x) { return x * 9; }
+inline int f6826_10(int x) { return x * 10; }
+inline int f6826_11(int x) { return x * 11; }
+inline int f6826_12(int x) { return x * 12; }
+inline int f6826_13(int x) { return x * 13; }
+inline int f6826_14(int x) { return x * 14; }
+inline int f6826_15(int x) { return x * 15; }
+inline int f6826_16(int x) { return x * 16; }
+inline int f6826_17(int x) { return x * 17; }
+inline int f6826_18(int x) { return x * 18; }
+inline int f6826_19(int x) { return x * 19; }
+inline int f6826_20(int x) { return x * 20; }
+inline int f6826_21(int x) { return x * 21; }
+inline int f6826_22(int x) { return x * 22; }
+inline int f6826_23(int x) { return x * 23; }
+inline int f6826_24(int x) { return x * 24; }
+inline int f6826_25(int x) { return x * 25; }
+inline int f6826_26(int x) { return x * 26; }
+inline int f6826_27(int x) { return x * 27; }
+inline int f6826_28(int x) { return x * 28; }
+inline int f6826_29(int x) { return x * 29; }
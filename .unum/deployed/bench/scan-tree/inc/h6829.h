@@ -0,0 +1,42 @@
+#pragma once
+/* header 6829 */
+#include <vector>
+#include "h7627.h"
+#include "h1943.h"
+#include "h2520.h"
+#include "h7016.h"
+#include "h1117.h"
+#ifdef X
+#include "h5850.h"
+#endif
+struct S6829 { int a; const char *s = "x//y"; };
+inline int f6829_0(int x) { return x * 0; }
+inline int f6829_1(int x) { return x * 1; }
+inline int f6829_2(int x) { return x * 2; }
+inline int f6829_3(int x) { return x * 3; }
+inline int f6829_4(int x) { return x * 4; }
+inline int f6829_5(int x) { return x * 5; }
+inline int f6829_6(int x) { return x * 6; }
+inline int f6829_7(int x) { return x * 7; }
+inline int f6829_8(int x) { return x * 8; }
+inline int f6829_9(int x) { return x * 9; }
+inline int f6829_10(int x) { return x * 10; }
+inline int f6829_11(int x) { return x * 11; }
+inline int f6829_12(int x) { return x * 12; }
+inline int f6829_13(int x) { return x * 13; }
+inline int f6829_14(int x) { return x * 14; }
+inline int f6829_15(int x) { return x * 15; }
+inline int f6829_16(int x) { return x * 16; }
+inline int f6829_17(int x) { return x * 17; }
+inline int f6829_18(int x) { return x * 18; }
+inline int f6829_19(int x) { return x * 19; }
+inline int f6829_20(int x) { return x * 20; }
+inline int f6829_21(int x) { return x * 21; }
+inline int f6829_22(int x) { return x * 22; }
+inline int f6829_23(int x) { return x * 23; }
+inline int f6829_24(int x) { return x * 24; }
+inline int f6829_25(int x) { return x * 25; }
+inline int f6829_26(int x) { return x * 26; }
+inline int f6829_27(int x) { return x * 27; }
+inline int f6829_28(int x) { return x * 28; }
+inline int f6829_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6830 */
+#include <vector>
+#include "h7240.h"
+#include "h5067.h"
+#include "h6352.h"
+#include "h9477.h"
+#include "h3303.h"
+#ifdef X
+#include "h8280.h"
+#endif
+struct S6830 { int a; const char *s = "x//y"; };
+inline int f6830_0(int x) { return x * 0; }
+inline int f6830_1(int x) { return x * 1; }
+inline int f6830_2(int x) { return x * 2; }
+inline int f6830_3(int x) { return x * 3; }
+inline int f6830_4(int x) { return x * 4; }
+inline int f6830_5(int x) { return x * 5; }
+inline int f6830_6(int x) { return x * 6; }
+inline int f6830_7(int x) { return x * 7; }
+inline int f6830_8(int x) { return x * 8; }
+inline int f6830_9(int x) { return x * 9; }
+inline int f6830_10(int x) { return x * 10; }
+inline int f6830_11(int x) { return x * 11; }
+inline int f6830_12(int x) { return x * 12; }
+inline int f6830_13(int x) { return x * 13; }
+inline int f6830_14(int x) { return x * 14; }
+inline int f6830_15(int x) { return x * 15; }
+inline int f6830_16(int x) { return x * 16; }
+inline int f6830_17(int x) { return x * 17; }
+inline int f6830_18(int x) { return x * 18; }
+inline int f6830_19(int x) { return x * 19; }
+inline int f6830_20(int x) { return x * 20; }
+inline int f6830_21(int x) { return x * 21; }
+inline int f6830_22(int x) { return x * 22; }
+inline int f6830_23(int x) { return x * 23; }
+inline int f6830_24(int x) { return x * 24; }
+inline int f6830_25(int x) { return x * 25; }
+inline int f6830_26(int x) { return x * 26; }
+inline int f6830_27(int x) { return x * 27; }
+inline int f6830_28(int x) { return x * 28; }
+inline int f6830_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6833 */
+#include <vector>
+#include "h4892.h"
+#include "h1985.h"
+#include "h7030.h"
+#include "h6695.h"
+#include "h9940.h"
+#ifdef X
+#include "h7087.h"
+#endif
+struct S6833 { int a; const char *s = "x//y"; };
+inline int f6833_0(int x) { return x * 0; }
+inline int f6833_1(int x) { return x * 1; }
+inline int f6833_2(int x) { return x * 2; }
+inline int f6833_3(int x) { return x * 3; }
+inline int f6833_4(int x) { return x * 4; }
+inline int f6833_5(int x) { return x * 5; }
+inline int f6833_6(int x) { return x * 6; }
+inline int f6833_7(int x) { return x * 7; }
+inline int f6833_8(int x) { return x * 8; }
+inline int f6833_9(int x) { return x * 9; }
+inline int f6833_10(int x) { return x * 10; }
+inline int f6833_11(int x) { return x * 11; }
+inline int f6833_12(int x) { return x * 12; }
+inline int f6833_13(int x) { return x * 13; }
+inline int f6833_14(int x) { return x * 14; }
+inline int f6833_15(int x) { return x * 15; }
+inline int f6833_16(int x) { return x * 16; }
+inline int f6833_17(int x) { return x * 17; }
+inline int f6833_18(int x) { return x * 18; }
+inline int f6833_19(int x) { return x * 19; }
+inline int f6833_20(int x) { return x * 20; }
+inline int f6833_21(int x) { return x * 21; }
+inline int f6833_22(int x) { return x * 22; }
+inline int f6833_23(int x) { return x * 23; }
+inline int f6833_24(int x) { return x * 24; }
+inline int f6833_25(int x) { return x * 25; }
+inline int f6833_26(int x) { return x * 26; }
+inline int f6833_27(int x) { return x * 27; }
+inline int f6833_28(int x) { return x * 28; }
+inline int f6833_29(int x) { return x * 29; }
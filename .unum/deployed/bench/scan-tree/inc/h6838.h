@@ -0,0 +1,42 @@
+#pragma once
+/* header 6838 */
+#include <vector>
+#include "h6731.h"
+#include "h729.h"
+#include "h1510.h"
+#include "h7751.h"
+#include "h9523.h"
+#ifdef X
+#include "h4778.h"
+#endif
+struct S6838 { int a; const char *s = "x//y"; };
+inline int f6838_0(int x) { return x * 0; }
+inline int f6838_1(int x) { return x * 1; }
+inline int f6838_2(int x) { return x * 2; }
+inline int f6838_3(int x) { return x * 3; }
+inline int f6838_4(int x) { return x * 4; }
+inline int f6838_5(int x) { return x * 5; }
+inline int f6838_6(int x) { return x * 6; }
+inline int f6838_7(int x) { return x * 7; }
+inline int f6838_8(int x) { return x * 8; }
+inline int f6838_9(int x) { return x * 9; }
+inline int f6838_10(int x) { return x * 10; }
+inline int f6838_11(int x) { return x * 11; }
+inline int f6838_12(int x) { return x * 12; }
+inline int f6838_13(int x) { return x * 13; }
+inline int f6838_14(int x) { return x * 14; }
+inline int f6838_15(int x) { return x * 15; }
+inline int f6838_16(int x) { return x * 16; }
+inline int f6838_17(int x) { return x * 17; }
+inline int f6838_18(int x) { return x * 18; }
+inline int f6838_19(int x) { return x * 19; }
+inline int f6838_20(int x) { return x * 20; }
+inline int f6838_21(int x) { return x * 21; }
+inline int f6838_22(int x) { return x * 22; }
+inline int f6838_23(int x) { return x * 23; }
+inline int f6838_24(int x) { return x * 24; }
+inline int f6838_25(int x) { return x * 25; }
+inline int f6838_26(int x) { return x * 26; }
+inline int f6838_27(int x) { return x * 27; }
+inline int f6838_28(int x) { return x * 28; }
+inline int f6838_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6840 */
+#include <vector>
+#include "h7456.h"
+#include "h1215.h"
+#include "h7453.h"
+#include "h6764.h"
+#include "h3390.h"
+#ifdef X
+#include "h6032.h"
+#endif
+struct S6840 { int a; const char *s = "x//y"; };
+inline int f6840_0(int x) { return x * 0; }
+inline int f6840_1(int x) { return x * 1; }
+inline int f6840_2(int x) { return x * 2; }
+inline int f6840_3(int x) { return x * 3; }
+inline int f6840_4(int x) { return x * 4; }
+inline int f6840_5(int x) { return x * 5; }
+inline int f6840_6(int x) { return x * 6; }
+inline int f6840_7(int x) { return x * 7; }
+inline int f6840_8(int x) { return x * 8; }
+inline int f6840_9(int x) { return x * 9; }
+inline int f6840_10(int x) { return x * 10; }
+inline int f6840_11(int x) { return x * 11; }
+inline int f6840_12(int x) { return x * 12; }
+inline int f6840_13(int x) { return x * 13; }
+inline int f6840_14(int x) { return x * 14; }
+inline int f6840_15(int x) { return x * 15; }
+inline int f6840_16(int x) { return x * 16; }
+inline int f6840_17(int x) { return x * 17; }
+inline int f6840_18(int x) { return x * 18; }
+inline int f6840_19(int x) { return x * 19; }
+inline int f6840_20(int x) { return x * 20; }
+inline int f6840_21(int x) { return x * 21; }
+inline int f6840_22(int x) { return x * 22; }
+inline int f6840_23(int x) { return x * 23; }
+inline int f6840_24(int x) { return x * 24; }
+inline int f6840_25(int x) { return x * 25; }
+inline int f6840_26(int x) { return x * 26; }
+inline int f6840_27(int x) { return x * 27; }
+inline int f6840_28(int x) { return x * 28; }
+inline int f6840_29(int x) { return x * 29; }
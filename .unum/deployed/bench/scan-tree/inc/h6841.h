@@ -0,0 +1,42 @@
+#pragma once
+/* header 6841 */
+#include <vector>
+#include "h2988.h"
+#include "h5132.h"
+#include "h1563.h"
+#include "h5831.h"
+#include "h3925.h"
+#ifdef X
+#include "h5111.h"
+#endif
+struct S6841 { int a; const char *s = "x//y"; };
+inline int f6841_0(int x) { return x * 0; }
+inline int f6841_1(int x) { return x * 1; }
+inline int f6841_2(int x) { return x * 2; }
+inline int f6841_3(int x) { return x * 3; }
+inline int f6841_4(int x) { return x * 4; }
+inline int f6841_5(int x) { return x * 5; }
+inline int f6841_6(int x) { return x * 6; }
+inline int f6841_7(int x) { return x * 7; }
+inline int f6841_8(int x) { return x * 8; }
+inline int f6841_9(int x) { return x * 9; }
+inline int f6841_10(int x) { return x * 10; }
+inline int f6841_11(int x) { return x * 11; }
+inline int f6841_12(int x) { return x * 12; }
+inline int f6841_13(int x) { return x * 13; }
+inline int f6841_14(int x) { return x * 14; }
+inline int f6841_15(int x) { return x * 15; }
+inline int f6841_16(int x) { return x * 16; }
+inline int f6841_17(int x) { return x * 17; }
+inline int f6841_18(int x) { return x * 18; }
+inline int f6841_19(int x) { return x * 19; }
+inline int f6841_20(int x) { return x * 20; }
+inline int f6841_21(int x) { return x * 21; }
+inline int f6841_22(int x) { return x * 22; }
+inline int f6841_23(int x) { return x * 23; }
+inline int f6841_24(int x) { return x * 24; }
+inline int f6841_25(int x) { return x * 25; }
+inline int f6841_26(int x) { return x * 26; }
+inline int f6841_27(int x) { return x * 27; }
+inline int f6841_28(int x) { return x * 28; }
+inline int f6841_29(int x) { return x * 29; }
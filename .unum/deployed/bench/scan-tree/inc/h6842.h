@@ -0,0 +1,42 @@
+#pragma once
+/* header 6842 */
+#include <vector>
+#include "h1947.h"
+#include "h9807.h"
+#include "h4524.h"
+#include "h6529.h"
+#include "h646.h"
+#ifdef X
+#include "h9928.h"
+#endif
+struct S6842 { int a; const char *s = "x//y"; };
+inline int f6842_0(int x) { return x * 0; }
+inline int f6842_1(int x) { return x * 1; }
+inline int f6842_2(int x) { return x * 2; }
+inline int f6842_3(int x) { return x * 3; }
+inline int f6842_4(int x) { return x * 4; }
+inline int f6842_5(int x) { return x * 5; }
+inline int f6842_6(int x) { return x * 6; }
+inline int f6842_7(int x) { return x * 7; }
+inline int f6842_8(int x) { return x * 8; }
+inline int f6842_9(int x) { return x * 9; }
+inline int f6842_10(int x) { return x * 10; }
+inline int f6842_11(int x) { return x * 11; }
+inline int f6842_12(int x) { return x * 12; }
+inline int f6842_13(int x) { return x * 13; }
+inline int f6842_14(int x) { return x * 14; }
+inline int f6842_15(int x) { return x * 15; }
+inline int f6842_16(int x) { return x * 16; }
+inline int f6842_17(int x) { return x * 17; }
+inline int f6842_18(int x) { return x * 18; }
+inline int f6842_19(int x) { return x * 19; }
+inline int f6842_20(int x) { return x * 20; }
+inline int f6842_21(int x) { return x * 21; }
+inline int f6842_22(int x) { return x * 22; }
+inline int f6842_23(int x) { return x * 23; }
+inline int f6842_24(int x) { return x * 24; }
+inline int f6842_25(int x) { return x * 25; }
+inline int f6842_26(int x) { return x * 26; }
+inline int f6842_27(int x) { return x * 27; }
+inline int f6842_28(int x) { return x * 28; }
+inline int f6842_29(int x) { return x * 29; }
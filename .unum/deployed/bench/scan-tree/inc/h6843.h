@@ -0,0 +1,42 @@
+#pragma once
+/* header 6843 */
+#include <vector>
+#include "h9049.h"
+#include "h173.h"
+#include "h1224.h"
+#include "h7451.h"
+#include "h3019.h"
+#ifdef X
+#include "h3500.h"
+#endif
+struct S6843 { int a; const char *s = "x//y"; };
+inline int f6843_0(int x) { return x * 0; }
+inline int f6843_1(int x) { return x * 1; }
+inline int f6843_2(int x) { return x * 2; }
+inline int f6843_3(int x) { return x * 3; }
+inline int f6843_4(int x) { return x * 4; }
+inline int f6843_5(int x) { return x * 5; }
+inline int f6843_6(int x) { return x * 6; }
+inline int f6843_7(int x) { return x * 7; }
+inline int f6843_8(int x) { return x * 8; }
+inline int f6843_9(int x) { return x * 9; }
+inline int f6843_10(int x) { return x * 10; }
+inline int f6843_11(int x) { return x * 11; }
+inline int f6843_12(int x) { return x * 12; }
+inline int f6843_13(int x) { return x * 13; }
+inline int f6843_14(int x) { return x * 14; }
+inline int f6843_15(int x) { return x * 15; }
+inline int f6843_16(int x) { return x * 16; }
+inline int f6843_17(int x) { return x * 17; }
+inline int f6843_18(int x) { return x * 18; }
+inline int f6843_19(int x) { return x * 19; }
+inline int f6843_20(int x) { return x * 20; }
+inline int f6843_21(int x) { return x * 21; }
+inline int f6843_22(int x) { return x * 22; }
+inline int f6843_23(int x) { return x * 23; }
+inline int f6843_24(int x) { return x * 24; }
+inline int f6843_25(int x) { return x * 25; }
+inline int f6843_26(int x) { return x * 26; }
+inline int f6843_27(int x) { return x * 27; }
+inline int f6843_28(int x) { return x * 28; }
+inline int f6843_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6844 */
+#include <vector>
+#include "h2500.h"
+#include "h9600.h"
+#include "h8833.h"
+#include "h2133.h"
+#include "h9088.h"
+#ifdef X
+#include "h8315.h"
+#endif
+struct S6844 { int a; const char *s = "x//y"; };
+inline int f6844_0(int x) { return x * 0; }
+inline int f6844_1(int x) { return x * 1; }
+inline int f6844_2(int x) { return x * 2; }
+inline int f6844_3(int x) { return x * 3; }
+inline int f6844_4(int x) { return x * 4; }
+inline int f6844_5(int x) { return x * 5; }
+inline int f6844_6(int x) { return x * 6; }
+inline int f6844_7(int x) { return x * 7; }
+inline int f6844_8(int x) { return x * 8; }
+inline int f6844_9(int x) { return x * 9; }
+inline int f6844_10(int x) { return x * 10; }
+inline int f6844_11(int x) { return x * 11; }
+inline int f6844_12(int x) { return x * 12; }
+inline int f6844_13(int x) { return x * 13; }
+inline int f6844_14(int x) { return x * 14; }
+inline int f6844_15(int x) { return x * 15; }
+inline int f6844_16(int x) { return x * 16; }
+inline int f6844_17(int x) { return x * 17; }
+inline int f6844_18(int x) { return x * 18; }
+inline int f6844_19(int x) { return x * 19; }
+inline int f6844_20(int x) { return x * 20; }
+inline int f6844_21(int x) { return x * 21; }
+inline int f6844_22(int x) { return x * 22; }
+inline int f6844_23(int x) { return x * 23; }
+inline int f6844_24(int x) { return x * 24; }
+inline int f6844_25(int x) { return x * 25; }
+inline int f6844_26(int x) { return x * 26; }
+inline int f6844_27(int x) { return x * 27; }
+inline int f6844_28(int x) { return x * 28; }
+inline int f6844_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6845 */
+#include <vector>
+#include "h7980.h"
+#include "h8440.h"
+#include "h105.h"
+#include "h8596.h"
+#include "h7634.h"
+#ifdef X
+#include "h673.h"
+#endif
+struct S6845 { int a; const char *s = "x//y"; };
+inline int f6845_0(int x) { return x * 0; }
+inline int f6845_1(int x) { return x * 1; }
+inline int f6845_2(int x) { return x * 2; }
+inline int f6845_3(int x) { return x * 3; }
+inline int f6845_4(int x) { return x * 4; }
+inline int f6845_5(int x) { return x * 5; }
+inline int f6845_6(int x) { return x * 6; }
+inline int f6845_7(int x) { return x * 7; }
+inline int f6845_8(int x) { return x * 8; }
+inline int f6845_9(int x) { return x * 9; }
+inline int f6845_10(int x) { return x * 10; }
+inline int f6845_11(int x) { return x * 11; }
+inline int f6845_12(int x) { return x * 12; }
+inline int f6845_13(int x) { return x * 13; }
+inline int f6845_14(int x) { return x * 14; }
+inline int f6845_15(int x) { return x * 15; }
+inline int f6845_16(int x) { return x * 16; }
+inline int f6845_17(int x) { return x * 17; }
+inline int f6845_18(int x) { return x * 18; }
+inline int f6845_19(int x) { return x * 19; }
+inline int f6845_20(int x) { return x * 20; }
+inline int f6845_21(int x) { return x * 21; }
+inline int f6845_22(int x) { return x * 22; }
+inline int f6845_23(int x) { return x * 23; }
+inline int f6845_24(int x) { return x * 24; }
+inline int f6845_25(int x) { return x * 25; }
+inline int f6845_26(int x) { return x * 26; }
+inline int f6845_27(int x) { return x * 27; }
+inline int f6845_28(int x) { return x * 28; }
+inline int f6845_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6846 */
+#include <vector>
+#include "h2102.h"
+#include "h1926.h"
+#include "h5108.h"
+#include "h3011.h"
+#include "h3068.h"
+#ifdef X
+#include "h2194.h"
+#endif
+struct S6846 { int a; const char *s = "x//y"; };
+inline int f6846_0(int x) { return x * 0; }
+inline int f6846_1(int x) { return x * 1; }
+inline int f6846_2(int x) { return x * 2; }
+inline int f6846_3(int x) { return x * 3; }
+inline int f6846_4(int x) { return x * 4; }
+inline int f6846_5(int x) { return x * 5; }
+inline int f6846_6(int x) { return x * 6; }
+inline int f6846_7(int x) { return x * 7; }
+inline int f6846_8(int x) { return x * 8; }
+inline int f6846_9(int x) { return x * 9; }
+inline int f6846_10(int x) { return x * 10; }
+inline int f6846_11(int x) { return x * 11; }
+inline int f6846_12(int x) { return x * 12; }
+inline int f6846_13(int x) { return x * 13; }
+inline int f6846_14(int x) { return x * 14; }
+inline int f6846_15(int x) { return x * 15; }
+inline int f6846_16(int x) { return x * 16; }
+inline int f6846_17(int x) { return x * 17; }
+inline int f6846_18(int x) { return x * 18; }
+inline int f6846_19(int x) { return x * 19; }
+inline int f6846_20(int x) { return x * 20; }
+inline int f6846_21(int x) { return x * 21; }
+inline int f6846_22(int x) { return x * 22; }
+inline int f6846_23(int x) { return x * 23; }
+inline int f6846_24(int x) { return x * 24; }
+inline int f6846_25(int x) { return x * 25; }
+inline int f6846_26(int x) { return x * 26; }
+inline int f6846_27(int x) { return x * 27; }
+inline int f6846_28(int x) { return x * 28; }
+inline int f6846_29(int x) { return x * 29; }
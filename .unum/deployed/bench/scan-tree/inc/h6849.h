@@ -0,0 +1,42 @@
+#pragma once
+/* header 6849 */
+#include <vector>
+#include "h5567.h"
+#include "h4744.h"
+#include "h4029.h"
+#include "h3524.h"
+#include "h4663.h"
+#ifdef X
+#include "h9162.h"
+#endif
+struct S6849 { int a; const char *s = "x//y"; };
+inline int f6849_0(int x) { return x * 0; }
+inline int f6849_1(int x) { return x * 1; }
+inline int f6849_2(int x) { return x * 2; }
+inline int f6849_3(int x) { return x * 3; }
+inline int f6849_4(int x) { return x * 4; }
+inline int f6849_5(int x) { return x * 5; }
+inline int f6849_6(int x) { return x * 6; }
+inline int f6849_7(int x) { return x * 7; }
+inline int f6849_8(int x) { return x * 8; }
+inline int f6849_9(int x) { return x * 9; }
+inline int f6849_10(int x) { return x * 10; }
+inline int f6849_11(int x) { return x * 11; }
+inline int f6849_12(int x) { return x * 12; }
+inline int f6849_13(int x) { return x * 13; }
+inline int f6849_14(int x) { return x * 14; }
+inline int f6849_15(int x) { return x * 15; }
+inline int f6849_16(int x) { return x * 16; }
+inline int f6849_17(int x) { return x * 17; }
+inline int f6849_18(int x) { return x * 18; }
+inline int f6849_19(int x) { return x * 19; }
+inline int f6849_20(int x) { return x * 20; }
+inline int f6849_21(int x) { return x * 21; }
+inline int f6849_22(int x) { return x * 22; }
+inline int f6849_23(int x) { return x * 23; }
+inline int f6849_24(int x) { return x * 24; }
+inline int f6849_25(int x) { return x * 25; }
+inline int f6849_26(int x) { return x * 26; }
+inline int f6849_27(int x) { return x * 27; }
+inline int f6849_28(int x) { return x * 28; }
+inline int f6849_29(int x) { return x * 29; }
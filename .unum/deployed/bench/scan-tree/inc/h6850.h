@@ -0,0 +1,42 @@
+#pragma once
+/* header 6850 */
+#include <vector>
+#include "h7634.h"
+#include "h4694.h"
+#include "h6209.h"
+#include "h6475.h"
+#include "h8105.h"
+#ifdef X
+#include "h6067.h"
+#endif
+struct S6850 { int a; const char *s = "x//y"; };
+inline int f6850_0(int x) { return x * 0; }
+inline int f6850_1(int x) { return x * 1; }
+inline int f6850_2(int x) { return x * 2; }
+inline int f6850_3(int x) { return x * 3; }
+inline int f6850_4(int x) { return x * 4; }
+inline int f6850_5(int x) { return x * 5; }
+inline int f6850_6(int x) { return x * 6; }
+inline int f6850_7(int x) { return x * 7; }
+inline int f6850_8(int x) { return x * 8; }
+inline int f6850_9(int x) { return x * 9; }
+inline int f6850_10(int x) { return x * 10; }
+inline int f6850_11(int x) { return x * 11; }
+inline int f6850_12(int x) { return x * 12; }
+inline int f6850_13(int x) { return x * 13; }
+inline int f6850_14(int x) { return x * 14; }
+inline int f6850_15(int x) { return x * 15; }
+inline int f6850_16(int x) { return x * 16; }
+inline int f6850_17(int x) { return x * 17; }
+inline int f6850_18(int x) { return x * 18; }
+inline int f6850_19(int x) { return x * 19; }
+inline int f6850_20(int x) { return x * 20; }
+inline int f6850_21(int x) { return x * 21; }
+inline int f6850_22(int x) { return x * 22; }
+inline int f6850_23(int x) { return x * 23; }
+inline int f6850_24(int x) { return x * 24; }
+inline int f6850_25(int x) { return x * 25; }
+inline int f6850_26(int x) { return x * 26; }
+inline int f6850_27(int x) { return x * 27; }
+inline int f6850_28(int x) { return x * 28; }
+inline int f6850_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6852 */
+#include <vector>
+#include "h8279.h"
+#include "h6770.h"
+#include "h5164.h"
+#include "h3828.h"
+#include "h4141.h"
+#ifdef X
+#include "h7670.h"
+#endif
+struct S6852 { int a; const char *s = "x//y"; };
+inline int f6852_0(int x) { return x * 0; }
+inline int f6852_1(int x) { return x * 1; }
+inline int f6852_2(int x) { return x * 2; }
+inline int f6852_3(int x) { return x * 3; }
+inline int f6852_4(int x) { return x * 4; }
+inline int f6852_5(int x) { return x * 5; }
+inline int f6852_6(int x) { return x * 6; }
+inline int f6852_7(int x) { return x * 7; }
+inline int f6852_8(int x) { return x * 8; }
+inline int f6852_9(int x) { return x * 9; }
+inline int f6852_10(int x) { return x * 10; }
+inline int f6852_11(int x) { return x * 11; }
+inline int f6852_12(int x) { return x * 12; }
+inline int f6852_13(int x) { return x * 13; }
+inline int f6852_14(int x) { return x * 14; }
+inline int f6852_15(int x) { return x * 15; }
+inline int f6852_16(int x) { return x * 16; }
+inline int f6852_17(int x) { return x * 17; }
+inline int f6852_18(int x) { return x * 18; }
+inline int f6852_19(int x) { return x * 19; }
+inline int f6852_20(int x) { return x * 20; }
+inline int f6852_21(int x) { return x * 21; }
+inline int f6852_22(int x) { return x * 22; }
+inline int f6852_23(int x) { return x * 23; }
+inline int f6852_24(int x) { return x * 24; }
+inline int f6852_25(int x) { return x * 25; }
+inline int f6852_26(int x) { return x * 26; }
+inline int f6852_27(int x) { return x * 27; }
+inline int f6852_28(int x) { return x * 28; }
+inline int f6852_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6853 */
+#include <vector>
+#include "h3937.h"
+#include "h6393.h"
+#include "h1782.h"
+#include "h6973.h"
+#include "h621.h"
+#ifdef X
+#include "h2072.h"
+#endif
+struct S6853 { int a; const char *s = "x//y"; };
+inline int f6853_0(int x) { return x * 0; }
+inline int f6853_1(int x) { return x * 1; }
+inline int f6853_2(int x) { return x * 2; }
+inline int f6853_3(int x) { return x * 3; }
+inline int f6853_4(int x) { return x * 4; }
+inline int f6853_5(int x) { return x * 5; }
+inline int f6853_6(int x) { return x * 6; }
+inline int f6853_7(int x) { return x * 7; }
+inline int f6853_8(int x) { return x * 8; }
+inline int f6853_9(int x) { return x * 9; }
+inline int f6853_10(int x) { return x * 10; }
+inline int f6853_11(int x) { return x * 11; }
+inline int f6853_12(int x) { return x * 12; }
+inline int f6853_13(int x) { return x * 13; }
+inline int f6853_14(int x) { return x * 14; }
+inline int f6853_15(int x) { return x * 15; }
+inline int f6853_16(int x) { return x * 16; }
+inline int f6853_17(int x) { return x * 17; }
+inline int f6853_18(int x) { return x * 18; }
+inline int f6853_19(int x) { return x * 19; }
+inline int f6853_20(int x) { return x * 20; }
+inline int f6853_21(int x) { return x * 21; }
+inline int f6853_22(int x) { return x * 22; }
+inline int f6853_23(int x) { return x * 23; }
+inline int f6853_24(int x) { return x * 24; }
+inline int f6853_25(int x) { return x * 25; }
+inline int f6853_26(int x) { return x * 26; }
+inline int f6853_27(int x) { return x * 27; }
+inline int f6853_28(int x) { return x * 28; }
+inline int f6853_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6854 */
+#include <vector>
+#include "h5772.h"
+#include "h9752.h"
+#include "h1605.h"
+#include "h1230.h"
+#include "h5776.h"
+#ifdef X
+#include "h4029.h"
+#endif
+struct S6854 { int a; const char *s = "x//y"; };
+inline int f6854_0(int x) { return x * 0; }
+inline int f6854_1(int x) { return x * 1; }
+inline int f6854_2(int x) { return x * 2; }
+inline int f6854_3(int x) { return x * 3; }
+inline int f6854_4(int x) { return x * 4; }
+inline int f6854_5(int x) { return x * 5; }
+inline int f6854_6(int x) { return x * 6; }
+inline int f6854_7(int x) { return x * 7; }
+inline int f6854_8(int x) { return x * 8; }
+inline int f6854_9(int x) { return x * 9; }
+inline int f6854_10(int x) { return x * 10; }
+inline int f6854_11(int x) { return x * 11; }
+inline int f6854_12(int x) { return x * 12; }
+inline int f6854_13(int x) { return x * 13; }
+inline int f6854_14(int x) { return x * 14; }
+inline int f6854_15(int x) { return x * 15; }
+inline int f6854_16(int x) { return x * 16; }
+inline int f6854_17(int x) { return x * 17; }
+inline int f6854_18(int x) { return x * 18; }
+inline int f6854_19(int x) { return x * 19; }
+inline int f6854_20(int x) { return x * 20; }
+inline int f6854_21(int x) { return x * 21; }
+inline int f6854_22(int x) { return x * 22; }
+inline int f6854_23(int x) { return x * 23; }
+inline int f6854_24(int x) { return x * 24; }
+inline int f6854_25(int x) { return x * 25; }
+inline int f6854_26(int x) { return x * 26; }
+inline int f6854_27(int x) { return x * 27; }
+inline int f6854_28(int x) { return x * 28; }
+inline int f6854_29(int x) { return x * 29; }
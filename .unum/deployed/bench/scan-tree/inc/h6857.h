@@ -0,0 +1,42 @@
+#pragma once
+/* header 6857 */
+#include <vector>
+#include "h2278.h"
+#include "h726.h"
+#include "h3323.h"
+#include "h3245.h"
+#include "h7490.h"
+#ifdef X
+#include "h4737.h"
+#endif
+struct S6857 { int a; const char *s = "x//y"; };
+inline int f6857_0(int x) { return x * 0; }
+inline int f6857_1(int x) { return x * 1; }
+inline int f6857_2(int x) { return x * 2; }
+inline int f6857_3(int x) { return x * 3; }
+inline int f6857_4(int x) { return x * 4; }
+inline int f6857_5(int x) { return x * 5; }
+inline int f6857_6(int x) { return x * 6; }
+inline int f6857_7(int x) { return x * 7; }
+inline int f6857_8(int x) { return x * 8; }
+inline int f6857_9(int x) { return x * 9; }
+inline int f6857_10(int x) { return x * 10; }
+inline int f6857_11(int x) { return x * 11; }
+inline int f6857_12(int x) { return x * 12; }
+inline int f6857_13(int x) { return x * 13; }
+inline int f6857_14(int x) { return x * 14; }
+inline int f6857_15(int x) { return x * 15; }
+inline int f6857_16(int x) { return x * 16; }
+inline int f6857_17(int x) { return x * 17; }
+inline int f6857_18(int x) { return x * 18; }
+inline int f6857_19(int x) { return x * 19; }
+inline int f6857_20(int x) { return x * 20; }
+inline int f6857_21(int x) { return x * 21; }
+inline int f6857_22(int x) { return x * 22; }
+inline int f6857_23(int x) { return x * 23; }
+inline int f6857_24(int x) { return x * 24; }
+inline int f6857_25(int x) { return x * 25; }
+inline int f6857_26(int x) { return x * 26; }
+inline int f6857_27(int x) { return x * 27; }
+inline int f6857_28(int x) { return x * 28; }
+inline int f6857_29(int x) { return x * 29; }
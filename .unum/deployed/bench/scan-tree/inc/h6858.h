@@ -0,0 +1,42 @@
+#pragma once
+/* header 6858 */
+#include <vector>
+#include "h1805.h"
+#include "h3951.h"
+#include "h2746.h"
+#include "h2405.h"
+#include "h8871.h"
+#ifdef X
+#include "h634.h"
+#endif
+struct S6858 { int a; const char *s = "x//y"; };
+inline int f6858_0(int x) { return x * 0; }
+inline int f6858_1(int x) { return x * 1; }
+inline int f6858_2(int x) { return x * 2; }
+inline int f6858_3(int x) { return x * 3; }
+inline int f6858_4(int x) { return x * 4; }
+inline int f6858_5(int x) { return x * 5; }
+inline int f6858_6(int x) { return x * 6; }
+inline int f6858_7(int x) { return x * 7; }
+inline int f6858_8(int x) { return x * 8; }
+inline int f6858_9(int x) { return x * 9; }
+inline int f6858_10(int x) { return x * 10; }
+inline int f6858_11(int x) { return x * 11; }
+inline int f6858_12(int x) { return x * 12; }
+inline int f6858_13(int x) { return x * 13; }
+inline int f6858_14(int x) { return x * 14; }
+inline int f6858_15(int x) { return x * 15; }
+inline int f6858_16(int x) { return x * 16; }
+inline int f6858_17(int x) { return x * 17; }
+inline int f6858_18(int x) { return x * 18; }
+inline int f6858_19(int x) { return x * 19; }
+inline int f6858_20(int x) { return x * 20; }
+inline int f6858_21(int x) { return x * 21; }
+inline int f6858_22(int x) { return x * 22; }
+inline int f6858_23(int x) { return x * 23; }
+inline int f6858_24(int x) { return x * 24; }
+inline int f6858_25(int x) { return x * 25; }
+inline int f6858_26(int x) { return x * 26; }
+inline int f6858_27(int x) { return x * 27; }
+inline int f6858_28(int x) { return x * 28; }
+inline int f6858_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6859 */
+#include <vector>
+#include "h3632.h"
+#include "h7036.h"
+#include "h5736.h"
+#include "h392.h"
+#include "h9312.h"
+#ifdef X
+#include "h2672.h"
+#endif
+struct S6859 { int a; const char *s = "x//y"; };
+inline int f6859_0(int x) { return x * 0; }
+inline int f6859_1(int x) { return x * 1; }
+inline int f6859_2(int x) { return x * 2; }
+inline int f6859_3(int x) { return x * 3; }
+inline int f6859_4(int x) { return x * 4; }
+inline int f6859_5(int x) { return x * 5; }
+inline int f6859_6(int x) { return x * 6; }
+inline int f6859_7(int x) { return x * 7; }
+inline int f6859_8(int x) { return x * 8; }
+inline int f6859_9(int x) { return x * 9; }
+inline int f6859_10(int x) { return x * 10; }
+inline int f6859_11(int x) { return x * 11; }
+inline int f6859_12(int x) { return x * 12; }
+inline int f6859_13(int x) { return x * 13; }
+inline int f6859_14(int x) { return x * 14; }
+inline int f6859_15(int x) { return x * 15; }
+inline int f6859_16(int x) { return x * 16; }
+inline int f6859_17(int x) { return x * 17; }
+inline int f6859_18(int x) { return x * 18; }
+inline int f6859_19(int x) { return x * 19; }
+inline int f6859_20(int x) { return x * 20; }
+inline int f6859_21(int x) { return x * 21; }
+inline int f6859_22(int x) { return x * 22; }
+inline int f6859_23(int x) { return x * 23; }
+inline int f6859_24(int x) { return x * 24; }
+inline int f6859_25(int x) { return x * 25; }
+inline int f6859_26(int x) { return x * 26; }
+inline int f6859_27(int x) { return x * 27; }
+inline int f6859_28(int x) { return x * 28; }
+inline int f6859_29(int x) { return x * 29; }
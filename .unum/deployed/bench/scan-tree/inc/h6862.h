@@ -0,0 +1,42 @@
+#pragma once
+/* header 6862 */
+#include <vector>
+#include "h7409.h"
+#include "h2262.h"
+#include "h9564.h"
+#include "h5990.h"
+#include "h9998.h"
+#ifdef X
+#include "h1973.h"
+#endif
+struct S6862 { int a; const char *s = "x//y"; };
+inline int f6862_0(int x) { return x * 0; }
+inline int f6862_1(int x) { return x * 1; }
+inline int f6862_2(int x) { return x * 2; }
+inline int f6862_3(int x) { return x * 3; }
+inline int f6862_4(int x) { return x * 4; }
+inline int f6862_5(int x) { return x * 5; }
+inline int f6862_6(int x) { return x * 6; }
+inline int f6862_7(int x) { return x * 7; }
+inline int f6862_8(int x) { return x * 8; }
+inline int f6862_9(int x) { return x * 9; }
+inline int f6862_10(int x) { return x * 10; }
+inline int f6862_11(int x) { return x * 11; }
+inline int f6862_12(int x) { return x * 12; }
+inline int f6862_13(int x) { return x * 13; }
+inline int f6862_14(int x) { return x * 14; }
+inline int f6862_15(int x) { return x * 15; }
+inline int f6862_16(int x) { return x * 16; }
+inline int f6862_17(int x) { return x * 17; }
+inline int f6862_18(int x) { return x * 18; }
+inline int f6862_19(int x) { return x * 19; }
+inline int f6862_20(int x) { return x * 20; }
+inline int f6862_21(int x) { return x * 21; }
+inline int f6862_22(int x) { return x * 22; }
+inline int f6862_23(int x) { return x * 23; }
+inline int f6862_24(int x) { return x * 24; }
+inline int f6862_25(int x) { return x * 25; }
+inline int f6862_26(int x) { return x * 26; }
+inline int f6862_27(int x) { return x * 27; }
+inline int f6862_28(int x) { return x * 28; }
+inline int f6862_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6863 */
+#include <vector>
+#include "h7978.h"
+#include "h5638.h"
+#include "h3201.h"
+#include "h6779.h"
+#include "h3459.h"
+#ifdef X
+#include "h7718.h"
+#endif
+struct S6863 { int a; const char *s = "x//y"; };
+inline int f6863_0(int x) { return x * 0; }
+inline int f6863_1(int x) { return x * 1; }
+inline int f6863_2(int x) { return x * 2; }
+inline int f6863_3(int x) { return x * 3; }
+inline int f6863_4(int x) { return x * 4; }
+inline int f6863_5(int x) { return x * 5; }
+inline int f6863_6(int x) { return x * 6; }
+inline int f6863_7(int x) { return x * 7; }
+inline int f6863_8(int x) { return x * 8; }
+inline int f6863_9(int x) { return x * 9; }
+inline int f6863_10(int x) { return x * 10; }
+inline int f6863_11(int x) { return x * 11; }
+inline int f6863_12(int x) { return x * 12; }
+inline int f6863_13(int x) { return x * 13; }
+inline int f6863_14(int x) { return x * 14; }
+inline int f6863_15(int x) { return x * 15; }
+inline int f6863_16(int x) { return x * 16; }
+inline int f6863_17(int x) { return x * 17; }
+inline int f6863_18(int x) { return x * 18; }
+inline int f6863_19(int x) { return x * 19; }
+inline int f6863_20(int x) { return x * 20; }
+inline int f6863_21(int x) { return x * 21; }
+inline int f6863_22(int x) { return x * 22; }
+inline int f6863_23(int x) { return x * 23; }
+inline int f6863_24(int x) { return x * 24; }
+inline int f6863_25(int x) { return x * 25; }
+inline int f6863_26(int x) { return x * 26; }
+inline int f6863_27(int x) { return x * 27; }
+inline int f6863_28(int x) { return x * 28; }
+inline int f6863_29(int x) { return x * 29; }
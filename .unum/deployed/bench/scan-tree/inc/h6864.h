@@ -0,0 +1,42 @@
+#pragma once
+/* header 6864 */
+#include <vector>
+#include "h4311.h"
+#include "h3230.h"
+#include "h7035.h"
+#include "h880.h"
+#include "h9293.h"
+#ifdef X
+#include "h7858.h"
+#endif
+struct S6864 { int a; const char *s = "x//y"; };
+inline int f6864_0(int x) { return x * 0; }
+inline int f6864_1(int x) { return x * 1; }
+inline int f6864_2(int x) { return x * 2; }
+inline int f6864_3(int x) { return x * 3; }
+inline int f6864_4(int x) { return x * 4; }
+inline int f6864_5(int x) { return x * 5; }
+inline int f6864_6(int x) { return x * 6; }
+inline int f6864_7(int x) { return x * 7; }
+inline int f6864_8(int x) { return x * 8; }
+inline int f6864_9(int x) { return x * 9; }
+inline int f6864_10(int x) { return x * 10; }
+inline int f6864_11(int x) { return x * 11; }
+inline int f6864_12(int x) { return x * 12; }
+inline int f6864_13(int x) { return x * 13; }
+inline int f6864_14(int x) { return x * 14; }
+inline int f6864_15(int x) { return x * 15; }
+inline int f6864_16(int x) { return x * 16; }
+inline int f6864_17(int x) { return x * 17; }
+inline int f6864_18(int x) { return x * 18; }
+inline int f6864_19(int x) { return x * 19; }
+inline int f6864_20(int x) { return x * 20; }
+inline int f6864_21(int x) { return x * 21; }
+inline int f6864_22(int x) { return x * 22; }
+inline int f6864_23(int x) { return x * 23; }
+inline int f6864_24(int x) { return x * 24; }
+inline int f6864_25(int x) { return x * 25; }
+inline int f6864_26(int x) { return x * 26; }
+inline int f6864_27(int x) { return x * 27; }
+inline int f6864_28(int x) { return x * 28; }
+inline int f6864_29(int x) { return x * 29; }
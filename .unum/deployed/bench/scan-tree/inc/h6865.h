@@ -0,0 +1,42 @@
+#pragma once
+/* header 6865 */
+#include <vector>
+#include "h6718.h"
+#include "h9932.h"
+#include "h9298.h"
+#include "h718.h"
+#include "h478.h"
+#ifdef X
+#include "h7031.h"
+#endif
+struct S6865 { int a; const char *s = "x//y"; };
+inline int f6865_0(int x) { return x * 0; }
+inline int f6865_1(int x) { return x * 1; }
+inline int f6865_2(int x) { return x * 2; }
+inline int f6865_3(int x) { return x * 3; }
+inline int f6865_4(int x) { return x * 4; }
+inline int f6865_5(int x) { return x * 5; }
+inline int f6865_6(int x) { return x * 6; }
+inline int f6865_7(int x) { return x * 7; }
+inline int f6865_8(int x) { return x * 8; }
+inline int f6865_9(int x) { return x * 9; }
+inline int f6865_10(int x) { return x * 10; }
+inline int f6865_11(int x) { return x * 11; }
+inline int f6865_12(int x) { return x * 12; }
+inline int f6865_13(int x) { return x * 13; }
+inline int f6865_14(int x) { return x * 14; }
+inline int f6865_15(int x) { return x * 15; }
+inline int f6865_16(int x) { return x * 16; }
+inline int f6865_17(int x) { return x * 17; }
+inline int f6865_18(int x) { return x * 18; }
+inline int f6865_19(int x) { return x * 19; }
+inline int f6865_20(int x) { return x * 20; }
+inline int f6865_21(int x) { return x * 21; }
+inline int f6865_22(int x) { return x * 22; }
+inline int f6865_23(int x) { return x * 23; }
+inline int f6865_24(int x) { return x * 24; }
+inline int f6865_25(int x) { return x * 25; }
+inline int f6865_26(int x) { return x * 26; }
+inline int f6865_27(int x) { return x * 27; }
+inline int f6865_28(int x) { return x * 28; }
+inline int f6865_29(int x) { return x * 29; }
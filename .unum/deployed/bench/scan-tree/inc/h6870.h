@@ -0,0 +1,42 @@
+#pragma once
+/* header 6870 */
+#include <vector>
+#include "h3464.h"
+#include "h6450.h"
+#include "h2166.h"
+#include "h4369.h"
+#include "h9099.h"
+#ifdef X
+#include "h1767.h"
+#endif
+struct S6870 { int a; const char *s = "x//y"; };
+inline int f6870_0(int x) { return x * 0; }
+inline int f6870_1(int x) { return x * 1; }
+inline int f6870_2(int x) { return x * 2; }
+inline int f6870_3(int x) { return x * 3; }
+inline int f6870_4(int x) { return x * 4; }
+inline int f6870_5(int x) { return x * 5; }
+inline int f6870_6(int x) { return x * 6; }
+inline int f6870_7(int x) { return x * 7; }
+inline int f6870_8(int x) { return x * 8; }
+inline int f6870_9(int x) { return x * 9; }
+inline int f6870_10(int x) { return x * 10; }
+inline int f6870_11(int x) { return x * 11; }
+inline int f6870_12(int x) { return x * 12; }
+inline int f6870_13(int x) { return x * 13; }
+inline int f6870_14(int x) { return x * 14; }
+inline int f6870_15(int x) { return x * 15; }
+inline int f6870_16(int x) { return x * 16; }
+inline int f6870_17(int x) { return x * 17; }
+inline int f6870_18(int x) { return x * 18; }
+inline int f6870_19(int x) { return x * 19; }
+inline int f6870_20(int x) { return x * 20; }
+inline int f6870_21(int x) { return x * 21; }
+inline int f6870_22(int x) { return x * 22; }
+inline int f6870_23(int x) { return x * 23; }
+inline int f6870_24(int x) { return x * 24; }
+inline int f6870_25(int x) { return x * 25; }
+inline int f6870_26(int x) { return x * 26; }
+inline int f6870_27(int x) { return x * 27; }
+inline int f6870_28(int x) { return x * 28; }
+inline int f6870_29(int x) { return x * 29; }
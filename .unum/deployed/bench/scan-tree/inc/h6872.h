@@ -0,0 +1,42 @@
+#pragma once
+/* header 6872 */
+#include <vector>
+#include "h7743.h"
+#include "h752.h"
+#include "h1545.h"
+#include "h2558.h"
+#include "h170.h"
+#ifdef X
+#include "h7810.h"
+#endif
+struct S6872 { int a; const char *s = "x//y"; };
+inline int f6872_0(int x) { return x * 0; }
+inline int f6872_1(int x) { return x * 1; }
+inline int f6872_2(int x) { return x * 2; }
+inline int f6872_3(int x) { return x * 3; }
+inline int f6872_4(int x) { return x * 4; }
+inline int f6872_5(int x) { return x * 5; }
+inline int f6872_6(int x) { return x * 6; }
+inline int f6872_7(int x) { return x * 7; }
+inline int f6872_8(int x) { return x * 8; }
+inline int f6872_9(int x) { return x * 9; }
+inline int f6872_10(int x) { return x * 10; }
+inline int f6872_11(int x) { return x * 11; }
+inline int f6872_12(int x) { return x * 12; }
+inline int f6872_13(int x) { return x * 13; }
+inline int f6872_14(int x) { return x * 14; }
+inline int f6872_15(int x) { return x * 15; }
+inline int f6872_16(int x) { return x * 16; }
+inline int f6872_17(int x) { return x * 17; }
+inline int f6872_18(int x) { return x * 18; }
+inline int f6872_19(int x) { return x * 19; }
+inline int f6872_20(int x) { return x * 20; }
+inline int f6872_21(int x) { return x * 21; }
+inline int f6872_22(int x) { return x * 22; }
+inline int f6872_23(int x) { return x * 23; }
+inline int f6872_24(int x) { return x * 24; }
+inline int f6872_25(int x) { return x * 25; }
+inline int f6872_26(int x) { return x * 26; }
+inline int f6872_27(int x) { return x * 27; }
+inline int f6872_28(int x) { return x * 28; }
+inline int f6872_29(int x) { return x * 29; }
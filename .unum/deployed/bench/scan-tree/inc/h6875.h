@@ -0,0 +1,42 @@
+#pragma once
+/* header 6875 */
+#include <vector>
+#include "h2243.h"
+#include "h3351.h"
+#include "h5379.h"
+#include "h14.h"
+#include "h7491.h"
+#ifdef X
+#include "h6844.h"
+#endif
+struct S6875 { int a; const char *s = "x//y"; };
+inline int f6875_0(int x) { return x * 0; }
+inline int f6875_1(int x) { return x * 1; }
+inline int f6875_2(int x) { return x * 2; }
+inline int f6875_3(int x) { return x * 3; }
+inline int f6875_4(int x) { return x * 4; }
+inline int f6875_5(int x) { return x * 5; }
+inline int f6875_6(int x) { return x * 6; }
+inline int f6875_7(int x) { return x * 7; }
+inline int f6875_8(int x) { return x * 8; }
+inline int f6875_9(int x) { return x * 9; }
+inline int f6875_10(int x) { return x * 10; }
+inline int f6875_11(int x) { return x * 11; }
+inline int f6875_12(int x) { return x * 12; }
+inline int f6875_13(int x) { return x * 13; }
+inline int f6875_14(int x) { return x * 14; }
+inline int f6875_15(int x) { return x * 15; }
+inline int f6875_16(int x) { return x * 16; }
+inline int f6875_17(int x) { return x * 17; }
+inline int f6875_18(int x) { return x * 18; }
+inline int f6875_19(int x) { return x * 19; }
+inline int f6875_20(int x) { return x * 20; }
+inline int f6875_21(int x) { return x * 21; }
+inline int f6875_22(int x) { return x * 22; }
+inline int f6875_23(int x) { return x * 23; }
+inline int f6875_24(int x) { return x * 24; }
+inline int f6875_25(int x) { return x * 25; }
+inline int f6875_26(int x) { return x * 26; }
+inline int f6875_27(int x) { return x * 27; }
+inline int f6875_28(int x) { return x * 28; }
+inline int f6875_29(int x) { return x * 29; }
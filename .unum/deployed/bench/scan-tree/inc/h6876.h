@@ -0,0 +1,42 @@
+#pragma once
+/* header 6876 */
+#include <vector>
+#include "h3051.h"
+#include "h3083.h"
+#include "h3321.h"
+#include "h8716.h"
+#include "h8286.h"
+#ifdef X
+#include "h2588.h"
+#endif
+struct S6876 { int a; const char *s = "x//y"; };
+inline int f6876_0(int x) { return x * 0; }
+inline int f6876_1(int x) { return x * 1; }
+inline int f6876_2(int x) { return x * 2; }
+inline int f6876_3(int x) { return x * 3; }
+inline int f6876_4(int x) { return x * 4; }
+inline int f6876_5(int x) { return x * 5; }
+inline int f6876_6(int x) { return x * 6; }
+inline int f6876_7(int x) { return x * 7; }
+inline int f6876_8(int x) { return x * 8; }
+inline int f6876_9(int x) { return x * 9; }
+inline int f6876_10(int x) { return x * 10; }
+inline int f6876_11(int x) { return x * 11; }
+inline int f6876_12(int x) { return x * 12; }
+inline int f6876_13(int x) { return x * 13; }
+inline int f6876_14(int x) { return x * 14; }
+inline int f6876_15(int x) { return x * 15; }
+inline int f6876_16(int x) { return x * 16; }
+inline int f6876_17(int x) { return x * 17; }
+inline int f6876_18(int x) { return x * 18; }
+inline int f6876_19(int x) { return x * 19; }
+inline int f6876_20(int x) { return x * 20; }
+inline int f6876_21(int x) { return x * 21; }
+inline int f6876_22(int x) { return x * 22; }
+inline int f6876_23(int x) { return x * 23; }
+inline int f6876_24(int x) { return x * 24; }
+inline int f6876_25(int x) { return x * 25; }
+inline int f6876_26(int x) { return x * 26; }
+inline int f6876_27(int x) { return x * 27; }
+inline int f6876_28(int x) { return x * 28; }
+inline int f6876_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6877 */
+#include <vector>
+#include "h1051.h"
+#include "h3993.h"
+#include "h113.h"
+#include "h1732.h"
+#include "h147.h"
+#ifdef X
+#include "h7945.h"
+#endif
+struct S6877 { int a; const char *s = "x//y"; };
+inline int f6877_0(int x) { return x * 0; }
+inline int f6877_1(int x) { return x * 1; }
+inline int f6877_2(int x) { return x * 2; }
+inline int f6877_3(int x) { return x * 3; }
+inline int f6877_4(int x) { return x * 4; }
+inline int f6877_5(int x) { return x * 5; }
+inline int f6877_6(int x) { return x * 6; }
+inline int f6877_7(int x) { return x * 7; }
+inline int f6877_8(int x) { return x * 8; }
+inline int f6877_9(int x) { return x * 9; }
+inline int f6877_10(int x) { return x * 10; }
+inline int f6877_11(int x) { return x * 11; }
+inline int f6877_12(int x) { return x * 12; }
+inline int f6877_13(int x) { return x * 13; }
+inline int f6877_14(int x) { return x * 14; }
+inline int f6877_15(int x) { return x * 15; }
+inline int f6877_16(int x) { return x * 16; }
+inline int f6877_17(int x) { return x * 17; }
+inline int f6877_18(int x) { return x * 18; }
+inline int f6877_19(int x) { return x * 19; }
+inline int f6877_20(int x) { return x * 20; }
+inline int f6877_21(int x) { return x * 21; }
+inline int f6877_22(int x) { return x * 22; }
+inline int f6877_23(int x) { return x * 23; }
+inline int f6877_24(int x) { return x * 24; }
+inline int f6877_25(int x) { return x * 25; }
+inline int f6877_26(int x) { return x * 26; }
+inline int f6877_27(int x) { return x * 27; }
+inline int f6877_28(int x) { return x * 28; }
+inline int f6877_29(int x) { return x * 29; }
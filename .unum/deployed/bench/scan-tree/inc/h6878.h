@@ -0,0 +1,42 @@
+#pragma once
+/* header 6878 */
+#include <vector>
+#include "h1925.h"
+#include "h9154.h"
+#include "h1825.h"
+#include "h956.h"
+#include "h240.h"
+#ifdef X
+#include "h6212.h"
+#endif
+struct S6878 { int a; const char *s = "x//y"; };
+inline int f6878_0(int x) { return x * 0; }
+inline int f6878_1(int x) { return x * 1; }
+inline int f6878_2(int x) { return x * 2; }
+inline int f6878_3(int x) { return x * 3; }
+inline int f6878_4(int x) { return x * 4; }
+inline int f6878_5(int x) { return x * 5; }
+inline int f6878_6(int x) { return x * 6; }
+inline int f6878_7(int x) { return x * 7; }
+inline int f6878_8(int x) { return x * 8; }
+inline int f6878_9(int x) { return x * 9; }
+inline int f6878_10(int x) { return x * 10; }
+inline int f6878_11(int x) { return x * 11; }
+inline int f6878_12(int x) { return x * 12; }
+inline int f6878_13(int x) { return x * 13; }
+inline int f6878_14(int x) { return x * 14; }
+inline int f6878_15(int x) { return x * 15; }
+inline int f6878_16(int x) { return x * 16; }
+inline int f6878_17(int x) { return x * 17; }
+inline int f6878_18(int x) { return x * 18; }
+inline int f6878_19(int x) { return x * 19; }
+inline int f6878_20(int x) { return x * 20; }
+inline int f6878_21(int x) { return x * 21; }
+inline int f6878_22(int x) { return x * 22; }
+inline int f6878_23(int x) { return x * 23; }
+inline int f6878_24(int x) { return x * 24; }
+inline int f6878_25(int x) { return x * 25; }
+inline int f6878_26(int x) { return x * 26; }
+inline int f6878_27(int x) { return x * 27; }
+inline int f6878_28(int x) { return x * 28; }
+inline int f6878_29(int x) { return x * 29; }
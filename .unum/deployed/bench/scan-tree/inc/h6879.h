@@ -0,0 +1,42 @@
+#pragma once
+/* header 6879 */
+#include <vector>
+#include "h603.h"
+#include "h1622.h"
+#include "h6945.h"
+#include "h9038.h"
+#include "h6688.h"
+#ifdef X
+#include "h6098.h"
+#endif
+struct S6879 { int a; const char *s = "x//y"; };
+inline int f6879_0(int x) { return x * 0; }
+inline int f6879_1(int x) { return x * 1; }
+inline int f6879_2(int x) { return x * 2; }
+inline int f6879_3(int x) { return x * 3; }
+inline int f6879_4(int x) { return x * 4; }
+inline int f6879_5(int x) { return x * 5; }
+inline int f6879_6(int x) { return x * 6; }
+inline int f6879_7(int x) { return x * 7; }
+inline int f6879_8(int x) { return x * 8; }
+inline int f6879_9(int x) { return x * 9; }
+inline int f6879_10(int x) { return x * 10; }
+inline int f6879_11(int x) { return x * 11; }
+inline int f6879_12(int x) { return x * 12; }
+inline int f6879_13(int x) { return x * 13; }
+inline int f6879_14(int x) { return x * 14; }
+inline int f6879_15(int x) { return x * 15; }
+inline int f6879_16(int x) { return x * 16; }
+inline int f6879_17(int x) { return x * 17; }
+inline int f6879_18(int x) { return x * 18; }
+inline int f6879_19(int x) { return x * 19; }
+inline int f6879_20(int x) { return x * 20; }
+inline int f6879_21(int x) { return x * 21; }
+inline int f6879_22(int x) { return x * 22; }
+inline int f6879_23(int x) { return x * 23; }
+inline int f6879_24(int x) { return x * 24; }
+inline int f6879_25(int x) { return x * 25; }
+inline int f6879_26(int x) { return x * 26; }
+inline int f6879_27(int x) { return x * 27; }
+inline int f6879_28(int x) { return x * 28; }
+inline int f6879_29(int x) { return x * 29; }
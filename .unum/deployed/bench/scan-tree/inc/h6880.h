@@ -0,0 +1,42 @@
+#pragma once
+/* header 6880 */
+#include <vector>
+#include "h8591.h"
+#include "h58.h"
+#include "h3751.h"
+#include "h2145.h"
+#include "h9720.h"
+#ifdef X
+#include "h9060.h"
+#endif
+struct S6880 { int a; const char *s = "x//y"; };
+inline int f6880_0(int x) { return x * 0; }
+inline int f6880_1(int x) { return x * 1; }
+inline int f6880_2(int x) { return x * 2; }
+inline int f6880_3(int x) { return x * 3; }
+inline int f6880_4(int x) { return x * 4; }
+inline int f6880_5(int x) { return x * 5; }
+inline int f6880_6(int x) { return x * 6; }
+inline int f6880_7(int x) { return x * 7; }
+inline int f6880_8(int x) { return x * 8; }
+inline int f6880_9(int x) { return x * 9; }
+inline int f6880_10(int x) { return x * 10; }
+inline int f6880_11(int x) { return x * 11; }
+inline int f6880_12(int x) { return x * 12; }
+inline int f6880_13(int x) { return x * 13; }
+inline int f6880_14(int x) { return x * 14; }
+inline int f6880_15(int x) { return x * 15; }
+inline int f6880_16(int x) { return x * 16; }
+inline int f6880_17(int x) { return x * 17; }
+inline int f6880_18(int x) { return x * 18; }
+inline int f6880_19(int x) { return x * 19; }
+inline int f6880_20(int x) { return x * 20; }
+inline int f6880_21(int x) { return x * 21; }
+inline int f6880_22(int x) { return x * 22; }
+inline int f6880_23(int x) { return x * 23; }
+inline int f6880_24(int x) { return x * 24; }
+inline int f6880_25(int x) { return x * 25; }
+inline int f6880_26(int x) { return x * 26; }
+inline int f6880_27(int x) { return x * 27; }
+inline int f6880_28(int x) { return x * 28; }
+inline int f6880_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6884 */
+#include <vector>
+#include "h9284.h"
+#include "h2568.h"
+#include "h232.h"
+#include "h4841.h"
+#include "h9362.h"
+#ifdef X
+#include "h7163.h"
+#endif
+struct S6884 { int a; const char *s = "x//y"; };
+inline int f6884_0(int x) { return x * 0; }
+inline int f6884_1(int x) { return x * 1; }
+inline int f6884_2(int x) { return x * 2; }
+inline int f6884_3(int x) { return x * 3; }
+inline int f6884_4(int x) { return x * 4; }
+inline int f6884_5(int x) { return x * 5; }
+inline int f6884_6(int x) { return x * 6; }
+inline int f6884_7(int x) { return x * 7; }
+inline int f6884_8(int x) { return x * 8; }
+inline int f6884_9(int x) { return x * 9; }
+inline int f6884_10(int x) { return x * 10; }
+inline int f6884_11(int x) { return x * 11; }
+inline int f6884_12(int x) { return x * 12; }
+inline int f6884_13(int x) { return x * 13; }
+inline int f6884_14(int x) { return x * 14; }
+inline int f6884_15(int x) { return x * 15; }
+inline int f6884_16(int x) { return x * 16; }
+inline int f6884_17(int x) { return x * 17; }
+inline int f6884_18(int x) { return x * 18; }
+inline int f6884_19(int x) { return x * 19; }
+inline int f6884_20(int x) { return x * 20; }
+inline int f6884_21(int x) { return x * 21; }
+inline int f6884_22(int x) { return x * 22; }
+inline int f6884_23(int x) { return x * 23; }
+inline int f6884_24(int x) { return x * 24; }
+inline int f6884_25(int x) { return x * 25; }
+inline int f6884_26(int x) { return x * 26; }
+inline int f6884_27(int x) { return x * 27; }
+inline int f6884_28(int x) { return x * 28; }
+inline int f6884_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6885 */
+#include <vector>
+#include "h2299.h"
+#include "h6577.h"
+#include "h9452.h"
+#include "h8339.h"
+#include "h3100.h"
+#ifdef X
+#include "h7916.h"
+#endif
+struct S6885 { int a; const char *s = "x//y"; };
+inline int f6885_0(int x) { return x * 0; }
+inline int f6885_1(int x) { return x * 1; }
+inline int f6885_2(int x) { return x * 2; }
+inline int f6885_3(int x) { return x * 3; }
+inline int f6885_4(int x) { return x * 4; }
+inline int f6885_5(int x) { return x * 5; }
+inline int f6885_6(int x) { return x * 6; }
+inline int f6885_7(int x) { return x * 7; }
+inline int f6885_8(int x) { return x * 8; }
+inline int f6885_9(int x) { return x * 9; }
+inline int f6885_10(int x) { return x * 10; }
+inline int f6885_11(int x) { return x * 11; }
+inline int f6885_12(int x) { return x * 12; }
+inline int f6885_13(int x) { return x * 13; }
+inline int f6885_14(int x) { return x * 14; }
+inline int f6885_15(int x) { return x * 15; }
+inline int f6885_16(int x) { return x * 16; }
+inline int f6885_17(int x) { return x * 17; }
+inline int f6885_18(int x) { return x * 18; }
+inline int f6885_19(int x) { return x * 19; }
+inline int f6885_20(int x) { return x * 20; }
+inline int f6885_21(int x) { return x * 21; }
+inline int f6885_22(int x) { return x * 22; }
+inline int f6885_23(int x) { return x * 23; }
+inline int f6885_24(int x) { return x * 24; }
+inline int f6885_25(int x) { return x * 25; }
+inline int f6885_26(int x) { return x * 26; }
+inline int f6885_27(int x) { return x * 27; }
+inline int f6885_28(int x) { return x * 28; }
+inline int f6885_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6887 */
+#include <vector>
+#include "h2764.h"
+#include "h8150.h"
+#include "h233.h"
+#include "h6678.h"
+#include "h5975.h"
+#ifdef X
+#include "h2403.h"
+#endif
+struct S6887 { int a; const char *s = "x//y"; };
+inline int f6887_0(int x) { return x * 0; }
+inline int f6887_1(int x) { return x * 1; }
+inline int f6887_2(int x) { return x * 2; }
+inline int f6887_3(int x) { return x * 3; }
+inline int f6887_4(int x) { return x * 4; }
+inline int f6887_5(int x) { return x * 5; }
+inline int f6887_6(int x) { return x * 6; }
+inline int f6887_7(int x) { return x * 7; }
+inline int f6887_8(int x) { return x * 8; }
+inline int f6887_9(int x) { return x * 9; }
+inline int f6887_10(int x) { return x * 10; }
+inline int f6887_11(int x) { return x * 11; }
+inline int f6887_12(int x) { return x * 12; }
+inline int f6887_13(int x) { return x * 13; }
+inline int f6887_14(int x) { return x * 14; }
+inline int f6887_15(int x) { return x * 15; }
+inline int f6887_16(int x) { return x * 16; }
+inline int f6887_17(int x) { return x * 17; }
+inline int f6887_18(int x) { return x * 18; }
+inline int f6887_19(int x) { return x * 19; }
+inline int f6887_20(int x) { return x * 20; }
+inline int f6887_21(int x) { return x * 21; }
+inline int f6887_22(int x) { return x * 22; }
+inline int f6887_23(int x) { return x * 23; }
+inline int f6887_24(int x) { return x * 24; }
+inline int f6887_25(int x) { return x * 25; }
+inline int f6887_26(int x) { return x * 26; }
+inline int f6887_27(int x) { return x * 27; }
+inline int f6887_28(int x) { return x * 28; }
+inline int f6887_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6889 */
+#include <vector>
+#include "h1721.h"
+#include "h9868.h"
+#include "h8023.h"
+#include "h4738.h"
+#include "h3650.h"
+#ifdef X
+#include "h3281.h"
+#endif
+struct S6889 { int a; const char *s = "x//y"; };
+inline int f6889_0(int x) { return x * 0; }
+inline int f6889_1(int x) { return x * 1; }
+inline int f6889_2(int x) { return x * 2; }
+inline int f6889_3(int x) { return x * 3; }
+inline int f6889_4(int x) { return x * 4; }
+inline int f6889_5(int x) { return x * 5; }
+inline int f6889_6(int x) { return x * 6; }
+inline int f6889_7(int x) { return x * 7; }
+inline int f6889_8(int x) { return x * 8; }
+inline int f6889_9(int x) { return x * 9; }
+inline int f6889_10(int x) { return x * 10; }
+inline int f6889_11(int x) { return x * 11; }
+inline int f6889_12(int x) { return x * 12; }
+inline int f6889_13(int x) { return x * 13; }
+inline int f6889_14(int x) { return x * 14; }
+inline int f6889_15(int x) { return x * 15; }
+inline int f6889_16(int x) { return x * 16; }
+inline int f6889_17(int x) { return x * 17; }
+inline int f6889_18(int x) { return x * 18; }
+inline int f6889_19(int x) { return x * 19; }
+inline int f6889_20(int x) { return x * 20; }
+inline int f6889_21(int x) { return x * 21; }
+inline int f6889_22(int x) { return x * 22; }
+inline int f6889_23(int x) { return x * 23; }
+inline int f6889_24(int x) { return x * 24; }
+inline int f6889_25(int x) { return x * 25; }
+inline int f6889_26(int x) { return x * 26; }
+inline int f6889_27(int x) { return x * 27; }
+inline int f6889_28(int x) { return x * 28; }
+inline int f6889_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6891 */
+#include <vector>
+#include "h3001.h"
+#include "h8054.h"
+#include "h2353.h"
+#include "h1278.h"
+#include "h3389.h"
+#ifdef X
+#include "h2516.h"
+#endif
+struct S6891 { int a; const char *s = "x//y"; };
+inline int f6891_0(int x) { return x * 0; }
+inline int f6891_1(int x) { return x * 1; }
+inline int f6891_2(int x) { return x * 2; }
+inline int f6891_3(int x) { return x * 3; }
+inline int f6891_4(int x) { return x * 4; }
+inline int f6891_5(int x) { return x * 5; }
+inline int f6891_6(int x) { return x * 6; }
+inline int f6891_7(int x) { return x * 7; }
+inline int f6891_8(int x) { return x * 8; }
+inline int f6891_9(int x) { return x * 9; }
+inline int f6891_10(int x) { return x * 10; }
+inline int f6891_11(int x) { return x * 11; }
+inline int f6891_12(int x) { return x * 12; }
+inline int f6891_13(int x) { return x * 13; }
+inline int f6891_14(int x) { return x * 14; }
+inline int f6891_15(int x) { return x * 15; }
+inline int f6891_16(int x) { return x * 16; }
+inline int f6891_17(int x) { return x * 17; }
+inline int f6891_18(int x) { return x * 18; }
+inline int f6891_19(int x) { return x * 19; }
+inline int f6891_20(int x) { return x * 20; }
+inline int f6891_21(int x) { return x * 21; }
+inline int f6891_22(int x) { return x * 22; }
+inline int f6891_23(int x) { return x * 23; }
+inline int f6891_24(int x) { return x * 24; }
+inline int f6891_25(int x) { return x * 25; }
+inline int f6891_26(int x) { return x * 26; }
+inline int f6891_27(int x) { return x * 27; }
+inline int f6891_28(int x) { return x * 28; }
+inline int f6891_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6892 */
+#include <vector>
+#include "h1464.h"
+#include "h1460.h"
+#include "h2570.h"
+#include "h7897.h"
+#include "h601.h"
+#ifdef X
+#include "h9278.h"
+#endif
+struct S6892 { int a; const char *s = "x//y"; };
+inline int f6892_0(int x) { return x * 0; }
+inline int f6892_1(int x) { return x * 1; }
+inline int f6892_2(int x) { return x * 2; }
+inline int f6892_3(int x) { return x * 3; }
+inline int f6892_4(int x) { return x * 4; }
+inline int f6892_5(int x) { return x * 5; }
+inline int f6892_6(int x) { return x * 6; }
+inline int f6892_7(int x) { return x * 7; }
+inline int f6892_8(int x) { return x * 8; }
+inline int f6892_9(int x) { return x * 9; }
+inline int f6892_10(int x) { return x * 10; }
+inline int f6892_11(int x) { return x * 11; }
+inline int f6892_12(int x) { return x * 12; }
+inline int f6892_13(int x) { return x * 13; }
+inline int f6892_14(int x) { return x * 14; }
+inline int f6892_15(int x) { return x * 15; }
+inline int f6892_16(int x) { return x * 16; }
+inline int f6892_17(int x) { return x * 17; }
+inline int f6892_18(int x) { return x * 18; }
+inline int f6892_19(int x) { return x * 19; }
+inline int f6892_20(int x) { return x * 20; }
+inline int f6892_21(int x) { return x * 21; }
+inline int f6892_22(int x) { return x * 22; }
+inline int f6892_23(int x) { return x * 23; }
+inline int f6892_24(int x) { return x * 24; }
+inline int f6892_25(int x) { return x * 25; }
+inline int f6892_26(int x) { return x * 26; }
+inline int f6892_27(int x) { return x * 27; }
+inline int f6892_28(int x) { return x * 28; }
+inline int f6892_29(int x) { return x * 29; }
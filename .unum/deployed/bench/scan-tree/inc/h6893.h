@@ -0,0 +1,42 @@
+#pragma once
+/* header 6893 */
+#include <vector>
+#include "h5217.h"
+#include "h8383.h"
+#include "h7191.h"
+#include "h2242.h"
+#include "h4253.h"
+#ifdef X
+#include "h439.h"
+#endif
+struct S6893 { int a; const char *s = "x//y"; };
+inline int f6893_0(int x) { return x * 0; }
+inline int f6893_1(int x) { return x * 1; }
+inline int f6893_2(int x) { return x * 2; }
+inline int f6893_3(int x) { return x * 3; }
+inline int f6893_4(int x) { return x * 4; }
+inline int f6893_5(int x) { return x * 5; }
+inline int f6893_6(int x) { return x * 6; }
+inline int f6893_7(int x) { return x * 7; }
+inline int f6893_8(int x) { return x * 8; }
+inline int f6893_9(int x) { return x * 9; }
+inline int f6893_10(int x) { return x * 10; }
+inline int f6893_11(int x) { return x * 11; }
+inline int f6893_12(int x) { return x * 12; }
+inline int f6893_13(int x) { return x * 13; }
+inline int f6893_14(int x) { return x * 14; }
+inline int f6893_15(int x) { return x * 15; }
+inline int f6893_16(int x) { return x * 16; }
+inline int f6893_17(int x) { return x * 17; }
+inline int f6893_18(int x) { return x * 18; }
+inline int f6893_19(int x) { return x * 19; }
+inline int f6893_20(int x) { return x * 20; }
+inline int f6893_21(int x) { return x * 21; }
+inline int f6893_22(int x) { return x * 22; }
+inline int f6893_23(int x) { return x * 23; }
+inline int f6893_24(int x) { return x * 24; }
+inline int f6893_25(int x) { return x * 25; }
+inline int f6893_26(int x) { return x * 26; }
+inline int f6893_27(int x) { return x * 27; }
+inline int f6893_28(int x) { return x * 28; }
+inline int f6893_29(int x) { return x * 29; }
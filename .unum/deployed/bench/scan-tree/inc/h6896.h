@@ -0,0 +1,42 @@
+#pragma once
+/* header 6896 */
+#include <vector>
+#include "h6736.h"
+#include "h93.h"
+#include "h5849.h"
+#include "h9196.h"
+#include "h2802.h"
+#ifdef X
+#include "h3577.h"
+#endif
+struct S6896 { int a; const char *s = "x//y"; };
+inline int f6896_0(int x) { return x * 0; }
+inline int f6896_1(int x) { return x * 1; }
+inline int f6896_2(int x) { return x * 2; }
+inline int f6896_3(int x) { return x * 3; }
+inline int f6896_4(int x) { return x * 4; }
+inline int f6896_5(int x) { return x * 5; }
+inline int f6896_6(int x) { return x * 6; }
+inline int f6896_7(int x) { return x * 7; }
+inline int f6896_8(int x) { return x * 8; }
+inline int f6896_9(int x) { return x * 9; }
+inline int f6896_10(int x) { return x * 10; }
+inline int f6896_11(int x) { return x * 11; }
+inline int f6896_12(int x) { return x * 12; }
+inline int f6896_13(int x) { return x * 13; }
+inline int f6896_14(int x) { return x * 14; }
+inline int f6896_15(int x) { return x * 15; }
+inline int f6896_16(int x) { return x * 16; }
+inline int f6896_17(int x) { return x * 17; }
+inline int f6896_18(int x) { return x * 18; }
+inline int f6896_19(int x) { return x * 19; }
+inline int f6896_20(int x) { return x * 20; }
+inline int f6896_21(int x) { return x * 21; }
+inline int f6896_22(int x) { return x * 22; }
+inline int f6896_23(int x) { return x * 23; }
+inline int f6896_24(int x) { return x * 24; }
+inline int f6896_25(int x) { return x * 25; }
+inline int f6896_26(int x) { return x * 26; }
+inline int f6896_27(int x) { return x * 27; }
+inline int f6896_28(int x) { return x * 28; }
+inline int f6896_29(int x) { return x * 29; }
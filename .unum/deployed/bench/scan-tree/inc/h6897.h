@@ -0,0 +1,42 @@
+#pragma once
+/* header 6897 */
+#include <vector>
+#include "h5300.h"
+#include "h2343.h"
+#include "h2410.h"
+#include "h4634.h"
+#include "h3840.h"
+#ifdef X
+#include "h2312.h"
+#endif
+struct S6897 { int a; const char *s = "x//y"; };
+inline int f6897_0(int x) { return x * 0; }
+inline int f6897_1(int x) { return x * 1; }
+inline int f6897_2(int x) { return x * 2; }
+inline int f6897_3(int x) { return x * 3; }
+inline int f6897_4(int x) { return x * 4; }
+inline int f6897_5(int x) { return x * 5; }
+inline int f6897_6(int x) { return x * 6; }
+inline int f6897_7(int x) { return x * 7; }
+inline int f6897_8(int x) { return x * 8; }
+inline int f6897_9(int x) { return x * 9; }
+inline int f6897_10(int x) { return x * 10; }
+inline int f6897_11(int x) { return x * 11; }
+inline int f6897_12(int x) { return x * 12; }
+inline int f6897_13(int x) { return x * 13; }
+inline int f6897_14(int x) { return x * 14; }
+inline int f6897_15(int x) { return x * 15; }
+inline int f6897_16(int x) { return x * 16; }
+inline int f6897_17(int x) { return x * 17; }
+inline int f6897_18(int x) { return x * 18; }
+inline int f6897_19(int x) { return x * 19; }
+inline int f6897_20(int x) { return x * 20; }
+inline int f6897_21(int x) { return x * 21; }
+inline int f6897_22(int x) { return x * 22; }
+inline int f6897_23(int x) { return x * 23; }
+inline int f6897_24(int x) { return x * 24; }
+inline int f6897_25(int x) { return x * 25; }
+inline int f6897_26(int x) { return x * 26; }
+inline int f6897_27(int x) { return x * 27; }
+inline int f6897_28(int x) { return x * 28; }
+inline int f6897_29(int x) { return x * 29; }
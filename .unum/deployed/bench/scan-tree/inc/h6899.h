@@ -0,0 +1,42 @@
+#pragma once
+/* header 6899 */
+#include <vector>
+#include "h2955.h"
+#include "h5102.h"
+#include "h8330.h"
+#include "h5730.h"
+#include "h685.h"
+#ifdef X
+#include "h9452.h"
+#endif
+struct S6899 { int a; const char *s = "x//y"; };
+inline int f6899_0(int x) { return x * 0; }
+inline int f6899_1(int x) { return x * 1; }
+inline int f6899_2(int x) { return x * 2; }
+inline int f6899_3(int x) { return x * 3; }
+inline int f6899_4(int x) { return x * 4; }
+inline int f6899_5(int x) { return x * 5; }
+inline int f6899_6(int x) { return x * 6; }
+inline int f6899_7(int x) { return x * 7; }
+inline int f6899_8(int x) { return x * 8; }
+inline int f6899_9(int x) { return x * 9; }
+inline int f6899_10(int x) { return x * 10; }
+inline int f6899_11(int x) { return x * 11; }
+inline int f6899_12(int x) { return x * 12; }
+inline int f6899_13(int x) { return x * 13; }
+inline int f6899_14(int x) { return x * 14; }
+inline int f6899_15(int x) { return x * 15; }
+inline int f6899_16(int x) { return x * 16; }
+inline int f6899_17(int x) { return x * 17; }
+inline int f6899_18(int x) { return x * 18; }
+inline int f6899_19(int x) { return x * 19; }
+inline int f6899_20(int x) { return x * 20; }
+inline int f6899_21(int x) { return x * 21; }
+inline int f6899_22(int x) { return x * 22; }
+inline int f6899_23(int x) { return x * 23; }
+inline int f6899_24(int x) { return x * 24; }
+inline int f6899_25(int x) { return x * 25; }
+inline int f6899_26(int x) { return x * 26; }
+inline int f6899_27(int x) { return x * 27; }
+inline int f6899_28(int x) { return x * 28; }
+inline int f6899_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 69 */
+#include <vector>
+#include "h3142.h"
+#include "h5878.h"
+#include "h3694.h"
+#include "h2940.h"
+#include "h777.h"
+#ifdef X
+#include "h2748.h"
+#endif
+struct S69 { int a; const char *s = "x//y"; };
+inline int f69_0(int x) { return x * 0; }
+inline int f69_1(int x) { return x * 1; }
+inline int f69_2(int x) { return x * 2; }
+inline int f69_3(int x) { return x * 3; }
+inline int f69_4(int x) { return x * 4; }
+inline int f69_5(int x) { return x * 5; }
+inline int f69_6(int x) { return x * 6; }
+inline int f69_7(int x) { return x * 7; }
+inline int f69_8(int x) { return x * 8; }
+inline int f69_9(int x) { return x * 9; }
+inline int f69_10(int x) { return x * 10; }
+inline int f69_11(int x) { return x * 11; }
+inline int f69_12(int x) { return x * 12; }
+inline int f69_13(int x) { return x * 13; }
+inline int f69_14(int x) { return x * 14; }
+inline int f69_15(int x) { return x * 15; }
+inline int f69_16(int x) { return x * 16; }
+inline int f69_17(int x) { return x * 17; }
+inline int f69_18(int x) { return x * 18; }
+inline int f69_19(int x) { return x * 19; }
+inline int f69_20(int x) { return x * 20; }
+inline int f69_21(int x) { return x * 21; }
+inline int f69_22(int x) { return x * 22; }
+inline int f69_23(int x) { return x * 23; }
+inline int f69_24(int x) { return x * 24; }
+inline int f69_25(int x) { return x * 25; }
+inline int f69_26(int x) { return x * 26; }
+inline int f69_27(int x) { return x * 27; }
+inline int f69_28(int x) { return x * 28; }
+inline int f69_29(int x) { return x * 29; }
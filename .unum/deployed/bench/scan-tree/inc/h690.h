@@ -0,0 +1,42 @@
+#pragma once
+/* header 690 */
+#include <vector>
+#include "h8910.h"
+#include "h4500.h"
+#include "h198.h"
+#include "h9986.h"
+#include "h5980.h"
+#ifdef X
+#include "h7029.h"
+#endif
+struct S690 { int a; const char *s = "x//y"; };
+inline int f690_0(int x) { return x * 0; }
+inline int f690_1(int x) { return x * 1; }
+inline int f690_2(int x) { return x * 2; }
+inline int f690_3(int x) { return x * 3; }
+inline int f690_4(int x) { return x * 4; }
+inline int f690_5(int x) { return x * 5; }
+inline int f690_6(int x) { return x * 6; }
+inline int f690_7(int x) { return x * 7; }
+inline int f690_8(int x) { return x * 8; }
+inline int f690_9(int x) { return x * 9; }
+inline int f690_10(int x) { return x * 10; }
+inline int f690_11(int x) { return x * 11; }
+inline int f690_12(int x) { return x * 12; }
+inline int f690_13(int x) { return x * 13; }
+inline int f690_14(int x) { return x * 14; }
+inline int f690_15(int x) { return x * 15; }
+inline int f690_16(int x) { return x * 16; }
+inline int f690_17(int x) { return x * 17; }
+inline int f690_18(int x) { return x * 18; }
+inline int f690_19(int x) { return x * 19; }
+inline int f690_20(int x) { return x * 20; }
+inline int f690_21(int x) { return x * 21; }
+inline int f690_22(int x) { return x * 22; }
+inline int f690_23(int x) { return x * 23; }
+inline int f690_24(int x) { return x * 24; }
+inline int f690_25(int x) { return x * 25; }
+inline int f690_26(int x) { return x * 26; }
+inline int f690_27(int x) { return x * 27; }
+inline int f690_28(int x) { return x * 28; }
+inline int f690_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6900 */
+#include <vector>
+#include "h4904.h"
+#include "h3448.h"
+#include "h4274.h"
+#include "h9798.h"
+#include "h8876.h"
+#ifdef X
+#include "h9961.h"
+#endif
+struct S6900 { int a; const char *s = "x//y"; };
+inline int f6900_0(int x) { return x * 0; }
+inline int f6900_1(int x) { return x * 1; }
+inline int f6900_2(int x) { return x * 2; }
+inline int f6900_3(int x) { return x * 3; }
+inline int f6900_4(int x) { return x * 4; }
+inline int f6900_5(int x) { return x * 5; }
+inline int f6900_6(int x) { return x * 6; }
+inline int f6900_7(int x) { return x * 7; }
+inline int f6900_8(int x) { return x * 8; }
+inline int f6900_9(int x) { return x * 9; }
+inline int f6900_10(int x) { return x * 10; }
+inline int f6900_11(int x) { return x * 11; }
+inline int f6900_12(int x) { return x * 12; }
+inline int f6900_13(int x) { return x * 13; }
+inline int f6900_14(int x) { return x * 14; }
+inline int f6900_15(int x) { return x * 15; }
+inline int f6900_16(int x) { return x * 16; }
+inline int f6900_17(int x) { return x * 17; }
+inline int f6900_18(int x) { return x * 18; }
+inline int f6900_19(int x) { return x * 19; }
+inline int f6900_20(int x) { return x * 20; }
+inline int f6900_21(int x) { return x * 21; }
+inline int f6900_22(int x) { return x * 22; }
+inline int f6900_23(int x) { return x * 23; }
+inline int f6900_24(int x) { return x * 24; }
+inline int f6900_25(int x) { return x * 25; }
+inline int f6900_26(int x) { return x * 26; }
+inline int f6900_27(int x) { return x * 27; }
+inline int f6900_28(int x) { return x * 28; }
+inline int f6900_29(int x) { return x * 29; }
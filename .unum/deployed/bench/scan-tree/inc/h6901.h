@@ -0,0 +1,42 @@
+#pragma once
+/* header 6901 */
+#include <vector>
+#include "h4880.h"
+#include "h5987.h"
+#include "h3627.h"
+#include "h3693.h"
+#include "h999.h"
+#ifdef X
+#include "h479.h"
+#endif
+struct S6901 { int a; const char *s = "x//y"; };
+inline int f6901_0(int x) { return x * 0; }
+inline int f6901_1(int x) { return x * 1; }
+inline int f6901_2(int x) { return x * 2; }
+inline int f6901_3(int x) { return x * 3; }
+inline int f6901_4(int x) { return x * 4; }
+inline int f6901_5(int x) { return x * 5; }
+inline int f6901_6(int x) { return x * 6; }
+inline int f6901_7(int x) { return x * 7; }
+inline int f6901_8(int x) { return x * 8; }
+inline int f6901_9(int x) { return x * 9; }
+inline int f6901_10(int x) { return x * 10; }
+inline int f6901_11(int x) { return x * 11; }
+inline int f6901_12(int x) { return x * 12; }
+inline int f6901_13(int x) { return x * 13; }
+inline int f6901_14(int x) { return x * 14; }
+inline int f6901_15(int x) { return x * 15; }
+inline int f6901_16(int x) { return x * 16; }
+inline int f6901_17(int x) { return x * 17; }
+inline int f6901_18(int x) { return x * 18; }
+inline int f6901_19(int x) { return x * 19; }
+inline int f6901_20(int x) { return x * 20; }
+inline int f6901_21(int x) { return x * 21; }
+inline int f6901_22(int x) { return x * 22; }
+inline int f6901_23(int x) { return x * 23; }
+inline int f6901_24(int x) { return x * 24; }
+inline int f6901_25(int x) { return x * 25; }
+inline int f6901_26(int x) { return x * 26; }
+inline int f6901_27(int x) { return x * 27; }
+inline int f6901_28(int x) { return x * 28; }
+inline int f6901_29(int x) { return x * 29; }
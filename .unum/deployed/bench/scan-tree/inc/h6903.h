@@ -0,0 +1,42 @@
+#pragma once
+/* header 6903 */
+#include <vector>
+#include "h4755.h"
+#include "h5857.h"
+#include "h762.h"
+#include "h9728.h"
+#include "h807.h"
+#ifdef X
+#include "h6806.h"
+#endif
+struct S6903 { int a; const char *s = "x//y"; };
+inline int f6903_0(int x) { return x * 0; }
+inline int f6903_1(int x) { return x * 1; }
+inline int f6903_2(int x) { return x * 2; }
+inline int f6903_3(int x) { return x * 3; }
+inline int f6903_4(int x) { return x * 4; }
+inline int f6903_5(int x) { return x * 5; }
+inline int f6903_6(int x) { return x * 6; }
+inline int f6903_7(int x) { return x * 7; }
+inline int f6903_8(int x) { return x * 8; }
+inline int f6903_9(int x) { return x * 9; }
+inline int f6903_10(int x) { return x * 10; }
+inline int f6903_11(int x) { return x * 11; }
+inline int f6903_12(int x) { return x * 12; }
+inline int f6903_13(int x) { return x * 13; }
+inline int f6903_14(int x) { return x * 14; }
+inline int f6903_15(int x) { return x * 15; }
+inline int f6903_16(int x) { return x * 16; }
+inline int f6903_17(int x) { return x * 17; }
+inline int f6903_18(int x) { return x * 18; }
+inline int f6903_19(int x) { return x * 19; }
+inline int f6903_20(int x) { return x * 20; }
+inline int f6903_21(int x) { return x * 21; }
+inline int f6903_22(int x) { return x * 22; }
+inline int f6903_23(int x) { return x * 23; }
+inline int f6903_24(int x) { return x * 24; }
+inline int f6903_25(int x) { return x * 25; }
+inline int f6903_26(int x) { return x * 26; }
+inline int f6903_27(int x) { return x * 27; }
+inline int f6903_28(int x) { return x * 28; }
+inline int f6903_29(int x) { return x * 29; }
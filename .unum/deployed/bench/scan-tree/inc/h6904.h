@@ -0,0 +1,42 @@
+#pragma once
+/* header 6904 */
+#include <vector>
+#include "h9114.h"
+#include "h8705.h"
+#include "h2797.h"
+#include "h8112.h"
+#include "h8591.h"
+#ifdef X
+#include "h7595.h"
+#endif
+struct S6904 { int a; const char *s = "x//y"; };
+inline int f6904_0(int x) { return x * 0; }
+inline int f6904_1(int x) { return x * 1; }
+inline int f6904_2(int x) { return x * 2; }
+inline int f6904_3(int x) { return x * 3; }
+inline int f6904_4(int x) { return x * 4; }
+inline int f6904_5(int x) { return x * 5; }
+inline int f6904_6(int x) { return x * 6; }
+inline int f6904_7(int x) { return x * 7; }
+inline int f6904_8(int x) { return x * 8; }
+inline int f6904_9(int x) { return x * 9; }
+inline int f6904_10(int x) { return x * 10; }
+inline int f6904_11(int x) { return x * 11; }
+inline int f6904_12(int x) { return x * 12; }
+inline int f6904_13(int x) { return x * 13; }
+inline int f6904_14(int x) { return x * 14; }
+inline int f6904_15(int x) { return x * 15; }
+inline int f6904_16(int x) { return x * 16; }
+inline int f6904_17(int x) { return x * 17; }
+inline int f6904_18(int x) { return x * 18; }
+inline int f6904_19(int x) { return x * 19; }
+inline int f6904_20(int x) { return x * 20; }
+inline int f6904_21(int x) { return x * 21; }
+inline int f6904_22(int x) { return x * 22; }
+inline int f6904_23(int x) { return x * 23; }
+inline int f6904_24(int x) { return x * 24; }
+inline int f6904_25(int x) { return x * 25; }
+inline int f6904_26(int x) { return x * 26; }
+inline int f6904_27(int x) { return x * 27; }
+inline int f6904_28(int x) { return x * 28; }
+inline int f6904_29(int x) { return x * 29; }
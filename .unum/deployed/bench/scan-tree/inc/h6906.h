@@ -0,0 +1,42 @@
+#pragma once
+/* header 6906 */
+#include <vector>
+#include "h2404.h"
+#include "h2113.h"
+#include "h9452.h"
+#include "h9587.h"
+#include "h6585.h"
+#ifdef X
+#include "h7775.h"
+#endif
+struct S6906 { int a; const char *s = "x//y"; };
+inline int f6906_0(int x) { return x * 0; }
+inline int f6906_1(int x) { return x * 1; }
+inline int f6906_2(int x) { return x * 2; }
+inline int f6906_3(int x) { return x * 3; }
+inline int f6906_4(int x) { return x * 4; }
+inline int f6906_5(int x) { return x * 5; }
+inline int f6906_6(int x) { return x * 6; }
+inline int f6906_7(int x) { return x * 7; }
+inline int f6906_8(int x) { return x * 8; }
+inline int f6906_9(int x) { return x * 9; }
+inline int f6906_10(int x) { return x * 10; }
+inline int f6906_11(int x) { return x * 11; }
+inline int f6906_12(int x) { return x * 12; }
+inline int f6906_13(int x) { return x * 13; }
+inline int f6906_14(int x) { return x * 14; }
+inline int f6906_15(int x) { return x * 15; }
+inline int f6906_16(int x) { return x * 16; }
+inline int f6906_17(int x) { return x * 17; }
+inline int f6906_18(int x) { return x * 18; }
+inline int f6906_19(int x) { return x * 19; }
+inline int f6906_20(int x) { return x * 20; }
+inline int f6906_21(int x) { return x * 21; }
+inline int f6906_22(int x) { return x * 22; }
+inline int f6906_23(int x) { return x * 23; }
+inline int f6906_24(int x) { return x * 24; }
+inline int f6906_25(int x) { return x * 25; }
+inline int f6906_26(int x) { return x * 26; }
+inline int f6906_27(int x) { return x * 27; }
+inline int f6906_28(int x) { return x * 28; }
+inline int f6906_29(int x) { return x * 29; }
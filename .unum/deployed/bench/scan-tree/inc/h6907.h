@@ -0,0 +1,42 @@
+#pragma once
+/* header 6907 */
+#include <vector>
+#include "h25.h"
+#include "h1907.h"
+#include "h7064.h"
+#include "h3594.h"
+#include "h8845.h"
+#ifdef X
+#include "h3679.h"
+#endif
+struct S6907 { int a; const char *s = "x//y"; };
+inline int f6907_0(int x) { return x * 0; }
+inline int f6907_1(int x) { return x * 1; }
+inline int f6907_2(int x) { return x * 2; }
+inline int f6907_3(int x) { return x * 3; }
+inline int f6907_4(int x) { return x * 4; }
+inline int f6907_5(int x) { return x * 5; }
+inline int f6907_6(int x) { return x * 6; }
+inline int f6907_7(int x) { return x * 7; }
+inline int f6907_8(int x) { return x * 8; }
+inline int f6907_9(int x) { return x * 9; }
+inline int f6907_10(int x) { return x * 10; }
+inline int f6907_11(int x) { return x * 11; }
+inline int f6907_12(int x) { return x * 12; }
+inline int f6907_13(int x) { return x * 13; }
+inline int f6907_14(int x) { return x * 14; }
+inline int f6907_15(int x) { return x * 15; }
+inline int f6907_16(int x) { return x * 16; }
+inline int f6907_17(int x) { return x * 17; }
+inline int f6907_18(int x) { return x * 18; }
+inline int f6907_19(int x) { return x * 19; }
+inline int f6907_20(int x) { return x * 20; }
+inline int f6907_21(int x) { return x * 21; }
+inline int f6907_22(int x) { return x * 22; }
+inline int f6907_23(int x) { return x * 23; }
+inline int f6907_24(int x) { return x * 24; }
+inline int f6907_25(int x) { return x * 25; }
+inline int f6907_26(int x) { return x * 26; }
+inline int f6907_27(int x) { return x * 27; }
+inline int f6907_28(int x) { return x * 28; }
+inline int f6907_29(int x) { return x * 29; }
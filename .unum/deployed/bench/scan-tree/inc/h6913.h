@@ -0,0 +1,42 @@
+#pragma once
+/* header 6913 */
+#include <vector>
+#include "h9129.h"
+#include "h1376.h"
+#include "h411.h"
+#include "h5572.h"
+#include "h7367.h"
+#ifdef X
+#include "h1624.h"
+#endif
+struct S6913 { int a; const char *s = "x//y"; };
+inline int f6913_0(int x) { return x * 0; }
+inline int f6913_1(int x) { return x * 1; }
+inline int f6913_2(int x) { return x * 2; }
+inline int f6913_3(int x) { return x * 3; }
+inline int f6913_4(int x) { return x * 4; }
+inline int f6913_5(int x) { return x * 5; }
+inline int f6913_6(int x) { return x * 6; }
+inline int f6913_7(int x) { return x * 7; }
+inline int f6913_8(int x) { return x * 8; }
+inline int f6913_9(int x) { return x * 9; }
+inline int f6913_10(int x) { return x * 10; }
+inline int f6913_11(int x) { return x * 11; }
+inline int f6913_12(int x) { return x * 12; }
+inline int f6913_13(int x) { return x * 13; }
+inline int f6913_14(int x) { return x * 14; }
+inline int f6913_15(int x) { return x * 15; }
+inline int f6913_16(int x) { return x * 16; }
+inline int f6913_17(int x) { return x * 17; }
+inline int f6913_18(int x) { return x * 18; }
+inline int f6913_19(int x) { return x * 19; }
+inline int f6913_20(int x) { return x * 20; }
+inline int f6913_21(int x) { return x * 21; }
+inline int f6913_22(int x) { return x * 22; }
+inline int f6913_23(int x) { return x * 23; }
+inline int f6913_24(int x) { return x * 24; }
+inline int f6913_25(int x) { return x * 25; }
+inline int f6913_26(int x) { return x * 26; }
+inline int f6913_27(int x) { return x * 27; }
+inline int f6913_28(int x) { return x * 28; }
+inline int f6913_29(int x) { return x * 29; }
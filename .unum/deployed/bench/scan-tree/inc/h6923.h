@@ -0,0 +1,42 @@
+#pragma once
+/* header 6923 */
+#include <vector>
+#include "h317.h"
+#include "h5475.h"
+#include "h301.h"
+#include "h2344.h"
+#include "h9325.h"
+#ifdef X
+#include "h3368.h"
+#endif
+struct S6923 { int a; const char *s = "x//y"; };
+inline int f6923_0(int x) { return x * 0; }
+inline int f6923_1(int x) { return x * 1; }
+inline int f6923_2(int x) { return x * 2; }
+inline int f6923_3(int x) { return x * 3; }
+inline int f6923_4(int x) { return x * 4; }
+inline int f6923_5(int x) { return x * 5; }
+inline int f6923_6(int x) { return x * 6; }
+inline int f6923_7(int x) { return x * 7; }
+inline int f6923_8(int x) { return x * 8; }
+inline int f6923_9(int x) { return x * 9; }
+inline int f6923_10(int x) { return x * 10; }
+inline int f6923_11(int x) { return x * 11; }
+inline int f6923_12(int x) { return x * 12; }
+inline int f6923_13(int x) { return x * 13; }
+inline int f6923_14(int x) { return x * 14; }
+inline int f6923_15(int x) { return x * 15; }
+inline int f6923_16(int x) { return x * 16; }
+inline int f6923_17(int x) { return x * 17; }
+inline int f6923_18(int x) { return x * 18; }
+inline int f6923_19(int x) { return x * 19; }
+inline int f6923_20(int x) { return x * 20; }
+inline int f6923_21(int x) { return x * 21; }
+inline int f6923_22(int x) { return x * 22; }
+inline int f6923_23(int x) { return x * 23; }
+inline int f6923_24(int x) { return x * 24; }
+inline int f6923_25(int x) { return x * 25; }
+inline int f6923_26(int x) { return x * 26; }
+inline int f6923_27(int x) { return x * 27; }
+inline int f6923_28(int x) { return x * 28; }
+inline int f6923_29(int x) { return x * 29; }
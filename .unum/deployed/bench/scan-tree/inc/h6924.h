@@ -0,0 +1,42 @@
+#pragma once
+/* header 6924 */
+#include <vector>
+#include "h431.h"
+#include "h3778.h"
+#include "h7368.h"
+#include "h6914.h"
+#include "h7925.h"
+#ifdef X
+#include "h9819.h"
+#endif
+struct S6924 { int a; const char *s = "x//y"; };
+inline int f6924_0(int x) { return x * 0; }
+inline int f6924_1(int x) { return x * 1; }
+inline int f6924_2(int x) { return x * 2; }
+inline int f6924_3(int x) { return x * 3; }
+inline int f6924_4(int x) { return x * 4; }
+inline int f6924_5(int x) { return x * 5; }
+inline int f6924_6(int x) { return x * 6; }
+inline int f6924_7(int x) { return x * 7; }
+inline int f6924_8(int x) { return x * 8; }
+inline int f6924_9(int x) { return x * 9; }
+inline int f6924_10(int x) { return x * 10; }
+inline int f6924_11(int x) { return x * 11; }
+inline int f6924_12(int x) { return x * 12; }
+inline int f6924_13(int x) { return x * 13; }
+inline int f6924_14(int x) { return x * 14; }
+inline int f6924_15(int x) { return x * 15; }
+inline int f6924_16(int x) { return x * 16; }
+inline int f6924_17(int x) { return x * 17; }
+inline int f6924_18(int x) { return x * 18; }
+inline int f6924_19(int x) { return x * 19; }
+inline int f6924_20(int x) { return x * 20; }
+inline int f6924_21(int x) { return x * 21; }
+inline int f6924_22(int x) { return x * 22; }
+inline int f6924_23(int x) { return x * 23; }
+inline int f6924_24(int x) { return x * 24; }
+inline int f6924_25(int x) { return x * 25; }
+inline int f6924_26(int x) { return x * 26; }
+inline int f6924_27(int x) { return x * 27; }
+inline int f6924_28(int x) { return x * 28; }
+inline int f6924_29(int x) { return x * 29; }
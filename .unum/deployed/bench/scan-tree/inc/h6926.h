@@ -0,0 +1,42 @@
+#pragma once
+/* header 6926 */
+#include <vector>
+#include "h4883.h"
+#include "h6680.h"
+#include "h8173.h"
+#include "h2259.h"
+#include "h4212.h"
+#ifdef X
+#include "h4290.h"
+#endif
+struct S6926 { int a; const char *s = "x//y"; };
+inline int f6926_0(int x) { return x * 0; }
+inline int f6926_1(int x) { return x * 1; }
+inline int f6926_2(int x) { return x * 2; }
+inline int f6926_3(int x) { return x * 3; }
+inline int f6926_4(int x) { return x * 4; }
+inline int f6926_5(int x) { return x * 5; }
+inline int f6926_6(int x) { return x * 6; }
+inline int f6926_7(int x) { return x * 7; }
+inline int f6926_8(int x) { return x * 8; }
+inline int f6926_9(int x) { return x * 9; }
+inline int f6926_10(int x) { return x * 10; }
+inline int f6926_11(int x) { return x * 11; }
+inline int f6926_12(int x) { return x * 12; }
+inline int f6926_13(int x) { return x * 13; }
+inline int f6926_14(int x) { return x * 14; }
+inline int f6926_15(int x) { return x * 15; }
+inline int f6926_16(int x) { return x * 16; }
+inline int f6926_17(int x) { return x * 17; }
+inline int f6926_18(int x) { return x * 18; }
+inline int f6926_19(int x) { return x * 19; }
+inline int f6926_20(int x) { return x * 20; }
+inline int f6926_21(int x) { return x * 21; }
+inline int f6926_22(int x) { return x * 22; }
+inline int f6926_23(int x) { return x * 23; }
+inline int f6926_24(int x) { return x * 24; }
+inline int f6926_25(int x) { return x * 25; }
+inline int f6926_26(int x) { return x * 26; }
+inline int f6926_27(int x) { return x * 27; }
+inline int f6926_28(int x) { return x * 28; }
+inline int f6926_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6928 */
+#include <vector>
+#include "h2907.h"
+#include "h7482.h"
+#include "h2090.h"
+#include "h9866.h"
+#include "h2710.h"
+#ifdef X
+#include "h8518.h"
+#endif
+struct S6928 { int a; const char *s = "x//y"; };
+inline int f6928_0(int x) { return x * 0; }
+inline int f6928_1(int x) { return x * 1; }
+inline int f6928_2(int x) { return x * 2; }
+inline int f6928_3(int x) { return x * 3; }
+inline int f6928_4(int x) { return x * 4; }
+inline int f6928_5(int x) { return x * 5; }
+inline int f6928_6(int x) { return x * 6; }
+inline int f6928_7(int x) { return x * 7; }
+inline int f6928_8(int x) { return x * 8; }
+inline int f6928_9(int x) { return x * 9; }
+inline int f6928_10(int x) { return x * 10; }
+inline int f6928_11(int x) { return x * 11; }
+inline int f6928_12(int x) { return x * 12; }
+inline int f6928_13(int x) { return x * 13; }
+inline int f6928_14(int x) { return x * 14; }
+inline int f6928_15(int x) { return x * 15; }
+inline int f6928_16(int x) { return x * 16; }
+inline int f6928_17(int x) { return x * 17; }
+inline int f6928_18(int x) { return x * 18; }
+inline int f6928_19(int x) { return x * 19; }
+inline int f6928_20(int x) { return x * 20; }
+inline int f6928_21(int x) { return x * 21; }
+inline int f6928_22(int x) { return x * 22; }
+inline int f6928_23(int x) { return x * 23; }
+inline int f6928_24(int x) { return x * 24; }
+inline int f6928_25(int x) { return x * 25; }
+inline int f6928_26(int x) { return x * 26; }
+inline int f6928_27(int x) { return x * 27; }
+inline int f6928_28(int x) { return x * 28; }
+inline int f6928_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6929 */
+#include <vector>
+#include "h8454.h"
+#include "h6208.h"
+#include "h7313.h"
+#include "h4671.h"
+#include "h5117.h"
+#ifdef X
+#include "h8826.h"
+#endif
+struct S6929 { int a; const char *s = "x//y"; };
+inline int f6929_0(int x) { return x * 0; }
+inline int f6929_1(int x) { return x * 1; }
+inline int f6929_2(int x) { return x * 2; }
+inline int f6929_3(int x) { return x * 3; }
+inline int f6929_4(int x) { return x * 4; }
+inline int f6929_5(int x) { return x * 5; }
+inline int f6929_6(int x) { return x * 6; }
+inline int f6929_7(int x) { return x * 7; }
+inline int f6929_8(int x) { return x * 8; }
+inline int f6929_9(int x) { return x * 9; }
+inline int f6929_10(int x) { return x * 10; }
+inline int f6929_11(int x) { return x * 11; }
+inline int f6929_12(int x) { return x * 12; }
+inline int f6929_13(int x) { return x * 13; }
+inline int f6929_14(int x) { return x * 14; }
+inline int f6929_15(int x) { return x * 15; }
+inline int f6929_16(int x) { return x * 16; }
+inline int f6929_17(int x) { return x * 17; }
+inline int f6929_18(int x) { return x * 18; }
+inline int f6929_19(int x) { return x * 19; }
+inline int f6929_20(int x) { return x * 20; }
+inline int f6929_21(int x) { return x * 21; }
+inline int f6929_22(int x) { return x * 22; }
+inline int f6929_23(int x) { return x * 23; }
+inline int f6929_24(int x) { return x * 24; }
+inline int f6929_25(int x) { return x * 25; }
+inline int f6929_26(int x) { return x * 26; }
+inline int f6929_27(int x) { return x * 27; }
+inline int f6929_28(int x) { return x * 28; }
+inline int f6929_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 693 */
+#include <vector>
+#include "h5126.h"
+#include "h4354.h"
+#include "h2502.h"
+#include "h4960.h"
+#include "h5200.h"
+#ifdef X
+#include "h6096.h"
+#endif
+struct S693 { int a; const char *s = "x//y"; };
+inline int f693_0(int x) { return x * 0; }
+inline int f693_1(int x) { return x * 1; }
+inline int f693_2(int x) { return x * 2; }
+inline int f693_3(int x) { return x * 3; }
+inline int f693_4(int x) { return x * 4; }
+inline int f693_5(int x) { return x * 5; }
+inline int f693_6(int x) { return x * 6; }
+inline int f693_7(int x) { return x * 7; }
+inline int f693_8(int x) { return x * 8; }
+inline int f693_9(int x) { return x * 9; }
+inline int f693_10(int x) { return x * 10; }
+inline int f693_11(int x) { return x * 11; }
+inline int f693_12(int x) { return x * 12; }
+inline int f693_13(int x) { return x * 13; }
+inline int f693_14(int x) { return x * 14; }
+inline int f693_15(int x) { return x * 15; }
+inline int f693_16(int x) { return x * 16; }
+inline int f693_17(int x) { return x * 17; }
+inline int f693_18(int x) { return x * 18; }
+inline int f693_19(int x) { return x * 19; }
+inline int f693_20(int x) { return x * 20; }
+inline int f693_21(int x) { return x * 21; }
+inline int f693_22(int x) { return x * 22; }
+inline int f693_23(int x) { return x * 23; }
+inline int f693_24(int x) { return x * 24; }
+inline int f693_25(int x) { return x * 25; }
+inline int f693_26(int x) { return x * 26; }
+inline int f693_27(int x) { return x * 27; }
+inline int f693_28(int x) { return x * 28; }
+inline int f693_29(int x) { return x * 29; }
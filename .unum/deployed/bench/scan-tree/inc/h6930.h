@@ -0,0 +1,42 @@
+#pragma once
+/* header 6930 */
+#include <vector>
+#include "h4560.h"
+#include "h9134.h"
+#include "h1112.h"
+#include "h8565.h"
+#include "h6265.h"
+#ifdef X
+#include "h7609.h"
+#endif
+struct S6930 { int a; const char *s = "x//y"; };
+inline int f6930_0(int x) { return x * 0; }
+inline int f6930_1(int x) { return x * 1; }
+inline int f6930_2(int x) { return x * 2; }
+inline int f6930_3(int x) { return x * 3; }
+inline int f6930_4(int x) { return x * 4; }
+inline int f6930_5(int x) { return x * 5; }
+inline int f6930_6(int x) { return x * 6; }
+inline int f6930_7(int x) { return x * 7; }
+inline int f6930_8(int x) { return x * 8; }
+inline int f6930_9(int x) { return x * 9; }
+inline int f6930_10(int x) { return x * 10; }
+inline int f6930_11(int x) { return x * 11; }
+inline int f6930_12(int x) { return x * 12; }
+inline int f6930_13(int x) { return x * 13; }
+inline int f6930_14(int x) { return x * 14; }
+inline int f6930_15(int x) { return x * 15; }
+inline int f6930_16(int x) { return x * 16; }
+inline int f6930_17(int x) { return x * 17; }
+inline int f6930_18(int x) { return x * 18; }
+inline int f6930_19(int x) { return x * 19; }
+inline int f6930_20(int x) { return x * 20; }
+inline int f6930_21(int x) { return x * 21; }
+inline int f6930_22(int x) { return x * 22; }
+inline int f6930_23(int x) { return x * 23; }
+inline int f6930_24(int x) { return x * 24; }
+inline int f6930_25(int x) { return x * 25; }
+inline int f6930_26(int x) { return x * 26; }
+inline int f6930_27(int x) { return x * 27; }
+inline int f6930_28(int x) { return x * 28; }
+inline int f6930_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6931 */
+#include <vector>
+#include "h7939.h"
+#include "h2474.h"
+#include "h7399.h"
+#include "h2671.h"
+#include "h1339.h"
+#ifdef X
+#include "h2704.h"
+#endif
+struct S6931 { int a; const char *s = "x//y"; };
+inline int f6931_0(int x) { return x * 0; }
+inline int f6931_1(int x) { return x * 1; }
+inline int f6931_2(int x) { return x * 2; }
+inline int f6931_3(int x) { return x * 3; }
+inline int f6931_4(int x) { return x * 4; }
+inline int f6931_5(int x) { return x * 5; }
+inline int f6931_6(int x) { return x * 6; }
+inline int f6931_7(int x) { return x * 7; }
+inline int f6931_8(int x) { return x * 8; }
+inline int f6931_9(int x) { return x * 9; }
+inline int f6931_10(int x) { return x * 10; }
+inline int f6931_11(int x) { return x * 11; }
+inline int f6931_12(int x) { return x * 12; }
+inline int f6931_13(int x) { return x * 13; }
+inline int f6931_14(int x) { return x * 14; }
+inline int f6931_15(int x) { return x * 15; }
+inline int f6931_16(int x) { return x * 16; }
+inline int f6931_17(int x) { return x * 17; }
+inline int f6931_18(int x) { return x * 18; }
+inline int f6931_19(int x) { return x * 19; }
+inline int f6931_20(int x) { return x * 20; }
+inline int f6931_21(int x) { return x * 21; }
+inline int f6931_22(int x) { return x * 22; }
+inline int f6931_23(int x) { return x * 23; }
+inline int f6931_24(int x) { return x * 24; }
+inline int f6931_25(int x) { return x * 25; }
+inline int f6931_26(int x) { return x * 26; }
+inline int f6931_27(int x) { return x * 27; }
+inline int f6931_28(int x) { return x * 28; }
+inline int f6931_29(int x) { return x * 29; }
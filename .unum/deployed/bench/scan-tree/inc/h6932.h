@@ -0,0 +1,42 @@
+#pragma once
+/* header 6932 */
+#include <vector>
+#include "h9581.h"
+#include "h6158.h"
+#include "h890.h"
+#include "h4084.h"
+#include "h5416.h"
+#ifdef X
+#include "h663.h"
+#endif
+struct S6932 { int a; const char *s = "x//y"; };
+inline int f6932_0(int x) { return x * 0; }
+inline int f6932_1(int x) { return x * 1; }
+inline int f6932_2(int x) { return x * 2; }
+inline int f6932_3(int x) { return x * 3; }
+inline int f6932_4(int x) { return x * 4; }
+inline int f6932_5(int x) { return x * 5; }
+inline int f6932_6(int x) { return x * 6; }
+inline int f6932_7(int x) { return x * 7; }
+inline int f6932_8(int x) { return x * 8; }
+inline int f6932_9(int x) { return x * 9; }
+inline int f6932_10(int x) { return x * 10; }
+inline int f6932_11(int x) { return x * 11; }
+inline int f6932_12(int x) { return x * 12; }
+inline int f6932_13(int x) { return x * 13; }
+inline int f6932_14(int x) { return x * 14; }
+inline int f6932_15(int x) { return x * 15; }
+inline int f6932_16(int x) { return x * 16; }
+inline int f6932_17(int x) { return x * 17; }
+inline int f6932_18(int x) { return x * 18; }
+inline int f6932_19(int x) { return x * 19; }
+inline int f6932_20(int x) { return x * 20; }
+inline int f6932_21(int x) { return x * 21; }
+inline int f6932_22(int x) { return x * 22; }
+inline int f6932_23(int x) { return x * 23; }
+inline int f6932_24(int x) { return x * 24; }
+inline int f6932_25(int x) { return x * 25; }
+inline int f6932_26(int x) { return x * 26; }
+inline int f6932_27(int x) { return x * 27; }
+inline int f6932_28(int x) { return x * 28; }
+inline int f6932_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6933 */
+#include <vector>
+#include "h9159.h"
+#include "h691.h"
+#include "h5468.h"
+#include "h1052.h"
+#include "h4483.h"
+#ifdef X
+#include "h8086.h"
+#endif
+struct S6933 { int a; const char *s = "x//y"; };
+inline int f6933_0(int x) { return x * 0; }
+inline int f6933_1(int x) { return x * 1; }
+inline int f6933_2(int x) { return x * 2; }
+inline int f6933_3(int x) { return x * 3; }
+inline int f6933_4(int x) { return x * 4; }
+inline int f6933_5(int x) { return x * 5; }
+inline int f6933_6(int x) { return x * 6; }
+inline int f6933_7(int x) { return x * 7; }
+inline int f6933_8(int x) { return x * 8; }
+inline int f6933_9(int x) { return x * 9; }
+inline int f6933_10(int x) { return x * 10; }
+inline int f6933_11(int x) { return x * 11; }
+inline int f6933_12(int x) { return x * 12; }
+inline int f6933_13(int x) { return x * 13; }
+inline int f6933_14(int x) { return x * 14; }
+inline int f6933_15(int x) { return x * 15; }
+inline int f6933_16(int x) { return x * 16; }
+inline int f6933_17(int x) { return x * 17; }
+inline int f6933_18(int x) { return x * 18; }
+inline int f6933_19(int x) { return x * 19; }
+inline int f6933_20(int x) { return x * 20; }
+inline int f6933_21(int x) { return x * 21; }
+inline int f6933_22(int x) { return x * 22; }
+inline int f6933_23(int x) { return x * 23; }
+inline int f6933_24(int x) { return x * 24; }
+inline int f6933_25(int x) { return x * 25; }
+inline int f6933_26(int x) { return x * 26; }
+inline int f6933_27(int x) { return x * 27; }
+inline int f6933_28(int x) { return x * 28; }
+inline int f6933_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6936 */
+#include <vector>
+#include "h8249.h"
+#include "h2065.h"
+#include "h3947.h"
+#include "h8758.h"
+#include "h512.h"
+#ifdef X
+#include "h792.h"
+#endif
+struct S6936 { int a; const char *s = "x//y"; };
+inline int f6936_0(int x) { return x * 0; }
+inline int f6936_1(int x) { return x * 1; }
+inline int f6936_2(int x) { return x * 2; }
+inline int f6936_3(int x) { return x * 3; }
+inline int f6936_4(int x) { return x * 4; }
+inline int f6936_5(int x) { return x * 5; }
+inline int f6936_6(int x) { return x * 6; }
+inline int f6936_7(int x) { return x * 7; }
+inline int f6936_8(int x) { return x * 8; }
+inline int f6936_9(int x) { return x * 9; }
+inline int f6936_10(int x) { return x * 10; }
+inline int f6936_11(int x) { return x * 11; }
+inline int f6936_12(int x) { return x * 12; }
+inline int f6936_13(int x) { return x * 13; }
+inline int f6936_14(int x) { return x * 14; }
+inline int f6936_15(int x) { return x * 15; }
+inline int f6936_16(int x) { return x * 16; }
+inline int f6936_17(int x) { return x * 17; }
+inline int f6936_18(int x) { return x * 18; }
+inline int f6936_19(int x) { return x * 19; }
+inline int f6936_20(int x) { return x * 20; }
+inline int f6936_21(int x) { return x * 21; }
+inline int f6936_22(int x) { return x * 22; }
+inline int f6936_23(int x) { return x * 23; }
+inline int f6936_24(int x) { return x * 24; }
+inline int f6936_25(int x) { return x * 25; }
+inline int f6936_26(int x) { return x * 26; }
+inline int f6936_27(int x) { return x * 27; }
+inline int f6936_28(int x) { return x * 28; }
+inline int f6936_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6937 */
+#include <vector>
+#include "h6097.h"
+#include "h6817.h"
+#include "h6260.h"
+#include "h3427.h"
+#include "h929.h"
+#ifdef X
+#include "h5234.h"
+#endif
+struct S6937 { int a; const char *s = "x//y"; };
+inline int f6937_0(int x) { return x * 0; }
+inline int f6937_1(int x) { return x * 1; }
+inline int f6937_2(int x) { return x * 2; }
+inline int f6937_3(int x) { return x * 3; }
+inline int f6937_4(int x) { return x * 4; }
+inline int f6937_5(int x) { return x * 5; }
+inline int f6937_6(int x) { return x * 6; }
+inline int f6937_7(int x) { return x * 7; }
+inline int f6937_8(int x) { return x * 8; }
+inline int f6937_9(int x) { return x * 9; }
+inline int f6937_10(int x) { return x * 10; }
+inline int f6937_11(int x) { return x * 11; }
+inline int f6937_12(int x) { return x * 12; }
+inline int f6937_13(int x) { return x * 13; }
+inline int f6937_14(int x) { return x * 14; }
+inline int f6937_15(int x) { return x * 15; }
+inline int f6937_16(int x) { return x * 16; }
+inline int f6937_17(int x) { return x * 17; }
+inline int f6937_18(int x) { return x * 18; }
+inline int f6937_19(int x) { return x * 19; }
+inline int f6937_20(int x) { return x * 20; }
+inline int f6937_21(int x) { return x * 21; }
+inline int f6937_22(int x) { return x * 22; }
+inline int f6937_23(int x) { return x * 23; }
+inline int f6937_24(int x) { return x * 24; }
+inline int f6937_25(int x) { return x * 25; }
+inline int f6937_26(int x) { return x * 26; }
+inline int f6937_27(int x) { return x * 27; }
+inline int f6937_28(int x) { return x * 28; }
+inline int f6937_29(int x) { return x * 29; }
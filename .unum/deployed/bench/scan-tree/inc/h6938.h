@@ -0,0 +1,42 @@
+#pragma once
+/* header 6938 */
+#include <vector>
+#include "h7756.h"
+#include "h6694.h"
+#include "h2678.h"
+#include "h3783.h"
+#include "h5026.h"
+#ifdef X
+#include "h242.h"
+#endif
+struct S6938 { int a; const char *s = "x//y"; };
+inline int f6938_0(int x) { return x * 0; }
+inline int f6938_1(int x) { return x * 1; }
+inline int f6938_2(int x) { return x * 2; }
+inline int f6938_3(int x) { return x * 3; }
+inline int f6938_4(int x) { return x * 4; }
+inline int f6938_5(int x) { return x * 5; }
+inline int f6938_6(int x) { return x * 6; }
+inline int f6938_7(int x) { return x * 7; }
+inline int f6938_8(int x) { return x * 8; }
+inline int f6938_9(int x) { return x * 9; }
+inline int f6938_10(int x) { return x * 10; }
+inline int f6938_11(int x) { return x * 11; }
+inline int f6938_12(int x) { return x * 12; }
+inline int f6938_13(int x) { return x * 13; }
+inline int f6938_14(int x) { return x * 14; }
+inline int f6938_15(int x) { return x * 15; }
+inline int f6938_16(int x) { return x * 16; }
+inline int f6938_17(int x) { return x * 17; }
+inline int f6938_18(int x) { return x * 18; }
+inline int f6938_19(int x) { return x * 19; }
+inline int f6938_20(int x) { return x * 20; }
+inline int f6938_21(int x) { return x * 21; }
+inline int f6938_22(int x) { return x * 22; }
+inline int f6938_23(int x) { return x * 23; }
+inline int f6938_24(int x) { return x * 24; }
+inline int f6938_25(int x) { return x * 25; }
+inline int f6938_26(int x) { return x * 26; }
+inline int f6938_27(int x) { return x * 27; }
+inline int f6938_28(int x) { return x * 28; }
+inline int f6938_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 694 */
+#include <vector>
+#include "h4270.h"
+#include "h3343.h"
+#include "h3390.h"
+#include "h2050.h"
+#include "h9452.h"
+#ifdef X
+#include "h3438.h"
+#endif
+struct S694 { int a; const char *s = "x//y"; };
+inline int f694_0(int x) { return x * 0; }
+inline int f694_1(int x) { return x * 1; }
+inline int f694_2(int x) { return x * 2; }
+inline int f694_3(int x) { return x * 3; }
+inline int f694_4(int x) { return x * 4; }
+inline int f694_5(int x) { return x * 5; }
+inline int f694_6(int x) { return x * 6; }
+inline int f694_7(int x) { return x * 7; }
+inline int f694_8(int x) { return x * 8; }
+inline int f694_9(int x) { return x * 9; }
+inline int f694_10(int x) { return x * 10; }
+inline int f694_11(int x) { return x * 11; }
+inline int f694_12(int x) { return x * 12; }
+inline int f694_13(int x) { return x * 13; }
+inline int f694_14(int x) { return x * 14; }
+inline int f694_15(int x) { return x * 15; }
+inline int f694_16(int x) { return x * 16; }
+inline int f694_17(int x) { return x * 17; }
+inline int f694_18(int x) { return x * 18; }
+inline int f694_19(int x) { return x * 19; }
+inline int f694_20(int x) { return x * 20; }
+inline int f694_21(int x) { return x * 21; }
+inline int f694_22(int x) { return x * 22; }
+inline int f694_23(int x) { return x * 23; }
+inline int f694_24(int x) { return x * 24; }
+inline int f694_25(int x) { return x * 25; }
+inline int f694_26(int x) { return x * 26; }
+inline int f694_27(int x) { return x * 27; }
+inline int f694_28(int x) { return x * 28; }
+inline int f694_29(int x) { return x * 29; }
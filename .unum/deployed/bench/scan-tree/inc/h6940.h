@@ -0,0 +1,42 @@
+#pragma once
+/* header 6940 */
+#include <vector>
+#include "h6257.h"
+#include "h9146.h"
+#include "h9658.h"
+#include "h2707.h"
+#include "h9027.h"
+#ifdef X
+#include "h2277.h"
+#endif
+struct S6940 { int a; const char *s = "x//y"; };
+inline int f6940_0(int x) { return x * 0; }
+inline int f6940_1(int x) { return x * 1; }
+inline int f6940_2(int x) { return x * 2; }
+inline int f6940_3(int x) { return x * 3; }
+inline int f6940_4(int x) { return x * 4; }
+inline int f6940_5(int x) { return x * 5; }
+inline int f6940_6(int x) { return x * 6; }
+inline int f6940_7(int x) { return x * 7; }
+inline int f6940_8(int x) { return x * 8; }
+inline int f6940_9(int x) { return x * 9; }
+inline int f6940_10(int x) { return x * 10; }
+inline int f6940_11(int x) { return x * 11; }
+inline int f6940_12(int x) { return x * 12; }
+inline int f6940_13(int x) { return x * 13; }
+inline int f6940_14(int x) { return x * 14; }
+inline int f6940_15(int x) { return x * 15; }
+inline int f6940_16(int x) { return x * 16; }
+inline int f6940_17(int x) { return x * 17; }
+inline int f6940_18(int x) { return x * 18; }
+inline int f6940_19(int x) { return x * 19; }
+inline int f6940_20(int x) { return x * 20; }
+inline int f6940_21(int x) { return x * 21; }
+inline int f6940_22(int x) { return x * 22; }
+inline int f6940_23(int x) { return x * 23; }
+inline int f6940_24(int x) { return x * 24; }
+inline int f6940_25(int x) { return x * 25; }
+inline int f6940_26(int x) { return x * 26; }
+inline int f6940_27(int x) { return x * 27; }
+inline int f6940_28(int x) { return x * 28; }
+inline int f6940_29(int x) { return x * 29; }
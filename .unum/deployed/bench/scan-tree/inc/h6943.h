@@ -0,0 +1,42 @@
+#pragma once
+/* header 6943 */
+#include <vector>
+#include "h9541.h"
+#include "h1989.h"
+#include "h7098.h"
+#include "h71.h"
+#include "h4624.h"
+#ifdef X
+#include "h8476.h"
+#endif
+struct S6943 { int a; const char *s = "x//y"; };
+inline int f6943_0(int x) { return x * 0; }
+inline int f6943_1(int x) { return x * 1; }
+inline int f6943_2(int x) { return x * 2; }
+inline int f6943_3(int x) { return x * 3; }
+inline int f6943_4(int x) { return x * 4; }
+inline int f6943_5(int x) { return x * 5; }
+inline int f6943_6(int x) { return x * 6; }
+inline int f6943_7(int x) { return x * 7; }
+inline int f6943_8(int x) { return x * 8; }
+inline int f6943_9(int x) { return x * 9; }
+inline int f6943_10(int x) { return x * 10; }
+inline int f6943_11(int x) { return x * 11; }
+inline int f6943_12(int x) { return x * 12; }
+inline int f6943_13(int x) { return x * 13; }
+inline int f6943_14(int x) { return x * 14; }
+inline int f6943_15(int x) { return x * 15; }
+inline int f6943_16(int x) { return x * 16; }
+inline int f6943_17(int x) { return x * 17; }
+inline int f6943_18(int x) { return x * 18; }
+inline int f6943_19(int x) { return x * 19; }
+inline int f6943_20(int x) { return x * 20; }
+inline int f6943_21(int x) { return x * 21; }
+inline int f6943_22(int x) { return x * 22; }
+inline int f6943_23(int x) { return x * 23; }
+inline int f6943_24(int x) { return x * 24; }
+inline int f6943_25(int x) { return x * 25; }
+inline int f6943_26(int x) { return x * 26; }
+inline int f6943_27(int x) { return x * 27; }
+inline int f6943_28(int x) { return x * 28; }
+inline int f6943_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6945 */
+#include <vector>
+#include "h7537.h"
+#include "h4010.h"
+#include "h323.h"
+#include "h2396.h"
+#include "h36.h"
+#ifdef X
+#include "h3858.h"
+#endif
+struct S6945 { int a; const char *s = "x//y"; };
+inline int f6945_0(int x) { return x * 0; }
+inline int f6945_1(int x) { return x * 1; }
+inline int f6945_2(int x) { return x * 2; }
+inline int f6945_3(int x) { return x * 3; }
+inline int f6945_4(int x) { return x * 4; }
+inline int f6945_5(int x) { return x * 5; }
+inline int f6945_6(int x) { return x * 6; }
+inline int f6945_7(int x) { return x * 7; }
+inline int f6945_8(int x) { return x * 8; }
+inline int f6945_9(int x) { return x * 9; }
+inline int f6945_10(int x) { return x * 10; }
+inline int f6945_11(int x) { return x * 11; }
+inline int f6945_12(int x) { return x * 12; }
+inline int f6945_13(int x) { return x * 13; }
+inline int f6945_14(int x) { return x * 14; }
+inline int f6945_15(int x) { return x * 15; }
+inline int f6945_16(int x) { return x * 16; }
+inline int f6945_17(int x) { return x * 17; }
+inline int f6945_18(int x) { return x * 18; }
+inline int f6945_19(int x) { return x * 19; }
+inline int f6945_20(int x) { return x * 20; }
+inline int f6945_21(int x) { return x * 21; }
+inline int f6945_22(int x) { return x * 22; }
+inline int f6945_23(int x) { return x * 23; }
+inline int f6945_24(int x) { return x * 24; }
+inline int f6945_25(int x) { return x * 25; }
+inline int f6945_26(int x) { return x * 26; }
+inline int f6945_27(int x) { return x * 27; }
+inline int f6945_28(int x) { return x * 28; }
+inline int f6945_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6948 */
+#include <vector>
+#include "h9412.h"
+#include "h8575.h"
+#include "h6657.h"
+#include "h3529.h"
+#include "h6691.h"
+#ifdef X
+#include "h6379.h"
+#endif
+struct S6948 { int a; const char *s = "x//y"; };
+inline int f6948_0(int x) { return x * 0; }
+inline int f6948_1(int x) { return x * 1; }
+inline int f6948_2(int x) { return x * 2; }
+inline int f6948_3(int x) { return x * 3; }
+inline int f6948_4(int x) { return x * 4; }
+inline int f6948_5(int x) { return x * 5; }
+inline int f6948_6(int x) { return x * 6; }
+inline int f6948_7(int x) { return x * 7; }
+inline int f6948_8(int x) { return x * 8; }
+inline int f6948_9(int x) { return x * 9; }
+inline int f6948_10(int x) { return x * 10; }
+inline int f6948_11(int x) { return x * 11; }
+inline int f6948_12(int x) { return x * 12; }
+inline int f6948_13(int x) { return x * 13; }
+inline int f6948_14(int x) { return x * 14; }
+inline int f6948_15(int x) { return x * 15; }
+inline int f6948_16(int x) { return x * 16; }
+inline int f6948_17(int x) { return x * 17; }
+inline int f6948_18(int x) { return x * 18; }
+inline int f6948_19(int x) { return x * 19; }
+inline int f6948_20(int x) { return x * 20; }
+inline int f6948_21(int x) { return x * 21; }
+inline int f6948_22(int x) { return x * 22; }
+inline int f6948_23(int x) { return x * 23; }
+inline int f6948_24(int x) { return x * 24; }
+inline int f6948_25(int x) { return x * 25; }
+inline int f6948_26(int x) { return x * 26; }
+inline int f6948_27(int x) { return x * 27; }
+inline int f6948_28(int x) { return x * 28; }
+inline int f6948_29(int x) { return x * 29; }
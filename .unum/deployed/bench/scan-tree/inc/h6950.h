@@ -0,0 +1,42 @@
+#pragma once
+/* header 6950 */
+#include <vector>
+#include "h1532.h"
+#include "h2308.h"
+#include "h4741.h"
+#include "h6265.h"
+#include "h978.h"
+#ifdef X
+#include "h8700.h"
+#endif
+struct S6950 { int a; const char *s = "x//y"; };
+inline int f6950_0(int x) { return x * 0; }
+inline int f6950_1(int x) { return x * 1; }
+inline int f6950_2(int x) { return x * 2; }
+inline int f6950_3(int x) { return x * 3; }
+inline int f6950_4(int x) { return x * 4; }
+inline int f6950_5(int x) { return x * 5; }
+inline int f6950_6(int x) { return x * 6; }
+inline int f6950_7(int x) { return x * 7; }
+inline int f6950_8(int x) { return x * 8; }
+inline int f6950_9(int x) { return x * 9; }
+inline int f6950_10(int x) { return x * 10; }
+inline int f6950_11(int x) { return x * 11; }
+inline int f6950_12(int x) { return x * 12; }
+inline int f6950_13(int x) { return x * 13; }
+inline int f6950_14(int x) { return x * 14; }
+inline int f6950_15(int x) { return x * 15; }
+inline int f6950_16(int x) { return x * 16; }
+inline int f6950_17(int x) { return x * 17; }
+inline int f6950_18(int x) { return x * 18; }
+inline int f6950_19(int x) { return x * 19; }
+inline int f6950_20(int x) { return x * 20; }
+inline int f6950_21(int x) { return x * 21; }
+inline int f6950_22(int x) { return x * 22; }
+inline int f6950_23(int x) { return x * 23; }
+inline int f6950_24(int x) { return x * 24; }
+inline int f6950_25(int x) { return x * 25; }
+inline int f6950_26(int x) { return x * 26; }
+inline int f6950_27(int x) { return x * 27; }
+inline int f6950_28(int x) { return x * 28; }
+inline int f6950_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6952 */
+#include <vector>
+#include "h283.h"
+#include "h8433.h"
+#include "h1135.h"
+#include "h6654.h"
+#include "h3206.h"
+#ifdef X
+#include "h8920.h"
+#endif
+struct S6952 { int a; const char *s = "x//y"; };
+inline int f6952_0(int x) { return x * 0; }
+inline int f6952_1(int x) { return x * 1; }
+inline int f6952_2(int x) { return x * 2; }
+inline int f6952_3(int x) { return x * 3; }
+inline int f6952_4(int x) { return x * 4; }
+inline int f6952_5(int x) { return x * 5; }
+inline int f6952_6(int x) { return x * 6; }
+inline int f6952_7(int x) { return x * 7; }
+inline int f6952_8(int x) { return x * 8; }
+inline int f6952_9(int x) { return x * 9; }
+inline int f6952_10(int x) { return x * 10; }
+inline int f6952_11(int x) { return x * 11; }
+inline int f6952_12(int x) { return x * 12; }
+inline int f6952_13(int x) { return x * 13; }
+inline int f6952_14(int x) { return x * 14; }
+inline int f6952_15(int x) { return x * 15; }
+inline int f6952_16(int x) { return x * 16; }
+inline int f6952_17(int x) { return x * 17; }
+inline int f6952_18(int x) { return x * 18; }
+inline int f6952_19(int x) { return x * 19; }
+inline int f6952_20(int x) { return x * 20; }
+inline int f6952_21(int x) { return x * 21; }
+inline int f6952_22(int x) { return x * 22; }
+inline int f6952_23(int x) { return x * 23; }
+inline int f6952_24(int x) { return x * 24; }
+inline int f6952_25(int x) { return x * 25; }
+inline int f6952_26(int x) { return x * 26; }
+inline int f6952_27(int x) { return x * 27; }
+inline int f6952_28(int x) { return x * 28; }
+inline int f6952_29(int x) { return x * 29; }
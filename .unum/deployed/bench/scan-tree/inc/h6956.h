@@ -0,0 +1,42 @@
+#pragma once
+/* header 6956 */
+#include <vector>
+#include "h728.h"
+#include "h9694.h"
+#include "h7132.h"
+#include "h6553.h"
+#include "h4030.h"
+#ifdef X
+#include "h6604.h"
+#endif
+struct S6956 { int a; const char *s = "x//y"; };
+inline int f6956_0(int x) { return x * 0; }
+inline int f6956_1(int x) { return x * 1; }
+inline int f6956_2(int x) { return x * 2; }
+inline int f6956_3(int x) { return x * 3; }
+inline int f6956_4(int x) { return x * 4; }
+inline int f6956_5(int x) { return x * 5; }
+inline int f6956_6(int x) { return x * 6; }
+inline int f6956_7(int x) { return x * 7; }
+inline int f6956_8(int x) { return x * 8; }
+inline int f6956_9(int x) { return x * 9; }
+inline int f6956_10(int x) { return x * 10; }
+inline int f6956_11(int x) { return x * 11; }
+inline int f6956_12(int x) { return x * 12; }
+inline int f6956_13(int x) { return x * 13; }
+inline int f6956_14(int x) { return x * 14; }
+inline int f6956_15(int x) { return x * 15; }
+inline int f6956_16(int x) { return x * 16; }
+inline int f6956_17(int x) { return x * 17; }
+inline int f6956_18(int x) { return x * 18; }
+inline int f6956_19(int x) { return x * 19; }
+inline int f6956_20(int x) { return x * 20; }
+inline int f6956_21(int x) { return x * 21; }
+inline int f6956_22(int x) { return x * 22; }
+inline int f6956_23(int x) { return x * 23; }
+inline int f6956_24(int x) { return x * 24; }
+inline int f6956_25(int x) { return x * 25; }
+inline int f6956_26(int x) { return x * 26; }
+inline int f6956_27(int x) { return x * 27; }
+inline int f6956_28(int x) { return x * 28; }
+inline int f6956_29(int x) { return x * 29; }
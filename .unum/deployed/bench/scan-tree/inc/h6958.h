@@ -0,0 +1,42 @@
+#pragma once
+/* header 6958 */
+#include <vector>
+#include "h9345.h"
+#include "h8237.h"
+#include "h6003.h"
+#include "h3929.h"
+#include "h1553.h"
+#ifdef X
+#include "h9326.h"
+#endif
+struct S6958 { int a; const char *s = "x//y"; };
+inline int f6958_0(int x) { return x * 0; }
+inline int f6958_1(int x) { return x * 1; }
+inline int f6958_2(int x) { return x * 2; }
+inline int f6958_3(int x) { return x * 3; }
+inline int f6958_4(int x) { return x * 4; }
+inline int f6958_5(int x) { return x * 5; }
+inline int f6958_6(int x) { return x * 6; }
+inline int f6958_7(int x) { return x * 7; }
+inline int f6958_8(int x) { return x * 8; }
+inline int f6958_9(int x) { return x * 9; }
+inline int f6958_10(int x) { return x * 10; }
+inline int f6958_11(int x) { return x * 11; }
+inline int f6958_12(int x) { return x * 12; }
+inline int f6958_13(int x) { return x * 13; }
+inline int f6958_14(int x) { return x * 14; }
+inline int f6958_15(int x) { return x * 15; }
+inline int f6958_16(int x) { return x * 16; }
+inline int f6958_17(int x) { return x * 17; }
+inline int f6958_18(int x) { return x * 18; }
+inline int f6958_19(int x) { return x * 19; }
+inline int f6958_20(int x) { return x * 20; }
+inline int f6958_21(int x) { return x * 21; }
+inline int f6958_22(int x) { return x * 22; }
+inline int f6958_23(int x) { return x * 23; }
+inline int f6958_24(int x) { return x * 24; }
+inline int f6958_25(int x) { return x * 25; }
+inline int f6958_26(int x) { return x * 26; }
+inline int f6958_27(int x) { return x * 27; }
+inline int f6958_28(int x) { return x * 28; }
+inline int f6958_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6959 */
+#include <vector>
+#include "h9738.h"
+#include "h2728.h"
+#include "h6163.h"
+#include "h2005.h"
+#include "h9619.h"
+#ifdef X
+#include "h7980.h"
+#endif
+struct S6959 { int a; const char *s = "x//y"; };
+inline int f6959_0(int x) { return x * 0; }
+inline int f6959_1(int x) { return x * 1; }
+inline int f6959_2(int x) { return x * 2; }
+inline int f6959_3(int x) { return x * 3; }
+inline int f6959_4(int x) { return x * 4; }
+inline int f6959_5(int x) { return x * 5; }
+inline int f6959_6(int x) { return x * 6; }
+inline int f6959_7(int x) { return x * 7; }
+inline int f6959_8(int x) { return x * 8; }
+inline int f6959_9(int x) { return x * 9; }
+inline int f6959_10(int x) { return x * 10; }
+inline int f6959_11(int x) { return x * 11; }
+inline int f6959_12(int x) { return x * 12; }
+inline int f6959_13(int x) { return x * 13; }
+inline int f6959_14(int x) { return x * 14; }
+inline int f6959_15(int x) { return x * 15; }
+inline int f6959_16(int x) { return x * 16; }
+inline int f6959_17(int x) { return x * 17; }
+inline int f6959_18(int x) { return x * 18; }
+inline int f6959_19(int x) { return x * 19; }
+inline int f6959_20(int x) { return x * 20; }
+inline int f6959_21(int x) { return x * 21; }
+inline int f6959_22(int x) { return x * 22; }
+inline int f6959_23(int x) { return x * 23; }
+inline int f6959_24(int x) { return x * 24; }
+inline int f6959_25(int x) { return x * 25; }
+inline int f6959_26(int x) { return x * 26; }
+inline int f6959_27(int x) { return x * 27; }
+inline int f6959_28(int x) { return x * 28; }
+inline int f6959_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6966 */
+#include <vector>
+#include "h6902.h"
+#include "h8748.h"
+#include "h2086.h"
+#include "h3715.h"
+#include "h6540.h"
+#ifdef X
+#include "h801.h"
+#endif
+struct S6966 { int a; const char *s = "x//y"; };
+inline int f6966_0(int x) { return x * 0; }
+inline int f6966_1(int x) { return x * 1; }
+inline int f6966_2(int x) { return x * 2; }
+inline int f6966_3(int x) { return x * 3; }
+inline int f6966_4(int x) { return x * 4; }
+inline int f6966_5(int x) { return x * 5; }
+inline int f6966_6(int x) { return x * 6; }
+inline int f6966_7(int x) { return x * 7; }
+inline int f6966_8(int x) { return x * 8; }
+inline int f6966_9(int x) { return x * 9; }
+inline int f6966_10(int x) { return x * 10; }
+inline int f6966_11(int x) { return x * 11; }
+inline int f6966_12(int x) { return x * 12; }
+inline int f6966_13(int x) { return x * 13; }
+inline int f6966_14(int x) { return x * 14; }
+inline int f6966_15(int x) { return x * 15; }
+inline int f6966_16(int x) { return x * 16; }
+inline int f6966_17(int x) { return x * 17; }
+inline int f6966_18(int x) { return x * 18; }
+inline int f6966_19(int x) { return x * 19; }
+inline int f6966_20(int x) { return x * 20; }
+inline int f6966_21(int x) { return x * 21; }
+inline int f6966_22(int x) { return x * 22; }
+inline int f6966_23(int x) { return x * 23; }
+inline int f6966_24(int x) { return x * 24; }
+inline int f6966_25(int x) { return x * 25; }
+inline int f6966_26(int x) { return x * 26; }
+inline int f6966_27(int x) { return x * 27; }
+inline int f6966_28(int x) { return x * 28; }
+inline int f6966_29(int x) { return x * 29; }
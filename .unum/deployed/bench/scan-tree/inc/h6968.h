@@ -0,0 +1,42 @@
+#pragma once
+/* header 6968 */
+#include <vector>
+#include "h3909.h"
+#include "h136.h"
+#include "h5758.h"
+#include "h3.h"
+#include "h515.h"
+#ifdef X
+#include "h5796.h"
+#endif
+struct S6968 { int a; const char *s = "x//y"; };
+inline int f6968_0(int x) { return x * 0; }
+inline int f6968_1(int x) { return x * 1; }
+inline int f6968_2(int x) { return x * 2; }
+inline int f6968_3(int x) { return x * 3; }
+inline int f6968_4(int x) { return x * 4; }
+inline int f6968_5(int x) { return x * 5; }
+inline int f6968_6(int x) { return x * 6; }
+inline int f6968_7(int x) { return x * 7; }
+inline int f6968_8(int x) { return x * 8; }
+inline int f6968_9(int x) { return x * 9; }
+inline int f6968_10(int x) { return x * 10; }
+inline int f6968_11(int x) { return x * 11; }
+inline int f6968_12(int x) { return x * 12; }
+inline int f6968_13(int x) { return x * 13; }
+inline int f6968_14(int x) { return x * 14; }
+inline int f6968_15(int x) { return x * 15; }
+inline int f6968_16(int x) { return x * 16; }
+inline int f6968_17(int x) { return x * 17; }
+inline int f6968_18(int x) { return x * 18; }
+inline int f6968_19(int x) { return x * 19; }
+inline int f6968_20(int x) { return x * 20; }
+inline int f6968_21(int x) { return x * 21; }
+inline int f6968_22(int x) { return x * 22; }
+inline int f6968_23(int x) { return x * 23; }
+inline int f6968_24(int x) { return x * 24; }
+inline int f6968_25(int x) { return x * 25; }
+inline int f6968_26(int x) { return x * 26; }
+inline int f6968_27(int x) { return x * 27; }
+inline int f6968_28(int x) { return x * 28; }
+inline int f6968_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 697 */
+#include <vector>
+#include "h4831.h"
+#include "h8796.h"
+#include "h4464.h"
+#include "h7304.h"
+#include "h4079.h"
+#ifdef X
+#include "h7362.h"
+#endif
+struct S697 { int a; const char *s = "x//y"; };
+inline int f697_0(int x) { return x * 0; }
+inline int f697_1(int x) { return x * 1; }
+inline int f697_2(int x) { return x * 2; }
+inline int f697_3(int x) { return x * 3; }
+inline int f697_4(int x) { return x * 4; }
+inline int f697_5(int x) { return x * 5; }
+inline int f697_6(int x) { return x * 6; }
+inline int f697_7(int x) { return x * 7; }
+inline int f697_8(int x) { return x * 8; }
+inline int f697_9(int x) { return x * 9; }
+inline int f697_10(int x) { return x * 10; }
+inline int f697_11(int x) { return x * 11; }
+inline int f697_12(int x) { return x * 12; }
+inline int f697_13(int x) { return x * 13; }
+inline int f697_14(int x) { return x * 14; }
+inline int f697_15(int x) { return x * 15; }
+inline int f697_16(int x) { return x * 16; }
+inline int f697_17(int x) { return x * 17; }
+inline int f697_18(int x) { return x * 18; }
+inline int f697_19(int x) { return x * 19; }
+inline int f697_20(int x) { return x * 20; }
+inline int f697_21(int x) { return x * 21; }
+inline int f697_22(int x) { return x * 22; }
+inline int f697_23(int x) { return x * 23; }
+inline int f697_24(int x) { return x * 24; }
+inline int f697_25(int x) { return x * 25; }
+inline int f697_26(int x) { return x * 26; }
+inline int f697_27(int x) { return x * 27; }
+inline int f697_28(int x) { return x * 28; }
+inline int f697_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6970 */
+#include <vector>
+#include "h3293.h"
+#include "h3551.h"
+#include "h8334.h"
+#include "h1794.h"
+#include "h824.h"
+#ifdef X
+#include "h9710.h"
+#endif
+struct S6970 { int a; const char *s = "x//y"; };
+inline int f6970_0(int x) { return x * 0; }
+inline int f6970_1(int x) { return x * 1; }
+inline int f6970_2(int x) { return x * 2; }
+inline int f6970_3(int x) { return x * 3; }
+inline int f6970_4(int x) { return x * 4; }
+inline int f6970_5(int x) { return x * 5; }
+inline int f6970_6(int x) { return x * 6; }
+inline int f6970_7(int x) { return x * 7; }
+inline int f6970_8(int x) { return x * 8; }
+inline int f6970_9(int x) { return x * 9; }
+inline int f6970_10(int x) { return x * 10; }
+inline int f6970_11(int x) { return x * 11; }
+inline int f6970_12(int x) { return x * 12; }
+inline int f6970_13(int x) { return x * 13; }
+inline int f6970_14(int x) { return x * 14; }
+inline int f6970_15(int x) { return x * 15; }
+inline int f6970_16(int x) { return x * 16; }
+inline int f6970_17(int x) { return x * 17; }
+inline int f6970_18(int x) { return x * 18; }
+inline int f6970_19(int x) { return x * 19; }
+inline int f6970_20(int x) { return x * 20; }
+inline int f6970_21(int x) { return x * 21; }
+inline int f6970_22(int x) { return x * 22; }
+inline int f6970_23(int x) { return x * 23; }
+inline int f6970_24(int x) { return x * 24; }
+inline int f6970_25(int x) { return x * 25; }
+inline int f6970_26(int x) { return x * 26; }
+inline int f6970_27(int x) { return x * 27; }
+inline int f6970_28(int x) { return x * 28; }
+inline int f6970_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6972 */
+#include <vector>
+#include "h4476.h"
+#include "h2752.h"
+#include "h2559.h"
+#include "h1887.h"
+#include "h7827.h"
+#ifdef X
+#include "h7062.h"
+#endif
+struct S6972 { int a; const char *s = "x//y"; };
+inline int f6972_0(int x) { return x * 0; }
+inline int f6972_1(int x) { return x * 1; }
+inline int f6972_2(int x) { return x * 2; }
+inline int f6972_3(int x) { return x * 3; }
+inline int f6972_4(int x) { return x * 4; }
+inline int f6972_5(int x) { return x * 5; }
+inline int f6972_6(int x) { return x * 6; }
+inline int f6972_7(int x) { return x * 7; }
+inline int f6972_8(int x) { return x * 8; }
+inline int f6972_9(int x) { return x * 9; }
+inline int f6972_10(int x) { return x * 10; }
+inline int f6972_11(int x) { return x * 11; }
+inline int f6972_12(int x) { return x * 12; }
+inline int f6972_13(int x) { return x * 13; }
+inline int f6972_14(int x) { return x * 14; }
+inline int f6972_15(int x) { return x * 15; }
+inline int f6972_16(int x) { return x * 16; }
+inline int f6972_17(int x) { return x * 17; }
+inline int f6972_18(int x) { return x * 18; }
+inline int f6972_19(int x) { return x * 19; }
+inline int f6972_20(int x) { return x * 20; }
+inline int f6972_21(int x) { return x * 21; }
+inline int f6972_22(int x) { return x * 22; }
+inline int f6972_23(int x) { return x * 23; }
+inline int f6972_24(int x) { return x * 24; }
+inline int f6972_25(int x) { return x * 25; }
+inline int f6972_26(int x) { return x * 26; }
+inline int f6972_27(int x) { return x * 27; }
+inline int f6972_28(int x) { return x * 28; }
+inline int f6972_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6973 */
+#include <vector>
+#include "h1418.h"
+#include "h1420.h"
+#include "h6594.h"
+#include "h9270.h"
+#include "h1690.h"
+#ifdef X
+#include "h6786.h"
+#endif
+struct S6973 { int a; const char *s = "x//y"; };
+inline int f6973_0(int x) { return x * 0; }
+inline int f6973_1(int x) { return x * 1; }
+inline int f6973_2(int x) { return x * 2; }
+inline int f6973_3(int x) { return x * 3; }
+inline int f6973_4(int x) { return x * 4; }
+inline int f6973_5(int x) { return x * 5; }
+inline int f6973_6(int x) { return x * 6; }
+inline int f6973_7(int x) { return x * 7; }
+inline int f6973_8(int x) { return x * 8; }
+inline int f6973_9(int x) { return x * 9; }
+inline int f6973_10(int x) { return x * 10; }
+inline int f6973_11(int x) { return x * 11; }
+inline int f6973_12(int x) { return x * 12; }
+inline int f6973_13(int x) { return x * 13; }
+inline int f6973_14(int x) { return x * 14; }
+inline int f6973_15(int x) { return x * 15; }
+inline int f6973_16(int x) { return x * 16; }
+inline int f6973_17(int x) { return x * 17; }
+inline int f6973_18(int x) { return x * 18; }
+inline int f6973_19(int x) { return x * 19; }
+inline int f6973_20(int x) { return x * 20; }
+inline int f6973_21(int x) { return x * 21; }
+inline int f6973_22(int x) { return x * 22; }
+inline int f6973_23(int x) { return x * 23; }
+inline int f6973_24(int x) { return x * 24; }
+inline int f6973_25(int x) { return x * 25; }
+inline int f6973_26(int x) { return x * 26; }
+inline int f6973_27(int x) { return x * 27; }
+inline int f6973_28(int x) { return x * 28; }
+inline int f6973_29(int x) { return x * 29; }
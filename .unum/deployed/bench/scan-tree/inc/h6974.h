@@ -0,0 +1,42 @@
+#pragma once
+/* header 6974 */
+#include <vector>
+#include "h3314.h"
+#include "h4652.h"
+#include "h3016.h"
+#include "h5482.h"
+#include "h5148.h"
+#ifdef X
+#include "h3125.h"
+#endif
+struct S6974 { int a; const char *s = "x//y"; };
+inline int f6974_0(int x) { return x * 0; }
+inline int f6974_1(int x) { return x * 1; }
+inline int f6974_2(int x) { return x * 2; }
+inline int f6974_3(int x) { return x * 3; }
+inline int f6974_4(int x) { return x * 4; }
+inline int f6974_5(int x) { return x * 5; }
+inline int f6974_6(int x) { return x * 6; }
+inline int f6974_7(int x) { return x * 7; }
+inline int f6974_8(int x) { return x * 8; }
+inline int f6974_9(int x) { return x * 9; }
+inline int f6974_10(int x) { return x * 10; }
+inline int f6974_11(int x) { return x * 11; }
+inline int f6974_12(int x) { return x * 12; }
+inline int f6974_13(int x) { return x * 13; }
+inline int f6974_14(int x) { return x * 14; }
+inline int f6974_15(int x) { return x * 15; }
+inline int f6974_16(int x) { return x * 16; }
+inline int f6974_17(int x) { return x * 17; }
+inline int f6974_18(int x) { return x * 18; }
+inline int f6974_19(int x) { return x * 19; }
+inline int f6974_20(int x) { return x * 20; }
+inline int f6974_21(int x) { return x * 21; }
+inline int f6974_22(int x) { return x * 22; }
+inline int f6974_23(int x) { return x * 23; }
+inline int f6974_24(int x) { return x * 24; }
+inline int f6974_25(int x) { return x * 25; }
+inline int f6974_26(int x) { return x * 26; }
+inline int f6974_27(int x) { return x * 27; }
+inline int f6974_28(int x) { return x * 28; }
+inline int f6974_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6978 */
+#include <vector>
+#include "h2478.h"
+#include "h334.h"
+#include "h8149.h"
+#include "h4506.h"
+#include "h6613.h"
+#ifdef X
+#include "h442.h"
+#endif
+struct S6978 { int a; const char *s = "x//y"; };
+inline int f6978_0(int x) { return x * 0; }
+inline int f6978_1(int x) { return x * 1; }
+inline int f6978_2(int x) { return x * 2; }
+inline int f6978_3(int x) { return x * 3; }
+inline int f6978_4(int x) { return x * 4; }
+inline int f6978_5(int x) { return x * 5; }
+inline int f6978_6(int x) { return x * 6; }
+inline int f6978_7(int x) { return x * 7; }
+inline int f6978_8(int x) { return x * 8; }
+inline int f6978_9(int x) { return x * 9; }
+inline int f6978_10(int x) { return x * 10; }
+inline int f6978_11(int x) { return x * 11; }
+inline int f6978_12(int x) { return x * 12; }
+inline int f6978_13(int x) { return x * 13; }
+inline int f6978_14(int x) { return x * 14; }
+inline int f6978_15(int x) { return x * 15; }
+inline int f6978_16(int x) { return x * 16; }
+inline int f6978_17(int x) { return x * 17; }
+inline int f6978_18(int x) { return x * 18; }
+inline int f6978_19(int x) { return x * 19; }
+inline int f6978_20(int x) { return x * 20; }
+inline int f6978_21(int x) { return x * 21; }
+inline int f6978_22(int x) { return x * 22; }
+inline int f6978_23(int x) { return x * 23; }
+inline int f6978_24(int x) { return x * 24; }
+inline int f6978_25(int x) { return x * 25; }
+inline int f6978_26(int x) { return x * 26; }
+inline int f6978_27(int x) { return x * 27; }
+inline int f6978_28(int x) { return x * 28; }
+inline int f6978_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6979 */
+#include <vector>
+#include "h6739.h"
+#include "h6075.h"
+#include "h9802.h"
+#include "h3756.h"
+#include "h9398.h"
+#ifdef X
+#include "h3747.h"
+#endif
+struct S6979 { int a; const char *s = "x//y"; };
+inline int f6979_0(int x) { return x * 0; }
+inline int f6979_1(int x) { return x * 1; }
+inline int f6979_2(int x) { return x * 2; }
+inline int f6979_3(int x) { return x * 3; }
+inline int f6979_4(int x) { return x * 4; }
+inline int f6979_5(int x) { return x * 5; }
+inline int f6979_6(int x) { return x * 6; }
+inline int f6979_7(int x) { return x * 7; }
+inline int f6979_8(int x) { return x * 8; }
+inline int f6979_9(int x) { return x * 9; }
+inline int f6979_10(int x) { return x * 10; }
+inline int f6979_11(int x) { return x * 11; }
+inline int f6979_12(int x) { return x * 12; }
+inline int f6979_13(int x) { return x * 13; }
+inline int f6979_14(int x) { return x * 14; }
+inline int f6979_15(int x) { return x * 15; }
+inline int f6979_16(int x) { return x * 16; }
+inline int f6979_17(int x) { return x * 17; }
+inline int f6979_18(int x) { return x * 18; }
+inline int f6979_19(int x) { return x * 19; }
+inline int f6979_20(int x) { return x * 20; }
+inline int f6979_21(int x) { return x * 21; }
+inline int f6979_22(int x) { return x * 22; }
+inline int f6979_23(int x) { return x * 23; }
+inline int f6979_24(int x) { return x * 24; }
+inline int f6979_25(int x) { return x * 25; }
+inline int f6979_26(int x) { return x * 26; }
+inline int f6979_27(int x) { return x * 27; }
+inline int f6979_28(int x) { return x * 28; }
+inline int f6979_29(int x) { return x * 29; }
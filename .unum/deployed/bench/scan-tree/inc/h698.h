@@ -0,0 +1,42 @@
+#pragma once
+/* header 698 */
+#include <vector>
+#include "h8790.h"
+#include "h4666.h"
+#include "h3626.h"
+#include "h906.h"
+#include "h2843.h"
+#ifdef X
+#include "h9651.h"
+#endif
+struct S698 { int a; const char *s = "x//y"; };
+inline int f698_0(int x) { return x * 0; }
+inline int f698_1(int x) { return x * 1; }
+inline int f698_2(int x) { return x * 2; }
+inline int f698_3(int x) { return x * 3; }
+inline int f698_4(int x) { return x * 4; }
+inline int f698_5(int x) { return x * 5; }
+inline int f698_6(int x) { return x * 6; }
+inline int f698_7(int x) { return x * 7; }
+inline int f698_8(int x) { return x * 8; }
+inline int f698_9(int x) { return x * 9; }
+inline int f698_10(int x) { return x * 10; }
+inline int f698_11(int x) { return x * 11; }
+inline int f698_12(int x) { return x * 12; }
+inline int f698_13(int x) { return x * 13; }
+inline int f698_14(int x) { return x * 14; }
+inline int f698_15(int x) { return x * 15; }
+inline int f698_16(int x) { return x * 16; }
+inline int f698_17(int x) { return x * 17; }
+inline int f698_18(int x) { return x * 18; }
+inline int f698_19(int x) { return x * 19; }
+inline int f698_20(int x) { return x * 20; }
+inline int f698_21(int x) { return x * 21; }
+inline int f698_22(int x) { return x * 22; }
+inline int f698_23(int x) { return x * 23; }
+inline int f698_24(int x) { return x * 24; }
+inline int f698_25(int x) { return x * 25; }
+inline int f698_26(int x) { return x * 26; }
+inline int f698_27(int x) { return x * 27; }
+inline int f698_28(int x) { return x * 28; }
+inline int f698_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6980 */
+#include <vector>
+#include "h661.h"
+#include "h7796.h"
+#include "h7539.h"
+#include "h171.h"
+#include "h2935.h"
+#ifdef X
+#include "h2377.h"
+#endif
+struct S6980 { int a; const char *s = "x//y"; };
+inline int f6980_0(int x) { return x * 0; }
+inline int f6980_1(int x) { return x * 1; }
+inline int f6980_2(int x) { return x * 2; }
+inline int f6980_3(int x) { return x * 3; }
+inline int f6980_4(int x) { return x * 4; }
+inline int f6980_5(int x) { return x * 5; }
+inline int f6980_6(int x) { return x * 6; }
+inline int f6980_7(int x) { return x * 7; }
+inline int f6980_8(int x) { return x * 8; }
+inline int f6980_9(int x) { return x * 9; }
+inline int f6980_10(int x) { return x * 10; }
+inline int f6980_11(int x) { return x * 11; }
+inline int f6980_12(int x) { return x * 12; }
+inline int f6980_13(int x) { return x * 13; }
+inline int f6980_14(int x) { return x * 14; }
+inline int f6980_15(int x) { return x * 15; }
+inline int f6980_16(int x) { return x * 16; }
+inline int f6980_17(int x) { return x * 17; }
+inline int f6980_18(int x) { return x * 18; }
+inline int f6980_19(int x) { return x * 19; }
+inline int f6980_20(int x) { return x * 20; }
+inline int f6980_21(int x) { return x * 21; }
+inline int f6980_22(int x) { return x * 22; }
+inline int f6980_23(int x) { return x * 23; }
+inline int f6980_24(int x) { return x * 24; }
+inline int f6980_25(int x) { return x * 25; }
+inline int f6980_26(int x) { return x * 26; }
+inline int f6980_27(int x) { return x * 27; }
+inline int f6980_28(int x) { return x * 28; }
+inline int f6980_29(int x) { return x * 29; }
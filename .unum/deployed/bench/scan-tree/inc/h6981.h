@@ -0,0 +1,42 @@
+#pragma once
+/* header 6981 */
+#include <vector>
+#include "h1063.h"
+#include "h7537.h"
+#include "h3018.h"
+#include "h5078.h"
+#include "h3189.h"
+#ifdef X
+#include "h1732.h"
+#endif
+struct S6981 { int a; const char *s = "x//y"; };
+inline int f6981_0(int x) { return x * 0; }
+inline int f6981_1(int x) { return x * 1; }
+inline int f6981_2(int x) { return x * 2; }
+inline int f6981_3(int x) { return x * 3; }
+inline int f6981_4(int x) { return x * 4; }
+inline int f6981_5(int x) { return x * 5; }
+inline int f6981_6(int x) { return x * 6; }
+inline int f6981_7(int x) { return x * 7; }
+inline int f6981_8(int x) { return x * 8; }
+inline int f6981_9(int x) { return x * 9; }
+inline int f6981_10(int x) { return x * 10; }
+inline int f6981_11(int x) { return x * 11; }
+inline int f6981_12(int x) { return x * 12; }
+inline int f6981_13(int x) { return x * 13; }
+inline int f6981_14(int x) { return x * 14; }
+inline int f6981_15(int x) { return x * 15; }
+inline int f6981_16(int x) { return x * 16; }
+inline int f6981_17(int x) { return x * 17; }
+inline int f6981_18(int x) { return x * 18; }
+inline int f6981_19(int x) { return x * 19; }
+inline int f6981_20(int x) { return x * 20; }
+inline int f6981_21(int x) { return x * 21; }
+inline int f6981_22(int x) { return x * 22; }
+inline int f6981_23(int x) { return x * 23; }
+inline int f6981_24(int x) { return x * 24; }
+inline int f6981_25(int x) { return x * 25; }
+inline int f6981_26(int x) { return x * 26; }
+inline int f6981_27(int x) { return x * 27; }
+inline int f6981_28(int x) { return x * 28; }
+inline int f6981_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6982 */
+#include <vector>
+#include "h1829.h"
+#include "h452.h"
+#include "h9221.h"
+#include "h9759.h"
+#include "h16.h"
+#ifdef X
+#include "h8674.h"
+#endif
+struct S6982 { int a; const char *s = "x//y"; };
+inline int f6982_0(int x) { return x * 0; }
+inline int f6982_1(int x) { return x * 1; }
+inline int f6982_2(int x) { return x * 2; }
+inline int f6982_3(int x) { return x * 3; }
+inline int f6982_4(int x) { return x * 4; }
+inline int f6982_5(int x) { return x * 5; }
+inline int f6982_6(int x) { return x * 6; }
+inline int f6982_7(int x) { return x * 7; }
+inline int f6982_8(int x) { return x * 8; }
+inline int f6982_9(int x) { return x * 9; }
+inline int f6982_10(int x) { return x * 10; }
+inline int f6982_11(int x) { return x * 11; }
+inline int f6982_12(int x) { return x * 12; }
+inline int f6982_13(int x) { return x * 13; }
+inline int f6982_14(int x) { return x * 14; }
+inline int f6982_15(int x) { return x * 15; }
+inline int f6982_16(int x) { return x * 16; }
+inline int f6982_17(int x) { return x * 17; }
+inline int f6982_18(int x) { return x * 18; }
+inline int f6982_19(int x) { return x * 19; }
+inline int f6982_20(int x) { return x * 20; }
+inline int f6982_21(int x) { return x * 21; }
+inline int f6982_22(int x) { return x * 22; }
+inline int f6982_23(int x) { return x * 23; }
+inline int f6982_24(int x) { return x * 24; }
+inline int f6982_25(int x) { return x * 25; }
+inline int f6982_26(int x) { return x * 26; }
+inline int f6982_27(int x) { return x * 27; }
+inline int f6982_28(int x) { return x * 28; }
+inline int f6982_29(int x) { return x * 29; }
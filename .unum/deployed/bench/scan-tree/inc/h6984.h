@@ -0,0 +1,42 @@
+#pragma once
+/* header 6984 */
+#include <vector>
+#include "h3098.h"
+#include "h663.h"
+#include "h7651.h"
+#include "h9656.h"
+#include "h1602.h"
+#ifdef X
+#include "h8824.h"
+#endif
+struct S6984 { int a; const char *s = "x//y"; };
+inline int f6984_0(int x) { return x * 0; }
+inline int f6984_1(int x) { return x * 1; }
+inline int f6984_2(int x) { return x * 2; }
+inline int f6984_3(int x) { return x * 3; }
+inline int f6984_4(int x) { return x * 4; }
+inline int f6984_5(int x) { return x * 5; }
+inline int f6984_6(int x) { return x * 6; }
+inline int f6984_7(int x) { return x * 7; }
+inline int f6984_8(int x) { return x * 8; }
+inline int f6984_9(int x) { return x * 9; }
+inline int f6984_10(int x) { return x * 10; }
+inline int f6984_11(int x) { return x * 11; }
+inline int f6984_12(int x) { return x * 12; }
+inline int f6984_13(int x) { return x * 13; }
+inline int f6984_14(int x) { return x * 14; }
+inline int f6984_15(int x) { return x * 15; }
+inline int f6984_16(int x) { return x * 16; }
+inline int f6984_17(int x) { return x * 17; }
+inline int f6984_18(int x) { return x * 18; }
+inline int f6984_19(int x) { return x * 19; }
+inline int f6984_20(int x) { return x * 20; }
+inline int f6984_21(int x) { return x * 21; }
+inline int f6984_22(int x) { return x * 22; }
+inline int f6984_23(int x) { return x * 23; }
+inline int f6984_24(int x) { return x * 24; }
+inline int f6984_25(int x) { return x * 25; }
+inline int f6984_26(int x) { return x * 26; }
+inline int f6984_27(int x) { return x * 27; }
+inline int f6984_28(int x) { return x * 28; }
+inline int f6984_29(int x) { return x * 29; }
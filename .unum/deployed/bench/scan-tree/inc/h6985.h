@@ -0,0 +1,42 @@
+#pragma once
+/* header 6985 */
+#include <vector>
+#include "h3223.h"
+#include "h8749.h"
+#include "h5951.h"
+#include "h8310.h"
+#include "h3578.h"
+#ifdef X
+#include "h105.h"
+#endif
+struct S6985 { int a; const char *s = "x//y"; };
+inline int f6985_0(int x) { return x * 0; }
+inline int f6985_1(int x) { return x * 1; }
+inline int f6985_2(int x) { return x * 2; }
+inline int f6985_3(int x) { return x * 3; }
+inline int f6985_4(int x) { return x * 4; }
+inline int f6985_5(int x) { return x * 5; }
+inline int f6985_6(int x) { return x * 6; }
+inline int f6985_7(int x) { return x * 7; }
+inline int f6985_8(int x) { return x * 8; }
+inline int f6985_9(int x) { return x * 9; }
+inline int f6985_10(int x) { return x * 10; }
+inline int f6985_11(int x) { return x * 11; }
+inline int f6985_12(int x) { return x * 12; }
+inline int f6985_13(int x) { return x * 13; }
+inline int f6985_14(int x) { return x * 14; }
+inline int f6985_15(int x) { return x * 15; }
+inline int f6985_16(int x) { return x * 16; }
+inline int f6985_17(int x) { return x * 17; }
+inline int f6985_18(int x) { return x * 18; }
+inline int f6985_19(int x) { return x * 19; }
+inline int f6985_20(int x) { return x * 20; }
+inline int f6985_21(int x) { return x * 21; }
+inline int f6985_22(int x) { return x * 22; }
+inline int f6985_23(int x) { return x * 23; }
+inline int f6985_24(int x) { return x * 24; }
+inline int f6985_25(int x) { return x * 25; }
+inline int f6985_26(int x) { return x * 26; }
+inline int f6985_27(int x) { return x * 27; }
+inline int f6985_28(int x) { return x * 28; }
+inline int f6985_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6986 */
+#include <vector>
+#include "h8293.h"
+#include "h9047.h"
+#include "h9800.h"
+#include "h6998.h"
+#include "h1055.h"
+#ifdef X
+#include "h3333.h"
+#endif
+struct S6986 { int a; const char *s = "x//y"; };
+inline int f6986_0(int x) { return x * 0; }
+inline int f6986_1(int x) { return x * 1; }
+inline int f6986_2(int x) { return x * 2; }
+inline int f6986_3(int x) { return x * 3; }
+inline int f6986_4(int x) { return x * 4; }
+inline int f6986_5(int x) { return x * 5; }
+inline int f6986_6(int x) { return x * 6; }
+inline int f6986_7(int x) { return x * 7; }
+inline int f6986_8(int x) { return x * 8; }
+inline int f6986_9(int x) { return x * 9; }
+inline int f6986_10(int x) { return x * 10; }
+inline int f6986_11(int x) { return x * 11; }
+inline int f6986_12(int x) { return x * 12; }
+inline int f6986_13(int x) { return x * 13; }
+inline int f6986_14(int x) { return x * 14; }
+inline int f6986_15(int x) { return x * 15; }
+inline int f6986_16(int x) { return x * 16; }
+inline int f6986_17(int x) { return x * 17; }
+inline int f6986_18(int x) { return x * 18; }
+inline int f6986_19(int x) { return x * 19; }
+inline int f6986_20(int x) { return x * 20; }
+inline int f6986_21(int x) { return x * 21; }
+inline int f6986_22(int x) { return x * 22; }
+inline int f6986_23(int x) { return x * 23; }
+inline int f6986_24(int x) { return x * 24; }
+inline int f6986_25(int x) { return x * 25; }
+inline int f6986_26(int x) { return x * 26; }
+inline int f6986_27(int x) { return x * 27; }
+inline int f6986_28(int x) { return x * 28; }
+inline int f6986_29(int x) { return x * 29; }
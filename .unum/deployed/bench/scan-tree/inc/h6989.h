@@ -0,0 +1,42 @@
+#pragma once
+/* header 6989 */
+#include <vector>
+#include "h4534.h"
+#include "h7143.h"
+#include "h3684.h"
+#include "h1629.h"
+#include "h9022.h"
+#ifdef X
+#include "h963.h"
+#endif
+struct S6989 { int a; const char *s = "x//y"; };
+inline int f6989_0(int x) { return x * 0; }
+inline int f6989_1(int x) { return x * 1; }
+inline int f6989_2(int x) { return x * 2; }
+inline int f6989_3(int x) { return x * 3; }
+inline int f6989_4(int x) { return x * 4; }
+inline int f6989_5(int x) { return x * 5; }
+inline int f6989_6(int x) { return x * 6; }
+inline int f6989_7(int x) { return x * 7; }
+inline int f6989_8(int x) { return x * 8; }
+inline int f6989_9(int x) { return x * 9; }
+inline int f6989_10(int x) { return x * 10; }
+inline int f6989_11(int x) { return x * 11; }
+inline int f6989_12(int x) { return x * 12; }
+inline int f6989_13(int x) { return x * 13; }
+inline int f6989_14(int x) { return x * 14; }
+inline int f6989_15(int x) { return x * 15; }
+inline int f6989_16(int x) { return x * 16; }
+inline int f6989_17(int x) { return x * 17; }
+inline int f6989_18(int x) { return x * 18; }
+inline int f6989_19(int x) { return x * 19; }
+inline int f6989_20(int x) { return x * 20; }
+inline int f6989_21(int x) { return x * 21; }
+inline int f6989_22(int x) { return x * 22; }
+inline int f6989_23(int x) { return x * 23; }
+inline int f6989_24(int x) { return x * 24; }
+inline int f6989_25(int x) { return x * 25; }
+inline int f6989_26(int x) { return x * 26; }
+inline int f6989_27(int x) { return x * 27; }
+inline int f6989_28(int x) { return x * 28; }
+inline int f6989_29(int x) { return x * 29; }
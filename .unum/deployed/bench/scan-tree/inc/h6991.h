@@ -0,0 +1,42 @@
+#pragma once
+/* header 6991 */
+#include <vector>
+#include "h8729.h"
+#include "h1448.h"
+#include "h8065.h"
+#include "h1580.h"
+#include "h4319.h"
+#ifdef X
+#include "h1722.h"
+#endif
+struct S6991 { int a; const char *s = "x//y"; };
+inline int f6991_0(int x) { return x * 0; }
+inline int f6991_1(int x) { return x * 1; }
+inline int f6991_2(int x) { return x * 2; }
+inline int f6991_3(int x) { return x * 3; }
+inline int f6991_4(int x) { return x * 4; }
+inline int f6991_5(int x) { return x * 5; }
+inline int f6991_6(int x) { return x * 6; }
+inline int f6991_7(int x) { return x * 7; }
+inline int f6991_8(int x) { return x * 8; }
+inline int f6991_9(int x) { return x * 9; }
+inline int f6991_10(int x) { return x * 10; }
+inline int f6991_11(int x) { return x * 11; }
+inline int f6991_12(int x) { return x * 12; }
+inline int f6991_13(int x) { return x * 13; }
+inline int f6991_14(int x) { return x * 14; }
+inline int f6991_15(int x) { return x * 15; }
+inline int f6991_16(int x) { return x * 16; }
+inline int f6991_17(int x) { return x * 17; }
+inline int f6991_18(int x) { return x * 18; }
+inline int f6991_19(int x) { return x * 19; }
+inline int f6991_20(int x) { return x * 20; }
+inline int f6991_21(int x) { return x * 21; }
+inline int f6991_22(int x) { return x * 22; }
+inline int f6991_23(int x) { return x * 23; }
+inline int f6991_24(int x) { return x * 24; }
+inline int f6991_25(int x) { return x * 25; }
+inline int f6991_26(int x) { return x * 26; }
+inline int f6991_27(int x) { return x * 27; }
+inline int f6991_28(int x) { return x * 28; }
+inline int f6991_29(int x) { return x * 29; }
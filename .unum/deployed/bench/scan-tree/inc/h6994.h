@@ -0,0 +1,42 @@
+#pragma once
+/* header 6994 */
+#include <vector>
+#include "h2246.h"
+#include "h7159.h"
+#include "h89.h"
+#include "h7006.h"
+#include "h9732.h"
+#ifdef X
+#include "h1875.h"
+#endif
+struct S6994 { int a; const char *s = "x//y"; };
+inline int f6994_0(int x) { return x * 0; }
+inline int f6994_1(int x) { return x * 1; }
+inline int f6994_2(int x) { return x * 2; }
+inline int f6994_3(int x) { return x * 3; }
+inline int f6994_4(int x) { return x * 4; }
+inline int f6994_5(int x) { return x * 5; }
+inline int f6994_6(int x) { return x * 6; }
+inline int f6994_7(int x) { return x * 7; }
+inline int f6994_8(int x) { return x * 8; }
+inline int f6994_9(int x) { return x * 9; }
+inline int f6994_10(int x) { return x * 10; }
+inline int f6994_11(int x) { return x * 11; }
+inline int f6994_12(int x) { return x * 12; }
+inline int f6994_13(int x) { return x * 13; }
+inline int f6994_14(int x) { return x * 14; }
+inline int f6994_15(int x) { return x * 15; }
+inline int f6994_16(int x) { return x * 16; }
+inline int f6994_17(int x) { return x * 17; }
+inline int f6994_18(int x) { return x * 18; }
+inline int f6994_19(int x) { return x * 19; }
+inline int f6994_20(int x) { return x * 20; }
+inline int f6994_21(int x) { return x * 21; }
+inline int f6994_22(int x) { return x * 22; }
+inline int f6994_23(int x) { return x * 23; }
+inline int f6994_24(int x) { return x * 24; }
+inline int f6994_25(int x) { return x * 25; }
+inline int f6994_26(int x) { return x * 26; }
+inline int f6994_27(int x) { return x * 27; }
+inline int f6994_28(int x) { return x * 28; }
+inline int f6994_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6995 */
+#include <vector>
+#include "h4455.h"
+#include "h4198.h"
+#include "h9978.h"
+#include "h2478.h"
+#include "h7427.h"
+#ifdef X
+#include "h2879.h"
+#endif
+struct S6995 { int a; const char *s = "x//y"; };
+inline int f6995_0(int x) { return x * 0; }
+inline int f6995_1(int x) { return x * 1; }
+inline int f6995_2(int x) { return x * 2; }
+inline int f6995_3(int x) { return x * 3; }
+inline int f6995_4(int x) { return x * 4; }
+inline int f6995_5(int x) { return x * 5; }
+inline int f6995_6(int x) { return x * 6; }
+inline int f6995_7(int x) { return x * 7; }
+inline int f6995_8(int x) { return x * 8; }
+inline int f6995_9(int x) { return x * 9; }
+inline int f6995_10(int x) { return x * 10; }
+inline int f6995_11(int x) { return x * 11; }
+inline int f6995_12(int x) { return x * 12; }
+inline int f6995_13(int x) { return x * 13; }
+inline int f6995_14(int x) { return x * 14; }
+inline int f6995_15(int x) { return x * 15; }
+inline int f6995_16(int x) { return x * 16; }
+inline int f6995_17(int x) { return x * 17; }
+inline int f6995_18(int x) { return x * 18; }
+inline int f6995_19(int x) { return x * 19; }
+inline int f6995_20(int x) { return x * 20; }
+inline int f6995_21(int x) { return x * 21; }
+inline int f6995_22(int x) { return x * 22; }
+inline int f6995_23(int x) { return x * 23; }
+inline int f6995_24(int x) { return x * 24; }
+inline int f6995_25(int x) { return x * 25; }
+inline int f6995_26(int x) { return x * 26; }
+inline int f6995_27(int x) { return x * 27; }
+inline int f6995_28(int x) { return x * 28; }
+inline int f6995_29(int x) { return x * 29; }
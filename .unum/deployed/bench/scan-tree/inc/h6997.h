@@ -0,0 +1,42 @@
+#pragma once
+/* header 6997 */
+#include <vector>
+#include "h3168.h"
+#include "h9538.h"
+#include "h7658.h"
+#include "h2279.h"
+#include "h6873.h"
+#ifdef X
+#include "h5725.h"
+#endif
+struct S6997 { int a; const char *s = "x//y"; };
+inline int f6997_0(int x) { return x * 0; }
+inline int f6997_1(int x) { return x * 1; }
+inline int f6997_2(int x) { return x * 2; }
+inline int f6997_3(int x) { return x * 3; }
+inline int f6997_4(int x) { return x * 4; }
+inline int f6997_5(int x) { return x * 5; }
+inline int f6997_6(int x) { return x * 6; }
+inline int f6997_7(int x) { return x * 7; }
+inline int f6997_8(int x) { return x * 8; }
+inline int f6997_9(int x) { return x * 9; }
+inline int f6997_10(int x) { return x * 10; }
+inline int f6997_11(int x) { return x * 11; }
+inline int f6997_12(int x) { return x * 12; }
+inline int f6997_13(int x) { return x * 13; }
+inline int f6997_14(int x) { return x * 14; }
+inline int f6997_15(int x) { return x * 15; }
+inline int f6997_16(int x) { return x * 16; }
+inline int f6997_17(int x) { return x * 17; }
+inline int f6997_18(int x) { return x * 18; }
+inline int f6997_19(int x) { return x * 19; }
+inline int f6997_20(int x) { return x * 20; }
+inline int f6997_21(int x) { return x * 21; }
+inline int f6997_22(int x) { return x * 22; }
+inline int f6997_23(int x) { return x * 23; }
+inline int f6997_24(int x) { return x * 24; }
+inline int f6997_25(int x) { return x * 25; }
+inline int f6997_26(int x) { return x * 26; }
+inline int f6997_27(int x) { return x * 27; }
+inline int f6997_28(int x) { return x * 28; }
+inline int f6997_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 6998 */
+#include <vector>
+#include "h2685.h"
+#include "h2378.h"
+#include "h1809.h"
+#include "h7785.h"
+#include "h9291.h"
+#ifdef X
+#include "h3078.h"
+#endif
+struct S6998 { int a; const char *s = "x//y"; };
+inline int f6998_0(int x) { return x * 0; }
+inline int f6998_1(int x) { return x * 1; }
+inline int f6998_2(int x) { return x * 2; }
+inline int f6998_3(int x) { return x * 3; }
+inline int f6998_4(int x) { return x * 4; }
+inline int f6998_5(int x) { return x * 5; }
+inline int f6998_6(int x) { return x * 6; }
+inline int f6998_7(int x) { return x * 7; }
+inline int f6998_8(int x) { return x * 8; }
+inline int f6998_9(int x) { return x * 9; }
+inline int f6998_10(int x) { return x * 10; }
+inline int f6998_11(int x) { return x * 11; }
+inline int f6998_12(int x) { return x * 12; }
+inline int f6998_13(int x) { return x * 13; }
+inline int f6998_14(int x) { return x * 14; }
+inline int f6998_15(int x) { return x * 15; }
+inline int f6998_16(int x) { return x * 16; }
+inline int f6998_17(int x) { return x * 17; }
+inline int f6998_18(int x) { return x * 18; }
+inline int f6998_19(int x) { return x * 19; }
+inline int f6998_20(int x) { return x * 20; }
+inline int f6998_21(int x) { return x * 21; }
+inline int f6998_22(int x) { return x * 22; }
+inline int f6998_23(int x) { return x * 23; }
+inline int f6998_24(int x) { return x * 24; }
+inline int f6998_25(int x) { return x * 25; }
+inline int f6998_26(int x) { return x * 26; }
+inline int f6998_27(int x) { return x * 27; }
+inline int f6998_28(int x) { return x * 28; }
+inline int f6998_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7 */
+#include <vector>
+#include "h2185.h"
+#include "h2677.h"
+#include "h1850.h"
+#include "h812.h"
+#include "h7679.h"
+#ifdef X
+#include "h2006.h"
+#endif
+struct S7 { int a; const char *s = "x//y"; };
+inline int f7_0(int x) { return x * 0; }
+inline int f7_1(int x) { return x * 1; }
+inline int f7_2(int x) { return x * 2; }
+inline int f7_3(int x) { return x * 3; }
+inline int f7_4(int x) { return x * 4; }
+inline int f7_5(int x) { return x * 5; }
+inline int f7_6(int x) { return x * 6; }
+inline int f7_7(int x) { return x * 7; }
+inline int f7_8(int x) { return x * 8; }
+inline int f7_9(int x) { return x * 9; }
+inline int f7_10(int x) { return x * 10; }
+inline int f7_11(int x) { return x * 11; }
+inline int f7_12(int x) { return x * 12; }
+inline int f7_13(int x) { return x * 13; }
+inline int f7_14(int x) { return x * 14; }
+inline int f7_15(int x) { return x * 15; }
+inline int f7_16(int x) { return x * 16; }
+inline int f7_17(int x) { return x * 17; }
+inline int f7_18(int x) { return x * 18; }
+inline int f7_19(int x) { return x * 19; }
+inline int f7_20(int x) { return x * 20; }
+inline int f7_21(int x) { return x * 21; }
+inline int f7_22(int x) { return x * 22; }
+inline int f7_23(int x) { return x * 23; }
+inline int f7_24(int x) { return x * 24; }
+inline int f7_25(int x) { return x * 25; }
+inline int f7_26(int x) { return x * 26; }
+inline int f7_27(int x) { return x * 27; }
+inline int f7_28(int x) { return x * 28; }
+inline int f7_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 70 */
+#include <vector>
+#include "h9106.h"
+#include "h3077.h"
+#include "h1013.h"
+#include "h8289.h"
+#include "h5087.h"
+#ifdef X
+#include "h9741.h"
+#endif
+struct S70 { int a; const char *s = "x//y"; };
+inline int f70_0(int x) { return x * 0; }
+inline int f70_1(int x) { return x * 1; }
+inline int f70_2(int x) { return x * 2; }
+inline int f70_3(int x) { return x * 3; }
+inline int f70_4(int x) { return x * 4; }
+inline int f70_5(int x) { return x * 5; }
+inline int f70_6(int x) { return x * 6; }
+inline int f70_7(int x) { return x * 7; }
+inline int f70_8(int x) { return x * 8; }
+inline int f70_9(int x) { return x * 9; }
+inline int f70_10(int x) { return x * 10; }
+inline int f70_11(int x) { return x * 11; }
+inline int f70_12(int x) { return x * 12; }
+inline int f70_13(int x) { return x * 13; }
+inline int f70_14(int x) { return x * 14; }
+inline int f70_15(int x) { return x * 15; }
+inline int f70_16(int x) { return x * 16; }
+inline int f70_17(int x) { return x * 17; }
+inline int f70_18(int x) { return x * 18; }
+inline int f70_19(int x) { return x * 19; }
+inline int f70_20(int x) { return x * 20; }
+inline int f70_21(int x) { return x * 21; }
+inline int f70_22(int x) { return x * 22; }
+inline int f70_23(int x) { return x * 23; }
+inline int f70_24(int x) { return x * 24; }
+inline int f70_25(int x) { return x * 25; }
+inline int f70_26(int x) { return x * 26; }
+inline int f70_27(int x) { return x * 27; }
+inline int f70_28(int x) { return x * 28; }
+inline int f70_29(int x) { return x * 29; }
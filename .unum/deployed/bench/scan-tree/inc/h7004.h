@@ -0,0 +1,42 @@
+#pragma once
+/* header 7004 */
+#include <vector>
+#include "h3335.h"
+#include "h1946.h"
+#include "h2254.h"
+#include "h163.h"
+#include "h2976.h"
+#ifdef X
+#include "h8311.h"
+#endif
+struct S7004 { int a; const char *s = "x//y"; };
+inline int f7004_0(int x) { return x * 0; }
+inline int f7004_1(int x) { return x * 1; }
+inline int f7004_2(int x) { return x * 2; }
+inline int f7004_3(int x) { return x * 3; }
+inline int f7004_4(int x) { return x * 4; }
+inline int f7004_5(int x) { return x * 5; }
+inline int f7004_6(int x) { return x * 6; }
+inline int f7004_7(int x) { return x * 7; }
+inline int f7004_8(int x) { return x * 8; }
+inline int f7004_9(int x) { return x * 9; }
+inline int f7004_10(int x) { return x * 10; }
+inline int f7004_11(int x) { return x * 11; }
+inline int f7004_12(int x) { return x * 12; }
+inline int f7004_13(int x) { return x * 13; }
+inline int f7004_14(int x) { return x * 14; }
+inline int f7004_15(int x) { return x * 15; }
+inline int f7004_16(int x) { return x * 16; }
+inline int f7004_17(int x) { return x * 17; }
+inline int f7004_18(int x) { return x * 18; }
+inline int f7004_19(int x) { return x * 19; }
+inline int f7004_20(int x) { return x * 20; }
+inline int f7004_21(int x) { return x * 21; }
+inline int f7004_22(int x) { return x * 22; }
+inline int f7004_23(int x) { return x * 23; }
+inline int f7004_24(int x) { return x * 24; }
+inline int f7004_25(int x) { return x * 25; }
+inline int f7004_26(int x) { return x * 26; }
+inline int f7004_27(int x) { return x * 27; }
+inline int f7004_28(int x) { return x * 28; }
+inline int f7004_29(int x) { return x * 29; }
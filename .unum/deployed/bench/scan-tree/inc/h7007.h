@@ -0,0 +1,42 @@
+#pragma once
+/* header 7007 */
+#include <vector>
+#include "h1211.h"
+#include "h981.h"
+#include "h8848.h"
+#include "h665.h"
+#include "h8731.h"
+#ifdef X
+#include "h8912.h"
+#endif
+struct S7007 { int a; const char *s = "x//y"; };
+inline int f7007_0(int x) { return x * 0; }
+inline int f7007_1(int x) { return x * 1; }
+inline int f7007_2(int x) { return x * 2; }
+inline int f7007_3(int x) { return x * 3; }
+inline int f7007_4(int x) { return x * 4; }
+inline int f7007_5(int x) { return x * 5; }
+inline int f7007_6(int x) { return x * 6; }
+inline int f7007_7(int x) { return x * 7; }
+inline int f7007_8(int x) { return x * 8; }
+inline int f7007_9(int x) { return x * 9; }
+inline int f7007_10(int x) { return x * 10; }
+inline int f7007_11(int x) { return x * 11; }
+inline int f7007_12(int x) { return x * 12; }
+inline int f7007_13(int x) { return x * 13; }
+inline int f7007_14(int x) { return x * 14; }
+inline int f7007_15(int x) { return x * 15; }
+inline int f7007_16(int x) { return x * 16; }
+inline int f7007_17(int x) { return x * 17; }
+inline int f7007_18(int x) { return x * 18; }
+inline int f7007_19(int x) { return x * 19; }
+inline int f7007_20(int x) { return x * 20; }
+inline int f7007_21(int x) { return x * 21; }
+inline int f7007_22(int x) { return x * 22; }
+inline int f7007_23(int x) { return x * 23; }
+inline int f7007_24(int x) { return x * 24; }
+inline int f7007_25(int x) { return x * 25; }
+inline int f7007_26(int x) { return x * 26; }
+inline int f7007_27(int x) { return x * 27; }
+inline int f7007_28(int x) { return x * 28; }
+inline int f7007_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7010 */
+#include <vector>
+#include "h6422.h"
+#include "h9246.h"
+#include "h4647.h"
+#include "h6896.h"
+#include "h5437.h"
+#ifdef X
+#include "h1280.h"
+#endif
+struct S7010 { int a; const char *s = "x//y"; };
+inline int f7010_0(int x) { return x * 0; }
+inline int f7010_1(int x) { return x * 1; }
+inline int f7010_2(int x) { return x * 2; }
+inline int f7010_3(int x) { return x * 3; }
+inline int f7010_4(int x) { return x * 4; }
+inline int f7010_5(int x) { return x * 5; }
+inline int f7010_6(int x) { return x * 6; }
+inline int f7010_7(int x) { return x * 7; }
+inline int f7010_8(int x) { return x * 8; }
+inline int f7010_9(int x) { return x * 9; }
+inline int f7010_10(int x) { return x * 10; }
+inline int f7010_11(int x) { return x * 11; }
+inline int f7010_12(int x) { return x * 12; }
+inline int f7010_13(int x) { return x * 13; }
+inline int f7010_14(int x) { return x * 14; }
+inline int f7010_15(int x) { return x * 15; }
+inline int f7010_16(int x) { return x * 16; }
+inline int f7010_17(int x) { return x * 17; }
+inline int f7010_18(int x) { return x * 18; }
+inline int f7010_19(int x) { return x * 19; }
+inline int f7010_20(int x) { return x * 20; }
+inline int f7010_21(int x) { return x * 21; }
+inline int f7010_22(int x) { return x * 22; }
+inline int f7010_23(int x) { return x * 23; }
+inline int f7010_24(int x) { return x * 24; }
+inline int f7010_25(int x) { return x * 25; }
+inline int f7010_26(int x) { return x * 26; }
+inline int f7010_27(int x) { return x * 27; }
+inline int f7010_28(int x) { return x * 28; }
+inline int f7010_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7011 */
+#include <vector>
+#include "h8425.h"
+#include "h4201.h"
+#include "h9781.h"
+#include "h4659.h"
+#include "h2898.h"
+#ifdef X
+#include "h7336.h"
+#endif
+struct S7011 { int a; const char *s = "x//y"; };
+inline int f7011_0(int x) { return x * 0; }
+inline int f7011_1(int x) { return x * 1; }
+inline int f7011_2(int x) { return x * 2; }
+inline int f7011_3(int x) { return x * 3; }
+inline int f7011_4(int x) { return x * 4; }
+inline int f7011_5(int x) { return x * 5; }
+inline int f7011_6(int x) { return x * 6; }
+inline int f7011_7(int x) { return x * 7; }
+inline int f7011_8(int x) { return x * 8; }
+inline int f7011_9(int x) { return x * 9; }
+inline int f7011_10(int x) { return x * 10; }
+inline int f7011_11(int x) { return x * 11; }
+inline int f7011_12(int x) { return x * 12; }
+inline int f7011_13(int x) { return x * 13; }
+inline int f7011_14(int x) { return x * 14; }
+inline int f7011_15(int x) { return x * 15; }
+inline int f7011_16(int x) { return x * 16; }
+inline int f7011_17(int x) { return x * 17; }
+inline int f7011_18(int x) { return x * 18; }
+inline int f7011_19(int x) { return x * 19; }
+inline int f7011_20(int x) { return x * 20; }
+inline int f7011_21(int x) { return x * 21; }
+inline int f7011_22(int x) { return x * 22; }
+inline int f7011_23(int x) { return x * 23; }
+inline int f7011_24(int x) { return x * 24; }
+inline int f7011_25(int x) { return x * 25; }
+inline int f7011_26(int x) { return x * 26; }
+inline int f7011_27(int x) { return x * 27; }
+inline int f7011_28(int x) { return x * 28; }
+inline int f7011_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7013 */
+#include <vector>
+#include "h4402.h"
+#include "h1448.h"
+#include "h1323.h"
+#include "h2804.h"
+#include "h406.h"
+#ifdef X
+#include "h5601.h"
+#endif
+struct S7013 { int a; const char *s = "x//y"; };
+inline int f7013_0(int x) { return x * 0; }
+inline int f7013_1(int x) { return x * 1; }
+inline int f7013_2(int x) { return x * 2; }
+inline int f7013_3(int x) { return x * 3; }
+inline int f7013_4(int x) { return x * 4; }
+inline int f7013_5(int x) { return x * 5; }
+inline int f7013_6(int x) { return x * 6; }
+inline int f7013_7(int x) { return x * 7; }
+inline int f7013_8(int x) { return x * 8; }
+inline int f7013_9(int x) { return x * 9; }
+inline int f7013_10(int x) { return x * 10; }
+inline int f7013_11(int x) { return x * 11; }
+inline int f7013_12(int x) { return x * 12; }
+inline int f7013_13(int x) { return x * 13; }
+inline int f7013_14(int x) { return x * 14; }
+inline int f7013_15(int x) { return x * 15; }
+inline int f7013_16(int x) { return x * 16; }
+inline int f7013_17(int x) { return x * 17; }
+inline int f7013_18(int x) { return x * 18; }
+inline int f7013_19(int x) { return x * 19; }
+inline int f7013_20(int x) { return x * 20; }
+inline int f7013_21(int x) { return x * 21; }
+inline int f7013_22(int x) { return x * 22; }
+inline int f7013_23(int x) { return x * 23; }
+inline int f7013_24(int x) { return x * 24; }
+inline int f7013_25(int x) { return x * 25; }
+inline int f7013_26(int x) { return x * 26; }
+inline int f7013_27(int x) { return x * 27; }
+inline int f7013_28(int x) { return x * 28; }
+inline int f7013_29(int x) { return x * 29; }
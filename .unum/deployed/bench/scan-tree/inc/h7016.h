@@ -0,0 +1,42 @@
+#pragma once
+/* header 7016 */
+#include <vector>
+#include "h2066.h"
+#include "h8994.h"
+#include "h9170.h"
+#include "h2921.h"
+#include "h3172.h"
+#ifdef X
+#include "h7265.h"
+#endif
+struct S7016 { int a; const char *s = "x//y"; };
+inline int f7016_0(int x) { return x * 0; }
+inline int f7016_1(int x) { return x * 1; }
+inline int f7016_2(int x) { return x * 2; }
+inline int f7016_3(int x) { return x * 3; }
+inline int f7016_4(int x) { return x * 4; }
+inline int f7016_5(int x) { return x * 5; }
+inline int f7016_6(int x) { return x * 6; }
+inline int f7016_7(int x) { return x * 7; }
+inline int f7016_8(int x) { return x * 8; }
+inline int f7016_9(int x) { return x * 9; }
+inline int f7016_10(int x) { return x * 10; }
+inline int f7016_11(int x) { return x * 11; }
+inline int f7016_12(int x) { return x * 12; }
+inline int f7016_13(int x) { return x * 13; }
+inline int f7016_14(int x) { return x * 14; }
+inline int f7016_15(int x) { return x * 15; }
+inline int f7016_16(int x) { return x * 16; }
+inline int f7016_17(int x) { return x * 17; }
+inline int f7016_18(int x) { return x * 18; }
+inline int f7016_19(int x) { return x * 19; }
+inline int f7016_20(int x) { return x * 20; }
+inline int f7016_21(int x) { return x * 21; }
+inline int f7016_22(int x) { return x * 22; }
+inline int f7016_23(int x) { return x * 23; }
+inline int f7016_24(int x) { return x * 24; }
+inline int f7016_25(int x) { return x * 25; }
+inline int f7016_26(int x) { return x * 26; }
+inline int f7016_27(int x) { return x * 27; }
+inline int f7016_28(int x) { return x * 28; }
+inline int f7016_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7021 */
+#include <vector>
+#include "h9894.h"
+#include "h2259.h"
+#include "h2256.h"
+#include "h7014.h"
+#include "h4392.h"
+#ifdef X
+#include "h9178.h"
+#endif
+struct S7021 { int a; const char *s = "x//y"; };
+inline int f7021_0(int x) { return x * 0; }
+inline int f7021_1(int x) { return x * 1; }
+inline int f7021_2(int x) { return x * 2; }
+inline int f7021_3(int x) { return x * 3; }
+inline int f7021_4(int x) { return x * 4; }
+inline int f7021_5(int x) { return x * 5; }
+inline int f7021_6(int x) { return x * 6; }
+inline int f7021_7(int x) { return x * 7; }
+inline int f7021_8(int x) { return x * 8; }
+inline int f7021_9(int x) { return x * 9; }
+inline int f7021_10(int x) { return x * 10; }
+inline int f7021_11(int x) { return x * 11; }
+inline int f7021_12(int x) { return x * 12; }
+inline int f7021_13(int x) { return x * 13; }
+inline int f7021_14(int x) { return x * 14; }
+inline int f7021_15(int x) { return x * 15; }
+inline int f7021_16(int x) { return x * 16; }
+inline int f7021_17(int x) { return x * 17; }
+inline int f7021_18(int x) { return x * 18; }
+inline int f7021_19(int x) { return x * 19; }
+inline int f7021_20(int x) { return x * 20; }
+inline int f7021_21(int x) { return x * 21; }
+inline int f7021_22(int x) { return x * 22; }
+inline int f7021_23(int x) { return x * 23; }
+inline int f7021_24(int x) { return x * 24; }
+inline int f7021_25(int x) { return x * 25; }
+inline int f7021_26(int x) { return x * 26; }
+inline int f7021_27(int x) { return x * 27; }
+inline int f7021_28(int x) { return x * 28; }
+inline int f7021_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7022 */
+#include <vector>
+#include "h860.h"
+#include "h905.h"
+#include "h7919.h"
+#include "h3834.h"
+#include "h9104.h"
+#ifdef X
+#include "h4014.h"
+#endif
+struct S7022 { int a; const char *s = "x//y"; };
+inline int f7022_0(int x) { return x * 0; }
+inline int f7022_1(int x) { return x * 1; }
+inline int f7022_2(int x) { return x * 2; }
+inline int f7022_3(int x) { return x * 3; }
+inline int f7022_4(int x) { return x * 4; }
+inline int f7022_5(int x) { return x * 5; }
+inline int f7022_6(int x) { return x * 6; }
+inline int f7022_7(int x) { return x * 7; }
+inline int f7022_8(int x) { return x * 8; }
+inline int f7022_9(int x) { return x * 9; }
+inline int f7022_10(int x) { return x * 10; }
+inline int f7022_11(int x) { return x * 11; }
+inline int f7022_12(int x) { return x * 12; }
+inline int f7022_13(int x) { return x * 13; }
+inline int f7022_14(int x) { return x * 14; }
+inline int f7022_15(int x) { return x * 15; }
+inline int f7022_16(int x) { return x * 16; }
+inline int f7022_17(int x) { return x * 17; }
+inline int f7022_18(int x) { return x * 18; }
+inline int f7022_19(int x) { return x * 19; }
+inline int f7022_20(int x) { return x * 20; }
+inline int f7022_21(int x) { return x * 21; }
+inline int f7022_22(int x) { return x * 22; }
+inline int f7022_23(int x) { return x * 23; }
+inline int f7022_24(int x) { return x * 24; }
+inline int f7022_25(int x) { return x * 25; }
+inline int f7022_26(int x) { return x * 26; }
+inline int f7022_27(int x) { return x * 27; }
+inline int f7022_28(int x) { return x * 28; }
+inline int f7022_29(int x) { return x * 29; }
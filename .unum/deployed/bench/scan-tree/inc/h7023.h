@@ -0,0 +1,42 @@
+#pragma once
+/* header 7023 */
+#include <vector>
+#include "h1656.h"
+#include "h4973.h"
+#include "h1305.h"
+#include "h163.h"
+#include "h4514.h"
+#ifdef X
+#include "h8431.h"
+#endif
+struct S7023 { int a; const char *s = "x//y"; };
+inline int f7023_0(int x) { return x * 0; }
+inline int f7023_1(int x) { return x * 1; }
+inline int f7023_2(int x) { return x * 2; }
+inline int f7023_3(int x) { return x * 3; }
+inline int f7023_4(int x) { return x * 4; }
+inline int f7023_5(int x) { return x * 5; }
+inline int f7023_6(int x) { return x * 6; }
+inline int f7023_7(int x) { return x * 7; }
+inline int f7023_8(int x) { return x * 8; }
+inline int f7023_9(int x) { return x * 9; }
+inline int f7023_10(int x) { return x * 10; }
+inline int f7023_11(int x) { return x * 11; }
+inline int f7023_12(int x) { return x * 12; }
+inline int f7023_13(int x) { return x * 13; }
+inline int f7023_14(int x) { return x * 14; }
+inline int f7023_15(int x) { return x * 15; }
+inline int f7023_16(int x) { return x * 16; }
+inline int f7023_17(int x) { return x * 17; }
+inline int f7023_18(int x) { return x * 18; }
+inline int f7023_19(int x) { return x * 19; }
+inline int f7023_20(int x) { return x * 20; }
+inline int f7023_21(int x) { return x * 21; }
+inline int f7023_22(int x) { return x * 22; }
+inline int f7023_23(int x) { return x * 23; }
+inline int f7023_24(int x) { return x * 24; }
+inline int f7023_25(int x) { return x * 25; }
+inline int f7023_26(int x) { return x * 26; }
+inline int f7023_27(int x) { return x * 27; }
+inline int f7023_28(int x) { return x * 28; }
+inline int f7023_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7025 */
+#include <vector>
+#include "h2259.h"
+#include "h8339.h"
+#include "h2258.h"
+#include "h7990.h"
+#include "h5754.h"
+#ifdef X
+#include "h5031.h"
+#endif
+struct S7025 { int a; const char *s = "x//y"; };
+inline int f7025_0(int x) { return x * 0; }
+inline int f7025_1(int x) { return x * 1; }
+inline int f7025_2(int x) { return x * 2; }
+inline int f7025_3(int x) { return x * 3; }
+inline int f7025_4(int x) { return x * 4; }
+inline int f7025_5(int x) { return x * 5; }
+inline int f7025_6(int x) { return x * 6; }
+inline int f7025_7(int x) { return x * 7; }
+inline int f7025_8(int x) { return x * 8; }
+inline int f7025_9(int x) { return x * 9; }
+inline int f7025_10(int x) { return x * 10; }
+inline int f7025_11(int x) { return x * 11; }
+inline int f7025_12(int x) { return x * 12; }
+inline int f7025_13(int x) { return x * 13; }
+inline int f7025_14(int x) { return x * 14; }
+inline int f7025_15(int x) { return x * 15; }
+inline int f7025_16(int x) { return x * 16; }
+inline int f7025_17(int x) { return x * 17; }
+inline int f7025_18(int x) { return x * 18; }
+inline int f7025_19(int x) { return x * 19; }
+inline int f7025_20(int x) { return x * 20; }
+inline int f7025_21(int x) { return x * 21; }
+inline int f7025_22(int x) { return x * 22; }
+inline int f7025_23(int x) { return x * 23; }
+inline int f7025_24(int x) { return x * 24; }
+inline int f7025_25(int x) { return x * 25; }
+inline int f7025_26(int x) { return x * 26; }
+inline int f7025_27(int x) { return x * 27; }
+inline int f7025_28(int x) { return x * 28; }
+inline int f7025_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7029 */
+#include <vector>
+#include "h2676.h"
+#include "h8392.h"
+#include "h932.h"
+#include "h5127.h"
+#include "h7629.h"
+#ifdef X
+#include "h4174.h"
+#endif
+struct S7029 { int a; const char *s = "x//y"; };
+inline int f7029_0(int x) { return x * 0; }
+inline int f7029_1(int x) { return x * 1; }
+inline int f7029_2(int x) { return x * 2; }
+inline int f7029_3(int x) { return x * 3; }
+inline int f7029_4(int x) { return x * 4; }
+inline int f7029_5(int x) { return x * 5; }
+inline int f7029_6(int x) { return x * 6; }
+inline int f7029_7(int x) { return x * 7; }
+inline int f7029_8(int x) { return x * 8; }
+inline int f7029_9(int x) { return x * 9; }
+inline int f7029_10(int x) { return x * 10; }
+inline int f7029_11(int x) { return x * 11; }
+inline int f7029_12(int x) { return x * 12; }
+inline int f7029_13(int x) { return x * 13; }
+inline int f7029_14(int x) { return x * 14; }
+inline int f7029_15(int x) { return x * 15; }
+inline int f7029_16(int x) { return x * 16; }
+inline int f7029_17(int x) { return x * 17; }
+inline int f7029_18(int x) { return x * 18; }
+inline int f7029_19(int x) { return x * 19; }
+inline int f7029_20(int x) { return x * 20; }
+inline int f7029_21(int x) { return x * 21; }
+inline int f7029_22(int x) { return x * 22; }
+inline int f7029_23(int x) { return x * 23; }
+inline int f7029_24(int x) { return x * 24; }
+inline int f7029_25(int x) { return x * 25; }
+inline int f7029_26(int x) { return x * 26; }
+inline int f7029_27(int x) { return x * 27; }
+inline int f7029_28(int x) { return x * 28; }
+inline int f7029_29(int x) { return x * 29; }
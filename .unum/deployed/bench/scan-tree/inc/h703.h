@@ -0,0 +1,42 @@
+#pragma once
+/* header 703 */
+#include <vector>
+#include "h9444.h"
+#include "h4135.h"
+#include "h5668.h"
+#include "h5396.h"
+#include "h4282.h"
+#ifdef X
+#include "h6545.h"
+#endif
+struct S703 { int a; const char *s = "x//y"; };
+inline int f703_0(int x) { return x * 0; }
+inline int f703_1(int x) { return x * 1; }
+inline int f703_2(int x) { return x * 2; }
+inline int f703_3(int x) { return x * 3; }
+inline int f703_4(int x) { return x * 4; }
+inline int f703_5(int x) { return x * 5; }
+inline int f703_6(int x) { return x * 6; }
+inline int f703_7(int x) { return x * 7; }
+inline int f703_8(int x) { return x * 8; }
+inline int f703_9(int x) { return x * 9; }
+inline int f703_10(int x) { return x * 10; }
+inline int f703_11(int x) { return x * 11; }
+inline int f703_12(int x) { return x * 12; }
+inline int f703_13(int x) { return x * 13; }
+inline int f703_14(int x) { return x * 14; }
+inline int f703_15(int x) { return x * 15; }
+inline int f703_16(int x) { return x * 16; }
+inline int f703_17(int x) { return x * 17; }
+inline int f703_18(int x) { return x * 18; }
+inline int f703_19(int x) { return x * 19; }
+inline int f703_20(int x) { return x * 20; }
+inline int f703_21(int x) { return x * 21; }
+inline int f703_22(int x) { return x * 22; }
+inline int f703_23(int x) { return x * 23; }
+inline int f703_24(int x) { return x * 24; }
+inline int f703_25(int x) { return x * 25; }
+inline int f703_26(int x) { return x * 26; }
+inline int f703_27(int x) { return x * 27; }
+inline int f703_28(int x) { return x * 28; }
+inline int f703_29(int x) { return x * 29; }
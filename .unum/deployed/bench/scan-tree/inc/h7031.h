@@ -0,0 +1,42 @@
+#pragma once
+/* header 7031 */
+#include <vector>
+#include "h7040.h"
+#include "h6321.h"
+#include "h9252.h"
+#include "h3972.h"
+#include "h1376.h"
+#ifdef X
+#include "h4166.h"
+#endif
+struct S7031 { int a; const char *s = "x//y"; };
+inline int f7031_0(int x) { return x * 0; }
+inline int f7031_1(int x) { return x * 1; }
+inline int f7031_2(int x) { return x * 2; }
+inline int f7031_3(int x) { return x * 3; }
+inline int f7031_4(int x) { return x * 4; }
+inline int f7031_5(int x) { return x * 5; }
+inline int f7031_6(int x) { return x * 6; }
+inline int f7031_7(int x) { return x * 7; }
+inline int f7031_8(int x) { return x * 8; }
+inline int f7031_9(int x) { return x * 9; }
+inline int f7031_10(int x) { return x * 10; }
+inline int f7031_11(int x) { return x * 11; }
+inline int f7031_12(int x) { return x * 12; }
+inline int f7031_13(int x) { return x * 13; }
+inline int f7031_14(int x) { return x * 14; }
+inline int f7031_15(int x) { return x * 15; }
+inline int f7031_16(int x) { return x * 16; }
+inline int f7031_17(int x) { return x * 17; }
+inline int f7031_18(int x) { return x * 18; }
+inline int f7031_19(int x) { return x * 19; }
+inline int f7031_20(int x) { return x * 20; }
+inline int f7031_21(int x) { return x * 21; }
+inline int f7031_22(int x) { return x * 22; }
+inline int f7031_23(int x) { return x * 23; }
+inline int f7031_24(int x) { return x * 24; }
+inline int f7031_25(int x) { return x * 25; }
+inline int f7031_26(int x) { return x * 26; }
+inline int f7031_27(int x) { return x * 27; }
+inline int f7031_28(int x) { return x * 28; }
+inline int f7031_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7032 */
+#include <vector>
+#include "h6499.h"
+#include "h3562.h"
+#include "h9692.h"
+#include "h8097.h"
+#include "h8858.h"
+#ifdef X
+#include "h2895.h"
+#endif
+struct S7032 { int a; const char *s = "x//y"; };
+inline int f7032_0(int x) { return x * 0; }
+inline int f7032_1(int x) { return x * 1; }
+inline int f7032_2(int x) { return x * 2; }
+inline int f7032_3(int x) { return x * 3; }
+inline int f7032_4(int x) { return x * 4; }
+inline int f7032_5(int x) { return x * 5; }
+inline int f7032_6(int x) { return x * 6; }
+inline int f7032_7(int x) { return x * 7; }
+inline int f7032_8(int x) { return x * 8; }
+inline int f7032_9(int x) { return x * 9; }
+inline int f7032_10(int x) { return x * 10; }
+inline int f7032_11(int x) { return x * 11; }
+inline int f7032_12(int x) { return x * 12; }
+inline int f7032_13(int x) { return x * 13; }
+inline int f7032_14(int x) { return x * 14; }
+inline int f7032_15(int x) { return x * 15; }
+inline int f7032_16(int x) { return x * 16; }
+inline int f7032_17(int x) { return x * 17; }
+inline int f7032_18(int x) { return x * 18; }
+inline int f7032_19(int x) { return x * 19; }
+inline int f7032_20(int x) { return x * 20; }
+inline int f7032_21(int x) { return x * 21; }
+inline int f7032_22(int x) { return x * 22; }
+inline int f7032_23(int x) { return x * 23; }
+inline int f7032_24(int x) { return x * 24; }
+inline int f7032_25(int x) { return x * 25; }
+inline int f7032_26(int x) { return x * 26; }
+inline int f7032_27(int x) { return x * 27; }
+inline int f7032_28(int x) { return x * 28; }
+inline int f7032_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7033 */
+#include <vector>
+#include "h8034.h"
+#include "h271.h"
+#include "h2736.h"
+#include "h4792.h"
+#include "h440.h"
+#ifdef X
+#include "h2722.h"
+#endif
+struct S7033 { int a; const char *s = "x//y"; };
+inline int f7033_0(int x) { return x * 0; }
+inline int f7033_1(int x) { return x * 1; }
+inline int f7033_2(int x) { return x * 2; }
+inline int f7033_3(int x) { return x * 3; }
+inline int f7033_4(int x) { return x * 4; }
+inline int f7033_5(int x) { return x * 5; }
+inline int f7033_6(int x) { return x * 6; }
+inline int f7033_7(int x) { return x * 7; }
+inline int f7033_8(int x) { return x * 8; }
+inline int f7033_9(int x) { return x * 9; }
+inline int f7033_10(int x) { return x * 10; }
+inline int f7033_11(int x) { return x * 11; }
+inline int f7033_12(int x) { return x * 12; }
+inline int f7033_13(int x) { return x * 13; }
+inline int f7033_14(int x) { return x * 14; }
+inline int f7033_15(int x) { return x * 15; }
+inline int f7033_16(int x) { return x * 16; }
+inline int f7033_17(int x) { return x * 17; }
+inline int f7033_18(int x) { return x * 18; }
+inline int f7033_19(int x) { return x * 19; }
+inline int f7033_20(int x) { return x * 20; }
+inline int f7033_21(int x) { return x * 21; }
+inline int f7033_22(int x) { return x * 22; }
+inline int f7033_23(int x) { return x * 23; }
+inline int f7033_24(int x) { return x * 24; }
+inline int f7033_25(int x) { return x * 25; }
+inline int f7033_26(int x) { return x * 26; }
+inline int f7033_27(int x) { return x * 27; }
+inline int f7033_28(int x) { return x * 28; }
+inline int f7033_29(int x) { return x * 29; }
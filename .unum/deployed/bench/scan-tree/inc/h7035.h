@@ -0,0 +1,42 @@
+#pragma once
+/* header 7035 */
+#include <vector>
+#include "h1377.h"
+#include "h4584.h"
+#include "h5746.h"
+#include "h4157.h"
+#include "h293.h"
+#ifdef X
+#include "h834.h"
+#endif
+struct S7035 { int a; const char *s = "x//y"; };
+inline int f7035_0(int x) { return x * 0; }
+inline int f7035_1(int x) { return x * 1; }
+inline int f7035_2(int x) { return x * 2; }
+inline int f7035_3(int x) { return x * 3; }
+inline int f7035_4(int x) { return x * 4; }
+inline int f7035_5(int x) { return x * 5; }
+inline int f7035_6(int x) { return x * 6; }
+inline int f7035_7(int x) { return x * 7; }
+inline int f7035_8(int x) { return x * 8; }
+inline int f7035_9(int x) { return x * 9; }
+inline int f7035_10(int x) { return x * 10; }
+inline int f7035_11(int x) { return x * 11; }
+inline int f7035_12(int x) { return x * 12; }
+inline int f7035_13(int x) { return x * 13; }
+inline int f7035_14(int x) { return x * 14; }
+inline int f7035_15(int x) { return x * 15; }
+inline int f7035_16(int x) { return x * 16; }
+inline int f7035_17(int x) { return x * 17; }
+inline int f7035_18(int x) { return x * 18; }
+inline int f7035_19(int x) { return x * 19; }
+inline int f7035_20(int x) { return x * 20; }
+inline int f7035_21(int x) { return x * 21; }
+inline int f7035_22(int x) { return x * 22; }
+inline int f7035_23(int x) { return x * 23; }
+inline int f7035_24(int x) { return x * 24; }
+inline int f7035_25(int x) { return x * 25; }
+inline int f7035_26(int x) { return x * 26; }
+inline int f7035_27(int x) { return x * 27; }
+inline int f7035_28(int x) { return x * 28; }
+inline int f7035_29(int x) { return x * 29; }
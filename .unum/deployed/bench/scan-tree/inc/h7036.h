@@ -0,0 +1,42 @@
+#pragma once
+/* header 7036 */
+#include <vector>
+#include "h1057.h"
+#include "h1426.h"
+#include "h2102.h"
+#include "h4756.h"
+#include "h2619.h"
+#ifdef X
+#include "h980.h"
+#endif
+struct S7036 { int a; const char *s = "x//y"; };
+inline int f7036_0(int x) { return x * 0; }
+inline int f7036_1(int x) { return x * 1; }
+inline int f7036_2(int x) { return x * 2; }
+inline int f7036_3(int x) { return x * 3; }
+inline int f7036_4(int x) { return x * 4; }
+inline int f7036_5(int x) { return x * 5; }
+inline int f7036_6(int x) { return x * 6; }
+inline int f7036_7(int x) { return x * 7; }
+inline int f7036_8(int x) { return x * 8; }
+inline int f7036_9(int x) { return x * 9; }
+inline int f7036_10(int x) { return x * 10; }
+inline int f7036_11(int x) { return x * 11; }
+inline int f7036_12(int x) { return x * 12; }
+inline int f7036_13(int x) { return x * 13; }
+inline int f7036_14(int x) { return x * 14; }
+inline int f7036_15(int x) { return x * 15; }
+inline int f7036_16(int x) { return x * 16; }
+inline int f7036_17(int x) { return x * 17; }
+inline int f7036_18(int x) { return x * 18; }
+inline int f7036_19(int x) { return x * 19; }
+inline int f7036_20(int x) { return x * 20; }
+inline int f7036_21(int x) { return x * 21; }
+inline int f7036_22(int x) { return x * 22; }
+inline int f7036_23(int x) { return x * 23; }
+inline int f7036_24(int x) { return x * 24; }
+inline int f7036_25(int x) { return x * 25; }
+inline int f7036_26(int x) { return x * 26; }
+inline int f7036_27(int x) { return x * 27; }
+inline int f7036_28(int x) { return x * 28; }
+inline int f7036_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7037 */
+#include <vector>
+#include "h5696.h"
+#include "h3509.h"
+#include "h7080.h"
+#include "h5058.h"
+#include "h307.h"
+#ifdef X
+#include "h3392.h"
+#endif
+struct S7037 { int a; const char *s = "x//y"; };
+inline int f7037_0(int x) { return x * 0; }
+inline int f7037_1(int x) { return x * 1; }
+inline int f7037_2(int x) { return x * 2; }
+inline int f7037_3(int x) { return x * 3; }
+inline int f7037_4(int x) { return x * 4; }
+inline int f7037_5(int x) { return x * 5; }
+inline int f7037_6(int x) { return x * 6; }
+inline int f7037_7(int x) { return x * 7; }
+inline int f7037_8(int x) { return x * 8; }
+inline int f7037_9(int x) { return x * 9; }
+inline int f7037_10(int x) { return x * 10; }
+inline int f7037_11(int x) { return x * 11; }
+inline int f7037_12(int x) { return x * 12; }
+inline int f7037_13(int x) { return x * 13; }
+inline int f7037_14(int x) { return x * 14; }
+inline int f7037_15(int x) { return x * 15; }
+inline int f7037_16(int x) { return x * 16; }
+inline int f7037_17(int x) { return x * 17; }
+inline int f7037_18(int x) { return x * 18; }
+inline int f7037_19(int x) { return x * 19; }
+inline int f7037_20(int x) { return x * 20; }
+inline int f7037_21(int x) { return x * 21; }
+inline int f7037_22(int x) { return x * 22; }
+inline int f7037_23(int x) { return x * 23; }
+inline int f7037_24(int x) { return x * 24; }
+inline int f7037_25(int x) { return x * 25; }
+inline int f7037_26(int x) { return x * 26; }
+inline int f7037_27(int x) { return x * 27; }
+inline int f7037_28(int x) { return x * 28; }
+inline int f7037_29(int x) { return x * 29; }
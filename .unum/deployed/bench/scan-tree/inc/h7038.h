@@ -0,0 +1,42 @@
+#pragma once
+/* header 7038 */
+#include <vector>
+#include "h4933.h"
+#include "h8878.h"
+#include "h5436.h"
+#include "h6331.h"
+#include "h8061.h"
+#ifdef X
+#include "h2977.h"
+#endif
+struct S7038 { int a; const char *s = "x//y"; };
+inline int f7038_0(int x) { return x * 0; }
+inline int f7038_1(int x) { return x * 1; }
+inline int f7038_2(int x) { return x * 2; }
+inline int f7038_3(int x) { return x * 3; }
+inline int f7038_4(int x) { return x * 4; }
+inline int f7038_5(int x) { return x * 5; }
+inline int f7038_6(int x) { return x * 6; }
+inline int f7038_7(int x) { return x * 7; }
+inline int f7038_8(int x) { return x * 8; }
+inline int f7038_9(int x) { return x * 9; }
+inline int f7038_10(int x) { return x * 10; }
+inline int f7038_11(int x) { return x * 11; }
+inline int f7038_12(int x) { return x * 12; }
+inline int f7038_13(int x) { return x * 13; }
+inline int f7038_14(int x) { return x * 14; }
+inline int f7038_15(int x) { return x * 15; }
+inline int f7038_16(int x) { return x * 16; }
+inline int f7038_17(int x) { return x * 17; }
+inline int f7038_18(int x) { return x * 18; }
+inline int f7038_19(int x) { return x * 19; }
+inline int f7038_20(int x) { return x * 20; }
+inline int f7038_21(int x) { return x * 21; }
+inline int f7038_22(int x) { return x * 22; }
+inline int f7038_23(int x) { return x * 23; }
+inline int f7038_24(int x) { return x * 24; }
+inline int f7038_25(int x) { return x * 25; }
+inline int f7038_26(int x) { return x * 26; }
+inline int f7038_27(int x) { return x * 27; }
+inline int f7038_28(int x) { return x * 28; }
+inline int f7038_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7039 */
+#include <vector>
+#include "h9906.h"
+#include "h2134.h"
+#include "h9292.h"
+#include "h8379.h"
+#include "h7122.h"
+#ifdef X
+#include "h6912.h"
+#endif
+struct S7039 { int a; const char *s = "x//y"; };
+inline int f7039_0(int x) { return x * 0; }
+inline int f7039_1(int x) { return x * 1; }
+inline int f7039_2(int x) { return x * 2; }
+inline int f7039_3(int x) { return x * 3; }
+inline int f7039_4(int x) { return x * 4; }
+inline int f7039_5(int x) { return x * 5; }
+inline int f7039_6(int x) { return x * 6; }
+inline int f7039_7(int x) { return x * 7; }
+inline int f7039_8(int x) { return x * 8; }
+inline int f7039_9(int x) { return x * 9; }
+inline int f7039_10(int x) { return x * 10; }
+inline int f7039_11(int x) { return x * 11; }
+inline int f7039_12(int x) { return x * 12; }
+inline int f7039_13(int x) { return x * 13; }
+inline int f7039_14(int x) { return x * 14; }
+inline int f7039_15(int x) { return x * 15; }
+inline int f7039_16(int x) { return x * 16; }
+inline int f7039_17(int x) { return x * 17; }
+inline int f7039_18(int x) { return x * 18; }
+inline int f7039_19(int x) { return x * 19; }
+inline int f7039_20(int x) { return x * 20; }
+inline int f7039_21(int x) { return x * 21; }
+inline int f7039_22(int x) { return x * 22; }
+inline int f7039_23(int x) { return x * 23; }
+inline int f7039_24(int x) { return x * 24; }
+inline int f7039_25(int x) { return x * 25; }
+inline int f7039_26(int x) { return x * 26; }
+inline int f7039_27(int x) { return x * 27; }
+inline int f7039_28(int x) { return x * 28; }
+inline int f7039_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 704 */
+#include <vector>
+#include "h5201.h"
+#include "h562.h"
+#include "h3063.h"
+#include "h8753.h"
+#include "h7810.h"
+#ifdef X
+#include "h6352.h"
+#endif
+struct S704 { int a; const char *s = "x//y"; };
+inline int f704_0(int x) { return x * 0; }
+inline int f704_1(int x) { return x * 1; }
+inline int f704_2(int x) { return x * 2; }
+inline int f704_3(int x) { return x * 3; }
+inline int f704_4(int x) { return x * 4; }
+inline int f704_5(int x) { return x * 5; }
+inline int f704_6(int x) { return x * 6; }
+inline int f704_7(int x) { return x * 7; }
+inline int f704_8(int x) { return x * 8; }
+inline int f704_9(int x) { return x * 9; }
+inline int f704_10(int x) { return x * 10; }
+inline int f704_11(int x) { return x * 11; }
+inline int f704_12(int x) { return x * 12; }
+inline int f704_13(int x) { return x * 13; }
+inline int f704_14(int x) { return x * 14; }
+inline int f704_15(int x) { return x * 15; }
+inline int f704_16(int x) { return x * 16; }
+inline int f704_17(int x) { return x * 17; }
+inline int f704_18(int x) { return x * 18; }
+inline int f704_19(int x) { return x * 19; }
+inline int f704_20(int x) { return x * 20; }
+inline int f704_21(int x) { return x * 21; }
+inline int f704_22(int x) { return x * 22; }
+inline int f704_23(int x) { return x * 23; }
+inline int f704_24(int x) { return x * 24; }
+inline int f704_25(int x) { return x * 25; }
+inline int f704_26(int x) { return x * 26; }
+inline int f704_27(int x) { return x * 27; }
+inline int f704_28(int x) { return x * 28; }
+inline int f704_29(int x) { return x * 29; }
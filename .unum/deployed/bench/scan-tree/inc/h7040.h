@@ -0,0 +1,42 @@
+#pragma once
+/* header 7040 */
+#include <vector>
+#include "h9882.h"
+#include "h3388.h"
+#include "h8005.h"
+#include "h4033.h"
+#include "h7919.h"
+#ifdef X
+#include "h2786.h"
+#endif
+struct S7040 { int a; const char *s = "x//y"; };
+inline int f7040_0(int x) { return x * 0; }
+inline int f7040_1(int x) { return x * 1; }
+inline int f7040_2(int x) { return x * 2; }
+inline int f7040_3(int x) { return x * 3; }
+inline int f7040_4(int x) { return x * 4; }
+inline int f7040_5(int x) { return x * 5; }
+inline int f7040_6(int x) { return x * 6; }
+inline int f7040_7(int x) { return x * 7; }
+inline int f7040_8(int x) { return x * 8; }
+inline int f7040_9(int x) { return x * 9; }
+inline int f7040_10(int x) { return x * 10; }
+inline int f7040_11(int x) { return x * 11; }
+inline int f7040_12(int x) { return x * 12; }
+inline int f7040_13(int x) { return x * 13; }
+inline int f7040_14(int x) { return x * 14; }
+inline int f7040_15(int x) { return x * 15; }
+inline int f7040_16(int x) { return x * 16; }
+inline int f7040_17(int x) { return x * 17; }
+inline int f7040_18(int x) { return x * 18; }
+inline int f7040_19(int x) { return x * 19; }
+inline int f7040_20(int x) { return x * 20; }
+inline int f7040_21(int x) { return x * 21; }
+inline int f7040_22(int x) { return x * 22; }
+inline int f7040_23(int x) { return x * 23; }
+inline int f7040_24(int x) { return x * 24; }
+inline int f7040_25(int x) { return x * 25; }
+inline int f7040_26(int x) { return x * 26; }
+inline int f7040_27(int x) { return x * 27; }
+inline int f7040_28(int x) { return x * 28; }
+inline int f7040_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7044 */
+#include <vector>
+#include "h9079.h"
+#include "h1593.h"
+#include "h1894.h"
+#include "h1761.h"
+#include "h1739.h"
+#ifdef X
+#include "h1735.h"
+#endif
+struct S7044 { int a; const char *s = "x//y"; };
+inline int f7044_0(int x) { return x * 0; }
+inline int f7044_1(int x) { return x * 1; }
+inline int f7044_2(int x) { return x * 2; }
+inline int f7044_3(int x) { return x * 3; }
+inline int f7044_4(int x) { return x * 4; }
+inline int f7044_5(int x) { return x * 5; }
+inline int f7044_6(int x) { return x * 6; }
+inline int f7044_7(int x) { return x * 7; }
+inline int f7044_8(int x) { return x * 8; }
+inline int f7044_9(int x) { return x * 9; }
+inline int f7044_10(int x) { return x * 10; }
+inline int f7044_11(int x) { return x * 11; }
+inline int f7044_12(int x) { return x * 12; }
+inline int f7044_13(int x) { return x * 13; }
+inline int f7044_14(int x) { return x * 14; }
+inline int f7044_15(int x) { return x * 15; }
+inline int f7044_16(int x) { return x * 16; }
+inline int f7044_17(int x) { return x * 17; }
+inline int f7044_18(int x) { return x * 18; }
+inline int f7044_19(int x) { return x * 19; }
+inline int f7044_20(int x) { return x * 20; }
+inline int f7044_21(int x) { return x * 21; }
+inline int f7044_22(int x) { return x * 22; }
+inline int f7044_23(int x) { return x * 23; }
+inline int f7044_24(int x) { return x * 24; }
+inline int f7044_25(int x) { return x * 25; }
+inline int f7044_26(int x) { return x * 26; }
+inline int f7044_27(int x) { return x * 27; }
+inline int f7044_28(int x) { return x * 28; }
+inline int f7044_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7045 */
+#include <vector>
+#include "h3038.h"
+#include "h3410.h"
+#include "h1612.h"
+#include "h8760.h"
+#include "h2827.h"
+#ifdef X
+#include "h7966.h"
+#endif
+struct S7045 { int a; const char *s = "x//y"; };
+inline int f7045_0(int x) { return x * 0; }
+inline int f7045_1(int x) { return x * 1; }
+inline int f7045_2(int x) { return x * 2; }
+inline int f7045_3(int x) { return x * 3; }
+inline int f7045_4(int x) { return x * 4; }
+inline int f7045_5(int x) { return x * 5; }
+inline int f7045_6(int x) { return x * 6; }
+inline int f7045_7(int x) { return x * 7; }
+inline int f7045_8(int x) { return x * 8; }
+inline int f7045_9(int x) { return x * 9; }
+inline int f7045_10(int x) { return x * 10; }
+inline int f7045_11(int x) { return x * 11; }
+inline int f7045_12(int x) { return x * 12; }
+inline int f7045_13(int x) { return x * 13; }
+inline int f7045_14(int x) { return x * 14; }
+inline int f7045_15(int x) { return x * 15; }
+inline int f7045_16(int x) { return x * 16; }
+inline int f7045_17(int x) { return x * 17; }
+inline int f7045_18(int x) { return x * 18; }
+inline int f7045_19(int x) { return x * 19; }
+inline int f7045_20(int x) { return x * 20; }
+inline int f7045_21(int x) { return x * 21; }
+inline int f7045_22(int x) { return x * 22; }
+inline int f7045_23(int x) { return x * 23; }
+inline int f7045_24(int x) { return x * 24; }
+inline int f7045_25(int x) { return x * 25; }
+inline int f7045_26(int x) { return x * 26; }
+inline int f7045_27(int x) { return x * 27; }
+inline int f7045_28(int x) { return x * 28; }
+inline int f7045_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7046 */
+#include <vector>
+#include "h6076.h"
+#include "h2254.h"
+#include "h3213.h"
+#include "h4749.h"
+#include "h7147.h"
+#ifdef X
+#include "h62.h"
+#endif
+struct S7046 { int a; const char *s = "x//y"; };
+inline int f7046_0(int x) { return x * 0; }
+inline int f7046_1(int x) { return x * 1; }
+inline int f7046_2(int x) { return x * 2; }
+inline int f7046_3(int x) { return x * 3; }
+inline int f7046_4(int x) { return x * 4; }
+inline int f7046_5(int x) { return x * 5; }
+inline int f7046_6(int x) { return x * 6; }
+inline int f7046_7(int x) { return x * 7; }
+inline int f7046_8(int x) { return x * 8; }
+inline int f7046_9(int x) { return x * 9; }
+inline int f7046_10(int x) { return x * 10; }
+inline int f7046_11(int x) { return x * 11; }
+inline int f7046_12(int x) { return x * 12; }
+inline int f7046_13(int x) { return x * 13; }
+inline int f7046_14(int x) { return x * 14; }
+inline int f7046_15(int x) { return x * 15; }
+inline int f7046_16(int x) { return x * 16; }
+inline int f7046_17(int x) { return x * 17; }
+inline int f7046_18(int x) { return x * 18; }
+inline int f7046_19(int x) { return x * 19; }
+inline int f7046_20(int x) { return x * 20; }
+inline int f7046_21(int x) { return x * 21; }
+inline int f7046_22(int x) { return x * 22; }
+inline int f7046_23(int x) { return x * 23; }
+inline int f7046_24(int x) { return x * 24; }
+inline int f7046_25(int x) { return x * 25; }
+inline int f7046_26(int x) { return x * 26; }
+inline int f7046_27(int x) { return x * 27; }
+inline int f7046_28(int x) { return x * 28; }
+inline int f7046_29(int x) { return x * 29; }
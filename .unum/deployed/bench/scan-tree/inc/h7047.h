@@ -0,0 +1,42 @@
+#pragma once
+/* header 7047 */
+#include <vector>
+#include "h873.h"
+#include "h6635.h"
+#include "h8333.h"
+#include "h7997.h"
+#include "h9761.h"
+#ifdef X
+#include "h9954.h"
+#endif
+struct S7047 { int a; const char *s = "x//y"; };
+inline int f7047_0(int x) { return x * 0; }
+inline int f7047_1(int x) { return x * 1; }
+inline int f7047_2(int x) { return x * 2; }
+inline int f7047_3(int x) { return x * 3; }
+inline int f7047_4(int x) { return x * 4; }
+inline int f7047_5(int x) { return x * 5; }
+inline int f7047_6(int x) { return x * 6; }
+inline int f7047_7(int x) { return x * 7; }
+inline int f7047_8(int x) { return x * 8; }
+inline int f7047_9(int x) { return x * 9; }
+inline int f7047_10(int x) { return x * 10; }
+inline int f7047_11(int x) { return x * 11; }
+inline int f7047_12(int x) { return x * 12; }
+inline int f7047_13(int x) { return x * 13; }
+inline int f7047_14(int x) { return x * 14; }
+inline int f7047_15(int x) { return x * 15; }
+inline int f7047_16(int x) { return x * 16; }
+inline int f7047_17(int x) { return x * 17; }
+inline int f7047_18(int x) { return x * 18; }
+inline int f7047_19(int x) { return x * 19; }
+inline int f7047_20(int x) { return x * 20; }
+inline int f7047_21(int x) { return x * 21; }
+inline int f7047_22(int x) { return x * 22; }
+inline int f7047_23(int x) { return x * 23; }
+inline int f7047_24(int x) { return x * 24; }
+inline int f7047_25(int x) { return x * 25; }
+inline int f7047_26(int x) { return x * 26; }
+inline int f7047_27(int x) { return x * 27; }
+inline int f7047_28(int x) { return x * 28; }
+inline int f7047_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7049 */
+#include <vector>
+#include "h3520.h"
+#include "h98.h"
+#include "h7903.h"
+#include "h4749.h"
+#include "h3671.h"
+#ifdef X
+#include "h2117.h"
+#endif
+struct S7049 { int a; const char *s = "x//y"; };
+inline int f7049_0(int x) { return x * 0; }
+inline int f7049_1(int x) { return x * 1; }
+inline int f7049_2(int x) { return x * 2; }
+inline int f7049_3(int x) { return x * 3; }
+inline int f7049_4(int x) { return x * 4; }
+inline int f7049_5(int x) { return x * 5; }
+inline int f7049_6(int x) { return x * 6; }
+inline int f7049_7(int x) { return x * 7; }
+inline int f7049_8(int x) { return x * 8; }
+inline int f7049_9(int x) { return x * 9; }
+inline int f7049_10(int x) { return x * 10; }
+inline int f7049_11(int x) { return x * 11; }
+inline int f7049_12(int x) { return x * 12; }
+inline int f7049_13(int x) { return x * 13; }
+inline int f7049_14(int x) { return x * 14; }
+inline int f7049_15(int x) { return x * 15; }
+inline int f7049_16(int x) { return x * 16; }
+inline int f7049_17(int x) { return x * 17; }
+inline int f7049_18(int x) { return x * 18; }
+inline int f7049_19(int x) { return x * 19; }
+inline int f7049_20(int x) { return x * 20; }
+inline int f7049_21(int x) { return x * 21; }
+inline int f7049_22(int x) { return x * 22; }
+inline int f7049_23(int x) { return x * 23; }
+inline int f7049_24(int x) { return x * 24; }
+inline int f7049_25(int x) { return x * 25; }
+inline int f7049_26(int x) { return x * 26; }
+inline int f7049_27(int x) { return x * 27; }
+inline int f7049_28(int x) { return x * 28; }
+inline int f7049_29(int x) { return x * 29; }
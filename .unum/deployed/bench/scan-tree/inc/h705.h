@@ -0,0 +1,42 @@
+#pragma once
+/* header 705 */
+#include <vector>
+#include "h9230.h"
+#include "h1409.h"
+#include "h1958.h"
+#include "h9529.h"
+#include "h8353.h"
+#ifdef X
+#include "h4785.h"
+#endif
+struct S705 { int a; const char *s = "x//y"; };
+inline int f705_0(int x) { return x * 0; }
+inline int f705_1(int x) { return x * 1; }
+inline int f705_2(int x) { return x * 2; }
+inline int f705_3(int x) { return x * 3; }
+inline int f705_4(int x) { return x * 4; }
+inline int f705_5(int x) { return x * 5; }
+inline int f705_6(int x) { return x * 6; }
+inline int f705_7(int x) { return x * 7; }
+inline int f705_8(int x) { return x * 8; }
+inline int f705_9(int x) { return x * 9; }
+inline int f705_10(int x) { return x * 10; }
+inline int f705_11(int x) { return x * 11; }
+inline int f705_12(int x) { return x * 12; }
+inline int f705_13(int x) { return x * 13; }
+inline int f705_14(int x) { return x * 14; }
+inline int f705_15(int x) { return x * 15; }
+inline int f705_16(int x) { return x * 16; }
+inline int f705_17(int x) { return x * 17; }
+inline int f705_18(int x) { return x * 18; }
+inline int f705_19(int x) { return x * 19; }
+inline int f705_20(int x) { return x * 20; }
+inline int f705_21(int x) { return x * 21; }
+inline int f705_22(int x) { return x * 22; }
+inline int f705_23(int x) { return x * 23; }
+inline int f705_24(int x) { return x * 24; }
+inline int f705_25(int x) { return x * 25; }
+inline int f705_26(int x) { return x * 26; }
+inline int f705_27(int x) { return x * 27; }
+inline int f705_28(int x) { return x * 28; }
+inline int f705_29(int x) { return x * 29; }
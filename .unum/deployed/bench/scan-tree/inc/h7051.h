@@ -0,0 +1,42 @@
+#pragma once
+/* header 7051 */
+#include <vector>
+#include "h9602.h"
+#include "h9177.h"
+#include "h442.h"
+#include "h2230.h"
+#include "h6632.h"
+#ifdef X
+#include "h9520.h"
+#endif
+struct S7051 { int a; const char *s = "x//y"; };
+inline int f7051_0(int x) { return x * 0; }
+inline int f7051_1(int x) { return x * 1; }
+inline int f7051_2(int x) { return x * 2; }
+inline int f7051_3(int x) { return x * 3; }
+inline int f7051_4(int x) { return x * 4; }
+inline int f7051_5(int x) { return x * 5; }
+inline int f7051_6(int x) { return x * 6; }
+inline int f7051_7(int x) { return x * 7; }
+inline int f7051_8(int x) { return x * 8; }
+inline int f7051_9(int x) { return x * 9; }
+inline int f7051_10(int x) { return x * 10; }
+inline int f7051_11(int x) { return x * 11; }
+inline int f7051_12(int x) { return x * 12; }
+inline int f7051_13(int x) { return x * 13; }
+inline int f7051_14(int x) { return x * 14; }
+inline int f7051_15(int x) { return x * 15; }
+inline int f7051_16(int x) { return x * 16; }
+inline int f7051_17(int x) { return x * 17; }
+inline int f7051_18(int x) { return x * 18; }
+inline int f7051_19(int x) { return x * 19; }
+inline int f7051_20(int x) { return x * 20; }
+inline int f7051_21(int x) { return x * 21; }
+inline int f7051_22(int x) { return x * 22; }
+inline int f7051_23(int x) { return x * 23; }
+inline int f7051_24(int x) { return x * 24; }
+inline int f7051_25(int x) { return x * 25; }
+inline int f7051_26(int x) { return x * 26; }
+inline int f7051_27(int x) { return x * 27; }
+inline int f7051_28(int x) { return x * 28; }
+inline int f7051_29(int x) { return x * 29; }
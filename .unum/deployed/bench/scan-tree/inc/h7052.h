@@ -0,0 +1,42 @@
+#pragma once
+/* header 7052 */
+#include <vector>
+#include "h5667.h"
+#include "h7074.h"
+#include "h5117.h"
+#include "h7675.h"
+#include "h2804.h"
+#ifdef X
+#include "h7055.h"
+#endif
+struct S7052 { int a; const char *s = "x//y"; };
+inline int f7052_0(int x) { return x * 0; }
+inline int f7052_1(int x) { return x * 1; }
+inline int f7052_2(int x) { return x * 2; }
+inline int f7052_3(int x) { return x * 3; }
+inline int f7052_4(int x) { return x * 4; }
+inline int f7052_5(int x) { return x * 5; }
+inline int f7052_6(int x) { return x * 6; }
+inline int f7052_7(int x) { return x * 7; }
+inline int f7052_8(int x) { return x * 8; }
+inline int f7052_9(int x) { return x * 9; }
+inline int f7052_10(int x) { return x * 10; }
+inline int f7052_11(int x) { return x * 11; }
+inline int f7052_12(int x) { return x * 12; }
+inline int f7052_13(int x) { return x * 13; }
+inline int f7052_14(int x) { return x * 14; }
+inline int f7052_15(int x) { return x * 15; }
+inline int f7052_16(int x) { return x * 16; }
+inline int f7052_17(int x) { return x * 17; }
+inline int f7052_18(int x) { return x * 18; }
+inline int f7052_19(int x) { return x * 19; }
+inline int f7052_20(int x) { return x * 20; }
+inline int f7052_21(int x) { return x * 21; }
+inline int f7052_22(int x) { return x * 22; }
+inline int f7052_23(int x) { return x * 23; }
+inline int f7052_24(int x) { return x * 24; }
+inline int f7052_25(int x) { return x * 25; }
+inline int f7052_26(int x) { return x * 26; }
+inline int f7052_27(int x) { return x * 27; }
+inline int f7052_28(int x) { return x * 28; }
+inline int f7052_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7057 */
+#include <vector>
+#include "h3250.h"
+#include "h7677.h"
+#include "h3344.h"
+#include "h3285.h"
+#include "h857.h"
+#ifdef X
+#include "h2750.h"
+#endif
+struct S7057 { int a; const char *s = "x//y"; };
+inline int f7057_0(int x) { return x * 0; }
+inline int f7057_1(int x) { return x * 1; }
+inline int f7057_2(int x) { return x * 2; }
+inline int f7057_3(int x) { return x * 3; }
+inline int f7057_4(int x) { return x * 4; }
+inline int f7057_5(int x) { return x * 5; }
+inline int f7057_6(int x) { return x * 6; }
+inline int f7057_7(int x) { return x * 7; }
+inline int f7057_8(int x) { return x * 8; }
+inline int f7057_9(int x) { return x * 9; }
+inline int f7057_10(int x) { return x * 10; }
+inline int f7057_11(int x) { return x * 11; }
+inline int f7057_12(int x) { return x * 12; }
+inline int f7057_13(int x) { return x * 13; }
+inline int f7057_14(int x) { return x * 14; }
+inline int f7057_15(int x) { return x * 15; }
+inline int f7057_16(int x) { return x * 16; }
+inline int f7057_17(int x) { return x * 17; }
+inline int f7057_18(int x) { return x * 18; }
+inline int f7057_19(int x) { return x * 19; }
+inline int f7057_20(int x) { return x * 20; }
+inline int f7057_21(int x) { return x * 21; }
+inline int f7057_22(int x) { return x * 22; }
+inline int f7057_23(int x) { return x * 23; }
+inline int f7057_24(int x) { return x * 24; }
+inline int f7057_25(int x) { return x * 25; }
+inline int f7057_26(int x) { return x * 26; }
+inline int f7057_27(int x) { return x * 27; }
+inline int f7057_28(int x) { return x * 28; }
+inline int f7057_29(int x) { return x * 29; }
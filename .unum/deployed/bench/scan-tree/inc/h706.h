@@ -0,0 +1,42 @@
+#pragma once
+/* header 706 */
+#include <vector>
+#include "h8190.h"
+#include "h6939.h"
+#include "h8907.h"
+#include "h2948.h"
+#include "h9931.h"
+#ifdef X
+#include "h5693.h"
+#endif
+struct S706 { int a; const char *s = "x//y"; };
+inline int f706_0(int x) { return x * 0; }
+inline int f706_1(int x) { return x * 1; }
+inline int f706_2(int x) { return x * 2; }
+inline int f706_3(int x) { return x * 3; }
+inline int f706_4(int x) { return x * 4; }
+inline int f706_5(int x) { return x * 5; }
+inline int f706_6(int x) { return x * 6; }
+inline int f706_7(int x) { return x * 7; }
+inline int f706_8(int x) { return x * 8; }
+inline int f706_9(int x) { return x * 9; }
+inline int f706_10(int x) { return x * 10; }
+inline int f706_11(int x) { return x * 11; }
+inline int f706_12(int x) { return x * 12; }
+inline int f706_13(int x) { return x * 13; }
+inline int f706_14(int x) { return x * 14; }
+inline int f706_15(int x) { return x * 15; }
+inline int f706_16(int x) { return x * 16; }
+inline int f706_17(int x) { return x * 17; }
+inline int f706_18(int x) { return x * 18; }
+inline int f706_19(int x) { return x * 19; }
+inline int f706_20(int x) { return x * 20; }
+inline int f706_21(int x) { return x * 21; }
+inline int f706_22(int x) { return x * 22; }
+inline int f706_23(int x) { return x * 23; }
+inline int f706_24(int x) { return x * 24; }
+inline int f706_25(int x) { return x * 25; }
+inline int f706_26(int x) { return x * 26; }
+inline int f706_27(int x) { return x * 27; }
+inline int f706_28(int x) { return x * 28; }
+inline int f706_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7062 */
+#include <vector>
+#include "h7625.h"
+#include "h9573.h"
+#include "h3102.h"
+#include "h9735.h"
+#include "h7918.h"
+#ifdef X
+#include "h183.h"
+#endif
+struct S7062 { int a; const char *s = "x//y"; };
+inline int f7062_0(int x) { return x * 0; }
+inline int f7062_1(int x) { return x * 1; }
+inline int f7062_2(int x) { return x * 2; }
+inline int f7062_3(int x) { return x * 3; }
+inline int f7062_4(int x) { return x * 4; }
+inline int f7062_5(int x) { return x * 5; }
+inline int f7062_6(int x) { return x * 6; }
+inline int f7062_7(int x) { return x * 7; }
+inline int f7062_8(int x) { return x * 8; }
+inline int f7062_9(int x) { return x * 9; }
+inline int f7062_10(int x) { return x * 10; }
+inline int f7062_11(int x) { return x * 11; }
+inline int f7062_12(int x) { return x * 12; }
+inline int f7062_13(int x) { return x * 13; }
+inline int f7062_14(int x) { return x * 14; }
+inline int f7062_15(int x) { return x * 15; }
+inline int f7062_16(int x) { return x * 16; }
+inline int f7062_17(int x) { return x * 17; }
+inline int f7062_18(int x) { return x * 18; }
+inline int f7062_19(int x) { return x * 19; }
+inline int f7062_20(int x) { return x * 20; }
+inline int f7062_21(int x) { return x * 21; }
+inline int f7062_22(int x) { return x * 22; }
+inline int f7062_23(int x) { return x * 23; }
+inline int f7062_24(int x) { return x * 24; }
+inline int f7062_25(int x) { return x * 25; }
+inline int f7062_26(int x) { return x * 26; }
+inline int f7062_27(int x) { return x * 27; }
+inline int f7062_28(int x) { return x * 28; }
+inline int f7062_29(int x) { return x * 29; }
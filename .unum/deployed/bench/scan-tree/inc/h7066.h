@@ -0,0 +1,42 @@
+#pragma once
+/* header 7066 */
+#include <vector>
+#include "h4175.h"
+#include "h605.h"
+#include "h4254.h"
+#include "h4949.h"
+#include "h1636.h"
+#ifdef X
+#include "h8798.h"
+#endif
+struct S7066 { int a; const char *s = "x//y"; };
+inline int f7066_0(int x) { return x * 0; }
+inline int f7066_1(int x) { return x * 1; }
+inline int f7066_2(int x) { return x * 2; }
+inline int f7066_3(int x) { return x * 3; }
+inline int f7066_4(int x) { return x * 4; }
+inline int f7066_5(int x) { return x * 5; }
+inline int f7066_6(int x) { return x * 6; }
+inline int f7066_7(int x) { return x * 7; }
+inline int f7066_8(int x) { return x * 8; }
+inline int f7066_9(int x) { return x * 9; }
+inline int f7066_10(int x) { return x * 10; }
+inline int f7066_11(int x) { return x * 11; }
+inline int f7066_12(int x) { return x * 12; }
+inline int f7066_13(int x) { return x * 13; }
+inline int f7066_14(int x) { return x * 14; }
+inline int f7066_15(int x) { return x * 15; }
+inline int f7066_16(int x) { return x * 16; }
+inline int f7066_17(int x) { return x * 17; }
+inline int f7066_18(int x) { return x * 18; }
+inline int f7066_19(int x) { return x * 19; }
+inline int f7066_20(int x) { return x * 20; }
+inline int f7066_21(int x) { return x * 21; }
+inline int f7066_22(int x) { return x * 22; }
+inline int f7066_23(int x) { return x * 23; }
+inline int f7066_24(int x) { return x * 24; }
+inline int f7066_25(int x) { return x * 25; }
+inline int f7066_26(int x) { return x * 26; }
+inline int f7066_27(int x) { return x * 27; }
+inline int f7066_28(int x) { return x * 28; }
+inline int f7066_29(int x) { return x * 29; }
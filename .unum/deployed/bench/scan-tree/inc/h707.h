@@ -0,0 +1,42 @@
+#pragma once
+/* header 707 */
+#include <vector>
+#include "h6814.h"
+#include "h5785.h"
+#include "h1700.h"
+#include "h7580.h"
+#include "h9231.h"
+#ifdef X
+#include "h4882.h"
+#endif
+struct S707 { int a; const char *s = "x//y"; };
+inline int f707_0(int x) { return x * 0; }
+inline int f707_1(int x) { return x * 1; }
+inline int f707_2(int x) { return x * 2; }
+inline int f707_3(int x) { return x * 3; }
+inline int f707_4(int x) { return x * 4; }
+inline int f707_5(int x) { return x * 5; }
+inline int f707_6(int x) { return x * 6; }
+inline int f707_7(int x) { return x * 7; }
+inline int f707_8(int x) { return x * 8; }
+inline int f707_9(int x) { return x * 9; }
+inline int f707_10(int x) { return x * 10; }
+inline int f707_11(int x) { return x * 11; }
+inline int f707_12(int x) { return x * 12; }
+inline int f707_13(int x) { return x * 13; }
+inline int f707_14(int x) { return x * 14; }
+inline int f707_15(int x) { return x * 15; }
+inline int f707_16(int x) { return x * 16; }
+inline int f707_17(int x) { return x * 17; }
+inline int f707_18(int x) { return x * 18; }
+inline int f707_19(int x) { return x * 19; }
+inline int f707_20(int x) { return x * 20; }
+inline int f707_21(int x) { return x * 21; }
+inline int f707_22(int x) { return x * 22; }
+inline int f707_23(int x) { return x * 23; }
+inline int f707_24(int x) { return x * 24; }
+inline int f707_25(int x) { return x * 25; }
+inline int f707_26(int x) { return x * 26; }
+inline int f707_27(int x) { return x * 27; }
+inline int f707_28(int x) { return x * 28; }
+inline int f707_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7071 */
+#include <vector>
+#include "h9405.h"
+#include "h4452.h"
+#include "h6840.h"
+#include "h5981.h"
+#include "h5585.h"
+#ifdef X
+#include "h1207.h"
+#endif
+struct S7071 { int a; const char *s = "x//y"; };
+inline int f7071_0(int x) { return x * 0; }
+inline int f7071_1(int x) { return x * 1; }
+inline int f7071_2(int x) { return x * 2; }
+inline int f7071_3(int x) { return x * 3; }
+inline int f7071_4(int x) { return x * 4; }
+inline int f7071_5(int x) { return x * 5; }
+inline int f7071_6(int x) { return x * 6; }
+inline int f7071_7(int x) { return x * 7; }
+inline int f7071_8(int x) { return x * 8; }
+inline int f7071_9(int x) { return x * 9; }
+inline int f7071_10(int x) { return x * 10; }
+inline int f7071_11(int x) { return x * 11; }
+inline int f7071_12(int x) { return x * 12; }
+inline int f7071_13(int x) { return x * 13; }
+inline int f7071_14(int x) { return x * 14; }
+inline int f7071_15(int x) { return x * 15; }
+inline int f7071_16(int x) { return x * 16; }
+inline int f7071_17(int x) { return x * 17; }
+inline int f7071_18(int x) { return x * 18; }
+inline int f7071_19(int x) { return x * 19; }
+inline int f7071_20(int x) { return x * 20; }
+inline int f7071_21(int x) { return x * 21; }
+inline int f7071_22(int x) { return x * 22; }
+inline int f7071_23(int x) { return x * 23; }
+inline int f7071_24(int x) { return x * 24; }
+inline int f7071_25(int x) { return x * 25; }
+inline int f7071_26(int x) { return x * 26; }
+inline int f7071_27(int x) { return x * 27; }
+inline int f7071_28(int x) { return x * 28; }
+inline int f7071_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7075 */
+#include <vector>
+#include "h7632.h"
+#include "h4825.h"
+#include "h4017.h"
+#include "h1374.h"
+#include "h7958.h"
+#ifdef X
+#include "h9351.h"
+#endif
+struct S7075 { int a; const char *s = "x//y"; };
+inline int f7075_0(int x) { return x * 0; }
+inline int f7075_1(int x) { return x * 1; }
+inline int f7075_2(int x) { return x * 2; }
+inline int f7075_3(int x) { return x * 3; }
+inline int f7075_4(int x) { return x * 4; }
+inline int f7075_5(int x) { return x * 5; }
+inline int f7075_6(int x) { return x * 6; }
+inline int f7075_7(int x) { return x * 7; }
+inline int f7075_8(int x) { return x * 8; }
+inline int f7075_9(int x) { return x * 9; }
+inline int f7075_10(int x) { return x * 10; }
+inline int f7075_11(int x) { return x * 11; }
+inline int f7075_12(int x) { return x * 12; }
+inline int f7075_13(int x) { return x * 13; }
+inline int f7075_14(int x) { return x * 14; }
+inline int f7075_15(int x) { return x * 15; }
+inline int f7075_16(int x) { return x * 16; }
+inline int f7075_17(int x) { return x * 17; }
+inline int f7075_18(int x) { return x * 18; }
+inline int f7075_19(int x) { return x * 19; }
+inline int f7075_20(int x) { return x * 20; }
+inline int f7075_21(int x) { return x * 21; }
+inline int f7075_22(int x) { return x * 22; }
+inline int f7075_23(int x) { return x * 23; }
+inline int f7075_24(int x) { return x * 24; }
+inline int f7075_25(int x) { return x * 25; }
+inline int f7075_26(int x) { return x * 26; }
+inline int f7075_27(int x) { return x * 27; }
+inline int f7075_28(int x) { return x * 28; }
+inline int f7075_29(int x) { return x * 29; }
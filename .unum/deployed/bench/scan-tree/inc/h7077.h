@@ -0,0 +1,42 @@
+#pragma once
+/* header 7077 */
+#include <vector>
+#include "h2949.h"
+#include "h1819.h"
+#include "h5726.h"
+#include "h9816.h"
+#include "h6326.h"
+#ifdef X
+#include "h496.h"
+#endif
+struct S7077 { int a; const char *s = "x//y"; };
+inline int f7077_0(int x) { return x * 0; }
+inline int f7077_1(int x) { return x * 1; }
+inline int f7077_2(int x) { return x * 2; }
+inline int f7077_3(int x) { return x * 3; }
+inline int f7077_4(int x) { return x * 4; }
+inline int f7077_5(int x) { return x * 5; }
+inline int f7077_6(int x) { return x * 6; }
+inline int f7077_7(int x) { return x * 7; }
+inline int f7077_8(int x) { return x * 8; }
+inline int f7077_9(int x) { return x * 9; }
+inline int f7077_10(int x) { return x * 10; }
+inline int f7077_11(int x) { return x * 11; }
+inline int f7077_12(int x) { return x * 12; }
+inline int f7077_13(int x) { return x * 13; }
+inline int f7077_14(int x) { return x * 14; }
+inline int f7077_15(int x) { return x * 15; }
+inline int f7077_16(int x) { return x * 16; }
+inline int f7077_17(int x) { return x * 17; }
+inline int f7077_18(int x) { return x * 18; }
+inline int f7077_19(int x) { return x * 19; }
+inline int f7077_20(int x) { return x * 20; }
+inline int f7077_21(int x) { return x * 21; }
+inline int f7077_22(int x) { return x * 22; }
+inline int f7077_23(int x) { return x * 23; }
+inline int f7077_24(int x) { return x * 24; }
+inline int f7077_25(int x) { return x * 25; }
+inline int f7077_26(int x) { return x * 26; }
+inline int f7077_27(int x) { return x * 27; }
+inline int f7077_28(int x) { return x * 28; }
+inline int f7077_29(int x) { return x * 29; }
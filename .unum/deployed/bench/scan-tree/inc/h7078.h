@@ -0,0 +1,42 @@
+#pragma once
+/* header 7078 */
+#include <vector>
+#include "h8519.h"
+#include "h2021.h"
+#include "h361.h"
+#include "h615.h"
+#include "h737.h"
+#ifdef X
+#include "h4520.h"
+#endif
+struct S7078 { int a; const char *s = "x//y"; };
+inline int f7078_0(int x) { return x * 0; }
+inline int f7078_1(int x) { return x * 1; }
+inline int f7078_2(int x) { return x * 2; }
+inline int f7078_3(int x) { return x * 3; }
+inline int f7078_4(int x) { return x * 4; }
+inline int f7078_5(int x) { return x * 5; }
+inline int f7078_6(int x) { return x * 6; }
+inline int f7078_7(int x) { return x * 7; }
+inline int f7078_8(int x) { return x * 8; }
+inline int f7078_9(int x) { return x * 9; }
+inline int f7078_10(int x) { return x * 10; }
+inline int f7078_11(int x) { return x * 11; }
+inline int f7078_12(int x) { return x * 12; }
+inline int f7078_13(int x) { return x * 13; }
+inline int f7078_14(int x) { return x * 14; }
+inline int f7078_15(int x) { return x * 15; }
+inline int f7078_16(int x) { return x * 16; }
+inline int f7078_17(int x) { return x * 17; }
+inline int f7078_18(int x) { return x * 18; }
+inline int f7078_19(int x) { return x * 19; }
+inline int f7078_20(int x) { return x * 20; }
+inline int f7078_21(int x) { return x * 21; }
+inline int f7078_22(int x) { return x * 22; }
+inline int f7078_23(int x) { return x * 23; }
+inline int f7078_24(int x) { return x * 24; }
+inline int f7078_25(int x) { return x * 25; }
+inline int f7078_26(int x) { return x * 26; }
+inline int f7078_27(int x) { return x * 27; }
+inline int f7078_28(int x) { return x * 28; }
+inline int f7078_29(int x) { return x * 29; }
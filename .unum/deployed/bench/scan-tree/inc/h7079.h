@@ -0,0 +1,42 @@
+#pragma once
+/* header 7079 */
+#include <vector>
+#include "h5338.h"
+#include "h8969.h"
+#include "h8099.h"
+#include "h7323.h"
+#include "h2532.h"
+#ifdef X
+#include "h3027.h"
+#endif
+struct S7079 { int a; const char *s = "x//y"; };
+inline int f7079_0(int x) { return x * 0; }
+inline int f7079_1(int x) { return x * 1; }
+inline int f7079_2(int x) { return x * 2; }
+inline int f7079_3(int x) { return x * 3; }
+inline int f7079_4(int x) { return x * 4; }
+inline int f7079_5(int x) { return x * 5; }
+inline int f7079_6(int x) { return x * 6; }
+inline int f7079_7(int x) { return x * 7; }
+inline int f7079_8(int x) { return x * 8; }
+inline int f7079_9(int x) { return x * 9; }
+inline int f7079_10(int x) { return x * 10; }
+inline int f7079_11(int x) { return x * 11; }
+inline int f7079_12(int x) { return x * 12; }
+inline int f7079_13(int x) { return x * 13; }
+inline int f7079_14(int x) { return x * 14; }
+inline int f7079_15(int x) { return x * 15; }
+inline int f7079_16(int x) { return x * 16; }
+inline int f7079_17(int x) { return x * 17; }
+inline int f7079_18(int x) { return x * 18; }
+inline int f7079_19(int x) { return x * 19; }
+inline int f7079_20(int x) { return x * 20; }
+inline int f7079_21(int x) { return x * 21; }
+inline int f7079_22(int x) { return x * 22; }
+inline int f7079_23(int x) { return x * 23; }
+inline int f7079_24(int x) { return x * 24; }
+inline int f7079_25(int x) { return x * 25; }
+inline int f7079_26(int x) { return x * 26; }
+inline int f7079_27(int x) { return x * 27; }
+inline int f7079_28(int x) { return x * 28; }
+inline int f7079_29(int x) { return x * 29; }
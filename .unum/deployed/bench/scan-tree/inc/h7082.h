@@ -0,0 +1,42 @@
+#pragma once
+/* header 7082 */
+#include <vector>
+#include "h44.h"
+#include "h4451.h"
+#include "h5352.h"
+#include "h1627.h"
+#include "h24.h"
+#ifdef X
+#include "h2221.h"
+#endif
+struct S7082 { int a; const char *s = "x//y"; };
+inline int f7082_0(int x) { return x * 0; }
+inline int f7082_1(int x) { return x * 1; }
+inline int f7082_2(int x) { return x * 2; }
+inline int f7082_3(int x) { return x * 3; }
+inline int f7082_4(int x) { return x * 4; }
+inline int f7082_5(int x) { return x * 5; }
+inline int f7082_6(int x) { return x * 6; }
+inline int f7082_7(int x) { return x * 7; }
+inline int f7082_8(int x) { return x * 8; }
+inline int f7082_9(int x) { return x * 9; }
+inline int f7082_10(int x) { return x * 10; }
+inline int f7082_11(int x) { return x * 11; }
+inline int f7082_12(int x) { return x * 12; }
+inline int f7082_13(int x) { return x * 13; }
+inline int f7082_14(int x) { return x * 14; }
+inline int f7082_15(int x) { return x * 15; }
+inline int f7082_16(int x) { return x * 16; }
+inline int f7082_17(int x) { return x * 17; }
+inline int f7082_18(int x) { return x * 18; }
+inline int f7082_19(int x) { return x * 19; }
+inline int f7082_20(int x) { return x * 20; }
+inline int f7082_21(int x) { return x * 21; }
+inline int f7082_22(int x) { return x * 22; }
+inline int f7082_23(int x) { return x * 23; }
+inline int f7082_24(int x) { return x * 24; }
+inline int f7082_25(int x) { return x * 25; }
+inline int f7082_26(int x) { return x * 26; }
+inline int f7082_27(int x) { return x * 27; }
+inline int f7082_28(int x) { return x * 28; }
+inline int f7082_29(int x) { return x * 29; }
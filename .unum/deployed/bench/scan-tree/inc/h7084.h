@@ -0,0 +1,42 @@
+#pragma once
+/* header 7084 */
+#include <vector>
+#include "h3407.h"
+#include "h8403.h"
+#include "h1232.h"
+#include "h6897.h"
+#include "h8968.h"
+#ifdef X
+#include "h581.h"
+#endif
+struct S7084 { int a; const char *s = "x//y"; };
+inline int f7084_0(int x) { return x * 0; }
+inline int f7084_1(int x) { return x * 1; }
+inline int f7084_2(int x) { return x * 2; }
+inline int f7084_3(int x) { return x * 3; }
+inline int f7084_4(int x) { return x * 4; }
+inline int f7084_5(int x) { return x * 5; }
+inline int f7084_6(int x) { return x * 6; }
+inline int f7084_7(int x) { return x * 7; }
+inline int f7084_8(int x) { return x * 8; }
+inline int f7084_9(int x) { return x * 9; }
+inline int f7084_10(int x) { return x * 10; }
+inline int f7084_11(int x) { return x * 11; }
+inline int f7084_12(int x) { return x * 12; }
+inline int f7084_13(int x) { return x * 13; }
+inline int f7084_14(int x) { return x * 14; }
+inline int f7084_15(int x) { return x * 15; }
+inline int f7084_16(int x) { return x * 16; }
+inline int f7084_17(int x) { return x * 17; }
+inline int f7084_18(int x) { return x * 18; }
+inline int f7084_19(int x) { return x * 19; }
+inline int f7084_20(int x) { return x * 20; }
+inline int f7084_21(int x) { return x * 21; }
+inline int f7084_22(int x) { return x * 22; }
+inline int f7084_23(int x) { return x * 23; }
+inline int f7084_24(int x) { return x * 24; }
+inline int f7084_25(int x) { return x * 25; }
+inline int f7084_26(int x) { return x * 26; }
+inline int f7084_27(int x) { return x * 27; }
+inline int f7084_28(int x) { return x * 28; }
+inline int f7084_29(int x) { return x * 29; }
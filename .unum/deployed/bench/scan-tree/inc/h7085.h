@@ -0,0 +1,42 @@
+#pragma once
+/* header 7085 */
+#include <vector>
+#include "h3358.h"
+#include "h8400.h"
+#include "h5770.h"
+#include "h5976.h"
+#include "h5269.h"
+#ifdef X
+#include "h9670.h"
+#endif
+struct S7085 { int a; const char *s = "x//y"; };
+inline int f7085_0(int x) { return x * 0; }
+inline int f7085_1(int x) { return x * 1; }
+inline int f7085_2(int x) { return x * 2; }
+inline int f7085_3(int x) { return x * 3; }
+inline int f7085_4(int x) { return x * 4; }
+inline int f7085_5(int x) { return x * 5; }
+inline int f7085_6(int x) { return x * 6; }
+inline int f7085_7(int x) { return x * 7; }
+inline int f7085_8(int x) { return x * 8; }
+inline int f7085_9(int x) { return x * 9; }
+inline int f7085_10(int x) { return x * 10; }
+inline int f7085_11(int x) { return x * 11; }
+inline int f7085_12(int x) { return x * 12; }
+inline int f7085_13(int x) { return x * 13; }
+inline int f7085_14(int x) { return x * 14; }
+inline int f7085_15(int x) { return x * 15; }
+inline int f7085_16(int x) { return x * 16; }
+inline int f7085_17(int x) { return x * 17; }
+inline int f7085_18(int x) { return x * 18; }
+inline int f7085_19(int x) { return x * 19; }
+inline int f7085_20(int x) { return x * 20; }
+inline int f7085_21(int x) { return x * 21; }
+inline int f7085_22(int x) { return x * 22; }
+inline int f7085_23(int x) { return x * 23; }
+inline int f7085_24(int x) { return x * 24; }
+inline int f7085_25(int x) { return x * 25; }
+inline int f7085_26(int x) { return x * 26; }
+inline int f7085_27(int x) { return x * 27; }
+inline int f7085_28(int x) { return x * 28; }
+inline int f7085_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7087 */
+#include <vector>
+#include "h4531.h"
+#include "h812.h"
+#include "h1033.h"
+#include "h3986.h"
+#include "h351.h"
+#ifdef X
+#include "h2074.h"
+#endif
+struct S7087 { int a; const char *s = "x//y"; };
+inline int f7087_0(int x) { return x * 0; }
+inline int f7087_1(int x) { return x * 1; }
+inline int f7087_2(int x) { return x * 2; }
+inline int f7087_3(int x) { return x * 3; }
+inline int f7087_4(int x) { return x * 4; }
+inline int f7087_5(int x) { return x * 5; }
+inline int f7087_6(int x) { return x * 6; }
+inline int f7087_7(int x) { return x * 7; }
+inline int f7087_8(int x) { return x * 8; }
+inline int f7087_9(int x) { return x * 9; }
+inline int f7087_10(int x) { return x * 10; }
+inline int f7087_11(int x) { return x * 11; }
+inline int f7087_12(int x) { return x * 12; }
+inline int f7087_13(int x) { return x * 13; }
+inline int f7087_14(int x) { return x * 14; }
+inline int f7087_15(int x) { return x * 15; }
+inline int f7087_16(int x) { return x * 16; }
+inline int f7087_17(int x) { return x * 17; }
+inline int f7087_18(int x) { return x * 18; }
+inline int f7087_19(int x) { return x * 19; }
+inline int f7087_20(int x) { return x * 20; }
+inline int f7087_21(int x) { return x * 21; }
+inline int f7087_22(int x) { return x * 22; }
+inline int f7087_23(int x) { return x * 23; }
+inline int f7087_24(int x) { return x * 24; }
+inline int f7087_25(int x) { return x * 25; }
+inline int f7087_26(int x) { return x * 26; }
+inline int f7087_27(int x) { return x * 27; }
+inline int f7087_28(int x) { return x * 28; }
+inline int f7087_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7091 */
+#include <vector>
+#include "h2202.h"
+#include "h6176.h"
+#include "h4692.h"
+#include "h1348.h"
+#include "h8626.h"
+#ifdef X
+#include "h4376.h"
+#endif
+struct S7091 { int a; const char *s = "x//y"; };
+inline int f7091_0(int x) { return x * 0; }
+inline int f7091_1(int x) { return x * 1; }
+inline int f7091_2(int x) { return x * 2; }
+inline int f7091_3(int x) { return x * 3; }
+inline int f7091_4(int x) { return x * 4; }
+inline int f7091_5(int x) { return x * 5; }
+inline int f7091_6(int x) { return x * 6; }
+inline int f7091_7(int x) { return x * 7; }
+inline int f7091_8(int x) { return x * 8; }
+inline int f7091_9(int x) { return x * 9; }
+inline int f7091_10(int x) { return x * 10; }
+inline int f7091_11(int x) { return x * 11; }
+inline int f7091_12(int x) { return x * 12; }
+inline int f7091_13(int x) { return x * 13; }
+inline int f7091_14(int x) { return x * 14; }
+inline int f7091_15(int x) { return x * 15; }
+inline int f7091_16(int x) { return x * 16; }
+inline int f7091_17(int x) { return x * 17; }
+inline int f7091_18(int x) { return x * 18; }
+inline int f7091_19(int x) { return x * 19; }
+inline int f7091_20(int x) { return x * 20; }
+inline int f7091_21(int x) { return x * 21; }
+inline int f7091_22(int x) { return x * 22; }
+inline int f7091_23(int x) { return x * 23; }
+inline int f7091_24(int x) { return x * 24; }
+inline int f7091_25(int x) { return x * 25; }
+inline int f7091_26(int x) { return x * 26; }
+inline int f7091_27(int x) { return x * 27; }
+inline int f7091_28(int x) { return x * 28; }
+inline int f7091_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7093 */
+#include <vector>
+#include "h407.h"
+#include "h1377.h"
+#include "h8293.h"
+#include "h9394.h"
+#include "h4687.h"
+#ifdef X
+#include "h3305.h"
+#endif
+struct S7093 { int a; const char *s = "x//y"; };
+inline int f7093_0(int x) { return x * 0; }
+inline int f7093_1(int x) { return x * 1; }
+inline int f7093_2(int x) { return x * 2; }
+inline int f7093_3(int x) { return x * 3; }
+inline int f7093_4(int x) { return x * 4; }
+inline int f7093_5(int x) { return x * 5; }
+inline int f7093_6(int x) { return x * 6; }
+inline int f7093_7(int x) { return x * 7; }
+inline int f7093_8(int x) { return x * 8; }
+inline int f7093_9(int x) { return x * 9; }
+inline int f7093_10(int x) { return x * 10; }
+inline int f7093_11(int x) { return x * 11; }
+inline int f7093_12(int x) { return x * 12; }
+inline int f7093_13(int x) { return x * 13; }
+inline int f7093_14(int x) { return x * 14; }
+inline int f7093_15(int x) { return x * 15; }
+inline int f7093_16(int x) { return x * 16; }
+inline int f7093_17(int x) { return x * 17; }
+inline int f7093_18(int x) { return x * 18; }
+inline int f7093_19(int x) { return x * 19; }
+inline int f7093_20(int x) { return x * 20; }
+inline int f7093_21(int x) { return x * 21; }
+inline int f7093_22(int x) { return x * 22; }
+inline int f7093_23(int x) { return x * 23; }
+inline int f7093_24(int x) { return x * 24; }
+inline int f7093_25(int x) { return x * 25; }
+inline int f7093_26(int x) { return x * 26; }
+inline int f7093_27(int x) { return x * 27; }
+inline int f7093_28(int x) { return x * 28; }
+inline int f7093_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7095 */
+#include <vector>
+#include "h1226.h"
+#include "h5884.h"
+#include "h4319.h"
+#include "h317.h"
+#include "h2153.h"
+#ifdef X
+#include "h1166.h"
+#endif
+struct S7095 { int a; const char *s = "x//y"; };
+inline int f7095_0(int x) { return x * 0; }
+inline int f7095_1(int x) { return x * 1; }
+inline int f7095_2(int x) { return x * 2; }
+inline int f7095_3(int x) { return x * 3; }
+inline int f7095_4(int x) { return x * 4; }
+inline int f7095_5(int x) { return x * 5; }
+inline int f7095_6(int x) { return x * 6; }
+inline int f7095_7(int x) { return x * 7; }
+inline int f7095_8(int x) { return x * 8; }
+inline int f7095_9(int x) { return x * 9; }
+inline int f7095_10(int x) { return x * 10; }
+inline int f7095_11(int x) { return x * 11; }
+inline int f7095_12(int x) { return x * 12; }
+inline int f7095_13(int x) { return x * 13; }
+inline int f7095_14(int x) { return x * 14; }
+inline int f7095_15(int x) { return x * 15; }
+inline int f7095_16(int x) { return x * 16; }
+inline int f7095_17(int x) { return x * 17; }
+inline int f7095_18(int x) { return x * 18; }
+inline int f7095_19(int x) { return x * 19; }
+inline int f7095_20(int x) { return x * 20; }
+inline int f7095_21(int x) { return x * 21; }
+inline int f7095_22(int x) { return x * 22; }
+inline int f7095_23(int x) { return x * 23; }
+inline int f7095_24(int x) { return x * 24; }
+inline int f7095_25(int x) { return x * 25; }
+inline int f7095_26(int x) { return x * 26; }
+inline int f7095_27(int x) { return x * 27; }
+inline int f7095_28(int x) { return x * 28; }
+inline int f7095_29(int x) { return x * 29; }
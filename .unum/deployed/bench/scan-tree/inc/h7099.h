@@ -0,0 +1,42 @@
+#pragma once
+/* header 7099 */
+#include <vector>
+#include "h7526.h"
+#include "h6713.h"
+#include "h6445.h"
+#include "h4379.h"
+#include "h8245.h"
+#ifdef X
+#include "h7587.h"
+#endif
+struct S7099 { int a; const char *s = "x//y"; };
+inline int f7099_0(int x) { return x * 0; }
+inline int f7099_1(int x) { return x * 1; }
+inline int f7099_2(int x) { return x * 2; }
+inline int f7099_3(int x) { return x * 3; }
+inline int f7099_4(int x) { return x * 4; }
+inline int f7099_5(int x) { return x * 5; }
+inline int f7099_6(int x) { return x * 6; }
+inline int f7099_7(int x) { return x * 7; }
+inline int f7099_8(int x) { return x * 8; }
+inline int f7099_9(int x) { return x * 9; }
+inline int f7099_10(int x) { return x * 10; }
+inline int f7099_11(int x) { return x * 11; }
+inline int f7099_12(int x) { return x * 12; }
+inline int f7099_13(int x) { return x * 13; }
+inline int f7099_14(int x) { return x * 14; }
+inline int f7099_15(int x) { return x * 15; }
+inline int f7099_16(int x) { return x * 16; }
+inline int f7099_17(int x) { return x * 17; }
+inline int f7099_18(int x) { return x * 18; }
+inline int f7099_19(int x) { return x * 19; }
+inline int f7099_20(int x) { return x * 20; }
+inline int f7099_21(int x) { return x * 21; }
+inline int f7099_22(int x) { return x * 22; }
+inline int f7099_23(int x) { return x * 23; }
+inline int f7099_24(int x) { return x * 24; }
+inline int f7099_25(int x) { return x * 25; }
+inline int f7099_26(int x) { return x * 26; }
+inline int f7099_27(int x) { return x * 27; }
+inline int f7099_28(int x) { return x * 28; }
+inline int f7099_29(int x) { return x * 29; }
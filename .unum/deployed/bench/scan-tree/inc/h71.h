@@ -0,0 +1,42 @@
+#pragma once
+/* header 71 */
+#include <vector>
+#include "h4472.h"
+#include "h7460.h"
+#include "h3381.h"
+#include "h9053.h"
+#include "h5522.h"
+#ifdef X
+#include "h6980.h"
+#endif
+struct S71 { int a; const char *s = "x//y"; };
+inline int f71_0(int x) { return x * 0; }
+inline int f71_1(int x) { return x * 1; }
+inline int f71_2(int x) { return x * 2; }
+inline int f71_3(int x) { return x * 3; }
+inline int f71_4(int x) { return x * 4; }
+inline int f71_5(int x) { return x * 5; }
+inline int f71_6(int x) { return x * 6; }
+inline int f71_7(int x) { return x * 7; }
+inline int f71_8(int x) { return x * 8; }
+inline int f71_9(int x) { return x * 9; }
+inline int f71_10(int x) { return x * 10; }
+inline int f71_11(int x) { return x * 11; }
+inline int f71_12(int x) { return x * 12; }
+inline int f71_13(int x) { return x * 13; }
+inline int f71_14(int x) { return x * 14; }
+inline int f71_15(int x) { return x * 15; }
+inline int f71_16(int x) { return x * 16; }
+inline int f71_17(int x) { return x * 17; }
+inline int f71_18(int x) { return x * 18; }
+inline int f71_19(int x) { return x * 19; }
+inline int f71_20(int x) { return x * 20; }
+inline int f71_21(int x) { return x * 21; }
+inline int f71_22(int x) { return x * 22; }
+inline int f71_23(int x) { return x * 23; }
+inline int f71_24(int x) { return x * 24; }
+inline int f71_25(int x) { return x * 25; }
+inline int f71_26(int x) { return x * 26; }
+inline int f71_27(int x) { return x * 27; }
+inline int f71_28(int x) { return x * 28; }
+inline int f71_29(int x) { return x * 29; }
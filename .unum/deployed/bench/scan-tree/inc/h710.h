@@ -0,0 +1,42 @@
+#pragma once
+/* header 710 */
+#include <vector>
+#include "h2206.h"
+#include "h1919.h"
+#include "h5515.h"
+#include "h5953.h"
+#include "h4303.h"
+#ifdef X
+#include "h1678.h"
+#endif
+struct S710 { int a; const char *s = "x//y"; };
+inline int f710_0(int x) { return x * 0; }
+inline int f710_1(int x) { return x * 1; }
+inline int f710_2(int x) { return x * 2; }
+inline int f710_3(int x) { return x * 3; }
+inline int f710_4(int x) { return x * 4; }
+inline int f710_5(int x) { return x * 5; }
+inline int f710_6(int x) { return x * 6; }
+inline int f710_7(int x) { return x * 7; }
+inline int f710_8(int x) { return x * 8; }
+inline int f710_9(int x) { return x * 9; }
+inline int f710_10(int x) { return x * 10; }
+inline int f710_11(int x) { return x * 11; }
+inline int f710_12(int x) { return x * 12; }
+inline int f710_13(int x) { return x * 13; }
+inline int f710_14(int x) { return x * 14; }
+inline int f710_15(int x) { return x * 15; }
+inline int f710_16(int x) { return x * 16; }
+inline int f710_17(int x) { return x * 17; }
+inline int f710_18(int x) { return x * 18; }
+inline int f710_19(int x) { return x * 19; }
+inline int f710_20(int x) { return x * 20; }
+inline int f710_21(int x) { return x * 21; }
+inline int f710_22(int x) { return x * 22; }
+inline int f710_23(int x) { return x * 23; }
+inline int f710_24(int x) { return x * 24; }
+inline int f710_25(int x) { return x * 25; }
+inline int f710_26(int x) { return x * 26; }
+inline int f710_27(int x) { return x * 27; }
+inline int f710_28(int x) { return x * 28; }
+inline int f710_29(int x) { return x * 29; }
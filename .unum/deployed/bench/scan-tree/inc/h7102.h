@@ -0,0 +1,42 @@
+#pragma once
+/* header 7102 */
+#include <vector>
+#include "h568.h"
+#include "h5053.h"
+#include "h7102.h"
+#include "h6522.h"
+#include "h6808.h"
+#ifdef X
+#include "h3366.h"
+#endif
+struct S7102 { int a; const char *s = "x//y"; };
+inline int f7102_0(int x) { return x * 0; }
+inline int f7102_1(int x) { return x * 1; }
+inline int f7102_2(int x) { return x * 2; }
+inline int f7102_3(int x) { return x * 3; }
+inline int f7102_4(int x) { return x * 4; }
+inline int f7102_5(int x) { return x * 5; }
+inline int f7102_6(int x) { return x * 6; }
+inline int f7102_7(int x) { return x * 7; }
+inline int f7102_8(int x) { return x * 8; }
+inline int f7102_9(int x) { return x * 9; }
+inline int f7102_10(int x) { return x * 10; }
+inline int f7102_11(int x) { return x * 11; }
+inline int f7102_12(int x) { return x * 12; }
+inline int f7102_13(int x) { return x * 13; }
+inline int f7102_14(int x) { return x * 14; }
+inline int f7102_15(int x) { return x * 15; }
+inline int f7102_16(int x) { return x * 16; }
+inline int f7102_17(int x) { return x * 17; }
+inline int f7102_18(int x) { return x * 18; }
+inline int f7102_19(int x) { return x * 19; }
+inline int f7102_20(int x) { return x * 20; }
+inline int f7102_21(int x) { return x * 21; }
+inline int f7102_22(int x) { return x * 22; }
+inline int f7102_23(int x) { return x * 23; }
+inline int f7102_24(int x) { return x * 24; }
+inline int f7102_25(int x) { return x * 25; }
+inline int f7102_26(int x) { return x * 26; }
+inline int f7102_27(int x) { return x * 27; }
+inline int f7102_28(int x) { return x * 28; }
+inline int f7102_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7105 */
+#include <vector>
+#include "h4526.h"
+#include "h905.h"
+#include "h8044.h"
+#include "h1738.h"
+#include "h9828.h"
+#ifdef X
+#include "h1741.h"
+#endif
+struct S7105 { int a; const char *s = "x//y"; };
+inline int f7105_0(int x) { return x * 0; }
+inline int f7105_1(int x) { return x * 1; }
+inline int f7105_2(int x) { return x * 2; }
+inline int f7105_3(int x) { return x * 3; }
+inline int f7105_4(int x) { return x * 4; }
+inline int f7105_5(int x) { return x * 5; }
+inline int f7105_6(int x) { return x * 6; }
+inline int f7105_7(int x) { return x * 7; }
+inline int f7105_8(int x) { return x * 8; }
+inline int f7105_9(int x) { return x * 9; }
+inline int f7105_10(int x) { return x * 10; }
+inline int f7105_11(int x) { return x * 11; }
+inline int f7105_12(int x) { return x * 12; }
+inline int f7105_13(int x) { return x * 13; }
+inline int f7105_14(int x) { return x * 14; }
+inline int f7105_15(int x) { return x * 15; }
+inline int f7105_16(int x) { return x * 16; }
+inline int f7105_17(int x) { return x * 17; }
+inline int f7105_18(int x) { return x * 18; }
+inline int f7105_19(int x) { return x * 19; }
+inline int f7105_20(int x) { return x * 20; }
+inline int f7105_21(int x) { return x * 21; }
+inline int f7105_22(int x) { return x * 22; }
+inline int f7105_23(int x) { return x * 23; }
+inline int f7105_24(int x) { return x * 24; }
+inline int f7105_25(int x) { return x * 25; }
+inline int f7105_26(int x) { return x * 26; }
+inline int f7105_27(int x) { return x * 27; }
+inline int f7105_28(int x) { return x * 28; }
+inline int f7105_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7106 */
+#include <vector>
+#include "h241.h"
+#include "h8765.h"
+#include "h5102.h"
+#include "h4778.h"
+#include "h210.h"
+#ifdef X
+#include "h7070.h"
+#endif
+struct S7106 { int a; const char *s = "x//y"; };
+inline int f7106_0(int x) { return x * 0; }
+inline int f7106_1(int x) { return x * 1; }
+inline int f7106_2(int x) { return x * 2; }
+inline int f7106_3(int x) { return x * 3; }
+inline int f7106_4(int x) { return x * 4; }
+inline int f7106_5(int x) { return x * 5; }
+inline int f7106_6(int x) { return x * 6; }
+inline int f7106_7(int x) { return x * 7; }
+inline int f7106_8(int x) { return x * 8; }
+inline int f7106_9(int x) { return x * 9; }
+inline int f7106_10(int x) { return x * 10; }
+inline int f7106_11(int x) { return x * 11; }
+inline int f7106_12(int x) { return x * 12; }
+inline int f7106_13(int x) { return x * 13; }
+inline int f7106_14(int x) { return x * 14; }
+inline int f7106_15(int x) { return x * 15; }
+inline int f7106_16(int x) { return x * 16; }
+inline int f7106_17(int x) { return x * 17; }
+inline int f7106_18(int x) { return x * 18; }
+inline int f7106_19(int x) { return x * 19; }
+inline int f7106_20(int x) { return x * 20; }
+inline int f7106_21(int x) { return x * 21; }
+inline int f7106_22(int x) { return x * 22; }
+inline int f7106_23(int x) { return x * 23; }
+inline int f7106_24(int x) { return x * 24; }
+inline int f7106_25(int x) { return x * 25; }
+inline int f7106_26(int x) { return x * 26; }
+inline int f7106_27(int x) { return x * 27; }
+inline int f7106_28(int x) { return x * 28; }
+inline int f7106_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7107 */
+#include <vector>
+#include "h3745.h"
+#include "h8253.h"
+#include "h314.h"
+#include "h699.h"
+#include "h2426.h"
+#ifdef X
+#include "h4058.h"
+#endif
+struct S7107 { int a; const char *s = "x//y"; };
+inline int f7107_0(int x) { return x * 0; }
+inline int f7107_1(int x) { return x * 1; }
+inline int f7107_2(int x) { return x * 2; }
+inline int f7107_3(int x) { return x * 3; }
+inline int f7107_4(int x) { return x * 4; }
+inline int f7107_5(int x) { return x * 5; }
+inline int f7107_6(int x) { return x * 6; }
+inline int f7107_7(int x) { return x * 7; }
+inline int f7107_8(int x) { return x * 8; }
+inline int f7107_9(int x) { return x * 9; }
+inline int f7107_10(int x) { return x * 10; }
+inline int f7107_11(int x) { return x * 11; }
+inline int f7107_12(int x) { return x * 12; }
+inline int f7107_13(int x) { return x * 13; }
+inline int f7107_14(int x) { return x * 14; }
+inline int f7107_15(int x) { return x * 15; }
+inline int f7107_16(int x) { return x * 16; }
+inline int f7107_17(int x) { return x * 17; }
+inline int f7107_18(int x) { return x * 18; }
+inline int f7107_19(int x) { return x * 19; }
+inline int f7107_20(int x) { return x * 20; }
+inline int f7107_21(int x) { return x * 21; }
+inline int f7107_22(int x) { return x * 22; }
+inline int f7107_23(int x) { return x * 23; }
+inline int f7107_24(int x) { return x * 24; }
+inline int f7107_25(int x) { return x * 25; }
+inline int f7107_26(int x) { return x * 26; }
+inline int f7107_27(int x) { return x * 27; }
+inline int f7107_28(int x) { return x * 28; }
+inline int f7107_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7108 */
+#include <vector>
+#include "h1289.h"
+#include "h885.h"
+#include "h1536.h"
+#include "h8564.h"
+#include "h9780.h"
+#ifdef X
+#include "h6788.h"
+#endif
+struct S7108 { int a; const char *s = "x//y"; };
+inline int f7108_0(int x) { return x * 0; }
+inline int f7108_1(int x) { return x * 1; }
+inline int f7108_2(int x) { return x * 2; }
+inline int f7108_3(int x) { return x * 3; }
+inline int f7108_4(int x) { return x * 4; }
+inline int f7108_5(int x) { return x * 5; }
+inline int f7108_6(int x) { return x * 6; }
+inline int f7108_7(int x) { return x * 7; }
+inline int f7108_8(int x) { return x * 8; }
+inline int f7108_9(int x) { return x * 9; }
+inline int f7108_10(int x) { return x * 10; }
+inline int f7108_11(int x) { return x * 11; }
+inline int f7108_12(int x) { return x * 12; }
+inline int f7108_13(int x) { return x * 13; }
+inline int f7108_14(int x) { return x * 14; }
+inline int f7108_15(int x) { return x * 15; }
+inline int f7108_16(int x) { return x * 16; }
+inline int f7108_17(int x) { return x * 17; }
+inline int f7108_18(int x) { return x * 18; }
+inline int f7108_19(int x) { return x * 19; }
+inline int f7108_20(int x) { return x * 20; }
+inline int f7108_21(int x) { return x * 21; }
+inline int f7108_22(int x) { return x * 22; }
+inline int f7108_23(int x) { return x * 23; }
+inline int f7108_24(int x) { return x * 24; }
+inline int f7108_25(int x) { return x * 25; }
+inline int f7108_26(int x) { return x * 26; }
+inline int f7108_27(int x) { return x * 27; }
+inline int f7108_28(int x) { return x * 28; }
+inline int f7108_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 711 */
+#include <vector>
+#include "h3846.h"
+#include "h1483.h"
+#include "h3212.h"
+#include "h8011.h"
+#include "h6433.h"
+#ifdef X
+#include "h2106.h"
+#endif
+struct S711 { int a; const char *s = "x//y"; };
+inline int f711_0(int x) { return x * 0; }
+inline int f711_1(int x) { return x * 1; }
+inline int f711_2(int x) { return x * 2; }
+inline int f711_3(int x) { return x * 3; }
+inline int f711_4(int x) { return x * 4; }
+inline int f711_5(int x) { return x * 5; }
+inline int f711_6(int x) { return x * 6; }
+inline int f711_7(int x) { return x * 7; }
+inline int f711_8(int x) { return x * 8; }
+inline int f711_9(int x) { return x * 9; }
+inline int f711_10(int x) { return x * 10; }
+inline int f711_11(int x) { return x * 11; }
+inline int f711_12(int x) { return x * 12; }
+inline int f711_13(int x) { return x * 13; }
+inline int f711_14(int x) { return x * 14; }
+inline int f711_15(int x) { return x * 15; }
+inline int f711_16(int x) { return x * 16; }
+inline int f711_17(int x) { return x * 17; }
+inline int f711_18(int x) { return x * 18; }
+inline int f711_19(int x) { return x * 19; }
+inline int f711_20(int x) { return x * 20; }
+inline int f711_21(int x) { return x * 21; }
+inline int f711_22(int x) { return x * 22; }
+inline int f711_23(int x) { return x * 23; }
+inline int f711_24(int x) { return x * 24; }
+inline int f711_25(int x) { return x * 25; }
+inline int f711_26(int x) { return x * 26; }
+inline int f711_27(int x) { return x * 27; }
+inline int f711_28(int x) { return x * 28; }
+inline int f711_29(int x) { return x * 29; }
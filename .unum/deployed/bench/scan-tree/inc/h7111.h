@@ -0,0 +1,42 @@
+#pragma once
+/* header 7111 */
+#include <vector>
+#include "h3856.h"
+#include "h3477.h"
+#include "h9773.h"
+#include "h3477.h"
+#include "h5127.h"
+#ifdef X
+#include "h7396.h"
+#endif
+struct S7111 { int a; const char *s = "x//y"; };
+inline int f7111_0(int x) { return x * 0; }
+inline int f7111_1(int x) { return x * 1; }
+inline int f7111_2(int x) { return x * 2; }
+inline int f7111_3(int x) { return x * 3; }
+inline int f7111_4(int x) { return x * 4; }
+inline int f7111_5(int x) { return x * 5; }
+inline int f7111_6(int x) { return x * 6; }
+inline int f7111_7(int x) { return x * 7; }
+inline int f7111_8(int x) { return x * 8; }
+inline int f7111_9(int x) { return x * 9; }
+inline int f7111_10(int x) { return x * 10; }
+inline int f7111_11(int x) { return x * 11; }
+inline int f7111_12(int x) { return x * 12; }
+inline int f7111_13(int x) { return x * 13; }
+inline int f7111_14(int x) { return x * 14; }
+inline int f7111_15(int x) { return x * 15; }
+inline int f7111_16(int x) { return x * 16; }
+inline int f7111_17(int x) { return x * 17; }
+inline int f7111_18(int x) { return x * 18; }
+inline int f7111_19(int x) { return x * 19; }
+inline int f7111_20(int x) { return x * 20; }
+inline int f7111_21(int x) { return x * 21; }
+inline int f7111_22(int x) { return x * 22; }
+inline int f7111_23(int x) { return x * 23; }
+inline int f7111_24(int x) { return x * 24; }
+inline int f7111_25(int x) { return x * 25; }
+inline int f7111_26(int x) { return x * 26; }
+inline int f7111_27(int x) { return x * 27; }
+inline int f7111_28(int x) { return x * 28; }
+inline int f7111_29(int x) { return x * 29; }
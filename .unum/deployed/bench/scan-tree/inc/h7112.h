@@ -0,0 +1,42 @@
+#pragma once
+/* header 7112 */
+#include <vector>
+#include "h2679.h"
+#include "h4157.h"
+#include "h7866.h"
+#include "h9986.h"
+#include "h1252.h"
+#ifdef X
+#include "h634.h"
+#endif
+struct S7112 { int a; const char *s = "x//y"; };
+inline int f7112_0(int x) { return x * 0; }
+inline int f7112_1(int x) { return x * 1; }
+inline int f7112_2(int x) { return x * 2; }
+inline int f7112_3(int x) { return x * 3; }
+inline int f7112_4(int x) { return x * 4; }
+inline int f7112_5(int x) { return x * 5; }
+inline int f7112_6(int x) { return x * 6; }
+inline int f7112_7(int x) { return x * 7; }
+inline int f7112_8(int x) { return x * 8; }
+inline int f7112_9(int x) { return x * 9; }
+inline int f7112_10(int x) { return x * 10; }
+inline int f7112_11(int x) { return x * 11; }
+inline int f7112_12(int x) { return x * 12; }
+inline int f7112_13(int x) { return x * 13; }
+inline int f7112_14(int x) { return x * 14; }
+inline int f7112_15(int x) { return x * 15; }
+inline int f7112_16(int x) { return x * 16; }
+inline int f7112_17(int x) { return x * 17; }
+inline int f7112_18(int x) { return x * 18; }
+inline int f7112_19(int x) { return x * 19; }
+inline int f7112_20(int x) { return x * 20; }
+inline int f7112_21(int x) { return x * 21; }
+inline int f7112_22(int x) { return x * 22; }
+inline int f7112_23(int x) { return x * 23; }
+inline int f7112_24(int x) { return x * 24; }
+inline int f7112_25(int x) { return x * 25; }
+inline int f7112_26(int x) { return x * 26; }
+inline int f7112_27(int x) { return x * 27; }
+inline int f7112_28(int x) { return x * 28; }
+inline int f7112_29(int x) { return x * 29; }
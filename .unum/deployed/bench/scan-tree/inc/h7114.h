@@ -0,0 +1,42 @@
+#pragma once
+/* header 7114 */
+#include <vector>
+#include "h8478.h"
+#include "h4752.h"
+#include "h9675.h"
+#include "h1163.h"
+#include "h8784.h"
+#ifdef X
+#include "h9336.h"
+#endif
+struct S7114 { int a; const char *s = "x//y"; };
+inline int f7114_0(int x) { return x * 0; }
+inline int f7114_1(int x) { return x * 1; }
+inline int f7114_2(int x) { return x * 2; }
+inline int f7114_3(int x) { return x * 3; }
+inline int f7114_4(int x) { return x * 4; }
+inline int f7114_5(int x) { return x * 5; }
+inline int f7114_6(int x) { return x * 6; }
+inline int f7114_7(int x) { return x * 7; }
+inline int f7114_8(int x) { return x * 8; }
+inline int f7114_9(int x) { return x * 9; }
+inline int f7114_10(int x) { return x * 10; }
+inline int f7114_11(int x) { return x * 11; }
+inline int f7114_12(int x) { return x * 12; }
+inline int f7114_13(int x) { return x * 13; }
+inline int f7114_14(int x) { return x * 14; }
+inline int f7114_15(int x) { return x * 15; }
+inline int f7114_16(int x) { return x * 16; }
+inline int f7114_17(int x) { return x * 17; }
+inline int f7114_18(int x) { return x * 18; }
+inline int f7114_19(int x) { return x * 19; }
+inline int f7114_20(int x) { return x * 20; }
+inline int f7114_21(int x) { return x * 21; }
+inline int f7114_22(int x) { return x * 22; }
+inline int f7114_23(int x) { return x * 23; }
+inline int f7114_24(int x) { return x * 24; }
+inline int f7114_25(int x) { return x * 25; }
+inline int f7114_26(int x) { return x * 26; }
+inline int f7114_27(int x) { return x * 27; }
+inline int f7114_28(int x) { return x * 28; }
+inline int f7114_29(int x) { return x * 29; }
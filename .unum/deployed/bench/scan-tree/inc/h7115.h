@@ -0,0 +1,42 @@
+#pragma once
+/* header 7115 */
+#include <vector>
+#include "h1531.h"
+#include "h4744.h"
+#include "h8048.h"
+#include "h6759.h"
+#include "h6387.h"
+#ifdef X
+#include "h3024.h"
+#endif
+struct S7115 { int a; const char *s = "x//y"; };
+inline int f7115_0(int x) { return x * 0; }
+inline int f7115_1(int x) { return x * 1; }
+inline int f7115_2(int x) { return x * 2; }
+inline int f7115_3(int x) { return x * 3; }
+inline int f7115_4(int x) { return x * 4; }
+inline int f7115_5(int x) { return x * 5; }
+inline int f7115_6(int x) { return x * 6; }
+inline int f7115_7(int x) { return x * 7; }
+inline int f7115_8(int x) { return x * 8; }
+inline int f7115_9(int x) { return x * 9; }
+inline int f7115_10(int x) { return x * 10; }
+inline int f7115_11(int x) { return x * 11; }
+inline int f7115_12(int x) { return x * 12; }
+inline int f7115_13(int x) { return x * 13; }
+inline int f7115_14(int x) { return x * 14; }
+inline int f7115_15(int x) { return x * 15; }
+inline int f7115_16(int x) { return x * 16; }
+inline int f7115_17(int x) { return x * 17; }
+inline int f7115_18(int x) { return x * 18; }
+inline int f7115_19(int x) { return x * 19; }
+inline int f7115_20(int x) { return x * 20; }
+inline int f7115_21(int x) { return x * 21; }
+inline int f7115_22(int x) { return x * 22; }
+inline int f7115_23(int x) { return x * 23; }
+inline int f7115_24(int x) { return x * 24; }
+inline int f7115_25(int x) { return x * 25; }
+inline int f7115_26(int x) { return x * 26; }
+inline int f7115_27(int x) { return x * 27; }
+inline int f7115_28(int x) { return x * 28; }
+inline int f7115_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7116 */
+#include <vector>
+#include "h5384.h"
+#include "h5738.h"
+#include "h7720.h"
+#include "h2461.h"
+#include "h68.h"
+#ifdef X
+#include "h8943.h"
+#endif
+struct S7116 { int a; const char *s = "x//y"; };
+inline int f7116_0(int x) { return x * 0; }
+inline int f7116_1(int x) { return x * 1; }
+inline int f7116_2(int x) { return x * 2; }
+inline int f7116_3(int x) { return x * 3; }
+inline int f7116_4(int x) { return x * 4; }
+inline int f7116_5(int x) { return x * 5; }
+inline int f7116_6(int x) { return x * 6; }
+inline int f7116_7(int x) { return x * 7; }
+inline int f7116_8(int x) { return x * 8; }
+inline int f7116_9(int x) { return x * 9; }
+inline int f7116_10(int x) { return x * 10; }
+inline int f7116_11(int x) { return x * 11; }
+inline int f7116_12(int x) { return x * 12; }
+inline int f7116_13(int x) { return x * 13; }
+inline int f7116_14(int x) { return x * 14; }
+inline int f7116_15(int x) { return x * 15; }
+inline int f7116_16(int x) { return x * 16; }
+inline int f7116_17(int x) { return x * 17; }
+inline int f7116_18(int x) { return x * 18; }
+inline int f7116_19(int x) { return x * 19; }
+inline int f7116_20(int x) { return x * 20; }
+inline int f7116_21(int x) { return x * 21; }
+inline int f7116_22(int x) { return x * 22; }
+inline int f7116_23(int x) { return x * 23; }
+inline int f7116_24(int x) { return x * 24; }
+inline int f7116_25(int x) { return x * 25; }
+inline int f7116_26(int x) { return x * 26; }
+inline int f7116_27(int x) { return x * 27; }
+inline int f7116_28(int x) { return x * 28; }
+inline int f7116_29(int x) { return x * 29; }
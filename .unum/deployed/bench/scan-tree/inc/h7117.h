@@ -0,0 +1,42 @@
+#pragma once
+/* header 7117 */
+#include <vector>
+#include "h4103.h"
+#include "h5529.h"
+#include "h9222.h"
+#include "h3835.h"
+#include "h6502.h"
+#ifdef X
+#include "h6392.h"
+#endif
+struct S7117 { int a; const char *s = "x//y"; };
+inline int f7117_0(int x) { return x * 0; }
+inline int f7117_1(int x) { return x * 1; }
+inline int f7117_2(int x) { return x * 2; }
+inline int f7117_3(int x) { return x * 3; }
+inline int f7117_4(int x) { return x * 4; }
+inline int f7117_5(int x) { return x * 5; }
+inline int f7117_6(int x) { return x * 6; }
+inline int f7117_7(int x) { return x * 7; }
+inline int f7117_8(int x) { return x * 8; }
+inline int f7117_9(int x) { return x * 9; }
+inline int f7117_10(int x) { return x * 10; }
+inline int f7117_11(int x) { return x * 11; }
+inline int f7117_12(int x) { return x * 12; }
+inline int f7117_13(int x) { return x * 13; }
+inline int f7117_14(int x) { return x * 14; }
+inline int f7117_15(int x) { return x * 15; }
+inline int f7117_16(int x) { return x * 16; }
+inline int f7117_17(int x) { return x * 17; }
+inline int f7117_18(int x) { return x * 18; }
+inline int f7117_19(int x) { return x * 19; }
+inline int f7117_20(int x) { return x * 20; }
+inline int f7117_21(int x) { return x * 21; }
+inline int f7117_22(int x) { return x * 22; }
+inline int f7117_23(int x) { return x * 23; }
+inline int f7117_24(int x) { return x * 24; }
+inline int f7117_25(int x) { return x * 25; }
+inline int f7117_26(int x) { return x * 26; }
+inline int f7117_27(int x) { return x * 27; }
+inline int f7117_28(int x) { return x * 28; }
+inline int f7117_29(int x) { return x * 29; }
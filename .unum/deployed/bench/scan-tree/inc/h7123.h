@@ -0,0 +1,42 @@
+#pragma once
+/* header 7123 */
+#include <vector>
+#include "h1872.h"
+#include "h8928.h"
+#include "h2736.h"
+#include "h5833.h"
+#include "h3848.h"
+#ifdef X
+#include "h7438.h"
+#endif
+struct S7123 { int a; const char *s = "x//y"; };
+inline int f7123_0(int x) { return x * 0; }
+inline int f7123_1(int x) { return x * 1; }
+inline int f7123_2(int x) { return x * 2; }
+inline int f7123_3(int x) { return x * 3; }
+inline int f7123_4(int x) { return x * 4; }
+inline int f7123_5(int x) { return x * 5; }
+inline int f7123_6(int x) { return x * 6; }
+inline int f7123_7(int x) { return x * 7; }
+inline int f7123_8(int x) { return x * 8; }
+inline int f7123_9(int x) { return x * 9; }
+inline int f7123_10(int x) { return x * 10; }
+inline int f7123_11(int x) { return x * 11; }
+inline int f7123_12(int x) { return x * 12; }
+inline int f7123_13(int x) { return x * 13; }
+inline int f7123_14(int x) { return x * 14; }
+inline int f7123_15(int x) { return x * 15; }
+inline int f7123_16(int x) { return x * 16; }
+inline int f7123_17(int x) { return x * 17; }
+inline int f7123_18(int x) { return x * 18; }
+inline int f7123_19(int x) { return x * 19; }
+inline int f7123_20(int x) { return x * 20; }
+inline int f7123_21(int x) { return x * 21; }
+inline int f7123_22(int x) { return x * 22; }
+inline int f7123_23(int x) { return x * 23; }
+inline int f7123_24(int x) { return x * 24; }
+inline int f7123_25(int x) { return x * 25; }
+inline int f7123_26(int x) { return x * 26; }
+inline int f7123_27(int x) { return x * 27; }
+inline int f7123_28(int x) { return x * 28; }
+inline int f7123_29(int x) { return x * 29; }
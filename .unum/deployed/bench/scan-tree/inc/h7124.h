@@ -0,0 +1,42 @@
+#pragma once
+/* header 7124 */
+#include <vector>
+#include "h5320.h"
+#include "h6824.h"
+#include "h1308.h"
+#include "h6542.h"
+#include "h9700.h"
+#ifdef X
+#include "h7911.h"
+#endif
+struct S7124 { int a; const char *s = "x//y"; };
+inline int f7124_0(int x) { return x * 0; }
+inline int f7124_1(int x) { return x * 1; }
+inline int f7124_2(int x) { return x * 2; }
+inline int f7124_3(int x) { return x * 3; }
+inline int f7124_4(int x) { return x * 4; }
+inline int f7124_5(int x) { return x * 5; }
+inline int f7124_6(int x) { return x * 6; }
+inline int f7124_7(int x) { return x * 7; }
+inline int f7124_8(int x) { return x * 8; }
+inline int f7124_9(int x) { return x * 9; }
+inline int f7124_10(int x) { return x * 10; }
+inline int f7124_11(int x) { return x * 11; }
+inline int f7124_12(int x) { return x * 12; }
+inline int f7124_13(int x) { return x * 13; }
+inline int f7124_14(int x) { return x * 14; }
+inline int f7124_15(int x) { return x * 15; }
+inline int f7124_16(int x) { return x * 16; }
+inline int f7124_17(int x) { return x * 17; }
+inline int f7124_18(int x) { return x * 18; }
+inline int f7124_19(int x) { return x * 19; }
+inline int f7124_20(int x) { return x * 20; }
+inline int f7124_21(int x) { return x * 21; }
+inline int f7124_22(int x) { return x * 22; }
+inline int f7124_23(int x) { return x * 23; }
+inline int f7124_24(int x) { return x * 24; }
+inline int f7124_25(int x) { return x * 25; }
+inline int f7124_26(int x) { return x * 26; }
+inline int f7124_27(int x) { return x * 27; }
+inline int f7124_28(int x) { return x * 28; }
+inline int f7124_29(int x) { return x * 29; }
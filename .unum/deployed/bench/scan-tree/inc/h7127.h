@@ -0,0 +1,42 @@
+#pragma once
+/* header 7127 */
+#include <vector>
+#include "h2557.h"
+#include "h7096.h"
+#include "h2733.h"
+#include "h6202.h"
+#include "h5940.h"
+#ifdef X
+#include "h4369.h"
+#endif
+struct S7127 { int a; const char *s = "x//y"; };
+inline int f7127_0(int x) { return x * 0; }
+inline int f7127_1(int x) { return x * 1; }
+inline int f7127_2(int x) { return x * 2; }
+inline int f7127_3(int x) { return x * 3; }
+inline int f7127_4(int x) { return x * 4; }
+inline int f7127_5(int x) { return x * 5; }
+inline int f7127_6(int x) { return x * 6; }
+inline int f7127_7(int x) { return x * 7; }
+inline int f7127_8(int x) { return x * 8; }
+inline int f7127_9(int x) { return x * 9; }
+inline int f7127_10(int x) { return x * 10; }
+inline int f7127_11(int x) { return x * 11; }
+inline int f7127_12(int x) { return x * 12; }
+inline int f7127_13(int x) { return x * 13; }
+inline int f7127_14(int x) { return x * 14; }
+inline int f7127_15(int x) { return x * 15; }
+inline int f7127_16(int x) { return x * 16; }
+inline int f7127_17(int x) { return x * 17; }
+inline int f7127_18(int x) { return x * 18; }
+inline int f7127_19(int x) { return x * 19; }
+inline int f7127_20(int x) { return x * 20; }
+inline int f7127_21(int x) { return x * 21; }
+inline int f7127_22(int x) { return x * 22; }
+inline int f7127_23(int x) { return x * 23; }
+inline int f7127_24(int x) { return x * 24; }
+inline int f7127_25(int x) { return x * 25; }
+inline int f7127_26(int x) { return x * 26; }
+inline int f7127_27(int x) { return x * 27; }
+inline int f7127_28(int x) { return x * 28; }
+inline int f7127_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7128 */
+#include <vector>
+#include "h4046.h"
+#include "h5324.h"
+#include "h9421.h"
+#include "h3186.h"
+#include "h8363.h"
+#ifdef X
+#include "h7585.h"
+#endif
+struct S7128 { int a; const char *s = "x//y"; };
+inline int f7128_0(int x) { return x * 0; }
+inline int f7128_1(int x) { return x * 1; }
+inline int f7128_2(int x) { return x * 2; }
+inline int f7128_3(int x) { return x * 3; }
+inline int f7128_4(int x) { return x * 4; }
+inline int f7128_5(int x) { return x * 5; }
+inline int f7128_6(int x) { return x * 6; }
+inline int f7128_7(int x) { return x * 7; }
+inline int f7128_8(int x) { return x * 8; }
+inline int f7128_9(int x) { return x * 9; }
+inline int f7128_10(int x) { return x * 10; }
+inline int f7128_11(int x) { return x * 11; }
+inline int f7128_12(int x) { return x * 12; }
+inline int f7128_13(int x) { return x * 13; }
+inline int f7128_14(int x) { return x * 14; }
+inline int f7128_15(int x) { return x * 15; }
+inline int f7128_16(int x) { return x * 16; }
+inline int f7128_17(int x) { return x * 17; }
+inline int f7128_18(int x) { return x * 18; }
+inline int f7128_19(int x) { return x * 19; }
+inline int f7128_20(int x) { return x * 20; }
+inline int f7128_21(int x) { return x * 21; }
+inline int f7128_22(int x) { return x * 22; }
+inline int f7128_23(int x) { return x * 23; }
+inline int f7128_24(int x) { return x * 24; }
+inline int f7128_25(int x) { return x * 25; }
+inline int f7128_26(int x) { return x * 26; }
+inline int f7128_27(int x) { return x * 27; }
+inline int f7128_28(int x) { return x * 28; }
+inline int f7128_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7138 */
+#include <vector>
+#include "h5040.h"
+#include "h71.h"
+#include "h2034.h"
+#include "h3852.h"
+#include "h9782.h"
+#ifdef X
+#include "h26.h"
+#endif
+struct S7138 { int a; const char *s = "x//y"; };
+inline int f7138_0(int x) { return x * 0; }
+inline int f7138_1(int x) { return x * 1; }
+inline int f7138_2(int x) { return x * 2; }
+inline int f7138_3(int x) { return x * 3; }
+inline int f7138_4(int x) { return x * 4; }
+inline int f7138_5(int x) { return x * 5; }
+inline int f7138_6(int x) { return x * 6; }
+inline int f7138_7(int x) { return x * 7; }
+inline int f7138_8(int x) { return x * 8; }
+inline int f7138_9(int x) { return x * 9; }
+inline int f7138_10(int x) { return x * 10; }
+inline int f7138_11(int x) { return x * 11; }
+inline int f7138_12(int x) { return x * 12; }
+inline int f7138_13(int x) { return x * 13; }
+inline int f7138_14(int x) { return x * 14; }
+inline int f7138_15(int x) { return x * 15; }
+inline int f7138_16(int x) { return x * 16; }
+inline int f7138_17(int x) { return x * 17; }
+inline int f7138_18(int x) { return x * 18; }
+inline int f7138_19(int x) { return x * 19; }
+inline int f7138_20(int x) { return x * 20; }
+inline int f7138_21(int x) { return x * 21; }
+inline int f7138_22(int x) { return x * 22; }
+inline int f7138_23(int x) { return x * 23; }
+inline int f7138_24(int x) { return x * 24; }
+inline int f7138_25(int x) { return x * 25; }
+inline int f7138_26(int x) { return x * 26; }
+inline int f7138_27(int x) { return x * 27; }
+inline int f7138_28(int x) { return x * 28; }
+inline int f7138_29(int x) { return x * 29; }
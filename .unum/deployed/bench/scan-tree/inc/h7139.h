@@ -0,0 +1,42 @@
+#pragma once
+/* header 7139 */
+#include <vector>
+#include "h1469.h"
+#include "h4219.h"
+#include "h8032.h"
+#include "h4867.h"
+#include "h8707.h"
+#ifdef X
+#include "h7956.h"
+#endif
+struct S7139 { int a; const char *s = "x//y"; };
+inline int f7139_0(int x) { return x * 0; }
+inline int f7139_1(int x) { return x * 1; }
+inline int f7139_2(int x) { return x * 2; }
+inline int f7139_3(int x) { return x * 3; }
+inline int f7139_4(int x) { return x * 4; }
+inline int f7139_5(int x) { return x * 5; }
+inline int f7139_6(int x) { return x * 6; }
+inline int f7139_7(int x) { return x * 7; }
+inline int f7139_8(int x) { return x * 8; }
+inline int f7139_9(int x) { return x * 9; }
+inline int f7139_10(int x) { return x * 10; }
+inline int f7139_11(int x) { return x * 11; }
+inline int f7139_12(int x) { return x * 12; }
+inline int f7139_13(int x) { return x * 13; }
+inline int f7139_14(int x) { return x * 14; }
+inline int f7139_15(int x) { return x * 15; }
+inline int f7139_16(int x) { return x * 16; }
+inline int f7139_17(int x) { return x * 17; }
+inline int f7139_18(int x) { return x * 18; }
+inline int f7139_19(int x) { return x * 19; }
+inline int f7139_20(int x) { return x * 20; }
+inline int f7139_21(int x) { return x * 21; }
+inline int f7139_22(int x) { return x * 22; }
+inline int f7139_23(int x) { return x * 23; }
+inline int f7139_24(int x) { return x * 24; }
+inline int f7139_25(int x) { return x * 25; }
+inline int f7139_26(int x) { return x * 26; }
+inline int f7139_27(int x) { return x * 27; }
+inline int f7139_28(int x) { return x * 28; }
+inline int f7139_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 714 */
+#include <vector>
+#include "h5.h"
+#include "h1301.h"
+#include "h6401.h"
+#include "h1822.h"
+#include "h2153.h"
+#ifdef X
+#include "h4638.h"
+#endif
+struct S714 { int a; const char *s = "x//y"; };
+inline int f714_0(int x) { return x * 0; }
+inline int f714_1(int x) { return x * 1; }
+inline int f714_2(int x) { return x * 2; }
+inline int f714_3(int x) { return x * 3; }
+inline int f714_4(int x) { return x * 4; }
+inline int f714_5(int x) { return x * 5; }
+inline int f714_6(int x) { return x * 6; }
+inline int f714_7(int x) { return x * 7; }
+inline int f714_8(int x) { return x * 8; }
+inline int f714_9(int x) { return x * 9; }
+inline int f714_10(int x) { return x * 10; }
+inline int f714_11(int x) { return x * 11; }
+inline int f714_12(int x) { return x * 12; }
+inline int f714_13(int x) { return x * 13; }
+inline int f714_14(int x) { return x * 14; }
+inline int f714_15(int x) { return x * 15; }
+inline int f714_16(int x) { return x * 16; }
+inline int f714_17(int x) { return x * 17; }
+inline int f714_18(int x) { return x * 18; }
+inline int f714_19(int x) { return x * 19; }
+inline int f714_20(int x) { return x * 20; }
+inline int f714_21(int x) { return x * 21; }
+inline int f714_22(int x) { return x * 22; }
+inline int f714_23(int x) { return x * 23; }
+inline int f714_24(int x) { return x * 24; }
+inline int f714_25(int x) { return x * 25; }
+inline int f714_26(int x) { return x * 26; }
+inline int f714_27(int x) { return x * 27; }
+inline int f714_28(int x) { return x * 28; }
+inline int f714_29(int x) { return x * 29; }
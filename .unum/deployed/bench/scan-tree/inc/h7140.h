@@ -0,0 +1,42 @@
+#pragma once
+/* header 7140 */
+#include <vector>
+#include "h3500.h"
+#include "h6508.h"
+#include "h1668.h"
+#include "h2398.h"
+#include "h9012.h"
+#ifdef X
+#include "h2166.h"
+#endif
+struct S7140 { int a; const char *s = "x//y"; };
+inline int f7140_0(int x) { return x * 0; }
+inline int f7140_1(int x) { return x * 1; }
+inline int f7140_2(int x) { return x * 2; }
+inline int f7140_3(int x) { return x * 3; }
+inline int f7140_4(int x) { return x * 4; }
+inline int f7140_5(int x) { return x * 5; }
+inline int f7140_6(int x) { return x * 6; }
+inline int f7140_7(int x) { return x * 7; }
+inline int f7140_8(int x) { return x * 8; }
+inline int f7140_9(int x) { return x * 9; }
+inline int f7140_10(int x) { return x * 10; }
+inline int f7140_11(int x) { return x * 11; }
+inline int f7140_12(int x) { return x * 12; }
+inline int f7140_13(int x) { return x * 13; }
+inline int f7140_14(int x) { return x * 14; }
+inline int f7140_15(int x) { return x * 15; }
+inline int f7140_16(int x) { return x * 16; }
+inline int f7140_17(int x) { return x * 17; }
+inline int f7140_18(int x) { return x * 18; }
+inline int f7140_19(int x) { return x * 19; }
+inline int f7140_20(int x) { return x * 20; }
+inline int f7140_21(int x) { return x * 21; }
+inline int f7140_22(int x) { return x * 22; }
+inline int f7140_23(int x) { return x * 23; }
+inline int f7140_24(int x) { return x * 24; }
+inline int f7140_25(int x) { return x * 25; }
+inline int f7140_26(int x) { return x * 26; }
+inline int f7140_27(int x) { return x * 27; }
+inline int f7140_28(int x) { return x * 28; }
+inline int f7140_29(int x) { return x * 29; }
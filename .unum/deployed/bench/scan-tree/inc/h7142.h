@@ -0,0 +1,42 @@
+#pragma once
+/* header 7142 */
+#include <vector>
+#include "h3572.h"
+#include "h6864.h"
+#include "h1933.h"
+#include "h8168.h"
+#include "h7031.h"
+#ifdef X
+#include "h8239.h"
+#endif
+struct S7142 { int a; const char *s = "x//y"; };
+inline int f7142_0(int x) { return x * 0; }
+inline int f7142_1(int x) { return x * 1; }
+inline int f7142_2(int x) { return x * 2; }
+inline int f7142_3(int x) { return x * 3; }
+inline int f7142_4(int x) { return x * 4; }
+inline int f7142_5(int x) { return x * 5; }
+inline int f7142_6(int x) { return x * 6; }
+inline int f7142_7(int x) { return x * 7; }
+inline int f7142_8(int x) { return x * 8; }
+inline int f7142_9(int x) { return x * 9; }
+inline int f7142_10(int x) { return x * 10; }
+inline int f7142_11(int x) { return x * 11; }
+inline int f7142_12(int x) { return x * 12; }
+inline int f7142_13(int x) { return x * 13; }
+inline int f7142_14(int x) { return x * 14; }
+inline int f7142_15(int x) { return x * 15; }
+inline int f7142_16(int x) { return x * 16; }
+inline int f7142_17(int x) { return x * 17; }
+inline int f7142_18(int x) { return x * 18; }
+inline int f7142_19(int x) { return x * 19; }
+inline int f7142_20(int x) { return x * 20; }
+inline int f7142_21(int x) { return x * 21; }
+inline int f7142_22(int x) { return x * 22; }
+inline int f7142_23(int x) { return x * 23; }
+inline int f7142_24(int x) { return x * 24; }
+inline int f7142_25(int x) { return x * 25; }
+inline int f7142_26(int x) { return x * 26; }
+inline int f7142_27(int x) { return x * 27; }
+inline int f7142_28(int x) { return x * 28; }
+inline int f7142_29(int x) { return x * 29; }
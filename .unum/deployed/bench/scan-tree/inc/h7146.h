@@ -0,0 +1,42 @@
+#pragma once
+/* header 7146 */
+#include <vector>
+#include "h1690.h"
+#include "h5849.h"
+#include "h803.h"
+#include "h498.h"
+#include "h576.h"
+#ifdef X
+#include "h6937.h"
+#endif
+struct S7146 { int a; const char *s = "x//y"; };
+inline int f7146_0(int x) { return x * 0; }
+inline int f7146_1(int x) { return x * 1; }
+inline int f7146_2(int x) { return x * 2; }
+inline int f7146_3(int x) { return x * 3; }
+inline int f7146_4(int x) { return x * 4; }
+inline int f7146_5(int x) { return x * 5; }
+inline int f7146_6(int x) { return x * 6; }
+inline int f7146_7(int x) { return x * 7; }
+inline int f7146_8(int x) { return x * 8; }
+inline int f7146_9(int x) { return x * 9; }
+inline int f7146_10(int x) { return x * 10; }
+inline int f7146_11(int x) { return x * 11; }
+inline int f7146_12(int x) { return x * 12; }
+inline int f7146_13(int x) { return x * 13; }
+inline int f7146_14(int x) { return x * 14; }
+inline int f7146_15(int x) { return x * 15; }
+inline int f7146_16(int x) { return x * 16; }
+inline int f7146_17(int x) { return x * 17; }
+inline int f7146_18(int x) { return x * 18; }
+inline int f7146_19(int x) { return x * 19; }
+inline int f7146_20(int x) { return x * 20; }
+inline int f7146_21(int x) { return x * 21; }
+inline int f7146_22(int x) { return x * 22; }
+inline int f7146_23(int x) { return x * 23; }
+inline int f7146_24(int x) { return x * 24; }
+inline int f7146_25(int x) { return x * 25; }
+inline int f7146_26(int x) { return x * 26; }
+inline int f7146_27(int x) { return x * 27; }
+inline int f7146_28(int x) { return x * 28; }
+inline int f7146_29(int x) { return x * 29; }
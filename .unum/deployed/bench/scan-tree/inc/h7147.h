@@ -0,0 +1,42 @@
+#pragma once
+/* header 7147 */
+#include <vector>
+#include "h1443.h"
+#include "h7656.h"
+#include "h7658.h"
+#include "h7887.h"
+#include "h3928.h"
+#ifdef X
+#include "h1405.h"
+#endif
+struct S7147 { int a; const char *s = "x//y"; };
+inline int f7147_0(int x) { return x * 0; }
+inline int f7147_1(int x) { return x * 1; }
+inline int f7147_2(int x) { return x * 2; }
+inline int f7147_3(int x) { return x * 3; }
+inline int f7147_4(int x) { return x * 4; }
+inline int f7147_5(int x) { return x * 5; }
+inline int f7147_6(int x) { return x * 6; }
+inline int f7147_7(int x) { return x * 7; }
+inline int f7147_8(int x) { return x * 8; }
+inline int f7147_9(int x) { return x * 9; }
+inline int f7147_10(int x) { return x * 10; }
+inline int f7147_11(int x) { return x * 11; }
+inline int f7147_12(int x) { return x * 12; }
+inline int f7147_13(int x) { return x * 13; }
+inline int f7147_14(int x) { return x * 14; }
+inline int f7147_15(int x) { return x * 15; }
+inline int f7147_16(int x) { return x * 16; }
+inline int f7147_17(int x) { return x * 17; }
+inline int f7147_18(int x) { return x * 18; }
+inline int f7147_19(int x) { return x * 19; }
+inline int f7147_20(int x) { return x * 20; }
+inline int f7147_21(int x) { return x * 21; }
+inline int f7147_22(int x) { return x * 22; }
+inline int f7147_23(int x) { return x * 23; }
+inline int f7147_24(int x) { return x * 24; }
+inline int f7147_25(int x) { return x * 25; }
+inline int f7147_26(int x) { return x * 26; }
+inline int f7147_27(int x) { return x * 27; }
+inline int f7147_28(int x) { return x * 28; }
+inline int f7147_29(int x) { return x * 29; }
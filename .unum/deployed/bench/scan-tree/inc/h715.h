@@ -0,0 +1,42 @@
+#pragma once
+/* header 715 */
+#include <vector>
+#include "h1094.h"
+#include "h4479.h"
+#include "h7869.h"
+#include "h5815.h"
+#include "h3810.h"
+#ifdef X
+#include "h5341.h"
+#endif
+struct S715 { int a; const char *s = "x//y"; };
+inline int f715_0(int x) { return x * 0; }
+inline int f715_1(int x) { return x * 1; }
+inline int f715_2(int x) { return x * 2; }
+inline int f715_3(int x) { return x * 3; }
+inline int f715_4(int x) { return x * 4; }
+inline int f715_5(int x) { return x * 5; }
+inline int f715_6(int x) { return x * 6; }
+inline int f715_7(int x) { return x * 7; }
+inline int f715_8(int x) { return x * 8; }
+inline int f715_9(int x) { return x * 9; }
+inline int f715_10(int x) { return x * 10; }
+inline int f715_11(int x) { return x * 11; }
+inline int f715_12(int x) { return x * 12; }
+inline int f715_13(int x) { return x * 13; }
+inline int f715_14(int x) { return x * 14; }
+inline int f715_15(int x) { return x * 15; }
+inline int f715_16(int x) { return x * 16; }
+inline int f715_17(int x) { return x * 17; }
+inline int f715_18(int x) { return x * 18; }
+inline int f715_19(int x) { return x * 19; }
+inline int f715_20(int x) { return x * 20; }
+inline int f715_21(int x) { return x * 21; }
+inline int f715_22(int x) { return x * 22; }
+inline int f715_23(int x) { return x * 23; }
+inline int f715_24(int x) { return x * 24; }
+inline int f715_25(int x) { return x * 25; }
+inline int f715_26(int x) { return x * 26; }
+inline int f715_27(int x) { return x * 27; }
+inline int f715_28(int x) { return x * 28; }
+inline int f715_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7151 */
+#include <vector>
+#include "h8872.h"
+#include "h1812.h"
+#include "h8214.h"
+#include "h9138.h"
+#include "h3936.h"
+#ifdef X
+#include "h6048.h"
+#endif
+struct S7151 { int a; const char *s = "x//y"; };
+inline int f7151_0(int x) { return x * 0; }
+inline int f7151_1(int x) { return x * 1; }
+inline int f7151_2(int x) { return x * 2; }
+inline int f7151_3(int x) { return x * 3; }
+inline int f7151_4(int x) { return x * 4; }
+inline int f7151_5(int x) { return x * 5; }
+inline int f7151_6(int x) { return x * 6; }
+inline int f7151_7(int x) { return x * 7; }
+inline int f7151_8(int x) { return x * 8; }
+inline int f7151_9(int x) { return x * 9; }
+inline int f7151_10(int x) { return x * 10; }
+inline int f7151_11(int x) { return x * 11; }
+inline int f7151_12(int x) { return x * 12; }
+inline int f7151_13(int x) { return x * 13; }
+inline int f7151_14(int x) { return x * 14; }
+inline int f7151_15(int x) { return x * 15; }
+inline int f7151_16(int x) { return x * 16; }
+inline int f7151_17(int x) { return x * 17; }
+inline int f7151_18(int x) { return x * 18; }
+inline int f7151_19(int x) { return x * 19; }
+inline int f7151_20(int x) { return x * 20; }
+inline int f7151_21(int x) { return x * 21; }
+inline int f7151_22(int x) { return x * 22; }
+inline int f7151_23(int x) { return x * 23; }
+inline int f7151_24(int x) { return x * 24; }
+inline int f7151_25(int x) { return x * 25; }
+inline int f7151_26(int x) { return x * 26; }
+inline int f7151_27(int x) { return x * 27; }
+inline int f7151_28(int x) { return x * 28; }
+inline int f7151_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7154 */
+#include <vector>
+#include "h4978.h"
+#include "h8869.h"
+#include "h8864.h"
+#include "h7174.h"
+#include "h3862.h"
+#ifdef X
+#include "h5843.h"
+#endif
+struct S7154 { int a; const char *s = "x//y"; };
+inline int f7154_0(int x) { return x * 0; }
+inline int f7154_1(int x) { return x * 1; }
+inline int f7154_2(int x) { return x * 2; }
+inline int f7154_3(int x) { return x * 3; }
+inline int f7154_4(int x) { return x * 4; }
+inline int f7154_5(int x) { return x * 5; }
+inline int f7154_6(int x) { return x * 6; }
+inline int f7154_7(int x) { return x * 7; }
+inline int f7154_8(int x) { return x * 8; }
+inline int f7154_9(int x) { return x * 9; }
+inline int f7154_10(int x) { return x * 10; }
+inline int f7154_11(int x) { return x * 11; }
+inline int f7154_12(int x) { return x * 12; }
+inline int f7154_13(int x) { return x * 13; }
+inline int f7154_14(int x) { return x * 14; }
+inline int f7154_15(int x) { return x * 15; }
+inline int f7154_16(int x) { return x * 16; }
+inline int f7154_17(int x) { return x * 17; }
+inline int f7154_18(int x) { return x * 18; }
+inline int f7154_19(int x) { return x * 19; }
+inline int f7154_20(int x) { return x * 20; }
+inline int f7154_21(int x) { return x * 21; }
+inline int f7154_22(int x) { return x * 22; }
+inline int f7154_23(int x) { return x * 23; }
+inline int f7154_24(int x) { return x * 24; }
+inline int f7154_25(int x) { return x * 25; }
+inline int f7154_26(int x) { return x * 26; }
+inline int f7154_27(int x) { return x * 27; }
+inline int f7154_28(int x) { return x * 28; }
+inline int f7154_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7155 */
+#include <vector>
+#include "h8594.h"
+#include "h9741.h"
+#include "h2840.h"
+#include "h2926.h"
+#include "h6547.h"
+#ifdef X
+#include "h5955.h"
+#endif
+struct S7155 { int a; const char *s = "x//y"; };
+inline int f7155_0(int x) { return x * 0; }
+inline int f7155_1(int x) { return x * 1; }
+inline int f7155_2(int x) { return x * 2; }
+inline int f7155_3(int x) { return x * 3; }
+inline int f7155_4(int x) { return x * 4; }
+inline int f7155_5(int x) { return x * 5; }
+inline int f7155_6(int x) { return x * 6; }
+inline int f7155_7(int x) { return x * 7; }
+inline int f7155_8(int x) { return x * 8; }
+inline int f7155_9(int x) { return x * 9; }
+inline int f7155_10(int x) { return x * 10; }
+inline int f7155_11(int x) { return x * 11; }
+inline int f7155_12(int x) { return x * 12; }
+inline int f7155_13(int x) { return x * 13; }
+inline int f7155_14(int x) { return x * 14; }
+inline int f7155_15(int x) { return x * 15; }
+inline int f7155_16(int x) { return x * 16; }
+inline int f7155_17(int x) { return x * 17; }
+inline int f7155_18(int x) { return x * 18; }
+inline int f7155_19(int x) { return x * 19; }
+inline int f7155_20(int x) { return x * 20; }
+inline int f7155_21(int x) { return x * 21; }
+inline int f7155_22(int x) { return x * 22; }
+inline int f7155_23(int x) { return x * 23; }
+inline int f7155_24(int x) { return x * 24; }
+inline int f7155_25(int x) { return x * 25; }
+inline int f7155_26(int x) { return x * 26; }
+inline int f7155_27(int x) { return x * 27; }
+inline int f7155_28(int x) { return x * 28; }
+inline int f7155_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7156 */
+#include <vector>
+#include "h3599.h"
+#include "h1926.h"
+#include "h2236.h"
+#include "h1046.h"
+#include "h4036.h"
+#ifdef X
+#include "h6530.h"
+#endif
+struct S7156 { int a; const char *s = "x//y"; };
+inline int f7156_0(int x) { return x * 0; }
+inline int f7156_1(int x) { return x * 1; }
+inline int f7156_2(int x) { return x * 2; }
+inline int f7156_3(int x) { return x * 3; }
+inline int f7156_4(int x) { return x * 4; }
+inline int f7156_5(int x) { return x * 5; }
+inline int f7156_6(int x) { return x * 6; }
+inline int f7156_7(int x) { return x * 7; }
+inline int f7156_8(int x) { return x * 8; }
+inline int f7156_9(int x) { return x * 9; }
+inline int f7156_10(int x) { return x * 10; }
+inline int f7156_11(int x) { return x * 11; }
+inline int f7156_12(int x) { return x * 12; }
+inline int f7156_13(int x) { return x * 13; }
+inline int f7156_14(int x) { return x * 14; }
+inline int f7156_15(int x) { return x * 15; }
+inline int f7156_16(int x) { return x * 16; }
+inline int f7156_17(int x) { return x * 17; }
+inline int f7156_18(int x) { return x * 18; }
+inline int f7156_19(int x) { return x * 19; }
+inline int f7156_20(int x) { return x * 20; }
+inline int f7156_21(int x) { return x * 21; }
+inline int f7156_22(int x) { return x * 22; }
+inline int f7156_23(int x) { return x * 23; }
+inline int f7156_24(int x) { return x * 24; }
+inline int f7156_25(int x) { return x * 25; }
+inline int f7156_26(int x) { return x * 26; }
+inline int f7156_27(int x) { return x * 27; }
+inline int f7156_28(int x) { return x * 28; }
+inline int f7156_29(int x) { return x * 29; }
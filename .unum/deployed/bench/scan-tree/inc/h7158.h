@@ -0,0 +1,42 @@
+#pragma once
+/* header 7158 */
+#include <vector>
+#include "h8268.h"
+#include "h3113.h"
+#include "h9938.h"
+#include "h6830.h"
+#include "h3824.h"
+#ifdef X
+#include "h3445.h"
+#endif
+struct S7158 { int a; const char *s = "x//y"; };
+inline int f7158_0(int x) { return x * 0; }
+inline int f7158_1(int x) { return x * 1; }
+inline int f7158_2(int x) { return x * 2; }
+inline int f7158_3(int x) { return x * 3; }
+inline int f7158_4(int x) { return x * 4; }
+inline int f7158_5(int x) { return x * 5; }
+inline int f7158_6(int x) { return x * 6; }
+inline int f7158_7(int x) { return x * 7; }
+inline int f7158_8(int x) { return x * 8; }
+inline int f7158_9(int x) { return x * 9; }
+inline int f7158_10(int x) { return x * 10; }
+inline int f7158_11(int x) { return x * 11; }
+inline int f7158_12(int x) { return x * 12; }
+inline int f7158_13(int x) { return x * 13; }
+inline int f7158_14(int x) { return x * 14; }
+inline int f7158_15(int x) { return x * 15; }
+inline int f7158_16(int x) { return x * 16; }
+inline int f7158_17(int x) { return x * 17; }
+inline int f7158_18(int x) { return x * 18; }
+inline int f7158_19(int x) { return x * 19; }
+inline int f7158_20(int x) { return x * 20; }
+inline int f7158_21(int x) { return x * 21; }
+inline int f7158_22(int x) { return x * 22; }
+inline int f7158_23(int x) { return x * 23; }
+inline int f7158_24(int x) { return x * 24; }
+inline int f7158_25(int x) { return x * 25; }
+inline int f7158_26(int x) { return x * 26; }
+inline int f7158_27(int x) { return x * 27; }
+inline int f7158_28(int x) { return x * 28; }
+inline int f7158_29(int x) { return x * 29; }
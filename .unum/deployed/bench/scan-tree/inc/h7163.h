@@ -0,0 +1,42 @@
+#pragma once
+/* header 7163 */
+#include <vector>
+#include "h6717.h"
+#include "h1146.h"
+#include "h6379.h"
+#include "h9446.h"
+#include "h7458.h"
+#ifdef X
+#include "h6652.h"
+#endif
+struct S7163 { int a; const char *s = "x//y"; };
+inline int f7163_0(int x) { return x * 0; }
+inline int f7163_1(int x) { return x * 1; }
+inline int f7163_2(int x) { return x * 2; }
+inline int f7163_3(int x) { return x * 3; }
+inline int f7163_4(int x) { return x * 4; }
+inline int f7163_5(int x) { return x * 5; }
+inline int f7163_6(int x) { return x * 6; }
+inline int f7163_7(int x) { return x * 7; }
+inline int f7163_8(int x) { return x * 8; }
+inline int f7163_9(int x) { return x * 9; }
+inline int f7163_10(int x) { return x * 10; }
+inline int f7163_11(int x) { return x * 11; }
+inline int f7163_12(int x) { return x * 12; }
+inline int f7163_13(int x) { return x * 13; }
+inline int f7163_14(int x) { return x * 14; }
+inline int f7163_15(int x) { return x * 15; }
+inline int f7163_16(int x) { return x * 16; }
+inline int f7163_17(int x) { return x * 17; }
+inline int f7163_18(int x) { return x * 18; }
+inline int f7163_19(int x) { return x * 19; }
+inline int f7163_20(int x) { return x * 20; }
+inline int f7163_21(int x) { return x * 21; }
+inline int f7163_22(int x) { return x * 22; }
+inline int f7163_23(int x) { return x * 23; }
+inline int f7163_24(int x) { return x * 24; }
+inline int f7163_25(int x) { return x * 25; }
+inline int f7163_26(int x) { return x * 26; }
+inline int f7163_27(int x) { return x * 27; }
+inline int f7163_28(int x) { return x * 28; }
+inline int f7163_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7180 */
+#include <vector>
+#include "h7081.h"
+#include "h1384.h"
+#include "h7237.h"
+#include "h7457.h"
+#include "h3250.h"
+#ifdef X
+#include "h5919.h"
+#endif
+struct S7180 { int a; const char *s = "x//y"; };
+inline int f7180_0(int x) { return x * 0; }
+inline int f7180_1(int x) { return x * 1; }
+inline int f7180_2(int x) { return x * 2; }
+inline int f7180_3(int x) { return x * 3; }
+inline int f7180_4(int x) { return x * 4; }
+inline int f7180_5(int x) { return x * 5; }
+inline int f7180_6(int x) { return x * 6; }
+inline int f7180_7(int x) { return x * 7; }
+inline int f7180_8(int x) { return x * 8; }
+inline int f7180_9(int x) { return x * 9; }
+inline int f7180_10(int x) { return x * 10; }
+inline int f7180_11(int x) { return x * 11; }
+inline int f7180_12(int x) { return x * 12; }
+inline int f7180_13(int x) { return x * 13; }
+inline int f7180_14(int x) { return x * 14; }
+inline int f7180_15(int x) { return x * 15; }
+inline int f7180_16(int x) { return x * 16; }
+inline int f7180_17(int x) { return x * 17; }
+inline int f7180_18(int x) { return x * 18; }
+inline int f7180_19(int x) { return x * 19; }
+inline int f7180_20(int x) { return x * 20; }
+inline int f7180_21(int x) { return x * 21; }
+inline int f7180_22(int x) { return x * 22; }
+inline int f7180_23(int x) { return x * 23; }
+inline int f7180_24(int x) { return x * 24; }
+inline int f7180_25(int x) { return x * 25; }
+inline int f7180_26(int x) { return x * 26; }
+inline int f7180_27(int x) { return x * 27; }
+inline int f7180_28(int x) { return x * 28; }
+inline int f7180_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7182 */
+#include <vector>
+#include "h1090.h"
+#include "h5025.h"
+#include "h8083.h"
+#include "h6970.h"
+#include "h4176.h"
+#ifdef X
+#include "h4035.h"
+#endif
+struct S7182 { int a; const char *s = "x//y"; };
+inline int f7182_0(int x) { return x * 0; }
+inline int f7182_1(int x) { return x * 1; }
+inline int f7182_2(int x) { return x * 2; }
+inline int f7182_3(int x) { return x * 3; }
+inline int f7182_4(int x) { return x * 4; }
+inline int f7182_5(int x) { return x * 5; }
+inline int f7182_6(int x) { return x * 6; }
+inline int f7182_7(int x) { return x * 7; }
+inline int f7182_8(int x) { return x * 8; }
+inline int f7182_9(int x) { return x * 9; }
+inline int f7182_10(int x) { return x * 10; }
+inline int f7182_11(int x) { return x * 11; }
+inline int f7182_12(int x) { return x * 12; }
+inline int f7182_13(int x) { return x * 13; }
+inline int f7182_14(int x) { return x * 14; }
+inline int f7182_15(int x) { return x * 15; }
+inline int f7182_16(int x) { return x * 16; }
+inline int f7182_17(int x) { return x * 17; }
+inline int f7182_18(int x) { return x * 18; }
+inline int f7182_19(int x) { return x * 19; }
+inline int f7182_20(int x) { return x * 20; }
+inline int f7182_21(int x) { return x * 21; }
+inline int f7182_22(int x) { return x * 22; }
+inline int f7182_23(int x) { return x * 23; }
+inline int f7182_24(int x) { return x * 24; }
+inline int f7182_25(int x) { return x * 25; }
+inline int f7182_26(int x) { return x * 26; }
+inline int f7182_27(int x) { return x * 27; }
+inline int f7182_28(int x) { return x * 28; }
+inline int f7182_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7184 */
+#include <vector>
+#include "h6358.h"
+#include "h7427.h"
+#include "h7520.h"
+#include "h519.h"
+#include "h2023.h"
+#ifdef X
+#include "h3334.h"
+#endif
+struct S7184 { int a; const char *s = "x//y"; };
+inline int f7184_0(int x) { return x * 0; }
+inline int f7184_1(int x) { return x * 1; }
+inline int f7184_2(int x) { return x * 2; }
+inline int f7184_3(int x) { return x * 3; }
+inline int f7184_4(int x) { return x * 4; }
+inline int f7184_5(int x) { return x * 5; }
+inline int f7184_6(int x) { return x * 6; }
+inline int f7184_7(int x) { return x * 7; }
+inline int f7184_8(int x) { return x * 8; }
+inline int f7184_9(int x) { return x * 9; }
+inline int f7184_10(int x) { return x * 10; }
+inline int f7184_11(int x) { return x * 11; }
+inline int f7184_12(int x) { return x * 12; }
+inline int f7184_13(int x) { return x * 13; }
+inline int f7184_14(int x) { return x * 14; }
+inline int f7184_15(int x) { return x * 15; }
+inline int f7184_16(int x) { return x * 16; }
+inline int f7184_17(int x) { return x * 17; }
+inline int f7184_18(int x) { return x * 18; }
+inline int f7184_19(int x) { return x * 19; }
+inline int f7184_20(int x) { return x * 20; }
+inline int f7184_21(int x) { return x * 21; }
+inline int f7184_22(int x) { return x * 22; }
+inline int f7184_23(int x) { return x * 23; }
+inline int f7184_24(int x) { return x * 24; }
+inline int f7184_25(int x) { return x * 25; }
+inline int f7184_26(int x) { return x * 26; }
+inline int f7184_27(int x) { return x * 27; }
+inline int f7184_28(int x) { return x * 28; }
+inline int f7184_29(int x) { return x * 29; }
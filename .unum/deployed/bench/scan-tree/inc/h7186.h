@@ -0,0 +1,42 @@
+#pragma once
+/* header 7186 */
+#include <vector>
+#include "h2460.h"
+#include "h8544.h"
+#include "h2457.h"
+#include "h9123.h"
+#include "h9413.h"
+#ifdef X
+#include "h7471.h"
+#endif
+struct S7186 { int a; const char *s = "x//y"; };
+inline int f7186_0(int x) { return x * 0; }
+inline int f7186_1(int x) { return x * 1; }
+inline int f7186_2(int x) { return x * 2; }
+inline int f7186_3(int x) { return x * 3; }
+inline int f7186_4(int x) { return x * 4; }
+inline int f7186_5(int x) { return x * 5; }
+inline int f7186_6(int x) { return x * 6; }
+inline int f7186_7(int x) { return x * 7; }
+inline int f7186_8(int x) { return x * 8; }
+inline int f7186_9(int x) { return x * 9; }
+inline int f7186_10(int x) { return x * 10; }
+inline int f7186_11(int x) { return x * 11; }
+inline int f7186_12(int x) { return x * 12; }
+inline int f7186_13(int x) { return x * 13; }
+inline int f7186_14(int x) { return x * 14; }
+inline int f7186_15(int x) { return x * 15; }
+inline int f7186_16(int x) { return x * 16; }
+inline int f7186_17(int x) { return x * 17; }
+inline int f7186_18(int x) { return x * 18; }
+inline int f7186_19(int x) { return x * 19; }
+inline int f7186_20(int x) { return x * 20; }
+inline int f7186_21(int x) { return x * 21; }
+inline int f7186_22(int x) { return x * 22; }
+inline int f7186_23(int x) { return x * 23; }
+inline int f7186_24(int x) { return x * 24; }
+inline int f7186_25(int x) { return x * 25; }
+inline int f7186_26(int x) { return x * 26; }
+inline int f7186_27(int x) { return x * 27; }
+inline int f7186_28(int x) { return x * 28; }
+inline int f7186_29(int x) { return x * 29; }
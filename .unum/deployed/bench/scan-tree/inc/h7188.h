@@ -0,0 +1,42 @@
+#pragma once
+/* header 7188 */
+#include <vector>
+#include "h3036.h"
+#include "h5194.h"
+#include "h8264.h"
+#include "h6124.h"
+#include "h5891.h"
+#ifdef X
+#include "h4116.h"
+#endif
+struct S7188 { int a; const char *s = "x//y"; };
+inline int f7188_0(int x) { return x * 0; }
+inline int f7188_1(int x) { return x * 1; }
+inline int f7188_2(int x) { return x * 2; }
+inline int f7188_3(int x) { return x * 3; }
+inline int f7188_4(int x) { return x * 4; }
+inline int f7188_5(int x) { return x * 5; }
+inline int f7188_6(int x) { return x * 6; }
+inline int f7188_7(int x) { return x * 7; }
+inline int f7188_8(int x) { return x * 8; }
+inline int f7188_9(int x) { return x * 9; }
+inline int f7188_10(int x) { return x * 10; }
+inline int f7188_11(int x) { return x * 11; }
+inline int f7188_12(int x) { return x * 12; }
+inline int f7188_13(int x) { return x * 13; }
+inline int f7188_14(int x) { return x * 14; }
+inline int f7188_15(int x) { return x * 15; }
+inline int f7188_16(int x) { return x * 16; }
+inline int f7188_17(int x) { return x * 17; }
+inline int f7188_18(int x) { return x * 18; }
+inline int f7188_19(int x) { return x * 19; }
+inline int f7188_20(int x) { return x * 20; }
+inline int f7188_21(int x) { return x * 21; }
+inline int f7188_22(int x) { return x * 22; }
+inline int f7188_23(int x) { return x * 23; }
+inline int f7188_24(int x) { return x * 24; }
+inline int f7188_25(int x) { return x * 25; }
+inline int f7188_26(int x) { return x * 26; }
+inline int f7188_27(int x) { return x * 27; }
+inline int f7188_28(int x) { return x * 28; }
+inline int f7188_29(int x) { return x * 29; }
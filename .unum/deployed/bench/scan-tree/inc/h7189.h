@@ -0,0 +1,42 @@
+#pragma once
+/* header 7189 */
+#include <vector>
+#include "h4808.h"
+#include "h8207.h"
+#include "h5486.h"
+#include "h9866.h"
+#include "h2635.h"
+#ifdef X
+#include "h1474.h"
+#endif
+struct S7189 { int a; const char *s = "x//y"; };
+inline int f7189_0(int x) { return x * 0; }
+inline int f7189_1(int x) { return x * 1; }
+inline int f7189_2(int x) { return x * 2; }
+inline int f7189_3(int x) { return x * 3; }
+inline int f7189_4(int x) { return x * 4; }
+inline int f7189_5(int x) { return x * 5; }
+inline int f7189_6(int x) { return x * 6; }
+inline int f7189_7(int x) { return x * 7; }
+inline int f7189_8(int x) { return x * 8; }
+inline int f7189_9(int x) { return x * 9; }
+inline int f7189_10(int x) { return x * 10; }
+inline int f7189_11(int x) { return x * 11; }
+inline int f7189_12(int x) { return x * 12; }
+inline int f7189_13(int x) { return x * 13; }
+inline int f7189_14(int x) { return x * 14; }
+inline int f7189_15(int x) { return x * 15; }
+inline int f7189_16(int x) { return x * 16; }
+inline int f7189_17(int x) { return x * 17; }
+inline int f7189_18(int x) { return x * 18; }
+inline int f7189_19(int x) { return x * 19; }
+inline int f7189_20(int x) { return x * 20; }
+inline int f7189_21(int x) { return x * 21; }
+inline int f7189_22(int x) { return x * 22; }
+inline int f7189_23(int x) { return x * 23; }
+inline int f7189_24(int x) { return x * 24; }
+inline int f7189_25(int x) { return x * 25; }
+inline int f7189_26(int x) { return x * 26; }
+inline int f7189_27(int x) { return x * 27; }
+inline int f7189_28(int x) { return x * 28; }
+inline int f7189_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7190 */
+#include <vector>
+#include "h2069.h"
+#include "h4297.h"
+#include "h7909.h"
+#include "h2562.h"
+#include "h1852.h"
+#ifdef X
+#include "h1845.h"
+#endif
+struct S7190 { int a; const char *s = "x//y"; };
+inline int f7190_0(int x) { return x * 0; }
+inline int f7190_1(int x) { return x * 1; }
+inline int f7190_2(int x) { return x * 2; }
+inline int f7190_3(int x) { return x * 3; }
+inline int f7190_4(int x) { return x * 4; }
+inline int f7190_5(int x) { return x * 5; }
+inline int f7190_6(int x) { return x * 6; }
+inline int f7190_7(int x) { return x * 7; }
+inline int f7190_8(int x) { return x * 8; }
+inline int f7190_9(int x) { return x * 9; }
+inline int f7190_10(int x) { return x * 10; }
+inline int f7190_11(int x) { return x * 11; }
+inline int f7190_12(int x) { return x * 12; }
+inline int f7190_13(int x) { return x * 13; }
+inline int f7190_14(int x) { return x * 14; }
+inline int f7190_15(int x) { return x * 15; }
+inline int f7190_16(int x) { return x * 16; }
+inline int f7190_17(int x) { return x * 17; }
+inline int f7190_18(int x) { return x * 18; }
+inline int f7190_19(int x) { return x * 19; }
+inline int f7190_20(int x) { return x * 20; }
+inline int f7190_21(int x) { return x * 21; }
+inline int f7190_22(int x) { return x * 22; }
+inline int f7190_23(int x) { return x * 23; }
+inline int f7190_24(int x) { return x * 24; }
+inline int f7190_25(int x) { return x * 25; }
+inline int f7190_26(int x) { return x * 26; }
+inline int f7190_27(int x) { return x * 27; }
+inline int f7190_28(int x) { return x * 28; }
+inline int f7190_29(int x) { return x * 29; }
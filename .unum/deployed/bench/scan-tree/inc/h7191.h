@@ -0,0 +1,42 @@
+#pragma once
+/* header 7191 */
+#include <vector>
+#include "h3086.h"
+#include "h9914.h"
+#include "h2410.h"
+#include "h8218.h"
+#include "h6890.h"
+#ifdef X
+#include "h2285.h"
+#endif
+struct S7191 { int a; const char *s = "x//y"; };
+inline int f7191_0(int x) { return x * 0; }
+inline int f7191_1(int x) { return x * 1; }
+inline int f7191_2(int x) { return x * 2; }
+inline int f7191_3(int x) { return x * 3; }
+inline int f7191_4(int x) { return x * 4; }
+inline int f7191_5(int x) { return x * 5; }
+inline int f7191_6(int x) { return x * 6; }
+inline int f7191_7(int x) { return x * 7; }
+inline int f7191_8(int x) { return x * 8; }
+inline int f7191_9(int x) { return x * 9; }
+inline int f7191_10(int x) { return x * 10; }
+inline int f7191_11(int x) { return x * 11; }
+inline int f7191_12(int x) { return x * 12; }
+inline int f7191_13(int x) { return x * 13; }
+inline int f7191_14(int x) { return x * 14; }
+inline int f7191_15(int x) { return x * 15; }
+inline int f7191_16(int x) { return x * 16; }
+inline int f7191_17(int x) { return x * 17; }
+inline int f7191_18(int x) { return x * 18; }
+inline int f7191_19(int x) { return x * 19; }
+inline int f7191_20(int x) { return x * 20; }
+inline int f7191_21(int x) { return x * 21; }
+inline int f7191_22(int x) { return x * 22; }
+inline int f7191_23(int x) { return x * 23; }
+inline int f7191_24(int x) { return x * 24; }
+inline int f7191_25(int x) { return x * 25; }
+inline int f7191_26(int x) { return x * 26; }
+inline int f7191_27(int x) { return x * 27; }
+inline int f7191_28(int x) { return x * 28; }
+inline int f7191_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7192 */
+#include <vector>
+#include "h357.h"
+#include "h7719.h"
+#include "h1020.h"
+#include "h4260.h"
+#include "h9489.h"
+#ifdef X
+#include "h4815.h"
+#endif
+struct S7192 { int a; const char *s = "x//y"; };
+inline int f7192_0(int x) { return x * 0; }
+inline int f7192_1(int x) { return x * 1; }
+inline int f7192_2(int x) { return x * 2; }
+inline int f7192_3(int x) { return x * 3; }
+inline int f7192_4(int x) { return x * 4; }
+inline int f7192_5(int x) { return x * 5; }
+inline int f7192_6(int x) { return x * 6; }
+inline int f7192_7(int x) { return x * 7; }
+inline int f7192_8(int x) { return x * 8; }
+inline int f7192_9(int x) { return x * 9; }
+inline int f7192_10(int x) { return x * 10; }
+inline int f7192_11(int x) { return x * 11; }
+inline int f7192_12(int x) { return x * 12; }
+inline int f7192_13(int x) { return x * 13; }
+inline int f7192_14(int x) { return x * 14; }
+inline int f7192_15(int x) { return x * 15; }
+inline int f7192_16(int x) { return x * 16; }
+inline int f7192_17(int x) { return x * 17; }
+inline int f7192_18(int x) { return x * 18; }
+inline int f7192_19(int x) { return x * 19; }
+inline int f7192_20(int x) { return x * 20; }
+inline int f7192_21(int x) { return x * 21; }
+inline int f7192_22(int x) { return x * 22; }
+inline int f7192_23(int x) { return x * 23; }
+inline int f7192_24(int x) { return x * 24; }
+inline int f7192_25(int x) { return x * 25; }
+inline int f7192_26(int x) { return x * 26; }
+inline int f7192_27(int x) { return x * 27; }
+inline int f7192_28(int x) { return x * 28; }
+inline int f7192_29(int x) { return x * 29; }
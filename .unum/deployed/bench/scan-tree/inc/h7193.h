@@ -0,0 +1,42 @@
+#pragma once
+/* header 7193 */
+#include <vector>
+#include "h3758.h"
+#include "h3499.h"
+#include "h45.h"
+#include "h3711.h"
+#include "h73.h"
+#ifdef X
+#include "h981.h"
+#endif
+struct S7193 { int a; const char *s = "x//y"; };
+inline int f7193_0(int x) { return x * 0; }
+inline int f7193_1(int x) { return x * 1; }
+inline int f7193_2(int x) { return x * 2; }
+inline int f7193_3(int x) { return x * 3; }
+inline int f7193_4(int x) { return x * 4; }
+inline int f7193_5(int x) { return x * 5; }
+inline int f7193_6(int x) { return x * 6; }
+inline int f7193_7(int x) { return x * 7; }
+inline int f7193_8(int x) { return x * 8; }
+inline int f7193_9(int x) { return x * 9; }
+inline int f7193_10(int x) { return x * 10; }
+inline int f7193_11(int x) { return x * 11; }
+inline int f7193_12(int x) { return x * 12; }
+inline int f7193_13(int x) { return x * 13; }
+inline int f7193_14(int x) { return x * 14; }
+inline int f7193_15(int x) { return x * 15; }
+inline int f7193_16(int x) { return x * 16; }
+inline int f7193_17(int x) { return x * 17; }
+inline int f7193_18(int x) { return x * 18; }
+inline int f7193_19(int x) { return x * 19; }
+inline int f7193_20(int x) { return x * 20; }
+inline int f7193_21(int x) { return x * 21; }
+inline int f7193_22(int x) { return x * 22; }
+inline int f7193_23(int x) { return x * 23; }
+inline int f7193_24(int x) { return x * 24; }
+inline int f7193_25(int x) { return x * 25; }
+inline int f7193_26(int x) { return x * 26; }
+inline int f7193_27(int x) { return x * 27; }
+inline int f7193_28(int x) { return x * 28; }
+inline int f7193_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7195 */
+#include <vector>
+#include "h1041.h"
+#include "h9648.h"
+#include "h1561.h"
+#include "h2291.h"
+#include "h7458.h"
+#ifdef X
+#include "h6230.h"
+#endif
+struct S7195 { int a; const char *s = "x//y"; };
+inline int f7195_0(int x) { return x * 0; }
+inline int f7195_1(int x) { return x * 1; }
+inline int f7195_2(int x) { return x * 2; }
+inline int f7195_3(int x) { return x * 3; }
+inline int f7195_4(int x) { return x * 4; }
+inline int f7195_5(int x) { return x * 5; }
+inline int f7195_6(int x) { return x * 6; }
+inline int f7195_7(int x) { return x * 7; }
+inline int f7195_8(int x) { return x * 8; }
+inline int f7195_9(int x) { return x * 9; }
+inline int f7195_10(int x) { return x * 10; }
+inline int f7195_11(int x) { return x * 11; }
+inline int f7195_12(int x) { return x * 12; }
+inline int f7195_13(int x) { return x * 13; }
+inline int f7195_14(int x) { return x * 14; }
+inline int f7195_15(int x) { return x * 15; }
+inline int f7195_16(int x) { return x * 16; }
+inline int f7195_17(int x) { return x * 17; }
+inline int f7195_18(int x) { return x * 18; }
+inline int f7195_19(int x) { return x * 19; }
+inline int f7195_20(int x) { return x * 20; }
+inline int f7195_21(int x) { return x * 21; }
+inline int f7195_22(int x) { return x * 22; }
+inline int f7195_23(int x) { return x * 23; }
+inline int f7195_24(int x) { return x * 24; }
+inline int f7195_25(int x) { return x * 25; }
+inline int f7195_26(int x) { return x * 26; }
+inline int f7195_27(int x) { return x * 27; }
+inline int f7195_28(int x) { return x * 28; }
+inline int f7195_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7196 */
+#include <vector>
+#include "h6599.h"
+#include "h8816.h"
+#include "h6378.h"
+#include "h234.h"
+#include "h6858.h"
+#ifdef X
+#include "h4605.h"
+#endif
+struct S7196 { int a; const char *s = "x//y"; };
+inline int f7196_0(int x) { return x * 0; }
+inline int f7196_1(int x) { return x * 1; }
+inline int f7196_2(int x) { return x * 2; }
+inline int f7196_3(int x) { return x * 3; }
+inline int f7196_4(int x) { return x * 4; }
+inline int f7196_5(int x) { return x * 5; }
+inline int f7196_6(int x) { return x * 6; }
+inline int f7196_7(int x) { return x * 7; }
+inline int f7196_8(int x) { return x * 8; }
+inline int f7196_9(int x) { return x * 9; }
+inline int f7196_10(int x) { return x * 10; }
+inline int f7196_11(int x) { return x * 11; }
+inline int f7196_12(int x) { return x * 12; }
+inline int f7196_13(int x) { return x * 13; }
+inline int f7196_14(int x) { return x * 14; }
+inline int f7196_15(int x) { return x * 15; }
+inline int f7196_16(int x) { return x * 16; }
+inline int f7196_17(int x) { return x * 17; }
+inline int f7196_18(int x) { return x * 18; }
+inline int f7196_19(int x) { return x * 19; }
+inline int f7196_20(int x) { return x * 20; }
+inline int f7196_21(int x) { return x * 21; }
+inline int f7196_22(int x) { return x * 22; }
+inline int f7196_23(int x) { return x * 23; }
+inline int f7196_24(int x) { return x * 24; }
+inline int f7196_25(int x) { return x * 25; }
+inline int f7196_26(int x) { return x * 26; }
+inline int f7196_27(int x) { return x * 27; }
+inline int f7196_28(int x) { return x * 28; }
+inline int f7196_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7198 */
+#include <vector>
+#include "h7938.h"
+#include "h6258.h"
+#include "h4477.h"
+#include "h48.h"
+#include "h9673.h"
+#ifdef X
+#include "h1533.h"
+#endif
+struct S7198 { int a; const char *s = "x//y"; };
+inline int f7198_0(int x) { return x * 0; }
+inline int f7198_1(int x) { return x * 1; }
+inline int f7198_2(int x) { return x * 2; }
+inline int f7198_3(int x) { return x * 3; }
+inline int f7198_4(int x) { return x * 4; }
+inline int f7198_5(int x) { return x * 5; }
+inline int f7198_6(int x) { return x * 6; }
+inline int f7198_7(int x) { return x * 7; }
+inline int f7198_8(int x) { return x * 8; }
+inline int f7198_9(int x) { return x * 9; }
+inline int f7198_10(int x) { return x * 10; }
+inline int f7198_11(int x) { return x * 11; }
+inline int f7198_12(int x) { return x * 12; }
+inline int f7198_13(int x) { return x * 13; }
+inline int f7198_14(int x) { return x * 14; }
+inline int f7198_15(int x) { return x * 15; }
+inline int f7198_16(int x) { return x * 16; }
+inline int f7198_17(int x) { return x * 17; }
+inline int f7198_18(int x) { return x * 18; }
+inline int f7198_19(int x) { return x * 19; }
+inline int f7198_20(int x) { return x * 20; }
+inline int f7198_21(int x) { return x * 21; }
+inline int f7198_22(int x) { return x * 22; }
+inline int f7198_23(int x) { return x * 23; }
+inline int f7198_24(int x) { return x * 24; }
+inline int f7198_25(int x) { return x * 25; }
+inline int f7198_26(int x) { return x * 26; }
+inline int f7198_27(int x) { return x * 27; }
+inline int f7198_28(int x) { return x * 28; }
+inline int f7198_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7199 */
+#include <vector>
+#include "h7559.h"
+#include "h4018.h"
+#include "h504.h"
+#include "h4082.h"
+#include "h1062.h"
+#ifdef X
+#include "h8215.h"
+#endif
+struct S7199 { int a; const char *s = "x//y"; };
+inline int f7199_0(int x) { return x * 0; }
+inline int f7199_1(int x) { return x * 1; }
+inline int f7199_2(int x) { return x * 2; }
+inline int f7199_3(int x) { return x * 3; }
+inline int f7199_4(int x) { return x * 4; }
+inline int f7199_5(int x) { return x * 5; }
+inline int f7199_6(int x) { return x * 6; }
+inline int f7199_7(int x) { return x * 7; }
+inline int f7199_8(int x) { return x * 8; }
+inline int f7199_9(int x) { return x * 9; }
+inline int f7199_10(int x) { return x * 10; }
+inline int f7199_11(int x) { return x * 11; }
+inline int f7199_12(int x) { return x * 12; }
+inline int f7199_13(int x) { return x * 13; }
+inline int f7199_14(int x) { return x * 14; }
+inline int f7199_15(int x) { return x * 15; }
+inline int f7199_16(int x) { return x * 16; }
+inline int f7199_17(int x) { return x * 17; }
+inline int f7199_18(int x) { return x * 18; }
+inline int f7199_19(int x) { return x * 19; }
+inline int f7199_20(int x) { return x * 20; }
+inline int f7199_21(int x) { return x * 21; }
+inline int f7199_22(int x) { return x * 22; }
+inline int f7199_23(int x) { return x * 23; }
+inline int f7199_24(int x) { return x * 24; }
+inline int f7199_25(int x) { return x * 25; }
+inline int f7199_26(int x) { return x * 26; }
+inline int f7199_27(int x) { return x * 27; }
+inline int f7199_28(int x) { return x * 28; }
+inline int f7199_29(int x) { return x * 29; }
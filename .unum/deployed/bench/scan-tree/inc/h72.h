@@ -0,0 +1,42 @@
+#pragma once
+/* header 72 */
+#include <vector>
+#include "h3310.h"
+#include "h3360.h"
+#include "h1294.h"
+#include "h4795.h"
+#include "h1619.h"
+#ifdef X
+#include "h1854.h"
+#endif
+struct S72 { int a; const char *s = "x//y"; };
+inline int f72_0(int x) { return x * 0; }
+inline int f72_1(int x) { return x * 1; }
+inline int f72_2(int x) { return x * 2; }
+inline int f72_3(int x) { return x * 3; }
+inline int f72_4(int x) { return x * 4; }
+inline int f72_5(int x) { return x * 5; }
+inline int f72_6(int x) { return x * 6; }
+inline int f72_7(int x) { return x * 7; }
+inline int f72_8(int x) { return x * 8; }
+inline int f72_9(int x) { return x * 9; }
+inline int f72_10(int x) { return x * 10; }
+inline int f72_11(int x) { return x * 11; }
+inline int f72_12(int x) { return x * 12; }
+inline int f72_13(int x) { return x * 13; }
+inline int f72_14(int x) { return x * 14; }
+inline int f72_15(int x) { return x * 15; }
+inline int f72_16(int x) { return x * 16; }
+inline int f72_17(int x) { return x * 17; }
+inline int f72_18(int x) { return x * 18; }
+inline int f72_19(int x) { return x * 19; }
+inline int f72_20(int x) { return x * 20; }
+inline int f72_21(int x) { return x * 21; }
+inline int f72_22(int x) { return x * 22; }
+inline int f72_23(int x) { return x * 23; }
+inline int f72_24(int x) { return x * 24; }
+inline int f72_25(int x) { return x * 25; }
+inline int f72_26(int x) { return x * 26; }
+inline int f72_27(int x) { return x * 27; }
+inline int f72_28(int x) { return x * 28; }
+inline int f72_29(int x) { return x * 29; }
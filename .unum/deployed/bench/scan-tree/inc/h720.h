@@ -0,0 +1,42 @@
+#pragma once
+/* header 720 */
+#include <vector>
+#include "h6307.h"
+#include "h2529.h"
+#include "h8372.h"
+#include "h6512.h"
+#include "h4051.h"
+#ifdef X
+#include "h1002.h"
+#endif
+struct S720 { int a; const char *s = "x//y"; };
+inline int f720_0(int x) { return x * 0; }
+inline int f720_1(int x) { return x * 1; }
+inline int f720_2(int x) { return x * 2; }
+inline int f720_3(int x) { return x * 3; }
+inline int f720_4(int x) { return x * 4; }
+inline int f720_5(int x) { return x * 5; }
+inline int f720_6(int x) { return x * 6; }
+inline int f720_7(int x) { return x * 7; }
+inline int f720_8(int x) { return x * 8; }
+inline int f720_9(int x) { return x * 9; }
+inline int f720_10(int x) { return x * 10; }
+inline int f720_11(int x) { return x * 11; }
+inline int f720_12(int x) { return x * 12; }
+inline int f720_13(int x) { return x * 13; }
+inline int f720_14(int x) { return x * 14; }
+inline int f720_15(int x) { return x * 15; }
+inline int f720_16(int x) { return x * 16; }
+inline int f720_17(int x) { return x * 17; }
+inline int f720_18(int x) { return x * 18; }
+inline int f720_19(int x) { return x * 19; }
+inline int f720_20(int x) { return x * 20; }
+inline int f720_21(int x) { return x * 21; }
+inline int f720_22(int x) { return x * 22; }
+inline int f720_23(int x) { return x * 23; }
+inline int f720_24(int x) { return x * 24; }
+inline int f720_25(int x) { return x * 25; }
+inline int f720_26(int x) { return x * 26; }
+inline int f720_27(int x) { return x * 27; }
+inline int f720_28(int x) { return x * 28; }
+inline int f720_29(int x) { return x * 29; }
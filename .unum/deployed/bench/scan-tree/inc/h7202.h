@@ -0,0 +1,42 @@
+#pragma once
+/* header 7202 */
+#include <vector>
+#include "h2130.h"
+#include "h8079.h"
+#include "h2755.h"
+#include "h1388.h"
+#include "h7810.h"
+#ifdef X
+#include "h6409.h"
+#endif
+struct S7202 { int a; const char *s = "x//y"; };
+inline int f7202_0(int x) { return x * 0; }
+inline int f7202_1(int x) { return x * 1; }
+inline int f7202_2(int x) { return x * 2; }
+inline int f7202_3(int x) { return x * 3; }
+inline int f7202_4(int x) { return x * 4; }
+inline int f7202_5(int x) { return x * 5; }
+inline int f7202_6(int x) { return x * 6; }
+inline int f7202_7(int x) { return x * 7; }
+inline int f7202_8(int x) { return x * 8; }
+inline int f7202_9(int x) { return x * 9; }
+inline int f7202_10(int x) { return x * 10; }
+inline int f7202_11(int x) { return x * 11; }
+inline int f7202_12(int x) { return x * 12; }
+inline int f7202_13(int x) { return x * 13; }
+inline int f7202_14(int x) { return x * 14; }
+inline int f7202_15(int x) { return x * 15; }
+inline int f7202_16(int x) { return x * 16; }
+inline int f7202_17(int x) { return x * 17; }
+inline int f7202_18(int x) { return x * 18; }
+inline int f7202_19(int x) { return x * 19; }
+inline int f7202_20(int x) { return x * 20; }
+inline int f7202_21(int x) { return x * 21; }
+inline int f7202_22(int x) { return x * 22; }
+inline int f7202_23(int x) { return x * 23; }
+inline int f7202_24(int x) { return x * 24; }
+inline int f7202_25(int x) { return x * 25; }
+inline int f7202_26(int x) { return x * 26; }
+inline int f7202_27(int x) { return x * 27; }
+inline int f7202_28(int x) { return x * 28; }
+inline int f7202_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7203 */
+#include <vector>
+#include "h8251.h"
+#include "h7243.h"
+#include "h8210.h"
+#include "h9332.h"
+#include "h9966.h"
+#ifdef X
+#include "h6311.h"
+#endif
+struct S7203 { int a; const char *s = "x//y"; };
+inline int f7203_0(int x) { return x * 0; }
+inline int f7203_1(int x) { return x * 1; }
+inline int f7203_2(int x) { return x * 2; }
+inline int f7203_3(int x) { return x * 3; }
+inline int f7203_4(int x) { return x * 4; }
+inline int f7203_5(int x) { return x * 5; }
+inline int f7203_6(int x) { return x * 6; }
+inline int f7203_7(int x) { return x * 7; }
+inline int f7203_8(int x) { return x * 8; }
+inline int f7203_9(int x) { return x * 9; }
+inline int f7203_10(int x) { return x * 10; }
+inline int f7203_11(int x) { return x * 11; }
+inline int f7203_12(int x) { return x * 12; }
+inline int f7203_13(int x) { return x * 13; }
+inline int f7203_14(int x) { return x * 14; }
+inline int f7203_15(int x) { return x * 15; }
+inline int f7203_16(int x) { return x * 16; }
+inline int f7203_17(int x) { return x * 17; }
+inline int f7203_18(int x) { return x * 18; }
+inline int f7203_19(int x) { return x * 19; }
+inline int f7203_20(int x) { return x * 20; }
+inline int f7203_21(int x) { return x * 21; }
+inline int f7203_22(int x) { return x * 22; }
+inline int f7203_23(int x) { return x * 23; }
+inline int f7203_24(int x) { return x * 24; }
+inline int f7203_25(int x) { return x * 25; }
+inline int f7203_26(int x) { return x * 26; }
+inline int f7203_27(int x) { return x * 27; }
+inline int f7203_28(int x) { return x * 28; }
+inline int f7203_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7205 */
+#include <vector>
+#include "h5189.h"
+#include "h9271.h"
+#include "h7551.h"
+#include "h7522.h"
+#include "h1036.h"
+#ifdef X
+#include "h8537.h"
+#endif
+struct S7205 { int a; const char *s = "x//y"; };
+inline int f7205_0(int x) { return x * 0; }
+inline int f7205_1(int x) { return x * 1; }
+inline int f7205_2(int x) { return x * 2; }
+inline int f7205_3(int x) { return x * 3; }
+inline int f7205_4(int x) { return x * 4; }
+inline int f7205_5(int x) { return x * 5; }
+inline int f7205_6(int x) { return x * 6; }
+inline int f7205_7(int x) { return x * 7; }
+inline int f7205_8(int x) { return x * 8; }
+inline int f7205_9(int x) { return x * 9; }
+inline int f7205_10(int x) { return x * 10; }
+inline int f7205_11(int x) { return x * 11; }
+inline int f7205_12(int x) { return x * 12; }
+inline int f7205_13(int x) { return x * 13; }
+inline int f7205_14(int x) { return x * 14; }
+inline int f7205_15(int x) { return x * 15; }
+inline int f7205_16(int x) { return x * 16; }
+inline int f7205_17(int x) { return x * 17; }
+inline int f7205_18(int x) { return x * 18; }
+inline int f7205_19(int x) { return x * 19; }
+inline int f7205_20(int x) { return x * 20; }
+inline int f7205_21(int x) { return x * 21; }
+inline int f7205_22(int x) { return x * 22; }
+inline int f7205_23(int x) { return x * 23; }
+inline int f7205_24(int x) { return x * 24; }
+inline int f7205_25(int x) { return x * 25; }
+inline int f7205_26(int x) { return x * 26; }
+inline int f7205_27(int x) { return x * 27; }
+inline int f7205_28(int x) { return x * 28; }
+inline int f7205_29(int x) { return x * 29; }
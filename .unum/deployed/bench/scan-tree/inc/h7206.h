@@ -0,0 +1,42 @@
+#pragma once
+/* header 7206 */
+#include <vector>
+#include "h8508.h"
+#include "h1464.h"
+#include "h5331.h"
+#include "h1922.h"
+#include "h5809.h"
+#ifdef X
+#include "h9098.h"
+#endif
+struct S7206 { int a; const char *s = "x//y"; };
+inline int f7206_0(int x) { return x * 0; }
+inline int f7206_1(int x) { return x * 1; }
+inline int f7206_2(int x) { return x * 2; }
+inline int f7206_3(int x) { return x * 3; }
+inline int f7206_4(int x) { return x * 4; }
+inline int f7206_5(int x) { return x * 5; }
+inline int f7206_6(int x) { return x * 6; }
+inline int f7206_7(int x) { return x * 7; }
+inline int f7206_8(int x) { return x * 8; }
+inline int f7206_9(int x) { return x * 9; }
+inline int f7206_10(int x) { return x * 10; }
+inline int f7206_11(int x) { return x * 11; }
+inline int f7206_12(int x) { return x * 12; }
+inline int f7206_13(int x) { return x * 13; }
+inline int f7206_14(int x) { return x * 14; }
+inline int f7206_15(int x) { return x * 15; }
+inline int f7206_16(int x) { return x * 16; }
+inline int f7206_17(int x) { return x * 17; }
+inline int f7206_18(int x) { return x * 18; }
+inline int f7206_19(int x) { return x * 19; }
+inline int f7206_20(int x) { return x * 20; }
+inline int f7206_21(int x) { return x * 21; }
+inline int f7206_22(int x) { return x * 22; }
+inline int f7206_23(int x) { return x * 23; }
+inline int f7206_24(int x) { return x * 24; }
+inline int f7206_25(int x) { return x * 25; }
+inline int f7206_26(int x) { return x * 26; }
+inline int f7206_27(int x) { return x * 27; }
+inline int f7206_28(int x) { return x * 28; }
+inline int f7206_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7213 */
+#include <vector>
+#include "h5415.h"
+#include "h1262.h"
+#include "h5339.h"
+#include "h8528.h"
+#include "h4932.h"
+#ifdef X
+#include "h9211.h"
+#endif
+struct S7213 { int a; const char *s = "x//y"; };
+inline int f7213_0(int x) { return x * 0; }
+inline int f7213_1(int x) { return x * 1; }
+inline int f7213_2(int x) { return x * 2; }
+inline int f7213_3(int x) { return x * 3; }
+inline int f7213_4(int x) { return x * 4; }
+inline int f7213_5(int x) { return x * 5; }
+inline int f7213_6(int x) { return x * 6; }
+inline int f7213_7(int x) { return x * 7; }
+inline int f7213_8(int x) { return x * 8; }
+inline int f7213_9(int x) { return x * 9; }
+inline int f7213_10(int x) { return x * 10; }
+inline int f7213_11(int x) { return x * 11; }
+inline int f7213_12(int x) { return x * 12; }
+inline int f7213_13(int x) { return x * 13; }
+inline int f7213_14(int x) { return x * 14; }
+inline int f7213_15(int x) { return x * 15; }
+inline int f7213_16(int x) { return x * 16; }
+inline int f7213_17(int x) { return x * 17; }
+inline int f7213_18(int x) { return x * 18; }
+inline int f7213_19(int x) { return x * 19; }
+inline int f7213_20(int x) { return x * 20; }
+inline int f7213_21(int x) { return x * 21; }
+inline int f7213_22(int x) { return x * 22; }
+inline int f7213_23(int x) { return x * 23; }
+inline int f7213_24(int x) { return x * 24; }
+inline int f7213_25(int x) { return x * 25; }
+inline int f7213_26(int x) { return x * 26; }
+inline int f7213_27(int x) { return x * 27; }
+inline int f7213_28(int x) { return x * 28; }
+inline int f7213_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7214 */
+#include <vector>
+#include "h6512.h"
+#include "h5739.h"
+#include "h8987.h"
+#include "h1125.h"
+#include "h2658.h"
+#ifdef X
+#include "h9612.h"
+#endif
+struct S7214 { int a; const char *s = "x//y"; };
+inline int f7214_0(int x) { return x * 0; }
+inline int f7214_1(int x) { return x * 1; }
+inline int f7214_2(int x) { return x * 2; }
+inline int f7214_3(int x) { return x * 3; }
+inline int f7214_4(int x) { return x * 4; }
+inline int f7214_5(int x) { return x * 5; }
+inline int f7214_6(int x) { return x * 6; }
+inline int f7214_7(int x) { return x * 7; }
+inline int f7214_8(int x) { return x * 8; }
+inline int f7214_9(int x) { return x * 9; }
+inline int f7214_10(int x) { return x * 10; }
+inline int f7214_11(int x) { return x * 11; }
+inline int f7214_12(int x) { return x * 12; }
+inline int f7214_13(int x) { return x * 13; }
+inline int f7214_14(int x) { return x * 14; }
+inline int f7214_15(int x) { return x * 15; }
+inline int f7214_16(int x) { return x * 16; }
+inline int f7214_17(int x) { return x * 17; }
+inline int f7214_18(int x) { return x * 18; }
+inline int f7214_19(int x) { return x * 19; }
+inline int f7214_20(int x) { return x * 20; }
+inline int f7214_21(int x) { return x * 21; }
+inline int f7214_22(int x) { return x * 22; }
+inline int f7214_23(int x) { return x * 23; }
+inline int f7214_24(int x) { return x * 24; }
+inline int f7214_25(int x) { return x * 25; }
+inline int f7214_26(int x) { return x * 26; }
+inline int f7214_27(int x) { return x * 27; }
+inline int f7214_28(int x) { return x * 28; }
+inline int f7214_29(int x) { return x * 29; }
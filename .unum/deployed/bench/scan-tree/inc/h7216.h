@@ -0,0 +1,42 @@
+#pragma once
+/* header 7216 */
+#include <vector>
+#include "h780.h"
+#include "h8573.h"
+#include "h6964.h"
+#include "h9401.h"
+#include "h1645.h"
+#ifdef X
+#include "h1037.h"
+#endif
+struct S7216 { int a; const char *s = "x//y"; };
+inline int f7216_0(int x) { return x * 0; }
+inline int f7216_1(int x) { return x * 1; }
+inline int f7216_2(int x) { return x * 2; }
+inline int f7216_3(int x) { return x * 3; }
+inline int f7216_4(int x) { return x * 4; }
+inline int f7216_5(int x) { return x * 5; }
+inline int f7216_6(int x) { return x * 6; }
+inline int f7216_7(int x) { return x * 7; }
+inline int f7216_8(int x) { return x * 8; }
+inline int f7216_9(int x) { return x * 9; }
+inline int f7216_10(int x) { return x * 10; }
+inline int f7216_11(int x) { return x * 11; }
+inline int f7216_12(int x) { return x * 12; }
+inline int f7216_13(int x) { return x * 13; }
+inline int f7216_14(int x) { return x * 14; }
+inline int f7216_15(int x) { return x * 15; }
+inline int f7216_16(int x) { return x * 16; }
+inline int f7216_17(int x) { return x * 17; }
+inline int f7216_18(int x) { return x * 18; }
+inline int f7216_19(int x) { return x * 19; }
+inline int f7216_20(int x) { return x * 20; }
+inline int f7216_21(int x) { return x * 21; }
+inline int f7216_22(int x) { return x * 22; }
+inline int f7216_23(int x) { return x * 23; }
+inline int f7216_24(int x) { return x * 24; }
+inline int f7216_25(int x) { return x * 25; }
+inline int f7216_26(int x) { return x * 26; }
+inline int f7216_27(int x) { return x * 27; }
+inline int f7216_28(int x) { return x * 28; }
+inline int f7216_29(int x) { return x * 29; }
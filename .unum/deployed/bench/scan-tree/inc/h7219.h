@@ -0,0 +1,42 @@
+#pragma once
+/* header 7219 */
+#include <vector>
+#include "h5161.h"
+#include "h7379.h"
+#include "h3908.h"
+#include "h5072.h"
+#include "h7853.h"
+#ifdef X
+#include "h7651.h"
+#endif
+struct S7219 { int a; const char *s = "x//y"; };
+inline int f7219_0(int x) { return x * 0; }
+inline int f7219_1(int x) { return x * 1; }
+inline int f7219_2(int x) { return x * 2; }
+inline int f7219_3(int x) { return x * 3; }
+inline int f7219_4(int x) { return x * 4; }
+inline int f7219_5(int x) { return x * 5; }
+inline int f7219_6(int x) { return x * 6; }
+inline int f7219_7(int x) { return x * 7; }
+inline int f7219_8(int x) { return x * 8; }
+inline int f7219_9(int x) { return x * 9; }
+inline int f7219_10(int x) { return x * 10; }
+inline int f7219_11(int x) { return x * 11; }
+inline int f7219_12(int x) { return x * 12; }
+inline int f7219_13(int x) { return x * 13; }
+inline int f7219_14(int x) { return x * 14; }
+inline int f7219_15(int x) { return x * 15; }
+inline int f7219_16(int x) { return x * 16; }
+inline int f7219_17(int x) { return x * 17; }
+inline int f7219_18(int x) { return x * 18; }
+inline int f7219_19(int x) { return x * 19; }
+inline int f7219_20(int x) { return x * 20; }
+inline int f7219_21(int x) { return x * 21; }
+inline int f7219_22(int x) { return x * 22; }
+inline int f7219_23(int x) { return x * 23; }
+inline int f7219_24(int x) { return x * 24; }
+inline int f7219_25(int x) { return x * 25; }
+inline int f7219_26(int x) { return x * 26; }
+inline int f7219_27(int x) { return x * 27; }
+inline int f7219_28(int x) { return x * 28; }
+inline int f7219_29(int x) { return x * 29; }
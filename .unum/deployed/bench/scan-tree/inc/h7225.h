@@ -0,0 +1,42 @@
+#pragma once
+/* header 7225 */
+#include <vector>
+#include "h3728.h"
+#include "h7396.h"
+#include "h1279.h"
+#include "h8509.h"
+#include "h9300.h"
+#ifdef X
+#include "h6491.h"
+#endif
+struct S7225 { int a; const char *s = "x//y"; };
+inline int f7225_0(int x) { return x * 0; }
+inline int f7225_1(int x) { return x * 1; }
+inline int f7225_2(int x) { return x * 2; }
+inline int f7225_3(int x) { return x * 3; }
+inline int f7225_4(int x) { return x * 4; }
+inline int f7225_5(int x) { return x * 5; }
+inline int f7225_6(int x) { return x * 6; }
+inline int f7225_7(int x) { return x * 7; }
+inline int f7225_8(int x) { return x * 8; }
+inline int f7225_9(int x) { return x * 9; }
+inline int f7225_10(int x) { return x * 10; }
+inline int f7225_11(int x) { return x * 11; }
+inline int f7225_12(int x) { return x * 12; }
+inline int f7225_13(int x) { return x * 13; }
+inline int f7225_14(int x) { return x * 14; }
+inline int f7225_15(int x) { return x * 15; }
+inline int f7225_16(int x) { return x * 16; }
+inline int f7225_17(int x) { return x * 17; }
+inline int f7225_18(int x) { return x * 18; }
+inline int f7225_19(int x) { return x * 19; }
+inline int f7225_20(int x) { return x * 20; }
+inline int f7225_21(int x) { return x * 21; }
+inline int f7225_22(int x) { return x * 22; }
+inline int f7225_23(int x) { return x * 23; }
+inline int f7225_24(int x) { return x * 24; }
+inline int f7225_25(int x) { return x * 25; }
+inline int f7225_26(int x) { return x * 26; }
+inline int f7225_27(int x) { return x * 27; }
+inline int f7225_28(int x) { return x * 28; }
+inline int f7225_29(int x) { return x * 29; }
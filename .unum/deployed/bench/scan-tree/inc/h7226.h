@@ -0,0 +1,42 @@
+#pragma once
+/* header 7226 */
+#include <vector>
+#include "h1156.h"
+#include "h1657.h"
+#include "h2979.h"
+#include "h4320.h"
+#include "h3113.h"
+#ifdef X
+#include "h3782.h"
+#endif
+struct S7226 { int a; const char *s = "x//y"; };
+inline int f7226_0(int x) { return x * 0; }
+inline int f7226_1(int x) { return x * 1; }
+inline int f7226_2(int x) { return x * 2; }
+inline int f7226_3(int x) { return x * 3; }
+inline int f7226_4(int x) { return x * 4; }
+inline int f7226_5(int x) { return x * 5; }
+inline int f7226_6(int x) { return x * 6; }
+inline int f7226_7(int x) { return x * 7; }
+inline int f7226_8(int x) { return x * 8; }
+inline int f7226_9(int x) { return x * 9; }
+inline int f7226_10(int x) { return x * 10; }
+inline int f7226_11(int x) { return x * 11; }
+inline int f7226_12(int x) { return x * 12; }
+inline int f7226_13(int x) { return x * 13; }
+inline int f7226_14(int x) { return x * 14; }
+inline int f7226_15(int x) { return x * 15; }
+inline int f7226_16(int x) { return x * 16; }
+inline int f7226_17(int x) { return x * 17; }
+inline int f7226_18(int x) { return x * 18; }
+inline int f7226_19(int x) { return x * 19; }
+inline int f7226_20(int x) { return x * 20; }
+inline int f7226_21(int x) { return x * 21; }
+inline int f7226_22(int x) { return x * 22; }
+inline int f7226_23(int x) { return x * 23; }
+inline int f7226_24(int x) { return x * 24; }
+inline int f7226_25(int x) { return x * 25; }
+inline int f7226_26(int x) { return x * 26; }
+inline int f7226_27(int x) { return x * 27; }
+inline int f7226_28(int x) { return x * 28; }
+inline int f7226_29(int x) { return x * 29; }
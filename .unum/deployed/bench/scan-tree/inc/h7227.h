@@ -0,0 +1,42 @@
+#pragma once
+/* header 7227 */
+#include <vector>
+#include "h8132.h"
+#include "h6146.h"
+#include "h4150.h"
+#include "h8151.h"
+#include "h6531.h"
+#ifdef X
+#include "h1083.h"
+#endif
+struct S7227 { int a; const char *s = "x//y"; };
+inline int f7227_0(int x) { return x * 0; }
+inline int f7227_1(int x) { return x * 1; }
+inline int f7227_2(int x) { return x * 2; }
+inline int f7227_3(int x) { return x * 3; }
+inline int f7227_4(int x) { return x * 4; }
+inline int f7227_5(int x) { return x * 5; }
+inline int f7227_6(int x) { return x * 6; }
+inline int f7227_7(int x) { return x * 7; }
+inline int f7227_8(int x) { return x * 8; }
+inline int f7227_9(int x) { return x * 9; }
+inline int f7227_10(int x) { return x * 10; }
+inline int f7227_11(int x) { return x * 11; }
+inline int f7227_12(int x) { return x * 12; }
+inline int f7227_13(int x) { return x * 13; }
+inline int f7227_14(int x) { return x * 14; }
+inline int f7227_15(int x) { return x * 15; }
+inline int f7227_16(int x) { return x * 16; }
+inline int f7227_17(int x) { return x * 17; }
+inline int f7227_18(int x) { return x * 18; }
+inline int f7227_19(int x) { return x * 19; }
+inline int f7227_20(int x) { return x * 20; }
+inline int f7227_21(int x) { return x * 21; }
+inline int f7227_22(int x) { return x * 22; }
+inline int f7227_23(int x) { return x * 23; }
+inline int f7227_24(int x) { return x * 24; }
+inline int f7227_25(int x) { return x * 25; }
+inline int f7227_26(int x) { return x * 26; }
+inline int f7227_27(int x) { return x * 27; }
+inline int f7227_28(int x) { return x * 28; }
+inline int f7227_29(int x) { return x * 29; }
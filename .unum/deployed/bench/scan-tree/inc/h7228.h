@@ -0,0 +1,42 @@
+#pragma once
+/* header 7228 */
+#include <vector>
+#include "h6318.h"
+#include "h1395.h"
+#include "h9849.h"
+#include "h5881.h"
+#include "h2227.h"
+#ifdef X
+#include "h5881.h"
+#endif
+struct S7228 { int a; const char *s = "x//y"; };
+inline int f7228_0(int x) { return x * 0; }
+inline int f7228_1(int x) { return x * 1; }
+inline int f7228_2(int x) { return x * 2; }
+inline int f7228_3(int x) { return x * 3; }
+inline int f7228_4(int x) { return x * 4; }
+inline int f7228_5(int x) { return x * 5; }
+inline int f7228_6(int x) { return x * 6; }
+inline int f7228_7(int x) { return x * 7; }
+inline int f7228_8(int x) { return x * 8; }
+inline int f7228_9(int x) { return x * 9; }
+inline int f7228_10(int x) { return x * 10; }
+inline int f7228_11(int x) { return x * 11; }
+inline int f7228_12(int x) { return x * 12; }
+inline int f7228_13(int x) { return x * 13; }
+inline int f7228_14(int x) { return x * 14; }
+inline int f7228_15(int x) { return x * 15; }
+inline int f7228_16(int x) { return x * 16; }
+inline int f7228_17(int x) { return x * 17; }
+inline int f7228_18(int x) { return x * 18; }
+inline int f7228_19(int x) { return x * 19; }
+inline int f7228_20(int x) { return x * 20; }
+inline int f7228_21(int x) { return x * 21; }
+inline int f7228_22(int x) { return x * 22; }
+inline int f7228_23(int x) { return x * 23; }
+inline int f7228_24(int x) { return x * 24; }
+inline int f7228_25(int x) { return x * 25; }
+inline int f7228_26(int x) { return x * 26; }
+inline int f7228_27(int x) { return x * 27; }
+inline int f7228_28(int x) { return x * 28; }
+inline int f7228_29(int x) { return x * 29; }
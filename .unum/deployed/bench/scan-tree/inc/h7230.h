@@ -0,0 +1,42 @@
+#pragma once
+/* header 7230 */
+#include <vector>
+#include "h3573.h"
+#include "h7746.h"
+#include "h9143.h"
+#include "h3592.h"
+#include "h8911.h"
+#ifdef X
+#include "h4958.h"
+#endif
+struct S7230 { int a; const char *s = "x//y"; };
+inline int f7230_0(int x) { return x * 0; }
+inline int f7230_1(int x) { return x * 1; }
+inline int f7230_2(int x) { return x * 2; }
+inline int f7230_3(int x) { return x * 3; }
+inline int f7230_4(int x) { return x * 4; }
+inline int f7230_5(int x) { return x * 5; }
+inline int f7230_6(int x) { return x * 6; }
+inline int f7230_7(int x) { return x * 7; }
+inline int f7230_8(int x) { return x * 8; }
+inline int f7230_9(int x) { return x * 9; }
+inline int f7230_10(int x) { return x * 10; }
+inline int f7230_11(int x) { return x * 11; }
+inline int f7230_12(int x) { return x * 12; }
+inline int f7230_13(int x) { return x * 13; }
+inline int f7230_14(int x) { return x * 14; }
+inline int f7230_15(int x) { return x * 15; }
+inline int f7230_16(int x) { return x * 16; }
+inline int f7230_17(int x) { return x * 17; }
+inline int f7230_18(int x) { return x * 18; }
+inline int f7230_19(int x) { return x * 19; }
+inline int f7230_20(int x) { return x * 20; }
+inline int f7230_21(int x) { return x * 21; }
+inline int f7230_22(int x) { return x * 22; }
+inline int f7230_23(int x) { return x * 23; }
+inline int f7230_24(int x) { return x * 24; }
+inline int f7230_25(int x) { return x * 25; }
+inline int f7230_26(int x) { return x * 26; }
+inline int f7230_27(int x) { return x * 27; }
+inline int f7230_28(int x) { return x * 28; }
+inline int f7230_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7231 */
+#include <vector>
+#include "h1174.h"
+#include "h7729.h"
+#include "h3987.h"
+#include "h7721.h"
+#include "h6005.h"
+#ifdef X
+#include "h8184.h"
+#endif
+struct S7231 { int a; const char *s = "x//y"; };
+inline int f7231_0(int x) { return x * 0; }
+inline int f7231_1(int x) { return x * 1; }
+inline int f7231_2(int x) { return x * 2; }
+inline int f7231_3(int x) { return x * 3; }
+inline int f7231_4(int x) { return x * 4; }
+inline int f7231_5(int x) { return x * 5; }
+inline int f7231_6(int x) { return x * 6; }
+inline int f7231_7(int x) { return x * 7; }
+inline int f7231_8(int x) { return x * 8; }
+inline int f7231_9(int x) { return x * 9; }
+inline int f7231_10(int x) { return x * 10; }
+inline int f7231_11(int x) { return x * 11; }
+inline int f7231_12(int x) { return x * 12; }
+inline int f7231_13(int x) { return x * 13; }
+inline int f7231_14(int x) { return x * 14; }
+inline int f7231_15(int x) { return x * 15; }
+inline int f7231_16(int x) { return x * 16; }
+inline int f7231_17(int x) { return x * 17; }
+inline int f7231_18(int x) { return x * 18; }
+inline int f7231_19(int x) { return x * 19; }
+inline int f7231_20(int x) { return x * 20; }
+inline int f7231_21(int x) { return x * 21; }
+inline int f7231_22(int x) { return x * 22; }
+inline int f7231_23(int x) { return x * 23; }
+inline int f7231_24(int x) { return x * 24; }
+inline int f7231_25(int x) { return x * 25; }
+inline int f7231_26(int x) { return x * 26; }
+inline int f7231_27(int x) { return x * 27; }
+inline int f7231_28(int x) { return x * 28; }
+inline int f7231_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7232 */
+#include <vector>
+#include "h6628.h"
+#include "h9837.h"
+#include "h1732.h"
+#include "h320.h"
+#include "h3685.h"
+#ifdef X
+#include "h2808.h"
+#endif
+struct S7232 { int a; const char *s = "x//y"; };
+inline int f7232_0(int x) { return x * 0; }
+inline int f7232_1(int x) { return x * 1; }
+inline int f7232_2(int x) { return x * 2; }
+inline int f7232_3(int x) { return x * 3; }
+inline int f7232_4(int x) { return x * 4; }
+inline int f7232_5(int x) { return x * 5; }
+inline int f7232_6(int x) { return x * 6; }
+inline int f7232_7(int x) { return x * 7; }
+inline int f7232_8(int x) { return x * 8; }
+inline int f7232_9(int x) { return x * 9; }
+inline int f7232_10(int x) { return x * 10; }
+inline int f7232_11(int x) { return x * 11; }
+inline int f7232_12(int x) { return x * 12; }
+inline int f7232_13(int x) { return x * 13; }
+inline int f7232_14(int x) { return x * 14; }
+inline int f7232_15(int x) { return x * 15; }
+inline int f7232_16(int x) { return x * 16; }
+inline int f7232_17(int x) { return x * 17; }
+inline int f7232_18(int x) { return x * 18; }
+inline int f7232_19(int x) { return x * 19; }
+inline int f7232_20(int x) { return x * 20; }
+inline int f7232_21(int x) { return x * 21; }
+inline int f7232_22(int x) { return x * 22; }
+inline int f7232_23(int x) { return x * 23; }
+inline int f7232_24(int x) { return x * 24; }
+inline int f7232_25(int x) { return x * 25; }
+inline int f7232_26(int x) { return x * 26; }
+inline int f7232_27(int x) { return x * 27; }
+inline int f7232_28(int x) { return x * 28; }
+inline int f7232_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7236 */
+#include <vector>
+#include "h7312.h"
+#include "h5946.h"
+#include "h5823.h"
+#include "h3259.h"
+#include "h5469.h"
+#ifdef X
+#include "h1824.h"
+#endif
+struct S7236 { int a; const char *s = "x//y"; };
+inline int f7236_0(int x) { return x * 0; }
+inline int f7236_1(int x) { return x * 1; }
+inline int f7236_2(int x) { return x * 2; }
+inline int f7236_3(int x) { return x * 3; }
+inline int f7236_4(int x) { return x * 4; }
+inline int f7236_5(int x) { return x * 5; }
+inline int f7236_6(int x) { return x * 6; }
+inline int f7236_7(int x) { return x * 7; }
+inline int f7236_8(int x) { return x * 8; }
+inline int f7236_9(int x) { return x * 9; }
+inline int f7236_10(int x) { return x * 10; }
+inline int f7236_11(int x) { return x * 11; }
+inline int f7236_12(int x) { return x * 12; }
+inline int f7236_13(int x) { return x * 13; }
+inline int f7236_14(int x) { return x * 14; }
+inline int f7236_15(int x) { return x * 15; }
+inline int f7236_16(int x) { return x * 16; }
+inline int f7236_17(int x) { return x * 17; }
+inline int f7236_18(int x) { return x * 18; }
+inline int f7236_19(int x) { return x * 19; }
+inline int f7236_20(int x) { return x * 20; }
+inline int f7236_21(int x) { return x * 21; }
+inline int f7236_22(int x) { return x * 22; }
+inline int f7236_23(int x) { return x * 23; }
+inline int f7236_24(int x) { return x * 24; }
+inline int f7236_25(int x) { return x * 25; }
+inline int f7236_26(int x) { return x * 26; }
+inline int f7236_27(int x) { return x * 27; }
+inline int f7236_28(int x) { return x * 28; }
+inline int f7236_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7238 */
+#include <vector>
+#include "h5740.h"
+#include "h4532.h"
+#include "h3215.h"
+#include "h2362.h"
+#include "h2314.h"
+#ifdef X
+#include "h6759.h"
+#endif
+struct S7238 { int a; const char *s = "x//y"; };
+inline int f7238_0(int x) { return x * 0; }
+inline int f7238_1(int x) { return x * 1; }
+inline int f7238_2(int x) { return x * 2; }
+inline int f7238_3(int x) { return x * 3; }
+inline int f7238_4(int x) { return x * 4; }
+inline int f7238_5(int x) { return x * 5; }
+inline int f7238_6(int x) { return x * 6; }
+inline int f7238_7(int x) { return x * 7; }
+inline int f7238_8(int x) { return x * 8; }
+inline int f7238_9(int x) { return x * 9; }
+inline int f7238_10(int x) { return x * 10; }
+inline int f7238_11(int x) { return x * 11; }
+inline int f7238_12(int x) { return x * 12; }
+inline int f7238_13(int x) { return x * 13; }
+inline int f7238_14(int x) { return x * 14; }
+inline int f7238_15(int x) { return x * 15; }
+inline int f7238_16(int x) { return x * 16; }
+inline int f7238_17(int x) { return x * 17; }
+inline int f7238_18(int x) { return x * 18; }
+inline int f7238_19(int x) { return x * 19; }
+inline int f7238_20(int x) { return x * 20; }
+inline int f7238_21(int x) { return x * 21; }
+inline int f7238_22(int x) { return x * 22; }
+inline int f7238_23(int x) { return x * 23; }
+inline int f7238_24(int x) { return x * 24; }
+inline int f7238_25(int x) { return x * 25; }
+inline int f7238_26(int x) { return x * 26; }
+inline int f7238_27(int x) { return x * 27; }
+inline int f7238_28(int x) { return x * 28; }
+inline int f7238_29(int x) { return x * 29; }
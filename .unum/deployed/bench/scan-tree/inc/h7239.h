@@ -0,0 +1,42 @@
+#pragma once
+/* header 7239 */
+#include <vector>
+#include "h5781.h"
+#include "h539.h"
+#include "h493.h"
+#include "h4859.h"
+#include "h7969.h"
+#ifdef X
+#include "h3054.h"
+#endif
+struct S7239 { int a; const char *s = "x//y"; };
+inline int f7239_0(int x) { return x * 0; }
+inline int f7239_1(int x) { return x * 1; }
+inline int f7239_2(int x) { return x * 2; }
+inline int f7239_3(int x) { return x * 3; }
+inline int f7239_4(int x) { return x * 4; }
+inline int f7239_5(int x) { return x * 5; }
+inline int f7239_6(int x) { return x * 6; }
+inline int f7239_7(int x) { return x * 7; }
+inline int f7239_8(int x) { return x * 8; }
+inline int f7239_9(int x) { return x * 9; }
+inline int f7239_10(int x) { return x * 10; }
+inline int f7239_11(int x) { return x * 11; }
+inline int f7239_12(int x) { return x * 12; }
+inline int f7239_13(int x) { return x * 13; }
+inline int f7239_14(int x) { return x * 14; }
+inline int f7239_15(int x) { return x * 15; }
+inline int f7239_16(int x) { return x * 16; }
+inline int f7239_17(int x) { return x * 17; }
+inline int f7239_18(int x) { return x * 18; }
+inline int f7239_19(int x) { return x * 19; }
+inline int f7239_20(int x) { return x * 20; }
+inline int f7239_21(int x) { return x * 21; }
+inline int f7239_22(int x) { return x * 22; }
+inline int f7239_23(int x) { return x * 23; }
+inline int f7239_24(int x) { return x * 24; }
+inline int f7239_25(int x) { return x * 25; }
+inline int f7239_26(int x) { return x * 26; }
+inline int f7239_27(int x) { return x * 27; }
+inline int f7239_28(int x) { return x * 28; }
+inline int f7239_29(int x) { return x * 29; }
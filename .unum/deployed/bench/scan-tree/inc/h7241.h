@@ -0,0 +1,42 @@
+#pragma once
+/* header 7241 */
+#include <vector>
+#include "h284.h"
+#include "h9724.h"
+#include "h6978.h"
+#include "h977.h"
+#include "h4582.h"
+#ifdef X
+#include "h8845.h"
+#endif
+struct S7241 { int a; const char *s = "x//y"; };
+inline int f7241_0(int x) { return x * 0; }
+inline int f7241_1(int x) { return x * 1; }
+inline int f7241_2(int x) { return x * 2; }
+inline int f7241_3(int x) { return x * 3; }
+inline int f7241_4(int x) { return x * 4; }
+inline int f7241_5(int x) { return x * 5; }
+inline int f7241_6(int x) { return x * 6; }
+inline int f7241_7(int x) { return x * 7; }
+inline int f7241_8(int x) { return x * 8; }
+inline int f7241_9(int x) { return x * 9; }
+inline int f7241_10(int x) { return x * 10; }
+inline int f7241_11(int x) { return x * 11; }
+inline int f7241_12(int x) { return x * 12; }
+inline int f7241_13(int x) { return x * 13; }
+inline int f7241_14(int x) { return x * 14; }
+inline int f7241_15(int x) { return x * 15; }
+inline int f7241_16(int x) { return x * 16; }
+inline int f7241_17(int x) { return x * 17; }
+inline int f7241_18(int x) { return x * 18; }
+inline int f7241_19(int x) { return x * 19; }
+inline int f7241_20(int x) { return x * 20; }
+inline int f7241_21(int x) { return x * 21; }
+inline int f7241_22(int x) { return x * 22; }
+inline int f7241_23(int x) { return x * 23; }
+inline int f7241_24(int x) { return x * 24; }
+inline int f7241_25(int x) { return x * 25; }
+inline int f7241_26(int x) { return x * 26; }
+inline int f7241_27(int x) { return x * 27; }
+inline int f7241_28(int x) { return x * 28; }
+inline int f7241_29(int x) { return x * 29; }
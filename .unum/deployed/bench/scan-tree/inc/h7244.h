@@ -0,0 +1,42 @@
+#pragma once
+/* header 7244 */
+#include <vector>
+#include "h4525.h"
+#include "h7203.h"
+#include "h9329.h"
+#include "h3103.h"
+#include "h3798.h"
+#ifdef X
+#include "h9632.h"
+#endif
+struct S7244 { int a; const char *s = "x//y"; };
+inline int f7244_0(int x) { return x * 0; }
+inline int f7244_1(int x) { return x * 1; }
+inline int f7244_2(int x) { return x * 2; }
+inline int f7244_3(int x) { return x * 3; }
+inline int f7244_4(int x) { return x * 4; }
+inline int f7244_5(int x) { return x * 5; }
+inline int f7244_6(int x) { return x * 6; }
+inline int f7244_7(int x) { return x * 7; }
+inline int f7244_8(int x) { return x * 8; }
+inline int f7244_9(int x) { return x * 9; }
+inline int f7244_10(int x) { return x * 10; }
+inline int f7244_11(int x) { return x * 11; }
+inline int f7244_12(int x) { return x * 12; }
+inline int f7244_13(int x) { return x * 13; }
+inline int f7244_14(int x) { return x * 14; }
+inline int f7244_15(int x) { return x * 15; }
+inline int f7244_16(int x) { return x * 16; }
+inline int f7244_17(int x) { return x * 17; }
+inline int f7244_18(int x) { return x * 18; }
+inline int f7244_19(int x) { return x * 19; }
+inline int f7244_20(int x) { return x * 20; }
+inline int f7244_21(int x) { return x * 21; }
+inline int f7244_22(int x) { return x * 22; }
+inline int f7244_23(int x) { return x * 23; }
+inline int f7244_24(int x) { return x * 24; }
+inline int f7244_25(int x) { return x * 25; }
+inline int f7244_26(int x) { return x * 26; }
+inline int f7244_27(int x) { return x * 27; }
+inline int f7244_28(int x) { return x * 28; }
+inline int f7244_29(int x) { return x * 29; }
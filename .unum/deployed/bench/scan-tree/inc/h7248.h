@@ -0,0 +1,42 @@
+#pragma once
+/* header 7248 */
+#include <vector>
+#include "h8280.h"
+#include "h7320.h"
+#include "h8839.h"
+#include "h8595.h"
+#include "h7502.h"
+#ifdef X
+#include "h64.h"
+#endif
+struct S7248 { int a; const char *s = "x//y"; };
+inline int f7248_0(int x) { return x * 0; }
+inline int f7248_1(int x) { return x * 1; }
+inline int f7248_2(int x) { return x * 2; }
+inline int f7248_3(int x) { return x * 3; }
+inline int f7248_4(int x) { return x * 4; }
+inline int f7248_5(int x) { return x * 5; }
+inline int f7248_6(int x) { return x * 6; }
+inline int f7248_7(int x) { return x * 7; }
+inline int f7248_8(int x) { return x * 8; }
+inline int f7248_9(int x) { return x * 9; }
+inline int f7248_10(int x) { return x * 10; }
+inline int f7248_11(int x) { return x * 11; }
+inline int f7248_12(int x) { return x * 12; }
+inline int f7248_13(int x) { return x * 13; }
+inline int f7248_14(int x) { return x * 14; }
+inline int f7248_15(int x) { return x * 15; }
+inline int f7248_16(int x) { return x * 16; }
+inline int f7248_17(int x) { return x * 17; }
+inline int f7248_18(int x) { return x * 18; }
+inline int f7248_19(int x) { return x * 19; }
+inline int f7248_20(int x) { return x * 20; }
+inline int f7248_21(int x) { return x * 21; }
+inline int f7248_22(int x) { return x * 22; }
+inline int f7248_23(int x) { return x * 23; }
+inline int f7248_24(int x) { return x * 24; }
+inline int f7248_25(int x) { return x * 25; }
+inline int f7248_26(int x) { return x * 26; }
+inline int f7248_27(int x) { return x * 27; }
+inline int f7248_28(int x) { return x * 28; }
+inline int f7248_29(int x) { return x * 29; }
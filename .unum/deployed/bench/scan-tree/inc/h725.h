@@ -0,0 +1,42 @@
+#pragma once
+/* header 725 */
+#include <vector>
+#include "h6234.h"
+#include "h3005.h"
+#include "h7997.h"
+#include "h911.h"
+#include "h9977.h"
+#ifdef X
+#include "h2944.h"
+#endif
+struct S725 { int a; const char *s = "x//y"; };
+inline int f725_0(int x) { return x * 0; }
+inline int f725_1(int x) { return x * 1; }
+inline int f725_2(int x) { return x * 2; }
+inline int f725_3(int x) { return x * 3; }
+inline int f725_4(int x) { return x * 4; }
+inline int f725_5(int x) { return x * 5; }
+inline int f725_6(int x) { return x * 6; }
+inline int f725_7(int x) { return x * 7; }
+inline int f725_8(int x) { return x * 8; }
+inline int f725_9(int x) { return x * 9; }
+inline int f725_10(int x) { return x * 10; }
+inline int f725_11(int x) { return x * 11; }
+inline int f725_12(int x) { return x * 12; }
+inline int f725_13(int x) { return x * 13; }
+inline int f725_14(int x) { return x * 14; }
+inline int f725_15(int x) { return x * 15; }
+inline int f725_16(int x) { return x * 16; }
+inline int f725_17(int x) { return x * 17; }
+inline int f725_18(int x) { return x * 18; }
+inline int f725_19(int x) { return x * 19; }
+inline int f725_20(int x) { return x * 20; }
+inline int f725_21(int x) { return x * 21; }
+inline int f725_22(int x) { return x * 22; }
+inline int f725_23(int x) { return x * 23; }
+inline int f725_24(int x) { return x * 24; }
+inline int f725_25(int x) { return x * 25; }
+inline int f725_26(int x) { return x * 26; }
+inline int f725_27(int x) { return x * 27; }
+inline int f725_28(int x) { return x * 28; }
+inline int f725_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7250 */
+#include <vector>
+#include "h8324.h"
+#include "h5278.h"
+#include "h7019.h"
+#include "h5521.h"
+#include "h4970.h"
+#ifdef X
+#include "h9443.h"
+#endif
+struct S7250 { int a; const char *s = "x//y"; };
+inline int f7250_0(int x) { return x * 0; }
+inline int f7250_1(int x) { return x * 1; }
+inline int f7250_2(int x) { return x * 2; }
+inline int f7250_3(int x) { return x * 3; }
+inline int f7250_4(int x) { return x * 4; }
+inline int f7250_5(int x) { return x * 5; }
+inline int f7250_6(int x) { return x * 6; }
+inline int f7250_7(int x) { return x * 7; }
+inline int f7250_8(int x) { return x * 8; }
+inline int f7250_9(int x) { return x * 9; }
+inline int f7250_10(int x) { return x * 10; }
+inline int f7250_11(int x) { return x * 11; }
+inline int f7250_12(int x) { return x * 12; }
+inline int f7250_13(int x) { return x * 13; }
+inline int f7250_14(int x) { return x * 14; }
+inline int f7250_15(int x) { return x * 15; }
+inline int f7250_16(int x) { return x * 16; }
+inline int f7250_17(int x) { return x * 17; }
+inline int f7250_18(int x) { return x * 18; }
+inline int f7250_19(int x) { return x * 19; }
+inline int f7250_20(int x) { return x * 20; }
+inline int f7250_21(int x) { return x * 21; }
+inline int f7250_22(int x) { return x * 22; }
+inline int f7250_23(int x) { return x * 23; }
+inline int f7250_24(int x) { return x * 24; }
+inline int f7250_25(int x) { return x * 25; }
+inline int f7250_26(int x) { return x * 26; }
+inline int f7250_27(int x) { return x * 27; }
+inline int f7250_28(int x) { return x * 28; }
+inline int f7250_29(int x) { return x * 29; }
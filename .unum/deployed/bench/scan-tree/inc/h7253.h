@@ -0,0 +1,42 @@
+#pragma once
+/* header 7253 */
+#include <vector>
+#include "h9064.h"
+#include "h7006.h"
+#include "h5564.h"
+#include "h1819.h"
+#include "h2789.h"
+#ifdef X
+#include "h490.h"
+#endif
+struct S7253 { int a; const char *s = "x//y"; };
+inline int f7253_0(int x) { return x * 0; }
+inline int f7253_1(int x) { return x * 1; }
+inline int f7253_2(int x) { return x * 2; }
+inline int f7253_3(int x) { return x * 3; }
+inline int f7253_4(int x) { return x * 4; }
+inline int f7253_5(int x) { return x * 5; }
+inline int f7253_6(int x) { return x * 6; }
+inline int f7253_7(int x) { return x * 7; }
+inline int f7253_8(int x) { return x * 8; }
+inline int f7253_9(int x) { return x * 9; }
+inline int f7253_10(int x) { return x * 10; }
+inline int f7253_11(int x) { return x * 11; }
+inline int f7253_12(int x) { return x * 12; }
+inline int f7253_13(int x) { return x * 13; }
+inline int f7253_14(int x) { return x * 14; }
+inline int f7253_15(int x) { return x * 15; }
+inline int f7253_16(int x) { return x * 16; }
+inline int f7253_17(int x) { return x * 17; }
+inline int f7253_18(int x) { return x * 18; }
+inline int f7253_19(int x) { return x * 19; }
+inline int f7253_20(int x) { return x * 20; }
+inline int f7253_21(int x) { return x * 21; }
+inline int f7253_22(int x) { return x * 22; }
+inline int f7253_23(int x) { return x * 23; }
+inline int f7253_24(int x) { return x * 24; }
+inline int f7253_25(int x) { return x * 25; }
+inline int f7253_26(int x) { return x * 26; }
+inline int f7253_27(int x) { return x * 27; }
+inline int f7253_28(int x) { return x * 28; }
+inline int f7253_29(int x) { return x * 29; }
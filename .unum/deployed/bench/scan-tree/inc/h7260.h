@@ -0,0 +1,42 @@
+#pragma once
+/* header 7260 */
+#include <vector>
+#include "h4225.h"
+#include "h2237.h"
+#include "h968.h"
+#include "h2982.h"
+#include "h7115.h"
+#ifdef X
+#include "h3577.h"
+#endif
+struct S7260 { int a; const char *s = "x//y"; };
+inline int f7260_0(int x) { return x * 0; }
+inline int f7260_1(int x) { return x * 1; }
+inline int f7260_2(int x) { return x * 2; }
+inline int f7260_3(int x) { return x * 3; }
+inline int f7260_4(int x) { return x * 4; }
+inline int f7260_5(int x) { return x * 5; }
+inline int f7260_6(int x) { return x * 6; }
+inline int f7260_7(int x) { return x * 7; }
+inline int f7260_8(int x) { return x * 8; }
+inline int f7260_9(int x) { return x * 9; }
+inline int f7260_10(int x) { return x * 10; }
+inline int f7260_11(int x) { return x * 11; }
+inline int f7260_12(int x) { return x * 12; }
+inline int f7260_13(int x) { return x * 13; }
+inline int f7260_14(int x) { return x * 14; }
+inline int f7260_15(int x) { return x * 15; }
+inline int f7260_16(int x) { return x * 16; }
+inline int f7260_17(int x) { return x * 17; }
+inline int f7260_18(int x) { return x * 18; }
+inline int f7260_19(int x) { return x * 19; }
+inline int f7260_20(int x) { return x * 20; }
+inline int f7260_21(int x) { return x * 21; }
+inline int f7260_22(int x) { return x * 22; }
+inline int f7260_23(int x) { return x * 23; }
+inline int f7260_24(int x) { return x * 24; }
+inline int f7260_25(int x) { return x * 25; }
+inline int f7260_26(int x) { return x * 26; }
+inline int f7260_27(int x) { return x * 27; }
+inline int f7260_28(int x) { return x * 28; }
+inline int f7260_29(int x) { return x * 29; }
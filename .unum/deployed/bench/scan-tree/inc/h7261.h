@@ -0,0 +1,42 @@
+#pragma once
+/* header 7261 */
+#include <vector>
+#include "h4200.h"
+#include "h9114.h"
+#include "h6890.h"
+#include "h9709.h"
+#include "h1453.h"
+#ifdef X
+#include "h4069.h"
+#endif
+struct S7261 { int a; const char *s = "x//y"; };
+inline int f7261_0(int x) { return x * 0; }
+inline int f7261_1(int x) { return x * 1; }
+inline int f7261_2(int x) { return x * 2; }
+inline int f7261_3(int x) { return x * 3; }
+inline int f7261_4(int x) { return x * 4; }
+inline int f7261_5(int x) { return x * 5; }
+inline int f7261_6(int x) { return x * 6; }
+inline int f7261_7(int x) { return x * 7; }
+inline int f7261_8(int x) { return x * 8; }
+inline int f7261_9(int x) { return x * 9; }
+inline int f7261_10(int x) { return x * 10; }
+inline int f7261_11(int x) { return x * 11; }
+inline int f7261_12(int x) { return x * 12; }
+inline int f7261_13(int x) { return x * 13; }
+inline int f7261_14(int x) { return x * 14; }
+inline int f7261_15(int x) { return x * 15; }
+inline int f7261_16(int x) { return x * 16; }
+inline int f7261_17(int x) { return x * 17; }
+inline int f7261_18(int x) { return x * 18; }
+inline int f7261_19(int x) { return x * 19; }
+inline int f7261_20(int x) { return x * 20; }
+inline int f7261_21(int x) { return x * 21; }
+inline int f7261_22(int x) { return x * 22; }
+inline int f7261_23(int x) { return x * 23; }
+inline int f7261_24(int x) { return x * 24; }
+inline int f7261_25(int x) { return x * 25; }
+inline int f7261_26(int x) { return x * 26; }
+inline int f7261_27(int x) { return x * 27; }
+inline int f7261_28(int x) { return x * 28; }
+inline int f7261_29(int x) { return x * 29; }
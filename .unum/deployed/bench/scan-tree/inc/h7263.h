@@ -0,0 +1,42 @@
+#pragma once
+/* header 7263 */
+#include <vector>
+#include "h8192.h"
+#include "h5846.h"
+#include "h7995.h"
+#include "h604.h"
+#include "h9129.h"
+#ifdef X
+#include "h2458.h"
+#endif
+struct S7263 { int a; const char *s = "x//y"; };
+inline int f7263_0(int x) { return x * 0; }
+inline int f7263_1(int x) { return x * 1; }
+inline int f7263_2(int x) { return x * 2; }
+inline int f7263_3(int x) { return x * 3; }
+inline int f7263_4(int x) { return x * 4; }
+inline int f7263_5(int x) { return x * 5; }
+inline int f7263_6(int x) { return x * 6; }
+inline int f7263_7(int x) { return x * 7; }
+inline int f7263_8(int x) { return x * 8; }
+inline int f7263_9(int x) { return x * 9; }
+inline int f7263_10(int x) { return x * 10; }
+inline int f7263_11(int x) { return x * 11; }
+inline int f7263_12(int x) { return x * 12; }
+inline int f7263_13(int x) { return x * 13; }
+inline int f7263_14(int x) { return x * 14; }
+inline int f7263_15(int x) { return x * 15; }
+inline int f7263_16(int x) { return x * 16; }
+inline int f7263_17(int x) { return x * 17; }
+inline int f7263_18(int x) { return x * 18; }
+inline int f7263_19(int x) { return x * 19; }
+inline int f7263_20(int x) { return x * 20; }
+inline int f7263_21(int x) { return x * 21; }
+inline int f7263_22(int x) { return x * 22; }
+inline int f7263_23(int x) { return x * 23; }
+inline int f7263_24(int x) { return x * 24; }
+inline int f7263_25(int x) { return x * 25; }
+inline int f7263_26(int x) { return x * 26; }
+inline int f7263_27(int x) { return x * 27; }
+inline int f7263_28(int x) { return x * 28; }
+inline int f7263_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7264 */
+#include <vector>
+#include "h8392.h"
+#include "h8860.h"
+#include "h8754.h"
+#include "h4976.h"
+#include "h5668.h"
+#ifdef X
+#include "h7197.h"
+#endif
+struct S7264 { int a; const char *s = "x//y"; };
+inline int f7264_0(int x) { return x * 0; }
+inline int f7264_1(int x) { return x * 1; }
+inline int f7264_2(int x) { return x * 2; }
+inline int f7264_3(int x) { return x * 3; }
+inline int f7264_4(int x) { return x * 4; }
+inline int f7264_5(int x) { return x * 5; }
+inline int f7264_6(int x) { return x * 6; }
+inline int f7264_7(int x) { return x * 7; }
+inline int f7264_8(int x) { return x * 8; }
+inline int f7264_9(int x) { return x * 9; }
+inline int f7264_10(int x) { return x * 10; }
+inline int f7264_11(int x) { return x * 11; }
+inline int f7264_12(int x) { return x * 12; }
+inline int f7264_13(int x) { return x * 13; }
+inline int f7264_14(int x) { return x * 14; }
+inline int f7264_15(int x) { return x * 15; }
+inline int f7264_16(int x) { return x * 16; }
+inline int f7264_17(int x) { return x * 17; }
+inline int f7264_18(int x) { return x * 18; }
+inline int f7264_19(int x) { return x * 19; }
+inline int f7264_20(int x) { return x * 20; }
+inline int f7264_21(int x) { return x * 21; }
+inline int f7264_22(int x) { return x * 22; }
+inline int f7264_23(int x) { return x * 23; }
+inline int f7264_24(int x) { return x * 24; }
+inline int f7264_25(int x) { return x * 25; }
+inline int f7264_26(int x) { return x * 26; }
+inline int f7264_27(int x) { return x * 27; }
+inline int f7264_28(int x) { return x * 28; }
+inline int f7264_29(int x) { return x * 29; }
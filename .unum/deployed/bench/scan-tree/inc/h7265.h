@@ -0,0 +1,42 @@
+#pragma once
+/* header 7265 */
+#include <vector>
+#include "h2477.h"
+#include "h6416.h"
+#include "h3183.h"
+#include "h2818.h"
+#include "h2234.h"
+#ifdef X
+#include "h9625.h"
+#endif
+struct S7265 { int a; const char *s = "x//y"; };
+inline int f7265_0(int x) { return x * 0; }
+inline int f7265_1(int x) { return x * 1; }
+inline int f7265_2(int x) { return x * 2; }
+inline int f7265_3(int x) { return x * 3; }
+inline int f7265_4(int x) { return x * 4; }
+inline int f7265_5(int x) { return x * 5; }
+inline int f7265_6(int x) { return x * 6; }
+inline int f7265_7(int x) { return x * 7; }
+inline int f7265_8(int x) { return x * 8; }
+inline int f7265_9(int x) { return x * 9; }
+inline int f7265_10(int x) { return x * 10; }
+inline int f7265_11(int x) { return x * 11; }
+inline int f7265_12(int x) { return x * 12; }
+inline int f7265_13(int x) { return x * 13; }
+inline int f7265_14(int x) { return x * 14; }
+inline int f7265_15(int x) { return x * 15; }
+inline int f7265_16(int x) { return x * 16; }
+inline int f7265_17(int x) { return x * 17; }
+inline int f7265_18(int x) { return x * 18; }
+inline int f7265_19(int x) { return x * 19; }
+inline int f7265_20(int x) { return x * 20; }
+inline int f7265_21(int x) { return x * 21; }
+inline int f7265_22(int x) { return x * 22; }
+inline int f7265_23(int x) { return x * 23; }
+inline int f7265_24(int x) { return x * 24; }
+inline int f7265_25(int x) { return x * 25; }
+inline int f7265_26(int x) { return x * 26; }
+inline int f7265_27(int x) { return x * 27; }
+inline int f7265_28(int x) { return x * 28; }
+inline int f7265_29(int x) { return x * 29; }
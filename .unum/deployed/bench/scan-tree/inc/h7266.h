@@ -0,0 +1,42 @@
+#pragma once
+/* header 7266 */
+#include <vector>
+#include "h4864.h"
+#include "h6509.h"
+#include "h906.h"
+#include "h6295.h"
+#include "h9007.h"
+#ifdef X
+#include "h4873.h"
+#endif
+struct S7266 { int a; const char *s = "x//y"; };
+inline int f7266_0(int x) { return x * 0; }
+inline int f7266_1(int x) { return x * 1; }
+inline int f7266_2(int x) { return x * 2; }
+inline int f7266_3(int x) { return x * 3; }
+inline int f7266_4(int x) { return x * 4; }
+inline int f7266_5(int x) { return x * 5; }
+inline int f7266_6(int x) { return x * 6; }
+inline int f7266_7(int x) { return x * 7; }
+inline int f7266_8(int x) { return x * 8; }
+inline int f7266_9(int x) { return x * 9; }
+inline int f7266_10(int x) { return x * 10; }
+inline int f7266_11(int x) { return x * 11; }
+inline int f7266_12(int x) { return x * 12; }
+inline int f7266_13(int x) { return x * 13; }
+inline int f7266_14(int x) { return x * 14; }
+inline int f7266_15(int x) { return x * 15; }
+inline int f7266_16(int x) { return x * 16; }
+inline int f7266_17(int x) { return x * 17; }
+inline int f7266_18(int x) { return x * 18; }
+inline int f7266_19(int x) { return x * 19; }
+inline int f7266_20(int x) { return x * 20; }
+inline int f7266_21(int x) { return x * 21; }
+inline int f7266_22(int x) { return x * 22; }
+inline int f7266_23(int x) { return x * 23; }
+inline int f7266_24(int x) { return x * 24; }
+inline int f7266_25(int x) { return x * 25; }
+inline int f7266_26(int x) { return x * 26; }
+inline int f7266_27(int x) { return x * 27; }
+inline int f7266_28(int x) { return x * 28; }
+inline int f7266_29(int x) { return x * 29; }
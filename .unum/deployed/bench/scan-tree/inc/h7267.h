@@ -0,0 +1,42 @@
+#pragma once
+/* header 7267 */
+#include <vector>
+#include "h8334.h"
+#include "h2791.h"
+#include "h6417.h"
+#include "h1669.h"
+#include "h7061.h"
+#ifdef X
+#include "h5963.h"
+#endif
+struct S7267 { int a; const char *s = "x//y"; };
+inline int f7267_0(int x) { return x * 0; }
+inline int f7267_1(int x) { return x * 1; }
+inline int f7267_2(int x) { return x * 2; }
+inline int f7267_3(int x) { return x * 3; }
+inline int f7267_4(int x) { return x * 4; }
+inline int f7267_5(int x) { return x * 5; }
+inline int f7267_6(int x) { return x * 6; }
+inline int f7267_7(int x) { return x * 7; }
+inline int f7267_8(int x) { return x * 8; }
+inline int f7267_9(int x) { return x * 9; }
+inline int f7267_10(int x) { return x * 10; }
+inline int f7267_11(int x) { return x * 11; }
+inline int f7267_12(int x) { return x * 12; }
+inline int f7267_13(int x) { return x * 13; }
+inline int f7267_14(int x) { return x * 14; }
+inline int f7267_15(int x) { return x * 15; }
+inline int f7267_16(int x) { return x * 16; }
+inline int f7267_17(int x) { return x * 17; }
+inline int f7267_18(int x) { return x * 18; }
+inline int f7267_19(int x) { return x * 19; }
+inline int f7267_20(int x) { return x * 20; }
+inline int f7267_21(int x) { return x * 21; }
+inline int f7267_22(int x) { return x * 22; }
+inline int f7267_23(int x) { return x * 23; }
+inline int f7267_24(int x) { return x * 24; }
+inline int f7267_25(int x) { return x * 25; }
+inline int f7267_26(int x) { return x * 26; }
+inline int f7267_27(int x) { return x * 27; }
+inline int f7267_28(int x) { return x * 28; }
+inline int f7267_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7268 */
+#include <vector>
+#include "h561.h"
+#include "h6866.h"
+#include "h7257.h"
+#include "h8755.h"
+#include "h8343.h"
+#ifdef X
+#include "h5202.h"
+#endif
+struct S7268 { int a; const char *s = "x//y"; };
+inline int f7268_0(int x) { return x * 0; }
+inline int f7268_1(int x) { return x * 1; }
+inline int f7268_2(int x) { return x * 2; }
+inline int f7268_3(int x) { return x * 3; }
+inline int f7268_4(int x) { return x * 4; }
+inline int f7268_5(int x) { return x * 5; }
+inline int f7268_6(int x) { return x * 6; }
+inline int f7268_7(int x) { return x * 7; }
+inline int f7268_8(int x) { return x * 8; }
+inline int f7268_9(int x) { return x * 9; }
+inline int f7268_10(int x) { return x * 10; }
+inline int f7268_11(int x) { return x * 11; }
+inline int f7268_12(int x) { return x * 12; }
+inline int f7268_13(int x) { return x * 13; }
+inline int f7268_14(int x) { return x * 14; }
+inline int f7268_15(int x) { return x * 15; }
+inline int f7268_16(int x) { return x * 16; }
+inline int f7268_17(int x) { return x * 17; }
+inline int f7268_18(int x) { return x * 18; }
+inline int f7268_19(int x) { return x * 19; }
+inline int f7268_20(int x) { return x * 20; }
+inline int f7268_21(int x) { return x * 21; }
+inline int f7268_22(int x) { return x * 22; }
+inline int f7268_23(int x) { return x * 23; }
+inline int f7268_24(int x) { return x * 24; }
+inline int f7268_25(int x) { return x * 25; }
+inline int f7268_26(int x) { return x * 26; }
+inline int f7268_27(int x) { return x * 27; }
+inline int f7268_28(int x) { return x * 28; }
+inline int f7268_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 727 */
+#include <vector>
+#include "h733.h"
+#include "h6027.h"
+#include "h1648.h"
+#include "h3062.h"
+#include "h2759.h"
+#ifdef X
+#include "h1694.h"
+#endif
+struct S727 { int a; const char *s = "x//y"; };
+inline int f727_0(int x) { return x * 0; }
+inline int f727_1(int x) { return x * 1; }
+inline int f727_2(int x) { return x * 2; }
+inline int f727_3(int x) { return x * 3; }
+inline int f727_4(int x) { return x * 4; }
+inline int f727_5(int x) { return x * 5; }
+inline int f727_6(int x) { return x * 6; }
+inline int f727_7(int x) { return x * 7; }
+inline int f727_8(int x) { return x * 8; }
+inline int f727_9(int x) { return x * 9; }
+inline int f727_10(int x) { return x * 10; }
+inline int f727_11(int x) { return x * 11; }
+inline int f727_12(int x) { return x * 12; }
+inline int f727_13(int x) { return x * 13; }
+inline int f727_14(int x) { return x * 14; }
+inline int f727_15(int x) { return x * 15; }
+inline int f727_16(int x) { return x * 16; }
+inline int f727_17(int x) { return x * 17; }
+inline int f727_18(int x) { return x * 18; }
+inline int f727_19(int x) { return x * 19; }
+inline int f727_20(int x) { return x * 20; }
+inline int f727_21(int x) { return x * 21; }
+inline int f727_22(int x) { return x * 22; }
+inline int f727_23(int x) { return x * 23; }
+inline int f727_24(int x) { return x * 24; }
+inline int f727_25(int x) { return x * 25; }
+inline int f727_26(int x) { return x * 26; }
+inline int f727_27(int x) { return x * 27; }
+inline int f727_28(int x) { return x * 28; }
+inline int f727_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7271 */
+#include <vector>
+#include "h9380.h"
+#include "h1093.h"
+#include "h2281.h"
+#include "h262.h"
+#include "h8850.h"
+#ifdef X
+#include "h27.h"
+#endif
+struct S7271 { int a; const char *s = "x//y"; };
+inline int f7271_0(int x) { return x * 0; }
+inline int f7271_1(int x) { return x * 1; }
+inline int f7271_2(int x) { return x * 2; }
+inline int f7271_3(int x) { return x * 3; }
+inline int f7271_4(int x) { return x * 4; }
+inline int f7271_5(int x) { return x * 5; }
+inline int f7271_6(int x) { return x * 6; }
+inline int f7271_7(int x) { return x * 7; }
+inline int f7271_8(int x) { return x * 8; }
+inline int f7271_9(int x) { return x * 9; }
+inline int f7271_10(int x) { return x * 10; }
+inline int f7271_11(int x) { return x * 11; }
+inline int f7271_12(int x) { return x * 12; }
+inline int f7271_13(int x) { return x * 13; }
+inline int f7271_14(int x) { return x * 14; }
+inline int f7271_15(int x) { return x * 15; }
+inline int f7271_16(int x) { return x * 16; }
+inline int f7271_17(int x) { return x * 17; }
+inline int f7271_18(int x) { return x * 18; }
+inline int f7271_19(int x) { return x * 19; }
+inline int f7271_20(int x) { return x * 20; }
+inline int f7271_21(int x) { return x * 21; }
+inline int f7271_22(int x) { return x * 22; }
+inline int f7271_23(int x) { return x * 23; }
+inline int f7271_24(int x) { return x * 24; }
+inline int f7271_25(int x) { return x * 25; }
+inline int f7271_26(int x) { return x * 26; }
+inline int f7271_27(int x) { return x * 27; }
+inline int f7271_28(int x) { return x * 28; }
+inline int f7271_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7272 */
+#include <vector>
+#include "h8649.h"
+#include "h2412.h"
+#include "h6307.h"
+#include "h1340.h"
+#include "h2040.h"
+#ifdef X
+#include "h9663.h"
+#endif
+struct S7272 { int a; const char *s = "x//y"; };
+inline int f7272_0(int x) { return x * 0; }
+inline int f7272_1(int x) { return x * 1; }
+inline int f7272_2(int x) { return x * 2; }
+inline int f7272_3(int x) { return x * 3; }
+inline int f7272_4(int x) { return x * 4; }
+inline int f7272_5(int x) { return x * 5; }
+inline int f7272_6(int x) { return x * 6; }
+inline int f7272_7(int x) { return x * 7; }
+inline int f7272_8(int x) { return x * 8; }
+inline int f7272_9(int x) { return x * 9; }
+inline int f7272_10(int x) { return x * 10; }
+inline int f7272_11(int x) { return x * 11; }
+inline int f7272_12(int x) { return x * 12; }
+inline int f7272_13(int x) { return x * 13; }
+inline int f7272_14(int x) { return x * 14; }
+inline int f7272_15(int x) { return x * 15; }
+inline int f7272_16(int x) { return x * 16; }
+inline int f7272_17(int x) { return x * 17; }
+inline int f7272_18(int x) { return x * 18; }
+inline int f7272_19(int x) { return x * 19; }
+inline int f7272_20(int x) { return x * 20; }
+inline int f7272_21(int x) { return x * 21; }
+inline int f7272_22(int x) { return x * 22; }
+inline int f7272_23(int x) { return x * 23; }
+inline int f7272_24(int x) { return x * 24; }
+inline int f7272_25(int x) { return x * 25; }
+inline int f7272_26(int x) { return x * 26; }
+inline int f7272_27(int x) { return x * 27; }
+inline int f7272_28(int x) { return x * 28; }
+inline int f7272_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7273 */
+#include <vector>
+#include "h3764.h"
+#include "h2633.h"
+#include "h4636.h"
+#include "h5331.h"
+#include "h264.h"
+#ifdef X
+#include "h2493.h"
+#endif
+struct S7273 { int a; const char *s = "x//y"; };
+inline int f7273_0(int x) { return x * 0; }
+inline int f7273_1(int x) { return x * 1; }
+inline int f7273_2(int x) { return x * 2; }
+inline int f7273_3(int x) { return x * 3; }
+inline int f7273_4(int x) { return x * 4; }
+inline int f7273_5(int x) { return x * 5; }
+inline int f7273_6(int x) { return x * 6; }
+inline int f7273_7(int x) { return x * 7; }
+inline int f7273_8(int x) { return x * 8; }
+inline int f7273_9(int x) { return x * 9; }
+inline int f7273_10(int x) { return x * 10; }
+inline int f7273_11(int x) { return x * 11; }
+inline int f7273_12(int x) { return x * 12; }
+inline int f7273_13(int x) { return x * 13; }
+inline int f7273_14(int x) { return x * 14; }
+inline int f7273_15(int x) { return x * 15; }
+inline int f7273_16(int x) { return x * 16; }
+inline int f7273_17(int x) { return x * 17; }
+inline int f7273_18(int x) { return x * 18; }
+inline int f7273_19(int x) { return x * 19; }
+inline int f7273_20(int x) { return x * 20; }
+inline int f7273_21(int x) { return x * 21; }
+inline int f7273_22(int x) { return x * 22; }
+inline int f7273_23(int x) { return x * 23; }
+inline int f7273_24(int x) { return x * 24; }
+inline int f7273_25(int x) { return x * 25; }
+inline int f7273_26(int x) { return x * 26; }
+inline int f7273_27(int x) { return x * 27; }
+inline int f7273_28(int x) { return x * 28; }
+inline int f7273_29(int x) { return x * 29; }
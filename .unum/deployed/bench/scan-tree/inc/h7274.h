@@ -0,0 +1,42 @@
+#pragma once
+/* header 7274 */
+#include <vector>
+#include "h9716.h"
+#include "h1839.h"
+#include "h5967.h"
+#include "h9544.h"
+#include "h7035.h"
+#ifdef X
+#include "h2761.h"
+#endif
+struct S7274 { int a; const char *s = "x//y"; };
+inline int f7274_0(int x) { return x * 0; }
+inline int f7274_1(int x) { return x * 1; }
+inline int f7274_2(int x) { return x * 2; }
+inline int f7274_3(int x) { return x * 3; }
+inline int f7274_4(int x) { return x * 4; }
+inline int f7274_5(int x) { return x * 5; }
+inline int f7274_6(int x) { return x * 6; }
+inline int f7274_7(int x) { return x * 7; }
+inline int f7274_8(int x) { return x * 8; }
+inline int f7274_9(int x) { return x * 9; }
+inline int f7274_10(int x) { return x * 10; }
+inline int f7274_11(int x) { return x * 11; }
+inline int f7274_12(int x) { return x * 12; }
+inline int f7274_13(int x) { return x * 13; }
+inline int f7274_14(int x) { return x * 14; }
+inline int f7274_15(int x) { return x * 15; }
+inline int f7274_16(int x) { return x * 16; }
+inline int f7274_17(int x) { return x * 17; }
+inline int f7274_18(int x) { return x * 18; }
+inline int f7274_19(int x) { return x * 19; }
+inline int f7274_20(int x) { return x * 20; }
+inline int f7274_21(int x) { return x * 21; }
+inline int f7274_22(int x) { return x * 22; }
+inline int f7274_23(int x) { return x * 23; }
+inline int f7274_24(int x) { return x * 24; }
+inline int f7274_25(int x) { return x * 25; }
+inline int f7274_26(int x) { return x * 26; }
+inline int f7274_27(int x) { return x * 27; }
+inline int f7274_28(int x) { return x * 28; }
+inline int f7274_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7276 */
+#include <vector>
+#include "h2075.h"
+#include "h2339.h"
+#include "h2415.h"
+#include "h2346.h"
+#include "h7051.h"
+#ifdef X
+#include "h3801.h"
+#endif
+struct S7276 { int a; const char *s = "x//y"; };
+inline int f7276_0(int x) { return x * 0; }
+inline int f7276_1(int x) { return x * 1; }
+inline int f7276_2(int x) { return x * 2; }
+inline int f7276_3(int x) { return x * 3; }
+inline int f7276_4(int x) { return x * 4; }
+inline int f7276_5(int x) { return x * 5; }
+inline int f7276_6(int x) { return x * 6; }
+inline int f7276_7(int x) { return x * 7; }
+inline int f7276_8(int x) { return x * 8; }
+inline int f7276_9(int x) { return x * 9; }
+inline int f7276_10(int x) { return x * 10; }
+inline int f7276_11(int x) { return x * 11; }
+inline int f7276_12(int x) { return x * 12; }
+inline int f7276_13(int x) { return x * 13; }
+inline int f7276_14(int x) { return x * 14; }
+inline int f7276_15(int x) { return x * 15; }
+inline int f7276_16(int x) { return x * 16; }
+inline int f7276_17(int x) { return x * 17; }
+inline int f7276_18(int x) { return x * 18; }
+inline int f7276_19(int x) { return x * 19; }
+inline int f7276_20(int x) { return x * 20; }
+inline int f7276_21(int x) { return x * 21; }
+inline int f7276_22(int x) { return x * 22; }
+inline int f7276_23(int x) { return x * 23; }
+inline int f7276_24(int x) { return x * 24; }
+inline int f7276_25(int x) { return x * 25; }
+inline int f7276_26(int x) { return x * 26; }
+inline int f7276_27(int x) { return x * 27; }
+inline int f7276_28(int x) { return x * 28; }
+inline int f7276_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7277 */
+#include <vector>
+#include "h6556.h"
+#include "h1676.h"
+#include "h7246.h"
+#include "h6715.h"
+#include "h5602.h"
+#ifdef X
+#include "h6837.h"
+#endif
+struct S7277 { int a; const char *s = "x//y"; };
+inline int f7277_0(int x) { return x * 0; }
+inline int f7277_1(int x) { return x * 1; }
+inline int f7277_2(int x) { return x * 2; }
+inline int f7277_3(int x) { return x * 3; }
+inline int f7277_4(int x) { return x * 4; }
+inline int f7277_5(int x) { return x * 5; }
+inline int f7277_6(int x) { return x * 6; }
+inline int f7277_7(int x) { return x * 7; }
+inline int f7277_8(int x) { return x * 8; }
+inline int f7277_9(int x) { return x * 9; }
+inline int f7277_10(int x) { return x * 10; }
+inline int f7277_11(int x) { return x * 11; }
+inline int f7277_12(int x) { return x * 12; }
+inline int f7277_13(int x) { return x * 13; }
+inline int f7277_14(int x) { return x * 14; }
+inline int f7277_15(int x) { return x * 15; }
+inline int f7277_16(int x) { return x * 16; }
+inline int f7277_17(int x) { return x * 17; }
+inline int f7277_18(int x) { return x * 18; }
+inline int f7277_19(int x) { return x * 19; }
+inline int f7277_20(int x) { return x * 20; }
+inline int f7277_21(int x) { return x * 21; }
+inline int f7277_22(int x) { return x * 22; }
+inline int f7277_23(int x) { return x * 23; }
+inline int f7277_24(int x) { return x * 24; }
+inline int f7277_25(int x) { return x * 25; }
+inline int f7277_26(int x) { return x * 26; }
+inline int f7277_27(int x) { return x * 27; }
+inline int f7277_28(int x) { return x * 28; }
+inline int f7277_29(int x) { return x * 29; }
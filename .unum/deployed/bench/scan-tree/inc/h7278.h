@@ -0,0 +1,42 @@
+#pragma once
+/* header 7278 */
+#include <vector>
+#include "h6268.h"
+#include "h6499.h"
+#include "h4231.h"
+#include "h1143.h"
+#include "h7464.h"
+#ifdef X
+#include "h8654.h"
+#endif
+struct S7278 { int a; const char *s = "x//y"; };
+inline int f7278_0(int x) { return x * 0; }
+inline int f7278_1(int x) { return x * 1; }
+inline int f7278_2(int x) { return x * 2; }
+inline int f7278_3(int x) { return x * 3; }
+inline int f7278_4(int x) { return x * 4; }
+inline int f7278_5(int x) { return x * 5; }
+inline int f7278_6(int x) { return x * 6; }
+inline int f7278_7(int x) { return x * 7; }
+inline int f7278_8(int x) { return x * 8; }
+inline int f7278_9(int x) { return x * 9; }
+inline int f7278_10(int x) { return x * 10; }
+inline int f7278_11(int x) { return x * 11; }
+inline int f7278_12(int x) { return x * 12; }
+inline int f7278_13(int x) { return x * 13; }
+inline int f7278_14(int x) { return x * 14; }
+inline int f7278_15(int x) { return x * 15; }
+inline int f7278_16(int x) { return x * 16; }
+inline int f7278_17(int x) { return x * 17; }
+inline int f7278_18(int x) { return x * 18; }
+inline int f7278_19(int x) { return x * 19; }
+inline int f7278_20(int x) { return x * 20; }
+inline int f7278_21(int x) { return x * 21; }
+inline int f7278_22(int x) { return x * 22; }
+inline int f7278_23(int x) { return x * 23; }
+inline int f7278_24(int x) { return x * 24; }
+inline int f7278_25(int x) { return x * 25; }
+inline int f7278_26(int x) { return x * 26; }
+inline int f7278_27(int x) { return x * 27; }
+inline int f7278_28(int x) { return x * 28; }
+inline int f7278_29(int x) { return x * 29; }
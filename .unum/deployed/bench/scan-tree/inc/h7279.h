@@ -0,0 +1,42 @@
+#pragma once
+/* header 7279 */
+#include <vector>
+#include "h9587.h"
+#include "h7310.h"
+#include "h6059.h"
+#include "h9798.h"
+#include "h1765.h"
+#ifdef X
+#include "h7583.h"
+#endif
+struct S7279 { int a; const char *s = "x//y"; };
+inline int f7279_0(int x) { return x * 0; }
+inline int f7279_1(int x) { return x * 1; }
+inline int f7279_2(int x) { return x * 2; }
+inline int f7279_3(int x) { return x * 3; }
+inline int f7279_4(int x) { return x * 4; }
+inline int f7279_5(int x) { return x * 5; }
+inline int f7279_6(int x) { return x * 6; }
+inline int f7279_7(int x) { return x * 7; }
+inline int f7279_8(int x) { return x * 8; }
+inline int f7279_9(int x) { return x * 9; }
+inline int f7279_10(int x) { return x * 10; }
+inline int f7279_11(int x) { return x * 11; }
+inline int f7279_12(int x) { return x * 12; }
+inline int f7279_13(int x) { return x * 13; }
+inline int f7279_14(int x) { return x * 14; }
+inline int f7279_15(int x) { return x * 15; }
+inline int f7279_16(int x) { return x * 16; }
+inline int f7279_17(int x) { return x * 17; }
+inline int f7279_18(int x) { return x * 18; }
+inline int f7279_19(int x) { return x * 19; }
+inline int f7279_20(int x) { return x * 20; }
+inline int f7279_21(int x) { return x * 21; }
+inline int f7279_22(int x) { return x * 22; }
+inline int f7279_23(int x) { return x * 23; }
+inline int f7279_24(int x) { return x * 24; }
+inline int f7279_25(int x) { return x * 25; }
+inline int f7279_26(int x) { return x * 26; }
+inline int f7279_27(int x) { return x * 27; }
+inline int f7279_28(int x) { return x * 28; }
+inline int f7279_29(int x) { return x * 29; }
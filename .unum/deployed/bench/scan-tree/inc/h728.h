@@ -0,0 +1,42 @@
+#pragma once
+/* header 728 */
+#include <vector>
+#include "h4180.h"
+#include "h9833.h"
+#include "h9018.h"
+#include "h2000.h"
+#include "h3594.h"
+#ifdef X
+#include "h3449.h"
+#endif
+struct S728 { int a; const char *s = "x//y"; };
+inline int f728_0(int x) { return x * 0; }
+inline int f728_1(int x) { return x * 1; }
+inline int f728_2(int x) { return x * 2; }
+inline int f728_3(int x) { return x * 3; }
+inline int f728_4(int x) { return x * 4; }
+inline int f728_5(int x) { return x * 5; }
+inline int f728_6(int x) { return x * 6; }
+inline int f728_7(int x) { return x * 7; }
+inline int f728_8(int x) { return x * 8; }
+inline int f728_9(int x) { return x * 9; }
+inline int f728_10(int x) { return x * 10; }
+inline int f728_11(int x) { return x * 11; }
+inline int f728_12(int x) { return x * 12; }
+inline int f728_13(int x) { return x * 13; }
+inline int f728_14(int x) { return x * 14; }
+inline int f728_15(int x) { return x * 15; }
+inline int f728_16(int x) { return x * 16; }
+inline int f728_17(int x) { return x * 17; }
+inline int f728_18(int x) { return x * 18; }
+inline int f728_19(int x) { return x * 19; }
+inline int f728_20(int x) { return x * 20; }
+inline int f728_21(int x) { return x * 21; }
+inline int f728_22(int x) { return x * 22; }
+inline int f728_23(int x) { return x * 23; }
+inline int f728_24(int x) { return x * 24; }
+inline int f728_25(int x) { return x * 25; }
+inline int f728_26(int x) { return x * 26; }
+inline int f728_27(int x) { return x * 27; }
+inline int f728_28(int x) { return x * 28; }
+inline int f728_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7280 */
+#include <vector>
+#include "h9325.h"
+#include "h8576.h"
+#include "h759.h"
+#include "h954.h"
+#include "h4385.h"
+#ifdef X
+#include "h306.h"
+#endif
+struct S7280 { int a; const char *s = "x//y"; };
+inline int f7280_0(int x) { return x * 0; }
+inline int f7280_1(int x) { return x * 1; }
+inline int f7280_2(int x) { return x * 2; }
+inline int f7280_3(int x) { return x * 3; }
+inline int f7280_4(int x) { return x * 4; }
+inline int f7280_5(int x) { return x * 5; }
+inline int f7280_6(int x) { return x * 6; }
+inline int f7280_7(int x) { return x * 7; }
+inline int f7280_8(int x) { return x * 8; }
+inline int f7280_9(int x) { return x * 9; }
+inline int f7280_10(int x) { return x * 10; }
+inline int f7280_11(int x) { return x * 11; }
+inline int f7280_12(int x) { return x * 12; }
+inline int f7280_13(int x) { return x * 13; }
+inline int f7280_14(int x) { return x * 14; }
+inline int f7280_15(int x) { return x * 15; }
+inline int f7280_16(int x) { return x * 16; }
+inline int f7280_17(int x) { return x * 17; }
+inline int f7280_18(int x) { return x * 18; }
+inline int f7280_19(int x) { return x * 19; }
+inline int f7280_20(int x) { return x * 20; }
+inline int f7280_21(int x) { return x * 21; }
+inline int f7280_22(int x) { return x * 22; }
+inline int f7280_23(int x) { return x * 23; }
+inline int f7280_24(int x) { return x * 24; }
+inline int f7280_25(int x) { return x * 25; }
+inline int f7280_26(int x) { return x * 26; }
+inline int f7280_27(int x) { return x * 27; }
+inline int f7280_28(int x) { return x * 28; }
+inline int f7280_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7284 */
+#include <vector>
+#include "h5569.h"
+#include "h8506.h"
+#include "h8823.h"
+#include "h1952.h"
+#include "h3918.h"
+#ifdef X
+#include "h6215.h"
+#endif
+struct S7284 { int a; const char *s = "x//y"; };
+inline int f7284_0(int x) { return x * 0; }
+inline int f7284_1(int x) { return x * 1; }
+inline int f7284_2(int x) { return x * 2; }
+inline int f7284_3(int x) { return x * 3; }
+inline int f7284_4(int x) { return x * 4; }
+inline int f7284_5(int x) { return x * 5; }
+inline int f7284_6(int x) { return x * 6; }
+inline int f7284_7(int x) { return x * 7; }
+inline int f7284_8(int x) { return x * 8; }
+inline int f7284_9(int x) { return x * 9; }
+inline int f7284_10(int x) { return x * 10; }
+inline int f7284_11(int x) { return x * 11; }
+inline int f7284_12(int x) { return x * 12; }
+inline int f7284_13(int x) { return x * 13; }
+inline int f7284_14(int x) { return x * 14; }
+inline int f7284_15(int x) { return x * 15; }
+inline int f7284_16(int x) { return x * 16; }
+inline int f7284_17(int x) { return x * 17; }
+inline int f7284_18(int x) { return x * 18; }
+inline int f7284_19(int x) { return x * 19; }
+inline int f7284_20(int x) { return x * 20; }
+inline int f7284_21(int x) { return x * 21; }
+inline int f7284_22(int x) { return x * 22; }
+inline int f7284_23(int x) { return x * 23; }
+inline int f7284_24(int x) { return x * 24; }
+inline int f7284_25(int x) { return x * 25; }
+inline int f7284_26(int x) { return x * 26; }
+inline int f7284_27(int x) { return x * 27; }
+inline int f7284_28(int x) { return x * 28; }
+inline int f7284_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7286 */
+#include <vector>
+#include "h8681.h"
+#include "h6822.h"
+#include "h18.h"
+#include "h6406.h"
+#include "h7296.h"
+#ifdef X
+#include "h9143.h"
+#endif
+struct S7286 { int a; const char *s = "x//y"; };
+inline int f7286_0(int x) { return x * 0; }
+inline int f7286_1(int x) { return x * 1; }
+inline int f7286_2(int x) { return x * 2; }
+inline int f7286_3(int x) { return x * 3; }
+inline int f7286_4(int x) { return x * 4; }
+inline int f7286_5(int x) { return x * 5; }
+inline int f7286_6(int x) { return x * 6; }
+inline int f7286_7(int x) { return x * 7; }
+inline int f7286_8(int x) { return x * 8; }
+inline int f7286_9(int x) { return x * 9; }
+inline int f7286_10(int x) { return x * 10; }
+inline int f7286_11(int x) { return x * 11; }
+inline int f7286_12(int x) { return x * 12; }
+inline int f7286_13(int x) { return x * 13; }
+inline int f7286_14(int x) { return x * 14; }
+inline int f7286_15(int x) { return x * 15; }
+inline int f7286_16(int x) { return x * 16; }
+inline int f7286_17(int x) { return x * 17; }
+inline int f7286_18(int x) { return x * 18; }
+inline int f7286_19(int x) { return x * 19; }
+inline int f7286_20(int x) { return x * 20; }
+inline int f7286_21(int x) { return x * 21; }
+inline int f7286_22(int x) { return x * 22; }
+inline int f7286_23(int x) { return x * 23; }
+inline int f7286_24(int x) { return x * 24; }
+inline int f7286_25(int x) { return x * 25; }
+inline int f7286_26(int x) { return x * 26; }
+inline int f7286_27(int x) { return x * 27; }
+inline int f7286_28(int x) { return x * 28; }
+inline int f7286_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7287 */
+#include <vector>
+#include "h5498.h"
+#include "h5802.h"
+#include "h7088.h"
+#include "h77.h"
+#include "h713.h"
+#ifdef X
+#include "h6287.h"
+#endif
+struct S7287 { int a; const char *s = "x//y"; };
+inline int f7287_0(int x) { return x * 0; }
+inline int f7287_1(int x) { return x * 1; }
+inline int f7287_2(int x) { return x * 2; }
+inline int f7287_3(int x) { return x * 3; }
+inline int f7287_4(int x) { return x * 4; }
+inline int f7287_5(int x) { return x * 5; }
+inline int f7287_6(int x) { return x * 6; }
+inline int f7287_7(int x) { return x * 7; }
+inline int f7287_8(int x) { return x * 8; }
+inline int f7287_9(int x) { return x * 9; }
+inline int f7287_10(int x) { return x * 10; }
+inline int f7287_11(int x) { return x * 11; }
+inline int f7287_12(int x) { return x * 12; }
+inline int f7287_13(int x) { return x * 13; }
+inline int f7287_14(int x) { return x * 14; }
+inline int f7287_15(int x) { return x * 15; }
+inline int f7287_16(int x) { return x * 16; }
+inline int f7287_17(int x) { return x * 17; }
+inline int f7287_18(int x) { return x * 18; }
+inline int f7287_19(int x) { return x * 19; }
+inline int f7287_20(int x) { return x * 20; }
+inline int f7287_21(int x) { return x * 21; }
+inline int f7287_22(int x) { return x * 22; }
+inline int f7287_23(int x) { return x * 23; }
+inline int f7287_24(int x) { return x * 24; }
+inline int f7287_25(int x) { return x * 25; }
+inline int f7287_26(int x) { return x * 26; }
+inline int f7287_27(int x) { return x * 27; }
+inline int f7287_28(int x) { return x * 28; }
+inline int f7287_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7288 */
+#include <vector>
+#include "h7133.h"
+#include "h3249.h"
+#include "h1939.h"
+#include "h4690.h"
+#include "h9467.h"
+#ifdef X
+#include "h2425.h"
+#endif
+struct S7288 { int a; const char *s = "x//y"; };
+inline int f7288_0(int x) { return x * 0; }
+inline int f7288_1(int x) { return x * 1; }
+inline int f7288_2(int x) { return x * 2; }
+inline int f7288_3(int x) { return x * 3; }
+inline int f7288_4(int x) { return x * 4; }
+inline int f7288_5(int x) { return x * 5; }
+inline int f7288_6(int x) { return x * 6; }
+inline int f7288_7(int x) { return x * 7; }
+inline int f7288_8(int x) { return x * 8; }
+inline int f7288_9(int x) { return x * 9; }
+inline int f7288_10(int x) { return x * 10; }
+inline int f7288_11(int x) { return x * 11; }
+inline int f7288_12(int x) { return x * 12; }
+inline int f7288_13(int x) { return x * 13; }
+inline int f7288_14(int x) { return x * 14; }
+inline int f7288_15(int x) { return x * 15; }
+inline int f7288_16(int x) { return x * 16; }
+inline int f7288_17(int x) { return x * 17; }
+inline int f7288_18(int x) { return x * 18; }
+inline int f7288_19(int x) { return x * 19; }
+inline int f7288_20(int x) { return x * 20; }
+inline int f7288_21(int x) { return x * 21; }
+inline int f7288_22(int x) { return x * 22; }
+inline int f7288_23(int x) { return x * 23; }
+inline int f7288_24(int x) { return x * 24; }
+inline int f7288_25(int x) { return x * 25; }
+inline int f7288_26(int x) { return x * 26; }
+inline int f7288_27(int x) { return x * 27; }
+inline int f7288_28(int x) { return x * 28; }
+inline int f7288_29(int x) { return x * 29; }
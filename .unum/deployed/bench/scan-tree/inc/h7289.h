@@ -0,0 +1,42 @@
+#pragma once
+/* header 7289 */
+#include <vector>
+#include "h6792.h"
+#include "h6503.h"
+#include "h6120.h"
+#include "h5549.h"
+#include "h184.h"
+#ifdef X
+#include "h7465.h"
+#endif
+struct S7289 { int a; const char *s = "x//y"; };
+inline int f7289_0(int x) { return x * 0; }
+inline int f7289_1(int x) { return x * 1; }
+inline int f7289_2(int x) { return x * 2; }
+inline int f7289_3(int x) { return x * 3; }
+inline int f7289_4(int x) { return x * 4; }
+inline int f7289_5(int x) { return x * 5; }
+inline int f7289_6(int x) { return x * 6; }
+inline int f7289_7(int x) { return x * 7; }
+inline int f7289_8(int x) { return x * 8; }
+inline int f7289_9(int x) { return x * 9; }
+inline int f7289_10(int x) { return x * 10; }
+inline int f7289_11(int x) { return x * 11; }
+inline int f7289_12(int x) { return x * 12; }
+inline int f7289_13(int x) { return x * 13; }
+inline int f7289_14(int x) { return x * 14; }
+inline int f7289_15(int x) { return x * 15; }
+inline int f7289_16(int x) { return x * 16; }
+inline int f7289_17(int x) { return x * 17; }
+inline int f7289_18(int x) { return x * 18; }
+inline int f7289_19(int x) { return x * 19; }
+inline int f7289_20(int x) { return x * 20; }
+inline int f7289_21(int x) { return x * 21; }
+inline int f7289_22(int x) { return x * 22; }
+inline int f7289_23(int x) { return x * 23; }
+inline int f7289_24(int x) { return x * 24; }
+inline int f7289_25(int x) { return x * 25; }
+inline int f7289_26(int x) { return x * 26; }
+inline int f7289_27(int x) { return x * 27; }
+inline int f7289_28(int x) { return x * 28; }
+inline int f7289_29(int x) { return x * 29; }
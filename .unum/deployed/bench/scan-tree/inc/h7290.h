@@ -0,0 +1,42 @@
+#pragma once
+/* header 7290 */
+#include <vector>
+#include "h6911.h"
+#include "h3794.h"
+#include "h6674.h"
+#include "h5865.h"
+#include "h5367.h"
+#ifdef X
+#include "h9003.h"
+#endif
+struct S7290 { int a; const char *s = "x//y"; };
+inline int f7290_0(int x) { return x * 0; }
+inline int f7290_1(int x) { return x * 1; }
+inline int f7290_2(int x) { return x * 2; }
+inline int f7290_3(int x) { return x * 3; }
+inline int f7290_4(int x) { return x * 4; }
+inline int f7290_5(int x) { return x * 5; }
+inline int f7290_6(int x) { return x * 6; }
+inline int f7290_7(int x) { return x * 7; }
+inline int f7290_8(int x) { return x * 8; }
+inline int f7290_9(int x) { return x * 9; }
+inline int f7290_10(int x) { return x * 10; }
+inline int f7290_11(int x) { return x * 11; }
+inline int f7290_12(int x) { return x * 12; }
+inline int f7290_13(int x) { return x * 13; }
+inline int f7290_14(int x) { return x * 14; }
+inline int f7290_15(int x) { return x * 15; }
+inline int f7290_16(int x) { return x * 16; }
+inline int f7290_17(int x) { return x * 17; }
+inline int f7290_18(int x) { return x * 18; }
+inline int f7290_19(int x) { return x * 19; }
+inline int f7290_20(int x) { return x * 20; }
+inline int f7290_21(int x) { return x * 21; }
+inline int f7290_22(int x) { return x * 22; }
+inline int f7290_23(int x) { return x * 23; }
+inline int f7290_24(int x) { return x * 24; }
+inline int f7290_25(int x) { return x * 25; }
+inline int f7290_26(int x) { return x * 26; }
+inline int f7290_27(int x) { return x * 27; }
+inline int f7290_28(int x) { return x * 28; }
+inline int f7290_29(int x) { return x * 29; }
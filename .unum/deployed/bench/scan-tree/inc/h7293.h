@@ -0,0 +1,42 @@
+#pragma once
+/* header 7293 */
+#include <vector>
+#include "h309.h"
+#include "h4471.h"
+#include "h2191.h"
+#include "h4213.h"
+#include "h5325.h"
+#ifdef X
+#include "h5891.h"
+#endif
+struct S7293 { int a; const char *s = "x//y"; };
+inline int f7293_0(int x) { return x * 0; }
+inline int f7293_1(int x) { return x * 1; }
+inline int f7293_2(int x) { return x * 2; }
+inline int f7293_3(int x) { return x * 3; }
+inline int f7293_4(int x) { return x * 4; }
+inline int f7293_5(int x) { return x * 5; }
+inline int f7293_6(int x) { return x * 6; }
+inline int f7293_7(int x) { return x * 7; }
+inline int f7293_8(int x) { return x * 8; }
+inline int f7293_9(int x) { return x * 9; }
+inline int f7293_10(int x) { return x * 10; }
+inline int f7293_11(int x) { return x * 11; }
+inline int f7293_12(int x) { return x * 12; }
+inline int f7293_13(int x) { return x * 13; }
+inline int f7293_14(int x) { return x * 14; }
+inline int f7293_15(int x) { return x * 15; }
+inline int f7293_16(int x) { return x * 16; }
+inline int f7293_17(int x) { return x * 17; }
+inline int f7293_18(int x) { return x * 18; }
+inline int f7293_19(int x) { return x * 19; }
+inline int f7293_20(int x) { return x * 20; }
+inline int f7293_21(int x) { return x * 21; }
+inline int f7293_22(int x) { return x * 22; }
+inline int f7293_23(int x) { return x * 23; }
+inline int f7293_24(int x) { return x * 24; }
+inline int f7293_25(int x) { return x * 25; }
+inline int f7293_26(int x) { return x * 26; }
+inline int f7293_27(int x) { return x * 27; }
+inline int f7293_28(int x) { return x * 28; }
+inline int f7293_29(int x) { return x * 29; }
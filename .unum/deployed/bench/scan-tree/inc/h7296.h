@@ -0,0 +1,42 @@
+#pragma once
+/* header 7296 */
+#include <vector>
+#include "h6590.h"
+#include "h343.h"
+#include "h4475.h"
+#include "h3882.h"
+#include "h1754.h"
+#ifdef X
+#include "h345.h"
+#endif
+struct S7296 { int a; const char *s = "x//y"; };
+inline int f7296_0(int x) { return x * 0; }
+inline int f7296_1(int x) { return x * 1; }
+inline int f7296_2(int x) { return x * 2; }
+inline int f7296_3(int x) { return x * 3; }
+inline int f7296_4(int x) { return x * 4; }
+inline int f7296_5(int x) { return x * 5; }
+inline int f7296_6(int x) { return x * 6; }
+inline int f7296_7(int x) { return x * 7; }
+inline int f7296_8(int x) { return x * 8; }
+inline int f7296_9(int x) { return x * 9; }
+inline int f7296_10(int x) { return x * 10; }
+inline int f7296_11(int x) { return x * 11; }
+inline int f7296_12(int x) { return x * 12; }
+inline int f7296_13(int x) { return x * 13; }
+inline int f7296_14(int x) { return x * 14; }
+inline int f7296_15(int x) { return x * 15; }
+inline int f7296_16(int x) { return x * 16; }
+inline int f7296_17(int x) { return x * 17; }
+inline int f7296_18(int x) { return x * 18; }
+inline int f7296_19(int x) { return x * 19; }
+inline int f7296_20(int x) { return x * 20; }
+inline int f7296_21(int x) { return x * 21; }
+inline int f7296_22(int x) { return x * 22; }
+inline int f7296_23(int x) { return x * 23; }
+inline int f7296_24(int x) { return x * 24; }
+inline int f7296_25(int x) { return x * 25; }
+inline int f7296_26(int x) { return x * 26; }
+inline int f7296_27(int x) { return x * 27; }
+inline int f7296_28(int x) { return x * 28; }
+inline int f7296_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7297 */
+#include <vector>
+#include "h9492.h"
+#include "h122.h"
+#include "h9786.h"
+#include "h1427.h"
+#include "h4907.h"
+#ifdef X
+#include "h6376.h"
+#endif
+struct S7297 { int a; const char *s = "x//y"; };
+inline int f7297_0(int x) { return x * 0; }
+inline int f7297_1(int x) { return x * 1; }
+inline int f7297_2(int x) { return x * 2; }
+inline int f7297_3(int x) { return x * 3; }
+inline int f7297_4(int x) { return x * 4; }
+inline int f7297_5(int x) { return x * 5; }
+inline int f7297_6(int x) { return x * 6; }
+inline int f7297_7(int x) { return x * 7; }
+inline int f7297_8(int x) { return x * 8; }
+inline int f7297_9(int x) { return x * 9; }
+inline int f7297_10(int x) { return x * 10; }
+inline int f7297_11(int x) { return x * 11; }
+inline int f7297_12(int x) { return x * 12; }
+inline int f7297_13(int x) { return x * 13; }
+inline int f7297_14(int x) { return x * 14; }
+inline int f7297_15(int x) { return x * 15; }
+inline int f7297_16(int x) { return x * 16; }
+inline int f7297_17(int x) { return x * 17; }
+inline int f7297_18(int x) { return x * 18; }
+inline int f7297_19(int x) { return x * 19; }
+inline int f7297_20(int x) { return x * 20; }
+inline int f7297_21(int x) { return x * 21; }
+inline int f7297_22(int x) { return x * 22; }
+inline int f7297_23(int x) { return x * 23; }
+inline int f7297_24(int x) { return x * 24; }
+inline int f7297_25(int x) { return x * 25; }
+inline int f7297_26(int x) { return x * 26; }
+inline int f7297_27(int x) { return x * 27; }
+inline int f7297_28(int x) { return x * 28; }
+inline int f7297_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7299 */
+#include <vector>
+#include "h9742.h"
+#include "h4553.h"
+#include "h3815.h"
+#include "h3339.h"
+#include "h358.h"
+#ifdef X
+#include "h8194.h"
+#endif
+struct S7299 { int a; const char *s = "x//y"; };
+inline int f7299_0(int x) { return x * 0; }
+inline int f7299_1(int x) { return x * 1; }
+inline int f7299_2(int x) { return x * 2; }
+inline int f7299_3(int x) { return x * 3; }
+inline int f7299_4(int x) { return x * 4; }
+inline int f7299_5(int x) { return x * 5; }
+inline int f7299_6(int x) { return x * 6; }
+inline int f7299_7(int x) { return x * 7; }
+inline int f7299_8(int x) { return x * 8; }
+inline int f7299_9(int x) { return x * 9; }
+inline int f7299_10(int x) { return x * 10; }
+inline int f7299_11(int x) { return x * 11; }
+inline int f7299_12(int x) { return x * 12; }
+inline int f7299_13(int x) { return x * 13; }
+inline int f7299_14(int x) { return x * 14; }
+inline int f7299_15(int x) { return x * 15; }
+inline int f7299_16(int x) { return x * 16; }
+inline int f7299_17(int x) { return x * 17; }
+inline int f7299_18(int x) { return x * 18; }
+inline int f7299_19(int x) { return x * 19; }
+inline int f7299_20(int x) { return x * 20; }
+inline int f7299_21(int x) { return x * 21; }
+inline int f7299_22(int x) { return x * 22; }
+inline int f7299_23(int x) { return x * 23; }
+inline int f7299_24(int x) { return x * 24; }
+inline int f7299_25(int x) { return x * 25; }
+inline int f7299_26(int x) { return x * 26; }
+inline int f7299_27(int x) { return x * 27; }
+inline int f7299_28(int x) { return x * 28; }
+inline int f7299_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 73 */
+#include <vector>
+#include "h3623.h"
+#include "h5945.h"
+#include "h8865.h"
+#include "h1602.h"
+#include "h4682.h"
+#ifdef X
+#include "h769.h"
+#endif
+struct S73 { int a; const char *s = "x//y"; };
+inline int f73_0(int x) { return x * 0; }
+inline int f73_1(int x) { return x * 1; }
+inline int f73_2(int x) { return x * 2; }
+inline int f73_3(int x) { return x * 3; }
+inline int f73_4(int x) { return x * 4; }
+inline int f73_5(int x) { return x * 5; }
+inline int f73_6(int x) { return x * 6; }
+inline int f73_7(int x) { return x * 7; }
+inline int f73_8(int x) { return x * 8; }
+inline int f73_9(int x) { return x * 9; }
+inline int f73_10(int x) { return x * 10; }
+inline int f73_11(int x) { return x * 11; }
+inline int f73_12(int x) { return x * 12; }
+inline int f73_13(int x) { return x * 13; }
+inline int f73_14(int x) { return x * 14; }
+inline int f73_15(int x) { return x * 15; }
+inline int f73_16(int x) { return x * 16; }
+inline int f73_17(int x) { return x * 17; }
+inline int f73_18(int x) { return x * 18; }
+inline int f73_19(int x) { return x * 19; }
+inline int f73_20(int x) { return x * 20; }
+inline int f73_21(int x) { return x * 21; }
+inline int f73_22(int x) { return x * 22; }
+inline int f73_23(int x) { return x * 23; }
+inline int f73_24(int x) { return x * 24; }
+inline int f73_25(int x) { return x * 25; }
+inline int f73_26(int x) { return x * 26; }
+inline int f73_27(int x) { return x * 27; }
+inline int f73_28(int x) { return x * 28; }
+inline int f73_29(int x) { return x * 29; }
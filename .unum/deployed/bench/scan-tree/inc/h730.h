@@ -0,0 +1,42 @@
+#pragma once
+/* header 730 */
+#include <vector>
+#include "h4272.h"
+#include "h1870.h"
+#include "h9303.h"
+#include "h8946.h"
+#include "h75.h"
+#ifdef X
+#include "h532.h"
+#endif
+struct S730 { int a; const char *s = "x//y"; };
+inline int f730_0(int x) { return x * 0; }
+inline int f730_1(int x) { return x * 1; }
+inline int f730_2(int x) { return x * 2; }
+inline int f730_3(int x) { return x * 3; }
+inline int f730_4(int x) { return x * 4; }
+inline int f730_5(int x) { return x * 5; }
+inline int f730_6(int x) { return x * 6; }
+inline int f730_7(int x) { return x * 7; }
+inline int f730_8(int x) { return x * 8; }
+inline int f730_9(int x) { return x * 9; }
+inline int f730_10(int x) { return x * 10; }
+inline int f730_11(int x) { return x * 11; }
+inline int f730_12(int x) { return x * 12; }
+inline int f730_13(int x) { return x * 13; }
+inline int f730_14(int x) { return x * 14; }
+inline int f730_15(int x) { return x * 15; }
+inline int f730_16(int x) { return x * 16; }
+inline int f730_17(int x) { return x * 17; }
+inline int f730_18(int x) { return x * 18; }
+inline int f730_19(int x) { return x * 19; }
+inline int f730_20(int x) { return x * 20; }
+inline int f730_21(int x) { return x * 21; }
+inline int f730_22(int x) { return x * 22; }
+inline int f730_23(int x) { return x * 23; }
+inline int f730_24(int x) { return x * 24; }
+inline int f730_25(int x) { return x * 25; }
+inline int f730_26(int x) { return x * 26; }
+inline int f730_27(int x) { return x * 27; }
+inline int f730_28(int x) { return x * 28; }
+inline int f730_29(int x) { return x * 29; }
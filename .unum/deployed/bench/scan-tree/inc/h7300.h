@@ -0,0 +1,42 @@
+#pragma once
+/* header 7300 */
+#include <vector>
+#include "h4337.h"
+#include "h6604.h"
+#include "h855.h"
+#include "h6691.h"
+#include "h9998.h"
+#ifdef X
+#include "h4477.h"
+#endif
+struct S7300 { int a; const char *s = "x//y"; };
+inline int f7300_0(int x) { return x * 0; }
+inline int f7300_1(int x) { return x * 1; }
+inline int f7300_2(int x) { return x * 2; }
+inline int f7300_3(int x) { return x * 3; }
+inline int f7300_4(int x) { return x * 4; }
+inline int f7300_5(int x) { return x * 5; }
+inline int f7300_6(int x) { return x * 6; }
+inline int f7300_7(int x) { return x * 7; }
+inline int f7300_8(int x) { return x * 8; }
+inline int f7300_9(int x) { return x * 9; }
+inline int f7300_10(int x) { return x * 10; }
+inline int f7300_11(int x) { return x * 11; }
+inline int f7300_12(int x) { return x * 12; }
+inline int f7300_13(int x) { return x * 13; }
+inline int f7300_14(int x) { return x * 14; }
+inline int f7300_15(int x) { return x * 15; }
+inline int f7300_16(int x) { return x * 16; }
+inline int f7300_17(int x) { return x * 17; }
+inline int f7300_18(int x) { return x * 18; }
+inline int f7300_19(int x) { return x * 19; }
+inline int f7300_20(int x) { return x * 20; }
+inline int f7300_21(int x) { return x * 21; }
+inline int f7300_22(int x) { return x * 22; }
+inline int f7300_23(int x) { return x * 23; }
+inline int f7300_24(int x) { return x * 24; }
+inline int f7300_25(int x) { return x * 25; }
+inline int f7300_26(int x) { return x * 26; }
+inline int f7300_27(int x) { return x * 27; }
+inline int f7300_28(int x) { return x * 28; }
+inline int f7300_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7302 */
+#include <vector>
+#include "h4046.h"
+#include "h7337.h"
+#include "h5719.h"
+#include "h1829.h"
+#include "h4506.h"
+#ifdef X
+#include "h6513.h"
+#endif
+struct S7302 { int a; const char *s = "x//y"; };
+inline int f7302_0(int x) { return x * 0; }
+inline int f7302_1(int x) { return x * 1; }
+inline int f7302_2(int x) { return x * 2; }
+inline int f7302_3(int x) { return x * 3; }
+inline int f7302_4(int x) { return x * 4; }
+inline int f7302_5(int x) { return x * 5; }
+inline int f7302_6(int x) { return x * 6; }
+inline int f7302_7(int x) { return x * 7; }
+inline int f7302_8(int x) { return x * 8; }
+inline int f7302_9(int x) { return x * 9; }
+inline int f7302_10(int x) { return x * 10; }
+inline int f7302_11(int x) { return x * 11; }
+inline int f7302_12(int x) { return x * 12; }
+inline int f7302_13(int x) { return x * 13; }
+inline int f7302_14(int x) { return x * 14; }
+inline int f7302_15(int x) { return x * 15; }
+inline int f7302_16(int x) { return x * 16; }
+inline int f7302_17(int x) { return x * 17; }
+inline int f7302_18(int x) { return x * 18; }
+inline int f7302_19(int x) { return x * 19; }
+inline int f7302_20(int x) { return x * 20; }
+inline int f7302_21(int x) { return x * 21; }
+inline int f7302_22(int x) { return x * 22; }
+inline int f7302_23(int x) { return x * 23; }
+inline int f7302_24(int x) { return x * 24; }
+inline int f7302_25(int x) { return x * 25; }
+inline int f7302_26(int x) { return x * 26; }
+inline int f7302_27(int x) { return x * 27; }
+inline int f7302_28(int x) { return x * 28; }
+inline int f7302_29(int x) { return x * 29; }
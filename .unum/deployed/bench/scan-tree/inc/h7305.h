@@ -0,0 +1,42 @@
+#pragma once
+/* header 7305 */
+#include <vector>
+#include "h513.h"
+#include "h4890.h"
+#include "h496.h"
+#include "h8813.h"
+#include "h2380.h"
+#ifdef X
+#include "h8926.h"
+#endif
+struct S7305 { int a; const char *s = "x//y"; };
+inline int f7305_0(int x) { return x * 0; }
+inline int f7305_1(int x) { return x * 1; }
+inline int f7305_2(int x) { return x * 2; }
+inline int f7305_3(int x) { return x * 3; }
+inline int f7305_4(int x) { return x * 4; }
+inline int f7305_5(int x) { return x * 5; }
+inline int f7305_6(int x) { return x * 6; }
+inline int f7305_7(int x) { return x * 7; }
+inline int f7305_8(int x) { return x * 8; }
+inline int f7305_9(int x) { return x * 9; }
+inline int f7305_10(int x) { return x * 10; }
+inline int f7305_11(int x) { return x * 11; }
+inline int f7305_12(int x) { return x * 12; }
+inline int f7305_13(int x) { return x * 13; }
+inline int f7305_14(int x) { return x * 14; }
+inline int f7305_15(int x) { return x * 15; }
+inline int f7305_16(int x) { return x * 16; }
+inline int f7305_17(int x) { return x * 17; }
+inline int f7305_18(int x) { return x * 18; }
+inline int f7305_19(int x) { return x * 19; }
+inline int f7305_20(int x) { return x * 20; }
+inline int f7305_21(int x) { return x * 21; }
+inline int f7305_22(int x) { return x * 22; }
+inline int f7305_23(int x) { return x * 23; }
+inline int f7305_24(int x) { return x * 24; }
+inline int f7305_25(int x) { return x * 25; }
+inline int f7305_26(int x) { return x * 26; }
+inline int f7305_27(int x) { return x * 27; }
+inline int f7305_28(int x) { return x * 28; }
+inline int f7305_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 731 */
+#include <vector>
+#include "h1222.h"
+#include "h7218.h"
+#include "h4914.h"
+#include "h4619.h"
+#include "h4028.h"
+#ifdef X
+#include "h3299.h"
+#endif
+struct S731 { int a; const char *s = "x//y"; };
+inline int f731_0(int x) { return x * 0; }
+inline int f731_1(int x) { return x * 1; }
+inline int f731_2(int x) { return x * 2; }
+inline int f731_3(int x) { return x * 3; }
+inline int f731_4(int x) { return x * 4; }
+inline int f731_5(int x) { return x * 5; }
+inline int f731_6(int x) { return x * 6; }
+inline int f731_7(int x) { return x * 7; }
+inline int f731_8(int x) { return x * 8; }
+inline int f731_9(int x) { return x * 9; }
+inline int f731_10(int x) { return x * 10; }
+inline int f731_11(int x) { return x * 11; }
+inline int f731_12(int x) { return x * 12; }
+inline int f731_13(int x) { return x * 13; }
+inline int f731_14(int x) { return x * 14; }
+inline int f731_15(int x) { return x * 15; }
+inline int f731_16(int x) { return x * 16; }
+inline int f731_17(int x) { return x * 17; }
+inline int f731_18(int x) { return x * 18; }
+inline int f731_19(int x) { return x * 19; }
+inline int f731_20(int x) { return x * 20; }
+inline int f731_21(int x) { return x * 21; }
+inline int f731_22(int x) { return x * 22; }
+inline int f731_23(int x) { return x * 23; }
+inline int f731_24(int x) { return x * 24; }
+inline int f731_25(int x) { return x * 25; }
+inline int f731_26(int x) { return x * 26; }
+inline int f731_27(int x) { return x * 27; }
+inline int f731_28(int x) { return x * 28; }
+inline int f731_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7310 */
+#include <vector>
+#include "h8251.h"
+#include "h9088.h"
+#include "h687.h"
+#include "h3592.h"
+#include "h7217.h"
+#ifdef X
+#include "h1567.h"
+#endif
+struct S7310 { int a; const char *s = "x//y"; };
+inline int f7310_0(int x) { return x * 0; }
+inline int f7310_1(int x) { return x * 1; }
+inline int f7310_2(int x) { return x * 2; }
+inline int f7310_3(int x) { return x * 3; }
+inline int f7310_4(int x) { return x * 4; }
+inline int f7310_5(int x) { return x * 5; }
+inline int f7310_6(int x) { return x * 6; }
+inline int f7310_7(int x) { return x * 7; }
+inline int f7310_8(int x) { return x * 8; }
+inline int f7310_9(int x) { return x * 9; }
+inline int f7310_10(int x) { return x * 10; }
+inline int f7310_11(int x) { return x * 11; }
+inline int f7310_12(int x) { return x * 12; }
+inline int f7310_13(int x) { return x * 13; }
+inline int f7310_14(int x) { return x * 14; }
+inline int f7310_15(int x) { return x * 15; }
+inline int f7310_16(int x) { return x * 16; }
+inline int f7310_17(int x) { return x * 17; }
+inline int f7310_18(int x) { return x * 18; }
+inline int f7310_19(int x) { return x * 19; }
+inline int f7310_20(int x) { return x * 20; }
+inline int f7310_21(int x) { return x * 21; }
+inline int f7310_22(int x) { return x * 22; }
+inline int f7310_23(int x) { return x * 23; }
+inline int f7310_24(int x) { return x * 24; }
+inline int f7310_25(int x) { return x * 25; }
+inline int f7310_26(int x) { return x * 26; }
+inline int f7310_27(int x) { return x * 27; }
+inline int f7310_28(int x) { return x * 28; }
+inline int f7310_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7312 */
+#include <vector>
+#include "h2223.h"
+#include "h5589.h"
+#include "h4878.h"
+#include "h3368.h"
+#include "h1486.h"
+#ifdef X
+#include "h1486.h"
+#endif
+struct S7312 { int a; const char *s = "x//y"; };
+inline int f7312_0(int x) { return x * 0; }
+inline int f7312_1(int x) { return x * 1; }
+inline int f7312_2(int x) { return x * 2; }
+inline int f7312_3(int x) { return x * 3; }
+inline int f7312_4(int x) { return x * 4; }
+inline int f7312_5(int x) { return x * 5; }
+inline int f7312_6(int x) { return x * 6; }
+inline int f7312_7(int x) { return x * 7; }
+inline int f7312_8(int x) { return x * 8; }
+inline int f7312_9(int x) { return x * 9; }
+inline int f7312_10(int x) { return x * 10; }
+inline int f7312_11(int x) { return x * 11; }
+inline int f7312_12(int x) { return x * 12; }
+inline int f7312_13(int x) { return x * 13; }
+inline int f7312_14(int x) { return x * 14; }
+inline int f7312_15(int x) { return x * 15; }
+inline int f7312_16(int x) { return x * 16; }
+inline int f7312_17(int x) { return x * 17; }
+inline int f7312_18(int x) { return x * 18; }
+inline int f7312_19(int x) { return x * 19; }
+inline int f7312_20(int x) { return x * 20; }
+inline int f7312_21(int x) { return x * 21; }
+inline int f7312_22(int x) { return x * 22; }
+inline int f7312_23(int x) { return x * 23; }
+inline int f7312_24(int x) { return x * 24; }
+inline int f7312_25(int x) { return x * 25; }
+inline int f7312_26(int x) { return x * 26; }
+inline int f7312_27(int x) { return x * 27; }
+inline int f7312_28(int x) { return x * 28; }
+inline int f7312_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7317 */
+#include <vector>
+#include "h6234.h"
+#include "h2624.h"
+#include "h6703.h"
+#include "h6519.h"
+#include "h1668.h"
+#ifdef X
+#include "h8848.h"
+#endif
+struct S7317 { int a; const char *s = "x//y"; };
+inline int f7317_0(int x) { return x * 0; }
+inline int f7317_1(int x) { return x * 1; }
+inline int f7317_2(int x) { return x * 2; }
+inline int f7317_3(int x) { return x * 3; }
+inline int f7317_4(int x) { return x * 4; }
+inline int f7317_5(int x) { return x * 5; }
+inline int f7317_6(int x) { return x * 6; }
+inline int f7317_7(int x) { return x * 7; }
+inline int f7317_8(int x) { return x * 8; }
+inline int f7317_9(int x) { return x * 9; }
+inline int f7317_10(int x) { return x * 10; }
+inline int f7317_11(int x) { return x * 11; }
+inline int f7317_12(int x) { return x * 12; }
+inline int f7317_13(int x) { return x * 13; }
+inline int f7317_14(int x) { return x * 14; }
+inline int f7317_15(int x) { return x * 15; }
+inline int f7317_16(int x) { return x * 16; }
+inline int f7317_17(int x) { return x * 17; }
+inline int f7317_18(int x) { return x * 18; }
+inline int f7317_19(int x) { return x * 19; }
+inline int f7317_20(int x) { return x * 20; }
+inline int f7317_21(int x) { return x * 21; }
+inline int f7317_22(int x) { return x * 22; }
+inline int f7317_23(int x) { return x * 23; }
+inline int f7317_24(int x) { return x * 24; }
+inline int f7317_25(int x) { return x * 25; }
+inline int f7317_26(int x) { return x * 26; }
+inline int f7317_27(int x) { return x * 27; }
+inline int f7317_28(int x) { return x * 28; }
+inline int f7317_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7331 */
+#include <vector>
+#include "h7989.h"
+#include "h8368.h"
+#include "h8878.h"
+#include "h8254.h"
+#include "h3540.h"
+#ifdef X
+#include "h3148.h"
+#endif
+struct S7331 { int a; const char *s = "x//y"; };
+inline int f7331_0(int x) { return x * 0; }
+inline int f7331_1(int x) { return x * 1; }
+inline int f7331_2(int x) { return x * 2; }
+inline int f7331_3(int x) { return x * 3; }
+inline int f7331_4(int x) { return x * 4; }
+inline int f7331_5(int x) { return x * 5; }
+inline int f7331_6(int x) { return x * 6; }
+inline int f7331_7(int x) { return x * 7; }
+inline int f7331_8(int x) { return x * 8; }
+inline int f7331_9(int x) { return x * 9; }
+inline int f7331_10(int x) { return x * 10; }
+inline int f7331_11(int x) { return x * 11; }
+inline int f7331_12(int x) { return x * 12; }
+inline int f7331_13(int x) { return x * 13; }
+inline int f7331_14(int x) { return x * 14; }
+inline int f7331_15(int x) { return x * 15; }
+inline int f7331_16(int x) { return x * 16; }
+inline int f7331_17(int x) { return x * 17; }
+inline int f7331_18(int x) { return x * 18; }
+inline int f7331_19(int x) { return x * 19; }
+inline int f7331_20(int x) { return x * 20; }
+inline int f7331_21(int x) { return x * 21; }
+inline int f7331_22(int x) { return x * 22; }
+inline int f7331_23(int x) { return x * 23; }
+inline int f7331_24(int x) { return x * 24; }
+inline int f7331_25(int x) { return x * 25; }
+inline int f7331_26(int x) { return x * 26; }
+inline int f7331_27(int x) { return x * 27; }
+inline int f7331_28(int x) { return x * 28; }
+inline int f7331_29(int x) { return x * 29; }
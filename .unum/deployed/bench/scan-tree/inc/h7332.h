@@ -0,0 +1,42 @@
+#pragma once
+/* header 7332 */
+#include <vector>
+#include "h2818.h"
+#include "h5712.h"
+#include "h7766.h"
+#include "h8694.h"
+#include "h6845.h"
+#ifdef X
+#include "h1816.h"
+#endif
+struct S7332 { int a; const char *s = "x//y"; };
+inline int f7332_0(int x) { return x * 0; }
+inline int f7332_1(int x) { return x * 1; }
+inline int f7332_2(int x) { return x * 2; }
+inline int f7332_3(int x) { return x * 3; }
+inline int f7332_4(int x) { return x * 4; }
+inline int f7332_5(int x) { return x * 5; }
+inline int f7332_6(int x) { return x * 6; }
+inline int f7332_7(int x) { return x * 7; }
+inline int f7332_8(int x) { return x * 8; }
+inline int f7332_9(int x) { return x * 9; }
+inline int f7332_10(int x) { return x * 10; }
+inline int f7332_11(int x) { return x * 11; }
+inline int f7332_12(int x) { return x * 12; }
+inline int f7332_13(int x) { return x * 13; }
+inline int f7332_14(int x) { return x * 14; }
+inline int f7332_15(int x) { return x * 15; }
+inline int f7332_16(int x) { return x * 16; }
+inline int f7332_17(int x) { return x * 17; }
+inline int f7332_18(int x) { return x * 18; }
+inline int f7332_19(int x) { return x * 19; }
+inline int f7332_20(int x) { return x * 20; }
+inline int f7332_21(int x) { return x * 21; }
+inline int f7332_22(int x) { return x * 22; }
+inline int f7332_23(int x) { return x * 23; }
+inline int f7332_24(int x) { return x * 24; }
+inline int f7332_25(int x) { return x * 25; }
+inline int f7332_26(int x) { return x * 26; }
+inline int f7332_27(int x) { return x * 27; }
+inline int f7332_28(int x) { return x * 28; }
+inline int f7332_29(int x) { return x * 29; }
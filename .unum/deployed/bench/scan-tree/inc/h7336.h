@@ -0,0 +1,42 @@
+#pragma once
+/* header 7336 */
+#include <vector>
+#include "h3060.h"
+#include "h1404.h"
+#include "h9495.h"
+#include "h6343.h"
+#include "h4013.h"
+#ifdef X
+#include "h8984.h"
+#endif
+struct S7336 { int a; const char *s = "x//y"; };
+inline int f7336_0(int x) { return x * 0; }
+inline int f7336_1(int x) { return x * 1; }
+inline int f7336_2(int x) { return x * 2; }
+inline int f7336_3(int x) { return x * 3; }
+inline int f7336_4(int x) { return x * 4; }
+inline int f7336_5(int x) { return x * 5; }
+inline int f7336_6(int x) { return x * 6; }
+inline int f7336_7(int x) { return x * 7; }
+inline int f7336_8(int x) { return x * 8; }
+inline int f7336_9(int x) { return x * 9; }
+inline int f7336_10(int x) { return x * 10; }
+inline int f7336_11(int x) { return x * 11; }
+inline int f7336_12(int x) { return x * 12; }
+inline int f7336_13(int x) { return x * 13; }
+inline int f7336_14(int x) { return x * 14; }
+inline int f7336_15(int x) { return x * 15; }
+inline int f7336_16(int x) { return x * 16; }
+inline int f7336_17(int x) { return x * 17; }
+inline int f7336_18(int x) { return x * 18; }
+inline int f7336_19(int x) { return x * 19; }
+inline int f7336_20(int x) { return x * 20; }
+inline int f7336_21(int x) { return x * 21; }
+inline int f7336_22(int x) { return x * 22; }
+inline int f7336_23(int x) { return x * 23; }
+inline int f7336_24(int x) { return x * 24; }
+inline int f7336_25(int x) { return x * 25; }
+inline int f7336_26(int x) { return x * 26; }
+inline int f7336_27(int x) { return x * 27; }
+inline int f7336_28(int x) { return x * 28; }
+inline int f7336_29(int x) { return x * 29; }
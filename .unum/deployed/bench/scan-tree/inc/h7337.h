@@ -0,0 +1,42 @@
+#pragma once
+/* header 7337 */
+#include <vector>
+#include "h6677.h"
+#include "h852.h"
+#include "h5510.h"
+#include "h971.h"
+#include "h4563.h"
+#ifdef X
+#include "h8049.h"
+#endif
+struct S7337 { int a; const char *s = "x//y"; };
+inline int f7337_0(int x) { return x * 0; }
+inline int f7337_1(int x) { return x * 1; }
+inline int f7337_2(int x) { return x * 2; }
+inline int f7337_3(int x) { return x * 3; }
+inline int f7337_4(int x) { return x * 4; }
+inline int f7337_5(int x) { return x * 5; }
+inline int f7337_6(int x) { return x * 6; }
+inline int f7337_7(int x) { return x * 7; }
+inline int f7337_8(int x) { return x * 8; }
+inline int f7337_9(int x) { return x * 9; }
+inline int f7337_10(int x) { return x * 10; }
+inline int f7337_11(int x) { return x * 11; }
+inline int f7337_12(int x) { return x * 12; }
+inline int f7337_13(int x) { return x * 13; }
+inline int f7337_14(int x) { return x * 14; }
+inline int f7337_15(int x) { return x * 15; }
+inline int f7337_16(int x) { return x * 16; }
+inline int f7337_17(int x) { return x * 17; }
+inline int f7337_18(int x) { return x * 18; }
+inline int f7337_19(int x) { return x * 19; }
+inline int f7337_20(int x) { return x * 20; }
+inline int f7337_21(int x) { return x * 21; }
+inline int f7337_22(int x) { return x * 22; }
+inline int f7337_23(int x) { return x * 23; }
+inline int f7337_24(int x) { return x * 24; }
+inline int f7337_25(int x) { return x * 25; }
+inline int f7337_26(int x) { return x * 26; }
+inline int f7337_27(int x) { return x * 27; }
+inline int f7337_28(int x) { return x * 28; }
+inline int f7337_29(int x) { return x * 29; }
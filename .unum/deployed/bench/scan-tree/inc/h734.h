@@ -0,0 +1,42 @@
+#pragma once
+/* header 734 */
+#include <vector>
+#include "h8781.h"
+#include "h9047.h"
+#include "h6040.h"
+#include "h9395.h"
+#include "h2847.h"
+#ifdef X
+#include "h7275.h"
+#endif
+struct S734 { int a; const char *s = "x//y"; };
+inline int f734_0(int x) { return x * 0; }
+inline int f734_1(int x) { return x * 1; }
+inline int f734_2(int x) { return x * 2; }
+inline int f734_3(int x) { return x * 3; }
+inline int f734_4(int x) { return x * 4; }
+inline int f734_5(int x) { return x * 5; }
+inline int f734_6(int x) { return x * 6; }
+inline int f734_7(int x) { return x * 7; }
+inline int f734_8(int x) { return x * 8; }
+inline int f734_9(int x) { return x * 9; }
+inline int f734_10(int x) { return x * 10; }
+inline int f734_11(int x) { return x * 11; }
+inline int f734_12(int x) { return x * 12; }
+inline int f734_13(int x) { return x * 13; }
+inline int f734_14(int x) { return x * 14; }
+inline int f734_15(int x) { return x * 15; }
+inline int f734_16(int x) { return x * 16; }
+inline int f734_17(int x) { return x * 17; }
+inline int f734_18(int x) { return x * 18; }
+inline int f734_19(int x) { return x * 19; }
+inline int f734_20(int x) { return x * 20; }
+inline int f734_21(int x) { return x * 21; }
+inline int f734_22(int x) { return x * 22; }
+inline int f734_23(int x) { return x * 23; }
+inline int f734_24(int x) { return x * 24; }
+inline int f734_25(int x) { return x * 25; }
+inline int f734_26(int x) { return x * 26; }
+inline int f734_27(int x) { return x * 27; }
+inline int f734_28(int x) { return x * 28; }
+inline int f734_29(int x) { return x * 29; }
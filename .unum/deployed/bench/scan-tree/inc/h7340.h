@@ -0,0 +1,42 @@
+#pragma once
+/* header 7340 */
+#include <vector>
+#include "h2236.h"
+#include "h9646.h"
+#include "h9557.h"
+#include "h2804.h"
+#include "h4939.h"
+#ifdef X
+#include "h9304.h"
+#endif
+struct S7340 { int a; const char *s = "x//y"; };
+inline int f7340_0(int x) { return x * 0; }
+inline int f7340_1(int x) { return x * 1; }
+inline int f7340_2(int x) { return x * 2; }
+inline int f7340_3(int x) { return x * 3; }
+inline int f7340_4(int x) { return x * 4; }
+inline int f7340_5(int x) { return x * 5; }
+inline int f7340_6(int x) { return x * 6; }
+inline int f7340_7(int x) { return x * 7; }
+inline int f7340_8(int x) { return x * 8; }
+inline int f7340_9(int x) { return x * 9; }
+inline int f7340_10(int x) { return x * 10; }
+inline int f7340_11(int x) { return x * 11; }
+inline int f7340_12(int x) { return x * 12; }
+inline int f7340_13(int x) { return x * 13; }
+inline int f7340_14(int x) { return x * 14; }
+inline int f7340_15(int x) { return x * 15; }
+inline int f7340_16(int x) { return x * 16; }
+inline int f7340_17(int x) { return x * 17; }
+inline int f7340_18(int x) { return x * 18; }
+inline int f7340_19(int x) { return x * 19; }
+inline int f7340_20(int x) { return x * 20; }
+inline int f7340_21(int x) { return x * 21; }
+inline int f7340_22(int x) { return x * 22; }
+inline int f7340_23(int x) { return x * 23; }
+inline int f7340_24(int x) { return x * 24; }
+inline int f7340_25(int x) { return x * 25; }
+inline int f7340_26(int x) { return x * 26; }
+inline int f7340_27(int x) { return x * 27; }
+inline int f7340_28(int x) { return x * 28; }
+inline int f7340_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7341 */
+#include <vector>
+#include "h3515.h"
+#include "h2455.h"
+#include "h7567.h"
+#include "h1099.h"
+#include "h9503.h"
+#ifdef X
+#include "h3618.h"
+#endif
+struct S7341 { int a; const char *s = "x//y"; };
+inline int f7341_0(int x) { return x * 0; }
+inline int f7341_1(int x) { return x * 1; }
+inline int f7341_2(int x) { return x * 2; }
+inline int f7341_3(int x) { return x * 3; }
+inline int f7341_4(int x) { return x * 4; }
+inline int f7341_5(int x) { return x * 5; }
+inline int f7341_6(int x) { return x * 6; }
+inline int f7341_7(int x) { return x * 7; }
+inline int f7341_8(int x) { return x * 8; }
+inline int f7341_9(int x) { return x * 9; }
+inline int f7341_10(int x) { return x * 10; }
+inline int f7341_11(int x) { return x * 11; }
+inline int f7341_12(int x) { return x * 12; }
+inline int f7341_13(int x) { return x * 13; }
+inline int f7341_14(int x) { return x * 14; }
+inline int f7341_15(int x) { return x * 15; }
+inline int f7341_16(int x) { return x * 16; }
+inline int f7341_17(int x) { return x * 17; }
+inline int f7341_18(int x) { return x * 18; }
+inline int f7341_19(int x) { return x * 19; }
+inline int f7341_20(int x) { return x * 20; }
+inline int f7341_21(int x) { return x * 21; }
+inline int f7341_22(int x) { return x * 22; }
+inline int f7341_23(int x) { return x * 23; }
+inline int f7341_24(int x) { return x * 24; }
+inline int f7341_25(int x) { return x * 25; }
+inline int f7341_26(int x) { return x * 26; }
+inline int f7341_27(int x) { return x * 27; }
+inline int f7341_28(int x) { return x * 28; }
+inline int f7341_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7344 */
+#include <vector>
+#include "h5899.h"
+#include "h6537.h"
+#include "h33.h"
+#include "h1571.h"
+#include "h8217.h"
+#ifdef X
+#include "h7522.h"
+#endif
+struct S7344 { int a; const char *s = "x//y"; };
+inline int f7344_0(int x) { return x * 0; }
+inline int f7344_1(int x) { return x * 1; }
+inline int f7344_2(int x) { return x * 2; }
+inline int f7344_3(int x) { return x * 3; }
+inline int f7344_4(int x) { return x * 4; }
+inline int f7344_5(int x) { return x * 5; }
+inline int f7344_6(int x) { return x * 6; }
+inline int f7344_7(int x) { return x * 7; }
+inline int f7344_8(int x) { return x * 8; }
+inline int f7344_9(int x) { return x * 9; }
+inline int f7344_10(int x) { return x * 10; }
+inline int f7344_11(int x) { return x * 11; }
+inline int f7344_12(int x) { return x * 12; }
+inline int f7344_13(int x) { return x * 13; }
+inline int f7344_14(int x) { return x * 14; }
+inline int f7344_15(int x) { return x * 15; }
+inline int f7344_16(int x) { return x * 16; }
+inline int f7344_17(int x) { return x * 17; }
+inline int f7344_18(int x) { return x * 18; }
+inline int f7344_19(int x) { return x * 19; }
+inline int f7344_20(int x) { return x * 20; }
+inline int f7344_21(int x) { return x * 21; }
+inline int f7344_22(int x) { return x * 22; }
+inline int f7344_23(int x) { return x * 23; }
+inline int f7344_24(int x) { return x * 24; }
+inline int f7344_25(int x) { return x * 25; }
+inline int f7344_26(int x) { return x * 26; }
+inline int f7344_27(int x) { return x * 27; }
+inline int f7344_28(int x) { return x * 28; }
+inline int f7344_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7347 */
+#include <vector>
+#include "h6761.h"
+#include "h1481.h"
+#include "h2271.h"
+#include "h6569.h"
+#include "h9752.h"
+#ifdef X
+#include "h5171.h"
+#endif
+struct S7347 { int a; const char *s = "x//y"; };
+inline int f7347_0(int x) { return x * 0; }
+inline int f7347_1(int x) { return x * 1; }
+inline int f7347_2(int x) { return x * 2; }
+inline int f7347_3(int x) { return x * 3; }
+inline int f7347_4(int x) { return x * 4; }
+inline int f7347_5(int x) { return x * 5; }
+inline int f7347_6(int x) { return x * 6; }
+inline int f7347_7(int x) { return x * 7; }
+inline int f7347_8(int x) { return x * 8; }
+inline int f7347_9(int x) { return x * 9; }
+inline int f7347_10(int x) { return x * 10; }
+inline int f7347_11(int x) { return x * 11; }
+inline int f7347_12(int x) { return x * 12; }
+inline int f7347_13(int x) { return x * 13; }
+inline int f7347_14(int x) { return x * 14; }
+inline int f7347_15(int x) { return x * 15; }
+inline int f7347_16(int x) { return x * 16; }
+inline int f7347_17(int x) { return x * 17; }
+inline int f7347_18(int x) { return x * 18; }
+inline int f7347_19(int x) { return x * 19; }
+inline int f7347_20(int x) { return x * 20; }
+inline int f7347_21(int x) { return x * 21; }
+inline int f7347_22(int x) { return x * 22; }
+inline int f7347_23(int x) { return x * 23; }
+inline int f7347_24(int x) { return x * 24; }
+inline int f7347_25(int x) { return x * 25; }
+inline int f7347_26(int x) { return x * 26; }
+inline int f7347_27(int x) { return x * 27; }
+inline int f7347_28(int x) { return x * 28; }
+inline int f7347_29(int x) { return x * 29; }
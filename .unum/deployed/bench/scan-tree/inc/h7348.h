@@ -0,0 +1,42 @@
+#pragma once
+/* header 7348 */
+#include <vector>
+#include "h3844.h"
+#include "h3203.h"
+#include "h7475.h"
+#include "h1985.h"
+#include "h8231.h"
+#ifdef X
+#include "h1348.h"
+#endif
+struct S7348 { int a; const char *s = "x//y"; };
+inline int f7348_0(int x) { return x * 0; }
+inline int f7348_1(int x) { return x * 1; }
+inline int f7348_2(int x) { return x * 2; }
+inline int f7348_3(int x) { return x * 3; }
+inline int f7348_4(int x) { return x * 4; }
+inline int f7348_5(int x) { return x * 5; }
+inline int f7348_6(int x) { return x * 6; }
+inline int f7348_7(int x) { return x * 7; }
+inline int f7348_8(int x) { return x * 8; }
+inline int f7348_9(int x) { return x * 9; }
+inline int f7348_10(int x) { return x * 10; }
+inline int f7348_11(int x) { return x * 11; }
+inline int f7348_12(int x) { return x * 12; }
+inline int f7348_13(int x) { return x * 13; }
+inline int f7348_14(int x) { return x * 14; }
+inline int f7348_15(int x) { return x * 15; }
+inline int f7348_16(int x) { return x * 16; }
+inline int f7348_17(int x) { return x * 17; }
+inline int f7348_18(int x) { return x * 18; }
+inline int f7348_19(int x) { return x * 19; }
+inline int f7348_20(int x) { return x * 20; }
+inline int f7348_21(int x) { return x * 21; }
+inline int f7348_22(int x) { return x * 22; }
+inline int f7348_23(int x) { return x * 23; }
+inline int f7348_24(int x) { return x * 24; }
+inline int f7348_25(int x) { return x * 25; }
+inline int f7348_26(int x) { return x * 26; }
+inline int f7348_27(int x) { return x * 27; }
+inline int f7348_28(int x) { return x * 28; }
+inline int f7348_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 735 */
+#include <vector>
+#include "h6215.h"
+#include "h9201.h"
+#include "h9424.h"
+#include "h2755.h"
+#include "h8659.h"
+#ifdef X
+#include "h5821.h"
+#endif
+struct S735 { int a; const char *s = "x//y"; };
+inline int f735_0(int x) { return x * 0; }
+inline int f735_1(int x) { return x * 1; }
+inline int f735_2(int x) { return x * 2; }
+inline int f735_3(int x) { return x * 3; }
+inline int f735_4(int x) { return x * 4; }
+inline int f735_5(int x) { return x * 5; }
+inline int f735_6(int x) { return x * 6; }
+inline int f735_7(int x) { return x * 7; }
+inline int f735_8(int x) { return x * 8; }
+inline int f735_9(int x) { return x * 9; }
+inline int f735_10(int x) { return x * 10; }
+inline int f735_11(int x) { return x * 11; }
+inline int f735_12(int x) { return x * 12; }
+inline int f735_13(int x) { return x * 13; }
+inline int f735_14(int x) { return x * 14; }
+inline int f735_15(int x) { return x * 15; }
+inline int f735_16(int x) { return x * 16; }
+inline int f735_17(int x) { return x * 17; }
+inline int f735_18(int x) { return x * 18; }
+inline int f735_19(int x) { return x * 19; }
+inline int f735_20(int x) { return x * 20; }
+inline int f735_21(int x) { return x * 21; }
+inline int f735_22(int x) { return x * 22; }
+inline int f735_23(int x) { return x * 23; }
+inline int f735_24(int x) { return x * 24; }
+inline int f735_25(int x) { return x * 25; }
+inline int f735_26(int x) { return x * 26; }
+inline int f735_27(int x) { return x * 27; }
+inline int f735_28(int x) { return x * 28; }
+inline int f735_29(int x) { return x * 29; }
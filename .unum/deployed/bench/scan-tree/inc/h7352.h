@@ -0,0 +1,42 @@
+#pragma once
+/* header 7352 */
+#include <vector>
+#include "h8803.h"
+#include "h940.h"
+#include "h4204.h"
+#include "h964.h"
+#include "h5856.h"
+#ifdef X
+#include "h8285.h"
+#endif
+struct S7352 { int a; const char *s = "x//y"; };
+inline int f7352_0(int x) { return x * 0; }
+inline int f7352_1(int x) { return x * 1; }
+inline int f7352_2(int x) { return x * 2; }
+inline int f7352_3(int x) { return x * 3; }
+inline int f7352_4(int x) { return x * 4; }
+inline int f7352_5(int x) { return x * 5; }
+inline int f7352_6(int x) { return x * 6; }
+inline int f7352_7(int x) { return x * 7; }
+inline int f7352_8(int x) { return x * 8; }
+inline int f7352_9(int x) { return x * 9; }
+inline int f7352_10(int x) { return x * 10; }
+inline int f7352_11(int x) { return x * 11; }
+inline int f7352_12(int x) { return x * 12; }
+inline int f7352_13(int x) { return x * 13; }
+inline int f7352_14(int x) { return x * 14; }
+inline int f7352_15(int x) { return x * 15; }
+inline int f7352_16(int x) { return x * 16; }
+inline int f7352_17(int x) { return x * 17; }
+inline int f7352_18(int x) { return x * 18; }
+inline int f7352_19(int x) { return x * 19; }
+inline int f7352_20(int x) { return x * 20; }
+inline int f7352_21(int x) { return x * 21; }
+inline int f7352_22(int x) { return x * 22; }
+inline int f7352_23(int x) { return x * 23; }
+inline int f7352_24(int x) { return x * 24; }
+inline int f7352_25(int x) { return x * 25; }
+inline int f7352_26(int x) { return x * 26; }
+inline int f7352_27(int x) { return x * 27; }
+inline int f7352_28(int x) { return x * 28; }
+inline int f7352_29(int x) { return x * 29; }
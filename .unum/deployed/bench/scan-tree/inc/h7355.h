@@ -0,0 +1,42 @@
+#pragma once
+/* header 7355 */
+#include <vector>
+#include "h705.h"
+#include "h305.h"
+#include "h9929.h"
+#include "h1771.h"
+#include "h7076.h"
+#ifdef X
+#include "h5670.h"
+#endif
+struct S7355 { int a; const char *s = "x//y"; };
+inline int f7355_0(int x) { return x * 0; }
+inline int f7355_1(int x) { return x * 1; }
+inline int f7355_2(int x) { return x * 2; }
+inline int f7355_3(int x) { return x * 3; }
+inline int f7355_4(int x) { return x * 4; }
+inline int f7355_5(int x) { return x * 5; }
+inline int f7355_6(int x) { return x * 6; }
+inline int f7355_7(int x) { return x * 7; }
+inline int f7355_8(int x) { return x * 8; }
+inline int f7355_9(int x) { return x * 9; }
+inline int f7355_10(int x) { return x * 10; }
+inline int f7355_11(int x) { return x * 11; }
+inline int f7355_12(int x) { return x * 12; }
+inline int f7355_13(int x) { return x * 13; }
+inline int f7355_14(int x) { return x * 14; }
+inline int f7355_15(int x) { return x * 15; }
+inline int f7355_16(int x) { return x * 16; }
+inline int f7355_17(int x) { return x * 17; }
+inline int f7355_18(int x) { return x * 18; }
+inline int f7355_19(int x) { return x * 19; }
+inline int f7355_20(int x) { return x * 20; }
+inline int f7355_21(int x) { return x * 21; }
+inline int f7355_22(int x) { return x * 22; }
+inline int f7355_23(int x) { return x * 23; }
+inline int f7355_24(int x) { return x * 24; }
+inline int f7355_25(int x) { return x * 25; }
+inline int f7355_26(int x) { return x * 26; }
+inline int f7355_27(int x) { return x * 27; }
+inline int f7355_28(int x) { return x * 28; }
+inline int f7355_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7356 */
+#include <vector>
+#include "h6029.h"
+#include "h6697.h"
+#include "h8216.h"
+#include "h6124.h"
+#include "h1948.h"
+#ifdef X
+#include "h786.h"
+#endif
+struct S7356 { int a; const char *s = "x//y"; };
+inline int f7356_0(int x) { return x * 0; }
+inline int f7356_1(int x) { return x * 1; }
+inline int f7356_2(int x) { return x * 2; }
+inline int f7356_3(int x) { return x * 3; }
+inline int f7356_4(int x) { return x * 4; }
+inline int f7356_5(int x) { return x * 5; }
+inline int f7356_6(int x) { return x * 6; }
+inline int f7356_7(int x) { return x * 7; }
+inline int f7356_8(int x) { return x * 8; }
+inline int f7356_9(int x) { return x * 9; }
+inline int f7356_10(int x) { return x * 10; }
+inline int f7356_11(int x) { return x * 11; }
+inline int f7356_12(int x) { return x * 12; }
+inline int f7356_13(int x) { return x * 13; }
+inline int f7356_14(int x) { return x * 14; }
+inline int f7356_15(int x) { return x * 15; }
+inline int f7356_16(int x) { return x * 16; }
+inline int f7356_17(int x) { return x * 17; }
+inline int f7356_18(int x) { return x * 18; }
+inline int f7356_19(int x) { return x * 19; }
+inline int f7356_20(int x) { return x * 20; }
+inline int f7356_21(int x) { return x * 21; }
+inline int f7356_22(int x) { return x * 22; }
+inline int f7356_23(int x) { return x * 23; }
+inline int f7356_24(int x) { return x * 24; }
+inline int f7356_25(int x) { return x * 25; }
+inline int f7356_26(int x) { return x * 26; }
+inline int f7356_27(int x) { return x * 27; }
+inline int f7356_28(int x) { return x * 28; }
+inline int f7356_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7357 */
+#include <vector>
+#include "h1628.h"
+#include "h2684.h"
+#include "h3675.h"
+#include "h5981.h"
+#include "h5110.h"
+#ifdef X
+#include "h5891.h"
+#endif
+struct S7357 { int a; const char *s = "x//y"; };
+inline int f7357_0(int x) { return x * 0; }
+inline int f7357_1(int x) { return x * 1; }
+inline int f7357_2(int x) { return x * 2; }
+inline int f7357_3(int x) { return x * 3; }
+inline int f7357_4(int x) { return x * 4; }
+inline int f7357_5(int x) { return x * 5; }
+inline int f7357_6(int x) { return x * 6; }
+inline int f7357_7(int x) { return x * 7; }
+inline int f7357_8(int x) { return x * 8; }
+inline int f7357_9(int x) { return x * 9; }
+inline int f7357_10(int x) { return x * 10; }
+inline int f7357_11(int x) { return x * 11; }
+inline int f7357_12(int x) { return x * 12; }
+inline int f7357_13(int x) { return x * 13; }
+inline int f7357_14(int x) { return x * 14; }
+inline int f7357_15(int x) { return x * 15; }
+inline int f7357_16(int x) { return x * 16; }
+inline int f7357_17(int x) { return x * 17; }
+inline int f7357_18(int x) { return x * 18; }
+inline int f7357_19(int x) { return x * 19; }
+inline int f7357_20(int x) { return x * 20; }
+inline int f7357_21(int x) { return x * 21; }
+inline int f7357_22(int x) { return x * 22; }
+inline int f7357_23(int x) { return x * 23; }
+inline int f7357_24(int x) { return x * 24; }
+inline int f7357_25(int x) { return x * 25; }
+inline int f7357_26(int x) { return x * 26; }
+inline int f7357_27(int x) { return x * 27; }
+inline int f7357_28(int x) { return x * 28; }
+inline int f7357_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7361 */
+#include <vector>
+#include "h8081.h"
+#include "h8826.h"
+#include "h4389.h"
+#include "h7561.h"
+#include "h5014.h"
+#ifdef X
+#include "h6219.h"
+#endif
+struct S7361 { int a; const char *s = "x//y"; };
+inline int f7361_0(int x) { return x * 0; }
+inline int f7361_1(int x) { return x * 1; }
+inline int f7361_2(int x) { return x * 2; }
+inline int f7361_3(int x) { return x * 3; }
+inline int f7361_4(int x) { return x * 4; }
+inline int f7361_5(int x) { return x * 5; }
+inline int f7361_6(int x) { return x * 6; }
+inline int f7361_7(int x) { return x * 7; }
+inline int f7361_8(int x) { return x * 8; }
+inline int f7361_9(int x) { return x * 9; }
+inline int f7361_10(int x) { return x * 10; }
+inline int f7361_11(int x) { return x * 11; }
+inline int f7361_12(int x) { return x * 12; }
+inline int f7361_13(int x) { return x * 13; }
+inline int f7361_14(int x) { return x * 14; }
+inline int f7361_15(int x) { return x * 15; }
+inline int f7361_16(int x) { return x * 16; }
+inline int f7361_17(int x) { return x * 17; }
+inline int f7361_18(int x) { return x * 18; }
+inline int f7361_19(int x) { return x * 19; }
+inline int f7361_20(int x) { return x * 20; }
+inline int f7361_21(int x) { return x * 21; }
+inline int f7361_22(int x) { return x * 22; }
+inline int f7361_23(int x) { return x * 23; }
+inline int f7361_24(int x) { return x * 24; }
+inline int f7361_25(int x) { return x * 25; }
+inline int f7361_26(int x) { return x * 26; }
+inline int f7361_27(int x) { return x * 27; }
+inline int f7361_28(int x) { return x * 28; }
+inline int f7361_29(int x) { return x * 29; }
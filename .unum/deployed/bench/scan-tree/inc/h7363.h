@@ -0,0 +1,42 @@
+#pragma once
+/* header 7363 */
+#include <vector>
+#include "h9913.h"
+#include "h8711.h"
+#include "h932.h"
+#include "h7770.h"
+#include "h7136.h"
+#ifdef X
+#include "h2009.h"
+#endif
+struct S7363 { int a; const char *s = "x//y"; };
+inline int f7363_0(int x) { return x * 0; }
+inline int f7363_1(int x) { return x * 1; }
+inline int f7363_2(int x) { return x * 2; }
+inline int f7363_3(int x) { return x * 3; }
+inline int f7363_4(int x) { return x * 4; }
+inline int f7363_5(int x) { return x * 5; }
+inline int f7363_6(int x) { return x * 6; }
+inline int f7363_7(int x) { return x * 7; }
+inline int f7363_8(int x) { return x * 8; }
+inline int f7363_9(int x) { return x * 9; }
+inline int f7363_10(int x) { return x * 10; }
+inline int f7363_11(int x) { return x * 11; }
+inline int f7363_12(int x) { return x * 12; }
+inline int f7363_13(int x) { return x * 13; }
+inline int f7363_14(int x) { return x * 14; }
+inline int f7363_15(int x) { return x * 15; }
+inline int f7363_16(int x) { return x * 16; }
+inline int f7363_17(int x) { return x * 17; }
+inline int f7363_18(int x) { return x * 18; }
+inline int f7363_19(int x) { return x * 19; }
+inline int f7363_20(int x) { return x * 20; }
+inline int f7363_21(int x) { return x * 21; }
+inline int f7363_22(int x) { return x * 22; }
+inline int f7363_23(int x) { return x * 23; }
+inline int f7363_24(int x) { return x * 24; }
+inline int f7363_25(int x) { return x * 25; }
+inline int f7363_26(int x) { return x * 26; }
+inline int f7363_27(int x) { return x * 27; }
+inline int f7363_28(int x) { return x * 28; }
+inline int f7363_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 737 */
+#include <vector>
+#include "h4830.h"
+#include "h3286.h"
+#include "h4081.h"
+#include "h7786.h"
+#include "h7575.h"
+#ifdef X
+#include "h8330.h"
+#endif
+struct S737 { int a; const char *s = "x//y"; };
+inline int f737_0(int x) { return x * 0; }
+inline int f737_1(int x) { return x * 1; }
+inline int f737_2(int x) { return x * 2; }
+inline int f737_3(int x) { return x * 3; }
+inline int f737_4(int x) { return x * 4; }
+inline int f737_5(int x) { return x * 5; }
+inline int f737_6(int x) { return x * 6; }
+inline int f737_7(int x) { return x * 7; }
+inline int f737_8(int x) { return x * 8; }
+inline int f737_9(int x) { return x * 9; }
+inline int f737_10(int x) { return x * 10; }
+inline int f737_11(int x) { return x * 11; }
+inline int f737_12(int x) { return x * 12; }
+inline int f737_13(int x) { return x * 13; }
+inline int f737_14(int x) { return x * 14; }
+inline int f737_15(int x) { return x * 15; }
+inline int f737_16(int x) { return x * 16; }
+inline int f737_17(int x) { return x * 17; }
+inline int f737_18(int x) { return x * 18; }
+inline int f737_19(int x) { return x * 19; }
+inline int f737_20(int x) { return x * 20; }
+inline int f737_21(int x) { return x * 21; }
+inline int f737_22(int x) { return x * 22; }
+inline int f737_23(int x) { return x * 23; }
+inline int f737_24(int x) { return x * 24; }
+inline int f737_25(int x) { return x * 25; }
+inline int f737_26(int x) { return x * 26; }
+inline int f737_27(int x) { return x * 27; }
+inline int f737_28(int x) { return x * 28; }
+inline int f737_29(int x) { return x * 29; }
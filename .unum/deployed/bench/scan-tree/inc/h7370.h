@@ -0,0 +1,42 @@
+#pragma once
+/* header 7370 */
+#include <vector>
+#include "h7089.h"
+#include "h4697.h"
+#include "h650.h"
+#include "h724.h"
+#include "h156.h"
+#ifdef X
+#include "h2392.h"
+#endif
+struct S7370 { int a; const char *s = "x//y"; };
+inline int f7370_0(int x) { return x * 0; }
+inline int f7370_1(int x) { return x * 1; }
+inline int f7370_2(int x) { return x * 2; }
+inline int f7370_3(int x) { return x * 3; }
+inline int f7370_4(int x) { return x * 4; }
+inline int f7370_5(int x) { return x * 5; }
+inline int f7370_6(int x) { return x * 6; }
+inline int f7370_7(int x) { return x * 7; }
+inline int f7370_8(int x) { return x * 8; }
+inline int f7370_9(int x) { return x * 9; }
+inline int f7370_10(int x) { return x * 10; }
+inline int f7370_11(int x) { return x * 11; }
+inline int f7370_12(int x) { return x * 12; }
+inline int f7370_13(int x) { return x * 13; }
+inline int f7370_14(int x) { return x * 14; }
+inline int f7370_15(int x) { return x * 15; }
+inline int f7370_16(int x) { return x * 16; }
+inline int f7370_17(int x) { return x * 17; }
+inline int f7370_18(int x) { return x * 18; }
+inline int f7370_19(int x) { return x * 19; }
+inline int f7370_20(int x) { return x * 20; }
+inline int f7370_21(int x) { return x * 21; }
+inline int f7370_22(int x) { return x * 22; }
+inline int f7370_23(int x) { return x * 23; }
+inline int f7370_24(int x) { return x * 24; }
+inline int f7370_25(int x) { return x * 25; }
+inline int f7370_26(int x) { return x * 26; }
+inline int f7370_27(int x) { return x * 27; }
+inline int f7370_28(int x) { return x * 28; }
+inline int f7370_29(int x) { return x * 29; }
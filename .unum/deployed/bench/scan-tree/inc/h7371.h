@@ -0,0 +1,42 @@
+#pragma once
+/* header 7371 */
+#include <vector>
+#include "h2223.h"
+#include "h9698.h"
+#include "h2523.h"
+#include "h2450.h"
+#include "h9474.h"
+#ifdef X
+#include "h3533.h"
+#endif
+struct S7371 { int a; const char *s = "x//y"; };
+inline int f7371_0(int x) { return x * 0; }
+inline int f7371_1(int x) { return x * 1; }
+inline int f7371_2(int x) { return x * 2; }
+inline int f7371_3(int x) { return x * 3; }
+inline int f7371_4(int x) { return x * 4; }
+inline int f7371_5(int x) { return x * 5; }
+inline int f7371_6(int x) { return x * 6; }
+inline int f7371_7(int x) { return x * 7; }
+inline int f7371_8(int x) { return x * 8; }
+inline int f7371_9(int x) { return x * 9; }
+inline int f7371_10(int x) { return x * 10; }
+inline int f7371_11(int x) { return x * 11; }
+inline int f7371_12(int x) { return x * 12; }
+inline int f7371_13(int x) { return x * 13; }
+inline int f7371_14(int x) { return x * 14; }
+inline int f7371_15(int x) { return x * 15; }
+inline int f7371_16(int x) { return x * 16; }
+inline int f7371_17(int x) { return x * 17; }
+inline int f7371_18(int x) { return x * 18; }
+inline int f7371_19(int x) { return x * 19; }
+inline int f7371_20(int x) { return x * 20; }
+inline int f7371_21(int x) { return x * 21; }
+inline int f7371_22(int x) { return x * 22; }
+inline int f7371_23(int x) { return x * 23; }
+inline int f7371_24(int x) { return x * 24; }
+inline int f7371_25(int x) { return x * 25; }
+inline int f7371_26(int x) { return x * 26; }
+inline int f7371_27(int x) { return x * 27; }
+inline int f7371_28(int x) { return x * 28; }
+inline int f7371_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7373 */
+#include <vector>
+#include "h2106.h"
+#include "h5703.h"
+#include "h7340.h"
+#include "h5566.h"
+#include "h2038.h"
+#ifdef X
+#include "h4194.h"
+#endif
+struct S7373 { int a; const char *s = "x//y"; };
+inline int f7373_0(int x) { return x * 0; }
+inline int f7373_1(int x) { return x * 1; }
+inline int f7373_2(int x) { return x * 2; }
+inline int f7373_3(int x) { return x * 3; }
+inline int f7373_4(int x) { return x * 4; }
+inline int f7373_5(int x) { return x * 5; }
+inline int f7373_6(int x) { return x * 6; }
+inline int f7373_7(int x) { return x * 7; }
+inline int f7373_8(int x) { return x * 8; }
+inline int f7373_9(int x) { return x * 9; }
+inline int f7373_10(int x) { return x * 10; }
+inline int f7373_11(int x) { return x * 11; }
+inline int f7373_12(int x) { return x * 12; }
+inline int f7373_13(int x) { return x * 13; }
+inline int f7373_14(int x) { return x * 14; }
+inline int f7373_15(int x) { return x * 15; }
+inline int f7373_16(int x) { return x * 16; }
+inline int f7373_17(int x) { return x * 17; }
+inline int f7373_18(int x) { return x * 18; }
+inline int f7373_19(int x) { return x * 19; }
+inline int f7373_20(int x) { return x * 20; }
+inline int f7373_21(int x) { return x * 21; }
+inline int f7373_22(int x) { return x * 22; }
+inline int f7373_23(int x) { return x * 23; }
+inline int f7373_24(int x) { return x * 24; }
+inline int f7373_25(int x) { return x * 25; }
+inline int f7373_26(int x) { return x * 26; }
+inline int f7373_27(int x) { return x * 27; }
+inline int f7373_28(int x) { return x * 28; }
+inline int f7373_29(int x) { return x * 29; }
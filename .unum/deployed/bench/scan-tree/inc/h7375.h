@@ -0,0 +1,42 @@
+#pragma once
+/* header 7375 */
+#include <vector>
+#include "h3977.h"
+#include "h8285.h"
+#include "h6801.h"
+#include "h3343.h"
+#include "h2415.h"
+#ifdef X
+#include "h2997.h"
+#endif
+struct S7375 { int a; const char *s = "x//y"; };
+inline int f7375_0(int x) { return x * 0; }
+inline int f7375_1(int x) { return x * 1; }
+inline int f7375_2(int x) { return x * 2; }
+inline int f7375_3(int x) { return x * 3; }
+inline int f7375_4(int x) { return x * 4; }
+inline int f7375_5(int x) { return x * 5; }
+inline int f7375_6(int x) { return x * 6; }
+inline int f7375_7(int x) { return x * 7; }
+inline int f7375_8(int x) { return x * 8; }
+inline int f7375_9(int x) { return x * 9; }
+inline int f7375_10(int x) { return x * 10; }
+inline int f7375_11(int x) { return x * 11; }
+inline int f7375_12(int x) { return x * 12; }
+inline int f7375_13(int x) { return x * 13; }
+inline int f7375_14(int x) { return x * 14; }
+inline int f7375_15(int x) { return x * 15; }
+inline int f7375_16(int x) { return x * 16; }
+inline int f7375_17(int x) { return x * 17; }
+inline int f7375_18(int x) { return x * 18; }
+inline int f7375_19(int x) { return x * 19; }
+inline int f7375_20(int x) { return x * 20; }
+inline int f7375_21(int x) { return x * 21; }
+inline int f7375_22(int x) { return x * 22; }
+inline int f7375_23(int x) { return x * 23; }
+inline int f7375_24(int x) { return x * 24; }
+inline int f7375_25(int x) { return x * 25; }
+inline int f7375_26(int x) { return x * 26; }
+inline int f7375_27(int x) { return x * 27; }
+inline int f7375_28(int x) { return x * 28; }
+inline int f7375_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7376 */
+#include <vector>
+#include "h4141.h"
+#include "h3204.h"
+#include "h1349.h"
+#include "h2565.h"
+#include "h7907.h"
+#ifdef X
+#include "h9124.h"
+#endif
+struct S7376 { int a; const char *s = "x//y"; };
+inline int f7376_0(int x) { return x * 0; }
+inline int f7376_1(int x) { return x * 1; }
+inline int f7376_2(int x) { return x * 2; }
+inline int f7376_3(int x) { return x * 3; }
+inline int f7376_4(int x) { return x * 4; }
+inline int f7376_5(int x) { return x * 5; }
+inline int f7376_6(int x) { return x * 6; }
+inline int f7376_7(int x) { return x * 7; }
+inline int f7376_8(int x) { return x * 8; }
+inline int f7376_9(int x) { return x * 9; }
+inline int f7376_10(int x) { return x * 10; }
+inline int f7376_11(int x) { return x * 11; }
+inline int f7376_12(int x) { return x * 12; }
+inline int f7376_13(int x) { return x * 13; }
+inline int f7376_14(int x) { return x * 14; }
+inline int f7376_15(int x) { return x * 15; }
+inline int f7376_16(int x) { return x * 16; }
+inline int f7376_17(int x) { return x * 17; }
+inline int f7376_18(int x) { return x * 18; }
+inline int f7376_19(int x) { return x * 19; }
+inline int f7376_20(int x) { return x * 20; }
+inline int f7376_21(int x) { return x * 21; }
+inline int f7376_22(int x) { return x * 22; }
+inline int f7376_23(int x) { return x * 23; }
+inline int f7376_24(int x) { return x * 24; }
+inline int f7376_25(int x) { return x * 25; }
+inline int f7376_26(int x) { return x * 26; }
+inline int f7376_27(int x) { return x * 27; }
+inline int f7376_28(int x) { return x * 28; }
+inline int f7376_29(int x) { return x * 29; }
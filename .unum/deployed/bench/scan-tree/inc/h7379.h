@@ -0,0 +1,42 @@
+#pragma once
+/* header 7379 */
+#include <vector>
+#include "h7869.h"
+#include "h6483.h"
+#include "h4074.h"
+#include "h140.h"
+#include "h77.h"
+#ifdef X
+#include "h4472.h"
+#endif
+struct S7379 { int a; const char *s = "x//y"; };
+inline int f7379_0(int x) { return x * 0; }
+inline int f7379_1(int x) { return x * 1; }
+inline int f7379_2(int x) { return x * 2; }
+inline int f7379_3(int x) { return x * 3; }
+inline int f7379_4(int x) { return x * 4; }
+inline int f7379_5(int x) { return x * 5; }
+inline int f7379_6(int x) { return x * 6; }
+inline int f7379_7(int x) { return x * 7; }
+inline int f7379_8(int x) { return x * 8; }
+inline int f7379_9(int x) { return x * 9; }
+inline int f7379_10(int x) { return x * 10; }
+inline int f7379_11(int x) { return x * 11; }
+inline int f7379_12(int x) { return x * 12; }
+inline int f7379_13(int x) { return x * 13; }
+inline int f7379_14(int x) { return x * 14; }
+inline int f7379_15(int x) { return x * 15; }
+inline int f7379_16(int x) { return x * 16; }
+inline int f7379_17(int x) { return x * 17; }
+inline int f7379_18(int x) { return x * 18; }
+inline int f7379_19(int x) { return x * 19; }
+inline int f7379_20(int x) { return x * 20; }
+inline int f7379_21(int x) { return x * 21; }
+inline int f7379_22(int x) { return x * 22; }
+inline int f7379_23(int x) { return x * 23; }
+inline int f7379_24(int x) { return x * 24; }
+inline int f7379_25(int x) { return x * 25; }
+inline int f7379_26(int x) { return x * 26; }
+inline int f7379_27(int x) { return x * 27; }
+inline int f7379_28(int x) { return x * 28; }
+inline int f7379_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7380 */
+#include <vector>
+#include "h5577.h"
+#include "h4839.h"
+#include "h5936.h"
+#include "h7299.h"
+#include "h7278.h"
+#ifdef X
+#include "h4710.h"
+#endif
+struct S7380 { int a; const char *s = "x//y"; };
+inline int f7380_0(int x) { return x * 0; }
+inline int f7380_1(int x) { return x * 1; }
+inline int f7380_2(int x) { return x * 2; }
+inline int f7380_3(int x) { return x * 3; }
+inline int f7380_4(int x) { return x * 4; }
+inline int f7380_5(int x) { return x * 5; }
+inline int f7380_6(int x) { return x * 6; }
+inline int f7380_7(int x) { return x * 7; }
+inline int f7380_8(int x) { return x * 8; }
+inline int f7380_9(int x) { return x * 9; }
+inline int f7380_10(int x) { return x * 10; }
+inline int f7380_11(int x) { return x * 11; }
+inline int f7380_12(int x) { return x * 12; }
+inline int f7380_13(int x) { return x * 13; }
+inline int f7380_14(int x) { return x * 14; }
+inline int f7380_15(int x) { return x * 15; }
+inline int f7380_16(int x) { return x * 16; }
+inline int f7380_17(int x) { return x * 17; }
+inline int f7380_18(int x) { return x * 18; }
+inline int f7380_19(int x) { return x * 19; }
+inline int f7380_20(int x) { return x * 20; }
+inline int f7380_21(int x) { return x * 21; }
+inline int f7380_22(int x) { return x * 22; }
+inline int f7380_23(int x) { return x * 23; }
+inline int f7380_24(int x) { return x * 24; }
+inline int f7380_25(int x) { return x * 25; }
+inline int f7380_26(int x) { return x * 26; }
+inline int f7380_27(int x) { return x * 27; }
+inline int f7380_28(int x) { return x * 28; }
+inline int f7380_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7382 */
+#include <vector>
+#include "h6566.h"
+#include "h6709.h"
+#include "h9207.h"
+#include "h1751.h"
+#include "h3512.h"
+#ifdef X
+#include "h2844.h"
+#endif
+struct S7382 { int a; const char *s = "x//y"; };
+inline int f7382_0(int x) { return x * 0; }
+inline int f7382_1(int x) { return x * 1; }
+inline int f7382_2(int x) { return x * 2; }
+inline int f7382_3(int x) { return x * 3; }
+inline int f7382_4(int x) { return x * 4; }
+inline int f7382_5(int x) { return x * 5; }
+inline int f7382_6(int x) { return x * 6; }
+inline int f7382_7(int x) { return x * 7; }
+inline int f7382_8(int x) { return x * 8; }
+inline int f7382_9(int x) { return x * 9; }
+inline int f7382_10(int x) { return x * 10; }
+inline int f7382_11(int x) { return x * 11; }
+inline int f7382_12(int x) { return x * 12; }
+inline int f7382_13(int x) { return x * 13; }
+inline int f7382_14(int x) { return x * 14; }
+inline int f7382_15(int x) { return x * 15; }
+inline int f7382_16(int x) { return x * 16; }
+inline int f7382_17(int x) { return x * 17; }
+inline int f7382_18(int x) { return x * 18; }
+inline int f7382_19(int x) { return x * 19; }
+inline int f7382_20(int x) { return x * 20; }
+inline int f7382_21(int x) { return x * 21; }
+inline int f7382_22(int x) { return x * 22; }
+inline int f7382_23(int x) { return x * 23; }
+inline int f7382_24(int x) { return x * 24; }
+inline int f7382_25(int x) { return x * 25; }
+inline int f7382_26(int x) { return x * 26; }
+inline int f7382_27(int x) { return x * 27; }
+inline int f7382_28(int x) { return x * 28; }
+inline int f7382_29(int x) { return x * 29; }
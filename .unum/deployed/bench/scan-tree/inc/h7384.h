@@ -0,0 +1,42 @@
+#pragma once
+/* header 7384 */
+#include <vector>
+#include "h8265.h"
+#include "h1906.h"
+#include "h6100.h"
+#include "h6817.h"
+#include "h4744.h"
+#ifdef X
+#include "h4545.h"
+#endif
+struct S7384 { int a; const char *s = "x//y"; };
+inline int f7384_0(int x) { return x * 0; }
+inline int f7384_1(int x) { return x * 1; }
+inline int f7384_2(int x) { return x * 2; }
+inline int f7384_3(int x) { return x * 3; }
+inline int f7384_4(int x) { return x * 4; }
+inline int f7384_5(int x) { return x * 5; }
+inline int f7384_6(int x) { return x * 6; }
+inline int f7384_7(int x) { return x * 7; }
+inline int f7384_8(int x) { return x * 8; }
+inline int f7384_9(int x) { return x * 9; }
+inline int f7384_10(int x) { return x * 10; }
+inline int f7384_11(int x) { return x * 11; }
+inline int f7384_12(int x) { return x * 12; }
+inline int f7384_13(int x) { return x * 13; }
+inline int f7384_14(int x) { return x * 14; }
+inline int f7384_15(int x) { return x * 15; }
+inline int f7384_16(int x) { return x * 16; }
+inline int f7384_17(int x) { return x * 17; }
+inline int f7384_18(int x) { return x * 18; }
+inline int f7384_19(int x) { return x * 19; }
+inline int f7384_20(int x) { return x * 20; }
+inline int f7384_21(int x) { return x * 21; }
+inline int f7384_22(int x) { return x * 22; }
+inline int f7384_23(int x) { return x * 23; }
+inline int f7384_24(int x) { return x * 24; }
+inline int f7384_25(int x) { return x * 25; }
+inline int f7384_26(int x) { return x * 26; }
+inline int f7384_27(int x) { return x * 27; }
+inline int f7384_28(int x) { return x * 28; }
+inline int f7384_29(int x) { return x * 29; }
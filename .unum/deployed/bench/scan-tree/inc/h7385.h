@@ -0,0 +1,42 @@
+#pragma once
+/* header 7385 */
+#include <vector>
+#include "h5303.h"
+#include "h2999.h"
+#include "h8552.h"
+#include "h459.h"
+#include "h2148.h"
+#ifdef X
+#include "h5039.h"
+#endif
+struct S7385 { int a; const char *s = "x//y"; };
+inline int f7385_0(int x) { return x * 0; }
+inline int f7385_1(int x) { return x * 1; }
+inline int f7385_2(int x) { return x * 2; }
+inline int f7385_3(int x) { return x * 3; }
+inline int f7385_4(int x) { return x * 4; }
+inline int f7385_5(int x) { return x * 5; }
+inline int f7385_6(int x) { return x * 6; }
+inline int f7385_7(int x) { return x * 7; }
+inline int f7385_8(int x) { return x * 8; }
+inline int f7385_9(int x) { return x * 9; }
+inline int f7385_10(int x) { return x * 10; }
+inline int f7385_11(int x) { return x * 11; }
+inline int f7385_12(int x) { return x * 12; }
+inline int f7385_13(int x) { return x * 13; }
+inline int f7385_14(int x) { return x * 14; }
+inline int f7385_15(int x) { return x * 15; }
+inline int f7385_16(int x) { return x * 16; }
+inline int f7385_17(int x) { return x * 17; }
+inline int f7385_18(int x) { return x * 18; }
+inline int f7385_19(int x) { return x * 19; }
+inline int f7385_20(int x) { return x * 20; }
+inline int f7385_21(int x) { return x * 21; }
+inline int f7385_22(int x) { return x * 22; }
+inline int f7385_23(int x) { return x * 23; }
+inline int f7385_24(int x) { return x * 24; }
+inline int f7385_25(int x) { return x * 25; }
+inline int f7385_26(int x) { return x * 26; }
+inline int f7385_27(int x) { return x * 27; }
+inline int f7385_28(int x) { return x * 28; }
+inline int f7385_29(int x) { return x * 29; }
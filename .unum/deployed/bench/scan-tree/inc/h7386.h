@@ -0,0 +1,42 @@
+#pragma once
+/* header 7386 */
+#include <vector>
+#include "h8152.h"
+#include "h5564.h"
+#include "h8875.h"
+#include "h223.h"
+#include "h9595.h"
+#ifdef X
+#include "h7329.h"
+#endif
+struct S7386 { int a; const char *s = "x//y"; };
+inline int f7386_0(int x) { return x * 0; }
+inline int f7386_1(int x) { return x * 1; }
+inline int f7386_2(int x) { return x * 2; }
+inline int f7386_3(int x) { return x * 3; }
+inline int f7386_4(int x) { return x * 4; }
+inline int f7386_5(int x) { return x * 5; }
+inline int f7386_6(int x) { return x * 6; }
+inline int f7386_7(int x) { return x * 7; }
+inline int f7386_8(int x) { return x * 8; }
+inline int f7386_9(int x) { return x * 9; }
+inline int f7386_10(int x) { return x * 10; }
+inline int f7386_11(int x) { return x * 11; }
+inline int f7386_12(int x) { return x * 12; }
+inline int f7386_13(int x) { return x * 13; }
+inline int f7386_14(int x) { return x * 14; }
+inline int f7386_15(int x) { return x * 15; }
+inline int f7386_16(int x) { return x * 16; }
+inline int f7386_17(int x) { return x * 17; }
+inline int f7386_18(int x) { return x * 18; }
+inline int f7386_19(int x) { return x * 19; }
+inline int f7386_20(int x) { return x * 20; }
+inline int f7386_21(int x) { return x * 21; }
+inline int f7386_22(int x) { return x * 22; }
+inline int f7386_23(int x) { return x * 23; }
+inline int f7386_24(int x) { return x * 24; }
+inline int f7386_25(int x) { return x * 25; }
+inline int f7386_26(int x) { return x * 26; }
+inline int f7386_27(int x) { return x * 27; }
+inline int f7386_28(int x) { return x * 28; }
+inline int f7386_29(int x) { return x * 29; }
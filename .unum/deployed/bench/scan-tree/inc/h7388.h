@@ -0,0 +1,42 @@
+#pragma once
+/* header 7388 */
+#include <vector>
+#include "h7524.h"
+#include "h9686.h"
+#include "h688.h"
+#include "h54.h"
+#include "h1713.h"
+#ifdef X
+#include "h2816.h"
+#endif
+struct S7388 { int a; const char *s = "x//y"; };
+inline int f7388_0(int x) { return x * 0; }
+inline int f7388_1(int x) { return x * 1; }
+inline int f7388_2(int x) { return x * 2; }
+inline int f7388_3(int x) { return x * 3; }
+inline int f7388_4(int x) { return x * 4; }
+inline int f7388_5(int x) { return x * 5; }
+inline int f7388_6(int x) { return x * 6; }
+inline int f7388_7(int x) { return x * 7; }
+inline int f7388_8(int x) { return x * 8; }
+inline int f7388_9(int x) { return x * 9; }
+inline int f7388_10(int x) { return x * 10; }
+inline int f7388_11(int x) { return x * 11; }
+inline int f7388_12(int x) { return x * 12; }
+inline int f7388_13(int x) { return x * 13; }
+inline int f7388_14(int x) { return x * 14; }
+inline int f7388_15(int x) { return x * 15; }
+inline int f7388_16(int x) { return x * 16; }
+inline int f7388_17(int x) { return x * 17; }
+inline int f7388_18(int x) { return x * 18; }
+inline int f7388_19(int x) { return x * 19; }
+inline int f7388_20(int x) { return x * 20; }
+inline int f7388_21(int x) { return x * 21; }
+inline int f7388_22(int x) { return x * 22; }
+inline int f7388_23(int x) { return x * 23; }
+inline int f7388_24(int x) { return x * 24; }
+inline int f7388_25(int x) { return x * 25; }
+inline int f7388_26(int x) { return x * 26; }
+inline int f7388_27(int x) { return x * 27; }
+inline int f7388_28(int x) { return x * 28; }
+inline int f7388_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7389 */
+#include <vector>
+#include "h4577.h"
+#include "h8658.h"
+#include "h2588.h"
+#include "h5948.h"
+#include "h5443.h"
+#ifdef X
+#include "h3099.h"
+#endif
+struct S7389 { int a; const char *s = "x//y"; };
+inline int f7389_0(int x) { return x * 0; }
+inline int f7389_1(int x) { return x * 1; }
+inline int f7389_2(int x) { return x * 2; }
+inline int f7389_3(int x) { return x * 3; }
+inline int f7389_4(int x) { return x * 4; }
+inline int f7389_5(int x) { return x * 5; }
+inline int f7389_6(int x) { return x * 6; }
+inline int f7389_7(int x) { return x * 7; }
+inline int f7389_8(int x) { return x * 8; }
+inline int f7389_9(int x) { return x * 9; }
+inline int f7389_10(int x) { return x * 10; }
+inline int f7389_11(int x) { return x * 11; }
+inline int f7389_12(int x) { return x * 12; }
+inline int f7389_13(int x) { return x * 13; }
+inline int f7389_14(int x) { return x * 14; }
+inline int f7389_15(int x) { return x * 15; }
+inline int f7389_16(int x) { return x * 16; }
+inline int f7389_17(int x) { return x * 17; }
+inline int f7389_18(int x) { return x * 18; }
+inline int f7389_19(int x) { return x * 19; }
+inline int f7389_20(int x) { return x * 20; }
+inline int f7389_21(int x) { return x * 21; }
+inline int f7389_22(int x) { return x * 22; }
+inline int f7389_23(int x) { return x * 23; }
+inline int f7389_24(int x) { return x * 24; }
+inline int f7389_25(int x) { return x * 25; }
+inline int f7389_26(int x) { return x * 26; }
+inline int f7389_27(int x) { return x * 27; }
+inline int f7389_28(int x) { return x * 28; }
+inline int f7389_29(int x) { return x * 29; }
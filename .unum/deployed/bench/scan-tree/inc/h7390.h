@@ -0,0 +1,42 @@
+#pragma once
+/* header 7390 */
+#include <vector>
+#include "h5099.h"
+#include "h4228.h"
+#include "h5090.h"
+#include "h6354.h"
+#include "h4128.h"
+#ifdef X
+#include "h9323.h"
+#endif
+struct S7390 { int a; const char *s = "x//y"; };
+inline int f7390_0(int x) { return x * 0; }
+inline int f7390_1(int x) { return x * 1; }
+inline int f7390_2(int x) { return x * 2; }
+inline int f7390_3(int x) { return x * 3; }
+inline int f7390_4(int x) { return x * 4; }
+inline int f7390_5(int x) { return x * 5; }
+inline int f7390_6(int x) { return x * 6; }
+inline int f7390_7(int x) { return x * 7; }
+inline int f7390_8(int x) { return x * 8; }
+inline int f7390_9(int x) { return x * 9; }
+inline int f7390_10(int x) { return x * 10; }
+inline int f7390_11(int x) { return x * 11; }
+inline int f7390_12(int x) { return x * 12; }
+inline int f7390_13(int x) { return x * 13; }
+inline int f7390_14(int x) { return x * 14; }
+inline int f7390_15(int x) { return x * 15; }
+inline int f7390_16(int x) { return x * 16; }
+inline int f7390_17(int x) { return x * 17; }
+inline int f7390_18(int x) { return x * 18; }
+inline int f7390_19(int x) { return x * 19; }
+inline int f7390_20(int x) { return x * 20; }
+inline int f7390_21(int x) { return x * 21; }
+inline int f7390_22(int x) { return x * 22; }
+inline int f7390_23(int x) { return x * 23; }
+inline int f7390_24(int x) { return x * 24; }
+inline int f7390_25(int x) { return x * 25; }
+inline int f7390_26(int x) { return x * 26; }
+inline int f7390_27(int x) { return x * 27; }
+inline int f7390_28(int x) { return x * 28; }
+inline int f7390_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7391 */
+#include <vector>
+#include "h7043.h"
+#include "h4650.h"
+#include "h3470.h"
+#include "h9569.h"
+#include "h8602.h"
+#ifdef X
+#include "h328.h"
+#endif
+struct S7391 { int a; const char *s = "x//y"; };
+inline int f7391_0(int x) { return x * 0; }
+inline int f7391_1(int x) { return x * 1; }
+inline int f7391_2(int x) { return x * 2; }
+inline int f7391_3(int x) { return x * 3; }
+inline int f7391_4(int x) { return x * 4; }
+inline int f7391_5(int x) { return x * 5; }
+inline int f7391_6(int x) { return x * 6; }
+inline int f7391_7(int x) { return x * 7; }
+inline int f7391_8(int x) { return x * 8; }
+inline int f7391_9(int x) { return x * 9; }
+inline int f7391_10(int x) { return x * 10; }
+inline int f7391_11(int x) { return x * 11; }
+inline int f7391_12(int x) { return x * 12; }
+inline int f7391_13(int x) { return x * 13; }
+inline int f7391_14(int x) { return x * 14; }
+inline int f7391_15(int x) { return x * 15; }
+inline int f7391_16(int x) { return x * 16; }
+inline int f7391_17(int x) { return x * 17; }
+inline int f7391_18(int x) { return x * 18; }
+inline int f7391_19(int x) { return x * 19; }
+inline int f7391_20(int x) { return x * 20; }
+inline int f7391_21(int x) { return x * 21; }
+inline int f7391_22(int x) { return x * 22; }
+inline int f7391_23(int x) { return x * 23; }
+inline int f7391_24(int x) { return x * 24; }
+inline int f7391_25(int x) { return x * 25; }
+inline int f7391_26(int x) { return x * 26; }
+inline int f7391_27(int x) { return x * 27; }
+inline int f7391_28(int x) { return x * 28; }
+inline int f7391_29(int x) { return x * 29; }
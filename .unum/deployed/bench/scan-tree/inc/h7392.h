@@ -0,0 +1,42 @@
+#pragma once
+/* header 7392 */
+#include <vector>
+#include "h9617.h"
+#include "h2795.h"
+#include "h7016.h"
+#include "h4492.h"
+#include "h4373.h"
+#ifdef X
+#include "h1807.h"
+#endif
+struct S7392 { int a; const char *s = "x//y"; };
+inline int f7392_0(int x) { return x * 0; }
+inline int f7392_1(int x) { return x * 1; }
+inline int f7392_2(int x) { return x * 2; }
+inline int f7392_3(int x) { return x * 3; }
+inline int f7392_4(int x) { return x * 4; }
+inline int f7392_5(int x) { return x * 5; }
+inline int f7392_6(int x) { return x * 6; }
+inline int f7392_7(int x) { return x * 7; }
+inline int f7392_8(int x) { return x * 8; }
+inline int f7392_9(int x) { return x * 9; }
+inline int f7392_10(int x) { return x * 10; }
+inline int f7392_11(int x) { return x * 11; }
+inline int f7392_12(int x) { return x * 12; }
+inline int f7392_13(int x) { return x * 13; }
+inline int f7392_14(int x) { return x * 14; }
+inline int f7392_15(int x) { return x * 15; }
+inline int f7392_16(int x) { return x * 16; }
+inline int f7392_17(int x) { return x * 17; }
+inline int f7392_18(int x) { return x * 18; }
+inline int f7392_19(int x) { return x * 19; }
+inline int f7392_20(int x) { return x * 20; }
+inline int f7392_21(int x) { return x * 21; }
+inline int f7392_22(int x) { return x * 22; }
+inline int f7392_23(int x) { return x * 23; }
+inline int f7392_24(int x) { return x * 24; }
+inline int f7392_25(int x) { return x * 25; }
+inline int f7392_26(int x) { return x * 26; }
+inline int f7392_27(int x) { return x * 27; }
+inline int f7392_28(int x) { return x * 28; }
+inline int f7392_29(int x) { return x * 29; }
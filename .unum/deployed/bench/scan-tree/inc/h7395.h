@@ -0,0 +1,42 @@
+#pragma once
+/* header 7395 */
+#include <vector>
+#include "h9192.h"
+#include "h8536.h"
+#include "h9545.h"
+#include "h9592.h"
+#include "h748.h"
+#ifdef X
+#include "h2505.h"
+#endif
+struct S7395 { int a; const char *s = "x//y"; };
+inline int f7395_0(int x) { return x * 0; }
+inline int f7395_1(int x) { return x * 1; }
+inline int f7395_2(int x) { return x * 2; }
+inline int f7395_3(int x) { return x * 3; }
+inline int f7395_4(int x) { return x * 4; }
+inline int f7395_5(int x) { return x * 5; }
+inline int f7395_6(int x) { return x * 6; }
+inline int f7395_7(int x) { return x * 7; }
+inline int f7395_8(int x) { return x * 8; }
+inline int f7395_9(int x) { return x * 9; }
+inline int f7395_10(int x) { return x * 10; }
+inline int f7395_11(int x) { return x * 11; }
+inline int f7395_12(int x) { return x * 12; }
+inline int f7395_13(int x) { return x * 13; }
+inline int f7395_14(int x) { return x * 14; }
+inline int f7395_15(int x) { return x * 15; }
+inline int f7395_16(int x) { return x * 16; }
+inline int f7395_17(int x) { return x * 17; }
+inline int f7395_18(int x) { return x * 18; }
+inline int f7395_19(int x) { return x * 19; }
+inline int f7395_20(int x) { return x * 20; }
+inline int f7395_21(int x) { return x * 21; }
+inline int f7395_22(int x) { return x * 22; }
+inline int f7395_23(int x) { return x * 23; }
+inline int f7395_24(int x) { return x * 24; }
+inline int f7395_25(int x) { return x * 25; }
+inline int f7395_26(int x) { return x * 26; }
+inline int f7395_27(int x) { return x * 27; }
+inline int f7395_28(int x) { return x * 28; }
+inline int f7395_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7397 */
+#include <vector>
+#include "h9045.h"
+#include "h1016.h"
+#include "h9249.h"
+#include "h6682.h"
+#include "h9356.h"
+#ifdef X
+#include "h5565.h"
+#endif
+struct S7397 { int a; const char *s = "x//y"; };
+inline int f7397_0(int x) { return x * 0; }
+inline int f7397_1(int x) { return x * 1; }
+inline int f7397_2(int x) { return x * 2; }
+inline int f7397_3(int x) { return x * 3; }
+inline int f7397_4(int x) { return x * 4; }
+inline int f7397_5(int x) { return x * 5; }
+inline int f7397_6(int x) { return x * 6; }
+inline int f7397_7(int x) { return x * 7; }
+inline int f7397_8(int x) { return x * 8; }
+inline int f7397_9(int x) { return x * 9; }
+inline int f7397_10(int x) { return x * 10; }
+inline int f7397_11(int x) { return x * 11; }
+inline int f7397_12(int x) { return x * 12; }
+inline int f7397_13(int x) { return x * 13; }
+inline int f7397_14(int x) { return x * 14; }
+inline int f7397_15(int x) { return x * 15; }
+inline int f7397_16(int x) { return x * 16; }
+inline int f7397_17(int x) { return x * 17; }
+inline int f7397_18(int x) { return x * 18; }
+inline int f7397_19(int x) { return x * 19; }
+inline int f7397_20(int x) { return x * 20; }
+inline int f7397_21(int x) { return x * 21; }
+inline int f7397_22(int x) { return x * 22; }
+inline int f7397_23(int x) { return x * 23; }
+inline int f7397_24(int x) { return x * 24; }
+inline int f7397_25(int x) { return x * 25; }
+inline int f7397_26(int x) { return x * 26; }
+inline int f7397_27(int x) { return x * 27; }
+inline int f7397_28(int x) { return x * 28; }
+inline int f7397_29(int x) { return x * 29; }
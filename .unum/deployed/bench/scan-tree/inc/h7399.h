@@ -0,0 +1,42 @@
+#pragma once
+/* header 7399 */
+#include <vector>
+#include "h1608.h"
+#include "h3784.h"
+#include "h7013.h"
+#include "h3003.h"
+#include "h592.h"
+#ifdef X
+#include "h3948.h"
+#endif
+struct S7399 { int a; const char *s = "x//y"; };
+inline int f7399_0(int x) { return x * 0; }
+inline int f7399_1(int x) { return x * 1; }
+inline int f7399_2(int x) { return x * 2; }
+inline int f7399_3(int x) { return x * 3; }
+inline int f7399_4(int x) { return x * 4; }
+inline int f7399_5(int x) { return x * 5; }
+inline int f7399_6(int x) { return x * 6; }
+inline int f7399_7(int x) { return x * 7; }
+inline int f7399_8(int x) { return x * 8; }
+inline int f7399_9(int x) { return x * 9; }
+inline int f7399_10(int x) { return x * 10; }
+inline int f7399_11(int x) { return x * 11; }
+inline int f7399_12(int x) { return x * 12; }
+inline int f7399_13(int x) { return x * 13; }
+inline int f7399_14(int x) { return x * 14; }
+inline int f7399_15(int x) { return x * 15; }
+inline int f7399_16(int x) { return x * 16; }
+inline int f7399_17(int x) { return x * 17; }
+inline int f7399_18(int x) { return x * 18; }
+inline int f7399_19(int x) { return x * 19; }
+inline int f7399_20(int x) { return x * 20; }
+inline int f7399_21(int x) { return x * 21; }
+inline int f7399_22(int x) { return x * 22; }
+inline int f7399_23(int x) { return x * 23; }
+inline int f7399_24(int x) { return x * 24; }
+inline int f7399_25(int x) { return x * 25; }
+inline int f7399_26(int x) { return x * 26; }
+inline int f7399_27(int x) { return x * 27; }
+inline int f7399_28(int x) { return x * 28; }
+inline int f7399_29(int x) { return x * 29; }
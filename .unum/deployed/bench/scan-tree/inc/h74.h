@@ -0,0 +1,42 @@
+#pragma once
+/* header 74 */
+#include <vector>
+#include "h7409.h"
+#include "h8427.h"
+#include "h8551.h"
+#include "h8966.h"
+#include "h8257.h"
+#ifdef X
+#include "h6552.h"
+#endif
+struct S74 { int a; const char *s = "x//y"; };
+inline int f74_0(int x) { return x * 0; }
+inline int f74_1(int x) { return x * 1; }
+inline int f74_2(int x) { return x * 2; }
+inline int f74_3(int x) { return x * 3; }
+inline int f74_4(int x) { return x * 4; }
+inline int f74_5(int x) { return x * 5; }
+inline int f74_6(int x) { return x * 6; }
+inline int f74_7(int x) { return x * 7; }
+inline int f74_8(int x) { return x * 8; }
+inline int f74_9(int x) { return x * 9; }
+inline int f74_10(int x) { return x * 10; }
+inline int f74_11(int x) { return x * 11; }
+inline int f74_12(int x) { return x * 12; }
+inline int f74_13(int x) { return x * 13; }
+inline int f74_14(int x) { return x * 14; }
+inline int f74_15(int x) { return x * 15; }
+inline int f74_16(int x) { return x * 16; }
+inline int f74_17(int x) { return x * 17; }
+inline int f74_18(int x) { return x * 18; }
+inline int f74_19(int x) { return x * 19; }
+inline int f74_20(int x) { return x * 20; }
+inline int f74_21(int x) { return x * 21; }
+inline int f74_22(int x) { return x * 22; }
+inline int f74_23(int x) { return x * 23; }
+inline int f74_24(int x) { return x * 24; }
+inline int f74_25(int x) { return x * 25; }
+inline int f74_26(int x) { return x * 26; }
+inline int f74_27(int x) { return x * 27; }
+inline int f74_28(int x) { return x * 28; }
+inline int f74_29(int x) { return x * 29; }
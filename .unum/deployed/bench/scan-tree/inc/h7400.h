@@ -0,0 +1,42 @@
+#pragma once
+/* header 7400 */
+#include <vector>
+#include "h1798.h"
+#include "h1076.h"
+#include "h1341.h"
+#include "h9454.h"
+#include "h727.h"
+#ifdef X
+#include "h7406.h"
+#endif
+struct S7400 { int a; const char *s = "x//y"; };
+inline int f7400_0(int x) { return x * 0; }
+inline int f7400_1(int x) { return x * 1; }
+inline int f7400_2(int x) { return x * 2; }
+inline int f7400_3(int x) { return x * 3; }
+inline int f7400_4(int x) { return x * 4; }
+inline int f7400_5(int x) { return x * 5; }
+inline int f7400_6(int x) { return x * 6; }
+inline int f7400_7(int x) { return x * 7; }
+inline int f7400_8(int x) { return x * 8; }
+inline int f7400_9(int x) { return x * 9; }
+inline int f7400_10(int x) { return x * 10; }
+inline int f7400_11(int x) { return x * 11; }
+inline int f7400_12(int x) { return x * 12; }
+inline int f7400_13(int x) { return x * 13; }
+inline int f7400_14(int x) { return x * 14; }
+inline int f7400_15(int x) { return x * 15; }
+inline int f7400_16(int x) { return x * 16; }
+inline int f7400_17(int x) { return x * 17; }
+inline int f7400_18(int x) { return x * 18; }
+inline int f7400_19(int x) { return x * 19; }
+inline int f7400_20(int x) { return x * 20; }
+inline int f7400_21(int x) { return x * 21; }
+inline int f7400_22(int x) { return x * 22; }
+inline int f7400_23(int x) { return x * 23; }
+inline int f7400_24(int x) { return x * 24; }
+inline int f7400_25(int x) { return x * 25; }
+inline int f7400_26(int x) { return x * 26; }
+inline int f7400_27(int x) { return x * 27; }
+inline int f7400_28(int x) { return x * 28; }
+inline int f7400_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7402 */
+#include <vector>
+#include "h3610.h"
+#include "h367.h"
+#include "h3955.h"
+#include "h1293.h"
+#include "h6469.h"
+#ifdef X
+#include "h8227.h"
+#endif
+struct S7402 { int a; const char *s = "x//y"; };
+inline int f7402_0(int x) { return x * 0; }
+inline int f7402_1(int x) { return x * 1; }
+inline int f7402_2(int x) { return x * 2; }
+inline int f7402_3(int x) { return x * 3; }
+inline int f7402_4(int x) { return x * 4; }
+inline int f7402_5(int x) { return x * 5; }
+inline int f7402_6(int x) { return x * 6; }
+inline int f7402_7(int x) { return x * 7; }
+inline int f7402_8(int x) { return x * 8; }
+inline int f7402_9(int x) { return x * 9; }
+inline int f7402_10(int x) { return x * 10; }
+inline int f7402_11(int x) { return x * 11; }
+inline int f7402_12(int x) { return x * 12; }
+inline int f7402_13(int x) { return x * 13; }
+inline int f7402_14(int x) { return x * 14; }
+inline int f7402_15(int x) { return x * 15; }
+inline int f7402_16(int x) { return x * 16; }
+inline int f7402_17(int x) { return x * 17; }
+inline int f7402_18(int x) { return x * 18; }
+inline int f7402_19(int x) { return x * 19; }
+inline int f7402_20(int x) { return x * 20; }
+inline int f7402_21(int x) { return x * 21; }
+inline int f7402_22(int x) { return x * 22; }
+inline int f7402_23(int x) { return x * 23; }
+inline int f7402_24(int x) { return x * 24; }
+inline int f7402_25(int x) { return x * 25; }
+inline int f7402_26(int x) { return x * 26; }
+inline int f7402_27(int x) { return x * 27; }
+inline int f7402_28(int x) { return x * 28; }
+inline int f7402_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7403 */
+#include <vector>
+#include "h168.h"
+#include "h7023.h"
+#include "h9470.h"
+#include "h7512.h"
+#include "h4169.h"
+#ifdef X
+#include "h9340.h"
+#endif
+struct S7403 { int a; const char *s = "x//y"; };
+inline int f7403_0(int x) { return x * 0; }
+inline int f7403_1(int x) { return x * 1; }
+inline int f7403_2(int x) { return x * 2; }
+inline int f7403_3(int x) { return x * 3; }
+inline int f7403_4(int x) { return x * 4; }
+inline int f7403_5(int x) { return x * 5; }
+inline int f7403_6(int x) { return x * 6; }
+inline int f7403_7(int x) { return x * 7; }
+inline int f7403_8(int x) { return x * 8; }
+inline int f7403_9(int x) { return x * 9; }
+inline int f7403_10(int x) { return x * 10; }
+inline int f7403_11(int x) { return x * 11; }
+inline int f7403_12(int x) { return x * 12; }
+inline int f7403_13(int x) { return x * 13; }
+inline int f7403_14(int x) { return x * 14; }
+inline int f7403_15(int x) { return x * 15; }
+inline int f7403_16(int x) { return x * 16; }
+inline int f7403_17(int x) { return x * 17; }
+inline int f7403_18(int x) { return x * 18; }
+inline int f7403_19(int x) { return x * 19; }
+inline int f7403_20(int x) { return x * 20; }
+inline int f7403_21(int x) { return x * 21; }
+inline int f7403_22(int x) { return x * 22; }
+inline int f7403_23(int x) { return x * 23; }
+inline int f7403_24(int x) { return x * 24; }
+inline int f7403_25(int x) { return x * 25; }
+inline int f7403_26(int x) { return x * 26; }
+inline int f7403_27(int x) { return x * 27; }
+inline int f7403_28(int x) { return x * 28; }
+inline int f7403_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7406 */
+#include <vector>
+#include "h6386.h"
+#include "h6095.h"
+#include "h8183.h"
+#include "h6929.h"
+#include "h9107.h"
+#ifdef X
+#include "h2162.h"
+#endif
+struct S7406 { int a; const char *s = "x//y"; };
+inline int f7406_0(int x) { return x * 0; }
+inline int f7406_1(int x) { return x * 1; }
+inline int f7406_2(int x) { return x * 2; }
+inline int f7406_3(int x) { return x * 3; }
+inline int f7406_4(int x) { return x * 4; }
+inline int f7406_5(int x) { return x * 5; }
+inline int f7406_6(int x) { return x * 6; }
+inline int f7406_7(int x) { return x * 7; }
+inline int f7406_8(int x) { return x * 8; }
+inline int f7406_9(int x) { return x * 9; }
+inline int f7406_10(int x) { return x * 10; }
+inline int f7406_11(int x) { return x * 11; }
+inline int f7406_12(int x) { return x * 12; }
+inline int f7406_13(int x) { return x * 13; }
+inline int f7406_14(int x) { return x * 14; }
+inline int f7406_15(int x) { return x * 15; }
+inline int f7406_16(int x) { return x * 16; }
+inline int f7406_17(int x) { return x * 17; }
+inline int f7406_18(int x) { return x * 18; }
+inline int f7406_19(int x) { return x * 19; }
+inline int f7406_20(int x) { return x * 20; }
+inline int f7406_21(int x) { return x * 21; }
+inline int f7406_22(int x) { return x * 22; }
+inline int f7406_23(int x) { return x * 23; }
+inline int f7406_24(int x) { return x * 24; }
+inline int f7406_25(int x) { return x * 25; }
+inline int f7406_26(int x) { return x * 26; }
+inline int f7406_27(int x) { return x * 27; }
+inline int f7406_28(int x) { return x * 28; }
+inline int f7406_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7407 */
+#include <vector>
+#include "h6533.h"
+#include "h8389.h"
+#include "h8930.h"
+#include "h1929.h"
+#include "h8484.h"
+#ifdef X
+#include "h6011.h"
+#endif
+struct S7407 { int a; const char *s = "x//y"; };
+inline int f7407_0(int x) { return x * 0; }
+inline int f7407_1(int x) { return x * 1; }
+inline int f7407_2(int x) { return x * 2; }
+inline int f7407_3(int x) { return x * 3; }
+inline int f7407_4(int x) { return x * 4; }
+inline int f7407_5(int x) { return x * 5; }
+inline int f7407_6(int x) { return x * 6; }
+inline int f7407_7(int x) { return x * 7; }
+inline int f7407_8(int x) { return x * 8; }
+inline int f7407_9(int x) { return x * 9; }
+inline int f7407_10(int x) { return x * 10; }
+inline int f7407_11(int x) { return x * 11; }
+inline int f7407_12(int x) { return x * 12; }
+inline int f7407_13(int x) { return x * 13; }
+inline int f7407_14(int x) { return x * 14; }
+inline int f7407_15(int x) { return x * 15; }
+inline int f7407_16(int x) { return x * 16; }
+inline int f7407_17(int x) { return x * 17; }
+inline int f7407_18(int x) { return x * 18; }
+inline int f7407_19(int x) { return x * 19; }
+inline int f7407_20(int x) { return x * 20; }
+inline int f7407_21(int x) { return x * 21; }
+inline int f7407_22(int x) { return x * 22; }
+inline int f7407_23(int x) { return x * 23; }
+inline int f7407_24(int x) { return x * 24; }
+inline int f7407_25(int x) { return x * 25; }
+inline int f7407_26(int x) { return x * 26; }
+inline int f7407_27(int x) { return x * 27; }
+inline int f7407_28(int x) { return x * 28; }
+inline int f7407_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7408 */
+#include <vector>
+#include "h8614.h"
+#include "h1422.h"
+#include "h4391.h"
+#include "h2435.h"
+#include "h9101.h"
+#ifdef X
+#include "h7611.h"
+#endif
+struct S7408 { int a; const char *s = "x//y"; };
+inline int f7408_0(int x) { return x * 0; }
+inline int f7408_1(int x) { return x * 1; }
+inline int f7408_2(int x) { return x * 2; }
+inline int f7408_3(int x) { return x * 3; }
+inline int f7408_4(int x) { return x * 4; }
+inline int f7408_5(int x) { return x * 5; }
+inline int f7408_6(int x) { return x * 6; }
+inline int f7408_7(int x) { return x * 7; }
+inline int f7408_8(int x) { return x * 8; }
+inline int f7408_9(int x) { return x * 9; }
+inline int f7408_10(int x) { return x * 10; }
+inline int f7408_11(int x) { return x * 11; }
+inline int f7408_12(int x) { return x * 12; }
+inline int f7408_13(int x) { return x * 13; }
+inline int f7408_14(int x) { return x * 14; }
+inline int f7408_15(int x) { return x * 15; }
+inline int f7408_16(int x) { return x * 16; }
+inline int f7408_17(int x) { return x * 17; }
+inline int f7408_18(int x) { return x * 18; }
+inline int f7408_19(int x) { return x * 19; }
+inline int f7408_20(int x) { return x * 20; }
+inline int f7408_21(int x) { return x * 21; }
+inline int f7408_22(int x) { return x * 22; }
+inline int f7408_23(int x) { return x * 23; }
+inline int f7408_24(int x) { return x * 24; }
+inline int f7408_25(int x) { return x * 25; }
+inline int f7408_26(int x) { return x * 26; }
+inline int f7408_27(int x) { return x * 27; }
+inline int f7408_28(int x) { return x * 28; }
+inline int f7408_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 741 */
+#include <vector>
+#include "h1260.h"
+#include "h7420.h"
+#include "h8688.h"
+#include "h9854.h"
+#include "h180.h"
+#ifdef X
+#include "h3381.h"
+#endif
+struct S741 { int a; const char *s = "x//y"; };
+inline int f741_0(int x) { return x * 0; }
+inline int f741_1(int x) { return x * 1; }
+inline int f741_2(int x) { return x * 2; }
+inline int f741_3(int x) { return x * 3; }
+inline int f741_4(int x) { return x * 4; }
+inline int f741_5(int x) { return x * 5; }
+inline int f741_6(int x) { return x * 6; }
+inline int f741_7(int x) { return x * 7; }
+inline int f741_8(int x) { return x * 8; }
+inline int f741_9(int x) { return x * 9; }
+inline int f741_10(int x) { return x * 10; }
+inline int f741_11(int x) { return x * 11; }
+inline int f741_12(int x) { return x * 12; }
+inline int f741_13(int x) { return x * 13; }
+inline int f741_14(int x) { return x * 14; }
+inline int f741_15(int x) { return x * 15; }
+inline int f741_16(int x) { return x * 16; }
+inline int f741_17(int x) { return x * 17; }
+inline int f741_18(int x) { return x * 18; }
+inline int f741_19(int x) { return x * 19; }
+inline int f741_20(int x) { return x * 20; }
+inline int f741_21(int x) { return x * 21; }
+inline int f741_22(int x) { return x * 22; }
+inline int f741_23(int x) { return x * 23; }
+inline int f741_24(int x) { return x * 24; }
+inline int f741_25(int x) { return x * 25; }
+inline int f741_26(int x) { return x * 26; }
+inline int f741_27(int x) { return x * 27; }
+inline int f741_28(int x) { return x * 28; }
+inline int f741_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7412 */
+#include <vector>
+#include "h2386.h"
+#include "h5730.h"
+#include "h3941.h"
+#include "h1298.h"
+#include "h9570.h"
+#ifdef X
+#include "h7840.h"
+#endif
+struct S7412 { int a; const char *s = "x//y"; };
+inline int f7412_0(int x) { return x * 0; }
+inline int f7412_1(int x) { return x * 1; }
+inline int f7412_2(int x) { return x * 2; }
+inline int f7412_3(int x) { return x * 3; }
+inline int f7412_4(int x) { return x * 4; }
+inline int f7412_5(int x) { return x * 5; }
+inline int f7412_6(int x) { return x * 6; }
+inline int f7412_7(int x) { return x * 7; }
+inline int f7412_8(int x) { return x * 8; }
+inline int f7412_9(int x) { return x * 9; }
+inline int f7412_10(int x) { return x * 10; }
+inline int f7412_11(int x) { return x * 11; }
+inline int f7412_12(int x) { return x * 12; }
+inline int f7412_13(int x) { return x * 13; }
+inline int f7412_14(int x) { return x * 14; }
+inline int f7412_15(int x) { return x * 15; }
+inline int f7412_16(int x) { return x * 16; }
+inline int f7412_17(int x) { return x * 17; }
+inline int f7412_18(int x) { return x * 18; }
+inline int f7412_19(int x) { return x * 19; }
+inline int f7412_20(int x) { return x * 20; }
+inline int f7412_21(int x) { return x * 21; }
+inline int f7412_22(int x) { return x * 22; }
+inline int f7412_23(int x) { return x * 23; }
+inline int f7412_24(int x) { return x * 24; }
+inline int f7412_25(int x) { return x * 25; }
+inline int f7412_26(int x) { return x * 26; }
+inline int f7412_27(int x) { return x * 27; }
+inline int f7412_28(int x) { return x * 28; }
+inline int f7412_29(int x) { return x * 29; }
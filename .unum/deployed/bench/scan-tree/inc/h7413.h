@@ -0,0 +1,42 @@
+#pragma once
+/* header 7413 */
+#include <vector>
+#include "h7625.h"
+#include "h6388.h"
+#include "h1121.h"
+#include "h9983.h"
+#include "h1092.h"
+#ifdef X
+#include "h8496.h"
+#endif
+struct S7413 { int a; const char *s = "x//y"; };
+inline int f7413_0(int x) { return x * 0; }
+inline int f7413_1(int x) { return x * 1; }
+inline int f7413_2(int x) { return x * 2; }
+inline int f7413_3(int x) { return x * 3; }
+inline int f7413_4(int x) { return x * 4; }
+inline int f7413_5(int x) { return x * 5; }
+inline int f7413_6(int x) { return x * 6; }
+inline int f7413_7(int x) { return x * 7; }
+inline int f7413_8(int x) { return x * 8; }
+inline int f7413_9(int x) { return x * 9; }
+inline int f7413_10(int x) { return x * 10; }
+inline int f7413_11(int x) { return x * 11; }
+inline int f7413_12(int x) { return x * 12; }
+inline int f7413_13(int x) { return x * 13; }
+inline int f7413_14(int x) { return x * 14; }
+inline int f7413_15(int x) { return x * 15; }
+inline int f7413_16(int x) { return x * 16; }
+inline int f7413_17(int x) { return x * 17; }
+inline int f7413_18(int x) { return x * 18; }
+inline int f7413_19(int x) { return x * 19; }
+inline int f7413_20(int x) { return x * 20; }
+inline int f7413_21(int x) { return x * 21; }
+inline int f7413_22(int x) { return x * 22; }
+inline int f7413_23(int x) { return x * 23; }
+inline int f7413_24(int x) { return x * 24; }
+inline int f7413_25(int x) { return x * 25; }
+inline int f7413_26(int x) { return x * 26; }
+inline int f7413_27(int x) { return x * 27; }
+inline int f7413_28(int x) { return x * 28; }
+inline int f7413_29(int x) { return x * 29; }
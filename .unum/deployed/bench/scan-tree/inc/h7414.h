@@ -0,0 +1,42 @@
+#pragma once
+/* header 7414 */
+#include <vector>
+#include "h7986.h"
+#include "h7282.h"
+#include "h7700.h"
+#include "h9863.h"
+#include "h284.h"
+#ifdef X
+#include "h2385.h"
+#endif
+struct S7414 { int a; const char *s = "x//y"; };
+inline int f7414_0(int x) { return x * 0; }
+inline int f7414_1(int x) { return x * 1; }
+inline int f7414_2(int x) { return x * 2; }
+inline int f7414_3(int x) { return x * 3; }
+inline int f7414_4(int x) { return x * 4; }
+inline int f7414_5(int x) { return x * 5; }
+inline int f7414_6(int x) { return x * 6; }
+inline int f7414_7(int x) { return x * 7; }
+inline int f7414_8(int x) { return x * 8; }
+inline int f7414_9(int x) { return x * 9; }
+inline int f7414_10(int x) { return x * 10; }
+inline int f7414_11(int x) { return x * 11; }
+inline int f7414_12(int x) { return x * 12; }
+inline int f7414_13(int x) { return x * 13; }
+inline int f7414_14(int x) { return x * 14; }
+inline int f7414_15(int x) { return x * 15; }
+inline int f7414_16(int x) { return x * 16; }
+inline int f7414_17(int x) { return x * 17; }
+inline int f7414_18(int x) { return x * 18; }
+inline int f7414_19(int x) { return x * 19; }
+inline int f7414_20(int x) { return x * 20; }
+inline int f7414_21(int x) { return x * 21; }
+inline int f7414_22(int x) { return x * 22; }
+inline int f7414_23(int x) { return x * 23; }
+inline int f7414_24(int x) { return x * 24; }
+inline int f7414_25(int x) { return x * 25; }
+inline int f7414_26(int x) { return x * 26; }
+inline int f7414_27(int x) { return x * 27; }
+inline int f7414_28(int x) { return x * 28; }
+inline int f7414_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7415 */
+#include <vector>
+#include "h722.h"
+#include "h3376.h"
+#include "h6471.h"
+#include "h8427.h"
+#include "h948.h"
+#ifdef X
+#include "h4137.h"
+#endif
+struct S7415 { int a; const char *s = "x//y"; };
+inline int f7415_0(int x) { return x * 0; }
+inline int f7415_1(int x) { return x * 1; }
+inline int f7415_2(int x) { return x * 2; }
+inline int f7415_3(int x) { return x * 3; }
+inline int f7415_4(int x) { return x * 4; }
+inline int f7415_5(int x) { return x * 5; }
+inline int f7415_6(int x) { return x * 6; }
+inline int f7415_7(int x) { return x * 7; }
+inline int f7415_8(int x) { return x * 8; }
+inline int f7415_9(int x) { return x * 9; }
+inline int f7415_10(int x) { return x * 10; }
+inline int f7415_11(int x) { return x * 11; }
+inline int f7415_12(int x) { return x * 12; }
+inline int f7415_13(int x) { return x * 13; }
+inline int f7415_14(int x) { return x * 14; }
+inline int f7415_15(int x) { return x * 15; }
+inline int f7415_16(int x) { return x * 16; }
+inline int f7415_17(int x) { return x * 17; }
+inline int f7415_18(int x) { return x * 18; }
+inline int f7415_19(int x) { return x * 19; }
+inline int f7415_20(int x) { return x * 20; }
+inline int f7415_21(int x) { return x * 21; }
+inline int f7415_22(int x) { return x * 22; }
+inline int f7415_23(int x) { return x * 23; }
+inline int f7415_24(int x) { return x * 24; }
+inline int f7415_25(int x) { return x * 25; }
+inline int f7415_26(int x) { return x * 26; }
+inline int f7415_27(int x) { return x * 27; }
+inline int f7415_28(int x) { return x * 28; }
+inline int f7415_29(int x) { return x * 29; }
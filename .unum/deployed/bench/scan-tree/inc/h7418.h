@@ -0,0 +1,42 @@
+#pragma once
+/* header 7418 */
+#include <vector>
+#include "h7213.h"
+#include "h6780.h"
+#include "h5140.h"
+#include "h8385.h"
+#include "h9730.h"
+#ifdef X
+#include "h306.h"
+#endif
+struct S7418 { int a; const char *s = "x//y"; };
+inline int f7418_0(int x) { return x * 0; }
+inline int f7418_1(int x) { return x * 1; }
+inline int f7418_2(int x) { return x * 2; }
+inline int f7418_3(int x) { return x * 3; }
+inline int f7418_4(int x) { return x * 4; }
+inline int f7418_5(int x) { return x * 5; }
+inline int f7418_6(int x) { return x * 6; }
+inline int f7418_7(int x) { return x * 7; }
+inline int f7418_8(int x) { return x * 8; }
+inline int f7418_9(int x) { return x * 9; }
+inline int f7418_10(int x) { return x * 10; }
+inline int f7418_11(int x) { return x * 11; }
+inline int f7418_12(int x) { return x * 12; }
+inline int f7418_13(int x) { return x * 13; }
+inline int f7418_14(int x) { return x * 14; }
+inline int f7418_15(int x) { return x * 15; }
+inline int f7418_16(int x) { return x * 16; }
+inline int f7418_17(int x) { return x * 17; }
+inline int f7418_18(int x) { return x * 18; }
+inline int f7418_19(int x) { return x * 19; }
+inline int f7418_20(int x) { return x * 20; }
+inline int f7418_21(int x) { return x * 21; }
+inline int f7418_22(int x) { return x * 22; }
+inline int f7418_23(int x) { return x * 23; }
+inline int f7418_24(int x) { return x * 24; }
+inline int f7418_25(int x) { return x * 25; }
+inline int f7418_26(int x) { return x * 26; }
+inline int f7418_27(int x) { return x * 27; }
+inline int f7418_28(int x) { return x * 28; }
+inline int f7418_29(int x) { return x * 29; }
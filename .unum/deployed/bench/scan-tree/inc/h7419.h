@@ -0,0 +1,42 @@
+#pragma once
+/* header 7419 */
+#include <vector>
+#include "h5940.h"
+#include "h4013.h"
+#include "h7316.h"
+#include "h6092.h"
+#include "h3090.h"
+#ifdef X
+#include "h7895.h"
+#endif
+struct S7419 { int a; const char *s = "x//y"; };
+inline int f7419_0(int x) { return x * 0; }
+inline int f7419_1(int x) { return x * 1; }
+inline int f7419_2(int x) { return x * 2; }
+inline int f7419_3(int x) { return x * 3; }
+inline int f7419_4(int x) { return x * 4; }
+inline int f7419_5(int x) { return x * 5; }
+inline int f7419_6(int x) { return x * 6; }
+inline int f7419_7(int x) { return x * 7; }
+inline int f7419_8(int x) { return x * 8; }
+inline int f7419_9(int x) { return x * 9; }
+inline int f7419_10(int x) { return x * 10; }
+inline int f7419_11(int x) { return x * 11; }
+inline int f7419_12(int x) { return x * 12; }
+inline int f7419_13(int x) { return x * 13; }
+inline int f7419_14(int x) { return x * 14; }
+inline int f7419_15(int x) { return x * 15; }
+inline int f7419_16(int x) { return x * 16; }
+inline int f7419_17(int x) { return x * 17; }
+inline int f7419_18(int x) { return x * 18; }
+inline int f7419_19(int x) { return x * 19; }
+inline int f7419_20(int x) { return x * 20; }
+inline int f7419_21(int x) { return x * 21; }
+inline int f7419_22(int x) { return x * 22; }
+inline int f7419_23(int x) { return x * 23; }
+inline int f7419_24(int x) { return x * 24; }
+inline int f7419_25(int x) { return x * 25; }
+inline int f7419_26(int x) { return x * 26; }
+inline int f7419_27(int x) { return x * 27; }
+inline int f7419_28(int x) { return x * 28; }
+inline int f7419_29(int x) { return x * 29; }
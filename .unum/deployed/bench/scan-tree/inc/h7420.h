@@ -0,0 +1,42 @@
+#pragma once
+/* header 7420 */
+#include <vector>
+#include "h4632.h"
+#include "h3144.h"
+#include "h9657.h"
+#include "h4371.h"
+#include "h3693.h"
+#ifdef X
+#include "h9054.h"
+#endif
+struct S7420 { int a; const char *s = "x//y"; };
+inline int f7420_0(int x) { return x * 0; }
+inline int f7420_1(int x) { return x * 1; }
+inline int f7420_2(int x) { return x * 2; }
+inline int f7420_3(int x) { return x * 3; }
+inline int f7420_4(int x) { return x * 4; }
+inline int f7420_5(int x) { return x * 5; }
+inline int f7420_6(int x) { return x * 6; }
+inline int f7420_7(int x) { return x * 7; }
+inline int f7420_8(int x) { return x * 8; }
+inline int f7420_9(int x) { return x * 9; }
+inline int f7420_10(int x) { return x * 10; }
+inline int f7420_11(int x) { return x * 11; }
+inline int f7420_12(int x) { return x * 12; }
+inline int f7420_13(int x) { return x * 13; }
+inline int f7420_14(int x) { return x * 14; }
+inline int f7420_15(int x) { return x * 15; }
+inline int f7420_16(int x) { return x * 16; }
+inline int f7420_17(int x) { return x * 17; }
+inline int f7420_18(int x) { return x * 18; }
+inline int f7420_19(int x) { return x * 19; }
+inline int f7420_20(int x) { return x * 20; }
+inline int f7420_21(int x) { return x * 21; }
+inline int f7420_22(int x) { return x * 22; }
+inline int f7420_23(int x) { return x * 23; }
+inline int f7420_24(int x) { return x * 24; }
+inline int f7420_25(int x) { return x * 25; }
+inline int f7420_26(int x) { return x * 26; }
+inline int f7420_27(int x) { return x * 27; }
+inline int f7420_28(int x) { return x * 28; }
+inline int f7420_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7421 */
+#include <vector>
+#include "h8907.h"
+#include "h7149.h"
+#include "h9376.h"
+#include "h6473.h"
+#include "h2481.h"
+#ifdef X
+#include "h2281.h"
+#endif
+struct S7421 { int a; const char *s = "x//y"; };
+inline int f7421_0(int x) { return x * 0; }
+inline int f7421_1(int x) { return x * 1; }
+inline int f7421_2(int x) { return x * 2; }
+inline int f7421_3(int x) { return x * 3; }
+inline int f7421_4(int x) { return x * 4; }
+inline int f7421_5(int x) { return x * 5; }
+inline int f7421_6(int x) { return x * 6; }
+inline int f7421_7(int x) { return x * 7; }
+inline int f7421_8(int x) { return x * 8; }
+inline int f7421_9(int x) { return x * 9; }
+inline int f7421_10(int x) { return x * 10; }
+inline int f7421_11(int x) { return x * 11; }
+inline int f7421_12(int x) { return x * 12; }
+inline int f7421_13(int x) { return x * 13; }
+inline int f7421_14(int x) { return x * 14; }
+inline int f7421_15(int x) { return x * 15; }
+inline int f7421_16(int x) { return x * 16; }
+inline int f7421_17(int x) { return x * 17; }
+inline int f7421_18(int x) { return x * 18; }
+inline int f7421_19(int x) { return x * 19; }
+inline int f7421_20(int x) { return x * 20; }
+inline int f7421_21(int x) { return x * 21; }
+inline int f7421_22(int x) { return x * 22; }
+inline int f7421_23(int x) { return x * 23; }
+inline int f7421_24(int x) { return x * 24; }
+inline int f7421_25(int x) { return x * 25; }
+inline int f7421_26(int x) { return x * 26; }
+inline int f7421_27(int x) { return x * 27; }
+inline int f7421_28(int x) { return x * 28; }
+inline int f7421_29(int x) { return x * 29; }
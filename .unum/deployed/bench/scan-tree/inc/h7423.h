@@ -0,0 +1,42 @@
+#pragma once
+/* header 7423 */
+#include <vector>
+#include "h6379.h"
+#include "h3511.h"
+#include "h6128.h"
+#include "h9848.h"
+#include "h1315.h"
+#ifdef X
+#include "h781.h"
+#endif
+struct S7423 { int a; const char *s = "x//y"; };
+inline int f7423_0(int x) { return x * 0; }
+inline int f7423_1(int x) { return x * 1; }
+inline int f7423_2(int x) { return x * 2; }
+inline int f7423_3(int x) { return x * 3; }
+inline int f7423_4(int x) { return x * 4; }
+inline int f7423_5(int x) { return x * 5; }
+inline int f7423_6(int x) { return x * 6; }
+inline int f7423_7(int x) { return x * 7; }
+inline int f7423_8(int x) { return x * 8; }
+inline int f7423_9(int x) { return x * 9; }
+inline int f7423_10(int x) { return x * 10; }
+inline int f7423_11(int x) { return x * 11; }
+inline int f7423_12(int x) { return x * 12; }
+inline int f7423_13(int x) { return x * 13; }
+inline int f7423_14(int x) { return x * 14; }
+inline int f7423_15(int x) { return x * 15; }
+inline int f7423_16(int x) { return x * 16; }
+inline int f7423_17(int x) { return x * 17; }
+inline int f7423_18(int x) { return x * 18; }
+inline int f7423_19(int x) { return x * 19; }
+inline int f7423_20(int x) { return x * 20; }
+inline int f7423_21(int x) { return x * 21; }
+inline int f7423_22(int x) { return x * 22; }
+inline int f7423_23(int x) { return x * 23; }
+inline int f7423_24(int x) { return x * 24; }
+inline int f7423_25(int x) { return x * 25; }
+inline int f7423_26(int x) { return x * 26; }
+inline int f7423_27(int x) { return x * 27; }
+inline int f7423_28(int x) { return x * 28; }
+inline int f7423_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7424 */
+#include <vector>
+#include "h6449.h"
+#include "h3742.h"
+#include "h7913.h"
+#include "h7467.h"
+#include "h6283.h"
+#ifdef X
+#include "h7291.h"
+#endif
+struct S7424 { int a; const char *s = "x//y"; };
+inline int f7424_0(int x) { return x * 0; }
+inline int f7424_1(int x) { return x * 1; }
+inline int f7424_2(int x) { return x * 2; }
+inline int f7424_3(int x) { return x * 3; }
+inline int f7424_4(int x) { return x * 4; }
+inline int f7424_5(int x) { return x * 5; }
+inline int f7424_6(int x) { return x * 6; }
+inline int f7424_7(int x) { return x * 7; }
+inline int f7424_8(int x) { return x * 8; }
+inline int f7424_9(int x) { return x * 9; }
+inline int f7424_10(int x) { return x * 10; }
+inline int f7424_11(int x) { return x * 11; }
+inline int f7424_12(int x) { return x * 12; }
+inline int f7424_13(int x) { return x * 13; }
+inline int f7424_14(int x) { return x * 14; }
+inline int f7424_15(int x) { return x * 15; }
+inline int f7424_16(int x) { return x * 16; }
+inline int f7424_17(int x) { return x * 17; }
+inline int f7424_18(int x) { return x * 18; }
+inline int f7424_19(int x) { return x * 19; }
+inline int f7424_20(int x) { return x * 20; }
+inline int f7424_21(int x) { return x * 21; }
+inline int f7424_22(int x) { return x * 22; }
+inline int f7424_23(int x) { return x * 23; }
+inline int f7424_24(int x) { return x * 24; }
+inline int f7424_25(int x) { return x * 25; }
+inline int f7424_26(int x) { return x * 26; }
+inline int f7424_27(int x) { return x * 27; }
+inline int f7424_28(int x) { return x * 28; }
+inline int f7424_29(int x) { return x * 29; }
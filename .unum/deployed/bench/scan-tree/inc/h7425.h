@@ -0,0 +1,42 @@
+#pragma once
+/* header 7425 */
+#include <vector>
+#include "h1419.h"
+#include "h8152.h"
+#include "h6390.h"
+#include "h8557.h"
+#include "h6136.h"
+#ifdef X
+#include "h4401.h"
+#endif
+struct S7425 { int a; const char *s = "x//y"; };
+inline int f7425_0(int x) { return x * 0; }
+inline int f7425_1(int x) { return x * 1; }
+inline int f7425_2(int x) { return x * 2; }
+inline int f7425_3(int x) { return x * 3; }
+inline int f7425_4(int x) { return x * 4; }
+inline int f7425_5(int x) { return x * 5; }
+inline int f7425_6(int x) { return x * 6; }
+inline int f7425_7(int x) { return x * 7; }
+inline int f7425_8(int x) { return x * 8; }
+inline int f7425_9(int x) { return x * 9; }
+inline int f7425_10(int x) { return x * 10; }
+inline int f7425_11(int x) { return x * 11; }
+inline int f7425_12(int x) { return x * 12; }
+inline int f7425_13(int x) { return x * 13; }
+inline int f7425_14(int x) { return x * 14; }
+inline int f7425_15(int x) { return x * 15; }
+inline int f7425_16(int x) { return x * 16; }
+inline int f7425_17(int x) { return x * 17; }
+inline int f7425_18(int x) { return x * 18; }
+inline int f7425_19(int x) { return x * 19; }
+inline int f7425_20(int x) { return x * 20; }
+inline int f7425_21(int x) { return x * 21; }
+inline int f7425_22(int x) { return x * 22; }
+inline int f7425_23(int x) { return x * 23; }
+inline int f7425_24(int x) { return x * 24; }
+inline int f7425_25(int x) { return x * 25; }
+inline int f7425_26(int x) { return x * 26; }
+inline int f7425_27(int x) { return x * 27; }
+inline int f7425_28(int x) { return x * 28; }
+inline int f7425_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7429 */
+#include <vector>
+#include "h1502.h"
+#include "h1725.h"
+#include "h9551.h"
+#include "h758.h"
+#include "h3017.h"
+#ifdef X
+#include "h203.h"
+#endif
+struct S7429 { int a; const char *s = "x//y"; };
+inline int f7429_0(int x) { return x * 0; }
+inline int f7429_1(int x) { return x * 1; }
+inline int f7429_2(int x) { return x * 2; }
+inline int f7429_3(int x) { return x * 3; }
+inline int f7429_4(int x) { return x * 4; }
+inline int f7429_5(int x) { return x * 5; }
+inline int f7429_6(int x) { return x * 6; }
+inline int f7429_7(int x) { return x * 7; }
+inline int f7429_8(int x) { return x * 8; }
+inline int f7429_9(int x) { return x * 9; }
+inline int f7429_10(int x) { return x * 10; }
+inline int f7429_11(int x) { return x * 11; }
+inline int f7429_12(int x) { return x * 12; }
+inline int f7429_13(int x) { return x * 13; }
+inline int f7429_14(int x) { return x * 14; }
+inline int f7429_15(int x) { return x * 15; }
+inline int f7429_16(int x) { return x * 16; }
+inline int f7429_17(int x) { return x * 17; }
+inline int f7429_18(int x) { return x * 18; }
+inline int f7429_19(int x) { return x * 19; }
+inline int f7429_20(int x) { return x * 20; }
+inline int f7429_21(int x) { return x * 21; }
+inline int f7429_22(int x) { return x * 22; }
+inline int f7429_23(int x) { return x * 23; }
+inline int f7429_24(int x) { return x * 24; }
+inline int f7429_25(int x) { return x * 25; }
+inline int f7429_26(int x) { return x * 26; }
+inline int f7429_27(int x) { return x * 27; }
+inline int f7429_28(int x) { return x * 28; }
+inline int f7429_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 743 */
+#include <vector>
+#include "h4784.h"
+#include "h1627.h"
+#include "h7357.h"
+#include "h8153.h"
+#include "h6365.h"
+#ifdef X
+#include "h2800.h"
+#endif
+struct S743 { int a; const char *s = "x//y"; };
+inline int f743_0(int x) { return x * 0; }
+inline int f743_1(int x) { return x * 1; }
+inline int f743_2(int x) { return x * 2; }
+inline int f743_3(int x) { return x * 3; }
+inline int f743_4(int x) { return x * 4; }
+inline int f743_5(int x) { return x * 5; }
+inline int f743_6(int x) { return x * 6; }
+inline int f743_7(int x) { return x * 7; }
+inline int f743_8(int x) { return x * 8; }
+inline int f743_9(int x) { return x * 9; }
+inline int f743_10(int x) { return x * 10; }
+inline int f743_11(int x) { return x * 11; }
+inline int f743_12(int x) { return x * 12; }
+inline int f743_13(int x) { return x * 13; }
+inline int f743_14(int x) { return x * 14; }
+inline int f743_15(int x) { return x * 15; }
+inline int f743_16(int x) { return x * 16; }
+inline int f743_17(int x) { return x * 17; }
+inline int f743_18(int x) { return x * 18; }
+inline int f743_19(int x) { return x * 19; }
+inline int f743_20(int x) { return x * 20; }
+inline int f743_21(int x) { return x * 21; }
+inline int f743_22(int x) { return x * 22; }
+inline int f743_23(int x) { return x * 23; }
+inline int f743_24(int x) { return x * 24; }
+inline int f743_25(int x) { return x * 25; }
+inline int f743_26(int x) { return x * 26; }
+inline int f743_27(int x) { return x * 27; }
+inline int f743_28(int x) { return x * 28; }
+inline int f743_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7432 */
+#include <vector>
+#include "h7829.h"
+#include "h1469.h"
+#include "h4236.h"
+#include "h6517.h"
+#include "h7955.h"
+#ifdef X
+#include "h437.h"
+#endif
+struct S7432 { int a; const char *s = "x//y"; };
+inline int f7432_0(int x) { return x * 0; }
+inline int f7432_1(int x) { return x * 1; }
+inline int f7432_2(int x) { return x * 2; }
+inline int f7432_3(int x) { return x * 3; }
+inline int f7432_4(int x) { return x * 4; }
+inline int f7432_5(int x) { return x * 5; }
+inline int f7432_6(int x) { return x * 6; }
+inline int f7432_7(int x) { return x * 7; }
+inline int f7432_8(int x) { return x * 8; }
+inline int f7432_9(int x) { return x * 9; }
+inline int f7432_10(int x) { return x * 10; }
+inline int f7432_11(int x) { return x * 11; }
+inline int f7432_12(int x) { return x * 12; }
+inline int f7432_13(int x) { return x * 13; }
+inline int f7432_14(int x) { return x * 14; }
+inline int f7432_15(int x) { return x * 15; }
+inline int f7432_16(int x) { return x * 16; }
+inline int f7432_17(int x) { return x * 17; }
+inline int f7432_18(int x) { return x * 18; }
+inline int f7432_19(int x) { return x * 19; }
+inline int f7432_20(int x) { return x * 20; }
+inline int f7432_21(int x) { return x * 21; }
+inline int f7432_22(int x) { return x * 22; }
+inline int f7432_23(int x) { return x * 23; }
+inline int f7432_24(int x) { return x * 24; }
+inline int f7432_25(int x) { return x * 25; }
+inline int f7432_26(int x) { return x * 26; }
+inline int f7432_27(int x) { return x * 27; }
+inline int f7432_28(int x) { return x * 28; }
+inline int f7432_29(int x) { return x * 29; }
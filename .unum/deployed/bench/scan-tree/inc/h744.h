@@ -0,0 +1,42 @@
+#pragma once
+/* header 744 */
+#include <vector>
+#include "h4936.h"
+#include "h2127.h"
+#include "h2388.h"
+#include "h588.h"
+#include "h4670.h"
+#ifdef X
+#include "h6264.h"
+#endif
+struct S744 { int a; const char *s = "x//y"; };
+inline int f744_0(int x) { return x * 0; }
+inline int f744_1(int x) { return x * 1; }
+inline int f744_2(int x) { return x * 2; }
+inline int f744_3(int x) { return x * 3; }
+inline int f744_4(int x) { return x * 4; }
+inline int f744_5(int x) { return x * 5; }
+inline int f744_6(int x) { return x * 6; }
+inline int f744_7(int x) { return x * 7; }
+inline int f744_8(int x) { return x * 8; }
+inline int f744_9(int x) { return x * 9; }
+inline int f744_10(int x) { return x * 10; }
+inline int f744_11(int x) { return x * 11; }
+inline int f744_12(int x) { return x * 12; }
+inline int f744_13(int x) { return x * 13; }
+inline int f744_14(int x) { return x * 14; }
+inline int f744_15(int x) { return x * 15; }
+inline int f744_16(int x) { return x * 16; }
+inline int f744_17(int x) { return x * 17; }
+inline int f744_18(int x) { return x * 18; }
+inline int f744_19(int x) { return x * 19; }
+inline int f744_20(int x) { return x * 20; }
+inline int f744_21(int x) { return x * 21; }
+inline int f744_22(int x) { return x * 22; }
+inline int f744_23(int x) { return x * 23; }
+inline int f744_24(int x) { return x * 24; }
+inline int f744_25(int x) { return x * 25; }
+inline int f744_26(int x) { return x * 26; }
+inline int f744_27(int x) { return x * 27; }
+inline int f744_28(int x) { return x * 28; }
+inline int f744_29(int x) { return x * 29; }
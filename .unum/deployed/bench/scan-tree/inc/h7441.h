@@ -0,0 +1,42 @@
+#pragma once
+/* header 7441 */
+#include <vector>
+#include "h7285.h"
+#include "h8198.h"
+#include "h2815.h"
+#include "h4933.h"
+#include "h3070.h"
+#ifdef X
+#include "h5619.h"
+#endif
+struct S7441 { int a; const char *s = "x//y"; };
+inline int f7441_0(int x) { return x * 0; }
+inline int f7441_1(int x) { return x * 1; }
+inline int f7441_2(int x) { return x * 2; }
+inline int f7441_3(int x) { return x * 3; }
+inline int f7441_4(int x) { return x * 4; }
+inline int f7441_5(int x) { return x * 5; }
+inline int f7441_6(int x) { return x * 6; }
+inline int f7441_7(int x) { return x * 7; }
+inline int f7441_8(int x) { return x * 8; }
+inline int f7441_9(int x) { return x * 9; }
+inline int f7441_10(int x) { return x * 10; }
+inline int f7441_11(int x) { return x * 11; }
+inline int f7441_12(int x) { return x * 12; }
+inline int f7441_13(int x) { return x * 13; }
+inline int f7441_14(int x) { return x * 14; }
+inline int f7441_15(int x) { return x * 15; }
+inline int f7441_16(int x) { return x * 16; }
+inline int f7441_17(int x) { return x * 17; }
+inline int f7441_18(int x) { return x * 18; }
+inline int f7441_19(int x) { return x * 19; }
+inline int f7441_20(int x) { return x * 20; }
+inline int f7441_21(int x) { return x * 21; }
+inline int f7441_22(int x) { return x * 22; }
+inline int f7441_23(int x) { return x * 23; }
+inline int f7441_24(int x) { return x * 24; }
+inline int f7441_25(int x) { return x * 25; }
+inline int f7441_26(int x) { return x * 26; }
+inline int f7441_27(int x) { return x * 27; }
+inline int f7441_28(int x) { return x * 28; }
+inline int f7441_29(int x) { return x * 29; }
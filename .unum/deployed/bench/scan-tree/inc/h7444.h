@@ -0,0 +1,42 @@
+#pragma once
+/* header 7444 */
+#include <vector>
+#include "h3699.h"
+#include "h2455.h"
+#include "h8302.h"
+#include "h7803.h"
+#include "h7869.h"
+#ifdef X
+#include "h3553.h"
+#endif
+struct S7444 { int a; const char *s = "x//y"; };
+inline int f7444_0(int x) { return x * 0; }
+inline int f7444_1(int x) { return x * 1; }
+inline int f7444_2(int x) { return x * 2; }
+inline int f7444_3(int x) { return x * 3; }
+inline int f7444_4(int x) { return x * 4; }
+inline int f7444_5(int x) { return x * 5; }
+inline int f7444_6(int x) { return x * 6; }
+inline int f7444_7(int x) { return x * 7; }
+inline int f7444_8(int x) { return x * 8; }
+inline int f7444_9(int x) { return x * 9; }
+inline int f7444_10(int x) { return x * 10; }
+inline int f7444_11(int x) { return x * 11; }
+inline int f7444_12(int x) { return x * 12; }
+inline int f7444_13(int x) { return x * 13; }
+inline int f7444_14(int x) { return x * 14; }
+inline int f7444_15(int x) { return x * 15; }
+inline int f7444_16(int x) { return x * 16; }
+inline int f7444_17(int x) { return x * 17; }
+inline int f7444_18(int x) { return x * 18; }
+inline int f7444_19(int x) { return x * 19; }
+inline int f7444_20(int x) { return x * 20; }
+inline int f7444_21(int x) { return x * 21; }
+inline int f7444_22(int x) { return x * 22; }
+inline int f7444_23(int x) { return x * 23; }
+inline int f7444_24(int x) { return x * 24; }
+inline int f7444_25(int x) { return x * 25; }
+inline int f7444_26(int x) { return x * 26; }
+inline int f7444_27(int x) { return x * 27; }
+inline int f7444_28(int x) { return x * 28; }
+inline int f7444_29(int x) { return x * 29; }
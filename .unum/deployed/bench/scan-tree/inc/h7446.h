@@ -0,0 +1,42 @@
+#pragma once
+/* header 7446 */
+#include <vector>
+#include "h829.h"
+#include "h3850.h"
+#include "h7884.h"
+#include "h2796.h"
+#include "h1896.h"
+#ifdef X
+#include "h4843.h"
+#endif
+struct S7446 { int a; const char *s = "x//y"; };
+inline int f7446_0(int x) { return x * 0; }
+inline int f7446_1(int x) { return x * 1; }
+inline int f7446_2(int x) { return x * 2; }
+inline int f7446_3(int x) { return x * 3; }
+inline int f7446_4(int x) { return x * 4; }
+inline int f7446_5(int x) { return x * 5; }
+inline int f7446_6(int x) { return x * 6; }
+inline int f7446_7(int x) { return x * 7; }
+inline int f7446_8(int x) { return x * 8; }
+inline int f7446_9(int x) { return x * 9; }
+inline int f7446_10(int x) { return x * 10; }
+inline int f7446_11(int x) { return x * 11; }
+inline int f7446_12(int x) { return x * 12; }
+inline int f7446_13(int x) { return x * 13; }
+inline int f7446_14(int x) { return x * 14; }
+inline int f7446_15(int x) { return x * 15; }
+inline int f7446_16(int x) { return x * 16; }
+inline int f7446_17(int x) { return x * 17; }
+inline int f7446_18(int x) { return x * 18; }
+inline int f7446_19(int x) { return x * 19; }
+inline int f7446_20(int x) { return x * 20; }
+inline int f7446_21(int x) { return x * 21; }
+inline int f7446_22(int x) { return x * 22; }
+inline int f7446_23(int x) { return x * 23; }
+inline int f7446_24(int x) { return x * 24; }
+inline int f7446_25(int x) { return x * 25; }
+inline int f7446_26(int x) { return x * 26; }
+inline int f7446_27(int x) { return x * 27; }
+inline int f7446_28(int x) { return x * 28; }
+inline int f7446_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7447 */
+#include <vector>
+#include "h5379.h"
+#include "h1307.h"
+#include "h6912.h"
+#include "h8442.h"
+#include "h6112.h"
+#ifdef X
+#include "h5084.h"
+#endif
+struct S7447 { int a; const char *s = "x//y"; };
+inline int f7447_0(int x) { return x * 0; }
+inline int f7447_1(int x) { return x * 1; }
+inline int f7447_2(int x) { return x * 2; }
+inline int f7447_3(int x) { return x * 3; }
+inline int f7447_4(int x) { return x * 4; }
+inline int f7447_5(int x) { return x * 5; }
+inline int f7447_6(int x) { return x * 6; }
+inline int f7447_7(int x) { return x * 7; }
+inline int f7447_8(int x) { return x * 8; }
+inline int f7447_9(int x) { return x * 9; }
+inline int f7447_10(int x) { return x * 10; }
+inline int f7447_11(int x) { return x * 11; }
+inline int f7447_12(int x) { return x * 12; }
+inline int f7447_13(int x) { return x * 13; }
+inline int f7447_14(int x) { return x * 14; }
+inline int f7447_15(int x) { return x * 15; }
+inline int f7447_16(int x) { return x * 16; }
+inline int f7447_17(int x) { return x * 17; }
+inline int f7447_18(int x) { return x * 18; }
+inline int f7447_19(int x) { return x * 19; }
+inline int f7447_20(int x) { return x * 20; }
+inline int f7447_21(int x) { return x * 21; }
+inline int f7447_22(int x) { return x * 22; }
+inline int f7447_23(int x) { return x * 23; }
+inline int f7447_24(int x) { return x * 24; }
+inline int f7447_25(int x) { return x * 25; }
+inline int f7447_26(int x) { return x * 26; }
+inline int f7447_27(int x) { return x * 27; }
+inline int f7447_28(int x) { return x * 28; }
+inline int f7447_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7449 */
+#include <vector>
+#include "h3188.h"
+#include "h4666.h"
+#include "h7049.h"
+#include "h8590.h"
+#include "h1811.h"
+#ifdef X
+#include "h8944.h"
+#endif
+struct S7449 { int a; const char *s = "x//y"; };
+inline int f7449_0(int x) { return x * 0; }
+inline int f7449_1(int x) { return x * 1; }
+inline int f7449_2(int x) { return x * 2; }
+inline int f7449_3(int x) { return x * 3; }
+inline int f7449_4(int x) { return x * 4; }
+inline int f7449_5(int x) { return x * 5; }
+inline int f7449_6(int x) { return x * 6; }
+inline int f7449_7(int x) { return x * 7; }
+inline int f7449_8(int x) { return x * 8; }
+inline int f7449_9(int x) { return x * 9; }
+inline int f7449_10(int x) { return x * 10; }
+inline int f7449_11(int x) { return x * 11; }
+inline int f7449_12(int x) { return x * 12; }
+inline int f7449_13(int x) { return x * 13; }
+inline int f7449_14(int x) { return x * 14; }
+inline int f7449_15(int x) { return x * 15; }
+inline int f7449_16(int x) { return x * 16; }
+inline int f7449_17(int x) { return x * 17; }
+inline int f7449_18(int x) { return x * 18; }
+inline int f7449_19(int x) { return x * 19; }
+inline int f7449_20(int x) { return x * 20; }
+inline int f7449_21(int x) { return x * 21; }
+inline int f7449_22(int x) { return x * 22; }
+inline int f7449_23(int x) { return x * 23; }
+inline int f7449_24(int x) { return x * 24; }
+inline int f7449_25(int x) { return x * 25; }
+inline int f7449_26(int x) { return x * 26; }
+inline int f7449_27(int x) { return x * 27; }
+inline int f7449_28(int x) { return x * 28; }
+inline int f7449_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 745 */
+#include <vector>
+#include "h5930.h"
+#include "h4766.h"
+#include "h5309.h"
+#include "h4716.h"
+#include "h1073.h"
+#ifdef X
+#include "h1162.h"
+#endif
+struct S745 { int a; const char *s = "x//y"; };
+inline int f745_0(int x) { return x * 0; }
+inline int f745_1(int x) { return x * 1; }
+inline int f745_2(int x) { return x * 2; }
+inline int f745_3(int x) { return x * 3; }
+inline int f745_4(int x) { return x * 4; }
+inline int f745_5(int x) { return x * 5; }
+inline int f745_6(int x) { return x * 6; }
+inline int f745_7(int x) { return x * 7; }
+inline int f745_8(int x) { return x * 8; }
+inline int f745_9(int x) { return x * 9; }
+inline int f745_10(int x) { return x * 10; }
+inline int f745_11(int x) { return x * 11; }
+inline int f745_12(int x) { return x * 12; }
+inline int f745_13(int x) { return x * 13; }
+inline int f745_14(int x) { return x * 14; }
+inline int f745_15(int x) { return x * 15; }
+inline int f745_16(int x) { return x * 16; }
+inline int f745_17(int x) { return x * 17; }
+inline int f745_18(int x) { return x * 18; }
+inline int f745_19(int x) { return x * 19; }
+inline int f745_20(int x) { return x * 20; }
+inline int f745_21(int x) { return x * 21; }
+inline int f745_22(int x) { return x * 22; }
+inline int f745_23(int x) { return x * 23; }
+inline int f745_24(int x) { return x * 24; }
+inline int f745_25(int x) { return x * 25; }
+inline int f745_26(int x) { return x * 26; }
+inline int f745_27(int x) { return x * 27; }
+inline int f745_28(int x) { return x * 28; }
+inline int f745_29(int x) { return x * 29; }
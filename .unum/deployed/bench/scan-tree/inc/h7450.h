@@ -0,0 +1,42 @@
+#pragma once
+/* header 7450 */
+#include <vector>
+#include "h9019.h"
+#include "h9631.h"
+#include "h2143.h"
+#include "h9993.h"
+#include "h963.h"
+#ifdef X
+#include "h7051.h"
+#endif
+struct S7450 { int a; const char *s = "x//y"; };
+inline int f7450_0(int x) { return x * 0; }
+inline int f7450_1(int x) { return x * 1; }
+inline int f7450_2(int x) { return x * 2; }
+inline int f7450_3(int x) { return x * 3; }
+inline int f7450_4(int x) { return x * 4; }
+inline int f7450_5(int x) { return x * 5; }
+inline int f7450_6(int x) { return x * 6; }
+inline int f7450_7(int x) { return x * 7; }
+inline int f7450_8(int x) { return x * 8; }
+inline int f7450_9(int x) { return x * 9; }
+inline int f7450_10(int x) { return x * 10; }
+inline int f7450_11(int x) { return x * 11; }
+inline int f7450_12(int x) { return x * 12; }
+inline int f7450_13(int x) { return x * 13; }
+inline int f7450_14(int x) { return x * 14; }
+inline int f7450_15(int x) { return x * 15; }
+inline int f7450_16(int x) { return x * 16; }
+inline int f7450_17(int x) { return x * 17; }
+inline int f7450_18(int x) { return x * 18; }
+inline int f7450_19(int x) { return x * 19; }
+inline int f7450_20(int x) { return x * 20; }
+inline int f7450_21(int x) { return x * 21; }
+inline int f7450_22(int x) { return x * 22; }
+inline int f7450_23(int x) { return x * 23; }
+inline int f7450_24(int x) { return x * 24; }
+inline int f7450_25(int x) { return x * 25; }
+inline int f7450_26(int x) { return x * 26; }
+inline int f7450_27(int x) { return x * 27; }
+inline int f7450_28(int x) { return x * 28; }
+inline int f7450_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7451 */
+#include <vector>
+#include "h7879.h"
+#include "h1622.h"
+#include "h5705.h"
+#include "h4546.h"
+#include "h2836.h"
+#ifdef X
+#include "h631.h"
+#endif
+struct S7451 { int a; const char *s = "x//y"; };
+inline int f7451_0(int x) { return x * 0; }
+inline int f7451_1(int x) { return x * 1; }
+inline int f7451_2(int x) { return x * 2; }
+inline int f7451_3(int x) { return x * 3; }
+inline int f7451_4(int x) { return x * 4; }
+inline int f7451_5(int x) { return x * 5; }
+inline int f7451_6(int x) { return x * 6; }
+inline int f7451_7(int x) { return x * 7; }
+inline int f7451_8(int x) { return x * 8; }
+inline int f7451_9(int x) { return x * 9; }
+inline int f7451_10(int x) { return x * 10; }
+inline int f7451_11(int x) { return x * 11; }
+inline int f7451_12(int x) { return x * 12; }
+inline int f7451_13(int x) { return x * 13; }
+inline int f7451_14(int x) { return x * 14; }
+inline int f7451_15(int x) { return x * 15; }
+inline int f7451_16(int x) { return x * 16; }
+inline int f7451_17(int x) { return x * 17; }
+inline int f7451_18(int x) { return x * 18; }
+inline int f7451_19(int x) { return x * 19; }
+inline int f7451_20(int x) { return x * 20; }
+inline int f7451_21(int x) { return x * 21; }
+inline int f7451_22(int x) { return x * 22; }
+inline int f7451_23(int x) { return x * 23; }
+inline int f7451_24(int x) { return x * 24; }
+inline int f7451_25(int x) { return x * 25; }
+inline int f7451_26(int x) { return x * 26; }
+inline int f7451_27(int x) { return x * 27; }
+inline int f7451_28(int x) { return x * 28; }
+inline int f7451_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7454 */
+#include <vector>
+#include "h5185.h"
+#include "h9281.h"
+#include "h9090.h"
+#include "h8742.h"
+#include "h6748.h"
+#ifdef X
+#include "h8751.h"
+#endif
+struct S7454 { int a; const char *s = "x//y"; };
+inline int f7454_0(int x) { return x * 0; }
+inline int f7454_1(int x) { return x * 1; }
+inline int f7454_2(int x) { return x * 2; }
+inline int f7454_3(int x) { return x * 3; }
+inline int f7454_4(int x) { return x * 4; }
+inline int f7454_5(int x) { return x * 5; }
+inline int f7454_6(int x) { return x * 6; }
+inline int f7454_7(int x) { return x * 7; }
+inline int f7454_8(int x) { return x * 8; }
+inline int f7454_9(int x) { return x * 9; }
+inline int f7454_10(int x) { return x * 10; }
+inline int f7454_11(int x) { return x * 11; }
+inline int f7454_12(int x) { return x * 12; }
+inline int f7454_13(int x) { return x * 13; }
+inline int f7454_14(int x) { return x * 14; }
+inline int f7454_15(int x) { return x * 15; }
+inline int f7454_16(int x) { return x * 16; }
+inline int f7454_17(int x) { return x * 17; }
+inline int f7454_18(int x) { return x * 18; }
+inline int f7454_19(int x) { return x * 19; }
+inline int f7454_20(int x) { return x * 20; }
+inline int f7454_21(int x) { return x * 21; }
+inline int f7454_22(int x) { return x * 22; }
+inline int f7454_23(int x) { return x * 23; }
+inline int f7454_24(int x) { return x * 24; }
+inline int f7454_25(int x) { return x * 25; }
+inline int f7454_26(int x) { return x * 26; }
+inline int f7454_27(int x) { return x * 27; }
+inline int f7454_28(int x) { return x * 28; }
+inline int f7454_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7461 */
+#include <vector>
+#include "h2638.h"
+#include "h4909.h"
+#include "h934.h"
+#include "h7082.h"
+#include "h7938.h"
+#ifdef X
+#include "h9498.h"
+#endif
+struct S7461 { int a; const char *s = "x//y"; };
+inline int f7461_0(int x) { return x * 0; }
+inline int f7461_1(int x) { return x * 1; }
+inline int f7461_2(int x) { return x * 2; }
+inline int f7461_3(int x) { return x * 3; }
+inline int f7461_4(int x) { return x * 4; }
+inline int f7461_5(int x) { return x * 5; }
+inline int f7461_6(int x) { return x * 6; }
+inline int f7461_7(int x) { return x * 7; }
+inline int f7461_8(int x) { return x * 8; }
+inline int f7461_9(int x) { return x * 9; }
+inline int f7461_10(int x) { return x * 10; }
+inline int f7461_11(int x) { return x * 11; }
+inline int f7461_12(int x) { return x * 12; }
+inline int f7461_13(int x) { return x * 13; }
+inline int f7461_14(int x) { return x * 14; }
+inline int f7461_15(int x) { return x * 15; }
+inline int f7461_16(int x) { return x * 16; }
+inline int f7461_17(int x) { return x * 17; }
+inline int f7461_18(int x) { return x * 18; }
+inline int f7461_19(int x) { return x * 19; }
+inline int f7461_20(int x) { return x * 20; }
+inline int f7461_21(int x) { return x * 21; }
+inline int f7461_22(int x) { return x * 22; }
+inline int f7461_23(int x) { return x * 23; }
+inline int f7461_24(int x) { return x * 24; }
+inline int f7461_25(int x) { return x * 25; }
+inline int f7461_26(int x) { return x * 26; }
+inline int f7461_27(int x) { return x * 27; }
+inline int f7461_28(int x) { return x * 28; }
+inline int f7461_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7462 */
+#include <vector>
+#include "h9340.h"
+#include "h2743.h"
+#include "h6013.h"
+#include "h6975.h"
+#include "h8029.h"
+#ifdef X
+#include "h6439.h"
+#endif
+struct S7462 { int a; const char *s = "x//y"; };
+inline int f7462_0(int x) { return x * 0; }
+inline int f7462_1(int x) { return x * 1; }
+inline int f7462_2(int x) { return x * 2; }
+inline int f7462_3(int x) { return x * 3; }
+inline int f7462_4(int x) { return x * 4; }
+inline int f7462_5(int x) { return x * 5; }
+inline int f7462_6(int x) { return x * 6; }
+inline int f7462_7(int x) { return x * 7; }
+inline int f7462_8(int x) { return x * 8; }
+inline int f7462_9(int x) { return x * 9; }
+inline int f7462_10(int x) { return x * 10; }
+inline int f7462_11(int x) { return x * 11; }
+inline int f7462_12(int x) { return x * 12; }
+inline int f7462_13(int x) { return x * 13; }
+inline int f7462_14(int x) { return x * 14; }
+inline int f7462_15(int x) { return x * 15; }
+inline int f7462_16(int x) { return x * 16; }
+inline int f7462_17(int x) { return x * 17; }
+inline int f7462_18(int x) { return x * 18; }
+inline int f7462_19(int x) { return x * 19; }
+inline int f7462_20(int x) { return x * 20; }
+inline int f7462_21(int x) { return x * 21; }
+inline int f7462_22(int x) { return x * 22; }
+inline int f7462_23(int x) { return x * 23; }
+inline int f7462_24(int x) { return x * 24; }
+inline int f7462_25(int x) { return x * 25; }
+inline int f7462_26(int x) { return x * 26; }
+inline int f7462_27(int x) { return x * 27; }
+inline int f7462_28(int x) { return x * 28; }
+inline int f7462_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7468 */
+#include <vector>
+#include "h7199.h"
+#include "h9409.h"
+#include "h2018.h"
+#include "h9531.h"
+#include "h4104.h"
+#ifdef X
+#include "h6282.h"
+#endif
+struct S7468 { int a; const char *s = "x//y"; };
+inline int f7468_0(int x) { return x * 0; }
+inline int f7468_1(int x) { return x * 1; }
+inline int f7468_2(int x) { return x * 2; }
+inline int f7468_3(int x) { return x * 3; }
+inline int f7468_4(int x) { return x * 4; }
+inline int f7468_5(int x) { return x * 5; }
+inline int f7468_6(int x) { return x * 6; }
+inline int f7468_7(int x) { return x * 7; }
+inline int f7468_8(int x) { return x * 8; }
+inline int f7468_9(int x) { return x * 9; }
+inline int f7468_10(int x) { return x * 10; }
+inline int f7468_11(int x) { return x * 11; }
+inline int f7468_12(int x) { return x * 12; }
+inline int f7468_13(int x) { return x * 13; }
+inline int f7468_14(int x) { return x * 14; }
+inline int f7468_15(int x) { return x * 15; }
+inline int f7468_16(int x) { return x * 16; }
+inline int f7468_17(int x) { return x * 17; }
+inline int f7468_18(int x) { return x * 18; }
+inline int f7468_19(int x) { return x * 19; }
+inline int f7468_20(int x) { return x * 20; }
+inline int f7468_21(int x) { return x * 21; }
+inline int f7468_22(int x) { return x * 22; }
+inline int f7468_23(int x) { return x * 23; }
+inline int f7468_24(int x) { return x * 24; }
+inline int f7468_25(int x) { return x * 25; }
+inline int f7468_26(int x) { return x * 26; }
+inline int f7468_27(int x) { return x * 27; }
+inline int f7468_28(int x) { return x * 28; }
+inline int f7468_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7469 */
+#include <vector>
+#include "h2927.h"
+#include "h8962.h"
+#include "h1987.h"
+#include "h7641.h"
+#include "h1196.h"
+#ifdef X
+#include "h5914.h"
+#endif
+struct S7469 { int a; const char *s = "x//y"; };
+inline int f7469_0(int x) { return x * 0; }
+inline int f7469_1(int x) { return x * 1; }
+inline int f7469_2(int x) { return x * 2; }
+inline int f7469_3(int x) { return x * 3; }
+inline int f7469_4(int x) { return x * 4; }
+inline int f7469_5(int x) { return x * 5; }
+inline int f7469_6(int x) { return x * 6; }
+inline int f7469_7(int x) { return x * 7; }
+inline int f7469_8(int x) { return x * 8; }
+inline int f7469_9(int x) { return x * 9; }
+inline int f7469_10(int x) { return x * 10; }
+inline int f7469_11(int x) { return x * 11; }
+inline int f7469_12(int x) { return x * 12; }
+inline int f7469_13(int x) { return x * 13; }
+inline int f7469_14(int x) { return x * 14; }
+inline int f7469_15(int x) { return x * 15; }
+inline int f7469_16(int x) { return x * 16; }
+inline int f7469_17(int x) { return x * 17; }
+inline int f7469_18(int x) { return x * 18; }
+inline int f7469_19(int x) { return x * 19; }
+inline int f7469_20(int x) { return x * 20; }
+inline int f7469_21(int x) { return x * 21; }
+inline int f7469_22(int x) { return x * 22; }
+inline int f7469_23(int x) { return x * 23; }
+inline int f7469_24(int x) { return x * 24; }
+inline int f7469_25(int x) { return x * 25; }
+inline int f7469_26(int x) { return x * 26; }
+inline int f7469_27(int x) { return x * 27; }
+inline int f7469_28(int x) { return x * 28; }
+inline int f7469_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 747 */
+#include <vector>
+#include "h6709.h"
+#include "h2060.h"
+#include "h133.h"
+#include "h2992.h"
+#include "h6381.h"
+#ifdef X
+#include "h6582.h"
+#endif
+struct S747 { int a; const char *s = "x//y"; };
+inline int f747_0(int x) { return x * 0; }
+inline int f747_1(int x) { return x * 1; }
+inline int f747_2(int x) { return x * 2; }
+inline int f747_3(int x) { return x * 3; }
+inline int f747_4(int x) { return x * 4; }
+inline int f747_5(int x) { return x * 5; }
+inline int f747_6(int x) { return x * 6; }
+inline int f747_7(int x) { return x * 7; }
+inline int f747_8(int x) { return x * 8; }
+inline int f747_9(int x) { return x * 9; }
+inline int f747_10(int x) { return x * 10; }
+inline int f747_11(int x) { return x * 11; }
+inline int f747_12(int x) { return x * 12; }
+inline int f747_13(int x) { return x * 13; }
+inline int f747_14(int x) { return x * 14; }
+inline int f747_15(int x) { return x * 15; }
+inline int f747_16(int x) { return x * 16; }
+inline int f747_17(int x) { return x * 17; }
+inline int f747_18(int x) { return x * 18; }
+inline int f747_19(int x) { return x * 19; }
+inline int f747_20(int x) { return x * 20; }
+inline int f747_21(int x) { return x * 21; }
+inline int f747_22(int x) { return x * 22; }
+inline int f747_23(int x) { return x * 23; }
+inline int f747_24(int x) { return x * 24; }
+inline int f747_25(int x) { return x * 25; }
+inline int f747_26(int x) { return x * 26; }
+inline int f747_27(int x) { return x * 27; }
+inline int f747_28(int x) { return x * 28; }
+inline int f747_29(int x) { return x * 29; }
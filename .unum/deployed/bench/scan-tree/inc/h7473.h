@@ -0,0 +1,42 @@
+#pragma once
+/* header 7473 */
+#include <vector>
+#include "h5487.h"
+#include "h8634.h"
+#include "h9768.h"
+#include "h537.h"
+#include "h4697.h"
+#ifdef X
+#include "h6014.h"
+#endif
+struct S7473 { int a; const char *s = "x//y"; };
+inline int f7473_0(int x) { return x * 0; }
+inline int f7473_1(int x) { return x * 1; }
+inline int f7473_2(int x) { return x * 2; }
+inline int f7473_3(int x) { return x * 3; }
+inline int f7473_4(int x) { return x * 4; }
+inline int f7473_5(int x) { return x * 5; }
+inline int f7473_6(int x) { return x * 6; }
+inline int f7473_7(int x) { return x * 7; }
+inline int f7473_8(int x) { return x * 8; }
+inline int f7473_9(int x) { return x * 9; }
+inline int f7473_10(int x) { return x * 10; }
+inline int f7473_11(int x) { return x * 11; }
+inline int f7473_12(int x) { return x * 12; }
+inline int f7473_13(int x) { return x * 13; }
+inline int f7473_14(int x) { return x * 14; }
+inline int f7473_15(int x) { return x * 15; }
+inline int f7473_16(int x) { return x * 16; }
+inline int f7473_17(int x) { return x * 17; }
+inline int f7473_18(int x) { return x * 18; }
+inline int f7473_19(int x) { return x * 19; }
+inline int f7473_20(int x) { return x * 20; }
+inline int f7473_21(int x) { return x * 21; }
+inline int f7473_22(int x) { return x * 22; }
+inline int f7473_23(int x) { return x * 23; }
+inline int f7473_24(int x) { return x * 24; }
+inline int f7473_25(int x) { return x * 25; }
+inline int f7473_26(int x) { return x * 26; }
+inline int f7473_27(int x) { return x * 27; }
+inline int f7473_28(int x) { return x * 28; }
+inline int f7473_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7476 */
+#include <vector>
+#include "h5347.h"
+#include "h9717.h"
+#include "h4246.h"
+#include "h9665.h"
+#include "h8111.h"
+#ifdef X
+#include "h6743.h"
+#endif
+struct S7476 { int a; const char *s = "x//y"; };
+inline int f7476_0(int x) { return x * 0; }
+inline int f7476_1(int x) { return x * 1; }
+inline int f7476_2(int x) { return x * 2; }
+inline int f7476_3(int x) { return x * 3; }
+inline int f7476_4(int x) { return x * 4; }
+inline int f7476_5(int x) { return x * 5; }
+inline int f7476_6(int x) { return x * 6; }
+inline int f7476_7(int x) { return x * 7; }
+inline int f7476_8(int x) { return x * 8; }
+inline int f7476_9(int x) { return x * 9; }
+inline int f7476_10(int x) { return x * 10; }
+inline int f7476_11(int x) { return x * 11; }
+inline int f7476_12(int x) { return x * 12; }
+inline int f7476_13(int x) { return x * 13; }
+inline int f7476_14(int x) { return x * 14; }
+inline int f7476_15(int x) { return x * 15; }
+inline int f7476_16(int x) { return x * 16; }
+inline int f7476_17(int x) { return x * 17; }
+inline int f7476_18(int x) { return x * 18; }
+inline int f7476_19(int x) { return x * 19; }
+inline int f7476_20(int x) { return x * 20; }
+inline int f7476_21(int x) { return x * 21; }
+inline int f7476_22(int x) { return x * 22; }
+inline int f7476_23(int x) { return x * 23; }
+inline int f7476_24(int x) { return x * 24; }
+inline int f7476_25(int x) { return x * 25; }
+inline int f7476_26(int x) { return x * 26; }
+inline int f7476_27(int x) { return x * 27; }
+inline int f7476_28(int x) { return x * 28; }
+inline int f7476_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 748 */
+#include <vector>
+#include "h79.h"
+#include "h7696.h"
+#include "h4588.h"
+#include "h9536.h"
+#include "h2133.h"
+#ifdef X
+#include "h193.h"
+#endif
+struct S748 { int a; const char *s = "x//y"; };
+inline int f748_0(int x) { return x * 0; }
+inline int f748_1(int x) { return x * 1; }
+inline int f748_2(int x) { return x * 2; }
+inline int f748_3(int x) { return x * 3; }
+inline int f748_4(int x) { return x * 4; }
+inline int f748_5(int x) { return x * 5; }
+inline int f748_6(int x) { return x * 6; }
+inline int f748_7(int x) { return x * 7; }
+inline int f748_8(int x) { return x * 8; }
+inline int f748_9(int x) { return x * 9; }
+inline int f748_10(int x) { return x * 10; }
+inline int f748_11(int x) { return x * 11; }
+inline int f748_12(int x) { return x * 12; }
+inline int f748_13(int x) { return x * 13; }
+inline int f748_14(int x) { return x * 14; }
+inline int f748_15(int x) { return x * 15; }
+inline int f748_16(int x) { return x * 16; }
+inline int f748_17(int x) { return x * 17; }
+inline int f748_18(int x) { return x * 18; }
+inline int f748_19(int x) { return x * 19; }
+inline int f748_20(int x) { return x * 20; }
+inline int f748_21(int x) { return x * 21; }
+inline int f748_22(int x) { return x * 22; }
+inline int f748_23(int x) { return x * 23; }
+inline int f748_24(int x) { return x * 24; }
+inline int f748_25(int x) { return x * 25; }
+inline int f748_26(int x) { return x * 26; }
+inline int f748_27(int x) { return x * 27; }
+inline int f748_28(int x) { return x * 28; }
+inline int f748_29(int x) { return x * 29; }
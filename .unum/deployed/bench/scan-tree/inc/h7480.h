@@ -0,0 +1,42 @@
+#pragma once
+/* header 7480 */
+#include <vector>
+#include "h9493.h"
+#include "h3988.h"
+#include "h649.h"
+#include "h7899.h"
+#include "h6142.h"
+#ifdef X
+#include "h5436.h"
+#endif
+struct S7480 { int a; const char *s = "x//y"; };
+inline int f7480_0(int x) { return x * 0; }
+inline int f7480_1(int x) { return x * 1; }
+inline int f7480_2(int x) { return x * 2; }
+inline int f7480_3(int x) { return x * 3; }
+inline int f7480_4(int x) { return x * 4; }
+inline int f7480_5(int x) { return x * 5; }
+inline int f7480_6(int x) { return x * 6; }
+inline int f7480_7(int x) { return x * 7; }
+inline int f7480_8(int x) { return x * 8; }
+inline int f7480_9(int x) { return x * 9; }
+inline int f7480_10(int x) { return x * 10; }
+inline int f7480_11(int x) { return x * 11; }
+inline int f7480_12(int x) { return x * 12; }
+inline int f7480_13(int x) { return x * 13; }
+inline int f7480_14(int x) { return x * 14; }
+inline int f7480_15(int x) { return x * 15; }
+inline int f7480_16(int x) { return x * 16; }
+inline int f7480_17(int x) { return x * 17; }
+inline int f7480_18(int x) { return x * 18; }
+inline int f7480_19(int x) { return x * 19; }
+inline int f7480_20(int x) { return x * 20; }
+inline int f7480_21(int x) { return x * 21; }
+inline int f7480_22(int x) { return x * 22; }
+inline int f7480_23(int x) { return x * 23; }
+inline int f7480_24(int x) { return x * 24; }
+inline int f7480_25(int x) { return x * 25; }
+inline int f7480_26(int x) { return x * 26; }
+inline int f7480_27(int x) { return x * 27; }
+inline int f7480_28(int x) { return x * 28; }
+inline int f7480_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7482 */
+#include <vector>
+#include "h560.h"
+#include "h5968.h"
+#include "h8.h"
+#include "h4860.h"
+#include "h8788.h"
+#ifdef X
+#include "h9604.h"
+#endif
+struct S7482 { int a; const char *s = "x//y"; };
+inline int f7482_0(int x) { return x * 0; }
+inline int f7482_1(int x) { return x * 1; }
+inline int f7482_2(int x) { return x * 2; }
+inline int f7482_3(int x) { return x * 3; }
+inline int f7482_4(int x) { return x * 4; }
+inline int f7482_5(int x) { return x * 5; }
+inline int f7482_6(int x) { return x * 6; }
+inline int f7482_7(int x) { return x * 7; }
+inline int f7482_8(int x) { return x * 8; }
+inline int f7482_9(int x) { return x * 9; }
+inline int f7482_10(int x) { return x * 10; }
+inline int f7482_11(int x) { return x * 11; }
+inline int f7482_12(int x) { return x * 12; }
+inline int f7482_13(int x) { return x * 13; }
+inline int f7482_14(int x) { return x * 14; }
+inline int f7482_15(int x) { return x * 15; }
+inline int f7482_16(int x) { return x * 16; }
+inline int f7482_17(int x) { return x * 17; }
+inline int f7482_18(int x) { return x * 18; }
+inline int f7482_19(int x) { return x * 19; }
+inline int f7482_20(int x) { return x * 20; }
+inline int f7482_21(int x) { return x * 21; }
+inline int f7482_22(int x) { return x * 22; }
+inline int f7482_23(int x) { return x * 23; }
+inline int f7482_24(int x) { return x * 24; }
+inline int f7482_25(int x) { return x * 25; }
+inline int f7482_26(int x) { return x * 26; }
+inline int f7482_27(int x) { return x * 27; }
+inline int f7482_28(int x) { return x * 28; }
+inline int f7482_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7486 */
+#include <vector>
+#include "h9672.h"
+#include "h2199.h"
+#include "h6863.h"
+#include "h1725.h"
+#include "h4679.h"
+#ifdef X
+#include "h7461.h"
+#endif
+struct S7486 { int a; const char *s = "x//y"; };
+inline int f7486_0(int x) { return x * 0; }
+inline int f7486_1(int x) { return x * 1; }
+inline int f7486_2(int x) { return x * 2; }
+inline int f7486_3(int x) { return x * 3; }
+inline int f7486_4(int x) { return x * 4; }
+inline int f7486_5(int x) { return x * 5; }
+inline int f7486_6(int x) { return x * 6; }
+inline int f7486_7(int x) { return x * 7; }
+inline int f7486_8(int x) { return x * 8; }
+inline int f7486_9(int x) { return x * 9; }
+inline int f7486_10(int x) { return x * 10; }
+inline int f7486_11(int x) { return x * 11; }
+inline int f7486_12(int x) { return x * 12; }
+inline int f7486_13(int x) { return x * 13; }
+inline int f7486_14(int x) { return x * 14; }
+inline int f7486_15(int x) { return x * 15; }
+inline int f7486_16(int x) { return x * 16; }
+inline int f7486_17(int x) { return x * 17; }
+inline int f7486_18(int x) { return x * 18; }
+inline int f7486_19(int x) { return x * 19; }
+inline int f7486_20(int x) { return x * 20; }
+inline int f7486_21(int x) { return x * 21; }
+inline int f7486_22(int x) { return x * 22; }
+inline int f7486_23(int x) { return x * 23; }
+inline int f7486_24(int x) { return x * 24; }
+inline int f7486_25(int x) { return x * 25; }
+inline int f7486_26(int x) { return x * 26; }
+inline int f7486_27(int x) { return x * 27; }
+inline int f7486_28(int x) { return x * 28; }
+inline int f7486_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7489 */
+#include <vector>
+#include "h8756.h"
+#include "h9944.h"
+#include "h1919.h"
+#include "h8780.h"
+#include "h3439.h"
+#ifdef X
+#include "h4274.h"
+#endif
+struct S7489 { int a; const char *s = "x//y"; };
+inline int f7489_0(int x) { return x * 0; }
+inline int f7489_1(int x) { return x * 1; }
+inline int f7489_2(int x) { return x * 2; }
+inline int f7489_3(int x) { return x * 3; }
+inline int f7489_4(int x) { return x * 4; }
+inline int f7489_5(int x) { return x * 5; }
+inline int f7489_6(int x) { return x * 6; }
+inline int f7489_7(int x) { return x * 7; }
+inline int f7489_8(int x) { return x * 8; }
+inline int f7489_9(int x) { return x * 9; }
+inline int f7489_10(int x) { return x * 10; }
+inline int f7489_11(int x) { return x * 11; }
+inline int f7489_12(int x) { return x * 12; }
+inline int f7489_13(int x) { return x * 13; }
+inline int f7489_14(int x) { return x * 14; }
+inline int f7489_15(int x) { return x * 15; }
+inline int f7489_16(int x) { return x * 16; }
+inline int f7489_17(int x) { return x * 17; }
+inline int f7489_18(int x) { return x * 18; }
+inline int f7489_19(int x) { return x * 19; }
+inline int f7489_20(int x) { return x * 20; }
+inline int f7489_21(int x) { return x * 21; }
+inline int f7489_22(int x) { return x * 22; }
+inline int f7489_23(int x) { return x * 23; }
+inline int f7489_24(int x) { return x * 24; }
+inline int f7489_25(int x) { return x * 25; }
+inline int f7489_26(int x) { return x * 26; }
+inline int f7489_27(int x) { return x * 27; }
+inline int f7489_28(int x) { return x * 28; }
+inline int f7489_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7490 */
+#include <vector>
+#include "h304.h"
+#include "h2333.h"
+#include "h4098.h"
+#include "h7452.h"
+#include "h3969.h"
+#ifdef X
+#include "h623.h"
+#endif
+struct S7490 { int a; const char *s = "x//y"; };
+inline int f7490_0(int x) { return x * 0; }
+inline int f7490_1(int x) { return x * 1; }
+inline int f7490_2(int x) { return x * 2; }
+inline int f7490_3(int x) { return x * 3; }
+inline int f7490_4(int x) { return x * 4; }
+inline int f7490_5(int x) { return x * 5; }
+inline int f7490_6(int x) { return x * 6; }
+inline int f7490_7(int x) { return x * 7; }
+inline int f7490_8(int x) { return x * 8; }
+inline int f7490_9(int x) { return x * 9; }
+inline int f7490_10(int x) { return x * 10; }
+inline int f7490_11(int x) { return x * 11; }
+inline int f7490_12(int x) { return x * 12; }
+inline int f7490_13(int x) { return x * 13; }
+inline int f7490_14(int x) { return x * 14; }
+inline int f7490_15(int x) { return x * 15; }
+inline int f7490_16(int x) { return x * 16; }
+inline int f7490_17(int x) { return x * 17; }
+inline int f7490_18(int x) { return x * 18; }
+inline int f7490_19(int x) { return x * 19; }
+inline int f7490_20(int x) { return x * 20; }
+inline int f7490_21(int x) { return x * 21; }
+inline int f7490_22(int x) { return x * 22; }
+inline int f7490_23(int x) { return x * 23; }
+inline int f7490_24(int x) { return x * 24; }
+inline int f7490_25(int x) { return x * 25; }
+inline int f7490_26(int x) { return x * 26; }
+inline int f7490_27(int x) { return x * 27; }
+inline int f7490_28(int x) { return x * 28; }
+inline int f7490_29(int x) { return x * 29; }
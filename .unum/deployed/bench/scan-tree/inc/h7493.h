@@ -0,0 +1,42 @@
+#pragma once
+/* header 7493 */
+#include <vector>
+#include "h8912.h"
+#include "h6789.h"
+#include "h150.h"
+#include "h691.h"
+#include "h7407.h"
+#ifdef X
+#include "h9994.h"
+#endif
+struct S7493 { int a; const char *s = "x//y"; };
+inline int f7493_0(int x) { return x * 0; }
+inline int f7493_1(int x) { return x * 1; }
+inline int f7493_2(int x) { return x * 2; }
+inline int f7493_3(int x) { return x * 3; }
+inline int f7493_4(int x) { return x * 4; }
+inline int f7493_5(int x) { return x * 5; }
+inline int f7493_6(int x) { return x * 6; }
+inline int f7493_7(int x) { return x * 7; }
+inline int f7493_8(int x) { return x * 8; }
+inline int f7493_9(int x) { return x * 9; }
+inline int f7493_10(int x) { return x * 10; }
+inline int f7493_11(int x) { return x * 11; }
+inline int f7493_12(int x) { return x * 12; }
+inline int f7493_13(int x) { return x * 13; }
+inline int f7493_14(int x) { return x * 14; }
+inline int f7493_15(int x) { return x * 15; }
+inline int f7493_16(int x) { return x * 16; }
+inline int f7493_17(int x) { return x * 17; }
+inline int f7493_18(int x) { return x * 18; }
+inline int f7493_19(int x) { return x * 19; }
+inline int f7493_20(int x) { return x * 20; }
+inline int f7493_21(int x) { return x * 21; }
+inline int f7493_22(int x) { return x * 22; }
+inline int f7493_23(int x) { return x * 23; }
+inline int f7493_24(int x) { return x * 24; }
+inline int f7493_25(int x) { return x * 25; }
+inline int f7493_26(int x) { return x * 26; }
+inline int f7493_27(int x) { return x * 27; }
+inline int f7493_28(int x) { return x * 28; }
+inline int f7493_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7495 */
+#include <vector>
+#include "h6775.h"
+#include "h2195.h"
+#include "h6371.h"
+#include "h9520.h"
+#include "h442.h"
+#ifdef X
+#include "h5403.h"
+#endif
+struct S7495 { int a; const char *s = "x//y"; };
+inline int f7495_0(int x) { return x * 0; }
+inline int f7495_1(int x) { return x * 1; }
+inline int f7495_2(int x) { return x * 2; }
+inline int f7495_3(int x) { return x * 3; }
+inline int f7495_4(int x) { return x * 4; }
+inline int f7495_5(int x) { return x * 5; }
+inline int f7495_6(int x) { return x * 6; }
+inline int f7495_7(int x) { return x * 7; }
+inline int f7495_8(int x) { return x * 8; }
+inline int f7495_9(int x) { return x * 9; }
+inline int f7495_10(int x) { return x * 10; }
+inline int f7495_11(int x) { return x * 11; }
+inline int f7495_12(int x) { return x * 12; }
+inline int f7495_13(int x) { return x * 13; }
+inline int f7495_14(int x) { return x * 14; }
+inline int f7495_15(int x) { return x * 15; }
+inline int f7495_16(int x) { return x * 16; }
+inline int f7495_17(int x) { return x * 17; }
+inline int f7495_18(int x) { return x * 18; }
+inline int f7495_19(int x) { return x * 19; }
+inline int f7495_20(int x) { return x * 20; }
+inline int f7495_21(int x) { return x * 21; }
+inline int f7495_22(int x) { return x * 22; }
+inline int f7495_23(int x) { return x * 23; }
+inline int f7495_24(int x) { return x * 24; }
+inline int f7495_25(int x) { return x * 25; }
+inline int f7495_26(int x) { return x * 26; }
+inline int f7495_27(int x) { return x * 27; }
+inline int f7495_28(int x) { return x * 28; }
+inline int f7495_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7496 */
+#include <vector>
+#include "h2585.h"
+#include "h8920.h"
+#include "h8769.h"
+#include "h8328.h"
+#include "h803.h"
+#ifdef X
+#include "h3204.h"
+#endif
+struct S7496 { int a; const char *s = "x//y"; };
+inline int f7496_0(int x) { return x * 0; }
+inline int f7496_1(int x) { return x * 1; }
+inline int f7496_2(int x) { return x * 2; }
+inline int f7496_3(int x) { return x * 3; }
+inline int f7496_4(int x) { return x * 4; }
+inline int f7496_5(int x) { return x * 5; }
+inline int f7496_6(int x) { return x * 6; }
+inline int f7496_7(int x) { return x * 7; }
+inline int f7496_8(int x) { return x * 8; }
+inline int f7496_9(int x) { return x * 9; }
+inline int f7496_10(int x) { return x * 10; }
+inline int f7496_11(int x) { return x * 11; }
+inline int f7496_12(int x) { return x * 12; }
+inline int f7496_13(int x) { return x * 13; }
+inline int f7496_14(int x) { return x * 14; }
+inline int f7496_15(int x) { return x * 15; }
+inline int f7496_16(int x) { return x * 16; }
+inline int f7496_17(int x) { return x * 17; }
+inline int f7496_18(int x) { return x * 18; }
+inline int f7496_19(int x) { return x * 19; }
+inline int f7496_20(int x) { return x * 20; }
+inline int f7496_21(int x) { return x * 21; }
+inline int f7496_22(int x) { return x * 22; }
+inline int f7496_23(int x) { return x * 23; }
+inline int f7496_24(int x) { return x * 24; }
+inline int f7496_25(int x) { return x * 25; }
+inline int f7496_26(int x) { return x * 26; }
+inline int f7496_27(int x) { return x * 27; }
+inline int f7496_28(int x) { return x * 28; }
+inline int f7496_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7497 */
+#include <vector>
+#include "h6265.h"
+#include "h2125.h"
+#include "h5240.h"
+#include "h9777.h"
+#include "h5961.h"
+#ifdef X
+#include "h5548.h"
+#endif
+struct S7497 { int a; const char *s = "x//y"; };
+inline int f7497_0(int x) { return x * 0; }
+inline int f7497_1(int x) { return x * 1; }
+inline int f7497_2(int x) { return x * 2; }
+inline int f7497_3(int x) { return x * 3; }
+inline int f7497_4(int x) { return x * 4; }
+inline int f7497_5(int x) { return x * 5; }
+inline int f7497_6(int x) { return x * 6; }
+inline int f7497_7(int x) { return x * 7; }
+inline int f7497_8(int x) { return x * 8; }
+inline int f7497_9(int x) { return x * 9; }
+inline int f7497_10(int x) { return x * 10; }
+inline int f7497_11(int x) { return x * 11; }
+inline int f7497_12(int x) { return x * 12; }
+inline int f7497_13(int x) { return x * 13; }
+inline int f7497_14(int x) { return x * 14; }
+inline int f7497_15(int x) { return x * 15; }
+inline int f7497_16(int x) { return x * 16; }
+inline int f7497_17(int x) { return x * 17; }
+inline int f7497_18(int x) { return x * 18; }
+inline int f7497_19(int x) { return x * 19; }
+inline int f7497_20(int x) { return x * 20; }
+inline int f7497_21(int x) { return x * 21; }
+inline int f7497_22(int x) { return x * 22; }
+inline int f7497_23(int x) { return x * 23; }
+inline int f7497_24(int x) { return x * 24; }
+inline int f7497_25(int x) { return x * 25; }
+inline int f7497_26(int x) { return x * 26; }
+inline int f7497_27(int x) { return x * 27; }
+inline int f7497_28(int x) { return x * 28; }
+inline int f7497_29(int x) { return x * 29; }
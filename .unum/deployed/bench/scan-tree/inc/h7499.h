@@ -0,0 +1,42 @@
+#pragma once
+/* header 7499 */
+#include <vector>
+#include "h2950.h"
+#include "h5736.h"
+#include "h6667.h"
+#include "h8284.h"
+#include "h1248.h"
+#ifdef X
+#include "h7869.h"
+#endif
+struct S7499 { int a; const char *s = "x//y"; };
+inline int f7499_0(int x) { return x * 0; }
+inline int f7499_1(int x) { return x * 1; }
+inline int f7499_2(int x) { return x * 2; }
+inline int f7499_3(int x) { return x * 3; }
+inline int f7499_4(int x) { return x * 4; }
+inline int f7499_5(int x) { return x * 5; }
+inline int f7499_6(int x) { return x * 6; }
+inline int f7499_7(int x) { return x * 7; }
+inline int f7499_8(int x) { return x * 8; }
+inline int f7499_9(int x) { return x * 9; }
+inline int f7499_10(int x) { return x * 10; }
+inline int f7499_11(int x) { return x * 11; }
+inline int f7499_12(int x) { return x * 12; }
+inline int f7499_13(int x) { return x * 13; }
+inline int f7499_14(int x) { return x * 14; }
+inline int f7499_15(int x) { return x * 15; }
+inline int f7499_16(int x) { return x * 16; }
+inline int f7499_17(int x) { return x * 17; }
+inline int f7499_18(int x) { return x * 18; }
+inline int f7499_19(int x) { return x * 19; }
+inline int f7499_20(int x) { return x * 20; }
+inline int f7499_21(int x) { return x * 21; }
+inline int f7499_22(int x) { return x * 22; }
+inline int f7499_23(int x) { return x * 23; }
+inline int f7499_24(int x) { return x * 24; }
+inline int f7499_25(int x) { return x * 25; }
+inline int f7499_26(int x) { return x * 26; }
+inline int f7499_27(int x) { return x * 27; }
+inline int f7499_28(int x) { return x * 28; }
+inline int f7499_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 75 */
+#include <vector>
+#include "h7319.h"
+#include "h3792.h"
+#include "h8473.h"
+#include "h1646.h"
+#include "h5795.h"
+#ifdef X
+#include "h8322.h"
+#endif
+struct S75 { int a; const char *s = "x//y"; };
+inline int f75_0(int x) { return x * 0; }
+inline int f75_1(int x) { return x * 1; }
+inline int f75_2(int x) { return x * 2; }
+inline int f75_3(int x) { return x * 3; }
+inline int f75_4(int x) { return x * 4; }
+inline int f75_5(int x) { return x * 5; }
+inline int f75_6(int x) { return x * 6; }
+inline int f75_7(int x) { return x * 7; }
+inline int f75_8(int x) { return x * 8; }
+inline int f75_9(int x) { return x * 9; }
+inline int f75_10(int x) { return x * 10; }
+inline int f75_11(int x) { return x * 11; }
+inline int f75_12(int x) { return x * 12; }
+inline int f75_13(int x) { return x * 13; }
+inline int f75_14(int x) { return x * 14; }
+inline int f75_15(int x) { return x * 15; }
+inline int f75_16(int x) { return x * 16; }
+inline int f75_17(int x) { return x * 17; }
+inline int f75_18(int x) { return x * 18; }
+inline int f75_19(int x) { return x * 19; }
+inline int f75_20(int x) { return x * 20; }
+inline int f75_21(int x) { return x * 21; }
+inline int f75_22(int x) { return x * 22; }
+inline int f75_23(int x) { return x * 23; }
+inline int f75_24(int x) { return x * 24; }
+inline int f75_25(int x) { return x * 25; }
+inline int f75_26(int x) { return x * 26; }
+inline int f75_27(int x) { return x * 27; }
+inline int f75_28(int x) { return x * 28; }
+inline int f75_29(int x) { return x * 29; }
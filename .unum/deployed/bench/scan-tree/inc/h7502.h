@@ -0,0 +1,42 @@
+#pragma once
+/* header 7502 */
+#include <vector>
+#include "h769.h"
+#include "h4557.h"
+#include "h962.h"
+#include "h702.h"
+#include "h8752.h"
+#ifdef X
+#include "h8388.h"
+#endif
+struct S7502 { int a; const char *s = "x//y"; };
+inline int f7502_0(int x) { return x * 0; }
+inline int f7502_1(int x) { return x * 1; }
+inline int f7502_2(int x) { return x * 2; }
+inline int f7502_3(int x) { return x * 3; }
+inline int f7502_4(int x) { return x * 4; }
+inline int f7502_5(int x) { return x * 5; }
+inline int f7502_6(int x) { return x * 6; }
+inline int f7502_7(int x) { return x * 7; }
+inline int f7502_8(int x) { return x * 8; }
+inline int f7502_9(int x) { return x * 9; }
+inline int f7502_10(int x) { return x * 10; }
+inline int f7502_11(int x) { return x * 11; }
+inline int f7502_12(int x) { return x * 12; }
+inline int f7502_13(int x) { return x * 13; }
+inline int f7502_14(int x) { return x * 14; }
+inline int f7502_15(int x) { return x * 15; }
+inline int f7502_16(int x) { return x * 16; }
+inline int f7502_17(int x) { return x * 17; }
+inline int f7502_18(int x) { return x * 18; }
+inline int f7502_19(int x) { return x * 19; }
+inline int f7502_20(int x) { return x * 20; }
+inline int f7502_21(int x) { return x * 21; }
+inline int f7502_22(int x) { return x * 22; }
+inline int f7502_23(int x) { return x * 23; }
+inline int f7502_24(int x) { return x * 24; }
+inline int f7502_25(int x) { return x * 25; }
+inline int f7502_26(int x) { return x * 26; }
+inline int f7502_27(int x) { return x * 27; }
+inline int f7502_28(int x) { return x * 28; }
+inline int f7502_29(int x) { return x * 29; }
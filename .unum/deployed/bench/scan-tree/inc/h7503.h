@@ -0,0 +1,42 @@
+#pragma once
+/* header 7503 */
+#include <vector>
+#include "h2164.h"
+#include "h7256.h"
+#include "h6369.h"
+#include "h5089.h"
+#include "h3613.h"
+#ifdef X
+#include "h5590.h"
+#endif
+struct S7503 { int a; const char *s = "x//y"; };
+inline int f7503_0(int x) { return x * 0; }
+inline int f7503_1(int x) { return x * 1; }
+inline int f7503_2(int x) { return x * 2; }
+inline int f7503_3(int x) { return x * 3; }
+inline int f7503_4(int x) { return x * 4; }
+inline int f7503_5(int x) { return x * 5; }
+inline int f7503_6(int x) { return x * 6; }
+inline int f7503_7(int x) { return x * 7; }
+inline int f7503_8(int x) { return x * 8; }
+inline int f7503_9(int x) { return x * 9; }
+inline int f7503_10(int x) { return x * 10; }
+inline int f7503_11(int x) { return x * 11; }
+inline int f7503_12(int x) { return x * 12; }
+inline int f7503_13(int x) { return x * 13; }
+inline int f7503_14(int x) { return x * 14; }
+inline int f7503_15(int x) { return x * 15; }
+inline int f7503_16(int x) { return x * 16; }
+inline int f7503_17(int x) { return x * 17; }
+inline int f7503_18(int x) { return x * 18; }
+inline int f7503_19(int x) { return x * 19; }
+inline int f7503_20(int x) { return x * 20; }
+inline int f7503_21(int x) { return x * 21; }
+inline int f7503_22(int x) { return x * 22; }
+inline int f7503_23(int x) { return x * 23; }
+inline int f7503_24(int x) { return x * 24; }
+inline int f7503_25(int x) { return x * 25; }
+inline int f7503_26(int x) { return x * 26; }
+inline int f7503_27(int x) { return x * 27; }
+inline int f7503_28(int x) { return x * 28; }
+inline int f7503_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7504 */
+#include <vector>
+#include "h8113.h"
+#include "h3841.h"
+#include "h6406.h"
+#include "h250.h"
+#include "h8971.h"
+#ifdef X
+#include "h1872.h"
+#endif
+struct S7504 { int a; const char *s = "x//y"; };
+inline int f7504_0(int x) { return x * 0; }
+inline int f7504_1(int x) { return x * 1; }
+inline int f7504_2(int x) { return x * 2; }
+inline int f7504_3(int x) { return x * 3; }
+inline int f7504_4(int x) { return x * 4; }
+inline int f7504_5(int x) { return x * 5; }
+inline int f7504_6(int x) { return x * 6; }
+inline int f7504_7(int x) { return x * 7; }
+inline int f7504_8(int x) { return x * 8; }
+inline int f7504_9(int x) { return x * 9; }
+inline int f7504_10(int x) { return x * 10; }
+inline int f7504_11(int x) { return x * 11; }
+inline int f7504_12(int x) { return x * 12; }
+inline int f7504_13(int x) { return x * 13; }
+inline int f7504_14(int x) { return x * 14; }
+inline int f7504_15(int x) { return x * 15; }
+inline int f7504_16(int x) { return x * 16; }
+inline int f7504_17(int x) { return x * 17; }
+inline int f7504_18(int x) { return x * 18; }
+inline int f7504_19(int x) { return x * 19; }
+inline int f7504_20(int x) { return x * 20; }
+inline int f7504_21(int x) { return x * 21; }
+inline int f7504_22(int x) { return x * 22; }
+inline int f7504_23(int x) { return x * 23; }
+inline int f7504_24(int x) { return x * 24; }
+inline int f7504_25(int x) { return x * 25; }
+inline int f7504_26(int x) { return x * 26; }
+inline int f7504_27(int x) { return x * 27; }
+inline int f7504_28(int x) { return x * 28; }
+inline int f7504_29(int x) { return x * 29; }
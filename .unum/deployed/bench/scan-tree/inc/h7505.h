@@ -0,0 +1,42 @@
+#pragma once
+/* header 7505 */
+#include <vector>
+#include "h7336.h"
+#include "h897.h"
+#include "h2285.h"
+#include "h7838.h"
+#include "h3472.h"
+#ifdef X
+#include "h5867.h"
+#endif
+struct S7505 { int a; const char *s = "x//y"; };
+inline int f7505_0(int x) { return x * 0; }
+inline int f7505_1(int x) { return x * 1; }
+inline int f7505_2(int x) { return x * 2; }
+inline int f7505_3(int x) { return x * 3; }
+inline int f7505_4(int x) { return x * 4; }
+inline int f7505_5(int x) { return x * 5; }
+inline int f7505_6(int x) { return x * 6; }
+inline int f7505_7(int x) { return x * 7; }
+inline int f7505_8(int x) { return x * 8; }
+inline int f7505_9(int x) { return x * 9; }
+inline int f7505_10(int x) { return x * 10; }
+inline int f7505_11(int x) { return x * 11; }
+inline int f7505_12(int x) { return x * 12; }
+inline int f7505_13(int x) { return x * 13; }
+inline int f7505_14(int x) { return x * 14; }
+inline int f7505_15(int x) { return x * 15; }
+inline int f7505_16(int x) { return x * 16; }
+inline int f7505_17(int x) { return x * 17; }
+inline int f7505_18(int x) { return x * 18; }
+inline int f7505_19(int x) { return x * 19; }
+inline int f7505_20(int x) { return x * 20; }
+inline int f7505_21(int x) { return x * 21; }
+inline int f7505_22(int x) { return x * 22; }
+inline int f7505_23(int x) { return x * 23; }
+inline int f7505_24(int x) { return x * 24; }
+inline int f7505_25(int x) { return x * 25; }
+inline int f7505_26(int x) { return x * 26; }
+inline int f7505_27(int x) { return x * 27; }
+inline int f7505_28(int x) { return x * 28; }
+inline int f7505_29(int x) { return x * 29; }
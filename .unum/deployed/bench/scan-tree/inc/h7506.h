@@ -0,0 +1,42 @@
+#pragma once
+/* header 7506 */
+#include <vector>
+#include "h3212.h"
+#include "h2253.h"
+#include "h6476.h"
+#include "h4976.h"
+#include "h1107.h"
+#ifdef X
+#include "h4153.h"
+#endif
+struct S7506 { int a; const char *s = "x//y"; };
+inline int f7506_0(int x) { return x * 0; }
+inline int f7506_1(int x) { return x * 1; }
+inline int f7506_2(int x) { return x * 2; }
+inline int f7506_3(int x) { return x * 3; }
+inline int f7506_4(int x) { return x * 4; }
+inline int f7506_5(int x) { return x * 5; }
+inline int f7506_6(int x) { return x * 6; }
+inline int f7506_7(int x) { return x * 7; }
+inline int f7506_8(int x) { return x * 8; }
+inline int f7506_9(int x) { return x * 9; }
+inline int f7506_10(int x) { return x * 10; }
+inline int f7506_11(int x) { return x * 11; }
+inline int f7506_12(int x) { return x * 12; }
+inline int f7506_13(int x) { return x * 13; }
+inline int f7506_14(int x) { return x * 14; }
+inline int f7506_15(int x) { return x * 15; }
+inline int f7506_16(int x) { return x * 16; }
+inline int f7506_17(int x) { return x * 17; }
+inline int f7506_18(int x) { return x * 18; }
+inline int f7506_19(int x) { return x * 19; }
+inline int f7506_20(int x) { return x * 20; }
+inline int f7506_21(int x) { return x * 21; }
+inline int f7506_22(int x) { return x * 22; }
+inline int f7506_23(int x) { return x * 23; }
+inline int f7506_24(int x) { return x * 24; }
+inline int f7506_25(int x) { return x * 25; }
+inline int f7506_26(int x) { return x * 26; }
+inline int f7506_27(int x) { return x * 27; }
+inline int f7506_28(int x) { return x * 28; }
+inline int f7506_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7507 */
+#include <vector>
+#include "h8691.h"
+#include "h8454.h"
+#include "h3896.h"
+#include "h4792.h"
+#include "h5902.h"
+#ifdef X
+#include "h4463.h"
+#endif
+struct S7507 { int a; const char *s = "x//y"; };
+inline int f7507_0(int x) { return x * 0; }
+inline int f7507_1(int x) { return x * 1; }
+inline int f7507_2(int x) { return x * 2; }
+inline int f7507_3(int x) { return x * 3; }
+inline int f7507_4(int x) { return x * 4; }
+inline int f7507_5(int x) { return x * 5; }
+inline int f7507_6(int x) { return x * 6; }
+inline int f7507_7(int x) { return x * 7; }
+inline int f7507_8(int x) { return x * 8; }
+inline int f7507_9(int x) { return x * 9; }
+inline int f7507_10(int x) { return x * 10; }
+inline int f7507_11(int x) { return x * 11; }
+inline int f7507_12(int x) { return x * 12; }
+inline int f7507_13(int x) { return x * 13; }
+inline int f7507_14(int x) { return x * 14; }
+inline int f7507_15(int x) { return x * 15; }
+inline int f7507_16(int x) { return x * 16; }
+inline int f7507_17(int x) { return x * 17; }
+inline int f7507_18(int x) { return x * 18; }
+inline int f7507_19(int x) { return x * 19; }
+inline int f7507_20(int x) { return x * 20; }
+inline int f7507_21(int x) { return x * 21; }
+inline int f7507_22(int x) { return x * 22; }
+inline int f7507_23(int x) { return x * 23; }
+inline int f7507_24(int x) { return x * 24; }
+inline int f7507_25(int x) { return x * 25; }
+inline int f7507_26(int x) { return x * 26; }
+inline int f7507_27(int x) { return x * 27; }
+inline int f7507_28(int x) { return x * 28; }
+inline int f7507_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7509 */
+#include <vector>
+#include "h4336.h"
+#include "h6017.h"
+#include "h7035.h"
+#include "h381.h"
+#include "h1362.h"
+#ifdef X
+#include "h2104.h"
+#endif
+struct S7509 { int a; const char *s = "x//y"; };
+inline int f7509_0(int x) { return x * 0; }
+inline int f7509_1(int x) { return x * 1; }
+inline int f7509_2(int x) { return x * 2; }
+inline int f7509_3(int x) { return x * 3; }
+inline int f7509_4(int x) { return x * 4; }
+inline int f7509_5(int x) { return x * 5; }
+inline int f7509_6(int x) { return x * 6; }
+inline int f7509_7(int x) { return x * 7; }
+inline int f7509_8(int x) { return x * 8; }
+inline int f7509_9(int x) { return x * 9; }
+inline int f7509_10(int x) { return x * 10; }
+inline int f7509_11(int x) { return x * 11; }
+inline int f7509_12(int x) { return x * 12; }
+inline int f7509_13(int x) { return x * 13; }
+inline int f7509_14(int x) { return x * 14; }
+inline int f7509_15(int x) { return x * 15; }
+inline int f7509_16(int x) { return x * 16; }
+inline int f7509_17(int x) { return x * 17; }
+inline int f7509_18(int x) { return x * 18; }
+inline int f7509_19(int x) { return x * 19; }
+inline int f7509_20(int x) { return x * 20; }
+inline int f7509_21(int x) { return x * 21; }
+inline int f7509_22(int x) { return x * 22; }
+inline int f7509_23(int x) { return x * 23; }
+inline int f7509_24(int x) { return x * 24; }
+inline int f7509_25(int x) { return x * 25; }
+inline int f7509_26(int x) { return x * 26; }
+inline int f7509_27(int x) { return x * 27; }
+inline int f7509_28(int x) { return x * 28; }
+inline int f7509_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7516 */
+#include <vector>
+#include "h4528.h"
+#include "h1783.h"
+#include "h5239.h"
+#include "h5218.h"
+#include "h2645.h"
+#ifdef X
+#include "h9077.h"
+#endif
+struct S7516 { int a; const char *s = "x//y"; };
+inline int f7516_0(int x) { return x * 0; }
+inline int f7516_1(int x) { return x * 1; }
+inline int f7516_2(int x) { return x * 2; }
+inline int f7516_3(int x) { return x * 3; }
+inline int f7516_4(int x) { return x * 4; }
+inline int f7516_5(int x) { return x * 5; }
+inline int f7516_6(int x) { return x * 6; }
+inline int f7516_7(int x) { return x * 7; }
+inline int f7516_8(int x) { return x * 8; }
+inline int f7516_9(int x) { return x * 9; }
+inline int f7516_10(int x) { return x * 10; }
+inline int f7516_11(int x) { return x * 11; }
+inline int f7516_12(int x) { return x * 12; }
+inline int f7516_13(int x) { return x * 13; }
+inline int f7516_14(int x) { return x * 14; }
+inline int f7516_15(int x) { return x * 15; }
+inline int f7516_16(int x) { return x * 16; }
+inline int f7516_17(int x) { return x * 17; }
+inline int f7516_18(int x) { return x * 18; }
+inline int f7516_19(int x) { return x * 19; }
+inline int f7516_20(int x) { return x * 20; }
+inline int f7516_21(int x) { return x * 21; }
+inline int f7516_22(int x) { return x * 22; }
+inline int f7516_23(int x) { return x * 23; }
+inline int f7516_24(int x) { return x * 24; }
+inline int f7516_25(int x) { return x * 25; }
+inline int f7516_26(int x) { return x * 26; }
+inline int f7516_27(int x) { return x * 27; }
+inline int f7516_28(int x) { return x * 28; }
+inline int f7516_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7518 */
+#include <vector>
+#include "h4949.h"
+#include "h5714.h"
+#include "h3483.h"
+#include "h8775.h"
+#include "h9861.h"
+#ifdef X
+#include "h822.h"
+#endif
+struct S7518 { int a; const char *s = "x//y"; };
+inline int f7518_0(int x) { return x * 0; }
+inline int f7518_1(int x) { return x * 1; }
+inline int f7518_2(int x) { return x * 2; }
+inline int f7518_3(int x) { return x * 3; }
+inline int f7518_4(int x) { return x * 4; }
+inline int f7518_5(int x) { return x * 5; }
+inline int f7518_6(int x) { return x * 6; }
+inline int f7518_7(int x) { return x * 7; }
+inline int f7518_8(int x) { return x * 8; }
+inline int f7518_9(int x) { return x * 9; }
+inline int f7518_10(int x) { return x * 10; }
+inline int f7518_11(int x) { return x * 11; }
+inline int f7518_12(int x) { return x * 12; }
+inline int f7518_13(int x) { return x * 13; }
+inline int f7518_14(int x) { return x * 14; }
+inline int f7518_15(int x) { return x * 15; }
+inline int f7518_16(int x) { return x * 16; }
+inline int f7518_17(int x) { return x * 17; }
+inline int f7518_18(int x) { return x * 18; }
+inline int f7518_19(int x) { return x * 19; }
+inline int f7518_20(int x) { return x * 20; }
+inline int f7518_21(int x) { return x * 21; }
+inline int f7518_22(int x) { return x * 22; }
+inline int f7518_23(int x) { return x * 23; }
+inline int f7518_24(int x) { return x * 24; }
+inline int f7518_25(int x) { return x * 25; }
+inline int f7518_26(int x) { return x * 26; }
+inline int f7518_27(int x) { return x * 27; }
+inline int f7518_28(int x) { return x * 28; }
+inline int f7518_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 752 */
+#include <vector>
+#include "h7730.h"
+#include "h8192.h"
+#include "h40.h"
+#include "h4991.h"
+#include "h9637.h"
+#ifdef X
+#include "h4907.h"
+#endif
+struct S752 { int a; const char *s = "x//y"; };
+inline int f752_0(int x) { return x * 0; }
+inline int f752_1(int x) { return x * 1; }
+inline int f752_2(int x) { return x * 2; }
+inline int f752_3(int x) { return x * 3; }
+inline int f752_4(int x) { return x * 4; }
+inline int f752_5(int x) { return x * 5; }
+inline int f752_6(int x) { return x * 6; }
+inline int f752_7(int x) { return x * 7; }
+inline int f752_8(int x) { return x * 8; }
+inline int f752_9(int x) { return x * 9; }
+inline int f752_10(int x) { return x * 10; }
+inline int f752_11(int x) { return x * 11; }
+inline int f752_12(int x) { return x * 12; }
+inline int f752_13(int x) { return x * 13; }
+inline int f752_14(int x) { return x * 14; }
+inline int f752_15(int x) { return x * 15; }
+inline int f752_16(int x) { return x * 16; }
+inline int f752_17(int x) { return x * 17; }
+inline int f752_18(int x) { return x * 18; }
+inline int f752_19(int x) { return x * 19; }
+inline int f752_20(int x) { return x * 20; }
+inline int f752_21(int x) { return x * 21; }
+inline int f752_22(int x) { return x * 22; }
+inline int f752_23(int x) { return x * 23; }
+inline int f752_24(int x) { return x * 24; }
+inline int f752_25(int x) { return x * 25; }
+inline int f752_26(int x) { return x * 26; }
+inline int f752_27(int x) { return x * 27; }
+inline int f752_28(int x) { return x * 28; }
+inline int f752_29(int x) { return x * 29; }
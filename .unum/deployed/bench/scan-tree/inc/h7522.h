@@ -0,0 +1,42 @@
+#pragma once
+/* header 7522 */
+#include <vector>
+#include "h9050.h"
+#include "h5584.h"
+#include "h9110.h"
+#include "h8939.h"
+#include "h7537.h"
+#ifdef X
+#include "h7723.h"
+#endif
+struct S7522 { int a; const char *s = "x//y"; };
+inline int f7522_0(int x) { return x * 0; }
+inline int f7522_1(int x) { return x * 1; }
+inline int f7522_2(int x) { return x * 2; }
+inline int f7522_3(int x) { return x * 3; }
+inline int f7522_4(int x) { return x * 4; }
+inline int f7522_5(int x) { return x * 5; }
+inline int f7522_6(int x) { return x * 6; }
+inline int f7522_7(int x) { return x * 7; }
+inline int f7522_8(int x) { return x * 8; }
+inline int f7522_9(int x) { return x * 9; }
+inline int f7522_10(int x) { return x * 10; }
+inline int f7522_11(int x) { return x * 11; }
+inline int f7522_12(int x) { return x * 12; }
+inline int f7522_13(int x) { return x * 13; }
+inline int f7522_14(int x) { return x * 14; }
+inline int f7522_15(int x) { return x * 15; }
+inline int f7522_16(int x) { return x * 16; }
+inline int f7522_17(int x) { return x * 17; }
+inline int f7522_18(int x) { return x * 18; }
+inline int f7522_19(int x) { return x * 19; }
+inline int f7522_20(int x) { return x * 20; }
+inline int f7522_21(int x) { return x * 21; }
+inline int f7522_22(int x) { return x * 22; }
+inline int f7522_23(int x) { return x * 23; }
+inline int f7522_24(int x) { return x * 24; }
+inline int f7522_25(int x) { return x * 25; }
+inline int f7522_26(int x) { return x * 26; }
+inline int f7522_27(int x) { return x * 27; }
+inline int f7522_28(int x) { return x * 28; }
+inline int f7522_29(int x) { return x * 29; }
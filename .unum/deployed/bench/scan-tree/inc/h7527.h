@@ -0,0 +1,42 @@
+#pragma once
+/* header 7527 */
+#include <vector>
+#include "h1733.h"
+#include "h8534.h"
+#include "h7402.h"
+#include "h5467.h"
+#include "h2489.h"
+#ifdef X
+#include "h111.h"
+#endif
+struct S7527 { int a; const char *s = "x//y"; };
+inline int f7527_0(int x) { return x * 0; }
+inline int f7527_1(int x) { return x * 1; }
+inline int f7527_2(int x) { return x * 2; }
+inline int f7527_3(int x) { return x * 3; }
+inline int f7527_4(int x) { return x * 4; }
+inline int f7527_5(int x) { return x * 5; }
+inline int f7527_6(int x) { return x * 6; }
+inline int f7527_7(int x) { return x * 7; }
+inline int f7527_8(int x) { return x * 8; }
+inline int f7527_9(int x) { return x * 9; }
+inline int f7527_10(int x) { return x * 10; }
+inline int f7527_11(int x) { return x * 11; }
+inline int f7527_12(int x) { return x * 12; }
+inline int f7527_13(int x) { return x * 13; }
+inline int f7527_14(int x) { return x * 14; }
+inline int f7527_15(int x) { return x * 15; }
+inline int f7527_16(int x) { return x * 16; }
+inline int f7527_17(int x) { return x * 17; }
+inline int f7527_18(int x) { return x * 18; }
+inline int f7527_19(int x) { return x * 19; }
+inline int f7527_20(int x) { return x * 20; }
+inline int f7527_21(int x) { return x * 21; }
+inline int f7527_22(int x) { return x * 22; }
+inline int f7527_23(int x) { return x * 23; }
+inline int f7527_24(int x) { return x * 24; }
+inline int f7527_25(int x) { return x * 25; }
+inline int f7527_26(int x) { return x * 26; }
+inline int f7527_27(int x) { return x * 27; }
+inline int f7527_28(int x) { return x * 28; }
+inline int f7527_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7533 */
+#include <vector>
+#include "h8137.h"
+#include "h897.h"
+#include "h5714.h"
+#include "h5787.h"
+#include "h8265.h"
+#ifdef X
+#include "h6374.h"
+#endif
+struct S7533 { int a; const char *s = "x//y"; };
+inline int f7533_0(int x) { return x * 0; }
+inline int f7533_1(int x) { return x * 1; }
+inline int f7533_2(int x) { return x * 2; }
+inline int f7533_3(int x) { return x * 3; }
+inline int f7533_4(int x) { return x * 4; }
+inline int f7533_5(int x) { return x * 5; }
+inline int f7533_6(int x) { return x * 6; }
+inline int f7533_7(int x) { return x * 7; }
+inline int f7533_8(int x) { return x * 8; }
+inline int f7533_9(int x) { return x * 9; }
+inline int f7533_10(int x) { return x * 10; }
+inline int f7533_11(int x) { return x * 11; }
+inline int f7533_12(int x) { return x * 12; }
+inline int f7533_13(int x) { return x * 13; }
+inline int f7533_14(int x) { return x * 14; }
+inline int f7533_15(int x) { return x * 15; }
+inline int f7533_16(int x) { return x * 16; }
+inline int f7533_17(int x) { return x * 17; }
+inline int f7533_18(int x) { return x * 18; }
+inline int f7533_19(int x) { return x * 19; }
+inline int f7533_20(int x) { return x * 20; }
+inline int f7533_21(int x) { return x * 21; }
+inline int f7533_22(int x) { return x * 22; }
+inline int f7533_23(int x) { return x * 23; }
+inline int f7533_24(int x) { return x * 24; }
+inline int f7533_25(int x) { return x * 25; }
+inline int f7533_26(int x) { return x * 26; }
+inline int f7533_27(int x) { return x * 27; }
+inline int f7533_28(int x) { return x * 28; }
+inline int f7533_29(int x) { return x * 29; }
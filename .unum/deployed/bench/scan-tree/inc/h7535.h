@@ -0,0 +1,42 @@
+#pragma once
+/* header 7535 */
+#include <vector>
+#include "h7256.h"
+#include "h7879.h"
+#include "h2002.h"
+#include "h9348.h"
+#include "h8672.h"
+#ifdef X
+#include "h3521.h"
+#endif
+struct S7535 { int a; const char *s = "x//y"; };
+inline int f7535_0(int x) { return x * 0; }
+inline int f7535_1(int x) { return x * 1; }
+inline int f7535_2(int x) { return x * 2; }
+inline int f7535_3(int x) { return x * 3; }
+inline int f7535_4(int x) { return x * 4; }
+inline int f7535_5(int x) { return x * 5; }
+inline int f7535_6(int x) { return x * 6; }
+inline int f7535_7(int x) { return x * 7; }
+inline int f7535_8(int x) { return x * 8; }
+inline int f7535_9(int x) { return x * 9; }
+inline int f7535_10(int x) { return x * 10; }
+inline int f7535_11(int x) { return x * 11; }
+inline int f7535_12(int x) { return x * 12; }
+inline int f7535_13(int x) { return x * 13; }
+inline int f7535_14(int x) { return x * 14; }
+inline int f7535_15(int x) { return x * 15; }
+inline int f7535_16(int x) { return x * 16; }
+inline int f7535_17(int x) { return x * 17; }
+inline int f7535_18(int x) { return x * 18; }
+inline int f7535_19(int x) { return x * 19; }
+inline int f7535_20(int x) { return x * 20; }
+inline int f7535_21(int x) { return x * 21; }
+inline int f7535_22(int x) { return x * 22; }
+inline int f7535_23(int x) { return x * 23; }
+inline int f7535_24(int x) { return x * 24; }
+inline int f7535_25(int x) { return x * 25; }
+inline int f7535_26(int x) { return x * 26; }
+inline int f7535_27(int x) { return x * 27; }
+inline int f7535_28(int x) { return x * 28; }
+inline int f7535_29(int x) { return x * 29; }
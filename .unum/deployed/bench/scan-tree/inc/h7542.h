@@ -0,0 +1,42 @@
+#pragma once
+/* header 7542 */
+#include <vector>
+#include "h808.h"
+#include "h6807.h"
+#include "h2733.h"
+#include "h5671.h"
+#include "h5724.h"
+#ifdef X
+#include "h8185.h"
+#endif
+struct S7542 { int a; const char *s = "x//y"; };
+inline int f7542_0(int x) { return x * 0; }
+inline int f7542_1(int x) { return x * 1; }
+inline int f7542_2(int x) { return x * 2; }
+inline int f7542_3(int x) { return x * 3; }
+inline int f7542_4(int x) { return x * 4; }
+inline int f7542_5(int x) { return x * 5; }
+inline int f7542_6(int x) { return x * 6; }
+inline int f7542_7(int x) { return x * 7; }
+inline int f7542_8(int x) { return x * 8; }
+inline int f7542_9(int x) { return x * 9; }
+inline int f7542_10(int x) { return x * 10; }
+inline int f7542_11(int x) { return x * 11; }
+inline int f7542_12(int x) { return x * 12; }
+inline int f7542_13(int x) { return x * 13; }
+inline int f7542_14(int x) { return x * 14; }
+inline int f7542_15(int x) { return x * 15; }
+inline int f7542_16(int x) { return x * 16; }
+inline int f7542_17(int x) { return x * 17; }
+inline int f7542_18(int x) { return x * 18; }
+inline int f7542_19(int x) { return x * 19; }
+inline int f7542_20(int x) { return x * 20; }
+inline int f7542_21(int x) { return x * 21; }
+inline int f7542_22(int x) { return x * 22; }
+inline int f7542_23(int x) { return x * 23; }
+inline int f7542_24(int x) { return x * 24; }
+inline int f7542_25(int x) { return x * 25; }
+inline int f7542_26(int x) { return x * 26; }
+inline int f7542_27(int x) { return x * 27; }
+inline int f7542_28(int x) { return x * 28; }
+inline int f7542_29(int x) { return x * 29; }
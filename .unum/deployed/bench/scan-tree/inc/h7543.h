@@ -0,0 +1,42 @@
+#pragma once
+/* header 7543 */
+#include <vector>
+#include "h398.h"
+#include "h84.h"
+#include "h1650.h"
+#include "h1918.h"
+#include "h3823.h"
+#ifdef X
+#include "h7770.h"
+#endif
+struct S7543 { int a; const char *s = "x//y"; };
+inline int f7543_0(int x) { return x * 0; }
+inline int f7543_1(int x) { return x * 1; }
+inline int f7543_2(int x) { return x * 2; }
+inline int f7543_3(int x) { return x * 3; }
+inline int f7543_4(int x) { return x * 4; }
+inline int f7543_5(int x) { return x * 5; }
+inline int f7543_6(int x) { return x * 6; }
+inline int f7543_7(int x) { return x * 7; }
+inline int f7543_8(int x) { return x * 8; }
+inline int f7543_9(int x) { return x * 9; }
+inline int f7543_10(int x) { return x * 10; }
+inline int f7543_11(int x) { return x * 11; }
+inline int f7543_12(int x) { return x * 12; }
+inline int f7543_13(int x) { return x * 13; }
+inline int f7543_14(int x) { return x * 14; }
+inline int f7543_15(int x) { return x * 15; }
+inline int f7543_16(int x) { return x * 16; }
+inline int f7543_17(int x) { return x * 17; }
+inline int f7543_18(int x) { return x * 18; }
+inline int f7543_19(int x) { return x * 19; }
+inline int f7543_20(int x) { return x * 20; }
+inline int f7543_21(int x) { return x * 21; }
+inline int f7543_22(int x) { return x * 22; }
+inline int f7543_23(int x) { return x * 23; }
+inline int f7543_24(int x) { return x * 24; }
+inline int f7543_25(int x) { return x * 25; }
+inline int f7543_26(int x) { return x * 26; }
+inline int f7543_27(int x) { return x * 27; }
+inline int f7543_28(int x) { return x * 28; }
+inline int f7543_29(int x) { return x * 29; }
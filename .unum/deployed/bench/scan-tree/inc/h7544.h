@@ -0,0 +1,42 @@
+#pragma once
+/* header 7544 */
+#include <vector>
+#include "h8490.h"
+#include "h7692.h"
+#include "h4535.h"
+#include "h760.h"
+#include "h6522.h"
+#ifdef X
+#include "h9338.h"
+#endif
+struct S7544 { int a; const char *s = "x//y"; };
+inline int f7544_0(int x) { return x * 0; }
+inline int f7544_1(int x) { return x * 1; }
+inline int f7544_2(int x) { return x * 2; }
+inline int f7544_3(int x) { return x * 3; }
+inline int f7544_4(int x) { return x * 4; }
+inline int f7544_5(int x) { return x * 5; }
+inline int f7544_6(int x) { return x * 6; }
+inline int f7544_7(int x) { return x * 7; }
+inline int f7544_8(int x) { return x * 8; }
+inline int f7544_9(int x) { return x * 9; }
+inline int f7544_10(int x) { return x * 10; }
+inline int f7544_11(int x) { return x * 11; }
+inline int f7544_12(int x) { return x * 12; }
+inline int f7544_13(int x) { return x * 13; }
+inline int f7544_14(int x) { return x * 14; }
+inline int f7544_15(int x) { return x * 15; }
+inline int f7544_16(int x) { return x * 16; }
+inline int f7544_17(int x) { return x * 17; }
+inline int f7544_18(int x) { return x * 18; }
+inline int f7544_19(int x) { return x * 19; }
+inline int f7544_20(int x) { return x * 20; }
+inline int f7544_21(int x) { return x * 21; }
+inline int f7544_22(int x) { return x * 22; }
+inline int f7544_23(int x) { return x * 23; }
+inline int f7544_24(int x) { return x * 24; }
+inline int f7544_25(int x) { return x * 25; }
+inline int f7544_26(int x) { return x * 26; }
+inline int f7544_27(int x) { return x * 27; }
+inline int f7544_28(int x) { return x * 28; }
+inline int f7544_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7550 */
+#include <vector>
+#include "h9737.h"
+#include "h8582.h"
+#include "h8008.h"
+#include "h2557.h"
+#include "h2155.h"
+#ifdef X
+#include "h9980.h"
+#endif
+struct S7550 { int a; const char *s = "x//y"; };
+inline int f7550_0(int x) { return x * 0; }
+inline int f7550_1(int x) { return x * 1; }
+inline int f7550_2(int x) { return x * 2; }
+inline int f7550_3(int x) { return x * 3; }
+inline int f7550_4(int x) { return x * 4; }
+inline int f7550_5(int x) { return x * 5; }
+inline int f7550_6(int x) { return x * 6; }
+inline int f7550_7(int x) { return x * 7; }
+inline int f7550_8(int x) { return x * 8; }
+inline int f7550_9(int x) { return x * 9; }
+inline int f7550_10(int x) { return x * 10; }
+inline int f7550_11(int x) { return x * 11; }
+inline int f7550_12(int x) { return x * 12; }
+inline int f7550_13(int x) { return x * 13; }
+inline int f7550_14(int x) { return x * 14; }
+inline int f7550_15(int x) { return x * 15; }
+inline int f7550_16(int x) { return x * 16; }
+inline int f7550_17(int x) { return x * 17; }
+inline int f7550_18(int x) { return x * 18; }
+inline int f7550_19(int x) { return x * 19; }
+inline int f7550_20(int x) { return x * 20; }
+inline int f7550_21(int x) { return x * 21; }
+inline int f7550_22(int x) { return x * 22; }
+inline int f7550_23(int x) { return x * 23; }
+inline int f7550_24(int x) { return x * 24; }
+inline int f7550_25(int x) { return x * 25; }
+inline int f7550_26(int x) { return x * 26; }
+inline int f7550_27(int x) { return x * 27; }
+inline int f7550_28(int x) { return x * 28; }
+inline int f7550_29(int x) { return x * 29; }
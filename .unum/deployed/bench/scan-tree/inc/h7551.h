@@ -0,0 +1,42 @@
+#pragma once
+/* header 7551 */
+#include <vector>
+#include "h3361.h"
+#include "h4814.h"
+#include "h9706.h"
+#include "h1031.h"
+#include "h7436.h"
+#ifdef X
+#include "h7538.h"
+#endif
+struct S7551 { int a; const char *s = "x//y"; };
+inline int f7551_0(int x) { return x * 0; }
+inline int f7551_1(int x) { return x * 1; }
+inline int f7551_2(int x) { return x * 2; }
+inline int f7551_3(int x) { return x * 3; }
+inline int f7551_4(int x) { return x * 4; }
+inline int f7551_5(int x) { return x * 5; }
+inline int f7551_6(int x) { return x * 6; }
+inline int f7551_7(int x) { return x * 7; }
+inline int f7551_8(int x) { return x * 8; }
+inline int f7551_9(int x) { return x * 9; }
+inline int f7551_10(int x) { return x * 10; }
+inline int f7551_11(int x) { return x * 11; }
+inline int f7551_12(int x) { return x * 12; }
+inline int f7551_13(int x) { return x * 13; }
+inline int f7551_14(int x) { return x * 14; }
+inline int f7551_15(int x) { return x * 15; }
+inline int f7551_16(int x) { return x * 16; }
+inline int f7551_17(int x) { return x * 17; }
+inline int f7551_18(int x) { return x * 18; }
+inline int f7551_19(int x) { return x * 19; }
+inline int f7551_20(int x) { return x * 20; }
+inline int f7551_21(int x) { return x * 21; }
+inline int f7551_22(int x) { return x * 22; }
+inline int f7551_23(int x) { return x * 23; }
+inline int f7551_24(int x) { return x * 24; }
+inline int f7551_25(int x) { return x * 25; }
+inline int f7551_26(int x) { return x * 26; }
+inline int f7551_27(int x) { return x * 27; }
+inline int f7551_28(int x) { return x * 28; }
+inline int f7551_29(int x) { return x * 29; }
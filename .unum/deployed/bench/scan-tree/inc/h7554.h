@@ -0,0 +1,42 @@
+#pragma once
+/* header 7554 */
+#include <vector>
+#include "h3431.h"
+#include "h1034.h"
+#include "h1826.h"
+#include "h3700.h"
+#include "h8813.h"
+#ifdef X
+#include "h7827.h"
+#endif
+struct S7554 { int a; const char *s = "x//y"; };
+inline int f7554_0(int x) { return x * 0; }
+inline int f7554_1(int x) { return x * 1; }
+inline int f7554_2(int x) { return x * 2; }
+inline int f7554_3(int x) { return x * 3; }
+inline int f7554_4(int x) { return x * 4; }
+inline int f7554_5(int x) { return x * 5; }
+inline int f7554_6(int x) { return x * 6; }
+inline int f7554_7(int x) { return x * 7; }
+inline int f7554_8(int x) { return x * 8; }
+inline int f7554_9(int x) { return x * 9; }
+inline int f7554_10(int x) { return x * 10; }
+inline int f7554_11(int x) { return x * 11; }
+inline int f7554_12(int x) { return x * 12; }
+inline int f7554_13(int x) { return x * 13; }
+inline int f7554_14(int x) { return x * 14; }
+inline int f7554_15(int x) { return x * 15; }
+inline int f7554_16(int x) { return x * 16; }
+inline int f7554_17(int x) { return x * 17; }
+inline int f7554_18(int x) { return x * 18; }
+inline int f7554_19(int x) { return x * 19; }
+inline int f7554_20(int x) { return x * 20; }
+inline int f7554_21(int x) { return x * 21; }
+inline int f7554_22(int x) { return x * 22; }
+inline int f7554_23(int x) { return x * 23; }
+inline int f7554_24(int x) { return x * 24; }
+inline int f7554_25(int x) { return x * 25; }
+inline int f7554_26(int x) { return x * 26; }
+inline int f7554_27(int x) { return x * 27; }
+inline int f7554_28(int x) { return x * 28; }
+inline int f7554_29(int x) { return x * 29; }
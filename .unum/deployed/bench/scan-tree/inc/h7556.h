@@ -0,0 +1,42 @@
+#pragma once
+/* header 7556 */
+#include <vector>
+#include "h3731.h"
+#include "h775.h"
+#include "h5076.h"
+#include "h7461.h"
+#include "h8865.h"
+#ifdef X
+#include "h4677.h"
+#endif
+struct S7556 { int a; const char *s = "x//y"; };
+inline int f7556_0(int x) { return x * 0; }
+inline int f7556_1(int x) { return x * 1; }
+inline int f7556_2(int x) { return x * 2; }
+inline int f7556_3(int x) { return x * 3; }
+inline int f7556_4(int x) { return x * 4; }
+inline int f7556_5(int x) { return x * 5; }
+inline int f7556_6(int x) { return x * 6; }
+inline int f7556_7(int x) { return x * 7; }
+inline int f7556_8(int x) { return x * 8; }
+inline int f7556_9(int x) { return x * 9; }
+inline int f7556_10(int x) { return x * 10; }
+inline int f7556_11(int x) { return x * 11; }
+inline int f7556_12(int x) { return x * 12; }
+inline int f7556_13(int x) { return x * 13; }
+inline int f7556_14(int x) { return x * 14; }
+inline int f7556_15(int x) { return x * 15; }
+inline int f7556_16(int x) { return x * 16; }
+inline int f7556_17(int x) { return x * 17; }
+inline int f7556_18(int x) { return x * 18; }
+inline int f7556_19(int x) { return x * 19; }
+inline int f7556_20(int x) { return x * 20; }
+inline int f7556_21(int x) { return x * 21; }
+inline int f7556_22(int x) { return x * 22; }
+inline int f7556_23(int x) { return x * 23; }
+inline int f7556_24(int x) { return x * 24; }
+inline int f7556_25(int x) { return x * 25; }
+inline int f7556_26(int x) { return x * 26; }
+inline int f7556_27(int x) { return x * 27; }
+inline int f7556_28(int x) { return x * 28; }
+inline int f7556_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7557 */
+#include <vector>
+#include "h6156.h"
+#include "h6164.h"
+#include "h5988.h"
+#include "h7302.h"
+#include "h124.h"
+#ifdef X
+#include "h6354.h"
+#endif
+struct S7557 { int a; const char *s = "x//y"; };
+inline int f7557_0(int x) { return x * 0; }
+inline int f7557_1(int x) { return x * 1; }
+inline int f7557_2(int x) { return x * 2; }
+inline int f7557_3(int x) { return x * 3; }
+inline int f7557_4(int x) { return x * 4; }
+inline int f7557_5(int x) { return x * 5; }
+inline int f7557_6(int x) { return x * 6; }
+inline int f7557_7(int x) { return x * 7; }
+inline int f7557_8(int x) { return x * 8; }
+inline int f7557_9(int x) { return x * 9; }
+inline int f7557_10(int x) { return x * 10; }
+inline int f7557_11(int x) { return x * 11; }
+inline int f7557_12(int x) { return x * 12; }
+inline int f7557_13(int x) { return x * 13; }
+inline int f7557_14(int x) { return x * 14; }
+inline int f7557_15(int x) { return x * 15; }
+inline int f7557_16(int x) { return x * 16; }
+inline int f7557_17(int x) { return x * 17; }
+inline int f7557_18(int x) { return x * 18; }
+inline int f7557_19(int x) { return x * 19; }
+inline int f7557_20(int x) { return x * 20; }
+inline int f7557_21(int x) { return x * 21; }
+inline int f7557_22(int x) { return x * 22; }
+inline int f7557_23(int x) { return x * 23; }
+inline int f7557_24(int x) { return x * 24; }
+inline int f7557_25(int x) { return x * 25; }
+inline int f7557_26(int x) { return x * 26; }
+inline int f7557_27(int x) { return x * 27; }
+inline int f7557_28(int x) { return x * 28; }
+inline int f7557_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7562 */
+#include <vector>
+#include "h6609.h"
+#include "h7975.h"
+#include "h1049.h"
+#include "h7410.h"
+#include "h9246.h"
+#ifdef X
+#include "h38.h"
+#endif
+struct S7562 { int a; const char *s = "x//y"; };
+inline int f7562_0(int x) { return x * 0; }
+inline int f7562_1(int x) { return x * 1; }
+inline int f7562_2(int x) { return x * 2; }
+inline int f7562_3(int x) { return x * 3; }
+inline int f7562_4(int x) { return x * 4; }
+inline int f7562_5(int x) { return x * 5; }
+inline int f7562_6(int x) { return x * 6; }
+inline int f7562_7(int x) { return x * 7; }
+inline int f7562_8(int x) { return x * 8; }
+inline int f7562_9(int x) { return x * 9; }
+inline int f7562_10(int x) { return x * 10; }
+inline int f7562_11(int x) { return x * 11; }
+inline int f7562_12(int x) { return x * 12; }
+inline int f7562_13(int x) { return x * 13; }
+inline int f7562_14(int x) { return x * 14; }
+inline int f7562_15(int x) { return x * 15; }
+inline int f7562_16(int x) { return x * 16; }
+inline int f7562_17(int x) { return x * 17; }
+inline int f7562_18(int x) { return x * 18; }
+inline int f7562_19(int x) { return x * 19; }
+inline int f7562_20(int x) { return x * 20; }
+inline int f7562_21(int x) { return x * 21; }
+inline int f7562_22(int x) { return x * 22; }
+inline int f7562_23(int x) { return x * 23; }
+inline int f7562_24(int x) { return x * 24; }
+inline int f7562_25(int x) { return x * 25; }
+inline int f7562_26(int x) { return x * 26; }
+inline int f7562_27(int x) { return x * 27; }
+inline int f7562_28(int x) { return x * 28; }
+inline int f7562_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7564 */
+#include <vector>
+#include "h4451.h"
+#include "h9335.h"
+#include "h4358.h"
+#include "h3885.h"
+#include "h9898.h"
+#ifdef X
+#include "h3652.h"
+#endif
+struct S7564 { int a; const char *s = "x//y"; };
+inline int f7564_0(int x) { return x * 0; }
+inline int f7564_1(int x) { return x * 1; }
+inline int f7564_2(int x) { return x * 2; }
+inline int f7564_3(int x) { return x * 3; }
+inline int f7564_4(int x) { return x * 4; }
+inline int f7564_5(int x) { return x * 5; }
+inline int f7564_6(int x) { return x * 6; }
+inline int f7564_7(int x) { return x * 7; }
+inline int f7564_8(int x) { return x * 8; }
+inline int f7564_9(int x) { return x * 9; }
+inline int f7564_10(int x) { return x * 10; }
+inline int f7564_11(int x) { return x * 11; }
+inline int f7564_12(int x) { return x * 12; }
+inline int f7564_13(int x) { return x * 13; }
+inline int f7564_14(int x) { return x * 14; }
+inline int f7564_15(int x) { return x * 15; }
+inline int f7564_16(int x) { return x * 16; }
+inline int f7564_17(int x) { return x * 17; }
+inline int f7564_18(int x) { return x * 18; }
+inline int f7564_19(int x) { return x * 19; }
+inline int f7564_20(int x) { return x * 20; }
+inline int f7564_21(int x) { return x * 21; }
+inline int f7564_22(int x) { return x * 22; }
+inline int f7564_23(int x) { return x * 23; }
+inline int f7564_24(int x) { return x * 24; }
+inline int f7564_25(int x) { return x * 25; }
+inline int f7564_26(int x) { return x * 26; }
+inline int f7564_27(int x) { return x * 27; }
+inline int f7564_28(int x) { return x * 28; }
+inline int f7564_29(int x) { return x * 29; }
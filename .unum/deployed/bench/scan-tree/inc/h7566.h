@@ -0,0 +1,42 @@
+#pragma once
+/* header 7566 */
+#include <vector>
+#include "h8835.h"
+#include "h7340.h"
+#include "h6446.h"
+#include "h140.h"
+#include "h2576.h"
+#ifdef X
+#include "h1768.h"
+#endif
+struct S7566 { int a; const char *s = "x//y"; };
+inline int f7566_0(int x) { return x * 0; }
+inline int f7566_1(int x) { return x * 1; }
+inline int f7566_2(int x) { return x * 2; }
+inline int f7566_3(int x) { return x * 3; }
+inline int f7566_4(int x) { return x * 4; }
+inline int f7566_5(int x) { return x * 5; }
+inline int f7566_6(int x) { return x * 6; }
+inline int f7566_7(int x) { return x * 7; }
+inline int f7566_8(int x) { return x * 8; }
+inline int f7566_9(int x) { return x * 9; }
+inline int f7566_10(int x) { return x * 10; }
+inline int f7566_11(int x) { return x * 11; }
+inline int f7566_12(int x) { return x * 12; }
+inline int f7566_13(int x) { return x * 13; }
+inline int f7566_14(int x) { return x * 14; }
+inline int f7566_15(int x) { return x * 15; }
+inline int f7566_16(int x) { return x * 16; }
+inline int f7566_17(int x) { return x * 17; }
+inline int f7566_18(int x) { return x * 18; }
+inline int f7566_19(int x) { return x * 19; }
+inline int f7566_20(int x) { return x * 20; }
+inline int f7566_21(int x) { return x * 21; }
+inline int f7566_22(int x) { return x * 22; }
+inline int f7566_23(int x) { return x * 23; }
+inline int f7566_24(int x) { return x * 24; }
+inline int f7566_25(int x) { return x * 25; }
+inline int f7566_26(int x) { return x * 26; }
+inline int f7566_27(int x) { return x * 27; }
+inline int f7566_28(int x) { return x * 28; }
+inline int f7566_29(int x) { return x * 29; }
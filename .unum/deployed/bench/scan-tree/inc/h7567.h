@@ -0,0 +1,42 @@
+#pragma once
+/* header 7567 */
+#include <vector>
+#include "h8173.h"
+#include "h9299.h"
+#include "h2781.h"
+#include "h2126.h"
+#include "h2674.h"
+#ifdef X
+#include "h3124.h"
+#endif
+struct S7567 { int a; const char *s = "x//y"; };
+inline int f7567_0(int x) { return x * 0; }
+inline int f7567_1(int x) { return x * 1; }
+inline int f7567_2(int x) { return x * 2; }
+inline int f7567_3(int x) { return x * 3; }
+inline int f7567_4(int x) { return x * 4; }
+inline int f7567_5(int x) { return x * 5; }
+inline int f7567_6(int x) { return x * 6; }
+inline int f7567_7(int x) { return x * 7; }
+inline int f7567_8(int x) { return x * 8; }
+inline int f7567_9(int x) { return x * 9; }
+inline int f7567_10(int x) { return x * 10; }
+inline int f7567_11(int x) { return x * 11; }
+inline int f7567_12(int x) { return x * 12; }
+inline int f7567_13(int x) { return x * 13; }
+inline int f7567_14(int x) { return x * 14; }
+inline int f7567_15(int x) { return x * 15; }
+inline int f7567_16(int x) { return x * 16; }
+inline int f7567_17(int x) { return x * 17; }
+inline int f7567_18(int x) { return x * 18; }
+inline int f7567_19(int x) { return x * 19; }
+inline int f7567_20(int x) { return x * 20; }
+inline int f7567_21(int x) { return x * 21; }
+inline int f7567_22(int x) { return x * 22; }
+inline int f7567_23(int x) { return x * 23; }
+inline int f7567_24(int x) { return x * 24; }
+inline int f7567_25(int x) { return x * 25; }
+inline int f7567_26(int x) { return x * 26; }
+inline int f7567_27(int x) { return x * 27; }
+inline int f7567_28(int x) { return x * 28; }
+inline int f7567_29(int x) { return x * 29; }
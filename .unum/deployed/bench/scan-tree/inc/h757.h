@@ -0,0 +1,42 @@
+#pragma once
+/* header 757 */
+#include <vector>
+#include "h495.h"
+#include "h1390.h"
+#include "h5505.h"
+#include "h4446.h"
+#include "h5099.h"
+#ifdef X
+#include "h137.h"
+#endif
+struct S757 { int a; const char *s = "x//y"; };
+inline int f757_0(int x) { return x * 0; }
+inline int f757_1(int x) { return x * 1; }
+inline int f757_2(int x) { return x * 2; }
+inline int f757_3(int x) { return x * 3; }
+inline int f757_4(int x) { return x * 4; }
+inline int f757_5(int x) { return x * 5; }
+inline int f757_6(int x) { return x * 6; }
+inline int f757_7(int x) { return x * 7; }
+inline int f757_8(int x) { return x * 8; }
+inline int f757_9(int x) { return x * 9; }
+inline int f757_10(int x) { return x * 10; }
+inline int f757_11(int x) { return x * 11; }
+inline int f757_12(int x) { return x * 12; }
+inline int f757_13(int x) { return x * 13; }
+inline int f757_14(int x) { return x * 14; }
+inline int f757_15(int x) { return x * 15; }
+inline int f757_16(int x) { return x * 16; }
+inline int f757_17(int x) { return x * 17; }
+inline int f757_18(int x) { return x * 18; }
+inline int f757_19(int x) { return x * 19; }
+inline int f757_20(int x) { return x * 20; }
+inline int f757_21(int x) { return x * 21; }
+inline int f757_22(int x) { return x * 22; }
+inline int f757_23(int x) { return x * 23; }
+inline int f757_24(int x) { return x * 24; }
+inline int f757_25(int x) { return x * 25; }
+inline int f757_26(int x) { return x * 26; }
+inline int f757_27(int x) { return x * 27; }
+inline int f757_28(int x) { return x * 28; }
+inline int f757_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7570 */
+#include <vector>
+#include "h1081.h"
+#include "h516.h"
+#include "h3513.h"
+#include "h1140.h"
+#include "h4691.h"
+#ifdef X
+#include "h5293.h"
+#endif
+struct S7570 { int a; const char *s = "x//y"; };
+inline int f7570_0(int x) { return x * 0; }
+inline int f7570_1(int x) { return x * 1; }
+inline int f7570_2(int x) { return x * 2; }
+inline int f7570_3(int x) { return x * 3; }
+inline int f7570_4(int x) { return x * 4; }
+inline int f7570_5(int x) { return x * 5; }
+inline int f7570_6(int x) { return x * 6; }
+inline int f7570_7(int x) { return x * 7; }
+inline int f7570_8(int x) { return x * 8; }
+inline int f7570_9(int x) { return x * 9; }
+inline int f7570_10(int x) { return x * 10; }
+inline int f7570_11(int x) { return x * 11; }
+inline int f7570_12(int x) { return x * 12; }
+inline int f7570_13(int x) { return x * 13; }
+inline int f7570_14(int x) { return x * 14; }
+inline int f7570_15(int x) { return x * 15; }
+inline int f7570_16(int x) { return x * 16; }
+inline int f7570_17(int x) { return x * 17; }
+inline int f7570_18(int x) { return x * 18; }
+inline int f7570_19(int x) { return x * 19; }
+inline int f7570_20(int x) { return x * 20; }
+inline int f7570_21(int x) { return x * 21; }
+inline int f7570_22(int x) { return x * 22; }
+inline int f7570_23(int x) { return x * 23; }
+inline int f7570_24(int x) { return x * 24; }
+inline int f7570_25(int x) { return x * 25; }
+inline int f7570_26(int x) { return x * 26; }
+inline int f7570_27(int x) { return x * 27; }
+inline int f7570_28(int x) { return x * 28; }
+inline int f7570_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7574 */
+#include <vector>
+#include "h6495.h"
+#include "h1320.h"
+#include "h4184.h"
+#include "h2323.h"
+#include "h418.h"
+#ifdef X
+#include "h6016.h"
+#endif
+struct S7574 { int a; const char *s = "x//y"; };
+inline int f7574_0(int x) { return x * 0; }
+inline int f7574_1(int x) { return x * 1; }
+inline int f7574_2(int x) { return x * 2; }
+inline int f7574_3(int x) { return x * 3; }
+inline int f7574_4(int x) { return x * 4; }
+inline int f7574_5(int x) { return x * 5; }
+inline int f7574_6(int x) { return x * 6; }
+inline int f7574_7(int x) { return x * 7; }
+inline int f7574_8(int x) { return x * 8; }
+inline int f7574_9(int x) { return x * 9; }
+inline int f7574_10(int x) { return x * 10; }
+inline int f7574_11(int x) { return x * 11; }
+inline int f7574_12(int x) { return x * 12; }
+inline int f7574_13(int x) { return x * 13; }
+inline int f7574_14(int x) { return x * 14; }
+inline int f7574_15(int x) { return x * 15; }
+inline int f7574_16(int x) { return x * 16; }
+inline int f7574_17(int x) { return x * 17; }
+inline int f7574_18(int x) { return x * 18; }
+inline int f7574_19(int x) { return x * 19; }
+inline int f7574_20(int x) { return x * 20; }
+inline int f7574_21(int x) { return x * 21; }
+inline int f7574_22(int x) { return x * 22; }
+inline int f7574_23(int x) { return x * 23; }
+inline int f7574_24(int x) { return x * 24; }
+inline int f7574_25(int x) { return x * 25; }
+inline int f7574_26(int x) { return x * 26; }
+inline int f7574_27(int x) { return x * 27; }
+inline int f7574_28(int x) { return x * 28; }
+inline int f7574_29(int x) { return x * 29; }
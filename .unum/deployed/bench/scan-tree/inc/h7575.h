@@ -0,0 +1,42 @@
+#pragma once
+/* header 7575 */
+#include <vector>
+#include "h1794.h"
+#include "h6162.h"
+#include "h4609.h"
+#include "h2544.h"
+#include "h1510.h"
+#ifdef X
+#include "h3867.h"
+#endif
+struct S7575 { int a; const char *s = "x//y"; };
+inline int f7575_0(int x) { return x * 0; }
+inline int f7575_1(int x) { return x * 1; }
+inline int f7575_2(int x) { return x * 2; }
+inline int f7575_3(int x) { return x * 3; }
+inline int f7575_4(int x) { return x * 4; }
+inline int f7575_5(int x) { return x * 5; }
+inline int f7575_6(int x) { return x * 6; }
+inline int f7575_7(int x) { return x * 7; }
+inline int f7575_8(int x) { return x * 8; }
+inline int f7575_9(int x) { return x * 9; }
+inline int f7575_10(int x) { return x * 10; }
+inline int f7575_11(int x) { return x * 11; }
+inline int f7575_12(int x) { return x * 12; }
+inline int f7575_13(int x) { return x * 13; }
+inline int f7575_14(int x) { return x * 14; }
+inline int f7575_15(int x) { return x * 15; }
+inline int f7575_16(int x) { return x * 16; }
+inline int f7575_17(int x) { return x * 17; }
+inline int f7575_18(int x) { return x * 18; }
+inline int f7575_19(int x) { return x * 19; }
+inline int f7575_20(int x) { return x * 20; }
+inline int f7575_21(int x) { return x * 21; }
+inline int f7575_22(int x) { return x * 22; }
+inline int f7575_23(int x) { return x * 23; }
+inline int f7575_24(int x) { return x * 24; }
+inline int f7575_25(int x) { return x * 25; }
+inline int f7575_26(int x) { return x * 26; }
+inline int f7575_27(int x) { return x * 27; }
+inline int f7575_28(int x) { return x * 28; }
+inline int f7575_29(int x) { return x * 29; }
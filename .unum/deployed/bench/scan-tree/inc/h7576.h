@@ -0,0 +1,42 @@
+#pragma once
+/* header 7576 */
+#include <vector>
+#include "h3021.h"
+#include "h790.h"
+#include "h1715.h"
+#include "h8836.h"
+#include "h4793.h"
+#ifdef X
+#include "h4553.h"
+#endif
+struct S7576 { int a; const char *s = "x//y"; };
+inline int f7576_0(int x) { return x * 0; }
+inline int f7576_1(int x) { return x * 1; }
+inline int f7576_2(int x) { return x * 2; }
+inline int f7576_3(int x) { return x * 3; }
+inline int f7576_4(int x) { return x * 4; }
+inline int f7576_5(int x) { return x * 5; }
+inline int f7576_6(int x) { return x * 6; }
+inline int f7576_7(int x) { return x * 7; }
+inline int f7576_8(int x) { return x * 8; }
+inline int f7576_9(int x) { return x * 9; }
+inline int f7576_10(int x) { return x * 10; }
+inline int f7576_11(int x) { return x * 11; }
+inline int f7576_12(int x) { return x * 12; }
+inline int f7576_13(int x) { return x * 13; }
+inline int f7576_14(int x) { return x * 14; }
+inline int f7576_15(int x) { return x * 15; }
+inline int f7576_16(int x) { return x * 16; }
+inline int f7576_17(int x) { return x * 17; }
+inline int f7576_18(int x) { return x * 18; }
+inline int f7576_19(int x) { return x * 19; }
+inline int f7576_20(int x) { return x * 20; }
+inline int f7576_21(int x) { return x * 21; }
+inline int f7576_22(int x) { return x * 22; }
+inline int f7576_23(int x) { return x * 23; }
+inline int f7576_24(int x) { return x * 24; }
+inline int f7576_25(int x) { return x * 25; }
+inline int f7576_26(int x) { return x * 26; }
+inline int f7576_27(int x) { return x * 27; }
+inline int f7576_28(int x) { return x * 28; }
+inline int f7576_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7577 */
+#include <vector>
+#include "h658.h"
+#include "h1658.h"
+#include "h3048.h"
+#include "h8859.h"
+#include "h4563.h"
+#ifdef X
+#include "h7086.h"
+#endif
+struct S7577 { int a; const char *s = "x//y"; };
+inline int f7577_0(int x) { return x * 0; }
+inline int f7577_1(int x) { return x * 1; }
+inline int f7577_2(int x) { return x * 2; }
+inline int f7577_3(int x) { return x * 3; }
+inline int f7577_4(int x) { return x * 4; }
+inline int f7577_5(int x) { return x * 5; }
+inline int f7577_6(int x) { return x * 6; }
+inline int f7577_7(int x) { return x * 7; }
+inline int f7577_8(int x) { return x * 8; }
+inline int f7577_9(int x) { return x * 9; }
+inline int f7577_10(int x) { return x * 10; }
+inline int f7577_11(int x) { return x * 11; }
+inline int f7577_12(int x) { return x * 12; }
+inline int f7577_13(int x) { return x * 13; }
+inline int f7577_14(int x) { return x * 14; }
+inline int f7577_15(int x) { return x * 15; }
+inline int f7577_16(int x) { return x * 16; }
+inline int f7577_17(int x) { return x * 17; }
+inline int f7577_18(int x) { return x * 18; }
+inline int f7577_19(int x) { return x * 19; }
+inline int f7577_20(int x) { return x * 20; }
+inline int f7577_21(int x) { return x * 21; }
+inline int f7577_22(int x) { return x * 22; }
+inline int f7577_23(int x) { return x * 23; }
+inline int f7577_24(int x) { return x * 24; }
+inline int f7577_25(int x) { return x * 25; }
+inline int f7577_26(int x) { return x * 26; }
+inline int f7577_27(int x) { return x * 27; }
+inline int f7577_28(int x) { return x * 28; }
+inline int f7577_29(int x) { return x * 29; }
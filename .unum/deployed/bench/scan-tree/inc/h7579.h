@@ -0,0 +1,42 @@
+#pragma once
+/* header 7579 */
+#include <vector>
+#include "h4005.h"
+#include "h3311.h"
+#include "h9364.h"
+#include "h6310.h"
+#include "h6302.h"
+#ifdef X
+#include "h3820.h"
+#endif
+struct S7579 { int a; const char *s = "x//y"; };
+inline int f7579_0(int x) { return x * 0; }
+inline int f7579_1(int x) { return x * 1; }
+inline int f7579_2(int x) { return x * 2; }
+inline int f7579_3(int x) { return x * 3; }
+inline int f7579_4(int x) { return x * 4; }
+inline int f7579_5(int x) { return x * 5; }
+inline int f7579_6(int x) { return x * 6; }
+inline int f7579_7(int x) { return x * 7; }
+inline int f7579_8(int x) { return x * 8; }
+inline int f7579_9(int x) { return x * 9; }
+inline int f7579_10(int x) { return x * 10; }
+inline int f7579_11(int x) { return x * 11; }
+inline int f7579_12(int x) { return x * 12; }
+inline int f7579_13(int x) { return x * 13; }
+inline int f7579_14(int x) { return x * 14; }
+inline int f7579_15(int x) { return x * 15; }
+inline int f7579_16(int x) { return x * 16; }
+inline int f7579_17(int x) { return x * 17; }
+inline int f7579_18(int x) { return x * 18; }
+inline int f7579_19(int x) { return x * 19; }
+inline int f7579_20(int x) { return x * 20; }
+inline int f7579_21(int x) { return x * 21; }
+inline int f7579_22(int x) { return x * 22; }
+inline int f7579_23(int x) { return x * 23; }
+inline int f7579_24(int x) { return x * 24; }
+inline int f7579_25(int x) { return x * 25; }
+inline int f7579_26(int x) { return x * 26; }
+inline int f7579_27(int x) { return x * 27; }
+inline int f7579_28(int x) { return x * 28; }
+inline int f7579_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 758 */
+#include <vector>
+#include "h8944.h"
+#include "h571.h"
+#include "h5280.h"
+#include "h8874.h"
+#include "h584.h"
+#ifdef X
+#include "h4754.h"
+#endif
+struct S758 { int a; const char *s = "x//y"; };
+inline int f758_0(int x) { return x * 0; }
+inline int f758_1(int x) { return x * 1; }
+inline int f758_2(int x) { return x * 2; }
+inline int f758_3(int x) { return x * 3; }
+inline int f758_4(int x) { return x * 4; }
+inline int f758_5(int x) { return x * 5; }
+inline int f758_6(int x) { return x * 6; }
+inline int f758_7(int x) { return x * 7; }
+inline int f758_8(int x) { return x * 8; }
+inline int f758_9(int x) { return x * 9; }
+inline int f758_10(int x) { return x * 10; }
+inline int f758_11(int x) { return x * 11; }
+inline int f758_12(int x) { return x * 12; }
+inline int f758_13(int x) { return x * 13; }
+inline int f758_14(int x) { return x * 14; }
+inline int f758_15(int x) { return x * 15; }
+inline int f758_16(int x) { return x * 16; }
+inline int f758_17(int x) { return x * 17; }
+inline int f758_18(int x) { return x * 18; }
+inline int f758_19(int x) { return x * 19; }
+inline int f758_20(int x) { return x * 20; }
+inline int f758_21(int x) { return x * 21; }
+inline int f758_22(int x) { return x * 22; }
+inline int f758_23(int x) { return x * 23; }
+inline int f758_24(int x) { return x * 24; }
+inline int f758_25(int x) { return x * 25; }
+inline int f758_26(int x) { return x * 26; }
+inline int f758_27(int x) { return x * 27; }
+inline int f758_28(int x) { return x * 28; }
+inline int f758_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7580 */
+#include <vector>
+#include "h4165.h"
+#include "h7122.h"
+#include "h4241.h"
+#include "h7213.h"
+#include "h3381.h"
+#ifdef X
+#include "h338.h"
+#endif
+struct S7580 { int a; const char *s = "x//y"; };
+inline int f7580_0(int x) { return x * 0; }
+inline int f7580_1(int x) { return x * 1; }
+inline int f7580_2(int x) { return x * 2; }
+inline int f7580_3(int x) { return x * 3; }
+inline int f7580_4(int x) { return x * 4; }
+inline int f7580_5(int x) { return x * 5; }
+inline int f7580_6(int x) { return x * 6; }
+inline int f7580_7(int x) { return x * 7; }
+inline int f7580_8(int x) { return x * 8; }
+inline int f7580_9(int x) { return x * 9; }
+inline int f7580_10(int x) { return x * 10; }
+inline int f7580_11(int x) { return x * 11; }
+inline int f7580_12(int x) { return x * 12; }
+inline int f7580_13(int x) { return x * 13; }
+inline int f7580_14(int x) { return x * 14; }
+inline int f7580_15(int x) { return x * 15; }
+inline int f7580_16(int x) { return x * 16; }
+inline int f7580_17(int x) { return x * 17; }
+inline int f7580_18(int x) { return x * 18; }
+inline int f7580_19(int x) { return x * 19; }
+inline int f7580_20(int x) { return x * 20; }
+inline int f7580_21(int x) { return x * 21; }
+inline int f7580_22(int x) { return x * 22; }
+inline int f7580_23(int x) { return x * 23; }
+inline int f7580_24(int x) { return x * 24; }
+inline int f7580_25(int x) { return x * 25; }
+inline int f7580_26(int x) { return x * 26; }
+inline int f7580_27(int x) { return x * 27; }
+inline int f7580_28(int x) { return x * 28; }
+inline int f7580_29(int x) { return x * 29; }
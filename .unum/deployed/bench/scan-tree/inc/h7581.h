@@ -0,0 +1,42 @@
+#pragma once
+/* header 7581 */
+#include <vector>
+#include "h2159.h"
+#include "h5438.h"
+#include "h540.h"
+#include "h1954.h"
+#include "h2774.h"
+#ifdef X
+#include "h680.h"
+#endif
+struct S7581 { int a; const char *s = "x//y"; };
+inline int f7581_0(int x) { return x * 0; }
+inline int f7581_1(int x) { return x * 1; }
+inline int f7581_2(int x) { return x * 2; }
+inline int f7581_3(int x) { return x * 3; }
+inline int f7581_4(int x) { return x * 4; }
+inline int f7581_5(int x) { return x * 5; }
+inline int f7581_6(int x) { return x * 6; }
+inline int f7581_7(int x) { return x * 7; }
+inline int f7581_8(int x) { return x * 8; }
+inline int f7581_9(int x) { return x * 9; }
+inline int f7581_10(int x) { return x * 10; }
+inline int f7581_11(int x) { return x * 11; }
+inline int f7581_12(int x) { return x * 12; }
+inline int f7581_13(int x) { return x * 13; }
+inline int f7581_14(int x) { return x * 14; }
+inline int f7581_15(int x) { return x * 15; }
+inline int f7581_16(int x) { return x * 16; }
+inline int f7581_17(int x) { return x * 17; }
+inline int f7581_18(int x) { return x * 18; }
+inline int f7581_19(int x) { return x * 19; }
+inline int f7581_20(int x) { return x * 20; }
+inline int f7581_21(int x) { return x * 21; }
+inline int f7581_22(int x) { return x * 22; }
+inline int f7581_23(int x) { return x * 23; }
+inline int f7581_24(int x) { return x * 24; }
+inline int f7581_25(int x) { return x * 25; }
+inline int f7581_26(int x) { return x * 26; }
+inline int f7581_27(int x) { return x * 27; }
+inline int f7581_28(int x) { return x * 28; }
+inline int f7581_29(int x) { return x * 29; }
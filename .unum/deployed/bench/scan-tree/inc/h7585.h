@@ -0,0 +1,42 @@
+#pragma once
+/* header 7585 */
+#include <vector>
+#include "h2657.h"
+#include "h5909.h"
+#include "h4696.h"
+#include "h3834.h"
+#include "h6694.h"
+#ifdef X
+#include "h9578.h"
+#endif
+struct S7585 { int a; const char *s = "x//y"; };
+inline int f7585_0(int x) { return x * 0; }
+inline int f7585_1(int x) { return x * 1; }
+inline int f7585_2(int x) { return x * 2; }
+inline int f7585_3(int x) { return x * 3; }
+inline int f7585_4(int x) { return x * 4; }
+inline int f7585_5(int x) { return x * 5; }
+inline int f7585_6(int x) { return x * 6; }
+inline int f7585_7(int x) { return x * 7; }
+inline int f7585_8(int x) { return x * 8; }
+inline int f7585_9(int x) { return x * 9; }
+inline int f7585_10(int x) { return x * 10; }
+inline int f7585_11(int x) { return x * 11; }
+inline int f7585_12(int x) { return x * 12; }
+inline int f7585_13(int x) { return x * 13; }
+inline int f7585_14(int x) { return x * 14; }
+inline int f7585_15(int x) { return x * 15; }
+inline int f7585_16(int x) { return x * 16; }
+inline int f7585_17(int x) { return x * 17; }
+inline int f7585_18(int x) { return x * 18; }
+inline int f7585_19(int x) { return x * 19; }
+inline int f7585_20(int x) { return x * 20; }
+inline int f7585_21(int x) { return x * 21; }
+inline int f7585_22(int x) { return x * 22; }
+inline int f7585_23(int x) { return x * 23; }
+inline int f7585_24(int x) { return x * 24; }
+inline int f7585_25(int x) { return x * 25; }
+inline int f7585_26(int x) { return x * 26; }
+inline int f7585_27(int x) { return x * 27; }
+inline int f7585_28(int x) { return x * 28; }
+inline int f7585_29(int x) { return x * 29; }
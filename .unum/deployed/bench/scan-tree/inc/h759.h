@@ -0,0 +1,42 @@
+#pragma once
+/* header 759 */
+#include <vector>
+#include "h9353.h"
+#include "h5299.h"
+#include "h7682.h"
+#include "h8964.h"
+#include "h3121.h"
+#ifdef X
+#include "h9389.h"
+#endif
+struct S759 { int a; const char *s = "x//y"; };
+inline int f759_0(int x) { return x * 0; }
+inline int f759_1(int x) { return x * 1; }
+inline int f759_2(int x) { return x * 2; }
+inline int f759_3(int x) { return x * 3; }
+inline int f759_4(int x) { return x * 4; }
+inline int f759_5(int x) { return x * 5; }
+inline int f759_6(int x) { return x * 6; }
+inline int f759_7(int x) { return x * 7; }
+inline int f759_8(int x) { return x * 8; }
+inline int f759_9(int x) { return x * 9; }
+inline int f759_10(int x) { return x * 10; }
+inline int f759_11(int x) { return x * 11; }
+inline int f759_12(int x) { return x * 12; }
+inline int f759_13(int x) { return x * 13; }
+inline int f759_14(int x) { return x * 14; }
+inline int f759_15(int x) { return x * 15; }
+inline int f759_16(int x) { return x * 16; }
+inline int f759_17(int x) { return x * 17; }
+inline int f759_18(int x) { return x * 18; }
+inline int f759_19(int x) { return x * 19; }
+inline int f759_20(int x) { return x * 20; }
+inline int f759_21(int x) { return x * 21; }
+inline int f759_22(int x) { return x * 22; }
+inline int f759_23(int x) { return x * 23; }
+inline int f759_24(int x) { return x * 24; }
+inline int f759_25(int x) { return x * 25; }
+inline int f759_26(int x) { return x * 26; }
+inline int f759_27(int x) { return x * 27; }
+inline int f759_28(int x) { return x * 28; }
+inline int f759_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7590 */
+#include <vector>
+#include "h9573.h"
+#include "h9789.h"
+#include "h9026.h"
+#include "h402.h"
+#include "h190.h"
+#ifdef X
+#include "h4519.h"
+#endif
+struct S7590 { int a; const char *s = "x//y"; };
+inline int f7590_0(int x) { return x * 0; }
+inline int f7590_1(int x) { return x * 1; }
+inline int f7590_2(int x) { return x * 2; }
+inline int f7590_3(int x) { return x * 3; }
+inline int f7590_4(int x) { return x * 4; }
+inline int f7590_5(int x) { return x * 5; }
+inline int f7590_6(int x) { return x * 6; }
+inline int f7590_7(int x) { return x * 7; }
+inline int f7590_8(int x) { return x * 8; }
+inline int f7590_9(int x) { return x * 9; }
+inline int f7590_10(int x) { return x * 10; }
+inline int f7590_11(int x) { return x * 11; }
+inline int f7590_12(int x) { return x * 12; }
+inline int f7590_13(int x) { return x * 13; }
+inline int f7590_14(int x) { return x * 14; }
+inline int f7590_15(int x) { return x * 15; }
+inline int f7590_16(int x) { return x * 16; }
+inline int f7590_17(int x) { return x * 17; }
+inline int f7590_18(int x) { return x * 18; }
+inline int f7590_19(int x) { return x * 19; }
+inline int f7590_20(int x) { return x * 20; }
+inline int f7590_21(int x) { return x * 21; }
+inline int f7590_22(int x) { return x * 22; }
+inline int f7590_23(int x) { return x * 23; }
+inline int f7590_24(int x) { return x * 24; }
+inline int f7590_25(int x) { return x * 25; }
+inline int f7590_26(int x) { return x * 26; }
+inline int f7590_27(int x) { return x * 27; }
+inline int f7590_28(int x) { return x * 28; }
+inline int f7590_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7592 */
+#include <vector>
+#include "h658.h"
+#include "h7991.h"
+#include "h4053.h"
+#include "h4836.h"
+#include "h8964.h"
+#ifdef X
+#include "h2837.h"
+#endif
+struct S7592 { int a; const char *s = "x//y"; };
+inline int f7592_0(int x) { return x * 0; }
+inline int f7592_1(int x) { return x * 1; }
+inline int f7592_2(int x) { return x * 2; }
+inline int f7592_3(int x) { return x * 3; }
+inline int f7592_4(int x) { return x * 4; }
+inline int f7592_5(int x) { return x * 5; }
+inline int f7592_6(int x) { return x * 6; }
+inline int f7592_7(int x) { return x * 7; }
+inline int f7592_8(int x) { return x * 8; }
+inline int f7592_9(int x) { return x * 9; }
+inline int f7592_10(int x) { return x * 10; }
+inline int f7592_11(int x) { return x * 11; }
+inline int f7592_12(int x) { return x * 12; }
+inline int f7592_13(int x) { return x * 13; }
+inline int f7592_14(int x) { return x * 14; }
+inline int f7592_15(int x) { return x * 15; }
+inline int f7592_16(int x) { return x * 16; }
+inline int f7592_17(int x) { return x * 17; }
+inline int f7592_18(int x) { return x * 18; }
+inline int f7592_19(int x) { return x * 19; }
+inline int f7592_20(int x) { return x * 20; }
+inline int f7592_21(int x) { return x * 21; }
+inline int f7592_22(int x) { return x * 22; }
+inline int f7592_23(int x) { return x * 23; }
+inline int f7592_24(int x) { return x * 24; }
+inline int f7592_25(int x) { return x * 25; }
+inline int f7592_26(int x) { return x * 26; }
+inline int f7592_27(int x) { return x * 27; }
+inline int f7592_28(int x) { return x * 28; }
+inline int f7592_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7594 */
+#include <vector>
+#include "h3584.h"
+#include "h2407.h"
+#include "h8865.h"
+#include "h106.h"
+#include "h1441.h"
+#ifdef X
+#include "h535.h"
+#endif
+struct S7594 { int a; const char *s = "x//y"; };
+inline int f7594_0(int x) { return x * 0; }
+inline int f7594_1(int x) { return x * 1; }
+inline int f7594_2(int x) { return x * 2; }
+inline int f7594_3(int x) { return x * 3; }
+inline int f7594_4(int x) { return x * 4; }
+inline int f7594_5(int x) { return x * 5; }
+inline int f7594_6(int x) { return x * 6; }
+inline int f7594_7(int x) { return x * 7; }
+inline int f7594_8(int x) { return x * 8; }
+inline int f7594_9(int x) { return x * 9; }
+inline int f7594_10(int x) { return x * 10; }
+inline int f7594_11(int x) { return x * 11; }
+inline int f7594_12(int x) { return x * 12; }
+inline int f7594_13(int x) { return x * 13; }
+inline int f7594_14(int x) { return x * 14; }
+inline int f7594_15(int x) { return x * 15; }
+inline int f7594_16(int x) { return x * 16; }
+inline int f7594_17(int x) { return x * 17; }
+inline int f7594_18(int x) { return x * 18; }
+inline int f7594_19(int x) { return x * 19; }
+inline int f7594_20(int x) { return x * 20; }
+inline int f7594_21(int x) { return x * 21; }
+inline int f7594_22(int x) { return x * 22; }
+inline int f7594_23(int x) { return x * 23; }
+inline int f7594_24(int x) { return x * 24; }
+inline int f7594_25(int x) { return x * 25; }
+inline int f7594_26(int x) { return x * 26; }
+inline int f7594_27(int x) { return x * 27; }
+inline int f7594_28(int x) { return x * 28; }
+inline int f7594_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7596 */
+#include <vector>
+#include "h2638.h"
+#include "h1371.h"
+#include "h7500.h"
+#include "h381.h"
+#include "h8528.h"
+#ifdef X
+#include "h4757.h"
+#endif
+struct S7596 { int a; const char *s = "x//y"; };
+inline int f7596_0(int x) { return x * 0; }
+inline int f7596_1(int x) { return x * 1; }
+inline int f7596_2(int x) { return x * 2; }
+inline int f7596_3(int x) { return x * 3; }
+inline int f7596_4(int x) { return x * 4; }
+inline int f7596_5(int x) { return x * 5; }
+inline int f7596_6(int x) { return x * 6; }
+inline int f7596_7(int x) { return x * 7; }
+inline int f7596_8(int x) { return x * 8; }
+inline int f7596_9(int x) { return x * 9; }
+inline int f7596_10(int x) { return x * 10; }
+inline int f7596_11(int x) { return x * 11; }
+inline int f7596_12(int x) { return x * 12; }
+inline int f7596_13(int x) { return x * 13; }
+inline int f7596_14(int x) { return x * 14; }
+inline int f7596_15(int x) { return x * 15; }
+inline int f7596_16(int x) { return x * 16; }
+inline int f7596_17(int x) { return x * 17; }
+inline int f7596_18(int x) { return x * 18; }
+inline int f7596_19(int x) { return x * 19; }
+inline int f7596_20(int x) { return x * 20; }
+inline int f7596_21(int x) { return x * 21; }
+inline int f7596_22(int x) { return x * 22; }
+inline int f7596_23(int x) { return x * 23; }
+inline int f7596_24(int x) { return x * 24; }
+inline int f7596_25(int x) { return x * 25; }
+inline int f7596_26(int x) { return x * 26; }
+inline int f7596_27(int x) { return x * 27; }
+inline int f7596_28(int x) { return x * 28; }
+inline int f7596_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7598 */
+#include <vector>
+#include "h6473.h"
+#include "h1141.h"
+#include "h5469.h"
+#include "h2761.h"
+#include "h1315.h"
+#ifdef X
+#include "h5437.h"
+#endif
+struct S7598 { int a; const char *s = "x//y"; };
+inline int f7598_0(int x) { return x * 0; }
+inline int f7598_1(int x) { return x * 1; }
+inline int f7598_2(int x) { return x * 2; }
+inline int f7598_3(int x) { return x * 3; }
+inline int f7598_4(int x) { return x * 4; }
+inline int f7598_5(int x) { return x * 5; }
+inline int f7598_6(int x) { return x * 6; }
+inline int f7598_7(int x) { return x * 7; }
+inline int f7598_8(int x) { return x * 8; }
+inline int f7598_9(int x) { return x * 9; }
+inline int f7598_10(int x) { return x * 10; }
+inline int f7598_11(int x) { return x * 11; }
+inline int f7598_12(int x) { return x * 12; }
+inline int f7598_13(int x) { return x * 13; }
+inline int f7598_14(int x) { return x * 14; }
+inline int f7598_15(int x) { return x * 15; }
+inline int f7598_16(int x) { return x * 16; }
+inline int f7598_17(int x) { return x * 17; }
+inline int f7598_18(int x) { return x * 18; }
+inline int f7598_19(int x) { return x * 19; }
+inline int f7598_20(int x) { return x * 20; }
+inline int f7598_21(int x) { return x * 21; }
+inline int f7598_22(int x) { return x * 22; }
+inline int f7598_23(int x) { return x * 23; }
+inline int f7598_24(int x) { return x * 24; }
+inline int f7598_25(int x) { return x * 25; }
+inline int f7598_26(int x) { return x * 26; }
+inline int f7598_27(int x) { return x * 27; }
+inline int f7598_28(int x) { return x * 28; }
+inline int f7598_29(int x) { return x * 29; }
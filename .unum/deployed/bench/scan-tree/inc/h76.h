@@ -0,0 +1,42 @@
+#pragma once
+/* header 76 */
+#include <vector>
+#include "h6123.h"
+#include "h1824.h"
+#include "h86.h"
+#include "h6538.h"
+#include "h5728.h"
+#ifdef X
+#include "h2303.h"
+#endif
+struct S76 { int a; const char *s = "x//y"; };
+inline int f76_0(int x) { return x * 0; }
+inline int f76_1(int x) { return x * 1; }
+inline int f76_2(int x) { return x * 2; }
+inline int f76_3(int x) { return x * 3; }
+inline int f76_4(int x) { return x * 4; }
+inline int f76_5(int x) { return x * 5; }
+inline int f76_6(int x) { return x * 6; }
+inline int f76_7(int x) { return x * 7; }
+inline int f76_8(int x) { return x * 8; }
+inline int f76_9(int x) { return x * 9; }
+inline int f76_10(int x) { return x * 10; }
+inline int f76_11(int x) { return x * 11; }
+inline int f76_12(int x) { return x * 12; }
+inline int f76_13(int x) { return x * 13; }
+inline int f76_14(int x) { return x * 14; }
+inline int f76_15(int x) { return x * 15; }
+inline int f76_16(int x) { return x * 16; }
+inline int f76_17(int x) { return x * 17; }
+inline int f76_18(int x) { return x * 18; }
+inline int f76_19(int x) { return x * 19; }
+inline int f76_20(int x) { return x * 20; }
+inline int f76_21(int x) { return x * 21; }
+inline int f76_22(int x) { return x * 22; }
+inline int f76_23(int x) { return x * 23; }
+inline int f76_24(int x) { return x * 24; }
+inline int f76_25(int x) { return x * 25; }
+inline int f76_26(int x) { return x * 26; }
+inline int f76_27(int x) { return x * 27; }
+inline int f76_28(int x) { return x * 28; }
+inline int f76_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 760 */
+#include <vector>
+#include "h3636.h"
+#include "h8729.h"
+#include "h3629.h"
+#include "h1367.h"
+#include "h4120.h"
+#ifdef X
+#include "h9082.h"
+#endif
+struct S760 { int a; const char *s = "x//y"; };
+inline int f760_0(int x) { return x * 0; }
+inline int f760_1(int x) { return x * 1; }
+inline int f760_2(int x) { return x * 2; }
+inline int f760_3(int x) { return x * 3; }
+inline int f760_4(int x) { return x * 4; }
+inline int f760_5(int x) { return x * 5; }
+inline int f760_6(int x) { return x * 6; }
+inline int f760_7(int x) { return x * 7; }
+inline int f760_8(int x) { return x * 8; }
+inline int f760_9(int x) { return x * 9; }
+inline int f760_10(int x) { return x * 10; }
+inline int f760_11(int x) { return x * 11; }
+inline int f760_12(int x) { return x * 12; }
+inline int f760_13(int x) { return x * 13; }
+inline int f760_14(int x) { return x * 14; }
+inline int f760_15(int x) { return x * 15; }
+inline int f760_16(int x) { return x * 16; }
+inline int f760_17(int x) { return x * 17; }
+inline int f760_18(int x) { return x * 18; }
+inline int f760_19(int x) { return x * 19; }
+inline int f760_20(int x) { return x * 20; }
+inline int f760_21(int x) { return x * 21; }
+inline int f760_22(int x) { return x * 22; }
+inline int f760_23(int x) { return x * 23; }
+inline int f760_24(int x) { return x * 24; }
+inline int f760_25(int x) { return x * 25; }
+inline int f760_26(int x) { return x * 26; }
+inline int f760_27(int x) { return x * 27; }
+inline int f760_28(int x) { return x * 28; }
+inline int f760_29(int x) { return x * 29; }
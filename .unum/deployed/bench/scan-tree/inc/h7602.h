@@ -0,0 +1,42 @@
+#pragma once
+/* header 7602 */
+#include <vector>
+#include "h588.h"
+#include "h9240.h"
+#include "h3667.h"
+#include "h5290.h"
+#include "h3264.h"
+#ifdef X
+#include "h4634.h"
+#endif
+struct S7602 { int a; const char *s = "x//y"; };
+inline int f7602_0(int x) { return x * 0; }
+inline int f7602_1(int x) { return x * 1; }
+inline int f7602_2(int x) { return x * 2; }
+inline int f7602_3(int x) { return x * 3; }
+inline int f7602_4(int x) { return x * 4; }
+inline int f7602_5(int x) { return x * 5; }
+inline int f7602_6(int x) { return x * 6; }
+inline int f7602_7(int x) { return x * 7; }
+inline int f7602_8(int x) { return x * 8; }
+inline int f7602_9(int x) { return x * 9; }
+inline int f7602_10(int x) { return x * 10; }
+inline int f7602_11(int x) { return x * 11; }
+inline int f7602_12(int x) { return x * 12; }
+inline int f7602_13(int x) { return x * 13; }
+inline int f7602_14(int x) { return x * 14; }
+inline int f7602_15(int x) { return x * 15; }
+inline int f7602_16(int x) { return x * 16; }
+inline int f7602_17(int x) { return x * 17; }
+inline int f7602_18(int x) { return x * 18; }
+inline int f7602_19(int x) { return x * 19; }
+inline int f7602_20(int x) { return x * 20; }
+inline int f7602_21(int x) { return x * 21; }
+inline int f7602_22(int x) { return x * 22; }
+inline int f7602_23(int x) { return x * 23; }
+inline int f7602_24(int x) { return x * 24; }
+inline int f7602_25(int x) { return x * 25; }
+inline int f7602_26(int x) { return x * 26; }
+inline int f7602_27(int x) { return x * 27; }
+inline int f7602_28(int x) { return x * 28; }
+inline int f7602_29(int x) { return x * 29; }
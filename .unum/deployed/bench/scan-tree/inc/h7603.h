@@ -0,0 +1,42 @@
+#pragma once
+/* header 7603 */
+#include <vector>
+#include "h1601.h"
+#include "h9856.h"
+#include "h333.h"
+#include "h8847.h"
+#include "h7584.h"
+#ifdef X
+#include "h8556.h"
+#endif
+struct S7603 { int a; const char *s = "x//y"; };
+inline int f7603_0(int x) { return x * 0; }
+inline int f7603_1(int x) { return x * 1; }
+inline int f7603_2(int x) { return x * 2; }
+inline int f7603_3(int x) { return x * 3; }
+inline int f7603_4(int x) { return x * 4; }
+inline int f7603_5(int x) { return x * 5; }
+inline int f7603_6(int x) { return x * 6; }
+inline int f7603_7(int x) { return x * 7; }
+inline int f7603_8(int x) { return x * 8; }
+inline int f7603_9(int x) { return x * 9; }
+inline int f7603_10(int x) { return x * 10; }
+inline int f7603_11(int x) { return x * 11; }
+inline int f7603_12(int x) { return x * 12; }
+inline int f7603_13(int x) { return x * 13; }
+inline int f7603_14(int x) { return x * 14; }
+inline int f7603_15(int x) { return x * 15; }
+inline int f7603_16(int x) { return x * 16; }
+inline int f7603_17(int x) { return x * 17; }
+inline int f7603_18(int x) { return x * 18; }
+inline int f7603_19(int x) { return x * 19; }
+inline int f7603_20(int x) { return x * 20; }
+inline int f7603_21(int x) { return x * 21; }
+inline int f7603_22(int x) { return x * 22; }
+inline int f7603_23(int x) { return x * 23; }
+inline int f7603_24(int x) { return x * 24; }
+inline int f7603_25(int x) { return x * 25; }
+inline int f7603_26(int x) { return x * 26; }
+inline int f7603_27(int x) { return x * 27; }
+inline int f7603_28(int x) { return x * 28; }
+inline int f7603_29(int x) { return x * 29; }
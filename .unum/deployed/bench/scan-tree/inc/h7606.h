@@ -0,0 +1,42 @@
+#pragma once
+/* header 7606 */
+#include <vector>
+#include "h3497.h"
+#include "h9627.h"
+#include "h3482.h"
+#include "h8889.h"
+#include "h6222.h"
+#ifdef X
+#include "h5604.h"
+#endif
+struct S7606 { int a; const char *s = "x//y"; };
+inline int f7606_0(int x) { return x * 0; }
+inline int f7606_1(int x) { return x * 1; }
+inline int f7606_2(int x) { return x * 2; }
+inline int f7606_3(int x) { return x * 3; }
+inline int f7606_4(int x) { return x * 4; }
+inline int f7606_5(int x) { return x * 5; }
+inline int f7606_6(int x) { return x * 6; }
+inline int f7606_7(int x) { return x * 7; }
+inline int f7606_8(int x) { return x * 8; }
+inline int f7606_9(int x) { return x * 9; }
+inline int f7606_10(int x) { return x * 10; }
+inline int f7606_11(int x) { return x * 11; }
+inline int f7606_12(int x) { return x * 12; }
+inline int f7606_13(int x) { return x * 13; }
+inline int f7606_14(int x) { return x * 14; }
+inline int f7606_15(int x) { return x * 15; }
+inline int f7606_16(int x) { return x * 16; }
+inline int f7606_17(int x) { return x * 17; }
+inline int f7606_18(int x) { return x * 18; }
+inline int f7606_19(int x) { return x * 19; }
+inline int f7606_20(int x) { return x * 20; }
+inline int f7606_21(int x) { return x * 21; }
+inline int f7606_22(int x) { return x * 22; }
+inline int f7606_23(int x) { return x * 23; }
+inline int f7606_24(int x) { return x * 24; }
+inline int f7606_25(int x) { return x * 25; }
+inline int f7606_26(int x) { return x * 26; }
+inline int f7606_27(int x) { return x * 27; }
+inline int f7606_28(int x) { return x * 28; }
+inline int f7606_29(int x) { return x * 29; }
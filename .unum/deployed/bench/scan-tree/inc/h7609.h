@@ -0,0 +1,42 @@
+#pragma once
+/* header 7609 */
+#include <vector>
+#include "h7492.h"
+#include "h8839.h"
+#include "h1935.h"
+#include "h9883.h"
+#include "h8762.h"
+#ifdef X
+#include "h6454.h"
+#endif
+struct S7609 { int a; const char *s = "x//y"; };
+inline int f7609_0(int x) { return x * 0; }
+inline int f7609_1(int x) { return x * 1; }
+inline int f7609_2(int x) { return x * 2; }
+inline int f7609_3(int x) { return x * 3; }
+inline int f7609_4(int x) { return x * 4; }
+inline int f7609_5(int x) { return x * 5; }
+inline int f7609_6(int x) { return x * 6; }
+inline int f7609_7(int x) { return x * 7; }
+inline int f7609_8(int x) { return x * 8; }
+inline int f7609_9(int x) { return x * 9; }
+inline int f7609_10(int x) { return x * 10; }
+inline int f7609_11(int x) { return x * 11; }
+inline int f7609_12(int x) { return x * 12; }
+inline int f7609_13(int x) { return x * 13; }
+inline int f7609_14(int x) { return x * 14; }
+inline int f7609_15(int x) { return x * 15; }
+inline int f7609_16(int x) { return x * 16; }
+inline int f7609_17(int x) { return x * 17; }
+inline int f7609_18(int x) { return x * 18; }
+inline int f7609_19(int x) { return x * 19; }
+inline int f7609_20(int x) { return x * 20; }
+inline int f7609_21(int x) { return x * 21; }
+inline int f7609_22(int x) { return x * 22; }
+inline int f7609_23(int x) { return x * 23; }
+inline int f7609_24(int x) { return x * 24; }
+inline int f7609_25(int x) { return x * 25; }
+inline int f7609_26(int x) { return x * 26; }
+inline int f7609_27(int x) { return x * 27; }
+inline int f7609_28(int x) { return x * 28; }
+inline int f7609_29(int x) { return x * 29; }
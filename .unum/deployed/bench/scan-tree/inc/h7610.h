@@ -0,0 +1,42 @@
+#pragma once
+/* header 7610 */
+#include <vector>
+#include "h7753.h"
+#include "h2762.h"
+#include "h5603.h"
+#include "h8740.h"
+#include "h7387.h"
+#ifdef X
+#include "h5773.h"
+#endif
+struct S7610 { int a; const char *s = "x//y"; };
+inline int f7610_0(int x) { return x * 0; }
+inline int f7610_1(int x) { return x * 1; }
+inline int f7610_2(int x) { return x * 2; }
+inline int f7610_3(int x) { return x * 3; }
+inline int f7610_4(int x) { return x * 4; }
+inline int f7610_5(int x) { return x * 5; }
+inline int f7610_6(int x) { return x * 6; }
+inline int f7610_7(int x) { return x * 7; }
+inline int f7610_8(int x) { return x * 8; }
+inline int f7610_9(int x) { return x * 9; }
+inline int f7610_10(int x) { return x * 10; }
+inline int f7610_11(int x) { return x * 11; }
+inline int f7610_12(int x) { return x * 12; }
+inline int f7610_13(int x) { return x * 13; }
+inline int f7610_14(int x) { return x * 14; }
+inline int f7610_15(int x) { return x * 15; }
+inline int f7610_16(int x) { return x * 16; }
+inline int f7610_17(int x) { return x * 17; }
+inline int f7610_18(int x) { return x * 18; }
+inline int f7610_19(int x) { return x * 19; }
+inline int f7610_20(int x) { return x * 20; }
+inline int f7610_21(int x) { return x * 21; }
+inline int f7610_22(int x) { return x * 22; }
+inline int f7610_23(int x) { return x * 23; }
+inline int f7610_24(int x) { return x * 24; }
+inline int f7610_25(int x) { return x * 25; }
+inline int f7610_26(int x) { return x * 26; }
+inline int f7610_27(int x) { return x * 27; }
+inline int f7610_28(int x) { return x * 28; }
+inline int f7610_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7611 */
+#include <vector>
+#include "h7438.h"
+#include "h3233.h"
+#include "h5878.h"
+#include "h499.h"
+#include "h5530.h"
+#ifdef X
+#include "h2555.h"
+#endif
+struct S7611 { int a; const char *s = "x//y"; };
+inline int f7611_0(int x) { return x * 0; }
+inline int f7611_1(int x) { return x * 1; }
+inline int f7611_2(int x) { return x * 2; }
+inline int f7611_3(int x) { return x * 3; }
+inline int f7611_4(int x) { return x * 4; }
+inline int f7611_5(int x) { return x * 5; }
+inline int f7611_6(int x) { return x * 6; }
+inline int f7611_7(int x) { return x * 7; }
+inline int f7611_8(int x) { return x * 8; }
+inline int f7611_9(int x) { return x * 9; }
+inline int f7611_10(int x) { return x * 10; }
+inline int f7611_11(int x) { return x * 11; }
+inline int f7611_12(int x) { return x * 12; }
+inline int f7611_13(int x) { return x * 13; }
+inline int f7611_14(int x) { return x * 14; }
+inline int f7611_15(int x) { return x * 15; }
+inline int f7611_16(int x) { return x * 16; }
+inline int f7611_17(int x) { return x * 17; }
+inline int f7611_18(int x) { return x * 18; }
+inline int f7611_19(int x) { return x * 19; }
+inline int f7611_20(int x) { return x * 20; }
+inline int f7611_21(int x) { return x * 21; }
+inline int f7611_22(int x) { return x * 22; }
+inline int f7611_23(int x) { return x * 23; }
+inline int f7611_24(int x) { return x * 24; }
+inline int f7611_25(int x) { return x * 25; }
+inline int f7611_26(int x) { return x * 26; }
+inline int f7611_27(int x) { return x * 27; }
+inline int f7611_28(int x) { return x * 28; }
+inline int f7611_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7612 */
+#include <vector>
+#include "h4485.h"
+#include "h3980.h"
+#include "h8846.h"
+#include "h3172.h"
+#include "h6680.h"
+#ifdef X
+#include "h2777.h"
+#endif
+struct S7612 { int a; const char *s = "x//y"; };
+inline int f7612_0(int x) { return x * 0; }
+inline int f7612_1(int x) { return x * 1; }
+inline int f7612_2(int x) { return x * 2; }
+inline int f7612_3(int x) { return x * 3; }
+inline int f7612_4(int x) { return x * 4; }
+inline int f7612_5(int x) { return x * 5; }
+inline int f7612_6(int x) { return x * 6; }
+inline int f7612_7(int x) { return x * 7; }
+inline int f7612_8(int x) { return x * 8; }
+inline int f7612_9(int x) { return x * 9; }
+inline int f7612_10(int x) { return x * 10; }
+inline int f7612_11(int x) { return x * 11; }
+inline int f7612_12(int x) { return x * 12; }
+inline int f7612_13(int x) { return x * 13; }
+inline int f7612_14(int x) { return x * 14; }
+inline int f7612_15(int x) { return x * 15; }
+inline int f7612_16(int x) { return x * 16; }
+inline int f7612_17(int x) { return x * 17; }
+inline int f7612_18(int x) { return x * 18; }
+inline int f7612_19(int x) { return x * 19; }
+inline int f7612_20(int x) { return x * 20; }
+inline int f7612_21(int x) { return x * 21; }
+inline int f7612_22(int x) { return x * 22; }
+inline int f7612_23(int x) { return x * 23; }
+inline int f7612_24(int x) { return x * 24; }
+inline int f7612_25(int x) { return x * 25; }
+inline int f7612_26(int x) { return x * 26; }
+inline int f7612_27(int x) { return x * 27; }
+inline int f7612_28(int x) { return x * 28; }
+inline int f7612_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7614 */
+#include <vector>
+#include "h2488.h"
+#include "h2092.h"
+#include "h1838.h"
+#include "h9296.h"
+#include "h4025.h"
+#ifdef X
+#include "h8132.h"
+#endif
+struct S7614 { int a; const char *s = "x//y"; };
+inline int f7614_0(int x) { return x * 0; }
+inline int f7614_1(int x) { return x * 1; }
+inline int f7614_2(int x) { return x * 2; }
+inline int f7614_3(int x) { return x * 3; }
+inline int f7614_4(int x) { return x * 4; }
+inline int f7614_5(int x) { return x * 5; }
+inline int f7614_6(int x) { return x * 6; }
+inline int f7614_7(int x) { return x * 7; }
+inline int f7614_8(int x) { return x * 8; }
+inline int f7614_9(int x) { return x * 9; }
+inline int f7614_10(int x) { return x * 10; }
+inline int f7614_11(int x) { return x * 11; }
+inline int f7614_12(int x) { return x * 12; }
+inline int f7614_13(int x) { return x * 13; }
+inline int f7614_14(int x) { return x * 14; }
+inline int f7614_15(int x) { return x * 15; }
+inline int f7614_16(int x) { return x * 16; }
+inline int f7614_17(int x) { return x * 17; }
+inline int f7614_18(int x) { return x * 18; }
+inline int f7614_19(int x) { return x * 19; }
+inline int f7614_20(int x) { return x * 20; }
+inline int f7614_21(int x) { return x * 21; }
+inline int f7614_22(int x) { return x * 22; }
+inline int f7614_23(int x) { return x * 23; }
+inline int f7614_24(int x) { return x * 24; }
+inline int f7614_25(int x) { return x * 25; }
+inline int f7614_26(int x) { return x * 26; }
+inline int f7614_27(int x) { return x * 27; }
+inline int f7614_28(int x) { return x * 28; }
+inline int f7614_29(int x) { return x * 29; }
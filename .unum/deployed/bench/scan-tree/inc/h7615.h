@@ -0,0 +1,42 @@
+#pragma once
+/* header 7615 */
+#include <vector>
+#include "h8172.h"
+#include "h3821.h"
+#include "h3716.h"
+#include "h8201.h"
+#include "h109.h"
+#ifdef X
+#include "h343.h"
+#endif
+struct S7615 { int a; const char *s = "x//y"; };
+inline int f7615_0(int x) { return x * 0; }
+inline int f7615_1(int x) { return x * 1; }
+inline int f7615_2(int x) { return x * 2; }
+inline int f7615_3(int x) { return x * 3; }
+inline int f7615_4(int x) { return x * 4; }
+inline int f7615_5(int x) { return x * 5; }
+inline int f7615_6(int x) { return x * 6; }
+inline int f7615_7(int x) { return x * 7; }
+inline int f7615_8(int x) { return x * 8; }
+inline int f7615_9(int x) { return x * 9; }
+inline int f7615_10(int x) { return x * 10; }
+inline int f7615_11(int x) { return x * 11; }
+inline int f7615_12(int x) { return x * 12; }
+inline int f7615_13(int x) { return x * 13; }
+inline int f7615_14(int x) { return x * 14; }
+inline int f7615_15(int x) { return x * 15; }
+inline int f7615_16(int x) { return x * 16; }
+inline int f7615_17(int x) { return x * 17; }
+inline int f7615_18(int x) { return x * 18; }
+inline int f7615_19(int x) { return x * 19; }
+inline int f7615_20(int x) { return x * 20; }
+inline int f7615_21(int x) { return x * 21; }
+inline int f7615_22(int x) { return x * 22; }
+inline int f7615_23(int x) { return x * 23; }
+inline int f7615_24(int x) { return x * 24; }
+inline int f7615_25(int x) { return x * 25; }
+inline int f7615_26(int x) { return x * 26; }
+inline int f7615_27(int x) { return x * 27; }
+inline int f7615_28(int x) { return x * 28; }
+inline int f7615_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7616 */
+#include <vector>
+#include "h4961.h"
+#include "h2122.h"
+#include "h7974.h"
+#include "h8460.h"
+#include "h2952.h"
+#ifdef X
+#include "h6122.h"
+#endif
+struct S7616 { int a; const char *s = "x//y"; };
+inline int f7616_0(int x) { return x * 0; }
+inline int f7616_1(int x) { return x * 1; }
+inline int f7616_2(int x) { return x * 2; }
+inline int f7616_3(int x) { return x * 3; }
+inline int f7616_4(int x) { return x * 4; }
+inline int f7616_5(int x) { return x * 5; }
+inline int f7616_6(int x) { return x * 6; }
+inline int f7616_7(int x) { return x * 7; }
+inline int f7616_8(int x) { return x * 8; }
+inline int f7616_9(int x) { return x * 9; }
+inline int f7616_10(int x) { return x * 10; }
+inline int f7616_11(int x) { return x * 11; }
+inline int f7616_12(int x) { return x * 12; }
+inline int f7616_13(int x) { return x * 13; }
+inline int f7616_14(int x) { return x * 14; }
+inline int f7616_15(int x) { return x * 15; }
+inline int f7616_16(int x) { return x * 16; }
+inline int f7616_17(int x) { return x * 17; }
+inline int f7616_18(int x) { return x * 18; }
+inline int f7616_19(int x) { return x * 19; }
+inline int f7616_20(int x) { return x * 20; }
+inline int f7616_21(int x) { return x * 21; }
+inline int f7616_22(int x) { return x * 22; }
+inline int f7616_23(int x) { return x * 23; }
+inline int f7616_24(int x) { return x * 24; }
+inline int f7616_25(int x) { return x * 25; }
+inline int f7616_26(int x) { return x * 26; }
+inline int f7616_27(int x) { return x * 27; }
+inline int f7616_28(int x) { return x * 28; }
+inline int f7616_29(int x) { return x * 29; }
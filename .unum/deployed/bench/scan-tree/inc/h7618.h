@@ -0,0 +1,42 @@
+#pragma once
+/* header 7618 */
+#include <vector>
+#include "h4760.h"
+#include "h3393.h"
+#include "h9126.h"
+#include "h9435.h"
+#include "h2759.h"
+#ifdef X
+#include "h122.h"
+#endif
+struct S7618 { int a; const char *s = "x//y"; };
+inline int f7618_0(int x) { return x * 0; }
+inline int f7618_1(int x) { return x * 1; }
+inline int f7618_2(int x) { return x * 2; }
+inline int f7618_3(int x) { return x * 3; }
+inline int f7618_4(int x) { return x * 4; }
+inline int f7618_5(int x) { return x * 5; }
+inline int f7618_6(int x) { return x * 6; }
+inline int f7618_7(int x) { return x * 7; }
+inline int f7618_8(int x) { return x * 8; }
+inline int f7618_9(int x) { return x * 9; }
+inline int f7618_10(int x) { return x * 10; }
+inline int f7618_11(int x) { return x * 11; }
+inline int f7618_12(int x) { return x * 12; }
+inline int f7618_13(int x) { return x * 13; }
+inline int f7618_14(int x) { return x * 14; }
+inline int f7618_15(int x) { return x * 15; }
+inline int f7618_16(int x) { return x * 16; }
+inline int f7618_17(int x) { return x * 17; }
+inline int f7618_18(int x) { return x * 18; }
+inline int f7618_19(int x) { return x * 19; }
+inline int f7618_20(int x) { return x * 20; }
+inline int f7618_21(int x) { return x * 21; }
+inline int f7618_22(int x) { return x * 22; }
+inline int f7618_23(int x) { return x * 23; }
+inline int f7618_24(int x) { return x * 24; }
+inline int f7618_25(int x) { return x * 25; }
+inline int f7618_26(int x) { return x * 26; }
+inline int f7618_27(int x) { return x * 27; }
+inline int f7618_28(int x) { return x * 28; }
+inline int f7618_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 762 */
+#include <vector>
+#include "h1772.h"
+#include "h3943.h"
+#include "h5992.h"
+#include "h4779.h"
+#include "h8852.h"
+#ifdef X
+#include "h9747.h"
+#endif
+struct S762 { int a; const char *s = "x//y"; };
+inline int f762_0(int x) { return x * 0; }
+inline int f762_1(int x) { return x * 1; }
+inline int f762_2(int x) { return x * 2; }
+inline int f762_3(int x) { return x * 3; }
+inline int f762_4(int x) { return x * 4; }
+inline int f762_5(int x) { return x * 5; }
+inline int f762_6(int x) { return x * 6; }
+inline int f762_7(int x) { return x * 7; }
+inline int f762_8(int x) { return x * 8; }
+inline int f762_9(int x) { return x * 9; }
+inline int f762_10(int x) { return x * 10; }
+inline int f762_11(int x) { return x * 11; }
+inline int f762_12(int x) { return x * 12; }
+inline int f762_13(int x) { return x * 13; }
+inline int f762_14(int x) { return x * 14; }
+inline int f762_15(int x) { return x * 15; }
+inline int f762_16(int x) { return x * 16; }
+inline int f762_17(int x) { return x * 17; }
+inline int f762_18(int x) { return x * 18; }
+inline int f762_19(int x) { return x * 19; }
+inline int f762_20(int x) { return x * 20; }
+inline int f762_21(int x) { return x * 21; }
+inline int f762_22(int x) { return x * 22; }
+inline int f762_23(int x) { return x * 23; }
+inline int f762_24(int x) { return x * 24; }
+inline int f762_25(int x) { return x * 25; }
+inline int f762_26(int x) { return x * 26; }
+inline int f762_27(int x) { return x * 27; }
+inline int f762_28(int x) { return x * 28; }
+inline int f762_29(int x) { return x * 29; }
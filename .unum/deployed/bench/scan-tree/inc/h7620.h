@@ -0,0 +1,42 @@
+#pragma once
+/* header 7620 */
+#include <vector>
+#include "h7639.h"
+#include "h5897.h"
+#include "h3211.h"
+#include "h9423.h"
+#include "h8782.h"
+#ifdef X
+#include "h8000.h"
+#endif
+struct S7620 { int a; const char *s = "x//y"; };
+inline int f7620_0(int x) { return x * 0; }
+inline int f7620_1(int x) { return x * 1; }
+inline int f7620_2(int x) { return x * 2; }
+inline int f7620_3(int x) { return x * 3; }
+inline int f7620_4(int x) { return x * 4; }
+inline int f7620_5(int x) { return x * 5; }
+inline int f7620_6(int x) { return x * 6; }
+inline int f7620_7(int x) { return x * 7; }
+inline int f7620_8(int x) { return x * 8; }
+inline int f7620_9(int x) { return x * 9; }
+inline int f7620_10(int x) { return x * 10; }
+inline int f7620_11(int x) { return x * 11; }
+inline int f7620_12(int x) { return x * 12; }
+inline int f7620_13(int x) { return x * 13; }
+inline int f7620_14(int x) { return x * 14; }
+inline int f7620_15(int x) { return x * 15; }
+inline int f7620_16(int x) { return x * 16; }
+inline int f7620_17(int x) { return x * 17; }
+inline int f7620_18(int x) { return x * 18; }
+inline int f7620_19(int x) { return x * 19; }
+inline int f7620_20(int x) { return x * 20; }
+inline int f7620_21(int x) { return x * 21; }
+inline int f7620_22(int x) { return x * 22; }
+inline int f7620_23(int x) { return x * 23; }
+inline int f7620_24(int x) { return x * 24; }
+inline int f7620_25(int x) { return x * 25; }
+inline int f7620_26(int x) { return x * 26; }
+inline int f7620_27(int x) { return x * 27; }
+inline int f7620_28(int x) { return x * 28; }
+inline int f7620_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7621 */
+#include <vector>
+#include "h3949.h"
+#include "h2227.h"
+#include "h1059.h"
+#include "h9821.h"
+#include "h8704.h"
+#ifdef X
+#include "h1885.h"
+#endif
+struct S7621 { int a; const char *s = "x//y"; };
+inline int f7621_0(int x) { return x * 0; }
+inline int f7621_1(int x) { return x * 1; }
+inline int f7621_2(int x) { return x * 2; }
+inline int f7621_3(int x) { return x * 3; }
+inline int f7621_4(int x) { return x * 4; }
+inline int f7621_5(int x) { return x * 5; }
+inline int f7621_6(int x) { return x * 6; }
+inline int f7621_7(int x) { return x * 7; }
+inline int f7621_8(int x) { return x * 8; }
+inline int f7621_9(int x) { return x * 9; }
+inline int f7621_10(int x) { return x * 10; }
+inline int f7621_11(int x) { return x * 11; }
+inline int f7621_12(int x) { return x * 12; }
+inline int f7621_13(int x) { return x * 13; }
+inline int f7621_14(int x) { return x * 14; }
+inline int f7621_15(int x) { return x * 15; }
+inline int f7621_16(int x) { return x * 16; }
+inline int f7621_17(int x) { return x * 17; }
+inline int f7621_18(int x) { return x * 18; }
+inline int f7621_19(int x) { return x * 19; }
+inline int f7621_20(int x) { return x * 20; }
+inline int f7621_21(int x) { return x * 21; }
+inline int f7621_22(int x) { return x * 22; }
+inline int f7621_23(int x) { return x * 23; }
+inline int f7621_24(int x) { return x * 24; }
+inline int f7621_25(int x) { return x * 25; }
+inline int f7621_26(int x) { return x * 26; }
+inline int f7621_27(int x) { return x * 27; }
+inline int f7621_28(int x) { return x * 28; }
+inline int f7621_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7622 */
+#include <vector>
+#include "h2537.h"
+#include "h2150.h"
+#include "h8006.h"
+#include "h1145.h"
+#include "h5376.h"
+#ifdef X
+#include "h2785.h"
+#endif
+struct S7622 { int a; const char *s = "x//y"; };
+inline int f7622_0(int x) { return x * 0; }
+inline int f7622_1(int x) { return x * 1; }
+inline int f7622_2(int x) { return x * 2; }
+inline int f7622_3(int x) { return x * 3; }
+inline int f7622_4(int x) { return x * 4; }
+inline int f7622_5(int x) { return x * 5; }
+inline int f7622_6(int x) { return x * 6; }
+inline int f7622_7(int x) { return x * 7; }
+inline int f7622_8(int x) { return x * 8; }
+inline int f7622_9(int x) { return x * 9; }
+inline int f7622_10(int x) { return x * 10; }
+inline int f7622_11(int x) { return x * 11; }
+inline int f7622_12(int x) { return x * 12; }
+inline int f7622_13(int x) { return x * 13; }
+inline int f7622_14(int x) { return x * 14; }
+inline int f7622_15(int x) { return x * 15; }
+inline int f7622_16(int x) { return x * 16; }
+inline int f7622_17(int x) { return x * 17; }
+inline int f7622_18(int x) { return x * 18; }
+inline int f7622_19(int x) { return x * 19; }
+inline int f7622_20(int x) { return x * 20; }
+inline int f7622_21(int x) { return x * 21; }
+inline int f7622_22(int x) { return x * 22; }
+inline int f7622_23(int x) { return x * 23; }
+inline int f7622_24(int x) { return x * 24; }
+inline int f7622_25(int x) { return x * 25; }
+inline int f7622_26(int x) { return x * 26; }
+inline int f7622_27(int x) { return x * 27; }
+inline int f7622_28(int x) { return x * 28; }
+inline int f7622_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7624 */
+#include <vector>
+#include "h6297.h"
+#include "h9104.h"
+#include "h8464.h"
+#include "h5252.h"
+#include "h9832.h"
+#ifdef X
+#include "h3629.h"
+#endif
+struct S7624 { int a; const char *s = "x//y"; };
+inline int f7624_0(int x) { return x * 0; }
+inline int f7624_1(int x) { return x * 1; }
+inline int f7624_2(int x) { return x * 2; }
+inline int f7624_3(int x) { return x * 3; }
+inline int f7624_4(int x) { return x * 4; }
+inline int f7624_5(int x) { return x * 5; }
+inline int f7624_6(int x) { return x * 6; }
+inline int f7624_7(int x) { return x * 7; }
+inline int f7624_8(int x) { return x * 8; }
+inline int f7624_9(int x) { return x * 9; }
+inline int f7624_10(int x) { return x * 10; }
+inline int f7624_11(int x) { return x * 11; }
+inline int f7624_12(int x) { return x * 12; }
+inline int f7624_13(int x) { return x * 13; }
+inline int f7624_14(int x) { return x * 14; }
+inline int f7624_15(int x) { return x * 15; }
+inline int f7624_16(int x) { return x * 16; }
+inline int f7624_17(int x) { return x * 17; }
+inline int f7624_18(int x) { return x * 18; }
+inline int f7624_19(int x) { return x * 19; }
+inline int f7624_20(int x) { return x * 20; }
+inline int f7624_21(int x) { return x * 21; }
+inline int f7624_22(int x) { return x * 22; }
+inline int f7624_23(int x) { return x * 23; }
+inline int f7624_24(int x) { return x * 24; }
+inline int f7624_25(int x) { return x * 25; }
+inline int f7624_26(int x) { return x * 26; }
+inline int f7624_27(int x) { return x * 27; }
+inline int f7624_28(int x) { return x * 28; }
+inline int f7624_29(int x) { return x * 29; }
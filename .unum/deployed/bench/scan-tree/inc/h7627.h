@@ -0,0 +1,42 @@
+#pragma once
+/* header 7627 */
+#include <vector>
+#include "h638.h"
+#include "h4723.h"
+#include "h997.h"
+#include "h80.h"
+#include "h5181.h"
+#ifdef X
+#include "h9246.h"
+#endif
+struct S7627 { int a; const char *s = "x//y"; };
+inline int f7627_0(int x) { return x * 0; }
+inline int f7627_1(int x) { return x * 1; }
+inline int f7627_2(int x) { return x * 2; }
+inline int f7627_3(int x) { return x * 3; }
+inline int f7627_4(int x) { return x * 4; }
+inline int f7627_5(int x) { return x * 5; }
+inline int f7627_6(int x) { return x * 6; }
+inline int f7627_7(int x) { return x * 7; }
+inline int f7627_8(int x) { return x * 8; }
+inline int f7627_9(int x) { return x * 9; }
+inline int f7627_10(int x) { return x * 10; }
+inline int f7627_11(int x) { return x * 11; }
+inline int f7627_12(int x) { return x * 12; }
+inline int f7627_13(int x) { return x * 13; }
+inline int f7627_14(int x) { return x * 14; }
+inline int f7627_15(int x) { return x * 15; }
+inline int f7627_16(int x) { return x * 16; }
+inline int f7627_17(int x) { return x * 17; }
+inline int f7627_18(int x) { return x * 18; }
+inline int f7627_19(int x) { return x * 19; }
+inline int f7627_20(int x) { return x * 20; }
+inline int f7627_21(int x) { return x * 21; }
+inline int f7627_22(int x) { return x * 22; }
+inline int f7627_23(int x) { return x * 23; }
+inline int f7627_24(int x) { return x * 24; }
+inline int f7627_25(int x) { return x * 25; }
+inline int f7627_26(int x) { return x * 26; }
+inline int f7627_27(int x) { return x * 27; }
+inline int f7627_28(int x) { return x * 28; }
+inline int f7627_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7629 */
+#include <vector>
+#include "h6376.h"
+#include "h9578.h"
+#include "h7957.h"
+#include "h645.h"
+#include "h7012.h"
+#ifdef X
+#include "h1594.h"
+#endif
+struct S7629 { int a; const char *s = "x//y"; };
+inline int f7629_0(int x) { return x * 0; }
+inline int f7629_1(int x) { return x * 1; }
+inline int f7629_2(int x) { return x * 2; }
+inline int f7629_3(int x) { return x * 3; }
+inline int f7629_4(int x) { return x * 4; }
+inline int f7629_5(int x) { return x * 5; }
+inline int f7629_6(int x) { return x * 6; }
+inline int f7629_7(int x) { return x * 7; }
+inline int f7629_8(int x) { return x * 8; }
+inline int f7629_9(int x) { return x * 9; }
+inline int f7629_10(int x) { return x * 10; }
+inline int f7629_11(int x) { return x * 11; }
+inline int f7629_12(int x) { return x * 12; }
+inline int f7629_13(int x) { return x * 13; }
+inline int f7629_14(int x) { return x * 14; }
+inline int f7629_15(int x) { return x * 15; }
+inline int f7629_16(int x) { return x * 16; }
+inline int f7629_17(int x) { return x * 17; }
+inline int f7629_18(int x) { return x * 18; }
+inline int f7629_19(int x) { return x * 19; }
+inline int f7629_20(int x) { return x * 20; }
+inline int f7629_21(int x) { return x * 21; }
+inline int f7629_22(int x) { return x * 22; }
+inline int f7629_23(int x) { return x * 23; }
+inline int f7629_24(int x) { return x * 24; }
+inline int f7629_25(int x) { return x * 25; }
+inline int f7629_26(int x) { return x * 26; }
+inline int f7629_27(int x) { return x * 27; }
+inline int f7629_28(int x) { return x * 28; }
+inline int f7629_29(int x) { return x * 29; }
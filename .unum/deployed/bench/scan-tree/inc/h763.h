@@ -0,0 +1,42 @@
+#pragma once
+/* header 763 */
+#include <vector>
+#include "h4648.h"
+#include "h5394.h"
+#include "h6852.h"
+#include "h6236.h"
+#include "h2789.h"
+#ifdef X
+#include "h331.h"
+#endif
+struct S763 { int a; const char *s = "x//y"; };
+inline int f763_0(int x) { return x * 0; }
+inline int f763_1(int x) { return x * 1; }
+inline int f763_2(int x) { return x * 2; }
+inline int f763_3(int x) { return x * 3; }
+inline int f763_4(int x) { return x * 4; }
+inline int f763_5(int x) { return x * 5; }
+inline int f763_6(int x) { return x * 6; }
+inline int f763_7(int x) { return x * 7; }
+inline int f763_8(int x) { return x * 8; }
+inline int f763_9(int x) { return x * 9; }
+inline int f763_10(int x) { return x * 10; }
+inline int f763_11(int x) { return x * 11; }
+inline int f763_12(int x) { return x * 12; }
+inline int f763_13(int x) { return x * 13; }
+inline int f763_14(int x) { return x * 14; }
+inline int f763_15(int x) { return x * 15; }
+inline int f763_16(int x) { return x * 16; }
+inline int f763_17(int x) { return x * 17; }
+inline int f763_18(int x) { return x * 18; }
+inline int f763_19(int x) { return x * 19; }
+inline int f763_20(int x) { return x * 20; }
+inline int f763_21(int x) { return x * 21; }
+inline int f763_22(int x) { return x * 22; }
+inline int f763_23(int x) { return x * 23; }
+inline int f763_24(int x) { return x * 24; }
+inline int f763_25(int x) { return x * 25; }
+inline int f763_26(int x) { return x * 26; }
+inline int f763_27(int x) { return x * 27; }
+inline int f763_28(int x) { return x * 28; }
+inline int f763_29(int x) { return x * 29; }
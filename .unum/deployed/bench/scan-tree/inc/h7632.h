@@ -0,0 +1,42 @@
+#pragma once
+/* header 7632 */
+#include <vector>
+#include "h1049.h"
+#include "h4749.h"
+#include "h5125.h"
+#include "h2931.h"
+#include "h5235.h"
+#ifdef X
+#include "h8857.h"
+#endif
+struct S7632 { int a; const char *s = "x//y"; };
+inline int f7632_0(int x) { return x * 0; }
+inline int f7632_1(int x) { return x * 1; }
+inline int f7632_2(int x) { return x * 2; }
+inline int f7632_3(int x) { return x * 3; }
+inline int f7632_4(int x) { return x * 4; }
+inline int f7632_5(int x) { return x * 5; }
+inline int f7632_6(int x) { return x * 6; }
+inline int f7632_7(int x) { return x * 7; }
+inline int f7632_8(int x) { return x * 8; }
+inline int f7632_9(int x) { return x * 9; }
+inline int f7632_10(int x) { return x * 10; }
+inline int f7632_11(int x) { return x * 11; }
+inline int f7632_12(int x) { return x * 12; }
+inline int f7632_13(int x) { return x * 13; }
+inline int f7632_14(int x) { return x * 14; }
+inline int f7632_15(int x) { return x * 15; }
+inline int f7632_16(int x) { return x * 16; }
+inline int f7632_17(int x) { return x * 17; }
+inline int f7632_18(int x) { return x * 18; }
+inline int f7632_19(int x) { return x * 19; }
+inline int f7632_20(int x) { return x * 20; }
+inline int f7632_21(int x) { return x * 21; }
+inline int f7632_22(int x) { return x * 22; }
+inline int f7632_23(int x) { return x * 23; }
+inline int f7632_24(int x) { return x * 24; }
+inline int f7632_25(int x) { return x * 25; }
+inline int f7632_26(int x) { return x * 26; }
+inline int f7632_27(int x) { return x * 27; }
+inline int f7632_28(int x) { return x * 28; }
+inline int f7632_29(int x) { return x * 29; }
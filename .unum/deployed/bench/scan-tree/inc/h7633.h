@@ -0,0 +1,42 @@
+#pragma once
+/* header 7633 */
+#include <vector>
+#include "h8924.h"
+#include "h9960.h"
+#include "h1895.h"
+#include "h8946.h"
+#include "h482.h"
+#ifdef X
+#include "h2340.h"
+#endif
+struct S7633 { int a; const char *s = "x//y"; };
+inline int f7633_0(int x) { return x * 0; }
+inline int f7633_1(int x) { return x * 1; }
+inline int f7633_2(int x) { return x * 2; }
+inline int f7633_3(int x) { return x * 3; }
+inline int f7633_4(int x) { return x * 4; }
+inline int f7633_5(int x) { return x * 5; }
+inline int f7633_6(int x) { return x * 6; }
+inline int f7633_7(int x) { return x * 7; }
+inline int f7633_8(int x) { return x * 8; }
+inline int f7633_9(int x) { return x * 9; }
+inline int f7633_10(int x) { return x * 10; }
+inline int f7633_11(int x) { return x * 11; }
+inline int f7633_12(int x) { return x * 12; }
+inline int f7633_13(int x) { return x * 13; }
+inline int f7633_14(int x) { return x * 14; }
+inline int f7633_15(int x) { return x * 15; }
+inline int f7633_16(int x) { return x * 16; }
+inline int f7633_17(int x) { return x * 17; }
+inline int f7633_18(int x) { return x * 18; }
+inline int f7633_19(int x) { return x * 19; }
+inline int f7633_20(int x) { return x * 20; }
+inline int f7633_21(int x) { return x * 21; }
+inline int f7633_22(int x) { return x * 22; }
+inline int f7633_23(int x) { return x * 23; }
+inline int f7633_24(int x) { return x * 24; }
+inline int f7633_25(int x) { return x * 25; }
+inline int f7633_26(int x) { return x * 26; }
+inline int f7633_27(int x) { return x * 27; }
+inline int f7633_28(int x) { return x * 28; }
+inline int f7633_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7636 */
+#include <vector>
+#include "h7223.h"
+#include "h8377.h"
+#include "h5755.h"
+#include "h8577.h"
+#include "h4896.h"
+#ifdef X
+#include "h4247.h"
+#endif
+struct S7636 { int a; const char *s = "x//y"; };
+inline int f7636_0(int x) { return x * 0; }
+inline int f7636_1(int x) { return x * 1; }
+inline int f7636_2(int x) { return x * 2; }
+inline int f7636_3(int x) { return x * 3; }
+inline int f7636_4(int x) { return x * 4; }
+inline int f7636_5(int x) { return x * 5; }
+inline int f7636_6(int x) { return x * 6; }
+inline int f7636_7(int x) { return x * 7; }
+inline int f7636_8(int x) { return x * 8; }
+inline int f7636_9(int x) { return x * 9; }
+inline int f7636_10(int x) { return x * 10; }
+inline int f7636_11(int x) { return x * 11; }
+inline int f7636_12(int x) { return x * 12; }
+inline int f7636_13(int x) { return x * 13; }
+inline int f7636_14(int x) { return x * 14; }
+inline int f7636_15(int x) { return x * 15; }
+inline int f7636_16(int x) { return x * 16; }
+inline int f7636_17(int x) { return x * 17; }
+inline int f7636_18(int x) { return x * 18; }
+inline int f7636_19(int x) { return x * 19; }
+inline int f7636_20(int x) { return x * 20; }
+inline int f7636_21(int x) { return x * 21; }
+inline int f7636_22(int x) { return x * 22; }
+inline int f7636_23(int x) { return x * 23; }
+inline int f7636_24(int x) { return x * 24; }
+inline int f7636_25(int x) { return x * 25; }
+inline int f7636_26(int x) { return x * 26; }
+inline int f7636_27(int x) { return x * 27; }
+inline int f7636_28(int x) { return x * 28; }
+inline int f7636_29(int x) { return x * 29; }
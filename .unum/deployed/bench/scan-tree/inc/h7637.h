@@ -0,0 +1,42 @@
+#pragma once
+/* header 7637 */
+#include <vector>
+#include "h5956.h"
+#include "h1529.h"
+#include "h1963.h"
+#include "h1724.h"
+#include "h5531.h"
+#ifdef X
+#include "h9654.h"
+#endif
+struct S7637 { int a; const char *s = "x//y"; };
+inline int f7637_0(int x) { return x * 0; }
+inline int f7637_1(int x) { return x * 1; }
+inline int f7637_2(int x) { return x * 2; }
+inline int f7637_3(int x) { return x * 3; }
+inline int f7637_4(int x) { return x * 4; }
+inline int f7637_5(int x) { return x * 5; }
+inline int f7637_6(int x) { return x * 6; }
+inline int f7637_7(int x) { return x * 7; }
+inline int f7637_8(int x) { return x * 8; }
+inline int f7637_9(int x) { return x * 9; }
+inline int f7637_10(int x) { return x * 10; }
+inline int f7637_11(int x) { return x * 11; }
+inline int f7637_12(int x) { return x * 12; }
+inline int f7637_13(int x) { return x * 13; }
+inline int f7637_14(int x) { return x * 14; }
+inline int f7637_15(int x) { return x * 15; }
+inline int f7637_16(int x) { return x * 16; }
+inline int f7637_17(int x) { return x * 17; }
+inline int f7637_18(int x) { return x * 18; }
+inline int f7637_19(int x) { return x * 19; }
+inline int f7637_20(int x) { return x * 20; }
+inline int f7637_21(int x) { return x * 21; }
+inline int f7637_22(int x) { return x * 22; }
+inline int f7637_23(int x) { return x * 23; }
+inline int f7637_24(int x) { return x * 24; }
+inline int f7637_25(int x) { return x * 25; }
+inline int f7637_26(int x) { return x * 26; }
+inline int f7637_27(int x) { return x * 27; }
+inline int f7637_28(int x) { return x * 28; }
+inline int f7637_29(int x) { return x * 29; }
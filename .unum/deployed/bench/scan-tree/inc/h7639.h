@@ -0,0 +1,42 @@
+#pragma once
+/* header 7639 */
+#include <vector>
+#include "h57.h"
+#include "h9458.h"
+#include "h504.h"
+#include "h9406.h"
+#include "h5173.h"
+#ifdef X
+#include "h1116.h"
+#endif
+struct S7639 { int a; const char *s = "x//y"; };
+inline int f7639_0(int x) { return x * 0; }
+inline int f7639_1(int x) { return x * 1; }
+inline int f7639_2(int x) { return x * 2; }
+inline int f7639_3(int x) { return x * 3; }
+inline int f7639_4(int x) { return x * 4; }
+inline int f7639_5(int x) { return x * 5; }
+inline int f7639_6(int x) { return x * 6; }
+inline int f7639_7(int x) { return x * 7; }
+inline int f7639_8(int x) { return x * 8; }
+inline int f7639_9(int x) { return x * 9; }
+inline int f7639_10(int x) { return x * 10; }
+inline int f7639_11(int x) { return x * 11; }
+inline int f7639_12(int x) { return x * 12; }
+inline int f7639_13(int x) { return x * 13; }
+inline int f7639_14(int x) { return x * 14; }
+inline int f7639_15(int x) { return x * 15; }
+inline int f7639_16(int x) { return x * 16; }
+inline int f7639_17(int x) { return x * 17; }
+inline int f7639_18(int x) { return x * 18; }
+inline int f7639_19(int x) { return x * 19; }
+inline int f7639_20(int x) { return x * 20; }
+inline int f7639_21(int x) { return x * 21; }
+inline int f7639_22(int x) { return x * 22; }
+inline int f7639_23(int x) { return x * 23; }
+inline int f7639_24(int x) { return x * 24; }
+inline int f7639_25(int x) { return x * 25; }
+inline int f7639_26(int x) { return x * 26; }
+inline int f7639_27(int x) { return x * 27; }
+inline int f7639_28(int x) { return x * 28; }
+inline int f7639_29(int x) { return x * 29; }
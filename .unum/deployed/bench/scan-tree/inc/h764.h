@@ -0,0 +1,42 @@
+#pragma once
+/* header 764 */
+#include <vector>
+#include "h5881.h"
+#include "h4639.h"
+#include "h1022.h"
+#include "h6637.h"
+#include "h9922.h"
+#ifdef X
+#include "h5766.h"
+#endif
+struct S764 { int a; const char *s = "x//y"; };
+inline int f764_0(int x) { return x * 0; }
+inline int f764_1(int x) { return x * 1; }
+inline int f764_2(int x) { return x * 2; }
+inline int f764_3(int x) { return x * 3; }
+inline int f764_4(int x) { return x * 4; }
+inline int f764_5(int x) { return x * 5; }
+inline int f764_6(int x) { return x * 6; }
+inline int f764_7(int x) { return x * 7; }
+inline int f764_8(int x) { return x * 8; }
+inline int f764_9(int x) { return x * 9; }
+inline int f764_10(int x) { return x * 10; }
+inline int f764_11(int x) { return x * 11; }
+inline int f764_12(int x) { return x * 12; }
+inline int f764_13(int x) { return x * 13; }
+inline int f764_14(int x) { return x * 14; }
+inline int f764_15(int x) { return x * 15; }
+inline int f764_16(int x) { return x * 16; }
+inline int f764_17(int x) { return x * 17; }
+inline int f764_18(int x) { return x * 18; }
+inline int f764_19(int x) { return x * 19; }
+inline int f764_20(int x) { return x * 20; }
+inline int f764_21(int x) { return x * 21; }
+inline int f764_22(int x) { return x * 22; }
+inline int f764_23(int x) { return x * 23; }
+inline int f764_24(int x) { return x * 24; }
+inline int f764_25(int x) { return x * 25; }
+inline int f764_26(int x) { return x * 26; }
+inline int f764_27(int x) { return x * 27; }
+inline int f764_28(int x) { return x * 28; }
+inline int f764_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7640 */
+#include <vector>
+#include "h3612.h"
+#include "h4109.h"
+#include "h1393.h"
+#include "h4437.h"
+#include "h1802.h"
+#ifdef X
+#include "h2439.h"
+#endif
+struct S7640 { int a; const char *s = "x//y"; };
+inline int f7640_0(int x) { return x * 0; }
+inline int f7640_1(int x) { return x * 1; }
+inline int f7640_2(int x) { return x * 2; }
+inline int f7640_3(int x) { return x * 3; }
+inline int f7640_4(int x) { return x * 4; }
+inline int f7640_5(int x) { return x * 5; }
+inline int f7640_6(int x) { return x * 6; }
+inline int f7640_7(int x) { return x * 7; }
+inline int f7640_8(int x) { return x * 8; }
+inline int f7640_9(int x) { return x * 9; }
+inline int f7640_10(int x) { return x * 10; }
+inline int f7640_11(int x) { return x * 11; }
+inline int f7640_12(int x) { return x * 12; }
+inline int f7640_13(int x) { return x * 13; }
+inline int f7640_14(int x) { return x * 14; }
+inline int f7640_15(int x) { return x * 15; }
+inline int f7640_16(int x) { return x * 16; }
+inline int f7640_17(int x) { return x * 17; }
+inline int f7640_18(int x) { return x * 18; }
+inline int f7640_19(int x) { return x * 19; }
+inline int f7640_20(int x) { return x * 20; }
+inline int f7640_21(int x) { return x * 21; }
+inline int f7640_22(int x) { return x * 22; }
+inline int f7640_23(int x) { return x * 23; }
+inline int f7640_24(int x) { return x * 24; }
+inline int f7640_25(int x) { return x * 25; }
+inline int f7640_26(int x) { return x * 26; }
+inline int f7640_27(int x) { return x * 27; }
+inline int f7640_28(int x) { return x * 28; }
+inline int f7640_29(int x) { return x * 29; }
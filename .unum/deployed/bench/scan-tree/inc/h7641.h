@@ -0,0 +1,42 @@
+#pragma once
+/* header 7641 */
+#include <vector>
+#include "h9650.h"
+#include "h9724.h"
+#include "h3057.h"
+#include "h909.h"
+#include "h8134.h"
+#ifdef X
+#include "h4364.h"
+#endif
+struct S7641 { int a; const char *s = "x//y"; };
+inline int f7641_0(int x) { return x * 0; }
+inline int f7641_1(int x) { return x * 1; }
+inline int f7641_2(int x) { return x * 2; }
+inline int f7641_3(int x) { return x * 3; }
+inline int f7641_4(int x) { return x * 4; }
+inline int f7641_5(int x) { return x * 5; }
+inline int f7641_6(int x) { return x * 6; }
+inline int f7641_7(int x) { return x * 7; }
+inline int f7641_8(int x) { return x * 8; }
+inline int f7641_9(int x) { return x * 9; }
+inline int f7641_10(int x) { return x * 10; }
+inline int f7641_11(int x) { return x * 11; }
+inline int f7641_12(int x) { return x * 12; }
+inline int f7641_13(int x) { return x * 13; }
+inline int f7641_14(int x) { return x * 14; }
+inline int f7641_15(int x) { return x * 15; }
+inline int f7641_16(int x) { return x * 16; }
+inline int f7641_17(int x) { return x * 17; }
+inline int f7641_18(int x) { return x * 18; }
+inline int f7641_19(int x) { return x * 19; }
+inline int f7641_20(int x) { return x * 20; }
+inline int f7641_21(int x) { return x * 21; }
+inline int f7641_22(int x) { return x * 22; }
+inline int f7641_23(int x) { return x * 23; }
+inline int f7641_24(int x) { return x * 24; }
+inline int f7641_25(int x) { return x * 25; }
+inline int f7641_26(int x) { return x * 26; }
+inline int f7641_27(int x) { return x * 27; }
+inline int f7641_28(int x) { return x * 28; }
+inline int f7641_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7643 */
+#include <vector>
+#include "h7206.h"
+#include "h7724.h"
+#include "h1794.h"
+#include "h7202.h"
+#include "h6515.h"
+#ifdef X
+#include "h3492.h"
+#endif
+struct S7643 { int a; const char *s = "x//y"; };
+inline int f7643_0(int x) { return x * 0; }
+inline int f7643_1(int x) { return x * 1; }
+inline int f7643_2(int x) { return x * 2; }
+inline int f7643_3(int x) { return x * 3; }
+inline int f7643_4(int x) { return x * 4; }
+inline int f7643_5(int x) { return x * 5; }
+inline int f7643_6(int x) { return x * 6; }
+inline int f7643_7(int x) { return x * 7; }
+inline int f7643_8(int x) { return x * 8; }
+inline int f7643_9(int x) { return x * 9; }
+inline int f7643_10(int x) { return x * 10; }
+inline int f7643_11(int x) { return x * 11; }
+inline int f7643_12(int x) { return x * 12; }
+inline int f7643_13(int x) { return x * 13; }
+inline int f7643_14(int x) { return x * 14; }
+inline int f7643_15(int x) { return x * 15; }
+inline int f7643_16(int x) { return x * 16; }
+inline int f7643_17(int x) { return x * 17; }
+inline int f7643_18(int x) { return x * 18; }
+inline int f7643_19(int x) { return x * 19; }
+inline int f7643_20(int x) { return x * 20; }
+inline int f7643_21(int x) { return x * 21; }
+inline int f7643_22(int x) { return x * 22; }
+inline int f7643_23(int x) { return x * 23; }
+inline int f7643_24(int x) { return x * 24; }
+inline int f7643_25(int x) { return x * 25; }
+inline int f7643_26(int x) { return x * 26; }
+inline int f7643_27(int x) { return x * 27; }
+inline int f7643_28(int x) { return x * 28; }
+inline int f7643_29(int x) { return x * 29; }
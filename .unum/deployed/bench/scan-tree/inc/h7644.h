@@ -0,0 +1,42 @@
+#pragma once
+/* header 7644 */
+#include <vector>
+#include "h6255.h"
+#include "h6251.h"
+#include "h7318.h"
+#include "h9436.h"
+#include "h7965.h"
+#ifdef X
+#include "h3175.h"
+#endif
+struct S7644 { int a; const char *s = "x//y"; };
+inline int f7644_0(int x) { return x * 0; }
+inline int f7644_1(int x) { return x * 1; }
+inline int f7644_2(int x) { return x * 2; }
+inline int f7644_3(int x) { return x * 3; }
+inline int f7644_4(int x) { return x * 4; }
+inline int f7644_5(int x) { return x * 5; }
+inline int f7644_6(int x) { return x * 6; }
+inline int f7644_7(int x) { return x * 7; }
+inline int f7644_8(int x) { return x * 8; }
+inline int f7644_9(int x) { return x * 9; }
+inline int f7644_10(int x) { return x * 10; }
+inline int f7644_11(int x) { return x * 11; }
+inline int f7644_12(int x) { return x * 12; }
+inline int f7644_13(int x) { return x * 13; }
+inline int f7644_14(int x) { return x * 14; }
+inline int f7644_15(int x) { return x * 15; }
+inline int f7644_16(int x) { return x * 16; }
+inline int f7644_17(int x) { return x * 17; }
+inline int f7644_18(int x) { return x * 18; }
+inline int f7644_19(int x) { return x * 19; }
+inline int f7644_20(int x) { return x * 20; }
+inline int f7644_21(int x) { return x * 21; }
+inline int f7644_22(int x) { return x * 22; }
+inline int f7644_23(int x) { return x * 23; }
+inline int f7644_24(int x) { return x * 24; }
+inline int f7644_25(int x) { return x * 25; }
+inline int f7644_26(int x) { return x * 26; }
+inline int f7644_27(int x) { return x * 27; }
+inline int f7644_28(int x) { return x * 28; }
+inline int f7644_29(int x) { return x * 29; }
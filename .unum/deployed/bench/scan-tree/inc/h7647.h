@@ -0,0 +1,42 @@
+#pragma once
+/* header 7647 */
+#include <vector>
+#include "h9616.h"
+#include "h6093.h"
+#include "h3957.h"
+#include "h1307.h"
+#include "h861.h"
+#ifdef X
+#include "h2424.h"
+#endif
+struct S7647 { int a; const char *s = "x//y"; };
+inline int f7647_0(int x) { return x * 0; }
+inline int f7647_1(int x) { return x * 1; }
+inline int f7647_2(int x) { return x * 2; }
+inline int f7647_3(int x) { return x * 3; }
+inline int f7647_4(int x) { return x * 4; }
+inline int f7647_5(int x) { return x * 5; }
+inline int f7647_6(int x) { return x * 6; }
+inline int f7647_7(int x) { return x * 7; }
+inline int f7647_8(int x) { return x * 8; }
+inline int f7647_9(int x) { return x * 9; }
+inline int f7647_10(int x) { return x * 10; }
+inline int f7647_11(int x) { return x * 11; }
+inline int f7647_12(int x) { return x * 12; }
+inline int f7647_13(int x) { return x * 13; }
+inline int f7647_14(int x) { return x * 14; }
+inline int f7647_15(int x) { return x * 15; }
+inline int f7647_16(int x) { return x * 16; }
+inline int f7647_17(int x) { return x * 17; }
+inline int f7647_18(int x) { return x * 18; }
+inline int f7647_19(int x) { return x * 19; }
+inline int f7647_20(int x) { return x * 20; }
+inline int f7647_21(int x) { return x * 21; }
+inline int f7647_22(int x) { return x * 22; }
+inline int f7647_23(int x) { return x * 23; }
+inline int f7647_24(int x) { return x * 24; }
+inline int f7647_25(int x) { return x * 25; }
+inline int f7647_26(int x) { return x * 26; }
+inline int f7647_27(int x) { return x * 27; }
+inline int f7647_28(int x) { return x * 28; }
+inline int f7647_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7648 */
+#include <vector>
+#include "h9738.h"
+#include "h8915.h"
+#include "h4264.h"
+#include "h7019.h"
+#include "h8486.h"
+#ifdef X
+#include "h1822.h"
+#endif
+struct S7648 { int a; const char *s = "x//y"; };
+inline int f7648_0(int x) { return x * 0; }
+inline int f7648_1(int x) { return x * 1; }
+inline int f7648_2(int x) { return x * 2; }
+inline int f7648_3(int x) { return x * 3; }
+inline int f7648_4(int x) { return x * 4; }
+inline int f7648_5(int x) { return x * 5; }
+inline int f7648_6(int x) { return x * 6; }
+inline int f7648_7(int x) { return x * 7; }
+inline int f7648_8(int x) { return x * 8; }
+inline int f7648_9(int x) { return x * 9; }
+inline int f7648_10(int x) { return x * 10; }
+inline int f7648_11(int x) { return x * 11; }
+inline int f7648_12(int x) { return x * 12; }
+inline int f7648_13(int x) { return x * 13; }
+inline int f7648_14(int x) { return x * 14; }
+inline int f7648_15(int x) { return x * 15; }
+inline int f7648_16(int x) { return x * 16; }
+inline int f7648_17(int x) { return x * 17; }
+inline int f7648_18(int x) { return x * 18; }
+inline int f7648_19(int x) { return x * 19; }
+inline int f7648_20(int x) { return x * 20; }
+inline int f7648_21(int x) { return x * 21; }
+inline int f7648_22(int x) { return x * 22; }
+inline int f7648_23(int x) { return x * 23; }
+inline int f7648_24(int x) { return x * 24; }
+inline int f7648_25(int x) { return x * 25; }
+inline int f7648_26(int x) { return x * 26; }
+inline int f7648_27(int x) { return x * 27; }
+inline int f7648_28(int x) { return x * 28; }
+inline int f7648_29(int x) { return x * 29; }
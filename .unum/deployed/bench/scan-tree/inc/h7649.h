@@ -0,0 +1,42 @@
+#pragma once
+/* header 7649 */
+#include <vector>
+#include "h4169.h"
+#include "h1958.h"
+#include "h4680.h"
+#include "h7316.h"
+#include "h7723.h"
+#ifdef X
+#include "h6874.h"
+#endif
+struct S7649 { int a; const char *s = "x//y"; };
+inline int f7649_0(int x) { return x * 0; }
+inline int f7649_1(int x) { return x * 1; }
+inline int f7649_2(int x) { return x * 2; }
+inline int f7649_3(int x) { return x * 3; }
+inline int f7649_4(int x) { return x * 4; }
+inline int f7649_5(int x) { return x * 5; }
+inline int f7649_6(int x) { return x * 6; }
+inline int f7649_7(int x) { return x * 7; }
+inline int f7649_8(int x) { return x * 8; }
+inline int f7649_9(int x) { return x * 9; }
+inline int f7649_10(int x) { return x * 10; }
+inline int f7649_11(int x) { return x * 11; }
+inline int f7649_12(int x) { return x * 12; }
+inline int f7649_13(int x) { return x * 13; }
+inline int f7649_14(int x) { return x * 14; }
+inline int f7649_15(int x) { return x * 15; }
+inline int f7649_16(int x) { return x * 16; }
+inline int f7649_17(int x) { return x * 17; }
+inline int f7649_18(int x) { return x * 18; }
+inline int f7649_19(int x) { return x * 19; }
+inline int f7649_20(int x) { return x * 20; }
+inline int f7649_21(int x) { return x * 21; }
+inline int f7649_22(int x) { return x * 22; }
+inline int f7649_23(int x) { return x * 23; }
+inline int f7649_24(int x) { return x * 24; }
+inline int f7649_25(int x) { return x * 25; }
+inline int f7649_26(int x) { return x * 26; }
+inline int f7649_27(int x) { return x * 27; }
+inline int f7649_28(int x) { return x * 28; }
+inline int f7649_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7650 */
+#include <vector>
+#include "h1032.h"
+#include "h8998.h"
+#include "h8228.h"
+#include "h9986.h"
+#include "h1510.h"
+#ifdef X
+#include "h3841.h"
+#endif
+struct S7650 { int a; const char *s = "x//y"; };
+inline int f7650_0(int x) { return x * 0; }
+inline int f7650_1(int x) { return x * 1; }
+inline int f7650_2(int x) { return x * 2; }
+inline int f7650_3(int x) { return x * 3; }
+inline int f7650_4(int x) { return x * 4; }
+inline int f7650_5(int x) { return x * 5; }
+inline int f7650_6(int x) { return x * 6; }
+inline int f7650_7(int x) { return x * 7; }
+inline int f7650_8(int x) { return x * 8; }
+inline int f7650_9(int x) { return x * 9; }
+inline int f7650_10(int x) { return x * 10; }
+inline int f7650_11(int x) { return x * 11; }
+inline int f7650_12(int x) { return x * 12; }
+inline int f7650_13(int x) { return x * 13; }
+inline int f7650_14(int x) { return x * 14; }
+inline int f7650_15(int x) { return x * 15; }
+inline int f7650_16(int x) { return x * 16; }
+inline int f7650_17(int x) { return x * 17; }
+inline int f7650_18(int x) { return x * 18; }
+inline int f7650_19(int x) { return x * 19; }
+inline int f7650_20(int x) { return x * 20; }
+inline int f7650_21(int x) { return x * 21; }
+inline int f7650_22(int x) { return x * 22; }
+inline int f7650_23(int x) { return x * 23; }
+inline int f7650_24(int x) { return x * 24; }
+inline int f7650_25(int x) { return x * 25; }
+inline int f7650_26(int x) { return x * 26; }
+inline int f7650_27(int x) { return x * 27; }
+inline int f7650_28(int x) { return x * 28; }
+inline int f7650_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7653 */
+#include <vector>
+#include "h182.h"
+#include "h2464.h"
+#include "h2434.h"
+#include "h6852.h"
+#include "h90.h"
+#ifdef X
+#include "h1905.h"
+#endif
+struct S7653 { int a; const char *s = "x//y"; };
+inline int f7653_0(int x) { return x * 0; }
+inline int f7653_1(int x) { return x * 1; }
+inline int f7653_2(int x) { return x * 2; }
+inline int f7653_3(int x) { return x * 3; }
+inline int f7653_4(int x) { return x * 4; }
+inline int f7653_5(int x) { return x * 5; }
+inline int f7653_6(int x) { return x * 6; }
+inline int f7653_7(int x) { return x * 7; }
+inline int f7653_8(int x) { return x * 8; }
+inline int f7653_9(int x) { return x * 9; }
+inline int f7653_10(int x) { return x * 10; }
+inline int f7653_11(int x) { return x * 11; }
+inline int f7653_12(int x) { return x * 12; }
+inline int f7653_13(int x) { return x * 13; }
+inline int f7653_14(int x) { return x * 14; }
+inline int f7653_15(int x) { return x * 15; }
+inline int f7653_16(int x) { return x * 16; }
+inline int f7653_17(int x) { return x * 17; }
+inline int f7653_18(int x) { return x * 18; }
+inline int f7653_19(int x) { return x * 19; }
+inline int f7653_20(int x) { return x * 20; }
+inline int f7653_21(int x) { return x * 21; }
+inline int f7653_22(int x) { return x * 22; }
+inline int f7653_23(int x) { return x * 23; }
+inline int f7653_24(int x) { return x * 24; }
+inline int f7653_25(int x) { return x * 25; }
+inline int f7653_26(int x) { return x * 26; }
+inline int f7653_27(int x) { return x * 27; }
+inline int f7653_28(int x) { return x * 28; }
+inline int f7653_29(int x) { return x * 29; }
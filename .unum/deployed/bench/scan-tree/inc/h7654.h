@@ -0,0 +1,42 @@
+#pragma once
+/* header 7654 */
+#include <vector>
+#include "h8752.h"
+#include "h5122.h"
+#include "h3881.h"
+#include "h9422.h"
+#include "h353.h"
+#ifdef X
+#include "h4595.h"
+#endif
+struct S7654 { int a; const char *s = "x//y"; };
+inline int f7654_0(int x) { return x * 0; }
+inline int f7654_1(int x) { return x * 1; }
+inline int f7654_2(int x) { return x * 2; }
+inline int f7654_3(int x) { return x * 3; }
+inline int f7654_4(int x) { return x * 4; }
+inline int f7654_5(int x) { return x * 5; }
+inline int f7654_6(int x) { return x * 6; }
+inline int f7654_7(int x) { return x * 7; }
+inline int f7654_8(int x) { return x * 8; }
+inline int f7654_9(int x) { return x * 9; }
+inline int f7654_10(int x) { return x * 10; }
+inline int f7654_11(int x) { return x * 11; }
+inline int f7654_12(int x) { return x * 12; }
+inline int f7654_13(int x) { return x * 13; }
+inline int f7654_14(int x) { return x * 14; }
+inline int f7654_15(int x) { return x * 15; }
+inline int f7654_16(int x) { return x * 16; }
+inline int f7654_17(int x) { return x * 17; }
+inline int f7654_18(int x) { return x * 18; }
+inline int f7654_19(int x) { return x * 19; }
+inline int f7654_20(int x) { return x * 20; }
+inline int f7654_21(int x) { return x * 21; }
+inline int f7654_22(int x) { return x * 22; }
+inline int f7654_23(int x) { return x * 23; }
+inline int f7654_24(int x) { return x * 24; }
+inline int f7654_25(int x) { return x * 25; }
+inline int f7654_26(int x) { return x * 26; }
+inline int f7654_27(int x) { return x * 27; }
+inline int f7654_28(int x) { return x * 28; }
+inline int f7654_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7655 */
+#include <vector>
+#include "h7244.h"
+#include "h6920.h"
+#include "h4214.h"
+#include "h7920.h"
+#include "h9367.h"
+#ifdef X
+#include "h511.h"
+#endif
+struct S7655 { int a; const char *s = "x//y"; };
+inline int f7655_0(int x) { return x * 0; }
+inline int f7655_1(int x) { return x * 1; }
+inline int f7655_2(int x) { return x * 2; }
+inline int f7655_3(int x) { return x * 3; }
+inline int f7655_4(int x) { return x * 4; }
+inline int f7655_5(int x) { return x * 5; }
+inline int f7655_6(int x) { return x * 6; }
+inline int f7655_7(int x) { return x * 7; }
+inline int f7655_8(int x) { return x * 8; }
+inline int f7655_9(int x) { return x * 9; }
+inline int f7655_10(int x) { return x * 10; }
+inline int f7655_11(int x) { return x * 11; }
+inline int f7655_12(int x) { return x * 12; }
+inline int f7655_13(int x) { return x * 13; }
+inline int f7655_14(int x) { return x * 14; }
+inline int f7655_15(int x) { return x * 15; }
+inline int f7655_16(int x) { return x * 16; }
+inline int f7655_17(int x) { return x * 17; }
+inline int f7655_18(int x) { return x * 18; }
+inline int f7655_19(int x) { return x * 19; }
+inline int f7655_20(int x) { return x * 20; }
+inline int f7655_21(int x) { return x * 21; }
+inline int f7655_22(int x) { return x * 22; }
+inline int f7655_23(int x) { return x * 23; }
+inline int f7655_24(int x) { return x * 24; }
+inline int f7655_25(int x) { return x * 25; }
+inline int f7655_26(int x) { return x * 26; }
+inline int f7655_27(int x) { return x * 27; }
+inline int f7655_28(int x) { return x * 28; }
+inline int f7655_29(int x) { return x * 29; }
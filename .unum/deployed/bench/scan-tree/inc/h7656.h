@@ -0,0 +1,42 @@
+#pragma once
+/* header 7656 */
+#include <vector>
+#include "h1151.h"
+#include "h2259.h"
+#include "h9280.h"
+#include "h9758.h"
+#include "h8885.h"
+#ifdef X
+#include "h9616.h"
+#endif
+struct S7656 { int a; const char *s = "x//y"; };
+inline int f7656_0(int x) { return x * 0; }
+inline int f7656_1(int x) { return x * 1; }
+inline int f7656_2(int x) { return x * 2; }
+inline int f7656_3(int x) { return x * 3; }
+inline int f7656_4(int x) { return x * 4; }
+inline int f7656_5(int x) { return x * 5; }
+inline int f7656_6(int x) { return x * 6; }
+inline int f7656_7(int x) { return x * 7; }
+inline int f7656_8(int x) { return x * 8; }
+inline int f7656_9(int x) { return x * 9; }
+inline int f7656_10(int x) { return x * 10; }
+inline int f7656_11(int x) { return x * 11; }
+inline int f7656_12(int x) { return x * 12; }
+inline int f7656_13(int x) { return x * 13; }
+inline int f7656_14(int x) { return x * 14; }
+inline int f7656_15(int x) { return x * 15; }
+inline int f7656_16(int x) { return x * 16; }
+inline int f7656_17(int x) { return x * 17; }
+inline int f7656_18(int x) { return x * 18; }
+inline int f7656_19(int x) { return x * 19; }
+inline int f7656_20(int x) { return x * 20; }
+inline int f7656_21(int x) { return x * 21; }
+inline int f7656_22(int x) { return x * 22; }
+inline int f7656_23(int x) { return x * 23; }
+inline int f7656_24(int x) { return x * 24; }
+inline int f7656_25(int x) { return x * 25; }
+inline int f7656_26(int x) { return x * 26; }
+inline int f7656_27(int x) { return x * 27; }
+inline int f7656_28(int x) { return x * 28; }
+inline int f7656_29(int x) { return x * 29; }
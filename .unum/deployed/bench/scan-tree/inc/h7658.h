@@ -0,0 +1,42 @@
+#pragma once
+/* header 7658 */
+#include <vector>
+#include "h6454.h"
+#include "h9431.h"
+#include "h4301.h"
+#include "h4488.h"
+#include "h7431.h"
+#ifdef X
+#include "h4191.h"
+#endif
+struct S7658 { int a; const char *s = "x//y"; };
+inline int f7658_0(int x) { return x * 0; }
+inline int f7658_1(int x) { return x * 1; }
+inline int f7658_2(int x) { return x * 2; }
+inline int f7658_3(int x) { return x * 3; }
+inline int f7658_4(int x) { return x * 4; }
+inline int f7658_5(int x) { return x * 5; }
+inline int f7658_6(int x) { return x * 6; }
+inline int f7658_7(int x) { return x * 7; }
+inline int f7658_8(int x) { return x * 8; }
+inline int f7658_9(int x) { return x * 9; }
+inline int f7658_10(int x) { return x * 10; }
+inline int f7658_11(int x) { return x * 11; }
+inline int f7658_12(int x) { return x * 12; }
+inline int f7658_13(int x) { return x * 13; }
+inline int f7658_14(int x) { return x * 14; }
+inline int f7658_15(int x) { return x * 15; }
+inline int f7658_16(int x) { return x * 16; }
+inline int f7658_17(int x) { return x * 17; }
+inline int f7658_18(int x) { return x * 18; }
+inline int f7658_19(int x) { return x * 19; }
+inline int f7658_20(int x) { return x * 20; }
+inline int f7658_21(int x) { return x * 21; }
+inline int f7658_22(int x) { return x * 22; }
+inline int f7658_23(int x) { return x * 23; }
+inline int f7658_24(int x) { return x * 24; }
+inline int f7658_25(int x) { return x * 25; }
+inline int f7658_26(int x) { return x * 26; }
+inline int f7658_27(int x) { return x * 27; }
+inline int f7658_28(int x) { return x * 28; }
+inline int f7658_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 766 */
+#include <vector>
+#include "h946.h"
+#include "h3733.h"
+#include "h5947.h"
+#include "h5289.h"
+#include "h1155.h"
+#ifdef X
+#include "h8698.h"
+#endif
+struct S766 { int a; const char *s = "x//y"; };
+inline int f766_0(int x) { return x * 0; }
+inline int f766_1(int x) { return x * 1; }
+inline int f766_2(int x) { return x * 2; }
+inline int f766_3(int x) { return x * 3; }
+inline int f766_4(int x) { return x * 4; }
+inline int f766_5(int x) { return x * 5; }
+inline int f766_6(int x) { return x * 6; }
+inline int f766_7(int x) { return x * 7; }
+inline int f766_8(int x) { return x * 8; }
+inline int f766_9(int x) { return x * 9; }
+inline int f766_10(int x) { return x * 10; }
+inline int f766_11(int x) { return x * 11; }
+inline int f766_12(int x) { return x * 12; }
+inline int f766_13(int x) { return x * 13; }
+inline int f766_14(int x) { return x * 14; }
+inline int f766_15(int x) { return x * 15; }
+inline int f766_16(int x) { return x * 16; }
+inline int f766_17(int x) { return x * 17; }
+inline int f766_18(int x) { return x * 18; }
+inline int f766_19(int x) { return x * 19; }
+inline int f766_20(int x) { return x * 20; }
+inline int f766_21(int x) { return x * 21; }
+inline int f766_22(int x) { return x * 22; }
+inline int f766_23(int x) { return x * 23; }
+inline int f766_24(int x) { return x * 24; }
+inline int f766_25(int x) { return x * 25; }
+inline int f766_26(int x) { return x * 26; }
+inline int f766_27(int x) { return x * 27; }
+inline int f766_28(int x) { return x * 28; }
+inline int f766_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7663 */
+#include <vector>
+#include "h2457.h"
+#include "h9727.h"
+#include "h8563.h"
+#include "h1234.h"
+#include "h6299.h"
+#ifdef X
+#include "h7278.h"
+#endif
+struct S7663 { int a; const char *s = "x//y"; };
+inline int f7663_0(int x) { return x * 0; }
+inline int f7663_1(int x) { return x * 1; }
+inline int f7663_2(int x) { return x * 2; }
+inline int f7663_3(int x) { return x * 3; }
+inline int f7663_4(int x) { return x * 4; }
+inline int f7663_5(int x) { return x * 5; }
+inline int f7663_6(int x) { return x * 6; }
+inline int f7663_7(int x) { return x * 7; }
+inline int f7663_8(int x) { return x * 8; }
+inline int f7663_9(int x) { return x * 9; }
+inline int f7663_10(int x) { return x * 10; }
+inline int f7663_11(int x) { return x * 11; }
+inline int f7663_12(int x) { return x * 12; }
+inline int f7663_13(int x) { return x * 13; }
+inline int f7663_14(int x) { return x * 14; }
+inline int f7663_15(int x) { return x * 15; }
+inline int f7663_16(int x) { return x * 16; }
+inline int f7663_17(int x) { return x * 17; }
+inline int f7663_18(int x) { return x * 18; }
+inline int f7663_19(int x) { return x * 19; }
+inline int f7663_20(int x) { return x * 20; }
+inline int f7663_21(int x) { return x * 21; }
+inline int f7663_22(int x) { return x * 22; }
+inline int f7663_23(int x) { return x * 23; }
+inline int f7663_24(int x) { return x * 24; }
+inline int f7663_25(int x) { return x * 25; }
+inline int f7663_26(int x) { return x * 26; }
+inline int f7663_27(int x) { return x * 27; }
+inline int f7663_28(int x) { return x * 28; }
+inline int f7663_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7674 */
+#include <vector>
+#include "h6666.h"
+#include "h2927.h"
+#include "h8823.h"
+#include "h3273.h"
+#include "h5152.h"
+#ifdef X
+#include "h7136.h"
+#endif
+struct S7674 { int a; const char *s = "x//y"; };
+inline int f7674_0(int x) { return x * 0; }
+inline int f7674_1(int x) { return x * 1; }
+inline int f7674_2(int x) { return x * 2; }
+inline int f7674_3(int x) { return x * 3; }
+inline int f7674_4(int x) { return x * 4; }
+inline int f7674_5(int x) { return x * 5; }
+inline int f7674_6(int x) { return x * 6; }
+inline int f7674_7(int x) { return x * 7; }
+inline int f7674_8(int x) { return x * 8; }
+inline int f7674_9(int x) { return x * 9; }
+inline int f7674_10(int x) { return x * 10; }
+inline int f7674_11(int x) { return x * 11; }
+inline int f7674_12(int x) { return x * 12; }
+inline int f7674_13(int x) { return x * 13; }
+inline int f7674_14(int x) { return x * 14; }
+inline int f7674_15(int x) { return x * 15; }
+inline int f7674_16(int x) { return x * 16; }
+inline int f7674_17(int x) { return x * 17; }
+inline int f7674_18(int x) { return x * 18; }
+inline int f7674_19(int x) { return x * 19; }
+inline int f7674_20(int x) { return x * 20; }
+inline int f7674_21(int x) { return x * 21; }
+inline int f7674_22(int x) { return x * 22; }
+inline int f7674_23(int x) { return x * 23; }
+inline int f7674_24(int x) { return x * 24; }
+inline int f7674_25(int x) { return x * 25; }
+inline int f7674_26(int x) { return x * 26; }
+inline int f7674_27(int x) { return x * 27; }
+inline int f7674_28(int x) { return x * 28; }
+inline int f7674_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7676 */
+#include <vector>
+#include "h2074.h"
+#include "h8488.h"
+#include "h5927.h"
+#include "h4252.h"
+#include "h1012.h"
+#ifdef X
+#include "h7118.h"
+#endif
+struct S7676 { int a; const char *s = "x//y"; };
+inline int f7676_0(int x) { return x * 0; }
+inline int f7676_1(int x) { return x * 1; }
+inline int f7676_2(int x) { return x * 2; }
+inline int f7676_3(int x) { return x * 3; }
+inline int f7676_4(int x) { return x * 4; }
+inline int f7676_5(int x) { return x * 5; }
+inline int f7676_6(int x) { return x * 6; }
+inline int f7676_7(int x) { return x * 7; }
+inline int f7676_8(int x) { return x * 8; }
+inline int f7676_9(int x) { return x * 9; }
+inline int f7676_10(int x) { return x * 10; }
+inline int f7676_11(int x) { return x * 11; }
+inline int f7676_12(int x) { return x * 12; }
+inline int f7676_13(int x) { return x * 13; }
+inline int f7676_14(int x) { return x * 14; }
+inline int f7676_15(int x) { return x * 15; }
+inline int f7676_16(int x) { return x * 16; }
+inline int f7676_17(int x) { return x * 17; }
+inline int f7676_18(int x) { return x * 18; }
+inline int f7676_19(int x) { return x * 19; }
+inline int f7676_20(int x) { return x * 20; }
+inline int f7676_21(int x) { return x * 21; }
+inline int f7676_22(int x) { return x * 22; }
+inline int f7676_23(int x) { return x * 23; }
+inline int f7676_24(int x) { return x * 24; }
+inline int f7676_25(int x) { return x * 25; }
+inline int f7676_26(int x) { return x * 26; }
+inline int f7676_27(int x) { return x * 27; }
+inline int f7676_28(int x) { return x * 28; }
+inline int f7676_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7678 */
+#include <vector>
+#include "h6544.h"
+#include "h9362.h"
+#include "h7007.h"
+#include "h4002.h"
+#include "h4936.h"
+#ifdef X
+#include "h5478.h"
+#endif
+struct S7678 { int a; const char *s = "x//y"; };
+inline int f7678_0(int x) { return x * 0; }
+inline int f7678_1(int x) { return x * 1; }
+inline int f7678_2(int x) { return x * 2; }
+inline int f7678_3(int x) { return x * 3; }
+inline int f7678_4(int x) { return x * 4; }
+inline int f7678_5(int x) { return x * 5; }
+inline int f7678_6(int x) { return x * 6; }
+inline int f7678_7(int x) { return x * 7; }
+inline int f7678_8(int x) { return x * 8; }
+inline int f7678_9(int x) { return x * 9; }
+inline int f7678_10(int x) { return x * 10; }
+inline int f7678_11(int x) { return x * 11; }
+inline int f7678_12(int x) { return x * 12; }
+inline int f7678_13(int x) { return x * 13; }
+inline int f7678_14(int x) { return x * 14; }
+inline int f7678_15(int x) { return x * 15; }
+inline int f7678_16(int x) { return x * 16; }
+inline int f7678_17(int x) { return x * 17; }
+inline int f7678_18(int x) { return x * 18; }
+inline int f7678_19(int x) { return x * 19; }
+inline int f7678_20(int x) { return x * 20; }
+inline int f7678_21(int x) { return x * 21; }
+inline int f7678_22(int x) { return x * 22; }
+inline int f7678_23(int x) { return x * 23; }
+inline int f7678_24(int x) { return x * 24; }
+inline int f7678_25(int x) { return x * 25; }
+inline int f7678_26(int x) { return x * 26; }
+inline int f7678_27(int x) { return x * 27; }
+inline int f7678_28(int x) { return x * 28; }
+inline int f7678_29(int x) { return x * 29; }
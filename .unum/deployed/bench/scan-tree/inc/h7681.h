@@ -0,0 +1,42 @@
+#pragma once
+/* header 7681 */
+#include <vector>
+#include "h1715.h"
+#include "h7368.h"
+#include "h2868.h"
+#include "h1860.h"
+#include "h1180.h"
+#ifdef X
+#include "h9960.h"
+#endif
+struct S7681 { int a; const char *s = "x//y"; };
+inline int f7681_0(int x) { return x * 0; }
+inline int f7681_1(int x) { return x * 1; }
+inline int f7681_2(int x) { return x * 2; }
+inline int f7681_3(int x) { return x * 3; }
+inline int f7681_4(int x) { return x * 4; }
+inline int f7681_5(int x) { return x * 5; }
+inline int f7681_6(int x) { return x * 6; }
+inline int f7681_7(int x) { return x * 7; }
+inline int f7681_8(int x) { return x * 8; }
+inline int f7681_9(int x) { return x * 9; }
+inline int f7681_10(int x) { return x * 10; }
+inline int f7681_11(int x) { return x * 11; }
+inline int f7681_12(int x) { return x * 12; }
+inline int f7681_13(int x) { return x * 13; }
+inline int f7681_14(int x) { return x * 14; }
+inline int f7681_15(int x) { return x * 15; }
+inline int f7681_16(int x) { return x * 16; }
+inline int f7681_17(int x) { return x * 17; }
+inline int f7681_18(int x) { return x * 18; }
+inline int f7681_19(int x) { return x * 19; }
+inline int f7681_20(int x) { return x * 20; }
+inline int f7681_21(int x) { return x * 21; }
+inline int f7681_22(int x) { return x * 22; }
+inline int f7681_23(int x) { return x * 23; }
+inline int f7681_24(int x) { return x * 24; }
+inline int f7681_25(int x) { return x * 25; }
+inline int f7681_26(int x) { return x * 26; }
+inline int f7681_27(int x) { return x * 27; }
+inline int f7681_28(int x) { return x * 28; }
+inline int f7681_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7687 */
+#include <vector>
+#include "h6949.h"
+#include "h7214.h"
+#include "h3140.h"
+#include "h2401.h"
+#include "h7385.h"
+#ifdef X
+#include "h3091.h"
+#endif
+struct S7687 { int a; const char *s = "x//y"; };
+inline int f7687_0(int x) { return x * 0; }
+inline int f7687_1(int x) { return x * 1; }
+inline int f7687_2(int x) { return x * 2; }
+inline int f7687_3(int x) { return x * 3; }
+inline int f7687_4(int x) { return x * 4; }
+inline int f7687_5(int x) { return x * 5; }
+inline int f7687_6(int x) { return x * 6; }
+inline int f7687_7(int x) { return x * 7; }
+inline int f7687_8(int x) { return x * 8; }
+inline int f7687_9(int x) { return x * 9; }
+inline int f7687_10(int x) { return x * 10; }
+inline int f7687_11(int x) { return x * 11; }
+inline int f7687_12(int x) { return x * 12; }
+inline int f7687_13(int x) { return x * 13; }
+inline int f7687_14(int x) { return x * 14; }
+inline int f7687_15(int x) { return x * 15; }
+inline int f7687_16(int x) { return x * 16; }
+inline int f7687_17(int x) { return x * 17; }
+inline int f7687_18(int x) { return x * 18; }
+inline int f7687_19(int x) { return x * 19; }
+inline int f7687_20(int x) { return x * 20; }
+inline int f7687_21(int x) { return x * 21; }
+inline int f7687_22(int x) { return x * 22; }
+inline int f7687_23(int x) { return x * 23; }
+inline int f7687_24(int x) { return x * 24; }
+inline int f7687_25(int x) { return x * 25; }
+inline int f7687_26(int x) { return x * 26; }
+inline int f7687_27(int x) { return x * 27; }
+inline int f7687_28(int x) { return x * 28; }
+inline int f7687_29(int x) { return x * 29; }
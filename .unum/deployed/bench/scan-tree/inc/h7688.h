@@ -0,0 +1,42 @@
+#pragma once
+/* header 7688 */
+#include <vector>
+#include "h3892.h"
+#include "h6952.h"
+#include "h5874.h"
+#include "h2524.h"
+#include "h2774.h"
+#ifdef X
+#include "h3068.h"
+#endif
+struct S7688 { int a; const char *s = "x//y"; };
+inline int f7688_0(int x) { return x * 0; }
+inline int f7688_1(int x) { return x * 1; }
+inline int f7688_2(int x) { return x * 2; }
+inline int f7688_3(int x) { return x * 3; }
+inline int f7688_4(int x) { return x * 4; }
+inline int f7688_5(int x) { return x * 5; }
+inline int f7688_6(int x) { return x * 6; }
+inline int f7688_7(int x) { return x * 7; }
+inline int f7688_8(int x) { return x * 8; }
+inline int f7688_9(int x) { return x * 9; }
+inline int f7688_10(int x) { return x * 10; }
+inline int f7688_11(int x) { return x * 11; }
+inline int f7688_12(int x) { return x * 12; }
+inline int f7688_13(int x) { return x * 13; }
+inline int f7688_14(int x) { return x * 14; }
+inline int f7688_15(int x) { return x * 15; }
+inline int f7688_16(int x) { return x * 16; }
+inline int f7688_17(int x) { return x * 17; }
+inline int f7688_18(int x) { return x * 18; }
+inline int f7688_19(int x) { return x * 19; }
+inline int f7688_20(int x) { return x * 20; }
+inline int f7688_21(int x) { return x * 21; }
+inline int f7688_22(int x) { return x * 22; }
+inline int f7688_23(int x) { return x * 23; }
+inline int f7688_24(int x) { return x * 24; }
+inline int f7688_25(int x) { return x * 25; }
+inline int f7688_26(int x) { return x * 26; }
+inline int f7688_27(int x) { return x * 27; }
+inline int f7688_28(int x) { return x * 28; }
+inline int f7688_29(int x) { return x * 29; }
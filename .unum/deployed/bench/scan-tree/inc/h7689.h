@@ -0,0 +1,42 @@
+#pragma once
+/* header 7689 */
+#include <vector>
+#include "h8963.h"
+#include "h9447.h"
+#include "h8962.h"
+#include "h2649.h"
+#include "h1430.h"
+#ifdef X
+#include "h4828.h"
+#endif
+struct S7689 { int a; const char *s = "x//y"; };
+inline int f7689_0(int x) { return x * 0; }
+inline int f7689_1(int x) { return x * 1; }
+inline int f7689_2(int x) { return x * 2; }
+inline int f7689_3(int x) { return x * 3; }
+inline int f7689_4(int x) { return x * 4; }
+inline int f7689_5(int x) { return x * 5; }
+inline int f7689_6(int x) { return x * 6; }
+inline int f7689_7(int x) { return x * 7; }
+inline int f7689_8(int x) { return x * 8; }
+inline int f7689_9(int x) { return x * 9; }
+inline int f7689_10(int x) { return x * 10; }
+inline int f7689_11(int x) { return x * 11; }
+inline int f7689_12(int x) { return x * 12; }
+inline int f7689_13(int x) { return x * 13; }
+inline int f7689_14(int x) { return x * 14; }
+inline int f7689_15(int x) { return x * 15; }
+inline int f7689_16(int x) { return x * 16; }
+inline int f7689_17(int x) { return x * 17; }
+inline int f7689_18(int x) { return x * 18; }
+inline int f7689_19(int x) { return x * 19; }
+inline int f7689_20(int x) { return x * 20; }
+inline int f7689_21(int x) { return x * 21; }
+inline int f7689_22(int x) { return x * 22; }
+inline int f7689_23(int x) { return x * 23; }
+inline int f7689_24(int x) { return x * 24; }
+inline int f7689_25(int x) { return x * 25; }
+inline int f7689_26(int x) { return x * 26; }
+inline int f7689_27(int x) { return x * 27; }
+inline int f7689_28(int x) { return x * 28; }
+inline int f7689_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7694 */
+#include <vector>
+#include "h8822.h"
+#include "h5768.h"
+#include "h5209.h"
+#include "h8455.h"
+#include "h1912.h"
+#ifdef X
+#include "h1134.h"
+#endif
+struct S7694 { int a; const char *s = "x//y"; };
+inline int f7694_0(int x) { return x * 0; }
+inline int f7694_1(int x) { return x * 1; }
+inline int f7694_2(int x) { return x * 2; }
+inline int f7694_3(int x) { return x * 3; }
+inline int f7694_4(int x) { return x * 4; }
+inline int f7694_5(int x) { return x * 5; }
+inline int f7694_6(int x) { return x * 6; }
+inline int f7694_7(int x) { return x * 7; }
+inline int f7694_8(int x) { return x * 8; }
+inline int f7694_9(int x) { return x * 9; }
+inline int f7694_10(int x) { return x * 10; }
+inline int f7694_11(int x) { return x * 11; }
+inline int f7694_12(int x) { return x * 12; }
+inline int f7694_13(int x) { return x * 13; }
+inline int f7694_14(int x) { return x * 14; }
+inline int f7694_15(int x) { return x * 15; }
+inline int f7694_16(int x) { return x * 16; }
+inline int f7694_17(int x) { return x * 17; }
+inline int f7694_18(int x) { return x * 18; }
+inline int f7694_19(int x) { return x * 19; }
+inline int f7694_20(int x) { return x * 20; }
+inline int f7694_21(int x) { return x * 21; }
+inline int f7694_22(int x) { return x * 22; }
+inline int f7694_23(int x) { return x * 23; }
+inline int f7694_24(int x) { return x * 24; }
+inline int f7694_25(int x) { return x * 25; }
+inline int f7694_26(int x) { return x * 26; }
+inline int f7694_27(int x) { return x * 27; }
+inline int f7694_28(int x) { return x * 28; }
+inline int f7694_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7697 */
+#include <vector>
+#include "h1509.h"
+#include "h2403.h"
+#include "h501.h"
+#include "h1007.h"
+#include "h8679.h"
+#ifdef X
+#include "h5835.h"
+#endif
+struct S7697 { int a; const char *s = "x//y"; };
+inline int f7697_0(int x) { return x * 0; }
+inline int f7697_1(int x) { return x * 1; }
+inline int f7697_2(int x) { return x * 2; }
+inline int f7697_3(int x) { return x * 3; }
+inline int f7697_4(int x) { return x * 4; }
+inline int f7697_5(int x) { return x * 5; }
+inline int f7697_6(int x) { return x * 6; }
+inline int f7697_7(int x) { return x * 7; }
+inline int f7697_8(int x) { return x * 8; }
+inline int f7697_9(int x) { return x * 9; }
+inline int f7697_10(int x) { return x * 10; }
+inline int f7697_11(int x) { return x * 11; }
+inline int f7697_12(int x) { return x * 12; }
+inline int f7697_13(int x) { return x * 13; }
+inline int f7697_14(int x) { return x * 14; }
+inline int f7697_15(int x) { return x * 15; }
+inline int f7697_16(int x) { return x * 16; }
+inline int f7697_17(int x) { return x * 17; }
+inline int f7697_18(int x) { return x * 18; }
+inline int f7697_19(int x) { return x * 19; }
+inline int f7697_20(int x) { return x * 20; }
+inline int f7697_21(int x) { return x * 21; }
+inline int f7697_22(int x) { return x * 22; }
+inline int f7697_23(int x) { return x * 23; }
+inline int f7697_24(int x) { return x * 24; }
+inline int f7697_25(int x) { return x * 25; }
+inline int f7697_26(int x) { return x * 26; }
+inline int f7697_27(int x) { return x * 27; }
+inline int f7697_28(int x) { return x * 28; }
+inline int f7697_29(int x) { return x * 29; }
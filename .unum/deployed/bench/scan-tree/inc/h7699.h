@@ -0,0 +1,42 @@
+#pragma once
+/* header 7699 */
+#include <vector>
+#include "h2366.h"
+#include "h4597.h"
+#include "h6427.h"
+#include "h3597.h"
+#include "h6505.h"
+#ifdef X
+#include "h9410.h"
+#endif
+struct S7699 { int a; const char *s = "x//y"; };
+inline int f7699_0(int x) { return x * 0; }
+inline int f7699_1(int x) { return x * 1; }
+inline int f7699_2(int x) { return x * 2; }
+inline int f7699_3(int x) { return x * 3; }
+inline int f7699_4(int x) { return x * 4; }
+inline int f7699_5(int x) { return x * 5; }
+inline int f7699_6(int x) { return x * 6; }
+inline int f7699_7(int x) { return x * 7; }
+inline int f7699_8(int x) { return x * 8; }
+inline int f7699_9(int x) { return x * 9; }
+inline int f7699_10(int x) { return x * 10; }
+inline int f7699_11(int x) { return x * 11; }
+inline int f7699_12(int x) { return x * 12; }
+inline int f7699_13(int x) { return x * 13; }
+inline int f7699_14(int x) { return x * 14; }
+inline int f7699_15(int x) { return x * 15; }
+inline int f7699_16(int x) { return x * 16; }
+inline int f7699_17(int x) { return x * 17; }
+inline int f7699_18(int x) { return x * 18; }
+inline int f7699_19(int x) { return x * 19; }
+inline int f7699_20(int x) { return x * 20; }
+inline int f7699_21(int x) { return x * 21; }
+inline int f7699_22(int x) { return x * 22; }
+inline int f7699_23(int x) { return x * 23; }
+inline int f7699_24(int x) { return x * 24; }
+inline int f7699_25(int x) { return x * 25; }
+inline int f7699_26(int x) { return x * 26; }
+inline int f7699_27(int x) { return x * 27; }
+inline int f7699_28(int x) { return x * 28; }
+inline int f7699_29(int x) { return x * 29; }
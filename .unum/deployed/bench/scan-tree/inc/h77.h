@@ -0,0 +1,42 @@
+#pragma once
+/* header 77 */
+#include <vector>
+#include "h510.h"
+#include "h8801.h"
+#include "h7038.h"
+#include "h7752.h"
+#include "h8834.h"
+#ifdef X
+#include "h7621.h"
+#endif
+struct S77 { int a; const char *s = "x//y"; };
+inline int f77_0(int x) { return x * 0; }
+inline int f77_1(int x) { return x * 1; }
+inline int f77_2(int x) { return x * 2; }
+inline int f77_3(int x) { return x * 3; }
+inline int f77_4(int x) { return x * 4; }
+inline int f77_5(int x) { return x * 5; }
+inline int f77_6(int x) { return x * 6; }
+inline int f77_7(int x) { return x * 7; }
+inline int f77_8(int x) { return x * 8; }
+inline int f77_9(int x) { return x * 9; }
+inline int f77_10(int x) { return x * 10; }
+inline int f77_11(int x) { return x * 11; }
+inline int f77_12(int x) { return x * 12; }
+inline int f77_13(int x) { return x * 13; }
+inline int f77_14(int x) { return x * 14; }
+inline int f77_15(int x) { return x * 15; }
+inline int f77_16(int x) { return x * 16; }
+inline int f77_17(int x) { return x * 17; }
+inline int f77_18(int x) { return x * 18; }
+inline int f77_19(int x) { return x * 19; }
+inline int f77_20(int x) { return x * 20; }
+inline int f77_21(int x) { return x * 21; }
+inline int f77_22(int x) { return x * 22; }
+inline int f77_23(int x) { return x * 23; }
+inline int f77_24(int x) { return x * 24; }
+inline int f77_25(int x) { return x * 25; }
+inline int f77_26(int x) { return x * 26; }
+inline int f77_27(int x) { return x * 27; }
+inline int f77_28(int x) { return x * 28; }
+inline int f77_29(int x) { return x * 29; }
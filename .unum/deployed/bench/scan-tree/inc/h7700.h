@@ -0,0 +1,42 @@
+#pragma once
+/* header 7700 */
+#include <vector>
+#include "h4233.h"
+#include "h3833.h"
+#include "h9034.h"
+#include "h7171.h"
+#include "h7257.h"
+#ifdef X
+#include "h5996.h"
+#endif
+struct S7700 { int a; const char *s = "x//y"; };
+inline int f7700_0(int x) { return x * 0; }
+inline int f7700_1(int x) { return x * 1; }
+inline int f7700_2(int x) { return x * 2; }
+inline int f7700_3(int x) { return x * 3; }
+inline int f7700_4(int x) { return x * 4; }
+inline int f7700_5(int x) { return x * 5; }
+inline int f7700_6(int x) { return x * 6; }
+inline int f7700_7(int x) { return x * 7; }
+inline int f7700_8(int x) { return x * 8; }
+inline int f7700_9(int x) { return x * 9; }
+inline int f7700_10(int x) { return x * 10; }
+inline int f7700_11(int x) { return x * 11; }
+inline int f7700_12(int x) { return x * 12; }
+inline int f7700_13(int x) { return x * 13; }
+inline int f7700_14(int x) { return x * 14; }
+inline int f7700_15(int x) { return x * 15; }
+inline int f7700_16(int x) { return x * 16; }
+inline int f7700_17(int x) { return x * 17; }
+inline int f7700_18(int x) { return x * 18; }
+inline int f7700_19(int x) { return x * 19; }
+inline int f7700_20(int x) { return x * 20; }
+inline int f7700_21(int x) { return x * 21; }
+inline int f7700_22(int x) { return x * 22; }
+inline int f7700_23(int x) { return x * 23; }
+inline int f7700_24(int x) { return x * 24; }
+inline int f7700_25(int x) { return x * 25; }
+inline int f7700_26(int x) { return x * 26; }
+inline int f7700_27(int x) { return x * 27; }
+inline int f7700_28(int x) { return x * 28; }
+inline int f7700_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7702 */
+#include <vector>
+#include "h3924.h"
+#include "h5275.h"
+#include "h7212.h"
+#include "h8647.h"
+#include "h9529.h"
+#ifdef X
+#include "h2819.h"
+#endif
+struct S7702 { int a; const char *s = "x//y"; };
+inline int f7702_0(int x) { return x * 0; }
+inline int f7702_1(int x) { return x * 1; }
+inline int f7702_2(int x) { return x * 2; }
+inline int f7702_3(int x) { return x * 3; }
+inline int f7702_4(int x) { return x * 4; }
+inline int f7702_5(int x) { return x * 5; }
+inline int f7702_6(int x) { return x * 6; }
+inline int f7702_7(int x) { return x * 7; }
+inline int f7702_8(int x) { return x * 8; }
+inline int f7702_9(int x) { return x * 9; }
+inline int f7702_10(int x) { return x * 10; }
+inline int f7702_11(int x) { return x * 11; }
+inline int f7702_12(int x) { return x * 12; }
+inline int f7702_13(int x) { return x * 13; }
+inline int f7702_14(int x) { return x * 14; }
+inline int f7702_15(int x) { return x * 15; }
+inline int f7702_16(int x) { return x * 16; }
+inline int f7702_17(int x) { return x * 17; }
+inline int f7702_18(int x) { return x * 18; }
+inline int f7702_19(int x) { return x * 19; }
+inline int f7702_20(int x) { return x * 20; }
+inline int f7702_21(int x) { return x * 21; }
+inline int f7702_22(int x) { return x * 22; }
+inline int f7702_23(int x) { return x * 23; }
+inline int f7702_24(int x) { return x * 24; }
+inline int f7702_25(int x) { return x * 25; }
+inline int f7702_26(int x) { return x * 26; }
+inline int f7702_27(int x) { return x * 27; }
+inline int f7702_28(int x) { return x * 28; }
+inline int f7702_29(int x) { return x * 29; }
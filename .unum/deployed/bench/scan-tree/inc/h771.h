@@ -0,0 +1,42 @@
+#pragma once
+/* header 771 */
+#include <vector>
+#include "h4363.h"
+#include "h630.h"
+#include "h3725.h"
+#include "h6436.h"
+#include "h4356.h"
+#ifdef X
+#include "h7464.h"
+#endif
+struct S771 { int a; const char *s = "x//y"; };
+inline int f771_0(int x) { return x * 0; }
+inline int f771_1(int x) { return x * 1; }
+inline int f771_2(int x) { return x * 2; }
+inline int f771_3(int x) { return x * 3; }
+inline int f771_4(int x) { return x * 4; }
+inline int f771_5(int x) { return x * 5; }
+inline int f771_6(int x) { return x * 6; }
+inline int f771_7(int x) { return x * 7; }
+inline int f771_8(int x) { return x * 8; }
+inline int f771_9(int x) { return x * 9; }
+inline int f771_10(int x) { return x * 10; }
+inline int f771_11(int x) { return x * 11; }
+inline int f771_12(int x) { return x * 12; }
+inline int f771_13(int x) { return x * 13; }
+inline int f771_14(int x) { return x * 14; }
+inline int f771_15(int x) { return x * 15; }
+inline int f771_16(int x) { return x * 16; }
+inline int f771_17(int x) { return x * 17; }
+inline int f771_18(int x) { return x * 18; }
+inline int f771_19(int x) { return x * 19; }
+inline int f771_20(int x) { return x * 20; }
+inline int f771_21(int x) { return x * 21; }
+inline int f771_22(int x) { return x * 22; }
+inline int f771_23(int x) { return x * 23; }
+inline int f771_24(int x) { return x * 24; }
+inline int f771_25(int x) { return x * 25; }
+inline int f771_26(int x) { return x * 26; }
+inline int f771_27(int x) { return x * 27; }
+inline int f771_28(int x) { return x * 28; }
+inline int f771_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7710 */
+#include <vector>
+#include "h9216.h"
+#include "h1790.h"
+#include "h5396.h"
+#include "h661.h"
+#include "h9453.h"
+#ifdef X
+#include "h5628.h"
+#endif
+struct S7710 { int a; const char *s = "x//y"; };
+inline int f7710_0(int x) { return x * 0; }
+inline int f7710_1(int x) { return x * 1; }
+inline int f7710_2(int x) { return x * 2; }
+inline int f7710_3(int x) { return x * 3; }
+inline int f7710_4(int x) { return x * 4; }
+inline int f7710_5(int x) { return x * 5; }
+inline int f7710_6(int x) { return x * 6; }
+inline int f7710_7(int x) { return x * 7; }
+inline int f7710_8(int x) { return x * 8; }
+inline int f7710_9(int x) { return x * 9; }
+inline int f7710_10(int x) { return x * 10; }
+inline int f7710_11(int x) { return x * 11; }
+inline int f7710_12(int x) { return x * 12; }
+inline int f7710_13(int x) { return x * 13; }
+inline int f7710_14(int x) { return x * 14; }
+inline int f7710_15(int x) { return x * 15; }
+inline int f7710_16(int x) { return x * 16; }
+inline int f7710_17(int x) { return x * 17; }
+inline int f7710_18(int x) { return x * 18; }
+inline int f7710_19(int x) { return x * 19; }
+inline int f7710_20(int x) { return x * 20; }
+inline int f7710_21(int x) { return x * 21; }
+inline int f7710_22(int x) { return x * 22; }
+inline int f7710_23(int x) { return x * 23; }
+inline int f7710_24(int x) { return x * 24; }
+inline int f7710_25(int x) { return x * 25; }
+inline int f7710_26(int x) { return x * 26; }
+inline int f7710_27(int x) { return x * 27; }
+inline int f7710_28(int x) { return x * 28; }
+inline int f7710_29(int x) { return x * 29; }
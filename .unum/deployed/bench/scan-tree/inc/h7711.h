@@ -0,0 +1,42 @@
+#pragma once
+/* header 7711 */
+#include <vector>
+#include "h6221.h"
+#include "h9663.h"
+#include "h6333.h"
+#include "h9135.h"
+#include "h3263.h"
+#ifdef X
+#include "h2978.h"
+#endif
+struct S7711 { int a; const char *s = "x//y"; };
+inline int f7711_0(int x) { return x * 0; }
+inline int f7711_1(int x) { return x * 1; }
+inline int f7711_2(int x) { return x * 2; }
+inline int f7711_3(int x) { return x * 3; }
+inline int f7711_4(int x) { return x * 4; }
+inline int f7711_5(int x) { return x * 5; }
+inline int f7711_6(int x) { return x * 6; }
+inline int f7711_7(int x) { return x * 7; }
+inline int f7711_8(int x) { return x * 8; }
+inline int f7711_9(int x) { return x * 9; }
+inline int f7711_10(int x) { return x * 10; }
+inline int f7711_11(int x) { return x * 11; }
+inline int f7711_12(int x) { return x * 12; }
+inline int f7711_13(int x) { return x * 13; }
+inline int f7711_14(int x) { return x * 14; }
+inline int f7711_15(int x) { return x * 15; }
+inline int f7711_16(int x) { return x * 16; }
+inline int f7711_17(int x) { return x * 17; }
+inline int f7711_18(int x) { return x * 18; }
+inline int f7711_19(int x) { return x * 19; }
+inline int f7711_20(int x) { return x * 20; }
+inline int f7711_21(int x) { return x * 21; }
+inline int f7711_22(int x) { return x * 22; }
+inline int f7711_23(int x) { return x * 23; }
+inline int f7711_24(int x) { return x * 24; }
+inline int f7711_25(int x) { return x * 25; }
+inline int f7711_26(int x) { return x * 26; }
+inline int f7711_27(int x) { return x * 27; }
+inline int f7711_28(int x) { return x * 28; }
+inline int f7711_29(int x) { return x * 29; }
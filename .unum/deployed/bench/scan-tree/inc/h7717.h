@@ -0,0 +1,42 @@
+#pragma once
+/* header 7717 */
+#include <vector>
+#include "h4919.h"
+#include "h8934.h"
+#include "h9902.h"
+#include "h3875.h"
+#include "h7896.h"
+#ifdef X
+#include "h3284.h"
+#endif
+struct S7717 { int a; const char *s = "x//y"; };
+inline int f7717_0(int x) { return x * 0; }
+inline int f7717_1(int x) { return x * 1; }
+inline int f7717_2(int x) { return x * 2; }
+inline int f7717_3(int x) { return x * 3; }
+inline int f7717_4(int x) { return x * 4; }
+inline int f7717_5(int x) { return x * 5; }
+inline int f7717_6(int x) { return x * 6; }
+inline int f7717_7(int x) { return x * 7; }
+inline int f7717_8(int x) { return x * 8; }
+inline int f7717_9(int x) { return x * 9; }
+inline int f7717_10(int x) { return x * 10; }
+inline int f7717_11(int x) { return x * 11; }
+inline int f7717_12(int x) { return x * 12; }
+inline int f7717_13(int x) { return x * 13; }
+inline int f7717_14(int x) { return x * 14; }
+inline int f7717_15(int x) { return x * 15; }
+inline int f7717_16(int x) { return x * 16; }
+inline int f7717_17(int x) { return x * 17; }
+inline int f7717_18(int x) { return x * 18; }
+inline int f7717_19(int x) { return x * 19; }
+inline int f7717_20(int x) { return x * 20; }
+inline int f7717_21(int x) { return x * 21; }
+inline int f7717_22(int x) { return x * 22; }
+inline int f7717_23(int x) { return x * 23; }
+inline int f7717_24(int x) { return x * 24; }
+inline int f7717_25(int x) { return x * 25; }
+inline int f7717_26(int x) { return x * 26; }
+inline int f7717_27(int x) { return x * 27; }
+inline int f7717_28(int x) { return x * 28; }
+inline int f7717_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7718 */
+#include <vector>
+#include "h7029.h"
+#include "h648.h"
+#include "h7188.h"
+#include "h6788.h"
+#include "h3387.h"
+#ifdef X
+#include "h534.h"
+#endif
+struct S7718 { int a; const char *s = "x//y"; };
+inline int f7718_0(int x) { return x * 0; }
+inline int f7718_1(int x) { return x * 1; }
+inline int f7718_2(int x) { return x * 2; }
+inline int f7718_3(int x) { return x * 3; }
+inline int f7718_4(int x) { return x * 4; }
+inline int f7718_5(int x) { return x * 5; }
+inline int f7718_6(int x) { return x * 6; }
+inline int f7718_7(int x) { return x * 7; }
+inline int f7718_8(int x) { return x * 8; }
+inline int f7718_9(int x) { return x * 9; }
+inline int f7718_10(int x) { return x * 10; }
+inline int f7718_11(int x) { return x * 11; }
+inline int f7718_12(int x) { return x * 12; }
+inline int f7718_13(int x) { return x * 13; }
+inline int f7718_14(int x) { return x * 14; }
+inline int f7718_15(int x) { return x * 15; }
+inline int f7718_16(int x) { return x * 16; }
+inline int f7718_17(int x) { return x * 17; }
+inline int f7718_18(int x) { return x * 18; }
+inline int f7718_19(int x) { return x * 19; }
+inline int f7718_20(int x) { return x * 20; }
+inline int f7718_21(int x) { return x * 21; }
+inline int f7718_22(int x) { return x * 22; }
+inline int f7718_23(int x) { return x * 23; }
+inline int f7718_24(int x) { return x * 24; }
+inline int f7718_25(int x) { return x * 25; }
+inline int f7718_26(int x) { return x * 26; }
+inline int f7718_27(int x) { return x * 27; }
+inline int f7718_28(int x) { return x * 28; }
+inline int f7718_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7722 */
+#include <vector>
+#include "h8684.h"
+#include "h4040.h"
+#include "h9350.h"
+#include "h3345.h"
+#include "h7538.h"
+#ifdef X
+#include "h8333.h"
+#endif
+struct S7722 { int a; const char *s = "x//y"; };
+inline int f7722_0(int x) { return x * 0; }
+inline int f7722_1(int x) { return x * 1; }
+inline int f7722_2(int x) { return x * 2; }
+inline int f7722_3(int x) { return x * 3; }
+inline int f7722_4(int x) { return x * 4; }
+inline int f7722_5(int x) { return x * 5; }
+inline int f7722_6(int x) { return x * 6; }
+inline int f7722_7(int x) { return x * 7; }
+inline int f7722_8(int x) { return x * 8; }
+inline int f7722_9(int x) { return x * 9; }
+inline int f7722_10(int x) { return x * 10; }
+inline int f7722_11(int x) { return x * 11; }
+inline int f7722_12(int x) { return x * 12; }
+inline int f7722_13(int x) { return x * 13; }
+inline int f7722_14(int x) { return x * 14; }
+inline int f7722_15(int x) { return x * 15; }
+inline int f7722_16(int x) { return x * 16; }
+inline int f7722_17(int x) { return x * 17; }
+inline int f7722_18(int x) { return x * 18; }
+inline int f7722_19(int x) { return x * 19; }
+inline int f7722_20(int x) { return x * 20; }
+inline int f7722_21(int x) { return x * 21; }
+inline int f7722_22(int x) { return x * 22; }
+inline int f7722_23(int x) { return x * 23; }
+inline int f7722_24(int x) { return x * 24; }
+inline int f7722_25(int x) { return x * 25; }
+inline int f7722_26(int x) { return x * 26; }
+inline int f7722_27(int x) { return x * 27; }
+inline int f7722_28(int x) { return x * 28; }
+inline int f7722_29(int x) { return x * 29; }
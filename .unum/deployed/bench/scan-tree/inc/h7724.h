@@ -0,0 +1,42 @@
+#pragma once
+/* header 7724 */
+#include <vector>
+#include "h1399.h"
+#include "h650.h"
+#include "h5986.h"
+#include "h8769.h"
+#include "h3421.h"
+#ifdef X
+#include "h351.h"
+#endif
+struct S7724 { int a; const char *s = "x//y"; };
+inline int f7724_0(int x) { return x * 0; }
+inline int f7724_1(int x) { return x * 1; }
+inline int f7724_2(int x) { return x * 2; }
+inline int f7724_3(int x) { return x * 3; }
+inline int f7724_4(int x) { return x * 4; }
+inline int f7724_5(int x) { return x * 5; }
+inline int f7724_6(int x) { return x * 6; }
+inline int f7724_7(int x) { return x * 7; }
+inline int f7724_8(int x) { return x * 8; }
+inline int f7724_9(int x) { return x * 9; }
+inline int f7724_10(int x) { return x * 10; }
+inline int f7724_11(int x) { return x * 11; }
+inline int f7724_12(int x) { return x * 12; }
+inline int f7724_13(int x) { return x * 13; }
+inline int f7724_14(int x) { return x * 14; }
+inline int f7724_15(int x) { return x * 15; }
+inline int f7724_16(int x) { return x * 16; }
+inline int f7724_17(int x) { return x * 17; }
+inline int f7724_18(int x) { return x * 18; }
+inline int f7724_19(int x) { return x * 19; }
+inline int f7724_20(int x) { return x * 20; }
+inline int f7724_21(int x) { return x * 21; }
+inline int f7724_22(int x) { return x * 22; }
+inline int f7724_23(int x) { return x * 23; }
+inline int f7724_24(int x) { return x * 24; }
+inline int f7724_25(int x) { return x * 25; }
+inline int f7724_26(int x) { return x * 26; }
+inline int f7724_27(int x) { return x * 27; }
+inline int f7724_28(int x) { return x * 28; }
+inline int f7724_29(int x) { return x * 29; }
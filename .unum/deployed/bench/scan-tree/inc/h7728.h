@@ -0,0 +1,42 @@
+#pragma once
+/* header 7728 */
+#include <vector>
+#include "h7503.h"
+#include "h3262.h"
+#include "h5744.h"
+#include "h2724.h"
+#include "h9849.h"
+#ifdef X
+#include "h6668.h"
+#endif
+struct S7728 { int a; const char *s = "x//y"; };
+inline int f7728_0(int x) { return x * 0; }
+inline int f7728_1(int x) { return x * 1; }
+inline int f7728_2(int x) { return x * 2; }
+inline int f7728_3(int x) { return x * 3; }
+inline int f7728_4(int x) { return x * 4; }
+inline int f7728_5(int x) { return x * 5; }
+inline int f7728_6(int x) { return x * 6; }
+inline int f7728_7(int x) { return x * 7; }
+inline int f7728_8(int x) { return x * 8; }
+inline int f7728_9(int x) { return x * 9; }
+inline int f7728_10(int x) { return x * 10; }
+inline int f7728_11(int x) { return x * 11; }
+inline int f7728_12(int x) { return x * 12; }
+inline int f7728_13(int x) { return x * 13; }
+inline int f7728_14(int x) { return x * 14; }
+inline int f7728_15(int x) { return x * 15; }
+inline int f7728_16(int x) { return x * 16; }
+inline int f7728_17(int x) { return x * 17; }
+inline int f7728_18(int x) { return x * 18; }
+inline int f7728_19(int x) { return x * 19; }
+inline int f7728_20(int x) { return x * 20; }
+inline int f7728_21(int x) { return x * 21; }
+inline int f7728_22(int x) { return x * 22; }
+inline int f7728_23(int x) { return x * 23; }
+inline int f7728_24(int x) { return x * 24; }
+inline int f7728_25(int x) { return x * 25; }
+inline int f7728_26(int x) { return x * 26; }
+inline int f7728_27(int x) { return x * 27; }
+inline int f7728_28(int x) { return x * 28; }
+inline int f7728_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7733 */
+#include <vector>
+#include "h562.h"
+#include "h2593.h"
+#include "h7008.h"
+#include "h5167.h"
+#include "h6981.h"
+#ifdef X
+#include "h8180.h"
+#endif
+struct S7733 { int a; const char *s = "x//y"; };
+inline int f7733_0(int x) { return x * 0; }
+inline int f7733_1(int x) { return x * 1; }
+inline int f7733_2(int x) { return x * 2; }
+inline int f7733_3(int x) { return x * 3; }
+inline int f7733_4(int x) { return x * 4; }
+inline int f7733_5(int x) { return x * 5; }
+inline int f7733_6(int x) { return x * 6; }
+inline int f7733_7(int x) { return x * 7; }
+inline int f7733_8(int x) { return x * 8; }
+inline int f7733_9(int x) { return x * 9; }
+inline int f7733_10(int x) { return x * 10; }
+inline int f7733_11(int x) { return x * 11; }
+inline int f7733_12(int x) { return x * 12; }
+inline int f7733_13(int x) { return x * 13; }
+inline int f7733_14(int x) { return x * 14; }
+inline int f7733_15(int x) { return x * 15; }
+inline int f7733_16(int x) { return x * 16; }
+inline int f7733_17(int x) { return x * 17; }
+inline int f7733_18(int x) { return x * 18; }
+inline int f7733_19(int x) { return x * 19; }
+inline int f7733_20(int x) { return x * 20; }
+inline int f7733_21(int x) { return x * 21; }
+inline int f7733_22(int x) { return x * 22; }
+inline int f7733_23(int x) { return x * 23; }
+inline int f7733_24(int x) { return x * 24; }
+inline int f7733_25(int x) { return x * 25; }
+inline int f7733_26(int x) { return x * 26; }
+inline int f7733_27(int x) { return x * 27; }
+inline int f7733_28(int x) { return x * 28; }
+inline int f7733_29(int x) { return x * 29; }
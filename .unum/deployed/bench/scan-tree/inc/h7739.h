@@ -0,0 +1,42 @@
+#pragma once
+/* header 7739 */
+#include <vector>
+#include "h5075.h"
+#include "h158.h"
+#include "h2192.h"
+#include "h8431.h"
+#include "h8225.h"
+#ifdef X
+#include "h3509.h"
+#endif
+struct S7739 { int a; const char *s = "x//y"; };
+inline int f7739_0(int x) { return x * 0; }
+inline int f7739_1(int x) { return x * 1; }
+inline int f7739_2(int x) { return x * 2; }
+inline int f7739_3(int x) { return x * 3; }
+inline int f7739_4(int x) { return x * 4; }
+inline int f7739_5(int x) { return x * 5; }
+inline int f7739_6(int x) { return x * 6; }
+inline int f7739_7(int x) { return x * 7; }
+inline int f7739_8(int x) { return x * 8; }
+inline int f7739_9(int x) { return x * 9; }
+inline int f7739_10(int x) { return x * 10; }
+inline int f7739_11(int x) { return x * 11; }
+inline int f7739_12(int x) { return x * 12; }
+inline int f7739_13(int x) { return x * 13; }
+inline int f7739_14(int x) { return x * 14; }
+inline int f7739_15(int x) { return x * 15; }
+inline int f7739_16(int x) { return x * 16; }
+inline int f7739_17(int x) { return x * 17; }
+inline int f7739_18(int x) { return x * 18; }
+inline int f7739_19(int x) { return x * 19; }
+inline int f7739_20(int x) { return x * 20; }
+inline int f7739_21(int x) { return x * 21; }
+inline int f7739_22(int x) { return x * 22; }
+inline int f7739_23(int x) { return x * 23; }
+inline int f7739_24(int x) { return x * 24; }
+inline int f7739_25(int x) { return x * 25; }
+inline int f7739_26(int x) { return x * 26; }
+inline int f7739_27(int x) { return x * 27; }
+inline int f7739_28(int x) { return x * 28; }
+inline int f7739_29(int x) { return x * 29; }
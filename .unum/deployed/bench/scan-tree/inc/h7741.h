@@ -0,0 +1,42 @@
+#pragma once
+/* header 7741 */
+#include <vector>
+#include "h4941.h"
+#include "h9917.h"
+#include "h6544.h"
+#include "h4789.h"
+#include "h6716.h"
+#ifdef X
+#include "h9191.h"
+#endif
+struct S7741 { int a; const char *s = "x//y"; };
+inline int f7741_0(int x) { return x * 0; }
+inline int f7741_1(int x) { return x * 1; }
+inline int f7741_2(int x) { return x * 2; }
+inline int f7741_3(int x) { return x * 3; }
+inline int f7741_4(int x) { return x * 4; }
+inline int f7741_5(int x) { return x * 5; }
+inline int f7741_6(int x) { return x * 6; }
+inline int f7741_7(int x) { return x * 7; }
+inline int f7741_8(int x) { return x * 8; }
+inline int f7741_9(int x) { return x * 9; }
+inline int f7741_10(int x) { return x * 10; }
+inline int f7741_11(int x) { return x * 11; }
+inline int f7741_12(int x) { return x * 12; }
+inline int f7741_13(int x) { return x * 13; }
+inline int f7741_14(int x) { return x * 14; }
+inline int f7741_15(int x) { return x * 15; }
+inline int f7741_16(int x) { return x * 16; }
+inline int f7741_17(int x) { return x * 17; }
+inline int f7741_18(int x) { return x * 18; }
+inline int f7741_19(int x) { return x * 19; }
+inline int f7741_20(int x) { return x * 20; }
+inline int f7741_21(int x) { return x * 21; }
+inline int f7741_22(int x) { return x * 22; }
+inline int f7741_23(int x) { return x * 23; }
+inline int f7741_24(int x) { return x * 24; }
+inline int f7741_25(int x) { return x * 25; }
+inline int f7741_26(int x) { return x * 26; }
+inline int f7741_27(int x) { return x * 27; }
+inline int f7741_28(int x) { return x * 28; }
+inline int f7741_29(int x) { return x * 29; }
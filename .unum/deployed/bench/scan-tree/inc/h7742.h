@@ -0,0 +1,42 @@
+#pragma once
+/* header 7742 */
+#include <vector>
+#include "h101.h"
+#include "h6209.h"
+#include "h7456.h"
+#include "h77.h"
+#include "h9753.h"
+#ifdef X
+#include "h5867.h"
+#endif
+struct S7742 { int a; const char *s = "x//y"; };
+inline int f7742_0(int x) { return x * 0; }
+inline int f7742_1(int x) { return x * 1; }
+inline int f7742_2(int x) { return x * 2; }
+inline int f7742_3(int x) { return x * 3; }
+inline int f7742_4(int x) { return x * 4; }
+inline int f7742_5(int x) { return x * 5; }
+inline int f7742_6(int x) { return x * 6; }
+inline int f7742_7(int x) { return x * 7; }
+inline int f7742_8(int x) { return x * 8; }
+inline int f7742_9(int x) { return x * 9; }
+inline int f7742_10(int x) { return x * 10; }
+inline int f7742_11(int x) { return x * 11; }
+inline int f7742_12(int x) { return x * 12; }
+inline int f7742_13(int x) { return x * 13; }
+inline int f7742_14(int x) { return x * 14; }
+inline int f7742_15(int x) { return x * 15; }
+inline int f7742_16(int x) { return x * 16; }
+inline int f7742_17(int x) { return x * 17; }
+inline int f7742_18(int x) { return x * 18; }
+inline int f7742_19(int x) { return x * 19; }
+inline int f7742_20(int x) { return x * 20; }
+inline int f7742_21(int x) { return x * 21; }
+inline int f7742_22(int x) { return x * 22; }
+inline int f7742_23(int x) { return x * 23; }
+inline int f7742_24(int x) { return x * 24; }
+inline int f7742_25(int x) { return x * 25; }
+inline int f7742_26(int x) { return x * 26; }
+inline int f7742_27(int x) { return x * 27; }
+inline int f7742_28(int x) { return x * 28; }
+inline int f7742_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7743 */
+#include <vector>
+#include "h8094.h"
+#include "h645.h"
+#include "h3029.h"
+#include "h7104.h"
+#include "h6027.h"
+#ifdef X
+#include "h3902.h"
+#endif
+struct S7743 { int a; const char *s = "x//y"; };
+inline int f7743_0(int x) { return x * 0; }
+inline int f7743_1(int x) { return x * 1; }
+inline int f7743_2(int x) { return x * 2; }
+inline int f7743_3(int x) { return x * 3; }
+inline int f7743_4(int x) { return x * 4; }
+inline int f7743_5(int x) { return x * 5; }
+inline int f7743_6(int x) { return x * 6; }
+inline int f7743_7(int x) { return x * 7; }
+inline int f7743_8(int x) { return x * 8; }
+inline int f7743_9(int x) { return x * 9; }
+inline int f7743_10(int x) { return x * 10; }
+inline int f7743_11(int x) { return x * 11; }
+inline int f7743_12(int x) { return x * 12; }
+inline int f7743_13(int x) { return x * 13; }
+inline int f7743_14(int x) { return x * 14; }
+inline int f7743_15(int x) { return x * 15; }
+inline int f7743_16(int x) { return x * 16; }
+inline int f7743_17(int x) { return x * 17; }
+inline int f7743_18(int x) { return x * 18; }
+inline int f7743_19(int x) { return x * 19; }
+inline int f7743_20(int x) { return x * 20; }
+inline int f7743_21(int x) { return x * 21; }
+inline int f7743_22(int x) { return x * 22; }
+inline int f7743_23(int x) { return x * 23; }
+inline int f7743_24(int x) { return x * 24; }
+inline int f7743_25(int x) { return x * 25; }
+inline int f7743_26(int x) { return x * 26; }
+inline int f7743_27(int x) { return x * 27; }
+inline int f7743_28(int x) { return x * 28; }
+inline int f7743_29(int x) { return x * 29; }
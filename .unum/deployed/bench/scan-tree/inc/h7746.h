@@ -0,0 +1,42 @@
+#pragma once
+/* header 7746 */
+#include <vector>
+#include "h6779.h"
+#include "h175.h"
+#include "h5145.h"
+#include "h8306.h"
+#include "h5794.h"
+#ifdef X
+#include "h4954.h"
+#endif
+struct S7746 { int a; const char *s = "x//y"; };
+inline int f7746_0(int x) { return x * 0; }
+inline int f7746_1(int x) { return x * 1; }
+inline int f7746_2(int x) { return x * 2; }
+inline int f7746_3(int x) { return x * 3; }
+inline int f7746_4(int x) { return x * 4; }
+inline int f7746_5(int x) { return x * 5; }
+inline int f7746_6(int x) { return x * 6; }
+inline int f7746_7(int x) { return x * 7; }
+inline int f7746_8(int x) { return x * 8; }
+inline int f7746_9(int x) { return x * 9; }
+inline int f7746_10(int x) { return x * 10; }
+inline int f7746_11(int x) { return x * 11; }
+inline int f7746_12(int x) { return x * 12; }
+inline int f7746_13(int x) { return x * 13; }
+inline int f7746_14(int x) { return x * 14; }
+inline int f7746_15(int x) { return x * 15; }
+inline int f7746_16(int x) { return x * 16; }
+inline int f7746_17(int x) { return x * 17; }
+inline int f7746_18(int x) { return x * 18; }
+inline int f7746_19(int x) { return x * 19; }
+inline int f7746_20(int x) { return x * 20; }
+inline int f7746_21(int x) { return x * 21; }
+inline int f7746_22(int x) { return x * 22; }
+inline int f7746_23(int x) { return x * 23; }
+inline int f7746_24(int x) { return x * 24; }
+inline int f7746_25(int x) { return x * 25; }
+inline int f7746_26(int x) { return x * 26; }
+inline int f7746_27(int x) { return x * 27; }
+inline int f7746_28(int x) { return x * 28; }
+inline int f7746_29(int x) { return x * 29; }
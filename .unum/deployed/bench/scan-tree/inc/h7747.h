@@ -0,0 +1,42 @@
+#pragma once
+/* header 7747 */
+#include <vector>
+#include "h4152.h"
+#include "h7347.h"
+#include "h4179.h"
+#include "h1550.h"
+#include "h714.h"
+#ifdef X
+#include "h4121.h"
+#endif
+struct S7747 { int a; const char *s = "x//y"; };
+inline int f7747_0(int x) { return x * 0; }
+inline int f7747_1(int x) { return x * 1; }
+inline int f7747_2(int x) { return x * 2; }
+inline int f7747_3(int x) { return x * 3; }
+inline int f7747_4(int x) { return x * 4; }
+inline int f7747_5(int x) { return x * 5; }
+inline int f7747_6(int x) { return x * 6; }
+inline int f7747_7(int x) { return x * 7; }
+inline int f7747_8(int x) { return x * 8; }
+inline int f7747_9(int x) { return x * 9; }
+inline int f7747_10(int x) { return x * 10; }
+inline int f7747_11(int x) { return x * 11; }
+inline int f7747_12(int x) { return x * 12; }
+inline int f7747_13(int x) { return x * 13; }
+inline int f7747_14(int x) { return x * 14; }
+inline int f7747_15(int x) { return x * 15; }
+inline int f7747_16(int x) { return x * 16; }
+inline int f7747_17(int x) { return x * 17; }
+inline int f7747_18(int x) { return x * 18; }
+inline int f7747_19(int x) { return x * 19; }
+inline int f7747_20(int x) { return x * 20; }
+inline int f7747_21(int x) { return x * 21; }
+inline int f7747_22(int x) { return x * 22; }
+inline int f7747_23(int x) { return x * 23; }
+inline int f7747_24(int x) { return x * 24; }
+inline int f7747_25(int x) { return x * 25; }
+inline int f7747_26(int x) { return x * 26; }
+inline int f7747_27(int x) { return x * 27; }
+inline int f7747_28(int x) { return x * 28; }
+inline int f7747_29(int x) { return x * 29; }
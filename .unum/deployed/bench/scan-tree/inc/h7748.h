@@ -0,0 +1,42 @@
+#pragma once
+/* header 7748 */
+#include <vector>
+#include "h6969.h"
+#include "h4296.h"
+#include "h420.h"
+#include "h7911.h"
+#include "h887.h"
+#ifdef X
+#include "h9700.h"
+#endif
+struct S7748 { int a; const char *s = "x//y"; };
+inline int f7748_0(int x) { return x * 0; }
+inline int f7748_1(int x) { return x * 1; }
+inline int f7748_2(int x) { return x * 2; }
+inline int f7748_3(int x) { return x * 3; }
+inline int f7748_4(int x) { return x * 4; }
+inline int f7748_5(int x) { return x * 5; }
+inline int f7748_6(int x) { return x * 6; }
+inline int f7748_7(int x) { return x * 7; }
+inline int f7748_8(int x) { return x * 8; }
+inline int f7748_9(int x) { return x * 9; }
+inline int f7748_10(int x) { return x * 10; }
+inline int f7748_11(int x) { return x * 11; }
+inline int f7748_12(int x) { return x * 12; }
+inline int f7748_13(int x) { return x * 13; }
+inline int f7748_14(int x) { return x * 14; }
+inline int f7748_15(int x) { return x * 15; }
+inline int f7748_16(int x) { return x * 16; }
+inline int f7748_17(int x) { return x * 17; }
+inline int f7748_18(int x) { return x * 18; }
+inline int f7748_19(int x) { return x * 19; }
+inline int f7748_20(int x) { return x * 20; }
+inline int f7748_21(int x) { return x * 21; }
+inline int f7748_22(int x) { return x * 22; }
+inline int f7748_23(int x) { return x * 23; }
+inline int f7748_24(int x) { return x * 24; }
+inline int f7748_25(int x) { return x * 25; }
+inline int f7748_26(int x) { return x * 26; }
+inline int f7748_27(int x) { return x * 27; }
+inline int f7748_28(int x) { return x * 28; }
+inline int f7748_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 775 */
+#include <vector>
+#include "h8886.h"
+#include "h8444.h"
+#include "h5684.h"
+#include "h2852.h"
+#include "h1601.h"
+#ifdef X
+#include "h8590.h"
+#endif
+struct S775 { int a; const char *s = "x//y"; };
+inline int f775_0(int x) { return x * 0; }
+inline int f775_1(int x) { return x * 1; }
+inline int f775_2(int x) { return x * 2; }
+inline int f775_3(int x) { return x * 3; }
+inline int f775_4(int x) { return x * 4; }
+inline int f775_5(int x) { return x * 5; }
+inline int f775_6(int x) { return x * 6; }
+inline int f775_7(int x) { return x * 7; }
+inline int f775_8(int x) { return x * 8; }
+inline int f775_9(int x) { return x * 9; }
+inline int f775_10(int x) { return x * 10; }
+inline int f775_11(int x) { return x * 11; }
+inline int f775_12(int x) { return x * 12; }
+inline int f775_13(int x) { return x * 13; }
+inline int f775_14(int x) { return x * 14; }
+inline int f775_15(int x) { return x * 15; }
+inline int f775_16(int x) { return x * 16; }
+inline int f775_17(int x) { return x * 17; }
+inline int f775_18(int x) { return x * 18; }
+inline int f775_19(int x) { return x * 19; }
+inline int f775_20(int x) { return x * 20; }
+inline int f775_21(int x) { return x * 21; }
+inline int f775_22(int x) { return x * 22; }
+inline int f775_23(int x) { return x * 23; }
+inline int f775_24(int x) { return x * 24; }
+inline int f775_25(int x) { return x * 25; }
+inline int f775_26(int x) { return x * 26; }
+inline int f775_27(int x) { return x * 27; }
+inline int f775_28(int x) { return x * 28; }
+inline int f775_29(int x) { return x * 29; }
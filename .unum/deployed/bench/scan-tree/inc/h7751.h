@@ -0,0 +1,42 @@
+#pragma once
+/* header 7751 */
+#include <vector>
+#include "h132.h"
+#include "h1416.h"
+#include "h4826.h"
+#include "h6161.h"
+#include "h2897.h"
+#ifdef X
+#include "h4680.h"
+#endif
+struct S7751 { int a; const char *s = "x//y"; };
+inline int f7751_0(int x) { return x * 0; }
+inline int f7751_1(int x) { return x * 1; }
+inline int f7751_2(int x) { return x * 2; }
+inline int f7751_3(int x) { return x * 3; }
+inline int f7751_4(int x) { return x * 4; }
+inline int f7751_5(int x) { return x * 5; }
+inline int f7751_6(int x) { return x * 6; }
+inline int f7751_7(int x) { return x * 7; }
+inline int f7751_8(int x) { return x * 8; }
+inline int f7751_9(int x) { return x * 9; }
+inline int f7751_10(int x) { return x * 10; }
+inline int f7751_11(int x) { return x * 11; }
+inline int f7751_12(int x) { return x * 12; }
+inline int f7751_13(int x) { return x * 13; }
+inline int f7751_14(int x) { return x * 14; }
+inline int f7751_15(int x) { return x * 15; }
+inline int f7751_16(int x) { return x * 16; }
+inline int f7751_17(int x) { return x * 17; }
+inline int f7751_18(int x) { return x * 18; }
+inline int f7751_19(int x) { return x * 19; }
+inline int f7751_20(int x) { return x * 20; }
+inline int f7751_21(int x) { return x * 21; }
+inline int f7751_22(int x) { return x * 22; }
+inline int f7751_23(int x) { return x * 23; }
+inline int f7751_24(int x) { return x * 24; }
+inline int f7751_25(int x) { return x * 25; }
+inline int f7751_26(int x) { return x * 26; }
+inline int f7751_27(int x) { return x * 27; }
+inline int f7751_28(int x) { return x * 28; }
+inline int f7751_29(int x) { return x * 29; }
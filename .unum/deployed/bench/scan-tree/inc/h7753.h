@@ -0,0 +1,42 @@
+#pragma once
+/* header 7753 */
+#include <vector>
+#include "h2558.h"
+#include "h2500.h"
+#include "h9336.h"
+#include "h566.h"
+#include "h7486.h"
+#ifdef X
+#include "h4777.h"
+#endif
+struct S7753 { int a; const char *s = "x//y"; };
+inline int f7753_0(int x) { return x * 0; }
+inline int f7753_1(int x) { return x * 1; }
+inline int f7753_2(int x) { return x * 2; }
+inline int f7753_3(int x) { return x * 3; }
+inline int f7753_4(int x) { return x * 4; }
+inline int f7753_5(int x) { return x * 5; }
+inline int f7753_6(int x) { return x * 6; }
+inline int f7753_7(int x) { return x * 7; }
+inline int f7753_8(int x) { return x * 8; }
+inline int f7753_9(int x) { return x * 9; }
+inline int f7753_10(int x) { return x * 10; }
+inline int f7753_11(int x) { return x * 11; }
+inline int f7753_12(int x) { return x * 12; }
+inline int f7753_13(int x) { return x * 13; }
+inline int f7753_14(int x) { return x * 14; }
+inline int f7753_15(int x) { return x * 15; }
+inline int f7753_16(int x) { return x * 16; }
+inline int f7753_17(int x) { return x * 17; }
+inline int f7753_18(int x) { return x * 18; }
+inline int f7753_19(int x) { return x * 19; }
+inline int f7753_20(int x) { return x * 20; }
+inline int f7753_21(int x) { return x * 21; }
+inline int f7753_22(int x) { return x * 22; }
+inline int f7753_23(int x) { return x * 23; }
+inline int f7753_24(int x) { return x * 24; }
+inline int f7753_25(int x) { return x * 25; }
+inline int f7753_26(int x) { return x * 26; }
+inline int f7753_27(int x) { return x * 27; }
+inline int f7753_28(int x) { return x * 28; }
+inline int f7753_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7759 */
+#include <vector>
+#include "h5449.h"
+#include "h2186.h"
+#include "h3331.h"
+#include "h4601.h"
+#include "h1871.h"
+#ifdef X
+#include "h6076.h"
+#endif
+struct S7759 { int a; const char *s = "x//y"; };
+inline int f7759_0(int x) { return x * 0; }
+inline int f7759_1(int x) { return x * 1; }
+inline int f7759_2(int x) { return x * 2; }
+inline int f7759_3(int x) { return x * 3; }
+inline int f7759_4(int x) { return x * 4; }
+inline int f7759_5(int x) { return x * 5; }
+inline int f7759_6(int x) { return x * 6; }
+inline int f7759_7(int x) { return x * 7; }
+inline int f7759_8(int x) { return x * 8; }
+inline int f7759_9(int x) { return x * 9; }
+inline int f7759_10(int x) { return x * 10; }
+inline int f7759_11(int x) { return x * 11; }
+inline int f7759_12(int x) { return x * 12; }
+inline int f7759_13(int x) { return x * 13; }
+inline int f7759_14(int x) { return x * 14; }
+inline int f7759_15(int x) { return x * 15; }
+inline int f7759_16(int x) { return x * 16; }
+inline int f7759_17(int x) { return x * 17; }
+inline int f7759_18(int x) { return x * 18; }
+inline int f7759_19(int x) { return x * 19; }
+inline int f7759_20(int x) { return x * 20; }
+inline int f7759_21(int x) { return x * 21; }
+inline int f7759_22(int x) { return x * 22; }
+inline int f7759_23(int x) { return x * 23; }
+inline int f7759_24(int x) { return x * 24; }
+inline int f7759_25(int x) { return x * 25; }
+inline int f7759_26(int x) { return x * 26; }
+inline int f7759_27(int x) { return x * 27; }
+inline int f7759_28(int x) { return x * 28; }
+inline int f7759_29(int x) { return x * 29; }
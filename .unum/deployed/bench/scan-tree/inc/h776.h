@@ -0,0 +1,42 @@
+#pragma once
+/* header 776 */
+#include <vector>
+#include "h3729.h"
+#include "h5912.h"
+#include "h4479.h"
+#include "h1697.h"
+#include "h2361.h"
+#ifdef X
+#include "h2657.h"
+#endif
+struct S776 { int a; const char *s = "x//y"; };
+inline int f776_0(int x) { return x * 0; }
+inline int f776_1(int x) { return x * 1; }
+inline int f776_2(int x) { return x * 2; }
+inline int f776_3(int x) { return x * 3; }
+inline int f776_4(int x) { return x * 4; }
+inline int f776_5(int x) { return x * 5; }
+inline int f776_6(int x) { return x * 6; }
+inline int f776_7(int x) { return x * 7; }
+inline int f776_8(int x) { return x * 8; }
+inline int f776_9(int x) { return x * 9; }
+inline int f776_10(int x) { return x * 10; }
+inline int f776_11(int x) { return x * 11; }
+inline int f776_12(int x) { return x * 12; }
+inline int f776_13(int x) { return x * 13; }
+inline int f776_14(int x) { return x * 14; }
+inline int f776_15(int x) { return x * 15; }
+inline int f776_16(int x) { return x * 16; }
+inline int f776_17(int x) { return x * 17; }
+inline int f776_18(int x) { return x * 18; }
+inline int f776_19(int x) { return x * 19; }
+inline int f776_20(int x) { return x * 20; }
+inline int f776_21(int x) { return x * 21; }
+inline int f776_22(int x) { return x * 22; }
+inline int f776_23(int x) { return x * 23; }
+inline int f776_24(int x) { return x * 24; }
+inline int f776_25(int x) { return x * 25; }
+inline int f776_26(int x) { return x * 26; }
+inline int f776_27(int x) { return x * 27; }
+inline int f776_28(int x) { return x * 28; }
+inline int f776_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7760 */
+#include <vector>
+#include "h5129.h"
+#include "h985.h"
+#include "h621.h"
+#include "h4863.h"
+#include "h1851.h"
+#ifdef X
+#include "h4851.h"
+#endif
+struct S7760 { int a; const char *s = "x//y"; };
+inline int f7760_0(int x) { return x * 0; }
+inline int f7760_1(int x) { return x * 1; }
+inline int f7760_2(int x) { return x * 2; }
+inline int f7760_3(int x) { return x * 3; }
+inline int f7760_4(int x) { return x * 4; }
+inline int f7760_5(int x) { return x * 5; }
+inline int f7760_6(int x) { return x * 6; }
+inline int f7760_7(int x) { return x * 7; }
+inline int f7760_8(int x) { return x * 8; }
+inline int f7760_9(int x) { return x * 9; }
+inline int f7760_10(int x) { return x * 10; }
+inline int f7760_11(int x) { return x * 11; }
+inline int f7760_12(int x) { return x * 12; }
+inline int f7760_13(int x) { return x * 13; }
+inline int f7760_14(int x) { return x * 14; }
+inline int f7760_15(int x) { return x * 15; }
+inline int f7760_16(int x) { return x * 16; }
+inline int f7760_17(int x) { return x * 17; }
+inline int f7760_18(int x) { return x * 18; }
+inline int f7760_19(int x) { return x * 19; }
+inline int f7760_20(int x) { return x * 20; }
+inline int f7760_21(int x) { return x * 21; }
+inline int f7760_22(int x) { return x * 22; }
+inline int f7760_23(int x) { return x * 23; }
+inline int f7760_24(int x) { return x * 24; }
+inline int f7760_25(int x) { return x * 25; }
+inline int f7760_26(int x) { return x * 26; }
+inline int f7760_27(int x) { return x * 27; }
+inline int f7760_28(int x) { return x * 28; }
+inline int f7760_29(int x) { return x * 29; }
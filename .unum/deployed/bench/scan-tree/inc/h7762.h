@@ -0,0 +1,42 @@
+#pragma once
+/* header 7762 */
+#include <vector>
+#include "h4224.h"
+#include "h5522.h"
+#include "h8517.h"
+#include "h5562.h"
+#include "h3355.h"
+#ifdef X
+#include "h9503.h"
+#endif
+struct S7762 { int a; const char *s = "x//y"; };
+inline int f7762_0(int x) { return x * 0; }
+inline int f7762_1(int x) { return x * 1; }
+inline int f7762_2(int x) { return x * 2; }
+inline int f7762_3(int x) { return x * 3; }
+inline int f7762_4(int x) { return x * 4; }
+inline int f7762_5(int x) { return x * 5; }
+inline int f7762_6(int x) { return x * 6; }
+inline int f7762_7(int x) { return x * 7; }
+inline int f7762_8(int x) { return x * 8; }
+inline int f7762_9(int x) { return x * 9; }
+inline int f7762_10(int x) { return x * 10; }
+inline int f7762_11(int x) { return x * 11; }
+inline int f7762_12(int x) { return x * 12; }
+inline int f7762_13(int x) { return x * 13; }
+inline int f7762_14(int x) { return x * 14; }
+inline int f7762_15(int x) { return x * 15; }
+inline int f7762_16(int x) { return x * 16; }
+inline int f7762_17(int x) { return x * 17; }
+inline int f7762_18(int x) { return x * 18; }
+inline int f7762_19(int x) { return x * 19; }
+inline int f7762_20(int x) { return x * 20; }
+inline int f7762_21(int x) { return x * 21; }
+inline int f7762_22(int x) { return x * 22; }
+inline int f7762_23(int x) { return x * 23; }
+inline int f7762_24(int x) { return x * 24; }
+inline int f7762_25(int x) { return x * 25; }
+inline int f7762_26(int x) { return x * 26; }
+inline int f7762_27(int x) { return x * 27; }
+inline int f7762_28(int x) { return x * 28; }
+inline int f7762_29(int x) { return x * 29; }
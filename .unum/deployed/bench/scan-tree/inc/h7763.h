@@ -0,0 +1,42 @@
+#pragma once
+/* header 7763 */
+#include <vector>
+#include "h9670.h"
+#include "h2921.h"
+#include "h7238.h"
+#include "h6653.h"
+#include "h7640.h"
+#ifdef X
+#include "h2724.h"
+#endif
+struct S7763 { int a; const char *s = "x//y"; };
+inline int f7763_0(int x) { return x * 0; }
+inline int f7763_1(int x) { return x * 1; }
+inline int f7763_2(int x) { return x * 2; }
+inline int f7763_3(int x) { return x * 3; }
+inline int f7763_4(int x) { return x * 4; }
+inline int f7763_5(int x) { return x * 5; }
+inline int f7763_6(int x) { return x * 6; }
+inline int f7763_7(int x) { return x * 7; }
+inline int f7763_8(int x) { return x * 8; }
+inline int f7763_9(int x) { return x * 9; }
+inline int f7763_10(int x) { return x * 10; }
+inline int f7763_11(int x) { return x * 11; }
+inline int f7763_12(int x) { return x * 12; }
+inline int f7763_13(int x) { return x * 13; }
+inline int f7763_14(int x) { return x * 14; }
+inline int f7763_15(int x) { return x * 15; }
+inline int f7763_16(int x) { return x * 16; }
+inline int f7763_17(int x) { return x * 17; }
+inline int f7763_18(int x) { return x * 18; }
+inline int f7763_19(int x) { return x * 19; }
+inline int f7763_20(int x) { return x * 20; }
+inline int f7763_21(int x) { return x * 21; }
+inline int f7763_22(int x) { return x * 22; }
+inline int f7763_23(int x) { return x * 23; }
+inline int f7763_24(int x) { return x * 24; }
+inline int f7763_25(int x) { return x * 25; }
+inline int f7763_26(int x) { return x * 26; }
+inline int f7763_27(int x) { return x * 27; }
+inline int f7763_28(int x) { return x * 28; }
+inline int f7763_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7765 */
+#include <vector>
+#include "h8221.h"
+#include "h2968.h"
+#include "h1076.h"
+#include "h120.h"
+#include "h2964.h"
+#ifdef X
+#include "h2301.h"
+#endif
+struct S7765 { int a; const char *s = "x//y"; };
+inline int f7765_0(int x) { return x * 0; }
+inline int f7765_1(int x) { return x * 1; }
+inline int f7765_2(int x) { return x * 2; }
+inline int f7765_3(int x) { return x * 3; }
+inline int f7765_4(int x) { return x * 4; }
+inline int f7765_5(int x) { return x * 5; }
+inline int f7765_6(int x) { return x * 6; }
+inline int f7765_7(int x) { return x * 7; }
+inline int f7765_8(int x) { return x * 8; }
+inline int f7765_9(int x) { return x * 9; }
+inline int f7765_10(int x) { return x * 10; }
+inline int f7765_11(int x) { return x * 11; }
+inline int f7765_12(int x) { return x * 12; }
+inline int f7765_13(int x) { return x * 13; }
+inline int f7765_14(int x) { return x * 14; }
+inline int f7765_15(int x) { return x * 15; }
+inline int f7765_16(int x) { return x * 16; }
+inline int f7765_17(int x) { return x * 17; }
+inline int f7765_18(int x) { return x * 18; }
+inline int f7765_19(int x) { return x * 19; }
+inline int f7765_20(int x) { return x * 20; }
+inline int f7765_21(int x) { return x * 21; }
+inline int f7765_22(int x) { return x * 22; }
+inline int f7765_23(int x) { return x * 23; }
+inline int f7765_24(int x) { return x * 24; }
+inline int f7765_25(int x) { return x * 25; }
+inline int f7765_26(int x) { return x * 26; }
+inline int f7765_27(int x) { return x * 27; }
+inline int f7765_28(int x) { return x * 28; }
+inline int f7765_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7766 */
+#include <vector>
+#include "h7580.h"
+#include "h9469.h"
+#include "h7157.h"
+#include "h6131.h"
+#include "h7946.h"
+#ifdef X
+#include "h3304.h"
+#endif
+struct S7766 { int a; const char *s = "x//y"; };
+inline int f7766_0(int x) { return x * 0; }
+inline int f7766_1(int x) { return x * 1; }
+inline int f7766_2(int x) { return x * 2; }
+inline int f7766_3(int x) { return x * 3; }
+inline int f7766_4(int x) { return x * 4; }
+inline int f7766_5(int x) { return x * 5; }
+inline int f7766_6(int x) { return x * 6; }
+inline int f7766_7(int x) { return x * 7; }
+inline int f7766_8(int x) { return x * 8; }
+inline int f7766_9(int x) { return x * 9; }
+inline int f7766_10(int x) { return x * 10; }
+inline int f7766_11(int x) { return x * 11; }
+inline int f7766_12(int x) { return x * 12; }
+inline int f7766_13(int x) { return x * 13; }
+inline int f7766_14(int x) { return x * 14; }
+inline int f7766_15(int x) { return x * 15; }
+inline int f7766_16(int x) { return x * 16; }
+inline int f7766_17(int x) { return x * 17; }
+inline int f7766_18(int x) { return x * 18; }
+inline int f7766_19(int x) { return x * 19; }
+inline int f7766_20(int x) { return x * 20; }
+inline int f7766_21(int x) { return x * 21; }
+inline int f7766_22(int x) { return x * 22; }
+inline int f7766_23(int x) { return x * 23; }
+inline int f7766_24(int x) { return x * 24; }
+inline int f7766_25(int x) { return x * 25; }
+inline int f7766_26(int x) { return x * 26; }
+inline int f7766_27(int x) { return x * 27; }
+inline int f7766_28(int x) { return x * 28; }
+inline int f7766_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7767 */
+#include <vector>
+#include "h8205.h"
+#include "h6451.h"
+#include "h8767.h"
+#include "h4712.h"
+#include "h4643.h"
+#ifdef X
+#include "h235.h"
+#endif
+struct S7767 { int a; const char *s = "x//y"; };
+inline int f7767_0(int x) { return x * 0; }
+inline int f7767_1(int x) { return x * 1; }
+inline int f7767_2(int x) { return x * 2; }
+inline int f7767_3(int x) { return x * 3; }
+inline int f7767_4(int x) { return x * 4; }
+inline int f7767_5(int x) { return x * 5; }
+inline int f7767_6(int x) { return x * 6; }
+inline int f7767_7(int x) { return x * 7; }
+inline int f7767_8(int x) { return x * 8; }
+inline int f7767_9(int x) { return x * 9; }
+inline int f7767_10(int x) { return x * 10; }
+inline int f7767_11(int x) { return x * 11; }
+inline int f7767_12(int x) { return x * 12; }
+inline int f7767_13(int x) { return x * 13; }
+inline int f7767_14(int x) { return x * 14; }
+inline int f7767_15(int x) { return x * 15; }
+inline int f7767_16(int x) { return x * 16; }
+inline int f7767_17(int x) { return x * 17; }
+inline int f7767_18(int x) { return x * 18; }
+inline int f7767_19(int x) { return x * 19; }
+inline int f7767_20(int x) { return x * 20; }
+inline int f7767_21(int x) { return x * 21; }
+inline int f7767_22(int x) { return x * 22; }
+inline int f7767_23(int x) { return x * 23; }
+inline int f7767_24(int x) { return x * 24; }
+inline int f7767_25(int x) { return x * 25; }
+inline int f7767_26(int x) { return x * 26; }
+inline int f7767_27(int x) { return x * 27; }
+inline int f7767_28(int x) { return x * 28; }
+inline int f7767_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7768 */
+#include <vector>
+#include "h2095.h"
+#include "h4187.h"
+#include "h9295.h"
+#include "h6014.h"
+#include "h2330.h"
+#ifdef X
+#include "h296.h"
+#endif
+struct S7768 { int a; const char *s = "x//y"; };
+inline int f7768_0(int x) { return x * 0; }
+inline int f7768_1(int x) { return x * 1; }
+inline int f7768_2(int x) { return x * 2; }
+inline int f7768_3(int x) { return x * 3; }
+inline int f7768_4(int x) { return x * 4; }
+inline int f7768_5(int x) { return x * 5; }
+inline int f7768_6(int x) { return x * 6; }
+inline int f7768_7(int x) { return x * 7; }
+inline int f7768_8(int x) { return x * 8; }
+inline int f7768_9(int x) { return x * 9; }
+inline int f7768_10(int x) { return x * 10; }
+inline int f7768_11(int x) { return x * 11; }
+inline int f7768_12(int x) { return x * 12; }
+inline int f7768_13(int x) { return x * 13; }
+inline int f7768_14(int x) { return x * 14; }
+inline int f7768_15(int x) { return x * 15; }
+inline int f7768_16(int x) { return x * 16; }
+inline int f7768_17(int x) { return x * 17; }
+inline int f7768_18(int x) { return x * 18; }
+inline int f7768_19(int x) { return x * 19; }
+inline int f7768_20(int x) { return x * 20; }
+inline int f7768_21(int x) { return x * 21; }
+inline int f7768_22(int x) { return x * 22; }
+inline int f7768_23(int x) { return x * 23; }
+inline int f7768_24(int x) { return x * 24; }
+inline int f7768_25(int x) { return x * 25; }
+inline int f7768_26(int x) { return x * 26; }
+inline int f7768_27(int x) { return x * 27; }
+inline int f7768_28(int x) { return x * 28; }
+inline int f7768_29(int x) { return x * 29; }
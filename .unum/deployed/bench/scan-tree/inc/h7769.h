@@ -0,0 +1,42 @@
+#pragma once
+/* header 7769 */
+#include <vector>
+#include "h6524.h"
+#include "h2242.h"
+#include "h5965.h"
+#include "h2734.h"
+#include "h4174.h"
+#ifdef X
+#include "h2856.h"
+#endif
+struct S7769 { int a; const char *s = "x//y"; };
+inline int f7769_0(int x) { return x * 0; }
+inline int f7769_1(int x) { return x * 1; }
+inline int f7769_2(int x) { return x * 2; }
+inline int f7769_3(int x) { return x * 3; }
+inline int f7769_4(int x) { return x * 4; }
+inline int f7769_5(int x) { return x * 5; }
+inline int f7769_6(int x) { return x * 6; }
+inline int f7769_7(int x) { return x * 7; }
+inline int f7769_8(int x) { return x * 8; }
+inline int f7769_9(int x) { return x * 9; }
+inline int f7769_10(int x) { return x * 10; }
+inline int f7769_11(int x) { return x * 11; }
+inline int f7769_12(int x) { return x * 12; }
+inline int f7769_13(int x) { return x * 13; }
+inline int f7769_14(int x) { return x * 14; }
+inline int f7769_15(int x) { return x * 15; }
+inline int f7769_16(int x) { return x * 16; }
+inline int f7769_17(int x) { return x * 17; }
+inline int f7769_18(int x) { return x * 18; }
+inline int f7769_19(int x) { return x * 19; }
+inline int f7769_20(int x) { return x * 20; }
+inline int f7769_21(int x) { return x * 21; }
+inline int f7769_22(int x) { return x * 22; }
+inline int f7769_23(int x) { return x * 23; }
+inline int f7769_24(int x) { return x * 24; }
+inline int f7769_25(int x) { return x * 25; }
+inline int f7769_26(int x) { return x * 26; }
+inline int f7769_27(int x) { return x * 27; }
+inline int f7769_28(int x) { return x * 28; }
+inline int f7769_29(int x) { return x * 29; }
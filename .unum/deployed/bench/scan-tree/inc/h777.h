@@ -0,0 +1,42 @@
+#pragma once
+/* header 777 */
+#include <vector>
+#include "h9236.h"
+#include "h2965.h"
+#include "h974.h"
+#include "h4008.h"
+#include "h9626.h"
+#ifdef X
+#include "h2642.h"
+#endif
+struct S777 { int a; const char *s = "x//y"; };
+inline int f777_0(int x) { return x * 0; }
+inline int f777_1(int x) { return x * 1; }
+inline int f777_2(int x) { return x * 2; }
+inline int f777_3(int x) { return x * 3; }
+inline int f777_4(int x) { return x * 4; }
+inline int f777_5(int x) { return x * 5; }
+inline int f777_6(int x) { return x * 6; }
+inline int f777_7(int x) { return x * 7; }
+inline int f777_8(int x) { return x * 8; }
+inline int f777_9(int x) { return x * 9; }
+inline int f777_10(int x) { return x * 10; }
+inline int f777_11(int x) { return x * 11; }
+inline int f777_12(int x) { return x * 12; }
+inline int f777_13(int x) { return x * 13; }
+inline int f777_14(int x) { return x * 14; }
+inline int f777_15(int x) { return x * 15; }
+inline int f777_16(int x) { return x * 16; }
+inline int f777_17(int x) { return x * 17; }
+inline int f777_18(int x) { return x * 18; }
+inline int f777_19(int x) { return x * 19; }
+inline int f777_20(int x) { return x * 20; }
+inline int f777_21(int x) { return x * 21; }
+inline int f777_22(int x) { return x * 22; }
+inline int f777_23(int x) { return x * 23; }
+inline int f777_24(int x) { return x * 24; }
+inline int f777_25(int x) { return x * 25; }
+inline int f777_26(int x) { return x * 26; }
+inline int f777_27(int x) { return x * 27; }
+inline int f777_28(int x) { return x * 28; }
+inline int f777_29(int x) { return x * 29; }
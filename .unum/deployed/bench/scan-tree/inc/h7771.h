@@ -0,0 +1,42 @@
+#pragma once
+/* header 7771 */
+#include <vector>
+#include "h4973.h"
+#include "h1293.h"
+#include "h4424.h"
+#include "h592.h"
+#include "h5936.h"
+#ifdef X
+#include "h8300.h"
+#endif
+struct S7771 { int a; const char *s = "x//y"; };
+inline int f7771_0(int x) { return x * 0; }
+inline int f7771_1(int x) { return x * 1; }
+inline int f7771_2(int x) { return x * 2; }
+inline int f7771_3(int x) { return x * 3; }
+inline int f7771_4(int x) { return x * 4; }
+inline int f7771_5(int x) { return x * 5; }
+inline int f7771_6(int x) { return x * 6; }
+inline int f7771_7(int x) { return x * 7; }
+inline int f7771_8(int x) { return x * 8; }
+inline int f7771_9(int x) { return x * 9; }
+inline int f7771_10(int x) { return x * 10; }
+inline int f7771_11(int x) { return x * 11; }
+inline int f7771_12(int x) { return x * 12; }
+inline int f7771_13(int x) { return x * 13; }
+inline int f7771_14(int x) { return x * 14; }
+inline int f7771_15(int x) { return x * 15; }
+inline int f7771_16(int x) { return x * 16; }
+inline int f7771_17(int x) { return x * 17; }
+inline int f7771_18(int x) { return x * 18; }
+inline int f7771_19(int x) { return x * 19; }
+inline int f7771_20(int x) { return x * 20; }
+inline int f7771_21(int x) { return x * 21; }
+inline int f7771_22(int x) { return x * 22; }
+inline int f7771_23(int x) { return x * 23; }
+inline int f7771_24(int x) { return x * 24; }
+inline int f7771_25(int x) { return x * 25; }
+inline int f7771_26(int x) { return x * 26; }
+inline int f7771_27(int x) { return x * 27; }
+inline int f7771_28(int x) { return x * 28; }
+inline int f7771_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7772 */
+#include <vector>
+#include "h1627.h"
+#include "h7819.h"
+#include "h8135.h"
+#include "h6838.h"
+#include "h7823.h"
+#ifdef X
+#include "h8424.h"
+#endif
+struct S7772 { int a; const char *s = "x//y"; };
+inline int f7772_0(int x) { return x * 0; }
+inline int f7772_1(int x) { return x * 1; }
+inline int f7772_2(int x) { return x * 2; }
+inline int f7772_3(int x) { return x * 3; }
+inline int f7772_4(int x) { return x * 4; }
+inline int f7772_5(int x) { return x * 5; }
+inline int f7772_6(int x) { return x * 6; }
+inline int f7772_7(int x) { return x * 7; }
+inline int f7772_8(int x) { return x * 8; }
+inline int f7772_9(int x) { return x * 9; }
+inline int f7772_10(int x) { return x * 10; }
+inline int f7772_11(int x) { return x * 11; }
+inline int f7772_12(int x) { return x * 12; }
+inline int f7772_13(int x) { return x * 13; }
+inline int f7772_14(int x) { return x * 14; }
+inline int f7772_15(int x) { return x * 15; }
+inline int f7772_16(int x) { return x * 16; }
+inline int f7772_17(int x) { return x * 17; }
+inline int f7772_18(int x) { return x * 18; }
+inline int f7772_19(int x) { return x * 19; }
+inline int f7772_20(int x) { return x * 20; }
+inline int f7772_21(int x) { return x * 21; }
+inline int f7772_22(int x) { return x * 22; }
+inline int f7772_23(int x) { return x * 23; }
+inline int f7772_24(int x) { return x * 24; }
+inline int f7772_25(int x) { return x * 25; }
+inline int f7772_26(int x) { return x * 26; }
+inline int f7772_27(int x) { return x * 27; }
+inline int f7772_28(int x) { return x * 28; }
+inline int f7772_29(int x) { return x * 29; }
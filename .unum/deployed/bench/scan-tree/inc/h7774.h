@@ -0,0 +1,42 @@
+#pragma once
+/* header 7774 */
+#include <vector>
+#include "h6263.h"
+#include "h6379.h"
+#include "h7021.h"
+#include "h546.h"
+#include "h6940.h"
+#ifdef X
+#include "h1847.h"
+#endif
+struct S7774 { int a; const char *s = "x//y"; };
+inline int f7774_0(int x) { return x * 0; }
+inline int f7774_1(int x) { return x * 1; }
+inline int f7774_2(int x) { return x * 2; }
+inline int f7774_3(int x) { return x * 3; }
+inline int f7774_4(int x) { return x * 4; }
+inline int f7774_5(int x) { return x * 5; }
+inline int f7774_6(int x) { return x * 6; }
+inline int f7774_7(int x) { return x * 7; }
+inline int f7774_8(int x) { return x * 8; }
+inline int f7774_9(int x) { return x * 9; }
+inline int f7774_10(int x) { return x * 10; }
+inline int f7774_11(int x) { return x * 11; }
+inline int f7774_12(int x) { return x * 12; }
+inline int f7774_13(int x) { return x * 13; }
+inline int f7774_14(int x) { return x * 14; }
+inline int f7774_15(int x) { return x * 15; }
+inline int f7774_16(int x) { return x * 16; }
+inline int f7774_17(int x) { return x * 17; }
+inline int f7774_18(int x) { return x * 18; }
+inline int f7774_19(int x) { return x * 19; }
+inline int f7774_20(int x) { return x * 20; }
+inline int f7774_21(int x) { return x * 21; }
+inline int f7774_22(int x) { return x * 22; }
+inline int f7774_23(int x) { return x * 23; }
+inline int f7774_24(int x) { return x * 24; }
+inline int f7774_25(int x) { return x * 25; }
+inline int f7774_26(int x) { return x * 26; }
+inline int f7774_27(int x) { return x * 27; }
+inline int f7774_28(int x) { return x * 28; }
+inline int f7774_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7775 */
+#include <vector>
+#include "h9273.h"
+#include "h1150.h"
+#include "h657.h"
+#include "h9341.h"
+#include "h9148.h"
+#ifdef X
+#include "h8172.h"
+#endif
+struct S7775 { int a; const char *s = "x//y"; };
+inline int f7775_0(int x) { return x * 0; }
+inline int f7775_1(int x) { return x * 1; }
+inline int f7775_2(int x) { return x * 2; }
+inline int f7775_3(int x) { return x * 3; }
+inline int f7775_4(int x) { return x * 4; }
+inline int f7775_5(int x) { return x * 5; }
+inline int f7775_6(int x) { return x * 6; }
+inline int f7775_7(int x) { return x * 7; }
+inline int f7775_8(int x) { return x * 8; }
+inline int f7775_9(int x) { return x * 9; }
+inline int f7775_10(int x) { return x * 10; }
+inline int f7775_11(int x) { return x * 11; }
+inline int f7775_12(int x) { return x * 12; }
+inline int f7775_13(int x) { return x * 13; }
+inline int f7775_14(int x) { return x * 14; }
+inline int f7775_15(int x) { return x * 15; }
+inline int f7775_16(int x) { return x * 16; }
+inline int f7775_17(int x) { return x * 17; }
+inline int f7775_18(int x) { return x * 18; }
+inline int f7775_19(int x) { return x * 19; }
+inline int f7775_20(int x) { return x * 20; }
+inline int f7775_21(int x) { return x * 21; }
+inline int f7775_22(int x) { return x * 22; }
+inline int f7775_23(int x) { return x * 23; }
+inline int f7775_24(int x) { return x * 24; }
+inline int f7775_25(int x) { return x * 25; }
+inline int f7775_26(int x) { return x * 26; }
+inline int f7775_27(int x) { return x * 27; }
+inline int f7775_28(int x) { return x * 28; }
+inline int f7775_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7776 */
+#include <vector>
+#include "h6186.h"
+#include "h2114.h"
+#include "h1646.h"
+#include "h883.h"
+#include "h2269.h"
+#ifdef X
+#include "h8796.h"
+#endif
+struct S7776 { int a; const char *s = "x//y"; };
+inline int f7776_0(int x) { return x * 0; }
+inline int f7776_1(int x) { return x * 1; }
+inline int f7776_2(int x) { return x * 2; }
+inline int f7776_3(int x) { return x * 3; }
+inline int f7776_4(int x) { return x * 4; }
+inline int f7776_5(int x) { return x * 5; }
+inline int f7776_6(int x) { return x * 6; }
+inline int f7776_7(int x) { return x * 7; }
+inline int f7776_8(int x) { return x * 8; }
+inline int f7776_9(int x) { return x * 9; }
+inline int f7776_10(int x) { return x * 10; }
+inline int f7776_11(int x) { return x * 11; }
+inline int f7776_12(int x) { return x * 12; }
+inline int f7776_13(int x) { return x * 13; }
+inline int f7776_14(int x) { return x * 14; }
+inline int f7776_15(int x) { return x * 15; }
+inline int f7776_16(int x) { return x * 16; }
+inline int f7776_17(int x) { return x * 17; }
+inline int f7776_18(int x) { return x * 18; }
+inline int f7776_19(int x) { return x * 19; }
+inline int f7776_20(int x) { return x * 20; }
+inline int f7776_21(int x) { return x * 21; }
+inline int f7776_22(int x) { return x * 22; }
+inline int f7776_23(int x) { return x * 23; }
+inline int f7776_24(int x) { return x * 24; }
+inline int f7776_25(int x) { return x * 25; }
+inline int f7776_26(int x) { return x * 26; }
+inline int f7776_27(int x) { return x * 27; }
+inline int f7776_28(int x) { return x * 28; }
+inline int f7776_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7777 */
+#include <vector>
+#include "h6370.h"
+#include "h2104.h"
+#include "h3214.h"
+#include "h6493.h"
+#include "h761.h"
+#ifdef X
+#include "h3530.h"
+#endif
+struct S7777 { int a; const char *s = "x//y"; };
+inline int f7777_0(int x) { return x * 0; }
+inline int f7777_1(int x) { return x * 1; }
+inline int f7777_2(int x) { return x * 2; }
+inline int f7777_3(int x) { return x * 3; }
+inline int f7777_4(int x) { return x * 4; }
+inline int f7777_5(int x) { return x * 5; }
+inline int f7777_6(int x) { return x * 6; }
+inline int f7777_7(int x) { return x * 7; }
+inline int f7777_8(int x) { return x * 8; }
+inline int f7777_9(int x) { return x * 9; }
+inline int f7777_10(int x) { return x * 10; }
+inline int f7777_11(int x) { return x * 11; }
+inline int f7777_12(int x) { return x * 12; }
+inline int f7777_13(int x) { return x * 13; }
+inline int f7777_14(int x) { return x * 14; }
+inline int f7777_15(int x) { return x * 15; }
+inline int f7777_16(int x) { return x * 16; }
+inline int f7777_17(int x) { return x * 17; }
+inline int f7777_18(int x) { return x * 18; }
+inline int f7777_19(int x) { return x * 19; }
+inline int f7777_20(int x) { return x * 20; }
+inline int f7777_21(int x) { return x * 21; }
+inline int f7777_22(int x) { return x * 22; }
+inline int f7777_23(int x) { return x * 23; }
+inline int f7777_24(int x) { return x * 24; }
+inline int f7777_25(int x) { return x * 25; }
+inline int f7777_26(int x) { return x * 26; }
+inline int f7777_27(int x) { return x * 27; }
+inline int f7777_28(int x) { return x * 28; }
+inline int f7777_29(int x) { return x * 29; }
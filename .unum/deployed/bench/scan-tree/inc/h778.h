@@ -0,0 +1,42 @@
+#pragma once
+/* header 778 */
+#include <vector>
+#include "h4911.h"
+#include "h5637.h"
+#include "h2662.h"
+#include "h2931.h"
+#include "h5899.h"
+#ifdef X
+#include "h905.h"
+#endif
+struct S778 { int a; const char *s = "x//y"; };
+inline int f778_0(int x) { return x * 0; }
+inline int f778_1(int x) { return x * 1; }
+inline int f778_2(int x) { return x * 2; }
+inline int f778_3(int x) { return x * 3; }
+inline int f778_4(int x) { return x * 4; }
+inline int f778_5(int x) { return x * 5; }
+inline int f778_6(int x) { return x * 6; }
+inline int f778_7(int x) { return x * 7; }
+inline int f778_8(int x) { return x * 8; }
+inline int f778_9(int x) { return x * 9; }
+inline int f778_10(int x) { return x * 10; }
+inline int f778_11(int x) { return x * 11; }
+inline int f778_12(int x) { return x * 12; }
+inline int f778_13(int x) { return x * 13; }
+inline int f778_14(int x) { return x * 14; }
+inline int f778_15(int x) { return x * 15; }
+inline int f778_16(int x) { return x * 16; }
+inline int f778_17(int x) { return x * 17; }
+inline int f778_18(int x) { return x * 18; }
+inline int f778_19(int x) { return x * 19; }
+inline int f778_20(int x) { return x * 20; }
+inline int f778_21(int x) { return x * 21; }
+inline int f778_22(int x) { return x * 22; }
+inline int f778_23(int x) { return x * 23; }
+inline int f778_24(int x) { return x * 24; }
+inline int f778_25(int x) { return x * 25; }
+inline int f778_26(int x) { return x * 26; }
+inline int f778_27(int x) { return x * 27; }
+inline int f778_28(int x) { return x * 28; }
+inline int f778_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7781 */
+#include <vector>
+#include "h2740.h"
+#include "h1121.h"
+#include "h8627.h"
+#include "h9922.h"
+#include "h205.h"
+#ifdef X
+#include "h9401.h"
+#endif
+struct S7781 { int a; const char *s = "x//y"; };
+inline int f7781_0(int x) { return x * 0; }
+inline int f7781_1(int x) { return x * 1; }
+inline int f7781_2(int x) { return x * 2; }
+inline int f7781_3(int x) { return x * 3; }
+inline int f7781_4(int x) { return x * 4; }
+inline int f7781_5(int x) { return x * 5; }
+inline int f7781_6(int x) { return x * 6; }
+inline int f7781_7(int x) { return x * 7; }
+inline int f7781_8(int x) { return x * 8; }
+inline int f7781_9(int x) { return x * 9; }
+inline int f7781_10(int x) { return x * 10; }
+inline int f7781_11(int x) { return x * 11; }
+inline int f7781_12(int x) { return x * 12; }
+inline int f7781_13(int x) { return x * 13; }
+inline int f7781_14(int x) { return x * 14; }
+inline int f7781_15(int x) { return x * 15; }
+inline int f7781_16(int x) { return x * 16; }
+inline int f7781_17(int x) { return x * 17; }
+inline int f7781_18(int x) { return x * 18; }
+inline int f7781_19(int x) { return x * 19; }
+inline int f7781_20(int x) { return x * 20; }
+inline int f7781_21(int x) { return x * 21; }
+inline int f7781_22(int x) { return x * 22; }
+inline int f7781_23(int x) { return x * 23; }
+inline int f7781_24(int x) { return x * 24; }
+inline int f7781_25(int x) { return x * 25; }
+inline int f7781_26(int x) { return x * 26; }
+inline int f7781_27(int x) { return x * 27; }
+inline int f7781_28(int x) { return x * 28; }
+inline int f7781_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7782 */
+#include <vector>
+#include "h3944.h"
+#include "h3300.h"
+#include "h4244.h"
+#include "h6846.h"
+#include "h9619.h"
+#ifdef X
+#include "h9992.h"
+#endif
+struct S7782 { int a; const char *s = "x//y"; };
+inline int f7782_0(int x) { return x * 0; }
+inline int f7782_1(int x) { return x * 1; }
+inline int f7782_2(int x) { return x * 2; }
+inline int f7782_3(int x) { return x * 3; }
+inline int f7782_4(int x) { return x * 4; }
+inline int f7782_5(int x) { return x * 5; }
+inline int f7782_6(int x) { return x * 6; }
+inline int f7782_7(int x) { return x * 7; }
+inline int f7782_8(int x) { return x * 8; }
+inline int f7782_9(int x) { return x * 9; }
+inline int f7782_10(int x) { return x * 10; }
+inline int f7782_11(int x) { return x * 11; }
+inline int f7782_12(int x) { return x * 12; }
+inline int f7782_13(int x) { return x * 13; }
+inline int f7782_14(int x) { return x * 14; }
+inline int f7782_15(int x) { return x * 15; }
+inline int f7782_16(int x) { return x * 16; }
+inline int f7782_17(int x) { return x * 17; }
+inline int f7782_18(int x) { return x * 18; }
+inline int f7782_19(int x) { return x * 19; }
+inline int f7782_20(int x) { return x * 20; }
+inline int f7782_21(int x) { return x * 21; }
+inline int f7782_22(int x) { return x * 22; }
+inline int f7782_23(int x) { return x * 23; }
+inline int f7782_24(int x) { return x * 24; }
+inline int f7782_25(int x) { return x * 25; }
+inline int f7782_26(int x) { return x * 26; }
+inline int f7782_27(int x) { return x * 27; }
+inline int f7782_28(int x) { return x * 28; }
+inline int f7782_29(int x) { return x * 29; }
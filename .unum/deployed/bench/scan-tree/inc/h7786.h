@@ -0,0 +1,42 @@
+#pragma once
+/* header 7786 */
+#include <vector>
+#include "h9556.h"
+#include "h7962.h"
+#include "h561.h"
+#include "h3072.h"
+#include "h3613.h"
+#ifdef X
+#include "h4329.h"
+#endif
+struct S7786 { int a; const char *s = "x//y"; };
+inline int f7786_0(int x) { return x * 0; }
+inline int f7786_1(int x) { return x * 1; }
+inline int f7786_2(int x) { return x * 2; }
+inline int f7786_3(int x) { return x * 3; }
+inline int f7786_4(int x) { return x * 4; }
+inline int f7786_5(int x) { return x * 5; }
+inline int f7786_6(int x) { return x * 6; }
+inline int f7786_7(int x) { return x * 7; }
+inline int f7786_8(int x) { return x * 8; }
+inline int f7786_9(int x) { return x * 9; }
+inline int f7786_10(int x) { return x * 10; }
+inline int f7786_11(int x) { return x * 11; }
+inline int f7786_12(int x) { return x * 12; }
+inline int f7786_13(int x) { return x * 13; }
+inline int f7786_14(int x) { return x * 14; }
+inline int f7786_15(int x) { return x * 15; }
+inline int f7786_16(int x) { return x * 16; }
+inline int f7786_17(int x) { return x * 17; }
+inline int f7786_18(int x) { return x * 18; }
+inline int f7786_19(int x) { return x * 19; }
+inline int f7786_20(int x) { return x * 20; }
+inline int f7786_21(int x) { return x * 21; }
+inline int f7786_22(int x) { return x * 22; }
+inline int f7786_23(int x) { return x * 23; }
+inline int f7786_24(int x) { return x * 24; }
+inline int f7786_25(int x) { return x * 25; }
+inline int f7786_26(int x) { return x * 26; }
+inline int f7786_27(int x) { return x * 27; }
+inline int f7786_28(int x) { return x * 28; }
+inline int f7786_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7793 */
+#include <vector>
+#include "h2372.h"
+#include "h7592.h"
+#include "h3273.h"
+#include "h4338.h"
+#include "h4595.h"
+#ifdef X
+#include "h7760.h"
+#endif
+struct S7793 { int a; const char *s = "x//y"; };
+inline int f7793_0(int x) { return x * 0; }
+inline int f7793_1(int x) { return x * 1; }
+inline int f7793_2(int x) { return x * 2; }
+inline int f7793_3(int x) { return x * 3; }
+inline int f7793_4(int x) { return x * 4; }
+inline int f7793_5(int x) { return x * 5; }
+inline int f7793_6(int x) { return x * 6; }
+inline int f7793_7(int x) { return x * 7; }
+inline int f7793_8(int x) { return x * 8; }
+inline int f7793_9(int x) { return x * 9; }
+inline int f7793_10(int x) { return x * 10; }
+inline int f7793_11(int x) { return x * 11; }
+inline int f7793_12(int x) { return x * 12; }
+inline int f7793_13(int x) { return x * 13; }
+inline int f7793_14(int x) { return x * 14; }
+inline int f7793_15(int x) { return x * 15; }
+inline int f7793_16(int x) { return x * 16; }
+inline int f7793_17(int x) { return x * 17; }
+inline int f7793_18(int x) { return x * 18; }
+inline int f7793_19(int x) { return x * 19; }
+inline int f7793_20(int x) { return x * 20; }
+inline int f7793_21(int x) { return x * 21; }
+inline int f7793_22(int x) { return x * 22; }
+inline int f7793_23(int x) { return x * 23; }
+inline int f7793_24(int x) { return x * 24; }
+inline int f7793_25(int x) { return x * 25; }
+inline int f7793_26(int x) { return x * 26; }
+inline int f7793_27(int x) { return x * 27; }
+inline int f7793_28(int x) { return x * 28; }
+inline int f7793_29(int x) { return x * 29; }
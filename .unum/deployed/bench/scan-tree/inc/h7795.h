@@ -0,0 +1,42 @@
+#pragma once
+/* header 7795 */
+#include <vector>
+#include "h6788.h"
+#include "h5835.h"
+#include "h4632.h"
+#include "h1997.h"
+#include "h6381.h"
+#ifdef X
+#include "h4839.h"
+#endif
+struct S7795 { int a; const char *s = "x//y"; };
+inline int f7795_0(int x) { return x * 0; }
+inline int f7795_1(int x) { return x * 1; }
+inline int f7795_2(int x) { return x * 2; }
+inline int f7795_3(int x) { return x * 3; }
+inline int f7795_4(int x) { return x * 4; }
+inline int f7795_5(int x) { return x * 5; }
+inline int f7795_6(int x) { return x * 6; }
+inline int f7795_7(int x) { return x * 7; }
+inline int f7795_8(int x) { return x * 8; }
+inline int f7795_9(int x) { return x * 9; }
+inline int f7795_10(int x) { return x * 10; }
+inline int f7795_11(int x) { return x * 11; }
+inline int f7795_12(int x) { return x * 12; }
+inline int f7795_13(int x) { return x * 13; }
+inline int f7795_14(int x) { return x * 14; }
+inline int f7795_15(int x) { return x * 15; }
+inline int f7795_16(int x) { return x * 16; }
+inline int f7795_17(int x) { return x * 17; }
+inline int f7795_18(int x) { return x * 18; }
+inline int f7795_19(int x) { return x * 19; }
+inline int f7795_20(int x) { return x * 20; }
+inline int f7795_21(int x) { return x * 21; }
+inline int f7795_22(int x) { return x * 22; }
+inline int f7795_23(int x) { return x * 23; }
+inline int f7795_24(int x) { return x * 24; }
+inline int f7795_25(int x) { return x * 25; }
+inline int f7795_26(int x) { return x * 26; }
+inline int f7795_27(int x) { return x * 27; }
+inline int f7795_28(int x) { return x * 28; }
+inline int f7795_29(int x) { return x * 29; }
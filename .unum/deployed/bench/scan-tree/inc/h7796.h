@@ -0,0 +1,42 @@
+#pragma once
+/* header 7796 */
+#include <vector>
+#include "h9771.h"
+#include "h1987.h"
+#include "h8761.h"
+#include "h7841.h"
+#include "h5846.h"
+#ifdef X
+#include "h7289.h"
+#endif
+struct S7796 { int a; const char *s = "x//y"; };
+inline int f7796_0(int x) { return x * 0; }
+inline int f7796_1(int x) { return x * 1; }
+inline int f7796_2(int x) { return x * 2; }
+inline int f7796_3(int x) { return x * 3; }
+inline int f7796_4(int x) { return x * 4; }
+inline int f7796_5(int x) { return x * 5; }
+inline int f7796_6(int x) { return x * 6; }
+inline int f7796_7(int x) { return x * 7; }
+inline int f7796_8(int x) { return x * 8; }
+inline int f7796_9(int x) { return x * 9; }
+inline int f7796_10(int x) { return x * 10; }
+inline int f7796_11(int x) { return x * 11; }
+inline int f7796_12(int x) { return x * 12; }
+inline int f7796_13(int x) { return x * 13; }
+inline int f7796_14(int x) { return x * 14; }
+inline int f7796_15(int x) { return x * 15; }
+inline int f7796_16(int x) { return x * 16; }
+inline int f7796_17(int x) { return x * 17; }
+inline int f7796_18(int x) { return x * 18; }
+inline int f7796_19(int x) { return x * 19; }
+inline int f7796_20(int x) { return x * 20; }
+inline int f7796_21(int x) { return x * 21; }
+inline int f7796_22(int x) { return x * 22; }
+inline int f7796_23(int x) { return x * 23; }
+inline int f7796_24(int x) { return x * 24; }
+inline int f7796_25(int x) { return x * 25; }
+inline int f7796_26(int x) { return x * 26; }
+inline int f7796_27(int x) { return x * 27; }
+inline int f7796_28(int x) { return x * 28; }
+inline int f7796_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7798 */
+#include <vector>
+#include "h8122.h"
+#include "h1423.h"
+#include "h7710.h"
+#include "h979.h"
+#include "h5469.h"
+#ifdef X
+#include "h6812.h"
+#endif
+struct S7798 { int a; const char *s = "x//y"; };
+inline int f7798_0(int x) { return x * 0; }
+inline int f7798_1(int x) { return x * 1; }
+inline int f7798_2(int x) { return x * 2; }
+inline int f7798_3(int x) { return x * 3; }
+inline int f7798_4(int x) { return x * 4; }
+inline int f7798_5(int x) { return x * 5; }
+inline int f7798_6(int x) { return x * 6; }
+inline int f7798_7(int x) { return x * 7; }
+inline int f7798_8(int x) { return x * 8; }
+inline int f7798_9(int x) { return x * 9; }
+inline int f7798_10(int x) { return x * 10; }
+inline int f7798_11(int x) { return x * 11; }
+inline int f7798_12(int x) { return x * 12; }
+inline int f7798_13(int x) { return x * 13; }
+inline int f7798_14(int x) { return x * 14; }
+inline int f7798_15(int x) { return x * 15; }
+inline int f7798_16(int x) { return x * 16; }
+inline int f7798_17(int x) { return x * 17; }
+inline int f7798_18(int x) { return x * 18; }
+inline int f7798_19(int x) { return x * 19; }
+inline int f7798_20(int x) { return x * 20; }
+inline int f7798_21(int x) { return x * 21; }
+inline int f7798_22(int x) { return x * 22; }
+inline int f7798_23(int x) { return x * 23; }
+inline int f7798_24(int x) { return x * 24; }
+inline int f7798_25(int x) { return x * 25; }
+inline int f7798_26(int x) { return x * 26; }
+inline int f7798_27(int x) { return x * 27; }
+inline int f7798_28(int x) { return x * 28; }
+inline int f7798_29(int x) { return x * 29; }
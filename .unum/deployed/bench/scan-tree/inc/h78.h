@@ -0,0 +1,42 @@
+#pragma once
+/* header 78 */
+#include <vector>
+#include "h9766.h"
+#include "h621.h"
+#include "h5627.h"
+#include "h9407.h"
+#include "h791.h"
+#ifdef X
+#include "h8068.h"
+#endif
+struct S78 { int a; const char *s = "x//y"; };
+inline int f78_0(int x) { return x * 0; }
+inline int f78_1(int x) { return x * 1; }
+inline int f78_2(int x) { return x * 2; }
+inline int f78_3(int x) { return x * 3; }
+inline int f78_4(int x) { return x * 4; }
+inline int f78_5(int x) { return x * 5; }
+inline int f78_6(int x) { return x * 6; }
+inline int f78_7(int x) { return x * 7; }
+inline int f78_8(int x) { return x * 8; }
+inline int f78_9(int x) { return x * 9; }
+inline int f78_10(int x) { return x * 10; }
+inline int f78_11(int x) { return x * 11; }
+inline int f78_12(int x) { return x * 12; }
+inline int f78_13(int x) { return x * 13; }
+inline int f78_14(int x) { return x * 14; }
+inline int f78_15(int x) { return x * 15; }
+inline int f78_16(int x) { return x * 16; }
+inline int f78_17(int x) { return x * 17; }
+inline int f78_18(int x) { return x * 18; }
+inline int f78_19(int x) { return x * 19; }
+inline int f78_20(int x) { return x * 20; }
+inline int f78_21(int x) { return x * 21; }
+inline int f78_22(int x) { return x * 22; }
+inline int f78_23(int x) { return x * 23; }
+inline int f78_24(int x) { return x * 24; }
+inline int f78_25(int x) { return x * 25; }
+inline int f78_26(int x) { return x * 26; }
+inline int f78_27(int x) { return x * 27; }
+inline int f78_28(int x) { return x * 28; }
+inline int f78_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7800 */
+#include <vector>
+#include "h9033.h"
+#include "h631.h"
+#include "h7132.h"
+#include "h7531.h"
+#include "h4977.h"
+#ifdef X
+#include "h8489.h"
+#endif
+struct S7800 { int a; const char *s = "x//y"; };
+inline int f7800_0(int x) { return x * 0; }
+inline int f7800_1(int x) { return x * 1; }
+inline int f7800_2(int x) { return x * 2; }
+inline int f7800_3(int x) { return x * 3; }
+inline int f7800_4(int x) { return x * 4; }
+inline int f7800_5(int x) { return x * 5; }
+inline int f7800_6(int x) { return x * 6; }
+inline int f7800_7(int x) { return x * 7; }
+inline int f7800_8(int x) { return x * 8; }
+inline int f7800_9(int x) { return x * 9; }
+inline int f7800_10(int x) { return x * 10; }
+inline int f7800_11(int x) { return x * 11; }
+inline int f7800_12(int x) { return x * 12; }
+inline int f7800_13(int x) { return x * 13; }
+inline int f7800_14(int x) { return x * 14; }
+inline int f7800_15(int x) { return x * 15; }
+inline int f7800_16(int x) { return x * 16; }
+inline int f7800_17(int x) { return x * 17; }
+inline int f7800_18(int x) { return x * 18; }
+inline int f7800_19(int x) { return x * 19; }
+inline int f7800_20(int x) { return x * 20; }
+inline int f7800_21(int x) { return x * 21; }
+inline int f7800_22(int x) { return x * 22; }
+inline int f7800_23(int x) { return x * 23; }
+inline int f7800_24(int x) { return x * 24; }
+inline int f7800_25(int x) { return x * 25; }
+inline int f7800_26(int x) { return x * 26; }
+inline int f7800_27(int x) { return x * 27; }
+inline int f7800_28(int x) { return x * 28; }
+inline int f7800_29(int x) { return x * 29; }
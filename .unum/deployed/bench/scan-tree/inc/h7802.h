@@ -0,0 +1,42 @@
+#pragma once
+/* header 7802 */
+#include <vector>
+#include "h8378.h"
+#include "h4013.h"
+#include "h6799.h"
+#include "h1334.h"
+#include "h4554.h"
+#ifdef X
+#include "h3479.h"
+#endif
+struct S7802 { int a; const char *s = "x//y"; };
+inline int f7802_0(int x) { return x * 0; }
+inline int f7802_1(int x) { return x * 1; }
+inline int f7802_2(int x) { return x * 2; }
+inline int f7802_3(int x) { return x * 3; }
+inline int f7802_4(int x) { return x * 4; }
+inline int f7802_5(int x) { return x * 5; }
+inline int f7802_6(int x) { return x * 6; }
+inline int f7802_7(int x) { return x * 7; }
+inline int f7802_8(int x) { return x * 8; }
+inline int f7802_9(int x) { return x * 9; }
+inline int f7802_10(int x) { return x * 10; }
+inline int f7802_11(int x) { return x * 11; }
+inline int f7802_12(int x) { return x * 12; }
+inline int f7802_13(int x) { return x * 13; }
+inline int f7802_14(int x) { return x * 14; }
+inline int f7802_15(int x) { return x * 15; }
+inline int f7802_16(int x) { return x * 16; }
+inline int f7802_17(int x) { return x * 17; }
+inline int f7802_18(int x) { return x * 18; }
+inline int f7802_19(int x) { return x * 19; }
+inline int f7802_20(int x) { return x * 20; }
+inline int f7802_21(int x) { return x * 21; }
+inline int f7802_22(int x) { return x * 22; }
+inline int f7802_23(int x) { return x * 23; }
+inline int f7802_24(int x) { return x * 24; }
+inline int f7802_25(int x) { return x * 25; }
+inline int f7802_26(int x) { return x * 26; }
+inline int f7802_27(int x) { return x * 27; }
+inline int f7802_28(int x) { return x * 28; }
+inline int f7802_29(int x) { return x * 29; }
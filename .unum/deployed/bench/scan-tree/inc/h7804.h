@@ -0,0 +1,42 @@
+#pragma once
+/* header 7804 */
+#include <vector>
+#include "h1782.h"
+#include "h9480.h"
+#include "h5993.h"
+#include "h4142.h"
+#include "h2798.h"
+#ifdef X
+#include "h2080.h"
+#endif
+struct S7804 { int a; const char *s = "x//y"; };
+inline int f7804_0(int x) { return x * 0; }
+inline int f7804_1(int x) { return x * 1; }
+inline int f7804_2(int x) { return x * 2; }
+inline int f7804_3(int x) { return x * 3; }
+inline int f7804_4(int x) { return x * 4; }
+inline int f7804_5(int x) { return x * 5; }
+inline int f7804_6(int x) { return x * 6; }
+inline int f7804_7(int x) { return x * 7; }
+inline int f7804_8(int x) { return x * 8; }
+inline int f7804_9(int x) { return x * 9; }
+inline int f7804_10(int x) { return x * 10; }
+inline int f7804_11(int x) { return x * 11; }
+inline int f7804_12(int x) { return x * 12; }
+inline int f7804_13(int x) { return x * 13; }
+inline int f7804_14(int x) { return x * 14; }
+inline int f7804_15(int x) { return x * 15; }
+inline int f7804_16(int x) { return x * 16; }
+inline int f7804_17(int x) { return x * 17; }
+inline int f7804_18(int x) { return x * 18; }
+inline int f7804_19(int x) { return x * 19; }
+inline int f7804_20(int x) { return x * 20; }
+inline int f7804_21(int x) { return x * 21; }
+inline int f7804_22(int x) { return x * 22; }
+inline int f7804_23(int x) { return x * 23; }
+inline int f7804_24(int x) { return x * 24; }
+inline int f7804_25(int x) { return x * 25; }
+inline int f7804_26(int x) { return x * 26; }
+inline int f7804_27(int x) { return x * 27; }
+inline int f7804_28(int x) { return x * 28; }
+inline int f7804_29(int x) { return x * 29; }
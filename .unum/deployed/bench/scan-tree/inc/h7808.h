@@ -0,0 +1,42 @@
+#pragma once
+/* header 7808 */
+#include <vector>
+#include "h4218.h"
+#include "h5199.h"
+#include "h3656.h"
+#include "h3697.h"
+#include "h5576.h"
+#ifdef X
+#include "h4916.h"
+#endif
+struct S7808 { int a; const char *s = "x//y"; };
+inline int f7808_0(int x) { return x * 0; }
+inline int f7808_1(int x) { return x * 1; }
+inline int f7808_2(int x) { return x * 2; }
+inline int f7808_3(int x) { return x * 3; }
+inline int f7808_4(int x) { return x * 4; }
+inline int f7808_5(int x) { return x * 5; }
+inline int f7808_6(int x) { return x * 6; }
+inline int f7808_7(int x) { return x * 7; }
+inline int f7808_8(int x) { return x * 8; }
+inline int f7808_9(int x) { return x * 9; }
+inline int f7808_10(int x) { return x * 10; }
+inline int f7808_11(int x) { return x * 11; }
+inline int f7808_12(int x) { return x * 12; }
+inline int f7808_13(int x) { return x * 13; }
+inline int f7808_14(int x) { return x * 14; }
+inline int f7808_15(int x) { return x * 15; }
+inline int f7808_16(int x) { return x * 16; }
+inline int f7808_17(int x) { return x * 17; }
+inline int f7808_18(int x) { return x * 18; }
+inline int f7808_19(int x) { return x * 19; }
+inline int f7808_20(int x) { return x * 20; }
+inline int f7808_21(int x) { return x * 21; }
+inline int f7808_22(int x) { return x * 22; }
+inline int f7808_23(int x) { return x * 23; }
+inline int f7808_24(int x) { return x * 24; }
+inline int f7808_25(int x) { return x * 25; }
+inline int f7808_26(int x) { return x * 26; }
+inline int f7808_27(int x) { return x * 27; }
+inline int f7808_28(int x) { return x * 28; }
+inline int f7808_29(int x) { return x * 29; }
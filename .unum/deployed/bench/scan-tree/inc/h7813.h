@@ -0,0 +1,42 @@
+#pragma once
+/* header 7813 */
+#include <vector>
+#include "h5673.h"
+#include "h2042.h"
+#include "h7655.h"
+#include "h2507.h"
+#include "h95.h"
+#ifdef X
+#include "h7086.h"
+#endif
+struct S7813 { int a; const char *s = "x//y"; };
+inline int f7813_0(int x) { return x * 0; }
+inline int f7813_1(int x) { return x * 1; }
+inline int f7813_2(int x) { return x * 2; }
+inline int f7813_3(int x) { return x * 3; }
+inline int f7813_4(int x) { return x * 4; }
+inline int f7813_5(int x) { return x * 5; }
+inline int f7813_6(int x) { return x * 6; }
+inline int f7813_7(int x) { return x * 7; }
+inline int f7813_8(int x) { return x * 8; }
+inline int f7813_9(int x) { return x * 9; }
+inline int f7813_10(int x) { return x * 10; }
+inline int f7813_11(int x) { return x * 11; }
+inline int f7813_12(int x) { return x * 12; }
+inline int f7813_13(int x) { return x * 13; }
+inline int f7813_14(int x) { return x * 14; }
+inline int f7813_15(int x) { return x * 15; }
+inline int f7813_16(int x) { return x * 16; }
+inline int f7813_17(int x) { return x * 17; }
+inline int f7813_18(int x) { return x * 18; }
+inline int f7813_19(int x) { return x * 19; }
+inline int f7813_20(int x) { return x * 20; }
+inline int f7813_21(int x) { return x * 21; }
+inline int f7813_22(int x) { return x * 22; }
+inline int f7813_23(int x) { return x * 23; }
+inline int f7813_24(int x) { return x * 24; }
+inline int f7813_25(int x) { return x * 25; }
+inline int f7813_26(int x) { return x * 26; }
+inline int f7813_27(int x) { return x * 27; }
+inline int f7813_28(int x) { return x * 28; }
+inline int f7813_29(int x) { return x * 29; }
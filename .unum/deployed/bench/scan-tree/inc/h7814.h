@@ -0,0 +1,42 @@
+#pragma once
+/* header 7814 */
+#include <vector>
+#include "h5520.h"
+#include "h2687.h"
+#include "h4831.h"
+#include "h8261.h"
+#include "h6456.h"
+#ifdef X
+#include "h7080.h"
+#endif
+struct S7814 { int a; const char *s = "x//y"; };
+inline int f7814_0(int x) { return x * 0; }
+inline int f7814_1(int x) { return x * 1; }
+inline int f7814_2(int x) { return x * 2; }
+inline int f7814_3(int x) { return x * 3; }
+inline int f7814_4(int x) { return x * 4; }
+inline int f7814_5(int x) { return x * 5; }
+inline int f7814_6(int x) { return x * 6; }
+inline int f7814_7(int x) { return x * 7; }
+inline int f7814_8(int x) { return x * 8; }
+inline int f7814_9(int x) { return x * 9; }
+inline int f7814_10(int x) { return x * 10; }
+inline int f7814_11(int x) { return x * 11; }
+inline int f7814_12(int x) { return x * 12; }
+inline int f7814_13(int x) { return x * 13; }
+inline int f7814_14(int x) { return x * 14; }
+inline int f7814_15(int x) { return x * 15; }
+inline int f7814_16(int x) { return x * 16; }
+inline int f7814_17(int x) { return x * 17; }
+inline int f7814_18(int x) { return x * 18; }
+inline int f7814_19(int x) { return x * 19; }
+inline int f7814_20(int x) { return x * 20; }
+inline int f7814_21(int x) { return x * 21; }
+inline int f7814_22(int x) { return x * 22; }
+inline int f7814_23(int x) { return x * 23; }
+inline int f7814_24(int x) { return x * 24; }
+inline int f7814_25(int x) { return x * 25; }
+inline int f7814_26(int x) { return x * 26; }
+inline int f7814_27(int x) { return x * 27; }
+inline int f7814_28(int x) { return x * 28; }
+inline int f7814_29(int x) { return x * 29; }
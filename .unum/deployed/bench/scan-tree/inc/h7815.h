@@ -0,0 +1,42 @@
+#pragma once
+/* header 7815 */
+#include <vector>
+#include "h4563.h"
+#include "h8876.h"
+#include "h5199.h"
+#include "h1199.h"
+#include "h1668.h"
+#ifdef X
+#include "h4055.h"
+#endif
+struct S7815 { int a; const char *s = "x//y"; };
+inline int f7815_0(int x) { return x * 0; }
+inline int f7815_1(int x) { return x * 1; }
+inline int f7815_2(int x) { return x * 2; }
+inline int f7815_3(int x) { return x * 3; }
+inline int f7815_4(int x) { return x * 4; }
+inline int f7815_5(int x) { return x * 5; }
+inline int f7815_6(int x) { return x * 6; }
+inline int f7815_7(int x) { return x * 7; }
+inline int f7815_8(int x) { return x * 8; }
+inline int f7815_9(int x) { return x * 9; }
+inline int f7815_10(int x) { return x * 10; }
+inline int f7815_11(int x) { return x * 11; }
+inline int f7815_12(int x) { return x * 12; }
+inline int f7815_13(int x) { return x * 13; }
+inline int f7815_14(int x) { return x * 14; }
+inline int f7815_15(int x) { return x * 15; }
+inline int f7815_16(int x) { return x * 16; }
+inline int f7815_17(int x) { return x * 17; }
+inline int f7815_18(int x) { return x * 18; }
+inline int f7815_19(int x) { return x * 19; }
+inline int f7815_20(int x) { return x * 20; }
+inline int f7815_21(int x) { return x * 21; }
+inline int f7815_22(int x) { return x * 22; }
+inline int f7815_23(int x) { return x * 23; }
+inline int f7815_24(int x) { return x * 24; }
+inline int f7815_25(int x) { return x * 25; }
+inline int f7815_26(int x) { return x * 26; }
+inline int f7815_27(int x) { return x * 27; }
+inline int f7815_28(int x) { return x * 28; }
+inline int f7815_29(int x) { return x * 29; }
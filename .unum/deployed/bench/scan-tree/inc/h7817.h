@@ -0,0 +1,42 @@
+#pragma once
+/* header 7817 */
+#include <vector>
+#include "h5114.h"
+#include "h5325.h"
+#include "h9206.h"
+#include "h1646.h"
+#include "h6514.h"
+#ifdef X
+#include "h2085.h"
+#endif
+struct S7817 { int a; const char *s = "x//y"; };
+inline int f7817_0(int x) { return x * 0; }
+inline int f7817_1(int x) { return x * 1; }
+inline int f7817_2(int x) { return x * 2; }
+inline int f7817_3(int x) { return x * 3; }
+inline int f7817_4(int x) { return x * 4; }
+inline int f7817_5(int x) { return x * 5; }
+inline int f7817_6(int x) { return x * 6; }
+inline int f7817_7(int x) { return x * 7; }
+inline int f7817_8(int x) { return x * 8; }
+inline int f7817_9(int x) { return x * 9; }
+inline int f7817_10(int x) { return x * 10; }
+inline int f7817_11(int x) { return x * 11; }
+inline int f7817_12(int x) { return x * 12; }
+inline int f7817_13(int x) { return x * 13; }
+inline int f7817_14(int x) { return x * 14; }
+inline int f7817_15(int x) { return x * 15; }
+inline int f7817_16(int x) { return x * 16; }
+inline int f7817_17(int x) { return x * 17; }
+inline int f7817_18(int x) { return x * 18; }
+inline int f7817_19(int x) { return x * 19; }
+inline int f7817_20(int x) { return x * 20; }
+inline int f7817_21(int x) { return x * 21; }
+inline int f7817_22(int x) { return x * 22; }
+inline int f7817_23(int x) { return x * 23; }
+inline int f7817_24(int x) { return x * 24; }
+inline int f7817_25(int x) { return x * 25; }
+inline int f7817_26(int x) { return x * 26; }
+inline int f7817_27(int x) { return x * 27; }
+inline int f7817_28(int x) { return x * 28; }
+inline int f7817_29(int x) { return x * 29; }
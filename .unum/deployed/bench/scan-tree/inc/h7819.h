@@ -0,0 +1,42 @@
+#pragma once
+/* header 7819 */
+#include <vector>
+#include "h2756.h"
+#include "h1405.h"
+#include "h3738.h"
+#include "h708.h"
+#include "h8819.h"
+#ifdef X
+#include "h3561.h"
+#endif
+struct S7819 { int a; const char *s = "x//y"; };
+inline int f7819_0(int x) { return x * 0; }
+inline int f7819_1(int x) { return x * 1; }
+inline int f7819_2(int x) { return x * 2; }
+inline int f7819_3(int x) { return x * 3; }
+inline int f7819_4(int x) { return x * 4; }
+inline int f7819_5(int x) { return x * 5; }
+inline int f7819_6(int x) { return x * 6; }
+inline int f7819_7(int x) { return x * 7; }
+inline int f7819_8(int x) { return x * 8; }
+inline int f7819_9(int x) { return x * 9; }
+inline int f7819_10(int x) { return x * 10; }
+inline int f7819_11(int x) { return x * 11; }
+inline int f7819_12(int x) { return x * 12; }
+inline int f7819_13(int x) { return x * 13; }
+inline int f7819_14(int x) { return x * 14; }
+inline int f7819_15(int x) { return x * 15; }
+inline int f7819_16(int x) { return x * 16; }
+inline int f7819_17(int x) { return x * 17; }
+inline int f7819_18(int x) { return x * 18; }
+inline int f7819_19(int x) { return x * 19; }
+inline int f7819_20(int x) { return x * 20; }
+inline int f7819_21(int x) { return x * 21; }
+inline int f7819_22(int x) { return x * 22; }
+inline int f7819_23(int x) { return x * 23; }
+inline int f7819_24(int x) { return x * 24; }
+inline int f7819_25(int x) { return x * 25; }
+inline int f7819_26(int x) { return x * 26; }
+inline int f7819_27(int x) { return x * 27; }
+inline int f7819_28(int x) { return x * 28; }
+inline int f7819_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 782 */
+#include <vector>
+#include "h4728.h"
+#include "h3052.h"
+#include "h5129.h"
+#include "h996.h"
+#include "h9211.h"
+#ifdef X
+#include "h4829.h"
+#endif
+struct S782 { int a; const char *s = "x//y"; };
+inline int f782_0(int x) { return x * 0; }
+inline int f782_1(int x) { return x * 1; }
+inline int f782_2(int x) { return x * 2; }
+inline int f782_3(int x) { return x * 3; }
+inline int f782_4(int x) { return x * 4; }
+inline int f782_5(int x) { return x * 5; }
+inline int f782_6(int x) { return x * 6; }
+inline int f782_7(int x) { return x * 7; }
+inline int f782_8(int x) { return x * 8; }
+inline int f782_9(int x) { return x * 9; }
+inline int f782_10(int x) { return x * 10; }
+inline int f782_11(int x) { return x * 11; }
+inline int f782_12(int x) { return x * 12; }
+inline int f782_13(int x) { return x * 13; }
+inline int f782_14(int x) { return x * 14; }
+inline int f782_15(int x) { return x * 15; }
+inline int f782_16(int x) { return x * 16; }
+inline int f782_17(int x) { return x * 17; }
+inline int f782_18(int x) { return x * 18; }
+inline int f782_19(int x) { return x * 19; }
+inline int f782_20(int x) { return x * 20; }
+inline int f782_21(int x) { return x * 21; }
+inline int f782_22(int x) { return x * 22; }
+inline int f782_23(int x) { return x * 23; }
+inline int f782_24(int x) { return x * 24; }
+inline int f782_25(int x) { return x * 25; }
+inline int f782_26(int x) { return x * 26; }
+inline int f782_27(int x) { return x * 27; }
+inline int f782_28(int x) { return x * 28; }
+inline int f782_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7821 */
+#include <vector>
+#include "h7031.h"
+#include "h5959.h"
+#include "h9168.h"
+#include "h4053.h"
+#include "h4478.h"
+#ifdef X
+#include "h3220.h"
+#endif
+struct S7821 { int a; const char *s = "x//y"; };
+inline int f7821_0(int x) { return x * 0; }
+inline int f7821_1(int x) { return x * 1; }
+inline int f7821_2(int x) { return x * 2; }
+inline int f7821_3(int x) { return x * 3; }
+inline int f7821_4(int x) { return x * 4; }
+inline int f7821_5(int x) { return x * 5; }
+inline int f7821_6(int x) { return x * 6; }
+inline int f7821_7(int x) { return x * 7; }
+inline int f7821_8(int x) { return x * 8; }
+inline int f7821_9(int x) { return x * 9; }
+inline int f7821_10(int x) { return x * 10; }
+inline int f7821_11(int x) { return x * 11; }
+inline int f7821_12(int x) { return x * 12; }
+inline int f7821_13(int x) { return x * 13; }
+inline int f7821_14(int x) { return x * 14; }
+inline int f7821_15(int x) { return x * 15; }
+inline int f7821_16(int x) { return x * 16; }
+inline int f7821_17(int x) { return x * 17; }
+inline int f7821_18(int x) { return x * 18; }
+inline int f7821_19(int x) { return x * 19; }
+inline int f7821_20(int x) { return x * 20; }
+inline int f7821_21(int x) { return x * 21; }
+inline int f7821_22(int x) { return x * 22; }
+inline int f7821_23(int x) { return x * 23; }
+inline int f7821_24(int x) { return x * 24; }
+inline int f7821_25(int x) { return x * 25; }
+inline int f7821_26(int x) { return x * 26; }
+inline int f7821_27(int x) { return x * 27; }
+inline int f7821_28(int x) { return x * 28; }
+inline int f7821_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7822 */
+#include <vector>
+#include "h1796.h"
+#include "h363.h"
+#include "h4955.h"
+#include "h5836.h"
+#include "h368.h"
+#ifdef X
+#include "h2534.h"
+#endif
+struct S7822 { int a; const char *s = "x//y"; };
+inline int f7822_0(int x) { return x * 0; }
+inline int f7822_1(int x) { return x * 1; }
+inline int f7822_2(int x) { return x * 2; }
+inline int f7822_3(int x) { return x * 3; }
+inline int f7822_4(int x) { return x * 4; }
+inline int f7822_5(int x) { return x * 5; }
+inline int f7822_6(int x) { return x * 6; }
+inline int f7822_7(int x) { return x * 7; }
+inline int f7822_8(int x) { return x * 8; }
+inline int f7822_9(int x) { return x * 9; }
+inline int f7822_10(int x) { return x * 10; }
+inline int f7822_11(int x) { return x * 11; }
+inline int f7822_12(int x) { return x * 12; }
+inline int f7822_13(int x) { return x * 13; }
+inline int f7822_14(int x) { return x * 14; }
+inline int f7822_15(int x) { return x * 15; }
+inline int f7822_16(int x) { return x * 16; }
+inline int f7822_17(int x) { return x * 17; }
+inline int f7822_18(int x) { return x * 18; }
+inline int f7822_19(int x) { return x * 19; }
+inline int f7822_20(int x) { return x * 20; }
+inline int f7822_21(int x) { return x * 21; }
+inline int f7822_22(int x) { return x * 22; }
+inline int f7822_23(int x) { return x * 23; }
+inline int f7822_24(int x) { return x * 24; }
+inline int f7822_25(int x) { return x * 25; }
+inline int f7822_26(int x) { return x * 26; }
+inline int f7822_27(int x) { return x * 27; }
+inline int f7822_28(int x) { return x * 28; }
+inline int f7822_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7825 */
+#include <vector>
+#include "h36.h"
+#include "h5450.h"
+#include "h9476.h"
+#include "h3374.h"
+#include "h3060.h"
+#ifdef X
+#include "h2469.h"
+#endif
+struct S7825 { int a; const char *s = "x//y"; };
+inline int f7825_0(int x) { return x * 0; }
+inline int f7825_1(int x) { return x * 1; }
+inline int f7825_2(int x) { return x * 2; }
+inline int f7825_3(int x) { return x * 3; }
+inline int f7825_4(int x) { return x * 4; }
+inline int f7825_5(int x) { return x * 5; }
+inline int f7825_6(int x) { return x * 6; }
+inline int f7825_7(int x) { return x * 7; }
+inline int f7825_8(int x) { return x * 8; }
+inline int f7825_9(int x) { return x * 9; }
+inline int f7825_10(int x) { return x * 10; }
+inline int f7825_11(int x) { return x * 11; }
+inline int f7825_12(int x) { return x * 12; }
+inline int f7825_13(int x) { return x * 13; }
+inline int f7825_14(int x) { return x * 14; }
+inline int f7825_15(int x) { return x * 15; }
+inline int f7825_16(int x) { return x * 16; }
+inline int f7825_17(int x) { return x * 17; }
+inline int f7825_18(int x) { return x * 18; }
+inline int f7825_19(int x) { return x * 19; }
+inline int f7825_20(int x) { return x * 20; }
+inline int f7825_21(int x) { return x * 21; }
+inline int f7825_22(int x) { return x * 22; }
+inline int f7825_23(int x) { return x * 23; }
+inline int f7825_24(int x) { return x * 24; }
+inline int f7825_25(int x) { return x * 25; }
+inline int f7825_26(int x) { return x * 26; }
+inline int f7825_27(int x) { return x * 27; }
+inline int f7825_28(int x) { return x * 28; }
+inline int f7825_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7833 */
+#include <vector>
+#include "h1249.h"
+#include "h8009.h"
+#include "h9176.h"
+#include "h8914.h"
+#include "h7554.h"
+#ifdef X
+#include "h5684.h"
+#endif
+struct S7833 { int a; const char *s = "x//y"; };
+inline int f7833_0(int x) { return x * 0; }
+inline int f7833_1(int x) { return x * 1; }
+inline int f7833_2(int x) { return x * 2; }
+inline int f7833_3(int x) { return x * 3; }
+inline int f7833_4(int x) { return x * 4; }
+inline int f7833_5(int x) { return x * 5; }
+inline int f7833_6(int x) { return x * 6; }
+inline int f7833_7(int x) { return x * 7; }
+inline int f7833_8(int x) { return x * 8; }
+inline int f7833_9(int x) { return x * 9; }
+inline int f7833_10(int x) { return x * 10; }
+inline int f7833_11(int x) { return x * 11; }
+inline int f7833_12(int x) { return x * 12; }
+inline int f7833_13(int x) { return x * 13; }
+inline int f7833_14(int x) { return x * 14; }
+inline int f7833_15(int x) { return x * 15; }
+inline int f7833_16(int x) { return x * 16; }
+inline int f7833_17(int x) { return x * 17; }
+inline int f7833_18(int x) { return x * 18; }
+inline int f7833_19(int x) { return x * 19; }
+inline int f7833_20(int x) { return x * 20; }
+inline int f7833_21(int x) { return x * 21; }
+inline int f7833_22(int x) { return x * 22; }
+inline int f7833_23(int x) { return x * 23; }
+inline int f7833_24(int x) { return x * 24; }
+inline int f7833_25(int x) { return x * 25; }
+inline int f7833_26(int x) { return x * 26; }
+inline int f7833_27(int x) { return x * 27; }
+inline int f7833_28(int x) { return x * 28; }
+inline int f7833_29(int x) { return x * 29; }
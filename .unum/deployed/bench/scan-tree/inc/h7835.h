@@ -0,0 +1,42 @@
+#pragma once
+/* header 7835 */
+#include <vector>
+#include "h3507.h"
+#include "h3790.h"
+#include "h9862.h"
+#include "h7834.h"
+#include "h3766.h"
+#ifdef X
+#include "h4218.h"
+#endif
+struct S7835 { int a; const char *s = "x//y"; };
+inline int f7835_0(int x) { return x * 0; }
+inline int f7835_1(int x) { return x * 1; }
+inline int f7835_2(int x) { return x * 2; }
+inline int f7835_3(int x) { return x * 3; }
+inline int f7835_4(int x) { return x * 4; }
+inline int f7835_5(int x) { return x * 5; }
+inline int f7835_6(int x) { return x * 6; }
+inline int f7835_7(int x) { return x * 7; }
+inline int f7835_8(int x) { return x * 8; }
+inline int f7835_9(int x) { return x * 9; }
+inline int f7835_10(int x) { return x * 10; }
+inline int f7835_11(int x) { return x * 11; }
+inline int f7835_12(int x) { return x * 12; }
+inline int f7835_13(int x) { return x * 13; }
+inline int f7835_14(int x) { return x * 14; }
+inline int f7835_15(int x) { return x * 15; }
+inline int f7835_16(int x) { return x * 16; }
+inline int f7835_17(int x) { return x * 17; }
+inline int f7835_18(int x) { return x * 18; }
+inline int f7835_19(int x) { return x * 19; }
+inline int f7835_20(int x) { return x * 20; }
+inline int f7835_21(int x) { return x * 21; }
+inline int f7835_22(int x) { return x * 22; }
+inline int f7835_23(int x) { return x * 23; }
+inline int f7835_24(int x) { return x * 24; }
+inline int f7835_25(int x) { return x * 25; }
+inline int f7835_26(int x) { return x * 26; }
+inline int f7835_27(int x) { return x * 27; }
+inline int f7835_28(int x) { return x * 28; }
+inline int f7835_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7837 */
+#include <vector>
+#include "h8532.h"
+#include "h2467.h"
+#include "h5976.h"
+#include "h7576.h"
+#include "h9120.h"
+#ifdef X
+#include "h4798.h"
+#endif
+struct S7837 { int a; const char *s = "x//y"; };
+inline int f7837_0(int x) { return x * 0; }
+inline int f7837_1(int x) { return x * 1; }
+inline int f7837_2(int x) { return x * 2; }
+inline int f7837_3(int x) { return x * 3; }
+inline int f7837_4(int x) { return x * 4; }
+inline int f7837_5(int x) { return x * 5; }
+inline int f7837_6(int x) { return x * 6; }
+inline int f7837_7(int x) { return x * 7; }
+inline int f7837_8(int x) { return x * 8; }
+inline int f7837_9(int x) { return x * 9; }
+inline int f7837_10(int x) { return x * 10; }
+inline int f7837_11(int x) { return x * 11; }
+inline int f7837_12(int x) { return x * 12; }
+inline int f7837_13(int x) { return x * 13; }
+inline int f7837_14(int x) { return x * 14; }
+inline int f7837_15(int x) { return x * 15; }
+inline int f7837_16(int x) { return x * 16; }
+inline int f7837_17(int x) { return x * 17; }
+inline int f7837_18(int x) { return x * 18; }
+inline int f7837_19(int x) { return x * 19; }
+inline int f7837_20(int x) { return x * 20; }
+inline int f7837_21(int x) { return x * 21; }
+inline int f7837_22(int x) { return x * 22; }
+inline int f7837_23(int x) { return x * 23; }
+inline int f7837_24(int x) { return x * 24; }
+inline int f7837_25(int x) { return x * 25; }
+inline int f7837_26(int x) { return x * 26; }
+inline int f7837_27(int x) { return x * 27; }
+inline int f7837_28(int x) { return x * 28; }
+inline int f7837_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 784 */
+#include <vector>
+#include "h9375.h"
+#include "h9640.h"
+#include "h392.h"
+#include "h5611.h"
+#include "h1056.h"
+#ifdef X
+#include "h4523.h"
+#endif
+struct S784 { int a; const char *s = "x//y"; };
+inline int f784_0(int x) { return x * 0; }
+inline int f784_1(int x) { return x * 1; }
+inline int f784_2(int x) { return x * 2; }
+inline int f784_3(int x) { return x * 3; }
+inline int f784_4(int x) { return x * 4; }
+inline int f784_5(int x) { return x * 5; }
+inline int f784_6(int x) { return x * 6; }
+inline int f784_7(int x) { return x * 7; }
+inline int f784_8(int x) { return x * 8; }
+inline int f784_9(int x) { return x * 9; }
+inline int f784_10(int x) { return x * 10; }
+inline int f784_11(int x) { return x * 11; }
+inline int f784_12(int x) { return x * 12; }
+inline int f784_13(int x) { return x * 13; }
+inline int f784_14(int x) { return x * 14; }
+inline int f784_15(int x) { return x * 15; }
+inline int f784_16(int x) { return x * 16; }
+inline int f784_17(int x) { return x * 17; }
+inline int f784_18(int x) { return x * 18; }
+inline int f784_19(int x) { return x * 19; }
+inline int f784_20(int x) { return x * 20; }
+inline int f784_21(int x) { return x * 21; }
+inline int f784_22(int x) { return x * 22; }
+inline int f784_23(int x) { return x * 23; }
+inline int f784_24(int x) { return x * 24; }
+inline int f784_25(int x) { return x * 25; }
+inline int f784_26(int x) { return x * 26; }
+inline int f784_27(int x) { return x * 27; }
+inline int f784_28(int x) { return x * 28; }
+inline int f784_29(int x) { return x * 29; }
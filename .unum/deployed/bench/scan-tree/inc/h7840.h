@@ -0,0 +1,42 @@
+#pragma once
+/* header 7840 */
+#include <vector>
+#include "h3489.h"
+#include "h629.h"
+#include "h6078.h"
+#include "h5356.h"
+#include "h9710.h"
+#ifdef X
+#include "h194.h"
+#endif
+struct S7840 { int a; const char *s = "x//y"; };
+inline int f7840_0(int x) { return x * 0; }
+inline int f7840_1(int x) { return x * 1; }
+inline int f7840_2(int x) { return x * 2; }
+inline int f7840_3(int x) { return x * 3; }
+inline int f7840_4(int x) { return x * 4; }
+inline int f7840_5(int x) { return x * 5; }
+inline int f7840_6(int x) { return x * 6; }
+inline int f7840_7(int x) { return x * 7; }
+inline int f7840_8(int x) { return x * 8; }
+inline int f7840_9(int x) { return x * 9; }
+inline int f7840_10(int x) { return x * 10; }
+inline int f7840_11(int x) { return x * 11; }
+inline int f7840_12(int x) { return x * 12; }
+inline int f7840_13(int x) { return x * 13; }
+inline int f7840_14(int x) { return x * 14; }
+inline int f7840_15(int x) { return x * 15; }
+inline int f7840_16(int x) { return x * 16; }
+inline int f7840_17(int x) { return x * 17; }
+inline int f7840_18(int x) { return x * 18; }
+inline int f7840_19(int x) { return x * 19; }
+inline int f7840_20(int x) { return x * 20; }
+inline int f7840_21(int x) { return x * 21; }
+inline int f7840_22(int x) { return x * 22; }
+inline int f7840_23(int x) { return x * 23; }
+inline int f7840_24(int x) { return x * 24; }
+inline int f7840_25(int x) { return x * 25; }
+inline int f7840_26(int x) { return x * 26; }
+inline int f7840_27(int x) { return x * 27; }
+inline int f7840_28(int x) { return x * 28; }
+inline int f7840_29(int x) { return x * 29; }
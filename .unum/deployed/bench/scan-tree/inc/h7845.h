@@ -0,0 +1,42 @@
+#pragma once
+/* header 7845 */
+#include <vector>
+#include "h1800.h"
+#include "h7902.h"
+#include "h8374.h"
+#include "h4878.h"
+#include "h2910.h"
+#ifdef X
+#include "h4115.h"
+#endif
+struct S7845 { int a; const char *s = "x//y"; };
+inline int f7845_0(int x) { return x * 0; }
+inline int f7845_1(int x) { return x * 1; }
+inline int f7845_2(int x) { return x * 2; }
+inline int f7845_3(int x) { return x * 3; }
+inline int f7845_4(int x) { return x * 4; }
+inline int f7845_5(int x) { return x * 5; }
+inline int f7845_6(int x) { return x * 6; }
+inline int f7845_7(int x) { return x * 7; }
+inline int f7845_8(int x) { return x * 8; }
+inline int f7845_9(int x) { return x * 9; }
+inline int f7845_10(int x) { return x * 10; }
+inline int f7845_11(int x) { return x * 11; }
+inline int f7845_12(int x) { return x * 12; }
+inline int f7845_13(int x) { return x * 13; }
+inline int f7845_14(int x) { return x * 14; }
+inline int f7845_15(int x) { return x * 15; }
+inline int f7845_16(int x) { return x * 16; }
+inline int f7845_17(int x) { return x * 17; }
+inline int f7845_18(int x) { return x * 18; }
+inline int f7845_19(int x) { return x * 19; }
+inline int f7845_20(int x) { return x * 20; }
+inline int f7845_21(int x) { return x * 21; }
+inline int f7845_22(int x) { return x * 22; }
+inline int f7845_23(int x) { return x * 23; }
+inline int f7845_24(int x) { return x * 24; }
+inline int f7845_25(int x) { return x * 25; }
+inline int f7845_26(int x) { return x * 26; }
+inline int f7845_27(int x) { return x * 27; }
+inline int f7845_28(int x) { return x * 28; }
+inline int f7845_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7851 */
+#include <vector>
+#include "h8478.h"
+#include "h3812.h"
+#include "h3839.h"
+#include "h2843.h"
+#include "h6931.h"
+#ifdef X
+#include "h6571.h"
+#endif
+struct S7851 { int a; const char *s = "x//y"; };
+inline int f7851_0(int x) { return x * 0; }
+inline int f7851_1(int x) { return x * 1; }
+inline int f7851_2(int x) { return x * 2; }
+inline int f7851_3(int x) { return x * 3; }
+inline int f7851_4(int x) { return x * 4; }
+inline int f7851_5(int x) { return x * 5; }
+inline int f7851_6(int x) { return x * 6; }
+inline int f7851_7(int x) { return x * 7; }
+inline int f7851_8(int x) { return x * 8; }
+inline int f7851_9(int x) { return x * 9; }
+inline int f7851_10(int x) { return x * 10; }
+inline int f7851_11(int x) { return x * 11; }
+inline int f7851_12(int x) { return x * 12; }
+inline int f7851_13(int x) { return x * 13; }
+inline int f7851_14(int x) { return x * 14; }
+inline int f7851_15(int x) { return x * 15; }
+inline int f7851_16(int x) { return x * 16; }
+inline int f7851_17(int x) { return x * 17; }
+inline int f7851_18(int x) { return x * 18; }
+inline int f7851_19(int x) { return x * 19; }
+inline int f7851_20(int x) { return x * 20; }
+inline int f7851_21(int x) { return x * 21; }
+inline int f7851_22(int x) { return x * 22; }
+inline int f7851_23(int x) { return x * 23; }
+inline int f7851_24(int x) { return x * 24; }
+inline int f7851_25(int x) { return x * 25; }
+inline int f7851_26(int x) { return x * 26; }
+inline int f7851_27(int x) { return x * 27; }
+inline int f7851_28(int x) { return x * 28; }
+inline int f7851_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7853 */
+#include <vector>
+#include "h4271.h"
+#include "h2910.h"
+#include "h9675.h"
+#include "h4916.h"
+#include "h6200.h"
+#ifdef X
+#include "h4890.h"
+#endif
+struct S7853 { int a; const char *s = "x//y"; };
+inline int f7853_0(int x) { return x * 0; }
+inline int f7853_1(int x) { return x * 1; }
+inline int f7853_2(int x) { return x * 2; }
+inline int f7853_3(int x) { return x * 3; }
+inline int f7853_4(int x) { return x * 4; }
+inline int f7853_5(int x) { return x * 5; }
+inline int f7853_6(int x) { return x * 6; }
+inline int f7853_7(int x) { return x * 7; }
+inline int f7853_8(int x) { return x * 8; }
+inline int f7853_9(int x) { return x * 9; }
+inline int f7853_10(int x) { return x * 10; }
+inline int f7853_11(int x) { return x * 11; }
+inline int f7853_12(int x) { return x * 12; }
+inline int f7853_13(int x) { return x * 13; }
+inline int f7853_14(int x) { return x * 14; }
+inline int f7853_15(int x) { return x * 15; }
+inline int f7853_16(int x) { return x * 16; }
+inline int f7853_17(int x) { return x * 17; }
+inline int f7853_18(int x) { return x * 18; }
+inline int f7853_19(int x) { return x * 19; }
+inline int f7853_20(int x) { return x * 20; }
+inline int f7853_21(int x) { return x * 21; }
+inline int f7853_22(int x) { return x * 22; }
+inline int f7853_23(int x) { return x * 23; }
+inline int f7853_24(int x) { return x * 24; }
+inline int f7853_25(int x) { return x * 25; }
+inline int f7853_26(int x) { return x * 26; }
+inline int f7853_27(int x) { return x * 27; }
+inline int f7853_28(int x) { return x * 28; }
+inline int f7853_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7855 */
+#include <vector>
+#include "h357.h"
+#include "h7193.h"
+#include "h648.h"
+#include "h4664.h"
+#include "h3954.h"
+#ifdef X
+#include "h3192.h"
+#endif
+struct S7855 { int a; const char *s = "x//y"; };
+inline int f7855_0(int x) { return x * 0; }
+inline int f7855_1(int x) { return x * 1; }
+inline int f7855_2(int x) { return x * 2; }
+inline int f7855_3(int x) { return x * 3; }
+inline int f7855_4(int x) { return x * 4; }
+inline int f7855_5(int x) { return x * 5; }
+inline int f7855_6(int x) { return x * 6; }
+inline int f7855_7(int x) { return x * 7; }
+inline int f7855_8(int x) { return x * 8; }
+inline int f7855_9(int x) { return x * 9; }
+inline int f7855_10(int x) { return x * 10; }
+inline int f7855_11(int x) { return x * 11; }
+inline int f7855_12(int x) { return x * 12; }
+inline int f7855_13(int x) { return x * 13; }
+inline int f7855_14(int x) { return x * 14; }
+inline int f7855_15(int x) { return x * 15; }
+inline int f7855_16(int x) { return x * 16; }
+inline int f7855_17(int x) { return x * 17; }
+inline int f7855_18(int x) { return x * 18; }
+inline int f7855_19(int x) { return x * 19; }
+inline int f7855_20(int x) { return x * 20; }
+inline int f7855_21(int x) { return x * 21; }
+inline int f7855_22(int x) { return x * 22; }
+inline int f7855_23(int x) { return x * 23; }
+inline int f7855_24(int x) { return x * 24; }
+inline int f7855_25(int x) { return x * 25; }
+inline int f7855_26(int x) { return x * 26; }
+inline int f7855_27(int x) { return x * 27; }
+inline int f7855_28(int x) { return x * 28; }
+inline int f7855_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7856 */
+#include <vector>
+#include "h1397.h"
+#include "h8637.h"
+#include "h2516.h"
+#include "h4205.h"
+#include "h379.h"
+#ifdef X
+#include "h3645.h"
+#endif
+struct S7856 { int a; const char *s = "x//y"; };
+inline int f7856_0(int x) { return x * 0; }
+inline int f7856_1(int x) { return x * 1; }
+inline int f7856_2(int x) { return x * 2; }
+inline int f7856_3(int x) { return x * 3; }
+inline int f7856_4(int x) { return x * 4; }
+inline int f7856_5(int x) { return x * 5; }
+inline int f7856_6(int x) { return x * 6; }
+inline int f7856_7(int x) { return x * 7; }
+inline int f7856_8(int x) { return x * 8; }
+inline int f7856_9(int x) { return x * 9; }
+inline int f7856_10(int x) { return x * 10; }
+inline int f7856_11(int x) { return x * 11; }
+inline int f7856_12(int x) { return x * 12; }
+inline int f7856_13(int x) { return x * 13; }
+inline int f7856_14(int x) { return x * 14; }
+inline int f7856_15(int x) { return x * 15; }
+inline int f7856_16(int x) { return x * 16; }
+inline int f7856_17(int x) { return x * 17; }
+inline int f7856_18(int x) { return x * 18; }
+inline int f7856_19(int x) { return x * 19; }
+inline int f7856_20(int x) { return x * 20; }
+inline int f7856_21(int x) { return x * 21; }
+inline int f7856_22(int x) { return x * 22; }
+inline int f7856_23(int x) { return x * 23; }
+inline int f7856_24(int x) { return x * 24; }
+inline int f7856_25(int x) { return x * 25; }
+inline int f7856_26(int x) { return x * 26; }
+inline int f7856_27(int x) { return x * 27; }
+inline int f7856_28(int x) { return x * 28; }
+inline int f7856_29(int x) { return x * 29; }
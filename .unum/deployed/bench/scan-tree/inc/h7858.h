@@ -0,0 +1,42 @@
+#pragma once
+/* header 7858 */
+#include <vector>
+#include "h189.h"
+#include "h8533.h"
+#include "h8564.h"
+#include "h5129.h"
+#include "h6020.h"
+#ifdef X
+#include "h2419.h"
+#endif
+struct S7858 { int a; const char *s = "x//y"; };
+inline int f7858_0(int x) { return x * 0; }
+inline int f7858_1(int x) { return x * 1; }
+inline int f7858_2(int x) { return x * 2; }
+inline int f7858_3(int x) { return x * 3; }
+inline int f7858_4(int x) { return x * 4; }
+inline int f7858_5(int x) { return x * 5; }
+inline int f7858_6(int x) { return x * 6; }
+inline int f7858_7(int x) { return x * 7; }
+inline int f7858_8(int x) { return x * 8; }
+inline int f7858_9(int x) { return x * 9; }
+inline int f7858_10(int x) { return x * 10; }
+inline int f7858_11(int x) { return x * 11; }
+inline int f7858_12(int x) { return x * 12; }
+inline int f7858_13(int x) { return x * 13; }
+inline int f7858_14(int x) { return x * 14; }
+inline int f7858_15(int x) { return x * 15; }
+inline int f7858_16(int x) { return x * 16; }
+inline int f7858_17(int x) { return x * 17; }
+inline int f7858_18(int x) { return x * 18; }
+inline int f7858_19(int x) { return x * 19; }
+inline int f7858_20(int x) { return x * 20; }
+inline int f7858_21(int x) { return x * 21; }
+inline int f7858_22(int x) { return x * 22; }
+inline int f7858_23(int x) { return x * 23; }
+inline int f7858_24(int x) { return x * 24; }
+inline int f7858_25(int x) { return x * 25; }
+inline int f7858_26(int x) { return x * 26; }
+inline int f7858_27(int x) { return x * 27; }
+inline int f7858_28(int x) { return x * 28; }
+inline int f7858_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 786 */
+#include <vector>
+#include "h7953.h"
+#include "h2585.h"
+#include "h4886.h"
+#include "h4341.h"
+#include "h795.h"
+#ifdef X
+#include "h3366.h"
+#endif
+struct S786 { int a; const char *s = "x//y"; };
+inline int f786_0(int x) { return x * 0; }
+inline int f786_1(int x) { return x * 1; }
+inline int f786_2(int x) { return x * 2; }
+inline int f786_3(int x) { return x * 3; }
+inline int f786_4(int x) { return x * 4; }
+inline int f786_5(int x) { return x * 5; }
+inline int f786_6(int x) { return x * 6; }
+inline int f786_7(int x) { return x * 7; }
+inline int f786_8(int x) { return x * 8; }
+inline int f786_9(int x) { return x * 9; }
+inline int f786_10(int x) { return x * 10; }
+inline int f786_11(int x) { return x * 11; }
+inline int f786_12(int x) { return x * 12; }
+inline int f786_13(int x) { return x * 13; }
+inline int f786_14(int x) { return x * 14; }
+inline int f786_15(int x) { return x * 15; }
+inline int f786_16(int x) { return x * 16; }
+inline int f786_17(int x) { return x * 17; }
+inline int f786_18(int x) { return x * 18; }
+inline int f786_19(int x) { return x * 19; }
+inline int f786_20(int x) { return x * 20; }
+inline int f786_21(int x) { return x * 21; }
+inline int f786_22(int x) { return x * 22; }
+inline int f786_23(int x) { return x * 23; }
+inline int f786_24(int x) { return x * 24; }
+inline int f786_25(int x) { return x * 25; }
+inline int f786_26(int x) { return x * 26; }
+inline int f786_27(int x) { return x * 27; }
+inline int f786_28(int x) { return x * 28; }
+inline int f786_29(int x) { return x * 29; }
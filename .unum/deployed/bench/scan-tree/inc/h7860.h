@@ -0,0 +1,42 @@
+#pragma once
+/* header 7860 */
+#include <vector>
+#include "h9989.h"
+#include "h8142.h"
+#include "h5293.h"
+#include "h5500.h"
+#include "h1797.h"
+#ifdef X
+#include "h3447.h"
+#endif
+struct S7860 { int a; const char *s = "x//y"; };
+inline int f7860_0(int x) { return x * 0; }
+inline int f7860_1(int x) { return x * 1; }
+inline int f7860_2(int x) { return x * 2; }
+inline int f7860_3(int x) { return x * 3; }
+inline int f7860_4(int x) { return x * 4; }
+inline int f7860_5(int x) { return x * 5; }
+inline int f7860_6(int x) { return x * 6; }
+inline int f7860_7(int x) { return x * 7; }
+inline int f7860_8(int x) { return x * 8; }
+inline int f7860_9(int x) { return x * 9; }
+inline int f7860_10(int x) { return x * 10; }
+inline int f7860_11(int x) { return x * 11; }
+inline int f7860_12(int x) { return x * 12; }
+inline int f7860_13(int x) { return x * 13; }
+inline int f7860_14(int x) { return x * 14; }
+inline int f7860_15(int x) { return x * 15; }
+inline int f7860_16(int x) { return x * 16; }
+inline int f7860_17(int x) { return x * 17; }
+inline int f7860_18(int x) { return x * 18; }
+inline int f7860_19(int x) { return x * 19; }
+inline int f7860_20(int x) { return x * 20; }
+inline int f7860_21(int x) { return x * 21; }
+inline int f7860_22(int x) { return x * 22; }
+inline int f7860_23(int x) { return x * 23; }
+inline int f7860_24(int x) { return x * 24; }
+inline int f7860_25(int x) { return x * 25; }
+inline int f7860_26(int x) { return x * 26; }
+inline int f7860_27(int x) { return x * 27; }
+inline int f7860_28(int x) { return x * 28; }
+inline int f7860_29(int x) { return x * 29; }
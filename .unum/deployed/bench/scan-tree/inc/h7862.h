@@ -0,0 +1,42 @@
+#pragma once
+/* header 7862 */
+#include <vector>
+#include "h9824.h"
+#include "h3380.h"
+#include "h3600.h"
+#include "h8562.h"
+#include "h2546.h"
+#ifdef X
+#include "h9935.h"
+#endif
+struct S7862 { int a; const char *s = "x//y"; };
+inline int f7862_0(int x) { return x * 0; }
+inline int f7862_1(int x) { return x * 1; }
+inline int f7862_2(int x) { return x * 2; }
+inline int f7862_3(int x) { return x * 3; }
+inline int f7862_4(int x) { return x * 4; }
+inline int f7862_5(int x) { return x * 5; }
+inline int f7862_6(int x) { return x * 6; }
+inline int f7862_7(int x) { return x * 7; }
+inline int f7862_8(int x) { return x * 8; }
+inline int f7862_9(int x) { return x * 9; }
+inline int f7862_10(int x) { return x * 10; }
+inline int f7862_11(int x) { return x * 11; }
+inline int f7862_12(int x) { return x * 12; }
+inline int f7862_13(int x) { return x * 13; }
+inline int f7862_14(int x) { return x * 14; }
+inline int f7862_15(int x) { return x * 15; }
+inline int f7862_16(int x) { return x * 16; }
+inline int f7862_17(int x) { return x * 17; }
+inline int f7862_18(int x) { return x * 18; }
+inline int f7862_19(int x) { return x * 19; }
+inline int f7862_20(int x) { return x * 20; }
+inline int f7862_21(int x) { return x * 21; }
+inline int f7862_22(int x) { return x * 22; }
+inline int f7862_23(int x) { return x * 23; }
+inline int f7862_24(int x) { return x * 24; }
+inline int f7862_25(int x) { return x * 25; }
+inline int f7862_26(int x) { return x * 26; }
+inline int f7862_27(int x) { return x * 27; }
+inline int f7862_28(int x) { return x * 28; }
+inline int f7862_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7867 */
+#include <vector>
+#include "h5761.h"
+#include "h1615.h"
+#include "h5151.h"
+#include "h2199.h"
+#include "h9252.h"
+#ifdef X
+#include "h8933.h"
+#endif
+struct S7867 { int a; const char *s = "x//y"; };
+inline int f7867_0(int x) { return x * 0; }
+inline int f7867_1(int x) { return x * 1; }
+inline int f7867_2(int x) { return x * 2; }
+inline int f7867_3(int x) { return x * 3; }
+inline int f7867_4(int x) { return x * 4; }
+inline int f7867_5(int x) { return x * 5; }
+inline int f7867_6(int x) { return x * 6; }
+inline int f7867_7(int x) { return x * 7; }
+inline int f7867_8(int x) { return x * 8; }
+inline int f7867_9(int x) { return x * 9; }
+inline int f7867_10(int x) { return x * 10; }
+inline int f7867_11(int x) { return x * 11; }
+inline int f7867_12(int x) { return x * 12; }
+inline int f7867_13(int x) { return x * 13; }
+inline int f7867_14(int x) { return x * 14; }
+inline int f7867_15(int x) { return x * 15; }
+inline int f7867_16(int x) { return x * 16; }
+inline int f7867_17(int x) { return x * 17; }
+inline int f7867_18(int x) { return x * 18; }
+inline int f7867_19(int x) { return x * 19; }
+inline int f7867_20(int x) { return x * 20; }
+inline int f7867_21(int x) { return x * 21; }
+inline int f7867_22(int x) { return x * 22; }
+inline int f7867_23(int x) { return x * 23; }
+inline int f7867_24(int x) { return x * 24; }
+inline int f7867_25(int x) { return x * 25; }
+inline int f7867_26(int x) { return x * 26; }
+inline int f7867_27(int x) { return x * 27; }
+inline int f7867_28(int x) { return x * 28; }
+inline int f7867_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 787 */
+#include <vector>
+#include "h9303.h"
+#include "h9712.h"
+#include "h1746.h"
+#include "h5812.h"
+#include "h8506.h"
+#ifdef X
+#include "h2435.h"
+#endif
+struct S787 { int a; const char *s = "x//y"; };
+inline int f787_0(int x) { return x * 0; }
+inline int f787_1(int x) { return x * 1; }
+inline int f787_2(int x) { return x * 2; }
+inline int f787_3(int x) { return x * 3; }
+inline int f787_4(int x) { return x * 4; }
+inline int f787_5(int x) { return x * 5; }
+inline int f787_6(int x) { return x * 6; }
+inline int f787_7(int x) { return x * 7; }
+inline int f787_8(int x) { return x * 8; }
+inline int f787_9(int x) { return x * 9; }
+inline int f787_10(int x) { return x * 10; }
+inline int f787_11(int x) { return x * 11; }
+inline int f787_12(int x) { return x * 12; }
+inline int f787_13(int x) { return x * 13; }
+inline int f787_14(int x) { return x * 14; }
+inline int f787_15(int x) { return x * 15; }
+inline int f787_16(int x) { return x * 16; }
+inline int f787_17(int x) { return x * 17; }
+inline int f787_18(int x) { return x * 18; }
+inline int f787_19(int x) { return x * 19; }
+inline int f787_20(int x) { return x * 20; }
+inline int f787_21(int x) { return x * 21; }
+inline int f787_22(int x) { return x * 22; }
+inline int f787_23(int x) { return x * 23; }
+inline int f787_24(int x) { return x * 24; }
+inline int f787_25(int x) { return x * 25; }
+inline int f787_26(int x) { return x * 26; }
+inline int f787_27(int x) { return x * 27; }
+inline int f787_28(int x) { return x * 28; }
+inline int f787_29(int x) { return x * 29; }
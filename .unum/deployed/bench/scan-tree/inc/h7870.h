@@ -0,0 +1,42 @@
+#pragma once
+/* header 7870 */
+#include <vector>
+#include "h2138.h"
+#include "h5874.h"
+#include "h692.h"
+#include "h9370.h"
+#include "h7706.h"
+#ifdef X
+#include "h9924.h"
+#endif
+struct S7870 { int a; const char *s = "x//y"; };
+inline int f7870_0(int x) { return x * 0; }
+inline int f7870_1(int x) { return x * 1; }
+inline int f7870_2(int x) { return x * 2; }
+inline int f7870_3(int x) { return x * 3; }
+inline int f7870_4(int x) { return x * 4; }
+inline int f7870_5(int x) { return x * 5; }
+inline int f7870_6(int x) { return x * 6; }
+inline int f7870_7(int x) { return x * 7; }
+inline int f7870_8(int x) { return x * 8; }
+inline int f7870_9(int x) { return x * 9; }
+inline int f7870_10(int x) { return x * 10; }
+inline int f7870_11(int x) { return x * 11; }
+inline int f7870_12(int x) { return x * 12; }
+inline int f7870_13(int x) { return x * 13; }
+inline int f7870_14(int x) { return x * 14; }
+inline int f7870_15(int x) { return x * 15; }
+inline int f7870_16(int x) { return x * 16; }
+inline int f7870_17(int x) { return x * 17; }
+inline int f7870_18(int x) { return x * 18; }
+inline int f7870_19(int x) { return x * 19; }
+inline int f7870_20(int x) { return x * 20; }
+inline int f7870_21(int x) { return x * 21; }
+inline int f7870_22(int x) { return x * 22; }
+inline int f7870_23(int x) { return x * 23; }
+inline int f7870_24(int x) { return x * 24; }
+inline int f7870_25(int x) { return x * 25; }
+inline int f7870_26(int x) { return x * 26; }
+inline int f7870_27(int x) { return x * 27; }
+inline int f7870_28(int x) { return x * 28; }
+inline int f7870_29(int x) { return x * 29; }
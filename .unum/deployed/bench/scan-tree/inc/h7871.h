@@ -0,0 +1,42 @@
+#pragma once
+/* header 7871 */
+#include <vector>
+#include "h304.h"
+#include "h7040.h"
+#include "h2169.h"
+#include "h4874.h"
+#include "h692.h"
+#ifdef X
+#include "h3049.h"
+#endif
+struct S7871 { int a; const char *s = "x//y"; };
+inline int f7871_0(int x) { return x * 0; }
+inline int f7871_1(int x) { return x * 1; }
+inline int f7871_2(int x) { return x * 2; }
+inline int f7871_3(int x) { return x * 3; }
+inline int f7871_4(int x) { return x * 4; }
+inline int f7871_5(int x) { return x * 5; }
+inline int f7871_6(int x) { return x * 6; }
+inline int f7871_7(int x) { return x * 7; }
+inline int f7871_8(int x) { return x * 8; }
+inline int f7871_9(int x) { return x * 9; }
+inline int f7871_10(int x) { return x * 10; }
+inline int f7871_11(int x) { return x * 11; }
+inline int f7871_12(int x) { return x * 12; }
+inline int f7871_13(int x) { return x * 13; }
+inline int f7871_14(int x) { return x * 14; }
+inline int f7871_15(int x) { return x * 15; }
+inline int f7871_16(int x) { return x * 16; }
+inline int f7871_17(int x) { return x * 17; }
+inline int f7871_18(int x) { return x * 18; }
+inline int f7871_19(int x) { return x * 19; }
+inline int f7871_20(int x) { return x * 20; }
+inline int f7871_21(int x) { return x * 21; }
+inline int f7871_22(int x) { return x * 22; }
+inline int f7871_23(int x) { return x * 23; }
+inline int f7871_24(int x) { return x * 24; }
+inline int f7871_25(int x) { return x * 25; }
+inline int f7871_26(int x) { return x * 26; }
+inline int f7871_27(int x) { return x * 27; }
+inline int f7871_28(int x) { return x * 28; }
+inline int f7871_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7872 */
+#include <vector>
+#include "h6370.h"
+#include "h8662.h"
+#include "h7718.h"
+#include "h8627.h"
+#include "h9144.h"
+#ifdef X
+#include "h1439.h"
+#endif
+struct S7872 { int a; const char *s = "x//y"; };
+inline int f7872_0(int x) { return x * 0; }
+inline int f7872_1(int x) { return x * 1; }
+inline int f7872_2(int x) { return x * 2; }
+inline int f7872_3(int x) { return x * 3; }
+inline int f7872_4(int x) { return x * 4; }
+inline int f7872_5(int x) { return x * 5; }
+inline int f7872_6(int x) { return x * 6; }
+inline int f7872_7(int x) { return x * 7; }
+inline int f7872_8(int x) { return x * 8; }
+inline int f7872_9(int x) { return x * 9; }
+inline int f7872_10(int x) { return x * 10; }
+inline int f7872_11(int x) { return x * 11; }
+inline int f7872_12(int x) { return x * 12; }
+inline int f7872_13(int x) { return x * 13; }
+inline int f7872_14(int x) { return x * 14; }
+inline int f7872_15(int x) { return x * 15; }
+inline int f7872_16(int x) { return x * 16; }
+inline int f7872_17(int x) { return x * 17; }
+inline int f7872_18(int x) { return x * 18; }
+inline int f7872_19(int x) { return x * 19; }
+inline int f7872_20(int x) { return x * 20; }
+inline int f7872_21(int x) { return x * 21; }
+inline int f7872_22(int x) { return x * 22; }
+inline int f7872_23(int x) { return x * 23; }
+inline int f7872_24(int x) { return x * 24; }
+inline int f7872_25(int x) { return x * 25; }
+inline int f7872_26(int x) { return x * 26; }
+inline int f7872_27(int x) { return x * 27; }
+inline int f7872_28(int x) { return x * 28; }
+inline int f7872_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7873 */
+#include <vector>
+#include "h8783.h"
+#include "h4096.h"
+#include "h5353.h"
+#include "h588.h"
+#include "h5496.h"
+#ifdef X
+#include "h3078.h"
+#endif
+struct S7873 { int a; const char *s = "x//y"; };
+inline int f7873_0(int x) { return x * 0; }
+inline int f7873_1(int x) { return x * 1; }
+inline int f7873_2(int x) { return x * 2; }
+inline int f7873_3(int x) { return x * 3; }
+inline int f7873_4(int x) { return x * 4; }
+inline int f7873_5(int x) { return x * 5; }
+inline int f7873_6(int x) { return x * 6; }
+inline int f7873_7(int x) { return x * 7; }
+inline int f7873_8(int x) { return x * 8; }
+inline int f7873_9(int x) { return x * 9; }
+inline int f7873_10(int x) { return x * 10; }
+inline int f7873_11(int x) { return x * 11; }
+inline int f7873_12(int x) { return x * 12; }
+inline int f7873_13(int x) { return x * 13; }
+inline int f7873_14(int x) { return x * 14; }
+inline int f7873_15(int x) { return x * 15; }
+inline int f7873_16(int x) { return x * 16; }
+inline int f7873_17(int x) { return x * 17; }
+inline int f7873_18(int x) { return x * 18; }
+inline int f7873_19(int x) { return x * 19; }
+inline int f7873_20(int x) { return x * 20; }
+inline int f7873_21(int x) { return x * 21; }
+inline int f7873_22(int x) { return x * 22; }
+inline int f7873_23(int x) { return x * 23; }
+inline int f7873_24(int x) { return x * 24; }
+inline int f7873_25(int x) { return x * 25; }
+inline int f7873_26(int x) { return x * 26; }
+inline int f7873_27(int x) { return x * 27; }
+inline int f7873_28(int x) { return x * 28; }
+inline int f7873_29(int x) { return x * 29; }
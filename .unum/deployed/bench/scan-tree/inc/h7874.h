@@ -0,0 +1,42 @@
+#pragma once
+/* header 7874 */
+#include <vector>
+#include "h755.h"
+#include "h204.h"
+#include "h6800.h"
+#include "h1063.h"
+#include "h3343.h"
+#ifdef X
+#include "h8288.h"
+#endif
+struct S7874 { int a; const char *s = "x//y"; };
+inline int f7874_0(int x) { return x * 0; }
+inline int f7874_1(int x) { return x * 1; }
+inline int f7874_2(int x) { return x * 2; }
+inline int f7874_3(int x) { return x * 3; }
+inline int f7874_4(int x) { return x * 4; }
+inline int f7874_5(int x) { return x * 5; }
+inline int f7874_6(int x) { return x * 6; }
+inline int f7874_7(int x) { return x * 7; }
+inline int f7874_8(int x) { return x * 8; }
+inline int f7874_9(int x) { return x * 9; }
+inline int f7874_10(int x) { return x * 10; }
+inline int f7874_11(int x) { return x * 11; }
+inline int f7874_12(int x) { return x * 12; }
+inline int f7874_13(int x) { return x * 13; }
+inline int f7874_14(int x) { return x * 14; }
+inline int f7874_15(int x) { return x * 15; }
+inline int f7874_16(int x) { return x * 16; }
+inline int f7874_17(int x) { return x * 17; }
+inline int f7874_18(int x) { return x * 18; }
+inline int f7874_19(int x) { return x * 19; }
+inline int f7874_20(int x) { return x * 20; }
+inline int f7874_21(int x) { return x * 21; }
+inline int f7874_22(int x) { return x * 22; }
+inline int f7874_23(int x) { return x * 23; }
+inline int f7874_24(int x) { return x * 24; }
+inline int f7874_25(int x) { return x * 25; }
+inline int f7874_26(int x) { return x * 26; }
+inline int f7874_27(int x) { return x * 27; }
+inline int f7874_28(int x) { return x * 28; }
+inline int f7874_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7875 */
+#include <vector>
+#include "h9864.h"
+#include "h6751.h"
+#include "h9806.h"
+#include "h2118.h"
+#include "h9767.h"
+#ifdef X
+#include "h5557.h"
+#endif
+struct S7875 { int a; const char *s = "x//y"; };
+inline int f7875_0(int x) { return x * 0; }
+inline int f7875_1(int x) { return x * 1; }
+inline int f7875_2(int x) { return x * 2; }
+inline int f7875_3(int x) { return x * 3; }
+inline int f7875_4(int x) { return x * 4; }
+inline int f7875_5(int x) { return x * 5; }
+inline int f7875_6(int x) { return x * 6; }
+inline int f7875_7(int x) { return x * 7; }
+inline int f7875_8(int x) { return x * 8; }
+inline int f7875_9(int x) { return x * 9; }
+inline int f7875_10(int x) { return x * 10; }
+inline int f7875_11(int x) { return x * 11; }
+inline int f7875_12(int x) { return x * 12; }
+inline int f7875_13(int x) { return x * 13; }
+inline int f7875_14(int x) { return x * 14; }
+inline int f7875_15(int x) { return x * 15; }
+inline int f7875_16(int x) { return x * 16; }
+inline int f7875_17(int x) { return x * 17; }
+inline int f7875_18(int x) { return x * 18; }
+inline int f7875_19(int x) { return x * 19; }
+inline int f7875_20(int x) { return x * 20; }
+inline int f7875_21(int x) { return x * 21; }
+inline int f7875_22(int x) { return x * 22; }
+inline int f7875_23(int x) { return x * 23; }
+inline int f7875_24(int x) { return x * 24; }
+inline int f7875_25(int x) { return x * 25; }
+inline int f7875_26(int x) { return x * 26; }
+inline int f7875_27(int x) { return x * 27; }
+inline int f7875_28(int x) { return x * 28; }
+inline int f7875_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7878 */
+#include <vector>
+#include "h3076.h"
+#include "h2232.h"
+#include "h8715.h"
+#include "h8091.h"
+#include "h2492.h"
+#ifdef X
+#include "h3543.h"
+#endif
+struct S7878 { int a; const char *s = "x//y"; };
+inline int f7878_0(int x) { return x * 0; }
+inline int f7878_1(int x) { return x * 1; }
+inline int f7878_2(int x) { return x * 2; }
+inline int f7878_3(int x) { return x * 3; }
+inline int f7878_4(int x) { return x * 4; }
+inline int f7878_5(int x) { return x * 5; }
+inline int f7878_6(int x) { return x * 6; }
+inline int f7878_7(int x) { return x * 7; }
+inline int f7878_8(int x) { return x * 8; }
+inline int f7878_9(int x) { return x * 9; }
+inline int f7878_10(int x) { return x * 10; }
+inline int f7878_11(int x) { return x * 11; }
+inline int f7878_12(int x) { return x * 12; }
+inline int f7878_13(int x) { return x * 13; }
+inline int f7878_14(int x) { return x * 14; }
+inline int f7878_15(int x) { return x * 15; }
+inline int f7878_16(int x) { return x * 16; }
+inline int f7878_17(int x) { return x * 17; }
+inline int f7878_18(int x) { return x * 18; }
+inline int f7878_19(int x) { return x * 19; }
+inline int f7878_20(int x) { return x * 20; }
+inline int f7878_21(int x) { return x * 21; }
+inline int f7878_22(int x) { return x * 22; }
+inline int f7878_23(int x) { return x * 23; }
+inline int f7878_24(int x) { return x * 24; }
+inline int f7878_25(int x) { return x * 25; }
+inline int f7878_26(int x) { return x * 26; }
+inline int f7878_27(int x) { return x * 27; }
+inline int f7878_28(int x) { return x * 28; }
+inline int f7878_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7880 */
+#include <vector>
+#include "h8762.h"
+#include "h6944.h"
+#include "h5717.h"
+#include "h9505.h"
+#include "h3640.h"
+#ifdef X
+#include "h2264.h"
+#endif
+struct S7880 { int a; const char *s = "x//y"; };
+inline int f7880_0(int x) { return x * 0; }
+inline int f7880_1(int x) { return x * 1; }
+inline int f7880_2(int x) { return x * 2; }
+inline int f7880_3(int x) { return x * 3; }
+inline int f7880_4(int x) { return x * 4; }
+inline int f7880_5(int x) { return x * 5; }
+inline int f7880_6(int x) { return x * 6; }
+inline int f7880_7(int x) { return x * 7; }
+inline int f7880_8(int x) { return x * 8; }
+inline int f7880_9(int x) { return x * 9; }
+inline int f7880_10(int x) { return x * 10; }
+inline int f7880_11(int x) { return x * 11; }
+inline int f7880_12(int x) { return x * 12; }
+inline int f7880_13(int x) { return x * 13; }
+inline int f7880_14(int x) { return x * 14; }
+inline int f7880_15(int x) { return x * 15; }
+inline int f7880_16(int x) { return x * 16; }
+inline int f7880_17(int x) { return x * 17; }
+inline int f7880_18(int x) { return x * 18; }
+inline int f7880_19(int x) { return x * 19; }
+inline int f7880_20(int x) { return x * 20; }
+inline int f7880_21(int x) { return x * 21; }
+inline int f7880_22(int x) { return x * 22; }
+inline int f7880_23(int x) { return x * 23; }
+inline int f7880_24(int x) { return x * 24; }
+inline int f7880_25(int x) { return x * 25; }
+inline int f7880_26(int x) { return x * 26; }
+inline int f7880_27(int x) { return x * 27; }
+inline int f7880_28(int x) { return x * 28; }
+inline int f7880_29(int x) { return x * 29; }
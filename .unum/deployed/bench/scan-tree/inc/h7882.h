@@ -0,0 +1,42 @@
+#pragma once
+/* header 7882 */
+#include <vector>
+#include "h6707.h"
+#include "h7537.h"
+#include "h1557.h"
+#include "h5718.h"
+#include "h1952.h"
+#ifdef X
+#include "h3333.h"
+#endif
+struct S7882 { int a; const char *s = "x//y"; };
+inline int f7882_0(int x) { return x * 0; }
+inline int f7882_1(int x) { return x * 1; }
+inline int f7882_2(int x) { return x * 2; }
+inline int f7882_3(int x) { return x * 3; }
+inline int f7882_4(int x) { return x * 4; }
+inline int f7882_5(int x) { return x * 5; }
+inline int f7882_6(int x) { return x * 6; }
+inline int f7882_7(int x) { return x * 7; }
+inline int f7882_8(int x) { return x * 8; }
+inline int f7882_9(int x) { return x * 9; }
+inline int f7882_10(int x) { return x * 10; }
+inline int f7882_11(int x) { return x * 11; }
+inline int f7882_12(int x) { return x * 12; }
+inline int f7882_13(int x) { return x * 13; }
+inline int f7882_14(int x) { return x * 14; }
+inline int f7882_15(int x) { return x * 15; }
+inline int f7882_16(int x) { return x * 16; }
+inline int f7882_17(int x) { return x * 17; }
+inline int f7882_18(int x) { return x * 18; }
+inline int f7882_19(int x) { return x * 19; }
+inline int f7882_20(int x) { return x * 20; }
+inline int f7882_21(int x) { return x * 21; }
+inline int f7882_22(int x) { return x * 22; }
+inline int f7882_23(int x) { return x * 23; }
+inline int f7882_24(int x) { return x * 24; }
+inline int f7882_25(int x) { return x * 25; }
+inline int f7882_26(int x) { return x * 26; }
+inline int f7882_27(int x) { return x * 27; }
+inline int f7882_28(int x) { return x * 28; }
+inline int f7882_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7883 */
+#include <vector>
+#include "h8718.h"
+#include "h2756.h"
+#include "h8086.h"
+#include "h9254.h"
+#include "h4228.h"
+#ifdef X
+#include "h3365.h"
+#endif
+struct S7883 { int a; const char *s = "x//y"; };
+inline int f7883_0(int x) { return x * 0; }
+inline int f7883_1(int x) { return x * 1; }
+inline int f7883_2(int x) { return x * 2; }
+inline int f7883_3(int x) { return x * 3; }
+inline int f7883_4(int x) { return x * 4; }
+inline int f7883_5(int x) { return x * 5; }
+inline int f7883_6(int x) { return x * 6; }
+inline int f7883_7(int x) { return x * 7; }
+inline int f7883_8(int x) { return x * 8; }
+inline int f7883_9(int x) { return x * 9; }
+inline int f7883_10(int x) { return x * 10; }
+inline int f7883_11(int x) { return x * 11; }
+inline int f7883_12(int x) { return x * 12; }
+inline int f7883_13(int x) { return x * 13; }
+inline int f7883_14(int x) { return x * 14; }
+inline int f7883_15(int x) { return x * 15; }
+inline int f7883_16(int x) { return x * 16; }
+inline int f7883_17(int x) { return x * 17; }
+inline int f7883_18(int x) { return x * 18; }
+inline int f7883_19(int x) { return x * 19; }
+inline int f7883_20(int x) { return x * 20; }
+inline int f7883_21(int x) { return x * 21; }
+inline int f7883_22(int x) { return x * 22; }
+inline int f7883_23(int x) { return x * 23; }
+inline int f7883_24(int x) { return x * 24; }
+inline int f7883_25(int x) { return x * 25; }
+inline int f7883_26(int x) { return x * 26; }
+inline int f7883_27(int x) { return x * 27; }
+inline int f7883_28(int x) { return x * 28; }
+inline int f7883_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7886 */
+#include <vector>
+#include "h5578.h"
+#include "h650.h"
+#include "h6638.h"
+#include "h6290.h"
+#include "h2575.h"
+#ifdef X
+#include "h6600.h"
+#endif
+struct S7886 { int a; const char *s = "x//y"; };
+inline int f7886_0(int x) { return x * 0; }
+inline int f7886_1(int x) { return x * 1; }
+inline int f7886_2(int x) { return x * 2; }
+inline int f7886_3(int x) { return x * 3; }
+inline int f7886_4(int x) { return x * 4; }
+inline int f7886_5(int x) { return x * 5; }
+inline int f7886_6(int x) { return x * 6; }
+inline int f7886_7(int x) { return x * 7; }
+inline int f7886_8(int x) { return x * 8; }
+inline int f7886_9(int x) { return x * 9; }
+inline int f7886_10(int x) { return x * 10; }
+inline int f7886_11(int x) { return x * 11; }
+inline int f7886_12(int x) { return x * 12; }
+inline int f7886_13(int x) { return x * 13; }
+inline int f7886_14(int x) { return x * 14; }
+inline int f7886_15(int x) { return x * 15; }
+inline int f7886_16(int x) { return x * 16; }
+inline int f7886_17(int x) { return x * 17; }
+inline int f7886_18(int x) { return x * 18; }
+inline int f7886_19(int x) { return x * 19; }
+inline int f7886_20(int x) { return x * 20; }
+inline int f7886_21(int x) { return x * 21; }
+inline int f7886_22(int x) { return x * 22; }
+inline int f7886_23(int x) { return x * 23; }
+inline int f7886_24(int x) { return x * 24; }
+inline int f7886_25(int x) { return x * 25; }
+inline int f7886_26(int x) { return x * 26; }
+inline int f7886_27(int x) { return x * 27; }
+inline int f7886_28(int x) { return x * 28; }
+inline int f7886_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7888 */
+#include <vector>
+#include "h6213.h"
+#include "h7732.h"
+#include "h4040.h"
+#include "h6075.h"
+#include "h7474.h"
+#ifdef X
+#include "h5172.h"
+#endif
+struct S7888 { int a; const char *s = "x//y"; };
+inline int f7888_0(int x) { return x * 0; }
+inline int f7888_1(int x) { return x * 1; }
+inline int f7888_2(int x) { return x * 2; }
+inline int f7888_3(int x) { return x * 3; }
+inline int f7888_4(int x) { return x * 4; }
+inline int f7888_5(int x) { return x * 5; }
+inline int f7888_6(int x) { return x * 6; }
+inline int f7888_7(int x) { return x * 7; }
+inline int f7888_8(int x) { return x * 8; }
+inline int f7888_9(int x) { return x * 9; }
+inline int f7888_10(int x) { return x * 10; }
+inline int f7888_11(int x) { return x * 11; }
+inline int f7888_12(int x) { return x * 12; }
+inline int f7888_13(int x) { return x * 13; }
+inline int f7888_14(int x) { return x * 14; }
+inline int f7888_15(int x) { return x * 15; }
+inline int f7888_16(int x) { return x * 16; }
+inline int f7888_17(int x) { return x * 17; }
+inline int f7888_18(int x) { return x * 18; }
+inline int f7888_19(int x) { return x * 19; }
+inline int f7888_20(int x) { return x * 20; }
+inline int f7888_21(int x) { return x * 21; }
+inline int f7888_22(int x) { return x * 22; }
+inline int f7888_23(int x) { return x * 23; }
+inline int f7888_24(int x) { return x * 24; }
+inline int f7888_25(int x) { return x * 25; }
+inline int f7888_26(int x) { return x * 26; }
+inline int f7888_27(int x) { return x * 27; }
+inline int f7888_28(int x) { return x * 28; }
+inline int f7888_29(int x) { return x * 29; }
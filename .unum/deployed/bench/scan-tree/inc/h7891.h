@@ -0,0 +1,42 @@
+#pragma once
+/* header 7891 */
+#include <vector>
+#include "h3508.h"
+#include "h1522.h"
+#include "h9650.h"
+#include "h6395.h"
+#include "h7315.h"
+#ifdef X
+#include "h2831.h"
+#endif
+struct S7891 { int a; const char *s = "x//y"; };
+inline int f7891_0(int x) { return x * 0; }
+inline int f7891_1(int x) { return x * 1; }
+inline int f7891_2(int x) { return x * 2; }
+inline int f7891_3(int x) { return x * 3; }
+inline int f7891_4(int x) { return x * 4; }
+inline int f7891_5(int x) { return x * 5; }
+inline int f7891_6(int x) { return x * 6; }
+inline int f7891_7(int x) { return x * 7; }
+inline int f7891_8(int x) { return x * 8; }
+inline int f7891_9(int x) { return x * 9; }
+inline int f7891_10(int x) { return x * 10; }
+inline int f7891_11(int x) { return x * 11; }
+inline int f7891_12(int x) { return x * 12; }
+inline int f7891_13(int x) { return x * 13; }
+inline int f7891_14(int x) { return x * 14; }
+inline int f7891_15(int x) { return x * 15; }
+inline int f7891_16(int x) { return x * 16; }
+inline int f7891_17(int x) { return x * 17; }
+inline int f7891_18(int x) { return x * 18; }
+inline int f7891_19(int x) { return x * 19; }
+inline int f7891_20(int x) { return x * 20; }
+inline int f7891_21(int x) { return x * 21; }
+inline int f7891_22(int x) { return x * 22; }
+inline int f7891_23(int x) { return x * 23; }
+inline int f7891_24(int x) { return x * 24; }
+inline int f7891_25(int x) { return x * 25; }
+inline int f7891_26(int x) { return x * 26; }
+inline int f7891_27(int x) { return x * 27; }
+inline int f7891_28(int x) { return x * 28; }
+inline int f7891_29(int x) { return x * 29; }
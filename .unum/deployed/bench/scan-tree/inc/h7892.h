@@ -0,0 +1,42 @@
+#pragma once
+/* header 7892 */
+#include <vector>
+#include "h9479.h"
+#include "h787.h"
+#include "h4712.h"
+#include "h1655.h"
+#include "h1021.h"
+#ifdef X
+#include "h5066.h"
+#endif
+struct S7892 { int a; const char *s = "x//y"; };
+inline int f7892_0(int x) { return x * 0; }
+inline int f7892_1(int x) { return x * 1; }
+inline int f7892_2(int x) { return x * 2; }
+inline int f7892_3(int x) { return x * 3; }
+inline int f7892_4(int x) { return x * 4; }
+inline int f7892_5(int x) { return x * 5; }
+inline int f7892_6(int x) { return x * 6; }
+inline int f7892_7(int x) { return x * 7; }
+inline int f7892_8(int x) { return x * 8; }
+inline int f7892_9(int x) { return x * 9; }
+inline int f7892_10(int x) { return x * 10; }
+inline int f7892_11(int x) { return x * 11; }
+inline int f7892_12(int x) { return x * 12; }
+inline int f7892_13(int x) { return x * 13; }
+inline int f7892_14(int x) { return x * 14; }
+inline int f7892_15(int x) { return x * 15; }
+inline int f7892_16(int x) { return x * 16; }
+inline int f7892_17(int x) { return x * 17; }
+inline int f7892_18(int x) { return x * 18; }
+inline int f7892_19(int x) { return x * 19; }
+inline int f7892_20(int x) { return x * 20; }
+inline int f7892_21(int x) { return x * 21; }
+inline int f7892_22(int x) { return x * 22; }
+inline int f7892_23(int x) { return x * 23; }
+inline int f7892_24(int x) { return x * 24; }
+inline int f7892_25(int x) { return x * 25; }
+inline int f7892_26(int x) { return x * 26; }
+inline int f7892_27(int x) { return x * 27; }
+inline int f7892_28(int x) { return x * 28; }
+inline int f7892_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7893 */
+#include <vector>
+#include "h3938.h"
+#include "h5438.h"
+#include "h8344.h"
+#include "h5214.h"
+#include "h546.h"
+#ifdef X
+#include "h985.h"
+#endif
+struct S7893 { int a; const char *s = "x//y"; };
+inline int f7893_0(int x) { return x * 0; }
+inline int f7893_1(int x) { return x * 1; }
+inline int f7893_2(int x) { return x * 2; }
+inline int f7893_3(int x) { return x * 3; }
+inline int f7893_4(int x) { return x * 4; }
+inline int f7893_5(int x) { return x * 5; }
+inline int f7893_6(int x) { return x * 6; }
+inline int f7893_7(int x) { return x * 7; }
+inline int f7893_8(int x) { return x * 8; }
+inline int f7893_9(int x) { return x * 9; }
+inline int f7893_10(int x) { return x * 10; }
+inline int f7893_11(int x) { return x * 11; }
+inline int f7893_12(int x) { return x * 12; }
+inline int f7893_13(int x) { return x * 13; }
+inline int f7893_14(int x) { return x * 14; }
+inline int f7893_15(int x) { return x * 15; }
+inline int f7893_16(int x) { return x * 16; }
+inline int f7893_17(int x) { return x * 17; }
+inline int f7893_18(int x) { return x * 18; }
+inline int f7893_19(int x) { return x * 19; }
+inline int f7893_20(int x) { return x * 20; }
+inline int f7893_21(int x) { return x * 21; }
+inline int f7893_22(int x) { return x * 22; }
+inline int f7893_23(int x) { return x * 23; }
+inline int f7893_24(int x) { return x * 24; }
+inline int f7893_25(int x) { return x * 25; }
+inline int f7893_26(int x) { return x * 26; }
+inline int f7893_27(int x) { return x * 27; }
+inline int f7893_28(int x) { return x * 28; }
+inline int f7893_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7895 */
+#include <vector>
+#include "h1609.h"
+#include "h6750.h"
+#include "h9752.h"
+#include "h1733.h"
+#include "h2129.h"
+#ifdef X
+#include "h3813.h"
+#endif
+struct S7895 { int a; const char *s = "x//y"; };
+inline int f7895_0(int x) { return x * 0; }
+inline int f7895_1(int x) { return x * 1; }
+inline int f7895_2(int x) { return x * 2; }
+inline int f7895_3(int x) { return x * 3; }
+inline int f7895_4(int x) { return x * 4; }
+inline int f7895_5(int x) { return x * 5; }
+inline int f7895_6(int x) { return x * 6; }
+inline int f7895_7(int x) { return x * 7; }
+inline int f7895_8(int x) { return x * 8; }
+inline int f7895_9(int x) { return x * 9; }
+inline int f7895_10(int x) { return x * 10; }
+inline int f7895_11(int x) { return x * 11; }
+inline int f7895_12(int x) { return x * 12; }
+inline int f7895_13(int x) { return x * 13; }
+inline int f7895_14(int x) { return x * 14; }
+inline int f7895_15(int x) { return x * 15; }
+inline int f7895_16(int x) { return x * 16; }
+inline int f7895_17(int x) { return x * 17; }
+inline int f7895_18(int x) { return x * 18; }
+inline int f7895_19(int x) { return x * 19; }
+inline int f7895_20(int x) { return x * 20; }
+inline int f7895_21(int x) { return x * 21; }
+inline int f7895_22(int x) { return x * 22; }
+inline int f7895_23(int x) { return x * 23; }
+inline int f7895_24(int x) { return x * 24; }
+inline int f7895_25(int x) { return x * 25; }
+inline int f7895_26(int x) { return x * 26; }
+inline int f7895_27(int x) { return x * 27; }
+inline int f7895_28(int x) { return x * 28; }
+inline int f7895_29(int x) { return x * 29; }
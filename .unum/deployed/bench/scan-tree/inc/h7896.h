@@ -0,0 +1,42 @@
+#pragma once
+/* header 7896 */
+#include <vector>
+#include "h581.h"
+#include "h3047.h"
+#include "h712.h"
+#include "h5687.h"
+#include "h5483.h"
+#ifdef X
+#include "h8332.h"
+#endif
+struct S7896 { int a; const char *s = "x//y"; };
+inline int f7896_0(int x) { return x * 0; }
+inline int f7896_1(int x) { return x * 1; }
+inline int f7896_2(int x) { return x * 2; }
+inline int f7896_3(int x) { return x * 3; }
+inline int f7896_4(int x) { return x * 4; }
+inline int f7896_5(int x) { return x * 5; }
+inline int f7896_6(int x) { return x * 6; }
+inline int f7896_7(int x) { return x * 7; }
+inline int f7896_8(int x) { return x * 8; }
+inline int f7896_9(int x) { return x * 9; }
+inline int f7896_10(int x) { return x * 10; }
+inline int f7896_11(int x) { return x * 11; }
+inline int f7896_12(int x) { return x * 12; }
+inline int f7896_13(int x) { return x * 13; }
+inline int f7896_14(int x) { return x * 14; }
+inline int f7896_15(int x) { return x * 15; }
+inline int f7896_16(int x) { return x * 16; }
+inline int f7896_17(int x) { return x * 17; }
+inline int f7896_18(int x) { return x * 18; }
+inline int f7896_19(int x) { return x * 19; }
+inline int f7896_20(int x) { return x * 20; }
+inline int f7896_21(int x) { return x * 21; }
+inline int f7896_22(int x) { return x * 22; }
+inline int f7896_23(int x) { return x * 23; }
+inline int f7896_24(int x) { return x * 24; }
+inline int f7896_25(int x) { return x * 25; }
+inline int f7896_26(int x) { return x * 26; }
+inline int f7896_27(int x) { return x * 27; }
+inline int f7896_28(int x) { return x * 28; }
+inline int f7896_29(int x) { return x * 29; }
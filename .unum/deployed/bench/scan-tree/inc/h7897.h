@@ -0,0 +1,42 @@
+#pragma once
+/* header 7897 */
+#include <vector>
+#include "h7438.h"
+#include "h7914.h"
+#include "h2416.h"
+#include "h1280.h"
+#include "h7770.h"
+#ifdef X
+#include "h4012.h"
+#endif
+struct S7897 { int a; const char *s = "x//y"; };
+inline int f7897_0(int x) { return x * 0; }
+inline int f7897_1(int x) { return x * 1; }
+inline int f7897_2(int x) { return x * 2; }
+inline int f7897_3(int x) { return x * 3; }
+inline int f7897_4(int x) { return x * 4; }
+inline int f7897_5(int x) { return x * 5; }
+inline int f7897_6(int x) { return x * 6; }
+inline int f7897_7(int x) { return x * 7; }
+inline int f7897_8(int x) { return x * 8; }
+inline int f7897_9(int x) { return x * 9; }
+inline int f7897_10(int x) { return x * 10; }
+inline int f7897_11(int x) { return x * 11; }
+inline int f7897_12(int x) { return x * 12; }
+inline int f7897_13(int x) { return x * 13; }
+inline int f7897_14(int x) { return x * 14; }
+inline int f7897_15(int x) { return x * 15; }
+inline int f7897_16(int x) { return x * 16; }
+inline int f7897_17(int x) { return x * 17; }
+inline int f7897_18(int x) { return x * 18; }
+inline int f7897_19(int x) { return x * 19; }
+inline int f7897_20(int x) { return x * 20; }
+inline int f7897_21(int x) { return x * 21; }
+inline int f7897_22(int x) { return x * 22; }
+inline int f7897_23(int x) { return x * 23; }
+inline int f7897_24(int x) { return x * 24; }
+inline int f7897_25(int x) { return x * 25; }
+inline int f7897_26(int x) { return x * 26; }
+inline int f7897_27(int x) { return x * 27; }
+inline int f7897_28(int x) { return x * 28; }
+inline int f7897_29(int x) { return x * 29; }
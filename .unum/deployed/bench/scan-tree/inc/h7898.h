@@ -0,0 +1,42 @@
+#pragma once
+/* header 7898 */
+#include <vector>
+#include "h3976.h"
+#include "h4303.h"
+#include "h7606.h"
+#include "h2949.h"
+#include "h2520.h"
+#ifdef X
+#include "h4139.h"
+#endif
+struct S7898 { int a; const char *s = "x//y"; };
+inline int f7898_0(int x) { return x * 0; }
+inline int f7898_1(int x) { return x * 1; }
+inline int f7898_2(int x) { return x * 2; }
+inline int f7898_3(int x) { return x * 3; }
+inline int f7898_4(int x) { return x * 4; }
+inline int f7898_5(int x) { return x * 5; }
+inline int f7898_6(int x) { return x * 6; }
+inline int f7898_7(int x) { return x * 7; }
+inline int f7898_8(int x) { return x * 8; }
+inline int f7898_9(int x) { return x * 9; }
+inline int f7898_10(int x) { return x * 10; }
+inline int f7898_11(int x) { return x * 11; }
+inline int f7898_12(int x) { return x * 12; }
+inline int f7898_13(int x) { return x * 13; }
+inline int f7898_14(int x) { return x * 14; }
+inline int f7898_15(int x) { return x * 15; }
+inline int f7898_16(int x) { return x * 16; }
+inline int f7898_17(int x) { return x * 17; }
+inline int f7898_18(int x) { return x * 18; }
+inline int f7898_19(int x) { return x * 19; }
+inline int f7898_20(int x) { return x * 20; }
+inline int f7898_21(int x) { return x * 21; }
+inline int f7898_22(int x) { return x * 22; }
+inline int f7898_23(int x) { return x * 23; }
+inline int f7898_24(int x) { return x * 24; }
+inline int f7898_25(int x) { return x * 25; }
+inline int f7898_26(int x) { return x * 26; }
+inline int f7898_27(int x) { return x * 27; }
+inline int f7898_28(int x) { return x * 28; }
+inline int f7898_29(int x) { return x * 29; }
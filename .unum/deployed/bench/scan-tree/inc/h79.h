@@ -0,0 +1,42 @@
+#pragma once
+/* header 79 */
+#include <vector>
+#include "h4170.h"
+#include "h4303.h"
+#include "h8133.h"
+#include "h456.h"
+#include "h4662.h"
+#ifdef X
+#include "h3962.h"
+#endif
+struct S79 { int a; const char *s = "x//y"; };
+inline int f79_0(int x) { return x * 0; }
+inline int f79_1(int x) { return x * 1; }
+inline int f79_2(int x) { return x * 2; }
+inline int f79_3(int x) { return x * 3; }
+inline int f79_4(int x) { return x * 4; }
+inline int f79_5(int x) { return x * 5; }
+inline int f79_6(int x) { return x * 6; }
+inline int f79_7(int x) { return x * 7; }
+inline int f79_8(int x) { return x * 8; }
+inline int f79_9(int x) { return x * 9; }
+inline int f79_10(int x) { return x * 10; }
+inline int f79_11(int x) { return x * 11; }
+inline int f79_12(int x) { return x * 12; }
+inline int f79_13(int x) { return x * 13; }
+inline int f79_14(int x) { return x * 14; }
+inline int f79_15(int x) { return x * 15; }
+inline int f79_16(int x) { return x * 16; }
+inline int f79_17(int x) { return x * 17; }
+inline int f79_18(int x) { return x * 18; }
+inline int f79_19(int x) { return x * 19; }
+inline int f79_20(int x) { return x * 20; }
+inline int f79_21(int x) { return x * 21; }
+inline int f79_22(int x) { return x * 22; }
+inline int f79_23(int x) { return x * 23; }
+inline int f79_24(int x) { return x * 24; }
+inline int f79_25(int x) { return x * 25; }
+inline int f79_26(int x) { return x * 26; }
+inline int f79_27(int x) { return x * 27; }
+inline int f79_28(int x) { return x * 28; }
+inline int f79_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7901 */
+#include <vector>
+#include "h2301.h"
+#include "h6132.h"
+#include "h5650.h"
+#include "h9287.h"
+#include "h2745.h"
+#ifdef X
+#include "h8393.h"
+#endif
+struct S7901 { int a; const char *s = "x//y"; };
+inline int f7901_0(int x) { return x * 0; }
+inline int f7901_1(int x) { return x * 1; }
+inline int f7901_2(int x) { return x * 2; }
+inline int f7901_3(int x) { return x * 3; }
+inline int f7901_4(int x) { return x * 4; }
+inline int f7901_5(int x) { return x * 5; }
+inline int f7901_6(int x) { return x * 6; }
+inline int f7901_7(int x) { return x * 7; }
+inline int f7901_8(int x) { return x * 8; }
+inline int f7901_9(int x) { return x * 9; }
+inline int f7901_10(int x) { return x * 10; }
+inline int f7901_11(int x) { return x * 11; }
+inline int f7901_12(int x) { return x * 12; }
+inline int f7901_13(int x) { return x * 13; }
+inline int f7901_14(int x) { return x * 14; }
+inline int f7901_15(int x) { return x * 15; }
+inline int f7901_16(int x) { return x * 16; }
+inline int f7901_17(int x) { return x * 17; }
+inline int f7901_18(int x) { return x * 18; }
+inline int f7901_19(int x) { return x * 19; }
+inline int f7901_20(int x) { return x * 20; }
+inline int f7901_21(int x) { return x * 21; }
+inline int f7901_22(int x) { return x * 22; }
+inline int f7901_23(int x) { return x * 23; }
+inline int f7901_24(int x) { return x * 24; }
+inline int f7901_25(int x) { return x * 25; }
+inline int f7901_26(int x) { return x * 26; }
+inline int f7901_27(int x) { return x * 27; }
+inline int f7901_28(int x) { return x * 28; }
+inline int f7901_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7902 */
+#include <vector>
+#include "h2345.h"
+#include "h7612.h"
+#include "h6120.h"
+#include "h1943.h"
+#include "h63.h"
+#ifdef X
+#include "h2237.h"
+#endif
+struct S7902 { int a; const char *s = "x//y"; };
+inline int f7902_0(int x) { return x * 0; }
+inline int f7902_1(int x) { return x * 1; }
+inline int f7902_2(int x) { return x * 2; }
+inline int f7902_3(int x) { return x * 3; }
+inline int f7902_4(int x) { return x * 4; }
+inline int f7902_5(int x) { return x * 5; }
+inline int f7902_6(int x) { return x * 6; }
+inline int f7902_7(int x) { return x * 7; }
+inline int f7902_8(int x) { return x * 8; }
+inline int f7902_9(int x) { return x * 9; }
+inline int f7902_10(int x) { return x * 10; }
+inline int f7902_11(int x) { return x * 11; }
+inline int f7902_12(int x) { return x * 12; }
+inline int f7902_13(int x) { return x * 13; }
+inline int f7902_14(int x) { return x * 14; }
+inline int f7902_15(int x) { return x * 15; }
+inline int f7902_16(int x) { return x * 16; }
+inline int f7902_17(int x) { return x * 17; }
+inline int f7902_18(int x) { return x * 18; }
+inline int f7902_19(int x) { return x * 19; }
+inline int f7902_20(int x) { return x * 20; }
+inline int f7902_21(int x) { return x * 21; }
+inline int f7902_22(int x) { return x * 22; }
+inline int f7902_23(int x) { return x * 23; }
+inline int f7902_24(int x) { return x * 24; }
+inline int f7902_25(int x) { return x * 25; }
+inline int f7902_26(int x) { return x * 26; }
+inline int f7902_27(int x) { return x * 27; }
+inline int f7902_28(int x) { return x * 28; }
+inline int f7902_29(int x) { return x * 29; }
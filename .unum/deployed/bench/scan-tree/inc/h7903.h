@@ -0,0 +1,42 @@
+#pragma once
+/* header 7903 */
+#include <vector>
+#include "h5912.h"
+#include "h7806.h"
+#include "h1236.h"
+#include "h523.h"
+#include "h6733.h"
+#ifdef X
+#include "h6582.h"
+#endif
+struct S7903 { int a; const char *s = "x//y"; };
+inline int f7903_0(int x) { return x * 0; }
+inline int f7903_1(int x) { return x * 1; }
+inline int f7903_2(int x) { return x * 2; }
+inline int f7903_3(int x) { return x * 3; }
+inline int f7903_4(int x) { return x * 4; }
+inline int f7903_5(int x) { return x * 5; }
+inline int f7903_6(int x) { return x * 6; }
+inline int f7903_7(int x) { return x * 7; }
+inline int f7903_8(int x) { return x * 8; }
+inline int f7903_9(int x) { return x * 9; }
+inline int f7903_10(int x) { return x * 10; }
+inline int f7903_11(int x) { return x * 11; }
+inline int f7903_12(int x) { return x * 12; }
+inline int f7903_13(int x) { return x * 13; }
+inline int f7903_14(int x) { return x * 14; }
+inline int f7903_15(int x) { return x * 15; }
+inline int f7903_16(int x) { return x * 16; }
+inline int f7903_17(int x) { return x * 17; }
+inline int f7903_18(int x) { return x * 18; }
+inline int f7903_19(int x) { return x * 19; }
+inline int f7903_20(int x) { return x * 20; }
+inline int f7903_21(int x) { return x * 21; }
+inline int f7903_22(int x) { return x * 22; }
+inline int f7903_23(int x) { return x * 23; }
+inline int f7903_24(int x) { return x * 24; }
+inline int f7903_25(int x) { return x * 25; }
+inline int f7903_26(int x) { return x * 26; }
+inline int f7903_27(int x) { return x * 27; }
+inline int f7903_28(int x) { return x * 28; }
+inline int f7903_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7907 */
+#include <vector>
+#include "h3077.h"
+#include "h2276.h"
+#include "h6776.h"
+#include "h7215.h"
+#include "h9225.h"
+#ifdef X
+#include "h5828.h"
+#endif
+struct S7907 { int a; const char *s = "x//y"; };
+inline int f7907_0(int x) { return x * 0; }
+inline int f7907_1(int x) { return x * 1; }
+inline int f7907_2(int x) { return x * 2; }
+inline int f7907_3(int x) { return x * 3; }
+inline int f7907_4(int x) { return x * 4; }
+inline int f7907_5(int x) { return x * 5; }
+inline int f7907_6(int x) { return x * 6; }
+inline int f7907_7(int x) { return x * 7; }
+inline int f7907_8(int x) { return x * 8; }
+inline int f7907_9(int x) { return x * 9; }
+inline int f7907_10(int x) { return x * 10; }
+inline int f7907_11(int x) { return x * 11; }
+inline int f7907_12(int x) { return x * 12; }
+inline int f7907_13(int x) { return x * 13; }
+inline int f7907_14(int x) { return x * 14; }
+inline int f7907_15(int x) { return x * 15; }
+inline int f7907_16(int x) { return x * 16; }
+inline int f7907_17(int x) { return x * 17; }
+inline int f7907_18(int x) { return x * 18; }
+inline int f7907_19(int x) { return x * 19; }
+inline int f7907_20(int x) { return x * 20; }
+inline int f7907_21(int x) { return x * 21; }
+inline int f7907_22(int x) { return x * 22; }
+inline int f7907_23(int x) { return x * 23; }
+inline int f7907_24(int x) { return x * 24; }
+inline int f7907_25(int x) { return x * 25; }
+inline int f7907_26(int x) { return x * 26; }
+inline int f7907_27(int x) { return x * 27; }
+inline int f7907_28(int x) { return x * 28; }
+inline int f7907_29(int x) { return x * 29; }
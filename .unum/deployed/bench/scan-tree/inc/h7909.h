@@ -0,0 +1,42 @@
+#pragma once
+/* header 7909 */
+#include <vector>
+#include "h6890.h"
+#include "h3564.h"
+#include "h2601.h"
+#include "h9386.h"
+#include "h3367.h"
+#ifdef X
+#include "h7336.h"
+#endif
+struct S7909 { int a; const char *s = "x//y"; };
+inline int f7909_0(int x) { return x * 0; }
+inline int f7909_1(int x) { return x * 1; }
+inline int f7909_2(int x) { return x * 2; }
+inline int f7909_3(int x) { return x * 3; }
+inline int f7909_4(int x) { return x * 4; }
+inline int f7909_5(int x) { return x * 5; }
+inline int f7909_6(int x) { return x * 6; }
+inline int f7909_7(int x) { return x * 7; }
+inline int f7909_8(int x) { return x * 8; }
+inline int f7909_9(int x) { return x * 9; }
+inline int f7909_10(int x) { return x * 10; }
+inline int f7909_11(int x) { return x * 11; }
+inline int f7909_12(int x) { return x * 12; }
+inline int f7909_13(int x) { return x * 13; }
+inline int f7909_14(int x) { return x * 14; }
+inline int f7909_15(int x) { return x * 15; }
+inline int f7909_16(int x) { return x * 16; }
+inline int f7909_17(int x) { return x * 17; }
+inline int f7909_18(int x) { return x * 18; }
+inline int f7909_19(int x) { return x * 19; }
+inline int f7909_20(int x) { return x * 20; }
+inline int f7909_21(int x) { return x * 21; }
+inline int f7909_22(int x) { return x * 22; }
+inline int f7909_23(int x) { return x * 23; }
+inline int f7909_24(int x) { return x * 24; }
+inline int f7909_25(int x) { return x * 25; }
+inline int f7909_26(int x) { return x * 26; }
+inline int f7909_27(int x) { return x * 27; }
+inline int f7909_28(int x) { return x * 28; }
+inline int f7909_29(int x) { return x * 29; }
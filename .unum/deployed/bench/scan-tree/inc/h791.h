@@ -0,0 +1,42 @@
+#pragma once
+/* header 791 */
+#include <vector>
+#include "h3694.h"
+#include "h8617.h"
+#include "h4829.h"
+#include "h8864.h"
+#include "h2947.h"
+#ifdef X
+#include "h2937.h"
+#endif
+struct S791 { int a; const char *s = "x//y"; };
+inline int f791_0(int x) { return x * 0; }
+inline int f791_1(int x) { return x * 1; }
+inline int f791_2(int x) { return x * 2; }
+inline int f791_3(int x) { return x * 3; }
+inline int f791_4(int x) { return x * 4; }
+inline int f791_5(int x) { return x * 5; }
+inline int f791_6(int x) { return x * 6; }
+inline int f791_7(int x) { return x * 7; }
+inline int f791_8(int x) { return x * 8; }
+inline int f791_9(int x) { return x * 9; }
+inline int f791_10(int x) { return x * 10; }
+inline int f791_11(int x) { return x * 11; }
+inline int f791_12(int x) { return x * 12; }
+inline int f791_13(int x) { return x * 13; }
+inline int f791_14(int x) { return x * 14; }
+inline int f791_15(int x) { return x * 15; }
+inline int f791_16(int x) { return x * 16; }
+inline int f791_17(int x) { return x * 17; }
+inline int f791_18(int x) { return x * 18; }
+inline int f791_19(int x) { return x * 19; }
+inline int f791_20(int x) { return x * 20; }
+inline int f791_21(int x) { return x * 21; }
+inline int f791_22(int x) { return x * 22; }
+inline int f791_23(int x) { return x * 23; }
+inline int f791_24(int x) { return x * 24; }
+inline int f791_25(int x) { return x * 25; }
+inline int f791_26(int x) { return x * 26; }
+inline int f791_27(int x) { return x * 27; }
+inline int f791_28(int x) { return x * 28; }
+inline int f791_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7913 */
+#include <vector>
+#include "h3800.h"
+#include "h3715.h"
+#include "h9805.h"
+#include "h6215.h"
+#include "h3954.h"
+#ifdef X
+#include "h5376.h"
+#endif
+struct S7913 { int a; const char *s = "x//y"; };
+inline int f7913_0(int x) { return x * 0; }
+inline int f7913_1(int x) { return x * 1; }
+inline int f7913_2(int x) { return x * 2; }
+inline int f7913_3(int x) { return x * 3; }
+inline int f7913_4(int x) { return x * 4; }
+inline int f7913_5(int x) { return x * 5; }
+inline int f7913_6(int x) { return x * 6; }
+inline int f7913_7(int x) { return x * 7; }
+inline int f7913_8(int x) { return x * 8; }
+inline int f7913_9(int x) { return x * 9; }
+inline int f7913_10(int x) { return x * 10; }
+inline int f7913_11(int x) { return x * 11; }
+inline int f7913_12(int x) { return x * 12; }
+inline int f7913_13(int x) { return x * 13; }
+inline int f7913_14(int x) { return x * 14; }
+inline int f7913_15(int x) { return x * 15; }
+inline int f7913_16(int x) { return x * 16; }
+inline int f7913_17(int x) { return x * 17; }
+inline int f7913_18(int x) { return x * 18; }
+inline int f7913_19(int x) { return x * 19; }
+inline int f7913_20(int x) { return x * 20; }
+inline int f7913_21(int x) { return x * 21; }
+inline int f7913_22(int x) { return x * 22; }
+inline int f7913_23(int x) { return x * 23; }
+inline int f7913_24(int x) { return x * 24; }
+inline int f7913_25(int x) { return x * 25; }
+inline int f7913_26(int x) { return x * 26; }
+inline int f7913_27(int x) { return x * 27; }
+inline int f7913_28(int x) { return x * 28; }
+inline int f7913_29(int x) { return x * 29; }
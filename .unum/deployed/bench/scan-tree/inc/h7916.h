@@ -0,0 +1,42 @@
+#pragma once
+/* header 7916 */
+#include <vector>
+#include "h7701.h"
+#include "h4971.h"
+#include "h6826.h"
+#include "h8159.h"
+#include "h5546.h"
+#ifdef X
+#include "h8537.h"
+#endif
+struct S7916 { int a; const char *s = "x//y"; };
+inline int f7916_0(int x) { return x * 0; }
+inline int f7916_1(int x) { return x * 1; }
+inline int f7916_2(int x) { return x * 2; }
+inline int f7916_3(int x) { return x * 3; }
+inline int f7916_4(int x) { return x * 4; }
+inline int f7916_5(int x) { return x * 5; }
+inline int f7916_6(int x) { return x * 6; }
+inline int f7916_7(int x) { return x * 7; }
+inline int f7916_8(int x) { return x * 8; }
+inline int f7916_9(int x) { return x * 9; }
+inline int f7916_10(int x) { return x * 10; }
+inline int f7916_11(int x) { return x * 11; }
+inline int f7916_12(int x) { return x * 12; }
+inline int f7916_13(int x) { return x * 13; }
+inline int f7916_14(int x) { return x * 14; }
+inline int f7916_15(int x) { return x * 15; }
+inline int f7916_16(int x) { return x * 16; }
+inline int f7916_17(int x) { return x * 17; }
+inline int f7916_18(int x) { return x * 18; }
+inline int f7916_19(int x) { return x * 19; }
+inline int f7916_20(int x) { return x * 20; }
+inline int f7916_21(int x) { return x * 21; }
+inline int f7916_22(int x) { return x * 22; }
+inline int f7916_23(int x) { return x * 23; }
+inline int f7916_24(int x) { return x * 24; }
+inline int f7916_25(int x) { return x * 25; }
+inline int f7916_26(int x) { return x * 26; }
+inline int f7916_27(int x) { return x * 27; }
+inline int f7916_28(int x) { return x * 28; }
+inline int f7916_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7917 */
+#include <vector>
+#include "h2074.h"
+#include "h8471.h"
+#include "h3624.h"
+#include "h1069.h"
+#include "h8753.h"
+#ifdef X
+#include "h3599.h"
+#endif
+struct S7917 { int a; const char *s = "x//y"; };
+inline int f7917_0(int x) { return x * 0; }
+inline int f7917_1(int x) { return x * 1; }
+inline int f7917_2(int x) { return x * 2; }
+inline int f7917_3(int x) { return x * 3; }
+inline int f7917_4(int x) { return x * 4; }
+inline int f7917_5(int x) { return x * 5; }
+inline int f7917_6(int x) { return x * 6; }
+inline int f7917_7(int x) { return x * 7; }
+inline int f7917_8(int x) { return x * 8; }
+inline int f7917_9(int x) { return x * 9; }
+inline int f7917_10(int x) { return x * 10; }
+inline int f7917_11(int x) { return x * 11; }
+inline int f7917_12(int x) { return x * 12; }
+inline int f7917_13(int x) { return x * 13; }
+inline int f7917_14(int x) { return x * 14; }
+inline int f7917_15(int x) { return x * 15; }
+inline int f7917_16(int x) { return x * 16; }
+inline int f7917_17(int x) { return x * 17; }
+inline int f7917_18(int x) { return x * 18; }
+inline int f7917_19(int x) { return x * 19; }
+inline int f7917_20(int x) { return x * 20; }
+inline int f7917_21(int x) { return x * 21; }
+inline int f7917_22(int x) { return x * 22; }
+inline int f7917_23(int x) { return x * 23; }
+inline int f7917_24(int x) { return x * 24; }
+inline int f7917_25(int x) { return x * 25; }
+inline int f7917_26(int x) { return x * 26; }
+inline int f7917_27(int x) { return x * 27; }
+inline int f7917_28(int x) { return x * 28; }
+inline int f7917_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7919 */
+#include <vector>
+#include "h2546.h"
+#include "h9348.h"
+#include "h7708.h"
+#include "h1979.h"
+#include "h492.h"
+#ifdef X
+#include "h2678.h"
+#endif
+struct S7919 { int a; const char *s = "x//y"; };
+inline int f7919_0(int x) { return x * 0; }
+inline int f7919_1(int x) { return x * 1; }
+inline int f7919_2(int x) { return x * 2; }
+inline int f7919_3(int x) { return x * 3; }
+inline int f7919_4(int x) { return x * 4; }
+inline int f7919_5(int x) { return x * 5; }
+inline int f7919_6(int x) { return x * 6; }
+inline int f7919_7(int x) { return x * 7; }
+inline int f7919_8(int x) { return x * 8; }
+inline int f7919_9(int x) { return x * 9; }
+inline int f7919_10(int x) { return x * 10; }
+inline int f7919_11(int x) { return x * 11; }
+inline int f7919_12(int x) { return x * 12; }
+inline int f7919_13(int x) { return x * 13; }
+inline int f7919_14(int x) { return x * 14; }
+inline int f7919_15(int x) { return x * 15; }
+inline int f7919_16(int x) { return x * 16; }
+inline int f7919_17(int x) { return x * 17; }
+inline int f7919_18(int x) { return x * 18; }
+inline int f7919_19(int x) { return x * 19; }
+inline int f7919_20(int x) { return x * 20; }
+inline int f7919_21(int x) { return x * 21; }
+inline int f7919_22(int x) { return x * 22; }
+inline int f7919_23(int x) { return x * 23; }
+inline int f7919_24(int x) { return x * 24; }
+inline int f7919_25(int x) { return x * 25; }
+inline int f7919_26(int x) { return x * 26; }
+inline int f7919_27(int x) { return x * 27; }
+inline int f7919_28(int x) { return x * 28; }
+inline int f7919_29(int x) { return x * 29; }
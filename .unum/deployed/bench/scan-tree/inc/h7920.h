@@ -0,0 +1,42 @@
+#pragma once
+/* header 7920 */
+#include <vector>
+#include "h6957.h"
+#include "h694.h"
+#include "h9849.h"
+#include "h1321.h"
+#include "h4669.h"
+#ifdef X
+#include "h8863.h"
+#endif
+struct S7920 { int a; const char *s = "x//y"; };
+inline int f7920_0(int x) { return x * 0; }
+inline int f7920_1(int x) { return x * 1; }
+inline int f7920_2(int x) { return x * 2; }
+inline int f7920_3(int x) { return x * 3; }
+inline int f7920_4(int x) { return x * 4; }
+inline int f7920_5(int x) { return x * 5; }
+inline int f7920_6(int x) { return x * 6; }
+inline int f7920_7(int x) { return x * 7; }
+inline int f7920_8(int x) { return x * 8; }
+inline int f7920_9(int x) { return x * 9; }
+inline int f7920_10(int x) { return x * 10; }
+inline int f7920_11(int x) { return x * 11; }
+inline int f7920_12(int x) { return x * 12; }
+inline int f7920_13(int x) { return x * 13; }
+inline int f7920_14(int x) { return x * 14; }
+inline int f7920_15(int x) { return x * 15; }
+inline int f7920_16(int x) { return x * 16; }
+inline int f7920_17(int x) { return x * 17; }
+inline int f7920_18(int x) { return x * 18; }
+inline int f7920_19(int x) { return x * 19; }
+inline int f7920_20(int x) { return x * 20; }
+inline int f7920_21(int x) { return x * 21; }
+inline int f7920_22(int x) { return x * 22; }
+inline int f7920_23(int x) { return x * 23; }
+inline int f7920_24(int x) { return x * 24; }
+inline int f7920_25(int x) { return x * 25; }
+inline int f7920_26(int x) { return x * 26; }
+inline int f7920_27(int x) { return x * 27; }
+inline int f7920_28(int x) { return x * 28; }
+inline int f7920_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 793 */
+#include <vector>
+#include "h9597.h"
+#include "h3492.h"
+#include "h6262.h"
+#include "h8790.h"
+#include "h7432.h"
+#ifdef X
+#include "h5333.h"
+#endif
+struct S793 { int a; const char *s = "x//y"; };
+inline int f793_0(int x) { return x * 0; }
+inline int f793_1(int x) { return x * 1; }
+inline int f793_2(int x) { return x * 2; }
+inline int f793_3(int x) { return x * 3; }
+inline int f793_4(int x) { return x * 4; }
+inline int f793_5(int x) { return x * 5; }
+inline int f793_6(int x) { return x * 6; }
+inline int f793_7(int x) { return x * 7; }
+inline int f793_8(int x) { return x * 8; }
+inline int f793_9(int x) { return x * 9; }
+inline int f793_10(int x) { return x * 10; }
+inline int f793_11(int x) { return x * 11; }
+inline int f793_12(int x) { return x * 12; }
+inline int f793_13(int x) { return x * 13; }
+inline int f793_14(int x) { return x * 14; }
+inline int f793_15(int x) { return x * 15; }
+inline int f793_16(int x) { return x * 16; }
+inline int f793_17(int x) { return x * 17; }
+inline int f793_18(int x) { return x * 18; }
+inline int f793_19(int x) { return x * 19; }
+inline int f793_20(int x) { return x * 20; }
+inline int f793_21(int x) { return x * 21; }
+inline int f793_22(int x) { return x * 22; }
+inline int f793_23(int x) { return x * 23; }
+inline int f793_24(int x) { return x * 24; }
+inline int f793_25(int x) { return x * 25; }
+inline int f793_26(int x) { return x * 26; }
+inline int f793_27(int x) { return x * 27; }
+inline int f793_28(int x) { return x * 28; }
+inline int f793_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7931 */
+#include <vector>
+#include "h5596.h"
+#include "h3338.h"
+#include "h6175.h"
+#include "h626.h"
+#include "h9245.h"
+#ifdef X
+#include "h5865.h"
+#endif
+struct S7931 { int a; const char *s = "x//y"; };
+inline int f7931_0(int x) { return x * 0; }
+inline int f7931_1(int x) { return x * 1; }
+inline int f7931_2(int x) { return x * 2; }
+inline int f7931_3(int x) { return x * 3; }
+inline int f7931_4(int x) { return x * 4; }
+inline int f7931_5(int x) { return x * 5; }
+inline int f7931_6(int x) { return x * 6; }
+inline int f7931_7(int x) { return x * 7; }
+inline int f7931_8(int x) { return x * 8; }
+inline int f7931_9(int x) { return x * 9; }
+inline int f7931_10(int x) { return x * 10; }
+inline int f7931_11(int x) { return x * 11; }
+inline int f7931_12(int x) { return x * 12; }
+inline int f7931_13(int x) { return x * 13; }
+inline int f7931_14(int x) { return x * 14; }
+inline int f7931_15(int x) { return x * 15; }
+inline int f7931_16(int x) { return x * 16; }
+inline int f7931_17(int x) { return x * 17; }
+inline int f7931_18(int x) { return x * 18; }
+inline int f7931_19(int x) { return x * 19; }
+inline int f7931_20(int x) { return x * 20; }
+inline int f7931_21(int x) { return x * 21; }
+inline int f7931_22(int x) { return x * 22; }
+inline int f7931_23(int x) { return x * 23; }
+inline int f7931_24(int x) { return x * 24; }
+inline int f7931_25(int x) { return x * 25; }
+inline int f7931_26(int x) { return x * 26; }
+inline int f7931_27(int x) { return x * 27; }
+inline int f7931_28(int x) { return x * 28; }
+inline int f7931_29(int x) { return x * 29; }
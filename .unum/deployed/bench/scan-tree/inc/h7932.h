@@ -0,0 +1,42 @@
+#pragma once
+/* header 7932 */
+#include <vector>
+#include "h1665.h"
+#include "h2906.h"
+#include "h9881.h"
+#include "h4876.h"
+#include "h9599.h"
+#ifdef X
+#include "h7993.h"
+#endif
+struct S7932 { int a; const char *s = "x//y"; };
+inline int f7932_0(int x) { return x * 0; }
+inline int f7932_1(int x) { return x * 1; }
+inline int f7932_2(int x) { return x * 2; }
+inline int f7932_3(int x) { return x * 3; }
+inline int f7932_4(int x) { return x * 4; }
+inline int f7932_5(int x) { return x * 5; }
+inline int f7932_6(int x) { return x * 6; }
+inline int f7932_7(int x) { return x * 7; }
+inline int f7932_8(int x) { return x * 8; }
+inline int f7932_9(int x) { return x * 9; }
+inline int f7932_10(int x) { return x * 10; }
+inline int f7932_11(int x) { return x * 11; }
+inline int f7932_12(int x) { return x * 12; }
+inline int f7932_13(int x) { return x * 13; }
+inline int f7932_14(int x) { return x * 14; }
+inline int f7932_15(int x) { return x * 15; }
+inline int f7932_16(int x) { return x * 16; }
+inline int f7932_17(int x) { return x * 17; }
+inline int f7932_18(int x) { return x * 18; }
+inline int f7932_19(int x) { return x * 19; }
+inline int f7932_20(int x) { return x * 20; }
+inline int f7932_21(int x) { return x * 21; }
+inline int f7932_22(int x) { return x * 22; }
+inline int f7932_23(int x) { return x * 23; }
+inline int f7932_24(int x) { return x * 24; }
+inline int f7932_25(int x) { return x * 25; }
+inline int f7932_26(int x) { return x * 26; }
+inline int f7932_27(int x) { return x * 27; }
+inline int f7932_28(int x) { return x * 28; }
+inline int f7932_29(int x) { return x * 29; }
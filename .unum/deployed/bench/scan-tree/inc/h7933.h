@@ -0,0 +1,42 @@
+#pragma once
+/* header 7933 */
+#include <vector>
+#include "h9794.h"
+#include "h6735.h"
+#include "h4709.h"
+#include "h2387.h"
+#include "h6157.h"
+#ifdef X
+#include "h4555.h"
+#endif
+struct S7933 { int a; const char *s = "x//y"; };
+inline int f7933_0(int x) { return x * 0; }
+inline int f7933_1(int x) { return x * 1; }
+inline int f7933_2(int x) { return x * 2; }
+inline int f7933_3(int x) { return x * 3; }
+inline int f7933_4(int x) { return x * 4; }
+inline int f7933_5(int x) { return x * 5; }
+inline int f7933_6(int x) { return x * 6; }
+inline int f7933_7(int x) { return x * 7; }
+inline int f7933_8(int x) { return x * 8; }
+inline int f7933_9(int x) { return x * 9; }
+inline int f7933_10(int x) { return x * 10; }
+inline int f7933_11(int x) { return x * 11; }
+inline int f7933_12(int x) { return x * 12; }
+inline int f7933_13(int x) { return x * 13; }
+inline int f7933_14(int x) { return x * 14; }
+inline int f7933_15(int x) { return x * 15; }
+inline int f7933_16(int x) { return x * 16; }
+inline int f7933_17(int x) { return x * 17; }
+inline int f7933_18(int x) { return x * 18; }
+inline int f7933_19(int x) { return x * 19; }
+inline int f7933_20(int x) { return x * 20; }
+inline int f7933_21(int x) { return x * 21; }
+inline int f7933_22(int x) { return x * 22; }
+inline int f7933_23(int x) { return x * 23; }
+inline int f7933_24(int x) { return x * 24; }
+inline int f7933_25(int x) { return x * 25; }
+inline int f7933_26(int x) { return x * 26; }
+inline int f7933_27(int x) { return x * 27; }
+inline int f7933_28(int x) { return x * 28; }
+inline int f7933_29(int x) { return x * 29; }
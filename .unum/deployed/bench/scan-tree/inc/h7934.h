@@ -0,0 +1,42 @@
+#pragma once
+/* header 7934 */
+#include <vector>
+#include "h2758.h"
+#include "h8465.h"
+#include "h2551.h"
+#include "h4301.h"
+#include "h3549.h"
+#ifdef X
+#include "h6580.h"
+#endif
+struct S7934 { int a; const char *s = "x//y"; };
+inline int f7934_0(int x) { return x * 0; }
+inline int f7934_1(int x) { return x * 1; }
+inline int f7934_2(int x) { return x * 2; }
+inline int f7934_3(int x) { return x * 3; }
+inline int f7934_4(int x) { return x * 4; }
+inline int f7934_5(int x) { return x * 5; }
+inline int f7934_6(int x) { return x * 6; }
+inline int f7934_7(int x) { return x * 7; }
+inline int f7934_8(int x) { return x * 8; }
+inline int f7934_9(int x) { return x * 9; }
+inline int f7934_10(int x) { return x * 10; }
+inline int f7934_11(int x) { return x * 11; }
+inline int f7934_12(int x) { return x * 12; }
+inline int f7934_13(int x) { return x * 13; }
+inline int f7934_14(int x) { return x * 14; }
+inline int f7934_15(int x) { return x * 15; }
+inline int f7934_16(int x) { return x * 16; }
+inline int f7934_17(int x) { return x * 17; }
+inline int f7934_18(int x) { return x * 18; }
+inline int f7934_19(int x) { return x * 19; }
+inline int f7934_20(int x) { return x * 20; }
+inline int f7934_21(int x) { return x * 21; }
+inline int f7934_22(int x) { return x * 22; }
+inline int f7934_23(int x) { return x * 23; }
+inline int f7934_24(int x) { return x * 24; }
+inline int f7934_25(int x) { return x * 25; }
+inline int f7934_26(int x) { return x * 26; }
+inline int f7934_27(int x) { return x * 27; }
+inline int f7934_28(int x) { return x * 28; }
+inline int f7934_29(int x) { return x * 29; }
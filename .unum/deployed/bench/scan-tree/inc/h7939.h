@@ -0,0 +1,42 @@
+#pragma once
+/* header 7939 */
+#include <vector>
+#include "h2603.h"
+#include "h9465.h"
+#include "h5507.h"
+#include "h9128.h"
+#include "h8669.h"
+#ifdef X
+#include "h4589.h"
+#endif
+struct S7939 { int a; const char *s = "x//y"; };
+inline int f7939_0(int x) { return x * 0; }
+inline int f7939_1(int x) { return x * 1; }
+inline int f7939_2(int x) { return x * 2; }
+inline int f7939_3(int x) { return x * 3; }
+inline int f7939_4(int x) { return x * 4; }
+inline int f7939_5(int x) { return x * 5; }
+inline int f7939_6(int x) { return x * 6; }
+inline int f7939_7(int x) { return x * 7; }
+inline int f7939_8(int x) { return x * 8; }
+inline int f7939_9(int x) { return x * 9; }
+inline int f7939_10(int x) { return x * 10; }
+inline int f7939_11(int x) { return x * 11; }
+inline int f7939_12(int x) { return x * 12; }
+inline int f7939_13(int x) { return x * 13; }
+inline int f7939_14(int x) { return x * 14; }
+inline int f7939_15(int x) { return x * 15; }
+inline int f7939_16(int x) { return x * 16; }
+inline int f7939_17(int x) { return x * 17; }
+inline int f7939_18(int x) { return x * 18; }
+inline int f7939_19(int x) { return x * 19; }
+inline int f7939_20(int x) { return x * 20; }
+inline int f7939_21(int x) { return x * 21; }
+inline int f7939_22(int x) { return x * 22; }
+inline int f7939_23(int x) { return x * 23; }
+inline int f7939_24(int x) { return x * 24; }
+inline int f7939_25(int x) { return x * 25; }
+inline int f7939_26(int x) { return x * 26; }
+inline int f7939_27(int x) { return x * 27; }
+inline int f7939_28(int x) { return x * 28; }
+inline int f7939_29(int x) { return x * 29; }
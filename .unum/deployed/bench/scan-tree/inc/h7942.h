@@ -0,0 +1,42 @@
+#pragma once
+/* header 7942 */
+#include <vector>
+#include "h7708.h"
+#include "h1684.h"
+#include "h4824.h"
+#include "h4304.h"
+#include "h720.h"
+#ifdef X
+#include "h5864.h"
+#endif
+struct S7942 { int a; const char *s = "x//y"; };
+inline int f7942_0(int x) { return x * 0; }
+inline int f7942_1(int x) { return x * 1; }
+inline int f7942_2(int x) { return x * 2; }
+inline int f7942_3(int x) { return x * 3; }
+inline int f7942_4(int x) { return x * 4; }
+inline int f7942_5(int x) { return x * 5; }
+inline int f7942_6(int x) { return x * 6; }
+inline int f7942_7(int x) { return x * 7; }
+inline int f7942_8(int x) { return x * 8; }
+inline int f7942_9(int x) { return x * 9; }
+inline int f7942_10(int x) { return x * 10; }
+inline int f7942_11(int x) { return x * 11; }
+inline int f7942_12(int x) { return x * 12; }
+inline int f7942_13(int x) { return x * 13; }
+inline int f7942_14(int x) { return x * 14; }
+inline int f7942_15(int x) { return x * 15; }
+inline int f7942_16(int x) { return x * 16; }
+inline int f7942_17(int x) { return x * 17; }
+inline int f7942_18(int x) { return x * 18; }
+inline int f7942_19(int x) { return x * 19; }
+inline int f7942_20(int x) { return x * 20; }
+inline int f7942_21(int x) { return x * 21; }
+inline int f7942_22(int x) { return x * 22; }
+inline int f7942_23(int x) { return x * 23; }
+inline int f7942_24(int x) { return x * 24; }
+inline int f7942_25(int x) { return x * 25; }
+inline int f7942_26(int x) { return x * 26; }
+inline int f7942_27(int x) { return x * 27; }
+inline int f7942_28(int x) { return x * 28; }
+inline int f7942_29(int x) { return x * 29; }
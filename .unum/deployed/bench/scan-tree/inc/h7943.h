@@ -0,0 +1,42 @@
+#pragma once
+/* header 7943 */
+#include <vector>
+#include "h832.h"
+#include "h291.h"
+#include "h5457.h"
+#include "h8784.h"
+#include "h304.h"
+#ifdef X
+#include "h747.h"
+#endif
+struct S7943 { int a; const char *s = "x//y"; };
+inline int f7943_0(int x) { return x * 0; }
+inline int f7943_1(int x) { return x * 1; }
+inline int f7943_2(int x) { return x * 2; }
+inline int f7943_3(int x) { return x * 3; }
+inline int f7943_4(int x) { return x * 4; }
+inline int f7943_5(int x) { return x * 5; }
+inline int f7943_6(int x) { return x * 6; }
+inline int f7943_7(int x) { return x * 7; }
+inline int f7943_8(int x) { return x * 8; }
+inline int f7943_9(int x) { return x * 9; }
+inline int f7943_10(int x) { return x * 10; }
+inline int f7943_11(int x) { return x * 11; }
+inline int f7943_12(int x) { return x * 12; }
+inline int f7943_13(int x) { return x * 13; }
+inline int f7943_14(int x) { return x * 14; }
+inline int f7943_15(int x) { return x * 15; }
+inline int f7943_16(int x) { return x * 16; }
+inline int f7943_17(int x) { return x * 17; }
+inline int f7943_18(int x) { return x * 18; }
+inline int f7943_19(int x) { return x * 19; }
+inline int f7943_20(int x) { return x * 20; }
+inline int f7943_21(int x) { return x * 21; }
+inline int f7943_22(int x) { return x * 22; }
+inline int f7943_23(int x) { return x * 23; }
+inline int f7943_24(int x) { return x * 24; }
+inline int f7943_25(int x) { return x * 25; }
+inline int f7943_26(int x) { return x * 26; }
+inline int f7943_27(int x) { return x * 27; }
+inline int f7943_28(int x) { return x * 28; }
+inline int f7943_29(int x) { return x * 29; }
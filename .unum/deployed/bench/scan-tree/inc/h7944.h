@@ -0,0 +1,42 @@
+#pragma once
+/* header 7944 */
+#include <vector>
+#include "h6587.h"
+#include "h7207.h"
+#include "h4134.h"
+#include "h1971.h"
+#include "h4858.h"
+#ifdef X
+#include "h3756.h"
+#endif
+struct S7944 { int a; const char *s = "x//y"; };
+inline int f7944_0(int x) { return x * 0; }
+inline int f7944_1(int x) { return x * 1; }
+inline int f7944_2(int x) { return x * 2; }
+inline int f7944_3(int x) { return x * 3; }
+inline int f7944_4(int x) { return x * 4; }
+inline int f7944_5(int x) { return x * 5; }
+inline int f7944_6(int x) { return x * 6; }
+inline int f7944_7(int x) { return x * 7; }
+inline int f7944_8(int x) { return x * 8; }
+inline int f7944_9(int x) { return x * 9; }
+inline int f7944_10(int x) { return x * 10; }
+inline int f7944_11(int x) { return x * 11; }
+inline int f7944_12(int x) { return x * 12; }
+inline int f7944_13(int x) { return x * 13; }
+inline int f7944_14(int x) { return x * 14; }
+inline int f7944_15(int x) { return x * 15; }
+inline int f7944_16(int x) { return x * 16; }
+inline int f7944_17(int x) { return x * 17; }
+inline int f7944_18(int x) { return x * 18; }
+inline int f7944_19(int x) { return x * 19; }
+inline int f7944_20(int x) { return x * 20; }
+inline int f7944_21(int x) { return x * 21; }
+inline int f7944_22(int x) { return x * 22; }
+inline int f7944_23(int x) { return x * 23; }
+inline int f7944_24(int x) { return x * 24; }
+inline int f7944_25(int x) { return x * 25; }
+inline int f7944_26(int x) { return x * 26; }
+inline int f7944_27(int x) { return x * 27; }
+inline int f7944_28(int x) { return x * 28; }
+inline int f7944_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7947 */
+#include <vector>
+#include "h5238.h"
+#include "h3733.h"
+#include "h3483.h"
+#include "h98.h"
+#include "h7491.h"
+#ifdef X
+#include "h709.h"
+#endif
+struct S7947 { int a; const char *s = "x//y"; };
+inline int f7947_0(int x) { return x * 0; }
+inline int f7947_1(int x) { return x * 1; }
+inline int f7947_2(int x) { return x * 2; }
+inline int f7947_3(int x) { return x * 3; }
+inline int f7947_4(int x) { return x * 4; }
+inline int f7947_5(int x) { return x * 5; }
+inline int f7947_6(int x) { return x * 6; }
+inline int f7947_7(int x) { return x * 7; }
+inline int f7947_8(int x) { return x * 8; }
+inline int f7947_9(int x) { return x * 9; }
+inline int f7947_10(int x) { return x * 10; }
+inline int f7947_11(int x) { return x * 11; }
+inline int f7947_12(int x) { return x * 12; }
+inline int f7947_13(int x) { return x * 13; }
+inline int f7947_14(int x) { return x * 14; }
+inline int f7947_15(int x) { return x * 15; }
+inline int f7947_16(int x) { return x * 16; }
+inline int f7947_17(int x) { return x * 17; }
+inline int f7947_18(int x) { return x * 18; }
+inline int f7947_19(int x) { return x * 19; }
+inline int f7947_20(int x) { return x * 20; }
+inline int f7947_21(int x) { return x * 21; }
+inline int f7947_22(int x) { return x * 22; }
+inline int f7947_23(int x) { return x * 23; }
+inline int f7947_24(int x) { return x * 24; }
+inline int f7947_25(int x) { return x * 25; }
+inline int f7947_26(int x) { return x * 26; }
+inline int f7947_27(int x) { return x * 27; }
+inline int f7947_28(int x) { return x * 28; }
+inline int f7947_29(int x) { return x * 29; }
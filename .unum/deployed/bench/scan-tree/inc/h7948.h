@@ -0,0 +1,42 @@
+#pragma once
+/* header 7948 */
+#include <vector>
+#include "h5643.h"
+#include "h7033.h"
+#include "h3912.h"
+#include "h681.h"
+#include "h3382.h"
+#ifdef X
+#include "h469.h"
+#endif
+struct S7948 { int a; const char *s = "x//y"; };
+inline int f7948_0(int x) { return x * 0; }
+inline int f7948_1(int x) { return x * 1; }
+inline int f7948_2(int x) { return x * 2; }
+inline int f7948_3(int x) { return x * 3; }
+inline int f7948_4(int x) { return x * 4; }
+inline int f7948_5(int x) { return x * 5; }
+inline int f7948_6(int x) { return x * 6; }
+inline int f7948_7(int x) { return x * 7; }
+inline int f7948_8(int x) { return x * 8; }
+inline int f7948_9(int x) { return x * 9; }
+inline int f7948_10(int x) { return x * 10; }
+inline int f7948_11(int x) { return x * 11; }
+inline int f7948_12(int x) { return x * 12; }
+inline int f7948_13(int x) { return x * 13; }
+inline int f7948_14(int x) { return x * 14; }
+inline int f7948_15(int x) { return x * 15; }
+inline int f7948_16(int x) { return x * 16; }
+inline int f7948_17(int x) { return x * 17; }
+inline int f7948_18(int x) { return x * 18; }
+inline int f7948_19(int x) { return x * 19; }
+inline int f7948_20(int x) { return x * 20; }
+inline int f7948_21(int x) { return x * 21; }
+inline int f7948_22(int x) { return x * 22; }
+inline int f7948_23(int x) { return x * 23; }
+inline int f7948_24(int x) { return x * 24; }
+inline int f7948_25(int x) { return x * 25; }
+inline int f7948_26(int x) { return x * 26; }
+inline int f7948_27(int x) { return x * 27; }
+inline int f7948_28(int x) { return x * 28; }
+inline int f7948_29(int x) { return x * 29; }
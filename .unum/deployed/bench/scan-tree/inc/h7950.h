@@ -0,0 +1,42 @@
+#pragma once
+/* header 7950 */
+#include <vector>
+#include "h5982.h"
+#include "h2372.h"
+#include "h2249.h"
+#include "h3542.h"
+#include "h1790.h"
+#ifdef X
+#include "h6941.h"
+#endif
+struct S7950 { int a; const char *s = "x//y"; };
+inline int f7950_0(int x) { return x * 0; }
+inline int f7950_1(int x) { return x * 1; }
+inline int f7950_2(int x) { return x * 2; }
+inline int f7950_3(int x) { return x * 3; }
+inline int f7950_4(int x) { return x * 4; }
+inline int f7950_5(int x) { return x * 5; }
+inline int f7950_6(int x) { return x * 6; }
+inline int f7950_7(int x) { return x * 7; }
+inline int f7950_8(int x) { return x * 8; }
+inline int f7950_9(int x) { return x * 9; }
+inline int f7950_10(int x) { return x * 10; }
+inline int f7950_11(int x) { return x * 11; }
+inline int f7950_12(int x) { return x * 12; }
+inline int f7950_13(int x) { return x * 13; }
+inline int f7950_14(int x) { return x * 14; }
+inline int f7950_15(int x) { return x * 15; }
+inline int f7950_16(int x) { return x * 16; }
+inline int f7950_17(int x) { return x * 17; }
+inline int f7950_18(int x) { return x * 18; }
+inline int f7950_19(int x) { return x * 19; }
+inline int f7950_20(int x) { return x * 20; }
+inline int f7950_21(int x) { return x * 21; }
+inline int f7950_22(int x) { return x * 22; }
+inline int f7950_23(int x) { return x * 23; }
+inline int f7950_24(int x) { return x * 24; }
+inline int f7950_25(int x) { return x * 25; }
+inline int f7950_26(int x) { return x * 26; }
+inline int f7950_27(int x) { return x * 27; }
+inline int f7950_28(int x) { return x * 28; }
+inline int f7950_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7951 */
+#include <vector>
+#include "h8675.h"
+#include "h6690.h"
+#include "h2668.h"
+#include "h1258.h"
+#include "h6796.h"
+#ifdef X
+#include "h3641.h"
+#endif
+struct S7951 { int a; const char *s = "x//y"; };
+inline int f7951_0(int x) { return x * 0; }
+inline int f7951_1(int x) { return x * 1; }
+inline int f7951_2(int x) { return x * 2; }
+inline int f7951_3(int x) { return x * 3; }
+inline int f7951_4(int x) { return x * 4; }
+inline int f7951_5(int x) { return x * 5; }
+inline int f7951_6(int x) { return x * 6; }
+inline int f7951_7(int x) { return x * 7; }
+inline int f7951_8(int x) { return x * 8; }
+inline int f7951_9(int x) { return x * 9; }
+inline int f7951_10(int x) { return x * 10; }
+inline int f7951_11(int x) { return x * 11; }
+inline int f7951_12(int x) { return x * 12; }
+inline int f7951_13(int x) { return x * 13; }
+inline int f7951_14(int x) { return x * 14; }
+inline int f7951_15(int x) { return x * 15; }
+inline int f7951_16(int x) { return x * 16; }
+inline int f7951_17(int x) { return x * 17; }
+inline int f7951_18(int x) { return x * 18; }
+inline int f7951_19(int x) { return x * 19; }
+inline int f7951_20(int x) { return x * 20; }
+inline int f7951_21(int x) { return x * 21; }
+inline int f7951_22(int x) { return x * 22; }
+inline int f7951_23(int x) { return x * 23; }
+inline int f7951_24(int x) { return x * 24; }
+inline int f7951_25(int x) { return x * 25; }
+inline int f7951_26(int x) { return x * 26; }
+inline int f7951_27(int x) { return x * 27; }
+inline int f7951_28(int x) { return x * 28; }
+inline int f7951_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7952 */
+#include <vector>
+#include "h8573.h"
+#include "h1969.h"
+#include "h2671.h"
+#include "h7364.h"
+#include "h1377.h"
+#ifdef X
+#include "h4093.h"
+#endif
+struct S7952 { int a; const char *s = "x//y"; };
+inline int f7952_0(int x) { return x * 0; }
+inline int f7952_1(int x) { return x * 1; }
+inline int f7952_2(int x) { return x * 2; }
+inline int f7952_3(int x) { return x * 3; }
+inline int f7952_4(int x) { return x * 4; }
+inline int f7952_5(int x) { return x * 5; }
+inline int f7952_6(int x) { return x * 6; }
+inline int f7952_7(int x) { return x * 7; }
+inline int f7952_8(int x) { return x * 8; }
+inline int f7952_9(int x) { return x * 9; }
+inline int f7952_10(int x) { return x * 10; }
+inline int f7952_11(int x) { return x * 11; }
+inline int f7952_12(int x) { return x * 12; }
+inline int f7952_13(int x) { return x * 13; }
+inline int f7952_14(int x) { return x * 14; }
+inline int f7952_15(int x) { return x * 15; }
+inline int f7952_16(int x) { return x * 16; }
+inline int f7952_17(int x) { return x * 17; }
+inline int f7952_18(int x) { return x * 18; }
+inline int f7952_19(int x) { return x * 19; }
+inline int f7952_20(int x) { return x * 20; }
+inline int f7952_21(int x) { return x * 21; }
+inline int f7952_22(int x) { return x * 22; }
+inline int f7952_23(int x) { return x * 23; }
+inline int f7952_24(int x) { return x * 24; }
+inline int f7952_25(int x) { return x * 25; }
+inline int f7952_26(int x) { return x * 26; }
+inline int f7952_27(int x) { return x * 27; }
+inline int f7952_28(int x) { return x * 28; }
+inline int f7952_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 796 */
+#include <vector>
+#include "h6371.h"
+#include "h9775.h"
+#include "h9881.h"
+#include "h3651.h"
+#include "h3072.h"
+#ifdef X
+#include "h5485.h"
+#endif
+struct S796 { int a; const char *s = "x//y"; };
+inline int f796_0(int x) { return x * 0; }
+inline int f796_1(int x) { return x * 1; }
+inline int f796_2(int x) { return x * 2; }
+inline int f796_3(int x) { return x * 3; }
+inline int f796_4(int x) { return x * 4; }
+inline int f796_5(int x) { return x * 5; }
+inline int f796_6(int x) { return x * 6; }
+inline int f796_7(int x) { return x * 7; }
+inline int f796_8(int x) { return x * 8; }
+inline int f796_9(int x) { return x * 9; }
+inline int f796_10(int x) { return x * 10; }
+inline int f796_11(int x) { return x * 11; }
+inline int f796_12(int x) { return x * 12; }
+inline int f796_13(int x) { return x * 13; }
+inline int f796_14(int x) { return x * 14; }
+inline int f796_15(int x) { return x * 15; }
+inline int f796_16(int x) { return x * 16; }
+inline int f796_17(int x) { return x * 17; }
+inline int f796_18(int x) { return x * 18; }
+inline int f796_19(int x) { return x * 19; }
+inline int f796_20(int x) { return x * 20; }
+inline int f796_21(int x) { return x * 21; }
+inline int f796_22(int x) { return x * 22; }
+inline int f796_23(int x) { return x * 23; }
+inline int f796_24(int x) { return x * 24; }
+inline int f796_25(int x) { return x * 25; }
+inline int f796_26(int x) { return x * 26; }
+inline int f796_27(int x) { return x * 27; }
+inline int f796_28(int x) { return x * 28; }
+inline int f796_29(int x) { return x * 29; }
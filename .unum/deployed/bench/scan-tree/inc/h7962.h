@@ -0,0 +1,42 @@
+#pragma once
+/* header 7962 */
+#include <vector>
+#include "h6374.h"
+#include "h2771.h"
+#include "h77.h"
+#include "h4019.h"
+#include "h708.h"
+#ifdef X
+#include "h7545.h"
+#endif
+struct S7962 { int a; const char *s = "x//y"; };
+inline int f7962_0(int x) { return x * 0; }
+inline int f7962_1(int x) { return x * 1; }
+inline int f7962_2(int x) { return x * 2; }
+inline int f7962_3(int x) { return x * 3; }
+inline int f7962_4(int x) { return x * 4; }
+inline int f7962_5(int x) { return x * 5; }
+inline int f7962_6(int x) { return x * 6; }
+inline int f7962_7(int x) { return x * 7; }
+inline int f7962_8(int x) { return x * 8; }
+inline int f7962_9(int x) { return x * 9; }
+inline int f7962_10(int x) { return x * 10; }
+inline int f7962_11(int x) { return x * 11; }
+inline int f7962_12(int x) { return x * 12; }
+inline int f7962_13(int x) { return x * 13; }
+inline int f7962_14(int x) { return x * 14; }
+inline int f7962_15(int x) { return x * 15; }
+inline int f7962_16(int x) { return x * 16; }
+inline int f7962_17(int x) { return x * 17; }
+inline int f7962_18(int x) { return x * 18; }
+inline int f7962_19(int x) { return x * 19; }
+inline int f7962_20(int x) { return x * 20; }
+inline int f7962_21(int x) { return x * 21; }
+inline int f7962_22(int x) { return x * 22; }
+inline int f7962_23(int x) { return x * 23; }
+inline int f7962_24(int x) { return x * 24; }
+inline int f7962_25(int x) { return x * 25; }
+inline int f7962_26(int x) { return x * 26; }
+inline int f7962_27(int x) { return x * 27; }
+inline int f7962_28(int x) { return x * 28; }
+inline int f7962_29(int x) { return x * 29; }
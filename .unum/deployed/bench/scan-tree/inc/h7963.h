@@ -0,0 +1,42 @@
+#pragma once
+/* header 7963 */
+#include <vector>
+#include "h9320.h"
+#include "h1667.h"
+#include "h5675.h"
+#include "h5122.h"
+#include "h1591.h"
+#ifdef X
+#include "h7796.h"
+#endif
+struct S7963 { int a; const char *s = "x//y"; };
+inline int f7963_0(int x) { return x * 0; }
+inline int f7963_1(int x) { return x * 1; }
+inline int f7963_2(int x) { return x * 2; }
+inline int f7963_3(int x) { return x * 3; }
+inline int f7963_4(int x) { return x * 4; }
+inline int f7963_5(int x) { return x * 5; }
+inline int f7963_6(int x) { return x * 6; }
+inline int f7963_7(int x) { return x * 7; }
+inline int f7963_8(int x) { return x * 8; }
+inline int f7963_9(int x) { return x * 9; }
+inline int f7963_10(int x) { return x * 10; }
+inline int f7963_11(int x) { return x * 11; }
+inline int f7963_12(int x) { return x * 12; }
+inline int f7963_13(int x) { return x * 13; }
+inline int f7963_14(int x) { return x * 14; }
+inline int f7963_15(int x) { return x * 15; }
+inline int f7963_16(int x) { return x * 16; }
+inline int f7963_17(int x) { return x * 17; }
+inline int f7963_18(int x) { return x * 18; }
+inline int f7963_19(int x) { return x * 19; }
+inline int f7963_20(int x) { return x * 20; }
+inline int f7963_21(int x) { return x * 21; }
+inline int f7963_22(int x) { return x * 22; }
+inline int f7963_23(int x) { return x * 23; }
+inline int f7963_24(int x) { return x * 24; }
+inline int f7963_25(int x) { return x * 25; }
+inline int f7963_26(int x) { return x * 26; }
+inline int f7963_27(int x) { return x * 27; }
+inline int f7963_28(int x) { return x * 28; }
+inline int f7963_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7964 */
+#include <vector>
+#include "h385.h"
+#include "h4060.h"
+#include "h4872.h"
+#include "h8764.h"
+#include "h9635.h"
+#ifdef X
+#include "h1304.h"
+#endif
+struct S7964 { int a; const char *s = "x//y"; };
+inline int f7964_0(int x) { return x * 0; }
+inline int f7964_1(int x) { return x * 1; }
+inline int f7964_2(int x) { return x * 2; }
+inline int f7964_3(int x) { return x * 3; }
+inline int f7964_4(int x) { return x * 4; }
+inline int f7964_5(int x) { return x * 5; }
+inline int f7964_6(int x) { return x * 6; }
+inline int f7964_7(int x) { return x * 7; }
+inline int f7964_8(int x) { return x * 8; }
+inline int f7964_9(int x) { return x * 9; }
+inline int f7964_10(int x) { return x * 10; }
+inline int f7964_11(int x) { return x * 11; }
+inline int f7964_12(int x) { return x * 12; }
+inline int f7964_13(int x) { return x * 13; }
+inline int f7964_14(int x) { return x * 14; }
+inline int f7964_15(int x) { return x * 15; }
+inline int f7964_16(int x) { return x * 16; }
+inline int f7964_17(int x) { return x * 17; }
+inline int f7964_18(int x) { return x * 18; }
+inline int f7964_19(int x) { return x * 19; }
+inline int f7964_20(int x) { return x * 20; }
+inline int f7964_21(int x) { return x * 21; }
+inline int f7964_22(int x) { return x * 22; }
+inline int f7964_23(int x) { return x * 23; }
+inline int f7964_24(int x) { return x * 24; }
+inline int f7964_25(int x) { return x * 25; }
+inline int f7964_26(int x) { return x * 26; }
+inline int f7964_27(int x) { return x * 27; }
+inline int f7964_28(int x) { return x * 28; }
+inline int f7964_29(int x) { return x * 29; }
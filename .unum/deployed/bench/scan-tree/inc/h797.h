@@ -0,0 +1,42 @@
+#pragma once
+/* header 797 */
+#include <vector>
+#include "h8808.h"
+#include "h808.h"
+#include "h9334.h"
+#include "h7783.h"
+#include "h2243.h"
+#ifdef X
+#include "h2216.h"
+#endif
+struct S797 { int a; const char *s = "x//y"; };
+inline int f797_0(int x) { return x * 0; }
+inline int f797_1(int x) { return x * 1; }
+inline int f797_2(int x) { return x * 2; }
+inline int f797_3(int x) { return x * 3; }
+inline int f797_4(int x) { return x * 4; }
+inline int f797_5(int x) { return x * 5; }
+inline int f797_6(int x) { return x * 6; }
+inline int f797_7(int x) { return x * 7; }
+inline int f797_8(int x) { return x * 8; }
+inline int f797_9(int x) { return x * 9; }
+inline int f797_10(int x) { return x * 10; }
+inline int f797_11(int x) { return x * 11; }
+inline int f797_12(int x) { return x * 12; }
+inline int f797_13(int x) { return x * 13; }
+inline int f797_14(int x) { return x * 14; }
+inline int f797_15(int x) { return x * 15; }
+inline int f797_16(int x) { return x * 16; }
+inline int f797_17(int x) { return x * 17; }
+inline int f797_18(int x) { return x * 18; }
+inline int f797_19(int x) { return x * 19; }
+inline int f797_20(int x) { return x * 20; }
+inline int f797_21(int x) { return x * 21; }
+inline int f797_22(int x) { return x * 22; }
+inline int f797_23(int x) { return x * 23; }
+inline int f797_24(int x) { return x * 24; }
+inline int f797_25(int x) { return x * 25; }
+inline int f797_26(int x) { return x * 26; }
+inline int f797_27(int x) { return x * 27; }
+inline int f797_28(int x) { return x * 28; }
+inline int f797_29(int x) { return x * 29; }
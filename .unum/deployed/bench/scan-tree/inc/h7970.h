@@ -0,0 +1,42 @@
+#pragma once
+/* header 7970 */
+#include <vector>
+#include "h253.h"
+#include "h6018.h"
+#include "h8969.h"
+#include "h2736.h"
+#include "h1244.h"
+#ifdef X
+#include "h8134.h"
+#endif
+struct S7970 { int a; const char *s = "x//y"; };
+inline int f7970_0(int x) { return x * 0; }
+inline int f7970_1(int x) { return x * 1; }
+inline int f7970_2(int x) { return x * 2; }
+inline int f7970_3(int x) { return x * 3; }
+inline int f7970_4(int x) { return x * 4; }
+inline int f7970_5(int x) { return x * 5; }
+inline int f7970_6(int x) { return x * 6; }
+inline int f7970_7(int x) { return x * 7; }
+inline int f7970_8(int x) { return x * 8; }
+inline int f7970_9(int x) { return x * 9; }
+inline int f7970_10(int x) { return x * 10; }
+inline int f7970_11(int x) { return x * 11; }
+inline int f7970_12(int x) { return x * 12; }
+inline int f7970_13(int x) { return x * 13; }
+inline int f7970_14(int x) { return x * 14; }
+inline int f7970_15(int x) { return x * 15; }
+inline int f7970_16(int x) { return x * 16; }
+inline int f7970_17(int x) { return x * 17; }
+inline int f7970_18(int x) { return x * 18; }
+inline int f7970_19(int x) { return x * 19; }
+inline int f7970_20(int x) { return x * 20; }
+inline int f7970_21(int x) { return x * 21; }
+inline int f7970_22(int x) { return x * 22; }
+inline int f7970_23(int x) { return x * 23; }
+inline int f7970_24(int x) { return x * 24; }
+inline int f7970_25(int x) { return x * 25; }
+inline int f7970_26(int x) { return x * 26; }
+inline int f7970_27(int x) { return x * 27; }
+inline int f7970_28(int x) { return x * 28; }
+inline int f7970_29(int x) { return x * 29; }
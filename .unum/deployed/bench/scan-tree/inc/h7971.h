@@ -0,0 +1,42 @@
+#pragma once
+/* header 7971 */
+#include <vector>
+#include "h2618.h"
+#include "h6025.h"
+#include "h1860.h"
+#include "h1446.h"
+#include "h2669.h"
+#ifdef X
+#include "h7447.h"
+#endif
+struct S7971 { int a; const char *s = "x//y"; };
+inline int f7971_0(int x) { return x * 0; }
+inline int f7971_1(int x) { return x * 1; }
+inline int f7971_2(int x) { return x * 2; }
+inline int f7971_3(int x) { return x * 3; }
+inline int f7971_4(int x) { return x * 4; }
+inline int f7971_5(int x) { return x * 5; }
+inline int f7971_6(int x) { return x * 6; }
+inline int f7971_7(int x) { return x * 7; }
+inline int f7971_8(int x) { return x * 8; }
+inline int f7971_9(int x) { return x * 9; }
+inline int f7971_10(int x) { return x * 10; }
+inline int f7971_11(int x) { return x * 11; }
+inline int f7971_12(int x) { return x * 12; }
+inline int f7971_13(int x) { return x * 13; }
+inline int f7971_14(int x) { return x * 14; }
+inline int f7971_15(int x) { return x * 15; }
+inline int f7971_16(int x) { return x * 16; }
+inline int f7971_17(int x) { return x * 17; }
+inline int f7971_18(int x) { return x * 18; }
+inline int f7971_19(int x) { return x * 19; }
+inline int f7971_20(int x) { return x * 20; }
+inline int f7971_21(int x) { return x * 21; }
+inline int f7971_22(int x) { return x * 22; }
+inline int f7971_23(int x) { return x * 23; }
+inline int f7971_24(int x) { return x * 24; }
+inline int f7971_25(int x) { return x * 25; }
+inline int f7971_26(int x) { return x * 26; }
+inline int f7971_27(int x) { return x * 27; }
+inline int f7971_28(int x) { return x * 28; }
+inline int f7971_29(int x) { return x * 29; }
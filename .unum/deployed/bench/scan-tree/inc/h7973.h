@@ -0,0 +1,42 @@
+#pragma once
+/* header 7973 */
+#include <vector>
+#include "h650.h"
+#include "h7710.h"
+#include "h6034.h"
+#include "h5160.h"
+#include "h5474.h"
+#ifdef X
+#include "h7023.h"
+#endif
+struct S7973 { int a; const char *s = "x//y"; };
+inline int f7973_0(int x) { return x * 0; }
+inline int f7973_1(int x) { return x * 1; }
+inline int f7973_2(int x) { return x * 2; }
+inline int f7973_3(int x) { return x * 3; }
+inline int f7973_4(int x) { return x * 4; }
+inline int f7973_5(int x) { return x * 5; }
+inline int f7973_6(int x) { return x * 6; }
+inline int f7973_7(int x) { return x * 7; }
+inline int f7973_8(int x) { return x * 8; }
+inline int f7973_9(int x) { return x * 9; }
+inline int f7973_10(int x) { return x * 10; }
+inline int f7973_11(int x) { return x * 11; }
+inline int f7973_12(int x) { return x * 12; }
+inline int f7973_13(int x) { return x * 13; }
+inline int f7973_14(int x) { return x * 14; }
+inline int f7973_15(int x) { return x * 15; }
+inline int f7973_16(int x) { return x * 16; }
+inline int f7973_17(int x) { return x * 17; }
+inline int f7973_18(int x) { return x * 18; }
+inline int f7973_19(int x) { return x * 19; }
+inline int f7973_20(int x) { return x * 20; }
+inline int f7973_21(int x) { return x * 21; }
+inline int f7973_22(int x) { return x * 22; }
+inline int f7973_23(int x) { return x * 23; }
+inline int f7973_24(int x) { return x * 24; }
+inline int f7973_25(int x) { return x * 25; }
+inline int f7973_26(int x) { return x * 26; }
+inline int f7973_27(int x) { return x * 27; }
+inline int f7973_28(int x) { return x * 28; }
+inline int f7973_29(int x) { return x * 29; }
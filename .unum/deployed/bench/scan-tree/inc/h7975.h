@@ -0,0 +1,42 @@
+#pragma once
+/* header 7975 */
+#include <vector>
+#include "h8105.h"
+#include "h9452.h"
+#include "h1931.h"
+#include "h8791.h"
+#include "h686.h"
+#ifdef X
+#include "h618.h"
+#endif
+struct S7975 { int a; const char *s = "x//y"; };
+inline int f7975_0(int x) { return x * 0; }
+inline int f7975_1(int x) { return x * 1; }
+inline int f7975_2(int x) { return x * 2; }
+inline int f7975_3(int x) { return x * 3; }
+inline int f7975_4(int x) { return x * 4; }
+inline int f7975_5(int x) { return x * 5; }
+inline int f7975_6(int x) { return x * 6; }
+inline int f7975_7(int x) { return x * 7; }
+inline int f7975_8(int x) { return x * 8; }
+inline int f7975_9(int x) { return x * 9; }
+inline int f7975_10(int x) { return x * 10; }
+inline int f7975_11(int x) { return x * 11; }
+inline int f7975_12(int x) { return x * 12; }
+inline int f7975_13(int x) { return x * 13; }
+inline int f7975_14(int x) { return x * 14; }
+inline int f7975_15(int x) { return x * 15; }
+inline int f7975_16(int x) { return x * 16; }
+inline int f7975_17(int x) { return x * 17; }
+inline int f7975_18(int x) { return x * 18; }
+inline int f7975_19(int x) { return x * 19; }
+inline int f7975_20(int x) { return x * 20; }
+inline int f7975_21(int x) { return x * 21; }
+inline int f7975_22(int x) { return x * 22; }
+inline int f7975_23(int x) { return x * 23; }
+inline int f7975_24(int x) { return x * 24; }
+inline int f7975_25(int x) { return x * 25; }
+inline int f7975_26(int x) { return x * 26; }
+inline int f7975_27(int x) { return x * 27; }
+inline int f7975_28(int x) { return x * 28; }
+inline int f7975_29(int x) { return x * 29; }
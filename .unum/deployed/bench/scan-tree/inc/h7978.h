@@ -0,0 +1,42 @@
+#pragma once
+/* header 7978 */
+#include <vector>
+#include "h6644.h"
+#include "h5981.h"
+#include "h2819.h"
+#include "h2296.h"
+#include "h1282.h"
+#ifdef X
+#include "h1605.h"
+#endif
+struct S7978 { int a; const char *s = "x//y"; };
+inline int f7978_0(int x) { return x * 0; }
+inline int f7978_1(int x) { return x * 1; }
+inline int f7978_2(int x) { return x * 2; }
+inline int f7978_3(int x) { return x * 3; }
+inline int f7978_4(int x) { return x * 4; }
+inline int f7978_5(int x) { return x * 5; }
+inline int f7978_6(int x) { return x * 6; }
+inline int f7978_7(int x) { return x * 7; }
+inline int f7978_8(int x) { return x * 8; }
+inline int f7978_9(int x) { return x * 9; }
+inline int f7978_10(int x) { return x * 10; }
+inline int f7978_11(int x) { return x * 11; }
+inline int f7978_12(int x) { return x * 12; }
+inline int f7978_13(int x) { return x * 13; }
+inline int f7978_14(int x) { return x * 14; }
+inline int f7978_15(int x) { return x * 15; }
+inline int f7978_16(int x) { return x * 16; }
+inline int f7978_17(int x) { return x * 17; }
+inline int f7978_18(int x) { return x * 18; }
+inline int f7978_19(int x) { return x * 19; }
+inline int f7978_20(int x) { return x * 20; }
+inline int f7978_21(int x) { return x * 21; }
+inline int f7978_22(int x) { return x * 22; }
+inline int f7978_23(int x) { return x * 23; }
+inline int f7978_24(int x) { return x * 24; }
+inline int f7978_25(int x) { return x * 25; }
+inline int f7978_26(int x) { return x * 26; }
+inline int f7978_27(int x) { return x * 27; }
+inline int f7978_28(int x) { return x * 28; }
+inline int f7978_29(int x) { return x * 29; }
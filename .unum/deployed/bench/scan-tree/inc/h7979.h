@@ -0,0 +1,42 @@
+#pragma once
+/* header 7979 */
+#include <vector>
+#include "h5791.h"
+#include "h4871.h"
+#include "h500.h"
+#include "h9251.h"
+#include "h15.h"
+#ifdef X
+#include "h4222.h"
+#endif
+struct S7979 { int a; const char *s = "x//y"; };
+inline int f7979_0(int x) { return x * 0; }
+inline int f7979_1(int x) { return x * 1; }
+inline int f7979_2(int x) { return x * 2; }
+inline int f7979_3(int x) { return x * 3; }
+inline int f7979_4(int x) { return x * 4; }
+inline int f7979_5(int x) { return x * 5; }
+inline int f7979_6(int x) { return x * 6; }
+inline int f7979_7(int x) { return x * 7; }
+inline int f7979_8(int x) { return x * 8; }
+inline int f7979_9(int x) { return x * 9; }
+inline int f7979_10(int x) { return x * 10; }
+inline int f7979_11(int x) { return x * 11; }
+inline int f7979_12(int x) { return x * 12; }
+inline int f7979_13(int x) { return x * 13; }
+inline int f7979_14(int x) { return x * 14; }
+inline int f7979_15(int x) { return x * 15; }
+inline int f7979_16(int x) { return x * 16; }
+inline int f7979_17(int x) { return x * 17; }
+inline int f7979_18(int x) { return x * 18; }
+inline int f7979_19(int x) { return x * 19; }
+inline int f7979_20(int x) { return x * 20; }
+inline int f7979_21(int x) { return x * 21; }
+inline int f7979_22(int x) { return x * 22; }
+inline int f7979_23(int x) { return x * 23; }
+inline int f7979_24(int x) { return x * 24; }
+inline int f7979_25(int x) { return x * 25; }
+inline int f7979_26(int x) { return x * 26; }
+inline int f7979_27(int x) { return x * 27; }
+inline int f7979_28(int x) { return x * 28; }
+inline int f7979_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 798 */
+#include <vector>
+#include "h2432.h"
+#include "h2928.h"
+#include "h778.h"
+#include "h5110.h"
+#include "h8323.h"
+#ifdef X
+#include "h2287.h"
+#endif
+struct S798 { int a; const char *s = "x//y"; };
+inline int f798_0(int x) { return x * 0; }
+inline int f798_1(int x) { return x * 1; }
+inline int f798_2(int x) { return x * 2; }
+inline int f798_3(int x) { return x * 3; }
+inline int f798_4(int x) { return x * 4; }
+inline int f798_5(int x) { return x * 5; }
+inline int f798_6(int x) { return x * 6; }
+inline int f798_7(int x) { return x * 7; }
+inline int f798_8(int x) { return x * 8; }
+inline int f798_9(int x) { return x * 9; }
+inline int f798_10(int x) { return x * 10; }
+inline int f798_11(int x) { return x * 11; }
+inline int f798_12(int x) { return x * 12; }
+inline int f798_13(int x) { return x * 13; }
+inline int f798_14(int x) { return x * 14; }
+inline int f798_15(int x) { return x * 15; }
+inline int f798_16(int x) { return x * 16; }
+inline int f798_17(int x) { return x * 17; }
+inline int f798_18(int x) { return x * 18; }
+inline int f798_19(int x) { return x * 19; }
+inline int f798_20(int x) { return x * 20; }
+inline int f798_21(int x) { return x * 21; }
+inline int f798_22(int x) { return x * 22; }
+inline int f798_23(int x) { return x * 23; }
+inline int f798_24(int x) { return x * 24; }
+inline int f798_25(int x) { return x * 25; }
+inline int f798_26(int x) { return x * 26; }
+inline int f798_27(int x) { return x * 27; }
+inline int f798_28(int x) { return x * 28; }
+inline int f798_29(int x) { return x * 29; }
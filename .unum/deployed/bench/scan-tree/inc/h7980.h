@@ -0,0 +1,42 @@
+#pragma once
+/* header 7980 */
+#include <vector>
+#include "h4230.h"
+#include "h161.h"
+#include "h9223.h"
+#include "h9224.h"
+#include "h2304.h"
+#ifdef X
+#include "h6924.h"
+#endif
+struct S7980 { int a; const char *s = "x//y"; };
+inline int f7980_0(int x) { return x * 0; }
+inline int f7980_1(int x) { return x * 1; }
+inline int f7980_2(int x) { return x * 2; }
+inline int f7980_3(int x) { return x * 3; }
+inline int f7980_4(int x) { return x * 4; }
+inline int f7980_5(int x) { return x * 5; }
+inline int f7980_6(int x) { return x * 6; }
+inline int f7980_7(int x) { return x * 7; }
+inline int f7980_8(int x) { return x * 8; }
+inline int f7980_9(int x) { return x * 9; }
+inline int f7980_10(int x) { return x * 10; }
+inline int f7980_11(int x) { return x * 11; }
+inline int f7980_12(int x) { return x * 12; }
+inline int f7980_13(int x) { return x * 13; }
+inline int f7980_14(int x) { return x * 14; }
+inline int f7980_15(int x) { return x * 15; }
+inline int f7980_16(int x) { return x * 16; }
+inline int f7980_17(int x) { return x * 17; }
+inline int f7980_18(int x) { return x * 18; }
+inline int f7980_19(int x) { return x * 19; }
+inline int f7980_20(int x) { return x * 20; }
+inline int f7980_21(int x) { return x * 21; }
+inline int f7980_22(int x) { return x * 22; }
+inline int f7980_23(int x) { return x * 23; }
+inline int f7980_24(int x) { return x * 24; }
+inline int f7980_25(int x) { return x * 25; }
+inline int f7980_26(int x) { return x * 26; }
+inline int f7980_27(int x) { return x * 27; }
+inline int f7980_28(int x) { return x * 28; }
+inline int f7980_29(int x) { return x * 29; }
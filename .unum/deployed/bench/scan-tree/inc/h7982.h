@@ -0,0 +1,42 @@
+#pragma once
+/* header 7982 */
+#include <vector>
+#include "h364.h"
+#include "h3457.h"
+#include "h7401.h"
+#include "h5030.h"
+#include "h1362.h"
+#ifdef X
+#include "h6383.h"
+#endif
+struct S7982 { int a; const char *s = "x//y"; };
+inline int f7982_0(int x) { return x * 0; }
+inline int f7982_1(int x) { return x * 1; }
+inline int f7982_2(int x) { return x * 2; }
+inline int f7982_3(int x) { return x * 3; }
+inline int f7982_4(int x) { return x * 4; }
+inline int f7982_5(int x) { return x * 5; }
+inline int f7982_6(int x) { return x * 6; }
+inline int f7982_7(int x) { return x * 7; }
+inline int f7982_8(int x) { return x * 8; }
+inline int f7982_9(int x) { return x * 9; }
+inline int f7982_10(int x) { return x * 10; }
+inline int f7982_11(int x) { return x * 11; }
+inline int f7982_12(int x) { return x * 12; }
+inline int f7982_13(int x) { return x * 13; }
+inline int f7982_14(int x) { return x * 14; }
+inline int f7982_15(int x) { return x * 15; }
+inline int f7982_16(int x) { return x * 16; }
+inline int f7982_17(int x) { return x * 17; }
+inline int f7982_18(int x) { return x * 18; }
+inline int f7982_19(int x) { return x * 19; }
+inline int f7982_20(int x) { return x * 20; }
+inline int f7982_21(int x) { return x * 21; }
+inline int f7982_22(int x) { return x * 22; }
+inline int f7982_23(int x) { return x * 23; }
+inline int f7982_24(int x) { return x * 24; }
+inline int f7982_25(int x) { return x * 25; }
+inline int f7982_26(int x) { return x * 26; }
+inline int f7982_27(int x) { return x * 27; }
+inline int f7982_28(int x) { return x * 28; }
+inline int f7982_29(int x) { return x * 29; }
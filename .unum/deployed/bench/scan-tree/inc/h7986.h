@@ -0,0 +1,42 @@
+#pragma once
+/* header 7986 */
+#include <vector>
+#include "h7666.h"
+#include "h2367.h"
+#include "h4608.h"
+#include "h2418.h"
+#include "h6774.h"
+#ifdef X
+#include "h9392.h"
+#endif
+struct S7986 { int a; const char *s = "x//y"; };
+inline int f7986_0(int x) { return x * 0; }
+inline int f7986_1(int x) { return x * 1; }
+inline int f7986_2(int x) { return x * 2; }
+inline int f7986_3(int x) { return x * 3; }
+inline int f7986_4(int x) { return x * 4; }
+inline int f7986_5(int x) { return x * 5; }
+inline int f7986_6(int x) { return x * 6; }
+inline int f7986_7(int x) { return x * 7; }
+inline int f7986_8(int x) { return x * 8; }
+inline int f7986_9(int x) { return x * 9; }
+inline int f7986_10(int x) { return x * 10; }
+inline int f7986_11(int x) { return x * 11; }
+inline int f7986_12(int x) { return x * 12; }
+inline int f7986_13(int x) { return x * 13; }
+inline int f7986_14(int x) { return x * 14; }
+inline int f7986_15(int x) { return x * 15; }
+inline int f7986_16(int x) { return x * 16; }
+inline int f7986_17(int x) { return x * 17; }
+inline int f7986_18(int x) { return x * 18; }
+inline int f7986_19(int x) { return x * 19; }
+inline int f7986_20(int x) { return x * 20; }
+inline int f7986_21(int x) { return x * 21; }
+inline int f7986_22(int x) { return x * 22; }
+inline int f7986_23(int x) { return x * 23; }
+inline int f7986_24(int x) { return x * 24; }
+inline int f7986_25(int x) { return x * 25; }
+inline int f7986_26(int x) { return x * 26; }
+inline int f7986_27(int x) { return x * 27; }
+inline int f7986_28(int x) { return x * 28; }
+inline int f7986_29(int x) { return x * 29; }
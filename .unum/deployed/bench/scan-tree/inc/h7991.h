@@ -0,0 +1,42 @@
+#pragma once
+/* header 7991 */
+#include <vector>
+#include "h3743.h"
+#include "h7114.h"
+#include "h1598.h"
+#include "h5434.h"
+#include "h7595.h"
+#ifdef X
+#include "h2514.h"
+#endif
+struct S7991 { int a; const char *s = "x//y"; };
+inline int f7991_0(int x) { return x * 0; }
+inline int f7991_1(int x) { return x * 1; }
+inline int f7991_2(int x) { return x * 2; }
+inline int f7991_3(int x) { return x * 3; }
+inline int f7991_4(int x) { return x * 4; }
+inline int f7991_5(int x) { return x * 5; }
+inline int f7991_6(int x) { return x * 6; }
+inline int f7991_7(int x) { return x * 7; }
+inline int f7991_8(int x) { return x * 8; }
+inline int f7991_9(int x) { return x * 9; }
+inline int f7991_10(int x) { return x * 10; }
+inline int f7991_11(int x) { return x * 11; }
+inline int f7991_12(int x) { return x * 12; }
+inline int f7991_13(int x) { return x * 13; }
+inline int f7991_14(int x) { return x * 14; }
+inline int f7991_15(int x) { return x * 15; }
+inline int f7991_16(int x) { return x * 16; }
+inline int f7991_17(int x) { return x * 17; }
+inline int f7991_18(int x) { return x * 18; }
+inline int f7991_19(int x) { return x * 19; }
+inline int f7991_20(int x) { return x * 20; }
+inline int f7991_21(int x) { return x * 21; }
+inline int f7991_22(int x) { return x * 22; }
+inline int f7991_23(int x) { return x * 23; }
+inline int f7991_24(int x) { return x * 24; }
+inline int f7991_25(int x) { return x * 25; }
+inline int f7991_26(int x) { return x * 26; }
+inline int f7991_27(int x) { return x * 27; }
+inline int f7991_28(int x) { return x * 28; }
+inline int f7991_29(int x) { return x * 29; }
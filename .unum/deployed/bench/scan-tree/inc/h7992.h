@@ -0,0 +1,42 @@
+#pragma once
+/* header 7992 */
+#include <vector>
+#include "h685.h"
+#include "h3379.h"
+#include "h1426.h"
+#include "h6275.h"
+#include "h2859.h"
+#ifdef X
+#include "h6930.h"
+#endif
+struct S7992 { int a; const char *s = "x//y"; };
+inline int f7992_0(int x) { return x * 0; }
+inline int f7992_1(int x) { return x * 1; }
+inline int f7992_2(int x) { return x * 2; }
+inline int f7992_3(int x) { return x * 3; }
+inline int f7992_4(int x) { return x * 4; }
+inline int f7992_5(int x) { return x * 5; }
+inline int f7992_6(int x) { return x * 6; }
+inline int f7992_7(int x) { return x * 7; }
+inline int f7992_8(int x) { return x * 8; }
+inline int f7992_9(int x) { return x * 9; }
+inline int f7992_10(int x) { return x * 10; }
+inline int f7992_11(int x) { return x * 11; }
+inline int f7992_12(int x) { return x * 12; }
+inline int f7992_13(int x) { return x * 13; }
+inline int f7992_14(int x) { return x * 14; }
+inline int f7992_15(int x) { return x * 15; }
+inline int f7992_16(int x) { return x * 16; }
+inline int f7992_17(int x) { return x * 17; }
+inline int f7992_18(int x) { return x * 18; }
+inline int f7992_19(int x) { return x * 19; }
+inline int f7992_20(int x) { return x * 20; }
+inline int f7992_21(int x) { return x * 21; }
+inline int f7992_22(int x) { return x * 22; }
+inline int f7992_23(int x) { return x * 23; }
+inline int f7992_24(int x) { return x * 24; }
+inline int f7992_25(int x) { return x * 25; }
+inline int f7992_26(int x) { return x * 26; }
+inline int f7992_27(int x) { return x * 27; }
+inline int f7992_28(int x) { return x * 28; }
+inline int f7992_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7993 */
+#include <vector>
+#include "h9827.h"
+#include "h7986.h"
+#include "h7372.h"
+#include "h3503.h"
+#include "h4279.h"
+#ifdef X
+#include "h6616.h"
+#endif
+struct S7993 { int a; const char *s = "x//y"; };
+inline int f7993_0(int x) { return x * 0; }
+inline int f7993_1(int x) { return x * 1; }
+inline int f7993_2(int x) { return x * 2; }
+inline int f7993_3(int x) { return x * 3; }
+inline int f7993_4(int x) { return x * 4; }
+inline int f7993_5(int x) { return x * 5; }
+inline int f7993_6(int x) { return x * 6; }
+inline int f7993_7(int x) { return x * 7; }
+inline int f7993_8(int x) { return x * 8; }
+inline int f7993_9(int x) { return x * 9; }
+inline int f7993_10(int x) { return x * 10; }
+inline int f7993_11(int x) { return x * 11; }
+inline int f7993_12(int x) { return x * 12; }
+inline int f7993_13(int x) { return x * 13; }
+inline int f7993_14(int x) { return x * 14; }
+inline int f7993_15(int x) { return x * 15; }
+inline int f7993_16(int x) { return x * 16; }
+inline int f7993_17(int x) { return x * 17; }
+inline int f7993_18(int x) { return x * 18; }
+inline int f7993_19(int x) { return x * 19; }
+inline int f7993_20(int x) { return x * 20; }
+inline int f7993_21(int x) { return x * 21; }
+inline int f7993_22(int x) { return x * 22; }
+inline int f7993_23(int x) { return x * 23; }
+inline int f7993_24(int x) { return x * 24; }
+inline int f7993_25(int x) { return x * 25; }
+inline int f7993_26(int x) { return x * 26; }
+inline int f7993_27(int x) { return x * 27; }
+inline int f7993_28(int x) { return x * 28; }
+inline int f7993_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 7998 */
+#include <vector>
+#include "h2821.h"
+#include "h6424.h"
+#include "h4538.h"
+#include "h2669.h"
+#include "h8763.h"
+#ifdef X
+#include "h6037.h"
+#endif
+struct S7998 { int a; const char *s = "x//y"; };
+inline int f7998_0(int x) { return x * 0; }
+inline int f7998_1(int x) { return x * 1; }
+inline int f7998_2(int x) { return x * 2; }
+inline int f7998_3(int x) { return x * 3; }
+inline int f7998_4(int x) { return x * 4; }
+inline int f7998_5(int x) { return x * 5; }
+inline int f7998_6(int x) { return x * 6; }
+inline int f7998_7(int x) { return x * 7; }
+inline int f7998_8(int x) { return x * 8; }
+inline int f7998_9(int x) { return x * 9; }
+inline int f7998_10(int x) { return x * 10; }
+inline int f7998_11(int x) { return x * 11; }
+inline int f7998_12(int x) { return x * 12; }
+inline int f7998_13(int x) { return x * 13; }
+inline int f7998_14(int x) { return x * 14; }
+inline int f7998_15(int x) { return x * 15; }
+inline int f7998_16(int x) { return x * 16; }
+inline int f7998_17(int x) { return x * 17; }
+inline int f7998_18(int x) { return x * 18; }
+inline int f7998_19(int x) { return x * 19; }
+inline int f7998_20(int x) { return x * 20; }
+inline int f7998_21(int x) { return x * 21; }
+inline int f7998_22(int x) { return x * 22; }
+inline int f7998_23(int x) { return x * 23; }
+inline int f7998_24(int x) { return x * 24; }
+inline int f7998_25(int x) { return x * 25; }
+inline int f7998_26(int x) { return x * 26; }
+inline int f7998_27(int x) { return x * 27; }
+inline int f7998_28(int x) { return x * 28; }
+inline int f7998_29(int x) { return x * 29; }
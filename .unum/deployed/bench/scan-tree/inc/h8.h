@@ -0,0 +1,42 @@
+#pragma once
+/* header 8 */
+#include <vector>
+#include "h9568.h"
+#include "h8271.h"
+#include "h8886.h"
+#include "h3555.h"
+#include "h6242.h"
+#ifdef X
+#include "h7184.h"
+#endif
+struct S8 { int a; const char *s = "x//y"; };
+inline int f8_0(int x) { return x * 0; }
+inline int f8_1(int x) { return x * 1; }
+inline int f8_2(int x) { return x * 2; }
+inline int f8_3(int x) { return x * 3; }
+inline int f8_4(int x) { return x * 4; }
+inline int f8_5(int x) { return x * 5; }
+inline int f8_6(int x) { return x * 6; }
+inline int f8_7(int x) { return x * 7; }
+inline int f8_8(int x) { return x * 8; }
+inline int f8_9(int x) { return x * 9; }
+inline int f8_10(int x) { return x * 10; }
+inline int f8_11(int x) { return x * 11; }
+inline int f8_12(int x) { return x * 12; }
+inline int f8_13(int x) { return x * 13; }
+inline int f8_14(int x) { return x * 14; }
+inline int f8_15(int x) { return x * 15; }
+inline int f8_16(int x) { return x * 16; }
+inline int f8_17(int x) { return x * 17; }
+inline int f8_18(int x) { return x * 18; }
+inline int f8_19(int x) { return x * 19; }
+inline int f8_20(int x) { return x * 20; }
+inline int f8_21(int x) { return x * 21; }
+inline int f8_22(int x) { return x * 22; }
+inline int f8_23(int x) { return x * 23; }
+inline int f8_24(int x) { return x * 24; }
+inline int f8_25(int x) { return x * 25; }
+inline int f8_26(int x) { return x * 26; }
+inline int f8_27(int x) { return x * 27; }
+inline int f8_28(int x) { return x * 28; }
+inline int f8_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 80 */
+#include <vector>
+#include "h769.h"
+#include "h2046.h"
+#include "h6473.h"
+#include "h8905.h"
+#include "h9466.h"
+#ifdef X
+#include "h9843.h"
+#endif
+struct S80 { int a; const char *s = "x//y"; };
+inline int f80_0(int x) { return x * 0; }
+inline int f80_1(int x) { return x * 1; }
+inline int f80_2(int x) { return x * 2; }
+inline int f80_3(int x) { return x * 3; }
+inline int f80_4(int x) { return x * 4; }
+inline int f80_5(int x) { return x * 5; }
+inline int f80_6(int x) { return x * 6; }
+inline int f80_7(int x) { return x * 7; }
+inline int f80_8(int x) { return x * 8; }
+inline int f80_9(int x) { return x * 9; }
+inline int f80_10(int x) { return x * 10; }
+inline int f80_11(int x) { return x * 11; }
+inline int f80_12(int x) { return x * 12; }
+inline int f80_13(int x) { return x * 13; }
+inline int f80_14(int x) { return x * 14; }
+inline int f80_15(int x) { return x * 15; }
+inline int f80_16(int x) { return x * 16; }
+inline int f80_17(int x) { return x * 17; }
+inline int f80_18(int x) { return x * 18; }
+inline int f80_19(int x) { return x * 19; }
+inline int f80_20(int x) { return x * 20; }
+inline int f80_21(int x) { return x * 21; }
+inline int f80_22(int x) { return x * 22; }
+inline int f80_23(int x) { return x * 23; }
+inline int f80_24(int x) { return x * 24; }
+inline int f80_25(int x) { return x * 25; }
+inline int f80_26(int x) { return x * 26; }
+inline int f80_27(int x) { return x * 27; }
+inline int f80_28(int x) { return x * 28; }
+inline int f80_29(int x) { return x * 29; }
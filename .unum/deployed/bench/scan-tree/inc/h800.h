@@ -0,0 +1,42 @@
+#pragma once
+/* header 800 */
+#include <vector>
+#include "h6563.h"
+#include "h4019.h"
+#include "h9330.h"
+#include "h8939.h"
+#include "h8414.h"
+#ifdef X
+#include "h2187.h"
+#endif
+struct S800 { int a; const char *s = "x//y"; };
+inline int f800_0(int x) { return x * 0; }
+inline int f800_1(int x) { return x * 1; }
+inline int f800_2(int x) { return x * 2; }
+inline int f800_3(int x) { return x * 3; }
+inline int f800_4(int x) { return x * 4; }
+inline int f800_5(int x) { return x * 5; }
+inline int f800_6(int x) { return x * 6; }
+inline int f800_7(int x) { return x * 7; }
+inline int f800_8(int x) { return x * 8; }
+inline int f800_9(int x) { return x * 9; }
+inline int f800_10(int x) { return x * 10; }
+inline int f800_11(int x) { return x * 11; }
+inline int f800_12(int x) { return x * 12; }
+inline int f800_13(int x) { return x * 13; }
+inline int f800_14(int x) { return x * 14; }
+inline int f800_15(int x) { return x * 15; }
+inline int f800_16(int x) { return x * 16; }
+inline int f800_17(int x) { return x * 17; }
+inline int f800_18(int x) { return x * 18; }
+inline int f800_19(int x) { return x * 19; }
+inline int f800_20(int x) { return x * 20; }
+inline int f800_21(int x) { return x * 21; }
+inline int f800_22(int x) { return x * 22; }
+inline int f800_23(int x) { return x * 23; }
+inline int f800_24(int x) { return x * 24; }
+inline int f800_25(int x) { return x * 25; }
+inline int f800_26(int x) { return x * 26; }
+inline int f800_27(int x) { return x * 27; }
+inline int f800_28(int x) { return x * 28; }
+inline int f800_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8001 */
+#include <vector>
+#include "h3153.h"
+#include "h6514.h"
+#include "h4534.h"
+#include "h3450.h"
+#include "h423.h"
+#ifdef X
+#include "h8677.h"
+#endif
+struct S8001 { int a; const char *s = "x//y"; };
+inline int f8001_0(int x) { return x * 0; }
+inline int f8001_1(int x) { return x * 1; }
+inline int f8001_2(int x) { return x * 2; }
+inline int f8001_3(int x) { return x * 3; }
+inline int f8001_4(int x) { return x * 4; }
+inline int f8001_5(int x) { return x * 5; }
+inline int f8001_6(int x) { return x * 6; }
+inline int f8001_7(int x) { return x * 7; }
+inline int f8001_8(int x) { return x * 8; }
+inline int f8001_9(int x) { return x * 9; }
+inline int f8001_10(int x) { return x * 10; }
+inline int f8001_11(int x) { return x * 11; }
+inline int f8001_12(int x) { return x * 12; }
+inline int f8001_13(int x) { return x * 13; }
+inline int f8001_14(int x) { return x * 14; }
+inline int f8001_15(int x) { return x * 15; }
+inline int f8001_16(int x) { return x * 16; }
+inline int f8001_17(int x) { return x * 17; }
+inline int f8001_18(int x) { return x * 18; }
+inline int f8001_19(int x) { return x * 19; }
+inline int f8001_20(int x) { return x * 20; }
+inline int f8001_21(int x) { return x * 21; }
+inline int f8001_22(int x) { return x * 22; }
+inline int f8001_23(int x) { return x * 23; }
+inline int f8001_24(int x) { return x * 24; }
+inline int f8001_25(int x) { return x * 25; }
+inline int f8001_26(int x) { return x * 26; }
+inline int f8001_27(int x) { return x * 27; }
+inline int f8001_28(int x) { return x * 28; }
+inline int f8001_29(int x) { return x * 29; }
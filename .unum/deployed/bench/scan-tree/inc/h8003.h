@@ -0,0 +1,42 @@
+#pragma once
+/* header 8003 */
+#include <vector>
+#include "h5798.h"
+#include "h4370.h"
+#include "h3514.h"
+#include "h4730.h"
+#include "h5533.h"
+#ifdef X
+#include "h634.h"
+#endif
+struct S8003 { int a; const char *s = "x//y"; };
+inline int f8003_0(int x) { return x * 0; }
+inline int f8003_1(int x) { return x * 1; }
+inline int f8003_2(int x) { return x * 2; }
+inline int f8003_3(int x) { return x * 3; }
+inline int f8003_4(int x) { return x * 4; }
+inline int f8003_5(int x) { return x * 5; }
+inline int f8003_6(int x) { return x * 6; }
+inline int f8003_7(int x) { return x * 7; }
+inline int f8003_8(int x) { return x * 8; }
+inline int f8003_9(int x) { return x * 9; }
+inline int f8003_10(int x) { return x * 10; }
+inline int f8003_11(int x) { return x * 11; }
+inline int f8003_12(int x) { return x * 12; }
+inline int f8003_13(int x) { return x * 13; }
+inline int f8003_14(int x) { return x * 14; }
+inline int f8003_15(int x) { return x * 15; }
+inline int f8003_16(int x) { return x * 16; }
+inline int f8003_17(int x) { return x * 17; }
+inline int f8003_18(int x) { return x * 18; }
+inline int f8003_19(int x) { return x * 19; }
+inline int f8003_20(int x) { return x * 20; }
+inline int f8003_21(int x) { return x * 21; }
+inline int f8003_22(int x) { return x * 22; }
+inline int f8003_23(int x) { return x * 23; }
+inline int f8003_24(int x) { return x * 24; }
+inline int f8003_25(int x) { return x * 25; }
+inline int f8003_26(int x) { return x * 26; }
+inline int f8003_27(int x) { return x * 27; }
+inline int f8003_28(int x) { return x * 28; }
+inline int f8003_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8006 */
+#include <vector>
+#include "h296.h"
+#include "h7559.h"
+#include "h1928.h"
+#include "h7107.h"
+#include "h8948.h"
+#ifdef X
+#include "h5155.h"
+#endif
+struct S8006 { int a; const char *s = "x//y"; };
+inline int f8006_0(int x) { return x * 0; }
+inline int f8006_1(int x) { return x * 1; }
+inline int f8006_2(int x) { return x * 2; }
+inline int f8006_3(int x) { return x * 3; }
+inline int f8006_4(int x) { return x * 4; }
+inline int f8006_5(int x) { return x * 5; }
+inline int f8006_6(int x) { return x * 6; }
+inline int f8006_7(int x) { return x * 7; }
+inline int f8006_8(int x) { return x * 8; }
+inline int f8006_9(int x) { return x * 9; }
+inline int f8006_10(int x) { return x * 10; }
+inline int f8006_11(int x) { return x * 11; }
+inline int f8006_12(int x) { return x * 12; }
+inline int f8006_13(int x) { return x * 13; }
+inline int f8006_14(int x) { return x * 14; }
+inline int f8006_15(int x) { return x * 15; }
+inline int f8006_16(int x) { return x * 16; }
+inline int f8006_17(int x) { return x * 17; }
+inline int f8006_18(int x) { return x * 18; }
+inline int f8006_19(int x) { return x * 19; }
+inline int f8006_20(int x) { return x * 20; }
+inline int f8006_21(int x) { return x * 21; }
+inline int f8006_22(int x) { return x * 22; }
+inline int f8006_23(int x) { return x * 23; }
+inline int f8006_24(int x) { return x * 24; }
+inline int f8006_25(int x) { return x * 25; }
+inline int f8006_26(int x) { return x * 26; }
+inline int f8006_27(int x) { return x * 27; }
+inline int f8006_28(int x) { return x * 28; }
+inline int f8006_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8007 */
+#include <vector>
+#include "h3256.h"
+#include "h6266.h"
+#include "h2163.h"
+#include "h4303.h"
+#include "h6094.h"
+#ifdef X
+#include "h8609.h"
+#endif
+struct S8007 { int a; const char *s = "x//y"; };
+inline int f8007_0(int x) { return x * 0; }
+inline int f8007_1(int x) { return x * 1; }
+inline int f8007_2(int x) { return x * 2; }
+inline int f8007_3(int x) { return x * 3; }
+inline int f8007_4(int x) { return x * 4; }
+inline int f8007_5(int x) { return x * 5; }
+inline int f8007_6(int x) { return x * 6; }
+inline int f8007_7(int x) { return x * 7; }
+inline int f8007_8(int x) { return x * 8; }
+inline int f8007_9(int x) { return x * 9; }
+inline int f8007_10(int x) { return x * 10; }
+inline int f8007_11(int x) { return x * 11; }
+inline int f8007_12(int x) { return x * 12; }
+inline int f8007_13(int x) { return x * 13; }
+inline int f8007_14(int x) { return x * 14; }
+inline int f8007_15(int x) { return x * 15; }
+inline int f8007_16(int x) { return x * 16; }
+inline int f8007_17(int x) { return x * 17; }
+inline int f8007_18(int x) { return x * 18; }
+inline int f8007_19(int x) { return x * 19; }
+inline int f8007_20(int x) { return x * 20; }
+inline int f8007_21(int x) { return x * 21; }
+inline int f8007_22(int x) { return x * 22; }
+inline int f8007_23(int x) { return x * 23; }
+inline int f8007_24(int x) { return x * 24; }
+inline int f8007_25(int x) { return x * 25; }
+inline int f8007_26(int x) { return x * 26; }
+inline int f8007_27(int x) { return x * 27; }
+inline int f8007_28(int x) { return x * 28; }
+inline int f8007_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8009 */
+#include <vector>
+#include "h6058.h"
+#include "h9575.h"
+#include "h4981.h"
+#include "h3398.h"
+#include "h1475.h"
+#ifdef X
+#include "h1315.h"
+#endif
+struct S8009 { int a; const char *s = "x//y"; };
+inline int f8009_0(int x) { return x * 0; }
+inline int f8009_1(int x) { return x * 1; }
+inline int f8009_2(int x) { return x * 2; }
+inline int f8009_3(int x) { return x * 3; }
+inline int f8009_4(int x) { return x * 4; }
+inline int f8009_5(int x) { return x * 5; }
+inline int f8009_6(int x) { return x * 6; }
+inline int f8009_7(int x) { return x * 7; }
+inline int f8009_8(int x) { return x * 8; }
+inline int f8009_9(int x) { return x * 9; }
+inline int f8009_10(int x) { return x * 10; }
+inline int f8009_11(int x) { return x * 11; }
+inline int f8009_12(int x) { return x * 12; }
+inline int f8009_13(int x) { return x * 13; }
+inline int f8009_14(int x) { return x * 14; }
+inline int f8009_15(int x) { return x * 15; }
+inline int f8009_16(int x) { return x * 16; }
+inline int f8009_17(int x) { return x * 17; }
+inline int f8009_18(int x) { return x * 18; }
+inline int f8009_19(int x) { return x * 19; }
+inline int f8009_20(int x) { return x * 20; }
+inline int f8009_21(int x) { return x * 21; }
+inline int f8009_22(int x) { return x * 22; }
+inline int f8009_23(int x) { return x * 23; }
+inline int f8009_24(int x) { return x * 24; }
+inline int f8009_25(int x) { return x * 25; }
+inline int f8009_26(int x) { return x * 26; }
+inline int f8009_27(int x) { return x * 27; }
+inline int f8009_28(int x) { return x * 28; }
+inline int f8009_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8011 */
+#include <vector>
+#include "h3507.h"
+#include "h7120.h"
+#include "h9107.h"
+#include "h587.h"
+#include "h7352.h"
+#ifdef X
+#include "h1206.h"
+#endif
+struct S8011 { int a; const char *s = "x//y"; };
+inline int f8011_0(int x) { return x * 0; }
+inline int f8011_1(int x) { return x * 1; }
+inline int f8011_2(int x) { return x * 2; }
+inline int f8011_3(int x) { return x * 3; }
+inline int f8011_4(int x) { return x * 4; }
+inline int f8011_5(int x) { return x * 5; }
+inline int f8011_6(int x) { return x * 6; }
+inline int f8011_7(int x) { return x * 7; }
+inline int f8011_8(int x) { return x * 8; }
+inline int f8011_9(int x) { return x * 9; }
+inline int f8011_10(int x) { return x * 10; }
+inline int f8011_11(int x) { return x * 11; }
+inline int f8011_12(int x) { return x * 12; }
+inline int f8011_13(int x) { return x * 13; }
+inline int f8011_14(int x) { return x * 14; }
+inline int f8011_15(int x) { return x * 15; }
+inline int f8011_16(int x) { return x * 16; }
+inline int f8011_17(int x) { return x * 17; }
+inline int f8011_18(int x) { return x * 18; }
+inline int f8011_19(int x) { return x * 19; }
+inline int f8011_20(int x) { return x * 20; }
+inline int f8011_21(int x) { return x * 21; }
+inline int f8011_22(int x) { return x * 22; }
+inline int f8011_23(int x) { return x * 23; }
+inline int f8011_24(int x) { return x * 24; }
+inline int f8011_25(int x) { return x * 25; }
+inline int f8011_26(int x) { return x * 26; }
+inline int f8011_27(int x) { return x * 27; }
+inline int f8011_28(int x) { return x * 28; }
+inline int f8011_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8012 */
+#include <vector>
+#include "h452.h"
+#include "h2629.h"
+#include "h7364.h"
+#include "h2342.h"
+#include "h3983.h"
+#ifdef X
+#include "h1490.h"
+#endif
+struct S8012 { int a; const char *s = "x//y"; };
+inline int f8012_0(int x) { return x * 0; }
+inline int f8012_1(int x) { return x * 1; }
+inline int f8012_2(int x) { return x * 2; }
+inline int f8012_3(int x) { return x * 3; }
+inline int f8012_4(int x) { return x * 4; }
+inline int f8012_5(int x) { return x * 5; }
+inline int f8012_6(int x) { return x * 6; }
+inline int f8012_7(int x) { return x * 7; }
+inline int f8012_8(int x) { return x * 8; }
+inline int f8012_9(int x) { return x * 9; }
+inline int f8012_10(int x) { return x * 10; }
+inline int f8012_11(int x) { return x * 11; }
+inline int f8012_12(int x) { return x * 12; }
+inline int f8012_13(int x) { return x * 13; }
+inline int f8012_14(int x) { return x * 14; }
+inline int f8012_15(int x) { return x * 15; }
+inline int f8012_16(int x) { return x * 16; }
+inline int f8012_17(int x) { return x * 17; }
+inline int f8012_18(int x) { return x * 18; }
+inline int f8012_19(int x) { return x * 19; }
+inline int f8012_20(int x) { return x * 20; }
+inline int f8012_21(int x) { return x * 21; }
+inline int f8012_22(int x) { return x * 22; }
+inline int f8012_23(int x) { return x * 23; }
+inline int f8012_24(int x) { return x * 24; }
+inline int f8012_25(int x) { return x * 25; }
+inline int f8012_26(int x) { return x * 26; }
+inline int f8012_27(int x) { return x * 27; }
+inline int f8012_28(int x) { return x * 28; }
+inline int f8012_29(int x) { return x * 29; }
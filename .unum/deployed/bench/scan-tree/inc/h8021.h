@@ -0,0 +1,42 @@
+#pragma once
+/* header 8021 */
+#include <vector>
+#include "h809.h"
+#include "h7103.h"
+#include "h9270.h"
+#include "h9671.h"
+#include "h9005.h"
+#ifdef X
+#include "h7156.h"
+#endif
+struct S8021 { int a; const char *s = "x//y"; };
+inline int f8021_0(int x) { return x * 0; }
+inline int f8021_1(int x) { return x * 1; }
+inline int f8021_2(int x) { return x * 2; }
+inline int f8021_3(int x) { return x * 3; }
+inline int f8021_4(int x) { return x * 4; }
+inline int f8021_5(int x) { return x * 5; }
+inline int f8021_6(int x) { return x * 6; }
+inline int f8021_7(int x) { return x * 7; }
+inline int f8021_8(int x) { return x * 8; }
+inline int f8021_9(int x) { return x * 9; }
+inline int f8021_10(int x) { return x * 10; }
+inline int f8021_11(int x) { return x * 11; }
+inline int f8021_12(int x) { return x * 12; }
+inline int f8021_13(int x) { return x * 13; }
+inline int f8021_14(int x) { return x * 14; }
+inline int f8021_15(int x) { return x * 15; }
+inline int f8021_16(int x) { return x * 16; }
+inline int f8021_17(int x) { return x * 17; }
+inline int f8021_18(int x) { return x * 18; }
+inline int f8021_19(int x) { return x * 19; }
+inline int f8021_20(int x) { return x * 20; }
+inline int f8021_21(int x) { return x * 21; }
+inline int f8021_22(int x) { return x * 22; }
+inline int f8021_23(int x) { return x * 23; }
+inline int f8021_24(int x) { return x * 24; }
+inline int f8021_25(int x) { return x * 25; }
+inline int f8021_26(int x) { return x * 26; }
+inline int f8021_27(int x) { return x * 27; }
+inline int f8021_28(int x) { return x * 28; }
+inline int f8021_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8023 */
+#include <vector>
+#include "h651.h"
+#include "h809.h"
+#include "h8623.h"
+#include "h3081.h"
+#include "h4853.h"
+#ifdef X
+#include "h4050.h"
+#endif
+struct S8023 { int a; const char *s = "x//y"; };
+inline int f8023_0(int x) { return x * 0; }
+inline int f8023_1(int x) { return x * 1; }
+inline int f8023_2(int x) { return x * 2; }
+inline int f8023_3(int x) { return x * 3; }
+inline int f8023_4(int x) { return x * 4; }
+inline int f8023_5(int x) { return x * 5; }
+inline int f8023_6(int x) { return x * 6; }
+inline int f8023_7(int x) { return x * 7; }
+inline int f8023_8(int x) { return x * 8; }
+inline int f8023_9(int x) { return x * 9; }
+inline int f8023_10(int x) { return x * 10; }
+inline int f8023_11(int x) { return x * 11; }
+inline int f8023_12(int x) { return x * 12; }
+inline int f8023_13(int x) { return x * 13; }
+inline int f8023_14(int x) { return x * 14; }
+inline int f8023_15(int x) { return x * 15; }
+inline int f8023_16(int x) { return x * 16; }
+inline int f8023_17(int x) { return x * 17; }
+inline int f8023_18(int x) { return x * 18; }
+inline int f8023_19(int x) { return x * 19; }
+inline int f8023_20(int x) { return x * 20; }
+inline int f8023_21(int x) { return x * 21; }
+inline int f8023_22(int x) { return x * 22; }
+inline int f8023_23(int x) { return x * 23; }
+inline int f8023_24(int x) { return x * 24; }
+inline int f8023_25(int x) { return x * 25; }
+inline int f8023_26(int x) { return x * 26; }
+inline int f8023_27(int x) { return x * 27; }
+inline int f8023_28(int x) { return x * 28; }
+inline int f8023_29(int x) { return x * 29; }
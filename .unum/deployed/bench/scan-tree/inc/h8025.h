@@ -0,0 +1,42 @@
+#pragma once
+/* header 8025 */
+#include <vector>
+#include "h3636.h"
+#include "h3525.h"
+#include "h5508.h"
+#include "h3223.h"
+#include "h9669.h"
+#ifdef X
+#include "h1701.h"
+#endif
+struct S8025 { int a; const char *s = "x//y"; };
+inline int f8025_0(int x) { return x * 0; }
+inline int f8025_1(int x) { return x * 1; }
+inline int f8025_2(int x) { return x * 2; }
+inline int f8025_3(int x) { return x * 3; }
+inline int f8025_4(int x) { return x * 4; }
+inline int f8025_5(int x) { return x * 5; }
+inline int f8025_6(int x) { return x * 6; }
+inline int f8025_7(int x) { return x * 7; }
+inline int f8025_8(int x) { return x * 8; }
+inline int f8025_9(int x) { return x * 9; }
+inline int f8025_10(int x) { return x * 10; }
+inline int f8025_11(int x) { return x * 11; }
+inline int f8025_12(int x) { return x * 12; }
+inline int f8025_13(int x) { return x * 13; }
+inline int f8025_14(int x) { return x * 14; }
+inline int f8025_15(int x) { return x * 15; }
+inline int f8025_16(int x) { return x * 16; }
+inline int f8025_17(int x) { return x * 17; }
+inline int f8025_18(int x) { return x * 18; }
+inline int f8025_19(int x) { return x * 19; }
+inline int f8025_20(int x) { return x * 20; }
+inline int f8025_21(int x) { return x * 21; }
+inline int f8025_22(int x) { return x * 22; }
+inline int f8025_23(int x) { return x * 23; }
+inline int f8025_24(int x) { return x * 24; }
+inline int f8025_25(int x) { return x * 25; }
+inline int f8025_26(int x) { return x * 26; }
+inline int f8025_27(int x) { return x * 27; }
+inline int f8025_28(int x) { return x * 28; }
+inline int f8025_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8026 */
+#include <vector>
+#include "h5183.h"
+#include "h3164.h"
+#include "h642.h"
+#include "h7601.h"
+#include "h2879.h"
+#ifdef X
+#include "h9150.h"
+#endif
+struct S8026 { int a; const char *s = "x//y"; };
+inline int f8026_0(int x) { return x * 0; }
+inline int f8026_1(int x) { return x * 1; }
+inline int f8026_2(int x) { return x * 2; }
+inline int f8026_3(int x) { return x * 3; }
+inline int f8026_4(int x) { return x * 4; }
+inline int f8026_5(int x) { return x * 5; }
+inline int f8026_6(int x) { return x * 6; }
+inline int f8026_7(int x) { return x * 7; }
+inline int f8026_8(int x) { return x * 8; }
+inline int f8026_9(int x) { return x * 9; }
+inline int f8026_10(int x) { return x * 10; }
+inline int f8026_11(int x) { return x * 11; }
+inline int f8026_12(int x) { return x * 12; }
+inline int f8026_13(int x) { return x * 13; }
+inline int f8026_14(int x) { return x * 14; }
+inline int f8026_15(int x) { return x * 15; }
+inline int f8026_16(int x) { return x * 16; }
+inline int f8026_17(int x) { return x * 17; }
+inline int f8026_18(int x) { return x * 18; }
+inline int f8026_19(int x) { return x * 19; }
+inline int f8026_20(int x) { return x * 20; }
+inline int f8026_21(int x) { return x * 21; }
+inline int f8026_22(int x) { return x * 22; }
+inline int f8026_23(int x) { return x * 23; }
+inline int f8026_24(int x) { return x * 24; }
+inline int f8026_25(int x) { return x * 25; }
+inline int f8026_26(int x) { return x * 26; }
+inline int f8026_27(int x) { return x * 27; }
+inline int f8026_28(int x) { return x * 28; }
+inline int f8026_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8029 */
+#include <vector>
+#include "h8207.h"
+#include "h8814.h"
+#include "h9789.h"
+#include "h6800.h"
+#include "h5632.h"
+#ifdef X
+#include "h3259.h"
+#endif
+struct S8029 { int a; const char *s = "x//y"; };
+inline int f8029_0(int x) { return x * 0; }
+inline int f8029_1(int x) { return x * 1; }
+inline int f8029_2(int x) { return x * 2; }
+inline int f8029_3(int x) { return x * 3; }
+inline int f8029_4(int x) { return x * 4; }
+inline int f8029_5(int x) { return x * 5; }
+inline int f8029_6(int x) { return x * 6; }
+inline int f8029_7(int x) { return x * 7; }
+inline int f8029_8(int x) { return x * 8; }
+inline int f8029_9(int x) { return x * 9; }
+inline int f8029_10(int x) { return x * 10; }
+inline int f8029_11(int x) { return x * 11; }
+inline int f8029_12(int x) { return x * 12; }
+inline int f8029_13(int x) { return x * 13; }
+inline int f8029_14(int x) { return x * 14; }
+inline int f8029_15(int x) { return x * 15; }
+inline int f8029_16(int x) { return x * 16; }
+inline int f8029_17(int x) { return x * 17; }
+inline int f8029_18(int x) { return x * 18; }
+inline int f8029_19(int x) { return x * 19; }
+inline int f8029_20(int x) { return x * 20; }
+inline int f8029_21(int x) { return x * 21; }
+inline int f8029_22(int x) { return x * 22; }
+inline int f8029_23(int x) { return x * 23; }
+inline int f8029_24(int x) { return x * 24; }
+inline int f8029_25(int x) { return x * 25; }
+inline int f8029_26(int x) { return x * 26; }
+inline int f8029_27(int x) { return x * 27; }
+inline int f8029_28(int x) { return x * 28; }
+inline int f8029_29(int x) { return x * 29; }
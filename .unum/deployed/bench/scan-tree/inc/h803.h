@@ -0,0 +1,42 @@
+#pragma once
+/* header 803 */
+#include <vector>
+#include "h3213.h"
+#include "h6948.h"
+#include "h6903.h"
+#include "h7087.h"
+#include "h6998.h"
+#ifdef X
+#include "h4140.h"
+#endif
+struct S803 { int a; const char *s = "x//y"; };
+inline int f803_0(int x) { return x * 0; }
+inline int f803_1(int x) { return x * 1; }
+inline int f803_2(int x) { return x * 2; }
+inline int f803_3(int x) { return x * 3; }
+inline int f803_4(int x) { return x * 4; }
+inline int f803_5(int x) { return x * 5; }
+inline int f803_6(int x) { return x * 6; }
+inline int f803_7(int x) { return x * 7; }
+inline int f803_8(int x) { return x * 8; }
+inline int f803_9(int x) { return x * 9; }
+inline int f803_10(int x) { return x * 10; }
+inline int f803_11(int x) { return x * 11; }
+inline int f803_12(int x) { return x * 12; }
+inline int f803_13(int x) { return x * 13; }
+inline int f803_14(int x) { return x * 14; }
+inline int f803_15(int x) { return x * 15; }
+inline int f803_16(int x) { return x * 16; }
+inline int f803_17(int x) { return x * 17; }
+inline int f803_18(int x) { return x * 18; }
+inline int f803_19(int x) { return x * 19; }
+inline int f803_20(int x) { return x * 20; }
+inline int f803_21(int x) { return x * 21; }
+inline int f803_22(int x) { return x * 22; }
+inline int f803_23(int x) { return x * 23; }
+inline int f803_24(int x) { return x * 24; }
+inline int f803_25(int x) { return x * 25; }
+inline int f803_26(int x) { return x * 26; }
+inline int f803_27(int x) { return x * 27; }
+inline int f803_28(int x) { return x * 28; }
+inline int f803_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8030 */
+#include <vector>
+#include "h6270.h"
+#include "h2783.h"
+#include "h7421.h"
+#include "h9305.h"
+#include "h8296.h"
+#ifdef X
+#include "h4535.h"
+#endif
+struct S8030 { int a; const char *s = "x//y"; };
+inline int f8030_0(int x) { return x * 0; }
+inline int f8030_1(int x) { return x * 1; }
+inline int f8030_2(int x) { return x * 2; }
+inline int f8030_3(int x) { return x * 3; }
+inline int f8030_4(int x) { return x * 4; }
+inline int f8030_5(int x) { return x * 5; }
+inline int f8030_6(int x) { return x * 6; }
+inline int f8030_7(int x) { return x * 7; }
+inline int f8030_8(int x) { return x * 8; }
+inline int f8030_9(int x) { return x * 9; }
+inline int f8030_10(int x) { return x * 10; }
+inline int f8030_11(int x) { return x * 11; }
+inline int f8030_12(int x) { return x * 12; }
+inline int f8030_13(int x) { return x * 13; }
+inline int f8030_14(int x) { return x * 14; }
+inline int f8030_15(int x) { return x * 15; }
+inline int f8030_16(int x) { return x * 16; }
+inline int f8030_17(int x) { return x * 17; }
+inline int f8030_18(int x) { return x * 18; }
+inline int f8030_19(int x) { return x * 19; }
+inline int f8030_20(int x) { return x * 20; }
+inline int f8030_21(int x) { return x * 21; }
+inline int f8030_22(int x) { return x * 22; }
+inline int f8030_23(int x) { return x * 23; }
+inline int f8030_24(int x) { return x * 24; }
+inline int f8030_25(int x) { return x * 25; }
+inline int f8030_26(int x) { return x * 26; }
+inline int f8030_27(int x) { return x * 27; }
+inline int f8030_28(int x) { return x * 28; }
+inline int f8030_29(int x) { return x * 29; }
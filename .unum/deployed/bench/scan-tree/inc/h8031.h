@@ -0,0 +1,42 @@
+#pragma once
+/* header 8031 */
+#include <vector>
+#include "h3445.h"
+#include "h1542.h"
+#include "h736.h"
+#include "h5225.h"
+#include "h8832.h"
+#ifdef X
+#include "h6463.h"
+#endif
+struct S8031 { int a; const char *s = "x//y"; };
+inline int f8031_0(int x) { return x * 0; }
+inline int f8031_1(int x) { return x * 1; }
+inline int f8031_2(int x) { return x * 2; }
+inline int f8031_3(int x) { return x * 3; }
+inline int f8031_4(int x) { return x * 4; }
+inline int f8031_5(int x) { return x * 5; }
+inline int f8031_6(int x) { return x * 6; }
+inline int f8031_7(int x) { return x * 7; }
+inline int f8031_8(int x) { return x * 8; }
+inline int f8031_9(int x) { return x * 9; }
+inline int f8031_10(int x) { return x * 10; }
+inline int f8031_11(int x) { return x * 11; }
+inline int f8031_12(int x) { return x * 12; }
+inline int f8031_13(int x) { return x * 13; }
+inline int f8031_14(int x) { return x * 14; }
+inline int f8031_15(int x) { return x * 15; }
+inline int f8031_16(int x) { return x * 16; }
+inline int f8031_17(int x) { return x * 17; }
+inline int f8031_18(int x) { return x * 18; }
+inline int f8031_19(int x) { return x * 19; }
+inline int f8031_20(int x) { return x * 20; }
+inline int f8031_21(int x) { return x * 21; }
+inline int f8031_22(int x) { return x * 22; }
+inline int f8031_23(int x) { return x * 23; }
+inline int f8031_24(int x) { return x * 24; }
+inline int f8031_25(int x) { return x * 25; }
+inline int f8031_26(int x) { return x * 26; }
+inline int f8031_27(int x) { return x * 27; }
+inline int f8031_28(int x) { return x * 28; }
+inline int f8031_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8037 */
+#include <vector>
+#include "h7155.h"
+#include "h1208.h"
+#include "h1768.h"
+#include "h8588.h"
+#include "h1745.h"
+#ifdef X
+#include "h3071.h"
+#endif
+struct S8037 { int a; const char *s = "x//y"; };
+inline int f8037_0(int x) { return x * 0; }
+inline int f8037_1(int x) { return x * 1; }
+inline int f8037_2(int x) { return x * 2; }
+inline int f8037_3(int x) { return x * 3; }
+inline int f8037_4(int x) { return x * 4; }
+inline int f8037_5(int x) { return x * 5; }
+inline int f8037_6(int x) { return x * 6; }
+inline int f8037_7(int x) { return x * 7; }
+inline int f8037_8(int x) { return x * 8; }
+inline int f8037_9(int x) { return x * 9; }
+inline int f8037_10(int x) { return x * 10; }
+inline int f8037_11(int x) { return x * 11; }
+inline int f8037_12(int x) { return x * 12; }
+inline int f8037_13(int x) { return x * 13; }
+inline int f8037_14(int x) { return x * 14; }
+inline int f8037_15(int x) { return x * 15; }
+inline int f8037_16(int x) { return x * 16; }
+inline int f8037_17(int x) { return x * 17; }
+inline int f8037_18(int x) { return x * 18; }
+inline int f8037_19(int x) { return x * 19; }
+inline int f8037_20(int x) { return x * 20; }
+inline int f8037_21(int x) { return x * 21; }
+inline int f8037_22(int x) { return x * 22; }
+inline int f8037_23(int x) { return x * 23; }
+inline int f8037_24(int x) { return x * 24; }
+inline int f8037_25(int x) { return x * 25; }
+inline int f8037_26(int x) { return x * 26; }
+inline int f8037_27(int x) { return x * 27; }
+inline int f8037_28(int x) { return x * 28; }
+inline int f8037_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8038 */
+#include <vector>
+#include "h7144.h"
+#include "h1030.h"
+#include "h5729.h"
+#include "h8945.h"
+#include "h3723.h"
+#ifdef X
+#include "h8080.h"
+#endif
+struct S8038 { int a; const char *s = "x//y"; };
+inline int f8038_0(int x) { return x * 0; }
+inline int f8038_1(int x) { return x * 1; }
+inline int f8038_2(int x) { return x * 2; }
+inline int f8038_3(int x) { return x * 3; }
+inline int f8038_4(int x) { return x * 4; }
+inline int f8038_5(int x) { return x * 5; }
+inline int f8038_6(int x) { return x * 6; }
+inline int f8038_7(int x) { return x * 7; }
+inline int f8038_8(int x) { return x * 8; }
+inline int f8038_9(int x) { return x * 9; }
+inline int f8038_10(int x) { return x * 10; }
+inline int f8038_11(int x) { return x * 11; }
+inline int f8038_12(int x) { return x * 12; }
+inline int f8038_13(int x) { return x * 13; }
+inline int f8038_14(int x) { return x * 14; }
+inline int f8038_15(int x) { return x * 15; }
+inline int f8038_16(int x) { return x * 16; }
+inline int f8038_17(int x) { return x * 17; }
+inline int f8038_18(int x) { return x * 18; }
+inline int f8038_19(int x) { return x * 19; }
+inline int f8038_20(int x) { return x * 20; }
+inline int f8038_21(int x) { return x * 21; }
+inline int f8038_22(int x) { return x * 22; }
+inline int f8038_23(int x) { return x * 23; }
+inline int f8038_24(int x) { return x * 24; }
+inline int f8038_25(int x) { return x * 25; }
+inline int f8038_26(int x) { return x * 26; }
+inline int f8038_27(int x) { return x * 27; }
+inline int f8038_28(int x) { return x * 28; }
+inline int f8038_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8044 */
+#include <vector>
+#include "h6314.h"
+#include "h4156.h"
+#include "h978.h"
+#include "h3369.h"
+#include "h7625.h"
+#ifdef X
+#include "h1268.h"
+#endif
+struct S8044 { int a; const char *s = "x//y"; };
+inline int f8044_0(int x) { return x * 0; }
+inline int f8044_1(int x) { return x * 1; }
+inline int f8044_2(int x) { return x * 2; }
+inline int f8044_3(int x) { return x * 3; }
+inline int f8044_4(int x) { return x * 4; }
+inline int f8044_5(int x) { return x * 5; }
+inline int f8044_6(int x) { return x * 6; }
+inline int f8044_7(int x) { return x * 7; }
+inline int f8044_8(int x) { return x * 8; }
+inline int f8044_9(int x) { return x * 9; }
+inline int f8044_10(int x) { return x * 10; }
+inline int f8044_11(int x) { return x * 11; }
+inline int f8044_12(int x) { return x * 12; }
+inline int f8044_13(int x) { return x * 13; }
+inline int f8044_14(int x) { return x * 14; }
+inline int f8044_15(int x) { return x * 15; }
+inline int f8044_16(int x) { return x * 16; }
+inline int f8044_17(int x) { return x * 17; }
+inline int f8044_18(int x) { return x * 18; }
+inline int f8044_19(int x) { return x * 19; }
+inline int f8044_20(int x) { return x * 20; }
+inline int f8044_21(int x) { return x * 21; }
+inline int f8044_22(int x) { return x * 22; }
+inline int f8044_23(int x) { return x * 23; }
+inline int f8044_24(int x) { return x * 24; }
+inline int f8044_25(int x) { return x * 25; }
+inline int f8044_26(int x) { return x * 26; }
+inline int f8044_27(int x) { return x * 27; }
+inline int f8044_28(int x) { return x * 28; }
+inline int f8044_29(int x) { return x * 29; }
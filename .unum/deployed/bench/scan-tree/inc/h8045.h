@@ -0,0 +1,42 @@
+#pragma once
+/* header 8045 */
+#include <vector>
+#include "h6777.h"
+#include "h1452.h"
+#include "h2610.h"
+#include "h8918.h"
+#include "h7148.h"
+#ifdef X
+#include "h4029.h"
+#endif
+struct S8045 { int a; const char *s = "x//y"; };
+inline int f8045_0(int x) { return x * 0; }
+inline int f8045_1(int x) { return x * 1; }
+inline int f8045_2(int x) { return x * 2; }
+inline int f8045_3(int x) { return x * 3; }
+inline int f8045_4(int x) { return x * 4; }
+inline int f8045_5(int x) { return x * 5; }
+inline int f8045_6(int x) { return x * 6; }
+inline int f8045_7(int x) { return x * 7; }
+inline int f8045_8(int x) { return x * 8; }
+inline int f8045_9(int x) { return x * 9; }
+inline int f8045_10(int x) { return x * 10; }
+inline int f8045_11(int x) { return x * 11; }
+inline int f8045_12(int x) { return x * 12; }
+inline int f8045_13(int x) { return x * 13; }
+inline int f8045_14(int x) { return x * 14; }
+inline int f8045_15(int x) { return x * 15; }
+inline int f8045_16(int x) { return x * 16; }
+inline int f8045_17(int x) { return x * 17; }
+inline int f8045_18(int x) { return x * 18; }
+inline int f8045_19(int x) { return x * 19; }
+inline int f8045_20(int x) { return x * 20; }
+inline int f8045_21(int x) { return x * 21; }
+inline int f8045_22(int x) { return x * 22; }
+inline int f8045_23(int x) { return x * 23; }
+inline int f8045_24(int x) { return x * 24; }
+inline int f8045_25(int x) { return x * 25; }
+inline int f8045_26(int x) { return x * 26; }
+inline int f8045_27(int x) { return x * 27; }
+inline int f8045_28(int x) { return x * 28; }
+inline int f8045_29(int x) { return x * 29; }
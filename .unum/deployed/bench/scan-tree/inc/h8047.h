@@ -0,0 +1,42 @@
+#pragma once
+/* header 8047 */
+#include <vector>
+#include "h9568.h"
+#include "h7304.h"
+#include "h2563.h"
+#include "h4587.h"
+#include "h9592.h"
+#ifdef X
+#include "h3675.h"
+#endif
+struct S8047 { int a; const char *s = "x//y"; };
+inline int f8047_0(int x) { return x * 0; }
+inline int f8047_1(int x) { return x * 1; }
+inline int f8047_2(int x) { return x * 2; }
+inline int f8047_3(int x) { return x * 3; }
+inline int f8047_4(int x) { return x * 4; }
+inline int f8047_5(int x) { return x * 5; }
+inline int f8047_6(int x) { return x * 6; }
+inline int f8047_7(int x) { return x * 7; }
+inline int f8047_8(int x) { return x * 8; }
+inline int f8047_9(int x) { return x * 9; }
+inline int f8047_10(int x) { return x * 10; }
+inline int f8047_11(int x) { return x * 11; }
+inline int f8047_12(int x) { return x * 12; }
+inline int f8047_13(int x) { return x * 13; }
+inline int f8047_14(int x) { return x * 14; }
+inline int f8047_15(int x) { return x * 15; }
+inline int f8047_16(int x) { return x * 16; }
+inline int f8047_17(int x) { return x * 17; }
+inline int f8047_18(int x) { return x * 18; }
+inline int f8047_19(int x) { return x * 19; }
+inline int f8047_20(int x) { return x * 20; }
+inline int f8047_21(int x) { return x * 21; }
+inline int f8047_22(int x) { return x * 22; }
+inline int f8047_23(int x) { return x * 23; }
+inline int f8047_24(int x) { return x * 24; }
+inline int f8047_25(int x) { return x * 25; }
+inline int f8047_26(int x) { return x * 26; }
+inline int f8047_27(int x) { return x * 27; }
+inline int f8047_28(int x) { return x * 28; }
+inline int f8047_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8048 */
+#include <vector>
+#include "h9138.h"
+#include "h2281.h"
+#include "h2950.h"
+#include "h6885.h"
+#include "h221.h"
+#ifdef X
+#include "h3551.h"
+#endif
+struct S8048 { int a; const char *s = "x//y"; };
+inline int f8048_0(int x) { return x * 0; }
+inline int f8048_1(int x) { return x * 1; }
+inline int f8048_2(int x) { return x * 2; }
+inline int f8048_3(int x) { return x * 3; }
+inline int f8048_4(int x) { return x * 4; }
+inline int f8048_5(int x) { return x * 5; }
+inline int f8048_6(int x) { return x * 6; }
+inline int f8048_7(int x) { return x * 7; }
+inline int f8048_8(int x) { return x * 8; }
+inline int f8048_9(int x) { return x * 9; }
+inline int f8048_10(int x) { return x * 10; }
+inline int f8048_11(int x) { return x * 11; }
+inline int f8048_12(int x) { return x * 12; }
+inline int f8048_13(int x) { return x * 13; }
+inline int f8048_14(int x) { return x * 14; }
+inline int f8048_15(int x) { return x * 15; }
+inline int f8048_16(int x) { return x * 16; }
+inline int f8048_17(int x) { return x * 17; }
+inline int f8048_18(int x) { return x * 18; }
+inline int f8048_19(int x) { return x * 19; }
+inline int f8048_20(int x) { return x * 20; }
+inline int f8048_21(int x) { return x * 21; }
+inline int f8048_22(int x) { return x * 22; }
+inline int f8048_23(int x) { return x * 23; }
+inline int f8048_24(int x) { return x * 24; }
+inline int f8048_25(int x) { return x * 25; }
+inline int f8048_26(int x) { return x * 26; }
+inline int f8048_27(int x) { return x * 27; }
+inline int f8048_28(int x) { return x * 28; }
+inline int f8048_29(int x) { return x * 29; }
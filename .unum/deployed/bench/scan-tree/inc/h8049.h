@@ -0,0 +1,42 @@
+#pragma once
+/* header 8049 */
+#include <vector>
+#include "h5011.h"
+#include "h558.h"
+#include "h3908.h"
+#include "h1587.h"
+#include "h4375.h"
+#ifdef X
+#include "h1661.h"
+#endif
+struct S8049 { int a; const char *s = "x//y"; };
+inline int f8049_0(int x) { return x * 0; }
+inline int f8049_1(int x) { return x * 1; }
+inline int f8049_2(int x) { return x * 2; }
+inline int f8049_3(int x) { return x * 3; }
+inline int f8049_4(int x) { return x * 4; }
+inline int f8049_5(int x) { return x * 5; }
+inline int f8049_6(int x) { return x * 6; }
+inline int f8049_7(int x) { return x * 7; }
+inline int f8049_8(int x) { return x * 8; }
+inline int f8049_9(int x) { return x * 9; }
+inline int f8049_10(int x) { return x * 10; }
+inline int f8049_11(int x) { return x * 11; }
+inline int f8049_12(int x) { return x * 12; }
+inline int f8049_13(int x) { return x * 13; }
+inline int f8049_14(int x) { return x * 14; }
+inline int f8049_15(int x) { return x * 15; }
+inline int f8049_16(int x) { return x * 16; }
+inline int f8049_17(int x) { return x * 17; }
+inline int f8049_18(int x) { return x * 18; }
+inline int f8049_19(int x) { return x * 19; }
+inline int f8049_20(int x) { return x * 20; }
+inline int f8049_21(int x) { return x * 21; }
+inline int f8049_22(int x) { return x * 22; }
+inline int f8049_23(int x) { return x * 23; }
+inline int f8049_24(int x) { return x * 24; }
+inline int f8049_25(int x) { return x * 25; }
+inline int f8049_26(int x) { return x * 26; }
+inline int f8049_27(int x) { return x * 27; }
+inline int f8049_28(int x) { return x * 28; }
+inline int f8049_29(int x) { return x * 29; }
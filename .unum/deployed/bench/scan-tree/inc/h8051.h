@@ -0,0 +1,42 @@
+#pragma once
+/* header 8051 */
+#include <vector>
+#include "h4952.h"
+#include "h7780.h"
+#include "h6135.h"
+#include "h7417.h"
+#include "h5572.h"
+#ifdef X
+#include "h6576.h"
+#endif
+struct S8051 { int a; const char *s = "x//y"; };
+inline int f8051_0(int x) { return x * 0; }
+inline int f8051_1(int x) { return x * 1; }
+inline int f8051_2(int x) { return x * 2; }
+inline int f8051_3(int x) { return x * 3; }
+inline int f8051_4(int x) { return x * 4; }
+inline int f8051_5(int x) { return x * 5; }
+inline int f8051_6(int x) { return x * 6; }
+inline int f8051_7(int x) { return x * 7; }
+inline int f8051_8(int x) { return x * 8; }
+inline int f8051_9(int x) { return x * 9; }
+inline int f8051_10(int x) { return x * 10; }
+inline int f8051_11(int x) { return x * 11; }
+inline int f8051_12(int x) { return x * 12; }
+inline int f8051_13(int x) { return x * 13; }
+inline int f8051_14(int x) { return x * 14; }
+inline int f8051_15(int x) { return x * 15; }
+inline int f8051_16(int x) { return x * 16; }
+inline int f8051_17(int x) { return x * 17; }
+inline int f8051_18(int x) { return x * 18; }
+inline int f8051_19(int x) { return x * 19; }
+inline int f8051_20(int x) { return x * 20; }
+inline int f8051_21(int x) { return x * 21; }
+inline int f8051_22(int x) { return x * 22; }
+inline int f8051_23(int x) { return x * 23; }
+inline int f8051_24(int x) { return x * 24; }
+inline int f8051_25(int x) { return x * 25; }
+inline int f8051_26(int x) { return x * 26; }
+inline int f8051_27(int x) { return x * 27; }
+inline int f8051_28(int x) { return x * 28; }
+inline int f8051_29(int x) { return x * 29; }
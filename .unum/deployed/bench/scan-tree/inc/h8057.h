@@ -0,0 +1,42 @@
+#pragma once
+/* header 8057 */
+#include <vector>
+#include "h508.h"
+#include "h3352.h"
+#include "h2326.h"
+#include "h5797.h"
+#include "h3410.h"
+#ifdef X
+#include "h1717.h"
+#endif
+struct S8057 { int a; const char *s = "x//y"; };
+inline int f8057_0(int x) { return x * 0; }
+inline int f8057_1(int x) { return x * 1; }
+inline int f8057_2(int x) { return x * 2; }
+inline int f8057_3(int x) { return x * 3; }
+inline int f8057_4(int x) { return x * 4; }
+inline int f8057_5(int x) { return x * 5; }
+inline int f8057_6(int x) { return x * 6; }
+inline int f8057_7(int x) { return x * 7; }
+inline int f8057_8(int x) { return x * 8; }
+inline int f8057_9(int x) { return x * 9; }
+inline int f8057_10(int x) { return x * 10; }
+inline int f8057_11(int x) { return x * 11; }
+inline int f8057_12(int x) { return x * 12; }
+inline int f8057_13(int x) { return x * 13; }
+inline int f8057_14(int x) { return x * 14; }
+inline int f8057_15(int x) { return x * 15; }
+inline int f8057_16(int x) { return x * 16; }
+inline int f8057_17(int x) { return x * 17; }
+inline int f8057_18(int x) { return x * 18; }
+inline int f8057_19(int x) { return x * 19; }
+inline int f8057_20(int x) { return x * 20; }
+inline int f8057_21(int x) { return x * 21; }
+inline int f8057_22(int x) { return x * 22; }
+inline int f8057_23(int x) { return x * 23; }
+inline int f8057_24(int x) { return x * 24; }
+inline int f8057_25(int x) { return x * 25; }
+inline int f8057_26(int x) { return x * 26; }
+inline int f8057_27(int x) { return x * 27; }
+inline int f8057_28(int x) { return x * 28; }
+inline int f8057_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8058 */
+#include <vector>
+#include "h493.h"
+#include "h4907.h"
+#include "h5411.h"
+#include "h4683.h"
+#include "h7481.h"
+#ifdef X
+#include "h9582.h"
+#endif
+struct S8058 { int a; const char *s = "x//y"; };
+inline int f8058_0(int x) { return x * 0; }
+inline int f8058_1(int x) { return x * 1; }
+inline int f8058_2(int x) { return x * 2; }
+inline int f8058_3(int x) { return x * 3; }
+inline int f8058_4(int x) { return x * 4; }
+inline int f8058_5(int x) { return x * 5; }
+inline int f8058_6(int x) { return x * 6; }
+inline int f8058_7(int x) { return x * 7; }
+inline int f8058_8(int x) { return x * 8; }
+inline int f8058_9(int x) { return x * 9; }
+inline int f8058_10(int x) { return x * 10; }
+inline int f8058_11(int x) { return x * 11; }
+inline int f8058_12(int x) { return x * 12; }
+inline int f8058_13(int x) { return x * 13; }
+inline int f8058_14(int x) { return x * 14; }
+inline int f8058_15(int x) { return x * 15; }
+inline int f8058_16(int x) { return x * 16; }
+inline int f8058_17(int x) { return x * 17; }
+inline int f8058_18(int x) { return x * 18; }
+inline int f8058_19(int x) { return x * 19; }
+inline int f8058_20(int x) { return x * 20; }
+inline int f8058_21(int x) { return x * 21; }
+inline int f8058_22(int x) { return x * 22; }
+inline int f8058_23(int x) { return x * 23; }
+inline int f8058_24(int x) { return x * 24; }
+inline int f8058_25(int x) { return x * 25; }
+inline int f8058_26(int x) { return x * 26; }
+inline int f8058_27(int x) { return x * 27; }
+inline int f8058_28(int x) { return x * 28; }
+inline int f8058_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8060 */
+#include <vector>
+#include "h8575.h"
+#include "h5953.h"
+#include "h6617.h"
+#include "h2288.h"
+#include "h965.h"
+#ifdef X
+#include "h1616.h"
+#endif
+struct S8060 { int a; const char *s = "x//y"; };
+inline int f8060_0(int x) { return x * 0; }
+inline int f8060_1(int x) { return x * 1; }
+inline int f8060_2(int x) { return x * 2; }
+inline int f8060_3(int x) { return x * 3; }
+inline int f8060_4(int x) { return x * 4; }
+inline int f8060_5(int x) { return x * 5; }
+inline int f8060_6(int x) { return x * 6; }
+inline int f8060_7(int x) { return x * 7; }
+inline int f8060_8(int x) { return x * 8; }
+inline int f8060_9(int x) { return x * 9; }
+inline int f8060_10(int x) { return x * 10; }
+inline int f8060_11(int x) { return x * 11; }
+inline int f8060_12(int x) { return x * 12; }
+inline int f8060_13(int x) { return x * 13; }
+inline int f8060_14(int x) { return x * 14; }
+inline int f8060_15(int x) { return x * 15; }
+inline int f8060_16(int x) { return x * 16; }
+inline int f8060_17(int x) { return x * 17; }
+inline int f8060_18(int x) { return x * 18; }
+inline int f8060_19(int x) { return x * 19; }
+inline int f8060_20(int x) { return x * 20; }
+inline int f8060_21(int x) { return x * 21; }
+inline int f8060_22(int x) { return x * 22; }
+inline int f8060_23(int x) { return x * 23; }
+inline int f8060_24(int x) { return x * 24; }
+inline int f8060_25(int x) { return x * 25; }
+inline int f8060_26(int x) { return x * 26; }
+inline int f8060_27(int x) { return x * 27; }
+inline int f8060_28(int x) { return x * 28; }
+inline int f8060_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8061 */
+#include <vector>
+#include "h6540.h"
+#include "h5276.h"
+#include "h5575.h"
+#include "h2119.h"
+#include "h2050.h"
+#ifdef X
+#include "h6143.h"
+#endif
+struct S8061 { int a; const char *s = "x//y"; };
+inline int f8061_0(int x) { return x * 0; }
+inline int f8061_1(int x) { return x * 1; }
+inline int f8061_2(int x) { return x * 2; }
+inline int f8061_3(int x) { return x * 3; }
+inline int f8061_4(int x) { return x * 4; }
+inline int f8061_5(int x) { return x * 5; }
+inline int f8061_6(int x) { return x * 6; }
+inline int f8061_7(int x) { return x * 7; }
+inline int f8061_8(int x) { return x * 8; }
+inline int f8061_9(int x) { return x * 9; }
+inline int f8061_10(int x) { return x * 10; }
+inline int f8061_11(int x) { return x * 11; }
+inline int f8061_12(int x) { return x * 12; }
+inline int f8061_13(int x) { return x * 13; }
+inline int f8061_14(int x) { return x * 14; }
+inline int f8061_15(int x) { return x * 15; }
+inline int f8061_16(int x) { return x * 16; }
+inline int f8061_17(int x) { return x * 17; }
+inline int f8061_18(int x) { return x * 18; }
+inline int f8061_19(int x) { return x * 19; }
+inline int f8061_20(int x) { return x * 20; }
+inline int f8061_21(int x) { return x * 21; }
+inline int f8061_22(int x) { return x * 22; }
+inline int f8061_23(int x) { return x * 23; }
+inline int f8061_24(int x) { return x * 24; }
+inline int f8061_25(int x) { return x * 25; }
+inline int f8061_26(int x) { return x * 26; }
+inline int f8061_27(int x) { return x * 27; }
+inline int f8061_28(int x) { return x * 28; }
+inline int f8061_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8063 */
+#include <vector>
+#include "h3826.h"
+#include "h2362.h"
+#include "h1350.h"
+#include "h7600.h"
+#include "h58.h"
+#ifdef X
+#include "h3243.h"
+#endif
+struct S8063 { int a; const char *s = "x//y"; };
+inline int f8063_0(int x) { return x * 0; }
+inline int f8063_1(int x) { return x * 1; }
+inline int f8063_2(int x) { return x * 2; }
+inline int f8063_3(int x) { return x * 3; }
+inline int f8063_4(int x) { return x * 4; }
+inline int f8063_5(int x) { return x * 5; }
+inline int f8063_6(int x) { return x * 6; }
+inline int f8063_7(int x) { return x * 7; }
+inline int f8063_8(int x) { return x * 8; }
+inline int f8063_9(int x) { return x * 9; }
+inline int f8063_10(int x) { return x * 10; }
+inline int f8063_11(int x) { return x * 11; }
+inline int f8063_12(int x) { return x * 12; }
+inline int f8063_13(int x) { return x * 13; }
+inline int f8063_14(int x) { return x * 14; }
+inline int f8063_15(int x) { return x * 15; }
+inline int f8063_16(int x) { return x * 16; }
+inline int f8063_17(int x) { return x * 17; }
+inline int f8063_18(int x) { return x * 18; }
+inline int f8063_19(int x) { return x * 19; }
+inline int f8063_20(int x) { return x * 20; }
+inline int f8063_21(int x) { return x * 21; }
+inline int f8063_22(int x) { return x * 22; }
+inline int f8063_23(int x) { return x * 23; }
+inline int f8063_24(int x) { return x * 24; }
+inline int f8063_25(int x) { return x * 25; }
+inline int f8063_26(int x) { return x * 26; }
+inline int f8063_27(int x) { return x * 27; }
+inline int f8063_28(int x) { return x * 28; }
+inline int f8063_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8064 */
+#include <vector>
+#include "h6013.h"
+#include "h3026.h"
+#include "h6389.h"
+#include "h7183.h"
+#include "h5728.h"
+#ifdef X
+#include "h69.h"
+#endif
+struct S8064 { int a; const char *s = "x//y"; };
+inline int f8064_0(int x) { return x * 0; }
+inline int f8064_1(int x) { return x * 1; }
+inline int f8064_2(int x) { return x * 2; }
+inline int f8064_3(int x) { return x * 3; }
+inline int f8064_4(int x) { return x * 4; }
+inline int f8064_5(int x) { return x * 5; }
+inline int f8064_6(int x) { return x * 6; }
+inline int f8064_7(int x) { return x * 7; }
+inline int f8064_8(int x) { return x * 8; }
+inline int f8064_9(int x) { return x * 9; }
+inline int f8064_10(int x) { return x * 10; }
+inline int f8064_11(int x) { return x * 11; }
+inline int f8064_12(int x) { return x * 12; }
+inline int f8064_13(int x) { return x * 13; }
+inline int f8064_14(int x) { return x * 14; }
+inline int f8064_15(int x) { return x * 15; }
+inline int f8064_16(int x) { return x * 16; }
+inline int f8064_17(int x) { return x * 17; }
+inline int f8064_18(int x) { return x * 18; }
+inline int f8064_19(int x) { return x * 19; }
+inline int f8064_20(int x) { return x * 20; }
+inline int f8064_21(int x) { return x * 21; }
+inline int f8064_22(int x) { return x * 22; }
+inline int f8064_23(int x) { return x * 23; }
+inline int f8064_24(int x) { return x * 24; }
+inline int f8064_25(int x) { return x * 25; }
+inline int f8064_26(int x) { return x * 26; }
+inline int f8064_27(int x) { return x * 27; }
+inline int f8064_28(int x) { return x * 28; }
+inline int f8064_29(int x) { return x * 29; }
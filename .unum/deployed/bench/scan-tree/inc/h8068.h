@@ -0,0 +1,42 @@
+#pragma once
+/* header 8068 */
+#include <vector>
+#include "h7110.h"
+#include "h8480.h"
+#include "h5715.h"
+#include "h321.h"
+#include "h3723.h"
+#ifdef X
+#include "h7939.h"
+#endif
+struct S8068 { int a; const char *s = "x//y"; };
+inline int f8068_0(int x) { return x * 0; }
+inline int f8068_1(int x) { return x * 1; }
+inline int f8068_2(int x) { return x * 2; }
+inline int f8068_3(int x) { return x * 3; }
+inline int f8068_4(int x) { return x * 4; }
+inline int f8068_5(int x) { return x * 5; }
+inline int f8068_6(int x) { return x * 6; }
+inline int f8068_7(int x) { return x * 7; }
+inline int f8068_8(int x) { return x * 8; }
+inline int f8068_9(int x) { return x * 9; }
+inline int f8068_10(int x) { return x * 10; }
+inline int f8068_11(int x) { return x * 11; }
+inline int f8068_12(int x) { return x * 12; }
+inline int f8068_13(int x) { return x * 13; }
+inline int f8068_14(int x) { return x * 14; }
+inline int f8068_15(int x) { return x * 15; }
+inline int f8068_16(int x) { return x * 16; }
+inline int f8068_17(int x) { return x * 17; }
+inline int f8068_18(int x) { return x * 18; }
+inline int f8068_19(int x) { return x * 19; }
+inline int f8068_20(int x) { return x * 20; }
+inline int f8068_21(int x) { return x * 21; }
+inline int f8068_22(int x) { return x * 22; }
+inline int f8068_23(int x) { return x * 23; }
+inline int f8068_24(int x) { return x * 24; }
+inline int f8068_25(int x) { return x * 25; }
+inline int f8068_26(int x) { return x * 26; }
+inline int f8068_27(int x) { return x * 27; }
+inline int f8068_28(int x) { return x * 28; }
+inline int f8068_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8069 */
+#include <vector>
+#include "h1043.h"
+#include "h4180.h"
+#include "h6055.h"
+#include "h1166.h"
+#include "h6249.h"
+#ifdef X
+#include "h4669.h"
+#endif
+struct S8069 { int a; const char *s = "x//y"; };
+inline int f8069_0(int x) { return x * 0; }
+inline int f8069_1(int x) { return x * 1; }
+inline int f8069_2(int x) { return x * 2; }
+inline int f8069_3(int x) { return x * 3; }
+inline int f8069_4(int x) { return x * 4; }
+inline int f8069_5(int x) { return x * 5; }
+inline int f8069_6(int x) { return x * 6; }
+inline int f8069_7(int x) { return x * 7; }
+inline int f8069_8(int x) { return x * 8; }
+inline int f8069_9(int x) { return x * 9; }
+inline int f8069_10(int x) { return x * 10; }
+inline int f8069_11(int x) { return x * 11; }
+inline int f8069_12(int x) { return x * 12; }
+inline int f8069_13(int x) { return x * 13; }
+inline int f8069_14(int x) { return x * 14; }
+inline int f8069_15(int x) { return x * 15; }
+inline int f8069_16(int x) { return x * 16; }
+inline int f8069_17(int x) { return x * 17; }
+inline int f8069_18(int x) { return x * 18; }
+inline int f8069_19(int x) { return x * 19; }
+inline int f8069_20(int x) { return x * 20; }
+inline int f8069_21(int x) { return x * 21; }
+inline int f8069_22(int x) { return x * 22; }
+inline int f8069_23(int x) { return x * 23; }
+inline int f8069_24(int x) { return x * 24; }
+inline int f8069_25(int x) { return x * 25; }
+inline int f8069_26(int x) { return x * 26; }
+inline int f8069_27(int x) { return x * 27; }
+inline int f8069_28(int x) { return x * 28; }
+inline int f8069_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8070 */
+#include <vector>
+#include "h6451.h"
+#include "h4984.h"
+#include "h5004.h"
+#include "h1912.h"
+#include "h1876.h"
+#ifdef X
+#include "h4882.h"
+#endif
+struct S8070 { int a; const char *s = "x//y"; };
+inline int f8070_0(int x) { return x * 0; }
+inline int f8070_1(int x) { return x * 1; }
+inline int f8070_2(int x) { return x * 2; }
+inline int f8070_3(int x) { return x * 3; }
+inline int f8070_4(int x) { return x * 4; }
+inline int f8070_5(int x) { return x * 5; }
+inline int f8070_6(int x) { return x * 6; }
+inline int f8070_7(int x) { return x * 7; }
+inline int f8070_8(int x) { return x * 8; }
+inline int f8070_9(int x) { return x * 9; }
+inline int f8070_10(int x) { return x * 10; }
+inline int f8070_11(int x) { return x * 11; }
+inline int f8070_12(int x) { return x * 12; }
+inline int f8070_13(int x) { return x * 13; }
+inline int f8070_14(int x) { return x * 14; }
+inline int f8070_15(int x) { return x * 15; }
+inline int f8070_16(int x) { return x * 16; }
+inline int f8070_17(int x) { return x * 17; }
+inline int f8070_18(int x) { return x * 18; }
+inline int f8070_19(int x) { return x * 19; }
+inline int f8070_20(int x) { return x * 20; }
+inline int f8070_21(int x) { return x * 21; }
+inline int f8070_22(int x) { return x * 22; }
+inline int f8070_23(int x) { return x * 23; }
+inline int f8070_24(int x) { return x * 24; }
+inline int f8070_25(int x) { return x * 25; }
+inline int f8070_26(int x) { return x * 26; }
+inline int f8070_27(int x) { return x * 27; }
+inline int f8070_28(int x) { return x * 28; }
+inline int f8070_29(int x) { return x * 29; }
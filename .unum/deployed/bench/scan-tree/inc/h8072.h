@@ -0,0 +1,42 @@
+#pragma once
+/* header 8072 */
+#include <vector>
+#include "h1208.h"
+#include "h3364.h"
+#include "h8415.h"
+#include "h7115.h"
+#include "h712.h"
+#ifdef X
+#include "h8558.h"
+#endif
+struct S8072 { int a; const char *s = "x//y"; };
+inline int f8072_0(int x) { return x * 0; }
+inline int f8072_1(int x) { return x * 1; }
+inline int f8072_2(int x) { return x * 2; }
+inline int f8072_3(int x) { return x * 3; }
+inline int f8072_4(int x) { return x * 4; }
+inline int f8072_5(int x) { return x * 5; }
+inline int f8072_6(int x) { return x * 6; }
+inline int f8072_7(int x) { return x * 7; }
+inline int f8072_8(int x) { return x * 8; }
+inline int f8072_9(int x) { return x * 9; }
+inline int f8072_10(int x) { return x * 10; }
+inline int f8072_11(int x) { return x * 11; }
+inline int f8072_12(int x) { return x * 12; }
+inline int f8072_13(int x) { return x * 13; }
+inline int f8072_14(int x) { return x * 14; }
+inline int f8072_15(int x) { return x * 15; }
+inline int f8072_16(int x) { return x * 16; }
+inline int f8072_17(int x) { return x * 17; }
+inline int f8072_18(int x) { return x * 18; }
+inline int f8072_19(int x) { return x * 19; }
+inline int f8072_20(int x) { return x * 20; }
+inline int f8072_21(int x) { return x * 21; }
+inline int f8072_22(int x) { return x * 22; }
+inline int f8072_23(int x) { return x * 23; }
+inline int f8072_24(int x) { return x * 24; }
+inline int f8072_25(int x) { return x * 25; }
+inline int f8072_26(int x) { return x * 26; }
+inline int f8072_27(int x) { return x * 27; }
+inline int f8072_28(int x) { return x * 28; }
+inline int f8072_29(int x) { return x * 29; }
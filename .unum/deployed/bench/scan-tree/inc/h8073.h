@@ -0,0 +1,42 @@
+#pragma once
+/* header 8073 */
+#include <vector>
+#include "h4146.h"
+#include "h1697.h"
+#include "h2230.h"
+#include "h6196.h"
+#include "h7435.h"
+#ifdef X
+#include "h8148.h"
+#endif
+struct S8073 { int a; const char *s = "x//y"; };
+inline int f8073_0(int x) { return x * 0; }
+inline int f8073_1(int x) { return x * 1; }
+inline int f8073_2(int x) { return x * 2; }
+inline int f8073_3(int x) { return x * 3; }
+inline int f8073_4(int x) { return x * 4; }
+inline int f8073_5(int x) { return x * 5; }
+inline int f8073_6(int x) { return x * 6; }
+inline int f8073_7(int x) { return x * 7; }
+inline int f8073_8(int x) { return x * 8; }
+inline int f8073_9(int x) { return x * 9; }
+inline int f8073_10(int x) { return x * 10; }
+inline int f8073_11(int x) { return x * 11; }
+inline int f8073_12(int x) { return x * 12; }
+inline int f8073_13(int x) { return x * 13; }
+inline int f8073_14(int x) { return x * 14; }
+inline int f8073_15(int x) { return x * 15; }
+inline int f8073_16(int x) { return x * 16; }
+inline int f8073_17(int x) { return x * 17; }
+inline int f8073_18(int x) { return x * 18; }
+inline int f8073_19(int x) { return x * 19; }
+inline int f8073_20(int x) { return x * 20; }
+inline int f8073_21(int x) { return x * 21; }
+inline int f8073_22(int x) { return x * 22; }
+inline int f8073_23(int x) { return x * 23; }
+inline int f8073_24(int x) { return x * 24; }
+inline int f8073_25(int x) { return x * 25; }
+inline int f8073_26(int x) { return x * 26; }
+inline int f8073_27(int x) { return x * 27; }
+inline int f8073_28(int x) { return x * 28; }
+inline int f8073_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8075 */
+#include <vector>
+#include "h4552.h"
+#include "h1842.h"
+#include "h8926.h"
+#include "h7596.h"
+#include "h7877.h"
+#ifdef X
+#include "h2870.h"
+#endif
+struct S8075 { int a; const char *s = "x//y"; };
+inline int f8075_0(int x) { return x * 0; }
+inline int f8075_1(int x) { return x * 1; }
+inline int f8075_2(int x) { return x * 2; }
+inline int f8075_3(int x) { return x * 3; }
+inline int f8075_4(int x) { return x * 4; }
+inline int f8075_5(int x) { return x * 5; }
+inline int f8075_6(int x) { return x * 6; }
+inline int f8075_7(int x) { return x * 7; }
+inline int f8075_8(int x) { return x * 8; }
+inline int f8075_9(int x) { return x * 9; }
+inline int f8075_10(int x) { return x * 10; }
+inline int f8075_11(int x) { return x * 11; }
+inline int f8075_12(int x) { return x * 12; }
+inline int f8075_13(int x) { return x * 13; }
+inline int f8075_14(int x) { return x * 14; }
+inline int f8075_15(int x) { return x * 15; }
+inline int f8075_16(int x) { return x * 16; }
+inline int f8075_17(int x) { return x * 17; }
+inline int f8075_18(int x) { return x * 18; }
+inline int f8075_19(int x) { return x * 19; }
+inline int f8075_20(int x) { return x * 20; }
+inline int f8075_21(int x) { return x * 21; }
+inline int f8075_22(int x) { return x * 22; }
+inline int f8075_23(int x) { return x * 23; }
+inline int f8075_24(int x) { return x * 24; }
+inline int f8075_25(int x) { return x * 25; }
+inline int f8075_26(int x) { return x * 26; }
+inline int f8075_27(int x) { return x * 27; }
+inline int f8075_28(int x) { return x * 28; }
+inline int f8075_29(int x) { return x * 29; }
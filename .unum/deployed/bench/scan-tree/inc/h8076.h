@@ -0,0 +1,42 @@
+#pragma once
+/* header 8076 */
+#include <vector>
+#include "h837.h"
+#include "h9589.h"
+#include "h8144.h"
+#include "h1796.h"
+#include "h4617.h"
+#ifdef X
+#include "h8123.h"
+#endif
+struct S8076 { int a; const char *s = "x//y"; };
+inline int f8076_0(int x) { return x * 0; }
+inline int f8076_1(int x) { return x * 1; }
+inline int f8076_2(int x) { return x * 2; }
+inline int f8076_3(int x) { return x * 3; }
+inline int f8076_4(int x) { return x * 4; }
+inline int f8076_5(int x) { return x * 5; }
+inline int f8076_6(int x) { return x * 6; }
+inline int f8076_7(int x) { return x * 7; }
+inline int f8076_8(int x) { return x * 8; }
+inline int f8076_9(int x) { return x * 9; }
+inline int f8076_10(int x) { return x * 10; }
+inline int f8076_11(int x) { return x * 11; }
+inline int f8076_12(int x) { return x * 12; }
+inline int f8076_13(int x) { return x * 13; }
+inline int f8076_14(int x) { return x * 14; }
+inline int f8076_15(int x) { return x * 15; }
+inline int f8076_16(int x) { return x * 16; }
+inline int f8076_17(int x) { return x * 17; }
+inline int f8076_18(int x) { return x * 18; }
+inline int f8076_19(int x) { return x * 19; }
+inline int f8076_20(int x) { return x * 20; }
+inline int f8076_21(int x) { return x * 21; }
+inline int f8076_22(int x) { return x * 22; }
+inline int f8076_23(int x) { return x * 23; }
+inline int f8076_24(int x) { return x * 24; }
+inline int f8076_25(int x) { return x * 25; }
+inline int f8076_26(int x) { return x * 26; }
+inline int f8076_27(int x) { return x * 27; }
+inline int f8076_28(int x) { return x * 28; }
+inline int f8076_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8078 */
+#include <vector>
+#include "h2406.h"
+#include "h9234.h"
+#include "h3382.h"
+#include "h6126.h"
+#include "h3959.h"
+#ifdef X
+#include "h8109.h"
+#endif
+struct S8078 { int a; const char *s = "x//y"; };
+inline int f8078_0(int x) { return x * 0; }
+inline int f8078_1(int x) { return x * 1; }
+inline int f8078_2(int x) { return x * 2; }
+inline int f8078_3(int x) { return x * 3; }
+inline int f8078_4(int x) { return x * 4; }
+inline int f8078_5(int x) { return x * 5; }
+inline int f8078_6(int x) { return x * 6; }
+inline int f8078_7(int x) { return x * 7; }
+inline int f8078_8(int x) { return x * 8; }
+inline int f8078_9(int x) { return x * 9; }
+inline int f8078_10(int x) { return x * 10; }
+inline int f8078_11(int x) { return x * 11; }
+inline int f8078_12(int x) { return x * 12; }
+inline int f8078_13(int x) { return x * 13; }
+inline int f8078_14(int x) { return x * 14; }
+inline int f8078_15(int x) { return x * 15; }
+inline int f8078_16(int x) { return x * 16; }
+inline int f8078_17(int x) { return x * 17; }
+inline int f8078_18(int x) { return x * 18; }
+inline int f8078_19(int x) { return x * 19; }
+inline int f8078_20(int x) { return x * 20; }
+inline int f8078_21(int x) { return x * 21; }
+inline int f8078_22(int x) { return x * 22; }
+inline int f8078_23(int x) { return x * 23; }
+inline int f8078_24(int x) { return x * 24; }
+inline int f8078_25(int x) { return x * 25; }
+inline int f8078_26(int x) { return x * 26; }
+inline int f8078_27(int x) { return x * 27; }
+inline int f8078_28(int x) { return x * 28; }
+inline int f8078_29(int x) { return x * 29; }
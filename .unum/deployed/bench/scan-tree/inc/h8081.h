@@ -0,0 +1,42 @@
+#pragma once
+/* header 8081 */
+#include <vector>
+#include "h6602.h"
+#include "h2861.h"
+#include "h2956.h"
+#include "h4076.h"
+#include "h6922.h"
+#ifdef X
+#include "h4713.h"
+#endif
+struct S8081 { int a; const char *s = "x//y"; };
+inline int f8081_0(int x) { return x * 0; }
+inline int f8081_1(int x) { return x * 1; }
+inline int f8081_2(int x) { return x * 2; }
+inline int f8081_3(int x) { return x * 3; }
+inline int f8081_4(int x) { return x * 4; }
+inline int f8081_5(int x) { return x * 5; }
+inline int f8081_6(int x) { return x * 6; }
+inline int f8081_7(int x) { return x * 7; }
+inline int f8081_8(int x) { return x * 8; }
+inline int f8081_9(int x) { return x * 9; }
+inline int f8081_10(int x) { return x * 10; }
+inline int f8081_11(int x) { return x * 11; }
+inline int f8081_12(int x) { return x * 12; }
+inline int f8081_13(int x) { return x * 13; }
+inline int f8081_14(int x) { return x * 14; }
+inline int f8081_15(int x) { return x * 15; }
+inline int f8081_16(int x) { return x * 16; }
+inline int f8081_17(int x) { return x * 17; }
+inline int f8081_18(int x) { return x * 18; }
+inline int f8081_19(int x) { return x * 19; }
+inline int f8081_20(int x) { return x * 20; }
+inline int f8081_21(int x) { return x * 21; }
+inline int f8081_22(int x) { return x * 22; }
+inline int f8081_23(int x) { return x * 23; }
+inline int f8081_24(int x) { return x * 24; }
+inline int f8081_25(int x) { return x * 25; }
+inline int f8081_26(int x) { return x * 26; }
+inline int f8081_27(int x) { return x * 27; }
+inline int f8081_28(int x) { return x * 28; }
+inline int f8081_29(int x) { return x * 29; }
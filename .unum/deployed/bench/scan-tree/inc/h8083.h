@@ -0,0 +1,42 @@
+#pragma once
+/* header 8083 */
+#include <vector>
+#include "h8568.h"
+#include "h3435.h"
+#include "h1536.h"
+#include "h3159.h"
+#include "h1167.h"
+#ifdef X
+#include "h2100.h"
+#endif
+struct S8083 { int a; const char *s = "x//y"; };
+inline int f8083_0(int x) { return x * 0; }
+inline int f8083_1(int x) { return x * 1; }
+inline int f8083_2(int x) { return x * 2; }
+inline int f8083_3(int x) { return x * 3; }
+inline int f8083_4(int x) { return x * 4; }
+inline int f8083_5(int x) { return x * 5; }
+inline int f8083_6(int x) { return x * 6; }
+inline int f8083_7(int x) { return x * 7; }
+inline int f8083_8(int x) { return x * 8; }
+inline int f8083_9(int x) { return x * 9; }
+inline int f8083_10(int x) { return x * 10; }
+inline int f8083_11(int x) { return x * 11; }
+inline int f8083_12(int x) { return x * 12; }
+inline int f8083_13(int x) { return x * 13; }
+inline int f8083_14(int x) { return x * 14; }
+inline int f8083_15(int x) { return x * 15; }
+inline int f8083_16(int x) { return x * 16; }
+inline int f8083_17(int x) { return x * 17; }
+inline int f8083_18(int x) { return x * 18; }
+inline int f8083_19(int x) { return x * 19; }
+inline int f8083_20(int x) { return x * 20; }
+inline int f8083_21(int x) { return x * 21; }
+inline int f8083_22(int x) { return x * 22; }
+inline int f8083_23(int x) { return x * 23; }
+inline int f8083_24(int x) { return x * 24; }
+inline int f8083_25(int x) { return x * 25; }
+inline int f8083_26(int x) { return x * 26; }
+inline int f8083_27(int x) { return x * 27; }
+inline int f8083_28(int x) { return x * 28; }
+inline int f8083_29(int x) { return x * 29; }
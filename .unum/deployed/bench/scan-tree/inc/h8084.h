@@ -0,0 +1,42 @@
+#pragma once
+/* header 8084 */
+#include <vector>
+#include "h8658.h"
+#include "h57.h"
+#include "h9278.h"
+#include "h8328.h"
+#include "h5426.h"
+#ifdef X
+#include "h1049.h"
+#endif
+struct S8084 { int a; const char *s = "x//y"; };
+inline int f8084_0(int x) { return x * 0; }
+inline int f8084_1(int x) { return x * 1; }
+inline int f8084_2(int x) { return x * 2; }
+inline int f8084_3(int x) { return x * 3; }
+inline int f8084_4(int x) { return x * 4; }
+inline int f8084_5(int x) { return x * 5; }
+inline int f8084_6(int x) { return x * 6; }
+inline int f8084_7(int x) { return x * 7; }
+inline int f8084_8(int x) { return x * 8; }
+inline int f8084_9(int x) { return x * 9; }
+inline int f8084_10(int x) { return x * 10; }
+inline int f8084_11(int x) { return x * 11; }
+inline int f8084_12(int x) { return x * 12; }
+inline int f8084_13(int x) { return x * 13; }
+inline int f8084_14(int x) { return x * 14; }
+inline int f8084_15(int x) { return x * 15; }
+inline int f8084_16(int x) { return x * 16; }
+inline int f8084_17(int x) { return x * 17; }
+inline int f8084_18(int x) { return x * 18; }
+inline int f8084_19(int x) { return x * 19; }
+inline int f8084_20(int x) { return x * 20; }
+inline int f8084_21(int x) { return x * 21; }
+inline int f8084_22(int x) { return x * 22; }
+inline int f8084_23(int x) { return x * 23; }
+inline int f8084_24(int x) { return x * 24; }
+inline int f8084_25(int x) { return x * 25; }
+inline int f8084_26(int x) { return x * 26; }
+inline int f8084_27(int x) { return x * 27; }
+inline int f8084_28(int x) { return x * 28; }
+inline int f8084_29(int x) { return x * 29; }
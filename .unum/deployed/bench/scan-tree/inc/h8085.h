@@ -0,0 +1,42 @@
+#pragma once
+/* header 8085 */
+#include <vector>
+#include "h3046.h"
+#include "h9006.h"
+#include "h35.h"
+#include "h3219.h"
+#include "h6279.h"
+#ifdef X
+#include "h6318.h"
+#endif
+struct S8085 { int a; const char *s = "x//y"; };
+inline int f8085_0(int x) { return x * 0; }
+inline int f8085_1(int x) { return x * 1; }
+inline int f8085_2(int x) { return x * 2; }
+inline int f8085_3(int x) { return x * 3; }
+inline int f8085_4(int x) { return x * 4; }
+inline int f8085_5(int x) { return x * 5; }
+inline int f8085_6(int x) { return x * 6; }
+inline int f8085_7(int x) { return x * 7; }
+inline int f8085_8(int x) { return x * 8; }
+inline int f8085_9(int x) { return x * 9; }
+inline int f8085_10(int x) { return x * 10; }
+inline int f8085_11(int x) { return x * 11; }
+inline int f8085_12(int x) { return x * 12; }
+inline int f8085_13(int x) { return x * 13; }
+inline int f8085_14(int x) { return x * 14; }
+inline int f8085_15(int x) { return x * 15; }
+inline int f8085_16(int x) { return x * 16; }
+inline int f8085_17(int x) { return x * 17; }
+inline int f8085_18(int x) { return x * 18; }
+inline int f8085_19(int x) { return x * 19; }
+inline int f8085_20(int x) { return x * 20; }
+inline int f8085_21(int x) { return x * 21; }
+inline int f8085_22(int x) { return x * 22; }
+inline int f8085_23(int x) { return x * 23; }
+inline int f8085_24(int x) { return x * 24; }
+inline int f8085_25(int x) { return x * 25; }
+inline int f8085_26(int x) { return x * 26; }
+inline int f8085_27(int x) { return x * 27; }
+inline int f8085_28(int x) { return x * 28; }
+inline int f8085_29(int x) { return x * 29; }
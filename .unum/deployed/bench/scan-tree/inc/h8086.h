@@ -0,0 +1,42 @@
+#pragma once
+/* header 8086 */
+#include <vector>
+#include "h6131.h"
+#include "h1305.h"
+#include "h3539.h"
+#include "h7694.h"
+#include "h9019.h"
+#ifdef X
+#include "h773.h"
+#endif
+struct S8086 { int a; const char *s = "x//y"; };
+inline int f8086_0(int x) { return x * 0; }
+inline int f8086_1(int x) { return x * 1; }
+inline int f8086_2(int x) { return x * 2; }
+inline int f8086_3(int x) { return x * 3; }
+inline int f8086_4(int x) { return x * 4; }
+inline int f8086_5(int x) { return x * 5; }
+inline int f8086_6(int x) { return x * 6; }
+inline int f8086_7(int x) { return x * 7; }
+inline int f8086_8(int x) { return x * 8; }
+inline int f8086_9(int x) { return x * 9; }
+inline int f8086_10(int x) { return x * 10; }
+inline int f8086_11(int x) { return x * 11; }
+inline int f8086_12(int x) { return x * 12; }
+inline int f8086_13(int x) { return x * 13; }
+inline int f8086_14(int x) { return x * 14; }
+inline int f8086_15(int x) { return x * 15; }
+inline int f8086_16(int x) { return x * 16; }
+inline int f8086_17(int x) { return x * 17; }
+inline int f8086_18(int x) { return x * 18; }
+inline int f8086_19(int x) { return x * 19; }
+inline int f8086_20(int x) { return x * 20; }
+inline int f8086_21(int x) { return x * 21; }
+inline int f8086_22(int x) { return x * 22; }
+inline int f8086_23(int x) { return x * 23; }
+inline int f8086_24(int x) { return x * 24; }
+inline int f8086_25(int x) { return x * 25; }
+inline int f8086_26(int x) { return x * 26; }
+inline int f8086_27(int x) { return x * 27; }
+inline int f8086_28(int x) { return x * 28; }
+inline int f8086_29(int x) { return x * 29; }
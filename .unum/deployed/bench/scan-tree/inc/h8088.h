@@ -0,0 +1,42 @@
+#pragma once
+/* header 8088 */
+#include <vector>
+#include "h2729.h"
+#include "h6992.h"
+#include "h9098.h"
+#include "h7194.h"
+#include "h3259.h"
+#ifdef X
+#include "h3040.h"
+#endif
+struct S8088 { int a; const char *s = "x//y"; };
+inline int f8088_0(int x) { return x * 0; }
+inline int f8088_1(int x) { return x * 1; }
+inline int f8088_2(int x) { return x * 2; }
+inline int f8088_3(int x) { return x * 3; }
+inline int f8088_4(int x) { return x * 4; }
+inline int f8088_5(int x) { return x * 5; }
+inline int f8088_6(int x) { return x * 6; }
+inline int f8088_7(int x) { return x * 7; }
+inline int f8088_8(int x) { return x * 8; }
+inline int f8088_9(int x) { return x * 9; }
+inline int f8088_10(int x) { return x * 10; }
+inline int f8088_11(int x) { return x * 11; }
+inline int f8088_12(int x) { return x * 12; }
+inline int f8088_13(int x) { return x * 13; }
+inline int f8088_14(int x) { return x * 14; }
+inline int f8088_15(int x) { return x * 15; }
+inline int f8088_16(int x) { return x * 16; }
+inline int f8088_17(int x) { return x * 17; }
+inline int f8088_18(int x) { return x * 18; }
+inline int f8088_19(int x) { return x * 19; }
+inline int f8088_20(int x) { return x * 20; }
+inline int f8088_21(int x) { return x * 21; }
+inline int f8088_22(int x) { return x * 22; }
+inline int f8088_23(int x) { return x * 23; }
+inline int f8088_24(int x) { return x * 24; }
+inline int f8088_25(int x) { return x * 25; }
+inline int f8088_26(int x) { return x * 26; }
+inline int f8088_27(int x) { return x * 27; }
+inline int f8088_28(int x) { return x * 28; }
+inline int f8088_29(int x) { return x * 29; }
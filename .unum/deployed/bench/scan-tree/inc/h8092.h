@@ -0,0 +1,42 @@
+#pragma once
+/* header 8092 */
+#include <vector>
+#include "h4905.h"
+#include "h5313.h"
+#include "h3385.h"
+#include "h9773.h"
+#include "h6134.h"
+#ifdef X
+#include "h5506.h"
+#endif
+struct S8092 { int a; const char *s = "x//y"; };
+inline int f8092_0(int x) { return x * 0; }
+inline int f8092_1(int x) { return x * 1; }
+inline int f8092_2(int x) { return x * 2; }
+inline int f8092_3(int x) { return x * 3; }
+inline int f8092_4(int x) { return x * 4; }
+inline int f8092_5(int x) { return x * 5; }
+inline int f8092_6(int x) { return x * 6; }
+inline int f8092_7(int x) { return x * 7; }
+inline int f8092_8(int x) { return x * 8; }
+inline int f8092_9(int x) { return x * 9; }
+inline int f8092_10(int x) { return x * 10; }
+inline int f8092_11(int x) { return x * 11; }
+inline int f8092_12(int x) { return x * 12; }
+inline int f8092_13(int x) { return x * 13; }
+inline int f8092_14(int x) { return x * 14; }
+inline int f8092_15(int x) { return x * 15; }
+inline int f8092_16(int x) { return x * 16; }
+inline int f8092_17(int x) { return x * 17; }
+inline int f8092_18(int x) { return x * 18; }
+inline int f8092_19(int x) { return x * 19; }
+inline int f8092_20(int x) { return x * 20; }
+inline int f8092_21(int x) { return x * 21; }
+inline int f8092_22(int x) { return x * 22; }
+inline int f8092_23(int x) { return x * 23; }
+inline int f8092_24(int x) { return x * 24; }
+inline int f8092_25(int x) { return x * 25; }
+inline int f8092_26(int x) { return x * 26; }
+inline int f8092_27(int x) { return x * 27; }
+inline int f8092_28(int x) { return x * 28; }
+inline int f8092_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8094 */
+#include <vector>
+#include "h3946.h"
+#include "h5440.h"
+#include "h1094.h"
+#include "h6866.h"
+#include "h8740.h"
+#ifdef X
+#include "h3814.h"
+#endif
+struct S8094 { int a; const char *s = "x//y"; };
+inline int f8094_0(int x) { return x * 0; }
+inline int f8094_1(int x) { return x * 1; }
+inline int f8094_2(int x) { return x * 2; }
+inline int f8094_3(int x) { return x * 3; }
+inline int f8094_4(int x) { return x * 4; }
+inline int f8094_5(int x) { return x * 5; }
+inline int f8094_6(int x) { return x * 6; }
+inline int f8094_7(int x) { return x * 7; }
+inline int f8094_8(int x) { return x * 8; }
+inline int f8094_9(int x) { return x * 9; }
+inline int f8094_10(int x) { return x * 10; }
+inline int f8094_11(int x) { return x * 11; }
+inline int f8094_12(int x) { return x * 12; }
+inline int f8094_13(int x) { return x * 13; }
+inline int f8094_14(int x) { return x * 14; }
+inline int f8094_15(int x) { return x * 15; }
+inline int f8094_16(int x) { return x * 16; }
+inline int f8094_17(int x) { return x * 17; }
+inline int f8094_18(int x) { return x * 18; }
+inline int f8094_19(int x) { return x * 19; }
+inline int f8094_20(int x) { return x * 20; }
+inline int f8094_21(int x) { return x * 21; }
+inline int f8094_22(int x) { return x * 22; }
+inline int f8094_23(int x) { return x * 23; }
+inline int f8094_24(int x) { return x * 24; }
+inline int f8094_25(int x) { return x * 25; }
+inline int f8094_26(int x) { return x * 26; }
+inline int f8094_27(int x) { return x * 27; }
+inline int f8094_28(int x) { return x * 28; }
+inline int f8094_29(int x) { return x * 29; }
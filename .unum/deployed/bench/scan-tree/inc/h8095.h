@@ -0,0 +1,42 @@
+#pragma once
+/* header 8095 */
+#include <vector>
+#include "h2683.h"
+#include "h1738.h"
+#include "h6451.h"
+#include "h5520.h"
+#include "h8344.h"
+#ifdef X
+#include "h8839.h"
+#endif
+struct S8095 { int a; const char *s = "x//y"; };
+inline int f8095_0(int x) { return x * 0; }
+inline int f8095_1(int x) { return x * 1; }
+inline int f8095_2(int x) { return x * 2; }
+inline int f8095_3(int x) { return x * 3; }
+inline int f8095_4(int x) { return x * 4; }
+inline int f8095_5(int x) { return x * 5; }
+inline int f8095_6(int x) { return x * 6; }
+inline int f8095_7(int x) { return x * 7; }
+inline int f8095_8(int x) { return x * 8; }
+inline int f8095_9(int x) { return x * 9; }
+inline int f8095_10(int x) { return x * 10; }
+inline int f8095_11(int x) { return x * 11; }
+inline int f8095_12(int x) { return x * 12; }
+inline int f8095_13(int x) { return x * 13; }
+inline int f8095_14(int x) { return x * 14; }
+inline int f8095_15(int x) { return x * 15; }
+inline int f8095_16(int x) { return x * 16; }
+inline int f8095_17(int x) { return x * 17; }
+inline int f8095_18(int x) { return x * 18; }
+inline int f8095_19(int x) { return x * 19; }
+inline int f8095_20(int x) { return x * 20; }
+inline int f8095_21(int x) { return x * 21; }
+inline int f8095_22(int x) { return x * 22; }
+inline int f8095_23(int x) { return x * 23; }
+inline int f8095_24(int x) { return x * 24; }
+inline int f8095_25(int x) { return x * 25; }
+inline int f8095_26(int x) { return x * 26; }
+inline int f8095_27(int x) { return x * 27; }
+inline int f8095_28(int x) { return x * 28; }
+inline int f8095_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8097 */
+#include <vector>
+#include "h4425.h"
+#include "h8067.h"
+#include "h8203.h"
+#include "h7447.h"
+#include "h6363.h"
+#ifdef X
+#include "h5651.h"
+#endif
+struct S8097 { int a; const char *s = "x//y"; };
+inline int f8097_0(int x) { return x * 0; }
+inline int f8097_1(int x) { return x * 1; }
+inline int f8097_2(int x) { return x * 2; }
+inline int f8097_3(int x) { return x * 3; }
+inline int f8097_4(int x) { return x * 4; }
+inline int f8097_5(int x) { return x * 5; }
+inline int f8097_6(int x) { return x * 6; }
+inline int f8097_7(int x) { return x * 7; }
+inline int f8097_8(int x) { return x * 8; }
+inline int f8097_9(int x) { return x * 9; }
+inline int f8097_10(int x) { return x * 10; }
+inline int f8097_11(int x) { return x * 11; }
+inline int f8097_12(int x) { return x * 12; }
+inline int f8097_13(int x) { return x * 13; }
+inline int f8097_14(int x) { return x * 14; }
+inline int f8097_15(int x) { return x * 15; }
+inline int f8097_16(int x) { return x * 16; }
+inline int f8097_17(int x) { return x * 17; }
+inline int f8097_18(int x) { return x * 18; }
+inline int f8097_19(int x) { return x * 19; }
+inline int f8097_20(int x) { return x * 20; }
+inline int f8097_21(int x) { return x * 21; }
+inline int f8097_22(int x) { return x * 22; }
+inline int f8097_23(int x) { return x * 23; }
+inline int f8097_24(int x) { return x * 24; }
+inline int f8097_25(int x) { return x * 25; }
+inline int f8097_26(int x) { return x * 26; }
+inline int f8097_27(int x) { return x * 27; }
+inline int f8097_28(int x) { return x * 28; }
+inline int f8097_29(int x) { return x * 29; }
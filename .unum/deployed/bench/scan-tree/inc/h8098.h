@@ -0,0 +1,42 @@
+#pragma once
+/* header 8098 */
+#include <vector>
+#include "h9347.h"
+#include "h4623.h"
+#include "h8095.h"
+#include "h7414.h"
+#include "h3442.h"
+#ifdef X
+#include "h9895.h"
+#endif
+struct S8098 { int a; const char *s = "x//y"; };
+inline int f8098_0(int x) { return x * 0; }
+inline int f8098_1(int x) { return x * 1; }
+inline int f8098_2(int x) { return x * 2; }
+inline int f8098_3(int x) { return x * 3; }
+inline int f8098_4(int x) { return x * 4; }
+inline int f8098_5(int x) { return x * 5; }
+inline int f8098_6(int x) { return x * 6; }
+inline int f8098_7(int x) { return x * 7; }
+inline int f8098_8(int x) { return x * 8; }
+inline int f8098_9(int x) { return x * 9; }
+inline int f8098_10(int x) { return x * 10; }
+inline int f8098_11(int x) { return x * 11; }
+inline int f8098_12(int x) { return x * 12; }
+inline int f8098_13(int x) { return x * 13; }
+inline int f8098_14(int x) { return x * 14; }
+inline int f8098_15(int x) { return x * 15; }
+inline int f8098_16(int x) { return x * 16; }
+inline int f8098_17(int x) { return x * 17; }
+inline int f8098_18(int x) { return x * 18; }
+inline int f8098_19(int x) { return x * 19; }
+inline int f8098_20(int x) { return x * 20; }
+inline int f8098_21(int x) { return x * 21; }
+inline int f8098_22(int x) { return x * 22; }
+inline int f8098_23(int x) { return x * 23; }
+inline int f8098_24(int x) { return x * 24; }
+inline int f8098_25(int x) { return x * 25; }
+inline int f8098_26(int x) { return x * 26; }
+inline int f8098_27(int x) { return x * 27; }
+inline int f8098_28(int x) { return x * 28; }
+inline int f8098_29(int x) { return x * 29; }
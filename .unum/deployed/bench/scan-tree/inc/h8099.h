@@ -0,0 +1,42 @@
+#pragma once
+/* header 8099 */
+#include <vector>
+#include "h5443.h"
+#include "h4849.h"
+#include "h2985.h"
+#include "h6790.h"
+#include "h8383.h"
+#ifdef X
+#include "h3209.h"
+#endif
+struct S8099 { int a; const char *s = "x//y"; };
+inline int f8099_0(int x) { return x * 0; }
+inline int f8099_1(int x) { return x * 1; }
+inline int f8099_2(int x) { return x * 2; }
+inline int f8099_3(int x) { return x * 3; }
+inline int f8099_4(int x) { return x * 4; }
+inline int f8099_5(int x) { return x * 5; }
+inline int f8099_6(int x) { return x * 6; }
+inline int f8099_7(int x) { return x * 7; }
+inline int f8099_8(int x) { return x * 8; }
+inline int f8099_9(int x) { return x * 9; }
+inline int f8099_10(int x) { return x * 10; }
+inline int f8099_11(int x) { return x * 11; }
+inline int f8099_12(int x) { return x * 12; }
+inline int f8099_13(int x) { return x * 13; }
+inline int f8099_14(int x) { return x * 14; }
+inline int f8099_15(int x) { return x * 15; }
+inline int f8099_16(int x) { return x * 16; }
+inline int f8099_17(int x) { return x * 17; }
+inline int f8099_18(int x) { return x * 18; }
+inline int f8099_19(int x) { return x * 19; }
+inline int f8099_20(int x) { return x * 20; }
+inline int f8099_21(int x) { return x * 21; }
+inline int f8099_22(int x) { return x * 22; }
+inline int f8099_23(int x) { return x * 23; }
+inline int f8099_24(int x) { return x * 24; }
+inline int f8099_25(int x) { return x * 25; }
+inline int f8099_26(int x) { return x * 26; }
+inline int f8099_27(int x) { return x * 27; }
+inline int f8099_28(int x) { return x * 28; }
+inline int f8099_29(int x) { return x * 29; }
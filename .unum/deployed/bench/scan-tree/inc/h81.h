@@ -0,0 +1,42 @@
+#pragma once
+/* header 81 */
+#include <vector>
+#include "h3063.h"
+#include "h8453.h"
+#include "h4635.h"
+#include "h1392.h"
+#include "h5357.h"
+#ifdef X
+#include "h6159.h"
+#endif
+struct S81 { int a; const char *s = "x//y"; };
+inline int f81_0(int x) { return x * 0; }
+inline int f81_1(int x) { return x * 1; }
+inline int f81_2(int x) { return x * 2; }
+inline int f81_3(int x) { return x * 3; }
+inline int f81_4(int x) { return x * 4; }
+inline int f81_5(int x) { return x * 5; }
+inline int f81_6(int x) { return x * 6; }
+inline int f81_7(int x) { return x * 7; }
+inline int f81_8(int x) { return x * 8; }
+inline int f81_9(int x) { return x * 9; }
+inline int f81_10(int x) { return x * 10; }
+inline int f81_11(int x) { return x * 11; }
+inline int f81_12(int x) { return x * 12; }
+inline int f81_13(int x) { return x * 13; }
+inline int f81_14(int x) { return x * 14; }
+inline int f81_15(int x) { return x * 15; }
+inline int f81_16(int x) { return x * 16; }
+inline int f81_17(int x) { return x * 17; }
+inline int f81_18(int x) { return x * 18; }
+inline int f81_19(int x) { return x * 19; }
+inline int f81_20(int x) { return x * 20; }
+inline int f81_21(int x) { return x * 21; }
+inline int f81_22(int x) { return x * 22; }
+inline int f81_23(int x) { return x * 23; }
+inline int f81_24(int x) { return x * 24; }
+inline int f81_25(int x) { return x * 25; }
+inline int f81_26(int x) { return x * 26; }
+inline int f81_27(int x) { return x * 27; }
+inline int f81_28(int x) { return x * 28; }
+inline int f81_29(int x) { return x * 29; }
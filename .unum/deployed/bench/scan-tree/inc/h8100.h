@@ -0,0 +1,42 @@
+#pragma once
+/* header 8100 */
+#include <vector>
+#include "h3114.h"
+#include "h7205.h"
+#include "h6769.h"
+#include "h1823.h"
+#include "h29.h"
+#ifdef X
+#include "h23.h"
+#endif
+struct S8100 { int a; const char *s = "x//y"; };
+inline int f8100_0(int x) { return x * 0; }
+inline int f8100_1(int x) { return x * 1; }
+inline int f8100_2(int x) { return x * 2; }
+inline int f8100_3(int x) { return x * 3; }
+inline int f8100_4(int x) { return x * 4; }
+inline int f8100_5(int x) { return x * 5; }
+inline int f8100_6(int x) { return x * 6; }
+inline int f8100_7(int x) { return x * 7; }
+inline int f8100_8(int x) { return x * 8; }
+inline int f8100_9(int x) { return x * 9; }
+inline int f8100_10(int x) { return x * 10; }
+inline int f8100_11(int x) { return x * 11; }
+inline int f8100_12(int x) { return x * 12; }
+inline int f8100_13(int x) { return x * 13; }
+inline int f8100_14(int x) { return x * 14; }
+inline int f8100_15(int x) { return x * 15; }
+inline int f8100_16(int x) { return x * 16; }
+inline int f8100_17(int x) { return x * 17; }
+inline int f8100_18(int x) { return x * 18; }
+inline int f8100_19(int x) { return x * 19; }
+inline int f8100_20(int x) { return x * 20; }
+inline int f8100_21(int x) { return x * 21; }
+inline int f8100_22(int x) { return x * 22; }
+inline int f8100_23(int x) { return x * 23; }
+inline int f8100_24(int x) { return x * 24; }
+inline int f8100_25(int x) { return x * 25; }
+inline int f8100_26(int x) { return x * 26; }
+inline int f8100_27(int x) { return x * 27; }
+inline int f8100_28(int x) { return x * 28; }
+inline int f8100_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8101 */
+#include <vector>
+#include "h7000.h"
+#include "h350.h"
+#include "h6165.h"
+#include "h8447.h"
+#include "h592.h"
+#ifdef X
+#include "h7700.h"
+#endif
+struct S8101 { int a; const char *s = "x//y"; };
+inline int f8101_0(int x) { return x * 0; }
+inline int f8101_1(int x) { return x * 1; }
+inline int f8101_2(int x) { return x * 2; }
+inline int f8101_3(int x) { return x * 3; }
+inline int f8101_4(int x) { return x * 4; }
+inline int f8101_5(int x) { return x * 5; }
+inline int f8101_6(int x) { return x * 6; }
+inline int f8101_7(int x) { return x * 7; }
+inline int f8101_8(int x) { return x * 8; }
+inline int f8101_9(int x) { return x * 9; }
+inline int f8101_10(int x) { return x * 10; }
+inline int f8101_11(int x) { return x * 11; }
+inline int f8101_12(int x) { return x * 12; }
+inline int f8101_13(int x) { return x * 13; }
+inline int f8101_14(int x) { return x * 14; }
+inline int f8101_15(int x) { return x * 15; }
+inline int f8101_16(int x) { return x * 16; }
+inline int f8101_17(int x) { return x * 17; }
+inline int f8101_18(int x) { return x * 18; }
+inline int f8101_19(int x) { return x * 19; }
+inline int f8101_20(int x) { return x * 20; }
+inline int f8101_21(int x) { return x * 21; }
+inline int f8101_22(int x) { return x * 22; }
+inline int f8101_23(int x) { return x * 23; }
+inline int f8101_24(int x) { return x * 24; }
+inline int f8101_25(int x) { return x * 25; }
+inline int f8101_26(int x) { return x * 26; }
+inline int f8101_27(int x) { return x * 27; }
+inline int f8101_28(int x) { return x * 28; }
+inline int f8101_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8103 */
+#include <vector>
+#include "h5281.h"
+#include "h545.h"
+#include "h4797.h"
+#include "h2886.h"
+#include "h2642.h"
+#ifdef X
+#include "h6474.h"
+#endif
+struct S8103 { int a; const char *s = "x//y"; };
+inline int f8103_0(int x) { return x * 0; }
+inline int f8103_1(int x) { return x * 1; }
+inline int f8103_2(int x) { return x * 2; }
+inline int f8103_3(int x) { return x * 3; }
+inline int f8103_4(int x) { return x * 4; }
+inline int f8103_5(int x) { return x * 5; }
+inline int f8103_6(int x) { return x * 6; }
+inline int f8103_7(int x) { return x * 7; }
+inline int f8103_8(int x) { return x * 8; }
+inline int f8103_9(int x) { return x * 9; }
+inline int f8103_10(int x) { return x * 10; }
+inline int f8103_11(int x) { return x * 11; }
+inline int f8103_12(int x) { return x * 12; }
+inline int f8103_13(int x) { return x * 13; }
+inline int f8103_14(int x) { return x * 14; }
+inline int f8103_15(int x) { return x * 15; }
+inline int f8103_16(int x) { return x * 16; }
+inline int f8103_17(int x) { return x * 17; }
+inline int f8103_18(int x) { return x * 18; }
+inline int f8103_19(int x) { return x * 19; }
+inline int f8103_20(int x) { return x * 20; }
+inline int f8103_21(int x) { return x * 21; }
+inline int f8103_22(int x) { return x * 22; }
+inline int f8103_23(int x) { return x * 23; }
+inline int f8103_24(int x) { return x * 24; }
+inline int f8103_25(int x) { return x * 25; }
+inline int f8103_26(int x) { return x * 26; }
+inline int f8103_27(int x) { return x * 27; }
+inline int f8103_28(int x) { return x * 28; }
+inline int f8103_29(int x) { return x * 29; }
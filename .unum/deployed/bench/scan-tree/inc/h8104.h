@@ -0,0 +1,42 @@
+#pragma once
+/* header 8104 */
+#include <vector>
+#include "h5881.h"
+#include "h5557.h"
+#include "h2037.h"
+#include "h4108.h"
+#include "h3500.h"
+#ifdef X
+#include "h357.h"
+#endif
+struct S8104 { int a; const char *s = "x//y"; };
+inline int f8104_0(int x) { return x * 0; }
+inline int f8104_1(int x) { return x * 1; }
+inline int f8104_2(int x) { return x * 2; }
+inline int f8104_3(int x) { return x * 3; }
+inline int f8104_4(int x) { return x * 4; }
+inline int f8104_5(int x) { return x * 5; }
+inline int f8104_6(int x) { return x * 6; }
+inline int f8104_7(int x) { return x * 7; }
+inline int f8104_8(int x) { return x * 8; }
+inline int f8104_9(int x) { return x * 9; }
+inline int f8104_10(int x) { return x * 10; }
+inline int f8104_11(int x) { return x * 11; }
+inline int f8104_12(int x) { return x * 12; }
+inline int f8104_13(int x) { return x * 13; }
+inline int f8104_14(int x) { return x * 14; }
+inline int f8104_15(int x) { return x * 15; }
+inline int f8104_16(int x) { return x * 16; }
+inline int f8104_17(int x) { return x * 17; }
+inline int f8104_18(int x) { return x * 18; }
+inline int f8104_19(int x) { return x * 19; }
+inline int f8104_20(int x) { return x * 20; }
+inline int f8104_21(int x) { return x * 21; }
+inline int f8104_22(int x) { return x * 22; }
+inline int f8104_23(int x) { return x * 23; }
+inline int f8104_24(int x) { return x * 24; }
+inline int f8104_25(int x) { return x * 25; }
+inline int f8104_26(int x) { return x * 26; }
+inline int f8104_27(int x) { return x * 27; }
+inline int f8104_28(int x) { return x * 28; }
+inline int f8104_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8107 */
+#include <vector>
+#include "h5537.h"
+#include "h5387.h"
+#include "h4161.h"
+#include "h4943.h"
+#include "h9756.h"
+#ifdef X
+#include "h2292.h"
+#endif
+struct S8107 { int a; const char *s = "x//y"; };
+inline int f8107_0(int x) { return x * 0; }
+inline int f8107_1(int x) { return x * 1; }
+inline int f8107_2(int x) { return x * 2; }
+inline int f8107_3(int x) { return x * 3; }
+inline int f8107_4(int x) { return x * 4; }
+inline int f8107_5(int x) { return x * 5; }
+inline int f8107_6(int x) { return x * 6; }
+inline int f8107_7(int x) { return x * 7; }
+inline int f8107_8(int x) { return x * 8; }
+inline int f8107_9(int x) { return x * 9; }
+inline int f8107_10(int x) { return x * 10; }
+inline int f8107_11(int x) { return x * 11; }
+inline int f8107_12(int x) { return x * 12; }
+inline int f8107_13(int x) { return x * 13; }
+inline int f8107_14(int x) { return x * 14; }
+inline int f8107_15(int x) { return x * 15; }
+inline int f8107_16(int x) { return x * 16; }
+inline int f8107_17(int x) { return x * 17; }
+inline int f8107_18(int x) { return x * 18; }
+inline int f8107_19(int x) { return x * 19; }
+inline int f8107_20(int x) { return x * 20; }
+inline int f8107_21(int x) { return x * 21; }
+inline int f8107_22(int x) { return x * 22; }
+inline int f8107_23(int x) { return x * 23; }
+inline int f8107_24(int x) { return x * 24; }
+inline int f8107_25(int x) { return x * 25; }
+inline int f8107_26(int x) { return x * 26; }
+inline int f8107_27(int x) { return x * 27; }
+inline int f8107_28(int x) { return x * 28; }
+inline int f8107_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8108 */
+#include <vector>
+#include "h5752.h"
+#include "h118.h"
+#include "h9680.h"
+#include "h3206.h"
+#include "h8811.h"
+#ifdef X
+#include "h3063.h"
+#endif
+struct S8108 { int a; const char *s = "x//y"; };
+inline int f8108_0(int x) { return x * 0; }
+inline int f8108_1(int x) { return x * 1; }
+inline int f8108_2(int x) { return x * 2; }
+inline int f8108_3(int x) { return x * 3; }
+inline int f8108_4(int x) { return x * 4; }
+inline int f8108_5(int x) { return x * 5; }
+inline int f8108_6(int x) { return x * 6; }
+inline int f8108_7(int x) { return x * 7; }
+inline int f8108_8(int x) { return x * 8; }
+inline int f8108_9(int x) { return x * 9; }
+inline int f8108_10(int x) { return x * 10; }
+inline int f8108_11(int x) { return x * 11; }
+inline int f8108_12(int x) { return x * 12; }
+inline int f8108_13(int x) { return x * 13; }
+inline int f8108_14(int x) { return x * 14; }
+inline int f8108_15(int x) { return x * 15; }
+inline int f8108_16(int x) { return x * 16; }
+inline int f8108_17(int x) { return x * 17; }
+inline int f8108_18(int x) { return x * 18; }
+inline int f8108_19(int x) { return x * 19; }
+inline int f8108_20(int x) { return x * 20; }
+inline int f8108_21(int x) { return x * 21; }
+inline int f8108_22(int x) { return x * 22; }
+inline int f8108_23(int x) { return x * 23; }
+inline int f8108_24(int x) { return x * 24; }
+inline int f8108_25(int x) { return x * 25; }
+inline int f8108_26(int x) { return x * 26; }
+inline int f8108_27(int x) { return x * 27; }
+inline int f8108_28(int x) { return x * 28; }
+inline int f8108_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8109 */
+#include <vector>
+#include "h8102.h"
+#include "h3320.h"
+#include "h2525.h"
+#include "h7647.h"
+#include "h2494.h"
+#ifdef X
+#include "h5880.h"
+#endif
+struct S8109 { int a; const char *s = "x//y"; };
+inline int f8109_0(int x) { return x * 0; }
+inline int f8109_1(int x) { return x * 1; }
+inline int f8109_2(int x) { return x * 2; }
+inline int f8109_3(int x) { return x * 3; }
+inline int f8109_4(int x) { return x * 4; }
+inline int f8109_5(int x) { return x * 5; }
+inline int f8109_6(int x) { return x * 6; }
+inline int f8109_7(int x) { return x * 7; }
+inline int f8109_8(int x) { return x * 8; }
+inline int f8109_9(int x) { return x * 9; }
+inline int f8109_10(int x) { return x * 10; }
+inline int f8109_11(int x) { return x * 11; }
+inline int f8109_12(int x) { return x * 12; }
+inline int f8109_13(int x) { return x * 13; }
+inline int f8109_14(int x) { return x * 14; }
+inline int f8109_15(int x) { return x * 15; }
+inline int f8109_16(int x) { return x * 16; }
+inline int f8109_17(int x) { return x * 17; }
+inline int f8109_18(int x) { return x * 18; }
+inline int f8109_19(int x) { return x * 19; }
+inline int f8109_20(int x) { return x * 20; }
+inline int f8109_21(int x) { return x * 21; }
+inline int f8109_22(int x) { return x * 22; }
+inline int f8109_23(int x) { return x * 23; }
+inline int f8109_24(int x) { return x * 24; }
+inline int f8109_25(int x) { return x * 25; }
+inline int f8109_26(int x) { return x * 26; }
+inline int f8109_27(int x) { return x * 27; }
+inline int f8109_28(int x) { return x * 28; }
+inline int f8109_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 811 */
+#include <vector>
+#include "h9367.h"
+#include "h1761.h"
+#include "h3978.h"
+#include "h3083.h"
+#include "h6835.h"
+#ifdef X
+#include "h8859.h"
+#endif
+struct S811 { int a; const char *s = "x//y"; };
+inline int f811_0(int x) { return x * 0; }
+inline int f811_1(int x) { return x * 1; }
+inline int f811_2(int x) { return x * 2; }
+inline int f811_3(int x) { return x * 3; }
+inline int f811_4(int x) { return x * 4; }
+inline int f811_5(int x) { return x * 5; }
+inline int f811_6(int x) { return x * 6; }
+inline int f811_7(int x) { return x * 7; }
+inline int f811_8(int x) { return x * 8; }
+inline int f811_9(int x) { return x * 9; }
+inline int f811_10(int x) { return x * 10; }
+inline int f811_11(int x) { return x * 11; }
+inline int f811_12(int x) { return x * 12; }
+inline int f811_13(int x) { return x * 13; }
+inline int f811_14(int x) { return x * 14; }
+inline int f811_15(int x) { return x * 15; }
+inline int f811_16(int x) { return x * 16; }
+inline int f811_17(int x) { return x * 17; }
+inline int f811_18(int x) { return x * 18; }
+inline int f811_19(int x) { return x * 19; }
+inline int f811_20(int x) { return x * 20; }
+inline int f811_21(int x) { return x * 21; }
+inline int f811_22(int x) { return x * 22; }
+inline int f811_23(int x) { return x * 23; }
+inline int f811_24(int x) { return x * 24; }
+inline int f811_25(int x) { return x * 25; }
+inline int f811_26(int x) { return x * 26; }
+inline int f811_27(int x) { return x * 27; }
+inline int f811_28(int x) { return x * 28; }
+inline int f811_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8115 */
+#include <vector>
+#include "h7754.h"
+#include "h6030.h"
+#include "h6944.h"
+#include "h2196.h"
+#include "h8152.h"
+#ifdef X
+#include "h9466.h"
+#endif
+struct S8115 { int a; const char *s = "x//y"; };
+inline int f8115_0(int x) { return x * 0; }
+inline int f8115_1(int x) { return x * 1; }
+inline int f8115_2(int x) { return x * 2; }
+inline int f8115_3(int x) { return x * 3; }
+inline int f8115_4(int x) { return x * 4; }
+inline int f8115_5(int x) { return x * 5; }
+inline int f8115_6(int x) { return x * 6; }
+inline int f8115_7(int x) { return x * 7; }
+inline int f8115_8(int x) { return x * 8; }
+inline int f8115_9(int x) { return x * 9; }
+inline int f8115_10(int x) { return x * 10; }
+inline int f8115_11(int x) { return x * 11; }
+inline int f8115_12(int x) { return x * 12; }
+inline int f8115_13(int x) { return x * 13; }
+inline int f8115_14(int x) { return x * 14; }
+inline int f8115_15(int x) { return x * 15; }
+inline int f8115_16(int x) { return x * 16; }
+inline int f8115_17(int x) { return x * 17; }
+inline int f8115_18(int x) { return x * 18; }
+inline int f8115_19(int x) { return x * 19; }
+inline int f8115_20(int x) { return x * 20; }
+inline int f8115_21(int x) { return x * 21; }
+inline int f8115_22(int x) { return x * 22; }
+inline int f8115_23(int x) { return x * 23; }
+inline int f8115_24(int x) { return x * 24; }
+inline int f8115_25(int x) { return x * 25; }
+inline int f8115_26(int x) { return x * 26; }
+inline int f8115_27(int x) { return x * 27; }
+inline int f8115_28(int x) { return x * 28; }
+inline int f8115_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8116 */
+#include <vector>
+#include "h8508.h"
+#include "h2577.h"
+#include "h535.h"
+#include "h9758.h"
+#include "h3354.h"
+#ifdef X
+#include "h6162.h"
+#endif
+struct S8116 { int a; const char *s = "x//y"; };
+inline int f8116_0(int x) { return x * 0; }
+inline int f8116_1(int x) { return x * 1; }
+inline int f8116_2(int x) { return x * 2; }
+inline int f8116_3(int x) { return x * 3; }
+inline int f8116_4(int x) { return x * 4; }
+inline int f8116_5(int x) { return x * 5; }
+inline int f8116_6(int x) { return x * 6; }
+inline int f8116_7(int x) { return x * 7; }
+inline int f8116_8(int x) { return x * 8; }
+inline int f8116_9(int x) { return x * 9; }
+inline int f8116_10(int x) { return x * 10; }
+inline int f8116_11(int x) { return x * 11; }
+inline int f8116_12(int x) { return x * 12; }
+inline int f8116_13(int x) { return x * 13; }
+inline int f8116_14(int x) { return x * 14; }
+inline int f8116_15(int x) { return x * 15; }
+inline int f8116_16(int x) { return x * 16; }
+inline int f8116_17(int x) { return x * 17; }
+inline int f8116_18(int x) { return x * 18; }
+inline int f8116_19(int x) { return x * 19; }
+inline int f8116_20(int x) { return x * 20; }
+inline int f8116_21(int x) { return x * 21; }
+inline int f8116_22(int x) { return x * 22; }
+inline int f8116_23(int x) { return x * 23; }
+inline int f8116_24(int x) { return x * 24; }
+inline int f8116_25(int x) { return x * 25; }
+inline int f8116_26(int x) { return x * 26; }
+inline int f8116_27(int x) { return x * 27; }
+inline int f8116_28(int x) { return x * 28; }
+inline int f8116_29(int x) { return x * 29; }
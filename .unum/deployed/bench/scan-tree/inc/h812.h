@@ -0,0 +1,42 @@
+#pragma once
+/* header 812 */
+#include <vector>
+#include "h4841.h"
+#include "h5411.h"
+#include "h1498.h"
+#include "h2666.h"
+#include "h2196.h"
+#ifdef X
+#include "h839.h"
+#endif
+struct S812 { int a; const char *s = "x//y"; };
+inline int f812_0(int x) { return x * 0; }
+inline int f812_1(int x) { return x * 1; }
+inline int f812_2(int x) { return x * 2; }
+inline int f812_3(int x) { return x * 3; }
+inline int f812_4(int x) { return x * 4; }
+inline int f812_5(int x) { return x * 5; }
+inline int f812_6(int x) { return x * 6; }
+inline int f812_7(int x) { return x * 7; }
+inline int f812_8(int x) { return x * 8; }
+inline int f812_9(int x) { return x * 9; }
+inline int f812_10(int x) { return x * 10; }
+inline int f812_11(int x) { return x * 11; }
+inline int f812_12(int x) { return x * 12; }
+inline int f812_13(int x) { return x * 13; }
+inline int f812_14(int x) { return x * 14; }
+inline int f812_15(int x) { return x * 15; }
+inline int f812_16(int x) { return x * 16; }
+inline int f812_17(int x) { return x * 17; }
+inline int f812_18(int x) { return x * 18; }
+inline int f812_19(int x) { return x * 19; }
+inline int f812_20(int x) { return x * 20; }
+inline int f812_21(int x) { return x * 21; }
+inline int f812_22(int x) { return x * 22; }
+inline int f812_23(int x) { return x * 23; }
+inline int f812_24(int x) { return x * 24; }
+inline int f812_25(int x) { return x * 25; }
+inline int f812_26(int x) { return x * 26; }
+inline int f812_27(int x) { return x * 27; }
+inline int f812_28(int x) { return x * 28; }
+inline int f812_29(int x) { return x * 29; }
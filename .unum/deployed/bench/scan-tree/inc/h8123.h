@@ -0,0 +1,42 @@
+#pragma once
+/* header 8123 */
+#include <vector>
+#include "h7133.h"
+#include "h4101.h"
+#include "h3724.h"
+#include "h193.h"
+#include "h4580.h"
+#ifdef X
+#include "h298.h"
+#endif
+struct S8123 { int a; const char *s = "x//y"; };
+inline int f8123_0(int x) { return x * 0; }
+inline int f8123_1(int x) { return x * 1; }
+inline int f8123_2(int x) { return x * 2; }
+inline int f8123_3(int x) { return x * 3; }
+inline int f8123_4(int x) { return x * 4; }
+inline int f8123_5(int x) { return x * 5; }
+inline int f8123_6(int x) { return x * 6; }
+inline int f8123_7(int x) { return x * 7; }
+inline int f8123_8(int x) { return x * 8; }
+inline int f8123_9(int x) { return x * 9; }
+inline int f8123_10(int x) { return x * 10; }
+inline int f8123_11(int x) { return x * 11; }
+inline int f8123_12(int x) { return x * 12; }
+inline int f8123_13(int x) { return x * 13; }
+inline int f8123_14(int x) { return x * 14; }
+inline int f8123_15(int x) { return x * 15; }
+inline int f8123_16(int x) { return x * 16; }
+inline int f8123_17(int x) { return x * 17; }
+inline int f8123_18(int x) { return x * 18; }
+inline int f8123_19(int x) { return x * 19; }
+inline int f8123_20(int x) { return x * 20; }
+inline int f8123_21(int x) { return x * 21; }
+inline int f8123_22(int x) { return x * 22; }
+inline int f8123_23(int x) { return x * 23; }
+inline int f8123_24(int x) { return x * 24; }
+inline int f8123_25(int x) { return x * 25; }
+inline int f8123_26(int x) { return x * 26; }
+inline int f8123_27(int x) { return x * 27; }
+inline int f8123_28(int x) { return x * 28; }
+inline int f8123_29(int x) { return x * 29; }
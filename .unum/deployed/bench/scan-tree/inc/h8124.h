@@ -0,0 +1,42 @@
+#pragma once
+/* header 8124 */
+#include <vector>
+#include "h1658.h"
+#include "h4522.h"
+#include "h6906.h"
+#include "h2621.h"
+#include "h2807.h"
+#ifdef X
+#include "h4343.h"
+#endif
+struct S8124 { int a; const char *s = "x//y"; };
+inline int f8124_0(int x) { return x * 0; }
+inline int f8124_1(int x) { return x * 1; }
+inline int f8124_2(int x) { return x * 2; }
+inline int f8124_3(int x) { return x * 3; }
+inline int f8124_4(int x) { return x * 4; }
+inline int f8124_5(int x) { return x * 5; }
+inline int f8124_6(int x) { return x * 6; }
+inline int f8124_7(int x) { return x * 7; }
+inline int f8124_8(int x) { return x * 8; }
+inline int f8124_9(int x) { return x * 9; }
+inline int f8124_10(int x) { return x * 10; }
+inline int f8124_11(int x) { return x * 11; }
+inline int f8124_12(int x) { return x * 12; }
+inline int f8124_13(int x) { return x * 13; }
+inline int f8124_14(int x) { return x * 14; }
+inline int f8124_15(int x) { return x * 15; }
+inline int f8124_16(int x) { return x * 16; }
+inline int f8124_17(int x) { return x * 17; }
+inline int f8124_18(int x) { return x * 18; }
+inline int f8124_19(int x) { return x * 19; }
+inline int f8124_20(int x) { return x * 20; }
+inline int f8124_21(int x) { return x * 21; }
+inline int f8124_22(int x) { return x * 22; }
+inline int f8124_23(int x) { return x * 23; }
+inline int f8124_24(int x) { return x * 24; }
+inline int f8124_25(int x) { return x * 25; }
+inline int f8124_26(int x) { return x * 26; }
+inline int f8124_27(int x) { return x * 27; }
+inline int f8124_28(int x) { return x * 28; }
+inline int f8124_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8125 */
+#include <vector>
+#include "h1135.h"
+#include "h1415.h"
+#include "h1090.h"
+#include "h4077.h"
+#include "h9967.h"
+#ifdef X
+#include "h6201.h"
+#endif
+struct S8125 { int a; const char *s = "x//y"; };
+inline int f8125_0(int x) { return x * 0; }
+inline int f8125_1(int x) { return x * 1; }
+inline int f8125_2(int x) { return x * 2; }
+inline int f8125_3(int x) { return x * 3; }
+inline int f8125_4(int x) { return x * 4; }
+inline int f8125_5(int x) { return x * 5; }
+inline int f8125_6(int x) { return x * 6; }
+inline int f8125_7(int x) { return x * 7; }
+inline int f8125_8(int x) { return x * 8; }
+inline int f8125_9(int x) { return x * 9; }
+inline int f8125_10(int x) { return x * 10; }
+inline int f8125_11(int x) { return x * 11; }
+inline int f8125_12(int x) { return x * 12; }
+inline int f8125_13(int x) { return x * 13; }
+inline int f8125_14(int x) { return x * 14; }
+inline int f8125_15(int x) { return x * 15; }
+inline int f8125_16(int x) { return x * 16; }
+inline int f8125_17(int x) { return x * 17; }
+inline int f8125_18(int x) { return x * 18; }
+inline int f8125_19(int x) { return x * 19; }
+inline int f8125_20(int x) { return x * 20; }
+inline int f8125_21(int x) { return x * 21; }
+inline int f8125_22(int x) { return x * 22; }
+inline int f8125_23(int x) { return x * 23; }
+inline int f8125_24(int x) { return x * 24; }
+inline int f8125_25(int x) { return x * 25; }
+inline int f8125_26(int x) { return x * 26; }
+inline int f8125_27(int x) { return x * 27; }
+inline int f8125_28(int x) { return x * 28; }
+inline int f8125_29(int x) { return x * 29; }
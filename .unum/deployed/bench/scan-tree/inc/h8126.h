@@ -0,0 +1,42 @@
+#pragma once
+/* header 8126 */
+#include <vector>
+#include "h2788.h"
+#include "h7696.h"
+#include "h5698.h"
+#include "h3166.h"
+#include "h2701.h"
+#ifdef X
+#include "h3319.h"
+#endif
+struct S8126 { int a; const char *s = "x//y"; };
+inline int f8126_0(int x) { return x * 0; }
+inline int f8126_1(int x) { return x * 1; }
+inline int f8126_2(int x) { return x * 2; }
+inline int f8126_3(int x) { return x * 3; }
+inline int f8126_4(int x) { return x * 4; }
+inline int f8126_5(int x) { return x * 5; }
+inline int f8126_6(int x) { return x * 6; }
+inline int f8126_7(int x) { return x * 7; }
+inline int f8126_8(int x) { return x * 8; }
+inline int f8126_9(int x) { return x * 9; }
+inline int f8126_10(int x) { return x * 10; }
+inline int f8126_11(int x) { return x * 11; }
+inline int f8126_12(int x) { return x * 12; }
+inline int f8126_13(int x) { return x * 13; }
+inline int f8126_14(int x) { return x * 14; }
+inline int f8126_15(int x) { return x * 15; }
+inline int f8126_16(int x) { return x * 16; }
+inline int f8126_17(int x) { return x * 17; }
+inline int f8126_18(int x) { return x * 18; }
+inline int f8126_19(int x) { return x * 19; }
+inline int f8126_20(int x) { return x * 20; }
+inline int f8126_21(int x) { return x * 21; }
+inline int f8126_22(int x) { return x * 22; }
+inline int f8126_23(int x) { return x * 23; }
+inline int f8126_24(int x) { return x * 24; }
+inline int f8126_25(int x) { return x * 25; }
+inline int f8126_26(int x) { return x * 26; }
+inline int f8126_27(int x) { return x * 27; }
+inline int f8126_28(int x) { return x * 28; }
+inline int f8126_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8127 */
+#include <vector>
+#include "h1415.h"
+#include "h429.h"
+#include "h2663.h"
+#include "h4188.h"
+#include "h4006.h"
+#ifdef X
+#include "h6754.h"
+#endif
+struct S8127 { int a; const char *s = "x//y"; };
+inline int f8127_0(int x) { return x * 0; }
+inline int f8127_1(int x) { return x * 1; }
+inline int f8127_2(int x) { return x * 2; }
+inline int f8127_3(int x) { return x * 3; }
+inline int f8127_4(int x) { return x * 4; }
+inline int f8127_5(int x) { return x * 5; }
+inline int f8127_6(int x) { return x * 6; }
+inline int f8127_7(int x) { return x * 7; }
+inline int f8127_8(int x) { return x * 8; }
+inline int f8127_9(int x) { return x * 9; }
+inline int f8127_10(int x) { return x * 10; }
+inline int f8127_11(int x) { return x * 11; }
+inline int f8127_12(int x) { return x * 12; }
+inline int f8127_13(int x) { return x * 13; }
+inline int f8127_14(int x) { return x * 14; }
+inline int f8127_15(int x) { return x * 15; }
+inline int f8127_16(int x) { return x * 16; }
+inline int f8127_17(int x) { return x * 17; }
+inline int f8127_18(int x) { return x * 18; }
+inline int f8127_19(int x) { return x * 19; }
+inline int f8127_20(int x) { return x * 20; }
+inline int f8127_21(int x) { return x * 21; }
+inline int f8127_22(int x) { return x * 22; }
+inline int f8127_23(int x) { return x * 23; }
+inline int f8127_24(int x) { return x * 24; }
+inline int f8127_25(int x) { return x * 25; }
+inline int f8127_26(int x) { return x * 26; }
+inline int f8127_27(int x) { return x * 27; }
+inline int f8127_28(int x) { return x * 28; }
+inline int f8127_29(int x) { return x * 29; }
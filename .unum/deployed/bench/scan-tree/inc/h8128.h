@@ -0,0 +1,42 @@
+#pragma once
+/* header 8128 */
+#include <vector>
+#include "h8234.h"
+#include "h2588.h"
+#include "h3379.h"
+#include "h7588.h"
+#include "h2119.h"
+#ifdef X
+#include "h2303.h"
+#endif
+struct S8128 { int a; const char *s = "x//y"; };
+inline int f8128_0(int x) { return x * 0; }
+inline int f8128_1(int x) { return x * 1; }
+inline int f8128_2(int x) { return x * 2; }
+inline int f8128_3(int x) { return x * 3; }
+inline int f8128_4(int x) { return x * 4; }
+inline int f8128_5(int x) { return x * 5; }
+inline int f8128_6(int x) { return x * 6; }
+inline int f8128_7(int x) { return x * 7; }
+inline int f8128_8(int x) { return x * 8; }
+inline int f8128_9(int x) { return x * 9; }
+inline int f8128_10(int x) { return x * 10; }
+inline int f8128_11(int x) { return x * 11; }
+inline int f8128_12(int x) { return x * 12; }
+inline int f8128_13(int x) { return x * 13; }
+inline int f8128_14(int x) { return x * 14; }
+inline int f8128_15(int x) { return x * 15; }
+inline int f8128_16(int x) { return x * 16; }
+inline int f8128_17(int x) { return x * 17; }
+inline int f8128_18(int x) { return x * 18; }
+inline int f8128_19(int x) { return x * 19; }
+inline int f8128_20(int x) { return x * 20; }
+inline int f8128_21(int x) { return x * 21; }
+inline int f8128_22(int x) { return x * 22; }
+inline int f8128_23(int x) { return x * 23; }
+inline int f8128_24(int x) { return x * 24; }
+inline int f8128_25(int x) { return x * 25; }
+inline int f8128_26(int x) { return x * 26; }
+inline int f8128_27(int x) { return x * 27; }
+inline int f8128_28(int x) { return x * 28; }
+inline int f8128_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8129 */
+#include <vector>
+#include "h154.h"
+#include "h5295.h"
+#include "h768.h"
+#include "h6470.h"
+#include "h8654.h"
+#ifdef X
+#include "h5669.h"
+#endif
+struct S8129 { int a; const char *s = "x//y"; };
+inline int f8129_0(int x) { return x * 0; }
+inline int f8129_1(int x) { return x * 1; }
+inline int f8129_2(int x) { return x * 2; }
+inline int f8129_3(int x) { return x * 3; }
+inline int f8129_4(int x) { return x * 4; }
+inline int f8129_5(int x) { return x * 5; }
+inline int f8129_6(int x) { return x * 6; }
+inline int f8129_7(int x) { return x * 7; }
+inline int f8129_8(int x) { return x * 8; }
+inline int f8129_9(int x) { return x * 9; }
+inline int f8129_10(int x) { return x * 10; }
+inline int f8129_11(int x) { return x * 11; }
+inline int f8129_12(int x) { return x * 12; }
+inline int f8129_13(int x) { return x * 13; }
+inline int f8129_14(int x) { return x * 14; }
+inline int f8129_15(int x) { return x * 15; }
+inline int f8129_16(int x) { return x * 16; }
+inline int f8129_17(int x) { return x * 17; }
+inline int f8129_18(int x) { return x * 18; }
+inline int f8129_19(int x) { return x * 19; }
+inline int f8129_20(int x) { return x * 20; }
+inline int f8129_21(int x) { return x * 21; }
+inline int f8129_22(int x) { return x * 22; }
+inline int f8129_23(int x) { return x * 23; }
+inline int f8129_24(int x) { return x * 24; }
+inline int f8129_25(int x) { return x * 25; }
+inline int f8129_26(int x) { return x * 26; }
+inline int f8129_27(int x) { return x * 27; }
+inline int f8129_28(int x) { return x * 28; }
+inline int f8129_29(int x) { return x * 29; }
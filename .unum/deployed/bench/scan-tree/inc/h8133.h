@@ -0,0 +1,42 @@
+#pragma once
+/* header 8133 */
+#include <vector>
+#include "h7491.h"
+#include "h6220.h"
+#include "h699.h"
+#include "h5064.h"
+#include "h8378.h"
+#ifdef X
+#include "h870.h"
+#endif
+struct S8133 { int a; const char *s = "x//y"; };
+inline int f8133_0(int x) { return x * 0; }
+inline int f8133_1(int x) { return x * 1; }
+inline int f8133_2(int x) { return x * 2; }
+inline int f8133_3(int x) { return x * 3; }
+inline int f8133_4(int x) { return x * 4; }
+inline int f8133_5(int x) { return x * 5; }
+inline int f8133_6(int x) { return x * 6; }
+inline int f8133_7(int x) { return x * 7; }
+inline int f8133_8(int x) { return x * 8; }
+inline int f8133_9(int x) { return x * 9; }
+inline int f8133_10(int x) { return x * 10; }
+inline int f8133_11(int x) { return x * 11; }
+inline int f8133_12(int x) { return x * 12; }
+inline int f8133_13(int x) { return x * 13; }
+inline int f8133_14(int x) { return x * 14; }
+inline int f8133_15(int x) { return x * 15; }
+inline int f8133_16(int x) { return x * 16; }
+inline int f8133_17(int x) { return x * 17; }
+inline int f8133_18(int x) { return x * 18; }
+inline int f8133_19(int x) { return x * 19; }
+inline int f8133_20(int x) { return x * 20; }
+inline int f8133_21(int x) { return x * 21; }
+inline int f8133_22(int x) { return x * 22; }
+inline int f8133_23(int x) { return x * 23; }
+inline int f8133_24(int x) { return x * 24; }
+inline int f8133_25(int x) { return x * 25; }
+inline int f8133_26(int x) { return x * 26; }
+inline int f8133_27(int x) { return x * 27; }
+inline int f8133_28(int x) { return x * 28; }
+inline int f8133_29(int x) { return x * 29; }
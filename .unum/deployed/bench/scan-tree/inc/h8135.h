@@ -0,0 +1,42 @@
+#pragma once
+/* header 8135 */
+#include <vector>
+#include "h5874.h"
+#include "h5570.h"
+#include "h3253.h"
+#include "h4152.h"
+#include "h6535.h"
+#ifdef X
+#include "h9599.h"
+#endif
+struct S8135 { int a; const char *s = "x//y"; };
+inline int f8135_0(int x) { return x * 0; }
+inline int f8135_1(int x) { return x * 1; }
+inline int f8135_2(int x) { return x * 2; }
+inline int f8135_3(int x) { return x * 3; }
+inline int f8135_4(int x) { return x * 4; }
+inline int f8135_5(int x) { return x * 5; }
+inline int f8135_6(int x) { return x * 6; }
+inline int f8135_7(int x) { return x * 7; }
+inline int f8135_8(int x) { return x * 8; }
+inline int f8135_9(int x) { return x * 9; }
+inline int f8135_10(int x) { return x * 10; }
+inline int f8135_11(int x) { return x * 11; }
+inline int f8135_12(int x) { return x * 12; }
+inline int f8135_13(int x) { return x * 13; }
+inline int f8135_14(int x) { return x * 14; }
+inline int f8135_15(int x) { return x * 15; }
+inline int f8135_16(int x) { return x * 16; }
+inline int f8135_17(int x) { return x * 17; }
+inline int f8135_18(int x) { return x * 18; }
+inline int f8135_19(int x) { return x * 19; }
+inline int f8135_20(int x) { return x * 20; }
+inline int f8135_21(int x) { return x * 21; }
+inline int f8135_22(int x) { return x * 22; }
+inline int f8135_23(int x) { return x * 23; }
+inline int f8135_24(int x) { return x * 24; }
+inline int f8135_25(int x) { return x * 25; }
+inline int f8135_26(int x) { return x * 26; }
+inline int f8135_27(int x) { return x * 27; }
+inline int f8135_28(int x) { return x * 28; }
+inline int f8135_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8137 */
+#include <vector>
+#include "h6521.h"
+#include "h1410.h"
+#include "h3418.h"
+#include "h262.h"
+#include "h5733.h"
+#ifdef X
+#include "h9779.h"
+#endif
+struct S8137 { int a; const char *s = "x//y"; };
+inline int f8137_0(int x) { return x * 0; }
+inline int f8137_1(int x) { return x * 1; }
+inline int f8137_2(int x) { return x * 2; }
+inline int f8137_3(int x) { return x * 3; }
+inline int f8137_4(int x) { return x * 4; }
+inline int f8137_5(int x) { return x * 5; }
+inline int f8137_6(int x) { return x * 6; }
+inline int f8137_7(int x) { return x * 7; }
+inline int f8137_8(int x) { return x * 8; }
+inline int f8137_9(int x) { return x * 9; }
+inline int f8137_10(int x) { return x * 10; }
+inline int f8137_11(int x) { return x * 11; }
+inline int f8137_12(int x) { return x * 12; }
+inline int f8137_13(int x) { return x * 13; }
+inline int f8137_14(int x) { return x * 14; }
+inline int f8137_15(int x) { return x * 15; }
+inline int f8137_16(int x) { return x * 16; }
+inline int f8137_17(int x) { return x * 17; }
+inline int f8137_18(int x) { return x * 18; }
+inline int f8137_19(int x) { return x * 19; }
+inline int f8137_20(int x) { return x * 20; }
+inline int f8137_21(int x) { return x * 21; }
+inline int f8137_22(int x) { return x * 22; }
+inline int f8137_23(int x) { return x * 23; }
+inline int f8137_24(int x) { return x * 24; }
+inline int f8137_25(int x) { return x * 25; }
+inline int f8137_26(int x) { return x * 26; }
+inline int f8137_27(int x) { return x * 27; }
+inline int f8137_28(int x) { return x * 28; }
+inline int f8137_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8138 */
+#include <vector>
+#include "h598.h"
+#include "h3373.h"
+#include "h6017.h"
+#include "h953.h"
+#include "h5301.h"
+#ifdef X
+#include "h7416.h"
+#endif
+struct S8138 { int a; const char *s = "x//y"; };
+inline int f8138_0(int x) { return x * 0; }
+inline int f8138_1(int x) { return x * 1; }
+inline int f8138_2(int x) { return x * 2; }
+inline int f8138_3(int x) { return x * 3; }
+inline int f8138_4(int x) { return x * 4; }
+inline int f8138_5(int x) { return x * 5; }
+inline int f8138_6(int x) { return x * 6; }
+inline int f8138_7(int x) { return x * 7; }
+inline int f8138_8(int x) { return x * 8; }
+inline int f8138_9(int x) { return x * 9; }
+inline int f8138_10(int x) { return x * 10; }
+inline int f8138_11(int x) { return x * 11; }
+inline int f8138_12(int x) { return x * 12; }
+inline int f8138_13(int x) { return x * 13; }
+inline int f8138_14(int x) { return x * 14; }
+inline int f8138_15(int x) { return x * 15; }
+inline int f8138_16(int x) { return x * 16; }
+inline int f8138_17(int x) { return x * 17; }
+inline int f8138_18(int x) { return x * 18; }
+inline int f8138_19(int x) { return x * 19; }
+inline int f8138_20(int x) { return x * 20; }
+inline int f8138_21(int x) { return x * 21; }
+inline int f8138_22(int x) { return x * 22; }
+inline int f8138_23(int x) { return x * 23; }
+inline int f8138_24(int x) { return x * 24; }
+inline int f8138_25(int x) { return x * 25; }
+inline int f8138_26(int x) { return x * 26; }
+inline int f8138_27(int x) { return x * 27; }
+inline int f8138_28(int x) { return x * 28; }
+inline int f8138_29(int x) { return x * 29; }
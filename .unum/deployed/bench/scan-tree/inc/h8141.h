@@ -0,0 +1,42 @@
+#pragma once
+/* header 8141 */
+#include <vector>
+#include "h6546.h"
+#include "h9636.h"
+#include "h8022.h"
+#include "h5989.h"
+#include "h5594.h"
+#ifdef X
+#include "h5940.h"
+#endif
+struct S8141 { int a; const char *s = "x//y"; };
+inline int f8141_0(int x) { return x * 0; }
+inline int f8141_1(int x) { return x * 1; }
+inline int f8141_2(int x) { return x * 2; }
+inline int f8141_3(int x) { return x * 3; }
+inline int f8141_4(int x) { return x * 4; }
+inline int f8141_5(int x) { return x * 5; }
+inline int f8141_6(int x) { return x * 6; }
+inline int f8141_7(int x) { return x * 7; }
+inline int f8141_8(int x) { return x * 8; }
+inline int f8141_9(int x) { return x * 9; }
+inline int f8141_10(int x) { return x * 10; }
+inline int f8141_11(int x) { return x * 11; }
+inline int f8141_12(int x) { return x * 12; }
+inline int f8141_13(int x) { return x * 13; }
+inline int f8141_14(int x) { return x * 14; }
+inline int f8141_15(int x) { return x * 15; }
+inline int f8141_16(int x) { return x * 16; }
+inline int f8141_17(int x) { return x * 17; }
+inline int f8141_18(int x) { return x * 18; }
+inline int f8141_19(int x) { return x * 19; }
+inline int f8141_20(int x) { return x * 20; }
+inline int f8141_21(int x) { return x * 21; }
+inline int f8141_22(int x) { return x * 22; }
+inline int f8141_23(int x) { return x * 23; }
+inline int f8141_24(int x) { return x * 24; }
+inline int f8141_25(int x) { return x * 25; }
+inline int f8141_26(int x) { return x * 26; }
+inline int f8141_27(int x) { return x * 27; }
+inline int f8141_28(int x) { return x * 28; }
+inline int f8141_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8143 */
+#include <vector>
+#include "h9384.h"
+#include "h492.h"
+#include "h2173.h"
+#include "h3309.h"
+#include "h9624.h"
+#ifdef X
+#include "h1046.h"
+#endif
+struct S8143 { int a; const char *s = "x//y"; };
+inline int f8143_0(int x) { return x * 0; }
+inline int f8143_1(int x) { return x * 1; }
+inline int f8143_2(int x) { return x * 2; }
+inline int f8143_3(int x) { return x * 3; }
+inline int f8143_4(int x) { return x * 4; }
+inline int f8143_5(int x) { return x * 5; }
+inline int f8143_6(int x) { return x * 6; }
+inline int f8143_7(int x) { return x * 7; }
+inline int f8143_8(int x) { return x * 8; }
+inline int f8143_9(int x) { return x * 9; }
+inline int f8143_10(int x) { return x * 10; }
+inline int f8143_11(int x) { return x * 11; }
+inline int f8143_12(int x) { return x * 12; }
+inline int f8143_13(int x) { return x * 13; }
+inline int f8143_14(int x) { return x * 14; }
+inline int f8143_15(int x) { return x * 15; }
+inline int f8143_16(int x) { return x * 16; }
+inline int f8143_17(int x) { return x * 17; }
+inline int f8143_18(int x) { return x * 18; }
+inline int f8143_19(int x) { return x * 19; }
+inline int f8143_20(int x) { return x * 20; }
+inline int f8143_21(int x) { return x * 21; }
+inline int f8143_22(int x) { return x * 22; }
+inline int f8143_23(int x) { return x * 23; }
+inline int f8143_24(int x) { return x * 24; }
+inline int f8143_25(int x) { return x * 25; }
+inline int f8143_26(int x) { return x * 26; }
+inline int f8143_27(int x) { return x * 27; }
+inline int f8143_28(int x) { return x * 28; }
+inline int f8143_29(int x) { return x * 29; }
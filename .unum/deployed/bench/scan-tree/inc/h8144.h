@@ -0,0 +1,42 @@
+#pragma once
+/* header 8144 */
+#include <vector>
+#include "h3388.h"
+#include "h1059.h"
+#include "h5392.h"
+#include "h3733.h"
+#include "h6731.h"
+#ifdef X
+#include "h9085.h"
+#endif
+struct S8144 { int a; const char *s = "x//y"; };
+inline int f8144_0(int x) { return x * 0; }
+inline int f8144_1(int x) { return x * 1; }
+inline int f8144_2(int x) { return x * 2; }
+inline int f8144_3(int x) { return x * 3; }
+inline int f8144_4(int x) { return x * 4; }
+inline int f8144_5(int x) { return x * 5; }
+inline int f8144_6(int x) { return x * 6; }
+inline int f8144_7(int x) { return x * 7; }
+inline int f8144_8(int x) { return x * 8; }
+inline int f8144_9(int x) { return x * 9; }
+inline int f8144_10(int x) { return x * 10; }
+inline int f8144_11(int x) { return x * 11; }
+inline int f8144_12(int x) { return x * 12; }
+inline int f8144_13(int x) { return x * 13; }
+inline int f8144_14(int x) { return x * 14; }
+inline int f8144_15(int x) { return x * 15; }
+inline int f8144_16(int x) { return x * 16; }
+inline int f8144_17(int x) { return x * 17; }
+inline int f8144_18(int x) { return x * 18; }
+inline int f8144_19(int x) { return x * 19; }
+inline int f8144_20(int x) { return x * 20; }
+inline int f8144_21(int x) { return x * 21; }
+inline int f8144_22(int x) { return x * 22; }
+inline int f8144_23(int x) { return x * 23; }
+inline int f8144_24(int x) { return x * 24; }
+inline int f8144_25(int x) { return x * 25; }
+inline int f8144_26(int x) { return x * 26; }
+inline int f8144_27(int x) { return x * 27; }
+inline int f8144_28(int x) { return x * 28; }
+inline int f8144_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8149 */
+#include <vector>
+#include "h9930.h"
+#include "h5851.h"
+#include "h9949.h"
+#include "h3104.h"
+#include "h6123.h"
+#ifdef X
+#include "h3658.h"
+#endif
+struct S8149 { int a; const char *s = "x//y"; };
+inline int f8149_0(int x) { return x * 0; }
+inline int f8149_1(int x) { return x * 1; }
+inline int f8149_2(int x) { return x * 2; }
+inline int f8149_3(int x) { return x * 3; }
+inline int f8149_4(int x) { return x * 4; }
+inline int f8149_5(int x) { return x * 5; }
+inline int f8149_6(int x) { return x * 6; }
+inline int f8149_7(int x) { return x * 7; }
+inline int f8149_8(int x) { return x * 8; }
+inline int f8149_9(int x) { return x * 9; }
+inline int f8149_10(int x) { return x * 10; }
+inline int f8149_11(int x) { return x * 11; }
+inline int f8149_12(int x) { return x * 12; }
+inline int f8149_13(int x) { return x * 13; }
+inline int f8149_14(int x) { return x * 14; }
+inline int f8149_15(int x) { return x * 15; }
+inline int f8149_16(int x) { return x * 16; }
+inline int f8149_17(int x) { return x * 17; }
+inline int f8149_18(int x) { return x * 18; }
+inline int f8149_19(int x) { return x * 19; }
+inline int f8149_20(int x) { return x * 20; }
+inline int f8149_21(int x) { return x * 21; }
+inline int f8149_22(int x) { return x * 22; }
+inline int f8149_23(int x) { return x * 23; }
+inline int f8149_24(int x) { return x * 24; }
+inline int f8149_25(int x) { return x * 25; }
+inline int f8149_26(int x) { return x * 26; }
+inline int f8149_27(int x) { return x * 27; }
+inline int f8149_28(int x) { return x * 28; }
+inline int f8149_29(int x) { return x * 29; }
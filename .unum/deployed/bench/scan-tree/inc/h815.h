@@ -0,0 +1,42 @@
+#pragma once
+/* header 815 */
+#include <vector>
+#include "h9758.h"
+#include "h4580.h"
+#include "h8757.h"
+#include "h1805.h"
+#include "h6623.h"
+#ifdef X
+#include "h7830.h"
+#endif
+struct S815 { int a; const char *s = "x//y"; };
+inline int f815_0(int x) { return x * 0; }
+inline int f815_1(int x) { return x * 1; }
+inline int f815_2(int x) { return x * 2; }
+inline int f815_3(int x) { return x * 3; }
+inline int f815_4(int x) { return x * 4; }
+inline int f815_5(int x) { return x * 5; }
+inline int f815_6(int x) { return x * 6; }
+inline int f815_7(int x) { return x * 7; }
+inline int f815_8(int x) { return x * 8; }
+inline int f815_9(int x) { return x * 9; }
+inline int f815_10(int x) { return x * 10; }
+inline int f815_11(int x) { return x * 11; }
+inline int f815_12(int x) { return x * 12; }
+inline int f815_13(int x) { return x * 13; }
+inline int f815_14(int x) { return x * 14; }
+inline int f815_15(int x) { return x * 15; }
+inline int f815_16(int x) { return x * 16; }
+inline int f815_17(int x) { return x * 17; }
+inline int f815_18(int x) { return x * 18; }
+inline int f815_19(int x) { return x * 19; }
+inline int f815_20(int x) { return x * 20; }
+inline int f815_21(int x) { return x * 21; }
+inline int f815_22(int x) { return x * 22; }
+inline int f815_23(int x) { return x * 23; }
+inline int f815_24(int x) { return x * 24; }
+inline int f815_25(int x) { return x * 25; }
+inline int f815_26(int x) { return x * 26; }
+inline int f815_27(int x) { return x * 27; }
+inline int f815_28(int x) { return x * 28; }
+inline int f815_29(int x) { return x * 29; }
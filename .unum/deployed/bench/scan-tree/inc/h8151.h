@@ -0,0 +1,42 @@
+#pragma once
+/* header 8151 */
+#include <vector>
+#include "h5680.h"
+#include "h9882.h"
+#include "h6076.h"
+#include "h1736.h"
+#include "h6452.h"
+#ifdef X
+#include "h6651.h"
+#endif
+struct S8151 { int a; const char *s = "x//y"; };
+inline int f8151_0(int x) { return x * 0; }
+inline int f8151_1(int x) { return x * 1; }
+inline int f8151_2(int x) { return x * 2; }
+inline int f8151_3(int x) { return x * 3; }
+inline int f8151_4(int x) { return x * 4; }
+inline int f8151_5(int x) { return x * 5; }
+inline int f8151_6(int x) { return x * 6; }
+inline int f8151_7(int x) { return x * 7; }
+inline int f8151_8(int x) { return x * 8; }
+inline int f8151_9(int x) { return x * 9; }
+inline int f8151_10(int x) { return x * 10; }
+inline int f8151_11(int x) { return x * 11; }
+inline int f8151_12(int x) { return x * 12; }
+inline int f8151_13(int x) { return x * 13; }
+inline int f8151_14(int x) { return x * 14; }
+inline int f8151_15(int x) { return x * 15; }
+inline int f8151_16(int x) { return x * 16; }
+inline int f8151_17(int x) { return x * 17; }
+inline int f8151_18(int x) { return x * 18; }
+inline int f8151_19(int x) { return x * 19; }
+inline int f8151_20(int x) { return x * 20; }
+inline int f8151_21(int x) { return x * 21; }
+inline int f8151_22(int x) { return x * 22; }
+inline int f8151_23(int x) { return x * 23; }
+inline int f8151_24(int x) { return x * 24; }
+inline int f8151_25(int x) { return x * 25; }
+inline int f8151_26(int x) { return x * 26; }
+inline int f8151_27(int x) { return x * 27; }
+inline int f8151_28(int x) { return x * 28; }
+inline int f8151_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8152 */
+#include <vector>
+#include "h532.h"
+#include "h955.h"
+#include "h6396.h"
+#include "h6350.h"
+#include "h8005.h"
+#ifdef X
+#include "h3348.h"
+#endif
+struct S8152 { int a; const char *s = "x//y"; };
+inline int f8152_0(int x) { return x * 0; }
+inline int f8152_1(int x) { return x * 1; }
+inline int f8152_2(int x) { return x * 2; }
+inline int f8152_3(int x) { return x * 3; }
+inline int f8152_4(int x) { return x * 4; }
+inline int f8152_5(int x) { return x * 5; }
+inline int f8152_6(int x) { return x * 6; }
+inline int f8152_7(int x) { return x * 7; }
+inline int f8152_8(int x) { return x * 8; }
+inline int f8152_9(int x) { return x * 9; }
+inline int f8152_10(int x) { return x * 10; }
+inline int f8152_11(int x) { return x * 11; }
+inline int f8152_12(int x) { return x * 12; }
+inline int f8152_13(int x) { return x * 13; }
+inline int f8152_14(int x) { return x * 14; }
+inline int f8152_15(int x) { return x * 15; }
+inline int f8152_16(int x) { return x * 16; }
+inline int f8152_17(int x) { return x * 17; }
+inline int f8152_18(int x) { return x * 18; }
+inline int f8152_19(int x) { return x * 19; }
+inline int f8152_20(int x) { return x * 20; }
+inline int f8152_21(int x) { return x * 21; }
+inline int f8152_22(int x) { return x * 22; }
+inline int f8152_23(int x) { return x * 23; }
+inline int f8152_24(int x) { return x * 24; }
+inline int f8152_25(int x) { return x * 25; }
+inline int f8152_26(int x) { return x * 26; }
+inline int f8152_27(int x) { return x * 27; }
+inline int f8152_28(int x) { return x * 28; }
+inline int f8152_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8154 */
+#include <vector>
+#include "h9596.h"
+#include "h5350.h"
+#include "h7064.h"
+#include "h5117.h"
+#include "h5393.h"
+#ifdef X
+#include "h9868.h"
+#endif
+struct S8154 { int a; const char *s = "x//y"; };
+inline int f8154_0(int x) { return x * 0; }
+inline int f8154_1(int x) { return x * 1; }
+inline int f8154_2(int x) { return x * 2; }
+inline int f8154_3(int x) { return x * 3; }
+inline int f8154_4(int x) { return x * 4; }
+inline int f8154_5(int x) { return x * 5; }
+inline int f8154_6(int x) { return x * 6; }
+inline int f8154_7(int x) { return x * 7; }
+inline int f8154_8(int x) { return x * 8; }
+inline int f8154_9(int x) { return x * 9; }
+inline int f8154_10(int x) { return x * 10; }
+inline int f8154_11(int x) { return x * 11; }
+inline int f8154_12(int x) { return x * 12; }
+inline int f8154_13(int x) { return x * 13; }
+inline int f8154_14(int x) { return x * 14; }
+inline int f8154_15(int x) { return x * 15; }
+inline int f8154_16(int x) { return x * 16; }
+inline int f8154_17(int x) { return x * 17; }
+inline int f8154_18(int x) { return x * 18; }
+inline int f8154_19(int x) { return x * 19; }
+inline int f8154_20(int x) { return x * 20; }
+inline int f8154_21(int x) { return x * 21; }
+inline int f8154_22(int x) { return x * 22; }
+inline int f8154_23(int x) { return x * 23; }
+inline int f8154_24(int x) { return x * 24; }
+inline int f8154_25(int x) { return x * 25; }
+inline int f8154_26(int x) { return x * 26; }
+inline int f8154_27(int x) { return x * 27; }
+inline int f8154_28(int x) { return x * 28; }
+inline int f8154_29(int x) { return x * 29; }
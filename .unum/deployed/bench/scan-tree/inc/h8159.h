@@ -0,0 +1,42 @@
+#pragma once
+/* header 8159 */
+#include <vector>
+#include "h6774.h"
+#include "h4285.h"
+#include "h7836.h"
+#include "h9790.h"
+#include "h3843.h"
+#ifdef X
+#include "h5280.h"
+#endif
+struct S8159 { int a; const char *s = "x//y"; };
+inline int f8159_0(int x) { return x * 0; }
+inline int f8159_1(int x) { return x * 1; }
+inline int f8159_2(int x) { return x * 2; }
+inline int f8159_3(int x) { return x * 3; }
+inline int f8159_4(int x) { return x * 4; }
+inline int f8159_5(int x) { return x * 5; }
+inline int f8159_6(int x) { return x * 6; }
+inline int f8159_7(int x) { return x * 7; }
+inline int f8159_8(int x) { return x * 8; }
+inline int f8159_9(int x) { return x * 9; }
+inline int f8159_10(int x) { return x * 10; }
+inline int f8159_11(int x) { return x * 11; }
+inline int f8159_12(int x) { return x * 12; }
+inline int f8159_13(int x) { return x * 13; }
+inline int f8159_14(int x) { return x * 14; }
+inline int f8159_15(int x) { return x * 15; }
+inline int f8159_16(int x) { return x * 16; }
+inline int f8159_17(int x) { return x * 17; }
+inline int f8159_18(int x) { return x * 18; }
+inline int f8159_19(int x) { return x * 19; }
+inline int f8159_20(int x) { return x * 20; }
+inline int f8159_21(int x) { return x * 21; }
+inline int f8159_22(int x) { return x * 22; }
+inline int f8159_23(int x) { return x * 23; }
+inline int f8159_24(int x) { return x * 24; }
+inline int f8159_25(int x) { return x * 25; }
+inline int f8159_26(int x) { return x * 26; }
+inline int f8159_27(int x) { return x * 27; }
+inline int f8159_28(int x) { return x * 28; }
+inline int f8159_29(int x) { return x * 29; }
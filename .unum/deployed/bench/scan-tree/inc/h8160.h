@@ -0,0 +1,42 @@
+#pragma once
+/* header 8160 */
+#include <vector>
+#include "h7442.h"
+#include "h2791.h"
+#include "h4169.h"
+#include "h3494.h"
+#include "h1200.h"
+#ifdef X
+#include "h5215.h"
+#endif
+struct S8160 { int a; const char *s = "x//y"; };
+inline int f8160_0(int x) { return x * 0; }
+inline int f8160_1(int x) { return x * 1; }
+inline int f8160_2(int x) { return x * 2; }
+inline int f8160_3(int x) { return x * 3; }
+inline int f8160_4(int x) { return x * 4; }
+inline int f8160_5(int x) { return x * 5; }
+inline int f8160_6(int x) { return x * 6; }
+inline int f8160_7(int x) { return x * 7; }
+inline int f8160_8(int x) { return x * 8; }
+inline int f8160_9(int x) { return x * 9; }
+inline int f8160_10(int x) { return x * 10; }
+inline int f8160_11(int x) { return x * 11; }
+inline int f8160_12(int x) { return x * 12; }
+inline int f8160_13(int x) { return x * 13; }
+inline int f8160_14(int x) { return x * 14; }
+inline int f8160_15(int x) { return x * 15; }
+inline int f8160_16(int x) { return x * 16; }
+inline int f8160_17(int x) { return x * 17; }
+inline int f8160_18(int x) { return x * 18; }
+inline int f8160_19(int x) { return x * 19; }
+inline int f8160_20(int x) { return x * 20; }
+inline int f8160_21(int x) { return x * 21; }
+inline int f8160_22(int x) { return x * 22; }
+inline int f8160_23(int x) { return x * 23; }
+inline int f8160_24(int x) { return x * 24; }
+inline int f8160_25(int x) { return x * 25; }
+inline int f8160_26(int x) { return x * 26; }
+inline int f8160_27(int x) { return x * 27; }
+inline int f8160_28(int x) { return x * 28; }
+inline int f8160_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8161 */
+#include <vector>
+#include "h3136.h"
+#include "h6250.h"
+#include "h2757.h"
+#include "h1960.h"
+#include "h6275.h"
+#ifdef X
+#include "h8367.h"
+#endif
+struct S8161 { int a; const char *s = "x//y"; };
+inline int f8161_0(int x) { return x * 0; }
+inline int f8161_1(int x) { return x * 1; }
+inline int f8161_2(int x) { return x * 2; }
+inline int f8161_3(int x) { return x * 3; }
+inline int f8161_4(int x) { return x * 4; }
+inline int f8161_5(int x) { return x * 5; }
+inline int f8161_6(int x) { return x * 6; }
+inline int f8161_7(int x) { return x * 7; }
+inline int f8161_8(int x) { return x * 8; }
+inline int f8161_9(int x) { return x * 9; }
+inline int f8161_10(int x) { return x * 10; }
+inline int f8161_11(int x) { return x * 11; }
+inline int f8161_12(int x) { return x * 12; }
+inline int f8161_13(int x) { return x * 13; }
+inline int f8161_14(int x) { return x * 14; }
+inline int f8161_15(int x) { return x * 15; }
+inline int f8161_16(int x) { return x * 16; }
+inline int f8161_17(int x) { return x * 17; }
+inline int f8161_18(int x) { return x * 18; }
+inline int f8161_19(int x) { return x * 19; }
+inline int f8161_20(int x) { return x * 20; }
+inline int f8161_21(int x) { return x * 21; }
+inline int f8161_22(int x) { return x * 22; }
+inline int f8161_23(int x) { return x * 23; }
+inline int f8161_24(int x) { return x * 24; }
+inline int f8161_25(int x) { return x * 25; }
+inline int f8161_26(int x) { return x * 26; }
+inline int f8161_27(int x) { return x * 27; }
+inline int f8161_28(int x) { return x * 28; }
+inline int f8161_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8162 */
+#include <vector>
+#include "h7637.h"
+#include "h3216.h"
+#include "h3387.h"
+#include "h8230.h"
+#include "h2120.h"
+#ifdef X
+#include "h2317.h"
+#endif
+struct S8162 { int a; const char *s = "x//y"; };
+inline int f8162_0(int x) { return x * 0; }
+inline int f8162_1(int x) { return x * 1; }
+inline int f8162_2(int x) { return x * 2; }
+inline int f8162_3(int x) { return x * 3; }
+inline int f8162_4(int x) { return x * 4; }
+inline int f8162_5(int x) { return x * 5; }
+inline int f8162_6(int x) { return x * 6; }
+inline int f8162_7(int x) { return x * 7; }
+inline int f8162_8(int x) { return x * 8; }
+inline int f8162_9(int x) { return x * 9; }
+inline int f8162_10(int x) { return x * 10; }
+inline int f8162_11(int x) { return x * 11; }
+inline int f8162_12(int x) { return x * 12; }
+inline int f8162_13(int x) { return x * 13; }
+inline int f8162_14(int x) { return x * 14; }
+inline int f8162_15(int x) { return x * 15; }
+inline int f8162_16(int x) { return x * 16; }
+inline int f8162_17(int x) { return x * 17; }
+inline int f8162_18(int x) { return x * 18; }
+inline int f8162_19(int x) { return x * 19; }
+inline int f8162_20(int x) { return x * 20; }
+inline int f8162_21(int x) { return x * 21; }
+inline int f8162_22(int x) { return x * 22; }
+inline int f8162_23(int x) { return x * 23; }
+inline int f8162_24(int x) { return x * 24; }
+inline int f8162_25(int x) { return x * 25; }
+inline int f8162_26(int x) { return x * 26; }
+inline int f8162_27(int x) { return x * 27; }
+inline int f8162_28(int x) { return x * 28; }
+inline int f8162_29(int x) { return x * 29; }
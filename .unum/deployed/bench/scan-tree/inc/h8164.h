@@ -0,0 +1,42 @@
+#pragma once
+/* header 8164 */
+#include <vector>
+#include "h5318.h"
+#include "h7239.h"
+#include "h6642.h"
+#include "h7757.h"
+#include "h3987.h"
+#ifdef X
+#include "h9278.h"
+#endif
+struct S8164 { int a; const char *s = "x//y"; };
+inline int f8164_0(int x) { return x * 0; }
+inline int f8164_1(int x) { return x * 1; }
+inline int f8164_2(int x) { return x * 2; }
+inline int f8164_3(int x) { return x * 3; }
+inline int f8164_4(int x) { return x * 4; }
+inline int f8164_5(int x) { return x * 5; }
+inline int f8164_6(int x) { return x * 6; }
+inline int f8164_7(int x) { return x * 7; }
+inline int f8164_8(int x) { return x * 8; }
+inline int f8164_9(int x) { return x * 9; }
+inline int f8164_10(int x) { return x * 10; }
+inline int f8164_11(int x) { return x * 11; }
+inline int f8164_12(int x) { return x * 12; }
+inline int f8164_13(int x) { return x * 13; }
+inline int f8164_14(int x) { return x * 14; }
+inline int f8164_15(int x) { return x * 15; }
+inline int f8164_16(int x) { return x * 16; }
+inline int f8164_17(int x) { return x * 17; }
+inline int f8164_18(int x) { return x * 18; }
+inline int f8164_19(int x) { return x * 19; }
+inline int f8164_20(int x) { return x * 20; }
+inline int f8164_21(int x) { return x * 21; }
+inline int f8164_22(int x) { return x * 22; }
+inline int f8164_23(int x) { return x * 23; }
+inline int f8164_24(int x) { return x * 24; }
+inline int f8164_25(int x) { return x * 25; }
+inline int f8164_26(int x) { return x * 26; }
+inline int f8164_27(int x) { return x * 27; }
+inline int f8164_28(int x) { return x * 28; }
+inline int f8164_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8172 */
+#include <vector>
+#include "h898.h"
+#include "h7776.h"
+#include "h1728.h"
+#include "h7349.h"
+#include "h5365.h"
+#ifdef X
+#include "h4216.h"
+#endif
+struct S8172 { int a; const char *s = "x//y"; };
+inline int f8172_0(int x) { return x * 0; }
+inline int f8172_1(int x) { return x * 1; }
+inline int f8172_2(int x) { return x * 2; }
+inline int f8172_3(int x) { return x * 3; }
+inline int f8172_4(int x) { return x * 4; }
+inline int f8172_5(int x) { return x * 5; }
+inline int f8172_6(int x) { return x * 6; }
+inline int f8172_7(int x) { return x * 7; }
+inline int f8172_8(int x) { return x * 8; }
+inline int f8172_9(int x) { return x * 9; }
+inline int f8172_10(int x) { return x * 10; }
+inline int f8172_11(int x) { return x * 11; }
+inline int f8172_12(int x) { return x * 12; }
+inline int f8172_13(int x) { return x * 13; }
+inline int f8172_14(int x) { return x * 14; }
+inline int f8172_15(int x) { return x * 15; }
+inline int f8172_16(int x) { return x * 16; }
+inline int f8172_17(int x) { return x * 17; }
+inline int f8172_18(int x) { return x * 18; }
+inline int f8172_19(int x) { return x * 19; }
+inline int f8172_20(int x) { return x * 20; }
+inline int f8172_21(int x) { return x * 21; }
+inline int f8172_22(int x) { return x * 22; }
+inline int f8172_23(int x) { return x * 23; }
+inline int f8172_24(int x) { return x * 24; }
+inline int f8172_25(int x) { return x * 25; }
+inline int f8172_26(int x) { return x * 26; }
+inline int f8172_27(int x) { return x * 27; }
+inline int f8172_28(int x) { return x * 28; }
+inline int f8172_29(int x) { return x * 29; }
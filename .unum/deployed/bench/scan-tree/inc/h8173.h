@@ -0,0 +1,42 @@
+#pragma once
+/* header 8173 */
+#include <vector>
+#include "h7047.h"
+#include "h9456.h"
+#include "h1235.h"
+#include "h1663.h"
+#include "h788.h"
+#ifdef X
+#include "h1086.h"
+#endif
+struct S8173 { int a; const char *s = "x//y"; };
+inline int f8173_0(int x) { return x * 0; }
+inline int f8173_1(int x) { return x * 1; }
+inline int f8173_2(int x) { return x * 2; }
+inline int f8173_3(int x) { return x * 3; }
+inline int f8173_4(int x) { return x * 4; }
+inline int f8173_5(int x) { return x * 5; }
+inline int f8173_6(int x) { return x * 6; }
+inline int f8173_7(int x) { return x * 7; }
+inline int f8173_8(int x) { return x * 8; }
+inline int f8173_9(int x) { return x * 9; }
+inline int f8173_10(int x) { return x * 10; }
+inline int f8173_11(int x) { return x * 11; }
+inline int f8173_12(int x) { return x * 12; }
+inline int f8173_13(int x) { return x * 13; }
+inline int f8173_14(int x) { return x * 14; }
+inline int f8173_15(int x) { return x * 15; }
+inline int f8173_16(int x) { return x * 16; }
+inline int f8173_17(int x) { return x * 17; }
+inline int f8173_18(int x) { return x * 18; }
+inline int f8173_19(int x) { return x * 19; }
+inline int f8173_20(int x) { return x * 20; }
+inline int f8173_21(int x) { return x * 21; }
+inline int f8173_22(int x) { return x * 22; }
+inline int f8173_23(int x) { return x * 23; }
+inline int f8173_24(int x) { return x * 24; }
+inline int f8173_25(int x) { return x * 25; }
+inline int f8173_26(int x) { return x * 26; }
+inline int f8173_27(int x) { return x * 27; }
+inline int f8173_28(int x) { return x * 28; }
+inline int f8173_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8174 */
+#include <vector>
+#include "h4698.h"
+#include "h4194.h"
+#include "h7767.h"
+#include "h2877.h"
+#include "h66.h"
+#ifdef X
+#include "h160.h"
+#endif
+struct S8174 { int a; const char *s = "x//y"; };
+inline int f8174_0(int x) { return x * 0; }
+inline int f8174_1(int x) { return x * 1; }
+inline int f8174_2(int x) { return x * 2; }
+inline int f8174_3(int x) { return x * 3; }
+inline int f8174_4(int x) { return x * 4; }
+inline int f8174_5(int x) { return x * 5; }
+inline int f8174_6(int x) { return x * 6; }
+inline int f8174_7(int x) { return x * 7; }
+inline int f8174_8(int x) { return x * 8; }
+inline int f8174_9(int x) { return x * 9; }
+inline int f8174_10(int x) { return x * 10; }
+inline int f8174_11(int x) { return x * 11; }
+inline int f8174_12(int x) { return x * 12; }
+inline int f8174_13(int x) { return x * 13; }
+inline int f8174_14(int x) { return x * 14; }
+inline int f8174_15(int x) { return x * 15; }
+inline int f8174_16(int x) { return x * 16; }
+inline int f8174_17(int x) { return x * 17; }
+inline int f8174_18(int x) { return x * 18; }
+inline int f8174_19(int x) { return x * 19; }
+inline int f8174_20(int x) { return x * 20; }
+inline int f8174_21(int x) { return x * 21; }
+inline int f8174_22(int x) { return x * 22; }
+inline int f8174_23(int x) { return x * 23; }
+inline int f8174_24(int x) { return x * 24; }
+inline int f8174_25(int x) { return x * 25; }
+inline int f8174_26(int x) { return x * 26; }
+inline int f8174_27(int x) { return x * 27; }
+inline int f8174_28(int x) { return x * 28; }
+inline int f8174_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8175 */
+#include <vector>
+#include "h7114.h"
+#include "h3891.h"
+#include "h8077.h"
+#include "h6484.h"
+#include "h8816.h"
+#ifdef X
+#include "h4894.h"
+#endif
+struct S8175 { int a; const char *s = "x//y"; };
+inline int f8175_0(int x) { return x * 0; }
+inline int f8175_1(int x) { return x * 1; }
+inline int f8175_2(int x) { return x * 2; }
+inline int f8175_3(int x) { return x * 3; }
+inline int f8175_4(int x) { return x * 4; }
+inline int f8175_5(int x) { return x * 5; }
+inline int f8175_6(int x) { return x * 6; }
+inline int f8175_7(int x) { return x * 7; }
+inline int f8175_8(int x) { return x * 8; }
+inline int f8175_9(int x) { return x * 9; }
+inline int f8175_10(int x) { return x * 10; }
+inline int f8175_11(int x) { return x * 11; }
+inline int f8175_12(int x) { return x * 12; }
+inline int f8175_13(int x) { return x * 13; }
+inline int f8175_14(int x) { return x * 14; }
+inline int f8175_15(int x) { return x * 15; }
+inline int f8175_16(int x) { return x * 16; }
+inline int f8175_17(int x) { return x * 17; }
+inline int f8175_18(int x) { return x * 18; }
+inline int f8175_19(int x) { return x * 19; }
+inline int f8175_20(int x) { return x * 20; }
+inline int f8175_21(int x) { return x * 21; }
+inline int f8175_22(int x) { return x * 22; }
+inline int f8175_23(int x) { return x * 23; }
+inline int f8175_24(int x) { return x * 24; }
+inline int f8175_25(int x) { return x * 25; }
+inline int f8175_26(int x) { return x * 26; }
+inline int f8175_27(int x) { return x * 27; }
+inline int f8175_28(int x) { return x * 28; }
+inline int f8175_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8186 */
+#include <vector>
+#include "h5440.h"
+#include "h2174.h"
+#include "h9541.h"
+#include "h9615.h"
+#include "h9492.h"
+#ifdef X
+#include "h4350.h"
+#endif
+struct S8186 { int a; const char *s = "x//y"; };
+inline int f8186_0(int x) { return x * 0; }
+inline int f8186_1(int x) { return x * 1; }
+inline int f8186_2(int x) { return x * 2; }
+inline int f8186_3(int x) { return x * 3; }
+inline int f8186_4(int x) { return x * 4; }
+inline int f8186_5(int x) { return x * 5; }
+inline int f8186_6(int x) { return x * 6; }
+inline int f8186_7(int x) { return x * 7; }
+inline int f8186_8(int x) { return x * 8; }
+inline int f8186_9(int x) { return x * 9; }
+inline int f8186_10(int x) { return x * 10; }
+inline int f8186_11(int x) { return x * 11; }
+inline int f8186_12(int x) { return x * 12; }
+inline int f8186_13(int x) { return x * 13; }
+inline int f8186_14(int x) { return x * 14; }
+inline int f8186_15(int x) { return x * 15; }
+inline int f8186_16(int x) { return x * 16; }
+inline int f8186_17(int x) { return x * 17; }
+inline int f8186_18(int x) { return x * 18; }
+inline int f8186_19(int x) { return x * 19; }
+inline int f8186_20(int x) { return x * 20; }
+inline int f8186_21(int x) { return x * 21; }
+inline int f8186_22(int x) { return x * 22; }
+inline int f8186_23(int x) { return x * 23; }
+inline int f8186_24(int x) { return x * 24; }
+inline int f8186_25(int x) { return x * 25; }
+inline int f8186_26(int x) { return x * 26; }
+inline int f8186_27(int x) { return x * 27; }
+inline int f8186_28(int x) { return x * 28; }
+inline int f8186_29(int x) { return x * 29; }
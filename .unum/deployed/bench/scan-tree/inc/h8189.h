@@ -0,0 +1,42 @@
+#pragma once
+/* header 8189 */
+#include <vector>
+#include "h3169.h"
+#include "h784.h"
+#include "h5730.h"
+#include "h6318.h"
+#include "h3409.h"
+#ifdef X
+#include "h5771.h"
+#endif
+struct S8189 { int a; const char *s = "x//y"; };
+inline int f8189_0(int x) { return x * 0; }
+inline int f8189_1(int x) { return x * 1; }
+inline int f8189_2(int x) { return x * 2; }
+inline int f8189_3(int x) { return x * 3; }
+inline int f8189_4(int x) { return x * 4; }
+inline int f8189_5(int x) { return x * 5; }
+inline int f8189_6(int x) { return x * 6; }
+inline int f8189_7(int x) { return x * 7; }
+inline int f8189_8(int x) { return x * 8; }
+inline int f8189_9(int x) { return x * 9; }
+inline int f8189_10(int x) { return x * 10; }
+inline int f8189_11(int x) { return x * 11; }
+inline int f8189_12(int x) { return x * 12; }
+inline int f8189_13(int x) { return x * 13; }
+inline int f8189_14(int x) { return x * 14; }
+inline int f8189_15(int x) { return x * 15; }
+inline int f8189_16(int x) { return x * 16; }
+inline int f8189_17(int x) { return x * 17; }
+inline int f8189_18(int x) { return x * 18; }
+inline int f8189_19(int x) { return x * 19; }
+inline int f8189_20(int x) { return x * 20; }
+inline int f8189_21(int x) { return x * 21; }
+inline int f8189_22(int x) { return x * 22; }
+inline int f8189_23(int x) { return x * 23; }
+inline int f8189_24(int x) { return x * 24; }
+inline int f8189_25(int x) { return x * 25; }
+inline int f8189_26(int x) { return x * 26; }
+inline int f8189_27(int x) { return x * 27; }
+inline int f8189_28(int x) { return x * 28; }
+inline int f8189_29(int x) { return x * 29; }
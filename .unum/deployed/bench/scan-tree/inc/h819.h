@@ -0,0 +1,42 @@
+#pragma once
+/* header 819 */
+#include <vector>
+#include "h1771.h"
+#include "h5207.h"
+#include "h8072.h"
+#include "h4986.h"
+#include "h4285.h"
+#ifdef X
+#include "h4400.h"
+#endif
+struct S819 { int a; const char *s = "x//y"; };
+inline int f819_0(int x) { return x * 0; }
+inline int f819_1(int x) { return x * 1; }
+inline int f819_2(int x) { return x * 2; }
+inline int f819_3(int x) { return x * 3; }
+inline int f819_4(int x) { return x * 4; }
+inline int f819_5(int x) { return x * 5; }
+inline int f819_6(int x) { return x * 6; }
+inline int f819_7(int x) { return x * 7; }
+inline int f819_8(int x) { return x * 8; }
+inline int f819_9(int x) { return x * 9; }
+inline int f819_10(int x) { return x * 10; }
+inline int f819_11(int x) { return x * 11; }
+inline int f819_12(int x) { return x * 12; }
+inline int f819_13(int x) { return x * 13; }
+inline int f819_14(int x) { return x * 14; }
+inline int f819_15(int x) { return x * 15; }
+inline int f819_16(int x) { return x * 16; }
+inline int f819_17(int x) { return x * 17; }
+inline int f819_18(int x) { return x * 18; }
+inline int f819_19(int x) { return x * 19; }
+inline int f819_20(int x) { return x * 20; }
+inline int f819_21(int x) { return x * 21; }
+inline int f819_22(int x) { return x * 22; }
+inline int f819_23(int x) { return x * 23; }
+inline int f819_24(int x) { return x * 24; }
+inline int f819_25(int x) { return x * 25; }
+inline int f819_26(int x) { return x * 26; }
+inline int f819_27(int x) { return x * 27; }
+inline int f819_28(int x) { return x * 28; }
+inline int f819_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8192 */
+#include <vector>
+#include "h4301.h"
+#include "h3298.h"
+#include "h8720.h"
+#include "h3358.h"
+#include "h2772.h"
+#ifdef X
+#include "h8755.h"
+#endif
+struct S8192 { int a; const char *s = "x//y"; };
+inline int f8192_0(int x) { return x * 0; }
+inline int f8192_1(int x) { return x * 1; }
+inline int f8192_2(int x) { return x * 2; }
+inline int f8192_3(int x) { return x * 3; }
+inline int f8192_4(int x) { return x * 4; }
+inline int f8192_5(int x) { return x * 5; }
+inline int f8192_6(int x) { return x * 6; }
+inline int f8192_7(int x) { return x * 7; }
+inline int f8192_8(int x) { return x * 8; }
+inline int f8192_9(int x) { return x * 9; }
+inline int f8192_10(int x) { return x * 10; }
+inline int f8192_11(int x) { return x * 11; }
+inline int f8192_12(int x) { return x * 12; }
+inline int f8192_13(int x) { return x * 13; }
+inline int f8192_14(int x) { return x * 14; }
+inline int f8192_15(int x) { return x * 15; }
+inline int f8192_16(int x) { return x * 16; }
+inline int f8192_17(int x) { return x * 17; }
+inline int f8192_18(int x) { return x * 18; }
+inline int f8192_19(int x) { return x * 19; }
+inline int f8192_20(int x) { return x * 20; }
+inline int f8192_21(int x) { return x * 21; }
+inline int f8192_22(int x) { return x * 22; }
+inline int f8192_23(int x) { return x * 23; }
+inline int f8192_24(int x) { return x * 24; }
+inline int f8192_25(int x) { return x * 25; }
+inline int f8192_26(int x) { return x * 26; }
+inline int f8192_27(int x) { return x * 27; }
+inline int f8192_28(int x) { return x * 28; }
+inline int f8192_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8194 */
+#include <vector>
+#include "h9113.h"
+#include "h9550.h"
+#include "h8820.h"
+#include "h9635.h"
+#include "h7380.h"
+#ifdef X
+#include "h4237.h"
+#endif
+struct S8194 { int a; const char *s = "x//y"; };
+inline int f8194_0(int x) { return x * 0; }
+inline int f8194_1(int x) { return x * 1; }
+inline int f8194_2(int x) { return x * 2; }
+inline int f8194_3(int x) { return x * 3; }
+inline int f8194_4(int x) { return x * 4; }
+inline int f8194_5(int x) { return x * 5; }
+inline int f8194_6(int x) { return x * 6; }
+inline int f8194_7(int x) { return x * 7; }
+inline int f8194_8(int x) { return x * 8; }
+inline int f8194_9(int x) { return x * 9; }
+inline int f8194_10(int x) { return x * 10; }
+inline int f8194_11(int x) { return x * 11; }
+inline int f8194_12(int x) { return x * 12; }
+inline int f8194_13(int x) { return x * 13; }
+inline int f8194_14(int x) { return x * 14; }
+inline int f8194_15(int x) { return x * 15; }
+inline int f8194_16(int x) { return x * 16; }
+inline int f8194_17(int x) { return x * 17; }
+inline int f8194_18(int x) { return x * 18; }
+inline int f8194_19(int x) { return x * 19; }
+inline int f8194_20(int x) { return x * 20; }
+inline int f8194_21(int x) { return x * 21; }
+inline int f8194_22(int x) { return x * 22; }
+inline int f8194_23(int x) { return x * 23; }
+inline int f8194_24(int x) { return x * 24; }
+inline int f8194_25(int x) { return x * 25; }
+inline int f8194_26(int x) { return x * 26; }
+inline int f8194_27(int x) { return x * 27; }
+inline int f8194_28(int x) { return x * 28; }
+inline int f8194_29(int x) { return x * 29; }
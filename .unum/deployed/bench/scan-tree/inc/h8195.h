@@ -0,0 +1,42 @@
+#pragma once
+/* header 8195 */
+#include <vector>
+#include "h7468.h"
+#include "h5477.h"
+#include "h3404.h"
+#include "h1175.h"
+#include "h7961.h"
+#ifdef X
+#include "h1309.h"
+#endif
+struct S8195 { int a; const char *s = "x//y"; };
+inline int f8195_0(int x) { return x * 0; }
+inline int f8195_1(int x) { return x * 1; }
+inline int f8195_2(int x) { return x * 2; }
+inline int f8195_3(int x) { return x * 3; }
+inline int f8195_4(int x) { return x * 4; }
+inline int f8195_5(int x) { return x * 5; }
+inline int f8195_6(int x) { return x * 6; }
+inline int f8195_7(int x) { return x * 7; }
+inline int f8195_8(int x) { return x * 8; }
+inline int f8195_9(int x) { return x * 9; }
+inline int f8195_10(int x) { return x * 10; }
+inline int f8195_11(int x) { return x * 11; }
+inline int f8195_12(int x) { return x * 12; }
+inline int f8195_13(int x) { return x * 13; }
+inline int f8195_14(int x) { return x * 14; }
+inline int f8195_15(int x) { return x * 15; }
+inline int f8195_16(int x) { return x * 16; }
+inline int f8195_17(int x) { return x * 17; }
+inline int f8195_18(int x) { return x * 18; }
+inline int f8195_19(int x) { return x * 19; }
+inline int f8195_20(int x) { return x * 20; }
+inline int f8195_21(int x) { return x * 21; }
+inline int f8195_22(int x) { return x * 22; }
+inline int f8195_23(int x) { return x * 23; }
+inline int f8195_24(int x) { return x * 24; }
+inline int f8195_25(int x) { return x * 25; }
+inline int f8195_26(int x) { return x * 26; }
+inline int f8195_27(int x) { return x * 27; }
+inline int f8195_28(int x) { return x * 28; }
+inline int f8195_29(int x) { return x * 29; }
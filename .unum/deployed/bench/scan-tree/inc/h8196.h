@@ -0,0 +1,42 @@
+#pragma once
+/* header 8196 */
+#include <vector>
+#include "h7134.h"
+#include "h3384.h"
+#include "h6088.h"
+#include "h2493.h"
+#include "h1898.h"
+#ifdef X
+#include "h2216.h"
+#endif
+struct S8196 { int a; const char *s = "x//y"; };
+inline int f8196_0(int x) { return x * 0; }
+inline int f8196_1(int x) { return x * 1; }
+inline int f8196_2(int x) { return x * 2; }
+inline int f8196_3(int x) { return x * 3; }
+inline int f8196_4(int x) { return x * 4; }
+inline int f8196_5(int x) { return x * 5; }
+inline int f8196_6(int x) { return x * 6; }
+inline int f8196_7(int x) { return x * 7; }
+inline int f8196_8(int x) { return x * 8; }
+inline int f8196_9(int x) { return x * 9; }
+inline int f8196_10(int x) { return x * 10; }
+inline int f8196_11(int x) { return x * 11; }
+inline int f8196_12(int x) { return x * 12; }
+inline int f8196_13(int x) { return x * 13; }
+inline int f8196_14(int x) { return x * 14; }
+inline int f8196_15(int x) { return x * 15; }
+inline int f8196_16(int x) { return x * 16; }
+inline int f8196_17(int x) { return x * 17; }
+inline int f8196_18(int x) { return x * 18; }
+inline int f8196_19(int x) { return x * 19; }
+inline int f8196_20(int x) { return x * 20; }
+inline int f8196_21(int x) { return x * 21; }
+inline int f8196_22(int x) { return x * 22; }
+inline int f8196_23(int x) { return x * 23; }
+inline int f8196_24(int x) { return x * 24; }
+inline int f8196_25(int x) { return x * 25; }
+inline int f8196_26(int x) { return x * 26; }
+inline int f8196_27(int x) { return x * 27; }
+inline int f8196_28(int x) { return x * 28; }
+inline int f8196_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8198 */
+#include <vector>
+#include "h767.h"
+#include "h1944.h"
+#include "h2246.h"
+#include "h8678.h"
+#include "h7966.h"
+#ifdef X
+#include "h9376.h"
+#endif
+struct S8198 { int a; const char *s = "x//y"; };
+inline int f8198_0(int x) { return x * 0; }
+inline int f8198_1(int x) { return x * 1; }
+inline int f8198_2(int x) { return x * 2; }
+inline int f8198_3(int x) { return x * 3; }
+inline int f8198_4(int x) { return x * 4; }
+inline int f8198_5(int x) { return x * 5; }
+inline int f8198_6(int x) { return x * 6; }
+inline int f8198_7(int x) { return x * 7; }
+inline int f8198_8(int x) { return x * 8; }
+inline int f8198_9(int x) { return x * 9; }
+inline int f8198_10(int x) { return x * 10; }
+inline int f8198_11(int x) { return x * 11; }
+inline int f8198_12(int x) { return x * 12; }
+inline int f8198_13(int x) { return x * 13; }
+inline int f8198_14(int x) { return x * 14; }
+inline int f8198_15(int x) { return x * 15; }
+inline int f8198_16(int x) { return x * 16; }
+inline int f8198_17(int x) { return x * 17; }
+inline int f8198_18(int x) { return x * 18; }
+inline int f8198_19(int x) { return x * 19; }
+inline int f8198_20(int x) { return x * 20; }
+inline int f8198_21(int x) { return x * 21; }
+inline int f8198_22(int x) { return x * 22; }
+inline int f8198_23(int x) { return x * 23; }
+inline int f8198_24(int x) { return x * 24; }
+inline int f8198_25(int x) { return x * 25; }
+inline int f8198_26(int x) { return x * 26; }
+inline int f8198_27(int x) { return x * 27; }
+inline int f8198_28(int x) { return x * 28; }
+inline int f8198_29(int x) { return x * 29; }
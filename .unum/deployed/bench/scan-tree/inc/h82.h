@@ -0,0 +1,42 @@
+#pragma once
+/* header 82 */
+#include <vector>
+#include "h257.h"
+#include "h6385.h"
+#include "h4802.h"
+#include "h2633.h"
+#include "h5239.h"
+#ifdef X
+#include "h1814.h"
+#endif
+struct S82 { int a; const char *s = "x//y"; };
+inline int f82_0(int x) { return x * 0; }
+inline int f82_1(int x) { return x * 1; }
+inline int f82_2(int x) { return x * 2; }
+inline int f82_3(int x) { return x * 3; }
+inline int f82_4(int x) { return x * 4; }
+inline int f82_5(int x) { return x * 5; }
+inline int f82_6(int x) { return x * 6; }
+inline int f82_7(int x) { return x * 7; }
+inline int f82_8(int x) { return x * 8; }
+inline int f82_9(int x) { return x * 9; }
+inline int f82_10(int x) { return x * 10; }
+inline int f82_11(int x) { return x * 11; }
+inline int f82_12(int x) { return x * 12; }
+inline int f82_13(int x) { return x * 13; }
+inline int f82_14(int x) { return x * 14; }
+inline int f82_15(int x) { return x * 15; }
+inline int f82_16(int x) { return x * 16; }
+inline int f82_17(int x) { return x * 17; }
+inline int f82_18(int x) { return x * 18; }
+inline int f82_19(int x) { return x * 19; }
+inline int f82_20(int x) { return x * 20; }
+inline int f82_21(int x) { return x * 21; }
+inline int f82_22(int x) { return x * 22; }
+inline int f82_23(int x) { return x * 23; }
+inline int f82_24(int x) { return x * 24; }
+inline int f82_25(int x) { return x * 25; }
+inline int f82_26(int x) { return x * 26; }
+inline int f82_27(int x) { return x * 27; }
+inline int f82_28(int x) { return x * 28; }
+inline int f82_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8200 */
+#include <vector>
+#include "h6663.h"
+#include "h9810.h"
+#include "h8636.h"
+#include "h435.h"
+#include "h3418.h"
+#ifdef X
+#include "h1195.h"
+#endif
+struct S8200 { int a; const char *s = "x//y"; };
+inline int f8200_0(int x) { return x * 0; }
+inline int f8200_1(int x) { return x * 1; }
+inline int f8200_2(int x) { return x * 2; }
+inline int f8200_3(int x) { return x * 3; }
+inline int f8200_4(int x) { return x * 4; }
+inline int f8200_5(int x) { return x * 5; }
+inline int f8200_6(int x) { return x * 6; }
+inline int f8200_7(int x) { return x * 7; }
+inline int f8200_8(int x) { return x * 8; }
+inline int f8200_9(int x) { return x * 9; }
+inline int f8200_10(int x) { return x * 10; }
+inline int f8200_11(int x) { return x * 11; }
+inline int f8200_12(int x) { return x * 12; }
+inline int f8200_13(int x) { return x * 13; }
+inline int f8200_14(int x) { return x * 14; }
+inline int f8200_15(int x) { return x * 15; }
+inline int f8200_16(int x) { return x * 16; }
+inline int f8200_17(int x) { return x * 17; }
+inline int f8200_18(int x) { return x * 18; }
+inline int f8200_19(int x) { return x * 19; }
+inline int f8200_20(int x) { return x * 20; }
+inline int f8200_21(int x) { return x * 21; }
+inline int f8200_22(int x) { return x * 22; }
+inline int f8200_23(int x) { return x * 23; }
+inline int f8200_24(int x) { return x * 24; }
+inline int f8200_25(int x) { return x * 25; }
+inline int f8200_26(int x) { return x * 26; }
+inline int f8200_27(int x) { return x * 27; }
+inline int f8200_28(int x) { return x * 28; }
+inline int f8200_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8201 */
+#include <vector>
+#include "h6547.h"
+#include "h4749.h"
+#include "h5141.h"
+#include "h3974.h"
+#include "h6183.h"
+#ifdef X
+#include "h2235.h"
+#endif
+struct S8201 { int a; const char *s = "x//y"; };
+inline int f8201_0(int x) { return x * 0; }
+inline int f8201_1(int x) { return x * 1; }
+inline int f8201_2(int x) { return x * 2; }
+inline int f8201_3(int x) { return x * 3; }
+inline int f8201_4(int x) { return x * 4; }
+inline int f8201_5(int x) { return x * 5; }
+inline int f8201_6(int x) { return x * 6; }
+inline int f8201_7(int x) { return x * 7; }
+inline int f8201_8(int x) { return x * 8; }
+inline int f8201_9(int x) { return x * 9; }
+inline int f8201_10(int x) { return x * 10; }
+inline int f8201_11(int x) { return x * 11; }
+inline int f8201_12(int x) { return x * 12; }
+inline int f8201_13(int x) { return x * 13; }
+inline int f8201_14(int x) { return x * 14; }
+inline int f8201_15(int x) { return x * 15; }
+inline int f8201_16(int x) { return x * 16; }
+inline int f8201_17(int x) { return x * 17; }
+inline int f8201_18(int x) { return x * 18; }
+inline int f8201_19(int x) { return x * 19; }
+inline int f8201_20(int x) { return x * 20; }
+inline int f8201_21(int x) { return x * 21; }
+inline int f8201_22(int x) { return x * 22; }
+inline int f8201_23(int x) { return x * 23; }
+inline int f8201_24(int x) { return x * 24; }
+inline int f8201_25(int x) { return x * 25; }
+inline int f8201_26(int x) { return x * 26; }
+inline int f8201_27(int x) { return x * 27; }
+inline int f8201_28(int x) { return x * 28; }
+inline int f8201_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8202 */
+#include <vector>
+#include "h9325.h"
+#include "h8780.h"
+#include "h9860.h"
+#include "h5363.h"
+#include "h1613.h"
+#ifdef X
+#include "h4638.h"
+#endif
+struct S8202 { int a; const char *s = "x//y"; };
+inline int f8202_0(int x) { return x * 0; }
+inline int f8202_1(int x) { return x * 1; }
+inline int f8202_2(int x) { return x * 2; }
+inline int f8202_3(int x) { return x * 3; }
+inline int f8202_4(int x) { return x * 4; }
+inline int f8202_5(int x) { return x * 5; }
+inline int f8202_6(int x) { return x * 6; }
+inline int f8202_7(int x) { return x * 7; }
+inline int f8202_8(int x) { return x * 8; }
+inline int f8202_9(int x) { return x * 9; }
+inline int f8202_10(int x) { return x * 10; }
+inline int f8202_11(int x) { return x * 11; }
+inline int f8202_12(int x) { return x * 12; }
+inline int f8202_13(int x) { return x * 13; }
+inline int f8202_14(int x) { return x * 14; }
+inline int f8202_15(int x) { return x * 15; }
+inline int f8202_16(int x) { return x * 16; }
+inline int f8202_17(int x) { return x * 17; }
+inline int f8202_18(int x) { return x * 18; }
+inline int f8202_19(int x) { return x * 19; }
+inline int f8202_20(int x) { return x * 20; }
+inline int f8202_21(int x) { return x * 21; }
+inline int f8202_22(int x) { return x * 22; }
+inline int f8202_23(int x) { return x * 23; }
+inline int f8202_24(int x) { return x * 24; }
+inline int f8202_25(int x) { return x * 25; }
+inline int f8202_26(int x) { return x * 26; }
+inline int f8202_27(int x) { return x * 27; }
+inline int f8202_28(int x) { return x * 28; }
+inline int f8202_29(int x) { return x * 29; }
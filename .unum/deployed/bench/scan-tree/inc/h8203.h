@@ -0,0 +1,42 @@
+#pragma once
+/* header 8203 */
+#include <vector>
+#include "h3705.h"
+#include "h1957.h"
+#include "h134.h"
+#include "h507.h"
+#include "h7407.h"
+#ifdef X
+#include "h610.h"
+#endif
+struct S8203 { int a; const char *s = "x//y"; };
+inline int f8203_0(int x) { return x * 0; }
+inline int f8203_1(int x) { return x * 1; }
+inline int f8203_2(int x) { return x * 2; }
+inline int f8203_3(int x) { return x * 3; }
+inline int f8203_4(int x) { return x * 4; }
+inline int f8203_5(int x) { return x * 5; }
+inline int f8203_6(int x) { return x * 6; }
+inline int f8203_7(int x) { return x * 7; }
+inline int f8203_8(int x) { return x * 8; }
+inline int f8203_9(int x) { return x * 9; }
+inline int f8203_10(int x) { return x * 10; }
+inline int f8203_11(int x) { return x * 11; }
+inline int f8203_12(int x) { return x * 12; }
+inline int f8203_13(int x) { return x * 13; }
+inline int f8203_14(int x) { return x * 14; }
+inline int f8203_15(int x) { return x * 15; }
+inline int f8203_16(int x) { return x * 16; }
+inline int f8203_17(int x) { return x * 17; }
+inline int f8203_18(int x) { return x * 18; }
+inline int f8203_19(int x) { return x * 19; }
+inline int f8203_20(int x) { return x * 20; }
+inline int f8203_21(int x) { return x * 21; }
+inline int f8203_22(int x) { return x * 22; }
+inline int f8203_23(int x) { return x * 23; }
+inline int f8203_24(int x) { return x * 24; }
+inline int f8203_25(int x) { return x * 25; }
+inline int f8203_26(int x) { return x * 26; }
+inline int f8203_27(int x) { return x * 27; }
+inline int f8203_28(int x) { return x * 28; }
+inline int f8203_29(int x) { return x * 29; }
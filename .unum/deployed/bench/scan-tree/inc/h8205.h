@@ -0,0 +1,42 @@
+#pragma once
+/* header 8205 */
+#include <vector>
+#include "h461.h"
+#include "h5959.h"
+#include "h1452.h"
+#include "h8362.h"
+#include "h9731.h"
+#ifdef X
+#include "h7127.h"
+#endif
+struct S8205 { int a; const char *s = "x//y"; };
+inline int f8205_0(int x) { return x * 0; }
+inline int f8205_1(int x) { return x * 1; }
+inline int f8205_2(int x) { return x * 2; }
+inline int f8205_3(int x) { return x * 3; }
+inline int f8205_4(int x) { return x * 4; }
+inline int f8205_5(int x) { return x * 5; }
+inline int f8205_6(int x) { return x * 6; }
+inline int f8205_7(int x) { return x * 7; }
+inline int f8205_8(int x) { return x * 8; }
+inline int f8205_9(int x) { return x * 9; }
+inline int f8205_10(int x) { return x * 10; }
+inline int f8205_11(int x) { return x * 11; }
+inline int f8205_12(int x) { return x * 12; }
+inline int f8205_13(int x) { return x * 13; }
+inline int f8205_14(int x) { return x * 14; }
+inline int f8205_15(int x) { return x * 15; }
+inline int f8205_16(int x) { return x * 16; }
+inline int f8205_17(int x) { return x * 17; }
+inline int f8205_18(int x) { return x * 18; }
+inline int f8205_19(int x) { return x * 19; }
+inline int f8205_20(int x) { return x * 20; }
+inline int f8205_21(int x) { return x * 21; }
+inline int f8205_22(int x) { return x * 22; }
+inline int f8205_23(int x) { return x * 23; }
+inline int f8205_24(int x) { return x * 24; }
+inline int f8205_25(int x) { return x * 25; }
+inline int f8205_26(int x) { return x * 26; }
+inline int f8205_27(int x) { return x * 27; }
+inline int f8205_28(int x) { return x * 28; }
+inline int f8205_29(int x) { return x * 29; }
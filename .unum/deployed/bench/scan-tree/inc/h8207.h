@@ -0,0 +1,42 @@
+#pragma once
+/* header 8207 */
+#include <vector>
+#include "h3899.h"
+#include "h7838.h"
+#include "h398.h"
+#include "h1176.h"
+#include "h549.h"
+#ifdef X
+#include "h5156.h"
+#endif
+struct S8207 { int a; const char *s = "x//y"; };
+inline int f8207_0(int x) { return x * 0; }
+inline int f8207_1(int x) { return x * 1; }
+inline int f8207_2(int x) { return x * 2; }
+inline int f8207_3(int x) { return x * 3; }
+inline int f8207_4(int x) { return x * 4; }
+inline int f8207_5(int x) { return x * 5; }
+inline int f8207_6(int x) { return x * 6; }
+inline int f8207_7(int x) { return x * 7; }
+inline int f8207_8(int x) { return x * 8; }
+inline int f8207_9(int x) { return x * 9; }
+inline int f8207_10(int x) { return x * 10; }
+inline int f8207_11(int x) { return x * 11; }
+inline int f8207_12(int x) { return x * 12; }
+inline int f8207_13(int x) { return x * 13; }
+inline int f8207_14(int x) { return x * 14; }
+inline int f8207_15(int x) { return x * 15; }
+inline int f8207_16(int x) { return x * 16; }
+inline int f8207_17(int x) { return x * 17; }
+inline int f8207_18(int x) { return x * 18; }
+inline int f8207_19(int x) { return x * 19; }
+inline int f8207_20(int x) { return x * 20; }
+inline int f8207_21(int x) { return x * 21; }
+inline int f8207_22(int x) { return x * 22; }
+inline int f8207_23(int x) { return x * 23; }
+inline int f8207_24(int x) { return x * 24; }
+inline int f8207_25(int x) { return x * 25; }
+inline int f8207_26(int x) { return x * 26; }
+inline int f8207_27(int x) { return x * 27; }
+inline int f8207_28(int x) { return x * 28; }
+inline int f8207_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8210 */
+#include <vector>
+#include "h3855.h"
+#include "h1345.h"
+#include "h822.h"
+#include "h4870.h"
+#include "h97.h"
+#ifdef X
+#include "h8285.h"
+#endif
+struct S8210 { int a; const char *s = "x//y"; };
+inline int f8210_0(int x) { return x * 0; }
+inline int f8210_1(int x) { return x * 1; }
+inline int f8210_2(int x) { return x * 2; }
+inline int f8210_3(int x) { return x * 3; }
+inline int f8210_4(int x) { return x * 4; }
+inline int f8210_5(int x) { return x * 5; }
+inline int f8210_6(int x) { return x * 6; }
+inline int f8210_7(int x) { return x * 7; }
+inline int f8210_8(int x) { return x * 8; }
+inline int f8210_9(int x) { return x * 9; }
+inline int f8210_10(int x) { return x * 10; }
+inline int f8210_11(int x) { return x * 11; }
+inline int f8210_12(int x) { return x * 12; }
+inline int f8210_13(int x) { return x * 13; }
+inline int f8210_14(int x) { return x * 14; }
+inline int f8210_15(int x) { return x * 15; }
+inline int f8210_16(int x) { return x * 16; }
+inline int f8210_17(int x) { return x * 17; }
+inline int f8210_18(int x) { return x * 18; }
+inline int f8210_19(int x) { return x * 19; }
+inline int f8210_20(int x) { return x * 20; }
+inline int f8210_21(int x) { return x * 21; }
+inline int f8210_22(int x) { return x * 22; }
+inline int f8210_23(int x) { return x * 23; }
+inline int f8210_24(int x) { return x * 24; }
+inline int f8210_25(int x) { return x * 25; }
+inline int f8210_26(int x) { return x * 26; }
+inline int f8210_27(int x) { return x * 27; }
+inline int f8210_28(int x) { return x * 28; }
+inline int f8210_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8212 */
+#include <vector>
+#include "h3224.h"
+#include "h5254.h"
+#include "h672.h"
+#include "h3839.h"
+#include "h3130.h"
+#ifdef X
+#include "h9002.h"
+#endif
+struct S8212 { int a; const char *s = "x//y"; };
+inline int f8212_0(int x) { return x * 0; }
+inline int f8212_1(int x) { return x * 1; }
+inline int f8212_2(int x) { return x * 2; }
+inline int f8212_3(int x) { return x * 3; }
+inline int f8212_4(int x) { return x * 4; }
+inline int f8212_5(int x) { return x * 5; }
+inline int f8212_6(int x) { return x * 6; }
+inline int f8212_7(int x) { return x * 7; }
+inline int f8212_8(int x) { return x * 8; }
+inline int f8212_9(int x) { return x * 9; }
+inline int f8212_10(int x) { return x * 10; }
+inline int f8212_11(int x) { return x * 11; }
+inline int f8212_12(int x) { return x * 12; }
+inline int f8212_13(int x) { return x * 13; }
+inline int f8212_14(int x) { return x * 14; }
+inline int f8212_15(int x) { return x * 15; }
+inline int f8212_16(int x) { return x * 16; }
+inline int f8212_17(int x) { return x * 17; }
+inline int f8212_18(int x) { return x * 18; }
+inline int f8212_19(int x) { return x * 19; }
+inline int f8212_20(int x) { return x * 20; }
+inline int f8212_21(int x) { return x * 21; }
+inline int f8212_22(int x) { return x * 22; }
+inline int f8212_23(int x) { return x * 23; }
+inline int f8212_24(int x) { return x * 24; }
+inline int f8212_25(int x) { return x * 25; }
+inline int f8212_26(int x) { return x * 26; }
+inline int f8212_27(int x) { return x * 27; }
+inline int f8212_28(int x) { return x * 28; }
+inline int f8212_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8213 */
+#include <vector>
+#include "h6532.h"
+#include "h7430.h"
+#include "h9687.h"
+#include "h4203.h"
+#include "h8263.h"
+#ifdef X
+#include "h1479.h"
+#endif
+struct S8213 { int a; const char *s = "x//y"; };
+inline int f8213_0(int x) { return x * 0; }
+inline int f8213_1(int x) { return x * 1; }
+inline int f8213_2(int x) { return x * 2; }
+inline int f8213_3(int x) { return x * 3; }
+inline int f8213_4(int x) { return x * 4; }
+inline int f8213_5(int x) { return x * 5; }
+inline int f8213_6(int x) { return x * 6; }
+inline int f8213_7(int x) { return x * 7; }
+inline int f8213_8(int x) { return x * 8; }
+inline int f8213_9(int x) { return x * 9; }
+inline int f8213_10(int x) { return x * 10; }
+inline int f8213_11(int x) { return x * 11; }
+inline int f8213_12(int x) { return x * 12; }
+inline int f8213_13(int x) { return x * 13; }
+inline int f8213_14(int x) { return x * 14; }
+inline int f8213_15(int x) { return x * 15; }
+inline int f8213_16(int x) { return x * 16; }
+inline int f8213_17(int x) { return x * 17; }
+inline int f8213_18(int x) { return x * 18; }
+inline int f8213_19(int x) { return x * 19; }
+inline int f8213_20(int x) { return x * 20; }
+inline int f8213_21(int x) { return x * 21; }
+inline int f8213_22(int x) { return x * 22; }
+inline int f8213_23(int x) { return x * 23; }
+inline int f8213_24(int x) { return x * 24; }
+inline int f8213_25(int x) { return x * 25; }
+inline int f8213_26(int x) { return x * 26; }
+inline int f8213_27(int x) { return x * 27; }
+inline int f8213_28(int x) { return x * 28; }
+inline int f8213_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8218 */
+#include <vector>
+#include "h6504.h"
+#include "h5577.h"
+#include "h4482.h"
+#include "h8630.h"
+#include "h9300.h"
+#ifdef X
+#include "h4914.h"
+#endif
+struct S8218 { int a; const char *s = "x//y"; };
+inline int f8218_0(int x) { return x * 0; }
+inline int f8218_1(int x) { return x * 1; }
+inline int f8218_2(int x) { return x * 2; }
+inline int f8218_3(int x) { return x * 3; }
+inline int f8218_4(int x) { return x * 4; }
+inline int f8218_5(int x) { return x * 5; }
+inline int f8218_6(int x) { return x * 6; }
+inline int f8218_7(int x) { return x * 7; }
+inline int f8218_8(int x) { return x * 8; }
+inline int f8218_9(int x) { return x * 9; }
+inline int f8218_10(int x) { return x * 10; }
+inline int f8218_11(int x) { return x * 11; }
+inline int f8218_12(int x) { return x * 12; }
+inline int f8218_13(int x) { return x * 13; }
+inline int f8218_14(int x) { return x * 14; }
+inline int f8218_15(int x) { return x * 15; }
+inline int f8218_16(int x) { return x * 16; }
+inline int f8218_17(int x) { return x * 17; }
+inline int f8218_18(int x) { return x * 18; }
+inline int f8218_19(int x) { return x * 19; }
+inline int f8218_20(int x) { return x * 20; }
+inline int f8218_21(int x) { return x * 21; }
+inline int f8218_22(int x) { return x * 22; }
+inline int f8218_23(int x) { return x * 23; }
+inline int f8218_24(int x) { return x * 24; }
+inline int f8218_25(int x) { return x * 25; }
+inline int f8218_26(int x) { return x * 26; }
+inline int f8218_27(int x) { return x * 27; }
+inline int f8218_28(int x) { return x * 28; }
+inline int f8218_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8219 */
+#include <vector>
+#include "h9354.h"
+#include "h4299.h"
+#include "h849.h"
+#include "h4114.h"
+#include "h6648.h"
+#ifdef X
+#include "h5545.h"
+#endif
+struct S8219 { int a; const char *s = "x//y"; };
+inline int f8219_0(int x) { return x * 0; }
+inline int f8219_1(int x) { return x * 1; }
+inline int f8219_2(int x) { return x * 2; }
+inline int f8219_3(int x) { return x * 3; }
+inline int f8219_4(int x) { return x * 4; }
+inline int f8219_5(int x) { return x * 5; }
+inline int f8219_6(int x) { return x * 6; }
+inline int f8219_7(int x) { return x * 7; }
+inline int f8219_8(int x) { return x * 8; }
+inline int f8219_9(int x) { return x * 9; }
+inline int f8219_10(int x) { return x * 10; }
+inline int f8219_11(int x) { return x * 11; }
+inline int f8219_12(int x) { return x * 12; }
+inline int f8219_13(int x) { return x * 13; }
+inline int f8219_14(int x) { return x * 14; }
+inline int f8219_15(int x) { return x * 15; }
+inline int f8219_16(int x) { return x * 16; }
+inline int f8219_17(int x) { return x * 17; }
+inline int f8219_18(int x) { return x * 18; }
+inline int f8219_19(int x) { return x * 19; }
+inline int f8219_20(int x) { return x * 20; }
+inline int f8219_21(int x) { return x * 21; }
+inline int f8219_22(int x) { return x * 22; }
+inline int f8219_23(int x) { return x * 23; }
+inline int f8219_24(int x) { return x * 24; }
+inline int f8219_25(int x) { return x * 25; }
+inline int f8219_26(int x) { return x * 26; }
+inline int f8219_27(int x) { return x * 27; }
+inline int f8219_28(int x) { return x * 28; }
+inline int f8219_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8220 */
+#include <vector>
+#include "h7353.h"
+#include "h5852.h"
+#include "h441.h"
+#include "h8649.h"
+#include "h8685.h"
+#ifdef X
+#include "h973.h"
+#endif
+struct S8220 { int a; const char *s = "x//y"; };
+inline int f8220_0(int x) { return x * 0; }
+inline int f8220_1(int x) { return x * 1; }
+inline int f8220_2(int x) { return x * 2; }
+inline int f8220_3(int x) { return x * 3; }
+inline int f8220_4(int x) { return x * 4; }
+inline int f8220_5(int x) { return x * 5; }
+inline int f8220_6(int x) { return x * 6; }
+inline int f8220_7(int x) { return x * 7; }
+inline int f8220_8(int x) { return x * 8; }
+inline int f8220_9(int x) { return x * 9; }
+inline int f8220_10(int x) { return x * 10; }
+inline int f8220_11(int x) { return x * 11; }
+inline int f8220_12(int x) { return x * 12; }
+inline int f8220_13(int x) { return x * 13; }
+inline int f8220_14(int x) { return x * 14; }
+inline int f8220_15(int x) { return x * 15; }
+inline int f8220_16(int x) { return x * 16; }
+inline int f8220_17(int x) { return x * 17; }
+inline int f8220_18(int x) { return x * 18; }
+inline int f8220_19(int x) { return x * 19; }
+inline int f8220_20(int x) { return x * 20; }
+inline int f8220_21(int x) { return x * 21; }
+inline int f8220_22(int x) { return x * 22; }
+inline int f8220_23(int x) { return x * 23; }
+inline int f8220_24(int x) { return x * 24; }
+inline int f8220_25(int x) { return x * 25; }
+inline int f8220_26(int x) { return x * 26; }
+inline int f8220_27(int x) { return x * 27; }
+inline int f8220_28(int x) { return x * 28; }
+inline int f8220_29(int x) { return x * 29; }
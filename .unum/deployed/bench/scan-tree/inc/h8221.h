@@ -0,0 +1,42 @@
+#pragma once
+/* header 8221 */
+#include <vector>
+#include "h1603.h"
+#include "h7880.h"
+#include "h5223.h"
+#include "h814.h"
+#include "h2180.h"
+#ifdef X
+#include "h7752.h"
+#endif
+struct S8221 { int a; const char *s = "x//y"; };
+inline int f8221_0(int x) { return x * 0; }
+inline int f8221_1(int x) { return x * 1; }
+inline int f8221_2(int x) { return x * 2; }
+inline int f8221_3(int x) { return x * 3; }
+inline int f8221_4(int x) { return x * 4; }
+inline int f8221_5(int x) { return x * 5; }
+inline int f8221_6(int x) { return x * 6; }
+inline int f8221_7(int x) { return x * 7; }
+inline int f8221_8(int x) { return x * 8; }
+inline int f8221_9(int x) { return x * 9; }
+inline int f8221_10(int x) { return x * 10; }
+inline int f8221_11(int x) { return x * 11; }
+inline int f8221_12(int x) { return x * 12; }
+inline int f8221_13(int x) { return x * 13; }
+inline int f8221_14(int x) { return x * 14; }
+inline int f8221_15(int x) { return x * 15; }
+inline int f8221_16(int x) { return x * 16; }
+inline int f8221_17(int x) { return x * 17; }
+inline int f8221_18(int x) { return x * 18; }
+inline int f8221_19(int x) { return x * 19; }
+inline int f8221_20(int x) { return x * 20; }
+inline int f8221_21(int x) { return x * 21; }
+inline int f8221_22(int x) { return x * 22; }
+inline int f8221_23(int x) { return x * 23; }
+inline int f8221_24(int x) { return x * 24; }
+inline int f8221_25(int x) { return x * 25; }
+inline int f8221_26(int x) { return x * 26; }
+inline int f8221_27(int x) { return x * 27; }
+inline int f8221_28(int x) { return x * 28; }
+inline int f8221_29(int x) { return x * 29; }
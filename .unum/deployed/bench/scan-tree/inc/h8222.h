@@ -0,0 +1,42 @@
+#pragma once
+/* header 8222 */
+#include <vector>
+#include "h2296.h"
+#include "h8097.h"
+#include "h5485.h"
+#include "h9057.h"
+#include "h6350.h"
+#ifdef X
+#include "h4661.h"
+#endif
+struct S8222 { int a; const char *s = "x//y"; };
+inline int f8222_0(int x) { return x * 0; }
+inline int f8222_1(int x) { return x * 1; }
+inline int f8222_2(int x) { return x * 2; }
+inline int f8222_3(int x) { return x * 3; }
+inline int f8222_4(int x) { return x * 4; }
+inline int f8222_5(int x) { return x * 5; }
+inline int f8222_6(int x) { return x * 6; }
+inline int f8222_7(int x) { return x * 7; }
+inline int f8222_8(int x) { return x * 8; }
+inline int f8222_9(int x) { return x * 9; }
+inline int f8222_10(int x) { return x * 10; }
+inline int f8222_11(int x) { return x * 11; }
+inline int f8222_12(int x) { return x * 12; }
+inline int f8222_13(int x) { return x * 13; }
+inline int f8222_14(int x) { return x * 14; }
+inline int f8222_15(int x) { return x * 15; }
+inline int f8222_16(int x) { return x * 16; }
+inline int f8222_17(int x) { return x * 17; }
+inline int f8222_18(int x) { return x * 18; }
+inline int f8222_19(int x) { return x * 19; }
+inline int f8222_20(int x) { return x * 20; }
+inline int f8222_21(int x) { return x * 21; }
+inline int f8222_22(int x) { return x * 22; }
+inline int f8222_23(int x) { return x * 23; }
+inline int f8222_24(int x) { return x * 24; }
+inline int f8222_25(int x) { return x * 25; }
+inline int f8222_26(int x) { return x * 26; }
+inline int f8222_27(int x) { return x * 27; }
+inline int f8222_28(int x) { return x * 28; }
+inline int f8222_29(int x) { return x * 29; }
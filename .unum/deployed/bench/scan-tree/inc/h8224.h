@@ -0,0 +1,42 @@
+#pragma once
+/* header 8224 */
+#include <vector>
+#include "h4339.h"
+#include "h9315.h"
+#include "h2022.h"
+#include "h4740.h"
+#include "h3106.h"
+#ifdef X
+#include "h2379.h"
+#endif
+struct S8224 { int a; const char *s = "x//y"; };
+inline int f8224_0(int x) { return x * 0; }
+inline int f8224_1(int x) { return x * 1; }
+inline int f8224_2(int x) { return x * 2; }
+inline int f8224_3(int x) { return x * 3; }
+inline int f8224_4(int x) { return x * 4; }
+inline int f8224_5(int x) { return x * 5; }
+inline int f8224_6(int x) { return x * 6; }
+inline int f8224_7(int x) { return x * 7; }
+inline int f8224_8(int x) { return x * 8; }
+inline int f8224_9(int x) { return x * 9; }
+inline int f8224_10(int x) { return x * 10; }
+inline int f8224_11(int x) { return x * 11; }
+inline int f8224_12(int x) { return x * 12; }
+inline int f8224_13(int x) { return x * 13; }
+inline int f8224_14(int x) { return x * 14; }
+inline int f8224_15(int x) { return x * 15; }
+inline int f8224_16(int x) { return x * 16; }
+inline int f8224_17(int x) { return x * 17; }
+inline int f8224_18(int x) { return x * 18; }
+inline int f8224_19(int x) { return x * 19; }
+inline int f8224_20(int x) { return x * 20; }
+inline int f8224_21(int x) { return x * 21; }
+inline int f8224_22(int x) { return x * 22; }
+inline int f8224_23(int x) { return x * 23; }
+inline int f8224_24(int x) { return x * 24; }
+inline int f8224_25(int x) { return x * 25; }
+inline int f8224_26(int x) { return x * 26; }
+inline int f8224_27(int x) { return x * 27; }
+inline int f8224_28(int x) { return x * 28; }
+inline int f8224_29(int x) { return x * 29; }
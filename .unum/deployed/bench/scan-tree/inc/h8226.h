@@ -0,0 +1,42 @@
+#pragma once
+/* header 8226 */
+#include <vector>
+#include "h6547.h"
+#include "h8231.h"
+#include "h2287.h"
+#include "h4844.h"
+#include "h9918.h"
+#ifdef X
+#include "h6335.h"
+#endif
+struct S8226 { int a; const char *s = "x//y"; };
+inline int f8226_0(int x) { return x * 0; }
+inline int f8226_1(int x) { return x * 1; }
+inline int f8226_2(int x) { return x * 2; }
+inline int f8226_3(int x) { return x * 3; }
+inline int f8226_4(int x) { return x * 4; }
+inline int f8226_5(int x) { return x * 5; }
+inline int f8226_6(int x) { return x * 6; }
+inline int f8226_7(int x) { return x * 7; }
+inline int f8226_8(int x) { return x * 8; }
+inline int f8226_9(int x) { return x * 9; }
+inline int f8226_10(int x) { return x * 10; }
+inline int f8226_11(int x) { return x * 11; }
+inline int f8226_12(int x) { return x * 12; }
+inline int f8226_13(int x) { return x * 13; }
+inline int f8226_14(int x) { return x * 14; }
+inline int f8226_15(int x) { return x * 15; }
+inline int f8226_16(int x) { return x * 16; }
+inline int f8226_17(int x) { return x * 17; }
+inline int f8226_18(int x) { return x * 18; }
+inline int f8226_19(int x) { return x * 19; }
+inline int f8226_20(int x) { return x * 20; }
+inline int f8226_21(int x) { return x * 21; }
+inline int f8226_22(int x) { return x * 22; }
+inline int f8226_23(int x) { return x * 23; }
+inline int f8226_24(int x) { return x * 24; }
+inline int f8226_25(int x) { return x * 25; }
+inline int f8226_26(int x) { return x * 26; }
+inline int f8226_27(int x) { return x * 27; }
+inline int f8226_28(int x) { return x * 28; }
+inline int f8226_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8228 */
+#include <vector>
+#include "h4515.h"
+#include "h5662.h"
+#include "h7924.h"
+#include "h226.h"
+#include "h2156.h"
+#ifdef X
+#include "h3454.h"
+#endif
+struct S8228 { int a; const char *s = "x//y"; };
+inline int f8228_0(int x) { return x * 0; }
+inline int f8228_1(int x) { return x * 1; }
+inline int f8228_2(int x) { return x * 2; }
+inline int f8228_3(int x) { return x * 3; }
+inline int f8228_4(int x) { return x * 4; }
+inline int f8228_5(int x) { return x * 5; }
+inline int f8228_6(int x) { return x * 6; }
+inline int f8228_7(int x) { return x * 7; }
+inline int f8228_8(int x) { return x * 8; }
+inline int f8228_9(int x) { return x * 9; }
+inline int f8228_10(int x) { return x * 10; }
+inline int f8228_11(int x) { return x * 11; }
+inline int f8228_12(int x) { return x * 12; }
+inline int f8228_13(int x) { return x * 13; }
+inline int f8228_14(int x) { return x * 14; }
+inline int f8228_15(int x) { return x * 15; }
+inline int f8228_16(int x) { return x * 16; }
+inline int f8228_17(int x) { return x * 17; }
+inline int f8228_18(int x) { return x * 18; }
+inline int f8228_19(int x) { return x * 19; }
+inline int f8228_20(int x) { return x * 20; }
+inline int f8228_21(int x) { return x * 21; }
+inline int f8228_22(int x) { return x * 22; }
+inline int f8228_23(int x) { return x * 23; }
+inline int f8228_24(int x) { return x * 24; }
+inline int f8228_25(int x) { return x * 25; }
+inline int f8228_26(int x) { return x * 26; }
+inline int f8228_27(int x) { return x * 27; }
+inline int f8228_28(int x) { return x * 28; }
+inline int f8228_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8229 */
+#include <vector>
+#include "h6973.h"
+#include "h2786.h"
+#include "h7379.h"
+#include "h8723.h"
+#include "h2755.h"
+#ifdef X
+#include "h1524.h"
+#endif
+struct S8229 { int a; const char *s = "x//y"; };
+inline int f8229_0(int x) { return x * 0; }
+inline int f8229_1(int x) { return x * 1; }
+inline int f8229_2(int x) { return x * 2; }
+inline int f8229_3(int x) { return x * 3; }
+inline int f8229_4(int x) { return x * 4; }
+inline int f8229_5(int x) { return x * 5; }
+inline int f8229_6(int x) { return x * 6; }
+inline int f8229_7(int x) { return x * 7; }
+inline int f8229_8(int x) { return x * 8; }
+inline int f8229_9(int x) { return x * 9; }
+inline int f8229_10(int x) { return x * 10; }
+inline int f8229_11(int x) { return x * 11; }
+inline int f8229_12(int x) { return x * 12; }
+inline int f8229_13(int x) { return x * 13; }
+inline int f8229_14(int x) { return x * 14; }
+inline int f8229_15(int x) { return x * 15; }
+inline int f8229_16(int x) { return x * 16; }
+inline int f8229_17(int x) { return x * 17; }
+inline int f8229_18(int x) { return x * 18; }
+inline int f8229_19(int x) { return x * 19; }
+inline int f8229_20(int x) { return x * 20; }
+inline int f8229_21(int x) { return x * 21; }
+inline int f8229_22(int x) { return x * 22; }
+inline int f8229_23(int x) { return x * 23; }
+inline int f8229_24(int x) { return x * 24; }
+inline int f8229_25(int x) { return x * 25; }
+inline int f8229_26(int x) { return x * 26; }
+inline int f8229_27(int x) { return x * 27; }
+inline int f8229_28(int x) { return x * 28; }
+inline int f8229_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8231 */
+#include <vector>
+#include "h709.h"
+#include "h2084.h"
+#include "h7650.h"
+#include "h4169.h"
+#include "h4254.h"
+#ifdef X
+#include "h1616.h"
+#endif
+struct S8231 { int a; const char *s = "x//y"; };
+inline int f8231_0(int x) { return x * 0; }
+inline int f8231_1(int x) { return x * 1; }
+inline int f8231_2(int x) { return x * 2; }
+inline int f8231_3(int x) { return x * 3; }
+inline int f8231_4(int x) { return x * 4; }
+inline int f8231_5(int x) { return x * 5; }
+inline int f8231_6(int x) { return x * 6; }
+inline int f8231_7(int x) { return x * 7; }
+inline int f8231_8(int x) { return x * 8; }
+inline int f8231_9(int x) { return x * 9; }
+inline int f8231_10(int x) { return x * 10; }
+inline int f8231_11(int x) { return x * 11; }
+inline int f8231_12(int x) { return x * 12; }
+inline int f8231_13(int x) { return x * 13; }
+inline int f8231_14(int x) { return x * 14; }
+inline int f8231_15(int x) { return x * 15; }
+inline int f8231_16(int x) { return x * 16; }
+inline int f8231_17(int x) { return x * 17; }
+inline int f8231_18(int x) { return x * 18; }
+inline int f8231_19(int x) { return x * 19; }
+inline int f8231_20(int x) { return x * 20; }
+inline int f8231_21(int x) { return x * 21; }
+inline int f8231_22(int x) { return x * 22; }
+inline int f8231_23(int x) { return x * 23; }
+inline int f8231_24(int x) { return x * 24; }
+inline int f8231_25(int x) { return x * 25; }
+inline int f8231_26(int x) { return x * 26; }
+inline int f8231_27(int x) { return x * 27; }
+inline int f8231_28(int x) { return x * 28; }
+inline int f8231_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8232 */
+#include <vector>
+#include "h9099.h"
+#include "h3556.h"
+#include "h2941.h"
+#include "h1984.h"
+#include "h2123.h"
+#ifdef X
+#include "h8395.h"
+#endif
+struct S8232 { int a; const char *s = "x//y"; };
+inline int f8232_0(int x) { return x * 0; }
+inline int f8232_1(int x) { return x * 1; }
+inline int f8232_2(int x) { return x * 2; }
+inline int f8232_3(int x) { return x * 3; }
+inline int f8232_4(int x) { return x * 4; }
+inline int f8232_5(int x) { return x * 5; }
+inline int f8232_6(int x) { return x * 6; }
+inline int f8232_7(int x) { return x * 7; }
+inline int f8232_8(int x) { return x * 8; }
+inline int f8232_9(int x) { return x * 9; }
+inline int f8232_10(int x) { return x * 10; }
+inline int f8232_11(int x) { return x * 11; }
+inline int f8232_12(int x) { return x * 12; }
+inline int f8232_13(int x) { return x * 13; }
+inline int f8232_14(int x) { return x * 14; }
+inline int f8232_15(int x) { return x * 15; }
+inline int f8232_16(int x) { return x * 16; }
+inline int f8232_17(int x) { return x * 17; }
+inline int f8232_18(int x) { return x * 18; }
+inline int f8232_19(int x) { return x * 19; }
+inline int f8232_20(int x) { return x * 20; }
+inline int f8232_21(int x) { return x * 21; }
+inline int f8232_22(int x) { return x * 22; }
+inline int f8232_23(int x) { return x * 23; }
+inline int f8232_24(int x) { return x * 24; }
+inline int f8232_25(int x) { return x * 25; }
+inline int f8232_26(int x) { return x * 26; }
+inline int f8232_27(int x) { return x * 27; }
+inline int f8232_28(int x) { return x * 28; }
+inline int f8232_29(int x) { return x * 29; }
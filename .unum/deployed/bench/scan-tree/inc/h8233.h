@@ -0,0 +1,42 @@
+#pragma once
+/* header 8233 */
+#include <vector>
+#include "h4425.h"
+#include "h9364.h"
+#include "h5283.h"
+#include "h7348.h"
+#include "h3214.h"
+#ifdef X
+#include "h7261.h"
+#endif
+struct S8233 { int a; const char *s = "x//y"; };
+inline int f8233_0(int x) { return x * 0; }
+inline int f8233_1(int x) { return x * 1; }
+inline int f8233_2(int x) { return x * 2; }
+inline int f8233_3(int x) { return x * 3; }
+inline int f8233_4(int x) { return x * 4; }
+inline int f8233_5(int x) { return x * 5; }
+inline int f8233_6(int x) { return x * 6; }
+inline int f8233_7(int x) { return x * 7; }
+inline int f8233_8(int x) { return x * 8; }
+inline int f8233_9(int x) { return x * 9; }
+inline int f8233_10(int x) { return x * 10; }
+inline int f8233_11(int x) { return x * 11; }
+inline int f8233_12(int x) { return x * 12; }
+inline int f8233_13(int x) { return x * 13; }
+inline int f8233_14(int x) { return x * 14; }
+inline int f8233_15(int x) { return x * 15; }
+inline int f8233_16(int x) { return x * 16; }
+inline int f8233_17(int x) { return x * 17; }
+inline int f8233_18(int x) { return x * 18; }
+inline int f8233_19(int x) { return x * 19; }
+inline int f8233_20(int x) { return x * 20; }
+inline int f8233_21(int x) { return x * 21; }
+inline int f8233_22(int x) { return x * 22; }
+inline int f8233_23(int x) { return x * 23; }
+inline int f8233_24(int x) { return x * 24; }
+inline int f8233_25(int x) { return x * 25; }
+inline int f8233_26(int x) { return x * 26; }
+inline int f8233_27(int x) { return x * 27; }
+inline int f8233_28(int x) { return x * 28; }
+inline int f8233_29(int x) { return x * 29; }
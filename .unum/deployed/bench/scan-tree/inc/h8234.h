@@ -0,0 +1,42 @@
+#pragma once
+/* header 8234 */
+#include <vector>
+#include "h675.h"
+#include "h8988.h"
+#include "h6807.h"
+#include "h9641.h"
+#include "h3289.h"
+#ifdef X
+#include "h8236.h"
+#endif
+struct S8234 { int a; const char *s = "x//y"; };
+inline int f8234_0(int x) { return x * 0; }
+inline int f8234_1(int x) { return x * 1; }
+inline int f8234_2(int x) { return x * 2; }
+inline int f8234_3(int x) { return x * 3; }
+inline int f8234_4(int x) { return x * 4; }
+inline int f8234_5(int x) { return x * 5; }
+inline int f8234_6(int x) { return x * 6; }
+inline int f8234_7(int x) { return x * 7; }
+inline int f8234_8(int x) { return x * 8; }
+inline int f8234_9(int x) { return x * 9; }
+inline int f8234_10(int x) { return x * 10; }
+inline int f8234_11(int x) { return x * 11; }
+inline int f8234_12(int x) { return x * 12; }
+inline int f8234_13(int x) { return x * 13; }
+inline int f8234_14(int x) { return x * 14; }
+inline int f8234_15(int x) { return x * 15; }
+inline int f8234_16(int x) { return x * 16; }
+inline int f8234_17(int x) { return x * 17; }
+inline int f8234_18(int x) { return x * 18; }
+inline int f8234_19(int x) { return x * 19; }
+inline int f8234_20(int x) { return x * 20; }
+inline int f8234_21(int x) { return x * 21; }
+inline int f8234_22(int x) { return x * 22; }
+inline int f8234_23(int x) { return x * 23; }
+inline int f8234_24(int x) { return x * 24; }
+inline int f8234_25(int x) { return x * 25; }
+inline int f8234_26(int x) { return x * 26; }
+inline int f8234_27(int x) { return x * 27; }
+inline int f8234_28(int x) { return x * 28; }
+inline int f8234_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8240 */
+#include <vector>
+#include "h5576.h"
+#include "h4955.h"
+#include "h8770.h"
+#include "h601.h"
+#include "h3371.h"
+#ifdef X
+#include "h3710.h"
+#endif
+struct S8240 { int a; const char *s = "x//y"; };
+inline int f8240_0(int x) { return x * 0; }
+inline int f8240_1(int x) { return x * 1; }
+inline int f8240_2(int x) { return x * 2; }
+inline int f8240_3(int x) { return x * 3; }
+inline int f8240_4(int x) { return x * 4; }
+inline int f8240_5(int x) { return x * 5; }
+inline int f8240_6(int x) { return x * 6; }
+inline int f8240_7(int x) { return x * 7; }
+inline int f8240_8(int x) { return x * 8; }
+inline int f8240_9(int x) { return x * 9; }
+inline int f8240_10(int x) { return x * 10; }
+inline int f8240_11(int x) { return x * 11; }
+inline int f8240_12(int x) { return x * 12; }
+inline int f8240_13(int x) { return x * 13; }
+inline int f8240_14(int x) { return x * 14; }
+inline int f8240_15(int x) { return x * 15; }
+inline int f8240_16(int x) { return x * 16; }
+inline int f8240_17(int x) { return x * 17; }
+inline int f8240_18(int x) { return x * 18; }
+inline int f8240_19(int x) { return x * 19; }
+inline int f8240_20(int x) { return x * 20; }
+inline int f8240_21(int x) { return x * 21; }
+inline int f8240_22(int x) { return x * 22; }
+inline int f8240_23(int x) { return x * 23; }
+inline int f8240_24(int x) { return x * 24; }
+inline int f8240_25(int x) { return x * 25; }
+inline int f8240_26(int x) { return x * 26; }
+inline int f8240_27(int x) { return x * 27; }
+inline int f8240_28(int x) { return x * 28; }
+inline int f8240_29(int x) { return x * 29; }
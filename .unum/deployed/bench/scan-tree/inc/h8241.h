@@ -0,0 +1,42 @@
+#pragma once
+/* header 8241 */
+#include <vector>
+#include "h4922.h"
+#include "h4759.h"
+#include "h1044.h"
+#include "h3522.h"
+#include "h5606.h"
+#ifdef X
+#include "h4390.h"
+#endif
+struct S8241 { int a; const char *s = "x//y"; };
+inline int f8241_0(int x) { return x * 0; }
+inline int f8241_1(int x) { return x * 1; }
+inline int f8241_2(int x) { return x * 2; }
+inline int f8241_3(int x) { return x * 3; }
+inline int f8241_4(int x) { return x * 4; }
+inline int f8241_5(int x) { return x * 5; }
+inline int f8241_6(int x) { return x * 6; }
+inline int f8241_7(int x) { return x * 7; }
+inline int f8241_8(int x) { return x * 8; }
+inline int f8241_9(int x) { return x * 9; }
+inline int f8241_10(int x) { return x * 10; }
+inline int f8241_11(int x) { return x * 11; }
+inline int f8241_12(int x) { return x * 12; }
+inline int f8241_13(int x) { return x * 13; }
+inline int f8241_14(int x) { return x * 14; }
+inline int f8241_15(int x) { return x * 15; }
+inline int f8241_16(int x) { return x * 16; }
+inline int f8241_17(int x) { return x * 17; }
+inline int f8241_18(int x) { return x * 18; }
+inline int f8241_19(int x) { return x * 19; }
+inline int f8241_20(int x) { return x * 20; }
+inline int f8241_21(int x) { return x * 21; }
+inline int f8241_22(int x) { return x * 22; }
+inline int f8241_23(int x) { return x * 23; }
+inline int f8241_24(int x) { return x * 24; }
+inline int f8241_25(int x) { return x * 25; }
+inline int f8241_26(int x) { return x * 26; }
+inline int f8241_27(int x) { return x * 27; }
+inline int f8241_28(int x) { return x * 28; }
+inline int f8241_29(int x) { return x * 29; }
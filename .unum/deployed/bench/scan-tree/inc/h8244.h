@@ -0,0 +1,42 @@
+#pragma once
+/* header 8244 */
+#include <vector>
+#include "h8514.h"
+#include "h2154.h"
+#include "h4680.h"
+#include "h3490.h"
+#include "h6716.h"
+#ifdef X
+#include "h8957.h"
+#endif
+struct S8244 { int a; const char *s = "x//y"; };
+inline int f8244_0(int x) { return x * 0; }
+inline int f8244_1(int x) { return x * 1; }
+inline int f8244_2(int x) { return x * 2; }
+inline int f8244_3(int x) { return x * 3; }
+inline int f8244_4(int x) { return x * 4; }
+inline int f8244_5(int x) { return x * 5; }
+inline int f8244_6(int x) { return x * 6; }
+inline int f8244_7(int x) { return x * 7; }
+inline int f8244_8(int x) { return x * 8; }
+inline int f8244_9(int x) { return x * 9; }
+inline int f8244_10(int x) { return x * 10; }
+inline int f8244_11(int x) { return x * 11; }
+inline int f8244_12(int x) { return x * 12; }
+inline int f8244_13(int x) { return x * 13; }
+inline int f8244_14(int x) { return x * 14; }
+inline int f8244_15(int x) { return x * 15; }
+inline int f8244_16(int x) { return x * 16; }
+inline int f8244_17(int x) { return x * 17; }
+inline int f8244_18(int x) { return x * 18; }
+inline int f8244_19(int x) { return x * 19; }
+inline int f8244_20(int x) { return x * 20; }
+inline int f8244_21(int x) { return x * 21; }
+inline int f8244_22(int x) { return x * 22; }
+inline int f8244_23(int x) { return x * 23; }
+inline int f8244_24(int x) { return x * 24; }
+inline int f8244_25(int x) { return x * 25; }
+inline int f8244_26(int x) { return x * 26; }
+inline int f8244_27(int x) { return x * 27; }
+inline int f8244_28(int x) { return x * 28; }
+inline int f8244_29(int x) { return x * 29; }
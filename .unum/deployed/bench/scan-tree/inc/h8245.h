@@ -0,0 +1,42 @@
+#pragma once
+/* header 8245 */
+#include <vector>
+#include "h4870.h"
+#include "h7981.h"
+#include "h2773.h"
+#include "h7459.h"
+#include "h1793.h"
+#ifdef X
+#include "h2345.h"
+#endif
+struct S8245 { int a; const char *s = "x//y"; };
+inline int f8245_0(int x) { return x * 0; }
+inline int f8245_1(int x) { return x * 1; }
+inline int f8245_2(int x) { return x * 2; }
+inline int f8245_3(int x) { return x * 3; }
+inline int f8245_4(int x) { return x * 4; }
+inline int f8245_5(int x) { return x * 5; }
+inline int f8245_6(int x) { return x * 6; }
+inline int f8245_7(int x) { return x * 7; }
+inline int f8245_8(int x) { return x * 8; }
+inline int f8245_9(int x) { return x * 9; }
+inline int f8245_10(int x) { return x * 10; }
+inline int f8245_11(int x) { return x * 11; }
+inline int f8245_12(int x) { return x * 12; }
+inline int f8245_13(int x) { return x * 13; }
+inline int f8245_14(int x) { return x * 14; }
+inline int f8245_15(int x) { return x * 15; }
+inline int f8245_16(int x) { return x * 16; }
+inline int f8245_17(int x) { return x * 17; }
+inline int f8245_18(int x) { return x * 18; }
+inline int f8245_19(int x) { return x * 19; }
+inline int f8245_20(int x) { return x * 20; }
+inline int f8245_21(int x) { return x * 21; }
+inline int f8245_22(int x) { return x * 22; }
+inline int f8245_23(int x) { return x * 23; }
+inline int f8245_24(int x) { return x * 24; }
+inline int f8245_25(int x) { return x * 25; }
+inline int f8245_26(int x) { return x * 26; }
+inline int f8245_27(int x) { return x * 27; }
+inline int f8245_28(int x) { return x * 28; }
+inline int f8245_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8247 */
+#include <vector>
+#include "h9097.h"
+#include "h4170.h"
+#include "h2963.h"
+#include "h2639.h"
+#include "h1576.h"
+#ifdef X
+#include "h3847.h"
+#endif
+struct S8247 { int a; const char *s = "x//y"; };
+inline int f8247_0(int x) { return x * 0; }
+inline int f8247_1(int x) { return x * 1; }
+inline int f8247_2(int x) { return x * 2; }
+inline int f8247_3(int x) { return x * 3; }
+inline int f8247_4(int x) { return x * 4; }
+inline int f8247_5(int x) { return x * 5; }
+inline int f8247_6(int x) { return x * 6; }
+inline int f8247_7(int x) { return x * 7; }
+inline int f8247_8(int x) { return x * 8; }
+inline int f8247_9(int x) { return x * 9; }
+inline int f8247_10(int x) { return x * 10; }
+inline int f8247_11(int x) { return x * 11; }
+inline int f8247_12(int x) { return x * 12; }
+inline int f8247_13(int x) { return x * 13; }
+inline int f8247_14(int x) { return x * 14; }
+inline int f8247_15(int x) { return x * 15; }
+inline int f8247_16(int x) { return x * 16; }
+inline int f8247_17(int x) { return x * 17; }
+inline int f8247_18(int x) { return x * 18; }
+inline int f8247_19(int x) { return x * 19; }
+inline int f8247_20(int x) { return x * 20; }
+inline int f8247_21(int x) { return x * 21; }
+inline int f8247_22(int x) { return x * 22; }
+inline int f8247_23(int x) { return x * 23; }
+inline int f8247_24(int x) { return x * 24; }
+inline int f8247_25(int x) { return x * 25; }
+inline int f8247_26(int x) { return x * 26; }
+inline int f8247_27(int x) { return x * 27; }
+inline int f8247_28(int x) { return x * 28; }
+inline int f8247_29(int x) { return x * 29; }
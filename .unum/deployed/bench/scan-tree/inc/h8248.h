@@ -0,0 +1,42 @@
+#pragma once
+/* header 8248 */
+#include <vector>
+#include "h2405.h"
+#include "h8609.h"
+#include "h9948.h"
+#include "h5654.h"
+#include "h3002.h"
+#ifdef X
+#include "h1661.h"
+#endif
+struct S8248 { int a; const char *s = "x//y"; };
+inline int f8248_0(int x) { return x * 0; }
+inline int f8248_1(int x) { return x * 1; }
+inline int f8248_2(int x) { return x * 2; }
+inline int f8248_3(int x) { return x * 3; }
+inline int f8248_4(int x) { return x * 4; }
+inline int f8248_5(int x) { return x * 5; }
+inline int f8248_6(int x) { return x * 6; }
+inline int f8248_7(int x) { return x * 7; }
+inline int f8248_8(int x) { return x * 8; }
+inline int f8248_9(int x) { return x * 9; }
+inline int f8248_10(int x) { return x * 10; }
+inline int f8248_11(int x) { return x * 11; }
+inline int f8248_12(int x) { return x * 12; }
+inline int f8248_13(int x) { return x * 13; }
+inline int f8248_14(int x) { return x * 14; }
+inline int f8248_15(int x) { return x * 15; }
+inline int f8248_16(int x) { return x * 16; }
+inline int f8248_17(int x) { return x * 17; }
+inline int f8248_18(int x) { return x * 18; }
+inline int f8248_19(int x) { return x * 19; }
+inline int f8248_20(int x) { return x * 20; }
+inline int f8248_21(int x) { return x * 21; }
+inline int f8248_22(int x) { return x * 22; }
+inline int f8248_23(int x) { return x * 23; }
+inline int f8248_24(int x) { return x * 24; }
+inline int f8248_25(int x) { return x * 25; }
+inline int f8248_26(int x) { return x * 26; }
+inline int f8248_27(int x) { return x * 27; }
+inline int f8248_28(int x) { return x * 28; }
+inline int f8248_29(int x) { return x * 29; }
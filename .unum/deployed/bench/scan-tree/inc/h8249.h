@@ -0,0 +1,42 @@
+#pragma once
+/* header 8249 */
+#include <vector>
+#include "h1072.h"
+#include "h8687.h"
+#include "h3992.h"
+#include "h4353.h"
+#include "h8006.h"
+#ifdef X
+#include "h4983.h"
+#endif
+struct S8249 { int a; const char *s = "x//y"; };
+inline int f8249_0(int x) { return x * 0; }
+inline int f8249_1(int x) { return x * 1; }
+inline int f8249_2(int x) { return x * 2; }
+inline int f8249_3(int x) { return x * 3; }
+inline int f8249_4(int x) { return x * 4; }
+inline int f8249_5(int x) { return x * 5; }
+inline int f8249_6(int x) { return x * 6; }
+inline int f8249_7(int x) { return x * 7; }
+inline int f8249_8(int x) { return x * 8; }
+inline int f8249_9(int x) { return x * 9; }
+inline int f8249_10(int x) { return x * 10; }
+inline int f8249_11(int x) { return x * 11; }
+inline int f8249_12(int x) { return x * 12; }
+inline int f8249_13(int x) { return x * 13; }
+inline int f8249_14(int x) { return x * 14; }
+inline int f8249_15(int x) { return x * 15; }
+inline int f8249_16(int x) { return x * 16; }
+inline int f8249_17(int x) { return x * 17; }
+inline int f8249_18(int x) { return x * 18; }
+inline int f8249_19(int x) { return x * 19; }
+inline int f8249_20(int x) { return x * 20; }
+inline int f8249_21(int x) { return x * 21; }
+inline int f8249_22(int x) { return x * 22; }
+inline int f8249_23(int x) { return x * 23; }
+inline int f8249_24(int x) { return x * 24; }
+inline int f8249_25(int x) { return x * 25; }
+inline int f8249_26(int x) { return x * 26; }
+inline int f8249_27(int x) { return x * 27; }
+inline int f8249_28(int x) { return x * 28; }
+inline int f8249_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 825 */
+#include <vector>
+#include "h9222.h"
+#include "h2105.h"
+#include "h2958.h"
+#include "h9852.h"
+#include "h2799.h"
+#ifdef X
+#include "h7995.h"
+#endif
+struct S825 { int a; const char *s = "x//y"; };
+inline int f825_0(int x) { return x * 0; }
+inline int f825_1(int x) { return x * 1; }
+inline int f825_2(int x) { return x * 2; }
+inline int f825_3(int x) { return x * 3; }
+inline int f825_4(int x) { return x * 4; }
+inline int f825_5(int x) { return x * 5; }
+inline int f825_6(int x) { return x * 6; }
+inline int f825_7(int x) { return x * 7; }
+inline int f825_8(int x) { return x * 8; }
+inline int f825_9(int x) { return x * 9; }
+inline int f825_10(int x) { return x * 10; }
+inline int f825_11(int x) { return x * 11; }
+inline int f825_12(int x) { return x * 12; }
+inline int f825_13(int x) { return x * 13; }
+inline int f825_14(int x) { return x * 14; }
+inline int f825_15(int x) { return x * 15; }
+inline int f825_16(int x) { return x * 16; }
+inline int f825_17(int x) { return x * 17; }
+inline int f825_18(int x) { return x * 18; }
+inline int f825_19(int x) { return x * 19; }
+inline int f825_20(int x) { return x * 20; }
+inline int f825_21(int x) { return x * 21; }
+inline int f825_22(int x) { return x * 22; }
+inline int f825_23(int x) { return x * 23; }
+inline int f825_24(int x) { return x * 24; }
+inline int f825_25(int x) { return x * 25; }
+inline int f825_26(int x) { return x * 26; }
+inline int f825_27(int x) { return x * 27; }
+inline int f825_28(int x) { return x * 28; }
+inline int f825_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8252 */
+#include <vector>
+#include "h7971.h"
+#include "h335.h"
+#include "h2181.h"
+#include "h5981.h"
+#include "h2171.h"
+#ifdef X
+#include "h5791.h"
+#endif
+struct S8252 { int a; const char *s = "x//y"; };
+inline int f8252_0(int x) { return x * 0; }
+inline int f8252_1(int x) { return x * 1; }
+inline int f8252_2(int x) { return x * 2; }
+inline int f8252_3(int x) { return x * 3; }
+inline int f8252_4(int x) { return x * 4; }
+inline int f8252_5(int x) { return x * 5; }
+inline int f8252_6(int x) { return x * 6; }
+inline int f8252_7(int x) { return x * 7; }
+inline int f8252_8(int x) { return x * 8; }
+inline int f8252_9(int x) { return x * 9; }
+inline int f8252_10(int x) { return x * 10; }
+inline int f8252_11(int x) { return x * 11; }
+inline int f8252_12(int x) { return x * 12; }
+inline int f8252_13(int x) { return x * 13; }
+inline int f8252_14(int x) { return x * 14; }
+inline int f8252_15(int x) { return x * 15; }
+inline int f8252_16(int x) { return x * 16; }
+inline int f8252_17(int x) { return x * 17; }
+inline int f8252_18(int x) { return x * 18; }
+inline int f8252_19(int x) { return x * 19; }
+inline int f8252_20(int x) { return x * 20; }
+inline int f8252_21(int x) { return x * 21; }
+inline int f8252_22(int x) { return x * 22; }
+inline int f8252_23(int x) { return x * 23; }
+inline int f8252_24(int x) { return x * 24; }
+inline int f8252_25(int x) { return x * 25; }
+inline int f8252_26(int x) { return x * 26; }
+inline int f8252_27(int x) { return x * 27; }
+inline int f8252_28(int x) { return x * 28; }
+inline int f8252_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8253 */
+#include <vector>
+#include "h5345.h"
+#include "h5006.h"
+#include "h1255.h"
+#include "h7553.h"
+#include "h7598.h"
+#ifdef X
+#include "h3548.h"
+#endif
+struct S8253 { int a; const char *s = "x//y"; };
+inline int f8253_0(int x) { return x * 0; }
+inline int f8253_1(int x) { return x * 1; }
+inline int f8253_2(int x) { return x * 2; }
+inline int f8253_3(int x) { return x * 3; }
+inline int f8253_4(int x) { return x * 4; }
+inline int f8253_5(int x) { return x * 5; }
+inline int f8253_6(int x) { return x * 6; }
+inline int f8253_7(int x) { return x * 7; }
+inline int f8253_8(int x) { return x * 8; }
+inline int f8253_9(int x) { return x * 9; }
+inline int f8253_10(int x) { return x * 10; }
+inline int f8253_11(int x) { return x * 11; }
+inline int f8253_12(int x) { return x * 12; }
+inline int f8253_13(int x) { return x * 13; }
+inline int f8253_14(int x) { return x * 14; }
+inline int f8253_15(int x) { return x * 15; }
+inline int f8253_16(int x) { return x * 16; }
+inline int f8253_17(int x) { return x * 17; }
+inline int f8253_18(int x) { return x * 18; }
+inline int f8253_19(int x) { return x * 19; }
+inline int f8253_20(int x) { return x * 20; }
+inline int f8253_21(int x) { return x * 21; }
+inline int f8253_22(int x) { return x * 22; }
+inline int f8253_23(int x) { return x * 23; }
+inline int f8253_24(int x) { return x * 24; }
+inline int f8253_25(int x) { return x * 25; }
+inline int f8253_26(int x) { return x * 26; }
+inline int f8253_27(int x) { return x * 27; }
+inline int f8253_28(int x) { return x * 28; }
+inline int f8253_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8254 */
+#include <vector>
+#include "h5907.h"
+#include "h3715.h"
+#include "h3677.h"
+#include "h1154.h"
+#include "h1602.h"
+#ifdef X
+#include "h8195.h"
+#endif
+struct S8254 { int a; const char *s = "x//y"; };
+inline int f8254_0(int x) { return x * 0; }
+inline int f8254_1(int x) { return x * 1; }
+inline int f8254_2(int x) { return x * 2; }
+inline int f8254_3(int x) { return x * 3; }
+inline int f8254_4(int x) { return x * 4; }
+inline int f8254_5(int x) { return x * 5; }
+inline int f8254_6(int x) { return x * 6; }
+inline int f8254_7(int x) { return x * 7; }
+inline int f8254_8(int x) { return x * 8; }
+inline int f8254_9(int x) { return x * 9; }
+inline int f8254_10(int x) { return x * 10; }
+inline int f8254_11(int x) { return x * 11; }
+inline int f8254_12(int x) { return x * 12; }
+inline int f8254_13(int x) { return x * 13; }
+inline int f8254_14(int x) { return x * 14; }
+inline int f8254_15(int x) { return x * 15; }
+inline int f8254_16(int x) { return x * 16; }
+inline int f8254_17(int x) { return x * 17; }
+inline int f8254_18(int x) { return x * 18; }
+inline int f8254_19(int x) { return x * 19; }
+inline int f8254_20(int x) { return x * 20; }
+inline int f8254_21(int x) { return x * 21; }
+inline int f8254_22(int x) { return x * 22; }
+inline int f8254_23(int x) { return x * 23; }
+inline int f8254_24(int x) { return x * 24; }
+inline int f8254_25(int x) { return x * 25; }
+inline int f8254_26(int x) { return x * 26; }
+inline int f8254_27(int x) { return x * 27; }
+inline int f8254_28(int x) { return x * 28; }
+inline int f8254_29(int x) { return x * 29; }
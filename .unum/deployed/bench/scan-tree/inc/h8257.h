@@ -0,0 +1,42 @@
+#pragma once
+/* header 8257 */
+#include <vector>
+#include "h1895.h"
+#include "h1526.h"
+#include "h7079.h"
+#include "h175.h"
+#include "h4618.h"
+#ifdef X
+#include "h5997.h"
+#endif
+struct S8257 { int a; const char *s = "x//y"; };
+inline int f8257_0(int x) { return x * 0; }
+inline int f8257_1(int x) { return x * 1; }
+inline int f8257_2(int x) { return x * 2; }
+inline int f8257_3(int x) { return x * 3; }
+inline int f8257_4(int x) { return x * 4; }
+inline int f8257_5(int x) { return x * 5; }
+inline int f8257_6(int x) { return x * 6; }
+inline int f8257_7(int x) { return x * 7; }
+inline int f8257_8(int x) { return x * 8; }
+inline int f8257_9(int x) { return x * 9; }
+inline int f8257_10(int x) { return x * 10; }
+inline int f8257_11(int x) { return x * 11; }
+inline int f8257_12(int x) { return x * 12; }
+inline int f8257_13(int x) { return x * 13; }
+inline int f8257_14(int x) { return x * 14; }
+inline int f8257_15(int x) { return x * 15; }
+inline int f8257_16(int x) { return x * 16; }
+inline int f8257_17(int x) { return x * 17; }
+inline int f8257_18(int x) { return x * 18; }
+inline int f8257_19(int x) { return x * 19; }
+inline int f8257_20(int x) { return x * 20; }
+inline int f8257_21(int x) { return x * 21; }
+inline int f8257_22(int x) { return x * 22; }
+inline int f8257_23(int x) { return x * 23; }
+inline int f8257_24(int x) { return x * 24; }
+inline int f8257_25(int x) { return x * 25; }
+inline int f8257_26(int x) { return x * 26; }
+inline int f8257_27(int x) { return x * 27; }
+inline int f8257_28(int x) { return x * 28; }
+inline int f8257_29(int x) { return x * 29; }
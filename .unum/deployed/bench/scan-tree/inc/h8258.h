@@ -0,0 +1,42 @@
+#pragma once
+/* header 8258 */
+#include <vector>
+#include "h4545.h"
+#include "h257.h"
+#include "h5519.h"
+#include "h5176.h"
+#include "h431.h"
+#ifdef X
+#include "h70.h"
+#endif
+struct S8258 { int a; const char *s = "x//y"; };
+inline int f8258_0(int x) { return x * 0; }
+inline int f8258_1(int x) { return x * 1; }
+inline int f8258_2(int x) { return x * 2; }
+inline int f8258_3(int x) { return x * 3; }
+inline int f8258_4(int x) { return x * 4; }
+inline int f8258_5(int x) { return x * 5; }
+inline int f8258_6(int x) { return x * 6; }
+inline int f8258_7(int x) { return x * 7; }
+inline int f8258_8(int x) { return x * 8; }
+inline int f8258_9(int x) { return x * 9; }
+inline int f8258_10(int x) { return x * 10; }
+inline int f8258_11(int x) { return x * 11; }
+inline int f8258_12(int x) { return x * 12; }
+inline int f8258_13(int x) { return x * 13; }
+inline int f8258_14(int x) { return x * 14; }
+inline int f8258_15(int x) { return x * 15; }
+inline int f8258_16(int x) { return x * 16; }
+inline int f8258_17(int x) { return x * 17; }
+inline int f8258_18(int x) { return x * 18; }
+inline int f8258_19(int x) { return x * 19; }
+inline int f8258_20(int x) { return x * 20; }
+inline int f8258_21(int x) { return x * 21; }
+inline int f8258_22(int x) { return x * 22; }
+inline int f8258_23(int x) { return x * 23; }
+inline int f8258_24(int x) { return x * 24; }
+inline int f8258_25(int x) { return x * 25; }
+inline int f8258_26(int x) { return x * 26; }
+inline int f8258_27(int x) { return x * 27; }
+inline int f8258_28(int x) { return x * 28; }
+inline int f8258_29(int x) { return x * 29; }
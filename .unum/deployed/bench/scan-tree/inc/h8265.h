@@ -0,0 +1,42 @@
+#pragma once
+/* header 8265 */
+#include <vector>
+#include "h3325.h"
+#include "h7131.h"
+#include "h8312.h"
+#include "h6145.h"
+#include "h2018.h"
+#ifdef X
+#include "h9579.h"
+#endif
+struct S8265 { int a; const char *s = "x//y"; };
+inline int f8265_0(int x) { return x * 0; }
+inline int f8265_1(int x) { return x * 1; }
+inline int f8265_2(int x) { return x * 2; }
+inline int f8265_3(int x) { return x * 3; }
+inline int f8265_4(int x) { return x * 4; }
+inline int f8265_5(int x) { return x * 5; }
+inline int f8265_6(int x) { return x * 6; }
+inline int f8265_7(int x) { return x * 7; }
+inline int f8265_8(int x) { return x * 8; }
+inline int f8265_9(int x) { return x * 9; }
+inline int f8265_10(int x) { return x * 10; }
+inline int f8265_11(int x) { return x * 11; }
+inline int f8265_12(int x) { return x * 12; }
+inline int f8265_13(int x) { return x * 13; }
+inline int f8265_14(int x) { return x * 14; }
+inline int f8265_15(int x) { return x * 15; }
+inline int f8265_16(int x) { return x * 16; }
+inline int f8265_17(int x) { return x * 17; }
+inline int f8265_18(int x) { return x * 18; }
+inline int f8265_19(int x) { return x * 19; }
+inline int f8265_20(int x) { return x * 20; }
+inline int f8265_21(int x) { return x * 21; }
+inline int f8265_22(int x) { return x * 22; }
+inline int f8265_23(int x) { return x * 23; }
+inline int f8265_24(int x) { return x * 24; }
+inline int f8265_25(int x) { return x * 25; }
+inline int f8265_26(int x) { return x * 26; }
+inline int f8265_27(int x) { return x * 27; }
+inline int f8265_28(int x) { return x * 28; }
+inline int f8265_29(int x) { return x * 29; }
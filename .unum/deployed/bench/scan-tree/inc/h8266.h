@@ -0,0 +1,42 @@
+#pragma once
+/* header 8266 */
+#include <vector>
+#include "h4366.h"
+#include "h3984.h"
+#include "h2096.h"
+#include "h6172.h"
+#include "h2448.h"
+#ifdef X
+#include "h67.h"
+#endif
+struct S8266 { int a; const char *s = "x//y"; };
+inline int f8266_0(int x) { return x * 0; }
+inline int f8266_1(int x) { return x * 1; }
+inline int f8266_2(int x) { return x * 2; }
+inline int f8266_3(int x) { return x * 3; }
+inline int f8266_4(int x) { return x * 4; }
+inline int f8266_5(int x) { return x * 5; }
+inline int f8266_6(int x) { return x * 6; }
+inline int f8266_7(int x) { return x * 7; }
+inline int f8266_8(int x) { return x * 8; }
+inline int f8266_9(int x) { return x * 9; }
+inline int f8266_10(int x) { return x * 10; }
+inline int f8266_11(int x) { return x * 11; }
+inline int f8266_12(int x) { return x * 12; }
+inline int f8266_13(int x) { return x * 13; }
+inline int f8266_14(int x) { return x * 14; }
+inline int f8266_15(int x) { return x * 15; }
+inline int f8266_16(int x) { return x * 16; }
+inline int f8266_17(int x) { return x * 17; }
+inline int f8266_18(int x) { return x * 18; }
+inline int f8266_19(int x) { return x * 19; }
+inline int f8266_20(int x) { return x * 20; }
+inline int f8266_21(int x) { return x * 21; }
+inline int f8266_22(int x) { return x * 22; }
+inline int f8266_23(int x) { return x * 23; }
+inline int f8266_24(int x) { return x * 24; }
+inline int f8266_25(int x) { return x * 25; }
+inline int f8266_26(int x) { return x * 26; }
+inline int f8266_27(int x) { return x * 27; }
+inline int f8266_28(int x) { return x * 28; }
+inline int f8266_29(int x) { return x * 29; }
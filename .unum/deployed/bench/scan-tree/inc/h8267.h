@@ -0,0 +1,42 @@
+#pragma once
+/* header 8267 */
+#include <vector>
+#include "h7500.h"
+#include "h4734.h"
+#include "h2280.h"
+#include "h5476.h"
+#include "h3458.h"
+#ifdef X
+#include "h3141.h"
+#endif
+struct S8267 { int a; const char *s = "x//y"; };
+inline int f8267_0(int x) { return x * 0; }
+inline int f8267_1(int x) { return x * 1; }
+inline int f8267_2(int x) { return x * 2; }
+inline int f8267_3(int x) { return x * 3; }
+inline int f8267_4(int x) { return x * 4; }
+inline int f8267_5(int x) { return x * 5; }
+inline int f8267_6(int x) { return x * 6; }
+inline int f8267_7(int x) { return x * 7; }
+inline int f8267_8(int x) { return x * 8; }
+inline int f8267_9(int x) { return x * 9; }
+inline int f8267_10(int x) { return x * 10; }
+inline int f8267_11(int x) { return x * 11; }
+inline int f8267_12(int x) { return x * 12; }
+inline int f8267_13(int x) { return x * 13; }
+inline int f8267_14(int x) { return x * 14; }
+inline int f8267_15(int x) { return x * 15; }
+inline int f8267_16(int x) { return x * 16; }
+inline int f8267_17(int x) { return x * 17; }
+inline int f8267_18(int x) { return x * 18; }
+inline int f8267_19(int x) { return x * 19; }
+inline int f8267_20(int x) { return x * 20; }
+inline int f8267_21(int x) { return x * 21; }
+inline int f8267_22(int x) { return x * 22; }
+inline int f8267_23(int x) { return x * 23; }
+inline int f8267_24(int x) { return x * 24; }
+inline int f8267_25(int x) { return x * 25; }
+inline int f8267_26(int x) { return x * 26; }
+inline int f8267_27(int x) { return x * 27; }
+inline int f8267_28(int x) { return x * 28; }
+inline int f8267_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8270 */
+#include <vector>
+#include "h1197.h"
+#include "h4158.h"
+#include "h670.h"
+#include "h9104.h"
+#include "h7370.h"
+#ifdef X
+#include "h9198.h"
+#endif
+struct S8270 { int a; const char *s = "x//y"; };
+inline int f8270_0(int x) { return x * 0; }
+inline int f8270_1(int x) { return x * 1; }
+inline int f8270_2(int x) { return x * 2; }
+inline int f8270_3(int x) { return x * 3; }
+inline int f8270_4(int x) { return x * 4; }
+inline int f8270_5(int x) { return x * 5; }
+inline int f8270_6(int x) { return x * 6; }
+inline int f8270_7(int x) { return x * 7; }
+inline int f8270_8(int x) { return x * 8; }
+inline int f8270_9(int x) { return x * 9; }
+inline int f8270_10(int x) { return x * 10; }
+inline int f8270_11(int x) { return x * 11; }
+inline int f8270_12(int x) { return x * 12; }
+inline int f8270_13(int x) { return x * 13; }
+inline int f8270_14(int x) { return x * 14; }
+inline int f8270_15(int x) { return x * 15; }
+inline int f8270_16(int x) { return x * 16; }
+inline int f8270_17(int x) { return x * 17; }
+inline int f8270_18(int x) { return x * 18; }
+inline int f8270_19(int x) { return x * 19; }
+inline int f8270_20(int x) { return x * 20; }
+inline int f8270_21(int x) { return x * 21; }
+inline int f8270_22(int x) { return x * 22; }
+inline int f8270_23(int x) { return x * 23; }
+inline int f8270_24(int x) { return x * 24; }
+inline int f8270_25(int x) { return x * 25; }
+inline int f8270_26(int x) { return x * 26; }
+inline int f8270_27(int x) { return x * 27; }
+inline int f8270_28(int x) { return x * 28; }
+inline int f8270_29(int x) { return x * 29; }
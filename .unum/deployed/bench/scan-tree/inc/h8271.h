@@ -0,0 +1,42 @@
+#pragma once
+/* header 8271 */
+#include <vector>
+#include "h909.h"
+#include "h5590.h"
+#include "h4131.h"
+#include "h9999.h"
+#include "h9362.h"
+#ifdef X
+#include "h2298.h"
+#endif
+struct S8271 { int a; const char *s = "x//y"; };
+inline int f8271_0(int x) { return x * 0; }
+inline int f8271_1(int x) { return x * 1; }
+inline int f8271_2(int x) { return x * 2; }
+inline int f8271_3(int x) { return x * 3; }
+inline int f8271_4(int x) { return x * 4; }
+inline int f8271_5(int x) { return x * 5; }
+inline int f8271_6(int x) { return x * 6; }
+inline int f8271_7(int x) { return x * 7; }
+inline int f8271_8(int x) { return x * 8; }
+inline int f8271_9(int x) { return x * 9; }
+inline int f8271_10(int x) { return x * 10; }
+inline int f8271_11(int x) { return x * 11; }
+inline int f8271_12(int x) { return x * 12; }
+inline int f8271_13(int x) { return x * 13; }
+inline int f8271_14(int x) { return x * 14; }
+inline int f8271_15(int x) { return x * 15; }
+inline int f8271_16(int x) { return x * 16; }
+inline int f8271_17(int x) { return x * 17; }
+inline int f8271_18(int x) { return x * 18; }
+inline int f8271_19(int x) { return x * 19; }
+inline int f8271_20(int x) { return x * 20; }
+inline int f8271_21(int x) { return x * 21; }
+inline int f8271_22(int x) { return x * 22; }
+inline int f8271_23(int x) { return x * 23; }
+inline int f8271_24(int x) { return x * 24; }
+inline int f8271_25(int x) { return x * 25; }
+inline int f8271_26(int x) { return x * 26; }
+inline int f8271_27(int x) { return x * 27; }
+inline int f8271_28(int x) { return x * 28; }
+inline int f8271_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8272 */
+#include <vector>
+#include "h1200.h"
+#include "h5702.h"
+#include "h3027.h"
+#include "h6160.h"
+#include "h7035.h"
+#ifdef X
+#include "h7662.h"
+#endif
+struct S8272 { int a; const char *s = "x//y"; };
+inline int f8272_0(int x) { return x * 0; }
+inline int f8272_1(int x) { return x * 1; }
+inline int f8272_2(int x) { return x * 2; }
+inline int f8272_3(int x) { return x * 3; }
+inline int f8272_4(int x) { return x * 4; }
+inline int f8272_5(int x) { return x * 5; }
+inline int f8272_6(int x) { return x * 6; }
+inline int f8272_7(int x) { return x * 7; }
+inline int f8272_8(int x) { return x * 8; }
+inline int f8272_9(int x) { return x * 9; }
+inline int f8272_10(int x) { return x * 10; }
+inline int f8272_11(int x) { return x * 11; }
+inline int f8272_12(int x) { return x * 12; }
+inline int f8272_13(int x) { return x * 13; }
+inline int f8272_14(int x) { return x * 14; }
+inline int f8272_15(int x) { return x * 15; }
+inline int f8272_16(int x) { return x * 16; }
+inline int f8272_17(int x) { return x * 17; }
+inline int f8272_18(int x) { return x * 18; }
+inline int f8272_19(int x) { return x * 19; }
+inline int f8272_20(int x) { return x * 20; }
+inline int f8272_21(int x) { return x * 21; }
+inline int f8272_22(int x) { return x * 22; }
+inline int f8272_23(int x) { return x * 23; }
+inline int f8272_24(int x) { return x * 24; }
+inline int f8272_25(int x) { return x * 25; }
+inline int f8272_26(int x) { return x * 26; }
+inline int f8272_27(int x) { return x * 27; }
+inline int f8272_28(int x) { return x * 28; }
+inline int f8272_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8275 */
+#include <vector>
+#include "h5144.h"
+#include "h429.h"
+#include "h2963.h"
+#include "h2505.h"
+#include "h1384.h"
+#ifdef X
+#include "h8865.h"
+#endif
+struct S8275 { int a; const char *s = "x//y"; };
+inline int f8275_0(int x) { return x * 0; }
+inline int f8275_1(int x) { return x * 1; }
+inline int f8275_2(int x) { return x * 2; }
+inline int f8275_3(int x) { return x * 3; }
+inline int f8275_4(int x) { return x * 4; }
+inline int f8275_5(int x) { return x * 5; }
+inline int f8275_6(int x) { return x * 6; }
+inline int f8275_7(int x) { return x * 7; }
+inline int f8275_8(int x) { return x * 8; }
+inline int f8275_9(int x) { return x * 9; }
+inline int f8275_10(int x) { return x * 10; }
+inline int f8275_11(int x) { return x * 11; }
+inline int f8275_12(int x) { return x * 12; }
+inline int f8275_13(int x) { return x * 13; }
+inline int f8275_14(int x) { return x * 14; }
+inline int f8275_15(int x) { return x * 15; }
+inline int f8275_16(int x) { return x * 16; }
+inline int f8275_17(int x) { return x * 17; }
+inline int f8275_18(int x) { return x * 18; }
+inline int f8275_19(int x) { return x * 19; }
+inline int f8275_20(int x) { return x * 20; }
+inline int f8275_21(int x) { return x * 21; }
+inline int f8275_22(int x) { return x * 22; }
+inline int f8275_23(int x) { return x * 23; }
+inline int f8275_24(int x) { return x * 24; }
+inline int f8275_25(int x) { return x * 25; }
+inline int f8275_26(int x) { return x * 26; }
+inline int f8275_27(int x) { return x * 27; }
+inline int f8275_28(int x) { return x * 28; }
+inline int f8275_29(int x) { return x * 29; }
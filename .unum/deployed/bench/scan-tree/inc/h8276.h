@@ -0,0 +1,42 @@
+#pragma once
+/* header 8276 */
+#include <vector>
+#include "h6422.h"
+#include "h5625.h"
+#include "h3501.h"
+#include "h8742.h"
+#include "h2147.h"
+#ifdef X
+#include "h2696.h"
+#endif
+struct S8276 { int a; const char *s = "x//y"; };
+inline int f8276_0(int x) { return x * 0; }
+inline int f8276_1(int x) { return x * 1; }
+inline int f8276_2(int x) { return x * 2; }
+inline int f8276_3(int x) { return x * 3; }
+inline int f8276_4(int x) { return x * 4; }
+inline int f8276_5(int x) { return x * 5; }
+inline int f8276_6(int x) { return x * 6; }
+inline int f8276_7(int x) { return x * 7; }
+inline int f8276_8(int x) { return x * 8; }
+inline int f8276_9(int x) { return x * 9; }
+inline int f8276_10(int x) { return x * 10; }
+inline int f8276_11(int x) { return x * 11; }
+inline int f8276_12(int x) { return x * 12; }
+inline int f8276_13(int x) { return x * 13; }
+inline int f8276_14(int x) { return x * 14; }
+inline int f8276_15(int x) { return x * 15; }
+inline int f8276_16(int x) { return x * 16; }
+inline int f8276_17(int x) { return x * 17; }
+inline int f8276_18(int x) { return x * 18; }
+inline int f8276_19(int x) { return x * 19; }
+inline int f8276_20(int x) { return x * 20; }
+inline int f8276_21(int x) { return x * 21; }
+inline int f8276_22(int x) { return x * 22; }
+inline int f8276_23(int x) { return x * 23; }
+inline int f8276_24(int x) { return x * 24; }
+inline int f8276_25(int x) { return x * 25; }
+inline int f8276_26(int x) { return x * 26; }
+inline int f8276_27(int x) { return x * 27; }
+inline int f8276_28(int x) { return x * 28; }
+inline int f8276_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8277 */
+#include <vector>
+#include "h1835.h"
+#include "h4852.h"
+#include "h8318.h"
+#include "h5668.h"
+#include "h1251.h"
+#ifdef X
+#include "h7973.h"
+#endif
+struct S8277 { int a; const char *s = "x//y"; };
+inline int f8277_0(int x) { return x * 0; }
+inline int f8277_1(int x) { return x * 1; }
+inline int f8277_2(int x) { return x * 2; }
+inline int f8277_3(int x) { return x * 3; }
+inline int f8277_4(int x) { return x * 4; }
+inline int f8277_5(int x) { return x * 5; }
+inline int f8277_6(int x) { return x * 6; }
+inline int f8277_7(int x) { return x * 7; }
+inline int f8277_8(int x) { return x * 8; }
+inline int f8277_9(int x) { return x * 9; }
+inline int f8277_10(int x) { return x * 10; }
+inline int f8277_11(int x) { return x * 11; }
+inline int f8277_12(int x) { return x * 12; }
+inline int f8277_13(int x) { return x * 13; }
+inline int f8277_14(int x) { return x * 14; }
+inline int f8277_15(int x) { return x * 15; }
+inline int f8277_16(int x) { return x * 16; }
+inline int f8277_17(int x) { return x * 17; }
+inline int f8277_18(int x) { return x * 18; }
+inline int f8277_19(int x) { return x * 19; }
+inline int f8277_20(int x) { return x * 20; }
+inline int f8277_21(int x) { return x * 21; }
+inline int f8277_22(int x) { return x * 22; }
+inline int f8277_23(int x) { return x * 23; }
+inline int f8277_24(int x) { return x * 24; }
+inline int f8277_25(int x) { return x * 25; }
+inline int f8277_26(int x) { return x * 26; }
+inline int f8277_27(int x) { return x * 27; }
+inline int f8277_28(int x) { return x * 28; }
+inline int f8277_29(int x) { return x * 29; }
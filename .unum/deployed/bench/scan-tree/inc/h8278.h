@@ -0,0 +1,42 @@
+#pragma once
+/* header 8278 */
+#include <vector>
+#include "h4475.h"
+#include "h8346.h"
+#include "h4294.h"
+#include "h9236.h"
+#include "h9599.h"
+#ifdef X
+#include "h7915.h"
+#endif
+struct S8278 { int a; const char *s = "x//y"; };
+inline int f8278_0(int x) { return x * 0; }
+inline int f8278_1(int x) { return x * 1; }
+inline int f8278_2(int x) { return x * 2; }
+inline int f8278_3(int x) { return x * 3; }
+inline int f8278_4(int x) { return x * 4; }
+inline int f8278_5(int x) { return x * 5; }
+inline int f8278_6(int x) { return x * 6; }
+inline int f8278_7(int x) { return x * 7; }
+inline int f8278_8(int x) { return x * 8; }
+inline int f8278_9(int x) { return x * 9; }
+inline int f8278_10(int x) { return x * 10; }
+inline int f8278_11(int x) { return x * 11; }
+inline int f8278_12(int x) { return x * 12; }
+inline int f8278_13(int x) { return x * 13; }
+inline int f8278_14(int x) { return x * 14; }
+inline int f8278_15(int x) { return x * 15; }
+inline int f8278_16(int x) { return x * 16; }
+inline int f8278_17(int x) { return x * 17; }
+inline int f8278_18(int x) { return x * 18; }
+inline int f8278_19(int x) { return x * 19; }
+inline int f8278_20(int x) { return x * 20; }
+inline int f8278_21(int x) { return x * 21; }
+inline int f8278_22(int x) { return x * 22; }
+inline int f8278_23(int x) { return x * 23; }
+inline int f8278_24(int x) { return x * 24; }
+inline int f8278_25(int x) { return x * 25; }
+inline int f8278_26(int x) { return x * 26; }
+inline int f8278_27(int x) { return x * 27; }
+inline int f8278_28(int x) { return x * 28; }
+inline int f8278_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8279 */
+#include <vector>
+#include "h7733.h"
+#include "h6263.h"
+#include "h3787.h"
+#include "h7366.h"
+#include "h5523.h"
+#ifdef X
+#include "h6470.h"
+#endif
+struct S8279 { int a; const char *s = "x//y"; };
+inline int f8279_0(int x) { return x * 0; }
+inline int f8279_1(int x) { return x * 1; }
+inline int f8279_2(int x) { return x * 2; }
+inline int f8279_3(int x) { return x * 3; }
+inline int f8279_4(int x) { return x * 4; }
+inline int f8279_5(int x) { return x * 5; }
+inline int f8279_6(int x) { return x * 6; }
+inline int f8279_7(int x) { return x * 7; }
+inline int f8279_8(int x) { return x * 8; }
+inline int f8279_9(int x) { return x * 9; }
+inline int f8279_10(int x) { return x * 10; }
+inline int f8279_11(int x) { return x * 11; }
+inline int f8279_12(int x) { return x * 12; }
+inline int f8279_13(int x) { return x * 13; }
+inline int f8279_14(int x) { return x * 14; }
+inline int f8279_15(int x) { return x * 15; }
+inline int f8279_16(int x) { return x * 16; }
+inline int f8279_17(int x) { return x * 17; }
+inline int f8279_18(int x) { return x * 18; }
+inline int f8279_19(int x) { return x * 19; }
+inline int f8279_20(int x) { return x * 20; }
+inline int f8279_21(int x) { return x * 21; }
+inline int f8279_22(int x) { return x * 22; }
+inline int f8279_23(int x) { return x * 23; }
+inline int f8279_24(int x) { return x * 24; }
+inline int f8279_25(int x) { return x * 25; }
+inline int f8279_26(int x) { return x * 26; }
+inline int f8279_27(int x) { return x * 27; }
+inline int f8279_28(int x) { return x * 28; }
+inline int f8279_29(int x) { return x * 29; }
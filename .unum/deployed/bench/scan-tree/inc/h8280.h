@@ -0,0 +1,42 @@
+#pragma once
+/* header 8280 */
+#include <vector>
+#include "h7319.h"
+#include "h6679.h"
+#include "h4657.h"
+#include "h7918.h"
+#include "h3136.h"
+#ifdef X
+#include "h968.h"
+#endif
+struct S8280 { int a; const char *s = "x//y"; };
+inline int f8280_0(int x) { return x * 0; }
+inline int f8280_1(int x) { return x * 1; }
+inline int f8280_2(int x) { return x * 2; }
+inline int f8280_3(int x) { return x * 3; }
+inline int f8280_4(int x) { return x * 4; }
+inline int f8280_5(int x) { return x * 5; }
+inline int f8280_6(int x) { return x * 6; }
+inline int f8280_7(int x) { return x * 7; }
+inline int f8280_8(int x) { return x * 8; }
+inline int f8280_9(int x) { return x * 9; }
+inline int f8280_10(int x) { return x * 10; }
+inline int f8280_11(int x) { return x * 11; }
+inline int f8280_12(int x) { return x * 12; }
+inline int f8280_13(int x) { return x * 13; }
+inline int f8280_14(int x) { return x * 14; }
+inline int f8280_15(int x) { return x * 15; }
+inline int f8280_16(int x) { return x * 16; }
+inline int f8280_17(int x) { return x * 17; }
+inline int f8280_18(int x) { return x * 18; }
+inline int f8280_19(int x) { return x * 19; }
+inline int f8280_20(int x) { return x * 20; }
+inline int f8280_21(int x) { return x * 21; }
+inline int f8280_22(int x) { return x * 22; }
+inline int f8280_23(int x) { return x * 23; }
+inline int f8280_24(int x) { return x * 24; }
+inline int f8280_25(int x) { return x * 25; }
+inline int f8280_26(int x) { return x * 26; }
+inline int f8280_27(int x) { return x * 27; }
+inline int f8280_28(int x) { return x * 28; }
+inline int f8280_29(int x) { return x * 29; }
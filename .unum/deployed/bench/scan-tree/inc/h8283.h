@@ -0,0 +1,42 @@
+#pragma once
+/* header 8283 */
+#include <vector>
+#include "h3212.h"
+#include "h5340.h"
+#include "h9908.h"
+#include "h698.h"
+#include "h5566.h"
+#ifdef X
+#include "h6379.h"
+#endif
+struct S8283 { int a; const char *s = "x//y"; };
+inline int f8283_0(int x) { return x * 0; }
+inline int f8283_1(int x) { return x * 1; }
+inline int f8283_2(int x) { return x * 2; }
+inline int f8283_3(int x) { return x * 3; }
+inline int f8283_4(int x) { return x * 4; }
+inline int f8283_5(int x) { return x * 5; }
+inline int f8283_6(int x) { return x * 6; }
+inline int f8283_7(int x) { return x * 7; }
+inline int f8283_8(int x) { return x * 8; }
+inline int f8283_9(int x) { return x * 9; }
+inline int f8283_10(int x) { return x * 10; }
+inline int f8283_11(int x) { return x * 11; }
+inline int f8283_12(int x) { return x * 12; }
+inline int f8283_13(int x) { return x * 13; }
+inline int f8283_14(int x) { return x * 14; }
+inline int f8283_15(int x) { return x * 15; }
+inline int f8283_16(int x) { return x * 16; }
+inline int f8283_17(int x) { return x * 17; }
+inline int f8283_18(int x) { return x * 18; }
+inline int f8283_19(int x) { return x * 19; }
+inline int f8283_20(int x) { return x * 20; }
+inline int f8283_21(int x) { return x * 21; }
+inline int f8283_22(int x) { return x * 22; }
+inline int f8283_23(int x) { return x * 23; }
+inline int f8283_24(int x) { return x * 24; }
+inline int f8283_25(int x) { return x * 25; }
+inline int f8283_26(int x) { return x * 26; }
+inline int f8283_27(int x) { return x * 27; }
+inline int f8283_28(int x) { return x * 28; }
+inline int f8283_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8284 */
+#include <vector>
+#include "h7193.h"
+#include "h4299.h"
+#include "h858.h"
+#include "h6029.h"
+#include "h3321.h"
+#ifdef X
+#include "h9552.h"
+#endif
+struct S8284 { int a; const char *s = "x//y"; };
+inline int f8284_0(int x) { return x * 0; }
+inline int f8284_1(int x) { return x * 1; }
+inline int f8284_2(int x) { return x * 2; }
+inline int f8284_3(int x) { return x * 3; }
+inline int f8284_4(int x) { return x * 4; }
+inline int f8284_5(int x) { return x * 5; }
+inline int f8284_6(int x) { return x * 6; }
+inline int f8284_7(int x) { return x * 7; }
+inline int f8284_8(int x) { return x * 8; }
+inline int f8284_9(int x) { return x * 9; }
+inline int f8284_10(int x) { return x * 10; }
+inline int f8284_11(int x) { return x * 11; }
+inline int f8284_12(int x) { return x * 12; }
+inline int f8284_13(int x) { return x * 13; }
+inline int f8284_14(int x) { return x * 14; }
+inline int f8284_15(int x) { return x * 15; }
+inline int f8284_16(int x) { return x * 16; }
+inline int f8284_17(int x) { return x * 17; }
+inline int f8284_18(int x) { return x * 18; }
+inline int f8284_19(int x) { return x * 19; }
+inline int f8284_20(int x) { return x * 20; }
+inline int f8284_21(int x) { return x * 21; }
+inline int f8284_22(int x) { return x * 22; }
+inline int f8284_23(int x) { return x * 23; }
+inline int f8284_24(int x) { return x * 24; }
+inline int f8284_25(int x) { return x * 25; }
+inline int f8284_26(int x) { return x * 26; }
+inline int f8284_27(int x) { return x * 27; }
+inline int f8284_28(int x) { return x * 28; }
+inline int f8284_29(int x) { return x * 29; }
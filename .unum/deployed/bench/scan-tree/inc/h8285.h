@@ -0,0 +1,42 @@
+#pragma once
+/* header 8285 */
+#include <vector>
+#include "h4590.h"
+#include "h7147.h"
+#include "h6907.h"
+#include "h212.h"
+#include "h7149.h"
+#ifdef X
+#include "h382.h"
+#endif
+struct S8285 { int a; const char *s = "x//y"; };
+inline int f8285_0(int x) { return x * 0; }
+inline int f8285_1(int x) { return x * 1; }
+inline int f8285_2(int x) { return x * 2; }
+inline int f8285_3(int x) { return x * 3; }
+inline int f8285_4(int x) { return x * 4; }
+inline int f8285_5(int x) { return x * 5; }
+inline int f8285_6(int x) { return x * 6; }
+inline int f8285_7(int x) { return x * 7; }
+inline int f8285_8(int x) { return x * 8; }
+inline int f8285_9(int x) { return x * 9; }
+inline int f8285_10(int x) { return x * 10; }
+inline int f8285_11(int x) { return x * 11; }
+inline int f8285_12(int x) { return x * 12; }
+inline int f8285_13(int x) { return x * 13; }
+inline int f8285_14(int x) { return x * 14; }
+inline int f8285_15(int x) { return x * 15; }
+inline int f8285_16(int x) { return x * 16; }
+inline int f8285_17(int x) { return x * 17; }
+inline int f8285_18(int x) { return x * 18; }
+inline int f8285_19(int x) { return x * 19; }
+inline int f8285_20(int x) { return x * 20; }
+inline int f8285_21(int x) { return x * 21; }
+inline int f8285_22(int x) { return x * 22; }
+inline int f8285_23(int x) { return x * 23; }
+inline int f8285_24(int x) { return x * 24; }
+inline int f8285_25(int x) { return x * 25; }
+inline int f8285_26(int x) { return x * 26; }
+inline int f8285_27(int x) { return x * 27; }
+inline int f8285_28(int x) { return x * 28; }
+inline int f8285_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8289 */
+#include <vector>
+#include "h7241.h"
+#include "h7923.h"
+#include "h2518.h"
+#include "h6688.h"
+#include "h4628.h"
+#ifdef X
+#include "h3986.h"
+#endif
+struct S8289 { int a; const char *s = "x//y"; };
+inline int f8289_0(int x) { return x * 0; }
+inline int f8289_1(int x) { return x * 1; }
+inline int f8289_2(int x) { return x * 2; }
+inline int f8289_3(int x) { return x * 3; }
+inline int f8289_4(int x) { return x * 4; }
+inline int f8289_5(int x) { return x * 5; }
+inline int f8289_6(int x) { return x * 6; }
+inline int f8289_7(int x) { return x * 7; }
+inline int f8289_8(int x) { return x * 8; }
+inline int f8289_9(int x) { return x * 9; }
+inline int f8289_10(int x) { return x * 10; }
+inline int f8289_11(int x) { return x * 11; }
+inline int f8289_12(int x) { return x * 12; }
+inline int f8289_13(int x) { return x * 13; }
+inline int f8289_14(int x) { return x * 14; }
+inline int f8289_15(int x) { return x * 15; }
+inline int f8289_16(int x) { return x * 16; }
+inline int f8289_17(int x) { return x * 17; }
+inline int f8289_18(int x) { return x * 18; }
+inline int f8289_19(int x) { return x * 19; }
+inline int f8289_20(int x) { return x * 20; }
+inline int f8289_21(int x) { return x * 21; }
+inline int f8289_22(int x) { return x * 22; }
+inline int f8289_23(int x) { return x * 23; }
+inline int f8289_24(int x) { return x * 24; }
+inline int f8289_25(int x) { return x * 25; }
+inline int f8289_26(int x) { return x * 26; }
+inline int f8289_27(int x) { return x * 27; }
+inline int f8289_28(int x) { return x * 28; }
+inline int f8289_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 829 */
+#include <vector>
+#include "h1125.h"
+#include "h5510.h"
+#include "h1557.h"
+#include "h6569.h"
+#include "h9190.h"
+#ifdef X
+#include "h4226.h"
+#endif
+struct S829 { int a; const char *s = "x//y"; };
+inline int f829_0(int x) { return x * 0; }
+inline int f829_1(int x) { return x * 1; }
+inline int f829_2(int x) { return x * 2; }
+inline int f829_3(int x) { return x * 3; }
+inline int f829_4(int x) { return x * 4; }
+inline int f829_5(int x) { return x * 5; }
+inline int f829_6(int x) { return x * 6; }
+inline int f829_7(int x) { return x * 7; }
+inline int f829_8(int x) { return x * 8; }
+inline int f829_9(int x) { return x * 9; }
+inline int f829_10(int x) { return x * 10; }
+inline int f829_11(int x) { return x * 11; }
+inline int f829_12(int x) { return x * 12; }
+inline int f829_13(int x) { return x * 13; }
+inline int f829_14(int x) { return x * 14; }
+inline int f829_15(int x) { return x * 15; }
+inline int f829_16(int x) { return x * 16; }
+inline int f829_17(int x) { return x * 17; }
+inline int f829_18(int x) { return x * 18; }
+inline int f829_19(int x) { return x * 19; }
+inline int f829_20(int x) { return x * 20; }
+inline int f829_21(int x) { return x * 21; }
+inline int f829_22(int x) { return x * 22; }
+inline int f829_23(int x) { return x * 23; }
+inline int f829_24(int x) { return x * 24; }
+inline int f829_25(int x) { return x * 25; }
+inline int f829_26(int x) { return x * 26; }
+inline int f829_27(int x) { return x * 27; }
+inline int f829_28(int x) { return x * 28; }
+inline int f829_29(int x) { return x * 29; }
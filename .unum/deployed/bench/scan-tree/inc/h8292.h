@@ -0,0 +1,42 @@
+#pragma once
+/* header 8292 */
+#include <vector>
+#include "h7102.h"
+#include "h4039.h"
+#include "h7202.h"
+#include "h2823.h"
+#include "h4641.h"
+#ifdef X
+#include "h6085.h"
+#endif
+struct S8292 { int a; const char *s = "x//y"; };
+inline int f8292_0(int x) { return x * 0; }
+inline int f8292_1(int x) { return x * 1; }
+inline int f8292_2(int x) { return x * 2; }
+inline int f8292_3(int x) { return x * 3; }
+inline int f8292_4(int x) { return x * 4; }
+inline int f8292_5(int x) { return x * 5; }
+inline int f8292_6(int x) { return x * 6; }
+inline int f8292_7(int x) { return x * 7; }
+inline int f8292_8(int x) { return x * 8; }
+inline int f8292_9(int x) { return x * 9; }
+inline int f8292_10(int x) { return x * 10; }
+inline int f8292_11(int x) { return x * 11; }
+inline int f8292_12(int x) { return x * 12; }
+inline int f8292_13(int x) { return x * 13; }
+inline int f8292_14(int x) { return x * 14; }
+inline int f8292_15(int x) { return x * 15; }
+inline int f8292_16(int x) { return x * 16; }
+inline int f8292_17(int x) { return x * 17; }
+inline int f8292_18(int x) { return x * 18; }
+inline int f8292_19(int x) { return x * 19; }
+inline int f8292_20(int x) { return x * 20; }
+inline int f8292_21(int x) { return x * 21; }
+inline int f8292_22(int x) { return x * 22; }
+inline int f8292_23(int x) { return x * 23; }
+inline int f8292_24(int x) { return x * 24; }
+inline int f8292_25(int x) { return x * 25; }
+inline int f8292_26(int x) { return x * 26; }
+inline int f8292_27(int x) { return x * 27; }
+inline int f8292_28(int x) { return x * 28; }
+inline int f8292_29(int x) { return x * 29; }
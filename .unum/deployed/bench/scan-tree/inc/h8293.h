@@ -0,0 +1,42 @@
+#pragma once
+/* header 8293 */
+#include <vector>
+#include "h6359.h"
+#include "h1446.h"
+#include "h1968.h"
+#include "h9692.h"
+#include "h5233.h"
+#ifdef X
+#include "h4109.h"
+#endif
+struct S8293 { int a; const char *s = "x//y"; };
+inline int f8293_0(int x) { return x * 0; }
+inline int f8293_1(int x) { return x * 1; }
+inline int f8293_2(int x) { return x * 2; }
+inline int f8293_3(int x) { return x * 3; }
+inline int f8293_4(int x) { return x * 4; }
+inline int f8293_5(int x) { return x * 5; }
+inline int f8293_6(int x) { return x * 6; }
+inline int f8293_7(int x) { return x * 7; }
+inline int f8293_8(int x) { return x * 8; }
+inline int f8293_9(int x) { return x * 9; }
+inline int f8293_10(int x) { return x * 10; }
+inline int f8293_11(int x) { return x * 11; }
+inline int f8293_12(int x) { return x * 12; }
+inline int f8293_13(int x) { return x * 13; }
+inline int f8293_14(int x) { return x * 14; }
+inline int f8293_15(int x) { return x * 15; }
+inline int f8293_16(int x) { return x * 16; }
+inline int f8293_17(int x) { return x * 17; }
+inline int f8293_18(int x) { return x * 18; }
+inline int f8293_19(int x) { return x * 19; }
+inline int f8293_20(int x) { return x * 20; }
+inline int f8293_21(int x) { return x * 21; }
+inline int f8293_22(int x) { return x * 22; }
+inline int f8293_23(int x) { return x * 23; }
+inline int f8293_24(int x) { return x * 24; }
+inline int f8293_25(int x) { return x * 25; }
+inline int f8293_26(int x) { return x * 26; }
+inline int f8293_27(int x) { return x * 27; }
+inline int f8293_28(int x) { return x * 28; }
+inline int f8293_29(int x) { return x * 29; }
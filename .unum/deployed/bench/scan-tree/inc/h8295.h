@@ -0,0 +1,42 @@
+#pragma once
+/* header 8295 */
+#include <vector>
+#include "h6585.h"
+#include "h3550.h"
+#include "h4459.h"
+#include "h9306.h"
+#include "h3808.h"
+#ifdef X
+#include "h7286.h"
+#endif
+struct S8295 { int a; const char *s = "x//y"; };
+inline int f8295_0(int x) { return x * 0; }
+inline int f8295_1(int x) { return x * 1; }
+inline int f8295_2(int x) { return x * 2; }
+inline int f8295_3(int x) { return x * 3; }
+inline int f8295_4(int x) { return x * 4; }
+inline int f8295_5(int x) { return x * 5; }
+inline int f8295_6(int x) { return x * 6; }
+inline int f8295_7(int x) { return x * 7; }
+inline int f8295_8(int x) { return x * 8; }
+inline int f8295_9(int x) { return x * 9; }
+inline int f8295_10(int x) { return x * 10; }
+inline int f8295_11(int x) { return x * 11; }
+inline int f8295_12(int x) { return x * 12; }
+inline int f8295_13(int x) { return x * 13; }
+inline int f8295_14(int x) { return x * 14; }
+inline int f8295_15(int x) { return x * 15; }
+inline int f8295_16(int x) { return x * 16; }
+inline int f8295_17(int x) { return x * 17; }
+inline int f8295_18(int x) { return x * 18; }
+inline int f8295_19(int x) { return x * 19; }
+inline int f8295_20(int x) { return x * 20; }
+inline int f8295_21(int x) { return x * 21; }
+inline int f8295_22(int x) { return x * 22; }
+inline int f8295_23(int x) { return x * 23; }
+inline int f8295_24(int x) { return x * 24; }
+inline int f8295_25(int x) { return x * 25; }
+inline int f8295_26(int x) { return x * 26; }
+inline int f8295_27(int x) { return x * 27; }
+inline int f8295_28(int x) { return x * 28; }
+inline int f8295_29(int x) { return x * 29; }
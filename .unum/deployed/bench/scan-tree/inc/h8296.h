@@ -0,0 +1,42 @@
+#pragma once
+/* header 8296 */
+#include <vector>
+#include "h8231.h"
+#include "h6825.h"
+#include "h1711.h"
+#include "h9725.h"
+#include "h9369.h"
+#ifdef X
+#include "h8251.h"
+#endif
+struct S8296 { int a; const char *s = "x//y"; };
+inline int f8296_0(int x) { return x * 0; }
+inline int f8296_1(int x) { return x * 1; }
+inline int f8296_2(int x) { return x * 2; }
+inline int f8296_3(int x) { return x * 3; }
+inline int f8296_4(int x) { return x * 4; }
+inline int f8296_5(int x) { return x * 5; }
+inline int f8296_6(int x) { return x * 6; }
+inline int f8296_7(int x) { return x * 7; }
+inline int f8296_8(int x) { return x * 8; }
+inline int f8296_9(int x) { return x * 9; }
+inline int f8296_10(int x) { return x * 10; }
+inline int f8296_11(int x) { return x * 11; }
+inline int f8296_12(int x) { return x * 12; }
+inline int f8296_13(int x) { return x * 13; }
+inline int f8296_14(int x) { return x * 14; }
+inline int f8296_15(int x) { return x * 15; }
+inline int f8296_16(int x) { return x * 16; }
+inline int f8296_17(int x) { return x * 17; }
+inline int f8296_18(int x) { return x * 18; }
+inline int f8296_19(int x) { return x * 19; }
+inline int f8296_20(int x) { return x * 20; }
+inline int f8296_21(int x) { return x * 21; }
+inline int f8296_22(int x) { return x * 22; }
+inline int f8296_23(int x) { return x * 23; }
+inline int f8296_24(int x) { return x * 24; }
+inline int f8296_25(int x) { return x * 25; }
+inline int f8296_26(int x) { return x * 26; }
+inline int f8296_27(int x) { return x * 27; }
+inline int f8296_28(int x) { return x * 28; }
+inline int f8296_29(int x) { return x * 29; }
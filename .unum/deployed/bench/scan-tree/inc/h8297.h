@@ -0,0 +1,42 @@
+#pragma once
+/* header 8297 */
+#include <vector>
+#include "h3913.h"
+#include "h7256.h"
+#include "h6093.h"
+#include "h4093.h"
+#include "h3127.h"
+#ifdef X
+#include "h8098.h"
+#endif
+struct S8297 { int a; const char *s = "x//y"; };
+inline int f8297_0(int x) { return x * 0; }
+inline int f8297_1(int x) { return x * 1; }
+inline int f8297_2(int x) { return x * 2; }
+inline int f8297_3(int x) { return x * 3; }
+inline int f8297_4(int x) { return x * 4; }
+inline int f8297_5(int x) { return x * 5; }
+inline int f8297_6(int x) { return x * 6; }
+inline int f8297_7(int x) { return x * 7; }
+inline int f8297_8(int x) { return x * 8; }
+inline int f8297_9(int x) { return x * 9; }
+inline int f8297_10(int x) { return x * 10; }
+inline int f8297_11(int x) { return x * 11; }
+inline int f8297_12(int x) { return x * 12; }
+inline int f8297_13(int x) { return x * 13; }
+inline int f8297_14(int x) { return x * 14; }
+inline int f8297_15(int x) { return x * 15; }
+inline int f8297_16(int x) { return x * 16; }
+inline int f8297_17(int x) { return x * 17; }
+inline int f8297_18(int x) { return x * 18; }
+inline int f8297_19(int x) { return x * 19; }
+inline int f8297_20(int x) { return x * 20; }
+inline int f8297_21(int x) { return x * 21; }
+inline int f8297_22(int x) { return x * 22; }
+inline int f8297_23(int x) { return x * 23; }
+inline int f8297_24(int x) { return x * 24; }
+inline int f8297_25(int x) { return x * 25; }
+inline int f8297_26(int x) { return x * 26; }
+inline int f8297_27(int x) { return x * 27; }
+inline int f8297_28(int x) { return x * 28; }
+inline int f8297_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 83 */
+#include <vector>
+#include "h8844.h"
+#include "h4582.h"
+#include "h7482.h"
+#include "h1855.h"
+#include "h7206.h"
+#ifdef X
+#include "h4275.h"
+#endif
+struct S83 { int a; const char *s = "x//y"; };
+inline int f83_0(int x) { return x * 0; }
+inline int f83_1(int x) { return x * 1; }
+inline int f83_2(int x) { return x * 2; }
+inline int f83_3(int x) { return x * 3; }
+inline int f83_4(int x) { return x * 4; }
+inline int f83_5(int x) { return x * 5; }
+inline int f83_6(int x) { return x * 6; }
+inline int f83_7(int x) { return x * 7; }
+inline int f83_8(int x) { return x * 8; }
+inline int f83_9(int x) { return x * 9; }
+inline int f83_10(int x) { return x * 10; }
+inline int f83_11(int x) { return x * 11; }
+inline int f83_12(int x) { return x * 12; }
+inline int f83_13(int x) { return x * 13; }
+inline int f83_14(int x) { return x * 14; }
+inline int f83_15(int x) { return x * 15; }
+inline int f83_16(int x) { return x * 16; }
+inline int f83_17(int x) { return x * 17; }
+inline int f83_18(int x) { return x * 18; }
+inline int f83_19(int x) { return x * 19; }
+inline int f83_20(int x) { return x * 20; }
+inline int f83_21(int x) { return x * 21; }
+inline int f83_22(int x) { return x * 22; }
+inline int f83_23(int x) { return x * 23; }
+inline int f83_24(int x) { return x * 24; }
+inline int f83_25(int x) { return x * 25; }
+inline int f83_26(int x) { return x * 26; }
+inline int f83_27(int x) { return x * 27; }
+inline int f83_28(int x) { return x * 28; }
+inline int f83_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8302 */
+#include <vector>
+#include "h7799.h"
+#include "h4690.h"
+#include "h7318.h"
+#include "h9530.h"
+#include "h2424.h"
+#ifdef X
+#include "h4628.h"
+#endif
+struct S8302 { int a; const char *s = "x//y"; };
+inline int f8302_0(int x) { return x * 0; }
+inline int f8302_1(int x) { return x * 1; }
+inline int f8302_2(int x) { return x * 2; }
+inline int f8302_3(int x) { return x * 3; }
+inline int f8302_4(int x) { return x * 4; }
+inline int f8302_5(int x) { return x * 5; }
+inline int f8302_6(int x) { return x * 6; }
+inline int f8302_7(int x) { return x * 7; }
+inline int f8302_8(int x) { return x * 8; }
+inline int f8302_9(int x) { return x * 9; }
+inline int f8302_10(int x) { return x * 10; }
+inline int f8302_11(int x) { return x * 11; }
+inline int f8302_12(int x) { return x * 12; }
+inline int f8302_13(int x) { return x * 13; }
+inline int f8302_14(int x) { return x * 14; }
+inline int f8302_15(int x) { return x * 15; }
+inline int f8302_16(int x) { return x * 16; }
+inline int f8302_17(int x) { return x * 17; }
+inline int f8302_18(int x) { return x * 18; }
+inline int f8302_19(int x) { return x * 19; }
+inline int f8302_20(int x) { return x * 20; }
+inline int f8302_21(int x) { return x * 21; }
+inline int f8302_22(int x) { return x * 22; }
+inline int f8302_23(int x) { return x * 23; }
+inline int f8302_24(int x) { return x * 24; }
+inline int f8302_25(int x) { return x * 25; }
+inline int f8302_26(int x) { return x * 26; }
+inline int f8302_27(int x) { return x * 27; }
+inline int f8302_28(int x) { return x * 28; }
+inline int f8302_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8303 */
+#include <vector>
+#include "h9114.h"
+#include "h9409.h"
+#include "h1105.h"
+#include "h4097.h"
+#include "h2278.h"
+#ifdef X
+#include "h8781.h"
+#endif
+struct S8303 { int a; const char *s = "x//y"; };
+inline int f8303_0(int x) { return x * 0; }
+inline int f8303_1(int x) { return x * 1; }
+inline int f8303_2(int x) { return x * 2; }
+inline int f8303_3(int x) { return x * 3; }
+inline int f8303_4(int x) { return x * 4; }
+inline int f8303_5(int x) { return x * 5; }
+inline int f8303_6(int x) { return x * 6; }
+inline int f8303_7(int x) { return x * 7; }
+inline int f8303_8(int x) { return x * 8; }
+inline int f8303_9(int x) { return x * 9; }
+inline int f8303_10(int x) { return x * 10; }
+inline int f8303_11(int x) { return x * 11; }
+inline int f8303_12(int x) { return x * 12; }
+inline int f8303_13(int x) { return x * 13; }
+inline int f8303_14(int x) { return x * 14; }
+inline int f8303_15(int x) { return x * 15; }
+inline int f8303_16(int x) { return x * 16; }
+inline int f8303_17(int x) { return x * 17; }
+inline int f8303_18(int x) { return x * 18; }
+inline int f8303_19(int x) { return x * 19; }
+inline int f8303_20(int x) { return x * 20; }
+inline int f8303_21(int x) { return x * 21; }
+inline int f8303_22(int x) { return x * 22; }
+inline int f8303_23(int x) { return x * 23; }
+inline int f8303_24(int x) { return x * 24; }
+inline int f8303_25(int x) { return x * 25; }
+inline int f8303_26(int x) { return x * 26; }
+inline int f8303_27(int x) { return x * 27; }
+inline int f8303_28(int x) { return x * 28; }
+inline int f8303_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8304 */
+#include <vector>
+#include "h7986.h"
+#include "h6277.h"
+#include "h5854.h"
+#include "h7867.h"
+#include "h7671.h"
+#ifdef X
+#include "h4904.h"
+#endif
+struct S8304 { int a; const char *s = "x//y"; };
+inline int f8304_0(int x) { return x * 0; }
+inline int f8304_1(int x) { return x * 1; }
+inline int f8304_2(int x) { return x * 2; }
+inline int f8304_3(int x) { return x * 3; }
+inline int f8304_4(int x) { return x * 4; }
+inline int f8304_5(int x) { return x * 5; }
+inline int f8304_6(int x) { return x * 6; }
+inline int f8304_7(int x) { return x * 7; }
+inline int f8304_8(int x) { return x * 8; }
+inline int f8304_9(int x) { return x * 9; }
+inline int f8304_10(int x) { return x * 10; }
+inline int f8304_11(int x) { return x * 11; }
+inline int f8304_12(int x) { return x * 12; }
+inline int f8304_13(int x) { return x * 13; }
+inline int f8304_14(int x) { return x * 14; }
+inline int f8304_15(int x) { return x * 15; }
+inline int f8304_16(int x) { return x * 16; }
+inline int f8304_17(int x) { return x * 17; }
+inline int f8304_18(int x) { return x * 18; }
+inline int f8304_19(int x) { return x * 19; }
+inline int f8304_20(int x) { return x * 20; }
+inline int f8304_21(int x) { return x * 21; }
+inline int f8304_22(int x) { return x * 22; }
+inline int f8304_23(int x) { return x * 23; }
+inline int f8304_24(int x) { return x * 24; }
+inline int f8304_25(int x) { return x * 25; }
+inline int f8304_26(int x) { return x * 26; }
+inline int f8304_27(int x) { return x * 27; }
+inline int f8304_28(int x) { return x * 28; }
+inline int f8304_29(int x) { return x * 29; }
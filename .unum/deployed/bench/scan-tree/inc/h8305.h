@@ -0,0 +1,42 @@
+#pragma once
+/* header 8305 */
+#include <vector>
+#include "h9543.h"
+#include "h8768.h"
+#include "h1191.h"
+#include "h1845.h"
+#include "h7306.h"
+#ifdef X
+#include "h2001.h"
+#endif
+struct S8305 { int a; const char *s = "x//y"; };
+inline int f8305_0(int x) { return x * 0; }
+inline int f8305_1(int x) { return x * 1; }
+inline int f8305_2(int x) { return x * 2; }
+inline int f8305_3(int x) { return x * 3; }
+inline int f8305_4(int x) { return x * 4; }
+inline int f8305_5(int x) { return x * 5; }
+inline int f8305_6(int x) { return x * 6; }
+inline int f8305_7(int x) { return x * 7; }
+inline int f8305_8(int x) { return x * 8; }
+inline int f8305_9(int x) { return x * 9; }
+inline int f8305_10(int x) { return x * 10; }
+inline int f8305_11(int x) { return x * 11; }
+inline int f8305_12(int x) { return x * 12; }
+inline int f8305_13(int x) { return x * 13; }
+inline int f8305_14(int x) { return x * 14; }
+inline int f8305_15(int x) { return x * 15; }
+inline int f8305_16(int x) { return x * 16; }
+inline int f8305_17(int x) { return x * 17; }
+inline int f8305_18(int x) { return x * 18; }
+inline int f8305_19(int x) { return x * 19; }
+inline int f8305_20(int x) { return x * 20; }
+inline int f8305_21(int x) { return x * 21; }
+inline int f8305_22(int x) { return x * 22; }
+inline int f8305_23(int x) { return x * 23; }
+inline int f8305_24(int x) { return x * 24; }
+inline int f8305_25(int x) { return x * 25; }
+inline int f8305_26(int x) { return x * 26; }
+inline int f8305_27(int x) { return x * 27; }
+inline int f8305_28(int x) { return x * 28; }
+inline int f8305_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8308 */
+#include <vector>
+#include "h2398.h"
+#include "h3231.h"
+#include "h233.h"
+#include "h6104.h"
+#include "h6668.h"
+#ifdef X
+#include "h758.h"
+#endif
+struct S8308 { int a; const char *s = "x//y"; };
+inline int f8308_0(int x) { return x * 0; }
+inline int f8308_1(int x) { return x * 1; }
+inline int f8308_2(int x) { return x * 2; }
+inline int f8308_3(int x) { return x * 3; }
+inline int f8308_4(int x) { return x * 4; }
+inline int f8308_5(int x) { return x * 5; }
+inline int f8308_6(int x) { return x * 6; }
+inline int f8308_7(int x) { return x * 7; }
+inline int f8308_8(int x) { return x * 8; }
+inline int f8308_9(int x) { return x * 9; }
+inline int f8308_10(int x) { return x * 10; }
+inline int f8308_11(int x) { return x * 11; }
+inline int f8308_12(int x) { return x * 12; }
+inline int f8308_13(int x) { return x * 13; }
+inline int f8308_14(int x) { return x * 14; }
+inline int f8308_15(int x) { return x * 15; }
+inline int f8308_16(int x) { return x * 16; }
+inline int f8308_17(int x) { return x * 17; }
+inline int f8308_18(int x) { return x * 18; }
+inline int f8308_19(int x) { return x * 19; }
+inline int f8308_20(int x) { return x * 20; }
+inline int f8308_21(int x) { return x * 21; }
+inline int f8308_22(int x) { return x * 22; }
+inline int f8308_23(int x) { return x * 23; }
+inline int f8308_24(int x) { return x * 24; }
+inline int f8308_25(int x) { return x * 25; }
+inline int f8308_26(int x) { return x * 26; }
+inline int f8308_27(int x) { return x * 27; }
+inline int f8308_28(int x) { return x * 28; }
+inline int f8308_29(int x) { return x * 29; }
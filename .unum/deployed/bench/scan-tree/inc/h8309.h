@@ -0,0 +1,42 @@
+#pragma once
+/* header 8309 */
+#include <vector>
+#include "h4768.h"
+#include "h5591.h"
+#include "h5211.h"
+#include "h148.h"
+#include "h6978.h"
+#ifdef X
+#include "h3739.h"
+#endif
+struct S8309 { int a; const char *s = "x//y"; };
+inline int f8309_0(int x) { return x * 0; }
+inline int f8309_1(int x) { return x * 1; }
+inline int f8309_2(int x) { return x * 2; }
+inline int f8309_3(int x) { return x * 3; }
+inline int f8309_4(int x) { return x * 4; }
+inline int f8309_5(int x) { return x * 5; }
+inline int f8309_6(int x) { return x * 6; }
+inline int f8309_7(int x) { return x * 7; }
+inline int f8309_8(int x) { return x * 8; }
+inline int f8309_9(int x) { return x * 9; }
+inline int f8309_10(int x) { return x * 10; }
+inline int f8309_11(int x) { return x * 11; }
+inline int f8309_12(int x) { return x * 12; }
+inline int f8309_13(int x) { return x * 13; }
+inline int f8309_14(int x) { return x * 14; }
+inline int f8309_15(int x) { return x * 15; }
+inline int f8309_16(int x) { return x * 16; }
+inline int f8309_17(int x) { return x * 17; }
+inline int f8309_18(int x) { return x * 18; }
+inline int f8309_19(int x) { return x * 19; }
+inline int f8309_20(int x) { return x * 20; }
+inline int f8309_21(int x) { return x * 21; }
+inline int f8309_22(int x) { return x * 22; }
+inline int f8309_23(int x) { return x * 23; }
+inline int f8309_24(int x) { return x * 24; }
+inline int f8309_25(int x) { return x * 25; }
+inline int f8309_26(int x) { return x * 26; }
+inline int f8309_27(int x) { return x * 27; }
+inline int f8309_28(int x) { return x * 28; }
+inline int f8309_29(int x) { return x * 29; }
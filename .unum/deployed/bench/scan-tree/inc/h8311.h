@@ -0,0 +1,42 @@
+#pragma once
+/* header 8311 */
+#include <vector>
+#include "h8957.h"
+#include "h4875.h"
+#include "h9307.h"
+#include "h8991.h"
+#include "h2972.h"
+#ifdef X
+#include "h3264.h"
+#endif
+struct S8311 { int a; const char *s = "x//y"; };
+inline int f8311_0(int x) { return x * 0; }
+inline int f8311_1(int x) { return x * 1; }
+inline int f8311_2(int x) { return x * 2; }
+inline int f8311_3(int x) { return x * 3; }
+inline int f8311_4(int x) { return x * 4; }
+inline int f8311_5(int x) { return x * 5; }
+inline int f8311_6(int x) { return x * 6; }
+inline int f8311_7(int x) { return x * 7; }
+inline int f8311_8(int x) { return x * 8; }
+inline int f8311_9(int x) { return x * 9; }
+inline int f8311_10(int x) { return x * 10; }
+inline int f8311_11(int x) { return x * 11; }
+inline int f8311_12(int x) { return x * 12; }
+inline int f8311_13(int x) { return x * 13; }
+inline int f8311_14(int x) { return x * 14; }
+inline int f8311_15(int x) { return x * 15; }
+inline int f8311_16(int x) { return x * 16; }
+inline int f8311_17(int x) { return x * 17; }
+inline int f8311_18(int x) { return x * 18; }
+inline int f8311_19(int x) { return x * 19; }
+inline int f8311_20(int x) { return x * 20; }
+inline int f8311_21(int x) { return x * 21; }
+inline int f8311_22(int x) { return x * 22; }
+inline int f8311_23(int x) { return x * 23; }
+inline int f8311_24(int x) { return x * 24; }
+inline int f8311_25(int x) { return x * 25; }
+inline int f8311_26(int x) { return x * 26; }
+inline int f8311_27(int x) { return x * 27; }
+inline int f8311_28(int x) { return x * 28; }
+inline int f8311_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8313 */
+#include <vector>
+#include "h6276.h"
+#include "h5505.h"
+#include "h3589.h"
+#include "h1616.h"
+#include "h677.h"
+#ifdef X
+#include "h4756.h"
+#endif
+struct S8313 { int a; const char *s = "x//y"; };
+inline int f8313_0(int x) { return x * 0; }
+inline int f8313_1(int x) { return x * 1; }
+inline int f8313_2(int x) { return x * 2; }
+inline int f8313_3(int x) { return x * 3; }
+inline int f8313_4(int x) { return x * 4; }
+inline int f8313_5(int x) { return x * 5; }
+inline int f8313_6(int x) { return x * 6; }
+inline int f8313_7(int x) { return x * 7; }
+inline int f8313_8(int x) { return x * 8; }
+inline int f8313_9(int x) { return x * 9; }
+inline int f8313_10(int x) { return x * 10; }
+inline int f8313_11(int x) { return x * 11; }
+inline int f8313_12(int x) { return x * 12; }
+inline int f8313_13(int x) { return x * 13; }
+inline int f8313_14(int x) { return x * 14; }
+inline int f8313_15(int x) { return x * 15; }
+inline int f8313_16(int x) { return x * 16; }
+inline int f8313_17(int x) { return x * 17; }
+inline int f8313_18(int x) { return x * 18; }
+inline int f8313_19(int x) { return x * 19; }
+inline int f8313_20(int x) { return x * 20; }
+inline int f8313_21(int x) { return x * 21; }
+inline int f8313_22(int x) { return x * 22; }
+inline int f8313_23(int x) { return x * 23; }
+inline int f8313_24(int x) { return x * 24; }
+inline int f8313_25(int x) { return x * 25; }
+inline int f8313_26(int x) { return x * 26; }
+inline int f8313_27(int x) { return x * 27; }
+inline int f8313_28(int x) { return x * 28; }
+inline int f8313_29(int x) { return x * 29; }
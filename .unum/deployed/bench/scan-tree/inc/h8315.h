@@ -0,0 +1,42 @@
+#pragma once
+/* header 8315 */
+#include <vector>
+#include "h2220.h"
+#include "h808.h"
+#include "h1451.h"
+#include "h9604.h"
+#include "h1607.h"
+#ifdef X
+#include "h5357.h"
+#endif
+struct S8315 { int a; const char *s = "x//y"; };
+inline int f8315_0(int x) { return x * 0; }
+inline int f8315_1(int x) { return x * 1; }
+inline int f8315_2(int x) { return x * 2; }
+inline int f8315_3(int x) { return x * 3; }
+inline int f8315_4(int x) { return x * 4; }
+inline int f8315_5(int x) { return x * 5; }
+inline int f8315_6(int x) { return x * 6; }
+inline int f8315_7(int x) { return x * 7; }
+inline int f8315_8(int x) { return x * 8; }
+inline int f8315_9(int x) { return x * 9; }
+inline int f8315_10(int x) { return x * 10; }
+inline int f8315_11(int x) { return x * 11; }
+inline int f8315_12(int x) { return x * 12; }
+inline int f8315_13(int x) { return x * 13; }
+inline int f8315_14(int x) { return x * 14; }
+inline int f8315_15(int x) { return x * 15; }
+inline int f8315_16(int x) { return x * 16; }
+inline int f8315_17(int x) { return x * 17; }
+inline int f8315_18(int x) { return x * 18; }
+inline int f8315_19(int x) { return x * 19; }
+inline int f8315_20(int x) { return x * 20; }
+inline int f8315_21(int x) { return x * 21; }
+inline int f8315_22(int x) { return x * 22; }
+inline int f8315_23(int x) { return x * 23; }
+inline int f8315_24(int x) { return x * 24; }
+inline int f8315_25(int x) { return x * 25; }
+inline int f8315_26(int x) { return x * 26; }
+inline int f8315_27(int x) { return x * 27; }
+inline int f8315_28(int x) { return x * 28; }
+inline int f8315_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8316 */
+#include <vector>
+#include "h4606.h"
+#include "h312.h"
+#include "h5776.h"
+#include "h9538.h"
+#include "h8297.h"
+#ifdef X
+#include "h8665.h"
+#endif
+struct S8316 { int a; const char *s = "x//y"; };
+inline int f8316_0(int x) { return x * 0; }
+inline int f8316_1(int x) { return x * 1; }
+inline int f8316_2(int x) { return x * 2; }
+inline int f8316_3(int x) { return x * 3; }
+inline int f8316_4(int x) { return x * 4; }
+inline int f8316_5(int x) { return x * 5; }
+inline int f8316_6(int x) { return x * 6; }
+inline int f8316_7(int x) { return x * 7; }
+inline int f8316_8(int x) { return x * 8; }
+inline int f8316_9(int x) { return x * 9; }
+inline int f8316_10(int x) { return x * 10; }
+inline int f8316_11(int x) { return x * 11; }
+inline int f8316_12(int x) { return x * 12; }
+inline int f8316_13(int x) { return x * 13; }
+inline int f8316_14(int x) { return x * 14; }
+inline int f8316_15(int x) { return x * 15; }
+inline int f8316_16(int x) { return x * 16; }
+inline int f8316_17(int x) { return x * 17; }
+inline int f8316_18(int x) { return x * 18; }
+inline int f8316_19(int x) { return x * 19; }
+inline int f8316_20(int x) { return x * 20; }
+inline int f8316_21(int x) { return x * 21; }
+inline int f8316_22(int x) { return x * 22; }
+inline int f8316_23(int x) { return x * 23; }
+inline int f8316_24(int x) { return x * 24; }
+inline int f8316_25(int x) { return x * 25; }
+inline int f8316_26(int x) { return x * 26; }
+inline int f8316_27(int x) { return x * 27; }
+inline int f8316_28(int x) { return x * 28; }
+inline int f8316_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8318 */
+#include <vector>
+#include "h9745.h"
+#include "h7687.h"
+#include "h8644.h"
+#include "h7891.h"
+#include "h3788.h"
+#ifdef X
+#include "h8487.h"
+#endif
+struct S8318 { int a; const char *s = "x//y"; };
+inline int f8318_0(int x) { return x * 0; }
+inline int f8318_1(int x) { return x * 1; }
+inline int f8318_2(int x) { return x * 2; }
+inline int f8318_3(int x) { return x * 3; }
+inline int f8318_4(int x) { return x * 4; }
+inline int f8318_5(int x) { return x * 5; }
+inline int f8318_6(int x) { return x * 6; }
+inline int f8318_7(int x) { return x * 7; }
+inline int f8318_8(int x) { return x * 8; }
+inline int f8318_9(int x) { return x * 9; }
+inline int f8318_10(int x) { return x * 10; }
+inline int f8318_11(int x) { return x * 11; }
+inline int f8318_12(int x) { return x * 12; }
+inline int f8318_13(int x) { return x * 13; }
+inline int f8318_14(int x) { return x * 14; }
+inline int f8318_15(int x) { return x * 15; }
+inline int f8318_16(int x) { return x * 16; }
+inline int f8318_17(int x) { return x * 17; }
+inline int f8318_18(int x) { return x * 18; }
+inline int f8318_19(int x) { return x * 19; }
+inline int f8318_20(int x) { return x * 20; }
+inline int f8318_21(int x) { return x * 21; }
+inline int f8318_22(int x) { return x * 22; }
+inline int f8318_23(int x) { return x * 23; }
+inline int f8318_24(int x) { return x * 24; }
+inline int f8318_25(int x) { return x * 25; }
+inline int f8318_26(int x) { return x * 26; }
+inline int f8318_27(int x) { return x * 27; }
+inline int f8318_28(int x) { return x * 28; }
+inline int f8318_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8319 */
+#include <vector>
+#include "h3109.h"
+#include "h1782.h"
+#include "h9072.h"
+#include "h6261.h"
+#include "h4212.h"
+#ifdef X
+#include "h409.h"
+#endif
+struct S8319 { int a; const char *s = "x//y"; };
+inline int f8319_0(int x) { return x * 0; }
+inline int f8319_1(int x) { return x * 1; }
+inline int f8319_2(int x) { return x * 2; }
+inline int f8319_3(int x) { return x * 3; }
+inline int f8319_4(int x) { return x * 4; }
+inline int f8319_5(int x) { return x * 5; }
+inline int f8319_6(int x) { return x * 6; }
+inline int f8319_7(int x) { return x * 7; }
+inline int f8319_8(int x) { return x * 8; }
+inline int f8319_9(int x) { return x * 9; }
+inline int f8319_10(int x) { return x * 10; }
+inline int f8319_11(int x) { return x * 11; }
+inline int f8319_12(int x) { return x * 12; }
+inline int f8319_13(int x) { return x * 13; }
+inline int f8319_14(int x) { return x * 14; }
+inline int f8319_15(int x) { return x * 15; }
+inline int f8319_16(int x) { return x * 16; }
+inline int f8319_17(int x) { return x * 17; }
+inline int f8319_18(int x) { return x * 18; }
+inline int f8319_19(int x) { return x * 19; }
+inline int f8319_20(int x) { return x * 20; }
+inline int f8319_21(int x) { return x * 21; }
+inline int f8319_22(int x) { return x * 22; }
+inline int f8319_23(int x) { return x * 23; }
+inline int f8319_24(int x) { return x * 24; }
+inline int f8319_25(int x) { return x * 25; }
+inline int f8319_26(int x) { return x * 26; }
+inline int f8319_27(int x) { return x * 27; }
+inline int f8319_28(int x) { return x * 28; }
+inline int f8319_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 832 */
+#include <vector>
+#include "h983.h"
+#include "h9586.h"
+#include "h9440.h"
+#include "h6994.h"
+#include "h444.h"
+#ifdef X
+#include "h5485.h"
+#endif
+struct S832 { int a; const char *s = "x//y"; };
+inline int f832_0(int x) { return x * 0; }
+inline int f832_1(int x) { return x * 1; }
+inline int f832_2(int x) { return x * 2; }
+inline int f832_3(int x) { return x * 3; }
+inline int f832_4(int x) { return x * 4; }
+inline int f832_5(int x) { return x * 5; }
+inline int f832_6(int x) { return x * 6; }
+inline int f832_7(int x) { return x * 7; }
+inline int f832_8(int x) { return x * 8; }
+inline int f832_9(int x) { return x * 9; }
+inline int f832_10(int x) { return x * 10; }
+inline int f832_11(int x) { return x * 11; }
+inline int f832_12(int x) { return x * 12; }
+inline int f832_13(int x) { return x * 13; }
+inline int f832_14(int x) { return x * 14; }
+inline int f832_15(int x) { return x * 15; }
+inline int f832_16(int x) { return x * 16; }
+inline int f832_17(int x) { return x * 17; }
+inline int f832_18(int x) { return x * 18; }
+inline int f832_19(int x) { return x * 19; }
+inline int f832_20(int x) { return x * 20; }
+inline int f832_21(int x) { return x * 21; }
+inline int f832_22(int x) { return x * 22; }
+inline int f832_23(int x) { return x * 23; }
+inline int f832_24(int x) { return x * 24; }
+inline int f832_25(int x) { return x * 25; }
+inline int f832_26(int x) { return x * 26; }
+inline int f832_27(int x) { return x * 27; }
+inline int f832_28(int x) { return x * 28; }
+inline int f832_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8322 */
+#include <vector>
+#include "h6501.h"
+#include "h6460.h"
+#include "h6046.h"
+#include "h4896.h"
+#include "h5922.h"
+#ifdef X
+#include "h4754.h"
+#endif
+struct S8322 { int a; const char *s = "x//y"; };
+inline int f8322_0(int x) { return x * 0; }
+inline int f8322_1(int x) { return x * 1; }
+inline int f8322_2(int x) { return x * 2; }
+inline int f8322_3(int x) { return x * 3; }
+inline int f8322_4(int x) { return x * 4; }
+inline int f8322_5(int x) { return x * 5; }
+inline int f8322_6(int x) { return x * 6; }
+inline int f8322_7(int x) { return x * 7; }
+inline int f8322_8(int x) { return x * 8; }
+inline int f8322_9(int x) { return x * 9; }
+inline int f8322_10(int x) { return x * 10; }
+inline int f8322_11(int x) { return x * 11; }
+inline int f8322_12(int x) { return x * 12; }
+inline int f8322_13(int x) { return x * 13; }
+inline int f8322_14(int x) { return x * 14; }
+inline int f8322_15(int x) { return x * 15; }
+inline int f8322_16(int x) { return x * 16; }
+inline int f8322_17(int x) { return x * 17; }
+inline int f8322_18(int x) { return x * 18; }
+inline int f8322_19(int x) { return x * 19; }
+inline int f8322_20(int x) { return x * 20; }
+inline int f8322_21(int x) { return x * 21; }
+inline int f8322_22(int x) { return x * 22; }
+inline int f8322_23(int x) { return x * 23; }
+inline int f8322_24(int x) { return x * 24; }
+inline int f8322_25(int x) { return x * 25; }
+inline int f8322_26(int x) { return x * 26; }
+inline int f8322_27(int x) { return x * 27; }
+inline int f8322_28(int x) { return x * 28; }
+inline int f8322_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8323 */
+#include <vector>
+#include "h3649.h"
+#include "h6073.h"
+#include "h1579.h"
+#include "h1897.h"
+#include "h3529.h"
+#ifdef X
+#include "h5186.h"
+#endif
+struct S8323 { int a; const char *s = "x//y"; };
+inline int f8323_0(int x) { return x * 0; }
+inline int f8323_1(int x) { return x * 1; }
+inline int f8323_2(int x) { return x * 2; }
+inline int f8323_3(int x) { return x * 3; }
+inline int f8323_4(int x) { return x * 4; }
+inline int f8323_5(int x) { return x * 5; }
+inline int f8323_6(int x) { return x * 6; }
+inline int f8323_7(int x) { return x * 7; }
+inline int f8323_8(int x) { return x * 8; }
+inline int f8323_9(int x) { return x * 9; }
+inline int f8323_10(int x) { return x * 10; }
+inline int f8323_11(int x) { return x * 11; }
+inline int f8323_12(int x) { return x * 12; }
+inline int f8323_13(int x) { return x * 13; }
+inline int f8323_14(int x) { return x * 14; }
+inline int f8323_15(int x) { return x * 15; }
+inline int f8323_16(int x) { return x * 16; }
+inline int f8323_17(int x) { return x * 17; }
+inline int f8323_18(int x) { return x * 18; }
+inline int f8323_19(int x) { return x * 19; }
+inline int f8323_20(int x) { return x * 20; }
+inline int f8323_21(int x) { return x * 21; }
+inline int f8323_22(int x) { return x * 22; }
+inline int f8323_23(int x) { return x * 23; }
+inline int f8323_24(int x) { return x * 24; }
+inline int f8323_25(int x) { return x * 25; }
+inline int f8323_26(int x) { return x * 26; }
+inline int f8323_27(int x) { return x * 27; }
+inline int f8323_28(int x) { return x * 28; }
+inline int f8323_29(int x) { return x * 29; }
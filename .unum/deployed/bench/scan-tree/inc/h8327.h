@@ -0,0 +1,42 @@
+#pragma once
+/* header 8327 */
+#include <vector>
+#include "h1387.h"
+#include "h5744.h"
+#include "h1364.h"
+#include "h3458.h"
+#include "h7467.h"
+#ifdef X
+#include "h1632.h"
+#endif
+struct S8327 { int a; const char *s = "x//y"; };
+inline int f8327_0(int x) { return x * 0; }
+inline int f8327_1(int x) { return x * 1; }
+inline int f8327_2(int x) { return x * 2; }
+inline int f8327_3(int x) { return x * 3; }
+inline int f8327_4(int x) { return x * 4; }
+inline int f8327_5(int x) { return x * 5; }
+inline int f8327_6(int x) { return x * 6; }
+inline int f8327_7(int x) { return x * 7; }
+inline int f8327_8(int x) { return x * 8; }
+inline int f8327_9(int x) { return x * 9; }
+inline int f8327_10(int x) { return x * 10; }
+inline int f8327_11(int x) { return x * 11; }
+inline int f8327_12(int x) { return x * 12; }
+inline int f8327_13(int x) { return x * 13; }
+inline int f8327_14(int x) { return x * 14; }
+inline int f8327_15(int x) { return x * 15; }
+inline int f8327_16(int x) { return x * 16; }
+inline int f8327_17(int x) { return x * 17; }
+inline int f8327_18(int x) { return x * 18; }
+inline int f8327_19(int x) { return x * 19; }
+inline int f8327_20(int x) { return x * 20; }
+inline int f8327_21(int x) { return x * 21; }
+inline int f8327_22(int x) { return x * 22; }
+inline int f8327_23(int x) { return x * 23; }
+inline int f8327_24(int x) { return x * 24; }
+inline int f8327_25(int x) { return x * 25; }
+inline int f8327_26(int x) { return x * 26; }
+inline int f8327_27(int x) { return x * 27; }
+inline int f8327_28(int x) { return x * 28; }
+inline int f8327_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8328 */
+#include <vector>
+#include "h8372.h"
+#include "h974.h"
+#include "h2287.h"
+#include "h1734.h"
+#include "h8261.h"
+#ifdef X
+#include "h6470.h"
+#endif
+struct S8328 { int a; const char *s = "x//y"; };
+inline int f8328_0(int x) { return x * 0; }
+inline int f8328_1(int x) { return x * 1; }
+inline int f8328_2(int x) { return x * 2; }
+inline int f8328_3(int x) { return x * 3; }
+inline int f8328_4(int x) { return x * 4; }
+inline int f8328_5(int x) { return x * 5; }
+inline int f8328_6(int x) { return x * 6; }
+inline int f8328_7(int x) { return x * 7; }
+inline int f8328_8(int x) { return x * 8; }
+inline int f8328_9(int x) { return x * 9; }
+inline int f8328_10(int x) { return x * 10; }
+inline int f8328_11(int x) { return x * 11; }
+inline int f8328_12(int x) { return x * 12; }
+inline int f8328_13(int x) { return x * 13; }
+inline int f8328_14(int x) { return x * 14; }
+inline int f8328_15(int x) { return x * 15; }
+inline int f8328_16(int x) { return x * 16; }
+inline int f8328_17(int x) { return x * 17; }
+inline int f8328_18(int x) { return x * 18; }
+inline int f8328_19(int x) { return x * 19; }
+inline int f8328_20(int x) { return x * 20; }
+inline int f8328_21(int x) { return x * 21; }
+inline int f8328_22(int x) { return x * 22; }
+inline int f8328_23(int x) { return x * 23; }
+inline int f8328_24(int x) { return x * 24; }
+inline int f8328_25(int x) { return x * 25; }
+inline int f8328_26(int x) { return x * 26; }
+inline int f8328_27(int x) { return x * 27; }
+inline int f8328_28(int x) { return x * 28; }
+inline int f8328_29(int x) { return x * 29; }
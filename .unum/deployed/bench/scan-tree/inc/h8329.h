@@ -0,0 +1,42 @@
+#pragma once
+/* header 8329 */
+#include <vector>
+#include "h5425.h"
+#include "h8803.h"
+#include "h8365.h"
+#include "h535.h"
+#include "h638.h"
+#ifdef X
+#include "h9410.h"
+#endif
+struct S8329 { int a; const char *s = "x//y"; };
+inline int f8329_0(int x) { return x * 0; }
+inline int f8329_1(int x) { return x * 1; }
+inline int f8329_2(int x) { return x * 2; }
+inline int f8329_3(int x) { return x * 3; }
+inline int f8329_4(int x) { return x * 4; }
+inline int f8329_5(int x) { return x * 5; }
+inline int f8329_6(int x) { return x * 6; }
+inline int f8329_7(int x) { return x * 7; }
+inline int f8329_8(int x) { return x * 8; }
+inline int f8329_9(int x) { return x * 9; }
+inline int f8329_10(int x) { return x * 10; }
+inline int f8329_11(int x) { return x * 11; }
+inline int f8329_12(int x) { return x * 12; }
+inline int f8329_13(int x) { return x * 13; }
+inline int f8329_14(int x) { return x * 14; }
+inline int f8329_15(int x) { return x * 15; }
+inline int f8329_16(int x) { return x * 16; }
+inline int f8329_17(int x) { return x * 17; }
+inline int f8329_18(int x) { return x * 18; }
+inline int f8329_19(int x) { return x * 19; }
+inline int f8329_20(int x) { return x * 20; }
+inline int f8329_21(int x) { return x * 21; }
+inline int f8329_22(int x) { return x * 22; }
+inline int f8329_23(int x) { return x * 23; }
+inline int f8329_24(int x) { return x * 24; }
+inline int f8329_25(int x) { return x * 25; }
+inline int f8329_26(int x) { return x * 26; }
+inline int f8329_27(int x) { return x * 27; }
+inline int f8329_28(int x) { return x * 28; }
+inline int f8329_29(int x) { return x * 29; }
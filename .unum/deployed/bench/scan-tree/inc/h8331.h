@@ -0,0 +1,42 @@
+#pragma once
+/* header 8331 */
+#include <vector>
+#include "h4422.h"
+#include "h6737.h"
+#include "h7206.h"
+#include "h9545.h"
+#include "h2439.h"
+#ifdef X
+#include "h7499.h"
+#endif
+struct S8331 { int a; const char *s = "x//y"; };
+inline int f8331_0(int x) { return x * 0; }
+inline int f8331_1(int x) { return x * 1; }
+inline int f8331_2(int x) { return x * 2; }
+inline int f8331_3(int x) { return x * 3; }
+inline int f8331_4(int x) { return x * 4; }
+inline int f8331_5(int x) { return x * 5; }
+inline int f8331_6(int x) { return x * 6; }
+inline int f8331_7(int x) { return x * 7; }
+inline int f8331_8(int x) { return x * 8; }
+inline int f8331_9(int x) { return x * 9; }
+inline int f8331_10(int x) { return x * 10; }
+inline int f8331_11(int x) { return x * 11; }
+inline int f8331_12(int x) { return x * 12; }
+inline int f8331_13(int x) { return x * 13; }
+inline int f8331_14(int x) { return x * 14; }
+inline int f8331_15(int x) { return x * 15; }
+inline int f8331_16(int x) { return x * 16; }
+inline int f8331_17(int x) { return x * 17; }
+inline int f8331_18(int x) { return x * 18; }
+inline int f8331_19(int x) { return x * 19; }
+inline int f8331_20(int x) { return x * 20; }
+inline int f8331_21(int x) { return x * 21; }
+inline int f8331_22(int x) { return x * 22; }
+inline int f8331_23(int x) { return x * 23; }
+inline int f8331_24(int x) { return x * 24; }
+inline int f8331_25(int x) { return x * 25; }
+inline int f8331_26(int x) { return x * 26; }
+inline int f8331_27(int x) { return x * 27; }
+inline int f8331_28(int x) { return x * 28; }
+inline int f8331_29(int x) { return x * 29; }
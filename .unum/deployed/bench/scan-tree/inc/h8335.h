@@ -0,0 +1,42 @@
+#pragma once
+/* header 8335 */
+#include <vector>
+#include "h4450.h"
+#include "h666.h"
+#include "h8675.h"
+#include "h9805.h"
+#include "h8814.h"
+#ifdef X
+#include "h8482.h"
+#endif
+struct S8335 { int a; const char *s = "x//y"; };
+inline int f8335_0(int x) { return x * 0; }
+inline int f8335_1(int x) { return x * 1; }
+inline int f8335_2(int x) { return x * 2; }
+inline int f8335_3(int x) { return x * 3; }
+inline int f8335_4(int x) { return x * 4; }
+inline int f8335_5(int x) { return x * 5; }
+inline int f8335_6(int x) { return x * 6; }
+inline int f8335_7(int x) { return x * 7; }
+inline int f8335_8(int x) { return x * 8; }
+inline int f8335_9(int x) { return x * 9; }
+inline int f8335_10(int x) { return x * 10; }
+inline int f8335_11(int x) { return x * 11; }
+inline int f8335_12(int x) { return x * 12; }
+inline int f8335_13(int x) { return x * 13; }
+inline int f8335_14(int x) { return x * 14; }
+inline int f8335_15(int x) { return x * 15; }
+inline int f8335_16(int x) { return x * 16; }
+inline int f8335_17(int x) { return x * 17; }
+inline int f8335_18(int x) { return x * 18; }
+inline int f8335_19(int x) { return x * 19; }
+inline int f8335_20(int x) { return x * 20; }
+inline int f8335_21(int x) { return x * 21; }
+inline int f8335_22(int x) { return x * 22; }
+inline int f8335_23(int x) { return x * 23; }
+inline int f8335_24(int x) { return x * 24; }
+inline int f8335_25(int x) { return x * 25; }
+inline int f8335_26(int x) { return x * 26; }
+inline int f8335_27(int x) { return x * 27; }
+inline int f8335_28(int x) { return x * 28; }
+inline int f8335_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8336 */
+#include <vector>
+#include "h3640.h"
+#include "h2892.h"
+#include "h5408.h"
+#include "h6938.h"
+#include "h1448.h"
+#ifdef X
+#include "h4986.h"
+#endif
+struct S8336 { int a; const char *s = "x//y"; };
+inline int f8336_0(int x) { return x * 0; }
+inline int f8336_1(int x) { return x * 1; }
+inline int f8336_2(int x) { return x * 2; }
+inline int f8336_3(int x) { return x * 3; }
+inline int f8336_4(int x) { return x * 4; }
+inline int f8336_5(int x) { return x * 5; }
+inline int f8336_6(int x) { return x * 6; }
+inline int f8336_7(int x) { return x * 7; }
+inline int f8336_8(int x) { return x * 8; }
+inline int f8336_9(int x) { return x * 9; }
+inline int f8336_10(int x) { return x * 10; }
+inline int f8336_11(int x) { return x * 11; }
+inline int f8336_12(int x) { return x * 12; }
+inline int f8336_13(int x) { return x * 13; }
+inline int f8336_14(int x) { return x * 14; }
+inline int f8336_15(int x) { return x * 15; }
+inline int f8336_16(int x) { return x * 16; }
+inline int f8336_17(int x) { return x * 17; }
+inline int f8336_18(int x) { return x * 18; }
+inline int f8336_19(int x) { return x * 19; }
+inline int f8336_20(int x) { return x * 20; }
+inline int f8336_21(int x) { return x * 21; }
+inline int f8336_22(int x) { return x * 22; }
+inline int f8336_23(int x) { return x * 23; }
+inline int f8336_24(int x) { return x * 24; }
+inline int f8336_25(int x) { return x * 25; }
+inline int f8336_26(int x) { return x * 26; }
+inline int f8336_27(int x) { return x * 27; }
+inline int f8336_28(int x) { return x * 28; }
+inline int f8336_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8337 */
+#include <vector>
+#include "h6194.h"
+#include "h6552.h"
+#include "h8443.h"
+#include "h8056.h"
+#include "h8891.h"
+#ifdef X
+#include "h7850.h"
+#endif
+struct S8337 { int a; const char *s = "x//y"; };
+inline int f8337_0(int x) { return x * 0; }
+inline int f8337_1(int x) { return x * 1; }
+inline int f8337_2(int x) { return x * 2; }
+inline int f8337_3(int x) { return x * 3; }
+inline int f8337_4(int x) { return x * 4; }
+inline int f8337_5(int x) { return x * 5; }
+inline int f8337_6(int x) { return x * 6; }
+inline int f8337_7(int x) { return x * 7; }
+inline int f8337_8(int x) { return x * 8; }
+inline int f8337_9(int x) { return x * 9; }
+inline int f8337_10(int x) { return x * 10; }
+inline int f8337_11(int x) { return x * 11; }
+inline int f8337_12(int x) { return x * 12; }
+inline int f8337_13(int x) { return x * 13; }
+inline int f8337_14(int x) { return x * 14; }
+inline int f8337_15(int x) { return x * 15; }
+inline int f8337_16(int x) { return x * 16; }
+inline int f8337_17(int x) { return x * 17; }
+inline int f8337_18(int x) { return x * 18; }
+inline int f8337_19(int x) { return x * 19; }
+inline int f8337_20(int x) { return x * 20; }
+inline int f8337_21(int x) { return x * 21; }
+inline int f8337_22(int x) { return x * 22; }
+inline int f8337_23(int x) { return x * 23; }
+inline int f8337_24(int x) { return x * 24; }
+inline int f8337_25(int x) { return x * 25; }
+inline int f8337_26(int x) { return x * 26; }
+inline int f8337_27(int x) { return x * 27; }
+inline int f8337_28(int x) { return x * 28; }
+inline int f8337_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8338 */
+#include <vector>
+#include "h4828.h"
+#include "h8.h"
+#include "h2188.h"
+#include "h6251.h"
+#include "h9411.h"
+#ifdef X
+#include "h4828.h"
+#endif
+struct S8338 { int a; const char *s = "x//y"; };
+inline int f8338_0(int x) { return x * 0; }
+inline int f8338_1(int x) { return x * 1; }
+inline int f8338_2(int x) { return x * 2; }
+inline int f8338_3(int x) { return x * 3; }
+inline int f8338_4(int x) { return x * 4; }
+inline int f8338_5(int x) { return x * 5; }
+inline int f8338_6(int x) { return x * 6; }
+inline int f8338_7(int x) { return x * 7; }
+inline int f8338_8(int x) { return x * 8; }
+inline int f8338_9(int x) { return x * 9; }
+inline int f8338_10(int x) { return x * 10; }
+inline int f8338_11(int x) { return x * 11; }
+inline int f8338_12(int x) { return x * 12; }
+inline int f8338_13(int x) { return x * 13; }
+inline int f8338_14(int x) { return x * 14; }
+inline int f8338_15(int x) { return x * 15; }
+inline int f8338_16(int x) { return x * 16; }
+inline int f8338_17(int x) { return x * 17; }
+inline int f8338_18(int x) { return x * 18; }
+inline int f8338_19(int x) { return x * 19; }
+inline int f8338_20(int x) { return x * 20; }
+inline int f8338_21(int x) { return x * 21; }
+inline int f8338_22(int x) { return x * 22; }
+inline int f8338_23(int x) { return x * 23; }
+inline int f8338_24(int x) { return x * 24; }
+inline int f8338_25(int x) { return x * 25; }
+inline int f8338_26(int x) { return x * 26; }
+inline int f8338_27(int x) { return x * 27; }
+inline int f8338_28(int x) { return x * 28; }
+inline int f8338_29(int x) { return x * 29; }
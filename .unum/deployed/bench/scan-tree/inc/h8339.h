@@ -0,0 +1,42 @@
+#pragma once
+/* header 8339 */
+#include <vector>
+#include "h1916.h"
+#include "h1060.h"
+#include "h7551.h"
+#include "h9887.h"
+#include "h861.h"
+#ifdef X
+#include "h6702.h"
+#endif
+struct S8339 { int a; const char *s = "x//y"; };
+inline int f8339_0(int x) { return x * 0; }
+inline int f8339_1(int x) { return x * 1; }
+inline int f8339_2(int x) { return x * 2; }
+inline int f8339_3(int x) { return x * 3; }
+inline int f8339_4(int x) { return x * 4; }
+inline int f8339_5(int x) { return x * 5; }
+inline int f8339_6(int x) { return x * 6; }
+inline int f8339_7(int x) { return x * 7; }
+inline int f8339_8(int x) { return x * 8; }
+inline int f8339_9(int x) { return x * 9; }
+inline int f8339_10(int x) { return x * 10; }
+inline int f8339_11(int x) { return x * 11; }
+inline int f8339_12(int x) { return x * 12; }
+inline int f8339_13(int x) { return x * 13; }
+inline int f8339_14(int x) { return x * 14; }
+inline int f8339_15(int x) { return x * 15; }
+inline int f8339_16(int x) { return x * 16; }
+inline int f8339_17(int x) { return x * 17; }
+inline int f8339_18(int x) { return x * 18; }
+inline int f8339_19(int x) { return x * 19; }
+inline int f8339_20(int x) { return x * 20; }
+inline int f8339_21(int x) { return x * 21; }
+inline int f8339_22(int x) { return x * 22; }
+inline int f8339_23(int x) { return x * 23; }
+inline int f8339_24(int x) { return x * 24; }
+inline int f8339_25(int x) { return x * 25; }
+inline int f8339_26(int x) { return x * 26; }
+inline int f8339_27(int x) { return x * 27; }
+inline int f8339_28(int x) { return x * 28; }
+inline int f8339_29(int x) { return x * 29; }
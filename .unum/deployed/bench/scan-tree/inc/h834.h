@@ -0,0 +1,42 @@
+#pragma once
+/* header 834 */
+#include <vector>
+#include "h6903.h"
+#include "h9153.h"
+#include "h9704.h"
+#include "h441.h"
+#include "h487.h"
+#ifdef X
+#include "h6916.h"
+#endif
+struct S834 { int a; const char *s = "x//y"; };
+inline int f834_0(int x) { return x * 0; }
+inline int f834_1(int x) { return x * 1; }
+inline int f834_2(int x) { return x * 2; }
+inline int f834_3(int x) { return x * 3; }
+inline int f834_4(int x) { return x * 4; }
+inline int f834_5(int x) { return x * 5; }
+inline int f834_6(int x) { return x * 6; }
+inline int f834_7(int x) { return x * 7; }
+inline int f834_8(int x) { return x * 8; }
+inline int f834_9(int x) { return x * 9; }
+inline int f834_10(int x) { return x * 10; }
+inline int f834_11(int x) { return x * 11; }
+inline int f834_12(int x) { return x * 12; }
+inline int f834_13(int x) { return x * 13; }
+inline int f834_14(int x) { return x * 14; }
+inline int f834_15(int x) { return x * 15; }
+inline int f834_16(int x) { return x * 16; }
+inline int f834_17(int x) { return x * 17; }
+inline int f834_18(int x) { return x * 18; }
+inline int f834_19(int x) { return x * 19; }
+inline int f834_20(int x) { return x * 20; }
+inline int f834_21(int x) { return x * 21; }
+inline int f834_22(int x) { return x * 22; }
+inline int f834_23(int x) { return x * 23; }
+inline int f834_24(int x) { return x * 24; }
+inline int f834_25(int x) { return x * 25; }
+inline int f834_26(int x) { return x * 26; }
+inline int f834_27(int x) { return x * 27; }
+inline int f834_28(int x) { return x * 28; }
+inline int f834_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8340 */
+#include <vector>
+#include "h9653.h"
+#include "h4498.h"
+#include "h1452.h"
+#include "h7449.h"
+#include "h9404.h"
+#ifdef X
+#include "h3173.h"
+#endif
+struct S8340 { int a; const char *s = "x//y"; };
+inline int f8340_0(int x) { return x * 0; }
+inline int f8340_1(int x) { return x * 1; }
+inline int f8340_2(int x) { return x * 2; }
+inline int f8340_3(int x) { return x * 3; }
+inline int f8340_4(int x) { return x * 4; }
+inline int f8340_5(int x) { return x * 5; }
+inline int f8340_6(int x) { return x * 6; }
+inline int f8340_7(int x) { return x * 7; }
+inline int f8340_8(int x) { return x * 8; }
+inline int f8340_9(int x) { return x * 9; }
+inline int f8340_10(int x) { return x * 10; }
+inline int f8340_11(int x) { return x * 11; }
+inline int f8340_12(int x) { return x * 12; }
+inline int f8340_13(int x) { return x * 13; }
+inline int f8340_14(int x) { return x * 14; }
+inline int f8340_15(int x) { return x * 15; }
+inline int f8340_16(int x) { return x * 16; }
+inline int f8340_17(int x) { return x * 17; }
+inline int f8340_18(int x) { return x * 18; }
+inline int f8340_19(int x) { return x * 19; }
+inline int f8340_20(int x) { return x * 20; }
+inline int f8340_21(int x) { return x * 21; }
+inline int f8340_22(int x) { return x * 22; }
+inline int f8340_23(int x) { return x * 23; }
+inline int f8340_24(int x) { return x * 24; }
+inline int f8340_25(int x) { return x * 25; }
+inline int f8340_26(int x) { return x * 26; }
+inline int f8340_27(int x) { return x * 27; }
+inline int f8340_28(int x) { return x * 28; }
+inline int f8340_29(int x) { return x * 29; }
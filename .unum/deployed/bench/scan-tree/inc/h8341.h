@@ -0,0 +1,42 @@
+#pragma once
+/* header 8341 */
+#include <vector>
+#include "h594.h"
+#include "h8152.h"
+#include "h8856.h"
+#include "h9438.h"
+#include "h3952.h"
+#ifdef X
+#include "h4390.h"
+#endif
+struct S8341 { int a; const char *s = "x//y"; };
+inline int f8341_0(int x) { return x * 0; }
+inline int f8341_1(int x) { return x * 1; }
+inline int f8341_2(int x) { return x * 2; }
+inline int f8341_3(int x) { return x * 3; }
+inline int f8341_4(int x) { return x * 4; }
+inline int f8341_5(int x) { return x * 5; }
+inline int f8341_6(int x) { return x * 6; }
+inline int f8341_7(int x) { return x * 7; }
+inline int f8341_8(int x) { return x * 8; }
+inline int f8341_9(int x) { return x * 9; }
+inline int f8341_10(int x) { return x * 10; }
+inline int f8341_11(int x) { return x * 11; }
+inline int f8341_12(int x) { return x * 12; }
+inline int f8341_13(int x) { return x * 13; }
+inline int f8341_14(int x) { return x * 14; }
+inline int f8341_15(int x) { return x * 15; }
+inline int f8341_16(int x) { return x * 16; }
+inline int f8341_17(int x) { return x * 17; }
+inline int f8341_18(int x) { return x * 18; }
+inline int f8341_19(int x) { return x * 19; }
+inline int f8341_20(int x) { return x * 20; }
+inline int f8341_21(int x) { return x * 21; }
+inline int f8341_22(int x) { return x * 22; }
+inline int f8341_23(int x) { return x * 23; }
+inline int f8341_24(int x) { return x * 24; }
+inline int f8341_25(int x) { return x * 25; }
+inline int f8341_26(int x) { return x * 26; }
+inline int f8341_27(int x) { return x * 27; }
+inline int f8341_28(int x) { return x * 28; }
+inline int f8341_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8342 */
+#include <vector>
+#include "h1535.h"
+#include "h5841.h"
+#include "h1968.h"
+#include "h8949.h"
+#include "h9336.h"
+#ifdef X
+#include "h3511.h"
+#endif
+struct S8342 { int a; const char *s = "x//y"; };
+inline int f8342_0(int x) { return x * 0; }
+inline int f8342_1(int x) { return x * 1; }
+inline int f8342_2(int x) { return x * 2; }
+inline int f8342_3(int x) { return x * 3; }
+inline int f8342_4(int x) { return x * 4; }
+inline int f8342_5(int x) { return x * 5; }
+inline int f8342_6(int x) { return x * 6; }
+inline int f8342_7(int x) { return x * 7; }
+inline int f8342_8(int x) { return x * 8; }
+inline int f8342_9(int x) { return x * 9; }
+inline int f8342_10(int x) { return x * 10; }
+inline int f8342_11(int x) { return x * 11; }
+inline int f8342_12(int x) { return x * 12; }
+inline int f8342_13(int x) { return x * 13; }
+inline int f8342_14(int x) { return x * 14; }
+inline int f8342_15(int x) { return x * 15; }
+inline int f8342_16(int x) { return x * 16; }
+inline int f8342_17(int x) { return x * 17; }
+inline int f8342_18(int x) { return x * 18; }
+inline int f8342_19(int x) { return x * 19; }
+inline int f8342_20(int x) { return x * 20; }
+inline int f8342_21(int x) { return x * 21; }
+inline int f8342_22(int x) { return x * 22; }
+inline int f8342_23(int x) { return x * 23; }
+inline int f8342_24(int x) { return x * 24; }
+inline int f8342_25(int x) { return x * 25; }
+inline int f8342_26(int x) { return x * 26; }
+inline int f8342_27(int x) { return x * 27; }
+inline int f8342_28(int x) { return x * 28; }
+inline int f8342_29(int x) { return x * 29; }
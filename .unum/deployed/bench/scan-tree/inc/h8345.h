@@ -0,0 +1,42 @@
+#pragma once
+/* header 8345 */
+#include <vector>
+#include "h5176.h"
+#include "h9941.h"
+#include "h1121.h"
+#include "h9462.h"
+#include "h3230.h"
+#ifdef X
+#include "h449.h"
+#endif
+struct S8345 { int a; const char *s = "x//y"; };
+inline int f8345_0(int x) { return x * 0; }
+inline int f8345_1(int x) { return x * 1; }
+inline int f8345_2(int x) { return x * 2; }
+inline int f8345_3(int x) { return x * 3; }
+inline int f8345_4(int x) { return x * 4; }
+inline int f8345_5(int x) { return x * 5; }
+inline int f8345_6(int x) { return x * 6; }
+inline int f8345_7(int x) { return x * 7; }
+inline int f8345_8(int x) { return x * 8; }
+inline int f8345_9(int x) { return x * 9; }
+inline int f8345_10(int x) { return x * 10; }
+inline int f8345_11(int x) { return x * 11; }
+inline int f8345_12(int x) { return x * 12; }
+inline int f8345_13(int x) { return x * 13; }
+inline int f8345_14(int x) { return x * 14; }
+inline int f8345_15(int x) { return x * 15; }
+inline int f8345_16(int x) { return x * 16; }
+inline int f8345_17(int x) { return x * 17; }
+inline int f8345_18(int x) { return x * 18; }
+inline int f8345_19(int x) { return x * 19; }
+inline int f8345_20(int x) { return x * 20; }
+inline int f8345_21(int x) { return x * 21; }
+inline int f8345_22(int x) { return x * 22; }
+inline int f8345_23(int x) { return x * 23; }
+inline int f8345_24(int x) { return x * 24; }
+inline int f8345_25(int x) { return x * 25; }
+inline int f8345_26(int x) { return x * 26; }
+inline int f8345_27(int x) { return x * 27; }
+inline int f8345_28(int x) { return x * 28; }
+inline int f8345_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8346 */
+#include <vector>
+#include "h8233.h"
+#include "h4121.h"
+#include "h3946.h"
+#include "h6353.h"
+#include "h4058.h"
+#ifdef X
+#include "h8865.h"
+#endif
+struct S8346 { int a; const char *s = "x//y"; };
+inline int f8346_0(int x) { return x * 0; }
+inline int f8346_1(int x) { return x * 1; }
+inline int f8346_2(int x) { return x * 2; }
+inline int f8346_3(int x) { return x * 3; }
+inline int f8346_4(int x) { return x * 4; }
+inline int f8346_5(int x) { return x * 5; }
+inline int f8346_6(int x) { return x * 6; }
+inline int f8346_7(int x) { return x * 7; }
+inline int f8346_8(int x) { return x * 8; }
+inline int f8346_9(int x) { return x * 9; }
+inline int f8346_10(int x) { return x * 10; }
+inline int f8346_11(int x) { return x * 11; }
+inline int f8346_12(int x) { return x * 12; }
+inline int f8346_13(int x) { return x * 13; }
+inline int f8346_14(int x) { return x * 14; }
+inline int f8346_15(int x) { return x * 15; }
+inline int f8346_16(int x) { return x * 16; }
+inline int f8346_17(int x) { return x * 17; }
+inline int f8346_18(int x) { return x * 18; }
+inline int f8346_19(int x) { return x * 19; }
+inline int f8346_20(int x) { return x * 20; }
+inline int f8346_21(int x) { return x * 21; }
+inline int f8346_22(int x) { return x * 22; }
+inline int f8346_23(int x) { return x * 23; }
+inline int f8346_24(int x) { return x * 24; }
+inline int f8346_25(int x) { return x * 25; }
+inline int f8346_26(int x) { return x * 26; }
+inline int f8346_27(int x) { return x * 27; }
+inline int f8346_28(int x) { return x * 28; }
+inline int f8346_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8347 */
+#include <vector>
+#include "h3356.h"
+#include "h716.h"
+#include "h4001.h"
+#include "h3522.h"
+#include "h7242.h"
+#ifdef X
+#include "h9222.h"
+#endif
+struct S8347 { int a; const char *s = "x//y"; };
+inline int f8347_0(int x) { return x * 0; }
+inline int f8347_1(int x) { return x * 1; }
+inline int f8347_2(int x) { return x * 2; }
+inline int f8347_3(int x) { return x * 3; }
+inline int f8347_4(int x) { return x * 4; }
+inline int f8347_5(int x) { return x * 5; }
+inline int f8347_6(int x) { return x * 6; }
+inline int f8347_7(int x) { return x * 7; }
+inline int f8347_8(int x) { return x * 8; }
+inline int f8347_9(int x) { return x * 9; }
+inline int f8347_10(int x) { return x * 10; }
+inline int f8347_11(int x) { return x * 11; }
+inline int f8347_12(int x) { return x * 12; }
+inline int f8347_13(int x) { return x * 13; }
+inline int f8347_14(int x) { return x * 14; }
+inline int f8347_15(int x) { return x * 15; }
+inline int f8347_16(int x) { return x * 16; }
+inline int f8347_17(int x) { return x * 17; }
+inline int f8347_18(int x) { return x * 18; }
+inline int f8347_19(int x) { return x * 19; }
+inline int f8347_20(int x) { return x * 20; }
+inline int f8347_21(int x) { return x * 21; }
+inline int f8347_22(int x) { return x * 22; }
+inline int f8347_23(int x) { return x * 23; }
+inline int f8347_24(int x) { return x * 24; }
+inline int f8347_25(int x) { return x * 25; }
+inline int f8347_26(int x) { return x * 26; }
+inline int f8347_27(int x) { return x * 27; }
+inline int f8347_28(int x) { return x * 28; }
+inline int f8347_29(int x) { return x * 29; }
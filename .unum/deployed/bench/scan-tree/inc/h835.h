@@ -0,0 +1,42 @@
+#pragma once
+/* header 835 */
+#include <vector>
+#include "h1777.h"
+#include "h8194.h"
+#include "h1352.h"
+#include "h251.h"
+#include "h875.h"
+#ifdef X
+#include "h7533.h"
+#endif
+struct S835 { int a; const char *s = "x//y"; };
+inline int f835_0(int x) { return x * 0; }
+inline int f835_1(int x) { return x * 1; }
+inline int f835_2(int x) { return x * 2; }
+inline int f835_3(int x) { return x * 3; }
+inline int f835_4(int x) { return x * 4; }
+inline int f835_5(int x) { return x * 5; }
+inline int f835_6(int x) { return x * 6; }
+inline int f835_7(int x) { return x * 7; }
+inline int f835_8(int x) { return x * 8; }
+inline int f835_9(int x) { return x * 9; }
+inline int f835_10(int x) { return x * 10; }
+inline int f835_11(int x) { return x * 11; }
+inline int f835_12(int x) { return x * 12; }
+inline int f835_13(int x) { return x * 13; }
+inline int f835_14(int x) { return x * 14; }
+inline int f835_15(int x) { return x * 15; }
+inline int f835_16(int x) { return x * 16; }
+inline int f835_17(int x) { return x * 17; }
+inline int f835_18(int x) { return x * 18; }
+inline int f835_19(int x) { return x * 19; }
+inline int f835_20(int x) { return x * 20; }
+inline int f835_21(int x) { return x * 21; }
+inline int f835_22(int x) { return x * 22; }
+inline int f835_23(int x) { return x * 23; }
+inline int f835_24(int x) { return x * 24; }
+inline int f835_25(int x) { return x * 25; }
+inline int f835_26(int x) { return x * 26; }
+inline int f835_27(int x) { return x * 27; }
+inline int f835_28(int x) { return x * 28; }
+inline int f835_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8351 */
+#include <vector>
+#include "h974.h"
+#include "h7186.h"
+#include "h8333.h"
+#include "h4000.h"
+#include "h9269.h"
+#ifdef X
+#include "h5020.h"
+#endif
+struct S8351 { int a; const char *s = "x//y"; };
+inline int f8351_0(int x) { return x * 0; }
+inline int f8351_1(int x) { return x * 1; }
+inline int f8351_2(int x) { return x * 2; }
+inline int f8351_3(int x) { return x * 3; }
+inline int f8351_4(int x) { return x * 4; }
+inline int f8351_5(int x) { return x * 5; }
+inline int f8351_6(int x) { return x * 6; }
+inline int f8351_7(int x) { return x * 7; }
+inline int f8351_8(int x) { return x * 8; }
+inline int f8351_9(int x) { return x * 9; }
+inline int f8351_10(int x) { return x * 10; }
+inline int f8351_11(int x) { return x * 11; }
+inline int f8351_12(int x) { return x * 12; }
+inline int f8351_13(int x) { return x * 13; }
+inline int f8351_14(int x) { return x * 14; }
+inline int f8351_15(int x) { return x * 15; }
+inline int f8351_16(int x) { return x * 16; }
+inline int f8351_17(int x) { return x * 17; }
+inline int f8351_18(int x) { return x * 18; }
+inline int f8351_19(int x) { return x * 19; }
+inline int f8351_20(int x) { return x * 20; }
+inline int f8351_21(int x) { return x * 21; }
+inline int f8351_22(int x) { return x * 22; }
+inline int f8351_23(int x) { return x * 23; }
+inline int f8351_24(int x) { return x * 24; }
+inline int f8351_25(int x) { return x * 25; }
+inline int f8351_26(int x) { return x * 26; }
+inline int f8351_27(int x) { return x * 27; }
+inline int f8351_28(int x) { return x * 28; }
+inline int f8351_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8352 */
+#include <vector>
+#include "h3093.h"
+#include "h5749.h"
+#include "h9149.h"
+#include "h4037.h"
+#include "h6356.h"
+#ifdef X
+#include "h6452.h"
+#endif
+struct S8352 { int a; const char *s = "x//y"; };
+inline int f8352_0(int x) { return x * 0; }
+inline int f8352_1(int x) { return x * 1; }
+inline int f8352_2(int x) { return x * 2; }
+inline int f8352_3(int x) { return x * 3; }
+inline int f8352_4(int x) { return x * 4; }
+inline int f8352_5(int x) { return x * 5; }
+inline int f8352_6(int x) { return x * 6; }
+inline int f8352_7(int x) { return x * 7; }
+inline int f8352_8(int x) { return x * 8; }
+inline int f8352_9(int x) { return x * 9; }
+inline int f8352_10(int x) { return x * 10; }
+inline int f8352_11(int x) { return x * 11; }
+inline int f8352_12(int x) { return x * 12; }
+inline int f8352_13(int x) { return x * 13; }
+inline int f8352_14(int x) { return x * 14; }
+inline int f8352_15(int x) { return x * 15; }
+inline int f8352_16(int x) { return x * 16; }
+inline int f8352_17(int x) { return x * 17; }
+inline int f8352_18(int x) { return x * 18; }
+inline int f8352_19(int x) { return x * 19; }
+inline int f8352_20(int x) { return x * 20; }
+inline int f8352_21(int x) { return x * 21; }
+inline int f8352_22(int x) { return x * 22; }
+inline int f8352_23(int x) { return x * 23; }
+inline int f8352_24(int x) { return x * 24; }
+inline int f8352_25(int x) { return x * 25; }
+inline int f8352_26(int x) { return x * 26; }
+inline int f8352_27(int x) { return x * 27; }
+inline int f8352_28(int x) { return x * 28; }
+inline int f8352_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8354 */
+#include <vector>
+#include "h4463.h"
+#include "h821.h"
+#include "h9975.h"
+#include "h4434.h"
+#include "h8612.h"
+#ifdef X
+#include "h3319.h"
+#endif
+struct S8354 { int a; const char *s = "x//y"; };
+inline int f8354_0(int x) { return x * 0; }
+inline int f8354_1(int x) { return x * 1; }
+inline int f8354_2(int x) { return x * 2; }
+inline int f8354_3(int x) { return x * 3; }
+inline int f8354_4(int x) { return x * 4; }
+inline int f8354_5(int x) { return x * 5; }
+inline int f8354_6(int x) { return x * 6; }
+inline int f8354_7(int x) { return x * 7; }
+inline int f8354_8(int x) { return x * 8; }
+inline int f8354_9(int x) { return x * 9; }
+inline int f8354_10(int x) { return x * 10; }
+inline int f8354_11(int x) { return x * 11; }
+inline int f8354_12(int x) { return x * 12; }
+inline int f8354_13(int x) { return x * 13; }
+inline int f8354_14(int x) { return x * 14; }
+inline int f8354_15(int x) { return x * 15; }
+inline int f8354_16(int x) { return x * 16; }
+inline int f8354_17(int x) { return x * 17; }
+inline int f8354_18(int x) { return x * 18; }
+inline int f8354_19(int x) { return x * 19; }
+inline int f8354_20(int x) { return x * 20; }
+inline int f8354_21(int x) { return x * 21; }
+inline int f8354_22(int x) { return x * 22; }
+inline int f8354_23(int x) { return x * 23; }
+inline int f8354_24(int x) { return x * 24; }
+inline int f8354_25(int x) { return x * 25; }
+inline int f8354_26(int x) { return x * 26; }
+inline int f8354_27(int x) { return x * 27; }
+inline int f8354_28(int x) { return x * 28; }
+inline int f8354_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8355 */
+#include <vector>
+#include "h8901.h"
+#include "h1745.h"
+#include "h2654.h"
+#include "h1341.h"
+#include "h2281.h"
+#ifdef X
+#include "h2088.h"
+#endif
+struct S8355 { int a; const char *s = "x//y"; };
+inline int f8355_0(int x) { return x * 0; }
+inline int f8355_1(int x) { return x * 1; }
+inline int f8355_2(int x) { return x * 2; }
+inline int f8355_3(int x) { return x * 3; }
+inline int f8355_4(int x) { return x * 4; }
+inline int f8355_5(int x) { return x * 5; }
+inline int f8355_6(int x) { return x * 6; }
+inline int f8355_7(int x) { return x * 7; }
+inline int f8355_8(int x) { return x * 8; }
+inline int f8355_9(int x) { return x * 9; }
+inline int f8355_10(int x) { return x * 10; }
+inline int f8355_11(int x) { return x * 11; }
+inline int f8355_12(int x) { return x * 12; }
+inline int f8355_13(int x) { return x * 13; }
+inline int f8355_14(int x) { return x * 14; }
+inline int f8355_15(int x) { return x * 15; }
+inline int f8355_16(int x) { return x * 16; }
+inline int f8355_17(int x) { return x * 17; }
+inline int f8355_18(int x) { return x * 18; }
+inline int f8355_19(int x) { return x * 19; }
+inline int f8355_20(int x) { return x * 20; }
+inline int f8355_21(int x) { return x * 21; }
+inline int f8355_22(int x) { return x * 22; }
+inline int f8355_23(int x) { return x * 23; }
+inline int f8355_24(int x) { return x * 24; }
+inline int f8355_25(int x) { return x * 25; }
+inline int f8355_26(int x) { return x * 26; }
+inline int f8355_27(int x) { return x * 27; }
+inline int f8355_28(int x) { return x * 28; }
+inline int f8355_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8357 */
+#include <vector>
+#include "h9940.h"
+#include "h5825.h"
+#include "h4463.h"
+#include "h3475.h"
+#include "h2276.h"
+#ifdef X
+#include "h8044.h"
+#endif
+struct S8357 { int a; const char *s = "x//y"; };
+inline int f8357_0(int x) { return x * 0; }
+inline int f8357_1(int x) { return x * 1; }
+inline int f8357_2(int x) { return x * 2; }
+inline int f8357_3(int x) { return x * 3; }
+inline int f8357_4(int x) { return x * 4; }
+inline int f8357_5(int x) { return x * 5; }
+inline int f8357_6(int x) { return x * 6; }
+inline int f8357_7(int x) { return x * 7; }
+inline int f8357_8(int x) { return x * 8; }
+inline int f8357_9(int x) { return x * 9; }
+inline int f8357_10(int x) { return x * 10; }
+inline int f8357_11(int x) { return x * 11; }
+inline int f8357_12(int x) { return x * 12; }
+inline int f8357_13(int x) { return x * 13; }
+inline int f8357_14(int x) { return x * 14; }
+inline int f8357_15(int x) { return x * 15; }
+inline int f8357_16(int x) { return x * 16; }
+inline int f8357_17(int x) { return x * 17; }
+inline int f8357_18(int x) { return x * 18; }
+inline int f8357_19(int x) { return x * 19; }
+inline int f8357_20(int x) { return x * 20; }
+inline int f8357_21(int x) { return x * 21; }
+inline int f8357_22(int x) { return x * 22; }
+inline int f8357_23(int x) { return x * 23; }
+inline int f8357_24(int x) { return x * 24; }
+inline int f8357_25(int x) { return x * 25; }
+inline int f8357_26(int x) { return x * 26; }
+inline int f8357_27(int x) { return x * 27; }
+inline int f8357_28(int x) { return x * 28; }
+inline int f8357_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8358 */
+#include <vector>
+#include "h8393.h"
+#include "h3449.h"
+#include "h327.h"
+#include "h9457.h"
+#include "h4375.h"
+#ifdef X
+#include "h4624.h"
+#endif
+struct S8358 { int a; const char *s = "x//y"; };
+inline int f8358_0(int x) { return x * 0; }
+inline int f8358_1(int x) { return x * 1; }
+inline int f8358_2(int x) { return x * 2; }
+inline int f8358_3(int x) { return x * 3; }
+inline int f8358_4(int x) { return x * 4; }
+inline int f8358_5(int x) { return x * 5; }
+inline int f8358_6(int x) { return x * 6; }
+inline int f8358_7(int x) { return x * 7; }
+inline int f8358_8(int x) { return x * 8; }
+inline int f8358_9(int x) { return x * 9; }
+inline int f8358_10(int x) { return x * 10; }
+inline int f8358_11(int x) { return x * 11; }
+inline int f8358_12(int x) { return x * 12; }
+inline int f8358_13(int x) { return x * 13; }
+inline int f8358_14(int x) { return x * 14; }
+inline int f8358_15(int x) { return x * 15; }
+inline int f8358_16(int x) { return x * 16; }
+inline int f8358_17(int x) { return x * 17; }
+inline int f8358_18(int x) { return x * 18; }
+inline int f8358_19(int x) { return x * 19; }
+inline int f8358_20(int x) { return x * 20; }
+inline int f8358_21(int x) { return x * 21; }
+inline int f8358_22(int x) { return x * 22; }
+inline int f8358_23(int x) { return x * 23; }
+inline int f8358_24(int x) { return x * 24; }
+inline int f8358_25(int x) { return x * 25; }
+inline int f8358_26(int x) { return x * 26; }
+inline int f8358_27(int x) { return x * 27; }
+inline int f8358_28(int x) { return x * 28; }
+inline int f8358_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8359 */
+#include <vector>
+#include "h7560.h"
+#include "h2463.h"
+#include "h9416.h"
+#include "h4664.h"
+#include "h8477.h"
+#ifdef X
+#include "h3528.h"
+#endif
+struct S8359 { int a; const char *s = "x//y"; };
+inline int f8359_0(int x) { return x * 0; }
+inline int f8359_1(int x) { return x * 1; }
+inline int f8359_2(int x) { return x * 2; }
+inline int f8359_3(int x) { return x * 3; }
+inline int f8359_4(int x) { return x * 4; }
+inline int f8359_5(int x) { return x * 5; }
+inline int f8359_6(int x) { return x * 6; }
+inline int f8359_7(int x) { return x * 7; }
+inline int f8359_8(int x) { return x * 8; }
+inline int f8359_9(int x) { return x * 9; }
+inline int f8359_10(int x) { return x * 10; }
+inline int f8359_11(int x) { return x * 11; }
+inline int f8359_12(int x) { return x * 12; }
+inline int f8359_13(int x) { return x * 13; }
+inline int f8359_14(int x) { return x * 14; }
+inline int f8359_15(int x) { return x * 15; }
+inline int f8359_16(int x) { return x * 16; }
+inline int f8359_17(int x) { return x * 17; }
+inline int f8359_18(int x) { return x * 18; }
+inline int f8359_19(int x) { return x * 19; }
+inline int f8359_20(int x) { return x * 20; }
+inline int f8359_21(int x) { return x * 21; }
+inline int f8359_22(int x) { return x * 22; }
+inline int f8359_23(int x) { return x * 23; }
+inline int f8359_24(int x) { return x * 24; }
+inline int f8359_25(int x) { return x * 25; }
+inline int f8359_26(int x) { return x * 26; }
+inline int f8359_27(int x) { return x * 27; }
+inline int f8359_28(int x) { return x * 28; }
+inline int f8359_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 836 */
+#include <vector>
+#include "h6846.h"
+#include "h7502.h"
+#include "h7568.h"
+#include "h209.h"
+#include "h2467.h"
+#ifdef X
+#include "h3468.h"
+#endif
+struct S836 { int a; const char *s = "x//y"; };
+inline int f836_0(int x) { return x * 0; }
+inline int f836_1(int x) { return x * 1; }
+inline int f836_2(int x) { return x * 2; }
+inline int f836_3(int x) { return x * 3; }
+inline int f836_4(int x) { return x * 4; }
+inline int f836_5(int x) { return x * 5; }
+inline int f836_6(int x) { return x * 6; }
+inline int f836_7(int x) { return x * 7; }
+inline int f836_8(int x) { return x * 8; }
+inline int f836_9(int x) { return x * 9; }
+inline int f836_10(int x) { return x * 10; }
+inline int f836_11(int x) { return x * 11; }
+inline int f836_12(int x) { return x * 12; }
+inline int f836_13(int x) { return x * 13; }
+inline int f836_14(int x) { return x * 14; }
+inline int f836_15(int x) { return x * 15; }
+inline int f836_16(int x) { return x * 16; }
+inline int f836_17(int x) { return x * 17; }
+inline int f836_18(int x) { return x * 18; }
+inline int f836_19(int x) { return x * 19; }
+inline int f836_20(int x) { return x * 20; }
+inline int f836_21(int x) { return x * 21; }
+inline int f836_22(int x) { return x * 22; }
+inline int f836_23(int x) { return x * 23; }
+inline int f836_24(int x) { return x * 24; }
+inline int f836_25(int x) { return x * 25; }
+inline int f836_26(int x) { return x * 26; }
+inline int f836_27(int x) { return x * 27; }
+inline int f836_28(int x) { return x * 28; }
+inline int f836_29(int x) { return x * 29; }
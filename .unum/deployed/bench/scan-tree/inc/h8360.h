@@ -0,0 +1,42 @@
+#pragma once
+/* header 8360 */
+#include <vector>
+#include "h7742.h"
+#include "h9629.h"
+#include "h7807.h"
+#include "h4072.h"
+#include "h7090.h"
+#ifdef X
+#include "h8052.h"
+#endif
+struct S8360 { int a; const char *s = "x//y"; };
+inline int f8360_0(int x) { return x * 0; }
+inline int f8360_1(int x) { return x * 1; }
+inline int f8360_2(int x) { return x * 2; }
+inline int f8360_3(int x) { return x * 3; }
+inline int f8360_4(int x) { return x * 4; }
+inline int f8360_5(int x) { return x * 5; }
+inline int f8360_6(int x) { return x * 6; }
+inline int f8360_7(int x) { return x * 7; }
+inline int f8360_8(int x) { return x * 8; }
+inline int f8360_9(int x) { return x * 9; }
+inline int f8360_10(int x) { return x * 10; }
+inline int f8360_11(int x) { return x * 11; }
+inline int f8360_12(int x) { return x * 12; }
+inline int f8360_13(int x) { return x * 13; }
+inline int f8360_14(int x) { return x * 14; }
+inline int f8360_15(int x) { return x * 15; }
+inline int f8360_16(int x) { return x * 16; }
+inline int f8360_17(int x) { return x * 17; }
+inline int f8360_18(int x) { return x * 18; }
+inline int f8360_19(int x) { return x * 19; }
+inline int f8360_20(int x) { return x * 20; }
+inline int f8360_21(int x) { return x * 21; }
+inline int f8360_22(int x) { return x * 22; }
+inline int f8360_23(int x) { return x * 23; }
+inline int f8360_24(int x) { return x * 24; }
+inline int f8360_25(int x) { return x * 25; }
+inline int f8360_26(int x) { return x * 26; }
+inline int f8360_27(int x) { return x * 27; }
+inline int f8360_28(int x) { return x * 28; }
+inline int f8360_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8361 */
+#include <vector>
+#include "h7133.h"
+#include "h6184.h"
+#include "h2835.h"
+#include "h876.h"
+#include "h6155.h"
+#ifdef X
+#include "h9839.h"
+#endif
+struct S8361 { int a; const char *s = "x//y"; };
+inline int f8361_0(int x) { return x * 0; }
+inline int f8361_1(int x) { return x * 1; }
+inline int f8361_2(int x) { return x * 2; }
+inline int f8361_3(int x) { return x * 3; }
+inline int f8361_4(int x) { return x * 4; }
+inline int f8361_5(int x) { return x * 5; }
+inline int f8361_6(int x) { return x * 6; }
+inline int f8361_7(int x) { return x * 7; }
+inline int f8361_8(int x) { return x * 8; }
+inline int f8361_9(int x) { return x * 9; }
+inline int f8361_10(int x) { return x * 10; }
+inline int f8361_11(int x) { return x * 11; }
+inline int f8361_12(int x) { return x * 12; }
+inline int f8361_13(int x) { return x * 13; }
+inline int f8361_14(int x) { return x * 14; }
+inline int f8361_15(int x) { return x * 15; }
+inline int f8361_16(int x) { return x * 16; }
+inline int f8361_17(int x) { return x * 17; }
+inline int f8361_18(int x) { return x * 18; }
+inline int f8361_19(int x) { return x * 19; }
+inline int f8361_20(int x) { return x * 20; }
+inline int f8361_21(int x) { return x * 21; }
+inline int f8361_22(int x) { return x * 22; }
+inline int f8361_23(int x) { return x * 23; }
+inline int f8361_24(int x) { return x * 24; }
+inline int f8361_25(int x) { return x * 25; }
+inline int f8361_26(int x) { return x * 26; }
+inline int f8361_27(int x) { return x * 27; }
+inline int f8361_28(int x) { return x * 28; }
+inline int f8361_29(int x) { return x * 29; }
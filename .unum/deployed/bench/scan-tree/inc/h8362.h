@@ -0,0 +1,42 @@
+#pragma once
+/* header 8362 */
+#include <vector>
+#include "h576.h"
+#include "h4282.h"
+#include "h2326.h"
+#include "h22.h"
+#include "h7066.h"
+#ifdef X
+#include "h9277.h"
+#endif
+struct S8362 { int a; const char *s = "x//y"; };
+inline int f8362_0(int x) { return x * 0; }
+inline int f8362_1(int x) { return x * 1; }
+inline int f8362_2(int x) { return x * 2; }
+inline int f8362_3(int x) { return x * 3; }
+inline int f8362_4(int x) { return x * 4; }
+inline int f8362_5(int x) { return x * 5; }
+inline int f8362_6(int x) { return x * 6; }
+inline int f8362_7(int x) { return x * 7; }
+inline int f8362_8(int x) { return x * 8; }
+inline int f8362_9(int x) { return x * 9; }
+inline int f8362_10(int x) { return x * 10; }
+inline int f8362_11(int x) { return x * 11; }
+inline int f8362_12(int x) { return x * 12; }
+inline int f8362_13(int x) { return x * 13; }
+inline int f8362_14(int x) { return x * 14; }
+inline int f8362_15(int x) { return x * 15; }
+inline int f8362_16(int x) { return x * 16; }
+inline int f8362_17(int x) { return x * 17; }
+inline int f8362_18(int x) { return x * 18; }
+inline int f8362_19(int x) { return x * 19; }
+inline int f8362_20(int x) { return x * 20; }
+inline int f8362_21(int x) { return x * 21; }
+inline int f8362_22(int x) { return x * 22; }
+inline int f8362_23(int x) { return x * 23; }
+inline int f8362_24(int x) { return x * 24; }
+inline int f8362_25(int x) { return x * 25; }
+inline int f8362_26(int x) { return x * 26; }
+inline int f8362_27(int x) { return x * 27; }
+inline int f8362_28(int x) { return x * 28; }
+inline int f8362_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8363 */
+#include <vector>
+#include "h5184.h"
+#include "h2260.h"
+#include "h2703.h"
+#include "h9348.h"
+#include "h7006.h"
+#ifdef X
+#include "h2093.h"
+#endif
+struct S8363 { int a; const char *s = "x//y"; };
+inline int f8363_0(int x) { return x * 0; }
+inline int f8363_1(int x) { return x * 1; }
+inline int f8363_2(int x) { return x * 2; }
+inline int f8363_3(int x) { return x * 3; }
+inline int f8363_4(int x) { return x * 4; }
+inline int f8363_5(int x) { return x * 5; }
+inline int f8363_6(int x) { return x * 6; }
+inline int f8363_7(int x) { return x * 7; }
+inline int f8363_8(int x) { return x * 8; }
+inline int f8363_9(int x) { return x * 9; }
+inline int f8363_10(int x) { return x * 10; }
+inline int f8363_11(int x) { return x * 11; }
+inline int f8363_12(int x) { return x * 12; }
+inline int f8363_13(int x) { return x * 13; }
+inline int f8363_14(int x) { return x * 14; }
+inline int f8363_15(int x) { return x * 15; }
+inline int f8363_16(int x) { return x * 16; }
+inline int f8363_17(int x) { return x * 17; }
+inline int f8363_18(int x) { return x * 18; }
+inline int f8363_19(int x) { return x * 19; }
+inline int f8363_20(int x) { return x * 20; }
+inline int f8363_21(int x) { return x * 21; }
+inline int f8363_22(int x) { return x * 22; }
+inline int f8363_23(int x) { return x * 23; }
+inline int f8363_24(int x) { return x * 24; }
+inline int f8363_25(int x) { return x * 25; }
+inline int f8363_26(int x) { return x * 26; }
+inline int f8363_27(int x) { return x * 27; }
+inline int f8363_28(int x) { return x * 28; }
+inline int f8363_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8364 */
+#include <vector>
+#include "h4781.h"
+#include "h9001.h"
+#include "h6019.h"
+#include "h6087.h"
+#include "h3907.h"
+#ifdef X
+#include "h9097.h"
+#endif
+struct S8364 { int a; const char *s = "x//y"; };
+inline int f8364_0(int x) { return x * 0; }
+inline int f8364_1(int x) { return x * 1; }
+inline int f8364_2(int x) { return x * 2; }
+inline int f8364_3(int x) { return x * 3; }
+inline int f8364_4(int x) { return x * 4; }
+inline int f8364_5(int x) { return x * 5; }
+inline int f8364_6(int x) { return x * 6; }
+inline int f8364_7(int x) { return x * 7; }
+inline int f8364_8(int x) { return x * 8; }
+inline int f8364_9(int x) { return x * 9; }
+inline int f8364_10(int x) { return x * 10; }
+inline int f8364_11(int x) { return x * 11; }
+inline int f8364_12(int x) { return x * 12; }
+inline int f8364_13(int x) { return x * 13; }
+inline int f8364_14(int x) { return x * 14; }
+inline int f8364_15(int x) { return x * 15; }
+inline int f8364_16(int x) { return x * 16; }
+inline int f8364_17(int x) { return x * 17; }
+inline int f8364_18(int x) { return x * 18; }
+inline int f8364_19(int x) { return x * 19; }
+inline int f8364_20(int x) { return x * 20; }
+inline int f8364_21(int x) { return x * 21; }
+inline int f8364_22(int x) { return x * 22; }
+inline int f8364_23(int x) { return x * 23; }
+inline int f8364_24(int x) { return x * 24; }
+inline int f8364_25(int x) { return x * 25; }
+inline int f8364_26(int x) { return x * 26; }
+inline int f8364_27(int x) { return x * 27; }
+inline int f8364_28(int x) { return x * 28; }
+inline int f8364_29(int x) { return x * 29; }
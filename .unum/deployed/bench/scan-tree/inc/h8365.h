@@ -0,0 +1,42 @@
+#pragma once
+/* header 8365 */
+#include <vector>
+#include "h8101.h"
+#include "h5666.h"
+#include "h74.h"
+#include "h9145.h"
+#include "h2837.h"
+#ifdef X
+#include "h1193.h"
+#endif
+struct S8365 { int a; const char *s = "x//y"; };
+inline int f8365_0(int x) { return x * 0; }
+inline int f8365_1(int x) { return x * 1; }
+inline int f8365_2(int x) { return x * 2; }
+inline int f8365_3(int x) { return x * 3; }
+inline int f8365_4(int x) { return x * 4; }
+inline int f8365_5(int x) { return x * 5; }
+inline int f8365_6(int x) { return x * 6; }
+inline int f8365_7(int x) { return x * 7; }
+inline int f8365_8(int x) { return x * 8; }
+inline int f8365_9(int x) { return x * 9; }
+inline int f8365_10(int x) { return x * 10; }
+inline int f8365_11(int x) { return x * 11; }
+inline int f8365_12(int x) { return x * 12; }
+inline int f8365_13(int x) { return x * 13; }
+inline int f8365_14(int x) { return x * 14; }
+inline int f8365_15(int x) { return x * 15; }
+inline int f8365_16(int x) { return x * 16; }
+inline int f8365_17(int x) { return x * 17; }
+inline int f8365_18(int x) { return x * 18; }
+inline int f8365_19(int x) { return x * 19; }
+inline int f8365_20(int x) { return x * 20; }
+inline int f8365_21(int x) { return x * 21; }
+inline int f8365_22(int x) { return x * 22; }
+inline int f8365_23(int x) { return x * 23; }
+inline int f8365_24(int x) { return x * 24; }
+inline int f8365_25(int x) { return x * 25; }
+inline int f8365_26(int x) { return x * 26; }
+inline int f8365_27(int x) { return x * 27; }
+inline int f8365_28(int x) { return x * 28; }
+inline int f8365_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8367 */
+#include <vector>
+#include "h8537.h"
+#include "h9140.h"
+#include "h5924.h"
+#include "h3389.h"
+#include "h1216.h"
+#ifdef X
+#include "h3759.h"
+#endif
+struct S8367 { int a; const char *s = "x//y"; };
+inline int f8367_0(int x) { return x * 0; }
+inline int f8367_1(int x) { return x * 1; }
+inline int f8367_2(int x) { return x * 2; }
+inline int f8367_3(int x) { return x * 3; }
+inline int f8367_4(int x) { return x * 4; }
+inline int f8367_5(int x) { return x * 5; }
+inline int f8367_6(int x) { return x * 6; }
+inline int f8367_7(int x) { return x * 7; }
+inline int f8367_8(int x) { return x * 8; }
+inline int f8367_9(int x) { return x * 9; }
+inline int f8367_10(int x) { return x * 10; }
+inline int f8367_11(int x) { return x * 11; }
+inline int f8367_12(int x) { return x * 12; }
+inline int f8367_13(int x) { return x * 13; }
+inline int f8367_14(int x) { return x * 14; }
+inline int f8367_15(int x) { return x * 15; }
+inline int f8367_16(int x) { return x * 16; }
+inline int f8367_17(int x) { return x * 17; }
+inline int f8367_18(int x) { return x * 18; }
+inline int f8367_19(int x) { return x * 19; }
+inline int f8367_20(int x) { return x * 20; }
+inline int f8367_21(int x) { return x * 21; }
+inline int f8367_22(int x) { return x * 22; }
+inline int f8367_23(int x) { return x * 23; }
+inline int f8367_24(int x) { return x * 24; }
+inline int f8367_25(int x) { return x * 25; }
+inline int f8367_26(int x) { return x * 26; }
+inline int f8367_27(int x) { return x * 27; }
+inline int f8367_28(int x) { return x * 28; }
+inline int f8367_29(int x) { return x * 29; }
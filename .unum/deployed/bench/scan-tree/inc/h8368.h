@@ -0,0 +1,42 @@
+#pragma once
+/* header 8368 */
+#include <vector>
+#include "h1009.h"
+#include "h3108.h"
+#include "h5797.h"
+#include "h9219.h"
+#include "h2742.h"
+#ifdef X
+#include "h3912.h"
+#endif
+struct S8368 { int a; const char *s = "x//y"; };
+inline int f8368_0(int x) { return x * 0; }
+inline int f8368_1(int x) { return x * 1; }
+inline int f8368_2(int x) { return x * 2; }
+inline int f8368_3(int x) { return x * 3; }
+inline int f8368_4(int x) { return x * 4; }
+inline int f8368_5(int x) { return x * 5; }
+inline int f8368_6(int x) { return x * 6; }
+inline int f8368_7(int x) { return x * 7; }
+inline int f8368_8(int x) { return x * 8; }
+inline int f8368_9(int x) { return x * 9; }
+inline int f8368_10(int x) { return x * 10; }
+inline int f8368_11(int x) { return x * 11; }
+inline int f8368_12(int x) { return x * 12; }
+inline int f8368_13(int x) { return x * 13; }
+inline int f8368_14(int x) { return x * 14; }
+inline int f8368_15(int x) { return x * 15; }
+inline int f8368_16(int x) { return x * 16; }
+inline int f8368_17(int x) { return x * 17; }
+inline int f8368_18(int x) { return x * 18; }
+inline int f8368_19(int x) { return x * 19; }
+inline int f8368_20(int x) { return x * 20; }
+inline int f8368_21(int x) { return x * 21; }
+inline int f8368_22(int x) { return x * 22; }
+inline int f8368_23(int x) { return x * 23; }
+inline int f8368_24(int x) { return x * 24; }
+inline int f8368_25(int x) { return x * 25; }
+inline int f8368_26(int x) { return x * 26; }
+inline int f8368_27(int x) { return x * 27; }
+inline int f8368_28(int x) { return x * 28; }
+inline int f8368_29(int x) { return x * 29; }
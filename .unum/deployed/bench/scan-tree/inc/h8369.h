@@ -0,0 +1,42 @@
+#pragma once
+/* header 8369 */
+#include <vector>
+#include "h3513.h"
+#include "h8610.h"
+#include "h9841.h"
+#include "h3984.h"
+#include "h9004.h"
+#ifdef X
+#include "h1846.h"
+#endif
+struct S8369 { int a; const char *s = "x//y"; };
+inline int f8369_0(int x) { return x * 0; }
+inline int f8369_1(int x) { return x * 1; }
+inline int f8369_2(int x) { return x * 2; }
+inline int f8369_3(int x) { return x * 3; }
+inline int f8369_4(int x) { return x * 4; }
+inline int f8369_5(int x) { return x * 5; }
+inline int f8369_6(int x) { return x * 6; }
+inline int f8369_7(int x) { return x * 7; }
+inline int f8369_8(int x) { return x * 8; }
+inline int f8369_9(int x) { return x * 9; }
+inline int f8369_10(int x) { return x * 10; }
+inline int f8369_11(int x) { return x * 11; }
+inline int f8369_12(int x) { return x * 12; }
+inline int f8369_13(int x) { return x * 13; }
+inline int f8369_14(int x) { return x * 14; }
+inline int f8369_15(int x) { return x * 15; }
+inline int f8369_16(int x) { return x * 16; }
+inline int f8369_17(int x) { return x * 17; }
+inline int f8369_18(int x) { return x * 18; }
+inline int f8369_19(int x) { return x * 19; }
+inline int f8369_20(int x) { return x * 20; }
+inline int f8369_21(int x) { return x * 21; }
+inline int f8369_22(int x) { return x * 22; }
+inline int f8369_23(int x) { return x * 23; }
+inline int f8369_24(int x) { return x * 24; }
+inline int f8369_25(int x) { return x * 25; }
+inline int f8369_26(int x) { return x * 26; }
+inline int f8369_27(int x) { return x * 27; }
+inline int f8369_28(int x) { return x * 28; }
+inline int f8369_29(int x) { return x * 29; }
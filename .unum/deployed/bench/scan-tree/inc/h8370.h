@@ -0,0 +1,42 @@
+#pragma once
+/* header 8370 */
+#include <vector>
+#include "h7000.h"
+#include "h6751.h"
+#include "h586.h"
+#include "h2029.h"
+#include "h7375.h"
+#ifdef X
+#include "h3628.h"
+#endif
+struct S8370 { int a; const char *s = "x//y"; };
+inline int f8370_0(int x) { return x * 0; }
+inline int f8370_1(int x) { return x * 1; }
+inline int f8370_2(int x) { return x * 2; }
+inline int f8370_3(int x) { return x * 3; }
+inline int f8370_4(int x) { return x * 4; }
+inline int f8370_5(int x) { return x * 5; }
+inline int f8370_6(int x) { return x * 6; }
+inline int f8370_7(int x) { return x * 7; }
+inline int f8370_8(int x) { return x * 8; }
+inline int f8370_9(int x) { return x * 9; }
+inline int f8370_10(int x) { return x * 10; }
+inline int f8370_11(int x) { return x * 11; }
+inline int f8370_12(int x) { return x * 12; }
+inline int f8370_13(int x) { return x * 13; }
+inline int f8370_14(int x) { return x * 14; }
+inline int f8370_15(int x) { return x * 15; }
+inline int f8370_16(int x) { return x * 16; }
+inline int f8370_17(int x) { return x * 17; }
+inline int f8370_18(int x) { return x * 18; }
+inline int f8370_19(int x) { return x * 19; }
+inline int f8370_20(int x) { return x * 20; }
+inline int f8370_21(int x) { return x * 21; }
+inline int f8370_22(int x) { return x * 22; }
+inline int f8370_23(int x) { return x * 23; }
+inline int f8370_24(int x) { return x * 24; }
+inline int f8370_25(int x) { return x * 25; }
+inline int f8370_26(int x) { return x * 26; }
+inline int f8370_27(int x) { return x * 27; }
+inline int f8370_28(int x) { return x * 28; }
+inline int f8370_29(int x) { return x * 29; }
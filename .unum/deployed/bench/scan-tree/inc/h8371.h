@@ -0,0 +1,42 @@
+#pragma once
+/* header 8371 */
+#include <vector>
+#include "h4115.h"
+#include "h7495.h"
+#include "h8456.h"
+#include "h8721.h"
+#include "h4070.h"
+#ifdef X
+#include "h4087.h"
+#endif
+struct S8371 { int a; const char *s = "x//y"; };
+inline int f8371_0(int x) { return x * 0; }
+inline int f8371_1(int x) { return x * 1; }
+inline int f8371_2(int x) { return x * 2; }
+inline int f8371_3(int x) { return x * 3; }
+inline int f8371_4(int x) { return x * 4; }
+inline int f8371_5(int x) { return x * 5; }
+inline int f8371_6(int x) { return x * 6; }
+inline int f8371_7(int x) { return x * 7; }
+inline int f8371_8(int x) { return x * 8; }
+inline int f8371_9(int x) { return x * 9; }
+inline int f8371_10(int x) { return x * 10; }
+inline int f8371_11(int x) { return x * 11; }
+inline int f8371_12(int x) { return x * 12; }
+inline int f8371_13(int x) { return x * 13; }
+inline int f8371_14(int x) { return x * 14; }
+inline int f8371_15(int x) { return x * 15; }
+inline int f8371_16(int x) { return x * 16; }
+inline int f8371_17(int x) { return x * 17; }
+inline int f8371_18(int x) { return x * 18; }
+inline int f8371_19(int x) { return x * 19; }
+inline int f8371_20(int x) { return x * 20; }
+inline int f8371_21(int x) { return x * 21; }
+inline int f8371_22(int x) { return x * 22; }
+inline int f8371_23(int x) { return x * 23; }
+inline int f8371_24(int x) { return x * 24; }
+inline int f8371_25(int x) { return x * 25; }
+inline int f8371_26(int x) { return x * 26; }
+inline int f8371_27(int x) { return x * 27; }
+inline int f8371_28(int x) { return x * 28; }
+inline int f8371_29(int x) { return x * 29; }
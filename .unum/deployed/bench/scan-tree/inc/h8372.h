@@ -0,0 +1,42 @@
+#pragma once
+/* header 8372 */
+#include <vector>
+#include "h1669.h"
+#include "h5245.h"
+#include "h5391.h"
+#include "h5662.h"
+#include "h9028.h"
+#ifdef X
+#include "h3203.h"
+#endif
+struct S8372 { int a; const char *s = "x//y"; };
+inline int f8372_0(int x) { return x * 0; }
+inline int f8372_1(int x) { return x * 1; }
+inline int f8372_2(int x) { return x * 2; }
+inline int f8372_3(int x) { return x * 3; }
+inline int f8372_4(int x) { return x * 4; }
+inline int f8372_5(int x) { return x * 5; }
+inline int f8372_6(int x) { return x * 6; }
+inline int f8372_7(int x) { return x * 7; }
+inline int f8372_8(int x) { return x * 8; }
+inline int f8372_9(int x) { return x * 9; }
+inline int f8372_10(int x) { return x * 10; }
+inline int f8372_11(int x) { return x * 11; }
+inline int f8372_12(int x) { return x * 12; }
+inline int f8372_13(int x) { return x * 13; }
+inline int f8372_14(int x) { return x * 14; }
+inline int f8372_15(int x) { return x * 15; }
+inline int f8372_16(int x) { return x * 16; }
+inline int f8372_17(int x) { return x * 17; }
+inline int f8372_18(int x) { return x * 18; }
+inline int f8372_19(int x) { return x * 19; }
+inline int f8372_20(int x) { return x * 20; }
+inline int f8372_21(int x) { return x * 21; }
+inline int f8372_22(int x) { return x * 22; }
+inline int f8372_23(int x) { return x * 23; }
+inline int f8372_24(int x) { return x * 24; }
+inline int f8372_25(int x) { return x * 25; }
+inline int f8372_26(int x) { return x * 26; }
+inline int f8372_27(int x) { return x * 27; }
+inline int f8372_28(int x) { return x * 28; }
+inline int f8372_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8373 */
+#include <vector>
+#include "h2706.h"
+#include "h2288.h"
+#include "h102.h"
+#include "h2097.h"
+#include "h5018.h"
+#ifdef X
+#include "h3226.h"
+#endif
+struct S8373 { int a; const char *s = "x//y"; };
+inline int f8373_0(int x) { return x * 0; }
+inline int f8373_1(int x) { return x * 1; }
+inline int f8373_2(int x) { return x * 2; }
+inline int f8373_3(int x) { return x * 3; }
+inline int f8373_4(int x) { return x * 4; }
+inline int f8373_5(int x) { return x * 5; }
+inline int f8373_6(int x) { return x * 6; }
+inline int f8373_7(int x) { return x * 7; }
+inline int f8373_8(int x) { return x * 8; }
+inline int f8373_9(int x) { return x * 9; }
+inline int f8373_10(int x) { return x * 10; }
+inline int f8373_11(int x) { return x * 11; }
+inline int f8373_12(int x) { return x * 12; }
+inline int f8373_13(int x) { return x * 13; }
+inline int f8373_14(int x) { return x * 14; }
+inline int f8373_15(int x) { return x * 15; }
+inline int f8373_16(int x) { return x * 16; }
+inline int f8373_17(int x) { return x * 17; }
+inline int f8373_18(int x) { return x * 18; }
+inline int f8373_19(int x) { return x * 19; }
+inline int f8373_20(int x) { return x * 20; }
+inline int f8373_21(int x) { return x * 21; }
+inline int f8373_22(int x) { return x * 22; }
+inline int f8373_23(int x) { return x * 23; }
+inline int f8373_24(int x) { return x * 24; }
+inline int f8373_25(int x) { return x * 25; }
+inline int f8373_26(int x) { return x * 26; }
+inline int f8373_27(int x) { return x * 27; }
+inline int f8373_28(int x) { return x * 28; }
+inline int f8373_29(int x) { return x * 29; }
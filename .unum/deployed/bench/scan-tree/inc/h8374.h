@@ -0,0 +1,42 @@
+#pragma once
+/* header 8374 */
+#include <vector>
+#include "h1991.h"
+#include "h8891.h"
+#include "h2225.h"
+#include "h3938.h"
+#include "h3549.h"
+#ifdef X
+#include "h471.h"
+#endif
+struct S8374 { int a; const char *s = "x//y"; };
+inline int f8374_0(int x) { return x * 0; }
+inline int f8374_1(int x) { return x * 1; }
+inline int f8374_2(int x) { return x * 2; }
+inline int f8374_3(int x) { return x * 3; }
+inline int f8374_4(int x) { return x * 4; }
+inline int f8374_5(int x) { return x * 5; }
+inline int f8374_6(int x) { return x * 6; }
+inline int f8374_7(int x) { return x * 7; }
+inline int f8374_8(int x) { return x * 8; }
+inline int f8374_9(int x) { return x * 9; }
+inline int f8374_10(int x) { return x * 10; }
+inline int f8374_11(int x) { return x * 11; }
+inline int f8374_12(int x) { return x * 12; }
+inline int f8374_13(int x) { return x * 13; }
+inline int f8374_14(int x) { return x * 14; }
+inline int f8374_15(int x) { return x * 15; }
+inline int f8374_16(int x) { return x * 16; }
+inline int f8374_17(int x) { return x * 17; }
+inline int f8374_18(int x) { return x * 18; }
+inline int f8374_19(int x) { return x * 19; }
+inline int f8374_20(int x) { return x * 20; }
+inline int f8374_21(int x) { return x * 21; }
+inline int f8374_22(int x) { return x * 22; }
+inline int f8374_23(int x) { return x * 23; }
+inline int f8374_24(int x) { return x * 24; }
+inline int f8374_25(int x) { return x * 25; }
+inline int f8374_26(int x) { return x * 26; }
+inline int f8374_27(int x) { return x * 27; }
+inline int f8374_28(int x) { return x * 28; }
+inline int f8374_29(int x) { return x * 29; }
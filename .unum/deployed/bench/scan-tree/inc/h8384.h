@@ -0,0 +1,42 @@
+#pragma once
+/* header 8384 */
+#include <vector>
+#include "h2680.h"
+#include "h917.h"
+#include "h6658.h"
+#include "h5034.h"
+#include "h495.h"
+#ifdef X
+#include "h3634.h"
+#endif
+struct S8384 { int a; const char *s = "x//y"; };
+inline int f8384_0(int x) { return x * 0; }
+inline int f8384_1(int x) { return x * 1; }
+inline int f8384_2(int x) { return x * 2; }
+inline int f8384_3(int x) { return x * 3; }
+inline int f8384_4(int x) { return x * 4; }
+inline int f8384_5(int x) { return x * 5; }
+inline int f8384_6(int x) { return x * 6; }
+inline int f8384_7(int x) { return x * 7; }
+inline int f8384_8(int x) { return x * 8; }
+inline int f8384_9(int x) { return x * 9; }
+inline int f8384_10(int x) { return x * 10; }
+inline int f8384_11(int x) { return x * 11; }
+inline int f8384_12(int x) { return x * 12; }
+inline int f8384_13(int x) { return x * 13; }
+inline int f8384_14(int x) { return x * 14; }
+inline int f8384_15(int x) { return x * 15; }
+inline int f8384_16(int x) { return x * 16; }
+inline int f8384_17(int x) { return x * 17; }
+inline int f8384_18(int x) { return x * 18; }
+inline int f8384_19(int x) { return x * 19; }
+inline int f8384_20(int x) { return x * 20; }
+inline int f8384_21(int x) { return x * 21; }
+inline int f8384_22(int x) { return x * 22; }
+inline int f8384_23(int x) { return x * 23; }
+inline int f8384_24(int x) { return x * 24; }
+inline int f8384_25(int x) { return x * 25; }
+inline int f8384_26(int x) { return x * 26; }
+inline int f8384_27(int x) { return x * 27; }
+inline int f8384_28(int x) { return x * 28; }
+inline int f8384_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8385 */
+#include <vector>
+#include "h1479.h"
+#include "h7441.h"
+#include "h8184.h"
+#include "h2515.h"
+#include "h24.h"
+#ifdef X
+#include "h9969.h"
+#endif
+struct S8385 { int a; const char *s = "x//y"; };
+inline int f8385_0(int x) { return x * 0; }
+inline int f8385_1(int x) { return x * 1; }
+inline int f8385_2(int x) { return x * 2; }
+inline int f8385_3(int x) { return x * 3; }
+inline int f8385_4(int x) { return x * 4; }
+inline int f8385_5(int x) { return x * 5; }
+inline int f8385_6(int x) { return x * 6; }
+inline int f8385_7(int x) { return x * 7; }
+inline int f8385_8(int x) { return x * 8; }
+inline int f8385_9(int x) { return x * 9; }
+inline int f8385_10(int x) { return x * 10; }
+inline int f8385_11(int x) { return x * 11; }
+inline int f8385_12(int x) { return x * 12; }
+inline int f8385_13(int x) { return x * 13; }
+inline int f8385_14(int x) { return x * 14; }
+inline int f8385_15(int x) { return x * 15; }
+inline int f8385_16(int x) { return x * 16; }
+inline int f8385_17(int x) { return x * 17; }
+inline int f8385_18(int x) { return x * 18; }
+inline int f8385_19(int x) { return x * 19; }
+inline int f8385_20(int x) { return x * 20; }
+inline int f8385_21(int x) { return x * 21; }
+inline int f8385_22(int x) { return x * 22; }
+inline int f8385_23(int x) { return x * 23; }
+inline int f8385_24(int x) { return x * 24; }
+inline int f8385_25(int x) { return x * 25; }
+inline int f8385_26(int x) { return x * 26; }
+inline int f8385_27(int x) { return x * 27; }
+inline int f8385_28(int x) { return x * 28; }
+inline int f8385_29(int x) { return x * 29; }
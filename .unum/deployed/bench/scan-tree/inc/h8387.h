@@ -0,0 +1,42 @@
+#pragma once
+/* header 8387 */
+#include <vector>
+#include "h6189.h"
+#include "h7686.h"
+#include "h6167.h"
+#include "h3057.h"
+#include "h2906.h"
+#ifdef X
+#include "h1293.h"
+#endif
+struct S8387 { int a; const char *s = "x//y"; };
+inline int f8387_0(int x) { return x * 0; }
+inline int f8387_1(int x) { return x * 1; }
+inline int f8387_2(int x) { return x * 2; }
+inline int f8387_3(int x) { return x * 3; }
+inline int f8387_4(int x) { return x * 4; }
+inline int f8387_5(int x) { return x * 5; }
+inline int f8387_6(int x) { return x * 6; }
+inline int f8387_7(int x) { return x * 7; }
+inline int f8387_8(int x) { return x * 8; }
+inline int f8387_9(int x) { return x * 9; }
+inline int f8387_10(int x) { return x * 10; }
+inline int f8387_11(int x) { return x * 11; }
+inline int f8387_12(int x) { return x * 12; }
+inline int f8387_13(int x) { return x * 13; }
+inline int f8387_14(int x) { return x * 14; }
+inline int f8387_15(int x) { return x * 15; }
+inline int f8387_16(int x) { return x * 16; }
+inline int f8387_17(int x) { return x * 17; }
+inline int f8387_18(int x) { return x * 18; }
+inline int f8387_19(int x) { return x * 19; }
+inline int f8387_20(int x) { return x * 20; }
+inline int f8387_21(int x) { return x * 21; }
+inline int f8387_22(int x) { return x * 22; }
+inline int f8387_23(int x) { return x * 23; }
+inline int f8387_24(int x) { return x * 24; }
+inline int f8387_25(int x) { return x * 25; }
+inline int f8387_26(int x) { return x * 26; }
+inline int f8387_27(int x) { return x * 27; }
+inline int f8387_28(int x) { return x * 28; }
+inline int f8387_29(int x) { return x * 29; }
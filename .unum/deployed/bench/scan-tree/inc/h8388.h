@@ -0,0 +1,42 @@
+#pragma once
+/* header 8388 */
+#include <vector>
+#include "h2809.h"
+#include "h7489.h"
+#include "h7617.h"
+#include "h84.h"
+#include "h4988.h"
+#ifdef X
+#include "h617.h"
+#endif
+struct S8388 { int a; const char *s = "x//y"; };
+inline int f8388_0(int x) { return x * 0; }
+inline int f8388_1(int x) { return x * 1; }
+inline int f8388_2(int x) { return x * 2; }
+inline int f8388_3(int x) { return x * 3; }
+inline int f8388_4(int x) { return x * 4; }
+inline int f8388_5(int x) { return x * 5; }
+inline int f8388_6(int x) { return x * 6; }
+inline int f8388_7(int x) { return x * 7; }
+inline int f8388_8(int x) { return x * 8; }
+inline int f8388_9(int x) { return x * 9; }
+inline int f8388_10(int x) { return x * 10; }
+inline int f8388_11(int x) { return x * 11; }
+inline int f8388_12(int x) { return x * 12; }
+inline int f8388_13(int x) { return x * 13; }
+inline int f8388_14(int x) { return x * 14; }
+inline int f8388_15(int x) { return x * 15; }
+inline int f8388_16(int x) { return x * 16; }
+inline int f8388_17(int x) { return x * 17; }
+inline int f8388_18(int x) { return x * 18; }
+inline int f8388_19(int x) { return x * 19; }
+inline int f8388_20(int x) { return x * 20; }
+inline int f8388_21(int x) { return x * 21; }
+inline int f8388_22(int x) { return x * 22; }
+inline int f8388_23(int x) { return x * 23; }
+inline int f8388_24(int x) { return x * 24; }
+inline int f8388_25(int x) { return x * 25; }
+inline int f8388_26(int x) { return x * 26; }
+inline int f8388_27(int x) { return x * 27; }
+inline int f8388_28(int x) { return x * 28; }
+inline int f8388_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8393 */
+#include <vector>
+#include "h3936.h"
+#include "h3137.h"
+#include "h8696.h"
+#include "h7848.h"
+#include "h2879.h"
+#ifdef X
+#include "h3155.h"
+#endif
+struct S8393 { int a; const char *s = "x//y"; };
+inline int f8393_0(int x) { return x * 0; }
+inline int f8393_1(int x) { return x * 1; }
+inline int f8393_2(int x) { return x * 2; }
+inline int f8393_3(int x) { return x * 3; }
+inline int f8393_4(int x) { return x * 4; }
+inline int f8393_5(int x) { return x * 5; }
+inline int f8393_6(int x) { return x * 6; }
+inline int f8393_7(int x) { return x * 7; }
+inline int f8393_8(int x) { return x * 8; }
+inline int f8393_9(int x) { return x * 9; }
+inline int f8393_10(int x) { return x * 10; }
+inline int f8393_11(int x) { return x * 11; }
+inline int f8393_12(int x) { return x * 12; }
+inline int f8393_13(int x) { return x * 13; }
+inline int f8393_14(int x) { return x * 14; }
+inline int f8393_15(int x) { return x * 15; }
+inline int f8393_16(int x) { return x * 16; }
+inline int f8393_17(int x) { return x * 17; }
+inline int f8393_18(int x) { return x * 18; }
+inline int f8393_19(int x) { return x * 19; }
+inline int f8393_20(int x) { return x * 20; }
+inline int f8393_21(int x) { return x * 21; }
+inline int f8393_22(int x) { return x * 22; }
+inline int f8393_23(int x) { return x * 23; }
+inline int f8393_24(int x) { return x * 24; }
+inline int f8393_25(int x) { return x * 25; }
+inline int f8393_26(int x) { return x * 26; }
+inline int f8393_27(int x) { return x * 27; }
+inline int f8393_28(int x) { return x * 28; }
+inline int f8393_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8394 */
+#include <vector>
+#include "h833.h"
+#include "h429.h"
+#include "h202.h"
+#include "h6050.h"
+#include "h6546.h"
+#ifdef X
+#include "h1383.h"
+#endif
+struct S8394 { int a; const char *s = "x//y"; };
+inline int f8394_0(int x) { return x * 0; }
+inline int f8394_1(int x) { return x * 1; }
+inline int f8394_2(int x) { return x * 2; }
+inline int f8394_3(int x) { return x * 3; }
+inline int f8394_4(int x) { return x * 4; }
+inline int f8394_5(int x) { return x * 5; }
+inline int f8394_6(int x) { return x * 6; }
+inline int f8394_7(int x) { return x * 7; }
+inline int f8394_8(int x) { return x * 8; }
+inline int f8394_9(int x) { return x * 9; }
+inline int f8394_10(int x) { return x * 10; }
+inline int f8394_11(int x) { return x * 11; }
+inline int f8394_12(int x) { return x * 12; }
+inline int f8394_13(int x) { return x * 13; }
+inline int f8394_14(int x) { return x * 14; }
+inline int f8394_15(int x) { return x * 15; }
+inline int f8394_16(int x) { return x * 16; }
+inline int f8394_17(int x) { return x * 17; }
+inline int f8394_18(int x) { return x * 18; }
+inline int f8394_19(int x) { return x * 19; }
+inline int f8394_20(int x) { return x * 20; }
+inline int f8394_21(int x) { return x * 21; }
+inline int f8394_22(int x) { return x * 22; }
+inline int f8394_23(int x) { return x * 23; }
+inline int f8394_24(int x) { return x * 24; }
+inline int f8394_25(int x) { return x * 25; }
+inline int f8394_26(int x) { return x * 26; }
+inline int f8394_27(int x) { return x * 27; }
+inline int f8394_28(int x) { return x * 28; }
+inline int f8394_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8395 */
+#include <vector>
+#include "h5150.h"
+#include "h5815.h"
+#include "h2005.h"
+#include "h5706.h"
+#include "h8242.h"
+#ifdef X
+#include "h7838.h"
+#endif
+struct S8395 { int a; const char *s = "x//y"; };
+inline int f8395_0(int x) { return x * 0; }
+inline int f8395_1(int x) { return x * 1; }
+inline int f8395_2(int x) { return x * 2; }
+inline int f8395_3(int x) { return x * 3; }
+inline int f8395_4(int x) { return x * 4; }
+inline int f8395_5(int x) { return x * 5; }
+inline int f8395_6(int x) { return x * 6; }
+inline int f8395_7(int x) { return x * 7; }
+inline int f8395_8(int x) { return x * 8; }
+inline int f8395_9(int x) { return x * 9; }
+inline int f8395_10(int x) { return x * 10; }
+inline int f8395_11(int x) { return x * 11; }
+inline int f8395_12(int x) { return x * 12; }
+inline int f8395_13(int x) { return x * 13; }
+inline int f8395_14(int x) { return x * 14; }
+inline int f8395_15(int x) { return x * 15; }
+inline int f8395_16(int x) { return x * 16; }
+inline int f8395_17(int x) { return x * 17; }
+inline int f8395_18(int x) { return x * 18; }
+inline int f8395_19(int x) { return x * 19; }
+inline int f8395_20(int x) { return x * 20; }
+inline int f8395_21(int x) { return x * 21; }
+inline int f8395_22(int x) { return x * 22; }
+inline int f8395_23(int x) { return x * 23; }
+inline int f8395_24(int x) { return x * 24; }
+inline int f8395_25(int x) { return x * 25; }
+inline int f8395_26(int x) { return x * 26; }
+inline int f8395_27(int x) { return x * 27; }
+inline int f8395_28(int x) { return x * 28; }
+inline int f8395_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8396 */
+#include <vector>
+#include "h1068.h"
+#include "h4411.h"
+#include "h1875.h"
+#include "h746.h"
+#include "h5938.h"
+#ifdef X
+#include "h1089.h"
+#endif
+struct S8396 { int a; const char *s = "x//y"; };
+inline int f8396_0(int x) { return x * 0; }
+inline int f8396_1(int x) { return x * 1; }
+inline int f8396_2(int x) { return x * 2; }
+inline int f8396_3(int x) { return x * 3; }
+inline int f8396_4(int x) { return x * 4; }
+inline int f8396_5(int x) { return x * 5; }
+inline int f8396_6(int x) { return x * 6; }
+inline int f8396_7(int x) { return x * 7; }
+inline int f8396_8(int x) { return x * 8; }
+inline int f8396_9(int x) { return x * 9; }
+inline int f8396_10(int x) { return x * 10; }
+inline int f8396_11(int x) { return x * 11; }
+inline int f8396_12(int x) { return x * 12; }
+inline int f8396_13(int x) { return x * 13; }
+inline int f8396_14(int x) { return x * 14; }
+inline int f8396_15(int x) { return x * 15; }
+inline int f8396_16(int x) { return x * 16; }
+inline int f8396_17(int x) { return x * 17; }
+inline int f8396_18(int x) { return x * 18; }
+inline int f8396_19(int x) { return x * 19; }
+inline int f8396_20(int x) { return x * 20; }
+inline int f8396_21(int x) { return x * 21; }
+inline int f8396_22(int x) { return x * 22; }
+inline int f8396_23(int x) { return x * 23; }
+inline int f8396_24(int x) { return x * 24; }
+inline int f8396_25(int x) { return x * 25; }
+inline int f8396_26(int x) { return x * 26; }
+inline int f8396_27(int x) { return x * 27; }
+inline int f8396_28(int x) { return x * 28; }
+inline int f8396_29(int x) { return x * 29; }
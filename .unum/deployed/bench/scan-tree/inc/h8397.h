@@ -0,0 +1,42 @@
+#pragma once
+/* header 8397 */
+#include <vector>
+#include "h1196.h"
+#include "h2164.h"
+#include "h5723.h"
+#include "h6852.h"
+#include "h4010.h"
+#ifdef X
+#include "h6857.h"
+#endif
+struct S8397 { int a; const char *s = "x//y"; };
+inline int f8397_0(int x) { return x * 0; }
+inline int f8397_1(int x) { return x * 1; }
+inline int f8397_2(int x) { return x * 2; }
+inline int f8397_3(int x) { return x * 3; }
+inline int f8397_4(int x) { return x * 4; }
+inline int f8397_5(int x) { return x * 5; }
+inline int f8397_6(int x) { return x * 6; }
+inline int f8397_7(int x) { return x * 7; }
+inline int f8397_8(int x) { return x * 8; }
+inline int f8397_9(int x) { return x * 9; }
+inline int f8397_10(int x) { return x * 10; }
+inline int f8397_11(int x) { return x * 11; }
+inline int f8397_12(int x) { return x * 12; }
+inline int f8397_13(int x) { return x * 13; }
+inline int f8397_14(int x) { return x * 14; }
+inline int f8397_15(int x) { return x * 15; }
+inline int f8397_16(int x) { return x * 16; }
+inline int f8397_17(int x) { return x * 17; }
+inline int f8397_18(int x) { return x * 18; }
+inline int f8397_19(int x) { return x * 19; }
+inline int f8397_20(int x) { return x * 20; }
+inline int f8397_21(int x) { return x * 21; }
+inline int f8397_22(int x) { return x * 22; }
+inline int f8397_23(int x) { return x * 23; }
+inline int f8397_24(int x) { return x * 24; }
+inline int f8397_25(int x) { return x * 25; }
+inline int f8397_26(int x) { return x * 26; }
+inline int f8397_27(int x) { return x * 27; }
+inline int f8397_28(int x) { return x * 28; }
+inline int f8397_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8399 */
+#include <vector>
+#include "h9130.h"
+#include "h4706.h"
+#include "h2603.h"
+#include "h1726.h"
+#include "h8322.h"
+#ifdef X
+#include "h5188.h"
+#endif
+struct S8399 { int a; const char *s = "x//y"; };
+inline int f8399_0(int x) { return x * 0; }
+inline int f8399_1(int x) { return x * 1; }
+inline int f8399_2(int x) { return x * 2; }
+inline int f8399_3(int x) { return x * 3; }
+inline int f8399_4(int x) { return x * 4; }
+inline int f8399_5(int x) { return x * 5; }
+inline int f8399_6(int x) { return x * 6; }
+inline int f8399_7(int x) { return x * 7; }
+inline int f8399_8(int x) { return x * 8; }
+inline int f8399_9(int x) { return x * 9; }
+inline int f8399_10(int x) { return x * 10; }
+inline int f8399_11(int x) { return x * 11; }
+inline int f8399_12(int x) { return x * 12; }
+inline int f8399_13(int x) { return x * 13; }
+inline int f8399_14(int x) { return x * 14; }
+inline int f8399_15(int x) { return x * 15; }
+inline int f8399_16(int x) { return x * 16; }
+inline int f8399_17(int x) { return x * 17; }
+inline int f8399_18(int x) { return x * 18; }
+inline int f8399_19(int x) { return x * 19; }
+inline int f8399_20(int x) { return x * 20; }
+inline int f8399_21(int x) { return x * 21; }
+inline int f8399_22(int x) { return x * 22; }
+inline int f8399_23(int x) { return x * 23; }
+inline int f8399_24(int x) { return x * 24; }
+inline int f8399_25(int x) { return x * 25; }
+inline int f8399_26(int x) { return x * 26; }
+inline int f8399_27(int x) { return x * 27; }
+inline int f8399_28(int x) { return x * 28; }
+inline int f8399_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 84 */
+#include <vector>
+#include "h3435.h"
+#include "h1877.h"
+#include "h3978.h"
+#include "h5000.h"
+#include "h8409.h"
+#ifdef X
+#include "h3653.h"
+#endif
+struct S84 { int a; const char *s = "x//y"; };
+inline int f84_0(int x) { return x * 0; }
+inline int f84_1(int x) { return x * 1; }
+inline int f84_2(int x) { return x * 2; }
+inline int f84_3(int x) { return x * 3; }
+inline int f84_4(int x) { return x * 4; }
+inline int f84_5(int x) { return x * 5; }
+inline int f84_6(int x) { return x * 6; }
+inline int f84_7(int x) { return x * 7; }
+inline int f84_8(int x) { return x * 8; }
+inline int f84_9(int x) { return x * 9; }
+inline int f84_10(int x) { return x * 10; }
+inline int f84_11(int x) { return x * 11; }
+inline int f84_12(int x) { return x * 12; }
+inline int f84_13(int x) { return x * 13; }
+inline int f84_14(int x) { return x * 14; }
+inline int f84_15(int x) { return x * 15; }
+inline int f84_16(int x) { return x * 16; }
+inline int f84_17(int x) { return x * 17; }
+inline int f84_18(int x) { return x * 18; }
+inline int f84_19(int x) { return x * 19; }
+inline int f84_20(int x) { return x * 20; }
+inline int f84_21(int x) { return x * 21; }
+inline int f84_22(int x) { return x * 22; }
+inline int f84_23(int x) { return x * 23; }
+inline int f84_24(int x) { return x * 24; }
+inline int f84_25(int x) { return x * 25; }
+inline int f84_26(int x) { return x * 26; }
+inline int f84_27(int x) { return x * 27; }
+inline int f84_28(int x) { return x * 28; }
+inline int f84_29(int x) { return x * 29; }
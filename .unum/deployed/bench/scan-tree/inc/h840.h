@@ -0,0 +1,42 @@
+#pragma once
+/* header 840 */
+#include <vector>
+#include "h907.h"
+#include "h9479.h"
+#include "h5733.h"
+#include "h2125.h"
+#include "h7652.h"
+#ifdef X
+#include "h9384.h"
+#endif
+struct S840 { int a; const char *s = "x//y"; };
+inline int f840_0(int x) { return x * 0; }
+inline int f840_1(int x) { return x * 1; }
+inline int f840_2(int x) { return x * 2; }
+inline int f840_3(int x) { return x * 3; }
+inline int f840_4(int x) { return x * 4; }
+inline int f840_5(int x) { return x * 5; }
+inline int f840_6(int x) { return x * 6; }
+inline int f840_7(int x) { return x * 7; }
+inline int f840_8(int x) { return x * 8; }
+inline int f840_9(int x) { return x * 9; }
+inline int f840_10(int x) { return x * 10; }
+inline int f840_11(int x) { return x * 11; }
+inline int f840_12(int x) { return x * 12; }
+inline int f840_13(int x) { return x * 13; }
+inline int f840_14(int x) { return x * 14; }
+inline int f840_15(int x) { return x * 15; }
+inline int f840_16(int x) { return x * 16; }
+inline int f840_17(int x) { return x * 17; }
+inline int f840_18(int x) { return x * 18; }
+inline int f840_19(int x) { return x * 19; }
+inline int f840_20(int x) { return x * 20; }
+inline int f840_21(int x) { return x * 21; }
+inline int f840_22(int x) { return x * 22; }
+inline int f840_23(int x) { return x * 23; }
+inline int f840_24(int x) { return x * 24; }
+inline int f840_25(int x) { return x * 25; }
+inline int f840_26(int x) { return x * 26; }
+inline int f840_27(int x) { return x * 27; }
+inline int f840_28(int x) { return x * 28; }
+inline int f840_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8400 */
+#include <vector>
+#include "h1134.h"
+#include "h36.h"
+#include "h9555.h"
+#include "h1097.h"
+#include "h6952.h"
+#ifdef X
+#include "h2377.h"
+#endif
+struct S8400 { int a; const char *s = "x//y"; };
+inline int f8400_0(int x) { return x * 0; }
+inline int f8400_1(int x) { return x * 1; }
+inline int f8400_2(int x) { return x * 2; }
+inline int f8400_3(int x) { return x * 3; }
+inline int f8400_4(int x) { return x * 4; }
+inline int f8400_5(int x) { return x * 5; }
+inline int f8400_6(int x) { return x * 6; }
+inline int f8400_7(int x) { return x * 7; }
+inline int f8400_8(int x) { return x * 8; }
+inline int f8400_9(int x) { return x * 9; }
+inline int f8400_10(int x) { return x * 10; }
+inline int f8400_11(int x) { return x * 11; }
+inline int f8400_12(int x) { return x * 12; }
+inline int f8400_13(int x) { return x * 13; }
+inline int f8400_14(int x) { return x * 14; }
+inline int f8400_15(int x) { return x * 15; }
+inline int f8400_16(int x) { return x * 16; }
+inline int f8400_17(int x) { return x * 17; }
+inline int f8400_18(int x) { return x * 18; }
+inline int f8400_19(int x) { return x * 19; }
+inline int f8400_20(int x) { return x * 20; }
+inline int f8400_21(int x) { return x * 21; }
+inline int f8400_22(int x) { return x * 22; }
+inline int f8400_23(int x) { return x * 23; }
+inline int f8400_24(int x) { return x * 24; }
+inline int f8400_25(int x) { return x * 25; }
+inline int f8400_26(int x) { return x * 26; }
+inline int f8400_27(int x) { return x * 27; }
+inline int f8400_28(int x) { return x * 28; }
+inline int f8400_29(int x) { return x * 29; }
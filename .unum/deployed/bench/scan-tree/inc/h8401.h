@@ -0,0 +1,42 @@
+#pragma once
+/* header 8401 */
+#include <vector>
+#include "h1255.h"
+#include "h173.h"
+#include "h6376.h"
+#include "h7896.h"
+#include "h1084.h"
+#ifdef X
+#include "h5035.h"
+#endif
+struct S8401 { int a; const char *s = "x//y"; };
+inline int f8401_0(int x) { return x * 0; }
+inline int f8401_1(int x) { return x * 1; }
+inline int f8401_2(int x) { return x * 2; }
+inline int f8401_3(int x) { return x * 3; }
+inline int f8401_4(int x) { return x * 4; }
+inline int f8401_5(int x) { return x * 5; }
+inline int f8401_6(int x) { return x * 6; }
+inline int f8401_7(int x) { return x * 7; }
+inline int f8401_8(int x) { return x * 8; }
+inline int f8401_9(int x) { return x * 9; }
+inline int f8401_10(int x) { return x * 10; }
+inline int f8401_11(int x) { return x * 11; }
+inline int f8401_12(int x) { return x * 12; }
+inline int f8401_13(int x) { return x * 13; }
+inline int f8401_14(int x) { return x * 14; }
+inline int f8401_15(int x) { return x * 15; }
+inline int f8401_16(int x) { return x * 16; }
+inline int f8401_17(int x) { return x * 17; }
+inline int f8401_18(int x) { return x * 18; }
+inline int f8401_19(int x) { return x * 19; }
+inline int f8401_20(int x) { return x * 20; }
+inline int f8401_21(int x) { return x * 21; }
+inline int f8401_22(int x) { return x * 22; }
+inline int f8401_23(int x) { return x * 23; }
+inline int f8401_24(int x) { return x * 24; }
+inline int f8401_25(int x) { return x * 25; }
+inline int f8401_26(int x) { return x * 26; }
+inline int f8401_27(int x) { return x * 27; }
+inline int f8401_28(int x) { return x * 28; }
+inline int f8401_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8405 */
+#include <vector>
+#include "h2932.h"
+#include "h6299.h"
+#include "h295.h"
+#include "h6318.h"
+#include "h6522.h"
+#ifdef X
+#include "h1056.h"
+#endif
+struct S8405 { int a; const char *s = "x//y"; };
+inline int f8405_0(int x) { return x * 0; }
+inline int f8405_1(int x) { return x * 1; }
+inline int f8405_2(int x) { return x * 2; }
+inline int f8405_3(int x) { return x * 3; }
+inline int f8405_4(int x) { return x * 4; }
+inline int f8405_5(int x) { return x * 5; }
+inline int f8405_6(int x) { return x * 6; }
+inline int f8405_7(int x) { return x * 7; }
+inline int f8405_8(int x) { return x * 8; }
+inline int f8405_9(int x) { return x * 9; }
+inline int f8405_10(int x) { return x * 10; }
+inline int f8405_11(int x) { return x * 11; }
+inline int f8405_12(int x) { return x * 12; }
+inline int f8405_13(int x) { return x * 13; }
+inline int f8405_14(int x) { return x * 14; }
+inline int f8405_15(int x) { return x * 15; }
+inline int f8405_16(int x) { return x * 16; }
+inline int f8405_17(int x) { return x * 17; }
+inline int f8405_18(int x) { return x * 18; }
+inline int f8405_19(int x) { return x * 19; }
+inline int f8405_20(int x) { return x * 20; }
+inline int f8405_21(int x) { return x * 21; }
+inline int f8405_22(int x) { return x * 22; }
+inline int f8405_23(int x) { return x * 23; }
+inline int f8405_24(int x) { return x * 24; }
+inline int f8405_25(int x) { return x * 25; }
+inline int f8405_26(int x) { return x * 26; }
+inline int f8405_27(int x) { return x * 27; }
+inline int f8405_28(int x) { return x * 28; }
+inline int f8405_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8409 */
+#include <vector>
+#include "h1831.h"
+#include "h774.h"
+#include "h4195.h"
+#include "h564.h"
+#include "h4101.h"
+#ifdef X
+#include "h997.h"
+#endif
+struct S8409 { int a; const char *s = "x//y"; };
+inline int f8409_0(int x) { return x * 0; }
+inline int f8409_1(int x) { return x * 1; }
+inline int f8409_2(int x) { return x * 2; }
+inline int f8409_3(int x) { return x * 3; }
+inline int f8409_4(int x) { return x * 4; }
+inline int f8409_5(int x) { return x * 5; }
+inline int f8409_6(int x) { return x * 6; }
+inline int f8409_7(int x) { return x * 7; }
+inline int f8409_8(int x) { return x * 8; }
+inline int f8409_9(int x) { return x * 9; }
+inline int f8409_10(int x) { return x * 10; }
+inline int f8409_11(int x) { return x * 11; }
+inline int f8409_12(int x) { return x * 12; }
+inline int f8409_13(int x) { return x * 13; }
+inline int f8409_14(int x) { return x * 14; }
+inline int f8409_15(int x) { return x * 15; }
+inline int f8409_16(int x) { return x * 16; }
+inline int f8409_17(int x) { return x * 17; }
+inline int f8409_18(int x) { return x * 18; }
+inline int f8409_19(int x) { return x * 19; }
+inline int f8409_20(int x) { return x * 20; }
+inline int f8409_21(int x) { return x * 21; }
+inline int f8409_22(int x) { return x * 22; }
+inline int f8409_23(int x) { return x * 23; }
+inline int f8409_24(int x) { return x * 24; }
+inline int f8409_25(int x) { return x * 25; }
+inline int f8409_26(int x) { return x * 26; }
+inline int f8409_27(int x) { return x * 27; }
+inline int f8409_28(int x) { return x * 28; }
+inline int f8409_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 841 */
+#include <vector>
+#include "h659.h"
+#include "h369.h"
+#include "h9579.h"
+#include "h7319.h"
+#include "h8264.h"
+#ifdef X
+#include "h2911.h"
+#endif
+struct S841 { int a; const char *s = "x//y"; };
+inline int f841_0(int x) { return x * 0; }
+inline int f841_1(int x) { return x * 1; }
+inline int f841_2(int x) { return x * 2; }
+inline int f841_3(int x) { return x * 3; }
+inline int f841_4(int x) { return x * 4; }
+inline int f841_5(int x) { return x * 5; }
+inline int f841_6(int x) { return x * 6; }
+inline int f841_7(int x) { return x * 7; }
+inline int f841_8(int x) { return x * 8; }
+inline int f841_9(int x) { return x * 9; }
+inline int f841_10(int x) { return x * 10; }
+inline int f841_11(int x) { return x * 11; }
+inline int f841_12(int x) { return x * 12; }
+inline int f841_13(int x) { return x * 13; }
+inline int f841_14(int x) { return x * 14; }
+inline int f841_15(int x) { return x * 15; }
+inline int f841_16(int x) { return x * 16; }
+inline int f841_17(int x) { return x * 17; }
+inline int f841_18(int x) { return x * 18; }
+inline int f841_19(int x) { return x * 19; }
+inline int f841_20(int x) { return x * 20; }
+inline int f841_21(int x) { return x * 21; }
+inline int f841_22(int x) { return x * 22; }
+inline int f841_23(int x) { return x * 23; }
+inline int f841_24(int x) { return x * 24; }
+inline int f841_25(int x) { return x * 25; }
+inline int f841_26(int x) { return x * 26; }
+inline int f841_27(int x) { return x * 27; }
+inline int f841_28(int x) { return x * 28; }
+inline int f841_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8410 */
+#include <vector>
+#include "h4288.h"
+#include "h6549.h"
+#include "h5613.h"
+#include "h8363.h"
+#include "h9508.h"
+#ifdef X
+#include "h9987.h"
+#endif
+struct S8410 { int a; const char *s = "x//y"; };
+inline int f8410_0(int x) { return x * 0; }
+inline int f8410_1(int x) { return x * 1; }
+inline int f8410_2(int x) { return x * 2; }
+inline int f8410_3(int x) { return x * 3; }
+inline int f8410_4(int x) { return x * 4; }
+inline int f8410_5(int x) { return x * 5; }
+inline int f8410_6(int x) { return x * 6; }
+inline int f8410_7(int x) { return x * 7; }
+inline int f8410_8(int x) { return x * 8; }
+inline int f8410_9(int x) { return x * 9; }
+inline int f8410_10(int x) { return x * 10; }
+inline int f8410_11(int x) { return x * 11; }
+inline int f8410_12(int x) { return x * 12; }
+inline int f8410_13(int x) { return x * 13; }
+inline int f8410_14(int x) { return x * 14; }
+inline int f8410_15(int x) { return x * 15; }
+inline int f8410_16(int x) { return x * 16; }
+inline int f8410_17(int x) { return x * 17; }
+inline int f8410_18(int x) { return x * 18; }
+inline int f8410_19(int x) { return x * 19; }
+inline int f8410_20(int x) { return x * 20; }
+inline int f8410_21(int x) { return x * 21; }
+inline int f8410_22(int x) { return x * 22; }
+inline int f8410_23(int x) { return x * 23; }
+inline int f8410_24(int x) { return x * 24; }
+inline int f8410_25(int x) { return x * 25; }
+inline int f8410_26(int x) { return x * 26; }
+inline int f8410_27(int x) { return x * 27; }
+inline int f8410_28(int x) { return x * 28; }
+inline int f8410_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8412 */
+#include <vector>
+#include "h5578.h"
+#include "h3270.h"
+#include "h3890.h"
+#include "h1656.h"
+#include "h3451.h"
+#ifdef X
+#include "h4563.h"
+#endif
+struct S8412 { int a; const char *s = "x//y"; };
+inline int f8412_0(int x) { return x * 0; }
+inline int f8412_1(int x) { return x * 1; }
+inline int f8412_2(int x) { return x * 2; }
+inline int f8412_3(int x) { return x * 3; }
+inline int f8412_4(int x) { return x * 4; }
+inline int f8412_5(int x) { return x * 5; }
+inline int f8412_6(int x) { return x * 6; }
+inline int f8412_7(int x) { return x * 7; }
+inline int f8412_8(int x) { return x * 8; }
+inline int f8412_9(int x) { return x * 9; }
+inline int f8412_10(int x) { return x * 10; }
+inline int f8412_11(int x) { return x * 11; }
+inline int f8412_12(int x) { return x * 12; }
+inline int f8412_13(int x) { return x * 13; }
+inline int f8412_14(int x) { return x * 14; }
+inline int f8412_15(int x) { return x * 15; }
+inline int f8412_16(int x) { return x * 16; }
+inline int f8412_17(int x) { return x * 17; }
+inline int f8412_18(int x) { return x * 18; }
+inline int f8412_19(int x) { return x * 19; }
+inline int f8412_20(int x) { return x * 20; }
+inline int f8412_21(int x) { return x * 21; }
+inline int f8412_22(int x) { return x * 22; }
+inline int f8412_23(int x) { return x * 23; }
+inline int f8412_24(int x) { return x * 24; }
+inline int f8412_25(int x) { return x * 25; }
+inline int f8412_26(int x) { return x * 26; }
+inline int f8412_27(int x) { return x * 27; }
+inline int f8412_28(int x) { return x * 28; }
+inline int f8412_29(int x) { return x * 29; }
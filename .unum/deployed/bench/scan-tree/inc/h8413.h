@@ -0,0 +1,42 @@
+#pragma once
+/* header 8413 */
+#include <vector>
+#include "h5806.h"
+#include "h6244.h"
+#include "h9266.h"
+#include "h5401.h"
+#include "h6051.h"
+#ifdef X
+#include "h6296.h"
+#endif
+struct S8413 { int a; const char *s = "x//y"; };
+inline int f8413_0(int x) { return x * 0; }
+inline int f8413_1(int x) { return x * 1; }
+inline int f8413_2(int x) { return x * 2; }
+inline int f8413_3(int x) { return x * 3; }
+inline int f8413_4(int x) { return x * 4; }
+inline int f8413_5(int x) { return x * 5; }
+inline int f8413_6(int x) { return x * 6; }
+inline int f8413_7(int x) { return x * 7; }
+inline int f8413_8(int x) { return x * 8; }
+inline int f8413_9(int x) { return x * 9; }
+inline int f8413_10(int x) { return x * 10; }
+inline int f8413_11(int x) { return x * 11; }
+inline int f8413_12(int x) { return x * 12; }
+inline int f8413_13(int x) { return x * 13; }
+inline int f8413_14(int x) { return x * 14; }
+inline int f8413_15(int x) { return x * 15; }
+inline int f8413_16(int x) { return x * 16; }
+inline int f8413_17(int x) { return x * 17; }
+inline int f8413_18(int x) { return x * 18; }
+inline int f8413_19(int x) { return x * 19; }
+inline int f8413_20(int x) { return x * 20; }
+inline int f8413_21(int x) { return x * 21; }
+inline int f8413_22(int x) { return x * 22; }
+inline int f8413_23(int x) { return x * 23; }
+inline int f8413_24(int x) { return x * 24; }
+inline int f8413_25(int x) { return x * 25; }
+inline int f8413_26(int x) { return x * 26; }
+inline int f8413_27(int x) { return x * 27; }
+inline int f8413_28(int x) { return x * 28; }
+inline int f8413_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8414 */
+#include <vector>
+#include "h463.h"
+#include "h9806.h"
+#include "h8496.h"
+#include "h3296.h"
+#include "h6572.h"
+#ifdef X
+#include "h2528.h"
+#endif
+struct S8414 { int a; const char *s = "x//y"; };
+inline int f8414_0(int x) { return x * 0; }
+inline int f8414_1(int x) { return x * 1; }
+inline int f8414_2(int x) { return x * 2; }
+inline int f8414_3(int x) { return x * 3; }
+inline int f8414_4(int x) { return x * 4; }
+inline int f8414_5(int x) { return x * 5; }
+inline int f8414_6(int x) { return x * 6; }
+inline int f8414_7(int x) { return x * 7; }
+inline int f8414_8(int x) { return x * 8; }
+inline int f8414_9(int x) { return x * 9; }
+inline int f8414_10(int x) { return x * 10; }
+inline int f8414_11(int x) { return x * 11; }
+inline int f8414_12(int x) { return x * 12; }
+inline int f8414_13(int x) { return x * 13; }
+inline int f8414_14(int x) { return x * 14; }
+inline int f8414_15(int x) { return x * 15; }
+inline int f8414_16(int x) { return x * 16; }
+inline int f8414_17(int x) { return x * 17; }
+inline int f8414_18(int x) { return x * 18; }
+inline int f8414_19(int x) { return x * 19; }
+inline int f8414_20(int x) { return x * 20; }
+inline int f8414_21(int x) { return x * 21; }
+inline int f8414_22(int x) { return x * 22; }
+inline int f8414_23(int x) { return x * 23; }
+inline int f8414_24(int x) { return x * 24; }
+inline int f8414_25(int x) { return x * 25; }
+inline int f8414_26(int x) { return x * 26; }
+inline int f8414_27(int x) { return x * 27; }
+inline int f8414_28(int x) { return x * 28; }
+inline int f8414_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8417 */
+#include <vector>
+#include "h1418.h"
+#include "h4447.h"
+#include "h1742.h"
+#include "h3857.h"
+#include "h4185.h"
+#ifdef X
+#include "h6484.h"
+#endif
+struct S8417 { int a; const char *s = "x//y"; };
+inline int f8417_0(int x) { return x * 0; }
+inline int f8417_1(int x) { return x * 1; }
+inline int f8417_2(int x) { return x * 2; }
+inline int f8417_3(int x) { return x * 3; }
+inline int f8417_4(int x) { return x * 4; }
+inline int f8417_5(int x) { return x * 5; }
+inline int f8417_6(int x) { return x * 6; }
+inline int f8417_7(int x) { return x * 7; }
+inline int f8417_8(int x) { return x * 8; }
+inline int f8417_9(int x) { return x * 9; }
+inline int f8417_10(int x) { return x * 10; }
+inline int f8417_11(int x) { return x * 11; }
+inline int f8417_12(int x) { return x * 12; }
+inline int f8417_13(int x) { return x * 13; }
+inline int f8417_14(int x) { return x * 14; }
+inline int f8417_15(int x) { return x * 15; }
+inline int f8417_16(int x) { return x * 16; }
+inline int f8417_17(int x) { return x * 17; }
+inline int f8417_18(int x) { return x * 18; }
+inline int f8417_19(int x) { return x * 19; }
+inline int f8417_20(int x) { return x * 20; }
+inline int f8417_21(int x) { return x * 21; }
+inline int f8417_22(int x) { return x * 22; }
+inline int f8417_23(int x) { return x * 23; }
+inline int f8417_24(int x) { return x * 24; }
+inline int f8417_25(int x) { return x * 25; }
+inline int f8417_26(int x) { return x * 26; }
+inline int f8417_27(int x) { return x * 27; }
+inline int f8417_28(int x) { return x * 28; }
+inline int f8417_29(int x) { return x * 29; }
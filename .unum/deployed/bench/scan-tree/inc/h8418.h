@@ -0,0 +1,42 @@
+#pragma once
+/* header 8418 */
+#include <vector>
+#include "h2647.h"
+#include "h6926.h"
+#include "h5146.h"
+#include "h6834.h"
+#include "h2586.h"
+#ifdef X
+#include "h8948.h"
+#endif
+struct S8418 { int a; const char *s = "x//y"; };
+inline int f8418_0(int x) { return x * 0; }
+inline int f8418_1(int x) { return x * 1; }
+inline int f8418_2(int x) { return x * 2; }
+inline int f8418_3(int x) { return x * 3; }
+inline int f8418_4(int x) { return x * 4; }
+inline int f8418_5(int x) { return x * 5; }
+inline int f8418_6(int x) { return x * 6; }
+inline int f8418_7(int x) { return x * 7; }
+inline int f8418_8(int x) { return x * 8; }
+inline int f8418_9(int x) { return x * 9; }
+inline int f8418_10(int x) { return x * 10; }
+inline int f8418_11(int x) { return x * 11; }
+inline int f8418_12(int x) { return x * 12; }
+inline int f8418_13(int x) { return x * 13; }
+inline int f8418_14(int x) { return x * 14; }
+inline int f8418_15(int x) { return x * 15; }
+inline int f8418_16(int x) { return x * 16; }
+inline int f8418_17(int x) { return x * 17; }
+inline int f8418_18(int x) { return x * 18; }
+inline int f8418_19(int x) { return x * 19; }
+inline int f8418_20(int x) { return x * 20; }
+inline int f8418_21(int x) { return x * 21; }
+inline int f8418_22(int x) { return x * 22; }
+inline int f8418_23(int x) { return x * 23; }
+inline int f8418_24(int x) { return x * 24; }
+inline int f8418_25(int x) { return x * 25; }
+inline int f8418_26(int x) { return x * 26; }
+inline int f8418_27(int x) { return x * 27; }
+inline int f8418_28(int x) { return x * 28; }
+inline int f8418_29(int x) { return x * 29; }
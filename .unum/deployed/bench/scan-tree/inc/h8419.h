@@ -0,0 +1,42 @@
+#pragma once
+/* header 8419 */
+#include <vector>
+#include "h4586.h"
+#include "h4117.h"
+#include "h3708.h"
+#include "h3363.h"
+#include "h4081.h"
+#ifdef X
+#include "h4055.h"
+#endif
+struct S8419 { int a; const char *s = "x//y"; };
+inline int f8419_0(int x) { return x * 0; }
+inline int f8419_1(int x) { return x * 1; }
+inline int f8419_2(int x) { return x * 2; }
+inline int f8419_3(int x) { return x * 3; }
+inline int f8419_4(int x) { return x * 4; }
+inline int f8419_5(int x) { return x * 5; }
+inline int f8419_6(int x) { return x * 6; }
+inline int f8419_7(int x) { return x * 7; }
+inline int f8419_8(int x) { return x * 8; }
+inline int f8419_9(int x) { return x * 9; }
+inline int f8419_10(int x) { return x * 10; }
+inline int f8419_11(int x) { return x * 11; }
+inline int f8419_12(int x) { return x * 12; }
+inline int f8419_13(int x) { return x * 13; }
+inline int f8419_14(int x) { return x * 14; }
+inline int f8419_15(int x) { return x * 15; }
+inline int f8419_16(int x) { return x * 16; }
+inline int f8419_17(int x) { return x * 17; }
+inline int f8419_18(int x) { return x * 18; }
+inline int f8419_19(int x) { return x * 19; }
+inline int f8419_20(int x) { return x * 20; }
+inline int f8419_21(int x) { return x * 21; }
+inline int f8419_22(int x) { return x * 22; }
+inline int f8419_23(int x) { return x * 23; }
+inline int f8419_24(int x) { return x * 24; }
+inline int f8419_25(int x) { return x * 25; }
+inline int f8419_26(int x) { return x * 26; }
+inline int f8419_27(int x) { return x * 27; }
+inline int f8419_28(int x) { return x * 28; }
+inline int f8419_29(int x) { return x * 29; }
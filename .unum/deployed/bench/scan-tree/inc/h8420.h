@@ -0,0 +1,42 @@
+#pragma once
+/* header 8420 */
+#include <vector>
+#include "h2871.h"
+#include "h5079.h"
+#include "h823.h"
+#include "h9668.h"
+#include "h7801.h"
+#ifdef X
+#include "h6353.h"
+#endif
+struct S8420 { int a; const char *s = "x//y"; };
+inline int f8420_0(int x) { return x * 0; }
+inline int f8420_1(int x) { return x * 1; }
+inline int f8420_2(int x) { return x * 2; }
+inline int f8420_3(int x) { return x * 3; }
+inline int f8420_4(int x) { return x * 4; }
+inline int f8420_5(int x) { return x * 5; }
+inline int f8420_6(int x) { return x * 6; }
+inline int f8420_7(int x) { return x * 7; }
+inline int f8420_8(int x) { return x * 8; }
+inline int f8420_9(int x) { return x * 9; }
+inline int f8420_10(int x) { return x * 10; }
+inline int f8420_11(int x) { return x * 11; }
+inline int f8420_12(int x) { return x * 12; }
+inline int f8420_13(int x) { return x * 13; }
+inline int f8420_14(int x) { return x * 14; }
+inline int f8420_15(int x) { return x * 15; }
+inline int f8420_16(int x) { return x * 16; }
+inline int f8420_17(int x) { return x * 17; }
+inline int f8420_18(int x) { return x * 18; }
+inline int f8420_19(int x) { return x * 19; }
+inline int f8420_20(int x) { return x * 20; }
+inline int f8420_21(int x) { return x * 21; }
+inline int f8420_22(int x) { return x * 22; }
+inline int f8420_23(int x) { return x * 23; }
+inline int f8420_24(int x) { return x * 24; }
+inline int f8420_25(int x) { return x * 25; }
+inline int f8420_26(int x) { return x * 26; }
+inline int f8420_27(int x) { return x * 27; }
+inline int f8420_28(int x) { return x * 28; }
+inline int f8420_29(int x) { return x * 29; }
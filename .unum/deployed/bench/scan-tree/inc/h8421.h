@@ -0,0 +1,42 @@
+#pragma once
+/* header 8421 */
+#include <vector>
+#include "h3418.h"
+#include "h3059.h"
+#include "h1984.h"
+#include "h680.h"
+#include "h4843.h"
+#ifdef X
+#include "h6004.h"
+#endif
+struct S8421 { int a; const char *s = "x//y"; };
+inline int f8421_0(int x) { return x * 0; }
+inline int f8421_1(int x) { return x * 1; }
+inline int f8421_2(int x) { return x * 2; }
+inline int f8421_3(int x) { return x * 3; }
+inline int f8421_4(int x) { return x * 4; }
+inline int f8421_5(int x) { return x * 5; }
+inline int f8421_6(int x) { return x * 6; }
+inline int f8421_7(int x) { return x * 7; }
+inline int f8421_8(int x) { return x * 8; }
+inline int f8421_9(int x) { return x * 9; }
+inline int f8421_10(int x) { return x * 10; }
+inline int f8421_11(int x) { return x * 11; }
+inline int f8421_12(int x) { return x * 12; }
+inline int f8421_13(int x) { return x * 13; }
+inline int f8421_14(int x) { return x * 14; }
+inline int f8421_15(int x) { return x * 15; }
+inline int f8421_16(int x) { return x * 16; }
+inline int f8421_17(int x) { return x * 17; }
+inline int f8421_18(int x) { return x * 18; }
+inline int f8421_19(int x) { return x * 19; }
+inline int f8421_20(int x) { return x * 20; }
+inline int f8421_21(int x) { return x * 21; }
+inline int f8421_22(int x) { return x * 22; }
+inline int f8421_23(int x) { return x * 23; }
+inline int f8421_24(int x) { return x * 24; }
+inline int f8421_25(int x) { return x * 25; }
+inline int f8421_26(int x) { return x * 26; }
+inline int f8421_27(int x) { return x * 27; }
+inline int f8421_28(int x) { return x * 28; }
+inline int f8421_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8422 */
+#include <vector>
+#include "h773.h"
+#include "h7773.h"
+#include "h6392.h"
+#include "h9575.h"
+#include "h3054.h"
+#ifdef X
+#include "h9831.h"
+#endif
+struct S8422 { int a; const char *s = "x//y"; };
+inline int f8422_0(int x) { return x * 0; }
+inline int f8422_1(int x) { return x * 1; }
+inline int f8422_2(int x) { return x * 2; }
+inline int f8422_3(int x) { return x * 3; }
+inline int f8422_4(int x) { return x * 4; }
+inline int f8422_5(int x) { return x * 5; }
+inline int f8422_6(int x) { return x * 6; }
+inline int f8422_7(int x) { return x * 7; }
+inline int f8422_8(int x) { return x * 8; }
+inline int f8422_9(int x) { return x * 9; }
+inline int f8422_10(int x) { return x * 10; }
+inline int f8422_11(int x) { return x * 11; }
+inline int f8422_12(int x) { return x * 12; }
+inline int f8422_13(int x) { return x * 13; }
+inline int f8422_14(int x) { return x * 14; }
+inline int f8422_15(int x) { return x * 15; }
+inline int f8422_16(int x) { return x * 16; }
+inline int f8422_17(int x) { return x * 17; }
+inline int f8422_18(int x) { return x * 18; }
+inline int f8422_19(int x) { return x * 19; }
+inline int f8422_20(int x) { return x * 20; }
+inline int f8422_21(int x) { return x * 21; }
+inline int f8422_22(int x) { return x * 22; }
+inline int f8422_23(int x) { return x * 23; }
+inline int f8422_24(int x) { return x * 24; }
+inline int f8422_25(int x) { return x * 25; }
+inline int f8422_26(int x) { return x * 26; }
+inline int f8422_27(int x) { return x * 27; }
+inline int f8422_28(int x) { return x * 28; }
+inline int f8422_29(int x) { return x * 29; }
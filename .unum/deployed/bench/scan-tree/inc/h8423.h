@@ -0,0 +1,42 @@
+#pragma once
+/* header 8423 */
+#include <vector>
+#include "h3147.h"
+#include "h7841.h"
+#include "h6106.h"
+#include "h5917.h"
+#include "h823.h"
+#ifdef X
+#include "h1452.h"
+#endif
+struct S8423 { int a; const char *s = "x//y"; };
+inline int f8423_0(int x) { return x * 0; }
+inline int f8423_1(int x) { return x * 1; }
+inline int f8423_2(int x) { return x * 2; }
+inline int f8423_3(int x) { return x * 3; }
+inline int f8423_4(int x) { return x * 4; }
+inline int f8423_5(int x) { return x * 5; }
+inline int f8423_6(int x) { return x * 6; }
+inline int f8423_7(int x) { return x * 7; }
+inline int f8423_8(int x) { return x * 8; }
+inline int f8423_9(int x) { return x * 9; }
+inline int f8423_10(int x) { return x * 10; }
+inline int f8423_11(int x) { return x * 11; }
+inline int f8423_12(int x) { return x * 12; }
+inline int f8423_13(int x) { return x * 13; }
+inline int f8423_14(int x) { return x * 14; }
+inline int f8423_15(int x) { return x * 15; }
+inline int f8423_16(int x) { return x * 16; }
+inline int f8423_17(int x) { return x * 17; }
+inline int f8423_18(int x) { return x * 18; }
+inline int f8423_19(int x) { return x * 19; }
+inline int f8423_20(int x) { return x * 20; }
+inline int f8423_21(int x) { return x * 21; }
+inline int f8423_22(int x) { return x * 22; }
+inline int f8423_23(int x) { return x * 23; }
+inline int f8423_24(int x) { return x * 24; }
+inline int f8423_25(int x) { return x * 25; }
+inline int f8423_26(int x) { return x * 26; }
+inline int f8423_27(int x) { return x * 27; }
+inline int f8423_28(int x) { return x * 28; }
+inline int f8423_29(int x) { return x * 29; }
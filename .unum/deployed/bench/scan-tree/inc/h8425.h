@@ -0,0 +1,42 @@
+#pragma once
+/* header 8425 */
+#include <vector>
+#include "h4861.h"
+#include "h2527.h"
+#include "h4647.h"
+#include "h9705.h"
+#include "h4162.h"
+#ifdef X
+#include "h1720.h"
+#endif
+struct S8425 { int a; const char *s = "x//y"; };
+inline int f8425_0(int x) { return x * 0; }
+inline int f8425_1(int x) { return x * 1; }
+inline int f8425_2(int x) { return x * 2; }
+inline int f8425_3(int x) { return x * 3; }
+inline int f8425_4(int x) { return x * 4; }
+inline int f8425_5(int x) { return x * 5; }
+inline int f8425_6(int x) { return x * 6; }
+inline int f8425_7(int x) { return x * 7; }
+inline int f8425_8(int x) { return x * 8; }
+inline int f8425_9(int x) { return x * 9; }
+inline int f8425_10(int x) { return x * 10; }
+inline int f8425_11(int x) { return x * 11; }
+inline int f8425_12(int x) { return x * 12; }
+inline int f8425_13(int x) { return x * 13; }
+inline int f8425_14(int x) { return x * 14; }
+inline int f8425_15(int x) { return x * 15; }
+inline int f8425_16(int x) { return x * 16; }
+inline int f8425_17(int x) { return x * 17; }
+inline int f8425_18(int x) { return x * 18; }
+inline int f8425_19(int x) { return x * 19; }
+inline int f8425_20(int x) { return x * 20; }
+inline int f8425_21(int x) { return x * 21; }
+inline int f8425_22(int x) { return x * 22; }
+inline int f8425_23(int x) { return x * 23; }
+inline int f8425_24(int x) { return x * 24; }
+inline int f8425_25(int x) { return x * 25; }
+inline int f8425_26(int x) { return x * 26; }
+inline int f8425_27(int x) { return x * 27; }
+inline int f8425_28(int x) { return x * 28; }
+inline int f8425_29(int x) { return x * 29; }
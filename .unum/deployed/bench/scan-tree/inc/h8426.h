@@ -0,0 +1,42 @@
+#pragma once
+/* header 8426 */
+#include <vector>
+#include "h3200.h"
+#include "h1273.h"
+#include "h8533.h"
+#include "h2173.h"
+#include "h681.h"
+#ifdef X
+#include "h5217.h"
+#endif
+struct S8426 { int a; const char *s = "x//y"; };
+inline int f8426_0(int x) { return x * 0; }
+inline int f8426_1(int x) { return x * 1; }
+inline int f8426_2(int x) { return x * 2; }
+inline int f8426_3(int x) { return x * 3; }
+inline int f8426_4(int x) { return x * 4; }
+inline int f8426_5(int x) { return x * 5; }
+inline int f8426_6(int x) { return x * 6; }
+inline int f8426_7(int x) { return x * 7; }
+inline int f8426_8(int x) { return x * 8; }
+inline int f8426_9(int x) { return x * 9; }
+inline int f8426_10(int x) { return x * 10; }
+inline int f8426_11(int x) { return x * 11; }
+inline int f8426_12(int x) { return x * 12; }
+inline int f8426_13(int x) { return x * 13; }
+inline int f8426_14(int x) { return x * 14; }
+inline int f8426_15(int x) { return x * 15; }
+inline int f8426_16(int x) { return x * 16; }
+inline int f8426_17(int x) { return x * 17; }
+inline int f8426_18(int x) { return x * 18; }
+inline int f8426_19(int x) { return x * 19; }
+inline int f8426_20(int x) { return x * 20; }
+inline int f8426_21(int x) { return x * 21; }
+inline int f8426_22(int x) { return x * 22; }
+inline int f8426_23(int x) { return x * 23; }
+inline int f8426_24(int x) { return x * 24; }
+inline int f8426_25(int x) { return x * 25; }
+inline int f8426_26(int x) { return x * 26; }
+inline int f8426_27(int x) { return x * 27; }
+inline int f8426_28(int x) { return x * 28; }
+inline int f8426_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8427 */
+#include <vector>
+#include "h8071.h"
+#include "h7151.h"
+#include "h5444.h"
+#include "h6600.h"
+#include "h8562.h"
+#ifdef X
+#include "h7514.h"
+#endif
+struct S8427 { int a; const char *s = "x//y"; };
+inline int f8427_0(int x) { return x * 0; }
+inline int f8427_1(int x) { return x * 1; }
+inline int f8427_2(int x) { return x * 2; }
+inline int f8427_3(int x) { return x * 3; }
+inline int f8427_4(int x) { return x * 4; }
+inline int f8427_5(int x) { return x * 5; }
+inline int f8427_6(int x) { return x * 6; }
+inline int f8427_7(int x) { return x * 7; }
+inline int f8427_8(int x) { return x * 8; }
+inline int f8427_9(int x) { return x * 9; }
+inline int f8427_10(int x) { return x * 10; }
+inline int f8427_11(int x) { return x * 11; }
+inline int f8427_12(int x) { return x * 12; }
+inline int f8427_13(int x) { return x * 13; }
+inline int f8427_14(int x) { return x * 14; }
+inline int f8427_15(int x) { return x * 15; }
+inline int f8427_16(int x) { return x * 16; }
+inline int f8427_17(int x) { return x * 17; }
+inline int f8427_18(int x) { return x * 18; }
+inline int f8427_19(int x) { return x * 19; }
+inline int f8427_20(int x) { return x * 20; }
+inline int f8427_21(int x) { return x * 21; }
+inline int f8427_22(int x) { return x * 22; }
+inline int f8427_23(int x) { return x * 23; }
+inline int f8427_24(int x) { return x * 24; }
+inline int f8427_25(int x) { return x * 25; }
+inline int f8427_26(int x) { return x * 26; }
+inline int f8427_27(int x) { return x * 27; }
+inline int f8427_28(int x) { return x * 28; }
+inline int f8427_29(int x) { return x * 29; }
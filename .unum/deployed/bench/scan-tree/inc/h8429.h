@@ -0,0 +1,42 @@
+#pragma once
+/* header 8429 */
+#include <vector>
+#include "h9303.h"
+#include "h5623.h"
+#include "h3668.h"
+#include "h9873.h"
+#include "h9089.h"
+#ifdef X
+#include "h8401.h"
+#endif
+struct S8429 { int a; const char *s = "x//y"; };
+inline int f8429_0(int x) { return x * 0; }
+inline int f8429_1(int x) { return x * 1; }
+inline int f8429_2(int x) { return x * 2; }
+inline int f8429_3(int x) { return x * 3; }
+inline int f8429_4(int x) { return x * 4; }
+inline int f8429_5(int x) { return x * 5; }
+inline int f8429_6(int x) { return x * 6; }
+inline int f8429_7(int x) { return x * 7; }
+inline int f8429_8(int x) { return x * 8; }
+inline int f8429_9(int x) { return x * 9; }
+inline int f8429_10(int x) { return x * 10; }
+inline int f8429_11(int x) { return x * 11; }
+inline int f8429_12(int x) { return x * 12; }
+inline int f8429_13(int x) { return x * 13; }
+inline int f8429_14(int x) { return x * 14; }
+inline int f8429_15(int x) { return x * 15; }
+inline int f8429_16(int x) { return x * 16; }
+inline int f8429_17(int x) { return x * 17; }
+inline int f8429_18(int x) { return x * 18; }
+inline int f8429_19(int x) { return x * 19; }
+inline int f8429_20(int x) { return x * 20; }
+inline int f8429_21(int x) { return x * 21; }
+inline int f8429_22(int x) { return x * 22; }
+inline int f8429_23(int x) { return x * 23; }
+inline int f8429_24(int x) { return x * 24; }
+inline int f8429_25(int x) { return x * 25; }
+inline int f8429_26(int x) { return x * 26; }
+inline int f8429_27(int x) { return x * 27; }
+inline int f8429_28(int x) { return x * 28; }
+inline int f8429_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8430 */
+#include <vector>
+#include "h9355.h"
+#include "h9620.h"
+#include "h4545.h"
+#include "h5540.h"
+#include "h2562.h"
+#ifdef X
+#include "h5801.h"
+#endif
+struct S8430 { int a; const char *s = "x//y"; };
+inline int f8430_0(int x) { return x * 0; }
+inline int f8430_1(int x) { return x * 1; }
+inline int f8430_2(int x) { return x * 2; }
+inline int f8430_3(int x) { return x * 3; }
+inline int f8430_4(int x) { return x * 4; }
+inline int f8430_5(int x) { return x * 5; }
+inline int f8430_6(int x) { return x * 6; }
+inline int f8430_7(int x) { return x * 7; }
+inline int f8430_8(int x) { return x * 8; }
+inline int f8430_9(int x) { return x * 9; }
+inline int f8430_10(int x) { return x * 10; }
+inline int f8430_11(int x) { return x * 11; }
+inline int f8430_12(int x) { return x * 12; }
+inline int f8430_13(int x) { return x * 13; }
+inline int f8430_14(int x) { return x * 14; }
+inline int f8430_15(int x) { return x * 15; }
+inline int f8430_16(int x) { return x * 16; }
+inline int f8430_17(int x) { return x * 17; }
+inline int f8430_18(int x) { return x * 18; }
+inline int f8430_19(int x) { return x * 19; }
+inline int f8430_20(int x) { return x * 20; }
+inline int f8430_21(int x) { return x * 21; }
+inline int f8430_22(int x) { return x * 22; }
+inline int f8430_23(int x) { return x * 23; }
+inline int f8430_24(int x) { return x * 24; }
+inline int f8430_25(int x) { return x * 25; }
+inline int f8430_26(int x) { return x * 26; }
+inline int f8430_27(int x) { return x * 27; }
+inline int f8430_28(int x) { return x * 28; }
+inline int f8430_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8434 */
+#include <vector>
+#include "h4281.h"
+#include "h3491.h"
+#include "h723.h"
+#include "h3704.h"
+#include "h880.h"
+#ifdef X
+#include "h6973.h"
+#endif
+struct S8434 { int a; const char *s = "x//y"; };
+inline int f8434_0(int x) { return x * 0; }
+inline int f8434_1(int x) { return x * 1; }
+inline int f8434_2(int x) { return x * 2; }
+inline int f8434_3(int x) { return x * 3; }
+inline int f8434_4(int x) { return x * 4; }
+inline int f8434_5(int x) { return x * 5; }
+inline int f8434_6(int x) { return x * 6; }
+inline int f8434_7(int x) { return x * 7; }
+inline int f8434_8(int x) { return x * 8; }
+inline int f8434_9(int x) { return x * 9; }
+inline int f8434_10(int x) { return x * 10; }
+inline int f8434_11(int x) { return x * 11; }
+inline int f8434_12(int x) { return x * 12; }
+inline int f8434_13(int x) { return x * 13; }
+inline int f8434_14(int x) { return x * 14; }
+inline int f8434_15(int x) { return x * 15; }
+inline int f8434_16(int x) { return x * 16; }
+inline int f8434_17(int x) { return x * 17; }
+inline int f8434_18(int x) { return x * 18; }
+inline int f8434_19(int x) { return x * 19; }
+inline int f8434_20(int x) { return x * 20; }
+inline int f8434_21(int x) { return x * 21; }
+inline int f8434_22(int x) { return x * 22; }
+inline int f8434_23(int x) { return x * 23; }
+inline int f8434_24(int x) { return x * 24; }
+inline int f8434_25(int x) { return x * 25; }
+inline int f8434_26(int x) { return x * 26; }
+inline int f8434_27(int x) { return x * 27; }
+inline int f8434_28(int x) { return x * 28; }
+inline int f8434_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8435 */
+#include <vector>
+#include "h6666.h"
+#include "h2471.h"
+#include "h1313.h"
+#include "h8001.h"
+#include "h7028.h"
+#ifdef X
+#include "h1496.h"
+#endif
+struct S8435 { int a; const char *s = "x//y"; };
+inline int f8435_0(int x) { return x * 0; }
+inline int f8435_1(int x) { return x * 1; }
+inline int f8435_2(int x) { return x * 2; }
+inline int f8435_3(int x) { return x * 3; }
+inline int f8435_4(int x) { return x * 4; }
+inline int f8435_5(int x) { return x * 5; }
+inline int f8435_6(int x) { return x * 6; }
+inline int f8435_7(int x) { return x * 7; }
+inline int f8435_8(int x) { return x * 8; }
+inline int f8435_9(int x) { return x * 9; }
+inline int f8435_10(int x) { return x * 10; }
+inline int f8435_11(int x) { return x * 11; }
+inline int f8435_12(int x) { return x * 12; }
+inline int f8435_13(int x) { return x * 13; }
+inline int f8435_14(int x) { return x * 14; }
+inline int f8435_15(int x) { return x * 15; }
+inline int f8435_16(int x) { return x * 16; }
+inline int f8435_17(int x) { return x * 17; }
+inline int f8435_18(int x) { return x * 18; }
+inline int f8435_19(int x) { return x * 19; }
+inline int f8435_20(int x) { return x * 20; }
+inline int f8435_21(int x) { return x * 21; }
+inline int f8435_22(int x) { return x * 22; }
+inline int f8435_23(int x) { return x * 23; }
+inline int f8435_24(int x) { return x * 24; }
+inline int f8435_25(int x) { return x * 25; }
+inline int f8435_26(int x) { return x * 26; }
+inline int f8435_27(int x) { return x * 27; }
+inline int f8435_28(int x) { return x * 28; }
+inline int f8435_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8436 */
+#include <vector>
+#include "h4807.h"
+#include "h529.h"
+#include "h5723.h"
+#include "h2565.h"
+#include "h104.h"
+#ifdef X
+#include "h1884.h"
+#endif
+struct S8436 { int a; const char *s = "x//y"; };
+inline int f8436_0(int x) { return x * 0; }
+inline int f8436_1(int x) { return x * 1; }
+inline int f8436_2(int x) { return x * 2; }
+inline int f8436_3(int x) { return x * 3; }
+inline int f8436_4(int x) { return x * 4; }
+inline int f8436_5(int x) { return x * 5; }
+inline int f8436_6(int x) { return x * 6; }
+inline int f8436_7(int x) { return x * 7; }
+inline int f8436_8(int x) { return x * 8; }
+inline int f8436_9(int x) { return x * 9; }
+inline int f8436_10(int x) { return x * 10; }
+inline int f8436_11(int x) { return x * 11; }
+inline int f8436_12(int x) { return x * 12; }
+inline int f8436_13(int x) { return x * 13; }
+inline int f8436_14(int x) { return x * 14; }
+inline int f8436_15(int x) { return x * 15; }
+inline int f8436_16(int x) { return x * 16; }
+inline int f8436_17(int x) { return x * 17; }
+inline int f8436_18(int x) { return x * 18; }
+inline int f8436_19(int x) { return x * 19; }
+inline int f8436_20(int x) { return x * 20; }
+inline int f8436_21(int x) { return x * 21; }
+inline int f8436_22(int x) { return x * 22; }
+inline int f8436_23(int x) { return x * 23; }
+inline int f8436_24(int x) { return x * 24; }
+inline int f8436_25(int x) { return x * 25; }
+inline int f8436_26(int x) { return x * 26; }
+inline int f8436_27(int x) { return x * 27; }
+inline int f8436_28(int x) { return x * 28; }
+inline int f8436_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8437 */
+#include <vector>
+#include "h4014.h"
+#include "h6255.h"
+#include "h9044.h"
+#include "h5257.h"
+#include "h4472.h"
+#ifdef X
+#include "h3084.h"
+#endif
+struct S8437 { int a; const char *s = "x//y"; };
+inline int f8437_0(int x) { return x * 0; }
+inline int f8437_1(int x) { return x * 1; }
+inline int f8437_2(int x) { return x * 2; }
+inline int f8437_3(int x) { return x * 3; }
+inline int f8437_4(int x) { return x * 4; }
+inline int f8437_5(int x) { return x * 5; }
+inline int f8437_6(int x) { return x * 6; }
+inline int f8437_7(int x) { return x * 7; }
+inline int f8437_8(int x) { return x * 8; }
+inline int f8437_9(int x) { return x * 9; }
+inline int f8437_10(int x) { return x * 10; }
+inline int f8437_11(int x) { return x * 11; }
+inline int f8437_12(int x) { return x * 12; }
+inline int f8437_13(int x) { return x * 13; }
+inline int f8437_14(int x) { return x * 14; }
+inline int f8437_15(int x) { return x * 15; }
+inline int f8437_16(int x) { return x * 16; }
+inline int f8437_17(int x) { return x * 17; }
+inline int f8437_18(int x) { return x * 18; }
+inline int f8437_19(int x) { return x * 19; }
+inline int f8437_20(int x) { return x * 20; }
+inline int f8437_21(int x) { return x * 21; }
+inline int f8437_22(int x) { return x * 22; }
+inline int f8437_23(int x) { return x * 23; }
+inline int f8437_24(int x) { return x * 24; }
+inline int f8437_25(int x) { return x * 25; }
+inline int f8437_26(int x) { return x * 26; }
+inline int f8437_27(int x) { return x * 27; }
+inline int f8437_28(int x) { return x * 28; }
+inline int f8437_29(int x) { return x * 29; }
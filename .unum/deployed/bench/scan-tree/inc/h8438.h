@@ -0,0 +1,42 @@
+#pragma once
+/* header 8438 */
+#include <vector>
+#include "h2197.h"
+#include "h4890.h"
+#include "h3751.h"
+#include "h6114.h"
+#include "h4732.h"
+#ifdef X
+#include "h24.h"
+#endif
+struct S8438 { int a; const char *s = "x//y"; };
+inline int f8438_0(int x) { return x * 0; }
+inline int f8438_1(int x) { return x * 1; }
+inline int f8438_2(int x) { return x * 2; }
+inline int f8438_3(int x) { return x * 3; }
+inline int f8438_4(int x) { return x * 4; }
+inline int f8438_5(int x) { return x * 5; }
+inline int f8438_6(int x) { return x * 6; }
+inline int f8438_7(int x) { return x * 7; }
+inline int f8438_8(int x) { return x * 8; }
+inline int f8438_9(int x) { return x * 9; }
+inline int f8438_10(int x) { return x * 10; }
+inline int f8438_11(int x) { return x * 11; }
+inline int f8438_12(int x) { return x * 12; }
+inline int f8438_13(int x) { return x * 13; }
+inline int f8438_14(int x) { return x * 14; }
+inline int f8438_15(int x) { return x * 15; }
+inline int f8438_16(int x) { return x * 16; }
+inline int f8438_17(int x) { return x * 17; }
+inline int f8438_18(int x) { return x * 18; }
+inline int f8438_19(int x) { return x * 19; }
+inline int f8438_20(int x) { return x * 20; }
+inline int f8438_21(int x) { return x * 21; }
+inline int f8438_22(int x) { return x * 22; }
+inline int f8438_23(int x) { return x * 23; }
+inline int f8438_24(int x) { return x * 24; }
+inline int f8438_25(int x) { return x * 25; }
+inline int f8438_26(int x) { return x * 26; }
+inline int f8438_27(int x) { return x * 27; }
+inline int f8438_28(int x) { return x * 28; }
+inline int f8438_29(int x) { return x * 29; }
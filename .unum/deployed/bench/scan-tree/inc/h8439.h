@@ -0,0 +1,42 @@
+#pragma once
+/* header 8439 */
+#include <vector>
+#include "h1358.h"
+#include "h6156.h"
+#include "h9437.h"
+#include "h6822.h"
+#include "h9620.h"
+#ifdef X
+#include "h2461.h"
+#endif
+struct S8439 { int a; const char *s = "x//y"; };
+inline int f8439_0(int x) { return x * 0; }
+inline int f8439_1(int x) { return x * 1; }
+inline int f8439_2(int x) { return x * 2; }
+inline int f8439_3(int x) { return x * 3; }
+inline int f8439_4(int x) { return x * 4; }
+inline int f8439_5(int x) { return x * 5; }
+inline int f8439_6(int x) { return x * 6; }
+inline int f8439_7(int x) { return x * 7; }
+inline int f8439_8(int x) { return x * 8; }
+inline int f8439_9(int x) { return x * 9; }
+inline int f8439_10(int x) { return x * 10; }
+inline int f8439_11(int x) { return x * 11; }
+inline int f8439_12(int x) { return x * 12; }
+inline int f8439_13(int x) { return x * 13; }
+inline int f8439_14(int x) { return x * 14; }
+inline int f8439_15(int x) { return x * 15; }
+inline int f8439_16(int x) { return x * 16; }
+inline int f8439_17(int x) { return x * 17; }
+inline int f8439_18(int x) { return x * 18; }
+inline int f8439_19(int x) { return x * 19; }
+inline int f8439_20(int x) { return x * 20; }
+inline int f8439_21(int x) { return x * 21; }
+inline int f8439_22(int x) { return x * 22; }
+inline int f8439_23(int x) { return x * 23; }
+inline int f8439_24(int x) { return x * 24; }
+inline int f8439_25(int x) { return x * 25; }
+inline int f8439_26(int x) { return x * 26; }
+inline int f8439_27(int x) { return x * 27; }
+inline int f8439_28(int x) { return x * 28; }
+inline int f8439_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 844 */
+#include <vector>
+#include "h3428.h"
+#include "h3388.h"
+#include "h8596.h"
+#include "h227.h"
+#include "h3807.h"
+#ifdef X
+#include "h9244.h"
+#endif
+struct S844 { int a; const char *s = "x//y"; };
+inline int f844_0(int x) { return x * 0; }
+inline int f844_1(int x) { return x * 1; }
+inline int f844_2(int x) { return x * 2; }
+inline int f844_3(int x) { return x * 3; }
+inline int f844_4(int x) { return x * 4; }
+inline int f844_5(int x) { return x * 5; }
+inline int f844_6(int x) { return x * 6; }
+inline int f844_7(int x) { return x * 7; }
+inline int f844_8(int x) { return x * 8; }
+inline int f844_9(int x) { return x * 9; }
+inline int f844_10(int x) { return x * 10; }
+inline int f844_11(int x) { return x * 11; }
+inline int f844_12(int x) { return x * 12; }
+inline int f844_13(int x) { return x * 13; }
+inline int f844_14(int x) { return x * 14; }
+inline int f844_15(int x) { return x * 15; }
+inline int f844_16(int x) { return x * 16; }
+inline int f844_17(int x) { return x * 17; }
+inline int f844_18(int x) { return x * 18; }
+inline int f844_19(int x) { return x * 19; }
+inline int f844_20(int x) { return x * 20; }
+inline int f844_21(int x) { return x * 21; }
+inline int f844_22(int x) { return x * 22; }
+inline int f844_23(int x) { return x * 23; }
+inline int f844_24(int x) { return x * 24; }
+inline int f844_25(int x) { return x * 25; }
+inline int f844_26(int x) { return x * 26; }
+inline int f844_27(int x) { return x * 27; }
+inline int f844_28(int x) { return x * 28; }
+inline int f844_29(int x) { return x * 29; }
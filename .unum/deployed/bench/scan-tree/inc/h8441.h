@@ -0,0 +1,42 @@
+#pragma once
+/* header 8441 */
+#include <vector>
+#include "h9808.h"
+#include "h4042.h"
+#include "h3044.h"
+#include "h1389.h"
+#include "h555.h"
+#ifdef X
+#include "h845.h"
+#endif
+struct S8441 { int a; const char *s = "x//y"; };
+inline int f8441_0(int x) { return x * 0; }
+inline int f8441_1(int x) { return x * 1; }
+inline int f8441_2(int x) { return x * 2; }
+inline int f8441_3(int x) { return x * 3; }
+inline int f8441_4(int x) { return x * 4; }
+inline int f8441_5(int x) { return x * 5; }
+inline int f8441_6(int x) { return x * 6; }
+inline int f8441_7(int x) { return x * 7; }
+inline int f8441_8(int x) { return x * 8; }
+inline int f8441_9(int x) { return x * 9; }
+inline int f8441_10(int x) { return x * 10; }
+inline int f8441_11(int x) { return x * 11; }
+inline int f8441_12(int x) { return x * 12; }
+inline int f8441_13(int x) { return x * 13; }
+inline int f8441_14(int x) { return x * 14; }
+inline int f8441_15(int x) { return x * 15; }
+inline int f8441_16(int x) { return x * 16; }
+inline int f8441_17(int x) { return x * 17; }
+inline int f8441_18(int x) { return x * 18; }
+inline int f8441_19(int x) { return x * 19; }
+inline int f8441_20(int x) { return x * 20; }
+inline int f8441_21(int x) { return x * 21; }
+inline int f8441_22(int x) { return x * 22; }
+inline int f8441_23(int x) { return x * 23; }
+inline int f8441_24(int x) { return x * 24; }
+inline int f8441_25(int x) { return x * 25; }
+inline int f8441_26(int x) { return x * 26; }
+inline int f8441_27(int x) { return x * 27; }
+inline int f8441_28(int x) { return x * 28; }
+inline int f8441_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8443 */
+#include <vector>
+#include "h2271.h"
+#include "h3727.h"
+#include "h2103.h"
+#include "h3200.h"
+#include "h8430.h"
+#ifdef X
+#include "h2780.h"
+#endif
+struct S8443 { int a; const char *s = "x//y"; };
+inline int f8443_0(int x) { return x * 0; }
+inline int f8443_1(int x) { return x * 1; }
+inline int f8443_2(int x) { return x * 2; }
+inline int f8443_3(int x) { return x * 3; }
+inline int f8443_4(int x) { return x * 4; }
+inline int f8443_5(int x) { return x * 5; }
+inline int f8443_6(int x) { return x * 6; }
+inline int f8443_7(int x) { return x * 7; }
+inline int f8443_8(int x) { return x * 8; }
+inline int f8443_9(int x) { return x * 9; }
+inline int f8443_10(int x) { return x * 10; }
+inline int f8443_11(int x) { return x * 11; }
+inline int f8443_12(int x) { return x * 12; }
+inline int f8443_13(int x) { return x * 13; }
+inline int f8443_14(int x) { return x * 14; }
+inline int f8443_15(int x) { return x * 15; }
+inline int f8443_16(int x) { return x * 16; }
+inline int f8443_17(int x) { return x * 17; }
+inline int f8443_18(int x) { return x * 18; }
+inline int f8443_19(int x) { return x * 19; }
+inline int f8443_20(int x) { return x * 20; }
+inline int f8443_21(int x) { return x * 21; }
+inline int f8443_22(int x) { return x * 22; }
+inline int f8443_23(int x) { return x * 23; }
+inline int f8443_24(int x) { return x * 24; }
+inline int f8443_25(int x) { return x * 25; }
+inline int f8443_26(int x) { return x * 26; }
+inline int f8443_27(int x) { return x * 27; }
+inline int f8443_28(int x) { return x * 28; }
+inline int f8443_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8445 */
+#include <vector>
+#include "h7009.h"
+#include "h3998.h"
+#include "h426.h"
+#include "h9163.h"
+#include "h239.h"
+#ifdef X
+#include "h5794.h"
+#endif
+struct S8445 { int a; const char *s = "x//y"; };
+inline int f8445_0(int x) { return x * 0; }
+inline int f8445_1(int x) { return x * 1; }
+inline int f8445_2(int x) { return x * 2; }
+inline int f8445_3(int x) { return x * 3; }
+inline int f8445_4(int x) { return x * 4; }
+inline int f8445_5(int x) { return x * 5; }
+inline int f8445_6(int x) { return x * 6; }
+inline int f8445_7(int x) { return x * 7; }
+inline int f8445_8(int x) { return x * 8; }
+inline int f8445_9(int x) { return x * 9; }
+inline int f8445_10(int x) { return x * 10; }
+inline int f8445_11(int x) { return x * 11; }
+inline int f8445_12(int x) { return x * 12; }
+inline int f8445_13(int x) { return x * 13; }
+inline int f8445_14(int x) { return x * 14; }
+inline int f8445_15(int x) { return x * 15; }
+inline int f8445_16(int x) { return x * 16; }
+inline int f8445_17(int x) { return x * 17; }
+inline int f8445_18(int x) { return x * 18; }
+inline int f8445_19(int x) { return x * 19; }
+inline int f8445_20(int x) { return x * 20; }
+inline int f8445_21(int x) { return x * 21; }
+inline int f8445_22(int x) { return x * 22; }
+inline int f8445_23(int x) { return x * 23; }
+inline int f8445_24(int x) { return x * 24; }
+inline int f8445_25(int x) { return x * 25; }
+inline int f8445_26(int x) { return x * 26; }
+inline int f8445_27(int x) { return x * 27; }
+inline int f8445_28(int x) { return x * 28; }
+inline int f8445_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8446 */
+#include <vector>
+#include "h4996.h"
+#include "h8592.h"
+#include "h3760.h"
+#include "h8095.h"
+#include "h7113.h"
+#ifdef X
+#include "h2578.h"
+#endif
+struct S8446 { int a; const char *s = "x//y"; };
+inline int f8446_0(int x) { return x * 0; }
+inline int f8446_1(int x) { return x * 1; }
+inline int f8446_2(int x) { return x * 2; }
+inline int f8446_3(int x) { return x * 3; }
+inline int f8446_4(int x) { return x * 4; }
+inline int f8446_5(int x) { return x * 5; }
+inline int f8446_6(int x) { return x * 6; }
+inline int f8446_7(int x) { return x * 7; }
+inline int f8446_8(int x) { return x * 8; }
+inline int f8446_9(int x) { return x * 9; }
+inline int f8446_10(int x) { return x * 10; }
+inline int f8446_11(int x) { return x * 11; }
+inline int f8446_12(int x) { return x * 12; }
+inline int f8446_13(int x) { return x * 13; }
+inline int f8446_14(int x) { return x * 14; }
+inline int f8446_15(int x) { return x * 15; }
+inline int f8446_16(int x) { return x * 16; }
+inline int f8446_17(int x) { return x * 17; }
+inline int f8446_18(int x) { return x * 18; }
+inline int f8446_19(int x) { return x * 19; }
+inline int f8446_20(int x) { return x * 20; }
+inline int f8446_21(int x) { return x * 21; }
+inline int f8446_22(int x) { return x * 22; }
+inline int f8446_23(int x) { return x * 23; }
+inline int f8446_24(int x) { return x * 24; }
+inline int f8446_25(int x) { return x * 25; }
+inline int f8446_26(int x) { return x * 26; }
+inline int f8446_27(int x) { return x * 27; }
+inline int f8446_28(int x) { return x * 28; }
+inline int f8446_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8447 */
+#include <vector>
+#include "h7867.h"
+#include "h6067.h"
+#include "h9390.h"
+#include "h5979.h"
+#include "h5700.h"
+#ifdef X
+#include "h5525.h"
+#endif
+struct S8447 { int a; const char *s = "x//y"; };
+inline int f8447_0(int x) { return x * 0; }
+inline int f8447_1(int x) { return x * 1; }
+inline int f8447_2(int x) { return x * 2; }
+inline int f8447_3(int x) { return x * 3; }
+inline int f8447_4(int x) { return x * 4; }
+inline int f8447_5(int x) { return x * 5; }
+inline int f8447_6(int x) { return x * 6; }
+inline int f8447_7(int x) { return x * 7; }
+inline int f8447_8(int x) { return x * 8; }
+inline int f8447_9(int x) { return x * 9; }
+inline int f8447_10(int x) { return x * 10; }
+inline int f8447_11(int x) { return x * 11; }
+inline int f8447_12(int x) { return x * 12; }
+inline int f8447_13(int x) { return x * 13; }
+inline int f8447_14(int x) { return x * 14; }
+inline int f8447_15(int x) { return x * 15; }
+inline int f8447_16(int x) { return x * 16; }
+inline int f8447_17(int x) { return x * 17; }
+inline int f8447_18(int x) { return x * 18; }
+inline int f8447_19(int x) { return x * 19; }
+inline int f8447_20(int x) { return x * 20; }
+inline int f8447_21(int x) { return x * 21; }
+inline int f8447_22(int x) { return x * 22; }
+inline int f8447_23(int x) { return x * 23; }
+inline int f8447_24(int x) { return x * 24; }
+inline int f8447_25(int x) { return x * 25; }
+inline int f8447_26(int x) { return x * 26; }
+inline int f8447_27(int x) { return x * 27; }
+inline int f8447_28(int x) { return x * 28; }
+inline int f8447_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8448 */
+#include <vector>
+#include "h9895.h"
+#include "h2555.h"
+#include "h3840.h"
+#include "h5443.h"
+#include "h1273.h"
+#ifdef X
+#include "h4624.h"
+#endif
+struct S8448 { int a; const char *s = "x//y"; };
+inline int f8448_0(int x) { return x * 0; }
+inline int f8448_1(int x) { return x * 1; }
+inline int f8448_2(int x) { return x * 2; }
+inline int f8448_3(int x) { return x * 3; }
+inline int f8448_4(int x) { return x * 4; }
+inline int f8448_5(int x) { return x * 5; }
+inline int f8448_6(int x) { return x * 6; }
+inline int f8448_7(int x) { return x * 7; }
+inline int f8448_8(int x) { return x * 8; }
+inline int f8448_9(int x) { return x * 9; }
+inline int f8448_10(int x) { return x * 10; }
+inline int f8448_11(int x) { return x * 11; }
+inline int f8448_12(int x) { return x * 12; }
+inline int f8448_13(int x) { return x * 13; }
+inline int f8448_14(int x) { return x * 14; }
+inline int f8448_15(int x) { return x * 15; }
+inline int f8448_16(int x) { return x * 16; }
+inline int f8448_17(int x) { return x * 17; }
+inline int f8448_18(int x) { return x * 18; }
+inline int f8448_19(int x) { return x * 19; }
+inline int f8448_20(int x) { return x * 20; }
+inline int f8448_21(int x) { return x * 21; }
+inline int f8448_22(int x) { return x * 22; }
+inline int f8448_23(int x) { return x * 23; }
+inline int f8448_24(int x) { return x * 24; }
+inline int f8448_25(int x) { return x * 25; }
+inline int f8448_26(int x) { return x * 26; }
+inline int f8448_27(int x) { return x * 27; }
+inline int f8448_28(int x) { return x * 28; }
+inline int f8448_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 845 */
+#include <vector>
+#include "h5273.h"
+#include "h4741.h"
+#include "h7473.h"
+#include "h1056.h"
+#include "h7638.h"
+#ifdef X
+#include "h2033.h"
+#endif
+struct S845 { int a; const char *s = "x//y"; };
+inline int f845_0(int x) { return x * 0; }
+inline int f845_1(int x) { return x * 1; }
+inline int f845_2(int x) { return x * 2; }
+inline int f845_3(int x) { return x * 3; }
+inline int f845_4(int x) { return x * 4; }
+inline int f845_5(int x) { return x * 5; }
+inline int f845_6(int x) { return x * 6; }
+inline int f845_7(int x) { return x * 7; }
+inline int f845_8(int x) { return x * 8; }
+inline int f845_9(int x) { return x * 9; }
+inline int f845_10(int x) { return x * 10; }
+inline int f845_11(int x) { return x * 11; }
+inline int f845_12(int x) { return x * 12; }
+inline int f845_13(int x) { return x * 13; }
+inline int f845_14(int x) { return x * 14; }
+inline int f845_15(int x) { return x * 15; }
+inline int f845_16(int x) { return x * 16; }
+inline int f845_17(int x) { return x * 17; }
+inline int f845_18(int x) { return x * 18; }
+inline int f845_19(int x) { return x * 19; }
+inline int f845_20(int x) { return x * 20; }
+inline int f845_21(int x) { return x * 21; }
+inline int f845_22(int x) { return x * 22; }
+inline int f845_23(int x) { return x * 23; }
+inline int f845_24(int x) { return x * 24; }
+inline int f845_25(int x) { return x * 25; }
+inline int f845_26(int x) { return x * 26; }
+inline int f845_27(int x) { return x * 27; }
+inline int f845_28(int x) { return x * 28; }
+inline int f845_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8454 */
+#include <vector>
+#include "h3277.h"
+#include "h7778.h"
+#include "h1345.h"
+#include "h9782.h"
+#include "h6801.h"
+#ifdef X
+#include "h2260.h"
+#endif
+struct S8454 { int a; const char *s = "x//y"; };
+inline int f8454_0(int x) { return x * 0; }
+inline int f8454_1(int x) { return x * 1; }
+inline int f8454_2(int x) { return x * 2; }
+inline int f8454_3(int x) { return x * 3; }
+inline int f8454_4(int x) { return x * 4; }
+inline int f8454_5(int x) { return x * 5; }
+inline int f8454_6(int x) { return x * 6; }
+inline int f8454_7(int x) { return x * 7; }
+inline int f8454_8(int x) { return x * 8; }
+inline int f8454_9(int x) { return x * 9; }
+inline int f8454_10(int x) { return x * 10; }
+inline int f8454_11(int x) { return x * 11; }
+inline int f8454_12(int x) { return x * 12; }
+inline int f8454_13(int x) { return x * 13; }
+inline int f8454_14(int x) { return x * 14; }
+inline int f8454_15(int x) { return x * 15; }
+inline int f8454_16(int x) { return x * 16; }
+inline int f8454_17(int x) { return x * 17; }
+inline int f8454_18(int x) { return x * 18; }
+inline int f8454_19(int x) { return x * 19; }
+inline int f8454_20(int x) { return x * 20; }
+inline int f8454_21(int x) { return x * 21; }
+inline int f8454_22(int x) { return x * 22; }
+inline int f8454_23(int x) { return x * 23; }
+inline int f8454_24(int x) { return x * 24; }
+inline int f8454_25(int x) { return x * 25; }
+inline int f8454_26(int x) { return x * 26; }
+inline int f8454_27(int x) { return x * 27; }
+inline int f8454_28(int x) { return x * 28; }
+inline int f8454_29(int x) { return x * 29; }
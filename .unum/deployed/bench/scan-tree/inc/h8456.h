@@ -0,0 +1,42 @@
+#pragma once
+/* header 8456 */
+#include <vector>
+#include "h5672.h"
+#include "h982.h"
+#include "h8119.h"
+#include "h3299.h"
+#include "h9871.h"
+#ifdef X
+#include "h3441.h"
+#endif
+struct S8456 { int a; const char *s = "x//y"; };
+inline int f8456_0(int x) { return x * 0; }
+inline int f8456_1(int x) { return x * 1; }
+inline int f8456_2(int x) { return x * 2; }
+inline int f8456_3(int x) { return x * 3; }
+inline int f8456_4(int x) { return x * 4; }
+inline int f8456_5(int x) { return x * 5; }
+inline int f8456_6(int x) { return x * 6; }
+inline int f8456_7(int x) { return x * 7; }
+inline int f8456_8(int x) { return x * 8; }
+inline int f8456_9(int x) { return x * 9; }
+inline int f8456_10(int x) { return x * 10; }
+inline int f8456_11(int x) { return x * 11; }
+inline int f8456_12(int x) { return x * 12; }
+inline int f8456_13(int x) { return x * 13; }
+inline int f8456_14(int x) { return x * 14; }
+inline int f8456_15(int x) { return x * 15; }
+inline int f8456_16(int x) { return x * 16; }
+inline int f8456_17(int x) { return x * 17; }
+inline int f8456_18(int x) { return x * 18; }
+inline int f8456_19(int x) { return x * 19; }
+inline int f8456_20(int x) { return x * 20; }
+inline int f8456_21(int x) { return x * 21; }
+inline int f8456_22(int x) { return x * 22; }
+inline int f8456_23(int x) { return x * 23; }
+inline int f8456_24(int x) { return x * 24; }
+inline int f8456_25(int x) { return x * 25; }
+inline int f8456_26(int x) { return x * 26; }
+inline int f8456_27(int x) { return x * 27; }
+inline int f8456_28(int x) { return x * 28; }
+inline int f8456_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 846 */
+#include <vector>
+#include "h2161.h"
+#include "h56.h"
+#include "h1506.h"
+#include "h6664.h"
+#include "h578.h"
+#ifdef X
+#include "h9527.h"
+#endif
+struct S846 { int a; const char *s = "x//y"; };
+inline int f846_0(int x) { return x * 0; }
+inline int f846_1(int x) { return x * 1; }
+inline int f846_2(int x) { return x * 2; }
+inline int f846_3(int x) { return x * 3; }
+inline int f846_4(int x) { return x * 4; }
+inline int f846_5(int x) { return x * 5; }
+inline int f846_6(int x) { return x * 6; }
+inline int f846_7(int x) { return x * 7; }
+inline int f846_8(int x) { return x * 8; }
+inline int f846_9(int x) { return x * 9; }
+inline int f846_10(int x) { return x * 10; }
+inline int f846_11(int x) { return x * 11; }
+inline int f846_12(int x) { return x * 12; }
+inline int f846_13(int x) { return x * 13; }
+inline int f846_14(int x) { return x * 14; }
+inline int f846_15(int x) { return x * 15; }
+inline int f846_16(int x) { return x * 16; }
+inline int f846_17(int x) { return x * 17; }
+inline int f846_18(int x) { return x * 18; }
+inline int f846_19(int x) { return x * 19; }
+inline int f846_20(int x) { return x * 20; }
+inline int f846_21(int x) { return x * 21; }
+inline int f846_22(int x) { return x * 22; }
+inline int f846_23(int x) { return x * 23; }
+inline int f846_24(int x) { return x * 24; }
+inline int f846_25(int x) { return x * 25; }
+inline int f846_26(int x) { return x * 26; }
+inline int f846_27(int x) { return x * 27; }
+inline int f846_28(int x) { return x * 28; }
+inline int f846_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8460 */
+#include <vector>
+#include "h3560.h"
+#include "h2848.h"
+#include "h1957.h"
+#include "h5071.h"
+#include "h6190.h"
+#ifdef X
+#include "h3575.h"
+#endif
+struct S8460 { int a; const char *s = "x//y"; };
+inline int f8460_0(int x) { return x * 0; }
+inline int f8460_1(int x) { return x * 1; }
+inline int f8460_2(int x) { return x * 2; }
+inline int f8460_3(int x) { return x * 3; }
+inline int f8460_4(int x) { return x * 4; }
+inline int f8460_5(int x) { return x * 5; }
+inline int f8460_6(int x) { return x * 6; }
+inline int f8460_7(int x) { return x * 7; }
+inline int f8460_8(int x) { return x * 8; }
+inline int f8460_9(int x) { return x * 9; }
+inline int f8460_10(int x) { return x * 10; }
+inline int f8460_11(int x) { return x * 11; }
+inline int f8460_12(int x) { return x * 12; }
+inline int f8460_13(int x) { return x * 13; }
+inline int f8460_14(int x) { return x * 14; }
+inline int f8460_15(int x) { return x * 15; }
+inline int f8460_16(int x) { return x * 16; }
+inline int f8460_17(int x) { return x * 17; }
+inline int f8460_18(int x) { return x * 18; }
+inline int f8460_19(int x) { return x * 19; }
+inline int f8460_20(int x) { return x * 20; }
+inline int f8460_21(int x) { return x * 21; }
+inline int f8460_22(int x) { return x * 22; }
+inline int f8460_23(int x) { return x * 23; }
+inline int f8460_24(int x) { return x * 24; }
+inline int f8460_25(int x) { return x * 25; }
+inline int f8460_26(int x) { return x * 26; }
+inline int f8460_27(int x) { return x * 27; }
+inline int f8460_28(int x) { return x * 28; }
+inline int f8460_29(int x) { return x * 29; }
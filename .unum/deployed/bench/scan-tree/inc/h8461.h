@@ -0,0 +1,42 @@
+#pragma once
+/* header 8461 */
+#include <vector>
+#include "h2801.h"
+#include "h777.h"
+#include "h7562.h"
+#include "h9701.h"
+#include "h6200.h"
+#ifdef X
+#include "h6853.h"
+#endif
+struct S8461 { int a; const char *s = "x//y"; };
+inline int f8461_0(int x) { return x * 0; }
+inline int f8461_1(int x) { return x * 1; }
+inline int f8461_2(int x) { return x * 2; }
+inline int f8461_3(int x) { return x * 3; }
+inline int f8461_4(int x) { return x * 4; }
+inline int f8461_5(int x) { return x * 5; }
+inline int f8461_6(int x) { return x * 6; }
+inline int f8461_7(int x) { return x * 7; }
+inline int f8461_8(int x) { return x * 8; }
+inline int f8461_9(int x) { return x * 9; }
+inline int f8461_10(int x) { return x * 10; }
+inline int f8461_11(int x) { return x * 11; }
+inline int f8461_12(int x) { return x * 12; }
+inline int f8461_13(int x) { return x * 13; }
+inline int f8461_14(int x) { return x * 14; }
+inline int f8461_15(int x) { return x * 15; }
+inline int f8461_16(int x) { return x * 16; }
+inline int f8461_17(int x) { return x * 17; }
+inline int f8461_18(int x) { return x * 18; }
+inline int f8461_19(int x) { return x * 19; }
+inline int f8461_20(int x) { return x * 20; }
+inline int f8461_21(int x) { return x * 21; }
+inline int f8461_22(int x) { return x * 22; }
+inline int f8461_23(int x) { return x * 23; }
+inline int f8461_24(int x) { return x * 24; }
+inline int f8461_25(int x) { return x * 25; }
+inline int f8461_26(int x) { return x * 26; }
+inline int f8461_27(int x) { return x * 27; }
+inline int f8461_28(int x) { return x * 28; }
+inline int f8461_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8463 */
+#include <vector>
+#include "h5215.h"
+#include "h7494.h"
+#include "h870.h"
+#include "h4306.h"
+#include "h815.h"
+#ifdef X
+#include "h2829.h"
+#endif
+struct S8463 { int a; const char *s = "x//y"; };
+inline int f8463_0(int x) { return x * 0; }
+inline int f8463_1(int x) { return x * 1; }
+inline int f8463_2(int x) { return x * 2; }
+inline int f8463_3(int x) { return x * 3; }
+inline int f8463_4(int x) { return x * 4; }
+inline int f8463_5(int x) { return x * 5; }
+inline int f8463_6(int x) { return x * 6; }
+inline int f8463_7(int x) { return x * 7; }
+inline int f8463_8(int x) { return x * 8; }
+inline int f8463_9(int x) { return x * 9; }
+inline int f8463_10(int x) { return x * 10; }
+inline int f8463_11(int x) { return x * 11; }
+inline int f8463_12(int x) { return x * 12; }
+inline int f8463_13(int x) { return x * 13; }
+inline int f8463_14(int x) { return x * 14; }
+inline int f8463_15(int x) { return x * 15; }
+inline int f8463_16(int x) { return x * 16; }
+inline int f8463_17(int x) { return x * 17; }
+inline int f8463_18(int x) { return x * 18; }
+inline int f8463_19(int x) { return x * 19; }
+inline int f8463_20(int x) { return x * 20; }
+inline int f8463_21(int x) { return x * 21; }
+inline int f8463_22(int x) { return x * 22; }
+inline int f8463_23(int x) { return x * 23; }
+inline int f8463_24(int x) { return x * 24; }
+inline int f8463_25(int x) { return x * 25; }
+inline int f8463_26(int x) { return x * 26; }
+inline int f8463_27(int x) { return x * 27; }
+inline int f8463_28(int x) { return x * 28; }
+inline int f8463_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8464 */
+#include <vector>
+#include "h8461.h"
+#include "h5531.h"
+#include "h2868.h"
+#include "h8351.h"
+#include "h2432.h"
+#ifdef X
+#include "h1006.h"
+#endif
+struct S8464 { int a; const char *s = "x//y"; };
+inline int f8464_0(int x) { return x * 0; }
+inline int f8464_1(int x) { return x * 1; }
+inline int f8464_2(int x) { return x * 2; }
+inline int f8464_3(int x) { return x * 3; }
+inline int f8464_4(int x) { return x * 4; }
+inline int f8464_5(int x) { return x * 5; }
+inline int f8464_6(int x) { return x * 6; }
+inline int f8464_7(int x) { return x * 7; }
+inline int f8464_8(int x) { return x * 8; }
+inline int f8464_9(int x) { return x * 9; }
+inline int f8464_10(int x) { return x * 10; }
+inline int f8464_11(int x) { return x * 11; }
+inline int f8464_12(int x) { return x * 12; }
+inline int f8464_13(int x) { return x * 13; }
+inline int f8464_14(int x) { return x * 14; }
+inline int f8464_15(int x) { return x * 15; }
+inline int f8464_16(int x) { return x * 16; }
+inline int f8464_17(int x) { return x * 17; }
+inline int f8464_18(int x) { return x * 18; }
+inline int f8464_19(int x) { return x * 19; }
+inline int f8464_20(int x) { return x * 20; }
+inline int f8464_21(int x) { return x * 21; }
+inline int f8464_22(int x) { return x * 22; }
+inline int f8464_23(int x) { return x * 23; }
+inline int f8464_24(int x) { return x * 24; }
+inline int f8464_25(int x) { return x * 25; }
+inline int f8464_26(int x) { return x * 26; }
+inline int f8464_27(int x) { return x * 27; }
+inline int f8464_28(int x) { return x * 28; }
+inline int f8464_29(int x) { return x * 29; }
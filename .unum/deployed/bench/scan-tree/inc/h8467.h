@@ -0,0 +1,42 @@
+#pragma once
+/* header 8467 */
+#include <vector>
+#include "h859.h"
+#include "h7049.h"
+#include "h162.h"
+#include "h6394.h"
+#include "h7.h"
+#ifdef X
+#include "h8485.h"
+#endif
+struct S8467 { int a; const char *s = "x//y"; };
+inline int f8467_0(int x) { return x * 0; }
+inline int f8467_1(int x) { return x * 1; }
+inline int f8467_2(int x) { return x * 2; }
+inline int f8467_3(int x) { return x * 3; }
+inline int f8467_4(int x) { return x * 4; }
+inline int f8467_5(int x) { return x * 5; }
+inline int f8467_6(int x) { return x * 6; }
+inline int f8467_7(int x) { return x * 7; }
+inline int f8467_8(int x) { return x * 8; }
+inline int f8467_9(int x) { return x * 9; }
+inline int f8467_10(int x) { return x * 10; }
+inline int f8467_11(int x) { return x * 11; }
+inline int f8467_12(int x) { return x * 12; }
+inline int f8467_13(int x) { return x * 13; }
+inline int f8467_14(int x) { return x * 14; }
+inline int f8467_15(int x) { return x * 15; }
+inline int f8467_16(int x) { return x * 16; }
+inline int f8467_17(int x) { return x * 17; }
+inline int f8467_18(int x) { return x * 18; }
+inline int f8467_19(int x) { return x * 19; }
+inline int f8467_20(int x) { return x * 20; }
+inline int f8467_21(int x) { return x * 21; }
+inline int f8467_22(int x) { return x * 22; }
+inline int f8467_23(int x) { return x * 23; }
+inline int f8467_24(int x) { return x * 24; }
+inline int f8467_25(int x) { return x * 25; }
+inline int f8467_26(int x) { return x * 26; }
+inline int f8467_27(int x) { return x * 27; }
+inline int f8467_28(int x) { return x * 28; }
+inline int f8467_29(int x) { return x * 29; }
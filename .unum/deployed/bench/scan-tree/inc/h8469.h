@@ -0,0 +1,42 @@
+#pragma once
+/* header 8469 */
+#include <vector>
+#include "h5031.h"
+#include "h6070.h"
+#include "h4566.h"
+#include "h1402.h"
+#include "h952.h"
+#ifdef X
+#include "h5209.h"
+#endif
+struct S8469 { int a; const char *s = "x//y"; };
+inline int f8469_0(int x) { return x * 0; }
+inline int f8469_1(int x) { return x * 1; }
+inline int f8469_2(int x) { return x * 2; }
+inline int f8469_3(int x) { return x * 3; }
+inline int f8469_4(int x) { return x * 4; }
+inline int f8469_5(int x) { return x * 5; }
+inline int f8469_6(int x) { return x * 6; }
+inline int f8469_7(int x) { return x * 7; }
+inline int f8469_8(int x) { return x * 8; }
+inline int f8469_9(int x) { return x * 9; }
+inline int f8469_10(int x) { return x * 10; }
+inline int f8469_11(int x) { return x * 11; }
+inline int f8469_12(int x) { return x * 12; }
+inline int f8469_13(int x) { return x * 13; }
+inline int f8469_14(int x) { return x * 14; }
+inline int f8469_15(int x) { return x * 15; }
+inline int f8469_16(int x) { return x * 16; }
+inline int f8469_17(int x) { return x * 17; }
+inline int f8469_18(int x) { return x * 18; }
+inline int f8469_19(int x) { return x * 19; }
+inline int f8469_20(int x) { return x * 20; }
+inline int f8469_21(int x) { return x * 21; }
+inline int f8469_22(int x) { return x * 22; }
+inline int f8469_23(int x) { return x * 23; }
+inline int f8469_24(int x) { return x * 24; }
+inline int f8469_25(int x) { return x * 25; }
+inline int f8469_26(int x) { return x * 26; }
+inline int f8469_27(int x) { return x * 27; }
+inline int f8469_28(int x) { return x * 28; }
+inline int f8469_29(int x) { return x * 29; }
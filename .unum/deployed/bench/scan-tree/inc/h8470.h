@@ -0,0 +1,42 @@
+#pragma once
+/* header 8470 */
+#include <vector>
+#include "h7777.h"
+#include "h3395.h"
+#include "h2633.h"
+#include "h9887.h"
+#include "h5630.h"
+#ifdef X
+#include "h3456.h"
+#endif
+struct S8470 { int a; const char *s = "x//y"; };
+inline int f8470_0(int x) { return x * 0; }
+inline int f8470_1(int x) { return x * 1; }
+inline int f8470_2(int x) { return x * 2; }
+inline int f8470_3(int x) { return x * 3; }
+inline int f8470_4(int x) { return x * 4; }
+inline int f8470_5(int x) { return x * 5; }
+inline int f8470_6(int x) { return x * 6; }
+inline int f8470_7(int x) { return x * 7; }
+inline int f8470_8(int x) { return x * 8; }
+inline int f8470_9(int x) { return x * 9; }
+inline int f8470_10(int x) { return x * 10; }
+inline int f8470_11(int x) { return x * 11; }
+inline int f8470_12(int x) { return x * 12; }
+inline int f8470_13(int x) { return x * 13; }
+inline int f8470_14(int x) { return x * 14; }
+inline int f8470_15(int x) { return x * 15; }
+inline int f8470_16(int x) { return x * 16; }
+inline int f8470_17(int x) { return x * 17; }
+inline int f8470_18(int x) { return x * 18; }
+inline int f8470_19(int x) { return x * 19; }
+inline int f8470_20(int x) { return x * 20; }
+inline int f8470_21(int x) { return x * 21; }
+inline int f8470_22(int x) { return x * 22; }
+inline int f8470_23(int x) { return x * 23; }
+inline int f8470_24(int x) { return x * 24; }
+inline int f8470_25(int x) { return x * 25; }
+inline int f8470_26(int x) { return x * 26; }
+inline int f8470_27(int x) { return x * 27; }
+inline int f8470_28(int x) { return x * 28; }
+inline int f8470_29(int x) { return x * 29; }
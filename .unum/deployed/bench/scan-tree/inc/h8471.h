@@ -0,0 +1,42 @@
+#pragma once
+/* header 8471 */
+#include <vector>
+#include "h1610.h"
+#include "h8946.h"
+#include "h7866.h"
+#include "h5580.h"
+#include "h5802.h"
+#ifdef X
+#include "h4871.h"
+#endif
+struct S8471 { int a; const char *s = "x//y"; };
+inline int f8471_0(int x) { return x * 0; }
+inline int f8471_1(int x) { return x * 1; }
+inline int f8471_2(int x) { return x * 2; }
+inline int f8471_3(int x) { return x * 3; }
+inline int f8471_4(int x) { return x * 4; }
+inline int f8471_5(int x) { return x * 5; }
+inline int f8471_6(int x) { return x * 6; }
+inline int f8471_7(int x) { return x * 7; }
+inline int f8471_8(int x) { return x * 8; }
+inline int f8471_9(int x) { return x * 9; }
+inline int f8471_10(int x) { return x * 10; }
+inline int f8471_11(int x) { return x * 11; }
+inline int f8471_12(int x) { return x * 12; }
+inline int f8471_13(int x) { return x * 13; }
+inline int f8471_14(int x) { return x * 14; }
+inline int f8471_15(int x) { return x * 15; }
+inline int f8471_16(int x) { return x * 16; }
+inline int f8471_17(int x) { return x * 17; }
+inline int f8471_18(int x) { return x * 18; }
+inline int f8471_19(int x) { return x * 19; }
+inline int f8471_20(int x) { return x * 20; }
+inline int f8471_21(int x) { return x * 21; }
+inline int f8471_22(int x) { return x * 22; }
+inline int f8471_23(int x) { return x * 23; }
+inline int f8471_24(int x) { return x * 24; }
+inline int f8471_25(int x) { return x * 25; }
+inline int f8471_26(int x) { return x * 26; }
+inline int f8471_27(int x) { return x * 27; }
+inline int f8471_28(int x) { return x * 28; }
+inline int f8471_29(int x) { return x * 29; }
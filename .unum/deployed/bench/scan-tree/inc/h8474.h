@@ -0,0 +1,42 @@
+#pragma once
+/* header 8474 */
+#include <vector>
+#include "h6858.h"
+#include "h5946.h"
+#include "h1007.h"
+#include "h5786.h"
+#include "h7252.h"
+#ifdef X
+#include "h6641.h"
+#endif
+struct S8474 { int a; const char *s = "x//y"; };
+inline int f8474_0(int x) { return x * 0; }
+inline int f8474_1(int x) { return x * 1; }
+inline int f8474_2(int x) { return x * 2; }
+inline int f8474_3(int x) { return x * 3; }
+inline int f8474_4(int x) { return x * 4; }
+inline int f8474_5(int x) { return x * 5; }
+inline int f8474_6(int x) { return x * 6; }
+inline int f8474_7(int x) { return x * 7; }
+inline int f8474_8(int x) { return x * 8; }
+inline int f8474_9(int x) { return x * 9; }
+inline int f8474_10(int x) { return x * 10; }
+inline int f8474_11(int x) { return x * 11; }
+inline int f8474_12(int x) { return x * 12; }
+inline int f8474_13(int x) { return x * 13; }
+inline int f8474_14(int x) { return x * 14; }
+inline int f8474_15(int x) { return x * 15; }
+inline int f8474_16(int x) { return x * 16; }
+inline int f8474_17(int x) { return x * 17; }
+inline int f8474_18(int x) { return x * 18; }
+inline int f8474_19(int x) { return x * 19; }
+inline int f8474_20(int x) { return x * 20; }
+inline int f8474_21(int x) { return x * 21; }
+inline int f8474_22(int x) { return x * 22; }
+inline int f8474_23(int x) { return x * 23; }
+inline int f8474_24(int x) { return x * 24; }
+inline int f8474_25(int x) { return x * 25; }
+inline int f8474_26(int x) { return x * 26; }
+inline int f8474_27(int x) { return x * 27; }
+inline int f8474_28(int x) { return x * 28; }
+inline int f8474_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8476 */
+#include <vector>
+#include "h6649.h"
+#include "h9673.h"
+#include "h4586.h"
+#include "h1436.h"
+#include "h6831.h"
+#ifdef X
+#include "h4344.h"
+#endif
+struct S8476 { int a; const char *s = "x//y"; };
+inline int f8476_0(int x) { return x * 0; }
+inline int f8476_1(int x) { return x * 1; }
+inline int f8476_2(int x) { return x * 2; }
+inline int f8476_3(int x) { return x * 3; }
+inline int f8476_4(int x) { return x * 4; }
+inline int f8476_5(int x) { return x * 5; }
+inline int f8476_6(int x) { return x * 6; }
+inline int f8476_7(int x) { return x * 7; }
+inline int f8476_8(int x) { return x * 8; }
+inline int f8476_9(int x) { return x * 9; }
+inline int f8476_10(int x) { return x * 10; }
+inline int f8476_11(int x) { return x * 11; }
+inline int f8476_12(int x) { return x * 12; }
+inline int f8476_13(int x) { return x * 13; }
+inline int f8476_14(int x) { return x * 14; }
+inline int f8476_15(int x) { return x * 15; }
+inline int f8476_16(int x) { return x * 16; }
+inline int f8476_17(int x) { return x * 17; }
+inline int f8476_18(int x) { return x * 18; }
+inline int f8476_19(int x) { return x * 19; }
+inline int f8476_20(int x) { return x * 20; }
+inline int f8476_21(int x) { return x * 21; }
+inline int f8476_22(int x) { return x * 22; }
+inline int f8476_23(int x) { return x * 23; }
+inline int f8476_24(int x) { return x * 24; }
+inline int f8476_25(int x) { return x * 25; }
+inline int f8476_26(int x) { return x * 26; }
+inline int f8476_27(int x) { return x * 27; }
+inline int f8476_28(int x) { return x * 28; }
+inline int f8476_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8477 */
+#include <vector>
+#include "h8607.h"
+#include "h7284.h"
+#include "h4208.h"
+#include "h2577.h"
+#include "h2821.h"
+#ifdef X
+#include "h696.h"
+#endif
+struct S8477 { int a; const char *s = "x//y"; };
+inline int f8477_0(int x) { return x * 0; }
+inline int f8477_1(int x) { return x * 1; }
+inline int f8477_2(int x) { return x * 2; }
+inline int f8477_3(int x) { return x * 3; }
+inline int f8477_4(int x) { return x * 4; }
+inline int f8477_5(int x) { return x * 5; }
+inline int f8477_6(int x) { return x * 6; }
+inline int f8477_7(int x) { return x * 7; }
+inline int f8477_8(int x) { return x * 8; }
+inline int f8477_9(int x) { return x * 9; }
+inline int f8477_10(int x) { return x * 10; }
+inline int f8477_11(int x) { return x * 11; }
+inline int f8477_12(int x) { return x * 12; }
+inline int f8477_13(int x) { return x * 13; }
+inline int f8477_14(int x) { return x * 14; }
+inline int f8477_15(int x) { return x * 15; }
+inline int f8477_16(int x) { return x * 16; }
+inline int f8477_17(int x) { return x * 17; }
+inline int f8477_18(int x) { return x * 18; }
+inline int f8477_19(int x) { return x * 19; }
+inline int f8477_20(int x) { return x * 20; }
+inline int f8477_21(int x) { return x * 21; }
+inline int f8477_22(int x) { return x * 22; }
+inline int f8477_23(int x) { return x * 23; }
+inline int f8477_24(int x) { return x * 24; }
+inline int f8477_25(int x) { return x * 25; }
+inline int f8477_26(int x) { return x * 26; }
+inline int f8477_27(int x) { return x * 27; }
+inline int f8477_28(int x) { return x * 28; }
+inline int f8477_29(int x) { return x * 29; }
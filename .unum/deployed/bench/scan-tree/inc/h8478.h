@@ -0,0 +1,42 @@
+#pragma once
+/* header 8478 */
+#include <vector>
+#include "h5156.h"
+#include "h2820.h"
+#include "h7460.h"
+#include "h8999.h"
+#include "h1337.h"
+#ifdef X
+#include "h4773.h"
+#endif
+struct S8478 { int a; const char *s = "x//y"; };
+inline int f8478_0(int x) { return x * 0; }
+inline int f8478_1(int x) { return x * 1; }
+inline int f8478_2(int x) { return x * 2; }
+inline int f8478_3(int x) { return x * 3; }
+inline int f8478_4(int x) { return x * 4; }
+inline int f8478_5(int x) { return x * 5; }
+inline int f8478_6(int x) { return x * 6; }
+inline int f8478_7(int x) { return x * 7; }
+inline int f8478_8(int x) { return x * 8; }
+inline int f8478_9(int x) { return x * 9; }
+inline int f8478_10(int x) { return x * 10; }
+inline int f8478_11(int x) { return x * 11; }
+inline int f8478_12(int x) { return x * 12; }
+inline int f8478_13(int x) { return x * 13; }
+inline int f8478_14(int x) { return x * 14; }
+inline int f8478_15(int x) { return x * 15; }
+inline int f8478_16(int x) { return x * 16; }
+inline int f8478_17(int x) { return x * 17; }
+inline int f8478_18(int x) { return x * 18; }
+inline int f8478_19(int x) { return x * 19; }
+inline int f8478_20(int x) { return x * 20; }
+inline int f8478_21(int x) { return x * 21; }
+inline int f8478_22(int x) { return x * 22; }
+inline int f8478_23(int x) { return x * 23; }
+inline int f8478_24(int x) { return x * 24; }
+inline int f8478_25(int x) { return x * 25; }
+inline int f8478_26(int x) { return x * 26; }
+inline int f8478_27(int x) { return x * 27; }
+inline int f8478_28(int x) { return x * 28; }
+inline int f8478_29(int x) { return x * 29; }
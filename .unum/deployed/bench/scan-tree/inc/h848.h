@@ -0,0 +1,42 @@
+#pragma once
+/* header 848 */
+#include <vector>
+#include "h2529.h"
+#include "h4390.h"
+#include "h6275.h"
+#include "h9214.h"
+#include "h6207.h"
+#ifdef X
+#include "h3523.h"
+#endif
+struct S848 { int a; const char *s = "x//y"; };
+inline int f848_0(int x) { return x * 0; }
+inline int f848_1(int x) { return x * 1; }
+inline int f848_2(int x) { return x * 2; }
+inline int f848_3(int x) { return x * 3; }
+inline int f848_4(int x) { return x * 4; }
+inline int f848_5(int x) { return x * 5; }
+inline int f848_6(int x) { return x * 6; }
+inline int f848_7(int x) { return x * 7; }
+inline int f848_8(int x) { return x * 8; }
+inline int f848_9(int x) { return x * 9; }
+inline int f848_10(int x) { return x * 10; }
+inline int f848_11(int x) { return x * 11; }
+inline int f848_12(int x) { return x * 12; }
+inline int f848_13(int x) { return x * 13; }
+inline int f848_14(int x) { return x * 14; }
+inline int f848_15(int x) { return x * 15; }
+inline int f848_16(int x) { return x * 16; }
+inline int f848_17(int x) { return x * 17; }
+inline int f848_18(int x) { return x * 18; }
+inline int f848_19(int x) { return x * 19; }
+inline int f848_20(int x) { return x * 20; }
+inline int f848_21(int x) { return x * 21; }
+inline int f848_22(int x) { return x * 22; }
+inline int f848_23(int x) { return x * 23; }
+inline int f848_24(int x) { return x * 24; }
+inline int f848_25(int x) { return x * 25; }
+inline int f848_26(int x) { return x * 26; }
+inline int f848_27(int x) { return x * 27; }
+inline int f848_28(int x) { return x * 28; }
+inline int f848_29(int x) { return x * 29; }
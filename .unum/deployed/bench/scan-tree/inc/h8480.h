@@ -0,0 +1,42 @@
+#pragma once
+/* header 8480 */
+#include <vector>
+#include "h9533.h"
+#include "h106.h"
+#include "h320.h"
+#include "h2335.h"
+#include "h5184.h"
+#ifdef X
+#include "h2972.h"
+#endif
+struct S8480 { int a; const char *s = "x//y"; };
+inline int f8480_0(int x) { return x * 0; }
+inline int f8480_1(int x) { return x * 1; }
+inline int f8480_2(int x) { return x * 2; }
+inline int f8480_3(int x) { return x * 3; }
+inline int f8480_4(int x) { return x * 4; }
+inline int f8480_5(int x) { return x * 5; }
+inline int f8480_6(int x) { return x * 6; }
+inline int f8480_7(int x) { return x * 7; }
+inline int f8480_8(int x) { return x * 8; }
+inline int f8480_9(int x) { return x * 9; }
+inline int f8480_10(int x) { return x * 10; }
+inline int f8480_11(int x) { return x * 11; }
+inline int f8480_12(int x) { return x * 12; }
+inline int f8480_13(int x) { return x * 13; }
+inline int f8480_14(int x) { return x * 14; }
+inline int f8480_15(int x) { return x * 15; }
+inline int f8480_16(int x) { return x * 16; }
+inline int f8480_17(int x) { return x * 17; }
+inline int f8480_18(int x) { return x * 18; }
+inline int f8480_19(int x) { return x * 19; }
+inline int f8480_20(int x) { return x * 20; }
+inline int f8480_21(int x) { return x * 21; }
+inline int f8480_22(int x) { return x * 22; }
+inline int f8480_23(int x) { return x * 23; }
+inline int f8480_24(int x) { return x * 24; }
+inline int f8480_25(int x) { return x * 25; }
+inline int f8480_26(int x) { return x * 26; }
+inline int f8480_27(int x) { return x * 27; }
+inline int f8480_28(int x) { return x * 28; }
+inline int f8480_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8483 */
+#include <vector>
+#include "h2422.h"
+#include "h4781.h"
+#include "h3040.h"
+#include "h7553.h"
+#include "h968.h"
+#ifdef X
+#include "h6728.h"
+#endif
+struct S8483 { int a; const char *s = "x//y"; };
+inline int f8483_0(int x) { return x * 0; }
+inline int f8483_1(int x) { return x * 1; }
+inline int f8483_2(int x) { return x * 2; }
+inline int f8483_3(int x) { return x * 3; }
+inline int f8483_4(int x) { return x * 4; }
+inline int f8483_5(int x) { return x * 5; }
+inline int f8483_6(int x) { return x * 6; }
+inline int f8483_7(int x) { return x * 7; }
+inline int f8483_8(int x) { return x * 8; }
+inline int f8483_9(int x) { return x * 9; }
+inline int f8483_10(int x) { return x * 10; }
+inline int f8483_11(int x) { return x * 11; }
+inline int f8483_12(int x) { return x * 12; }
+inline int f8483_13(int x) { return x * 13; }
+inline int f8483_14(int x) { return x * 14; }
+inline int f8483_15(int x) { return x * 15; }
+inline int f8483_16(int x) { return x * 16; }
+inline int f8483_17(int x) { return x * 17; }
+inline int f8483_18(int x) { return x * 18; }
+inline int f8483_19(int x) { return x * 19; }
+inline int f8483_20(int x) { return x * 20; }
+inline int f8483_21(int x) { return x * 21; }
+inline int f8483_22(int x) { return x * 22; }
+inline int f8483_23(int x) { return x * 23; }
+inline int f8483_24(int x) { return x * 24; }
+inline int f8483_25(int x) { return x * 25; }
+inline int f8483_26(int x) { return x * 26; }
+inline int f8483_27(int x) { return x * 27; }
+inline int f8483_28(int x) { return x * 28; }
+inline int f8483_29(int x) { return x * 29; }
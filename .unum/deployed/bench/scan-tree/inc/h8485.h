@@ -0,0 +1,42 @@
+#pragma once
+/* header 8485 */
+#include <vector>
+#include "h9672.h"
+#include "h3743.h"
+#include "h6013.h"
+#include "h2159.h"
+#include "h4559.h"
+#ifdef X
+#include "h6348.h"
+#endif
+struct S8485 { int a; const char *s = "x//y"; };
+inline int f8485_0(int x) { return x * 0; }
+inline int f8485_1(int x) { return x * 1; }
+inline int f8485_2(int x) { return x * 2; }
+inline int f8485_3(int x) { return x * 3; }
+inline int f8485_4(int x) { return x * 4; }
+inline int f8485_5(int x) { return x * 5; }
+inline int f8485_6(int x) { return x * 6; }
+inline int f8485_7(int x) { return x * 7; }
+inline int f8485_8(int x) { return x * 8; }
+inline int f8485_9(int x) { return x * 9; }
+inline int f8485_10(int x) { return x * 10; }
+inline int f8485_11(int x) { return x * 11; }
+inline int f8485_12(int x) { return x * 12; }
+inline int f8485_13(int x) { return x * 13; }
+inline int f8485_14(int x) { return x * 14; }
+inline int f8485_15(int x) { return x * 15; }
+inline int f8485_16(int x) { return x * 16; }
+inline int f8485_17(int x) { return x * 17; }
+inline int f8485_18(int x) { return x * 18; }
+inline int f8485_19(int x) { return x * 19; }
+inline int f8485_20(int x) { return x * 20; }
+inline int f8485_21(int x) { return x * 21; }
+inline int f8485_22(int x) { return x * 22; }
+inline int f8485_23(int x) { return x * 23; }
+inline int f8485_24(int x) { return x * 24; }
+inline int f8485_25(int x) { return x * 25; }
+inline int f8485_26(int x) { return x * 26; }
+inline int f8485_27(int x) { return x * 27; }
+inline int f8485_28(int x) { return x * 28; }
+inline int f8485_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8486 */
+#include <vector>
+#include "h8041.h"
+#include "h4362.h"
+#include "h7104.h"
+#include "h2664.h"
+#include "h1361.h"
+#ifdef X
+#include "h7593.h"
+#endif
+struct S8486 { int a; const char *s = "x//y"; };
+inline int f8486_0(int x) { return x * 0; }
+inline int f8486_1(int x) { return x * 1; }
+inline int f8486_2(int x) { return x * 2; }
+inline int f8486_3(int x) { return x * 3; }
+inline int f8486_4(int x) { return x * 4; }
+inline int f8486_5(int x) { return x * 5; }
+inline int f8486_6(int x) { return x * 6; }
+inline int f8486_7(int x) { return x * 7; }
+inline int f8486_8(int x) { return x * 8; }
+inline int f8486_9(int x) { return x * 9; }
+inline int f8486_10(int x) { return x * 10; }
+inline int f8486_11(int x) { return x * 11; }
+inline int f8486_12(int x) { return x * 12; }
+inline int f8486_13(int x) { return x * 13; }
+inline int f8486_14(int x) { return x * 14; }
+inline int f8486_15(int x) { return x * 15; }
+inline int f8486_16(int x) { return x * 16; }
+inline int f8486_17(int x) { return x * 17; }
+inline int f8486_18(int x) { return x * 18; }
+inline int f8486_19(int x) { return x * 19; }
+inline int f8486_20(int x) { return x * 20; }
+inline int f8486_21(int x) { return x * 21; }
+inline int f8486_22(int x) { return x * 22; }
+inline int f8486_23(int x) { return x * 23; }
+inline int f8486_24(int x) { return x * 24; }
+inline int f8486_25(int x) { return x * 25; }
+inline int f8486_26(int x) { return x * 26; }
+inline int f8486_27(int x) { return x * 27; }
+inline int f8486_28(int x) { return x * 28; }
+inline int f8486_29(int x) { return x * 29; }
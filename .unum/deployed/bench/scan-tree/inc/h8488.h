@@ -0,0 +1,42 @@
+#pragma once
+/* header 8488 */
+#include <vector>
+#include "h9394.h"
+#include "h8661.h"
+#include "h6772.h"
+#include "h4315.h"
+#include "h8877.h"
+#ifdef X
+#include "h4508.h"
+#endif
+struct S8488 { int a; const char *s = "x//y"; };
+inline int f8488_0(int x) { return x * 0; }
+inline int f8488_1(int x) { return x * 1; }
+inline int f8488_2(int x) { return x * 2; }
+inline int f8488_3(int x) { return x * 3; }
+inline int f8488_4(int x) { return x * 4; }
+inline int f8488_5(int x) { return x * 5; }
+inline int f8488_6(int x) { return x * 6; }
+inline int f8488_7(int x) { return x * 7; }
+inline int f8488_8(int x) { return x * 8; }
+inline int f8488_9(int x) { return x * 9; }
+inline int f8488_10(int x) { return x * 10; }
+inline int f8488_11(int x) { return x * 11; }
+inline int f8488_12(int x) { return x * 12; }
+inline int f8488_13(int x) { return x * 13; }
+inline int f8488_14(int x) { return x * 14; }
+inline int f8488_15(int x) { return x * 15; }
+inline int f8488_16(int x) { return x * 16; }
+inline int f8488_17(int x) { return x * 17; }
+inline int f8488_18(int x) { return x * 18; }
+inline int f8488_19(int x) { return x * 19; }
+inline int f8488_20(int x) { return x * 20; }
+inline int f8488_21(int x) { return x * 21; }
+inline int f8488_22(int x) { return x * 22; }
+inline int f8488_23(int x) { return x * 23; }
+inline int f8488_24(int x) { return x * 24; }
+inline int f8488_25(int x) { return x * 25; }
+inline int f8488_26(int x) { return x * 26; }
+inline int f8488_27(int x) { return x * 27; }
+inline int f8488_28(int x) { return x * 28; }
+inline int f8488_29(int x) { return x * 29; }
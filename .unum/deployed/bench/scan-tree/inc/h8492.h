@@ -0,0 +1,42 @@
+#pragma once
+/* header 8492 */
+#include <vector>
+#include "h3741.h"
+#include "h9173.h"
+#include "h6505.h"
+#include "h7350.h"
+#include "h6614.h"
+#ifdef X
+#include "h6360.h"
+#endif
+struct S8492 { int a; const char *s = "x//y"; };
+inline int f8492_0(int x) { return x * 0; }
+inline int f8492_1(int x) { return x * 1; }
+inline int f8492_2(int x) { return x * 2; }
+inline int f8492_3(int x) { return x * 3; }
+inline int f8492_4(int x) { return x * 4; }
+inline int f8492_5(int x) { return x * 5; }
+inline int f8492_6(int x) { return x * 6; }
+inline int f8492_7(int x) { return x * 7; }
+inline int f8492_8(int x) { return x * 8; }
+inline int f8492_9(int x) { return x * 9; }
+inline int f8492_10(int x) { return x * 10; }
+inline int f8492_11(int x) { return x * 11; }
+inline int f8492_12(int x) { return x * 12; }
+inline int f8492_13(int x) { return x * 13; }
+inline int f8492_14(int x) { return x * 14; }
+inline int f8492_15(int x) { return x * 15; }
+inline int f8492_16(int x) { return x * 16; }
+inline int f8492_17(int x) { return x * 17; }
+inline int f8492_18(int x) { return x * 18; }
+inline int f8492_19(int x) { return x * 19; }
+inline int f8492_20(int x) { return x * 20; }
+inline int f8492_21(int x) { return x * 21; }
+inline int f8492_22(int x) { return x * 22; }
+inline int f8492_23(int x) { return x * 23; }
+inline int f8492_24(int x) { return x * 24; }
+inline int f8492_25(int x) { return x * 25; }
+inline int f8492_26(int x) { return x * 26; }
+inline int f8492_27(int x) { return x * 27; }
+inline int f8492_28(int x) { return x * 28; }
+inline int f8492_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8498 */
+#include <vector>
+#include "h2648.h"
+#include "h9257.h"
+#include "h1550.h"
+#include "h9543.h"
+#include "h600.h"
+#ifdef X
+#include "h3981.h"
+#endif
+struct S8498 { int a; const char *s = "x//y"; };
+inline int f8498_0(int x) { return x * 0; }
+inline int f8498_1(int x) { return x * 1; }
+inline int f8498_2(int x) { return x * 2; }
+inline int f8498_3(int x) { return x * 3; }
+inline int f8498_4(int x) { return x * 4; }
+inline int f8498_5(int x) { return x * 5; }
+inline int f8498_6(int x) { return x * 6; }
+inline int f8498_7(int x) { return x * 7; }
+inline int f8498_8(int x) { return x * 8; }
+inline int f8498_9(int x) { return x * 9; }
+inline int f8498_10(int x) { return x * 10; }
+inline int f8498_11(int x) { return x * 11; }
+inline int f8498_12(int x) { return x * 12; }
+inline int f8498_13(int x) { return x * 13; }
+inline int f8498_14(int x) { return x * 14; }
+inline int f8498_15(int x) { return x * 15; }
+inline int f8498_16(int x) { return x * 16; }
+inline int f8498_17(int x) { return x * 17; }
+inline int f8498_18(int x) { return x * 18; }
+inline int f8498_19(int x) { return x * 19; }
+inline int f8498_20(int x) { return x * 20; }
+inline int f8498_21(int x) { return x * 21; }
+inline int f8498_22(int x) { return x * 22; }
+inline int f8498_23(int x) { return x * 23; }
+inline int f8498_24(int x) { return x * 24; }
+inline int f8498_25(int x) { return x * 25; }
+inline int f8498_26(int x) { return x * 26; }
+inline int f8498_27(int x) { return x * 27; }
+inline int f8498_28(int x) { return x * 28; }
+inline int f8498_29(int x) { return x * 29; }
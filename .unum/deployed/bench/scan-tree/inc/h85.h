@@ -0,0 +1,42 @@
+#pragma once
+/* header 85 */
+#include <vector>
+#include "h4427.h"
+#include "h411.h"
+#include "h3066.h"
+#include "h1572.h"
+#include "h6432.h"
+#ifdef X
+#include "h1289.h"
+#endif
+struct S85 { int a; const char *s = "x//y"; };
+inline int f85_0(int x) { return x * 0; }
+inline int f85_1(int x) { return x * 1; }
+inline int f85_2(int x) { return x * 2; }
+inline int f85_3(int x) { return x * 3; }
+inline int f85_4(int x) { return x * 4; }
+inline int f85_5(int x) { return x * 5; }
+inline int f85_6(int x) { return x * 6; }
+inline int f85_7(int x) { return x * 7; }
+inline int f85_8(int x) { return x * 8; }
+inline int f85_9(int x) { return x * 9; }
+inline int f85_10(int x) { return x * 10; }
+inline int f85_11(int x) { return x * 11; }
+inline int f85_12(int x) { return x * 12; }
+inline int f85_13(int x) { return x * 13; }
+inline int f85_14(int x) { return x * 14; }
+inline int f85_15(int x) { return x * 15; }
+inline int f85_16(int x) { return x * 16; }
+inline int f85_17(int x) { return x * 17; }
+inline int f85_18(int x) { return x * 18; }
+inline int f85_19(int x) { return x * 19; }
+inline int f85_20(int x) { return x * 20; }
+inline int f85_21(int x) { return x * 21; }
+inline int f85_22(int x) { return x * 22; }
+inline int f85_23(int x) { return x * 23; }
+inline int f85_24(int x) { return x * 24; }
+inline int f85_25(int x) { return x * 25; }
+inline int f85_26(int x) { return x * 26; }
+inline int f85_27(int x) { return x * 27; }
+inline int f85_28(int x) { return x * 28; }
+inline int f85_29(int x) { return x * 29; }
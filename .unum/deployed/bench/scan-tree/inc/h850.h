@@ -0,0 +1,42 @@
+#pragma once
+/* header 850 */
+#include <vector>
+#include "h4548.h"
+#include "h3233.h"
+#include "h5465.h"
+#include "h7303.h"
+#include "h2164.h"
+#ifdef X
+#include "h9446.h"
+#endif
+struct S850 { int a; const char *s = "x//y"; };
+inline int f850_0(int x) { return x * 0; }
+inline int f850_1(int x) { return x * 1; }
+inline int f850_2(int x) { return x * 2; }
+inline int f850_3(int x) { return x * 3; }
+inline int f850_4(int x) { return x * 4; }
+inline int f850_5(int x) { return x * 5; }
+inline int f850_6(int x) { return x * 6; }
+inline int f850_7(int x) { return x * 7; }
+inline int f850_8(int x) { return x * 8; }
+inline int f850_9(int x) { return x * 9; }
+inline int f850_10(int x) { return x * 10; }
+inline int f850_11(int x) { return x * 11; }
+inline int f850_12(int x) { return x * 12; }
+inline int f850_13(int x) { return x * 13; }
+inline int f850_14(int x) { return x * 14; }
+inline int f850_15(int x) { return x * 15; }
+inline int f850_16(int x) { return x * 16; }
+inline int f850_17(int x) { return x * 17; }
+inline int f850_18(int x) { return x * 18; }
+inline int f850_19(int x) { return x * 19; }
+inline int f850_20(int x) { return x * 20; }
+inline int f850_21(int x) { return x * 21; }
+inline int f850_22(int x) { return x * 22; }
+inline int f850_23(int x) { return x * 23; }
+inline int f850_24(int x) { return x * 24; }
+inline int f850_25(int x) { return x * 25; }
+inline int f850_26(int x) { return x * 26; }
+inline int f850_27(int x) { return x * 27; }
+inline int f850_28(int x) { return x * 28; }
+inline int f850_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8500 */
+#include <vector>
+#include "h3118.h"
+#include "h4506.h"
+#include "h9557.h"
+#include "h4410.h"
+#include "h422.h"
+#ifdef X
+#include "h5370.h"
+#endif
+struct S8500 { int a; const char *s = "x//y"; };
+inline int f8500_0(int x) { return x * 0; }
+inline int f8500_1(int x) { return x * 1; }
+inline int f8500_2(int x) { return x * 2; }
+inline int f8500_3(int x) { return x * 3; }
+inline int f8500_4(int x) { return x * 4; }
+inline int f8500_5(int x) { return x * 5; }
+inline int f8500_6(int x) { return x * 6; }
+inline int f8500_7(int x) { return x * 7; }
+inline int f8500_8(int x) { return x * 8; }
+inline int f8500_9(int x) { return x * 9; }
+inline int f8500_10(int x) { return x * 10; }
+inline int f8500_11(int x) { return x * 11; }
+inline int f8500_12(int x) { return x * 12; }
+inline int f8500_13(int x) { return x * 13; }
+inline int f8500_14(int x) { return x * 14; }
+inline int f8500_15(int x) { return x * 15; }
+inline int f8500_16(int x) { return x * 16; }
+inline int f8500_17(int x) { return x * 17; }
+inline int f8500_18(int x) { return x * 18; }
+inline int f8500_19(int x) { return x * 19; }
+inline int f8500_20(int x) { return x * 20; }
+inline int f8500_21(int x) { return x * 21; }
+inline int f8500_22(int x) { return x * 22; }
+inline int f8500_23(int x) { return x * 23; }
+inline int f8500_24(int x) { return x * 24; }
+inline int f8500_25(int x) { return x * 25; }
+inline int f8500_26(int x) { return x * 26; }
+inline int f8500_27(int x) { return x * 27; }
+inline int f8500_28(int x) { return x * 28; }
+inline int f8500_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8502 */
+#include <vector>
+#include "h5318.h"
+#include "h6861.h"
+#include "h9451.h"
+#include "h2742.h"
+#include "h3898.h"
+#ifdef X
+#include "h5069.h"
+#endif
+struct S8502 { int a; const char *s = "x//y"; };
+inline int f8502_0(int x) { return x * 0; }
+inline int f8502_1(int x) { return x * 1; }
+inline int f8502_2(int x) { return x * 2; }
+inline int f8502_3(int x) { return x * 3; }
+inline int f8502_4(int x) { return x * 4; }
+inline int f8502_5(int x) { return x * 5; }
+inline int f8502_6(int x) { return x * 6; }
+inline int f8502_7(int x) { return x * 7; }
+inline int f8502_8(int x) { return x * 8; }
+inline int f8502_9(int x) { return x * 9; }
+inline int f8502_10(int x) { return x * 10; }
+inline int f8502_11(int x) { return x * 11; }
+inline int f8502_12(int x) { return x * 12; }
+inline int f8502_13(int x) { return x * 13; }
+inline int f8502_14(int x) { return x * 14; }
+inline int f8502_15(int x) { return x * 15; }
+inline int f8502_16(int x) { return x * 16; }
+inline int f8502_17(int x) { return x * 17; }
+inline int f8502_18(int x) { return x * 18; }
+inline int f8502_19(int x) { return x * 19; }
+inline int f8502_20(int x) { return x * 20; }
+inline int f8502_21(int x) { return x * 21; }
+inline int f8502_22(int x) { return x * 22; }
+inline int f8502_23(int x) { return x * 23; }
+inline int f8502_24(int x) { return x * 24; }
+inline int f8502_25(int x) { return x * 25; }
+inline int f8502_26(int x) { return x * 26; }
+inline int f8502_27(int x) { return x * 27; }
+inline int f8502_28(int x) { return x * 28; }
+inline int f8502_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8503 */
+#include <vector>
+#include "h8625.h"
+#include "h4177.h"
+#include "h7904.h"
+#include "h4927.h"
+#include "h1574.h"
+#ifdef X
+#include "h1600.h"
+#endif
+struct S8503 { int a; const char *s = "x//y"; };
+inline int f8503_0(int x) { return x * 0; }
+inline int f8503_1(int x) { return x * 1; }
+inline int f8503_2(int x) { return x * 2; }
+inline int f8503_3(int x) { return x * 3; }
+inline int f8503_4(int x) { return x * 4; }
+inline int f8503_5(int x) { return x * 5; }
+inline int f8503_6(int x) { return x * 6; }
+inline int f8503_7(int x) { return x * 7; }
+inline int f8503_8(int x) { return x * 8; }
+inline int f8503_9(int x) { return x * 9; }
+inline int f8503_10(int x) { return x * 10; }
+inline int f8503_11(int x) { return x * 11; }
+inline int f8503_12(int x) { return x * 12; }
+inline int f8503_13(int x) { return x * 13; }
+inline int f8503_14(int x) { return x * 14; }
+inline int f8503_15(int x) { return x * 15; }
+inline int f8503_16(int x) { return x * 16; }
+inline int f8503_17(int x) { return x * 17; }
+inline int f8503_18(int x) { return x * 18; }
+inline int f8503_19(int x) { return x * 19; }
+inline int f8503_20(int x) { return x * 20; }
+inline int f8503_21(int x) { return x * 21; }
+inline int f8503_22(int x) { return x * 22; }
+inline int f8503_23(int x) { return x * 23; }
+inline int f8503_24(int x) { return x * 24; }
+inline int f8503_25(int x) { return x * 25; }
+inline int f8503_26(int x) { return x * 26; }
+inline int f8503_27(int x) { return x * 27; }
+inline int f8503_28(int x) { return x * 28; }
+inline int f8503_29(int x) { return x * 29; }
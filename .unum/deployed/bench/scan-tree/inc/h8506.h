@@ -0,0 +1,42 @@
+#pragma once
+/* header 8506 */
+#include <vector>
+#include "h1946.h"
+#include "h7570.h"
+#include "h7263.h"
+#include "h817.h"
+#include "h6424.h"
+#ifdef X
+#include "h3259.h"
+#endif
+struct S8506 { int a; const char *s = "x//y"; };
+inline int f8506_0(int x) { return x * 0; }
+inline int f8506_1(int x) { return x * 1; }
+inline int f8506_2(int x) { return x * 2; }
+inline int f8506_3(int x) { return x * 3; }
+inline int f8506_4(int x) { return x * 4; }
+inline int f8506_5(int x) { return x * 5; }
+inline int f8506_6(int x) { return x * 6; }
+inline int f8506_7(int x) { return x * 7; }
+inline int f8506_8(int x) { return x * 8; }
+inline int f8506_9(int x) { return x * 9; }
+inline int f8506_10(int x) { return x * 10; }
+inline int f8506_11(int x) { return x * 11; }
+inline int f8506_12(int x) { return x * 12; }
+inline int f8506_13(int x) { return x * 13; }
+inline int f8506_14(int x) { return x * 14; }
+inline int f8506_15(int x) { return x * 15; }
+inline int f8506_16(int x) { return x * 16; }
+inline int f8506_17(int x) { return x * 17; }
+inline int f8506_18(int x) { return x * 18; }
+inline int f8506_19(int x) { return x * 19; }
+inline int f8506_20(int x) { return x * 20; }
+inline int f8506_21(int x) { return x * 21; }
+inline int f8506_22(int x) { return x * 22; }
+inline int f8506_23(int x) { return x * 23; }
+inline int f8506_24(int x) { return x * 24; }
+inline int f8506_25(int x) { return x * 25; }
+inline int f8506_26(int x) { return x * 26; }
+inline int f8506_27(int x) { return x * 27; }
+inline int f8506_28(int x) { return x * 28; }
+inline int f8506_29(int x) { return x * 29; }
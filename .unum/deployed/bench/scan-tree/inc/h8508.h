@@ -0,0 +1,42 @@
+#pragma once
+/* header 8508 */
+#include <vector>
+#include "h3912.h"
+#include "h32.h"
+#include "h1268.h"
+#include "h5793.h"
+#include "h3080.h"
+#ifdef X
+#include "h6760.h"
+#endif
+struct S8508 { int a; const char *s = "x//y"; };
+inline int f8508_0(int x) { return x * 0; }
+inline int f8508_1(int x) { return x * 1; }
+inline int f8508_2(int x) { return x * 2; }
+inline int f8508_3(int x) { return x * 3; }
+inline int f8508_4(int x) { return x * 4; }
+inline int f8508_5(int x) { return x * 5; }
+inline int f8508_6(int x) { return x * 6; }
+inline int f8508_7(int x) { return x * 7; }
+inline int f8508_8(int x) { return x * 8; }
+inline int f8508_9(int x) { return x * 9; }
+inline int f8508_10(int x) { return x * 10; }
+inline int f8508_11(int x) { return x * 11; }
+inline int f8508_12(int x) { return x * 12; }
+inline int f8508_13(int x) { return x * 13; }
+inline int f8508_14(int x) { return x * 14; }
+inline int f8508_15(int x) { return x * 15; }
+inline int f8508_16(int x) { return x * 16; }
+inline int f8508_17(int x) { return x * 17; }
+inline int f8508_18(int x) { return x * 18; }
+inline int f8508_19(int x) { return x * 19; }
+inline int f8508_20(int x) { return x * 20; }
+inline int f8508_21(int x) { return x * 21; }
+inline int f8508_22(int x) { return x * 22; }
+inline int f8508_23(int x) { return x * 23; }
+inline int f8508_24(int x) { return x * 24; }
+inline int f8508_25(int x) { return x * 25; }
+inline int f8508_26(int x) { return x * 26; }
+inline int f8508_27(int x) { return x * 27; }
+inline int f8508_28(int x) { return x * 28; }
+inline int f8508_29(int x) { return x * 29; }
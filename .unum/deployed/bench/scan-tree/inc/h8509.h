@@ -0,0 +1,42 @@
+#pragma once
+/* header 8509 */
+#include <vector>
+#include "h7413.h"
+#include "h1077.h"
+#include "h9039.h"
+#include "h9845.h"
+#include "h8276.h"
+#ifdef X
+#include "h3395.h"
+#endif
+struct S8509 { int a; const char *s = "x//y"; };
+inline int f8509_0(int x) { return x * 0; }
+inline int f8509_1(int x) { return x * 1; }
+inline int f8509_2(int x) { return x * 2; }
+inline int f8509_3(int x) { return x * 3; }
+inline int f8509_4(int x) { return x * 4; }
+inline int f8509_5(int x) { return x * 5; }
+inline int f8509_6(int x) { return x * 6; }
+inline int f8509_7(int x) { return x * 7; }
+inline int f8509_8(int x) { return x * 8; }
+inline int f8509_9(int x) { return x * 9; }
+inline int f8509_10(int x) { return x * 10; }
+inline int f8509_11(int x) { return x * 11; }
+inline int f8509_12(int x) { return x * 12; }
+inline int f8509_13(int x) { return x * 13; }
+inline int f8509_14(int x) { return x * 14; }
+inline int f8509_15(int x) { return x * 15; }
+inline int f8509_16(int x) { return x * 16; }
+inline int f8509_17(int x) { return x * 17; }
+inline int f8509_18(int x) { return x * 18; }
+inline int f8509_19(int x) { return x * 19; }
+inline int f8509_20(int x) { return x * 20; }
+inline int f8509_21(int x) { return x * 21; }
+inline int f8509_22(int x) { return x * 22; }
+inline int f8509_23(int x) { return x * 23; }
+inline int f8509_24(int x) { return x * 24; }
+inline int f8509_25(int x) { return x * 25; }
+inline int f8509_26(int x) { return x * 26; }
+inline int f8509_27(int x) { return x * 27; }
+inline int f8509_28(int x) { return x * 28; }
+inline int f8509_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 851 */
+#include <vector>
+#include "h9550.h"
+#include "h9296.h"
+#include "h1959.h"
+#include "h3085.h"
+#include "h4007.h"
+#ifdef X
+#include "h2763.h"
+#endif
+struct S851 { int a; const char *s = "x//y"; };
+inline int f851_0(int x) { return x * 0; }
+inline int f851_1(int x) { return x * 1; }
+inline int f851_2(int x) { return x * 2; }
+inline int f851_3(int x) { return x * 3; }
+inline int f851_4(int x) { return x * 4; }
+inline int f851_5(int x) { return x * 5; }
+inline int f851_6(int x) { return x * 6; }
+inline int f851_7(int x) { return x * 7; }
+inline int f851_8(int x) { return x * 8; }
+inline int f851_9(int x) { return x * 9; }
+inline int f851_10(int x) { return x * 10; }
+inline int f851_11(int x) { return x * 11; }
+inline int f851_12(int x) { return x * 12; }
+inline int f851_13(int x) { return x * 13; }
+inline int f851_14(int x) { return x * 14; }
+inline int f851_15(int x) { return x * 15; }
+inline int f851_16(int x) { return x * 16; }
+inline int f851_17(int x) { return x * 17; }
+inline int f851_18(int x) { return x * 18; }
+inline int f851_19(int x) { return x * 19; }
+inline int f851_20(int x) { return x * 20; }
+inline int f851_21(int x) { return x * 21; }
+inline int f851_22(int x) { return x * 22; }
+inline int f851_23(int x) { return x * 23; }
+inline int f851_24(int x) { return x * 24; }
+inline int f851_25(int x) { return x * 25; }
+inline int f851_26(int x) { return x * 26; }
+inline int f851_27(int x) { return x * 27; }
+inline int f851_28(int x) { return x * 28; }
+inline int f851_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8511 */
+#include <vector>
+#include "h8719.h"
+#include "h7245.h"
+#include "h3301.h"
+#include "h326.h"
+#include "h2902.h"
+#ifdef X
+#include "h3028.h"
+#endif
+struct S8511 { int a; const char *s = "x//y"; };
+inline int f8511_0(int x) { return x * 0; }
+inline int f8511_1(int x) { return x * 1; }
+inline int f8511_2(int x) { return x * 2; }
+inline int f8511_3(int x) { return x * 3; }
+inline int f8511_4(int x) { return x * 4; }
+inline int f8511_5(int x) { return x * 5; }
+inline int f8511_6(int x) { return x * 6; }
+inline int f8511_7(int x) { return x * 7; }
+inline int f8511_8(int x) { return x * 8; }
+inline int f8511_9(int x) { return x * 9; }
+inline int f8511_10(int x) { return x * 10; }
+inline int f8511_11(int x) { return x * 11; }
+inline int f8511_12(int x) { return x * 12; }
+inline int f8511_13(int x) { return x * 13; }
+inline int f8511_14(int x) { return x * 14; }
+inline int f8511_15(int x) { return x * 15; }
+inline int f8511_16(int x) { return x * 16; }
+inline int f8511_17(int x) { return x * 17; }
+inline int f8511_18(int x) { return x * 18; }
+inline int f8511_19(int x) { return x * 19; }
+inline int f8511_20(int x) { return x * 20; }
+inline int f8511_21(int x) { return x * 21; }
+inline int f8511_22(int x) { return x * 22; }
+inline int f8511_23(int x) { return x * 23; }
+inline int f8511_24(int x) { return x * 24; }
+inline int f8511_25(int x) { return x * 25; }
+inline int f8511_26(int x) { return x * 26; }
+inline int f8511_27(int x) { return x * 27; }
+inline int f8511_28(int x) { return x * 28; }
+inline int f8511_29(int x) { return x * 29; }
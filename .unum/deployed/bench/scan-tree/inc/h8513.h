@@ -0,0 +1,42 @@
+#pragma once
+/* header 8513 */
+#include <vector>
+#include "h4055.h"
+#include "h4559.h"
+#include "h9363.h"
+#include "h6641.h"
+#include "h1590.h"
+#ifdef X
+#include "h969.h"
+#endif
+struct S8513 { int a; const char *s = "x//y"; };
+inline int f8513_0(int x) { return x * 0; }
+inline int f8513_1(int x) { return x * 1; }
+inline int f8513_2(int x) { return x * 2; }
+inline int f8513_3(int x) { return x * 3; }
+inline int f8513_4(int x) { return x * 4; }
+inline int f8513_5(int x) { return x * 5; }
+inline int f8513_6(int x) { return x * 6; }
+inline int f8513_7(int x) { return x * 7; }
+inline int f8513_8(int x) { return x * 8; }
+inline int f8513_9(int x) { return x * 9; }
+inline int f8513_10(int x) { return x * 10; }
+inline int f8513_11(int x) { return x * 11; }
+inline int f8513_12(int x) { return x * 12; }
+inline int f8513_13(int x) { return x * 13; }
+inline int f8513_14(int x) { return x * 14; }
+inline int f8513_15(int x) { return x * 15; }
+inline int f8513_16(int x) { return x * 16; }
+inline int f8513_17(int x) { return x * 17; }
+inline int f8513_18(int x) { return x * 18; }
+inline int f8513_19(int x) { return x * 19; }
+inline int f8513_20(int x) { return x * 20; }
+inline int f8513_21(int x) { return x * 21; }
+inline int f8513_22(int x) { return x * 22; }
+inline int f8513_23(int x) { return x * 23; }
+inline int f8513_24(int x) { return x * 24; }
+inline int f8513_25(int x) { return x * 25; }
+inline int f8513_26(int x) { return x * 26; }
+inline int f8513_27(int x) { return x * 27; }
+inline int f8513_28(int x) { return x * 28; }
+inline int f8513_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8514 */
+#include <vector>
+#include "h734.h"
+#include "h847.h"
+#include "h6782.h"
+#include "h2594.h"
+#include "h9462.h"
+#ifdef X
+#include "h9245.h"
+#endif
+struct S8514 { int a; const char *s = "x//y"; };
+inline int f8514_0(int x) { return x * 0; }
+inline int f8514_1(int x) { return x * 1; }
+inline int f8514_2(int x) { return x * 2; }
+inline int f8514_3(int x) { return x * 3; }
+inline int f8514_4(int x) { return x * 4; }
+inline int f8514_5(int x) { return x * 5; }
+inline int f8514_6(int x) { return x * 6; }
+inline int f8514_7(int x) { return x * 7; }
+inline int f8514_8(int x) { return x * 8; }
+inline int f8514_9(int x) { return x * 9; }
+inline int f8514_10(int x) { return x * 10; }
+inline int f8514_11(int x) { return x * 11; }
+inline int f8514_12(int x) { return x * 12; }
+inline int f8514_13(int x) { return x * 13; }
+inline int f8514_14(int x) { return x * 14; }
+inline int f8514_15(int x) { return x * 15; }
+inline int f8514_16(int x) { return x * 16; }
+inline int f8514_17(int x) { return x * 17; }
+inline int f8514_18(int x) { return x * 18; }
+inline int f8514_19(int x) { return x * 19; }
+inline int f8514_20(int x) { return x * 20; }
+inline int f8514_21(int x) { return x * 21; }
+inline int f8514_22(int x) { return x * 22; }
+inline int f8514_23(int x) { return x * 23; }
+inline int f8514_24(int x) { return x * 24; }
+inline int f8514_25(int x) { return x * 25; }
+inline int f8514_26(int x) { return x * 26; }
+inline int f8514_27(int x) { return x * 27; }
+inline int f8514_28(int x) { return x * 28; }
+inline int f8514_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8515 */
+#include <vector>
+#include "h3293.h"
+#include "h484.h"
+#include "h9895.h"
+#include "h7546.h"
+#include "h6667.h"
+#ifdef X
+#include "h6467.h"
+#endif
+struct S8515 { int a; const char *s = "x//y"; };
+inline int f8515_0(int x) { return x * 0; }
+inline int f8515_1(int x) { return x * 1; }
+inline int f8515_2(int x) { return x * 2; }
+inline int f8515_3(int x) { return x * 3; }
+inline int f8515_4(int x) { return x * 4; }
+inline int f8515_5(int x) { return x * 5; }
+inline int f8515_6(int x) { return x * 6; }
+inline int f8515_7(int x) { return x * 7; }
+inline int f8515_8(int x) { return x * 8; }
+inline int f8515_9(int x) { return x * 9; }
+inline int f8515_10(int x) { return x * 10; }
+inline int f8515_11(int x) { return x * 11; }
+inline int f8515_12(int x) { return x * 12; }
+inline int f8515_13(int x) { return x * 13; }
+inline int f8515_14(int x) { return x * 14; }
+inline int f8515_15(int x) { return x * 15; }
+inline int f8515_16(int x) { return x * 16; }
+inline int f8515_17(int x) { return x * 17; }
+inline int f8515_18(int x) { return x * 18; }
+inline int f8515_19(int x) { return x * 19; }
+inline int f8515_20(int x) { return x * 20; }
+inline int f8515_21(int x) { return x * 21; }
+inline int f8515_22(int x) { return x * 22; }
+inline int f8515_23(int x) { return x * 23; }
+inline int f8515_24(int x) { return x * 24; }
+inline int f8515_25(int x) { return x * 25; }
+inline int f8515_26(int x) { return x * 26; }
+inline int f8515_27(int x) { return x * 27; }
+inline int f8515_28(int x) { return x * 28; }
+inline int f8515_29(int x) { return x * 29; }
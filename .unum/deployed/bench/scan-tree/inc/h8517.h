@@ -0,0 +1,42 @@
+#pragma once
+/* header 8517 */
+#include <vector>
+#include "h6208.h"
+#include "h548.h"
+#include "h3193.h"
+#include "h9477.h"
+#include "h8828.h"
+#ifdef X
+#include "h2875.h"
+#endif
+struct S8517 { int a; const char *s = "x//y"; };
+inline int f8517_0(int x) { return x * 0; }
+inline int f8517_1(int x) { return x * 1; }
+inline int f8517_2(int x) { return x * 2; }
+inline int f8517_3(int x) { return x * 3; }
+inline int f8517_4(int x) { return x * 4; }
+inline int f8517_5(int x) { return x * 5; }
+inline int f8517_6(int x) { return x * 6; }
+inline int f8517_7(int x) { return x * 7; }
+inline int f8517_8(int x) { return x * 8; }
+inline int f8517_9(int x) { return x * 9; }
+inline int f8517_10(int x) { return x * 10; }
+inline int f8517_11(int x) { return x * 11; }
+inline int f8517_12(int x) { return x * 12; }
+inline int f8517_13(int x) { return x * 13; }
+inline int f8517_14(int x) { return x * 14; }
+inline int f8517_15(int x) { return x * 15; }
+inline int f8517_16(int x) { return x * 16; }
+inline int f8517_17(int x) { return x * 17; }
+inline int f8517_18(int x) { return x * 18; }
+inline int f8517_19(int x) { return x * 19; }
+inline int f8517_20(int x) { return x * 20; }
+inline int f8517_21(int x) { return x * 21; }
+inline int f8517_22(int x) { return x * 22; }
+inline int f8517_23(int x) { return x * 23; }
+inline int f8517_24(int x) { return x * 24; }
+inline int f8517_25(int x) { return x * 25; }
+inline int f8517_26(int x) { return x * 26; }
+inline int f8517_27(int x) { return x * 27; }
+inline int f8517_28(int x) { return x * 28; }
+inline int f8517_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 852 */
+#include <vector>
+#include "h2799.h"
+#include "h944.h"
+#include "h5258.h"
+#include "h2220.h"
+#include "h315.h"
+#ifdef X
+#include "h6262.h"
+#endif
+struct S852 { int a; const char *s = "x//y"; };
+inline int f852_0(int x) { return x * 0; }
+inline int f852_1(int x) { return x * 1; }
+inline int f852_2(int x) { return x * 2; }
+inline int f852_3(int x) { return x * 3; }
+inline int f852_4(int x) { return x * 4; }
+inline int f852_5(int x) { return x * 5; }
+inline int f852_6(int x) { return x * 6; }
+inline int f852_7(int x) { return x * 7; }
+inline int f852_8(int x) { return x * 8; }
+inline int f852_9(int x) { return x * 9; }
+inline int f852_10(int x) { return x * 10; }
+inline int f852_11(int x) { return x * 11; }
+inline int f852_12(int x) { return x * 12; }
+inline int f852_13(int x) { return x * 13; }
+inline int f852_14(int x) { return x * 14; }
+inline int f852_15(int x) { return x * 15; }
+inline int f852_16(int x) { return x * 16; }
+inline int f852_17(int x) { return x * 17; }
+inline int f852_18(int x) { return x * 18; }
+inline int f852_19(int x) { return x * 19; }
+inline int f852_20(int x) { return x * 20; }
+inline int f852_21(int x) { return x * 21; }
+inline int f852_22(int x) { return x * 22; }
+inline int f852_23(int x) { return x * 23; }
+inline int f852_24(int x) { return x * 24; }
+inline int f852_25(int x) { return x * 25; }
+inline int f852_26(int x) { return x * 26; }
+inline int f852_27(int x) { return x * 27; }
+inline int f852_28(int x) { return x * 28; }
+inline int f852_29(int x) { return x * 29; }
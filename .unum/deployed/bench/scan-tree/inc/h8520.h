@@ -0,0 +1,42 @@
+#pragma once
+/* header 8520 */
+#include <vector>
+#include "h9835.h"
+#include "h7627.h"
+#include "h9038.h"
+#include "h3372.h"
+#include "h7071.h"
+#ifdef X
+#include "h2434.h"
+#endif
+struct S8520 { int a; const char *s = "x//y"; };
+inline int f8520_0(int x) { return x * 0; }
+inline int f8520_1(int x) { return x * 1; }
+inline int f8520_2(int x) { return x * 2; }
+inline int f8520_3(int x) { return x * 3; }
+inline int f8520_4(int x) { return x * 4; }
+inline int f8520_5(int x) { return x * 5; }
+inline int f8520_6(int x) { return x * 6; }
+inline int f8520_7(int x) { return x * 7; }
+inline int f8520_8(int x) { return x * 8; }
+inline int f8520_9(int x) { return x * 9; }
+inline int f8520_10(int x) { return x * 10; }
+inline int f8520_11(int x) { return x * 11; }
+inline int f8520_12(int x) { return x * 12; }
+inline int f8520_13(int x) { return x * 13; }
+inline int f8520_14(int x) { return x * 14; }
+inline int f8520_15(int x) { return x * 15; }
+inline int f8520_16(int x) { return x * 16; }
+inline int f8520_17(int x) { return x * 17; }
+inline int f8520_18(int x) { return x * 18; }
+inline int f8520_19(int x) { return x * 19; }
+inline int f8520_20(int x) { return x * 20; }
+inline int f8520_21(int x) { return x * 21; }
+inline int f8520_22(int x) { return x * 22; }
+inline int f8520_23(int x) { return x * 23; }
+inline int f8520_24(int x) { return x * 24; }
+inline int f8520_25(int x) { return x * 25; }
+inline int f8520_26(int x) { return x * 26; }
+inline int f8520_27(int x) { return x * 27; }
+inline int f8520_28(int x) { return x * 28; }
+inline int f8520_29(int x) { return x * 29; }
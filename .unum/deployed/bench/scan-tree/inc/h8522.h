@@ -0,0 +1,42 @@
+#pragma once
+/* header 8522 */
+#include <vector>
+#include "h7970.h"
+#include "h2603.h"
+#include "h7118.h"
+#include "h9222.h"
+#include "h3345.h"
+#ifdef X
+#include "h4634.h"
+#endif
+struct S8522 { int a; const char *s = "x//y"; };
+inline int f8522_0(int x) { return x * 0; }
+inline int f8522_1(int x) { return x * 1; }
+inline int f8522_2(int x) { return x * 2; }
+inline int f8522_3(int x) { return x * 3; }
+inline int f8522_4(int x) { return x * 4; }
+inline int f8522_5(int x) { return x * 5; }
+inline int f8522_6(int x) { return x * 6; }
+inline int f8522_7(int x) { return x * 7; }
+inline int f8522_8(int x) { return x * 8; }
+inline int f8522_9(int x) { return x * 9; }
+inline int f8522_10(int x) { return x * 10; }
+inline int f8522_11(int x) { return x * 11; }
+inline int f8522_12(int x) { return x * 12; }
+inline int f8522_13(int x) { return x * 13; }
+inline int f8522_14(int x) { return x * 14; }
+inline int f8522_15(int x) { return x * 15; }
+inline int f8522_16(int x) { return x * 16; }
+inline int f8522_17(int x) { return x * 17; }
+inline int f8522_18(int x) { return x * 18; }
+inline int f8522_19(int x) { return x * 19; }
+inline int f8522_20(int x) { return x * 20; }
+inline int f8522_21(int x) { return x * 21; }
+inline int f8522_22(int x) { return x * 22; }
+inline int f8522_23(int x) { return x * 23; }
+inline int f8522_24(int x) { return x * 24; }
+inline int f8522_25(int x) { return x * 25; }
+inline int f8522_26(int x) { return x * 26; }
+inline int f8522_27(int x) { return x * 27; }
+inline int f8522_28(int x) { return x * 28; }
+inline int f8522_29(int x) { return x * 29; }
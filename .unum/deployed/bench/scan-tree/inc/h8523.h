@@ -0,0 +1,42 @@
+#pragma once
+/* header 8523 */
+#include <vector>
+#include "h3478.h"
+#include "h6506.h"
+#include "h1492.h"
+#include "h6936.h"
+#include "h5758.h"
+#ifdef X
+#include "h5624.h"
+#endif
+struct S8523 { int a; const char *s = "x//y"; };
+inline int f8523_0(int x) { return x * 0; }
+inline int f8523_1(int x) { return x * 1; }
+inline int f8523_2(int x) { return x * 2; }
+inline int f8523_3(int x) { return x * 3; }
+inline int f8523_4(int x) { return x * 4; }
+inline int f8523_5(int x) { return x * 5; }
+inline int f8523_6(int x) { return x * 6; }
+inline int f8523_7(int x) { return x * 7; }
+inline int f8523_8(int x) { return x * 8; }
+inline int f8523_9(int x) { return x * 9; }
+inline int f8523_10(int x) { return x * 10; }
+inline int f8523_11(int x) { return x * 11; }
+inline int f8523_12(int x) { return x * 12; }
+inline int f8523_13(int x) { return x * 13; }
+inline int f8523_14(int x) { return x * 14; }
+inline int f8523_15(int x) { return x * 15; }
+inline int f8523_16(int x) { return x * 16; }
+inline int f8523_17(int x) { return x * 17; }
+inline int f8523_18(int x) { return x * 18; }
+inline int f8523_19(int x) { return x * 19; }
+inline int f8523_20(int x) { return x * 20; }
+inline int f8523_21(int x) { return x * 21; }
+inline int f8523_22(int x) { return x * 22; }
+inline int f8523_23(int x) { return x * 23; }
+inline int f8523_24(int x) { return x * 24; }
+inline int f8523_25(int x) { return x * 25; }
+inline int f8523_26(int x) { return x * 26; }
+inline int f8523_27(int x) { return x * 27; }
+inline int f8523_28(int x) { return x * 28; }
+inline int f8523_29(int x) { return x * 29; }
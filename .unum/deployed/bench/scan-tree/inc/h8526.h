@@ -0,0 +1,42 @@
+#pragma once
+/* header 8526 */
+#include <vector>
+#include "h9482.h"
+#include "h7445.h"
+#include "h6205.h"
+#include "h3825.h"
+#include "h3943.h"
+#ifdef X
+#include "h6622.h"
+#endif
+struct S8526 { int a; const char *s = "x//y"; };
+inline int f8526_0(int x) { return x * 0; }
+inline int f8526_1(int x) { return x * 1; }
+inline int f8526_2(int x) { return x * 2; }
+inline int f8526_3(int x) { return x * 3; }
+inline int f8526_4(int x) { return x * 4; }
+inline int f8526_5(int x) { return x * 5; }
+inline int f8526_6(int x) { return x * 6; }
+inline int f8526_7(int x) { return x * 7; }
+inline int f8526_8(int x) { return x * 8; }
+inline int f8526_9(int x) { return x * 9; }
+inline int f8526_10(int x) { return x * 10; }
+inline int f8526_11(int x) { return x * 11; }
+inline int f8526_12(int x) { return x * 12; }
+inline int f8526_13(int x) { return x * 13; }
+inline int f8526_14(int x) { return x * 14; }
+inline int f8526_15(int x) { return x * 15; }
+inline int f8526_16(int x) { return x * 16; }
+inline int f8526_17(int x) { return x * 17; }
+inline int f8526_18(int x) { return x * 18; }
+inline int f8526_19(int x) { return x * 19; }
+inline int f8526_20(int x) { return x * 20; }
+inline int f8526_21(int x) { return x * 21; }
+inline int f8526_22(int x) { return x * 22; }
+inline int f8526_23(int x) { return x * 23; }
+inline int f8526_24(int x) { return x * 24; }
+inline int f8526_25(int x) { return x * 25; }
+inline int f8526_26(int x) { return x * 26; }
+inline int f8526_27(int x) { return x * 27; }
+inline int f8526_28(int x) { return x * 28; }
+inline int f8526_29(int x) { return x * 29; }
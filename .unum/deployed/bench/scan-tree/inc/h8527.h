@@ -0,0 +1,42 @@
+#pragma once
+/* header 8527 */
+#include <vector>
+#include "h2868.h"
+#include "h3314.h"
+#include "h7125.h"
+#include "h43.h"
+#include "h5490.h"
+#ifdef X
+#include "h2475.h"
+#endif
+struct S8527 { int a; const char *s = "x//y"; };
+inline int f8527_0(int x) { return x * 0; }
+inline int f8527_1(int x) { return x * 1; }
+inline int f8527_2(int x) { return x * 2; }
+inline int f8527_3(int x) { return x * 3; }
+inline int f8527_4(int x) { return x * 4; }
+inline int f8527_5(int x) { return x * 5; }
+inline int f8527_6(int x) { return x * 6; }
+inline int f8527_7(int x) { return x * 7; }
+inline int f8527_8(int x) { return x * 8; }
+inline int f8527_9(int x) { return x * 9; }
+inline int f8527_10(int x) { return x * 10; }
+inline int f8527_11(int x) { return x * 11; }
+inline int f8527_12(int x) { return x * 12; }
+inline int f8527_13(int x) { return x * 13; }
+inline int f8527_14(int x) { return x * 14; }
+inline int f8527_15(int x) { return x * 15; }
+inline int f8527_16(int x) { return x * 16; }
+inline int f8527_17(int x) { return x * 17; }
+inline int f8527_18(int x) { return x * 18; }
+inline int f8527_19(int x) { return x * 19; }
+inline int f8527_20(int x) { return x * 20; }
+inline int f8527_21(int x) { return x * 21; }
+inline int f8527_22(int x) { return x * 22; }
+inline int f8527_23(int x) { return x * 23; }
+inline int f8527_24(int x) { return x * 24; }
+inline int f8527_25(int x) { return x * 25; }
+inline int f8527_26(int x) { return x * 26; }
+inline int f8527_27(int x) { return x * 27; }
+inline int f8527_28(int x) { return x * 28; }
+inline int f8527_29(int x) { return x * 29; }
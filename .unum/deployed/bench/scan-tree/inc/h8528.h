@@ -0,0 +1,42 @@
+#pragma once
+/* header 8528 */
+#include <vector>
+#include "h3146.h"
+#include "h5295.h"
+#include "h2826.h"
+#include "h1935.h"
+#include "h1823.h"
+#ifdef X
+#include "h6530.h"
+#endif
+struct S8528 { int a; const char *s = "x//y"; };
+inline int f8528_0(int x) { return x * 0; }
+inline int f8528_1(int x) { return x * 1; }
+inline int f8528_2(int x) { return x * 2; }
+inline int f8528_3(int x) { return x * 3; }
+inline int f8528_4(int x) { return x * 4; }
+inline int f8528_5(int x) { return x * 5; }
+inline int f8528_6(int x) { return x * 6; }
+inline int f8528_7(int x) { return x * 7; }
+inline int f8528_8(int x) { return x * 8; }
+inline int f8528_9(int x) { return x * 9; }
+inline int f8528_10(int x) { return x * 10; }
+inline int f8528_11(int x) { return x * 11; }
+inline int f8528_12(int x) { return x * 12; }
+inline int f8528_13(int x) { return x * 13; }
+inline int f8528_14(int x) { return x * 14; }
+inline int f8528_15(int x) { return x * 15; }
+inline int f8528_16(int x) { return x * 16; }
+inline int f8528_17(int x) { return x * 17; }
+inline int f8528_18(int x) { return x * 18; }
+inline int f8528_19(int x) { return x * 19; }
+inline int f8528_20(int x) { return x * 20; }
+inline int f8528_21(int x) { return x * 21; }
+inline int f8528_22(int x) { return x * 22; }
+inline int f8528_23(int x) { return x * 23; }
+inline int f8528_24(int x) { return x * 24; }
+inline int f8528_25(int x) { return x * 25; }
+inline int f8528_26(int x) { return x * 26; }
+inline int f8528_27(int x) { return x * 27; }
+inline int f8528_28(int x) { return x * 28; }
+inline int f8528_29(int x) { return x * 29; }
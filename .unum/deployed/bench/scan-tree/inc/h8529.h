@@ -0,0 +1,42 @@
+#pragma once
+/* header 8529 */
+#include <vector>
+#include "h5172.h"
+#include "h4830.h"
+#include "h4449.h"
+#include "h1051.h"
+#include "h7195.h"
+#ifdef X
+#include "h2787.h"
+#endif
+struct S8529 { int a; const char *s = "x//y"; };
+inline int f8529_0(int x) { return x * 0; }
+inline int f8529_1(int x) { return x * 1; }
+inline int f8529_2(int x) { return x * 2; }
+inline int f8529_3(int x) { return x * 3; }
+inline int f8529_4(int x) { return x * 4; }
+inline int f8529_5(int x) { return x * 5; }
+inline int f8529_6(int x) { return x * 6; }
+inline int f8529_7(int x) { return x * 7; }
+inline int f8529_8(int x) { return x * 8; }
+inline int f8529_9(int x) { return x * 9; }
+inline int f8529_10(int x) { return x * 10; }
+inline int f8529_11(int x) { return x * 11; }
+inline int f8529_12(int x) { return x * 12; }
+inline int f8529_13(int x) { return x * 13; }
+inline int f8529_14(int x) { return x * 14; }
+inline int f8529_15(int x) { return x * 15; }
+inline int f8529_16(int x) { return x * 16; }
+inline int f8529_17(int x) { return x * 17; }
+inline int f8529_18(int x) { return x * 18; }
+inline int f8529_19(int x) { return x * 19; }
+inline int f8529_20(int x) { return x * 20; }
+inline int f8529_21(int x) { return x * 21; }
+inline int f8529_22(int x) { return x * 22; }
+inline int f8529_23(int x) { return x * 23; }
+inline int f8529_24(int x) { return x * 24; }
+inline int f8529_25(int x) { return x * 25; }
+inline int f8529_26(int x) { return x * 26; }
+inline int f8529_27(int x) { return x * 27; }
+inline int f8529_28(int x) { return x * 28; }
+inline int f8529_29(int x) { return x * 29; }
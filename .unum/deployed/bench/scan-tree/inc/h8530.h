@@ -0,0 +1,42 @@
+#pragma once
+/* header 8530 */
+#include <vector>
+#include "h203.h"
+#include "h9501.h"
+#include "h8061.h"
+#include "h5027.h"
+#include "h3501.h"
+#ifdef X
+#include "h8958.h"
+#endif
+struct S8530 { int a; const char *s = "x//y"; };
+inline int f8530_0(int x) { return x * 0; }
+inline int f8530_1(int x) { return x * 1; }
+inline int f8530_2(int x) { return x * 2; }
+inline int f8530_3(int x) { return x * 3; }
+inline int f8530_4(int x) { return x * 4; }
+inline int f8530_5(int x) { return x * 5; }
+inline int f8530_6(int x) { return x * 6; }
+inline int f8530_7(int x) { return x * 7; }
+inline int f8530_8(int x) { return x * 8; }
+inline int f8530_9(int x) { return x * 9; }
+inline int f8530_10(int x) { return x * 10; }
+inline int f8530_11(int x) { return x * 11; }
+inline int f8530_12(int x) { return x * 12; }
+inline int f8530_13(int x) { return x * 13; }
+inline int f8530_14(int x) { return x * 14; }
+inline int f8530_15(int x) { return x * 15; }
+inline int f8530_16(int x) { return x * 16; }
+inline int f8530_17(int x) { return x * 17; }
+inline int f8530_18(int x) { return x * 18; }
+inline int f8530_19(int x) { return x * 19; }
+inline int f8530_20(int x) { return x * 20; }
+inline int f8530_21(int x) { return x * 21; }
+inline int f8530_22(int x) { return x * 22; }
+inline int f8530_23(int x) { return x * 23; }
+inline int f8530_24(int x) { return x * 24; }
+inline int f8530_25(int x) { return x * 25; }
+inline int f8530_26(int x) { return x * 26; }
+inline int f8530_27(int x) { return x * 27; }
+inline int f8530_28(int x) { return x * 28; }
+inline int f8530_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8531 */
+#include <vector>
+#include "h7134.h"
+#include "h8177.h"
+#include "h4260.h"
+#include "h2157.h"
+#include "h9149.h"
+#ifdef X
+#include "h4497.h"
+#endif
+struct S8531 { int a; const char *s = "x//y"; };
+inline int f8531_0(int x) { return x * 0; }
+inline int f8531_1(int x) { return x * 1; }
+inline int f8531_2(int x) { return x * 2; }
+inline int f8531_3(int x) { return x * 3; }
+inline int f8531_4(int x) { return x * 4; }
+inline int f8531_5(int x) { return x * 5; }
+inline int f8531_6(int x) { return x * 6; }
+inline int f8531_7(int x) { return x * 7; }
+inline int f8531_8(int x) { return x * 8; }
+inline int f8531_9(int x) { return x * 9; }
+inline int f8531_10(int x) { return x * 10; }
+inline int f8531_11(int x) { return x * 11; }
+inline int f8531_12(int x) { return x * 12; }
+inline int f8531_13(int x) { return x * 13; }
+inline int f8531_14(int x) { return x * 14; }
+inline int f8531_15(int x) { return x * 15; }
+inline int f8531_16(int x) { return x * 16; }
+inline int f8531_17(int x) { return x * 17; }
+inline int f8531_18(int x) { return x * 18; }
+inline int f8531_19(int x) { return x * 19; }
+inline int f8531_20(int x) { return x * 20; }
+inline int f8531_21(int x) { return x * 21; }
+inline int f8531_22(int x) { return x * 22; }
+inline int f8531_23(int x) { return x * 23; }
+inline int f8531_24(int x) { return x * 24; }
+inline int f8531_25(int x) { return x * 25; }
+inline int f8531_26(int x) { return x * 26; }
+inline int f8531_27(int x) { return x * 27; }
+inline int f8531_28(int x) { return x * 28; }
+inline int f8531_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8535 */
+#include <vector>
+#include "h9494.h"
+#include "h735.h"
+#include "h454.h"
+#include "h5326.h"
+#include "h2867.h"
+#ifdef X
+#include "h6497.h"
+#endif
+struct S8535 { int a; const char *s = "x//y"; };
+inline int f8535_0(int x) { return x * 0; }
+inline int f8535_1(int x) { return x * 1; }
+inline int f8535_2(int x) { return x * 2; }
+inline int f8535_3(int x) { return x * 3; }
+inline int f8535_4(int x) { return x * 4; }
+inline int f8535_5(int x) { return x * 5; }
+inline int f8535_6(int x) { return x * 6; }
+inline int f8535_7(int x) { return x * 7; }
+inline int f8535_8(int x) { return x * 8; }
+inline int f8535_9(int x) { return x * 9; }
+inline int f8535_10(int x) { return x * 10; }
+inline int f8535_11(int x) { return x * 11; }
+inline int f8535_12(int x) { return x * 12; }
+inline int f8535_13(int x) { return x * 13; }
+inline int f8535_14(int x) { return x * 14; }
+inline int f8535_15(int x) { return x * 15; }
+inline int f8535_16(int x) { return x * 16; }
+inline int f8535_17(int x) { return x * 17; }
+inline int f8535_18(int x) { return x * 18; }
+inline int f8535_19(int x) { return x * 19; }
+inline int f8535_20(int x) { return x * 20; }
+inline int f8535_21(int x) { return x * 21; }
+inline int f8535_22(int x) { return x * 22; }
+inline int f8535_23(int x) { return x * 23; }
+inline int f8535_24(int x) { return x * 24; }
+inline int f8535_25(int x) { return x * 25; }
+inline int f8535_26(int x) { return x * 26; }
+inline int f8535_27(int x) { return x * 27; }
+inline int f8535_28(int x) { return x * 28; }
+inline int f8535_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8536 */
+#include <vector>
+#include "h4201.h"
+#include "h2998.h"
+#include "h5958.h"
+#include "h5759.h"
+#include "h2753.h"
+#ifdef X
+#include "h1246.h"
+#endif
+struct S8536 { int a; const char *s = "x//y"; };
+inline int f8536_0(int x) { return x * 0; }
+inline int f8536_1(int x) { return x * 1; }
+inline int f8536_2(int x) { return x * 2; }
+inline int f8536_3(int x) { return x * 3; }
+inline int f8536_4(int x) { return x * 4; }
+inline int f8536_5(int x) { return x * 5; }
+inline int f8536_6(int x) { return x * 6; }
+inline int f8536_7(int x) { return x * 7; }
+inline int f8536_8(int x) { return x * 8; }
+inline int f8536_9(int x) { return x * 9; }
+inline int f8536_10(int x) { return x * 10; }
+inline int f8536_11(int x) { return x * 11; }
+inline int f8536_12(int x) { return x * 12; }
+inline int f8536_13(int x) { return x * 13; }
+inline int f8536_14(int x) { return x * 14; }
+inline int f8536_15(int x) { return x * 15; }
+inline int f8536_16(int x) { return x * 16; }
+inline int f8536_17(int x) { return x * 17; }
+inline int f8536_18(int x) { return x * 18; }
+inline int f8536_19(int x) { return x * 19; }
+inline int f8536_20(int x) { return x * 20; }
+inline int f8536_21(int x) { return x * 21; }
+inline int f8536_22(int x) { return x * 22; }
+inline int f8536_23(int x) { return x * 23; }
+inline int f8536_24(int x) { return x * 24; }
+inline int f8536_25(int x) { return x * 25; }
+inline int f8536_26(int x) { return x * 26; }
+inline int f8536_27(int x) { return x * 27; }
+inline int f8536_28(int x) { return x * 28; }
+inline int f8536_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 854 */
+#include <vector>
+#include "h6260.h"
+#include "h9031.h"
+#include "h2731.h"
+#include "h6056.h"
+#include "h3877.h"
+#ifdef X
+#include "h3698.h"
+#endif
+struct S854 { int a; const char *s = "x//y"; };
+inline int f854_0(int x) { return x * 0; }
+inline int f854_1(int x) { return x * 1; }
+inline int f854_2(int x) { return x * 2; }
+inline int f854_3(int x) { return x * 3; }
+inline int f854_4(int x) { return x * 4; }
+inline int f854_5(int x) { return x * 5; }
+inline int f854_6(int x) { return x * 6; }
+inline int f854_7(int x) { return x * 7; }
+inline int f854_8(int x) { return x * 8; }
+inline int f854_9(int x) { return x * 9; }
+inline int f854_10(int x) { return x * 10; }
+inline int f854_11(int x) { return x * 11; }
+inline int f854_12(int x) { return x * 12; }
+inline int f854_13(int x) { return x * 13; }
+inline int f854_14(int x) { return x * 14; }
+inline int f854_15(int x) { return x * 15; }
+inline int f854_16(int x) { return x * 16; }
+inline int f854_17(int x) { return x * 17; }
+inline int f854_18(int x) { return x * 18; }
+inline int f854_19(int x) { return x * 19; }
+inline int f854_20(int x) { return x * 20; }
+inline int f854_21(int x) { return x * 21; }
+inline int f854_22(int x) { return x * 22; }
+inline int f854_23(int x) { return x * 23; }
+inline int f854_24(int x) { return x * 24; }
+inline int f854_25(int x) { return x * 25; }
+inline int f854_26(int x) { return x * 26; }
+inline int f854_27(int x) { return x * 27; }
+inline int f854_28(int x) { return x * 28; }
+inline int f854_29(int x) { return x * 29; }
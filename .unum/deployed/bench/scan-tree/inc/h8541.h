@@ -0,0 +1,42 @@
+#pragma once
+/* header 8541 */
+#include <vector>
+#include "h1422.h"
+#include "h5642.h"
+#include "h3260.h"
+#include "h9150.h"
+#include "h5903.h"
+#ifdef X
+#include "h2362.h"
+#endif
+struct S8541 { int a; const char *s = "x//y"; };
+inline int f8541_0(int x) { return x * 0; }
+inline int f8541_1(int x) { return x * 1; }
+inline int f8541_2(int x) { return x * 2; }
+inline int f8541_3(int x) { return x * 3; }
+inline int f8541_4(int x) { return x * 4; }
+inline int f8541_5(int x) { return x * 5; }
+inline int f8541_6(int x) { return x * 6; }
+inline int f8541_7(int x) { return x * 7; }
+inline int f8541_8(int x) { return x * 8; }
+inline int f8541_9(int x) { return x * 9; }
+inline int f8541_10(int x) { return x * 10; }
+inline int f8541_11(int x) { return x * 11; }
+inline int f8541_12(int x) { return x * 12; }
+inline int f8541_13(int x) { return x * 13; }
+inline int f8541_14(int x) { return x * 14; }
+inline int f8541_15(int x) { return x * 15; }
+inline int f8541_16(int x) { return x * 16; }
+inline int f8541_17(int x) { return x * 17; }
+inline int f8541_18(int x) { return x * 18; }
+inline int f8541_19(int x) { return x * 19; }
+inline int f8541_20(int x) { return x * 20; }
+inline int f8541_21(int x) { return x * 21; }
+inline int f8541_22(int x) { return x * 22; }
+inline int f8541_23(int x) { return x * 23; }
+inline int f8541_24(int x) { return x * 24; }
+inline int f8541_25(int x) { return x * 25; }
+inline int f8541_26(int x) { return x * 26; }
+inline int f8541_27(int x) { return x * 27; }
+inline int f8541_28(int x) { return x * 28; }
+inline int f8541_29(int x) { return x * 29; }
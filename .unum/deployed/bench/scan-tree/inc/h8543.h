@@ -0,0 +1,42 @@
+#pragma once
+/* header 8543 */
+#include <vector>
+#include "h9382.h"
+#include "h5953.h"
+#include "h3041.h"
+#include "h4223.h"
+#include "h2182.h"
+#ifdef X
+#include "h9766.h"
+#endif
+struct S8543 { int a; const char *s = "x//y"; };
+inline int f8543_0(int x) { return x * 0; }
+inline int f8543_1(int x) { return x * 1; }
+inline int f8543_2(int x) { return x * 2; }
+inline int f8543_3(int x) { return x * 3; }
+inline int f8543_4(int x) { return x * 4; }
+inline int f8543_5(int x) { return x * 5; }
+inline int f8543_6(int x) { return x * 6; }
+inline int f8543_7(int x) { return x * 7; }
+inline int f8543_8(int x) { return x * 8; }
+inline int f8543_9(int x) { return x * 9; }
+inline int f8543_10(int x) { return x * 10; }
+inline int f8543_11(int x) { return x * 11; }
+inline int f8543_12(int x) { return x * 12; }
+inline int f8543_13(int x) { return x * 13; }
+inline int f8543_14(int x) { return x * 14; }
+inline int f8543_15(int x) { return x * 15; }
+inline int f8543_16(int x) { return x * 16; }
+inline int f8543_17(int x) { return x * 17; }
+inline int f8543_18(int x) { return x * 18; }
+inline int f8543_19(int x) { return x * 19; }
+inline int f8543_20(int x) { return x * 20; }
+inline int f8543_21(int x) { return x * 21; }
+inline int f8543_22(int x) { return x * 22; }
+inline int f8543_23(int x) { return x * 23; }
+inline int f8543_24(int x) { return x * 24; }
+inline int f8543_25(int x) { return x * 25; }
+inline int f8543_26(int x) { return x * 26; }
+inline int f8543_27(int x) { return x * 27; }
+inline int f8543_28(int x) { return x * 28; }
+inline int f8543_29(int x) { return x * 29; }
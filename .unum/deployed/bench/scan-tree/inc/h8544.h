@@ -0,0 +1,42 @@
+#pragma once
+/* header 8544 */
+#include <vector>
+#include "h6763.h"
+#include "h9940.h"
+#include "h1774.h"
+#include "h6296.h"
+#include "h6517.h"
+#ifdef X
+#include "h1030.h"
+#endif
+struct S8544 { int a; const char *s = "x//y"; };
+inline int f8544_0(int x) { return x * 0; }
+inline int f8544_1(int x) { return x * 1; }
+inline int f8544_2(int x) { return x * 2; }
+inline int f8544_3(int x) { return x * 3; }
+inline int f8544_4(int x) { return x * 4; }
+inline int f8544_5(int x) { return x * 5; }
+inline int f8544_6(int x) { return x * 6; }
+inline int f8544_7(int x) { return x * 7; }
+inline int f8544_8(int x) { return x * 8; }
+inline int f8544_9(int x) { return x * 9; }
+inline int f8544_10(int x) { return x * 10; }
+inline int f8544_11(int x) { return x * 11; }
+inline int f8544_12(int x) { return x * 12; }
+inline int f8544_13(int x) { return x * 13; }
+inline int f8544_14(int x) { return x * 14; }
+inline int f8544_15(int x) { return x * 15; }
+inline int f8544_16(int x) { return x * 16; }
+inline int f8544_17(int x) { return x * 17; }
+inline int f8544_18(int x) { return x * 18; }
+inline int f8544_19(int x) { return x * 19; }
+inline int f8544_20(int x) { return x * 20; }
+inline int f8544_21(int x) { return x * 21; }
+inline int f8544_22(int x) { return x * 22; }
+inline int f8544_23(int x) { return x * 23; }
+inline int f8544_24(int x) { return x * 24; }
+inline int f8544_25(int x) { return x * 25; }
+inline int f8544_26(int x) { return x * 26; }
+inline int f8544_27(int x) { return x * 27; }
+inline int f8544_28(int x) { return x * 28; }
+inline int f8544_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8546 */
+#include <vector>
+#include "h1848.h"
+#include "h3029.h"
+#include "h4290.h"
+#include "h6769.h"
+#include "h8939.h"
+#ifdef X
+#include "h3430.h"
+#endif
+struct S8546 { int a; const char *s = "x//y"; };
+inline int f8546_0(int x) { return x * 0; }
+inline int f8546_1(int x) { return x * 1; }
+inline int f8546_2(int x) { return x * 2; }
+inline int f8546_3(int x) { return x * 3; }
+inline int f8546_4(int x) { return x * 4; }
+inline int f8546_5(int x) { return x * 5; }
+inline int f8546_6(int x) { return x * 6; }
+inline int f8546_7(int x) { return x * 7; }
+inline int f8546_8(int x) { return x * 8; }
+inline int f8546_9(int x) { return x * 9; }
+inline int f8546_10(int x) { return x * 10; }
+inline int f8546_11(int x) { return x * 11; }
+inline int f8546_12(int x) { return x * 12; }
+inline int f8546_13(int x) { return x * 13; }
+inline int f8546_14(int x) { return x * 14; }
+inline int f8546_15(int x) { return x * 15; }
+inline int f8546_16(int x) { return x * 16; }
+inline int f8546_17(int x) { return x * 17; }
+inline int f8546_18(int x) { return x * 18; }
+inline int f8546_19(int x) { return x * 19; }
+inline int f8546_20(int x) { return x * 20; }
+inline int f8546_21(int x) { return x * 21; }
+inline int f8546_22(int x) { return x * 22; }
+inline int f8546_23(int x) { return x * 23; }
+inline int f8546_24(int x) { return x * 24; }
+inline int f8546_25(int x) { return x * 25; }
+inline int f8546_26(int x) { return x * 26; }
+inline int f8546_27(int x) { return x * 27; }
+inline int f8546_28(int x) { return x * 28; }
+inline int f8546_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8548 */
+#include <vector>
+#include "h1799.h"
+#include "h3796.h"
+#include "h5508.h"
+#include "h3208.h"
+#include "h2297.h"
+#ifdef X
+#include "h4020.h"
+#endif
+struct S8548 { int a; const char *s = "x//y"; };
+inline int f8548_0(int x) { return x * 0; }
+inline int f8548_1(int x) { return x * 1; }
+inline int f8548_2(int x) { return x * 2; }
+inline int f8548_3(int x) { return x * 3; }
+inline int f8548_4(int x) { return x * 4; }
+inline int f8548_5(int x) { return x * 5; }
+inline int f8548_6(int x) { return x * 6; }
+inline int f8548_7(int x) { return x * 7; }
+inline int f8548_8(int x) { return x * 8; }
+inline int f8548_9(int x) { return x * 9; }
+inline int f8548_10(int x) { return x * 10; }
+inline int f8548_11(int x) { return x * 11; }
+inline int f8548_12(int x) { return x * 12; }
+inline int f8548_13(int x) { return x * 13; }
+inline int f8548_14(int x) { return x * 14; }
+inline int f8548_15(int x) { return x * 15; }
+inline int f8548_16(int x) { return x * 16; }
+inline int f8548_17(int x) { return x * 17; }
+inline int f8548_18(int x) { return x * 18; }
+inline int f8548_19(int x) { return x * 19; }
+inline int f8548_20(int x) { return x * 20; }
+inline int f8548_21(int x) { return x * 21; }
+inline int f8548_22(int x) { return x * 22; }
+inline int f8548_23(int x) { return x * 23; }
+inline int f8548_24(int x) { return x * 24; }
+inline int f8548_25(int x) { return x * 25; }
+inline int f8548_26(int x) { return x * 26; }
+inline int f8548_27(int x) { return x * 27; }
+inline int f8548_28(int x) { return x * 28; }
+inline int f8548_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8549 */
+#include <vector>
+#include "h6075.h"
+#include "h824.h"
+#include "h2184.h"
+#include "h1228.h"
+#include "h2864.h"
+#ifdef X
+#include "h5005.h"
+#endif
+struct S8549 { int a; const char *s = "x//y"; };
+inline int f8549_0(int x) { return x * 0; }
+inline int f8549_1(int x) { return x * 1; }
+inline int f8549_2(int x) { return x * 2; }
+inline int f8549_3(int x) { return x * 3; }
+inline int f8549_4(int x) { return x * 4; }
+inline int f8549_5(int x) { return x * 5; }
+inline int f8549_6(int x) { return x * 6; }
+inline int f8549_7(int x) { return x * 7; }
+inline int f8549_8(int x) { return x * 8; }
+inline int f8549_9(int x) { return x * 9; }
+inline int f8549_10(int x) { return x * 10; }
+inline int f8549_11(int x) { return x * 11; }
+inline int f8549_12(int x) { return x * 12; }
+inline int f8549_13(int x) { return x * 13; }
+inline int f8549_14(int x) { return x * 14; }
+inline int f8549_15(int x) { return x * 15; }
+inline int f8549_16(int x) { return x * 16; }
+inline int f8549_17(int x) { return x * 17; }
+inline int f8549_18(int x) { return x * 18; }
+inline int f8549_19(int x) { return x * 19; }
+inline int f8549_20(int x) { return x * 20; }
+inline int f8549_21(int x) { return x * 21; }
+inline int f8549_22(int x) { return x * 22; }
+inline int f8549_23(int x) { return x * 23; }
+inline int f8549_24(int x) { return x * 24; }
+inline int f8549_25(int x) { return x * 25; }
+inline int f8549_26(int x) { return x * 26; }
+inline int f8549_27(int x) { return x * 27; }
+inline int f8549_28(int x) { return x * 28; }
+inline int f8549_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8550 */
+#include <vector>
+#include "h851.h"
+#include "h5355.h"
+#include "h3673.h"
+#include "h4518.h"
+#include "h3405.h"
+#ifdef X
+#include "h7510.h"
+#endif
+struct S8550 { int a; const char *s = "x//y"; };
+inline int f8550_0(int x) { return x * 0; }
+inline int f8550_1(int x) { return x * 1; }
+inline int f8550_2(int x) { return x * 2; }
+inline int f8550_3(int x) { return x * 3; }
+inline int f8550_4(int x) { return x * 4; }
+inline int f8550_5(int x) { return x * 5; }
+inline int f8550_6(int x) { return x * 6; }
+inline int f8550_7(int x) { return x * 7; }
+inline int f8550_8(int x) { return x * 8; }
+inline int f8550_9(int x) { return x * 9; }
+inline int f8550_10(int x) { return x * 10; }
+inline int f8550_11(int x) { return x * 11; }
+inline int f8550_12(int x) { return x * 12; }
+inline int f8550_13(int x) { return x * 13; }
+inline int f8550_14(int x) { return x * 14; }
+inline int f8550_15(int x) { return x * 15; }
+inline int f8550_16(int x) { return x * 16; }
+inline int f8550_17(int x) { return x * 17; }
+inline int f8550_18(int x) { return x * 18; }
+inline int f8550_19(int x) { return x * 19; }
+inline int f8550_20(int x) { return x * 20; }
+inline int f8550_21(int x) { return x * 21; }
+inline int f8550_22(int x) { return x * 22; }
+inline int f8550_23(int x) { return x * 23; }
+inline int f8550_24(int x) { return x * 24; }
+inline int f8550_25(int x) { return x * 25; }
+inline int f8550_26(int x) { return x * 26; }
+inline int f8550_27(int x) { return x * 27; }
+inline int f8550_28(int x) { return x * 28; }
+inline int f8550_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8551 */
+#include <vector>
+#include "h2002.h"
+#include "h1135.h"
+#include "h7284.h"
+#include "h7724.h"
+#include "h7666.h"
+#ifdef X
+#include "h658.h"
+#endif
+struct S8551 { int a; const char *s = "x//y"; };
+inline int f8551_0(int x) { return x * 0; }
+inline int f8551_1(int x) { return x * 1; }
+inline int f8551_2(int x) { return x * 2; }
+inline int f8551_3(int x) { return x * 3; }
+inline int f8551_4(int x) { return x * 4; }
+inline int f8551_5(int x) { return x * 5; }
+inline int f8551_6(int x) { return x * 6; }
+inline int f8551_7(int x) { return x * 7; }
+inline int f8551_8(int x) { return x * 8; }
+inline int f8551_9(int x) { return x * 9; }
+inline int f8551_10(int x) { return x * 10; }
+inline int f8551_11(int x) { return x * 11; }
+inline int f8551_12(int x) { return x * 12; }
+inline int f8551_13(int x) { return x * 13; }
+inline int f8551_14(int x) { return x * 14; }
+inline int f8551_15(int x) { return x * 15; }
+inline int f8551_16(int x) { return x * 16; }
+inline int f8551_17(int x) { return x * 17; }
+inline int f8551_18(int x) { return x * 18; }
+inline int f8551_19(int x) { return x * 19; }
+inline int f8551_20(int x) { return x * 20; }
+inline int f8551_21(int x) { return x * 21; }
+inline int f8551_22(int x) { return x * 22; }
+inline int f8551_23(int x) { return x * 23; }
+inline int f8551_24(int x) { return x * 24; }
+inline int f8551_25(int x) { return x * 25; }
+inline int f8551_26(int x) { return x * 26; }
+inline int f8551_27(int x) { return x * 27; }
+inline int f8551_28(int x) { return x * 28; }
+inline int f8551_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8554 */
+#include <vector>
+#include "h763.h"
+#include "h3303.h"
+#include "h1510.h"
+#include "h2504.h"
+#include "h6687.h"
+#ifdef X
+#include "h5854.h"
+#endif
+struct S8554 { int a; const char *s = "x//y"; };
+inline int f8554_0(int x) { return x * 0; }
+inline int f8554_1(int x) { return x * 1; }
+inline int f8554_2(int x) { return x * 2; }
+inline int f8554_3(int x) { return x * 3; }
+inline int f8554_4(int x) { return x * 4; }
+inline int f8554_5(int x) { return x * 5; }
+inline int f8554_6(int x) { return x * 6; }
+inline int f8554_7(int x) { return x * 7; }
+inline int f8554_8(int x) { return x * 8; }
+inline int f8554_9(int x) { return x * 9; }
+inline int f8554_10(int x) { return x * 10; }
+inline int f8554_11(int x) { return x * 11; }
+inline int f8554_12(int x) { return x * 12; }
+inline int f8554_13(int x) { return x * 13; }
+inline int f8554_14(int x) { return x * 14; }
+inline int f8554_15(int x) { return x * 15; }
+inline int f8554_16(int x) { return x * 16; }
+inline int f8554_17(int x) { return x * 17; }
+inline int f8554_18(int x) { return x * 18; }
+inline int f8554_19(int x) { return x * 19; }
+inline int f8554_20(int x) { return x * 20; }
+inline int f8554_21(int x) { return x * 21; }
+inline int f8554_22(int x) { return x * 22; }
+inline int f8554_23(int x) { return x * 23; }
+inline int f8554_24(int x) { return x * 24; }
+inline int f8554_25(int x) { return x * 25; }
+inline int f8554_26(int x) { return x * 26; }
+inline int f8554_27(int x) { return x * 27; }
+inline int f8554_28(int x) { return x * 28; }
+inline int f8554_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8557 */
+#include <vector>
+#include "h3586.h"
+#include "h6890.h"
+#include "h4814.h"
+#include "h5678.h"
+#include "h8863.h"
+#ifdef X
+#include "h9509.h"
+#endif
+struct S8557 { int a; const char *s = "x//y"; };
+inline int f8557_0(int x) { return x * 0; }
+inline int f8557_1(int x) { return x * 1; }
+inline int f8557_2(int x) { return x * 2; }
+inline int f8557_3(int x) { return x * 3; }
+inline int f8557_4(int x) { return x * 4; }
+inline int f8557_5(int x) { return x * 5; }
+inline int f8557_6(int x) { return x * 6; }
+inline int f8557_7(int x) { return x * 7; }
+inline int f8557_8(int x) { return x * 8; }
+inline int f8557_9(int x) { return x * 9; }
+inline int f8557_10(int x) { return x * 10; }
+inline int f8557_11(int x) { return x * 11; }
+inline int f8557_12(int x) { return x * 12; }
+inline int f8557_13(int x) { return x * 13; }
+inline int f8557_14(int x) { return x * 14; }
+inline int f8557_15(int x) { return x * 15; }
+inline int f8557_16(int x) { return x * 16; }
+inline int f8557_17(int x) { return x * 17; }
+inline int f8557_18(int x) { return x * 18; }
+inline int f8557_19(int x) { return x * 19; }
+inline int f8557_20(int x) { return x * 20; }
+inline int f8557_21(int x) { return x * 21; }
+inline int f8557_22(int x) { return x * 22; }
+inline int f8557_23(int x) { return x * 23; }
+inline int f8557_24(int x) { return x * 24; }
+inline int f8557_25(int x) { return x * 25; }
+inline int f8557_26(int x) { return x * 26; }
+inline int f8557_27(int x) { return x * 27; }
+inline int f8557_28(int x) { return x * 28; }
+inline int f8557_29(int x) { return x * 29; }
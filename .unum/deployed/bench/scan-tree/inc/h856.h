@@ -0,0 +1,42 @@
+#pragma once
+/* header 856 */
+#include <vector>
+#include "h3925.h"
+#include "h8890.h"
+#include "h2194.h"
+#include "h3388.h"
+#include "h578.h"
+#ifdef X
+#include "h2481.h"
+#endif
+struct S856 { int a; const char *s = "x//y"; };
+inline int f856_0(int x) { return x * 0; }
+inline int f856_1(int x) { return x * 1; }
+inline int f856_2(int x) { return x * 2; }
+inline int f856_3(int x) { return x * 3; }
+inline int f856_4(int x) { return x * 4; }
+inline int f856_5(int x) { return x * 5; }
+inline int f856_6(int x) { return x * 6; }
+inline int f856_7(int x) { return x * 7; }
+inline int f856_8(int x) { return x * 8; }
+inline int f856_9(int x) { return x * 9; }
+inline int f856_10(int x) { return x * 10; }
+inline int f856_11(int x) { return x * 11; }
+inline int f856_12(int x) { return x * 12; }
+inline int f856_13(int x) { return x * 13; }
+inline int f856_14(int x) { return x * 14; }
+inline int f856_15(int x) { return x * 15; }
+inline int f856_16(int x) { return x * 16; }
+inline int f856_17(int x) { return x * 17; }
+inline int f856_18(int x) { return x * 18; }
+inline int f856_19(int x) { return x * 19; }
+inline int f856_20(int x) { return x * 20; }
+inline int f856_21(int x) { return x * 21; }
+inline int f856_22(int x) { return x * 22; }
+inline int f856_23(int x) { return x * 23; }
+inline int f856_24(int x) { return x * 24; }
+inline int f856_25(int x) { return x * 25; }
+inline int f856_26(int x) { return x * 26; }
+inline int f856_27(int x) { return x * 27; }
+inline int f856_28(int x) { return x * 28; }
+inline int f856_29(int x) { return x * 29; }
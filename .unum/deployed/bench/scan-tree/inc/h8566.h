@@ -0,0 +1,42 @@
+#pragma once
+/* header 8566 */
+#include <vector>
+#include "h4718.h"
+#include "h7205.h"
+#include "h835.h"
+#include "h2136.h"
+#include "h5988.h"
+#ifdef X
+#include "h99.h"
+#endif
+struct S8566 { int a; const char *s = "x//y"; };
+inline int f8566_0(int x) { return x * 0; }
+inline int f8566_1(int x) { return x * 1; }
+inline int f8566_2(int x) { return x * 2; }
+inline int f8566_3(int x) { return x * 3; }
+inline int f8566_4(int x) { return x * 4; }
+inline int f8566_5(int x) { return x * 5; }
+inline int f8566_6(int x) { return x * 6; }
+inline int f8566_7(int x) { return x * 7; }
+inline int f8566_8(int x) { return x * 8; }
+inline int f8566_9(int x) { return x * 9; }
+inline int f8566_10(int x) { return x * 10; }
+inline int f8566_11(int x) { return x * 11; }
+inline int f8566_12(int x) { return x * 12; }
+inline int f8566_13(int x) { return x * 13; }
+inline int f8566_14(int x) { return x * 14; }
+inline int f8566_15(int x) { return x * 15; }
+inline int f8566_16(int x) { return x * 16; }
+inline int f8566_17(int x) { return x * 17; }
+inline int f8566_18(int x) { return x * 18; }
+inline int f8566_19(int x) { return x * 19; }
+inline int f8566_20(int x) { return x * 20; }
+inline int f8566_21(int x) { return x * 21; }
+inline int f8566_22(int x) { return x * 22; }
+inline int f8566_23(int x) { return x * 23; }
+inline int f8566_24(int x) { return x * 24; }
+inline int f8566_25(int x) { return x * 25; }
+inline int f8566_26(int x) { return x * 26; }
+inline int f8566_27(int x) { return x * 27; }
+inline int f8566_28(int x) { return x * 28; }
+inline int f8566_29(int x) { return x * 29; }
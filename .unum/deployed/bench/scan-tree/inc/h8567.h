@@ -0,0 +1,42 @@
+#pragma once
+/* header 8567 */
+#include <vector>
+#include "h2127.h"
+#include "h925.h"
+#include "h1893.h"
+#include "h9217.h"
+#include "h6227.h"
+#ifdef X
+#include "h3791.h"
+#endif
+struct S8567 { int a; const char *s = "x//y"; };
+inline int f8567_0(int x) { return x * 0; }
+inline int f8567_1(int x) { return x * 1; }
+inline int f8567_2(int x) { return x * 2; }
+inline int f8567_3(int x) { return x * 3; }
+inline int f8567_4(int x) { return x * 4; }
+inline int f8567_5(int x) { return x * 5; }
+inline int f8567_6(int x) { return x * 6; }
+inline int f8567_7(int x) { return x * 7; }
+inline int f8567_8(int x) { return x * 8; }
+inline int f8567_9(int x) { return x * 9; }
+inline int f8567_10(int x) { return x * 10; }
+inline int f8567_11(int x) { return x * 11; }
+inline int f8567_12(int x) { return x * 12; }
+inline int f8567_13(int x) { return x * 13; }
+inline int f8567_14(int x) { return x * 14; }
+inline int f8567_15(int x) { return x * 15; }
+inline int f8567_16(int x) { return x * 16; }
+inline int f8567_17(int x) { return x * 17; }
+inline int f8567_18(int x) { return x * 18; }
+inline int f8567_19(int x) { return x * 19; }
+inline int f8567_20(int x) { return x * 20; }
+inline int f8567_21(int x) { return x * 21; }
+inline int f8567_22(int x) { return x * 22; }
+inline int f8567_23(int x) { return x * 23; }
+inline int f8567_24(int x) { return x * 24; }
+inline int f8567_25(int x) { return x * 25; }
+inline int f8567_26(int x) { return x * 26; }
+inline int f8567_27(int x) { return x * 27; }
+inline int f8567_28(int x) { return x * 28; }
+inline int f8567_29(int x) { return x * 29; }
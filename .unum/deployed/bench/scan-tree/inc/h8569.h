@@ -0,0 +1,42 @@
+#pragma once
+/* header 8569 */
+#include <vector>
+#include "h5563.h"
+#include "h7710.h"
+#include "h8553.h"
+#include "h7995.h"
+#include "h895.h"
+#ifdef X
+#include "h8535.h"
+#endif
+struct S8569 { int a; const char *s = "x//y"; };
+inline int f8569_0(int x) { return x * 0; }
+inline int f8569_1(int x) { return x * 1; }
+inline int f8569_2(int x) { return x * 2; }
+inline int f8569_3(int x) { return x * 3; }
+inline int f8569_4(int x) { return x * 4; }
+inline int f8569_5(int x) { return x * 5; }
+inline int f8569_6(int x) { return x * 6; }
+inline int f8569_7(int x) { return x * 7; }
+inline int f8569_8(int x) { return x * 8; }
+inline int f8569_9(int x) { return x * 9; }
+inline int f8569_10(int x) { return x * 10; }
+inline int f8569_11(int x) { return x * 11; }
+inline int f8569_12(int x) { return x * 12; }
+inline int f8569_13(int x) { return x * 13; }
+inline int f8569_14(int x) { return x * 14; }
+inline int f8569_15(int x) { return x * 15; }
+inline int f8569_16(int x) { return x * 16; }
+inline int f8569_17(int x) { return x * 17; }
+inline int f8569_18(int x) { return x * 18; }
+inline int f8569_19(int x) { return x * 19; }
+inline int f8569_20(int x) { return x * 20; }
+inline int f8569_21(int x) { return x * 21; }
+inline int f8569_22(int x) { return x * 22; }
+inline int f8569_23(int x) { return x * 23; }
+inline int f8569_24(int x) { return x * 24; }
+inline int f8569_25(int x) { return x * 25; }
+inline int f8569_26(int x) { return x * 26; }
+inline int f8569_27(int x) { return x * 27; }
+inline int f8569_28(int x) { return x * 28; }
+inline int f8569_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 857 */
+#include <vector>
+#include "h4465.h"
+#include "h3381.h"
+#include "h2756.h"
+#include "h7485.h"
+#include "h5240.h"
+#ifdef X
+#include "h1964.h"
+#endif
+struct S857 { int a; const char *s = "x//y"; };
+inline int f857_0(int x) { return x * 0; }
+inline int f857_1(int x) { return x * 1; }
+inline int f857_2(int x) { return x * 2; }
+inline int f857_3(int x) { return x * 3; }
+inline int f857_4(int x) { return x * 4; }
+inline int f857_5(int x) { return x * 5; }
+inline int f857_6(int x) { return x * 6; }
+inline int f857_7(int x) { return x * 7; }
+inline int f857_8(int x) { return x * 8; }
+inline int f857_9(int x) { return x * 9; }
+inline int f857_10(int x) { return x * 10; }
+inline int f857_11(int x) { return x * 11; }
+inline int f857_12(int x) { return x * 12; }
+inline int f857_13(int x) { return x * 13; }
+inline int f857_14(int x) { return x * 14; }
+inline int f857_15(int x) { return x * 15; }
+inline int f857_16(int x) { return x * 16; }
+inline int f857_17(int x) { return x * 17; }
+inline int f857_18(int x) { return x * 18; }
+inline int f857_19(int x) { return x * 19; }
+inline int f857_20(int x) { return x * 20; }
+inline int f857_21(int x) { return x * 21; }
+inline int f857_22(int x) { return x * 22; }
+inline int f857_23(int x) { return x * 23; }
+inline int f857_24(int x) { return x * 24; }
+inline int f857_25(int x) { return x * 25; }
+inline int f857_26(int x) { return x * 26; }
+inline int f857_27(int x) { return x * 27; }
+inline int f857_28(int x) { return x * 28; }
+inline int f857_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8570 */
+#include <vector>
+#include "h2261.h"
+#include "h8110.h"
+#include "h3339.h"
+#include "h4755.h"
+#include "h4979.h"
+#ifdef X
+#include "h9301.h"
+#endif
+struct S8570 { int a; const char *s = "x//y"; };
+inline int f8570_0(int x) { return x * 0; }
+inline int f8570_1(int x) { return x * 1; }
+inline int f8570_2(int x) { return x * 2; }
+inline int f8570_3(int x) { return x * 3; }
+inline int f8570_4(int x) { return x * 4; }
+inline int f8570_5(int x) { return x * 5; }
+inline int f8570_6(int x) { return x * 6; }
+inline int f8570_7(int x) { return x * 7; }
+inline int f8570_8(int x) { return x * 8; }
+inline int f8570_9(int x) { return x * 9; }
+inline int f8570_10(int x) { return x * 10; }
+inline int f8570_11(int x) { return x * 11; }
+inline int f8570_12(int x) { return x * 12; }
+inline int f8570_13(int x) { return x * 13; }
+inline int f8570_14(int x) { return x * 14; }
+inline int f8570_15(int x) { return x * 15; }
+inline int f8570_16(int x) { return x * 16; }
+inline int f8570_17(int x) { return x * 17; }
+inline int f8570_18(int x) { return x * 18; }
+inline int f8570_19(int x) { return x * 19; }
+inline int f8570_20(int x) { return x * 20; }
+inline int f8570_21(int x) { return x * 21; }
+inline int f8570_22(int x) { return x * 22; }
+inline int f8570_23(int x) { return x * 23; }
+inline int f8570_24(int x) { return x * 24; }
+inline int f8570_25(int x) { return x * 25; }
+inline int f8570_26(int x) { return x * 26; }
+inline int f8570_27(int x) { return x * 27; }
+inline int f8570_28(int x) { return x * 28; }
+inline int f8570_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8571 */
+#include <vector>
+#include "h9671.h"
+#include "h5607.h"
+#include "h985.h"
+#include "h374.h"
+#include "h3070.h"
+#ifdef X
+#include "h7864.h"
+#endif
+struct S8571 { int a; const char *s = "x//y"; };
+inline int f8571_0(int x) { return x * 0; }
+inline int f8571_1(int x) { return x * 1; }
+inline int f8571_2(int x) { return x * 2; }
+inline int f8571_3(int x) { return x * 3; }
+inline int f8571_4(int x) { return x * 4; }
+inline int f8571_5(int x) { return x * 5; }
+inline int f8571_6(int x) { return x * 6; }
+inline int f8571_7(int x) { return x * 7; }
+inline int f8571_8(int x) { return x * 8; }
+inline int f8571_9(int x) { return x * 9; }
+inline int f8571_10(int x) { return x * 10; }
+inline int f8571_11(int x) { return x * 11; }
+inline int f8571_12(int x) { return x * 12; }
+inline int f8571_13(int x) { return x * 13; }
+inline int f8571_14(int x) { return x * 14; }
+inline int f8571_15(int x) { return x * 15; }
+inline int f8571_16(int x) { return x * 16; }
+inline int f8571_17(int x) { return x * 17; }
+inline int f8571_18(int x) { return x * 18; }
+inline int f8571_19(int x) { return x * 19; }
+inline int f8571_20(int x) { return x * 20; }
+inline int f8571_21(int x) { return x * 21; }
+inline int f8571_22(int x) { return x * 22; }
+inline int f8571_23(int x) { return x * 23; }
+inline int f8571_24(int x) { return x * 24; }
+inline int f8571_25(int x) { return x * 25; }
+inline int f8571_26(int x) { return x * 26; }
+inline int f8571_27(int x) { return x * 27; }
+inline int f8571_28(int x) { return x * 28; }
+inline int f8571_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8573 */
+#include <vector>
+#include "h6510.h"
+#include "h1070.h"
+#include "h2954.h"
+#include "h8364.h"
+#include "h6926.h"
+#ifdef X
+#include "h2663.h"
+#endif
+struct S8573 { int a; const char *s = "x//y"; };
+inline int f8573_0(int x) { return x * 0; }
+inline int f8573_1(int x) { return x * 1; }
+inline int f8573_2(int x) { return x * 2; }
+inline int f8573_3(int x) { return x * 3; }
+inline int f8573_4(int x) { return x * 4; }
+inline int f8573_5(int x) { return x * 5; }
+inline int f8573_6(int x) { return x * 6; }
+inline int f8573_7(int x) { return x * 7; }
+inline int f8573_8(int x) { return x * 8; }
+inline int f8573_9(int x) { return x * 9; }
+inline int f8573_10(int x) { return x * 10; }
+inline int f8573_11(int x) { return x * 11; }
+inline int f8573_12(int x) { return x * 12; }
+inline int f8573_13(int x) { return x * 13; }
+inline int f8573_14(int x) { return x * 14; }
+inline int f8573_15(int x) { return x * 15; }
+inline int f8573_16(int x) { return x * 16; }
+inline int f8573_17(int x) { return x * 17; }
+inline int f8573_18(int x) { return x * 18; }
+inline int f8573_19(int x) { return x * 19; }
+inline int f8573_20(int x) { return x * 20; }
+inline int f8573_21(int x) { return x * 21; }
+inline int f8573_22(int x) { return x * 22; }
+inline int f8573_23(int x) { return x * 23; }
+inline int f8573_24(int x) { return x * 24; }
+inline int f8573_25(int x) { return x * 25; }
+inline int f8573_26(int x) { return x * 26; }
+inline int f8573_27(int x) { return x * 27; }
+inline int f8573_28(int x) { return x * 28; }
+inline int f8573_29(int x) { return x * 29; }
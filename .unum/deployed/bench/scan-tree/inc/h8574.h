@@ -0,0 +1,42 @@
+#pragma once
+/* header 8574 */
+#include <vector>
+#include "h8981.h"
+#include "h6500.h"
+#include "h1385.h"
+#include "h7148.h"
+#include "h3486.h"
+#ifdef X
+#include "h6382.h"
+#endif
+struct S8574 { int a; const char *s = "x//y"; };
+inline int f8574_0(int x) { return x * 0; }
+inline int f8574_1(int x) { return x * 1; }
+inline int f8574_2(int x) { return x * 2; }
+inline int f8574_3(int x) { return x * 3; }
+inline int f8574_4(int x) { return x * 4; }
+inline int f8574_5(int x) { return x * 5; }
+inline int f8574_6(int x) { return x * 6; }
+inline int f8574_7(int x) { return x * 7; }
+inline int f8574_8(int x) { return x * 8; }
+inline int f8574_9(int x) { return x * 9; }
+inline int f8574_10(int x) { return x * 10; }
+inline int f8574_11(int x) { return x * 11; }
+inline int f8574_12(int x) { return x * 12; }
+inline int f8574_13(int x) { return x * 13; }
+inline int f8574_14(int x) { return x * 14; }
+inline int f8574_15(int x) { return x * 15; }
+inline int f8574_16(int x) { return x * 16; }
+inline int f8574_17(int x) { return x * 17; }
+inline int f8574_18(int x) { return x * 18; }
+inline int f8574_19(int x) { return x * 19; }
+inline int f8574_20(int x) { return x * 20; }
+inline int f8574_21(int x) { return x * 21; }
+inline int f8574_22(int x) { return x * 22; }
+inline int f8574_23(int x) { return x * 23; }
+inline int f8574_24(int x) { return x * 24; }
+inline int f8574_25(int x) { return x * 25; }
+inline int f8574_26(int x) { return x * 26; }
+inline int f8574_27(int x) { return x * 27; }
+inline int f8574_28(int x) { return x * 28; }
+inline int f8574_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8577 */
+#include <vector>
+#include "h8066.h"
+#include "h274.h"
+#include "h9138.h"
+#include "h566.h"
+#include "h5366.h"
+#ifdef X
+#include "h6486.h"
+#endif
+struct S8577 { int a; const char *s = "x//y"; };
+inline int f8577_0(int x) { return x * 0; }
+inline int f8577_1(int x) { return x * 1; }
+inline int f8577_2(int x) { return x * 2; }
+inline int f8577_3(int x) { return x * 3; }
+inline int f8577_4(int x) { return x * 4; }
+inline int f8577_5(int x) { return x * 5; }
+inline int f8577_6(int x) { return x * 6; }
+inline int f8577_7(int x) { return x * 7; }
+inline int f8577_8(int x) { return x * 8; }
+inline int f8577_9(int x) { return x * 9; }
+inline int f8577_10(int x) { return x * 10; }
+inline int f8577_11(int x) { return x * 11; }
+inline int f8577_12(int x) { return x * 12; }
+inline int f8577_13(int x) { return x * 13; }
+inline int f8577_14(int x) { return x * 14; }
+inline int f8577_15(int x) { return x * 15; }
+inline int f8577_16(int x) { return x * 16; }
+inline int f8577_17(int x) { return x * 17; }
+inline int f8577_18(int x) { return x * 18; }
+inline int f8577_19(int x) { return x * 19; }
+inline int f8577_20(int x) { return x * 20; }
+inline int f8577_21(int x) { return x * 21; }
+inline int f8577_22(int x) { return x * 22; }
+inline int f8577_23(int x) { return x * 23; }
+inline int f8577_24(int x) { return x * 24; }
+inline int f8577_25(int x) { return x * 25; }
+inline int f8577_26(int x) { return x * 26; }
+inline int f8577_27(int x) { return x * 27; }
+inline int f8577_28(int x) { return x * 28; }
+inline int f8577_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8581 */
+#include <vector>
+#include "h399.h"
+#include "h5511.h"
+#include "h2102.h"
+#include "h7225.h"
+#include "h5793.h"
+#ifdef X
+#include "h7510.h"
+#endif
+struct S8581 { int a; const char *s = "x//y"; };
+inline int f8581_0(int x) { return x * 0; }
+inline int f8581_1(int x) { return x * 1; }
+inline int f8581_2(int x) { return x * 2; }
+inline int f8581_3(int x) { return x * 3; }
+inline int f8581_4(int x) { return x * 4; }
+inline int f8581_5(int x) { return x * 5; }
+inline int f8581_6(int x) { return x * 6; }
+inline int f8581_7(int x) { return x * 7; }
+inline int f8581_8(int x) { return x * 8; }
+inline int f8581_9(int x) { return x * 9; }
+inline int f8581_10(int x) { return x * 10; }
+inline int f8581_11(int x) { return x * 11; }
+inline int f8581_12(int x) { return x * 12; }
+inline int f8581_13(int x) { return x * 13; }
+inline int f8581_14(int x) { return x * 14; }
+inline int f8581_15(int x) { return x * 15; }
+inline int f8581_16(int x) { return x * 16; }
+inline int f8581_17(int x) { return x * 17; }
+inline int f8581_18(int x) { return x * 18; }
+inline int f8581_19(int x) { return x * 19; }
+inline int f8581_20(int x) { return x * 20; }
+inline int f8581_21(int x) { return x * 21; }
+inline int f8581_22(int x) { return x * 22; }
+inline int f8581_23(int x) { return x * 23; }
+inline int f8581_24(int x) { return x * 24; }
+inline int f8581_25(int x) { return x * 25; }
+inline int f8581_26(int x) { return x * 26; }
+inline int f8581_27(int x) { return x * 27; }
+inline int f8581_28(int x) { return x * 28; }
+inline int f8581_29(int x) { return x * 29; }
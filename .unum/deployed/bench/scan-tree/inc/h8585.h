@@ -0,0 +1,42 @@
+#pragma once
+/* header 8585 */
+#include <vector>
+#include "h599.h"
+#include "h9895.h"
+#include "h5583.h"
+#include "h4857.h"
+#include "h5797.h"
+#ifdef X
+#include "h2639.h"
+#endif
+struct S8585 { int a; const char *s = "x//y"; };
+inline int f8585_0(int x) { return x * 0; }
+inline int f8585_1(int x) { return x * 1; }
+inline int f8585_2(int x) { return x * 2; }
+inline int f8585_3(int x) { return x * 3; }
+inline int f8585_4(int x) { return x * 4; }
+inline int f8585_5(int x) { return x * 5; }
+inline int f8585_6(int x) { return x * 6; }
+inline int f8585_7(int x) { return x * 7; }
+inline int f8585_8(int x) { return x * 8; }
+inline int f8585_9(int x) { return x * 9; }
+inline int f8585_10(int x) { return x * 10; }
+inline int f8585_11(int x) { return x * 11; }
+inline int f8585_12(int x) { return x * 12; }
+inline int f8585_13(int x) { return x * 13; }
+inline int f8585_14(int x) { return x * 14; }
+inline int f8585_15(int x) { return x * 15; }
+inline int f8585_16(int x) { return x * 16; }
+inline int f8585_17(int x) { return x * 17; }
+inline int f8585_18(int x) { return x * 18; }
+inline int f8585_19(int x) { return x * 19; }
+inline int f8585_20(int x) { return x * 20; }
+inline int f8585_21(int x) { return x * 21; }
+inline int f8585_22(int x) { return x * 22; }
+inline int f8585_23(int x) { return x * 23; }
+inline int f8585_24(int x) { return x * 24; }
+inline int f8585_25(int x) { return x * 25; }
+inline int f8585_26(int x) { return x * 26; }
+inline int f8585_27(int x) { return x * 27; }
+inline int f8585_28(int x) { return x * 28; }
+inline int f8585_29(int x) { return x * 29; }
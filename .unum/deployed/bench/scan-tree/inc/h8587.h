@@ -0,0 +1,42 @@
+#pragma once
+/* header 8587 */
+#include <vector>
+#include "h6628.h"
+#include "h8965.h"
+#include "h4349.h"
+#include "h6290.h"
+#include "h2359.h"
+#ifdef X
+#include "h6653.h"
+#endif
+struct S8587 { int a; const char *s = "x//y"; };
+inline int f8587_0(int x) { return x * 0; }
+inline int f8587_1(int x) { return x * 1; }
+inline int f8587_2(int x) { return x * 2; }
+inline int f8587_3(int x) { return x * 3; }
+inline int f8587_4(int x) { return x * 4; }
+inline int f8587_5(int x) { return x * 5; }
+inline int f8587_6(int x) { return x * 6; }
+inline int f8587_7(int x) { return x * 7; }
+inline int f8587_8(int x) { return x * 8; }
+inline int f8587_9(int x) { return x * 9; }
+inline int f8587_10(int x) { return x * 10; }
+inline int f8587_11(int x) { return x * 11; }
+inline int f8587_12(int x) { return x * 12; }
+inline int f8587_13(int x) { return x * 13; }
+inline int f8587_14(int x) { return x * 14; }
+inline int f8587_15(int x) { return x * 15; }
+inline int f8587_16(int x) { return x * 16; }
+inline int f8587_17(int x) { return x * 17; }
+inline int f8587_18(int x) { return x * 18; }
+inline int f8587_19(int x) { return x * 19; }
+inline int f8587_20(int x) { return x * 20; }
+inline int f8587_21(int x) { return x * 21; }
+inline int f8587_22(int x) { return x * 22; }
+inline int f8587_23(int x) { return x * 23; }
+inline int f8587_24(int x) { return x * 24; }
+inline int f8587_25(int x) { return x * 25; }
+inline int f8587_26(int x) { return x * 26; }
+inline int f8587_27(int x) { return x * 27; }
+inline int f8587_28(int x) { return x * 28; }
+inline int f8587_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8588 */
+#include <vector>
+#include "h70.h"
+#include "h673.h"
+#include "h1209.h"
+#include "h5317.h"
+#include "h1328.h"
+#ifdef X
+#include "h6059.h"
+#endif
+struct S8588 { int a; const char *s = "x//y"; };
+inline int f8588_0(int x) { return x * 0; }
+inline int f8588_1(int x) { return x * 1; }
+inline int f8588_2(int x) { return x * 2; }
+inline int f8588_3(int x) { return x * 3; }
+inline int f8588_4(int x) { return x * 4; }
+inline int f8588_5(int x) { return x * 5; }
+inline int f8588_6(int x) { return x * 6; }
+inline int f8588_7(int x) { return x * 7; }
+inline int f8588_8(int x) { return x * 8; }
+inline int f8588_9(int x) { return x * 9; }
+inline int f8588_10(int x) { return x * 10; }
+inline int f8588_11(int x) { return x * 11; }
+inline int f8588_12(int x) { return x * 12; }
+inline int f8588_13(int x) { return x * 13; }
+inline int f8588_14(int x) { return x * 14; }
+inline int f8588_15(int x) { return x * 15; }
+inline int f8588_16(int x) { return x * 16; }
+inline int f8588_17(int x) { return x * 17; }
+inline int f8588_18(int x) { return x * 18; }
+inline int f8588_19(int x) { return x * 19; }
+inline int f8588_20(int x) { return x * 20; }
+inline int f8588_21(int x) { return x * 21; }
+inline int f8588_22(int x) { return x * 22; }
+inline int f8588_23(int x) { return x * 23; }
+inline int f8588_24(int x) { return x * 24; }
+inline int f8588_25(int x) { return x * 25; }
+inline int f8588_26(int x) { return x * 26; }
+inline int f8588_27(int x) { return x * 27; }
+inline int f8588_28(int x) { return x * 28; }
+inline int f8588_29(int x) { return x * 29; }
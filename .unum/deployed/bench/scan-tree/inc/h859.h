@@ -0,0 +1,42 @@
+#pragma once
+/* header 859 */
+#include <vector>
+#include "h8679.h"
+#include "h5108.h"
+#include "h5459.h"
+#include "h524.h"
+#include "h4799.h"
+#ifdef X
+#include "h3677.h"
+#endif
+struct S859 { int a; const char *s = "x//y"; };
+inline int f859_0(int x) { return x * 0; }
+inline int f859_1(int x) { return x * 1; }
+inline int f859_2(int x) { return x * 2; }
+inline int f859_3(int x) { return x * 3; }
+inline int f859_4(int x) { return x * 4; }
+inline int f859_5(int x) { return x * 5; }
+inline int f859_6(int x) { return x * 6; }
+inline int f859_7(int x) { return x * 7; }
+inline int f859_8(int x) { return x * 8; }
+inline int f859_9(int x) { return x * 9; }
+inline int f859_10(int x) { return x * 10; }
+inline int f859_11(int x) { return x * 11; }
+inline int f859_12(int x) { return x * 12; }
+inline int f859_13(int x) { return x * 13; }
+inline int f859_14(int x) { return x * 14; }
+inline int f859_15(int x) { return x * 15; }
+inline int f859_16(int x) { return x * 16; }
+inline int f859_17(int x) { return x * 17; }
+inline int f859_18(int x) { return x * 18; }
+inline int f859_19(int x) { return x * 19; }
+inline int f859_20(int x) { return x * 20; }
+inline int f859_21(int x) { return x * 21; }
+inline int f859_22(int x) { return x * 22; }
+inline int f859_23(int x) { return x * 23; }
+inline int f859_24(int x) { return x * 24; }
+inline int f859_25(int x) { return x * 25; }
+inline int f859_26(int x) { return x * 26; }
+inline int f859_27(int x) { return x * 27; }
+inline int f859_28(int x) { return x * 28; }
+inline int f859_29(int x) { return x * 29; }
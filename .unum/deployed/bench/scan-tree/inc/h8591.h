@@ -0,0 +1,42 @@
+#pragma once
+/* header 8591 */
+#include <vector>
+#include "h2790.h"
+#include "h5652.h"
+#include "h9799.h"
+#include "h7338.h"
+#include "h8562.h"
+#ifdef X
+#include "h1836.h"
+#endif
+struct S8591 { int a; const char *s = "x//y"; };
+inline int f8591_0(int x) { return x * 0; }
+inline int f8591_1(int x) { return x * 1; }
+inline int f8591_2(int x) { return x * 2; }
+inline int f8591_3(int x) { return x * 3; }
+inline int f8591_4(int x) { return x * 4; }
+inline int f8591_5(int x) { return x * 5; }
+inline int f8591_6(int x) { return x * 6; }
+inline int f8591_7(int x) { return x * 7; }
+inline int f8591_8(int x) { return x * 8; }
+inline int f8591_9(int x) { return x * 9; }
+inline int f8591_10(int x) { return x * 10; }
+inline int f8591_11(int x) { return x * 11; }
+inline int f8591_12(int x) { return x * 12; }
+inline int f8591_13(int x) { return x * 13; }
+inline int f8591_14(int x) { return x * 14; }
+inline int f8591_15(int x) { return x * 15; }
+inline int f8591_16(int x) { return x * 16; }
+inline int f8591_17(int x) { return x * 17; }
+inline int f8591_18(int x) { return x * 18; }
+inline int f8591_19(int x) { return x * 19; }
+inline int f8591_20(int x) { return x * 20; }
+inline int f8591_21(int x) { return x * 21; }
+inline int f8591_22(int x) { return x * 22; }
+inline int f8591_23(int x) { return x * 23; }
+inline int f8591_24(int x) { return x * 24; }
+inline int f8591_25(int x) { return x * 25; }
+inline int f8591_26(int x) { return x * 26; }
+inline int f8591_27(int x) { return x * 27; }
+inline int f8591_28(int x) { return x * 28; }
+inline int f8591_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8595 */
+#include <vector>
+#include "h2140.h"
+#include "h6342.h"
+#include "h2729.h"
+#include "h4642.h"
+#include "h9833.h"
+#ifdef X
+#include "h6285.h"
+#endif
+struct S8595 { int a; const char *s = "x//y"; };
+inline int f8595_0(int x) { return x * 0; }
+inline int f8595_1(int x) { return x * 1; }
+inline int f8595_2(int x) { return x * 2; }
+inline int f8595_3(int x) { return x * 3; }
+inline int f8595_4(int x) { return x * 4; }
+inline int f8595_5(int x) { return x * 5; }
+inline int f8595_6(int x) { return x * 6; }
+inline int f8595_7(int x) { return x * 7; }
+inline int f8595_8(int x) { return x * 8; }
+inline int f8595_9(int x) { return x * 9; }
+inline int f8595_10(int x) { return x * 10; }
+inline int f8595_11(int x) { return x * 11; }
+inline int f8595_12(int x) { return x * 12; }
+inline int f8595_13(int x) { return x * 13; }
+inline int f8595_14(int x) { return x * 14; }
+inline int f8595_15(int x) { return x * 15; }
+inline int f8595_16(int x) { return x * 16; }
+inline int f8595_17(int x) { return x * 17; }
+inline int f8595_18(int x) { return x * 18; }
+inline int f8595_19(int x) { return x * 19; }
+inline int f8595_20(int x) { return x * 20; }
+inline int f8595_21(int x) { return x * 21; }
+inline int f8595_22(int x) { return x * 22; }
+inline int f8595_23(int x) { return x * 23; }
+inline int f8595_24(int x) { return x * 24; }
+inline int f8595_25(int x) { return x * 25; }
+inline int f8595_26(int x) { return x * 26; }
+inline int f8595_27(int x) { return x * 27; }
+inline int f8595_28(int x) { return x * 28; }
+inline int f8595_29(int x) { return x * 29; }
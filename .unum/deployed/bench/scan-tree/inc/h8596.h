@@ -0,0 +1,42 @@
+#pragma once
+/* header 8596 */
+#include <vector>
+#include "h3099.h"
+#include "h7307.h"
+#include "h8639.h"
+#include "h9604.h"
+#include "h6014.h"
+#ifdef X
+#include "h3587.h"
+#endif
+struct S8596 { int a; const char *s = "x//y"; };
+inline int f8596_0(int x) { return x * 0; }
+inline int f8596_1(int x) { return x * 1; }
+inline int f8596_2(int x) { return x * 2; }
+inline int f8596_3(int x) { return x * 3; }
+inline int f8596_4(int x) { return x * 4; }
+inline int f8596_5(int x) { return x * 5; }
+inline int f8596_6(int x) { return x * 6; }
+inline int f8596_7(int x) { return x * 7; }
+inline int f8596_8(int x) { return x * 8; }
+inline int f8596_9(int x) { return x * 9; }
+inline int f8596_10(int x) { return x * 10; }
+inline int f8596_11(int x) { return x * 11; }
+inline int f8596_12(int x) { return x * 12; }
+inline int f8596_13(int x) { return x * 13; }
+inline int f8596_14(int x) { return x * 14; }
+inline int f8596_15(int x) { return x * 15; }
+inline int f8596_16(int x) { return x * 16; }
+inline int f8596_17(int x) { return x * 17; }
+inline int f8596_18(int x) { return x * 18; }
+inline int f8596_19(int x) { return x * 19; }
+inline int f8596_20(int x) { return x * 20; }
+inline int f8596_21(int x) { return x * 21; }
+inline int f8596_22(int x) { return x * 22; }
+inline int f8596_23(int x) { return x * 23; }
+inline int f8596_24(int x) { return x * 24; }
+inline int f8596_25(int x) { return x * 25; }
+inline int f8596_26(int x) { return x * 26; }
+inline int f8596_27(int x) { return x * 27; }
+inline int f8596_28(int x) { return x * 28; }
+inline int f8596_29(int x) { return x * 29; }
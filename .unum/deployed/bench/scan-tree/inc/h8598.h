@@ -0,0 +1,42 @@
+#pragma once
+/* header 8598 */
+#include <vector>
+#include "h8564.h"
+#include "h7152.h"
+#include "h9517.h"
+#include "h6382.h"
+#include "h2327.h"
+#ifdef X
+#include "h6540.h"
+#endif
+struct S8598 { int a; const char *s = "x//y"; };
+inline int f8598_0(int x) { return x * 0; }
+inline int f8598_1(int x) { return x * 1; }
+inline int f8598_2(int x) { return x * 2; }
+inline int f8598_3(int x) { return x * 3; }
+inline int f8598_4(int x) { return x * 4; }
+inline int f8598_5(int x) { return x * 5; }
+inline int f8598_6(int x) { return x * 6; }
+inline int f8598_7(int x) { return x * 7; }
+inline int f8598_8(int x) { return x * 8; }
+inline int f8598_9(int x) { return x * 9; }
+inline int f8598_10(int x) { return x * 10; }
+inline int f8598_11(int x) { return x * 11; }
+inline int f8598_12(int x) { return x * 12; }
+inline int f8598_13(int x) { return x * 13; }
+inline int f8598_14(int x) { return x * 14; }
+inline int f8598_15(int x) { return x * 15; }
+inline int f8598_16(int x) { return x * 16; }
+inline int f8598_17(int x) { return x * 17; }
+inline int f8598_18(int x) { return x * 18; }
+inline int f8598_19(int x) { return x * 19; }
+inline int f8598_20(int x) { return x * 20; }
+inline int f8598_21(int x) { return x * 21; }
+inline int f8598_22(int x) { return x * 22; }
+inline int f8598_23(int x) { return x * 23; }
+inline int f8598_24(int x) { return x * 24; }
+inline int f8598_25(int x) { return x * 25; }
+inline int f8598_26(int x) { return x * 26; }
+inline int f8598_27(int x) { return x * 27; }
+inline int f8598_28(int x) { return x * 28; }
+inline int f8598_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 86 */
+#include <vector>
+#include "h5971.h"
+#include "h3030.h"
+#include "h7948.h"
+#include "h2870.h"
+#include "h8518.h"
+#ifdef X
+#include "h205.h"
+#endif
+struct S86 { int a; const char *s = "x//y"; };
+inline int f86_0(int x) { return x * 0; }
+inline int f86_1(int x) { return x * 1; }
+inline int f86_2(int x) { return x * 2; }
+inline int f86_3(int x) { return x * 3; }
+inline int f86_4(int x) { return x * 4; }
+inline int f86_5(int x) { return x * 5; }
+inline int f86_6(int x) { return x * 6; }
+inline int f86_7(int x) { return x * 7; }
+inline int f86_8(int x) { return x * 8; }
+inline int f86_9(int x) { return x * 9; }
+inline int f86_10(int x) { return x * 10; }
+inline int f86_11(int x) { return x * 11; }
+inline int f86_12(int x) { return x * 12; }
+inline int f86_13(int x) { return x * 13; }
+inline int f86_14(int x) { return x * 14; }
+inline int f86_15(int x) { return x * 15; }
+inline int f86_16(int x) { return x * 16; }
+inline int f86_17(int x) { return x * 17; }
+inline int f86_18(int x) { return x * 18; }
+inline int f86_19(int x) { return x * 19; }
+inline int f86_20(int x) { return x * 20; }
+inline int f86_21(int x) { return x * 21; }
+inline int f86_22(int x) { return x * 22; }
+inline int f86_23(int x) { return x * 23; }
+inline int f86_24(int x) { return x * 24; }
+inline int f86_25(int x) { return x * 25; }
+inline int f86_26(int x) { return x * 26; }
+inline int f86_27(int x) { return x * 27; }
+inline int f86_28(int x) { return x * 28; }
+inline int f86_29(int x) { return x * 29; }
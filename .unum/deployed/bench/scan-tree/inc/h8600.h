@@ -0,0 +1,42 @@
+#pragma once
+/* header 8600 */
+#include <vector>
+#include "h1153.h"
+#include "h7971.h"
+#include "h148.h"
+#include "h4002.h"
+#include "h1022.h"
+#ifdef X
+#include "h1820.h"
+#endif
+struct S8600 { int a; const char *s = "x//y"; };
+inline int f8600_0(int x) { return x * 0; }
+inline int f8600_1(int x) { return x * 1; }
+inline int f8600_2(int x) { return x * 2; }
+inline int f8600_3(int x) { return x * 3; }
+inline int f8600_4(int x) { return x * 4; }
+inline int f8600_5(int x) { return x * 5; }
+inline int f8600_6(int x) { return x * 6; }
+inline int f8600_7(int x) { return x * 7; }
+inline int f8600_8(int x) { return x * 8; }
+inline int f8600_9(int x) { return x * 9; }
+inline int f8600_10(int x) { return x * 10; }
+inline int f8600_11(int x) { return x * 11; }
+inline int f8600_12(int x) { return x * 12; }
+inline int f8600_13(int x) { return x * 13; }
+inline int f8600_14(int x) { return x * 14; }
+inline int f8600_15(int x) { return x * 15; }
+inline int f8600_16(int x) { return x * 16; }
+inline int f8600_17(int x) { return x * 17; }
+inline int f8600_18(int x) { return x * 18; }
+inline int f8600_19(int x) { return x * 19; }
+inline int f8600_20(int x) { return x * 20; }
+inline int f8600_21(int x) { return x * 21; }
+inline int f8600_22(int x) { return x * 22; }
+inline int f8600_23(int x) { return x * 23; }
+inline int f8600_24(int x) { return x * 24; }
+inline int f8600_25(int x) { return x * 25; }
+inline int f8600_26(int x) { return x * 26; }
+inline int f8600_27(int x) { return x * 27; }
+inline int f8600_28(int x) { return x * 28; }
+inline int f8600_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8602 */
+#include <vector>
+#include "h9075.h"
+#include "h1750.h"
+#include "h3668.h"
+#include "h542.h"
+#include "h4446.h"
+#ifdef X
+#include "h2233.h"
+#endif
+struct S8602 { int a; const char *s = "x//y"; };
+inline int f8602_0(int x) { return x * 0; }
+inline int f8602_1(int x) { return x * 1; }
+inline int f8602_2(int x) { return x * 2; }
+inline int f8602_3(int x) { return x * 3; }
+inline int f8602_4(int x) { return x * 4; }
+inline int f8602_5(int x) { return x * 5; }
+inline int f8602_6(int x) { return x * 6; }
+inline int f8602_7(int x) { return x * 7; }
+inline int f8602_8(int x) { return x * 8; }
+inline int f8602_9(int x) { return x * 9; }
+inline int f8602_10(int x) { return x * 10; }
+inline int f8602_11(int x) { return x * 11; }
+inline int f8602_12(int x) { return x * 12; }
+inline int f8602_13(int x) { return x * 13; }
+inline int f8602_14(int x) { return x * 14; }
+inline int f8602_15(int x) { return x * 15; }
+inline int f8602_16(int x) { return x * 16; }
+inline int f8602_17(int x) { return x * 17; }
+inline int f8602_18(int x) { return x * 18; }
+inline int f8602_19(int x) { return x * 19; }
+inline int f8602_20(int x) { return x * 20; }
+inline int f8602_21(int x) { return x * 21; }
+inline int f8602_22(int x) { return x * 22; }
+inline int f8602_23(int x) { return x * 23; }
+inline int f8602_24(int x) { return x * 24; }
+inline int f8602_25(int x) { return x * 25; }
+inline int f8602_26(int x) { return x * 26; }
+inline int f8602_27(int x) { return x * 27; }
+inline int f8602_28(int x) { return x * 28; }
+inline int f8602_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8604 */
+#include <vector>
+#include "h2815.h"
+#include "h2720.h"
+#include "h4384.h"
+#include "h360.h"
+#include "h2711.h"
+#ifdef X
+#include "h5734.h"
+#endif
+struct S8604 { int a; const char *s = "x//y"; };
+inline int f8604_0(int x) { return x * 0; }
+inline int f8604_1(int x) { return x * 1; }
+inline int f8604_2(int x) { return x * 2; }
+inline int f8604_3(int x) { return x * 3; }
+inline int f8604_4(int x) { return x * 4; }
+inline int f8604_5(int x) { return x * 5; }
+inline int f8604_6(int x) { return x * 6; }
+inline int f8604_7(int x) { return x * 7; }
+inline int f8604_8(int x) { return x * 8; }
+inline int f8604_9(int x) { return x * 9; }
+inline int f8604_10(int x) { return x * 10; }
+inline int f8604_11(int x) { return x * 11; }
+inline int f8604_12(int x) { return x * 12; }
+inline int f8604_13(int x) { return x * 13; }
+inline int f8604_14(int x) { return x * 14; }
+inline int f8604_15(int x) { return x * 15; }
+inline int f8604_16(int x) { return x * 16; }
+inline int f8604_17(int x) { return x * 17; }
+inline int f8604_18(int x) { return x * 18; }
+inline int f8604_19(int x) { return x * 19; }
+inline int f8604_20(int x) { return x * 20; }
+inline int f8604_21(int x) { return x * 21; }
+inline int f8604_22(int x) { return x * 22; }
+inline int f8604_23(int x) { return x * 23; }
+inline int f8604_24(int x) { return x * 24; }
+inline int f8604_25(int x) { return x * 25; }
+inline int f8604_26(int x) { return x * 26; }
+inline int f8604_27(int x) { return x * 27; }
+inline int f8604_28(int x) { return x * 28; }
+inline int f8604_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8606 */
+#include <vector>
+#include "h4908.h"
+#include "h9307.h"
+#include "h229.h"
+#include "h9595.h"
+#include "h2940.h"
+#ifdef X
+#include "h5400.h"
+#endif
+struct S8606 { int a; const char *s = "x//y"; };
+inline int f8606_0(int x) { return x * 0; }
+inline int f8606_1(int x) { return x * 1; }
+inline int f8606_2(int x) { return x * 2; }
+inline int f8606_3(int x) { return x * 3; }
+inline int f8606_4(int x) { return x * 4; }
+inline int f8606_5(int x) { return x * 5; }
+inline int f8606_6(int x) { return x * 6; }
+inline int f8606_7(int x) { return x * 7; }
+inline int f8606_8(int x) { return x * 8; }
+inline int f8606_9(int x) { return x * 9; }
+inline int f8606_10(int x) { return x * 10; }
+inline int f8606_11(int x) { return x * 11; }
+inline int f8606_12(int x) { return x * 12; }
+inline int f8606_13(int x) { return x * 13; }
+inline int f8606_14(int x) { return x * 14; }
+inline int f8606_15(int x) { return x * 15; }
+inline int f8606_16(int x) { return x * 16; }
+inline int f8606_17(int x) { return x * 17; }
+inline int f8606_18(int x) { return x * 18; }
+inline int f8606_19(int x) { return x * 19; }
+inline int f8606_20(int x) { return x * 20; }
+inline int f8606_21(int x) { return x * 21; }
+inline int f8606_22(int x) { return x * 22; }
+inline int f8606_23(int x) { return x * 23; }
+inline int f8606_24(int x) { return x * 24; }
+inline int f8606_25(int x) { return x * 25; }
+inline int f8606_26(int x) { return x * 26; }
+inline int f8606_27(int x) { return x * 27; }
+inline int f8606_28(int x) { return x * 28; }
+inline int f8606_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8607 */
+#include <vector>
+#include "h8688.h"
+#include "h6393.h"
+#include "h7452.h"
+#include "h5814.h"
+#include "h1705.h"
+#ifdef X
+#include "h8675.h"
+#endif
+struct S8607 { int a; const char *s = "x//y"; };
+inline int f8607_0(int x) { return x * 0; }
+inline int f8607_1(int x) { return x * 1; }
+inline int f8607_2(int x) { return x * 2; }
+inline int f8607_3(int x) { return x * 3; }
+inline int f8607_4(int x) { return x * 4; }
+inline int f8607_5(int x) { return x * 5; }
+inline int f8607_6(int x) { return x * 6; }
+inline int f8607_7(int x) { return x * 7; }
+inline int f8607_8(int x) { return x * 8; }
+inline int f8607_9(int x) { return x * 9; }
+inline int f8607_10(int x) { return x * 10; }
+inline int f8607_11(int x) { return x * 11; }
+inline int f8607_12(int x) { return x * 12; }
+inline int f8607_13(int x) { return x * 13; }
+inline int f8607_14(int x) { return x * 14; }
+inline int f8607_15(int x) { return x * 15; }
+inline int f8607_16(int x) { return x * 16; }
+inline int f8607_17(int x) { return x * 17; }
+inline int f8607_18(int x) { return x * 18; }
+inline int f8607_19(int x) { return x * 19; }
+inline int f8607_20(int x) { return x * 20; }
+inline int f8607_21(int x) { return x * 21; }
+inline int f8607_22(int x) { return x * 22; }
+inline int f8607_23(int x) { return x * 23; }
+inline int f8607_24(int x) { return x * 24; }
+inline int f8607_25(int x) { return x * 25; }
+inline int f8607_26(int x) { return x * 26; }
+inline int f8607_27(int x) { return x * 27; }
+inline int f8607_28(int x) { return x * 28; }
+inline int f8607_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8609 */
+#include <vector>
+#include "h5154.h"
+#include "h1291.h"
+#include "h1811.h"
+#include "h5641.h"
+#include "h3689.h"
+#ifdef X
+#include "h1304.h"
+#endif
+struct S8609 { int a; const char *s = "x//y"; };
+inline int f8609_0(int x) { return x * 0; }
+inline int f8609_1(int x) { return x * 1; }
+inline int f8609_2(int x) { return x * 2; }
+inline int f8609_3(int x) { return x * 3; }
+inline int f8609_4(int x) { return x * 4; }
+inline int f8609_5(int x) { return x * 5; }
+inline int f8609_6(int x) { return x * 6; }
+inline int f8609_7(int x) { return x * 7; }
+inline int f8609_8(int x) { return x * 8; }
+inline int f8609_9(int x) { return x * 9; }
+inline int f8609_10(int x) { return x * 10; }
+inline int f8609_11(int x) { return x * 11; }
+inline int f8609_12(int x) { return x * 12; }
+inline int f8609_13(int x) { return x * 13; }
+inline int f8609_14(int x) { return x * 14; }
+inline int f8609_15(int x) { return x * 15; }
+inline int f8609_16(int x) { return x * 16; }
+inline int f8609_17(int x) { return x * 17; }
+inline int f8609_18(int x) { return x * 18; }
+inline int f8609_19(int x) { return x * 19; }
+inline int f8609_20(int x) { return x * 20; }
+inline int f8609_21(int x) { return x * 21; }
+inline int f8609_22(int x) { return x * 22; }
+inline int f8609_23(int x) { return x * 23; }
+inline int f8609_24(int x) { return x * 24; }
+inline int f8609_25(int x) { return x * 25; }
+inline int f8609_26(int x) { return x * 26; }
+inline int f8609_27(int x) { return x * 27; }
+inline int f8609_28(int x) { return x * 28; }
+inline int f8609_29(int x) { return x * 29; }
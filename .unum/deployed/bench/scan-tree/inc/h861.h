@@ -0,0 +1,42 @@
+#pragma once
+/* header 861 */
+#include <vector>
+#include "h1135.h"
+#include "h2255.h"
+#include "h9672.h"
+#include "h8443.h"
+#include "h2121.h"
+#ifdef X
+#include "h6699.h"
+#endif
+struct S861 { int a; const char *s = "x//y"; };
+inline int f861_0(int x) { return x * 0; }
+inline int f861_1(int x) { return x * 1; }
+inline int f861_2(int x) { return x * 2; }
+inline int f861_3(int x) { return x * 3; }
+inline int f861_4(int x) { return x * 4; }
+inline int f861_5(int x) { return x * 5; }
+inline int f861_6(int x) { return x * 6; }
+inline int f861_7(int x) { return x * 7; }
+inline int f861_8(int x) { return x * 8; }
+inline int f861_9(int x) { return x * 9; }
+inline int f861_10(int x) { return x * 10; }
+inline int f861_11(int x) { return x * 11; }
+inline int f861_12(int x) { return x * 12; }
+inline int f861_13(int x) { return x * 13; }
+inline int f861_14(int x) { return x * 14; }
+inline int f861_15(int x) { return x * 15; }
+inline int f861_16(int x) { return x * 16; }
+inline int f861_17(int x) { return x * 17; }
+inline int f861_18(int x) { return x * 18; }
+inline int f861_19(int x) { return x * 19; }
+inline int f861_20(int x) { return x * 20; }
+inline int f861_21(int x) { return x * 21; }
+inline int f861_22(int x) { return x * 22; }
+inline int f861_23(int x) { return x * 23; }
+inline int f861_24(int x) { return x * 24; }
+inline int f861_25(int x) { return x * 25; }
+inline int f861_26(int x) { return x * 26; }
+inline int f861_27(int x) { return x * 27; }
+inline int f861_28(int x) { return x * 28; }
+inline int f861_29(int x) { return x * 29; }
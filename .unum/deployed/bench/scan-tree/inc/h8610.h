@@ -0,0 +1,42 @@
+#pragma once
+/* header 8610 */
+#include <vector>
+#include "h278.h"
+#include "h5601.h"
+#include "h9201.h"
+#include "h3981.h"
+#include "h9064.h"
+#ifdef X
+#include "h989.h"
+#endif
+struct S8610 { int a; const char *s = "x//y"; };
+inline int f8610_0(int x) { return x * 0; }
+inline int f8610_1(int x) { return x * 1; }
+inline int f8610_2(int x) { return x * 2; }
+inline int f8610_3(int x) { return x * 3; }
+inline int f8610_4(int x) { return x * 4; }
+inline int f8610_5(int x) { return x * 5; }
+inline int f8610_6(int x) { return x * 6; }
+inline int f8610_7(int x) { return x * 7; }
+inline int f8610_8(int x) { return x * 8; }
+inline int f8610_9(int x) { return x * 9; }
+inline int f8610_10(int x) { return x * 10; }
+inline int f8610_11(int x) { return x * 11; }
+inline int f8610_12(int x) { return x * 12; }
+inline int f8610_13(int x) { return x * 13; }
+inline int f8610_14(int x) { return x * 14; }
+inline int f8610_15(int x) { return x * 15; }
+inline int f8610_16(int x) { return x * 16; }
+inline int f8610_17(int x) { return x * 17; }
+inline int f8610_18(int x) { return x * 18; }
+inline int f8610_19(int x) { return x * 19; }
+inline int f8610_20(int x) { return x * 20; }
+inline int f8610_21(int x) { return x * 21; }
+inline int f8610_22(int x) { return x * 22; }
+inline int f8610_23(int x) { return x * 23; }
+inline int f8610_24(int x) { return x * 24; }
+inline int f8610_25(int x) { return x * 25; }
+inline int f8610_26(int x) { return x * 26; }
+inline int f8610_27(int x) { return x * 27; }
+inline int f8610_28(int x) { return x * 28; }
+inline int f8610_29(int x) { return x * 29; }
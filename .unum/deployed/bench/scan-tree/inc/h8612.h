@@ -0,0 +1,42 @@
+#pragma once
+/* header 8612 */
+#include <vector>
+#include "h9283.h"
+#include "h5300.h"
+#include "h9334.h"
+#include "h1494.h"
+#include "h8067.h"
+#ifdef X
+#include "h3068.h"
+#endif
+struct S8612 { int a; const char *s = "x//y"; };
+inline int f8612_0(int x) { return x * 0; }
+inline int f8612_1(int x) { return x * 1; }
+inline int f8612_2(int x) { return x * 2; }
+inline int f8612_3(int x) { return x * 3; }
+inline int f8612_4(int x) { return x * 4; }
+inline int f8612_5(int x) { return x * 5; }
+inline int f8612_6(int x) { return x * 6; }
+inline int f8612_7(int x) { return x * 7; }
+inline int f8612_8(int x) { return x * 8; }
+inline int f8612_9(int x) { return x * 9; }
+inline int f8612_10(int x) { return x * 10; }
+inline int f8612_11(int x) { return x * 11; }
+inline int f8612_12(int x) { return x * 12; }
+inline int f8612_13(int x) { return x * 13; }
+inline int f8612_14(int x) { return x * 14; }
+inline int f8612_15(int x) { return x * 15; }
+inline int f8612_16(int x) { return x * 16; }
+inline int f8612_17(int x) { return x * 17; }
+inline int f8612_18(int x) { return x * 18; }
+inline int f8612_19(int x) { return x * 19; }
+inline int f8612_20(int x) { return x * 20; }
+inline int f8612_21(int x) { return x * 21; }
+inline int f8612_22(int x) { return x * 22; }
+inline int f8612_23(int x) { return x * 23; }
+inline int f8612_24(int x) { return x * 24; }
+inline int f8612_25(int x) { return x * 25; }
+inline int f8612_26(int x) { return x * 26; }
+inline int f8612_27(int x) { return x * 27; }
+inline int f8612_28(int x) { return x * 28; }
+inline int f8612_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8621 */
+#include <vector>
+#include "h1029.h"
+#include "h9225.h"
+#include "h895.h"
+#include "h2875.h"
+#include "h4993.h"
+#ifdef X
+#include "h4566.h"
+#endif
+struct S8621 { int a; const char *s = "x//y"; };
+inline int f8621_0(int x) { return x * 0; }
+inline int f8621_1(int x) { return x * 1; }
+inline int f8621_2(int x) { return x * 2; }
+inline int f8621_3(int x) { return x * 3; }
+inline int f8621_4(int x) { return x * 4; }
+inline int f8621_5(int x) { return x * 5; }
+inline int f8621_6(int x) { return x * 6; }
+inline int f8621_7(int x) { return x * 7; }
+inline int f8621_8(int x) { return x * 8; }
+inline int f8621_9(int x) { return x * 9; }
+inline int f8621_10(int x) { return x * 10; }
+inline int f8621_11(int x) { return x * 11; }
+inline int f8621_12(int x) { return x * 12; }
+inline int f8621_13(int x) { return x * 13; }
+inline int f8621_14(int x) { return x * 14; }
+inline int f8621_15(int x) { return x * 15; }
+inline int f8621_16(int x) { return x * 16; }
+inline int f8621_17(int x) { return x * 17; }
+inline int f8621_18(int x) { return x * 18; }
+inline int f8621_19(int x) { return x * 19; }
+inline int f8621_20(int x) { return x * 20; }
+inline int f8621_21(int x) { return x * 21; }
+inline int f8621_22(int x) { return x * 22; }
+inline int f8621_23(int x) { return x * 23; }
+inline int f8621_24(int x) { return x * 24; }
+inline int f8621_25(int x) { return x * 25; }
+inline int f8621_26(int x) { return x * 26; }
+inline int f8621_27(int x) { return x * 27; }
+inline int f8621_28(int x) { return x * 28; }
+inline int f8621_29(int x) { return x * 29; }
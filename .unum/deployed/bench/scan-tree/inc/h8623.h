@@ -0,0 +1,42 @@
+#pragma once
+/* header 8623 */
+#include <vector>
+#include "h1764.h"
+#include "h9279.h"
+#include "h8211.h"
+#include "h39.h"
+#include "h6965.h"
+#ifdef X
+#include "h2316.h"
+#endif
+struct S8623 { int a; const char *s = "x//y"; };
+inline int f8623_0(int x) { return x * 0; }
+inline int f8623_1(int x) { return x * 1; }
+inline int f8623_2(int x) { return x * 2; }
+inline int f8623_3(int x) { return x * 3; }
+inline int f8623_4(int x) { return x * 4; }
+inline int f8623_5(int x) { return x * 5; }
+inline int f8623_6(int x) { return x * 6; }
+inline int f8623_7(int x) { return x * 7; }
+inline int f8623_8(int x) { return x * 8; }
+inline int f8623_9(int x) { return x * 9; }
+inline int f8623_10(int x) { return x * 10; }
+inline int f8623_11(int x) { return x * 11; }
+inline int f8623_12(int x) { return x * 12; }
+inline int f8623_13(int x) { return x * 13; }
+inline int f8623_14(int x) { return x * 14; }
+inline int f8623_15(int x) { return x * 15; }
+inline int f8623_16(int x) { return x * 16; }
+inline int f8623_17(int x) { return x * 17; }
+inline int f8623_18(int x) { return x * 18; }
+inline int f8623_19(int x) { return x * 19; }
+inline int f8623_20(int x) { return x * 20; }
+inline int f8623_21(int x) { return x * 21; }
+inline int f8623_22(int x) { return x * 22; }
+inline int f8623_23(int x) { return x * 23; }
+inline int f8623_24(int x) { return x * 24; }
+inline int f8623_25(int x) { return x * 25; }
+inline int f8623_26(int x) { return x * 26; }
+inline int f8623_27(int x) { return x * 27; }
+inline int f8623_28(int x) { return x * 28; }
+inline int f8623_29(int x) { return x * 29; }
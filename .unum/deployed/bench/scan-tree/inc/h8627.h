@@ -0,0 +1,42 @@
+#pragma once
+/* header 8627 */
+#include <vector>
+#include "h2644.h"
+#include "h8945.h"
+#include "h7499.h"
+#include "h3786.h"
+#include "h4022.h"
+#ifdef X
+#include "h5653.h"
+#endif
+struct S8627 { int a; const char *s = "x//y"; };
+inline int f8627_0(int x) { return x * 0; }
+inline int f8627_1(int x) { return x * 1; }
+inline int f8627_2(int x) { return x * 2; }
+inline int f8627_3(int x) { return x * 3; }
+inline int f8627_4(int x) { return x * 4; }
+inline int f8627_5(int x) { return x * 5; }
+inline int f8627_6(int x) { return x * 6; }
+inline int f8627_7(int x) { return x * 7; }
+inline int f8627_8(int x) { return x * 8; }
+inline int f8627_9(int x) { return x * 9; }
+inline int f8627_10(int x) { return x * 10; }
+inline int f8627_11(int x) { return x * 11; }
+inline int f8627_12(int x) { return x * 12; }
+inline int f8627_13(int x) { return x * 13; }
+inline int f8627_14(int x) { return x * 14; }
+inline int f8627_15(int x) { return x * 15; }
+inline int f8627_16(int x) { return x * 16; }
+inline int f8627_17(int x) { return x * 17; }
+inline int f8627_18(int x) { return x * 18; }
+inline int f8627_19(int x) { return x * 19; }
+inline int f8627_20(int x) { return x * 20; }
+inline int f8627_21(int x) { return x * 21; }
+inline int f8627_22(int x) { return x * 22; }
+inline int f8627_23(int x) { return x * 23; }
+inline int f8627_24(int x) { return x * 24; }
+inline int f8627_25(int x) { return x * 25; }
+inline int f8627_26(int x) { return x * 26; }
+inline int f8627_27(int x) { return x * 27; }
+inline int f8627_28(int x) { return x * 28; }
+inline int f8627_29(int x) { return x * 29; }
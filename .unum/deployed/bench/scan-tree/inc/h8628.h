@@ -0,0 +1,42 @@
+#pragma once
+/* header 8628 */
+#include <vector>
+#include "h3925.h"
+#include "h3907.h"
+#include "h5201.h"
+#include "h6174.h"
+#include "h7430.h"
+#ifdef X
+#include "h6168.h"
+#endif
+struct S8628 { int a; const char *s = "x//y"; };
+inline int f8628_0(int x) { return x * 0; }
+inline int f8628_1(int x) { return x * 1; }
+inline int f8628_2(int x) { return x * 2; }
+inline int f8628_3(int x) { return x * 3; }
+inline int f8628_4(int x) { return x * 4; }
+inline int f8628_5(int x) { return x * 5; }
+inline int f8628_6(int x) { return x * 6; }
+inline int f8628_7(int x) { return x * 7; }
+inline int f8628_8(int x) { return x * 8; }
+inline int f8628_9(int x) { return x * 9; }
+inline int f8628_10(int x) { return x * 10; }
+inline int f8628_11(int x) { return x * 11; }
+inline int f8628_12(int x) { return x * 12; }
+inline int f8628_13(int x) { return x * 13; }
+inline int f8628_14(int x) { return x * 14; }
+inline int f8628_15(int x) { return x * 15; }
+inline int f8628_16(int x) { return x * 16; }
+inline int f8628_17(int x) { return x * 17; }
+inline int f8628_18(int x) { return x * 18; }
+inline int f8628_19(int x) { return x * 19; }
+inline int f8628_20(int x) { return x * 20; }
+inline int f8628_21(int x) { return x * 21; }
+inline int f8628_22(int x) { return x * 22; }
+inline int f8628_23(int x) { return x * 23; }
+inline int f8628_24(int x) { return x * 24; }
+inline int f8628_25(int x) { return x * 25; }
+inline int f8628_26(int x) { return x * 26; }
+inline int f8628_27(int x) { return x * 27; }
+inline int f8628_28(int x) { return x * 28; }
+inline int f8628_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8629 */
+#include <vector>
+#include "h1155.h"
+#include "h9125.h"
+#include "h5585.h"
+#include "h6947.h"
+#include "h2172.h"
+#ifdef X
+#include "h4536.h"
+#endif
+struct S8629 { int a; const char *s = "x//y"; };
+inline int f8629_0(int x) { return x * 0; }
+inline int f8629_1(int x) { return x * 1; }
+inline int f8629_2(int x) { return x * 2; }
+inline int f8629_3(int x) { return x * 3; }
+inline int f8629_4(int x) { return x * 4; }
+inline int f8629_5(int x) { return x * 5; }
+inline int f8629_6(int x) { return x * 6; }
+inline int f8629_7(int x) { return x * 7; }
+inline int f8629_8(int x) { return x * 8; }
+inline int f8629_9(int x) { return x * 9; }
+inline int f8629_10(int x) { return x * 10; }
+inline int f8629_11(int x) { return x * 11; }
+inline int f8629_12(int x) { return x * 12; }
+inline int f8629_13(int x) { return x * 13; }
+inline int f8629_14(int x) { return x * 14; }
+inline int f8629_15(int x) { return x * 15; }
+inline int f8629_16(int x) { return x * 16; }
+inline int f8629_17(int x) { return x * 17; }
+inline int f8629_18(int x) { return x * 18; }
+inline int f8629_19(int x) { return x * 19; }
+inline int f8629_20(int x) { return x * 20; }
+inline int f8629_21(int x) { return x * 21; }
+inline int f8629_22(int x) { return x * 22; }
+inline int f8629_23(int x) { return x * 23; }
+inline int f8629_24(int x) { return x * 24; }
+inline int f8629_25(int x) { return x * 25; }
+inline int f8629_26(int x) { return x * 26; }
+inline int f8629_27(int x) { return x * 27; }
+inline int f8629_28(int x) { return x * 28; }
+inline int f8629_29(int x) { return x * 29; }
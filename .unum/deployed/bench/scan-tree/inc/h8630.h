@@ -0,0 +1,42 @@
+#pragma once
+/* header 8630 */
+#include <vector>
+#include "h3274.h"
+#include "h6743.h"
+#include "h9468.h"
+#include "h4532.h"
+#include "h2959.h"
+#ifdef X
+#include "h5258.h"
+#endif
+struct S8630 { int a; const char *s = "x//y"; };
+inline int f8630_0(int x) { return x * 0; }
+inline int f8630_1(int x) { return x * 1; }
+inline int f8630_2(int x) { return x * 2; }
+inline int f8630_3(int x) { return x * 3; }
+inline int f8630_4(int x) { return x * 4; }
+inline int f8630_5(int x) { return x * 5; }
+inline int f8630_6(int x) { return x * 6; }
+inline int f8630_7(int x) { return x * 7; }
+inline int f8630_8(int x) { return x * 8; }
+inline int f8630_9(int x) { return x * 9; }
+inline int f8630_10(int x) { return x * 10; }
+inline int f8630_11(int x) { return x * 11; }
+inline int f8630_12(int x) { return x * 12; }
+inline int f8630_13(int x) { return x * 13; }
+inline int f8630_14(int x) { return x * 14; }
+inline int f8630_15(int x) { return x * 15; }
+inline int f8630_16(int x) { return x * 16; }
+inline int f8630_17(int x) { return x * 17; }
+inline int f8630_18(int x) { return x * 18; }
+inline int f8630_19(int x) { return x * 19; }
+inline int f8630_20(int x) { return x * 20; }
+inline int f8630_21(int x) { return x * 21; }
+inline int f8630_22(int x) { return x * 22; }
+inline int f8630_23(int x) { return x * 23; }
+inline int f8630_24(int x) { return x * 24; }
+inline int f8630_25(int x) { return x * 25; }
+inline int f8630_26(int x) { return x * 26; }
+inline int f8630_27(int x) { return x * 27; }
+inline int f8630_28(int x) { return x * 28; }
+inline int f8630_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8631 */
+#include <vector>
+#include "h4388.h"
+#include "h8576.h"
+#include "h4177.h"
+#include "h866.h"
+#include "h5699.h"
+#ifdef X
+#include "h8174.h"
+#endif
+struct S8631 { int a; const char *s = "x//y"; };
+inline int f8631_0(int x) { return x * 0; }
+inline int f8631_1(int x) { return x * 1; }
+inline int f8631_2(int x) { return x * 2; }
+inline int f8631_3(int x) { return x * 3; }
+inline int f8631_4(int x) { return x * 4; }
+inline int f8631_5(int x) { return x * 5; }
+inline int f8631_6(int x) { return x * 6; }
+inline int f8631_7(int x) { return x * 7; }
+inline int f8631_8(int x) { return x * 8; }
+inline int f8631_9(int x) { return x * 9; }
+inline int f8631_10(int x) { return x * 10; }
+inline int f8631_11(int x) { return x * 11; }
+inline int f8631_12(int x) { return x * 12; }
+inline int f8631_13(int x) { return x * 13; }
+inline int f8631_14(int x) { return x * 14; }
+inline int f8631_15(int x) { return x * 15; }
+inline int f8631_16(int x) { return x * 16; }
+inline int f8631_17(int x) { return x * 17; }
+inline int f8631_18(int x) { return x * 18; }
+inline int f8631_19(int x) { return x * 19; }
+inline int f8631_20(int x) { return x * 20; }
+inline int f8631_21(int x) { return x * 21; }
+inline int f8631_22(int x) { return x * 22; }
+inline int f8631_23(int x) { return x * 23; }
+inline int f8631_24(int x) { return x * 24; }
+inline int f8631_25(int x) { return x * 25; }
+inline int f8631_26(int x) { return x * 26; }
+inline int f8631_27(int x) { return x * 27; }
+inline int f8631_28(int x) { return x * 28; }
+inline int f8631_29(int x) { return x * 29; }
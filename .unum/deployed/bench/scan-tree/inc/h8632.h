@@ -0,0 +1,42 @@
+#pragma once
+/* header 8632 */
+#include <vector>
+#include "h6341.h"
+#include "h6720.h"
+#include "h3731.h"
+#include "h7529.h"
+#include "h2646.h"
+#ifdef X
+#include "h2228.h"
+#endif
+struct S8632 { int a; const char *s = "x//y"; };
+inline int f8632_0(int x) { return x * 0; }
+inline int f8632_1(int x) { return x * 1; }
+inline int f8632_2(int x) { return x * 2; }
+inline int f8632_3(int x) { return x * 3; }
+inline int f8632_4(int x) { return x * 4; }
+inline int f8632_5(int x) { return x * 5; }
+inline int f8632_6(int x) { return x * 6; }
+inline int f8632_7(int x) { return x * 7; }
+inline int f8632_8(int x) { return x * 8; }
+inline int f8632_9(int x) { return x * 9; }
+inline int f8632_10(int x) { return x * 10; }
+inline int f8632_11(int x) { return x * 11; }
+inline int f8632_12(int x) { return x * 12; }
+inline int f8632_13(int x) { return x * 13; }
+inline int f8632_14(int x) { return x * 14; }
+inline int f8632_15(int x) { return x * 15; }
+inline int f8632_16(int x) { return x * 16; }
+inline int f8632_17(int x) { return x * 17; }
+inline int f8632_18(int x) { return x * 18; }
+inline int f8632_19(int x) { return x * 19; }
+inline int f8632_20(int x) { return x * 20; }
+inline int f8632_21(int x) { return x * 21; }
+inline int f8632_22(int x) { return x * 22; }
+inline int f8632_23(int x) { return x * 23; }
+inline int f8632_24(int x) { return x * 24; }
+inline int f8632_25(int x) { return x * 25; }
+inline int f8632_26(int x) { return x * 26; }
+inline int f8632_27(int x) { return x * 27; }
+inline int f8632_28(int x) { return x * 28; }
+inline int f8632_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8633 */
+#include <vector>
+#include "h3109.h"
+#include "h6526.h"
+#include "h4655.h"
+#include "h8697.h"
+#include "h3432.h"
+#ifdef X
+#include "h1877.h"
+#endif
+struct S8633 { int a; const char *s = "x//y"; };
+inline int f8633_0(int x) { return x * 0; }
+inline int f8633_1(int x) { return x * 1; }
+inline int f8633_2(int x) { return x * 2; }
+inline int f8633_3(int x) { return x * 3; }
+inline int f8633_4(int x) { return x * 4; }
+inline int f8633_5(int x) { return x * 5; }
+inline int f8633_6(int x) { return x * 6; }
+inline int f8633_7(int x) { return x * 7; }
+inline int f8633_8(int x) { return x * 8; }
+inline int f8633_9(int x) { return x * 9; }
+inline int f8633_10(int x) { return x * 10; }
+inline int f8633_11(int x) { return x * 11; }
+inline int f8633_12(int x) { return x * 12; }
+inline int f8633_13(int x) { return x * 13; }
+inline int f8633_14(int x) { return x * 14; }
+inline int f8633_15(int x) { return x * 15; }
+inline int f8633_16(int x) { return x * 16; }
+inline int f8633_17(int x) { return x * 17; }
+inline int f8633_18(int x) { return x * 18; }
+inline int f8633_19(int x) { return x * 19; }
+inline int f8633_20(int x) { return x * 20; }
+inline int f8633_21(int x) { return x * 21; }
+inline int f8633_22(int x) { return x * 22; }
+inline int f8633_23(int x) { return x * 23; }
+inline int f8633_24(int x) { return x * 24; }
+inline int f8633_25(int x) { return x * 25; }
+inline int f8633_26(int x) { return x * 26; }
+inline int f8633_27(int x) { return x * 27; }
+inline int f8633_28(int x) { return x * 28; }
+inline int f8633_29(int x) { return x * 29; }
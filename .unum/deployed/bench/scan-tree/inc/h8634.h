@@ -0,0 +1,42 @@
+#pragma once
+/* header 8634 */
+#include <vector>
+#include "h9384.h"
+#include "h3976.h"
+#include "h3493.h"
+#include "h4505.h"
+#include "h420.h"
+#ifdef X
+#include "h9405.h"
+#endif
+struct S8634 { int a; const char *s = "x//y"; };
+inline int f8634_0(int x) { return x * 0; }
+inline int f8634_1(int x) { return x * 1; }
+inline int f8634_2(int x) { return x * 2; }
+inline int f8634_3(int x) { return x * 3; }
+inline int f8634_4(int x) { return x * 4; }
+inline int f8634_5(int x) { return x * 5; }
+inline int f8634_6(int x) { return x * 6; }
+inline int f8634_7(int x) { return x * 7; }
+inline int f8634_8(int x) { return x * 8; }
+inline int f8634_9(int x) { return x * 9; }
+inline int f8634_10(int x) { return x * 10; }
+inline int f8634_11(int x) { return x * 11; }
+inline int f8634_12(int x) { return x * 12; }
+inline int f8634_13(int x) { return x * 13; }
+inline int f8634_14(int x) { return x * 14; }
+inline int f8634_15(int x) { return x * 15; }
+inline int f8634_16(int x) { return x * 16; }
+inline int f8634_17(int x) { return x * 17; }
+inline int f8634_18(int x) { return x * 18; }
+inline int f8634_19(int x) { return x * 19; }
+inline int f8634_20(int x) { return x * 20; }
+inline int f8634_21(int x) { return x * 21; }
+inline int f8634_22(int x) { return x * 22; }
+inline int f8634_23(int x) { return x * 23; }
+inline int f8634_24(int x) { return x * 24; }
+inline int f8634_25(int x) { return x * 25; }
+inline int f8634_26(int x) { return x * 26; }
+inline int f8634_27(int x) { return x * 27; }
+inline int f8634_28(int x) { return x * 28; }
+inline int f8634_29(int x) { return x * 29; }
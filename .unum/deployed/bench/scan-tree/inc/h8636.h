@@ -0,0 +1,42 @@
+#pragma once
+/* header 8636 */
+#include <vector>
+#include "h8330.h"
+#include "h7969.h"
+#include "h3515.h"
+#include "h5929.h"
+#include "h4333.h"
+#ifdef X
+#include "h7081.h"
+#endif
+struct S8636 { int a; const char *s = "x//y"; };
+inline int f8636_0(int x) { return x * 0; }
+inline int f8636_1(int x) { return x * 1; }
+inline int f8636_2(int x) { return x * 2; }
+inline int f8636_3(int x) { return x * 3; }
+inline int f8636_4(int x) { return x * 4; }
+inline int f8636_5(int x) { return x * 5; }
+inline int f8636_6(int x) { return x * 6; }
+inline int f8636_7(int x) { return x * 7; }
+inline int f8636_8(int x) { return x * 8; }
+inline int f8636_9(int x) { return x * 9; }
+inline int f8636_10(int x) { return x * 10; }
+inline int f8636_11(int x) { return x * 11; }
+inline int f8636_12(int x) { return x * 12; }
+inline int f8636_13(int x) { return x * 13; }
+inline int f8636_14(int x) { return x * 14; }
+inline int f8636_15(int x) { return x * 15; }
+inline int f8636_16(int x) { return x * 16; }
+inline int f8636_17(int x) { return x * 17; }
+inline int f8636_18(int x) { return x * 18; }
+inline int f8636_19(int x) { return x * 19; }
+inline int f8636_20(int x) { return x * 20; }
+inline int f8636_21(int x) { return x * 21; }
+inline int f8636_22(int x) { return x * 22; }
+inline int f8636_23(int x) { return x * 23; }
+inline int f8636_24(int x) { return x * 24; }
+inline int f8636_25(int x) { return x * 25; }
+inline int f8636_26(int x) { return x * 26; }
+inline int f8636_27(int x) { return x * 27; }
+inline int f8636_28(int x) { return x * 28; }
+inline int f8636_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8637 */
+#include <vector>
+#include "h8553.h"
+#include "h5580.h"
+#include "h9030.h"
+#include "h3296.h"
+#include "h8493.h"
+#ifdef X
+#include "h9409.h"
+#endif
+struct S8637 { int a; const char *s = "x//y"; };
+inline int f8637_0(int x) { return x * 0; }
+inline int f8637_1(int x) { return x * 1; }
+inline int f8637_2(int x) { return x * 2; }
+inline int f8637_3(int x) { return x * 3; }
+inline int f8637_4(int x) { return x * 4; }
+inline int f8637_5(int x) { return x * 5; }
+inline int f8637_6(int x) { return x * 6; }
+inline int f8637_7(int x) { return x * 7; }
+inline int f8637_8(int x) { return x * 8; }
+inline int f8637_9(int x) { return x * 9; }
+inline int f8637_10(int x) { return x * 10; }
+inline int f8637_11(int x) { return x * 11; }
+inline int f8637_12(int x) { return x * 12; }
+inline int f8637_13(int x) { return x * 13; }
+inline int f8637_14(int x) { return x * 14; }
+inline int f8637_15(int x) { return x * 15; }
+inline int f8637_16(int x) { return x * 16; }
+inline int f8637_17(int x) { return x * 17; }
+inline int f8637_18(int x) { return x * 18; }
+inline int f8637_19(int x) { return x * 19; }
+inline int f8637_20(int x) { return x * 20; }
+inline int f8637_21(int x) { return x * 21; }
+inline int f8637_22(int x) { return x * 22; }
+inline int f8637_23(int x) { return x * 23; }
+inline int f8637_24(int x) { return x * 24; }
+inline int f8637_25(int x) { return x * 25; }
+inline int f8637_26(int x) { return x * 26; }
+inline int f8637_27(int x) { return x * 27; }
+inline int f8637_28(int x) { return x * 28; }
+inline int f8637_29(int x) { return x * 29; }
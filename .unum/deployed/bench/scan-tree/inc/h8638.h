@@ -0,0 +1,42 @@
+#pragma once
+/* header 8638 */
+#include <vector>
+#include "h8537.h"
+#include "h7790.h"
+#include "h2760.h"
+#include "h1448.h"
+#include "h9188.h"
+#ifdef X
+#include "h1973.h"
+#endif
+struct S8638 { int a; const char *s = "x//y"; };
+inline int f8638_0(int x) { return x * 0; }
+inline int f8638_1(int x) { return x * 1; }
+inline int f8638_2(int x) { return x * 2; }
+inline int f8638_3(int x) { return x * 3; }
+inline int f8638_4(int x) { return x * 4; }
+inline int f8638_5(int x) { return x * 5; }
+inline int f8638_6(int x) { return x * 6; }
+inline int f8638_7(int x) { return x * 7; }
+inline int f8638_8(int x) { return x * 8; }
+inline int f8638_9(int x) { return x * 9; }
+inline int f8638_10(int x) { return x * 10; }
+inline int f8638_11(int x) { return x * 11; }
+inline int f8638_12(int x) { return x * 12; }
+inline int f8638_13(int x) { return x * 13; }
+inline int f8638_14(int x) { return x * 14; }
+inline int f8638_15(int x) { return x * 15; }
+inline int f8638_16(int x) { return x * 16; }
+inline int f8638_17(int x) { return x * 17; }
+inline int f8638_18(int x) { return x * 18; }
+inline int f8638_19(int x) { return x * 19; }
+inline int f8638_20(int x) { return x * 20; }
+inline int f8638_21(int x) { return x * 21; }
+inline int f8638_22(int x) { return x * 22; }
+inline int f8638_23(int x) { return x * 23; }
+inline int f8638_24(int x) { return x * 24; }
+inline int f8638_25(int x) { return x * 25; }
+inline int f8638_26(int x) { return x * 26; }
+inline int f8638_27(int x) { return x * 27; }
+inline int f8638_28(int x) { return x * 28; }
+inline int f8638_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8639 */
+#include <vector>
+#include "h7390.h"
+#include "h4583.h"
+#include "h5654.h"
+#include "h4241.h"
+#include "h696.h"
+#ifdef X
+#include "h3753.h"
+#endif
+struct S8639 { int a; const char *s = "x//y"; };
+inline int f8639_0(int x) { return x * 0; }
+inline int f8639_1(int x) { return x * 1; }
+inline int f8639_2(int x) { return x * 2; }
+inline int f8639_3(int x) { return x * 3; }
+inline int f8639_4(int x) { return x * 4; }
+inline int f8639_5(int x) { return x * 5; }
+inline int f8639_6(int x) { return x * 6; }
+inline int f8639_7(int x) { return x * 7; }
+inline int f8639_8(int x) { return x * 8; }
+inline int f8639_9(int x) { return x * 9; }
+inline int f8639_10(int x) { return x * 10; }
+inline int f8639_11(int x) { return x * 11; }
+inline int f8639_12(int x) { return x * 12; }
+inline int f8639_13(int x) { return x * 13; }
+inline int f8639_14(int x) { return x * 14; }
+inline int f8639_15(int x) { return x * 15; }
+inline int f8639_16(int x) { return x * 16; }
+inline int f8639_17(int x) { return x * 17; }
+inline int f8639_18(int x) { return x * 18; }
+inline int f8639_19(int x) { return x * 19; }
+inline int f8639_20(int x) { return x * 20; }
+inline int f8639_21(int x) { return x * 21; }
+inline int f8639_22(int x) { return x * 22; }
+inline int f8639_23(int x) { return x * 23; }
+inline int f8639_24(int x) { return x * 24; }
+inline int f8639_25(int x) { return x * 25; }
+inline int f8639_26(int x) { return x * 26; }
+inline int f8639_27(int x) { return x * 27; }
+inline int f8639_28(int x) { return x * 28; }
+inline int f8639_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 864 */
+#include <vector>
+#include "h2732.h"
+#include "h4048.h"
+#include "h5251.h"
+#include "h3886.h"
+#include "h3943.h"
+#ifdef X
+#include "h3413.h"
+#endif
+struct S864 { int a; const char *s = "x//y"; };
+inline int f864_0(int x) { return x * 0; }
+inline int f864_1(int x) { return x * 1; }
+inline int f864_2(int x) { return x * 2; }
+inline int f864_3(int x) { return x * 3; }
+inline int f864_4(int x) { return x * 4; }
+inline int f864_5(int x) { return x * 5; }
+inline int f864_6(int x) { return x * 6; }
+inline int f864_7(int x) { return x * 7; }
+inline int f864_8(int x) { return x * 8; }
+inline int f864_9(int x) { return x * 9; }
+inline int f864_10(int x) { return x * 10; }
+inline int f864_11(int x) { return x * 11; }
+inline int f864_12(int x) { return x * 12; }
+inline int f864_13(int x) { return x * 13; }
+inline int f864_14(int x) { return x * 14; }
+inline int f864_15(int x) { return x * 15; }
+inline int f864_16(int x) { return x * 16; }
+inline int f864_17(int x) { return x * 17; }
+inline int f864_18(int x) { return x * 18; }
+inline int f864_19(int x) { return x * 19; }
+inline int f864_20(int x) { return x * 20; }
+inline int f864_21(int x) { return x * 21; }
+inline int f864_22(int x) { return x * 22; }
+inline int f864_23(int x) { return x * 23; }
+inline int f864_24(int x) { return x * 24; }
+inline int f864_25(int x) { return x * 25; }
+inline int f864_26(int x) { return x * 26; }
+inline int f864_27(int x) { return x * 27; }
+inline int f864_28(int x) { return x * 28; }
+inline int f864_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8642 */
+#include <vector>
+#include "h9547.h"
+#include "h2916.h"
+#include "h5462.h"
+#include "h9438.h"
+#include "h5794.h"
+#ifdef X
+#include "h981.h"
+#endif
+struct S8642 { int a; const char *s = "x//y"; };
+inline int f8642_0(int x) { return x * 0; }
+inline int f8642_1(int x) { return x * 1; }
+inline int f8642_2(int x) { return x * 2; }
+inline int f8642_3(int x) { return x * 3; }
+inline int f8642_4(int x) { return x * 4; }
+inline int f8642_5(int x) { return x * 5; }
+inline int f8642_6(int x) { return x * 6; }
+inline int f8642_7(int x) { return x * 7; }
+inline int f8642_8(int x) { return x * 8; }
+inline int f8642_9(int x) { return x * 9; }
+inline int f8642_10(int x) { return x * 10; }
+inline int f8642_11(int x) { return x * 11; }
+inline int f8642_12(int x) { return x * 12; }
+inline int f8642_13(int x) { return x * 13; }
+inline int f8642_14(int x) { return x * 14; }
+inline int f8642_15(int x) { return x * 15; }
+inline int f8642_16(int x) { return x * 16; }
+inline int f8642_17(int x) { return x * 17; }
+inline int f8642_18(int x) { return x * 18; }
+inline int f8642_19(int x) { return x * 19; }
+inline int f8642_20(int x) { return x * 20; }
+inline int f8642_21(int x) { return x * 21; }
+inline int f8642_22(int x) { return x * 22; }
+inline int f8642_23(int x) { return x * 23; }
+inline int f8642_24(int x) { return x * 24; }
+inline int f8642_25(int x) { return x * 25; }
+inline int f8642_26(int x) { return x * 26; }
+inline int f8642_27(int x) { return x * 27; }
+inline int f8642_28(int x) { return x * 28; }
+inline int f8642_29(int x) { return x * 29; }
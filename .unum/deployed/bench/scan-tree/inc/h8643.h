@@ -0,0 +1,42 @@
+#pragma once
+/* header 8643 */
+#include <vector>
+#include "h1473.h"
+#include "h2287.h"
+#include "h7799.h"
+#include "h6656.h"
+#include "h8752.h"
+#ifdef X
+#include "h4256.h"
+#endif
+struct S8643 { int a; const char *s = "x//y"; };
+inline int f8643_0(int x) { return x * 0; }
+inline int f8643_1(int x) { return x * 1; }
+inline int f8643_2(int x) { return x * 2; }
+inline int f8643_3(int x) { return x * 3; }
+inline int f8643_4(int x) { return x * 4; }
+inline int f8643_5(int x) { return x * 5; }
+inline int f8643_6(int x) { return x * 6; }
+inline int f8643_7(int x) { return x * 7; }
+inline int f8643_8(int x) { return x * 8; }
+inline int f8643_9(int x) { return x * 9; }
+inline int f8643_10(int x) { return x * 10; }
+inline int f8643_11(int x) { return x * 11; }
+inline int f8643_12(int x) { return x * 12; }
+inline int f8643_13(int x) { return x * 13; }
+inline int f8643_14(int x) { return x * 14; }
+inline int f8643_15(int x) { return x * 15; }
+inline int f8643_16(int x) { return x * 16; }
+inline int f8643_17(int x) { return x * 17; }
+inline int f8643_18(int x) { return x * 18; }
+inline int f8643_19(int x) { return x * 19; }
+inline int f8643_20(int x) { return x * 20; }
+inline int f8643_21(int x) { return x * 21; }
+inline int f8643_22(int x) { return x * 22; }
+inline int f8643_23(int x) { return x * 23; }
+inline int f8643_24(int x) { return x * 24; }
+inline int f8643_25(int x) { return x * 25; }
+inline int f8643_26(int x) { return x * 26; }
+inline int f8643_27(int x) { return x * 27; }
+inline int f8643_28(int x) { return x * 28; }
+inline int f8643_29(int x) { return x * 29; }
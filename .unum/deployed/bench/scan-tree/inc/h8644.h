@@ -0,0 +1,42 @@
+#pragma once
+/* header 8644 */
+#include <vector>
+#include "h9017.h"
+#include "h4179.h"
+#include "h7347.h"
+#include "h8642.h"
+#include "h8897.h"
+#ifdef X
+#include "h5000.h"
+#endif
+struct S8644 { int a; const char *s = "x//y"; };
+inline int f8644_0(int x) { return x * 0; }
+inline int f8644_1(int x) { return x * 1; }
+inline int f8644_2(int x) { return x * 2; }
+inline int f8644_3(int x) { return x * 3; }
+inline int f8644_4(int x) { return x * 4; }
+inline int f8644_5(int x) { return x * 5; }
+inline int f8644_6(int x) { return x * 6; }
+inline int f8644_7(int x) { return x * 7; }
+inline int f8644_8(int x) { return x * 8; }
+inline int f8644_9(int x) { return x * 9; }
+inline int f8644_10(int x) { return x * 10; }
+inline int f8644_11(int x) { return x * 11; }
+inline int f8644_12(int x) { return x * 12; }
+inline int f8644_13(int x) { return x * 13; }
+inline int f8644_14(int x) { return x * 14; }
+inline int f8644_15(int x) { return x * 15; }
+inline int f8644_16(int x) { return x * 16; }
+inline int f8644_17(int x) { return x * 17; }
+inline int f8644_18(int x) { return x * 18; }
+inline int f8644_19(int x) { return x * 19; }
+inline int f8644_20(int x) { return x * 20; }
+inline int f8644_21(int x) { return x * 21; }
+inline int f8644_22(int x) { return x * 22; }
+inline int f8644_23(int x) { return x * 23; }
+inline int f8644_24(int x) { return x * 24; }
+inline int f8644_25(int x) { return x * 25; }
+inline int f8644_26(int x) { return x * 26; }
+inline int f8644_27(int x) { return x * 27; }
+inline int f8644_28(int x) { return x * 28; }
+inline int f8644_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8645 */
+#include <vector>
+#include "h2135.h"
+#include "h6388.h"
+#include "h9067.h"
+#include "h1439.h"
+#include "h2450.h"
+#ifdef X
+#include "h6933.h"
+#endif
+struct S8645 { int a; const char *s = "x//y"; };
+inline int f8645_0(int x) { return x * 0; }
+inline int f8645_1(int x) { return x * 1; }
+inline int f8645_2(int x) { return x * 2; }
+inline int f8645_3(int x) { return x * 3; }
+inline int f8645_4(int x) { return x * 4; }
+inline int f8645_5(int x) { return x * 5; }
+inline int f8645_6(int x) { return x * 6; }
+inline int f8645_7(int x) { return x * 7; }
+inline int f8645_8(int x) { return x * 8; }
+inline int f8645_9(int x) { return x * 9; }
+inline int f8645_10(int x) { return x * 10; }
+inline int f8645_11(int x) { return x * 11; }
+inline int f8645_12(int x) { return x * 12; }
+inline int f8645_13(int x) { return x * 13; }
+inline int f8645_14(int x) { return x * 14; }
+inline int f8645_15(int x) { return x * 15; }
+inline int f8645_16(int x) { return x * 16; }
+inline int f8645_17(int x) { return x * 17; }
+inline int f8645_18(int x) { return x * 18; }
+inline int f8645_19(int x) { return x * 19; }
+inline int f8645_20(int x) { return x * 20; }
+inline int f8645_21(int x) { return x * 21; }
+inline int f8645_22(int x) { return x * 22; }
+inline int f8645_23(int x) { return x * 23; }
+inline int f8645_24(int x) { return x * 24; }
+inline int f8645_25(int x) { return x * 25; }
+inline int f8645_26(int x) { return x * 26; }
+inline int f8645_27(int x) { return x * 27; }
+inline int f8645_28(int x) { return x * 28; }
+inline int f8645_29(int x) { return x * 29; }
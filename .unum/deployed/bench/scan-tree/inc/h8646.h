@@ -0,0 +1,42 @@
+#pragma once
+/* header 8646 */
+#include <vector>
+#include "h6620.h"
+#include "h7735.h"
+#include "h4981.h"
+#include "h1821.h"
+#include "h1875.h"
+#ifdef X
+#include "h3118.h"
+#endif
+struct S8646 { int a; const char *s = "x//y"; };
+inline int f8646_0(int x) { return x * 0; }
+inline int f8646_1(int x) { return x * 1; }
+inline int f8646_2(int x) { return x * 2; }
+inline int f8646_3(int x) { return x * 3; }
+inline int f8646_4(int x) { return x * 4; }
+inline int f8646_5(int x) { return x * 5; }
+inline int f8646_6(int x) { return x * 6; }
+inline int f8646_7(int x) { return x * 7; }
+inline int f8646_8(int x) { return x * 8; }
+inline int f8646_9(int x) { return x * 9; }
+inline int f8646_10(int x) { return x * 10; }
+inline int f8646_11(int x) { return x * 11; }
+inline int f8646_12(int x) { return x * 12; }
+inline int f8646_13(int x) { return x * 13; }
+inline int f8646_14(int x) { return x * 14; }
+inline int f8646_15(int x) { return x * 15; }
+inline int f8646_16(int x) { return x * 16; }
+inline int f8646_17(int x) { return x * 17; }
+inline int f8646_18(int x) { return x * 18; }
+inline int f8646_19(int x) { return x * 19; }
+inline int f8646_20(int x) { return x * 20; }
+inline int f8646_21(int x) { return x * 21; }
+inline int f8646_22(int x) { return x * 22; }
+inline int f8646_23(int x) { return x * 23; }
+inline int f8646_24(int x) { return x * 24; }
+inline int f8646_25(int x) { return x * 25; }
+inline int f8646_26(int x) { return x * 26; }
+inline int f8646_27(int x) { return x * 27; }
+inline int f8646_28(int x) { return x * 28; }
+inline int f8646_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8648 */
+#include <vector>
+#include "h853.h"
+#include "h5705.h"
+#include "h7652.h"
+#include "h9410.h"
+#include "h3157.h"
+#ifdef X
+#include "h1698.h"
+#endif
+struct S8648 { int a; const char *s = "x//y"; };
+inline int f8648_0(int x) { return x * 0; }
+inline int f8648_1(int x) { return x * 1; }
+inline int f8648_2(int x) { return x * 2; }
+inline int f8648_3(int x) { return x * 3; }
+inline int f8648_4(int x) { return x * 4; }
+inline int f8648_5(int x) { return x * 5; }
+inline int f8648_6(int x) { return x * 6; }
+inline int f8648_7(int x) { return x * 7; }
+inline int f8648_8(int x) { return x * 8; }
+inline int f8648_9(int x) { return x * 9; }
+inline int f8648_10(int x) { return x * 10; }
+inline int f8648_11(int x) { return x * 11; }
+inline int f8648_12(int x) { return x * 12; }
+inline int f8648_13(int x) { return x * 13; }
+inline int f8648_14(int x) { return x * 14; }
+inline int f8648_15(int x) { return x * 15; }
+inline int f8648_16(int x) { return x * 16; }
+inline int f8648_17(int x) { return x * 17; }
+inline int f8648_18(int x) { return x * 18; }
+inline int f8648_19(int x) { return x * 19; }
+inline int f8648_20(int x) { return x * 20; }
+inline int f8648_21(int x) { return x * 21; }
+inline int f8648_22(int x) { return x * 22; }
+inline int f8648_23(int x) { return x * 23; }
+inline int f8648_24(int x) { return x * 24; }
+inline int f8648_25(int x) { return x * 25; }
+inline int f8648_26(int x) { return x * 26; }
+inline int f8648_27(int x) { return x * 27; }
+inline int f8648_28(int x) { return x * 28; }
+inline int f8648_29(int x) { return x * 29; }
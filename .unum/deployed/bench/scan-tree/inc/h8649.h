@@ -0,0 +1,42 @@
+#pragma once
+/* header 8649 */
+#include <vector>
+#include "h4653.h"
+#include "h3024.h"
+#include "h1220.h"
+#include "h155.h"
+#include "h6110.h"
+#ifdef X
+#include "h2562.h"
+#endif
+struct S8649 { int a; const char *s = "x//y"; };
+inline int f8649_0(int x) { return x * 0; }
+inline int f8649_1(int x) { return x * 1; }
+inline int f8649_2(int x) { return x * 2; }
+inline int f8649_3(int x) { return x * 3; }
+inline int f8649_4(int x) { return x * 4; }
+inline int f8649_5(int x) { return x * 5; }
+inline int f8649_6(int x) { return x * 6; }
+inline int f8649_7(int x) { return x * 7; }
+inline int f8649_8(int x) { return x * 8; }
+inline int f8649_9(int x) { return x * 9; }
+inline int f8649_10(int x) { return x * 10; }
+inline int f8649_11(int x) { return x * 11; }
+inline int f8649_12(int x) { return x * 12; }
+inline int f8649_13(int x) { return x * 13; }
+inline int f8649_14(int x) { return x * 14; }
+inline int f8649_15(int x) { return x * 15; }
+inline int f8649_16(int x) { return x * 16; }
+inline int f8649_17(int x) { return x * 17; }
+inline int f8649_18(int x) { return x * 18; }
+inline int f8649_19(int x) { return x * 19; }
+inline int f8649_20(int x) { return x * 20; }
+inline int f8649_21(int x) { return x * 21; }
+inline int f8649_22(int x) { return x * 22; }
+inline int f8649_23(int x) { return x * 23; }
+inline int f8649_24(int x) { return x * 24; }
+inline int f8649_25(int x) { return x * 25; }
+inline int f8649_26(int x) { return x * 26; }
+inline int f8649_27(int x) { return x * 27; }
+inline int f8649_28(int x) { return x * 28; }
+inline int f8649_29(int x) { return x * 29; }
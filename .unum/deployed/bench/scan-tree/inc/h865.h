@@ -0,0 +1,42 @@
+#pragma once
+/* header 865 */
+#include <vector>
+#include "h7731.h"
+#include "h5913.h"
+#include "h6806.h"
+#include "h8465.h"
+#include "h4055.h"
+#ifdef X
+#include "h3386.h"
+#endif
+struct S865 { int a; const char *s = "x//y"; };
+inline int f865_0(int x) { return x * 0; }
+inline int f865_1(int x) { return x * 1; }
+inline int f865_2(int x) { return x * 2; }
+inline int f865_3(int x) { return x * 3; }
+inline int f865_4(int x) { return x * 4; }
+inline int f865_5(int x) { return x * 5; }
+inline int f865_6(int x) { return x * 6; }
+inline int f865_7(int x) { return x * 7; }
+inline int f865_8(int x) { return x * 8; }
+inline int f865_9(int x) { return x * 9; }
+inline int f865_10(int x) { return x * 10; }
+inline int f865_11(int x) { return x * 11; }
+inline int f865_12(int x) { return x * 12; }
+inline int f865_13(int x) { return x * 13; }
+inline int f865_14(int x) { return x * 14; }
+inline int f865_15(int x) { return x * 15; }
+inline int f865_16(int x) { return x * 16; }
+inline int f865_17(int x) { return x * 17; }
+inline int f865_18(int x) { return x * 18; }
+inline int f865_19(int x) { return x * 19; }
+inline int f865_20(int x) { return x * 20; }
+inline int f865_21(int x) { return x * 21; }
+inline int f865_22(int x) { return x * 22; }
+inline int f865_23(int x) { return x * 23; }
+inline int f865_24(int x) { return x * 24; }
+inline int f865_25(int x) { return x * 25; }
+inline int f865_26(int x) { return x * 26; }
+inline int f865_27(int x) { return x * 27; }
+inline int f865_28(int x) { return x * 28; }
+inline int f865_29(int x) { return x * 29; }
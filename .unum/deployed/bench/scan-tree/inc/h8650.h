@@ -0,0 +1,42 @@
+#pragma once
+/* header 8650 */
+#include <vector>
+#include "h3798.h"
+#include "h7295.h"
+#include "h6554.h"
+#include "h7728.h"
+#include "h3766.h"
+#ifdef X
+#include "h7997.h"
+#endif
+struct S8650 { int a; const char *s = "x//y"; };
+inline int f8650_0(int x) { return x * 0; }
+inline int f8650_1(int x) { return x * 1; }
+inline int f8650_2(int x) { return x * 2; }
+inline int f8650_3(int x) { return x * 3; }
+inline int f8650_4(int x) { return x * 4; }
+inline int f8650_5(int x) { return x * 5; }
+inline int f8650_6(int x) { return x * 6; }
+inline int f8650_7(int x) { return x * 7; }
+inline int f8650_8(int x) { return x * 8; }
+inline int f8650_9(int x) { return x * 9; }
+inline int f8650_10(int x) { return x * 10; }
+inline int f8650_11(int x) { return x * 11; }
+inline int f8650_12(int x) { return x * 12; }
+inline int f8650_13(int x) { return x * 13; }
+inline int f8650_14(int x) { return x * 14; }
+inline int f8650_15(int x) { return x * 15; }
+inline int f8650_16(int x) { return x * 16; }
+inline int f8650_17(int x) { return x * 17; }
+inline int f8650_18(int x) { return x * 18; }
+inline int f8650_19(int x) { return x * 19; }
+inline int f8650_20(int x) { return x * 20; }
+inline int f8650_21(int x) { return x * 21; }
+inline int f8650_22(int x) { return x * 22; }
+inline int f8650_23(int x) { return x * 23; }
+inline int f8650_24(int x) { return x * 24; }
+inline int f8650_25(int x) { return x * 25; }
+inline int f8650_26(int x) { return x * 26; }
+inline int f8650_27(int x) { return x * 27; }
+inline int f8650_28(int x) { return x * 28; }
+inline int f8650_29(int x) { return x * 29; }
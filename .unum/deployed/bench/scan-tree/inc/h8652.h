@@ -0,0 +1,42 @@
+#pragma once
+/* header 8652 */
+#include <vector>
+#include "h566.h"
+#include "h9751.h"
+#include "h7188.h"
+#include "h9278.h"
+#include "h8643.h"
+#ifdef X
+#include "h1263.h"
+#endif
+struct S8652 { int a; const char *s = "x//y"; };
+inline int f8652_0(int x) { return x * 0; }
+inline int f8652_1(int x) { return x * 1; }
+inline int f8652_2(int x) { return x * 2; }
+inline int f8652_3(int x) { return x * 3; }
+inline int f8652_4(int x) { return x * 4; }
+inline int f8652_5(int x) { return x * 5; }
+inline int f8652_6(int x) { return x * 6; }
+inline int f8652_7(int x) { return x * 7; }
+inline int f8652_8(int x) { return x * 8; }
+inline int f8652_9(int x) { return x * 9; }
+inline int f8652_10(int x) { return x * 10; }
+inline int f8652_11(int x) { return x * 11; }
+inline int f8652_12(int x) { return x * 12; }
+inline int f8652_13(int x) { return x * 13; }
+inline int f8652_14(int x) { return x * 14; }
+inline int f8652_15(int x) { return x * 15; }
+inline int f8652_16(int x) { return x * 16; }
+inline int f8652_17(int x) { return x * 17; }
+inline int f8652_18(int x) { return x * 18; }
+inline int f8652_19(int x) { return x * 19; }
+inline int f8652_20(int x) { return x * 20; }
+inline int f8652_21(int x) { return x * 21; }
+inline int f8652_22(int x) { return x * 22; }
+inline int f8652_23(int x) { return x * 23; }
+inline int f8652_24(int x) { return x * 24; }
+inline int f8652_25(int x) { return x * 25; }
+inline int f8652_26(int x) { return x * 26; }
+inline int f8652_27(int x) { return x * 27; }
+inline int f8652_28(int x) { return x * 28; }
+inline int f8652_29(int x) { return x * 29; }
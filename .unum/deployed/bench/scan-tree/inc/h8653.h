@@ -0,0 +1,42 @@
+#pragma once
+/* header 8653 */
+#include <vector>
+#include "h4864.h"
+#include "h4668.h"
+#include "h1705.h"
+#include "h4049.h"
+#include "h2342.h"
+#ifdef X
+#include "h7678.h"
+#endif
+struct S8653 { int a; const char *s = "x//y"; };
+inline int f8653_0(int x) { return x * 0; }
+inline int f8653_1(int x) { return x * 1; }
+inline int f8653_2(int x) { return x * 2; }
+inline int f8653_3(int x) { return x * 3; }
+inline int f8653_4(int x) { return x * 4; }
+inline int f8653_5(int x) { return x * 5; }
+inline int f8653_6(int x) { return x * 6; }
+inline int f8653_7(int x) { return x * 7; }
+inline int f8653_8(int x) { return x * 8; }
+inline int f8653_9(int x) { return x * 9; }
+inline int f8653_10(int x) { return x * 10; }
+inline int f8653_11(int x) { return x * 11; }
+inline int f8653_12(int x) { return x * 12; }
+inline int f8653_13(int x) { return x * 13; }
+inline int f8653_14(int x) { return x * 14; }
+inline int f8653_15(int x) { return x * 15; }
+inline int f8653_16(int x) { return x * 16; }
+inline int f8653_17(int x) { return x * 17; }
+inline int f8653_18(int x) { return x * 18; }
+inline int f8653_19(int x) { return x * 19; }
+inline int f8653_20(int x) { return x * 20; }
+inline int f8653_21(int x) { return x * 21; }
+inline int f8653_22(int x) { return x * 22; }
+inline int f8653_23(int x) { return x * 23; }
+inline int f8653_24(int x) { return x * 24; }
+inline int f8653_25(int x) { return x * 25; }
+inline int f8653_26(int x) { return x * 26; }
+inline int f8653_27(int x) { return x * 27; }
+inline int f8653_28(int x) { return x * 28; }
+inline int f8653_29(int x) { return x * 29; }
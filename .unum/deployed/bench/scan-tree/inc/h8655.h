@@ -0,0 +1,42 @@
+#pragma once
+/* header 8655 */
+#include <vector>
+#include "h4156.h"
+#include "h5548.h"
+#include "h6482.h"
+#include "h1655.h"
+#include "h3598.h"
+#ifdef X
+#include "h4963.h"
+#endif
+struct S8655 { int a; const char *s = "x//y"; };
+inline int f8655_0(int x) { return x * 0; }
+inline int f8655_1(int x) { return x * 1; }
+inline int f8655_2(int x) { return x * 2; }
+inline int f8655_3(int x) { return x * 3; }
+inline int f8655_4(int x) { return x * 4; }
+inline int f8655_5(int x) { return x * 5; }
+inline int f8655_6(int x) { return x * 6; }
+inline int f8655_7(int x) { return x * 7; }
+inline int f8655_8(int x) { return x * 8; }
+inline int f8655_9(int x) { return x * 9; }
+inline int f8655_10(int x) { return x * 10; }
+inline int f8655_11(int x) { return x * 11; }
+inline int f8655_12(int x) { return x * 12; }
+inline int f8655_13(int x) { return x * 13; }
+inline int f8655_14(int x) { return x * 14; }
+inline int f8655_15(int x) { return x * 15; }
+inline int f8655_16(int x) { return x * 16; }
+inline int f8655_17(int x) { return x * 17; }
+inline int f8655_18(int x) { return x * 18; }
+inline int f8655_19(int x) { return x * 19; }
+inline int f8655_20(int x) { return x * 20; }
+inline int f8655_21(int x) { return x * 21; }
+inline int f8655_22(int x) { return x * 22; }
+inline int f8655_23(int x) { return x * 23; }
+inline int f8655_24(int x) { return x * 24; }
+inline int f8655_25(int x) { return x * 25; }
+inline int f8655_26(int x) { return x * 26; }
+inline int f8655_27(int x) { return x * 27; }
+inline int f8655_28(int x) { return x * 28; }
+inline int f8655_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8656 */
+#include <vector>
+#include "h4967.h"
+#include "h2948.h"
+#include "h6131.h"
+#include "h817.h"
+#include "h8769.h"
+#ifdef X
+#include "h8544.h"
+#endif
+struct S8656 { int a; const char *s = "x//y"; };
+inline int f8656_0(int x) { return x * 0; }
+inline int f8656_1(int x) { return x * 1; }
+inline int f8656_2(int x) { return x * 2; }
+inline int f8656_3(int x) { return x * 3; }
+inline int f8656_4(int x) { return x * 4; }
+inline int f8656_5(int x) { return x * 5; }
+inline int f8656_6(int x) { return x * 6; }
+inline int f8656_7(int x) { return x * 7; }
+inline int f8656_8(int x) { return x * 8; }
+inline int f8656_9(int x) { return x * 9; }
+inline int f8656_10(int x) { return x * 10; }
+inline int f8656_11(int x) { return x * 11; }
+inline int f8656_12(int x) { return x * 12; }
+inline int f8656_13(int x) { return x * 13; }
+inline int f8656_14(int x) { return x * 14; }
+inline int f8656_15(int x) { return x * 15; }
+inline int f8656_16(int x) { return x * 16; }
+inline int f8656_17(int x) { return x * 17; }
+inline int f8656_18(int x) { return x * 18; }
+inline int f8656_19(int x) { return x * 19; }
+inline int f8656_20(int x) { return x * 20; }
+inline int f8656_21(int x) { return x * 21; }
+inline int f8656_22(int x) { return x * 22; }
+inline int f8656_23(int x) { return x * 23; }
+inline int f8656_24(int x) { return x * 24; }
+inline int f8656_25(int x) { return x * 25; }
+inline int f8656_26(int x) { return x * 26; }
+inline int f8656_27(int x) { return x * 27; }
+inline int f8656_28(int x) { return x * 28; }
+inline int f8656_29(int x) { return x * 29; }
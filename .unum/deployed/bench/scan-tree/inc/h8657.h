@@ -0,0 +1,42 @@
+#pragma once
+/* header 8657 */
+#include <vector>
+#include "h5900.h"
+#include "h4423.h"
+#include "h6570.h"
+#include "h4302.h"
+#include "h9414.h"
+#ifdef X
+#include "h4821.h"
+#endif
+struct S8657 { int a; const char *s = "x//y"; };
+inline int f8657_0(int x) { return x * 0; }
+inline int f8657_1(int x) { return x * 1; }
+inline int f8657_2(int x) { return x * 2; }
+inline int f8657_3(int x) { return x * 3; }
+inline int f8657_4(int x) { return x * 4; }
+inline int f8657_5(int x) { return x * 5; }
+inline int f8657_6(int x) { return x * 6; }
+inline int f8657_7(int x) { return x * 7; }
+inline int f8657_8(int x) { return x * 8; }
+inline int f8657_9(int x) { return x * 9; }
+inline int f8657_10(int x) { return x * 10; }
+inline int f8657_11(int x) { return x * 11; }
+inline int f8657_12(int x) { return x * 12; }
+inline int f8657_13(int x) { return x * 13; }
+inline int f8657_14(int x) { return x * 14; }
+inline int f8657_15(int x) { return x * 15; }
+inline int f8657_16(int x) { return x * 16; }
+inline int f8657_17(int x) { return x * 17; }
+inline int f8657_18(int x) { return x * 18; }
+inline int f8657_19(int x) { return x * 19; }
+inline int f8657_20(int x) { return x * 20; }
+inline int f8657_21(int x) { return x * 21; }
+inline int f8657_22(int x) { return x * 22; }
+inline int f8657_23(int x) { return x * 23; }
+inline int f8657_24(int x) { return x * 24; }
+inline int f8657_25(int x) { return x * 25; }
+inline int f8657_26(int x) { return x * 26; }
+inline int f8657_27(int x) { return x * 27; }
+inline int f8657_28(int x) { return x * 28; }
+inline int f8657_29(int x) { return x * 29; }
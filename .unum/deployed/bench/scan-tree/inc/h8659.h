@@ -0,0 +1,42 @@
+#pragma once
+/* header 8659 */
+#include <vector>
+#include "h5491.h"
+#include "h161.h"
+#include "h512.h"
+#include "h6485.h"
+#include "h2700.h"
+#ifdef X
+#include "h2502.h"
+#endif
+struct S8659 { int a; const char *s = "x//y"; };
+inline int f8659_0(int x) { return x * 0; }
+inline int f8659_1(int x) { return x * 1; }
+inline int f8659_2(int x) { return x * 2; }
+inline int f8659_3(int x) { return x * 3; }
+inline int f8659_4(int x) { return x * 4; }
+inline int f8659_5(int x) { return x * 5; }
+inline int f8659_6(int x) { return x * 6; }
+inline int f8659_7(int x) { return x * 7; }
+inline int f8659_8(int x) { return x * 8; }
+inline int f8659_9(int x) { return x * 9; }
+inline int f8659_10(int x) { return x * 10; }
+inline int f8659_11(int x) { return x * 11; }
+inline int f8659_12(int x) { return x * 12; }
+inline int f8659_13(int x) { return x * 13; }
+inline int f8659_14(int x) { return x * 14; }
+inline int f8659_15(int x) { return x * 15; }
+inline int f8659_16(int x) { return x * 16; }
+inline int f8659_17(int x) { return x * 17; }
+inline int f8659_18(int x) { return x * 18; }
+inline int f8659_19(int x) { return x * 19; }
+inline int f8659_20(int x) { return x * 20; }
+inline int f8659_21(int x) { return x * 21; }
+inline int f8659_22(int x) { return x * 22; }
+inline int f8659_23(int x) { return x * 23; }
+inline int f8659_24(int x) { return x * 24; }
+inline int f8659_25(int x) { return x * 25; }
+inline int f8659_26(int x) { return x * 26; }
+inline int f8659_27(int x) { return x * 27; }
+inline int f8659_28(int x) { return x * 28; }
+inline int f8659_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8660 */
+#include <vector>
+#include "h2467.h"
+#include "h9283.h"
+#include "h1886.h"
+#include "h9658.h"
+#include "h4051.h"
+#ifdef X
+#include "h2799.h"
+#endif
+struct S8660 { int a; const char *s = "x//y"; };
+inline int f8660_0(int x) { return x * 0; }
+inline int f8660_1(int x) { return x * 1; }
+inline int f8660_2(int x) { return x * 2; }
+inline int f8660_3(int x) { return x * 3; }
+inline int f8660_4(int x) { return x * 4; }
+inline int f8660_5(int x) { return x * 5; }
+inline int f8660_6(int x) { return x * 6; }
+inline int f8660_7(int x) { return x * 7; }
+inline int f8660_8(int x) { return x * 8; }
+inline int f8660_9(int x) { return x * 9; }
+inline int f8660_10(int x) { return x * 10; }
+inline int f8660_11(int x) { return x * 11; }
+inline int f8660_12(int x) { return x * 12; }
+inline int f8660_13(int x) { return x * 13; }
+inline int f8660_14(int x) { return x * 14; }
+inline int f8660_15(int x) { return x * 15; }
+inline int f8660_16(int x) { return x * 16; }
+inline int f8660_17(int x) { return x * 17; }
+inline int f8660_18(int x) { return x * 18; }
+inline int f8660_19(int x) { return x * 19; }
+inline int f8660_20(int x) { return x * 20; }
+inline int f8660_21(int x) { return x * 21; }
+inline int f8660_22(int x) { return x * 22; }
+inline int f8660_23(int x) { return x * 23; }
+inline int f8660_24(int x) { return x * 24; }
+inline int f8660_25(int x) { return x * 25; }
+inline int f8660_26(int x) { return x * 26; }
+inline int f8660_27(int x) { return x * 27; }
+inline int f8660_28(int x) { return x * 28; }
+inline int f8660_29(int x) { return x * 29; }
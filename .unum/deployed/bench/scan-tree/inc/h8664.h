@@ -0,0 +1,42 @@
+#pragma once
+/* header 8664 */
+#include <vector>
+#include "h4484.h"
+#include "h1933.h"
+#include "h2479.h"
+#include "h8481.h"
+#include "h5321.h"
+#ifdef X
+#include "h6319.h"
+#endif
+struct S8664 { int a; const char *s = "x//y"; };
+inline int f8664_0(int x) { return x * 0; }
+inline int f8664_1(int x) { return x * 1; }
+inline int f8664_2(int x) { return x * 2; }
+inline int f8664_3(int x) { return x * 3; }
+inline int f8664_4(int x) { return x * 4; }
+inline int f8664_5(int x) { return x * 5; }
+inline int f8664_6(int x) { return x * 6; }
+inline int f8664_7(int x) { return x * 7; }
+inline int f8664_8(int x) { return x * 8; }
+inline int f8664_9(int x) { return x * 9; }
+inline int f8664_10(int x) { return x * 10; }
+inline int f8664_11(int x) { return x * 11; }
+inline int f8664_12(int x) { return x * 12; }
+inline int f8664_13(int x) { return x * 13; }
+inline int f8664_14(int x) { return x * 14; }
+inline int f8664_15(int x) { return x * 15; }
+inline int f8664_16(int x) { return x * 16; }
+inline int f8664_17(int x) { return x * 17; }
+inline int f8664_18(int x) { return x * 18; }
+inline int f8664_19(int x) { return x * 19; }
+inline int f8664_20(int x) { return x * 20; }
+inline int f8664_21(int x) { return x * 21; }
+inline int f8664_22(int x) { return x * 22; }
+inline int f8664_23(int x) { return x * 23; }
+inline int f8664_24(int x) { return x * 24; }
+inline int f8664_25(int x) { return x * 25; }
+inline int f8664_26(int x) { return x * 26; }
+inline int f8664_27(int x) { return x * 27; }
+inline int f8664_28(int x) { return x * 28; }
+inline int f8664_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8665 */
+#include <vector>
+#include "h5363.h"
+#include "h4126.h"
+#include "h2260.h"
+#include "h8539.h"
+#include "h9188.h"
+#ifdef X
+#include "h1280.h"
+#endif
+struct S8665 { int a; const char *s = "x//y"; };
+inline int f8665_0(int x) { return x * 0; }
+inline int f8665_1(int x) { return x * 1; }
+inline int f8665_2(int x) { return x * 2; }
+inline int f8665_3(int x) { return x * 3; }
+inline int f8665_4(int x) { return x * 4; }
+inline int f8665_5(int x) { return x * 5; }
+inline int f8665_6(int x) { return x * 6; }
+inline int f8665_7(int x) { return x * 7; }
+inline int f8665_8(int x) { return x * 8; }
+inline int f8665_9(int x) { return x * 9; }
+inline int f8665_10(int x) { return x * 10; }
+inline int f8665_11(int x) { return x * 11; }
+inline int f8665_12(int x) { return x * 12; }
+inline int f8665_13(int x) { return x * 13; }
+inline int f8665_14(int x) { return x * 14; }
+inline int f8665_15(int x) { return x * 15; }
+inline int f8665_16(int x) { return x * 16; }
+inline int f8665_17(int x) { return x * 17; }
+inline int f8665_18(int x) { return x * 18; }
+inline int f8665_19(int x) { return x * 19; }
+inline int f8665_20(int x) { return x * 20; }
+inline int f8665_21(int x) { return x * 21; }
+inline int f8665_22(int x) { return x * 22; }
+inline int f8665_23(int x) { return x * 23; }
+inline int f8665_24(int x) { return x * 24; }
+inline int f8665_25(int x) { return x * 25; }
+inline int f8665_26(int x) { return x * 26; }
+inline int f8665_27(int x) { return x * 27; }
+inline int f8665_28(int x) { return x * 28; }
+inline int f8665_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8666 */
+#include <vector>
+#include "h6694.h"
+#include "h3418.h"
+#include "h1228.h"
+#include "h1322.h"
+#include "h5711.h"
+#ifdef X
+#include "h7965.h"
+#endif
+struct S8666 { int a; const char *s = "x//y"; };
+inline int f8666_0(int x) { return x * 0; }
+inline int f8666_1(int x) { return x * 1; }
+inline int f8666_2(int x) { return x * 2; }
+inline int f8666_3(int x) { return x * 3; }
+inline int f8666_4(int x) { return x * 4; }
+inline int f8666_5(int x) { return x * 5; }
+inline int f8666_6(int x) { return x * 6; }
+inline int f8666_7(int x) { return x * 7; }
+inline int f8666_8(int x) { return x * 8; }
+inline int f8666_9(int x) { return x * 9; }
+inline int f8666_10(int x) { return x * 10; }
+inline int f8666_11(int x) { return x * 11; }
+inline int f8666_12(int x) { return x * 12; }
+inline int f8666_13(int x) { return x * 13; }
+inline int f8666_14(int x) { return x * 14; }
+inline int f8666_15(int x) { return x * 15; }
+inline int f8666_16(int x) { return x * 16; }
+inline int f8666_17(int x) { return x * 17; }
+inline int f8666_18(int x) { return x * 18; }
+inline int f8666_19(int x) { return x * 19; }
+inline int f8666_20(int x) { return x * 20; }
+inline int f8666_21(int x) { return x * 21; }
+inline int f8666_22(int x) { return x * 22; }
+inline int f8666_23(int x) { return x * 23; }
+inline int f8666_24(int x) { return x * 24; }
+inline int f8666_25(int x) { return x * 25; }
+inline int f8666_26(int x) { return x * 26; }
+inline int f8666_27(int x) { return x * 27; }
+inline int f8666_28(int x) { return x * 28; }
+inline int f8666_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 867 */
+#include <vector>
+#include "h706.h"
+#include "h579.h"
+#include "h2295.h"
+#include "h2702.h"
+#include "h1820.h"
+#ifdef X
+#include "h2009.h"
+#endif
+struct S867 { int a; const char *s = "x//y"; };
+inline int f867_0(int x) { return x * 0; }
+inline int f867_1(int x) { return x * 1; }
+inline int f867_2(int x) { return x * 2; }
+inline int f867_3(int x) { return x * 3; }
+inline int f867_4(int x) { return x * 4; }
+inline int f867_5(int x) { return x * 5; }
+inline int f867_6(int x) { return x * 6; }
+inline int f867_7(int x) { return x * 7; }
+inline int f867_8(int x) { return x * 8; }
+inline int f867_9(int x) { return x * 9; }
+inline int f867_10(int x) { return x * 10; }
+inline int f867_11(int x) { return x * 11; }
+inline int f867_12(int x) { return x * 12; }
+inline int f867_13(int x) { return x * 13; }
+inline int f867_14(int x) { return x * 14; }
+inline int f867_15(int x) { return x * 15; }
+inline int f867_16(int x) { return x * 16; }
+inline int f867_17(int x) { return x * 17; }
+inline int f867_18(int x) { return x * 18; }
+inline int f867_19(int x) { return x * 19; }
+inline int f867_20(int x) { return x * 20; }
+inline int f867_21(int x) { return x * 21; }
+inline int f867_22(int x) { return x * 22; }
+inline int f867_23(int x) { return x * 23; }
+inline int f867_24(int x) { return x * 24; }
+inline int f867_25(int x) { return x * 25; }
+inline int f867_26(int x) { return x * 26; }
+inline int f867_27(int x) { return x * 27; }
+inline int f867_28(int x) { return x * 28; }
+inline int f867_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8671 */
+#include <vector>
+#include "h4407.h"
+#include "h3655.h"
+#include "h625.h"
+#include "h3593.h"
+#include "h2592.h"
+#ifdef X
+#include "h6121.h"
+#endif
+struct S8671 { int a; const char *s = "x//y"; };
+inline int f8671_0(int x) { return x * 0; }
+inline int f8671_1(int x) { return x * 1; }
+inline int f8671_2(int x) { return x * 2; }
+inline int f8671_3(int x) { return x * 3; }
+inline int f8671_4(int x) { return x * 4; }
+inline int f8671_5(int x) { return x * 5; }
+inline int f8671_6(int x) { return x * 6; }
+inline int f8671_7(int x) { return x * 7; }
+inline int f8671_8(int x) { return x * 8; }
+inline int f8671_9(int x) { return x * 9; }
+inline int f8671_10(int x) { return x * 10; }
+inline int f8671_11(int x) { return x * 11; }
+inline int f8671_12(int x) { return x * 12; }
+inline int f8671_13(int x) { return x * 13; }
+inline int f8671_14(int x) { return x * 14; }
+inline int f8671_15(int x) { return x * 15; }
+inline int f8671_16(int x) { return x * 16; }
+inline int f8671_17(int x) { return x * 17; }
+inline int f8671_18(int x) { return x * 18; }
+inline int f8671_19(int x) { return x * 19; }
+inline int f8671_20(int x) { return x * 20; }
+inline int f8671_21(int x) { return x * 21; }
+inline int f8671_22(int x) { return x * 22; }
+inline int f8671_23(int x) { return x * 23; }
+inline int f8671_24(int x) { return x * 24; }
+inline int f8671_25(int x) { return x * 25; }
+inline int f8671_26(int x) { return x * 26; }
+inline int f8671_27(int x) { return x * 27; }
+inline int f8671_28(int x) { return x * 28; }
+inline int f8671_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8674 */
+#include <vector>
+#include "h55.h"
+#include "h3579.h"
+#include "h6309.h"
+#include "h7131.h"
+#include "h8857.h"
+#ifdef X
+#include "h3348.h"
+#endif
+struct S8674 { int a; const char *s = "x//y"; };
+inline int f8674_0(int x) { return x * 0; }
+inline int f8674_1(int x) { return x * 1; }
+inline int f8674_2(int x) { return x * 2; }
+inline int f8674_3(int x) { return x * 3; }
+inline int f8674_4(int x) { return x * 4; }
+inline int f8674_5(int x) { return x * 5; }
+inline int f8674_6(int x) { return x * 6; }
+inline int f8674_7(int x) { return x * 7; }
+inline int f8674_8(int x) { return x * 8; }
+inline int f8674_9(int x) { return x * 9; }
+inline int f8674_10(int x) { return x * 10; }
+inline int f8674_11(int x) { return x * 11; }
+inline int f8674_12(int x) { return x * 12; }
+inline int f8674_13(int x) { return x * 13; }
+inline int f8674_14(int x) { return x * 14; }
+inline int f8674_15(int x) { return x * 15; }
+inline int f8674_16(int x) { return x * 16; }
+inline int f8674_17(int x) { return x * 17; }
+inline int f8674_18(int x) { return x * 18; }
+inline int f8674_19(int x) { return x * 19; }
+inline int f8674_20(int x) { return x * 20; }
+inline int f8674_21(int x) { return x * 21; }
+inline int f8674_22(int x) { return x * 22; }
+inline int f8674_23(int x) { return x * 23; }
+inline int f8674_24(int x) { return x * 24; }
+inline int f8674_25(int x) { return x * 25; }
+inline int f8674_26(int x) { return x * 26; }
+inline int f8674_27(int x) { return x * 27; }
+inline int f8674_28(int x) { return x * 28; }
+inline int f8674_29(int x) { return x * 29; }
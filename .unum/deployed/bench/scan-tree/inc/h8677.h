@@ -0,0 +1,42 @@
+#pragma once
+/* header 8677 */
+#include <vector>
+#include "h7669.h"
+#include "h1080.h"
+#include "h4268.h"
+#include "h9190.h"
+#include "h6906.h"
+#ifdef X
+#include "h1561.h"
+#endif
+struct S8677 { int a; const char *s = "x//y"; };
+inline int f8677_0(int x) { return x * 0; }
+inline int f8677_1(int x) { return x * 1; }
+inline int f8677_2(int x) { return x * 2; }
+inline int f8677_3(int x) { return x * 3; }
+inline int f8677_4(int x) { return x * 4; }
+inline int f8677_5(int x) { return x * 5; }
+inline int f8677_6(int x) { return x * 6; }
+inline int f8677_7(int x) { return x * 7; }
+inline int f8677_8(int x) { return x * 8; }
+inline int f8677_9(int x) { return x * 9; }
+inline int f8677_10(int x) { return x * 10; }
+inline int f8677_11(int x) { return x * 11; }
+inline int f8677_12(int x) { return x * 12; }
+inline int f8677_13(int x) { return x * 13; }
+inline int f8677_14(int x) { return x * 14; }
+inline int f8677_15(int x) { return x * 15; }
+inline int f8677_16(int x) { return x * 16; }
+inline int f8677_17(int x) { return x * 17; }
+inline int f8677_18(int x) { return x * 18; }
+inline int f8677_19(int x) { return x * 19; }
+inline int f8677_20(int x) { return x * 20; }
+inline int f8677_21(int x) { return x * 21; }
+inline int f8677_22(int x) { return x * 22; }
+inline int f8677_23(int x) { return x * 23; }
+inline int f8677_24(int x) { return x * 24; }
+inline int f8677_25(int x) { return x * 25; }
+inline int f8677_26(int x) { return x * 26; }
+inline int f8677_27(int x) { return x * 27; }
+inline int f8677_28(int x) { return x * 28; }
+inline int f8677_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8678 */
+#include <vector>
+#include "h5725.h"
+#include "h286.h"
+#include "h9281.h"
+#include "h3699.h"
+#include "h4393.h"
+#ifdef X
+#include "h4512.h"
+#endif
+struct S8678 { int a; const char *s = "x//y"; };
+inline int f8678_0(int x) { return x * 0; }
+inline int f8678_1(int x) { return x * 1; }
+inline int f8678_2(int x) { return x * 2; }
+inline int f8678_3(int x) { return x * 3; }
+inline int f8678_4(int x) { return x * 4; }
+inline int f8678_5(int x) { return x * 5; }
+inline int f8678_6(int x) { return x * 6; }
+inline int f8678_7(int x) { return x * 7; }
+inline int f8678_8(int x) { return x * 8; }
+inline int f8678_9(int x) { return x * 9; }
+inline int f8678_10(int x) { return x * 10; }
+inline int f8678_11(int x) { return x * 11; }
+inline int f8678_12(int x) { return x * 12; }
+inline int f8678_13(int x) { return x * 13; }
+inline int f8678_14(int x) { return x * 14; }
+inline int f8678_15(int x) { return x * 15; }
+inline int f8678_16(int x) { return x * 16; }
+inline int f8678_17(int x) { return x * 17; }
+inline int f8678_18(int x) { return x * 18; }
+inline int f8678_19(int x) { return x * 19; }
+inline int f8678_20(int x) { return x * 20; }
+inline int f8678_21(int x) { return x * 21; }
+inline int f8678_22(int x) { return x * 22; }
+inline int f8678_23(int x) { return x * 23; }
+inline int f8678_24(int x) { return x * 24; }
+inline int f8678_25(int x) { return x * 25; }
+inline int f8678_26(int x) { return x * 26; }
+inline int f8678_27(int x) { return x * 27; }
+inline int f8678_28(int x) { return x * 28; }
+inline int f8678_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 868 */
+#include <vector>
+#include "h5245.h"
+#include "h5819.h"
+#include "h7375.h"
+#include "h6145.h"
+#include "h2724.h"
+#ifdef X
+#include "h6277.h"
+#endif
+struct S868 { int a; const char *s = "x//y"; };
+inline int f868_0(int x) { return x * 0; }
+inline int f868_1(int x) { return x * 1; }
+inline int f868_2(int x) { return x * 2; }
+inline int f868_3(int x) { return x * 3; }
+inline int f868_4(int x) { return x * 4; }
+inline int f868_5(int x) { return x * 5; }
+inline int f868_6(int x) { return x * 6; }
+inline int f868_7(int x) { return x * 7; }
+inline int f868_8(int x) { return x * 8; }
+inline int f868_9(int x) { return x * 9; }
+inline int f868_10(int x) { return x * 10; }
+inline int f868_11(int x) { return x * 11; }
+inline int f868_12(int x) { return x * 12; }
+inline int f868_13(int x) { return x * 13; }
+inline int f868_14(int x) { return x * 14; }
+inline int f868_15(int x) { return x * 15; }
+inline int f868_16(int x) { return x * 16; }
+inline int f868_17(int x) { return x * 17; }
+inline int f868_18(int x) { return x * 18; }
+inline int f868_19(int x) { return x * 19; }
+inline int f868_20(int x) { return x * 20; }
+inline int f868_21(int x) { return x * 21; }
+inline int f868_22(int x) { return x * 22; }
+inline int f868_23(int x) { return x * 23; }
+inline int f868_24(int x) { return x * 24; }
+inline int f868_25(int x) { return x * 25; }
+inline int f868_26(int x) { return x * 26; }
+inline int f868_27(int x) { return x * 27; }
+inline int f868_28(int x) { return x * 28; }
+inline int f868_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8681 */
+#include <vector>
+#include "h5707.h"
+#include "h7726.h"
+#include "h3320.h"
+#include "h6879.h"
+#include "h212.h"
+#ifdef X
+#include "h4237.h"
+#endif
+struct S8681 { int a; const char *s = "x//y"; };
+inline int f8681_0(int x) { return x * 0; }
+inline int f8681_1(int x) { return x * 1; }
+inline int f8681_2(int x) { return x * 2; }
+inline int f8681_3(int x) { return x * 3; }
+inline int f8681_4(int x) { return x * 4; }
+inline int f8681_5(int x) { return x * 5; }
+inline int f8681_6(int x) { return x * 6; }
+inline int f8681_7(int x) { return x * 7; }
+inline int f8681_8(int x) { return x * 8; }
+inline int f8681_9(int x) { return x * 9; }
+inline int f8681_10(int x) { return x * 10; }
+inline int f8681_11(int x) { return x * 11; }
+inline int f8681_12(int x) { return x * 12; }
+inline int f8681_13(int x) { return x * 13; }
+inline int f8681_14(int x) { return x * 14; }
+inline int f8681_15(int x) { return x * 15; }
+inline int f8681_16(int x) { return x * 16; }
+inline int f8681_17(int x) { return x * 17; }
+inline int f8681_18(int x) { return x * 18; }
+inline int f8681_19(int x) { return x * 19; }
+inline int f8681_20(int x) { return x * 20; }
+inline int f8681_21(int x) { return x * 21; }
+inline int f8681_22(int x) { return x * 22; }
+inline int f8681_23(int x) { return x * 23; }
+inline int f8681_24(int x) { return x * 24; }
+inline int f8681_25(int x) { return x * 25; }
+inline int f8681_26(int x) { return x * 26; }
+inline int f8681_27(int x) { return x * 27; }
+inline int f8681_28(int x) { return x * 28; }
+inline int f8681_29(int x) { return x * 29; }
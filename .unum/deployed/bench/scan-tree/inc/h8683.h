@@ -0,0 +1,42 @@
+#pragma once
+/* header 8683 */
+#include <vector>
+#include "h7627.h"
+#include "h9460.h"
+#include "h6275.h"
+#include "h7089.h"
+#include "h476.h"
+#ifdef X
+#include "h4193.h"
+#endif
+struct S8683 { int a; const char *s = "x//y"; };
+inline int f8683_0(int x) { return x * 0; }
+inline int f8683_1(int x) { return x * 1; }
+inline int f8683_2(int x) { return x * 2; }
+inline int f8683_3(int x) { return x * 3; }
+inline int f8683_4(int x) { return x * 4; }
+inline int f8683_5(int x) { return x * 5; }
+inline int f8683_6(int x) { return x * 6; }
+inline int f8683_7(int x) { return x * 7; }
+inline int f8683_8(int x) { return x * 8; }
+inline int f8683_9(int x) { return x * 9; }
+inline int f8683_10(int x) { return x * 10; }
+inline int f8683_11(int x) { return x * 11; }
+inline int f8683_12(int x) { return x * 12; }
+inline int f8683_13(int x) { return x * 13; }
+inline int f8683_14(int x) { return x * 14; }
+inline int f8683_15(int x) { return x * 15; }
+inline int f8683_16(int x) { return x * 16; }
+inline int f8683_17(int x) { return x * 17; }
+inline int f8683_18(int x) { return x * 18; }
+inline int f8683_19(int x) { return x * 19; }
+inline int f8683_20(int x) { return x * 20; }
+inline int f8683_21(int x) { return x * 21; }
+inline int f8683_22(int x) { return x * 22; }
+inline int f8683_23(int x) { return x * 23; }
+inline int f8683_24(int x) { return x * 24; }
+inline int f8683_25(int x) { return x * 25; }
+inline int f8683_26(int x) { return x * 26; }
+inline int f8683_27(int x) { return x * 27; }
+inline int f8683_28(int x) { return x * 28; }
+inline int f8683_29(int x) { return x * 29; }
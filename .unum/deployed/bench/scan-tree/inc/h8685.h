@@ -0,0 +1,42 @@
+#pragma once
+/* header 8685 */
+#include <vector>
+#include "h7041.h"
+#include "h3547.h"
+#include "h9240.h"
+#include "h6607.h"
+#include "h5580.h"
+#ifdef X
+#include "h6977.h"
+#endif
+struct S8685 { int a; const char *s = "x//y"; };
+inline int f8685_0(int x) { return x * 0; }
+inline int f8685_1(int x) { return x * 1; }
+inline int f8685_2(int x) { return x * 2; }
+inline int f8685_3(int x) { return x * 3; }
+inline int f8685_4(int x) { return x * 4; }
+inline int f8685_5(int x) { return x * 5; }
+inline int f8685_6(int x) { return x * 6; }
+inline int f8685_7(int x) { return x * 7; }
+inline int f8685_8(int x) { return x * 8; }
+inline int f8685_9(int x) { return x * 9; }
+inline int f8685_10(int x) { return x * 10; }
+inline int f8685_11(int x) { return x * 11; }
+inline int f8685_12(int x) { return x * 12; }
+inline int f8685_13(int x) { return x * 13; }
+inline int f8685_14(int x) { return x * 14; }
+inline int f8685_15(int x) { return x * 15; }
+inline int f8685_16(int x) { return x * 16; }
+inline int f8685_17(int x) { return x * 17; }
+inline int f8685_18(int x) { return x * 18; }
+inline int f8685_19(int x) { return x * 19; }
+inline int f8685_20(int x) { return x * 20; }
+inline int f8685_21(int x) { return x * 21; }
+inline int f8685_22(int x) { return x * 22; }
+inline int f8685_23(int x) { return x * 23; }
+inline int f8685_24(int x) { return x * 24; }
+inline int f8685_25(int x) { return x * 25; }
+inline int f8685_26(int x) { return x * 26; }
+inline int f8685_27(int x) { return x * 27; }
+inline int f8685_28(int x) { return x * 28; }
+inline int f8685_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8688 */
+#include <vector>
+#include "h1864.h"
+#include "h5715.h"
+#include "h927.h"
+#include "h1628.h"
+#include "h6925.h"
+#ifdef X
+#include "h4569.h"
+#endif
+struct S8688 { int a; const char *s = "x//y"; };
+inline int f8688_0(int x) { return x * 0; }
+inline int f8688_1(int x) { return x * 1; }
+inline int f8688_2(int x) { return x * 2; }
+inline int f8688_3(int x) { return x * 3; }
+inline int f8688_4(int x) { return x * 4; }
+inline int f8688_5(int x) { return x * 5; }
+inline int f8688_6(int x) { return x * 6; }
+inline int f8688_7(int x) { return x * 7; }
+inline int f8688_8(int x) { return x * 8; }
+inline int f8688_9(int x) { return x * 9; }
+inline int f8688_10(int x) { return x * 10; }
+inline int f8688_11(int x) { return x * 11; }
+inline int f8688_12(int x) { return x * 12; }
+inline int f8688_13(int x) { return x * 13; }
+inline int f8688_14(int x) { return x * 14; }
+inline int f8688_15(int x) { return x * 15; }
+inline int f8688_16(int x) { return x * 16; }
+inline int f8688_17(int x) { return x * 17; }
+inline int f8688_18(int x) { return x * 18; }
+inline int f8688_19(int x) { return x * 19; }
+inline int f8688_20(int x) { return x * 20; }
+inline int f8688_21(int x) { return x * 21; }
+inline int f8688_22(int x) { return x * 22; }
+inline int f8688_23(int x) { return x * 23; }
+inline int f8688_24(int x) { return x * 24; }
+inline int f8688_25(int x) { return x * 25; }
+inline int f8688_26(int x) { return x * 26; }
+inline int f8688_27(int x) { return x * 27; }
+inline int f8688_28(int x) { return x * 28; }
+inline int f8688_29(int x) { return x * 29; }
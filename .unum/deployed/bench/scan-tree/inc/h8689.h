@@ -0,0 +1,42 @@
+#pragma once
+/* header 8689 */
+#include <vector>
+#include "h2437.h"
+#include "h5723.h"
+#include "h8386.h"
+#include "h1513.h"
+#include "h8084.h"
+#ifdef X
+#include "h926.h"
+#endif
+struct S8689 { int a; const char *s = "x//y"; };
+inline int f8689_0(int x) { return x * 0; }
+inline int f8689_1(int x) { return x * 1; }
+inline int f8689_2(int x) { return x * 2; }
+inline int f8689_3(int x) { return x * 3; }
+inline int f8689_4(int x) { return x * 4; }
+inline int f8689_5(int x) { return x * 5; }
+inline int f8689_6(int x) { return x * 6; }
+inline int f8689_7(int x) { return x * 7; }
+inline int f8689_8(int x) { return x * 8; }
+inline int f8689_9(int x) { return x * 9; }
+inline int f8689_10(int x) { return x * 10; }
+inline int f8689_11(int x) { return x * 11; }
+inline int f8689_12(int x) { return x * 12; }
+inline int f8689_13(int x) { return x * 13; }
+inline int f8689_14(int x) { return x * 14; }
+inline int f8689_15(int x) { return x * 15; }
+inline int f8689_16(int x) { return x * 16; }
+inline int f8689_17(int x) { return x * 17; }
+inline int f8689_18(int x) { return x * 18; }
+inline int f8689_19(int x) { return x * 19; }
+inline int f8689_20(int x) { return x * 20; }
+inline int f8689_21(int x) { return x * 21; }
+inline int f8689_22(int x) { return x * 22; }
+inline int f8689_23(int x) { return x * 23; }
+inline int f8689_24(int x) { return x * 24; }
+inline int f8689_25(int x) { return x * 25; }
+inline int f8689_26(int x) { return x * 26; }
+inline int f8689_27(int x) { return x * 27; }
+inline int f8689_28(int x) { return x * 28; }
+inline int f8689_29(int x) { return x * 29; }
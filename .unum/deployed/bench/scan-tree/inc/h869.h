@@ -0,0 +1,42 @@
+#pragma once
+/* header 869 */
+#include <vector>
+#include "h7996.h"
+#include "h194.h"
+#include "h789.h"
+#include "h2051.h"
+#include "h9192.h"
+#ifdef X
+#include "h2145.h"
+#endif
+struct S869 { int a; const char *s = "x//y"; };
+inline int f869_0(int x) { return x * 0; }
+inline int f869_1(int x) { return x * 1; }
+inline int f869_2(int x) { return x * 2; }
+inline int f869_3(int x) { return x * 3; }
+inline int f869_4(int x) { return x * 4; }
+inline int f869_5(int x) { return x * 5; }
+inline int f869_6(int x) { return x * 6; }
+inline int f869_7(int x) { return x * 7; }
+inline int f869_8(int x) { return x * 8; }
+inline int f869_9(int x) { return x * 9; }
+inline int f869_10(int x) { return x * 10; }
+inline int f869_11(int x) { return x * 11; }
+inline int f869_12(int x) { return x * 12; }
+inline int f869_13(int x) { return x * 13; }
+inline int f869_14(int x) { return x * 14; }
+inline int f869_15(int x) { return x * 15; }
+inline int f869_16(int x) { return x * 16; }
+inline int f869_17(int x) { return x * 17; }
+inline int f869_18(int x) { return x * 18; }
+inline int f869_19(int x) { return x * 19; }
+inline int f869_20(int x) { return x * 20; }
+inline int f869_21(int x) { return x * 21; }
+inline int f869_22(int x) { return x * 22; }
+inline int f869_23(int x) { return x * 23; }
+inline int f869_24(int x) { return x * 24; }
+inline int f869_25(int x) { return x * 25; }
+inline int f869_26(int x) { return x * 26; }
+inline int f869_27(int x) { return x * 27; }
+inline int f869_28(int x) { return x * 28; }
+inline int f869_29(int x) { return x * 29; }
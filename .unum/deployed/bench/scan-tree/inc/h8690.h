@@ -0,0 +1,42 @@
+#pragma once
+/* header 8690 */
+#include <vector>
+#include "h4843.h"
+#include "h4177.h"
+#include "h7592.h"
+#include "h2128.h"
+#include "h1699.h"
+#ifdef X
+#include "h5476.h"
+#endif
+struct S8690 { int a; const char *s = "x//y"; };
+inline int f8690_0(int x) { return x * 0; }
+inline int f8690_1(int x) { return x * 1; }
+inline int f8690_2(int x) { return x * 2; }
+inline int f8690_3(int x) { return x * 3; }
+inline int f8690_4(int x) { return x * 4; }
+inline int f8690_5(int x) { return x * 5; }
+inline int f8690_6(int x) { return x * 6; }
+inline int f8690_7(int x) { return x * 7; }
+inline int f8690_8(int x) { return x * 8; }
+inline int f8690_9(int x) { return x * 9; }
+inline int f8690_10(int x) { return x * 10; }
+inline int f8690_11(int x) { return x * 11; }
+inline int f8690_12(int x) { return x * 12; }
+inline int f8690_13(int x) { return x * 13; }
+inline int f8690_14(int x) { return x * 14; }
+inline int f8690_15(int x) { return x * 15; }
+inline int f8690_16(int x) { return x * 16; }
+inline int f8690_17(int x) { return x * 17; }
+inline int f8690_18(int x) { return x * 18; }
+inline int f8690_19(int x) { return x * 19; }
+inline int f8690_20(int x) { return x * 20; }
+inline int f8690_21(int x) { return x * 21; }
+inline int f8690_22(int x) { return x * 22; }
+inline int f8690_23(int x) { return x * 23; }
+inline int f8690_24(int x) { return x * 24; }
+inline int f8690_25(int x) { return x * 25; }
+inline int f8690_26(int x) { return x * 26; }
+inline int f8690_27(int x) { return x * 27; }
+inline int f8690_28(int x) { return x * 28; }
+inline int f8690_29(int x) { return x * 29; }
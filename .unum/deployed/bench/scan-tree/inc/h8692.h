@@ -0,0 +1,42 @@
+#pragma once
+/* header 8692 */
+#include <vector>
+#include "h8700.h"
+#include "h7738.h"
+#include "h5176.h"
+#include "h9750.h"
+#include "h1718.h"
+#ifdef X
+#include "h7252.h"
+#endif
+struct S8692 { int a; const char *s = "x//y"; };
+inline int f8692_0(int x) { return x * 0; }
+inline int f8692_1(int x) { return x * 1; }
+inline int f8692_2(int x) { return x * 2; }
+inline int f8692_3(int x) { return x * 3; }
+inline int f8692_4(int x) { return x * 4; }
+inline int f8692_5(int x) { return x * 5; }
+inline int f8692_6(int x) { return x * 6; }
+inline int f8692_7(int x) { return x * 7; }
+inline int f8692_8(int x) { return x * 8; }
+inline int f8692_9(int x) { return x * 9; }
+inline int f8692_10(int x) { return x * 10; }
+inline int f8692_11(int x) { return x * 11; }
+inline int f8692_12(int x) { return x * 12; }
+inline int f8692_13(int x) { return x * 13; }
+inline int f8692_14(int x) { return x * 14; }
+inline int f8692_15(int x) { return x * 15; }
+inline int f8692_16(int x) { return x * 16; }
+inline int f8692_17(int x) { return x * 17; }
+inline int f8692_18(int x) { return x * 18; }
+inline int f8692_19(int x) { return x * 19; }
+inline int f8692_20(int x) { return x * 20; }
+inline int f8692_21(int x) { return x * 21; }
+inline int f8692_22(int x) { return x * 22; }
+inline int f8692_23(int x) { return x * 23; }
+inline int f8692_24(int x) { return x * 24; }
+inline int f8692_25(int x) { return x * 25; }
+inline int f8692_26(int x) { return x * 26; }
+inline int f8692_27(int x) { return x * 27; }
+inline int f8692_28(int x) { return x * 28; }
+inline int f8692_29(int x) { return x * 29; }
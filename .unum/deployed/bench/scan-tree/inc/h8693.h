@@ -0,0 +1,42 @@
+#pragma once
+/* header 8693 */
+#include <vector>
+#include "h6835.h"
+#include "h6409.h"
+#include "h6990.h"
+#include "h659.h"
+#include "h3878.h"
+#ifdef X
+#include "h2820.h"
+#endif
+struct S8693 { int a; const char *s = "x//y"; };
+inline int f8693_0(int x) { return x * 0; }
+inline int f8693_1(int x) { return x * 1; }
+inline int f8693_2(int x) { return x * 2; }
+inline int f8693_3(int x) { return x * 3; }
+inline int f8693_4(int x) { return x * 4; }
+inline int f8693_5(int x) { return x * 5; }
+inline int f8693_6(int x) { return x * 6; }
+inline int f8693_7(int x) { return x * 7; }
+inline int f8693_8(int x) { return x * 8; }
+inline int f8693_9(int x) { return x * 9; }
+inline int f8693_10(int x) { return x * 10; }
+inline int f8693_11(int x) { return x * 11; }
+inline int f8693_12(int x) { return x * 12; }
+inline int f8693_13(int x) { return x * 13; }
+inline int f8693_14(int x) { return x * 14; }
+inline int f8693_15(int x) { return x * 15; }
+inline int f8693_16(int x) { return x * 16; }
+inline int f8693_17(int x) { return x * 17; }
+inline int f8693_18(int x) { return x * 18; }
+inline int f8693_19(int x) { return x * 19; }
+inline int f8693_20(int x) { return x * 20; }
+inline int f8693_21(int x) { return x * 21; }
+inline int f8693_22(int x) { return x * 22; }
+inline int f8693_23(int x) { return x * 23; }
+inline int f8693_24(int x) { return x * 24; }
+inline int f8693_25(int x) { return x * 25; }
+inline int f8693_26(int x) { return x * 26; }
+inline int f8693_27(int x) { return x * 27; }
+inline int f8693_28(int x) { return x * 28; }
+inline int f8693_29(int x) { return x * 29; }
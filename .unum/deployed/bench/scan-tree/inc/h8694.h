@@ -0,0 +1,42 @@
+#pragma once
+/* header 8694 */
+#include <vector>
+#include "h2386.h"
+#include "h9544.h"
+#include "h3405.h"
+#include "h3094.h"
+#include "h6844.h"
+#ifdef X
+#include "h3189.h"
+#endif
+struct S8694 { int a; const char *s = "x//y"; };
+inline int f8694_0(int x) { return x * 0; }
+inline int f8694_1(int x) { return x * 1; }
+inline int f8694_2(int x) { return x * 2; }
+inline int f8694_3(int x) { return x * 3; }
+inline int f8694_4(int x) { return x * 4; }
+inline int f8694_5(int x) { return x * 5; }
+inline int f8694_6(int x) { return x * 6; }
+inline int f8694_7(int x) { return x * 7; }
+inline int f8694_8(int x) { return x * 8; }
+inline int f8694_9(int x) { return x * 9; }
+inline int f8694_10(int x) { return x * 10; }
+inline int f8694_11(int x) { return x * 11; }
+inline int f8694_12(int x) { return x * 12; }
+inline int f8694_13(int x) { return x * 13; }
+inline int f8694_14(int x) { return x * 14; }
+inline int f8694_15(int x) { return x * 15; }
+inline int f8694_16(int x) { return x * 16; }
+inline int f8694_17(int x) { return x * 17; }
+inline int f8694_18(int x) { return x * 18; }
+inline int f8694_19(int x) { return x * 19; }
+inline int f8694_20(int x) { return x * 20; }
+inline int f8694_21(int x) { return x * 21; }
+inline int f8694_22(int x) { return x * 22; }
+inline int f8694_23(int x) { return x * 23; }
+inline int f8694_24(int x) { return x * 24; }
+inline int f8694_25(int x) { return x * 25; }
+inline int f8694_26(int x) { return x * 26; }
+inline int f8694_27(int x) { return x * 27; }
+inline int f8694_28(int x) { return x * 28; }
+inline int f8694_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8695 */
+#include <vector>
+#include "h949.h"
+#include "h9355.h"
+#include "h4084.h"
+#include "h3196.h"
+#include "h7512.h"
+#ifdef X
+#include "h6373.h"
+#endif
+struct S8695 { int a; const char *s = "x//y"; };
+inline int f8695_0(int x) { return x * 0; }
+inline int f8695_1(int x) { return x * 1; }
+inline int f8695_2(int x) { return x * 2; }
+inline int f8695_3(int x) { return x * 3; }
+inline int f8695_4(int x) { return x * 4; }
+inline int f8695_5(int x) { return x * 5; }
+inline int f8695_6(int x) { return x * 6; }
+inline int f8695_7(int x) { return x * 7; }
+inline int f8695_8(int x) { return x * 8; }
+inline int f8695_9(int x) { return x * 9; }
+inline int f8695_10(int x) { return x * 10; }
+inline int f8695_11(int x) { return x * 11; }
+inline int f8695_12(int x) { return x * 12; }
+inline int f8695_13(int x) { return x * 13; }
+inline int f8695_14(int x) { return x * 14; }
+inline int f8695_15(int x) { return x * 15; }
+inline int f8695_16(int x) { return x * 16; }
+inline int f8695_17(int x) { return x * 17; }
+inline int f8695_18(int x) { return x * 18; }
+inline int f8695_19(int x) { return x * 19; }
+inline int f8695_20(int x) { return x * 20; }
+inline int f8695_21(int x) { return x * 21; }
+inline int f8695_22(int x) { return x * 22; }
+inline int f8695_23(int x) { return x * 23; }
+inline int f8695_24(int x) { return x * 24; }
+inline int f8695_25(int x) { return x * 25; }
+inline int f8695_26(int x) { return x * 26; }
+inline int f8695_27(int x) { return x * 27; }
+inline int f8695_28(int x) { return x * 28; }
+inline int f8695_29(int x) { return x * 29; }
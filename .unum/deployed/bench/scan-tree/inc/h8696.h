@@ -0,0 +1,42 @@
+#pragma once
+/* header 8696 */
+#include <vector>
+#include "h8344.h"
+#include "h7980.h"
+#include "h377.h"
+#include "h8837.h"
+#include "h4654.h"
+#ifdef X
+#include "h4811.h"
+#endif
+struct S8696 { int a; const char *s = "x//y"; };
+inline int f8696_0(int x) { return x * 0; }
+inline int f8696_1(int x) { return x * 1; }
+inline int f8696_2(int x) { return x * 2; }
+inline int f8696_3(int x) { return x * 3; }
+inline int f8696_4(int x) { return x * 4; }
+inline int f8696_5(int x) { return x * 5; }
+inline int f8696_6(int x) { return x * 6; }
+inline int f8696_7(int x) { return x * 7; }
+inline int f8696_8(int x) { return x * 8; }
+inline int f8696_9(int x) { return x * 9; }
+inline int f8696_10(int x) { return x * 10; }
+inline int f8696_11(int x) { return x * 11; }
+inline int f8696_12(int x) { return x * 12; }
+inline int f8696_13(int x) { return x * 13; }
+inline int f8696_14(int x) { return x * 14; }
+inline int f8696_15(int x) { return x * 15; }
+inline int f8696_16(int x) { return x * 16; }
+inline int f8696_17(int x) { return x * 17; }
+inline int f8696_18(int x) { return x * 18; }
+inline int f8696_19(int x) { return x * 19; }
+inline int f8696_20(int x) { return x * 20; }
+inline int f8696_21(int x) { return x * 21; }
+inline int f8696_22(int x) { return x * 22; }
+inline int f8696_23(int x) { return x * 23; }
+inline int f8696_24(int x) { return x * 24; }
+inline int f8696_25(int x) { return x * 25; }
+inline int f8696_26(int x) { return x * 26; }
+inline int f8696_27(int x) { return x * 27; }
+inline int f8696_28(int x) { return x * 28; }
+inline int f8696_29(int x) { return x * 29; }
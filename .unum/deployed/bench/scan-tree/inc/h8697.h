@@ -0,0 +1,42 @@
+#pragma once
+/* header 8697 */
+#include <vector>
+#include "h5771.h"
+#include "h9224.h"
+#include "h5752.h"
+#include "h6789.h"
+#include "h4707.h"
+#ifdef X
+#include "h2423.h"
+#endif
+struct S8697 { int a; const char *s = "x//y"; };
+inline int f8697_0(int x) { return x * 0; }
+inline int f8697_1(int x) { return x * 1; }
+inline int f8697_2(int x) { return x * 2; }
+inline int f8697_3(int x) { return x * 3; }
+inline int f8697_4(int x) { return x * 4; }
+inline int f8697_5(int x) { return x * 5; }
+inline int f8697_6(int x) { return x * 6; }
+inline int f8697_7(int x) { return x * 7; }
+inline int f8697_8(int x) { return x * 8; }
+inline int f8697_9(int x) { return x * 9; }
+inline int f8697_10(int x) { return x * 10; }
+inline int f8697_11(int x) { return x * 11; }
+inline int f8697_12(int x) { return x * 12; }
+inline int f8697_13(int x) { return x * 13; }
+inline int f8697_14(int x) { return x * 14; }
+inline int f8697_15(int x) { return x * 15; }
+inline int f8697_16(int x) { return x * 16; }
+inline int f8697_17(int x) { return x * 17; }
+inline int f8697_18(int x) { return x * 18; }
+inline int f8697_19(int x) { return x * 19; }
+inline int f8697_20(int x) { return x * 20; }
+inline int f8697_21(int x) { return x * 21; }
+inline int f8697_22(int x) { return x * 22; }
+inline int f8697_23(int x) { return x * 23; }
+inline int f8697_24(int x) { return x * 24; }
+inline int f8697_25(int x) { return x * 25; }
+inline int f8697_26(int x) { return x * 26; }
+inline int f8697_27(int x) { return x * 27; }
+inline int f8697_28(int x) { return x * 28; }
+inline int f8697_29(int x) { return x * 29; }
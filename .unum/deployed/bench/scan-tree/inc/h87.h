@@ -0,0 +1,42 @@
+#pragma once
+/* header 87 */
+#include <vector>
+#include "h3576.h"
+#include "h7099.h"
+#include "h6993.h"
+#include "h6691.h"
+#include "h2114.h"
+#ifdef X
+#include "h5788.h"
+#endif
+struct S87 { int a; const char *s = "x//y"; };
+inline int f87_0(int x) { return x * 0; }
+inline int f87_1(int x) { return x * 1; }
+inline int f87_2(int x) { return x * 2; }
+inline int f87_3(int x) { return x * 3; }
+inline int f87_4(int x) { return x * 4; }
+inline int f87_5(int x) { return x * 5; }
+inline int f87_6(int x) { return x * 6; }
+inline int f87_7(int x) { return x * 7; }
+inline int f87_8(int x) { return x * 8; }
+inline int f87_9(int x) { return x * 9; }
+inline int f87_10(int x) { return x * 10; }
+inline int f87_11(int x) { return x * 11; }
+inline int f87_12(int x) { return x * 12; }
+inline int f87_13(int x) { return x * 13; }
+inline int f87_14(int x) { return x * 14; }
+inline int f87_15(int x) { return x * 15; }
+inline int f87_16(int x) { return x * 16; }
+inline int f87_17(int x) { return x * 17; }
+inline int f87_18(int x) { return x * 18; }
+inline int f87_19(int x) { return x * 19; }
+inline int f87_20(int x) { return x * 20; }
+inline int f87_21(int x) { return x * 21; }
+inline int f87_22(int x) { return x * 22; }
+inline int f87_23(int x) { return x * 23; }
+inline int f87_24(int x) { return x * 24; }
+inline int f87_25(int x) { return x * 25; }
+inline int f87_26(int x) { return x * 26; }
+inline int f87_27(int x) { return x * 27; }
+inline int f87_28(int x) { return x * 28; }
+inline int f87_29(int x) { return x * 29; }
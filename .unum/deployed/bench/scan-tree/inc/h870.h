@@ -0,0 +1,42 @@
+#pragma once
+/* header 870 */
+#include <vector>
+#include "h6919.h"
+#include "h6183.h"
+#include "h7764.h"
+#include "h6561.h"
+#include "h6499.h"
+#ifdef X
+#include "h4402.h"
+#endif
+struct S870 { int a; const char *s = "x//y"; };
+inline int f870_0(int x) { return x * 0; }
+inline int f870_1(int x) { return x * 1; }
+inline int f870_2(int x) { return x * 2; }
+inline int f870_3(int x) { return x * 3; }
+inline int f870_4(int x) { return x * 4; }
+inline int f870_5(int x) { return x * 5; }
+inline int f870_6(int x) { return x * 6; }
+inline int f870_7(int x) { return x * 7; }
+inline int f870_8(int x) { return x * 8; }
+inline int f870_9(int x) { return x * 9; }
+inline int f870_10(int x) { return x * 10; }
+inline int f870_11(int x) { return x * 11; }
+inline int f870_12(int x) { return x * 12; }
+inline int f870_13(int x) { return x * 13; }
+inline int f870_14(int x) { return x * 14; }
+inline int f870_15(int x) { return x * 15; }
+inline int f870_16(int x) { return x * 16; }
+inline int f870_17(int x) { return x * 17; }
+inline int f870_18(int x) { return x * 18; }
+inline int f870_19(int x) { return x * 19; }
+inline int f870_20(int x) { return x * 20; }
+inline int f870_21(int x) { return x * 21; }
+inline int f870_22(int x) { return x * 22; }
+inline int f870_23(int x) { return x * 23; }
+inline int f870_24(int x) { return x * 24; }
+inline int f870_25(int x) { return x * 25; }
+inline int f870_26(int x) { return x * 26; }
+inline int f870_27(int x) { return x * 27; }
+inline int f870_28(int x) { return x * 28; }
+inline int f870_29(int x) { return x * 29; }
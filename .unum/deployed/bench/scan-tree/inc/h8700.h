@@ -0,0 +1,42 @@
+#pragma once
+/* header 8700 */
+#include <vector>
+#include "h605.h"
+#include "h6226.h"
+#include "h2270.h"
+#include "h9584.h"
+#include "h7650.h"
+#ifdef X
+#include "h9343.h"
+#endif
+struct S8700 { int a; const char *s = "x//y"; };
+inline int f8700_0(int x) { return x * 0; }
+inline int f8700_1(int x) { return x * 1; }
+inline int f8700_2(int x) { return x * 2; }
+inline int f8700_3(int x) { return x * 3; }
+inline int f8700_4(int x) { return x * 4; }
+inline int f8700_5(int x) { return x * 5; }
+inline int f8700_6(int x) { return x * 6; }
+inline int f8700_7(int x) { return x * 7; }
+inline int f8700_8(int x) { return x * 8; }
+inline int f8700_9(int x) { return x * 9; }
+inline int f8700_10(int x) { return x * 10; }
+inline int f8700_11(int x) { return x * 11; }
+inline int f8700_12(int x) { return x * 12; }
+inline int f8700_13(int x) { return x * 13; }
+inline int f8700_14(int x) { return x * 14; }
+inline int f8700_15(int x) { return x * 15; }
+inline int f8700_16(int x) { return x * 16; }
+inline int f8700_17(int x) { return x * 17; }
+inline int f8700_18(int x) { return x * 18; }
+inline int f8700_19(int x) { return x * 19; }
+inline int f8700_20(int x) { return x * 20; }
+inline int f8700_21(int x) { return x * 21; }
+inline int f8700_22(int x) { return x * 22; }
+inline int f8700_23(int x) { return x * 23; }
+inline int f8700_24(int x) { return x * 24; }
+inline int f8700_25(int x) { return x * 25; }
+inline int f8700_26(int x) { return x * 26; }
+inline int f8700_27(int x) { return x * 27; }
+inline int f8700_28(int x) { return x * 28; }
+inline int f8700_29(int x) { return x * 29; }
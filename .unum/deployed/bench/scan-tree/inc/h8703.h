@@ -0,0 +1,42 @@
+#pragma once
+/* header 8703 */
+#include <vector>
+#include "h8910.h"
+#include "h6745.h"
+#include "h3770.h"
+#include "h3223.h"
+#include "h414.h"
+#ifdef X
+#include "h1490.h"
+#endif
+struct S8703 { int a; const char *s = "x//y"; };
+inline int f8703_0(int x) { return x * 0; }
+inline int f8703_1(int x) { return x * 1; }
+inline int f8703_2(int x) { return x * 2; }
+inline int f8703_3(int x) { return x * 3; }
+inline int f8703_4(int x) { return x * 4; }
+inline int f8703_5(int x) { return x * 5; }
+inline int f8703_6(int x) { return x * 6; }
+inline int f8703_7(int x) { return x * 7; }
+inline int f8703_8(int x) { return x * 8; }
+inline int f8703_9(int x) { return x * 9; }
+inline int f8703_10(int x) { return x * 10; }
+inline int f8703_11(int x) { return x * 11; }
+inline int f8703_12(int x) { return x * 12; }
+inline int f8703_13(int x) { return x * 13; }
+inline int f8703_14(int x) { return x * 14; }
+inline int f8703_15(int x) { return x * 15; }
+inline int f8703_16(int x) { return x * 16; }
+inline int f8703_17(int x) { return x * 17; }
+inline int f8703_18(int x) { return x * 18; }
+inline int f8703_19(int x) { return x * 19; }
+inline int f8703_20(int x) { return x * 20; }
+inline int f8703_21(int x) { return x * 21; }
+inline int f8703_22(int x) { return x * 22; }
+inline int f8703_23(int x) { return x * 23; }
+inline int f8703_24(int x) { return x * 24; }
+inline int f8703_25(int x) { return x * 25; }
+inline int f8703_26(int x) { return x * 26; }
+inline int f8703_27(int x) { return x * 27; }
+inline int f8703_28(int x) { return x * 28; }
+inline int f8703_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8707 */
+#include <vector>
+#include "h8488.h"
+#include "h8168.h"
+#include "h3924.h"
+#include "h9513.h"
+#include "h3360.h"
+#ifdef X
+#include "h7460.h"
+#endif
+struct S8707 { int a; const char *s = "x//y"; };
+inline int f8707_0(int x) { return x * 0; }
+inline int f8707_1(int x) { return x * 1; }
+inline int f8707_2(int x) { return x * 2; }
+inline int f8707_3(int x) { return x * 3; }
+inline int f8707_4(int x) { return x * 4; }
+inline int f8707_5(int x) { return x * 5; }
+inline int f8707_6(int x) { return x * 6; }
+inline int f8707_7(int x) { return x * 7; }
+inline int f8707_8(int x) { return x * 8; }
+inline int f8707_9(int x) { return x * 9; }
+inline int f8707_10(int x) { return x * 10; }
+inline int f8707_11(int x) { return x * 11; }
+inline int f8707_12(int x) { return x * 12; }
+inline int f8707_13(int x) { return x * 13; }
+inline int f8707_14(int x) { return x * 14; }
+inline int f8707_15(int x) { return x * 15; }
+inline int f8707_16(int x) { return x * 16; }
+inline int f8707_17(int x) { return x * 17; }
+inline int f8707_18(int x) { return x * 18; }
+inline int f8707_19(int x) { return x * 19; }
+inline int f8707_20(int x) { return x * 20; }
+inline int f8707_21(int x) { return x * 21; }
+inline int f8707_22(int x) { return x * 22; }
+inline int f8707_23(int x) { return x * 23; }
+inline int f8707_24(int x) { return x * 24; }
+inline int f8707_25(int x) { return x * 25; }
+inline int f8707_26(int x) { return x * 26; }
+inline int f8707_27(int x) { return x * 27; }
+inline int f8707_28(int x) { return x * 28; }
+inline int f8707_29(int x) { return x * 29; }
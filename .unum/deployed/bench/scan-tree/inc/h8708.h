@@ -0,0 +1,42 @@
+#pragma once
+/* header 8708 */
+#include <vector>
+#include "h5872.h"
+#include "h239.h"
+#include "h4184.h"
+#include "h4978.h"
+#include "h9980.h"
+#ifdef X
+#include "h2075.h"
+#endif
+struct S8708 { int a; const char *s = "x//y"; };
+inline int f8708_0(int x) { return x * 0; }
+inline int f8708_1(int x) { return x * 1; }
+inline int f8708_2(int x) { return x * 2; }
+inline int f8708_3(int x) { return x * 3; }
+inline int f8708_4(int x) { return x * 4; }
+inline int f8708_5(int x) { return x * 5; }
+inline int f8708_6(int x) { return x * 6; }
+inline int f8708_7(int x) { return x * 7; }
+inline int f8708_8(int x) { return x * 8; }
+inline int f8708_9(int x) { return x * 9; }
+inline int f8708_10(int x) { return x * 10; }
+inline int f8708_11(int x) { return x * 11; }
+inline int f8708_12(int x) { return x * 12; }
+inline int f8708_13(int x) { return x * 13; }
+inline int f8708_14(int x) { return x * 14; }
+inline int f8708_15(int x) { return x * 15; }
+inline int f8708_16(int x) { return x * 16; }
+inline int f8708_17(int x) { return x * 17; }
+inline int f8708_18(int x) { return x * 18; }
+inline int f8708_19(int x) { return x * 19; }
+inline int f8708_20(int x) { return x * 20; }
+inline int f8708_21(int x) { return x * 21; }
+inline int f8708_22(int x) { return x * 22; }
+inline int f8708_23(int x) { return x * 23; }
+inline int f8708_24(int x) { return x * 24; }
+inline int f8708_25(int x) { return x * 25; }
+inline int f8708_26(int x) { return x * 26; }
+inline int f8708_27(int x) { return x * 27; }
+inline int f8708_28(int x) { return x * 28; }
+inline int f8708_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8709 */
+#include <vector>
+#include "h8685.h"
+#include "h9540.h"
+#include "h6702.h"
+#include "h4027.h"
+#include "h956.h"
+#ifdef X
+#include "h2515.h"
+#endif
+struct S8709 { int a; const char *s = "x//y"; };
+inline int f8709_0(int x) { return x * 0; }
+inline int f8709_1(int x) { return x * 1; }
+inline int f8709_2(int x) { return x * 2; }
+inline int f8709_3(int x) { return x * 3; }
+inline int f8709_4(int x) { return x * 4; }
+inline int f8709_5(int x) { return x * 5; }
+inline int f8709_6(int x) { return x * 6; }
+inline int f8709_7(int x) { return x * 7; }
+inline int f8709_8(int x) { return x * 8; }
+inline int f8709_9(int x) { return x * 9; }
+inline int f8709_10(int x) { return x * 10; }
+inline int f8709_11(int x) { return x * 11; }
+inline int f8709_12(int x) { return x * 12; }
+inline int f8709_13(int x) { return x * 13; }
+inline int f8709_14(int x) { return x * 14; }
+inline int f8709_15(int x) { return x * 15; }
+inline int f8709_16(int x) { return x * 16; }
+inline int f8709_17(int x) { return x * 17; }
+inline int f8709_18(int x) { return x * 18; }
+inline int f8709_19(int x) { return x * 19; }
+inline int f8709_20(int x) { return x * 20; }
+inline int f8709_21(int x) { return x * 21; }
+inline int f8709_22(int x) { return x * 22; }
+inline int f8709_23(int x) { return x * 23; }
+inline int f8709_24(int x) { return x * 24; }
+inline int f8709_25(int x) { return x * 25; }
+inline int f8709_26(int x) { return x * 26; }
+inline int f8709_27(int x) { return x * 27; }
+inline int f8709_28(int x) { return x * 28; }
+inline int f8709_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8710 */
+#include <vector>
+#include "h9537.h"
+#include "h4471.h"
+#include "h3866.h"
+#include "h8357.h"
+#include "h9583.h"
+#ifdef X
+#include "h4583.h"
+#endif
+struct S8710 { int a; const char *s = "x//y"; };
+inline int f8710_0(int x) { return x * 0; }
+inline int f8710_1(int x) { return x * 1; }
+inline int f8710_2(int x) { return x * 2; }
+inline int f8710_3(int x) { return x * 3; }
+inline int f8710_4(int x) { return x * 4; }
+inline int f8710_5(int x) { return x * 5; }
+inline int f8710_6(int x) { return x * 6; }
+inline int f8710_7(int x) { return x * 7; }
+inline int f8710_8(int x) { return x * 8; }
+inline int f8710_9(int x) { return x * 9; }
+inline int f8710_10(int x) { return x * 10; }
+inline int f8710_11(int x) { return x * 11; }
+inline int f8710_12(int x) { return x * 12; }
+inline int f8710_13(int x) { return x * 13; }
+inline int f8710_14(int x) { return x * 14; }
+inline int f8710_15(int x) { return x * 15; }
+inline int f8710_16(int x) { return x * 16; }
+inline int f8710_17(int x) { return x * 17; }
+inline int f8710_18(int x) { return x * 18; }
+inline int f8710_19(int x) { return x * 19; }
+inline int f8710_20(int x) { return x * 20; }
+inline int f8710_21(int x) { return x * 21; }
+inline int f8710_22(int x) { return x * 22; }
+inline int f8710_23(int x) { return x * 23; }
+inline int f8710_24(int x) { return x * 24; }
+inline int f8710_25(int x) { return x * 25; }
+inline int f8710_26(int x) { return x * 26; }
+inline int f8710_27(int x) { return x * 27; }
+inline int f8710_28(int x) { return x * 28; }
+inline int f8710_29(int x) { return x * 29; }
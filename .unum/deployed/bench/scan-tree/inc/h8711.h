@@ -0,0 +1,42 @@
+#pragma once
+/* header 8711 */
+#include <vector>
+#include "h9292.h"
+#include "h1012.h"
+#include "h8478.h"
+#include "h6537.h"
+#include "h8570.h"
+#ifdef X
+#include "h7967.h"
+#endif
+struct S8711 { int a; const char *s = "x//y"; };
+inline int f8711_0(int x) { return x * 0; }
+inline int f8711_1(int x) { return x * 1; }
+inline int f8711_2(int x) { return x * 2; }
+inline int f8711_3(int x) { return x * 3; }
+inline int f8711_4(int x) { return x * 4; }
+inline int f8711_5(int x) { return x * 5; }
+inline int f8711_6(int x) { return x * 6; }
+inline int f8711_7(int x) { return x * 7; }
+inline int f8711_8(int x) { return x * 8; }
+inline int f8711_9(int x) { return x * 9; }
+inline int f8711_10(int x) { return x * 10; }
+inline int f8711_11(int x) { return x * 11; }
+inline int f8711_12(int x) { return x * 12; }
+inline int f8711_13(int x) { return x * 13; }
+inline int f8711_14(int x) { return x * 14; }
+inline int f8711_15(int x) { return x * 15; }
+inline int f8711_16(int x) { return x * 16; }
+inline int f8711_17(int x) { return x * 17; }
+inline int f8711_18(int x) { return x * 18; }
+inline int f8711_19(int x) { return x * 19; }
+inline int f8711_20(int x) { return x * 20; }
+inline int f8711_21(int x) { return x * 21; }
+inline int f8711_22(int x) { return x * 22; }
+inline int f8711_23(int x) { return x * 23; }
+inline int f8711_24(int x) { return x * 24; }
+inline int f8711_25(int x) { return x * 25; }
+inline int f8711_26(int x) { return x * 26; }
+inline int f8711_27(int x) { return x * 27; }
+inline int f8711_28(int x) { return x * 28; }
+inline int f8711_29(int x) { return x * 29; }
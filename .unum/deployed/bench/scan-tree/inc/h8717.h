@@ -0,0 +1,42 @@
+#pragma once
+/* header 8717 */
+#include <vector>
+#include "h1367.h"
+#include "h4883.h"
+#include "h958.h"
+#include "h9458.h"
+#include "h8372.h"
+#ifdef X
+#include "h5445.h"
+#endif
+struct S8717 { int a; const char *s = "x//y"; };
+inline int f8717_0(int x) { return x * 0; }
+inline int f8717_1(int x) { return x * 1; }
+inline int f8717_2(int x) { return x * 2; }
+inline int f8717_3(int x) { return x * 3; }
+inline int f8717_4(int x) { return x * 4; }
+inline int f8717_5(int x) { return x * 5; }
+inline int f8717_6(int x) { return x * 6; }
+inline int f8717_7(int x) { return x * 7; }
+inline int f8717_8(int x) { return x * 8; }
+inline int f8717_9(int x) { return x * 9; }
+inline int f8717_10(int x) { return x * 10; }
+inline int f8717_11(int x) { return x * 11; }
+inline int f8717_12(int x) { return x * 12; }
+inline int f8717_13(int x) { return x * 13; }
+inline int f8717_14(int x) { return x * 14; }
+inline int f8717_15(int x) { return x * 15; }
+inline int f8717_16(int x) { return x * 16; }
+inline int f8717_17(int x) { return x * 17; }
+inline int f8717_18(int x) { return x * 18; }
+inline int f8717_19(int x) { return x * 19; }
+inline int f8717_20(int x) { return x * 20; }
+inline int f8717_21(int x) { return x * 21; }
+inline int f8717_22(int x) { return x * 22; }
+inline int f8717_23(int x) { return x * 23; }
+inline int f8717_24(int x) { return x * 24; }
+inline int f8717_25(int x) { return x * 25; }
+inline int f8717_26(int x) { return x * 26; }
+inline int f8717_27(int x) { return x * 27; }
+inline int f8717_28(int x) { return x * 28; }
+inline int f8717_29(int x) { return x * 29; }
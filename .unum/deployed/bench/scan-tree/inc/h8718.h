@@ -0,0 +1,42 @@
+#pragma once
+/* header 8718 */
+#include <vector>
+#include "h6390.h"
+#include "h7450.h"
+#include "h2153.h"
+#include "h3293.h"
+#include "h5729.h"
+#ifdef X
+#include "h8398.h"
+#endif
+struct S8718 { int a; const char *s = "x//y"; };
+inline int f8718_0(int x) { return x * 0; }
+inline int f8718_1(int x) { return x * 1; }
+inline int f8718_2(int x) { return x * 2; }
+inline int f8718_3(int x) { return x * 3; }
+inline int f8718_4(int x) { return x * 4; }
+inline int f8718_5(int x) { return x * 5; }
+inline int f8718_6(int x) { return x * 6; }
+inline int f8718_7(int x) { return x * 7; }
+inline int f8718_8(int x) { return x * 8; }
+inline int f8718_9(int x) { return x * 9; }
+inline int f8718_10(int x) { return x * 10; }
+inline int f8718_11(int x) { return x * 11; }
+inline int f8718_12(int x) { return x * 12; }
+inline int f8718_13(int x) { return x * 13; }
+inline int f8718_14(int x) { return x * 14; }
+inline int f8718_15(int x) { return x * 15; }
+inline int f8718_16(int x) { return x * 16; }
+inline int f8718_17(int x) { return x * 17; }
+inline int f8718_18(int x) { return x * 18; }
+inline int f8718_19(int x) { return x * 19; }
+inline int f8718_20(int x) { return x * 20; }
+inline int f8718_21(int x) { return x * 21; }
+inline int f8718_22(int x) { return x * 22; }
+inline int f8718_23(int x) { return x * 23; }
+inline int f8718_24(int x) { return x * 24; }
+inline int f8718_25(int x) { return x * 25; }
+inline int f8718_26(int x) { return x * 26; }
+inline int f8718_27(int x) { return x * 27; }
+inline int f8718_28(int x) { return x * 28; }
+inline int f8718_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8719 */
+#include <vector>
+#include "h8985.h"
+#include "h9402.h"
+#include "h342.h"
+#include "h6823.h"
+#include "h4226.h"
+#ifdef X
+#include "h2580.h"
+#endif
+struct S8719 { int a; const char *s = "x//y"; };
+inline int f8719_0(int x) { return x * 0; }
+inline int f8719_1(int x) { return x * 1; }
+inline int f8719_2(int x) { return x * 2; }
+inline int f8719_3(int x) { return x * 3; }
+inline int f8719_4(int x) { return x * 4; }
+inline int f8719_5(int x) { return x * 5; }
+inline int f8719_6(int x) { return x * 6; }
+inline int f8719_7(int x) { return x * 7; }
+inline int f8719_8(int x) { return x * 8; }
+inline int f8719_9(int x) { return x * 9; }
+inline int f8719_10(int x) { return x * 10; }
+inline int f8719_11(int x) { return x * 11; }
+inline int f8719_12(int x) { return x * 12; }
+inline int f8719_13(int x) { return x * 13; }
+inline int f8719_14(int x) { return x * 14; }
+inline int f8719_15(int x) { return x * 15; }
+inline int f8719_16(int x) { return x * 16; }
+inline int f8719_17(int x) { return x * 17; }
+inline int f8719_18(int x) { return x * 18; }
+inline int f8719_19(int x) { return x * 19; }
+inline int f8719_20(int x) { return x * 20; }
+inline int f8719_21(int x) { return x * 21; }
+inline int f8719_22(int x) { return x * 22; }
+inline int f8719_23(int x) { return x * 23; }
+inline int f8719_24(int x) { return x * 24; }
+inline int f8719_25(int x) { return x * 25; }
+inline int f8719_26(int x) { return x * 26; }
+inline int f8719_27(int x) { return x * 27; }
+inline int f8719_28(int x) { return x * 28; }
+inline int f8719_29(int x) { return x * 29; }
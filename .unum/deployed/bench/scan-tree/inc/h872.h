@@ -0,0 +1,42 @@
+#pragma once
+/* header 872 */
+#include <vector>
+#include "h4664.h"
+#include "h686.h"
+#include "h4515.h"
+#include "h6882.h"
+#include "h8868.h"
+#ifdef X
+#include "h8493.h"
+#endif
+struct S872 { int a; const char *s = "x//y"; };
+inline int f872_0(int x) { return x * 0; }
+inline int f872_1(int x) { return x * 1; }
+inline int f872_2(int x) { return x * 2; }
+inline int f872_3(int x) { return x * 3; }
+inline int f872_4(int x) { return x * 4; }
+inline int f872_5(int x) { return x * 5; }
+inline int f872_6(int x) { return x * 6; }
+inline int f872_7(int x) { return x * 7; }
+inline int f872_8(int x) { return x * 8; }
+inline int f872_9(int x) { return x * 9; }
+inline int f872_10(int x) { return x * 10; }
+inline int f872_11(int x) { return x * 11; }
+inline int f872_12(int x) { return x * 12; }
+inline int f872_13(int x) { return x * 13; }
+inline int f872_14(int x) { return x * 14; }
+inline int f872_15(int x) { return x * 15; }
+inline int f872_16(int x) { return x * 16; }
+inline int f872_17(int x) { return x * 17; }
+inline int f872_18(int x) { return x * 18; }
+inline int f872_19(int x) { return x * 19; }
+inline int f872_20(int x) { return x * 20; }
+inline int f872_21(int x) { return x * 21; }
+inline int f872_22(int x) { return x * 22; }
+inline int f872_23(int x) { return x * 23; }
+inline int f872_24(int x) { return x * 24; }
+inline int f872_25(int x) { return x * 25; }
+inline int f872_26(int x) { return x * 26; }
+inline int f872_27(int x) { return x * 27; }
+inline int f872_28(int x) { return x * 28; }
+inline int f872_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8722 */
+#include <vector>
+#include "h9649.h"
+#include "h1808.h"
+#include "h6692.h"
+#include "h4259.h"
+#include "h9042.h"
+#ifdef X
+#include "h9692.h"
+#endif
+struct S8722 { int a; const char *s = "x//y"; };
+inline int f8722_0(int x) { return x * 0; }
+inline int f8722_1(int x) { return x * 1; }
+inline int f8722_2(int x) { return x * 2; }
+inline int f8722_3(int x) { return x * 3; }
+inline int f8722_4(int x) { return x * 4; }
+inline int f8722_5(int x) { return x * 5; }
+inline int f8722_6(int x) { return x * 6; }
+inline int f8722_7(int x) { return x * 7; }
+inline int f8722_8(int x) { return x * 8; }
+inline int f8722_9(int x) { return x * 9; }
+inline int f8722_10(int x) { return x * 10; }
+inline int f8722_11(int x) { return x * 11; }
+inline int f8722_12(int x) { return x * 12; }
+inline int f8722_13(int x) { return x * 13; }
+inline int f8722_14(int x) { return x * 14; }
+inline int f8722_15(int x) { return x * 15; }
+inline int f8722_16(int x) { return x * 16; }
+inline int f8722_17(int x) { return x * 17; }
+inline int f8722_18(int x) { return x * 18; }
+inline int f8722_19(int x) { return x * 19; }
+inline int f8722_20(int x) { return x * 20; }
+inline int f8722_21(int x) { return x * 21; }
+inline int f8722_22(int x) { return x * 22; }
+inline int f8722_23(int x) { return x * 23; }
+inline int f8722_24(int x) { return x * 24; }
+inline int f8722_25(int x) { return x * 25; }
+inline int f8722_26(int x) { return x * 26; }
+inline int f8722_27(int x) { return x * 27; }
+inline int f8722_28(int x) { return x * 28; }
+inline int f8722_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8723 */
+#include <vector>
+#include "h1162.h"
+#include "h7951.h"
+#include "h3377.h"
+#include "h5860.h"
+#include "h1762.h"
+#ifdef X
+#include "h5979.h"
+#endif
+struct S8723 { int a; const char *s = "x//y"; };
+inline int f8723_0(int x) { return x * 0; }
+inline int f8723_1(int x) { return x * 1; }
+inline int f8723_2(int x) { return x * 2; }
+inline int f8723_3(int x) { return x * 3; }
+inline int f8723_4(int x) { return x * 4; }
+inline int f8723_5(int x) { return x * 5; }
+inline int f8723_6(int x) { return x * 6; }
+inline int f8723_7(int x) { return x * 7; }
+inline int f8723_8(int x) { return x * 8; }
+inline int f8723_9(int x) { return x * 9; }
+inline int f8723_10(int x) { return x * 10; }
+inline int f8723_11(int x) { return x * 11; }
+inline int f8723_12(int x) { return x * 12; }
+inline int f8723_13(int x) { return x * 13; }
+inline int f8723_14(int x) { return x * 14; }
+inline int f8723_15(int x) { return x * 15; }
+inline int f8723_16(int x) { return x * 16; }
+inline int f8723_17(int x) { return x * 17; }
+inline int f8723_18(int x) { return x * 18; }
+inline int f8723_19(int x) { return x * 19; }
+inline int f8723_20(int x) { return x * 20; }
+inline int f8723_21(int x) { return x * 21; }
+inline int f8723_22(int x) { return x * 22; }
+inline int f8723_23(int x) { return x * 23; }
+inline int f8723_24(int x) { return x * 24; }
+inline int f8723_25(int x) { return x * 25; }
+inline int f8723_26(int x) { return x * 26; }
+inline int f8723_27(int x) { return x * 27; }
+inline int f8723_28(int x) { return x * 28; }
+inline int f8723_29(int x) { return x * 29; }
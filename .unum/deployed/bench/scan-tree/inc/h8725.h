@@ -0,0 +1,42 @@
+#pragma once
+/* header 8725 */
+#include <vector>
+#include "h5634.h"
+#include "h7144.h"
+#include "h4439.h"
+#include "h1894.h"
+#include "h5711.h"
+#ifdef X
+#include "h256.h"
+#endif
+struct S8725 { int a; const char *s = "x//y"; };
+inline int f8725_0(int x) { return x * 0; }
+inline int f8725_1(int x) { return x * 1; }
+inline int f8725_2(int x) { return x * 2; }
+inline int f8725_3(int x) { return x * 3; }
+inline int f8725_4(int x) { return x * 4; }
+inline int f8725_5(int x) { return x * 5; }
+inline int f8725_6(int x) { return x * 6; }
+inline int f8725_7(int x) { return x * 7; }
+inline int f8725_8(int x) { return x * 8; }
+inline int f8725_9(int x) { return x * 9; }
+inline int f8725_10(int x) { return x * 10; }
+inline int f8725_11(int x) { return x * 11; }
+inline int f8725_12(int x) { return x * 12; }
+inline int f8725_13(int x) { return x * 13; }
+inline int f8725_14(int x) { return x * 14; }
+inline int f8725_15(int x) { return x * 15; }
+inline int f8725_16(int x) { return x * 16; }
+inline int f8725_17(int x) { return x * 17; }
+inline int f8725_18(int x) { return x * 18; }
+inline int f8725_19(int x) { return x * 19; }
+inline int f8725_20(int x) { return x * 20; }
+inline int f8725_21(int x) { return x * 21; }
+inline int f8725_22(int x) { return x * 22; }
+inline int f8725_23(int x) { return x * 23; }
+inline int f8725_24(int x) { return x * 24; }
+inline int f8725_25(int x) { return x * 25; }
+inline int f8725_26(int x) { return x * 26; }
+inline int f8725_27(int x) { return x * 27; }
+inline int f8725_28(int x) { return x * 28; }
+inline int f8725_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8726 */
+#include <vector>
+#include "h9988.h"
+#include "h4441.h"
+#include "h5512.h"
+#include "h1023.h"
+#include "h9347.h"
+#ifdef X
+#include "h9834.h"
+#endif
+struct S8726 { int a; const char *s = "x//y"; };
+inline int f8726_0(int x) { return x * 0; }
+inline int f8726_1(int x) { return x * 1; }
+inline int f8726_2(int x) { return x * 2; }
+inline int f8726_3(int x) { return x * 3; }
+inline int f8726_4(int x) { return x * 4; }
+inline int f8726_5(int x) { return x * 5; }
+inline int f8726_6(int x) { return x * 6; }
+inline int f8726_7(int x) { return x * 7; }
+inline int f8726_8(int x) { return x * 8; }
+inline int f8726_9(int x) { return x * 9; }
+inline int f8726_10(int x) { return x * 10; }
+inline int f8726_11(int x) { return x * 11; }
+inline int f8726_12(int x) { return x * 12; }
+inline int f8726_13(int x) { return x * 13; }
+inline int f8726_14(int x) { return x * 14; }
+inline int f8726_15(int x) { return x * 15; }
+inline int f8726_16(int x) { return x * 16; }
+inline int f8726_17(int x) { return x * 17; }
+inline int f8726_18(int x) { return x * 18; }
+inline int f8726_19(int x) { return x * 19; }
+inline int f8726_20(int x) { return x * 20; }
+inline int f8726_21(int x) { return x * 21; }
+inline int f8726_22(int x) { return x * 22; }
+inline int f8726_23(int x) { return x * 23; }
+inline int f8726_24(int x) { return x * 24; }
+inline int f8726_25(int x) { return x * 25; }
+inline int f8726_26(int x) { return x * 26; }
+inline int f8726_27(int x) { return x * 27; }
+inline int f8726_28(int x) { return x * 28; }
+inline int f8726_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8727 */
+#include <vector>
+#include "h6260.h"
+#include "h5872.h"
+#include "h2681.h"
+#include "h2415.h"
+#include "h2054.h"
+#ifdef X
+#include "h9381.h"
+#endif
+struct S8727 { int a; const char *s = "x//y"; };
+inline int f8727_0(int x) { return x * 0; }
+inline int f8727_1(int x) { return x * 1; }
+inline int f8727_2(int x) { return x * 2; }
+inline int f8727_3(int x) { return x * 3; }
+inline int f8727_4(int x) { return x * 4; }
+inline int f8727_5(int x) { return x * 5; }
+inline int f8727_6(int x) { return x * 6; }
+inline int f8727_7(int x) { return x * 7; }
+inline int f8727_8(int x) { return x * 8; }
+inline int f8727_9(int x) { return x * 9; }
+inline int f8727_10(int x) { return x * 10; }
+inline int f8727_11(int x) { return x * 11; }
+inline int f8727_12(int x) { return x * 12; }
+inline int f8727_13(int x) { return x * 13; }
+inline int f8727_14(int x) { return x * 14; }
+inline int f8727_15(int x) { return x * 15; }
+inline int f8727_16(int x) { return x * 16; }
+inline int f8727_17(int x) { return x * 17; }
+inline int f8727_18(int x) { return x * 18; }
+inline int f8727_19(int x) { return x * 19; }
+inline int f8727_20(int x) { return x * 20; }
+inline int f8727_21(int x) { return x * 21; }
+inline int f8727_22(int x) { return x * 22; }
+inline int f8727_23(int x) { return x * 23; }
+inline int f8727_24(int x) { return x * 24; }
+inline int f8727_25(int x) { return x * 25; }
+inline int f8727_26(int x) { return x * 26; }
+inline int f8727_27(int x) { return x * 27; }
+inline int f8727_28(int x) { return x * 28; }
+inline int f8727_29(int x) { return x * 29; }
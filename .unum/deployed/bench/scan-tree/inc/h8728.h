@@ -0,0 +1,42 @@
+#pragma once
+/* header 8728 */
+#include <vector>
+#include "h1590.h"
+#include "h1593.h"
+#include "h825.h"
+#include "h3294.h"
+#include "h8802.h"
+#ifdef X
+#include "h8661.h"
+#endif
+struct S8728 { int a; const char *s = "x//y"; };
+inline int f8728_0(int x) { return x * 0; }
+inline int f8728_1(int x) { return x * 1; }
+inline int f8728_2(int x) { return x * 2; }
+inline int f8728_3(int x) { return x * 3; }
+inline int f8728_4(int x) { return x * 4; }
+inline int f8728_5(int x) { return x * 5; }
+inline int f8728_6(int x) { return x * 6; }
+inline int f8728_7(int x) { return x * 7; }
+inline int f8728_8(int x) { return x * 8; }
+inline int f8728_9(int x) { return x * 9; }
+inline int f8728_10(int x) { return x * 10; }
+inline int f8728_11(int x) { return x * 11; }
+inline int f8728_12(int x) { return x * 12; }
+inline int f8728_13(int x) { return x * 13; }
+inline int f8728_14(int x) { return x * 14; }
+inline int f8728_15(int x) { return x * 15; }
+inline int f8728_16(int x) { return x * 16; }
+inline int f8728_17(int x) { return x * 17; }
+inline int f8728_18(int x) { return x * 18; }
+inline int f8728_19(int x) { return x * 19; }
+inline int f8728_20(int x) { return x * 20; }
+inline int f8728_21(int x) { return x * 21; }
+inline int f8728_22(int x) { return x * 22; }
+inline int f8728_23(int x) { return x * 23; }
+inline int f8728_24(int x) { return x * 24; }
+inline int f8728_25(int x) { return x * 25; }
+inline int f8728_26(int x) { return x * 26; }
+inline int f8728_27(int x) { return x * 27; }
+inline int f8728_28(int x) { return x * 28; }
+inline int f8728_29(int x) { return x * 29; }
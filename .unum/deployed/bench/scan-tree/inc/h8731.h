@@ -0,0 +1,42 @@
+#pragma once
+/* header 8731 */
+#include <vector>
+#include "h2133.h"
+#include "h6025.h"
+#include "h9431.h"
+#include "h5105.h"
+#include "h5493.h"
+#ifdef X
+#include "h5512.h"
+#endif
+struct S8731 { int a; const char *s = "x//y"; };
+inline int f8731_0(int x) { return x * 0; }
+inline int f8731_1(int x) { return x * 1; }
+inline int f8731_2(int x) { return x * 2; }
+inline int f8731_3(int x) { return x * 3; }
+inline int f8731_4(int x) { return x * 4; }
+inline int f8731_5(int x) { return x * 5; }
+inline int f8731_6(int x) { return x * 6; }
+inline int f8731_7(int x) { return x * 7; }
+inline int f8731_8(int x) { return x * 8; }
+inline int f8731_9(int x) { return x * 9; }
+inline int f8731_10(int x) { return x * 10; }
+inline int f8731_11(int x) { return x * 11; }
+inline int f8731_12(int x) { return x * 12; }
+inline int f8731_13(int x) { return x * 13; }
+inline int f8731_14(int x) { return x * 14; }
+inline int f8731_15(int x) { return x * 15; }
+inline int f8731_16(int x) { return x * 16; }
+inline int f8731_17(int x) { return x * 17; }
+inline int f8731_18(int x) { return x * 18; }
+inline int f8731_19(int x) { return x * 19; }
+inline int f8731_20(int x) { return x * 20; }
+inline int f8731_21(int x) { return x * 21; }
+inline int f8731_22(int x) { return x * 22; }
+inline int f8731_23(int x) { return x * 23; }
+inline int f8731_24(int x) { return x * 24; }
+inline int f8731_25(int x) { return x * 25; }
+inline int f8731_26(int x) { return x * 26; }
+inline int f8731_27(int x) { return x * 27; }
+inline int f8731_28(int x) { return x * 28; }
+inline int f8731_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8733 */
+#include <vector>
+#include "h7072.h"
+#include "h7465.h"
+#include "h9431.h"
+#include "h986.h"
+#include "h4111.h"
+#ifdef X
+#include "h7456.h"
+#endif
+struct S8733 { int a; const char *s = "x//y"; };
+inline int f8733_0(int x) { return x * 0; }
+inline int f8733_1(int x) { return x * 1; }
+inline int f8733_2(int x) { return x * 2; }
+inline int f8733_3(int x) { return x * 3; }
+inline int f8733_4(int x) { return x * 4; }
+inline int f8733_5(int x) { return x * 5; }
+inline int f8733_6(int x) { return x * 6; }
+inline int f8733_7(int x) { return x * 7; }
+inline int f8733_8(int x) { return x * 8; }
+inline int f8733_9(int x) { return x * 9; }
+inline int f8733_10(int x) { return x * 10; }
+inline int f8733_11(int x) { return x * 11; }
+inline int f8733_12(int x) { return x * 12; }
+inline int f8733_13(int x) { return x * 13; }
+inline int f8733_14(int x) { return x * 14; }
+inline int f8733_15(int x) { return x * 15; }
+inline int f8733_16(int x) { return x * 16; }
+inline int f8733_17(int x) { return x * 17; }
+inline int f8733_18(int x) { return x * 18; }
+inline int f8733_19(int x) { return x * 19; }
+inline int f8733_20(int x) { return x * 20; }
+inline int f8733_21(int x) { return x * 21; }
+inline int f8733_22(int x) { return x * 22; }
+inline int f8733_23(int x) { return x * 23; }
+inline int f8733_24(int x) { return x * 24; }
+inline int f8733_25(int x) { return x * 25; }
+inline int f8733_26(int x) { return x * 26; }
+inline int f8733_27(int x) { return x * 27; }
+inline int f8733_28(int x) { return x * 28; }
+inline int f8733_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8734 */
+#include <vector>
+#include "h9016.h"
+#include "h5744.h"
+#include "h6648.h"
+#include "h4729.h"
+#include "h265.h"
+#ifdef X
+#include "h4332.h"
+#endif
+struct S8734 { int a; const char *s = "x//y"; };
+inline int f8734_0(int x) { return x * 0; }
+inline int f8734_1(int x) { return x * 1; }
+inline int f8734_2(int x) { return x * 2; }
+inline int f8734_3(int x) { return x * 3; }
+inline int f8734_4(int x) { return x * 4; }
+inline int f8734_5(int x) { return x * 5; }
+inline int f8734_6(int x) { return x * 6; }
+inline int f8734_7(int x) { return x * 7; }
+inline int f8734_8(int x) { return x * 8; }
+inline int f8734_9(int x) { return x * 9; }
+inline int f8734_10(int x) { return x * 10; }
+inline int f8734_11(int x) { return x * 11; }
+inline int f8734_12(int x) { return x * 12; }
+inline int f8734_13(int x) { return x * 13; }
+inline int f8734_14(int x) { return x * 14; }
+inline int f8734_15(int x) { return x * 15; }
+inline int f8734_16(int x) { return x * 16; }
+inline int f8734_17(int x) { return x * 17; }
+inline int f8734_18(int x) { return x * 18; }
+inline int f8734_19(int x) { return x * 19; }
+inline int f8734_20(int x) { return x * 20; }
+inline int f8734_21(int x) { return x * 21; }
+inline int f8734_22(int x) { return x * 22; }
+inline int f8734_23(int x) { return x * 23; }
+inline int f8734_24(int x) { return x * 24; }
+inline int f8734_25(int x) { return x * 25; }
+inline int f8734_26(int x) { return x * 26; }
+inline int f8734_27(int x) { return x * 27; }
+inline int f8734_28(int x) { return x * 28; }
+inline int f8734_29(int x) { return x * 29; }
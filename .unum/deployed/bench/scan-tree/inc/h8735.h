@@ -0,0 +1,42 @@
+#pragma once
+/* header 8735 */
+#include <vector>
+#include "h9966.h"
+#include "h5472.h"
+#include "h9225.h"
+#include "h7861.h"
+#include "h5232.h"
+#ifdef X
+#include "h3717.h"
+#endif
+struct S8735 { int a; const char *s = "x//y"; };
+inline int f8735_0(int x) { return x * 0; }
+inline int f8735_1(int x) { return x * 1; }
+inline int f8735_2(int x) { return x * 2; }
+inline int f8735_3(int x) { return x * 3; }
+inline int f8735_4(int x) { return x * 4; }
+inline int f8735_5(int x) { return x * 5; }
+inline int f8735_6(int x) { return x * 6; }
+inline int f8735_7(int x) { return x * 7; }
+inline int f8735_8(int x) { return x * 8; }
+inline int f8735_9(int x) { return x * 9; }
+inline int f8735_10(int x) { return x * 10; }
+inline int f8735_11(int x) { return x * 11; }
+inline int f8735_12(int x) { return x * 12; }
+inline int f8735_13(int x) { return x * 13; }
+inline int f8735_14(int x) { return x * 14; }
+inline int f8735_15(int x) { return x * 15; }
+inline int f8735_16(int x) { return x * 16; }
+inline int f8735_17(int x) { return x * 17; }
+inline int f8735_18(int x) { return x * 18; }
+inline int f8735_19(int x) { return x * 19; }
+inline int f8735_20(int x) { return x * 20; }
+inline int f8735_21(int x) { return x * 21; }
+inline int f8735_22(int x) { return x * 22; }
+inline int f8735_23(int x) { return x * 23; }
+inline int f8735_24(int x) { return x * 24; }
+inline int f8735_25(int x) { return x * 25; }
+inline int f8735_26(int x) { return x * 26; }
+inline int f8735_27(int x) { return x * 27; }
+inline int f8735_28(int x) { return x * 28; }
+inline int f8735_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8737 */
+#include <vector>
+#include "h3262.h"
+#include "h8525.h"
+#include "h7396.h"
+#include "h8267.h"
+#include "h4150.h"
+#ifdef X
+#include "h9691.h"
+#endif
+struct S8737 { int a; const char *s = "x//y"; };
+inline int f8737_0(int x) { return x * 0; }
+inline int f8737_1(int x) { return x * 1; }
+inline int f8737_2(int x) { return x * 2; }
+inline int f8737_3(int x) { return x * 3; }
+inline int f8737_4(int x) { return x * 4; }
+inline int f8737_5(int x) { return x * 5; }
+inline int f8737_6(int x) { return x * 6; }
+inline int f8737_7(int x) { return x * 7; }
+inline int f8737_8(int x) { return x * 8; }
+inline int f8737_9(int x) { return x * 9; }
+inline int f8737_10(int x) { return x * 10; }
+inline int f8737_11(int x) { return x * 11; }
+inline int f8737_12(int x) { return x * 12; }
+inline int f8737_13(int x) { return x * 13; }
+inline int f8737_14(int x) { return x * 14; }
+inline int f8737_15(int x) { return x * 15; }
+inline int f8737_16(int x) { return x * 16; }
+inline int f8737_17(int x) { return x * 17; }
+inline int f8737_18(int x) { return x * 18; }
+inline int f8737_19(int x) { return x * 19; }
+inline int f8737_20(int x) { return x * 20; }
+inline int f8737_21(int x) { return x * 21; }
+inline int f8737_22(int x) { return x * 22; }
+inline int f8737_23(int x) { return x * 23; }
+inline int f8737_24(int x) { return x * 24; }
+inline int f8737_25(int x) { return x * 25; }
+inline int f8737_26(int x) { return x * 26; }
+inline int f8737_27(int x) { return x * 27; }
+inline int f8737_28(int x) { return x * 28; }
+inline int f8737_29(int x) { return x * 29; }
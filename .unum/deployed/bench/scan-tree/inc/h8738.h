@@ -0,0 +1,42 @@
+#pragma once
+/* header 8738 */
+#include <vector>
+#include "h9061.h"
+#include "h3736.h"
+#include "h2301.h"
+#include "h480.h"
+#include "h7073.h"
+#ifdef X
+#include "h4815.h"
+#endif
+struct S8738 { int a; const char *s = "x//y"; };
+inline int f8738_0(int x) { return x * 0; }
+inline int f8738_1(int x) { return x * 1; }
+inline int f8738_2(int x) { return x * 2; }
+inline int f8738_3(int x) { return x * 3; }
+inline int f8738_4(int x) { return x * 4; }
+inline int f8738_5(int x) { return x * 5; }
+inline int f8738_6(int x) { return x * 6; }
+inline int f8738_7(int x) { return x * 7; }
+inline int f8738_8(int x) { return x * 8; }
+inline int f8738_9(int x) { return x * 9; }
+inline int f8738_10(int x) { return x * 10; }
+inline int f8738_11(int x) { return x * 11; }
+inline int f8738_12(int x) { return x * 12; }
+inline int f8738_13(int x) { return x * 13; }
+inline int f8738_14(int x) { return x * 14; }
+inline int f8738_15(int x) { return x * 15; }
+inline int f8738_16(int x) { return x * 16; }
+inline int f8738_17(int x) { return x * 17; }
+inline int f8738_18(int x) { return x * 18; }
+inline int f8738_19(int x) { return x * 19; }
+inline int f8738_20(int x) { return x * 20; }
+inline int f8738_21(int x) { return x * 21; }
+inline int f8738_22(int x) { return x * 22; }
+inline int f8738_23(int x) { return x * 23; }
+inline int f8738_24(int x) { return x * 24; }
+inline int f8738_25(int x) { return x * 25; }
+inline int f8738_26(int x) { return x * 26; }
+inline int f8738_27(int x) { return x * 27; }
+inline int f8738_28(int x) { return x * 28; }
+inline int f8738_29(int x) { return x * 29; }
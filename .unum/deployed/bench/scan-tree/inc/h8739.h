@@ -0,0 +1,42 @@
+#pragma once
+/* header 8739 */
+#include <vector>
+#include "h3544.h"
+#include "h9479.h"
+#include "h2489.h"
+#include "h9364.h"
+#include "h4573.h"
+#ifdef X
+#include "h9105.h"
+#endif
+struct S8739 { int a; const char *s = "x//y"; };
+inline int f8739_0(int x) { return x * 0; }
+inline int f8739_1(int x) { return x * 1; }
+inline int f8739_2(int x) { return x * 2; }
+inline int f8739_3(int x) { return x * 3; }
+inline int f8739_4(int x) { return x * 4; }
+inline int f8739_5(int x) { return x * 5; }
+inline int f8739_6(int x) { return x * 6; }
+inline int f8739_7(int x) { return x * 7; }
+inline int f8739_8(int x) { return x * 8; }
+inline int f8739_9(int x) { return x * 9; }
+inline int f8739_10(int x) { return x * 10; }
+inline int f8739_11(int x) { return x * 11; }
+inline int f8739_12(int x) { return x * 12; }
+inline int f8739_13(int x) { return x * 13; }
+inline int f8739_14(int x) { return x * 14; }
+inline int f8739_15(int x) { return x * 15; }
+inline int f8739_16(int x) { return x * 16; }
+inline int f8739_17(int x) { return x * 17; }
+inline int f8739_18(int x) { return x * 18; }
+inline int f8739_19(int x) { return x * 19; }
+inline int f8739_20(int x) { return x * 20; }
+inline int f8739_21(int x) { return x * 21; }
+inline int f8739_22(int x) { return x * 22; }
+inline int f8739_23(int x) { return x * 23; }
+inline int f8739_24(int x) { return x * 24; }
+inline int f8739_25(int x) { return x * 25; }
+inline int f8739_26(int x) { return x * 26; }
+inline int f8739_27(int x) { return x * 27; }
+inline int f8739_28(int x) { return x * 28; }
+inline int f8739_29(int x) { return x * 29; }
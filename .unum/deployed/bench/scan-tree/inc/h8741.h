@@ -0,0 +1,42 @@
+#pragma once
+/* header 8741 */
+#include <vector>
+#include "h4228.h"
+#include "h3873.h"
+#include "h4669.h"
+#include "h8503.h"
+#include "h825.h"
+#ifdef X
+#include "h7455.h"
+#endif
+struct S8741 { int a; const char *s = "x//y"; };
+inline int f8741_0(int x) { return x * 0; }
+inline int f8741_1(int x) { return x * 1; }
+inline int f8741_2(int x) { return x * 2; }
+inline int f8741_3(int x) { return x * 3; }
+inline int f8741_4(int x) { return x * 4; }
+inline int f8741_5(int x) { return x * 5; }
+inline int f8741_6(int x) { return x * 6; }
+inline int f8741_7(int x) { return x * 7; }
+inline int f8741_8(int x) { return x * 8; }
+inline int f8741_9(int x) { return x * 9; }
+inline int f8741_10(int x) { return x * 10; }
+inline int f8741_11(int x) { return x * 11; }
+inline int f8741_12(int x) { return x * 12; }
+inline int f8741_13(int x) { return x * 13; }
+inline int f8741_14(int x) { return x * 14; }
+inline int f8741_15(int x) { return x * 15; }
+inline int f8741_16(int x) { return x * 16; }
+inline int f8741_17(int x) { return x * 17; }
+inline int f8741_18(int x) { return x * 18; }
+inline int f8741_19(int x) { return x * 19; }
+inline int f8741_20(int x) { return x * 20; }
+inline int f8741_21(int x) { return x * 21; }
+inline int f8741_22(int x) { return x * 22; }
+inline int f8741_23(int x) { return x * 23; }
+inline int f8741_24(int x) { return x * 24; }
+inline int f8741_25(int x) { return x * 25; }
+inline int f8741_26(int x) { return x * 26; }
+inline int f8741_27(int x) { return x * 27; }
+inline int f8741_28(int x) { return x * 28; }
+inline int f8741_29(int x) { return x * 29; }
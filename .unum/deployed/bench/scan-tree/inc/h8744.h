@@ -0,0 +1,42 @@
+#pragma once
+/* header 8744 */
+#include <vector>
+#include "h7224.h"
+#include "h3515.h"
+#include "h3593.h"
+#include "h1921.h"
+#include "h9559.h"
+#ifdef X
+#include "h8929.h"
+#endif
+struct S8744 { int a; const char *s = "x//y"; };
+inline int f8744_0(int x) { return x * 0; }
+inline int f8744_1(int x) { return x * 1; }
+inline int f8744_2(int x) { return x * 2; }
+inline int f8744_3(int x) { return x * 3; }
+inline int f8744_4(int x) { return x * 4; }
+inline int f8744_5(int x) { return x * 5; }
+inline int f8744_6(int x) { return x * 6; }
+inline int f8744_7(int x) { return x * 7; }
+inline int f8744_8(int x) { return x * 8; }
+inline int f8744_9(int x) { return x * 9; }
+inline int f8744_10(int x) { return x * 10; }
+inline int f8744_11(int x) { return x * 11; }
+inline int f8744_12(int x) { return x * 12; }
+inline int f8744_13(int x) { return x * 13; }
+inline int f8744_14(int x) { return x * 14; }
+inline int f8744_15(int x) { return x * 15; }
+inline int f8744_16(int x) { return x * 16; }
+inline int f8744_17(int x) { return x * 17; }
+inline int f8744_18(int x) { return x * 18; }
+inline int f8744_19(int x) { return x * 19; }
+inline int f8744_20(int x) { return x * 20; }
+inline int f8744_21(int x) { return x * 21; }
+inline int f8744_22(int x) { return x * 22; }
+inline int f8744_23(int x) { return x * 23; }
+inline int f8744_24(int x) { return x * 24; }
+inline int f8744_25(int x) { return x * 25; }
+inline int f8744_26(int x) { return x * 26; }
+inline int f8744_27(int x) { return x * 27; }
+inline int f8744_28(int x) { return x * 28; }
+inline int f8744_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8745 */
+#include <vector>
+#include "h5564.h"
+#include "h36.h"
+#include "h4592.h"
+#include "h7554.h"
+#include "h8641.h"
+#ifdef X
+#include "h7217.h"
+#endif
+struct S8745 { int a; const char *s = "x//y"; };
+inline int f8745_0(int x) { return x * 0; }
+inline int f8745_1(int x) { return x * 1; }
+inline int f8745_2(int x) { return x * 2; }
+inline int f8745_3(int x) { return x * 3; }
+inline int f8745_4(int x) { return x * 4; }
+inline int f8745_5(int x) { return x * 5; }
+inline int f8745_6(int x) { return x * 6; }
+inline int f8745_7(int x) { return x * 7; }
+inline int f8745_8(int x) { return x * 8; }
+inline int f8745_9(int x) { return x * 9; }
+inline int f8745_10(int x) { return x * 10; }
+inline int f8745_11(int x) { return x * 11; }
+inline int f8745_12(int x) { return x * 12; }
+inline int f8745_13(int x) { return x * 13; }
+inline int f8745_14(int x) { return x * 14; }
+inline int f8745_15(int x) { return x * 15; }
+inline int f8745_16(int x) { return x * 16; }
+inline int f8745_17(int x) { return x * 17; }
+inline int f8745_18(int x) { return x * 18; }
+inline int f8745_19(int x) { return x * 19; }
+inline int f8745_20(int x) { return x * 20; }
+inline int f8745_21(int x) { return x * 21; }
+inline int f8745_22(int x) { return x * 22; }
+inline int f8745_23(int x) { return x * 23; }
+inline int f8745_24(int x) { return x * 24; }
+inline int f8745_25(int x) { return x * 25; }
+inline int f8745_26(int x) { return x * 26; }
+inline int f8745_27(int x) { return x * 27; }
+inline int f8745_28(int x) { return x * 28; }
+inline int f8745_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8746 */
+#include <vector>
+#include "h975.h"
+#include "h7477.h"
+#include "h4053.h"
+#include "h369.h"
+#include "h2193.h"
+#ifdef X
+#include "h2866.h"
+#endif
+struct S8746 { int a; const char *s = "x//y"; };
+inline int f8746_0(int x) { return x * 0; }
+inline int f8746_1(int x) { return x * 1; }
+inline int f8746_2(int x) { return x * 2; }
+inline int f8746_3(int x) { return x * 3; }
+inline int f8746_4(int x) { return x * 4; }
+inline int f8746_5(int x) { return x * 5; }
+inline int f8746_6(int x) { return x * 6; }
+inline int f8746_7(int x) { return x * 7; }
+inline int f8746_8(int x) { return x * 8; }
+inline int f8746_9(int x) { return x * 9; }
+inline int f8746_10(int x) { return x * 10; }
+inline int f8746_11(int x) { return x * 11; }
+inline int f8746_12(int x) { return x * 12; }
+inline int f8746_13(int x) { return x * 13; }
+inline int f8746_14(int x) { return x * 14; }
+inline int f8746_15(int x) { return x * 15; }
+inline int f8746_16(int x) { return x * 16; }
+inline int f8746_17(int x) { return x * 17; }
+inline int f8746_18(int x) { return x * 18; }
+inline int f8746_19(int x) { return x * 19; }
+inline int f8746_20(int x) { return x * 20; }
+inline int f8746_21(int x) { return x * 21; }
+inline int f8746_22(int x) { return x * 22; }
+inline int f8746_23(int x) { return x * 23; }
+inline int f8746_24(int x) { return x * 24; }
+inline int f8746_25(int x) { return x * 25; }
+inline int f8746_26(int x) { return x * 26; }
+inline int f8746_27(int x) { return x * 27; }
+inline int f8746_28(int x) { return x * 28; }
+inline int f8746_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8754 */
+#include <vector>
+#include "h6840.h"
+#include "h9427.h"
+#include "h1659.h"
+#include "h9067.h"
+#include "h1776.h"
+#ifdef X
+#include "h8133.h"
+#endif
+struct S8754 { int a; const char *s = "x//y"; };
+inline int f8754_0(int x) { return x * 0; }
+inline int f8754_1(int x) { return x * 1; }
+inline int f8754_2(int x) { return x * 2; }
+inline int f8754_3(int x) { return x * 3; }
+inline int f8754_4(int x) { return x * 4; }
+inline int f8754_5(int x) { return x * 5; }
+inline int f8754_6(int x) { return x * 6; }
+inline int f8754_7(int x) { return x * 7; }
+inline int f8754_8(int x) { return x * 8; }
+inline int f8754_9(int x) { return x * 9; }
+inline int f8754_10(int x) { return x * 10; }
+inline int f8754_11(int x) { return x * 11; }
+inline int f8754_12(int x) { return x * 12; }
+inline int f8754_13(int x) { return x * 13; }
+inline int f8754_14(int x) { return x * 14; }
+inline int f8754_15(int x) { return x * 15; }
+inline int f8754_16(int x) { return x * 16; }
+inline int f8754_17(int x) { return x * 17; }
+inline int f8754_18(int x) { return x * 18; }
+inline int f8754_19(int x) { return x * 19; }
+inline int f8754_20(int x) { return x * 20; }
+inline int f8754_21(int x) { return x * 21; }
+inline int f8754_22(int x) { return x * 22; }
+inline int f8754_23(int x) { return x * 23; }
+inline int f8754_24(int x) { return x * 24; }
+inline int f8754_25(int x) { return x * 25; }
+inline int f8754_26(int x) { return x * 26; }
+inline int f8754_27(int x) { return x * 27; }
+inline int f8754_28(int x) { return x * 28; }
+inline int f8754_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8756 */
+#include <vector>
+#include "h7396.h"
+#include "h9879.h"
+#include "h2458.h"
+#include "h8994.h"
+#include "h7320.h"
+#ifdef X
+#include "h9682.h"
+#endif
+struct S8756 { int a; const char *s = "x//y"; };
+inline int f8756_0(int x) { return x * 0; }
+inline int f8756_1(int x) { return x * 1; }
+inline int f8756_2(int x) { return x * 2; }
+inline int f8756_3(int x) { return x * 3; }
+inline int f8756_4(int x) { return x * 4; }
+inline int f8756_5(int x) { return x * 5; }
+inline int f8756_6(int x) { return x * 6; }
+inline int f8756_7(int x) { return x * 7; }
+inline int f8756_8(int x) { return x * 8; }
+inline int f8756_9(int x) { return x * 9; }
+inline int f8756_10(int x) { return x * 10; }
+inline int f8756_11(int x) { return x * 11; }
+inline int f8756_12(int x) { return x * 12; }
+inline int f8756_13(int x) { return x * 13; }
+inline int f8756_14(int x) { return x * 14; }
+inline int f8756_15(int x) { return x * 15; }
+inline int f8756_16(int x) { return x * 16; }
+inline int f8756_17(int x) { return x * 17; }
+inline int f8756_18(int x) { return x * 18; }
+inline int f8756_19(int x) { return x * 19; }
+inline int f8756_20(int x) { return x * 20; }
+inline int f8756_21(int x) { return x * 21; }
+inline int f8756_22(int x) { return x * 22; }
+inline int f8756_23(int x) { return x * 23; }
+inline int f8756_24(int x) { return x * 24; }
+inline int f8756_25(int x) { return x * 25; }
+inline int f8756_26(int x) { return x * 26; }
+inline int f8756_27(int x) { return x * 27; }
+inline int f8756_28(int x) { return x * 28; }
+inline int f8756_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8760 */
+#include <vector>
+#include "h8352.h"
+#include "h2477.h"
+#include "h3340.h"
+#include "h4263.h"
+#include "h5350.h"
+#ifdef X
+#include "h7686.h"
+#endif
+struct S8760 { int a; const char *s = "x//y"; };
+inline int f8760_0(int x) { return x * 0; }
+inline int f8760_1(int x) { return x * 1; }
+inline int f8760_2(int x) { return x * 2; }
+inline int f8760_3(int x) { return x * 3; }
+inline int f8760_4(int x) { return x * 4; }
+inline int f8760_5(int x) { return x * 5; }
+inline int f8760_6(int x) { return x * 6; }
+inline int f8760_7(int x) { return x * 7; }
+inline int f8760_8(int x) { return x * 8; }
+inline int f8760_9(int x) { return x * 9; }
+inline int f8760_10(int x) { return x * 10; }
+inline int f8760_11(int x) { return x * 11; }
+inline int f8760_12(int x) { return x * 12; }
+inline int f8760_13(int x) { return x * 13; }
+inline int f8760_14(int x) { return x * 14; }
+inline int f8760_15(int x) { return x * 15; }
+inline int f8760_16(int x) { return x * 16; }
+inline int f8760_17(int x) { return x * 17; }
+inline int f8760_18(int x) { return x * 18; }
+inline int f8760_19(int x) { return x * 19; }
+inline int f8760_20(int x) { return x * 20; }
+inline int f8760_21(int x) { return x * 21; }
+inline int f8760_22(int x) { return x * 22; }
+inline int f8760_23(int x) { return x * 23; }
+inline int f8760_24(int x) { return x * 24; }
+inline int f8760_25(int x) { return x * 25; }
+inline int f8760_26(int x) { return x * 26; }
+inline int f8760_27(int x) { return x * 27; }
+inline int f8760_28(int x) { return x * 28; }
+inline int f8760_29(int x) { return x * 29; }
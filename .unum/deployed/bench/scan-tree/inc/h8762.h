@@ -0,0 +1,42 @@
+#pragma once
+/* header 8762 */
+#include <vector>
+#include "h3867.h"
+#include "h590.h"
+#include "h9356.h"
+#include "h358.h"
+#include "h3699.h"
+#ifdef X
+#include "h790.h"
+#endif
+struct S8762 { int a; const char *s = "x//y"; };
+inline int f8762_0(int x) { return x * 0; }
+inline int f8762_1(int x) { return x * 1; }
+inline int f8762_2(int x) { return x * 2; }
+inline int f8762_3(int x) { return x * 3; }
+inline int f8762_4(int x) { return x * 4; }
+inline int f8762_5(int x) { return x * 5; }
+inline int f8762_6(int x) { return x * 6; }
+inline int f8762_7(int x) { return x * 7; }
+inline int f8762_8(int x) { return x * 8; }
+inline int f8762_9(int x) { return x * 9; }
+inline int f8762_10(int x) { return x * 10; }
+inline int f8762_11(int x) { return x * 11; }
+inline int f8762_12(int x) { return x * 12; }
+inline int f8762_13(int x) { return x * 13; }
+inline int f8762_14(int x) { return x * 14; }
+inline int f8762_15(int x) { return x * 15; }
+inline int f8762_16(int x) { return x * 16; }
+inline int f8762_17(int x) { return x * 17; }
+inline int f8762_18(int x) { return x * 18; }
+inline int f8762_19(int x) { return x * 19; }
+inline int f8762_20(int x) { return x * 20; }
+inline int f8762_21(int x) { return x * 21; }
+inline int f8762_22(int x) { return x * 22; }
+inline int f8762_23(int x) { return x * 23; }
+inline int f8762_24(int x) { return x * 24; }
+inline int f8762_25(int x) { return x * 25; }
+inline int f8762_26(int x) { return x * 26; }
+inline int f8762_27(int x) { return x * 27; }
+inline int f8762_28(int x) { return x * 28; }
+inline int f8762_29(int x) { return x * 29; }
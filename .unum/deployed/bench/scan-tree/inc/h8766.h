@@ -0,0 +1,42 @@
+#pragma once
+/* header 8766 */
+#include <vector>
+#include "h1935.h"
+#include "h1099.h"
+#include "h6522.h"
+#include "h9822.h"
+#include "h3656.h"
+#ifdef X
+#include "h5451.h"
+#endif
+struct S8766 { int a; const char *s = "x//y"; };
+inline int f8766_0(int x) { return x * 0; }
+inline int f8766_1(int x) { return x * 1; }
+inline int f8766_2(int x) { return x * 2; }
+inline int f8766_3(int x) { return x * 3; }
+inline int f8766_4(int x) { return x * 4; }
+inline int f8766_5(int x) { return x * 5; }
+inline int f8766_6(int x) { return x * 6; }
+inline int f8766_7(int x) { return x * 7; }
+inline int f8766_8(int x) { return x * 8; }
+inline int f8766_9(int x) { return x * 9; }
+inline int f8766_10(int x) { return x * 10; }
+inline int f8766_11(int x) { return x * 11; }
+inline int f8766_12(int x) { return x * 12; }
+inline int f8766_13(int x) { return x * 13; }
+inline int f8766_14(int x) { return x * 14; }
+inline int f8766_15(int x) { return x * 15; }
+inline int f8766_16(int x) { return x * 16; }
+inline int f8766_17(int x) { return x * 17; }
+inline int f8766_18(int x) { return x * 18; }
+inline int f8766_19(int x) { return x * 19; }
+inline int f8766_20(int x) { return x * 20; }
+inline int f8766_21(int x) { return x * 21; }
+inline int f8766_22(int x) { return x * 22; }
+inline int f8766_23(int x) { return x * 23; }
+inline int f8766_24(int x) { return x * 24; }
+inline int f8766_25(int x) { return x * 25; }
+inline int f8766_26(int x) { return x * 26; }
+inline int f8766_27(int x) { return x * 27; }
+inline int f8766_28(int x) { return x * 28; }
+inline int f8766_29(int x) { return x * 29; }
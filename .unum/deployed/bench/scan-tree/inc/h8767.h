@@ -0,0 +1,42 @@
+#pragma once
+/* header 8767 */
+#include <vector>
+#include "h2235.h"
+#include "h6725.h"
+#include "h2159.h"
+#include "h1345.h"
+#include "h4855.h"
+#ifdef X
+#include "h6652.h"
+#endif
+struct S8767 { int a; const char *s = "x//y"; };
+inline int f8767_0(int x) { return x * 0; }
+inline int f8767_1(int x) { return x * 1; }
+inline int f8767_2(int x) { return x * 2; }
+inline int f8767_3(int x) { return x * 3; }
+inline int f8767_4(int x) { return x * 4; }
+inline int f8767_5(int x) { return x * 5; }
+inline int f8767_6(int x) { return x * 6; }
+inline int f8767_7(int x) { return x * 7; }
+inline int f8767_8(int x) { return x * 8; }
+inline int f8767_9(int x) { return x * 9; }
+inline int f8767_10(int x) { return x * 10; }
+inline int f8767_11(int x) { return x * 11; }
+inline int f8767_12(int x) { return x * 12; }
+inline int f8767_13(int x) { return x * 13; }
+inline int f8767_14(int x) { return x * 14; }
+inline int f8767_15(int x) { return x * 15; }
+inline int f8767_16(int x) { return x * 16; }
+inline int f8767_17(int x) { return x * 17; }
+inline int f8767_18(int x) { return x * 18; }
+inline int f8767_19(int x) { return x * 19; }
+inline int f8767_20(int x) { return x * 20; }
+inline int f8767_21(int x) { return x * 21; }
+inline int f8767_22(int x) { return x * 22; }
+inline int f8767_23(int x) { return x * 23; }
+inline int f8767_24(int x) { return x * 24; }
+inline int f8767_25(int x) { return x * 25; }
+inline int f8767_26(int x) { return x * 26; }
+inline int f8767_27(int x) { return x * 27; }
+inline int f8767_28(int x) { return x * 28; }
+inline int f8767_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8770 */
+#include <vector>
+#include "h7461.h"
+#include "h3026.h"
+#include "h2148.h"
+#include "h7725.h"
+#include "h2833.h"
+#ifdef X
+#include "h6077.h"
+#endif
+struct S8770 { int a; const char *s = "x//y"; };
+inline int f8770_0(int x) { return x * 0; }
+inline int f8770_1(int x) { return x * 1; }
+inline int f8770_2(int x) { return x * 2; }
+inline int f8770_3(int x) { return x * 3; }
+inline int f8770_4(int x) { return x * 4; }
+inline int f8770_5(int x) { return x * 5; }
+inline int f8770_6(int x) { return x * 6; }
+inline int f8770_7(int x) { return x * 7; }
+inline int f8770_8(int x) { return x * 8; }
+inline int f8770_9(int x) { return x * 9; }
+inline int f8770_10(int x) { return x * 10; }
+inline int f8770_11(int x) { return x * 11; }
+inline int f8770_12(int x) { return x * 12; }
+inline int f8770_13(int x) { return x * 13; }
+inline int f8770_14(int x) { return x * 14; }
+inline int f8770_15(int x) { return x * 15; }
+inline int f8770_16(int x) { return x * 16; }
+inline int f8770_17(int x) { return x * 17; }
+inline int f8770_18(int x) { return x * 18; }
+inline int f8770_19(int x) { return x * 19; }
+inline int f8770_20(int x) { return x * 20; }
+inline int f8770_21(int x) { return x * 21; }
+inline int f8770_22(int x) { return x * 22; }
+inline int f8770_23(int x) { return x * 23; }
+inline int f8770_24(int x) { return x * 24; }
+inline int f8770_25(int x) { return x * 25; }
+inline int f8770_26(int x) { return x * 26; }
+inline int f8770_27(int x) { return x * 27; }
+inline int f8770_28(int x) { return x * 28; }
+inline int f8770_29(int x) { return x * 29; }
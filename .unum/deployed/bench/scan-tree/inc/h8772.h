@@ -0,0 +1,42 @@
+#pragma once
+/* header 8772 */
+#include <vector>
+#include "h6020.h"
+#include "h2613.h"
+#include "h8807.h"
+#include "h5730.h"
+#include "h4533.h"
+#ifdef X
+#include "h5510.h"
+#endif
+struct S8772 { int a; const char *s = "x//y"; };
+inline int f8772_0(int x) { return x * 0; }
+inline int f8772_1(int x) { return x * 1; }
+inline int f8772_2(int x) { return x * 2; }
+inline int f8772_3(int x) { return x * 3; }
+inline int f8772_4(int x) { return x * 4; }
+inline int f8772_5(int x) { return x * 5; }
+inline int f8772_6(int x) { return x * 6; }
+inline int f8772_7(int x) { return x * 7; }
+inline int f8772_8(int x) { return x * 8; }
+inline int f8772_9(int x) { return x * 9; }
+inline int f8772_10(int x) { return x * 10; }
+inline int f8772_11(int x) { return x * 11; }
+inline int f8772_12(int x) { return x * 12; }
+inline int f8772_13(int x) { return x * 13; }
+inline int f8772_14(int x) { return x * 14; }
+inline int f8772_15(int x) { return x * 15; }
+inline int f8772_16(int x) { return x * 16; }
+inline int f8772_17(int x) { return x * 17; }
+inline int f8772_18(int x) { return x * 18; }
+inline int f8772_19(int x) { return x * 19; }
+inline int f8772_20(int x) { return x * 20; }
+inline int f8772_21(int x) { return x * 21; }
+inline int f8772_22(int x) { return x * 22; }
+inline int f8772_23(int x) { return x * 23; }
+inline int f8772_24(int x) { return x * 24; }
+inline int f8772_25(int x) { return x * 25; }
+inline int f8772_26(int x) { return x * 26; }
+inline int f8772_27(int x) { return x * 27; }
+inline int f8772_28(int x) { return x * 28; }
+inline int f8772_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8774 */
+#include <vector>
+#include "h7701.h"
+#include "h8818.h"
+#include "h5474.h"
+#include "h3785.h"
+#include "h2380.h"
+#ifdef X
+#include "h7130.h"
+#endif
+struct S8774 { int a; const char *s = "x//y"; };
+inline int f8774_0(int x) { return x * 0; }
+inline int f8774_1(int x) { return x * 1; }
+inline int f8774_2(int x) { return x * 2; }
+inline int f8774_3(int x) { return x * 3; }
+inline int f8774_4(int x) { return x * 4; }
+inline int f8774_5(int x) { return x * 5; }
+inline int f8774_6(int x) { return x * 6; }
+inline int f8774_7(int x) { return x * 7; }
+inline int f8774_8(int x) { return x * 8; }
+inline int f8774_9(int x) { return x * 9; }
+inline int f8774_10(int x) { return x * 10; }
+inline int f8774_11(int x) { return x * 11; }
+inline int f8774_12(int x) { return x * 12; }
+inline int f8774_13(int x) { return x * 13; }
+inline int f8774_14(int x) { return x * 14; }
+inline int f8774_15(int x) { return x * 15; }
+inline int f8774_16(int x) { return x * 16; }
+inline int f8774_17(int x) { return x * 17; }
+inline int f8774_18(int x) { return x * 18; }
+inline int f8774_19(int x) { return x * 19; }
+inline int f8774_20(int x) { return x * 20; }
+inline int f8774_21(int x) { return x * 21; }
+inline int f8774_22(int x) { return x * 22; }
+inline int f8774_23(int x) { return x * 23; }
+inline int f8774_24(int x) { return x * 24; }
+inline int f8774_25(int x) { return x * 25; }
+inline int f8774_26(int x) { return x * 26; }
+inline int f8774_27(int x) { return x * 27; }
+inline int f8774_28(int x) { return x * 28; }
+inline int f8774_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8775 */
+#include <vector>
+#include "h5312.h"
+#include "h6619.h"
+#include "h3236.h"
+#include "h6723.h"
+#include "h8374.h"
+#ifdef X
+#include "h1477.h"
+#endif
+struct S8775 { int a; const char *s = "x//y"; };
+inline int f8775_0(int x) { return x * 0; }
+inline int f8775_1(int x) { return x * 1; }
+inline int f8775_2(int x) { return x * 2; }
+inline int f8775_3(int x) { return x * 3; }
+inline int f8775_4(int x) { return x * 4; }
+inline int f8775_5(int x) { return x * 5; }
+inline int f8775_6(int x) { return x * 6; }
+inline int f8775_7(int x) { return x * 7; }
+inline int f8775_8(int x) { return x * 8; }
+inline int f8775_9(int x) { return x * 9; }
+inline int f8775_10(int x) { return x * 10; }
+inline int f8775_11(int x) { return x * 11; }
+inline int f8775_12(int x) { return x * 12; }
+inline int f8775_13(int x) { return x * 13; }
+inline int f8775_14(int x) { return x * 14; }
+inline int f8775_15(int x) { return x * 15; }
+inline int f8775_16(int x) { return x * 16; }
+inline int f8775_17(int x) { return x * 17; }
+inline int f8775_18(int x) { return x * 18; }
+inline int f8775_19(int x) { return x * 19; }
+inline int f8775_20(int x) { return x * 20; }
+inline int f8775_21(int x) { return x * 21; }
+inline int f8775_22(int x) { return x * 22; }
+inline int f8775_23(int x) { return x * 23; }
+inline int f8775_24(int x) { return x * 24; }
+inline int f8775_25(int x) { return x * 25; }
+inline int f8775_26(int x) { return x * 26; }
+inline int f8775_27(int x) { return x * 27; }
+inline int f8775_28(int x) { return x * 28; }
+inline int f8775_29(int x) { return x * 29; }
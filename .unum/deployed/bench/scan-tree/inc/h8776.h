@@ -0,0 +1,42 @@
+#pragma once
+/* header 8776 */
+#include <vector>
+#include "h8202.h"
+#include "h5159.h"
+#include "h1813.h"
+#include "h4590.h"
+#include "h713.h"
+#ifdef X
+#include "h9205.h"
+#endif
+struct S8776 { int a; const char *s = "x//y"; };
+inline int f8776_0(int x) { return x * 0; }
+inline int f8776_1(int x) { return x * 1; }
+inline int f8776_2(int x) { return x * 2; }
+inline int f8776_3(int x) { return x * 3; }
+inline int f8776_4(int x) { return x * 4; }
+inline int f8776_5(int x) { return x * 5; }
+inline int f8776_6(int x) { return x * 6; }
+inline int f8776_7(int x) { return x * 7; }
+inline int f8776_8(int x) { return x * 8; }
+inline int f8776_9(int x) { return x * 9; }
+inline int f8776_10(int x) { return x * 10; }
+inline int f8776_11(int x) { return x * 11; }
+inline int f8776_12(int x) { return x * 12; }
+inline int f8776_13(int x) { return x * 13; }
+inline int f8776_14(int x) { return x * 14; }
+inline int f8776_15(int x) { return x * 15; }
+inline int f8776_16(int x) { return x * 16; }
+inline int f8776_17(int x) { return x * 17; }
+inline int f8776_18(int x) { return x * 18; }
+inline int f8776_19(int x) { return x * 19; }
+inline int f8776_20(int x) { return x * 20; }
+inline int f8776_21(int x) { return x * 21; }
+inline int f8776_22(int x) { return x * 22; }
+inline int f8776_23(int x) { return x * 23; }
+inline int f8776_24(int x) { return x * 24; }
+inline int f8776_25(int x) { return x * 25; }
+inline int f8776_26(int x) { return x * 26; }
+inline int f8776_27(int x) { return x * 27; }
+inline int f8776_28(int x) { return x * 28; }
+inline int f8776_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8778 */
+#include <vector>
+#include "h9297.h"
+#include "h2960.h"
+#include "h2861.h"
+#include "h9114.h"
+#include "h808.h"
+#ifdef X
+#include "h4421.h"
+#endif
+struct S8778 { int a; const char *s = "x//y"; };
+inline int f8778_0(int x) { return x * 0; }
+inline int f8778_1(int x) { return x * 1; }
+inline int f8778_2(int x) { return x * 2; }
+inline int f8778_3(int x) { return x * 3; }
+inline int f8778_4(int x) { return x * 4; }
+inline int f8778_5(int x) { return x * 5; }
+inline int f8778_6(int x) { return x * 6; }
+inline int f8778_7(int x) { return x * 7; }
+inline int f8778_8(int x) { return x * 8; }
+inline int f8778_9(int x) { return x * 9; }
+inline int f8778_10(int x) { return x * 10; }
+inline int f8778_11(int x) { return x * 11; }
+inline int f8778_12(int x) { return x * 12; }
+inline int f8778_13(int x) { return x * 13; }
+inline int f8778_14(int x) { return x * 14; }
+inline int f8778_15(int x) { return x * 15; }
+inline int f8778_16(int x) { return x * 16; }
+inline int f8778_17(int x) { return x * 17; }
+inline int f8778_18(int x) { return x * 18; }
+inline int f8778_19(int x) { return x * 19; }
+inline int f8778_20(int x) { return x * 20; }
+inline int f8778_21(int x) { return x * 21; }
+inline int f8778_22(int x) { return x * 22; }
+inline int f8778_23(int x) { return x * 23; }
+inline int f8778_24(int x) { return x * 24; }
+inline int f8778_25(int x) { return x * 25; }
+inline int f8778_26(int x) { return x * 26; }
+inline int f8778_27(int x) { return x * 27; }
+inline int f8778_28(int x) { return x * 28; }
+inline int f8778_29(int x) { return x * 29; }
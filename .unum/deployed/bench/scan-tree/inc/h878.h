@@ -0,0 +1,42 @@
+#pragma once
+/* header 878 */
+#include <vector>
+#include "h8885.h"
+#include "h761.h"
+#include "h8003.h"
+#include "h6705.h"
+#include "h3442.h"
+#ifdef X
+#include "h4642.h"
+#endif
+struct S878 { int a; const char *s = "x//y"; };
+inline int f878_0(int x) { return x * 0; }
+inline int f878_1(int x) { return x * 1; }
+inline int f878_2(int x) { return x * 2; }
+inline int f878_3(int x) { return x * 3; }
+inline int f878_4(int x) { return x * 4; }
+inline int f878_5(int x) { return x * 5; }
+inline int f878_6(int x) { return x * 6; }
+inline int f878_7(int x) { return x * 7; }
+inline int f878_8(int x) { return x * 8; }
+inline int f878_9(int x) { return x * 9; }
+inline int f878_10(int x) { return x * 10; }
+inline int f878_11(int x) { return x * 11; }
+inline int f878_12(int x) { return x * 12; }
+inline int f878_13(int x) { return x * 13; }
+inline int f878_14(int x) { return x * 14; }
+inline int f878_15(int x) { return x * 15; }
+inline int f878_16(int x) { return x * 16; }
+inline int f878_17(int x) { return x * 17; }
+inline int f878_18(int x) { return x * 18; }
+inline int f878_19(int x) { return x * 19; }
+inline int f878_20(int x) { return x * 20; }
+inline int f878_21(int x) { return x * 21; }
+inline int f878_22(int x) { return x * 22; }
+inline int f878_23(int x) { return x * 23; }
+inline int f878_24(int x) { return x * 24; }
+inline int f878_25(int x) { return x * 25; }
+inline int f878_26(int x) { return x * 26; }
+inline int f878_27(int x) { return x * 27; }
+inline int f878_28(int x) { return x * 28; }
+inline int f878_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8781 */
+#include <vector>
+#include "h6152.h"
+#include "h9366.h"
+#include "h66.h"
+#include "h5179.h"
+#include "h6800.h"
+#ifdef X
+#include "h9267.h"
+#endif
+struct S8781 { int a; const char *s = "x//y"; };
+inline int f8781_0(int x) { return x * 0; }
+inline int f8781_1(int x) { return x * 1; }
+inline int f8781_2(int x) { return x * 2; }
+inline int f8781_3(int x) { return x * 3; }
+inline int f8781_4(int x) { return x * 4; }
+inline int f8781_5(int x) { return x * 5; }
+inline int f8781_6(int x) { return x * 6; }
+inline int f8781_7(int x) { return x * 7; }
+inline int f8781_8(int x) { return x * 8; }
+inline int f8781_9(int x) { return x * 9; }
+inline int f8781_10(int x) { return x * 10; }
+inline int f8781_11(int x) { return x * 11; }
+inline int f8781_12(int x) { return x * 12; }
+inline int f8781_13(int x) { return x * 13; }
+inline int f8781_14(int x) { return x * 14; }
+inline int f8781_15(int x) { return x * 15; }
+inline int f8781_16(int x) { return x * 16; }
+inline int f8781_17(int x) { return x * 17; }
+inline int f8781_18(int x) { return x * 18; }
+inline int f8781_19(int x) { return x * 19; }
+inline int f8781_20(int x) { return x * 20; }
+inline int f8781_21(int x) { return x * 21; }
+inline int f8781_22(int x) { return x * 22; }
+inline int f8781_23(int x) { return x * 23; }
+inline int f8781_24(int x) { return x * 24; }
+inline int f8781_25(int x) { return x * 25; }
+inline int f8781_26(int x) { return x * 26; }
+inline int f8781_27(int x) { return x * 27; }
+inline int f8781_28(int x) { return x * 28; }
+inline int f8781_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8782 */
+#include <vector>
+#include "h6756.h"
+#include "h4780.h"
+#include "h5121.h"
+#include "h6828.h"
+#include "h2242.h"
+#ifdef X
+#include "h1253.h"
+#endif
+struct S8782 { int a; const char *s = "x//y"; };
+inline int f8782_0(int x) { return x * 0; }
+inline int f8782_1(int x) { return x * 1; }
+inline int f8782_2(int x) { return x * 2; }
+inline int f8782_3(int x) { return x * 3; }
+inline int f8782_4(int x) { return x * 4; }
+inline int f8782_5(int x) { return x * 5; }
+inline int f8782_6(int x) { return x * 6; }
+inline int f8782_7(int x) { return x * 7; }
+inline int f8782_8(int x) { return x * 8; }
+inline int f8782_9(int x) { return x * 9; }
+inline int f8782_10(int x) { return x * 10; }
+inline int f8782_11(int x) { return x * 11; }
+inline int f8782_12(int x) { return x * 12; }
+inline int f8782_13(int x) { return x * 13; }
+inline int f8782_14(int x) { return x * 14; }
+inline int f8782_15(int x) { return x * 15; }
+inline int f8782_16(int x) { return x * 16; }
+inline int f8782_17(int x) { return x * 17; }
+inline int f8782_18(int x) { return x * 18; }
+inline int f8782_19(int x) { return x * 19; }
+inline int f8782_20(int x) { return x * 20; }
+inline int f8782_21(int x) { return x * 21; }
+inline int f8782_22(int x) { return x * 22; }
+inline int f8782_23(int x) { return x * 23; }
+inline int f8782_24(int x) { return x * 24; }
+inline int f8782_25(int x) { return x * 25; }
+inline int f8782_26(int x) { return x * 26; }
+inline int f8782_27(int x) { return x * 27; }
+inline int f8782_28(int x) { return x * 28; }
+inline int f8782_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8785 */
+#include <vector>
+#include "h3570.h"
+#include "h3930.h"
+#include "h2182.h"
+#include "h9363.h"
+#include "h7902.h"
+#ifdef X
+#include "h7276.h"
+#endif
+struct S8785 { int a; const char *s = "x//y"; };
+inline int f8785_0(int x) { return x * 0; }
+inline int f8785_1(int x) { return x * 1; }
+inline int f8785_2(int x) { return x * 2; }
+inline int f8785_3(int x) { return x * 3; }
+inline int f8785_4(int x) { return x * 4; }
+inline int f8785_5(int x) { return x * 5; }
+inline int f8785_6(int x) { return x * 6; }
+inline int f8785_7(int x) { return x * 7; }
+inline int f8785_8(int x) { return x * 8; }
+inline int f8785_9(int x) { return x * 9; }
+inline int f8785_10(int x) { return x * 10; }
+inline int f8785_11(int x) { return x * 11; }
+inline int f8785_12(int x) { return x * 12; }
+inline int f8785_13(int x) { return x * 13; }
+inline int f8785_14(int x) { return x * 14; }
+inline int f8785_15(int x) { return x * 15; }
+inline int f8785_16(int x) { return x * 16; }
+inline int f8785_17(int x) { return x * 17; }
+inline int f8785_18(int x) { return x * 18; }
+inline int f8785_19(int x) { return x * 19; }
+inline int f8785_20(int x) { return x * 20; }
+inline int f8785_21(int x) { return x * 21; }
+inline int f8785_22(int x) { return x * 22; }
+inline int f8785_23(int x) { return x * 23; }
+inline int f8785_24(int x) { return x * 24; }
+inline int f8785_25(int x) { return x * 25; }
+inline int f8785_26(int x) { return x * 26; }
+inline int f8785_27(int x) { return x * 27; }
+inline int f8785_28(int x) { return x * 28; }
+inline int f8785_29(int x) { return x * 29; }
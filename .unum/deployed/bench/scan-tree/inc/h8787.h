@@ -0,0 +1,42 @@
+#pragma once
+/* header 8787 */
+#include <vector>
+#include "h4019.h"
+#include "h6492.h"
+#include "h4127.h"
+#include "h7455.h"
+#include "h9758.h"
+#ifdef X
+#include "h6896.h"
+#endif
+struct S8787 { int a; const char *s = "x//y"; };
+inline int f8787_0(int x) { return x * 0; }
+inline int f8787_1(int x) { return x * 1; }
+inline int f8787_2(int x) { return x * 2; }
+inline int f8787_3(int x) { return x * 3; }
+inline int f8787_4(int x) { return x * 4; }
+inline int f8787_5(int x) { return x * 5; }
+inline int f8787_6(int x) { return x * 6; }
+inline int f8787_7(int x) { return x * 7; }
+inline int f8787_8(int x) { return x * 8; }
+inline int f8787_9(int x) { return x * 9; }
+inline int f8787_10(int x) { return x * 10; }
+inline int f8787_11(int x) { return x * 11; }
+inline int f8787_12(int x) { return x * 12; }
+inline int f8787_13(int x) { return x * 13; }
+inline int f8787_14(int x) { return x * 14; }
+inline int f8787_15(int x) { return x * 15; }
+inline int f8787_16(int x) { return x * 16; }
+inline int f8787_17(int x) { return x * 17; }
+inline int f8787_18(int x) { return x * 18; }
+inline int f8787_19(int x) { return x * 19; }
+inline int f8787_20(int x) { return x * 20; }
+inline int f8787_21(int x) { return x * 21; }
+inline int f8787_22(int x) { return x * 22; }
+inline int f8787_23(int x) { return x * 23; }
+inline int f8787_24(int x) { return x * 24; }
+inline int f8787_25(int x) { return x * 25; }
+inline int f8787_26(int x) { return x * 26; }
+inline int f8787_27(int x) { return x * 27; }
+inline int f8787_28(int x) { return x * 28; }
+inline int f8787_29(int x) { return x * 29; }
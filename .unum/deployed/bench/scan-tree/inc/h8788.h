@@ -0,0 +1,42 @@
+#pragma once
+/* header 8788 */
+#include <vector>
+#include "h1454.h"
+#include "h8679.h"
+#include "h5501.h"
+#include "h2483.h"
+#include "h8505.h"
+#ifdef X
+#include "h2803.h"
+#endif
+struct S8788 { int a; const char *s = "x//y"; };
+inline int f8788_0(int x) { return x * 0; }
+inline int f8788_1(int x) { return x * 1; }
+inline int f8788_2(int x) { return x * 2; }
+inline int f8788_3(int x) { return x * 3; }
+inline int f8788_4(int x) { return x * 4; }
+inline int f8788_5(int x) { return x * 5; }
+inline int f8788_6(int x) { return x * 6; }
+inline int f8788_7(int x) { return x * 7; }
+inline int f8788_8(int x) { return x * 8; }
+inline int f8788_9(int x) { return x * 9; }
+inline int f8788_10(int x) { return x * 10; }
+inline int f8788_11(int x) { return x * 11; }
+inline int f8788_12(int x) { return x * 12; }
+inline int f8788_13(int x) { return x * 13; }
+inline int f8788_14(int x) { return x * 14; }
+inline int f8788_15(int x) { return x * 15; }
+inline int f8788_16(int x) { return x * 16; }
+inline int f8788_17(int x) { return x * 17; }
+inline int f8788_18(int x) { return x * 18; }
+inline int f8788_19(int x) { return x * 19; }
+inline int f8788_20(int x) { return x * 20; }
+inline int f8788_21(int x) { return x * 21; }
+inline int f8788_22(int x) { return x * 22; }
+inline int f8788_23(int x) { return x * 23; }
+inline int f8788_24(int x) { return x * 24; }
+inline int f8788_25(int x) { return x * 25; }
+inline int f8788_26(int x) { return x * 26; }
+inline int f8788_27(int x) { return x * 27; }
+inline int f8788_28(int x) { return x * 28; }
+inline int f8788_29(int x) { return x * 29; }
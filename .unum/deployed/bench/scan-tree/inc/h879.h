@@ -0,0 +1,42 @@
+#pragma once
+/* header 879 */
+#include <vector>
+#include "h1289.h"
+#include "h3782.h"
+#include "h570.h"
+#include "h3092.h"
+#include "h8483.h"
+#ifdef X
+#include "h7060.h"
+#endif
+struct S879 { int a; const char *s = "x//y"; };
+inline int f879_0(int x) { return x * 0; }
+inline int f879_1(int x) { return x * 1; }
+inline int f879_2(int x) { return x * 2; }
+inline int f879_3(int x) { return x * 3; }
+inline int f879_4(int x) { return x * 4; }
+inline int f879_5(int x) { return x * 5; }
+inline int f879_6(int x) { return x * 6; }
+inline int f879_7(int x) { return x * 7; }
+inline int f879_8(int x) { return x * 8; }
+inline int f879_9(int x) { return x * 9; }
+inline int f879_10(int x) { return x * 10; }
+inline int f879_11(int x) { return x * 11; }
+inline int f879_12(int x) { return x * 12; }
+inline int f879_13(int x) { return x * 13; }
+inline int f879_14(int x) { return x * 14; }
+inline int f879_15(int x) { return x * 15; }
+inline int f879_16(int x) { return x * 16; }
+inline int f879_17(int x) { return x * 17; }
+inline int f879_18(int x) { return x * 18; }
+inline int f879_19(int x) { return x * 19; }
+inline int f879_20(int x) { return x * 20; }
+inline int f879_21(int x) { return x * 21; }
+inline int f879_22(int x) { return x * 22; }
+inline int f879_23(int x) { return x * 23; }
+inline int f879_24(int x) { return x * 24; }
+inline int f879_25(int x) { return x * 25; }
+inline int f879_26(int x) { return x * 26; }
+inline int f879_27(int x) { return x * 27; }
+inline int f879_28(int x) { return x * 28; }
+inline int f879_29(int x) { return x * 29; }
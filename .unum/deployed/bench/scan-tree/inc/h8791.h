@@ -0,0 +1,42 @@
+#pragma once
+/* header 8791 */
+#include <vector>
+#include "h2267.h"
+#include "h5984.h"
+#include "h9762.h"
+#include "h2926.h"
+#include "h7166.h"
+#ifdef X
+#include "h9042.h"
+#endif
+struct S8791 { int a; const char *s = "x//y"; };
+inline int f8791_0(int x) { return x * 0; }
+inline int f8791_1(int x) { return x * 1; }
+inline int f8791_2(int x) { return x * 2; }
+inline int f8791_3(int x) { return x * 3; }
+inline int f8791_4(int x) { return x * 4; }
+inline int f8791_5(int x) { return x * 5; }
+inline int f8791_6(int x) { return x * 6; }
+inline int f8791_7(int x) { return x * 7; }
+inline int f8791_8(int x) { return x * 8; }
+inline int f8791_9(int x) { return x * 9; }
+inline int f8791_10(int x) { return x * 10; }
+inline int f8791_11(int x) { return x * 11; }
+inline int f8791_12(int x) { return x * 12; }
+inline int f8791_13(int x) { return x * 13; }
+inline int f8791_14(int x) { return x * 14; }
+inline int f8791_15(int x) { return x * 15; }
+inline int f8791_16(int x) { return x * 16; }
+inline int f8791_17(int x) { return x * 17; }
+inline int f8791_18(int x) { return x * 18; }
+inline int f8791_19(int x) { return x * 19; }
+inline int f8791_20(int x) { return x * 20; }
+inline int f8791_21(int x) { return x * 21; }
+inline int f8791_22(int x) { return x * 22; }
+inline int f8791_23(int x) { return x * 23; }
+inline int f8791_24(int x) { return x * 24; }
+inline int f8791_25(int x) { return x * 25; }
+inline int f8791_26(int x) { return x * 26; }
+inline int f8791_27(int x) { return x * 27; }
+inline int f8791_28(int x) { return x * 28; }
+inline int f8791_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8792 */
+#include <vector>
+#include "h3378.h"
+#include "h1467.h"
+#include "h2066.h"
+#include "h8283.h"
+#include "h2195.h"
+#ifdef X
+#include "h9426.h"
+#endif
+struct S8792 { int a; const char *s = "x//y"; };
+inline int f8792_0(int x) { return x * 0; }
+inline int f8792_1(int x) { return x * 1; }
+inline int f8792_2(int x) { return x * 2; }
+inline int f8792_3(int x) { return x * 3; }
+inline int f8792_4(int x) { return x * 4; }
+inline int f8792_5(int x) { return x * 5; }
+inline int f8792_6(int x) { return x * 6; }
+inline int f8792_7(int x) { return x * 7; }
+inline int f8792_8(int x) { return x * 8; }
+inline int f8792_9(int x) { return x * 9; }
+inline int f8792_10(int x) { return x * 10; }
+inline int f8792_11(int x) { return x * 11; }
+inline int f8792_12(int x) { return x * 12; }
+inline int f8792_13(int x) { return x * 13; }
+inline int f8792_14(int x) { return x * 14; }
+inline int f8792_15(int x) { return x * 15; }
+inline int f8792_16(int x) { return x * 16; }
+inline int f8792_17(int x) { return x * 17; }
+inline int f8792_18(int x) { return x * 18; }
+inline int f8792_19(int x) { return x * 19; }
+inline int f8792_20(int x) { return x * 20; }
+inline int f8792_21(int x) { return x * 21; }
+inline int f8792_22(int x) { return x * 22; }
+inline int f8792_23(int x) { return x * 23; }
+inline int f8792_24(int x) { return x * 24; }
+inline int f8792_25(int x) { return x * 25; }
+inline int f8792_26(int x) { return x * 26; }
+inline int f8792_27(int x) { return x * 27; }
+inline int f8792_28(int x) { return x * 28; }
+inline int f8792_29(int x) { return x * 29; }
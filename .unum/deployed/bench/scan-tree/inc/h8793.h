@@ -0,0 +1,42 @@
+#pragma once
+/* header 8793 */
+#include <vector>
+#include "h3021.h"
+#include "h389.h"
+#include "h2932.h"
+#include "h3419.h"
+#include "h8315.h"
+#ifdef X
+#include "h1779.h"
+#endif
+struct S8793 { int a; const char *s = "x//y"; };
+inline int f8793_0(int x) { return x * 0; }
+inline int f8793_1(int x) { return x * 1; }
+inline int f8793_2(int x) { return x * 2; }
+inline int f8793_3(int x) { return x * 3; }
+inline int f8793_4(int x) { return x * 4; }
+inline int f8793_5(int x) { return x * 5; }
+inline int f8793_6(int x) { return x * 6; }
+inline int f8793_7(int x) { return x * 7; }
+inline int f8793_8(int x) { return x * 8; }
+inline int f8793_9(int x) { return x * 9; }
+inline int f8793_10(int x) { return x * 10; }
+inline int f8793_11(int x) { return x * 11; }
+inline int f8793_12(int x) { return x * 12; }
+inline int f8793_13(int x) { return x * 13; }
+inline int f8793_14(int x) { return x * 14; }
+inline int f8793_15(int x) { return x * 15; }
+inline int f8793_16(int x) { return x * 16; }
+inline int f8793_17(int x) { return x * 17; }
+inline int f8793_18(int x) { return x * 18; }
+inline int f8793_19(int x) { return x * 19; }
+inline int f8793_20(int x) { return x * 20; }
+inline int f8793_21(int x) { return x * 21; }
+inline int f8793_22(int x) { return x * 22; }
+inline int f8793_23(int x) { return x * 23; }
+inline int f8793_24(int x) { return x * 24; }
+inline int f8793_25(int x) { return x * 25; }
+inline int f8793_26(int x) { return x * 26; }
+inline int f8793_27(int x) { return x * 27; }
+inline int f8793_28(int x) { return x * 28; }
+inline int f8793_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8795 */
+#include <vector>
+#include "h8178.h"
+#include "h1866.h"
+#include "h1563.h"
+#include "h3778.h"
+#include "h4456.h"
+#ifdef X
+#include "h9827.h"
+#endif
+struct S8795 { int a; const char *s = "x//y"; };
+inline int f8795_0(int x) { return x * 0; }
+inline int f8795_1(int x) { return x * 1; }
+inline int f8795_2(int x) { return x * 2; }
+inline int f8795_3(int x) { return x * 3; }
+inline int f8795_4(int x) { return x * 4; }
+inline int f8795_5(int x) { return x * 5; }
+inline int f8795_6(int x) { return x * 6; }
+inline int f8795_7(int x) { return x * 7; }
+inline int f8795_8(int x) { return x * 8; }
+inline int f8795_9(int x) { return x * 9; }
+inline int f8795_10(int x) { return x * 10; }
+inline int f8795_11(int x) { return x * 11; }
+inline int f8795_12(int x) { return x * 12; }
+inline int f8795_13(int x) { return x * 13; }
+inline int f8795_14(int x) { return x * 14; }
+inline int f8795_15(int x) { return x * 15; }
+inline int f8795_16(int x) { return x * 16; }
+inline int f8795_17(int x) { return x * 17; }
+inline int f8795_18(int x) { return x * 18; }
+inline int f8795_19(int x) { return x * 19; }
+inline int f8795_20(int x) { return x * 20; }
+inline int f8795_21(int x) { return x * 21; }
+inline int f8795_22(int x) { return x * 22; }
+inline int f8795_23(int x) { return x * 23; }
+inline int f8795_24(int x) { return x * 24; }
+inline int f8795_25(int x) { return x * 25; }
+inline int f8795_26(int x) { return x * 26; }
+inline int f8795_27(int x) { return x * 27; }
+inline int f8795_28(int x) { return x * 28; }
+inline int f8795_29(int x) { return x * 29; }
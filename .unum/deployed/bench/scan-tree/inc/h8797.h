@@ -0,0 +1,42 @@
+#pragma once
+/* header 8797 */
+#include <vector>
+#include "h2695.h"
+#include "h185.h"
+#include "h6014.h"
+#include "h57.h"
+#include "h4605.h"
+#ifdef X
+#include "h5369.h"
+#endif
+struct S8797 { int a; const char *s = "x//y"; };
+inline int f8797_0(int x) { return x * 0; }
+inline int f8797_1(int x) { return x * 1; }
+inline int f8797_2(int x) { return x * 2; }
+inline int f8797_3(int x) { return x * 3; }
+inline int f8797_4(int x) { return x * 4; }
+inline int f8797_5(int x) { return x * 5; }
+inline int f8797_6(int x) { return x * 6; }
+inline int f8797_7(int x) { return x * 7; }
+inline int f8797_8(int x) { return x * 8; }
+inline int f8797_9(int x) { return x * 9; }
+inline int f8797_10(int x) { return x * 10; }
+inline int f8797_11(int x) { return x * 11; }
+inline int f8797_12(int x) { return x * 12; }
+inline int f8797_13(int x) { return x * 13; }
+inline int f8797_14(int x) { return x * 14; }
+inline int f8797_15(int x) { return x * 15; }
+inline int f8797_16(int x) { return x * 16; }
+inline int f8797_17(int x) { return x * 17; }
+inline int f8797_18(int x) { return x * 18; }
+inline int f8797_19(int x) { return x * 19; }
+inline int f8797_20(int x) { return x * 20; }
+inline int f8797_21(int x) { return x * 21; }
+inline int f8797_22(int x) { return x * 22; }
+inline int f8797_23(int x) { return x * 23; }
+inline int f8797_24(int x) { return x * 24; }
+inline int f8797_25(int x) { return x * 25; }
+inline int f8797_26(int x) { return x * 26; }
+inline int f8797_27(int x) { return x * 27; }
+inline int f8797_28(int x) { return x * 28; }
+inline int f8797_29(int x) { return x * 29; }
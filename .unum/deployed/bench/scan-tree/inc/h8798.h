@@ -0,0 +1,42 @@
+#pragma once
+/* header 8798 */
+#include <vector>
+#include "h1042.h"
+#include "h3666.h"
+#include "h454.h"
+#include "h907.h"
+#include "h1727.h"
+#ifdef X
+#include "h8043.h"
+#endif
+struct S8798 { int a; const char *s = "x//y"; };
+inline int f8798_0(int x) { return x * 0; }
+inline int f8798_1(int x) { return x * 1; }
+inline int f8798_2(int x) { return x * 2; }
+inline int f8798_3(int x) { return x * 3; }
+inline int f8798_4(int x) { return x * 4; }
+inline int f8798_5(int x) { return x * 5; }
+inline int f8798_6(int x) { return x * 6; }
+inline int f8798_7(int x) { return x * 7; }
+inline int f8798_8(int x) { return x * 8; }
+inline int f8798_9(int x) { return x * 9; }
+inline int f8798_10(int x) { return x * 10; }
+inline int f8798_11(int x) { return x * 11; }
+inline int f8798_12(int x) { return x * 12; }
+inline int f8798_13(int x) { return x * 13; }
+inline int f8798_14(int x) { return x * 14; }
+inline int f8798_15(int x) { return x * 15; }
+inline int f8798_16(int x) { return x * 16; }
+inline int f8798_17(int x) { return x * 17; }
+inline int f8798_18(int x) { return x * 18; }
+inline int f8798_19(int x) { return x * 19; }
+inline int f8798_20(int x) { return x * 20; }
+inline int f8798_21(int x) { return x * 21; }
+inline int f8798_22(int x) { return x * 22; }
+inline int f8798_23(int x) { return x * 23; }
+inline int f8798_24(int x) { return x * 24; }
+inline int f8798_25(int x) { return x * 25; }
+inline int f8798_26(int x) { return x * 26; }
+inline int f8798_27(int x) { return x * 27; }
+inline int f8798_28(int x) { return x * 28; }
+inline int f8798_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 88 */
+#include <vector>
+#include "h2842.h"
+#include "h9496.h"
+#include "h7843.h"
+#include "h672.h"
+#include "h6725.h"
+#ifdef X
+#include "h3562.h"
+#endif
+struct S88 { int a; const char *s = "x//y"; };
+inline int f88_0(int x) { return x * 0; }
+inline int f88_1(int x) { return x * 1; }
+inline int f88_2(int x) { return x * 2; }
+inline int f88_3(int x) { return x * 3; }
+inline int f88_4(int x) { return x * 4; }
+inline int f88_5(int x) { return x * 5; }
+inline int f88_6(int x) { return x * 6; }
+inline int f88_7(int x) { return x * 7; }
+inline int f88_8(int x) { return x * 8; }
+inline int f88_9(int x) { return x * 9; }
+inline int f88_10(int x) { return x * 10; }
+inline int f88_11(int x) { return x * 11; }
+inline int f88_12(int x) { return x * 12; }
+inline int f88_13(int x) { return x * 13; }
+inline int f88_14(int x) { return x * 14; }
+inline int f88_15(int x) { return x * 15; }
+inline int f88_16(int x) { return x * 16; }
+inline int f88_17(int x) { return x * 17; }
+inline int f88_18(int x) { return x * 18; }
+inline int f88_19(int x) { return x * 19; }
+inline int f88_20(int x) { return x * 20; }
+inline int f88_21(int x) { return x * 21; }
+inline int f88_22(int x) { return x * 22; }
+inline int f88_23(int x) { return x * 23; }
+inline int f88_24(int x) { return x * 24; }
+inline int f88_25(int x) { return x * 25; }
+inline int f88_26(int x) { return x * 26; }
+inline int f88_27(int x) { return x * 27; }
+inline int f88_28(int x) { return x * 28; }
+inline int f88_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 880 */
+#include <vector>
+#include "h7791.h"
+#include "h241.h"
+#include "h3105.h"
+#include "h7026.h"
+#include "h8463.h"
+#ifdef X
+#include "h8333.h"
+#endif
+struct S880 { int a; const char *s = "x//y"; };
+inline int f880_0(int x) { return x * 0; }
+inline int f880_1(int x) { return x * 1; }
+inline int f880_2(int x) { return x * 2; }
+inline int f880_3(int x) { return x * 3; }
+inline int f880_4(int x) { return x * 4; }
+inline int f880_5(int x) { return x * 5; }
+inline int f880_6(int x) { return x * 6; }
+inline int f880_7(int x) { return x * 7; }
+inline int f880_8(int x) { return x * 8; }
+inline int f880_9(int x) { return x * 9; }
+inline int f880_10(int x) { return x * 10; }
+inline int f880_11(int x) { return x * 11; }
+inline int f880_12(int x) { return x * 12; }
+inline int f880_13(int x) { return x * 13; }
+inline int f880_14(int x) { return x * 14; }
+inline int f880_15(int x) { return x * 15; }
+inline int f880_16(int x) { return x * 16; }
+inline int f880_17(int x) { return x * 17; }
+inline int f880_18(int x) { return x * 18; }
+inline int f880_19(int x) { return x * 19; }
+inline int f880_20(int x) { return x * 20; }
+inline int f880_21(int x) { return x * 21; }
+inline int f880_22(int x) { return x * 22; }
+inline int f880_23(int x) { return x * 23; }
+inline int f880_24(int x) { return x * 24; }
+inline int f880_25(int x) { return x * 25; }
+inline int f880_26(int x) { return x * 26; }
+inline int f880_27(int x) { return x * 27; }
+inline int f880_28(int x) { return x * 28; }
+inline int f880_29(int x) { return x * 29; }
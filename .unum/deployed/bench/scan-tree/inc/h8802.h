@@ -0,0 +1,42 @@
+#pragma once
+/* header 8802 */
+#include <vector>
+#include "h4406.h"
+#include "h6781.h"
+#include "h6066.h"
+#include "h2944.h"
+#include "h235.h"
+#ifdef X
+#include "h8502.h"
+#endif
+struct S8802 { int a; const char *s = "x//y"; };
+inline int f8802_0(int x) { return x * 0; }
+inline int f8802_1(int x) { return x * 1; }
+inline int f8802_2(int x) { return x * 2; }
+inline int f8802_3(int x) { return x * 3; }
+inline int f8802_4(int x) { return x * 4; }
+inline int f8802_5(int x) { return x * 5; }
+inline int f8802_6(int x) { return x * 6; }
+inline int f8802_7(int x) { return x * 7; }
+inline int f8802_8(int x) { return x * 8; }
+inline int f8802_9(int x) { return x * 9; }
+inline int f8802_10(int x) { return x * 10; }
+inline int f8802_11(int x) { return x * 11; }
+inline int f8802_12(int x) { return x * 12; }
+inline int f8802_13(int x) { return x * 13; }
+inline int f8802_14(int x) { return x * 14; }
+inline int f8802_15(int x) { return x * 15; }
+inline int f8802_16(int x) { return x * 16; }
+inline int f8802_17(int x) { return x * 17; }
+inline int f8802_18(int x) { return x * 18; }
+inline int f8802_19(int x) { return x * 19; }
+inline int f8802_20(int x) { return x * 20; }
+inline int f8802_21(int x) { return x * 21; }
+inline int f8802_22(int x) { return x * 22; }
+inline int f8802_23(int x) { return x * 23; }
+inline int f8802_24(int x) { return x * 24; }
+inline int f8802_25(int x) { return x * 25; }
+inline int f8802_26(int x) { return x * 26; }
+inline int f8802_27(int x) { return x * 27; }
+inline int f8802_28(int x) { return x * 28; }
+inline int f8802_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8803 */
+#include <vector>
+#include "h9568.h"
+#include "h7308.h"
+#include "h7157.h"
+#include "h9881.h"
+#include "h955.h"
+#ifdef X
+#include "h7314.h"
+#endif
+struct S8803 { int a; const char *s = "x//y"; };
+inline int f8803_0(int x) { return x * 0; }
+inline int f8803_1(int x) { return x * 1; }
+inline int f8803_2(int x) { return x * 2; }
+inline int f8803_3(int x) { return x * 3; }
+inline int f8803_4(int x) { return x * 4; }
+inline int f8803_5(int x) { return x * 5; }
+inline int f8803_6(int x) { return x * 6; }
+inline int f8803_7(int x) { return x * 7; }
+inline int f8803_8(int x) { return x * 8; }
+inline int f8803_9(int x) { return x * 9; }
+inline int f8803_10(int x) { return x * 10; }
+inline int f8803_11(int x) { return x * 11; }
+inline int f8803_12(int x) { return x * 12; }
+inline int f8803_13(int x) { return x * 13; }
+inline int f8803_14(int x) { return x * 14; }
+inline int f8803_15(int x) { return x * 15; }
+inline int f8803_16(int x) { return x * 16; }
+inline int f8803_17(int x) { return x * 17; }
+inline int f8803_18(int x) { return x * 18; }
+inline int f8803_19(int x) { return x * 19; }
+inline int f8803_20(int x) { return x * 20; }
+inline int f8803_21(int x) { return x * 21; }
+inline int f8803_22(int x) { return x * 22; }
+inline int f8803_23(int x) { return x * 23; }
+inline int f8803_24(int x) { return x * 24; }
+inline int f8803_25(int x) { return x * 25; }
+inline int f8803_26(int x) { return x * 26; }
+inline int f8803_27(int x) { return x * 27; }
+inline int f8803_28(int x) { return x * 28; }
+inline int f8803_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8804 */
+#include <vector>
+#include "h1644.h"
+#include "h7159.h"
+#include "h4775.h"
+#include "h630.h"
+#include "h6164.h"
+#ifdef X
+#include "h6808.h"
+#endif
+struct S8804 { int a; const char *s = "x//y"; };
+inline int f8804_0(int x) { return x * 0; }
+inline int f8804_1(int x) { return x * 1; }
+inline int f8804_2(int x) { return x * 2; }
+inline int f8804_3(int x) { return x * 3; }
+inline int f8804_4(int x) { return x * 4; }
+inline int f8804_5(int x) { return x * 5; }
+inline int f8804_6(int x) { return x * 6; }
+inline int f8804_7(int x) { return x * 7; }
+inline int f8804_8(int x) { return x * 8; }
+inline int f8804_9(int x) { return x * 9; }
+inline int f8804_10(int x) { return x * 10; }
+inline int f8804_11(int x) { return x * 11; }
+inline int f8804_12(int x) { return x * 12; }
+inline int f8804_13(int x) { return x * 13; }
+inline int f8804_14(int x) { return x * 14; }
+inline int f8804_15(int x) { return x * 15; }
+inline int f8804_16(int x) { return x * 16; }
+inline int f8804_17(int x) { return x * 17; }
+inline int f8804_18(int x) { return x * 18; }
+inline int f8804_19(int x) { return x * 19; }
+inline int f8804_20(int x) { return x * 20; }
+inline int f8804_21(int x) { return x * 21; }
+inline int f8804_22(int x) { return x * 22; }
+inline int f8804_23(int x) { return x * 23; }
+inline int f8804_24(int x) { return x * 24; }
+inline int f8804_25(int x) { return x * 25; }
+inline int f8804_26(int x) { return x * 26; }
+inline int f8804_27(int x) { return x * 27; }
+inline int f8804_28(int x) { return x * 28; }
+inline int f8804_29(int x) { return x * 29; }
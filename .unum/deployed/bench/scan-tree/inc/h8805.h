@@ -0,0 +1,42 @@
+#pragma once
+/* header 8805 */
+#include <vector>
+#include "h9460.h"
+#include "h9370.h"
+#include "h4319.h"
+#include "h9750.h"
+#include "h9892.h"
+#ifdef X
+#include "h1382.h"
+#endif
+struct S8805 { int a; const char *s = "x//y"; };
+inline int f8805_0(int x) { return x * 0; }
+inline int f8805_1(int x) { return x * 1; }
+inline int f8805_2(int x) { return x * 2; }
+inline int f8805_3(int x) { return x * 3; }
+inline int f8805_4(int x) { return x * 4; }
+inline int f8805_5(int x) { return x * 5; }
+inline int f8805_6(int x) { return x * 6; }
+inline int f8805_7(int x) { return x * 7; }
+inline int f8805_8(int x) { return x * 8; }
+inline int f8805_9(int x) { return x * 9; }
+inline int f8805_10(int x) { return x * 10; }
+inline int f8805_11(int x) { return x * 11; }
+inline int f8805_12(int x) { return x * 12; }
+inline int f8805_13(int x) { return x * 13; }
+inline int f8805_14(int x) { return x * 14; }
+inline int f8805_15(int x) { return x * 15; }
+inline int f8805_16(int x) { return x * 16; }
+inline int f8805_17(int x) { return x * 17; }
+inline int f8805_18(int x) { return x * 18; }
+inline int f8805_19(int x) { return x * 19; }
+inline int f8805_20(int x) { return x * 20; }
+inline int f8805_21(int x) { return x * 21; }
+inline int f8805_22(int x) { return x * 22; }
+inline int f8805_23(int x) { return x * 23; }
+inline int f8805_24(int x) { return x * 24; }
+inline int f8805_25(int x) { return x * 25; }
+inline int f8805_26(int x) { return x * 26; }
+inline int f8805_27(int x) { return x * 27; }
+inline int f8805_28(int x) { return x * 28; }
+inline int f8805_29(int x) { return x * 29; }
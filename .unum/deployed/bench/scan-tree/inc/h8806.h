@@ -0,0 +1,42 @@
+#pragma once
+/* header 8806 */
+#include <vector>
+#include "h4722.h"
+#include "h1884.h"
+#include "h4179.h"
+#include "h417.h"
+#include "h5859.h"
+#ifdef X
+#include "h5898.h"
+#endif
+struct S8806 { int a; const char *s = "x//y"; };
+inline int f8806_0(int x) { return x * 0; }
+inline int f8806_1(int x) { return x * 1; }
+inline int f8806_2(int x) { return x * 2; }
+inline int f8806_3(int x) { return x * 3; }
+inline int f8806_4(int x) { return x * 4; }
+inline int f8806_5(int x) { return x * 5; }
+inline int f8806_6(int x) { return x * 6; }
+inline int f8806_7(int x) { return x * 7; }
+inline int f8806_8(int x) { return x * 8; }
+inline int f8806_9(int x) { return x * 9; }
+inline int f8806_10(int x) { return x * 10; }
+inline int f8806_11(int x) { return x * 11; }
+inline int f8806_12(int x) { return x * 12; }
+inline int f8806_13(int x) { return x * 13; }
+inline int f8806_14(int x) { return x * 14; }
+inline int f8806_15(int x) { return x * 15; }
+inline int f8806_16(int x) { return x * 16; }
+inline int f8806_17(int x) { return x * 17; }
+inline int f8806_18(int x) { return x * 18; }
+inline int f8806_19(int x) { return x * 19; }
+inline int f8806_20(int x) { return x * 20; }
+inline int f8806_21(int x) { return x * 21; }
+inline int f8806_22(int x) { return x * 22; }
+inline int f8806_23(int x) { return x * 23; }
+inline int f8806_24(int x) { return x * 24; }
+inline int f8806_25(int x) { return x * 25; }
+inline int f8806_26(int x) { return x * 26; }
+inline int f8806_27(int x) { return x * 27; }
+inline int f8806_28(int x) { return x * 28; }
+inline int f8806_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8808 */
+#include <vector>
+#include "h709.h"
+#include "h7325.h"
+#include "h2974.h"
+#include "h7302.h"
+#include "h8392.h"
+#ifdef X
+#include "h2216.h"
+#endif
+struct S8808 { int a; const char *s = "x//y"; };
+inline int f8808_0(int x) { return x * 0; }
+inline int f8808_1(int x) { return x * 1; }
+inline int f8808_2(int x) { return x * 2; }
+inline int f8808_3(int x) { return x * 3; }
+inline int f8808_4(int x) { return x * 4; }
+inline int f8808_5(int x) { return x * 5; }
+inline int f8808_6(int x) { return x * 6; }
+inline int f8808_7(int x) { return x * 7; }
+inline int f8808_8(int x) { return x * 8; }
+inline int f8808_9(int x) { return x * 9; }
+inline int f8808_10(int x) { return x * 10; }
+inline int f8808_11(int x) { return x * 11; }
+inline int f8808_12(int x) { return x * 12; }
+inline int f8808_13(int x) { return x * 13; }
+inline int f8808_14(int x) { return x * 14; }
+inline int f8808_15(int x) { return x * 15; }
+inline int f8808_16(int x) { return x * 16; }
+inline int f8808_17(int x) { return x * 17; }
+inline int f8808_18(int x) { return x * 18; }
+inline int f8808_19(int x) { return x * 19; }
+inline int f8808_20(int x) { return x * 20; }
+inline int f8808_21(int x) { return x * 21; }
+inline int f8808_22(int x) { return x * 22; }
+inline int f8808_23(int x) { return x * 23; }
+inline int f8808_24(int x) { return x * 24; }
+inline int f8808_25(int x) { return x * 25; }
+inline int f8808_26(int x) { return x * 26; }
+inline int f8808_27(int x) { return x * 27; }
+inline int f8808_28(int x) { return x * 28; }
+inline int f8808_29(int x) { return x * 29; }
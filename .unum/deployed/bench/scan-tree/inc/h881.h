@@ -0,0 +1,42 @@
+#pragma once
+/* header 881 */
+#include <vector>
+#include "h4038.h"
+#include "h6589.h"
+#include "h7708.h"
+#include "h1822.h"
+#include "h4519.h"
+#ifdef X
+#include "h1828.h"
+#endif
+struct S881 { int a; const char *s = "x//y"; };
+inline int f881_0(int x) { return x * 0; }
+inline int f881_1(int x) { return x * 1; }
+inline int f881_2(int x) { return x * 2; }
+inline int f881_3(int x) { return x * 3; }
+inline int f881_4(int x) { return x * 4; }
+inline int f881_5(int x) { return x * 5; }
+inline int f881_6(int x) { return x * 6; }
+inline int f881_7(int x) { return x * 7; }
+inline int f881_8(int x) { return x * 8; }
+inline int f881_9(int x) { return x * 9; }
+inline int f881_10(int x) { return x * 10; }
+inline int f881_11(int x) { return x * 11; }
+inline int f881_12(int x) { return x * 12; }
+inline int f881_13(int x) { return x * 13; }
+inline int f881_14(int x) { return x * 14; }
+inline int f881_15(int x) { return x * 15; }
+inline int f881_16(int x) { return x * 16; }
+inline int f881_17(int x) { return x * 17; }
+inline int f881_18(int x) { return x * 18; }
+inline int f881_19(int x) { return x * 19; }
+inline int f881_20(int x) { return x * 20; }
+inline int f881_21(int x) { return x * 21; }
+inline int f881_22(int x) { return x * 22; }
+inline int f881_23(int x) { return x * 23; }
+inline int f881_24(int x) { return x * 24; }
+inline int f881_25(int x) { return x * 25; }
+inline int f881_26(int x) { return x * 26; }
+inline int f881_27(int x) { return x * 27; }
+inline int f881_28(int x) { return x * 28; }
+inline int f881_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8812 */
+#include <vector>
+#include "h3852.h"
+#include "h1805.h"
+#include "h865.h"
+#include "h4873.h"
+#include "h8391.h"
+#ifdef X
+#include "h3216.h"
+#endif
+struct S8812 { int a; const char *s = "x//y"; };
+inline int f8812_0(int x) { return x * 0; }
+inline int f8812_1(int x) { return x * 1; }
+inline int f8812_2(int x) { return x * 2; }
+inline int f8812_3(int x) { return x * 3; }
+inline int f8812_4(int x) { return x * 4; }
+inline int f8812_5(int x) { return x * 5; }
+inline int f8812_6(int x) { return x * 6; }
+inline int f8812_7(int x) { return x * 7; }
+inline int f8812_8(int x) { return x * 8; }
+inline int f8812_9(int x) { return x * 9; }
+inline int f8812_10(int x) { return x * 10; }
+inline int f8812_11(int x) { return x * 11; }
+inline int f8812_12(int x) { return x * 12; }
+inline int f8812_13(int x) { return x * 13; }
+inline int f8812_14(int x) { return x * 14; }
+inline int f8812_15(int x) { return x * 15; }
+inline int f8812_16(int x) { return x * 16; }
+inline int f8812_17(int x) { return x * 17; }
+inline int f8812_18(int x) { return x * 18; }
+inline int f8812_19(int x) { return x * 19; }
+inline int f8812_20(int x) { return x * 20; }
+inline int f8812_21(int x) { return x * 21; }
+inline int f8812_22(int x) { return x * 22; }
+inline int f8812_23(int x) { return x * 23; }
+inline int f8812_24(int x) { return x * 24; }
+inline int f8812_25(int x) { return x * 25; }
+inline int f8812_26(int x) { return x * 26; }
+inline int f8812_27(int x) { return x * 27; }
+inline int f8812_28(int x) { return x * 28; }
+inline int f8812_29(int x) { return x * 29; }
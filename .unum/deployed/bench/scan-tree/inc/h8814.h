@@ -0,0 +1,42 @@
+#pragma once
+/* header 8814 */
+#include <vector>
+#include "h166.h"
+#include "h7969.h"
+#include "h6366.h"
+#include "h8667.h"
+#include "h5337.h"
+#ifdef X
+#include "h1389.h"
+#endif
+struct S8814 { int a; const char *s = "x//y"; };
+inline int f8814_0(int x) { return x * 0; }
+inline int f8814_1(int x) { return x * 1; }
+inline int f8814_2(int x) { return x * 2; }
+inline int f8814_3(int x) { return x * 3; }
+inline int f8814_4(int x) { return x * 4; }
+inline int f8814_5(int x) { return x * 5; }
+inline int f8814_6(int x) { return x * 6; }
+inline int f8814_7(int x) { return x * 7; }
+inline int f8814_8(int x) { return x * 8; }
+inline int f8814_9(int x) { return x * 9; }
+inline int f8814_10(int x) { return x * 10; }
+inline int f8814_11(int x) { return x * 11; }
+inline int f8814_12(int x) { return x * 12; }
+inline int f8814_13(int x) { return x * 13; }
+inline int f8814_14(int x) { return x * 14; }
+inline int f8814_15(int x) { return x * 15; }
+inline int f8814_16(int x) { return x * 16; }
+inline int f8814_17(int x) { return x * 17; }
+inline int f8814_18(int x) { return x * 18; }
+inline int f8814_19(int x) { return x * 19; }
+inline int f8814_20(int x) { return x * 20; }
+inline int f8814_21(int x) { return x * 21; }
+inline int f8814_22(int x) { return x * 22; }
+inline int f8814_23(int x) { return x * 23; }
+inline int f8814_24(int x) { return x * 24; }
+inline int f8814_25(int x) { return x * 25; }
+inline int f8814_26(int x) { return x * 26; }
+inline int f8814_27(int x) { return x * 27; }
+inline int f8814_28(int x) { return x * 28; }
+inline int f8814_29(int x) { return x * 29; }
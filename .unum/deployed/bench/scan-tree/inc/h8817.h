@@ -0,0 +1,42 @@
+#pragma once
+/* header 8817 */
+#include <vector>
+#include "h7546.h"
+#include "h4047.h"
+#include "h1151.h"
+#include "h9384.h"
+#include "h3436.h"
+#ifdef X
+#include "h8544.h"
+#endif
+struct S8817 { int a; const char *s = "x//y"; };
+inline int f8817_0(int x) { return x * 0; }
+inline int f8817_1(int x) { return x * 1; }
+inline int f8817_2(int x) { return x * 2; }
+inline int f8817_3(int x) { return x * 3; }
+inline int f8817_4(int x) { return x * 4; }
+inline int f8817_5(int x) { return x * 5; }
+inline int f8817_6(int x) { return x * 6; }
+inline int f8817_7(int x) { return x * 7; }
+inline int f8817_8(int x) { return x * 8; }
+inline int f8817_9(int x) { return x * 9; }
+inline int f8817_10(int x) { return x * 10; }
+inline int f8817_11(int x) { return x * 11; }
+inline int f8817_12(int x) { return x * 12; }
+inline int f8817_13(int x) { return x * 13; }
+inline int f8817_14(int x) { return x * 14; }
+inline int f8817_15(int x) { return x * 15; }
+inline int f8817_16(int x) { return x * 16; }
+inline int f8817_17(int x) { return x * 17; }
+inline int f8817_18(int x) { return x * 18; }
+inline int f8817_19(int x) { return x * 19; }
+inline int f8817_20(int x) { return x * 20; }
+inline int f8817_21(int x) { return x * 21; }
+inline int f8817_22(int x) { return x * 22; }
+inline int f8817_23(int x) { return x * 23; }
+inline int f8817_24(int x) { return x * 24; }
+inline int f8817_25(int x) { return x * 25; }
+inline int f8817_26(int x) { return x * 26; }
+inline int f8817_27(int x) { return x * 27; }
+inline int f8817_28(int x) { return x * 28; }
+inline int f8817_29(int x) { return x * 29; }
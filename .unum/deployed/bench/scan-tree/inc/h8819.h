@@ -0,0 +1,42 @@
+#pragma once
+/* header 8819 */
+#include <vector>
+#include "h6167.h"
+#include "h8141.h"
+#include "h2666.h"
+#include "h559.h"
+#include "h7616.h"
+#ifdef X
+#include "h7958.h"
+#endif
+struct S8819 { int a; const char *s = "x//y"; };
+inline int f8819_0(int x) { return x * 0; }
+inline int f8819_1(int x) { return x * 1; }
+inline int f8819_2(int x) { return x * 2; }
+inline int f8819_3(int x) { return x * 3; }
+inline int f8819_4(int x) { return x * 4; }
+inline int f8819_5(int x) { return x * 5; }
+inline int f8819_6(int x) { return x * 6; }
+inline int f8819_7(int x) { return x * 7; }
+inline int f8819_8(int x) { return x * 8; }
+inline int f8819_9(int x) { return x * 9; }
+inline int f8819_10(int x) { return x * 10; }
+inline int f8819_11(int x) { return x * 11; }
+inline int f8819_12(int x) { return x * 12; }
+inline int f8819_13(int x) { return x * 13; }
+inline int f8819_14(int x) { return x * 14; }
+inline int f8819_15(int x) { return x * 15; }
+inline int f8819_16(int x) { return x * 16; }
+inline int f8819_17(int x) { return x * 17; }
+inline int f8819_18(int x) { return x * 18; }
+inline int f8819_19(int x) { return x * 19; }
+inline int f8819_20(int x) { return x * 20; }
+inline int f8819_21(int x) { return x * 21; }
+inline int f8819_22(int x) { return x * 22; }
+inline int f8819_23(int x) { return x * 23; }
+inline int f8819_24(int x) { return x * 24; }
+inline int f8819_25(int x) { return x * 25; }
+inline int f8819_26(int x) { return x * 26; }
+inline int f8819_27(int x) { return x * 27; }
+inline int f8819_28(int x) { return x * 28; }
+inline int f8819_29(int x) { return x * 29; }
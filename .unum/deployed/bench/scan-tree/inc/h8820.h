@@ -0,0 +1,42 @@
+#pragma once
+/* header 8820 */
+#include <vector>
+#include "h3465.h"
+#include "h9858.h"
+#include "h3107.h"
+#include "h4811.h"
+#include "h7391.h"
+#ifdef X
+#include "h3907.h"
+#endif
+struct S8820 { int a; const char *s = "x//y"; };
+inline int f8820_0(int x) { return x * 0; }
+inline int f8820_1(int x) { return x * 1; }
+inline int f8820_2(int x) { return x * 2; }
+inline int f8820_3(int x) { return x * 3; }
+inline int f8820_4(int x) { return x * 4; }
+inline int f8820_5(int x) { return x * 5; }
+inline int f8820_6(int x) { return x * 6; }
+inline int f8820_7(int x) { return x * 7; }
+inline int f8820_8(int x) { return x * 8; }
+inline int f8820_9(int x) { return x * 9; }
+inline int f8820_10(int x) { return x * 10; }
+inline int f8820_11(int x) { return x * 11; }
+inline int f8820_12(int x) { return x * 12; }
+inline int f8820_13(int x) { return x * 13; }
+inline int f8820_14(int x) { return x * 14; }
+inline int f8820_15(int x) { return x * 15; }
+inline int f8820_16(int x) { return x * 16; }
+inline int f8820_17(int x) { return x * 17; }
+inline int f8820_18(int x) { return x * 18; }
+inline int f8820_19(int x) { return x * 19; }
+inline int f8820_20(int x) { return x * 20; }
+inline int f8820_21(int x) { return x * 21; }
+inline int f8820_22(int x) { return x * 22; }
+inline int f8820_23(int x) { return x * 23; }
+inline int f8820_24(int x) { return x * 24; }
+inline int f8820_25(int x) { return x * 25; }
+inline int f8820_26(int x) { return x * 26; }
+inline int f8820_27(int x) { return x * 27; }
+inline int f8820_28(int x) { return x * 28; }
+inline int f8820_29(int x) { return x * 29; }
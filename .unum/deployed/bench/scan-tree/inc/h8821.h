@@ -0,0 +1,42 @@
+#pragma once
+/* header 8821 */
+#include <vector>
+#include "h2536.h"
+#include "h2559.h"
+#include "h4591.h"
+#include "h463.h"
+#include "h1179.h"
+#ifdef X
+#include "h8161.h"
+#endif
+struct S8821 { int a; const char *s = "x//y"; };
+inline int f8821_0(int x) { return x * 0; }
+inline int f8821_1(int x) { return x * 1; }
+inline int f8821_2(int x) { return x * 2; }
+inline int f8821_3(int x) { return x * 3; }
+inline int f8821_4(int x) { return x * 4; }
+inline int f8821_5(int x) { return x * 5; }
+inline int f8821_6(int x) { return x * 6; }
+inline int f8821_7(int x) { return x * 7; }
+inline int f8821_8(int x) { return x * 8; }
+inline int f8821_9(int x) { return x * 9; }
+inline int f8821_10(int x) { return x * 10; }
+inline int f8821_11(int x) { return x * 11; }
+inline int f8821_12(int x) { return x * 12; }
+inline int f8821_13(int x) { return x * 13; }
+inline int f8821_14(int x) { return x * 14; }
+inline int f8821_15(int x) { return x * 15; }
+inline int f8821_16(int x) { return x * 16; }
+inline int f8821_17(int x) { return x * 17; }
+inline int f8821_18(int x) { return x * 18; }
+inline int f8821_19(int x) { return x * 19; }
+inline int f8821_20(int x) { return x * 20; }
+inline int f8821_21(int x) { return x * 21; }
+inline int f8821_22(int x) { return x * 22; }
+inline int f8821_23(int x) { return x * 23; }
+inline int f8821_24(int x) { return x * 24; }
+inline int f8821_25(int x) { return x * 25; }
+inline int f8821_26(int x) { return x * 26; }
+inline int f8821_27(int x) { return x * 27; }
+inline int f8821_28(int x) { return x * 28; }
+inline int f8821_29(int x) { return x * 29; }
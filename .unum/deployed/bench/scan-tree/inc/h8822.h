@@ -0,0 +1,42 @@
+#pragma once
+/* header 8822 */
+#include <vector>
+#include "h8467.h"
+#include "h3692.h"
+#include "h7995.h"
+#include "h3104.h"
+#include "h90.h"
+#ifdef X
+#include "h4500.h"
+#endif
+struct S8822 { int a; const char *s = "x//y"; };
+inline int f8822_0(int x) { return x * 0; }
+inline int f8822_1(int x) { return x * 1; }
+inline int f8822_2(int x) { return x * 2; }
+inline int f8822_3(int x) { return x * 3; }
+inline int f8822_4(int x) { return x * 4; }
+inline int f8822_5(int x) { return x * 5; }
+inline int f8822_6(int x) { return x * 6; }
+inline int f8822_7(int x) { return x * 7; }
+inline int f8822_8(int x) { return x * 8; }
+inline int f8822_9(int x) { return x * 9; }
+inline int f8822_10(int x) { return x * 10; }
+inline int f8822_11(int x) { return x * 11; }
+inline int f8822_12(int x) { return x * 12; }
+inline int f8822_13(int x) { return x * 13; }
+inline int f8822_14(int x) { return x * 14; }
+inline int f8822_15(int x) { return x * 15; }
+inline int f8822_16(int x) { return x * 16; }
+inline int f8822_17(int x) { return x * 17; }
+inline int f8822_18(int x) { return x * 18; }
+inline int f8822_19(int x) { return x * 19; }
+inline int f8822_20(int x) { return x * 20; }
+inline int f8822_21(int x) { return x * 21; }
+inline int f8822_22(int x) { return x * 22; }
+inline int f8822_23(int x) { return x * 23; }
+inline int f8822_24(int x) { return x * 24; }
+inline int f8822_25(int x) { return x * 25; }
+inline int f8822_26(int x) { return x * 26; }
+inline int f8822_27(int x) { return x * 27; }
+inline int f8822_28(int x) { return x * 28; }
+inline int f8822_29(int x) { return x * 29; }
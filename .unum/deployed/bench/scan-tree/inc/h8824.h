@@ -0,0 +1,42 @@
+#pragma once
+/* header 8824 */
+#include <vector>
+#include "h6631.h"
+#include "h6434.h"
+#include "h4415.h"
+#include "h5125.h"
+#include "h8837.h"
+#ifdef X
+#include "h5405.h"
+#endif
+struct S8824 { int a; const char *s = "x//y"; };
+inline int f8824_0(int x) { return x * 0; }
+inline int f8824_1(int x) { return x * 1; }
+inline int f8824_2(int x) { return x * 2; }
+inline int f8824_3(int x) { return x * 3; }
+inline int f8824_4(int x) { return x * 4; }
+inline int f8824_5(int x) { return x * 5; }
+inline int f8824_6(int x) { return x * 6; }
+inline int f8824_7(int x) { return x * 7; }
+inline int f8824_8(int x) { return x * 8; }
+inline int f8824_9(int x) { return x * 9; }
+inline int f8824_10(int x) { return x * 10; }
+inline int f8824_11(int x) { return x * 11; }
+inline int f8824_12(int x) { return x * 12; }
+inline int f8824_13(int x) { return x * 13; }
+inline int f8824_14(int x) { return x * 14; }
+inline int f8824_15(int x) { return x * 15; }
+inline int f8824_16(int x) { return x * 16; }
+inline int f8824_17(int x) { return x * 17; }
+inline int f8824_18(int x) { return x * 18; }
+inline int f8824_19(int x) { return x * 19; }
+inline int f8824_20(int x) { return x * 20; }
+inline int f8824_21(int x) { return x * 21; }
+inline int f8824_22(int x) { return x * 22; }
+inline int f8824_23(int x) { return x * 23; }
+inline int f8824_24(int x) { return x * 24; }
+inline int f8824_25(int x) { return x * 25; }
+inline int f8824_26(int x) { return x * 26; }
+inline int f8824_27(int x) { return x * 27; }
+inline int f8824_28(int x) { return x * 28; }
+inline int f8824_29(int x) { return x * 29; }
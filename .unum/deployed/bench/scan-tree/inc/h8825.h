@@ -0,0 +1,42 @@
+#pragma once
+/* header 8825 */
+#include <vector>
+#include "h8851.h"
+#include "h4467.h"
+#include "h6135.h"
+#include "h6057.h"
+#include "h3354.h"
+#ifdef X
+#include "h6527.h"
+#endif
+struct S8825 { int a; const char *s = "x//y"; };
+inline int f8825_0(int x) { return x * 0; }
+inline int f8825_1(int x) { return x * 1; }
+inline int f8825_2(int x) { return x * 2; }
+inline int f8825_3(int x) { return x * 3; }
+inline int f8825_4(int x) { return x * 4; }
+inline int f8825_5(int x) { return x * 5; }
+inline int f8825_6(int x) { return x * 6; }
+inline int f8825_7(int x) { return x * 7; }
+inline int f8825_8(int x) { return x * 8; }
+inline int f8825_9(int x) { return x * 9; }
+inline int f8825_10(int x) { return x * 10; }
+inline int f8825_11(int x) { return x * 11; }
+inline int f8825_12(int x) { return x * 12; }
+inline int f8825_13(int x) { return x * 13; }
+inline int f8825_14(int x) { return x * 14; }
+inline int f8825_15(int x) { return x * 15; }
+inline int f8825_16(int x) { return x * 16; }
+inline int f8825_17(int x) { return x * 17; }
+inline int f8825_18(int x) { return x * 18; }
+inline int f8825_19(int x) { return x * 19; }
+inline int f8825_20(int x) { return x * 20; }
+inline int f8825_21(int x) { return x * 21; }
+inline int f8825_22(int x) { return x * 22; }
+inline int f8825_23(int x) { return x * 23; }
+inline int f8825_24(int x) { return x * 24; }
+inline int f8825_25(int x) { return x * 25; }
+inline int f8825_26(int x) { return x * 26; }
+inline int f8825_27(int x) { return x * 27; }
+inline int f8825_28(int x) { return x * 28; }
+inline int f8825_29(int x) { return x * 29; }
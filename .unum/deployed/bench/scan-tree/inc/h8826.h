@@ -0,0 +1,42 @@
+#pragma once
+/* header 8826 */
+#include <vector>
+#include "h6270.h"
+#include "h2898.h"
+#include "h3520.h"
+#include "h2111.h"
+#include "h1483.h"
+#ifdef X
+#include "h2586.h"
+#endif
+struct S8826 { int a; const char *s = "x//y"; };
+inline int f8826_0(int x) { return x * 0; }
+inline int f8826_1(int x) { return x * 1; }
+inline int f8826_2(int x) { return x * 2; }
+inline int f8826_3(int x) { return x * 3; }
+inline int f8826_4(int x) { return x * 4; }
+inline int f8826_5(int x) { return x * 5; }
+inline int f8826_6(int x) { return x * 6; }
+inline int f8826_7(int x) { return x * 7; }
+inline int f8826_8(int x) { return x * 8; }
+inline int f8826_9(int x) { return x * 9; }
+inline int f8826_10(int x) { return x * 10; }
+inline int f8826_11(int x) { return x * 11; }
+inline int f8826_12(int x) { return x * 12; }
+inline int f8826_13(int x) { return x * 13; }
+inline int f8826_14(int x) { return x * 14; }
+inline int f8826_15(int x) { return x * 15; }
+inline int f8826_16(int x) { return x * 16; }
+inline int f8826_17(int x) { return x * 17; }
+inline int f8826_18(int x) { return x * 18; }
+inline int f8826_19(int x) { return x * 19; }
+inline int f8826_20(int x) { return x * 20; }
+inline int f8826_21(int x) { return x * 21; }
+inline int f8826_22(int x) { return x * 22; }
+inline int f8826_23(int x) { return x * 23; }
+inline int f8826_24(int x) { return x * 24; }
+inline int f8826_25(int x) { return x * 25; }
+inline int f8826_26(int x) { return x * 26; }
+inline int f8826_27(int x) { return x * 27; }
+inline int f8826_28(int x) { return x * 28; }
+inline int f8826_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8827 */
+#include <vector>
+#include "h1506.h"
+#include "h585.h"
+#include "h5563.h"
+#include "h4232.h"
+#include "h8886.h"
+#ifdef X
+#include "h4908.h"
+#endif
+struct S8827 { int a; const char *s = "x//y"; };
+inline int f8827_0(int x) { return x * 0; }
+inline int f8827_1(int x) { return x * 1; }
+inline int f8827_2(int x) { return x * 2; }
+inline int f8827_3(int x) { return x * 3; }
+inline int f8827_4(int x) { return x * 4; }
+inline int f8827_5(int x) { return x * 5; }
+inline int f8827_6(int x) { return x * 6; }
+inline int f8827_7(int x) { return x * 7; }
+inline int f8827_8(int x) { return x * 8; }
+inline int f8827_9(int x) { return x * 9; }
+inline int f8827_10(int x) { return x * 10; }
+inline int f8827_11(int x) { return x * 11; }
+inline int f8827_12(int x) { return x * 12; }
+inline int f8827_13(int x) { return x * 13; }
+inline int f8827_14(int x) { return x * 14; }
+inline int f8827_15(int x) { return x * 15; }
+inline int f8827_16(int x) { return x * 16; }
+inline int f8827_17(int x) { return x * 17; }
+inline int f8827_18(int x) { return x * 18; }
+inline int f8827_19(int x) { return x * 19; }
+inline int f8827_20(int x) { return x * 20; }
+inline int f8827_21(int x) { return x * 21; }
+inline int f8827_22(int x) { return x * 22; }
+inline int f8827_23(int x) { return x * 23; }
+inline int f8827_24(int x) { return x * 24; }
+inline int f8827_25(int x) { return x * 25; }
+inline int f8827_26(int x) { return x * 26; }
+inline int f8827_27(int x) { return x * 27; }
+inline int f8827_28(int x) { return x * 28; }
+inline int f8827_29(int x) { return x * 29; }
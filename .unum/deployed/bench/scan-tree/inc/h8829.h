@@ -0,0 +1,42 @@
+#pragma once
+/* header 8829 */
+#include <vector>
+#include "h2048.h"
+#include "h4155.h"
+#include "h3482.h"
+#include "h2876.h"
+#include "h9432.h"
+#ifdef X
+#include "h4187.h"
+#endif
+struct S8829 { int a; const char *s = "x//y"; };
+inline int f8829_0(int x) { return x * 0; }
+inline int f8829_1(int x) { return x * 1; }
+inline int f8829_2(int x) { return x * 2; }
+inline int f8829_3(int x) { return x * 3; }
+inline int f8829_4(int x) { return x * 4; }
+inline int f8829_5(int x) { return x * 5; }
+inline int f8829_6(int x) { return x * 6; }
+inline int f8829_7(int x) { return x * 7; }
+inline int f8829_8(int x) { return x * 8; }
+inline int f8829_9(int x) { return x * 9; }
+inline int f8829_10(int x) { return x * 10; }
+inline int f8829_11(int x) { return x * 11; }
+inline int f8829_12(int x) { return x * 12; }
+inline int f8829_13(int x) { return x * 13; }
+inline int f8829_14(int x) { return x * 14; }
+inline int f8829_15(int x) { return x * 15; }
+inline int f8829_16(int x) { return x * 16; }
+inline int f8829_17(int x) { return x * 17; }
+inline int f8829_18(int x) { return x * 18; }
+inline int f8829_19(int x) { return x * 19; }
+inline int f8829_20(int x) { return x * 20; }
+inline int f8829_21(int x) { return x * 21; }
+inline int f8829_22(int x) { return x * 22; }
+inline int f8829_23(int x) { return x * 23; }
+inline int f8829_24(int x) { return x * 24; }
+inline int f8829_25(int x) { return x * 25; }
+inline int f8829_26(int x) { return x * 26; }
+inline int f8829_27(int x) { return x * 27; }
+inline int f8829_28(int x) { return x * 28; }
+inline int f8829_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8830 */
+#include <vector>
+#include "h3684.h"
+#include "h4214.h"
+#include "h7270.h"
+#include "h8080.h"
+#include "h3827.h"
+#ifdef X
+#include "h401.h"
+#endif
+struct S8830 { int a; const char *s = "x//y"; };
+inline int f8830_0(int x) { return x * 0; }
+inline int f8830_1(int x) { return x * 1; }
+inline int f8830_2(int x) { return x * 2; }
+inline int f8830_3(int x) { return x * 3; }
+inline int f8830_4(int x) { return x * 4; }
+inline int f8830_5(int x) { return x * 5; }
+inline int f8830_6(int x) { return x * 6; }
+inline int f8830_7(int x) { return x * 7; }
+inline int f8830_8(int x) { return x * 8; }
+inline int f8830_9(int x) { return x * 9; }
+inline int f8830_10(int x) { return x * 10; }
+inline int f8830_11(int x) { return x * 11; }
+inline int f8830_12(int x) { return x * 12; }
+inline int f8830_13(int x) { return x * 13; }
+inline int f8830_14(int x) { return x * 14; }
+inline int f8830_15(int x) { return x * 15; }
+inline int f8830_16(int x) { return x * 16; }
+inline int f8830_17(int x) { return x * 17; }
+inline int f8830_18(int x) { return x * 18; }
+inline int f8830_19(int x) { return x * 19; }
+inline int f8830_20(int x) { return x * 20; }
+inline int f8830_21(int x) { return x * 21; }
+inline int f8830_22(int x) { return x * 22; }
+inline int f8830_23(int x) { return x * 23; }
+inline int f8830_24(int x) { return x * 24; }
+inline int f8830_25(int x) { return x * 25; }
+inline int f8830_26(int x) { return x * 26; }
+inline int f8830_27(int x) { return x * 27; }
+inline int f8830_28(int x) { return x * 28; }
+inline int f8830_29(int x) { return x * 29; }
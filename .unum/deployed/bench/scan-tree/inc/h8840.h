@@ -0,0 +1,42 @@
+#pragma once
+/* header 8840 */
+#include <vector>
+#include "h2636.h"
+#include "h1333.h"
+#include "h3240.h"
+#include "h870.h"
+#include "h5191.h"
+#ifdef X
+#include "h6130.h"
+#endif
+struct S8840 { int a; const char *s = "x//y"; };
+inline int f8840_0(int x) { return x * 0; }
+inline int f8840_1(int x) { return x * 1; }
+inline int f8840_2(int x) { return x * 2; }
+inline int f8840_3(int x) { return x * 3; }
+inline int f8840_4(int x) { return x * 4; }
+inline int f8840_5(int x) { return x * 5; }
+inline int f8840_6(int x) { return x * 6; }
+inline int f8840_7(int x) { return x * 7; }
+inline int f8840_8(int x) { return x * 8; }
+inline int f8840_9(int x) { return x * 9; }
+inline int f8840_10(int x) { return x * 10; }
+inline int f8840_11(int x) { return x * 11; }
+inline int f8840_12(int x) { return x * 12; }
+inline int f8840_13(int x) { return x * 13; }
+inline int f8840_14(int x) { return x * 14; }
+inline int f8840_15(int x) { return x * 15; }
+inline int f8840_16(int x) { return x * 16; }
+inline int f8840_17(int x) { return x * 17; }
+inline int f8840_18(int x) { return x * 18; }
+inline int f8840_19(int x) { return x * 19; }
+inline int f8840_20(int x) { return x * 20; }
+inline int f8840_21(int x) { return x * 21; }
+inline int f8840_22(int x) { return x * 22; }
+inline int f8840_23(int x) { return x * 23; }
+inline int f8840_24(int x) { return x * 24; }
+inline int f8840_25(int x) { return x * 25; }
+inline int f8840_26(int x) { return x * 26; }
+inline int f8840_27(int x) { return x * 27; }
+inline int f8840_28(int x) { return x * 28; }
+inline int f8840_29(int x) { return x * 29; }
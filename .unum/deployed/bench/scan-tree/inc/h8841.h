@@ -0,0 +1,42 @@
+#pragma once
+/* header 8841 */
+#include <vector>
+#include "h3636.h"
+#include "h4835.h"
+#include "h98.h"
+#include "h638.h"
+#include "h9517.h"
+#ifdef X
+#include "h4348.h"
+#endif
+struct S8841 { int a; const char *s = "x//y"; };
+inline int f8841_0(int x) { return x * 0; }
+inline int f8841_1(int x) { return x * 1; }
+inline int f8841_2(int x) { return x * 2; }
+inline int f8841_3(int x) { return x * 3; }
+inline int f8841_4(int x) { return x * 4; }
+inline int f8841_5(int x) { return x * 5; }
+inline int f8841_6(int x) { return x * 6; }
+inline int f8841_7(int x) { return x * 7; }
+inline int f8841_8(int x) { return x * 8; }
+inline int f8841_9(int x) { return x * 9; }
+inline int f8841_10(int x) { return x * 10; }
+inline int f8841_11(int x) { return x * 11; }
+inline int f8841_12(int x) { return x * 12; }
+inline int f8841_13(int x) { return x * 13; }
+inline int f8841_14(int x) { return x * 14; }
+inline int f8841_15(int x) { return x * 15; }
+inline int f8841_16(int x) { return x * 16; }
+inline int f8841_17(int x) { return x * 17; }
+inline int f8841_18(int x) { return x * 18; }
+inline int f8841_19(int x) { return x * 19; }
+inline int f8841_20(int x) { return x * 20; }
+inline int f8841_21(int x) { return x * 21; }
+inline int f8841_22(int x) { return x * 22; }
+inline int f8841_23(int x) { return x * 23; }
+inline int f8841_24(int x) { return x * 24; }
+inline int f8841_25(int x) { return x * 25; }
+inline int f8841_26(int x) { return x * 26; }
+inline int f8841_27(int x) { return x * 27; }
+inline int f8841_28(int x) { return x * 28; }
+inline int f8841_29(int x) { return x * 29; }
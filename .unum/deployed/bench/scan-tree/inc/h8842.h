@@ -0,0 +1,42 @@
+#pragma once
+/* header 8842 */
+#include <vector>
+#include "h819.h"
+#include "h8897.h"
+#include "h9942.h"
+#include "h1757.h"
+#include "h9029.h"
+#ifdef X
+#include "h9779.h"
+#endif
+struct S8842 { int a; const char *s = "x//y"; };
+inline int f8842_0(int x) { return x * 0; }
+inline int f8842_1(int x) { return x * 1; }
+inline int f8842_2(int x) { return x * 2; }
+inline int f8842_3(int x) { return x * 3; }
+inline int f8842_4(int x) { return x * 4; }
+inline int f8842_5(int x) { return x * 5; }
+inline int f8842_6(int x) { return x * 6; }
+inline int f8842_7(int x) { return x * 7; }
+inline int f8842_8(int x) { return x * 8; }
+inline int f8842_9(int x) { return x * 9; }
+inline int f8842_10(int x) { return x * 10; }
+inline int f8842_11(int x) { return x * 11; }
+inline int f8842_12(int x) { return x * 12; }
+inline int f8842_13(int x) { return x * 13; }
+inline int f8842_14(int x) { return x * 14; }
+inline int f8842_15(int x) { return x * 15; }
+inline int f8842_16(int x) { return x * 16; }
+inline int f8842_17(int x) { return x * 17; }
+inline int f8842_18(int x) { return x * 18; }
+inline int f8842_19(int x) { return x * 19; }
+inline int f8842_20(int x) { return x * 20; }
+inline int f8842_21(int x) { return x * 21; }
+inline int f8842_22(int x) { return x * 22; }
+inline int f8842_23(int x) { return x * 23; }
+inline int f8842_24(int x) { return x * 24; }
+inline int f8842_25(int x) { return x * 25; }
+inline int f8842_26(int x) { return x * 26; }
+inline int f8842_27(int x) { return x * 27; }
+inline int f8842_28(int x) { return x * 28; }
+inline int f8842_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8843 */
+#include <vector>
+#include "h5891.h"
+#include "h5892.h"
+#include "h4700.h"
+#include "h2317.h"
+#include "h3206.h"
+#ifdef X
+#include "h5471.h"
+#endif
+struct S8843 { int a; const char *s = "x//y"; };
+inline int f8843_0(int x) { return x * 0; }
+inline int f8843_1(int x) { return x * 1; }
+inline int f8843_2(int x) { return x * 2; }
+inline int f8843_3(int x) { return x * 3; }
+inline int f8843_4(int x) { return x * 4; }
+inline int f8843_5(int x) { return x * 5; }
+inline int f8843_6(int x) { return x * 6; }
+inline int f8843_7(int x) { return x * 7; }
+inline int f8843_8(int x) { return x * 8; }
+inline int f8843_9(int x) { return x * 9; }
+inline int f8843_10(int x) { return x * 10; }
+inline int f8843_11(int x) { return x * 11; }
+inline int f8843_12(int x) { return x * 12; }
+inline int f8843_13(int x) { return x * 13; }
+inline int f8843_14(int x) { return x * 14; }
+inline int f8843_15(int x) { return x * 15; }
+inline int f8843_16(int x) { return x * 16; }
+inline int f8843_17(int x) { return x * 17; }
+inline int f8843_18(int x) { return x * 18; }
+inline int f8843_19(int x) { return x * 19; }
+inline int f8843_20(int x) { return x * 20; }
+inline int f8843_21(int x) { return x * 21; }
+inline int f8843_22(int x) { return x * 22; }
+inline int f8843_23(int x) { return x * 23; }
+inline int f8843_24(int x) { return x * 24; }
+inline int f8843_25(int x) { return x * 25; }
+inline int f8843_26(int x) { return x * 26; }
+inline int f8843_27(int x) { return x * 27; }
+inline int f8843_28(int x) { return x * 28; }
+inline int f8843_29(int x) { return x * 29; }
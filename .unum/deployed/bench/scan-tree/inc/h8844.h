@@ -0,0 +1,42 @@
+#pragma once
+/* header 8844 */
+#include <vector>
+#include "h95.h"
+#include "h5086.h"
+#include "h9540.h"
+#include "h9970.h"
+#include "h130.h"
+#ifdef X
+#include "h6441.h"
+#endif
+struct S8844 { int a; const char *s = "x//y"; };
+inline int f8844_0(int x) { return x * 0; }
+inline int f8844_1(int x) { return x * 1; }
+inline int f8844_2(int x) { return x * 2; }
+inline int f8844_3(int x) { return x * 3; }
+inline int f8844_4(int x) { return x * 4; }
+inline int f8844_5(int x) { return x * 5; }
+inline int f8844_6(int x) { return x * 6; }
+inline int f8844_7(int x) { return x * 7; }
+inline int f8844_8(int x) { return x * 8; }
+inline int f8844_9(int x) { return x * 9; }
+inline int f8844_10(int x) { return x * 10; }
+inline int f8844_11(int x) { return x * 11; }
+inline int f8844_12(int x) { return x * 12; }
+inline int f8844_13(int x) { return x * 13; }
+inline int f8844_14(int x) { return x * 14; }
+inline int f8844_15(int x) { return x * 15; }
+inline int f8844_16(int x) { return x * 16; }
+inline int f8844_17(int x) { return x * 17; }
+inline int f8844_18(int x) { return x * 18; }
+inline int f8844_19(int x) { return x * 19; }
+inline int f8844_20(int x) { return x * 20; }
+inline int f8844_21(int x) { return x * 21; }
+inline int f8844_22(int x) { return x * 22; }
+inline int f8844_23(int x) { return x * 23; }
+inline int f8844_24(int x) { return x * 24; }
+inline int f8844_25(int x) { return x * 25; }
+inline int f8844_26(int x) { return x * 26; }
+inline int f8844_27(int x) { return x * 27; }
+inline int f8844_28(int x) { return x * 28; }
+inline int f8844_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8845 */
+#include <vector>
+#include "h8008.h"
+#include "h2823.h"
+#include "h4348.h"
+#include "h880.h"
+#include "h3885.h"
+#ifdef X
+#include "h9521.h"
+#endif
+struct S8845 { int a; const char *s = "x//y"; };
+inline int f8845_0(int x) { return x * 0; }
+inline int f8845_1(int x) { return x * 1; }
+inline int f8845_2(int x) { return x * 2; }
+inline int f8845_3(int x) { return x * 3; }
+inline int f8845_4(int x) { return x * 4; }
+inline int f8845_5(int x) { return x * 5; }
+inline int f8845_6(int x) { return x * 6; }
+inline int f8845_7(int x) { return x * 7; }
+inline int f8845_8(int x) { return x * 8; }
+inline int f8845_9(int x) { return x * 9; }
+inline int f8845_10(int x) { return x * 10; }
+inline int f8845_11(int x) { return x * 11; }
+inline int f8845_12(int x) { return x * 12; }
+inline int f8845_13(int x) { return x * 13; }
+inline int f8845_14(int x) { return x * 14; }
+inline int f8845_15(int x) { return x * 15; }
+inline int f8845_16(int x) { return x * 16; }
+inline int f8845_17(int x) { return x * 17; }
+inline int f8845_18(int x) { return x * 18; }
+inline int f8845_19(int x) { return x * 19; }
+inline int f8845_20(int x) { return x * 20; }
+inline int f8845_21(int x) { return x * 21; }
+inline int f8845_22(int x) { return x * 22; }
+inline int f8845_23(int x) { return x * 23; }
+inline int f8845_24(int x) { return x * 24; }
+inline int f8845_25(int x) { return x * 25; }
+inline int f8845_26(int x) { return x * 26; }
+inline int f8845_27(int x) { return x * 27; }
+inline int f8845_28(int x) { return x * 28; }
+inline int f8845_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8846 */
+#include <vector>
+#include "h3770.h"
+#include "h9902.h"
+#include "h9061.h"
+#include "h7822.h"
+#include "h5979.h"
+#ifdef X
+#include "h2257.h"
+#endif
+struct S8846 { int a; const char *s = "x//y"; };
+inline int f8846_0(int x) { return x * 0; }
+inline int f8846_1(int x) { return x * 1; }
+inline int f8846_2(int x) { return x * 2; }
+inline int f8846_3(int x) { return x * 3; }
+inline int f8846_4(int x) { return x * 4; }
+inline int f8846_5(int x) { return x * 5; }
+inline int f8846_6(int x) { return x * 6; }
+inline int f8846_7(int x) { return x * 7; }
+inline int f8846_8(int x) { return x * 8; }
+inline int f8846_9(int x) { return x * 9; }
+inline int f8846_10(int x) { return x * 10; }
+inline int f8846_11(int x) { return x * 11; }
+inline int f8846_12(int x) { return x * 12; }
+inline int f8846_13(int x) { return x * 13; }
+inline int f8846_14(int x) { return x * 14; }
+inline int f8846_15(int x) { return x * 15; }
+inline int f8846_16(int x) { return x * 16; }
+inline int f8846_17(int x) { return x * 17; }
+inline int f8846_18(int x) { return x * 18; }
+inline int f8846_19(int x) { return x * 19; }
+inline int f8846_20(int x) { return x * 20; }
+inline int f8846_21(int x) { return x * 21; }
+inline int f8846_22(int x) { return x * 22; }
+inline int f8846_23(int x) { return x * 23; }
+inline int f8846_24(int x) { return x * 24; }
+inline int f8846_25(int x) { return x * 25; }
+inline int f8846_26(int x) { return x * 26; }
+inline int f8846_27(int x) { return x * 27; }
+inline int f8846_28(int x) { return x * 28; }
+inline int f8846_29(int x) { return x * 29; }
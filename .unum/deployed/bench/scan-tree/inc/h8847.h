@@ -0,0 +1,42 @@
+#pragma once
+/* header 8847 */
+#include <vector>
+#include "h5549.h"
+#include "h2827.h"
+#include "h2548.h"
+#include "h5802.h"
+#include "h5898.h"
+#ifdef X
+#include "h425.h"
+#endif
+struct S8847 { int a; const char *s = "x//y"; };
+inline int f8847_0(int x) { return x * 0; }
+inline int f8847_1(int x) { return x * 1; }
+inline int f8847_2(int x) { return x * 2; }
+inline int f8847_3(int x) { return x * 3; }
+inline int f8847_4(int x) { return x * 4; }
+inline int f8847_5(int x) { return x * 5; }
+inline int f8847_6(int x) { return x * 6; }
+inline int f8847_7(int x) { return x * 7; }
+inline int f8847_8(int x) { return x * 8; }
+inline int f8847_9(int x) { return x * 9; }
+inline int f8847_10(int x) { return x * 10; }
+inline int f8847_11(int x) { return x * 11; }
+inline int f8847_12(int x) { return x * 12; }
+inline int f8847_13(int x) { return x * 13; }
+inline int f8847_14(int x) { return x * 14; }
+inline int f8847_15(int x) { return x * 15; }
+inline int f8847_16(int x) { return x * 16; }
+inline int f8847_17(int x) { return x * 17; }
+inline int f8847_18(int x) { return x * 18; }
+inline int f8847_19(int x) { return x * 19; }
+inline int f8847_20(int x) { return x * 20; }
+inline int f8847_21(int x) { return x * 21; }
+inline int f8847_22(int x) { return x * 22; }
+inline int f8847_23(int x) { return x * 23; }
+inline int f8847_24(int x) { return x * 24; }
+inline int f8847_25(int x) { return x * 25; }
+inline int f8847_26(int x) { return x * 26; }
+inline int f8847_27(int x) { return x * 27; }
+inline int f8847_28(int x) { return x * 28; }
+inline int f8847_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8848 */
+#include <vector>
+#include "h1583.h"
+#include "h9278.h"
+#include "h6702.h"
+#include "h6735.h"
+#include "h5773.h"
+#ifdef X
+#include "h1131.h"
+#endif
+struct S8848 { int a; const char *s = "x//y"; };
+inline int f8848_0(int x) { return x * 0; }
+inline int f8848_1(int x) { return x * 1; }
+inline int f8848_2(int x) { return x * 2; }
+inline int f8848_3(int x) { return x * 3; }
+inline int f8848_4(int x) { return x * 4; }
+inline int f8848_5(int x) { return x * 5; }
+inline int f8848_6(int x) { return x * 6; }
+inline int f8848_7(int x) { return x * 7; }
+inline int f8848_8(int x) { return x * 8; }
+inline int f8848_9(int x) { return x * 9; }
+inline int f8848_10(int x) { return x * 10; }
+inline int f8848_11(int x) { return x * 11; }
+inline int f8848_12(int x) { return x * 12; }
+inline int f8848_13(int x) { return x * 13; }
+inline int f8848_14(int x) { return x * 14; }
+inline int f8848_15(int x) { return x * 15; }
+inline int f8848_16(int x) { return x * 16; }
+inline int f8848_17(int x) { return x * 17; }
+inline int f8848_18(int x) { return x * 18; }
+inline int f8848_19(int x) { return x * 19; }
+inline int f8848_20(int x) { return x * 20; }
+inline int f8848_21(int x) { return x * 21; }
+inline int f8848_22(int x) { return x * 22; }
+inline int f8848_23(int x) { return x * 23; }
+inline int f8848_24(int x) { return x * 24; }
+inline int f8848_25(int x) { return x * 25; }
+inline int f8848_26(int x) { return x * 26; }
+inline int f8848_27(int x) { return x * 27; }
+inline int f8848_28(int x) { return x * 28; }
+inline int f8848_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8850 */
+#include <vector>
+#include "h8610.h"
+#include "h3881.h"
+#include "h2049.h"
+#include "h5717.h"
+#include "h6842.h"
+#ifdef X
+#include "h1605.h"
+#endif
+struct S8850 { int a; const char *s = "x//y"; };
+inline int f8850_0(int x) { return x * 0; }
+inline int f8850_1(int x) { return x * 1; }
+inline int f8850_2(int x) { return x * 2; }
+inline int f8850_3(int x) { return x * 3; }
+inline int f8850_4(int x) { return x * 4; }
+inline int f8850_5(int x) { return x * 5; }
+inline int f8850_6(int x) { return x * 6; }
+inline int f8850_7(int x) { return x * 7; }
+inline int f8850_8(int x) { return x * 8; }
+inline int f8850_9(int x) { return x * 9; }
+inline int f8850_10(int x) { return x * 10; }
+inline int f8850_11(int x) { return x * 11; }
+inline int f8850_12(int x) { return x * 12; }
+inline int f8850_13(int x) { return x * 13; }
+inline int f8850_14(int x) { return x * 14; }
+inline int f8850_15(int x) { return x * 15; }
+inline int f8850_16(int x) { return x * 16; }
+inline int f8850_17(int x) { return x * 17; }
+inline int f8850_18(int x) { return x * 18; }
+inline int f8850_19(int x) { return x * 19; }
+inline int f8850_20(int x) { return x * 20; }
+inline int f8850_21(int x) { return x * 21; }
+inline int f8850_22(int x) { return x * 22; }
+inline int f8850_23(int x) { return x * 23; }
+inline int f8850_24(int x) { return x * 24; }
+inline int f8850_25(int x) { return x * 25; }
+inline int f8850_26(int x) { return x * 26; }
+inline int f8850_27(int x) { return x * 27; }
+inline int f8850_28(int x) { return x * 28; }
+inline int f8850_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8852 */
+#include <vector>
+#include "h8697.h"
+#include "h2244.h"
+#include "h6709.h"
+#include "h252.h"
+#include "h1753.h"
+#ifdef X
+#include "h4114.h"
+#endif
+struct S8852 { int a; const char *s = "x//y"; };
+inline int f8852_0(int x) { return x * 0; }
+inline int f8852_1(int x) { return x * 1; }
+inline int f8852_2(int x) { return x * 2; }
+inline int f8852_3(int x) { return x * 3; }
+inline int f8852_4(int x) { return x * 4; }
+inline int f8852_5(int x) { return x * 5; }
+inline int f8852_6(int x) { return x * 6; }
+inline int f8852_7(int x) { return x * 7; }
+inline int f8852_8(int x) { return x * 8; }
+inline int f8852_9(int x) { return x * 9; }
+inline int f8852_10(int x) { return x * 10; }
+inline int f8852_11(int x) { return x * 11; }
+inline int f8852_12(int x) { return x * 12; }
+inline int f8852_13(int x) { return x * 13; }
+inline int f8852_14(int x) { return x * 14; }
+inline int f8852_15(int x) { return x * 15; }
+inline int f8852_16(int x) { return x * 16; }
+inline int f8852_17(int x) { return x * 17; }
+inline int f8852_18(int x) { return x * 18; }
+inline int f8852_19(int x) { return x * 19; }
+inline int f8852_20(int x) { return x * 20; }
+inline int f8852_21(int x) { return x * 21; }
+inline int f8852_22(int x) { return x * 22; }
+inline int f8852_23(int x) { return x * 23; }
+inline int f8852_24(int x) { return x * 24; }
+inline int f8852_25(int x) { return x * 25; }
+inline int f8852_26(int x) { return x * 26; }
+inline int f8852_27(int x) { return x * 27; }
+inline int f8852_28(int x) { return x * 28; }
+inline int f8852_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8855 */
+#include <vector>
+#include "h3712.h"
+#include "h3258.h"
+#include "h9505.h"
+#include "h6417.h"
+#include "h7409.h"
+#ifdef X
+#include "h1029.h"
+#endif
+struct S8855 { int a; const char *s = "x//y"; };
+inline int f8855_0(int x) { return x * 0; }
+inline int f8855_1(int x) { return x * 1; }
+inline int f8855_2(int x) { return x * 2; }
+inline int f8855_3(int x) { return x * 3; }
+inline int f8855_4(int x) { return x * 4; }
+inline int f8855_5(int x) { return x * 5; }
+inline int f8855_6(int x) { return x * 6; }
+inline int f8855_7(int x) { return x * 7; }
+inline int f8855_8(int x) { return x * 8; }
+inline int f8855_9(int x) { return x * 9; }
+inline int f8855_10(int x) { return x * 10; }
+inline int f8855_11(int x) { return x * 11; }
+inline int f8855_12(int x) { return x * 12; }
+inline int f8855_13(int x) { return x * 13; }
+inline int f8855_14(int x) { return x * 14; }
+inline int f8855_15(int x) { return x * 15; }
+inline int f8855_16(int x) { return x * 16; }
+inline int f8855_17(int x) { return x * 17; }
+inline int f8855_18(int x) { return x * 18; }
+inline int f8855_19(int x) { return x * 19; }
+inline int f8855_20(int x) { return x * 20; }
+inline int f8855_21(int x) { return x * 21; }
+inline int f8855_22(int x) { return x * 22; }
+inline int f8855_23(int x) { return x * 23; }
+inline int f8855_24(int x) { return x * 24; }
+inline int f8855_25(int x) { return x * 25; }
+inline int f8855_26(int x) { return x * 26; }
+inline int f8855_27(int x) { return x * 27; }
+inline int f8855_28(int x) { return x * 28; }
+inline int f8855_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8856 */
+#include <vector>
+#include "h8673.h"
+#include "h8923.h"
+#include "h3231.h"
+#include "h8670.h"
+#include "h1216.h"
+#ifdef X
+#include "h3656.h"
+#endif
+struct S8856 { int a; const char *s = "x//y"; };
+inline int f8856_0(int x) { return x * 0; }
+inline int f8856_1(int x) { return x * 1; }
+inline int f8856_2(int x) { return x * 2; }
+inline int f8856_3(int x) { return x * 3; }
+inline int f8856_4(int x) { return x * 4; }
+inline int f8856_5(int x) { return x * 5; }
+inline int f8856_6(int x) { return x * 6; }
+inline int f8856_7(int x) { return x * 7; }
+inline int f8856_8(int x) { return x * 8; }
+inline int f8856_9(int x) { return x * 9; }
+inline int f8856_10(int x) { return x * 10; }
+inline int f8856_11(int x) { return x * 11; }
+inline int f8856_12(int x) { return x * 12; }
+inline int f8856_13(int x) { return x * 13; }
+inline int f8856_14(int x) { return x * 14; }
+inline int f8856_15(int x) { return x * 15; }
+inline int f8856_16(int x) { return x * 16; }
+inline int f8856_17(int x) { return x * 17; }
+inline int f8856_18(int x) { return x * 18; }
+inline int f8856_19(int x) { return x * 19; }
+inline int f8856_20(int x) { return x * 20; }
+inline int f8856_21(int x) { return x * 21; }
+inline int f8856_22(int x) { return x * 22; }
+inline int f8856_23(int x) { return x * 23; }
+inline int f8856_24(int x) { return x * 24; }
+inline int f8856_25(int x) { return x * 25; }
+inline int f8856_26(int x) { return x * 26; }
+inline int f8856_27(int x) { return x * 27; }
+inline int f8856_28(int x) { return x * 28; }
+inline int f8856_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8859 */
+#include <vector>
+#include "h6288.h"
+#include "h3939.h"
+#include "h9535.h"
+#include "h5520.h"
+#include "h6730.h"
+#ifdef X
+#include "h6624.h"
+#endif
+struct S8859 { int a; const char *s = "x//y"; };
+inline int f8859_0(int x) { return x * 0; }
+inline int f8859_1(int x) { return x * 1; }
+inline int f8859_2(int x) { return x * 2; }
+inline int f8859_3(int x) { return x * 3; }
+inline int f8859_4(int x) { return x * 4; }
+inline int f8859_5(int x) { return x * 5; }
+inline int f8859_6(int x) { return x * 6; }
+inline int f8859_7(int x) { return x * 7; }
+inline int f8859_8(int x) { return x * 8; }
+inline int f8859_9(int x) { return x * 9; }
+inline int f8859_10(int x) { return x * 10; }
+inline int f8859_11(int x) { return x * 11; }
+inline int f8859_12(int x) { return x * 12; }
+inline int f8859_13(int x) { return x * 13; }
+inline int f8859_14(int x) { return x * 14; }
+inline int f8859_15(int x) { return x * 15; }
+inline int f8859_16(int x) { return x * 16; }
+inline int f8859_17(int x) { return x * 17; }
+inline int f8859_18(int x) { return x * 18; }
+inline int f8859_19(int x) { return x * 19; }
+inline int f8859_20(int x) { return x * 20; }
+inline int f8859_21(int x) { return x * 21; }
+inline int f8859_22(int x) { return x * 22; }
+inline int f8859_23(int x) { return x * 23; }
+inline int f8859_24(int x) { return x * 24; }
+inline int f8859_25(int x) { return x * 25; }
+inline int f8859_26(int x) { return x * 26; }
+inline int f8859_27(int x) { return x * 27; }
+inline int f8859_28(int x) { return x * 28; }
+inline int f8859_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8863 */
+#include <vector>
+#include "h5598.h"
+#include "h8815.h"
+#include "h5441.h"
+#include "h7151.h"
+#include "h3277.h"
+#ifdef X
+#include "h8121.h"
+#endif
+struct S8863 { int a; const char *s = "x//y"; };
+inline int f8863_0(int x) { return x * 0; }
+inline int f8863_1(int x) { return x * 1; }
+inline int f8863_2(int x) { return x * 2; }
+inline int f8863_3(int x) { return x * 3; }
+inline int f8863_4(int x) { return x * 4; }
+inline int f8863_5(int x) { return x * 5; }
+inline int f8863_6(int x) { return x * 6; }
+inline int f8863_7(int x) { return x * 7; }
+inline int f8863_8(int x) { return x * 8; }
+inline int f8863_9(int x) { return x * 9; }
+inline int f8863_10(int x) { return x * 10; }
+inline int f8863_11(int x) { return x * 11; }
+inline int f8863_12(int x) { return x * 12; }
+inline int f8863_13(int x) { return x * 13; }
+inline int f8863_14(int x) { return x * 14; }
+inline int f8863_15(int x) { return x * 15; }
+inline int f8863_16(int x) { return x * 16; }
+inline int f8863_17(int x) { return x * 17; }
+inline int f8863_18(int x) { return x * 18; }
+inline int f8863_19(int x) { return x * 19; }
+inline int f8863_20(int x) { return x * 20; }
+inline int f8863_21(int x) { return x * 21; }
+inline int f8863_22(int x) { return x * 22; }
+inline int f8863_23(int x) { return x * 23; }
+inline int f8863_24(int x) { return x * 24; }
+inline int f8863_25(int x) { return x * 25; }
+inline int f8863_26(int x) { return x * 26; }
+inline int f8863_27(int x) { return x * 27; }
+inline int f8863_28(int x) { return x * 28; }
+inline int f8863_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8864 */
+#include <vector>
+#include "h5830.h"
+#include "h6948.h"
+#include "h5366.h"
+#include "h501.h"
+#include "h1718.h"
+#ifdef X
+#include "h455.h"
+#endif
+struct S8864 { int a; const char *s = "x//y"; };
+inline int f8864_0(int x) { return x * 0; }
+inline int f8864_1(int x) { return x * 1; }
+inline int f8864_2(int x) { return x * 2; }
+inline int f8864_3(int x) { return x * 3; }
+inline int f8864_4(int x) { return x * 4; }
+inline int f8864_5(int x) { return x * 5; }
+inline int f8864_6(int x) { return x * 6; }
+inline int f8864_7(int x) { return x * 7; }
+inline int f8864_8(int x) { return x * 8; }
+inline int f8864_9(int x) { return x * 9; }
+inline int f8864_10(int x) { return x * 10; }
+inline int f8864_11(int x) { return x * 11; }
+inline int f8864_12(int x) { return x * 12; }
+inline int f8864_13(int x) { return x * 13; }
+inline int f8864_14(int x) { return x * 14; }
+inline int f8864_15(int x) { return x * 15; }
+inline int f8864_16(int x) { return x * 16; }
+inline int f8864_17(int x) { return x * 17; }
+inline int f8864_18(int x) { return x * 18; }
+inline int f8864_19(int x) { return x * 19; }
+inline int f8864_20(int x) { return x * 20; }
+inline int f8864_21(int x) { return x * 21; }
+inline int f8864_22(int x) { return x * 22; }
+inline int f8864_23(int x) { return x * 23; }
+inline int f8864_24(int x) { return x * 24; }
+inline int f8864_25(int x) { return x * 25; }
+inline int f8864_26(int x) { return x * 26; }
+inline int f8864_27(int x) { return x * 27; }
+inline int f8864_28(int x) { return x * 28; }
+inline int f8864_29(int x) { return x * 29; }
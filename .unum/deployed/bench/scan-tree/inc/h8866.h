@@ -0,0 +1,42 @@
+#pragma once
+/* header 8866 */
+#include <vector>
+#include "h9961.h"
+#include "h8420.h"
+#include "h7461.h"
+#include "h7074.h"
+#include "h2028.h"
+#ifdef X
+#include "h8037.h"
+#endif
+struct S8866 { int a; const char *s = "x//y"; };
+inline int f8866_0(int x) { return x * 0; }
+inline int f8866_1(int x) { return x * 1; }
+inline int f8866_2(int x) { return x * 2; }
+inline int f8866_3(int x) { return x * 3; }
+inline int f8866_4(int x) { return x * 4; }
+inline int f8866_5(int x) { return x * 5; }
+inline int f8866_6(int x) { return x * 6; }
+inline int f8866_7(int x) { return x * 7; }
+inline int f8866_8(int x) { return x * 8; }
+inline int f8866_9(int x) { return x * 9; }
+inline int f8866_10(int x) { return x * 10; }
+inline int f8866_11(int x) { return x * 11; }
+inline int f8866_12(int x) { return x * 12; }
+inline int f8866_13(int x) { return x * 13; }
+inline int f8866_14(int x) { return x * 14; }
+inline int f8866_15(int x) { return x * 15; }
+inline int f8866_16(int x) { return x * 16; }
+inline int f8866_17(int x) { return x * 17; }
+inline int f8866_18(int x) { return x * 18; }
+inline int f8866_19(int x) { return x * 19; }
+inline int f8866_20(int x) { return x * 20; }
+inline int f8866_21(int x) { return x * 21; }
+inline int f8866_22(int x) { return x * 22; }
+inline int f8866_23(int x) { return x * 23; }
+inline int f8866_24(int x) { return x * 24; }
+inline int f8866_25(int x) { return x * 25; }
+inline int f8866_26(int x) { return x * 26; }
+inline int f8866_27(int x) { return x * 27; }
+inline int f8866_28(int x) { return x * 28; }
+inline int f8866_29(int x) { return x * 29; }
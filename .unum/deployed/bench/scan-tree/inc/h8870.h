@@ -0,0 +1,42 @@
+#pragma once
+/* header 8870 */
+#include <vector>
+#include "h2647.h"
+#include "h4314.h"
+#include "h9014.h"
+#include "h6945.h"
+#include "h1778.h"
+#ifdef X
+#include "h9304.h"
+#endif
+struct S8870 { int a; const char *s = "x//y"; };
+inline int f8870_0(int x) { return x * 0; }
+inline int f8870_1(int x) { return x * 1; }
+inline int f8870_2(int x) { return x * 2; }
+inline int f8870_3(int x) { return x * 3; }
+inline int f8870_4(int x) { return x * 4; }
+inline int f8870_5(int x) { return x * 5; }
+inline int f8870_6(int x) { return x * 6; }
+inline int f8870_7(int x) { return x * 7; }
+inline int f8870_8(int x) { return x * 8; }
+inline int f8870_9(int x) { return x * 9; }
+inline int f8870_10(int x) { return x * 10; }
+inline int f8870_11(int x) { return x * 11; }
+inline int f8870_12(int x) { return x * 12; }
+inline int f8870_13(int x) { return x * 13; }
+inline int f8870_14(int x) { return x * 14; }
+inline int f8870_15(int x) { return x * 15; }
+inline int f8870_16(int x) { return x * 16; }
+inline int f8870_17(int x) { return x * 17; }
+inline int f8870_18(int x) { return x * 18; }
+inline int f8870_19(int x) { return x * 19; }
+inline int f8870_20(int x) { return x * 20; }
+inline int f8870_21(int x) { return x * 21; }
+inline int f8870_22(int x) { return x * 22; }
+inline int f8870_23(int x) { return x * 23; }
+inline int f8870_24(int x) { return x * 24; }
+inline int f8870_25(int x) { return x * 25; }
+inline int f8870_26(int x) { return x * 26; }
+inline int f8870_27(int x) { return x * 27; }
+inline int f8870_28(int x) { return x * 28; }
+inline int f8870_29(int x) { return x * 29; }
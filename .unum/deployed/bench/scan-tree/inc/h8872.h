@@ -0,0 +1,42 @@
+#pragma once
+/* header 8872 */
+#include <vector>
+#include "h1373.h"
+#include "h8642.h"
+#include "h634.h"
+#include "h6687.h"
+#include "h3696.h"
+#ifdef X
+#include "h8612.h"
+#endif
+struct S8872 { int a; const char *s = "x//y"; };
+inline int f8872_0(int x) { return x * 0; }
+inline int f8872_1(int x) { return x * 1; }
+inline int f8872_2(int x) { return x * 2; }
+inline int f8872_3(int x) { return x * 3; }
+inline int f8872_4(int x) { return x * 4; }
+inline int f8872_5(int x) { return x * 5; }
+inline int f8872_6(int x) { return x * 6; }
+inline int f8872_7(int x) { return x * 7; }
+inline int f8872_8(int x) { return x * 8; }
+inline int f8872_9(int x) { return x * 9; }
+inline int f8872_10(int x) { return x * 10; }
+inline int f8872_11(int x) { return x * 11; }
+inline int f8872_12(int x) { return x * 12; }
+inline int f8872_13(int x) { return x * 13; }
+inline int f8872_14(int x) { return x * 14; }
+inline int f8872_15(int x) { return x * 15; }
+inline int f8872_16(int x) { return x * 16; }
+inline int f8872_17(int x) { return x * 17; }
+inline int f8872_18(int x) { return x * 18; }
+inline int f8872_19(int x) { return x * 19; }
+inline int f8872_20(int x) { return x * 20; }
+inline int f8872_21(int x) { return x * 21; }
+inline int f8872_22(int x) { return x * 22; }
+inline int f8872_23(int x) { return x * 23; }
+inline int f8872_24(int x) { return x * 24; }
+inline int f8872_25(int x) { return x * 25; }
+inline int f8872_26(int x) { return x * 26; }
+inline int f8872_27(int x) { return x * 27; }
+inline int f8872_28(int x) { return x * 28; }
+inline int f8872_29(int x) { return x * 29; }
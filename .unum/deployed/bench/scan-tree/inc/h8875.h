@@ -0,0 +1,42 @@
+#pragma once
+/* header 8875 */
+#include <vector>
+#include "h7430.h"
+#include "h2512.h"
+#include "h4358.h"
+#include "h3310.h"
+#include "h6957.h"
+#ifdef X
+#include "h4323.h"
+#endif
+struct S8875 { int a; const char *s = "x//y"; };
+inline int f8875_0(int x) { return x * 0; }
+inline int f8875_1(int x) { return x * 1; }
+inline int f8875_2(int x) { return x * 2; }
+inline int f8875_3(int x) { return x * 3; }
+inline int f8875_4(int x) { return x * 4; }
+inline int f8875_5(int x) { return x * 5; }
+inline int f8875_6(int x) { return x * 6; }
+inline int f8875_7(int x) { return x * 7; }
+inline int f8875_8(int x) { return x * 8; }
+inline int f8875_9(int x) { return x * 9; }
+inline int f8875_10(int x) { return x * 10; }
+inline int f8875_11(int x) { return x * 11; }
+inline int f8875_12(int x) { return x * 12; }
+inline int f8875_13(int x) { return x * 13; }
+inline int f8875_14(int x) { return x * 14; }
+inline int f8875_15(int x) { return x * 15; }
+inline int f8875_16(int x) { return x * 16; }
+inline int f8875_17(int x) { return x * 17; }
+inline int f8875_18(int x) { return x * 18; }
+inline int f8875_19(int x) { return x * 19; }
+inline int f8875_20(int x) { return x * 20; }
+inline int f8875_21(int x) { return x * 21; }
+inline int f8875_22(int x) { return x * 22; }
+inline int f8875_23(int x) { return x * 23; }
+inline int f8875_24(int x) { return x * 24; }
+inline int f8875_25(int x) { return x * 25; }
+inline int f8875_26(int x) { return x * 26; }
+inline int f8875_27(int x) { return x * 27; }
+inline int f8875_28(int x) { return x * 28; }
+inline int f8875_29(int x) { return x * 29; }
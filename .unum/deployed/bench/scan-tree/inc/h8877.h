@@ -0,0 +1,42 @@
+#pragma once
+/* header 8877 */
+#include <vector>
+#include "h2844.h"
+#include "h4265.h"
+#include "h5882.h"
+#include "h7920.h"
+#include "h1845.h"
+#ifdef X
+#include "h2982.h"
+#endif
+struct S8877 { int a; const char *s = "x//y"; };
+inline int f8877_0(int x) { return x * 0; }
+inline int f8877_1(int x) { return x * 1; }
+inline int f8877_2(int x) { return x * 2; }
+inline int f8877_3(int x) { return x * 3; }
+inline int f8877_4(int x) { return x * 4; }
+inline int f8877_5(int x) { return x * 5; }
+inline int f8877_6(int x) { return x * 6; }
+inline int f8877_7(int x) { return x * 7; }
+inline int f8877_8(int x) { return x * 8; }
+inline int f8877_9(int x) { return x * 9; }
+inline int f8877_10(int x) { return x * 10; }
+inline int f8877_11(int x) { return x * 11; }
+inline int f8877_12(int x) { return x * 12; }
+inline int f8877_13(int x) { return x * 13; }
+inline int f8877_14(int x) { return x * 14; }
+inline int f8877_15(int x) { return x * 15; }
+inline int f8877_16(int x) { return x * 16; }
+inline int f8877_17(int x) { return x * 17; }
+inline int f8877_18(int x) { return x * 18; }
+inline int f8877_19(int x) { return x * 19; }
+inline int f8877_20(int x) { return x * 20; }
+inline int f8877_21(int x) { return x * 21; }
+inline int f8877_22(int x) { return x * 22; }
+inline int f8877_23(int x) { return x * 23; }
+inline int f8877_24(int x) { return x * 24; }
+inline int f8877_25(int x) { return x * 25; }
+inline int f8877_26(int x) { return x * 26; }
+inline int f8877_27(int x) { return x * 27; }
+inline int f8877_28(int x) { return x * 28; }
+inline int f8877_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8878 */
+#include <vector>
+#include "h4214.h"
+#include "h2045.h"
+#include "h1373.h"
+#include "h930.h"
+#include "h2056.h"
+#ifdef X
+#include "h1273.h"
+#endif
+struct S8878 { int a; const char *s = "x//y"; };
+inline int f8878_0(int x) { return x * 0; }
+inline int f8878_1(int x) { return x * 1; }
+inline int f8878_2(int x) { return x * 2; }
+inline int f8878_3(int x) { return x * 3; }
+inline int f8878_4(int x) { return x * 4; }
+inline int f8878_5(int x) { return x * 5; }
+inline int f8878_6(int x) { return x * 6; }
+inline int f8878_7(int x) { return x * 7; }
+inline int f8878_8(int x) { return x * 8; }
+inline int f8878_9(int x) { return x * 9; }
+inline int f8878_10(int x) { return x * 10; }
+inline int f8878_11(int x) { return x * 11; }
+inline int f8878_12(int x) { return x * 12; }
+inline int f8878_13(int x) { return x * 13; }
+inline int f8878_14(int x) { return x * 14; }
+inline int f8878_15(int x) { return x * 15; }
+inline int f8878_16(int x) { return x * 16; }
+inline int f8878_17(int x) { return x * 17; }
+inline int f8878_18(int x) { return x * 18; }
+inline int f8878_19(int x) { return x * 19; }
+inline int f8878_20(int x) { return x * 20; }
+inline int f8878_21(int x) { return x * 21; }
+inline int f8878_22(int x) { return x * 22; }
+inline int f8878_23(int x) { return x * 23; }
+inline int f8878_24(int x) { return x * 24; }
+inline int f8878_25(int x) { return x * 25; }
+inline int f8878_26(int x) { return x * 26; }
+inline int f8878_27(int x) { return x * 27; }
+inline int f8878_28(int x) { return x * 28; }
+inline int f8878_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8879 */
+#include <vector>
+#include "h6060.h"
+#include "h9615.h"
+#include "h1343.h"
+#include "h3272.h"
+#include "h4269.h"
+#ifdef X
+#include "h8341.h"
+#endif
+struct S8879 { int a; const char *s = "x//y"; };
+inline int f8879_0(int x) { return x * 0; }
+inline int f8879_1(int x) { return x * 1; }
+inline int f8879_2(int x) { return x * 2; }
+inline int f8879_3(int x) { return x * 3; }
+inline int f8879_4(int x) { return x * 4; }
+inline int f8879_5(int x) { return x * 5; }
+inline int f8879_6(int x) { return x * 6; }
+inline int f8879_7(int x) { return x * 7; }
+inline int f8879_8(int x) { return x * 8; }
+inline int f8879_9(int x) { return x * 9; }
+inline int f8879_10(int x) { return x * 10; }
+inline int f8879_11(int x) { return x * 11; }
+inline int f8879_12(int x) { return x * 12; }
+inline int f8879_13(int x) { return x * 13; }
+inline int f8879_14(int x) { return x * 14; }
+inline int f8879_15(int x) { return x * 15; }
+inline int f8879_16(int x) { return x * 16; }
+inline int f8879_17(int x) { return x * 17; }
+inline int f8879_18(int x) { return x * 18; }
+inline int f8879_19(int x) { return x * 19; }
+inline int f8879_20(int x) { return x * 20; }
+inline int f8879_21(int x) { return x * 21; }
+inline int f8879_22(int x) { return x * 22; }
+inline int f8879_23(int x) { return x * 23; }
+inline int f8879_24(int x) { return x * 24; }
+inline int f8879_25(int x) { return x * 25; }
+inline int f8879_26(int x) { return x * 26; }
+inline int f8879_27(int x) { return x * 27; }
+inline int f8879_28(int x) { return x * 28; }
+inline int f8879_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8881 */
+#include <vector>
+#include "h1739.h"
+#include "h4528.h"
+#include "h8672.h"
+#include "h2547.h"
+#include "h2494.h"
+#ifdef X
+#include "h6354.h"
+#endif
+struct S8881 { int a; const char *s = "x//y"; };
+inline int f8881_0(int x) { return x * 0; }
+inline int f8881_1(int x) { return x * 1; }
+inline int f8881_2(int x) { return x * 2; }
+inline int f8881_3(int x) { return x * 3; }
+inline int f8881_4(int x) { return x * 4; }
+inline int f8881_5(int x) { return x * 5; }
+inline int f8881_6(int x) { return x * 6; }
+inline int f8881_7(int x) { return x * 7; }
+inline int f8881_8(int x) { return x * 8; }
+inline int f8881_9(int x) { return x * 9; }
+inline int f8881_10(int x) { return x * 10; }
+inline int f8881_11(int x) { return x * 11; }
+inline int f8881_12(int x) { return x * 12; }
+inline int f8881_13(int x) { return x * 13; }
+inline int f8881_14(int x) { return x * 14; }
+inline int f8881_15(int x) { return x * 15; }
+inline int f8881_16(int x) { return x * 16; }
+inline int f8881_17(int x) { return x * 17; }
+inline int f8881_18(int x) { return x * 18; }
+inline int f8881_19(int x) { return x * 19; }
+inline int f8881_20(int x) { return x * 20; }
+inline int f8881_21(int x) { return x * 21; }
+inline int f8881_22(int x) { return x * 22; }
+inline int f8881_23(int x) { return x * 23; }
+inline int f8881_24(int x) { return x * 24; }
+inline int f8881_25(int x) { return x * 25; }
+inline int f8881_26(int x) { return x * 26; }
+inline int f8881_27(int x) { return x * 27; }
+inline int f8881_28(int x) { return x * 28; }
+inline int f8881_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8882 */
+#include <vector>
+#include "h5669.h"
+#include "h9202.h"
+#include "h8263.h"
+#include "h4188.h"
+#include "h3282.h"
+#ifdef X
+#include "h4758.h"
+#endif
+struct S8882 { int a; const char *s = "x//y"; };
+inline int f8882_0(int x) { return x * 0; }
+inline int f8882_1(int x) { return x * 1; }
+inline int f8882_2(int x) { return x * 2; }
+inline int f8882_3(int x) { return x * 3; }
+inline int f8882_4(int x) { return x * 4; }
+inline int f8882_5(int x) { return x * 5; }
+inline int f8882_6(int x) { return x * 6; }
+inline int f8882_7(int x) { return x * 7; }
+inline int f8882_8(int x) { return x * 8; }
+inline int f8882_9(int x) { return x * 9; }
+inline int f8882_10(int x) { return x * 10; }
+inline int f8882_11(int x) { return x * 11; }
+inline int f8882_12(int x) { return x * 12; }
+inline int f8882_13(int x) { return x * 13; }
+inline int f8882_14(int x) { return x * 14; }
+inline int f8882_15(int x) { return x * 15; }
+inline int f8882_16(int x) { return x * 16; }
+inline int f8882_17(int x) { return x * 17; }
+inline int f8882_18(int x) { return x * 18; }
+inline int f8882_19(int x) { return x * 19; }
+inline int f8882_20(int x) { return x * 20; }
+inline int f8882_21(int x) { return x * 21; }
+inline int f8882_22(int x) { return x * 22; }
+inline int f8882_23(int x) { return x * 23; }
+inline int f8882_24(int x) { return x * 24; }
+inline int f8882_25(int x) { return x * 25; }
+inline int f8882_26(int x) { return x * 26; }
+inline int f8882_27(int x) { return x * 27; }
+inline int f8882_28(int x) { return x * 28; }
+inline int f8882_29(int x) { return x * 29; }
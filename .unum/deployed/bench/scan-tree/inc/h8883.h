@@ -0,0 +1,42 @@
+#pragma once
+/* header 8883 */
+#include <vector>
+#include "h7568.h"
+#include "h3014.h"
+#include "h2499.h"
+#include "h693.h"
+#include "h3463.h"
+#ifdef X
+#include "h6041.h"
+#endif
+struct S8883 { int a; const char *s = "x//y"; };
+inline int f8883_0(int x) { return x * 0; }
+inline int f8883_1(int x) { return x * 1; }
+inline int f8883_2(int x) { return x * 2; }
+inline int f8883_3(int x) { return x * 3; }
+inline int f8883_4(int x) { return x * 4; }
+inline int f8883_5(int x) { return x * 5; }
+inline int f8883_6(int x) { return x * 6; }
+inline int f8883_7(int x) { return x * 7; }
+inline int f8883_8(int x) { return x * 8; }
+inline int f8883_9(int x) { return x * 9; }
+inline int f8883_10(int x) { return x * 10; }
+inline int f8883_11(int x) { return x * 11; }
+inline int f8883_12(int x) { return x * 12; }
+inline int f8883_13(int x) { return x * 13; }
+inline int f8883_14(int x) { return x * 14; }
+inline int f8883_15(int x) { return x * 15; }
+inline int f8883_16(int x) { return x * 16; }
+inline int f8883_17(int x) { return x * 17; }
+inline int f8883_18(int x) { return x * 18; }
+inline int f8883_19(int x) { return x * 19; }
+inline int f8883_20(int x) { return x * 20; }
+inline int f8883_21(int x) { return x * 21; }
+inline int f8883_22(int x) { return x * 22; }
+inline int f8883_23(int x) { return x * 23; }
+inline int f8883_24(int x) { return x * 24; }
+inline int f8883_25(int x) { return x * 25; }
+inline int f8883_26(int x) { return x * 26; }
+inline int f8883_27(int x) { return x * 27; }
+inline int f8883_28(int x) { return x * 28; }
+inline int f8883_29(int x) { return x * 29; }
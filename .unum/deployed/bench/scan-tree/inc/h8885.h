@@ -0,0 +1,42 @@
+#pragma once
+/* header 8885 */
+#include <vector>
+#include "h5586.h"
+#include "h3402.h"
+#include "h5360.h"
+#include "h1584.h"
+#include "h5528.h"
+#ifdef X
+#include "h583.h"
+#endif
+struct S8885 { int a; const char *s = "x//y"; };
+inline int f8885_0(int x) { return x * 0; }
+inline int f8885_1(int x) { return x * 1; }
+inline int f8885_2(int x) { return x * 2; }
+inline int f8885_3(int x) { return x * 3; }
+inline int f8885_4(int x) { return x * 4; }
+inline int f8885_5(int x) { return x * 5; }
+inline int f8885_6(int x) { return x * 6; }
+inline int f8885_7(int x) { return x * 7; }
+inline int f8885_8(int x) { return x * 8; }
+inline int f8885_9(int x) { return x * 9; }
+inline int f8885_10(int x) { return x * 10; }
+inline int f8885_11(int x) { return x * 11; }
+inline int f8885_12(int x) { return x * 12; }
+inline int f8885_13(int x) { return x * 13; }
+inline int f8885_14(int x) { return x * 14; }
+inline int f8885_15(int x) { return x * 15; }
+inline int f8885_16(int x) { return x * 16; }
+inline int f8885_17(int x) { return x * 17; }
+inline int f8885_18(int x) { return x * 18; }
+inline int f8885_19(int x) { return x * 19; }
+inline int f8885_20(int x) { return x * 20; }
+inline int f8885_21(int x) { return x * 21; }
+inline int f8885_22(int x) { return x * 22; }
+inline int f8885_23(int x) { return x * 23; }
+inline int f8885_24(int x) { return x * 24; }
+inline int f8885_25(int x) { return x * 25; }
+inline int f8885_26(int x) { return x * 26; }
+inline int f8885_27(int x) { return x * 27; }
+inline int f8885_28(int x) { return x * 28; }
+inline int f8885_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8887 */
+#include <vector>
+#include "h4835.h"
+#include "h7053.h"
+#include "h1108.h"
+#include "h6812.h"
+#include "h6599.h"
+#ifdef X
+#include "h5913.h"
+#endif
+struct S8887 { int a; const char *s = "x//y"; };
+inline int f8887_0(int x) { return x * 0; }
+inline int f8887_1(int x) { return x * 1; }
+inline int f8887_2(int x) { return x * 2; }
+inline int f8887_3(int x) { return x * 3; }
+inline int f8887_4(int x) { return x * 4; }
+inline int f8887_5(int x) { return x * 5; }
+inline int f8887_6(int x) { return x * 6; }
+inline int f8887_7(int x) { return x * 7; }
+inline int f8887_8(int x) { return x * 8; }
+inline int f8887_9(int x) { return x * 9; }
+inline int f8887_10(int x) { return x * 10; }
+inline int f8887_11(int x) { return x * 11; }
+inline int f8887_12(int x) { return x * 12; }
+inline int f8887_13(int x) { return x * 13; }
+inline int f8887_14(int x) { return x * 14; }
+inline int f8887_15(int x) { return x * 15; }
+inline int f8887_16(int x) { return x * 16; }
+inline int f8887_17(int x) { return x * 17; }
+inline int f8887_18(int x) { return x * 18; }
+inline int f8887_19(int x) { return x * 19; }
+inline int f8887_20(int x) { return x * 20; }
+inline int f8887_21(int x) { return x * 21; }
+inline int f8887_22(int x) { return x * 22; }
+inline int f8887_23(int x) { return x * 23; }
+inline int f8887_24(int x) { return x * 24; }
+inline int f8887_25(int x) { return x * 25; }
+inline int f8887_26(int x) { return x * 26; }
+inline int f8887_27(int x) { return x * 27; }
+inline int f8887_28(int x) { return x * 28; }
+inline int f8887_29(int x) { return x * 29; }
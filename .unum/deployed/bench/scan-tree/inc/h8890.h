@@ -0,0 +1,42 @@
+#pragma once
+/* header 8890 */
+#include <vector>
+#include "h7954.h"
+#include "h7173.h"
+#include "h8158.h"
+#include "h6847.h"
+#include "h5594.h"
+#ifdef X
+#include "h8180.h"
+#endif
+struct S8890 { int a; const char *s = "x//y"; };
+inline int f8890_0(int x) { return x * 0; }
+inline int f8890_1(int x) { return x * 1; }
+inline int f8890_2(int x) { return x * 2; }
+inline int f8890_3(int x) { return x * 3; }
+inline int f8890_4(int x) { return x * 4; }
+inline int f8890_5(int x) { return x * 5; }
+inline int f8890_6(int x) { return x * 6; }
+inline int f8890_7(int x) { return x * 7; }
+inline int f8890_8(int x) { return x * 8; }
+inline int f8890_9(int x) { return x * 9; }
+inline int f8890_10(int x) { return x * 10; }
+inline int f8890_11(int x) { return x * 11; }
+inline int f8890_12(int x) { return x * 12; }
+inline int f8890_13(int x) { return x * 13; }
+inline int f8890_14(int x) { return x * 14; }
+inline int f8890_15(int x) { return x * 15; }
+inline int f8890_16(int x) { return x * 16; }
+inline int f8890_17(int x) { return x * 17; }
+inline int f8890_18(int x) { return x * 18; }
+inline int f8890_19(int x) { return x * 19; }
+inline int f8890_20(int x) { return x * 20; }
+inline int f8890_21(int x) { return x * 21; }
+inline int f8890_22(int x) { return x * 22; }
+inline int f8890_23(int x) { return x * 23; }
+inline int f8890_24(int x) { return x * 24; }
+inline int f8890_25(int x) { return x * 25; }
+inline int f8890_26(int x) { return x * 26; }
+inline int f8890_27(int x) { return x * 27; }
+inline int f8890_28(int x) { return x * 28; }
+inline int f8890_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8892 */
+#include <vector>
+#include "h3801.h"
+#include "h2495.h"
+#include "h9134.h"
+#include "h8920.h"
+#include "h1660.h"
+#ifdef X
+#include "h5644.h"
+#endif
+struct S8892 { int a; const char *s = "x//y"; };
+inline int f8892_0(int x) { return x * 0; }
+inline int f8892_1(int x) { return x * 1; }
+inline int f8892_2(int x) { return x * 2; }
+inline int f8892_3(int x) { return x * 3; }
+inline int f8892_4(int x) { return x * 4; }
+inline int f8892_5(int x) { return x * 5; }
+inline int f8892_6(int x) { return x * 6; }
+inline int f8892_7(int x) { return x * 7; }
+inline int f8892_8(int x) { return x * 8; }
+inline int f8892_9(int x) { return x * 9; }
+inline int f8892_10(int x) { return x * 10; }
+inline int f8892_11(int x) { return x * 11; }
+inline int f8892_12(int x) { return x * 12; }
+inline int f8892_13(int x) { return x * 13; }
+inline int f8892_14(int x) { return x * 14; }
+inline int f8892_15(int x) { return x * 15; }
+inline int f8892_16(int x) { return x * 16; }
+inline int f8892_17(int x) { return x * 17; }
+inline int f8892_18(int x) { return x * 18; }
+inline int f8892_19(int x) { return x * 19; }
+inline int f8892_20(int x) { return x * 20; }
+inline int f8892_21(int x) { return x * 21; }
+inline int f8892_22(int x) { return x * 22; }
+inline int f8892_23(int x) { return x * 23; }
+inline int f8892_24(int x) { return x * 24; }
+inline int f8892_25(int x) { return x * 25; }
+inline int f8892_26(int x) { return x * 26; }
+inline int f8892_27(int x) { return x * 27; }
+inline int f8892_28(int x) { return x * 28; }
+inline int f8892_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8893 */
+#include <vector>
+#include "h4449.h"
+#include "h5374.h"
+#include "h8884.h"
+#include "h4831.h"
+#include "h1649.h"
+#ifdef X
+#include "h941.h"
+#endif
+struct S8893 { int a; const char *s = "x//y"; };
+inline int f8893_0(int x) { return x * 0; }
+inline int f8893_1(int x) { return x * 1; }
+inline int f8893_2(int x) { return x * 2; }
+inline int f8893_3(int x) { return x * 3; }
+inline int f8893_4(int x) { return x * 4; }
+inline int f8893_5(int x) { return x * 5; }
+inline int f8893_6(int x) { return x * 6; }
+inline int f8893_7(int x) { return x * 7; }
+inline int f8893_8(int x) { return x * 8; }
+inline int f8893_9(int x) { return x * 9; }
+inline int f8893_10(int x) { return x * 10; }
+inline int f8893_11(int x) { return x * 11; }
+inline int f8893_12(int x) { return x * 12; }
+inline int f8893_13(int x) { return x * 13; }
+inline int f8893_14(int x) { return x * 14; }
+inline int f8893_15(int x) { return x * 15; }
+inline int f8893_16(int x) { return x * 16; }
+inline int f8893_17(int x) { return x * 17; }
+inline int f8893_18(int x) { return x * 18; }
+inline int f8893_19(int x) { return x * 19; }
+inline int f8893_20(int x) { return x * 20; }
+inline int f8893_21(int x) { return x * 21; }
+inline int f8893_22(int x) { return x * 22; }
+inline int f8893_23(int x) { return x * 23; }
+inline int f8893_24(int x) { return x * 24; }
+inline int f8893_25(int x) { return x * 25; }
+inline int f8893_26(int x) { return x * 26; }
+inline int f8893_27(int x) { return x * 27; }
+inline int f8893_28(int x) { return x * 28; }
+inline int f8893_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8894 */
+#include <vector>
+#include "h1832.h"
+#include "h5147.h"
+#include "h8271.h"
+#include "h504.h"
+#include "h2594.h"
+#ifdef X
+#include "h1701.h"
+#endif
+struct S8894 { int a; const char *s = "x//y"; };
+inline int f8894_0(int x) { return x * 0; }
+inline int f8894_1(int x) { return x * 1; }
+inline int f8894_2(int x) { return x * 2; }
+inline int f8894_3(int x) { return x * 3; }
+inline int f8894_4(int x) { return x * 4; }
+inline int f8894_5(int x) { return x * 5; }
+inline int f8894_6(int x) { return x * 6; }
+inline int f8894_7(int x) { return x * 7; }
+inline int f8894_8(int x) { return x * 8; }
+inline int f8894_9(int x) { return x * 9; }
+inline int f8894_10(int x) { return x * 10; }
+inline int f8894_11(int x) { return x * 11; }
+inline int f8894_12(int x) { return x * 12; }
+inline int f8894_13(int x) { return x * 13; }
+inline int f8894_14(int x) { return x * 14; }
+inline int f8894_15(int x) { return x * 15; }
+inline int f8894_16(int x) { return x * 16; }
+inline int f8894_17(int x) { return x * 17; }
+inline int f8894_18(int x) { return x * 18; }
+inline int f8894_19(int x) { return x * 19; }
+inline int f8894_20(int x) { return x * 20; }
+inline int f8894_21(int x) { return x * 21; }
+inline int f8894_22(int x) { return x * 22; }
+inline int f8894_23(int x) { return x * 23; }
+inline int f8894_24(int x) { return x * 24; }
+inline int f8894_25(int x) { return x * 25; }
+inline int f8894_26(int x) { return x * 26; }
+inline int f8894_27(int x) { return x * 27; }
+inline int f8894_28(int x) { return x * 28; }
+inline int f8894_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8895 */
+#include <vector>
+#include "h3702.h"
+#include "h2822.h"
+#include "h1451.h"
+#include "h1937.h"
+#include "h4456.h"
+#ifdef X
+#include "h7840.h"
+#endif
+struct S8895 { int a; const char *s = "x//y"; };
+inline int f8895_0(int x) { return x * 0; }
+inline int f8895_1(int x) { return x * 1; }
+inline int f8895_2(int x) { return x * 2; }
+inline int f8895_3(int x) { return x * 3; }
+inline int f8895_4(int x) { return x * 4; }
+inline int f8895_5(int x) { return x * 5; }
+inline int f8895_6(int x) { return x * 6; }
+inline int f8895_7(int x) { return x * 7; }
+inline int f8895_8(int x) { return x * 8; }
+inline int f8895_9(int x) { return x * 9; }
+inline int f8895_10(int x) { return x * 10; }
+inline int f8895_11(int x) { return x * 11; }
+inline int f8895_12(int x) { return x * 12; }
+inline int f8895_13(int x) { return x * 13; }
+inline int f8895_14(int x) { return x * 14; }
+inline int f8895_15(int x) { return x * 15; }
+inline int f8895_16(int x) { return x * 16; }
+inline int f8895_17(int x) { return x * 17; }
+inline int f8895_18(int x) { return x * 18; }
+inline int f8895_19(int x) { return x * 19; }
+inline int f8895_20(int x) { return x * 20; }
+inline int f8895_21(int x) { return x * 21; }
+inline int f8895_22(int x) { return x * 22; }
+inline int f8895_23(int x) { return x * 23; }
+inline int f8895_24(int x) { return x * 24; }
+inline int f8895_25(int x) { return x * 25; }
+inline int f8895_26(int x) { return x * 26; }
+inline int f8895_27(int x) { return x * 27; }
+inline int f8895_28(int x) { return x * 28; }
+inline int f8895_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8896 */
+#include <vector>
+#include "h7417.h"
+#include "h2240.h"
+#include "h6804.h"
+#include "h6741.h"
+#include "h4545.h"
+#ifdef X
+#include "h6746.h"
+#endif
+struct S8896 { int a; const char *s = "x//y"; };
+inline int f8896_0(int x) { return x * 0; }
+inline int f8896_1(int x) { return x * 1; }
+inline int f8896_2(int x) { return x * 2; }
+inline int f8896_3(int x) { return x * 3; }
+inline int f8896_4(int x) { return x * 4; }
+inline int f8896_5(int x) { return x * 5; }
+inline int f8896_6(int x) { return x * 6; }
+inline int f8896_7(int x) { return x * 7; }
+inline int f8896_8(int x) { return x * 8; }
+inline int f8896_9(int x) { return x * 9; }
+inline int f8896_10(int x) { return x * 10; }
+inline int f8896_11(int x) { return x * 11; }
+inline int f8896_12(int x) { return x * 12; }
+inline int f8896_13(int x) { return x * 13; }
+inline int f8896_14(int x) { return x * 14; }
+inline int f8896_15(int x) { return x * 15; }
+inline int f8896_16(int x) { return x * 16; }
+inline int f8896_17(int x) { return x * 17; }
+inline int f8896_18(int x) { return x * 18; }
+inline int f8896_19(int x) { return x * 19; }
+inline int f8896_20(int x) { return x * 20; }
+inline int f8896_21(int x) { return x * 21; }
+inline int f8896_22(int x) { return x * 22; }
+inline int f8896_23(int x) { return x * 23; }
+inline int f8896_24(int x) { return x * 24; }
+inline int f8896_25(int x) { return x * 25; }
+inline int f8896_26(int x) { return x * 26; }
+inline int f8896_27(int x) { return x * 27; }
+inline int f8896_28(int x) { return x * 28; }
+inline int f8896_29(int x) { return x * 29; }
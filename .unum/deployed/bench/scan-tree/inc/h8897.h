@@ -0,0 +1,42 @@
+#pragma once
+/* header 8897 */
+#include <vector>
+#include "h5576.h"
+#include "h3170.h"
+#include "h6944.h"
+#include "h4100.h"
+#include "h6054.h"
+#ifdef X
+#include "h3.h"
+#endif
+struct S8897 { int a; const char *s = "x//y"; };
+inline int f8897_0(int x) { return x * 0; }
+inline int f8897_1(int x) { return x * 1; }
+inline int f8897_2(int x) { return x * 2; }
+inline int f8897_3(int x) { return x * 3; }
+inline int f8897_4(int x) { return x * 4; }
+inline int f8897_5(int x) { return x * 5; }
+inline int f8897_6(int x) { return x * 6; }
+inline int f8897_7(int x) { return x * 7; }
+inline int f8897_8(int x) { return x * 8; }
+inline int f8897_9(int x) { return x * 9; }
+inline int f8897_10(int x) { return x * 10; }
+inline int f8897_11(int x) { return x * 11; }
+inline int f8897_12(int x) { return x * 12; }
+inline int f8897_13(int x) { return x * 13; }
+inline int f8897_14(int x) { return x * 14; }
+inline int f8897_15(int x) { return x * 15; }
+inline int f8897_16(int x) { return x * 16; }
+inline int f8897_17(int x) { return x * 17; }
+inline int f8897_18(int x) { return x * 18; }
+inline int f8897_19(int x) { return x * 19; }
+inline int f8897_20(int x) { return x * 20; }
+inline int f8897_21(int x) { return x * 21; }
+inline int f8897_22(int x) { return x * 22; }
+inline int f8897_23(int x) { return x * 23; }
+inline int f8897_24(int x) { return x * 24; }
+inline int f8897_25(int x) { return x * 25; }
+inline int f8897_26(int x) { return x * 26; }
+inline int f8897_27(int x) { return x * 27; }
+inline int f8897_28(int x) { return x * 28; }
+inline int f8897_29(int x) { return x * 29; }
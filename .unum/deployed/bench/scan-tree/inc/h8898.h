@@ -0,0 +1,42 @@
+#pragma once
+/* header 8898 */
+#include <vector>
+#include "h917.h"
+#include "h3567.h"
+#include "h830.h"
+#include "h1479.h"
+#include "h1535.h"
+#ifdef X
+#include "h1798.h"
+#endif
+struct S8898 { int a; const char *s = "x//y"; };
+inline int f8898_0(int x) { return x * 0; }
+inline int f8898_1(int x) { return x * 1; }
+inline int f8898_2(int x) { return x * 2; }
+inline int f8898_3(int x) { return x * 3; }
+inline int f8898_4(int x) { return x * 4; }
+inline int f8898_5(int x) { return x * 5; }
+inline int f8898_6(int x) { return x * 6; }
+inline int f8898_7(int x) { return x * 7; }
+inline int f8898_8(int x) { return x * 8; }
+inline int f8898_9(int x) { return x * 9; }
+inline int f8898_10(int x) { return x * 10; }
+inline int f8898_11(int x) { return x * 11; }
+inline int f8898_12(int x) { return x * 12; }
+inline int f8898_13(int x) { return x * 13; }
+inline int f8898_14(int x) { return x * 14; }
+inline int f8898_15(int x) { return x * 15; }
+inline int f8898_16(int x) { return x * 16; }
+inline int f8898_17(int x) { return x * 17; }
+inline int f8898_18(int x) { return x * 18; }
+inline int f8898_19(int x) { return x * 19; }
+inline int f8898_20(int x) { return x * 20; }
+inline int f8898_21(int x) { return x * 21; }
+inline int f8898_22(int x) { return x * 22; }
+inline int f8898_23(int x) { return x * 23; }
+inline int f8898_24(int x) { return x * 24; }
+inline int f8898_25(int x) { return x * 25; }
+inline int f8898_26(int x) { return x * 26; }
+inline int f8898_27(int x) { return x * 27; }
+inline int f8898_28(int x) { return x * 28; }
+inline int f8898_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 89 */
+#include <vector>
+#include "h3630.h"
+#include "h6176.h"
+#include "h3100.h"
+#include "h5130.h"
+#include "h7937.h"
+#ifdef X
+#include "h5788.h"
+#endif
+struct S89 { int a; const char *s = "x//y"; };
+inline int f89_0(int x) { return x * 0; }
+inline int f89_1(int x) { return x * 1; }
+inline int f89_2(int x) { return x * 2; }
+inline int f89_3(int x) { return x * 3; }
+inline int f89_4(int x) { return x * 4; }
+inline int f89_5(int x) { return x * 5; }
+inline int f89_6(int x) { return x * 6; }
+inline int f89_7(int x) { return x * 7; }
+inline int f89_8(int x) { return x * 8; }
+inline int f89_9(int x) { return x * 9; }
+inline int f89_10(int x) { return x * 10; }
+inline int f89_11(int x) { return x * 11; }
+inline int f89_12(int x) { return x * 12; }
+inline int f89_13(int x) { return x * 13; }
+inline int f89_14(int x) { return x * 14; }
+inline int f89_15(int x) { return x * 15; }
+inline int f89_16(int x) { return x * 16; }
+inline int f89_17(int x) { return x * 17; }
+inline int f89_18(int x) { return x * 18; }
+inline int f89_19(int x) { return x * 19; }
+inline int f89_20(int x) { return x * 20; }
+inline int f89_21(int x) { return x * 21; }
+inline int f89_22(int x) { return x * 22; }
+inline int f89_23(int x) { return x * 23; }
+inline int f89_24(int x) { return x * 24; }
+inline int f89_25(int x) { return x * 25; }
+inline int f89_26(int x) { return x * 26; }
+inline int f89_27(int x) { return x * 27; }
+inline int f89_28(int x) { return x * 28; }
+inline int f89_29(int x) { return x * 29; }
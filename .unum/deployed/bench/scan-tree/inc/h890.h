@@ -0,0 +1,42 @@
+#pragma once
+/* header 890 */
+#include <vector>
+#include "h3195.h"
+#include "h5216.h"
+#include "h5975.h"
+#include "h3603.h"
+#include "h3866.h"
+#ifdef X
+#include "h3102.h"
+#endif
+struct S890 { int a; const char *s = "x//y"; };
+inline int f890_0(int x) { return x * 0; }
+inline int f890_1(int x) { return x * 1; }
+inline int f890_2(int x) { return x * 2; }
+inline int f890_3(int x) { return x * 3; }
+inline int f890_4(int x) { return x * 4; }
+inline int f890_5(int x) { return x * 5; }
+inline int f890_6(int x) { return x * 6; }
+inline int f890_7(int x) { return x * 7; }
+inline int f890_8(int x) { return x * 8; }
+inline int f890_9(int x) { return x * 9; }
+inline int f890_10(int x) { return x * 10; }
+inline int f890_11(int x) { return x * 11; }
+inline int f890_12(int x) { return x * 12; }
+inline int f890_13(int x) { return x * 13; }
+inline int f890_14(int x) { return x * 14; }
+inline int f890_15(int x) { return x * 15; }
+inline int f890_16(int x) { return x * 16; }
+inline int f890_17(int x) { return x * 17; }
+inline int f890_18(int x) { return x * 18; }
+inline int f890_19(int x) { return x * 19; }
+inline int f890_20(int x) { return x * 20; }
+inline int f890_21(int x) { return x * 21; }
+inline int f890_22(int x) { return x * 22; }
+inline int f890_23(int x) { return x * 23; }
+inline int f890_24(int x) { return x * 24; }
+inline int f890_25(int x) { return x * 25; }
+inline int f890_26(int x) { return x * 26; }
+inline int f890_27(int x) { return x * 27; }
+inline int f890_28(int x) { return x * 28; }
+inline int f890_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8900 */
+#include <vector>
+#include "h919.h"
+#include "h9235.h"
+#include "h1459.h"
+#include "h5198.h"
+#include "h5807.h"
+#ifdef X
+#include "h6822.h"
+#endif
+struct S8900 { int a; const char *s = "x//y"; };
+inline int f8900_0(int x) { return x * 0; }
+inline int f8900_1(int x) { return x * 1; }
+inline int f8900_2(int x) { return x * 2; }
+inline int f8900_3(int x) { return x * 3; }
+inline int f8900_4(int x) { return x * 4; }
+inline int f8900_5(int x) { return x * 5; }
+inline int f8900_6(int x) { return x * 6; }
+inline int f8900_7(int x) { return x * 7; }
+inline int f8900_8(int x) { return x * 8; }
+inline int f8900_9(int x) { return x * 9; }
+inline int f8900_10(int x) { return x * 10; }
+inline int f8900_11(int x) { return x * 11; }
+inline int f8900_12(int x) { return x * 12; }
+inline int f8900_13(int x) { return x * 13; }
+inline int f8900_14(int x) { return x * 14; }
+inline int f8900_15(int x) { return x * 15; }
+inline int f8900_16(int x) { return x * 16; }
+inline int f8900_17(int x) { return x * 17; }
+inline int f8900_18(int x) { return x * 18; }
+inline int f8900_19(int x) { return x * 19; }
+inline int f8900_20(int x) { return x * 20; }
+inline int f8900_21(int x) { return x * 21; }
+inline int f8900_22(int x) { return x * 22; }
+inline int f8900_23(int x) { return x * 23; }
+inline int f8900_24(int x) { return x * 24; }
+inline int f8900_25(int x) { return x * 25; }
+inline int f8900_26(int x) { return x * 26; }
+inline int f8900_27(int x) { return x * 27; }
+inline int f8900_28(int x) { return x * 28; }
+inline int f8900_29(int x) { return x * 29; }
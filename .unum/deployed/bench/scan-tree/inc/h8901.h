@@ -0,0 +1,42 @@
+#pragma once
+/* header 8901 */
+#include <vector>
+#include "h7286.h"
+#include "h8218.h"
+#include "h5001.h"
+#include "h2000.h"
+#include "h3999.h"
+#ifdef X
+#include "h3016.h"
+#endif
+struct S8901 { int a; const char *s = "x//y"; };
+inline int f8901_0(int x) { return x * 0; }
+inline int f8901_1(int x) { return x * 1; }
+inline int f8901_2(int x) { return x * 2; }
+inline int f8901_3(int x) { return x * 3; }
+inline int f8901_4(int x) { return x * 4; }
+inline int f8901_5(int x) { return x * 5; }
+inline int f8901_6(int x) { return x * 6; }
+inline int f8901_7(int x) { return x * 7; }
+inline int f8901_8(int x) { return x * 8; }
+inline int f8901_9(int x) { return x * 9; }
+inline int f8901_10(int x) { return x * 10; }
+inline int f8901_11(int x) { return x * 11; }
+inline int f8901_12(int x) { return x * 12; }
+inline int f8901_13(int x) { return x * 13; }
+inline int f8901_14(int x) { return x * 14; }
+inline int f8901_15(int x) { return x * 15; }
+inline int f8901_16(int x) { return x * 16; }
+inline int f8901_17(int x) { return x * 17; }
+inline int f8901_18(int x) { return x * 18; }
+inline int f8901_19(int x) { return x * 19; }
+inline int f8901_20(int x) { return x * 20; }
+inline int f8901_21(int x) { return x * 21; }
+inline int f8901_22(int x) { return x * 22; }
+inline int f8901_23(int x) { return x * 23; }
+inline int f8901_24(int x) { return x * 24; }
+inline int f8901_25(int x) { return x * 25; }
+inline int f8901_26(int x) { return x * 26; }
+inline int f8901_27(int x) { return x * 27; }
+inline int f8901_28(int x) { return x * 28; }
+inline int f8901_29(int x) { return x * 29; }
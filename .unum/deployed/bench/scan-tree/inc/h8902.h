@@ -0,0 +1,42 @@
+#pragma once
+/* header 8902 */
+#include <vector>
+#include "h8670.h"
+#include "h1365.h"
+#include "h8064.h"
+#include "h1725.h"
+#include "h5114.h"
+#ifdef X
+#include "h8102.h"
+#endif
+struct S8902 { int a; const char *s = "x//y"; };
+inline int f8902_0(int x) { return x * 0; }
+inline int f8902_1(int x) { return x * 1; }
+inline int f8902_2(int x) { return x * 2; }
+inline int f8902_3(int x) { return x * 3; }
+inline int f8902_4(int x) { return x * 4; }
+inline int f8902_5(int x) { return x * 5; }
+inline int f8902_6(int x) { return x * 6; }
+inline int f8902_7(int x) { return x * 7; }
+inline int f8902_8(int x) { return x * 8; }
+inline int f8902_9(int x) { return x * 9; }
+inline int f8902_10(int x) { return x * 10; }
+inline int f8902_11(int x) { return x * 11; }
+inline int f8902_12(int x) { return x * 12; }
+inline int f8902_13(int x) { return x * 13; }
+inline int f8902_14(int x) { return x * 14; }
+inline int f8902_15(int x) { return x * 15; }
+inline int f8902_16(int x) { return x * 16; }
+inline int f8902_17(int x) { return x * 17; }
+inline int f8902_18(int x) { return x * 18; }
+inline int f8902_19(int x) { return x * 19; }
+inline int f8902_20(int x) { return x * 20; }
+inline int f8902_21(int x) { return x * 21; }
+inline int f8902_22(int x) { return x * 22; }
+inline int f8902_23(int x) { return x * 23; }
+inline int f8902_24(int x) { return x * 24; }
+inline int f8902_25(int x) { return x * 25; }
+inline int f8902_26(int x) { return x * 26; }
+inline int f8902_27(int x) { return x * 27; }
+inline int f8902_28(int x) { return x * 28; }
+inline int f8902_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8905 */
+#include <vector>
+#include "h8322.h"
+#include "h2419.h"
+#include "h2675.h"
+#include "h8993.h"
+#include "h7483.h"
+#ifdef X
+#include "h8784.h"
+#endif
+struct S8905 { int a; const char *s = "x//y"; };
+inline int f8905_0(int x) { return x * 0; }
+inline int f8905_1(int x) { return x * 1; }
+inline int f8905_2(int x) { return x * 2; }
+inline int f8905_3(int x) { return x * 3; }
+inline int f8905_4(int x) { return x * 4; }
+inline int f8905_5(int x) { return x * 5; }
+inline int f8905_6(int x) { return x * 6; }
+inline int f8905_7(int x) { return x * 7; }
+inline int f8905_8(int x) { return x * 8; }
+inline int f8905_9(int x) { return x * 9; }
+inline int f8905_10(int x) { return x * 10; }
+inline int f8905_11(int x) { return x * 11; }
+inline int f8905_12(int x) { return x * 12; }
+inline int f8905_13(int x) { return x * 13; }
+inline int f8905_14(int x) { return x * 14; }
+inline int f8905_15(int x) { return x * 15; }
+inline int f8905_16(int x) { return x * 16; }
+inline int f8905_17(int x) { return x * 17; }
+inline int f8905_18(int x) { return x * 18; }
+inline int f8905_19(int x) { return x * 19; }
+inline int f8905_20(int x) { return x * 20; }
+inline int f8905_21(int x) { return x * 21; }
+inline int f8905_22(int x) { return x * 22; }
+inline int f8905_23(int x) { return x * 23; }
+inline int f8905_24(int x) { return x * 24; }
+inline int f8905_25(int x) { return x * 25; }
+inline int f8905_26(int x) { return x * 26; }
+inline int f8905_27(int x) { return x * 27; }
+inline int f8905_28(int x) { return x * 28; }
+inline int f8905_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8906 */
+#include <vector>
+#include "h6376.h"
+#include "h6210.h"
+#include "h3367.h"
+#include "h3758.h"
+#include "h2175.h"
+#ifdef X
+#include "h3300.h"
+#endif
+struct S8906 { int a; const char *s = "x//y"; };
+inline int f8906_0(int x) { return x * 0; }
+inline int f8906_1(int x) { return x * 1; }
+inline int f8906_2(int x) { return x * 2; }
+inline int f8906_3(int x) { return x * 3; }
+inline int f8906_4(int x) { return x * 4; }
+inline int f8906_5(int x) { return x * 5; }
+inline int f8906_6(int x) { return x * 6; }
+inline int f8906_7(int x) { return x * 7; }
+inline int f8906_8(int x) { return x * 8; }
+inline int f8906_9(int x) { return x * 9; }
+inline int f8906_10(int x) { return x * 10; }
+inline int f8906_11(int x) { return x * 11; }
+inline int f8906_12(int x) { return x * 12; }
+inline int f8906_13(int x) { return x * 13; }
+inline int f8906_14(int x) { return x * 14; }
+inline int f8906_15(int x) { return x * 15; }
+inline int f8906_16(int x) { return x * 16; }
+inline int f8906_17(int x) { return x * 17; }
+inline int f8906_18(int x) { return x * 18; }
+inline int f8906_19(int x) { return x * 19; }
+inline int f8906_20(int x) { return x * 20; }
+inline int f8906_21(int x) { return x * 21; }
+inline int f8906_22(int x) { return x * 22; }
+inline int f8906_23(int x) { return x * 23; }
+inline int f8906_24(int x) { return x * 24; }
+inline int f8906_25(int x) { return x * 25; }
+inline int f8906_26(int x) { return x * 26; }
+inline int f8906_27(int x) { return x * 27; }
+inline int f8906_28(int x) { return x * 28; }
+inline int f8906_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8907 */
+#include <vector>
+#include "h1386.h"
+#include "h98.h"
+#include "h4776.h"
+#include "h3380.h"
+#include "h5020.h"
+#ifdef X
+#include "h4237.h"
+#endif
+struct S8907 { int a; const char *s = "x//y"; };
+inline int f8907_0(int x) { return x * 0; }
+inline int f8907_1(int x) { return x * 1; }
+inline int f8907_2(int x) { return x * 2; }
+inline int f8907_3(int x) { return x * 3; }
+inline int f8907_4(int x) { return x * 4; }
+inline int f8907_5(int x) { return x * 5; }
+inline int f8907_6(int x) { return x * 6; }
+inline int f8907_7(int x) { return x * 7; }
+inline int f8907_8(int x) { return x * 8; }
+inline int f8907_9(int x) { return x * 9; }
+inline int f8907_10(int x) { return x * 10; }
+inline int f8907_11(int x) { return x * 11; }
+inline int f8907_12(int x) { return x * 12; }
+inline int f8907_13(int x) { return x * 13; }
+inline int f8907_14(int x) { return x * 14; }
+inline int f8907_15(int x) { return x * 15; }
+inline int f8907_16(int x) { return x * 16; }
+inline int f8907_17(int x) { return x * 17; }
+inline int f8907_18(int x) { return x * 18; }
+inline int f8907_19(int x) { return x * 19; }
+inline int f8907_20(int x) { return x * 20; }
+inline int f8907_21(int x) { return x * 21; }
+inline int f8907_22(int x) { return x * 22; }
+inline int f8907_23(int x) { return x * 23; }
+inline int f8907_24(int x) { return x * 24; }
+inline int f8907_25(int x) { return x * 25; }
+inline int f8907_26(int x) { return x * 26; }
+inline int f8907_27(int x) { return x * 27; }
+inline int f8907_28(int x) { return x * 28; }
+inline int f8907_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 891 */
+#include <vector>
+#include "h8727.h"
+#include "h8485.h"
+#include "h2203.h"
+#include "h3152.h"
+#include "h3440.h"
+#ifdef X
+#include "h1872.h"
+#endif
+struct S891 { int a; const char *s = "x//y"; };
+inline int f891_0(int x) { return x * 0; }
+inline int f891_1(int x) { return x * 1; }
+inline int f891_2(int x) { return x * 2; }
+inline int f891_3(int x) { return x * 3; }
+inline int f891_4(int x) { return x * 4; }
+inline int f891_5(int x) { return x * 5; }
+inline int f891_6(int x) { return x * 6; }
+inline int f891_7(int x) { return x * 7; }
+inline int f891_8(int x) { return x * 8; }
+inline int f891_9(int x) { return x * 9; }
+inline int f891_10(int x) { return x * 10; }
+inline int f891_11(int x) { return x * 11; }
+inline int f891_12(int x) { return x * 12; }
+inline int f891_13(int x) { return x * 13; }
+inline int f891_14(int x) { return x * 14; }
+inline int f891_15(int x) { return x * 15; }
+inline int f891_16(int x) { return x * 16; }
+inline int f891_17(int x) { return x * 17; }
+inline int f891_18(int x) { return x * 18; }
+inline int f891_19(int x) { return x * 19; }
+inline int f891_20(int x) { return x * 20; }
+inline int f891_21(int x) { return x * 21; }
+inline int f891_22(int x) { return x * 22; }
+inline int f891_23(int x) { return x * 23; }
+inline int f891_24(int x) { return x * 24; }
+inline int f891_25(int x) { return x * 25; }
+inline int f891_26(int x) { return x * 26; }
+inline int f891_27(int x) { return x * 27; }
+inline int f891_28(int x) { return x * 28; }
+inline int f891_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8912 */
+#include <vector>
+#include "h342.h"
+#include "h4923.h"
+#include "h9988.h"
+#include "h9012.h"
+#include "h9889.h"
+#ifdef X
+#include "h3736.h"
+#endif
+struct S8912 { int a; const char *s = "x//y"; };
+inline int f8912_0(int x) { return x * 0; }
+inline int f8912_1(int x) { return x * 1; }
+inline int f8912_2(int x) { return x * 2; }
+inline int f8912_3(int x) { return x * 3; }
+inline int f8912_4(int x) { return x * 4; }
+inline int f8912_5(int x) { return x * 5; }
+inline int f8912_6(int x) { return x * 6; }
+inline int f8912_7(int x) { return x * 7; }
+inline int f8912_8(int x) { return x * 8; }
+inline int f8912_9(int x) { return x * 9; }
+inline int f8912_10(int x) { return x * 10; }
+inline int f8912_11(int x) { return x * 11; }
+inline int f8912_12(int x) { return x * 12; }
+inline int f8912_13(int x) { return x * 13; }
+inline int f8912_14(int x) { return x * 14; }
+inline int f8912_15(int x) { return x * 15; }
+inline int f8912_16(int x) { return x * 16; }
+inline int f8912_17(int x) { return x * 17; }
+inline int f8912_18(int x) { return x * 18; }
+inline int f8912_19(int x) { return x * 19; }
+inline int f8912_20(int x) { return x * 20; }
+inline int f8912_21(int x) { return x * 21; }
+inline int f8912_22(int x) { return x * 22; }
+inline int f8912_23(int x) { return x * 23; }
+inline int f8912_24(int x) { return x * 24; }
+inline int f8912_25(int x) { return x * 25; }
+inline int f8912_26(int x) { return x * 26; }
+inline int f8912_27(int x) { return x * 27; }
+inline int f8912_28(int x) { return x * 28; }
+inline int f8912_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8913 */
+#include <vector>
+#include "h2711.h"
+#include "h4054.h"
+#include "h4118.h"
+#include "h8477.h"
+#include "h8486.h"
+#ifdef X
+#include "h6017.h"
+#endif
+struct S8913 { int a; const char *s = "x//y"; };
+inline int f8913_0(int x) { return x * 0; }
+inline int f8913_1(int x) { return x * 1; }
+inline int f8913_2(int x) { return x * 2; }
+inline int f8913_3(int x) { return x * 3; }
+inline int f8913_4(int x) { return x * 4; }
+inline int f8913_5(int x) { return x * 5; }
+inline int f8913_6(int x) { return x * 6; }
+inline int f8913_7(int x) { return x * 7; }
+inline int f8913_8(int x) { return x * 8; }
+inline int f8913_9(int x) { return x * 9; }
+inline int f8913_10(int x) { return x * 10; }
+inline int f8913_11(int x) { return x * 11; }
+inline int f8913_12(int x) { return x * 12; }
+inline int f8913_13(int x) { return x * 13; }
+inline int f8913_14(int x) { return x * 14; }
+inline int f8913_15(int x) { return x * 15; }
+inline int f8913_16(int x) { return x * 16; }
+inline int f8913_17(int x) { return x * 17; }
+inline int f8913_18(int x) { return x * 18; }
+inline int f8913_19(int x) { return x * 19; }
+inline int f8913_20(int x) { return x * 20; }
+inline int f8913_21(int x) { return x * 21; }
+inline int f8913_22(int x) { return x * 22; }
+inline int f8913_23(int x) { return x * 23; }
+inline int f8913_24(int x) { return x * 24; }
+inline int f8913_25(int x) { return x * 25; }
+inline int f8913_26(int x) { return x * 26; }
+inline int f8913_27(int x) { return x * 27; }
+inline int f8913_28(int x) { return x * 28; }
+inline int f8913_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8914 */
+#include <vector>
+#include "h6622.h"
+#include "h6482.h"
+#include "h4383.h"
+#include "h7381.h"
+#include "h9193.h"
+#ifdef X
+#include "h2393.h"
+#endif
+struct S8914 { int a; const char *s = "x//y"; };
+inline int f8914_0(int x) { return x * 0; }
+inline int f8914_1(int x) { return x * 1; }
+inline int f8914_2(int x) { return x * 2; }
+inline int f8914_3(int x) { return x * 3; }
+inline int f8914_4(int x) { return x * 4; }
+inline int f8914_5(int x) { return x * 5; }
+inline int f8914_6(int x) { return x * 6; }
+inline int f8914_7(int x) { return x * 7; }
+inline int f8914_8(int x) { return x * 8; }
+inline int f8914_9(int x) { return x * 9; }
+inline int f8914_10(int x) { return x * 10; }
+inline int f8914_11(int x) { return x * 11; }
+inline int f8914_12(int x) { return x * 12; }
+inline int f8914_13(int x) { return x * 13; }
+inline int f8914_14(int x) { return x * 14; }
+inline int f8914_15(int x) { return x * 15; }
+inline int f8914_16(int x) { return x * 16; }
+inline int f8914_17(int x) { return x * 17; }
+inline int f8914_18(int x) { return x * 18; }
+inline int f8914_19(int x) { return x * 19; }
+inline int f8914_20(int x) { return x * 20; }
+inline int f8914_21(int x) { return x * 21; }
+inline int f8914_22(int x) { return x * 22; }
+inline int f8914_23(int x) { return x * 23; }
+inline int f8914_24(int x) { return x * 24; }
+inline int f8914_25(int x) { return x * 25; }
+inline int f8914_26(int x) { return x * 26; }
+inline int f8914_27(int x) { return x * 27; }
+inline int f8914_28(int x) { return x * 28; }
+inline int f8914_29(int x) { return x * 29; }
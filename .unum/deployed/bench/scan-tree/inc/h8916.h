@@ -0,0 +1,42 @@
+#pragma once
+/* header 8916 */
+#include <vector>
+#include "h968.h"
+#include "h4931.h"
+#include "h4632.h"
+#include "h8796.h"
+#include "h6652.h"
+#ifdef X
+#include "h3228.h"
+#endif
+struct S8916 { int a; const char *s = "x//y"; };
+inline int f8916_0(int x) { return x * 0; }
+inline int f8916_1(int x) { return x * 1; }
+inline int f8916_2(int x) { return x * 2; }
+inline int f8916_3(int x) { return x * 3; }
+inline int f8916_4(int x) { return x * 4; }
+inline int f8916_5(int x) { return x * 5; }
+inline int f8916_6(int x) { return x * 6; }
+inline int f8916_7(int x) { return x * 7; }
+inline int f8916_8(int x) { return x * 8; }
+inline int f8916_9(int x) { return x * 9; }
+inline int f8916_10(int x) { return x * 10; }
+inline int f8916_11(int x) { return x * 11; }
+inline int f8916_12(int x) { return x * 12; }
+inline int f8916_13(int x) { return x * 13; }
+inline int f8916_14(int x) { return x * 14; }
+inline int f8916_15(int x) { return x * 15; }
+inline int f8916_16(int x) { return x * 16; }
+inline int f8916_17(int x) { return x * 17; }
+inline int f8916_18(int x) { return x * 18; }
+inline int f8916_19(int x) { return x * 19; }
+inline int f8916_20(int x) { return x * 20; }
+inline int f8916_21(int x) { return x * 21; }
+inline int f8916_22(int x) { return x * 22; }
+inline int f8916_23(int x) { return x * 23; }
+inline int f8916_24(int x) { return x * 24; }
+inline int f8916_25(int x) { return x * 25; }
+inline int f8916_26(int x) { return x * 26; }
+inline int f8916_27(int x) { return x * 27; }
+inline int f8916_28(int x) { return x * 28; }
+inline int f8916_29(int x) { return x * 29; }
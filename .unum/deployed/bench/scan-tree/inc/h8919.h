@@ -0,0 +1,42 @@
+#pragma once
+/* header 8919 */
+#include <vector>
+#include "h1292.h"
+#include "h1606.h"
+#include "h4417.h"
+#include "h9615.h"
+#include "h5590.h"
+#ifdef X
+#include "h8812.h"
+#endif
+struct S8919 { int a; const char *s = "x//y"; };
+inline int f8919_0(int x) { return x * 0; }
+inline int f8919_1(int x) { return x * 1; }
+inline int f8919_2(int x) { return x * 2; }
+inline int f8919_3(int x) { return x * 3; }
+inline int f8919_4(int x) { return x * 4; }
+inline int f8919_5(int x) { return x * 5; }
+inline int f8919_6(int x) { return x * 6; }
+inline int f8919_7(int x) { return x * 7; }
+inline int f8919_8(int x) { return x * 8; }
+inline int f8919_9(int x) { return x * 9; }
+inline int f8919_10(int x) { return x * 10; }
+inline int f8919_11(int x) { return x * 11; }
+inline int f8919_12(int x) { return x * 12; }
+inline int f8919_13(int x) { return x * 13; }
+inline int f8919_14(int x) { return x * 14; }
+inline int f8919_15(int x) { return x * 15; }
+inline int f8919_16(int x) { return x * 16; }
+inline int f8919_17(int x) { return x * 17; }
+inline int f8919_18(int x) { return x * 18; }
+inline int f8919_19(int x) { return x * 19; }
+inline int f8919_20(int x) { return x * 20; }
+inline int f8919_21(int x) { return x * 21; }
+inline int f8919_22(int x) { return x * 22; }
+inline int f8919_23(int x) { return x * 23; }
+inline int f8919_24(int x) { return x * 24; }
+inline int f8919_25(int x) { return x * 25; }
+inline int f8919_26(int x) { return x * 26; }
+inline int f8919_27(int x) { return x * 27; }
+inline int f8919_28(int x) { return x * 28; }
+inline int f8919_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8922 */
+#include <vector>
+#include "h6238.h"
+#include "h6405.h"
+#include "h2222.h"
+#include "h3384.h"
+#include "h1664.h"
+#ifdef X
+#include "h8194.h"
+#endif
+struct S8922 { int a; const char *s = "x//y"; };
+inline int f8922_0(int x) { return x * 0; }
+inline int f8922_1(int x) { return x * 1; }
+inline int f8922_2(int x) { return x * 2; }
+inline int f8922_3(int x) { return x * 3; }
+inline int f8922_4(int x) { return x * 4; }
+inline int f8922_5(int x) { return x * 5; }
+inline int f8922_6(int x) { return x * 6; }
+inline int f8922_7(int x) { return x * 7; }
+inline int f8922_8(int x) { return x * 8; }
+inline int f8922_9(int x) { return x * 9; }
+inline int f8922_10(int x) { return x * 10; }
+inline int f8922_11(int x) { return x * 11; }
+inline int f8922_12(int x) { return x * 12; }
+inline int f8922_13(int x) { return x * 13; }
+inline int f8922_14(int x) { return x * 14; }
+inline int f8922_15(int x) { return x * 15; }
+inline int f8922_16(int x) { return x * 16; }
+inline int f8922_17(int x) { return x * 17; }
+inline int f8922_18(int x) { return x * 18; }
+inline int f8922_19(int x) { return x * 19; }
+inline int f8922_20(int x) { return x * 20; }
+inline int f8922_21(int x) { return x * 21; }
+inline int f8922_22(int x) { return x * 22; }
+inline int f8922_23(int x) { return x * 23; }
+inline int f8922_24(int x) { return x * 24; }
+inline int f8922_25(int x) { return x * 25; }
+inline int f8922_26(int x) { return x * 26; }
+inline int f8922_27(int x) { return x * 27; }
+inline int f8922_28(int x) { return x * 28; }
+inline int f8922_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8924 */
+#include <vector>
+#include "h8114.h"
+#include "h8231.h"
+#include "h5641.h"
+#include "h2668.h"
+#include "h4558.h"
+#ifdef X
+#include "h2591.h"
+#endif
+struct S8924 { int a; const char *s = "x//y"; };
+inline int f8924_0(int x) { return x * 0; }
+inline int f8924_1(int x) { return x * 1; }
+inline int f8924_2(int x) { return x * 2; }
+inline int f8924_3(int x) { return x * 3; }
+inline int f8924_4(int x) { return x * 4; }
+inline int f8924_5(int x) { return x * 5; }
+inline int f8924_6(int x) { return x * 6; }
+inline int f8924_7(int x) { return x * 7; }
+inline int f8924_8(int x) { return x * 8; }
+inline int f8924_9(int x) { return x * 9; }
+inline int f8924_10(int x) { return x * 10; }
+inline int f8924_11(int x) { return x * 11; }
+inline int f8924_12(int x) { return x * 12; }
+inline int f8924_13(int x) { return x * 13; }
+inline int f8924_14(int x) { return x * 14; }
+inline int f8924_15(int x) { return x * 15; }
+inline int f8924_16(int x) { return x * 16; }
+inline int f8924_17(int x) { return x * 17; }
+inline int f8924_18(int x) { return x * 18; }
+inline int f8924_19(int x) { return x * 19; }
+inline int f8924_20(int x) { return x * 20; }
+inline int f8924_21(int x) { return x * 21; }
+inline int f8924_22(int x) { return x * 22; }
+inline int f8924_23(int x) { return x * 23; }
+inline int f8924_24(int x) { return x * 24; }
+inline int f8924_25(int x) { return x * 25; }
+inline int f8924_26(int x) { return x * 26; }
+inline int f8924_27(int x) { return x * 27; }
+inline int f8924_28(int x) { return x * 28; }
+inline int f8924_29(int x) { return x * 29; }
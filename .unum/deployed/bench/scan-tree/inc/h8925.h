@@ -0,0 +1,42 @@
+#pragma once
+/* header 8925 */
+#include <vector>
+#include "h6721.h"
+#include "h9641.h"
+#include "h1946.h"
+#include "h3850.h"
+#include "h8462.h"
+#ifdef X
+#include "h9663.h"
+#endif
+struct S8925 { int a; const char *s = "x//y"; };
+inline int f8925_0(int x) { return x * 0; }
+inline int f8925_1(int x) { return x * 1; }
+inline int f8925_2(int x) { return x * 2; }
+inline int f8925_3(int x) { return x * 3; }
+inline int f8925_4(int x) { return x * 4; }
+inline int f8925_5(int x) { return x * 5; }
+inline int f8925_6(int x) { return x * 6; }
+inline int f8925_7(int x) { return x * 7; }
+inline int f8925_8(int x) { return x * 8; }
+inline int f8925_9(int x) { return x * 9; }
+inline int f8925_10(int x) { return x * 10; }
+inline int f8925_11(int x) { return x * 11; }
+inline int f8925_12(int x) { return x * 12; }
+inline int f8925_13(int x) { return x * 13; }
+inline int f8925_14(int x) { return x * 14; }
+inline int f8925_15(int x) { return x * 15; }
+inline int f8925_16(int x) { return x * 16; }
+inline int f8925_17(int x) { return x * 17; }
+inline int f8925_18(int x) { return x * 18; }
+inline int f8925_19(int x) { return x * 19; }
+inline int f8925_20(int x) { return x * 20; }
+inline int f8925_21(int x) { return x * 21; }
+inline int f8925_22(int x) { return x * 22; }
+inline int f8925_23(int x) { return x * 23; }
+inline int f8925_24(int x) { return x * 24; }
+inline int f8925_25(int x) { return x * 25; }
+inline int f8925_26(int x) { return x * 26; }
+inline int f8925_27(int x) { return x * 27; }
+inline int f8925_28(int x) { return x * 28; }
+inline int f8925_29(int x) { return x * 29; }
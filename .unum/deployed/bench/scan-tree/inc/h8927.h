@@ -0,0 +1,42 @@
+#pragma once
+/* header 8927 */
+#include <vector>
+#include "h2000.h"
+#include "h6164.h"
+#include "h1905.h"
+#include "h9711.h"
+#include "h1526.h"
+#ifdef X
+#include "h6002.h"
+#endif
+struct S8927 { int a; const char *s = "x//y"; };
+inline int f8927_0(int x) { return x * 0; }
+inline int f8927_1(int x) { return x * 1; }
+inline int f8927_2(int x) { return x * 2; }
+inline int f8927_3(int x) { return x * 3; }
+inline int f8927_4(int x) { return x * 4; }
+inline int f8927_5(int x) { return x * 5; }
+inline int f8927_6(int x) { return x * 6; }
+inline int f8927_7(int x) { return x * 7; }
+inline int f8927_8(int x) { return x * 8; }
+inline int f8927_9(int x) { return x * 9; }
+inline int f8927_10(int x) { return x * 10; }
+inline int f8927_11(int x) { return x * 11; }
+inline int f8927_12(int x) { return x * 12; }
+inline int f8927_13(int x) { return x * 13; }
+inline int f8927_14(int x) { return x * 14; }
+inline int f8927_15(int x) { return x * 15; }
+inline int f8927_16(int x) { return x * 16; }
+inline int f8927_17(int x) { return x * 17; }
+inline int f8927_18(int x) { return x * 18; }
+inline int f8927_19(int x) { return x * 19; }
+inline int f8927_20(int x) { return x * 20; }
+inline int f8927_21(int x) { return x * 21; }
+inline int f8927_22(int x) { return x * 22; }
+inline int f8927_23(int x) { return x * 23; }
+inline int f8927_24(int x) { return x * 24; }
+inline int f8927_25(int x) { return x * 25; }
+inline int f8927_26(int x) { return x * 26; }
+inline int f8927_27(int x) { return x * 27; }
+inline int f8927_28(int x) { return x * 28; }
+inline int f8927_29(int x) { return x * 29; }
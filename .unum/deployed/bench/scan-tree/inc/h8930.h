@@ -0,0 +1,42 @@
+#pragma once
+/* header 8930 */
+#include <vector>
+#include "h3656.h"
+#include "h4135.h"
+#include "h981.h"
+#include "h6975.h"
+#include "h5493.h"
+#ifdef X
+#include "h9928.h"
+#endif
+struct S8930 { int a; const char *s = "x//y"; };
+inline int f8930_0(int x) { return x * 0; }
+inline int f8930_1(int x) { return x * 1; }
+inline int f8930_2(int x) { return x * 2; }
+inline int f8930_3(int x) { return x * 3; }
+inline int f8930_4(int x) { return x * 4; }
+inline int f8930_5(int x) { return x * 5; }
+inline int f8930_6(int x) { return x * 6; }
+inline int f8930_7(int x) { return x * 7; }
+inline int f8930_8(int x) { return x * 8; }
+inline int f8930_9(int x) { return x * 9; }
+inline int f8930_10(int x) { return x * 10; }
+inline int f8930_11(int x) { return x * 11; }
+inline int f8930_12(int x) { return x * 12; }
+inline int f8930_13(int x) { return x * 13; }
+inline int f8930_14(int x) { return x * 14; }
+inline int f8930_15(int x) { return x * 15; }
+inline int f8930_16(int x) { return x * 16; }
+inline int f8930_17(int x) { return x * 17; }
+inline int f8930_18(int x) { return x * 18; }
+inline int f8930_19(int x) { return x * 19; }
+inline int f8930_20(int x) { return x * 20; }
+inline int f8930_21(int x) { return x * 21; }
+inline int f8930_22(int x) { return x * 22; }
+inline int f8930_23(int x) { return x * 23; }
+inline int f8930_24(int x) { return x * 24; }
+inline int f8930_25(int x) { return x * 25; }
+inline int f8930_26(int x) { return x * 26; }
+inline int f8930_27(int x) { return x * 27; }
+inline int f8930_28(int x) { return x * 28; }
+inline int f8930_29(int x) { return x * 29; }
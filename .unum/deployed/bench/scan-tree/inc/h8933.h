@@ -0,0 +1,42 @@
+#pragma once
+/* header 8933 */
+#include <vector>
+#include "h2994.h"
+#include "h2004.h"
+#include "h2038.h"
+#include "h7243.h"
+#include "h551.h"
+#ifdef X
+#include "h9989.h"
+#endif
+struct S8933 { int a; const char *s = "x//y"; };
+inline int f8933_0(int x) { return x * 0; }
+inline int f8933_1(int x) { return x * 1; }
+inline int f8933_2(int x) { return x * 2; }
+inline int f8933_3(int x) { return x * 3; }
+inline int f8933_4(int x) { return x * 4; }
+inline int f8933_5(int x) { return x * 5; }
+inline int f8933_6(int x) { return x * 6; }
+inline int f8933_7(int x) { return x * 7; }
+inline int f8933_8(int x) { return x * 8; }
+inline int f8933_9(int x) { return x * 9; }
+inline int f8933_10(int x) { return x * 10; }
+inline int f8933_11(int x) { return x * 11; }
+inline int f8933_12(int x) { return x * 12; }
+inline int f8933_13(int x) { return x * 13; }
+inline int f8933_14(int x) { return x * 14; }
+inline int f8933_15(int x) { return x * 15; }
+inline int f8933_16(int x) { return x * 16; }
+inline int f8933_17(int x) { return x * 17; }
+inline int f8933_18(int x) { return x * 18; }
+inline int f8933_19(int x) { return x * 19; }
+inline int f8933_20(int x) { return x * 20; }
+inline int f8933_21(int x) { return x * 21; }
+inline int f8933_22(int x) { return x * 22; }
+inline int f8933_23(int x) { return x * 23; }
+inline int f8933_24(int x) { return x * 24; }
+inline int f8933_25(int x) { return x * 25; }
+inline int f8933_26(int x) { return x * 26; }
+inline int f8933_27(int x) { return x * 27; }
+inline int f8933_28(int x) { return x * 28; }
+inline int f8933_29(int x) { return x * 29; }
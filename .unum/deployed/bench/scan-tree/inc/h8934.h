@@ -0,0 +1,42 @@
+#pragma once
+/* header 8934 */
+#include <vector>
+#include "h1905.h"
+#include "h3929.h"
+#include "h3234.h"
+#include "h78.h"
+#include "h4094.h"
+#ifdef X
+#include "h3908.h"
+#endif
+struct S8934 { int a; const char *s = "x//y"; };
+inline int f8934_0(int x) { return x * 0; }
+inline int f8934_1(int x) { return x * 1; }
+inline int f8934_2(int x) { return x * 2; }
+inline int f8934_3(int x) { return x * 3; }
+inline int f8934_4(int x) { return x * 4; }
+inline int f8934_5(int x) { return x * 5; }
+inline int f8934_6(int x) { return x * 6; }
+inline int f8934_7(int x) { return x * 7; }
+inline int f8934_8(int x) { return x * 8; }
+inline int f8934_9(int x) { return x * 9; }
+inline int f8934_10(int x) { return x * 10; }
+inline int f8934_11(int x) { return x * 11; }
+inline int f8934_12(int x) { return x * 12; }
+inline int f8934_13(int x) { return x * 13; }
+inline int f8934_14(int x) { return x * 14; }
+inline int f8934_15(int x) { return x * 15; }
+inline int f8934_16(int x) { return x * 16; }
+inline int f8934_17(int x) { return x * 17; }
+inline int f8934_18(int x) { return x * 18; }
+inline int f8934_19(int x) { return x * 19; }
+inline int f8934_20(int x) { return x * 20; }
+inline int f8934_21(int x) { return x * 21; }
+inline int f8934_22(int x) { return x * 22; }
+inline int f8934_23(int x) { return x * 23; }
+inline int f8934_24(int x) { return x * 24; }
+inline int f8934_25(int x) { return x * 25; }
+inline int f8934_26(int x) { return x * 26; }
+inline int f8934_27(int x) { return x * 27; }
+inline int f8934_28(int x) { return x * 28; }
+inline int f8934_29(int x) { return x * 29; }
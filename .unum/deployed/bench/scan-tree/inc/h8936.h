@@ -0,0 +1,42 @@
+#pragma once
+/* header 8936 */
+#include <vector>
+#include "h7202.h"
+#include "h5184.h"
+#include "h5136.h"
+#include "h338.h"
+#include "h6372.h"
+#ifdef X
+#include "h8509.h"
+#endif
+struct S8936 { int a; const char *s = "x//y"; };
+inline int f8936_0(int x) { return x * 0; }
+inline int f8936_1(int x) { return x * 1; }
+inline int f8936_2(int x) { return x * 2; }
+inline int f8936_3(int x) { return x * 3; }
+inline int f8936_4(int x) { return x * 4; }
+inline int f8936_5(int x) { return x * 5; }
+inline int f8936_6(int x) { return x * 6; }
+inline int f8936_7(int x) { return x * 7; }
+inline int f8936_8(int x) { return x * 8; }
+inline int f8936_9(int x) { return x * 9; }
+inline int f8936_10(int x) { return x * 10; }
+inline int f8936_11(int x) { return x * 11; }
+inline int f8936_12(int x) { return x * 12; }
+inline int f8936_13(int x) { return x * 13; }
+inline int f8936_14(int x) { return x * 14; }
+inline int f8936_15(int x) { return x * 15; }
+inline int f8936_16(int x) { return x * 16; }
+inline int f8936_17(int x) { return x * 17; }
+inline int f8936_18(int x) { return x * 18; }
+inline int f8936_19(int x) { return x * 19; }
+inline int f8936_20(int x) { return x * 20; }
+inline int f8936_21(int x) { return x * 21; }
+inline int f8936_22(int x) { return x * 22; }
+inline int f8936_23(int x) { return x * 23; }
+inline int f8936_24(int x) { return x * 24; }
+inline int f8936_25(int x) { return x * 25; }
+inline int f8936_26(int x) { return x * 26; }
+inline int f8936_27(int x) { return x * 27; }
+inline int f8936_28(int x) { return x * 28; }
+inline int f8936_29(int x) { return x * 29; }
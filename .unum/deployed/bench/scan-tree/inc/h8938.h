@@ -0,0 +1,42 @@
+#pragma once
+/* header 8938 */
+#include <vector>
+#include "h6203.h"
+#include "h4229.h"
+#include "h1092.h"
+#include "h852.h"
+#include "h5243.h"
+#ifdef X
+#include "h8370.h"
+#endif
+struct S8938 { int a; const char *s = "x//y"; };
+inline int f8938_0(int x) { return x * 0; }
+inline int f8938_1(int x) { return x * 1; }
+inline int f8938_2(int x) { return x * 2; }
+inline int f8938_3(int x) { return x * 3; }
+inline int f8938_4(int x) { return x * 4; }
+inline int f8938_5(int x) { return x * 5; }
+inline int f8938_6(int x) { return x * 6; }
+inline int f8938_7(int x) { return x * 7; }
+inline int f8938_8(int x) { return x * 8; }
+inline int f8938_9(int x) { return x * 9; }
+inline int f8938_10(int x) { return x * 10; }
+inline int f8938_11(int x) { return x * 11; }
+inline int f8938_12(int x) { return x * 12; }
+inline int f8938_13(int x) { return x * 13; }
+inline int f8938_14(int x) { return x * 14; }
+inline int f8938_15(int x) { return x * 15; }
+inline int f8938_16(int x) { return x * 16; }
+inline int f8938_17(int x) { return x * 17; }
+inline int f8938_18(int x) { return x * 18; }
+inline int f8938_19(int x) { return x * 19; }
+inline int f8938_20(int x) { return x * 20; }
+inline int f8938_21(int x) { return x * 21; }
+inline int f8938_22(int x) { return x * 22; }
+inline int f8938_23(int x) { return x * 23; }
+inline int f8938_24(int x) { return x * 24; }
+inline int f8938_25(int x) { return x * 25; }
+inline int f8938_26(int x) { return x * 26; }
+inline int f8938_27(int x) { return x * 27; }
+inline int f8938_28(int x) { return x * 28; }
+inline int f8938_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8940 */
+#include <vector>
+#include "h4838.h"
+#include "h2258.h"
+#include "h5601.h"
+#include "h5816.h"
+#include "h2006.h"
+#ifdef X
+#include "h9649.h"
+#endif
+struct S8940 { int a; const char *s = "x//y"; };
+inline int f8940_0(int x) { return x * 0; }
+inline int f8940_1(int x) { return x * 1; }
+inline int f8940_2(int x) { return x * 2; }
+inline int f8940_3(int x) { return x * 3; }
+inline int f8940_4(int x) { return x * 4; }
+inline int f8940_5(int x) { return x * 5; }
+inline int f8940_6(int x) { return x * 6; }
+inline int f8940_7(int x) { return x * 7; }
+inline int f8940_8(int x) { return x * 8; }
+inline int f8940_9(int x) { return x * 9; }
+inline int f8940_10(int x) { return x * 10; }
+inline int f8940_11(int x) { return x * 11; }
+inline int f8940_12(int x) { return x * 12; }
+inline int f8940_13(int x) { return x * 13; }
+inline int f8940_14(int x) { return x * 14; }
+inline int f8940_15(int x) { return x * 15; }
+inline int f8940_16(int x) { return x * 16; }
+inline int f8940_17(int x) { return x * 17; }
+inline int f8940_18(int x) { return x * 18; }
+inline int f8940_19(int x) { return x * 19; }
+inline int f8940_20(int x) { return x * 20; }
+inline int f8940_21(int x) { return x * 21; }
+inline int f8940_22(int x) { return x * 22; }
+inline int f8940_23(int x) { return x * 23; }
+inline int f8940_24(int x) { return x * 24; }
+inline int f8940_25(int x) { return x * 25; }
+inline int f8940_26(int x) { return x * 26; }
+inline int f8940_27(int x) { return x * 27; }
+inline int f8940_28(int x) { return x * 28; }
+inline int f8940_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8944 */
+#include <vector>
+#include "h9161.h"
+#include "h3462.h"
+#include "h3537.h"
+#include "h2709.h"
+#include "h4660.h"
+#ifdef X
+#include "h1091.h"
+#endif
+struct S8944 { int a; const char *s = "x//y"; };
+inline int f8944_0(int x) { return x * 0; }
+inline int f8944_1(int x) { return x * 1; }
+inline int f8944_2(int x) { return x * 2; }
+inline int f8944_3(int x) { return x * 3; }
+inline int f8944_4(int x) { return x * 4; }
+inline int f8944_5(int x) { return x * 5; }
+inline int f8944_6(int x) { return x * 6; }
+inline int f8944_7(int x) { return x * 7; }
+inline int f8944_8(int x) { return x * 8; }
+inline int f8944_9(int x) { return x * 9; }
+inline int f8944_10(int x) { return x * 10; }
+inline int f8944_11(int x) { return x * 11; }
+inline int f8944_12(int x) { return x * 12; }
+inline int f8944_13(int x) { return x * 13; }
+inline int f8944_14(int x) { return x * 14; }
+inline int f8944_15(int x) { return x * 15; }
+inline int f8944_16(int x) { return x * 16; }
+inline int f8944_17(int x) { return x * 17; }
+inline int f8944_18(int x) { return x * 18; }
+inline int f8944_19(int x) { return x * 19; }
+inline int f8944_20(int x) { return x * 20; }
+inline int f8944_21(int x) { return x * 21; }
+inline int f8944_22(int x) { return x * 22; }
+inline int f8944_23(int x) { return x * 23; }
+inline int f8944_24(int x) { return x * 24; }
+inline int f8944_25(int x) { return x * 25; }
+inline int f8944_26(int x) { return x * 26; }
+inline int f8944_27(int x) { return x * 27; }
+inline int f8944_28(int x) { return x * 28; }
+inline int f8944_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8945 */
+#include <vector>
+#include "h6056.h"
+#include "h6987.h"
+#include "h2378.h"
+#include "h4352.h"
+#include "h8152.h"
+#ifdef X
+#include "h1795.h"
+#endif
+struct S8945 { int a; const char *s = "x//y"; };
+inline int f8945_0(int x) { return x * 0; }
+inline int f8945_1(int x) { return x * 1; }
+inline int f8945_2(int x) { return x * 2; }
+inline int f8945_3(int x) { return x * 3; }
+inline int f8945_4(int x) { return x * 4; }
+inline int f8945_5(int x) { return x * 5; }
+inline int f8945_6(int x) { return x * 6; }
+inline int f8945_7(int x) { return x * 7; }
+inline int f8945_8(int x) { return x * 8; }
+inline int f8945_9(int x) { return x * 9; }
+inline int f8945_10(int x) { return x * 10; }
+inline int f8945_11(int x) { return x * 11; }
+inline int f8945_12(int x) { return x * 12; }
+inline int f8945_13(int x) { return x * 13; }
+inline int f8945_14(int x) { return x * 14; }
+inline int f8945_15(int x) { return x * 15; }
+inline int f8945_16(int x) { return x * 16; }
+inline int f8945_17(int x) { return x * 17; }
+inline int f8945_18(int x) { return x * 18; }
+inline int f8945_19(int x) { return x * 19; }
+inline int f8945_20(int x) { return x * 20; }
+inline int f8945_21(int x) { return x * 21; }
+inline int f8945_22(int x) { return x * 22; }
+inline int f8945_23(int x) { return x * 23; }
+inline int f8945_24(int x) { return x * 24; }
+inline int f8945_25(int x) { return x * 25; }
+inline int f8945_26(int x) { return x * 26; }
+inline int f8945_27(int x) { return x * 27; }
+inline int f8945_28(int x) { return x * 28; }
+inline int f8945_29(int x) { return x * 29; }
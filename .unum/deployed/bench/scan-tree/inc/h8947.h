@@ -0,0 +1,42 @@
+#pragma once
+/* header 8947 */
+#include <vector>
+#include "h5308.h"
+#include "h7682.h"
+#include "h2738.h"
+#include "h1151.h"
+#include "h1482.h"
+#ifdef X
+#include "h6107.h"
+#endif
+struct S8947 { int a; const char *s = "x//y"; };
+inline int f8947_0(int x) { return x * 0; }
+inline int f8947_1(int x) { return x * 1; }
+inline int f8947_2(int x) { return x * 2; }
+inline int f8947_3(int x) { return x * 3; }
+inline int f8947_4(int x) { return x * 4; }
+inline int f8947_5(int x) { return x * 5; }
+inline int f8947_6(int x) { return x * 6; }
+inline int f8947_7(int x) { return x * 7; }
+inline int f8947_8(int x) { return x * 8; }
+inline int f8947_9(int x) { return x * 9; }
+inline int f8947_10(int x) { return x * 10; }
+inline int f8947_11(int x) { return x * 11; }
+inline int f8947_12(int x) { return x * 12; }
+inline int f8947_13(int x) { return x * 13; }
+inline int f8947_14(int x) { return x * 14; }
+inline int f8947_15(int x) { return x * 15; }
+inline int f8947_16(int x) { return x * 16; }
+inline int f8947_17(int x) { return x * 17; }
+inline int f8947_18(int x) { return x * 18; }
+inline int f8947_19(int x) { return x * 19; }
+inline int f8947_20(int x) { return x * 20; }
+inline int f8947_21(int x) { return x * 21; }
+inline int f8947_22(int x) { return x * 22; }
+inline int f8947_23(int x) { return x * 23; }
+inline int f8947_24(int x) { return x * 24; }
+inline int f8947_25(int x) { return x * 25; }
+inline int f8947_26(int x) { return x * 26; }
+inline int f8947_27(int x) { return x * 27; }
+inline int f8947_28(int x) { return x * 28; }
+inline int f8947_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8949 */
+#include <vector>
+#include "h3716.h"
+#include "h1030.h"
+#include "h1676.h"
+#include "h2382.h"
+#include "h7980.h"
+#ifdef X
+#include "h4739.h"
+#endif
+struct S8949 { int a; const char *s = "x//y"; };
+inline int f8949_0(int x) { return x * 0; }
+inline int f8949_1(int x) { return x * 1; }
+inline int f8949_2(int x) { return x * 2; }
+inline int f8949_3(int x) { return x * 3; }
+inline int f8949_4(int x) { return x * 4; }
+inline int f8949_5(int x) { return x * 5; }
+inline int f8949_6(int x) { return x * 6; }
+inline int f8949_7(int x) { return x * 7; }
+inline int f8949_8(int x) { return x * 8; }
+inline int f8949_9(int x) { return x * 9; }
+inline int f8949_10(int x) { return x * 10; }
+inline int f8949_11(int x) { return x * 11; }
+inline int f8949_12(int x) { return x * 12; }
+inline int f8949_13(int x) { return x * 13; }
+inline int f8949_14(int x) { return x * 14; }
+inline int f8949_15(int x) { return x * 15; }
+inline int f8949_16(int x) { return x * 16; }
+inline int f8949_17(int x) { return x * 17; }
+inline int f8949_18(int x) { return x * 18; }
+inline int f8949_19(int x) { return x * 19; }
+inline int f8949_20(int x) { return x * 20; }
+inline int f8949_21(int x) { return x * 21; }
+inline int f8949_22(int x) { return x * 22; }
+inline int f8949_23(int x) { return x * 23; }
+inline int f8949_24(int x) { return x * 24; }
+inline int f8949_25(int x) { return x * 25; }
+inline int f8949_26(int x) { return x * 26; }
+inline int f8949_27(int x) { return x * 27; }
+inline int f8949_28(int x) { return x * 28; }
+inline int f8949_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8950 */
+#include <vector>
+#include "h5703.h"
+#include "h2683.h"
+#include "h8929.h"
+#include "h8299.h"
+#include "h4356.h"
+#ifdef X
+#include "h8406.h"
+#endif
+struct S8950 { int a; const char *s = "x//y"; };
+inline int f8950_0(int x) { return x * 0; }
+inline int f8950_1(int x) { return x * 1; }
+inline int f8950_2(int x) { return x * 2; }
+inline int f8950_3(int x) { return x * 3; }
+inline int f8950_4(int x) { return x * 4; }
+inline int f8950_5(int x) { return x * 5; }
+inline int f8950_6(int x) { return x * 6; }
+inline int f8950_7(int x) { return x * 7; }
+inline int f8950_8(int x) { return x * 8; }
+inline int f8950_9(int x) { return x * 9; }
+inline int f8950_10(int x) { return x * 10; }
+inline int f8950_11(int x) { return x * 11; }
+inline int f8950_12(int x) { return x * 12; }
+inline int f8950_13(int x) { return x * 13; }
+inline int f8950_14(int x) { return x * 14; }
+inline int f8950_15(int x) { return x * 15; }
+inline int f8950_16(int x) { return x * 16; }
+inline int f8950_17(int x) { return x * 17; }
+inline int f8950_18(int x) { return x * 18; }
+inline int f8950_19(int x) { return x * 19; }
+inline int f8950_20(int x) { return x * 20; }
+inline int f8950_21(int x) { return x * 21; }
+inline int f8950_22(int x) { return x * 22; }
+inline int f8950_23(int x) { return x * 23; }
+inline int f8950_24(int x) { return x * 24; }
+inline int f8950_25(int x) { return x * 25; }
+inline int f8950_26(int x) { return x * 26; }
+inline int f8950_27(int x) { return x * 27; }
+inline int f8950_28(int x) { return x * 28; }
+inline int f8950_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8952 */
+#include <vector>
+#include "h4539.h"
+#include "h1001.h"
+#include "h4995.h"
+#include "h3339.h"
+#include "h6725.h"
+#ifdef X
+#include "h3371.h"
+#endif
+struct S8952 { int a; const char *s = "x//y"; };
+inline int f8952_0(int x) { return x * 0; }
+inline int f8952_1(int x) { return x * 1; }
+inline int f8952_2(int x) { return x * 2; }
+inline int f8952_3(int x) { return x * 3; }
+inline int f8952_4(int x) { return x * 4; }
+inline int f8952_5(int x) { return x * 5; }
+inline int f8952_6(int x) { return x * 6; }
+inline int f8952_7(int x) { return x * 7; }
+inline int f8952_8(int x) { return x * 8; }
+inline int f8952_9(int x) { return x * 9; }
+inline int f8952_10(int x) { return x * 10; }
+inline int f8952_11(int x) { return x * 11; }
+inline int f8952_12(int x) { return x * 12; }
+inline int f8952_13(int x) { return x * 13; }
+inline int f8952_14(int x) { return x * 14; }
+inline int f8952_15(int x) { return x * 15; }
+inline int f8952_16(int x) { return x * 16; }
+inline int f8952_17(int x) { return x * 17; }
+inline int f8952_18(int x) { return x * 18; }
+inline int f8952_19(int x) { return x * 19; }
+inline int f8952_20(int x) { return x * 20; }
+inline int f8952_21(int x) { return x * 21; }
+inline int f8952_22(int x) { return x * 22; }
+inline int f8952_23(int x) { return x * 23; }
+inline int f8952_24(int x) { return x * 24; }
+inline int f8952_25(int x) { return x * 25; }
+inline int f8952_26(int x) { return x * 26; }
+inline int f8952_27(int x) { return x * 27; }
+inline int f8952_28(int x) { return x * 28; }
+inline int f8952_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8956 */
+#include <vector>
+#include "h9617.h"
+#include "h8517.h"
+#include "h71.h"
+#include "h2149.h"
+#include "h1658.h"
+#ifdef X
+#include "h3066.h"
+#endif
+struct S8956 { int a; const char *s = "x//y"; };
+inline int f8956_0(int x) { return x * 0; }
+inline int f8956_1(int x) { return x * 1; }
+inline int f8956_2(int x) { return x * 2; }
+inline int f8956_3(int x) { return x * 3; }
+inline int f8956_4(int x) { return x * 4; }
+inline int f8956_5(int x) { return x * 5; }
+inline int f8956_6(int x) { return x * 6; }
+inline int f8956_7(int x) { return x * 7; }
+inline int f8956_8(int x) { return x * 8; }
+inline int f8956_9(int x) { return x * 9; }
+inline int f8956_10(int x) { return x * 10; }
+inline int f8956_11(int x) { return x * 11; }
+inline int f8956_12(int x) { return x * 12; }
+inline int f8956_13(int x) { return x * 13; }
+inline int f8956_14(int x) { return x * 14; }
+inline int f8956_15(int x) { return x * 15; }
+inline int f8956_16(int x) { return x * 16; }
+inline int f8956_17(int x) { return x * 17; }
+inline int f8956_18(int x) { return x * 18; }
+inline int f8956_19(int x) { return x * 19; }
+inline int f8956_20(int x) { return x * 20; }
+inline int f8956_21(int x) { return x * 21; }
+inline int f8956_22(int x) { return x * 22; }
+inline int f8956_23(int x) { return x * 23; }
+inline int f8956_24(int x) { return x * 24; }
+inline int f8956_25(int x) { return x * 25; }
+inline int f8956_26(int x) { return x * 26; }
+inline int f8956_27(int x) { return x * 27; }
+inline int f8956_28(int x) { return x * 28; }
+inline int f8956_29(int x) { return x * 29; }
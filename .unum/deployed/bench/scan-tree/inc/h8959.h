@@ -0,0 +1,42 @@
+#pragma once
+/* header 8959 */
+#include <vector>
+#include "h5862.h"
+#include "h6907.h"
+#include "h1710.h"
+#include "h3275.h"
+#include "h3208.h"
+#ifdef X
+#include "h3982.h"
+#endif
+struct S8959 { int a; const char *s = "x//y"; };
+inline int f8959_0(int x) { return x * 0; }
+inline int f8959_1(int x) { return x * 1; }
+inline int f8959_2(int x) { return x * 2; }
+inline int f8959_3(int x) { return x * 3; }
+inline int f8959_4(int x) { return x * 4; }
+inline int f8959_5(int x) { return x * 5; }
+inline int f8959_6(int x) { return x * 6; }
+inline int f8959_7(int x) { return x * 7; }
+inline int f8959_8(int x) { return x * 8; }
+inline int f8959_9(int x) { return x * 9; }
+inline int f8959_10(int x) { return x * 10; }
+inline int f8959_11(int x) { return x * 11; }
+inline int f8959_12(int x) { return x * 12; }
+inline int f8959_13(int x) { return x * 13; }
+inline int f8959_14(int x) { return x * 14; }
+inline int f8959_15(int x) { return x * 15; }
+inline int f8959_16(int x) { return x * 16; }
+inline int f8959_17(int x) { return x * 17; }
+inline int f8959_18(int x) { return x * 18; }
+inline int f8959_19(int x) { return x * 19; }
+inline int f8959_20(int x) { return x * 20; }
+inline int f8959_21(int x) { return x * 21; }
+inline int f8959_22(int x) { return x * 22; }
+inline int f8959_23(int x) { return x * 23; }
+inline int f8959_24(int x) { return x * 24; }
+inline int f8959_25(int x) { return x * 25; }
+inline int f8959_26(int x) { return x * 26; }
+inline int f8959_27(int x) { return x * 27; }
+inline int f8959_28(int x) { return x * 28; }
+inline int f8959_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 896 */
+#include <vector>
+#include "h9998.h"
+#include "h6294.h"
+#include "h6013.h"
+#include "h305.h"
+#include "h6623.h"
+#ifdef X
+#include "h909.h"
+#endif
+struct S896 { int a; const char *s = "x//y"; };
+inline int f896_0(int x) { return x * 0; }
+inline int f896_1(int x) { return x * 1; }
+inline int f896_2(int x) { return x * 2; }
+inline int f896_3(int x) { return x * 3; }
+inline int f896_4(int x) { return x * 4; }
+inline int f896_5(int x) { return x * 5; }
+inline int f896_6(int x) { return x * 6; }
+inline int f896_7(int x) { return x * 7; }
+inline int f896_8(int x) { return x * 8; }
+inline int f896_9(int x) { return x * 9; }
+inline int f896_10(int x) { return x * 10; }
+inline int f896_11(int x) { return x * 11; }
+inline int f896_12(int x) { return x * 12; }
+inline int f896_13(int x) { return x * 13; }
+inline int f896_14(int x) { return x * 14; }
+inline int f896_15(int x) { return x * 15; }
+inline int f896_16(int x) { return x * 16; }
+inline int f896_17(int x) { return x * 17; }
+inline int f896_18(int x) { return x * 18; }
+inline int f896_19(int x) { return x * 19; }
+inline int f896_20(int x) { return x * 20; }
+inline int f896_21(int x) { return x * 21; }
+inline int f896_22(int x) { return x * 22; }
+inline int f896_23(int x) { return x * 23; }
+inline int f896_24(int x) { return x * 24; }
+inline int f896_25(int x) { return x * 25; }
+inline int f896_26(int x) { return x * 26; }
+inline int f896_27(int x) { return x * 27; }
+inline int f896_28(int x) { return x * 28; }
+inline int f896_29(int x) { return x * 29; }
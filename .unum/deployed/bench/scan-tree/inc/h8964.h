@@ -0,0 +1,42 @@
+#pragma once
+/* header 8964 */
+#include <vector>
+#include "h5002.h"
+#include "h4716.h"
+#include "h2746.h"
+#include "h3892.h"
+#include "h7402.h"
+#ifdef X
+#include "h241.h"
+#endif
+struct S8964 { int a; const char *s = "x//y"; };
+inline int f8964_0(int x) { return x * 0; }
+inline int f8964_1(int x) { return x * 1; }
+inline int f8964_2(int x) { return x * 2; }
+inline int f8964_3(int x) { return x * 3; }
+inline int f8964_4(int x) { return x * 4; }
+inline int f8964_5(int x) { return x * 5; }
+inline int f8964_6(int x) { return x * 6; }
+inline int f8964_7(int x) { return x * 7; }
+inline int f8964_8(int x) { return x * 8; }
+inline int f8964_9(int x) { return x * 9; }
+inline int f8964_10(int x) { return x * 10; }
+inline int f8964_11(int x) { return x * 11; }
+inline int f8964_12(int x) { return x * 12; }
+inline int f8964_13(int x) { return x * 13; }
+inline int f8964_14(int x) { return x * 14; }
+inline int f8964_15(int x) { return x * 15; }
+inline int f8964_16(int x) { return x * 16; }
+inline int f8964_17(int x) { return x * 17; }
+inline int f8964_18(int x) { return x * 18; }
+inline int f8964_19(int x) { return x * 19; }
+inline int f8964_20(int x) { return x * 20; }
+inline int f8964_21(int x) { return x * 21; }
+inline int f8964_22(int x) { return x * 22; }
+inline int f8964_23(int x) { return x * 23; }
+inline int f8964_24(int x) { return x * 24; }
+inline int f8964_25(int x) { return x * 25; }
+inline int f8964_26(int x) { return x * 26; }
+inline int f8964_27(int x) { return x * 27; }
+inline int f8964_28(int x) { return x * 28; }
+inline int f8964_29(int x) { return x * 29; }
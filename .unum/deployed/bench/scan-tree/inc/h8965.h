@@ -0,0 +1,42 @@
+#pragma once
+/* header 8965 */
+#include <vector>
+#include "h2106.h"
+#include "h6612.h"
+#include "h1797.h"
+#include "h2077.h"
+#include "h2673.h"
+#ifdef X
+#include "h795.h"
+#endif
+struct S8965 { int a; const char *s = "x//y"; };
+inline int f8965_0(int x) { return x * 0; }
+inline int f8965_1(int x) { return x * 1; }
+inline int f8965_2(int x) { return x * 2; }
+inline int f8965_3(int x) { return x * 3; }
+inline int f8965_4(int x) { return x * 4; }
+inline int f8965_5(int x) { return x * 5; }
+inline int f8965_6(int x) { return x * 6; }
+inline int f8965_7(int x) { return x * 7; }
+inline int f8965_8(int x) { return x * 8; }
+inline int f8965_9(int x) { return x * 9; }
+inline int f8965_10(int x) { return x * 10; }
+inline int f8965_11(int x) { return x * 11; }
+inline int f8965_12(int x) { return x * 12; }
+inline int f8965_13(int x) { return x * 13; }
+inline int f8965_14(int x) { return x * 14; }
+inline int f8965_15(int x) { return x * 15; }
+inline int f8965_16(int x) { return x * 16; }
+inline int f8965_17(int x) { return x * 17; }
+inline int f8965_18(int x) { return x * 18; }
+inline int f8965_19(int x) { return x * 19; }
+inline int f8965_20(int x) { return x * 20; }
+inline int f8965_21(int x) { return x * 21; }
+inline int f8965_22(int x) { return x * 22; }
+inline int f8965_23(int x) { return x * 23; }
+inline int f8965_24(int x) { return x * 24; }
+inline int f8965_25(int x) { return x * 25; }
+inline int f8965_26(int x) { return x * 26; }
+inline int f8965_27(int x) { return x * 27; }
+inline int f8965_28(int x) { return x * 28; }
+inline int f8965_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8966 */
+#include <vector>
+#include "h4435.h"
+#include "h3711.h"
+#include "h2624.h"
+#include "h5816.h"
+#include "h6335.h"
+#ifdef X
+#include "h2555.h"
+#endif
+struct S8966 { int a; const char *s = "x//y"; };
+inline int f8966_0(int x) { return x * 0; }
+inline int f8966_1(int x) { return x * 1; }
+inline int f8966_2(int x) { return x * 2; }
+inline int f8966_3(int x) { return x * 3; }
+inline int f8966_4(int x) { return x * 4; }
+inline int f8966_5(int x) { return x * 5; }
+inline int f8966_6(int x) { return x * 6; }
+inline int f8966_7(int x) { return x * 7; }
+inline int f8966_8(int x) { return x * 8; }
+inline int f8966_9(int x) { return x * 9; }
+inline int f8966_10(int x) { return x * 10; }
+inline int f8966_11(int x) { return x * 11; }
+inline int f8966_12(int x) { return x * 12; }
+inline int f8966_13(int x) { return x * 13; }
+inline int f8966_14(int x) { return x * 14; }
+inline int f8966_15(int x) { return x * 15; }
+inline int f8966_16(int x) { return x * 16; }
+inline int f8966_17(int x) { return x * 17; }
+inline int f8966_18(int x) { return x * 18; }
+inline int f8966_19(int x) { return x * 19; }
+inline int f8966_20(int x) { return x * 20; }
+inline int f8966_21(int x) { return x * 21; }
+inline int f8966_22(int x) { return x * 22; }
+inline int f8966_23(int x) { return x * 23; }
+inline int f8966_24(int x) { return x * 24; }
+inline int f8966_25(int x) { return x * 25; }
+inline int f8966_26(int x) { return x * 26; }
+inline int f8966_27(int x) { return x * 27; }
+inline int f8966_28(int x) { return x * 28; }
+inline int f8966_29(int x) { return x * 29; }
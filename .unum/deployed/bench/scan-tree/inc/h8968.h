@@ -0,0 +1,42 @@
+#pragma once
+/* header 8968 */
+#include <vector>
+#include "h3883.h"
+#include "h351.h"
+#include "h6588.h"
+#include "h7228.h"
+#include "h1247.h"
+#ifdef X
+#include "h4172.h"
+#endif
+struct S8968 { int a; const char *s = "x//y"; };
+inline int f8968_0(int x) { return x * 0; }
+inline int f8968_1(int x) { return x * 1; }
+inline int f8968_2(int x) { return x * 2; }
+inline int f8968_3(int x) { return x * 3; }
+inline int f8968_4(int x) { return x * 4; }
+inline int f8968_5(int x) { return x * 5; }
+inline int f8968_6(int x) { return x * 6; }
+inline int f8968_7(int x) { return x * 7; }
+inline int f8968_8(int x) { return x * 8; }
+inline int f8968_9(int x) { return x * 9; }
+inline int f8968_10(int x) { return x * 10; }
+inline int f8968_11(int x) { return x * 11; }
+inline int f8968_12(int x) { return x * 12; }
+inline int f8968_13(int x) { return x * 13; }
+inline int f8968_14(int x) { return x * 14; }
+inline int f8968_15(int x) { return x * 15; }
+inline int f8968_16(int x) { return x * 16; }
+inline int f8968_17(int x) { return x * 17; }
+inline int f8968_18(int x) { return x * 18; }
+inline int f8968_19(int x) { return x * 19; }
+inline int f8968_20(int x) { return x * 20; }
+inline int f8968_21(int x) { return x * 21; }
+inline int f8968_22(int x) { return x * 22; }
+inline int f8968_23(int x) { return x * 23; }
+inline int f8968_24(int x) { return x * 24; }
+inline int f8968_25(int x) { return x * 25; }
+inline int f8968_26(int x) { return x * 26; }
+inline int f8968_27(int x) { return x * 27; }
+inline int f8968_28(int x) { return x * 28; }
+inline int f8968_29(int x) { return x * 29; }
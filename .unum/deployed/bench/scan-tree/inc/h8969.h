@@ -0,0 +1,42 @@
+#pragma once
+/* header 8969 */
+#include <vector>
+#include "h3582.h"
+#include "h5381.h"
+#include "h9024.h"
+#include "h5122.h"
+#include "h4053.h"
+#ifdef X
+#include "h6635.h"
+#endif
+struct S8969 { int a; const char *s = "x//y"; };
+inline int f8969_0(int x) { return x * 0; }
+inline int f8969_1(int x) { return x * 1; }
+inline int f8969_2(int x) { return x * 2; }
+inline int f8969_3(int x) { return x * 3; }
+inline int f8969_4(int x) { return x * 4; }
+inline int f8969_5(int x) { return x * 5; }
+inline int f8969_6(int x) { return x * 6; }
+inline int f8969_7(int x) { return x * 7; }
+inline int f8969_8(int x) { return x * 8; }
+inline int f8969_9(int x) { return x * 9; }
+inline int f8969_10(int x) { return x * 10; }
+inline int f8969_11(int x) { return x * 11; }
+inline int f8969_12(int x) { return x * 12; }
+inline int f8969_13(int x) { return x * 13; }
+inline int f8969_14(int x) { return x * 14; }
+inline int f8969_15(int x) { return x * 15; }
+inline int f8969_16(int x) { return x * 16; }
+inline int f8969_17(int x) { return x * 17; }
+inline int f8969_18(int x) { return x * 18; }
+inline int f8969_19(int x) { return x * 19; }
+inline int f8969_20(int x) { return x * 20; }
+inline int f8969_21(int x) { return x * 21; }
+inline int f8969_22(int x) { return x * 22; }
+inline int f8969_23(int x) { return x * 23; }
+inline int f8969_24(int x) { return x * 24; }
+inline int f8969_25(int x) { return x * 25; }
+inline int f8969_26(int x) { return x * 26; }
+inline int f8969_27(int x) { return x * 27; }
+inline int f8969_28(int x) { return x * 28; }
+inline int f8969_29(int x) { return x * 29; }
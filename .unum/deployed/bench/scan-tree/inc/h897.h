@@ -0,0 +1,42 @@
+#pragma once
+/* header 897 */
+#include <vector>
+#include "h6783.h"
+#include "h3877.h"
+#include "h624.h"
+#include "h6291.h"
+#include "h9335.h"
+#ifdef X
+#include "h8583.h"
+#endif
+struct S897 { int a; const char *s = "x//y"; };
+inline int f897_0(int x) { return x * 0; }
+inline int f897_1(int x) { return x * 1; }
+inline int f897_2(int x) { return x * 2; }
+inline int f897_3(int x) { return x * 3; }
+inline int f897_4(int x) { return x * 4; }
+inline int f897_5(int x) { return x * 5; }
+inline int f897_6(int x) { return x * 6; }
+inline int f897_7(int x) { return x * 7; }
+inline int f897_8(int x) { return x * 8; }
+inline int f897_9(int x) { return x * 9; }
+inline int f897_10(int x) { return x * 10; }
+inline int f897_11(int x) { return x * 11; }
+inline int f897_12(int x) { return x * 12; }
+inline int f897_13(int x) { return x * 13; }
+inline int f897_14(int x) { return x * 14; }
+inline int f897_15(int x) { return x * 15; }
+inline int f897_16(int x) { return x * 16; }
+inline int f897_17(int x) { return x * 17; }
+inline int f897_18(int x) { return x * 18; }
+inline int f897_19(int x) { return x * 19; }
+inline int f897_20(int x) { return x * 20; }
+inline int f897_21(int x) { return x * 21; }
+inline int f897_22(int x) { return x * 22; }
+inline int f897_23(int x) { return x * 23; }
+inline int f897_24(int x) { return x * 24; }
+inline int f897_25(int x) { return x * 25; }
+inline int f897_26(int x) { return x * 26; }
+inline int f897_27(int x) { return x * 27; }
+inline int f897_28(int x) { return x * 28; }
+inline int f897_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8972 */
+#include <vector>
+#include "h4407.h"
+#include "h8119.h"
+#include "h1783.h"
+#include "h8452.h"
+#include "h6150.h"
+#ifdef X
+#include "h9771.h"
+#endif
+struct S8972 { int a; const char *s = "x//y"; };
+inline int f8972_0(int x) { return x * 0; }
+inline int f8972_1(int x) { return x * 1; }
+inline int f8972_2(int x) { return x * 2; }
+inline int f8972_3(int x) { return x * 3; }
+inline int f8972_4(int x) { return x * 4; }
+inline int f8972_5(int x) { return x * 5; }
+inline int f8972_6(int x) { return x * 6; }
+inline int f8972_7(int x) { return x * 7; }
+inline int f8972_8(int x) { return x * 8; }
+inline int f8972_9(int x) { return x * 9; }
+inline int f8972_10(int x) { return x * 10; }
+inline int f8972_11(int x) { return x * 11; }
+inline int f8972_12(int x) { return x * 12; }
+inline int f8972_13(int x) { return x * 13; }
+inline int f8972_14(int x) { return x * 14; }
+inline int f8972_15(int x) { return x * 15; }
+inline int f8972_16(int x) { return x * 16; }
+inline int f8972_17(int x) { return x * 17; }
+inline int f8972_18(int x) { return x * 18; }
+inline int f8972_19(int x) { return x * 19; }
+inline int f8972_20(int x) { return x * 20; }
+inline int f8972_21(int x) { return x * 21; }
+inline int f8972_22(int x) { return x * 22; }
+inline int f8972_23(int x) { return x * 23; }
+inline int f8972_24(int x) { return x * 24; }
+inline int f8972_25(int x) { return x * 25; }
+inline int f8972_26(int x) { return x * 26; }
+inline int f8972_27(int x) { return x * 27; }
+inline int f8972_28(int x) { return x * 28; }
+inline int f8972_29(int x) { return x * 29; }
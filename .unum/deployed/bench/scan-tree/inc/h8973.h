@@ -0,0 +1,42 @@
+#pragma once
+/* header 8973 */
+#include <vector>
+#include "h8808.h"
+#include "h657.h"
+#include "h5237.h"
+#include "h874.h"
+#include "h6345.h"
+#ifdef X
+#include "h9713.h"
+#endif
+struct S8973 { int a; const char *s = "x//y"; };
+inline int f8973_0(int x) { return x * 0; }
+inline int f8973_1(int x) { return x * 1; }
+inline int f8973_2(int x) { return x * 2; }
+inline int f8973_3(int x) { return x * 3; }
+inline int f8973_4(int x) { return x * 4; }
+inline int f8973_5(int x) { return x * 5; }
+inline int f8973_6(int x) { return x * 6; }
+inline int f8973_7(int x) { return x * 7; }
+inline int f8973_8(int x) { return x * 8; }
+inline int f8973_9(int x) { return x * 9; }
+inline int f8973_10(int x) { return x * 10; }
+inline int f8973_11(int x) { return x * 11; }
+inline int f8973_12(int x) { return x * 12; }
+inline int f8973_13(int x) { return x * 13; }
+inline int f8973_14(int x) { return x * 14; }
+inline int f8973_15(int x) { return x * 15; }
+inline int f8973_16(int x) { return x * 16; }
+inline int f8973_17(int x) { return x * 17; }
+inline int f8973_18(int x) { return x * 18; }
+inline int f8973_19(int x) { return x * 19; }
+inline int f8973_20(int x) { return x * 20; }
+inline int f8973_21(int x) { return x * 21; }
+inline int f8973_22(int x) { return x * 22; }
+inline int f8973_23(int x) { return x * 23; }
+inline int f8973_24(int x) { return x * 24; }
+inline int f8973_25(int x) { return x * 25; }
+inline int f8973_26(int x) { return x * 26; }
+inline int f8973_27(int x) { return x * 27; }
+inline int f8973_28(int x) { return x * 28; }
+inline int f8973_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8974 */
+#include <vector>
+#include "h1155.h"
+#include "h1839.h"
+#include "h5597.h"
+#include "h4008.h"
+#include "h2048.h"
+#ifdef X
+#include "h8133.h"
+#endif
+struct S8974 { int a; const char *s = "x//y"; };
+inline int f8974_0(int x) { return x * 0; }
+inline int f8974_1(int x) { return x * 1; }
+inline int f8974_2(int x) { return x * 2; }
+inline int f8974_3(int x) { return x * 3; }
+inline int f8974_4(int x) { return x * 4; }
+inline int f8974_5(int x) { return x * 5; }
+inline int f8974_6(int x) { return x * 6; }
+inline int f8974_7(int x) { return x * 7; }
+inline int f8974_8(int x) { return x * 8; }
+inline int f8974_9(int x) { return x * 9; }
+inline int f8974_10(int x) { return x * 10; }
+inline int f8974_11(int x) { return x * 11; }
+inline int f8974_12(int x) { return x * 12; }
+inline int f8974_13(int x) { return x * 13; }
+inline int f8974_14(int x) { return x * 14; }
+inline int f8974_15(int x) { return x * 15; }
+inline int f8974_16(int x) { return x * 16; }
+inline int f8974_17(int x) { return x * 17; }
+inline int f8974_18(int x) { return x * 18; }
+inline int f8974_19(int x) { return x * 19; }
+inline int f8974_20(int x) { return x * 20; }
+inline int f8974_21(int x) { return x * 21; }
+inline int f8974_22(int x) { return x * 22; }
+inline int f8974_23(int x) { return x * 23; }
+inline int f8974_24(int x) { return x * 24; }
+inline int f8974_25(int x) { return x * 25; }
+inline int f8974_26(int x) { return x * 26; }
+inline int f8974_27(int x) { return x * 27; }
+inline int f8974_28(int x) { return x * 28; }
+inline int f8974_29(int x) { return x * 29; }
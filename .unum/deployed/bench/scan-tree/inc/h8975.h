@@ -0,0 +1,42 @@
+#pragma once
+/* header 8975 */
+#include <vector>
+#include "h9045.h"
+#include "h955.h"
+#include "h9537.h"
+#include "h3893.h"
+#include "h7381.h"
+#ifdef X
+#include "h2067.h"
+#endif
+struct S8975 { int a; const char *s = "x//y"; };
+inline int f8975_0(int x) { return x * 0; }
+inline int f8975_1(int x) { return x * 1; }
+inline int f8975_2(int x) { return x * 2; }
+inline int f8975_3(int x) { return x * 3; }
+inline int f8975_4(int x) { return x * 4; }
+inline int f8975_5(int x) { return x * 5; }
+inline int f8975_6(int x) { return x * 6; }
+inline int f8975_7(int x) { return x * 7; }
+inline int f8975_8(int x) { return x * 8; }
+inline int f8975_9(int x) { return x * 9; }
+inline int f8975_10(int x) { return x * 10; }
+inline int f8975_11(int x) { return x * 11; }
+inline int f8975_12(int x) { return x * 12; }
+inline int f8975_13(int x) { return x * 13; }
+inline int f8975_14(int x) { return x * 14; }
+inline int f8975_15(int x) { return x * 15; }
+inline int f8975_16(int x) { return x * 16; }
+inline int f8975_17(int x) { return x * 17; }
+inline int f8975_18(int x) { return x * 18; }
+inline int f8975_19(int x) { return x * 19; }
+inline int f8975_20(int x) { return x * 20; }
+inline int f8975_21(int x) { return x * 21; }
+inline int f8975_22(int x) { return x * 22; }
+inline int f8975_23(int x) { return x * 23; }
+inline int f8975_24(int x) { return x * 24; }
+inline int f8975_25(int x) { return x * 25; }
+inline int f8975_26(int x) { return x * 26; }
+inline int f8975_27(int x) { return x * 27; }
+inline int f8975_28(int x) { return x * 28; }
+inline int f8975_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8976 */
+#include <vector>
+#include "h9257.h"
+#include "h3573.h"
+#include "h7123.h"
+#include "h1648.h"
+#include "h7500.h"
+#ifdef X
+#include "h6048.h"
+#endif
+struct S8976 { int a; const char *s = "x//y"; };
+inline int f8976_0(int x) { return x * 0; }
+inline int f8976_1(int x) { return x * 1; }
+inline int f8976_2(int x) { return x * 2; }
+inline int f8976_3(int x) { return x * 3; }
+inline int f8976_4(int x) { return x * 4; }
+inline int f8976_5(int x) { return x * 5; }
+inline int f8976_6(int x) { return x * 6; }
+inline int f8976_7(int x) { return x * 7; }
+inline int f8976_8(int x) { return x * 8; }
+inline int f8976_9(int x) { return x * 9; }
+inline int f8976_10(int x) { return x * 10; }
+inline int f8976_11(int x) { return x * 11; }
+inline int f8976_12(int x) { return x * 12; }
+inline int f8976_13(int x) { return x * 13; }
+inline int f8976_14(int x) { return x * 14; }
+inline int f8976_15(int x) { return x * 15; }
+inline int f8976_16(int x) { return x * 16; }
+inline int f8976_17(int x) { return x * 17; }
+inline int f8976_18(int x) { return x * 18; }
+inline int f8976_19(int x) { return x * 19; }
+inline int f8976_20(int x) { return x * 20; }
+inline int f8976_21(int x) { return x * 21; }
+inline int f8976_22(int x) { return x * 22; }
+inline int f8976_23(int x) { return x * 23; }
+inline int f8976_24(int x) { return x * 24; }
+inline int f8976_25(int x) { return x * 25; }
+inline int f8976_26(int x) { return x * 26; }
+inline int f8976_27(int x) { return x * 27; }
+inline int f8976_28(int x) { return x * 28; }
+inline int f8976_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8977 */
+#include <vector>
+#include "h4464.h"
+#include "h2982.h"
+#include "h6120.h"
+#include "h2582.h"
+#include "h2959.h"
+#ifdef X
+#include "h5336.h"
+#endif
+struct S8977 { int a; const char *s = "x//y"; };
+inline int f8977_0(int x) { return x * 0; }
+inline int f8977_1(int x) { return x * 1; }
+inline int f8977_2(int x) { return x * 2; }
+inline int f8977_3(int x) { return x * 3; }
+inline int f8977_4(int x) { return x * 4; }
+inline int f8977_5(int x) { return x * 5; }
+inline int f8977_6(int x) { return x * 6; }
+inline int f8977_7(int x) { return x * 7; }
+inline int f8977_8(int x) { return x * 8; }
+inline int f8977_9(int x) { return x * 9; }
+inline int f8977_10(int x) { return x * 10; }
+inline int f8977_11(int x) { return x * 11; }
+inline int f8977_12(int x) { return x * 12; }
+inline int f8977_13(int x) { return x * 13; }
+inline int f8977_14(int x) { return x * 14; }
+inline int f8977_15(int x) { return x * 15; }
+inline int f8977_16(int x) { return x * 16; }
+inline int f8977_17(int x) { return x * 17; }
+inline int f8977_18(int x) { return x * 18; }
+inline int f8977_19(int x) { return x * 19; }
+inline int f8977_20(int x) { return x * 20; }
+inline int f8977_21(int x) { return x * 21; }
+inline int f8977_22(int x) { return x * 22; }
+inline int f8977_23(int x) { return x * 23; }
+inline int f8977_24(int x) { return x * 24; }
+inline int f8977_25(int x) { return x * 25; }
+inline int f8977_26(int x) { return x * 26; }
+inline int f8977_27(int x) { return x * 27; }
+inline int f8977_28(int x) { return x * 28; }
+inline int f8977_29(int x) { return x * 29; }
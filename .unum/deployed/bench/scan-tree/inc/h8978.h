@@ -0,0 +1,42 @@
+#pragma once
+/* header 8978 */
+#include <vector>
+#include "h1991.h"
+#include "h114.h"
+#include "h4906.h"
+#include "h7639.h"
+#include "h8181.h"
+#ifdef X
+#include "h5086.h"
+#endif
+struct S8978 { int a; const char *s = "x//y"; };
+inline int f8978_0(int x) { return x * 0; }
+inline int f8978_1(int x) { return x * 1; }
+inline int f8978_2(int x) { return x * 2; }
+inline int f8978_3(int x) { return x * 3; }
+inline int f8978_4(int x) { return x * 4; }
+inline int f8978_5(int x) { return x * 5; }
+inline int f8978_6(int x) { return x * 6; }
+inline int f8978_7(int x) { return x * 7; }
+inline int f8978_8(int x) { return x * 8; }
+inline int f8978_9(int x) { return x * 9; }
+inline int f8978_10(int x) { return x * 10; }
+inline int f8978_11(int x) { return x * 11; }
+inline int f8978_12(int x) { return x * 12; }
+inline int f8978_13(int x) { return x * 13; }
+inline int f8978_14(int x) { return x * 14; }
+inline int f8978_15(int x) { return x * 15; }
+inline int f8978_16(int x) { return x * 16; }
+inline int f8978_17(int x) { return x * 17; }
+inline int f8978_18(int x) { return x * 18; }
+inline int f8978_19(int x) { return x * 19; }
+inline int f8978_20(int x) { return x * 20; }
+inline int f8978_21(int x) { return x * 21; }
+inline int f8978_22(int x) { return x * 22; }
+inline int f8978_23(int x) { return x * 23; }
+inline int f8978_24(int x) { return x * 24; }
+inline int f8978_25(int x) { return x * 25; }
+inline int f8978_26(int x) { return x * 26; }
+inline int f8978_27(int x) { return x * 27; }
+inline int f8978_28(int x) { return x * 28; }
+inline int f8978_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8979 */
+#include <vector>
+#include "h138.h"
+#include "h1194.h"
+#include "h9929.h"
+#include "h8029.h"
+#include "h4249.h"
+#ifdef X
+#include "h1814.h"
+#endif
+struct S8979 { int a; const char *s = "x//y"; };
+inline int f8979_0(int x) { return x * 0; }
+inline int f8979_1(int x) { return x * 1; }
+inline int f8979_2(int x) { return x * 2; }
+inline int f8979_3(int x) { return x * 3; }
+inline int f8979_4(int x) { return x * 4; }
+inline int f8979_5(int x) { return x * 5; }
+inline int f8979_6(int x) { return x * 6; }
+inline int f8979_7(int x) { return x * 7; }
+inline int f8979_8(int x) { return x * 8; }
+inline int f8979_9(int x) { return x * 9; }
+inline int f8979_10(int x) { return x * 10; }
+inline int f8979_11(int x) { return x * 11; }
+inline int f8979_12(int x) { return x * 12; }
+inline int f8979_13(int x) { return x * 13; }
+inline int f8979_14(int x) { return x * 14; }
+inline int f8979_15(int x) { return x * 15; }
+inline int f8979_16(int x) { return x * 16; }
+inline int f8979_17(int x) { return x * 17; }
+inline int f8979_18(int x) { return x * 18; }
+inline int f8979_19(int x) { return x * 19; }
+inline int f8979_20(int x) { return x * 20; }
+inline int f8979_21(int x) { return x * 21; }
+inline int f8979_22(int x) { return x * 22; }
+inline int f8979_23(int x) { return x * 23; }
+inline int f8979_24(int x) { return x * 24; }
+inline int f8979_25(int x) { return x * 25; }
+inline int f8979_26(int x) { return x * 26; }
+inline int f8979_27(int x) { return x * 27; }
+inline int f8979_28(int x) { return x * 28; }
+inline int f8979_29(int x) { return x * 29; }
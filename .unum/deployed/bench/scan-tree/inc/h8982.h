@@ -0,0 +1,42 @@
+#pragma once
+/* header 8982 */
+#include <vector>
+#include "h5734.h"
+#include "h2849.h"
+#include "h8605.h"
+#include "h359.h"
+#include "h8187.h"
+#ifdef X
+#include "h2803.h"
+#endif
+struct S8982 { int a; const char *s = "x//y"; };
+inline int f8982_0(int x) { return x * 0; }
+inline int f8982_1(int x) { return x * 1; }
+inline int f8982_2(int x) { return x * 2; }
+inline int f8982_3(int x) { return x * 3; }
+inline int f8982_4(int x) { return x * 4; }
+inline int f8982_5(int x) { return x * 5; }
+inline int f8982_6(int x) { return x * 6; }
+inline int f8982_7(int x) { return x * 7; }
+inline int f8982_8(int x) { return x * 8; }
+inline int f8982_9(int x) { return x * 9; }
+inline int f8982_10(int x) { return x * 10; }
+inline int f8982_11(int x) { return x * 11; }
+inline int f8982_12(int x) { return x * 12; }
+inline int f8982_13(int x) { return x * 13; }
+inline int f8982_14(int x) { return x * 14; }
+inline int f8982_15(int x) { return x * 15; }
+inline int f8982_16(int x) { return x * 16; }
+inline int f8982_17(int x) { return x * 17; }
+inline int f8982_18(int x) { return x * 18; }
+inline int f8982_19(int x) { return x * 19; }
+inline int f8982_20(int x) { return x * 20; }
+inline int f8982_21(int x) { return x * 21; }
+inline int f8982_22(int x) { return x * 22; }
+inline int f8982_23(int x) { return x * 23; }
+inline int f8982_24(int x) { return x * 24; }
+inline int f8982_25(int x) { return x * 25; }
+inline int f8982_26(int x) { return x * 26; }
+inline int f8982_27(int x) { return x * 27; }
+inline int f8982_28(int x) { return x * 28; }
+inline int f8982_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8986 */
+#include <vector>
+#include "h2901.h"
+#include "h6074.h"
+#include "h8866.h"
+#include "h1637.h"
+#include "h304.h"
+#ifdef X
+#include "h9417.h"
+#endif
+struct S8986 { int a; const char *s = "x//y"; };
+inline int f8986_0(int x) { return x * 0; }
+inline int f8986_1(int x) { return x * 1; }
+inline int f8986_2(int x) { return x * 2; }
+inline int f8986_3(int x) { return x * 3; }
+inline int f8986_4(int x) { return x * 4; }
+inline int f8986_5(int x) { return x * 5; }
+inline int f8986_6(int x) { return x * 6; }
+inline int f8986_7(int x) { return x * 7; }
+inline int f8986_8(int x) { return x * 8; }
+inline int f8986_9(int x) { return x * 9; }
+inline int f8986_10(int x) { return x * 10; }
+inline int f8986_11(int x) { return x * 11; }
+inline int f8986_12(int x) { return x * 12; }
+inline int f8986_13(int x) { return x * 13; }
+inline int f8986_14(int x) { return x * 14; }
+inline int f8986_15(int x) { return x * 15; }
+inline int f8986_16(int x) { return x * 16; }
+inline int f8986_17(int x) { return x * 17; }
+inline int f8986_18(int x) { return x * 18; }
+inline int f8986_19(int x) { return x * 19; }
+inline int f8986_20(int x) { return x * 20; }
+inline int f8986_21(int x) { return x * 21; }
+inline int f8986_22(int x) { return x * 22; }
+inline int f8986_23(int x) { return x * 23; }
+inline int f8986_24(int x) { return x * 24; }
+inline int f8986_25(int x) { return x * 25; }
+inline int f8986_26(int x) { return x * 26; }
+inline int f8986_27(int x) { return x * 27; }
+inline int f8986_28(int x) { return x * 28; }
+inline int f8986_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8987 */
+#include <vector>
+#include "h5973.h"
+#include "h4256.h"
+#include "h315.h"
+#include "h3998.h"
+#include "h6401.h"
+#ifdef X
+#include "h5692.h"
+#endif
+struct S8987 { int a; const char *s = "x//y"; };
+inline int f8987_0(int x) { return x * 0; }
+inline int f8987_1(int x) { return x * 1; }
+inline int f8987_2(int x) { return x * 2; }
+inline int f8987_3(int x) { return x * 3; }
+inline int f8987_4(int x) { return x * 4; }
+inline int f8987_5(int x) { return x * 5; }
+inline int f8987_6(int x) { return x * 6; }
+inline int f8987_7(int x) { return x * 7; }
+inline int f8987_8(int x) { return x * 8; }
+inline int f8987_9(int x) { return x * 9; }
+inline int f8987_10(int x) { return x * 10; }
+inline int f8987_11(int x) { return x * 11; }
+inline int f8987_12(int x) { return x * 12; }
+inline int f8987_13(int x) { return x * 13; }
+inline int f8987_14(int x) { return x * 14; }
+inline int f8987_15(int x) { return x * 15; }
+inline int f8987_16(int x) { return x * 16; }
+inline int f8987_17(int x) { return x * 17; }
+inline int f8987_18(int x) { return x * 18; }
+inline int f8987_19(int x) { return x * 19; }
+inline int f8987_20(int x) { return x * 20; }
+inline int f8987_21(int x) { return x * 21; }
+inline int f8987_22(int x) { return x * 22; }
+inline int f8987_23(int x) { return x * 23; }
+inline int f8987_24(int x) { return x * 24; }
+inline int f8987_25(int x) { return x * 25; }
+inline int f8987_26(int x) { return x * 26; }
+inline int f8987_27(int x) { return x * 27; }
+inline int f8987_28(int x) { return x * 28; }
+inline int f8987_29(int x) { return x * 29; }
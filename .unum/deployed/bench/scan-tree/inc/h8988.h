@@ -0,0 +1,42 @@
+#pragma once
+/* header 8988 */
+#include <vector>
+#include "h1590.h"
+#include "h1255.h"
+#include "h1937.h"
+#include "h43.h"
+#include "h9668.h"
+#ifdef X
+#include "h948.h"
+#endif
+struct S8988 { int a; const char *s = "x//y"; };
+inline int f8988_0(int x) { return x * 0; }
+inline int f8988_1(int x) { return x * 1; }
+inline int f8988_2(int x) { return x * 2; }
+inline int f8988_3(int x) { return x * 3; }
+inline int f8988_4(int x) { return x * 4; }
+inline int f8988_5(int x) { return x * 5; }
+inline int f8988_6(int x) { return x * 6; }
+inline int f8988_7(int x) { return x * 7; }
+inline int f8988_8(int x) { return x * 8; }
+inline int f8988_9(int x) { return x * 9; }
+inline int f8988_10(int x) { return x * 10; }
+inline int f8988_11(int x) { return x * 11; }
+inline int f8988_12(int x) { return x * 12; }
+inline int f8988_13(int x) { return x * 13; }
+inline int f8988_14(int x) { return x * 14; }
+inline int f8988_15(int x) { return x * 15; }
+inline int f8988_16(int x) { return x * 16; }
+inline int f8988_17(int x) { return x * 17; }
+inline int f8988_18(int x) { return x * 18; }
+inline int f8988_19(int x) { return x * 19; }
+inline int f8988_20(int x) { return x * 20; }
+inline int f8988_21(int x) { return x * 21; }
+inline int f8988_22(int x) { return x * 22; }
+inline int f8988_23(int x) { return x * 23; }
+inline int f8988_24(int x) { return x * 24; }
+inline int f8988_25(int x) { return x * 25; }
+inline int f8988_26(int x) { return x * 26; }
+inline int f8988_27(int x) { return x * 27; }
+inline int f8988_28(int x) { return x * 28; }
+inline int f8988_29(int x) { return x * 29; }
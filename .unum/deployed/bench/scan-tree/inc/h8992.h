@@ -0,0 +1,42 @@
+#pragma once
+/* header 8992 */
+#include <vector>
+#include "h9202.h"
+#include "h1746.h"
+#include "h3788.h"
+#include "h9156.h"
+#include "h1998.h"
+#ifdef X
+#include "h6884.h"
+#endif
+struct S8992 { int a; const char *s = "x//y"; };
+inline int f8992_0(int x) { return x * 0; }
+inline int f8992_1(int x) { return x * 1; }
+inline int f8992_2(int x) { return x * 2; }
+inline int f8992_3(int x) { return x * 3; }
+inline int f8992_4(int x) { return x * 4; }
+inline int f8992_5(int x) { return x * 5; }
+inline int f8992_6(int x) { return x * 6; }
+inline int f8992_7(int x) { return x * 7; }
+inline int f8992_8(int x) { return x * 8; }
+inline int f8992_9(int x) { return x * 9; }
+inline int f8992_10(int x) { return x * 10; }
+inline int f8992_11(int x) { return x * 11; }
+inline int f8992_12(int x) { return x * 12; }
+inline int f8992_13(int x) { return x * 13; }
+inline int f8992_14(int x) { return x * 14; }
+inline int f8992_15(int x) { return x * 15; }
+inline int f8992_16(int x) { return x * 16; }
+inline int f8992_17(int x) { return x * 17; }
+inline int f8992_18(int x) { return x * 18; }
+inline int f8992_19(int x) { return x * 19; }
+inline int f8992_20(int x) { return x * 20; }
+inline int f8992_21(int x) { return x * 21; }
+inline int f8992_22(int x) { return x * 22; }
+inline int f8992_23(int x) { return x * 23; }
+inline int f8992_24(int x) { return x * 24; }
+inline int f8992_25(int x) { return x * 25; }
+inline int f8992_26(int x) { return x * 26; }
+inline int f8992_27(int x) { return x * 27; }
+inline int f8992_28(int x) { return x * 28; }
+inline int f8992_29(int x) { return x * 29; }
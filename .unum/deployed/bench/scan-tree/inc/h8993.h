@@ -0,0 +1,42 @@
+#pragma once
+/* header 8993 */
+#include <vector>
+#include "h5804.h"
+#include "h3917.h"
+#include "h7572.h"
+#include "h820.h"
+#include "h251.h"
+#ifdef X
+#include "h1359.h"
+#endif
+struct S8993 { int a; const char *s = "x//y"; };
+inline int f8993_0(int x) { return x * 0; }
+inline int f8993_1(int x) { return x * 1; }
+inline int f8993_2(int x) { return x * 2; }
+inline int f8993_3(int x) { return x * 3; }
+inline int f8993_4(int x) { return x * 4; }
+inline int f8993_5(int x) { return x * 5; }
+inline int f8993_6(int x) { return x * 6; }
+inline int f8993_7(int x) { return x * 7; }
+inline int f8993_8(int x) { return x * 8; }
+inline int f8993_9(int x) { return x * 9; }
+inline int f8993_10(int x) { return x * 10; }
+inline int f8993_11(int x) { return x * 11; }
+inline int f8993_12(int x) { return x * 12; }
+inline int f8993_13(int x) { return x * 13; }
+inline int f8993_14(int x) { return x * 14; }
+inline int f8993_15(int x) { return x * 15; }
+inline int f8993_16(int x) { return x * 16; }
+inline int f8993_17(int x) { return x * 17; }
+inline int f8993_18(int x) { return x * 18; }
+inline int f8993_19(int x) { return x * 19; }
+inline int f8993_20(int x) { return x * 20; }
+inline int f8993_21(int x) { return x * 21; }
+inline int f8993_22(int x) { return x * 22; }
+inline int f8993_23(int x) { return x * 23; }
+inline int f8993_24(int x) { return x * 24; }
+inline int f8993_25(int x) { return x * 25; }
+inline int f8993_26(int x) { return x * 26; }
+inline int f8993_27(int x) { return x * 27; }
+inline int f8993_28(int x) { return x * 28; }
+inline int f8993_29(int x) { return x * 29; }
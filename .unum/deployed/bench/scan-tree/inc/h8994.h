@@ -0,0 +1,42 @@
+#pragma once
+/* header 8994 */
+#include <vector>
+#include "h8261.h"
+#include "h4193.h"
+#include "h4006.h"
+#include "h8274.h"
+#include "h2559.h"
+#ifdef X
+#include "h7419.h"
+#endif
+struct S8994 { int a; const char *s = "x//y"; };
+inline int f8994_0(int x) { return x * 0; }
+inline int f8994_1(int x) { return x * 1; }
+inline int f8994_2(int x) { return x * 2; }
+inline int f8994_3(int x) { return x * 3; }
+inline int f8994_4(int x) { return x * 4; }
+inline int f8994_5(int x) { return x * 5; }
+inline int f8994_6(int x) { return x * 6; }
+inline int f8994_7(int x) { return x * 7; }
+inline int f8994_8(int x) { return x * 8; }
+inline int f8994_9(int x) { return x * 9; }
+inline int f8994_10(int x) { return x * 10; }
+inline int f8994_11(int x) { return x * 11; }
+inline int f8994_12(int x) { return x * 12; }
+inline int f8994_13(int x) { return x * 13; }
+inline int f8994_14(int x) { return x * 14; }
+inline int f8994_15(int x) { return x * 15; }
+inline int f8994_16(int x) { return x * 16; }
+inline int f8994_17(int x) { return x * 17; }
+inline int f8994_18(int x) { return x * 18; }
+inline int f8994_19(int x) { return x * 19; }
+inline int f8994_20(int x) { return x * 20; }
+inline int f8994_21(int x) { return x * 21; }
+inline int f8994_22(int x) { return x * 22; }
+inline int f8994_23(int x) { return x * 23; }
+inline int f8994_24(int x) { return x * 24; }
+inline int f8994_25(int x) { return x * 25; }
+inline int f8994_26(int x) { return x * 26; }
+inline int f8994_27(int x) { return x * 27; }
+inline int f8994_28(int x) { return x * 28; }
+inline int f8994_29(int x) { return x * 29; }
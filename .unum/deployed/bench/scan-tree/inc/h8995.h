@@ -0,0 +1,42 @@
+#pragma once
+/* header 8995 */
+#include <vector>
+#include "h8284.h"
+#include "h4259.h"
+#include "h4999.h"
+#include "h7364.h"
+#include "h4349.h"
+#ifdef X
+#include "h2587.h"
+#endif
+struct S8995 { int a; const char *s = "x//y"; };
+inline int f8995_0(int x) { return x * 0; }
+inline int f8995_1(int x) { return x * 1; }
+inline int f8995_2(int x) { return x * 2; }
+inline int f8995_3(int x) { return x * 3; }
+inline int f8995_4(int x) { return x * 4; }
+inline int f8995_5(int x) { return x * 5; }
+inline int f8995_6(int x) { return x * 6; }
+inline int f8995_7(int x) { return x * 7; }
+inline int f8995_8(int x) { return x * 8; }
+inline int f8995_9(int x) { return x * 9; }
+inline int f8995_10(int x) { return x * 10; }
+inline int f8995_11(int x) { return x * 11; }
+inline int f8995_12(int x) { return x * 12; }
+inline int f8995_13(int x) { return x * 13; }
+inline int f8995_14(int x) { return x * 14; }
+inline int f8995_15(int x) { return x * 15; }
+inline int f8995_16(int x) { return x * 16; }
+inline int f8995_17(int x) { return x * 17; }
+inline int f8995_18(int x) { return x * 18; }
+inline int f8995_19(int x) { return x * 19; }
+inline int f8995_20(int x) { return x * 20; }
+inline int f8995_21(int x) { return x * 21; }
+inline int f8995_22(int x) { return x * 22; }
+inline int f8995_23(int x) { return x * 23; }
+inline int f8995_24(int x) { return x * 24; }
+inline int f8995_25(int x) { return x * 25; }
+inline int f8995_26(int x) { return x * 26; }
+inline int f8995_27(int x) { return x * 27; }
+inline int f8995_28(int x) { return x * 28; }
+inline int f8995_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8997 */
+#include <vector>
+#include "h3223.h"
+#include "h4918.h"
+#include "h7011.h"
+#include "h9285.h"
+#include "h4662.h"
+#ifdef X
+#include "h519.h"
+#endif
+struct S8997 { int a; const char *s = "x//y"; };
+inline int f8997_0(int x) { return x * 0; }
+inline int f8997_1(int x) { return x * 1; }
+inline int f8997_2(int x) { return x * 2; }
+inline int f8997_3(int x) { return x * 3; }
+inline int f8997_4(int x) { return x * 4; }
+inline int f8997_5(int x) { return x * 5; }
+inline int f8997_6(int x) { return x * 6; }
+inline int f8997_7(int x) { return x * 7; }
+inline int f8997_8(int x) { return x * 8; }
+inline int f8997_9(int x) { return x * 9; }
+inline int f8997_10(int x) { return x * 10; }
+inline int f8997_11(int x) { return x * 11; }
+inline int f8997_12(int x) { return x * 12; }
+inline int f8997_13(int x) { return x * 13; }
+inline int f8997_14(int x) { return x * 14; }
+inline int f8997_15(int x) { return x * 15; }
+inline int f8997_16(int x) { return x * 16; }
+inline int f8997_17(int x) { return x * 17; }
+inline int f8997_18(int x) { return x * 18; }
+inline int f8997_19(int x) { return x * 19; }
+inline int f8997_20(int x) { return x * 20; }
+inline int f8997_21(int x) { return x * 21; }
+inline int f8997_22(int x) { return x * 22; }
+inline int f8997_23(int x) { return x * 23; }
+inline int f8997_24(int x) { return x * 24; }
+inline int f8997_25(int x) { return x * 25; }
+inline int f8997_26(int x) { return x * 26; }
+inline int f8997_27(int x) { return x * 27; }
+inline int f8997_28(int x) { return x * 28; }
+inline int f8997_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8998 */
+#include <vector>
+#include "h9443.h"
+#include "h3925.h"
+#include "h4950.h"
+#include "h3399.h"
+#include "h5911.h"
+#ifdef X
+#include "h5436.h"
+#endif
+struct S8998 { int a; const char *s = "x//y"; };
+inline int f8998_0(int x) { return x * 0; }
+inline int f8998_1(int x) { return x * 1; }
+inline int f8998_2(int x) { return x * 2; }
+inline int f8998_3(int x) { return x * 3; }
+inline int f8998_4(int x) { return x * 4; }
+inline int f8998_5(int x) { return x * 5; }
+inline int f8998_6(int x) { return x * 6; }
+inline int f8998_7(int x) { return x * 7; }
+inline int f8998_8(int x) { return x * 8; }
+inline int f8998_9(int x) { return x * 9; }
+inline int f8998_10(int x) { return x * 10; }
+inline int f8998_11(int x) { return x * 11; }
+inline int f8998_12(int x) { return x * 12; }
+inline int f8998_13(int x) { return x * 13; }
+inline int f8998_14(int x) { return x * 14; }
+inline int f8998_15(int x) { return x * 15; }
+inline int f8998_16(int x) { return x * 16; }
+inline int f8998_17(int x) { return x * 17; }
+inline int f8998_18(int x) { return x * 18; }
+inline int f8998_19(int x) { return x * 19; }
+inline int f8998_20(int x) { return x * 20; }
+inline int f8998_21(int x) { return x * 21; }
+inline int f8998_22(int x) { return x * 22; }
+inline int f8998_23(int x) { return x * 23; }
+inline int f8998_24(int x) { return x * 24; }
+inline int f8998_25(int x) { return x * 25; }
+inline int f8998_26(int x) { return x * 26; }
+inline int f8998_27(int x) { return x * 27; }
+inline int f8998_28(int x) { return x * 28; }
+inline int f8998_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 8999 */
+#include <vector>
+#include "h9132.h"
+#include "h9412.h"
+#include "h9590.h"
+#include "h3502.h"
+#include "h1824.h"
+#ifdef X
+#include "h4778.h"
+#endif
+struct S8999 { int a; const char *s = "x//y"; };
+inline int f8999_0(int x) { return x * 0; }
+inline int f8999_1(int x) { return x * 1; }
+inline int f8999_2(int x) { return x * 2; }
+inline int f8999_3(int x) { return x * 3; }
+inline int f8999_4(int x) { return x * 4; }
+inline int f8999_5(int x) { return x * 5; }
+inline int f8999_6(int x) { return x * 6; }
+inline int f8999_7(int x) { return x * 7; }
+inline int f8999_8(int x) { return x * 8; }
+inline int f8999_9(int x) { return x * 9; }
+inline int f8999_10(int x) { return x * 10; }
+inline int f8999_11(int x) { return x * 11; }
+inline int f8999_12(int x) { return x * 12; }
+inline int f8999_13(int x) { return x * 13; }
+inline int f8999_14(int x) { return x * 14; }
+inline int f8999_15(int x) { return x * 15; }
+inline int f8999_16(int x) { return x * 16; }
+inline int f8999_17(int x) { return x * 17; }
+inline int f8999_18(int x) { return x * 18; }
+inline int f8999_19(int x) { return x * 19; }
+inline int f8999_20(int x) { return x * 20; }
+inline int f8999_21(int x) { return x * 21; }
+inline int f8999_22(int x) { return x * 22; }
+inline int f8999_23(int x) { return x * 23; }
+inline int f8999_24(int x) { return x * 24; }
+inline int f8999_25(int x) { return x * 25; }
+inline int f8999_26(int x) { return x * 26; }
+inline int f8999_27(int x) { return x * 27; }
+inline int f8999_28(int x) { return x * 28; }
+inline int f8999_29(int x) { return x * 29; }
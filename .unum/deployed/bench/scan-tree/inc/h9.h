@@ -0,0 +1,42 @@
+#pragma once
+/* header 9 */
+#include <vector>
+#include "h3476.h"
+#include "h2576.h"
+#include "h1242.h"
+#include "h3275.h"
+#include "h3716.h"
+#ifdef X
+#include "h3976.h"
+#endif
+struct S9 { int a; const char *s = "x//y"; };
+inline int f9_0(int x) { return x * 0; }
+inline int f9_1(int x) { return x * 1; }
+inline int f9_2(int x) { return x * 2; }
+inline int f9_3(int x) { return x * 3; }
+inline int f9_4(int x) { return x * 4; }
+inline int f9_5(int x) { return x * 5; }
+inline int f9_6(int x) { return x * 6; }
+inline int f9_7(int x) { return x * 7; }
+inline int f9_8(int x) { return x * 8; }
+inline int f9_9(int x) { return x * 9; }
+inline int f9_10(int x) { return x * 10; }
+inline int f9_11(int x) { return x * 11; }
+inline int f9_12(int x) { return x * 12; }
+inline int f9_13(int x) { return x * 13; }
+inline int f9_14(int x) { return x * 14; }
+inline int f9_15(int x) { return x * 15; }
+inline int f9_16(int x) { return x * 16; }
+inline int f9_17(int x) { return x * 17; }
+inline int f9_18(int x) { return x * 18; }
+inline int f9_19(int x) { return x * 19; }
+inline int f9_20(int x) { return x * 20; }
+inline int f9_21(int x) { return x * 21; }
+inline int f9_22(int x) { return x * 22; }
+inline int f9_23(int x) { return x * 23; }
+inline int f9_24(int x) { return x * 24; }
+inline int f9_25(int x) { return x * 25; }
+inline int f9_26(int x) { return x * 26; }
+inline int f9_27(int x) { return x * 27; }
+inline int f9_28(int x) { return x * 28; }
+inline int f9_29(int x) { return x * 29; }
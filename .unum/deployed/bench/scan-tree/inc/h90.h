@@ -0,0 +1,42 @@
+#pragma once
+/* header 90 */
+#include <vector>
+#include "h8826.h"
+#include "h1010.h"
+#include "h6776.h"
+#include "h2875.h"
+#include "h6561.h"
+#ifdef X
+#include "h2462.h"
+#endif
+struct S90 { int a; const char *s = "x//y"; };
+inline int f90_0(int x) { return x * 0; }
+inline int f90_1(int x) { return x * 1; }
+inline int f90_2(int x) { return x * 2; }
+inline int f90_3(int x) { return x * 3; }
+inline int f90_4(int x) { return x * 4; }
+inline int f90_5(int x) { return x * 5; }
+inline int f90_6(int x) { return x * 6; }
+inline int f90_7(int x) { return x * 7; }
+inline int f90_8(int x) { return x * 8; }
+inline int f90_9(int x) { return x * 9; }
+inline int f90_10(int x) { return x * 10; }
+inline int f90_11(int x) { return x * 11; }
+inline int f90_12(int x) { return x * 12; }
+inline int f90_13(int x) { return x * 13; }
+inline int f90_14(int x) { return x * 14; }
+inline int f90_15(int x) { return x * 15; }
+inline int f90_16(int x) { return x * 16; }
+inline int f90_17(int x) { return x * 17; }
+inline int f90_18(int x) { return x * 18; }
+inline int f90_19(int x) { return x * 19; }
+inline int f90_20(int x) { return x * 20; }
+inline int f90_21(int x) { return x * 21; }
+inline int f90_22(int x) { return x * 22; }
+inline int f90_23(int x) { return x * 23; }
+inline int f90_24(int x) { return x * 24; }
+inline int f90_25(int x) { return x * 25; }
+inline int f90_26(int x) { return x * 26; }
+inline int f90_27(int x) { return x * 27; }
+inline int f90_28(int x) { return x * 28; }
+inline int f90_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 900 */
+#include <vector>
+#include "h6508.h"
+#include "h6722.h"
+#include "h4050.h"
+#include "h436.h"
+#include "h2933.h"
+#ifdef X
+#include "h7612.h"
+#endif
+struct S900 { int a; const char *s = "x//y"; };
+inline int f900_0(int x) { return x * 0; }
+inline int f900_1(int x) { return x * 1; }
+inline int f900_2(int x) { return x * 2; }
+inline int f900_3(int x) { return x * 3; }
+inline int f900_4(int x) { return x * 4; }
+inline int f900_5(int x) { return x * 5; }
+inline int f900_6(int x) { return x * 6; }
+inline int f900_7(int x) { return x * 7; }
+inline int f900_8(int x) { return x * 8; }
+inline int f900_9(int x) { return x * 9; }
+inline int f900_10(int x) { return x * 10; }
+inline int f900_11(int x) { return x * 11; }
+inline int f900_12(int x) { return x * 12; }
+inline int f900_13(int x) { return x * 13; }
+inline int f900_14(int x) { return x * 14; }
+inline int f900_15(int x) { return x * 15; }
+inline int f900_16(int x) { return x * 16; }
+inline int f900_17(int x) { return x * 17; }
+inline int f900_18(int x) { return x * 18; }
+inline int f900_19(int x) { return x * 19; }
+inline int f900_20(int x) { return x * 20; }
+inline int f900_21(int x) { return x * 21; }
+inline int f900_22(int x) { return x * 22; }
+inline int f900_23(int x) { return x * 23; }
+inline int f900_24(int x) { return x * 24; }
+inline int f900_25(int x) { return x * 25; }
+inline int f900_26(int x) { return x * 26; }
+inline int f900_27(int x) { return x * 27; }
+inline int f900_28(int x) { return x * 28; }
+inline int f900_29(int x) { return x * 29; }
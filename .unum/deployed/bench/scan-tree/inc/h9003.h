@@ -0,0 +1,42 @@
+#pragma once
+/* header 9003 */
+#include <vector>
+#include "h7219.h"
+#include "h9989.h"
+#include "h131.h"
+#include "h4459.h"
+#include "h4051.h"
+#ifdef X
+#include "h1170.h"
+#endif
+struct S9003 { int a; const char *s = "x//y"; };
+inline int f9003_0(int x) { return x * 0; }
+inline int f9003_1(int x) { return x * 1; }
+inline int f9003_2(int x) { return x * 2; }
+inline int f9003_3(int x) { return x * 3; }
+inline int f9003_4(int x) { return x * 4; }
+inline int f9003_5(int x) { return x * 5; }
+inline int f9003_6(int x) { return x * 6; }
+inline int f9003_7(int x) { return x * 7; }
+inline int f9003_8(int x) { return x * 8; }
+inline int f9003_9(int x) { return x * 9; }
+inline int f9003_10(int x) { return x * 10; }
+inline int f9003_11(int x) { return x * 11; }
+inline int f9003_12(int x) { return x * 12; }
+inline int f9003_13(int x) { return x * 13; }
+inline int f9003_14(int x) { return x * 14; }
+inline int f9003_15(int x) { return x * 15; }
+inline int f9003_16(int x) { return x * 16; }
+inline int f9003_17(int x) { return x * 17; }
+inline int f9003_18(int x) { return x * 18; }
+inline int f9003_19(int x) { return x * 19; }
+inline int f9003_20(int x) { return x * 20; }
+inline int f9003_21(int x) { return x * 21; }
+inline int f9003_22(int x) { return x * 22; }
+inline int f9003_23(int x) { return x * 23; }
+inline int f9003_24(int x) { return x * 24; }
+inline int f9003_25(int x) { return x * 25; }
+inline int f9003_26(int x) { return x * 26; }
+inline int f9003_27(int x) { return x * 27; }
+inline int f9003_28(int x) { return x * 28; }
+inline int f9003_29(int x) { return x * 29; }
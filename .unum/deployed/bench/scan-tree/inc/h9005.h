@@ -0,0 +1,42 @@
+#pragma once
+/* header 9005 */
+#include <vector>
+#include "h1559.h"
+#include "h642.h"
+#include "h1536.h"
+#include "h1679.h"
+#include "h1392.h"
+#ifdef X
+#include "h1997.h"
+#endif
+struct S9005 { int a; const char *s = "x//y"; };
+inline int f9005_0(int x) { return x * 0; }
+inline int f9005_1(int x) { return x * 1; }
+inline int f9005_2(int x) { return x * 2; }
+inline int f9005_3(int x) { return x * 3; }
+inline int f9005_4(int x) { return x * 4; }
+inline int f9005_5(int x) { return x * 5; }
+inline int f9005_6(int x) { return x * 6; }
+inline int f9005_7(int x) { return x * 7; }
+inline int f9005_8(int x) { return x * 8; }
+inline int f9005_9(int x) { return x * 9; }
+inline int f9005_10(int x) { return x * 10; }
+inline int f9005_11(int x) { return x * 11; }
+inline int f9005_12(int x) { return x * 12; }
+inline int f9005_13(int x) { return x * 13; }
+inline int f9005_14(int x) { return x * 14; }
+inline int f9005_15(int x) { return x * 15; }
+inline int f9005_16(int x) { return x * 16; }
+inline int f9005_17(int x) { return x * 17; }
+inline int f9005_18(int x) { return x * 18; }
+inline int f9005_19(int x) { return x * 19; }
+inline int f9005_20(int x) { return x * 20; }
+inline int f9005_21(int x) { return x * 21; }
+inline int f9005_22(int x) { return x * 22; }
+inline int f9005_23(int x) { return x * 23; }
+inline int f9005_24(int x) { return x * 24; }
+inline int f9005_25(int x) { return x * 25; }
+inline int f9005_26(int x) { return x * 26; }
+inline int f9005_27(int x) { return x * 27; }
+inline int f9005_28(int x) { return x * 28; }
+inline int f9005_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9006 */
+#include <vector>
+#include "h8372.h"
+#include "h6514.h"
+#include "h7575.h"
+#include "h4939.h"
+#include "h4789.h"
+#ifdef X
+#include "h2932.h"
+#endif
+struct S9006 { int a; const char *s = "x//y"; };
+inline int f9006_0(int x) { return x * 0; }
+inline int f9006_1(int x) { return x * 1; }
+inline int f9006_2(int x) { return x * 2; }
+inline int f9006_3(int x) { return x * 3; }
+inline int f9006_4(int x) { return x * 4; }
+inline int f9006_5(int x) { return x * 5; }
+inline int f9006_6(int x) { return x * 6; }
+inline int f9006_7(int x) { return x * 7; }
+inline int f9006_8(int x) { return x * 8; }
+inline int f9006_9(int x) { return x * 9; }
+inline int f9006_10(int x) { return x * 10; }
+inline int f9006_11(int x) { return x * 11; }
+inline int f9006_12(int x) { return x * 12; }
+inline int f9006_13(int x) { return x * 13; }
+inline int f9006_14(int x) { return x * 14; }
+inline int f9006_15(int x) { return x * 15; }
+inline int f9006_16(int x) { return x * 16; }
+inline int f9006_17(int x) { return x * 17; }
+inline int f9006_18(int x) { return x * 18; }
+inline int f9006_19(int x) { return x * 19; }
+inline int f9006_20(int x) { return x * 20; }
+inline int f9006_21(int x) { return x * 21; }
+inline int f9006_22(int x) { return x * 22; }
+inline int f9006_23(int x) { return x * 23; }
+inline int f9006_24(int x) { return x * 24; }
+inline int f9006_25(int x) { return x * 25; }
+inline int f9006_26(int x) { return x * 26; }
+inline int f9006_27(int x) { return x * 27; }
+inline int f9006_28(int x) { return x * 28; }
+inline int f9006_29(int x) { return x * 29; }
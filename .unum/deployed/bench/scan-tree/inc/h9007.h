@@ -0,0 +1,42 @@
+#pragma once
+/* header 9007 */
+#include <vector>
+#include "h4829.h"
+#include "h3139.h"
+#include "h7391.h"
+#include "h9849.h"
+#include "h668.h"
+#ifdef X
+#include "h1243.h"
+#endif
+struct S9007 { int a; const char *s = "x//y"; };
+inline int f9007_0(int x) { return x * 0; }
+inline int f9007_1(int x) { return x * 1; }
+inline int f9007_2(int x) { return x * 2; }
+inline int f9007_3(int x) { return x * 3; }
+inline int f9007_4(int x) { return x * 4; }
+inline int f9007_5(int x) { return x * 5; }
+inline int f9007_6(int x) { return x * 6; }
+inline int f9007_7(int x) { return x * 7; }
+inline int f9007_8(int x) { return x * 8; }
+inline int f9007_9(int x) { return x * 9; }
+inline int f9007_10(int x) { return x * 10; }
+inline int f9007_11(int x) { return x * 11; }
+inline int f9007_12(int x) { return x * 12; }
+inline int f9007_13(int x) { return x * 13; }
+inline int f9007_14(int x) { return x * 14; }
+inline int f9007_15(int x) { return x * 15; }
+inline int f9007_16(int x) { return x * 16; }
+inline int f9007_17(int x) { return x * 17; }
+inline int f9007_18(int x) { return x * 18; }
+inline int f9007_19(int x) { return x * 19; }
+inline int f9007_20(int x) { return x * 20; }
+inline int f9007_21(int x) { return x * 21; }
+inline int f9007_22(int x) { return x * 22; }
+inline int f9007_23(int x) { return x * 23; }
+inline int f9007_24(int x) { return x * 24; }
+inline int f9007_25(int x) { return x * 25; }
+inline int f9007_26(int x) { return x * 26; }
+inline int f9007_27(int x) { return x * 27; }
+inline int f9007_28(int x) { return x * 28; }
+inline int f9007_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9008 */
+#include <vector>
+#include "h4525.h"
+#include "h3887.h"
+#include "h3266.h"
+#include "h9407.h"
+#include "h707.h"
+#ifdef X
+#include "h1609.h"
+#endif
+struct S9008 { int a; const char *s = "x//y"; };
+inline int f9008_0(int x) { return x * 0; }
+inline int f9008_1(int x) { return x * 1; }
+inline int f9008_2(int x) { return x * 2; }
+inline int f9008_3(int x) { return x * 3; }
+inline int f9008_4(int x) { return x * 4; }
+inline int f9008_5(int x) { return x * 5; }
+inline int f9008_6(int x) { return x * 6; }
+inline int f9008_7(int x) { return x * 7; }
+inline int f9008_8(int x) { return x * 8; }
+inline int f9008_9(int x) { return x * 9; }
+inline int f9008_10(int x) { return x * 10; }
+inline int f9008_11(int x) { return x * 11; }
+inline int f9008_12(int x) { return x * 12; }
+inline int f9008_13(int x) { return x * 13; }
+inline int f9008_14(int x) { return x * 14; }
+inline int f9008_15(int x) { return x * 15; }
+inline int f9008_16(int x) { return x * 16; }
+inline int f9008_17(int x) { return x * 17; }
+inline int f9008_18(int x) { return x * 18; }
+inline int f9008_19(int x) { return x * 19; }
+inline int f9008_20(int x) { return x * 20; }
+inline int f9008_21(int x) { return x * 21; }
+inline int f9008_22(int x) { return x * 22; }
+inline int f9008_23(int x) { return x * 23; }
+inline int f9008_24(int x) { return x * 24; }
+inline int f9008_25(int x) { return x * 25; }
+inline int f9008_26(int x) { return x * 26; }
+inline int f9008_27(int x) { return x * 27; }
+inline int f9008_28(int x) { return x * 28; }
+inline int f9008_29(int x) { return x * 29; }
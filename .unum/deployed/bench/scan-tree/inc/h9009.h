@@ -0,0 +1,42 @@
+#pragma once
+/* header 9009 */
+#include <vector>
+#include "h1944.h"
+#include "h6744.h"
+#include "h2512.h"
+#include "h434.h"
+#include "h9448.h"
+#ifdef X
+#include "h7434.h"
+#endif
+struct S9009 { int a; const char *s = "x//y"; };
+inline int f9009_0(int x) { return x * 0; }
+inline int f9009_1(int x) { return x * 1; }
+inline int f9009_2(int x) { return x * 2; }
+inline int f9009_3(int x) { return x * 3; }
+inline int f9009_4(int x) { return x * 4; }
+inline int f9009_5(int x) { return x * 5; }
+inline int f9009_6(int x) { return x * 6; }
+inline int f9009_7(int x) { return x * 7; }
+inline int f9009_8(int x) { return x * 8; }
+inline int f9009_9(int x) { return x * 9; }
+inline int f9009_10(int x) { return x * 10; }
+inline int f9009_11(int x) { return x * 11; }
+inline int f9009_12(int x) { return x * 12; }
+inline int f9009_13(int x) { return x * 13; }
+inline int f9009_14(int x) { return x * 14; }
+inline int f9009_15(int x) { return x * 15; }
+inline int f9009_16(int x) { return x * 16; }
+inline int f9009_17(int x) { return x * 17; }
+inline int f9009_18(int x) { return x * 18; }
+inline int f9009_19(int x) { return x * 19; }
+inline int f9009_20(int x) { return x * 20; }
+inline int f9009_21(int x) { return x * 21; }
+inline int f9009_22(int x) { return x * 22; }
+inline int f9009_23(int x) { return x * 23; }
+inline int f9009_24(int x) { return x * 24; }
+inline int f9009_25(int x) { return x * 25; }
+inline int f9009_26(int x) { return x * 26; }
+inline int f9009_27(int x) { return x * 27; }
+inline int f9009_28(int x) { return x * 28; }
+inline int f9009_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9011 */
+#include <vector>
+#include "h4625.h"
+#include "h8453.h"
+#include "h4213.h"
+#include "h1692.h"
+#include "h3712.h"
+#ifdef X
+#include "h9495.h"
+#endif
+struct S9011 { int a; const char *s = "x//y"; };
+inline int f9011_0(int x) { return x * 0; }
+inline int f9011_1(int x) { return x * 1; }
+inline int f9011_2(int x) { return x * 2; }
+inline int f9011_3(int x) { return x * 3; }
+inline int f9011_4(int x) { return x * 4; }
+inline int f9011_5(int x) { return x * 5; }
+inline int f9011_6(int x) { return x * 6; }
+inline int f9011_7(int x) { return x * 7; }
+inline int f9011_8(int x) { return x * 8; }
+inline int f9011_9(int x) { return x * 9; }
+inline int f9011_10(int x) { return x * 10; }
+inline int f9011_11(int x) { return x * 11; }
+inline int f9011_12(int x) { return x * 12; }
+inline int f9011_13(int x) { return x * 13; }
+inline int f9011_14(int x) { return x * 14; }
+inline int f9011_15(int x) { return x * 15; }
+inline int f9011_16(int x) { return x * 16; }
+inline int f9011_17(int x) { return x * 17; }
+inline int f9011_18(int x) { return x * 18; }
+inline int f9011_19(int x) { return x * 19; }
+inline int f9011_20(int x) { return x * 20; }
+inline int f9011_21(int x) { return x * 21; }
+inline int f9011_22(int x) { return x * 22; }
+inline int f9011_23(int x) { return x * 23; }
+inline int f9011_24(int x) { return x * 24; }
+inline int f9011_25(int x) { return x * 25; }
+inline int f9011_26(int x) { return x * 26; }
+inline int f9011_27(int x) { return x * 27; }
+inline int f9011_28(int x) { return x * 28; }
+inline int f9011_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9012 */
+#include <vector>
+#include "h6985.h"
+#include "h3586.h"
+#include "h6578.h"
+#include "h5530.h"
+#include "h2709.h"
+#ifdef X
+#include "h9508.h"
+#endif
+struct S9012 { int a; const char *s = "x//y"; };
+inline int f9012_0(int x) { return x * 0; }
+inline int f9012_1(int x) { return x * 1; }
+inline int f9012_2(int x) { return x * 2; }
+inline int f9012_3(int x) { return x * 3; }
+inline int f9012_4(int x) { return x * 4; }
+inline int f9012_5(int x) { return x * 5; }
+inline int f9012_6(int x) { return x * 6; }
+inline int f9012_7(int x) { return x * 7; }
+inline int f9012_8(int x) { return x * 8; }
+inline int f9012_9(int x) { return x * 9; }
+inline int f9012_10(int x) { return x * 10; }
+inline int f9012_11(int x) { return x * 11; }
+inline int f9012_12(int x) { return x * 12; }
+inline int f9012_13(int x) { return x * 13; }
+inline int f9012_14(int x) { return x * 14; }
+inline int f9012_15(int x) { return x * 15; }
+inline int f9012_16(int x) { return x * 16; }
+inline int f9012_17(int x) { return x * 17; }
+inline int f9012_18(int x) { return x * 18; }
+inline int f9012_19(int x) { return x * 19; }
+inline int f9012_20(int x) { return x * 20; }
+inline int f9012_21(int x) { return x * 21; }
+inline int f9012_22(int x) { return x * 22; }
+inline int f9012_23(int x) { return x * 23; }
+inline int f9012_24(int x) { return x * 24; }
+inline int f9012_25(int x) { return x * 25; }
+inline int f9012_26(int x) { return x * 26; }
+inline int f9012_27(int x) { return x * 27; }
+inline int f9012_28(int x) { return x * 28; }
+inline int f9012_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9017 */
+#include <vector>
+#include "h9908.h"
+#include "h3761.h"
+#include "h677.h"
+#include "h9264.h"
+#include "h3723.h"
+#ifdef X
+#include "h9199.h"
+#endif
+struct S9017 { int a; const char *s = "x//y"; };
+inline int f9017_0(int x) { return x * 0; }
+inline int f9017_1(int x) { return x * 1; }
+inline int f9017_2(int x) { return x * 2; }
+inline int f9017_3(int x) { return x * 3; }
+inline int f9017_4(int x) { return x * 4; }
+inline int f9017_5(int x) { return x * 5; }
+inline int f9017_6(int x) { return x * 6; }
+inline int f9017_7(int x) { return x * 7; }
+inline int f9017_8(int x) { return x * 8; }
+inline int f9017_9(int x) { return x * 9; }
+inline int f9017_10(int x) { return x * 10; }
+inline int f9017_11(int x) { return x * 11; }
+inline int f9017_12(int x) { return x * 12; }
+inline int f9017_13(int x) { return x * 13; }
+inline int f9017_14(int x) { return x * 14; }
+inline int f9017_15(int x) { return x * 15; }
+inline int f9017_16(int x) { return x * 16; }
+inline int f9017_17(int x) { return x * 17; }
+inline int f9017_18(int x) { return x * 18; }
+inline int f9017_19(int x) { return x * 19; }
+inline int f9017_20(int x) { return x * 20; }
+inline int f9017_21(int x) { return x * 21; }
+inline int f9017_22(int x) { return x * 22; }
+inline int f9017_23(int x) { return x * 23; }
+inline int f9017_24(int x) { return x * 24; }
+inline int f9017_25(int x) { return x * 25; }
+inline int f9017_26(int x) { return x * 26; }
+inline int f9017_27(int x) { return x * 27; }
+inline int f9017_28(int x) { return x * 28; }
+inline int f9017_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9019 */
+#include <vector>
+#include "h5406.h"
+#include "h3664.h"
+#include "h4196.h"
+#include "h6157.h"
+#include "h6610.h"
+#ifdef X
+#include "h9725.h"
+#endif
+struct S9019 { int a; const char *s = "x//y"; };
+inline int f9019_0(int x) { return x * 0; }
+inline int f9019_1(int x) { return x * 1; }
+inline int f9019_2(int x) { return x * 2; }
+inline int f9019_3(int x) { return x * 3; }
+inline int f9019_4(int x) { return x * 4; }
+inline int f9019_5(int x) { return x * 5; }
+inline int f9019_6(int x) { return x * 6; }
+inline int f9019_7(int x) { return x * 7; }
+inline int f9019_8(int x) { return x * 8; }
+inline int f9019_9(int x) { return x * 9; }
+inline int f9019_10(int x) { return x * 10; }
+inline int f9019_11(int x) { return x * 11; }
+inline int f9019_12(int x) { return x * 12; }
+inline int f9019_13(int x) { return x * 13; }
+inline int f9019_14(int x) { return x * 14; }
+inline int f9019_15(int x) { return x * 15; }
+inline int f9019_16(int x) { return x * 16; }
+inline int f9019_17(int x) { return x * 17; }
+inline int f9019_18(int x) { return x * 18; }
+inline int f9019_19(int x) { return x * 19; }
+inline int f9019_20(int x) { return x * 20; }
+inline int f9019_21(int x) { return x * 21; }
+inline int f9019_22(int x) { return x * 22; }
+inline int f9019_23(int x) { return x * 23; }
+inline int f9019_24(int x) { return x * 24; }
+inline int f9019_25(int x) { return x * 25; }
+inline int f9019_26(int x) { return x * 26; }
+inline int f9019_27(int x) { return x * 27; }
+inline int f9019_28(int x) { return x * 28; }
+inline int f9019_29(int x) { return x * 29; }
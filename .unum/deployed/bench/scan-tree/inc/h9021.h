@@ -0,0 +1,42 @@
+#pragma once
+/* header 9021 */
+#include <vector>
+#include "h5544.h"
+#include "h5519.h"
+#include "h5022.h"
+#include "h1887.h"
+#include "h4622.h"
+#ifdef X
+#include "h8101.h"
+#endif
+struct S9021 { int a; const char *s = "x//y"; };
+inline int f9021_0(int x) { return x * 0; }
+inline int f9021_1(int x) { return x * 1; }
+inline int f9021_2(int x) { return x * 2; }
+inline int f9021_3(int x) { return x * 3; }
+inline int f9021_4(int x) { return x * 4; }
+inline int f9021_5(int x) { return x * 5; }
+inline int f9021_6(int x) { return x * 6; }
+inline int f9021_7(int x) { return x * 7; }
+inline int f9021_8(int x) { return x * 8; }
+inline int f9021_9(int x) { return x * 9; }
+inline int f9021_10(int x) { return x * 10; }
+inline int f9021_11(int x) { return x * 11; }
+inline int f9021_12(int x) { return x * 12; }
+inline int f9021_13(int x) { return x * 13; }
+inline int f9021_14(int x) { return x * 14; }
+inline int f9021_15(int x) { return x * 15; }
+inline int f9021_16(int x) { return x * 16; }
+inline int f9021_17(int x) { return x * 17; }
+inline int f9021_18(int x) { return x * 18; }
+inline int f9021_19(int x) { return x * 19; }
+inline int f9021_20(int x) { return x * 20; }
+inline int f9021_21(int x) { return x * 21; }
+inline int f9021_22(int x) { return x * 22; }
+inline int f9021_23(int x) { return x * 23; }
+inline int f9021_24(int x) { return x * 24; }
+inline int f9021_25(int x) { return x * 25; }
+inline int f9021_26(int x) { return x * 26; }
+inline int f9021_27(int x) { return x * 27; }
+inline int f9021_28(int x) { return x * 28; }
+inline int f9021_29(int x) { return x * 29; }
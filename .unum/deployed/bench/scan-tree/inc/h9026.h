@@ -0,0 +1,42 @@
+#pragma once
+/* header 9026 */
+#include <vector>
+#include "h5367.h"
+#include "h4252.h"
+#include "h6089.h"
+#include "h2852.h"
+#include "h3660.h"
+#ifdef X
+#include "h9010.h"
+#endif
+struct S9026 { int a; const char *s = "x//y"; };
+inline int f9026_0(int x) { return x * 0; }
+inline int f9026_1(int x) { return x * 1; }
+inline int f9026_2(int x) { return x * 2; }
+inline int f9026_3(int x) { return x * 3; }
+inline int f9026_4(int x) { return x * 4; }
+inline int f9026_5(int x) { return x * 5; }
+inline int f9026_6(int x) { return x * 6; }
+inline int f9026_7(int x) { return x * 7; }
+inline int f9026_8(int x) { return x * 8; }
+inline int f9026_9(int x) { return x * 9; }
+inline int f9026_10(int x) { return x * 10; }
+inline int f9026_11(int x) { return x * 11; }
+inline int f9026_12(int x) { return x * 12; }
+inline int f9026_13(int x) { return x * 13; }
+inline int f9026_14(int x) { return x * 14; }
+inline int f9026_15(int x) { return x * 15; }
+inline int f9026_16(int x) { return x * 16; }
+inline int f9026_17(int x) { return x * 17; }
+inline int f9026_18(int x) { return x * 18; }
+inline int f9026_19(int x) { return x * 19; }
+inline int f9026_20(int x) { return x * 20; }
+inline int f9026_21(int x) { return x * 21; }
+inline int f9026_22(int x) { return x * 22; }
+inline int f9026_23(int x) { return x * 23; }
+inline int f9026_24(int x) { return x * 24; }
+inline int f9026_25(int x) { return x * 25; }
+inline int f9026_26(int x) { return x * 26; }
+inline int f9026_27(int x) { return x * 27; }
+inline int f9026_28(int x) { return x * 28; }
+inline int f9026_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9027 */
+#include <vector>
+#include "h6416.h"
+#include "h7197.h"
+#include "h4629.h"
+#include "h7277.h"
+#include "h1122.h"
+#ifdef X
+#include "h7001.h"
+#endif
+struct S9027 { int a; const char *s = "x//y"; };
+inline int f9027_0(int x) { return x * 0; }
+inline int f9027_1(int x) { return x * 1; }
+inline int f9027_2(int x) { return x * 2; }
+inline int f9027_3(int x) { return x * 3; }
+inline int f9027_4(int x) { return x * 4; }
+inline int f9027_5(int x) { return x * 5; }
+inline int f9027_6(int x) { return x * 6; }
+inline int f9027_7(int x) { return x * 7; }
+inline int f9027_8(int x) { return x * 8; }
+inline int f9027_9(int x) { return x * 9; }
+inline int f9027_10(int x) { return x * 10; }
+inline int f9027_11(int x) { return x * 11; }
+inline int f9027_12(int x) { return x * 12; }
+inline int f9027_13(int x) { return x * 13; }
+inline int f9027_14(int x) { return x * 14; }
+inline int f9027_15(int x) { return x * 15; }
+inline int f9027_16(int x) { return x * 16; }
+inline int f9027_17(int x) { return x * 17; }
+inline int f9027_18(int x) { return x * 18; }
+inline int f9027_19(int x) { return x * 19; }
+inline int f9027_20(int x) { return x * 20; }
+inline int f9027_21(int x) { return x * 21; }
+inline int f9027_22(int x) { return x * 22; }
+inline int f9027_23(int x) { return x * 23; }
+inline int f9027_24(int x) { return x * 24; }
+inline int f9027_25(int x) { return x * 25; }
+inline int f9027_26(int x) { return x * 26; }
+inline int f9027_27(int x) { return x * 27; }
+inline int f9027_28(int x) { return x * 28; }
+inline int f9027_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9031 */
+#include <vector>
+#include "h4099.h"
+#include "h1596.h"
+#include "h3658.h"
+#include "h3012.h"
+#include "h9545.h"
+#ifdef X
+#include "h9663.h"
+#endif
+struct S9031 { int a; const char *s = "x//y"; };
+inline int f9031_0(int x) { return x * 0; }
+inline int f9031_1(int x) { return x * 1; }
+inline int f9031_2(int x) { return x * 2; }
+inline int f9031_3(int x) { return x * 3; }
+inline int f9031_4(int x) { return x * 4; }
+inline int f9031_5(int x) { return x * 5; }
+inline int f9031_6(int x) { return x * 6; }
+inline int f9031_7(int x) { return x * 7; }
+inline int f9031_8(int x) { return x * 8; }
+inline int f9031_9(int x) { return x * 9; }
+inline int f9031_10(int x) { return x * 10; }
+inline int f9031_11(int x) { return x * 11; }
+inline int f9031_12(int x) { return x * 12; }
+inline int f9031_13(int x) { return x * 13; }
+inline int f9031_14(int x) { return x * 14; }
+inline int f9031_15(int x) { return x * 15; }
+inline int f9031_16(int x) { return x * 16; }
+inline int f9031_17(int x) { return x * 17; }
+inline int f9031_18(int x) { return x * 18; }
+inline int f9031_19(int x) { return x * 19; }
+inline int f9031_20(int x) { return x * 20; }
+inline int f9031_21(int x) { return x * 21; }
+inline int f9031_22(int x) { return x * 22; }
+inline int f9031_23(int x) { return x * 23; }
+inline int f9031_24(int x) { return x * 24; }
+inline int f9031_25(int x) { return x * 25; }
+inline int f9031_26(int x) { return x * 26; }
+inline int f9031_27(int x) { return x * 27; }
+inline int f9031_28(int x) { return x * 28; }
+inline int f9031_29(int x) { return x * 29; }
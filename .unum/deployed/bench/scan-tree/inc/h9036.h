@@ -0,0 +1,42 @@
+#pragma once
+/* header 9036 */
+#include <vector>
+#include "h3699.h"
+#include "h6773.h"
+#include "h1365.h"
+#include "h8879.h"
+#include "h2317.h"
+#ifdef X
+#include "h7799.h"
+#endif
+struct S9036 { int a; const char *s = "x//y"; };
+inline int f9036_0(int x) { return x * 0; }
+inline int f9036_1(int x) { return x * 1; }
+inline int f9036_2(int x) { return x * 2; }
+inline int f9036_3(int x) { return x * 3; }
+inline int f9036_4(int x) { return x * 4; }
+inline int f9036_5(int x) { return x * 5; }
+inline int f9036_6(int x) { return x * 6; }
+inline int f9036_7(int x) { return x * 7; }
+inline int f9036_8(int x) { return x * 8; }
+inline int f9036_9(int x) { return x * 9; }
+inline int f9036_10(int x) { return x * 10; }
+inline int f9036_11(int x) { return x * 11; }
+inline int f9036_12(int x) { return x * 12; }
+inline int f9036_13(int x) { return x * 13; }
+inline int f9036_14(int x) { return x * 14; }
+inline int f9036_15(int x) { return x * 15; }
+inline int f9036_16(int x) { return x * 16; }
+inline int f9036_17(int x) { return x * 17; }
+inline int f9036_18(int x) { return x * 18; }
+inline int f9036_19(int x) { return x * 19; }
+inline int f9036_20(int x) { return x * 20; }
+inline int f9036_21(int x) { return x * 21; }
+inline int f9036_22(int x) { return x * 22; }
+inline int f9036_23(int x) { return x * 23; }
+inline int f9036_24(int x) { return x * 24; }
+inline int f9036_25(int x) { return x * 25; }
+inline int f9036_26(int x) { return x * 26; }
+inline int f9036_27(int x) { return x * 27; }
+inline int f9036_28(int x) { return x * 28; }
+inline int f9036_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9039 */
+#include <vector>
+#include "h6757.h"
+#include "h2697.h"
+#include "h6518.h"
+#include "h8603.h"
+#include "h6726.h"
+#ifdef X
+#include "h560.h"
+#endif
+struct S9039 { int a; const char *s = "x//y"; };
+inline int f9039_0(int x) { return x * 0; }
+inline int f9039_1(int x) { return x * 1; }
+inline int f9039_2(int x) { return x * 2; }
+inline int f9039_3(int x) { return x * 3; }
+inline int f9039_4(int x) { return x * 4; }
+inline int f9039_5(int x) { return x * 5; }
+inline int f9039_6(int x) { return x * 6; }
+inline int f9039_7(int x) { return x * 7; }
+inline int f9039_8(int x) { return x * 8; }
+inline int f9039_9(int x) { return x * 9; }
+inline int f9039_10(int x) { return x * 10; }
+inline int f9039_11(int x) { return x * 11; }
+inline int f9039_12(int x) { return x * 12; }
+inline int f9039_13(int x) { return x * 13; }
+inline int f9039_14(int x) { return x * 14; }
+inline int f9039_15(int x) { return x * 15; }
+inline int f9039_16(int x) { return x * 16; }
+inline int f9039_17(int x) { return x * 17; }
+inline int f9039_18(int x) { return x * 18; }
+inline int f9039_19(int x) { return x * 19; }
+inline int f9039_20(int x) { return x * 20; }
+inline int f9039_21(int x) { return x * 21; }
+inline int f9039_22(int x) { return x * 22; }
+inline int f9039_23(int x) { return x * 23; }
+inline int f9039_24(int x) { return x * 24; }
+inline int f9039_25(int x) { return x * 25; }
+inline int f9039_26(int x) { return x * 26; }
+inline int f9039_27(int x) { return x * 27; }
+inline int f9039_28(int x) { return x * 28; }
+inline int f9039_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9040 */
+#include <vector>
+#include "h1823.h"
+#include "h8204.h"
+#include "h2081.h"
+#include "h8805.h"
+#include "h9998.h"
+#ifdef X
+#include "h9244.h"
+#endif
+struct S9040 { int a; const char *s = "x//y"; };
+inline int f9040_0(int x) { return x * 0; }
+inline int f9040_1(int x) { return x * 1; }
+inline int f9040_2(int x) { return x * 2; }
+inline int f9040_3(int x) { return x * 3; }
+inline int f9040_4(int x) { return x * 4; }
+inline int f9040_5(int x) { return x * 5; }
+inline int f9040_6(int x) { return x * 6; }
+inline int f9040_7(int x) { return x * 7; }
+inline int f9040_8(int x) { return x * 8; }
+inline int f9040_9(int x) { return x * 9; }
+inline int f9040_10(int x) { return x * 10; }
+inline int f9040_11(int x) { return x * 11; }
+inline int f9040_12(int x) { return x * 12; }
+inline int f9040_13(int x) { return x * 13; }
+inline int f9040_14(int x) { return x * 14; }
+inline int f9040_15(int x) { return x * 15; }
+inline int f9040_16(int x) { return x * 16; }
+inline int f9040_17(int x) { return x * 17; }
+inline int f9040_18(int x) { return x * 18; }
+inline int f9040_19(int x) { return x * 19; }
+inline int f9040_20(int x) { return x * 20; }
+inline int f9040_21(int x) { return x * 21; }
+inline int f9040_22(int x) { return x * 22; }
+inline int f9040_23(int x) { return x * 23; }
+inline int f9040_24(int x) { return x * 24; }
+inline int f9040_25(int x) { return x * 25; }
+inline int f9040_26(int x) { return x * 26; }
+inline int f9040_27(int x) { return x * 27; }
+inline int f9040_28(int x) { return x * 28; }
+inline int f9040_29(int x) { return x * 29; }
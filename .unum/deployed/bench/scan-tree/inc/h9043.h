@@ -0,0 +1,42 @@
+#pragma once
+/* header 9043 */
+#include <vector>
+#include "h6458.h"
+#include "h1431.h"
+#include "h7054.h"
+#include "h7653.h"
+#include "h2173.h"
+#ifdef X
+#include "h4928.h"
+#endif
+struct S9043 { int a; const char *s = "x//y"; };
+inline int f9043_0(int x) { return x * 0; }
+inline int f9043_1(int x) { return x * 1; }
+inline int f9043_2(int x) { return x * 2; }
+inline int f9043_3(int x) { return x * 3; }
+inline int f9043_4(int x) { return x * 4; }
+inline int f9043_5(int x) { return x * 5; }
+inline int f9043_6(int x) { return x * 6; }
+inline int f9043_7(int x) { return x * 7; }
+inline int f9043_8(int x) { return x * 8; }
+inline int f9043_9(int x) { return x * 9; }
+inline int f9043_10(int x) { return x * 10; }
+inline int f9043_11(int x) { return x * 11; }
+inline int f9043_12(int x) { return x * 12; }
+inline int f9043_13(int x) { return x * 13; }
+inline int f9043_14(int x) { return x * 14; }
+inline int f9043_15(int x) { return x * 15; }
+inline int f9043_16(int x) { return x * 16; }
+inline int f9043_17(int x) { return x * 17; }
+inline int f9043_18(int x) { return x * 18; }
+inline int f9043_19(int x) { return x * 19; }
+inline int f9043_20(int x) { return x * 20; }
+inline int f9043_21(int x) { return x * 21; }
+inline int f9043_22(int x) { return x * 22; }
+inline int f9043_23(int x) { return x * 23; }
+inline int f9043_24(int x) { return x * 24; }
+inline int f9043_25(int x) { return x * 25; }
+inline int f9043_26(int x) { return x * 26; }
+inline int f9043_27(int x) { return x * 27; }
+inline int f9043_28(int x) { return x * 28; }
+inline int f9043_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9045 */
+#include <vector>
+#include "h7571.h"
+#include "h7442.h"
+#include "h5635.h"
+#include "h636.h"
+#include "h8576.h"
+#ifdef X
+#include "h6488.h"
+#endif
+struct S9045 { int a; const char *s = "x//y"; };
+inline int f9045_0(int x) { return x * 0; }
+inline int f9045_1(int x) { return x * 1; }
+inline int f9045_2(int x) { return x * 2; }
+inline int f9045_3(int x) { return x * 3; }
+inline int f9045_4(int x) { return x * 4; }
+inline int f9045_5(int x) { return x * 5; }
+inline int f9045_6(int x) { return x * 6; }
+inline int f9045_7(int x) { return x * 7; }
+inline int f9045_8(int x) { return x * 8; }
+inline int f9045_9(int x) { return x * 9; }
+inline int f9045_10(int x) { return x * 10; }
+inline int f9045_11(int x) { return x * 11; }
+inline int f9045_12(int x) { return x * 12; }
+inline int f9045_13(int x) { return x * 13; }
+inline int f9045_14(int x) { return x * 14; }
+inline int f9045_15(int x) { return x * 15; }
+inline int f9045_16(int x) { return x * 16; }
+inline int f9045_17(int x) { return x * 17; }
+inline int f9045_18(int x) { return x * 18; }
+inline int f9045_19(int x) { return x * 19; }
+inline int f9045_20(int x) { return x * 20; }
+inline int f9045_21(int x) { return x * 21; }
+inline int f9045_22(int x) { return x * 22; }
+inline int f9045_23(int x) { return x * 23; }
+inline int f9045_24(int x) { return x * 24; }
+inline int f9045_25(int x) { return x * 25; }
+inline int f9045_26(int x) { return x * 26; }
+inline int f9045_27(int x) { return x * 27; }
+inline int f9045_28(int x) { return x * 28; }
+inline int f9045_29(int x) { return x * 29; }
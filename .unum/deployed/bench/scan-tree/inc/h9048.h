@@ -0,0 +1,42 @@
+#pragma once
+/* header 9048 */
+#include <vector>
+#include "h4496.h"
+#include "h6160.h"
+#include "h6584.h"
+#include "h2924.h"
+#include "h8575.h"
+#ifdef X
+#include "h314.h"
+#endif
+struct S9048 { int a; const char *s = "x//y"; };
+inline int f9048_0(int x) { return x * 0; }
+inline int f9048_1(int x) { return x * 1; }
+inline int f9048_2(int x) { return x * 2; }
+inline int f9048_3(int x) { return x * 3; }
+inline int f9048_4(int x) { return x * 4; }
+inline int f9048_5(int x) { return x * 5; }
+inline int f9048_6(int x) { return x * 6; }
+inline int f9048_7(int x) { return x * 7; }
+inline int f9048_8(int x) { return x * 8; }
+inline int f9048_9(int x) { return x * 9; }
+inline int f9048_10(int x) { return x * 10; }
+inline int f9048_11(int x) { return x * 11; }
+inline int f9048_12(int x) { return x * 12; }
+inline int f9048_13(int x) { return x * 13; }
+inline int f9048_14(int x) { return x * 14; }
+inline int f9048_15(int x) { return x * 15; }
+inline int f9048_16(int x) { return x * 16; }
+inline int f9048_17(int x) { return x * 17; }
+inline int f9048_18(int x) { return x * 18; }
+inline int f9048_19(int x) { return x * 19; }
+inline int f9048_20(int x) { return x * 20; }
+inline int f9048_21(int x) { return x * 21; }
+inline int f9048_22(int x) { return x * 22; }
+inline int f9048_23(int x) { return x * 23; }
+inline int f9048_24(int x) { return x * 24; }
+inline int f9048_25(int x) { return x * 25; }
+inline int f9048_26(int x) { return x * 26; }
+inline int f9048_27(int x) { return x * 27; }
+inline int f9048_28(int x) { return x * 28; }
+inline int f9048_29(int x) { return x * 29; }
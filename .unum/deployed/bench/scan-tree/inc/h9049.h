@@ -0,0 +1,42 @@
+#pragma once
+/* header 9049 */
+#include <vector>
+#include "h932.h"
+#include "h1079.h"
+#include "h501.h"
+#include "h6266.h"
+#include "h8309.h"
+#ifdef X
+#include "h3474.h"
+#endif
+struct S9049 { int a; const char *s = "x//y"; };
+inline int f9049_0(int x) { return x * 0; }
+inline int f9049_1(int x) { return x * 1; }
+inline int f9049_2(int x) { return x * 2; }
+inline int f9049_3(int x) { return x * 3; }
+inline int f9049_4(int x) { return x * 4; }
+inline int f9049_5(int x) { return x * 5; }
+inline int f9049_6(int x) { return x * 6; }
+inline int f9049_7(int x) { return x * 7; }
+inline int f9049_8(int x) { return x * 8; }
+inline int f9049_9(int x) { return x * 9; }
+inline int f9049_10(int x) { return x * 10; }
+inline int f9049_11(int x) { return x * 11; }
+inline int f9049_12(int x) { return x * 12; }
+inline int f9049_13(int x) { return x * 13; }
+inline int f9049_14(int x) { return x * 14; }
+inline int f9049_15(int x) { return x * 15; }
+inline int f9049_16(int x) { return x * 16; }
+inline int f9049_17(int x) { return x * 17; }
+inline int f9049_18(int x) { return x * 18; }
+inline int f9049_19(int x) { return x * 19; }
+inline int f9049_20(int x) { return x * 20; }
+inline int f9049_21(int x) { return x * 21; }
+inline int f9049_22(int x) { return x * 22; }
+inline int f9049_23(int x) { return x * 23; }
+inline int f9049_24(int x) { return x * 24; }
+inline int f9049_25(int x) { return x * 25; }
+inline int f9049_26(int x) { return x * 26; }
+inline int f9049_27(int x) { return x * 27; }
+inline int f9049_28(int x) { return x * 28; }
+inline int f9049_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 905 */
+#include <vector>
+#include "h4889.h"
+#include "h5844.h"
+#include "h1059.h"
+#include "h7548.h"
+#include "h7347.h"
+#ifdef X
+#include "h7502.h"
+#endif
+struct S905 { int a; const char *s = "x//y"; };
+inline int f905_0(int x) { return x * 0; }
+inline int f905_1(int x) { return x * 1; }
+inline int f905_2(int x) { return x * 2; }
+inline int f905_3(int x) { return x * 3; }
+inline int f905_4(int x) { return x * 4; }
+inline int f905_5(int x) { return x * 5; }
+inline int f905_6(int x) { return x * 6; }
+inline int f905_7(int x) { return x * 7; }
+inline int f905_8(int x) { return x * 8; }
+inline int f905_9(int x) { return x * 9; }
+inline int f905_10(int x) { return x * 10; }
+inline int f905_11(int x) { return x * 11; }
+inline int f905_12(int x) { return x * 12; }
+inline int f905_13(int x) { return x * 13; }
+inline int f905_14(int x) { return x * 14; }
+inline int f905_15(int x) { return x * 15; }
+inline int f905_16(int x) { return x * 16; }
+inline int f905_17(int x) { return x * 17; }
+inline int f905_18(int x) { return x * 18; }
+inline int f905_19(int x) { return x * 19; }
+inline int f905_20(int x) { return x * 20; }
+inline int f905_21(int x) { return x * 21; }
+inline int f905_22(int x) { return x * 22; }
+inline int f905_23(int x) { return x * 23; }
+inline int f905_24(int x) { return x * 24; }
+inline int f905_25(int x) { return x * 25; }
+inline int f905_26(int x) { return x * 26; }
+inline int f905_27(int x) { return x * 27; }
+inline int f905_28(int x) { return x * 28; }
+inline int f905_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9050 */
+#include <vector>
+#include "h6936.h"
+#include "h4646.h"
+#include "h3610.h"
+#include "h9055.h"
+#include "h389.h"
+#ifdef X
+#include "h2933.h"
+#endif
+struct S9050 { int a; const char *s = "x//y"; };
+inline int f9050_0(int x) { return x * 0; }
+inline int f9050_1(int x) { return x * 1; }
+inline int f9050_2(int x) { return x * 2; }
+inline int f9050_3(int x) { return x * 3; }
+inline int f9050_4(int x) { return x * 4; }
+inline int f9050_5(int x) { return x * 5; }
+inline int f9050_6(int x) { return x * 6; }
+inline int f9050_7(int x) { return x * 7; }
+inline int f9050_8(int x) { return x * 8; }
+inline int f9050_9(int x) { return x * 9; }
+inline int f9050_10(int x) { return x * 10; }
+inline int f9050_11(int x) { return x * 11; }
+inline int f9050_12(int x) { return x * 12; }
+inline int f9050_13(int x) { return x * 13; }
+inline int f9050_14(int x) { return x * 14; }
+inline int f9050_15(int x) { return x * 15; }
+inline int f9050_16(int x) { return x * 16; }
+inline int f9050_17(int x) { return x * 17; }
+inline int f9050_18(int x) { return x * 18; }
+inline int f9050_19(int x) { return x * 19; }
+inline int f9050_20(int x) { return x * 20; }
+inline int f9050_21(int x) { return x * 21; }
+inline int f9050_22(int x) { return x * 22; }
+inline int f9050_23(int x) { return x * 23; }
+inline int f9050_24(int x) { return x * 24; }
+inline int f9050_25(int x) { return x * 25; }
+inline int f9050_26(int x) { return x * 26; }
+inline int f9050_27(int x) { return x * 27; }
+inline int f9050_28(int x) { return x * 28; }
+inline int f9050_29(int x) { return x * 29; }
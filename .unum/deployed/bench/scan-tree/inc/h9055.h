@@ -0,0 +1,42 @@
+#pragma once
+/* header 9055 */
+#include <vector>
+#include "h184.h"
+#include "h3067.h"
+#include "h5305.h"
+#include "h9127.h"
+#include "h9040.h"
+#ifdef X
+#include "h3852.h"
+#endif
+struct S9055 { int a; const char *s = "x//y"; };
+inline int f9055_0(int x) { return x * 0; }
+inline int f9055_1(int x) { return x * 1; }
+inline int f9055_2(int x) { return x * 2; }
+inline int f9055_3(int x) { return x * 3; }
+inline int f9055_4(int x) { return x * 4; }
+inline int f9055_5(int x) { return x * 5; }
+inline int f9055_6(int x) { return x * 6; }
+inline int f9055_7(int x) { return x * 7; }
+inline int f9055_8(int x) { return x * 8; }
+inline int f9055_9(int x) { return x * 9; }
+inline int f9055_10(int x) { return x * 10; }
+inline int f9055_11(int x) { return x * 11; }
+inline int f9055_12(int x) { return x * 12; }
+inline int f9055_13(int x) { return x * 13; }
+inline int f9055_14(int x) { return x * 14; }
+inline int f9055_15(int x) { return x * 15; }
+inline int f9055_16(int x) { return x * 16; }
+inline int f9055_17(int x) { return x * 17; }
+inline int f9055_18(int x) { return x * 18; }
+inline int f9055_19(int x) { return x * 19; }
+inline int f9055_20(int x) { return x * 20; }
+inline int f9055_21(int x) { return x * 21; }
+inline int f9055_22(int x) { return x * 22; }
+inline int f9055_23(int x) { return x * 23; }
+inline int f9055_24(int x) { return x * 24; }
+inline int f9055_25(int x) { return x * 25; }
+inline int f9055_26(int x) { return x * 26; }
+inline int f9055_27(int x) { return x * 27; }
+inline int f9055_28(int x) { return x * 28; }
+inline int f9055_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9056 */
+#include <vector>
+#include "h9541.h"
+#include "h845.h"
+#include "h66.h"
+#include "h4460.h"
+#include "h5278.h"
+#ifdef X
+#include "h8718.h"
+#endif
+struct S9056 { int a; const char *s = "x//y"; };
+inline int f9056_0(int x) { return x * 0; }
+inline int f9056_1(int x) { return x * 1; }
+inline int f9056_2(int x) { return x * 2; }
+inline int f9056_3(int x) { return x * 3; }
+inline int f9056_4(int x) { return x * 4; }
+inline int f9056_5(int x) { return x * 5; }
+inline int f9056_6(int x) { return x * 6; }
+inline int f9056_7(int x) { return x * 7; }
+inline int f9056_8(int x) { return x * 8; }
+inline int f9056_9(int x) { return x * 9; }
+inline int f9056_10(int x) { return x * 10; }
+inline int f9056_11(int x) { return x * 11; }
+inline int f9056_12(int x) { return x * 12; }
+inline int f9056_13(int x) { return x * 13; }
+inline int f9056_14(int x) { return x * 14; }
+inline int f9056_15(int x) { return x * 15; }
+inline int f9056_16(int x) { return x * 16; }
+inline int f9056_17(int x) { return x * 17; }
+inline int f9056_18(int x) { return x * 18; }
+inline int f9056_19(int x) { return x * 19; }
+inline int f9056_20(int x) { return x * 20; }
+inline int f9056_21(int x) { return x * 21; }
+inline int f9056_22(int x) { return x * 22; }
+inline int f9056_23(int x) { return x * 23; }
+inline int f9056_24(int x) { return x * 24; }
+inline int f9056_25(int x) { return x * 25; }
+inline int f9056_26(int x) { return x * 26; }
+inline int f9056_27(int x) { return x * 27; }
+inline int f9056_28(int x) { return x * 28; }
+inline int f9056_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9059 */
+#include <vector>
+#include "h132.h"
+#include "h8284.h"
+#include "h3590.h"
+#include "h9799.h"
+#include "h7027.h"
+#ifdef X
+#include "h7021.h"
+#endif
+struct S9059 { int a; const char *s = "x//y"; };
+inline int f9059_0(int x) { return x * 0; }
+inline int f9059_1(int x) { return x * 1; }
+inline int f9059_2(int x) { return x * 2; }
+inline int f9059_3(int x) { return x * 3; }
+inline int f9059_4(int x) { return x * 4; }
+inline int f9059_5(int x) { return x * 5; }
+inline int f9059_6(int x) { return x * 6; }
+inline int f9059_7(int x) { return x * 7; }
+inline int f9059_8(int x) { return x * 8; }
+inline int f9059_9(int x) { return x * 9; }
+inline int f9059_10(int x) { return x * 10; }
+inline int f9059_11(int x) { return x * 11; }
+inline int f9059_12(int x) { return x * 12; }
+inline int f9059_13(int x) { return x * 13; }
+inline int f9059_14(int x) { return x * 14; }
+inline int f9059_15(int x) { return x * 15; }
+inline int f9059_16(int x) { return x * 16; }
+inline int f9059_17(int x) { return x * 17; }
+inline int f9059_18(int x) { return x * 18; }
+inline int f9059_19(int x) { return x * 19; }
+inline int f9059_20(int x) { return x * 20; }
+inline int f9059_21(int x) { return x * 21; }
+inline int f9059_22(int x) { return x * 22; }
+inline int f9059_23(int x) { return x * 23; }
+inline int f9059_24(int x) { return x * 24; }
+inline int f9059_25(int x) { return x * 25; }
+inline int f9059_26(int x) { return x * 26; }
+inline int f9059_27(int x) { return x * 27; }
+inline int f9059_28(int x) { return x * 28; }
+inline int f9059_29(int x) { return x * 29; }
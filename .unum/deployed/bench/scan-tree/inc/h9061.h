@@ -0,0 +1,42 @@
+#pragma once
+/* header 9061 */
+#include <vector>
+#include "h7323.h"
+#include "h9210.h"
+#include "h5811.h"
+#include "h4085.h"
+#include "h4398.h"
+#ifdef X
+#include "h690.h"
+#endif
+struct S9061 { int a; const char *s = "x//y"; };
+inline int f9061_0(int x) { return x * 0; }
+inline int f9061_1(int x) { return x * 1; }
+inline int f9061_2(int x) { return x * 2; }
+inline int f9061_3(int x) { return x * 3; }
+inline int f9061_4(int x) { return x * 4; }
+inline int f9061_5(int x) { return x * 5; }
+inline int f9061_6(int x) { return x * 6; }
+inline int f9061_7(int x) { return x * 7; }
+inline int f9061_8(int x) { return x * 8; }
+inline int f9061_9(int x) { return x * 9; }
+inline int f9061_10(int x) { return x * 10; }
+inline int f9061_11(int x) { return x * 11; }
+inline int f9061_12(int x) { return x * 12; }
+inline int f9061_13(int x) { return x * 13; }
+inline int f9061_14(int x) { return x * 14; }
+inline int f9061_15(int x) { return x * 15; }
+inline int f9061_16(int x) { return x * 16; }
+inline int f9061_17(int x) { return x * 17; }
+inline int f9061_18(int x) { return x * 18; }
+inline int f9061_19(int x) { return x * 19; }
+inline int f9061_20(int x) { return x * 20; }
+inline int f9061_21(int x) { return x * 21; }
+inline int f9061_22(int x) { return x * 22; }
+inline int f9061_23(int x) { return x * 23; }
+inline int f9061_24(int x) { return x * 24; }
+inline int f9061_25(int x) { return x * 25; }
+inline int f9061_26(int x) { return x * 26; }
+inline int f9061_27(int x) { return x * 27; }
+inline int f9061_28(int x) { return x * 28; }
+inline int f9061_29(int x) { return x * 29; }
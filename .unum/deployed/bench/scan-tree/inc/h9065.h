@@ -0,0 +1,42 @@
+#pragma once
+/* header 9065 */
+#include <vector>
+#include "h1951.h"
+#include "h8551.h"
+#include "h3042.h"
+#include "h4925.h"
+#include "h7641.h"
+#ifdef X
+#include "h9379.h"
+#endif
+struct S9065 { int a; const char *s = "x//y"; };
+inline int f9065_0(int x) { return x * 0; }
+inline int f9065_1(int x) { return x * 1; }
+inline int f9065_2(int x) { return x * 2; }
+inline int f9065_3(int x) { return x * 3; }
+inline int f9065_4(int x) { return x * 4; }
+inline int f9065_5(int x) { return x * 5; }
+inline int f9065_6(int x) { return x * 6; }
+inline int f9065_7(int x) { return x * 7; }
+inline int f9065_8(int x) { return x * 8; }
+inline int f9065_9(int x) { return x * 9; }
+inline int f9065_10(int x) { return x * 10; }
+inline int f9065_11(int x) { return x * 11; }
+inline int f9065_12(int x) { return x * 12; }
+inline int f9065_13(int x) { return x * 13; }
+inline int f9065_14(int x) { return x * 14; }
+inline int f9065_15(int x) { return x * 15; }
+inline int f9065_16(int x) { return x * 16; }
+inline int f9065_17(int x) { return x * 17; }
+inline int f9065_18(int x) { return x * 18; }
+inline int f9065_19(int x) { return x * 19; }
+inline int f9065_20(int x) { return x * 20; }
+inline int f9065_21(int x) { return x * 21; }
+inline int f9065_22(int x) { return x * 22; }
+inline int f9065_23(int x) { return x * 23; }
+inline int f9065_24(int x) { return x * 24; }
+inline int f9065_25(int x) { return x * 25; }
+inline int f9065_26(int x) { return x * 26; }
+inline int f9065_27(int x) { return x * 27; }
+inline int f9065_28(int x) { return x * 28; }
+inline int f9065_29(int x) { return x * 29; }
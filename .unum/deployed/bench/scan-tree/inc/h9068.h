@@ -0,0 +1,42 @@
+#pragma once
+/* header 9068 */
+#include <vector>
+#include "h7546.h"
+#include "h8975.h"
+#include "h2806.h"
+#include "h2629.h"
+#include "h3707.h"
+#ifdef X
+#include "h6277.h"
+#endif
+struct S9068 { int a; const char *s = "x//y"; };
+inline int f9068_0(int x) { return x * 0; }
+inline int f9068_1(int x) { return x * 1; }
+inline int f9068_2(int x) { return x * 2; }
+inline int f9068_3(int x) { return x * 3; }
+inline int f9068_4(int x) { return x * 4; }
+inline int f9068_5(int x) { return x * 5; }
+inline int f9068_6(int x) { return x * 6; }
+inline int f9068_7(int x) { return x * 7; }
+inline int f9068_8(int x) { return x * 8; }
+inline int f9068_9(int x) { return x * 9; }
+inline int f9068_10(int x) { return x * 10; }
+inline int f9068_11(int x) { return x * 11; }
+inline int f9068_12(int x) { return x * 12; }
+inline int f9068_13(int x) { return x * 13; }
+inline int f9068_14(int x) { return x * 14; }
+inline int f9068_15(int x) { return x * 15; }
+inline int f9068_16(int x) { return x * 16; }
+inline int f9068_17(int x) { return x * 17; }
+inline int f9068_18(int x) { return x * 18; }
+inline int f9068_19(int x) { return x * 19; }
+inline int f9068_20(int x) { return x * 20; }
+inline int f9068_21(int x) { return x * 21; }
+inline int f9068_22(int x) { return x * 22; }
+inline int f9068_23(int x) { return x * 23; }
+inline int f9068_24(int x) { return x * 24; }
+inline int f9068_25(int x) { return x * 25; }
+inline int f9068_26(int x) { return x * 26; }
+inline int f9068_27(int x) { return x * 27; }
+inline int f9068_28(int x) { return x * 28; }
+inline int f9068_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9072 */
+#include <vector>
+#include "h3420.h"
+#include "h7848.h"
+#include "h9855.h"
+#include "h5276.h"
+#include "h3361.h"
+#ifdef X
+#include "h3022.h"
+#endif
+struct S9072 { int a; const char *s = "x//y"; };
+inline int f9072_0(int x) { return x * 0; }
+inline int f9072_1(int x) { return x * 1; }
+inline int f9072_2(int x) { return x * 2; }
+inline int f9072_3(int x) { return x * 3; }
+inline int f9072_4(int x) { return x * 4; }
+inline int f9072_5(int x) { return x * 5; }
+inline int f9072_6(int x) { return x * 6; }
+inline int f9072_7(int x) { return x * 7; }
+inline int f9072_8(int x) { return x * 8; }
+inline int f9072_9(int x) { return x * 9; }
+inline int f9072_10(int x) { return x * 10; }
+inline int f9072_11(int x) { return x * 11; }
+inline int f9072_12(int x) { return x * 12; }
+inline int f9072_13(int x) { return x * 13; }
+inline int f9072_14(int x) { return x * 14; }
+inline int f9072_15(int x) { return x * 15; }
+inline int f9072_16(int x) { return x * 16; }
+inline int f9072_17(int x) { return x * 17; }
+inline int f9072_18(int x) { return x * 18; }
+inline int f9072_19(int x) { return x * 19; }
+inline int f9072_20(int x) { return x * 20; }
+inline int f9072_21(int x) { return x * 21; }
+inline int f9072_22(int x) { return x * 22; }
+inline int f9072_23(int x) { return x * 23; }
+inline int f9072_24(int x) { return x * 24; }
+inline int f9072_25(int x) { return x * 25; }
+inline int f9072_26(int x) { return x * 26; }
+inline int f9072_27(int x) { return x * 27; }
+inline int f9072_28(int x) { return x * 28; }
+inline int f9072_29(int x) { return x * 29; }
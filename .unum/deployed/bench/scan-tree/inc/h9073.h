@@ -0,0 +1,42 @@
+#pragma once
+/* header 9073 */
+#include <vector>
+#include "h2346.h"
+#include "h6037.h"
+#include "h1919.h"
+#include "h5789.h"
+#include "h7794.h"
+#ifdef X
+#include "h7084.h"
+#endif
+struct S9073 { int a; const char *s = "x//y"; };
+inline int f9073_0(int x) { return x * 0; }
+inline int f9073_1(int x) { return x * 1; }
+inline int f9073_2(int x) { return x * 2; }
+inline int f9073_3(int x) { return x * 3; }
+inline int f9073_4(int x) { return x * 4; }
+inline int f9073_5(int x) { return x * 5; }
+inline int f9073_6(int x) { return x * 6; }
+inline int f9073_7(int x) { return x * 7; }
+inline int f9073_8(int x) { return x * 8; }
+inline int f9073_9(int x) { return x * 9; }
+inline int f9073_10(int x) { return x * 10; }
+inline int f9073_11(int x) { return x * 11; }
+inline int f9073_12(int x) { return x * 12; }
+inline int f9073_13(int x) { return x * 13; }
+inline int f9073_14(int x) { return x * 14; }
+inline int f9073_15(int x) { return x * 15; }
+inline int f9073_16(int x) { return x * 16; }
+inline int f9073_17(int x) { return x * 17; }
+inline int f9073_18(int x) { return x * 18; }
+inline int f9073_19(int x) { return x * 19; }
+inline int f9073_20(int x) { return x * 20; }
+inline int f9073_21(int x) { return x * 21; }
+inline int f9073_22(int x) { return x * 22; }
+inline int f9073_23(int x) { return x * 23; }
+inline int f9073_24(int x) { return x * 24; }
+inline int f9073_25(int x) { return x * 25; }
+inline int f9073_26(int x) { return x * 26; }
+inline int f9073_27(int x) { return x * 27; }
+inline int f9073_28(int x) { return x * 28; }
+inline int f9073_29(int x) { return x * 29; }
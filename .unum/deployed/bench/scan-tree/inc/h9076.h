@@ -0,0 +1,42 @@
+#pragma once
+/* header 9076 */
+#include <vector>
+#include "h5574.h"
+#include "h1226.h"
+#include "h7829.h"
+#include "h1141.h"
+#include "h8171.h"
+#ifdef X
+#include "h5459.h"
+#endif
+struct S9076 { int a; const char *s = "x//y"; };
+inline int f9076_0(int x) { return x * 0; }
+inline int f9076_1(int x) { return x * 1; }
+inline int f9076_2(int x) { return x * 2; }
+inline int f9076_3(int x) { return x * 3; }
+inline int f9076_4(int x) { return x * 4; }
+inline int f9076_5(int x) { return x * 5; }
+inline int f9076_6(int x) { return x * 6; }
+inline int f9076_7(int x) { return x * 7; }
+inline int f9076_8(int x) { return x * 8; }
+inline int f9076_9(int x) { return x * 9; }
+inline int f9076_10(int x) { return x * 10; }
+inline int f9076_11(int x) { return x * 11; }
+inline int f9076_12(int x) { return x * 12; }
+inline int f9076_13(int x) { return x * 13; }
+inline int f9076_14(int x) { return x * 14; }
+inline int f9076_15(int x) { return x * 15; }
+inline int f9076_16(int x) { return x * 16; }
+inline int f9076_17(int x) { return x * 17; }
+inline int f9076_18(int x) { return x * 18; }
+inline int f9076_19(int x) { return x * 19; }
+inline int f9076_20(int x) { return x * 20; }
+inline int f9076_21(int x) { return x * 21; }
+inline int f9076_22(int x) { return x * 22; }
+inline int f9076_23(int x) { return x * 23; }
+inline int f9076_24(int x) { return x * 24; }
+inline int f9076_25(int x) { return x * 25; }
+inline int f9076_26(int x) { return x * 26; }
+inline int f9076_27(int x) { return x * 27; }
+inline int f9076_28(int x) { return x * 28; }
+inline int f9076_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9077 */
+#include <vector>
+#include "h9013.h"
+#include "h2298.h"
+#include "h2095.h"
+#include "h3140.h"
+#include "h4152.h"
+#ifdef X
+#include "h3773.h"
+#endif
+struct S9077 { int a; const char *s = "x//y"; };
+inline int f9077_0(int x) { return x * 0; }
+inline int f9077_1(int x) { return x * 1; }
+inline int f9077_2(int x) { return x * 2; }
+inline int f9077_3(int x) { return x * 3; }
+inline int f9077_4(int x) { return x * 4; }
+inline int f9077_5(int x) { return x * 5; }
+inline int f9077_6(int x) { return x * 6; }
+inline int f9077_7(int x) { return x * 7; }
+inline int f9077_8(int x) { return x * 8; }
+inline int f9077_9(int x) { return x * 9; }
+inline int f9077_10(int x) { return x * 10; }
+inline int f9077_11(int x) { return x * 11; }
+inline int f9077_12(int x) { return x * 12; }
+inline int f9077_13(int x) { return x * 13; }
+inline int f9077_14(int x) { return x * 14; }
+inline int f9077_15(int x) { return x * 15; }
+inline int f9077_16(int x) { return x * 16; }
+inline int f9077_17(int x) { return x * 17; }
+inline int f9077_18(int x) { return x * 18; }
+inline int f9077_19(int x) { return x * 19; }
+inline int f9077_20(int x) { return x * 20; }
+inline int f9077_21(int x) { return x * 21; }
+inline int f9077_22(int x) { return x * 22; }
+inline int f9077_23(int x) { return x * 23; }
+inline int f9077_24(int x) { return x * 24; }
+inline int f9077_25(int x) { return x * 25; }
+inline int f9077_26(int x) { return x * 26; }
+inline int f9077_27(int x) { return x * 27; }
+inline int f9077_28(int x) { return x * 28; }
+inline int f9077_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9078 */
+#include <vector>
+#include "h702.h"
+#include "h5645.h"
+#include "h4551.h"
+#include "h3531.h"
+#include "h6515.h"
+#ifdef X
+#include "h7747.h"
+#endif
+struct S9078 { int a; const char *s = "x//y"; };
+inline int f9078_0(int x) { return x * 0; }
+inline int f9078_1(int x) { return x * 1; }
+inline int f9078_2(int x) { return x * 2; }
+inline int f9078_3(int x) { return x * 3; }
+inline int f9078_4(int x) { return x * 4; }
+inline int f9078_5(int x) { return x * 5; }
+inline int f9078_6(int x) { return x * 6; }
+inline int f9078_7(int x) { return x * 7; }
+inline int f9078_8(int x) { return x * 8; }
+inline int f9078_9(int x) { return x * 9; }
+inline int f9078_10(int x) { return x * 10; }
+inline int f9078_11(int x) { return x * 11; }
+inline int f9078_12(int x) { return x * 12; }
+inline int f9078_13(int x) { return x * 13; }
+inline int f9078_14(int x) { return x * 14; }
+inline int f9078_15(int x) { return x * 15; }
+inline int f9078_16(int x) { return x * 16; }
+inline int f9078_17(int x) { return x * 17; }
+inline int f9078_18(int x) { return x * 18; }
+inline int f9078_19(int x) { return x * 19; }
+inline int f9078_20(int x) { return x * 20; }
+inline int f9078_21(int x) { return x * 21; }
+inline int f9078_22(int x) { return x * 22; }
+inline int f9078_23(int x) { return x * 23; }
+inline int f9078_24(int x) { return x * 24; }
+inline int f9078_25(int x) { return x * 25; }
+inline int f9078_26(int x) { return x * 26; }
+inline int f9078_27(int x) { return x * 27; }
+inline int f9078_28(int x) { return x * 28; }
+inline int f9078_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9079 */
+#include <vector>
+#include "h3726.h"
+#include "h9087.h"
+#include "h5814.h"
+#include "h7509.h"
+#include "h3028.h"
+#ifdef X
+#include "h556.h"
+#endif
+struct S9079 { int a; const char *s = "x//y"; };
+inline int f9079_0(int x) { return x * 0; }
+inline int f9079_1(int x) { return x * 1; }
+inline int f9079_2(int x) { return x * 2; }
+inline int f9079_3(int x) { return x * 3; }
+inline int f9079_4(int x) { return x * 4; }
+inline int f9079_5(int x) { return x * 5; }
+inline int f9079_6(int x) { return x * 6; }
+inline int f9079_7(int x) { return x * 7; }
+inline int f9079_8(int x) { return x * 8; }
+inline int f9079_9(int x) { return x * 9; }
+inline int f9079_10(int x) { return x * 10; }
+inline int f9079_11(int x) { return x * 11; }
+inline int f9079_12(int x) { return x * 12; }
+inline int f9079_13(int x) { return x * 13; }
+inline int f9079_14(int x) { return x * 14; }
+inline int f9079_15(int x) { return x * 15; }
+inline int f9079_16(int x) { return x * 16; }
+inline int f9079_17(int x) { return x * 17; }
+inline int f9079_18(int x) { return x * 18; }
+inline int f9079_19(int x) { return x * 19; }
+inline int f9079_20(int x) { return x * 20; }
+inline int f9079_21(int x) { return x * 21; }
+inline int f9079_22(int x) { return x * 22; }
+inline int f9079_23(int x) { return x * 23; }
+inline int f9079_24(int x) { return x * 24; }
+inline int f9079_25(int x) { return x * 25; }
+inline int f9079_26(int x) { return x * 26; }
+inline int f9079_27(int x) { return x * 27; }
+inline int f9079_28(int x) { return x * 28; }
+inline int f9079_29(int x) { return x * 29; }
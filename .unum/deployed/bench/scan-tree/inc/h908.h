@@ -0,0 +1,42 @@
+#pragma once
+/* header 908 */
+#include <vector>
+#include "h5316.h"
+#include "h7799.h"
+#include "h1347.h"
+#include "h3247.h"
+#include "h2521.h"
+#ifdef X
+#include "h3555.h"
+#endif
+struct S908 { int a; const char *s = "x//y"; };
+inline int f908_0(int x) { return x * 0; }
+inline int f908_1(int x) { return x * 1; }
+inline int f908_2(int x) { return x * 2; }
+inline int f908_3(int x) { return x * 3; }
+inline int f908_4(int x) { return x * 4; }
+inline int f908_5(int x) { return x * 5; }
+inline int f908_6(int x) { return x * 6; }
+inline int f908_7(int x) { return x * 7; }
+inline int f908_8(int x) { return x * 8; }
+inline int f908_9(int x) { return x * 9; }
+inline int f908_10(int x) { return x * 10; }
+inline int f908_11(int x) { return x * 11; }
+inline int f908_12(int x) { return x * 12; }
+inline int f908_13(int x) { return x * 13; }
+inline int f908_14(int x) { return x * 14; }
+inline int f908_15(int x) { return x * 15; }
+inline int f908_16(int x) { return x * 16; }
+inline int f908_17(int x) { return x * 17; }
+inline int f908_18(int x) { return x * 18; }
+inline int f908_19(int x) { return x * 19; }
+inline int f908_20(int x) { return x * 20; }
+inline int f908_21(int x) { return x * 21; }
+inline int f908_22(int x) { return x * 22; }
+inline int f908_23(int x) { return x * 23; }
+inline int f908_24(int x) { return x * 24; }
+inline int f908_25(int x) { return x * 25; }
+inline int f908_26(int x) { return x * 26; }
+inline int f908_27(int x) { return x * 27; }
+inline int f908_28(int x) { return x * 28; }
+inline int f908_29(int x) { return x * 29; }
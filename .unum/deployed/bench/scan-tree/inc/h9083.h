@@ -0,0 +1,42 @@
+#pragma once
+/* header 9083 */
+#include <vector>
+#include "h48.h"
+#include "h6024.h"
+#include "h299.h"
+#include "h4095.h"
+#include "h6094.h"
+#ifdef X
+#include "h9996.h"
+#endif
+struct S9083 { int a; const char *s = "x//y"; };
+inline int f9083_0(int x) { return x * 0; }
+inline int f9083_1(int x) { return x * 1; }
+inline int f9083_2(int x) { return x * 2; }
+inline int f9083_3(int x) { return x * 3; }
+inline int f9083_4(int x) { return x * 4; }
+inline int f9083_5(int x) { return x * 5; }
+inline int f9083_6(int x) { return x * 6; }
+inline int f9083_7(int x) { return x * 7; }
+inline int f9083_8(int x) { return x * 8; }
+inline int f9083_9(int x) { return x * 9; }
+inline int f9083_10(int x) { return x * 10; }
+inline int f9083_11(int x) { return x * 11; }
+inline int f9083_12(int x) { return x * 12; }
+inline int f9083_13(int x) { return x * 13; }
+inline int f9083_14(int x) { return x * 14; }
+inline int f9083_15(int x) { return x * 15; }
+inline int f9083_16(int x) { return x * 16; }
+inline int f9083_17(int x) { return x * 17; }
+inline int f9083_18(int x) { return x * 18; }
+inline int f9083_19(int x) { return x * 19; }
+inline int f9083_20(int x) { return x * 20; }
+inline int f9083_21(int x) { return x * 21; }
+inline int f9083_22(int x) { return x * 22; }
+inline int f9083_23(int x) { return x * 23; }
+inline int f9083_24(int x) { return x * 24; }
+inline int f9083_25(int x) { return x * 25; }
+inline int f9083_26(int x) { return x * 26; }
+inline int f9083_27(int x) { return x * 27; }
+inline int f9083_28(int x) { return x * 28; }
+inline int f9083_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9088 */
+#include <vector>
+#include "h9147.h"
+#include "h8126.h"
+#include "h4381.h"
+#include "h7229.h"
+#include "h9236.h"
+#ifdef X
+#include "h4291.h"
+#endif
+struct S9088 { int a; const char *s = "x//y"; };
+inline int f9088_0(int x) { return x * 0; }
+inline int f9088_1(int x) { return x * 1; }
+inline int f9088_2(int x) { return x * 2; }
+inline int f9088_3(int x) { return x * 3; }
+inline int f9088_4(int x) { return x * 4; }
+inline int f9088_5(int x) { return x * 5; }
+inline int f9088_6(int x) { return x * 6; }
+inline int f9088_7(int x) { return x * 7; }
+inline int f9088_8(int x) { return x * 8; }
+inline int f9088_9(int x) { return x * 9; }
+inline int f9088_10(int x) { return x * 10; }
+inline int f9088_11(int x) { return x * 11; }
+inline int f9088_12(int x) { return x * 12; }
+inline int f9088_13(int x) { return x * 13; }
+inline int f9088_14(int x) { return x * 14; }
+inline int f9088_15(int x) { return x * 15; }
+inline int f9088_16(int x) { return x * 16; }
+inline int f9088_17(int x) { return x * 17; }
+inline int f9088_18(int x) { return x * 18; }
+inline int f9088_19(int x) { return x * 19; }
+inline int f9088_20(int x) { return x * 20; }
+inline int f9088_21(int x) { return x * 21; }
+inline int f9088_22(int x) { return x * 22; }
+inline int f9088_23(int x) { return x * 23; }
+inline int f9088_24(int x) { return x * 24; }
+inline int f9088_25(int x) { return x * 25; }
+inline int f9088_26(int x) { return x * 26; }
+inline int f9088_27(int x) { return x * 27; }
+inline int f9088_28(int x) { return x * 28; }
+inline int f9088_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9089 */
+#include <vector>
+#include "h6396.h"
+#include "h7271.h"
+#include "h2822.h"
+#include "h6293.h"
+#include "h9305.h"
+#ifdef X
+#include "h3753.h"
+#endif
+struct S9089 { int a; const char *s = "x//y"; };
+inline int f9089_0(int x) { return x * 0; }
+inline int f9089_1(int x) { return x * 1; }
+inline int f9089_2(int x) { return x * 2; }
+inline int f9089_3(int x) { return x * 3; }
+inline int f9089_4(int x) { return x * 4; }
+inline int f9089_5(int x) { return x * 5; }
+inline int f9089_6(int x) { return x * 6; }
+inline int f9089_7(int x) { return x * 7; }
+inline int f9089_8(int x) { return x * 8; }
+inline int f9089_9(int x) { return x * 9; }
+inline int f9089_10(int x) { return x * 10; }
+inline int f9089_11(int x) { return x * 11; }
+inline int f9089_12(int x) { return x * 12; }
+inline int f9089_13(int x) { return x * 13; }
+inline int f9089_14(int x) { return x * 14; }
+inline int f9089_15(int x) { return x * 15; }
+inline int f9089_16(int x) { return x * 16; }
+inline int f9089_17(int x) { return x * 17; }
+inline int f9089_18(int x) { return x * 18; }
+inline int f9089_19(int x) { return x * 19; }
+inline int f9089_20(int x) { return x * 20; }
+inline int f9089_21(int x) { return x * 21; }
+inline int f9089_22(int x) { return x * 22; }
+inline int f9089_23(int x) { return x * 23; }
+inline int f9089_24(int x) { return x * 24; }
+inline int f9089_25(int x) { return x * 25; }
+inline int f9089_26(int x) { return x * 26; }
+inline int f9089_27(int x) { return x * 27; }
+inline int f9089_28(int x) { return x * 28; }
+inline int f9089_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9092 */
+#include <vector>
+#include "h587.h"
+#include "h1966.h"
+#include "h2684.h"
+#include "h8534.h"
+#include "h3667.h"
+#ifdef X
+#include "h8437.h"
+#endif
+struct S9092 { int a; const char *s = "x//y"; };
+inline int f9092_0(int x) { return x * 0; }
+inline int f9092_1(int x) { return x * 1; }
+inline int f9092_2(int x) { return x * 2; }
+inline int f9092_3(int x) { return x * 3; }
+inline int f9092_4(int x) { return x * 4; }
+inline int f9092_5(int x) { return x * 5; }
+inline int f9092_6(int x) { return x * 6; }
+inline int f9092_7(int x) { return x * 7; }
+inline int f9092_8(int x) { return x * 8; }
+inline int f9092_9(int x) { return x * 9; }
+inline int f9092_10(int x) { return x * 10; }
+inline int f9092_11(int x) { return x * 11; }
+inline int f9092_12(int x) { return x * 12; }
+inline int f9092_13(int x) { return x * 13; }
+inline int f9092_14(int x) { return x * 14; }
+inline int f9092_15(int x) { return x * 15; }
+inline int f9092_16(int x) { return x * 16; }
+inline int f9092_17(int x) { return x * 17; }
+inline int f9092_18(int x) { return x * 18; }
+inline int f9092_19(int x) { return x * 19; }
+inline int f9092_20(int x) { return x * 20; }
+inline int f9092_21(int x) { return x * 21; }
+inline int f9092_22(int x) { return x * 22; }
+inline int f9092_23(int x) { return x * 23; }
+inline int f9092_24(int x) { return x * 24; }
+inline int f9092_25(int x) { return x * 25; }
+inline int f9092_26(int x) { return x * 26; }
+inline int f9092_27(int x) { return x * 27; }
+inline int f9092_28(int x) { return x * 28; }
+inline int f9092_29(int x) { return x * 29; }
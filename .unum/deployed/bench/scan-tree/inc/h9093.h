@@ -0,0 +1,42 @@
+#pragma once
+/* header 9093 */
+#include <vector>
+#include "h7023.h"
+#include "h4626.h"
+#include "h2172.h"
+#include "h5130.h"
+#include "h1537.h"
+#ifdef X
+#include "h2611.h"
+#endif
+struct S9093 { int a; const char *s = "x//y"; };
+inline int f9093_0(int x) { return x * 0; }
+inline int f9093_1(int x) { return x * 1; }
+inline int f9093_2(int x) { return x * 2; }
+inline int f9093_3(int x) { return x * 3; }
+inline int f9093_4(int x) { return x * 4; }
+inline int f9093_5(int x) { return x * 5; }
+inline int f9093_6(int x) { return x * 6; }
+inline int f9093_7(int x) { return x * 7; }
+inline int f9093_8(int x) { return x * 8; }
+inline int f9093_9(int x) { return x * 9; }
+inline int f9093_10(int x) { return x * 10; }
+inline int f9093_11(int x) { return x * 11; }
+inline int f9093_12(int x) { return x * 12; }
+inline int f9093_13(int x) { return x * 13; }
+inline int f9093_14(int x) { return x * 14; }
+inline int f9093_15(int x) { return x * 15; }
+inline int f9093_16(int x) { return x * 16; }
+inline int f9093_17(int x) { return x * 17; }
+inline int f9093_18(int x) { return x * 18; }
+inline int f9093_19(int x) { return x * 19; }
+inline int f9093_20(int x) { return x * 20; }
+inline int f9093_21(int x) { return x * 21; }
+inline int f9093_22(int x) { return x * 22; }
+inline int f9093_23(int x) { return x * 23; }
+inline int f9093_24(int x) { return x * 24; }
+inline int f9093_25(int x) { return x * 25; }
+inline int f9093_26(int x) { return x * 26; }
+inline int f9093_27(int x) { return x * 27; }
+inline int f9093_28(int x) { return x * 28; }
+inline int f9093_29(int x) { return x * 29; }
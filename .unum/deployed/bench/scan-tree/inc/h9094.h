@@ -0,0 +1,42 @@
+#pragma once
+/* header 9094 */
+#include <vector>
+#include "h34.h"
+#include "h495.h"
+#include "h8695.h"
+#include "h5921.h"
+#include "h5203.h"
+#ifdef X
+#include "h2395.h"
+#endif
+struct S9094 { int a; const char *s = "x//y"; };
+inline int f9094_0(int x) { return x * 0; }
+inline int f9094_1(int x) { return x * 1; }
+inline int f9094_2(int x) { return x * 2; }
+inline int f9094_3(int x) { return x * 3; }
+inline int f9094_4(int x) { return x * 4; }
+inline int f9094_5(int x) { return x * 5; }
+inline int f9094_6(int x) { return x * 6; }
+inline int f9094_7(int x) { return x * 7; }
+inline int f9094_8(int x) { return x * 8; }
+inline int f9094_9(int x) { return x * 9; }
+inline int f9094_10(int x) { return x * 10; }
+inline int f9094_11(int x) { return x * 11; }
+inline int f9094_12(int x) { return x * 12; }
+inline int f9094_13(int x) { return x * 13; }
+inline int f9094_14(int x) { return x * 14; }
+inline int f9094_15(int x) { return x * 15; }
+inline int f9094_16(int x) { return x * 16; }
+inline int f9094_17(int x) { return x * 17; }
+inline int f9094_18(int x) { return x * 18; }
+inline int f9094_19(int x) { return x * 19; }
+inline int f9094_20(int x) { return x * 20; }
+inline int f9094_21(int x) { return x * 21; }
+inline int f9094_22(int x) { return x * 22; }
+inline int f9094_23(int x) { return x * 23; }
+inline int f9094_24(int x) { return x * 24; }
+inline int f9094_25(int x) { return x * 25; }
+inline int f9094_26(int x) { return x * 26; }
+inline int f9094_27(int x) { return x * 27; }
+inline int f9094_28(int x) { return x * 28; }
+inline int f9094_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9096 */
+#include <vector>
+#include "h2930.h"
+#include "h951.h"
+#include "h8328.h"
+#include "h3069.h"
+#include "h8736.h"
+#ifdef X
+#include "h148.h"
+#endif
+struct S9096 { int a; const char *s = "x//y"; };
+inline int f9096_0(int x) { return x * 0; }
+inline int f9096_1(int x) { return x * 1; }
+inline int f9096_2(int x) { return x * 2; }
+inline int f9096_3(int x) { return x * 3; }
+inline int f9096_4(int x) { return x * 4; }
+inline int f9096_5(int x) { return x * 5; }
+inline int f9096_6(int x) { return x * 6; }
+inline int f9096_7(int x) { return x * 7; }
+inline int f9096_8(int x) { return x * 8; }
+inline int f9096_9(int x) { return x * 9; }
+inline int f9096_10(int x) { return x * 10; }
+inline int f9096_11(int x) { return x * 11; }
+inline int f9096_12(int x) { return x * 12; }
+inline int f9096_13(int x) { return x * 13; }
+inline int f9096_14(int x) { return x * 14; }
+inline int f9096_15(int x) { return x * 15; }
+inline int f9096_16(int x) { return x * 16; }
+inline int f9096_17(int x) { return x * 17; }
+inline int f9096_18(int x) { return x * 18; }
+inline int f9096_19(int x) { return x * 19; }
+inline int f9096_20(int x) { return x * 20; }
+inline int f9096_21(int x) { return x * 21; }
+inline int f9096_22(int x) { return x * 22; }
+inline int f9096_23(int x) { return x * 23; }
+inline int f9096_24(int x) { return x * 24; }
+inline int f9096_25(int x) { return x * 25; }
+inline int f9096_26(int x) { return x * 26; }
+inline int f9096_27(int x) { return x * 27; }
+inline int f9096_28(int x) { return x * 28; }
+inline int f9096_29(int x) { return x * 29; }
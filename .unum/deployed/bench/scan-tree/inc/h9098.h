@@ -0,0 +1,42 @@
+#pragma once
+/* header 9098 */
+#include <vector>
+#include "h3503.h"
+#include "h3304.h"
+#include "h5393.h"
+#include "h2847.h"
+#include "h801.h"
+#ifdef X
+#include "h2325.h"
+#endif
+struct S9098 { int a; const char *s = "x//y"; };
+inline int f9098_0(int x) { return x * 0; }
+inline int f9098_1(int x) { return x * 1; }
+inline int f9098_2(int x) { return x * 2; }
+inline int f9098_3(int x) { return x * 3; }
+inline int f9098_4(int x) { return x * 4; }
+inline int f9098_5(int x) { return x * 5; }
+inline int f9098_6(int x) { return x * 6; }
+inline int f9098_7(int x) { return x * 7; }
+inline int f9098_8(int x) { return x * 8; }
+inline int f9098_9(int x) { return x * 9; }
+inline int f9098_10(int x) { return x * 10; }
+inline int f9098_11(int x) { return x * 11; }
+inline int f9098_12(int x) { return x * 12; }
+inline int f9098_13(int x) { return x * 13; }
+inline int f9098_14(int x) { return x * 14; }
+inline int f9098_15(int x) { return x * 15; }
+inline int f9098_16(int x) { return x * 16; }
+inline int f9098_17(int x) { return x * 17; }
+inline int f9098_18(int x) { return x * 18; }
+inline int f9098_19(int x) { return x * 19; }
+inline int f9098_20(int x) { return x * 20; }
+inline int f9098_21(int x) { return x * 21; }
+inline int f9098_22(int x) { return x * 22; }
+inline int f9098_23(int x) { return x * 23; }
+inline int f9098_24(int x) { return x * 24; }
+inline int f9098_25(int x) { return x * 25; }
+inline int f9098_26(int x) { return x * 26; }
+inline int f9098_27(int x) { return x * 27; }
+inline int f9098_28(int x) { return x * 28; }
+inline int f9098_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 91 */
+#include <vector>
+#include "h7903.h"
+#include "h450.h"
+#include "h3766.h"
+#include "h6013.h"
+#include "h1033.h"
+#ifdef X
+#include "h8897.h"
+#endif
+struct S91 { int a; const char *s = "x//y"; };
+inline int f91_0(int x) { return x * 0; }
+inline int f91_1(int x) { return x * 1; }
+inline int f91_2(int x) { return x * 2; }
+inline int f91_3(int x) { return x * 3; }
+inline int f91_4(int x) { return x * 4; }
+inline int f91_5(int x) { return x * 5; }
+inline int f91_6(int x) { return x * 6; }
+inline int f91_7(int x) { return x * 7; }
+inline int f91_8(int x) { return x * 8; }
+inline int f91_9(int x) { return x * 9; }
+inline int f91_10(int x) { return x * 10; }
+inline int f91_11(int x) { return x * 11; }
+inline int f91_12(int x) { return x * 12; }
+inline int f91_13(int x) { return x * 13; }
+inline int f91_14(int x) { return x * 14; }
+inline int f91_15(int x) { return x * 15; }
+inline int f91_16(int x) { return x * 16; }
+inline int f91_17(int x) { return x * 17; }
+inline int f91_18(int x) { return x * 18; }
+inline int f91_19(int x) { return x * 19; }
+inline int f91_20(int x) { return x * 20; }
+inline int f91_21(int x) { return x * 21; }
+inline int f91_22(int x) { return x * 22; }
+inline int f91_23(int x) { return x * 23; }
+inline int f91_24(int x) { return x * 24; }
+inline int f91_25(int x) { return x * 25; }
+inline int f91_26(int x) { return x * 26; }
+inline int f91_27(int x) { return x * 27; }
+inline int f91_28(int x) { return x * 28; }
+inline int f91_29(int x) { return x * 29; }
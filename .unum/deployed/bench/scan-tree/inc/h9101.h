@@ -0,0 +1,42 @@
+#pragma once
+/* header 9101 */
+#include <vector>
+#include "h9621.h"
+#include "h8654.h"
+#include "h7550.h"
+#include "h1129.h"
+#include "h7380.h"
+#ifdef X
+#include "h9518.h"
+#endif
+struct S9101 { int a; const char *s = "x//y"; };
+inline int f9101_0(int x) { return x * 0; }
+inline int f9101_1(int x) { return x * 1; }
+inline int f9101_2(int x) { return x * 2; }
+inline int f9101_3(int x) { return x * 3; }
+inline int f9101_4(int x) { return x * 4; }
+inline int f9101_5(int x) { return x * 5; }
+inline int f9101_6(int x) { return x * 6; }
+inline int f9101_7(int x) { return x * 7; }
+inline int f9101_8(int x) { return x * 8; }
+inline int f9101_9(int x) { return x * 9; }
+inline int f9101_10(int x) { return x * 10; }
+inline int f9101_11(int x) { return x * 11; }
+inline int f9101_12(int x) { return x * 12; }
+inline int f9101_13(int x) { return x * 13; }
+inline int f9101_14(int x) { return x * 14; }
+inline int f9101_15(int x) { return x * 15; }
+inline int f9101_16(int x) { return x * 16; }
+inline int f9101_17(int x) { return x * 17; }
+inline int f9101_18(int x) { return x * 18; }
+inline int f9101_19(int x) { return x * 19; }
+inline int f9101_20(int x) { return x * 20; }
+inline int f9101_21(int x) { return x * 21; }
+inline int f9101_22(int x) { return x * 22; }
+inline int f9101_23(int x) { return x * 23; }
+inline int f9101_24(int x) { return x * 24; }
+inline int f9101_25(int x) { return x * 25; }
+inline int f9101_26(int x) { return x * 26; }
+inline int f9101_27(int x) { return x * 27; }
+inline int f9101_28(int x) { return x * 28; }
+inline int f9101_29(int x) { return x * 29; }
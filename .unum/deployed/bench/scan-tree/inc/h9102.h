@@ -0,0 +1,42 @@
+#pragma once
+/* header 9102 */
+#include <vector>
+#include "h772.h"
+#include "h7531.h"
+#include "h8356.h"
+#include "h1653.h"
+#include "h5205.h"
+#ifdef X
+#include "h998.h"
+#endif
+struct S9102 { int a; const char *s = "x//y"; };
+inline int f9102_0(int x) { return x * 0; }
+inline int f9102_1(int x) { return x * 1; }
+inline int f9102_2(int x) { return x * 2; }
+inline int f9102_3(int x) { return x * 3; }
+inline int f9102_4(int x) { return x * 4; }
+inline int f9102_5(int x) { return x * 5; }
+inline int f9102_6(int x) { return x * 6; }
+inline int f9102_7(int x) { return x * 7; }
+inline int f9102_8(int x) { return x * 8; }
+inline int f9102_9(int x) { return x * 9; }
+inline int f9102_10(int x) { return x * 10; }
+inline int f9102_11(int x) { return x * 11; }
+inline int f9102_12(int x) { return x * 12; }
+inline int f9102_13(int x) { return x * 13; }
+inline int f9102_14(int x) { return x * 14; }
+inline int f9102_15(int x) { return x * 15; }
+inline int f9102_16(int x) { return x * 16; }
+inline int f9102_17(int x) { return x * 17; }
+inline int f9102_18(int x) { return x * 18; }
+inline int f9102_19(int x) { return x * 19; }
+inline int f9102_20(int x) { return x * 20; }
+inline int f9102_21(int x) { return x * 21; }
+inline int f9102_22(int x) { return x * 22; }
+inline int f9102_23(int x) { return x * 23; }
+inline int f9102_24(int x) { return x * 24; }
+inline int f9102_25(int x) { return x * 25; }
+inline int f9102_26(int x) { return x * 26; }
+inline int f9102_27(int x) { return x * 27; }
+inline int f9102_28(int x) { return x * 28; }
+inline int f9102_29(int x) { return x * 29; }
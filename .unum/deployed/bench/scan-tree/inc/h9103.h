@@ -0,0 +1,42 @@
+#pragma once
+/* header 9103 */
+#include <vector>
+#include "h6277.h"
+#include "h607.h"
+#include "h7629.h"
+#include "h9658.h"
+#include "h5534.h"
+#ifdef X
+#include "h5686.h"
+#endif
+struct S9103 { int a; const char *s = "x//y"; };
+inline int f9103_0(int x) { return x * 0; }
+inline int f9103_1(int x) { return x * 1; }
+inline int f9103_2(int x) { return x * 2; }
+inline int f9103_3(int x) { return x * 3; }
+inline int f9103_4(int x) { return x * 4; }
+inline int f9103_5(int x) { return x * 5; }
+inline int f9103_6(int x) { return x * 6; }
+inline int f9103_7(int x) { return x * 7; }
+inline int f9103_8(int x) { return x * 8; }
+inline int f9103_9(int x) { return x * 9; }
+inline int f9103_10(int x) { return x * 10; }
+inline int f9103_11(int x) { return x * 11; }
+inline int f9103_12(int x) { return x * 12; }
+inline int f9103_13(int x) { return x * 13; }
+inline int f9103_14(int x) { return x * 14; }
+inline int f9103_15(int x) { return x * 15; }
+inline int f9103_16(int x) { return x * 16; }
+inline int f9103_17(int x) { return x * 17; }
+inline int f9103_18(int x) { return x * 18; }
+inline int f9103_19(int x) { return x * 19; }
+inline int f9103_20(int x) { return x * 20; }
+inline int f9103_21(int x) { return x * 21; }
+inline int f9103_22(int x) { return x * 22; }
+inline int f9103_23(int x) { return x * 23; }
+inline int f9103_24(int x) { return x * 24; }
+inline int f9103_25(int x) { return x * 25; }
+inline int f9103_26(int x) { return x * 26; }
+inline int f9103_27(int x) { return x * 27; }
+inline int f9103_28(int x) { return x * 28; }
+inline int f9103_29(int x) { return x * 29; }
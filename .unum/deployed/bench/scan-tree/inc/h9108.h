@@ -0,0 +1,42 @@
+#pragma once
+/* header 9108 */
+#include <vector>
+#include "h757.h"
+#include "h1681.h"
+#include "h2504.h"
+#include "h1072.h"
+#include "h6174.h"
+#ifdef X
+#include "h5616.h"
+#endif
+struct S9108 { int a; const char *s = "x//y"; };
+inline int f9108_0(int x) { return x * 0; }
+inline int f9108_1(int x) { return x * 1; }
+inline int f9108_2(int x) { return x * 2; }
+inline int f9108_3(int x) { return x * 3; }
+inline int f9108_4(int x) { return x * 4; }
+inline int f9108_5(int x) { return x * 5; }
+inline int f9108_6(int x) { return x * 6; }
+inline int f9108_7(int x) { return x * 7; }
+inline int f9108_8(int x) { return x * 8; }
+inline int f9108_9(int x) { return x * 9; }
+inline int f9108_10(int x) { return x * 10; }
+inline int f9108_11(int x) { return x * 11; }
+inline int f9108_12(int x) { return x * 12; }
+inline int f9108_13(int x) { return x * 13; }
+inline int f9108_14(int x) { return x * 14; }
+inline int f9108_15(int x) { return x * 15; }
+inline int f9108_16(int x) { return x * 16; }
+inline int f9108_17(int x) { return x * 17; }
+inline int f9108_18(int x) { return x * 18; }
+inline int f9108_19(int x) { return x * 19; }
+inline int f9108_20(int x) { return x * 20; }
+inline int f9108_21(int x) { return x * 21; }
+inline int f9108_22(int x) { return x * 22; }
+inline int f9108_23(int x) { return x * 23; }
+inline int f9108_24(int x) { return x * 24; }
+inline int f9108_25(int x) { return x * 25; }
+inline int f9108_26(int x) { return x * 26; }
+inline int f9108_27(int x) { return x * 27; }
+inline int f9108_28(int x) { return x * 28; }
+inline int f9108_29(int x) { return x * 29; }
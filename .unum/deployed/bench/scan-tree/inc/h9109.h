@@ -0,0 +1,42 @@
+#pragma once
+/* header 9109 */
+#include <vector>
+#include "h7756.h"
+#include "h8026.h"
+#include "h8049.h"
+#include "h328.h"
+#include "h7668.h"
+#ifdef X
+#include "h3688.h"
+#endif
+struct S9109 { int a; const char *s = "x//y"; };
+inline int f9109_0(int x) { return x * 0; }
+inline int f9109_1(int x) { return x * 1; }
+inline int f9109_2(int x) { return x * 2; }
+inline int f9109_3(int x) { return x * 3; }
+inline int f9109_4(int x) { return x * 4; }
+inline int f9109_5(int x) { return x * 5; }
+inline int f9109_6(int x) { return x * 6; }
+inline int f9109_7(int x) { return x * 7; }
+inline int f9109_8(int x) { return x * 8; }
+inline int f9109_9(int x) { return x * 9; }
+inline int f9109_10(int x) { return x * 10; }
+inline int f9109_11(int x) { return x * 11; }
+inline int f9109_12(int x) { return x * 12; }
+inline int f9109_13(int x) { return x * 13; }
+inline int f9109_14(int x) { return x * 14; }
+inline int f9109_15(int x) { return x * 15; }
+inline int f9109_16(int x) { return x * 16; }
+inline int f9109_17(int x) { return x * 17; }
+inline int f9109_18(int x) { return x * 18; }
+inline int f9109_19(int x) { return x * 19; }
+inline int f9109_20(int x) { return x * 20; }
+inline int f9109_21(int x) { return x * 21; }
+inline int f9109_22(int x) { return x * 22; }
+inline int f9109_23(int x) { return x * 23; }
+inline int f9109_24(int x) { return x * 24; }
+inline int f9109_25(int x) { return x * 25; }
+inline int f9109_26(int x) { return x * 26; }
+inline int f9109_27(int x) { return x * 27; }
+inline int f9109_28(int x) { return x * 28; }
+inline int f9109_29(int x) { return x * 29; }
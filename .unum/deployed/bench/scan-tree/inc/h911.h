@@ -0,0 +1,42 @@
+#pragma once
+/* header 911 */
+#include <vector>
+#include "h167.h"
+#include "h9213.h"
+#include "h636.h"
+#include "h6900.h"
+#include "h1174.h"
+#ifdef X
+#include "h243.h"
+#endif
+struct S911 { int a; const char *s = "x//y"; };
+inline int f911_0(int x) { return x * 0; }
+inline int f911_1(int x) { return x * 1; }
+inline int f911_2(int x) { return x * 2; }
+inline int f911_3(int x) { return x * 3; }
+inline int f911_4(int x) { return x * 4; }
+inline int f911_5(int x) { return x * 5; }
+inline int f911_6(int x) { return x * 6; }
+inline int f911_7(int x) { return x * 7; }
+inline int f911_8(int x) { return x * 8; }
+inline int f911_9(int x) { return x * 9; }
+inline int f911_10(int x) { return x * 10; }
+inline int f911_11(int x) { return x * 11; }
+inline int f911_12(int x) { return x * 12; }
+inline int f911_13(int x) { return x * 13; }
+inline int f911_14(int x) { return x * 14; }
+inline int f911_15(int x) { return x * 15; }
+inline int f911_16(int x) { return x * 16; }
+inline int f911_17(int x) { return x * 17; }
+inline int f911_18(int x) { return x * 18; }
+inline int f911_19(int x) { return x * 19; }
+inline int f911_20(int x) { return x * 20; }
+inline int f911_21(int x) { return x * 21; }
+inline int f911_22(int x) { return x * 22; }
+inline int f911_23(int x) { return x * 23; }
+inline int f911_24(int x) { return x * 24; }
+inline int f911_25(int x) { return x * 25; }
+inline int f911_26(int x) { return x * 26; }
+inline int f911_27(int x) { return x * 27; }
+inline int f911_28(int x) { return x * 28; }
+inline int f911_29(int x) { return x * 29; }
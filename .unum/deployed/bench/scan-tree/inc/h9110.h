@@ -0,0 +1,42 @@
+#pragma once
+/* header 9110 */
+#include <vector>
+#include "h4095.h"
+#include "h4914.h"
+#include "h3779.h"
+#include "h41.h"
+#include "h2869.h"
+#ifdef X
+#include "h7900.h"
+#endif
+struct S9110 { int a; const char *s = "x//y"; };
+inline int f9110_0(int x) { return x * 0; }
+inline int f9110_1(int x) { return x * 1; }
+inline int f9110_2(int x) { return x * 2; }
+inline int f9110_3(int x) { return x * 3; }
+inline int f9110_4(int x) { return x * 4; }
+inline int f9110_5(int x) { return x * 5; }
+inline int f9110_6(int x) { return x * 6; }
+inline int f9110_7(int x) { return x * 7; }
+inline int f9110_8(int x) { return x * 8; }
+inline int f9110_9(int x) { return x * 9; }
+inline int f9110_10(int x) { return x * 10; }
+inline int f9110_11(int x) { return x * 11; }
+inline int f9110_12(int x) { return x * 12; }
+inline int f9110_13(int x) { return x * 13; }
+inline int f9110_14(int x) { return x * 14; }
+inline int f9110_15(int x) { return x * 15; }
+inline int f9110_16(int x) { return x * 16; }
+inline int f9110_17(int x) { return x * 17; }
+inline int f9110_18(int x) { return x * 18; }
+inline int f9110_19(int x) { return x * 19; }
+inline int f9110_20(int x) { return x * 20; }
+inline int f9110_21(int x) { return x * 21; }
+inline int f9110_22(int x) { return x * 22; }
+inline int f9110_23(int x) { return x * 23; }
+inline int f9110_24(int x) { return x * 24; }
+inline int f9110_25(int x) { return x * 25; }
+inline int f9110_26(int x) { return x * 26; }
+inline int f9110_27(int x) { return x * 27; }
+inline int f9110_28(int x) { return x * 28; }
+inline int f9110_29(int x) { return x * 29; }
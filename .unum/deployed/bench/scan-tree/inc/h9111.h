@@ -0,0 +1,42 @@
+#pragma once
+/* header 9111 */
+#include <vector>
+#include "h153.h"
+#include "h192.h"
+#include "h2531.h"
+#include "h136.h"
+#include "h1642.h"
+#ifdef X
+#include "h8494.h"
+#endif
+struct S9111 { int a; const char *s = "x//y"; };
+inline int f9111_0(int x) { return x * 0; }
+inline int f9111_1(int x) { return x * 1; }
+inline int f9111_2(int x) { return x * 2; }
+inline int f9111_3(int x) { return x * 3; }
+inline int f9111_4(int x) { return x * 4; }
+inline int f9111_5(int x) { return x * 5; }
+inline int f9111_6(int x) { return x * 6; }
+inline int f9111_7(int x) { return x * 7; }
+inline int f9111_8(int x) { return x * 8; }
+inline int f9111_9(int x) { return x * 9; }
+inline int f9111_10(int x) { return x * 10; }
+inline int f9111_11(int x) { return x * 11; }
+inline int f9111_12(int x) { return x * 12; }
+inline int f9111_13(int x) { return x * 13; }
+inline int f9111_14(int x) { return x * 14; }
+inline int f9111_15(int x) { return x * 15; }
+inline int f9111_16(int x) { return x * 16; }
+inline int f9111_17(int x) { return x * 17; }
+inline int f9111_18(int x) { return x * 18; }
+inline int f9111_19(int x) { return x * 19; }
+inline int f9111_20(int x) { return x * 20; }
+inline int f9111_21(int x) { return x * 21; }
+inline int f9111_22(int x) { return x * 22; }
+inline int f9111_23(int x) { return x * 23; }
+inline int f9111_24(int x) { return x * 24; }
+inline int f9111_25(int x) { return x * 25; }
+inline int f9111_26(int x) { return x * 26; }
+inline int f9111_27(int x) { return x * 27; }
+inline int f9111_28(int x) { return x * 28; }
+inline int f9111_29(int x) { return x * 29; }
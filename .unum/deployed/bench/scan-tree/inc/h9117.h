@@ -0,0 +1,42 @@
+#pragma once
+/* header 9117 */
+#include <vector>
+#include "h8454.h"
+#include "h2802.h"
+#include "h1403.h"
+#include "h9272.h"
+#include "h2093.h"
+#ifdef X
+#include "h8445.h"
+#endif
+struct S9117 { int a; const char *s = "x//y"; };
+inline int f9117_0(int x) { return x * 0; }
+inline int f9117_1(int x) { return x * 1; }
+inline int f9117_2(int x) { return x * 2; }
+inline int f9117_3(int x) { return x * 3; }
+inline int f9117_4(int x) { return x * 4; }
+inline int f9117_5(int x) { return x * 5; }
+inline int f9117_6(int x) { return x * 6; }
+inline int f9117_7(int x) { return x * 7; }
+inline int f9117_8(int x) { return x * 8; }
+inline int f9117_9(int x) { return x * 9; }
+inline int f9117_10(int x) { return x * 10; }
+inline int f9117_11(int x) { return x * 11; }
+inline int f9117_12(int x) { return x * 12; }
+inline int f9117_13(int x) { return x * 13; }
+inline int f9117_14(int x) { return x * 14; }
+inline int f9117_15(int x) { return x * 15; }
+inline int f9117_16(int x) { return x * 16; }
+inline int f9117_17(int x) { return x * 17; }
+inline int f9117_18(int x) { return x * 18; }
+inline int f9117_19(int x) { return x * 19; }
+inline int f9117_20(int x) { return x * 20; }
+inline int f9117_21(int x) { return x * 21; }
+inline int f9117_22(int x) { return x * 22; }
+inline int f9117_23(int x) { return x * 23; }
+inline int f9117_24(int x) { return x * 24; }
+inline int f9117_25(int x) { return x * 25; }
+inline int f9117_26(int x) { return x * 26; }
+inline int f9117_27(int x) { return x * 27; }
+inline int f9117_28(int x) { return x * 28; }
+inline int f9117_29(int x) { return x * 29; }
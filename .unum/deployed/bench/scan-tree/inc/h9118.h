@@ -0,0 +1,42 @@
+#pragma once
+/* header 9118 */
+#include <vector>
+#include "h1986.h"
+#include "h2939.h"
+#include "h4483.h"
+#include "h1356.h"
+#include "h5585.h"
+#ifdef X
+#include "h2761.h"
+#endif
+struct S9118 { int a; const char *s = "x//y"; };
+inline int f9118_0(int x) { return x * 0; }
+inline int f9118_1(int x) { return x * 1; }
+inline int f9118_2(int x) { return x * 2; }
+inline int f9118_3(int x) { return x * 3; }
+inline int f9118_4(int x) { return x * 4; }
+inline int f9118_5(int x) { return x * 5; }
+inline int f9118_6(int x) { return x * 6; }
+inline int f9118_7(int x) { return x * 7; }
+inline int f9118_8(int x) { return x * 8; }
+inline int f9118_9(int x) { return x * 9; }
+inline int f9118_10(int x) { return x * 10; }
+inline int f9118_11(int x) { return x * 11; }
+inline int f9118_12(int x) { return x * 12; }
+inline int f9118_13(int x) { return x * 13; }
+inline int f9118_14(int x) { return x * 14; }
+inline int f9118_15(int x) { return x * 15; }
+inline int f9118_16(int x) { return x * 16; }
+inline int f9118_17(int x) { return x * 17; }
+inline int f9118_18(int x) { return x * 18; }
+inline int f9118_19(int x) { return x * 19; }
+inline int f9118_20(int x) { return x * 20; }
+inline int f9118_21(int x) { return x * 21; }
+inline int f9118_22(int x) { return x * 22; }
+inline int f9118_23(int x) { return x * 23; }
+inline int f9118_24(int x) { return x * 24; }
+inline int f9118_25(int x) { return x * 25; }
+inline int f9118_26(int x) { return x * 26; }
+inline int f9118_27(int x) { return x * 27; }
+inline int f9118_28(int x) { return x * 28; }
+inline int f9118_29(int x) { return x * 29; }
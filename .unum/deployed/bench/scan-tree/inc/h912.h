@@ -0,0 +1,42 @@
+#pragma once
+/* header 912 */
+#include <vector>
+#include "h3818.h"
+#include "h508.h"
+#include "h1826.h"
+#include "h1341.h"
+#include "h9867.h"
+#ifdef X
+#include "h4106.h"
+#endif
+struct S912 { int a; const char *s = "x//y"; };
+inline int f912_0(int x) { return x * 0; }
+inline int f912_1(int x) { return x * 1; }
+inline int f912_2(int x) { return x * 2; }
+inline int f912_3(int x) { return x * 3; }
+inline int f912_4(int x) { return x * 4; }
+inline int f912_5(int x) { return x * 5; }
+inline int f912_6(int x) { return x * 6; }
+inline int f912_7(int x) { return x * 7; }
+inline int f912_8(int x) { return x * 8; }
+inline int f912_9(int x) { return x * 9; }
+inline int f912_10(int x) { return x * 10; }
+inline int f912_11(int x) { return x * 11; }
+inline int f912_12(int x) { return x * 12; }
+inline int f912_13(int x) { return x * 13; }
+inline int f912_14(int x) { return x * 14; }
+inline int f912_15(int x) { return x * 15; }
+inline int f912_16(int x) { return x * 16; }
+inline int f912_17(int x) { return x * 17; }
+inline int f912_18(int x) { return x * 18; }
+inline int f912_19(int x) { return x * 19; }
+inline int f912_20(int x) { return x * 20; }
+inline int f912_21(int x) { return x * 21; }
+inline int f912_22(int x) { return x * 22; }
+inline int f912_23(int x) { return x * 23; }
+inline int f912_24(int x) { return x * 24; }
+inline int f912_25(int x) { return x * 25; }
+inline int f912_26(int x) { return x * 26; }
+inline int f912_27(int x) { return x * 27; }
+inline int f912_28(int x) { return x * 28; }
+inline int f912_29(int x) { return x * 29; }
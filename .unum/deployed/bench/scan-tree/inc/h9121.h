@@ -0,0 +1,42 @@
+#pragma once
+/* header 9121 */
+#include <vector>
+#include "h6586.h"
+#include "h9365.h"
+#include "h1601.h"
+#include "h9927.h"
+#include "h6318.h"
+#ifdef X
+#include "h365.h"
+#endif
+struct S9121 { int a; const char *s = "x//y"; };
+inline int f9121_0(int x) { return x * 0; }
+inline int f9121_1(int x) { return x * 1; }
+inline int f9121_2(int x) { return x * 2; }
+inline int f9121_3(int x) { return x * 3; }
+inline int f9121_4(int x) { return x * 4; }
+inline int f9121_5(int x) { return x * 5; }
+inline int f9121_6(int x) { return x * 6; }
+inline int f9121_7(int x) { return x * 7; }
+inline int f9121_8(int x) { return x * 8; }
+inline int f9121_9(int x) { return x * 9; }
+inline int f9121_10(int x) { return x * 10; }
+inline int f9121_11(int x) { return x * 11; }
+inline int f9121_12(int x) { return x * 12; }
+inline int f9121_13(int x) { return x * 13; }
+inline int f9121_14(int x) { return x * 14; }
+inline int f9121_15(int x) { return x * 15; }
+inline int f9121_16(int x) { return x * 16; }
+inline int f9121_17(int x) { return x * 17; }
+inline int f9121_18(int x) { return x * 18; }
+inline int f9121_19(int x) { return x * 19; }
+inline int f9121_20(int x) { return x * 20; }
+inline int f9121_21(int x) { return x * 21; }
+inline int f9121_22(int x) { return x * 22; }
+inline int f9121_23(int x) { return x * 23; }
+inline int f9121_24(int x) { return x * 24; }
+inline int f9121_25(int x) { return x * 25; }
+inline int f9121_26(int x) { return x * 26; }
+inline int f9121_27(int x) { return x * 27; }
+inline int f9121_28(int x) { return x * 28; }
+inline int f9121_29(int x) { return x * 29; }
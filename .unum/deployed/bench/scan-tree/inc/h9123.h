@@ -0,0 +1,42 @@
+#pragma once
+/* header 9123 */
+#include <vector>
+#include "h1268.h"
+#include "h7345.h"
+#include "h4455.h"
+#include "h2108.h"
+#include "h7397.h"
+#ifdef X
+#include "h9378.h"
+#endif
+struct S9123 { int a; const char *s = "x//y"; };
+inline int f9123_0(int x) { return x * 0; }
+inline int f9123_1(int x) { return x * 1; }
+inline int f9123_2(int x) { return x * 2; }
+inline int f9123_3(int x) { return x * 3; }
+inline int f9123_4(int x) { return x * 4; }
+inline int f9123_5(int x) { return x * 5; }
+inline int f9123_6(int x) { return x * 6; }
+inline int f9123_7(int x) { return x * 7; }
+inline int f9123_8(int x) { return x * 8; }
+inline int f9123_9(int x) { return x * 9; }
+inline int f9123_10(int x) { return x * 10; }
+inline int f9123_11(int x) { return x * 11; }
+inline int f9123_12(int x) { return x * 12; }
+inline int f9123_13(int x) { return x * 13; }
+inline int f9123_14(int x) { return x * 14; }
+inline int f9123_15(int x) { return x * 15; }
+inline int f9123_16(int x) { return x * 16; }
+inline int f9123_17(int x) { return x * 17; }
+inline int f9123_18(int x) { return x * 18; }
+inline int f9123_19(int x) { return x * 19; }
+inline int f9123_20(int x) { return x * 20; }
+inline int f9123_21(int x) { return x * 21; }
+inline int f9123_22(int x) { return x * 22; }
+inline int f9123_23(int x) { return x * 23; }
+inline int f9123_24(int x) { return x * 24; }
+inline int f9123_25(int x) { return x * 25; }
+inline int f9123_26(int x) { return x * 26; }
+inline int f9123_27(int x) { return x * 27; }
+inline int f9123_28(int x) { return x * 28; }
+inline int f9123_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9125 */
+#include <vector>
+#include "h5489.h"
+#include "h343.h"
+#include "h6930.h"
+#include "h9969.h"
+#include "h7756.h"
+#ifdef X
+#include "h977.h"
+#endif
+struct S9125 { int a; const char *s = "x//y"; };
+inline int f9125_0(int x) { return x * 0; }
+inline int f9125_1(int x) { return x * 1; }
+inline int f9125_2(int x) { return x * 2; }
+inline int f9125_3(int x) { return x * 3; }
+inline int f9125_4(int x) { return x * 4; }
+inline int f9125_5(int x) { return x * 5; }
+inline int f9125_6(int x) { return x * 6; }
+inline int f9125_7(int x) { return x * 7; }
+inline int f9125_8(int x) { return x * 8; }
+inline int f9125_9(int x) { return x * 9; }
+inline int f9125_10(int x) { return x * 10; }
+inline int f9125_11(int x) { return x * 11; }
+inline int f9125_12(int x) { return x * 12; }
+inline int f9125_13(int x) { return x * 13; }
+inline int f9125_14(int x) { return x * 14; }
+inline int f9125_15(int x) { return x * 15; }
+inline int f9125_16(int x) { return x * 16; }
+inline int f9125_17(int x) { return x * 17; }
+inline int f9125_18(int x) { return x * 18; }
+inline int f9125_19(int x) { return x * 19; }
+inline int f9125_20(int x) { return x * 20; }
+inline int f9125_21(int x) { return x * 21; }
+inline int f9125_22(int x) { return x * 22; }
+inline int f9125_23(int x) { return x * 23; }
+inline int f9125_24(int x) { return x * 24; }
+inline int f9125_25(int x) { return x * 25; }
+inline int f9125_26(int x) { return x * 26; }
+inline int f9125_27(int x) { return x * 27; }
+inline int f9125_28(int x) { return x * 28; }
+inline int f9125_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9128 */
+#include <vector>
+#include "h9444.h"
+#include "h5510.h"
+#include "h8498.h"
+#include "h1450.h"
+#include "h6413.h"
+#ifdef X
+#include "h8402.h"
+#endif
+struct S9128 { int a; const char *s = "x//y"; };
+inline int f9128_0(int x) { return x * 0; }
+inline int f9128_1(int x) { return x * 1; }
+inline int f9128_2(int x) { return x * 2; }
+inline int f9128_3(int x) { return x * 3; }
+inline int f9128_4(int x) { return x * 4; }
+inline int f9128_5(int x) { return x * 5; }
+inline int f9128_6(int x) { return x * 6; }
+inline int f9128_7(int x) { return x * 7; }
+inline int f9128_8(int x) { return x * 8; }
+inline int f9128_9(int x) { return x * 9; }
+inline int f9128_10(int x) { return x * 10; }
+inline int f9128_11(int x) { return x * 11; }
+inline int f9128_12(int x) { return x * 12; }
+inline int f9128_13(int x) { return x * 13; }
+inline int f9128_14(int x) { return x * 14; }
+inline int f9128_15(int x) { return x * 15; }
+inline int f9128_16(int x) { return x * 16; }
+inline int f9128_17(int x) { return x * 17; }
+inline int f9128_18(int x) { return x * 18; }
+inline int f9128_19(int x) { return x * 19; }
+inline int f9128_20(int x) { return x * 20; }
+inline int f9128_21(int x) { return x * 21; }
+inline int f9128_22(int x) { return x * 22; }
+inline int f9128_23(int x) { return x * 23; }
+inline int f9128_24(int x) { return x * 24; }
+inline int f9128_25(int x) { return x * 25; }
+inline int f9128_26(int x) { return x * 26; }
+inline int f9128_27(int x) { return x * 27; }
+inline int f9128_28(int x) { return x * 28; }
+inline int f9128_29(int x) { return x * 29; }
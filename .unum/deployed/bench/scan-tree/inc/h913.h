@@ -0,0 +1,42 @@
+#pragma once
+/* header 913 */
+#include <vector>
+#include "h9122.h"
+#include "h3291.h"
+#include "h4391.h"
+#include "h9026.h"
+#include "h2682.h"
+#ifdef X
+#include "h7452.h"
+#endif
+struct S913 { int a; const char *s = "x//y"; };
+inline int f913_0(int x) { return x * 0; }
+inline int f913_1(int x) { return x * 1; }
+inline int f913_2(int x) { return x * 2; }
+inline int f913_3(int x) { return x * 3; }
+inline int f913_4(int x) { return x * 4; }
+inline int f913_5(int x) { return x * 5; }
+inline int f913_6(int x) { return x * 6; }
+inline int f913_7(int x) { return x * 7; }
+inline int f913_8(int x) { return x * 8; }
+inline int f913_9(int x) { return x * 9; }
+inline int f913_10(int x) { return x * 10; }
+inline int f913_11(int x) { return x * 11; }
+inline int f913_12(int x) { return x * 12; }
+inline int f913_13(int x) { return x * 13; }
+inline int f913_14(int x) { return x * 14; }
+inline int f913_15(int x) { return x * 15; }
+inline int f913_16(int x) { return x * 16; }
+inline int f913_17(int x) { return x * 17; }
+inline int f913_18(int x) { return x * 18; }
+inline int f913_19(int x) { return x * 19; }
+inline int f913_20(int x) { return x * 20; }
+inline int f913_21(int x) { return x * 21; }
+inline int f913_22(int x) { return x * 22; }
+inline int f913_23(int x) { return x * 23; }
+inline int f913_24(int x) { return x * 24; }
+inline int f913_25(int x) { return x * 25; }
+inline int f913_26(int x) { return x * 26; }
+inline int f913_27(int x) { return x * 27; }
+inline int f913_28(int x) { return x * 28; }
+inline int f913_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9132 */
+#include <vector>
+#include "h7148.h"
+#include "h7595.h"
+#include "h5796.h"
+#include "h4071.h"
+#include "h7277.h"
+#ifdef X
+#include "h1079.h"
+#endif
+struct S9132 { int a; const char *s = "x//y"; };
+inline int f9132_0(int x) { return x * 0; }
+inline int f9132_1(int x) { return x * 1; }
+inline int f9132_2(int x) { return x * 2; }
+inline int f9132_3(int x) { return x * 3; }
+inline int f9132_4(int x) { return x * 4; }
+inline int f9132_5(int x) { return x * 5; }
+inline int f9132_6(int x) { return x * 6; }
+inline int f9132_7(int x) { return x * 7; }
+inline int f9132_8(int x) { return x * 8; }
+inline int f9132_9(int x) { return x * 9; }
+inline int f9132_10(int x) { return x * 10; }
+inline int f9132_11(int x) { return x * 11; }
+inline int f9132_12(int x) { return x * 12; }
+inline int f9132_13(int x) { return x * 13; }
+inline int f9132_14(int x) { return x * 14; }
+inline int f9132_15(int x) { return x * 15; }
+inline int f9132_16(int x) { return x * 16; }
+inline int f9132_17(int x) { return x * 17; }
+inline int f9132_18(int x) { return x * 18; }
+inline int f9132_19(int x) { return x * 19; }
+inline int f9132_20(int x) { return x * 20; }
+inline int f9132_21(int x) { return x * 21; }
+inline int f9132_22(int x) { return x * 22; }
+inline int f9132_23(int x) { return x * 23; }
+inline int f9132_24(int x) { return x * 24; }
+inline int f9132_25(int x) { return x * 25; }
+inline int f9132_26(int x) { return x * 26; }
+inline int f9132_27(int x) { return x * 27; }
+inline int f9132_28(int x) { return x * 28; }
+inline int f9132_29(int x) { return x * 29; }
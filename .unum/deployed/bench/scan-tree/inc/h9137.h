@@ -0,0 +1,42 @@
+#pragma once
+/* header 9137 */
+#include <vector>
+#include "h2776.h"
+#include "h3776.h"
+#include "h6428.h"
+#include "h2871.h"
+#include "h5352.h"
+#ifdef X
+#include "h8195.h"
+#endif
+struct S9137 { int a; const char *s = "x//y"; };
+inline int f9137_0(int x) { return x * 0; }
+inline int f9137_1(int x) { return x * 1; }
+inline int f9137_2(int x) { return x * 2; }
+inline int f9137_3(int x) { return x * 3; }
+inline int f9137_4(int x) { return x * 4; }
+inline int f9137_5(int x) { return x * 5; }
+inline int f9137_6(int x) { return x * 6; }
+inline int f9137_7(int x) { return x * 7; }
+inline int f9137_8(int x) { return x * 8; }
+inline int f9137_9(int x) { return x * 9; }
+inline int f9137_10(int x) { return x * 10; }
+inline int f9137_11(int x) { return x * 11; }
+inline int f9137_12(int x) { return x * 12; }
+inline int f9137_13(int x) { return x * 13; }
+inline int f9137_14(int x) { return x * 14; }
+inline int f9137_15(int x) { return x * 15; }
+inline int f9137_16(int x) { return x * 16; }
+inline int f9137_17(int x) { return x * 17; }
+inline int f9137_18(int x) { return x * 18; }
+inline int f9137_19(int x) { return x * 19; }
+inline int f9137_20(int x) { return x * 20; }
+inline int f9137_21(int x) { return x * 21; }
+inline int f9137_22(int x) { return x * 22; }
+inline int f9137_23(int x) { return x * 23; }
+inline int f9137_24(int x) { return x * 24; }
+inline int f9137_25(int x) { return x * 25; }
+inline int f9137_26(int x) { return x * 26; }
+inline int f9137_27(int x) { return x * 27; }
+inline int f9137_28(int x) { return x * 28; }
+inline int f9137_29(int x) { return x * 29; }
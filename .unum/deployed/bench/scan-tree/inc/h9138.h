@@ -0,0 +1,42 @@
+#pragma once
+/* header 9138 */
+#include <vector>
+#include "h7144.h"
+#include "h9527.h"
+#include "h2254.h"
+#include "h6158.h"
+#include "h5714.h"
+#ifdef X
+#include "h2485.h"
+#endif
+struct S9138 { int a; const char *s = "x//y"; };
+inline int f9138_0(int x) { return x * 0; }
+inline int f9138_1(int x) { return x * 1; }
+inline int f9138_2(int x) { return x * 2; }
+inline int f9138_3(int x) { return x * 3; }
+inline int f9138_4(int x) { return x * 4; }
+inline int f9138_5(int x) { return x * 5; }
+inline int f9138_6(int x) { return x * 6; }
+inline int f9138_7(int x) { return x * 7; }
+inline int f9138_8(int x) { return x * 8; }
+inline int f9138_9(int x) { return x * 9; }
+inline int f9138_10(int x) { return x * 10; }
+inline int f9138_11(int x) { return x * 11; }
+inline int f9138_12(int x) { return x * 12; }
+inline int f9138_13(int x) { return x * 13; }
+inline int f9138_14(int x) { return x * 14; }
+inline int f9138_15(int x) { return x * 15; }
+inline int f9138_16(int x) { return x * 16; }
+inline int f9138_17(int x) { return x * 17; }
+inline int f9138_18(int x) { return x * 18; }
+inline int f9138_19(int x) { return x * 19; }
+inline int f9138_20(int x) { return x * 20; }
+inline int f9138_21(int x) { return x * 21; }
+inline int f9138_22(int x) { return x * 22; }
+inline int f9138_23(int x) { return x * 23; }
+inline int f9138_24(int x) { return x * 24; }
+inline int f9138_25(int x) { return x * 25; }
+inline int f9138_26(int x) { return x * 26; }
+inline int f9138_27(int x) { return x * 27; }
+inline int f9138_28(int x) { return x * 28; }
+inline int f9138_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 914 */
+#include <vector>
+#include "h6104.h"
+#include "h8424.h"
+#include "h2175.h"
+#include "h5723.h"
+#include "h3652.h"
+#ifdef X
+#include "h2699.h"
+#endif
+struct S914 { int a; const char *s = "x//y"; };
+inline int f914_0(int x) { return x * 0; }
+inline int f914_1(int x) { return x * 1; }
+inline int f914_2(int x) { return x * 2; }
+inline int f914_3(int x) { return x * 3; }
+inline int f914_4(int x) { return x * 4; }
+inline int f914_5(int x) { return x * 5; }
+inline int f914_6(int x) { return x * 6; }
+inline int f914_7(int x) { return x * 7; }
+inline int f914_8(int x) { return x * 8; }
+inline int f914_9(int x) { return x * 9; }
+inline int f914_10(int x) { return x * 10; }
+inline int f914_11(int x) { return x * 11; }
+inline int f914_12(int x) { return x * 12; }
+inline int f914_13(int x) { return x * 13; }
+inline int f914_14(int x) { return x * 14; }
+inline int f914_15(int x) { return x * 15; }
+inline int f914_16(int x) { return x * 16; }
+inline int f914_17(int x) { return x * 17; }
+inline int f914_18(int x) { return x * 18; }
+inline int f914_19(int x) { return x * 19; }
+inline int f914_20(int x) { return x * 20; }
+inline int f914_21(int x) { return x * 21; }
+inline int f914_22(int x) { return x * 22; }
+inline int f914_23(int x) { return x * 23; }
+inline int f914_24(int x) { return x * 24; }
+inline int f914_25(int x) { return x * 25; }
+inline int f914_26(int x) { return x * 26; }
+inline int f914_27(int x) { return x * 27; }
+inline int f914_28(int x) { return x * 28; }
+inline int f914_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9141 */
+#include <vector>
+#include "h8760.h"
+#include "h6764.h"
+#include "h3906.h"
+#include "h9072.h"
+#include "h9332.h"
+#ifdef X
+#include "h960.h"
+#endif
+struct S9141 { int a; const char *s = "x//y"; };
+inline int f9141_0(int x) { return x * 0; }
+inline int f9141_1(int x) { return x * 1; }
+inline int f9141_2(int x) { return x * 2; }
+inline int f9141_3(int x) { return x * 3; }
+inline int f9141_4(int x) { return x * 4; }
+inline int f9141_5(int x) { return x * 5; }
+inline int f9141_6(int x) { return x * 6; }
+inline int f9141_7(int x) { return x * 7; }
+inline int f9141_8(int x) { return x * 8; }
+inline int f9141_9(int x) { return x * 9; }
+inline int f9141_10(int x) { return x * 10; }
+inline int f9141_11(int x) { return x * 11; }
+inline int f9141_12(int x) { return x * 12; }
+inline int f9141_13(int x) { return x * 13; }
+inline int f9141_14(int x) { return x * 14; }
+inline int f9141_15(int x) { return x * 15; }
+inline int f9141_16(int x) { return x * 16; }
+inline int f9141_17(int x) { return x * 17; }
+inline int f9141_18(int x) { return x * 18; }
+inline int f9141_19(int x) { return x * 19; }
+inline int f9141_20(int x) { return x * 20; }
+inline int f9141_21(int x) { return x * 21; }
+inline int f9141_22(int x) { return x * 22; }
+inline int f9141_23(int x) { return x * 23; }
+inline int f9141_24(int x) { return x * 24; }
+inline int f9141_25(int x) { return x * 25; }
+inline int f9141_26(int x) { return x * 26; }
+inline int f9141_27(int x) { return x * 27; }
+inline int f9141_28(int x) { return x * 28; }
+inline int f9141_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9144 */
+#include <vector>
+#include "h8782.h"
+#include "h2172.h"
+#include "h3080.h"
+#include "h3050.h"
+#include "h7979.h"
+#ifdef X
+#include "h8663.h"
+#endif
+struct S9144 { int a; const char *s = "x//y"; };
+inline int f9144_0(int x) { return x * 0; }
+inline int f9144_1(int x) { return x * 1; }
+inline int f9144_2(int x) { return x * 2; }
+inline int f9144_3(int x) { return x * 3; }
+inline int f9144_4(int x) { return x * 4; }
+inline int f9144_5(int x) { return x * 5; }
+inline int f9144_6(int x) { return x * 6; }
+inline int f9144_7(int x) { return x * 7; }
+inline int f9144_8(int x) { return x * 8; }
+inline int f9144_9(int x) { return x * 9; }
+inline int f9144_10(int x) { return x * 10; }
+inline int f9144_11(int x) { return x * 11; }
+inline int f9144_12(int x) { return x * 12; }
+inline int f9144_13(int x) { return x * 13; }
+inline int f9144_14(int x) { return x * 14; }
+inline int f9144_15(int x) { return x * 15; }
+inline int f9144_16(int x) { return x * 16; }
+inline int f9144_17(int x) { return x * 17; }
+inline int f9144_18(int x) { return x * 18; }
+inline int f9144_19(int x) { return x * 19; }
+inline int f9144_20(int x) { return x * 20; }
+inline int f9144_21(int x) { return x * 21; }
+inline int f9144_22(int x) { return x * 22; }
+inline int f9144_23(int x) { return x * 23; }
+inline int f9144_24(int x) { return x * 24; }
+inline int f9144_25(int x) { return x * 25; }
+inline int f9144_26(int x) { return x * 26; }
+inline int f9144_27(int x) { return x * 27; }
+inline int f9144_28(int x) { return x * 28; }
+inline int f9144_29(int x) { return x * 29; }
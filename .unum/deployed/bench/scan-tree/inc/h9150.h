@@ -0,0 +1,42 @@
+#pragma once
+/* header 9150 */
+#include <vector>
+#include "h6373.h"
+#include "h2028.h"
+#include "h541.h"
+#include "h725.h"
+#include "h5130.h"
+#ifdef X
+#include "h9460.h"
+#endif
+struct S9150 { int a; const char *s = "x//y"; };
+inline int f9150_0(int x) { return x * 0; }
+inline int f9150_1(int x) { return x * 1; }
+inline int f9150_2(int x) { return x * 2; }
+inline int f9150_3(int x) { return x * 3; }
+inline int f9150_4(int x) { return x * 4; }
+inline int f9150_5(int x) { return x * 5; }
+inline int f9150_6(int x) { return x * 6; }
+inline int f9150_7(int x) { return x * 7; }
+inline int f9150_8(int x) { return x * 8; }
+inline int f9150_9(int x) { return x * 9; }
+inline int f9150_10(int x) { return x * 10; }
+inline int f9150_11(int x) { return x * 11; }
+inline int f9150_12(int x) { return x * 12; }
+inline int f9150_13(int x) { return x * 13; }
+inline int f9150_14(int x) { return x * 14; }
+inline int f9150_15(int x) { return x * 15; }
+inline int f9150_16(int x) { return x * 16; }
+inline int f9150_17(int x) { return x * 17; }
+inline int f9150_18(int x) { return x * 18; }
+inline int f9150_19(int x) { return x * 19; }
+inline int f9150_20(int x) { return x * 20; }
+inline int f9150_21(int x) { return x * 21; }
+inline int f9150_22(int x) { return x * 22; }
+inline int f9150_23(int x) { return x * 23; }
+inline int f9150_24(int x) { return x * 24; }
+inline int f9150_25(int x) { return x * 25; }
+inline int f9150_26(int x) { return x * 26; }
+inline int f9150_27(int x) { return x * 27; }
+inline int f9150_28(int x) { return x * 28; }
+inline int f9150_29(int x) { return x * 29; }
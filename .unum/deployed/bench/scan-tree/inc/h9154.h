@@ -0,0 +1,42 @@
+#pragma once
+/* header 9154 */
+#include <vector>
+#include "h6308.h"
+#include "h1070.h"
+#include "h5834.h"
+#include "h1659.h"
+#include "h3540.h"
+#ifdef X
+#include "h865.h"
+#endif
+struct S9154 { int a; const char *s = "x//y"; };
+inline int f9154_0(int x) { return x * 0; }
+inline int f9154_1(int x) { return x * 1; }
+inline int f9154_2(int x) { return x * 2; }
+inline int f9154_3(int x) { return x * 3; }
+inline int f9154_4(int x) { return x * 4; }
+inline int f9154_5(int x) { return x * 5; }
+inline int f9154_6(int x) { return x * 6; }
+inline int f9154_7(int x) { return x * 7; }
+inline int f9154_8(int x) { return x * 8; }
+inline int f9154_9(int x) { return x * 9; }
+inline int f9154_10(int x) { return x * 10; }
+inline int f9154_11(int x) { return x * 11; }
+inline int f9154_12(int x) { return x * 12; }
+inline int f9154_13(int x) { return x * 13; }
+inline int f9154_14(int x) { return x * 14; }
+inline int f9154_15(int x) { return x * 15; }
+inline int f9154_16(int x) { return x * 16; }
+inline int f9154_17(int x) { return x * 17; }
+inline int f9154_18(int x) { return x * 18; }
+inline int f9154_19(int x) { return x * 19; }
+inline int f9154_20(int x) { return x * 20; }
+inline int f9154_21(int x) { return x * 21; }
+inline int f9154_22(int x) { return x * 22; }
+inline int f9154_23(int x) { return x * 23; }
+inline int f9154_24(int x) { return x * 24; }
+inline int f9154_25(int x) { return x * 25; }
+inline int f9154_26(int x) { return x * 26; }
+inline int f9154_27(int x) { return x * 27; }
+inline int f9154_28(int x) { return x * 28; }
+inline int f9154_29(int x) { return x * 29; }
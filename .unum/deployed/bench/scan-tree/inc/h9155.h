@@ -0,0 +1,42 @@
+#pragma once
+/* header 9155 */
+#include <vector>
+#include "h7168.h"
+#include "h9737.h"
+#include "h6786.h"
+#include "h5521.h"
+#include "h17.h"
+#ifdef X
+#include "h4043.h"
+#endif
+struct S9155 { int a; const char *s = "x//y"; };
+inline int f9155_0(int x) { return x * 0; }
+inline int f9155_1(int x) { return x * 1; }
+inline int f9155_2(int x) { return x * 2; }
+inline int f9155_3(int x) { return x * 3; }
+inline int f9155_4(int x) { return x * 4; }
+inline int f9155_5(int x) { return x * 5; }
+inline int f9155_6(int x) { return x * 6; }
+inline int f9155_7(int x) { return x * 7; }
+inline int f9155_8(int x) { return x * 8; }
+inline int f9155_9(int x) { return x * 9; }
+inline int f9155_10(int x) { return x * 10; }
+inline int f9155_11(int x) { return x * 11; }
+inline int f9155_12(int x) { return x * 12; }
+inline int f9155_13(int x) { return x * 13; }
+inline int f9155_14(int x) { return x * 14; }
+inline int f9155_15(int x) { return x * 15; }
+inline int f9155_16(int x) { return x * 16; }
+inline int f9155_17(int x) { return x * 17; }
+inline int f9155_18(int x) { return x * 18; }
+inline int f9155_19(int x) { return x * 19; }
+inline int f9155_20(int x) { return x * 20; }
+inline int f9155_21(int x) { return x * 21; }
+inline int f9155_22(int x) { return x * 22; }
+inline int f9155_23(int x) { return x * 23; }
+inline int f9155_24(int x) { return x * 24; }
+inline int f9155_25(int x) { return x * 25; }
+inline int f9155_26(int x) { return x * 26; }
+inline int f9155_27(int x) { return x * 27; }
+inline int f9155_28(int x) { return x * 28; }
+inline int f9155_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9156 */
+#include <vector>
+#include "h1897.h"
+#include "h5524.h"
+#include "h6412.h"
+#include "h1943.h"
+#include "h3206.h"
+#ifdef X
+#include "h1329.h"
+#endif
+struct S9156 { int a; const char *s = "x//y"; };
+inline int f9156_0(int x) { return x * 0; }
+inline int f9156_1(int x) { return x * 1; }
+inline int f9156_2(int x) { return x * 2; }
+inline int f9156_3(int x) { return x * 3; }
+inline int f9156_4(int x) { return x * 4; }
+inline int f9156_5(int x) { return x * 5; }
+inline int f9156_6(int x) { return x * 6; }
+inline int f9156_7(int x) { return x * 7; }
+inline int f9156_8(int x) { return x * 8; }
+inline int f9156_9(int x) { return x * 9; }
+inline int f9156_10(int x) { return x * 10; }
+inline int f9156_11(int x) { return x * 11; }
+inline int f9156_12(int x) { return x * 12; }
+inline int f9156_13(int x) { return x * 13; }
+inline int f9156_14(int x) { return x * 14; }
+inline int f9156_15(int x) { return x * 15; }
+inline int f9156_16(int x) { return x * 16; }
+inline int f9156_17(int x) { return x * 17; }
+inline int f9156_18(int x) { return x * 18; }
+inline int f9156_19(int x) { return x * 19; }
+inline int f9156_20(int x) { return x * 20; }
+inline int f9156_21(int x) { return x * 21; }
+inline int f9156_22(int x) { return x * 22; }
+inline int f9156_23(int x) { return x * 23; }
+inline int f9156_24(int x) { return x * 24; }
+inline int f9156_25(int x) { return x * 25; }
+inline int f9156_26(int x) { return x * 26; }
+inline int f9156_27(int x) { return x * 27; }
+inline int f9156_28(int x) { return x * 28; }
+inline int f9156_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9157 */
+#include <vector>
+#include "h9399.h"
+#include "h6274.h"
+#include "h5026.h"
+#include "h1289.h"
+#include "h5702.h"
+#ifdef X
+#include "h3568.h"
+#endif
+struct S9157 { int a; const char *s = "x//y"; };
+inline int f9157_0(int x) { return x * 0; }
+inline int f9157_1(int x) { return x * 1; }
+inline int f9157_2(int x) { return x * 2; }
+inline int f9157_3(int x) { return x * 3; }
+inline int f9157_4(int x) { return x * 4; }
+inline int f9157_5(int x) { return x * 5; }
+inline int f9157_6(int x) { return x * 6; }
+inline int f9157_7(int x) { return x * 7; }
+inline int f9157_8(int x) { return x * 8; }
+inline int f9157_9(int x) { return x * 9; }
+inline int f9157_10(int x) { return x * 10; }
+inline int f9157_11(int x) { return x * 11; }
+inline int f9157_12(int x) { return x * 12; }
+inline int f9157_13(int x) { return x * 13; }
+inline int f9157_14(int x) { return x * 14; }
+inline int f9157_15(int x) { return x * 15; }
+inline int f9157_16(int x) { return x * 16; }
+inline int f9157_17(int x) { return x * 17; }
+inline int f9157_18(int x) { return x * 18; }
+inline int f9157_19(int x) { return x * 19; }
+inline int f9157_20(int x) { return x * 20; }
+inline int f9157_21(int x) { return x * 21; }
+inline int f9157_22(int x) { return x * 22; }
+inline int f9157_23(int x) { return x * 23; }
+inline int f9157_24(int x) { return x * 24; }
+inline int f9157_25(int x) { return x * 25; }
+inline int f9157_26(int x) { return x * 26; }
+inline int f9157_27(int x) { return x * 27; }
+inline int f9157_28(int x) { return x * 28; }
+inline int f9157_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9158 */
+#include <vector>
+#include "h8937.h"
+#include "h3971.h"
+#include "h1412.h"
+#include "h1300.h"
+#include "h8066.h"
+#ifdef X
+#include "h9773.h"
+#endif
+struct S9158 { int a; const char *s = "x//y"; };
+inline int f9158_0(int x) { return x * 0; }
+inline int f9158_1(int x) { return x * 1; }
+inline int f9158_2(int x) { return x * 2; }
+inline int f9158_3(int x) { return x * 3; }
+inline int f9158_4(int x) { return x * 4; }
+inline int f9158_5(int x) { return x * 5; }
+inline int f9158_6(int x) { return x * 6; }
+inline int f9158_7(int x) { return x * 7; }
+inline int f9158_8(int x) { return x * 8; }
+inline int f9158_9(int x) { return x * 9; }
+inline int f9158_10(int x) { return x * 10; }
+inline int f9158_11(int x) { return x * 11; }
+inline int f9158_12(int x) { return x * 12; }
+inline int f9158_13(int x) { return x * 13; }
+inline int f9158_14(int x) { return x * 14; }
+inline int f9158_15(int x) { return x * 15; }
+inline int f9158_16(int x) { return x * 16; }
+inline int f9158_17(int x) { return x * 17; }
+inline int f9158_18(int x) { return x * 18; }
+inline int f9158_19(int x) { return x * 19; }
+inline int f9158_20(int x) { return x * 20; }
+inline int f9158_21(int x) { return x * 21; }
+inline int f9158_22(int x) { return x * 22; }
+inline int f9158_23(int x) { return x * 23; }
+inline int f9158_24(int x) { return x * 24; }
+inline int f9158_25(int x) { return x * 25; }
+inline int f9158_26(int x) { return x * 26; }
+inline int f9158_27(int x) { return x * 27; }
+inline int f9158_28(int x) { return x * 28; }
+inline int f9158_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9162 */
+#include <vector>
+#include "h4791.h"
+#include "h9334.h"
+#include "h4522.h"
+#include "h8042.h"
+#include "h5705.h"
+#ifdef X
+#include "h3591.h"
+#endif
+struct S9162 { int a; const char *s = "x//y"; };
+inline int f9162_0(int x) { return x * 0; }
+inline int f9162_1(int x) { return x * 1; }
+inline int f9162_2(int x) { return x * 2; }
+inline int f9162_3(int x) { return x * 3; }
+inline int f9162_4(int x) { return x * 4; }
+inline int f9162_5(int x) { return x * 5; }
+inline int f9162_6(int x) { return x * 6; }
+inline int f9162_7(int x) { return x * 7; }
+inline int f9162_8(int x) { return x * 8; }
+inline int f9162_9(int x) { return x * 9; }
+inline int f9162_10(int x) { return x * 10; }
+inline int f9162_11(int x) { return x * 11; }
+inline int f9162_12(int x) { return x * 12; }
+inline int f9162_13(int x) { return x * 13; }
+inline int f9162_14(int x) { return x * 14; }
+inline int f9162_15(int x) { return x * 15; }
+inline int f9162_16(int x) { return x * 16; }
+inline int f9162_17(int x) { return x * 17; }
+inline int f9162_18(int x) { return x * 18; }
+inline int f9162_19(int x) { return x * 19; }
+inline int f9162_20(int x) { return x * 20; }
+inline int f9162_21(int x) { return x * 21; }
+inline int f9162_22(int x) { return x * 22; }
+inline int f9162_23(int x) { return x * 23; }
+inline int f9162_24(int x) { return x * 24; }
+inline int f9162_25(int x) { return x * 25; }
+inline int f9162_26(int x) { return x * 26; }
+inline int f9162_27(int x) { return x * 27; }
+inline int f9162_28(int x) { return x * 28; }
+inline int f9162_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9164 */
+#include <vector>
+#include "h4303.h"
+#include "h7816.h"
+#include "h6636.h"
+#include "h1331.h"
+#include "h2835.h"
+#ifdef X
+#include "h1084.h"
+#endif
+struct S9164 { int a; const char *s = "x//y"; };
+inline int f9164_0(int x) { return x * 0; }
+inline int f9164_1(int x) { return x * 1; }
+inline int f9164_2(int x) { return x * 2; }
+inline int f9164_3(int x) { return x * 3; }
+inline int f9164_4(int x) { return x * 4; }
+inline int f9164_5(int x) { return x * 5; }
+inline int f9164_6(int x) { return x * 6; }
+inline int f9164_7(int x) { return x * 7; }
+inline int f9164_8(int x) { return x * 8; }
+inline int f9164_9(int x) { return x * 9; }
+inline int f9164_10(int x) { return x * 10; }
+inline int f9164_11(int x) { return x * 11; }
+inline int f9164_12(int x) { return x * 12; }
+inline int f9164_13(int x) { return x * 13; }
+inline int f9164_14(int x) { return x * 14; }
+inline int f9164_15(int x) { return x * 15; }
+inline int f9164_16(int x) { return x * 16; }
+inline int f9164_17(int x) { return x * 17; }
+inline int f9164_18(int x) { return x * 18; }
+inline int f9164_19(int x) { return x * 19; }
+inline int f9164_20(int x) { return x * 20; }
+inline int f9164_21(int x) { return x * 21; }
+inline int f9164_22(int x) { return x * 22; }
+inline int f9164_23(int x) { return x * 23; }
+inline int f9164_24(int x) { return x * 24; }
+inline int f9164_25(int x) { return x * 25; }
+inline int f9164_26(int x) { return x * 26; }
+inline int f9164_27(int x) { return x * 27; }
+inline int f9164_28(int x) { return x * 28; }
+inline int f9164_29(int x) { return x * 29; }
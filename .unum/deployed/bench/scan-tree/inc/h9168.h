@@ -0,0 +1,42 @@
+#pragma once
+/* header 9168 */
+#include <vector>
+#include "h6568.h"
+#include "h3574.h"
+#include "h9306.h"
+#include "h7517.h"
+#include "h3586.h"
+#ifdef X
+#include "h5000.h"
+#endif
+struct S9168 { int a; const char *s = "x//y"; };
+inline int f9168_0(int x) { return x * 0; }
+inline int f9168_1(int x) { return x * 1; }
+inline int f9168_2(int x) { return x * 2; }
+inline int f9168_3(int x) { return x * 3; }
+inline int f9168_4(int x) { return x * 4; }
+inline int f9168_5(int x) { return x * 5; }
+inline int f9168_6(int x) { return x * 6; }
+inline int f9168_7(int x) { return x * 7; }
+inline int f9168_8(int x) { return x * 8; }
+inline int f9168_9(int x) { return x * 9; }
+inline int f9168_10(int x) { return x * 10; }
+inline int f9168_11(int x) { return x * 11; }
+inline int f9168_12(int x) { return x * 12; }
+inline int f9168_13(int x) { return x * 13; }
+inline int f9168_14(int x) { return x * 14; }
+inline int f9168_15(int x) { return x * 15; }
+inline int f9168_16(int x) { return x * 16; }
+inline int f9168_17(int x) { return x * 17; }
+inline int f9168_18(int x) { return x * 18; }
+inline int f9168_19(int x) { return x * 19; }
+inline int f9168_20(int x) { return x * 20; }
+inline int f9168_21(int x) { return x * 21; }
+inline int f9168_22(int x) { return x * 22; }
+inline int f9168_23(int x) { return x * 23; }
+inline int f9168_24(int x) { return x * 24; }
+inline int f9168_25(int x) { return x * 25; }
+inline int f9168_26(int x) { return x * 26; }
+inline int f9168_27(int x) { return x * 27; }
+inline int f9168_28(int x) { return x * 28; }
+inline int f9168_29(int x) { return x * 29; }
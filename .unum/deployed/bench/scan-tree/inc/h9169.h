@@ -0,0 +1,42 @@
+#pragma once
+/* header 9169 */
+#include <vector>
+#include "h1272.h"
+#include "h3229.h"
+#include "h7679.h"
+#include "h3273.h"
+#include "h4137.h"
+#ifdef X
+#include "h7472.h"
+#endif
+struct S9169 { int a; const char *s = "x//y"; };
+inline int f9169_0(int x) { return x * 0; }
+inline int f9169_1(int x) { return x * 1; }
+inline int f9169_2(int x) { return x * 2; }
+inline int f9169_3(int x) { return x * 3; }
+inline int f9169_4(int x) { return x * 4; }
+inline int f9169_5(int x) { return x * 5; }
+inline int f9169_6(int x) { return x * 6; }
+inline int f9169_7(int x) { return x * 7; }
+inline int f9169_8(int x) { return x * 8; }
+inline int f9169_9(int x) { return x * 9; }
+inline int f9169_10(int x) { return x * 10; }
+inline int f9169_11(int x) { return x * 11; }
+inline int f9169_12(int x) { return x * 12; }
+inline int f9169_13(int x) { return x * 13; }
+inline int f9169_14(int x) { return x * 14; }
+inline int f9169_15(int x) { return x * 15; }
+inline int f9169_16(int x) { return x * 16; }
+inline int f9169_17(int x) { return x * 17; }
+inline int f9169_18(int x) { return x * 18; }
+inline int f9169_19(int x) { return x * 19; }
+inline int f9169_20(int x) { return x * 20; }
+inline int f9169_21(int x) { return x * 21; }
+inline int f9169_22(int x) { return x * 22; }
+inline int f9169_23(int x) { return x * 23; }
+inline int f9169_24(int x) { return x * 24; }
+inline int f9169_25(int x) { return x * 25; }
+inline int f9169_26(int x) { return x * 26; }
+inline int f9169_27(int x) { return x * 27; }
+inline int f9169_28(int x) { return x * 28; }
+inline int f9169_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9171 */
+#include <vector>
+#include "h6737.h"
+#include "h2466.h"
+#include "h9303.h"
+#include "h9078.h"
+#include "h7722.h"
+#ifdef X
+#include "h5235.h"
+#endif
+struct S9171 { int a; const char *s = "x//y"; };
+inline int f9171_0(int x) { return x * 0; }
+inline int f9171_1(int x) { return x * 1; }
+inline int f9171_2(int x) { return x * 2; }
+inline int f9171_3(int x) { return x * 3; }
+inline int f9171_4(int x) { return x * 4; }
+inline int f9171_5(int x) { return x * 5; }
+inline int f9171_6(int x) { return x * 6; }
+inline int f9171_7(int x) { return x * 7; }
+inline int f9171_8(int x) { return x * 8; }
+inline int f9171_9(int x) { return x * 9; }
+inline int f9171_10(int x) { return x * 10; }
+inline int f9171_11(int x) { return x * 11; }
+inline int f9171_12(int x) { return x * 12; }
+inline int f9171_13(int x) { return x * 13; }
+inline int f9171_14(int x) { return x * 14; }
+inline int f9171_15(int x) { return x * 15; }
+inline int f9171_16(int x) { return x * 16; }
+inline int f9171_17(int x) { return x * 17; }
+inline int f9171_18(int x) { return x * 18; }
+inline int f9171_19(int x) { return x * 19; }
+inline int f9171_20(int x) { return x * 20; }
+inline int f9171_21(int x) { return x * 21; }
+inline int f9171_22(int x) { return x * 22; }
+inline int f9171_23(int x) { return x * 23; }
+inline int f9171_24(int x) { return x * 24; }
+inline int f9171_25(int x) { return x * 25; }
+inline int f9171_26(int x) { return x * 26; }
+inline int f9171_27(int x) { return x * 27; }
+inline int f9171_28(int x) { return x * 28; }
+inline int f9171_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9174 */
+#include <vector>
+#include "h4826.h"
+#include "h2177.h"
+#include "h9713.h"
+#include "h6448.h"
+#include "h5325.h"
+#ifdef X
+#include "h4219.h"
+#endif
+struct S9174 { int a; const char *s = "x//y"; };
+inline int f9174_0(int x) { return x * 0; }
+inline int f9174_1(int x) { return x * 1; }
+inline int f9174_2(int x) { return x * 2; }
+inline int f9174_3(int x) { return x * 3; }
+inline int f9174_4(int x) { return x * 4; }
+inline int f9174_5(int x) { return x * 5; }
+inline int f9174_6(int x) { return x * 6; }
+inline int f9174_7(int x) { return x * 7; }
+inline int f9174_8(int x) { return x * 8; }
+inline int f9174_9(int x) { return x * 9; }
+inline int f9174_10(int x) { return x * 10; }
+inline int f9174_11(int x) { return x * 11; }
+inline int f9174_12(int x) { return x * 12; }
+inline int f9174_13(int x) { return x * 13; }
+inline int f9174_14(int x) { return x * 14; }
+inline int f9174_15(int x) { return x * 15; }
+inline int f9174_16(int x) { return x * 16; }
+inline int f9174_17(int x) { return x * 17; }
+inline int f9174_18(int x) { return x * 18; }
+inline int f9174_19(int x) { return x * 19; }
+inline int f9174_20(int x) { return x * 20; }
+inline int f9174_21(int x) { return x * 21; }
+inline int f9174_22(int x) { return x * 22; }
+inline int f9174_23(int x) { return x * 23; }
+inline int f9174_24(int x) { return x * 24; }
+inline int f9174_25(int x) { return x * 25; }
+inline int f9174_26(int x) { return x * 26; }
+inline int f9174_27(int x) { return x * 27; }
+inline int f9174_28(int x) { return x * 28; }
+inline int f9174_29(int x) { return x * 29; }
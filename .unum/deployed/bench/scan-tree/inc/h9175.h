@@ -0,0 +1,42 @@
+#pragma once
+/* header 9175 */
+#include <vector>
+#include "h9440.h"
+#include "h5482.h"
+#include "h3318.h"
+#include "h6551.h"
+#include "h2436.h"
+#ifdef X
+#include "h4743.h"
+#endif
+struct S9175 { int a; const char *s = "x//y"; };
+inline int f9175_0(int x) { return x * 0; }
+inline int f9175_1(int x) { return x * 1; }
+inline int f9175_2(int x) { return x * 2; }
+inline int f9175_3(int x) { return x * 3; }
+inline int f9175_4(int x) { return x * 4; }
+inline int f9175_5(int x) { return x * 5; }
+inline int f9175_6(int x) { return x * 6; }
+inline int f9175_7(int x) { return x * 7; }
+inline int f9175_8(int x) { return x * 8; }
+inline int f9175_9(int x) { return x * 9; }
+inline int f9175_10(int x) { return x * 10; }
+inline int f9175_11(int x) { return x * 11; }
+inline int f9175_12(int x) { return x * 12; }
+inline int f9175_13(int x) { return x * 13; }
+inline int f9175_14(int x) { return x * 14; }
+inline int f9175_15(int x) { return x * 15; }
+inline int f9175_16(int x) { return x * 16; }
+inline int f9175_17(int x) { return x * 17; }
+inline int f9175_18(int x) { return x * 18; }
+inline int f9175_19(int x) { return x * 19; }
+inline int f9175_20(int x) { return x * 20; }
+inline int f9175_21(int x) { return x * 21; }
+inline int f9175_22(int x) { return x * 22; }
+inline int f9175_23(int x) { return x * 23; }
+inline int f9175_24(int x) { return x * 24; }
+inline int f9175_25(int x) { return x * 25; }
+inline int f9175_26(int x) { return x * 26; }
+inline int f9175_27(int x) { return x * 27; }
+inline int f9175_28(int x) { return x * 28; }
+inline int f9175_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9177 */
+#include <vector>
+#include "h3593.h"
+#include "h9031.h"
+#include "h2559.h"
+#include "h9985.h"
+#include "h3966.h"
+#ifdef X
+#include "h6981.h"
+#endif
+struct S9177 { int a; const char *s = "x//y"; };
+inline int f9177_0(int x) { return x * 0; }
+inline int f9177_1(int x) { return x * 1; }
+inline int f9177_2(int x) { return x * 2; }
+inline int f9177_3(int x) { return x * 3; }
+inline int f9177_4(int x) { return x * 4; }
+inline int f9177_5(int x) { return x * 5; }
+inline int f9177_6(int x) { return x * 6; }
+inline int f9177_7(int x) { return x * 7; }
+inline int f9177_8(int x) { return x * 8; }
+inline int f9177_9(int x) { return x * 9; }
+inline int f9177_10(int x) { return x * 10; }
+inline int f9177_11(int x) { return x * 11; }
+inline int f9177_12(int x) { return x * 12; }
+inline int f9177_13(int x) { return x * 13; }
+inline int f9177_14(int x) { return x * 14; }
+inline int f9177_15(int x) { return x * 15; }
+inline int f9177_16(int x) { return x * 16; }
+inline int f9177_17(int x) { return x * 17; }
+inline int f9177_18(int x) { return x * 18; }
+inline int f9177_19(int x) { return x * 19; }
+inline int f9177_20(int x) { return x * 20; }
+inline int f9177_21(int x) { return x * 21; }
+inline int f9177_22(int x) { return x * 22; }
+inline int f9177_23(int x) { return x * 23; }
+inline int f9177_24(int x) { return x * 24; }
+inline int f9177_25(int x) { return x * 25; }
+inline int f9177_26(int x) { return x * 26; }
+inline int f9177_27(int x) { return x * 27; }
+inline int f9177_28(int x) { return x * 28; }
+inline int f9177_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9178 */
+#include <vector>
+#include "h620.h"
+#include "h9475.h"
+#include "h8377.h"
+#include "h4033.h"
+#include "h1251.h"
+#ifdef X
+#include "h7182.h"
+#endif
+struct S9178 { int a; const char *s = "x//y"; };
+inline int f9178_0(int x) { return x * 0; }
+inline int f9178_1(int x) { return x * 1; }
+inline int f9178_2(int x) { return x * 2; }
+inline int f9178_3(int x) { return x * 3; }
+inline int f9178_4(int x) { return x * 4; }
+inline int f9178_5(int x) { return x * 5; }
+inline int f9178_6(int x) { return x * 6; }
+inline int f9178_7(int x) { return x * 7; }
+inline int f9178_8(int x) { return x * 8; }
+inline int f9178_9(int x) { return x * 9; }
+inline int f9178_10(int x) { return x * 10; }
+inline int f9178_11(int x) { return x * 11; }
+inline int f9178_12(int x) { return x * 12; }
+inline int f9178_13(int x) { return x * 13; }
+inline int f9178_14(int x) { return x * 14; }
+inline int f9178_15(int x) { return x * 15; }
+inline int f9178_16(int x) { return x * 16; }
+inline int f9178_17(int x) { return x * 17; }
+inline int f9178_18(int x) { return x * 18; }
+inline int f9178_19(int x) { return x * 19; }
+inline int f9178_20(int x) { return x * 20; }
+inline int f9178_21(int x) { return x * 21; }
+inline int f9178_22(int x) { return x * 22; }
+inline int f9178_23(int x) { return x * 23; }
+inline int f9178_24(int x) { return x * 24; }
+inline int f9178_25(int x) { return x * 25; }
+inline int f9178_26(int x) { return x * 26; }
+inline int f9178_27(int x) { return x * 27; }
+inline int f9178_28(int x) { return x * 28; }
+inline int f9178_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9179 */
+#include <vector>
+#include "h8921.h"
+#include "h2799.h"
+#include "h5910.h"
+#include "h98.h"
+#include "h3906.h"
+#ifdef X
+#include "h2581.h"
+#endif
+struct S9179 { int a; const char *s = "x//y"; };
+inline int f9179_0(int x) { return x * 0; }
+inline int f9179_1(int x) { return x * 1; }
+inline int f9179_2(int x) { return x * 2; }
+inline int f9179_3(int x) { return x * 3; }
+inline int f9179_4(int x) { return x * 4; }
+inline int f9179_5(int x) { return x * 5; }
+inline int f9179_6(int x) { return x * 6; }
+inline int f9179_7(int x) { return x * 7; }
+inline int f9179_8(int x) { return x * 8; }
+inline int f9179_9(int x) { return x * 9; }
+inline int f9179_10(int x) { return x * 10; }
+inline int f9179_11(int x) { return x * 11; }
+inline int f9179_12(int x) { return x * 12; }
+inline int f9179_13(int x) { return x * 13; }
+inline int f9179_14(int x) { return x * 14; }
+inline int f9179_15(int x) { return x * 15; }
+inline int f9179_16(int x) { return x * 16; }
+inline int f9179_17(int x) { return x * 17; }
+inline int f9179_18(int x) { return x * 18; }
+inline int f9179_19(int x) { return x * 19; }
+inline int f9179_20(int x) { return x * 20; }
+inline int f9179_21(int x) { return x * 21; }
+inline int f9179_22(int x) { return x * 22; }
+inline int f9179_23(int x) { return x * 23; }
+inline int f9179_24(int x) { return x * 24; }
+inline int f9179_25(int x) { return x * 25; }
+inline int f9179_26(int x) { return x * 26; }
+inline int f9179_27(int x) { return x * 27; }
+inline int f9179_28(int x) { return x * 28; }
+inline int f9179_29(int x) { return x * 29; }
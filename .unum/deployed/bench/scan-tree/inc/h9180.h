@@ -0,0 +1,42 @@
+#pragma once
+/* header 9180 */
+#include <vector>
+#include "h1496.h"
+#include "h7192.h"
+#include "h1385.h"
+#include "h2357.h"
+#include "h5913.h"
+#ifdef X
+#include "h7471.h"
+#endif
+struct S9180 { int a; const char *s = "x//y"; };
+inline int f9180_0(int x) { return x * 0; }
+inline int f9180_1(int x) { return x * 1; }
+inline int f9180_2(int x) { return x * 2; }
+inline int f9180_3(int x) { return x * 3; }
+inline int f9180_4(int x) { return x * 4; }
+inline int f9180_5(int x) { return x * 5; }
+inline int f9180_6(int x) { return x * 6; }
+inline int f9180_7(int x) { return x * 7; }
+inline int f9180_8(int x) { return x * 8; }
+inline int f9180_9(int x) { return x * 9; }
+inline int f9180_10(int x) { return x * 10; }
+inline int f9180_11(int x) { return x * 11; }
+inline int f9180_12(int x) { return x * 12; }
+inline int f9180_13(int x) { return x * 13; }
+inline int f9180_14(int x) { return x * 14; }
+inline int f9180_15(int x) { return x * 15; }
+inline int f9180_16(int x) { return x * 16; }
+inline int f9180_17(int x) { return x * 17; }
+inline int f9180_18(int x) { return x * 18; }
+inline int f9180_19(int x) { return x * 19; }
+inline int f9180_20(int x) { return x * 20; }
+inline int f9180_21(int x) { return x * 21; }
+inline int f9180_22(int x) { return x * 22; }
+inline int f9180_23(int x) { return x * 23; }
+inline int f9180_24(int x) { return x * 24; }
+inline int f9180_25(int x) { return x * 25; }
+inline int f9180_26(int x) { return x * 26; }
+inline int f9180_27(int x) { return x * 27; }
+inline int f9180_28(int x) { return x * 28; }
+inline int f9180_29(int x) { return x * 29; }
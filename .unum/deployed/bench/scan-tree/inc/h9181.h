@@ -0,0 +1,42 @@
+#pragma once
+/* header 9181 */
+#include <vector>
+#include "h37.h"
+#include "h3005.h"
+#include "h6871.h"
+#include "h1031.h"
+#include "h1018.h"
+#ifdef X
+#include "h4654.h"
+#endif
+struct S9181 { int a; const char *s = "x//y"; };
+inline int f9181_0(int x) { return x * 0; }
+inline int f9181_1(int x) { return x * 1; }
+inline int f9181_2(int x) { return x * 2; }
+inline int f9181_3(int x) { return x * 3; }
+inline int f9181_4(int x) { return x * 4; }
+inline int f9181_5(int x) { return x * 5; }
+inline int f9181_6(int x) { return x * 6; }
+inline int f9181_7(int x) { return x * 7; }
+inline int f9181_8(int x) { return x * 8; }
+inline int f9181_9(int x) { return x * 9; }
+inline int f9181_10(int x) { return x * 10; }
+inline int f9181_11(int x) { return x * 11; }
+inline int f9181_12(int x) { return x * 12; }
+inline int f9181_13(int x) { return x * 13; }
+inline int f9181_14(int x) { return x * 14; }
+inline int f9181_15(int x) { return x * 15; }
+inline int f9181_16(int x) { return x * 16; }
+inline int f9181_17(int x) { return x * 17; }
+inline int f9181_18(int x) { return x * 18; }
+inline int f9181_19(int x) { return x * 19; }
+inline int f9181_20(int x) { return x * 20; }
+inline int f9181_21(int x) { return x * 21; }
+inline int f9181_22(int x) { return x * 22; }
+inline int f9181_23(int x) { return x * 23; }
+inline int f9181_24(int x) { return x * 24; }
+inline int f9181_25(int x) { return x * 25; }
+inline int f9181_26(int x) { return x * 26; }
+inline int f9181_27(int x) { return x * 27; }
+inline int f9181_28(int x) { return x * 28; }
+inline int f9181_29(int x) { return x * 29; }
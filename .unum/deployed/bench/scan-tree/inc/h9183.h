@@ -0,0 +1,42 @@
+#pragma once
+/* header 9183 */
+#include <vector>
+#include "h2320.h"
+#include "h2498.h"
+#include "h4914.h"
+#include "h8004.h"
+#include "h5681.h"
+#ifdef X
+#include "h826.h"
+#endif
+struct S9183 { int a; const char *s = "x//y"; };
+inline int f9183_0(int x) { return x * 0; }
+inline int f9183_1(int x) { return x * 1; }
+inline int f9183_2(int x) { return x * 2; }
+inline int f9183_3(int x) { return x * 3; }
+inline int f9183_4(int x) { return x * 4; }
+inline int f9183_5(int x) { return x * 5; }
+inline int f9183_6(int x) { return x * 6; }
+inline int f9183_7(int x) { return x * 7; }
+inline int f9183_8(int x) { return x * 8; }
+inline int f9183_9(int x) { return x * 9; }
+inline int f9183_10(int x) { return x * 10; }
+inline int f9183_11(int x) { return x * 11; }
+inline int f9183_12(int x) { return x * 12; }
+inline int f9183_13(int x) { return x * 13; }
+inline int f9183_14(int x) { return x * 14; }
+inline int f9183_15(int x) { return x * 15; }
+inline int f9183_16(int x) { return x * 16; }
+inline int f9183_17(int x) { return x * 17; }
+inline int f9183_18(int x) { return x * 18; }
+inline int f9183_19(int x) { return x * 19; }
+inline int f9183_20(int x) { return x * 20; }
+inline int f9183_21(int x) { return x * 21; }
+inline int f9183_22(int x) { return x * 22; }
+inline int f9183_23(int x) { return x * 23; }
+inline int f9183_24(int x) { return x * 24; }
+inline int f9183_25(int x) { return x * 25; }
+inline int f9183_26(int x) { return x * 26; }
+inline int f9183_27(int x) { return x * 27; }
+inline int f9183_28(int x) { return x * 28; }
+inline int f9183_29(int x) { return x * 29; }
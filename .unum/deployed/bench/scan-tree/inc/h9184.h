@@ -0,0 +1,42 @@
+#pragma once
+/* header 9184 */
+#include <vector>
+#include "h8619.h"
+#include "h6480.h"
+#include "h6104.h"
+#include "h3673.h"
+#include "h5297.h"
+#ifdef X
+#include "h3935.h"
+#endif
+struct S9184 { int a; const char *s = "x//y"; };
+inline int f9184_0(int x) { return x * 0; }
+inline int f9184_1(int x) { return x * 1; }
+inline int f9184_2(int x) { return x * 2; }
+inline int f9184_3(int x) { return x * 3; }
+inline int f9184_4(int x) { return x * 4; }
+inline int f9184_5(int x) { return x * 5; }
+inline int f9184_6(int x) { return x * 6; }
+inline int f9184_7(int x) { return x * 7; }
+inline int f9184_8(int x) { return x * 8; }
+inline int f9184_9(int x) { return x * 9; }
+inline int f9184_10(int x) { return x * 10; }
+inline int f9184_11(int x) { return x * 11; }
+inline int f9184_12(int x) { return x * 12; }
+inline int f9184_13(int x) { return x * 13; }
+inline int f9184_14(int x) { return x * 14; }
+inline int f9184_15(int x) { return x * 15; }
+inline int f9184_16(int x) { return x * 16; }
+inline int f9184_17(int x) { return x * 17; }
+inline int f9184_18(int x) { return x * 18; }
+inline int f9184_19(int x) { return x * 19; }
+inline int f9184_20(int x) { return x * 20; }
+inline int f9184_21(int x) { return x * 21; }
+inline int f9184_22(int x) { return x * 22; }
+inline int f9184_23(int x) { return x * 23; }
+inline int f9184_24(int x) { return x * 24; }
+inline int f9184_25(int x) { return x * 25; }
+inline int f9184_26(int x) { return x * 26; }
+inline int f9184_27(int x) { return x * 27; }
+inline int f9184_28(int x) { return x * 28; }
+inline int f9184_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9185 */
+#include <vector>
+#include "h2447.h"
+#include "h4405.h"
+#include "h2132.h"
+#include "h4988.h"
+#include "h2733.h"
+#ifdef X
+#include "h5507.h"
+#endif
+struct S9185 { int a; const char *s = "x//y"; };
+inline int f9185_0(int x) { return x * 0; }
+inline int f9185_1(int x) { return x * 1; }
+inline int f9185_2(int x) { return x * 2; }
+inline int f9185_3(int x) { return x * 3; }
+inline int f9185_4(int x) { return x * 4; }
+inline int f9185_5(int x) { return x * 5; }
+inline int f9185_6(int x) { return x * 6; }
+inline int f9185_7(int x) { return x * 7; }
+inline int f9185_8(int x) { return x * 8; }
+inline int f9185_9(int x) { return x * 9; }
+inline int f9185_10(int x) { return x * 10; }
+inline int f9185_11(int x) { return x * 11; }
+inline int f9185_12(int x) { return x * 12; }
+inline int f9185_13(int x) { return x * 13; }
+inline int f9185_14(int x) { return x * 14; }
+inline int f9185_15(int x) { return x * 15; }
+inline int f9185_16(int x) { return x * 16; }
+inline int f9185_17(int x) { return x * 17; }
+inline int f9185_18(int x) { return x * 18; }
+inline int f9185_19(int x) { return x * 19; }
+inline int f9185_20(int x) { return x * 20; }
+inline int f9185_21(int x) { return x * 21; }
+inline int f9185_22(int x) { return x * 22; }
+inline int f9185_23(int x) { return x * 23; }
+inline int f9185_24(int x) { return x * 24; }
+inline int f9185_25(int x) { return x * 25; }
+inline int f9185_26(int x) { return x * 26; }
+inline int f9185_27(int x) { return x * 27; }
+inline int f9185_28(int x) { return x * 28; }
+inline int f9185_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9186 */
+#include <vector>
+#include "h2395.h"
+#include "h7358.h"
+#include "h9952.h"
+#include "h2634.h"
+#include "h9914.h"
+#ifdef X
+#include "h8011.h"
+#endif
+struct S9186 { int a; const char *s = "x//y"; };
+inline int f9186_0(int x) { return x * 0; }
+inline int f9186_1(int x) { return x * 1; }
+inline int f9186_2(int x) { return x * 2; }
+inline int f9186_3(int x) { return x * 3; }
+inline int f9186_4(int x) { return x * 4; }
+inline int f9186_5(int x) { return x * 5; }
+inline int f9186_6(int x) { return x * 6; }
+inline int f9186_7(int x) { return x * 7; }
+inline int f9186_8(int x) { return x * 8; }
+inline int f9186_9(int x) { return x * 9; }
+inline int f9186_10(int x) { return x * 10; }
+inline int f9186_11(int x) { return x * 11; }
+inline int f9186_12(int x) { return x * 12; }
+inline int f9186_13(int x) { return x * 13; }
+inline int f9186_14(int x) { return x * 14; }
+inline int f9186_15(int x) { return x * 15; }
+inline int f9186_16(int x) { return x * 16; }
+inline int f9186_17(int x) { return x * 17; }
+inline int f9186_18(int x) { return x * 18; }
+inline int f9186_19(int x) { return x * 19; }
+inline int f9186_20(int x) { return x * 20; }
+inline int f9186_21(int x) { return x * 21; }
+inline int f9186_22(int x) { return x * 22; }
+inline int f9186_23(int x) { return x * 23; }
+inline int f9186_24(int x) { return x * 24; }
+inline int f9186_25(int x) { return x * 25; }
+inline int f9186_26(int x) { return x * 26; }
+inline int f9186_27(int x) { return x * 27; }
+inline int f9186_28(int x) { return x * 28; }
+inline int f9186_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9189 */
+#include <vector>
+#include "h7545.h"
+#include "h6483.h"
+#include "h3498.h"
+#include "h3155.h"
+#include "h4932.h"
+#ifdef X
+#include "h7087.h"
+#endif
+struct S9189 { int a; const char *s = "x//y"; };
+inline int f9189_0(int x) { return x * 0; }
+inline int f9189_1(int x) { return x * 1; }
+inline int f9189_2(int x) { return x * 2; }
+inline int f9189_3(int x) { return x * 3; }
+inline int f9189_4(int x) { return x * 4; }
+inline int f9189_5(int x) { return x * 5; }
+inline int f9189_6(int x) { return x * 6; }
+inline int f9189_7(int x) { return x * 7; }
+inline int f9189_8(int x) { return x * 8; }
+inline int f9189_9(int x) { return x * 9; }
+inline int f9189_10(int x) { return x * 10; }
+inline int f9189_11(int x) { return x * 11; }
+inline int f9189_12(int x) { return x * 12; }
+inline int f9189_13(int x) { return x * 13; }
+inline int f9189_14(int x) { return x * 14; }
+inline int f9189_15(int x) { return x * 15; }
+inline int f9189_16(int x) { return x * 16; }
+inline int f9189_17(int x) { return x * 17; }
+inline int f9189_18(int x) { return x * 18; }
+inline int f9189_19(int x) { return x * 19; }
+inline int f9189_20(int x) { return x * 20; }
+inline int f9189_21(int x) { return x * 21; }
+inline int f9189_22(int x) { return x * 22; }
+inline int f9189_23(int x) { return x * 23; }
+inline int f9189_24(int x) { return x * 24; }
+inline int f9189_25(int x) { return x * 25; }
+inline int f9189_26(int x) { return x * 26; }
+inline int f9189_27(int x) { return x * 27; }
+inline int f9189_28(int x) { return x * 28; }
+inline int f9189_29(int x) { return x * 29; }
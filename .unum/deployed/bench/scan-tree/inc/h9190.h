@@ -0,0 +1,42 @@
+#pragma once
+/* header 9190 */
+#include <vector>
+#include "h987.h"
+#include "h469.h"
+#include "h4777.h"
+#include "h5678.h"
+#include "h242.h"
+#ifdef X
+#include "h4405.h"
+#endif
+struct S9190 { int a; const char *s = "x//y"; };
+inline int f9190_0(int x) { return x * 0; }
+inline int f9190_1(int x) { return x * 1; }
+inline int f9190_2(int x) { return x * 2; }
+inline int f9190_3(int x) { return x * 3; }
+inline int f9190_4(int x) { return x * 4; }
+inline int f9190_5(int x) { return x * 5; }
+inline int f9190_6(int x) { return x * 6; }
+inline int f9190_7(int x) { return x * 7; }
+inline int f9190_8(int x) { return x * 8; }
+inline int f9190_9(int x) { return x * 9; }
+inline int f9190_10(int x) { return x * 10; }
+inline int f9190_11(int x) { return x * 11; }
+inline int f9190_12(int x) { return x * 12; }
+inline int f9190_13(int x) { return x * 13; }
+inline int f9190_14(int x) { return x * 14; }
+inline int f9190_15(int x) { return x * 15; }
+inline int f9190_16(int x) { return x * 16; }
+inline int f9190_17(int x) { return x * 17; }
+inline int f9190_18(int x) { return x * 18; }
+inline int f9190_19(int x) { return x * 19; }
+inline int f9190_20(int x) { return x * 20; }
+inline int f9190_21(int x) { return x * 21; }
+inline int f9190_22(int x) { return x * 22; }
+inline int f9190_23(int x) { return x * 23; }
+inline int f9190_24(int x) { return x * 24; }
+inline int f9190_25(int x) { return x * 25; }
+inline int f9190_26(int x) { return x * 26; }
+inline int f9190_27(int x) { return x * 27; }
+inline int f9190_28(int x) { return x * 28; }
+inline int f9190_29(int x) { return x * 29; }
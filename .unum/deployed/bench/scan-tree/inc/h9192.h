@@ -0,0 +1,42 @@
+#pragma once
+/* header 9192 */
+#include <vector>
+#include "h7032.h"
+#include "h2776.h"
+#include "h9524.h"
+#include "h4974.h"
+#include "h2295.h"
+#ifdef X
+#include "h8530.h"
+#endif
+struct S9192 { int a; const char *s = "x//y"; };
+inline int f9192_0(int x) { return x * 0; }
+inline int f9192_1(int x) { return x * 1; }
+inline int f9192_2(int x) { return x * 2; }
+inline int f9192_3(int x) { return x * 3; }
+inline int f9192_4(int x) { return x * 4; }
+inline int f9192_5(int x) { return x * 5; }
+inline int f9192_6(int x) { return x * 6; }
+inline int f9192_7(int x) { return x * 7; }
+inline int f9192_8(int x) { return x * 8; }
+inline int f9192_9(int x) { return x * 9; }
+inline int f9192_10(int x) { return x * 10; }
+inline int f9192_11(int x) { return x * 11; }
+inline int f9192_12(int x) { return x * 12; }
+inline int f9192_13(int x) { return x * 13; }
+inline int f9192_14(int x) { return x * 14; }
+inline int f9192_15(int x) { return x * 15; }
+inline int f9192_16(int x) { return x * 16; }
+inline int f9192_17(int x) { return x * 17; }
+inline int f9192_18(int x) { return x * 18; }
+inline int f9192_19(int x) { return x * 19; }
+inline int f9192_20(int x) { return x * 20; }
+inline int f9192_21(int x) { return x * 21; }
+inline int f9192_22(int x) { return x * 22; }
+inline int f9192_23(int x) { return x * 23; }
+inline int f9192_24(int x) { return x * 24; }
+inline int f9192_25(int x) { return x * 25; }
+inline int f9192_26(int x) { return x * 26; }
+inline int f9192_27(int x) { return x * 27; }
+inline int f9192_28(int x) { return x * 28; }
+inline int f9192_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9193 */
+#include <vector>
+#include "h943.h"
+#include "h3748.h"
+#include "h3262.h"
+#include "h1733.h"
+#include "h212.h"
+#ifdef X
+#include "h9004.h"
+#endif
+struct S9193 { int a; const char *s = "x//y"; };
+inline int f9193_0(int x) { return x * 0; }
+inline int f9193_1(int x) { return x * 1; }
+inline int f9193_2(int x) { return x * 2; }
+inline int f9193_3(int x) { return x * 3; }
+inline int f9193_4(int x) { return x * 4; }
+inline int f9193_5(int x) { return x * 5; }
+inline int f9193_6(int x) { return x * 6; }
+inline int f9193_7(int x) { return x * 7; }
+inline int f9193_8(int x) { return x * 8; }
+inline int f9193_9(int x) { return x * 9; }
+inline int f9193_10(int x) { return x * 10; }
+inline int f9193_11(int x) { return x * 11; }
+inline int f9193_12(int x) { return x * 12; }
+inline int f9193_13(int x) { return x * 13; }
+inline int f9193_14(int x) { return x * 14; }
+inline int f9193_15(int x) { return x * 15; }
+inline int f9193_16(int x) { return x * 16; }
+inline int f9193_17(int x) { return x * 17; }
+inline int f9193_18(int x) { return x * 18; }
+inline int f9193_19(int x) { return x * 19; }
+inline int f9193_20(int x) { return x * 20; }
+inline int f9193_21(int x) { return x * 21; }
+inline int f9193_22(int x) { return x * 22; }
+inline int f9193_23(int x) { return x * 23; }
+inline int f9193_24(int x) { return x * 24; }
+inline int f9193_25(int x) { return x * 25; }
+inline int f9193_26(int x) { return x * 26; }
+inline int f9193_27(int x) { return x * 27; }
+inline int f9193_28(int x) { return x * 28; }
+inline int f9193_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9195 */
+#include <vector>
+#include "h7038.h"
+#include "h8787.h"
+#include "h9756.h"
+#include "h8925.h"
+#include "h7038.h"
+#ifdef X
+#include "h8989.h"
+#endif
+struct S9195 { int a; const char *s = "x//y"; };
+inline int f9195_0(int x) { return x * 0; }
+inline int f9195_1(int x) { return x * 1; }
+inline int f9195_2(int x) { return x * 2; }
+inline int f9195_3(int x) { return x * 3; }
+inline int f9195_4(int x) { return x * 4; }
+inline int f9195_5(int x) { return x * 5; }
+inline int f9195_6(int x) { return x * 6; }
+inline int f9195_7(int x) { return x * 7; }
+inline int f9195_8(int x) { return x * 8; }
+inline int f9195_9(int x) { return x * 9; }
+inline int f9195_10(int x) { return x * 10; }
+inline int f9195_11(int x) { return x * 11; }
+inline int f9195_12(int x) { return x * 12; }
+inline int f9195_13(int x) { return x * 13; }
+inline int f9195_14(int x) { return x * 14; }
+inline int f9195_15(int x) { return x * 15; }
+inline int f9195_16(int x) { return x * 16; }
+inline int f9195_17(int x) { return x * 17; }
+inline int f9195_18(int x) { return x * 18; }
+inline int f9195_19(int x) { return x * 19; }
+inline int f9195_20(int x) { return x * 20; }
+inline int f9195_21(int x) { return x * 21; }
+inline int f9195_22(int x) { return x * 22; }
+inline int f9195_23(int x) { return x * 23; }
+inline int f9195_24(int x) { return x * 24; }
+inline int f9195_25(int x) { return x * 25; }
+inline int f9195_26(int x) { return x * 26; }
+inline int f9195_27(int x) { return x * 27; }
+inline int f9195_28(int x) { return x * 28; }
+inline int f9195_29(int x) { return x * 29; }
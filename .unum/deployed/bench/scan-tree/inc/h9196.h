@@ -0,0 +1,42 @@
+#pragma once
+/* header 9196 */
+#include <vector>
+#include "h2966.h"
+#include "h547.h"
+#include "h1694.h"
+#include "h8375.h"
+#include "h1949.h"
+#ifdef X
+#include "h7791.h"
+#endif
+struct S9196 { int a; const char *s = "x//y"; };
+inline int f9196_0(int x) { return x * 0; }
+inline int f9196_1(int x) { return x * 1; }
+inline int f9196_2(int x) { return x * 2; }
+inline int f9196_3(int x) { return x * 3; }
+inline int f9196_4(int x) { return x * 4; }
+inline int f9196_5(int x) { return x * 5; }
+inline int f9196_6(int x) { return x * 6; }
+inline int f9196_7(int x) { return x * 7; }
+inline int f9196_8(int x) { return x * 8; }
+inline int f9196_9(int x) { return x * 9; }
+inline int f9196_10(int x) { return x * 10; }
+inline int f9196_11(int x) { return x * 11; }
+inline int f9196_12(int x) { return x * 12; }
+inline int f9196_13(int x) { return x * 13; }
+inline int f9196_14(int x) { return x * 14; }
+inline int f9196_15(int x) { return x * 15; }
+inline int f9196_16(int x) { return x * 16; }
+inline int f9196_17(int x) { return x * 17; }
+inline int f9196_18(int x) { return x * 18; }
+inline int f9196_19(int x) { return x * 19; }
+inline int f9196_20(int x) { return x * 20; }
+inline int f9196_21(int x) { return x * 21; }
+inline int f9196_22(int x) { return x * 22; }
+inline int f9196_23(int x) { return x * 23; }
+inline int f9196_24(int x) { return x * 24; }
+inline int f9196_25(int x) { return x * 25; }
+inline int f9196_26(int x) { return x * 26; }
+inline int f9196_27(int x) { return x * 27; }
+inline int f9196_28(int x) { return x * 28; }
+inline int f9196_29(int x) { return x * 29; }
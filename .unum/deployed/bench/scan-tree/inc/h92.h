@@ -0,0 +1,42 @@
+#pragma once
+/* header 92 */
+#include <vector>
+#include "h1471.h"
+#include "h7569.h"
+#include "h6012.h"
+#include "h4269.h"
+#include "h9970.h"
+#ifdef X
+#include "h2377.h"
+#endif
+struct S92 { int a; const char *s = "x//y"; };
+inline int f92_0(int x) { return x * 0; }
+inline int f92_1(int x) { return x * 1; }
+inline int f92_2(int x) { return x * 2; }
+inline int f92_3(int x) { return x * 3; }
+inline int f92_4(int x) { return x * 4; }
+inline int f92_5(int x) { return x * 5; }
+inline int f92_6(int x) { return x * 6; }
+inline int f92_7(int x) { return x * 7; }
+inline int f92_8(int x) { return x * 8; }
+inline int f92_9(int x) { return x * 9; }
+inline int f92_10(int x) { return x * 10; }
+inline int f92_11(int x) { return x * 11; }
+inline int f92_12(int x) { return x * 12; }
+inline int f92_13(int x) { return x * 13; }
+inline int f92_14(int x) { return x * 14; }
+inline int f92_15(int x) { return x * 15; }
+inline int f92_16(int x) { return x * 16; }
+inline int f92_17(int x) { return x * 17; }
+inline int f92_18(int x) { return x * 18; }
+inline int f92_19(int x) { return x * 19; }
+inline int f92_20(int x) { return x * 20; }
+inline int f92_21(int x) { return x * 21; }
+inline int f92_22(int x) { return x * 22; }
+inline int f92_23(int x) { return x * 23; }
+inline int f92_24(int x) { return x * 24; }
+inline int f92_25(int x) { return x * 25; }
+inline int f92_26(int x) { return x * 26; }
+inline int f92_27(int x) { return x * 27; }
+inline int f92_28(int x) { return x * 28; }
+inline int f92_29(int x) { return x * 29; }
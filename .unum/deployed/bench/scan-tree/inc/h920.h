@@ -0,0 +1,42 @@
+#pragma once
+/* header 920 */
+#include <vector>
+#include "h5573.h"
+#include "h2304.h"
+#include "h9663.h"
+#include "h494.h"
+#include "h7043.h"
+#ifdef X
+#include "h9839.h"
+#endif
+struct S920 { int a; const char *s = "x//y"; };
+inline int f920_0(int x) { return x * 0; }
+inline int f920_1(int x) { return x * 1; }
+inline int f920_2(int x) { return x * 2; }
+inline int f920_3(int x) { return x * 3; }
+inline int f920_4(int x) { return x * 4; }
+inline int f920_5(int x) { return x * 5; }
+inline int f920_6(int x) { return x * 6; }
+inline int f920_7(int x) { return x * 7; }
+inline int f920_8(int x) { return x * 8; }
+inline int f920_9(int x) { return x * 9; }
+inline int f920_10(int x) { return x * 10; }
+inline int f920_11(int x) { return x * 11; }
+inline int f920_12(int x) { return x * 12; }
+inline int f920_13(int x) { return x * 13; }
+inline int f920_14(int x) { return x * 14; }
+inline int f920_15(int x) { return x * 15; }
+inline int f920_16(int x) { return x * 16; }
+inline int f920_17(int x) { return x * 17; }
+inline int f920_18(int x) { return x * 18; }
+inline int f920_19(int x) { return x * 19; }
+inline int f920_20(int x) { return x * 20; }
+inline int f920_21(int x) { return x * 21; }
+inline int f920_22(int x) { return x * 22; }
+inline int f920_23(int x) { return x * 23; }
+inline int f920_24(int x) { return x * 24; }
+inline int f920_25(int x) { return x * 25; }
+inline int f920_26(int x) { return x * 26; }
+inline int f920_27(int x) { return x * 27; }
+inline int f920_28(int x) { return x * 28; }
+inline int f920_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9200 */
+#include <vector>
+#include "h5301.h"
+#include "h5119.h"
+#include "h3462.h"
+#include "h6407.h"
+#include "h4991.h"
+#ifdef X
+#include "h8941.h"
+#endif
+struct S9200 { int a; const char *s = "x//y"; };
+inline int f9200_0(int x) { return x * 0; }
+inline int f9200_1(int x) { return x * 1; }
+inline int f9200_2(int x) { return x * 2; }
+inline int f9200_3(int x) { return x * 3; }
+inline int f9200_4(int x) { return x * 4; }
+inline int f9200_5(int x) { return x * 5; }
+inline int f9200_6(int x) { return x * 6; }
+inline int f9200_7(int x) { return x * 7; }
+inline int f9200_8(int x) { return x * 8; }
+inline int f9200_9(int x) { return x * 9; }
+inline int f9200_10(int x) { return x * 10; }
+inline int f9200_11(int x) { return x * 11; }
+inline int f9200_12(int x) { return x * 12; }
+inline int f9200_13(int x) { return x * 13; }
+inline int f9200_14(int x) { return x * 14; }
+inline int f9200_15(int x) { return x * 15; }
+inline int f9200_16(int x) { return x * 16; }
+inline int f9200_17(int x) { return x * 17; }
+inline int f9200_18(int x) { return x * 18; }
+inline int f9200_19(int x) { return x * 19; }
+inline int f9200_20(int x) { return x * 20; }
+inline int f9200_21(int x) { return x * 21; }
+inline int f9200_22(int x) { return x * 22; }
+inline int f9200_23(int x) { return x * 23; }
+inline int f9200_24(int x) { return x * 24; }
+inline int f9200_25(int x) { return x * 25; }
+inline int f9200_26(int x) { return x * 26; }
+inline int f9200_27(int x) { return x * 27; }
+inline int f9200_28(int x) { return x * 28; }
+inline int f9200_29(int x) { return x * 29; }
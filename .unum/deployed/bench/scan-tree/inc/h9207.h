@@ -0,0 +1,42 @@
+#pragma once
+/* header 9207 */
+#include <vector>
+#include "h4512.h"
+#include "h6254.h"
+#include "h970.h"
+#include "h6584.h"
+#include "h5070.h"
+#ifdef X
+#include "h6318.h"
+#endif
+struct S9207 { int a; const char *s = "x//y"; };
+inline int f9207_0(int x) { return x * 0; }
+inline int f9207_1(int x) { return x * 1; }
+inline int f9207_2(int x) { return x * 2; }
+inline int f9207_3(int x) { return x * 3; }
+inline int f9207_4(int x) { return x * 4; }
+inline int f9207_5(int x) { return x * 5; }
+inline int f9207_6(int x) { return x * 6; }
+inline int f9207_7(int x) { return x * 7; }
+inline int f9207_8(int x) { return x * 8; }
+inline int f9207_9(int x) { return x * 9; }
+inline int f9207_10(int x) { return x * 10; }
+inline int f9207_11(int x) { return x * 11; }
+inline int f9207_12(int x) { return x * 12; }
+inline int f9207_13(int x) { return x * 13; }
+inline int f9207_14(int x) { return x * 14; }
+inline int f9207_15(int x) { return x * 15; }
+inline int f9207_16(int x) { return x * 16; }
+inline int f9207_17(int x) { return x * 17; }
+inline int f9207_18(int x) { return x * 18; }
+inline int f9207_19(int x) { return x * 19; }
+inline int f9207_20(int x) { return x * 20; }
+inline int f9207_21(int x) { return x * 21; }
+inline int f9207_22(int x) { return x * 22; }
+inline int f9207_23(int x) { return x * 23; }
+inline int f9207_24(int x) { return x * 24; }
+inline int f9207_25(int x) { return x * 25; }
+inline int f9207_26(int x) { return x * 26; }
+inline int f9207_27(int x) { return x * 27; }
+inline int f9207_28(int x) { return x * 28; }
+inline int f9207_29(int x) { return x * 29; }
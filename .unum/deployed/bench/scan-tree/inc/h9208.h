@@ -0,0 +1,42 @@
+#pragma once
+/* header 9208 */
+#include <vector>
+#include "h3292.h"
+#include "h8784.h"
+#include "h8594.h"
+#include "h5056.h"
+#include "h7481.h"
+#ifdef X
+#include "h4261.h"
+#endif
+struct S9208 { int a; const char *s = "x//y"; };
+inline int f9208_0(int x) { return x * 0; }
+inline int f9208_1(int x) { return x * 1; }
+inline int f9208_2(int x) { return x * 2; }
+inline int f9208_3(int x) { return x * 3; }
+inline int f9208_4(int x) { return x * 4; }
+inline int f9208_5(int x) { return x * 5; }
+inline int f9208_6(int x) { return x * 6; }
+inline int f9208_7(int x) { return x * 7; }
+inline int f9208_8(int x) { return x * 8; }
+inline int f9208_9(int x) { return x * 9; }
+inline int f9208_10(int x) { return x * 10; }
+inline int f9208_11(int x) { return x * 11; }
+inline int f9208_12(int x) { return x * 12; }
+inline int f9208_13(int x) { return x * 13; }
+inline int f9208_14(int x) { return x * 14; }
+inline int f9208_15(int x) { return x * 15; }
+inline int f9208_16(int x) { return x * 16; }
+inline int f9208_17(int x) { return x * 17; }
+inline int f9208_18(int x) { return x * 18; }
+inline int f9208_19(int x) { return x * 19; }
+inline int f9208_20(int x) { return x * 20; }
+inline int f9208_21(int x) { return x * 21; }
+inline int f9208_22(int x) { return x * 22; }
+inline int f9208_23(int x) { return x * 23; }
+inline int f9208_24(int x) { return x * 24; }
+inline int f9208_25(int x) { return x * 25; }
+inline int f9208_26(int x) { return x * 26; }
+inline int f9208_27(int x) { return x * 27; }
+inline int f9208_28(int x) { return x * 28; }
+inline int f9208_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9211 */
+#include <vector>
+#include "h1793.h"
+#include "h5148.h"
+#include "h9022.h"
+#include "h1349.h"
+#include "h9566.h"
+#ifdef X
+#include "h6868.h"
+#endif
+struct S9211 { int a; const char *s = "x//y"; };
+inline int f9211_0(int x) { return x * 0; }
+inline int f9211_1(int x) { return x * 1; }
+inline int f9211_2(int x) { return x * 2; }
+inline int f9211_3(int x) { return x * 3; }
+inline int f9211_4(int x) { return x * 4; }
+inline int f9211_5(int x) { return x * 5; }
+inline int f9211_6(int x) { return x * 6; }
+inline int f9211_7(int x) { return x * 7; }
+inline int f9211_8(int x) { return x * 8; }
+inline int f9211_9(int x) { return x * 9; }
+inline int f9211_10(int x) { return x * 10; }
+inline int f9211_11(int x) { return x * 11; }
+inline int f9211_12(int x) { return x * 12; }
+inline int f9211_13(int x) { return x * 13; }
+inline int f9211_14(int x) { return x * 14; }
+inline int f9211_15(int x) { return x * 15; }
+inline int f9211_16(int x) { return x * 16; }
+inline int f9211_17(int x) { return x * 17; }
+inline int f9211_18(int x) { return x * 18; }
+inline int f9211_19(int x) { return x * 19; }
+inline int f9211_20(int x) { return x * 20; }
+inline int f9211_21(int x) { return x * 21; }
+inline int f9211_22(int x) { return x * 22; }
+inline int f9211_23(int x) { return x * 23; }
+inline int f9211_24(int x) { return x * 24; }
+inline int f9211_25(int x) { return x * 25; }
+inline int f9211_26(int x) { return x * 26; }
+inline int f9211_27(int x) { return x * 27; }
+inline int f9211_28(int x) { return x * 28; }
+inline int f9211_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9214 */
+#include <vector>
+#include "h867.h"
+#include "h4274.h"
+#include "h9050.h"
+#include "h4230.h"
+#include "h2551.h"
+#ifdef X
+#include "h4697.h"
+#endif
+struct S9214 { int a; const char *s = "x//y"; };
+inline int f9214_0(int x) { return x * 0; }
+inline int f9214_1(int x) { return x * 1; }
+inline int f9214_2(int x) { return x * 2; }
+inline int f9214_3(int x) { return x * 3; }
+inline int f9214_4(int x) { return x * 4; }
+inline int f9214_5(int x) { return x * 5; }
+inline int f9214_6(int x) { return x * 6; }
+inline int f9214_7(int x) { return x * 7; }
+inline int f9214_8(int x) { return x * 8; }
+inline int f9214_9(int x) { return x * 9; }
+inline int f9214_10(int x) { return x * 10; }
+inline int f9214_11(int x) { return x * 11; }
+inline int f9214_12(int x) { return x * 12; }
+inline int f9214_13(int x) { return x * 13; }
+inline int f9214_14(int x) { return x * 14; }
+inline int f9214_15(int x) { return x * 15; }
+inline int f9214_16(int x) { return x * 16; }
+inline int f9214_17(int x) { return x * 17; }
+inline int f9214_18(int x) { return x * 18; }
+inline int f9214_19(int x) { return x * 19; }
+inline int f9214_20(int x) { return x * 20; }
+inline int f9214_21(int x) { return x * 21; }
+inline int f9214_22(int x) { return x * 22; }
+inline int f9214_23(int x) { return x * 23; }
+inline int f9214_24(int x) { return x * 24; }
+inline int f9214_25(int x) { return x * 25; }
+inline int f9214_26(int x) { return x * 26; }
+inline int f9214_27(int x) { return x * 27; }
+inline int f9214_28(int x) { return x * 28; }
+inline int f9214_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9219 */
+#include <vector>
+#include "h11.h"
+#include "h9707.h"
+#include "h2362.h"
+#include "h9203.h"
+#include "h2240.h"
+#ifdef X
+#include "h6565.h"
+#endif
+struct S9219 { int a; const char *s = "x//y"; };
+inline int f9219_0(int x) { return x * 0; }
+inline int f9219_1(int x) { return x * 1; }
+inline int f9219_2(int x) { return x * 2; }
+inline int f9219_3(int x) { return x * 3; }
+inline int f9219_4(int x) { return x * 4; }
+inline int f9219_5(int x) { return x * 5; }
+inline int f9219_6(int x) { return x * 6; }
+inline int f9219_7(int x) { return x * 7; }
+inline int f9219_8(int x) { return x * 8; }
+inline int f9219_9(int x) { return x * 9; }
+inline int f9219_10(int x) { return x * 10; }
+inline int f9219_11(int x) { return x * 11; }
+inline int f9219_12(int x) { return x * 12; }
+inline int f9219_13(int x) { return x * 13; }
+inline int f9219_14(int x) { return x * 14; }
+inline int f9219_15(int x) { return x * 15; }
+inline int f9219_16(int x) { return x * 16; }
+inline int f9219_17(int x) { return x * 17; }
+inline int f9219_18(int x) { return x * 18; }
+inline int f9219_19(int x) { return x * 19; }
+inline int f9219_20(int x) { return x * 20; }
+inline int f9219_21(int x) { return x * 21; }
+inline int f9219_22(int x) { return x * 22; }
+inline int f9219_23(int x) { return x * 23; }
+inline int f9219_24(int x) { return x * 24; }
+inline int f9219_25(int x) { return x * 25; }
+inline int f9219_26(int x) { return x * 26; }
+inline int f9219_27(int x) { return x * 27; }
+inline int f9219_28(int x) { return x * 28; }
+inline int f9219_29(int x) { return x * 29; }
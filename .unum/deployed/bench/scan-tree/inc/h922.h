@@ -0,0 +1,42 @@
+#pragma once
+/* header 922 */
+#include <vector>
+#include "h8606.h"
+#include "h2249.h"
+#include "h8682.h"
+#include "h2599.h"
+#include "h4835.h"
+#ifdef X
+#include "h9383.h"
+#endif
+struct S922 { int a; const char *s = "x//y"; };
+inline int f922_0(int x) { return x * 0; }
+inline int f922_1(int x) { return x * 1; }
+inline int f922_2(int x) { return x * 2; }
+inline int f922_3(int x) { return x * 3; }
+inline int f922_4(int x) { return x * 4; }
+inline int f922_5(int x) { return x * 5; }
+inline int f922_6(int x) { return x * 6; }
+inline int f922_7(int x) { return x * 7; }
+inline int f922_8(int x) { return x * 8; }
+inline int f922_9(int x) { return x * 9; }
+inline int f922_10(int x) { return x * 10; }
+inline int f922_11(int x) { return x * 11; }
+inline int f922_12(int x) { return x * 12; }
+inline int f922_13(int x) { return x * 13; }
+inline int f922_14(int x) { return x * 14; }
+inline int f922_15(int x) { return x * 15; }
+inline int f922_16(int x) { return x * 16; }
+inline int f922_17(int x) { return x * 17; }
+inline int f922_18(int x) { return x * 18; }
+inline int f922_19(int x) { return x * 19; }
+inline int f922_20(int x) { return x * 20; }
+inline int f922_21(int x) { return x * 21; }
+inline int f922_22(int x) { return x * 22; }
+inline int f922_23(int x) { return x * 23; }
+inline int f922_24(int x) { return x * 24; }
+inline int f922_25(int x) { return x * 25; }
+inline int f922_26(int x) { return x * 26; }
+inline int f922_27(int x) { return x * 27; }
+inline int f922_28(int x) { return x * 28; }
+inline int f922_29(int x) { return x * 29; }
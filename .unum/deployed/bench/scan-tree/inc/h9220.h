@@ -0,0 +1,42 @@
+#pragma once
+/* header 9220 */
+#include <vector>
+#include "h7809.h"
+#include "h6227.h"
+#include "h29.h"
+#include "h812.h"
+#include "h4098.h"
+#ifdef X
+#include "h9432.h"
+#endif
+struct S9220 { int a; const char *s = "x//y"; };
+inline int f9220_0(int x) { return x * 0; }
+inline int f9220_1(int x) { return x * 1; }
+inline int f9220_2(int x) { return x * 2; }
+inline int f9220_3(int x) { return x * 3; }
+inline int f9220_4(int x) { return x * 4; }
+inline int f9220_5(int x) { return x * 5; }
+inline int f9220_6(int x) { return x * 6; }
+inline int f9220_7(int x) { return x * 7; }
+inline int f9220_8(int x) { return x * 8; }
+inline int f9220_9(int x) { return x * 9; }
+inline int f9220_10(int x) { return x * 10; }
+inline int f9220_11(int x) { return x * 11; }
+inline int f9220_12(int x) { return x * 12; }
+inline int f9220_13(int x) { return x * 13; }
+inline int f9220_14(int x) { return x * 14; }
+inline int f9220_15(int x) { return x * 15; }
+inline int f9220_16(int x) { return x * 16; }
+inline int f9220_17(int x) { return x * 17; }
+inline int f9220_18(int x) { return x * 18; }
+inline int f9220_19(int x) { return x * 19; }
+inline int f9220_20(int x) { return x * 20; }
+inline int f9220_21(int x) { return x * 21; }
+inline int f9220_22(int x) { return x * 22; }
+inline int f9220_23(int x) { return x * 23; }
+inline int f9220_24(int x) { return x * 24; }
+inline int f9220_25(int x) { return x * 25; }
+inline int f9220_26(int x) { return x * 26; }
+inline int f9220_27(int x) { return x * 27; }
+inline int f9220_28(int x) { return x * 28; }
+inline int f9220_29(int x) { return x * 29; }
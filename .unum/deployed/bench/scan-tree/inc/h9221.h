@@ -0,0 +1,42 @@
+#pragma once
+/* header 9221 */
+#include <vector>
+#include "h4864.h"
+#include "h5842.h"
+#include "h7600.h"
+#include "h9076.h"
+#include "h5654.h"
+#ifdef X
+#include "h2052.h"
+#endif
+struct S9221 { int a; const char *s = "x//y"; };
+inline int f9221_0(int x) { return x * 0; }
+inline int f9221_1(int x) { return x * 1; }
+inline int f9221_2(int x) { return x * 2; }
+inline int f9221_3(int x) { return x * 3; }
+inline int f9221_4(int x) { return x * 4; }
+inline int f9221_5(int x) { return x * 5; }
+inline int f9221_6(int x) { return x * 6; }
+inline int f9221_7(int x) { return x * 7; }
+inline int f9221_8(int x) { return x * 8; }
+inline int f9221_9(int x) { return x * 9; }
+inline int f9221_10(int x) { return x * 10; }
+inline int f9221_11(int x) { return x * 11; }
+inline int f9221_12(int x) { return x * 12; }
+inline int f9221_13(int x) { return x * 13; }
+inline int f9221_14(int x) { return x * 14; }
+inline int f9221_15(int x) { return x * 15; }
+inline int f9221_16(int x) { return x * 16; }
+inline int f9221_17(int x) { return x * 17; }
+inline int f9221_18(int x) { return x * 18; }
+inline int f9221_19(int x) { return x * 19; }
+inline int f9221_20(int x) { return x * 20; }
+inline int f9221_21(int x) { return x * 21; }
+inline int f9221_22(int x) { return x * 22; }
+inline int f9221_23(int x) { return x * 23; }
+inline int f9221_24(int x) { return x * 24; }
+inline int f9221_25(int x) { return x * 25; }
+inline int f9221_26(int x) { return x * 26; }
+inline int f9221_27(int x) { return x * 27; }
+inline int f9221_28(int x) { return x * 28; }
+inline int f9221_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9222 */
+#include <vector>
+#include "h1150.h"
+#include "h9073.h"
+#include "h2610.h"
+#include "h7732.h"
+#include "h6148.h"
+#ifdef X
+#include "h8403.h"
+#endif
+struct S9222 { int a; const char *s = "x//y"; };
+inline int f9222_0(int x) { return x * 0; }
+inline int f9222_1(int x) { return x * 1; }
+inline int f9222_2(int x) { return x * 2; }
+inline int f9222_3(int x) { return x * 3; }
+inline int f9222_4(int x) { return x * 4; }
+inline int f9222_5(int x) { return x * 5; }
+inline int f9222_6(int x) { return x * 6; }
+inline int f9222_7(int x) { return x * 7; }
+inline int f9222_8(int x) { return x * 8; }
+inline int f9222_9(int x) { return x * 9; }
+inline int f9222_10(int x) { return x * 10; }
+inline int f9222_11(int x) { return x * 11; }
+inline int f9222_12(int x) { return x * 12; }
+inline int f9222_13(int x) { return x * 13; }
+inline int f9222_14(int x) { return x * 14; }
+inline int f9222_15(int x) { return x * 15; }
+inline int f9222_16(int x) { return x * 16; }
+inline int f9222_17(int x) { return x * 17; }
+inline int f9222_18(int x) { return x * 18; }
+inline int f9222_19(int x) { return x * 19; }
+inline int f9222_20(int x) { return x * 20; }
+inline int f9222_21(int x) { return x * 21; }
+inline int f9222_22(int x) { return x * 22; }
+inline int f9222_23(int x) { return x * 23; }
+inline int f9222_24(int x) { return x * 24; }
+inline int f9222_25(int x) { return x * 25; }
+inline int f9222_26(int x) { return x * 26; }
+inline int f9222_27(int x) { return x * 27; }
+inline int f9222_28(int x) { return x * 28; }
+inline int f9222_29(int x) { return x * 29; }
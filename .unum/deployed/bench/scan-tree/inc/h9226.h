@@ -0,0 +1,42 @@
+#pragma once
+/* header 9226 */
+#include <vector>
+#include "h5150.h"
+#include "h3036.h"
+#include "h2522.h"
+#include "h9631.h"
+#include "h3406.h"
+#ifdef X
+#include "h274.h"
+#endif
+struct S9226 { int a; const char *s = "x//y"; };
+inline int f9226_0(int x) { return x * 0; }
+inline int f9226_1(int x) { return x * 1; }
+inline int f9226_2(int x) { return x * 2; }
+inline int f9226_3(int x) { return x * 3; }
+inline int f9226_4(int x) { return x * 4; }
+inline int f9226_5(int x) { return x * 5; }
+inline int f9226_6(int x) { return x * 6; }
+inline int f9226_7(int x) { return x * 7; }
+inline int f9226_8(int x) { return x * 8; }
+inline int f9226_9(int x) { return x * 9; }
+inline int f9226_10(int x) { return x * 10; }
+inline int f9226_11(int x) { return x * 11; }
+inline int f9226_12(int x) { return x * 12; }
+inline int f9226_13(int x) { return x * 13; }
+inline int f9226_14(int x) { return x * 14; }
+inline int f9226_15(int x) { return x * 15; }
+inline int f9226_16(int x) { return x * 16; }
+inline int f9226_17(int x) { return x * 17; }
+inline int f9226_18(int x) { return x * 18; }
+inline int f9226_19(int x) { return x * 19; }
+inline int f9226_20(int x) { return x * 20; }
+inline int f9226_21(int x) { return x * 21; }
+inline int f9226_22(int x) { return x * 22; }
+inline int f9226_23(int x) { return x * 23; }
+inline int f9226_24(int x) { return x * 24; }
+inline int f9226_25(int x) { return x * 25; }
+inline int f9226_26(int x) { return x * 26; }
+inline int f9226_27(int x) { return x * 27; }
+inline int f9226_28(int x) { return x * 28; }
+inline int f9226_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9228 */
+#include <vector>
+#include "h1311.h"
+#include "h3883.h"
+#include "h5697.h"
+#include "h6553.h"
+#include "h3330.h"
+#ifdef X
+#include "h6608.h"
+#endif
+struct S9228 { int a; const char *s = "x//y"; };
+inline int f9228_0(int x) { return x * 0; }
+inline int f9228_1(int x) { return x * 1; }
+inline int f9228_2(int x) { return x * 2; }
+inline int f9228_3(int x) { return x * 3; }
+inline int f9228_4(int x) { return x * 4; }
+inline int f9228_5(int x) { return x * 5; }
+inline int f9228_6(int x) { return x * 6; }
+inline int f9228_7(int x) { return x * 7; }
+inline int f9228_8(int x) { return x * 8; }
+inline int f9228_9(int x) { return x * 9; }
+inline int f9228_10(int x) { return x * 10; }
+inline int f9228_11(int x) { return x * 11; }
+inline int f9228_12(int x) { return x * 12; }
+inline int f9228_13(int x) { return x * 13; }
+inline int f9228_14(int x) { return x * 14; }
+inline int f9228_15(int x) { return x * 15; }
+inline int f9228_16(int x) { return x * 16; }
+inline int f9228_17(int x) { return x * 17; }
+inline int f9228_18(int x) { return x * 18; }
+inline int f9228_19(int x) { return x * 19; }
+inline int f9228_20(int x) { return x * 20; }
+inline int f9228_21(int x) { return x * 21; }
+inline int f9228_22(int x) { return x * 22; }
+inline int f9228_23(int x) { return x * 23; }
+inline int f9228_24(int x) { return x * 24; }
+inline int f9228_25(int x) { return x * 25; }
+inline int f9228_26(int x) { return x * 26; }
+inline int f9228_27(int x) { return x * 27; }
+inline int f9228_28(int x) { return x * 28; }
+inline int f9228_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9229 */
+#include <vector>
+#include "h652.h"
+#include "h9216.h"
+#include "h3389.h"
+#include "h6151.h"
+#include "h4684.h"
+#ifdef X
+#include "h4033.h"
+#endif
+struct S9229 { int a; const char *s = "x//y"; };
+inline int f9229_0(int x) { return x * 0; }
+inline int f9229_1(int x) { return x * 1; }
+inline int f9229_2(int x) { return x * 2; }
+inline int f9229_3(int x) { return x * 3; }
+inline int f9229_4(int x) { return x * 4; }
+inline int f9229_5(int x) { return x * 5; }
+inline int f9229_6(int x) { return x * 6; }
+inline int f9229_7(int x) { return x * 7; }
+inline int f9229_8(int x) { return x * 8; }
+inline int f9229_9(int x) { return x * 9; }
+inline int f9229_10(int x) { return x * 10; }
+inline int f9229_11(int x) { return x * 11; }
+inline int f9229_12(int x) { return x * 12; }
+inline int f9229_13(int x) { return x * 13; }
+inline int f9229_14(int x) { return x * 14; }
+inline int f9229_15(int x) { return x * 15; }
+inline int f9229_16(int x) { return x * 16; }
+inline int f9229_17(int x) { return x * 17; }
+inline int f9229_18(int x) { return x * 18; }
+inline int f9229_19(int x) { return x * 19; }
+inline int f9229_20(int x) { return x * 20; }
+inline int f9229_21(int x) { return x * 21; }
+inline int f9229_22(int x) { return x * 22; }
+inline int f9229_23(int x) { return x * 23; }
+inline int f9229_24(int x) { return x * 24; }
+inline int f9229_25(int x) { return x * 25; }
+inline int f9229_26(int x) { return x * 26; }
+inline int f9229_27(int x) { return x * 27; }
+inline int f9229_28(int x) { return x * 28; }
+inline int f9229_29(int x) { return x * 29; }
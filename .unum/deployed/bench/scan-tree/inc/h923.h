@@ -0,0 +1,42 @@
+#pragma once
+/* header 923 */
+#include <vector>
+#include "h2631.h"
+#include "h995.h"
+#include "h6008.h"
+#include "h782.h"
+#include "h4738.h"
+#ifdef X
+#include "h1762.h"
+#endif
+struct S923 { int a; const char *s = "x//y"; };
+inline int f923_0(int x) { return x * 0; }
+inline int f923_1(int x) { return x * 1; }
+inline int f923_2(int x) { return x * 2; }
+inline int f923_3(int x) { return x * 3; }
+inline int f923_4(int x) { return x * 4; }
+inline int f923_5(int x) { return x * 5; }
+inline int f923_6(int x) { return x * 6; }
+inline int f923_7(int x) { return x * 7; }
+inline int f923_8(int x) { return x * 8; }
+inline int f923_9(int x) { return x * 9; }
+inline int f923_10(int x) { return x * 10; }
+inline int f923_11(int x) { return x * 11; }
+inline int f923_12(int x) { return x * 12; }
+inline int f923_13(int x) { return x * 13; }
+inline int f923_14(int x) { return x * 14; }
+inline int f923_15(int x) { return x * 15; }
+inline int f923_16(int x) { return x * 16; }
+inline int f923_17(int x) { return x * 17; }
+inline int f923_18(int x) { return x * 18; }
+inline int f923_19(int x) { return x * 19; }
+inline int f923_20(int x) { return x * 20; }
+inline int f923_21(int x) { return x * 21; }
+inline int f923_22(int x) { return x * 22; }
+inline int f923_23(int x) { return x * 23; }
+inline int f923_24(int x) { return x * 24; }
+inline int f923_25(int x) { return x * 25; }
+inline int f923_26(int x) { return x * 26; }
+inline int f923_27(int x) { return x * 27; }
+inline int f923_28(int x) { return x * 28; }
+inline int f923_29(int x) { return x * 29; }
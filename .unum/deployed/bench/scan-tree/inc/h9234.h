@@ -0,0 +1,42 @@
+#pragma once
+/* header 9234 */
+#include <vector>
+#include "h4439.h"
+#include "h5235.h"
+#include "h7749.h"
+#include "h2490.h"
+#include "h1815.h"
+#ifdef X
+#include "h3623.h"
+#endif
+struct S9234 { int a; const char *s = "x//y"; };
+inline int f9234_0(int x) { return x * 0; }
+inline int f9234_1(int x) { return x * 1; }
+inline int f9234_2(int x) { return x * 2; }
+inline int f9234_3(int x) { return x * 3; }
+inline int f9234_4(int x) { return x * 4; }
+inline int f9234_5(int x) { return x * 5; }
+inline int f9234_6(int x) { return x * 6; }
+inline int f9234_7(int x) { return x * 7; }
+inline int f9234_8(int x) { return x * 8; }
+inline int f9234_9(int x) { return x * 9; }
+inline int f9234_10(int x) { return x * 10; }
+inline int f9234_11(int x) { return x * 11; }
+inline int f9234_12(int x) { return x * 12; }
+inline int f9234_13(int x) { return x * 13; }
+inline int f9234_14(int x) { return x * 14; }
+inline int f9234_15(int x) { return x * 15; }
+inline int f9234_16(int x) { return x * 16; }
+inline int f9234_17(int x) { return x * 17; }
+inline int f9234_18(int x) { return x * 18; }
+inline int f9234_19(int x) { return x * 19; }
+inline int f9234_20(int x) { return x * 20; }
+inline int f9234_21(int x) { return x * 21; }
+inline int f9234_22(int x) { return x * 22; }
+inline int f9234_23(int x) { return x * 23; }
+inline int f9234_24(int x) { return x * 24; }
+inline int f9234_25(int x) { return x * 25; }
+inline int f9234_26(int x) { return x * 26; }
+inline int f9234_27(int x) { return x * 27; }
+inline int f9234_28(int x) { return x * 28; }
+inline int f9234_29(int x) { return x * 29; }
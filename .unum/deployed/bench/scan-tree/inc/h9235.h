@@ -0,0 +1,42 @@
+#pragma once
+/* header 9235 */
+#include <vector>
+#include "h9390.h"
+#include "h6132.h"
+#include "h3363.h"
+#include "h2266.h"
+#include "h5534.h"
+#ifdef X
+#include "h3274.h"
+#endif
+struct S9235 { int a; const char *s = "x//y"; };
+inline int f9235_0(int x) { return x * 0; }
+inline int f9235_1(int x) { return x * 1; }
+inline int f9235_2(int x) { return x * 2; }
+inline int f9235_3(int x) { return x * 3; }
+inline int f9235_4(int x) { return x * 4; }
+inline int f9235_5(int x) { return x * 5; }
+inline int f9235_6(int x) { return x * 6; }
+inline int f9235_7(int x) { return x * 7; }
+inline int f9235_8(int x) { return x * 8; }
+inline int f9235_9(int x) { return x * 9; }
+inline int f9235_10(int x) { return x * 10; }
+inline int f9235_11(int x) { return x * 11; }
+inline int f9235_12(int x) { return x * 12; }
+inline int f9235_13(int x) { return x * 13; }
+inline int f9235_14(int x) { return x * 14; }
+inline int f9235_15(int x) { return x * 15; }
+inline int f9235_16(int x) { return x * 16; }
+inline int f9235_17(int x) { return x * 17; }
+inline int f9235_18(int x) { return x * 18; }
+inline int f9235_19(int x) { return x * 19; }
+inline int f9235_20(int x) { return x * 20; }
+inline int f9235_21(int x) { return x * 21; }
+inline int f9235_22(int x) { return x * 22; }
+inline int f9235_23(int x) { return x * 23; }
+inline int f9235_24(int x) { return x * 24; }
+inline int f9235_25(int x) { return x * 25; }
+inline int f9235_26(int x) { return x * 26; }
+inline int f9235_27(int x) { return x * 27; }
+inline int f9235_28(int x) { return x * 28; }
+inline int f9235_29(int x) { return x * 29; }
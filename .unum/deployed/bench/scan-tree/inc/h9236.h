@@ -0,0 +1,42 @@
+#pragma once
+/* header 9236 */
+#include <vector>
+#include "h4702.h"
+#include "h6034.h"
+#include "h2892.h"
+#include "h5855.h"
+#include "h5562.h"
+#ifdef X
+#include "h3978.h"
+#endif
+struct S9236 { int a; const char *s = "x//y"; };
+inline int f9236_0(int x) { return x * 0; }
+inline int f9236_1(int x) { return x * 1; }
+inline int f9236_2(int x) { return x * 2; }
+inline int f9236_3(int x) { return x * 3; }
+inline int f9236_4(int x) { return x * 4; }
+inline int f9236_5(int x) { return x * 5; }
+inline int f9236_6(int x) { return x * 6; }
+inline int f9236_7(int x) { return x * 7; }
+inline int f9236_8(int x) { return x * 8; }
+inline int f9236_9(int x) { return x * 9; }
+inline int f9236_10(int x) { return x * 10; }
+inline int f9236_11(int x) { return x * 11; }
+inline int f9236_12(int x) { return x * 12; }
+inline int f9236_13(int x) { return x * 13; }
+inline int f9236_14(int x) { return x * 14; }
+inline int f9236_15(int x) { return x * 15; }
+inline int f9236_16(int x) { return x * 16; }
+inline int f9236_17(int x) { return x * 17; }
+inline int f9236_18(int x) { return x * 18; }
+inline int f9236_19(int x) { return x * 19; }
+inline int f9236_20(int x) { return x * 20; }
+inline int f9236_21(int x) { return x * 21; }
+inline int f9236_22(int x) { return x * 22; }
+inline int f9236_23(int x) { return x * 23; }
+inline int f9236_24(int x) { return x * 24; }
+inline int f9236_25(int x) { return x * 25; }
+inline int f9236_26(int x) { return x * 26; }
+inline int f9236_27(int x) { return x * 27; }
+inline int f9236_28(int x) { return x * 28; }
+inline int f9236_29(int x) { return x * 29; }
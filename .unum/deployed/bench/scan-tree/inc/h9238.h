@@ -0,0 +1,42 @@
+#pragma once
+/* header 9238 */
+#include <vector>
+#include "h7265.h"
+#include "h3842.h"
+#include "h793.h"
+#include "h6142.h"
+#include "h4011.h"
+#ifdef X
+#include "h8991.h"
+#endif
+struct S9238 { int a; const char *s = "x//y"; };
+inline int f9238_0(int x) { return x * 0; }
+inline int f9238_1(int x) { return x * 1; }
+inline int f9238_2(int x) { return x * 2; }
+inline int f9238_3(int x) { return x * 3; }
+inline int f9238_4(int x) { return x * 4; }
+inline int f9238_5(int x) { return x * 5; }
+inline int f9238_6(int x) { return x * 6; }
+inline int f9238_7(int x) { return x * 7; }
+inline int f9238_8(int x) { return x * 8; }
+inline int f9238_9(int x) { return x * 9; }
+inline int f9238_10(int x) { return x * 10; }
+inline int f9238_11(int x) { return x * 11; }
+inline int f9238_12(int x) { return x * 12; }
+inline int f9238_13(int x) { return x * 13; }
+inline int f9238_14(int x) { return x * 14; }
+inline int f9238_15(int x) { return x * 15; }
+inline int f9238_16(int x) { return x * 16; }
+inline int f9238_17(int x) { return x * 17; }
+inline int f9238_18(int x) { return x * 18; }
+inline int f9238_19(int x) { return x * 19; }
+inline int f9238_20(int x) { return x * 20; }
+inline int f9238_21(int x) { return x * 21; }
+inline int f9238_22(int x) { return x * 22; }
+inline int f9238_23(int x) { return x * 23; }
+inline int f9238_24(int x) { return x * 24; }
+inline int f9238_25(int x) { return x * 25; }
+inline int f9238_26(int x) { return x * 26; }
+inline int f9238_27(int x) { return x * 27; }
+inline int f9238_28(int x) { return x * 28; }
+inline int f9238_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9239 */
+#include <vector>
+#include "h3377.h"
+#include "h8841.h"
+#include "h6195.h"
+#include "h9125.h"
+#include "h9137.h"
+#ifdef X
+#include "h8182.h"
+#endif
+struct S9239 { int a; const char *s = "x//y"; };
+inline int f9239_0(int x) { return x * 0; }
+inline int f9239_1(int x) { return x * 1; }
+inline int f9239_2(int x) { return x * 2; }
+inline int f9239_3(int x) { return x * 3; }
+inline int f9239_4(int x) { return x * 4; }
+inline int f9239_5(int x) { return x * 5; }
+inline int f9239_6(int x) { return x * 6; }
+inline int f9239_7(int x) { return x * 7; }
+inline int f9239_8(int x) { return x * 8; }
+inline int f9239_9(int x) { return x * 9; }
+inline int f9239_10(int x) { return x * 10; }
+inline int f9239_11(int x) { return x * 11; }
+inline int f9239_12(int x) { return x * 12; }
+inline int f9239_13(int x) { return x * 13; }
+inline int f9239_14(int x) { return x * 14; }
+inline int f9239_15(int x) { return x * 15; }
+inline int f9239_16(int x) { return x * 16; }
+inline int f9239_17(int x) { return x * 17; }
+inline int f9239_18(int x) { return x * 18; }
+inline int f9239_19(int x) { return x * 19; }
+inline int f9239_20(int x) { return x * 20; }
+inline int f9239_21(int x) { return x * 21; }
+inline int f9239_22(int x) { return x * 22; }
+inline int f9239_23(int x) { return x * 23; }
+inline int f9239_24(int x) { return x * 24; }
+inline int f9239_25(int x) { return x * 25; }
+inline int f9239_26(int x) { return x * 26; }
+inline int f9239_27(int x) { return x * 27; }
+inline int f9239_28(int x) { return x * 28; }
+inline int f9239_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9240 */
+#include <vector>
+#include "h6289.h"
+#include "h5760.h"
+#include "h9760.h"
+#include "h5015.h"
+#include "h1089.h"
+#ifdef X
+#include "h286.h"
+#endif
+struct S9240 { int a; const char *s = "x//y"; };
+inline int f9240_0(int x) { return x * 0; }
+inline int f9240_1(int x) { return x * 1; }
+inline int f9240_2(int x) { return x * 2; }
+inline int f9240_3(int x) { return x * 3; }
+inline int f9240_4(int x) { return x * 4; }
+inline int f9240_5(int x) { return x * 5; }
+inline int f9240_6(int x) { return x * 6; }
+inline int f9240_7(int x) { return x * 7; }
+inline int f9240_8(int x) { return x * 8; }
+inline int f9240_9(int x) { return x * 9; }
+inline int f9240_10(int x) { return x * 10; }
+inline int f9240_11(int x) { return x * 11; }
+inline int f9240_12(int x) { return x * 12; }
+inline int f9240_13(int x) { return x * 13; }
+inline int f9240_14(int x) { return x * 14; }
+inline int f9240_15(int x) { return x * 15; }
+inline int f9240_16(int x) { return x * 16; }
+inline int f9240_17(int x) { return x * 17; }
+inline int f9240_18(int x) { return x * 18; }
+inline int f9240_19(int x) { return x * 19; }
+inline int f9240_20(int x) { return x * 20; }
+inline int f9240_21(int x) { return x * 21; }
+inline int f9240_22(int x) { return x * 22; }
+inline int f9240_23(int x) { return x * 23; }
+inline int f9240_24(int x) { return x * 24; }
+inline int f9240_25(int x) { return x * 25; }
+inline int f9240_26(int x) { return x * 26; }
+inline int f9240_27(int x) { return x * 27; }
+inline int f9240_28(int x) { return x * 28; }
+inline int f9240_29(int x) { return x * 29; }
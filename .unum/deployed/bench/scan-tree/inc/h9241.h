@@ -0,0 +1,42 @@
+#pragma once
+/* header 9241 */
+#include <vector>
+#include "h2532.h"
+#include "h2407.h"
+#include "h8489.h"
+#include "h8894.h"
+#include "h6089.h"
+#ifdef X
+#include "h6455.h"
+#endif
+struct S9241 { int a; const char *s = "x//y"; };
+inline int f9241_0(int x) { return x * 0; }
+inline int f9241_1(int x) { return x * 1; }
+inline int f9241_2(int x) { return x * 2; }
+inline int f9241_3(int x) { return x * 3; }
+inline int f9241_4(int x) { return x * 4; }
+inline int f9241_5(int x) { return x * 5; }
+inline int f9241_6(int x) { return x * 6; }
+inline int f9241_7(int x) { return x * 7; }
+inline int f9241_8(int x) { return x * 8; }
+inline int f9241_9(int x) { return x * 9; }
+inline int f9241_10(int x) { return x * 10; }
+inline int f9241_11(int x) { return x * 11; }
+inline int f9241_12(int x) { return x * 12; }
+inline int f9241_13(int x) { return x * 13; }
+inline int f9241_14(int x) { return x * 14; }
+inline int f9241_15(int x) { return x * 15; }
+inline int f9241_16(int x) { return x * 16; }
+inline int f9241_17(int x) { return x * 17; }
+inline int f9241_18(int x) { return x * 18; }
+inline int f9241_19(int x) { return x * 19; }
+inline int f9241_20(int x) { return x * 20; }
+inline int f9241_21(int x) { return x * 21; }
+inline int f9241_22(int x) { return x * 22; }
+inline int f9241_23(int x) { return x * 23; }
+inline int f9241_24(int x) { return x * 24; }
+inline int f9241_25(int x) { return x * 25; }
+inline int f9241_26(int x) { return x * 26; }
+inline int f9241_27(int x) { return x * 27; }
+inline int f9241_28(int x) { return x * 28; }
+inline int f9241_29(int x) { return x * 29; }
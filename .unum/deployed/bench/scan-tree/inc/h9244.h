@@ -0,0 +1,42 @@
+#pragma once
+/* header 9244 */
+#include <vector>
+#include "h4494.h"
+#include "h2236.h"
+#include "h6910.h"
+#include "h9865.h"
+#include "h3803.h"
+#ifdef X
+#include "h8356.h"
+#endif
+struct S9244 { int a; const char *s = "x//y"; };
+inline int f9244_0(int x) { return x * 0; }
+inline int f9244_1(int x) { return x * 1; }
+inline int f9244_2(int x) { return x * 2; }
+inline int f9244_3(int x) { return x * 3; }
+inline int f9244_4(int x) { return x * 4; }
+inline int f9244_5(int x) { return x * 5; }
+inline int f9244_6(int x) { return x * 6; }
+inline int f9244_7(int x) { return x * 7; }
+inline int f9244_8(int x) { return x * 8; }
+inline int f9244_9(int x) { return x * 9; }
+inline int f9244_10(int x) { return x * 10; }
+inline int f9244_11(int x) { return x * 11; }
+inline int f9244_12(int x) { return x * 12; }
+inline int f9244_13(int x) { return x * 13; }
+inline int f9244_14(int x) { return x * 14; }
+inline int f9244_15(int x) { return x * 15; }
+inline int f9244_16(int x) { return x * 16; }
+inline int f9244_17(int x) { return x * 17; }
+inline int f9244_18(int x) { return x * 18; }
+inline int f9244_19(int x) { return x * 19; }
+inline int f9244_20(int x) { return x * 20; }
+inline int f9244_21(int x) { return x * 21; }
+inline int f9244_22(int x) { return x * 22; }
+inline int f9244_23(int x) { return x * 23; }
+inline int f9244_24(int x) { return x * 24; }
+inline int f9244_25(int x) { return x * 25; }
+inline int f9244_26(int x) { return x * 26; }
+inline int f9244_27(int x) { return x * 27; }
+inline int f9244_28(int x) { return x * 28; }
+inline int f9244_29(int x) { return x * 29; }
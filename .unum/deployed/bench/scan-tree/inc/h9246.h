@@ -0,0 +1,42 @@
+#pragma once
+/* header 9246 */
+#include <vector>
+#include "h574.h"
+#include "h5234.h"
+#include "h5298.h"
+#include "h5394.h"
+#include "h1980.h"
+#ifdef X
+#include "h4233.h"
+#endif
+struct S9246 { int a; const char *s = "x//y"; };
+inline int f9246_0(int x) { return x * 0; }
+inline int f9246_1(int x) { return x * 1; }
+inline int f9246_2(int x) { return x * 2; }
+inline int f9246_3(int x) { return x * 3; }
+inline int f9246_4(int x) { return x * 4; }
+inline int f9246_5(int x) { return x * 5; }
+inline int f9246_6(int x) { return x * 6; }
+inline int f9246_7(int x) { return x * 7; }
+inline int f9246_8(int x) { return x * 8; }
+inline int f9246_9(int x) { return x * 9; }
+inline int f9246_10(int x) { return x * 10; }
+inline int f9246_11(int x) { return x * 11; }
+inline int f9246_12(int x) { return x * 12; }
+inline int f9246_13(int x) { return x * 13; }
+inline int f9246_14(int x) { return x * 14; }
+inline int f9246_15(int x) { return x * 15; }
+inline int f9246_16(int x) { return x * 16; }
+inline int f9246_17(int x) { return x * 17; }
+inline int f9246_18(int x) { return x * 18; }
+inline int f9246_19(int x) { return x * 19; }
+inline int f9246_20(int x) { return x * 20; }
+inline int f9246_21(int x) { return x * 21; }
+inline int f9246_22(int x) { return x * 22; }
+inline int f9246_23(int x) { return x * 23; }
+inline int f9246_24(int x) { return x * 24; }
+inline int f9246_25(int x) { return x * 25; }
+inline int f9246_26(int x) { return x * 26; }
+inline int f9246_27(int x) { return x * 27; }
+inline int f9246_28(int x) { return x * 28; }
+inline int f9246_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9247 */
+#include <vector>
+#include "h5397.h"
+#include "h6239.h"
+#include "h5276.h"
+#include "h8122.h"
+#include "h2147.h"
+#ifdef X
+#include "h5146.h"
+#endif
+struct S9247 { int a; const char *s = "x//y"; };
+inline int f9247_0(int x) { return x * 0; }
+inline int f9247_1(int x) { return x * 1; }
+inline int f9247_2(int x) { return x * 2; }
+inline int f9247_3(int x) { return x * 3; }
+inline int f9247_4(int x) { return x * 4; }
+inline int f9247_5(int x) { return x * 5; }
+inline int f9247_6(int x) { return x * 6; }
+inline int f9247_7(int x) { return x * 7; }
+inline int f9247_8(int x) { return x * 8; }
+inline int f9247_9(int x) { return x * 9; }
+inline int f9247_10(int x) { return x * 10; }
+inline int f9247_11(int x) { return x * 11; }
+inline int f9247_12(int x) { return x * 12; }
+inline int f9247_13(int x) { return x * 13; }
+inline int f9247_14(int x) { return x * 14; }
+inline int f9247_15(int x) { return x * 15; }
+inline int f9247_16(int x) { return x * 16; }
+inline int f9247_17(int x) { return x * 17; }
+inline int f9247_18(int x) { return x * 18; }
+inline int f9247_19(int x) { return x * 19; }
+inline int f9247_20(int x) { return x * 20; }
+inline int f9247_21(int x) { return x * 21; }
+inline int f9247_22(int x) { return x * 22; }
+inline int f9247_23(int x) { return x * 23; }
+inline int f9247_24(int x) { return x * 24; }
+inline int f9247_25(int x) { return x * 25; }
+inline int f9247_26(int x) { return x * 26; }
+inline int f9247_27(int x) { return x * 27; }
+inline int f9247_28(int x) { return x * 28; }
+inline int f9247_29(int x) { return x * 29; }
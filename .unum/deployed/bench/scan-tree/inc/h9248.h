@@ -0,0 +1,42 @@
+#pragma once
+/* header 9248 */
+#include <vector>
+#include "h4264.h"
+#include "h4904.h"
+#include "h7015.h"
+#include "h7871.h"
+#include "h9154.h"
+#ifdef X
+#include "h1944.h"
+#endif
+struct S9248 { int a; const char *s = "x//y"; };
+inline int f9248_0(int x) { return x * 0; }
+inline int f9248_1(int x) { return x * 1; }
+inline int f9248_2(int x) { return x * 2; }
+inline int f9248_3(int x) { return x * 3; }
+inline int f9248_4(int x) { return x * 4; }
+inline int f9248_5(int x) { return x * 5; }
+inline int f9248_6(int x) { return x * 6; }
+inline int f9248_7(int x) { return x * 7; }
+inline int f9248_8(int x) { return x * 8; }
+inline int f9248_9(int x) { return x * 9; }
+inline int f9248_10(int x) { return x * 10; }
+inline int f9248_11(int x) { return x * 11; }
+inline int f9248_12(int x) { return x * 12; }
+inline int f9248_13(int x) { return x * 13; }
+inline int f9248_14(int x) { return x * 14; }
+inline int f9248_15(int x) { return x * 15; }
+inline int f9248_16(int x) { return x * 16; }
+inline int f9248_17(int x) { return x * 17; }
+inline int f9248_18(int x) { return x * 18; }
+inline int f9248_19(int x) { return x * 19; }
+inline int f9248_20(int x) { return x * 20; }
+inline int f9248_21(int x) { return x * 21; }
+inline int f9248_22(int x) { return x * 22; }
+inline int f9248_23(int x) { return x * 23; }
+inline int f9248_24(int x) { return x * 24; }
+inline int f9248_25(int x) { return x * 25; }
+inline int f9248_26(int x) { return x * 26; }
+inline int f9248_27(int x) { return x * 27; }
+inline int f9248_28(int x) { return x * 28; }
+inline int f9248_29(int x) { return x * 29; }
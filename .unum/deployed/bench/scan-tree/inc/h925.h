@@ -0,0 +1,42 @@
+#pragma once
+/* header 925 */
+#include <vector>
+#include "h510.h"
+#include "h9751.h"
+#include "h8838.h"
+#include "h21.h"
+#include "h9756.h"
+#ifdef X
+#include "h1182.h"
+#endif
+struct S925 { int a; const char *s = "x//y"; };
+inline int f925_0(int x) { return x * 0; }
+inline int f925_1(int x) { return x * 1; }
+inline int f925_2(int x) { return x * 2; }
+inline int f925_3(int x) { return x * 3; }
+inline int f925_4(int x) { return x * 4; }
+inline int f925_5(int x) { return x * 5; }
+inline int f925_6(int x) { return x * 6; }
+inline int f925_7(int x) { return x * 7; }
+inline int f925_8(int x) { return x * 8; }
+inline int f925_9(int x) { return x * 9; }
+inline int f925_10(int x) { return x * 10; }
+inline int f925_11(int x) { return x * 11; }
+inline int f925_12(int x) { return x * 12; }
+inline int f925_13(int x) { return x * 13; }
+inline int f925_14(int x) { return x * 14; }
+inline int f925_15(int x) { return x * 15; }
+inline int f925_16(int x) { return x * 16; }
+inline int f925_17(int x) { return x * 17; }
+inline int f925_18(int x) { return x * 18; }
+inline int f925_19(int x) { return x * 19; }
+inline int f925_20(int x) { return x * 20; }
+inline int f925_21(int x) { return x * 21; }
+inline int f925_22(int x) { return x * 22; }
+inline int f925_23(int x) { return x * 23; }
+inline int f925_24(int x) { return x * 24; }
+inline int f925_25(int x) { return x * 25; }
+inline int f925_26(int x) { return x * 26; }
+inline int f925_27(int x) { return x * 27; }
+inline int f925_28(int x) { return x * 28; }
+inline int f925_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9253 */
+#include <vector>
+#include "h7402.h"
+#include "h4505.h"
+#include "h6139.h"
+#include "h981.h"
+#include "h1081.h"
+#ifdef X
+#include "h1277.h"
+#endif
+struct S9253 { int a; const char *s = "x//y"; };
+inline int f9253_0(int x) { return x * 0; }
+inline int f9253_1(int x) { return x * 1; }
+inline int f9253_2(int x) { return x * 2; }
+inline int f9253_3(int x) { return x * 3; }
+inline int f9253_4(int x) { return x * 4; }
+inline int f9253_5(int x) { return x * 5; }
+inline int f9253_6(int x) { return x * 6; }
+inline int f9253_7(int x) { return x * 7; }
+inline int f9253_8(int x) { return x * 8; }
+inline int f9253_9(int x) { return x * 9; }
+inline int f9253_10(int x) { return x * 10; }
+inline int f9253_11(int x) { return x * 11; }
+inline int f9253_12(int x) { return x * 12; }
+inline int f9253_13(int x) { return x * 13; }
+inline int f9253_14(int x) { return x * 14; }
+inline int f9253_15(int x) { return x * 15; }
+inline int f9253_16(int x) { return x * 16; }
+inline int f9253_17(int x) { return x * 17; }
+inline int f9253_18(int x) { return x * 18; }
+inline int f9253_19(int x) { return x * 19; }
+inline int f9253_20(int x) { return x * 20; }
+inline int f9253_21(int x) { return x * 21; }
+inline int f9253_22(int x) { return x * 22; }
+inline int f9253_23(int x) { return x * 23; }
+inline int f9253_24(int x) { return x * 24; }
+inline int f9253_25(int x) { return x * 25; }
+inline int f9253_26(int x) { return x * 26; }
+inline int f9253_27(int x) { return x * 27; }
+inline int f9253_28(int x) { return x * 28; }
+inline int f9253_29(int x) { return x * 29; }
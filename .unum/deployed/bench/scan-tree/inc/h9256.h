@@ -0,0 +1,42 @@
+#pragma once
+/* header 9256 */
+#include <vector>
+#include "h4089.h"
+#include "h8348.h"
+#include "h826.h"
+#include "h4481.h"
+#include "h5387.h"
+#ifdef X
+#include "h482.h"
+#endif
+struct S9256 { int a; const char *s = "x//y"; };
+inline int f9256_0(int x) { return x * 0; }
+inline int f9256_1(int x) { return x * 1; }
+inline int f9256_2(int x) { return x * 2; }
+inline int f9256_3(int x) { return x * 3; }
+inline int f9256_4(int x) { return x * 4; }
+inline int f9256_5(int x) { return x * 5; }
+inline int f9256_6(int x) { return x * 6; }
+inline int f9256_7(int x) { return x * 7; }
+inline int f9256_8(int x) { return x * 8; }
+inline int f9256_9(int x) { return x * 9; }
+inline int f9256_10(int x) { return x * 10; }
+inline int f9256_11(int x) { return x * 11; }
+inline int f9256_12(int x) { return x * 12; }
+inline int f9256_13(int x) { return x * 13; }
+inline int f9256_14(int x) { return x * 14; }
+inline int f9256_15(int x) { return x * 15; }
+inline int f9256_16(int x) { return x * 16; }
+inline int f9256_17(int x) { return x * 17; }
+inline int f9256_18(int x) { return x * 18; }
+inline int f9256_19(int x) { return x * 19; }
+inline int f9256_20(int x) { return x * 20; }
+inline int f9256_21(int x) { return x * 21; }
+inline int f9256_22(int x) { return x * 22; }
+inline int f9256_23(int x) { return x * 23; }
+inline int f9256_24(int x) { return x * 24; }
+inline int f9256_25(int x) { return x * 25; }
+inline int f9256_26(int x) { return x * 26; }
+inline int f9256_27(int x) { return x * 27; }
+inline int f9256_28(int x) { return x * 28; }
+inline int f9256_29(int x) { return x * 29; }
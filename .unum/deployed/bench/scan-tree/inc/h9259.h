@@ -0,0 +1,42 @@
+#pragma once
+/* header 9259 */
+#include <vector>
+#include "h6736.h"
+#include "h1608.h"
+#include "h4590.h"
+#include "h7955.h"
+#include "h2172.h"
+#ifdef X
+#include "h3174.h"
+#endif
+struct S9259 { int a; const char *s = "x//y"; };
+inline int f9259_0(int x) { return x * 0; }
+inline int f9259_1(int x) { return x * 1; }
+inline int f9259_2(int x) { return x * 2; }
+inline int f9259_3(int x) { return x * 3; }
+inline int f9259_4(int x) { return x * 4; }
+inline int f9259_5(int x) { return x * 5; }
+inline int f9259_6(int x) { return x * 6; }
+inline int f9259_7(int x) { return x * 7; }
+inline int f9259_8(int x) { return x * 8; }
+inline int f9259_9(int x) { return x * 9; }
+inline int f9259_10(int x) { return x * 10; }
+inline int f9259_11(int x) { return x * 11; }
+inline int f9259_12(int x) { return x * 12; }
+inline int f9259_13(int x) { return x * 13; }
+inline int f9259_14(int x) { return x * 14; }
+inline int f9259_15(int x) { return x * 15; }
+inline int f9259_16(int x) { return x * 16; }
+inline int f9259_17(int x) { return x * 17; }
+inline int f9259_18(int x) { return x * 18; }
+inline int f9259_19(int x) { return x * 19; }
+inline int f9259_20(int x) { return x * 20; }
+inline int f9259_21(int x) { return x * 21; }
+inline int f9259_22(int x) { return x * 22; }
+inline int f9259_23(int x) { return x * 23; }
+inline int f9259_24(int x) { return x * 24; }
+inline int f9259_25(int x) { return x * 25; }
+inline int f9259_26(int x) { return x * 26; }
+inline int f9259_27(int x) { return x * 27; }
+inline int f9259_28(int x) { return x * 28; }
+inline int f9259_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 926 */
+#include <vector>
+#include "h5833.h"
+#include "h1885.h"
+#include "h8334.h"
+#include "h3537.h"
+#include "h3453.h"
+#ifdef X
+#include "h8176.h"
+#endif
+struct S926 { int a; const char *s = "x//y"; };
+inline int f926_0(int x) { return x * 0; }
+inline int f926_1(int x) { return x * 1; }
+inline int f926_2(int x) { return x * 2; }
+inline int f926_3(int x) { return x * 3; }
+inline int f926_4(int x) { return x * 4; }
+inline int f926_5(int x) { return x * 5; }
+inline int f926_6(int x) { return x * 6; }
+inline int f926_7(int x) { return x * 7; }
+inline int f926_8(int x) { return x * 8; }
+inline int f926_9(int x) { return x * 9; }
+inline int f926_10(int x) { return x * 10; }
+inline int f926_11(int x) { return x * 11; }
+inline int f926_12(int x) { return x * 12; }
+inline int f926_13(int x) { return x * 13; }
+inline int f926_14(int x) { return x * 14; }
+inline int f926_15(int x) { return x * 15; }
+inline int f926_16(int x) { return x * 16; }
+inline int f926_17(int x) { return x * 17; }
+inline int f926_18(int x) { return x * 18; }
+inline int f926_19(int x) { return x * 19; }
+inline int f926_20(int x) { return x * 20; }
+inline int f926_21(int x) { return x * 21; }
+inline int f926_22(int x) { return x * 22; }
+inline int f926_23(int x) { return x * 23; }
+inline int f926_24(int x) { return x * 24; }
+inline int f926_25(int x) { return x * 25; }
+inline int f926_26(int x) { return x * 26; }
+inline int f926_27(int x) { return x * 27; }
+inline int f926_28(int x) { return x * 28; }
+inline int f926_29(int x) { return x * 29; }
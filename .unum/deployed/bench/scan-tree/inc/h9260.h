@@ -0,0 +1,42 @@
+#pragma once
+/* header 9260 */
+#include <vector>
+#include "h7347.h"
+#include "h4487.h"
+#include "h4926.h"
+#include "h4284.h"
+#include "h213.h"
+#ifdef X
+#include "h5158.h"
+#endif
+struct S9260 { int a; const char *s = "x//y"; };
+inline int f9260_0(int x) { return x * 0; }
+inline int f9260_1(int x) { return x * 1; }
+inline int f9260_2(int x) { return x * 2; }
+inline int f9260_3(int x) { return x * 3; }
+inline int f9260_4(int x) { return x * 4; }
+inline int f9260_5(int x) { return x * 5; }
+inline int f9260_6(int x) { return x * 6; }
+inline int f9260_7(int x) { return x * 7; }
+inline int f9260_8(int x) { return x * 8; }
+inline int f9260_9(int x) { return x * 9; }
+inline int f9260_10(int x) { return x * 10; }
+inline int f9260_11(int x) { return x * 11; }
+inline int f9260_12(int x) { return x * 12; }
+inline int f9260_13(int x) { return x * 13; }
+inline int f9260_14(int x) { return x * 14; }
+inline int f9260_15(int x) { return x * 15; }
+inline int f9260_16(int x) { return x * 16; }
+inline int f9260_17(int x) { return x * 17; }
+inline int f9260_18(int x) { return x * 18; }
+inline int f9260_19(int x) { return x * 19; }
+inline int f9260_20(int x) { return x * 20; }
+inline int f9260_21(int x) { return x * 21; }
+inline int f9260_22(int x) { return x * 22; }
+inline int f9260_23(int x) { return x * 23; }
+inline int f9260_24(int x) { return x * 24; }
+inline int f9260_25(int x) { return x * 25; }
+inline int f9260_26(int x) { return x * 26; }
+inline int f9260_27(int x) { return x * 27; }
+inline int f9260_28(int x) { return x * 28; }
+inline int f9260_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9262 */
+#include <vector>
+#include "h3913.h"
+#include "h2514.h"
+#include "h8794.h"
+#include "h4446.h"
+#include "h6687.h"
+#ifdef X
+#include "h768.h"
+#endif
+struct S9262 { int a; const char *s = "x//y"; };
+inline int f9262_0(int x) { return x * 0; }
+inline int f9262_1(int x) { return x * 1; }
+inline int f9262_2(int x) { return x * 2; }
+inline int f9262_3(int x) { return x * 3; }
+inline int f9262_4(int x) { return x * 4; }
+inline int f9262_5(int x) { return x * 5; }
+inline int f9262_6(int x) { return x * 6; }
+inline int f9262_7(int x) { return x * 7; }
+inline int f9262_8(int x) { return x * 8; }
+inline int f9262_9(int x) { return x * 9; }
+inline int f9262_10(int x) { return x * 10; }
+inline int f9262_11(int x) { return x * 11; }
+inline int f9262_12(int x) { return x * 12; }
+inline int f9262_13(int x) { return x * 13; }
+inline int f9262_14(int x) { return x * 14; }
+inline int f9262_15(int x) { return x * 15; }
+inline int f9262_16(int x) { return x * 16; }
+inline int f9262_17(int x) { return x * 17; }
+inline int f9262_18(int x) { return x * 18; }
+inline int f9262_19(int x) { return x * 19; }
+inline int f9262_20(int x) { return x * 20; }
+inline int f9262_21(int x) { return x * 21; }
+inline int f9262_22(int x) { return x * 22; }
+inline int f9262_23(int x) { return x * 23; }
+inline int f9262_24(int x) { return x * 24; }
+inline int f9262_25(int x) { return x * 25; }
+inline int f9262_26(int x) { return x * 26; }
+inline int f9262_27(int x) { return x * 27; }
+inline int f9262_28(int x) { return x * 28; }
+inline int f9262_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9266 */
+#include <vector>
+#include "h4235.h"
+#include "h299.h"
+#include "h2683.h"
+#include "h3574.h"
+#include "h5411.h"
+#ifdef X
+#include "h3773.h"
+#endif
+struct S9266 { int a; const char *s = "x//y"; };
+inline int f9266_0(int x) { return x * 0; }
+inline int f9266_1(int x) { return x * 1; }
+inline int f9266_2(int x) { return x * 2; }
+inline int f9266_3(int x) { return x * 3; }
+inline int f9266_4(int x) { return x * 4; }
+inline int f9266_5(int x) { return x * 5; }
+inline int f9266_6(int x) { return x * 6; }
+inline int f9266_7(int x) { return x * 7; }
+inline int f9266_8(int x) { return x * 8; }
+inline int f9266_9(int x) { return x * 9; }
+inline int f9266_10(int x) { return x * 10; }
+inline int f9266_11(int x) { return x * 11; }
+inline int f9266_12(int x) { return x * 12; }
+inline int f9266_13(int x) { return x * 13; }
+inline int f9266_14(int x) { return x * 14; }
+inline int f9266_15(int x) { return x * 15; }
+inline int f9266_16(int x) { return x * 16; }
+inline int f9266_17(int x) { return x * 17; }
+inline int f9266_18(int x) { return x * 18; }
+inline int f9266_19(int x) { return x * 19; }
+inline int f9266_20(int x) { return x * 20; }
+inline int f9266_21(int x) { return x * 21; }
+inline int f9266_22(int x) { return x * 22; }
+inline int f9266_23(int x) { return x * 23; }
+inline int f9266_24(int x) { return x * 24; }
+inline int f9266_25(int x) { return x * 25; }
+inline int f9266_26(int x) { return x * 26; }
+inline int f9266_27(int x) { return x * 27; }
+inline int f9266_28(int x) { return x * 28; }
+inline int f9266_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9267 */
+#include <vector>
+#include "h7566.h"
+#include "h1790.h"
+#include "h2716.h"
+#include "h2380.h"
+#include "h5467.h"
+#ifdef X
+#include "h7253.h"
+#endif
+struct S9267 { int a; const char *s = "x//y"; };
+inline int f9267_0(int x) { return x * 0; }
+inline int f9267_1(int x) { return x * 1; }
+inline int f9267_2(int x) { return x * 2; }
+inline int f9267_3(int x) { return x * 3; }
+inline int f9267_4(int x) { return x * 4; }
+inline int f9267_5(int x) { return x * 5; }
+inline int f9267_6(int x) { return x * 6; }
+inline int f9267_7(int x) { return x * 7; }
+inline int f9267_8(int x) { return x * 8; }
+inline int f9267_9(int x) { return x * 9; }
+inline int f9267_10(int x) { return x * 10; }
+inline int f9267_11(int x) { return x * 11; }
+inline int f9267_12(int x) { return x * 12; }
+inline int f9267_13(int x) { return x * 13; }
+inline int f9267_14(int x) { return x * 14; }
+inline int f9267_15(int x) { return x * 15; }
+inline int f9267_16(int x) { return x * 16; }
+inline int f9267_17(int x) { return x * 17; }
+inline int f9267_18(int x) { return x * 18; }
+inline int f9267_19(int x) { return x * 19; }
+inline int f9267_20(int x) { return x * 20; }
+inline int f9267_21(int x) { return x * 21; }
+inline int f9267_22(int x) { return x * 22; }
+inline int f9267_23(int x) { return x * 23; }
+inline int f9267_24(int x) { return x * 24; }
+inline int f9267_25(int x) { return x * 25; }
+inline int f9267_26(int x) { return x * 26; }
+inline int f9267_27(int x) { return x * 27; }
+inline int f9267_28(int x) { return x * 28; }
+inline int f9267_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 927 */
+#include <vector>
+#include "h4532.h"
+#include "h4152.h"
+#include "h7213.h"
+#include "h6671.h"
+#include "h7580.h"
+#ifdef X
+#include "h5588.h"
+#endif
+struct S927 { int a; const char *s = "x//y"; };
+inline int f927_0(int x) { return x * 0; }
+inline int f927_1(int x) { return x * 1; }
+inline int f927_2(int x) { return x * 2; }
+inline int f927_3(int x) { return x * 3; }
+inline int f927_4(int x) { return x * 4; }
+inline int f927_5(int x) { return x * 5; }
+inline int f927_6(int x) { return x * 6; }
+inline int f927_7(int x) { return x * 7; }
+inline int f927_8(int x) { return x * 8; }
+inline int f927_9(int x) { return x * 9; }
+inline int f927_10(int x) { return x * 10; }
+inline int f927_11(int x) { return x * 11; }
+inline int f927_12(int x) { return x * 12; }
+inline int f927_13(int x) { return x * 13; }
+inline int f927_14(int x) { return x * 14; }
+inline int f927_15(int x) { return x * 15; }
+inline int f927_16(int x) { return x * 16; }
+inline int f927_17(int x) { return x * 17; }
+inline int f927_18(int x) { return x * 18; }
+inline int f927_19(int x) { return x * 19; }
+inline int f927_20(int x) { return x * 20; }
+inline int f927_21(int x) { return x * 21; }
+inline int f927_22(int x) { return x * 22; }
+inline int f927_23(int x) { return x * 23; }
+inline int f927_24(int x) { return x * 24; }
+inline int f927_25(int x) { return x * 25; }
+inline int f927_26(int x) { return x * 26; }
+inline int f927_27(int x) { return x * 27; }
+inline int f927_28(int x) { return x * 28; }
+inline int f927_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9271 */
+#include <vector>
+#include "h7012.h"
+#include "h1448.h"
+#include "h9563.h"
+#include "h5185.h"
+#include "h3163.h"
+#ifdef X
+#include "h4283.h"
+#endif
+struct S9271 { int a; const char *s = "x//y"; };
+inline int f9271_0(int x) { return x * 0; }
+inline int f9271_1(int x) { return x * 1; }
+inline int f9271_2(int x) { return x * 2; }
+inline int f9271_3(int x) { return x * 3; }
+inline int f9271_4(int x) { return x * 4; }
+inline int f9271_5(int x) { return x * 5; }
+inline int f9271_6(int x) { return x * 6; }
+inline int f9271_7(int x) { return x * 7; }
+inline int f9271_8(int x) { return x * 8; }
+inline int f9271_9(int x) { return x * 9; }
+inline int f9271_10(int x) { return x * 10; }
+inline int f9271_11(int x) { return x * 11; }
+inline int f9271_12(int x) { return x * 12; }
+inline int f9271_13(int x) { return x * 13; }
+inline int f9271_14(int x) { return x * 14; }
+inline int f9271_15(int x) { return x * 15; }
+inline int f9271_16(int x) { return x * 16; }
+inline int f9271_17(int x) { return x * 17; }
+inline int f9271_18(int x) { return x * 18; }
+inline int f9271_19(int x) { return x * 19; }
+inline int f9271_20(int x) { return x * 20; }
+inline int f9271_21(int x) { return x * 21; }
+inline int f9271_22(int x) { return x * 22; }
+inline int f9271_23(int x) { return x * 23; }
+inline int f9271_24(int x) { return x * 24; }
+inline int f9271_25(int x) { return x * 25; }
+inline int f9271_26(int x) { return x * 26; }
+inline int f9271_27(int x) { return x * 27; }
+inline int f9271_28(int x) { return x * 28; }
+inline int f9271_29(int x) { return x * 29; }
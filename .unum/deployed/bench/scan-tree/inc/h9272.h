@@ -0,0 +1,42 @@
+#pragma once
+/* header 9272 */
+#include <vector>
+#include "h9222.h"
+#include "h99.h"
+#include "h5702.h"
+#include "h2838.h"
+#include "h7976.h"
+#ifdef X
+#include "h2467.h"
+#endif
+struct S9272 { int a; const char *s = "x//y"; };
+inline int f9272_0(int x) { return x * 0; }
+inline int f9272_1(int x) { return x * 1; }
+inline int f9272_2(int x) { return x * 2; }
+inline int f9272_3(int x) { return x * 3; }
+inline int f9272_4(int x) { return x * 4; }
+inline int f9272_5(int x) { return x * 5; }
+inline int f9272_6(int x) { return x * 6; }
+inline int f9272_7(int x) { return x * 7; }
+inline int f9272_8(int x) { return x * 8; }
+inline int f9272_9(int x) { return x * 9; }
+inline int f9272_10(int x) { return x * 10; }
+inline int f9272_11(int x) { return x * 11; }
+inline int f9272_12(int x) { return x * 12; }
+inline int f9272_13(int x) { return x * 13; }
+inline int f9272_14(int x) { return x * 14; }
+inline int f9272_15(int x) { return x * 15; }
+inline int f9272_16(int x) { return x * 16; }
+inline int f9272_17(int x) { return x * 17; }
+inline int f9272_18(int x) { return x * 18; }
+inline int f9272_19(int x) { return x * 19; }
+inline int f9272_20(int x) { return x * 20; }
+inline int f9272_21(int x) { return x * 21; }
+inline int f9272_22(int x) { return x * 22; }
+inline int f9272_23(int x) { return x * 23; }
+inline int f9272_24(int x) { return x * 24; }
+inline int f9272_25(int x) { return x * 25; }
+inline int f9272_26(int x) { return x * 26; }
+inline int f9272_27(int x) { return x * 27; }
+inline int f9272_28(int x) { return x * 28; }
+inline int f9272_29(int x) { return x * 29; }
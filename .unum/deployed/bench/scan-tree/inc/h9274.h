@@ -0,0 +1,42 @@
+#pragma once
+/* header 9274 */
+#include <vector>
+#include "h2063.h"
+#include "h152.h"
+#include "h1306.h"
+#include "h3888.h"
+#include "h7502.h"
+#ifdef X
+#include "h5722.h"
+#endif
+struct S9274 { int a; const char *s = "x//y"; };
+inline int f9274_0(int x) { return x * 0; }
+inline int f9274_1(int x) { return x * 1; }
+inline int f9274_2(int x) { return x * 2; }
+inline int f9274_3(int x) { return x * 3; }
+inline int f9274_4(int x) { return x * 4; }
+inline int f9274_5(int x) { return x * 5; }
+inline int f9274_6(int x) { return x * 6; }
+inline int f9274_7(int x) { return x * 7; }
+inline int f9274_8(int x) { return x * 8; }
+inline int f9274_9(int x) { return x * 9; }
+inline int f9274_10(int x) { return x * 10; }
+inline int f9274_11(int x) { return x * 11; }
+inline int f9274_12(int x) { return x * 12; }
+inline int f9274_13(int x) { return x * 13; }
+inline int f9274_14(int x) { return x * 14; }
+inline int f9274_15(int x) { return x * 15; }
+inline int f9274_16(int x) { return x * 16; }
+inline int f9274_17(int x) { return x * 17; }
+inline int f9274_18(int x) { return x * 18; }
+inline int f9274_19(int x) { return x * 19; }
+inline int f9274_20(int x) { return x * 20; }
+inline int f9274_21(int x) { return x * 21; }
+inline int f9274_22(int x) { return x * 22; }
+inline int f9274_23(int x) { return x * 23; }
+inline int f9274_24(int x) { return x * 24; }
+inline int f9274_25(int x) { return x * 25; }
+inline int f9274_26(int x) { return x * 26; }
+inline int f9274_27(int x) { return x * 27; }
+inline int f9274_28(int x) { return x * 28; }
+inline int f9274_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9275 */
+#include <vector>
+#include "h9698.h"
+#include "h9936.h"
+#include "h2849.h"
+#include "h7306.h"
+#include "h2757.h"
+#ifdef X
+#include "h8981.h"
+#endif
+struct S9275 { int a; const char *s = "x//y"; };
+inline int f9275_0(int x) { return x * 0; }
+inline int f9275_1(int x) { return x * 1; }
+inline int f9275_2(int x) { return x * 2; }
+inline int f9275_3(int x) { return x * 3; }
+inline int f9275_4(int x) { return x * 4; }
+inline int f9275_5(int x) { return x * 5; }
+inline int f9275_6(int x) { return x * 6; }
+inline int f9275_7(int x) { return x * 7; }
+inline int f9275_8(int x) { return x * 8; }
+inline int f9275_9(int x) { return x * 9; }
+inline int f9275_10(int x) { return x * 10; }
+inline int f9275_11(int x) { return x * 11; }
+inline int f9275_12(int x) { return x * 12; }
+inline int f9275_13(int x) { return x * 13; }
+inline int f9275_14(int x) { return x * 14; }
+inline int f9275_15(int x) { return x * 15; }
+inline int f9275_16(int x) { return x * 16; }
+inline int f9275_17(int x) { return x * 17; }
+inline int f9275_18(int x) { return x * 18; }
+inline int f9275_19(int x) { return x * 19; }
+inline int f9275_20(int x) { return x * 20; }
+inline int f9275_21(int x) { return x * 21; }
+inline int f9275_22(int x) { return x * 22; }
+inline int f9275_23(int x) { return x * 23; }
+inline int f9275_24(int x) { return x * 24; }
+inline int f9275_25(int x) { return x * 25; }
+inline int f9275_26(int x) { return x * 26; }
+inline int f9275_27(int x) { return x * 27; }
+inline int f9275_28(int x) { return x * 28; }
+inline int f9275_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9276 */
+#include <vector>
+#include "h8181.h"
+#include "h7350.h"
+#include "h9711.h"
+#include "h8835.h"
+#include "h4371.h"
+#ifdef X
+#include "h3128.h"
+#endif
+struct S9276 { int a; const char *s = "x//y"; };
+inline int f9276_0(int x) { return x * 0; }
+inline int f9276_1(int x) { return x * 1; }
+inline int f9276_2(int x) { return x * 2; }
+inline int f9276_3(int x) { return x * 3; }
+inline int f9276_4(int x) { return x * 4; }
+inline int f9276_5(int x) { return x * 5; }
+inline int f9276_6(int x) { return x * 6; }
+inline int f9276_7(int x) { return x * 7; }
+inline int f9276_8(int x) { return x * 8; }
+inline int f9276_9(int x) { return x * 9; }
+inline int f9276_10(int x) { return x * 10; }
+inline int f9276_11(int x) { return x * 11; }
+inline int f9276_12(int x) { return x * 12; }
+inline int f9276_13(int x) { return x * 13; }
+inline int f9276_14(int x) { return x * 14; }
+inline int f9276_15(int x) { return x * 15; }
+inline int f9276_16(int x) { return x * 16; }
+inline int f9276_17(int x) { return x * 17; }
+inline int f9276_18(int x) { return x * 18; }
+inline int f9276_19(int x) { return x * 19; }
+inline int f9276_20(int x) { return x * 20; }
+inline int f9276_21(int x) { return x * 21; }
+inline int f9276_22(int x) { return x * 22; }
+inline int f9276_23(int x) { return x * 23; }
+inline int f9276_24(int x) { return x * 24; }
+inline int f9276_25(int x) { return x * 25; }
+inline int f9276_26(int x) { return x * 26; }
+inline int f9276_27(int x) { return x * 27; }
+inline int f9276_28(int x) { return x * 28; }
+inline int f9276_29(int x) { return x * 29; }
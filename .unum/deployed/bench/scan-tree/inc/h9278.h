@@ -0,0 +1,42 @@
+#pragma once
+/* header 9278 */
+#include <vector>
+#include "h1413.h"
+#include "h8754.h"
+#include "h5639.h"
+#include "h8389.h"
+#include "h6345.h"
+#ifdef X
+#include "h714.h"
+#endif
+struct S9278 { int a; const char *s = "x//y"; };
+inline int f9278_0(int x) { return x * 0; }
+inline int f9278_1(int x) { return x * 1; }
+inline int f9278_2(int x) { return x * 2; }
+inline int f9278_3(int x) { return x * 3; }
+inline int f9278_4(int x) { return x * 4; }
+inline int f9278_5(int x) { return x * 5; }
+inline int f9278_6(int x) { return x * 6; }
+inline int f9278_7(int x) { return x * 7; }
+inline int f9278_8(int x) { return x * 8; }
+inline int f9278_9(int x) { return x * 9; }
+inline int f9278_10(int x) { return x * 10; }
+inline int f9278_11(int x) { return x * 11; }
+inline int f9278_12(int x) { return x * 12; }
+inline int f9278_13(int x) { return x * 13; }
+inline int f9278_14(int x) { return x * 14; }
+inline int f9278_15(int x) { return x * 15; }
+inline int f9278_16(int x) { return x * 16; }
+inline int f9278_17(int x) { return x * 17; }
+inline int f9278_18(int x) { return x * 18; }
+inline int f9278_19(int x) { return x * 19; }
+inline int f9278_20(int x) { return x * 20; }
+inline int f9278_21(int x) { return x * 21; }
+inline int f9278_22(int x) { return x * 22; }
+inline int f9278_23(int x) { return x * 23; }
+inline int f9278_24(int x) { return x * 24; }
+inline int f9278_25(int x) { return x * 25; }
+inline int f9278_26(int x) { return x * 26; }
+inline int f9278_27(int x) { return x * 27; }
+inline int f9278_28(int x) { return x * 28; }
+inline int f9278_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9279 */
+#include <vector>
+#include "h3902.h"
+#include "h285.h"
+#include "h3858.h"
+#include "h758.h"
+#include "h6585.h"
+#ifdef X
+#include "h6895.h"
+#endif
+struct S9279 { int a; const char *s = "x//y"; };
+inline int f9279_0(int x) { return x * 0; }
+inline int f9279_1(int x) { return x * 1; }
+inline int f9279_2(int x) { return x * 2; }
+inline int f9279_3(int x) { return x * 3; }
+inline int f9279_4(int x) { return x * 4; }
+inline int f9279_5(int x) { return x * 5; }
+inline int f9279_6(int x) { return x * 6; }
+inline int f9279_7(int x) { return x * 7; }
+inline int f9279_8(int x) { return x * 8; }
+inline int f9279_9(int x) { return x * 9; }
+inline int f9279_10(int x) { return x * 10; }
+inline int f9279_11(int x) { return x * 11; }
+inline int f9279_12(int x) { return x * 12; }
+inline int f9279_13(int x) { return x * 13; }
+inline int f9279_14(int x) { return x * 14; }
+inline int f9279_15(int x) { return x * 15; }
+inline int f9279_16(int x) { return x * 16; }
+inline int f9279_17(int x) { return x * 17; }
+inline int f9279_18(int x) { return x * 18; }
+inline int f9279_19(int x) { return x * 19; }
+inline int f9279_20(int x) { return x * 20; }
+inline int f9279_21(int x) { return x * 21; }
+inline int f9279_22(int x) { return x * 22; }
+inline int f9279_23(int x) { return x * 23; }
+inline int f9279_24(int x) { return x * 24; }
+inline int f9279_25(int x) { return x * 25; }
+inline int f9279_26(int x) { return x * 26; }
+inline int f9279_27(int x) { return x * 27; }
+inline int f9279_28(int x) { return x * 28; }
+inline int f9279_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9283 */
+#include <vector>
+#include "h3689.h"
+#include "h9864.h"
+#include "h7244.h"
+#include "h1173.h"
+#include "h8368.h"
+#ifdef X
+#include "h497.h"
+#endif
+struct S9283 { int a; const char *s = "x//y"; };
+inline int f9283_0(int x) { return x * 0; }
+inline int f9283_1(int x) { return x * 1; }
+inline int f9283_2(int x) { return x * 2; }
+inline int f9283_3(int x) { return x * 3; }
+inline int f9283_4(int x) { return x * 4; }
+inline int f9283_5(int x) { return x * 5; }
+inline int f9283_6(int x) { return x * 6; }
+inline int f9283_7(int x) { return x * 7; }
+inline int f9283_8(int x) { return x * 8; }
+inline int f9283_9(int x) { return x * 9; }
+inline int f9283_10(int x) { return x * 10; }
+inline int f9283_11(int x) { return x * 11; }
+inline int f9283_12(int x) { return x * 12; }
+inline int f9283_13(int x) { return x * 13; }
+inline int f9283_14(int x) { return x * 14; }
+inline int f9283_15(int x) { return x * 15; }
+inline int f9283_16(int x) { return x * 16; }
+inline int f9283_17(int x) { return x * 17; }
+inline int f9283_18(int x) { return x * 18; }
+inline int f9283_19(int x) { return x * 19; }
+inline int f9283_20(int x) { return x * 20; }
+inline int f9283_21(int x) { return x * 21; }
+inline int f9283_22(int x) { return x * 22; }
+inline int f9283_23(int x) { return x * 23; }
+inline int f9283_24(int x) { return x * 24; }
+inline int f9283_25(int x) { return x * 25; }
+inline int f9283_26(int x) { return x * 26; }
+inline int f9283_27(int x) { return x * 27; }
+inline int f9283_28(int x) { return x * 28; }
+inline int f9283_29(int x) { return x * 29; }
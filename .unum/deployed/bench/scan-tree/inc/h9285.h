@@ -0,0 +1,42 @@
+#pragma once
+/* header 9285 */
+#include <vector>
+#include "h2598.h"
+#include "h9581.h"
+#include "h3494.h"
+#include "h432.h"
+#include "h6998.h"
+#ifdef X
+#include "h7103.h"
+#endif
+struct S9285 { int a; const char *s = "x//y"; };
+inline int f9285_0(int x) { return x * 0; }
+inline int f9285_1(int x) { return x * 1; }
+inline int f9285_2(int x) { return x * 2; }
+inline int f9285_3(int x) { return x * 3; }
+inline int f9285_4(int x) { return x * 4; }
+inline int f9285_5(int x) { return x * 5; }
+inline int f9285_6(int x) { return x * 6; }
+inline int f9285_7(int x) { return x * 7; }
+inline int f9285_8(int x) { return x * 8; }
+inline int f9285_9(int x) { return x * 9; }
+inline int f9285_10(int x) { return x * 10; }
+inline int f9285_11(int x) { return x * 11; }
+inline int f9285_12(int x) { return x * 12; }
+inline int f9285_13(int x) { return x * 13; }
+inline int f9285_14(int x) { return x * 14; }
+inline int f9285_15(int x) { return x * 15; }
+inline int f9285_16(int x) { return x * 16; }
+inline int f9285_17(int x) { return x * 17; }
+inline int f9285_18(int x) { return x * 18; }
+inline int f9285_19(int x) { return x * 19; }
+inline int f9285_20(int x) { return x * 20; }
+inline int f9285_21(int x) { return x * 21; }
+inline int f9285_22(int x) { return x * 22; }
+inline int f9285_23(int x) { return x * 23; }
+inline int f9285_24(int x) { return x * 24; }
+inline int f9285_25(int x) { return x * 25; }
+inline int f9285_26(int x) { return x * 26; }
+inline int f9285_27(int x) { return x * 27; }
+inline int f9285_28(int x) { return x * 28; }
+inline int f9285_29(int x) { return x * 29; }
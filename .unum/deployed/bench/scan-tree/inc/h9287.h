@@ -0,0 +1,42 @@
+#pragma once
+/* header 9287 */
+#include <vector>
+#include "h1608.h"
+#include "h8430.h"
+#include "h3341.h"
+#include "h9931.h"
+#include "h9320.h"
+#ifdef X
+#include "h1076.h"
+#endif
+struct S9287 { int a; const char *s = "x//y"; };
+inline int f9287_0(int x) { return x * 0; }
+inline int f9287_1(int x) { return x * 1; }
+inline int f9287_2(int x) { return x * 2; }
+inline int f9287_3(int x) { return x * 3; }
+inline int f9287_4(int x) { return x * 4; }
+inline int f9287_5(int x) { return x * 5; }
+inline int f9287_6(int x) { return x * 6; }
+inline int f9287_7(int x) { return x * 7; }
+inline int f9287_8(int x) { return x * 8; }
+inline int f9287_9(int x) { return x * 9; }
+inline int f9287_10(int x) { return x * 10; }
+inline int f9287_11(int x) { return x * 11; }
+inline int f9287_12(int x) { return x * 12; }
+inline int f9287_13(int x) { return x * 13; }
+inline int f9287_14(int x) { return x * 14; }
+inline int f9287_15(int x) { return x * 15; }
+inline int f9287_16(int x) { return x * 16; }
+inline int f9287_17(int x) { return x * 17; }
+inline int f9287_18(int x) { return x * 18; }
+inline int f9287_19(int x) { return x * 19; }
+inline int f9287_20(int x) { return x * 20; }
+inline int f9287_21(int x) { return x * 21; }
+inline int f9287_22(int x) { return x * 22; }
+inline int f9287_23(int x) { return x * 23; }
+inline int f9287_24(int x) { return x * 24; }
+inline int f9287_25(int x) { return x * 25; }
+inline int f9287_26(int x) { return x * 26; }
+inline int f9287_27(int x) { return x * 27; }
+inline int f9287_28(int x) { return x * 28; }
+inline int f9287_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9290 */
+#include <vector>
+#include "h7961.h"
+#include "h8466.h"
+#include "h1841.h"
+#include "h709.h"
+#include "h6077.h"
+#ifdef X
+#include "h3698.h"
+#endif
+struct S9290 { int a; const char *s = "x//y"; };
+inline int f9290_0(int x) { return x * 0; }
+inline int f9290_1(int x) { return x * 1; }
+inline int f9290_2(int x) { return x * 2; }
+inline int f9290_3(int x) { return x * 3; }
+inline int f9290_4(int x) { return x * 4; }
+inline int f9290_5(int x) { return x * 5; }
+inline int f9290_6(int x) { return x * 6; }
+inline int f9290_7(int x) { return x * 7; }
+inline int f9290_8(int x) { return x * 8; }
+inline int f9290_9(int x) { return x * 9; }
+inline int f9290_10(int x) { return x * 10; }
+inline int f9290_11(int x) { return x * 11; }
+inline int f9290_12(int x) { return x * 12; }
+inline int f9290_13(int x) { return x * 13; }
+inline int f9290_14(int x) { return x * 14; }
+inline int f9290_15(int x) { return x * 15; }
+inline int f9290_16(int x) { return x * 16; }
+inline int f9290_17(int x) { return x * 17; }
+inline int f9290_18(int x) { return x * 18; }
+inline int f9290_19(int x) { return x * 19; }
+inline int f9290_20(int x) { return x * 20; }
+inline int f9290_21(int x) { return x * 21; }
+inline int f9290_22(int x) { return x * 22; }
+inline int f9290_23(int x) { return x * 23; }
+inline int f9290_24(int x) { return x * 24; }
+inline int f9290_25(int x) { return x * 25; }
+inline int f9290_26(int x) { return x * 26; }
+inline int f9290_27(int x) { return x * 27; }
+inline int f9290_28(int x) { return x * 28; }
+inline int f9290_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9293 */
+#include <vector>
+#include "h685.h"
+#include "h6227.h"
+#include "h9189.h"
+#include "h7536.h"
+#include "h4718.h"
+#ifdef X
+#include "h9925.h"
+#endif
+struct S9293 { int a; const char *s = "x//y"; };
+inline int f9293_0(int x) { return x * 0; }
+inline int f9293_1(int x) { return x * 1; }
+inline int f9293_2(int x) { return x * 2; }
+inline int f9293_3(int x) { return x * 3; }
+inline int f9293_4(int x) { return x * 4; }
+inline int f9293_5(int x) { return x * 5; }
+inline int f9293_6(int x) { return x * 6; }
+inline int f9293_7(int x) { return x * 7; }
+inline int f9293_8(int x) { return x * 8; }
+inline int f9293_9(int x) { return x * 9; }
+inline int f9293_10(int x) { return x * 10; }
+inline int f9293_11(int x) { return x * 11; }
+inline int f9293_12(int x) { return x * 12; }
+inline int f9293_13(int x) { return x * 13; }
+inline int f9293_14(int x) { return x * 14; }
+inline int f9293_15(int x) { return x * 15; }
+inline int f9293_16(int x) { return x * 16; }
+inline int f9293_17(int x) { return x * 17; }
+inline int f9293_18(int x) { return x * 18; }
+inline int f9293_19(int x) { return x * 19; }
+inline int f9293_20(int x) { return x * 20; }
+inline int f9293_21(int x) { return x * 21; }
+inline int f9293_22(int x) { return x * 22; }
+inline int f9293_23(int x) { return x * 23; }
+inline int f9293_24(int x) { return x * 24; }
+inline int f9293_25(int x) { return x * 25; }
+inline int f9293_26(int x) { return x * 26; }
+inline int f9293_27(int x) { return x * 27; }
+inline int f9293_28(int x) { return x * 28; }
+inline int f9293_29(int x) { return x * 29; }
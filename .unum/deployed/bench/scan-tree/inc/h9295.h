@@ -0,0 +1,42 @@
+#pragma once
+/* header 9295 */
+#include <vector>
+#include "h2391.h"
+#include "h4741.h"
+#include "h9656.h"
+#include "h9054.h"
+#include "h217.h"
+#ifdef X
+#include "h8622.h"
+#endif
+struct S9295 { int a; const char *s = "x//y"; };
+inline int f9295_0(int x) { return x * 0; }
+inline int f9295_1(int x) { return x * 1; }
+inline int f9295_2(int x) { return x * 2; }
+inline int f9295_3(int x) { return x * 3; }
+inline int f9295_4(int x) { return x * 4; }
+inline int f9295_5(int x) { return x * 5; }
+inline int f9295_6(int x) { return x * 6; }
+inline int f9295_7(int x) { return x * 7; }
+inline int f9295_8(int x) { return x * 8; }
+inline int f9295_9(int x) { return x * 9; }
+inline int f9295_10(int x) { return x * 10; }
+inline int f9295_11(int x) { return x * 11; }
+inline int f9295_12(int x) { return x * 12; }
+inline int f9295_13(int x) { return x * 13; }
+inline int f9295_14(int x) { return x * 14; }
+inline int f9295_15(int x) { return x * 15; }
+inline int f9295_16(int x) { return x * 16; }
+inline int f9295_17(int x) { return x * 17; }
+inline int f9295_18(int x) { return x * 18; }
+inline int f9295_19(int x) { return x * 19; }
+inline int f9295_20(int x) { return x * 20; }
+inline int f9295_21(int x) { return x * 21; }
+inline int f9295_22(int x) { return x * 22; }
+inline int f9295_23(int x) { return x * 23; }
+inline int f9295_24(int x) { return x * 24; }
+inline int f9295_25(int x) { return x * 25; }
+inline int f9295_26(int x) { return x * 26; }
+inline int f9295_27(int x) { return x * 27; }
+inline int f9295_28(int x) { return x * 28; }
+inline int f9295_29(int x) { return x * 29; }
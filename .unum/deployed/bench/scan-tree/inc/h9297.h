@@ -0,0 +1,42 @@
+#pragma once
+/* header 9297 */
+#include <vector>
+#include "h520.h"
+#include "h2745.h"
+#include "h5773.h"
+#include "h4831.h"
+#include "h3416.h"
+#ifdef X
+#include "h5102.h"
+#endif
+struct S9297 { int a; const char *s = "x//y"; };
+inline int f9297_0(int x) { return x * 0; }
+inline int f9297_1(int x) { return x * 1; }
+inline int f9297_2(int x) { return x * 2; }
+inline int f9297_3(int x) { return x * 3; }
+inline int f9297_4(int x) { return x * 4; }
+inline int f9297_5(int x) { return x * 5; }
+inline int f9297_6(int x) { return x * 6; }
+inline int f9297_7(int x) { return x * 7; }
+inline int f9297_8(int x) { return x * 8; }
+inline int f9297_9(int x) { return x * 9; }
+inline int f9297_10(int x) { return x * 10; }
+inline int f9297_11(int x) { return x * 11; }
+inline int f9297_12(int x) { return x * 12; }
+inline int f9297_13(int x) { return x * 13; }
+inline int f9297_14(int x) { return x * 14; }
+inline int f9297_15(int x) { return x * 15; }
+inline int f9297_16(int x) { return x * 16; }
+inline int f9297_17(int x) { return x * 17; }
+inline int f9297_18(int x) { return x * 18; }
+inline int f9297_19(int x) { return x * 19; }
+inline int f9297_20(int x) { return x * 20; }
+inline int f9297_21(int x) { return x * 21; }
+inline int f9297_22(int x) { return x * 22; }
+inline int f9297_23(int x) { return x * 23; }
+inline int f9297_24(int x) { return x * 24; }
+inline int f9297_25(int x) { return x * 25; }
+inline int f9297_26(int x) { return x * 26; }
+inline int f9297_27(int x) { return x * 27; }
+inline int f9297_28(int x) { return x * 28; }
+inline int f9297_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 93 */
+#include <vector>
+#include "h7055.h"
+#include "h9451.h"
+#include "h687.h"
+#include "h8587.h"
+#include "h9789.h"
+#ifdef X
+#include "h6073.h"
+#endif
+struct S93 { int a; const char *s = "x//y"; };
+inline int f93_0(int x) { return x * 0; }
+inline int f93_1(int x) { return x * 1; }
+inline int f93_2(int x) { return x * 2; }
+inline int f93_3(int x) { return x * 3; }
+inline int f93_4(int x) { return x * 4; }
+inline int f93_5(int x) { return x * 5; }
+inline int f93_6(int x) { return x * 6; }
+inline int f93_7(int x) { return x * 7; }
+inline int f93_8(int x) { return x * 8; }
+inline int f93_9(int x) { return x * 9; }
+inline int f93_10(int x) { return x * 10; }
+inline int f93_11(int x) { return x * 11; }
+inline int f93_12(int x) { return x * 12; }
+inline int f93_13(int x) { return x * 13; }
+inline int f93_14(int x) { return x * 14; }
+inline int f93_15(int x) { return x * 15; }
+inline int f93_16(int x) { return x * 16; }
+inline int f93_17(int x) { return x * 17; }
+inline int f93_18(int x) { return x * 18; }
+inline int f93_19(int x) { return x * 19; }
+inline int f93_20(int x) { return x * 20; }
+inline int f93_21(int x) { return x * 21; }
+inline int f93_22(int x) { return x * 22; }
+inline int f93_23(int x) { return x * 23; }
+inline int f93_24(int x) { return x * 24; }
+inline int f93_25(int x) { return x * 25; }
+inline int f93_26(int x) { return x * 26; }
+inline int f93_27(int x) { return x * 27; }
+inline int f93_28(int x) { return x * 28; }
+inline int f93_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9301 */
+#include <vector>
+#include "h8266.h"
+#include "h2092.h"
+#include "h4620.h"
+#include "h8430.h"
+#include "h5339.h"
+#ifdef X
+#include "h9720.h"
+#endif
+struct S9301 { int a; const char *s = "x//y"; };
+inline int f9301_0(int x) { return x * 0; }
+inline int f9301_1(int x) { return x * 1; }
+inline int f9301_2(int x) { return x * 2; }
+inline int f9301_3(int x) { return x * 3; }
+inline int f9301_4(int x) { return x * 4; }
+inline int f9301_5(int x) { return x * 5; }
+inline int f9301_6(int x) { return x * 6; }
+inline int f9301_7(int x) { return x * 7; }
+inline int f9301_8(int x) { return x * 8; }
+inline int f9301_9(int x) { return x * 9; }
+inline int f9301_10(int x) { return x * 10; }
+inline int f9301_11(int x) { return x * 11; }
+inline int f9301_12(int x) { return x * 12; }
+inline int f9301_13(int x) { return x * 13; }
+inline int f9301_14(int x) { return x * 14; }
+inline int f9301_15(int x) { return x * 15; }
+inline int f9301_16(int x) { return x * 16; }
+inline int f9301_17(int x) { return x * 17; }
+inline int f9301_18(int x) { return x * 18; }
+inline int f9301_19(int x) { return x * 19; }
+inline int f9301_20(int x) { return x * 20; }
+inline int f9301_21(int x) { return x * 21; }
+inline int f9301_22(int x) { return x * 22; }
+inline int f9301_23(int x) { return x * 23; }
+inline int f9301_24(int x) { return x * 24; }
+inline int f9301_25(int x) { return x * 25; }
+inline int f9301_26(int x) { return x * 26; }
+inline int f9301_27(int x) { return x * 27; }
+inline int f9301_28(int x) { return x * 28; }
+inline int f9301_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9303 */
+#include <vector>
+#include "h6142.h"
+#include "h340.h"
+#include "h784.h"
+#include "h5526.h"
+#include "h259.h"
+#ifdef X
+#include "h3191.h"
+#endif
+struct S9303 { int a; const char *s = "x//y"; };
+inline int f9303_0(int x) { return x * 0; }
+inline int f9303_1(int x) { return x * 1; }
+inline int f9303_2(int x) { return x * 2; }
+inline int f9303_3(int x) { return x * 3; }
+inline int f9303_4(int x) { return x * 4; }
+inline int f9303_5(int x) { return x * 5; }
+inline int f9303_6(int x) { return x * 6; }
+inline int f9303_7(int x) { return x * 7; }
+inline int f9303_8(int x) { return x * 8; }
+inline int f9303_9(int x) { return x * 9; }
+inline int f9303_10(int x) { return x * 10; }
+inline int f9303_11(int x) { return x * 11; }
+inline int f9303_12(int x) { return x * 12; }
+inline int f9303_13(int x) { return x * 13; }
+inline int f9303_14(int x) { return x * 14; }
+inline int f9303_15(int x) { return x * 15; }
+inline int f9303_16(int x) { return x * 16; }
+inline int f9303_17(int x) { return x * 17; }
+inline int f9303_18(int x) { return x * 18; }
+inline int f9303_19(int x) { return x * 19; }
+inline int f9303_20(int x) { return x * 20; }
+inline int f9303_21(int x) { return x * 21; }
+inline int f9303_22(int x) { return x * 22; }
+inline int f9303_23(int x) { return x * 23; }
+inline int f9303_24(int x) { return x * 24; }
+inline int f9303_25(int x) { return x * 25; }
+inline int f9303_26(int x) { return x * 26; }
+inline int f9303_27(int x) { return x * 27; }
+inline int f9303_28(int x) { return x * 28; }
+inline int f9303_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9304 */
+#include <vector>
+#include "h192.h"
+#include "h8623.h"
+#include "h158.h"
+#include "h9802.h"
+#include "h4512.h"
+#ifdef X
+#include "h4701.h"
+#endif
+struct S9304 { int a; const char *s = "x//y"; };
+inline int f9304_0(int x) { return x * 0; }
+inline int f9304_1(int x) { return x * 1; }
+inline int f9304_2(int x) { return x * 2; }
+inline int f9304_3(int x) { return x * 3; }
+inline int f9304_4(int x) { return x * 4; }
+inline int f9304_5(int x) { return x * 5; }
+inline int f9304_6(int x) { return x * 6; }
+inline int f9304_7(int x) { return x * 7; }
+inline int f9304_8(int x) { return x * 8; }
+inline int f9304_9(int x) { return x * 9; }
+inline int f9304_10(int x) { return x * 10; }
+inline int f9304_11(int x) { return x * 11; }
+inline int f9304_12(int x) { return x * 12; }
+inline int f9304_13(int x) { return x * 13; }
+inline int f9304_14(int x) { return x * 14; }
+inline int f9304_15(int x) { return x * 15; }
+inline int f9304_16(int x) { return x * 16; }
+inline int f9304_17(int x) { return x * 17; }
+inline int f9304_18(int x) { return x * 18; }
+inline int f9304_19(int x) { return x * 19; }
+inline int f9304_20(int x) { return x * 20; }
+inline int f9304_21(int x) { return x * 21; }
+inline int f9304_22(int x) { return x * 22; }
+inline int f9304_23(int x) { return x * 23; }
+inline int f9304_24(int x) { return x * 24; }
+inline int f9304_25(int x) { return x * 25; }
+inline int f9304_26(int x) { return x * 26; }
+inline int f9304_27(int x) { return x * 27; }
+inline int f9304_28(int x) { return x * 28; }
+inline int f9304_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9305 */
+#include <vector>
+#include "h1211.h"
+#include "h9893.h"
+#include "h9803.h"
+#include "h7224.h"
+#include "h9241.h"
+#ifdef X
+#include "h1655.h"
+#endif
+struct S9305 { int a; const char *s = "x//y"; };
+inline int f9305_0(int x) { return x * 0; }
+inline int f9305_1(int x) { return x * 1; }
+inline int f9305_2(int x) { return x * 2; }
+inline int f9305_3(int x) { return x * 3; }
+inline int f9305_4(int x) { return x * 4; }
+inline int f9305_5(int x) { return x * 5; }
+inline int f9305_6(int x) { return x * 6; }
+inline int f9305_7(int x) { return x * 7; }
+inline int f9305_8(int x) { return x * 8; }
+inline int f9305_9(int x) { return x * 9; }
+inline int f9305_10(int x) { return x * 10; }
+inline int f9305_11(int x) { return x * 11; }
+inline int f9305_12(int x) { return x * 12; }
+inline int f9305_13(int x) { return x * 13; }
+inline int f9305_14(int x) { return x * 14; }
+inline int f9305_15(int x) { return x * 15; }
+inline int f9305_16(int x) { return x * 16; }
+inline int f9305_17(int x) { return x * 17; }
+inline int f9305_18(int x) { return x * 18; }
+inline int f9305_19(int x) { return x * 19; }
+inline int f9305_20(int x) { return x * 20; }
+inline int f9305_21(int x) { return x * 21; }
+inline int f9305_22(int x) { return x * 22; }
+inline int f9305_23(int x) { return x * 23; }
+inline int f9305_24(int x) { return x * 24; }
+inline int f9305_25(int x) { return x * 25; }
+inline int f9305_26(int x) { return x * 26; }
+inline int f9305_27(int x) { return x * 27; }
+inline int f9305_28(int x) { return x * 28; }
+inline int f9305_29(int x) { return x * 29; }
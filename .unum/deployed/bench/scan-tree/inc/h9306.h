@@ -0,0 +1,42 @@
+#pragma once
+/* header 9306 */
+#include <vector>
+#include "h5169.h"
+#include "h2580.h"
+#include "h1228.h"
+#include "h1950.h"
+#include "h4805.h"
+#ifdef X
+#include "h1187.h"
+#endif
+struct S9306 { int a; const char *s = "x//y"; };
+inline int f9306_0(int x) { return x * 0; }
+inline int f9306_1(int x) { return x * 1; }
+inline int f9306_2(int x) { return x * 2; }
+inline int f9306_3(int x) { return x * 3; }
+inline int f9306_4(int x) { return x * 4; }
+inline int f9306_5(int x) { return x * 5; }
+inline int f9306_6(int x) { return x * 6; }
+inline int f9306_7(int x) { return x * 7; }
+inline int f9306_8(int x) { return x * 8; }
+inline int f9306_9(int x) { return x * 9; }
+inline int f9306_10(int x) { return x * 10; }
+inline int f9306_11(int x) { return x * 11; }
+inline int f9306_12(int x) { return x * 12; }
+inline int f9306_13(int x) { return x * 13; }
+inline int f9306_14(int x) { return x * 14; }
+inline int f9306_15(int x) { return x * 15; }
+inline int f9306_16(int x) { return x * 16; }
+inline int f9306_17(int x) { return x * 17; }
+inline int f9306_18(int x) { return x * 18; }
+inline int f9306_19(int x) { return x * 19; }
+inline int f9306_20(int x) { return x * 20; }
+inline int f9306_21(int x) { return x * 21; }
+inline int f9306_22(int x) { return x * 22; }
+inline int f9306_23(int x) { return x * 23; }
+inline int f9306_24(int x) { return x * 24; }
+inline int f9306_25(int x) { return x * 25; }
+inline int f9306_26(int x) { return x * 26; }
+inline int f9306_27(int x) { return x * 27; }
+inline int f9306_28(int x) { return x * 28; }
+inline int f9306_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9307 */
+#include <vector>
+#include "h7166.h"
+#include "h9967.h"
+#include "h106.h"
+#include "h6286.h"
+#include "h9595.h"
+#ifdef X
+#include "h2155.h"
+#endif
+struct S9307 { int a; const char *s = "x//y"; };
+inline int f9307_0(int x) { return x * 0; }
+inline int f9307_1(int x) { return x * 1; }
+inline int f9307_2(int x) { return x * 2; }
+inline int f9307_3(int x) { return x * 3; }
+inline int f9307_4(int x) { return x * 4; }
+inline int f9307_5(int x) { return x * 5; }
+inline int f9307_6(int x) { return x * 6; }
+inline int f9307_7(int x) { return x * 7; }
+inline int f9307_8(int x) { return x * 8; }
+inline int f9307_9(int x) { return x * 9; }
+inline int f9307_10(int x) { return x * 10; }
+inline int f9307_11(int x) { return x * 11; }
+inline int f9307_12(int x) { return x * 12; }
+inline int f9307_13(int x) { return x * 13; }
+inline int f9307_14(int x) { return x * 14; }
+inline int f9307_15(int x) { return x * 15; }
+inline int f9307_16(int x) { return x * 16; }
+inline int f9307_17(int x) { return x * 17; }
+inline int f9307_18(int x) { return x * 18; }
+inline int f9307_19(int x) { return x * 19; }
+inline int f9307_20(int x) { return x * 20; }
+inline int f9307_21(int x) { return x * 21; }
+inline int f9307_22(int x) { return x * 22; }
+inline int f9307_23(int x) { return x * 23; }
+inline int f9307_24(int x) { return x * 24; }
+inline int f9307_25(int x) { return x * 25; }
+inline int f9307_26(int x) { return x * 26; }
+inline int f9307_27(int x) { return x * 27; }
+inline int f9307_28(int x) { return x * 28; }
+inline int f9307_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9308 */
+#include <vector>
+#include "h7659.h"
+#include "h1209.h"
+#include "h3857.h"
+#include "h8855.h"
+#include "h5882.h"
+#ifdef X
+#include "h9049.h"
+#endif
+struct S9308 { int a; const char *s = "x//y"; };
+inline int f9308_0(int x) { return x * 0; }
+inline int f9308_1(int x) { return x * 1; }
+inline int f9308_2(int x) { return x * 2; }
+inline int f9308_3(int x) { return x * 3; }
+inline int f9308_4(int x) { return x * 4; }
+inline int f9308_5(int x) { return x * 5; }
+inline int f9308_6(int x) { return x * 6; }
+inline int f9308_7(int x) { return x * 7; }
+inline int f9308_8(int x) { return x * 8; }
+inline int f9308_9(int x) { return x * 9; }
+inline int f9308_10(int x) { return x * 10; }
+inline int f9308_11(int x) { return x * 11; }
+inline int f9308_12(int x) { return x * 12; }
+inline int f9308_13(int x) { return x * 13; }
+inline int f9308_14(int x) { return x * 14; }
+inline int f9308_15(int x) { return x * 15; }
+inline int f9308_16(int x) { return x * 16; }
+inline int f9308_17(int x) { return x * 17; }
+inline int f9308_18(int x) { return x * 18; }
+inline int f9308_19(int x) { return x * 19; }
+inline int f9308_20(int x) { return x * 20; }
+inline int f9308_21(int x) { return x * 21; }
+inline int f9308_22(int x) { return x * 22; }
+inline int f9308_23(int x) { return x * 23; }
+inline int f9308_24(int x) { return x * 24; }
+inline int f9308_25(int x) { return x * 25; }
+inline int f9308_26(int x) { return x * 26; }
+inline int f9308_27(int x) { return x * 27; }
+inline int f9308_28(int x) { return x * 28; }
+inline int f9308_29(int x) { return x * 29; }
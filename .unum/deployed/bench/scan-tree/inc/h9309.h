@@ -0,0 +1,42 @@
+#pragma once
+/* header 9309 */
+#include <vector>
+#include "h9664.h"
+#include "h1960.h"
+#include "h3963.h"
+#include "h9149.h"
+#include "h8853.h"
+#ifdef X
+#include "h8688.h"
+#endif
+struct S9309 { int a; const char *s = "x//y"; };
+inline int f9309_0(int x) { return x * 0; }
+inline int f9309_1(int x) { return x * 1; }
+inline int f9309_2(int x) { return x * 2; }
+inline int f9309_3(int x) { return x * 3; }
+inline int f9309_4(int x) { return x * 4; }
+inline int f9309_5(int x) { return x * 5; }
+inline int f9309_6(int x) { return x * 6; }
+inline int f9309_7(int x) { return x * 7; }
+inline int f9309_8(int x) { return x * 8; }
+inline int f9309_9(int x) { return x * 9; }
+inline int f9309_10(int x) { return x * 10; }
+inline int f9309_11(int x) { return x * 11; }
+inline int f9309_12(int x) { return x * 12; }
+inline int f9309_13(int x) { return x * 13; }
+inline int f9309_14(int x) { return x * 14; }
+inline int f9309_15(int x) { return x * 15; }
+inline int f9309_16(int x) { return x * 16; }
+inline int f9309_17(int x) { return x * 17; }
+inline int f9309_18(int x) { return x * 18; }
+inline int f9309_19(int x) { return x * 19; }
+inline int f9309_20(int x) { return x * 20; }
+inline int f9309_21(int x) { return x * 21; }
+inline int f9309_22(int x) { return x * 22; }
+inline int f9309_23(int x) { return x * 23; }
+inline int f9309_24(int x) { return x * 24; }
+inline int f9309_25(int x) { return x * 25; }
+inline int f9309_26(int x) { return x * 26; }
+inline int f9309_27(int x) { return x * 27; }
+inline int f9309_28(int x) { return x * 28; }
+inline int f9309_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9310 */
+#include <vector>
+#include "h5456.h"
+#include "h7737.h"
+#include "h3298.h"
+#include "h1646.h"
+#include "h1663.h"
+#ifdef X
+#include "h2102.h"
+#endif
+struct S9310 { int a; const char *s = "x//y"; };
+inline int f9310_0(int x) { return x * 0; }
+inline int f9310_1(int x) { return x * 1; }
+inline int f9310_2(int x) { return x * 2; }
+inline int f9310_3(int x) { return x * 3; }
+inline int f9310_4(int x) { return x * 4; }
+inline int f9310_5(int x) { return x * 5; }
+inline int f9310_6(int x) { return x * 6; }
+inline int f9310_7(int x) { return x * 7; }
+inline int f9310_8(int x) { return x * 8; }
+inline int f9310_9(int x) { return x * 9; }
+inline int f9310_10(int x) { return x * 10; }
+inline int f9310_11(int x) { return x * 11; }
+inline int f9310_12(int x) { return x * 12; }
+inline int f9310_13(int x) { return x * 13; }
+inline int f9310_14(int x) { return x * 14; }
+inline int f9310_15(int x) { return x * 15; }
+inline int f9310_16(int x) { return x * 16; }
+inline int f9310_17(int x) { return x * 17; }
+inline int f9310_18(int x) { return x * 18; }
+inline int f9310_19(int x) { return x * 19; }
+inline int f9310_20(int x) { return x * 20; }
+inline int f9310_21(int x) { return x * 21; }
+inline int f9310_22(int x) { return x * 22; }
+inline int f9310_23(int x) { return x * 23; }
+inline int f9310_24(int x) { return x * 24; }
+inline int f9310_25(int x) { return x * 25; }
+inline int f9310_26(int x) { return x * 26; }
+inline int f9310_27(int x) { return x * 27; }
+inline int f9310_28(int x) { return x * 28; }
+inline int f9310_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9311 */
+#include <vector>
+#include "h9776.h"
+#include "h2114.h"
+#include "h5887.h"
+#include "h1660.h"
+#include "h250.h"
+#ifdef X
+#include "h9079.h"
+#endif
+struct S9311 { int a; const char *s = "x//y"; };
+inline int f9311_0(int x) { return x * 0; }
+inline int f9311_1(int x) { return x * 1; }
+inline int f9311_2(int x) { return x * 2; }
+inline int f9311_3(int x) { return x * 3; }
+inline int f9311_4(int x) { return x * 4; }
+inline int f9311_5(int x) { return x * 5; }
+inline int f9311_6(int x) { return x * 6; }
+inline int f9311_7(int x) { return x * 7; }
+inline int f9311_8(int x) { return x * 8; }
+inline int f9311_9(int x) { return x * 9; }
+inline int f9311_10(int x) { return x * 10; }
+inline int f9311_11(int x) { return x * 11; }
+inline int f9311_12(int x) { return x * 12; }
+inline int f9311_13(int x) { return x * 13; }
+inline int f9311_14(int x) { return x * 14; }
+inline int f9311_15(int x) { return x * 15; }
+inline int f9311_16(int x) { return x * 16; }
+inline int f9311_17(int x) { return x * 17; }
+inline int f9311_18(int x) { return x * 18; }
+inline int f9311_19(int x) { return x * 19; }
+inline int f9311_20(int x) { return x * 20; }
+inline int f9311_21(int x) { return x * 21; }
+inline int f9311_22(int x) { return x * 22; }
+inline int f9311_23(int x) { return x * 23; }
+inline int f9311_24(int x) { return x * 24; }
+inline int f9311_25(int x) { return x * 25; }
+inline int f9311_26(int x) { return x * 26; }
+inline int f9311_27(int x) { return x * 27; }
+inline int f9311_28(int x) { return x * 28; }
+inline int f9311_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9312 */
+#include <vector>
+#include "h8957.h"
+#include "h462.h"
+#include "h4788.h"
+#include "h5272.h"
+#include "h7200.h"
+#ifdef X
+#include "h957.h"
+#endif
+struct S9312 { int a; const char *s = "x//y"; };
+inline int f9312_0(int x) { return x * 0; }
+inline int f9312_1(int x) { return x * 1; }
+inline int f9312_2(int x) { return x * 2; }
+inline int f9312_3(int x) { return x * 3; }
+inline int f9312_4(int x) { return x * 4; }
+inline int f9312_5(int x) { return x * 5; }
+inline int f9312_6(int x) { return x * 6; }
+inline int f9312_7(int x) { return x * 7; }
+inline int f9312_8(int x) { return x * 8; }
+inline int f9312_9(int x) { return x * 9; }
+inline int f9312_10(int x) { return x * 10; }
+inline int f9312_11(int x) { return x * 11; }
+inline int f9312_12(int x) { return x * 12; }
+inline int f9312_13(int x) { return x * 13; }
+inline int f9312_14(int x) { return x * 14; }
+inline int f9312_15(int x) { return x * 15; }
+inline int f9312_16(int x) { return x * 16; }
+inline int f9312_17(int x) { return x * 17; }
+inline int f9312_18(int x) { return x * 18; }
+inline int f9312_19(int x) { return x * 19; }
+inline int f9312_20(int x) { return x * 20; }
+inline int f9312_21(int x) { return x * 21; }
+inline int f9312_22(int x) { return x * 22; }
+inline int f9312_23(int x) { return x * 23; }
+inline int f9312_24(int x) { return x * 24; }
+inline int f9312_25(int x) { return x * 25; }
+inline int f9312_26(int x) { return x * 26; }
+inline int f9312_27(int x) { return x * 27; }
+inline int f9312_28(int x) { return x * 28; }
+inline int f9312_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9313 */
+#include <vector>
+#include "h2760.h"
+#include "h748.h"
+#include "h2045.h"
+#include "h9046.h"
+#include "h3293.h"
+#ifdef X
+#include "h158.h"
+#endif
+struct S9313 { int a; const char *s = "x//y"; };
+inline int f9313_0(int x) { return x * 0; }
+inline int f9313_1(int x) { return x * 1; }
+inline int f9313_2(int x) { return x * 2; }
+inline int f9313_3(int x) { return x * 3; }
+inline int f9313_4(int x) { return x * 4; }
+inline int f9313_5(int x) { return x * 5; }
+inline int f9313_6(int x) { return x * 6; }
+inline int f9313_7(int x) { return x * 7; }
+inline int f9313_8(int x) { return x * 8; }
+inline int f9313_9(int x) { return x * 9; }
+inline int f9313_10(int x) { return x * 10; }
+inline int f9313_11(int x) { return x * 11; }
+inline int f9313_12(int x) { return x * 12; }
+inline int f9313_13(int x) { return x * 13; }
+inline int f9313_14(int x) { return x * 14; }
+inline int f9313_15(int x) { return x * 15; }
+inline int f9313_16(int x) { return x * 16; }
+inline int f9313_17(int x) { return x * 17; }
+inline int f9313_18(int x) { return x * 18; }
+inline int f9313_19(int x) { return x * 19; }
+inline int f9313_20(int x) { return x * 20; }
+inline int f9313_21(int x) { return x * 21; }
+inline int f9313_22(int x) { return x * 22; }
+inline int f9313_23(int x) { return x * 23; }
+inline int f9313_24(int x) { return x * 24; }
+inline int f9313_25(int x) { return x * 25; }
+inline int f9313_26(int x) { return x * 26; }
+inline int f9313_27(int x) { return x * 27; }
+inline int f9313_28(int x) { return x * 28; }
+inline int f9313_29(int x) { return x * 29; }
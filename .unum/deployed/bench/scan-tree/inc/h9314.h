@@ -0,0 +1,42 @@
+#pragma once
+/* header 9314 */
+#include <vector>
+#include "h8609.h"
+#include "h6021.h"
+#include "h2370.h"
+#include "h4709.h"
+#include "h9200.h"
+#ifdef X
+#include "h3967.h"
+#endif
+struct S9314 { int a; const char *s = "x//y"; };
+inline int f9314_0(int x) { return x * 0; }
+inline int f9314_1(int x) { return x * 1; }
+inline int f9314_2(int x) { return x * 2; }
+inline int f9314_3(int x) { return x * 3; }
+inline int f9314_4(int x) { return x * 4; }
+inline int f9314_5(int x) { return x * 5; }
+inline int f9314_6(int x) { return x * 6; }
+inline int f9314_7(int x) { return x * 7; }
+inline int f9314_8(int x) { return x * 8; }
+inline int f9314_9(int x) { return x * 9; }
+inline int f9314_10(int x) { return x * 10; }
+inline int f9314_11(int x) { return x * 11; }
+inline int f9314_12(int x) { return x * 12; }
+inline int f9314_13(int x) { return x * 13; }
+inline int f9314_14(int x) { return x * 14; }
+inline int f9314_15(int x) { return x * 15; }
+inline int f9314_16(int x) { return x * 16; }
+inline int f9314_17(int x) { return x * 17; }
+inline int f9314_18(int x) { return x * 18; }
+inline int f9314_19(int x) { return x * 19; }
+inline int f9314_20(int x) { return x * 20; }
+inline int f9314_21(int x) { return x * 21; }
+inline int f9314_22(int x) { return x * 22; }
+inline int f9314_23(int x) { return x * 23; }
+inline int f9314_24(int x) { return x * 24; }
+inline int f9314_25(int x) { return x * 25; }
+inline int f9314_26(int x) { return x * 26; }
+inline int f9314_27(int x) { return x * 27; }
+inline int f9314_28(int x) { return x * 28; }
+inline int f9314_29(int x) { return x * 29; }
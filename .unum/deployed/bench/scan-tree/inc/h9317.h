@@ -0,0 +1,42 @@
+#pragma once
+/* header 9317 */
+#include <vector>
+#include "h903.h"
+#include "h4804.h"
+#include "h6352.h"
+#include "h9300.h"
+#include "h6132.h"
+#ifdef X
+#include "h6298.h"
+#endif
+struct S9317 { int a; const char *s = "x//y"; };
+inline int f9317_0(int x) { return x * 0; }
+inline int f9317_1(int x) { return x * 1; }
+inline int f9317_2(int x) { return x * 2; }
+inline int f9317_3(int x) { return x * 3; }
+inline int f9317_4(int x) { return x * 4; }
+inline int f9317_5(int x) { return x * 5; }
+inline int f9317_6(int x) { return x * 6; }
+inline int f9317_7(int x) { return x * 7; }
+inline int f9317_8(int x) { return x * 8; }
+inline int f9317_9(int x) { return x * 9; }
+inline int f9317_10(int x) { return x * 10; }
+inline int f9317_11(int x) { return x * 11; }
+inline int f9317_12(int x) { return x * 12; }
+inline int f9317_13(int x) { return x * 13; }
+inline int f9317_14(int x) { return x * 14; }
+inline int f9317_15(int x) { return x * 15; }
+inline int f9317_16(int x) { return x * 16; }
+inline int f9317_17(int x) { return x * 17; }
+inline int f9317_18(int x) { return x * 18; }
+inline int f9317_19(int x) { return x * 19; }
+inline int f9317_20(int x) { return x * 20; }
+inline int f9317_21(int x) { return x * 21; }
+inline int f9317_22(int x) { return x * 22; }
+inline int f9317_23(int x) { return x * 23; }
+inline int f9317_24(int x) { return x * 24; }
+inline int f9317_25(int x) { return x * 25; }
+inline int f9317_26(int x) { return x * 26; }
+inline int f9317_27(int x) { return x * 27; }
+inline int f9317_28(int x) { return x * 28; }
+inline int f9317_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9318 */
+#include <vector>
+#include "h7587.h"
+#include "h6509.h"
+#include "h1558.h"
+#include "h5344.h"
+#include "h2433.h"
+#ifdef X
+#include "h7553.h"
+#endif
+struct S9318 { int a; const char *s = "x//y"; };
+inline int f9318_0(int x) { return x * 0; }
+inline int f9318_1(int x) { return x * 1; }
+inline int f9318_2(int x) { return x * 2; }
+inline int f9318_3(int x) { return x * 3; }
+inline int f9318_4(int x) { return x * 4; }
+inline int f9318_5(int x) { return x * 5; }
+inline int f9318_6(int x) { return x * 6; }
+inline int f9318_7(int x) { return x * 7; }
+inline int f9318_8(int x) { return x * 8; }
+inline int f9318_9(int x) { return x * 9; }
+inline int f9318_10(int x) { return x * 10; }
+inline int f9318_11(int x) { return x * 11; }
+inline int f9318_12(int x) { return x * 12; }
+inline int f9318_13(int x) { return x * 13; }
+inline int f9318_14(int x) { return x * 14; }
+inline int f9318_15(int x) { return x * 15; }
+inline int f9318_16(int x) { return x * 16; }
+inline int f9318_17(int x) { return x * 17; }
+inline int f9318_18(int x) { return x * 18; }
+inline int f9318_19(int x) { return x * 19; }
+inline int f9318_20(int x) { return x * 20; }
+inline int f9318_21(int x) { return x * 21; }
+inline int f9318_22(int x) { return x * 22; }
+inline int f9318_23(int x) { return x * 23; }
+inline int f9318_24(int x) { return x * 24; }
+inline int f9318_25(int x) { return x * 25; }
+inline int f9318_26(int x) { return x * 26; }
+inline int f9318_27(int x) { return x * 27; }
+inline int f9318_28(int x) { return x * 28; }
+inline int f9318_29(int x) { return x * 29; }
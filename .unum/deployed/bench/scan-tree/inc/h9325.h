@@ -0,0 +1,42 @@
+#pragma once
+/* header 9325 */
+#include <vector>
+#include "h1597.h"
+#include "h3540.h"
+#include "h8451.h"
+#include "h5217.h"
+#include "h5833.h"
+#ifdef X
+#include "h8581.h"
+#endif
+struct S9325 { int a; const char *s = "x//y"; };
+inline int f9325_0(int x) { return x * 0; }
+inline int f9325_1(int x) { return x * 1; }
+inline int f9325_2(int x) { return x * 2; }
+inline int f9325_3(int x) { return x * 3; }
+inline int f9325_4(int x) { return x * 4; }
+inline int f9325_5(int x) { return x * 5; }
+inline int f9325_6(int x) { return x * 6; }
+inline int f9325_7(int x) { return x * 7; }
+inline int f9325_8(int x) { return x * 8; }
+inline int f9325_9(int x) { return x * 9; }
+inline int f9325_10(int x) { return x * 10; }
+inline int f9325_11(int x) { return x * 11; }
+inline int f9325_12(int x) { return x * 12; }
+inline int f9325_13(int x) { return x * 13; }
+inline int f9325_14(int x) { return x * 14; }
+inline int f9325_15(int x) { return x * 15; }
+inline int f9325_16(int x) { return x * 16; }
+inline int f9325_17(int x) { return x * 17; }
+inline int f9325_18(int x) { return x * 18; }
+inline int f9325_19(int x) { return x * 19; }
+inline int f9325_20(int x) { return x * 20; }
+inline int f9325_21(int x) { return x * 21; }
+inline int f9325_22(int x) { return x * 22; }
+inline int f9325_23(int x) { return x * 23; }
+inline int f9325_24(int x) { return x * 24; }
+inline int f9325_25(int x) { return x * 25; }
+inline int f9325_26(int x) { return x * 26; }
+inline int f9325_27(int x) { return x * 27; }
+inline int f9325_28(int x) { return x * 28; }
+inline int f9325_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9329 */
+#include <vector>
+#include "h4092.h"
+#include "h4619.h"
+#include "h8142.h"
+#include "h5022.h"
+#include "h982.h"
+#ifdef X
+#include "h609.h"
+#endif
+struct S9329 { int a; const char *s = "x//y"; };
+inline int f9329_0(int x) { return x * 0; }
+inline int f9329_1(int x) { return x * 1; }
+inline int f9329_2(int x) { return x * 2; }
+inline int f9329_3(int x) { return x * 3; }
+inline int f9329_4(int x) { return x * 4; }
+inline int f9329_5(int x) { return x * 5; }
+inline int f9329_6(int x) { return x * 6; }
+inline int f9329_7(int x) { return x * 7; }
+inline int f9329_8(int x) { return x * 8; }
+inline int f9329_9(int x) { return x * 9; }
+inline int f9329_10(int x) { return x * 10; }
+inline int f9329_11(int x) { return x * 11; }
+inline int f9329_12(int x) { return x * 12; }
+inline int f9329_13(int x) { return x * 13; }
+inline int f9329_14(int x) { return x * 14; }
+inline int f9329_15(int x) { return x * 15; }
+inline int f9329_16(int x) { return x * 16; }
+inline int f9329_17(int x) { return x * 17; }
+inline int f9329_18(int x) { return x * 18; }
+inline int f9329_19(int x) { return x * 19; }
+inline int f9329_20(int x) { return x * 20; }
+inline int f9329_21(int x) { return x * 21; }
+inline int f9329_22(int x) { return x * 22; }
+inline int f9329_23(int x) { return x * 23; }
+inline int f9329_24(int x) { return x * 24; }
+inline int f9329_25(int x) { return x * 25; }
+inline int f9329_26(int x) { return x * 26; }
+inline int f9329_27(int x) { return x * 27; }
+inline int f9329_28(int x) { return x * 28; }
+inline int f9329_29(int x) { return x * 29; }
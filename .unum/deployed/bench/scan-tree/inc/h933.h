@@ -0,0 +1,42 @@
+#pragma once
+/* header 933 */
+#include <vector>
+#include "h5887.h"
+#include "h6545.h"
+#include "h9816.h"
+#include "h1989.h"
+#include "h8136.h"
+#ifdef X
+#include "h8667.h"
+#endif
+struct S933 { int a; const char *s = "x//y"; };
+inline int f933_0(int x) { return x * 0; }
+inline int f933_1(int x) { return x * 1; }
+inline int f933_2(int x) { return x * 2; }
+inline int f933_3(int x) { return x * 3; }
+inline int f933_4(int x) { return x * 4; }
+inline int f933_5(int x) { return x * 5; }
+inline int f933_6(int x) { return x * 6; }
+inline int f933_7(int x) { return x * 7; }
+inline int f933_8(int x) { return x * 8; }
+inline int f933_9(int x) { return x * 9; }
+inline int f933_10(int x) { return x * 10; }
+inline int f933_11(int x) { return x * 11; }
+inline int f933_12(int x) { return x * 12; }
+inline int f933_13(int x) { return x * 13; }
+inline int f933_14(int x) { return x * 14; }
+inline int f933_15(int x) { return x * 15; }
+inline int f933_16(int x) { return x * 16; }
+inline int f933_17(int x) { return x * 17; }
+inline int f933_18(int x) { return x * 18; }
+inline int f933_19(int x) { return x * 19; }
+inline int f933_20(int x) { return x * 20; }
+inline int f933_21(int x) { return x * 21; }
+inline int f933_22(int x) { return x * 22; }
+inline int f933_23(int x) { return x * 23; }
+inline int f933_24(int x) { return x * 24; }
+inline int f933_25(int x) { return x * 25; }
+inline int f933_26(int x) { return x * 26; }
+inline int f933_27(int x) { return x * 27; }
+inline int f933_28(int x) { return x * 28; }
+inline int f933_29(int x) { return x * 29; }
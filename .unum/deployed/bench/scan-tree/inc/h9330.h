@@ -0,0 +1,42 @@
+#pragma once
+/* header 9330 */
+#include <vector>
+#include "h4262.h"
+#include "h8151.h"
+#include "h6005.h"
+#include "h9878.h"
+#include "h5606.h"
+#ifdef X
+#include "h8656.h"
+#endif
+struct S9330 { int a; const char *s = "x//y"; };
+inline int f9330_0(int x) { return x * 0; }
+inline int f9330_1(int x) { return x * 1; }
+inline int f9330_2(int x) { return x * 2; }
+inline int f9330_3(int x) { return x * 3; }
+inline int f9330_4(int x) { return x * 4; }
+inline int f9330_5(int x) { return x * 5; }
+inline int f9330_6(int x) { return x * 6; }
+inline int f9330_7(int x) { return x * 7; }
+inline int f9330_8(int x) { return x * 8; }
+inline int f9330_9(int x) { return x * 9; }
+inline int f9330_10(int x) { return x * 10; }
+inline int f9330_11(int x) { return x * 11; }
+inline int f9330_12(int x) { return x * 12; }
+inline int f9330_13(int x) { return x * 13; }
+inline int f9330_14(int x) { return x * 14; }
+inline int f9330_15(int x) { return x * 15; }
+inline int f9330_16(int x) { return x * 16; }
+inline int f9330_17(int x) { return x * 17; }
+inline int f9330_18(int x) { return x * 18; }
+inline int f9330_19(int x) { return x * 19; }
+inline int f9330_20(int x) { return x * 20; }
+inline int f9330_21(int x) { return x * 21; }
+inline int f9330_22(int x) { return x * 22; }
+inline int f9330_23(int x) { return x * 23; }
+inline int f9330_24(int x) { return x * 24; }
+inline int f9330_25(int x) { return x * 25; }
+inline int f9330_26(int x) { return x * 26; }
+inline int f9330_27(int x) { return x * 27; }
+inline int f9330_28(int x) { return x * 28; }
+inline int f9330_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9332 */
+#include <vector>
+#include "h8137.h"
+#include "h4163.h"
+#include "h1077.h"
+#include "h3008.h"
+#include "h4332.h"
+#ifdef X
+#include "h6840.h"
+#endif
+struct S9332 { int a; const char *s = "x//y"; };
+inline int f9332_0(int x) { return x * 0; }
+inline int f9332_1(int x) { return x * 1; }
+inline int f9332_2(int x) { return x * 2; }
+inline int f9332_3(int x) { return x * 3; }
+inline int f9332_4(int x) { return x * 4; }
+inline int f9332_5(int x) { return x * 5; }
+inline int f9332_6(int x) { return x * 6; }
+inline int f9332_7(int x) { return x * 7; }
+inline int f9332_8(int x) { return x * 8; }
+inline int f9332_9(int x) { return x * 9; }
+inline int f9332_10(int x) { return x * 10; }
+inline int f9332_11(int x) { return x * 11; }
+inline int f9332_12(int x) { return x * 12; }
+inline int f9332_13(int x) { return x * 13; }
+inline int f9332_14(int x) { return x * 14; }
+inline int f9332_15(int x) { return x * 15; }
+inline int f9332_16(int x) { return x * 16; }
+inline int f9332_17(int x) { return x * 17; }
+inline int f9332_18(int x) { return x * 18; }
+inline int f9332_19(int x) { return x * 19; }
+inline int f9332_20(int x) { return x * 20; }
+inline int f9332_21(int x) { return x * 21; }
+inline int f9332_22(int x) { return x * 22; }
+inline int f9332_23(int x) { return x * 23; }
+inline int f9332_24(int x) { return x * 24; }
+inline int f9332_25(int x) { return x * 25; }
+inline int f9332_26(int x) { return x * 26; }
+inline int f9332_27(int x) { return x * 27; }
+inline int f9332_28(int x) { return x * 28; }
+inline int f9332_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9335 */
+#include <vector>
+#include "h6019.h"
+#include "h7952.h"
+#include "h7761.h"
+#include "h4790.h"
+#include "h8109.h"
+#ifdef X
+#include "h7763.h"
+#endif
+struct S9335 { int a; const char *s = "x//y"; };
+inline int f9335_0(int x) { return x * 0; }
+inline int f9335_1(int x) { return x * 1; }
+inline int f9335_2(int x) { return x * 2; }
+inline int f9335_3(int x) { return x * 3; }
+inline int f9335_4(int x) { return x * 4; }
+inline int f9335_5(int x) { return x * 5; }
+inline int f9335_6(int x) { return x * 6; }
+inline int f9335_7(int x) { return x * 7; }
+inline int f9335_8(int x) { return x * 8; }
+inline int f9335_9(int x) { return x * 9; }
+inline int f9335_10(int x) { return x * 10; }
+inline int f9335_11(int x) { return x * 11; }
+inline int f9335_12(int x) { return x * 12; }
+inline int f9335_13(int x) { return x * 13; }
+inline int f9335_14(int x) { return x * 14; }
+inline int f9335_15(int x) { return x * 15; }
+inline int f9335_16(int x) { return x * 16; }
+inline int f9335_17(int x) { return x * 17; }
+inline int f9335_18(int x) { return x * 18; }
+inline int f9335_19(int x) { return x * 19; }
+inline int f9335_20(int x) { return x * 20; }
+inline int f9335_21(int x) { return x * 21; }
+inline int f9335_22(int x) { return x * 22; }
+inline int f9335_23(int x) { return x * 23; }
+inline int f9335_24(int x) { return x * 24; }
+inline int f9335_25(int x) { return x * 25; }
+inline int f9335_26(int x) { return x * 26; }
+inline int f9335_27(int x) { return x * 27; }
+inline int f9335_28(int x) { return x * 28; }
+inline int f9335_29(int x) { return x * 29; }
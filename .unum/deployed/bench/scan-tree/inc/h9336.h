@@ -0,0 +1,42 @@
+#pragma once
+/* header 9336 */
+#include <vector>
+#include "h4996.h"
+#include "h3475.h"
+#include "h167.h"
+#include "h7088.h"
+#include "h2735.h"
+#ifdef X
+#include "h9375.h"
+#endif
+struct S9336 { int a; const char *s = "x//y"; };
+inline int f9336_0(int x) { return x * 0; }
+inline int f9336_1(int x) { return x * 1; }
+inline int f9336_2(int x) { return x * 2; }
+inline int f9336_3(int x) { return x * 3; }
+inline int f9336_4(int x) { return x * 4; }
+inline int f9336_5(int x) { return x * 5; }
+inline int f9336_6(int x) { return x * 6; }
+inline int f9336_7(int x) { return x * 7; }
+inline int f9336_8(int x) { return x * 8; }
+inline int f9336_9(int x) { return x * 9; }
+inline int f9336_10(int x) { return x * 10; }
+inline int f9336_11(int x) { return x * 11; }
+inline int f9336_12(int x) { return x * 12; }
+inline int f9336_13(int x) { return x * 13; }
+inline int f9336_14(int x) { return x * 14; }
+inline int f9336_15(int x) { return x * 15; }
+inline int f9336_16(int x) { return x * 16; }
+inline int f9336_17(int x) { return x * 17; }
+inline int f9336_18(int x) { return x * 18; }
+inline int f9336_19(int x) { return x * 19; }
+inline int f9336_20(int x) { return x * 20; }
+inline int f9336_21(int x) { return x * 21; }
+inline int f9336_22(int x) { return x * 22; }
+inline int f9336_23(int x) { return x * 23; }
+inline int f9336_24(int x) { return x * 24; }
+inline int f9336_25(int x) { return x * 25; }
+inline int f9336_26(int x) { return x * 26; }
+inline int f9336_27(int x) { return x * 27; }
+inline int f9336_28(int x) { return x * 28; }
+inline int f9336_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9338 */
+#include <vector>
+#include "h5828.h"
+#include "h6183.h"
+#include "h9695.h"
+#include "h3784.h"
+#include "h9956.h"
+#ifdef X
+#include "h8206.h"
+#endif
+struct S9338 { int a; const char *s = "x//y"; };
+inline int f9338_0(int x) { return x * 0; }
+inline int f9338_1(int x) { return x * 1; }
+inline int f9338_2(int x) { return x * 2; }
+inline int f9338_3(int x) { return x * 3; }
+inline int f9338_4(int x) { return x * 4; }
+inline int f9338_5(int x) { return x * 5; }
+inline int f9338_6(int x) { return x * 6; }
+inline int f9338_7(int x) { return x * 7; }
+inline int f9338_8(int x) { return x * 8; }
+inline int f9338_9(int x) { return x * 9; }
+inline int f9338_10(int x) { return x * 10; }
+inline int f9338_11(int x) { return x * 11; }
+inline int f9338_12(int x) { return x * 12; }
+inline int f9338_13(int x) { return x * 13; }
+inline int f9338_14(int x) { return x * 14; }
+inline int f9338_15(int x) { return x * 15; }
+inline int f9338_16(int x) { return x * 16; }
+inline int f9338_17(int x) { return x * 17; }
+inline int f9338_18(int x) { return x * 18; }
+inline int f9338_19(int x) { return x * 19; }
+inline int f9338_20(int x) { return x * 20; }
+inline int f9338_21(int x) { return x * 21; }
+inline int f9338_22(int x) { return x * 22; }
+inline int f9338_23(int x) { return x * 23; }
+inline int f9338_24(int x) { return x * 24; }
+inline int f9338_25(int x) { return x * 25; }
+inline int f9338_26(int x) { return x * 26; }
+inline int f9338_27(int x) { return x * 27; }
+inline int f9338_28(int x) { return x * 28; }
+inline int f9338_29(int x) { return x * 29; }
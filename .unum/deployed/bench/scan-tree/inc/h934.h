@@ -0,0 +1,42 @@
+#pragma once
+/* header 934 */
+#include <vector>
+#include "h3293.h"
+#include "h9984.h"
+#include "h9386.h"
+#include "h5808.h"
+#include "h8448.h"
+#ifdef X
+#include "h3086.h"
+#endif
+struct S934 { int a; const char *s = "x//y"; };
+inline int f934_0(int x) { return x * 0; }
+inline int f934_1(int x) { return x * 1; }
+inline int f934_2(int x) { return x * 2; }
+inline int f934_3(int x) { return x * 3; }
+inline int f934_4(int x) { return x * 4; }
+inline int f934_5(int x) { return x * 5; }
+inline int f934_6(int x) { return x * 6; }
+inline int f934_7(int x) { return x * 7; }
+inline int f934_8(int x) { return x * 8; }
+inline int f934_9(int x) { return x * 9; }
+inline int f934_10(int x) { return x * 10; }
+inline int f934_11(int x) { return x * 11; }
+inline int f934_12(int x) { return x * 12; }
+inline int f934_13(int x) { return x * 13; }
+inline int f934_14(int x) { return x * 14; }
+inline int f934_15(int x) { return x * 15; }
+inline int f934_16(int x) { return x * 16; }
+inline int f934_17(int x) { return x * 17; }
+inline int f934_18(int x) { return x * 18; }
+inline int f934_19(int x) { return x * 19; }
+inline int f934_20(int x) { return x * 20; }
+inline int f934_21(int x) { return x * 21; }
+inline int f934_22(int x) { return x * 22; }
+inline int f934_23(int x) { return x * 23; }
+inline int f934_24(int x) { return x * 24; }
+inline int f934_25(int x) { return x * 25; }
+inline int f934_26(int x) { return x * 26; }
+inline int f934_27(int x) { return x * 27; }
+inline int f934_28(int x) { return x * 28; }
+inline int f934_29(int x) { return x * 29; }
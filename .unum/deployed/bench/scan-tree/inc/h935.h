@@ -0,0 +1,42 @@
+#pragma once
+/* header 935 */
+#include <vector>
+#include "h4133.h"
+#include "h4969.h"
+#include "h868.h"
+#include "h8828.h"
+#include "h6004.h"
+#ifdef X
+#include "h6447.h"
+#endif
+struct S935 { int a; const char *s = "x//y"; };
+inline int f935_0(int x) { return x * 0; }
+inline int f935_1(int x) { return x * 1; }
+inline int f935_2(int x) { return x * 2; }
+inline int f935_3(int x) { return x * 3; }
+inline int f935_4(int x) { return x * 4; }
+inline int f935_5(int x) { return x * 5; }
+inline int f935_6(int x) { return x * 6; }
+inline int f935_7(int x) { return x * 7; }
+inline int f935_8(int x) { return x * 8; }
+inline int f935_9(int x) { return x * 9; }
+inline int f935_10(int x) { return x * 10; }
+inline int f935_11(int x) { return x * 11; }
+inline int f935_12(int x) { return x * 12; }
+inline int f935_13(int x) { return x * 13; }
+inline int f935_14(int x) { return x * 14; }
+inline int f935_15(int x) { return x * 15; }
+inline int f935_16(int x) { return x * 16; }
+inline int f935_17(int x) { return x * 17; }
+inline int f935_18(int x) { return x * 18; }
+inline int f935_19(int x) { return x * 19; }
+inline int f935_20(int x) { return x * 20; }
+inline int f935_21(int x) { return x * 21; }
+inline int f935_22(int x) { return x * 22; }
+inline int f935_23(int x) { return x * 23; }
+inline int f935_24(int x) { return x * 24; }
+inline int f935_25(int x) { return x * 25; }
+inline int f935_26(int x) { return x * 26; }
+inline int f935_27(int x) { return x * 27; }
+inline int f935_28(int x) { return x * 28; }
+inline int f935_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9355 */
+#include <vector>
+#include "h7367.h"
+#include "h4108.h"
+#include "h1753.h"
+#include "h5142.h"
+#include "h7822.h"
+#ifdef X
+#include "h8475.h"
+#endif
+struct S9355 { int a; const char *s = "x//y"; };
+inline int f9355_0(int x) { return x * 0; }
+inline int f9355_1(int x) { return x * 1; }
+inline int f9355_2(int x) { return x * 2; }
+inline int f9355_3(int x) { return x * 3; }
+inline int f9355_4(int x) { return x * 4; }
+inline int f9355_5(int x) { return x * 5; }
+inline int f9355_6(int x) { return x * 6; }
+inline int f9355_7(int x) { return x * 7; }
+inline int f9355_8(int x) { return x * 8; }
+inline int f9355_9(int x) { return x * 9; }
+inline int f9355_10(int x) { return x * 10; }
+inline int f9355_11(int x) { return x * 11; }
+inline int f9355_12(int x) { return x * 12; }
+inline int f9355_13(int x) { return x * 13; }
+inline int f9355_14(int x) { return x * 14; }
+inline int f9355_15(int x) { return x * 15; }
+inline int f9355_16(int x) { return x * 16; }
+inline int f9355_17(int x) { return x * 17; }
+inline int f9355_18(int x) { return x * 18; }
+inline int f9355_19(int x) { return x * 19; }
+inline int f9355_20(int x) { return x * 20; }
+inline int f9355_21(int x) { return x * 21; }
+inline int f9355_22(int x) { return x * 22; }
+inline int f9355_23(int x) { return x * 23; }
+inline int f9355_24(int x) { return x * 24; }
+inline int f9355_25(int x) { return x * 25; }
+inline int f9355_26(int x) { return x * 26; }
+inline int f9355_27(int x) { return x * 27; }
+inline int f9355_28(int x) { return x * 28; }
+inline int f9355_29(int x) { return x * 29; }
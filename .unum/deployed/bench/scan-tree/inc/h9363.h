@@ -0,0 +1,42 @@
+#pragma once
+/* header 9363 */
+#include <vector>
+#include "h6677.h"
+#include "h3191.h"
+#include "h8103.h"
+#include "h5466.h"
+#include "h6667.h"
+#ifdef X
+#include "h8509.h"
+#endif
+struct S9363 { int a; const char *s = "x//y"; };
+inline int f9363_0(int x) { return x * 0; }
+inline int f9363_1(int x) { return x * 1; }
+inline int f9363_2(int x) { return x * 2; }
+inline int f9363_3(int x) { return x * 3; }
+inline int f9363_4(int x) { return x * 4; }
+inline int f9363_5(int x) { return x * 5; }
+inline int f9363_6(int x) { return x * 6; }
+inline int f9363_7(int x) { return x * 7; }
+inline int f9363_8(int x) { return x * 8; }
+inline int f9363_9(int x) { return x * 9; }
+inline int f9363_10(int x) { return x * 10; }
+inline int f9363_11(int x) { return x * 11; }
+inline int f9363_12(int x) { return x * 12; }
+inline int f9363_13(int x) { return x * 13; }
+inline int f9363_14(int x) { return x * 14; }
+inline int f9363_15(int x) { return x * 15; }
+inline int f9363_16(int x) { return x * 16; }
+inline int f9363_17(int x) { return x * 17; }
+inline int f9363_18(int x) { return x * 18; }
+inline int f9363_19(int x) { return x * 19; }
+inline int f9363_20(int x) { return x * 20; }
+inline int f9363_21(int x) { return x * 21; }
+inline int f9363_22(int x) { return x * 22; }
+inline int f9363_23(int x) { return x * 23; }
+inline int f9363_24(int x) { return x * 24; }
+inline int f9363_25(int x) { return x * 25; }
+inline int f9363_26(int x) { return x * 26; }
+inline int f9363_27(int x) { return x * 27; }
+inline int f9363_28(int x) { return x * 28; }
+inline int f9363_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9364 */
+#include <vector>
+#include "h5189.h"
+#include "h5877.h"
+#include "h9477.h"
+#include "h177.h"
+#include "h6256.h"
+#ifdef X
+#include "h3373.h"
+#endif
+struct S9364 { int a; const char *s = "x//y"; };
+inline int f9364_0(int x) { return x * 0; }
+inline int f9364_1(int x) { return x * 1; }
+inline int f9364_2(int x) { return x * 2; }
+inline int f9364_3(int x) { return x * 3; }
+inline int f9364_4(int x) { return x * 4; }
+inline int f9364_5(int x) { return x * 5; }
+inline int f9364_6(int x) { return x * 6; }
+inline int f9364_7(int x) { return x * 7; }
+inline int f9364_8(int x) { return x * 8; }
+inline int f9364_9(int x) { return x * 9; }
+inline int f9364_10(int x) { return x * 10; }
+inline int f9364_11(int x) { return x * 11; }
+inline int f9364_12(int x) { return x * 12; }
+inline int f9364_13(int x) { return x * 13; }
+inline int f9364_14(int x) { return x * 14; }
+inline int f9364_15(int x) { return x * 15; }
+inline int f9364_16(int x) { return x * 16; }
+inline int f9364_17(int x) { return x * 17; }
+inline int f9364_18(int x) { return x * 18; }
+inline int f9364_19(int x) { return x * 19; }
+inline int f9364_20(int x) { return x * 20; }
+inline int f9364_21(int x) { return x * 21; }
+inline int f9364_22(int x) { return x * 22; }
+inline int f9364_23(int x) { return x * 23; }
+inline int f9364_24(int x) { return x * 24; }
+inline int f9364_25(int x) { return x * 25; }
+inline int f9364_26(int x) { return x * 26; }
+inline int f9364_27(int x) { return x * 27; }
+inline int f9364_28(int x) { return x * 28; }
+inline int f9364_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9365 */
+#include <vector>
+#include "h757.h"
+#include "h6037.h"
+#include "h22.h"
+#include "h7490.h"
+#include "h2534.h"
+#ifdef X
+#include "h281.h"
+#endif
+struct S9365 { int a; const char *s = "x//y"; };
+inline int f9365_0(int x) { return x * 0; }
+inline int f9365_1(int x) { return x * 1; }
+inline int f9365_2(int x) { return x * 2; }
+inline int f9365_3(int x) { return x * 3; }
+inline int f9365_4(int x) { return x * 4; }
+inline int f9365_5(int x) { return x * 5; }
+inline int f9365_6(int x) { return x * 6; }
+inline int f9365_7(int x) { return x * 7; }
+inline int f9365_8(int x) { return x * 8; }
+inline int f9365_9(int x) { return x * 9; }
+inline int f9365_10(int x) { return x * 10; }
+inline int f9365_11(int x) { return x * 11; }
+inline int f9365_12(int x) { return x * 12; }
+inline int f9365_13(int x) { return x * 13; }
+inline int f9365_14(int x) { return x * 14; }
+inline int f9365_15(int x) { return x * 15; }
+inline int f9365_16(int x) { return x * 16; }
+inline int f9365_17(int x) { return x * 17; }
+inline int f9365_18(int x) { return x * 18; }
+inline int f9365_19(int x) { return x * 19; }
+inline int f9365_20(int x) { return x * 20; }
+inline int f9365_21(int x) { return x * 21; }
+inline int f9365_22(int x) { return x * 22; }
+inline int f9365_23(int x) { return x * 23; }
+inline int f9365_24(int x) { return x * 24; }
+inline int f9365_25(int x) { return x * 25; }
+inline int f9365_26(int x) { return x * 26; }
+inline int f9365_27(int x) { return x * 27; }
+inline int f9365_28(int x) { return x * 28; }
+inline int f9365_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9366 */
+#include <vector>
+#include "h9593.h"
+#include "h6498.h"
+#include "h1853.h"
+#include "h5844.h"
+#include "h6622.h"
+#ifdef X
+#include "h1147.h"
+#endif
+struct S9366 { int a; const char *s = "x//y"; };
+inline int f9366_0(int x) { return x * 0; }
+inline int f9366_1(int x) { return x * 1; }
+inline int f9366_2(int x) { return x * 2; }
+inline int f9366_3(int x) { return x * 3; }
+inline int f9366_4(int x) { return x * 4; }
+inline int f9366_5(int x) { return x * 5; }
+inline int f9366_6(int x) { return x * 6; }
+inline int f9366_7(int x) { return x * 7; }
+inline int f9366_8(int x) { return x * 8; }
+inline int f9366_9(int x) { return x * 9; }
+inline int f9366_10(int x) { return x * 10; }
+inline int f9366_11(int x) { return x * 11; }
+inline int f9366_12(int x) { return x * 12; }
+inline int f9366_13(int x) { return x * 13; }
+inline int f9366_14(int x) { return x * 14; }
+inline int f9366_15(int x) { return x * 15; }
+inline int f9366_16(int x) { return x * 16; }
+inline int f9366_17(int x) { return x * 17; }
+inline int f9366_18(int x) { return x * 18; }
+inline int f9366_19(int x) { return x * 19; }
+inline int f9366_20(int x) { return x * 20; }
+inline int f9366_21(int x) { return x * 21; }
+inline int f9366_22(int x) { return x * 22; }
+inline int f9366_23(int x) { return x * 23; }
+inline int f9366_24(int x) { return x * 24; }
+inline int f9366_25(int x) { return x * 25; }
+inline int f9366_26(int x) { return x * 26; }
+inline int f9366_27(int x) { return x * 27; }
+inline int f9366_28(int x) { return x * 28; }
+inline int f9366_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9368 */
+#include <vector>
+#include "h4143.h"
+#include "h5452.h"
+#include "h8965.h"
+#include "h8677.h"
+#include "h2020.h"
+#ifdef X
+#include "h4828.h"
+#endif
+struct S9368 { int a; const char *s = "x//y"; };
+inline int f9368_0(int x) { return x * 0; }
+inline int f9368_1(int x) { return x * 1; }
+inline int f9368_2(int x) { return x * 2; }
+inline int f9368_3(int x) { return x * 3; }
+inline int f9368_4(int x) { return x * 4; }
+inline int f9368_5(int x) { return x * 5; }
+inline int f9368_6(int x) { return x * 6; }
+inline int f9368_7(int x) { return x * 7; }
+inline int f9368_8(int x) { return x * 8; }
+inline int f9368_9(int x) { return x * 9; }
+inline int f9368_10(int x) { return x * 10; }
+inline int f9368_11(int x) { return x * 11; }
+inline int f9368_12(int x) { return x * 12; }
+inline int f9368_13(int x) { return x * 13; }
+inline int f9368_14(int x) { return x * 14; }
+inline int f9368_15(int x) { return x * 15; }
+inline int f9368_16(int x) { return x * 16; }
+inline int f9368_17(int x) { return x * 17; }
+inline int f9368_18(int x) { return x * 18; }
+inline int f9368_19(int x) { return x * 19; }
+inline int f9368_20(int x) { return x * 20; }
+inline int f9368_21(int x) { return x * 21; }
+inline int f9368_22(int x) { return x * 22; }
+inline int f9368_23(int x) { return x * 23; }
+inline int f9368_24(int x) { return x * 24; }
+inline int f9368_25(int x) { return x * 25; }
+inline int f9368_26(int x) { return x * 26; }
+inline int f9368_27(int x) { return x * 27; }
+inline int f9368_28(int x) { return x * 28; }
+inline int f9368_29(int x) { return x * 29; }
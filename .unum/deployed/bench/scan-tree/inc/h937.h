@@ -0,0 +1,42 @@
+#pragma once
+/* header 937 */
+#include <vector>
+#include "h1251.h"
+#include "h4264.h"
+#include "h5990.h"
+#include "h1523.h"
+#include "h7778.h"
+#ifdef X
+#include "h9769.h"
+#endif
+struct S937 { int a; const char *s = "x//y"; };
+inline int f937_0(int x) { return x * 0; }
+inline int f937_1(int x) { return x * 1; }
+inline int f937_2(int x) { return x * 2; }
+inline int f937_3(int x) { return x * 3; }
+inline int f937_4(int x) { return x * 4; }
+inline int f937_5(int x) { return x * 5; }
+inline int f937_6(int x) { return x * 6; }
+inline int f937_7(int x) { return x * 7; }
+inline int f937_8(int x) { return x * 8; }
+inline int f937_9(int x) { return x * 9; }
+inline int f937_10(int x) { return x * 10; }
+inline int f937_11(int x) { return x * 11; }
+inline int f937_12(int x) { return x * 12; }
+inline int f937_13(int x) { return x * 13; }
+inline int f937_14(int x) { return x * 14; }
+inline int f937_15(int x) { return x * 15; }
+inline int f937_16(int x) { return x * 16; }
+inline int f937_17(int x) { return x * 17; }
+inline int f937_18(int x) { return x * 18; }
+inline int f937_19(int x) { return x * 19; }
+inline int f937_20(int x) { return x * 20; }
+inline int f937_21(int x) { return x * 21; }
+inline int f937_22(int x) { return x * 22; }
+inline int f937_23(int x) { return x * 23; }
+inline int f937_24(int x) { return x * 24; }
+inline int f937_25(int x) { return x * 25; }
+inline int f937_26(int x) { return x * 26; }
+inline int f937_27(int x) { return x * 27; }
+inline int f937_28(int x) { return x * 28; }
+inline int f937_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9370 */
+#include <vector>
+#include "h5644.h"
+#include "h2606.h"
+#include "h1083.h"
+#include "h5451.h"
+#include "h3493.h"
+#ifdef X
+#include "h7786.h"
+#endif
+struct S9370 { int a; const char *s = "x//y"; };
+inline int f9370_0(int x) { return x * 0; }
+inline int f9370_1(int x) { return x * 1; }
+inline int f9370_2(int x) { return x * 2; }
+inline int f9370_3(int x) { return x * 3; }
+inline int f9370_4(int x) { return x * 4; }
+inline int f9370_5(int x) { return x * 5; }
+inline int f9370_6(int x) { return x * 6; }
+inline int f9370_7(int x) { return x * 7; }
+inline int f9370_8(int x) { return x * 8; }
+inline int f9370_9(int x) { return x * 9; }
+inline int f9370_10(int x) { return x * 10; }
+inline int f9370_11(int x) { return x * 11; }
+inline int f9370_12(int x) { return x * 12; }
+inline int f9370_13(int x) { return x * 13; }
+inline int f9370_14(int x) { return x * 14; }
+inline int f9370_15(int x) { return x * 15; }
+inline int f9370_16(int x) { return x * 16; }
+inline int f9370_17(int x) { return x * 17; }
+inline int f9370_18(int x) { return x * 18; }
+inline int f9370_19(int x) { return x * 19; }
+inline int f9370_20(int x) { return x * 20; }
+inline int f9370_21(int x) { return x * 21; }
+inline int f9370_22(int x) { return x * 22; }
+inline int f9370_23(int x) { return x * 23; }
+inline int f9370_24(int x) { return x * 24; }
+inline int f9370_25(int x) { return x * 25; }
+inline int f9370_26(int x) { return x * 26; }
+inline int f9370_27(int x) { return x * 27; }
+inline int f9370_28(int x) { return x * 28; }
+inline int f9370_29(int x) { return x * 29; }
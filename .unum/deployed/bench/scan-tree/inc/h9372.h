@@ -0,0 +1,42 @@
+#pragma once
+/* header 9372 */
+#include <vector>
+#include "h2720.h"
+#include "h8213.h"
+#include "h7789.h"
+#include "h8988.h"
+#include "h1693.h"
+#ifdef X
+#include "h68.h"
+#endif
+struct S9372 { int a; const char *s = "x//y"; };
+inline int f9372_0(int x) { return x * 0; }
+inline int f9372_1(int x) { return x * 1; }
+inline int f9372_2(int x) { return x * 2; }
+inline int f9372_3(int x) { return x * 3; }
+inline int f9372_4(int x) { return x * 4; }
+inline int f9372_5(int x) { return x * 5; }
+inline int f9372_6(int x) { return x * 6; }
+inline int f9372_7(int x) { return x * 7; }
+inline int f9372_8(int x) { return x * 8; }
+inline int f9372_9(int x) { return x * 9; }
+inline int f9372_10(int x) { return x * 10; }
+inline int f9372_11(int x) { return x * 11; }
+inline int f9372_12(int x) { return x * 12; }
+inline int f9372_13(int x) { return x * 13; }
+inline int f9372_14(int x) { return x * 14; }
+inline int f9372_15(int x) { return x * 15; }
+inline int f9372_16(int x) { return x * 16; }
+inline int f9372_17(int x) { return x * 17; }
+inline int f9372_18(int x) { return x * 18; }
+inline int f9372_19(int x) { return x * 19; }
+inline int f9372_20(int x) { return x * 20; }
+inline int f9372_21(int x) { return x * 21; }
+inline int f9372_22(int x) { return x * 22; }
+inline int f9372_23(int x) { return x * 23; }
+inline int f9372_24(int x) { return x * 24; }
+inline int f9372_25(int x) { return x * 25; }
+inline int f9372_26(int x) { return x * 26; }
+inline int f9372_27(int x) { return x * 27; }
+inline int f9372_28(int x) { return x * 28; }
+inline int f9372_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 938 */
+#include <vector>
+#include "h8502.h"
+#include "h714.h"
+#include "h7411.h"
+#include "h2414.h"
+#include "h2373.h"
+#ifdef X
+#include "h6435.h"
+#endif
+struct S938 { int a; const char *s = "x//y"; };
+inline int f938_0(int x) { return x * 0; }
+inline int f938_1(int x) { return x * 1; }
+inline int f938_2(int x) { return x * 2; }
+inline int f938_3(int x) { return x * 3; }
+inline int f938_4(int x) { return x * 4; }
+inline int f938_5(int x) { return x * 5; }
+inline int f938_6(int x) { return x * 6; }
+inline int f938_7(int x) { return x * 7; }
+inline int f938_8(int x) { return x * 8; }
+inline int f938_9(int x) { return x * 9; }
+inline int f938_10(int x) { return x * 10; }
+inline int f938_11(int x) { return x * 11; }
+inline int f938_12(int x) { return x * 12; }
+inline int f938_13(int x) { return x * 13; }
+inline int f938_14(int x) { return x * 14; }
+inline int f938_15(int x) { return x * 15; }
+inline int f938_16(int x) { return x * 16; }
+inline int f938_17(int x) { return x * 17; }
+inline int f938_18(int x) { return x * 18; }
+inline int f938_19(int x) { return x * 19; }
+inline int f938_20(int x) { return x * 20; }
+inline int f938_21(int x) { return x * 21; }
+inline int f938_22(int x) { return x * 22; }
+inline int f938_23(int x) { return x * 23; }
+inline int f938_24(int x) { return x * 24; }
+inline int f938_25(int x) { return x * 25; }
+inline int f938_26(int x) { return x * 26; }
+inline int f938_27(int x) { return x * 27; }
+inline int f938_28(int x) { return x * 28; }
+inline int f938_29(int x) { return x * 29; }
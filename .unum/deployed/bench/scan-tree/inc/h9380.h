@@ -0,0 +1,42 @@
+#pragma once
+/* header 9380 */
+#include <vector>
+#include "h2186.h"
+#include "h2997.h"
+#include "h85.h"
+#include "h638.h"
+#include "h7159.h"
+#ifdef X
+#include "h5729.h"
+#endif
+struct S9380 { int a; const char *s = "x//y"; };
+inline int f9380_0(int x) { return x * 0; }
+inline int f9380_1(int x) { return x * 1; }
+inline int f9380_2(int x) { return x * 2; }
+inline int f9380_3(int x) { return x * 3; }
+inline int f9380_4(int x) { return x * 4; }
+inline int f9380_5(int x) { return x * 5; }
+inline int f9380_6(int x) { return x * 6; }
+inline int f9380_7(int x) { return x * 7; }
+inline int f9380_8(int x) { return x * 8; }
+inline int f9380_9(int x) { return x * 9; }
+inline int f9380_10(int x) { return x * 10; }
+inline int f9380_11(int x) { return x * 11; }
+inline int f9380_12(int x) { return x * 12; }
+inline int f9380_13(int x) { return x * 13; }
+inline int f9380_14(int x) { return x * 14; }
+inline int f9380_15(int x) { return x * 15; }
+inline int f9380_16(int x) { return x * 16; }
+inline int f9380_17(int x) { return x * 17; }
+inline int f9380_18(int x) { return x * 18; }
+inline int f9380_19(int x) { return x * 19; }
+inline int f9380_20(int x) { return x * 20; }
+inline int f9380_21(int x) { return x * 21; }
+inline int f9380_22(int x) { return x * 22; }
+inline int f9380_23(int x) { return x * 23; }
+inline int f9380_24(int x) { return x * 24; }
+inline int f9380_25(int x) { return x * 25; }
+inline int f9380_26(int x) { return x * 26; }
+inline int f9380_27(int x) { return x * 27; }
+inline int f9380_28(int x) { return x * 28; }
+inline int f9380_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9383 */
+#include <vector>
+#include "h5433.h"
+#include "h9326.h"
+#include "h4582.h"
+#include "h9988.h"
+#include "h259.h"
+#ifdef X
+#include "h8970.h"
+#endif
+struct S9383 { int a; const char *s = "x//y"; };
+inline int f9383_0(int x) { return x * 0; }
+inline int f9383_1(int x) { return x * 1; }
+inline int f9383_2(int x) { return x * 2; }
+inline int f9383_3(int x) { return x * 3; }
+inline int f9383_4(int x) { return x * 4; }
+inline int f9383_5(int x) { return x * 5; }
+inline int f9383_6(int x) { return x * 6; }
+inline int f9383_7(int x) { return x * 7; }
+inline int f9383_8(int x) { return x * 8; }
+inline int f9383_9(int x) { return x * 9; }
+inline int f9383_10(int x) { return x * 10; }
+inline int f9383_11(int x) { return x * 11; }
+inline int f9383_12(int x) { return x * 12; }
+inline int f9383_13(int x) { return x * 13; }
+inline int f9383_14(int x) { return x * 14; }
+inline int f9383_15(int x) { return x * 15; }
+inline int f9383_16(int x) { return x * 16; }
+inline int f9383_17(int x) { return x * 17; }
+inline int f9383_18(int x) { return x * 18; }
+inline int f9383_19(int x) { return x * 19; }
+inline int f9383_20(int x) { return x * 20; }
+inline int f9383_21(int x) { return x * 21; }
+inline int f9383_22(int x) { return x * 22; }
+inline int f9383_23(int x) { return x * 23; }
+inline int f9383_24(int x) { return x * 24; }
+inline int f9383_25(int x) { return x * 25; }
+inline int f9383_26(int x) { return x * 26; }
+inline int f9383_27(int x) { return x * 27; }
+inline int f9383_28(int x) { return x * 28; }
+inline int f9383_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9384 */
+#include <vector>
+#include "h3932.h"
+#include "h6856.h"
+#include "h1985.h"
+#include "h966.h"
+#include "h5834.h"
+#ifdef X
+#include "h493.h"
+#endif
+struct S9384 { int a; const char *s = "x//y"; };
+inline int f9384_0(int x) { return x * 0; }
+inline int f9384_1(int x) { return x * 1; }
+inline int f9384_2(int x) { return x * 2; }
+inline int f9384_3(int x) { return x * 3; }
+inline int f9384_4(int x) { return x * 4; }
+inline int f9384_5(int x) { return x * 5; }
+inline int f9384_6(int x) { return x * 6; }
+inline int f9384_7(int x) { return x * 7; }
+inline int f9384_8(int x) { return x * 8; }
+inline int f9384_9(int x) { return x * 9; }
+inline int f9384_10(int x) { return x * 10; }
+inline int f9384_11(int x) { return x * 11; }
+inline int f9384_12(int x) { return x * 12; }
+inline int f9384_13(int x) { return x * 13; }
+inline int f9384_14(int x) { return x * 14; }
+inline int f9384_15(int x) { return x * 15; }
+inline int f9384_16(int x) { return x * 16; }
+inline int f9384_17(int x) { return x * 17; }
+inline int f9384_18(int x) { return x * 18; }
+inline int f9384_19(int x) { return x * 19; }
+inline int f9384_20(int x) { return x * 20; }
+inline int f9384_21(int x) { return x * 21; }
+inline int f9384_22(int x) { return x * 22; }
+inline int f9384_23(int x) { return x * 23; }
+inline int f9384_24(int x) { return x * 24; }
+inline int f9384_25(int x) { return x * 25; }
+inline int f9384_26(int x) { return x * 26; }
+inline int f9384_27(int x) { return x * 27; }
+inline int f9384_28(int x) { return x * 28; }
+inline int f9384_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9385 */
+#include <vector>
+#include "h2322.h"
+#include "h8617.h"
+#include "h7014.h"
+#include "h795.h"
+#include "h2827.h"
+#ifdef X
+#include "h5058.h"
+#endif
+struct S9385 { int a; const char *s = "x//y"; };
+inline int f9385_0(int x) { return x * 0; }
+inline int f9385_1(int x) { return x * 1; }
+inline int f9385_2(int x) { return x * 2; }
+inline int f9385_3(int x) { return x * 3; }
+inline int f9385_4(int x) { return x * 4; }
+inline int f9385_5(int x) { return x * 5; }
+inline int f9385_6(int x) { return x * 6; }
+inline int f9385_7(int x) { return x * 7; }
+inline int f9385_8(int x) { return x * 8; }
+inline int f9385_9(int x) { return x * 9; }
+inline int f9385_10(int x) { return x * 10; }
+inline int f9385_11(int x) { return x * 11; }
+inline int f9385_12(int x) { return x * 12; }
+inline int f9385_13(int x) { return x * 13; }
+inline int f9385_14(int x) { return x * 14; }
+inline int f9385_15(int x) { return x * 15; }
+inline int f9385_16(int x) { return x * 16; }
+inline int f9385_17(int x) { return x * 17; }
+inline int f9385_18(int x) { return x * 18; }
+inline int f9385_19(int x) { return x * 19; }
+inline int f9385_20(int x) { return x * 20; }
+inline int f9385_21(int x) { return x * 21; }
+inline int f9385_22(int x) { return x * 22; }
+inline int f9385_23(int x) { return x * 23; }
+inline int f9385_24(int x) { return x * 24; }
+inline int f9385_25(int x) { return x * 25; }
+inline int f9385_26(int x) { return x * 26; }
+inline int f9385_27(int x) { return x * 27; }
+inline int f9385_28(int x) { return x * 28; }
+inline int f9385_29(int x) { return x * 29; }
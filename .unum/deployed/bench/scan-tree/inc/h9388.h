@@ -0,0 +1,42 @@
+#pragma once
+/* header 9388 */
+#include <vector>
+#include "h4244.h"
+#include "h6482.h"
+#include "h3474.h"
+#include "h3.h"
+#include "h5927.h"
+#ifdef X
+#include "h4277.h"
+#endif
+struct S9388 { int a; const char *s = "x//y"; };
+inline int f9388_0(int x) { return x * 0; }
+inline int f9388_1(int x) { return x * 1; }
+inline int f9388_2(int x) { return x * 2; }
+inline int f9388_3(int x) { return x * 3; }
+inline int f9388_4(int x) { return x * 4; }
+inline int f9388_5(int x) { return x * 5; }
+inline int f9388_6(int x) { return x * 6; }
+inline int f9388_7(int x) { return x * 7; }
+inline int f9388_8(int x) { return x * 8; }
+inline int f9388_9(int x) { return x * 9; }
+inline int f9388_10(int x) { return x * 10; }
+inline int f9388_11(int x) { return x * 11; }
+inline int f9388_12(int x) { return x * 12; }
+inline int f9388_13(int x) { return x * 13; }
+inline int f9388_14(int x) { return x * 14; }
+inline int f9388_15(int x) { return x * 15; }
+inline int f9388_16(int x) { return x * 16; }
+inline int f9388_17(int x) { return x * 17; }
+inline int f9388_18(int x) { return x * 18; }
+inline int f9388_19(int x) { return x * 19; }
+inline int f9388_20(int x) { return x * 20; }
+inline int f9388_21(int x) { return x * 21; }
+inline int f9388_22(int x) { return x * 22; }
+inline int f9388_23(int x) { return x * 23; }
+inline int f9388_24(int x) { return x * 24; }
+inline int f9388_25(int x) { return x * 25; }
+inline int f9388_26(int x) { return x * 26; }
+inline int f9388_27(int x) { return x * 27; }
+inline int f9388_28(int x) { return x * 28; }
+inline int f9388_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 939 */
+#include <vector>
+#include "h9396.h"
+#include "h1043.h"
+#include "h2066.h"
+#include "h1071.h"
+#include "h7128.h"
+#ifdef X
+#include "h6001.h"
+#endif
+struct S939 { int a; const char *s = "x//y"; };
+inline int f939_0(int x) { return x * 0; }
+inline int f939_1(int x) { return x * 1; }
+inline int f939_2(int x) { return x * 2; }
+inline int f939_3(int x) { return x * 3; }
+inline int f939_4(int x) { return x * 4; }
+inline int f939_5(int x) { return x * 5; }
+inline int f939_6(int x) { return x * 6; }
+inline int f939_7(int x) { return x * 7; }
+inline int f939_8(int x) { return x * 8; }
+inline int f939_9(int x) { return x * 9; }
+inline int f939_10(int x) { return x * 10; }
+inline int f939_11(int x) { return x * 11; }
+inline int f939_12(int x) { return x * 12; }
+inline int f939_13(int x) { return x * 13; }
+inline int f939_14(int x) { return x * 14; }
+inline int f939_15(int x) { return x * 15; }
+inline int f939_16(int x) { return x * 16; }
+inline int f939_17(int x) { return x * 17; }
+inline int f939_18(int x) { return x * 18; }
+inline int f939_19(int x) { return x * 19; }
+inline int f939_20(int x) { return x * 20; }
+inline int f939_21(int x) { return x * 21; }
+inline int f939_22(int x) { return x * 22; }
+inline int f939_23(int x) { return x * 23; }
+inline int f939_24(int x) { return x * 24; }
+inline int f939_25(int x) { return x * 25; }
+inline int f939_26(int x) { return x * 26; }
+inline int f939_27(int x) { return x * 27; }
+inline int f939_28(int x) { return x * 28; }
+inline int f939_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9391 */
+#include <vector>
+#include "h6622.h"
+#include "h6289.h"
+#include "h9271.h"
+#include "h686.h"
+#include "h5287.h"
+#ifdef X
+#include "h2560.h"
+#endif
+struct S9391 { int a; const char *s = "x//y"; };
+inline int f9391_0(int x) { return x * 0; }
+inline int f9391_1(int x) { return x * 1; }
+inline int f9391_2(int x) { return x * 2; }
+inline int f9391_3(int x) { return x * 3; }
+inline int f9391_4(int x) { return x * 4; }
+inline int f9391_5(int x) { return x * 5; }
+inline int f9391_6(int x) { return x * 6; }
+inline int f9391_7(int x) { return x * 7; }
+inline int f9391_8(int x) { return x * 8; }
+inline int f9391_9(int x) { return x * 9; }
+inline int f9391_10(int x) { return x * 10; }
+inline int f9391_11(int x) { return x * 11; }
+inline int f9391_12(int x) { return x * 12; }
+inline int f9391_13(int x) { return x * 13; }
+inline int f9391_14(int x) { return x * 14; }
+inline int f9391_15(int x) { return x * 15; }
+inline int f9391_16(int x) { return x * 16; }
+inline int f9391_17(int x) { return x * 17; }
+inline int f9391_18(int x) { return x * 18; }
+inline int f9391_19(int x) { return x * 19; }
+inline int f9391_20(int x) { return x * 20; }
+inline int f9391_21(int x) { return x * 21; }
+inline int f9391_22(int x) { return x * 22; }
+inline int f9391_23(int x) { return x * 23; }
+inline int f9391_24(int x) { return x * 24; }
+inline int f9391_25(int x) { return x * 25; }
+inline int f9391_26(int x) { return x * 26; }
+inline int f9391_27(int x) { return x * 27; }
+inline int f9391_28(int x) { return x * 28; }
+inline int f9391_29(int x) { return x * 29; }
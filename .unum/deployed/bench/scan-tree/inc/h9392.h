@@ -0,0 +1,42 @@
+#pragma once
+/* header 9392 */
+#include <vector>
+#include "h8279.h"
+#include "h5633.h"
+#include "h6121.h"
+#include "h7113.h"
+#include "h7393.h"
+#ifdef X
+#include "h6105.h"
+#endif
+struct S9392 { int a; const char *s = "x//y"; };
+inline int f9392_0(int x) { return x * 0; }
+inline int f9392_1(int x) { return x * 1; }
+inline int f9392_2(int x) { return x * 2; }
+inline int f9392_3(int x) { return x * 3; }
+inline int f9392_4(int x) { return x * 4; }
+inline int f9392_5(int x) { return x * 5; }
+inline int f9392_6(int x) { return x * 6; }
+inline int f9392_7(int x) { return x * 7; }
+inline int f9392_8(int x) { return x * 8; }
+inline int f9392_9(int x) { return x * 9; }
+inline int f9392_10(int x) { return x * 10; }
+inline int f9392_11(int x) { return x * 11; }
+inline int f9392_12(int x) { return x * 12; }
+inline int f9392_13(int x) { return x * 13; }
+inline int f9392_14(int x) { return x * 14; }
+inline int f9392_15(int x) { return x * 15; }
+inline int f9392_16(int x) { return x * 16; }
+inline int f9392_17(int x) { return x * 17; }
+inline int f9392_18(int x) { return x * 18; }
+inline int f9392_19(int x) { return x * 19; }
+inline int f9392_20(int x) { return x * 20; }
+inline int f9392_21(int x) { return x * 21; }
+inline int f9392_22(int x) { return x * 22; }
+inline int f9392_23(int x) { return x * 23; }
+inline int f9392_24(int x) { return x * 24; }
+inline int f9392_25(int x) { return x * 25; }
+inline int f9392_26(int x) { return x * 26; }
+inline int f9392_27(int x) { return x * 27; }
+inline int f9392_28(int x) { return x * 28; }
+inline int f9392_29(int x) { return x * 29; }
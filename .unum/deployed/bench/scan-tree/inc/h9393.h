@@ -0,0 +1,42 @@
+#pragma once
+/* header 9393 */
+#include <vector>
+#include "h44.h"
+#include "h4192.h"
+#include "h3180.h"
+#include "h7324.h"
+#include "h564.h"
+#ifdef X
+#include "h482.h"
+#endif
+struct S9393 { int a; const char *s = "x//y"; };
+inline int f9393_0(int x) { return x * 0; }
+inline int f9393_1(int x) { return x * 1; }
+inline int f9393_2(int x) { return x * 2; }
+inline int f9393_3(int x) { return x * 3; }
+inline int f9393_4(int x) { return x * 4; }
+inline int f9393_5(int x) { return x * 5; }
+inline int f9393_6(int x) { return x * 6; }
+inline int f9393_7(int x) { return x * 7; }
+inline int f9393_8(int x) { return x * 8; }
+inline int f9393_9(int x) { return x * 9; }
+inline int f9393_10(int x) { return x * 10; }
+inline int f9393_11(int x) { return x * 11; }
+inline int f9393_12(int x) { return x * 12; }
+inline int f9393_13(int x) { return x * 13; }
+inline int f9393_14(int x) { return x * 14; }
+inline int f9393_15(int x) { return x * 15; }
+inline int f9393_16(int x) { return x * 16; }
+inline int f9393_17(int x) { return x * 17; }
+inline int f9393_18(int x) { return x * 18; }
+inline int f9393_19(int x) { return x * 19; }
+inline int f9393_20(int x) { return x * 20; }
+inline int f9393_21(int x) { return x * 21; }
+inline int f9393_22(int x) { return x * 22; }
+inline int f9393_23(int x) { return x * 23; }
+inline int f9393_24(int x) { return x * 24; }
+inline int f9393_25(int x) { return x * 25; }
+inline int f9393_26(int x) { return x * 26; }
+inline int f9393_27(int x) { return x * 27; }
+inline int f9393_28(int x) { return x * 28; }
+inline int f9393_29(int x) { return x * 29; }
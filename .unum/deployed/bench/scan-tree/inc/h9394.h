@@ -0,0 +1,42 @@
+#pragma once
+/* header 9394 */
+#include <vector>
+#include "h8018.h"
+#include "h1941.h"
+#include "h4139.h"
+#include "h9901.h"
+#include "h9436.h"
+#ifdef X
+#include "h872.h"
+#endif
+struct S9394 { int a; const char *s = "x//y"; };
+inline int f9394_0(int x) { return x * 0; }
+inline int f9394_1(int x) { return x * 1; }
+inline int f9394_2(int x) { return x * 2; }
+inline int f9394_3(int x) { return x * 3; }
+inline int f9394_4(int x) { return x * 4; }
+inline int f9394_5(int x) { return x * 5; }
+inline int f9394_6(int x) { return x * 6; }
+inline int f9394_7(int x) { return x * 7; }
+inline int f9394_8(int x) { return x * 8; }
+inline int f9394_9(int x) { return x * 9; }
+inline int f9394_10(int x) { return x * 10; }
+inline int f9394_11(int x) { return x * 11; }
+inline int f9394_12(int x) { return x * 12; }
+inline int f9394_13(int x) { return x * 13; }
+inline int f9394_14(int x) { return x * 14; }
+inline int f9394_15(int x) { return x * 15; }
+inline int f9394_16(int x) { return x * 16; }
+inline int f9394_17(int x) { return x * 17; }
+inline int f9394_18(int x) { return x * 18; }
+inline int f9394_19(int x) { return x * 19; }
+inline int f9394_20(int x) { return x * 20; }
+inline int f9394_21(int x) { return x * 21; }
+inline int f9394_22(int x) { return x * 22; }
+inline int f9394_23(int x) { return x * 23; }
+inline int f9394_24(int x) { return x * 24; }
+inline int f9394_25(int x) { return x * 25; }
+inline int f9394_26(int x) { return x * 26; }
+inline int f9394_27(int x) { return x * 27; }
+inline int f9394_28(int x) { return x * 28; }
+inline int f9394_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9397 */
+#include <vector>
+#include "h8267.h"
+#include "h7.h"
+#include "h69.h"
+#include "h1984.h"
+#include "h6513.h"
+#ifdef X
+#include "h426.h"
+#endif
+struct S9397 { int a; const char *s = "x//y"; };
+inline int f9397_0(int x) { return x * 0; }
+inline int f9397_1(int x) { return x * 1; }
+inline int f9397_2(int x) { return x * 2; }
+inline int f9397_3(int x) { return x * 3; }
+inline int f9397_4(int x) { return x * 4; }
+inline int f9397_5(int x) { return x * 5; }
+inline int f9397_6(int x) { return x * 6; }
+inline int f9397_7(int x) { return x * 7; }
+inline int f9397_8(int x) { return x * 8; }
+inline int f9397_9(int x) { return x * 9; }
+inline int f9397_10(int x) { return x * 10; }
+inline int f9397_11(int x) { return x * 11; }
+inline int f9397_12(int x) { return x * 12; }
+inline int f9397_13(int x) { return x * 13; }
+inline int f9397_14(int x) { return x * 14; }
+inline int f9397_15(int x) { return x * 15; }
+inline int f9397_16(int x) { return x * 16; }
+inline int f9397_17(int x) { return x * 17; }
+inline int f9397_18(int x) { return x * 18; }
+inline int f9397_19(int x) { return x * 19; }
+inline int f9397_20(int x) { return x * 20; }
+inline int f9397_21(int x) { return x * 21; }
+inline int f9397_22(int x) { return x * 22; }
+inline int f9397_23(int x) { return x * 23; }
+inline int f9397_24(int x) { return x * 24; }
+inline int f9397_25(int x) { return x * 25; }
+inline int f9397_26(int x) { return x * 26; }
+inline int f9397_27(int x) { return x * 27; }
+inline int f9397_28(int x) { return x * 28; }
+inline int f9397_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9398 */
+#include <vector>
+#include "h2452.h"
+#include "h6777.h"
+#include "h9619.h"
+#include "h760.h"
+#include "h8688.h"
+#ifdef X
+#include "h3538.h"
+#endif
+struct S9398 { int a; const char *s = "x//y"; };
+inline int f9398_0(int x) { return x * 0; }
+inline int f9398_1(int x) { return x * 1; }
+inline int f9398_2(int x) { return x * 2; }
+inline int f9398_3(int x) { return x * 3; }
+inline int f9398_4(int x) { return x * 4; }
+inline int f9398_5(int x) { return x * 5; }
+inline int f9398_6(int x) { return x * 6; }
+inline int f9398_7(int x) { return x * 7; }
+inline int f9398_8(int x) { return x * 8; }
+inline int f9398_9(int x) { return x * 9; }
+inline int f9398_10(int x) { return x * 10; }
+inline int f9398_11(int x) { return x * 11; }
+inline int f9398_12(int x) { return x * 12; }
+inline int f9398_13(int x) { return x * 13; }
+inline int f9398_14(int x) { return x * 14; }
+inline int f9398_15(int x) { return x * 15; }
+inline int f9398_16(int x) { return x * 16; }
+inline int f9398_17(int x) { return x * 17; }
+inline int f9398_18(int x) { return x * 18; }
+inline int f9398_19(int x) { return x * 19; }
+inline int f9398_20(int x) { return x * 20; }
+inline int f9398_21(int x) { return x * 21; }
+inline int f9398_22(int x) { return x * 22; }
+inline int f9398_23(int x) { return x * 23; }
+inline int f9398_24(int x) { return x * 24; }
+inline int f9398_25(int x) { return x * 25; }
+inline int f9398_26(int x) { return x * 26; }
+inline int f9398_27(int x) { return x * 27; }
+inline int f9398_28(int x) { return x * 28; }
+inline int f9398_29(int x) { return x * 29; }
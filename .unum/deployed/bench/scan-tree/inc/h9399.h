@@ -0,0 +1,42 @@
+#pragma once
+/* header 9399 */
+#include <vector>
+#include "h337.h"
+#include "h444.h"
+#include "h3082.h"
+#include "h6740.h"
+#include "h1574.h"
+#ifdef X
+#include "h707.h"
+#endif
+struct S9399 { int a; const char *s = "x//y"; };
+inline int f9399_0(int x) { return x * 0; }
+inline int f9399_1(int x) { return x * 1; }
+inline int f9399_2(int x) { return x * 2; }
+inline int f9399_3(int x) { return x * 3; }
+inline int f9399_4(int x) { return x * 4; }
+inline int f9399_5(int x) { return x * 5; }
+inline int f9399_6(int x) { return x * 6; }
+inline int f9399_7(int x) { return x * 7; }
+inline int f9399_8(int x) { return x * 8; }
+inline int f9399_9(int x) { return x * 9; }
+inline int f9399_10(int x) { return x * 10; }
+inline int f9399_11(int x) { return x * 11; }
+inline int f9399_12(int x) { return x * 12; }
+inline int f9399_13(int x) { return x * 13; }
+inline int f9399_14(int x) { return x * 14; }
+inline int f9399_15(int x) { return x * 15; }
+inline int f9399_16(int x) { return x * 16; }
+inline int f9399_17(int x) { return x * 17; }
+inline int f9399_18(int x) { return x * 18; }
+inline int f9399_19(int x) { return x * 19; }
+inline int f9399_20(int x) { return x * 20; }
+inline int f9399_21(int x) { return x * 21; }
+inline int f9399_22(int x) { return x * 22; }
+inline int f9399_23(int x) { return x * 23; }
+inline int f9399_24(int x) { return x * 24; }
+inline int f9399_25(int x) { return x * 25; }
+inline int f9399_26(int x) { return x * 26; }
+inline int f9399_27(int x) { return x * 27; }
+inline int f9399_28(int x) { return x * 28; }
+inline int f9399_29(int x) { return x * 29; }
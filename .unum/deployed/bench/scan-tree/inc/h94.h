@@ -0,0 +1,42 @@
+#pragma once
+/* header 94 */
+#include <vector>
+#include "h3576.h"
+#include "h7854.h"
+#include "h9187.h"
+#include "h5718.h"
+#include "h4474.h"
+#ifdef X
+#include "h4048.h"
+#endif
+struct S94 { int a; const char *s = "x//y"; };
+inline int f94_0(int x) { return x * 0; }
+inline int f94_1(int x) { return x * 1; }
+inline int f94_2(int x) { return x * 2; }
+inline int f94_3(int x) { return x * 3; }
+inline int f94_4(int x) { return x * 4; }
+inline int f94_5(int x) { return x * 5; }
+inline int f94_6(int x) { return x * 6; }
+inline int f94_7(int x) { return x * 7; }
+inline int f94_8(int x) { return x * 8; }
+inline int f94_9(int x) { return x * 9; }
+inline int f94_10(int x) { return x * 10; }
+inline int f94_11(int x) { return x * 11; }
+inline int f94_12(int x) { return x * 12; }
+inline int f94_13(int x) { return x * 13; }
+inline int f94_14(int x) { return x * 14; }
+inline int f94_15(int x) { return x * 15; }
+inline int f94_16(int x) { return x * 16; }
+inline int f94_17(int x) { return x * 17; }
+inline int f94_18(int x) { return x * 18; }
+inline int f94_19(int x) { return x * 19; }
+inline int f94_20(int x) { return x * 20; }
+inline int f94_21(int x) { return x * 21; }
+inline int f94_22(int x) { return x * 22; }
+inline int f94_23(int x) { return x * 23; }
+inline int f94_24(int x) { return x * 24; }
+inline int f94_25(int x) { return x * 25; }
+inline int f94_26(int x) { return x * 26; }
+inline int f94_27(int x) { return x * 27; }
+inline int f94_28(int x) { return x * 28; }
+inline int f94_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9400 */
+#include <vector>
+#include "h875.h"
+#include "h2384.h"
+#include "h8993.h"
+#include "h5957.h"
+#include "h1680.h"
+#ifdef X
+#include "h1331.h"
+#endif
+struct S9400 { int a; const char *s = "x//y"; };
+inline int f9400_0(int x) { return x * 0; }
+inline int f9400_1(int x) { return x * 1; }
+inline int f9400_2(int x) { return x * 2; }
+inline int f9400_3(int x) { return x * 3; }
+inline int f9400_4(int x) { return x * 4; }
+inline int f9400_5(int x) { return x * 5; }
+inline int f9400_6(int x) { return x * 6; }
+inline int f9400_7(int x) { return x * 7; }
+inline int f9400_8(int x) { return x * 8; }
+inline int f9400_9(int x) { return x * 9; }
+inline int f9400_10(int x) { return x * 10; }
+inline int f9400_11(int x) { return x * 11; }
+inline int f9400_12(int x) { return x * 12; }
+inline int f9400_13(int x) { return x * 13; }
+inline int f9400_14(int x) { return x * 14; }
+inline int f9400_15(int x) { return x * 15; }
+inline int f9400_16(int x) { return x * 16; }
+inline int f9400_17(int x) { return x * 17; }
+inline int f9400_18(int x) { return x * 18; }
+inline int f9400_19(int x) { return x * 19; }
+inline int f9400_20(int x) { return x * 20; }
+inline int f9400_21(int x) { return x * 21; }
+inline int f9400_22(int x) { return x * 22; }
+inline int f9400_23(int x) { return x * 23; }
+inline int f9400_24(int x) { return x * 24; }
+inline int f9400_25(int x) { return x * 25; }
+inline int f9400_26(int x) { return x * 26; }
+inline int f9400_27(int x) { return x * 27; }
+inline int f9400_28(int x) { return x * 28; }
+inline int f9400_29(int x) { return x * 29; }
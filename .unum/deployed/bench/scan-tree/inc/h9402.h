@@ -0,0 +1,42 @@
+#pragma once
+/* header 9402 */
+#include <vector>
+#include "h2856.h"
+#include "h744.h"
+#include "h8938.h"
+#include "h1468.h"
+#include "h3430.h"
+#ifdef X
+#include "h1560.h"
+#endif
+struct S9402 { int a; const char *s = "x//y"; };
+inline int f9402_0(int x) { return x * 0; }
+inline int f9402_1(int x) { return x * 1; }
+inline int f9402_2(int x) { return x * 2; }
+inline int f9402_3(int x) { return x * 3; }
+inline int f9402_4(int x) { return x * 4; }
+inline int f9402_5(int x) { return x * 5; }
+inline int f9402_6(int x) { return x * 6; }
+inline int f9402_7(int x) { return x * 7; }
+inline int f9402_8(int x) { return x * 8; }
+inline int f9402_9(int x) { return x * 9; }
+inline int f9402_10(int x) { return x * 10; }
+inline int f9402_11(int x) { return x * 11; }
+inline int f9402_12(int x) { return x * 12; }
+inline int f9402_13(int x) { return x * 13; }
+inline int f9402_14(int x) { return x * 14; }
+inline int f9402_15(int x) { return x * 15; }
+inline int f9402_16(int x) { return x * 16; }
+inline int f9402_17(int x) { return x * 17; }
+inline int f9402_18(int x) { return x * 18; }
+inline int f9402_19(int x) { return x * 19; }
+inline int f9402_20(int x) { return x * 20; }
+inline int f9402_21(int x) { return x * 21; }
+inline int f9402_22(int x) { return x * 22; }
+inline int f9402_23(int x) { return x * 23; }
+inline int f9402_24(int x) { return x * 24; }
+inline int f9402_25(int x) { return x * 25; }
+inline int f9402_26(int x) { return x * 26; }
+inline int f9402_27(int x) { return x * 27; }
+inline int f9402_28(int x) { return x * 28; }
+inline int f9402_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9405 */
+#include <vector>
+#include "h2175.h"
+#include "h863.h"
+#include "h1468.h"
+#include "h6000.h"
+#include "h5208.h"
+#ifdef X
+#include "h6129.h"
+#endif
+struct S9405 { int a; const char *s = "x//y"; };
+inline int f9405_0(int x) { return x * 0; }
+inline int f9405_1(int x) { return x * 1; }
+inline int f9405_2(int x) { return x * 2; }
+inline int f9405_3(int x) { return x * 3; }
+inline int f9405_4(int x) { return x * 4; }
+inline int f9405_5(int x) { return x * 5; }
+inline int f9405_6(int x) { return x * 6; }
+inline int f9405_7(int x) { return x * 7; }
+inline int f9405_8(int x) { return x * 8; }
+inline int f9405_9(int x) { return x * 9; }
+inline int f9405_10(int x) { return x * 10; }
+inline int f9405_11(int x) { return x * 11; }
+inline int f9405_12(int x) { return x * 12; }
+inline int f9405_13(int x) { return x * 13; }
+inline int f9405_14(int x) { return x * 14; }
+inline int f9405_15(int x) { return x * 15; }
+inline int f9405_16(int x) { return x * 16; }
+inline int f9405_17(int x) { return x * 17; }
+inline int f9405_18(int x) { return x * 18; }
+inline int f9405_19(int x) { return x * 19; }
+inline int f9405_20(int x) { return x * 20; }
+inline int f9405_21(int x) { return x * 21; }
+inline int f9405_22(int x) { return x * 22; }
+inline int f9405_23(int x) { return x * 23; }
+inline int f9405_24(int x) { return x * 24; }
+inline int f9405_25(int x) { return x * 25; }
+inline int f9405_26(int x) { return x * 26; }
+inline int f9405_27(int x) { return x * 27; }
+inline int f9405_28(int x) { return x * 28; }
+inline int f9405_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9406 */
+#include <vector>
+#include "h2205.h"
+#include "h3958.h"
+#include "h1747.h"
+#include "h5860.h"
+#include "h3473.h"
+#ifdef X
+#include "h5717.h"
+#endif
+struct S9406 { int a; const char *s = "x//y"; };
+inline int f9406_0(int x) { return x * 0; }
+inline int f9406_1(int x) { return x * 1; }
+inline int f9406_2(int x) { return x * 2; }
+inline int f9406_3(int x) { return x * 3; }
+inline int f9406_4(int x) { return x * 4; }
+inline int f9406_5(int x) { return x * 5; }
+inline int f9406_6(int x) { return x * 6; }
+inline int f9406_7(int x) { return x * 7; }
+inline int f9406_8(int x) { return x * 8; }
+inline int f9406_9(int x) { return x * 9; }
+inline int f9406_10(int x) { return x * 10; }
+inline int f9406_11(int x) { return x * 11; }
+inline int f9406_12(int x) { return x * 12; }
+inline int f9406_13(int x) { return x * 13; }
+inline int f9406_14(int x) { return x * 14; }
+inline int f9406_15(int x) { return x * 15; }
+inline int f9406_16(int x) { return x * 16; }
+inline int f9406_17(int x) { return x * 17; }
+inline int f9406_18(int x) { return x * 18; }
+inline int f9406_19(int x) { return x * 19; }
+inline int f9406_20(int x) { return x * 20; }
+inline int f9406_21(int x) { return x * 21; }
+inline int f9406_22(int x) { return x * 22; }
+inline int f9406_23(int x) { return x * 23; }
+inline int f9406_24(int x) { return x * 24; }
+inline int f9406_25(int x) { return x * 25; }
+inline int f9406_26(int x) { return x * 26; }
+inline int f9406_27(int x) { return x * 27; }
+inline int f9406_28(int x) { return x * 28; }
+inline int f9406_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9407 */
+#include <vector>
+#include "h5015.h"
+#include "h9291.h"
+#include "h5480.h"
+#include "h4998.h"
+#include "h558.h"
+#ifdef X
+#include "h2854.h"
+#endif
+struct S9407 { int a; const char *s = "x//y"; };
+inline int f9407_0(int x) { return x * 0; }
+inline int f9407_1(int x) { return x * 1; }
+inline int f9407_2(int x) { return x * 2; }
+inline int f9407_3(int x) { return x * 3; }
+inline int f9407_4(int x) { return x * 4; }
+inline int f9407_5(int x) { return x * 5; }
+inline int f9407_6(int x) { return x * 6; }
+inline int f9407_7(int x) { return x * 7; }
+inline int f9407_8(int x) { return x * 8; }
+inline int f9407_9(int x) { return x * 9; }
+inline int f9407_10(int x) { return x * 10; }
+inline int f9407_11(int x) { return x * 11; }
+inline int f9407_12(int x) { return x * 12; }
+inline int f9407_13(int x) { return x * 13; }
+inline int f9407_14(int x) { return x * 14; }
+inline int f9407_15(int x) { return x * 15; }
+inline int f9407_16(int x) { return x * 16; }
+inline int f9407_17(int x) { return x * 17; }
+inline int f9407_18(int x) { return x * 18; }
+inline int f9407_19(int x) { return x * 19; }
+inline int f9407_20(int x) { return x * 20; }
+inline int f9407_21(int x) { return x * 21; }
+inline int f9407_22(int x) { return x * 22; }
+inline int f9407_23(int x) { return x * 23; }
+inline int f9407_24(int x) { return x * 24; }
+inline int f9407_25(int x) { return x * 25; }
+inline int f9407_26(int x) { return x * 26; }
+inline int f9407_27(int x) { return x * 27; }
+inline int f9407_28(int x) { return x * 28; }
+inline int f9407_29(int x) { return x * 29; }
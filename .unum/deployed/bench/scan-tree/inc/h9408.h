@@ -0,0 +1,42 @@
+#pragma once
+/* header 9408 */
+#include <vector>
+#include "h7460.h"
+#include "h3836.h"
+#include "h2265.h"
+#include "h4554.h"
+#include "h8745.h"
+#ifdef X
+#include "h9261.h"
+#endif
+struct S9408 { int a; const char *s = "x//y"; };
+inline int f9408_0(int x) { return x * 0; }
+inline int f9408_1(int x) { return x * 1; }
+inline int f9408_2(int x) { return x * 2; }
+inline int f9408_3(int x) { return x * 3; }
+inline int f9408_4(int x) { return x * 4; }
+inline int f9408_5(int x) { return x * 5; }
+inline int f9408_6(int x) { return x * 6; }
+inline int f9408_7(int x) { return x * 7; }
+inline int f9408_8(int x) { return x * 8; }
+inline int f9408_9(int x) { return x * 9; }
+inline int f9408_10(int x) { return x * 10; }
+inline int f9408_11(int x) { return x * 11; }
+inline int f9408_12(int x) { return x * 12; }
+inline int f9408_13(int x) { return x * 13; }
+inline int f9408_14(int x) { return x * 14; }
+inline int f9408_15(int x) { return x * 15; }
+inline int f9408_16(int x) { return x * 16; }
+inline int f9408_17(int x) { return x * 17; }
+inline int f9408_18(int x) { return x * 18; }
+inline int f9408_19(int x) { return x * 19; }
+inline int f9408_20(int x) { return x * 20; }
+inline int f9408_21(int x) { return x * 21; }
+inline int f9408_22(int x) { return x * 22; }
+inline int f9408_23(int x) { return x * 23; }
+inline int f9408_24(int x) { return x * 24; }
+inline int f9408_25(int x) { return x * 25; }
+inline int f9408_26(int x) { return x * 26; }
+inline int f9408_27(int x) { return x * 27; }
+inline int f9408_28(int x) { return x * 28; }
+inline int f9408_29(int x) { return x * 29; }
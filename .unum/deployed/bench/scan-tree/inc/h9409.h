@@ -0,0 +1,42 @@
+#pragma once
+/* header 9409 */
+#include <vector>
+#include "h6158.h"
+#include "h4506.h"
+#include "h2238.h"
+#include "h1092.h"
+#include "h1982.h"
+#ifdef X
+#include "h8801.h"
+#endif
+struct S9409 { int a; const char *s = "x//y"; };
+inline int f9409_0(int x) { return x * 0; }
+inline int f9409_1(int x) { return x * 1; }
+inline int f9409_2(int x) { return x * 2; }
+inline int f9409_3(int x) { return x * 3; }
+inline int f9409_4(int x) { return x * 4; }
+inline int f9409_5(int x) { return x * 5; }
+inline int f9409_6(int x) { return x * 6; }
+inline int f9409_7(int x) { return x * 7; }
+inline int f9409_8(int x) { return x * 8; }
+inline int f9409_9(int x) { return x * 9; }
+inline int f9409_10(int x) { return x * 10; }
+inline int f9409_11(int x) { return x * 11; }
+inline int f9409_12(int x) { return x * 12; }
+inline int f9409_13(int x) { return x * 13; }
+inline int f9409_14(int x) { return x * 14; }
+inline int f9409_15(int x) { return x * 15; }
+inline int f9409_16(int x) { return x * 16; }
+inline int f9409_17(int x) { return x * 17; }
+inline int f9409_18(int x) { return x * 18; }
+inline int f9409_19(int x) { return x * 19; }
+inline int f9409_20(int x) { return x * 20; }
+inline int f9409_21(int x) { return x * 21; }
+inline int f9409_22(int x) { return x * 22; }
+inline int f9409_23(int x) { return x * 23; }
+inline int f9409_24(int x) { return x * 24; }
+inline int f9409_25(int x) { return x * 25; }
+inline int f9409_26(int x) { return x * 26; }
+inline int f9409_27(int x) { return x * 27; }
+inline int f9409_28(int x) { return x * 28; }
+inline int f9409_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9411 */
+#include <vector>
+#include "h2241.h"
+#include "h7514.h"
+#include "h3199.h"
+#include "h9488.h"
+#include "h3660.h"
+#ifdef X
+#include "h8333.h"
+#endif
+struct S9411 { int a; const char *s = "x//y"; };
+inline int f9411_0(int x) { return x * 0; }
+inline int f9411_1(int x) { return x * 1; }
+inline int f9411_2(int x) { return x * 2; }
+inline int f9411_3(int x) { return x * 3; }
+inline int f9411_4(int x) { return x * 4; }
+inline int f9411_5(int x) { return x * 5; }
+inline int f9411_6(int x) { return x * 6; }
+inline int f9411_7(int x) { return x * 7; }
+inline int f9411_8(int x) { return x * 8; }
+inline int f9411_9(int x) { return x * 9; }
+inline int f9411_10(int x) { return x * 10; }
+inline int f9411_11(int x) { return x * 11; }
+inline int f9411_12(int x) { return x * 12; }
+inline int f9411_13(int x) { return x * 13; }
+inline int f9411_14(int x) { return x * 14; }
+inline int f9411_15(int x) { return x * 15; }
+inline int f9411_16(int x) { return x * 16; }
+inline int f9411_17(int x) { return x * 17; }
+inline int f9411_18(int x) { return x * 18; }
+inline int f9411_19(int x) { return x * 19; }
+inline int f9411_20(int x) { return x * 20; }
+inline int f9411_21(int x) { return x * 21; }
+inline int f9411_22(int x) { return x * 22; }
+inline int f9411_23(int x) { return x * 23; }
+inline int f9411_24(int x) { return x * 24; }
+inline int f9411_25(int x) { return x * 25; }
+inline int f9411_26(int x) { return x * 26; }
+inline int f9411_27(int x) { return x * 27; }
+inline int f9411_28(int x) { return x * 28; }
+inline int f9411_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9413 */
+#include <vector>
+#include "h387.h"
+#include "h425.h"
+#include "h9892.h"
+#include "h4771.h"
+#include "h8316.h"
+#ifdef X
+#include "h3524.h"
+#endif
+struct S9413 { int a; const char *s = "x//y"; };
+inline int f9413_0(int x) { return x * 0; }
+inline int f9413_1(int x) { return x * 1; }
+inline int f9413_2(int x) { return x * 2; }
+inline int f9413_3(int x) { return x * 3; }
+inline int f9413_4(int x) { return x * 4; }
+inline int f9413_5(int x) { return x * 5; }
+inline int f9413_6(int x) { return x * 6; }
+inline int f9413_7(int x) { return x * 7; }
+inline int f9413_8(int x) { return x * 8; }
+inline int f9413_9(int x) { return x * 9; }
+inline int f9413_10(int x) { return x * 10; }
+inline int f9413_11(int x) { return x * 11; }
+inline int f9413_12(int x) { return x * 12; }
+inline int f9413_13(int x) { return x * 13; }
+inline int f9413_14(int x) { return x * 14; }
+inline int f9413_15(int x) { return x * 15; }
+inline int f9413_16(int x) { return x * 16; }
+inline int f9413_17(int x) { return x * 17; }
+inline int f9413_18(int x) { return x * 18; }
+inline int f9413_19(int x) { return x * 19; }
+inline int f9413_20(int x) { return x * 20; }
+inline int f9413_21(int x) { return x * 21; }
+inline int f9413_22(int x) { return x * 22; }
+inline int f9413_23(int x) { return x * 23; }
+inline int f9413_24(int x) { return x * 24; }
+inline int f9413_25(int x) { return x * 25; }
+inline int f9413_26(int x) { return x * 26; }
+inline int f9413_27(int x) { return x * 27; }
+inline int f9413_28(int x) { return x * 28; }
+inline int f9413_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9416 */
+#include <vector>
+#include "h6938.h"
+#include "h6058.h"
+#include "h1150.h"
+#include "h33.h"
+#include "h5346.h"
+#ifdef X
+#include "h3020.h"
+#endif
+struct S9416 { int a; const char *s = "x//y"; };
+inline int f9416_0(int x) { return x * 0; }
+inline int f9416_1(int x) { return x * 1; }
+inline int f9416_2(int x) { return x * 2; }
+inline int f9416_3(int x) { return x * 3; }
+inline int f9416_4(int x) { return x * 4; }
+inline int f9416_5(int x) { return x * 5; }
+inline int f9416_6(int x) { return x * 6; }
+inline int f9416_7(int x) { return x * 7; }
+inline int f9416_8(int x) { return x * 8; }
+inline int f9416_9(int x) { return x * 9; }
+inline int f9416_10(int x) { return x * 10; }
+inline int f9416_11(int x) { return x * 11; }
+inline int f9416_12(int x) { return x * 12; }
+inline int f9416_13(int x) { return x * 13; }
+inline int f9416_14(int x) { return x * 14; }
+inline int f9416_15(int x) { return x * 15; }
+inline int f9416_16(int x) { return x * 16; }
+inline int f9416_17(int x) { return x * 17; }
+inline int f9416_18(int x) { return x * 18; }
+inline int f9416_19(int x) { return x * 19; }
+inline int f9416_20(int x) { return x * 20; }
+inline int f9416_21(int x) { return x * 21; }
+inline int f9416_22(int x) { return x * 22; }
+inline int f9416_23(int x) { return x * 23; }
+inline int f9416_24(int x) { return x * 24; }
+inline int f9416_25(int x) { return x * 25; }
+inline int f9416_26(int x) { return x * 26; }
+inline int f9416_27(int x) { return x * 27; }
+inline int f9416_28(int x) { return x * 28; }
+inline int f9416_29(int x) { return x * 29; }
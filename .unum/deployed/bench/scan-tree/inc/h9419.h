@@ -0,0 +1,42 @@
+#pragma once
+/* header 9419 */
+#include <vector>
+#include "h9779.h"
+#include "h6251.h"
+#include "h5165.h"
+#include "h169.h"
+#include "h5086.h"
+#ifdef X
+#include "h4712.h"
+#endif
+struct S9419 { int a; const char *s = "x//y"; };
+inline int f9419_0(int x) { return x * 0; }
+inline int f9419_1(int x) { return x * 1; }
+inline int f9419_2(int x) { return x * 2; }
+inline int f9419_3(int x) { return x * 3; }
+inline int f9419_4(int x) { return x * 4; }
+inline int f9419_5(int x) { return x * 5; }
+inline int f9419_6(int x) { return x * 6; }
+inline int f9419_7(int x) { return x * 7; }
+inline int f9419_8(int x) { return x * 8; }
+inline int f9419_9(int x) { return x * 9; }
+inline int f9419_10(int x) { return x * 10; }
+inline int f9419_11(int x) { return x * 11; }
+inline int f9419_12(int x) { return x * 12; }
+inline int f9419_13(int x) { return x * 13; }
+inline int f9419_14(int x) { return x * 14; }
+inline int f9419_15(int x) { return x * 15; }
+inline int f9419_16(int x) { return x * 16; }
+inline int f9419_17(int x) { return x * 17; }
+inline int f9419_18(int x) { return x * 18; }
+inline int f9419_19(int x) { return x * 19; }
+inline int f9419_20(int x) { return x * 20; }
+inline int f9419_21(int x) { return x * 21; }
+inline int f9419_22(int x) { return x * 22; }
+inline int f9419_23(int x) { return x * 23; }
+inline int f9419_24(int x) { return x * 24; }
+inline int f9419_25(int x) { return x * 25; }
+inline int f9419_26(int x) { return x * 26; }
+inline int f9419_27(int x) { return x * 27; }
+inline int f9419_28(int x) { return x * 28; }
+inline int f9419_29(int x) { return x * 29; }
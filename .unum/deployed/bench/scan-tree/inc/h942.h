@@ -0,0 +1,42 @@
+#pragma once
+/* header 942 */
+#include <vector>
+#include "h2559.h"
+#include "h2553.h"
+#include "h1196.h"
+#include "h7012.h"
+#include "h2605.h"
+#ifdef X
+#include "h5380.h"
+#endif
+struct S942 { int a; const char *s = "x//y"; };
+inline int f942_0(int x) { return x * 0; }
+inline int f942_1(int x) { return x * 1; }
+inline int f942_2(int x) { return x * 2; }
+inline int f942_3(int x) { return x * 3; }
+inline int f942_4(int x) { return x * 4; }
+inline int f942_5(int x) { return x * 5; }
+inline int f942_6(int x) { return x * 6; }
+inline int f942_7(int x) { return x * 7; }
+inline int f942_8(int x) { return x * 8; }
+inline int f942_9(int x) { return x * 9; }
+inline int f942_10(int x) { return x * 10; }
+inline int f942_11(int x) { return x * 11; }
+inline int f942_12(int x) { return x * 12; }
+inline int f942_13(int x) { return x * 13; }
+inline int f942_14(int x) { return x * 14; }
+inline int f942_15(int x) { return x * 15; }
+inline int f942_16(int x) { return x * 16; }
+inline int f942_17(int x) { return x * 17; }
+inline int f942_18(int x) { return x * 18; }
+inline int f942_19(int x) { return x * 19; }
+inline int f942_20(int x) { return x * 20; }
+inline int f942_21(int x) { return x * 21; }
+inline int f942_22(int x) { return x * 22; }
+inline int f942_23(int x) { return x * 23; }
+inline int f942_24(int x) { return x * 24; }
+inline int f942_25(int x) { return x * 25; }
+inline int f942_26(int x) { return x * 26; }
+inline int f942_27(int x) { return x * 27; }
+inline int f942_28(int x) { return x * 28; }
+inline int f942_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9423 */
+#include <vector>
+#include "h6164.h"
+#include "h9083.h"
+#include "h3383.h"
+#include "h9055.h"
+#include "h5345.h"
+#ifdef X
+#include "h1879.h"
+#endif
+struct S9423 { int a; const char *s = "x//y"; };
+inline int f9423_0(int x) { return x * 0; }
+inline int f9423_1(int x) { return x * 1; }
+inline int f9423_2(int x) { return x * 2; }
+inline int f9423_3(int x) { return x * 3; }
+inline int f9423_4(int x) { return x * 4; }
+inline int f9423_5(int x) { return x * 5; }
+inline int f9423_6(int x) { return x * 6; }
+inline int f9423_7(int x) { return x * 7; }
+inline int f9423_8(int x) { return x * 8; }
+inline int f9423_9(int x) { return x * 9; }
+inline int f9423_10(int x) { return x * 10; }
+inline int f9423_11(int x) { return x * 11; }
+inline int f9423_12(int x) { return x * 12; }
+inline int f9423_13(int x) { return x * 13; }
+inline int f9423_14(int x) { return x * 14; }
+inline int f9423_15(int x) { return x * 15; }
+inline int f9423_16(int x) { return x * 16; }
+inline int f9423_17(int x) { return x * 17; }
+inline int f9423_18(int x) { return x * 18; }
+inline int f9423_19(int x) { return x * 19; }
+inline int f9423_20(int x) { return x * 20; }
+inline int f9423_21(int x) { return x * 21; }
+inline int f9423_22(int x) { return x * 22; }
+inline int f9423_23(int x) { return x * 23; }
+inline int f9423_24(int x) { return x * 24; }
+inline int f9423_25(int x) { return x * 25; }
+inline int f9423_26(int x) { return x * 26; }
+inline int f9423_27(int x) { return x * 27; }
+inline int f9423_28(int x) { return x * 28; }
+inline int f9423_29(int x) { return x * 29; }
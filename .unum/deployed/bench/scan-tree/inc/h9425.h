@@ -0,0 +1,42 @@
+#pragma once
+/* header 9425 */
+#include <vector>
+#include "h6590.h"
+#include "h481.h"
+#include "h8860.h"
+#include "h5363.h"
+#include "h4571.h"
+#ifdef X
+#include "h3859.h"
+#endif
+struct S9425 { int a; const char *s = "x//y"; };
+inline int f9425_0(int x) { return x * 0; }
+inline int f9425_1(int x) { return x * 1; }
+inline int f9425_2(int x) { return x * 2; }
+inline int f9425_3(int x) { return x * 3; }
+inline int f9425_4(int x) { return x * 4; }
+inline int f9425_5(int x) { return x * 5; }
+inline int f9425_6(int x) { return x * 6; }
+inline int f9425_7(int x) { return x * 7; }
+inline int f9425_8(int x) { return x * 8; }
+inline int f9425_9(int x) { return x * 9; }
+inline int f9425_10(int x) { return x * 10; }
+inline int f9425_11(int x) { return x * 11; }
+inline int f9425_12(int x) { return x * 12; }
+inline int f9425_13(int x) { return x * 13; }
+inline int f9425_14(int x) { return x * 14; }
+inline int f9425_15(int x) { return x * 15; }
+inline int f9425_16(int x) { return x * 16; }
+inline int f9425_17(int x) { return x * 17; }
+inline int f9425_18(int x) { return x * 18; }
+inline int f9425_19(int x) { return x * 19; }
+inline int f9425_20(int x) { return x * 20; }
+inline int f9425_21(int x) { return x * 21; }
+inline int f9425_22(int x) { return x * 22; }
+inline int f9425_23(int x) { return x * 23; }
+inline int f9425_24(int x) { return x * 24; }
+inline int f9425_25(int x) { return x * 25; }
+inline int f9425_26(int x) { return x * 26; }
+inline int f9425_27(int x) { return x * 27; }
+inline int f9425_28(int x) { return x * 28; }
+inline int f9425_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9426 */
+#include <vector>
+#include "h7492.h"
+#include "h4710.h"
+#include "h8759.h"
+#include "h6671.h"
+#include "h1805.h"
+#ifdef X
+#include "h4197.h"
+#endif
+struct S9426 { int a; const char *s = "x//y"; };
+inline int f9426_0(int x) { return x * 0; }
+inline int f9426_1(int x) { return x * 1; }
+inline int f9426_2(int x) { return x * 2; }
+inline int f9426_3(int x) { return x * 3; }
+inline int f9426_4(int x) { return x * 4; }
+inline int f9426_5(int x) { return x * 5; }
+inline int f9426_6(int x) { return x * 6; }
+inline int f9426_7(int x) { return x * 7; }
+inline int f9426_8(int x) { return x * 8; }
+inline int f9426_9(int x) { return x * 9; }
+inline int f9426_10(int x) { return x * 10; }
+inline int f9426_11(int x) { return x * 11; }
+inline int f9426_12(int x) { return x * 12; }
+inline int f9426_13(int x) { return x * 13; }
+inline int f9426_14(int x) { return x * 14; }
+inline int f9426_15(int x) { return x * 15; }
+inline int f9426_16(int x) { return x * 16; }
+inline int f9426_17(int x) { return x * 17; }
+inline int f9426_18(int x) { return x * 18; }
+inline int f9426_19(int x) { return x * 19; }
+inline int f9426_20(int x) { return x * 20; }
+inline int f9426_21(int x) { return x * 21; }
+inline int f9426_22(int x) { return x * 22; }
+inline int f9426_23(int x) { return x * 23; }
+inline int f9426_24(int x) { return x * 24; }
+inline int f9426_25(int x) { return x * 25; }
+inline int f9426_26(int x) { return x * 26; }
+inline int f9426_27(int x) { return x * 27; }
+inline int f9426_28(int x) { return x * 28; }
+inline int f9426_29(int x) { return x * 29; }
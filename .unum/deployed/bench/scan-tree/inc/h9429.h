@@ -0,0 +1,42 @@
+#pragma once
+/* header 9429 */
+#include <vector>
+#include "h4313.h"
+#include "h2689.h"
+#include "h6051.h"
+#include "h8290.h"
+#include "h7995.h"
+#ifdef X
+#include "h1464.h"
+#endif
+struct S9429 { int a; const char *s = "x//y"; };
+inline int f9429_0(int x) { return x * 0; }
+inline int f9429_1(int x) { return x * 1; }
+inline int f9429_2(int x) { return x * 2; }
+inline int f9429_3(int x) { return x * 3; }
+inline int f9429_4(int x) { return x * 4; }
+inline int f9429_5(int x) { return x * 5; }
+inline int f9429_6(int x) { return x * 6; }
+inline int f9429_7(int x) { return x * 7; }
+inline int f9429_8(int x) { return x * 8; }
+inline int f9429_9(int x) { return x * 9; }
+inline int f9429_10(int x) { return x * 10; }
+inline int f9429_11(int x) { return x * 11; }
+inline int f9429_12(int x) { return x * 12; }
+inline int f9429_13(int x) { return x * 13; }
+inline int f9429_14(int x) { return x * 14; }
+inline int f9429_15(int x) { return x * 15; }
+inline int f9429_16(int x) { return x * 16; }
+inline int f9429_17(int x) { return x * 17; }
+inline int f9429_18(int x) { return x * 18; }
+inline int f9429_19(int x) { return x * 19; }
+inline int f9429_20(int x) { return x * 20; }
+inline int f9429_21(int x) { return x * 21; }
+inline int f9429_22(int x) { return x * 22; }
+inline int f9429_23(int x) { return x * 23; }
+inline int f9429_24(int x) { return x * 24; }
+inline int f9429_25(int x) { return x * 25; }
+inline int f9429_26(int x) { return x * 26; }
+inline int f9429_27(int x) { return x * 27; }
+inline int f9429_28(int x) { return x * 28; }
+inline int f9429_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 943 */
+#include <vector>
+#include "h5959.h"
+#include "h8737.h"
+#include "h6710.h"
+#include "h7576.h"
+#include "h2306.h"
+#ifdef X
+#include "h3160.h"
+#endif
+struct S943 { int a; const char *s = "x//y"; };
+inline int f943_0(int x) { return x * 0; }
+inline int f943_1(int x) { return x * 1; }
+inline int f943_2(int x) { return x * 2; }
+inline int f943_3(int x) { return x * 3; }
+inline int f943_4(int x) { return x * 4; }
+inline int f943_5(int x) { return x * 5; }
+inline int f943_6(int x) { return x * 6; }
+inline int f943_7(int x) { return x * 7; }
+inline int f943_8(int x) { return x * 8; }
+inline int f943_9(int x) { return x * 9; }
+inline int f943_10(int x) { return x * 10; }
+inline int f943_11(int x) { return x * 11; }
+inline int f943_12(int x) { return x * 12; }
+inline int f943_13(int x) { return x * 13; }
+inline int f943_14(int x) { return x * 14; }
+inline int f943_15(int x) { return x * 15; }
+inline int f943_16(int x) { return x * 16; }
+inline int f943_17(int x) { return x * 17; }
+inline int f943_18(int x) { return x * 18; }
+inline int f943_19(int x) { return x * 19; }
+inline int f943_20(int x) { return x * 20; }
+inline int f943_21(int x) { return x * 21; }
+inline int f943_22(int x) { return x * 22; }
+inline int f943_23(int x) { return x * 23; }
+inline int f943_24(int x) { return x * 24; }
+inline int f943_25(int x) { return x * 25; }
+inline int f943_26(int x) { return x * 26; }
+inline int f943_27(int x) { return x * 27; }
+inline int f943_28(int x) { return x * 28; }
+inline int f943_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9430 */
+#include <vector>
+#include "h4403.h"
+#include "h4857.h"
+#include "h1076.h"
+#include "h2531.h"
+#include "h6414.h"
+#ifdef X
+#include "h1315.h"
+#endif
+struct S9430 { int a; const char *s = "x//y"; };
+inline int f9430_0(int x) { return x * 0; }
+inline int f9430_1(int x) { return x * 1; }
+inline int f9430_2(int x) { return x * 2; }
+inline int f9430_3(int x) { return x * 3; }
+inline int f9430_4(int x) { return x * 4; }
+inline int f9430_5(int x) { return x * 5; }
+inline int f9430_6(int x) { return x * 6; }
+inline int f9430_7(int x) { return x * 7; }
+inline int f9430_8(int x) { return x * 8; }
+inline int f9430_9(int x) { return x * 9; }
+inline int f9430_10(int x) { return x * 10; }
+inline int f9430_11(int x) { return x * 11; }
+inline int f9430_12(int x) { return x * 12; }
+inline int f9430_13(int x) { return x * 13; }
+inline int f9430_14(int x) { return x * 14; }
+inline int f9430_15(int x) { return x * 15; }
+inline int f9430_16(int x) { return x * 16; }
+inline int f9430_17(int x) { return x * 17; }
+inline int f9430_18(int x) { return x * 18; }
+inline int f9430_19(int x) { return x * 19; }
+inline int f9430_20(int x) { return x * 20; }
+inline int f9430_21(int x) { return x * 21; }
+inline int f9430_22(int x) { return x * 22; }
+inline int f9430_23(int x) { return x * 23; }
+inline int f9430_24(int x) { return x * 24; }
+inline int f9430_25(int x) { return x * 25; }
+inline int f9430_26(int x) { return x * 26; }
+inline int f9430_27(int x) { return x * 27; }
+inline int f9430_28(int x) { return x * 28; }
+inline int f9430_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9432 */
+#include <vector>
+#include "h3086.h"
+#include "h5377.h"
+#include "h5511.h"
+#include "h2509.h"
+#include "h2859.h"
+#ifdef X
+#include "h2529.h"
+#endif
+struct S9432 { int a; const char *s = "x//y"; };
+inline int f9432_0(int x) { return x * 0; }
+inline int f9432_1(int x) { return x * 1; }
+inline int f9432_2(int x) { return x * 2; }
+inline int f9432_3(int x) { return x * 3; }
+inline int f9432_4(int x) { return x * 4; }
+inline int f9432_5(int x) { return x * 5; }
+inline int f9432_6(int x) { return x * 6; }
+inline int f9432_7(int x) { return x * 7; }
+inline int f9432_8(int x) { return x * 8; }
+inline int f9432_9(int x) { return x * 9; }
+inline int f9432_10(int x) { return x * 10; }
+inline int f9432_11(int x) { return x * 11; }
+inline int f9432_12(int x) { return x * 12; }
+inline int f9432_13(int x) { return x * 13; }
+inline int f9432_14(int x) { return x * 14; }
+inline int f9432_15(int x) { return x * 15; }
+inline int f9432_16(int x) { return x * 16; }
+inline int f9432_17(int x) { return x * 17; }
+inline int f9432_18(int x) { return x * 18; }
+inline int f9432_19(int x) { return x * 19; }
+inline int f9432_20(int x) { return x * 20; }
+inline int f9432_21(int x) { return x * 21; }
+inline int f9432_22(int x) { return x * 22; }
+inline int f9432_23(int x) { return x * 23; }
+inline int f9432_24(int x) { return x * 24; }
+inline int f9432_25(int x) { return x * 25; }
+inline int f9432_26(int x) { return x * 26; }
+inline int f9432_27(int x) { return x * 27; }
+inline int f9432_28(int x) { return x * 28; }
+inline int f9432_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9434 */
+#include <vector>
+#include "h6128.h"
+#include "h6820.h"
+#include "h2902.h"
+#include "h5715.h"
+#include "h3047.h"
+#ifdef X
+#include "h5547.h"
+#endif
+struct S9434 { int a; const char *s = "x//y"; };
+inline int f9434_0(int x) { return x * 0; }
+inline int f9434_1(int x) { return x * 1; }
+inline int f9434_2(int x) { return x * 2; }
+inline int f9434_3(int x) { return x * 3; }
+inline int f9434_4(int x) { return x * 4; }
+inline int f9434_5(int x) { return x * 5; }
+inline int f9434_6(int x) { return x * 6; }
+inline int f9434_7(int x) { return x * 7; }
+inline int f9434_8(int x) { return x * 8; }
+inline int f9434_9(int x) { return x * 9; }
+inline int f9434_10(int x) { return x * 10; }
+inline int f9434_11(int x) { return x * 11; }
+inline int f9434_12(int x) { return x * 12; }
+inline int f9434_13(int x) { return x * 13; }
+inline int f9434_14(int x) { return x * 14; }
+inline int f9434_15(int x) { return x * 15; }
+inline int f9434_16(int x) { return x * 16; }
+inline int f9434_17(int x) { return x * 17; }
+inline int f9434_18(int x) { return x * 18; }
+inline int f9434_19(int x) { return x * 19; }
+inline int f9434_20(int x) { return x * 20; }
+inline int f9434_21(int x) { return x * 21; }
+inline int f9434_22(int x) { return x * 22; }
+inline int f9434_23(int x) { return x * 23; }
+inline int f9434_24(int x) { return x * 24; }
+inline int f9434_25(int x) { return x * 25; }
+inline int f9434_26(int x) { return x * 26; }
+inline int f9434_27(int x) { return x * 27; }
+inline int f9434_28(int x) { return x * 28; }
+inline int f9434_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9438 */
+#include <vector>
+#include "h7912.h"
+#include "h986.h"
+#include "h6496.h"
+#include "h1589.h"
+#include "h4487.h"
+#ifdef X
+#include "h6995.h"
+#endif
+struct S9438 { int a; const char *s = "x//y"; };
+inline int f9438_0(int x) { return x * 0; }
+inline int f9438_1(int x) { return x * 1; }
+inline int f9438_2(int x) { return x * 2; }
+inline int f9438_3(int x) { return x * 3; }
+inline int f9438_4(int x) { return x * 4; }
+inline int f9438_5(int x) { return x * 5; }
+inline int f9438_6(int x) { return x * 6; }
+inline int f9438_7(int x) { return x * 7; }
+inline int f9438_8(int x) { return x * 8; }
+inline int f9438_9(int x) { return x * 9; }
+inline int f9438_10(int x) { return x * 10; }
+inline int f9438_11(int x) { return x * 11; }
+inline int f9438_12(int x) { return x * 12; }
+inline int f9438_13(int x) { return x * 13; }
+inline int f9438_14(int x) { return x * 14; }
+inline int f9438_15(int x) { return x * 15; }
+inline int f9438_16(int x) { return x * 16; }
+inline int f9438_17(int x) { return x * 17; }
+inline int f9438_18(int x) { return x * 18; }
+inline int f9438_19(int x) { return x * 19; }
+inline int f9438_20(int x) { return x * 20; }
+inline int f9438_21(int x) { return x * 21; }
+inline int f9438_22(int x) { return x * 22; }
+inline int f9438_23(int x) { return x * 23; }
+inline int f9438_24(int x) { return x * 24; }
+inline int f9438_25(int x) { return x * 25; }
+inline int f9438_26(int x) { return x * 26; }
+inline int f9438_27(int x) { return x * 27; }
+inline int f9438_28(int x) { return x * 28; }
+inline int f9438_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 944 */
+#include <vector>
+#include "h2456.h"
+#include "h313.h"
+#include "h2144.h"
+#include "h3964.h"
+#include "h9492.h"
+#ifdef X
+#include "h1817.h"
+#endif
+struct S944 { int a; const char *s = "x//y"; };
+inline int f944_0(int x) { return x * 0; }
+inline int f944_1(int x) { return x * 1; }
+inline int f944_2(int x) { return x * 2; }
+inline int f944_3(int x) { return x * 3; }
+inline int f944_4(int x) { return x * 4; }
+inline int f944_5(int x) { return x * 5; }
+inline int f944_6(int x) { return x * 6; }
+inline int f944_7(int x) { return x * 7; }
+inline int f944_8(int x) { return x * 8; }
+inline int f944_9(int x) { return x * 9; }
+inline int f944_10(int x) { return x * 10; }
+inline int f944_11(int x) { return x * 11; }
+inline int f944_12(int x) { return x * 12; }
+inline int f944_13(int x) { return x * 13; }
+inline int f944_14(int x) { return x * 14; }
+inline int f944_15(int x) { return x * 15; }
+inline int f944_16(int x) { return x * 16; }
+inline int f944_17(int x) { return x * 17; }
+inline int f944_18(int x) { return x * 18; }
+inline int f944_19(int x) { return x * 19; }
+inline int f944_20(int x) { return x * 20; }
+inline int f944_21(int x) { return x * 21; }
+inline int f944_22(int x) { return x * 22; }
+inline int f944_23(int x) { return x * 23; }
+inline int f944_24(int x) { return x * 24; }
+inline int f944_25(int x) { return x * 25; }
+inline int f944_26(int x) { return x * 26; }
+inline int f944_27(int x) { return x * 27; }
+inline int f944_28(int x) { return x * 28; }
+inline int f944_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9443 */
+#include <vector>
+#include "h5907.h"
+#include "h9145.h"
+#include "h7911.h"
+#include "h9315.h"
+#include "h7964.h"
+#ifdef X
+#include "h7739.h"
+#endif
+struct S9443 { int a; const char *s = "x//y"; };
+inline int f9443_0(int x) { return x * 0; }
+inline int f9443_1(int x) { return x * 1; }
+inline int f9443_2(int x) { return x * 2; }
+inline int f9443_3(int x) { return x * 3; }
+inline int f9443_4(int x) { return x * 4; }
+inline int f9443_5(int x) { return x * 5; }
+inline int f9443_6(int x) { return x * 6; }
+inline int f9443_7(int x) { return x * 7; }
+inline int f9443_8(int x) { return x * 8; }
+inline int f9443_9(int x) { return x * 9; }
+inline int f9443_10(int x) { return x * 10; }
+inline int f9443_11(int x) { return x * 11; }
+inline int f9443_12(int x) { return x * 12; }
+inline int f9443_13(int x) { return x * 13; }
+inline int f9443_14(int x) { return x * 14; }
+inline int f9443_15(int x) { return x * 15; }
+inline int f9443_16(int x) { return x * 16; }
+inline int f9443_17(int x) { return x * 17; }
+inline int f9443_18(int x) { return x * 18; }
+inline int f9443_19(int x) { return x * 19; }
+inline int f9443_20(int x) { return x * 20; }
+inline int f9443_21(int x) { return x * 21; }
+inline int f9443_22(int x) { return x * 22; }
+inline int f9443_23(int x) { return x * 23; }
+inline int f9443_24(int x) { return x * 24; }
+inline int f9443_25(int x) { return x * 25; }
+inline int f9443_26(int x) { return x * 26; }
+inline int f9443_27(int x) { return x * 27; }
+inline int f9443_28(int x) { return x * 28; }
+inline int f9443_29(int x) { return x * 29; }
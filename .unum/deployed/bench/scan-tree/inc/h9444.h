@@ -0,0 +1,42 @@
+#pragma once
+/* header 9444 */
+#include <vector>
+#include "h9187.h"
+#include "h7627.h"
+#include "h8580.h"
+#include "h9492.h"
+#include "h4191.h"
+#ifdef X
+#include "h2950.h"
+#endif
+struct S9444 { int a; const char *s = "x//y"; };
+inline int f9444_0(int x) { return x * 0; }
+inline int f9444_1(int x) { return x * 1; }
+inline int f9444_2(int x) { return x * 2; }
+inline int f9444_3(int x) { return x * 3; }
+inline int f9444_4(int x) { return x * 4; }
+inline int f9444_5(int x) { return x * 5; }
+inline int f9444_6(int x) { return x * 6; }
+inline int f9444_7(int x) { return x * 7; }
+inline int f9444_8(int x) { return x * 8; }
+inline int f9444_9(int x) { return x * 9; }
+inline int f9444_10(int x) { return x * 10; }
+inline int f9444_11(int x) { return x * 11; }
+inline int f9444_12(int x) { return x * 12; }
+inline int f9444_13(int x) { return x * 13; }
+inline int f9444_14(int x) { return x * 14; }
+inline int f9444_15(int x) { return x * 15; }
+inline int f9444_16(int x) { return x * 16; }
+inline int f9444_17(int x) { return x * 17; }
+inline int f9444_18(int x) { return x * 18; }
+inline int f9444_19(int x) { return x * 19; }
+inline int f9444_20(int x) { return x * 20; }
+inline int f9444_21(int x) { return x * 21; }
+inline int f9444_22(int x) { return x * 22; }
+inline int f9444_23(int x) { return x * 23; }
+inline int f9444_24(int x) { return x * 24; }
+inline int f9444_25(int x) { return x * 25; }
+inline int f9444_26(int x) { return x * 26; }
+inline int f9444_27(int x) { return x * 27; }
+inline int f9444_28(int x) { return x * 28; }
+inline int f9444_29(int x) { return x * 29; }
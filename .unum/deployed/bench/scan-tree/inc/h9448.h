@@ -0,0 +1,42 @@
+#pragma once
+/* header 9448 */
+#include <vector>
+#include "h6147.h"
+#include "h7704.h"
+#include "h7407.h"
+#include "h5429.h"
+#include "h8581.h"
+#ifdef X
+#include "h8218.h"
+#endif
+struct S9448 { int a; const char *s = "x//y"; };
+inline int f9448_0(int x) { return x * 0; }
+inline int f9448_1(int x) { return x * 1; }
+inline int f9448_2(int x) { return x * 2; }
+inline int f9448_3(int x) { return x * 3; }
+inline int f9448_4(int x) { return x * 4; }
+inline int f9448_5(int x) { return x * 5; }
+inline int f9448_6(int x) { return x * 6; }
+inline int f9448_7(int x) { return x * 7; }
+inline int f9448_8(int x) { return x * 8; }
+inline int f9448_9(int x) { return x * 9; }
+inline int f9448_10(int x) { return x * 10; }
+inline int f9448_11(int x) { return x * 11; }
+inline int f9448_12(int x) { return x * 12; }
+inline int f9448_13(int x) { return x * 13; }
+inline int f9448_14(int x) { return x * 14; }
+inline int f9448_15(int x) { return x * 15; }
+inline int f9448_16(int x) { return x * 16; }
+inline int f9448_17(int x) { return x * 17; }
+inline int f9448_18(int x) { return x * 18; }
+inline int f9448_19(int x) { return x * 19; }
+inline int f9448_20(int x) { return x * 20; }
+inline int f9448_21(int x) { return x * 21; }
+inline int f9448_22(int x) { return x * 22; }
+inline int f9448_23(int x) { return x * 23; }
+inline int f9448_24(int x) { return x * 24; }
+inline int f9448_25(int x) { return x * 25; }
+inline int f9448_26(int x) { return x * 26; }
+inline int f9448_27(int x) { return x * 27; }
+inline int f9448_28(int x) { return x * 28; }
+inline int f9448_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9450 */
+#include <vector>
+#include "h8879.h"
+#include "h5639.h"
+#include "h3589.h"
+#include "h3207.h"
+#include "h5252.h"
+#ifdef X
+#include "h2432.h"
+#endif
+struct S9450 { int a; const char *s = "x//y"; };
+inline int f9450_0(int x) { return x * 0; }
+inline int f9450_1(int x) { return x * 1; }
+inline int f9450_2(int x) { return x * 2; }
+inline int f9450_3(int x) { return x * 3; }
+inline int f9450_4(int x) { return x * 4; }
+inline int f9450_5(int x) { return x * 5; }
+inline int f9450_6(int x) { return x * 6; }
+inline int f9450_7(int x) { return x * 7; }
+inline int f9450_8(int x) { return x * 8; }
+inline int f9450_9(int x) { return x * 9; }
+inline int f9450_10(int x) { return x * 10; }
+inline int f9450_11(int x) { return x * 11; }
+inline int f9450_12(int x) { return x * 12; }
+inline int f9450_13(int x) { return x * 13; }
+inline int f9450_14(int x) { return x * 14; }
+inline int f9450_15(int x) { return x * 15; }
+inline int f9450_16(int x) { return x * 16; }
+inline int f9450_17(int x) { return x * 17; }
+inline int f9450_18(int x) { return x * 18; }
+inline int f9450_19(int x) { return x * 19; }
+inline int f9450_20(int x) { return x * 20; }
+inline int f9450_21(int x) { return x * 21; }
+inline int f9450_22(int x) { return x * 22; }
+inline int f9450_23(int x) { return x * 23; }
+inline int f9450_24(int x) { return x * 24; }
+inline int f9450_25(int x) { return x * 25; }
+inline int f9450_26(int x) { return x * 26; }
+inline int f9450_27(int x) { return x * 27; }
+inline int f9450_28(int x) { return x * 28; }
+inline int f9450_29(int x) { return x * 29; }
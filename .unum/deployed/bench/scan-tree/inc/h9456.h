@@ -0,0 +1,42 @@
+#pragma once
+/* header 9456 */
+#include <vector>
+#include "h649.h"
+#include "h4073.h"
+#include "h8994.h"
+#include "h1577.h"
+#include "h1015.h"
+#ifdef X
+#include "h4319.h"
+#endif
+struct S9456 { int a; const char *s = "x//y"; };
+inline int f9456_0(int x) { return x * 0; }
+inline int f9456_1(int x) { return x * 1; }
+inline int f9456_2(int x) { return x * 2; }
+inline int f9456_3(int x) { return x * 3; }
+inline int f9456_4(int x) { return x * 4; }
+inline int f9456_5(int x) { return x * 5; }
+inline int f9456_6(int x) { return x * 6; }
+inline int f9456_7(int x) { return x * 7; }
+inline int f9456_8(int x) { return x * 8; }
+inline int f9456_9(int x) { return x * 9; }
+inline int f9456_10(int x) { return x * 10; }
+inline int f9456_11(int x) { return x * 11; }
+inline int f9456_12(int x) { return x * 12; }
+inline int f9456_13(int x) { return x * 13; }
+inline int f9456_14(int x) { return x * 14; }
+inline int f9456_15(int x) { return x * 15; }
+inline int f9456_16(int x) { return x * 16; }
+inline int f9456_17(int x) { return x * 17; }
+inline int f9456_18(int x) { return x * 18; }
+inline int f9456_19(int x) { return x * 19; }
+inline int f9456_20(int x) { return x * 20; }
+inline int f9456_21(int x) { return x * 21; }
+inline int f9456_22(int x) { return x * 22; }
+inline int f9456_23(int x) { return x * 23; }
+inline int f9456_24(int x) { return x * 24; }
+inline int f9456_25(int x) { return x * 25; }
+inline int f9456_26(int x) { return x * 26; }
+inline int f9456_27(int x) { return x * 27; }
+inline int f9456_28(int x) { return x * 28; }
+inline int f9456_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 946 */
+#include <vector>
+#include "h8215.h"
+#include "h1538.h"
+#include "h2050.h"
+#include "h7095.h"
+#include "h1272.h"
+#ifdef X
+#include "h4474.h"
+#endif
+struct S946 { int a; const char *s = "x//y"; };
+inline int f946_0(int x) { return x * 0; }
+inline int f946_1(int x) { return x * 1; }
+inline int f946_2(int x) { return x * 2; }
+inline int f946_3(int x) { return x * 3; }
+inline int f946_4(int x) { return x * 4; }
+inline int f946_5(int x) { return x * 5; }
+inline int f946_6(int x) { return x * 6; }
+inline int f946_7(int x) { return x * 7; }
+inline int f946_8(int x) { return x * 8; }
+inline int f946_9(int x) { return x * 9; }
+inline int f946_10(int x) { return x * 10; }
+inline int f946_11(int x) { return x * 11; }
+inline int f946_12(int x) { return x * 12; }
+inline int f946_13(int x) { return x * 13; }
+inline int f946_14(int x) { return x * 14; }
+inline int f946_15(int x) { return x * 15; }
+inline int f946_16(int x) { return x * 16; }
+inline int f946_17(int x) { return x * 17; }
+inline int f946_18(int x) { return x * 18; }
+inline int f946_19(int x) { return x * 19; }
+inline int f946_20(int x) { return x * 20; }
+inline int f946_21(int x) { return x * 21; }
+inline int f946_22(int x) { return x * 22; }
+inline int f946_23(int x) { return x * 23; }
+inline int f946_24(int x) { return x * 24; }
+inline int f946_25(int x) { return x * 25; }
+inline int f946_26(int x) { return x * 26; }
+inline int f946_27(int x) { return x * 27; }
+inline int f946_28(int x) { return x * 28; }
+inline int f946_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9462 */
+#include <vector>
+#include "h1424.h"
+#include "h3676.h"
+#include "h5647.h"
+#include "h6984.h"
+#include "h7638.h"
+#ifdef X
+#include "h1764.h"
+#endif
+struct S9462 { int a; const char *s = "x//y"; };
+inline int f9462_0(int x) { return x * 0; }
+inline int f9462_1(int x) { return x * 1; }
+inline int f9462_2(int x) { return x * 2; }
+inline int f9462_3(int x) { return x * 3; }
+inline int f9462_4(int x) { return x * 4; }
+inline int f9462_5(int x) { return x * 5; }
+inline int f9462_6(int x) { return x * 6; }
+inline int f9462_7(int x) { return x * 7; }
+inline int f9462_8(int x) { return x * 8; }
+inline int f9462_9(int x) { return x * 9; }
+inline int f9462_10(int x) { return x * 10; }
+inline int f9462_11(int x) { return x * 11; }
+inline int f9462_12(int x) { return x * 12; }
+inline int f9462_13(int x) { return x * 13; }
+inline int f9462_14(int x) { return x * 14; }
+inline int f9462_15(int x) { return x * 15; }
+inline int f9462_16(int x) { return x * 16; }
+inline int f9462_17(int x) { return x * 17; }
+inline int f9462_18(int x) { return x * 18; }
+inline int f9462_19(int x) { return x * 19; }
+inline int f9462_20(int x) { return x * 20; }
+inline int f9462_21(int x) { return x * 21; }
+inline int f9462_22(int x) { return x * 22; }
+inline int f9462_23(int x) { return x * 23; }
+inline int f9462_24(int x) { return x * 24; }
+inline int f9462_25(int x) { return x * 25; }
+inline int f9462_26(int x) { return x * 26; }
+inline int f9462_27(int x) { return x * 27; }
+inline int f9462_28(int x) { return x * 28; }
+inline int f9462_29(int x) { return x * 29; }
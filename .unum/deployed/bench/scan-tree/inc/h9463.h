@@ -0,0 +1,42 @@
+#pragma once
+/* header 9463 */
+#include <vector>
+#include "h2988.h"
+#include "h9588.h"
+#include "h1181.h"
+#include "h987.h"
+#include "h5087.h"
+#ifdef X
+#include "h8010.h"
+#endif
+struct S9463 { int a; const char *s = "x//y"; };
+inline int f9463_0(int x) { return x * 0; }
+inline int f9463_1(int x) { return x * 1; }
+inline int f9463_2(int x) { return x * 2; }
+inline int f9463_3(int x) { return x * 3; }
+inline int f9463_4(int x) { return x * 4; }
+inline int f9463_5(int x) { return x * 5; }
+inline int f9463_6(int x) { return x * 6; }
+inline int f9463_7(int x) { return x * 7; }
+inline int f9463_8(int x) { return x * 8; }
+inline int f9463_9(int x) { return x * 9; }
+inline int f9463_10(int x) { return x * 10; }
+inline int f9463_11(int x) { return x * 11; }
+inline int f9463_12(int x) { return x * 12; }
+inline int f9463_13(int x) { return x * 13; }
+inline int f9463_14(int x) { return x * 14; }
+inline int f9463_15(int x) { return x * 15; }
+inline int f9463_16(int x) { return x * 16; }
+inline int f9463_17(int x) { return x * 17; }
+inline int f9463_18(int x) { return x * 18; }
+inline int f9463_19(int x) { return x * 19; }
+inline int f9463_20(int x) { return x * 20; }
+inline int f9463_21(int x) { return x * 21; }
+inline int f9463_22(int x) { return x * 22; }
+inline int f9463_23(int x) { return x * 23; }
+inline int f9463_24(int x) { return x * 24; }
+inline int f9463_25(int x) { return x * 25; }
+inline int f9463_26(int x) { return x * 26; }
+inline int f9463_27(int x) { return x * 27; }
+inline int f9463_28(int x) { return x * 28; }
+inline int f9463_29(int x) { return x * 29; }
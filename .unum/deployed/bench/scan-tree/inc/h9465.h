@@ -0,0 +1,42 @@
+#pragma once
+/* header 9465 */
+#include <vector>
+#include "h5385.h"
+#include "h9273.h"
+#include "h9817.h"
+#include "h2836.h"
+#include "h2758.h"
+#ifdef X
+#include "h7973.h"
+#endif
+struct S9465 { int a; const char *s = "x//y"; };
+inline int f9465_0(int x) { return x * 0; }
+inline int f9465_1(int x) { return x * 1; }
+inline int f9465_2(int x) { return x * 2; }
+inline int f9465_3(int x) { return x * 3; }
+inline int f9465_4(int x) { return x * 4; }
+inline int f9465_5(int x) { return x * 5; }
+inline int f9465_6(int x) { return x * 6; }
+inline int f9465_7(int x) { return x * 7; }
+inline int f9465_8(int x) { return x * 8; }
+inline int f9465_9(int x) { return x * 9; }
+inline int f9465_10(int x) { return x * 10; }
+inline int f9465_11(int x) { return x * 11; }
+inline int f9465_12(int x) { return x * 12; }
+inline int f9465_13(int x) { return x * 13; }
+inline int f9465_14(int x) { return x * 14; }
+inline int f9465_15(int x) { return x * 15; }
+inline int f9465_16(int x) { return x * 16; }
+inline int f9465_17(int x) { return x * 17; }
+inline int f9465_18(int x) { return x * 18; }
+inline int f9465_19(int x) { return x * 19; }
+inline int f9465_20(int x) { return x * 20; }
+inline int f9465_21(int x) { return x * 21; }
+inline int f9465_22(int x) { return x * 22; }
+inline int f9465_23(int x) { return x * 23; }
+inline int f9465_24(int x) { return x * 24; }
+inline int f9465_25(int x) { return x * 25; }
+inline int f9465_26(int x) { return x * 26; }
+inline int f9465_27(int x) { return x * 27; }
+inline int f9465_28(int x) { return x * 28; }
+inline int f9465_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9467 */
+#include <vector>
+#include "h7434.h"
+#include "h9961.h"
+#include "h2597.h"
+#include "h5038.h"
+#include "h4740.h"
+#ifdef X
+#include "h1528.h"
+#endif
+struct S9467 { int a; const char *s = "x//y"; };
+inline int f9467_0(int x) { return x * 0; }
+inline int f9467_1(int x) { return x * 1; }
+inline int f9467_2(int x) { return x * 2; }
+inline int f9467_3(int x) { return x * 3; }
+inline int f9467_4(int x) { return x * 4; }
+inline int f9467_5(int x) { return x * 5; }
+inline int f9467_6(int x) { return x * 6; }
+inline int f9467_7(int x) { return x * 7; }
+inline int f9467_8(int x) { return x * 8; }
+inline int f9467_9(int x) { return x * 9; }
+inline int f9467_10(int x) { return x * 10; }
+inline int f9467_11(int x) { return x * 11; }
+inline int f9467_12(int x) { return x * 12; }
+inline int f9467_13(int x) { return x * 13; }
+inline int f9467_14(int x) { return x * 14; }
+inline int f9467_15(int x) { return x * 15; }
+inline int f9467_16(int x) { return x * 16; }
+inline int f9467_17(int x) { return x * 17; }
+inline int f9467_18(int x) { return x * 18; }
+inline int f9467_19(int x) { return x * 19; }
+inline int f9467_20(int x) { return x * 20; }
+inline int f9467_21(int x) { return x * 21; }
+inline int f9467_22(int x) { return x * 22; }
+inline int f9467_23(int x) { return x * 23; }
+inline int f9467_24(int x) { return x * 24; }
+inline int f9467_25(int x) { return x * 25; }
+inline int f9467_26(int x) { return x * 26; }
+inline int f9467_27(int x) { return x * 27; }
+inline int f9467_28(int x) { return x * 28; }
+inline int f9467_29(int x) { return x * 29; }
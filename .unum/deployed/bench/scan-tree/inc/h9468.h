@@ -0,0 +1,42 @@
+#pragma once
+/* header 9468 */
+#include <vector>
+#include "h1587.h"
+#include "h8347.h"
+#include "h8611.h"
+#include "h8018.h"
+#include "h3583.h"
+#ifdef X
+#include "h2828.h"
+#endif
+struct S9468 { int a; const char *s = "x//y"; };
+inline int f9468_0(int x) { return x * 0; }
+inline int f9468_1(int x) { return x * 1; }
+inline int f9468_2(int x) { return x * 2; }
+inline int f9468_3(int x) { return x * 3; }
+inline int f9468_4(int x) { return x * 4; }
+inline int f9468_5(int x) { return x * 5; }
+inline int f9468_6(int x) { return x * 6; }
+inline int f9468_7(int x) { return x * 7; }
+inline int f9468_8(int x) { return x * 8; }
+inline int f9468_9(int x) { return x * 9; }
+inline int f9468_10(int x) { return x * 10; }
+inline int f9468_11(int x) { return x * 11; }
+inline int f9468_12(int x) { return x * 12; }
+inline int f9468_13(int x) { return x * 13; }
+inline int f9468_14(int x) { return x * 14; }
+inline int f9468_15(int x) { return x * 15; }
+inline int f9468_16(int x) { return x * 16; }
+inline int f9468_17(int x) { return x * 17; }
+inline int f9468_18(int x) { return x * 18; }
+inline int f9468_19(int x) { return x * 19; }
+inline int f9468_20(int x) { return x * 20; }
+inline int f9468_21(int x) { return x * 21; }
+inline int f9468_22(int x) { return x * 22; }
+inline int f9468_23(int x) { return x * 23; }
+inline int f9468_24(int x) { return x * 24; }
+inline int f9468_25(int x) { return x * 25; }
+inline int f9468_26(int x) { return x * 26; }
+inline int f9468_27(int x) { return x * 27; }
+inline int f9468_28(int x) { return x * 28; }
+inline int f9468_29(int x) { return x * 29; }
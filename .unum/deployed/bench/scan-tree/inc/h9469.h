@@ -0,0 +1,42 @@
+#pragma once
+/* header 9469 */
+#include <vector>
+#include "h9456.h"
+#include "h4859.h"
+#include "h9837.h"
+#include "h2091.h"
+#include "h3291.h"
+#ifdef X
+#include "h9883.h"
+#endif
+struct S9469 { int a; const char *s = "x//y"; };
+inline int f9469_0(int x) { return x * 0; }
+inline int f9469_1(int x) { return x * 1; }
+inline int f9469_2(int x) { return x * 2; }
+inline int f9469_3(int x) { return x * 3; }
+inline int f9469_4(int x) { return x * 4; }
+inline int f9469_5(int x) { return x * 5; }
+inline int f9469_6(int x) { return x * 6; }
+inline int f9469_7(int x) { return x * 7; }
+inline int f9469_8(int x) { return x * 8; }
+inline int f9469_9(int x) { return x * 9; }
+inline int f9469_10(int x) { return x * 10; }
+inline int f9469_11(int x) { return x * 11; }
+inline int f9469_12(int x) { return x * 12; }
+inline int f9469_13(int x) { return x * 13; }
+inline int f9469_14(int x) { return x * 14; }
+inline int f9469_15(int x) { return x * 15; }
+inline int f9469_16(int x) { return x * 16; }
+inline int f9469_17(int x) { return x * 17; }
+inline int f9469_18(int x) { return x * 18; }
+inline int f9469_19(int x) { return x * 19; }
+inline int f9469_20(int x) { return x * 20; }
+inline int f9469_21(int x) { return x * 21; }
+inline int f9469_22(int x) { return x * 22; }
+inline int f9469_23(int x) { return x * 23; }
+inline int f9469_24(int x) { return x * 24; }
+inline int f9469_25(int x) { return x * 25; }
+inline int f9469_26(int x) { return x * 26; }
+inline int f9469_27(int x) { return x * 27; }
+inline int f9469_28(int x) { return x * 28; }
+inline int f9469_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9471 */
+#include <vector>
+#include "h9846.h"
+#include "h1783.h"
+#include "h8626.h"
+#include "h4301.h"
+#include "h5962.h"
+#ifdef X
+#include "h3544.h"
+#endif
+struct S9471 { int a; const char *s = "x//y"; };
+inline int f9471_0(int x) { return x * 0; }
+inline int f9471_1(int x) { return x * 1; }
+inline int f9471_2(int x) { return x * 2; }
+inline int f9471_3(int x) { return x * 3; }
+inline int f9471_4(int x) { return x * 4; }
+inline int f9471_5(int x) { return x * 5; }
+inline int f9471_6(int x) { return x * 6; }
+inline int f9471_7(int x) { return x * 7; }
+inline int f9471_8(int x) { return x * 8; }
+inline int f9471_9(int x) { return x * 9; }
+inline int f9471_10(int x) { return x * 10; }
+inline int f9471_11(int x) { return x * 11; }
+inline int f9471_12(int x) { return x * 12; }
+inline int f9471_13(int x) { return x * 13; }
+inline int f9471_14(int x) { return x * 14; }
+inline int f9471_15(int x) { return x * 15; }
+inline int f9471_16(int x) { return x * 16; }
+inline int f9471_17(int x) { return x * 17; }
+inline int f9471_18(int x) { return x * 18; }
+inline int f9471_19(int x) { return x * 19; }
+inline int f9471_20(int x) { return x * 20; }
+inline int f9471_21(int x) { return x * 21; }
+inline int f9471_22(int x) { return x * 22; }
+inline int f9471_23(int x) { return x * 23; }
+inline int f9471_24(int x) { return x * 24; }
+inline int f9471_25(int x) { return x * 25; }
+inline int f9471_26(int x) { return x * 26; }
+inline int f9471_27(int x) { return x * 27; }
+inline int f9471_28(int x) { return x * 28; }
+inline int f9471_29(int x) { return x * 29; }
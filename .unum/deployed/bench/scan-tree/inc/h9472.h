@@ -0,0 +1,42 @@
+#pragma once
+/* header 9472 */
+#include <vector>
+#include "h6882.h"
+#include "h8786.h"
+#include "h4217.h"
+#include "h7020.h"
+#include "h1188.h"
+#ifdef X
+#include "h7538.h"
+#endif
+struct S9472 { int a; const char *s = "x//y"; };
+inline int f9472_0(int x) { return x * 0; }
+inline int f9472_1(int x) { return x * 1; }
+inline int f9472_2(int x) { return x * 2; }
+inline int f9472_3(int x) { return x * 3; }
+inline int f9472_4(int x) { return x * 4; }
+inline int f9472_5(int x) { return x * 5; }
+inline int f9472_6(int x) { return x * 6; }
+inline int f9472_7(int x) { return x * 7; }
+inline int f9472_8(int x) { return x * 8; }
+inline int f9472_9(int x) { return x * 9; }
+inline int f9472_10(int x) { return x * 10; }
+inline int f9472_11(int x) { return x * 11; }
+inline int f9472_12(int x) { return x * 12; }
+inline int f9472_13(int x) { return x * 13; }
+inline int f9472_14(int x) { return x * 14; }
+inline int f9472_15(int x) { return x * 15; }
+inline int f9472_16(int x) { return x * 16; }
+inline int f9472_17(int x) { return x * 17; }
+inline int f9472_18(int x) { return x * 18; }
+inline int f9472_19(int x) { return x * 19; }
+inline int f9472_20(int x) { return x * 20; }
+inline int f9472_21(int x) { return x * 21; }
+inline int f9472_22(int x) { return x * 22; }
+inline int f9472_23(int x) { return x * 23; }
+inline int f9472_24(int x) { return x * 24; }
+inline int f9472_25(int x) { return x * 25; }
+inline int f9472_26(int x) { return x * 26; }
+inline int f9472_27(int x) { return x * 27; }
+inline int f9472_28(int x) { return x * 28; }
+inline int f9472_29(int x) { return x * 29; }
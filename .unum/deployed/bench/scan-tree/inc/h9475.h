@@ -0,0 +1,42 @@
+#pragma once
+/* header 9475 */
+#include <vector>
+#include "h1612.h"
+#include "h3430.h"
+#include "h3657.h"
+#include "h571.h"
+#include "h2975.h"
+#ifdef X
+#include "h2794.h"
+#endif
+struct S9475 { int a; const char *s = "x//y"; };
+inline int f9475_0(int x) { return x * 0; }
+inline int f9475_1(int x) { return x * 1; }
+inline int f9475_2(int x) { return x * 2; }
+inline int f9475_3(int x) { return x * 3; }
+inline int f9475_4(int x) { return x * 4; }
+inline int f9475_5(int x) { return x * 5; }
+inline int f9475_6(int x) { return x * 6; }
+inline int f9475_7(int x) { return x * 7; }
+inline int f9475_8(int x) { return x * 8; }
+inline int f9475_9(int x) { return x * 9; }
+inline int f9475_10(int x) { return x * 10; }
+inline int f9475_11(int x) { return x * 11; }
+inline int f9475_12(int x) { return x * 12; }
+inline int f9475_13(int x) { return x * 13; }
+inline int f9475_14(int x) { return x * 14; }
+inline int f9475_15(int x) { return x * 15; }
+inline int f9475_16(int x) { return x * 16; }
+inline int f9475_17(int x) { return x * 17; }
+inline int f9475_18(int x) { return x * 18; }
+inline int f9475_19(int x) { return x * 19; }
+inline int f9475_20(int x) { return x * 20; }
+inline int f9475_21(int x) { return x * 21; }
+inline int f9475_22(int x) { return x * 22; }
+inline int f9475_23(int x) { return x * 23; }
+inline int f9475_24(int x) { return x * 24; }
+inline int f9475_25(int x) { return x * 25; }
+inline int f9475_26(int x) { return x * 26; }
+inline int f9475_27(int x) { return x * 27; }
+inline int f9475_28(int x) { return x * 28; }
+inline int f9475_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9476 */
+#include <vector>
+#include "h1691.h"
+#include "h9271.h"
+#include "h380.h"
+#include "h9547.h"
+#include "h871.h"
+#ifdef X
+#include "h2894.h"
+#endif
+struct S9476 { int a; const char *s = "x//y"; };
+inline int f9476_0(int x) { return x * 0; }
+inline int f9476_1(int x) { return x * 1; }
+inline int f9476_2(int x) { return x * 2; }
+inline int f9476_3(int x) { return x * 3; }
+inline int f9476_4(int x) { return x * 4; }
+inline int f9476_5(int x) { return x * 5; }
+inline int f9476_6(int x) { return x * 6; }
+inline int f9476_7(int x) { return x * 7; }
+inline int f9476_8(int x) { return x * 8; }
+inline int f9476_9(int x) { return x * 9; }
+inline int f9476_10(int x) { return x * 10; }
+inline int f9476_11(int x) { return x * 11; }
+inline int f9476_12(int x) { return x * 12; }
+inline int f9476_13(int x) { return x * 13; }
+inline int f9476_14(int x) { return x * 14; }
+inline int f9476_15(int x) { return x * 15; }
+inline int f9476_16(int x) { return x * 16; }
+inline int f9476_17(int x) { return x * 17; }
+inline int f9476_18(int x) { return x * 18; }
+inline int f9476_19(int x) { return x * 19; }
+inline int f9476_20(int x) { return x * 20; }
+inline int f9476_21(int x) { return x * 21; }
+inline int f9476_22(int x) { return x * 22; }
+inline int f9476_23(int x) { return x * 23; }
+inline int f9476_24(int x) { return x * 24; }
+inline int f9476_25(int x) { return x * 25; }
+inline int f9476_26(int x) { return x * 26; }
+inline int f9476_27(int x) { return x * 27; }
+inline int f9476_28(int x) { return x * 28; }
+inline int f9476_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9480 */
+#include <vector>
+#include "h8514.h"
+#include "h217.h"
+#include "h7875.h"
+#include "h6547.h"
+#include "h7353.h"
+#ifdef X
+#include "h7969.h"
+#endif
+struct S9480 { int a; const char *s = "x//y"; };
+inline int f9480_0(int x) { return x * 0; }
+inline int f9480_1(int x) { return x * 1; }
+inline int f9480_2(int x) { return x * 2; }
+inline int f9480_3(int x) { return x * 3; }
+inline int f9480_4(int x) { return x * 4; }
+inline int f9480_5(int x) { return x * 5; }
+inline int f9480_6(int x) { return x * 6; }
+inline int f9480_7(int x) { return x * 7; }
+inline int f9480_8(int x) { return x * 8; }
+inline int f9480_9(int x) { return x * 9; }
+inline int f9480_10(int x) { return x * 10; }
+inline int f9480_11(int x) { return x * 11; }
+inline int f9480_12(int x) { return x * 12; }
+inline int f9480_13(int x) { return x * 13; }
+inline int f9480_14(int x) { return x * 14; }
+inline int f9480_15(int x) { return x * 15; }
+inline int f9480_16(int x) { return x * 16; }
+inline int f9480_17(int x) { return x * 17; }
+inline int f9480_18(int x) { return x * 18; }
+inline int f9480_19(int x) { return x * 19; }
+inline int f9480_20(int x) { return x * 20; }
+inline int f9480_21(int x) { return x * 21; }
+inline int f9480_22(int x) { return x * 22; }
+inline int f9480_23(int x) { return x * 23; }
+inline int f9480_24(int x) { return x * 24; }
+inline int f9480_25(int x) { return x * 25; }
+inline int f9480_26(int x) { return x * 26; }
+inline int f9480_27(int x) { return x * 27; }
+inline int f9480_28(int x) { return x * 28; }
+inline int f9480_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9481 */
+#include <vector>
+#include "h7984.h"
+#include "h7569.h"
+#include "h3616.h"
+#include "h3910.h"
+#include "h8526.h"
+#ifdef X
+#include "h8.h"
+#endif
+struct S9481 { int a; const char *s = "x//y"; };
+inline int f9481_0(int x) { return x * 0; }
+inline int f9481_1(int x) { return x * 1; }
+inline int f9481_2(int x) { return x * 2; }
+inline int f9481_3(int x) { return x * 3; }
+inline int f9481_4(int x) { return x * 4; }
+inline int f9481_5(int x) { return x * 5; }
+inline int f9481_6(int x) { return x * 6; }
+inline int f9481_7(int x) { return x * 7; }
+inline int f9481_8(int x) { return x * 8; }
+inline int f9481_9(int x) { return x * 9; }
+inline int f9481_10(int x) { return x * 10; }
+inline int f9481_11(int x) { return x * 11; }
+inline int f9481_12(int x) { return x * 12; }
+inline int f9481_13(int x) { return x * 13; }
+inline int f9481_14(int x) { return x * 14; }
+inline int f9481_15(int x) { return x * 15; }
+inline int f9481_16(int x) { return x * 16; }
+inline int f9481_17(int x) { return x * 17; }
+inline int f9481_18(int x) { return x * 18; }
+inline int f9481_19(int x) { return x * 19; }
+inline int f9481_20(int x) { return x * 20; }
+inline int f9481_21(int x) { return x * 21; }
+inline int f9481_22(int x) { return x * 22; }
+inline int f9481_23(int x) { return x * 23; }
+inline int f9481_24(int x) { return x * 24; }
+inline int f9481_25(int x) { return x * 25; }
+inline int f9481_26(int x) { return x * 26; }
+inline int f9481_27(int x) { return x * 27; }
+inline int f9481_28(int x) { return x * 28; }
+inline int f9481_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9490 */
+#include <vector>
+#include "h7235.h"
+#include "h1457.h"
+#include "h8411.h"
+#include "h6793.h"
+#include "h9590.h"
+#ifdef X
+#include "h6320.h"
+#endif
+struct S9490 { int a; const char *s = "x//y"; };
+inline int f9490_0(int x) { return x * 0; }
+inline int f9490_1(int x) { return x * 1; }
+inline int f9490_2(int x) { return x * 2; }
+inline int f9490_3(int x) { return x * 3; }
+inline int f9490_4(int x) { return x * 4; }
+inline int f9490_5(int x) { return x * 5; }
+inline int f9490_6(int x) { return x * 6; }
+inline int f9490_7(int x) { return x * 7; }
+inline int f9490_8(int x) { return x * 8; }
+inline int f9490_9(int x) { return x * 9; }
+inline int f9490_10(int x) { return x * 10; }
+inline int f9490_11(int x) { return x * 11; }
+inline int f9490_12(int x) { return x * 12; }
+inline int f9490_13(int x) { return x * 13; }
+inline int f9490_14(int x) { return x * 14; }
+inline int f9490_15(int x) { return x * 15; }
+inline int f9490_16(int x) { return x * 16; }
+inline int f9490_17(int x) { return x * 17; }
+inline int f9490_18(int x) { return x * 18; }
+inline int f9490_19(int x) { return x * 19; }
+inline int f9490_20(int x) { return x * 20; }
+inline int f9490_21(int x) { return x * 21; }
+inline int f9490_22(int x) { return x * 22; }
+inline int f9490_23(int x) { return x * 23; }
+inline int f9490_24(int x) { return x * 24; }
+inline int f9490_25(int x) { return x * 25; }
+inline int f9490_26(int x) { return x * 26; }
+inline int f9490_27(int x) { return x * 27; }
+inline int f9490_28(int x) { return x * 28; }
+inline int f9490_29(int x) { return x * 29; }
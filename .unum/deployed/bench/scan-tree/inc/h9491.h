@@ -0,0 +1,42 @@
+#pragma once
+/* header 9491 */
+#include <vector>
+#include "h299.h"
+#include "h2405.h"
+#include "h2203.h"
+#include "h6916.h"
+#include "h5087.h"
+#ifdef X
+#include "h5533.h"
+#endif
+struct S9491 { int a; const char *s = "x//y"; };
+inline int f9491_0(int x) { return x * 0; }
+inline int f9491_1(int x) { return x * 1; }
+inline int f9491_2(int x) { return x * 2; }
+inline int f9491_3(int x) { return x * 3; }
+inline int f9491_4(int x) { return x * 4; }
+inline int f9491_5(int x) { return x * 5; }
+inline int f9491_6(int x) { return x * 6; }
+inline int f9491_7(int x) { return x * 7; }
+inline int f9491_8(int x) { return x * 8; }
+inline int f9491_9(int x) { return x * 9; }
+inline int f9491_10(int x) { return x * 10; }
+inline int f9491_11(int x) { return x * 11; }
+inline int f9491_12(int x) { return x * 12; }
+inline int f9491_13(int x) { return x * 13; }
+inline int f9491_14(int x) { return x * 14; }
+inline int f9491_15(int x) { return x * 15; }
+inline int f9491_16(int x) { return x * 16; }
+inline int f9491_17(int x) { return x * 17; }
+inline int f9491_18(int x) { return x * 18; }
+inline int f9491_19(int x) { return x * 19; }
+inline int f9491_20(int x) { return x * 20; }
+inline int f9491_21(int x) { return x * 21; }
+inline int f9491_22(int x) { return x * 22; }
+inline int f9491_23(int x) { return x * 23; }
+inline int f9491_24(int x) { return x * 24; }
+inline int f9491_25(int x) { return x * 25; }
+inline int f9491_26(int x) { return x * 26; }
+inline int f9491_27(int x) { return x * 27; }
+inline int f9491_28(int x) { return x * 28; }
+inline int f9491_29(int x) { return x * 29; }
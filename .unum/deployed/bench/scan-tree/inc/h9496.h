@@ -0,0 +1,42 @@
+#pragma once
+/* header 9496 */
+#include <vector>
+#include "h9959.h"
+#include "h5658.h"
+#include "h6288.h"
+#include "h4365.h"
+#include "h8286.h"
+#ifdef X
+#include "h4725.h"
+#endif
+struct S9496 { int a; const char *s = "x//y"; };
+inline int f9496_0(int x) { return x * 0; }
+inline int f9496_1(int x) { return x * 1; }
+inline int f9496_2(int x) { return x * 2; }
+inline int f9496_3(int x) { return x * 3; }
+inline int f9496_4(int x) { return x * 4; }
+inline int f9496_5(int x) { return x * 5; }
+inline int f9496_6(int x) { return x * 6; }
+inline int f9496_7(int x) { return x * 7; }
+inline int f9496_8(int x) { return x * 8; }
+inline int f9496_9(int x) { return x * 9; }
+inline int f9496_10(int x) { return x * 10; }
+inline int f9496_11(int x) { return x * 11; }
+inline int f9496_12(int x) { return x * 12; }
+inline int f9496_13(int x) { return x * 13; }
+inline int f9496_14(int x) { return x * 14; }
+inline int f9496_15(int x) { return x * 15; }
+inline int f9496_16(int x) { return x * 16; }
+inline int f9496_17(int x) { return x * 17; }
+inline int f9496_18(int x) { return x * 18; }
+inline int f9496_19(int x) { return x * 19; }
+inline int f9496_20(int x) { return x * 20; }
+inline int f9496_21(int x) { return x * 21; }
+inline int f9496_22(int x) { return x * 22; }
+inline int f9496_23(int x) { return x * 23; }
+inline int f9496_24(int x) { return x * 24; }
+inline int f9496_25(int x) { return x * 25; }
+inline int f9496_26(int x) { return x * 26; }
+inline int f9496_27(int x) { return x * 27; }
+inline int f9496_28(int x) { return x * 28; }
+inline int f9496_29(int x) { return x * 29; }
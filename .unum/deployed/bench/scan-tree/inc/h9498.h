@@ -0,0 +1,42 @@
+#pragma once
+/* header 9498 */
+#include <vector>
+#include "h3399.h"
+#include "h8631.h"
+#include "h7956.h"
+#include "h7643.h"
+#include "h9158.h"
+#ifdef X
+#include "h1671.h"
+#endif
+struct S9498 { int a; const char *s = "x//y"; };
+inline int f9498_0(int x) { return x * 0; }
+inline int f9498_1(int x) { return x * 1; }
+inline int f9498_2(int x) { return x * 2; }
+inline int f9498_3(int x) { return x * 3; }
+inline int f9498_4(int x) { return x * 4; }
+inline int f9498_5(int x) { return x * 5; }
+inline int f9498_6(int x) { return x * 6; }
+inline int f9498_7(int x) { return x * 7; }
+inline int f9498_8(int x) { return x * 8; }
+inline int f9498_9(int x) { return x * 9; }
+inline int f9498_10(int x) { return x * 10; }
+inline int f9498_11(int x) { return x * 11; }
+inline int f9498_12(int x) { return x * 12; }
+inline int f9498_13(int x) { return x * 13; }
+inline int f9498_14(int x) { return x * 14; }
+inline int f9498_15(int x) { return x * 15; }
+inline int f9498_16(int x) { return x * 16; }
+inline int f9498_17(int x) { return x * 17; }
+inline int f9498_18(int x) { return x * 18; }
+inline int f9498_19(int x) { return x * 19; }
+inline int f9498_20(int x) { return x * 20; }
+inline int f9498_21(int x) { return x * 21; }
+inline int f9498_22(int x) { return x * 22; }
+inline int f9498_23(int x) { return x * 23; }
+inline int f9498_24(int x) { return x * 24; }
+inline int f9498_25(int x) { return x * 25; }
+inline int f9498_26(int x) { return x * 26; }
+inline int f9498_27(int x) { return x * 27; }
+inline int f9498_28(int x) { return x * 28; }
+inline int f9498_29(int x) { return x * 29; }
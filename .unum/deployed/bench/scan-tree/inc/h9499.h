@@ -0,0 +1,42 @@
+#pragma once
+/* header 9499 */
+#include <vector>
+#include "h6940.h"
+#include "h8301.h"
+#include "h708.h"
+#include "h3430.h"
+#include "h8020.h"
+#ifdef X
+#include "h5746.h"
+#endif
+struct S9499 { int a; const char *s = "x//y"; };
+inline int f9499_0(int x) { return x * 0; }
+inline int f9499_1(int x) { return x * 1; }
+inline int f9499_2(int x) { return x * 2; }
+inline int f9499_3(int x) { return x * 3; }
+inline int f9499_4(int x) { return x * 4; }
+inline int f9499_5(int x) { return x * 5; }
+inline int f9499_6(int x) { return x * 6; }
+inline int f9499_7(int x) { return x * 7; }
+inline int f9499_8(int x) { return x * 8; }
+inline int f9499_9(int x) { return x * 9; }
+inline int f9499_10(int x) { return x * 10; }
+inline int f9499_11(int x) { return x * 11; }
+inline int f9499_12(int x) { return x * 12; }
+inline int f9499_13(int x) { return x * 13; }
+inline int f9499_14(int x) { return x * 14; }
+inline int f9499_15(int x) { return x * 15; }
+inline int f9499_16(int x) { return x * 16; }
+inline int f9499_17(int x) { return x * 17; }
+inline int f9499_18(int x) { return x * 18; }
+inline int f9499_19(int x) { return x * 19; }
+inline int f9499_20(int x) { return x * 20; }
+inline int f9499_21(int x) { return x * 21; }
+inline int f9499_22(int x) { return x * 22; }
+inline int f9499_23(int x) { return x * 23; }
+inline int f9499_24(int x) { return x * 24; }
+inline int f9499_25(int x) { return x * 25; }
+inline int f9499_26(int x) { return x * 26; }
+inline int f9499_27(int x) { return x * 27; }
+inline int f9499_28(int x) { return x * 28; }
+inline int f9499_29(int x) { return x * 29; }
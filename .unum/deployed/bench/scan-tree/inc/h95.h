@@ -0,0 +1,42 @@
+#pragma once
+/* header 95 */
+#include <vector>
+#include "h4527.h"
+#include "h2933.h"
+#include "h7968.h"
+#include "h3818.h"
+#include "h3833.h"
+#ifdef X
+#include "h2013.h"
+#endif
+struct S95 { int a; const char *s = "x//y"; };
+inline int f95_0(int x) { return x * 0; }
+inline int f95_1(int x) { return x * 1; }
+inline int f95_2(int x) { return x * 2; }
+inline int f95_3(int x) { return x * 3; }
+inline int f95_4(int x) { return x * 4; }
+inline int f95_5(int x) { return x * 5; }
+inline int f95_6(int x) { return x * 6; }
+inline int f95_7(int x) { return x * 7; }
+inline int f95_8(int x) { return x * 8; }
+inline int f95_9(int x) { return x * 9; }
+inline int f95_10(int x) { return x * 10; }
+inline int f95_11(int x) { return x * 11; }
+inline int f95_12(int x) { return x * 12; }
+inline int f95_13(int x) { return x * 13; }
+inline int f95_14(int x) { return x * 14; }
+inline int f95_15(int x) { return x * 15; }
+inline int f95_16(int x) { return x * 16; }
+inline int f95_17(int x) { return x * 17; }
+inline int f95_18(int x) { return x * 18; }
+inline int f95_19(int x) { return x * 19; }
+inline int f95_20(int x) { return x * 20; }
+inline int f95_21(int x) { return x * 21; }
+inline int f95_22(int x) { return x * 22; }
+inline int f95_23(int x) { return x * 23; }
+inline int f95_24(int x) { return x * 24; }
+inline int f95_25(int x) { return x * 25; }
+inline int f95_26(int x) { return x * 26; }
+inline int f95_27(int x) { return x * 27; }
+inline int f95_28(int x) { return x * 28; }
+inline int f95_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 950 */
+#include <vector>
+#include "h7825.h"
+#include "h241.h"
+#include "h545.h"
+#include "h2905.h"
+#include "h1622.h"
+#ifdef X
+#include "h2724.h"
+#endif
+struct S950 { int a; const char *s = "x//y"; };
+inline int f950_0(int x) { return x * 0; }
+inline int f950_1(int x) { return x * 1; }
+inline int f950_2(int x) { return x * 2; }
+inline int f950_3(int x) { return x * 3; }
+inline int f950_4(int x) { return x * 4; }
+inline int f950_5(int x) { return x * 5; }
+inline int f950_6(int x) { return x * 6; }
+inline int f950_7(int x) { return x * 7; }
+inline int f950_8(int x) { return x * 8; }
+inline int f950_9(int x) { return x * 9; }
+inline int f950_10(int x) { return x * 10; }
+inline int f950_11(int x) { return x * 11; }
+inline int f950_12(int x) { return x * 12; }
+inline int f950_13(int x) { return x * 13; }
+inline int f950_14(int x) { return x * 14; }
+inline int f950_15(int x) { return x * 15; }
+inline int f950_16(int x) { return x * 16; }
+inline int f950_17(int x) { return x * 17; }
+inline int f950_18(int x) { return x * 18; }
+inline int f950_19(int x) { return x * 19; }
+inline int f950_20(int x) { return x * 20; }
+inline int f950_21(int x) { return x * 21; }
+inline int f950_22(int x) { return x * 22; }
+inline int f950_23(int x) { return x * 23; }
+inline int f950_24(int x) { return x * 24; }
+inline int f950_25(int x) { return x * 25; }
+inline int f950_26(int x) { return x * 26; }
+inline int f950_27(int x) { return x * 27; }
+inline int f950_28(int x) { return x * 28; }
+inline int f950_29(int x) { return x * 29; }
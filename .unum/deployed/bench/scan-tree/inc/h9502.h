@@ -0,0 +1,42 @@
+#pragma once
+/* header 9502 */
+#include <vector>
+#include "h5427.h"
+#include "h6692.h"
+#include "h1816.h"
+#include "h7603.h"
+#include "h6939.h"
+#ifdef X
+#include "h308.h"
+#endif
+struct S9502 { int a; const char *s = "x//y"; };
+inline int f9502_0(int x) { return x * 0; }
+inline int f9502_1(int x) { return x * 1; }
+inline int f9502_2(int x) { return x * 2; }
+inline int f9502_3(int x) { return x * 3; }
+inline int f9502_4(int x) { return x * 4; }
+inline int f9502_5(int x) { return x * 5; }
+inline int f9502_6(int x) { return x * 6; }
+inline int f9502_7(int x) { return x * 7; }
+inline int f9502_8(int x) { return x * 8; }
+inline int f9502_9(int x) { return x * 9; }
+inline int f9502_10(int x) { return x * 10; }
+inline int f9502_11(int x) { return x * 11; }
+inline int f9502_12(int x) { return x * 12; }
+inline int f9502_13(int x) { return x * 13; }
+inline int f9502_14(int x) { return x * 14; }
+inline int f9502_15(int x) { return x * 15; }
+inline int f9502_16(int x) { return x * 16; }
+inline int f9502_17(int x) { return x * 17; }
+inline int f9502_18(int x) { return x * 18; }
+inline int f9502_19(int x) { return x * 19; }
+inline int f9502_20(int x) { return x * 20; }
+inline int f9502_21(int x) { return x * 21; }
+inline int f9502_22(int x) { return x * 22; }
+inline int f9502_23(int x) { return x * 23; }
+inline int f9502_24(int x) { return x * 24; }
+inline int f9502_25(int x) { return x * 25; }
+inline int f9502_26(int x) { return x * 26; }
+inline int f9502_27(int x) { return x * 27; }
+inline int f9502_28(int x) { return x * 28; }
+inline int f9502_29(int x) { return x * 29; }
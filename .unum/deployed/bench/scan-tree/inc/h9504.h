@@ -0,0 +1,42 @@
+#pragma once
+/* header 9504 */
+#include <vector>
+#include "h2445.h"
+#include "h883.h"
+#include "h8474.h"
+#include "h3383.h"
+#include "h5770.h"
+#ifdef X
+#include "h4065.h"
+#endif
+struct S9504 { int a; const char *s = "x//y"; };
+inline int f9504_0(int x) { return x * 0; }
+inline int f9504_1(int x) { return x * 1; }
+inline int f9504_2(int x) { return x * 2; }
+inline int f9504_3(int x) { return x * 3; }
+inline int f9504_4(int x) { return x * 4; }
+inline int f9504_5(int x) { return x * 5; }
+inline int f9504_6(int x) { return x * 6; }
+inline int f9504_7(int x) { return x * 7; }
+inline int f9504_8(int x) { return x * 8; }
+inline int f9504_9(int x) { return x * 9; }
+inline int f9504_10(int x) { return x * 10; }
+inline int f9504_11(int x) { return x * 11; }
+inline int f9504_12(int x) { return x * 12; }
+inline int f9504_13(int x) { return x * 13; }
+inline int f9504_14(int x) { return x * 14; }
+inline int f9504_15(int x) { return x * 15; }
+inline int f9504_16(int x) { return x * 16; }
+inline int f9504_17(int x) { return x * 17; }
+inline int f9504_18(int x) { return x * 18; }
+inline int f9504_19(int x) { return x * 19; }
+inline int f9504_20(int x) { return x * 20; }
+inline int f9504_21(int x) { return x * 21; }
+inline int f9504_22(int x) { return x * 22; }
+inline int f9504_23(int x) { return x * 23; }
+inline int f9504_24(int x) { return x * 24; }
+inline int f9504_25(int x) { return x * 25; }
+inline int f9504_26(int x) { return x * 26; }
+inline int f9504_27(int x) { return x * 27; }
+inline int f9504_28(int x) { return x * 28; }
+inline int f9504_29(int x) { return x * 29; }
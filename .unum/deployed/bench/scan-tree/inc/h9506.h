@@ -0,0 +1,42 @@
+#pragma once
+/* header 9506 */
+#include <vector>
+#include "h362.h"
+#include "h8416.h"
+#include "h672.h"
+#include "h4741.h"
+#include "h4870.h"
+#ifdef X
+#include "h9461.h"
+#endif
+struct S9506 { int a; const char *s = "x//y"; };
+inline int f9506_0(int x) { return x * 0; }
+inline int f9506_1(int x) { return x * 1; }
+inline int f9506_2(int x) { return x * 2; }
+inline int f9506_3(int x) { return x * 3; }
+inline int f9506_4(int x) { return x * 4; }
+inline int f9506_5(int x) { return x * 5; }
+inline int f9506_6(int x) { return x * 6; }
+inline int f9506_7(int x) { return x * 7; }
+inline int f9506_8(int x) { return x * 8; }
+inline int f9506_9(int x) { return x * 9; }
+inline int f9506_10(int x) { return x * 10; }
+inline int f9506_11(int x) { return x * 11; }
+inline int f9506_12(int x) { return x * 12; }
+inline int f9506_13(int x) { return x * 13; }
+inline int f9506_14(int x) { return x * 14; }
+inline int f9506_15(int x) { return x * 15; }
+inline int f9506_16(int x) { return x * 16; }
+inline int f9506_17(int x) { return x * 17; }
+inline int f9506_18(int x) { return x * 18; }
+inline int f9506_19(int x) { return x * 19; }
+inline int f9506_20(int x) { return x * 20; }
+inline int f9506_21(int x) { return x * 21; }
+inline int f9506_22(int x) { return x * 22; }
+inline int f9506_23(int x) { return x * 23; }
+inline int f9506_24(int x) { return x * 24; }
+inline int f9506_25(int x) { return x * 25; }
+inline int f9506_26(int x) { return x * 26; }
+inline int f9506_27(int x) { return x * 27; }
+inline int f9506_28(int x) { return x * 28; }
+inline int f9506_29(int x) { return x * 29; }
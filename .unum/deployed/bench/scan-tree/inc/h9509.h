@@ -0,0 +1,42 @@
+#pragma once
+/* header 9509 */
+#include <vector>
+#include "h4964.h"
+#include "h7240.h"
+#include "h8515.h"
+#include "h7121.h"
+#include "h454.h"
+#ifdef X
+#include "h8840.h"
+#endif
+struct S9509 { int a; const char *s = "x//y"; };
+inline int f9509_0(int x) { return x * 0; }
+inline int f9509_1(int x) { return x * 1; }
+inline int f9509_2(int x) { return x * 2; }
+inline int f9509_3(int x) { return x * 3; }
+inline int f9509_4(int x) { return x * 4; }
+inline int f9509_5(int x) { return x * 5; }
+inline int f9509_6(int x) { return x * 6; }
+inline int f9509_7(int x) { return x * 7; }
+inline int f9509_8(int x) { return x * 8; }
+inline int f9509_9(int x) { return x * 9; }
+inline int f9509_10(int x) { return x * 10; }
+inline int f9509_11(int x) { return x * 11; }
+inline int f9509_12(int x) { return x * 12; }
+inline int f9509_13(int x) { return x * 13; }
+inline int f9509_14(int x) { return x * 14; }
+inline int f9509_15(int x) { return x * 15; }
+inline int f9509_16(int x) { return x * 16; }
+inline int f9509_17(int x) { return x * 17; }
+inline int f9509_18(int x) { return x * 18; }
+inline int f9509_19(int x) { return x * 19; }
+inline int f9509_20(int x) { return x * 20; }
+inline int f9509_21(int x) { return x * 21; }
+inline int f9509_22(int x) { return x * 22; }
+inline int f9509_23(int x) { return x * 23; }
+inline int f9509_24(int x) { return x * 24; }
+inline int f9509_25(int x) { return x * 25; }
+inline int f9509_26(int x) { return x * 26; }
+inline int f9509_27(int x) { return x * 27; }
+inline int f9509_28(int x) { return x * 28; }
+inline int f9509_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9511 */
+#include <vector>
+#include "h6909.h"
+#include "h2346.h"
+#include "h5861.h"
+#include "h9146.h"
+#include "h6057.h"
+#ifdef X
+#include "h5625.h"
+#endif
+struct S9511 { int a; const char *s = "x//y"; };
+inline int f9511_0(int x) { return x * 0; }
+inline int f9511_1(int x) { return x * 1; }
+inline int f9511_2(int x) { return x * 2; }
+inline int f9511_3(int x) { return x * 3; }
+inline int f9511_4(int x) { return x * 4; }
+inline int f9511_5(int x) { return x * 5; }
+inline int f9511_6(int x) { return x * 6; }
+inline int f9511_7(int x) { return x * 7; }
+inline int f9511_8(int x) { return x * 8; }
+inline int f9511_9(int x) { return x * 9; }
+inline int f9511_10(int x) { return x * 10; }
+inline int f9511_11(int x) { return x * 11; }
+inline int f9511_12(int x) { return x * 12; }
+inline int f9511_13(int x) { return x * 13; }
+inline int f9511_14(int x) { return x * 14; }
+inline int f9511_15(int x) { return x * 15; }
+inline int f9511_16(int x) { return x * 16; }
+inline int f9511_17(int x) { return x * 17; }
+inline int f9511_18(int x) { return x * 18; }
+inline int f9511_19(int x) { return x * 19; }
+inline int f9511_20(int x) { return x * 20; }
+inline int f9511_21(int x) { return x * 21; }
+inline int f9511_22(int x) { return x * 22; }
+inline int f9511_23(int x) { return x * 23; }
+inline int f9511_24(int x) { return x * 24; }
+inline int f9511_25(int x) { return x * 25; }
+inline int f9511_26(int x) { return x * 26; }
+inline int f9511_27(int x) { return x * 27; }
+inline int f9511_28(int x) { return x * 28; }
+inline int f9511_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9522 */
+#include <vector>
+#include "h6194.h"
+#include "h8742.h"
+#include "h5389.h"
+#include "h1927.h"
+#include "h9705.h"
+#ifdef X
+#include "h3715.h"
+#endif
+struct S9522 { int a; const char *s = "x//y"; };
+inline int f9522_0(int x) { return x * 0; }
+inline int f9522_1(int x) { return x * 1; }
+inline int f9522_2(int x) { return x * 2; }
+inline int f9522_3(int x) { return x * 3; }
+inline int f9522_4(int x) { return x * 4; }
+inline int f9522_5(int x) { return x * 5; }
+inline int f9522_6(int x) { return x * 6; }
+inline int f9522_7(int x) { return x * 7; }
+inline int f9522_8(int x) { return x * 8; }
+inline int f9522_9(int x) { return x * 9; }
+inline int f9522_10(int x) { return x * 10; }
+inline int f9522_11(int x) { return x * 11; }
+inline int f9522_12(int x) { return x * 12; }
+inline int f9522_13(int x) { return x * 13; }
+inline int f9522_14(int x) { return x * 14; }
+inline int f9522_15(int x) { return x * 15; }
+inline int f9522_16(int x) { return x * 16; }
+inline int f9522_17(int x) { return x * 17; }
+inline int f9522_18(int x) { return x * 18; }
+inline int f9522_19(int x) { return x * 19; }
+inline int f9522_20(int x) { return x * 20; }
+inline int f9522_21(int x) { return x * 21; }
+inline int f9522_22(int x) { return x * 22; }
+inline int f9522_23(int x) { return x * 23; }
+inline int f9522_24(int x) { return x * 24; }
+inline int f9522_25(int x) { return x * 25; }
+inline int f9522_26(int x) { return x * 26; }
+inline int f9522_27(int x) { return x * 27; }
+inline int f9522_28(int x) { return x * 28; }
+inline int f9522_29(int x) { return x * 29; }
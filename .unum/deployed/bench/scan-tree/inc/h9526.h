@@ -0,0 +1,42 @@
+#pragma once
+/* header 9526 */
+#include <vector>
+#include "h6822.h"
+#include "h2515.h"
+#include "h4247.h"
+#include "h3334.h"
+#include "h7145.h"
+#ifdef X
+#include "h199.h"
+#endif
+struct S9526 { int a; const char *s = "x//y"; };
+inline int f9526_0(int x) { return x * 0; }
+inline int f9526_1(int x) { return x * 1; }
+inline int f9526_2(int x) { return x * 2; }
+inline int f9526_3(int x) { return x * 3; }
+inline int f9526_4(int x) { return x * 4; }
+inline int f9526_5(int x) { return x * 5; }
+inline int f9526_6(int x) { return x * 6; }
+inline int f9526_7(int x) { return x * 7; }
+inline int f9526_8(int x) { return x * 8; }
+inline int f9526_9(int x) { return x * 9; }
+inline int f9526_10(int x) { return x * 10; }
+inline int f9526_11(int x) { return x * 11; }
+inline int f9526_12(int x) { return x * 12; }
+inline int f9526_13(int x) { return x * 13; }
+inline int f9526_14(int x) { return x * 14; }
+inline int f9526_15(int x) { return x * 15; }
+inline int f9526_16(int x) { return x * 16; }
+inline int f9526_17(int x) { return x * 17; }
+inline int f9526_18(int x) { return x * 18; }
+inline int f9526_19(int x) { return x * 19; }
+inline int f9526_20(int x) { return x * 20; }
+inline int f9526_21(int x) { return x * 21; }
+inline int f9526_22(int x) { return x * 22; }
+inline int f9526_23(int x) { return x * 23; }
+inline int f9526_24(int x) { return x * 24; }
+inline int f9526_25(int x) { return x * 25; }
+inline int f9526_26(int x) { return x * 26; }
+inline int f9526_27(int x) { return x * 27; }
+inline int f9526_28(int x) { return x * 28; }
+inline int f9526_29(int x) { return x * 29; }
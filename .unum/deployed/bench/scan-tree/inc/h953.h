@@ -0,0 +1,42 @@
+#pragma once
+/* header 953 */
+#include <vector>
+#include "h8612.h"
+#include "h3414.h"
+#include "h1908.h"
+#include "h294.h"
+#include "h4378.h"
+#ifdef X
+#include "h5581.h"
+#endif
+struct S953 { int a; const char *s = "x//y"; };
+inline int f953_0(int x) { return x * 0; }
+inline int f953_1(int x) { return x * 1; }
+inline int f953_2(int x) { return x * 2; }
+inline int f953_3(int x) { return x * 3; }
+inline int f953_4(int x) { return x * 4; }
+inline int f953_5(int x) { return x * 5; }
+inline int f953_6(int x) { return x * 6; }
+inline int f953_7(int x) { return x * 7; }
+inline int f953_8(int x) { return x * 8; }
+inline int f953_9(int x) { return x * 9; }
+inline int f953_10(int x) { return x * 10; }
+inline int f953_11(int x) { return x * 11; }
+inline int f953_12(int x) { return x * 12; }
+inline int f953_13(int x) { return x * 13; }
+inline int f953_14(int x) { return x * 14; }
+inline int f953_15(int x) { return x * 15; }
+inline int f953_16(int x) { return x * 16; }
+inline int f953_17(int x) { return x * 17; }
+inline int f953_18(int x) { return x * 18; }
+inline int f953_19(int x) { return x * 19; }
+inline int f953_20(int x) { return x * 20; }
+inline int f953_21(int x) { return x * 21; }
+inline int f953_22(int x) { return x * 22; }
+inline int f953_23(int x) { return x * 23; }
+inline int f953_24(int x) { return x * 24; }
+inline int f953_25(int x) { return x * 25; }
+inline int f953_26(int x) { return x * 26; }
+inline int f953_27(int x) { return x * 27; }
+inline int f953_28(int x) { return x * 28; }
+inline int f953_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9532 */
+#include <vector>
+#include "h1131.h"
+#include "h8625.h"
+#include "h2735.h"
+#include "h3667.h"
+#include "h4766.h"
+#ifdef X
+#include "h7366.h"
+#endif
+struct S9532 { int a; const char *s = "x//y"; };
+inline int f9532_0(int x) { return x * 0; }
+inline int f9532_1(int x) { return x * 1; }
+inline int f9532_2(int x) { return x * 2; }
+inline int f9532_3(int x) { return x * 3; }
+inline int f9532_4(int x) { return x * 4; }
+inline int f9532_5(int x) { return x * 5; }
+inline int f9532_6(int x) { return x * 6; }
+inline int f9532_7(int x) { return x * 7; }
+inline int f9532_8(int x) { return x * 8; }
+inline int f9532_9(int x) { return x * 9; }
+inline int f9532_10(int x) { return x * 10; }
+inline int f9532_11(int x) { return x * 11; }
+inline int f9532_12(int x) { return x * 12; }
+inline int f9532_13(int x) { return x * 13; }
+inline int f9532_14(int x) { return x * 14; }
+inline int f9532_15(int x) { return x * 15; }
+inline int f9532_16(int x) { return x * 16; }
+inline int f9532_17(int x) { return x * 17; }
+inline int f9532_18(int x) { return x * 18; }
+inline int f9532_19(int x) { return x * 19; }
+inline int f9532_20(int x) { return x * 20; }
+inline int f9532_21(int x) { return x * 21; }
+inline int f9532_22(int x) { return x * 22; }
+inline int f9532_23(int x) { return x * 23; }
+inline int f9532_24(int x) { return x * 24; }
+inline int f9532_25(int x) { return x * 25; }
+inline int f9532_26(int x) { return x * 26; }
+inline int f9532_27(int x) { return x * 27; }
+inline int f9532_28(int x) { return x * 28; }
+inline int f9532_29(int x) { return x * 29; }
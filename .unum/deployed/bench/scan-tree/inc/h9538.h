@@ -0,0 +1,42 @@
+#pragma once
+/* header 9538 */
+#include <vector>
+#include "h8947.h"
+#include "h6313.h"
+#include "h3760.h"
+#include "h9516.h"
+#include "h9931.h"
+#ifdef X
+#include "h6131.h"
+#endif
+struct S9538 { int a; const char *s = "x//y"; };
+inline int f9538_0(int x) { return x * 0; }
+inline int f9538_1(int x) { return x * 1; }
+inline int f9538_2(int x) { return x * 2; }
+inline int f9538_3(int x) { return x * 3; }
+inline int f9538_4(int x) { return x * 4; }
+inline int f9538_5(int x) { return x * 5; }
+inline int f9538_6(int x) { return x * 6; }
+inline int f9538_7(int x) { return x * 7; }
+inline int f9538_8(int x) { return x * 8; }
+inline int f9538_9(int x) { return x * 9; }
+inline int f9538_10(int x) { return x * 10; }
+inline int f9538_11(int x) { return x * 11; }
+inline int f9538_12(int x) { return x * 12; }
+inline int f9538_13(int x) { return x * 13; }
+inline int f9538_14(int x) { return x * 14; }
+inline int f9538_15(int x) { return x * 15; }
+inline int f9538_16(int x) { return x * 16; }
+inline int f9538_17(int x) { return x * 17; }
+inline int f9538_18(int x) { return x * 18; }
+inline int f9538_19(int x) { return x * 19; }
+inline int f9538_20(int x) { return x * 20; }
+inline int f9538_21(int x) { return x * 21; }
+inline int f9538_22(int x) { return x * 22; }
+inline int f9538_23(int x) { return x * 23; }
+inline int f9538_24(int x) { return x * 24; }
+inline int f9538_25(int x) { return x * 25; }
+inline int f9538_26(int x) { return x * 26; }
+inline int f9538_27(int x) { return x * 27; }
+inline int f9538_28(int x) { return x * 28; }
+inline int f9538_29(int x) { return x * 29; }
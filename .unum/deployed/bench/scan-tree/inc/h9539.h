@@ -0,0 +1,42 @@
+#pragma once
+/* header 9539 */
+#include <vector>
+#include "h8652.h"
+#include "h9251.h"
+#include "h417.h"
+#include "h6410.h"
+#include "h5984.h"
+#ifdef X
+#include "h9777.h"
+#endif
+struct S9539 { int a; const char *s = "x//y"; };
+inline int f9539_0(int x) { return x * 0; }
+inline int f9539_1(int x) { return x * 1; }
+inline int f9539_2(int x) { return x * 2; }
+inline int f9539_3(int x) { return x * 3; }
+inline int f9539_4(int x) { return x * 4; }
+inline int f9539_5(int x) { return x * 5; }
+inline int f9539_6(int x) { return x * 6; }
+inline int f9539_7(int x) { return x * 7; }
+inline int f9539_8(int x) { return x * 8; }
+inline int f9539_9(int x) { return x * 9; }
+inline int f9539_10(int x) { return x * 10; }
+inline int f9539_11(int x) { return x * 11; }
+inline int f9539_12(int x) { return x * 12; }
+inline int f9539_13(int x) { return x * 13; }
+inline int f9539_14(int x) { return x * 14; }
+inline int f9539_15(int x) { return x * 15; }
+inline int f9539_16(int x) { return x * 16; }
+inline int f9539_17(int x) { return x * 17; }
+inline int f9539_18(int x) { return x * 18; }
+inline int f9539_19(int x) { return x * 19; }
+inline int f9539_20(int x) { return x * 20; }
+inline int f9539_21(int x) { return x * 21; }
+inline int f9539_22(int x) { return x * 22; }
+inline int f9539_23(int x) { return x * 23; }
+inline int f9539_24(int x) { return x * 24; }
+inline int f9539_25(int x) { return x * 25; }
+inline int f9539_26(int x) { return x * 26; }
+inline int f9539_27(int x) { return x * 27; }
+inline int f9539_28(int x) { return x * 28; }
+inline int f9539_29(int x) { return x * 29; }
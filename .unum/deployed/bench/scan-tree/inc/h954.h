@@ -0,0 +1,42 @@
+#pragma once
+/* header 954 */
+#include <vector>
+#include "h7548.h"
+#include "h1288.h"
+#include "h5379.h"
+#include "h1920.h"
+#include "h195.h"
+#ifdef X
+#include "h5361.h"
+#endif
+struct S954 { int a; const char *s = "x//y"; };
+inline int f954_0(int x) { return x * 0; }
+inline int f954_1(int x) { return x * 1; }
+inline int f954_2(int x) { return x * 2; }
+inline int f954_3(int x) { return x * 3; }
+inline int f954_4(int x) { return x * 4; }
+inline int f954_5(int x) { return x * 5; }
+inline int f954_6(int x) { return x * 6; }
+inline int f954_7(int x) { return x * 7; }
+inline int f954_8(int x) { return x * 8; }
+inline int f954_9(int x) { return x * 9; }
+inline int f954_10(int x) { return x * 10; }
+inline int f954_11(int x) { return x * 11; }
+inline int f954_12(int x) { return x * 12; }
+inline int f954_13(int x) { return x * 13; }
+inline int f954_14(int x) { return x * 14; }
+inline int f954_15(int x) { return x * 15; }
+inline int f954_16(int x) { return x * 16; }
+inline int f954_17(int x) { return x * 17; }
+inline int f954_18(int x) { return x * 18; }
+inline int f954_19(int x) { return x * 19; }
+inline int f954_20(int x) { return x * 20; }
+inline int f954_21(int x) { return x * 21; }
+inline int f954_22(int x) { return x * 22; }
+inline int f954_23(int x) { return x * 23; }
+inline int f954_24(int x) { return x * 24; }
+inline int f954_25(int x) { return x * 25; }
+inline int f954_26(int x) { return x * 26; }
+inline int f954_27(int x) { return x * 27; }
+inline int f954_28(int x) { return x * 28; }
+inline int f954_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9545 */
+#include <vector>
+#include "h1409.h"
+#include "h1048.h"
+#include "h4511.h"
+#include "h4208.h"
+#include "h3745.h"
+#ifdef X
+#include "h4595.h"
+#endif
+struct S9545 { int a; const char *s = "x//y"; };
+inline int f9545_0(int x) { return x * 0; }
+inline int f9545_1(int x) { return x * 1; }
+inline int f9545_2(int x) { return x * 2; }
+inline int f9545_3(int x) { return x * 3; }
+inline int f9545_4(int x) { return x * 4; }
+inline int f9545_5(int x) { return x * 5; }
+inline int f9545_6(int x) { return x * 6; }
+inline int f9545_7(int x) { return x * 7; }
+inline int f9545_8(int x) { return x * 8; }
+inline int f9545_9(int x) { return x * 9; }
+inline int f9545_10(int x) { return x * 10; }
+inline int f9545_11(int x) { return x * 11; }
+inline int f9545_12(int x) { return x * 12; }
+inline int f9545_13(int x) { return x * 13; }
+inline int f9545_14(int x) { return x * 14; }
+inline int f9545_15(int x) { return x * 15; }
+inline int f9545_16(int x) { return x * 16; }
+inline int f9545_17(int x) { return x * 17; }
+inline int f9545_18(int x) { return x * 18; }
+inline int f9545_19(int x) { return x * 19; }
+inline int f9545_20(int x) { return x * 20; }
+inline int f9545_21(int x) { return x * 21; }
+inline int f9545_22(int x) { return x * 22; }
+inline int f9545_23(int x) { return x * 23; }
+inline int f9545_24(int x) { return x * 24; }
+inline int f9545_25(int x) { return x * 25; }
+inline int f9545_26(int x) { return x * 26; }
+inline int f9545_27(int x) { return x * 27; }
+inline int f9545_28(int x) { return x * 28; }
+inline int f9545_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 955 */
+#include <vector>
+#include "h9713.h"
+#include "h21.h"
+#include "h7986.h"
+#include "h6400.h"
+#include "h8694.h"
+#ifdef X
+#include "h8511.h"
+#endif
+struct S955 { int a; const char *s = "x//y"; };
+inline int f955_0(int x) { return x * 0; }
+inline int f955_1(int x) { return x * 1; }
+inline int f955_2(int x) { return x * 2; }
+inline int f955_3(int x) { return x * 3; }
+inline int f955_4(int x) { return x * 4; }
+inline int f955_5(int x) { return x * 5; }
+inline int f955_6(int x) { return x * 6; }
+inline int f955_7(int x) { return x * 7; }
+inline int f955_8(int x) { return x * 8; }
+inline int f955_9(int x) { return x * 9; }
+inline int f955_10(int x) { return x * 10; }
+inline int f955_11(int x) { return x * 11; }
+inline int f955_12(int x) { return x * 12; }
+inline int f955_13(int x) { return x * 13; }
+inline int f955_14(int x) { return x * 14; }
+inline int f955_15(int x) { return x * 15; }
+inline int f955_16(int x) { return x * 16; }
+inline int f955_17(int x) { return x * 17; }
+inline int f955_18(int x) { return x * 18; }
+inline int f955_19(int x) { return x * 19; }
+inline int f955_20(int x) { return x * 20; }
+inline int f955_21(int x) { return x * 21; }
+inline int f955_22(int x) { return x * 22; }
+inline int f955_23(int x) { return x * 23; }
+inline int f955_24(int x) { return x * 24; }
+inline int f955_25(int x) { return x * 25; }
+inline int f955_26(int x) { return x * 26; }
+inline int f955_27(int x) { return x * 27; }
+inline int f955_28(int x) { return x * 28; }
+inline int f955_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9552 */
+#include <vector>
+#include "h3484.h"
+#include "h8412.h"
+#include "h1171.h"
+#include "h48.h"
+#include "h1058.h"
+#ifdef X
+#include "h3844.h"
+#endif
+struct S9552 { int a; const char *s = "x//y"; };
+inline int f9552_0(int x) { return x * 0; }
+inline int f9552_1(int x) { return x * 1; }
+inline int f9552_2(int x) { return x * 2; }
+inline int f9552_3(int x) { return x * 3; }
+inline int f9552_4(int x) { return x * 4; }
+inline int f9552_5(int x) { return x * 5; }
+inline int f9552_6(int x) { return x * 6; }
+inline int f9552_7(int x) { return x * 7; }
+inline int f9552_8(int x) { return x * 8; }
+inline int f9552_9(int x) { return x * 9; }
+inline int f9552_10(int x) { return x * 10; }
+inline int f9552_11(int x) { return x * 11; }
+inline int f9552_12(int x) { return x * 12; }
+inline int f9552_13(int x) { return x * 13; }
+inline int f9552_14(int x) { return x * 14; }
+inline int f9552_15(int x) { return x * 15; }
+inline int f9552_16(int x) { return x * 16; }
+inline int f9552_17(int x) { return x * 17; }
+inline int f9552_18(int x) { return x * 18; }
+inline int f9552_19(int x) { return x * 19; }
+inline int f9552_20(int x) { return x * 20; }
+inline int f9552_21(int x) { return x * 21; }
+inline int f9552_22(int x) { return x * 22; }
+inline int f9552_23(int x) { return x * 23; }
+inline int f9552_24(int x) { return x * 24; }
+inline int f9552_25(int x) { return x * 25; }
+inline int f9552_26(int x) { return x * 26; }
+inline int f9552_27(int x) { return x * 27; }
+inline int f9552_28(int x) { return x * 28; }
+inline int f9552_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9554 */
+#include <vector>
+#include "h1987.h"
+#include "h9142.h"
+#include "h7516.h"
+#include "h9142.h"
+#include "h7923.h"
+#ifdef X
+#include "h9093.h"
+#endif
+struct S9554 { int a; const char *s = "x//y"; };
+inline int f9554_0(int x) { return x * 0; }
+inline int f9554_1(int x) { return x * 1; }
+inline int f9554_2(int x) { return x * 2; }
+inline int f9554_3(int x) { return x * 3; }
+inline int f9554_4(int x) { return x * 4; }
+inline int f9554_5(int x) { return x * 5; }
+inline int f9554_6(int x) { return x * 6; }
+inline int f9554_7(int x) { return x * 7; }
+inline int f9554_8(int x) { return x * 8; }
+inline int f9554_9(int x) { return x * 9; }
+inline int f9554_10(int x) { return x * 10; }
+inline int f9554_11(int x) { return x * 11; }
+inline int f9554_12(int x) { return x * 12; }
+inline int f9554_13(int x) { return x * 13; }
+inline int f9554_14(int x) { return x * 14; }
+inline int f9554_15(int x) { return x * 15; }
+inline int f9554_16(int x) { return x * 16; }
+inline int f9554_17(int x) { return x * 17; }
+inline int f9554_18(int x) { return x * 18; }
+inline int f9554_19(int x) { return x * 19; }
+inline int f9554_20(int x) { return x * 20; }
+inline int f9554_21(int x) { return x * 21; }
+inline int f9554_22(int x) { return x * 22; }
+inline int f9554_23(int x) { return x * 23; }
+inline int f9554_24(int x) { return x * 24; }
+inline int f9554_25(int x) { return x * 25; }
+inline int f9554_26(int x) { return x * 26; }
+inline int f9554_27(int x) { return x * 27; }
+inline int f9554_28(int x) { return x * 28; }
+inline int f9554_29(int x) { return x * 29; }
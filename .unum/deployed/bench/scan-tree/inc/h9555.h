@@ -0,0 +1,42 @@
+#pragma once
+/* header 9555 */
+#include <vector>
+#include "h1500.h"
+#include "h9633.h"
+#include "h2029.h"
+#include "h2887.h"
+#include "h721.h"
+#ifdef X
+#include "h1162.h"
+#endif
+struct S9555 { int a; const char *s = "x//y"; };
+inline int f9555_0(int x) { return x * 0; }
+inline int f9555_1(int x) { return x * 1; }
+inline int f9555_2(int x) { return x * 2; }
+inline int f9555_3(int x) { return x * 3; }
+inline int f9555_4(int x) { return x * 4; }
+inline int f9555_5(int x) { return x * 5; }
+inline int f9555_6(int x) { return x * 6; }
+inline int f9555_7(int x) { return x * 7; }
+inline int f9555_8(int x) { return x * 8; }
+inline int f9555_9(int x) { return x * 9; }
+inline int f9555_10(int x) { return x * 10; }
+inline int f9555_11(int x) { return x * 11; }
+inline int f9555_12(int x) { return x * 12; }
+inline int f9555_13(int x) { return x * 13; }
+inline int f9555_14(int x) { return x * 14; }
+inline int f9555_15(int x) { return x * 15; }
+inline int f9555_16(int x) { return x * 16; }
+inline int f9555_17(int x) { return x * 17; }
+inline int f9555_18(int x) { return x * 18; }
+inline int f9555_19(int x) { return x * 19; }
+inline int f9555_20(int x) { return x * 20; }
+inline int f9555_21(int x) { return x * 21; }
+inline int f9555_22(int x) { return x * 22; }
+inline int f9555_23(int x) { return x * 23; }
+inline int f9555_24(int x) { return x * 24; }
+inline int f9555_25(int x) { return x * 25; }
+inline int f9555_26(int x) { return x * 26; }
+inline int f9555_27(int x) { return x * 27; }
+inline int f9555_28(int x) { return x * 28; }
+inline int f9555_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9556 */
+#include <vector>
+#include "h7463.h"
+#include "h2777.h"
+#include "h1370.h"
+#include "h9055.h"
+#include "h9152.h"
+#ifdef X
+#include "h3766.h"
+#endif
+struct S9556 { int a; const char *s = "x//y"; };
+inline int f9556_0(int x) { return x * 0; }
+inline int f9556_1(int x) { return x * 1; }
+inline int f9556_2(int x) { return x * 2; }
+inline int f9556_3(int x) { return x * 3; }
+inline int f9556_4(int x) { return x * 4; }
+inline int f9556_5(int x) { return x * 5; }
+inline int f9556_6(int x) { return x * 6; }
+inline int f9556_7(int x) { return x * 7; }
+inline int f9556_8(int x) { return x * 8; }
+inline int f9556_9(int x) { return x * 9; }
+inline int f9556_10(int x) { return x * 10; }
+inline int f9556_11(int x) { return x * 11; }
+inline int f9556_12(int x) { return x * 12; }
+inline int f9556_13(int x) { return x * 13; }
+inline int f9556_14(int x) { return x * 14; }
+inline int f9556_15(int x) { return x * 15; }
+inline int f9556_16(int x) { return x * 16; }
+inline int f9556_17(int x) { return x * 17; }
+inline int f9556_18(int x) { return x * 18; }
+inline int f9556_19(int x) { return x * 19; }
+inline int f9556_20(int x) { return x * 20; }
+inline int f9556_21(int x) { return x * 21; }
+inline int f9556_22(int x) { return x * 22; }
+inline int f9556_23(int x) { return x * 23; }
+inline int f9556_24(int x) { return x * 24; }
+inline int f9556_25(int x) { return x * 25; }
+inline int f9556_26(int x) { return x * 26; }
+inline int f9556_27(int x) { return x * 27; }
+inline int f9556_28(int x) { return x * 28; }
+inline int f9556_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9560 */
+#include <vector>
+#include "h1633.h"
+#include "h2371.h"
+#include "h3622.h"
+#include "h1982.h"
+#include "h4527.h"
+#ifdef X
+#include "h3697.h"
+#endif
+struct S9560 { int a; const char *s = "x//y"; };
+inline int f9560_0(int x) { return x * 0; }
+inline int f9560_1(int x) { return x * 1; }
+inline int f9560_2(int x) { return x * 2; }
+inline int f9560_3(int x) { return x * 3; }
+inline int f9560_4(int x) { return x * 4; }
+inline int f9560_5(int x) { return x * 5; }
+inline int f9560_6(int x) { return x * 6; }
+inline int f9560_7(int x) { return x * 7; }
+inline int f9560_8(int x) { return x * 8; }
+inline int f9560_9(int x) { return x * 9; }
+inline int f9560_10(int x) { return x * 10; }
+inline int f9560_11(int x) { return x * 11; }
+inline int f9560_12(int x) { return x * 12; }
+inline int f9560_13(int x) { return x * 13; }
+inline int f9560_14(int x) { return x * 14; }
+inline int f9560_15(int x) { return x * 15; }
+inline int f9560_16(int x) { return x * 16; }
+inline int f9560_17(int x) { return x * 17; }
+inline int f9560_18(int x) { return x * 18; }
+inline int f9560_19(int x) { return x * 19; }
+inline int f9560_20(int x) { return x * 20; }
+inline int f9560_21(int x) { return x * 21; }
+inline int f9560_22(int x) { return x * 22; }
+inline int f9560_23(int x) { return x * 23; }
+inline int f9560_24(int x) { return x * 24; }
+inline int f9560_25(int x) { return x * 25; }
+inline int f9560_26(int x) { return x * 26; }
+inline int f9560_27(int x) { return x * 27; }
+inline int f9560_28(int x) { return x * 28; }
+inline int f9560_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9561 */
+#include <vector>
+#include "h8736.h"
+#include "h5907.h"
+#include "h7148.h"
+#include "h7770.h"
+#include "h6530.h"
+#ifdef X
+#include "h322.h"
+#endif
+struct S9561 { int a; const char *s = "x//y"; };
+inline int f9561_0(int x) { return x * 0; }
+inline int f9561_1(int x) { return x * 1; }
+inline int f9561_2(int x) { return x * 2; }
+inline int f9561_3(int x) { return x * 3; }
+inline int f9561_4(int x) { return x * 4; }
+inline int f9561_5(int x) { return x * 5; }
+inline int f9561_6(int x) { return x * 6; }
+inline int f9561_7(int x) { return x * 7; }
+inline int f9561_8(int x) { return x * 8; }
+inline int f9561_9(int x) { return x * 9; }
+inline int f9561_10(int x) { return x * 10; }
+inline int f9561_11(int x) { return x * 11; }
+inline int f9561_12(int x) { return x * 12; }
+inline int f9561_13(int x) { return x * 13; }
+inline int f9561_14(int x) { return x * 14; }
+inline int f9561_15(int x) { return x * 15; }
+inline int f9561_16(int x) { return x * 16; }
+inline int f9561_17(int x) { return x * 17; }
+inline int f9561_18(int x) { return x * 18; }
+inline int f9561_19(int x) { return x * 19; }
+inline int f9561_20(int x) { return x * 20; }
+inline int f9561_21(int x) { return x * 21; }
+inline int f9561_22(int x) { return x * 22; }
+inline int f9561_23(int x) { return x * 23; }
+inline int f9561_24(int x) { return x * 24; }
+inline int f9561_25(int x) { return x * 25; }
+inline int f9561_26(int x) { return x * 26; }
+inline int f9561_27(int x) { return x * 27; }
+inline int f9561_28(int x) { return x * 28; }
+inline int f9561_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9564 */
+#include <vector>
+#include "h7990.h"
+#include "h6190.h"
+#include "h6866.h"
+#include "h1151.h"
+#include "h2052.h"
+#ifdef X
+#include "h623.h"
+#endif
+struct S9564 { int a; const char *s = "x//y"; };
+inline int f9564_0(int x) { return x * 0; }
+inline int f9564_1(int x) { return x * 1; }
+inline int f9564_2(int x) { return x * 2; }
+inline int f9564_3(int x) { return x * 3; }
+inline int f9564_4(int x) { return x * 4; }
+inline int f9564_5(int x) { return x * 5; }
+inline int f9564_6(int x) { return x * 6; }
+inline int f9564_7(int x) { return x * 7; }
+inline int f9564_8(int x) { return x * 8; }
+inline int f9564_9(int x) { return x * 9; }
+inline int f9564_10(int x) { return x * 10; }
+inline int f9564_11(int x) { return x * 11; }
+inline int f9564_12(int x) { return x * 12; }
+inline int f9564_13(int x) { return x * 13; }
+inline int f9564_14(int x) { return x * 14; }
+inline int f9564_15(int x) { return x * 15; }
+inline int f9564_16(int x) { return x * 16; }
+inline int f9564_17(int x) { return x * 17; }
+inline int f9564_18(int x) { return x * 18; }
+inline int f9564_19(int x) { return x * 19; }
+inline int f9564_20(int x) { return x * 20; }
+inline int f9564_21(int x) { return x * 21; }
+inline int f9564_22(int x) { return x * 22; }
+inline int f9564_23(int x) { return x * 23; }
+inline int f9564_24(int x) { return x * 24; }
+inline int f9564_25(int x) { return x * 25; }
+inline int f9564_26(int x) { return x * 26; }
+inline int f9564_27(int x) { return x * 27; }
+inline int f9564_28(int x) { return x * 28; }
+inline int f9564_29(int x) { return x * 29; }
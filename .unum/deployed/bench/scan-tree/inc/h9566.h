@@ -0,0 +1,42 @@
+#pragma once
+/* header 9566 */
+#include <vector>
+#include "h7074.h"
+#include "h1487.h"
+#include "h8184.h"
+#include "h2440.h"
+#include "h4446.h"
+#ifdef X
+#include "h9193.h"
+#endif
+struct S9566 { int a; const char *s = "x//y"; };
+inline int f9566_0(int x) { return x * 0; }
+inline int f9566_1(int x) { return x * 1; }
+inline int f9566_2(int x) { return x * 2; }
+inline int f9566_3(int x) { return x * 3; }
+inline int f9566_4(int x) { return x * 4; }
+inline int f9566_5(int x) { return x * 5; }
+inline int f9566_6(int x) { return x * 6; }
+inline int f9566_7(int x) { return x * 7; }
+inline int f9566_8(int x) { return x * 8; }
+inline int f9566_9(int x) { return x * 9; }
+inline int f9566_10(int x) { return x * 10; }
+inline int f9566_11(int x) { return x * 11; }
+inline int f9566_12(int x) { return x * 12; }
+inline int f9566_13(int x) { return x * 13; }
+inline int f9566_14(int x) { return x * 14; }
+inline int f9566_15(int x) { return x * 15; }
+inline int f9566_16(int x) { return x * 16; }
+inline int f9566_17(int x) { return x * 17; }
+inline int f9566_18(int x) { return x * 18; }
+inline int f9566_19(int x) { return x * 19; }
+inline int f9566_20(int x) { return x * 20; }
+inline int f9566_21(int x) { return x * 21; }
+inline int f9566_22(int x) { return x * 22; }
+inline int f9566_23(int x) { return x * 23; }
+inline int f9566_24(int x) { return x * 24; }
+inline int f9566_25(int x) { return x * 25; }
+inline int f9566_26(int x) { return x * 26; }
+inline int f9566_27(int x) { return x * 27; }
+inline int f9566_28(int x) { return x * 28; }
+inline int f9566_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9567 */
+#include <vector>
+#include "h5432.h"
+#include "h8570.h"
+#include "h5544.h"
+#include "h1830.h"
+#include "h2620.h"
+#ifdef X
+#include "h4708.h"
+#endif
+struct S9567 { int a; const char *s = "x//y"; };
+inline int f9567_0(int x) { return x * 0; }
+inline int f9567_1(int x) { return x * 1; }
+inline int f9567_2(int x) { return x * 2; }
+inline int f9567_3(int x) { return x * 3; }
+inline int f9567_4(int x) { return x * 4; }
+inline int f9567_5(int x) { return x * 5; }
+inline int f9567_6(int x) { return x * 6; }
+inline int f9567_7(int x) { return x * 7; }
+inline int f9567_8(int x) { return x * 8; }
+inline int f9567_9(int x) { return x * 9; }
+inline int f9567_10(int x) { return x * 10; }
+inline int f9567_11(int x) { return x * 11; }
+inline int f9567_12(int x) { return x * 12; }
+inline int f9567_13(int x) { return x * 13; }
+inline int f9567_14(int x) { return x * 14; }
+inline int f9567_15(int x) { return x * 15; }
+inline int f9567_16(int x) { return x * 16; }
+inline int f9567_17(int x) { return x * 17; }
+inline int f9567_18(int x) { return x * 18; }
+inline int f9567_19(int x) { return x * 19; }
+inline int f9567_20(int x) { return x * 20; }
+inline int f9567_21(int x) { return x * 21; }
+inline int f9567_22(int x) { return x * 22; }
+inline int f9567_23(int x) { return x * 23; }
+inline int f9567_24(int x) { return x * 24; }
+inline int f9567_25(int x) { return x * 25; }
+inline int f9567_26(int x) { return x * 26; }
+inline int f9567_27(int x) { return x * 27; }
+inline int f9567_28(int x) { return x * 28; }
+inline int f9567_29(int x) { return x * 29; }
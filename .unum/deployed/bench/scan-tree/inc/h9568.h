@@ -0,0 +1,42 @@
+#pragma once
+/* header 9568 */
+#include <vector>
+#include "h5139.h"
+#include "h6891.h"
+#include "h5867.h"
+#include "h5671.h"
+#include "h5246.h"
+#ifdef X
+#include "h81.h"
+#endif
+struct S9568 { int a; const char *s = "x//y"; };
+inline int f9568_0(int x) { return x * 0; }
+inline int f9568_1(int x) { return x * 1; }
+inline int f9568_2(int x) { return x * 2; }
+inline int f9568_3(int x) { return x * 3; }
+inline int f9568_4(int x) { return x * 4; }
+inline int f9568_5(int x) { return x * 5; }
+inline int f9568_6(int x) { return x * 6; }
+inline int f9568_7(int x) { return x * 7; }
+inline int f9568_8(int x) { return x * 8; }
+inline int f9568_9(int x) { return x * 9; }
+inline int f9568_10(int x) { return x * 10; }
+inline int f9568_11(int x) { return x * 11; }
+inline int f9568_12(int x) { return x * 12; }
+inline int f9568_13(int x) { return x * 13; }
+inline int f9568_14(int x) { return x * 14; }
+inline int f9568_15(int x) { return x * 15; }
+inline int f9568_16(int x) { return x * 16; }
+inline int f9568_17(int x) { return x * 17; }
+inline int f9568_18(int x) { return x * 18; }
+inline int f9568_19(int x) { return x * 19; }
+inline int f9568_20(int x) { return x * 20; }
+inline int f9568_21(int x) { return x * 21; }
+inline int f9568_22(int x) { return x * 22; }
+inline int f9568_23(int x) { return x * 23; }
+inline int f9568_24(int x) { return x * 24; }
+inline int f9568_25(int x) { return x * 25; }
+inline int f9568_26(int x) { return x * 26; }
+inline int f9568_27(int x) { return x * 27; }
+inline int f9568_28(int x) { return x * 28; }
+inline int f9568_29(int x) { return x * 29; }
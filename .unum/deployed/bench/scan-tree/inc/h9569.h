@@ -0,0 +1,42 @@
+#pragma once
+/* header 9569 */
+#include <vector>
+#include "h4724.h"
+#include "h4785.h"
+#include "h8988.h"
+#include "h2558.h"
+#include "h9038.h"
+#ifdef X
+#include "h8453.h"
+#endif
+struct S9569 { int a; const char *s = "x//y"; };
+inline int f9569_0(int x) { return x * 0; }
+inline int f9569_1(int x) { return x * 1; }
+inline int f9569_2(int x) { return x * 2; }
+inline int f9569_3(int x) { return x * 3; }
+inline int f9569_4(int x) { return x * 4; }
+inline int f9569_5(int x) { return x * 5; }
+inline int f9569_6(int x) { return x * 6; }
+inline int f9569_7(int x) { return x * 7; }
+inline int f9569_8(int x) { return x * 8; }
+inline int f9569_9(int x) { return x * 9; }
+inline int f9569_10(int x) { return x * 10; }
+inline int f9569_11(int x) { return x * 11; }
+inline int f9569_12(int x) { return x * 12; }
+inline int f9569_13(int x) { return x * 13; }
+inline int f9569_14(int x) { return x * 14; }
+inline int f9569_15(int x) { return x * 15; }
+inline int f9569_16(int x) { return x * 16; }
+inline int f9569_17(int x) { return x * 17; }
+inline int f9569_18(int x) { return x * 18; }
+inline int f9569_19(int x) { return x * 19; }
+inline int f9569_20(int x) { return x * 20; }
+inline int f9569_21(int x) { return x * 21; }
+inline int f9569_22(int x) { return x * 22; }
+inline int f9569_23(int x) { return x * 23; }
+inline int f9569_24(int x) { return x * 24; }
+inline int f9569_25(int x) { return x * 25; }
+inline int f9569_26(int x) { return x * 26; }
+inline int f9569_27(int x) { return x * 27; }
+inline int f9569_28(int x) { return x * 28; }
+inline int f9569_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9570 */
+#include <vector>
+#include "h5520.h"
+#include "h9137.h"
+#include "h8258.h"
+#include "h7860.h"
+#include "h4128.h"
+#ifdef X
+#include "h2525.h"
+#endif
+struct S9570 { int a; const char *s = "x//y"; };
+inline int f9570_0(int x) { return x * 0; }
+inline int f9570_1(int x) { return x * 1; }
+inline int f9570_2(int x) { return x * 2; }
+inline int f9570_3(int x) { return x * 3; }
+inline int f9570_4(int x) { return x * 4; }
+inline int f9570_5(int x) { return x * 5; }
+inline int f9570_6(int x) { return x * 6; }
+inline int f9570_7(int x) { return x * 7; }
+inline int f9570_8(int x) { return x * 8; }
+inline int f9570_9(int x) { return x * 9; }
+inline int f9570_10(int x) { return x * 10; }
+inline int f9570_11(int x) { return x * 11; }
+inline int f9570_12(int x) { return x * 12; }
+inline int f9570_13(int x) { return x * 13; }
+inline int f9570_14(int x) { return x * 14; }
+inline int f9570_15(int x) { return x * 15; }
+inline int f9570_16(int x) { return x * 16; }
+inline int f9570_17(int x) { return x * 17; }
+inline int f9570_18(int x) { return x * 18; }
+inline int f9570_19(int x) { return x * 19; }
+inline int f9570_20(int x) { return x * 20; }
+inline int f9570_21(int x) { return x * 21; }
+inline int f9570_22(int x) { return x * 22; }
+inline int f9570_23(int x) { return x * 23; }
+inline int f9570_24(int x) { return x * 24; }
+inline int f9570_25(int x) { return x * 25; }
+inline int f9570_26(int x) { return x * 26; }
+inline int f9570_27(int x) { return x * 27; }
+inline int f9570_28(int x) { return x * 28; }
+inline int f9570_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9574 */
+#include <vector>
+#include "h6761.h"
+#include "h8570.h"
+#include "h669.h"
+#include "h6462.h"
+#include "h342.h"
+#ifdef X
+#include "h2714.h"
+#endif
+struct S9574 { int a; const char *s = "x//y"; };
+inline int f9574_0(int x) { return x * 0; }
+inline int f9574_1(int x) { return x * 1; }
+inline int f9574_2(int x) { return x * 2; }
+inline int f9574_3(int x) { return x * 3; }
+inline int f9574_4(int x) { return x * 4; }
+inline int f9574_5(int x) { return x * 5; }
+inline int f9574_6(int x) { return x * 6; }
+inline int f9574_7(int x) { return x * 7; }
+inline int f9574_8(int x) { return x * 8; }
+inline int f9574_9(int x) { return x * 9; }
+inline int f9574_10(int x) { return x * 10; }
+inline int f9574_11(int x) { return x * 11; }
+inline int f9574_12(int x) { return x * 12; }
+inline int f9574_13(int x) { return x * 13; }
+inline int f9574_14(int x) { return x * 14; }
+inline int f9574_15(int x) { return x * 15; }
+inline int f9574_16(int x) { return x * 16; }
+inline int f9574_17(int x) { return x * 17; }
+inline int f9574_18(int x) { return x * 18; }
+inline int f9574_19(int x) { return x * 19; }
+inline int f9574_20(int x) { return x * 20; }
+inline int f9574_21(int x) { return x * 21; }
+inline int f9574_22(int x) { return x * 22; }
+inline int f9574_23(int x) { return x * 23; }
+inline int f9574_24(int x) { return x * 24; }
+inline int f9574_25(int x) { return x * 25; }
+inline int f9574_26(int x) { return x * 26; }
+inline int f9574_27(int x) { return x * 27; }
+inline int f9574_28(int x) { return x * 28; }
+inline int f9574_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9578 */
+#include <vector>
+#include "h2791.h"
+#include "h8880.h"
+#include "h2291.h"
+#include "h8430.h"
+#include "h1317.h"
+#ifdef X
+#include "h2353.h"
+#endif
+struct S9578 { int a; const char *s = "x//y"; };
+inline int f9578_0(int x) { return x * 0; }
+inline int f9578_1(int x) { return x * 1; }
+inline int f9578_2(int x) { return x * 2; }
+inline int f9578_3(int x) { return x * 3; }
+inline int f9578_4(int x) { return x * 4; }
+inline int f9578_5(int x) { return x * 5; }
+inline int f9578_6(int x) { return x * 6; }
+inline int f9578_7(int x) { return x * 7; }
+inline int f9578_8(int x) { return x * 8; }
+inline int f9578_9(int x) { return x * 9; }
+inline int f9578_10(int x) { return x * 10; }
+inline int f9578_11(int x) { return x * 11; }
+inline int f9578_12(int x) { return x * 12; }
+inline int f9578_13(int x) { return x * 13; }
+inline int f9578_14(int x) { return x * 14; }
+inline int f9578_15(int x) { return x * 15; }
+inline int f9578_16(int x) { return x * 16; }
+inline int f9578_17(int x) { return x * 17; }
+inline int f9578_18(int x) { return x * 18; }
+inline int f9578_19(int x) { return x * 19; }
+inline int f9578_20(int x) { return x * 20; }
+inline int f9578_21(int x) { return x * 21; }
+inline int f9578_22(int x) { return x * 22; }
+inline int f9578_23(int x) { return x * 23; }
+inline int f9578_24(int x) { return x * 24; }
+inline int f9578_25(int x) { return x * 25; }
+inline int f9578_26(int x) { return x * 26; }
+inline int f9578_27(int x) { return x * 27; }
+inline int f9578_28(int x) { return x * 28; }
+inline int f9578_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9579 */
+#include <vector>
+#include "h1981.h"
+#include "h4659.h"
+#include "h4847.h"
+#include "h9407.h"
+#include "h186.h"
+#ifdef X
+#include "h9052.h"
+#endif
+struct S9579 { int a; const char *s = "x//y"; };
+inline int f9579_0(int x) { return x * 0; }
+inline int f9579_1(int x) { return x * 1; }
+inline int f9579_2(int x) { return x * 2; }
+inline int f9579_3(int x) { return x * 3; }
+inline int f9579_4(int x) { return x * 4; }
+inline int f9579_5(int x) { return x * 5; }
+inline int f9579_6(int x) { return x * 6; }
+inline int f9579_7(int x) { return x * 7; }
+inline int f9579_8(int x) { return x * 8; }
+inline int f9579_9(int x) { return x * 9; }
+inline int f9579_10(int x) { return x * 10; }
+inline int f9579_11(int x) { return x * 11; }
+inline int f9579_12(int x) { return x * 12; }
+inline int f9579_13(int x) { return x * 13; }
+inline int f9579_14(int x) { return x * 14; }
+inline int f9579_15(int x) { return x * 15; }
+inline int f9579_16(int x) { return x * 16; }
+inline int f9579_17(int x) { return x * 17; }
+inline int f9579_18(int x) { return x * 18; }
+inline int f9579_19(int x) { return x * 19; }
+inline int f9579_20(int x) { return x * 20; }
+inline int f9579_21(int x) { return x * 21; }
+inline int f9579_22(int x) { return x * 22; }
+inline int f9579_23(int x) { return x * 23; }
+inline int f9579_24(int x) { return x * 24; }
+inline int f9579_25(int x) { return x * 25; }
+inline int f9579_26(int x) { return x * 26; }
+inline int f9579_27(int x) { return x * 27; }
+inline int f9579_28(int x) { return x * 28; }
+inline int f9579_29(int x) { return x * 29; }
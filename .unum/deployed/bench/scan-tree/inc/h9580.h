@@ -0,0 +1,42 @@
+#pragma once
+/* header 9580 */
+#include <vector>
+#include "h6908.h"
+#include "h7313.h"
+#include "h2346.h"
+#include "h6750.h"
+#include "h5764.h"
+#ifdef X
+#include "h6426.h"
+#endif
+struct S9580 { int a; const char *s = "x//y"; };
+inline int f9580_0(int x) { return x * 0; }
+inline int f9580_1(int x) { return x * 1; }
+inline int f9580_2(int x) { return x * 2; }
+inline int f9580_3(int x) { return x * 3; }
+inline int f9580_4(int x) { return x * 4; }
+inline int f9580_5(int x) { return x * 5; }
+inline int f9580_6(int x) { return x * 6; }
+inline int f9580_7(int x) { return x * 7; }
+inline int f9580_8(int x) { return x * 8; }
+inline int f9580_9(int x) { return x * 9; }
+inline int f9580_10(int x) { return x * 10; }
+inline int f9580_11(int x) { return x * 11; }
+inline int f9580_12(int x) { return x * 12; }
+inline int f9580_13(int x) { return x * 13; }
+inline int f9580_14(int x) { return x * 14; }
+inline int f9580_15(int x) { return x * 15; }
+inline int f9580_16(int x) { return x * 16; }
+inline int f9580_17(int x) { return x * 17; }
+inline int f9580_18(int x) { return x * 18; }
+inline int f9580_19(int x) { return x * 19; }
+inline int f9580_20(int x) { return x * 20; }
+inline int f9580_21(int x) { return x * 21; }
+inline int f9580_22(int x) { return x * 22; }
+inline int f9580_23(int x) { return x * 23; }
+inline int f9580_24(int x) { return x * 24; }
+inline int f9580_25(int x) { return x * 25; }
+inline int f9580_26(int x) { return x * 26; }
+inline int f9580_27(int x) { return x * 27; }
+inline int f9580_28(int x) { return x * 28; }
+inline int f9580_29(int x) { return x * 29; }
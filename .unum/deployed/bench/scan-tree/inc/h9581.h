@@ -0,0 +1,42 @@
+#pragma once
+/* header 9581 */
+#include <vector>
+#include "h779.h"
+#include "h824.h"
+#include "h9141.h"
+#include "h4427.h"
+#include "h3805.h"
+#ifdef X
+#include "h6994.h"
+#endif
+struct S9581 { int a; const char *s = "x//y"; };
+inline int f9581_0(int x) { return x * 0; }
+inline int f9581_1(int x) { return x * 1; }
+inline int f9581_2(int x) { return x * 2; }
+inline int f9581_3(int x) { return x * 3; }
+inline int f9581_4(int x) { return x * 4; }
+inline int f9581_5(int x) { return x * 5; }
+inline int f9581_6(int x) { return x * 6; }
+inline int f9581_7(int x) { return x * 7; }
+inline int f9581_8(int x) { return x * 8; }
+inline int f9581_9(int x) { return x * 9; }
+inline int f9581_10(int x) { return x * 10; }
+inline int f9581_11(int x) { return x * 11; }
+inline int f9581_12(int x) { return x * 12; }
+inline int f9581_13(int x) { return x * 13; }
+inline int f9581_14(int x) { return x * 14; }
+inline int f9581_15(int x) { return x * 15; }
+inline int f9581_16(int x) { return x * 16; }
+inline int f9581_17(int x) { return x * 17; }
+inline int f9581_18(int x) { return x * 18; }
+inline int f9581_19(int x) { return x * 19; }
+inline int f9581_20(int x) { return x * 20; }
+inline int f9581_21(int x) { return x * 21; }
+inline int f9581_22(int x) { return x * 22; }
+inline int f9581_23(int x) { return x * 23; }
+inline int f9581_24(int x) { return x * 24; }
+inline int f9581_25(int x) { return x * 25; }
+inline int f9581_26(int x) { return x * 26; }
+inline int f9581_27(int x) { return x * 27; }
+inline int f9581_28(int x) { return x * 28; }
+inline int f9581_29(int x) { return x * 29; }
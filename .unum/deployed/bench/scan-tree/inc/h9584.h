@@ -0,0 +1,42 @@
+#pragma once
+/* header 9584 */
+#include <vector>
+#include "h9132.h"
+#include "h4475.h"
+#include "h5901.h"
+#include "h8014.h"
+#include "h1840.h"
+#ifdef X
+#include "h9211.h"
+#endif
+struct S9584 { int a; const char *s = "x//y"; };
+inline int f9584_0(int x) { return x * 0; }
+inline int f9584_1(int x) { return x * 1; }
+inline int f9584_2(int x) { return x * 2; }
+inline int f9584_3(int x) { return x * 3; }
+inline int f9584_4(int x) { return x * 4; }
+inline int f9584_5(int x) { return x * 5; }
+inline int f9584_6(int x) { return x * 6; }
+inline int f9584_7(int x) { return x * 7; }
+inline int f9584_8(int x) { return x * 8; }
+inline int f9584_9(int x) { return x * 9; }
+inline int f9584_10(int x) { return x * 10; }
+inline int f9584_11(int x) { return x * 11; }
+inline int f9584_12(int x) { return x * 12; }
+inline int f9584_13(int x) { return x * 13; }
+inline int f9584_14(int x) { return x * 14; }
+inline int f9584_15(int x) { return x * 15; }
+inline int f9584_16(int x) { return x * 16; }
+inline int f9584_17(int x) { return x * 17; }
+inline int f9584_18(int x) { return x * 18; }
+inline int f9584_19(int x) { return x * 19; }
+inline int f9584_20(int x) { return x * 20; }
+inline int f9584_21(int x) { return x * 21; }
+inline int f9584_22(int x) { return x * 22; }
+inline int f9584_23(int x) { return x * 23; }
+inline int f9584_24(int x) { return x * 24; }
+inline int f9584_25(int x) { return x * 25; }
+inline int f9584_26(int x) { return x * 26; }
+inline int f9584_27(int x) { return x * 27; }
+inline int f9584_28(int x) { return x * 28; }
+inline int f9584_29(int x) { return x * 29; }
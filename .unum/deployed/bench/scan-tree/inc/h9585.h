@@ -0,0 +1,42 @@
+#pragma once
+/* header 9585 */
+#include <vector>
+#include "h9330.h"
+#include "h1733.h"
+#include "h611.h"
+#include "h3918.h"
+#include "h1892.h"
+#ifdef X
+#include "h3570.h"
+#endif
+struct S9585 { int a; const char *s = "x//y"; };
+inline int f9585_0(int x) { return x * 0; }
+inline int f9585_1(int x) { return x * 1; }
+inline int f9585_2(int x) { return x * 2; }
+inline int f9585_3(int x) { return x * 3; }
+inline int f9585_4(int x) { return x * 4; }
+inline int f9585_5(int x) { return x * 5; }
+inline int f9585_6(int x) { return x * 6; }
+inline int f9585_7(int x) { return x * 7; }
+inline int f9585_8(int x) { return x * 8; }
+inline int f9585_9(int x) { return x * 9; }
+inline int f9585_10(int x) { return x * 10; }
+inline int f9585_11(int x) { return x * 11; }
+inline int f9585_12(int x) { return x * 12; }
+inline int f9585_13(int x) { return x * 13; }
+inline int f9585_14(int x) { return x * 14; }
+inline int f9585_15(int x) { return x * 15; }
+inline int f9585_16(int x) { return x * 16; }
+inline int f9585_17(int x) { return x * 17; }
+inline int f9585_18(int x) { return x * 18; }
+inline int f9585_19(int x) { return x * 19; }
+inline int f9585_20(int x) { return x * 20; }
+inline int f9585_21(int x) { return x * 21; }
+inline int f9585_22(int x) { return x * 22; }
+inline int f9585_23(int x) { return x * 23; }
+inline int f9585_24(int x) { return x * 24; }
+inline int f9585_25(int x) { return x * 25; }
+inline int f9585_26(int x) { return x * 26; }
+inline int f9585_27(int x) { return x * 27; }
+inline int f9585_28(int x) { return x * 28; }
+inline int f9585_29(int x) { return x * 29; }
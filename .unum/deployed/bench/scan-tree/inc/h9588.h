@@ -0,0 +1,42 @@
+#pragma once
+/* header 9588 */
+#include <vector>
+#include "h6426.h"
+#include "h2850.h"
+#include "h2207.h"
+#include "h2462.h"
+#include "h1458.h"
+#ifdef X
+#include "h8031.h"
+#endif
+struct S9588 { int a; const char *s = "x//y"; };
+inline int f9588_0(int x) { return x * 0; }
+inline int f9588_1(int x) { return x * 1; }
+inline int f9588_2(int x) { return x * 2; }
+inline int f9588_3(int x) { return x * 3; }
+inline int f9588_4(int x) { return x * 4; }
+inline int f9588_5(int x) { return x * 5; }
+inline int f9588_6(int x) { return x * 6; }
+inline int f9588_7(int x) { return x * 7; }
+inline int f9588_8(int x) { return x * 8; }
+inline int f9588_9(int x) { return x * 9; }
+inline int f9588_10(int x) { return x * 10; }
+inline int f9588_11(int x) { return x * 11; }
+inline int f9588_12(int x) { return x * 12; }
+inline int f9588_13(int x) { return x * 13; }
+inline int f9588_14(int x) { return x * 14; }
+inline int f9588_15(int x) { return x * 15; }
+inline int f9588_16(int x) { return x * 16; }
+inline int f9588_17(int x) { return x * 17; }
+inline int f9588_18(int x) { return x * 18; }
+inline int f9588_19(int x) { return x * 19; }
+inline int f9588_20(int x) { return x * 20; }
+inline int f9588_21(int x) { return x * 21; }
+inline int f9588_22(int x) { return x * 22; }
+inline int f9588_23(int x) { return x * 23; }
+inline int f9588_24(int x) { return x * 24; }
+inline int f9588_25(int x) { return x * 25; }
+inline int f9588_26(int x) { return x * 26; }
+inline int f9588_27(int x) { return x * 27; }
+inline int f9588_28(int x) { return x * 28; }
+inline int f9588_29(int x) { return x * 29; }
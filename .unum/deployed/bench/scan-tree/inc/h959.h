@@ -0,0 +1,42 @@
+#pragma once
+/* header 959 */
+#include <vector>
+#include "h6873.h"
+#include "h4093.h"
+#include "h9615.h"
+#include "h2415.h"
+#include "h3471.h"
+#ifdef X
+#include "h2295.h"
+#endif
+struct S959 { int a; const char *s = "x//y"; };
+inline int f959_0(int x) { return x * 0; }
+inline int f959_1(int x) { return x * 1; }
+inline int f959_2(int x) { return x * 2; }
+inline int f959_3(int x) { return x * 3; }
+inline int f959_4(int x) { return x * 4; }
+inline int f959_5(int x) { return x * 5; }
+inline int f959_6(int x) { return x * 6; }
+inline int f959_7(int x) { return x * 7; }
+inline int f959_8(int x) { return x * 8; }
+inline int f959_9(int x) { return x * 9; }
+inline int f959_10(int x) { return x * 10; }
+inline int f959_11(int x) { return x * 11; }
+inline int f959_12(int x) { return x * 12; }
+inline int f959_13(int x) { return x * 13; }
+inline int f959_14(int x) { return x * 14; }
+inline int f959_15(int x) { return x * 15; }
+inline int f959_16(int x) { return x * 16; }
+inline int f959_17(int x) { return x * 17; }
+inline int f959_18(int x) { return x * 18; }
+inline int f959_19(int x) { return x * 19; }
+inline int f959_20(int x) { return x * 20; }
+inline int f959_21(int x) { return x * 21; }
+inline int f959_22(int x) { return x * 22; }
+inline int f959_23(int x) { return x * 23; }
+inline int f959_24(int x) { return x * 24; }
+inline int f959_25(int x) { return x * 25; }
+inline int f959_26(int x) { return x * 26; }
+inline int f959_27(int x) { return x * 27; }
+inline int f959_28(int x) { return x * 28; }
+inline int f959_29(int x) { return x * 29; }
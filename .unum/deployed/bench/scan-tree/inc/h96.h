@@ -0,0 +1,42 @@
+#pragma once
+/* header 96 */
+#include <vector>
+#include "h7316.h"
+#include "h2248.h"
+#include "h544.h"
+#include "h9701.h"
+#include "h1996.h"
+#ifdef X
+#include "h6894.h"
+#endif
+struct S96 { int a; const char *s = "x//y"; };
+inline int f96_0(int x) { return x * 0; }
+inline int f96_1(int x) { return x * 1; }
+inline int f96_2(int x) { return x * 2; }
+inline int f96_3(int x) { return x * 3; }
+inline int f96_4(int x) { return x * 4; }
+inline int f96_5(int x) { return x * 5; }
+inline int f96_6(int x) { return x * 6; }
+inline int f96_7(int x) { return x * 7; }
+inline int f96_8(int x) { return x * 8; }
+inline int f96_9(int x) { return x * 9; }
+inline int f96_10(int x) { return x * 10; }
+inline int f96_11(int x) { return x * 11; }
+inline int f96_12(int x) { return x * 12; }
+inline int f96_13(int x) { return x * 13; }
+inline int f96_14(int x) { return x * 14; }
+inline int f96_15(int x) { return x * 15; }
+inline int f96_16(int x) { return x * 16; }
+inline int f96_17(int x) { return x * 17; }
+inline int f96_18(int x) { return x * 18; }
+inline int f96_19(int x) { return x * 19; }
+inline int f96_20(int x) { return x * 20; }
+inline int f96_21(int x) { return x * 21; }
+inline int f96_22(int x) { return x * 22; }
+inline int f96_23(int x) { return x * 23; }
+inline int f96_24(int x) { return x * 24; }
+inline int f96_25(int x) { return x * 25; }
+inline int f96_26(int x) { return x * 26; }
+inline int f96_27(int x) { return x * 27; }
+inline int f96_28(int x) { return x * 28; }
+inline int f96_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9602 */
+#include <vector>
+#include "h9698.h"
+#include "h9291.h"
+#include "h5336.h"
+#include "h4916.h"
+#include "h4281.h"
+#ifdef X
+#include "h108.h"
+#endif
+struct S9602 { int a; const char *s = "x//y"; };
+inline int f9602_0(int x) { return x * 0; }
+inline int f9602_1(int x) { return x * 1; }
+inline int f9602_2(int x) { return x * 2; }
+inline int f9602_3(int x) { return x * 3; }
+inline int f9602_4(int x) { return x * 4; }
+inline int f9602_5(int x) { return x * 5; }
+inline int f9602_6(int x) { return x * 6; }
+inline int f9602_7(int x) { return x * 7; }
+inline int f9602_8(int x) { return x * 8; }
+inline int f9602_9(int x) { return x * 9; }
+inline int f9602_10(int x) { return x * 10; }
+inline int f9602_11(int x) { return x * 11; }
+inline int f9602_12(int x) { return x * 12; }
+inline int f9602_13(int x) { return x * 13; }
+inline int f9602_14(int x) { return x * 14; }
+inline int f9602_15(int x) { return x * 15; }
+inline int f9602_16(int x) { return x * 16; }
+inline int f9602_17(int x) { return x * 17; }
+inline int f9602_18(int x) { return x * 18; }
+inline int f9602_19(int x) { return x * 19; }
+inline int f9602_20(int x) { return x * 20; }
+inline int f9602_21(int x) { return x * 21; }
+inline int f9602_22(int x) { return x * 22; }
+inline int f9602_23(int x) { return x * 23; }
+inline int f9602_24(int x) { return x * 24; }
+inline int f9602_25(int x) { return x * 25; }
+inline int f9602_26(int x) { return x * 26; }
+inline int f9602_27(int x) { return x * 27; }
+inline int f9602_28(int x) { return x * 28; }
+inline int f9602_29(int x) { return x * 29; }
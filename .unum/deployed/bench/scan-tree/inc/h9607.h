@@ -0,0 +1,42 @@
+#pragma once
+/* header 9607 */
+#include <vector>
+#include "h2804.h"
+#include "h8617.h"
+#include "h9986.h"
+#include "h4237.h"
+#include "h8413.h"
+#ifdef X
+#include "h4625.h"
+#endif
+struct S9607 { int a; const char *s = "x//y"; };
+inline int f9607_0(int x) { return x * 0; }
+inline int f9607_1(int x) { return x * 1; }
+inline int f9607_2(int x) { return x * 2; }
+inline int f9607_3(int x) { return x * 3; }
+inline int f9607_4(int x) { return x * 4; }
+inline int f9607_5(int x) { return x * 5; }
+inline int f9607_6(int x) { return x * 6; }
+inline int f9607_7(int x) { return x * 7; }
+inline int f9607_8(int x) { return x * 8; }
+inline int f9607_9(int x) { return x * 9; }
+inline int f9607_10(int x) { return x * 10; }
+inline int f9607_11(int x) { return x * 11; }
+inline int f9607_12(int x) { return x * 12; }
+inline int f9607_13(int x) { return x * 13; }
+inline int f9607_14(int x) { return x * 14; }
+inline int f9607_15(int x) { return x * 15; }
+inline int f9607_16(int x) { return x * 16; }
+inline int f9607_17(int x) { return x * 17; }
+inline int f9607_18(int x) { return x * 18; }
+inline int f9607_19(int x) { return x * 19; }
+inline int f9607_20(int x) { return x * 20; }
+inline int f9607_21(int x) { return x * 21; }
+inline int f9607_22(int x) { return x * 22; }
+inline int f9607_23(int x) { return x * 23; }
+inline int f9607_24(int x) { return x * 24; }
+inline int f9607_25(int x) { return x * 25; }
+inline int f9607_26(int x) { return x * 26; }
+inline int f9607_27(int x) { return x * 27; }
+inline int f9607_28(int x) { return x * 28; }
+inline int f9607_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9610 */
+#include <vector>
+#include "h384.h"
+#include "h8350.h"
+#include "h2907.h"
+#include "h5235.h"
+#include "h9466.h"
+#ifdef X
+#include "h1155.h"
+#endif
+struct S9610 { int a; const char *s = "x//y"; };
+inline int f9610_0(int x) { return x * 0; }
+inline int f9610_1(int x) { return x * 1; }
+inline int f9610_2(int x) { return x * 2; }
+inline int f9610_3(int x) { return x * 3; }
+inline int f9610_4(int x) { return x * 4; }
+inline int f9610_5(int x) { return x * 5; }
+inline int f9610_6(int x) { return x * 6; }
+inline int f9610_7(int x) { return x * 7; }
+inline int f9610_8(int x) { return x * 8; }
+inline int f9610_9(int x) { return x * 9; }
+inline int f9610_10(int x) { return x * 10; }
+inline int f9610_11(int x) { return x * 11; }
+inline int f9610_12(int x) { return x * 12; }
+inline int f9610_13(int x) { return x * 13; }
+inline int f9610_14(int x) { return x * 14; }
+inline int f9610_15(int x) { return x * 15; }
+inline int f9610_16(int x) { return x * 16; }
+inline int f9610_17(int x) { return x * 17; }
+inline int f9610_18(int x) { return x * 18; }
+inline int f9610_19(int x) { return x * 19; }
+inline int f9610_20(int x) { return x * 20; }
+inline int f9610_21(int x) { return x * 21; }
+inline int f9610_22(int x) { return x * 22; }
+inline int f9610_23(int x) { return x * 23; }
+inline int f9610_24(int x) { return x * 24; }
+inline int f9610_25(int x) { return x * 25; }
+inline int f9610_26(int x) { return x * 26; }
+inline int f9610_27(int x) { return x * 27; }
+inline int f9610_28(int x) { return x * 28; }
+inline int f9610_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9611 */
+#include <vector>
+#include "h2468.h"
+#include "h7366.h"
+#include "h730.h"
+#include "h6497.h"
+#include "h4695.h"
+#ifdef X
+#include "h5182.h"
+#endif
+struct S9611 { int a; const char *s = "x//y"; };
+inline int f9611_0(int x) { return x * 0; }
+inline int f9611_1(int x) { return x * 1; }
+inline int f9611_2(int x) { return x * 2; }
+inline int f9611_3(int x) { return x * 3; }
+inline int f9611_4(int x) { return x * 4; }
+inline int f9611_5(int x) { return x * 5; }
+inline int f9611_6(int x) { return x * 6; }
+inline int f9611_7(int x) { return x * 7; }
+inline int f9611_8(int x) { return x * 8; }
+inline int f9611_9(int x) { return x * 9; }
+inline int f9611_10(int x) { return x * 10; }
+inline int f9611_11(int x) { return x * 11; }
+inline int f9611_12(int x) { return x * 12; }
+inline int f9611_13(int x) { return x * 13; }
+inline int f9611_14(int x) { return x * 14; }
+inline int f9611_15(int x) { return x * 15; }
+inline int f9611_16(int x) { return x * 16; }
+inline int f9611_17(int x) { return x * 17; }
+inline int f9611_18(int x) { return x * 18; }
+inline int f9611_19(int x) { return x * 19; }
+inline int f9611_20(int x) { return x * 20; }
+inline int f9611_21(int x) { return x * 21; }
+inline int f9611_22(int x) { return x * 22; }
+inline int f9611_23(int x) { return x * 23; }
+inline int f9611_24(int x) { return x * 24; }
+inline int f9611_25(int x) { return x * 25; }
+inline int f9611_26(int x) { return x * 26; }
+inline int f9611_27(int x) { return x * 27; }
+inline int f9611_28(int x) { return x * 28; }
+inline int f9611_29(int x) { return x * 29; }
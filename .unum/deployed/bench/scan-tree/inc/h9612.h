@@ -0,0 +1,42 @@
+#pragma once
+/* header 9612 */
+#include <vector>
+#include "h6959.h"
+#include "h4001.h"
+#include "h496.h"
+#include "h1248.h"
+#include "h5305.h"
+#ifdef X
+#include "h8475.h"
+#endif
+struct S9612 { int a; const char *s = "x//y"; };
+inline int f9612_0(int x) { return x * 0; }
+inline int f9612_1(int x) { return x * 1; }
+inline int f9612_2(int x) { return x * 2; }
+inline int f9612_3(int x) { return x * 3; }
+inline int f9612_4(int x) { return x * 4; }
+inline int f9612_5(int x) { return x * 5; }
+inline int f9612_6(int x) { return x * 6; }
+inline int f9612_7(int x) { return x * 7; }
+inline int f9612_8(int x) { return x * 8; }
+inline int f9612_9(int x) { return x * 9; }
+inline int f9612_10(int x) { return x * 10; }
+inline int f9612_11(int x) { return x * 11; }
+inline int f9612_12(int x) { return x * 12; }
+inline int f9612_13(int x) { return x * 13; }
+inline int f9612_14(int x) { return x * 14; }
+inline int f9612_15(int x) { return x * 15; }
+inline int f9612_16(int x) { return x * 16; }
+inline int f9612_17(int x) { return x * 17; }
+inline int f9612_18(int x) { return x * 18; }
+inline int f9612_19(int x) { return x * 19; }
+inline int f9612_20(int x) { return x * 20; }
+inline int f9612_21(int x) { return x * 21; }
+inline int f9612_22(int x) { return x * 22; }
+inline int f9612_23(int x) { return x * 23; }
+inline int f9612_24(int x) { return x * 24; }
+inline int f9612_25(int x) { return x * 25; }
+inline int f9612_26(int x) { return x * 26; }
+inline int f9612_27(int x) { return x * 27; }
+inline int f9612_28(int x) { return x * 28; }
+inline int f9612_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9613 */
+#include <vector>
+#include "h9451.h"
+#include "h9063.h"
+#include "h5863.h"
+#include "h3753.h"
+#include "h3302.h"
+#ifdef X
+#include "h4457.h"
+#endif
+struct S9613 { int a; const char *s = "x//y"; };
+inline int f9613_0(int x) { return x * 0; }
+inline int f9613_1(int x) { return x * 1; }
+inline int f9613_2(int x) { return x * 2; }
+inline int f9613_3(int x) { return x * 3; }
+inline int f9613_4(int x) { return x * 4; }
+inline int f9613_5(int x) { return x * 5; }
+inline int f9613_6(int x) { return x * 6; }
+inline int f9613_7(int x) { return x * 7; }
+inline int f9613_8(int x) { return x * 8; }
+inline int f9613_9(int x) { return x * 9; }
+inline int f9613_10(int x) { return x * 10; }
+inline int f9613_11(int x) { return x * 11; }
+inline int f9613_12(int x) { return x * 12; }
+inline int f9613_13(int x) { return x * 13; }
+inline int f9613_14(int x) { return x * 14; }
+inline int f9613_15(int x) { return x * 15; }
+inline int f9613_16(int x) { return x * 16; }
+inline int f9613_17(int x) { return x * 17; }
+inline int f9613_18(int x) { return x * 18; }
+inline int f9613_19(int x) { return x * 19; }
+inline int f9613_20(int x) { return x * 20; }
+inline int f9613_21(int x) { return x * 21; }
+inline int f9613_22(int x) { return x * 22; }
+inline int f9613_23(int x) { return x * 23; }
+inline int f9613_24(int x) { return x * 24; }
+inline int f9613_25(int x) { return x * 25; }
+inline int f9613_26(int x) { return x * 26; }
+inline int f9613_27(int x) { return x * 27; }
+inline int f9613_28(int x) { return x * 28; }
+inline int f9613_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9614 */
+#include <vector>
+#include "h1916.h"
+#include "h2666.h"
+#include "h5815.h"
+#include "h7814.h"
+#include "h8858.h"
+#ifdef X
+#include "h7812.h"
+#endif
+struct S9614 { int a; const char *s = "x//y"; };
+inline int f9614_0(int x) { return x * 0; }
+inline int f9614_1(int x) { return x * 1; }
+inline int f9614_2(int x) { return x * 2; }
+inline int f9614_3(int x) { return x * 3; }
+inline int f9614_4(int x) { return x * 4; }
+inline int f9614_5(int x) { return x * 5; }
+inline int f9614_6(int x) { return x * 6; }
+inline int f9614_7(int x) { return x * 7; }
+inline int f9614_8(int x) { return x * 8; }
+inline int f9614_9(int x) { return x * 9; }
+inline int f9614_10(int x) { return x * 10; }
+inline int f9614_11(int x) { return x * 11; }
+inline int f9614_12(int x) { return x * 12; }
+inline int f9614_13(int x) { return x * 13; }
+inline int f9614_14(int x) { return x * 14; }
+inline int f9614_15(int x) { return x * 15; }
+inline int f9614_16(int x) { return x * 16; }
+inline int f9614_17(int x) { return x * 17; }
+inline int f9614_18(int x) { return x * 18; }
+inline int f9614_19(int x) { return x * 19; }
+inline int f9614_20(int x) { return x * 20; }
+inline int f9614_21(int x) { return x * 21; }
+inline int f9614_22(int x) { return x * 22; }
+inline int f9614_23(int x) { return x * 23; }
+inline int f9614_24(int x) { return x * 24; }
+inline int f9614_25(int x) { return x * 25; }
+inline int f9614_26(int x) { return x * 26; }
+inline int f9614_27(int x) { return x * 27; }
+inline int f9614_28(int x) { return x * 28; }
+inline int f9614_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9615 */
+#include <vector>
+#include "h4548.h"
+#include "h324.h"
+#include "h7975.h"
+#include "h5353.h"
+#include "h8619.h"
+#ifdef X
+#include "h3842.h"
+#endif
+struct S9615 { int a; const char *s = "x//y"; };
+inline int f9615_0(int x) { return x * 0; }
+inline int f9615_1(int x) { return x * 1; }
+inline int f9615_2(int x) { return x * 2; }
+inline int f9615_3(int x) { return x * 3; }
+inline int f9615_4(int x) { return x * 4; }
+inline int f9615_5(int x) { return x * 5; }
+inline int f9615_6(int x) { return x * 6; }
+inline int f9615_7(int x) { return x * 7; }
+inline int f9615_8(int x) { return x * 8; }
+inline int f9615_9(int x) { return x * 9; }
+inline int f9615_10(int x) { return x * 10; }
+inline int f9615_11(int x) { return x * 11; }
+inline int f9615_12(int x) { return x * 12; }
+inline int f9615_13(int x) { return x * 13; }
+inline int f9615_14(int x) { return x * 14; }
+inline int f9615_15(int x) { return x * 15; }
+inline int f9615_16(int x) { return x * 16; }
+inline int f9615_17(int x) { return x * 17; }
+inline int f9615_18(int x) { return x * 18; }
+inline int f9615_19(int x) { return x * 19; }
+inline int f9615_20(int x) { return x * 20; }
+inline int f9615_21(int x) { return x * 21; }
+inline int f9615_22(int x) { return x * 22; }
+inline int f9615_23(int x) { return x * 23; }
+inline int f9615_24(int x) { return x * 24; }
+inline int f9615_25(int x) { return x * 25; }
+inline int f9615_26(int x) { return x * 26; }
+inline int f9615_27(int x) { return x * 27; }
+inline int f9615_28(int x) { return x * 28; }
+inline int f9615_29(int x) { return x * 29; }
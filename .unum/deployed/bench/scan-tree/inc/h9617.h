@@ -0,0 +1,42 @@
+#pragma once
+/* header 9617 */
+#include <vector>
+#include "h5942.h"
+#include "h9143.h"
+#include "h1550.h"
+#include "h1180.h"
+#include "h1849.h"
+#ifdef X
+#include "h8196.h"
+#endif
+struct S9617 { int a; const char *s = "x//y"; };
+inline int f9617_0(int x) { return x * 0; }
+inline int f9617_1(int x) { return x * 1; }
+inline int f9617_2(int x) { return x * 2; }
+inline int f9617_3(int x) { return x * 3; }
+inline int f9617_4(int x) { return x * 4; }
+inline int f9617_5(int x) { return x * 5; }
+inline int f9617_6(int x) { return x * 6; }
+inline int f9617_7(int x) { return x * 7; }
+inline int f9617_8(int x) { return x * 8; }
+inline int f9617_9(int x) { return x * 9; }
+inline int f9617_10(int x) { return x * 10; }
+inline int f9617_11(int x) { return x * 11; }
+inline int f9617_12(int x) { return x * 12; }
+inline int f9617_13(int x) { return x * 13; }
+inline int f9617_14(int x) { return x * 14; }
+inline int f9617_15(int x) { return x * 15; }
+inline int f9617_16(int x) { return x * 16; }
+inline int f9617_17(int x) { return x * 17; }
+inline int f9617_18(int x) { return x * 18; }
+inline int f9617_19(int x) { return x * 19; }
+inline int f9617_20(int x) { return x * 20; }
+inline int f9617_21(int x) { return x * 21; }
+inline int f9617_22(int x) { return x * 22; }
+inline int f9617_23(int x) { return x * 23; }
+inline int f9617_24(int x) { return x * 24; }
+inline int f9617_25(int x) { return x * 25; }
+inline int f9617_26(int x) { return x * 26; }
+inline int f9617_27(int x) { return x * 27; }
+inline int f9617_28(int x) { return x * 28; }
+inline int f9617_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9619 */
+#include <vector>
+#include "h360.h"
+#include "h691.h"
+#include "h1196.h"
+#include "h8930.h"
+#include "h8202.h"
+#ifdef X
+#include "h3811.h"
+#endif
+struct S9619 { int a; const char *s = "x//y"; };
+inline int f9619_0(int x) { return x * 0; }
+inline int f9619_1(int x) { return x * 1; }
+inline int f9619_2(int x) { return x * 2; }
+inline int f9619_3(int x) { return x * 3; }
+inline int f9619_4(int x) { return x * 4; }
+inline int f9619_5(int x) { return x * 5; }
+inline int f9619_6(int x) { return x * 6; }
+inline int f9619_7(int x) { return x * 7; }
+inline int f9619_8(int x) { return x * 8; }
+inline int f9619_9(int x) { return x * 9; }
+inline int f9619_10(int x) { return x * 10; }
+inline int f9619_11(int x) { return x * 11; }
+inline int f9619_12(int x) { return x * 12; }
+inline int f9619_13(int x) { return x * 13; }
+inline int f9619_14(int x) { return x * 14; }
+inline int f9619_15(int x) { return x * 15; }
+inline int f9619_16(int x) { return x * 16; }
+inline int f9619_17(int x) { return x * 17; }
+inline int f9619_18(int x) { return x * 18; }
+inline int f9619_19(int x) { return x * 19; }
+inline int f9619_20(int x) { return x * 20; }
+inline int f9619_21(int x) { return x * 21; }
+inline int f9619_22(int x) { return x * 22; }
+inline int f9619_23(int x) { return x * 23; }
+inline int f9619_24(int x) { return x * 24; }
+inline int f9619_25(int x) { return x * 25; }
+inline int f9619_26(int x) { return x * 26; }
+inline int f9619_27(int x) { return x * 27; }
+inline int f9619_28(int x) { return x * 28; }
+inline int f9619_29(int x) { return x * 29; }
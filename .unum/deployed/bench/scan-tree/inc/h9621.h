@@ -0,0 +1,42 @@
+#pragma once
+/* header 9621 */
+#include <vector>
+#include "h4809.h"
+#include "h4242.h"
+#include "h9396.h"
+#include "h3719.h"
+#include "h3123.h"
+#ifdef X
+#include "h245.h"
+#endif
+struct S9621 { int a; const char *s = "x//y"; };
+inline int f9621_0(int x) { return x * 0; }
+inline int f9621_1(int x) { return x * 1; }
+inline int f9621_2(int x) { return x * 2; }
+inline int f9621_3(int x) { return x * 3; }
+inline int f9621_4(int x) { return x * 4; }
+inline int f9621_5(int x) { return x * 5; }
+inline int f9621_6(int x) { return x * 6; }
+inline int f9621_7(int x) { return x * 7; }
+inline int f9621_8(int x) { return x * 8; }
+inline int f9621_9(int x) { return x * 9; }
+inline int f9621_10(int x) { return x * 10; }
+inline int f9621_11(int x) { return x * 11; }
+inline int f9621_12(int x) { return x * 12; }
+inline int f9621_13(int x) { return x * 13; }
+inline int f9621_14(int x) { return x * 14; }
+inline int f9621_15(int x) { return x * 15; }
+inline int f9621_16(int x) { return x * 16; }
+inline int f9621_17(int x) { return x * 17; }
+inline int f9621_18(int x) { return x * 18; }
+inline int f9621_19(int x) { return x * 19; }
+inline int f9621_20(int x) { return x * 20; }
+inline int f9621_21(int x) { return x * 21; }
+inline int f9621_22(int x) { return x * 22; }
+inline int f9621_23(int x) { return x * 23; }
+inline int f9621_24(int x) { return x * 24; }
+inline int f9621_25(int x) { return x * 25; }
+inline int f9621_26(int x) { return x * 26; }
+inline int f9621_27(int x) { return x * 27; }
+inline int f9621_28(int x) { return x * 28; }
+inline int f9621_29(int x) { return x * 29; }
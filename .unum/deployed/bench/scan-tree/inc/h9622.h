@@ -0,0 +1,42 @@
+#pragma once
+/* header 9622 */
+#include <vector>
+#include "h9602.h"
+#include "h1557.h"
+#include "h4084.h"
+#include "h8468.h"
+#include "h3537.h"
+#ifdef X
+#include "h7017.h"
+#endif
+struct S9622 { int a; const char *s = "x//y"; };
+inline int f9622_0(int x) { return x * 0; }
+inline int f9622_1(int x) { return x * 1; }
+inline int f9622_2(int x) { return x * 2; }
+inline int f9622_3(int x) { return x * 3; }
+inline int f9622_4(int x) { return x * 4; }
+inline int f9622_5(int x) { return x * 5; }
+inline int f9622_6(int x) { return x * 6; }
+inline int f9622_7(int x) { return x * 7; }
+inline int f9622_8(int x) { return x * 8; }
+inline int f9622_9(int x) { return x * 9; }
+inline int f9622_10(int x) { return x * 10; }
+inline int f9622_11(int x) { return x * 11; }
+inline int f9622_12(int x) { return x * 12; }
+inline int f9622_13(int x) { return x * 13; }
+inline int f9622_14(int x) { return x * 14; }
+inline int f9622_15(int x) { return x * 15; }
+inline int f9622_16(int x) { return x * 16; }
+inline int f9622_17(int x) { return x * 17; }
+inline int f9622_18(int x) { return x * 18; }
+inline int f9622_19(int x) { return x * 19; }
+inline int f9622_20(int x) { return x * 20; }
+inline int f9622_21(int x) { return x * 21; }
+inline int f9622_22(int x) { return x * 22; }
+inline int f9622_23(int x) { return x * 23; }
+inline int f9622_24(int x) { return x * 24; }
+inline int f9622_25(int x) { return x * 25; }
+inline int f9622_26(int x) { return x * 26; }
+inline int f9622_27(int x) { return x * 27; }
+inline int f9622_28(int x) { return x * 28; }
+inline int f9622_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9623 */
+#include <vector>
+#include "h4232.h"
+#include "h9253.h"
+#include "h7123.h"
+#include "h6977.h"
+#include "h2750.h"
+#ifdef X
+#include "h4631.h"
+#endif
+struct S9623 { int a; const char *s = "x//y"; };
+inline int f9623_0(int x) { return x * 0; }
+inline int f9623_1(int x) { return x * 1; }
+inline int f9623_2(int x) { return x * 2; }
+inline int f9623_3(int x) { return x * 3; }
+inline int f9623_4(int x) { return x * 4; }
+inline int f9623_5(int x) { return x * 5; }
+inline int f9623_6(int x) { return x * 6; }
+inline int f9623_7(int x) { return x * 7; }
+inline int f9623_8(int x) { return x * 8; }
+inline int f9623_9(int x) { return x * 9; }
+inline int f9623_10(int x) { return x * 10; }
+inline int f9623_11(int x) { return x * 11; }
+inline int f9623_12(int x) { return x * 12; }
+inline int f9623_13(int x) { return x * 13; }
+inline int f9623_14(int x) { return x * 14; }
+inline int f9623_15(int x) { return x * 15; }
+inline int f9623_16(int x) { return x * 16; }
+inline int f9623_17(int x) { return x * 17; }
+inline int f9623_18(int x) { return x * 18; }
+inline int f9623_19(int x) { return x * 19; }
+inline int f9623_20(int x) { return x * 20; }
+inline int f9623_21(int x) { return x * 21; }
+inline int f9623_22(int x) { return x * 22; }
+inline int f9623_23(int x) { return x * 23; }
+inline int f9623_24(int x) { return x * 24; }
+inline int f9623_25(int x) { return x * 25; }
+inline int f9623_26(int x) { return x * 26; }
+inline int f9623_27(int x) { return x * 27; }
+inline int f9623_28(int x) { return x * 28; }
+inline int f9623_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9626 */
+#include <vector>
+#include "h5532.h"
+#include "h7385.h"
+#include "h7557.h"
+#include "h6722.h"
+#include "h1924.h"
+#ifdef X
+#include "h7799.h"
+#endif
+struct S9626 { int a; const char *s = "x//y"; };
+inline int f9626_0(int x) { return x * 0; }
+inline int f9626_1(int x) { return x * 1; }
+inline int f9626_2(int x) { return x * 2; }
+inline int f9626_3(int x) { return x * 3; }
+inline int f9626_4(int x) { return x * 4; }
+inline int f9626_5(int x) { return x * 5; }
+inline int f9626_6(int x) { return x * 6; }
+inline int f9626_7(int x) { return x * 7; }
+inline int f9626_8(int x) { return x * 8; }
+inline int f9626_9(int x) { return x * 9; }
+inline int f9626_10(int x) { return x * 10; }
+inline int f9626_11(int x) { return x * 11; }
+inline int f9626_12(int x) { return x * 12; }
+inline int f9626_13(int x) { return x * 13; }
+inline int f9626_14(int x) { return x * 14; }
+inline int f9626_15(int x) { return x * 15; }
+inline int f9626_16(int x) { return x * 16; }
+inline int f9626_17(int x) { return x * 17; }
+inline int f9626_18(int x) { return x * 18; }
+inline int f9626_19(int x) { return x * 19; }
+inline int f9626_20(int x) { return x * 20; }
+inline int f9626_21(int x) { return x * 21; }
+inline int f9626_22(int x) { return x * 22; }
+inline int f9626_23(int x) { return x * 23; }
+inline int f9626_24(int x) { return x * 24; }
+inline int f9626_25(int x) { return x * 25; }
+inline int f9626_26(int x) { return x * 26; }
+inline int f9626_27(int x) { return x * 27; }
+inline int f9626_28(int x) { return x * 28; }
+inline int f9626_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 963 */
+#include <vector>
+#include "h7243.h"
+#include "h2664.h"
+#include "h2083.h"
+#include "h1679.h"
+#include "h3469.h"
+#ifdef X
+#include "h4034.h"
+#endif
+struct S963 { int a; const char *s = "x//y"; };
+inline int f963_0(int x) { return x * 0; }
+inline int f963_1(int x) { return x * 1; }
+inline int f963_2(int x) { return x * 2; }
+inline int f963_3(int x) { return x * 3; }
+inline int f963_4(int x) { return x * 4; }
+inline int f963_5(int x) { return x * 5; }
+inline int f963_6(int x) { return x * 6; }
+inline int f963_7(int x) { return x * 7; }
+inline int f963_8(int x) { return x * 8; }
+inline int f963_9(int x) { return x * 9; }
+inline int f963_10(int x) { return x * 10; }
+inline int f963_11(int x) { return x * 11; }
+inline int f963_12(int x) { return x * 12; }
+inline int f963_13(int x) { return x * 13; }
+inline int f963_14(int x) { return x * 14; }
+inline int f963_15(int x) { return x * 15; }
+inline int f963_16(int x) { return x * 16; }
+inline int f963_17(int x) { return x * 17; }
+inline int f963_18(int x) { return x * 18; }
+inline int f963_19(int x) { return x * 19; }
+inline int f963_20(int x) { return x * 20; }
+inline int f963_21(int x) { return x * 21; }
+inline int f963_22(int x) { return x * 22; }
+inline int f963_23(int x) { return x * 23; }
+inline int f963_24(int x) { return x * 24; }
+inline int f963_25(int x) { return x * 25; }
+inline int f963_26(int x) { return x * 26; }
+inline int f963_27(int x) { return x * 27; }
+inline int f963_28(int x) { return x * 28; }
+inline int f963_29(int x) { return x * 29; }
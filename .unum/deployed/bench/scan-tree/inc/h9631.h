@@ -0,0 +1,42 @@
+#pragma once
+/* header 9631 */
+#include <vector>
+#include "h8189.h"
+#include "h3451.h"
+#include "h2377.h"
+#include "h7496.h"
+#include "h8960.h"
+#ifdef X
+#include "h8288.h"
+#endif
+struct S9631 { int a; const char *s = "x//y"; };
+inline int f9631_0(int x) { return x * 0; }
+inline int f9631_1(int x) { return x * 1; }
+inline int f9631_2(int x) { return x * 2; }
+inline int f9631_3(int x) { return x * 3; }
+inline int f9631_4(int x) { return x * 4; }
+inline int f9631_5(int x) { return x * 5; }
+inline int f9631_6(int x) { return x * 6; }
+inline int f9631_7(int x) { return x * 7; }
+inline int f9631_8(int x) { return x * 8; }
+inline int f9631_9(int x) { return x * 9; }
+inline int f9631_10(int x) { return x * 10; }
+inline int f9631_11(int x) { return x * 11; }
+inline int f9631_12(int x) { return x * 12; }
+inline int f9631_13(int x) { return x * 13; }
+inline int f9631_14(int x) { return x * 14; }
+inline int f9631_15(int x) { return x * 15; }
+inline int f9631_16(int x) { return x * 16; }
+inline int f9631_17(int x) { return x * 17; }
+inline int f9631_18(int x) { return x * 18; }
+inline int f9631_19(int x) { return x * 19; }
+inline int f9631_20(int x) { return x * 20; }
+inline int f9631_21(int x) { return x * 21; }
+inline int f9631_22(int x) { return x * 22; }
+inline int f9631_23(int x) { return x * 23; }
+inline int f9631_24(int x) { return x * 24; }
+inline int f9631_25(int x) { return x * 25; }
+inline int f9631_26(int x) { return x * 26; }
+inline int f9631_27(int x) { return x * 27; }
+inline int f9631_28(int x) { return x * 28; }
+inline int f9631_29(int x) { return x * 29; }
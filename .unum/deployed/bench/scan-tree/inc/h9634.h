@@ -0,0 +1,42 @@
+#pragma once
+/* header 9634 */
+#include <vector>
+#include "h7212.h"
+#include "h1941.h"
+#include "h8766.h"
+#include "h2612.h"
+#include "h9139.h"
+#ifdef X
+#include "h1314.h"
+#endif
+struct S9634 { int a; const char *s = "x//y"; };
+inline int f9634_0(int x) { return x * 0; }
+inline int f9634_1(int x) { return x * 1; }
+inline int f9634_2(int x) { return x * 2; }
+inline int f9634_3(int x) { return x * 3; }
+inline int f9634_4(int x) { return x * 4; }
+inline int f9634_5(int x) { return x * 5; }
+inline int f9634_6(int x) { return x * 6; }
+inline int f9634_7(int x) { return x * 7; }
+inline int f9634_8(int x) { return x * 8; }
+inline int f9634_9(int x) { return x * 9; }
+inline int f9634_10(int x) { return x * 10; }
+inline int f9634_11(int x) { return x * 11; }
+inline int f9634_12(int x) { return x * 12; }
+inline int f9634_13(int x) { return x * 13; }
+inline int f9634_14(int x) { return x * 14; }
+inline int f9634_15(int x) { return x * 15; }
+inline int f9634_16(int x) { return x * 16; }
+inline int f9634_17(int x) { return x * 17; }
+inline int f9634_18(int x) { return x * 18; }
+inline int f9634_19(int x) { return x * 19; }
+inline int f9634_20(int x) { return x * 20; }
+inline int f9634_21(int x) { return x * 21; }
+inline int f9634_22(int x) { return x * 22; }
+inline int f9634_23(int x) { return x * 23; }
+inline int f9634_24(int x) { return x * 24; }
+inline int f9634_25(int x) { return x * 25; }
+inline int f9634_26(int x) { return x * 26; }
+inline int f9634_27(int x) { return x * 27; }
+inline int f9634_28(int x) { return x * 28; }
+inline int f9634_29(int x) { return x * 29; }
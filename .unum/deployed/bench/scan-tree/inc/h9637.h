@@ -0,0 +1,42 @@
+#pragma once
+/* header 9637 */
+#include <vector>
+#include "h4139.h"
+#include "h3360.h"
+#include "h1962.h"
+#include "h9863.h"
+#include "h3611.h"
+#ifdef X
+#include "h9909.h"
+#endif
+struct S9637 { int a; const char *s = "x//y"; };
+inline int f9637_0(int x) { return x * 0; }
+inline int f9637_1(int x) { return x * 1; }
+inline int f9637_2(int x) { return x * 2; }
+inline int f9637_3(int x) { return x * 3; }
+inline int f9637_4(int x) { return x * 4; }
+inline int f9637_5(int x) { return x * 5; }
+inline int f9637_6(int x) { return x * 6; }
+inline int f9637_7(int x) { return x * 7; }
+inline int f9637_8(int x) { return x * 8; }
+inline int f9637_9(int x) { return x * 9; }
+inline int f9637_10(int x) { return x * 10; }
+inline int f9637_11(int x) { return x * 11; }
+inline int f9637_12(int x) { return x * 12; }
+inline int f9637_13(int x) { return x * 13; }
+inline int f9637_14(int x) { return x * 14; }
+inline int f9637_15(int x) { return x * 15; }
+inline int f9637_16(int x) { return x * 16; }
+inline int f9637_17(int x) { return x * 17; }
+inline int f9637_18(int x) { return x * 18; }
+inline int f9637_19(int x) { return x * 19; }
+inline int f9637_20(int x) { return x * 20; }
+inline int f9637_21(int x) { return x * 21; }
+inline int f9637_22(int x) { return x * 22; }
+inline int f9637_23(int x) { return x * 23; }
+inline int f9637_24(int x) { return x * 24; }
+inline int f9637_25(int x) { return x * 25; }
+inline int f9637_26(int x) { return x * 26; }
+inline int f9637_27(int x) { return x * 27; }
+inline int f9637_28(int x) { return x * 28; }
+inline int f9637_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9640 */
+#include <vector>
+#include "h8980.h"
+#include "h8612.h"
+#include "h8587.h"
+#include "h4812.h"
+#include "h3633.h"
+#ifdef X
+#include "h4891.h"
+#endif
+struct S9640 { int a; const char *s = "x//y"; };
+inline int f9640_0(int x) { return x * 0; }
+inline int f9640_1(int x) { return x * 1; }
+inline int f9640_2(int x) { return x * 2; }
+inline int f9640_3(int x) { return x * 3; }
+inline int f9640_4(int x) { return x * 4; }
+inline int f9640_5(int x) { return x * 5; }
+inline int f9640_6(int x) { return x * 6; }
+inline int f9640_7(int x) { return x * 7; }
+inline int f9640_8(int x) { return x * 8; }
+inline int f9640_9(int x) { return x * 9; }
+inline int f9640_10(int x) { return x * 10; }
+inline int f9640_11(int x) { return x * 11; }
+inline int f9640_12(int x) { return x * 12; }
+inline int f9640_13(int x) { return x * 13; }
+inline int f9640_14(int x) { return x * 14; }
+inline int f9640_15(int x) { return x * 15; }
+inline int f9640_16(int x) { return x * 16; }
+inline int f9640_17(int x) { return x * 17; }
+inline int f9640_18(int x) { return x * 18; }
+inline int f9640_19(int x) { return x * 19; }
+inline int f9640_20(int x) { return x * 20; }
+inline int f9640_21(int x) { return x * 21; }
+inline int f9640_22(int x) { return x * 22; }
+inline int f9640_23(int x) { return x * 23; }
+inline int f9640_24(int x) { return x * 24; }
+inline int f9640_25(int x) { return x * 25; }
+inline int f9640_26(int x) { return x * 26; }
+inline int f9640_27(int x) { return x * 27; }
+inline int f9640_28(int x) { return x * 28; }
+inline int f9640_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9641 */
+#include <vector>
+#include "h6109.h"
+#include "h5613.h"
+#include "h1879.h"
+#include "h6645.h"
+#include "h1732.h"
+#ifdef X
+#include "h1720.h"
+#endif
+struct S9641 { int a; const char *s = "x//y"; };
+inline int f9641_0(int x) { return x * 0; }
+inline int f9641_1(int x) { return x * 1; }
+inline int f9641_2(int x) { return x * 2; }
+inline int f9641_3(int x) { return x * 3; }
+inline int f9641_4(int x) { return x * 4; }
+inline int f9641_5(int x) { return x * 5; }
+inline int f9641_6(int x) { return x * 6; }
+inline int f9641_7(int x) { return x * 7; }
+inline int f9641_8(int x) { return x * 8; }
+inline int f9641_9(int x) { return x * 9; }
+inline int f9641_10(int x) { return x * 10; }
+inline int f9641_11(int x) { return x * 11; }
+inline int f9641_12(int x) { return x * 12; }
+inline int f9641_13(int x) { return x * 13; }
+inline int f9641_14(int x) { return x * 14; }
+inline int f9641_15(int x) { return x * 15; }
+inline int f9641_16(int x) { return x * 16; }
+inline int f9641_17(int x) { return x * 17; }
+inline int f9641_18(int x) { return x * 18; }
+inline int f9641_19(int x) { return x * 19; }
+inline int f9641_20(int x) { return x * 20; }
+inline int f9641_21(int x) { return x * 21; }
+inline int f9641_22(int x) { return x * 22; }
+inline int f9641_23(int x) { return x * 23; }
+inline int f9641_24(int x) { return x * 24; }
+inline int f9641_25(int x) { return x * 25; }
+inline int f9641_26(int x) { return x * 26; }
+inline int f9641_27(int x) { return x * 27; }
+inline int f9641_28(int x) { return x * 28; }
+inline int f9641_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9643 */
+#include <vector>
+#include "h8407.h"
+#include "h3299.h"
+#include "h6157.h"
+#include "h5493.h"
+#include "h1624.h"
+#ifdef X
+#include "h7093.h"
+#endif
+struct S9643 { int a; const char *s = "x//y"; };
+inline int f9643_0(int x) { return x * 0; }
+inline int f9643_1(int x) { return x * 1; }
+inline int f9643_2(int x) { return x * 2; }
+inline int f9643_3(int x) { return x * 3; }
+inline int f9643_4(int x) { return x * 4; }
+inline int f9643_5(int x) { return x * 5; }
+inline int f9643_6(int x) { return x * 6; }
+inline int f9643_7(int x) { return x * 7; }
+inline int f9643_8(int x) { return x * 8; }
+inline int f9643_9(int x) { return x * 9; }
+inline int f9643_10(int x) { return x * 10; }
+inline int f9643_11(int x) { return x * 11; }
+inline int f9643_12(int x) { return x * 12; }
+inline int f9643_13(int x) { return x * 13; }
+inline int f9643_14(int x) { return x * 14; }
+inline int f9643_15(int x) { return x * 15; }
+inline int f9643_16(int x) { return x * 16; }
+inline int f9643_17(int x) { return x * 17; }
+inline int f9643_18(int x) { return x * 18; }
+inline int f9643_19(int x) { return x * 19; }
+inline int f9643_20(int x) { return x * 20; }
+inline int f9643_21(int x) { return x * 21; }
+inline int f9643_22(int x) { return x * 22; }
+inline int f9643_23(int x) { return x * 23; }
+inline int f9643_24(int x) { return x * 24; }
+inline int f9643_25(int x) { return x * 25; }
+inline int f9643_26(int x) { return x * 26; }
+inline int f9643_27(int x) { return x * 27; }
+inline int f9643_28(int x) { return x * 28; }
+inline int f9643_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9644 */
+#include <vector>
+#include "h5472.h"
+#include "h4657.h"
+#include "h9744.h"
+#include "h6715.h"
+#include "h7906.h"
+#ifdef X
+#include "h4194.h"
+#endif
+struct S9644 { int a; const char *s = "x//y"; };
+inline int f9644_0(int x) { return x * 0; }
+inline int f9644_1(int x) { return x * 1; }
+inline int f9644_2(int x) { return x * 2; }
+inline int f9644_3(int x) { return x * 3; }
+inline int f9644_4(int x) { return x * 4; }
+inline int f9644_5(int x) { return x * 5; }
+inline int f9644_6(int x) { return x * 6; }
+inline int f9644_7(int x) { return x * 7; }
+inline int f9644_8(int x) { return x * 8; }
+inline int f9644_9(int x) { return x * 9; }
+inline int f9644_10(int x) { return x * 10; }
+inline int f9644_11(int x) { return x * 11; }
+inline int f9644_12(int x) { return x * 12; }
+inline int f9644_13(int x) { return x * 13; }
+inline int f9644_14(int x) { return x * 14; }
+inline int f9644_15(int x) { return x * 15; }
+inline int f9644_16(int x) { return x * 16; }
+inline int f9644_17(int x) { return x * 17; }
+inline int f9644_18(int x) { return x * 18; }
+inline int f9644_19(int x) { return x * 19; }
+inline int f9644_20(int x) { return x * 20; }
+inline int f9644_21(int x) { return x * 21; }
+inline int f9644_22(int x) { return x * 22; }
+inline int f9644_23(int x) { return x * 23; }
+inline int f9644_24(int x) { return x * 24; }
+inline int f9644_25(int x) { return x * 25; }
+inline int f9644_26(int x) { return x * 26; }
+inline int f9644_27(int x) { return x * 27; }
+inline int f9644_28(int x) { return x * 28; }
+inline int f9644_29(int x) { return x * 29; }
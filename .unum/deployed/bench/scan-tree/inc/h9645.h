@@ -0,0 +1,42 @@
+#pragma once
+/* header 9645 */
+#include <vector>
+#include "h2704.h"
+#include "h9283.h"
+#include "h5065.h"
+#include "h7631.h"
+#include "h5115.h"
+#ifdef X
+#include "h3047.h"
+#endif
+struct S9645 { int a; const char *s = "x//y"; };
+inline int f9645_0(int x) { return x * 0; }
+inline int f9645_1(int x) { return x * 1; }
+inline int f9645_2(int x) { return x * 2; }
+inline int f9645_3(int x) { return x * 3; }
+inline int f9645_4(int x) { return x * 4; }
+inline int f9645_5(int x) { return x * 5; }
+inline int f9645_6(int x) { return x * 6; }
+inline int f9645_7(int x) { return x * 7; }
+inline int f9645_8(int x) { return x * 8; }
+inline int f9645_9(int x) { return x * 9; }
+inline int f9645_10(int x) { return x * 10; }
+inline int f9645_11(int x) { return x * 11; }
+inline int f9645_12(int x) { return x * 12; }
+inline int f9645_13(int x) { return x * 13; }
+inline int f9645_14(int x) { return x * 14; }
+inline int f9645_15(int x) { return x * 15; }
+inline int f9645_16(int x) { return x * 16; }
+inline int f9645_17(int x) { return x * 17; }
+inline int f9645_18(int x) { return x * 18; }
+inline int f9645_19(int x) { return x * 19; }
+inline int f9645_20(int x) { return x * 20; }
+inline int f9645_21(int x) { return x * 21; }
+inline int f9645_22(int x) { return x * 22; }
+inline int f9645_23(int x) { return x * 23; }
+inline int f9645_24(int x) { return x * 24; }
+inline int f9645_25(int x) { return x * 25; }
+inline int f9645_26(int x) { return x * 26; }
+inline int f9645_27(int x) { return x * 27; }
+inline int f9645_28(int x) { return x * 28; }
+inline int f9645_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9650 */
+#include <vector>
+#include "h7106.h"
+#include "h8013.h"
+#include "h9236.h"
+#include "h6647.h"
+#include "h5185.h"
+#ifdef X
+#include "h9947.h"
+#endif
+struct S9650 { int a; const char *s = "x//y"; };
+inline int f9650_0(int x) { return x * 0; }
+inline int f9650_1(int x) { return x * 1; }
+inline int f9650_2(int x) { return x * 2; }
+inline int f9650_3(int x) { return x * 3; }
+inline int f9650_4(int x) { return x * 4; }
+inline int f9650_5(int x) { return x * 5; }
+inline int f9650_6(int x) { return x * 6; }
+inline int f9650_7(int x) { return x * 7; }
+inline int f9650_8(int x) { return x * 8; }
+inline int f9650_9(int x) { return x * 9; }
+inline int f9650_10(int x) { return x * 10; }
+inline int f9650_11(int x) { return x * 11; }
+inline int f9650_12(int x) { return x * 12; }
+inline int f9650_13(int x) { return x * 13; }
+inline int f9650_14(int x) { return x * 14; }
+inline int f9650_15(int x) { return x * 15; }
+inline int f9650_16(int x) { return x * 16; }
+inline int f9650_17(int x) { return x * 17; }
+inline int f9650_18(int x) { return x * 18; }
+inline int f9650_19(int x) { return x * 19; }
+inline int f9650_20(int x) { return x * 20; }
+inline int f9650_21(int x) { return x * 21; }
+inline int f9650_22(int x) { return x * 22; }
+inline int f9650_23(int x) { return x * 23; }
+inline int f9650_24(int x) { return x * 24; }
+inline int f9650_25(int x) { return x * 25; }
+inline int f9650_26(int x) { return x * 26; }
+inline int f9650_27(int x) { return x * 27; }
+inline int f9650_28(int x) { return x * 28; }
+inline int f9650_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9652 */
+#include <vector>
+#include "h5313.h"
+#include "h398.h"
+#include "h9171.h"
+#include "h2500.h"
+#include "h3804.h"
+#ifdef X
+#include "h3000.h"
+#endif
+struct S9652 { int a; const char *s = "x//y"; };
+inline int f9652_0(int x) { return x * 0; }
+inline int f9652_1(int x) { return x * 1; }
+inline int f9652_2(int x) { return x * 2; }
+inline int f9652_3(int x) { return x * 3; }
+inline int f9652_4(int x) { return x * 4; }
+inline int f9652_5(int x) { return x * 5; }
+inline int f9652_6(int x) { return x * 6; }
+inline int f9652_7(int x) { return x * 7; }
+inline int f9652_8(int x) { return x * 8; }
+inline int f9652_9(int x) { return x * 9; }
+inline int f9652_10(int x) { return x * 10; }
+inline int f9652_11(int x) { return x * 11; }
+inline int f9652_12(int x) { return x * 12; }
+inline int f9652_13(int x) { return x * 13; }
+inline int f9652_14(int x) { return x * 14; }
+inline int f9652_15(int x) { return x * 15; }
+inline int f9652_16(int x) { return x * 16; }
+inline int f9652_17(int x) { return x * 17; }
+inline int f9652_18(int x) { return x * 18; }
+inline int f9652_19(int x) { return x * 19; }
+inline int f9652_20(int x) { return x * 20; }
+inline int f9652_21(int x) { return x * 21; }
+inline int f9652_22(int x) { return x * 22; }
+inline int f9652_23(int x) { return x * 23; }
+inline int f9652_24(int x) { return x * 24; }
+inline int f9652_25(int x) { return x * 25; }
+inline int f9652_26(int x) { return x * 26; }
+inline int f9652_27(int x) { return x * 27; }
+inline int f9652_28(int x) { return x * 28; }
+inline int f9652_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9654 */
+#include <vector>
+#include "h1688.h"
+#include "h4364.h"
+#include "h9937.h"
+#include "h5347.h"
+#include "h625.h"
+#ifdef X
+#include "h2855.h"
+#endif
+struct S9654 { int a; const char *s = "x//y"; };
+inline int f9654_0(int x) { return x * 0; }
+inline int f9654_1(int x) { return x * 1; }
+inline int f9654_2(int x) { return x * 2; }
+inline int f9654_3(int x) { return x * 3; }
+inline int f9654_4(int x) { return x * 4; }
+inline int f9654_5(int x) { return x * 5; }
+inline int f9654_6(int x) { return x * 6; }
+inline int f9654_7(int x) { return x * 7; }
+inline int f9654_8(int x) { return x * 8; }
+inline int f9654_9(int x) { return x * 9; }
+inline int f9654_10(int x) { return x * 10; }
+inline int f9654_11(int x) { return x * 11; }
+inline int f9654_12(int x) { return x * 12; }
+inline int f9654_13(int x) { return x * 13; }
+inline int f9654_14(int x) { return x * 14; }
+inline int f9654_15(int x) { return x * 15; }
+inline int f9654_16(int x) { return x * 16; }
+inline int f9654_17(int x) { return x * 17; }
+inline int f9654_18(int x) { return x * 18; }
+inline int f9654_19(int x) { return x * 19; }
+inline int f9654_20(int x) { return x * 20; }
+inline int f9654_21(int x) { return x * 21; }
+inline int f9654_22(int x) { return x * 22; }
+inline int f9654_23(int x) { return x * 23; }
+inline int f9654_24(int x) { return x * 24; }
+inline int f9654_25(int x) { return x * 25; }
+inline int f9654_26(int x) { return x * 26; }
+inline int f9654_27(int x) { return x * 27; }
+inline int f9654_28(int x) { return x * 28; }
+inline int f9654_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9656 */
+#include <vector>
+#include "h5749.h"
+#include "h226.h"
+#include "h8221.h"
+#include "h5069.h"
+#include "h1026.h"
+#ifdef X
+#include "h5753.h"
+#endif
+struct S9656 { int a; const char *s = "x//y"; };
+inline int f9656_0(int x) { return x * 0; }
+inline int f9656_1(int x) { return x * 1; }
+inline int f9656_2(int x) { return x * 2; }
+inline int f9656_3(int x) { return x * 3; }
+inline int f9656_4(int x) { return x * 4; }
+inline int f9656_5(int x) { return x * 5; }
+inline int f9656_6(int x) { return x * 6; }
+inline int f9656_7(int x) { return x * 7; }
+inline int f9656_8(int x) { return x * 8; }
+inline int f9656_9(int x) { return x * 9; }
+inline int f9656_10(int x) { return x * 10; }
+inline int f9656_11(int x) { return x * 11; }
+inline int f9656_12(int x) { return x * 12; }
+inline int f9656_13(int x) { return x * 13; }
+inline int f9656_14(int x) { return x * 14; }
+inline int f9656_15(int x) { return x * 15; }
+inline int f9656_16(int x) { return x * 16; }
+inline int f9656_17(int x) { return x * 17; }
+inline int f9656_18(int x) { return x * 18; }
+inline int f9656_19(int x) { return x * 19; }
+inline int f9656_20(int x) { return x * 20; }
+inline int f9656_21(int x) { return x * 21; }
+inline int f9656_22(int x) { return x * 22; }
+inline int f9656_23(int x) { return x * 23; }
+inline int f9656_24(int x) { return x * 24; }
+inline int f9656_25(int x) { return x * 25; }
+inline int f9656_26(int x) { return x * 26; }
+inline int f9656_27(int x) { return x * 27; }
+inline int f9656_28(int x) { return x * 28; }
+inline int f9656_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9658 */
+#include <vector>
+#include "h6808.h"
+#include "h3243.h"
+#include "h6923.h"
+#include "h2989.h"
+#include "h5703.h"
+#ifdef X
+#include "h8393.h"
+#endif
+struct S9658 { int a; const char *s = "x//y"; };
+inline int f9658_0(int x) { return x * 0; }
+inline int f9658_1(int x) { return x * 1; }
+inline int f9658_2(int x) { return x * 2; }
+inline int f9658_3(int x) { return x * 3; }
+inline int f9658_4(int x) { return x * 4; }
+inline int f9658_5(int x) { return x * 5; }
+inline int f9658_6(int x) { return x * 6; }
+inline int f9658_7(int x) { return x * 7; }
+inline int f9658_8(int x) { return x * 8; }
+inline int f9658_9(int x) { return x * 9; }
+inline int f9658_10(int x) { return x * 10; }
+inline int f9658_11(int x) { return x * 11; }
+inline int f9658_12(int x) { return x * 12; }
+inline int f9658_13(int x) { return x * 13; }
+inline int f9658_14(int x) { return x * 14; }
+inline int f9658_15(int x) { return x * 15; }
+inline int f9658_16(int x) { return x * 16; }
+inline int f9658_17(int x) { return x * 17; }
+inline int f9658_18(int x) { return x * 18; }
+inline int f9658_19(int x) { return x * 19; }
+inline int f9658_20(int x) { return x * 20; }
+inline int f9658_21(int x) { return x * 21; }
+inline int f9658_22(int x) { return x * 22; }
+inline int f9658_23(int x) { return x * 23; }
+inline int f9658_24(int x) { return x * 24; }
+inline int f9658_25(int x) { return x * 25; }
+inline int f9658_26(int x) { return x * 26; }
+inline int f9658_27(int x) { return x * 27; }
+inline int f9658_28(int x) { return x * 28; }
+inline int f9658_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9663 */
+#include <vector>
+#include "h9752.h"
+#include "h6035.h"
+#include "h2851.h"
+#include "h3912.h"
+#include "h6148.h"
+#ifdef X
+#include "h1694.h"
+#endif
+struct S9663 { int a; const char *s = "x//y"; };
+inline int f9663_0(int x) { return x * 0; }
+inline int f9663_1(int x) { return x * 1; }
+inline int f9663_2(int x) { return x * 2; }
+inline int f9663_3(int x) { return x * 3; }
+inline int f9663_4(int x) { return x * 4; }
+inline int f9663_5(int x) { return x * 5; }
+inline int f9663_6(int x) { return x * 6; }
+inline int f9663_7(int x) { return x * 7; }
+inline int f9663_8(int x) { return x * 8; }
+inline int f9663_9(int x) { return x * 9; }
+inline int f9663_10(int x) { return x * 10; }
+inline int f9663_11(int x) { return x * 11; }
+inline int f9663_12(int x) { return x * 12; }
+inline int f9663_13(int x) { return x * 13; }
+inline int f9663_14(int x) { return x * 14; }
+inline int f9663_15(int x) { return x * 15; }
+inline int f9663_16(int x) { return x * 16; }
+inline int f9663_17(int x) { return x * 17; }
+inline int f9663_18(int x) { return x * 18; }
+inline int f9663_19(int x) { return x * 19; }
+inline int f9663_20(int x) { return x * 20; }
+inline int f9663_21(int x) { return x * 21; }
+inline int f9663_22(int x) { return x * 22; }
+inline int f9663_23(int x) { return x * 23; }
+inline int f9663_24(int x) { return x * 24; }
+inline int f9663_25(int x) { return x * 25; }
+inline int f9663_26(int x) { return x * 26; }
+inline int f9663_27(int x) { return x * 27; }
+inline int f9663_28(int x) { return x * 28; }
+inline int f9663_29(int x) { return x * 29; }
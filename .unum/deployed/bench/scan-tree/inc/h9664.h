@@ -0,0 +1,42 @@
+#pragma once
+/* header 9664 */
+#include <vector>
+#include "h4954.h"
+#include "h2428.h"
+#include "h6215.h"
+#include "h5624.h"
+#include "h2031.h"
+#ifdef X
+#include "h4657.h"
+#endif
+struct S9664 { int a; const char *s = "x//y"; };
+inline int f9664_0(int x) { return x * 0; }
+inline int f9664_1(int x) { return x * 1; }
+inline int f9664_2(int x) { return x * 2; }
+inline int f9664_3(int x) { return x * 3; }
+inline int f9664_4(int x) { return x * 4; }
+inline int f9664_5(int x) { return x * 5; }
+inline int f9664_6(int x) { return x * 6; }
+inline int f9664_7(int x) { return x * 7; }
+inline int f9664_8(int x) { return x * 8; }
+inline int f9664_9(int x) { return x * 9; }
+inline int f9664_10(int x) { return x * 10; }
+inline int f9664_11(int x) { return x * 11; }
+inline int f9664_12(int x) { return x * 12; }
+inline int f9664_13(int x) { return x * 13; }
+inline int f9664_14(int x) { return x * 14; }
+inline int f9664_15(int x) { return x * 15; }
+inline int f9664_16(int x) { return x * 16; }
+inline int f9664_17(int x) { return x * 17; }
+inline int f9664_18(int x) { return x * 18; }
+inline int f9664_19(int x) { return x * 19; }
+inline int f9664_20(int x) { return x * 20; }
+inline int f9664_21(int x) { return x * 21; }
+inline int f9664_22(int x) { return x * 22; }
+inline int f9664_23(int x) { return x * 23; }
+inline int f9664_24(int x) { return x * 24; }
+inline int f9664_25(int x) { return x * 25; }
+inline int f9664_26(int x) { return x * 26; }
+inline int f9664_27(int x) { return x * 27; }
+inline int f9664_28(int x) { return x * 28; }
+inline int f9664_29(int x) { return x * 29; }
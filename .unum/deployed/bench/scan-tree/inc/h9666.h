@@ -0,0 +1,42 @@
+#pragma once
+/* header 9666 */
+#include <vector>
+#include "h4371.h"
+#include "h1910.h"
+#include "h1161.h"
+#include "h5929.h"
+#include "h8155.h"
+#ifdef X
+#include "h8398.h"
+#endif
+struct S9666 { int a; const char *s = "x//y"; };
+inline int f9666_0(int x) { return x * 0; }
+inline int f9666_1(int x) { return x * 1; }
+inline int f9666_2(int x) { return x * 2; }
+inline int f9666_3(int x) { return x * 3; }
+inline int f9666_4(int x) { return x * 4; }
+inline int f9666_5(int x) { return x * 5; }
+inline int f9666_6(int x) { return x * 6; }
+inline int f9666_7(int x) { return x * 7; }
+inline int f9666_8(int x) { return x * 8; }
+inline int f9666_9(int x) { return x * 9; }
+inline int f9666_10(int x) { return x * 10; }
+inline int f9666_11(int x) { return x * 11; }
+inline int f9666_12(int x) { return x * 12; }
+inline int f9666_13(int x) { return x * 13; }
+inline int f9666_14(int x) { return x * 14; }
+inline int f9666_15(int x) { return x * 15; }
+inline int f9666_16(int x) { return x * 16; }
+inline int f9666_17(int x) { return x * 17; }
+inline int f9666_18(int x) { return x * 18; }
+inline int f9666_19(int x) { return x * 19; }
+inline int f9666_20(int x) { return x * 20; }
+inline int f9666_21(int x) { return x * 21; }
+inline int f9666_22(int x) { return x * 22; }
+inline int f9666_23(int x) { return x * 23; }
+inline int f9666_24(int x) { return x * 24; }
+inline int f9666_25(int x) { return x * 25; }
+inline int f9666_26(int x) { return x * 26; }
+inline int f9666_27(int x) { return x * 27; }
+inline int f9666_28(int x) { return x * 28; }
+inline int f9666_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9667 */
+#include <vector>
+#include "h879.h"
+#include "h5841.h"
+#include "h158.h"
+#include "h5160.h"
+#include "h2937.h"
+#ifdef X
+#include "h962.h"
+#endif
+struct S9667 { int a; const char *s = "x//y"; };
+inline int f9667_0(int x) { return x * 0; }
+inline int f9667_1(int x) { return x * 1; }
+inline int f9667_2(int x) { return x * 2; }
+inline int f9667_3(int x) { return x * 3; }
+inline int f9667_4(int x) { return x * 4; }
+inline int f9667_5(int x) { return x * 5; }
+inline int f9667_6(int x) { return x * 6; }
+inline int f9667_7(int x) { return x * 7; }
+inline int f9667_8(int x) { return x * 8; }
+inline int f9667_9(int x) { return x * 9; }
+inline int f9667_10(int x) { return x * 10; }
+inline int f9667_11(int x) { return x * 11; }
+inline int f9667_12(int x) { return x * 12; }
+inline int f9667_13(int x) { return x * 13; }
+inline int f9667_14(int x) { return x * 14; }
+inline int f9667_15(int x) { return x * 15; }
+inline int f9667_16(int x) { return x * 16; }
+inline int f9667_17(int x) { return x * 17; }
+inline int f9667_18(int x) { return x * 18; }
+inline int f9667_19(int x) { return x * 19; }
+inline int f9667_20(int x) { return x * 20; }
+inline int f9667_21(int x) { return x * 21; }
+inline int f9667_22(int x) { return x * 22; }
+inline int f9667_23(int x) { return x * 23; }
+inline int f9667_24(int x) { return x * 24; }
+inline int f9667_25(int x) { return x * 25; }
+inline int f9667_26(int x) { return x * 26; }
+inline int f9667_27(int x) { return x * 27; }
+inline int f9667_28(int x) { return x * 28; }
+inline int f9667_29(int x) { return x * 29; }
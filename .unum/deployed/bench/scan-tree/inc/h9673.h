@@ -0,0 +1,42 @@
+#pragma once
+/* header 9673 */
+#include <vector>
+#include "h1331.h"
+#include "h2470.h"
+#include "h3945.h"
+#include "h3456.h"
+#include "h6536.h"
+#ifdef X
+#include "h7301.h"
+#endif
+struct S9673 { int a; const char *s = "x//y"; };
+inline int f9673_0(int x) { return x * 0; }
+inline int f9673_1(int x) { return x * 1; }
+inline int f9673_2(int x) { return x * 2; }
+inline int f9673_3(int x) { return x * 3; }
+inline int f9673_4(int x) { return x * 4; }
+inline int f9673_5(int x) { return x * 5; }
+inline int f9673_6(int x) { return x * 6; }
+inline int f9673_7(int x) { return x * 7; }
+inline int f9673_8(int x) { return x * 8; }
+inline int f9673_9(int x) { return x * 9; }
+inline int f9673_10(int x) { return x * 10; }
+inline int f9673_11(int x) { return x * 11; }
+inline int f9673_12(int x) { return x * 12; }
+inline int f9673_13(int x) { return x * 13; }
+inline int f9673_14(int x) { return x * 14; }
+inline int f9673_15(int x) { return x * 15; }
+inline int f9673_16(int x) { return x * 16; }
+inline int f9673_17(int x) { return x * 17; }
+inline int f9673_18(int x) { return x * 18; }
+inline int f9673_19(int x) { return x * 19; }
+inline int f9673_20(int x) { return x * 20; }
+inline int f9673_21(int x) { return x * 21; }
+inline int f9673_22(int x) { return x * 22; }
+inline int f9673_23(int x) { return x * 23; }
+inline int f9673_24(int x) { return x * 24; }
+inline int f9673_25(int x) { return x * 25; }
+inline int f9673_26(int x) { return x * 26; }
+inline int f9673_27(int x) { return x * 27; }
+inline int f9673_28(int x) { return x * 28; }
+inline int f9673_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9674 */
+#include <vector>
+#include "h6807.h"
+#include "h9735.h"
+#include "h7631.h"
+#include "h8125.h"
+#include "h4653.h"
+#ifdef X
+#include "h4461.h"
+#endif
+struct S9674 { int a; const char *s = "x//y"; };
+inline int f9674_0(int x) { return x * 0; }
+inline int f9674_1(int x) { return x * 1; }
+inline int f9674_2(int x) { return x * 2; }
+inline int f9674_3(int x) { return x * 3; }
+inline int f9674_4(int x) { return x * 4; }
+inline int f9674_5(int x) { return x * 5; }
+inline int f9674_6(int x) { return x * 6; }
+inline int f9674_7(int x) { return x * 7; }
+inline int f9674_8(int x) { return x * 8; }
+inline int f9674_9(int x) { return x * 9; }
+inline int f9674_10(int x) { return x * 10; }
+inline int f9674_11(int x) { return x * 11; }
+inline int f9674_12(int x) { return x * 12; }
+inline int f9674_13(int x) { return x * 13; }
+inline int f9674_14(int x) { return x * 14; }
+inline int f9674_15(int x) { return x * 15; }
+inline int f9674_16(int x) { return x * 16; }
+inline int f9674_17(int x) { return x * 17; }
+inline int f9674_18(int x) { return x * 18; }
+inline int f9674_19(int x) { return x * 19; }
+inline int f9674_20(int x) { return x * 20; }
+inline int f9674_21(int x) { return x * 21; }
+inline int f9674_22(int x) { return x * 22; }
+inline int f9674_23(int x) { return x * 23; }
+inline int f9674_24(int x) { return x * 24; }
+inline int f9674_25(int x) { return x * 25; }
+inline int f9674_26(int x) { return x * 26; }
+inline int f9674_27(int x) { return x * 27; }
+inline int f9674_28(int x) { return x * 28; }
+inline int f9674_29(int x) { return x * 29; }
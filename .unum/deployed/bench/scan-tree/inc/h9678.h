@@ -0,0 +1,42 @@
+#pragma once
+/* header 9678 */
+#include <vector>
+#include "h4147.h"
+#include "h8054.h"
+#include "h8468.h"
+#include "h2727.h"
+#include "h6820.h"
+#ifdef X
+#include "h3675.h"
+#endif
+struct S9678 { int a; const char *s = "x//y"; };
+inline int f9678_0(int x) { return x * 0; }
+inline int f9678_1(int x) { return x * 1; }
+inline int f9678_2(int x) { return x * 2; }
+inline int f9678_3(int x) { return x * 3; }
+inline int f9678_4(int x) { return x * 4; }
+inline int f9678_5(int x) { return x * 5; }
+inline int f9678_6(int x) { return x * 6; }
+inline int f9678_7(int x) { return x * 7; }
+inline int f9678_8(int x) { return x * 8; }
+inline int f9678_9(int x) { return x * 9; }
+inline int f9678_10(int x) { return x * 10; }
+inline int f9678_11(int x) { return x * 11; }
+inline int f9678_12(int x) { return x * 12; }
+inline int f9678_13(int x) { return x * 13; }
+inline int f9678_14(int x) { return x * 14; }
+inline int f9678_15(int x) { return x * 15; }
+inline int f9678_16(int x) { return x * 16; }
+inline int f9678_17(int x) { return x * 17; }
+inline int f9678_18(int x) { return x * 18; }
+inline int f9678_19(int x) { return x * 19; }
+inline int f9678_20(int x) { return x * 20; }
+inline int f9678_21(int x) { return x * 21; }
+inline int f9678_22(int x) { return x * 22; }
+inline int f9678_23(int x) { return x * 23; }
+inline int f9678_24(int x) { return x * 24; }
+inline int f9678_25(int x) { return x * 25; }
+inline int f9678_26(int x) { return x * 26; }
+inline int f9678_27(int x) { return x * 27; }
+inline int f9678_28(int x) { return x * 28; }
+inline int f9678_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 968 */
+#include <vector>
+#include "h3901.h"
+#include "h1423.h"
+#include "h2963.h"
+#include "h8603.h"
+#include "h1330.h"
+#ifdef X
+#include "h7508.h"
+#endif
+struct S968 { int a; const char *s = "x//y"; };
+inline int f968_0(int x) { return x * 0; }
+inline int f968_1(int x) { return x * 1; }
+inline int f968_2(int x) { return x * 2; }
+inline int f968_3(int x) { return x * 3; }
+inline int f968_4(int x) { return x * 4; }
+inline int f968_5(int x) { return x * 5; }
+inline int f968_6(int x) { return x * 6; }
+inline int f968_7(int x) { return x * 7; }
+inline int f968_8(int x) { return x * 8; }
+inline int f968_9(int x) { return x * 9; }
+inline int f968_10(int x) { return x * 10; }
+inline int f968_11(int x) { return x * 11; }
+inline int f968_12(int x) { return x * 12; }
+inline int f968_13(int x) { return x * 13; }
+inline int f968_14(int x) { return x * 14; }
+inline int f968_15(int x) { return x * 15; }
+inline int f968_16(int x) { return x * 16; }
+inline int f968_17(int x) { return x * 17; }
+inline int f968_18(int x) { return x * 18; }
+inline int f968_19(int x) { return x * 19; }
+inline int f968_20(int x) { return x * 20; }
+inline int f968_21(int x) { return x * 21; }
+inline int f968_22(int x) { return x * 22; }
+inline int f968_23(int x) { return x * 23; }
+inline int f968_24(int x) { return x * 24; }
+inline int f968_25(int x) { return x * 25; }
+inline int f968_26(int x) { return x * 26; }
+inline int f968_27(int x) { return x * 27; }
+inline int f968_28(int x) { return x * 28; }
+inline int f968_29(int x) { return x * 29; }
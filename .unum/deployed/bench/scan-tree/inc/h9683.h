@@ -0,0 +1,42 @@
+#pragma once
+/* header 9683 */
+#include <vector>
+#include "h1982.h"
+#include "h4583.h"
+#include "h4168.h"
+#include "h112.h"
+#include "h3610.h"
+#ifdef X
+#include "h4326.h"
+#endif
+struct S9683 { int a; const char *s = "x//y"; };
+inline int f9683_0(int x) { return x * 0; }
+inline int f9683_1(int x) { return x * 1; }
+inline int f9683_2(int x) { return x * 2; }
+inline int f9683_3(int x) { return x * 3; }
+inline int f9683_4(int x) { return x * 4; }
+inline int f9683_5(int x) { return x * 5; }
+inline int f9683_6(int x) { return x * 6; }
+inline int f9683_7(int x) { return x * 7; }
+inline int f9683_8(int x) { return x * 8; }
+inline int f9683_9(int x) { return x * 9; }
+inline int f9683_10(int x) { return x * 10; }
+inline int f9683_11(int x) { return x * 11; }
+inline int f9683_12(int x) { return x * 12; }
+inline int f9683_13(int x) { return x * 13; }
+inline int f9683_14(int x) { return x * 14; }
+inline int f9683_15(int x) { return x * 15; }
+inline int f9683_16(int x) { return x * 16; }
+inline int f9683_17(int x) { return x * 17; }
+inline int f9683_18(int x) { return x * 18; }
+inline int f9683_19(int x) { return x * 19; }
+inline int f9683_20(int x) { return x * 20; }
+inline int f9683_21(int x) { return x * 21; }
+inline int f9683_22(int x) { return x * 22; }
+inline int f9683_23(int x) { return x * 23; }
+inline int f9683_24(int x) { return x * 24; }
+inline int f9683_25(int x) { return x * 25; }
+inline int f9683_26(int x) { return x * 26; }
+inline int f9683_27(int x) { return x * 27; }
+inline int f9683_28(int x) { return x * 28; }
+inline int f9683_29(int x) { return x * 29; }
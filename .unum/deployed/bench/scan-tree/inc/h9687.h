@@ -0,0 +1,42 @@
+#pragma once
+/* header 9687 */
+#include <vector>
+#include "h4199.h"
+#include "h3150.h"
+#include "h7127.h"
+#include "h8520.h"
+#include "h2321.h"
+#ifdef X
+#include "h4081.h"
+#endif
+struct S9687 { int a; const char *s = "x//y"; };
+inline int f9687_0(int x) { return x * 0; }
+inline int f9687_1(int x) { return x * 1; }
+inline int f9687_2(int x) { return x * 2; }
+inline int f9687_3(int x) { return x * 3; }
+inline int f9687_4(int x) { return x * 4; }
+inline int f9687_5(int x) { return x * 5; }
+inline int f9687_6(int x) { return x * 6; }
+inline int f9687_7(int x) { return x * 7; }
+inline int f9687_8(int x) { return x * 8; }
+inline int f9687_9(int x) { return x * 9; }
+inline int f9687_10(int x) { return x * 10; }
+inline int f9687_11(int x) { return x * 11; }
+inline int f9687_12(int x) { return x * 12; }
+inline int f9687_13(int x) { return x * 13; }
+inline int f9687_14(int x) { return x * 14; }
+inline int f9687_15(int x) { return x * 15; }
+inline int f9687_16(int x) { return x * 16; }
+inline int f9687_17(int x) { return x * 17; }
+inline int f9687_18(int x) { return x * 18; }
+inline int f9687_19(int x) { return x * 19; }
+inline int f9687_20(int x) { return x * 20; }
+inline int f9687_21(int x) { return x * 21; }
+inline int f9687_22(int x) { return x * 22; }
+inline int f9687_23(int x) { return x * 23; }
+inline int f9687_24(int x) { return x * 24; }
+inline int f9687_25(int x) { return x * 25; }
+inline int f9687_26(int x) { return x * 26; }
+inline int f9687_27(int x) { return x * 27; }
+inline int f9687_28(int x) { return x * 28; }
+inline int f9687_29(int x) { return x * 29; }
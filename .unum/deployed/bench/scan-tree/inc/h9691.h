@@ -0,0 +1,42 @@
+#pragma once
+/* header 9691 */
+#include <vector>
+#include "h8452.h"
+#include "h6994.h"
+#include "h4570.h"
+#include "h7336.h"
+#include "h8575.h"
+#ifdef X
+#include "h2470.h"
+#endif
+struct S9691 { int a; const char *s = "x//y"; };
+inline int f9691_0(int x) { return x * 0; }
+inline int f9691_1(int x) { return x * 1; }
+inline int f9691_2(int x) { return x * 2; }
+inline int f9691_3(int x) { return x * 3; }
+inline int f9691_4(int x) { return x * 4; }
+inline int f9691_5(int x) { return x * 5; }
+inline int f9691_6(int x) { return x * 6; }
+inline int f9691_7(int x) { return x * 7; }
+inline int f9691_8(int x) { return x * 8; }
+inline int f9691_9(int x) { return x * 9; }
+inline int f9691_10(int x) { return x * 10; }
+inline int f9691_11(int x) { return x * 11; }
+inline int f9691_12(int x) { return x * 12; }
+inline int f9691_13(int x) { return x * 13; }
+inline int f9691_14(int x) { return x * 14; }
+inline int f9691_15(int x) { return x * 15; }
+inline int f9691_16(int x) { return x * 16; }
+inline int f9691_17(int x) { return x * 17; }
+inline int f9691_18(int x) { return x * 18; }
+inline int f9691_19(int x) { return x * 19; }
+inline int f9691_20(int x) { return x * 20; }
+inline int f9691_21(int x) { return x * 21; }
+inline int f9691_22(int x) { return x * 22; }
+inline int f9691_23(int x) { return x * 23; }
+inline int f9691_24(int x) { return x * 24; }
+inline int f9691_25(int x) { return x * 25; }
+inline int f9691_26(int x) { return x * 26; }
+inline int f9691_27(int x) { return x * 27; }
+inline int f9691_28(int x) { return x * 28; }
+inline int f9691_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9692 */
+#include <vector>
+#include "h7827.h"
+#include "h887.h"
+#include "h1837.h"
+#include "h3930.h"
+#include "h2730.h"
+#ifdef X
+#include "h9052.h"
+#endif
+struct S9692 { int a; const char *s = "x//y"; };
+inline int f9692_0(int x) { return x * 0; }
+inline int f9692_1(int x) { return x * 1; }
+inline int f9692_2(int x) { return x * 2; }
+inline int f9692_3(int x) { return x * 3; }
+inline int f9692_4(int x) { return x * 4; }
+inline int f9692_5(int x) { return x * 5; }
+inline int f9692_6(int x) { return x * 6; }
+inline int f9692_7(int x) { return x * 7; }
+inline int f9692_8(int x) { return x * 8; }
+inline int f9692_9(int x) { return x * 9; }
+inline int f9692_10(int x) { return x * 10; }
+inline int f9692_11(int x) { return x * 11; }
+inline int f9692_12(int x) { return x * 12; }
+inline int f9692_13(int x) { return x * 13; }
+inline int f9692_14(int x) { return x * 14; }
+inline int f9692_15(int x) { return x * 15; }
+inline int f9692_16(int x) { return x * 16; }
+inline int f9692_17(int x) { return x * 17; }
+inline int f9692_18(int x) { return x * 18; }
+inline int f9692_19(int x) { return x * 19; }
+inline int f9692_20(int x) { return x * 20; }
+inline int f9692_21(int x) { return x * 21; }
+inline int f9692_22(int x) { return x * 22; }
+inline int f9692_23(int x) { return x * 23; }
+inline int f9692_24(int x) { return x * 24; }
+inline int f9692_25(int x) { return x * 25; }
+inline int f9692_26(int x) { return x * 26; }
+inline int f9692_27(int x) { return x * 27; }
+inline int f9692_28(int x) { return x * 28; }
+inline int f9692_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9696 */
+#include <vector>
+#include "h5255.h"
+#include "h4288.h"
+#include "h2290.h"
+#include "h509.h"
+#include "h788.h"
+#ifdef X
+#include "h4009.h"
+#endif
+struct S9696 { int a; const char *s = "x//y"; };
+inline int f9696_0(int x) { return x * 0; }
+inline int f9696_1(int x) { return x * 1; }
+inline int f9696_2(int x) { return x * 2; }
+inline int f9696_3(int x) { return x * 3; }
+inline int f9696_4(int x) { return x * 4; }
+inline int f9696_5(int x) { return x * 5; }
+inline int f9696_6(int x) { return x * 6; }
+inline int f9696_7(int x) { return x * 7; }
+inline int f9696_8(int x) { return x * 8; }
+inline int f9696_9(int x) { return x * 9; }
+inline int f9696_10(int x) { return x * 10; }
+inline int f9696_11(int x) { return x * 11; }
+inline int f9696_12(int x) { return x * 12; }
+inline int f9696_13(int x) { return x * 13; }
+inline int f9696_14(int x) { return x * 14; }
+inline int f9696_15(int x) { return x * 15; }
+inline int f9696_16(int x) { return x * 16; }
+inline int f9696_17(int x) { return x * 17; }
+inline int f9696_18(int x) { return x * 18; }
+inline int f9696_19(int x) { return x * 19; }
+inline int f9696_20(int x) { return x * 20; }
+inline int f9696_21(int x) { return x * 21; }
+inline int f9696_22(int x) { return x * 22; }
+inline int f9696_23(int x) { return x * 23; }
+inline int f9696_24(int x) { return x * 24; }
+inline int f9696_25(int x) { return x * 25; }
+inline int f9696_26(int x) { return x * 26; }
+inline int f9696_27(int x) { return x * 27; }
+inline int f9696_28(int x) { return x * 28; }
+inline int f9696_29(int x) { return x * 29; }
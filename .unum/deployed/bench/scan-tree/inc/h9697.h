@@ -0,0 +1,42 @@
+#pragma once
+/* header 9697 */
+#include <vector>
+#include "h9891.h"
+#include "h4665.h"
+#include "h5009.h"
+#include "h5226.h"
+#include "h7307.h"
+#ifdef X
+#include "h2973.h"
+#endif
+struct S9697 { int a; const char *s = "x//y"; };
+inline int f9697_0(int x) { return x * 0; }
+inline int f9697_1(int x) { return x * 1; }
+inline int f9697_2(int x) { return x * 2; }
+inline int f9697_3(int x) { return x * 3; }
+inline int f9697_4(int x) { return x * 4; }
+inline int f9697_5(int x) { return x * 5; }
+inline int f9697_6(int x) { return x * 6; }
+inline int f9697_7(int x) { return x * 7; }
+inline int f9697_8(int x) { return x * 8; }
+inline int f9697_9(int x) { return x * 9; }
+inline int f9697_10(int x) { return x * 10; }
+inline int f9697_11(int x) { return x * 11; }
+inline int f9697_12(int x) { return x * 12; }
+inline int f9697_13(int x) { return x * 13; }
+inline int f9697_14(int x) { return x * 14; }
+inline int f9697_15(int x) { return x * 15; }
+inline int f9697_16(int x) { return x * 16; }
+inline int f9697_17(int x) { return x * 17; }
+inline int f9697_18(int x) { return x * 18; }
+inline int f9697_19(int x) { return x * 19; }
+inline int f9697_20(int x) { return x * 20; }
+inline int f9697_21(int x) { return x * 21; }
+inline int f9697_22(int x) { return x * 22; }
+inline int f9697_23(int x) { return x * 23; }
+inline int f9697_24(int x) { return x * 24; }
+inline int f9697_25(int x) { return x * 25; }
+inline int f9697_26(int x) { return x * 26; }
+inline int f9697_27(int x) { return x * 27; }
+inline int f9697_28(int x) { return x * 28; }
+inline int f9697_29(int x) { return x * 29; }
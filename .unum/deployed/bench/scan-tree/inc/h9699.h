@@ -0,0 +1,42 @@
+#pragma once
+/* header 9699 */
+#include <vector>
+#include "h5503.h"
+#include "h2880.h"
+#include "h8381.h"
+#include "h1458.h"
+#include "h5964.h"
+#ifdef X
+#include "h5329.h"
+#endif
+struct S9699 { int a; const char *s = "x//y"; };
+inline int f9699_0(int x) { return x * 0; }
+inline int f9699_1(int x) { return x * 1; }
+inline int f9699_2(int x) { return x * 2; }
+inline int f9699_3(int x) { return x * 3; }
+inline int f9699_4(int x) { return x * 4; }
+inline int f9699_5(int x) { return x * 5; }
+inline int f9699_6(int x) { return x * 6; }
+inline int f9699_7(int x) { return x * 7; }
+inline int f9699_8(int x) { return x * 8; }
+inline int f9699_9(int x) { return x * 9; }
+inline int f9699_10(int x) { return x * 10; }
+inline int f9699_11(int x) { return x * 11; }
+inline int f9699_12(int x) { return x * 12; }
+inline int f9699_13(int x) { return x * 13; }
+inline int f9699_14(int x) { return x * 14; }
+inline int f9699_15(int x) { return x * 15; }
+inline int f9699_16(int x) { return x * 16; }
+inline int f9699_17(int x) { return x * 17; }
+inline int f9699_18(int x) { return x * 18; }
+inline int f9699_19(int x) { return x * 19; }
+inline int f9699_20(int x) { return x * 20; }
+inline int f9699_21(int x) { return x * 21; }
+inline int f9699_22(int x) { return x * 22; }
+inline int f9699_23(int x) { return x * 23; }
+inline int f9699_24(int x) { return x * 24; }
+inline int f9699_25(int x) { return x * 25; }
+inline int f9699_26(int x) { return x * 26; }
+inline int f9699_27(int x) { return x * 27; }
+inline int f9699_28(int x) { return x * 28; }
+inline int f9699_29(int x) { return x * 29; }
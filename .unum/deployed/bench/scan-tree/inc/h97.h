@@ -0,0 +1,42 @@
+#pragma once
+/* header 97 */
+#include <vector>
+#include "h8801.h"
+#include "h3124.h"
+#include "h1016.h"
+#include "h1052.h"
+#include "h1897.h"
+#ifdef X
+#include "h2840.h"
+#endif
+struct S97 { int a; const char *s = "x//y"; };
+inline int f97_0(int x) { return x * 0; }
+inline int f97_1(int x) { return x * 1; }
+inline int f97_2(int x) { return x * 2; }
+inline int f97_3(int x) { return x * 3; }
+inline int f97_4(int x) { return x * 4; }
+inline int f97_5(int x) { return x * 5; }
+inline int f97_6(int x) { return x * 6; }
+inline int f97_7(int x) { return x * 7; }
+inline int f97_8(int x) { return x * 8; }
+inline int f97_9(int x) { return x * 9; }
+inline int f97_10(int x) { return x * 10; }
+inline int f97_11(int x) { return x * 11; }
+inline int f97_12(int x) { return x * 12; }
+inline int f97_13(int x) { return x * 13; }
+inline int f97_14(int x) { return x * 14; }
+inline int f97_15(int x) { return x * 15; }
+inline int f97_16(int x) { return x * 16; }
+inline int f97_17(int x) { return x * 17; }
+inline int f97_18(int x) { return x * 18; }
+inline int f97_19(int x) { return x * 19; }
+inline int f97_20(int x) { return x * 20; }
+inline int f97_21(int x) { return x * 21; }
+inline int f97_22(int x) { return x * 22; }
+inline int f97_23(int x) { return x * 23; }
+inline int f97_24(int x) { return x * 24; }
+inline int f97_25(int x) { return x * 25; }
+inline int f97_26(int x) { return x * 26; }
+inline int f97_27(int x) { return x * 27; }
+inline int f97_28(int x) { return x * 28; }
+inline int f97_29(int x) { return x * 29; }
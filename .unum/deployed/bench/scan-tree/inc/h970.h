@@ -0,0 +1,42 @@
+#pragma once
+/* header 970 */
+#include <vector>
+#include "h2989.h"
+#include "h5933.h"
+#include "h2346.h"
+#include "h1519.h"
+#include "h1743.h"
+#ifdef X
+#include "h8111.h"
+#endif
+struct S970 { int a; const char *s = "x//y"; };
+inline int f970_0(int x) { return x * 0; }
+inline int f970_1(int x) { return x * 1; }
+inline int f970_2(int x) { return x * 2; }
+inline int f970_3(int x) { return x * 3; }
+inline int f970_4(int x) { return x * 4; }
+inline int f970_5(int x) { return x * 5; }
+inline int f970_6(int x) { return x * 6; }
+inline int f970_7(int x) { return x * 7; }
+inline int f970_8(int x) { return x * 8; }
+inline int f970_9(int x) { return x * 9; }
+inline int f970_10(int x) { return x * 10; }
+inline int f970_11(int x) { return x * 11; }
+inline int f970_12(int x) { return x * 12; }
+inline int f970_13(int x) { return x * 13; }
+inline int f970_14(int x) { return x * 14; }
+inline int f970_15(int x) { return x * 15; }
+inline int f970_16(int x) { return x * 16; }
+inline int f970_17(int x) { return x * 17; }
+inline int f970_18(int x) { return x * 18; }
+inline int f970_19(int x) { return x * 19; }
+inline int f970_20(int x) { return x * 20; }
+inline int f970_21(int x) { return x * 21; }
+inline int f970_22(int x) { return x * 22; }
+inline int f970_23(int x) { return x * 23; }
+inline int f970_24(int x) { return x * 24; }
+inline int f970_25(int x) { return x * 25; }
+inline int f970_26(int x) { return x * 26; }
+inline int f970_27(int x) { return x * 27; }
+inline int f970_28(int x) { return x * 28; }
+inline int f970_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9702 */
+#include <vector>
+#include "h5668.h"
+#include "h8809.h"
+#include "h379.h"
+#include "h4235.h"
+#include "h882.h"
+#ifdef X
+#include "h5548.h"
+#endif
+struct S9702 { int a; const char *s = "x//y"; };
+inline int f9702_0(int x) { return x * 0; }
+inline int f9702_1(int x) { return x * 1; }
+inline int f9702_2(int x) { return x * 2; }
+inline int f9702_3(int x) { return x * 3; }
+inline int f9702_4(int x) { return x * 4; }
+inline int f9702_5(int x) { return x * 5; }
+inline int f9702_6(int x) { return x * 6; }
+inline int f9702_7(int x) { return x * 7; }
+inline int f9702_8(int x) { return x * 8; }
+inline int f9702_9(int x) { return x * 9; }
+inline int f9702_10(int x) { return x * 10; }
+inline int f9702_11(int x) { return x * 11; }
+inline int f9702_12(int x) { return x * 12; }
+inline int f9702_13(int x) { return x * 13; }
+inline int f9702_14(int x) { return x * 14; }
+inline int f9702_15(int x) { return x * 15; }
+inline int f9702_16(int x) { return x * 16; }
+inline int f9702_17(int x) { return x * 17; }
+inline int f9702_18(int x) { return x * 18; }
+inline int f9702_19(int x) { return x * 19; }
+inline int f9702_20(int x) { return x * 20; }
+inline int f9702_21(int x) { return x * 21; }
+inline int f9702_22(int x) { return x * 22; }
+inline int f9702_23(int x) { return x * 23; }
+inline int f9702_24(int x) { return x * 24; }
+inline int f9702_25(int x) { return x * 25; }
+inline int f9702_26(int x) { return x * 26; }
+inline int f9702_27(int x) { return x * 27; }
+inline int f9702_28(int x) { return x * 28; }
+inline int f9702_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9703 */
+#include <vector>
+#include "h5298.h"
+#include "h8917.h"
+#include "h3483.h"
+#include "h418.h"
+#include "h3114.h"
+#ifdef X
+#include "h8476.h"
+#endif
+struct S9703 { int a; const char *s = "x//y"; };
+inline int f9703_0(int x) { return x * 0; }
+inline int f9703_1(int x) { return x * 1; }
+inline int f9703_2(int x) { return x * 2; }
+inline int f9703_3(int x) { return x * 3; }
+inline int f9703_4(int x) { return x * 4; }
+inline int f9703_5(int x) { return x * 5; }
+inline int f9703_6(int x) { return x * 6; }
+inline int f9703_7(int x) { return x * 7; }
+inline int f9703_8(int x) { return x * 8; }
+inline int f9703_9(int x) { return x * 9; }
+inline int f9703_10(int x) { return x * 10; }
+inline int f9703_11(int x) { return x * 11; }
+inline int f9703_12(int x) { return x * 12; }
+inline int f9703_13(int x) { return x * 13; }
+inline int f9703_14(int x) { return x * 14; }
+inline int f9703_15(int x) { return x * 15; }
+inline int f9703_16(int x) { return x * 16; }
+inline int f9703_17(int x) { return x * 17; }
+inline int f9703_18(int x) { return x * 18; }
+inline int f9703_19(int x) { return x * 19; }
+inline int f9703_20(int x) { return x * 20; }
+inline int f9703_21(int x) { return x * 21; }
+inline int f9703_22(int x) { return x * 22; }
+inline int f9703_23(int x) { return x * 23; }
+inline int f9703_24(int x) { return x * 24; }
+inline int f9703_25(int x) { return x * 25; }
+inline int f9703_26(int x) { return x * 26; }
+inline int f9703_27(int x) { return x * 27; }
+inline int f9703_28(int x) { return x * 28; }
+inline int f9703_29(int x) { return x * 29; }
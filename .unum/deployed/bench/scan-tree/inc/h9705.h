@@ -0,0 +1,42 @@
+#pragma once
+/* header 9705 */
+#include <vector>
+#include "h4412.h"
+#include "h1676.h"
+#include "h3808.h"
+#include "h1246.h"
+#include "h7566.h"
+#ifdef X
+#include "h2770.h"
+#endif
+struct S9705 { int a; const char *s = "x//y"; };
+inline int f9705_0(int x) { return x * 0; }
+inline int f9705_1(int x) { return x * 1; }
+inline int f9705_2(int x) { return x * 2; }
+inline int f9705_3(int x) { return x * 3; }
+inline int f9705_4(int x) { return x * 4; }
+inline int f9705_5(int x) { return x * 5; }
+inline int f9705_6(int x) { return x * 6; }
+inline int f9705_7(int x) { return x * 7; }
+inline int f9705_8(int x) { return x * 8; }
+inline int f9705_9(int x) { return x * 9; }
+inline int f9705_10(int x) { return x * 10; }
+inline int f9705_11(int x) { return x * 11; }
+inline int f9705_12(int x) { return x * 12; }
+inline int f9705_13(int x) { return x * 13; }
+inline int f9705_14(int x) { return x * 14; }
+inline int f9705_15(int x) { return x * 15; }
+inline int f9705_16(int x) { return x * 16; }
+inline int f9705_17(int x) { return x * 17; }
+inline int f9705_18(int x) { return x * 18; }
+inline int f9705_19(int x) { return x * 19; }
+inline int f9705_20(int x) { return x * 20; }
+inline int f9705_21(int x) { return x * 21; }
+inline int f9705_22(int x) { return x * 22; }
+inline int f9705_23(int x) { return x * 23; }
+inline int f9705_24(int x) { return x * 24; }
+inline int f9705_25(int x) { return x * 25; }
+inline int f9705_26(int x) { return x * 26; }
+inline int f9705_27(int x) { return x * 27; }
+inline int f9705_28(int x) { return x * 28; }
+inline int f9705_29(int x) { return x * 29; }
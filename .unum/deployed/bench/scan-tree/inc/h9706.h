@@ -0,0 +1,42 @@
+#pragma once
+/* header 9706 */
+#include <vector>
+#include "h838.h"
+#include "h3900.h"
+#include "h6645.h"
+#include "h5648.h"
+#include "h8672.h"
+#ifdef X
+#include "h8088.h"
+#endif
+struct S9706 { int a; const char *s = "x//y"; };
+inline int f9706_0(int x) { return x * 0; }
+inline int f9706_1(int x) { return x * 1; }
+inline int f9706_2(int x) { return x * 2; }
+inline int f9706_3(int x) { return x * 3; }
+inline int f9706_4(int x) { return x * 4; }
+inline int f9706_5(int x) { return x * 5; }
+inline int f9706_6(int x) { return x * 6; }
+inline int f9706_7(int x) { return x * 7; }
+inline int f9706_8(int x) { return x * 8; }
+inline int f9706_9(int x) { return x * 9; }
+inline int f9706_10(int x) { return x * 10; }
+inline int f9706_11(int x) { return x * 11; }
+inline int f9706_12(int x) { return x * 12; }
+inline int f9706_13(int x) { return x * 13; }
+inline int f9706_14(int x) { return x * 14; }
+inline int f9706_15(int x) { return x * 15; }
+inline int f9706_16(int x) { return x * 16; }
+inline int f9706_17(int x) { return x * 17; }
+inline int f9706_18(int x) { return x * 18; }
+inline int f9706_19(int x) { return x * 19; }
+inline int f9706_20(int x) { return x * 20; }
+inline int f9706_21(int x) { return x * 21; }
+inline int f9706_22(int x) { return x * 22; }
+inline int f9706_23(int x) { return x * 23; }
+inline int f9706_24(int x) { return x * 24; }
+inline int f9706_25(int x) { return x * 25; }
+inline int f9706_26(int x) { return x * 26; }
+inline int f9706_27(int x) { return x * 27; }
+inline int f9706_28(int x) { return x * 28; }
+inline int f9706_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9707 */
+#include <vector>
+#include "h6069.h"
+#include "h1647.h"
+#include "h5227.h"
+#include "h4818.h"
+#include "h1601.h"
+#ifdef X
+#include "h7962.h"
+#endif
+struct S9707 { int a; const char *s = "x//y"; };
+inline int f9707_0(int x) { return x * 0; }
+inline int f9707_1(int x) { return x * 1; }
+inline int f9707_2(int x) { return x * 2; }
+inline int f9707_3(int x) { return x * 3; }
+inline int f9707_4(int x) { return x * 4; }
+inline int f9707_5(int x) { return x * 5; }
+inline int f9707_6(int x) { return x * 6; }
+inline int f9707_7(int x) { return x * 7; }
+inline int f9707_8(int x) { return x * 8; }
+inline int f9707_9(int x) { return x * 9; }
+inline int f9707_10(int x) { return x * 10; }
+inline int f9707_11(int x) { return x * 11; }
+inline int f9707_12(int x) { return x * 12; }
+inline int f9707_13(int x) { return x * 13; }
+inline int f9707_14(int x) { return x * 14; }
+inline int f9707_15(int x) { return x * 15; }
+inline int f9707_16(int x) { return x * 16; }
+inline int f9707_17(int x) { return x * 17; }
+inline int f9707_18(int x) { return x * 18; }
+inline int f9707_19(int x) { return x * 19; }
+inline int f9707_20(int x) { return x * 20; }
+inline int f9707_21(int x) { return x * 21; }
+inline int f9707_22(int x) { return x * 22; }
+inline int f9707_23(int x) { return x * 23; }
+inline int f9707_24(int x) { return x * 24; }
+inline int f9707_25(int x) { return x * 25; }
+inline int f9707_26(int x) { return x * 26; }
+inline int f9707_27(int x) { return x * 27; }
+inline int f9707_28(int x) { return x * 28; }
+inline int f9707_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9709 */
+#include <vector>
+#include "h2216.h"
+#include "h2687.h"
+#include "h7121.h"
+#include "h1149.h"
+#include "h8810.h"
+#ifdef X
+#include "h1674.h"
+#endif
+struct S9709 { int a; const char *s = "x//y"; };
+inline int f9709_0(int x) { return x * 0; }
+inline int f9709_1(int x) { return x * 1; }
+inline int f9709_2(int x) { return x * 2; }
+inline int f9709_3(int x) { return x * 3; }
+inline int f9709_4(int x) { return x * 4; }
+inline int f9709_5(int x) { return x * 5; }
+inline int f9709_6(int x) { return x * 6; }
+inline int f9709_7(int x) { return x * 7; }
+inline int f9709_8(int x) { return x * 8; }
+inline int f9709_9(int x) { return x * 9; }
+inline int f9709_10(int x) { return x * 10; }
+inline int f9709_11(int x) { return x * 11; }
+inline int f9709_12(int x) { return x * 12; }
+inline int f9709_13(int x) { return x * 13; }
+inline int f9709_14(int x) { return x * 14; }
+inline int f9709_15(int x) { return x * 15; }
+inline int f9709_16(int x) { return x * 16; }
+inline int f9709_17(int x) { return x * 17; }
+inline int f9709_18(int x) { return x * 18; }
+inline int f9709_19(int x) { return x * 19; }
+inline int f9709_20(int x) { return x * 20; }
+inline int f9709_21(int x) { return x * 21; }
+inline int f9709_22(int x) { return x * 22; }
+inline int f9709_23(int x) { return x * 23; }
+inline int f9709_24(int x) { return x * 24; }
+inline int f9709_25(int x) { return x * 25; }
+inline int f9709_26(int x) { return x * 26; }
+inline int f9709_27(int x) { return x * 27; }
+inline int f9709_28(int x) { return x * 28; }
+inline int f9709_29(int x) { return x * 29; }
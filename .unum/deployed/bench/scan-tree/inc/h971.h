@@ -0,0 +1,42 @@
+#pragma once
+/* header 971 */
+#include <vector>
+#include "h294.h"
+#include "h537.h"
+#include "h143.h"
+#include "h4487.h"
+#include "h5723.h"
+#ifdef X
+#include "h8098.h"
+#endif
+struct S971 { int a; const char *s = "x//y"; };
+inline int f971_0(int x) { return x * 0; }
+inline int f971_1(int x) { return x * 1; }
+inline int f971_2(int x) { return x * 2; }
+inline int f971_3(int x) { return x * 3; }
+inline int f971_4(int x) { return x * 4; }
+inline int f971_5(int x) { return x * 5; }
+inline int f971_6(int x) { return x * 6; }
+inline int f971_7(int x) { return x * 7; }
+inline int f971_8(int x) { return x * 8; }
+inline int f971_9(int x) { return x * 9; }
+inline int f971_10(int x) { return x * 10; }
+inline int f971_11(int x) { return x * 11; }
+inline int f971_12(int x) { return x * 12; }
+inline int f971_13(int x) { return x * 13; }
+inline int f971_14(int x) { return x * 14; }
+inline int f971_15(int x) { return x * 15; }
+inline int f971_16(int x) { return x * 16; }
+inline int f971_17(int x) { return x * 17; }
+inline int f971_18(int x) { return x * 18; }
+inline int f971_19(int x) { return x * 19; }
+inline int f971_20(int x) { return x * 20; }
+inline int f971_21(int x) { return x * 21; }
+inline int f971_22(int x) { return x * 22; }
+inline int f971_23(int x) { return x * 23; }
+inline int f971_24(int x) { return x * 24; }
+inline int f971_25(int x) { return x * 25; }
+inline int f971_26(int x) { return x * 26; }
+inline int f971_27(int x) { return x * 27; }
+inline int f971_28(int x) { return x * 28; }
+inline int f971_29(int x) { return x * 29; }
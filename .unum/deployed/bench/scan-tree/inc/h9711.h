@@ -0,0 +1,42 @@
+#pragma once
+/* header 9711 */
+#include <vector>
+#include "h9057.h"
+#include "h9006.h"
+#include "h1310.h"
+#include "h5176.h"
+#include "h5655.h"
+#ifdef X
+#include "h2378.h"
+#endif
+struct S9711 { int a; const char *s = "x//y"; };
+inline int f9711_0(int x) { return x * 0; }
+inline int f9711_1(int x) { return x * 1; }
+inline int f9711_2(int x) { return x * 2; }
+inline int f9711_3(int x) { return x * 3; }
+inline int f9711_4(int x) { return x * 4; }
+inline int f9711_5(int x) { return x * 5; }
+inline int f9711_6(int x) { return x * 6; }
+inline int f9711_7(int x) { return x * 7; }
+inline int f9711_8(int x) { return x * 8; }
+inline int f9711_9(int x) { return x * 9; }
+inline int f9711_10(int x) { return x * 10; }
+inline int f9711_11(int x) { return x * 11; }
+inline int f9711_12(int x) { return x * 12; }
+inline int f9711_13(int x) { return x * 13; }
+inline int f9711_14(int x) { return x * 14; }
+inline int f9711_15(int x) { return x * 15; }
+inline int f9711_16(int x) { return x * 16; }
+inline int f9711_17(int x) { return x * 17; }
+inline int f9711_18(int x) { return x * 18; }
+inline int f9711_19(int x) { return x * 19; }
+inline int f9711_20(int x) { return x * 20; }
+inline int f9711_21(int x) { return x * 21; }
+inline int f9711_22(int x) { return x * 22; }
+inline int f9711_23(int x) { return x * 23; }
+inline int f9711_24(int x) { return x * 24; }
+inline int f9711_25(int x) { return x * 25; }
+inline int f9711_26(int x) { return x * 26; }
+inline int f9711_27(int x) { return x * 27; }
+inline int f9711_28(int x) { return x * 28; }
+inline int f9711_29(int x) { return x * 29; }
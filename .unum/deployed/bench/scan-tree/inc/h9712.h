@@ -0,0 +1,42 @@
+#pragma once
+/* header 9712 */
+#include <vector>
+#include "h2597.h"
+#include "h2335.h"
+#include "h8585.h"
+#include "h9909.h"
+#include "h9590.h"
+#ifdef X
+#include "h8448.h"
+#endif
+struct S9712 { int a; const char *s = "x//y"; };
+inline int f9712_0(int x) { return x * 0; }
+inline int f9712_1(int x) { return x * 1; }
+inline int f9712_2(int x) { return x * 2; }
+inline int f9712_3(int x) { return x * 3; }
+inline int f9712_4(int x) { return x * 4; }
+inline int f9712_5(int x) { return x * 5; }
+inline int f9712_6(int x) { return x * 6; }
+inline int f9712_7(int x) { return x * 7; }
+inline int f9712_8(int x) { return x * 8; }
+inline int f9712_9(int x) { return x * 9; }
+inline int f9712_10(int x) { return x * 10; }
+inline int f9712_11(int x) { return x * 11; }
+inline int f9712_12(int x) { return x * 12; }
+inline int f9712_13(int x) { return x * 13; }
+inline int f9712_14(int x) { return x * 14; }
+inline int f9712_15(int x) { return x * 15; }
+inline int f9712_16(int x) { return x * 16; }
+inline int f9712_17(int x) { return x * 17; }
+inline int f9712_18(int x) { return x * 18; }
+inline int f9712_19(int x) { return x * 19; }
+inline int f9712_20(int x) { return x * 20; }
+inline int f9712_21(int x) { return x * 21; }
+inline int f9712_22(int x) { return x * 22; }
+inline int f9712_23(int x) { return x * 23; }
+inline int f9712_24(int x) { return x * 24; }
+inline int f9712_25(int x) { return x * 25; }
+inline int f9712_26(int x) { return x * 26; }
+inline int f9712_27(int x) { return x * 27; }
+inline int f9712_28(int x) { return x * 28; }
+inline int f9712_29(int x) { return x * 29; }
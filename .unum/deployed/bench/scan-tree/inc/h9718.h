@@ -0,0 +1,42 @@
+#pragma once
+/* header 9718 */
+#include <vector>
+#include "h2280.h"
+#include "h8423.h"
+#include "h1097.h"
+#include "h1595.h"
+#include "h9018.h"
+#ifdef X
+#include "h4998.h"
+#endif
+struct S9718 { int a; const char *s = "x//y"; };
+inline int f9718_0(int x) { return x * 0; }
+inline int f9718_1(int x) { return x * 1; }
+inline int f9718_2(int x) { return x * 2; }
+inline int f9718_3(int x) { return x * 3; }
+inline int f9718_4(int x) { return x * 4; }
+inline int f9718_5(int x) { return x * 5; }
+inline int f9718_6(int x) { return x * 6; }
+inline int f9718_7(int x) { return x * 7; }
+inline int f9718_8(int x) { return x * 8; }
+inline int f9718_9(int x) { return x * 9; }
+inline int f9718_10(int x) { return x * 10; }
+inline int f9718_11(int x) { return x * 11; }
+inline int f9718_12(int x) { return x * 12; }
+inline int f9718_13(int x) { return x * 13; }
+inline int f9718_14(int x) { return x * 14; }
+inline int f9718_15(int x) { return x * 15; }
+inline int f9718_16(int x) { return x * 16; }
+inline int f9718_17(int x) { return x * 17; }
+inline int f9718_18(int x) { return x * 18; }
+inline int f9718_19(int x) { return x * 19; }
+inline int f9718_20(int x) { return x * 20; }
+inline int f9718_21(int x) { return x * 21; }
+inline int f9718_22(int x) { return x * 22; }
+inline int f9718_23(int x) { return x * 23; }
+inline int f9718_24(int x) { return x * 24; }
+inline int f9718_25(int x) { return x * 25; }
+inline int f9718_26(int x) { return x * 26; }
+inline int f9718_27(int x) { return x * 27; }
+inline int f9718_28(int x) { return x * 28; }
+inline int f9718_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9728 */
+#include <vector>
+#include "h4705.h"
+#include "h5426.h"
+#include "h3849.h"
+#include "h8520.h"
+#include "h5222.h"
+#ifdef X
+#include "h3912.h"
+#endif
+struct S9728 { int a; const char *s = "x//y"; };
+inline int f9728_0(int x) { return x * 0; }
+inline int f9728_1(int x) { return x * 1; }
+inline int f9728_2(int x) { return x * 2; }
+inline int f9728_3(int x) { return x * 3; }
+inline int f9728_4(int x) { return x * 4; }
+inline int f9728_5(int x) { return x * 5; }
+inline int f9728_6(int x) { return x * 6; }
+inline int f9728_7(int x) { return x * 7; }
+inline int f9728_8(int x) { return x * 8; }
+inline int f9728_9(int x) { return x * 9; }
+inline int f9728_10(int x) { return x * 10; }
+inline int f9728_11(int x) { return x * 11; }
+inline int f9728_12(int x) { return x * 12; }
+inline int f9728_13(int x) { return x * 13; }
+inline int f9728_14(int x) { return x * 14; }
+inline int f9728_15(int x) { return x * 15; }
+inline int f9728_16(int x) { return x * 16; }
+inline int f9728_17(int x) { return x * 17; }
+inline int f9728_18(int x) { return x * 18; }
+inline int f9728_19(int x) { return x * 19; }
+inline int f9728_20(int x) { return x * 20; }
+inline int f9728_21(int x) { return x * 21; }
+inline int f9728_22(int x) { return x * 22; }
+inline int f9728_23(int x) { return x * 23; }
+inline int f9728_24(int x) { return x * 24; }
+inline int f9728_25(int x) { return x * 25; }
+inline int f9728_26(int x) { return x * 26; }
+inline int f9728_27(int x) { return x * 27; }
+inline int f9728_28(int x) { return x * 28; }
+inline int f9728_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9729 */
+#include <vector>
+#include "h944.h"
+#include "h8190.h"
+#include "h2315.h"
+#include "h5804.h"
+#include "h878.h"
+#ifdef X
+#include "h6262.h"
+#endif
+struct S9729 { int a; const char *s = "x//y"; };
+inline int f9729_0(int x) { return x * 0; }
+inline int f9729_1(int x) { return x * 1; }
+inline int f9729_2(int x) { return x * 2; }
+inline int f9729_3(int x) { return x * 3; }
+inline int f9729_4(int x) { return x * 4; }
+inline int f9729_5(int x) { return x * 5; }
+inline int f9729_6(int x) { return x * 6; }
+inline int f9729_7(int x) { return x * 7; }
+inline int f9729_8(int x) { return x * 8; }
+inline int f9729_9(int x) { return x * 9; }
+inline int f9729_10(int x) { return x * 10; }
+inline int f9729_11(int x) { return x * 11; }
+inline int f9729_12(int x) { return x * 12; }
+inline int f9729_13(int x) { return x * 13; }
+inline int f9729_14(int x) { return x * 14; }
+inline int f9729_15(int x) { return x * 15; }
+inline int f9729_16(int x) { return x * 16; }
+inline int f9729_17(int x) { return x * 17; }
+inline int f9729_18(int x) { return x * 18; }
+inline int f9729_19(int x) { return x * 19; }
+inline int f9729_20(int x) { return x * 20; }
+inline int f9729_21(int x) { return x * 21; }
+inline int f9729_22(int x) { return x * 22; }
+inline int f9729_23(int x) { return x * 23; }
+inline int f9729_24(int x) { return x * 24; }
+inline int f9729_25(int x) { return x * 25; }
+inline int f9729_26(int x) { return x * 26; }
+inline int f9729_27(int x) { return x * 27; }
+inline int f9729_28(int x) { return x * 28; }
+inline int f9729_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9732 */
+#include <vector>
+#include "h527.h"
+#include "h43.h"
+#include "h4323.h"
+#include "h3506.h"
+#include "h9722.h"
+#ifdef X
+#include "h9411.h"
+#endif
+struct S9732 { int a; const char *s = "x//y"; };
+inline int f9732_0(int x) { return x * 0; }
+inline int f9732_1(int x) { return x * 1; }
+inline int f9732_2(int x) { return x * 2; }
+inline int f9732_3(int x) { return x * 3; }
+inline int f9732_4(int x) { return x * 4; }
+inline int f9732_5(int x) { return x * 5; }
+inline int f9732_6(int x) { return x * 6; }
+inline int f9732_7(int x) { return x * 7; }
+inline int f9732_8(int x) { return x * 8; }
+inline int f9732_9(int x) { return x * 9; }
+inline int f9732_10(int x) { return x * 10; }
+inline int f9732_11(int x) { return x * 11; }
+inline int f9732_12(int x) { return x * 12; }
+inline int f9732_13(int x) { return x * 13; }
+inline int f9732_14(int x) { return x * 14; }
+inline int f9732_15(int x) { return x * 15; }
+inline int f9732_16(int x) { return x * 16; }
+inline int f9732_17(int x) { return x * 17; }
+inline int f9732_18(int x) { return x * 18; }
+inline int f9732_19(int x) { return x * 19; }
+inline int f9732_20(int x) { return x * 20; }
+inline int f9732_21(int x) { return x * 21; }
+inline int f9732_22(int x) { return x * 22; }
+inline int f9732_23(int x) { return x * 23; }
+inline int f9732_24(int x) { return x * 24; }
+inline int f9732_25(int x) { return x * 25; }
+inline int f9732_26(int x) { return x * 26; }
+inline int f9732_27(int x) { return x * 27; }
+inline int f9732_28(int x) { return x * 28; }
+inline int f9732_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9734 */
+#include <vector>
+#include "h1349.h"
+#include "h6028.h"
+#include "h6269.h"
+#include "h1527.h"
+#include "h5066.h"
+#ifdef X
+#include "h2762.h"
+#endif
+struct S9734 { int a; const char *s = "x//y"; };
+inline int f9734_0(int x) { return x * 0; }
+inline int f9734_1(int x) { return x * 1; }
+inline int f9734_2(int x) { return x * 2; }
+inline int f9734_3(int x) { return x * 3; }
+inline int f9734_4(int x) { return x * 4; }
+inline int f9734_5(int x) { return x * 5; }
+inline int f9734_6(int x) { return x * 6; }
+inline int f9734_7(int x) { return x * 7; }
+inline int f9734_8(int x) { return x * 8; }
+inline int f9734_9(int x) { return x * 9; }
+inline int f9734_10(int x) { return x * 10; }
+inline int f9734_11(int x) { return x * 11; }
+inline int f9734_12(int x) { return x * 12; }
+inline int f9734_13(int x) { return x * 13; }
+inline int f9734_14(int x) { return x * 14; }
+inline int f9734_15(int x) { return x * 15; }
+inline int f9734_16(int x) { return x * 16; }
+inline int f9734_17(int x) { return x * 17; }
+inline int f9734_18(int x) { return x * 18; }
+inline int f9734_19(int x) { return x * 19; }
+inline int f9734_20(int x) { return x * 20; }
+inline int f9734_21(int x) { return x * 21; }
+inline int f9734_22(int x) { return x * 22; }
+inline int f9734_23(int x) { return x * 23; }
+inline int f9734_24(int x) { return x * 24; }
+inline int f9734_25(int x) { return x * 25; }
+inline int f9734_26(int x) { return x * 26; }
+inline int f9734_27(int x) { return x * 27; }
+inline int f9734_28(int x) { return x * 28; }
+inline int f9734_29(int x) { return x * 29; }
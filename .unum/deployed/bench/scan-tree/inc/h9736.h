@@ -0,0 +1,42 @@
+#pragma once
+/* header 9736 */
+#include <vector>
+#include "h852.h"
+#include "h2997.h"
+#include "h5440.h"
+#include "h2878.h"
+#include "h9594.h"
+#ifdef X
+#include "h637.h"
+#endif
+struct S9736 { int a; const char *s = "x//y"; };
+inline int f9736_0(int x) { return x * 0; }
+inline int f9736_1(int x) { return x * 1; }
+inline int f9736_2(int x) { return x * 2; }
+inline int f9736_3(int x) { return x * 3; }
+inline int f9736_4(int x) { return x * 4; }
+inline int f9736_5(int x) { return x * 5; }
+inline int f9736_6(int x) { return x * 6; }
+inline int f9736_7(int x) { return x * 7; }
+inline int f9736_8(int x) { return x * 8; }
+inline int f9736_9(int x) { return x * 9; }
+inline int f9736_10(int x) { return x * 10; }
+inline int f9736_11(int x) { return x * 11; }
+inline int f9736_12(int x) { return x * 12; }
+inline int f9736_13(int x) { return x * 13; }
+inline int f9736_14(int x) { return x * 14; }
+inline int f9736_15(int x) { return x * 15; }
+inline int f9736_16(int x) { return x * 16; }
+inline int f9736_17(int x) { return x * 17; }
+inline int f9736_18(int x) { return x * 18; }
+inline int f9736_19(int x) { return x * 19; }
+inline int f9736_20(int x) { return x * 20; }
+inline int f9736_21(int x) { return x * 21; }
+inline int f9736_22(int x) { return x * 22; }
+inline int f9736_23(int x) { return x * 23; }
+inline int f9736_24(int x) { return x * 24; }
+inline int f9736_25(int x) { return x * 25; }
+inline int f9736_26(int x) { return x * 26; }
+inline int f9736_27(int x) { return x * 27; }
+inline int f9736_28(int x) { return x * 28; }
+inline int f9736_29(int x) { return x * 29; }
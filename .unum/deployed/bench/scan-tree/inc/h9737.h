@@ -0,0 +1,42 @@
+#pragma once
+/* header 9737 */
+#include <vector>
+#include "h6722.h"
+#include "h5989.h"
+#include "h9270.h"
+#include "h3401.h"
+#include "h1983.h"
+#ifdef X
+#include "h7731.h"
+#endif
+struct S9737 { int a; const char *s = "x//y"; };
+inline int f9737_0(int x) { return x * 0; }
+inline int f9737_1(int x) { return x * 1; }
+inline int f9737_2(int x) { return x * 2; }
+inline int f9737_3(int x) { return x * 3; }
+inline int f9737_4(int x) { return x * 4; }
+inline int f9737_5(int x) { return x * 5; }
+inline int f9737_6(int x) { return x * 6; }
+inline int f9737_7(int x) { return x * 7; }
+inline int f9737_8(int x) { return x * 8; }
+inline int f9737_9(int x) { return x * 9; }
+inline int f9737_10(int x) { return x * 10; }
+inline int f9737_11(int x) { return x * 11; }
+inline int f9737_12(int x) { return x * 12; }
+inline int f9737_13(int x) { return x * 13; }
+inline int f9737_14(int x) { return x * 14; }
+inline int f9737_15(int x) { return x * 15; }
+inline int f9737_16(int x) { return x * 16; }
+inline int f9737_17(int x) { return x * 17; }
+inline int f9737_18(int x) { return x * 18; }
+inline int f9737_19(int x) { return x * 19; }
+inline int f9737_20(int x) { return x * 20; }
+inline int f9737_21(int x) { return x * 21; }
+inline int f9737_22(int x) { return x * 22; }
+inline int f9737_23(int x) { return x * 23; }
+inline int f9737_24(int x) { return x * 24; }
+inline int f9737_25(int x) { return x * 25; }
+inline int f9737_26(int x) { return x * 26; }
+inline int f9737_27(int x) { return x * 27; }
+inline int f9737_28(int x) { return x * 28; }
+inline int f9737_29(int x) { return x * 29; }
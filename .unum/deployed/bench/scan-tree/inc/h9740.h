@@ -0,0 +1,42 @@
+#pragma once
+/* header 9740 */
+#include <vector>
+#include "h2384.h"
+#include "h9346.h"
+#include "h7876.h"
+#include "h6536.h"
+#include "h5951.h"
+#ifdef X
+#include "h3786.h"
+#endif
+struct S9740 { int a; const char *s = "x//y"; };
+inline int f9740_0(int x) { return x * 0; }
+inline int f9740_1(int x) { return x * 1; }
+inline int f9740_2(int x) { return x * 2; }
+inline int f9740_3(int x) { return x * 3; }
+inline int f9740_4(int x) { return x * 4; }
+inline int f9740_5(int x) { return x * 5; }
+inline int f9740_6(int x) { return x * 6; }
+inline int f9740_7(int x) { return x * 7; }
+inline int f9740_8(int x) { return x * 8; }
+inline int f9740_9(int x) { return x * 9; }
+inline int f9740_10(int x) { return x * 10; }
+inline int f9740_11(int x) { return x * 11; }
+inline int f9740_12(int x) { return x * 12; }
+inline int f9740_13(int x) { return x * 13; }
+inline int f9740_14(int x) { return x * 14; }
+inline int f9740_15(int x) { return x * 15; }
+inline int f9740_16(int x) { return x * 16; }
+inline int f9740_17(int x) { return x * 17; }
+inline int f9740_18(int x) { return x * 18; }
+inline int f9740_19(int x) { return x * 19; }
+inline int f9740_20(int x) { return x * 20; }
+inline int f9740_21(int x) { return x * 21; }
+inline int f9740_22(int x) { return x * 22; }
+inline int f9740_23(int x) { return x * 23; }
+inline int f9740_24(int x) { return x * 24; }
+inline int f9740_25(int x) { return x * 25; }
+inline int f9740_26(int x) { return x * 26; }
+inline int f9740_27(int x) { return x * 27; }
+inline int f9740_28(int x) { return x * 28; }
+inline int f9740_29(int x) { return x * 29; }
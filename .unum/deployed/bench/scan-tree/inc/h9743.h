@@ -0,0 +1,42 @@
+#pragma once
+/* header 9743 */
+#include <vector>
+#include "h8301.h"
+#include "h8439.h"
+#include "h945.h"
+#include "h6637.h"
+#include "h8895.h"
+#ifdef X
+#include "h9640.h"
+#endif
+struct S9743 { int a; const char *s = "x//y"; };
+inline int f9743_0(int x) { return x * 0; }
+inline int f9743_1(int x) { return x * 1; }
+inline int f9743_2(int x) { return x * 2; }
+inline int f9743_3(int x) { return x * 3; }
+inline int f9743_4(int x) { return x * 4; }
+inline int f9743_5(int x) { return x * 5; }
+inline int f9743_6(int x) { return x * 6; }
+inline int f9743_7(int x) { return x * 7; }
+inline int f9743_8(int x) { return x * 8; }
+inline int f9743_9(int x) { return x * 9; }
+inline int f9743_10(int x) { return x * 10; }
+inline int f9743_11(int x) { return x * 11; }
+inline int f9743_12(int x) { return x * 12; }
+inline int f9743_13(int x) { return x * 13; }
+inline int f9743_14(int x) { return x * 14; }
+inline int f9743_15(int x) { return x * 15; }
+inline int f9743_16(int x) { return x * 16; }
+inline int f9743_17(int x) { return x * 17; }
+inline int f9743_18(int x) { return x * 18; }
+inline int f9743_19(int x) { return x * 19; }
+inline int f9743_20(int x) { return x * 20; }
+inline int f9743_21(int x) { return x * 21; }
+inline int f9743_22(int x) { return x * 22; }
+inline int f9743_23(int x) { return x * 23; }
+inline int f9743_24(int x) { return x * 24; }
+inline int f9743_25(int x) { return x * 25; }
+inline int f9743_26(int x) { return x * 26; }
+inline int f9743_27(int x) { return x * 27; }
+inline int f9743_28(int x) { return x * 28; }
+inline int f9743_29(int x) { return x * 29; }
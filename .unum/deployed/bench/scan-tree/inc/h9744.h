@@ -0,0 +1,42 @@
+#pragma once
+/* header 9744 */
+#include <vector>
+#include "h1086.h"
+#include "h8325.h"
+#include "h3237.h"
+#include "h5871.h"
+#include "h3543.h"
+#ifdef X
+#include "h273.h"
+#endif
+struct S9744 { int a; const char *s = "x//y"; };
+inline int f9744_0(int x) { return x * 0; }
+inline int f9744_1(int x) { return x * 1; }
+inline int f9744_2(int x) { return x * 2; }
+inline int f9744_3(int x) { return x * 3; }
+inline int f9744_4(int x) { return x * 4; }
+inline int f9744_5(int x) { return x * 5; }
+inline int f9744_6(int x) { return x * 6; }
+inline int f9744_7(int x) { return x * 7; }
+inline int f9744_8(int x) { return x * 8; }
+inline int f9744_9(int x) { return x * 9; }
+inline int f9744_10(int x) { return x * 10; }
+inline int f9744_11(int x) { return x * 11; }
+inline int f9744_12(int x) { return x * 12; }
+inline int f9744_13(int x) { return x * 13; }
+inline int f9744_14(int x) { return x * 14; }
+inline int f9744_15(int x) { return x * 15; }
+inline int f9744_16(int x) { return x * 16; }
+inline int f9744_17(int x) { return x * 17; }
+inline int f9744_18(int x) { return x * 18; }
+inline int f9744_19(int x) { return x * 19; }
+inline int f9744_20(int x) { return x * 20; }
+inline int f9744_21(int x) { return x * 21; }
+inline int f9744_22(int x) { return x * 22; }
+inline int f9744_23(int x) { return x * 23; }
+inline int f9744_24(int x) { return x * 24; }
+inline int f9744_25(int x) { return x * 25; }
+inline int f9744_26(int x) { return x * 26; }
+inline int f9744_27(int x) { return x * 27; }
+inline int f9744_28(int x) { return x * 28; }
+inline int f9744_29(int x) { return x * 29; }
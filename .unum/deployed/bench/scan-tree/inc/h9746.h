@@ -0,0 +1,42 @@
+#pragma once
+/* header 9746 */
+#include <vector>
+#include "h910.h"
+#include "h4141.h"
+#include "h9862.h"
+#include "h1361.h"
+#include "h2319.h"
+#ifdef X
+#include "h6917.h"
+#endif
+struct S9746 { int a; const char *s = "x//y"; };
+inline int f9746_0(int x) { return x * 0; }
+inline int f9746_1(int x) { return x * 1; }
+inline int f9746_2(int x) { return x * 2; }
+inline int f9746_3(int x) { return x * 3; }
+inline int f9746_4(int x) { return x * 4; }
+inline int f9746_5(int x) { return x * 5; }
+inline int f9746_6(int x) { return x * 6; }
+inline int f9746_7(int x) { return x * 7; }
+inline int f9746_8(int x) { return x * 8; }
+inline int f9746_9(int x) { return x * 9; }
+inline int f9746_10(int x) { return x * 10; }
+inline int f9746_11(int x) { return x * 11; }
+inline int f9746_12(int x) { return x * 12; }
+inline int f9746_13(int x) { return x * 13; }
+inline int f9746_14(int x) { return x * 14; }
+inline int f9746_15(int x) { return x * 15; }
+inline int f9746_16(int x) { return x * 16; }
+inline int f9746_17(int x) { return x * 17; }
+inline int f9746_18(int x) { return x * 18; }
+inline int f9746_19(int x) { return x * 19; }
+inline int f9746_20(int x) { return x * 20; }
+inline int f9746_21(int x) { return x * 21; }
+inline int f9746_22(int x) { return x * 22; }
+inline int f9746_23(int x) { return x * 23; }
+inline int f9746_24(int x) { return x * 24; }
+inline int f9746_25(int x) { return x * 25; }
+inline int f9746_26(int x) { return x * 26; }
+inline int f9746_27(int x) { return x * 27; }
+inline int f9746_28(int x) { return x * 28; }
+inline int f9746_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9748 */
+#include <vector>
+#include "h6739.h"
+#include "h8829.h"
+#include "h927.h"
+#include "h1599.h"
+#include "h7507.h"
+#ifdef X
+#include "h1497.h"
+#endif
+struct S9748 { int a; const char *s = "x//y"; };
+inline int f9748_0(int x) { return x * 0; }
+inline int f9748_1(int x) { return x * 1; }
+inline int f9748_2(int x) { return x * 2; }
+inline int f9748_3(int x) { return x * 3; }
+inline int f9748_4(int x) { return x * 4; }
+inline int f9748_5(int x) { return x * 5; }
+inline int f9748_6(int x) { return x * 6; }
+inline int f9748_7(int x) { return x * 7; }
+inline int f9748_8(int x) { return x * 8; }
+inline int f9748_9(int x) { return x * 9; }
+inline int f9748_10(int x) { return x * 10; }
+inline int f9748_11(int x) { return x * 11; }
+inline int f9748_12(int x) { return x * 12; }
+inline int f9748_13(int x) { return x * 13; }
+inline int f9748_14(int x) { return x * 14; }
+inline int f9748_15(int x) { return x * 15; }
+inline int f9748_16(int x) { return x * 16; }
+inline int f9748_17(int x) { return x * 17; }
+inline int f9748_18(int x) { return x * 18; }
+inline int f9748_19(int x) { return x * 19; }
+inline int f9748_20(int x) { return x * 20; }
+inline int f9748_21(int x) { return x * 21; }
+inline int f9748_22(int x) { return x * 22; }
+inline int f9748_23(int x) { return x * 23; }
+inline int f9748_24(int x) { return x * 24; }
+inline int f9748_25(int x) { return x * 25; }
+inline int f9748_26(int x) { return x * 26; }
+inline int f9748_27(int x) { return x * 27; }
+inline int f9748_28(int x) { return x * 28; }
+inline int f9748_29(int x) { return x * 29; }
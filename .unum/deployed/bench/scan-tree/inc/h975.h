@@ -0,0 +1,42 @@
+#pragma once
+/* header 975 */
+#include <vector>
+#include "h1189.h"
+#include "h3865.h"
+#include "h1956.h"
+#include "h4774.h"
+#include "h3790.h"
+#ifdef X
+#include "h9429.h"
+#endif
+struct S975 { int a; const char *s = "x//y"; };
+inline int f975_0(int x) { return x * 0; }
+inline int f975_1(int x) { return x * 1; }
+inline int f975_2(int x) { return x * 2; }
+inline int f975_3(int x) { return x * 3; }
+inline int f975_4(int x) { return x * 4; }
+inline int f975_5(int x) { return x * 5; }
+inline int f975_6(int x) { return x * 6; }
+inline int f975_7(int x) { return x * 7; }
+inline int f975_8(int x) { return x * 8; }
+inline int f975_9(int x) { return x * 9; }
+inline int f975_10(int x) { return x * 10; }
+inline int f975_11(int x) { return x * 11; }
+inline int f975_12(int x) { return x * 12; }
+inline int f975_13(int x) { return x * 13; }
+inline int f975_14(int x) { return x * 14; }
+inline int f975_15(int x) { return x * 15; }
+inline int f975_16(int x) { return x * 16; }
+inline int f975_17(int x) { return x * 17; }
+inline int f975_18(int x) { return x * 18; }
+inline int f975_19(int x) { return x * 19; }
+inline int f975_20(int x) { return x * 20; }
+inline int f975_21(int x) { return x * 21; }
+inline int f975_22(int x) { return x * 22; }
+inline int f975_23(int x) { return x * 23; }
+inline int f975_24(int x) { return x * 24; }
+inline int f975_25(int x) { return x * 25; }
+inline int f975_26(int x) { return x * 26; }
+inline int f975_27(int x) { return x * 27; }
+inline int f975_28(int x) { return x * 28; }
+inline int f975_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9750 */
+#include <vector>
+#include "h7627.h"
+#include "h7706.h"
+#include "h325.h"
+#include "h551.h"
+#include "h2767.h"
+#ifdef X
+#include "h8264.h"
+#endif
+struct S9750 { int a; const char *s = "x//y"; };
+inline int f9750_0(int x) { return x * 0; }
+inline int f9750_1(int x) { return x * 1; }
+inline int f9750_2(int x) { return x * 2; }
+inline int f9750_3(int x) { return x * 3; }
+inline int f9750_4(int x) { return x * 4; }
+inline int f9750_5(int x) { return x * 5; }
+inline int f9750_6(int x) { return x * 6; }
+inline int f9750_7(int x) { return x * 7; }
+inline int f9750_8(int x) { return x * 8; }
+inline int f9750_9(int x) { return x * 9; }
+inline int f9750_10(int x) { return x * 10; }
+inline int f9750_11(int x) { return x * 11; }
+inline int f9750_12(int x) { return x * 12; }
+inline int f9750_13(int x) { return x * 13; }
+inline int f9750_14(int x) { return x * 14; }
+inline int f9750_15(int x) { return x * 15; }
+inline int f9750_16(int x) { return x * 16; }
+inline int f9750_17(int x) { return x * 17; }
+inline int f9750_18(int x) { return x * 18; }
+inline int f9750_19(int x) { return x * 19; }
+inline int f9750_20(int x) { return x * 20; }
+inline int f9750_21(int x) { return x * 21; }
+inline int f9750_22(int x) { return x * 22; }
+inline int f9750_23(int x) { return x * 23; }
+inline int f9750_24(int x) { return x * 24; }
+inline int f9750_25(int x) { return x * 25; }
+inline int f9750_26(int x) { return x * 26; }
+inline int f9750_27(int x) { return x * 27; }
+inline int f9750_28(int x) { return x * 28; }
+inline int f9750_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9754 */
+#include <vector>
+#include "h468.h"
+#include "h8718.h"
+#include "h1265.h"
+#include "h8559.h"
+#include "h5307.h"
+#ifdef X
+#include "h5986.h"
+#endif
+struct S9754 { int a; const char *s = "x//y"; };
+inline int f9754_0(int x) { return x * 0; }
+inline int f9754_1(int x) { return x * 1; }
+inline int f9754_2(int x) { return x * 2; }
+inline int f9754_3(int x) { return x * 3; }
+inline int f9754_4(int x) { return x * 4; }
+inline int f9754_5(int x) { return x * 5; }
+inline int f9754_6(int x) { return x * 6; }
+inline int f9754_7(int x) { return x * 7; }
+inline int f9754_8(int x) { return x * 8; }
+inline int f9754_9(int x) { return x * 9; }
+inline int f9754_10(int x) { return x * 10; }
+inline int f9754_11(int x) { return x * 11; }
+inline int f9754_12(int x) { return x * 12; }
+inline int f9754_13(int x) { return x * 13; }
+inline int f9754_14(int x) { return x * 14; }
+inline int f9754_15(int x) { return x * 15; }
+inline int f9754_16(int x) { return x * 16; }
+inline int f9754_17(int x) { return x * 17; }
+inline int f9754_18(int x) { return x * 18; }
+inline int f9754_19(int x) { return x * 19; }
+inline int f9754_20(int x) { return x * 20; }
+inline int f9754_21(int x) { return x * 21; }
+inline int f9754_22(int x) { return x * 22; }
+inline int f9754_23(int x) { return x * 23; }
+inline int f9754_24(int x) { return x * 24; }
+inline int f9754_25(int x) { return x * 25; }
+inline int f9754_26(int x) { return x * 26; }
+inline int f9754_27(int x) { return x * 27; }
+inline int f9754_28(int x) { return x * 28; }
+inline int f9754_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9756 */
+#include <vector>
+#include "h4877.h"
+#include "h1556.h"
+#include "h4803.h"
+#include "h610.h"
+#include "h426.h"
+#ifdef X
+#include "h4800.h"
+#endif
+struct S9756 { int a; const char *s = "x//y"; };
+inline int f9756_0(int x) { return x * 0; }
+inline int f9756_1(int x) { return x * 1; }
+inline int f9756_2(int x) { return x * 2; }
+inline int f9756_3(int x) { return x * 3; }
+inline int f9756_4(int x) { return x * 4; }
+inline int f9756_5(int x) { return x * 5; }
+inline int f9756_6(int x) { return x * 6; }
+inline int f9756_7(int x) { return x * 7; }
+inline int f9756_8(int x) { return x * 8; }
+inline int f9756_9(int x) { return x * 9; }
+inline int f9756_10(int x) { return x * 10; }
+inline int f9756_11(int x) { return x * 11; }
+inline int f9756_12(int x) { return x * 12; }
+inline int f9756_13(int x) { return x * 13; }
+inline int f9756_14(int x) { return x * 14; }
+inline int f9756_15(int x) { return x * 15; }
+inline int f9756_16(int x) { return x * 16; }
+inline int f9756_17(int x) { return x * 17; }
+inline int f9756_18(int x) { return x * 18; }
+inline int f9756_19(int x) { return x * 19; }
+inline int f9756_20(int x) { return x * 20; }
+inline int f9756_21(int x) { return x * 21; }
+inline int f9756_22(int x) { return x * 22; }
+inline int f9756_23(int x) { return x * 23; }
+inline int f9756_24(int x) { return x * 24; }
+inline int f9756_25(int x) { return x * 25; }
+inline int f9756_26(int x) { return x * 26; }
+inline int f9756_27(int x) { return x * 27; }
+inline int f9756_28(int x) { return x * 28; }
+inline int f9756_29(int x) { return x * 29; }
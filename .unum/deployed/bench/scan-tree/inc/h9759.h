@@ -0,0 +1,42 @@
+#pragma once
+/* header 9759 */
+#include <vector>
+#include "h3566.h"
+#include "h1830.h"
+#include "h2635.h"
+#include "h5090.h"
+#include "h4607.h"
+#ifdef X
+#include "h3800.h"
+#endif
+struct S9759 { int a; const char *s = "x//y"; };
+inline int f9759_0(int x) { return x * 0; }
+inline int f9759_1(int x) { return x * 1; }
+inline int f9759_2(int x) { return x * 2; }
+inline int f9759_3(int x) { return x * 3; }
+inline int f9759_4(int x) { return x * 4; }
+inline int f9759_5(int x) { return x * 5; }
+inline int f9759_6(int x) { return x * 6; }
+inline int f9759_7(int x) { return x * 7; }
+inline int f9759_8(int x) { return x * 8; }
+inline int f9759_9(int x) { return x * 9; }
+inline int f9759_10(int x) { return x * 10; }
+inline int f9759_11(int x) { return x * 11; }
+inline int f9759_12(int x) { return x * 12; }
+inline int f9759_13(int x) { return x * 13; }
+inline int f9759_14(int x) { return x * 14; }
+inline int f9759_15(int x) { return x * 15; }
+inline int f9759_16(int x) { return x * 16; }
+inline int f9759_17(int x) { return x * 17; }
+inline int f9759_18(int x) { return x * 18; }
+inline int f9759_19(int x) { return x * 19; }
+inline int f9759_20(int x) { return x * 20; }
+inline int f9759_21(int x) { return x * 21; }
+inline int f9759_22(int x) { return x * 22; }
+inline int f9759_23(int x) { return x * 23; }
+inline int f9759_24(int x) { return x * 24; }
+inline int f9759_25(int x) { return x * 25; }
+inline int f9759_26(int x) { return x * 26; }
+inline int f9759_27(int x) { return x * 27; }
+inline int f9759_28(int x) { return x * 28; }
+inline int f9759_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9760 */
+#include <vector>
+#include "h7231.h"
+#include "h4126.h"
+#include "h9880.h"
+#include "h3604.h"
+#include "h4098.h"
+#ifdef X
+#include "h3828.h"
+#endif
+struct S9760 { int a; const char *s = "x//y"; };
+inline int f9760_0(int x) { return x * 0; }
+inline int f9760_1(int x) { return x * 1; }
+inline int f9760_2(int x) { return x * 2; }
+inline int f9760_3(int x) { return x * 3; }
+inline int f9760_4(int x) { return x * 4; }
+inline int f9760_5(int x) { return x * 5; }
+inline int f9760_6(int x) { return x * 6; }
+inline int f9760_7(int x) { return x * 7; }
+inline int f9760_8(int x) { return x * 8; }
+inline int f9760_9(int x) { return x * 9; }
+inline int f9760_10(int x) { return x * 10; }
+inline int f9760_11(int x) { return x * 11; }
+inline int f9760_12(int x) { return x * 12; }
+inline int f9760_13(int x) { return x * 13; }
+inline int f9760_14(int x) { return x * 14; }
+inline int f9760_15(int x) { return x * 15; }
+inline int f9760_16(int x) { return x * 16; }
+inline int f9760_17(int x) { return x * 17; }
+inline int f9760_18(int x) { return x * 18; }
+inline int f9760_19(int x) { return x * 19; }
+inline int f9760_20(int x) { return x * 20; }
+inline int f9760_21(int x) { return x * 21; }
+inline int f9760_22(int x) { return x * 22; }
+inline int f9760_23(int x) { return x * 23; }
+inline int f9760_24(int x) { return x * 24; }
+inline int f9760_25(int x) { return x * 25; }
+inline int f9760_26(int x) { return x * 26; }
+inline int f9760_27(int x) { return x * 27; }
+inline int f9760_28(int x) { return x * 28; }
+inline int f9760_29(int x) { return x * 29; }
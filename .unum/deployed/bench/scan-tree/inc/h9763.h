@@ -0,0 +1,42 @@
+#pragma once
+/* header 9763 */
+#include <vector>
+#include "h3722.h"
+#include "h3191.h"
+#include "h7023.h"
+#include "h6820.h"
+#include "h9078.h"
+#ifdef X
+#include "h1505.h"
+#endif
+struct S9763 { int a; const char *s = "x//y"; };
+inline int f9763_0(int x) { return x * 0; }
+inline int f9763_1(int x) { return x * 1; }
+inline int f9763_2(int x) { return x * 2; }
+inline int f9763_3(int x) { return x * 3; }
+inline int f9763_4(int x) { return x * 4; }
+inline int f9763_5(int x) { return x * 5; }
+inline int f9763_6(int x) { return x * 6; }
+inline int f9763_7(int x) { return x * 7; }
+inline int f9763_8(int x) { return x * 8; }
+inline int f9763_9(int x) { return x * 9; }
+inline int f9763_10(int x) { return x * 10; }
+inline int f9763_11(int x) { return x * 11; }
+inline int f9763_12(int x) { return x * 12; }
+inline int f9763_13(int x) { return x * 13; }
+inline int f9763_14(int x) { return x * 14; }
+inline int f9763_15(int x) { return x * 15; }
+inline int f9763_16(int x) { return x * 16; }
+inline int f9763_17(int x) { return x * 17; }
+inline int f9763_18(int x) { return x * 18; }
+inline int f9763_19(int x) { return x * 19; }
+inline int f9763_20(int x) { return x * 20; }
+inline int f9763_21(int x) { return x * 21; }
+inline int f9763_22(int x) { return x * 22; }
+inline int f9763_23(int x) { return x * 23; }
+inline int f9763_24(int x) { return x * 24; }
+inline int f9763_25(int x) { return x * 25; }
+inline int f9763_26(int x) { return x * 26; }
+inline int f9763_27(int x) { return x * 27; }
+inline int f9763_28(int x) { return x * 28; }
+inline int f9763_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9765 */
+#include <vector>
+#include "h2493.h"
+#include "h7680.h"
+#include "h6937.h"
+#include "h8515.h"
+#include "h5489.h"
+#ifdef X
+#include "h6994.h"
+#endif
+struct S9765 { int a; const char *s = "x//y"; };
+inline int f9765_0(int x) { return x * 0; }
+inline int f9765_1(int x) { return x * 1; }
+inline int f9765_2(int x) { return x * 2; }
+inline int f9765_3(int x) { return x * 3; }
+inline int f9765_4(int x) { return x * 4; }
+inline int f9765_5(int x) { return x * 5; }
+inline int f9765_6(int x) { return x * 6; }
+inline int f9765_7(int x) { return x * 7; }
+inline int f9765_8(int x) { return x * 8; }
+inline int f9765_9(int x) { return x * 9; }
+inline int f9765_10(int x) { return x * 10; }
+inline int f9765_11(int x) { return x * 11; }
+inline int f9765_12(int x) { return x * 12; }
+inline int f9765_13(int x) { return x * 13; }
+inline int f9765_14(int x) { return x * 14; }
+inline int f9765_15(int x) { return x * 15; }
+inline int f9765_16(int x) { return x * 16; }
+inline int f9765_17(int x) { return x * 17; }
+inline int f9765_18(int x) { return x * 18; }
+inline int f9765_19(int x) { return x * 19; }
+inline int f9765_20(int x) { return x * 20; }
+inline int f9765_21(int x) { return x * 21; }
+inline int f9765_22(int x) { return x * 22; }
+inline int f9765_23(int x) { return x * 23; }
+inline int f9765_24(int x) { return x * 24; }
+inline int f9765_25(int x) { return x * 25; }
+inline int f9765_26(int x) { return x * 26; }
+inline int f9765_27(int x) { return x * 27; }
+inline int f9765_28(int x) { return x * 28; }
+inline int f9765_29(int x) { return x * 29; }
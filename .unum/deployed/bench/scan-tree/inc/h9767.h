@@ -0,0 +1,42 @@
+#pragma once
+/* header 9767 */
+#include <vector>
+#include "h5516.h"
+#include "h755.h"
+#include "h6271.h"
+#include "h3708.h"
+#include "h864.h"
+#ifdef X
+#include "h4898.h"
+#endif
+struct S9767 { int a; const char *s = "x//y"; };
+inline int f9767_0(int x) { return x * 0; }
+inline int f9767_1(int x) { return x * 1; }
+inline int f9767_2(int x) { return x * 2; }
+inline int f9767_3(int x) { return x * 3; }
+inline int f9767_4(int x) { return x * 4; }
+inline int f9767_5(int x) { return x * 5; }
+inline int f9767_6(int x) { return x * 6; }
+inline int f9767_7(int x) { return x * 7; }
+inline int f9767_8(int x) { return x * 8; }
+inline int f9767_9(int x) { return x * 9; }
+inline int f9767_10(int x) { return x * 10; }
+inline int f9767_11(int x) { return x * 11; }
+inline int f9767_12(int x) { return x * 12; }
+inline int f9767_13(int x) { return x * 13; }
+inline int f9767_14(int x) { return x * 14; }
+inline int f9767_15(int x) { return x * 15; }
+inline int f9767_16(int x) { return x * 16; }
+inline int f9767_17(int x) { return x * 17; }
+inline int f9767_18(int x) { return x * 18; }
+inline int f9767_19(int x) { return x * 19; }
+inline int f9767_20(int x) { return x * 20; }
+inline int f9767_21(int x) { return x * 21; }
+inline int f9767_22(int x) { return x * 22; }
+inline int f9767_23(int x) { return x * 23; }
+inline int f9767_24(int x) { return x * 24; }
+inline int f9767_25(int x) { return x * 25; }
+inline int f9767_26(int x) { return x * 26; }
+inline int f9767_27(int x) { return x * 27; }
+inline int f9767_28(int x) { return x * 28; }
+inline int f9767_29(int x) { return x * 29; }
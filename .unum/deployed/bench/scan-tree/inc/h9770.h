@@ -0,0 +1,42 @@
+#pragma once
+/* header 9770 */
+#include <vector>
+#include "h6574.h"
+#include "h2895.h"
+#include "h1805.h"
+#include "h6426.h"
+#include "h7083.h"
+#ifdef X
+#include "h2110.h"
+#endif
+struct S9770 { int a; const char *s = "x//y"; };
+inline int f9770_0(int x) { return x * 0; }
+inline int f9770_1(int x) { return x * 1; }
+inline int f9770_2(int x) { return x * 2; }
+inline int f9770_3(int x) { return x * 3; }
+inline int f9770_4(int x) { return x * 4; }
+inline int f9770_5(int x) { return x * 5; }
+inline int f9770_6(int x) { return x * 6; }
+inline int f9770_7(int x) { return x * 7; }
+inline int f9770_8(int x) { return x * 8; }
+inline int f9770_9(int x) { return x * 9; }
+inline int f9770_10(int x) { return x * 10; }
+inline int f9770_11(int x) { return x * 11; }
+inline int f9770_12(int x) { return x * 12; }
+inline int f9770_13(int x) { return x * 13; }
+inline int f9770_14(int x) { return x * 14; }
+inline int f9770_15(int x) { return x * 15; }
+inline int f9770_16(int x) { return x * 16; }
+inline int f9770_17(int x) { return x * 17; }
+inline int f9770_18(int x) { return x * 18; }
+inline int f9770_19(int x) { return x * 19; }
+inline int f9770_20(int x) { return x * 20; }
+inline int f9770_21(int x) { return x * 21; }
+inline int f9770_22(int x) { return x * 22; }
+inline int f9770_23(int x) { return x * 23; }
+inline int f9770_24(int x) { return x * 24; }
+inline int f9770_25(int x) { return x * 25; }
+inline int f9770_26(int x) { return x * 26; }
+inline int f9770_27(int x) { return x * 27; }
+inline int f9770_28(int x) { return x * 28; }
+inline int f9770_29(int x) { return x * 29; }
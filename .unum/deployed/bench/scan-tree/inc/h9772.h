@@ -0,0 +1,42 @@
+#pragma once
+/* header 9772 */
+#include <vector>
+#include "h4632.h"
+#include "h7010.h"
+#include "h6373.h"
+#include "h8489.h"
+#include "h2831.h"
+#ifdef X
+#include "h5928.h"
+#endif
+struct S9772 { int a; const char *s = "x//y"; };
+inline int f9772_0(int x) { return x * 0; }
+inline int f9772_1(int x) { return x * 1; }
+inline int f9772_2(int x) { return x * 2; }
+inline int f9772_3(int x) { return x * 3; }
+inline int f9772_4(int x) { return x * 4; }
+inline int f9772_5(int x) { return x * 5; }
+inline int f9772_6(int x) { return x * 6; }
+inline int f9772_7(int x) { return x * 7; }
+inline int f9772_8(int x) { return x * 8; }
+inline int f9772_9(int x) { return x * 9; }
+inline int f9772_10(int x) { return x * 10; }
+inline int f9772_11(int x) { return x * 11; }
+inline int f9772_12(int x) { return x * 12; }
+inline int f9772_13(int x) { return x * 13; }
+inline int f9772_14(int x) { return x * 14; }
+inline int f9772_15(int x) { return x * 15; }
+inline int f9772_16(int x) { return x * 16; }
+inline int f9772_17(int x) { return x * 17; }
+inline int f9772_18(int x) { return x * 18; }
+inline int f9772_19(int x) { return x * 19; }
+inline int f9772_20(int x) { return x * 20; }
+inline int f9772_21(int x) { return x * 21; }
+inline int f9772_22(int x) { return x * 22; }
+inline int f9772_23(int x) { return x * 23; }
+inline int f9772_24(int x) { return x * 24; }
+inline int f9772_25(int x) { return x * 25; }
+inline int f9772_26(int x) { return x * 26; }
+inline int f9772_27(int x) { return x * 27; }
+inline int f9772_28(int x) { return x * 28; }
+inline int f9772_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9774 */
+#include <vector>
+#include "h4786.h"
+#include "h5250.h"
+#include "h2126.h"
+#include "h5024.h"
+#include "h9045.h"
+#ifdef X
+#include "h5057.h"
+#endif
+struct S9774 { int a; const char *s = "x//y"; };
+inline int f9774_0(int x) { return x * 0; }
+inline int f9774_1(int x) { return x * 1; }
+inline int f9774_2(int x) { return x * 2; }
+inline int f9774_3(int x) { return x * 3; }
+inline int f9774_4(int x) { return x * 4; }
+inline int f9774_5(int x) { return x * 5; }
+inline int f9774_6(int x) { return x * 6; }
+inline int f9774_7(int x) { return x * 7; }
+inline int f9774_8(int x) { return x * 8; }
+inline int f9774_9(int x) { return x * 9; }
+inline int f9774_10(int x) { return x * 10; }
+inline int f9774_11(int x) { return x * 11; }
+inline int f9774_12(int x) { return x * 12; }
+inline int f9774_13(int x) { return x * 13; }
+inline int f9774_14(int x) { return x * 14; }
+inline int f9774_15(int x) { return x * 15; }
+inline int f9774_16(int x) { return x * 16; }
+inline int f9774_17(int x) { return x * 17; }
+inline int f9774_18(int x) { return x * 18; }
+inline int f9774_19(int x) { return x * 19; }
+inline int f9774_20(int x) { return x * 20; }
+inline int f9774_21(int x) { return x * 21; }
+inline int f9774_22(int x) { return x * 22; }
+inline int f9774_23(int x) { return x * 23; }
+inline int f9774_24(int x) { return x * 24; }
+inline int f9774_25(int x) { return x * 25; }
+inline int f9774_26(int x) { return x * 26; }
+inline int f9774_27(int x) { return x * 27; }
+inline int f9774_28(int x) { return x * 28; }
+inline int f9774_29(int x) { return x * 29; }
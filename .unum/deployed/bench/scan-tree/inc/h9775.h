@@ -0,0 +1,42 @@
+#pragma once
+/* header 9775 */
+#include <vector>
+#include "h236.h"
+#include "h5568.h"
+#include "h4907.h"
+#include "h3985.h"
+#include "h2711.h"
+#ifdef X
+#include "h1147.h"
+#endif
+struct S9775 { int a; const char *s = "x//y"; };
+inline int f9775_0(int x) { return x * 0; }
+inline int f9775_1(int x) { return x * 1; }
+inline int f9775_2(int x) { return x * 2; }
+inline int f9775_3(int x) { return x * 3; }
+inline int f9775_4(int x) { return x * 4; }
+inline int f9775_5(int x) { return x * 5; }
+inline int f9775_6(int x) { return x * 6; }
+inline int f9775_7(int x) { return x * 7; }
+inline int f9775_8(int x) { return x * 8; }
+inline int f9775_9(int x) { return x * 9; }
+inline int f9775_10(int x) { return x * 10; }
+inline int f9775_11(int x) { return x * 11; }
+inline int f9775_12(int x) { return x * 12; }
+inline int f9775_13(int x) { return x * 13; }
+inline int f9775_14(int x) { return x * 14; }
+inline int f9775_15(int x) { return x * 15; }
+inline int f9775_16(int x) { return x * 16; }
+inline int f9775_17(int x) { return x * 17; }
+inline int f9775_18(int x) { return x * 18; }
+inline int f9775_19(int x) { return x * 19; }
+inline int f9775_20(int x) { return x * 20; }
+inline int f9775_21(int x) { return x * 21; }
+inline int f9775_22(int x) { return x * 22; }
+inline int f9775_23(int x) { return x * 23; }
+inline int f9775_24(int x) { return x * 24; }
+inline int f9775_25(int x) { return x * 25; }
+inline int f9775_26(int x) { return x * 26; }
+inline int f9775_27(int x) { return x * 27; }
+inline int f9775_28(int x) { return x * 28; }
+inline int f9775_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9779 */
+#include <vector>
+#include "h4377.h"
+#include "h2314.h"
+#include "h9469.h"
+#include "h7826.h"
+#include "h2562.h"
+#ifdef X
+#include "h2224.h"
+#endif
+struct S9779 { int a; const char *s = "x//y"; };
+inline int f9779_0(int x) { return x * 0; }
+inline int f9779_1(int x) { return x * 1; }
+inline int f9779_2(int x) { return x * 2; }
+inline int f9779_3(int x) { return x * 3; }
+inline int f9779_4(int x) { return x * 4; }
+inline int f9779_5(int x) { return x * 5; }
+inline int f9779_6(int x) { return x * 6; }
+inline int f9779_7(int x) { return x * 7; }
+inline int f9779_8(int x) { return x * 8; }
+inline int f9779_9(int x) { return x * 9; }
+inline int f9779_10(int x) { return x * 10; }
+inline int f9779_11(int x) { return x * 11; }
+inline int f9779_12(int x) { return x * 12; }
+inline int f9779_13(int x) { return x * 13; }
+inline int f9779_14(int x) { return x * 14; }
+inline int f9779_15(int x) { return x * 15; }
+inline int f9779_16(int x) { return x * 16; }
+inline int f9779_17(int x) { return x * 17; }
+inline int f9779_18(int x) { return x * 18; }
+inline int f9779_19(int x) { return x * 19; }
+inline int f9779_20(int x) { return x * 20; }
+inline int f9779_21(int x) { return x * 21; }
+inline int f9779_22(int x) { return x * 22; }
+inline int f9779_23(int x) { return x * 23; }
+inline int f9779_24(int x) { return x * 24; }
+inline int f9779_25(int x) { return x * 25; }
+inline int f9779_26(int x) { return x * 26; }
+inline int f9779_27(int x) { return x * 27; }
+inline int f9779_28(int x) { return x * 28; }
+inline int f9779_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9783 */
+#include <vector>
+#include "h2506.h"
+#include "h474.h"
+#include "h652.h"
+#include "h3457.h"
+#include "h2299.h"
+#ifdef X
+#include "h2650.h"
+#endif
+struct S9783 { int a; const char *s = "x//y"; };
+inline int f9783_0(int x) { return x * 0; }
+inline int f9783_1(int x) { return x * 1; }
+inline int f9783_2(int x) { return x * 2; }
+inline int f9783_3(int x) { return x * 3; }
+inline int f9783_4(int x) { return x * 4; }
+inline int f9783_5(int x) { return x * 5; }
+inline int f9783_6(int x) { return x * 6; }
+inline int f9783_7(int x) { return x * 7; }
+inline int f9783_8(int x) { return x * 8; }
+inline int f9783_9(int x) { return x * 9; }
+inline int f9783_10(int x) { return x * 10; }
+inline int f9783_11(int x) { return x * 11; }
+inline int f9783_12(int x) { return x * 12; }
+inline int f9783_13(int x) { return x * 13; }
+inline int f9783_14(int x) { return x * 14; }
+inline int f9783_15(int x) { return x * 15; }
+inline int f9783_16(int x) { return x * 16; }
+inline int f9783_17(int x) { return x * 17; }
+inline int f9783_18(int x) { return x * 18; }
+inline int f9783_19(int x) { return x * 19; }
+inline int f9783_20(int x) { return x * 20; }
+inline int f9783_21(int x) { return x * 21; }
+inline int f9783_22(int x) { return x * 22; }
+inline int f9783_23(int x) { return x * 23; }
+inline int f9783_24(int x) { return x * 24; }
+inline int f9783_25(int x) { return x * 25; }
+inline int f9783_26(int x) { return x * 26; }
+inline int f9783_27(int x) { return x * 27; }
+inline int f9783_28(int x) { return x * 28; }
+inline int f9783_29(int x) { return x * 29; }
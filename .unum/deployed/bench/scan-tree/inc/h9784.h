@@ -0,0 +1,42 @@
+#pragma once
+/* header 9784 */
+#include <vector>
+#include "h1557.h"
+#include "h6985.h"
+#include "h9048.h"
+#include "h8953.h"
+#include "h3727.h"
+#ifdef X
+#include "h3308.h"
+#endif
+struct S9784 { int a; const char *s = "x//y"; };
+inline int f9784_0(int x) { return x * 0; }
+inline int f9784_1(int x) { return x * 1; }
+inline int f9784_2(int x) { return x * 2; }
+inline int f9784_3(int x) { return x * 3; }
+inline int f9784_4(int x) { return x * 4; }
+inline int f9784_5(int x) { return x * 5; }
+inline int f9784_6(int x) { return x * 6; }
+inline int f9784_7(int x) { return x * 7; }
+inline int f9784_8(int x) { return x * 8; }
+inline int f9784_9(int x) { return x * 9; }
+inline int f9784_10(int x) { return x * 10; }
+inline int f9784_11(int x) { return x * 11; }
+inline int f9784_12(int x) { return x * 12; }
+inline int f9784_13(int x) { return x * 13; }
+inline int f9784_14(int x) { return x * 14; }
+inline int f9784_15(int x) { return x * 15; }
+inline int f9784_16(int x) { return x * 16; }
+inline int f9784_17(int x) { return x * 17; }
+inline int f9784_18(int x) { return x * 18; }
+inline int f9784_19(int x) { return x * 19; }
+inline int f9784_20(int x) { return x * 20; }
+inline int f9784_21(int x) { return x * 21; }
+inline int f9784_22(int x) { return x * 22; }
+inline int f9784_23(int x) { return x * 23; }
+inline int f9784_24(int x) { return x * 24; }
+inline int f9784_25(int x) { return x * 25; }
+inline int f9784_26(int x) { return x * 26; }
+inline int f9784_27(int x) { return x * 27; }
+inline int f9784_28(int x) { return x * 28; }
+inline int f9784_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 979 */
+#include <vector>
+#include "h620.h"
+#include "h1115.h"
+#include "h9253.h"
+#include "h488.h"
+#include "h103.h"
+#ifdef X
+#include "h7789.h"
+#endif
+struct S979 { int a; const char *s = "x//y"; };
+inline int f979_0(int x) { return x * 0; }
+inline int f979_1(int x) { return x * 1; }
+inline int f979_2(int x) { return x * 2; }
+inline int f979_3(int x) { return x * 3; }
+inline int f979_4(int x) { return x * 4; }
+inline int f979_5(int x) { return x * 5; }
+inline int f979_6(int x) { return x * 6; }
+inline int f979_7(int x) { return x * 7; }
+inline int f979_8(int x) { return x * 8; }
+inline int f979_9(int x) { return x * 9; }
+inline int f979_10(int x) { return x * 10; }
+inline int f979_11(int x) { return x * 11; }
+inline int f979_12(int x) { return x * 12; }
+inline int f979_13(int x) { return x * 13; }
+inline int f979_14(int x) { return x * 14; }
+inline int f979_15(int x) { return x * 15; }
+inline int f979_16(int x) { return x * 16; }
+inline int f979_17(int x) { return x * 17; }
+inline int f979_18(int x) { return x * 18; }
+inline int f979_19(int x) { return x * 19; }
+inline int f979_20(int x) { return x * 20; }
+inline int f979_21(int x) { return x * 21; }
+inline int f979_22(int x) { return x * 22; }
+inline int f979_23(int x) { return x * 23; }
+inline int f979_24(int x) { return x * 24; }
+inline int f979_25(int x) { return x * 25; }
+inline int f979_26(int x) { return x * 26; }
+inline int f979_27(int x) { return x * 27; }
+inline int f979_28(int x) { return x * 28; }
+inline int f979_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9790 */
+#include <vector>
+#include "h1813.h"
+#include "h3565.h"
+#include "h3569.h"
+#include "h7135.h"
+#include "h8724.h"
+#ifdef X
+#include "h4421.h"
+#endif
+struct S9790 { int a; const char *s = "x//y"; };
+inline int f9790_0(int x) { return x * 0; }
+inline int f9790_1(int x) { return x * 1; }
+inline int f9790_2(int x) { return x * 2; }
+inline int f9790_3(int x) { return x * 3; }
+inline int f9790_4(int x) { return x * 4; }
+inline int f9790_5(int x) { return x * 5; }
+inline int f9790_6(int x) { return x * 6; }
+inline int f9790_7(int x) { return x * 7; }
+inline int f9790_8(int x) { return x * 8; }
+inline int f9790_9(int x) { return x * 9; }
+inline int f9790_10(int x) { return x * 10; }
+inline int f9790_11(int x) { return x * 11; }
+inline int f9790_12(int x) { return x * 12; }
+inline int f9790_13(int x) { return x * 13; }
+inline int f9790_14(int x) { return x * 14; }
+inline int f9790_15(int x) { return x * 15; }
+inline int f9790_16(int x) { return x * 16; }
+inline int f9790_17(int x) { return x * 17; }
+inline int f9790_18(int x) { return x * 18; }
+inline int f9790_19(int x) { return x * 19; }
+inline int f9790_20(int x) { return x * 20; }
+inline int f9790_21(int x) { return x * 21; }
+inline int f9790_22(int x) { return x * 22; }
+inline int f9790_23(int x) { return x * 23; }
+inline int f9790_24(int x) { return x * 24; }
+inline int f9790_25(int x) { return x * 25; }
+inline int f9790_26(int x) { return x * 26; }
+inline int f9790_27(int x) { return x * 27; }
+inline int f9790_28(int x) { return x * 28; }
+inline int f9790_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9791 */
+#include <vector>
+#include "h4463.h"
+#include "h1468.h"
+#include "h8321.h"
+#include "h4694.h"
+#include "h3025.h"
+#ifdef X
+#include "h6851.h"
+#endif
+struct S9791 { int a; const char *s = "x//y"; };
+inline int f9791_0(int x) { return x * 0; }
+inline int f9791_1(int x) { return x * 1; }
+inline int f9791_2(int x) { return x * 2; }
+inline int f9791_3(int x) { return x * 3; }
+inline int f9791_4(int x) { return x * 4; }
+inline int f9791_5(int x) { return x * 5; }
+inline int f9791_6(int x) { return x * 6; }
+inline int f9791_7(int x) { return x * 7; }
+inline int f9791_8(int x) { return x * 8; }
+inline int f9791_9(int x) { return x * 9; }
+inline int f9791_10(int x) { return x * 10; }
+inline int f9791_11(int x) { return x * 11; }
+inline int f9791_12(int x) { return x * 12; }
+inline int f9791_13(int x) { return x * 13; }
+inline int f9791_14(int x) { return x * 14; }
+inline int f9791_15(int x) { return x * 15; }
+inline int f9791_16(int x) { return x * 16; }
+inline int f9791_17(int x) { return x * 17; }
+inline int f9791_18(int x) { return x * 18; }
+inline int f9791_19(int x) { return x * 19; }
+inline int f9791_20(int x) { return x * 20; }
+inline int f9791_21(int x) { return x * 21; }
+inline int f9791_22(int x) { return x * 22; }
+inline int f9791_23(int x) { return x * 23; }
+inline int f9791_24(int x) { return x * 24; }
+inline int f9791_25(int x) { return x * 25; }
+inline int f9791_26(int x) { return x * 26; }
+inline int f9791_27(int x) { return x * 27; }
+inline int f9791_28(int x) { return x * 28; }
+inline int f9791_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9796 */
+#include <vector>
+#include "h6995.h"
+#include "h8050.h"
+#include "h5994.h"
+#include "h8260.h"
+#include "h3159.h"
+#ifdef X
+#include "h5927.h"
+#endif
+struct S9796 { int a; const char *s = "x//y"; };
+inline int f9796_0(int x) { return x * 0; }
+inline int f9796_1(int x) { return x * 1; }
+inline int f9796_2(int x) { return x * 2; }
+inline int f9796_3(int x) { return x * 3; }
+inline int f9796_4(int x) { return x * 4; }
+inline int f9796_5(int x) { return x * 5; }
+inline int f9796_6(int x) { return x * 6; }
+inline int f9796_7(int x) { return x * 7; }
+inline int f9796_8(int x) { return x * 8; }
+inline int f9796_9(int x) { return x * 9; }
+inline int f9796_10(int x) { return x * 10; }
+inline int f9796_11(int x) { return x * 11; }
+inline int f9796_12(int x) { return x * 12; }
+inline int f9796_13(int x) { return x * 13; }
+inline int f9796_14(int x) { return x * 14; }
+inline int f9796_15(int x) { return x * 15; }
+inline int f9796_16(int x) { return x * 16; }
+inline int f9796_17(int x) { return x * 17; }
+inline int f9796_18(int x) { return x * 18; }
+inline int f9796_19(int x) { return x * 19; }
+inline int f9796_20(int x) { return x * 20; }
+inline int f9796_21(int x) { return x * 21; }
+inline int f9796_22(int x) { return x * 22; }
+inline int f9796_23(int x) { return x * 23; }
+inline int f9796_24(int x) { return x * 24; }
+inline int f9796_25(int x) { return x * 25; }
+inline int f9796_26(int x) { return x * 26; }
+inline int f9796_27(int x) { return x * 27; }
+inline int f9796_28(int x) { return x * 28; }
+inline int f9796_29(int x) { return x * 29; }
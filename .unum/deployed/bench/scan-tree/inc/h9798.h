@@ -0,0 +1,42 @@
+#pragma once
+/* header 9798 */
+#include <vector>
+#include "h6771.h"
+#include "h3396.h"
+#include "h5212.h"
+#include "h8833.h"
+#include "h5246.h"
+#ifdef X
+#include "h477.h"
+#endif
+struct S9798 { int a; const char *s = "x//y"; };
+inline int f9798_0(int x) { return x * 0; }
+inline int f9798_1(int x) { return x * 1; }
+inline int f9798_2(int x) { return x * 2; }
+inline int f9798_3(int x) { return x * 3; }
+inline int f9798_4(int x) { return x * 4; }
+inline int f9798_5(int x) { return x * 5; }
+inline int f9798_6(int x) { return x * 6; }
+inline int f9798_7(int x) { return x * 7; }
+inline int f9798_8(int x) { return x * 8; }
+inline int f9798_9(int x) { return x * 9; }
+inline int f9798_10(int x) { return x * 10; }
+inline int f9798_11(int x) { return x * 11; }
+inline int f9798_12(int x) { return x * 12; }
+inline int f9798_13(int x) { return x * 13; }
+inline int f9798_14(int x) { return x * 14; }
+inline int f9798_15(int x) { return x * 15; }
+inline int f9798_16(int x) { return x * 16; }
+inline int f9798_17(int x) { return x * 17; }
+inline int f9798_18(int x) { return x * 18; }
+inline int f9798_19(int x) { return x * 19; }
+inline int f9798_20(int x) { return x * 20; }
+inline int f9798_21(int x) { return x * 21; }
+inline int f9798_22(int x) { return x * 22; }
+inline int f9798_23(int x) { return x * 23; }
+inline int f9798_24(int x) { return x * 24; }
+inline int f9798_25(int x) { return x * 25; }
+inline int f9798_26(int x) { return x * 26; }
+inline int f9798_27(int x) { return x * 27; }
+inline int f9798_28(int x) { return x * 28; }
+inline int f9798_29(int x) { return x * 29; }
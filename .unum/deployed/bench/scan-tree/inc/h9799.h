@@ -0,0 +1,42 @@
+#pragma once
+/* header 9799 */
+#include <vector>
+#include "h868.h"
+#include "h1593.h"
+#include "h2828.h"
+#include "h5141.h"
+#include "h6634.h"
+#ifdef X
+#include "h1110.h"
+#endif
+struct S9799 { int a; const char *s = "x//y"; };
+inline int f9799_0(int x) { return x * 0; }
+inline int f9799_1(int x) { return x * 1; }
+inline int f9799_2(int x) { return x * 2; }
+inline int f9799_3(int x) { return x * 3; }
+inline int f9799_4(int x) { return x * 4; }
+inline int f9799_5(int x) { return x * 5; }
+inline int f9799_6(int x) { return x * 6; }
+inline int f9799_7(int x) { return x * 7; }
+inline int f9799_8(int x) { return x * 8; }
+inline int f9799_9(int x) { return x * 9; }
+inline int f9799_10(int x) { return x * 10; }
+inline int f9799_11(int x) { return x * 11; }
+inline int f9799_12(int x) { return x * 12; }
+inline int f9799_13(int x) { return x * 13; }
+inline int f9799_14(int x) { return x * 14; }
+inline int f9799_15(int x) { return x * 15; }
+inline int f9799_16(int x) { return x * 16; }
+inline int f9799_17(int x) { return x * 17; }
+inline int f9799_18(int x) { return x * 18; }
+inline int f9799_19(int x) { return x * 19; }
+inline int f9799_20(int x) { return x * 20; }
+inline int f9799_21(int x) { return x * 21; }
+inline int f9799_22(int x) { return x * 22; }
+inline int f9799_23(int x) { return x * 23; }
+inline int f9799_24(int x) { return x * 24; }
+inline int f9799_25(int x) { return x * 25; }
+inline int f9799_26(int x) { return x * 26; }
+inline int f9799_27(int x) { return x * 27; }
+inline int f9799_28(int x) { return x * 28; }
+inline int f9799_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 98 */
+#include <vector>
+#include "h8684.h"
+#include "h6857.h"
+#include "h1133.h"
+#include "h6140.h"
+#include "h6315.h"
+#ifdef X
+#include "h2025.h"
+#endif
+struct S98 { int a; const char *s = "x//y"; };
+inline int f98_0(int x) { return x * 0; }
+inline int f98_1(int x) { return x * 1; }
+inline int f98_2(int x) { return x * 2; }
+inline int f98_3(int x) { return x * 3; }
+inline int f98_4(int x) { return x * 4; }
+inline int f98_5(int x) { return x * 5; }
+inline int f98_6(int x) { return x * 6; }
+inline int f98_7(int x) { return x * 7; }
+inline int f98_8(int x) { return x * 8; }
+inline int f98_9(int x) { return x * 9; }
+inline int f98_10(int x) { return x * 10; }
+inline int f98_11(int x) { return x * 11; }
+inline int f98_12(int x) { return x * 12; }
+inline int f98_13(int x) { return x * 13; }
+inline int f98_14(int x) { return x * 14; }
+inline int f98_15(int x) { return x * 15; }
+inline int f98_16(int x) { return x * 16; }
+inline int f98_17(int x) { return x * 17; }
+inline int f98_18(int x) { return x * 18; }
+inline int f98_19(int x) { return x * 19; }
+inline int f98_20(int x) { return x * 20; }
+inline int f98_21(int x) { return x * 21; }
+inline int f98_22(int x) { return x * 22; }
+inline int f98_23(int x) { return x * 23; }
+inline int f98_24(int x) { return x * 24; }
+inline int f98_25(int x) { return x * 25; }
+inline int f98_26(int x) { return x * 26; }
+inline int f98_27(int x) { return x * 27; }
+inline int f98_28(int x) { return x * 28; }
+inline int f98_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 980 */
+#include <vector>
+#include "h588.h"
+#include "h8221.h"
+#include "h5204.h"
+#include "h8957.h"
+#include "h930.h"
+#ifdef X
+#include "h5213.h"
+#endif
+struct S980 { int a; const char *s = "x//y"; };
+inline int f980_0(int x) { return x * 0; }
+inline int f980_1(int x) { return x * 1; }
+inline int f980_2(int x) { return x * 2; }
+inline int f980_3(int x) { return x * 3; }
+inline int f980_4(int x) { return x * 4; }
+inline int f980_5(int x) { return x * 5; }
+inline int f980_6(int x) { return x * 6; }
+inline int f980_7(int x) { return x * 7; }
+inline int f980_8(int x) { return x * 8; }
+inline int f980_9(int x) { return x * 9; }
+inline int f980_10(int x) { return x * 10; }
+inline int f980_11(int x) { return x * 11; }
+inline int f980_12(int x) { return x * 12; }
+inline int f980_13(int x) { return x * 13; }
+inline int f980_14(int x) { return x * 14; }
+inline int f980_15(int x) { return x * 15; }
+inline int f980_16(int x) { return x * 16; }
+inline int f980_17(int x) { return x * 17; }
+inline int f980_18(int x) { return x * 18; }
+inline int f980_19(int x) { return x * 19; }
+inline int f980_20(int x) { return x * 20; }
+inline int f980_21(int x) { return x * 21; }
+inline int f980_22(int x) { return x * 22; }
+inline int f980_23(int x) { return x * 23; }
+inline int f980_24(int x) { return x * 24; }
+inline int f980_25(int x) { return x * 25; }
+inline int f980_26(int x) { return x * 26; }
+inline int f980_27(int x) { return x * 27; }
+inline int f980_28(int x) { return x * 28; }
+inline int f980_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9800 */
+#include <vector>
+#include "h1496.h"
+#include "h7009.h"
+#include "h5055.h"
+#include "h6559.h"
+#include "h5970.h"
+#ifdef X
+#include "h6402.h"
+#endif
+struct S9800 { int a; const char *s = "x//y"; };
+inline int f9800_0(int x) { return x * 0; }
+inline int f9800_1(int x) { return x * 1; }
+inline int f9800_2(int x) { return x * 2; }
+inline int f9800_3(int x) { return x * 3; }
+inline int f9800_4(int x) { return x * 4; }
+inline int f9800_5(int x) { return x * 5; }
+inline int f9800_6(int x) { return x * 6; }
+inline int f9800_7(int x) { return x * 7; }
+inline int f9800_8(int x) { return x * 8; }
+inline int f9800_9(int x) { return x * 9; }
+inline int f9800_10(int x) { return x * 10; }
+inline int f9800_11(int x) { return x * 11; }
+inline int f9800_12(int x) { return x * 12; }
+inline int f9800_13(int x) { return x * 13; }
+inline int f9800_14(int x) { return x * 14; }
+inline int f9800_15(int x) { return x * 15; }
+inline int f9800_16(int x) { return x * 16; }
+inline int f9800_17(int x) { return x * 17; }
+inline int f9800_18(int x) { return x * 18; }
+inline int f9800_19(int x) { return x * 19; }
+inline int f9800_20(int x) { return x * 20; }
+inline int f9800_21(int x) { return x * 21; }
+inline int f9800_22(int x) { return x * 22; }
+inline int f9800_23(int x) { return x * 23; }
+inline int f9800_24(int x) { return x * 24; }
+inline int f9800_25(int x) { return x * 25; }
+inline int f9800_26(int x) { return x * 26; }
+inline int f9800_27(int x) { return x * 27; }
+inline int f9800_28(int x) { return x * 28; }
+inline int f9800_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9805 */
+#include <vector>
+#include "h5858.h"
+#include "h9605.h"
+#include "h6768.h"
+#include "h6387.h"
+#include "h8708.h"
+#ifdef X
+#include "h4611.h"
+#endif
+struct S9805 { int a; const char *s = "x//y"; };
+inline int f9805_0(int x) { return x * 0; }
+inline int f9805_1(int x) { return x * 1; }
+inline int f9805_2(int x) { return x * 2; }
+inline int f9805_3(int x) { return x * 3; }
+inline int f9805_4(int x) { return x * 4; }
+inline int f9805_5(int x) { return x * 5; }
+inline int f9805_6(int x) { return x * 6; }
+inline int f9805_7(int x) { return x * 7; }
+inline int f9805_8(int x) { return x * 8; }
+inline int f9805_9(int x) { return x * 9; }
+inline int f9805_10(int x) { return x * 10; }
+inline int f9805_11(int x) { return x * 11; }
+inline int f9805_12(int x) { return x * 12; }
+inline int f9805_13(int x) { return x * 13; }
+inline int f9805_14(int x) { return x * 14; }
+inline int f9805_15(int x) { return x * 15; }
+inline int f9805_16(int x) { return x * 16; }
+inline int f9805_17(int x) { return x * 17; }
+inline int f9805_18(int x) { return x * 18; }
+inline int f9805_19(int x) { return x * 19; }
+inline int f9805_20(int x) { return x * 20; }
+inline int f9805_21(int x) { return x * 21; }
+inline int f9805_22(int x) { return x * 22; }
+inline int f9805_23(int x) { return x * 23; }
+inline int f9805_24(int x) { return x * 24; }
+inline int f9805_25(int x) { return x * 25; }
+inline int f9805_26(int x) { return x * 26; }
+inline int f9805_27(int x) { return x * 27; }
+inline int f9805_28(int x) { return x * 28; }
+inline int f9805_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9809 */
+#include <vector>
+#include "h3634.h"
+#include "h9080.h"
+#include "h2736.h"
+#include "h428.h"
+#include "h7601.h"
+#ifdef X
+#include "h1762.h"
+#endif
+struct S9809 { int a; const char *s = "x//y"; };
+inline int f9809_0(int x) { return x * 0; }
+inline int f9809_1(int x) { return x * 1; }
+inline int f9809_2(int x) { return x * 2; }
+inline int f9809_3(int x) { return x * 3; }
+inline int f9809_4(int x) { return x * 4; }
+inline int f9809_5(int x) { return x * 5; }
+inline int f9809_6(int x) { return x * 6; }
+inline int f9809_7(int x) { return x * 7; }
+inline int f9809_8(int x) { return x * 8; }
+inline int f9809_9(int x) { return x * 9; }
+inline int f9809_10(int x) { return x * 10; }
+inline int f9809_11(int x) { return x * 11; }
+inline int f9809_12(int x) { return x * 12; }
+inline int f9809_13(int x) { return x * 13; }
+inline int f9809_14(int x) { return x * 14; }
+inline int f9809_15(int x) { return x * 15; }
+inline int f9809_16(int x) { return x * 16; }
+inline int f9809_17(int x) { return x * 17; }
+inline int f9809_18(int x) { return x * 18; }
+inline int f9809_19(int x) { return x * 19; }
+inline int f9809_20(int x) { return x * 20; }
+inline int f9809_21(int x) { return x * 21; }
+inline int f9809_22(int x) { return x * 22; }
+inline int f9809_23(int x) { return x * 23; }
+inline int f9809_24(int x) { return x * 24; }
+inline int f9809_25(int x) { return x * 25; }
+inline int f9809_26(int x) { return x * 26; }
+inline int f9809_27(int x) { return x * 27; }
+inline int f9809_28(int x) { return x * 28; }
+inline int f9809_29(int x) { return x * 29; }
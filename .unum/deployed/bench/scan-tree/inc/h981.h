@@ -0,0 +1,42 @@
+#pragma once
+/* header 981 */
+#include <vector>
+#include "h889.h"
+#include "h6281.h"
+#include "h8663.h"
+#include "h7606.h"
+#include "h3394.h"
+#ifdef X
+#include "h7444.h"
+#endif
+struct S981 { int a; const char *s = "x//y"; };
+inline int f981_0(int x) { return x * 0; }
+inline int f981_1(int x) { return x * 1; }
+inline int f981_2(int x) { return x * 2; }
+inline int f981_3(int x) { return x * 3; }
+inline int f981_4(int x) { return x * 4; }
+inline int f981_5(int x) { return x * 5; }
+inline int f981_6(int x) { return x * 6; }
+inline int f981_7(int x) { return x * 7; }
+inline int f981_8(int x) { return x * 8; }
+inline int f981_9(int x) { return x * 9; }
+inline int f981_10(int x) { return x * 10; }
+inline int f981_11(int x) { return x * 11; }
+inline int f981_12(int x) { return x * 12; }
+inline int f981_13(int x) { return x * 13; }
+inline int f981_14(int x) { return x * 14; }
+inline int f981_15(int x) { return x * 15; }
+inline int f981_16(int x) { return x * 16; }
+inline int f981_17(int x) { return x * 17; }
+inline int f981_18(int x) { return x * 18; }
+inline int f981_19(int x) { return x * 19; }
+inline int f981_20(int x) { return x * 20; }
+inline int f981_21(int x) { return x * 21; }
+inline int f981_22(int x) { return x * 22; }
+inline int f981_23(int x) { return x * 23; }
+inline int f981_24(int x) { return x * 24; }
+inline int f981_25(int x) { return x * 25; }
+inline int f981_26(int x) { return x * 26; }
+inline int f981_27(int x) { return x * 27; }
+inline int f981_28(int x) { return x * 28; }
+inline int f981_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9814 */
+#include <vector>
+#include "h2345.h"
+#include "h5778.h"
+#include "h6520.h"
+#include "h223.h"
+#include "h1187.h"
+#ifdef X
+#include "h2777.h"
+#endif
+struct S9814 { int a; const char *s = "x//y"; };
+inline int f9814_0(int x) { return x * 0; }
+inline int f9814_1(int x) { return x * 1; }
+inline int f9814_2(int x) { return x * 2; }
+inline int f9814_3(int x) { return x * 3; }
+inline int f9814_4(int x) { return x * 4; }
+inline int f9814_5(int x) { return x * 5; }
+inline int f9814_6(int x) { return x * 6; }
+inline int f9814_7(int x) { return x * 7; }
+inline int f9814_8(int x) { return x * 8; }
+inline int f9814_9(int x) { return x * 9; }
+inline int f9814_10(int x) { return x * 10; }
+inline int f9814_11(int x) { return x * 11; }
+inline int f9814_12(int x) { return x * 12; }
+inline int f9814_13(int x) { return x * 13; }
+inline int f9814_14(int x) { return x * 14; }
+inline int f9814_15(int x) { return x * 15; }
+inline int f9814_16(int x) { return x * 16; }
+inline int f9814_17(int x) { return x * 17; }
+inline int f9814_18(int x) { return x * 18; }
+inline int f9814_19(int x) { return x * 19; }
+inline int f9814_20(int x) { return x * 20; }
+inline int f9814_21(int x) { return x * 21; }
+inline int f9814_22(int x) { return x * 22; }
+inline int f9814_23(int x) { return x * 23; }
+inline int f9814_24(int x) { return x * 24; }
+inline int f9814_25(int x) { return x * 25; }
+inline int f9814_26(int x) { return x * 26; }
+inline int f9814_27(int x) { return x * 27; }
+inline int f9814_28(int x) { return x * 28; }
+inline int f9814_29(int x) { return x * 29; }
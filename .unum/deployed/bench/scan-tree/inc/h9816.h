@@ -0,0 +1,42 @@
+#pragma once
+/* header 9816 */
+#include <vector>
+#include "h6751.h"
+#include "h5623.h"
+#include "h8452.h"
+#include "h5730.h"
+#include "h1574.h"
+#ifdef X
+#include "h4958.h"
+#endif
+struct S9816 { int a; const char *s = "x//y"; };
+inline int f9816_0(int x) { return x * 0; }
+inline int f9816_1(int x) { return x * 1; }
+inline int f9816_2(int x) { return x * 2; }
+inline int f9816_3(int x) { return x * 3; }
+inline int f9816_4(int x) { return x * 4; }
+inline int f9816_5(int x) { return x * 5; }
+inline int f9816_6(int x) { return x * 6; }
+inline int f9816_7(int x) { return x * 7; }
+inline int f9816_8(int x) { return x * 8; }
+inline int f9816_9(int x) { return x * 9; }
+inline int f9816_10(int x) { return x * 10; }
+inline int f9816_11(int x) { return x * 11; }
+inline int f9816_12(int x) { return x * 12; }
+inline int f9816_13(int x) { return x * 13; }
+inline int f9816_14(int x) { return x * 14; }
+inline int f9816_15(int x) { return x * 15; }
+inline int f9816_16(int x) { return x * 16; }
+inline int f9816_17(int x) { return x * 17; }
+inline int f9816_18(int x) { return x * 18; }
+inline int f9816_19(int x) { return x * 19; }
+inline int f9816_20(int x) { return x * 20; }
+inline int f9816_21(int x) { return x * 21; }
+inline int f9816_22(int x) { return x * 22; }
+inline int f9816_23(int x) { return x * 23; }
+inline int f9816_24(int x) { return x * 24; }
+inline int f9816_25(int x) { return x * 25; }
+inline int f9816_26(int x) { return x * 26; }
+inline int f9816_27(int x) { return x * 27; }
+inline int f9816_28(int x) { return x * 28; }
+inline int f9816_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9818 */
+#include <vector>
+#include "h987.h"
+#include "h6252.h"
+#include "h7646.h"
+#include "h8245.h"
+#include "h8115.h"
+#ifdef X
+#include "h6021.h"
+#endif
+struct S9818 { int a; const char *s = "x//y"; };
+inline int f9818_0(int x) { return x * 0; }
+inline int f9818_1(int x) { return x * 1; }
+inline int f9818_2(int x) { return x * 2; }
+inline int f9818_3(int x) { return x * 3; }
+inline int f9818_4(int x) { return x * 4; }
+inline int f9818_5(int x) { return x * 5; }
+inline int f9818_6(int x) { return x * 6; }
+inline int f9818_7(int x) { return x * 7; }
+inline int f9818_8(int x) { return x * 8; }
+inline int f9818_9(int x) { return x * 9; }
+inline int f9818_10(int x) { return x * 10; }
+inline int f9818_11(int x) { return x * 11; }
+inline int f9818_12(int x) { return x * 12; }
+inline int f9818_13(int x) { return x * 13; }
+inline int f9818_14(int x) { return x * 14; }
+inline int f9818_15(int x) { return x * 15; }
+inline int f9818_16(int x) { return x * 16; }
+inline int f9818_17(int x) { return x * 17; }
+inline int f9818_18(int x) { return x * 18; }
+inline int f9818_19(int x) { return x * 19; }
+inline int f9818_20(int x) { return x * 20; }
+inline int f9818_21(int x) { return x * 21; }
+inline int f9818_22(int x) { return x * 22; }
+inline int f9818_23(int x) { return x * 23; }
+inline int f9818_24(int x) { return x * 24; }
+inline int f9818_25(int x) { return x * 25; }
+inline int f9818_26(int x) { return x * 26; }
+inline int f9818_27(int x) { return x * 27; }
+inline int f9818_28(int x) { return x * 28; }
+inline int f9818_29(int x) { return x * 29; }
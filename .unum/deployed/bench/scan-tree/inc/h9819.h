@@ -0,0 +1,42 @@
+#pragma once
+/* header 9819 */
+#include <vector>
+#include "h1164.h"
+#include "h6625.h"
+#include "h1503.h"
+#include "h8772.h"
+#include "h8085.h"
+#ifdef X
+#include "h6329.h"
+#endif
+struct S9819 { int a; const char *s = "x//y"; };
+inline int f9819_0(int x) { return x * 0; }
+inline int f9819_1(int x) { return x * 1; }
+inline int f9819_2(int x) { return x * 2; }
+inline int f9819_3(int x) { return x * 3; }
+inline int f9819_4(int x) { return x * 4; }
+inline int f9819_5(int x) { return x * 5; }
+inline int f9819_6(int x) { return x * 6; }
+inline int f9819_7(int x) { return x * 7; }
+inline int f9819_8(int x) { return x * 8; }
+inline int f9819_9(int x) { return x * 9; }
+inline int f9819_10(int x) { return x * 10; }
+inline int f9819_11(int x) { return x * 11; }
+inline int f9819_12(int x) { return x * 12; }
+inline int f9819_13(int x) { return x * 13; }
+inline int f9819_14(int x) { return x * 14; }
+inline int f9819_15(int x) { return x * 15; }
+inline int f9819_16(int x) { return x * 16; }
+inline int f9819_17(int x) { return x * 17; }
+inline int f9819_18(int x) { return x * 18; }
+inline int f9819_19(int x) { return x * 19; }
+inline int f9819_20(int x) { return x * 20; }
+inline int f9819_21(int x) { return x * 21; }
+inline int f9819_22(int x) { return x * 22; }
+inline int f9819_23(int x) { return x * 23; }
+inline int f9819_24(int x) { return x * 24; }
+inline int f9819_25(int x) { return x * 25; }
+inline int f9819_26(int x) { return x * 26; }
+inline int f9819_27(int x) { return x * 27; }
+inline int f9819_28(int x) { return x * 28; }
+inline int f9819_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 982 */
+#include <vector>
+#include "h129.h"
+#include "h9245.h"
+#include "h8911.h"
+#include "h8059.h"
+#include "h6641.h"
+#ifdef X
+#include "h205.h"
+#endif
+struct S982 { int a; const char *s = "x//y"; };
+inline int f982_0(int x) { return x * 0; }
+inline int f982_1(int x) { return x * 1; }
+inline int f982_2(int x) { return x * 2; }
+inline int f982_3(int x) { return x * 3; }
+inline int f982_4(int x) { return x * 4; }
+inline int f982_5(int x) { return x * 5; }
+inline int f982_6(int x) { return x * 6; }
+inline int f982_7(int x) { return x * 7; }
+inline int f982_8(int x) { return x * 8; }
+inline int f982_9(int x) { return x * 9; }
+inline int f982_10(int x) { return x * 10; }
+inline int f982_11(int x) { return x * 11; }
+inline int f982_12(int x) { return x * 12; }
+inline int f982_13(int x) { return x * 13; }
+inline int f982_14(int x) { return x * 14; }
+inline int f982_15(int x) { return x * 15; }
+inline int f982_16(int x) { return x * 16; }
+inline int f982_17(int x) { return x * 17; }
+inline int f982_18(int x) { return x * 18; }
+inline int f982_19(int x) { return x * 19; }
+inline int f982_20(int x) { return x * 20; }
+inline int f982_21(int x) { return x * 21; }
+inline int f982_22(int x) { return x * 22; }
+inline int f982_23(int x) { return x * 23; }
+inline int f982_24(int x) { return x * 24; }
+inline int f982_25(int x) { return x * 25; }
+inline int f982_26(int x) { return x * 26; }
+inline int f982_27(int x) { return x * 27; }
+inline int f982_28(int x) { return x * 28; }
+inline int f982_29(int x) { return x * 29; }
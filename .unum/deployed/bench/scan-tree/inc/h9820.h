@@ -0,0 +1,42 @@
+#pragma once
+/* header 9820 */
+#include <vector>
+#include "h5370.h"
+#include "h1410.h"
+#include "h9346.h"
+#include "h2407.h"
+#include "h7421.h"
+#ifdef X
+#include "h7028.h"
+#endif
+struct S9820 { int a; const char *s = "x//y"; };
+inline int f9820_0(int x) { return x * 0; }
+inline int f9820_1(int x) { return x * 1; }
+inline int f9820_2(int x) { return x * 2; }
+inline int f9820_3(int x) { return x * 3; }
+inline int f9820_4(int x) { return x * 4; }
+inline int f9820_5(int x) { return x * 5; }
+inline int f9820_6(int x) { return x * 6; }
+inline int f9820_7(int x) { return x * 7; }
+inline int f9820_8(int x) { return x * 8; }
+inline int f9820_9(int x) { return x * 9; }
+inline int f9820_10(int x) { return x * 10; }
+inline int f9820_11(int x) { return x * 11; }
+inline int f9820_12(int x) { return x * 12; }
+inline int f9820_13(int x) { return x * 13; }
+inline int f9820_14(int x) { return x * 14; }
+inline int f9820_15(int x) { return x * 15; }
+inline int f9820_16(int x) { return x * 16; }
+inline int f9820_17(int x) { return x * 17; }
+inline int f9820_18(int x) { return x * 18; }
+inline int f9820_19(int x) { return x * 19; }
+inline int f9820_20(int x) { return x * 20; }
+inline int f9820_21(int x) { return x * 21; }
+inline int f9820_22(int x) { return x * 22; }
+inline int f9820_23(int x) { return x * 23; }
+inline int f9820_24(int x) { return x * 24; }
+inline int f9820_25(int x) { return x * 25; }
+inline int f9820_26(int x) { return x * 26; }
+inline int f9820_27(int x) { return x * 27; }
+inline int f9820_28(int x) { return x * 28; }
+inline int f9820_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9821 */
+#include <vector>
+#include "h8889.h"
+#include "h3087.h"
+#include "h8832.h"
+#include "h8646.h"
+#include "h5027.h"
+#ifdef X
+#include "h9449.h"
+#endif
+struct S9821 { int a; const char *s = "x//y"; };
+inline int f9821_0(int x) { return x * 0; }
+inline int f9821_1(int x) { return x * 1; }
+inline int f9821_2(int x) { return x * 2; }
+inline int f9821_3(int x) { return x * 3; }
+inline int f9821_4(int x) { return x * 4; }
+inline int f9821_5(int x) { return x * 5; }
+inline int f9821_6(int x) { return x * 6; }
+inline int f9821_7(int x) { return x * 7; }
+inline int f9821_8(int x) { return x * 8; }
+inline int f9821_9(int x) { return x * 9; }
+inline int f9821_10(int x) { return x * 10; }
+inline int f9821_11(int x) { return x * 11; }
+inline int f9821_12(int x) { return x * 12; }
+inline int f9821_13(int x) { return x * 13; }
+inline int f9821_14(int x) { return x * 14; }
+inline int f9821_15(int x) { return x * 15; }
+inline int f9821_16(int x) { return x * 16; }
+inline int f9821_17(int x) { return x * 17; }
+inline int f9821_18(int x) { return x * 18; }
+inline int f9821_19(int x) { return x * 19; }
+inline int f9821_20(int x) { return x * 20; }
+inline int f9821_21(int x) { return x * 21; }
+inline int f9821_22(int x) { return x * 22; }
+inline int f9821_23(int x) { return x * 23; }
+inline int f9821_24(int x) { return x * 24; }
+inline int f9821_25(int x) { return x * 25; }
+inline int f9821_26(int x) { return x * 26; }
+inline int f9821_27(int x) { return x * 27; }
+inline int f9821_28(int x) { return x * 28; }
+inline int f9821_29(int x) { return x * 29; }
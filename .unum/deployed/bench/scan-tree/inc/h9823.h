@@ -0,0 +1,42 @@
+#pragma once
+/* header 9823 */
+#include <vector>
+#include "h2059.h"
+#include "h4966.h"
+#include "h7254.h"
+#include "h8227.h"
+#include "h3839.h"
+#ifdef X
+#include "h7616.h"
+#endif
+struct S9823 { int a; const char *s = "x//y"; };
+inline int f9823_0(int x) { return x * 0; }
+inline int f9823_1(int x) { return x * 1; }
+inline int f9823_2(int x) { return x * 2; }
+inline int f9823_3(int x) { return x * 3; }
+inline int f9823_4(int x) { return x * 4; }
+inline int f9823_5(int x) { return x * 5; }
+inline int f9823_6(int x) { return x * 6; }
+inline int f9823_7(int x) { return x * 7; }
+inline int f9823_8(int x) { return x * 8; }
+inline int f9823_9(int x) { return x * 9; }
+inline int f9823_10(int x) { return x * 10; }
+inline int f9823_11(int x) { return x * 11; }
+inline int f9823_12(int x) { return x * 12; }
+inline int f9823_13(int x) { return x * 13; }
+inline int f9823_14(int x) { return x * 14; }
+inline int f9823_15(int x) { return x * 15; }
+inline int f9823_16(int x) { return x * 16; }
+inline int f9823_17(int x) { return x * 17; }
+inline int f9823_18(int x) { return x * 18; }
+inline int f9823_19(int x) { return x * 19; }
+inline int f9823_20(int x) { return x * 20; }
+inline int f9823_21(int x) { return x * 21; }
+inline int f9823_22(int x) { return x * 22; }
+inline int f9823_23(int x) { return x * 23; }
+inline int f9823_24(int x) { return x * 24; }
+inline int f9823_25(int x) { return x * 25; }
+inline int f9823_26(int x) { return x * 26; }
+inline int f9823_27(int x) { return x * 27; }
+inline int f9823_28(int x) { return x * 28; }
+inline int f9823_29(int x) { return x * 29; }
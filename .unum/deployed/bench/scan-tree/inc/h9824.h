@@ -0,0 +1,42 @@
+#pragma once
+/* header 9824 */
+#include <vector>
+#include "h6918.h"
+#include "h4062.h"
+#include "h2650.h"
+#include "h4705.h"
+#include "h338.h"
+#ifdef X
+#include "h2210.h"
+#endif
+struct S9824 { int a; const char *s = "x//y"; };
+inline int f9824_0(int x) { return x * 0; }
+inline int f9824_1(int x) { return x * 1; }
+inline int f9824_2(int x) { return x * 2; }
+inline int f9824_3(int x) { return x * 3; }
+inline int f9824_4(int x) { return x * 4; }
+inline int f9824_5(int x) { return x * 5; }
+inline int f9824_6(int x) { return x * 6; }
+inline int f9824_7(int x) { return x * 7; }
+inline int f9824_8(int x) { return x * 8; }
+inline int f9824_9(int x) { return x * 9; }
+inline int f9824_10(int x) { return x * 10; }
+inline int f9824_11(int x) { return x * 11; }
+inline int f9824_12(int x) { return x * 12; }
+inline int f9824_13(int x) { return x * 13; }
+inline int f9824_14(int x) { return x * 14; }
+inline int f9824_15(int x) { return x * 15; }
+inline int f9824_16(int x) { return x * 16; }
+inline int f9824_17(int x) { return x * 17; }
+inline int f9824_18(int x) { return x * 18; }
+inline int f9824_19(int x) { return x * 19; }
+inline int f9824_20(int x) { return x * 20; }
+inline int f9824_21(int x) { return x * 21; }
+inline int f9824_22(int x) { return x * 22; }
+inline int f9824_23(int x) { return x * 23; }
+inline int f9824_24(int x) { return x * 24; }
+inline int f9824_25(int x) { return x * 25; }
+inline int f9824_26(int x) { return x * 26; }
+inline int f9824_27(int x) { return x * 27; }
+inline int f9824_28(int x) { return x * 28; }
+inline int f9824_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9827 */
+#include <vector>
+#include "h2168.h"
+#include "h7128.h"
+#include "h2116.h"
+#include "h1906.h"
+#include "h2578.h"
+#ifdef X
+#include "h8183.h"
+#endif
+struct S9827 { int a; const char *s = "x//y"; };
+inline int f9827_0(int x) { return x * 0; }
+inline int f9827_1(int x) { return x * 1; }
+inline int f9827_2(int x) { return x * 2; }
+inline int f9827_3(int x) { return x * 3; }
+inline int f9827_4(int x) { return x * 4; }
+inline int f9827_5(int x) { return x * 5; }
+inline int f9827_6(int x) { return x * 6; }
+inline int f9827_7(int x) { return x * 7; }
+inline int f9827_8(int x) { return x * 8; }
+inline int f9827_9(int x) { return x * 9; }
+inline int f9827_10(int x) { return x * 10; }
+inline int f9827_11(int x) { return x * 11; }
+inline int f9827_12(int x) { return x * 12; }
+inline int f9827_13(int x) { return x * 13; }
+inline int f9827_14(int x) { return x * 14; }
+inline int f9827_15(int x) { return x * 15; }
+inline int f9827_16(int x) { return x * 16; }
+inline int f9827_17(int x) { return x * 17; }
+inline int f9827_18(int x) { return x * 18; }
+inline int f9827_19(int x) { return x * 19; }
+inline int f9827_20(int x) { return x * 20; }
+inline int f9827_21(int x) { return x * 21; }
+inline int f9827_22(int x) { return x * 22; }
+inline int f9827_23(int x) { return x * 23; }
+inline int f9827_24(int x) { return x * 24; }
+inline int f9827_25(int x) { return x * 25; }
+inline int f9827_26(int x) { return x * 26; }
+inline int f9827_27(int x) { return x * 27; }
+inline int f9827_28(int x) { return x * 28; }
+inline int f9827_29(int x) { return x * 29; }
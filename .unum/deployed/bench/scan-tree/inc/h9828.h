@@ -0,0 +1,42 @@
+#pragma once
+/* header 9828 */
+#include <vector>
+#include "h5759.h"
+#include "h8018.h"
+#include "h3160.h"
+#include "h6748.h"
+#include "h4232.h"
+#ifdef X
+#include "h8372.h"
+#endif
+struct S9828 { int a; const char *s = "x//y"; };
+inline int f9828_0(int x) { return x * 0; }
+inline int f9828_1(int x) { return x * 1; }
+inline int f9828_2(int x) { return x * 2; }
+inline int f9828_3(int x) { return x * 3; }
+inline int f9828_4(int x) { return x * 4; }
+inline int f9828_5(int x) { return x * 5; }
+inline int f9828_6(int x) { return x * 6; }
+inline int f9828_7(int x) { return x * 7; }
+inline int f9828_8(int x) { return x * 8; }
+inline int f9828_9(int x) { return x * 9; }
+inline int f9828_10(int x) { return x * 10; }
+inline int f9828_11(int x) { return x * 11; }
+inline int f9828_12(int x) { return x * 12; }
+inline int f9828_13(int x) { return x * 13; }
+inline int f9828_14(int x) { return x * 14; }
+inline int f9828_15(int x) { return x * 15; }
+inline int f9828_16(int x) { return x * 16; }
+inline int f9828_17(int x) { return x * 17; }
+inline int f9828_18(int x) { return x * 18; }
+inline int f9828_19(int x) { return x * 19; }
+inline int f9828_20(int x) { return x * 20; }
+inline int f9828_21(int x) { return x * 21; }
+inline int f9828_22(int x) { return x * 22; }
+inline int f9828_23(int x) { return x * 23; }
+inline int f9828_24(int x) { return x * 24; }
+inline int f9828_25(int x) { return x * 25; }
+inline int f9828_26(int x) { return x * 26; }
+inline int f9828_27(int x) { return x * 27; }
+inline int f9828_28(int x) { return x * 28; }
+inline int f9828_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9833 */
+#include <vector>
+#include "h2810.h"
+#include "h7915.h"
+#include "h1441.h"
+#include "h3349.h"
+#include "h3238.h"
+#ifdef X
+#include "h1932.h"
+#endif
+struct S9833 { int a; const char *s = "x//y"; };
+inline int f9833_0(int x) { return x * 0; }
+inline int f9833_1(int x) { return x * 1; }
+inline int f9833_2(int x) { return x * 2; }
+inline int f9833_3(int x) { return x * 3; }
+inline int f9833_4(int x) { return x * 4; }
+inline int f9833_5(int x) { return x * 5; }
+inline int f9833_6(int x) { return x * 6; }
+inline int f9833_7(int x) { return x * 7; }
+inline int f9833_8(int x) { return x * 8; }
+inline int f9833_9(int x) { return x * 9; }
+inline int f9833_10(int x) { return x * 10; }
+inline int f9833_11(int x) { return x * 11; }
+inline int f9833_12(int x) { return x * 12; }
+inline int f9833_13(int x) { return x * 13; }
+inline int f9833_14(int x) { return x * 14; }
+inline int f9833_15(int x) { return x * 15; }
+inline int f9833_16(int x) { return x * 16; }
+inline int f9833_17(int x) { return x * 17; }
+inline int f9833_18(int x) { return x * 18; }
+inline int f9833_19(int x) { return x * 19; }
+inline int f9833_20(int x) { return x * 20; }
+inline int f9833_21(int x) { return x * 21; }
+inline int f9833_22(int x) { return x * 22; }
+inline int f9833_23(int x) { return x * 23; }
+inline int f9833_24(int x) { return x * 24; }
+inline int f9833_25(int x) { return x * 25; }
+inline int f9833_26(int x) { return x * 26; }
+inline int f9833_27(int x) { return x * 27; }
+inline int f9833_28(int x) { return x * 28; }
+inline int f9833_29(int x) { return x * 29; }
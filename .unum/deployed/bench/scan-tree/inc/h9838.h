@@ -0,0 +1,42 @@
+#pragma once
+/* header 9838 */
+#include <vector>
+#include "h6828.h"
+#include "h1262.h"
+#include "h8965.h"
+#include "h5371.h"
+#include "h7188.h"
+#ifdef X
+#include "h2748.h"
+#endif
+struct S9838 { int a; const char *s = "x//y"; };
+inline int f9838_0(int x) { return x * 0; }
+inline int f9838_1(int x) { return x * 1; }
+inline int f9838_2(int x) { return x * 2; }
+inline int f9838_3(int x) { return x * 3; }
+inline int f9838_4(int x) { return x * 4; }
+inline int f9838_5(int x) { return x * 5; }
+inline int f9838_6(int x) { return x * 6; }
+inline int f9838_7(int x) { return x * 7; }
+inline int f9838_8(int x) { return x * 8; }
+inline int f9838_9(int x) { return x * 9; }
+inline int f9838_10(int x) { return x * 10; }
+inline int f9838_11(int x) { return x * 11; }
+inline int f9838_12(int x) { return x * 12; }
+inline int f9838_13(int x) { return x * 13; }
+inline int f9838_14(int x) { return x * 14; }
+inline int f9838_15(int x) { return x * 15; }
+inline int f9838_16(int x) { return x * 16; }
+inline int f9838_17(int x) { return x * 17; }
+inline int f9838_18(int x) { return x * 18; }
+inline int f9838_19(int x) { return x * 19; }
+inline int f9838_20(int x) { return x * 20; }
+inline int f9838_21(int x) { return x * 21; }
+inline int f9838_22(int x) { return x * 22; }
+inline int f9838_23(int x) { return x * 23; }
+inline int f9838_24(int x) { return x * 24; }
+inline int f9838_25(int x) { return x * 25; }
+inline int f9838_26(int x) { return x * 26; }
+inline int f9838_27(int x) { return x * 27; }
+inline int f9838_28(int x) { return x * 28; }
+inline int f9838_29(int x) { return x * 29; }
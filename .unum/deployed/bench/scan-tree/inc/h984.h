@@ -0,0 +1,42 @@
+#pragma once
+/* header 984 */
+#include <vector>
+#include "h6660.h"
+#include "h4448.h"
+#include "h4293.h"
+#include "h7389.h"
+#include "h8456.h"
+#ifdef X
+#include "h2891.h"
+#endif
+struct S984 { int a; const char *s = "x//y"; };
+inline int f984_0(int x) { return x * 0; }
+inline int f984_1(int x) { return x * 1; }
+inline int f984_2(int x) { return x * 2; }
+inline int f984_3(int x) { return x * 3; }
+inline int f984_4(int x) { return x * 4; }
+inline int f984_5(int x) { return x * 5; }
+inline int f984_6(int x) { return x * 6; }
+inline int f984_7(int x) { return x * 7; }
+inline int f984_8(int x) { return x * 8; }
+inline int f984_9(int x) { return x * 9; }
+inline int f984_10(int x) { return x * 10; }
+inline int f984_11(int x) { return x * 11; }
+inline int f984_12(int x) { return x * 12; }
+inline int f984_13(int x) { return x * 13; }
+inline int f984_14(int x) { return x * 14; }
+inline int f984_15(int x) { return x * 15; }
+inline int f984_16(int x) { return x * 16; }
+inline int f984_17(int x) { return x * 17; }
+inline int f984_18(int x) { return x * 18; }
+inline int f984_19(int x) { return x * 19; }
+inline int f984_20(int x) { return x * 20; }
+inline int f984_21(int x) { return x * 21; }
+inline int f984_22(int x) { return x * 22; }
+inline int f984_23(int x) { return x * 23; }
+inline int f984_24(int x) { return x * 24; }
+inline int f984_25(int x) { return x * 25; }
+inline int f984_26(int x) { return x * 26; }
+inline int f984_27(int x) { return x * 27; }
+inline int f984_28(int x) { return x * 28; }
+inline int f984_29(int x) { return x * 29; }
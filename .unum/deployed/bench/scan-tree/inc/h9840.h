@@ -0,0 +1,42 @@
+#pragma once
+/* header 9840 */
+#include <vector>
+#include "h3790.h"
+#include "h5965.h"
+#include "h5449.h"
+#include "h5476.h"
+#include "h8225.h"
+#ifdef X
+#include "h8986.h"
+#endif
+struct S9840 { int a; const char *s = "x//y"; };
+inline int f9840_0(int x) { return x * 0; }
+inline int f9840_1(int x) { return x * 1; }
+inline int f9840_2(int x) { return x * 2; }
+inline int f9840_3(int x) { return x * 3; }
+inline int f9840_4(int x) { return x * 4; }
+inline int f9840_5(int x) { return x * 5; }
+inline int f9840_6(int x) { return x * 6; }
+inline int f9840_7(int x) { return x * 7; }
+inline int f9840_8(int x) { return x * 8; }
+inline int f9840_9(int x) { return x * 9; }
+inline int f9840_10(int x) { return x * 10; }
+inline int f9840_11(int x) { return x * 11; }
+inline int f9840_12(int x) { return x * 12; }
+inline int f9840_13(int x) { return x * 13; }
+inline int f9840_14(int x) { return x * 14; }
+inline int f9840_15(int x) { return x * 15; }
+inline int f9840_16(int x) { return x * 16; }
+inline int f9840_17(int x) { return x * 17; }
+inline int f9840_18(int x) { return x * 18; }
+inline int f9840_19(int x) { return x * 19; }
+inline int f9840_20(int x) { return x * 20; }
+inline int f9840_21(int x) { return x * 21; }
+inline int f9840_22(int x) { return x * 22; }
+inline int f9840_23(int x) { return x * 23; }
+inline int f9840_24(int x) { return x * 24; }
+inline int f9840_25(int x) { return x * 25; }
+inline int f9840_26(int x) { return x * 26; }
+inline int f9840_27(int x) { return x * 27; }
+inline int f9840_28(int x) { return x * 28; }
+inline int f9840_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9841 */
+#include <vector>
+#include "h5291.h"
+#include "h1208.h"
+#include "h4771.h"
+#include "h1455.h"
+#include "h6279.h"
+#ifdef X
+#include "h3197.h"
+#endif
+struct S9841 { int a; const char *s = "x//y"; };
+inline int f9841_0(int x) { return x * 0; }
+inline int f9841_1(int x) { return x * 1; }
+inline int f9841_2(int x) { return x * 2; }
+inline int f9841_3(int x) { return x * 3; }
+inline int f9841_4(int x) { return x * 4; }
+inline int f9841_5(int x) { return x * 5; }
+inline int f9841_6(int x) { return x * 6; }
+inline int f9841_7(int x) { return x * 7; }
+inline int f9841_8(int x) { return x * 8; }
+inline int f9841_9(int x) { return x * 9; }
+inline int f9841_10(int x) { return x * 10; }
+inline int f9841_11(int x) { return x * 11; }
+inline int f9841_12(int x) { return x * 12; }
+inline int f9841_13(int x) { return x * 13; }
+inline int f9841_14(int x) { return x * 14; }
+inline int f9841_15(int x) { return x * 15; }
+inline int f9841_16(int x) { return x * 16; }
+inline int f9841_17(int x) { return x * 17; }
+inline int f9841_18(int x) { return x * 18; }
+inline int f9841_19(int x) { return x * 19; }
+inline int f9841_20(int x) { return x * 20; }
+inline int f9841_21(int x) { return x * 21; }
+inline int f9841_22(int x) { return x * 22; }
+inline int f9841_23(int x) { return x * 23; }
+inline int f9841_24(int x) { return x * 24; }
+inline int f9841_25(int x) { return x * 25; }
+inline int f9841_26(int x) { return x * 26; }
+inline int f9841_27(int x) { return x * 27; }
+inline int f9841_28(int x) { return x * 28; }
+inline int f9841_29(int x) { return x * 29; }
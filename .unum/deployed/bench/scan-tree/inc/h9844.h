@@ -0,0 +1,42 @@
+#pragma once
+/* header 9844 */
+#include <vector>
+#include "h3181.h"
+#include "h8329.h"
+#include "h8127.h"
+#include "h8590.h"
+#include "h4785.h"
+#ifdef X
+#include "h6649.h"
+#endif
+struct S9844 { int a; const char *s = "x//y"; };
+inline int f9844_0(int x) { return x * 0; }
+inline int f9844_1(int x) { return x * 1; }
+inline int f9844_2(int x) { return x * 2; }
+inline int f9844_3(int x) { return x * 3; }
+inline int f9844_4(int x) { return x * 4; }
+inline int f9844_5(int x) { return x * 5; }
+inline int f9844_6(int x) { return x * 6; }
+inline int f9844_7(int x) { return x * 7; }
+inline int f9844_8(int x) { return x * 8; }
+inline int f9844_9(int x) { return x * 9; }
+inline int f9844_10(int x) { return x * 10; }
+inline int f9844_11(int x) { return x * 11; }
+inline int f9844_12(int x) { return x * 12; }
+inline int f9844_13(int x) { return x * 13; }
+inline int f9844_14(int x) { return x * 14; }
+inline int f9844_15(int x) { return x * 15; }
+inline int f9844_16(int x) { return x * 16; }
+inline int f9844_17(int x) { return x * 17; }
+inline int f9844_18(int x) { return x * 18; }
+inline int f9844_19(int x) { return x * 19; }
+inline int f9844_20(int x) { return x * 20; }
+inline int f9844_21(int x) { return x * 21; }
+inline int f9844_22(int x) { return x * 22; }
+inline int f9844_23(int x) { return x * 23; }
+inline int f9844_24(int x) { return x * 24; }
+inline int f9844_25(int x) { return x * 25; }
+inline int f9844_26(int x) { return x * 26; }
+inline int f9844_27(int x) { return x * 27; }
+inline int f9844_28(int x) { return x * 28; }
+inline int f9844_29(int x) { return x * 29; }
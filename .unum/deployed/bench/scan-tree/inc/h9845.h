@@ -0,0 +1,42 @@
+#pragma once
+/* header 9845 */
+#include <vector>
+#include "h105.h"
+#include "h8435.h"
+#include "h3369.h"
+#include "h82.h"
+#include "h3901.h"
+#ifdef X
+#include "h3194.h"
+#endif
+struct S9845 { int a; const char *s = "x//y"; };
+inline int f9845_0(int x) { return x * 0; }
+inline int f9845_1(int x) { return x * 1; }
+inline int f9845_2(int x) { return x * 2; }
+inline int f9845_3(int x) { return x * 3; }
+inline int f9845_4(int x) { return x * 4; }
+inline int f9845_5(int x) { return x * 5; }
+inline int f9845_6(int x) { return x * 6; }
+inline int f9845_7(int x) { return x * 7; }
+inline int f9845_8(int x) { return x * 8; }
+inline int f9845_9(int x) { return x * 9; }
+inline int f9845_10(int x) { return x * 10; }
+inline int f9845_11(int x) { return x * 11; }
+inline int f9845_12(int x) { return x * 12; }
+inline int f9845_13(int x) { return x * 13; }
+inline int f9845_14(int x) { return x * 14; }
+inline int f9845_15(int x) { return x * 15; }
+inline int f9845_16(int x) { return x * 16; }
+inline int f9845_17(int x) { return x * 17; }
+inline int f9845_18(int x) { return x * 18; }
+inline int f9845_19(int x) { return x * 19; }
+inline int f9845_20(int x) { return x * 20; }
+inline int f9845_21(int x) { return x * 21; }
+inline int f9845_22(int x) { return x * 22; }
+inline int f9845_23(int x) { return x * 23; }
+inline int f9845_24(int x) { return x * 24; }
+inline int f9845_25(int x) { return x * 25; }
+inline int f9845_26(int x) { return x * 26; }
+inline int f9845_27(int x) { return x * 27; }
+inline int f9845_28(int x) { return x * 28; }
+inline int f9845_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9847 */
+#include <vector>
+#include "h5568.h"
+#include "h9030.h"
+#include "h5315.h"
+#include "h8350.h"
+#include "h600.h"
+#ifdef X
+#include "h8420.h"
+#endif
+struct S9847 { int a; const char *s = "x//y"; };
+inline int f9847_0(int x) { return x * 0; }
+inline int f9847_1(int x) { return x * 1; }
+inline int f9847_2(int x) { return x * 2; }
+inline int f9847_3(int x) { return x * 3; }
+inline int f9847_4(int x) { return x * 4; }
+inline int f9847_5(int x) { return x * 5; }
+inline int f9847_6(int x) { return x * 6; }
+inline int f9847_7(int x) { return x * 7; }
+inline int f9847_8(int x) { return x * 8; }
+inline int f9847_9(int x) { return x * 9; }
+inline int f9847_10(int x) { return x * 10; }
+inline int f9847_11(int x) { return x * 11; }
+inline int f9847_12(int x) { return x * 12; }
+inline int f9847_13(int x) { return x * 13; }
+inline int f9847_14(int x) { return x * 14; }
+inline int f9847_15(int x) { return x * 15; }
+inline int f9847_16(int x) { return x * 16; }
+inline int f9847_17(int x) { return x * 17; }
+inline int f9847_18(int x) { return x * 18; }
+inline int f9847_19(int x) { return x * 19; }
+inline int f9847_20(int x) { return x * 20; }
+inline int f9847_21(int x) { return x * 21; }
+inline int f9847_22(int x) { return x * 22; }
+inline int f9847_23(int x) { return x * 23; }
+inline int f9847_24(int x) { return x * 24; }
+inline int f9847_25(int x) { return x * 25; }
+inline int f9847_26(int x) { return x * 26; }
+inline int f9847_27(int x) { return x * 27; }
+inline int f9847_28(int x) { return x * 28; }
+inline int f9847_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9849 */
+#include <vector>
+#include "h934.h"
+#include "h3903.h"
+#include "h37.h"
+#include "h8792.h"
+#include "h6008.h"
+#ifdef X
+#include "h3935.h"
+#endif
+struct S9849 { int a; const char *s = "x//y"; };
+inline int f9849_0(int x) { return x * 0; }
+inline int f9849_1(int x) { return x * 1; }
+inline int f9849_2(int x) { return x * 2; }
+inline int f9849_3(int x) { return x * 3; }
+inline int f9849_4(int x) { return x * 4; }
+inline int f9849_5(int x) { return x * 5; }
+inline int f9849_6(int x) { return x * 6; }
+inline int f9849_7(int x) { return x * 7; }
+inline int f9849_8(int x) { return x * 8; }
+inline int f9849_9(int x) { return x * 9; }
+inline int f9849_10(int x) { return x * 10; }
+inline int f9849_11(int x) { return x * 11; }
+inline int f9849_12(int x) { return x * 12; }
+inline int f9849_13(int x) { return x * 13; }
+inline int f9849_14(int x) { return x * 14; }
+inline int f9849_15(int x) { return x * 15; }
+inline int f9849_16(int x) { return x * 16; }
+inline int f9849_17(int x) { return x * 17; }
+inline int f9849_18(int x) { return x * 18; }
+inline int f9849_19(int x) { return x * 19; }
+inline int f9849_20(int x) { return x * 20; }
+inline int f9849_21(int x) { return x * 21; }
+inline int f9849_22(int x) { return x * 22; }
+inline int f9849_23(int x) { return x * 23; }
+inline int f9849_24(int x) { return x * 24; }
+inline int f9849_25(int x) { return x * 25; }
+inline int f9849_26(int x) { return x * 26; }
+inline int f9849_27(int x) { return x * 27; }
+inline int f9849_28(int x) { return x * 28; }
+inline int f9849_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 985 */
+#include <vector>
+#include "h2053.h"
+#include "h4008.h"
+#include "h9562.h"
+#include "h6996.h"
+#include "h2849.h"
+#ifdef X
+#include "h4393.h"
+#endif
+struct S985 { int a; const char *s = "x//y"; };
+inline int f985_0(int x) { return x * 0; }
+inline int f985_1(int x) { return x * 1; }
+inline int f985_2(int x) { return x * 2; }
+inline int f985_3(int x) { return x * 3; }
+inline int f985_4(int x) { return x * 4; }
+inline int f985_5(int x) { return x * 5; }
+inline int f985_6(int x) { return x * 6; }
+inline int f985_7(int x) { return x * 7; }
+inline int f985_8(int x) { return x * 8; }
+inline int f985_9(int x) { return x * 9; }
+inline int f985_10(int x) { return x * 10; }
+inline int f985_11(int x) { return x * 11; }
+inline int f985_12(int x) { return x * 12; }
+inline int f985_13(int x) { return x * 13; }
+inline int f985_14(int x) { return x * 14; }
+inline int f985_15(int x) { return x * 15; }
+inline int f985_16(int x) { return x * 16; }
+inline int f985_17(int x) { return x * 17; }
+inline int f985_18(int x) { return x * 18; }
+inline int f985_19(int x) { return x * 19; }
+inline int f985_20(int x) { return x * 20; }
+inline int f985_21(int x) { return x * 21; }
+inline int f985_22(int x) { return x * 22; }
+inline int f985_23(int x) { return x * 23; }
+inline int f985_24(int x) { return x * 24; }
+inline int f985_25(int x) { return x * 25; }
+inline int f985_26(int x) { return x * 26; }
+inline int f985_27(int x) { return x * 27; }
+inline int f985_28(int x) { return x * 28; }
+inline int f985_29(int x) { return x * 29; }
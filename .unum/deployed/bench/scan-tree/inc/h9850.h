@@ -0,0 +1,42 @@
+#pragma once
+/* header 9850 */
+#include <vector>
+#include "h1288.h"
+#include "h1340.h"
+#include "h65.h"
+#include "h9937.h"
+#include "h524.h"
+#ifdef X
+#include "h6059.h"
+#endif
+struct S9850 { int a; const char *s = "x//y"; };
+inline int f9850_0(int x) { return x * 0; }
+inline int f9850_1(int x) { return x * 1; }
+inline int f9850_2(int x) { return x * 2; }
+inline int f9850_3(int x) { return x * 3; }
+inline int f9850_4(int x) { return x * 4; }
+inline int f9850_5(int x) { return x * 5; }
+inline int f9850_6(int x) { return x * 6; }
+inline int f9850_7(int x) { return x * 7; }
+inline int f9850_8(int x) { return x * 8; }
+inline int f9850_9(int x) { return x * 9; }
+inline int f9850_10(int x) { return x * 10; }
+inline int f9850_11(int x) { return x * 11; }
+inline int f9850_12(int x) { return x * 12; }
+inline int f9850_13(int x) { return x * 13; }
+inline int f9850_14(int x) { return x * 14; }
+inline int f9850_15(int x) { return x * 15; }
+inline int f9850_16(int x) { return x * 16; }
+inline int f9850_17(int x) { return x * 17; }
+inline int f9850_18(int x) { return x * 18; }
+inline int f9850_19(int x) { return x * 19; }
+inline int f9850_20(int x) { return x * 20; }
+inline int f9850_21(int x) { return x * 21; }
+inline int f9850_22(int x) { return x * 22; }
+inline int f9850_23(int x) { return x * 23; }
+inline int f9850_24(int x) { return x * 24; }
+inline int f9850_25(int x) { return x * 25; }
+inline int f9850_26(int x) { return x * 26; }
+inline int f9850_27(int x) { return x * 27; }
+inline int f9850_28(int x) { return x * 28; }
+inline int f9850_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9851 */
+#include <vector>
+#include "h7752.h"
+#include "h5049.h"
+#include "h1274.h"
+#include "h156.h"
+#include "h5012.h"
+#ifdef X
+#include "h7287.h"
+#endif
+struct S9851 { int a; const char *s = "x//y"; };
+inline int f9851_0(int x) { return x * 0; }
+inline int f9851_1(int x) { return x * 1; }
+inline int f9851_2(int x) { return x * 2; }
+inline int f9851_3(int x) { return x * 3; }
+inline int f9851_4(int x) { return x * 4; }
+inline int f9851_5(int x) { return x * 5; }
+inline int f9851_6(int x) { return x * 6; }
+inline int f9851_7(int x) { return x * 7; }
+inline int f9851_8(int x) { return x * 8; }
+inline int f9851_9(int x) { return x * 9; }
+inline int f9851_10(int x) { return x * 10; }
+inline int f9851_11(int x) { return x * 11; }
+inline int f9851_12(int x) { return x * 12; }
+inline int f9851_13(int x) { return x * 13; }
+inline int f9851_14(int x) { return x * 14; }
+inline int f9851_15(int x) { return x * 15; }
+inline int f9851_16(int x) { return x * 16; }
+inline int f9851_17(int x) { return x * 17; }
+inline int f9851_18(int x) { return x * 18; }
+inline int f9851_19(int x) { return x * 19; }
+inline int f9851_20(int x) { return x * 20; }
+inline int f9851_21(int x) { return x * 21; }
+inline int f9851_22(int x) { return x * 22; }
+inline int f9851_23(int x) { return x * 23; }
+inline int f9851_24(int x) { return x * 24; }
+inline int f9851_25(int x) { return x * 25; }
+inline int f9851_26(int x) { return x * 26; }
+inline int f9851_27(int x) { return x * 27; }
+inline int f9851_28(int x) { return x * 28; }
+inline int f9851_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9852 */
+#include <vector>
+#include "h6446.h"
+#include "h8744.h"
+#include "h5496.h"
+#include "h4904.h"
+#include "h9811.h"
+#ifdef X
+#include "h3130.h"
+#endif
+struct S9852 { int a; const char *s = "x//y"; };
+inline int f9852_0(int x) { return x * 0; }
+inline int f9852_1(int x) { return x * 1; }
+inline int f9852_2(int x) { return x * 2; }
+inline int f9852_3(int x) { return x * 3; }
+inline int f9852_4(int x) { return x * 4; }
+inline int f9852_5(int x) { return x * 5; }
+inline int f9852_6(int x) { return x * 6; }
+inline int f9852_7(int x) { return x * 7; }
+inline int f9852_8(int x) { return x * 8; }
+inline int f9852_9(int x) { return x * 9; }
+inline int f9852_10(int x) { return x * 10; }
+inline int f9852_11(int x) { return x * 11; }
+inline int f9852_12(int x) { return x * 12; }
+inline int f9852_13(int x) { return x * 13; }
+inline int f9852_14(int x) { return x * 14; }
+inline int f9852_15(int x) { return x * 15; }
+inline int f9852_16(int x) { return x * 16; }
+inline int f9852_17(int x) { return x * 17; }
+inline int f9852_18(int x) { return x * 18; }
+inline int f9852_19(int x) { return x * 19; }
+inline int f9852_20(int x) { return x * 20; }
+inline int f9852_21(int x) { return x * 21; }
+inline int f9852_22(int x) { return x * 22; }
+inline int f9852_23(int x) { return x * 23; }
+inline int f9852_24(int x) { return x * 24; }
+inline int f9852_25(int x) { return x * 25; }
+inline int f9852_26(int x) { return x * 26; }
+inline int f9852_27(int x) { return x * 27; }
+inline int f9852_28(int x) { return x * 28; }
+inline int f9852_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9856 */
+#include <vector>
+#include "h9602.h"
+#include "h439.h"
+#include "h7731.h"
+#include "h1797.h"
+#include "h4931.h"
+#ifdef X
+#include "h5978.h"
+#endif
+struct S9856 { int a; const char *s = "x//y"; };
+inline int f9856_0(int x) { return x * 0; }
+inline int f9856_1(int x) { return x * 1; }
+inline int f9856_2(int x) { return x * 2; }
+inline int f9856_3(int x) { return x * 3; }
+inline int f9856_4(int x) { return x * 4; }
+inline int f9856_5(int x) { return x * 5; }
+inline int f9856_6(int x) { return x * 6; }
+inline int f9856_7(int x) { return x * 7; }
+inline int f9856_8(int x) { return x * 8; }
+inline int f9856_9(int x) { return x * 9; }
+inline int f9856_10(int x) { return x * 10; }
+inline int f9856_11(int x) { return x * 11; }
+inline int f9856_12(int x) { return x * 12; }
+inline int f9856_13(int x) { return x * 13; }
+inline int f9856_14(int x) { return x * 14; }
+inline int f9856_15(int x) { return x * 15; }
+inline int f9856_16(int x) { return x * 16; }
+inline int f9856_17(int x) { return x * 17; }
+inline int f9856_18(int x) { return x * 18; }
+inline int f9856_19(int x) { return x * 19; }
+inline int f9856_20(int x) { return x * 20; }
+inline int f9856_21(int x) { return x * 21; }
+inline int f9856_22(int x) { return x * 22; }
+inline int f9856_23(int x) { return x * 23; }
+inline int f9856_24(int x) { return x * 24; }
+inline int f9856_25(int x) { return x * 25; }
+inline int f9856_26(int x) { return x * 26; }
+inline int f9856_27(int x) { return x * 27; }
+inline int f9856_28(int x) { return x * 28; }
+inline int f9856_29(int x) { return x * 29; }
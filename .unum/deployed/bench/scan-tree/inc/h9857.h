@@ -0,0 +1,42 @@
+#pragma once
+/* header 9857 */
+#include <vector>
+#include "h3011.h"
+#include "h4901.h"
+#include "h7845.h"
+#include "h9841.h"
+#include "h5763.h"
+#ifdef X
+#include "h3514.h"
+#endif
+struct S9857 { int a; const char *s = "x//y"; };
+inline int f9857_0(int x) { return x * 0; }
+inline int f9857_1(int x) { return x * 1; }
+inline int f9857_2(int x) { return x * 2; }
+inline int f9857_3(int x) { return x * 3; }
+inline int f9857_4(int x) { return x * 4; }
+inline int f9857_5(int x) { return x * 5; }
+inline int f9857_6(int x) { return x * 6; }
+inline int f9857_7(int x) { return x * 7; }
+inline int f9857_8(int x) { return x * 8; }
+inline int f9857_9(int x) { return x * 9; }
+inline int f9857_10(int x) { return x * 10; }
+inline int f9857_11(int x) { return x * 11; }
+inline int f9857_12(int x) { return x * 12; }
+inline int f9857_13(int x) { return x * 13; }
+inline int f9857_14(int x) { return x * 14; }
+inline int f9857_15(int x) { return x * 15; }
+inline int f9857_16(int x) { return x * 16; }
+inline int f9857_17(int x) { return x * 17; }
+inline int f9857_18(int x) { return x * 18; }
+inline int f9857_19(int x) { return x * 19; }
+inline int f9857_20(int x) { return x * 20; }
+inline int f9857_21(int x) { return x * 21; }
+inline int f9857_22(int x) { return x * 22; }
+inline int f9857_23(int x) { return x * 23; }
+inline int f9857_24(int x) { return x * 24; }
+inline int f9857_25(int x) { return x * 25; }
+inline int f9857_26(int x) { return x * 26; }
+inline int f9857_27(int x) { return x * 27; }
+inline int f9857_28(int x) { return x * 28; }
+inline int f9857_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9859 */
+#include <vector>
+#include "h7258.h"
+#include "h8064.h"
+#include "h3383.h"
+#include "h2463.h"
+#include "h2061.h"
+#ifdef X
+#include "h2633.h"
+#endif
+struct S9859 { int a; const char *s = "x//y"; };
+inline int f9859_0(int x) { return x * 0; }
+inline int f9859_1(int x) { return x * 1; }
+inline int f9859_2(int x) { return x * 2; }
+inline int f9859_3(int x) { return x * 3; }
+inline int f9859_4(int x) { return x * 4; }
+inline int f9859_5(int x) { return x * 5; }
+inline int f9859_6(int x) { return x * 6; }
+inline int f9859_7(int x) { return x * 7; }
+inline int f9859_8(int x) { return x * 8; }
+inline int f9859_9(int x) { return x * 9; }
+inline int f9859_10(int x) { return x * 10; }
+inline int f9859_11(int x) { return x * 11; }
+inline int f9859_12(int x) { return x * 12; }
+inline int f9859_13(int x) { return x * 13; }
+inline int f9859_14(int x) { return x * 14; }
+inline int f9859_15(int x) { return x * 15; }
+inline int f9859_16(int x) { return x * 16; }
+inline int f9859_17(int x) { return x * 17; }
+inline int f9859_18(int x) { return x * 18; }
+inline int f9859_19(int x) { return x * 19; }
+inline int f9859_20(int x) { return x * 20; }
+inline int f9859_21(int x) { return x * 21; }
+inline int f9859_22(int x) { return x * 22; }
+inline int f9859_23(int x) { return x * 23; }
+inline int f9859_24(int x) { return x * 24; }
+inline int f9859_25(int x) { return x * 25; }
+inline int f9859_26(int x) { return x * 26; }
+inline int f9859_27(int x) { return x * 27; }
+inline int f9859_28(int x) { return x * 28; }
+inline int f9859_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9863 */
+#include <vector>
+#include "h7792.h"
+#include "h579.h"
+#include "h7841.h"
+#include "h3217.h"
+#include "h4425.h"
+#ifdef X
+#include "h2634.h"
+#endif
+struct S9863 { int a; const char *s = "x//y"; };
+inline int f9863_0(int x) { return x * 0; }
+inline int f9863_1(int x) { return x * 1; }
+inline int f9863_2(int x) { return x * 2; }
+inline int f9863_3(int x) { return x * 3; }
+inline int f9863_4(int x) { return x * 4; }
+inline int f9863_5(int x) { return x * 5; }
+inline int f9863_6(int x) { return x * 6; }
+inline int f9863_7(int x) { return x * 7; }
+inline int f9863_8(int x) { return x * 8; }
+inline int f9863_9(int x) { return x * 9; }
+inline int f9863_10(int x) { return x * 10; }
+inline int f9863_11(int x) { return x * 11; }
+inline int f9863_12(int x) { return x * 12; }
+inline int f9863_13(int x) { return x * 13; }
+inline int f9863_14(int x) { return x * 14; }
+inline int f9863_15(int x) { return x * 15; }
+inline int f9863_16(int x) { return x * 16; }
+inline int f9863_17(int x) { return x * 17; }
+inline int f9863_18(int x) { return x * 18; }
+inline int f9863_19(int x) { return x * 19; }
+inline int f9863_20(int x) { return x * 20; }
+inline int f9863_21(int x) { return x * 21; }
+inline int f9863_22(int x) { return x * 22; }
+inline int f9863_23(int x) { return x * 23; }
+inline int f9863_24(int x) { return x * 24; }
+inline int f9863_25(int x) { return x * 25; }
+inline int f9863_26(int x) { return x * 26; }
+inline int f9863_27(int x) { return x * 27; }
+inline int f9863_28(int x) { return x * 28; }
+inline int f9863_29(int x) { return x * 29; }
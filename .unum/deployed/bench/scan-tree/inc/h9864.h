@@ -0,0 +1,42 @@
+#pragma once
+/* header 9864 */
+#include <vector>
+#include "h4146.h"
+#include "h1194.h"
+#include "h2295.h"
+#include "h659.h"
+#include "h9148.h"
+#ifdef X
+#include "h8985.h"
+#endif
+struct S9864 { int a; const char *s = "x//y"; };
+inline int f9864_0(int x) { return x * 0; }
+inline int f9864_1(int x) { return x * 1; }
+inline int f9864_2(int x) { return x * 2; }
+inline int f9864_3(int x) { return x * 3; }
+inline int f9864_4(int x) { return x * 4; }
+inline int f9864_5(int x) { return x * 5; }
+inline int f9864_6(int x) { return x * 6; }
+inline int f9864_7(int x) { return x * 7; }
+inline int f9864_8(int x) { return x * 8; }
+inline int f9864_9(int x) { return x * 9; }
+inline int f9864_10(int x) { return x * 10; }
+inline int f9864_11(int x) { return x * 11; }
+inline int f9864_12(int x) { return x * 12; }
+inline int f9864_13(int x) { return x * 13; }
+inline int f9864_14(int x) { return x * 14; }
+inline int f9864_15(int x) { return x * 15; }
+inline int f9864_16(int x) { return x * 16; }
+inline int f9864_17(int x) { return x * 17; }
+inline int f9864_18(int x) { return x * 18; }
+inline int f9864_19(int x) { return x * 19; }
+inline int f9864_20(int x) { return x * 20; }
+inline int f9864_21(int x) { return x * 21; }
+inline int f9864_22(int x) { return x * 22; }
+inline int f9864_23(int x) { return x * 23; }
+inline int f9864_24(int x) { return x * 24; }
+inline int f9864_25(int x) { return x * 25; }
+inline int f9864_26(int x) { return x * 26; }
+inline int f9864_27(int x) { return x * 27; }
+inline int f9864_28(int x) { return x * 28; }
+inline int f9864_29(int x) { return x * 29; }
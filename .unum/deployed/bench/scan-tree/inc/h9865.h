@@ -0,0 +1,42 @@
+#pragma once
+/* header 9865 */
+#include <vector>
+#include "h6211.h"
+#include "h6693.h"
+#include "h1505.h"
+#include "h5263.h"
+#include "h625.h"
+#ifdef X
+#include "h3117.h"
+#endif
+struct S9865 { int a; const char *s = "x//y"; };
+inline int f9865_0(int x) { return x * 0; }
+inline int f9865_1(int x) { return x * 1; }
+inline int f9865_2(int x) { return x * 2; }
+inline int f9865_3(int x) { return x * 3; }
+inline int f9865_4(int x) { return x * 4; }
+inline int f9865_5(int x) { return x * 5; }
+inline int f9865_6(int x) { return x * 6; }
+inline int f9865_7(int x) { return x * 7; }
+inline int f9865_8(int x) { return x * 8; }
+inline int f9865_9(int x) { return x * 9; }
+inline int f9865_10(int x) { return x * 10; }
+inline int f9865_11(int x) { return x * 11; }
+inline int f9865_12(int x) { return x * 12; }
+inline int f9865_13(int x) { return x * 13; }
+inline int f9865_14(int x) { return x * 14; }
+inline int f9865_15(int x) { return x * 15; }
+inline int f9865_16(int x) { return x * 16; }
+inline int f9865_17(int x) { return x * 17; }
+inline int f9865_18(int x) { return x * 18; }
+inline int f9865_19(int x) { return x * 19; }
+inline int f9865_20(int x) { return x * 20; }
+inline int f9865_21(int x) { return x * 21; }
+inline int f9865_22(int x) { return x * 22; }
+inline int f9865_23(int x) { return x * 23; }
+inline int f9865_24(int x) { return x * 24; }
+inline int f9865_25(int x) { return x * 25; }
+inline int f9865_26(int x) { return x * 26; }
+inline int f9865_27(int x) { return x * 27; }
+inline int f9865_28(int x) { return x * 28; }
+inline int f9865_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9867 */
+#include <vector>
+#include "h8113.h"
+#include "h2031.h"
+#include "h3627.h"
+#include "h3594.h"
+#include "h7341.h"
+#ifdef X
+#include "h6292.h"
+#endif
+struct S9867 { int a; const char *s = "x//y"; };
+inline int f9867_0(int x) { return x * 0; }
+inline int f9867_1(int x) { return x * 1; }
+inline int f9867_2(int x) { return x * 2; }
+inline int f9867_3(int x) { return x * 3; }
+inline int f9867_4(int x) { return x * 4; }
+inline int f9867_5(int x) { return x * 5; }
+inline int f9867_6(int x) { return x * 6; }
+inline int f9867_7(int x) { return x * 7; }
+inline int f9867_8(int x) { return x * 8; }
+inline int f9867_9(int x) { return x * 9; }
+inline int f9867_10(int x) { return x * 10; }
+inline int f9867_11(int x) { return x * 11; }
+inline int f9867_12(int x) { return x * 12; }
+inline int f9867_13(int x) { return x * 13; }
+inline int f9867_14(int x) { return x * 14; }
+inline int f9867_15(int x) { return x * 15; }
+inline int f9867_16(int x) { return x * 16; }
+inline int f9867_17(int x) { return x * 17; }
+inline int f9867_18(int x) { return x * 18; }
+inline int f9867_19(int x) { return x * 19; }
+inline int f9867_20(int x) { return x * 20; }
+inline int f9867_21(int x) { return x * 21; }
+inline int f9867_22(int x) { return x * 22; }
+inline int f9867_23(int x) { return x * 23; }
+inline int f9867_24(int x) { return x * 24; }
+inline int f9867_25(int x) { return x * 25; }
+inline int f9867_26(int x) { return x * 26; }
+inline int f9867_27(int x) { return x * 27; }
+inline int f9867_28(int x) { return x * 28; }
+inline int f9867_29(int x) { return x * 29; }
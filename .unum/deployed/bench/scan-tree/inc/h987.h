@@ -0,0 +1,42 @@
+#pragma once
+/* header 987 */
+#include <vector>
+#include "h1914.h"
+#include "h4187.h"
+#include "h1504.h"
+#include "h6533.h"
+#include "h321.h"
+#ifdef X
+#include "h7422.h"
+#endif
+struct S987 { int a; const char *s = "x//y"; };
+inline int f987_0(int x) { return x * 0; }
+inline int f987_1(int x) { return x * 1; }
+inline int f987_2(int x) { return x * 2; }
+inline int f987_3(int x) { return x * 3; }
+inline int f987_4(int x) { return x * 4; }
+inline int f987_5(int x) { return x * 5; }
+inline int f987_6(int x) { return x * 6; }
+inline int f987_7(int x) { return x * 7; }
+inline int f987_8(int x) { return x * 8; }
+inline int f987_9(int x) { return x * 9; }
+inline int f987_10(int x) { return x * 10; }
+inline int f987_11(int x) { return x * 11; }
+inline int f987_12(int x) { return x * 12; }
+inline int f987_13(int x) { return x * 13; }
+inline int f987_14(int x) { return x * 14; }
+inline int f987_15(int x) { return x * 15; }
+inline int f987_16(int x) { return x * 16; }
+inline int f987_17(int x) { return x * 17; }
+inline int f987_18(int x) { return x * 18; }
+inline int f987_19(int x) { return x * 19; }
+inline int f987_20(int x) { return x * 20; }
+inline int f987_21(int x) { return x * 21; }
+inline int f987_22(int x) { return x * 22; }
+inline int f987_23(int x) { return x * 23; }
+inline int f987_24(int x) { return x * 24; }
+inline int f987_25(int x) { return x * 25; }
+inline int f987_26(int x) { return x * 26; }
+inline int f987_27(int x) { return x * 27; }
+inline int f987_28(int x) { return x * 28; }
+inline int f987_29(int x) { return x * 29; }
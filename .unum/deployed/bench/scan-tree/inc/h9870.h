@@ -0,0 +1,42 @@
+#pragma once
+/* header 9870 */
+#include <vector>
+#include "h619.h"
+#include "h4762.h"
+#include "h2347.h"
+#include "h7224.h"
+#include "h9136.h"
+#ifdef X
+#include "h8947.h"
+#endif
+struct S9870 { int a; const char *s = "x//y"; };
+inline int f9870_0(int x) { return x * 0; }
+inline int f9870_1(int x) { return x * 1; }
+inline int f9870_2(int x) { return x * 2; }
+inline int f9870_3(int x) { return x * 3; }
+inline int f9870_4(int x) { return x * 4; }
+inline int f9870_5(int x) { return x * 5; }
+inline int f9870_6(int x) { return x * 6; }
+inline int f9870_7(int x) { return x * 7; }
+inline int f9870_8(int x) { return x * 8; }
+inline int f9870_9(int x) { return x * 9; }
+inline int f9870_10(int x) { return x * 10; }
+inline int f9870_11(int x) { return x * 11; }
+inline int f9870_12(int x) { return x * 12; }
+inline int f9870_13(int x) { return x * 13; }
+inline int f9870_14(int x) { return x * 14; }
+inline int f9870_15(int x) { return x * 15; }
+inline int f9870_16(int x) { return x * 16; }
+inline int f9870_17(int x) { return x * 17; }
+inline int f9870_18(int x) { return x * 18; }
+inline int f9870_19(int x) { return x * 19; }
+inline int f9870_20(int x) { return x * 20; }
+inline int f9870_21(int x) { return x * 21; }
+inline int f9870_22(int x) { return x * 22; }
+inline int f9870_23(int x) { return x * 23; }
+inline int f9870_24(int x) { return x * 24; }
+inline int f9870_25(int x) { return x * 25; }
+inline int f9870_26(int x) { return x * 26; }
+inline int f9870_27(int x) { return x * 27; }
+inline int f9870_28(int x) { return x * 28; }
+inline int f9870_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9872 */
+#include <vector>
+#include "h5449.h"
+#include "h5101.h"
+#include "h5783.h"
+#include "h3487.h"
+#include "h6656.h"
+#ifdef X
+#include "h1615.h"
+#endif
+struct S9872 { int a; const char *s = "x//y"; };
+inline int f9872_0(int x) { return x * 0; }
+inline int f9872_1(int x) { return x * 1; }
+inline int f9872_2(int x) { return x * 2; }
+inline int f9872_3(int x) { return x * 3; }
+inline int f9872_4(int x) { return x * 4; }
+inline int f9872_5(int x) { return x * 5; }
+inline int f9872_6(int x) { return x * 6; }
+inline int f9872_7(int x) { return x * 7; }
+inline int f9872_8(int x) { return x * 8; }
+inline int f9872_9(int x) { return x * 9; }
+inline int f9872_10(int x) { return x * 10; }
+inline int f9872_11(int x) { return x * 11; }
+inline int f9872_12(int x) { return x * 12; }
+inline int f9872_13(int x) { return x * 13; }
+inline int f9872_14(int x) { return x * 14; }
+inline int f9872_15(int x) { return x * 15; }
+inline int f9872_16(int x) { return x * 16; }
+inline int f9872_17(int x) { return x * 17; }
+inline int f9872_18(int x) { return x * 18; }
+inline int f9872_19(int x) { return x * 19; }
+inline int f9872_20(int x) { return x * 20; }
+inline int f9872_21(int x) { return x * 21; }
+inline int f9872_22(int x) { return x * 22; }
+inline int f9872_23(int x) { return x * 23; }
+inline int f9872_24(int x) { return x * 24; }
+inline int f9872_25(int x) { return x * 25; }
+inline int f9872_26(int x) { return x * 26; }
+inline int f9872_27(int x) { return x * 27; }
+inline int f9872_28(int x) { return x * 28; }
+inline int f9872_29(int x) { return x * 29; }
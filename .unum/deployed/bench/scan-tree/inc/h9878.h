@@ -0,0 +1,42 @@
+#pragma once
+/* header 9878 */
+#include <vector>
+#include "h8597.h"
+#include "h6242.h"
+#include "h6186.h"
+#include "h6206.h"
+#include "h6211.h"
+#ifdef X
+#include "h3080.h"
+#endif
+struct S9878 { int a; const char *s = "x//y"; };
+inline int f9878_0(int x) { return x * 0; }
+inline int f9878_1(int x) { return x * 1; }
+inline int f9878_2(int x) { return x * 2; }
+inline int f9878_3(int x) { return x * 3; }
+inline int f9878_4(int x) { return x * 4; }
+inline int f9878_5(int x) { return x * 5; }
+inline int f9878_6(int x) { return x * 6; }
+inline int f9878_7(int x) { return x * 7; }
+inline int f9878_8(int x) { return x * 8; }
+inline int f9878_9(int x) { return x * 9; }
+inline int f9878_10(int x) { return x * 10; }
+inline int f9878_11(int x) { return x * 11; }
+inline int f9878_12(int x) { return x * 12; }
+inline int f9878_13(int x) { return x * 13; }
+inline int f9878_14(int x) { return x * 14; }
+inline int f9878_15(int x) { return x * 15; }
+inline int f9878_16(int x) { return x * 16; }
+inline int f9878_17(int x) { return x * 17; }
+inline int f9878_18(int x) { return x * 18; }
+inline int f9878_19(int x) { return x * 19; }
+inline int f9878_20(int x) { return x * 20; }
+inline int f9878_21(int x) { return x * 21; }
+inline int f9878_22(int x) { return x * 22; }
+inline int f9878_23(int x) { return x * 23; }
+inline int f9878_24(int x) { return x * 24; }
+inline int f9878_25(int x) { return x * 25; }
+inline int f9878_26(int x) { return x * 26; }
+inline int f9878_27(int x) { return x * 27; }
+inline int f9878_28(int x) { return x * 28; }
+inline int f9878_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9880 */
+#include <vector>
+#include "h9419.h"
+#include "h5901.h"
+#include "h5288.h"
+#include "h316.h"
+#include "h395.h"
+#ifdef X
+#include "h4877.h"
+#endif
+struct S9880 { int a; const char *s = "x//y"; };
+inline int f9880_0(int x) { return x * 0; }
+inline int f9880_1(int x) { return x * 1; }
+inline int f9880_2(int x) { return x * 2; }
+inline int f9880_3(int x) { return x * 3; }
+inline int f9880_4(int x) { return x * 4; }
+inline int f9880_5(int x) { return x * 5; }
+inline int f9880_6(int x) { return x * 6; }
+inline int f9880_7(int x) { return x * 7; }
+inline int f9880_8(int x) { return x * 8; }
+inline int f9880_9(int x) { return x * 9; }
+inline int f9880_10(int x) { return x * 10; }
+inline int f9880_11(int x) { return x * 11; }
+inline int f9880_12(int x) { return x * 12; }
+inline int f9880_13(int x) { return x * 13; }
+inline int f9880_14(int x) { return x * 14; }
+inline int f9880_15(int x) { return x * 15; }
+inline int f9880_16(int x) { return x * 16; }
+inline int f9880_17(int x) { return x * 17; }
+inline int f9880_18(int x) { return x * 18; }
+inline int f9880_19(int x) { return x * 19; }
+inline int f9880_20(int x) { return x * 20; }
+inline int f9880_21(int x) { return x * 21; }
+inline int f9880_22(int x) { return x * 22; }
+inline int f9880_23(int x) { return x * 23; }
+inline int f9880_24(int x) { return x * 24; }
+inline int f9880_25(int x) { return x * 25; }
+inline int f9880_26(int x) { return x * 26; }
+inline int f9880_27(int x) { return x * 27; }
+inline int f9880_28(int x) { return x * 28; }
+inline int f9880_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9883 */
+#include <vector>
+#include "h4577.h"
+#include "h211.h"
+#include "h4496.h"
+#include "h8497.h"
+#include "h627.h"
+#ifdef X
+#include "h6761.h"
+#endif
+struct S9883 { int a; const char *s = "x//y"; };
+inline int f9883_0(int x) { return x * 0; }
+inline int f9883_1(int x) { return x * 1; }
+inline int f9883_2(int x) { return x * 2; }
+inline int f9883_3(int x) { return x * 3; }
+inline int f9883_4(int x) { return x * 4; }
+inline int f9883_5(int x) { return x * 5; }
+inline int f9883_6(int x) { return x * 6; }
+inline int f9883_7(int x) { return x * 7; }
+inline int f9883_8(int x) { return x * 8; }
+inline int f9883_9(int x) { return x * 9; }
+inline int f9883_10(int x) { return x * 10; }
+inline int f9883_11(int x) { return x * 11; }
+inline int f9883_12(int x) { return x * 12; }
+inline int f9883_13(int x) { return x * 13; }
+inline int f9883_14(int x) { return x * 14; }
+inline int f9883_15(int x) { return x * 15; }
+inline int f9883_16(int x) { return x * 16; }
+inline int f9883_17(int x) { return x * 17; }
+inline int f9883_18(int x) { return x * 18; }
+inline int f9883_19(int x) { return x * 19; }
+inline int f9883_20(int x) { return x * 20; }
+inline int f9883_21(int x) { return x * 21; }
+inline int f9883_22(int x) { return x * 22; }
+inline int f9883_23(int x) { return x * 23; }
+inline int f9883_24(int x) { return x * 24; }
+inline int f9883_25(int x) { return x * 25; }
+inline int f9883_26(int x) { return x * 26; }
+inline int f9883_27(int x) { return x * 27; }
+inline int f9883_28(int x) { return x * 28; }
+inline int f9883_29(int x) { return x * 29; }
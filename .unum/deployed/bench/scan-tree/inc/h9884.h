@@ -0,0 +1,42 @@
+#pragma once
+/* header 9884 */
+#include <vector>
+#include "h7081.h"
+#include "h1772.h"
+#include "h1970.h"
+#include "h7524.h"
+#include "h4842.h"
+#ifdef X
+#include "h910.h"
+#endif
+struct S9884 { int a; const char *s = "x//y"; };
+inline int f9884_0(int x) { return x * 0; }
+inline int f9884_1(int x) { return x * 1; }
+inline int f9884_2(int x) { return x * 2; }
+inline int f9884_3(int x) { return x * 3; }
+inline int f9884_4(int x) { return x * 4; }
+inline int f9884_5(int x) { return x * 5; }
+inline int f9884_6(int x) { return x * 6; }
+inline int f9884_7(int x) { return x * 7; }
+inline int f9884_8(int x) { return x * 8; }
+inline int f9884_9(int x) { return x * 9; }
+inline int f9884_10(int x) { return x * 10; }
+inline int f9884_11(int x) { return x * 11; }
+inline int f9884_12(int x) { return x * 12; }
+inline int f9884_13(int x) { return x * 13; }
+inline int f9884_14(int x) { return x * 14; }
+inline int f9884_15(int x) { return x * 15; }
+inline int f9884_16(int x) { return x * 16; }
+inline int f9884_17(int x) { return x * 17; }
+inline int f9884_18(int x) { return x * 18; }
+inline int f9884_19(int x) { return x * 19; }
+inline int f9884_20(int x) { return x * 20; }
+inline int f9884_21(int x) { return x * 21; }
+inline int f9884_22(int x) { return x * 22; }
+inline int f9884_23(int x) { return x * 23; }
+inline int f9884_24(int x) { return x * 24; }
+inline int f9884_25(int x) { return x * 25; }
+inline int f9884_26(int x) { return x * 26; }
+inline int f9884_27(int x) { return x * 27; }
+inline int f9884_28(int x) { return x * 28; }
+inline int f9884_29(int x) { return x * 29; }
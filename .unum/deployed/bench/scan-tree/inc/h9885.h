@@ -0,0 +1,42 @@
+#pragma once
+/* header 9885 */
+#include <vector>
+#include "h2807.h"
+#include "h9754.h"
+#include "h9173.h"
+#include "h5705.h"
+#include "h7066.h"
+#ifdef X
+#include "h1758.h"
+#endif
+struct S9885 { int a; const char *s = "x//y"; };
+inline int f9885_0(int x) { return x * 0; }
+inline int f9885_1(int x) { return x * 1; }
+inline int f9885_2(int x) { return x * 2; }
+inline int f9885_3(int x) { return x * 3; }
+inline int f9885_4(int x) { return x * 4; }
+inline int f9885_5(int x) { return x * 5; }
+inline int f9885_6(int x) { return x * 6; }
+inline int f9885_7(int x) { return x * 7; }
+inline int f9885_8(int x) { return x * 8; }
+inline int f9885_9(int x) { return x * 9; }
+inline int f9885_10(int x) { return x * 10; }
+inline int f9885_11(int x) { return x * 11; }
+inline int f9885_12(int x) { return x * 12; }
+inline int f9885_13(int x) { return x * 13; }
+inline int f9885_14(int x) { return x * 14; }
+inline int f9885_15(int x) { return x * 15; }
+inline int f9885_16(int x) { return x * 16; }
+inline int f9885_17(int x) { return x * 17; }
+inline int f9885_18(int x) { return x * 18; }
+inline int f9885_19(int x) { return x * 19; }
+inline int f9885_20(int x) { return x * 20; }
+inline int f9885_21(int x) { return x * 21; }
+inline int f9885_22(int x) { return x * 22; }
+inline int f9885_23(int x) { return x * 23; }
+inline int f9885_24(int x) { return x * 24; }
+inline int f9885_25(int x) { return x * 25; }
+inline int f9885_26(int x) { return x * 26; }
+inline int f9885_27(int x) { return x * 27; }
+inline int f9885_28(int x) { return x * 28; }
+inline int f9885_29(int x) { return x * 29; }
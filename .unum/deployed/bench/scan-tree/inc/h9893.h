@@ -0,0 +1,42 @@
+#pragma once
+/* header 9893 */
+#include <vector>
+#include "h7044.h"
+#include "h4333.h"
+#include "h626.h"
+#include "h6659.h"
+#include "h2148.h"
+#ifdef X
+#include "h2524.h"
+#endif
+struct S9893 { int a; const char *s = "x//y"; };
+inline int f9893_0(int x) { return x * 0; }
+inline int f9893_1(int x) { return x * 1; }
+inline int f9893_2(int x) { return x * 2; }
+inline int f9893_3(int x) { return x * 3; }
+inline int f9893_4(int x) { return x * 4; }
+inline int f9893_5(int x) { return x * 5; }
+inline int f9893_6(int x) { return x * 6; }
+inline int f9893_7(int x) { return x * 7; }
+inline int f9893_8(int x) { return x * 8; }
+inline int f9893_9(int x) { return x * 9; }
+inline int f9893_10(int x) { return x * 10; }
+inline int f9893_11(int x) { return x * 11; }
+inline int f9893_12(int x) { return x * 12; }
+inline int f9893_13(int x) { return x * 13; }
+inline int f9893_14(int x) { return x * 14; }
+inline int f9893_15(int x) { return x * 15; }
+inline int f9893_16(int x) { return x * 16; }
+inline int f9893_17(int x) { return x * 17; }
+inline int f9893_18(int x) { return x * 18; }
+inline int f9893_19(int x) { return x * 19; }
+inline int f9893_20(int x) { return x * 20; }
+inline int f9893_21(int x) { return x * 21; }
+inline int f9893_22(int x) { return x * 22; }
+inline int f9893_23(int x) { return x * 23; }
+inline int f9893_24(int x) { return x * 24; }
+inline int f9893_25(int x) { return x * 25; }
+inline int f9893_26(int x) { return x * 26; }
+inline int f9893_27(int x) { return x * 27; }
+inline int f9893_28(int x) { return x * 28; }
+inline int f9893_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9895 */
+#include <vector>
+#include "h971.h"
+#include "h8293.h"
+#include "h5446.h"
+#include "h39.h"
+#include "h7587.h"
+#ifdef X
+#include "h1333.h"
+#endif
+struct S9895 { int a; const char *s = "x//y"; };
+inline int f9895_0(int x) { return x * 0; }
+inline int f9895_1(int x) { return x * 1; }
+inline int f9895_2(int x) { return x * 2; }
+inline int f9895_3(int x) { return x * 3; }
+inline int f9895_4(int x) { return x * 4; }
+inline int f9895_5(int x) { return x * 5; }
+inline int f9895_6(int x) { return x * 6; }
+inline int f9895_7(int x) { return x * 7; }
+inline int f9895_8(int x) { return x * 8; }
+inline int f9895_9(int x) { return x * 9; }
+inline int f9895_10(int x) { return x * 10; }
+inline int f9895_11(int x) { return x * 11; }
+inline int f9895_12(int x) { return x * 12; }
+inline int f9895_13(int x) { return x * 13; }
+inline int f9895_14(int x) { return x * 14; }
+inline int f9895_15(int x) { return x * 15; }
+inline int f9895_16(int x) { return x * 16; }
+inline int f9895_17(int x) { return x * 17; }
+inline int f9895_18(int x) { return x * 18; }
+inline int f9895_19(int x) { return x * 19; }
+inline int f9895_20(int x) { return x * 20; }
+inline int f9895_21(int x) { return x * 21; }
+inline int f9895_22(int x) { return x * 22; }
+inline int f9895_23(int x) { return x * 23; }
+inline int f9895_24(int x) { return x * 24; }
+inline int f9895_25(int x) { return x * 25; }
+inline int f9895_26(int x) { return x * 26; }
+inline int f9895_27(int x) { return x * 27; }
+inline int f9895_28(int x) { return x * 28; }
+inline int f9895_29(int x) { return x * 29; }
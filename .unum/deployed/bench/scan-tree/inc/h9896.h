@@ -0,0 +1,42 @@
+#pragma once
+/* header 9896 */
+#include <vector>
+#include "h825.h"
+#include "h6341.h"
+#include "h1459.h"
+#include "h5621.h"
+#include "h6541.h"
+#ifdef X
+#include "h9956.h"
+#endif
+struct S9896 { int a; const char *s = "x//y"; };
+inline int f9896_0(int x) { return x * 0; }
+inline int f9896_1(int x) { return x * 1; }
+inline int f9896_2(int x) { return x * 2; }
+inline int f9896_3(int x) { return x * 3; }
+inline int f9896_4(int x) { return x * 4; }
+inline int f9896_5(int x) { return x * 5; }
+inline int f9896_6(int x) { return x * 6; }
+inline int f9896_7(int x) { return x * 7; }
+inline int f9896_8(int x) { return x * 8; }
+inline int f9896_9(int x) { return x * 9; }
+inline int f9896_10(int x) { return x * 10; }
+inline int f9896_11(int x) { return x * 11; }
+inline int f9896_12(int x) { return x * 12; }
+inline int f9896_13(int x) { return x * 13; }
+inline int f9896_14(int x) { return x * 14; }
+inline int f9896_15(int x) { return x * 15; }
+inline int f9896_16(int x) { return x * 16; }
+inline int f9896_17(int x) { return x * 17; }
+inline int f9896_18(int x) { return x * 18; }
+inline int f9896_19(int x) { return x * 19; }
+inline int f9896_20(int x) { return x * 20; }
+inline int f9896_21(int x) { return x * 21; }
+inline int f9896_22(int x) { return x * 22; }
+inline int f9896_23(int x) { return x * 23; }
+inline int f9896_24(int x) { return x * 24; }
+inline int f9896_25(int x) { return x * 25; }
+inline int f9896_26(int x) { return x * 26; }
+inline int f9896_27(int x) { return x * 27; }
+inline int f9896_28(int x) { return x * 28; }
+inline int f9896_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9897 */
+#include <vector>
+#include "h9305.h"
+#include "h462.h"
+#include "h4637.h"
+#include "h801.h"
+#include "h3689.h"
+#ifdef X
+#include "h1870.h"
+#endif
+struct S9897 { int a; const char *s = "x//y"; };
+inline int f9897_0(int x) { return x * 0; }
+inline int f9897_1(int x) { return x * 1; }
+inline int f9897_2(int x) { return x * 2; }
+inline int f9897_3(int x) { return x * 3; }
+inline int f9897_4(int x) { return x * 4; }
+inline int f9897_5(int x) { return x * 5; }
+inline int f9897_6(int x) { return x * 6; }
+inline int f9897_7(int x) { return x * 7; }
+inline int f9897_8(int x) { return x * 8; }
+inline int f9897_9(int x) { return x * 9; }
+inline int f9897_10(int x) { return x * 10; }
+inline int f9897_11(int x) { return x * 11; }
+inline int f9897_12(int x) { return x * 12; }
+inline int f9897_13(int x) { return x * 13; }
+inline int f9897_14(int x) { return x * 14; }
+inline int f9897_15(int x) { return x * 15; }
+inline int f9897_16(int x) { return x * 16; }
+inline int f9897_17(int x) { return x * 17; }
+inline int f9897_18(int x) { return x * 18; }
+inline int f9897_19(int x) { return x * 19; }
+inline int f9897_20(int x) { return x * 20; }
+inline int f9897_21(int x) { return x * 21; }
+inline int f9897_22(int x) { return x * 22; }
+inline int f9897_23(int x) { return x * 23; }
+inline int f9897_24(int x) { return x * 24; }
+inline int f9897_25(int x) { return x * 25; }
+inline int f9897_26(int x) { return x * 26; }
+inline int f9897_27(int x) { return x * 27; }
+inline int f9897_28(int x) { return x * 28; }
+inline int f9897_29(int x) { return x * 29; }
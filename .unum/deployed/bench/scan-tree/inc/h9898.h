@@ -0,0 +1,42 @@
+#pragma once
+/* header 9898 */
+#include <vector>
+#include "h8160.h"
+#include "h6001.h"
+#include "h7289.h"
+#include "h3723.h"
+#include "h6147.h"
+#ifdef X
+#include "h4322.h"
+#endif
+struct S9898 { int a; const char *s = "x//y"; };
+inline int f9898_0(int x) { return x * 0; }
+inline int f9898_1(int x) { return x * 1; }
+inline int f9898_2(int x) { return x * 2; }
+inline int f9898_3(int x) { return x * 3; }
+inline int f9898_4(int x) { return x * 4; }
+inline int f9898_5(int x) { return x * 5; }
+inline int f9898_6(int x) { return x * 6; }
+inline int f9898_7(int x) { return x * 7; }
+inline int f9898_8(int x) { return x * 8; }
+inline int f9898_9(int x) { return x * 9; }
+inline int f9898_10(int x) { return x * 10; }
+inline int f9898_11(int x) { return x * 11; }
+inline int f9898_12(int x) { return x * 12; }
+inline int f9898_13(int x) { return x * 13; }
+inline int f9898_14(int x) { return x * 14; }
+inline int f9898_15(int x) { return x * 15; }
+inline int f9898_16(int x) { return x * 16; }
+inline int f9898_17(int x) { return x * 17; }
+inline int f9898_18(int x) { return x * 18; }
+inline int f9898_19(int x) { return x * 19; }
+inline int f9898_20(int x) { return x * 20; }
+inline int f9898_21(int x) { return x * 21; }
+inline int f9898_22(int x) { return x * 22; }
+inline int f9898_23(int x) { return x * 23; }
+inline int f9898_24(int x) { return x * 24; }
+inline int f9898_25(int x) { return x * 25; }
+inline int f9898_26(int x) { return x * 26; }
+inline int f9898_27(int x) { return x * 27; }
+inline int f9898_28(int x) { return x * 28; }
+inline int f9898_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9899 */
+#include <vector>
+#include "h5893.h"
+#include "h1.h"
+#include "h3071.h"
+#include "h7939.h"
+#include "h8139.h"
+#ifdef X
+#include "h1075.h"
+#endif
+struct S9899 { int a; const char *s = "x//y"; };
+inline int f9899_0(int x) { return x * 0; }
+inline int f9899_1(int x) { return x * 1; }
+inline int f9899_2(int x) { return x * 2; }
+inline int f9899_3(int x) { return x * 3; }
+inline int f9899_4(int x) { return x * 4; }
+inline int f9899_5(int x) { return x * 5; }
+inline int f9899_6(int x) { return x * 6; }
+inline int f9899_7(int x) { return x * 7; }
+inline int f9899_8(int x) { return x * 8; }
+inline int f9899_9(int x) { return x * 9; }
+inline int f9899_10(int x) { return x * 10; }
+inline int f9899_11(int x) { return x * 11; }
+inline int f9899_12(int x) { return x * 12; }
+inline int f9899_13(int x) { return x * 13; }
+inline int f9899_14(int x) { return x * 14; }
+inline int f9899_15(int x) { return x * 15; }
+inline int f9899_16(int x) { return x * 16; }
+inline int f9899_17(int x) { return x * 17; }
+inline int f9899_18(int x) { return x * 18; }
+inline int f9899_19(int x) { return x * 19; }
+inline int f9899_20(int x) { return x * 20; }
+inline int f9899_21(int x) { return x * 21; }
+inline int f9899_22(int x) { return x * 22; }
+inline int f9899_23(int x) { return x * 23; }
+inline int f9899_24(int x) { return x * 24; }
+inline int f9899_25(int x) { return x * 25; }
+inline int f9899_26(int x) { return x * 26; }
+inline int f9899_27(int x) { return x * 27; }
+inline int f9899_28(int x) { return x * 28; }
+inline int f9899_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 99 */
+#include <vector>
+#include "h4922.h"
+#include "h1642.h"
+#include "h9802.h"
+#include "h8019.h"
+#include "h1841.h"
+#ifdef X
+#include "h5016.h"
+#endif
+struct S99 { int a; const char *s = "x//y"; };
+inline int f99_0(int x) { return x * 0; }
+inline int f99_1(int x) { return x * 1; }
+inline int f99_2(int x) { return x * 2; }
+inline int f99_3(int x) { return x * 3; }
+inline int f99_4(int x) { return x * 4; }
+inline int f99_5(int x) { return x * 5; }
+inline int f99_6(int x) { return x * 6; }
+inline int f99_7(int x) { return x * 7; }
+inline int f99_8(int x) { return x * 8; }
+inline int f99_9(int x) { return x * 9; }
+inline int f99_10(int x) { return x * 10; }
+inline int f99_11(int x) { return x * 11; }
+inline int f99_12(int x) { return x * 12; }
+inline int f99_13(int x) { return x * 13; }
+inline int f99_14(int x) { return x * 14; }
+inline int f99_15(int x) { return x * 15; }
+inline int f99_16(int x) { return x * 16; }
+inline int f99_17(int x) { return x * 17; }
+inline int f99_18(int x) { return x * 18; }
+inline int f99_19(int x) { return x * 19; }
+inline int f99_20(int x) { return x * 20; }
+inline int f99_21(int x) { return x * 21; }
+inline int f99_22(int x) { return x * 22; }
+inline int f99_23(int x) { return x * 23; }
+inline int f99_24(int x) { return x * 24; }
+inline int f99_25(int x) { return x * 25; }
+inline int f99_26(int x) { return x * 26; }
+inline int f99_27(int x) { return x * 27; }
+inline int f99_28(int x) { return x * 28; }
+inline int f99_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9902 */
+#include <vector>
+#include "h8148.h"
+#include "h6375.h"
+#include "h6683.h"
+#include "h2652.h"
+#include "h3433.h"
+#ifdef X
+#include "h8477.h"
+#endif
+struct S9902 { int a; const char *s = "x//y"; };
+inline int f9902_0(int x) { return x * 0; }
+inline int f9902_1(int x) { return x * 1; }
+inline int f9902_2(int x) { return x * 2; }
+inline int f9902_3(int x) { return x * 3; }
+inline int f9902_4(int x) { return x * 4; }
+inline int f9902_5(int x) { return x * 5; }
+inline int f9902_6(int x) { return x * 6; }
+inline int f9902_7(int x) { return x * 7; }
+inline int f9902_8(int x) { return x * 8; }
+inline int f9902_9(int x) { return x * 9; }
+inline int f9902_10(int x) { return x * 10; }
+inline int f9902_11(int x) { return x * 11; }
+inline int f9902_12(int x) { return x * 12; }
+inline int f9902_13(int x) { return x * 13; }
+inline int f9902_14(int x) { return x * 14; }
+inline int f9902_15(int x) { return x * 15; }
+inline int f9902_16(int x) { return x * 16; }
+inline int f9902_17(int x) { return x * 17; }
+inline int f9902_18(int x) { return x * 18; }
+inline int f9902_19(int x) { return x * 19; }
+inline int f9902_20(int x) { return x * 20; }
+inline int f9902_21(int x) { return x * 21; }
+inline int f9902_22(int x) { return x * 22; }
+inline int f9902_23(int x) { return x * 23; }
+inline int f9902_24(int x) { return x * 24; }
+inline int f9902_25(int x) { return x * 25; }
+inline int f9902_26(int x) { return x * 26; }
+inline int f9902_27(int x) { return x * 27; }
+inline int f9902_28(int x) { return x * 28; }
+inline int f9902_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9904 */
+#include <vector>
+#include "h4429.h"
+#include "h9893.h"
+#include "h1928.h"
+#include "h7413.h"
+#include "h3996.h"
+#ifdef X
+#include "h9595.h"
+#endif
+struct S9904 { int a; const char *s = "x//y"; };
+inline int f9904_0(int x) { return x * 0; }
+inline int f9904_1(int x) { return x * 1; }
+inline int f9904_2(int x) { return x * 2; }
+inline int f9904_3(int x) { return x * 3; }
+inline int f9904_4(int x) { return x * 4; }
+inline int f9904_5(int x) { return x * 5; }
+inline int f9904_6(int x) { return x * 6; }
+inline int f9904_7(int x) { return x * 7; }
+inline int f9904_8(int x) { return x * 8; }
+inline int f9904_9(int x) { return x * 9; }
+inline int f9904_10(int x) { return x * 10; }
+inline int f9904_11(int x) { return x * 11; }
+inline int f9904_12(int x) { return x * 12; }
+inline int f9904_13(int x) { return x * 13; }
+inline int f9904_14(int x) { return x * 14; }
+inline int f9904_15(int x) { return x * 15; }
+inline int f9904_16(int x) { return x * 16; }
+inline int f9904_17(int x) { return x * 17; }
+inline int f9904_18(int x) { return x * 18; }
+inline int f9904_19(int x) { return x * 19; }
+inline int f9904_20(int x) { return x * 20; }
+inline int f9904_21(int x) { return x * 21; }
+inline int f9904_22(int x) { return x * 22; }
+inline int f9904_23(int x) { return x * 23; }
+inline int f9904_24(int x) { return x * 24; }
+inline int f9904_25(int x) { return x * 25; }
+inline int f9904_26(int x) { return x * 26; }
+inline int f9904_27(int x) { return x * 27; }
+inline int f9904_28(int x) { return x * 28; }
+inline int f9904_29(int x) { return x * 29; }
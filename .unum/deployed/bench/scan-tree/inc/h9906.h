@@ -0,0 +1,42 @@
+#pragma once
+/* header 9906 */
+#include <vector>
+#include "h6540.h"
+#include "h7997.h"
+#include "h1826.h"
+#include "h9159.h"
+#include "h5884.h"
+#ifdef X
+#include "h5064.h"
+#endif
+struct S9906 { int a; const char *s = "x//y"; };
+inline int f9906_0(int x) { return x * 0; }
+inline int f9906_1(int x) { return x * 1; }
+inline int f9906_2(int x) { return x * 2; }
+inline int f9906_3(int x) { return x * 3; }
+inline int f9906_4(int x) { return x * 4; }
+inline int f9906_5(int x) { return x * 5; }
+inline int f9906_6(int x) { return x * 6; }
+inline int f9906_7(int x) { return x * 7; }
+inline int f9906_8(int x) { return x * 8; }
+inline int f9906_9(int x) { return x * 9; }
+inline int f9906_10(int x) { return x * 10; }
+inline int f9906_11(int x) { return x * 11; }
+inline int f9906_12(int x) { return x * 12; }
+inline int f9906_13(int x) { return x * 13; }
+inline int f9906_14(int x) { return x * 14; }
+inline int f9906_15(int x) { return x * 15; }
+inline int f9906_16(int x) { return x * 16; }
+inline int f9906_17(int x) { return x * 17; }
+inline int f9906_18(int x) { return x * 18; }
+inline int f9906_19(int x) { return x * 19; }
+inline int f9906_20(int x) { return x * 20; }
+inline int f9906_21(int x) { return x * 21; }
+inline int f9906_22(int x) { return x * 22; }
+inline int f9906_23(int x) { return x * 23; }
+inline int f9906_24(int x) { return x * 24; }
+inline int f9906_25(int x) { return x * 25; }
+inline int f9906_26(int x) { return x * 26; }
+inline int f9906_27(int x) { return x * 27; }
+inline int f9906_28(int x) { return x * 28; }
+inline int f9906_29(int x) { return x * 29; }
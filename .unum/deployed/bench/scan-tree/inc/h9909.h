@@ -0,0 +1,42 @@
+#pragma once
+/* header 9909 */
+#include <vector>
+#include "h8042.h"
+#include "h6779.h"
+#include "h5809.h"
+#include "h7962.h"
+#include "h9059.h"
+#ifdef X
+#include "h504.h"
+#endif
+struct S9909 { int a; const char *s = "x//y"; };
+inline int f9909_0(int x) { return x * 0; }
+inline int f9909_1(int x) { return x * 1; }
+inline int f9909_2(int x) { return x * 2; }
+inline int f9909_3(int x) { return x * 3; }
+inline int f9909_4(int x) { return x * 4; }
+inline int f9909_5(int x) { return x * 5; }
+inline int f9909_6(int x) { return x * 6; }
+inline int f9909_7(int x) { return x * 7; }
+inline int f9909_8(int x) { return x * 8; }
+inline int f9909_9(int x) { return x * 9; }
+inline int f9909_10(int x) { return x * 10; }
+inline int f9909_11(int x) { return x * 11; }
+inline int f9909_12(int x) { return x * 12; }
+inline int f9909_13(int x) { return x * 13; }
+inline int f9909_14(int x) { return x * 14; }
+inline int f9909_15(int x) { return x * 15; }
+inline int f9909_16(int x) { return x * 16; }
+inline int f9909_17(int x) { return x * 17; }
+inline int f9909_18(int x) { return x * 18; }
+inline int f9909_19(int x) { return x * 19; }
+inline int f9909_20(int x) { return x * 20; }
+inline int f9909_21(int x) { return x * 21; }
+inline int f9909_22(int x) { return x * 22; }
+inline int f9909_23(int x) { return x * 23; }
+inline int f9909_24(int x) { return x * 24; }
+inline int f9909_25(int x) { return x * 25; }
+inline int f9909_26(int x) { return x * 26; }
+inline int f9909_27(int x) { return x * 27; }
+inline int f9909_28(int x) { return x * 28; }
+inline int f9909_29(int x) { return x * 29; }
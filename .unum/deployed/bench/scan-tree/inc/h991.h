@@ -0,0 +1,42 @@
+#pragma once
+/* header 991 */
+#include <vector>
+#include "h4594.h"
+#include "h9879.h"
+#include "h3376.h"
+#include "h7643.h"
+#include "h1193.h"
+#ifdef X
+#include "h7383.h"
+#endif
+struct S991 { int a; const char *s = "x//y"; };
+inline int f991_0(int x) { return x * 0; }
+inline int f991_1(int x) { return x * 1; }
+inline int f991_2(int x) { return x * 2; }
+inline int f991_3(int x) { return x * 3; }
+inline int f991_4(int x) { return x * 4; }
+inline int f991_5(int x) { return x * 5; }
+inline int f991_6(int x) { return x * 6; }
+inline int f991_7(int x) { return x * 7; }
+inline int f991_8(int x) { return x * 8; }
+inline int f991_9(int x) { return x * 9; }
+inline int f991_10(int x) { return x * 10; }
+inline int f991_11(int x) { return x * 11; }
+inline int f991_12(int x) { return x * 12; }
+inline int f991_13(int x) { return x * 13; }
+inline int f991_14(int x) { return x * 14; }
+inline int f991_15(int x) { return x * 15; }
+inline int f991_16(int x) { return x * 16; }
+inline int f991_17(int x) { return x * 17; }
+inline int f991_18(int x) { return x * 18; }
+inline int f991_19(int x) { return x * 19; }
+inline int f991_20(int x) { return x * 20; }
+inline int f991_21(int x) { return x * 21; }
+inline int f991_22(int x) { return x * 22; }
+inline int f991_23(int x) { return x * 23; }
+inline int f991_24(int x) { return x * 24; }
+inline int f991_25(int x) { return x * 25; }
+inline int f991_26(int x) { return x * 26; }
+inline int f991_27(int x) { return x * 27; }
+inline int f991_28(int x) { return x * 28; }
+inline int f991_29(int x) { return x * 29; }
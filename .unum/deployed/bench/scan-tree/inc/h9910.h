@@ -0,0 +1,42 @@
+#pragma once
+/* header 9910 */
+#include <vector>
+#include "h1813.h"
+#include "h7517.h"
+#include "h3391.h"
+#include "h2057.h"
+#include "h3908.h"
+#ifdef X
+#include "h3584.h"
+#endif
+struct S9910 { int a; const char *s = "x//y"; };
+inline int f9910_0(int x) { return x * 0; }
+inline int f9910_1(int x) { return x * 1; }
+inline int f9910_2(int x) { return x * 2; }
+inline int f9910_3(int x) { return x * 3; }
+inline int f9910_4(int x) { return x * 4; }
+inline int f9910_5(int x) { return x * 5; }
+inline int f9910_6(int x) { return x * 6; }
+inline int f9910_7(int x) { return x * 7; }
+inline int f9910_8(int x) { return x * 8; }
+inline int f9910_9(int x) { return x * 9; }
+inline int f9910_10(int x) { return x * 10; }
+inline int f9910_11(int x) { return x * 11; }
+inline int f9910_12(int x) { return x * 12; }
+inline int f9910_13(int x) { return x * 13; }
+inline int f9910_14(int x) { return x * 14; }
+inline int f9910_15(int x) { return x * 15; }
+inline int f9910_16(int x) { return x * 16; }
+inline int f9910_17(int x) { return x * 17; }
+inline int f9910_18(int x) { return x * 18; }
+inline int f9910_19(int x) { return x * 19; }
+inline int f9910_20(int x) { return x * 20; }
+inline int f9910_21(int x) { return x * 21; }
+inline int f9910_22(int x) { return x * 22; }
+inline int f9910_23(int x) { return x * 23; }
+inline int f9910_24(int x) { return x * 24; }
+inline int f9910_25(int x) { return x * 25; }
+inline int f9910_26(int x) { return x * 26; }
+inline int f9910_27(int x) { return x * 27; }
+inline int f9910_28(int x) { return x * 28; }
+inline int f9910_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9912 */
+#include <vector>
+#include "h682.h"
+#include "h6363.h"
+#include "h6545.h"
+#include "h4043.h"
+#include "h9275.h"
+#ifdef X
+#include "h5199.h"
+#endif
+struct S9912 { int a; const char *s = "x//y"; };
+inline int f9912_0(int x) { return x * 0; }
+inline int f9912_1(int x) { return x * 1; }
+inline int f9912_2(int x) { return x * 2; }
+inline int f9912_3(int x) { return x * 3; }
+inline int f9912_4(int x) { return x * 4; }
+inline int f9912_5(int x) { return x * 5; }
+inline int f9912_6(int x) { return x * 6; }
+inline int f9912_7(int x) { return x * 7; }
+inline int f9912_8(int x) { return x * 8; }
+inline int f9912_9(int x) { return x * 9; }
+inline int f9912_10(int x) { return x * 10; }
+inline int f9912_11(int x) { return x * 11; }
+inline int f9912_12(int x) { return x * 12; }
+inline int f9912_13(int x) { return x * 13; }
+inline int f9912_14(int x) { return x * 14; }
+inline int f9912_15(int x) { return x * 15; }
+inline int f9912_16(int x) { return x * 16; }
+inline int f9912_17(int x) { return x * 17; }
+inline int f9912_18(int x) { return x * 18; }
+inline int f9912_19(int x) { return x * 19; }
+inline int f9912_20(int x) { return x * 20; }
+inline int f9912_21(int x) { return x * 21; }
+inline int f9912_22(int x) { return x * 22; }
+inline int f9912_23(int x) { return x * 23; }
+inline int f9912_24(int x) { return x * 24; }
+inline int f9912_25(int x) { return x * 25; }
+inline int f9912_26(int x) { return x * 26; }
+inline int f9912_27(int x) { return x * 27; }
+inline int f9912_28(int x) { return x * 28; }
+inline int f9912_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9913 */
+#include <vector>
+#include "h1168.h"
+#include "h2533.h"
+#include "h6140.h"
+#include "h8030.h"
+#include "h4807.h"
+#ifdef X
+#include "h2242.h"
+#endif
+struct S9913 { int a; const char *s = "x//y"; };
+inline int f9913_0(int x) { return x * 0; }
+inline int f9913_1(int x) { return x * 1; }
+inline int f9913_2(int x) { return x * 2; }
+inline int f9913_3(int x) { return x * 3; }
+inline int f9913_4(int x) { return x * 4; }
+inline int f9913_5(int x) { return x * 5; }
+inline int f9913_6(int x) { return x * 6; }
+inline int f9913_7(int x) { return x * 7; }
+inline int f9913_8(int x) { return x * 8; }
+inline int f9913_9(int x) { return x * 9; }
+inline int f9913_10(int x) { return x * 10; }
+inline int f9913_11(int x) { return x * 11; }
+inline int f9913_12(int x) { return x * 12; }
+inline int f9913_13(int x) { return x * 13; }
+inline int f9913_14(int x) { return x * 14; }
+inline int f9913_15(int x) { return x * 15; }
+inline int f9913_16(int x) { return x * 16; }
+inline int f9913_17(int x) { return x * 17; }
+inline int f9913_18(int x) { return x * 18; }
+inline int f9913_19(int x) { return x * 19; }
+inline int f9913_20(int x) { return x * 20; }
+inline int f9913_21(int x) { return x * 21; }
+inline int f9913_22(int x) { return x * 22; }
+inline int f9913_23(int x) { return x * 23; }
+inline int f9913_24(int x) { return x * 24; }
+inline int f9913_25(int x) { return x * 25; }
+inline int f9913_26(int x) { return x * 26; }
+inline int f9913_27(int x) { return x * 27; }
+inline int f9913_28(int x) { return x * 28; }
+inline int f9913_29(int x) { return x * 29; }
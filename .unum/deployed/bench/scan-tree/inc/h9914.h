@@ -0,0 +1,42 @@
+#pragma once
+/* header 9914 */
+#include <vector>
+#include "h5375.h"
+#include "h8233.h"
+#include "h847.h"
+#include "h3877.h"
+#include "h3086.h"
+#ifdef X
+#include "h1567.h"
+#endif
+struct S9914 { int a; const char *s = "x//y"; };
+inline int f9914_0(int x) { return x * 0; }
+inline int f9914_1(int x) { return x * 1; }
+inline int f9914_2(int x) { return x * 2; }
+inline int f9914_3(int x) { return x * 3; }
+inline int f9914_4(int x) { return x * 4; }
+inline int f9914_5(int x) { return x * 5; }
+inline int f9914_6(int x) { return x * 6; }
+inline int f9914_7(int x) { return x * 7; }
+inline int f9914_8(int x) { return x * 8; }
+inline int f9914_9(int x) { return x * 9; }
+inline int f9914_10(int x) { return x * 10; }
+inline int f9914_11(int x) { return x * 11; }
+inline int f9914_12(int x) { return x * 12; }
+inline int f9914_13(int x) { return x * 13; }
+inline int f9914_14(int x) { return x * 14; }
+inline int f9914_15(int x) { return x * 15; }
+inline int f9914_16(int x) { return x * 16; }
+inline int f9914_17(int x) { return x * 17; }
+inline int f9914_18(int x) { return x * 18; }
+inline int f9914_19(int x) { return x * 19; }
+inline int f9914_20(int x) { return x * 20; }
+inline int f9914_21(int x) { return x * 21; }
+inline int f9914_22(int x) { return x * 22; }
+inline int f9914_23(int x) { return x * 23; }
+inline int f9914_24(int x) { return x * 24; }
+inline int f9914_25(int x) { return x * 25; }
+inline int f9914_26(int x) { return x * 26; }
+inline int f9914_27(int x) { return x * 27; }
+inline int f9914_28(int x) { return x * 28; }
+inline int f9914_29(int x) { return x * 29; }
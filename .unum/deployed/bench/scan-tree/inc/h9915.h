@@ -0,0 +1,42 @@
+#pragma once
+/* header 9915 */
+#include <vector>
+#include "h8686.h"
+#include "h2907.h"
+#include "h9137.h"
+#include "h3752.h"
+#include "h9361.h"
+#ifdef X
+#include "h7533.h"
+#endif
+struct S9915 { int a; const char *s = "x//y"; };
+inline int f9915_0(int x) { return x * 0; }
+inline int f9915_1(int x) { return x * 1; }
+inline int f9915_2(int x) { return x * 2; }
+inline int f9915_3(int x) { return x * 3; }
+inline int f9915_4(int x) { return x * 4; }
+inline int f9915_5(int x) { return x * 5; }
+inline int f9915_6(int x) { return x * 6; }
+inline int f9915_7(int x) { return x * 7; }
+inline int f9915_8(int x) { return x * 8; }
+inline int f9915_9(int x) { return x * 9; }
+inline int f9915_10(int x) { return x * 10; }
+inline int f9915_11(int x) { return x * 11; }
+inline int f9915_12(int x) { return x * 12; }
+inline int f9915_13(int x) { return x * 13; }
+inline int f9915_14(int x) { return x * 14; }
+inline int f9915_15(int x) { return x * 15; }
+inline int f9915_16(int x) { return x * 16; }
+inline int f9915_17(int x) { return x * 17; }
+inline int f9915_18(int x) { return x * 18; }
+inline int f9915_19(int x) { return x * 19; }
+inline int f9915_20(int x) { return x * 20; }
+inline int f9915_21(int x) { return x * 21; }
+inline int f9915_22(int x) { return x * 22; }
+inline int f9915_23(int x) { return x * 23; }
+inline int f9915_24(int x) { return x * 24; }
+inline int f9915_25(int x) { return x * 25; }
+inline int f9915_26(int x) { return x * 26; }
+inline int f9915_27(int x) { return x * 27; }
+inline int f9915_28(int x) { return x * 28; }
+inline int f9915_29(int x) { return x * 29; }
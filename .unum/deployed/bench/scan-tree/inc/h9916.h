@@ -0,0 +1,42 @@
+#pragma once
+/* header 9916 */
+#include <vector>
+#include "h3272.h"
+#include "h6876.h"
+#include "h8826.h"
+#include "h3906.h"
+#include "h1795.h"
+#ifdef X
+#include "h1135.h"
+#endif
+struct S9916 { int a; const char *s = "x//y"; };
+inline int f9916_0(int x) { return x * 0; }
+inline int f9916_1(int x) { return x * 1; }
+inline int f9916_2(int x) { return x * 2; }
+inline int f9916_3(int x) { return x * 3; }
+inline int f9916_4(int x) { return x * 4; }
+inline int f9916_5(int x) { return x * 5; }
+inline int f9916_6(int x) { return x * 6; }
+inline int f9916_7(int x) { return x * 7; }
+inline int f9916_8(int x) { return x * 8; }
+inline int f9916_9(int x) { return x * 9; }
+inline int f9916_10(int x) { return x * 10; }
+inline int f9916_11(int x) { return x * 11; }
+inline int f9916_12(int x) { return x * 12; }
+inline int f9916_13(int x) { return x * 13; }
+inline int f9916_14(int x) { return x * 14; }
+inline int f9916_15(int x) { return x * 15; }
+inline int f9916_16(int x) { return x * 16; }
+inline int f9916_17(int x) { return x * 17; }
+inline int f9916_18(int x) { return x * 18; }
+inline int f9916_19(int x) { return x * 19; }
+inline int f9916_20(int x) { return x * 20; }
+inline int f9916_21(int x) { return x * 21; }
+inline int f9916_22(int x) { return x * 22; }
+inline int f9916_23(int x) { return x * 23; }
+inline int f9916_24(int x) { return x * 24; }
+inline int f9916_25(int x) { return x * 25; }
+inline int f9916_26(int x) { return x * 26; }
+inline int f9916_27(int x) { return x * 27; }
+inline int f9916_28(int x) { return x * 28; }
+inline int f9916_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9918 */
+#include <vector>
+#include "h6366.h"
+#include "h1586.h"
+#include "h4580.h"
+#include "h573.h"
+#include "h8486.h"
+#ifdef X
+#include "h5846.h"
+#endif
+struct S9918 { int a; const char *s = "x//y"; };
+inline int f9918_0(int x) { return x * 0; }
+inline int f9918_1(int x) { return x * 1; }
+inline int f9918_2(int x) { return x * 2; }
+inline int f9918_3(int x) { return x * 3; }
+inline int f9918_4(int x) { return x * 4; }
+inline int f9918_5(int x) { return x * 5; }
+inline int f9918_6(int x) { return x * 6; }
+inline int f9918_7(int x) { return x * 7; }
+inline int f9918_8(int x) { return x * 8; }
+inline int f9918_9(int x) { return x * 9; }
+inline int f9918_10(int x) { return x * 10; }
+inline int f9918_11(int x) { return x * 11; }
+inline int f9918_12(int x) { return x * 12; }
+inline int f9918_13(int x) { return x * 13; }
+inline int f9918_14(int x) { return x * 14; }
+inline int f9918_15(int x) { return x * 15; }
+inline int f9918_16(int x) { return x * 16; }
+inline int f9918_17(int x) { return x * 17; }
+inline int f9918_18(int x) { return x * 18; }
+inline int f9918_19(int x) { return x * 19; }
+inline int f9918_20(int x) { return x * 20; }
+inline int f9918_21(int x) { return x * 21; }
+inline int f9918_22(int x) { return x * 22; }
+inline int f9918_23(int x) { return x * 23; }
+inline int f9918_24(int x) { return x * 24; }
+inline int f9918_25(int x) { return x * 25; }
+inline int f9918_26(int x) { return x * 26; }
+inline int f9918_27(int x) { return x * 27; }
+inline int f9918_28(int x) { return x * 28; }
+inline int f9918_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 992 */
+#include <vector>
+#include "h475.h"
+#include "h1270.h"
+#include "h4761.h"
+#include "h3035.h"
+#include "h4083.h"
+#ifdef X
+#include "h1901.h"
+#endif
+struct S992 { int a; const char *s = "x//y"; };
+inline int f992_0(int x) { return x * 0; }
+inline int f992_1(int x) { return x * 1; }
+inline int f992_2(int x) { return x * 2; }
+inline int f992_3(int x) { return x * 3; }
+inline int f992_4(int x) { return x * 4; }
+inline int f992_5(int x) { return x * 5; }
+inline int f992_6(int x) { return x * 6; }
+inline int f992_7(int x) { return x * 7; }
+inline int f992_8(int x) { return x * 8; }
+inline int f992_9(int x) { return x * 9; }
+inline int f992_10(int x) { return x * 10; }
+inline int f992_11(int x) { return x * 11; }
+inline int f992_12(int x) { return x * 12; }
+inline int f992_13(int x) { return x * 13; }
+inline int f992_14(int x) { return x * 14; }
+inline int f992_15(int x) { return x * 15; }
+inline int f992_16(int x) { return x * 16; }
+inline int f992_17(int x) { return x * 17; }
+inline int f992_18(int x) { return x * 18; }
+inline int f992_19(int x) { return x * 19; }
+inline int f992_20(int x) { return x * 20; }
+inline int f992_21(int x) { return x * 21; }
+inline int f992_22(int x) { return x * 22; }
+inline int f992_23(int x) { return x * 23; }
+inline int f992_24(int x) { return x * 24; }
+inline int f992_25(int x) { return x * 25; }
+inline int f992_26(int x) { return x * 26; }
+inline int f992_27(int x) { return x * 27; }
+inline int f992_28(int x) { return x * 28; }
+inline int f992_29(int x) { return x * 29; }
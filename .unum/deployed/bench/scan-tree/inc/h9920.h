@@ -0,0 +1,42 @@
+#pragma once
+/* header 9920 */
+#include <vector>
+#include "h9351.h"
+#include "h1904.h"
+#include "h4222.h"
+#include "h1422.h"
+#include "h1160.h"
+#ifdef X
+#include "h5328.h"
+#endif
+struct S9920 { int a; const char *s = "x//y"; };
+inline int f9920_0(int x) { return x * 0; }
+inline int f9920_1(int x) { return x * 1; }
+inline int f9920_2(int x) { return x * 2; }
+inline int f9920_3(int x) { return x * 3; }
+inline int f9920_4(int x) { return x * 4; }
+inline int f9920_5(int x) { return x * 5; }
+inline int f9920_6(int x) { return x * 6; }
+inline int f9920_7(int x) { return x * 7; }
+inline int f9920_8(int x) { return x * 8; }
+inline int f9920_9(int x) { return x * 9; }
+inline int f9920_10(int x) { return x * 10; }
+inline int f9920_11(int x) { return x * 11; }
+inline int f9920_12(int x) { return x * 12; }
+inline int f9920_13(int x) { return x * 13; }
+inline int f9920_14(int x) { return x * 14; }
+inline int f9920_15(int x) { return x * 15; }
+inline int f9920_16(int x) { return x * 16; }
+inline int f9920_17(int x) { return x * 17; }
+inline int f9920_18(int x) { return x * 18; }
+inline int f9920_19(int x) { return x * 19; }
+inline int f9920_20(int x) { return x * 20; }
+inline int f9920_21(int x) { return x * 21; }
+inline int f9920_22(int x) { return x * 22; }
+inline int f9920_23(int x) { return x * 23; }
+inline int f9920_24(int x) { return x * 24; }
+inline int f9920_25(int x) { return x * 25; }
+inline int f9920_26(int x) { return x * 26; }
+inline int f9920_27(int x) { return x * 27; }
+inline int f9920_28(int x) { return x * 28; }
+inline int f9920_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9922 */
+#include <vector>
+#include "h8296.h"
+#include "h5613.h"
+#include "h3340.h"
+#include "h2092.h"
+#include "h2697.h"
+#ifdef X
+#include "h5174.h"
+#endif
+struct S9922 { int a; const char *s = "x//y"; };
+inline int f9922_0(int x) { return x * 0; }
+inline int f9922_1(int x) { return x * 1; }
+inline int f9922_2(int x) { return x * 2; }
+inline int f9922_3(int x) { return x * 3; }
+inline int f9922_4(int x) { return x * 4; }
+inline int f9922_5(int x) { return x * 5; }
+inline int f9922_6(int x) { return x * 6; }
+inline int f9922_7(int x) { return x * 7; }
+inline int f9922_8(int x) { return x * 8; }
+inline int f9922_9(int x) { return x * 9; }
+inline int f9922_10(int x) { return x * 10; }
+inline int f9922_11(int x) { return x * 11; }
+inline int f9922_12(int x) { return x * 12; }
+inline int f9922_13(int x) { return x * 13; }
+inline int f9922_14(int x) { return x * 14; }
+inline int f9922_15(int x) { return x * 15; }
+inline int f9922_16(int x) { return x * 16; }
+inline int f9922_17(int x) { return x * 17; }
+inline int f9922_18(int x) { return x * 18; }
+inline int f9922_19(int x) { return x * 19; }
+inline int f9922_20(int x) { return x * 20; }
+inline int f9922_21(int x) { return x * 21; }
+inline int f9922_22(int x) { return x * 22; }
+inline int f9922_23(int x) { return x * 23; }
+inline int f9922_24(int x) { return x * 24; }
+inline int f9922_25(int x) { return x * 25; }
+inline int f9922_26(int x) { return x * 26; }
+inline int f9922_27(int x) { return x * 27; }
+inline int f9922_28(int x) { return x * 28; }
+inline int f9922_29(int x) { return x * 29; }
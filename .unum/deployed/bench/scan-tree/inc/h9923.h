@@ -0,0 +1,42 @@
+#pragma once
+/* header 9923 */
+#include <vector>
+#include "h9932.h"
+#include "h6212.h"
+#include "h4041.h"
+#include "h3231.h"
+#include "h2855.h"
+#ifdef X
+#include "h7520.h"
+#endif
+struct S9923 { int a; const char *s = "x//y"; };
+inline int f9923_0(int x) { return x * 0; }
+inline int f9923_1(int x) { return x * 1; }
+inline int f9923_2(int x) { return x * 2; }
+inline int f9923_3(int x) { return x * 3; }
+inline int f9923_4(int x) { return x * 4; }
+inline int f9923_5(int x) { return x * 5; }
+inline int f9923_6(int x) { return x * 6; }
+inline int f9923_7(int x) { return x * 7; }
+inline int f9923_8(int x) { return x * 8; }
+inline int f9923_9(int x) { return x * 9; }
+inline int f9923_10(int x) { return x * 10; }
+inline int f9923_11(int x) { return x * 11; }
+inline int f9923_12(int x) { return x * 12; }
+inline int f9923_13(int x) { return x * 13; }
+inline int f9923_14(int x) { return x * 14; }
+inline int f9923_15(int x) { return x * 15; }
+inline int f9923_16(int x) { return x * 16; }
+inline int f9923_17(int x) { return x * 17; }
+inline int f9923_18(int x) { return x * 18; }
+inline int f9923_19(int x) { return x * 19; }
+inline int f9923_20(int x) { return x * 20; }
+inline int f9923_21(int x) { return x * 21; }
+inline int f9923_22(int x) { return x * 22; }
+inline int f9923_23(int x) { return x * 23; }
+inline int f9923_24(int x) { return x * 24; }
+inline int f9923_25(int x) { return x * 25; }
+inline int f9923_26(int x) { return x * 26; }
+inline int f9923_27(int x) { return x * 27; }
+inline int f9923_28(int x) { return x * 28; }
+inline int f9923_29(int x) { return x * 29; }
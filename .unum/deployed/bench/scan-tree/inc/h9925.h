@@ -0,0 +1,42 @@
+#pragma once
+/* header 9925 */
+#include <vector>
+#include "h8152.h"
+#include "h4759.h"
+#include "h4170.h"
+#include "h9017.h"
+#include "h5203.h"
+#ifdef X
+#include "h7222.h"
+#endif
+struct S9925 { int a; const char *s = "x//y"; };
+inline int f9925_0(int x) { return x * 0; }
+inline int f9925_1(int x) { return x * 1; }
+inline int f9925_2(int x) { return x * 2; }
+inline int f9925_3(int x) { return x * 3; }
+inline int f9925_4(int x) { return x * 4; }
+inline int f9925_5(int x) { return x * 5; }
+inline int f9925_6(int x) { return x * 6; }
+inline int f9925_7(int x) { return x * 7; }
+inline int f9925_8(int x) { return x * 8; }
+inline int f9925_9(int x) { return x * 9; }
+inline int f9925_10(int x) { return x * 10; }
+inline int f9925_11(int x) { return x * 11; }
+inline int f9925_12(int x) { return x * 12; }
+inline int f9925_13(int x) { return x * 13; }
+inline int f9925_14(int x) { return x * 14; }
+inline int f9925_15(int x) { return x * 15; }
+inline int f9925_16(int x) { return x * 16; }
+inline int f9925_17(int x) { return x * 17; }
+inline int f9925_18(int x) { return x * 18; }
+inline int f9925_19(int x) { return x * 19; }
+inline int f9925_20(int x) { return x * 20; }
+inline int f9925_21(int x) { return x * 21; }
+inline int f9925_22(int x) { return x * 22; }
+inline int f9925_23(int x) { return x * 23; }
+inline int f9925_24(int x) { return x * 24; }
+inline int f9925_25(int x) { return x * 25; }
+inline int f9925_26(int x) { return x * 26; }
+inline int f9925_27(int x) { return x * 27; }
+inline int f9925_28(int x) { return x * 28; }
+inline int f9925_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9927 */
+#include <vector>
+#include "h4072.h"
+#include "h3159.h"
+#include "h7346.h"
+#include "h3676.h"
+#include "h5137.h"
+#ifdef X
+#include "h6989.h"
+#endif
+struct S9927 { int a; const char *s = "x//y"; };
+inline int f9927_0(int x) { return x * 0; }
+inline int f9927_1(int x) { return x * 1; }
+inline int f9927_2(int x) { return x * 2; }
+inline int f9927_3(int x) { return x * 3; }
+inline int f9927_4(int x) { return x * 4; }
+inline int f9927_5(int x) { return x * 5; }
+inline int f9927_6(int x) { return x * 6; }
+inline int f9927_7(int x) { return x * 7; }
+inline int f9927_8(int x) { return x * 8; }
+inline int f9927_9(int x) { return x * 9; }
+inline int f9927_10(int x) { return x * 10; }
+inline int f9927_11(int x) { return x * 11; }
+inline int f9927_12(int x) { return x * 12; }
+inline int f9927_13(int x) { return x * 13; }
+inline int f9927_14(int x) { return x * 14; }
+inline int f9927_15(int x) { return x * 15; }
+inline int f9927_16(int x) { return x * 16; }
+inline int f9927_17(int x) { return x * 17; }
+inline int f9927_18(int x) { return x * 18; }
+inline int f9927_19(int x) { return x * 19; }
+inline int f9927_20(int x) { return x * 20; }
+inline int f9927_21(int x) { return x * 21; }
+inline int f9927_22(int x) { return x * 22; }
+inline int f9927_23(int x) { return x * 23; }
+inline int f9927_24(int x) { return x * 24; }
+inline int f9927_25(int x) { return x * 25; }
+inline int f9927_26(int x) { return x * 26; }
+inline int f9927_27(int x) { return x * 27; }
+inline int f9927_28(int x) { return x * 28; }
+inline int f9927_29(int x) { return x * 29; }
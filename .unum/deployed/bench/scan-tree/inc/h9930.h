@@ -0,0 +1,42 @@
+#pragma once
+/* header 9930 */
+#include <vector>
+#include "h8522.h"
+#include "h5875.h"
+#include "h4193.h"
+#include "h238.h"
+#include "h8321.h"
+#ifdef X
+#include "h8821.h"
+#endif
+struct S9930 { int a; const char *s = "x//y"; };
+inline int f9930_0(int x) { return x * 0; }
+inline int f9930_1(int x) { return x * 1; }
+inline int f9930_2(int x) { return x * 2; }
+inline int f9930_3(int x) { return x * 3; }
+inline int f9930_4(int x) { return x * 4; }
+inline int f9930_5(int x) { return x * 5; }
+inline int f9930_6(int x) { return x * 6; }
+inline int f9930_7(int x) { return x * 7; }
+inline int f9930_8(int x) { return x * 8; }
+inline int f9930_9(int x) { return x * 9; }
+inline int f9930_10(int x) { return x * 10; }
+inline int f9930_11(int x) { return x * 11; }
+inline int f9930_12(int x) { return x * 12; }
+inline int f9930_13(int x) { return x * 13; }
+inline int f9930_14(int x) { return x * 14; }
+inline int f9930_15(int x) { return x * 15; }
+inline int f9930_16(int x) { return x * 16; }
+inline int f9930_17(int x) { return x * 17; }
+inline int f9930_18(int x) { return x * 18; }
+inline int f9930_19(int x) { return x * 19; }
+inline int f9930_20(int x) { return x * 20; }
+inline int f9930_21(int x) { return x * 21; }
+inline int f9930_22(int x) { return x * 22; }
+inline int f9930_23(int x) { return x * 23; }
+inline int f9930_24(int x) { return x * 24; }
+inline int f9930_25(int x) { return x * 25; }
+inline int f9930_26(int x) { return x * 26; }
+inline int f9930_27(int x) { return x * 27; }
+inline int f9930_28(int x) { return x * 28; }
+inline int f9930_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9932 */
+#include <vector>
+#include "h3557.h"
+#include "h5705.h"
+#include "h3481.h"
+#include "h4401.h"
+#include "h6458.h"
+#ifdef X
+#include "h8551.h"
+#endif
+struct S9932 { int a; const char *s = "x//y"; };
+inline int f9932_0(int x) { return x * 0; }
+inline int f9932_1(int x) { return x * 1; }
+inline int f9932_2(int x) { return x * 2; }
+inline int f9932_3(int x) { return x * 3; }
+inline int f9932_4(int x) { return x * 4; }
+inline int f9932_5(int x) { return x * 5; }
+inline int f9932_6(int x) { return x * 6; }
+inline int f9932_7(int x) { return x * 7; }
+inline int f9932_8(int x) { return x * 8; }
+inline int f9932_9(int x) { return x * 9; }
+inline int f9932_10(int x) { return x * 10; }
+inline int f9932_11(int x) { return x * 11; }
+inline int f9932_12(int x) { return x * 12; }
+inline int f9932_13(int x) { return x * 13; }
+inline int f9932_14(int x) { return x * 14; }
+inline int f9932_15(int x) { return x * 15; }
+inline int f9932_16(int x) { return x * 16; }
+inline int f9932_17(int x) { return x * 17; }
+inline int f9932_18(int x) { return x * 18; }
+inline int f9932_19(int x) { return x * 19; }
+inline int f9932_20(int x) { return x * 20; }
+inline int f9932_21(int x) { return x * 21; }
+inline int f9932_22(int x) { return x * 22; }
+inline int f9932_23(int x) { return x * 23; }
+inline int f9932_24(int x) { return x * 24; }
+inline int f9932_25(int x) { return x * 25; }
+inline int f9932_26(int x) { return x * 26; }
+inline int f9932_27(int x) { return x * 27; }
+inline int f9932_28(int x) { return x * 28; }
+inline int f9932_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9933 */
+#include <vector>
+#include "h5772.h"
+#include "h8000.h"
+#include "h9608.h"
+#include "h1052.h"
+#include "h9885.h"
+#ifdef X
+#include "h6703.h"
+#endif
+struct S9933 { int a; const char *s = "x//y"; };
+inline int f9933_0(int x) { return x * 0; }
+inline int f9933_1(int x) { return x * 1; }
+inline int f9933_2(int x) { return x * 2; }
+inline int f9933_3(int x) { return x * 3; }
+inline int f9933_4(int x) { return x * 4; }
+inline int f9933_5(int x) { return x * 5; }
+inline int f9933_6(int x) { return x * 6; }
+inline int f9933_7(int x) { return x * 7; }
+inline int f9933_8(int x) { return x * 8; }
+inline int f9933_9(int x) { return x * 9; }
+inline int f9933_10(int x) { return x * 10; }
+inline int f9933_11(int x) { return x * 11; }
+inline int f9933_12(int x) { return x * 12; }
+inline int f9933_13(int x) { return x * 13; }
+inline int f9933_14(int x) { return x * 14; }
+inline int f9933_15(int x) { return x * 15; }
+inline int f9933_16(int x) { return x * 16; }
+inline int f9933_17(int x) { return x * 17; }
+inline int f9933_18(int x) { return x * 18; }
+inline int f9933_19(int x) { return x * 19; }
+inline int f9933_20(int x) { return x * 20; }
+inline int f9933_21(int x) { return x * 21; }
+inline int f9933_22(int x) { return x * 22; }
+inline int f9933_23(int x) { return x * 23; }
+inline int f9933_24(int x) { return x * 24; }
+inline int f9933_25(int x) { return x * 25; }
+inline int f9933_26(int x) { return x * 26; }
+inline int f9933_27(int x) { return x * 27; }
+inline int f9933_28(int x) { return x * 28; }
+inline int f9933_29(int x) { return x * 29; }
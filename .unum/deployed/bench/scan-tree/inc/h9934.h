@@ -0,0 +1,42 @@
+#pragma once
+/* header 9934 */
+#include <vector>
+#include "h4806.h"
+#include "h5583.h"
+#include "h6319.h"
+#include "h4059.h"
+#include "h2259.h"
+#ifdef X
+#include "h4308.h"
+#endif
+struct S9934 { int a; const char *s = "x//y"; };
+inline int f9934_0(int x) { return x * 0; }
+inline int f9934_1(int x) { return x * 1; }
+inline int f9934_2(int x) { return x * 2; }
+inline int f9934_3(int x) { return x * 3; }
+inline int f9934_4(int x) { return x * 4; }
+inline int f9934_5(int x) { return x * 5; }
+inline int f9934_6(int x) { return x * 6; }
+inline int f9934_7(int x) { return x * 7; }
+inline int f9934_8(int x) { return x * 8; }
+inline int f9934_9(int x) { return x * 9; }
+inline int f9934_10(int x) { return x * 10; }
+inline int f9934_11(int x) { return x * 11; }
+inline int f9934_12(int x) { return x * 12; }
+inline int f9934_13(int x) { return x * 13; }
+inline int f9934_14(int x) { return x * 14; }
+inline int f9934_15(int x) { return x * 15; }
+inline int f9934_16(int x) { return x * 16; }
+inline int f9934_17(int x) { return x * 17; }
+inline int f9934_18(int x) { return x * 18; }
+inline int f9934_19(int x) { return x * 19; }
+inline int f9934_20(int x) { return x * 20; }
+inline int f9934_21(int x) { return x * 21; }
+inline int f9934_22(int x) { return x * 22; }
+inline int f9934_23(int x) { return x * 23; }
+inline int f9934_24(int x) { return x * 24; }
+inline int f9934_25(int x) { return x * 25; }
+inline int f9934_26(int x) { return x * 26; }
+inline int f9934_27(int x) { return x * 27; }
+inline int f9934_28(int x) { return x * 28; }
+inline int f9934_29(int x) { return x * 29; }
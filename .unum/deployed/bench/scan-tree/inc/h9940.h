@@ -0,0 +1,42 @@
+#pragma once
+/* header 9940 */
+#include <vector>
+#include "h7329.h"
+#include "h1036.h"
+#include "h5041.h"
+#include "h6271.h"
+#include "h8863.h"
+#ifdef X
+#include "h3025.h"
+#endif
+struct S9940 { int a; const char *s = "x//y"; };
+inline int f9940_0(int x) { return x * 0; }
+inline int f9940_1(int x) { return x * 1; }
+inline int f9940_2(int x) { return x * 2; }
+inline int f9940_3(int x) { return x * 3; }
+inline int f9940_4(int x) { return x * 4; }
+inline int f9940_5(int x) { return x * 5; }
+inline int f9940_6(int x) { return x * 6; }
+inline int f9940_7(int x) { return x * 7; }
+inline int f9940_8(int x) { return x * 8; }
+inline int f9940_9(int x) { return x * 9; }
+inline int f9940_10(int x) { return x * 10; }
+inline int f9940_11(int x) { return x * 11; }
+inline int f9940_12(int x) { return x * 12; }
+inline int f9940_13(int x) { return x * 13; }
+inline int f9940_14(int x) { return x * 14; }
+inline int f9940_15(int x) { return x * 15; }
+inline int f9940_16(int x) { return x * 16; }
+inline int f9940_17(int x) { return x * 17; }
+inline int f9940_18(int x) { return x * 18; }
+inline int f9940_19(int x) { return x * 19; }
+inline int f9940_20(int x) { return x * 20; }
+inline int f9940_21(int x) { return x * 21; }
+inline int f9940_22(int x) { return x * 22; }
+inline int f9940_23(int x) { return x * 23; }
+inline int f9940_24(int x) { return x * 24; }
+inline int f9940_25(int x) { return x * 25; }
+inline int f9940_26(int x) { return x * 26; }
+inline int f9940_27(int x) { return x * 27; }
+inline int f9940_28(int x) { return x * 28; }
+inline int f9940_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9941 */
+#include <vector>
+#include "h4297.h"
+#include "h7878.h"
+#include "h6284.h"
+#include "h3394.h"
+#include "h431.h"
+#ifdef X
+#include "h9572.h"
+#endif
+struct S9941 { int a; const char *s = "x//y"; };
+inline int f9941_0(int x) { return x * 0; }
+inline int f9941_1(int x) { return x * 1; }
+inline int f9941_2(int x) { return x * 2; }
+inline int f9941_3(int x) { return x * 3; }
+inline int f9941_4(int x) { return x * 4; }
+inline int f9941_5(int x) { return x * 5; }
+inline int f9941_6(int x) { return x * 6; }
+inline int f9941_7(int x) { return x * 7; }
+inline int f9941_8(int x) { return x * 8; }
+inline int f9941_9(int x) { return x * 9; }
+inline int f9941_10(int x) { return x * 10; }
+inline int f9941_11(int x) { return x * 11; }
+inline int f9941_12(int x) { return x * 12; }
+inline int f9941_13(int x) { return x * 13; }
+inline int f9941_14(int x) { return x * 14; }
+inline int f9941_15(int x) { return x * 15; }
+inline int f9941_16(int x) { return x * 16; }
+inline int f9941_17(int x) { return x * 17; }
+inline int f9941_18(int x) { return x * 18; }
+inline int f9941_19(int x) { return x * 19; }
+inline int f9941_20(int x) { return x * 20; }
+inline int f9941_21(int x) { return x * 21; }
+inline int f9941_22(int x) { return x * 22; }
+inline int f9941_23(int x) { return x * 23; }
+inline int f9941_24(int x) { return x * 24; }
+inline int f9941_25(int x) { return x * 25; }
+inline int f9941_26(int x) { return x * 26; }
+inline int f9941_27(int x) { return x * 27; }
+inline int f9941_28(int x) { return x * 28; }
+inline int f9941_29(int x) { return x * 29; }
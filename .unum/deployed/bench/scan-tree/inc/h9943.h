@@ -0,0 +1,42 @@
+#pragma once
+/* header 9943 */
+#include <vector>
+#include "h385.h"
+#include "h2559.h"
+#include "h5031.h"
+#include "h6367.h"
+#include "h4032.h"
+#ifdef X
+#include "h6009.h"
+#endif
+struct S9943 { int a; const char *s = "x//y"; };
+inline int f9943_0(int x) { return x * 0; }
+inline int f9943_1(int x) { return x * 1; }
+inline int f9943_2(int x) { return x * 2; }
+inline int f9943_3(int x) { return x * 3; }
+inline int f9943_4(int x) { return x * 4; }
+inline int f9943_5(int x) { return x * 5; }
+inline int f9943_6(int x) { return x * 6; }
+inline int f9943_7(int x) { return x * 7; }
+inline int f9943_8(int x) { return x * 8; }
+inline int f9943_9(int x) { return x * 9; }
+inline int f9943_10(int x) { return x * 10; }
+inline int f9943_11(int x) { return x * 11; }
+inline int f9943_12(int x) { return x * 12; }
+inline int f9943_13(int x) { return x * 13; }
+inline int f9943_14(int x) { return x * 14; }
+inline int f9943_15(int x) { return x * 15; }
+inline int f9943_16(int x) { return x * 16; }
+inline int f9943_17(int x) { return x * 17; }
+inline int f9943_18(int x) { return x * 18; }
+inline int f9943_19(int x) { return x * 19; }
+inline int f9943_20(int x) { return x * 20; }
+inline int f9943_21(int x) { return x * 21; }
+inline int f9943_22(int x) { return x * 22; }
+inline int f9943_23(int x) { return x * 23; }
+inline int f9943_24(int x) { return x * 24; }
+inline int f9943_25(int x) { return x * 25; }
+inline int f9943_26(int x) { return x * 26; }
+inline int f9943_27(int x) { return x * 27; }
+inline int f9943_28(int x) { return x * 28; }
+inline int f9943_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9944 */
+#include <vector>
+#include "h2693.h"
+#include "h4845.h"
+#include "h6316.h"
+#include "h3461.h"
+#include "h6444.h"
+#ifdef X
+#include "h2969.h"
+#endif
+struct S9944 { int a; const char *s = "x//y"; };
+inline int f9944_0(int x) { return x * 0; }
+inline int f9944_1(int x) { return x * 1; }
+inline int f9944_2(int x) { return x * 2; }
+inline int f9944_3(int x) { return x * 3; }
+inline int f9944_4(int x) { return x * 4; }
+inline int f9944_5(int x) { return x * 5; }
+inline int f9944_6(int x) { return x * 6; }
+inline int f9944_7(int x) { return x * 7; }
+inline int f9944_8(int x) { return x * 8; }
+inline int f9944_9(int x) { return x * 9; }
+inline int f9944_10(int x) { return x * 10; }
+inline int f9944_11(int x) { return x * 11; }
+inline int f9944_12(int x) { return x * 12; }
+inline int f9944_13(int x) { return x * 13; }
+inline int f9944_14(int x) { return x * 14; }
+inline int f9944_15(int x) { return x * 15; }
+inline int f9944_16(int x) { return x * 16; }
+inline int f9944_17(int x) { return x * 17; }
+inline int f9944_18(int x) { return x * 18; }
+inline int f9944_19(int x) { return x * 19; }
+inline int f9944_20(int x) { return x * 20; }
+inline int f9944_21(int x) { return x * 21; }
+inline int f9944_22(int x) { return x * 22; }
+inline int f9944_23(int x) { return x * 23; }
+inline int f9944_24(int x) { return x * 24; }
+inline int f9944_25(int x) { return x * 25; }
+inline int f9944_26(int x) { return x * 26; }
+inline int f9944_27(int x) { return x * 27; }
+inline int f9944_28(int x) { return x * 28; }
+inline int f9944_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9949 */
+#include <vector>
+#include "h1798.h"
+#include "h809.h"
+#include "h887.h"
+#include "h879.h"
+#include "h7698.h"
+#ifdef X
+#include "h3789.h"
+#endif
+struct S9949 { int a; const char *s = "x//y"; };
+inline int f9949_0(int x) { return x * 0; }
+inline int f9949_1(int x) { return x * 1; }
+inline int f9949_2(int x) { return x * 2; }
+inline int f9949_3(int x) { return x * 3; }
+inline int f9949_4(int x) { return x * 4; }
+inline int f9949_5(int x) { return x * 5; }
+inline int f9949_6(int x) { return x * 6; }
+inline int f9949_7(int x) { return x * 7; }
+inline int f9949_8(int x) { return x * 8; }
+inline int f9949_9(int x) { return x * 9; }
+inline int f9949_10(int x) { return x * 10; }
+inline int f9949_11(int x) { return x * 11; }
+inline int f9949_12(int x) { return x * 12; }
+inline int f9949_13(int x) { return x * 13; }
+inline int f9949_14(int x) { return x * 14; }
+inline int f9949_15(int x) { return x * 15; }
+inline int f9949_16(int x) { return x * 16; }
+inline int f9949_17(int x) { return x * 17; }
+inline int f9949_18(int x) { return x * 18; }
+inline int f9949_19(int x) { return x * 19; }
+inline int f9949_20(int x) { return x * 20; }
+inline int f9949_21(int x) { return x * 21; }
+inline int f9949_22(int x) { return x * 22; }
+inline int f9949_23(int x) { return x * 23; }
+inline int f9949_24(int x) { return x * 24; }
+inline int f9949_25(int x) { return x * 25; }
+inline int f9949_26(int x) { return x * 26; }
+inline int f9949_27(int x) { return x * 27; }
+inline int f9949_28(int x) { return x * 28; }
+inline int f9949_29(int x) { return x * 29; }
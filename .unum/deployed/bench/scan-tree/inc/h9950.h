@@ -0,0 +1,42 @@
+#pragma once
+/* header 9950 */
+#include <vector>
+#include "h3512.h"
+#include "h2864.h"
+#include "h1827.h"
+#include "h9198.h"
+#include "h417.h"
+#ifdef X
+#include "h5871.h"
+#endif
+struct S9950 { int a; const char *s = "x//y"; };
+inline int f9950_0(int x) { return x * 0; }
+inline int f9950_1(int x) { return x * 1; }
+inline int f9950_2(int x) { return x * 2; }
+inline int f9950_3(int x) { return x * 3; }
+inline int f9950_4(int x) { return x * 4; }
+inline int f9950_5(int x) { return x * 5; }
+inline int f9950_6(int x) { return x * 6; }
+inline int f9950_7(int x) { return x * 7; }
+inline int f9950_8(int x) { return x * 8; }
+inline int f9950_9(int x) { return x * 9; }
+inline int f9950_10(int x) { return x * 10; }
+inline int f9950_11(int x) { return x * 11; }
+inline int f9950_12(int x) { return x * 12; }
+inline int f9950_13(int x) { return x * 13; }
+inline int f9950_14(int x) { return x * 14; }
+inline int f9950_15(int x) { return x * 15; }
+inline int f9950_16(int x) { return x * 16; }
+inline int f9950_17(int x) { return x * 17; }
+inline int f9950_18(int x) { return x * 18; }
+inline int f9950_19(int x) { return x * 19; }
+inline int f9950_20(int x) { return x * 20; }
+inline int f9950_21(int x) { return x * 21; }
+inline int f9950_22(int x) { return x * 22; }
+inline int f9950_23(int x) { return x * 23; }
+inline int f9950_24(int x) { return x * 24; }
+inline int f9950_25(int x) { return x * 25; }
+inline int f9950_26(int x) { return x * 26; }
+inline int f9950_27(int x) { return x * 27; }
+inline int f9950_28(int x) { return x * 28; }
+inline int f9950_29(int x) { return x * 29; }
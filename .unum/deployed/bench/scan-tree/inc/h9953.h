@@ -0,0 +1,42 @@
+#pragma once
+/* header 9953 */
+#include <vector>
+#include "h7201.h"
+#include "h9321.h"
+#include "h1941.h"
+#include "h1153.h"
+#include "h3941.h"
+#ifdef X
+#include "h9899.h"
+#endif
+struct S9953 { int a; const char *s = "x//y"; };
+inline int f9953_0(int x) { return x * 0; }
+inline int f9953_1(int x) { return x * 1; }
+inline int f9953_2(int x) { return x * 2; }
+inline int f9953_3(int x) { return x * 3; }
+inline int f9953_4(int x) { return x * 4; }
+inline int f9953_5(int x) { return x * 5; }
+inline int f9953_6(int x) { return x * 6; }
+inline int f9953_7(int x) { return x * 7; }
+inline int f9953_8(int x) { return x * 8; }
+inline int f9953_9(int x) { return x * 9; }
+inline int f9953_10(int x) { return x * 10; }
+inline int f9953_11(int x) { return x * 11; }
+inline int f9953_12(int x) { return x * 12; }
+inline int f9953_13(int x) { return x * 13; }
+inline int f9953_14(int x) { return x * 14; }
+inline int f9953_15(int x) { return x * 15; }
+inline int f9953_16(int x) { return x * 16; }
+inline int f9953_17(int x) { return x * 17; }
+inline int f9953_18(int x) { return x * 18; }
+inline int f9953_19(int x) { return x * 19; }
+inline int f9953_20(int x) { return x * 20; }
+inline int f9953_21(int x) { return x * 21; }
+inline int f9953_22(int x) { return x * 22; }
+inline int f9953_23(int x) { return x * 23; }
+inline int f9953_24(int x) { return x * 24; }
+inline int f9953_25(int x) { return x * 25; }
+inline int f9953_26(int x) { return x * 26; }
+inline int f9953_27(int x) { return x * 27; }
+inline int f9953_28(int x) { return x * 28; }
+inline int f9953_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9954 */
+#include <vector>
+#include "h1011.h"
+#include "h4149.h"
+#include "h7303.h"
+#include "h2419.h"
+#include "h8041.h"
+#ifdef X
+#include "h7593.h"
+#endif
+struct S9954 { int a; const char *s = "x//y"; };
+inline int f9954_0(int x) { return x * 0; }
+inline int f9954_1(int x) { return x * 1; }
+inline int f9954_2(int x) { return x * 2; }
+inline int f9954_3(int x) { return x * 3; }
+inline int f9954_4(int x) { return x * 4; }
+inline int f9954_5(int x) { return x * 5; }
+inline int f9954_6(int x) { return x * 6; }
+inline int f9954_7(int x) { return x * 7; }
+inline int f9954_8(int x) { return x * 8; }
+inline int f9954_9(int x) { return x * 9; }
+inline int f9954_10(int x) { return x * 10; }
+inline int f9954_11(int x) { return x * 11; }
+inline int f9954_12(int x) { return x * 12; }
+inline int f9954_13(int x) { return x * 13; }
+inline int f9954_14(int x) { return x * 14; }
+inline int f9954_15(int x) { return x * 15; }
+inline int f9954_16(int x) { return x * 16; }
+inline int f9954_17(int x) { return x * 17; }
+inline int f9954_18(int x) { return x * 18; }
+inline int f9954_19(int x) { return x * 19; }
+inline int f9954_20(int x) { return x * 20; }
+inline int f9954_21(int x) { return x * 21; }
+inline int f9954_22(int x) { return x * 22; }
+inline int f9954_23(int x) { return x * 23; }
+inline int f9954_24(int x) { return x * 24; }
+inline int f9954_25(int x) { return x * 25; }
+inline int f9954_26(int x) { return x * 26; }
+inline int f9954_27(int x) { return x * 27; }
+inline int f9954_28(int x) { return x * 28; }
+inline int f9954_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9956 */
+#include <vector>
+#include "h7996.h"
+#include "h1725.h"
+#include "h6072.h"
+#include "h2189.h"
+#include "h2838.h"
+#ifdef X
+#include "h9506.h"
+#endif
+struct S9956 { int a; const char *s = "x//y"; };
+inline int f9956_0(int x) { return x * 0; }
+inline int f9956_1(int x) { return x * 1; }
+inline int f9956_2(int x) { return x * 2; }
+inline int f9956_3(int x) { return x * 3; }
+inline int f9956_4(int x) { return x * 4; }
+inline int f9956_5(int x) { return x * 5; }
+inline int f9956_6(int x) { return x * 6; }
+inline int f9956_7(int x) { return x * 7; }
+inline int f9956_8(int x) { return x * 8; }
+inline int f9956_9(int x) { return x * 9; }
+inline int f9956_10(int x) { return x * 10; }
+inline int f9956_11(int x) { return x * 11; }
+inline int f9956_12(int x) { return x * 12; }
+inline int f9956_13(int x) { return x * 13; }
+inline int f9956_14(int x) { return x * 14; }
+inline int f9956_15(int x) { return x * 15; }
+inline int f9956_16(int x) { return x * 16; }
+inline int f9956_17(int x) { return x * 17; }
+inline int f9956_18(int x) { return x * 18; }
+inline int f9956_19(int x) { return x * 19; }
+inline int f9956_20(int x) { return x * 20; }
+inline int f9956_21(int x) { return x * 21; }
+inline int f9956_22(int x) { return x * 22; }
+inline int f9956_23(int x) { return x * 23; }
+inline int f9956_24(int x) { return x * 24; }
+inline int f9956_25(int x) { return x * 25; }
+inline int f9956_26(int x) { return x * 26; }
+inline int f9956_27(int x) { return x * 27; }
+inline int f9956_28(int x) { return x * 28; }
+inline int f9956_29(int x) { return x * 29; }
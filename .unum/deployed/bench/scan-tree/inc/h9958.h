@@ -0,0 +1,42 @@
+#pragma once
+/* header 9958 */
+#include <vector>
+#include "h7672.h"
+#include "h9150.h"
+#include "h7317.h"
+#include "h3282.h"
+#include "h9385.h"
+#ifdef X
+#include "h1751.h"
+#endif
+struct S9958 { int a; const char *s = "x//y"; };
+inline int f9958_0(int x) { return x * 0; }
+inline int f9958_1(int x) { return x * 1; }
+inline int f9958_2(int x) { return x * 2; }
+inline int f9958_3(int x) { return x * 3; }
+inline int f9958_4(int x) { return x * 4; }
+inline int f9958_5(int x) { return x * 5; }
+inline int f9958_6(int x) { return x * 6; }
+inline int f9958_7(int x) { return x * 7; }
+inline int f9958_8(int x) { return x * 8; }
+inline int f9958_9(int x) { return x * 9; }
+inline int f9958_10(int x) { return x * 10; }
+inline int f9958_11(int x) { return x * 11; }
+inline int f9958_12(int x) { return x * 12; }
+inline int f9958_13(int x) { return x * 13; }
+inline int f9958_14(int x) { return x * 14; }
+inline int f9958_15(int x) { return x * 15; }
+inline int f9958_16(int x) { return x * 16; }
+inline int f9958_17(int x) { return x * 17; }
+inline int f9958_18(int x) { return x * 18; }
+inline int f9958_19(int x) { return x * 19; }
+inline int f9958_20(int x) { return x * 20; }
+inline int f9958_21(int x) { return x * 21; }
+inline int f9958_22(int x) { return x * 22; }
+inline int f9958_23(int x) { return x * 23; }
+inline int f9958_24(int x) { return x * 24; }
+inline int f9958_25(int x) { return x * 25; }
+inline int f9958_26(int x) { return x * 26; }
+inline int f9958_27(int x) { return x * 27; }
+inline int f9958_28(int x) { return x * 28; }
+inline int f9958_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9959 */
+#include <vector>
+#include "h2187.h"
+#include "h3959.h"
+#include "h3105.h"
+#include "h687.h"
+#include "h9256.h"
+#ifdef X
+#include "h8891.h"
+#endif
+struct S9959 { int a; const char *s = "x//y"; };
+inline int f9959_0(int x) { return x * 0; }
+inline int f9959_1(int x) { return x * 1; }
+inline int f9959_2(int x) { return x * 2; }
+inline int f9959_3(int x) { return x * 3; }
+inline int f9959_4(int x) { return x * 4; }
+inline int f9959_5(int x) { return x * 5; }
+inline int f9959_6(int x) { return x * 6; }
+inline int f9959_7(int x) { return x * 7; }
+inline int f9959_8(int x) { return x * 8; }
+inline int f9959_9(int x) { return x * 9; }
+inline int f9959_10(int x) { return x * 10; }
+inline int f9959_11(int x) { return x * 11; }
+inline int f9959_12(int x) { return x * 12; }
+inline int f9959_13(int x) { return x * 13; }
+inline int f9959_14(int x) { return x * 14; }
+inline int f9959_15(int x) { return x * 15; }
+inline int f9959_16(int x) { return x * 16; }
+inline int f9959_17(int x) { return x * 17; }
+inline int f9959_18(int x) { return x * 18; }
+inline int f9959_19(int x) { return x * 19; }
+inline int f9959_20(int x) { return x * 20; }
+inline int f9959_21(int x) { return x * 21; }
+inline int f9959_22(int x) { return x * 22; }
+inline int f9959_23(int x) { return x * 23; }
+inline int f9959_24(int x) { return x * 24; }
+inline int f9959_25(int x) { return x * 25; }
+inline int f9959_26(int x) { return x * 26; }
+inline int f9959_27(int x) { return x * 27; }
+inline int f9959_28(int x) { return x * 28; }
+inline int f9959_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9960 */
+#include <vector>
+#include "h4398.h"
+#include "h5394.h"
+#include "h7260.h"
+#include "h664.h"
+#include "h9657.h"
+#ifdef X
+#include "h5468.h"
+#endif
+struct S9960 { int a; const char *s = "x//y"; };
+inline int f9960_0(int x) { return x * 0; }
+inline int f9960_1(int x) { return x * 1; }
+inline int f9960_2(int x) { return x * 2; }
+inline int f9960_3(int x) { return x * 3; }
+inline int f9960_4(int x) { return x * 4; }
+inline int f9960_5(int x) { return x * 5; }
+inline int f9960_6(int x) { return x * 6; }
+inline int f9960_7(int x) { return x * 7; }
+inline int f9960_8(int x) { return x * 8; }
+inline int f9960_9(int x) { return x * 9; }
+inline int f9960_10(int x) { return x * 10; }
+inline int f9960_11(int x) { return x * 11; }
+inline int f9960_12(int x) { return x * 12; }
+inline int f9960_13(int x) { return x * 13; }
+inline int f9960_14(int x) { return x * 14; }
+inline int f9960_15(int x) { return x * 15; }
+inline int f9960_16(int x) { return x * 16; }
+inline int f9960_17(int x) { return x * 17; }
+inline int f9960_18(int x) { return x * 18; }
+inline int f9960_19(int x) { return x * 19; }
+inline int f9960_20(int x) { return x * 20; }
+inline int f9960_21(int x) { return x * 21; }
+inline int f9960_22(int x) { return x * 22; }
+inline int f9960_23(int x) { return x * 23; }
+inline int f9960_24(int x) { return x * 24; }
+inline int f9960_25(int x) { return x * 25; }
+inline int f9960_26(int x) { return x * 26; }
+inline int f9960_27(int x) { return x * 27; }
+inline int f9960_28(int x) { return x * 28; }
+inline int f9960_29(int x) { return x * 29; }
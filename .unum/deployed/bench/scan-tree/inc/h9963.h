@@ -0,0 +1,42 @@
+#pragma once
+/* header 9963 */
+#include <vector>
+#include "h1655.h"
+#include "h7980.h"
+#include "h2233.h"
+#include "h8308.h"
+#include "h6847.h"
+#ifdef X
+#include "h1200.h"
+#endif
+struct S9963 { int a; const char *s = "x//y"; };
+inline int f9963_0(int x) { return x * 0; }
+inline int f9963_1(int x) { return x * 1; }
+inline int f9963_2(int x) { return x * 2; }
+inline int f9963_3(int x) { return x * 3; }
+inline int f9963_4(int x) { return x * 4; }
+inline int f9963_5(int x) { return x * 5; }
+inline int f9963_6(int x) { return x * 6; }
+inline int f9963_7(int x) { return x * 7; }
+inline int f9963_8(int x) { return x * 8; }
+inline int f9963_9(int x) { return x * 9; }
+inline int f9963_10(int x) { return x * 10; }
+inline int f9963_11(int x) { return x * 11; }
+inline int f9963_12(int x) { return x * 12; }
+inline int f9963_13(int x) { return x * 13; }
+inline int f9963_14(int x) { return x * 14; }
+inline int f9963_15(int x) { return x * 15; }
+inline int f9963_16(int x) { return x * 16; }
+inline int f9963_17(int x) { return x * 17; }
+inline int f9963_18(int x) { return x * 18; }
+inline int f9963_19(int x) { return x * 19; }
+inline int f9963_20(int x) { return x * 20; }
+inline int f9963_21(int x) { return x * 21; }
+inline int f9963_22(int x) { return x * 22; }
+inline int f9963_23(int x) { return x * 23; }
+inline int f9963_24(int x) { return x * 24; }
+inline int f9963_25(int x) { return x * 25; }
+inline int f9963_26(int x) { return x * 26; }
+inline int f9963_27(int x) { return x * 27; }
+inline int f9963_28(int x) { return x * 28; }
+inline int f9963_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9965 */
+#include <vector>
+#include "h4425.h"
+#include "h4670.h"
+#include "h3718.h"
+#include "h2804.h"
+#include "h8209.h"
+#ifdef X
+#include "h3521.h"
+#endif
+struct S9965 { int a; const char *s = "x//y"; };
+inline int f9965_0(int x) { return x * 0; }
+inline int f9965_1(int x) { return x * 1; }
+inline int f9965_2(int x) { return x * 2; }
+inline int f9965_3(int x) { return x * 3; }
+inline int f9965_4(int x) { return x * 4; }
+inline int f9965_5(int x) { return x * 5; }
+inline int f9965_6(int x) { return x * 6; }
+inline int f9965_7(int x) { return x * 7; }
+inline int f9965_8(int x) { return x * 8; }
+inline int f9965_9(int x) { return x * 9; }
+inline int f9965_10(int x) { return x * 10; }
+inline int f9965_11(int x) { return x * 11; }
+inline int f9965_12(int x) { return x * 12; }
+inline int f9965_13(int x) { return x * 13; }
+inline int f9965_14(int x) { return x * 14; }
+inline int f9965_15(int x) { return x * 15; }
+inline int f9965_16(int x) { return x * 16; }
+inline int f9965_17(int x) { return x * 17; }
+inline int f9965_18(int x) { return x * 18; }
+inline int f9965_19(int x) { return x * 19; }
+inline int f9965_20(int x) { return x * 20; }
+inline int f9965_21(int x) { return x * 21; }
+inline int f9965_22(int x) { return x * 22; }
+inline int f9965_23(int x) { return x * 23; }
+inline int f9965_24(int x) { return x * 24; }
+inline int f9965_25(int x) { return x * 25; }
+inline int f9965_26(int x) { return x * 26; }
+inline int f9965_27(int x) { return x * 27; }
+inline int f9965_28(int x) { return x * 28; }
+inline int f9965_29(int x) { return x * 29; }
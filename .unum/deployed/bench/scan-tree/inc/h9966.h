@@ -0,0 +1,42 @@
+#pragma once
+/* header 9966 */
+#include <vector>
+#include "h2759.h"
+#include "h4200.h"
+#include "h8909.h"
+#include "h2925.h"
+#include "h9827.h"
+#ifdef X
+#include "h8006.h"
+#endif
+struct S9966 { int a; const char *s = "x//y"; };
+inline int f9966_0(int x) { return x * 0; }
+inline int f9966_1(int x) { return x * 1; }
+inline int f9966_2(int x) { return x * 2; }
+inline int f9966_3(int x) { return x * 3; }
+inline int f9966_4(int x) { return x * 4; }
+inline int f9966_5(int x) { return x * 5; }
+inline int f9966_6(int x) { return x * 6; }
+inline int f9966_7(int x) { return x * 7; }
+inline int f9966_8(int x) { return x * 8; }
+inline int f9966_9(int x) { return x * 9; }
+inline int f9966_10(int x) { return x * 10; }
+inline int f9966_11(int x) { return x * 11; }
+inline int f9966_12(int x) { return x * 12; }
+inline int f9966_13(int x) { return x * 13; }
+inline int f9966_14(int x) { return x * 14; }
+inline int f9966_15(int x) { return x * 15; }
+inline int f9966_16(int x) { return x * 16; }
+inline int f9966_17(int x) { return x * 17; }
+inline int f9966_18(int x) { return x * 18; }
+inline int f9966_19(int x) { return x * 19; }
+inline int f9966_20(int x) { return x * 20; }
+inline int f9966_21(int x) { return x * 21; }
+inline int f9966_22(int x) { return x * 22; }
+inline int f9966_23(int x) { return x * 23; }
+inline int f9966_24(int x) { return x * 24; }
+inline int f9966_25(int x) { return x * 25; }
+inline int f9966_26(int x) { return x * 26; }
+inline int f9966_27(int x) { return x * 27; }
+inline int f9966_28(int x) { return x * 28; }
+inline int f9966_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 997 */
+#include <vector>
+#include "h4371.h"
+#include "h6374.h"
+#include "h1303.h"
+#include "h3078.h"
+#include "h4285.h"
+#ifdef X
+#include "h3621.h"
+#endif
+struct S997 { int a; const char *s = "x//y"; };
+inline int f997_0(int x) { return x * 0; }
+inline int f997_1(int x) { return x * 1; }
+inline int f997_2(int x) { return x * 2; }
+inline int f997_3(int x) { return x * 3; }
+inline int f997_4(int x) { return x * 4; }
+inline int f997_5(int x) { return x * 5; }
+inline int f997_6(int x) { return x * 6; }
+inline int f997_7(int x) { return x * 7; }
+inline int f997_8(int x) { return x * 8; }
+inline int f997_9(int x) { return x * 9; }
+inline int f997_10(int x) { return x * 10; }
+inline int f997_11(int x) { return x * 11; }
+inline int f997_12(int x) { return x * 12; }
+inline int f997_13(int x) { return x * 13; }
+inline int f997_14(int x) { return x * 14; }
+inline int f997_15(int x) { return x * 15; }
+inline int f997_16(int x) { return x * 16; }
+inline int f997_17(int x) { return x * 17; }
+inline int f997_18(int x) { return x * 18; }
+inline int f997_19(int x) { return x * 19; }
+inline int f997_20(int x) { return x * 20; }
+inline int f997_21(int x) { return x * 21; }
+inline int f997_22(int x) { return x * 22; }
+inline int f997_23(int x) { return x * 23; }
+inline int f997_24(int x) { return x * 24; }
+inline int f997_25(int x) { return x * 25; }
+inline int f997_26(int x) { return x * 26; }
+inline int f997_27(int x) { return x * 27; }
+inline int f997_28(int x) { return x * 28; }
+inline int f997_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9972 */
+#include <vector>
+#include "h7631.h"
+#include "h1476.h"
+#include "h9239.h"
+#include "h1744.h"
+#include "h1812.h"
+#ifdef X
+#include "h7695.h"
+#endif
+struct S9972 { int a; const char *s = "x//y"; };
+inline int f9972_0(int x) { return x * 0; }
+inline int f9972_1(int x) { return x * 1; }
+inline int f9972_2(int x) { return x * 2; }
+inline int f9972_3(int x) { return x * 3; }
+inline int f9972_4(int x) { return x * 4; }
+inline int f9972_5(int x) { return x * 5; }
+inline int f9972_6(int x) { return x * 6; }
+inline int f9972_7(int x) { return x * 7; }
+inline int f9972_8(int x) { return x * 8; }
+inline int f9972_9(int x) { return x * 9; }
+inline int f9972_10(int x) { return x * 10; }
+inline int f9972_11(int x) { return x * 11; }
+inline int f9972_12(int x) { return x * 12; }
+inline int f9972_13(int x) { return x * 13; }
+inline int f9972_14(int x) { return x * 14; }
+inline int f9972_15(int x) { return x * 15; }
+inline int f9972_16(int x) { return x * 16; }
+inline int f9972_17(int x) { return x * 17; }
+inline int f9972_18(int x) { return x * 18; }
+inline int f9972_19(int x) { return x * 19; }
+inline int f9972_20(int x) { return x * 20; }
+inline int f9972_21(int x) { return x * 21; }
+inline int f9972_22(int x) { return x * 22; }
+inline int f9972_23(int x) { return x * 23; }
+inline int f9972_24(int x) { return x * 24; }
+inline int f9972_25(int x) { return x * 25; }
+inline int f9972_26(int x) { return x * 26; }
+inline int f9972_27(int x) { return x * 27; }
+inline int f9972_28(int x) { return x * 28; }
+inline int f9972_29(int x) { return x * 29; }
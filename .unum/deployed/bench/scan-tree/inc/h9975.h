@@ -0,0 +1,42 @@
+#pragma once
+/* header 9975 */
+#include <vector>
+#include "h7864.h"
+#include "h1309.h"
+#include "h9305.h"
+#include "h1751.h"
+#include "h2199.h"
+#ifdef X
+#include "h1886.h"
+#endif
+struct S9975 { int a; const char *s = "x//y"; };
+inline int f9975_0(int x) { return x * 0; }
+inline int f9975_1(int x) { return x * 1; }
+inline int f9975_2(int x) { return x * 2; }
+inline int f9975_3(int x) { return x * 3; }
+inline int f9975_4(int x) { return x * 4; }
+inline int f9975_5(int x) { return x * 5; }
+inline int f9975_6(int x) { return x * 6; }
+inline int f9975_7(int x) { return x * 7; }
+inline int f9975_8(int x) { return x * 8; }
+inline int f9975_9(int x) { return x * 9; }
+inline int f9975_10(int x) { return x * 10; }
+inline int f9975_11(int x) { return x * 11; }
+inline int f9975_12(int x) { return x * 12; }
+inline int f9975_13(int x) { return x * 13; }
+inline int f9975_14(int x) { return x * 14; }
+inline int f9975_15(int x) { return x * 15; }
+inline int f9975_16(int x) { return x * 16; }
+inline int f9975_17(int x) { return x * 17; }
+inline int f9975_18(int x) { return x * 18; }
+inline int f9975_19(int x) { return x * 19; }
+inline int f9975_20(int x) { return x * 20; }
+inline int f9975_21(int x) { return x * 21; }
+inline int f9975_22(int x) { return x * 22; }
+inline int f9975_23(int x) { return x * 23; }
+inline int f9975_24(int x) { return x * 24; }
+inline int f9975_25(int x) { return x * 25; }
+inline int f9975_26(int x) { return x * 26; }
+inline int f9975_27(int x) { return x * 27; }
+inline int f9975_28(int x) { return x * 28; }
+inline int f9975_29(int x) { return x * 29; }
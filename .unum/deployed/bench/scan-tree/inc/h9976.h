@@ -0,0 +1,42 @@
+#pragma once
+/* header 9976 */
+#include <vector>
+#include "h4807.h"
+#include "h1200.h"
+#include "h117.h"
+#include "h8554.h"
+#include "h4020.h"
+#ifdef X
+#include "h244.h"
+#endif
+struct S9976 { int a; const char *s = "x//y"; };
+inline int f9976_0(int x) { return x * 0; }
+inline int f9976_1(int x) { return x * 1; }
+inline int f9976_2(int x) { return x * 2; }
+inline int f9976_3(int x) { return x * 3; }
+inline int f9976_4(int x) { return x * 4; }
+inline int f9976_5(int x) { return x * 5; }
+inline int f9976_6(int x) { return x * 6; }
+inline int f9976_7(int x) { return x * 7; }
+inline int f9976_8(int x) { return x * 8; }
+inline int f9976_9(int x) { return x * 9; }
+inline int f9976_10(int x) { return x * 10; }
+inline int f9976_11(int x) { return x * 11; }
+inline int f9976_12(int x) { return x * 12; }
+inline int f9976_13(int x) { return x * 13; }
+inline int f9976_14(int x) { return x * 14; }
+inline int f9976_15(int x) { return x * 15; }
+inline int f9976_16(int x) { return x * 16; }
+inline int f9976_17(int x) { return x * 17; }
+inline int f9976_18(int x) { return x * 18; }
+inline int f9976_19(int x) { return x * 19; }
+inline int f9976_20(int x) { return x * 20; }
+inline int f9976_21(int x) { return x * 21; }
+inline int f9976_22(int x) { return x * 22; }
+inline int f9976_23(int x) { return x * 23; }
+inline int f9976_24(int x) { return x * 24; }
+inline int f9976_25(int x) { return x * 25; }
+inline int f9976_26(int x) { return x * 26; }
+inline int f9976_27(int x) { return x * 27; }
+inline int f9976_28(int x) { return x * 28; }
+inline int f9976_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9979 */
+#include <vector>
+#include "h9456.h"
+#include "h4746.h"
+#include "h1639.h"
+#include "h155.h"
+#include "h3447.h"
+#ifdef X
+#include "h942.h"
+#endif
+struct S9979 { int a; const char *s = "x//y"; };
+inline int f9979_0(int x) { return x * 0; }
+inline int f9979_1(int x) { return x * 1; }
+inline int f9979_2(int x) { return x * 2; }
+inline int f9979_3(int x) { return x * 3; }
+inline int f9979_4(int x) { return x * 4; }
+inline int f9979_5(int x) { return x * 5; }
+inline int f9979_6(int x) { return x * 6; }
+inline int f9979_7(int x) { return x * 7; }
+inline int f9979_8(int x) { return x * 8; }
+inline int f9979_9(int x) { return x * 9; }
+inline int f9979_10(int x) { return x * 10; }
+inline int f9979_11(int x) { return x * 11; }
+inline int f9979_12(int x) { return x * 12; }
+inline int f9979_13(int x) { return x * 13; }
+inline int f9979_14(int x) { return x * 14; }
+inline int f9979_15(int x) { return x * 15; }
+inline int f9979_16(int x) { return x * 16; }
+inline int f9979_17(int x) { return x * 17; }
+inline int f9979_18(int x) { return x * 18; }
+inline int f9979_19(int x) { return x * 19; }
+inline int f9979_20(int x) { return x * 20; }
+inline int f9979_21(int x) { return x * 21; }
+inline int f9979_22(int x) { return x * 22; }
+inline int f9979_23(int x) { return x * 23; }
+inline int f9979_24(int x) { return x * 24; }
+inline int f9979_25(int x) { return x * 25; }
+inline int f9979_26(int x) { return x * 26; }
+inline int f9979_27(int x) { return x * 27; }
+inline int f9979_28(int x) { return x * 28; }
+inline int f9979_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9980 */
+#include <vector>
+#include "h7466.h"
+#include "h6388.h"
+#include "h921.h"
+#include "h2.h"
+#include "h4882.h"
+#ifdef X
+#include "h3607.h"
+#endif
+struct S9980 { int a; const char *s = "x//y"; };
+inline int f9980_0(int x) { return x * 0; }
+inline int f9980_1(int x) { return x * 1; }
+inline int f9980_2(int x) { return x * 2; }
+inline int f9980_3(int x) { return x * 3; }
+inline int f9980_4(int x) { return x * 4; }
+inline int f9980_5(int x) { return x * 5; }
+inline int f9980_6(int x) { return x * 6; }
+inline int f9980_7(int x) { return x * 7; }
+inline int f9980_8(int x) { return x * 8; }
+inline int f9980_9(int x) { return x * 9; }
+inline int f9980_10(int x) { return x * 10; }
+inline int f9980_11(int x) { return x * 11; }
+inline int f9980_12(int x) { return x * 12; }
+inline int f9980_13(int x) { return x * 13; }
+inline int f9980_14(int x) { return x * 14; }
+inline int f9980_15(int x) { return x * 15; }
+inline int f9980_16(int x) { return x * 16; }
+inline int f9980_17(int x) { return x * 17; }
+inline int f9980_18(int x) { return x * 18; }
+inline int f9980_19(int x) { return x * 19; }
+inline int f9980_20(int x) { return x * 20; }
+inline int f9980_21(int x) { return x * 21; }
+inline int f9980_22(int x) { return x * 22; }
+inline int f9980_23(int x) { return x * 23; }
+inline int f9980_24(int x) { return x * 24; }
+inline int f9980_25(int x) { return x * 25; }
+inline int f9980_26(int x) { return x * 26; }
+inline int f9980_27(int x) { return x * 27; }
+inline int f9980_28(int x) { return x * 28; }
+inline int f9980_29(int x) { return x * 29; }
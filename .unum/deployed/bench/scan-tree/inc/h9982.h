@@ -0,0 +1,42 @@
+#pragma once
+/* header 9982 */
+#include <vector>
+#include "h7076.h"
+#include "h4893.h"
+#include "h454.h"
+#include "h9160.h"
+#include "h3918.h"
+#ifdef X
+#include "h3462.h"
+#endif
+struct S9982 { int a; const char *s = "x//y"; };
+inline int f9982_0(int x) { return x * 0; }
+inline int f9982_1(int x) { return x * 1; }
+inline int f9982_2(int x) { return x * 2; }
+inline int f9982_3(int x) { return x * 3; }
+inline int f9982_4(int x) { return x * 4; }
+inline int f9982_5(int x) { return x * 5; }
+inline int f9982_6(int x) { return x * 6; }
+inline int f9982_7(int x) { return x * 7; }
+inline int f9982_8(int x) { return x * 8; }
+inline int f9982_9(int x) { return x * 9; }
+inline int f9982_10(int x) { return x * 10; }
+inline int f9982_11(int x) { return x * 11; }
+inline int f9982_12(int x) { return x * 12; }
+inline int f9982_13(int x) { return x * 13; }
+inline int f9982_14(int x) { return x * 14; }
+inline int f9982_15(int x) { return x * 15; }
+inline int f9982_16(int x) { return x * 16; }
+inline int f9982_17(int x) { return x * 17; }
+inline int f9982_18(int x) { return x * 18; }
+inline int f9982_19(int x) { return x * 19; }
+inline int f9982_20(int x) { return x * 20; }
+inline int f9982_21(int x) { return x * 21; }
+inline int f9982_22(int x) { return x * 22; }
+inline int f9982_23(int x) { return x * 23; }
+inline int f9982_24(int x) { return x * 24; }
+inline int f9982_25(int x) { return x * 25; }
+inline int f9982_26(int x) { return x * 26; }
+inline int f9982_27(int x) { return x * 27; }
+inline int f9982_28(int x) { return x * 28; }
+inline int f9982_29(int x) { return x * 29; }
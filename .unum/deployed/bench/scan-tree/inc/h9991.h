@@ -0,0 +1,42 @@
+#pragma once
+/* header 9991 */
+#include <vector>
+#include "h7243.h"
+#include "h6846.h"
+#include "h5134.h"
+#include "h6043.h"
+#include "h9432.h"
+#ifdef X
+#include "h949.h"
+#endif
+struct S9991 { int a; const char *s = "x//y"; };
+inline int f9991_0(int x) { return x * 0; }
+inline int f9991_1(int x) { return x * 1; }
+inline int f9991_2(int x) { return x * 2; }
+inline int f9991_3(int x) { return x * 3; }
+inline int f9991_4(int x) { return x * 4; }
+inline int f9991_5(int x) { return x * 5; }
+inline int f9991_6(int x) { return x * 6; }
+inline int f9991_7(int x) { return x * 7; }
+inline int f9991_8(int x) { return x * 8; }
+inline int f9991_9(int x) { return x * 9; }
+inline int f9991_10(int x) { return x * 10; }
+inline int f9991_11(int x) { return x * 11; }
+inline int f9991_12(int x) { return x * 12; }
+inline int f9991_13(int x) { return x * 13; }
+inline int f9991_14(int x) { return x * 14; }
+inline int f9991_15(int x) { return x * 15; }
+inline int f9991_16(int x) { return x * 16; }
+inline int f9991_17(int x) { return x * 17; }
+inline int f9991_18(int x) { return x * 18; }
+inline int f9991_19(int x) { return x * 19; }
+inline int f9991_20(int x) { return x * 20; }
+inline int f9991_21(int x) { return x * 21; }
+inline int f9991_22(int x) { return x * 22; }
+inline int f9991_23(int x) { return x * 23; }
+inline int f9991_24(int x) { return x * 24; }
+inline int f9991_25(int x) { return x * 25; }
+inline int f9991_26(int x) { return x * 26; }
+inline int f9991_27(int x) { return x * 27; }
+inline int f9991_28(int x) { return x * 28; }
+inline int f9991_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9992 */
+#include <vector>
+#include "h923.h"
+#include "h8922.h"
+#include "h3018.h"
+#include "h5343.h"
+#include "h6859.h"
+#ifdef X
+#include "h7368.h"
+#endif
+struct S9992 { int a; const char *s = "x//y"; };
+inline int f9992_0(int x) { return x * 0; }
+inline int f9992_1(int x) { return x * 1; }
+inline int f9992_2(int x) { return x * 2; }
+inline int f9992_3(int x) { return x * 3; }
+inline int f9992_4(int x) { return x * 4; }
+inline int f9992_5(int x) { return x * 5; }
+inline int f9992_6(int x) { return x * 6; }
+inline int f9992_7(int x) { return x * 7; }
+inline int f9992_8(int x) { return x * 8; }
+inline int f9992_9(int x) { return x * 9; }
+inline int f9992_10(int x) { return x * 10; }
+inline int f9992_11(int x) { return x * 11; }
+inline int f9992_12(int x) { return x * 12; }
+inline int f9992_13(int x) { return x * 13; }
+inline int f9992_14(int x) { return x * 14; }
+inline int f9992_15(int x) { return x * 15; }
+inline int f9992_16(int x) { return x * 16; }
+inline int f9992_17(int x) { return x * 17; }
+inline int f9992_18(int x) { return x * 18; }
+inline int f9992_19(int x) { return x * 19; }
+inline int f9992_20(int x) { return x * 20; }
+inline int f9992_21(int x) { return x * 21; }
+inline int f9992_22(int x) { return x * 22; }
+inline int f9992_23(int x) { return x * 23; }
+inline int f9992_24(int x) { return x * 24; }
+inline int f9992_25(int x) { return x * 25; }
+inline int f9992_26(int x) { return x * 26; }
+inline int f9992_27(int x) { return x * 27; }
+inline int f9992_28(int x) { return x * 28; }
+inline int f9992_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9993 */
+#include <vector>
+#include "h5401.h"
+#include "h1964.h"
+#include "h6263.h"
+#include "h2570.h"
+#include "h1438.h"
+#ifdef X
+#include "h2848.h"
+#endif
+struct S9993 { int a; const char *s = "x//y"; };
+inline int f9993_0(int x) { return x * 0; }
+inline int f9993_1(int x) { return x * 1; }
+inline int f9993_2(int x) { return x * 2; }
+inline int f9993_3(int x) { return x * 3; }
+inline int f9993_4(int x) { return x * 4; }
+inline int f9993_5(int x) { return x * 5; }
+inline int f9993_6(int x) { return x * 6; }
+inline int f9993_7(int x) { return x * 7; }
+inline int f9993_8(int x) { return x * 8; }
+inline int f9993_9(int x) { return x * 9; }
+inline int f9993_10(int x) { return x * 10; }
+inline int f9993_11(int x) { return x * 11; }
+inline int f9993_12(int x) { return x * 12; }
+inline int f9993_13(int x) { return x * 13; }
+inline int f9993_14(int x) { return x * 14; }
+inline int f9993_15(int x) { return x * 15; }
+inline int f9993_16(int x) { return x * 16; }
+inline int f9993_17(int x) { return x * 17; }
+inline int f9993_18(int x) { return x * 18; }
+inline int f9993_19(int x) { return x * 19; }
+inline int f9993_20(int x) { return x * 20; }
+inline int f9993_21(int x) { return x * 21; }
+inline int f9993_22(int x) { return x * 22; }
+inline int f9993_23(int x) { return x * 23; }
+inline int f9993_24(int x) { return x * 24; }
+inline int f9993_25(int x) { return x * 25; }
+inline int f9993_26(int x) { return x * 26; }
+inline int f9993_27(int x) { return x * 27; }
+inline int f9993_28(int x) { return x * 28; }
+inline int f9993_29(int x) { return x * 29; }
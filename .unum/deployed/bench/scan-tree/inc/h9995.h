@@ -0,0 +1,42 @@
+#pragma once
+/* header 9995 */
+#include <vector>
+#include "h9871.h"
+#include "h7477.h"
+#include "h8013.h"
+#include "h1219.h"
+#include "h8166.h"
+#ifdef X
+#include "h2973.h"
+#endif
+struct S9995 { int a; const char *s = "x//y"; };
+inline int f9995_0(int x) { return x * 0; }
+inline int f9995_1(int x) { return x * 1; }
+inline int f9995_2(int x) { return x * 2; }
+inline int f9995_3(int x) { return x * 3; }
+inline int f9995_4(int x) { return x * 4; }
+inline int f9995_5(int x) { return x * 5; }
+inline int f9995_6(int x) { return x * 6; }
+inline int f9995_7(int x) { return x * 7; }
+inline int f9995_8(int x) { return x * 8; }
+inline int f9995_9(int x) { return x * 9; }
+inline int f9995_10(int x) { return x * 10; }
+inline int f9995_11(int x) { return x * 11; }
+inline int f9995_12(int x) { return x * 12; }
+inline int f9995_13(int x) { return x * 13; }
+inline int f9995_14(int x) { return x * 14; }
+inline int f9995_15(int x) { return x * 15; }
+inline int f9995_16(int x) { return x * 16; }
+inline int f9995_17(int x) { return x * 17; }
+inline int f9995_18(int x) { return x * 18; }
+inline int f9995_19(int x) { return x * 19; }
+inline int f9995_20(int x) { return x * 20; }
+inline int f9995_21(int x) { return x * 21; }
+inline int f9995_22(int x) { return x * 22; }
+inline int f9995_23(int x) { return x * 23; }
+inline int f9995_24(int x) { return x * 24; }
+inline int f9995_25(int x) { return x * 25; }
+inline int f9995_26(int x) { return x * 26; }
+inline int f9995_27(int x) { return x * 27; }
+inline int f9995_28(int x) { return x * 28; }
+inline int f9995_29(int x) { return x * 29; }
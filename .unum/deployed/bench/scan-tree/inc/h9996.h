@@ -0,0 +1,42 @@
+#pragma once
+/* header 9996 */
+#include <vector>
+#include "h4403.h"
+#include "h5467.h"
+#include "h1572.h"
+#include "h6580.h"
+#include "h2004.h"
+#ifdef X
+#include "h3308.h"
+#endif
+struct S9996 { int a; const char *s = "x//y"; };
+inline int f9996_0(int x) { return x * 0; }
+inline int f9996_1(int x) { return x * 1; }
+inline int f9996_2(int x) { return x * 2; }
+inline int f9996_3(int x) { return x * 3; }
+inline int f9996_4(int x) { return x * 4; }
+inline int f9996_5(int x) { return x * 5; }
+inline int f9996_6(int x) { return x * 6; }
+inline int f9996_7(int x) { return x * 7; }
+inline int f9996_8(int x) { return x * 8; }
+inline int f9996_9(int x) { return x * 9; }
+inline int f9996_10(int x) { return x * 10; }
+inline int f9996_11(int x) { return x * 11; }
+inline int f9996_12(int x) { return x * 12; }
+inline int f9996_13(int x) { return x * 13; }
+inline int f9996_14(int x) { return x * 14; }
+inline int f9996_15(int x) { return x * 15; }
+inline int f9996_16(int x) { return x * 16; }
+inline int f9996_17(int x) { return x * 17; }
+inline int f9996_18(int x) { return x * 18; }
+inline int f9996_19(int x) { return x * 19; }
+inline int f9996_20(int x) { return x * 20; }
+inline int f9996_21(int x) { return x * 21; }
+inline int f9996_22(int x) { return x * 22; }
+inline int f9996_23(int x) { return x * 23; }
+inline int f9996_24(int x) { return x * 24; }
+inline int f9996_25(int x) { return x * 25; }
+inline int f9996_26(int x) { return x * 26; }
+inline int f9996_27(int x) { return x * 27; }
+inline int f9996_28(int x) { return x * 28; }
+inline int f9996_29(int x) { return x * 29; }
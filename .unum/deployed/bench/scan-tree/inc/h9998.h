@@ -0,0 +1,42 @@
+#pragma once
+/* header 9998 */
+#include <vector>
+#include "h1490.h"
+#include "h4920.h"
+#include "h2667.h"
+#include "h4328.h"
+#include "h1498.h"
+#ifdef X
+#include "h7914.h"
+#endif
+struct S9998 { int a; const char *s = "x//y"; };
+inline int f9998_0(int x) { return x * 0; }
+inline int f9998_1(int x) { return x * 1; }
+inline int f9998_2(int x) { return x * 2; }
+inline int f9998_3(int x) { return x * 3; }
+inline int f9998_4(int x) { return x * 4; }
+inline int f9998_5(int x) { return x * 5; }
+inline int f9998_6(int x) { return x * 6; }
+inline int f9998_7(int x) { return x * 7; }
+inline int f9998_8(int x) { return x * 8; }
+inline int f9998_9(int x) { return x * 9; }
+inline int f9998_10(int x) { return x * 10; }
+inline int f9998_11(int x) { return x * 11; }
+inline int f9998_12(int x) { return x * 12; }
+inline int f9998_13(int x) { return x * 13; }
+inline int f9998_14(int x) { return x * 14; }
+inline int f9998_15(int x) { return x * 15; }
+inline int f9998_16(int x) { return x * 16; }
+inline int f9998_17(int x) { return x * 17; }
+inline int f9998_18(int x) { return x * 18; }
+inline int f9998_19(int x) { return x * 19; }
+inline int f9998_20(int x) { return x * 20; }
+inline int f9998_21(int x) { return x * 21; }
+inline int f9998_22(int x) { return x * 22; }
+inline int f9998_23(int x) { return x * 23; }
+inline int f9998_24(int x) { return x * 24; }
+inline int f9998_25(int x) { return x * 25; }
+inline int f9998_26(int x) { return x * 26; }
+inline int f9998_27(int x) { return x * 27; }
+inline int f9998_28(int x) { return x * 28; }
+inline int f9998_29(int x) { return x * 29; }
@@ -0,0 +1,42 @@
+#pragma once
+/* header 9999 */
+#include <vector>
+#include "h7975.h"
+#include "h2277.h"
+#include "h2022.h"
+#include "h2724.h"
+#include "h1057.h"
+#ifdef X
+#include "h1964.h"
+#endif
+struct S9999 { int a; const char *s = "x//y"; };
+inline int f9999_0(int x) { return x * 0; }
+inline int f9999_1(int x) { return x * 1; }
+inline int f9999_2(int x) { return x * 2; }
+inline int f9999_3(int x) { return x * 3; }
+inline int f9999_4(int x) { return x * 4; }
+inline int f9999_5(int x) { return x * 5; }
+inline int f9999_6(int x) { return x * 6; }
+inline int f9999_7(int x) { return x * 7; }
+inline int f9999_8(int x) { return x * 8; }
+inline int f9999_9(int x) { return x * 9; }
+inline int f9999_10(int x) { return x * 10; }
+inline int f9999_11(int x) { return x * 11; }
+inline int f9999_12(int x) { return x * 12; }
+inline int f9999_13(int x) { return x * 13; }
+inline int f9999_14(int x) { return x * 14; }
+inline int f9999_15(int x) { return x * 15; }
+inline int f9999_16(int x) { return x * 16; }
+inline int f9999_17(int x) { return x * 17; }
+inline int f9999_18(int x) { return x * 18; }
+inline int f9999_19(int x) { return x * 19; }
+inline int f9999_20(int x) { return x * 20; }
+inline int f9999_21(int x) { return x * 21; }
+inline int f9999_22(int x) { return x * 22; }
+inline int f9999_23(int x) { return x * 23; }
+inline int f9999_24(int x) { return x * 24; }
+inline int f9999_25(int x) { return x * 25; }
+inline int f9999_26(int x) { return x * 26; }
+inline int f9999_27(int x) { return x * 27; }
+inline int f9999_28(int x) { return x * 28; }
+inline int f9999_29(int x) { return x * 29; }
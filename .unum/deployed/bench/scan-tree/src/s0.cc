@@ -0,0 +1,11 @@
+#define M "h7504.h"
+#include M
+#include "h949.h"
+#include "h3541.h"
+#include "h2526.h"
+#include "h3719.h"
+#include "h4495.h"
+#if 0
+#include "h1049.h"
+#endif
+int main_0() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2666.h"
+#include "h2854.h"
+#include "h5052.h"
+#include "h3388.h"
+#include "h5198.h"
+int main_1() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1434.h"
+#include "h2694.h"
+#include "h9752.h"
+#include "h4208.h"
+#include "h4649.h"
+#if 0
+#include "h6267.h"
+#endif
+int main_10() { return 0; }
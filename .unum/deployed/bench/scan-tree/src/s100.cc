@@ -0,0 +1,9 @@
+#include "h4053.h"
+#include "h4441.h"
+#include "h6770.h"
+#include "h6925.h"
+#include "h1095.h"
+#if 0
+#include "h681.h"
+#endif
+int main_100() { return 0; }
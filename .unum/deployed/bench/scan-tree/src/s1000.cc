@@ -0,0 +1,9 @@
+#include "h413.h"
+#include "h6685.h"
+#include "h5207.h"
+#include "h9665.h"
+#include "h6444.h"
+#if 0
+#include "h5384.h"
+#endif
+int main_1000() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3831.h"
+#include "h4871.h"
+#include "h7512.h"
+#include "h2094.h"
+#include "h5643.h"
+int main_1001() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2301.h"
+#include "h9321.h"
+#include "h9981.h"
+#include "h6090.h"
+#include "h9572.h"
+int main_1002() { return 0; }
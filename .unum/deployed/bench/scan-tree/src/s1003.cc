@@ -0,0 +1,6 @@
+#include "h6804.h"
+#include "h5354.h"
+#include "h2390.h"
+#include "h9722.h"
+#include "h6855.h"
+int main_1003() { return 0; }
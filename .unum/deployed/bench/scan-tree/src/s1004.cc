@@ -0,0 +1,6 @@
+#include "h2051.h"
+#include "h2820.h"
+#include "h6162.h"
+#include "h3274.h"
+#include "h4838.h"
+int main_1004() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4982.h"
+#include "h9453.h"
+#include "h709.h"
+#include "h6984.h"
+#include "h6259.h"
+#if 0
+#include "h318.h"
+#endif
+int main_1005() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3822.h"
+#include "h3883.h"
+#include "h2358.h"
+#include "h9690.h"
+#include "h8454.h"
+int main_1006() { return 0; }
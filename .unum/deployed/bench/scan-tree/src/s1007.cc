@@ -0,0 +1,6 @@
+#include "h1120.h"
+#include "h2275.h"
+#include "h5009.h"
+#include "h5301.h"
+#include "h1.h"
+int main_1007() { return 0; }
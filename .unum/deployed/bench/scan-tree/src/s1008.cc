@@ -0,0 +1,6 @@
+#include "h2584.h"
+#include "h7014.h"
+#include "h3788.h"
+#include "h9938.h"
+#include "h8586.h"
+int main_1008() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6556.h"
+#include "h2057.h"
+#include "h489.h"
+#include "h4739.h"
+#include "h766.h"
+int main_1009() { return 0; }
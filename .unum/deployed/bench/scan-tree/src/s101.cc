@@ -0,0 +1,6 @@
+#include "h9372.h"
+#include "h3862.h"
+#include "h4071.h"
+#include "h5396.h"
+#include "h2293.h"
+int main_101() { return 0; }
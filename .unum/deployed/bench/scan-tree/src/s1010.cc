@@ -0,0 +1,9 @@
+#include "h1709.h"
+#include "h1944.h"
+#include "h3037.h"
+#include "h3125.h"
+#include "h6773.h"
+#if 0
+#include "h3766.h"
+#endif
+int main_1010() { return 0; }
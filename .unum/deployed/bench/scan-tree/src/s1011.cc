@@ -0,0 +1,6 @@
+#include "h450.h"
+#include "h8964.h"
+#include "h809.h"
+#include "h9635.h"
+#include "h144.h"
+int main_1011() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5668.h"
+#include "h2521.h"
+#include "h8047.h"
+#include "h5350.h"
+#include "h40.h"
+int main_1012() { return 0; }
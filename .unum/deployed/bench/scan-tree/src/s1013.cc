@@ -0,0 +1,6 @@
+#include "h2363.h"
+#include "h622.h"
+#include "h2589.h"
+#include "h5765.h"
+#include "h7952.h"
+int main_1013() { return 0; }
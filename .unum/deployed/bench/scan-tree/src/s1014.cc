@@ -0,0 +1,6 @@
+#include "h3534.h"
+#include "h5958.h"
+#include "h4101.h"
+#include "h8482.h"
+#include "h3153.h"
+int main_1014() { return 0; }
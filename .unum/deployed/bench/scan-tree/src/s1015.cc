@@ -0,0 +1,9 @@
+#include "h5402.h"
+#include "h9108.h"
+#include "h2868.h"
+#include "h2412.h"
+#include "h9836.h"
+#if 0
+#include "h2676.h"
+#endif
+int main_1015() { return 0; }
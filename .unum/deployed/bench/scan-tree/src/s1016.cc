@@ -0,0 +1,6 @@
+#include "h7019.h"
+#include "h60.h"
+#include "h9624.h"
+#include "h2252.h"
+#include "h9192.h"
+int main_1016() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5643.h"
+#include "h2635.h"
+#include "h7576.h"
+#include "h787.h"
+#include "h5081.h"
+int main_1017() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6387.h"
+#include "h4198.h"
+#include "h1337.h"
+#include "h2546.h"
+#include "h4889.h"
+int main_1018() { return 0; }
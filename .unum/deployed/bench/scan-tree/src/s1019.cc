@@ -0,0 +1,6 @@
+#include "h2592.h"
+#include "h3438.h"
+#include "h4935.h"
+#include "h4880.h"
+#include "h2540.h"
+int main_1019() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9911.h"
+#include "h2266.h"
+#include "h875.h"
+#include "h3988.h"
+#include "h2519.h"
+int main_102() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6449.h"
+#include "h5471.h"
+#include "h6945.h"
+#include "h7962.h"
+#include "h88.h"
+#if 0
+#include "h1536.h"
+#endif
+int main_1020() { return 0; }
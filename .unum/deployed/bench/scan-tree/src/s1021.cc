@@ -0,0 +1,6 @@
+#include "h327.h"
+#include "h8937.h"
+#include "h3477.h"
+#include "h5437.h"
+#include "h5947.h"
+int main_1021() { return 0; }
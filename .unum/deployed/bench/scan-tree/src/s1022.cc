@@ -0,0 +1,6 @@
+#include "h6930.h"
+#include "h5450.h"
+#include "h5725.h"
+#include "h2994.h"
+#include "h2627.h"
+int main_1022() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9397.h"
+#include "h2962.h"
+#include "h4420.h"
+#include "h5602.h"
+#include "h4242.h"
+int main_1023() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6592.h"
+#include "h8750.h"
+#include "h1146.h"
+#include "h7980.h"
+#include "h610.h"
+int main_1024() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9939.h"
+#include "h810.h"
+#include "h2263.h"
+#include "h552.h"
+#include "h419.h"
+#if 0
+#include "h82.h"
+#endif
+int main_1025() { return 0; }
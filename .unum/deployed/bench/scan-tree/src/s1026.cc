@@ -0,0 +1,6 @@
+#include "h8722.h"
+#include "h4445.h"
+#include "h2857.h"
+#include "h5667.h"
+#include "h4263.h"
+int main_1026() { return 0; }
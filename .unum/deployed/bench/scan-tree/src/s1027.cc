@@ -0,0 +1,6 @@
+#include "h9445.h"
+#include "h7350.h"
+#include "h9563.h"
+#include "h3857.h"
+#include "h6895.h"
+int main_1027() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6301.h"
+#include "h5002.h"
+#include "h9307.h"
+#include "h6729.h"
+#include "h5640.h"
+int main_1028() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4529.h"
+#include "h1806.h"
+#include "h856.h"
+#include "h5349.h"
+#include "h4243.h"
+int main_1029() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1126.h"
+#include "h881.h"
+#include "h1757.h"
+#include "h4213.h"
+#include "h2274.h"
+int main_103() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2787.h"
+#include "h4346.h"
+#include "h1385.h"
+#include "h3080.h"
+#include "h6629.h"
+#if 0
+#include "h8157.h"
+#endif
+int main_1030() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8317.h"
+#include "h4137.h"
+#include "h2655.h"
+#include "h364.h"
+#include "h8714.h"
+int main_1031() { return 0; }
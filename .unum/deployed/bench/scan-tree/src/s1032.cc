@@ -0,0 +1,6 @@
+#include "h5726.h"
+#include "h2093.h"
+#include "h2680.h"
+#include "h8732.h"
+#include "h4836.h"
+int main_1032() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5887.h"
+#include "h4401.h"
+#include "h5762.h"
+#include "h9135.h"
+#include "h9714.h"
+int main_1033() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3185.h"
+#include "h6635.h"
+#include "h8036.h"
+#include "h8489.h"
+#include "h1472.h"
+int main_1034() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1033.h"
+#include "h6151.h"
+#include "h2039.h"
+#include "h2654.h"
+#include "h8860.h"
+#if 0
+#include "h7499.h"
+#endif
+int main_1035() { return 0; }
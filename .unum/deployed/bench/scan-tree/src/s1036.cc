@@ -0,0 +1,6 @@
+#include "h1321.h"
+#include "h5974.h"
+#include "h1741.h"
+#include "h4630.h"
+#include "h9934.h"
+int main_1036() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5667.h"
+#include "h6722.h"
+#include "h2769.h"
+#include "h6882.h"
+#include "h9898.h"
+int main_1037() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7611.h"
+#include "h9639.h"
+#include "h5856.h"
+#include "h8809.h"
+#include "h3055.h"
+int main_1038() { return 0; }
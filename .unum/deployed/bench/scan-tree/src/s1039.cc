@@ -0,0 +1,6 @@
+#include "h3079.h"
+#include "h3263.h"
+#include "h845.h"
+#include "h274.h"
+#include "h3464.h"
+int main_1039() { return 0; }
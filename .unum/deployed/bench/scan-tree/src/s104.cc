@@ -0,0 +1,6 @@
+#include "h1345.h"
+#include "h2087.h"
+#include "h5596.h"
+#include "h7518.h"
+#include "h4639.h"
+int main_104() { return 0; }
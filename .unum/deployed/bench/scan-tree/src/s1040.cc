@@ -0,0 +1,9 @@
+#include "h9770.h"
+#include "h8470.h"
+#include "h5939.h"
+#include "h7780.h"
+#include "h2333.h"
+#if 0
+#include "h9452.h"
+#endif
+int main_1040() { return 0; }
@@ -0,0 +1,6 @@
+#include "h69.h"
+#include "h3609.h"
+#include "h774.h"
+#include "h9198.h"
+#include "h2543.h"
+int main_1041() { return 0; }
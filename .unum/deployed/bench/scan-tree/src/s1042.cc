@@ -0,0 +1,6 @@
+#include "h1404.h"
+#include "h3944.h"
+#include "h6152.h"
+#include "h4878.h"
+#include "h9188.h"
+int main_1042() { return 0; }
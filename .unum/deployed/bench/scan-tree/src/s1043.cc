@@ -0,0 +1,6 @@
+#include "h4295.h"
+#include "h9792.h"
+#include "h8485.h"
+#include "h3129.h"
+#include "h5087.h"
+int main_1043() { return 0; }
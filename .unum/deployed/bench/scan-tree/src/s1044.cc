@@ -0,0 +1,6 @@
+#include "h2616.h"
+#include "h2501.h"
+#include "h4870.h"
+#include "h8635.h"
+#include "h7370.h"
+int main_1044() { return 0; }
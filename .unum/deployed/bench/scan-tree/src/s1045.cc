@@ -0,0 +1,9 @@
+#include "h4918.h"
+#include "h4788.h"
+#include "h9775.h"
+#include "h7450.h"
+#include "h4401.h"
+#if 0
+#include "h938.h"
+#endif
+int main_1045() { return 0; }
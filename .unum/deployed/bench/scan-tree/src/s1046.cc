@@ -0,0 +1,6 @@
+#include "h9744.h"
+#include "h356.h"
+#include "h3360.h"
+#include "h8777.h"
+#include "h5628.h"
+int main_1046() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2657.h"
+#include "h4853.h"
+#include "h3535.h"
+#include "h8934.h"
+#include "h6271.h"
+int main_1047() { return 0; }
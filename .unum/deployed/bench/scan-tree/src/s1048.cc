@@ -0,0 +1,6 @@
+#include "h9194.h"
+#include "h3043.h"
+#include "h2956.h"
+#include "h2652.h"
+#include "h9360.h"
+int main_1048() { return 0; }
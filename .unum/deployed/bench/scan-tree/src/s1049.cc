@@ -0,0 +1,6 @@
+#include "h5450.h"
+#include "h6250.h"
+#include "h1398.h"
+#include "h9404.h"
+#include "h3695.h"
+int main_1049() { return 0; }
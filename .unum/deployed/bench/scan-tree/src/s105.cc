@@ -0,0 +1,9 @@
+#include "h931.h"
+#include "h2849.h"
+#include "h8355.h"
+#include "h8706.h"
+#include "h2064.h"
+#if 0
+#include "h2893.h"
+#endif
+int main_105() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9067.h"
+#include "h9232.h"
+#include "h9918.h"
+#include "h5982.h"
+#include "h4931.h"
+#if 0
+#include "h6824.h"
+#endif
+int main_1050() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9247.h"
+#include "h3365.h"
+#include "h5146.h"
+#include "h3851.h"
+#include "h2971.h"
+int main_1051() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6893.h"
+#include "h1397.h"
+#include "h4129.h"
+#include "h2948.h"
+#include "h9417.h"
+int main_1052() { return 0; }
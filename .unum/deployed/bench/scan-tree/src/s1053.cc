@@ -0,0 +1,6 @@
+#include "h8040.h"
+#include "h6265.h"
+#include "h7280.h"
+#include "h7295.h"
+#include "h4151.h"
+int main_1053() { return 0; }
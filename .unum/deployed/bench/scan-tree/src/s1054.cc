@@ -0,0 +1,6 @@
+#include "h1709.h"
+#include "h3238.h"
+#include "h5526.h"
+#include "h8994.h"
+#include "h668.h"
+int main_1054() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9508.h"
+#include "h1157.h"
+#include "h8518.h"
+#include "h817.h"
+#include "h4745.h"
+#if 0
+#include "h6067.h"
+#endif
+int main_1055() { return 0; }
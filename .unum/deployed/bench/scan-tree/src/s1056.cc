@@ -0,0 +1,6 @@
+#include "h6579.h"
+#include "h3636.h"
+#include "h2840.h"
+#include "h1358.h"
+#include "h450.h"
+int main_1056() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9723.h"
+#include "h1991.h"
+#include "h4349.h"
+#include "h1248.h"
+#include "h7938.h"
+int main_1057() { return 0; }
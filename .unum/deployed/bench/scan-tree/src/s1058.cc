@@ -0,0 +1,6 @@
+#include "h6883.h"
+#include "h5735.h"
+#include "h2757.h"
+#include "h607.h"
+#include "h2275.h"
+int main_1058() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2464.h"
+#include "h8177.h"
+#include "h6707.h"
+#include "h4363.h"
+#include "h3950.h"
+int main_1059() { return 0; }
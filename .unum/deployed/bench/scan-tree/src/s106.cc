@@ -0,0 +1,6 @@
+#include "h9914.h"
+#include "h6080.h"
+#include "h2443.h"
+#include "h8197.h"
+#include "h8442.h"
+int main_106() { return 0; }
@@ -0,0 +1,9 @@
+#include "h268.h"
+#include "h1640.h"
+#include "h3841.h"
+#include "h1615.h"
+#include "h5318.h"
+#if 0
+#include "h3827.h"
+#endif
+int main_1060() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1132.h"
+#include "h4945.h"
+#include "h729.h"
+#include "h3230.h"
+#include "h9504.h"
+int main_1061() { return 0; }
@@ -0,0 +1,6 @@
+#include "h710.h"
+#include "h7609.h"
+#include "h5605.h"
+#include "h446.h"
+#include "h5643.h"
+int main_1062() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2137.h"
+#include "h8998.h"
+#include "h6344.h"
+#include "h1515.h"
+#include "h9068.h"
+int main_1063() { return 0; }
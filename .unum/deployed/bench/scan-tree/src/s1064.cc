@@ -0,0 +1,6 @@
+#include "h7169.h"
+#include "h8654.h"
+#include "h908.h"
+#include "h3219.h"
+#include "h4618.h"
+int main_1064() { return 0; }
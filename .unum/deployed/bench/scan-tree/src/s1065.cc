@@ -0,0 +1,9 @@
+#include "h1654.h"
+#include "h3402.h"
+#include "h8537.h"
+#include "h1276.h"
+#include "h2155.h"
+#if 0
+#include "h5014.h"
+#endif
+int main_1065() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9779.h"
+#include "h1315.h"
+#include "h7689.h"
+#include "h478.h"
+#include "h9011.h"
+int main_1066() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4662.h"
+#include "h4476.h"
+#include "h8702.h"
+#include "h89.h"
+#include "h4843.h"
+int main_1067() { return 0; }
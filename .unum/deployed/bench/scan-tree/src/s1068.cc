@@ -0,0 +1,6 @@
+#include "h2582.h"
+#include "h3810.h"
+#include "h2584.h"
+#include "h7013.h"
+#include "h8824.h"
+int main_1068() { return 0; }
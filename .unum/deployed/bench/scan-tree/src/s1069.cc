@@ -0,0 +1,6 @@
+#include "h2479.h"
+#include "h8462.h"
+#include "h1892.h"
+#include "h4655.h"
+#include "h8493.h"
+int main_1069() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4038.h"
+#include "h2676.h"
+#include "h6458.h"
+#include "h251.h"
+#include "h6564.h"
+int main_107() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7166.h"
+#include "h4465.h"
+#include "h744.h"
+#include "h1078.h"
+#include "h770.h"
+#if 0
+#include "h8197.h"
+#endif
+int main_1070() { return 0; }
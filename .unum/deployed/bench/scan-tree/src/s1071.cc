@@ -0,0 +1,6 @@
+#include "h317.h"
+#include "h2516.h"
+#include "h4256.h"
+#include "h8880.h"
+#include "h2545.h"
+int main_1071() { return 0; }
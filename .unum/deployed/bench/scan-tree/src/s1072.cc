@@ -0,0 +1,6 @@
+#include "h6973.h"
+#include "h2095.h"
+#include "h6748.h"
+#include "h6933.h"
+#include "h2562.h"
+int main_1072() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8854.h"
+#include "h2500.h"
+#include "h4986.h"
+#include "h5009.h"
+#include "h7913.h"
+int main_1073() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6402.h"
+#include "h5411.h"
+#include "h6445.h"
+#include "h1923.h"
+#include "h5136.h"
+int main_1074() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7622.h"
+#include "h5394.h"
+#include "h2882.h"
+#include "h9444.h"
+#include "h5237.h"
+#if 0
+#include "h7020.h"
+#endif
+int main_1075() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7218.h"
+#include "h7540.h"
+#include "h5793.h"
+#include "h4681.h"
+#include "h1486.h"
+int main_1076() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1814.h"
+#include "h5022.h"
+#include "h2548.h"
+#include "h9114.h"
+#include "h5172.h"
+int main_1077() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4933.h"
+#include "h9495.h"
+#include "h6348.h"
+#include "h3069.h"
+#include "h75.h"
+int main_1078() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8134.h"
+#include "h2139.h"
+#include "h3135.h"
+#include "h7790.h"
+#include "h222.h"
+int main_1079() { return 0; }
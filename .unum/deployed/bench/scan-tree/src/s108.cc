@@ -0,0 +1,6 @@
+#include "h867.h"
+#include "h7791.h"
+#include "h2350.h"
+#include "h5068.h"
+#include "h7133.h"
+int main_108() { return 0; }
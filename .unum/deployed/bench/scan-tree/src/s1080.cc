@@ -0,0 +1,9 @@
+#include "h985.h"
+#include "h1929.h"
+#include "h4512.h"
+#include "h9505.h"
+#include "h2138.h"
+#if 0
+#include "h4076.h"
+#endif
+int main_1080() { return 0; }
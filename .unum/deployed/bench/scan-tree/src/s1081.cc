@@ -0,0 +1,6 @@
+#include "h973.h"
+#include "h5790.h"
+#include "h8383.h"
+#include "h504.h"
+#include "h3337.h"
+int main_1081() { return 0; }
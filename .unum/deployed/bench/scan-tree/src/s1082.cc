@@ -0,0 +1,6 @@
+#include "h7848.h"
+#include "h5725.h"
+#include "h8766.h"
+#include "h7799.h"
+#include "h2824.h"
+int main_1082() { return 0; }
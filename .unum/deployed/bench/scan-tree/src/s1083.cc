@@ -0,0 +1,6 @@
+#include "h7713.h"
+#include "h6708.h"
+#include "h8773.h"
+#include "h3899.h"
+#include "h764.h"
+int main_1083() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1925.h"
+#include "h1740.h"
+#include "h5019.h"
+#include "h3361.h"
+#include "h6186.h"
+int main_1084() { return 0; }
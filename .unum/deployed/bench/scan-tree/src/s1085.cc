@@ -0,0 +1,9 @@
+#include "h6765.h"
+#include "h2959.h"
+#include "h9428.h"
+#include "h2319.h"
+#include "h7496.h"
+#if 0
+#include "h4216.h"
+#endif
+int main_1085() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5687.h"
+#include "h8188.h"
+#include "h9888.h"
+#include "h1727.h"
+#include "h9814.h"
+int main_1086() { return 0; }
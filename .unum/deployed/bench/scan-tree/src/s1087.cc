@@ -0,0 +1,6 @@
+#include "h996.h"
+#include "h776.h"
+#include "h7204.h"
+#include "h9175.h"
+#include "h3389.h"
+int main_1087() { return 0; }
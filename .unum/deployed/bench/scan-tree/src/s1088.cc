@@ -0,0 +1,6 @@
+#include "h8137.h"
+#include "h373.h"
+#include "h5937.h"
+#include "h5528.h"
+#include "h9417.h"
+int main_1088() { return 0; }
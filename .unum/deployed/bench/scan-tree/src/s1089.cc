@@ -0,0 +1,6 @@
+#include "h1978.h"
+#include "h7863.h"
+#include "h6116.h"
+#include "h7228.h"
+#include "h79.h"
+int main_1089() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2779.h"
+#include "h1321.h"
+#include "h9538.h"
+#include "h1980.h"
+#include "h7830.h"
+int main_109() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8224.h"
+#include "h8293.h"
+#include "h2817.h"
+#include "h3565.h"
+#include "h4767.h"
+#if 0
+#include "h4808.h"
+#endif
+int main_1090() { return 0; }
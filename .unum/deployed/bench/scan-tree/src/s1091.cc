@@ -0,0 +1,6 @@
+#include "h5792.h"
+#include "h6844.h"
+#include "h7207.h"
+#include "h6632.h"
+#include "h4343.h"
+int main_1091() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3788.h"
+#include "h6559.h"
+#include "h3579.h"
+#include "h1668.h"
+#include "h3234.h"
+int main_1092() { return 0; }
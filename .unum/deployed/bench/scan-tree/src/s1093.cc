@@ -0,0 +1,6 @@
+#include "h6427.h"
+#include "h8230.h"
+#include "h8938.h"
+#include "h8800.h"
+#include "h8267.h"
+int main_1093() { return 0; }
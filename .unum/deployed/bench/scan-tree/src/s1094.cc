@@ -0,0 +1,6 @@
+#include "h9919.h"
+#include "h6747.h"
+#include "h2842.h"
+#include "h2921.h"
+#include "h3955.h"
+int main_1094() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7207.h"
+#include "h4624.h"
+#include "h2598.h"
+#include "h9396.h"
+#include "h2209.h"
+#if 0
+#include "h3240.h"
+#endif
+int main_1095() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3796.h"
+#include "h8180.h"
+#include "h1409.h"
+#include "h3357.h"
+#include "h6403.h"
+int main_1096() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9090.h"
+#include "h9363.h"
+#include "h7162.h"
+#include "h2396.h"
+#include "h110.h"
+int main_1097() { return 0; }
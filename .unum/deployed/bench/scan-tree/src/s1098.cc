@@ -0,0 +1,6 @@
+#include "h1463.h"
+#include "h3487.h"
+#include "h2848.h"
+#include "h2072.h"
+#include "h9433.h"
+int main_1098() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4537.h"
+#include "h7214.h"
+#include "h4641.h"
+#include "h5103.h"
+#include "h3504.h"
+int main_1099() { return 0; }
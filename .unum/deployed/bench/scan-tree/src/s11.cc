@@ -0,0 +1,6 @@
+#include "h7662.h"
+#include "h188.h"
+#include "h1833.h"
+#include "h7684.h"
+#include "h5616.h"
+int main_11() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1618.h"
+#include "h7964.h"
+#include "h4404.h"
+#include "h7890.h"
+#include "h1219.h"
+#if 0
+#include "h6109.h"
+#endif
+int main_110() { return 0; }
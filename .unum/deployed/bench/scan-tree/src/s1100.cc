@@ -0,0 +1,9 @@
+#include "h4517.h"
+#include "h8753.h"
+#include "h1813.h"
+#include "h154.h"
+#include "h8259.h"
+#if 0
+#include "h7601.h"
+#endif
+int main_1100() { return 0; }
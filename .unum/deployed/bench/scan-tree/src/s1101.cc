@@ -0,0 +1,6 @@
+#include "h1141.h"
+#include "h2024.h"
+#include "h2266.h"
+#include "h6541.h"
+#include "h3457.h"
+int main_1101() { return 0; }
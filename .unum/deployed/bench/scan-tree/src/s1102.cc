@@ -0,0 +1,6 @@
+#include "h607.h"
+#include "h4796.h"
+#include "h8165.h"
+#include "h5232.h"
+#include "h7341.h"
+int main_1102() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2888.h"
+#include "h7806.h"
+#include "h2797.h"
+#include "h5006.h"
+#include "h6197.h"
+int main_1103() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9708.h"
+#include "h8933.h"
+#include "h8184.h"
+#include "h3111.h"
+#include "h3250.h"
+int main_1104() { return 0; }
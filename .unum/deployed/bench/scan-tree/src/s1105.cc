@@ -0,0 +1,9 @@
+#include "h6944.h"
+#include "h5784.h"
+#include "h4271.h"
+#include "h9023.h"
+#include "h3146.h"
+#if 0
+#include "h7671.h"
+#endif
+int main_1105() { return 0; }
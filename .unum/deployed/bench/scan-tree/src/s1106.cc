@@ -0,0 +1,6 @@
+#include "h4047.h"
+#include "h7193.h"
+#include "h5333.h"
+#include "h678.h"
+#include "h6341.h"
+int main_1106() { return 0; }
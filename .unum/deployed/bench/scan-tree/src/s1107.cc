@@ -0,0 +1,6 @@
+#include "h1689.h"
+#include "h4793.h"
+#include "h9171.h"
+#include "h2188.h"
+#include "h2778.h"
+int main_1107() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7027.h"
+#include "h6857.h"
+#include "h9154.h"
+#include "h2596.h"
+#include "h2870.h"
+int main_1108() { return 0; }
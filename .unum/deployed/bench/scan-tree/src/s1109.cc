@@ -0,0 +1,6 @@
+#include "h1883.h"
+#include "h3476.h"
+#include "h6113.h"
+#include "h7217.h"
+#include "h8165.h"
+int main_1109() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8216.h"
+#include "h2736.h"
+#include "h4240.h"
+#include "h3734.h"
+#include "h4986.h"
+int main_111() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2328.h"
+#include "h6133.h"
+#include "h812.h"
+#include "h198.h"
+#include "h9444.h"
+#if 0
+#include "h6949.h"
+#endif
+int main_1110() { return 0; }
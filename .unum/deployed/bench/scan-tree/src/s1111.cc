@@ -0,0 +1,6 @@
+#include "h1701.h"
+#include "h1566.h"
+#include "h6654.h"
+#include "h7557.h"
+#include "h4764.h"
+int main_1111() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6322.h"
+#include "h3022.h"
+#include "h1092.h"
+#include "h8111.h"
+#include "h9302.h"
+int main_1112() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1130.h"
+#include "h871.h"
+#include "h5073.h"
+#include "h1723.h"
+#include "h8972.h"
+int main_1113() { return 0; }
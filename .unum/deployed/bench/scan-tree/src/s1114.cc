@@ -0,0 +1,6 @@
+#include "h9575.h"
+#include "h1916.h"
+#include "h9411.h"
+#include "h921.h"
+#include "h6596.h"
+int main_1114() { return 0; }
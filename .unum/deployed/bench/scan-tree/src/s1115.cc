@@ -0,0 +1,9 @@
+#include "h8180.h"
+#include "h6431.h"
+#include "h2398.h"
+#include "h9000.h"
+#include "h1691.h"
+#if 0
+#include "h5388.h"
+#endif
+int main_1115() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7667.h"
+#include "h573.h"
+#include "h4124.h"
+#include "h9119.h"
+#include "h9883.h"
+int main_1116() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3554.h"
+#include "h699.h"
+#include "h3275.h"
+#include "h9692.h"
+#include "h2365.h"
+int main_1117() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6638.h"
+#include "h5232.h"
+#include "h6025.h"
+#include "h2587.h"
+#include "h1008.h"
+int main_1118() { return 0; }
@@ -0,0 +1,6 @@
+#include "h201.h"
+#include "h6619.h"
+#include "h8569.h"
+#include "h2748.h"
+#include "h3830.h"
+int main_1119() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3924.h"
+#include "h1364.h"
+#include "h332.h"
+#include "h5156.h"
+#include "h2904.h"
+int main_112() { return 0; }
@@ -0,0 +1,9 @@
+#include "h969.h"
+#include "h4321.h"
+#include "h5276.h"
+#include "h5238.h"
+#include "h491.h"
+#if 0
+#include "h2191.h"
+#endif
+int main_1120() { return 0; }
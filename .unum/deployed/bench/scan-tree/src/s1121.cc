@@ -0,0 +1,6 @@
+#include "h4160.h"
+#include "h1173.h"
+#include "h6812.h"
+#include "h7252.h"
+#include "h4276.h"
+int main_1121() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4402.h"
+#include "h9791.h"
+#include "h3149.h"
+#include "h7715.h"
+#include "h6282.h"
+int main_1122() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1556.h"
+#include "h7092.h"
+#include "h4850.h"
+#include "h2979.h"
+#include "h3290.h"
+int main_1123() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4952.h"
+#include "h427.h"
+#include "h3268.h"
+#include "h8744.h"
+#include "h9397.h"
+int main_1124() { return 0; }
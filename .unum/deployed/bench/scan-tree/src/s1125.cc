@@ -0,0 +1,9 @@
+#include "h3691.h"
+#include "h5869.h"
+#include "h8241.h"
+#include "h7934.h"
+#include "h85.h"
+#if 0
+#include "h4126.h"
+#endif
+int main_1125() { return 0; }
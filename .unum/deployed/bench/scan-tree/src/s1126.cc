@@ -0,0 +1,6 @@
+#include "h634.h"
+#include "h1536.h"
+#include "h6695.h"
+#include "h3128.h"
+#include "h205.h"
+int main_1126() { return 0; }
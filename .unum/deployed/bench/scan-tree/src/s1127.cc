@@ -0,0 +1,6 @@
+#include "h6258.h"
+#include "h7357.h"
+#include "h1649.h"
+#include "h6262.h"
+#include "h8077.h"
+int main_1127() { return 0; }
@@ -0,0 +1,6 @@
+#include "h947.h"
+#include "h9346.h"
+#include "h8668.h"
+#include "h8279.h"
+#include "h8709.h"
+int main_1128() { return 0; }
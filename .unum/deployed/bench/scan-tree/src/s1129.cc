@@ -0,0 +1,6 @@
+#include "h2723.h"
+#include "h4954.h"
+#include "h8019.h"
+#include "h2387.h"
+#include "h789.h"
+int main_1129() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2752.h"
+#include "h2697.h"
+#include "h9286.h"
+#include "h1542.h"
+#include "h2848.h"
+int main_113() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2093.h"
+#include "h9973.h"
+#include "h8723.h"
+#include "h3978.h"
+#include "h609.h"
+#if 0
+#include "h3794.h"
+#endif
+int main_1130() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3648.h"
+#include "h2628.h"
+#include "h2394.h"
+#include "h542.h"
+#include "h2809.h"
+int main_1131() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3505.h"
+#include "h2955.h"
+#include "h4035.h"
+#include "h5084.h"
+#include "h8005.h"
+int main_1132() { return 0; }
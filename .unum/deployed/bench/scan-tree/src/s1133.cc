@@ -0,0 +1,6 @@
+#include "h1518.h"
+#include "h631.h"
+#include "h7077.h"
+#include "h6225.h"
+#include "h7429.h"
+int main_1133() { return 0; }
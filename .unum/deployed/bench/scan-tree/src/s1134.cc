@@ -0,0 +1,6 @@
+#include "h1783.h"
+#include "h4733.h"
+#include "h435.h"
+#include "h25.h"
+#include "h5803.h"
+int main_1134() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2520.h"
+#include "h2927.h"
+#include "h2992.h"
+#include "h7913.h"
+#include "h5636.h"
+#if 0
+#include "h6784.h"
+#endif
+int main_1135() { return 0; }
@@ -0,0 +1,6 @@
+#include "h971.h"
+#include "h1313.h"
+#include "h1950.h"
+#include "h8846.h"
+#include "h1983.h"
+int main_1136() { return 0; }
@@ -0,0 +1,6 @@
+#include "h56.h"
+#include "h6406.h"
+#include "h7592.h"
+#include "h967.h"
+#include "h6126.h"
+int main_1137() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4196.h"
+#include "h4509.h"
+#include "h7756.h"
+#include "h450.h"
+#include "h8878.h"
+int main_1138() { return 0; }
@@ -0,0 +1,6 @@
+#include "h323.h"
+#include "h9081.h"
+#include "h9109.h"
+#include "h1887.h"
+#include "h8487.h"
+int main_1139() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4965.h"
+#include "h8886.h"
+#include "h7428.h"
+#include "h460.h"
+#include "h5698.h"
+int main_114() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9252.h"
+#include "h8228.h"
+#include "h1235.h"
+#include "h895.h"
+#include "h4637.h"
+#if 0
+#include "h5646.h"
+#endif
+int main_1140() { return 0; }
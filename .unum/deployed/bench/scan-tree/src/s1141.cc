@@ -0,0 +1,6 @@
+#include "h8363.h"
+#include "h9522.h"
+#include "h1553.h"
+#include "h2973.h"
+#include "h3753.h"
+int main_1141() { return 0; }
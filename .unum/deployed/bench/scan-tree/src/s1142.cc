@@ -0,0 +1,6 @@
+#include "h4646.h"
+#include "h2239.h"
+#include "h5461.h"
+#include "h1195.h"
+#include "h5886.h"
+int main_1142() { return 0; }
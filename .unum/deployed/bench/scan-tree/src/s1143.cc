@@ -0,0 +1,6 @@
+#include "h6783.h"
+#include "h6976.h"
+#include "h4131.h"
+#include "h1138.h"
+#include "h8108.h"
+int main_1143() { return 0; }
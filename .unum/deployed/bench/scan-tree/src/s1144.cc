@@ -0,0 +1,6 @@
+#include "h5668.h"
+#include "h1942.h"
+#include "h4238.h"
+#include "h9289.h"
+#include "h1956.h"
+int main_1144() { return 0; }
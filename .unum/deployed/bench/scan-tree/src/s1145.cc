@@ -0,0 +1,9 @@
+#include "h7295.h"
+#include "h9446.h"
+#include "h1383.h"
+#include "h4302.h"
+#include "h5707.h"
+#if 0
+#include "h7514.h"
+#endif
+int main_1145() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3874.h"
+#include "h6513.h"
+#include "h139.h"
+#include "h9561.h"
+#include "h2941.h"
+int main_1146() { return 0; }
@@ -0,0 +1,6 @@
+#include "h763.h"
+#include "h2303.h"
+#include "h5605.h"
+#include "h1869.h"
+#include "h9548.h"
+int main_1147() { return 0; }
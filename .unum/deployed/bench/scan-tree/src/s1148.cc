@@ -0,0 +1,6 @@
+#include "h7477.h"
+#include "h7955.h"
+#include "h2266.h"
+#include "h7554.h"
+#include "h4208.h"
+int main_1148() { return 0; }
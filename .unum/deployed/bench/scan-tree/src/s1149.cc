@@ -0,0 +1,6 @@
+#include "h4820.h"
+#include "h6596.h"
+#include "h1957.h"
+#include "h3015.h"
+#include "h7419.h"
+int main_1149() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1571.h"
+#include "h6569.h"
+#include "h8554.h"
+#include "h703.h"
+#include "h7810.h"
+#if 0
+#include "h5337.h"
+#endif
+int main_115() { return 0; }
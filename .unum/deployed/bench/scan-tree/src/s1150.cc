@@ -0,0 +1,9 @@
+#include "h1139.h"
+#include "h7870.h"
+#include "h4591.h"
+#include "h9831.h"
+#include "h4658.h"
+#if 0
+#include "h3889.h"
+#endif
+int main_1150() { return 0; }
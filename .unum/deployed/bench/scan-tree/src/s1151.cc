@@ -0,0 +1,6 @@
+#include "h3881.h"
+#include "h9464.h"
+#include "h1179.h"
+#include "h3945.h"
+#include "h7322.h"
+int main_1151() { return 0; }
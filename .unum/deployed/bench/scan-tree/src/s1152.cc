@@ -0,0 +1,6 @@
+#include "h5691.h"
+#include "h4453.h"
+#include "h7442.h"
+#include "h7064.h"
+#include "h1840.h"
+int main_1152() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8622.h"
+#include "h1646.h"
+#include "h5151.h"
+#include "h245.h"
+#include "h5024.h"
+int main_1153() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5484.h"
+#include "h3160.h"
+#include "h4240.h"
+#include "h6659.h"
+#include "h1165.h"
+int main_1154() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5040.h"
+#include "h7636.h"
+#include "h4005.h"
+#include "h2719.h"
+#include "h6241.h"
+#if 0
+#include "h4646.h"
+#endif
+int main_1155() { return 0; }
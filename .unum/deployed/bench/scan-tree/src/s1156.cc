@@ -0,0 +1,6 @@
+#include "h5935.h"
+#include "h438.h"
+#include "h9670.h"
+#include "h3847.h"
+#include "h9076.h"
+int main_1156() { return 0; }
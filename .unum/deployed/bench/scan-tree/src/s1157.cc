@@ -0,0 +1,6 @@
+#include "h6528.h"
+#include "h3971.h"
+#include "h7911.h"
+#include "h2668.h"
+#include "h2176.h"
+int main_1157() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6792.h"
+#include "h3791.h"
+#include "h2295.h"
+#include "h3693.h"
+#include "h3411.h"
+int main_1158() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2262.h"
+#include "h7457.h"
+#include "h2706.h"
+#include "h557.h"
+#include "h899.h"
+int main_1159() { return 0; }
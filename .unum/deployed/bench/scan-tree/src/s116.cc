@@ -0,0 +1,6 @@
+#include "h5155.h"
+#include "h8644.h"
+#include "h3618.h"
+#include "h670.h"
+#include "h1451.h"
+int main_116() { return 0; }
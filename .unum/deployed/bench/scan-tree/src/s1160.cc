@@ -0,0 +1,9 @@
+#include "h5406.h"
+#include "h1589.h"
+#include "h2677.h"
+#include "h7676.h"
+#include "h3367.h"
+#if 0
+#include "h5019.h"
+#endif
+int main_1160() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7652.h"
+#include "h8873.h"
+#include "h3519.h"
+#include "h1759.h"
+#include "h1278.h"
+int main_1161() { return 0; }
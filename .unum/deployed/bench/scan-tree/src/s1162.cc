@@ -0,0 +1,6 @@
+#include "h9503.h"
+#include "h3350.h"
+#include "h7302.h"
+#include "h835.h"
+#include "h6780.h"
+int main_1162() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7797.h"
+#include "h6253.h"
+#include "h5198.h"
+#include "h8356.h"
+#include "h347.h"
+int main_1163() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3453.h"
+#include "h2546.h"
+#include "h4780.h"
+#include "h2840.h"
+#include "h8266.h"
+int main_1164() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6931.h"
+#include "h4210.h"
+#include "h2538.h"
+#include "h445.h"
+#include "h5765.h"
+#if 0
+#include "h2925.h"
+#endif
+int main_1165() { return 0; }
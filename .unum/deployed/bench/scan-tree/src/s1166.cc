@@ -0,0 +1,6 @@
+#include "h679.h"
+#include "h3231.h"
+#include "h8734.h"
+#include "h9626.h"
+#include "h5356.h"
+int main_1166() { return 0; }
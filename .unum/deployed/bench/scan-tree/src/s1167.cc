@@ -0,0 +1,6 @@
+#include "h9268.h"
+#include "h3989.h"
+#include "h9491.h"
+#include "h6742.h"
+#include "h4400.h"
+int main_1167() { return 0; }
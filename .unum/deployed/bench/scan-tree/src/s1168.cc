@@ -0,0 +1,6 @@
+#include "h9164.h"
+#include "h4344.h"
+#include "h8553.h"
+#include "h9009.h"
+#include "h7063.h"
+int main_1168() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3305.h"
+#include "h2870.h"
+#include "h7727.h"
+#include "h2975.h"
+#include "h7327.h"
+int main_1169() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3782.h"
+#include "h5098.h"
+#include "h8671.h"
+#include "h1083.h"
+#include "h1685.h"
+int main_117() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1742.h"
+#include "h3992.h"
+#include "h1314.h"
+#include "h2535.h"
+#include "h9218.h"
+#if 0
+#include "h5776.h"
+#endif
+int main_1170() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3242.h"
+#include "h5881.h"
+#include "h5210.h"
+#include "h7358.h"
+#include "h4716.h"
+int main_1171() { return 0; }
@@ -0,0 +1,6 @@
+#include "h123.h"
+#include "h7336.h"
+#include "h4464.h"
+#include "h7130.h"
+#include "h766.h"
+int main_1172() { return 0; }
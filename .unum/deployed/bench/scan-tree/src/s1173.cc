@@ -0,0 +1,6 @@
+#include "h5009.h"
+#include "h8840.h"
+#include "h8134.h"
+#include "h1006.h"
+#include "h8793.h"
+int main_1173() { return 0; }
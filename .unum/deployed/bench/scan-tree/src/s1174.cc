@@ -0,0 +1,6 @@
+#include "h1517.h"
+#include "h8087.h"
+#include "h726.h"
+#include "h9875.h"
+#include "h8048.h"
+int main_1174() { return 0; }
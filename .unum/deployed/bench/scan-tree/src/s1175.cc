@@ -0,0 +1,9 @@
+#include "h2727.h"
+#include "h2092.h"
+#include "h9174.h"
+#include "h815.h"
+#include "h2355.h"
+#if 0
+#include "h7905.h"
+#endif
+int main_1175() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7899.h"
+#include "h9220.h"
+#include "h4695.h"
+#include "h4767.h"
+#include "h1557.h"
+int main_1176() { return 0; }
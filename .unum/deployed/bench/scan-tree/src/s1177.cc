@@ -0,0 +1,6 @@
+#include "h7567.h"
+#include "h7432.h"
+#include "h8321.h"
+#include "h3193.h"
+#include "h4521.h"
+int main_1177() { return 0; }
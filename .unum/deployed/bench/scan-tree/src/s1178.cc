@@ -0,0 +1,6 @@
+#include "h8613.h"
+#include "h7203.h"
+#include "h936.h"
+#include "h6504.h"
+#include "h7953.h"
+int main_1178() { return 0; }
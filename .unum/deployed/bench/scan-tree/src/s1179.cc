@@ -0,0 +1,6 @@
+#include "h6396.h"
+#include "h1601.h"
+#include "h578.h"
+#include "h4519.h"
+#include "h5260.h"
+int main_1179() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6177.h"
+#include "h4859.h"
+#include "h8568.h"
+#include "h1521.h"
+#include "h7484.h"
+int main_118() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6734.h"
+#include "h8200.h"
+#include "h944.h"
+#include "h3580.h"
+#include "h4936.h"
+#if 0
+#include "h6945.h"
+#endif
+int main_1180() { return 0; }
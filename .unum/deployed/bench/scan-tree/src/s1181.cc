@@ -0,0 +1,6 @@
+#include "h1203.h"
+#include "h1442.h"
+#include "h4305.h"
+#include "h4694.h"
+#include "h8845.h"
+int main_1181() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7713.h"
+#include "h9226.h"
+#include "h8186.h"
+#include "h5695.h"
+#include "h3485.h"
+int main_1182() { return 0; }
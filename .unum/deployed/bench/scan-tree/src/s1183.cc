@@ -0,0 +1,6 @@
+#include "h5775.h"
+#include "h5488.h"
+#include "h6729.h"
+#include "h3860.h"
+#include "h2813.h"
+int main_1183() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5092.h"
+#include "h7628.h"
+#include "h4666.h"
+#include "h6736.h"
+#include "h8141.h"
+int main_1184() { return 0; }
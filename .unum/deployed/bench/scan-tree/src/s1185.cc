@@ -0,0 +1,9 @@
+#include "h7297.h"
+#include "h5649.h"
+#include "h5679.h"
+#include "h6913.h"
+#include "h2808.h"
+#if 0
+#include "h8609.h"
+#endif
+int main_1185() { return 0; }
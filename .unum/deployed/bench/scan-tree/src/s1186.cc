@@ -0,0 +1,6 @@
+#include "h1380.h"
+#include "h7774.h"
+#include "h6055.h"
+#include "h9226.h"
+#include "h1161.h"
+int main_1186() { return 0; }
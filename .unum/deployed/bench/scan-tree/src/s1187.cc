@@ -0,0 +1,6 @@
+#include "h6308.h"
+#include "h1632.h"
+#include "h9611.h"
+#include "h626.h"
+#include "h1963.h"
+int main_1187() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6938.h"
+#include "h4342.h"
+#include "h5033.h"
+#include "h3928.h"
+#include "h6669.h"
+int main_1188() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4286.h"
+#include "h9828.h"
+#include "h6721.h"
+#include "h1755.h"
+#include "h2073.h"
+int main_1189() { return 0; }
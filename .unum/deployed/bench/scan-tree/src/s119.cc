@@ -0,0 +1,6 @@
+#include "h6222.h"
+#include "h3234.h"
+#include "h457.h"
+#include "h759.h"
+#include "h2768.h"
+int main_119() { return 0; }
@@ -0,0 +1,9 @@
+#include "h867.h"
+#include "h6295.h"
+#include "h2540.h"
+#include "h7117.h"
+#include "h6390.h"
+#if 0
+#include "h9226.h"
+#endif
+int main_1190() { return 0; }
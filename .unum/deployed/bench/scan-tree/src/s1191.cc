@@ -0,0 +1,6 @@
+#include "h2251.h"
+#include "h4356.h"
+#include "h9964.h"
+#include "h7161.h"
+#include "h488.h"
+int main_1191() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8305.h"
+#include "h3674.h"
+#include "h4918.h"
+#include "h8340.h"
+#include "h6984.h"
+int main_1192() { return 0; }
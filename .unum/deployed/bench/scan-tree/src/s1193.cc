@@ -0,0 +1,6 @@
+#include "h6609.h"
+#include "h1605.h"
+#include "h8593.h"
+#include "h4850.h"
+#include "h6659.h"
+int main_1193() { return 0; }
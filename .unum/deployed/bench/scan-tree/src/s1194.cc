@@ -0,0 +1,6 @@
+#include "h5041.h"
+#include "h9633.h"
+#include "h8429.h"
+#include "h4952.h"
+#include "h5100.h"
+int main_1194() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9222.h"
+#include "h2050.h"
+#include "h1624.h"
+#include "h3873.h"
+#include "h1784.h"
+#if 0
+#include "h8214.h"
+#endif
+int main_1195() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5051.h"
+#include "h7877.h"
+#include "h4174.h"
+#include "h7972.h"
+#include "h8959.h"
+int main_1196() { return 0; }
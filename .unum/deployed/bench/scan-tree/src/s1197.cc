@@ -0,0 +1,6 @@
+#include "h6411.h"
+#include "h4875.h"
+#include "h8496.h"
+#include "h7494.h"
+#include "h460.h"
+int main_1197() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9542.h"
+#include "h5950.h"
+#include "h8422.h"
+#include "h6692.h"
+#include "h30.h"
+int main_1198() { return 0; }
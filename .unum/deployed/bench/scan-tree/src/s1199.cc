@@ -0,0 +1,6 @@
+#include "h569.h"
+#include "h8779.h"
+#include "h9869.h"
+#include "h175.h"
+#include "h9582.h"
+int main_1199() { return 0; }
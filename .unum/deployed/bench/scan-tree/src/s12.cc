@@ -0,0 +1,6 @@
+#include "h964.h"
+#include "h3186.h"
+#include "h4514.h"
+#include "h6112.h"
+#include "h5057.h"
+int main_12() { return 0; }
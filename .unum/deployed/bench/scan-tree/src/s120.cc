@@ -0,0 +1,9 @@
+#include "h7671.h"
+#include "h7757.h"
+#include "h4131.h"
+#include "h70.h"
+#include "h5671.h"
+#if 0
+#include "h1928.h"
+#endif
+int main_120() { return 0; }
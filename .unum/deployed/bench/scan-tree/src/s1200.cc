@@ -0,0 +1,9 @@
+#include "h157.h"
+#include "h5728.h"
+#include "h2693.h"
+#include "h4578.h"
+#include "h6991.h"
+#if 0
+#include "h6533.h"
+#endif
+int main_1200() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9654.h"
+#include "h8537.h"
+#include "h9832.h"
+#include "h4912.h"
+#include "h546.h"
+int main_1201() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3270.h"
+#include "h9742.h"
+#include "h1049.h"
+#include "h875.h"
+#include "h4680.h"
+int main_1202() { return 0; }
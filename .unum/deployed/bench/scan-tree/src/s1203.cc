@@ -0,0 +1,6 @@
+#include "h4116.h"
+#include "h7499.h"
+#include "h8911.h"
+#include "h5811.h"
+#include "h1162.h"
+int main_1203() { return 0; }
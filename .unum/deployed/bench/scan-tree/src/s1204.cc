@@ -0,0 +1,6 @@
+#include "h5881.h"
+#include "h7620.h"
+#include "h673.h"
+#include "h991.h"
+#include "h1790.h"
+int main_1204() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7976.h"
+#include "h1391.h"
+#include "h4047.h"
+#include "h5163.h"
+#include "h5156.h"
+#if 0
+#include "h3754.h"
+#endif
+int main_1205() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6239.h"
+#include "h5816.h"
+#include "h4449.h"
+#include "h5550.h"
+#include "h4858.h"
+int main_1206() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8459.h"
+#include "h3581.h"
+#include "h4318.h"
+#include "h6915.h"
+#include "h2247.h"
+int main_1207() { return 0; }
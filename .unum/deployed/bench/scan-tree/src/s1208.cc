@@ -0,0 +1,6 @@
+#include "h8021.h"
+#include "h5407.h"
+#include "h5561.h"
+#include "h3254.h"
+#include "h186.h"
+int main_1208() { return 0; }
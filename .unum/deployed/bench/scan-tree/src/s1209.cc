@@ -0,0 +1,6 @@
+#include "h1880.h"
+#include "h237.h"
+#include "h1983.h"
+#include "h2930.h"
+#include "h7866.h"
+int main_1209() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1671.h"
+#include "h5884.h"
+#include "h1087.h"
+#include "h7806.h"
+#include "h4794.h"
+int main_121() { return 0; }
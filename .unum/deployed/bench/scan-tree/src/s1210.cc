@@ -0,0 +1,9 @@
+#include "h834.h"
+#include "h6137.h"
+#include "h1172.h"
+#include "h5549.h"
+#include "h9129.h"
+#if 0
+#include "h6541.h"
+#endif
+int main_1210() { return 0; }
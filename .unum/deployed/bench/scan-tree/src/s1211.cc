@@ -0,0 +1,6 @@
+#include "h613.h"
+#include "h1807.h"
+#include "h9140.h"
+#include "h6868.h"
+#include "h6241.h"
+int main_1211() { return 0; }
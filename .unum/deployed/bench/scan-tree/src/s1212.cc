@@ -0,0 +1,6 @@
+#include "h938.h"
+#include "h4981.h"
+#include "h1128.h"
+#include "h5505.h"
+#include "h2434.h"
+int main_1212() { return 0; }
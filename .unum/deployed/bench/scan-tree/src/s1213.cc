@@ -0,0 +1,6 @@
+#include "h7136.h"
+#include "h6095.h"
+#include "h7861.h"
+#include "h8599.h"
+#include "h5299.h"
+int main_1213() { return 0; }
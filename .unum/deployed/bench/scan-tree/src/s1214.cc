@@ -0,0 +1,6 @@
+#include "h9418.h"
+#include "h7511.h"
+#include "h1444.h"
+#include "h9777.h"
+#include "h2212.h"
+int main_1214() { return 0; }
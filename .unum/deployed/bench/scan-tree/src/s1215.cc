@@ -0,0 +1,9 @@
+#include "h1638.h"
+#include "h1021.h"
+#include "h2823.h"
+#include "h4950.h"
+#include "h5924.h"
+#if 0
+#include "h7326.h"
+#endif
+int main_1215() { return 0; }
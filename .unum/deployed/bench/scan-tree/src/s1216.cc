@@ -0,0 +1,6 @@
+#include "h762.h"
+#include "h3597.h"
+#include "h3934.h"
+#include "h5095.h"
+#include "h5351.h"
+int main_1216() { return 0; }
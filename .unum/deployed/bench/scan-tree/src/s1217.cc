@@ -0,0 +1,6 @@
+#include "h9131.h"
+#include "h2279.h"
+#include "h2504.h"
+#include "h596.h"
+#include "h1649.h"
+int main_1217() { return 0; }
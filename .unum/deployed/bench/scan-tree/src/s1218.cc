@@ -0,0 +1,6 @@
+#include "h5162.h"
+#include "h5789.h"
+#include "h2852.h"
+#include "h1455.h"
+#include "h8621.h"
+int main_1218() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6233.h"
+#include "h1006.h"
+#include "h39.h"
+#include "h107.h"
+#include "h9565.h"
+int main_1219() { return 0; }
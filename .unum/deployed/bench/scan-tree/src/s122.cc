@@ -0,0 +1,6 @@
+#include "h8980.h"
+#include "h2295.h"
+#include "h9211.h"
+#include "h4621.h"
+#include "h8369.h"
+int main_122() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8356.h"
+#include "h8658.h"
+#include "h2462.h"
+#include "h3709.h"
+#include "h9062.h"
+#if 0
+#include "h5385.h"
+#endif
+int main_1220() { return 0; }
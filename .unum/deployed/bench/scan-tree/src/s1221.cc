@@ -0,0 +1,6 @@
+#include "h9370.h"
+#include "h2415.h"
+#include "h3059.h"
+#include "h1504.h"
+#include "h5748.h"
+int main_1221() { return 0; }
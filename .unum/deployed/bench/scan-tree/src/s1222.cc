@@ -0,0 +1,6 @@
+#include "h5057.h"
+#include "h191.h"
+#include "h8568.h"
+#include "h4669.h"
+#include "h6054.h"
+int main_1222() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4349.h"
+#include "h9211.h"
+#include "h1616.h"
+#include "h3401.h"
+#include "h9287.h"
+int main_1223() { return 0; }
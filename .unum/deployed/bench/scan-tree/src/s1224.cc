@@ -0,0 +1,6 @@
+#include "h3238.h"
+#include "h1086.h"
+#include "h4855.h"
+#include "h6961.h"
+#include "h2375.h"
+int main_1224() { return 0; }
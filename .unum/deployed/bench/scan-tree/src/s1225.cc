@@ -0,0 +1,9 @@
+#include "h4477.h"
+#include "h2223.h"
+#include "h9357.h"
+#include "h1739.h"
+#include "h7851.h"
+#if 0
+#include "h2209.h"
+#endif
+int main_1225() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1330.h"
+#include "h9275.h"
+#include "h4150.h"
+#include "h7517.h"
+#include "h81.h"
+int main_1226() { return 0; }
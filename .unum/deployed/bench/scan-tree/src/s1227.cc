@@ -0,0 +1,6 @@
+#include "h8794.h"
+#include "h2391.h"
+#include "h844.h"
+#include "h4950.h"
+#include "h9221.h"
+int main_1227() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5928.h"
+#include "h29.h"
+#include "h6737.h"
+#include "h47.h"
+#include "h7058.h"
+int main_1228() { return 0; }
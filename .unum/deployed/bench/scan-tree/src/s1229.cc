@@ -0,0 +1,6 @@
+#include "h3245.h"
+#include "h4976.h"
+#include "h6429.h"
+#include "h2709.h"
+#include "h8836.h"
+int main_1229() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1444.h"
+#include "h1371.h"
+#include "h946.h"
+#include "h2496.h"
+#include "h2846.h"
+int main_123() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8939.h"
+#include "h295.h"
+#include "h9631.h"
+#include "h3793.h"
+#include "h9433.h"
+#if 0
+#include "h386.h"
+#endif
+int main_1230() { return 0; }
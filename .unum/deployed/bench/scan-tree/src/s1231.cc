@@ -0,0 +1,6 @@
+#include "h2215.h"
+#include "h7890.h"
+#include "h1838.h"
+#include "h9364.h"
+#include "h4086.h"
+int main_1231() { return 0; }
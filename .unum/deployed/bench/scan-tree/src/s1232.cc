@@ -0,0 +1,6 @@
+#include "h305.h"
+#include "h620.h"
+#include "h3090.h"
+#include "h7490.h"
+#include "h1441.h"
+int main_1232() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3525.h"
+#include "h7589.h"
+#include "h3438.h"
+#include "h7019.h"
+#include "h9244.h"
+int main_1233() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7431.h"
+#include "h22.h"
+#include "h4539.h"
+#include "h9824.h"
+#include "h6580.h"
+int main_1234() { return 0; }
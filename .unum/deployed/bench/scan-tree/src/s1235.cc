@@ -0,0 +1,9 @@
+#include "h7572.h"
+#include "h7917.h"
+#include "h8456.h"
+#include "h8357.h"
+#include "h2942.h"
+#if 0
+#include "h7457.h"
+#endif
+int main_1235() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2542.h"
+#include "h1903.h"
+#include "h2716.h"
+#include "h8496.h"
+#include "h7184.h"
+int main_1236() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7243.h"
+#include "h1860.h"
+#include "h2076.h"
+#include "h8783.h"
+#include "h3669.h"
+int main_1237() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5244.h"
+#include "h2826.h"
+#include "h7441.h"
+#include "h7215.h"
+#include "h6747.h"
+int main_1238() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6651.h"
+#include "h1810.h"
+#include "h3395.h"
+#include "h2250.h"
+#include "h3520.h"
+int main_1239() { return 0; }
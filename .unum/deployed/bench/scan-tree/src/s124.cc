@@ -0,0 +1,6 @@
+#include "h5275.h"
+#include "h6473.h"
+#include "h5349.h"
+#include "h9387.h"
+#include "h8497.h"
+int main_124() { return 0; }
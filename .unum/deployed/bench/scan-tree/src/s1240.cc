@@ -0,0 +1,9 @@
+#include "h4184.h"
+#include "h8711.h"
+#include "h5662.h"
+#include "h6587.h"
+#include "h2020.h"
+#if 0
+#include "h2884.h"
+#endif
+int main_1240() { return 0; }
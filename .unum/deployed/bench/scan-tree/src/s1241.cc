@@ -0,0 +1,6 @@
+#include "h5284.h"
+#include "h8971.h"
+#include "h6174.h"
+#include "h6156.h"
+#include "h8866.h"
+int main_1241() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5321.h"
+#include "h7668.h"
+#include "h270.h"
+#include "h2825.h"
+#include "h554.h"
+int main_1242() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8320.h"
+#include "h8539.h"
+#include "h8765.h"
+#include "h6709.h"
+#include "h1085.h"
+int main_1243() { return 0; }
@@ -0,0 +1,6 @@
+#include "h732.h"
+#include "h7445.h"
+#include "h5585.h"
+#include "h24.h"
+#include "h9238.h"
+int main_1244() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1380.h"
+#include "h4119.h"
+#include "h1940.h"
+#include "h253.h"
+#include "h9464.h"
+#if 0
+#include "h3798.h"
+#endif
+int main_1245() { return 0; }
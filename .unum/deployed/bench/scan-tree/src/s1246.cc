@@ -0,0 +1,6 @@
+#include "h3396.h"
+#include "h7150.h"
+#include "h7123.h"
+#include "h5410.h"
+#include "h8920.h"
+int main_1246() { return 0; }
@@ -0,0 +1,6 @@
+#include "h324.h"
+#include "h3447.h"
+#include "h7780.h"
+#include "h2306.h"
+#include "h8763.h"
+int main_1247() { return 0; }
@@ -0,0 +1,6 @@
+#include "h469.h"
+#include "h165.h"
+#include "h5832.h"
+#include "h5978.h"
+#include "h7915.h"
+int main_1248() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6334.h"
+#include "h1404.h"
+#include "h8749.h"
+#include "h6768.h"
+#include "h3322.h"
+int main_1249() { return 0; }
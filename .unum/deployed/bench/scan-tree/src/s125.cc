@@ -0,0 +1,9 @@
+#include "h2068.h"
+#include "h2024.h"
+#include "h7200.h"
+#include "h2065.h"
+#include "h3159.h"
+#if 0
+#include "h5956.h"
+#endif
+int main_125() { return 0; }
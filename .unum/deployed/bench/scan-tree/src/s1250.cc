@@ -0,0 +1,9 @@
+#include "h1054.h"
+#include "h764.h"
+#include "h7467.h"
+#include "h1399.h"
+#include "h921.h"
+#if 0
+#include "h4176.h"
+#endif
+int main_1250() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6439.h"
+#include "h922.h"
+#include "h2214.h"
+#include "h6034.h"
+#include "h1249.h"
+int main_1251() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8398.h"
+#include "h8436.h"
+#include "h2893.h"
+#include "h1697.h"
+#include "h120.h"
+int main_1252() { return 0; }
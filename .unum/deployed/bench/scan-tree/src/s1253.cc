@@ -0,0 +1,6 @@
+#include "h8893.h"
+#include "h6494.h"
+#include "h528.h"
+#include "h7381.h"
+#include "h9577.h"
+int main_1253() { return 0; }
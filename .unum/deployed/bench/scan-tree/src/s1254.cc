@@ -0,0 +1,6 @@
+#include "h936.h"
+#include "h631.h"
+#include "h7111.h"
+#include "h921.h"
+#include "h8903.h"
+int main_1254() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5693.h"
+#include "h4818.h"
+#include "h7009.h"
+#include "h9450.h"
+#include "h9883.h"
+#if 0
+#include "h8829.h"
+#endif
+int main_1255() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1018.h"
+#include "h4989.h"
+#include "h3568.h"
+#include "h5868.h"
+#include "h724.h"
+int main_1256() { return 0; }
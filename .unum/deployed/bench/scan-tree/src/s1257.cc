@@ -0,0 +1,6 @@
+#include "h8092.h"
+#include "h376.h"
+#include "h1742.h"
+#include "h931.h"
+#include "h9419.h"
+int main_1257() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6080.h"
+#include "h9688.h"
+#include "h9831.h"
+#include "h8645.h"
+#include "h3611.h"
+int main_1258() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6164.h"
+#include "h7869.h"
+#include "h1005.h"
+#include "h6200.h"
+#include "h9164.h"
+int main_1259() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3015.h"
+#include "h4044.h"
+#include "h728.h"
+#include "h2127.h"
+#include "h5231.h"
+int main_126() { return 0; }
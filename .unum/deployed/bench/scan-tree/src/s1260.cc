@@ -0,0 +1,9 @@
+#include "h332.h"
+#include "h3364.h"
+#include "h855.h"
+#include "h2732.h"
+#include "h1133.h"
+#if 0
+#include "h325.h"
+#endif
+int main_1260() { return 0; }
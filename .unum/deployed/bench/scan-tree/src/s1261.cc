@@ -0,0 +1,6 @@
+#include "h9818.h"
+#include "h1583.h"
+#include "h1510.h"
+#include "h3747.h"
+#include "h247.h"
+int main_1261() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3890.h"
+#include "h6408.h"
+#include "h8789.h"
+#include "h4459.h"
+#include "h5029.h"
+int main_1262() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4191.h"
+#include "h663.h"
+#include "h122.h"
+#include "h2755.h"
+#include "h9810.h"
+int main_1263() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2304.h"
+#include "h5296.h"
+#include "h7572.h"
+#include "h9781.h"
+#include "h2795.h"
+int main_1264() { return 0; }
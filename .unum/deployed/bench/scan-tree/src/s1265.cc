@@ -0,0 +1,9 @@
+#include "h8689.h"
+#include "h6759.h"
+#include "h9401.h"
+#include "h8748.h"
+#include "h7545.h"
+#if 0
+#include "h7375.h"
+#endif
+int main_1265() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4607.h"
+#include "h6982.h"
+#include "h5767.h"
+#include "h9412.h"
+#include "h2599.h"
+int main_1266() { return 0; }
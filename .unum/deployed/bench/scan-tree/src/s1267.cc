@@ -0,0 +1,6 @@
+#include "h4209.h"
+#include "h2792.h"
+#include "h4114.h"
+#include "h4719.h"
+#include "h2815.h"
+int main_1267() { return 0; }
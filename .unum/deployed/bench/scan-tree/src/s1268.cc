@@ -0,0 +1,6 @@
+#include "h9165.h"
+#include "h4302.h"
+#include "h8000.h"
+#include "h1690.h"
+#include "h1981.h"
+int main_1268() { return 0; }
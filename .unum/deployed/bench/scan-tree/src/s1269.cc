@@ -0,0 +1,6 @@
+#include "h5268.h"
+#include "h9719.h"
+#include "h6510.h"
+#include "h1911.h"
+#include "h2404.h"
+int main_1269() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8085.h"
+#include "h4138.h"
+#include "h314.h"
+#include "h4364.h"
+#include "h1493.h"
+int main_127() { return 0; }
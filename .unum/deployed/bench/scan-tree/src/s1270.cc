@@ -0,0 +1,9 @@
+#include "h5135.h"
+#include "h7024.h"
+#include "h5985.h"
+#include "h5758.h"
+#include "h9508.h"
+#if 0
+#include "h9517.h"
+#endif
+int main_1270() { return 0; }
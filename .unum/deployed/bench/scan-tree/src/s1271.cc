@@ -0,0 +1,6 @@
+#include "h9128.h"
+#include "h4720.h"
+#include "h5050.h"
+#include "h8176.h"
+#include "h6597.h"
+int main_1271() { return 0; }
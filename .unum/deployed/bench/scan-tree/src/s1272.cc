@@ -0,0 +1,6 @@
+#include "h5953.h"
+#include "h4091.h"
+#include "h6491.h"
+#include "h7234.h"
+#include "h6517.h"
+int main_1272() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1277.h"
+#include "h2430.h"
+#include "h7729.h"
+#include "h3281.h"
+#include "h1050.h"
+int main_1273() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5514.h"
+#include "h8576.h"
+#include "h2125.h"
+#include "h1739.h"
+#include "h2121.h"
+int main_1274() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1343.h"
+#include "h3239.h"
+#include "h4405.h"
+#include "h2714.h"
+#include "h2969.h"
+#if 0
+#include "h1807.h"
+#endif
+int main_1275() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1414.h"
+#include "h6432.h"
+#include "h4834.h"
+#include "h9050.h"
+#include "h7413.h"
+int main_1276() { return 0; }
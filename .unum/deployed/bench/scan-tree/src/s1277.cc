@@ -0,0 +1,6 @@
+#include "h2086.h"
+#include "h8532.h"
+#include "h8943.h"
+#include "h1510.h"
+#include "h5736.h"
+int main_1277() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6429.h"
+#include "h440.h"
+#include "h9955.h"
+#include "h9265.h"
+#include "h9822.h"
+int main_1278() { return 0; }
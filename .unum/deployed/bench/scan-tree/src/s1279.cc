@@ -0,0 +1,6 @@
+#include "h8656.h"
+#include "h3349.h"
+#include "h2689.h"
+#include "h3639.h"
+#include "h2420.h"
+int main_1279() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9666.h"
+#include "h5376.h"
+#include "h2431.h"
+#include "h1544.h"
+#include "h2153.h"
+int main_128() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6182.h"
+#include "h1488.h"
+#include "h1786.h"
+#include "h1544.h"
+#include "h5396.h"
+#if 0
+#include "h6554.h"
+#endif
+int main_1280() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2948.h"
+#include "h3761.h"
+#include "h5064.h"
+#include "h6904.h"
+#include "h695.h"
+int main_1281() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7990.h"
+#include "h54.h"
+#include "h5609.h"
+#include "h6571.h"
+#include "h545.h"
+int main_1282() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9978.h"
+#include "h8856.h"
+#include "h2516.h"
+#include "h1611.h"
+#include "h1309.h"
+int main_1283() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4633.h"
+#include "h9104.h"
+#include "h7982.h"
+#include "h934.h"
+#include "h6772.h"
+int main_1284() { return 0; }
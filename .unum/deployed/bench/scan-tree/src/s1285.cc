@@ -0,0 +1,9 @@
+#include "h7420.h"
+#include "h8710.h"
+#include "h5757.h"
+#include "h7155.h"
+#include "h5334.h"
+#if 0
+#include "h6213.h"
+#endif
+int main_1285() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4365.h"
+#include "h4139.h"
+#include "h1487.h"
+#include "h1356.h"
+#include "h6685.h"
+int main_1286() { return 0; }
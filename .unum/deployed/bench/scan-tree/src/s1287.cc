@@ -0,0 +1,6 @@
+#include "h2006.h"
+#include "h5162.h"
+#include "h1490.h"
+#include "h4316.h"
+#include "h6815.h"
+int main_1287() { return 0; }
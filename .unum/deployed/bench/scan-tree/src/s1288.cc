@@ -0,0 +1,6 @@
+#include "h121.h"
+#include "h6424.h"
+#include "h2723.h"
+#include "h527.h"
+#include "h8340.h"
+int main_1288() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4689.h"
+#include "h9920.h"
+#include "h6361.h"
+#include "h1751.h"
+#include "h9338.h"
+int main_1289() { return 0; }
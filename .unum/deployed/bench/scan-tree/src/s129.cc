@@ -0,0 +1,6 @@
+#include "h4819.h"
+#include "h18.h"
+#include "h1214.h"
+#include "h3384.h"
+#include "h2381.h"
+int main_129() { return 0; }
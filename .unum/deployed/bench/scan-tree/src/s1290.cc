@@ -0,0 +1,9 @@
+#include "h5161.h"
+#include "h8587.h"
+#include "h9151.h"
+#include "h2429.h"
+#include "h9598.h"
+#if 0
+#include "h8684.h"
+#endif
+int main_1290() { return 0; }
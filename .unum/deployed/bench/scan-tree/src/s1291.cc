@@ -0,0 +1,6 @@
+#include "h949.h"
+#include "h9040.h"
+#include "h5409.h"
+#include "h9608.h"
+#include "h1298.h"
+int main_1291() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5478.h"
+#include "h5675.h"
+#include "h224.h"
+#include "h7754.h"
+#include "h1545.h"
+int main_1292() { return 0; }
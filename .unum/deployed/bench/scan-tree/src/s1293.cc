@@ -0,0 +1,6 @@
+#include "h5400.h"
+#include "h2617.h"
+#include "h6124.h"
+#include "h1811.h"
+#include "h6600.h"
+int main_1293() { return 0; }
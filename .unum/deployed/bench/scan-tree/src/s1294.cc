@@ -0,0 +1,6 @@
+#include "h3155.h"
+#include "h6021.h"
+#include "h8226.h"
+#include "h4004.h"
+#include "h2840.h"
+int main_1294() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9601.h"
+#include "h515.h"
+#include "h9288.h"
+#include "h5886.h"
+#include "h2309.h"
+#if 0
+#include "h3358.h"
+#endif
+int main_1295() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2549.h"
+#include "h8660.h"
+#include "h2472.h"
+#include "h5277.h"
+#include "h9950.h"
+int main_1296() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3705.h"
+#include "h7028.h"
+#include "h2333.h"
+#include "h9946.h"
+#include "h9235.h"
+int main_1297() { return 0; }
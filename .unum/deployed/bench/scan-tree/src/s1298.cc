@@ -0,0 +1,6 @@
+#include "h426.h"
+#include "h3627.h"
+#include "h380.h"
+#include "h523.h"
+#include "h6581.h"
+int main_1298() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5709.h"
+#include "h5200.h"
+#include "h1486.h"
+#include "h3152.h"
+#include "h996.h"
+int main_1299() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3099.h"
+#include "h5438.h"
+#include "h6588.h"
+#include "h9361.h"
+#include "h6587.h"
+int main_13() { return 0; }
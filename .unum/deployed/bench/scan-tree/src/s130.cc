@@ -0,0 +1,9 @@
+#include "h5773.h"
+#include "h3055.h"
+#include "h6053.h"
+#include "h1683.h"
+#include "h7520.h"
+#if 0
+#include "h8520.h"
+#endif
+int main_130() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7984.h"
+#include "h7931.h"
+#include "h6883.h"
+#include "h6054.h"
+#include "h5128.h"
+#if 0
+#include "h6048.h"
+#endif
+int main_1300() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5064.h"
+#include "h3892.h"
+#include "h2738.h"
+#include "h1934.h"
+#include "h6043.h"
+int main_1301() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6053.h"
+#include "h7847.h"
+#include "h4233.h"
+#include "h9132.h"
+#include "h956.h"
+int main_1302() { return 0; }
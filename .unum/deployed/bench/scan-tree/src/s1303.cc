@@ -0,0 +1,6 @@
+#include "h8428.h"
+#include "h7568.h"
+#include "h1949.h"
+#include "h1297.h"
+#include "h9215.h"
+int main_1303() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1994.h"
+#include "h3547.h"
+#include "h3702.h"
+#include "h3325.h"
+#include "h4477.h"
+int main_1304() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5394.h"
+#include "h7687.h"
+#include "h6518.h"
+#include "h7097.h"
+#include "h669.h"
+#if 0
+#include "h8060.h"
+#endif
+int main_1305() { return 0; }
@@ -0,0 +1,6 @@
+#include "h838.h"
+#include "h6119.h"
+#include "h5276.h"
+#include "h8754.h"
+#include "h164.h"
+int main_1306() { return 0; }
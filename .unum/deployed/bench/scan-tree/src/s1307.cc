@@ -0,0 +1,6 @@
+#include "h8747.h"
+#include "h43.h"
+#include "h9281.h"
+#include "h2593.h"
+#include "h6679.h"
+int main_1307() { return 0; }
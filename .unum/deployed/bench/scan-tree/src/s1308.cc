@@ -0,0 +1,6 @@
+#include "h1795.h"
+#include "h4373.h"
+#include "h3654.h"
+#include "h4263.h"
+#include "h2927.h"
+int main_1308() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1123.h"
+#include "h6710.h"
+#include "h4361.h"
+#include "h9062.h"
+#include "h6960.h"
+int main_1309() { return 0; }
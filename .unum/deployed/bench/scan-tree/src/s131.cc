@@ -0,0 +1,6 @@
+#include "h5056.h"
+#include "h1382.h"
+#include "h8433.h"
+#include "h34.h"
+#include "h6093.h"
+int main_131() { return 0; }
@@ -0,0 +1,9 @@
+#include "h328.h"
+#include "h6669.h"
+#include "h5740.h"
+#include "h7287.h"
+#include "h7597.h"
+#if 0
+#include "h6216.h"
+#endif
+int main_1310() { return 0; }
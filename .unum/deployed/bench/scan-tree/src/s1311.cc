@@ -0,0 +1,6 @@
+#include "h8595.h"
+#include "h8138.h"
+#include "h4162.h"
+#include "h2904.h"
+#include "h6596.h"
+int main_1311() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8720.h"
+#include "h9612.h"
+#include "h2097.h"
+#include "h4672.h"
+#include "h3810.h"
+int main_1312() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3077.h"
+#include "h8736.h"
+#include "h9971.h"
+#include "h9255.h"
+#include "h3626.h"
+int main_1313() { return 0; }
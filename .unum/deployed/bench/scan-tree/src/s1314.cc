@@ -0,0 +1,6 @@
+#include "h6275.h"
+#include "h7034.h"
+#include "h3699.h"
+#include "h2185.h"
+#include "h3219.h"
+int main_1314() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1705.h"
+#include "h6236.h"
+#include "h7903.h"
+#include "h9388.h"
+#include "h4802.h"
+#if 0
+#include "h4409.h"
+#endif
+int main_1315() { return 0; }
@@ -0,0 +1,6 @@
+#include "h348.h"
+#include "h4075.h"
+#include "h1540.h"
+#include "h2485.h"
+#include "h6626.h"
+int main_1316() { return 0; }
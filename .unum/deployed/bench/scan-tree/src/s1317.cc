@@ -0,0 +1,6 @@
+#include "h5421.h"
+#include "h949.h"
+#include "h1478.h"
+#include "h7526.h"
+#include "h1486.h"
+int main_1317() { return 0; }
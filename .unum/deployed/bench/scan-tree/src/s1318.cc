@@ -0,0 +1,6 @@
+#include "h781.h"
+#include "h3431.h"
+#include "h7361.h"
+#include "h2841.h"
+#include "h5213.h"
+int main_1318() { return 0; }
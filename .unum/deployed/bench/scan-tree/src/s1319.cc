@@ -0,0 +1,6 @@
+#include "h2292.h"
+#include "h7410.h"
+#include "h8246.h"
+#include "h8710.h"
+#include "h8528.h"
+int main_1319() { return 0; }
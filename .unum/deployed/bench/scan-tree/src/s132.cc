@@ -0,0 +1,6 @@
+#include "h3034.h"
+#include "h583.h"
+#include "h6187.h"
+#include "h6475.h"
+#include "h6492.h"
+int main_132() { return 0; }
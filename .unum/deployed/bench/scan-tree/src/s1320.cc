@@ -0,0 +1,9 @@
+#include "h1255.h"
+#include "h2943.h"
+#include "h9198.h"
+#include "h7758.h"
+#include "h3656.h"
+#if 0
+#include "h8277.h"
+#endif
+int main_1320() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8051.h"
+#include "h8709.h"
+#include "h679.h"
+#include "h4748.h"
+#include "h6886.h"
+int main_1321() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6699.h"
+#include "h9219.h"
+#include "h7571.h"
+#include "h7861.h"
+#include "h9341.h"
+int main_1322() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1522.h"
+#include "h3227.h"
+#include "h5655.h"
+#include "h9320.h"
+#include "h252.h"
+int main_1323() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4415.h"
+#include "h4027.h"
+#include "h2335.h"
+#include "h1846.h"
+#include "h3346.h"
+int main_1324() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7645.h"
+#include "h5619.h"
+#include "h4617.h"
+#include "h516.h"
+#include "h8992.h"
+#if 0
+#include "h2522.h"
+#endif
+int main_1325() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1959.h"
+#include "h5930.h"
+#include "h8659.h"
+#include "h3593.h"
+#include "h4108.h"
+int main_1326() { return 0; }
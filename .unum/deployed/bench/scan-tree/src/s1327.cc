@@ -0,0 +1,6 @@
+#include "h2023.h"
+#include "h4513.h"
+#include "h7973.h"
+#include "h5041.h"
+#include "h6935.h"
+int main_1327() { return 0; }
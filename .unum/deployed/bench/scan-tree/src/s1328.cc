@@ -0,0 +1,6 @@
+#include "h4521.h"
+#include "h4213.h"
+#include "h3337.h"
+#include "h2735.h"
+#include "h3783.h"
+int main_1328() { return 0; }
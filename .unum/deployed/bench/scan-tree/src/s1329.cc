@@ -0,0 +1,6 @@
+#include "h3811.h"
+#include "h4683.h"
+#include "h4757.h"
+#include "h6612.h"
+#include "h4437.h"
+int main_1329() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4821.h"
+#include "h2070.h"
+#include "h2787.h"
+#include "h7928.h"
+#include "h4547.h"
+int main_133() { return 0; }
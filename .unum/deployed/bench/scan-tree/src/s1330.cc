@@ -0,0 +1,9 @@
+#include "h922.h"
+#include "h7090.h"
+#include "h5062.h"
+#include "h8690.h"
+#include "h304.h"
+#if 0
+#include "h3839.h"
+#endif
+int main_1330() { return 0; }
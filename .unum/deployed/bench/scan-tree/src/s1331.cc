@@ -0,0 +1,6 @@
+#include "h7929.h"
+#include "h1172.h"
+#include "h165.h"
+#include "h5560.h"
+#include "h9424.h"
+int main_1331() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2078.h"
+#include "h7854.h"
+#include "h6947.h"
+#include "h3133.h"
+#include "h7868.h"
+int main_1332() { return 0; }
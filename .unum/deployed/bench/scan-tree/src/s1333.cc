@@ -0,0 +1,6 @@
+#include "h4227.h"
+#include "h4239.h"
+#include "h6633.h"
+#include "h8867.h"
+#include "h4191.h"
+int main_1333() { return 0; }
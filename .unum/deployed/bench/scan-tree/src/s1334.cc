@@ -0,0 +1,6 @@
+#include "h2592.h"
+#include "h3972.h"
+#include "h7058.h"
+#include "h13.h"
+#include "h7892.h"
+int main_1334() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4555.h"
+#include "h1429.h"
+#include "h8289.h"
+#include "h5575.h"
+#include "h173.h"
+#if 0
+#include "h361.h"
+#endif
+int main_1335() { return 0; }
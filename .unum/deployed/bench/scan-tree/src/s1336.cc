@@ -0,0 +1,6 @@
+#include "h9696.h"
+#include "h5813.h"
+#include "h8695.h"
+#include "h7630.h"
+#include "h6100.h"
+int main_1336() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2831.h"
+#include "h840.h"
+#include "h4145.h"
+#include "h4207.h"
+#include "h106.h"
+int main_1337() { return 0; }
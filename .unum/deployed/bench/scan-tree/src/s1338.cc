@@ -0,0 +1,6 @@
+#include "h1004.h"
+#include "h5891.h"
+#include "h9080.h"
+#include "h7749.h"
+#include "h8426.h"
+int main_1338() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7728.h"
+#include "h9598.h"
+#include "h4800.h"
+#include "h9435.h"
+#include "h5914.h"
+int main_1339() { return 0; }
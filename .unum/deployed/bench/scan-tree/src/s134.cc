@@ -0,0 +1,6 @@
+#include "h7327.h"
+#include "h3009.h"
+#include "h8498.h"
+#include "h1326.h"
+#include "h5857.h"
+int main_134() { return 0; }
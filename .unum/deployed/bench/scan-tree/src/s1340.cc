@@ -0,0 +1,9 @@
+#include "h4012.h"
+#include "h1375.h"
+#include "h4946.h"
+#include "h5913.h"
+#include "h3810.h"
+#if 0
+#include "h5500.h"
+#endif
+int main_1340() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7725.h"
+#include "h3380.h"
+#include "h8993.h"
+#include "h3744.h"
+#include "h9023.h"
+int main_1341() { return 0; }
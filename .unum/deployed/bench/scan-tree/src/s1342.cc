@@ -0,0 +1,6 @@
+#include "h3792.h"
+#include "h5806.h"
+#include "h2387.h"
+#include "h4670.h"
+#include "h3347.h"
+int main_1342() { return 0; }
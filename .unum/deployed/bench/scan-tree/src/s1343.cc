@@ -0,0 +1,6 @@
+#include "h7660.h"
+#include "h6157.h"
+#include "h6803.h"
+#include "h6860.h"
+#include "h4968.h"
+int main_1343() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3046.h"
+#include "h4750.h"
+#include "h1652.h"
+#include "h8586.h"
+#include "h9092.h"
+int main_1344() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9578.h"
+#include "h5319.h"
+#include "h9476.h"
+#include "h5474.h"
+#include "h8717.h"
+#if 0
+#include "h8061.h"
+#endif
+int main_1345() { return 0; }
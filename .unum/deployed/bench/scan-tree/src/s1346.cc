@@ -0,0 +1,6 @@
+#include "h3121.h"
+#include "h4121.h"
+#include "h8343.h"
+#include "h5796.h"
+#include "h2336.h"
+int main_1346() { return 0; }
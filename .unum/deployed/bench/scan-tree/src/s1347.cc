@@ -0,0 +1,6 @@
+#include "h771.h"
+#include "h8497.h"
+#include "h9222.h"
+#include "h3790.h"
+#include "h4460.h"
+int main_1347() { return 0; }
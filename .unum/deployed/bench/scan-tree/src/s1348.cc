@@ -0,0 +1,6 @@
+#include "h9424.h"
+#include "h1528.h"
+#include "h30.h"
+#include "h8525.h"
+#include "h6028.h"
+int main_1348() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4704.h"
+#include "h2502.h"
+#include "h6071.h"
+#include "h3873.h"
+#include "h2228.h"
+int main_1349() { return 0; }
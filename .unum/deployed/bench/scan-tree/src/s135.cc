@@ -0,0 +1,9 @@
+#include "h9949.h"
+#include "h1356.h"
+#include "h4395.h"
+#include "h3058.h"
+#include "h225.h"
+#if 0
+#include "h8744.h"
+#endif
+int main_135() { return 0; }
@@ -0,0 +1,9 @@
+#include "h260.h"
+#include "h3594.h"
+#include "h5786.h"
+#include "h3717.h"
+#include "h1248.h"
+#if 0
+#include "h9227.h"
+#endif
+int main_1350() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1274.h"
+#include "h8803.h"
+#include "h1378.h"
+#include "h2644.h"
+#include "h3107.h"
+int main_1351() { return 0; }
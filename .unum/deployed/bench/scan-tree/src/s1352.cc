@@ -0,0 +1,6 @@
+#include "h1582.h"
+#include "h8466.h"
+#include "h7446.h"
+#include "h9735.h"
+#include "h6530.h"
+int main_1352() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8262.h"
+#include "h8550.h"
+#include "h4010.h"
+#include "h1549.h"
+#include "h5639.h"
+int main_1353() { return 0; }
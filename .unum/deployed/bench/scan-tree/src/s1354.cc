@@ -0,0 +1,6 @@
+#include "h9158.h"
+#include "h7779.h"
+#include "h6763.h"
+#include "h1275.h"
+#include "h838.h"
+int main_1354() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6734.h"
+#include "h1123.h"
+#include "h1191.h"
+#include "h7556.h"
+#include "h4704.h"
+#if 0
+#include "h4585.h"
+#endif
+int main_1355() { return 0; }
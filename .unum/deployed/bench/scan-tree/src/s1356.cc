@@ -0,0 +1,6 @@
+#include "h1203.h"
+#include "h976.h"
+#include "h9048.h"
+#include "h5686.h"
+#include "h3953.h"
+int main_1356() { return 0; }
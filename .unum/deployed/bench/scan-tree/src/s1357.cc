@@ -0,0 +1,6 @@
+#include "h7926.h"
+#include "h3881.h"
+#include "h9688.h"
+#include "h8620.h"
+#include "h4405.h"
+int main_1357() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3109.h"
+#include "h6097.h"
+#include "h934.h"
+#include "h6146.h"
+#include "h5859.h"
+int main_1358() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7282.h"
+#include "h3052.h"
+#include "h513.h"
+#include "h4021.h"
+#include "h4107.h"
+int main_1359() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2244.h"
+#include "h3500.h"
+#include "h1720.h"
+#include "h5738.h"
+#include "h4427.h"
+int main_136() { return 0; }
@@ -0,0 +1,9 @@
+#include "h484.h"
+#include "h386.h"
+#include "h5144.h"
+#include "h8142.h"
+#include "h7711.h"
+#if 0
+#include "h6257.h"
+#endif
+int main_1360() { return 0; }
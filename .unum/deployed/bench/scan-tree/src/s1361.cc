@@ -0,0 +1,6 @@
+#include "h6752.h"
+#include "h7231.h"
+#include "h5355.h"
+#include "h8136.h"
+#include "h4748.h"
+int main_1361() { return 0; }
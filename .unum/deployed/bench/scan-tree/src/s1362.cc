@@ -0,0 +1,6 @@
+#include "h3138.h"
+#include "h9125.h"
+#include "h6386.h"
+#include "h1471.h"
+#include "h5802.h"
+int main_1362() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4912.h"
+#include "h5588.h"
+#include "h4500.h"
+#include "h8291.h"
+#include "h1646.h"
+int main_1363() { return 0; }
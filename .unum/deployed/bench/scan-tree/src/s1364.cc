@@ -0,0 +1,6 @@
+#include "h6678.h"
+#include "h413.h"
+#include "h7553.h"
+#include "h3644.h"
+#include "h1366.h"
+int main_1364() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4493.h"
+#include "h5859.h"
+#include "h4511.h"
+#include "h54.h"
+#include "h6686.h"
+#if 0
+#include "h8021.h"
+#endif
+int main_1365() { return 0; }
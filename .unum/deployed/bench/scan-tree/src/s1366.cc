@@ -0,0 +1,6 @@
+#include "h2521.h"
+#include "h6906.h"
+#include "h9964.h"
+#include "h1034.h"
+#include "h9621.h"
+int main_1366() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8417.h"
+#include "h6158.h"
+#include "h5330.h"
+#include "h4100.h"
+#include "h3958.h"
+int main_1367() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8009.h"
+#include "h9652.h"
+#include "h6587.h"
+#include "h3678.h"
+#include "h2955.h"
+int main_1368() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5230.h"
+#include "h6331.h"
+#include "h799.h"
+#include "h5968.h"
+#include "h669.h"
+int main_1369() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1556.h"
+#include "h2438.h"
+#include "h4029.h"
+#include "h7718.h"
+#include "h1226.h"
+int main_137() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3646.h"
+#include "h4385.h"
+#include "h5790.h"
+#include "h3447.h"
+#include "h8058.h"
+#if 0
+#include "h8781.h"
+#endif
+int main_1370() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6806.h"
+#include "h6377.h"
+#include "h9737.h"
+#include "h4593.h"
+#include "h4001.h"
+int main_1371() { return 0; }
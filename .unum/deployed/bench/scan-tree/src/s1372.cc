@@ -0,0 +1,6 @@
+#include "h3790.h"
+#include "h7350.h"
+#include "h9597.h"
+#include "h5372.h"
+#include "h7535.h"
+int main_1372() { return 0; }
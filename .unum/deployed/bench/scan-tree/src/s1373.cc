@@ -0,0 +1,6 @@
+#include "h4329.h"
+#include "h1200.h"
+#include "h6038.h"
+#include "h4330.h"
+#include "h5551.h"
+int main_1373() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5469.h"
+#include "h2077.h"
+#include "h3154.h"
+#include "h3690.h"
+#include "h6922.h"
+int main_1374() { return 0; }
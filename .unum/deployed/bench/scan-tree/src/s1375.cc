@@ -0,0 +1,9 @@
+#include "h8104.h"
+#include "h3736.h"
+#include "h2284.h"
+#include "h1243.h"
+#include "h1184.h"
+#if 0
+#include "h6659.h"
+#endif
+int main_1375() { return 0; }
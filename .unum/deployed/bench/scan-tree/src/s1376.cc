@@ -0,0 +1,6 @@
+#include "h5851.h"
+#include "h2616.h"
+#include "h6328.h"
+#include "h1023.h"
+#include "h9155.h"
+int main_1376() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4450.h"
+#include "h6450.h"
+#include "h2983.h"
+#include "h5003.h"
+#include "h1777.h"
+int main_1377() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8839.h"
+#include "h6644.h"
+#include "h3979.h"
+#include "h3209.h"
+#include "h4388.h"
+int main_1378() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7306.h"
+#include "h8346.h"
+#include "h129.h"
+#include "h5989.h"
+#include "h279.h"
+int main_1379() { return 0; }
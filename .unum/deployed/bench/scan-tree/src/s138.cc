@@ -0,0 +1,6 @@
+#include "h8909.h"
+#include "h5562.h"
+#include "h5859.h"
+#include "h9544.h"
+#include "h8606.h"
+int main_138() { return 0; }
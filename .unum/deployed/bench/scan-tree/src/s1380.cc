@@ -0,0 +1,9 @@
+#include "h1073.h"
+#include "h9202.h"
+#include "h1255.h"
+#include "h8119.h"
+#include "h4696.h"
+#if 0
+#include "h8510.h"
+#endif
+int main_1380() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7048.h"
+#include "h1890.h"
+#include "h6191.h"
+#include "h3014.h"
+#include "h1408.h"
+int main_1381() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4056.h"
+#include "h5504.h"
+#include "h9206.h"
+#include "h1596.h"
+#include "h1529.h"
+int main_1382() { return 0; }
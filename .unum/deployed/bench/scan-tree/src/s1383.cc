@@ -0,0 +1,6 @@
+#include "h3745.h"
+#include "h9216.h"
+#include "h6086.h"
+#include "h7885.h"
+#include "h8726.h"
+int main_1383() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4871.h"
+#include "h3548.h"
+#include "h1964.h"
+#include "h659.h"
+#include "h9163.h"
+int main_1384() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6177.h"
+#include "h6634.h"
+#include "h6123.h"
+#include "h4219.h"
+#include "h1601.h"
+#if 0
+#include "h1413.h"
+#endif
+int main_1385() { return 0; }
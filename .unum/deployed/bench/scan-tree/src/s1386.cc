@@ -0,0 +1,6 @@
+#include "h6698.h"
+#include "h449.h"
+#include "h1546.h"
+#include "h6522.h"
+#include "h9103.h"
+int main_1386() { return 0; }
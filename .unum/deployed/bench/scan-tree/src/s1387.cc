@@ -0,0 +1,6 @@
+#include "h8339.h"
+#include "h4401.h"
+#include "h604.h"
+#include "h3354.h"
+#include "h6032.h"
+int main_1387() { return 0; }
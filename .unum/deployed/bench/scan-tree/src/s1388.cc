@@ -0,0 +1,6 @@
+#include "h2764.h"
+#include "h4012.h"
+#include "h3668.h"
+#include "h3286.h"
+#include "h1209.h"
+int main_1388() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2707.h"
+#include "h5355.h"
+#include "h8799.h"
+#include "h5550.h"
+#include "h626.h"
+int main_1389() { return 0; }
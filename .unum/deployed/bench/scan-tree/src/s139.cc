@@ -0,0 +1,6 @@
+#include "h5692.h"
+#include "h8572.h"
+#include "h8061.h"
+#include "h9962.h"
+#include "h4321.h"
+int main_139() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3394.h"
+#include "h8672.h"
+#include "h1580.h"
+#include "h8419.h"
+#include "h4620.h"
+#if 0
+#include "h4297.h"
+#endif
+int main_1390() { return 0; }
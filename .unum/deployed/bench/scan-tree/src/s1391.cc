@@ -0,0 +1,6 @@
+#include "h1731.h"
+#include "h6628.h"
+#include "h355.h"
+#include "h4967.h"
+#include "h3086.h"
+int main_1391() { return 0; }
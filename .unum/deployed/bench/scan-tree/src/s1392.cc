@@ -0,0 +1,6 @@
+#include "h5756.h"
+#include "h3432.h"
+#include "h1062.h"
+#include "h1702.h"
+#include "h7534.h"
+int main_1392() { return 0; }
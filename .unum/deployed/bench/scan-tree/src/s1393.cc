@@ -0,0 +1,6 @@
+#include "h686.h"
+#include "h7499.h"
+#include "h6146.h"
+#include "h9186.h"
+#include "h9414.h"
+int main_1393() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6696.h"
+#include "h3723.h"
+#include "h9471.h"
+#include "h6539.h"
+#include "h69.h"
+int main_1394() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5645.h"
+#include "h2091.h"
+#include "h5938.h"
+#include "h5484.h"
+#include "h6150.h"
+#if 0
+#include "h6567.h"
+#endif
+int main_1395() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3593.h"
+#include "h4039.h"
+#include "h3912.h"
+#include "h7556.h"
+#include "h9297.h"
+int main_1396() { return 0; }
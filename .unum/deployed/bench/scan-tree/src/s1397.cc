@@ -0,0 +1,6 @@
+#include "h7060.h"
+#include "h9946.h"
+#include "h5785.h"
+#include "h5024.h"
+#include "h2826.h"
+int main_1397() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4696.h"
+#include "h2314.h"
+#include "h9875.h"
+#include "h7326.h"
+#include "h2974.h"
+int main_1398() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8495.h"
+#include "h2748.h"
+#include "h9094.h"
+#include "h3454.h"
+#include "h7215.h"
+int main_1399() { return 0; }
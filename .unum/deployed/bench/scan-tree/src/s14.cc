@@ -0,0 +1,6 @@
+#include "h9700.h"
+#include "h863.h"
+#include "h8997.h"
+#include "h4459.h"
+#include "h3338.h"
+int main_14() { return 0; }
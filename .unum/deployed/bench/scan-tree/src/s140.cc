@@ -0,0 +1,9 @@
+#include "h9257.h"
+#include "h5997.h"
+#include "h8549.h"
+#include "h940.h"
+#include "h1654.h"
+#if 0
+#include "h3504.h"
+#endif
+int main_140() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3182.h"
+#include "h1089.h"
+#include "h826.h"
+#include "h7223.h"
+#include "h4808.h"
+#if 0
+#include "h2378.h"
+#endif
+int main_1400() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5821.h"
+#include "h2070.h"
+#include "h4664.h"
+#include "h604.h"
+#include "h6948.h"
+int main_1401() { return 0; }
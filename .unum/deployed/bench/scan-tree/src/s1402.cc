@@ -0,0 +1,6 @@
+#include "h9598.h"
+#include "h3680.h"
+#include "h5131.h"
+#include "h4050.h"
+#include "h5374.h"
+int main_1402() { return 0; }
@@ -0,0 +1,6 @@
+#include "h722.h"
+#include "h3390.h"
+#include "h6238.h"
+#include "h2381.h"
+#include "h1398.h"
+int main_1403() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5928.h"
+#include "h239.h"
+#include "h7811.h"
+#include "h6547.h"
+#include "h8064.h"
+int main_1404() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2084.h"
+#include "h9376.h"
+#include "h9619.h"
+#include "h3686.h"
+#include "h3843.h"
+#if 0
+#include "h9510.h"
+#endif
+int main_1405() { return 0; }
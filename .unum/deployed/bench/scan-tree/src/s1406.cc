@@ -0,0 +1,6 @@
+#include "h2684.h"
+#include "h7843.h"
+#include "h2430.h"
+#include "h1560.h"
+#include "h620.h"
+int main_1406() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1705.h"
+#include "h9496.h"
+#include "h7922.h"
+#include "h842.h"
+#include "h7846.h"
+int main_1407() { return 0; }
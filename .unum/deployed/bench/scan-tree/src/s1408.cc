@@ -0,0 +1,6 @@
+#include "h1248.h"
+#include "h9275.h"
+#include "h2591.h"
+#include "h7876.h"
+#include "h7812.h"
+int main_1408() { return 0; }
@@ -0,0 +1,6 @@
+#include "h358.h"
+#include "h5920.h"
+#include "h717.h"
+#include "h5368.h"
+#include "h8181.h"
+int main_1409() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4650.h"
+#include "h6291.h"
+#include "h9001.h"
+#include "h9124.h"
+#include "h65.h"
+int main_141() { return 0; }
@@ -0,0 +1,9 @@
+#include "h591.h"
+#include "h3642.h"
+#include "h8861.h"
+#include "h6041.h"
+#include "h429.h"
+#if 0
+#include "h1228.h"
+#endif
+int main_1410() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1698.h"
+#include "h791.h"
+#include "h2120.h"
+#include "h692.h"
+#include "h4533.h"
+int main_1411() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8066.h"
+#include "h4224.h"
+#include "h9298.h"
+#include "h3428.h"
+#include "h9748.h"
+int main_1412() { return 0; }
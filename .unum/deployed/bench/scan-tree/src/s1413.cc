@@ -0,0 +1,6 @@
+#include "h4122.h"
+#include "h41.h"
+#include "h6921.h"
+#include "h8366.h"
+#include "h278.h"
+int main_1413() { return 0; }
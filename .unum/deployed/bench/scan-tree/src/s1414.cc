@@ -0,0 +1,6 @@
+#include "h5967.h"
+#include "h8144.h"
+#include "h8653.h"
+#include "h4123.h"
+#include "h5515.h"
+int main_1414() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4058.h"
+#include "h9938.h"
+#include "h9727.h"
+#include "h2436.h"
+#include "h2954.h"
+#if 0
+#include "h3045.h"
+#endif
+int main_1415() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4993.h"
+#include "h592.h"
+#include "h2258.h"
+#include "h369.h"
+#include "h9703.h"
+int main_1416() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1913.h"
+#include "h882.h"
+#include "h4536.h"
+#include "h8329.h"
+#include "h3033.h"
+int main_1417() { return 0; }
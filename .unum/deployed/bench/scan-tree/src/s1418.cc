@@ -0,0 +1,6 @@
+#include "h4055.h"
+#include "h5312.h"
+#include "h4043.h"
+#include "h5686.h"
+#include "h4023.h"
+int main_1418() { return 0; }
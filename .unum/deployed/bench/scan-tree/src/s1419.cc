@@ -0,0 +1,6 @@
+#include "h1906.h"
+#include "h6163.h"
+#include "h3706.h"
+#include "h4809.h"
+#include "h542.h"
+int main_1419() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2261.h"
+#include "h6775.h"
+#include "h4881.h"
+#include "h1924.h"
+#include "h4291.h"
+int main_142() { return 0; }
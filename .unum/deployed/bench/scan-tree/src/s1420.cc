@@ -0,0 +1,9 @@
+#include "h9674.h"
+#include "h6937.h"
+#include "h75.h"
+#include "h7746.h"
+#include "h717.h"
+#if 0
+#include "h2662.h"
+#endif
+int main_1420() { return 0; }
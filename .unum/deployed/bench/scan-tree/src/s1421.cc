@@ -0,0 +1,6 @@
+#include "h5995.h"
+#include "h7029.h"
+#include "h5720.h"
+#include "h2179.h"
+#include "h8298.h"
+int main_1421() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6350.h"
+#include "h9914.h"
+#include "h7675.h"
+#include "h2087.h"
+#include "h775.h"
+int main_1422() { return 0; }
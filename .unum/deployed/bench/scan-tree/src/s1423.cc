@@ -0,0 +1,6 @@
+#include "h5063.h"
+#include "h3409.h"
+#include "h4757.h"
+#include "h9814.h"
+#include "h8508.h"
+int main_1423() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3465.h"
+#include "h8290.h"
+#include "h8369.h"
+#include "h7159.h"
+#include "h633.h"
+int main_1424() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8650.h"
+#include "h7796.h"
+#include "h3566.h"
+#include "h1335.h"
+#include "h6651.h"
+#if 0
+#include "h190.h"
+#endif
+int main_1425() { return 0; }
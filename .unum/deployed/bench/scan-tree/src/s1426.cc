@@ -0,0 +1,6 @@
+#include "h1670.h"
+#include "h5521.h"
+#include "h3145.h"
+#include "h6410.h"
+#include "h4494.h"
+int main_1426() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4073.h"
+#include "h850.h"
+#include "h1469.h"
+#include "h3979.h"
+#include "h9090.h"
+int main_1427() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2937.h"
+#include "h8408.h"
+#include "h9393.h"
+#include "h6476.h"
+#include "h879.h"
+int main_1428() { return 0; }
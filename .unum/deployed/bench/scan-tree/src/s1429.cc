@@ -0,0 +1,6 @@
+#include "h6260.h"
+#include "h9046.h"
+#include "h5437.h"
+#include "h1041.h"
+#include "h5151.h"
+int main_1429() { return 0; }
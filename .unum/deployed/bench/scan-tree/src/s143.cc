@@ -0,0 +1,6 @@
+#include "h975.h"
+#include "h8314.h"
+#include "h5157.h"
+#include "h4217.h"
+#include "h8696.h"
+int main_143() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8691.h"
+#include "h5510.h"
+#include "h3024.h"
+#include "h398.h"
+#include "h6625.h"
+#if 0
+#include "h68.h"
+#endif
+int main_1430() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3967.h"
+#include "h460.h"
+#include "h3442.h"
+#include "h9661.h"
+#include "h8758.h"
+int main_1431() { return 0; }
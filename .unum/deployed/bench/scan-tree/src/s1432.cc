@@ -0,0 +1,6 @@
+#include "h413.h"
+#include "h4090.h"
+#include "h585.h"
+#include "h982.h"
+#include "h3694.h"
+int main_1432() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2413.h"
+#include "h256.h"
+#include "h9013.h"
+#include "h7027.h"
+#include "h4268.h"
+int main_1433() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9792.h"
+#include "h2350.h"
+#include "h1123.h"
+#include "h7756.h"
+#include "h7905.h"
+int main_1434() { return 0; }
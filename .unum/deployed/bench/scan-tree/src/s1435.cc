@@ -0,0 +1,9 @@
+#include "h2713.h"
+#include "h9216.h"
+#include "h128.h"
+#include "h1539.h"
+#include "h3509.h"
+#if 0
+#include "h7587.h"
+#endif
+int main_1435() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2860.h"
+#include "h4135.h"
+#include "h7444.h"
+#include "h576.h"
+#include "h8030.h"
+int main_1436() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9166.h"
+#include "h7106.h"
+#include "h1566.h"
+#include "h9085.h"
+#include "h7843.h"
+int main_1437() { return 0; }
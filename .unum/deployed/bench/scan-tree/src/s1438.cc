@@ -0,0 +1,6 @@
+#include "h5690.h"
+#include "h4841.h"
+#include "h877.h"
+#include "h1654.h"
+#include "h8960.h"
+int main_1438() { return 0; }
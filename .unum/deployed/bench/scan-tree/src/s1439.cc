@@ -0,0 +1,6 @@
+#include "h5989.h"
+#include "h8684.h"
+#include "h2991.h"
+#include "h9442.h"
+#include "h8161.h"
+int main_1439() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1177.h"
+#include "h2756.h"
+#include "h4301.h"
+#include "h9404.h"
+#include "h8739.h"
+int main_144() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7528.h"
+#include "h8235.h"
+#include "h5660.h"
+#include "h2702.h"
+#include "h2155.h"
+#if 0
+#include "h3793.h"
+#endif
+int main_1440() { return 0; }
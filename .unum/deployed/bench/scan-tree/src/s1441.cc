@@ -0,0 +1,6 @@
+#include "h3359.h"
+#include "h8460.h"
+#include "h8466.h"
+#include "h6564.h"
+#include "h5718.h"
+int main_1441() { return 0; }
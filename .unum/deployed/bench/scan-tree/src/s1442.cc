@@ -0,0 +1,6 @@
+#include "h6892.h"
+#include "h5059.h"
+#include "h8153.h"
+#include "h130.h"
+#include "h2596.h"
+int main_1442() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8795.h"
+#include "h1828.h"
+#include "h1570.h"
+#include "h6393.h"
+#include "h384.h"
+int main_1443() { return 0; }
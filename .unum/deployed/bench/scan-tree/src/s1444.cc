@@ -0,0 +1,6 @@
+#include "h4789.h"
+#include "h3757.h"
+#include "h2700.h"
+#include "h7959.h"
+#include "h8607.h"
+int main_1444() { return 0; }
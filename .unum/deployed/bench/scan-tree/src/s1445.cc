@@ -0,0 +1,9 @@
+#include "h9596.h"
+#include "h6568.h"
+#include "h8627.h"
+#include "h2043.h"
+#include "h1124.h"
+#if 0
+#include "h8886.h"
+#endif
+int main_1445() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6149.h"
+#include "h9893.h"
+#include "h7646.h"
+#include "h4589.h"
+#include "h7726.h"
+int main_1446() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1079.h"
+#include "h2089.h"
+#include "h3363.h"
+#include "h6577.h"
+#include "h2038.h"
+int main_1447() { return 0; }
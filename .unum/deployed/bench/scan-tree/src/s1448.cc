@@ -0,0 +1,6 @@
+#include "h8501.h"
+#include "h8240.h"
+#include "h5360.h"
+#include "h5114.h"
+#include "h45.h"
+int main_1448() { return 0; }
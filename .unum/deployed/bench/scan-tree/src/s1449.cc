@@ -0,0 +1,6 @@
+#include "h8398.h"
+#include "h7118.h"
+#include "h2125.h"
+#include "h8888.h"
+#include "h5162.h"
+int main_1449() { return 0; }
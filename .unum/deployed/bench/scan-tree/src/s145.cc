@@ -0,0 +1,9 @@
+#include "h6765.h"
+#include "h4267.h"
+#include "h8169.h"
+#include "h1818.h"
+#include "h1649.h"
+#if 0
+#include "h7802.h"
+#endif
+int main_145() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6387.h"
+#include "h8920.h"
+#include "h9139.h"
+#include "h7548.h"
+#include "h2150.h"
+#if 0
+#include "h438.h"
+#endif
+int main_1450() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2160.h"
+#include "h3816.h"
+#include "h7760.h"
+#include "h665.h"
+#include "h2671.h"
+int main_1451() { return 0; }
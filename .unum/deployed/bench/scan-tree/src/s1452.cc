@@ -0,0 +1,6 @@
+#include "h1566.h"
+#include "h6819.h"
+#include "h5051.h"
+#include "h4624.h"
+#include "h2539.h"
+int main_1452() { return 0; }
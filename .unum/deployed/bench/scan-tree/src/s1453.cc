@@ -0,0 +1,6 @@
+#include "h1537.h"
+#include "h694.h"
+#include "h9435.h"
+#include "h5745.h"
+#include "h8134.h"
+int main_1453() { return 0; }
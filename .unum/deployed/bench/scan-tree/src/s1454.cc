@@ -0,0 +1,6 @@
+#include "h7109.h"
+#include "h4616.h"
+#include "h2407.h"
+#include "h8378.h"
+#include "h5542.h"
+int main_1454() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1144.h"
+#include "h9298.h"
+#include "h2424.h"
+#include "h78.h"
+#include "h8435.h"
+#if 0
+#include "h4545.h"
+#endif
+int main_1455() { return 0; }
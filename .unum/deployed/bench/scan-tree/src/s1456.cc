@@ -0,0 +1,6 @@
+#include "h3829.h"
+#include "h6368.h"
+#include "h6885.h"
+#include "h5924.h"
+#include "h5024.h"
+int main_1456() { return 0; }
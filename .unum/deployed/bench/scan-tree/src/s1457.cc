@@ -0,0 +1,6 @@
+#include "h8394.h"
+#include "h9312.h"
+#include "h8242.h"
+#include "h521.h"
+#include "h6061.h"
+int main_1457() { return 0; }
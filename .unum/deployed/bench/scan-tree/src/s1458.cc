@@ -0,0 +1,6 @@
+#include "h1447.h"
+#include "h3620.h"
+#include "h1210.h"
+#include "h9427.h"
+#include "h4502.h"
+int main_1458() { return 0; }
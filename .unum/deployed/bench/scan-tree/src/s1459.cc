@@ -0,0 +1,6 @@
+#include "h8050.h"
+#include "h7362.h"
+#include "h1372.h"
+#include "h3308.h"
+#include "h4662.h"
+int main_1459() { return 0; }
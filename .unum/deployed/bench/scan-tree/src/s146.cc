@@ -0,0 +1,6 @@
+#include "h1697.h"
+#include "h3920.h"
+#include "h425.h"
+#include "h3954.h"
+#include "h8765.h"
+int main_146() { return 0; }
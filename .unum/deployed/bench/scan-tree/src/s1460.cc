@@ -0,0 +1,9 @@
+#include "h2322.h"
+#include "h9549.h"
+#include "h1255.h"
+#include "h8193.h"
+#include "h7962.h"
+#if 0
+#include "h22.h"
+#endif
+int main_1460() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8165.h"
+#include "h9268.h"
+#include "h2707.h"
+#include "h2162.h"
+#include "h8366.h"
+int main_1461() { return 0; }
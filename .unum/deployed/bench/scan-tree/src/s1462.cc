@@ -0,0 +1,6 @@
+#include "h566.h"
+#include "h77.h"
+#include "h7680.h"
+#include "h2076.h"
+#include "h5333.h"
+int main_1462() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9569.h"
+#include "h7295.h"
+#include "h8991.h"
+#include "h3988.h"
+#include "h3547.h"
+int main_1463() { return 0; }
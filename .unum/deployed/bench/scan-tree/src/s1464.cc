@@ -0,0 +1,6 @@
+#include "h8050.h"
+#include "h1275.h"
+#include "h5433.h"
+#include "h5632.h"
+#include "h8634.h"
+int main_1464() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2884.h"
+#include "h8046.h"
+#include "h3999.h"
+#include "h6520.h"
+#include "h1693.h"
+#if 0
+#include "h7136.h"
+#endif
+int main_1465() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9037.h"
+#include "h1431.h"
+#include "h4831.h"
+#include "h1561.h"
+#include "h5096.h"
+int main_1466() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6906.h"
+#include "h7613.h"
+#include "h4224.h"
+#include "h6376.h"
+#include "h6029.h"
+int main_1467() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7851.h"
+#include "h8351.h"
+#include "h4989.h"
+#include "h1367.h"
+#include "h442.h"
+int main_1468() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2030.h"
+#include "h5613.h"
+#include "h7825.h"
+#include "h7264.h"
+#include "h1556.h"
+int main_1469() { return 0; }
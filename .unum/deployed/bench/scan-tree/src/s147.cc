@@ -0,0 +1,6 @@
+#include "h3174.h"
+#include "h6676.h"
+#include "h1352.h"
+#include "h8701.h"
+#include "h9770.h"
+int main_147() { return 0; }
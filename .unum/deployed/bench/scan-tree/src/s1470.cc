@@ -0,0 +1,9 @@
+#include "h9278.h"
+#include "h8445.h"
+#include "h5434.h"
+#include "h198.h"
+#include "h1254.h"
+#if 0
+#include "h8304.h"
+#endif
+int main_1470() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4300.h"
+#include "h4546.h"
+#include "h1766.h"
+#include "h6946.h"
+#include "h4502.h"
+int main_1471() { return 0; }
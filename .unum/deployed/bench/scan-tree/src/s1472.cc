@@ -0,0 +1,6 @@
+#include "h4839.h"
+#include "h8712.h"
+#include "h9544.h"
+#include "h1297.h"
+#include "h1307.h"
+int main_1472() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3934.h"
+#include "h4744.h"
+#include "h1176.h"
+#include "h4242.h"
+#include "h4282.h"
+int main_1473() { return 0; }
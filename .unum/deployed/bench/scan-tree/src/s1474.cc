@@ -0,0 +1,6 @@
+#include "h2479.h"
+#include "h4140.h"
+#include "h4371.h"
+#include "h1023.h"
+#include "h5151.h"
+int main_1474() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5571.h"
+#include "h334.h"
+#include "h7971.h"
+#include "h3993.h"
+#include "h8587.h"
+#if 0
+#include "h1473.h"
+#endif
+int main_1475() { return 0; }
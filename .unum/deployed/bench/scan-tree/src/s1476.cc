@@ -0,0 +1,6 @@
+#include "h6004.h"
+#include "h1861.h"
+#include "h6323.h"
+#include "h742.h"
+#include "h1789.h"
+int main_1476() { return 0; }
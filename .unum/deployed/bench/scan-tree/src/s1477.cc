@@ -0,0 +1,6 @@
+#include "h9832.h"
+#include "h1601.h"
+#include "h2864.h"
+#include "h5884.h"
+#include "h7017.h"
+int main_1477() { return 0; }
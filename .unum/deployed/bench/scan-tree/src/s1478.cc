@@ -0,0 +1,6 @@
+#include "h9373.h"
+#include "h3851.h"
+#include "h3406.h"
+#include "h1196.h"
+#include "h5511.h"
+int main_1478() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6792.h"
+#include "h8843.h"
+#include "h8761.h"
+#include "h1620.h"
+#include "h2386.h"
+int main_1479() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5050.h"
+#include "h9003.h"
+#include "h6007.h"
+#include "h6121.h"
+#include "h1329.h"
+int main_148() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2012.h"
+#include "h7054.h"
+#include "h331.h"
+#include "h9841.h"
+#include "h3192.h"
+#if 0
+#include "h8228.h"
+#endif
+int main_1480() { return 0; }
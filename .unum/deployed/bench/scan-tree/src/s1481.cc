@@ -0,0 +1,6 @@
+#include "h2741.h"
+#include "h4317.h"
+#include "h5625.h"
+#include "h9185.h"
+#include "h9829.h"
+int main_1481() { return 0; }
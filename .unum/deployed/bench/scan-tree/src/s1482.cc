@@ -0,0 +1,6 @@
+#include "h1246.h"
+#include "h5883.h"
+#include "h2644.h"
+#include "h5621.h"
+#include "h3462.h"
+int main_1482() { return 0; }
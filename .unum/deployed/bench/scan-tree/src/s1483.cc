@@ -0,0 +1,6 @@
+#include "h9233.h"
+#include "h9921.h"
+#include "h5094.h"
+#include "h6074.h"
+#include "h6036.h"
+int main_1483() { return 0; }
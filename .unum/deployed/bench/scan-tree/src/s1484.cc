@@ -0,0 +1,6 @@
+#include "h1601.h"
+#include "h5149.h"
+#include "h821.h"
+#include "h8836.h"
+#include "h295.h"
+int main_1484() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2220.h"
+#include "h6927.h"
+#include "h5616.h"
+#include "h8454.h"
+#include "h8292.h"
+#if 0
+#include "h8132.h"
+#endif
+int main_1485() { return 0; }
@@ -0,0 +1,6 @@
+#include "h255.h"
+#include "h5765.h"
+#include "h9649.h"
+#include "h6484.h"
+#include "h3500.h"
+int main_1486() { return 0; }
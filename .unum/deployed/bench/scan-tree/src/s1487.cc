@@ -0,0 +1,6 @@
+#include "h1560.h"
+#include "h6768.h"
+#include "h8926.h"
+#include "h2805.h"
+#include "h4143.h"
+int main_1487() { return 0; }
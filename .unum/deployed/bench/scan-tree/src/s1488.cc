@@ -0,0 +1,6 @@
+#include "h3789.h"
+#include "h1967.h"
+#include "h1020.h"
+#include "h4865.h"
+#include "h9793.h"
+int main_1488() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5052.h"
+#include "h257.h"
+#include "h3060.h"
+#include "h6513.h"
+#include "h3496.h"
+int main_1489() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8198.h"
+#include "h897.h"
+#include "h9037.h"
+#include "h6942.h"
+#include "h165.h"
+int main_149() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5115.h"
+#include "h9919.h"
+#include "h6133.h"
+#include "h396.h"
+#include "h8365.h"
+#if 0
+#include "h4794.h"
+#endif
+int main_1490() { return 0; }
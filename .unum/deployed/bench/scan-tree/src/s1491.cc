@@ -0,0 +1,6 @@
+#include "h859.h"
+#include "h7164.h"
+#include "h4963.h"
+#include "h4242.h"
+#include "h4819.h"
+int main_1491() { return 0; }
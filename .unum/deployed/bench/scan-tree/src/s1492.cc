@@ -0,0 +1,6 @@
+#include "h1796.h"
+#include "h1638.h"
+#include "h4481.h"
+#include "h6374.h"
+#include "h4825.h"
+int main_1492() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6824.h"
+#include "h3722.h"
+#include "h9794.h"
+#include "h7925.h"
+#include "h3606.h"
+int main_1493() { return 0; }
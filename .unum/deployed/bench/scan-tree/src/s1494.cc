@@ -0,0 +1,6 @@
+#include "h6239.h"
+#include "h3026.h"
+#include "h9912.h"
+#include "h6719.h"
+#include "h5820.h"
+int main_1494() { return 0; }
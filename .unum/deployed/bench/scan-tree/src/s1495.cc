@@ -0,0 +1,9 @@
+#include "h9003.h"
+#include "h5151.h"
+#include "h8426.h"
+#include "h2931.h"
+#include "h744.h"
+#if 0
+#include "h9601.h"
+#endif
+int main_1495() { return 0; }
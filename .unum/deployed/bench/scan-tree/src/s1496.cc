@@ -0,0 +1,6 @@
+#include "h3631.h"
+#include "h8950.h"
+#include "h2984.h"
+#include "h6889.h"
+#include "h7158.h"
+int main_1496() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4473.h"
+#include "h7041.h"
+#include "h4769.h"
+#include "h5297.h"
+#include "h5485.h"
+int main_1497() { return 0; }
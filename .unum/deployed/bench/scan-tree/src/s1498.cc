@@ -0,0 +1,6 @@
+#include "h3823.h"
+#include "h8784.h"
+#include "h9059.h"
+#include "h4091.h"
+#include "h5873.h"
+int main_1498() { return 0; }
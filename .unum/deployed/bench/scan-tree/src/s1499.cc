@@ -0,0 +1,6 @@
+#include "h2290.h"
+#include "h6380.h"
+#include "h1752.h"
+#include "h3503.h"
+#include "h3564.h"
+int main_1499() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5625.h"
+#include "h1712.h"
+#include "h4700.h"
+#include "h9954.h"
+#include "h3717.h"
+#if 0
+#include "h5957.h"
+#endif
+int main_15() { return 0; }
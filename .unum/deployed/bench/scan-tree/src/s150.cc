@@ -0,0 +1,9 @@
+#include "h3966.h"
+#include "h6054.h"
+#include "h8493.h"
+#include "h2490.h"
+#include "h347.h"
+#if 0
+#include "h8395.h"
+#endif
+int main_150() { return 0; }
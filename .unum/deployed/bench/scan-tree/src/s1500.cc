@@ -0,0 +1,9 @@
+#include "h5960.h"
+#include "h4884.h"
+#include "h1626.h"
+#include "h9846.h"
+#include "h8857.h"
+#if 0
+#include "h4785.h"
+#endif
+int main_1500() { return 0; }
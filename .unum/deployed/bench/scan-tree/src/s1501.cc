@@ -0,0 +1,6 @@
+#include "h1194.h"
+#include "h5157.h"
+#include "h3052.h"
+#include "h9332.h"
+#include "h1034.h"
+int main_1501() { return 0; }
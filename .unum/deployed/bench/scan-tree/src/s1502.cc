@@ -0,0 +1,6 @@
+#include "h5481.h"
+#include "h905.h"
+#include "h9396.h"
+#include "h3614.h"
+#include "h7199.h"
+int main_1502() { return 0; }
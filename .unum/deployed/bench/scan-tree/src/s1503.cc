@@ -0,0 +1,6 @@
+#include "h76.h"
+#include "h8497.h"
+#include "h44.h"
+#include "h6779.h"
+#include "h2957.h"
+int main_1503() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6331.h"
+#include "h2115.h"
+#include "h459.h"
+#include "h8650.h"
+#include "h6858.h"
+int main_1504() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7961.h"
+#include "h8638.h"
+#include "h3747.h"
+#include "h714.h"
+#include "h5881.h"
+#if 0
+#include "h3286.h"
+#endif
+int main_1505() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5559.h"
+#include "h5236.h"
+#include "h3698.h"
+#include "h1953.h"
+#include "h9872.h"
+int main_1506() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6525.h"
+#include "h2076.h"
+#include "h2558.h"
+#include "h1001.h"
+#include "h3679.h"
+int main_1507() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7269.h"
+#include "h4763.h"
+#include "h7352.h"
+#include "h6657.h"
+#include "h3546.h"
+int main_1508() { return 0; }
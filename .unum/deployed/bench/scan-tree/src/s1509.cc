@@ -0,0 +1,6 @@
+#include "h4110.h"
+#include "h8362.h"
+#include "h7738.h"
+#include "h2829.h"
+#include "h5684.h"
+int main_1509() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7906.h"
+#include "h4642.h"
+#include "h6642.h"
+#include "h4381.h"
+#include "h7868.h"
+int main_151() { return 0; }
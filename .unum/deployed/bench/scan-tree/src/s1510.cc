@@ -0,0 +1,9 @@
+#include "h386.h"
+#include "h9157.h"
+#include "h7279.h"
+#include "h7411.h"
+#include "h3460.h"
+#if 0
+#include "h4297.h"
+#endif
+int main_1510() { return 0; }
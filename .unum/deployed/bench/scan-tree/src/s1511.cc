@@ -0,0 +1,6 @@
+#include "h4663.h"
+#include "h8217.h"
+#include "h9723.h"
+#include "h9052.h"
+#include "h2552.h"
+int main_1511() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7929.h"
+#include "h6879.h"
+#include "h4690.h"
+#include "h5440.h"
+#include "h9269.h"
+int main_1512() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6553.h"
+#include "h8755.h"
+#include "h689.h"
+#include "h7689.h"
+#include "h3223.h"
+int main_1513() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1418.h"
+#include "h2562.h"
+#include "h3855.h"
+#include "h5505.h"
+#include "h6760.h"
+int main_1514() { return 0; }
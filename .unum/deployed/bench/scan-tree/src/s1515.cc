@@ -0,0 +1,9 @@
+#include "h7746.h"
+#include "h8265.h"
+#include "h7386.h"
+#include "h4466.h"
+#include "h3065.h"
+#if 0
+#include "h6603.h"
+#endif
+int main_1515() { return 0; }
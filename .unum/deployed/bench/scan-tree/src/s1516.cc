@@ -0,0 +1,6 @@
+#include "h6868.h"
+#include "h4883.h"
+#include "h1553.h"
+#include "h8343.h"
+#include "h8220.h"
+int main_1516() { return 0; }
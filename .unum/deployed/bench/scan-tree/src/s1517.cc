@@ -0,0 +1,6 @@
+#include "h9405.h"
+#include "h1670.h"
+#include "h9415.h"
+#include "h3554.h"
+#include "h9713.h"
+int main_1517() { return 0; }
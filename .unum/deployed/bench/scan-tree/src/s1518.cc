@@ -0,0 +1,6 @@
+#include "h5608.h"
+#include "h6094.h"
+#include "h1482.h"
+#include "h1121.h"
+#include "h8670.h"
+int main_1518() { return 0; }
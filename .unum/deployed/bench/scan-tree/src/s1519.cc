@@ -0,0 +1,6 @@
+#include "h8064.h"
+#include "h6043.h"
+#include "h3395.h"
+#include "h1764.h"
+#include "h1203.h"
+int main_1519() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8054.h"
+#include "h115.h"
+#include "h1017.h"
+#include "h4862.h"
+#include "h548.h"
+int main_152() { return 0; }
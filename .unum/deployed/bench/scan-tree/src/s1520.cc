@@ -0,0 +1,9 @@
+#include "h6929.h"
+#include "h3543.h"
+#include "h9068.h"
+#include "h2824.h"
+#include "h4711.h"
+#if 0
+#include "h3784.h"
+#endif
+int main_1520() { return 0; }
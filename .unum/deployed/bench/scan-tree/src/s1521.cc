@@ -0,0 +1,6 @@
+#include "h9914.h"
+#include "h9320.h"
+#include "h7433.h"
+#include "h888.h"
+#include "h4093.h"
+int main_1521() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3944.h"
+#include "h5251.h"
+#include "h2829.h"
+#include "h4560.h"
+#include "h743.h"
+int main_1522() { return 0; }
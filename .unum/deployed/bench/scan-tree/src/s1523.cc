@@ -0,0 +1,6 @@
+#include "h4180.h"
+#include "h5818.h"
+#include "h420.h"
+#include "h2263.h"
+#include "h4727.h"
+int main_1523() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3819.h"
+#include "h4986.h"
+#include "h3463.h"
+#include "h4196.h"
+#include "h4778.h"
+int main_1524() { return 0; }
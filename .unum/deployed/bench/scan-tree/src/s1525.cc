@@ -0,0 +1,9 @@
+#include "h7957.h"
+#include "h1698.h"
+#include "h2561.h"
+#include "h8984.h"
+#include "h67.h"
+#if 0
+#include "h8388.h"
+#endif
+int main_1525() { return 0; }
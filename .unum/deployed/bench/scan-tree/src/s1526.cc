@@ -0,0 +1,6 @@
+#include "h7030.h"
+#include "h2642.h"
+#include "h8892.h"
+#include "h4899.h"
+#include "h6981.h"
+int main_1526() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6926.h"
+#include "h4987.h"
+#include "h6178.h"
+#include "h5027.h"
+#include "h3452.h"
+int main_1527() { return 0; }
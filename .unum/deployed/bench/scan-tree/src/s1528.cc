@@ -0,0 +1,6 @@
+#include "h5672.h"
+#include "h2610.h"
+#include "h9942.h"
+#include "h1330.h"
+#include "h9761.h"
+int main_1528() { return 0; }
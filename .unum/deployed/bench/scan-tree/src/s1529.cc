@@ -0,0 +1,6 @@
+#include "h4416.h"
+#include "h995.h"
+#include "h9843.h"
+#include "h1331.h"
+#include "h707.h"
+int main_1529() { return 0; }
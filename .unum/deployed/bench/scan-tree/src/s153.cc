@@ -0,0 +1,6 @@
+#include "h9612.h"
+#include "h4641.h"
+#include "h3182.h"
+#include "h8039.h"
+#include "h9404.h"
+int main_153() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4127.h"
+#include "h2794.h"
+#include "h4421.h"
+#include "h7800.h"
+#include "h4141.h"
+#if 0
+#include "h1678.h"
+#endif
+int main_1530() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4036.h"
+#include "h5301.h"
+#include "h902.h"
+#include "h6039.h"
+#include "h9307.h"
+int main_1531() { return 0; }
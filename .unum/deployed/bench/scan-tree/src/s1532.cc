@@ -0,0 +1,6 @@
+#include "h5038.h"
+#include "h9980.h"
+#include "h4730.h"
+#include "h5805.h"
+#include "h9715.h"
+int main_1532() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7971.h"
+#include "h2229.h"
+#include "h3886.h"
+#include "h9742.h"
+#include "h6217.h"
+int main_1533() { return 0; }
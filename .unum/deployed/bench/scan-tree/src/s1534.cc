@@ -0,0 +1,6 @@
+#include "h955.h"
+#include "h1203.h"
+#include "h8289.h"
+#include "h9635.h"
+#include "h4765.h"
+int main_1534() { return 0; }
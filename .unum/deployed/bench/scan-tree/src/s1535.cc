@@ -0,0 +1,9 @@
+#include "h2179.h"
+#include "h4237.h"
+#include "h726.h"
+#include "h6634.h"
+#include "h9406.h"
+#if 0
+#include "h7743.h"
+#endif
+int main_1535() { return 0; }
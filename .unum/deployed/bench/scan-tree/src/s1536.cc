@@ -0,0 +1,6 @@
+#include "h4705.h"
+#include "h9177.h"
+#include "h9163.h"
+#include "h3205.h"
+#include "h6326.h"
+int main_1536() { return 0; }
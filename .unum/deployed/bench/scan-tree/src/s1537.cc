@@ -0,0 +1,6 @@
+#include "h6018.h"
+#include "h3451.h"
+#include "h7661.h"
+#include "h3084.h"
+#include "h3085.h"
+int main_1537() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4107.h"
+#include "h2837.h"
+#include "h7874.h"
+#include "h9459.h"
+#include "h1369.h"
+int main_1538() { return 0; }
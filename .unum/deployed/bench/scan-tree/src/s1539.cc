@@ -0,0 +1,6 @@
+#include "h891.h"
+#include "h9573.h"
+#include "h7967.h"
+#include "h9138.h"
+#include "h2457.h"
+int main_1539() { return 0; }
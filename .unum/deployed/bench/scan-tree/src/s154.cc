@@ -0,0 +1,6 @@
+#include "h831.h"
+#include "h1683.h"
+#include "h6844.h"
+#include "h5423.h"
+#include "h6254.h"
+int main_154() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2734.h"
+#include "h1932.h"
+#include "h556.h"
+#include "h6645.h"
+#include "h5948.h"
+#if 0
+#include "h9129.h"
+#endif
+int main_1540() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2936.h"
+#include "h5946.h"
+#include "h6948.h"
+#include "h4631.h"
+#include "h4832.h"
+int main_1541() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7746.h"
+#include "h4811.h"
+#include "h3530.h"
+#include "h8513.h"
+#include "h2253.h"
+int main_1542() { return 0; }
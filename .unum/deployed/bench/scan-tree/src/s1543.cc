@@ -0,0 +1,6 @@
+#include "h9558.h"
+#include "h8922.h"
+#include "h98.h"
+#include "h8629.h"
+#include "h4474.h"
+int main_1543() { return 0; }
@@ -0,0 +1,6 @@
+#include "h518.h"
+#include "h2260.h"
+#include "h2529.h"
+#include "h8206.h"
+#include "h5440.h"
+int main_1544() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9010.h"
+#include "h913.h"
+#include "h557.h"
+#include "h8199.h"
+#include "h3387.h"
+#if 0
+#include "h5821.h"
+#endif
+int main_1545() { return 0; }
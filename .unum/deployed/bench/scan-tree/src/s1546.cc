@@ -0,0 +1,6 @@
+#include "h6653.h"
+#include "h9917.h"
+#include "h1504.h"
+#include "h5518.h"
+#include "h9057.h"
+int main_1546() { return 0; }
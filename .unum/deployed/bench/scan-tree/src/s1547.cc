@@ -0,0 +1,6 @@
+#include "h1205.h"
+#include "h2684.h"
+#include "h2336.h"
+#include "h7452.h"
+#include "h3274.h"
+int main_1547() { return 0; }
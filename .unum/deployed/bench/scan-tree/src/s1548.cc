@@ -0,0 +1,6 @@
+#include "h9331.h"
+#include "h663.h"
+#include "h2398.h"
+#include "h8231.h"
+#include "h4234.h"
+int main_1548() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1885.h"
+#include "h6040.h"
+#include "h8889.h"
+#include "h4960.h"
+#include "h8779.h"
+int main_1549() { return 0; }
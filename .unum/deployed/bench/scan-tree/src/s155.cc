@@ -0,0 +1,9 @@
+#include "h966.h"
+#include "h1339.h"
+#include "h4267.h"
+#include "h6045.h"
+#include "h2671.h"
+#if 0
+#include "h8033.h"
+#endif
+int main_155() { return 0; }
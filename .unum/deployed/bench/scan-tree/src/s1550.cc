@@ -0,0 +1,9 @@
+#include "h5198.h"
+#include "h3074.h"
+#include "h7951.h"
+#include "h8617.h"
+#include "h7937.h"
+#if 0
+#include "h2112.h"
+#endif
+int main_1550() { return 0; }
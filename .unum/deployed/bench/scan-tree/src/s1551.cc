@@ -0,0 +1,6 @@
+#include "h3513.h"
+#include "h6678.h"
+#include "h8107.h"
+#include "h616.h"
+#include "h2354.h"
+int main_1551() { return 0; }
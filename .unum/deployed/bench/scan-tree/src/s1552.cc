@@ -0,0 +1,6 @@
+#include "h5795.h"
+#include "h275.h"
+#include "h8655.h"
+#include "h2446.h"
+#include "h26.h"
+int main_1552() { return 0; }
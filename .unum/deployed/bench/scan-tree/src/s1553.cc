@@ -0,0 +1,6 @@
+#include "h6288.h"
+#include "h4463.h"
+#include "h7008.h"
+#include "h81.h"
+#include "h5448.h"
+int main_1553() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8694.h"
+#include "h8689.h"
+#include "h873.h"
+#include "h4934.h"
+#include "h775.h"
+int main_1554() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4641.h"
+#include "h7716.h"
+#include "h5199.h"
+#include "h3241.h"
+#include "h378.h"
+#if 0
+#include "h4574.h"
+#endif
+int main_1555() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8124.h"
+#include "h2668.h"
+#include "h3938.h"
+#include "h48.h"
+#include "h9221.h"
+int main_1556() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2348.h"
+#include "h7512.h"
+#include "h4694.h"
+#include "h9232.h"
+#include "h5585.h"
+int main_1557() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8136.h"
+#include "h1961.h"
+#include "h5047.h"
+#include "h2565.h"
+#include "h1353.h"
+int main_1558() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5841.h"
+#include "h9738.h"
+#include "h3216.h"
+#include "h2371.h"
+#include "h4406.h"
+int main_1559() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8505.h"
+#include "h2513.h"
+#include "h7022.h"
+#include "h9476.h"
+#include "h9757.h"
+int main_156() { return 0; }
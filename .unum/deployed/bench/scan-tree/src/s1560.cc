@@ -0,0 +1,9 @@
+#include "h6364.h"
+#include "h7917.h"
+#include "h5333.h"
+#include "h9179.h"
+#include "h9462.h"
+#if 0
+#include "h4354.h"
+#endif
+int main_1560() { return 0; }
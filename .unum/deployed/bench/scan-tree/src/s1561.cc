@@ -0,0 +1,6 @@
+#include "h1775.h"
+#include "h4762.h"
+#include "h1443.h"
+#include "h7361.h"
+#include "h8152.h"
+int main_1561() { return 0; }
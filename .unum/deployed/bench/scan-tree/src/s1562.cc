@@ -0,0 +1,6 @@
+#include "h7707.h"
+#include "h4945.h"
+#include "h1688.h"
+#include "h7680.h"
+#include "h5169.h"
+int main_1562() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5729.h"
+#include "h9652.h"
+#include "h4378.h"
+#include "h7297.h"
+#include "h5644.h"
+int main_1563() { return 0; }
@@ -0,0 +1,6 @@
+#include "h396.h"
+#include "h1733.h"
+#include "h9497.h"
+#include "h6437.h"
+#include "h4159.h"
+int main_1564() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4392.h"
+#include "h2821.h"
+#include "h5468.h"
+#include "h184.h"
+#include "h5273.h"
+#if 0
+#include "h2139.h"
+#endif
+int main_1565() { return 0; }
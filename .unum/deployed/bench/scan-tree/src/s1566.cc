@@ -0,0 +1,6 @@
+#include "h4839.h"
+#include "h3567.h"
+#include "h5503.h"
+#include "h7806.h"
+#include "h1959.h"
+int main_1566() { return 0; }
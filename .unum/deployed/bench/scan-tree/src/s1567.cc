@@ -0,0 +1,6 @@
+#include "h1614.h"
+#include "h4406.h"
+#include "h9939.h"
+#include "h6199.h"
+#include "h487.h"
+int main_1567() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1118.h"
+#include "h7542.h"
+#include "h5589.h"
+#include "h516.h"
+#include "h95.h"
+int main_1568() { return 0; }
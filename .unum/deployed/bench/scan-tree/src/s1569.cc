@@ -0,0 +1,6 @@
+#include "h4752.h"
+#include "h1255.h"
+#include "h5035.h"
+#include "h3254.h"
+#include "h6030.h"
+int main_1569() { return 0; }
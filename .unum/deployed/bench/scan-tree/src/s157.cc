@@ -0,0 +1,6 @@
+#include "h1708.h"
+#include "h4978.h"
+#include "h16.h"
+#include "h6885.h"
+#include "h2385.h"
+int main_157() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3827.h"
+#include "h5228.h"
+#include "h3930.h"
+#include "h6714.h"
+#include "h7507.h"
+#if 0
+#include "h7657.h"
+#endif
+int main_1570() { return 0; }
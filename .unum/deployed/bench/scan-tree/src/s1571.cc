@@ -0,0 +1,6 @@
+#include "h1957.h"
+#include "h8042.h"
+#include "h7994.h"
+#include "h4606.h"
+#include "h7493.h"
+int main_1571() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1181.h"
+#include "h5673.h"
+#include "h9271.h"
+#include "h6142.h"
+#include "h2775.h"
+int main_1572() { return 0; }
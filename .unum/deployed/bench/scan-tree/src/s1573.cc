@@ -0,0 +1,6 @@
+#include "h5138.h"
+#include "h5414.h"
+#include "h248.h"
+#include "h6515.h"
+#include "h5349.h"
+int main_1573() { return 0; }
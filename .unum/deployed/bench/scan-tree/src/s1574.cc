@@ -0,0 +1,6 @@
+#include "h7847.h"
+#include "h2357.h"
+#include "h5841.h"
+#include "h9207.h"
+#include "h208.h"
+int main_1574() { return 0; }
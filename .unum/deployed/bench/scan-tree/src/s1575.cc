@@ -0,0 +1,9 @@
+#include "h8030.h"
+#include "h6768.h"
+#include "h9896.h"
+#include "h2070.h"
+#include "h855.h"
+#if 0
+#include "h6067.h"
+#endif
+int main_1575() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1738.h"
+#include "h4703.h"
+#include "h6117.h"
+#include "h7211.h"
+#include "h4050.h"
+int main_1576() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7239.h"
+#include "h2788.h"
+#include "h8762.h"
+#include "h4792.h"
+#include "h1756.h"
+int main_1577() { return 0; }
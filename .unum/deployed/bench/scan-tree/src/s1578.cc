@@ -0,0 +1,6 @@
+#include "h819.h"
+#include "h2456.h"
+#include "h8861.h"
+#include "h6150.h"
+#include "h138.h"
+int main_1578() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2782.h"
+#include "h6982.h"
+#include "h5998.h"
+#include "h3557.h"
+#include "h4633.h"
+int main_1579() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9866.h"
+#include "h4971.h"
+#include "h8249.h"
+#include "h2130.h"
+#include "h3079.h"
+int main_158() { return 0; }
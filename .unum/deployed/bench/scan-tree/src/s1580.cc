@@ -0,0 +1,9 @@
+#include "h8403.h"
+#include "h3926.h"
+#include "h8806.h"
+#include "h3691.h"
+#include "h453.h"
+#if 0
+#include "h9134.h"
+#endif
+int main_1580() { return 0; }
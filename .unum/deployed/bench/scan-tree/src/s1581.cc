@@ -0,0 +1,6 @@
+#include "h6980.h"
+#include "h8456.h"
+#include "h4019.h"
+#include "h2134.h"
+#include "h2212.h"
+int main_1581() { return 0; }
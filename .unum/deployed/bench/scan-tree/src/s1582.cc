@@ -0,0 +1,6 @@
+#include "h7620.h"
+#include "h4777.h"
+#include "h1189.h"
+#include "h4953.h"
+#include "h3008.h"
+int main_1582() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4637.h"
+#include "h9519.h"
+#include "h2013.h"
+#include "h9386.h"
+#include "h7518.h"
+int main_1583() { return 0; }
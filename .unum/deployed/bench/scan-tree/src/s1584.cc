@@ -0,0 +1,6 @@
+#include "h7243.h"
+#include "h4705.h"
+#include "h2318.h"
+#include "h845.h"
+#include "h4001.h"
+int main_1584() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2957.h"
+#include "h6732.h"
+#include "h1089.h"
+#include "h9673.h"
+#include "h4702.h"
+#if 0
+#include "h8541.h"
+#endif
+int main_1585() { return 0; }
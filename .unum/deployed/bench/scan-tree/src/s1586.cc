@@ -0,0 +1,6 @@
+#include "h8370.h"
+#include "h8747.h"
+#include "h1344.h"
+#include "h7322.h"
+#include "h8791.h"
+int main_1586() { return 0; }
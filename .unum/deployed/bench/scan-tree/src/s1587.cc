@@ -0,0 +1,6 @@
+#include "h6268.h"
+#include "h579.h"
+#include "h4136.h"
+#include "h4871.h"
+#include "h1160.h"
+int main_1587() { return 0; }
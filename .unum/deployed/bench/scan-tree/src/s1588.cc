@@ -0,0 +1,6 @@
+#include "h4731.h"
+#include "h2575.h"
+#include "h526.h"
+#include "h1374.h"
+#include "h5499.h"
+int main_1588() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4798.h"
+#include "h6218.h"
+#include "h2798.h"
+#include "h7570.h"
+#include "h430.h"
+int main_1589() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5932.h"
+#include "h6098.h"
+#include "h226.h"
+#include "h7919.h"
+#include "h7790.h"
+int main_159() { return 0; }
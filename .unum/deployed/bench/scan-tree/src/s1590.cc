@@ -0,0 +1,9 @@
+#include "h2346.h"
+#include "h2863.h"
+#include "h3766.h"
+#include "h2624.h"
+#include "h7475.h"
+#if 0
+#include "h9279.h"
+#endif
+int main_1590() { return 0; }
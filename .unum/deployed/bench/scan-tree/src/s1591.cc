@@ -0,0 +1,6 @@
+#include "h2234.h"
+#include "h3368.h"
+#include "h973.h"
+#include "h4654.h"
+#include "h815.h"
+int main_1591() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1465.h"
+#include "h4829.h"
+#include "h367.h"
+#include "h3141.h"
+#include "h7712.h"
+int main_1592() { return 0; }
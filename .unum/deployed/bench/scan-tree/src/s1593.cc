@@ -0,0 +1,6 @@
+#include "h9301.h"
+#include "h1910.h"
+#include "h9286.h"
+#include "h704.h"
+#include "h5826.h"
+int main_1593() { return 0; }
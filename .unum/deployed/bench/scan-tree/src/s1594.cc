@@ -0,0 +1,6 @@
+#include "h2687.h"
+#include "h1911.h"
+#include "h5788.h"
+#include "h6542.h"
+#include "h7004.h"
+int main_1594() { return 0; }
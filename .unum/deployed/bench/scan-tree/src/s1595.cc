@@ -0,0 +1,9 @@
+#include "h9674.h"
+#include "h4606.h"
+#include "h1885.h"
+#include "h4010.h"
+#include "h2556.h"
+#if 0
+#include "h4623.h"
+#endif
+int main_1595() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4544.h"
+#include "h1113.h"
+#include "h2845.h"
+#include "h9003.h"
+#include "h8269.h"
+int main_1596() { return 0; }
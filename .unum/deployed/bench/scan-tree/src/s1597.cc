@@ -0,0 +1,6 @@
+#include "h5429.h"
+#include "h2872.h"
+#include "h5248.h"
+#include "h7316.h"
+#include "h3358.h"
+int main_1597() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7838.h"
+#include "h4843.h"
+#include "h4000.h"
+#include "h6261.h"
+#include "h655.h"
+int main_1598() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2652.h"
+#include "h402.h"
+#include "h6958.h"
+#include "h8310.h"
+#include "h4529.h"
+int main_1599() { return 0; }
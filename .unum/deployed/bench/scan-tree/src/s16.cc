@@ -0,0 +1,6 @@
+#include "h7423.h"
+#include "h8949.h"
+#include "h3271.h"
+#include "h2401.h"
+#include "h8593.h"
+int main_16() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6806.h"
+#include "h322.h"
+#include "h3600.h"
+#include "h1463.h"
+#include "h1752.h"
+#if 0
+#include "h7459.h"
+#endif
+int main_160() { return 0; }
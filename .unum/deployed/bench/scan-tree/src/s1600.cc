@@ -0,0 +1,9 @@
+#include "h2278.h"
+#include "h7253.h"
+#include "h7565.h"
+#include "h9924.h"
+#include "h3282.h"
+#if 0
+#include "h4248.h"
+#endif
+int main_1600() { return 0; }
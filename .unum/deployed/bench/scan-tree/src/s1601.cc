@@ -0,0 +1,6 @@
+#include "h7476.h"
+#include "h638.h"
+#include "h5735.h"
+#include "h5130.h"
+#include "h6928.h"
+int main_1601() { return 0; }
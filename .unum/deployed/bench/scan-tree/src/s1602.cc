@@ -0,0 +1,6 @@
+#include "h3091.h"
+#include "h1898.h"
+#include "h7741.h"
+#include "h7037.h"
+#include "h1158.h"
+int main_1602() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9495.h"
+#include "h6387.h"
+#include "h5419.h"
+#include "h6430.h"
+#include "h7676.h"
+int main_1603() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1910.h"
+#include "h3324.h"
+#include "h5933.h"
+#include "h1700.h"
+#include "h3137.h"
+int main_1604() { return 0; }
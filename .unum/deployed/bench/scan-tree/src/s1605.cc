@@ -0,0 +1,9 @@
+#include "h1050.h"
+#include "h7347.h"
+#include "h964.h"
+#include "h6139.h"
+#include "h550.h"
+#if 0
+#include "h8404.h"
+#endif
+int main_1605() { return 0; }
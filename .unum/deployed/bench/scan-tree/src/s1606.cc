@@ -0,0 +1,6 @@
+#include "h934.h"
+#include "h2933.h"
+#include "h5841.h"
+#include "h1447.h"
+#include "h4539.h"
+int main_1606() { return 0; }
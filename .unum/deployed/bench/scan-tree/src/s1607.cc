@@ -0,0 +1,6 @@
+#include "h4999.h"
+#include "h1700.h"
+#include "h4045.h"
+#include "h6408.h"
+#include "h684.h"
+int main_1607() { return 0; }
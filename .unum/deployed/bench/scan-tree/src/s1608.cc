@@ -0,0 +1,6 @@
+#include "h846.h"
+#include "h9771.h"
+#include "h4266.h"
+#include "h1877.h"
+#include "h9010.h"
+int main_1608() { return 0; }
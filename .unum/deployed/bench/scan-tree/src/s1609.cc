@@ -0,0 +1,6 @@
+#include "h7424.h"
+#include "h131.h"
+#include "h4465.h"
+#include "h2155.h"
+#include "h3163.h"
+int main_1609() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5153.h"
+#include "h6593.h"
+#include "h3785.h"
+#include "h4803.h"
+#include "h7526.h"
+int main_161() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2686.h"
+#include "h9590.h"
+#include "h6946.h"
+#include "h8427.h"
+#include "h1903.h"
+#if 0
+#include "h3830.h"
+#endif
+int main_1610() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4959.h"
+#include "h6162.h"
+#include "h1471.h"
+#include "h4696.h"
+#include "h9818.h"
+int main_1611() { return 0; }
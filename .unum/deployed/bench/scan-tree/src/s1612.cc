@@ -0,0 +1,6 @@
+#include "h6672.h"
+#include "h2808.h"
+#include "h4598.h"
+#include "h83.h"
+#include "h7069.h"
+int main_1612() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6453.h"
+#include "h945.h"
+#include "h7657.h"
+#include "h8891.h"
+#include "h9424.h"
+int main_1613() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7362.h"
+#include "h3874.h"
+#include "h1645.h"
+#include "h5052.h"
+#include "h9321.h"
+int main_1614() { return 0; }
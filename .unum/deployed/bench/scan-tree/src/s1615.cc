@@ -0,0 +1,9 @@
+#include "h615.h"
+#include "h1111.h"
+#include "h1126.h"
+#include "h2332.h"
+#include "h6575.h"
+#if 0
+#include "h2503.h"
+#endif
+int main_1615() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2948.h"
+#include "h8614.h"
+#include "h9242.h"
+#include "h4034.h"
+#include "h8827.h"
+int main_1616() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6818.h"
+#include "h11.h"
+#include "h7271.h"
+#include "h8600.h"
+#include "h6845.h"
+int main_1617() { return 0; }
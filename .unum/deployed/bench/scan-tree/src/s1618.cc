@@ -0,0 +1,6 @@
+#include "h7185.h"
+#include "h5438.h"
+#include "h7144.h"
+#include "h2510.h"
+#include "h565.h"
+int main_1618() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1105.h"
+#include "h8179.h"
+#include "h3202.h"
+#include "h7566.h"
+#include "h638.h"
+int main_1619() { return 0; }
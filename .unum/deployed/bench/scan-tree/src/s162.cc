@@ -0,0 +1,6 @@
+#include "h6242.h"
+#include "h2998.h"
+#include "h7103.h"
+#include "h8926.h"
+#include "h2290.h"
+int main_162() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7743.h"
+#include "h8773.h"
+#include "h7700.h"
+#include "h9802.h"
+#include "h5862.h"
+#if 0
+#include "h9554.h"
+#endif
+int main_1620() { return 0; }
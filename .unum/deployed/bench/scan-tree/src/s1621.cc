@@ -0,0 +1,6 @@
+#include "h7980.h"
+#include "h1025.h"
+#include "h8538.h"
+#include "h3891.h"
+#include "h2087.h"
+int main_1621() { return 0; }
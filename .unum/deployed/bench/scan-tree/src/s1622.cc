@@ -0,0 +1,6 @@
+#include "h2314.h"
+#include "h2232.h"
+#include "h3053.h"
+#include "h6408.h"
+#include "h4012.h"
+int main_1622() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5152.h"
+#include "h6192.h"
+#include "h9722.h"
+#include "h9537.h"
+#include "h9914.h"
+int main_1623() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1935.h"
+#include "h4525.h"
+#include "h590.h"
+#include "h1592.h"
+#include "h7979.h"
+int main_1624() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5827.h"
+#include "h3664.h"
+#include "h709.h"
+#include "h4419.h"
+#include "h693.h"
+#if 0
+#include "h3482.h"
+#endif
+int main_1625() { return 0; }
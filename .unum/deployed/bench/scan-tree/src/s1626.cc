@@ -0,0 +1,6 @@
+#include "h4729.h"
+#include "h3034.h"
+#include "h9468.h"
+#include "h6287.h"
+#include "h9494.h"
+int main_1626() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3425.h"
+#include "h6326.h"
+#include "h810.h"
+#include "h8303.h"
+#include "h1782.h"
+int main_1627() { return 0; }
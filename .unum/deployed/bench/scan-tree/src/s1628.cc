@@ -0,0 +1,6 @@
+#include "h480.h"
+#include "h908.h"
+#include "h6410.h"
+#include "h5087.h"
+#include "h4930.h"
+int main_1628() { return 0; }
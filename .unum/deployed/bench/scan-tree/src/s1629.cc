@@ -0,0 +1,6 @@
+#include "h4385.h"
+#include "h3947.h"
+#include "h5535.h"
+#include "h1116.h"
+#include "h3592.h"
+int main_1629() { return 0; }
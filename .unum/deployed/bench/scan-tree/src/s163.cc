@@ -0,0 +1,6 @@
+#include "h7400.h"
+#include "h6650.h"
+#include "h1891.h"
+#include "h8411.h"
+#include "h6818.h"
+int main_163() { return 0; }
@@ -0,0 +1,9 @@
+#include "h239.h"
+#include "h7724.h"
+#include "h511.h"
+#include "h5100.h"
+#include "h5118.h"
+#if 0
+#include "h4959.h"
+#endif
+int main_1630() { return 0; }
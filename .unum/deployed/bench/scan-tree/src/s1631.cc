@@ -0,0 +1,6 @@
+#include "h4224.h"
+#include "h4386.h"
+#include "h1221.h"
+#include "h4059.h"
+#include "h1806.h"
+int main_1631() { return 0; }
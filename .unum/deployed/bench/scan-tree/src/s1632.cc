@@ -0,0 +1,6 @@
+#include "h1252.h"
+#include "h1443.h"
+#include "h9445.h"
+#include "h7726.h"
+#include "h9388.h"
+int main_1632() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5770.h"
+#include "h8318.h"
+#include "h8589.h"
+#include "h5278.h"
+#include "h1420.h"
+int main_1633() { return 0; }
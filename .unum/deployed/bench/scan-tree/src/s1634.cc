@@ -0,0 +1,6 @@
+#include "h8320.h"
+#include "h8275.h"
+#include "h5355.h"
+#include "h5612.h"
+#include "h5581.h"
+int main_1634() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7513.h"
+#include "h7130.h"
+#include "h9083.h"
+#include "h3762.h"
+#include "h1282.h"
+#if 0
+#include "h3923.h"
+#endif
+int main_1635() { return 0; }
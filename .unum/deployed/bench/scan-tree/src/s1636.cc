@@ -0,0 +1,6 @@
+#include "h5705.h"
+#include "h7895.h"
+#include "h1307.h"
+#include "h1222.h"
+#include "h6315.h"
+int main_1636() { return 0; }
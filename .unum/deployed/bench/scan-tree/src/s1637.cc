@@ -0,0 +1,6 @@
+#include "h3984.h"
+#include "h3661.h"
+#include "h6142.h"
+#include "h3035.h"
+#include "h2602.h"
+int main_1637() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5555.h"
+#include "h1736.h"
+#include "h8454.h"
+#include "h7667.h"
+#include "h9155.h"
+int main_1638() { return 0; }
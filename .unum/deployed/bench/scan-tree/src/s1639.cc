@@ -0,0 +1,6 @@
+#include "h9771.h"
+#include "h4635.h"
+#include "h6121.h"
+#include "h321.h"
+#include "h861.h"
+int main_1639() { return 0; }
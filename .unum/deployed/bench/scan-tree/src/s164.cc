@@ -0,0 +1,6 @@
+#include "h151.h"
+#include "h8880.h"
+#include "h7209.h"
+#include "h3122.h"
+#include "h9857.h"
+int main_164() { return 0; }
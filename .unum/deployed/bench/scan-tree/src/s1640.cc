@@ -0,0 +1,9 @@
+#include "h1985.h"
+#include "h4483.h"
+#include "h92.h"
+#include "h4557.h"
+#include "h8774.h"
+#if 0
+#include "h7341.h"
+#endif
+int main_1640() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6211.h"
+#include "h7086.h"
+#include "h6115.h"
+#include "h460.h"
+#include "h2486.h"
+int main_1641() { return 0; }
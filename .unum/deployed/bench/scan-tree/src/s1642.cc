@@ -0,0 +1,6 @@
+#include "h4314.h"
+#include "h9310.h"
+#include "h1319.h"
+#include "h9798.h"
+#include "h2478.h"
+int main_1642() { return 0; }
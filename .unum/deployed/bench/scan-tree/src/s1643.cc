@@ -0,0 +1,6 @@
+#include "h5589.h"
+#include "h3043.h"
+#include "h6657.h"
+#include "h414.h"
+#include "h6699.h"
+int main_1643() { return 0; }
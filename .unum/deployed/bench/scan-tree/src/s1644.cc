@@ -0,0 +1,6 @@
+#include "h2278.h"
+#include "h428.h"
+#include "h780.h"
+#include "h5472.h"
+#include "h7817.h"
+int main_1644() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3425.h"
+#include "h3184.h"
+#include "h5712.h"
+#include "h5695.h"
+#include "h1930.h"
+#if 0
+#include "h2127.h"
+#endif
+int main_1645() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7158.h"
+#include "h186.h"
+#include "h5951.h"
+#include "h7604.h"
+#include "h4374.h"
+int main_1646() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5339.h"
+#include "h8052.h"
+#include "h8062.h"
+#include "h2428.h"
+#include "h109.h"
+int main_1647() { return 0; }
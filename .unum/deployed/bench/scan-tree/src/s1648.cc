@@ -0,0 +1,6 @@
+#include "h3333.h"
+#include "h3708.h"
+#include "h7065.h"
+#include "h7796.h"
+#include "h6411.h"
+int main_1648() { return 0; }
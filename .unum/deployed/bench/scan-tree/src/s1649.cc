@@ -0,0 +1,6 @@
+#include "h6851.h"
+#include "h1038.h"
+#include "h9708.h"
+#include "h9780.h"
+#include "h1445.h"
+int main_1649() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2811.h"
+#include "h3545.h"
+#include "h257.h"
+#include "h6592.h"
+#include "h893.h"
+#if 0
+#include "h5165.h"
+#endif
+int main_165() { return 0; }
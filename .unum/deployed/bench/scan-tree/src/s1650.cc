@@ -0,0 +1,9 @@
+#include "h7305.h"
+#include "h2505.h"
+#include "h2030.h"
+#include "h886.h"
+#include "h1396.h"
+#if 0
+#include "h8255.h"
+#endif
+int main_1650() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4273.h"
+#include "h8867.h"
+#include "h8622.h"
+#include "h6063.h"
+#include "h6997.h"
+int main_1651() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8922.h"
+#include "h3966.h"
+#include "h6947.h"
+#include "h7368.h"
+#include "h4520.h"
+int main_1652() { return 0; }
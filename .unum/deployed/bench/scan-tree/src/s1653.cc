@@ -0,0 +1,6 @@
+#include "h7250.h"
+#include "h5606.h"
+#include "h5573.h"
+#include "h4094.h"
+#include "h262.h"
+int main_1653() { return 0; }
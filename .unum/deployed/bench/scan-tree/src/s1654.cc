@@ -0,0 +1,6 @@
+#include "h2977.h"
+#include "h2866.h"
+#include "h2343.h"
+#include "h3295.h"
+#include "h3473.h"
+int main_1654() { return 0; }
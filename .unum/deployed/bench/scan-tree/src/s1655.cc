@@ -0,0 +1,9 @@
+#include "h615.h"
+#include "h5908.h"
+#include "h7762.h"
+#include "h9940.h"
+#include "h7188.h"
+#if 0
+#include "h4996.h"
+#endif
+int main_1655() { return 0; }
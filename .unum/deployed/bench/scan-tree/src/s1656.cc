@@ -0,0 +1,6 @@
+#include "h5673.h"
+#include "h2028.h"
+#include "h1295.h"
+#include "h3859.h"
+#include "h7774.h"
+int main_1656() { return 0; }
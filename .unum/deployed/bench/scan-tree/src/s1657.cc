@@ -0,0 +1,6 @@
+#include "h5919.h"
+#include "h7953.h"
+#include "h259.h"
+#include "h8669.h"
+#include "h3906.h"
+int main_1657() { return 0; }
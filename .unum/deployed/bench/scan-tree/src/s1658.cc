@@ -0,0 +1,6 @@
+#include "h7388.h"
+#include "h1430.h"
+#include "h8741.h"
+#include "h8379.h"
+#include "h6814.h"
+int main_1658() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9546.h"
+#include "h7896.h"
+#include "h122.h"
+#include "h657.h"
+#include "h4285.h"
+int main_1659() { return 0; }
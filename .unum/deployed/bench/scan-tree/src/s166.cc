@@ -0,0 +1,6 @@
+#include "h7697.h"
+#include "h3906.h"
+#include "h3549.h"
+#include "h9457.h"
+#include "h6537.h"
+int main_166() { return 0; }
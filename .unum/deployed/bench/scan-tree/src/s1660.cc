@@ -0,0 +1,9 @@
+#include "h1830.h"
+#include "h2650.h"
+#include "h4105.h"
+#include "h9031.h"
+#include "h4572.h"
+#if 0
+#include "h8668.h"
+#endif
+int main_1660() { return 0; }
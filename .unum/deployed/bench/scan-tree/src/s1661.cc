@@ -0,0 +1,6 @@
+#include "h305.h"
+#include "h1332.h"
+#include "h440.h"
+#include "h8832.h"
+#include "h341.h"
+int main_1661() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7997.h"
+#include "h751.h"
+#include "h870.h"
+#include "h2145.h"
+#include "h1051.h"
+int main_1662() { return 0; }
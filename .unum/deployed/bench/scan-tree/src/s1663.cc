@@ -0,0 +1,6 @@
+#include "h3312.h"
+#include "h3855.h"
+#include "h9681.h"
+#include "h4969.h"
+#include "h9858.h"
+int main_1663() { return 0; }
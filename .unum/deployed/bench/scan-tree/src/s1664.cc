@@ -0,0 +1,6 @@
+#include "h3835.h"
+#include "h1712.h"
+#include "h9651.h"
+#include "h4182.h"
+#include "h4572.h"
+int main_1664() { return 0; }
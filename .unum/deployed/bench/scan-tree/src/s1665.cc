@@ -0,0 +1,9 @@
+#include "h6016.h"
+#include "h6644.h"
+#include "h6814.h"
+#include "h4033.h"
+#include "h5930.h"
+#if 0
+#include "h3939.h"
+#endif
+int main_1665() { return 0; }
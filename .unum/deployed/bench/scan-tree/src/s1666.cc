@@ -0,0 +1,6 @@
+#include "h5260.h"
+#include "h9120.h"
+#include "h1343.h"
+#include "h3634.h"
+#include "h9398.h"
+int main_1666() { return 0; }
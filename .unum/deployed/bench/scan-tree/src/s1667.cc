@@ -0,0 +1,6 @@
+#include "h9067.h"
+#include "h1696.h"
+#include "h8352.h"
+#include "h7988.h"
+#include "h2292.h"
+int main_1667() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2114.h"
+#include "h9950.h"
+#include "h5375.h"
+#include "h9369.h"
+#include "h9901.h"
+int main_1668() { return 0; }
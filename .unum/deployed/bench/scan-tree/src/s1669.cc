@@ -0,0 +1,6 @@
+#include "h242.h"
+#include "h2998.h"
+#include "h4737.h"
+#include "h9334.h"
+#include "h3586.h"
+int main_1669() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7137.h"
+#include "h5139.h"
+#include "h2019.h"
+#include "h764.h"
+#include "h4898.h"
+int main_167() { return 0; }
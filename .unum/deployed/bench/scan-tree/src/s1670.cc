@@ -0,0 +1,9 @@
+#include "h6678.h"
+#include "h2287.h"
+#include "h9696.h"
+#include "h4607.h"
+#include "h7048.h"
+#if 0
+#include "h4524.h"
+#endif
+int main_1670() { return 0; }
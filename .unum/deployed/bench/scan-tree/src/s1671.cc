@@ -0,0 +1,6 @@
+#include "h7179.h"
+#include "h5352.h"
+#include "h9205.h"
+#include "h1034.h"
+#include "h8786.h"
+int main_1671() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1004.h"
+#include "h351.h"
+#include "h490.h"
+#include "h1104.h"
+#include "h1926.h"
+int main_1672() { return 0; }
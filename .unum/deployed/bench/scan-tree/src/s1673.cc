@@ -0,0 +1,6 @@
+#include "h9725.h"
+#include "h7669.h"
+#include "h2107.h"
+#include "h1879.h"
+#include "h345.h"
+int main_1673() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4728.h"
+#include "h5309.h"
+#include "h9596.h"
+#include "h8276.h"
+#include "h5358.h"
+int main_1674() { return 0; }
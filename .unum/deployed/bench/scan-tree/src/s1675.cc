@@ -0,0 +1,9 @@
+#include "h9639.h"
+#include "h9603.h"
+#include "h5540.h"
+#include "h7168.h"
+#include "h5998.h"
+#if 0
+#include "h5311.h"
+#endif
+int main_1675() { return 0; }
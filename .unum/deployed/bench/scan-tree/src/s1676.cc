@@ -0,0 +1,6 @@
+#include "h3142.h"
+#include "h859.h"
+#include "h9510.h"
+#include "h2343.h"
+#include "h927.h"
+int main_1676() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4470.h"
+#include "h6533.h"
+#include "h7513.h"
+#include "h4249.h"
+#include "h5790.h"
+int main_1677() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8952.h"
+#include "h2923.h"
+#include "h3203.h"
+#include "h959.h"
+#include "h4839.h"
+int main_1678() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8181.h"
+#include "h12.h"
+#include "h4726.h"
+#include "h8890.h"
+#include "h8695.h"
+int main_1679() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8241.h"
+#include "h3930.h"
+#include "h3555.h"
+#include "h1077.h"
+#include "h65.h"
+int main_168() { return 0; }
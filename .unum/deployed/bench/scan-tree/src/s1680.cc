@@ -0,0 +1,9 @@
+#include "h8149.h"
+#include "h7168.h"
+#include "h1427.h"
+#include "h7523.h"
+#include "h4041.h"
+#if 0
+#include "h2672.h"
+#endif
+int main_1680() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9806.h"
+#include "h4610.h"
+#include "h346.h"
+#include "h8618.h"
+#include "h6395.h"
+int main_1681() { return 0; }
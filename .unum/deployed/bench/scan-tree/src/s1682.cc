@@ -0,0 +1,6 @@
+#include "h315.h"
+#include "h2785.h"
+#include "h8422.h"
+#include "h7657.h"
+#include "h8128.h"
+int main_1682() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4126.h"
+#include "h8170.h"
+#include "h5750.h"
+#include "h1740.h"
+#include "h9684.h"
+int main_1683() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2663.h"
+#include "h5581.h"
+#include "h6893.h"
+#include "h5860.h"
+#include "h9298.h"
+int main_1684() { return 0; }
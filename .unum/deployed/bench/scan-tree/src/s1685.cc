@@ -0,0 +1,9 @@
+#include "h5062.h"
+#include "h4051.h"
+#include "h1997.h"
+#include "h5302.h"
+#include "h3061.h"
+#if 0
+#include "h6060.h"
+#endif
+int main_1685() { return 0; }
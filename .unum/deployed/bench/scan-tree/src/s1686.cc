@@ -0,0 +1,6 @@
+#include "h8105.h"
+#include "h8139.h"
+#include "h4583.h"
+#include "h673.h"
+#include "h7519.h"
+int main_1686() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3711.h"
+#include "h3964.h"
+#include "h5169.h"
+#include "h357.h"
+#include "h240.h"
+int main_1687() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6537.h"
+#include "h1700.h"
+#include "h1084.h"
+#include "h5255.h"
+#include "h2798.h"
+int main_1688() { return 0; }
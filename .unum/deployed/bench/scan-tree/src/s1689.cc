@@ -0,0 +1,6 @@
+#include "h8314.h"
+#include "h5691.h"
+#include "h6714.h"
+#include "h3806.h"
+#include "h9652.h"
+int main_1689() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3733.h"
+#include "h9357.h"
+#include "h2305.h"
+#include "h8953.h"
+#include "h4762.h"
+int main_169() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8362.h"
+#include "h2637.h"
+#include "h2448.h"
+#include "h9235.h"
+#include "h9469.h"
+#if 0
+#include "h365.h"
+#endif
+int main_1690() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6575.h"
+#include "h5314.h"
+#include "h3043.h"
+#include "h9095.h"
+#include "h4187.h"
+int main_1691() { return 0; }
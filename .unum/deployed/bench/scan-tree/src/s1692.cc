@@ -0,0 +1,6 @@
+#include "h94.h"
+#include "h9382.h"
+#include "h7120.h"
+#include "h8860.h"
+#include "h4821.h"
+int main_1692() { return 0; }
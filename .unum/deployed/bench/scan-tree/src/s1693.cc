@@ -0,0 +1,6 @@
+#include "h6300.h"
+#include "h599.h"
+#include "h7209.h"
+#include "h9526.h"
+#include "h1436.h"
+int main_1693() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2418.h"
+#include "h1019.h"
+#include "h842.h"
+#include "h6209.h"
+#include "h381.h"
+int main_1694() { return 0; }
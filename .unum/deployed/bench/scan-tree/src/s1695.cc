@@ -0,0 +1,9 @@
+#include "h5643.h"
+#include "h2679.h"
+#include "h9641.h"
+#include "h4901.h"
+#include "h709.h"
+#if 0
+#include "h7993.h"
+#endif
+int main_1695() { return 0; }
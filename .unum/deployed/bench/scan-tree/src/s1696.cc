@@ -0,0 +1,6 @@
+#include "h1231.h"
+#include "h6904.h"
+#include "h5540.h"
+#include "h9152.h"
+#include "h1478.h"
+int main_1696() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9008.h"
+#include "h5423.h"
+#include "h1088.h"
+#include "h1108.h"
+#include "h1158.h"
+int main_1697() { return 0; }
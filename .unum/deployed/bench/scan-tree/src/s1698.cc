@@ -0,0 +1,6 @@
+#include "h9528.h"
+#include "h1591.h"
+#include "h4188.h"
+#include "h2666.h"
+#include "h2444.h"
+int main_1698() { return 0; }
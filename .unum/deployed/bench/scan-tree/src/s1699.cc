@@ -0,0 +1,6 @@
+#include "h2441.h"
+#include "h1822.h"
+#include "h1168.h"
+#include "h235.h"
+#include "h8829.h"
+int main_1699() { return 0; }
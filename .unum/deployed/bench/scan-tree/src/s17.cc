@@ -0,0 +1,6 @@
+#include "h6352.h"
+#include "h6942.h"
+#include "h5367.h"
+#include "h1769.h"
+#include "h1737.h"
+int main_17() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7424.h"
+#include "h2598.h"
+#include "h8175.h"
+#include "h399.h"
+#include "h657.h"
+#if 0
+#include "h1453.h"
+#endif
+int main_170() { return 0; }
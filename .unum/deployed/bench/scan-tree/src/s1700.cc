@@ -0,0 +1,9 @@
+#include "h8823.h"
+#include "h3962.h"
+#include "h4497.h"
+#include "h4650.h"
+#include "h5283.h"
+#if 0
+#include "h1040.h"
+#endif
+int main_1700() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4180.h"
+#include "h3069.h"
+#include "h1280.h"
+#include "h726.h"
+#include "h4298.h"
+int main_1701() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4723.h"
+#include "h4023.h"
+#include "h7591.h"
+#include "h8251.h"
+#include "h3925.h"
+int main_1702() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7571.h"
+#include "h2654.h"
+#include "h3541.h"
+#include "h6482.h"
+#include "h9123.h"
+int main_1703() { return 0; }
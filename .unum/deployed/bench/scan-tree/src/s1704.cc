@@ -0,0 +1,6 @@
+#include "h2193.h"
+#include "h2788.h"
+#include "h44.h"
+#include "h401.h"
+#include "h2470.h"
+int main_1704() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2851.h"
+#include "h9377.h"
+#include "h8250.h"
+#include "h345.h"
+#include "h7110.h"
+#if 0
+#include "h4963.h"
+#endif
+int main_1705() { return 0; }
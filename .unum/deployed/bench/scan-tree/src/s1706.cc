@@ -0,0 +1,6 @@
+#include "h3850.h"
+#include "h4047.h"
+#include "h2484.h"
+#include "h4236.h"
+#include "h6106.h"
+int main_1706() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1175.h"
+#include "h5201.h"
+#include "h4765.h"
+#include "h7786.h"
+#include "h8544.h"
+int main_1707() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5460.h"
+#include "h9653.h"
+#include "h1972.h"
+#include "h8243.h"
+#include "h495.h"
+int main_1708() { return 0; }
@@ -0,0 +1,6 @@
+#include "h609.h"
+#include "h2266.h"
+#include "h7112.h"
+#include "h6268.h"
+#include "h502.h"
+int main_1709() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7064.h"
+#include "h5776.h"
+#include "h2787.h"
+#include "h6160.h"
+#include "h6981.h"
+int main_171() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5668.h"
+#include "h4508.h"
+#include "h535.h"
+#include "h7084.h"
+#include "h6956.h"
+#if 0
+#include "h4480.h"
+#endif
+int main_1710() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2420.h"
+#include "h2778.h"
+#include "h557.h"
+#include "h9976.h"
+#include "h7904.h"
+int main_1711() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4340.h"
+#include "h1771.h"
+#include "h4009.h"
+#include "h8011.h"
+#include "h432.h"
+int main_1712() { return 0; }
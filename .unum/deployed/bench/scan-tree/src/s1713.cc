@@ -0,0 +1,6 @@
+#include "h825.h"
+#include "h5150.h"
+#include "h5705.h"
+#include "h1848.h"
+#include "h3237.h"
+int main_1713() { return 0; }
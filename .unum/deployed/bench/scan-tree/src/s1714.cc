@@ -0,0 +1,6 @@
+#include "h8889.h"
+#include "h1946.h"
+#include "h5610.h"
+#include "h3498.h"
+#include "h1717.h"
+int main_1714() { return 0; }
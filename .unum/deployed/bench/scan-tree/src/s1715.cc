@@ -0,0 +1,9 @@
+#include "h6090.h"
+#include "h6057.h"
+#include "h9361.h"
+#include "h5725.h"
+#include "h8019.h"
+#if 0
+#include "h9879.h"
+#endif
+int main_1715() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2459.h"
+#include "h4024.h"
+#include "h8980.h"
+#include "h1114.h"
+#include "h3530.h"
+int main_1716() { return 0; }
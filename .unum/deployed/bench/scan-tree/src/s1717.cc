@@ -0,0 +1,6 @@
+#include "h751.h"
+#include "h6089.h"
+#include "h7201.h"
+#include "h4127.h"
+#include "h9428.h"
+int main_1717() { return 0; }
@@ -0,0 +1,6 @@
+#include "h605.h"
+#include "h5046.h"
+#include "h8367.h"
+#include "h7464.h"
+#include "h7463.h"
+int main_1718() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9981.h"
+#include "h8317.h"
+#include "h9180.h"
+#include "h7673.h"
+#include "h3124.h"
+int main_1719() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2549.h"
+#include "h7662.h"
+#include "h1192.h"
+#include "h5334.h"
+#include "h5078.h"
+int main_172() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9653.h"
+#include "h5213.h"
+#include "h8056.h"
+#include "h3111.h"
+#include "h7809.h"
+#if 0
+#include "h5001.h"
+#endif
+int main_1720() { return 0; }
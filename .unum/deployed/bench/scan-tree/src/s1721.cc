@@ -0,0 +1,6 @@
+#include "h1663.h"
+#include "h1019.h"
+#include "h5822.h"
+#include "h7732.h"
+#include "h454.h"
+int main_1721() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9830.h"
+#include "h7666.h"
+#include "h7571.h"
+#include "h6785.h"
+#include "h9056.h"
+int main_1722() { return 0; }
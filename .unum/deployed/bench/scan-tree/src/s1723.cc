@@ -0,0 +1,6 @@
+#include "h2622.h"
+#include "h5220.h"
+#include "h9348.h"
+#include "h376.h"
+#include "h6738.h"
+int main_1723() { return 0; }
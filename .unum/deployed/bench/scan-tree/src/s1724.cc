@@ -0,0 +1,6 @@
+#include "h7702.h"
+#include "h8567.h"
+#include "h4330.h"
+#include "h4687.h"
+#include "h9878.h"
+int main_1724() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3947.h"
+#include "h6679.h"
+#include "h1116.h"
+#include "h7940.h"
+#include "h6879.h"
+#if 0
+#include "h9872.h"
+#endif
+int main_1725() { return 0; }
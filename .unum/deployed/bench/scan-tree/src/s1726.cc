@@ -0,0 +1,6 @@
+#include "h1378.h"
+#include "h661.h"
+#include "h1771.h"
+#include "h8224.h"
+#include "h9155.h"
+int main_1726() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9130.h"
+#include "h5797.h"
+#include "h2405.h"
+#include "h4537.h"
+#include "h8363.h"
+int main_1727() { return 0; }
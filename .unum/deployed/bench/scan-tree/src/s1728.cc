@@ -0,0 +1,6 @@
+#include "h5706.h"
+#include "h1785.h"
+#include "h258.h"
+#include "h2257.h"
+#include "h1140.h"
+int main_1728() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6819.h"
+#include "h4799.h"
+#include "h5764.h"
+#include "h2255.h"
+#include "h714.h"
+int main_1729() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3205.h"
+#include "h1842.h"
+#include "h9940.h"
+#include "h6651.h"
+#include "h6842.h"
+int main_173() { return 0; }
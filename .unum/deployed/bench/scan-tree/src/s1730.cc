@@ -0,0 +1,9 @@
+#include "h7412.h"
+#include "h5551.h"
+#include "h5974.h"
+#include "h7153.h"
+#include "h7267.h"
+#if 0
+#include "h1136.h"
+#endif
+int main_1730() { return 0; }
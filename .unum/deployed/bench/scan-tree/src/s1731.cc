@@ -0,0 +1,6 @@
+#include "h9750.h"
+#include "h6103.h"
+#include "h8539.h"
+#include "h623.h"
+#include "h2388.h"
+int main_1731() { return 0; }
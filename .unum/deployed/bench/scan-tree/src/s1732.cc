@@ -0,0 +1,6 @@
+#include "h7465.h"
+#include "h7341.h"
+#include "h438.h"
+#include "h5465.h"
+#include "h8973.h"
+int main_1732() { return 0; }
@@ -0,0 +1,6 @@
+#include "h572.h"
+#include "h8074.h"
+#include "h2989.h"
+#include "h5351.h"
+#include "h3584.h"
+int main_1733() { return 0; }
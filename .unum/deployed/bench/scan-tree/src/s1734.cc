@@ -0,0 +1,6 @@
+#include "h4725.h"
+#include "h3650.h"
+#include "h1304.h"
+#include "h9580.h"
+#include "h1809.h"
+int main_1734() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6100.h"
+#include "h1786.h"
+#include "h6079.h"
+#include "h8072.h"
+#include "h6335.h"
+#if 0
+#include "h4178.h"
+#endif
+int main_1735() { return 0; }
@@ -0,0 +1,6 @@
+#include "h350.h"
+#include "h7180.h"
+#include "h1403.h"
+#include "h2070.h"
+#include "h6620.h"
+int main_1736() { return 0; }
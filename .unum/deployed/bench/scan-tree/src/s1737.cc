@@ -0,0 +1,6 @@
+#include "h3241.h"
+#include "h1642.h"
+#include "h3614.h"
+#include "h8537.h"
+#include "h8732.h"
+int main_1737() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8320.h"
+#include "h6768.h"
+#include "h9534.h"
+#include "h4623.h"
+#include "h3755.h"
+int main_1738() { return 0; }
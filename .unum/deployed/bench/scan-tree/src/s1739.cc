@@ -0,0 +1,6 @@
+#include "h8064.h"
+#include "h7264.h"
+#include "h919.h"
+#include "h3261.h"
+#include "h2588.h"
+int main_1739() { return 0; }
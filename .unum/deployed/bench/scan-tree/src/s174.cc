@@ -0,0 +1,6 @@
+#include "h1614.h"
+#include "h9573.h"
+#include "h5248.h"
+#include "h7850.h"
+#include "h5288.h"
+int main_174() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4547.h"
+#include "h2562.h"
+#include "h8265.h"
+#include "h6217.h"
+#include "h7269.h"
+#if 0
+#include "h8514.h"
+#endif
+int main_1740() { return 0; }
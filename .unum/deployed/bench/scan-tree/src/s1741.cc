@@ -0,0 +1,6 @@
+#include "h6442.h"
+#include "h3666.h"
+#include "h3989.h"
+#include "h8247.h"
+#include "h5794.h"
+int main_1741() { return 0; }
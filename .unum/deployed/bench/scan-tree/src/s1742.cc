@@ -0,0 +1,6 @@
+#include "h7981.h"
+#include "h5641.h"
+#include "h9505.h"
+#include "h2488.h"
+#include "h5948.h"
+int main_1742() { return 0; }
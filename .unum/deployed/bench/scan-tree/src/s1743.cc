@@ -0,0 +1,6 @@
+#include "h8108.h"
+#include "h59.h"
+#include "h5125.h"
+#include "h3032.h"
+#include "h7445.h"
+int main_1743() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1722.h"
+#include "h601.h"
+#include "h6432.h"
+#include "h6760.h"
+#include "h8788.h"
+int main_1744() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7909.h"
+#include "h2408.h"
+#include "h4841.h"
+#include "h2416.h"
+#include "h8281.h"
+#if 0
+#include "h8443.h"
+#endif
+int main_1745() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4247.h"
+#include "h8114.h"
+#include "h2332.h"
+#include "h6140.h"
+#include "h6088.h"
+int main_1746() { return 0; }
@@ -0,0 +1,6 @@
+#include "h579.h"
+#include "h4135.h"
+#include "h7827.h"
+#include "h181.h"
+#include "h3094.h"
+int main_1747() { return 0; }
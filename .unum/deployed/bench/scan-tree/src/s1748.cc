@@ -0,0 +1,6 @@
+#include "h9686.h"
+#include "h321.h"
+#include "h5516.h"
+#include "h9442.h"
+#include "h1752.h"
+int main_1748() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3272.h"
+#include "h4877.h"
+#include "h9767.h"
+#include "h7663.h"
+#include "h3076.h"
+int main_1749() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2253.h"
+#include "h3704.h"
+#include "h8500.h"
+#include "h4893.h"
+#include "h617.h"
+#if 0
+#include "h5942.h"
+#endif
+int main_175() { return 0; }
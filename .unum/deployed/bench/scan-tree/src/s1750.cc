@@ -0,0 +1,9 @@
+#include "h3420.h"
+#include "h9433.h"
+#include "h8039.h"
+#include "h7504.h"
+#include "h9557.h"
+#if 0
+#include "h5310.h"
+#endif
+int main_1750() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8080.h"
+#include "h4456.h"
+#include "h2488.h"
+#include "h777.h"
+#include "h9019.h"
+int main_1751() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4671.h"
+#include "h6778.h"
+#include "h7935.h"
+#include "h8997.h"
+#include "h5118.h"
+int main_1752() { return 0; }
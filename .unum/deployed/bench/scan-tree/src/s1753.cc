@@ -0,0 +1,6 @@
+#include "h7753.h"
+#include "h3584.h"
+#include "h2138.h"
+#include "h6486.h"
+#include "h8347.h"
+int main_1753() { return 0; }
@@ -0,0 +1,6 @@
+#include "h564.h"
+#include "h5025.h"
+#include "h6116.h"
+#include "h6174.h"
+#include "h1255.h"
+int main_1754() { return 0; }
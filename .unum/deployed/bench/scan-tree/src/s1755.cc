@@ -0,0 +1,9 @@
+#include "h5883.h"
+#include "h3795.h"
+#include "h6781.h"
+#include "h1691.h"
+#include "h6172.h"
+#if 0
+#include "h216.h"
+#endif
+int main_1755() { return 0; }
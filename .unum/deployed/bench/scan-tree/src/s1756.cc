@@ -0,0 +1,6 @@
+#include "h8283.h"
+#include "h4865.h"
+#include "h6002.h"
+#include "h4265.h"
+#include "h7100.h"
+int main_1756() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3668.h"
+#include "h1410.h"
+#include "h6540.h"
+#include "h2532.h"
+#include "h6515.h"
+int main_1757() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7565.h"
+#include "h8890.h"
+#include "h1550.h"
+#include "h2986.h"
+#include "h3838.h"
+int main_1758() { return 0; }
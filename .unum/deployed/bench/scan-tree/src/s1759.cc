@@ -0,0 +1,6 @@
+#include "h7195.h"
+#include "h8146.h"
+#include "h2177.h"
+#include "h3407.h"
+#include "h2183.h"
+int main_1759() { return 0; }
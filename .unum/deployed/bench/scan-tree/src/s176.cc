@@ -0,0 +1,6 @@
+#include "h4559.h"
+#include "h9223.h"
+#include "h3168.h"
+#include "h6013.h"
+#include "h9953.h"
+int main_176() { return 0; }
@@ -0,0 +1,9 @@
+#include "h753.h"
+#include "h1045.h"
+#include "h4970.h"
+#include "h525.h"
+#include "h8101.h"
+#if 0
+#include "h1475.h"
+#endif
+int main_1760() { return 0; }
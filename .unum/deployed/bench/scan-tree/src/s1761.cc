@@ -0,0 +1,6 @@
+#include "h7051.h"
+#include "h4867.h"
+#include "h1780.h"
+#include "h565.h"
+#include "h6104.h"
+int main_1761() { return 0; }
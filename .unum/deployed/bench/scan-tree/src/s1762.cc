@@ -0,0 +1,6 @@
+#include "h6135.h"
+#include "h2176.h"
+#include "h9750.h"
+#include "h5974.h"
+#include "h7358.h"
+int main_1762() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3953.h"
+#include "h5164.h"
+#include "h455.h"
+#include "h2027.h"
+#include "h4576.h"
+int main_1763() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7178.h"
+#include "h240.h"
+#include "h6523.h"
+#include "h1248.h"
+#include "h2200.h"
+int main_1764() { return 0; }
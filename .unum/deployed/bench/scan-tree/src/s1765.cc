@@ -0,0 +1,9 @@
+#include "h4385.h"
+#include "h615.h"
+#include "h2425.h"
+#include "h1299.h"
+#include "h1201.h"
+#if 0
+#include "h7885.h"
+#endif
+int main_1765() { return 0; }
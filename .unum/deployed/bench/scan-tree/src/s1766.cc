@@ -0,0 +1,6 @@
+#include "h3898.h"
+#include "h1811.h"
+#include "h1909.h"
+#include "h3737.h"
+#include "h5883.h"
+int main_1766() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5876.h"
+#include "h9639.h"
+#include "h9114.h"
+#include "h8772.h"
+#include "h7471.h"
+int main_1767() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1699.h"
+#include "h7764.h"
+#include "h1610.h"
+#include "h5295.h"
+#include "h158.h"
+int main_1768() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9341.h"
+#include "h8578.h"
+#include "h9477.h"
+#include "h1243.h"
+#include "h5279.h"
+int main_1769() { return 0; }
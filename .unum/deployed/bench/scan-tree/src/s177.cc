@@ -0,0 +1,6 @@
+#include "h5124.h"
+#include "h2835.h"
+#include "h8755.h"
+#include "h5529.h"
+#include "h3749.h"
+int main_177() { return 0; }
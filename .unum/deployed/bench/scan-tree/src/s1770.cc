@@ -0,0 +1,9 @@
+#include "h5480.h"
+#include "h5174.h"
+#include "h3193.h"
+#include "h5125.h"
+#include "h9525.h"
+#if 0
+#include "h7505.h"
+#endif
+int main_1770() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6122.h"
+#include "h9603.h"
+#include "h557.h"
+#include "h6424.h"
+#include "h1291.h"
+int main_1771() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6256.h"
+#include "h6971.h"
+#include "h3591.h"
+#include "h3576.h"
+#include "h8517.h"
+int main_1772() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4763.h"
+#include "h9264.h"
+#include "h3807.h"
+#include "h4081.h"
+#include "h8166.h"
+int main_1773() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6392.h"
+#include "h3123.h"
+#include "h9511.h"
+#include "h2670.h"
+#include "h8456.h"
+int main_1774() { return 0; }
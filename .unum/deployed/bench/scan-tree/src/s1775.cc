@@ -0,0 +1,9 @@
+#include "h2319.h"
+#include "h9797.h"
+#include "h1389.h"
+#include "h6501.h"
+#include "h5010.h"
+#if 0
+#include "h380.h"
+#endif
+int main_1775() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8691.h"
+#include "h497.h"
+#include "h2102.h"
+#include "h5198.h"
+#include "h1148.h"
+int main_1776() { return 0; }
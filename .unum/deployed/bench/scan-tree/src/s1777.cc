@@ -0,0 +1,6 @@
+#include "h9642.h"
+#include "h7175.h"
+#include "h3533.h"
+#include "h5193.h"
+#include "h6978.h"
+int main_1777() { return 0; }
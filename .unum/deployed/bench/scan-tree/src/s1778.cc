@@ -0,0 +1,6 @@
+#include "h3626.h"
+#include "h7369.h"
+#include "h5428.h"
+#include "h4039.h"
+#include "h2247.h"
+int main_1778() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5646.h"
+#include "h8437.h"
+#include "h9648.h"
+#include "h3222.h"
+#include "h1609.h"
+int main_1779() { return 0; }
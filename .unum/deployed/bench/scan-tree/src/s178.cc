@@ -0,0 +1,6 @@
+#include "h6360.h"
+#include "h5779.h"
+#include "h9800.h"
+#include "h2042.h"
+#include "h589.h"
+int main_178() { return 0; }
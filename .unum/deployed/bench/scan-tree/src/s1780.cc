@@ -0,0 +1,9 @@
+#include "h6847.h"
+#include "h2246.h"
+#include "h8228.h"
+#include "h2884.h"
+#include "h3297.h"
+#if 0
+#include "h1930.h"
+#endif
+int main_1780() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5535.h"
+#include "h350.h"
+#include "h2721.h"
+#include "h2776.h"
+#include "h7089.h"
+int main_1781() { return 0; }
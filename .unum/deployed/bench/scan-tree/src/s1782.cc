@@ -0,0 +1,6 @@
+#include "h9694.h"
+#include "h7749.h"
+#include "h9835.h"
+#include "h264.h"
+#include "h5675.h"
+int main_1782() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2145.h"
+#include "h9940.h"
+#include "h9964.h"
+#include "h6284.h"
+#include "h2611.h"
+int main_1783() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7266.h"
+#include "h1033.h"
+#include "h6157.h"
+#include "h2453.h"
+#include "h9893.h"
+int main_1784() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5835.h"
+#include "h1353.h"
+#include "h6220.h"
+#include "h8974.h"
+#include "h7762.h"
+#if 0
+#include "h5778.h"
+#endif
+int main_1785() { return 0; }
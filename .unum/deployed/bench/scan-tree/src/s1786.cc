@@ -0,0 +1,6 @@
+#include "h1713.h"
+#include "h3537.h"
+#include "h6382.h"
+#include "h3536.h"
+#include "h4784.h"
+int main_1786() { return 0; }
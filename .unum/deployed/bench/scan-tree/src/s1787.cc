@@ -0,0 +1,6 @@
+#include "h4683.h"
+#include "h2380.h"
+#include "h3656.h"
+#include "h329.h"
+#include "h9306.h"
+int main_1787() { return 0; }
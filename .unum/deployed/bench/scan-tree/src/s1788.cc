@@ -0,0 +1,6 @@
+#include "h3577.h"
+#include "h9846.h"
+#include "h2719.h"
+#include "h9025.h"
+#include "h9630.h"
+int main_1788() { return 0; }
@@ -0,0 +1,6 @@
+#include "h880.h"
+#include "h9642.h"
+#include "h7559.h"
+#include "h6509.h"
+#include "h2190.h"
+int main_1789() { return 0; }
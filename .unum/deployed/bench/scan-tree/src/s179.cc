@@ -0,0 +1,6 @@
+#include "h9665.h"
+#include "h402.h"
+#include "h6453.h"
+#include "h7123.h"
+#include "h6201.h"
+int main_179() { return 0; }
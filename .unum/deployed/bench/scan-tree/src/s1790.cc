@@ -0,0 +1,9 @@
+#include "h3778.h"
+#include "h7156.h"
+#include "h6892.h"
+#include "h5501.h"
+#include "h7250.h"
+#if 0
+#include "h8764.h"
+#endif
+int main_1790() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9566.h"
+#include "h2547.h"
+#include "h5610.h"
+#include "h3619.h"
+#include "h5695.h"
+int main_1791() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7630.h"
+#include "h744.h"
+#include "h3070.h"
+#include "h6509.h"
+#include "h5907.h"
+int main_1792() { return 0; }
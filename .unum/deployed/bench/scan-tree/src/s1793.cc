@@ -0,0 +1,6 @@
+#include "h253.h"
+#include "h1421.h"
+#include "h8043.h"
+#include "h8903.h"
+#include "h2275.h"
+int main_1793() { return 0; }
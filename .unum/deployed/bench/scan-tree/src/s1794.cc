@@ -0,0 +1,6 @@
+#include "h8387.h"
+#include "h9005.h"
+#include "h8152.h"
+#include "h6223.h"
+#include "h3583.h"
+int main_1794() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1947.h"
+#include "h2841.h"
+#include "h5916.h"
+#include "h596.h"
+#include "h2986.h"
+#if 0
+#include "h1636.h"
+#endif
+int main_1795() { return 0; }
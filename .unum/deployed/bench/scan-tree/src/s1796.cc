@@ -0,0 +1,6 @@
+#include "h7319.h"
+#include "h7164.h"
+#include "h2722.h"
+#include "h7198.h"
+#include "h8395.h"
+int main_1796() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9560.h"
+#include "h9055.h"
+#include "h4719.h"
+#include "h3920.h"
+#include "h998.h"
+int main_1797() { return 0; }
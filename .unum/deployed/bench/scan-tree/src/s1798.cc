@@ -0,0 +1,6 @@
+#include "h9471.h"
+#include "h6970.h"
+#include "h113.h"
+#include "h2849.h"
+#include "h8060.h"
+int main_1798() { return 0; }
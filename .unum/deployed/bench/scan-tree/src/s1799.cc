@@ -0,0 +1,6 @@
+#include "h8992.h"
+#include "h7151.h"
+#include "h4325.h"
+#include "h2491.h"
+#include "h1380.h"
+int main_1799() { return 0; }
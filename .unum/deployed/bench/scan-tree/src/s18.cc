@@ -0,0 +1,6 @@
+#include "h6733.h"
+#include "h4476.h"
+#include "h7076.h"
+#include "h2517.h"
+#include "h2495.h"
+int main_18() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1634.h"
+#include "h6204.h"
+#include "h9060.h"
+#include "h3456.h"
+#include "h246.h"
+#if 0
+#include "h4679.h"
+#endif
+int main_180() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3313.h"
+#include "h8859.h"
+#include "h6875.h"
+#include "h3253.h"
+#include "h7491.h"
+#if 0
+#include "h5866.h"
+#endif
+int main_1800() { return 0; }
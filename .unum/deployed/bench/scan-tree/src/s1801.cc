@@ -0,0 +1,6 @@
+#include "h9457.h"
+#include "h874.h"
+#include "h6793.h"
+#include "h3753.h"
+#include "h35.h"
+int main_1801() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1281.h"
+#include "h8982.h"
+#include "h5763.h"
+#include "h1144.h"
+#include "h8444.h"
+int main_1802() { return 0; }
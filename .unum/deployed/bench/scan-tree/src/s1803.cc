@@ -0,0 +1,6 @@
+#include "h6712.h"
+#include "h761.h"
+#include "h8656.h"
+#include "h3507.h"
+#include "h2821.h"
+int main_1803() { return 0; }
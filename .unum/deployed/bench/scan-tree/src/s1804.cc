@@ -0,0 +1,6 @@
+#include "h5152.h"
+#include "h5931.h"
+#include "h893.h"
+#include "h3126.h"
+#include "h8131.h"
+int main_1804() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6669.h"
+#include "h8698.h"
+#include "h8185.h"
+#include "h1855.h"
+#include "h7359.h"
+#if 0
+#include "h7904.h"
+#endif
+int main_1805() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6821.h"
+#include "h7117.h"
+#include "h8571.h"
+#include "h2510.h"
+#include "h4763.h"
+int main_1806() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8781.h"
+#include "h5963.h"
+#include "h88.h"
+#include "h4997.h"
+#include "h2137.h"
+int main_1807() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3686.h"
+#include "h6594.h"
+#include "h2657.h"
+#include "h1923.h"
+#include "h6442.h"
+int main_1808() { return 0; }
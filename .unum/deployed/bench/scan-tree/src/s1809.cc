@@ -0,0 +1,6 @@
+#include "h9906.h"
+#include "h6161.h"
+#include "h8911.h"
+#include "h8220.h"
+#include "h4686.h"
+int main_1809() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8135.h"
+#include "h9613.h"
+#include "h8019.h"
+#include "h2221.h"
+#include "h9431.h"
+int main_181() { return 0; }
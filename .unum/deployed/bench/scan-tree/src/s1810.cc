@@ -0,0 +1,9 @@
+#include "h7659.h"
+#include "h9238.h"
+#include "h8083.h"
+#include "h7107.h"
+#include "h9969.h"
+#if 0
+#include "h4263.h"
+#endif
+int main_1810() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8737.h"
+#include "h213.h"
+#include "h3346.h"
+#include "h8293.h"
+#include "h842.h"
+int main_1811() { return 0; }
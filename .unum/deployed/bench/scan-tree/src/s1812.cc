@@ -0,0 +1,6 @@
+#include "h6558.h"
+#include "h6166.h"
+#include "h8141.h"
+#include "h5662.h"
+#include "h6378.h"
+int main_1812() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2421.h"
+#include "h8840.h"
+#include "h4402.h"
+#include "h6719.h"
+#include "h5441.h"
+int main_1813() { return 0; }
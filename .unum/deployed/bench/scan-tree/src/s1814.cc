@@ -0,0 +1,6 @@
+#include "h4176.h"
+#include "h3299.h"
+#include "h3043.h"
+#include "h8509.h"
+#include "h3511.h"
+int main_1814() { return 0; }
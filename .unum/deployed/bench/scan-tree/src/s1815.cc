@@ -0,0 +1,9 @@
+#include "h4575.h"
+#include "h221.h"
+#include "h724.h"
+#include "h3778.h"
+#include "h9696.h"
+#if 0
+#include "h626.h"
+#endif
+int main_1815() { return 0; }
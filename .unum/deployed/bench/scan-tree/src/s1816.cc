@@ -0,0 +1,6 @@
+#include "h6219.h"
+#include "h8443.h"
+#include "h2354.h"
+#include "h8350.h"
+#include "h9341.h"
+int main_1816() { return 0; }
@@ -0,0 +1,6 @@
+#include "h736.h"
+#include "h565.h"
+#include "h1793.h"
+#include "h640.h"
+#include "h671.h"
+int main_1817() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1352.h"
+#include "h9814.h"
+#include "h2992.h"
+#include "h9903.h"
+#include "h8879.h"
+int main_1818() { return 0; }
@@ -0,0 +1,6 @@
+#include "h280.h"
+#include "h4098.h"
+#include "h8059.h"
+#include "h7482.h"
+#include "h5985.h"
+int main_1819() { return 0; }
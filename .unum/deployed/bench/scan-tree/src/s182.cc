@@ -0,0 +1,6 @@
+#include "h4687.h"
+#include "h7924.h"
+#include "h5153.h"
+#include "h4426.h"
+#include "h380.h"
+int main_182() { return 0; }
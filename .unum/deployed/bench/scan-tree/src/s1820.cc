@@ -0,0 +1,9 @@
+#include "h5569.h"
+#include "h1300.h"
+#include "h441.h"
+#include "h2899.h"
+#include "h6641.h"
+#if 0
+#include "h5685.h"
+#endif
+int main_1820() { return 0; }
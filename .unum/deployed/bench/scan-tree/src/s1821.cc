@@ -0,0 +1,6 @@
+#include "h3682.h"
+#include "h2174.h"
+#include "h8724.h"
+#include "h1686.h"
+#include "h4390.h"
+int main_1821() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8709.h"
+#include "h1260.h"
+#include "h5426.h"
+#include "h8315.h"
+#include "h6878.h"
+int main_1822() { return 0; }
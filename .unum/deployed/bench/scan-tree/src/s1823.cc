@@ -0,0 +1,6 @@
+#include "h3222.h"
+#include "h9297.h"
+#include "h1332.h"
+#include "h891.h"
+#include "h4000.h"
+int main_1823() { return 0; }
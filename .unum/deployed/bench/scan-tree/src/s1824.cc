@@ -0,0 +1,6 @@
+#include "h3296.h"
+#include "h7601.h"
+#include "h3256.h"
+#include "h9159.h"
+#include "h2599.h"
+int main_1824() { return 0; }
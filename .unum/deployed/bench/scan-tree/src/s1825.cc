@@ -0,0 +1,9 @@
+#include "h6362.h"
+#include "h4824.h"
+#include "h9689.h"
+#include "h5444.h"
+#include "h5785.h"
+#if 0
+#include "h4562.h"
+#endif
+int main_1825() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9947.h"
+#include "h1714.h"
+#include "h4255.h"
+#include "h8682.h"
+#include "h7334.h"
+int main_1826() { return 0; }
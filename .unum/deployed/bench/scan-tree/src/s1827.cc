@@ -0,0 +1,6 @@
+#include "h7371.h"
+#include "h9196.h"
+#include "h9030.h"
+#include "h6378.h"
+#include "h6034.h"
+int main_1827() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3838.h"
+#include "h5092.h"
+#include "h7805.h"
+#include "h8812.h"
+#include "h9038.h"
+int main_1828() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4498.h"
+#include "h5422.h"
+#include "h9037.h"
+#include "h4072.h"
+#include "h5043.h"
+int main_1829() { return 0; }
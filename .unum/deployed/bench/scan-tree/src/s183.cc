@@ -0,0 +1,6 @@
+#include "h4404.h"
+#include "h5854.h"
+#include "h7541.h"
+#include "h5238.h"
+#include "h9596.h"
+int main_183() { return 0; }
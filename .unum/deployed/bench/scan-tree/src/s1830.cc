@@ -0,0 +1,9 @@
+#include "h9789.h"
+#include "h3123.h"
+#include "h4713.h"
+#include "h707.h"
+#include "h3588.h"
+#if 0
+#include "h9861.h"
+#endif
+int main_1830() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8724.h"
+#include "h62.h"
+#include "h6434.h"
+#include "h3836.h"
+#include "h1905.h"
+int main_1831() { return 0; }
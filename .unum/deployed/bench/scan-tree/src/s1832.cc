@@ -0,0 +1,6 @@
+#include "h3961.h"
+#include "h4634.h"
+#include "h378.h"
+#include "h5273.h"
+#include "h8060.h"
+int main_1832() { return 0; }
@@ -0,0 +1,6 @@
+#include "h397.h"
+#include "h911.h"
+#include "h1976.h"
+#include "h2789.h"
+#include "h8298.h"
+int main_1833() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2851.h"
+#include "h4596.h"
+#include "h8959.h"
+#include "h1213.h"
+#include "h2801.h"
+int main_1834() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6292.h"
+#include "h4192.h"
+#include "h7622.h"
+#include "h2061.h"
+#include "h6365.h"
+#if 0
+#include "h9935.h"
+#endif
+int main_1835() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7230.h"
+#include "h3478.h"
+#include "h2791.h"
+#include "h4618.h"
+#include "h4472.h"
+int main_1836() { return 0; }
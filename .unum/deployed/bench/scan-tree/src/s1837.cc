@@ -0,0 +1,6 @@
+#include "h5795.h"
+#include "h1075.h"
+#include "h2055.h"
+#include "h3083.h"
+#include "h4932.h"
+int main_1837() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9977.h"
+#include "h8981.h"
+#include "h7529.h"
+#include "h4604.h"
+#include "h4359.h"
+int main_1838() { return 0; }
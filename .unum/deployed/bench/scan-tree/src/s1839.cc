@@ -0,0 +1,6 @@
+#include "h1251.h"
+#include "h2361.h"
+#include "h6009.h"
+#include "h2164.h"
+#include "h4642.h"
+int main_1839() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3275.h"
+#include "h6268.h"
+#include "h3609.h"
+#include "h3461.h"
+#include "h9761.h"
+int main_184() { return 0; }
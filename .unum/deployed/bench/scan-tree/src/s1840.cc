@@ -0,0 +1,9 @@
+#include "h8731.h"
+#include "h2929.h"
+#include "h6539.h"
+#include "h4246.h"
+#include "h5031.h"
+#if 0
+#include "h210.h"
+#endif
+int main_1840() { return 0; }
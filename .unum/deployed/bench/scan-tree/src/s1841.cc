@@ -0,0 +1,6 @@
+#include "h903.h"
+#include "h2076.h"
+#include "h9672.h"
+#include "h1218.h"
+#include "h6861.h"
+int main_1841() { return 0; }
@@ -0,0 +1,6 @@
+#include "h710.h"
+#include "h7193.h"
+#include "h9595.h"
+#include "h8299.h"
+#include "h2281.h"
+int main_1842() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3566.h"
+#include "h9664.h"
+#include "h4585.h"
+#include "h9743.h"
+#include "h3225.h"
+int main_1843() { return 0; }
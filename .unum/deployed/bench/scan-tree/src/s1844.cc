@@ -0,0 +1,6 @@
+#include "h9057.h"
+#include "h3684.h"
+#include "h1859.h"
+#include "h717.h"
+#include "h8471.h"
+int main_1844() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7510.h"
+#include "h556.h"
+#include "h7717.h"
+#include "h1249.h"
+#include "h5140.h"
+#if 0
+#include "h9277.h"
+#endif
+int main_1845() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6915.h"
+#include "h6678.h"
+#include "h3831.h"
+#include "h2884.h"
+#include "h2756.h"
+int main_1846() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7263.h"
+#include "h8123.h"
+#include "h2470.h"
+#include "h6353.h"
+#include "h9412.h"
+int main_1847() { return 0; }
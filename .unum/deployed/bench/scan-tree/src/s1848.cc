@@ -0,0 +1,6 @@
+#include "h2119.h"
+#include "h1981.h"
+#include "h9330.h"
+#include "h1056.h"
+#include "h858.h"
+int main_1848() { return 0; }
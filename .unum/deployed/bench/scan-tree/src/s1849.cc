@@ -0,0 +1,6 @@
+#include "h7785.h"
+#include "h4218.h"
+#include "h9133.h"
+#include "h1917.h"
+#include "h7347.h"
+int main_1849() { return 0; }
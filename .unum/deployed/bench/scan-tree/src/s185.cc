@@ -0,0 +1,9 @@
+#include "h1594.h"
+#include "h2751.h"
+#include "h7236.h"
+#include "h7506.h"
+#include "h6182.h"
+#if 0
+#include "h9351.h"
+#endif
+int main_185() { return 0; }
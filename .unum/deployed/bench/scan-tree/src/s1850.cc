@@ -0,0 +1,9 @@
+#include "h6696.h"
+#include "h443.h"
+#include "h1580.h"
+#include "h6787.h"
+#include "h6975.h"
+#if 0
+#include "h4451.h"
+#endif
+int main_1850() { return 0; }
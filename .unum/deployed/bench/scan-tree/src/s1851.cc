@@ -0,0 +1,6 @@
+#include "h6145.h"
+#include "h6260.h"
+#include "h7186.h"
+#include "h9069.h"
+#include "h2253.h"
+int main_1851() { return 0; }
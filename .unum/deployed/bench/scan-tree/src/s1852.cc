@@ -0,0 +1,6 @@
+#include "h2714.h"
+#include "h8495.h"
+#include "h1233.h"
+#include "h7540.h"
+#include "h9857.h"
+int main_1852() { return 0; }
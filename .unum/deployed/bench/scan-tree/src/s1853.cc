@@ -0,0 +1,6 @@
+#include "h479.h"
+#include "h6990.h"
+#include "h310.h"
+#include "h1702.h"
+#include "h8934.h"
+int main_1853() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2168.h"
+#include "h7866.h"
+#include "h3890.h"
+#include "h9933.h"
+#include "h8959.h"
+int main_1854() { return 0; }
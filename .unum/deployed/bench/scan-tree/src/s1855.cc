@@ -0,0 +1,9 @@
+#include "h3543.h"
+#include "h4133.h"
+#include "h8909.h"
+#include "h2959.h"
+#include "h9364.h"
+#if 0
+#include "h4123.h"
+#endif
+int main_1855() { return 0; }
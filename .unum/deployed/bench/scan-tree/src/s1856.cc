@@ -0,0 +1,6 @@
+#include "h9770.h"
+#include "h2358.h"
+#include "h1995.h"
+#include "h8478.h"
+#include "h6192.h"
+int main_1856() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5408.h"
+#include "h8951.h"
+#include "h8567.h"
+#include "h8588.h"
+#include "h7706.h"
+int main_1857() { return 0; }
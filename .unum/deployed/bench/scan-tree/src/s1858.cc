@@ -0,0 +1,6 @@
+#include "h4028.h"
+#include "h5246.h"
+#include "h3704.h"
+#include "h5947.h"
+#include "h2208.h"
+int main_1858() { return 0; }
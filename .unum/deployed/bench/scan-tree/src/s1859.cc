@@ -0,0 +1,6 @@
+#include "h2231.h"
+#include "h6337.h"
+#include "h942.h"
+#include "h7068.h"
+#include "h3055.h"
+int main_1859() { return 0; }
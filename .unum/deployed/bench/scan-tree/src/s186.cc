@@ -0,0 +1,6 @@
+#include "h6586.h"
+#include "h7889.h"
+#include "h8616.h"
+#include "h3185.h"
+#include "h8756.h"
+int main_186() { return 0; }
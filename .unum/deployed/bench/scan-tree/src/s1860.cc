@@ -0,0 +1,9 @@
+#include "h3525.h"
+#include "h2642.h"
+#include "h7389.h"
+#include "h1728.h"
+#include "h9807.h"
+#if 0
+#include "h2461.h"
+#endif
+int main_1860() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1148.h"
+#include "h1585.h"
+#include "h9794.h"
+#include "h6821.h"
+#include "h9688.h"
+int main_1861() { return 0; }
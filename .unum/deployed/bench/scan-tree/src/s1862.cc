@@ -0,0 +1,6 @@
+#include "h762.h"
+#include "h1022.h"
+#include "h3430.h"
+#include "h3060.h"
+#include "h153.h"
+int main_1862() { return 0; }
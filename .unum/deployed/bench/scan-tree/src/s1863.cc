@@ -0,0 +1,6 @@
+#include "h1689.h"
+#include "h3217.h"
+#include "h4930.h"
+#include "h3033.h"
+#include "h9815.h"
+int main_1863() { return 0; }
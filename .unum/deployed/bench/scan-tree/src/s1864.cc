@@ -0,0 +1,6 @@
+#include "h3281.h"
+#include "h3828.h"
+#include "h3675.h"
+#include "h9126.h"
+#include "h6575.h"
+int main_1864() { return 0; }
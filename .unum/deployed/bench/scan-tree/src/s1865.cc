@@ -0,0 +1,9 @@
+#include "h7765.h"
+#include "h6922.h"
+#include "h9895.h"
+#include "h2057.h"
+#include "h7989.h"
+#if 0
+#include "h3617.h"
+#endif
+int main_1865() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1186.h"
+#include "h4801.h"
+#include "h9481.h"
+#include "h208.h"
+#include "h7311.h"
+int main_1866() { return 0; }
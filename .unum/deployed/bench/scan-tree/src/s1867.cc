@@ -0,0 +1,6 @@
+#include "h2577.h"
+#include "h2191.h"
+#include "h2188.h"
+#include "h6563.h"
+#include "h984.h"
+int main_1867() { return 0; }
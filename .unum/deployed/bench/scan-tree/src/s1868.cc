@@ -0,0 +1,6 @@
+#include "h9763.h"
+#include "h5047.h"
+#include "h2299.h"
+#include "h1236.h"
+#include "h4778.h"
+int main_1868() { return 0; }
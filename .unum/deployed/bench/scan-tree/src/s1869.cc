@@ -0,0 +1,6 @@
+#include "h1275.h"
+#include "h763.h"
+#include "h9453.h"
+#include "h2801.h"
+#include "h2808.h"
+int main_1869() { return 0; }
@@ -0,0 +1,6 @@
+#include "h940.h"
+#include "h5723.h"
+#include "h9932.h"
+#include "h5594.h"
+#include "h8093.h"
+int main_187() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2688.h"
+#include "h4891.h"
+#include "h4946.h"
+#include "h2785.h"
+#include "h1787.h"
+#if 0
+#include "h2425.h"
+#endif
+int main_1870() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7566.h"
+#include "h7959.h"
+#include "h4544.h"
+#include "h5665.h"
+#include "h7574.h"
+int main_1871() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4803.h"
+#include "h2605.h"
+#include "h8542.h"
+#include "h5744.h"
+#include "h4067.h"
+int main_1872() { return 0; }
@@ -0,0 +1,6 @@
+#include "h200.h"
+#include "h7959.h"
+#include "h4465.h"
+#include "h6808.h"
+#include "h6757.h"
+int main_1873() { return 0; }
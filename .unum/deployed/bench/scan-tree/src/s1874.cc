@@ -0,0 +1,6 @@
+#include "h6491.h"
+#include "h3910.h"
+#include "h8703.h"
+#include "h2819.h"
+#include "h6658.h"
+int main_1874() { return 0; }
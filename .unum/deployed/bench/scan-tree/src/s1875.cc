@@ -0,0 +1,9 @@
+#include "h9787.h"
+#include "h8336.h"
+#include "h9348.h"
+#include "h39.h"
+#include "h6356.h"
+#if 0
+#include "h1142.h"
+#endif
+int main_1875() { return 0; }
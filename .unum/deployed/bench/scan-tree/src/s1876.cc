@@ -0,0 +1,6 @@
+#include "h3923.h"
+#include "h6051.h"
+#include "h582.h"
+#include "h9251.h"
+#include "h1675.h"
+int main_1876() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5874.h"
+#include "h8071.h"
+#include "h8081.h"
+#include "h5053.h"
+#include "h733.h"
+int main_1877() { return 0; }
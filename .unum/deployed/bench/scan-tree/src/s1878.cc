@@ -0,0 +1,6 @@
+#include "h2156.h"
+#include "h5202.h"
+#include "h8192.h"
+#include "h5107.h"
+#include "h8743.h"
+int main_1878() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2614.h"
+#include "h3447.h"
+#include "h1738.h"
+#include "h8708.h"
+#include "h798.h"
+int main_1879() { return 0; }
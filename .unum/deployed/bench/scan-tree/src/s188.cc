@@ -0,0 +1,6 @@
+#include "h4735.h"
+#include "h9525.h"
+#include "h6096.h"
+#include "h1991.h"
+#include "h9516.h"
+int main_188() { return 0; }
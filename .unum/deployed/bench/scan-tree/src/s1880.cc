@@ -0,0 +1,9 @@
+#include "h400.h"
+#include "h178.h"
+#include "h2006.h"
+#include "h5931.h"
+#include "h1013.h"
+#if 0
+#include "h8514.h"
+#endif
+int main_1880() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3769.h"
+#include "h1396.h"
+#include "h1868.h"
+#include "h9776.h"
+#include "h1793.h"
+int main_1881() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2101.h"
+#include "h3908.h"
+#include "h7122.h"
+#include "h4098.h"
+#include "h8960.h"
+int main_1882() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4279.h"
+#include "h4718.h"
+#include "h5007.h"
+#include "h2462.h"
+#include "h2246.h"
+int main_1883() { return 0; }
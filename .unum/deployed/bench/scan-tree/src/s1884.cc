@@ -0,0 +1,6 @@
+#include "h6628.h"
+#include "h325.h"
+#include "h4477.h"
+#include "h1458.h"
+#include "h4063.h"
+int main_1884() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4575.h"
+#include "h1811.h"
+#include "h9632.h"
+#include "h1424.h"
+#include "h3700.h"
+#if 0
+#include "h192.h"
+#endif
+int main_1885() { return 0; }
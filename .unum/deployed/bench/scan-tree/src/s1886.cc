@@ -0,0 +1,6 @@
+#include "h6857.h"
+#include "h2244.h"
+#include "h4416.h"
+#include "h856.h"
+#include "h892.h"
+int main_1886() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2791.h"
+#include "h8468.h"
+#include "h7151.h"
+#include "h3047.h"
+#include "h14.h"
+int main_1887() { return 0; }
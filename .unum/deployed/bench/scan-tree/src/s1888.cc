@@ -0,0 +1,6 @@
+#include "h318.h"
+#include "h535.h"
+#include "h9273.h"
+#include "h1583.h"
+#include "h2267.h"
+int main_1888() { return 0; }
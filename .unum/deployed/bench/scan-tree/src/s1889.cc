@@ -0,0 +1,6 @@
+#include "h1890.h"
+#include "h4786.h"
+#include "h1179.h"
+#include "h7475.h"
+#include "h5490.h"
+int main_1889() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8112.h"
+#include "h5475.h"
+#include "h1255.h"
+#include "h1478.h"
+#include "h2386.h"
+int main_189() { return 0; }
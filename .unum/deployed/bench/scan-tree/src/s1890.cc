@@ -0,0 +1,9 @@
+#include "h9656.h"
+#include "h6044.h"
+#include "h8966.h"
+#include "h4564.h"
+#include "h868.h"
+#if 0
+#include "h3056.h"
+#endif
+int main_1890() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1169.h"
+#include "h6635.h"
+#include "h3995.h"
+#include "h9419.h"
+#include "h7888.h"
+int main_1891() { return 0; }
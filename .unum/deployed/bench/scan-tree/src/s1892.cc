@@ -0,0 +1,6 @@
+#include "h2835.h"
+#include "h3128.h"
+#include "h3206.h"
+#include "h1655.h"
+#include "h7844.h"
+int main_1892() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9667.h"
+#include "h753.h"
+#include "h3181.h"
+#include "h9346.h"
+#include "h3495.h"
+int main_1893() { return 0; }
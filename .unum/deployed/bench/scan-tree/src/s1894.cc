@@ -0,0 +1,6 @@
+#include "h4719.h"
+#include "h7582.h"
+#include "h2297.h"
+#include "h3587.h"
+#include "h1796.h"
+int main_1894() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1511.h"
+#include "h6361.h"
+#include "h3871.h"
+#include "h3607.h"
+#include "h4412.h"
+#if 0
+#include "h1057.h"
+#endif
+int main_1895() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5638.h"
+#include "h7317.h"
+#include "h4647.h"
+#include "h256.h"
+#include "h3033.h"
+int main_1896() { return 0; }
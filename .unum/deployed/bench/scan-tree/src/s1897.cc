@@ -0,0 +1,6 @@
+#include "h9789.h"
+#include "h5103.h"
+#include "h8328.h"
+#include "h3880.h"
+#include "h7234.h"
+int main_1897() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3330.h"
+#include "h6305.h"
+#include "h694.h"
+#include "h2103.h"
+#include "h2311.h"
+int main_1898() { return 0; }
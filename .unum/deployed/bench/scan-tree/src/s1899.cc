@@ -0,0 +1,6 @@
+#include "h7294.h"
+#include "h9282.h"
+#include "h5722.h"
+#include "h2456.h"
+#include "h3913.h"
+int main_1899() { return 0; }
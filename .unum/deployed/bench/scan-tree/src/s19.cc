@@ -0,0 +1,6 @@
+#include "h4963.h"
+#include "h5656.h"
+#include "h4221.h"
+#include "h607.h"
+#include "h7360.h"
+int main_19() { return 0; }
@@ -0,0 +1,9 @@
+#include "h175.h"
+#include "h9381.h"
+#include "h9581.h"
+#include "h8710.h"
+#include "h8152.h"
+#if 0
+#include "h878.h"
+#endif
+int main_190() { return 0; }
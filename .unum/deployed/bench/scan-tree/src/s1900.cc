@@ -0,0 +1,9 @@
+#include "h5323.h"
+#include "h7746.h"
+#include "h6450.h"
+#include "h5023.h"
+#include "h2644.h"
+#if 0
+#include "h691.h"
+#endif
+int main_1900() { return 0; }
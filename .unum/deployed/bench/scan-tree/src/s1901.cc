@@ -0,0 +1,6 @@
+#include "h5909.h"
+#include "h4313.h"
+#include "h2055.h"
+#include "h8135.h"
+#include "h1391.h"
+int main_1901() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2469.h"
+#include "h4012.h"
+#include "h9290.h"
+#include "h4428.h"
+#include "h4856.h"
+int main_1902() { return 0; }
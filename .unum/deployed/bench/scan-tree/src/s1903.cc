@@ -0,0 +1,6 @@
+#include "h5615.h"
+#include "h952.h"
+#include "h5463.h"
+#include "h2181.h"
+#include "h3999.h"
+int main_1903() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5456.h"
+#include "h9789.h"
+#include "h7118.h"
+#include "h7519.h"
+#include "h3360.h"
+int main_1904() { return 0; }
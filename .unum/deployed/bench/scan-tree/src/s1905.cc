@@ -0,0 +1,9 @@
+#include "h1604.h"
+#include "h2241.h"
+#include "h3076.h"
+#include "h6001.h"
+#include "h2447.h"
+#if 0
+#include "h8478.h"
+#endif
+int main_1905() { return 0; }
@@ -0,0 +1,6 @@
+#include "h163.h"
+#include "h8792.h"
+#include "h2441.h"
+#include "h2678.h"
+#include "h5486.h"
+int main_1906() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6336.h"
+#include "h8518.h"
+#include "h5720.h"
+#include "h2034.h"
+#include "h2634.h"
+int main_1907() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3023.h"
+#include "h450.h"
+#include "h4749.h"
+#include "h5112.h"
+#include "h8010.h"
+int main_1908() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6387.h"
+#include "h9077.h"
+#include "h6346.h"
+#include "h1956.h"
+#include "h7230.h"
+int main_1909() { return 0; }
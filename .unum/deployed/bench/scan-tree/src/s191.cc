@@ -0,0 +1,6 @@
+#include "h8333.h"
+#include "h9300.h"
+#include "h531.h"
+#include "h1821.h"
+#include "h253.h"
+int main_191() { return 0; }
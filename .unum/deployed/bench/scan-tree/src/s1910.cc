@@ -0,0 +1,9 @@
+#include "h8417.h"
+#include "h1041.h"
+#include "h1390.h"
+#include "h2191.h"
+#include "h9716.h"
+#if 0
+#include "h6957.h"
+#endif
+int main_1910() { return 0; }
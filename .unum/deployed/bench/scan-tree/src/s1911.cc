@@ -0,0 +1,6 @@
+#include "h2399.h"
+#include "h7567.h"
+#include "h6691.h"
+#include "h5259.h"
+#include "h5516.h"
+int main_1911() { return 0; }
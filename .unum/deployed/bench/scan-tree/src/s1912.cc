@@ -0,0 +1,6 @@
+#include "h7745.h"
+#include "h7423.h"
+#include "h2090.h"
+#include "h4456.h"
+#include "h3354.h"
+int main_1912() { return 0; }
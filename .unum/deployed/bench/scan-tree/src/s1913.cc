@@ -0,0 +1,6 @@
+#include "h4933.h"
+#include "h3197.h"
+#include "h2822.h"
+#include "h5579.h"
+#include "h432.h"
+int main_1913() { return 0; }
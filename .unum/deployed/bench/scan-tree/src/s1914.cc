@@ -0,0 +1,6 @@
+#include "h3837.h"
+#include "h4607.h"
+#include "h5197.h"
+#include "h9319.h"
+#include "h8016.h"
+int main_1914() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8167.h"
+#include "h6851.h"
+#include "h4204.h"
+#include "h7116.h"
+#include "h3180.h"
+#if 0
+#include "h2010.h"
+#endif
+int main_1915() { return 0; }
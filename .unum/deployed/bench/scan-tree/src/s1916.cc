@@ -0,0 +1,6 @@
+#include "h3992.h"
+#include "h7005.h"
+#include "h7419.h"
+#include "h9884.h"
+#include "h1274.h"
+int main_1916() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3983.h"
+#include "h6642.h"
+#include "h405.h"
+#include "h4012.h"
+#include "h6749.h"
+int main_1917() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8706.h"
+#include "h7499.h"
+#include "h5630.h"
+#include "h2079.h"
+#include "h8096.h"
+int main_1918() { return 0; }
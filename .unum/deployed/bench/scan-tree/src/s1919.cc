@@ -0,0 +1,6 @@
+#include "h3097.h"
+#include "h239.h"
+#include "h8905.h"
+#include "h4643.h"
+#include "h3599.h"
+int main_1919() { return 0; }
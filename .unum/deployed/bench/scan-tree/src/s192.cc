@@ -0,0 +1,6 @@
+#include "h2526.h"
+#include "h2031.h"
+#include "h9466.h"
+#include "h7854.h"
+#include "h3324.h"
+int main_192() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4005.h"
+#include "h5190.h"
+#include "h1359.h"
+#include "h8895.h"
+#include "h1395.h"
+#if 0
+#include "h8691.h"
+#endif
+int main_1920() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1595.h"
+#include "h404.h"
+#include "h437.h"
+#include "h9881.h"
+#include "h8677.h"
+int main_1921() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6077.h"
+#include "h9866.h"
+#include "h5895.h"
+#include "h6636.h"
+#include "h647.h"
+int main_1922() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2044.h"
+#include "h4563.h"
+#include "h8517.h"
+#include "h2492.h"
+#include "h9070.h"
+int main_1923() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7658.h"
+#include "h1225.h"
+#include "h2086.h"
+#include "h4214.h"
+#include "h1409.h"
+int main_1924() { return 0; }
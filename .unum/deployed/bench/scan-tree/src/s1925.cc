@@ -0,0 +1,9 @@
+#include "h9160.h"
+#include "h1802.h"
+#include "h2213.h"
+#include "h6956.h"
+#include "h1993.h"
+#if 0
+#include "h9068.h"
+#endif
+int main_1925() { return 0; }
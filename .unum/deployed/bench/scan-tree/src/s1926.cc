@@ -0,0 +1,6 @@
+#include "h5453.h"
+#include "h7488.h"
+#include "h9605.h"
+#include "h5513.h"
+#include "h3588.h"
+int main_1926() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8845.h"
+#include "h4641.h"
+#include "h9923.h"
+#include "h5559.h"
+#include "h2873.h"
+int main_1927() { return 0; }
@@ -0,0 +1,6 @@
+#include "h419.h"
+#include "h1632.h"
+#include "h6249.h"
+#include "h3452.h"
+#include "h4400.h"
+int main_1928() { return 0; }
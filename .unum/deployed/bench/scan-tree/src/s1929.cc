@@ -0,0 +1,6 @@
+#include "h82.h"
+#include "h8846.h"
+#include "h9428.h"
+#include "h4411.h"
+#include "h9350.h"
+int main_1929() { return 0; }
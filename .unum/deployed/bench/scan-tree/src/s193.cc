@@ -0,0 +1,6 @@
+#include "h6722.h"
+#include "h6564.h"
+#include "h7616.h"
+#include "h4039.h"
+#include "h4936.h"
+int main_193() { return 0; }
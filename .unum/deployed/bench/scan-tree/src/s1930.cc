@@ -0,0 +1,9 @@
+#include "h1055.h"
+#include "h2591.h"
+#include "h7634.h"
+#include "h1292.h"
+#include "h5836.h"
+#if 0
+#include "h448.h"
+#endif
+int main_1930() { return 0; }
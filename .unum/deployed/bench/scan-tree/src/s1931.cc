@@ -0,0 +1,6 @@
+#include "h9703.h"
+#include "h8723.h"
+#include "h3876.h"
+#include "h6180.h"
+#include "h9225.h"
+int main_1931() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5661.h"
+#include "h5672.h"
+#include "h3943.h"
+#include "h5715.h"
+#include "h2991.h"
+int main_1932() { return 0; }
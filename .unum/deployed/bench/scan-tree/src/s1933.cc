@@ -0,0 +1,6 @@
+#include "h3562.h"
+#include "h3892.h"
+#include "h1625.h"
+#include "h4660.h"
+#include "h3848.h"
+int main_1933() { return 0; }
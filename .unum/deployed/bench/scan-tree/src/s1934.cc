@@ -0,0 +1,6 @@
+#include "h7949.h"
+#include "h3948.h"
+#include "h5504.h"
+#include "h2307.h"
+#include "h8539.h"
+int main_1934() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6584.h"
+#include "h16.h"
+#include "h778.h"
+#include "h1142.h"
+#include "h5546.h"
+#if 0
+#include "h282.h"
+#endif
+int main_1935() { return 0; }
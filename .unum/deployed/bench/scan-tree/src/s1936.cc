@@ -0,0 +1,6 @@
+#include "h4855.h"
+#include "h4689.h"
+#include "h3186.h"
+#include "h4773.h"
+#include "h2299.h"
+int main_1936() { return 0; }
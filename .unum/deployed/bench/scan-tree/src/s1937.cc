@@ -0,0 +1,6 @@
+#include "h4906.h"
+#include "h6158.h"
+#include "h4714.h"
+#include "h1746.h"
+#include "h2912.h"
+int main_1937() { return 0; }
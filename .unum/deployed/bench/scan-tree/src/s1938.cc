@@ -0,0 +1,6 @@
+#include "h7589.h"
+#include "h466.h"
+#include "h6228.h"
+#include "h7354.h"
+#include "h7714.h"
+int main_1938() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4.h"
+#include "h5637.h"
+#include "h5444.h"
+#include "h485.h"
+#include "h8056.h"
+int main_1939() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8865.h"
+#include "h1368.h"
+#include "h390.h"
+#include "h8238.h"
+#include "h7830.h"
+int main_194() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8406.h"
+#include "h1246.h"
+#include "h9236.h"
+#include "h4076.h"
+#include "h820.h"
+#if 0
+#include "h4772.h"
+#endif
+int main_1940() { return 0; }
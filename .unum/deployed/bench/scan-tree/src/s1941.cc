@@ -0,0 +1,6 @@
+#include "h82.h"
+#include "h4080.h"
+#include "h3780.h"
+#include "h8883.h"
+#include "h4594.h"
+int main_1941() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7696.h"
+#include "h7877.h"
+#include "h1482.h"
+#include "h3488.h"
+#include "h7522.h"
+int main_1942() { return 0; }
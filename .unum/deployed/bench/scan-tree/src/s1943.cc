@@ -0,0 +1,6 @@
+#include "h4755.h"
+#include "h3020.h"
+#include "h4735.h"
+#include "h9390.h"
+#include "h5654.h"
+int main_1943() { return 0; }
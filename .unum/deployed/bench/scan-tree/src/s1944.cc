@@ -0,0 +1,6 @@
+#include "h6899.h"
+#include "h5205.h"
+#include "h2119.h"
+#include "h8580.h"
+#include "h5523.h"
+int main_1944() { return 0; }
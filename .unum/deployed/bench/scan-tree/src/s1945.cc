@@ -0,0 +1,9 @@
+#include "h5836.h"
+#include "h7799.h"
+#include "h5426.h"
+#include "h1788.h"
+#include "h5600.h"
+#if 0
+#include "h1645.h"
+#endif
+int main_1945() { return 0; }
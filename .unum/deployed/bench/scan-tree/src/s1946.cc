@@ -0,0 +1,6 @@
+#include "h5429.h"
+#include "h9414.h"
+#include "h8709.h"
+#include "h9856.h"
+#include "h9976.h"
+int main_1946() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6711.h"
+#include "h8127.h"
+#include "h2411.h"
+#include "h2026.h"
+#include "h3529.h"
+int main_1947() { return 0; }
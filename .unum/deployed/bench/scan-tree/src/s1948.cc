@@ -0,0 +1,6 @@
+#include "h7032.h"
+#include "h3201.h"
+#include "h1842.h"
+#include "h4486.h"
+#include "h6947.h"
+int main_1948() { return 0; }
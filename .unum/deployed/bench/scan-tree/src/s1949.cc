@@ -0,0 +1,6 @@
+#include "h4361.h"
+#include "h4762.h"
+#include "h7405.h"
+#include "h4261.h"
+#include "h9323.h"
+int main_1949() { return 0; }
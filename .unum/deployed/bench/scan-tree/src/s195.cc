@@ -0,0 +1,9 @@
+#include "h4922.h"
+#include "h2561.h"
+#include "h9009.h"
+#include "h7836.h"
+#include "h7409.h"
+#if 0
+#include "h6013.h"
+#endif
+int main_195() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6339.h"
+#include "h3369.h"
+#include "h5697.h"
+#include "h406.h"
+#include "h4984.h"
+#if 0
+#include "h5876.h"
+#endif
+int main_1950() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9988.h"
+#include "h8003.h"
+#include "h5484.h"
+#include "h2812.h"
+#include "h4347.h"
+int main_1951() { return 0; }
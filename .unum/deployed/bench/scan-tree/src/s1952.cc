@@ -0,0 +1,6 @@
+#include "h8153.h"
+#include "h2959.h"
+#include "h1172.h"
+#include "h744.h"
+#include "h9906.h"
+int main_1952() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5898.h"
+#include "h1584.h"
+#include "h5662.h"
+#include "h4895.h"
+#include "h8468.h"
+int main_1953() { return 0; }
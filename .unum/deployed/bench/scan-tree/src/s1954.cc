@@ -0,0 +1,6 @@
+#include "h4356.h"
+#include "h7037.h"
+#include "h8624.h"
+#include "h2747.h"
+#include "h8369.h"
+int main_1954() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8136.h"
+#include "h8248.h"
+#include "h2624.h"
+#include "h5227.h"
+#include "h8226.h"
+#if 0
+#include "h349.h"
+#endif
+int main_1955() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1603.h"
+#include "h7979.h"
+#include "h1276.h"
+#include "h3360.h"
+#include "h9786.h"
+int main_1956() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7577.h"
+#include "h2718.h"
+#include "h8663.h"
+#include "h1219.h"
+#include "h8529.h"
+int main_1957() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1200.h"
+#include "h5836.h"
+#include "h7910.h"
+#include "h5891.h"
+#include "h8781.h"
+int main_1958() { return 0; }
@@ -0,0 +1,6 @@
+#include "h532.h"
+#include "h1671.h"
+#include "h7507.h"
+#include "h8932.h"
+#include "h193.h"
+int main_1959() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1840.h"
+#include "h9980.h"
+#include "h5123.h"
+#include "h3206.h"
+#include "h6035.h"
+int main_196() { return 0; }
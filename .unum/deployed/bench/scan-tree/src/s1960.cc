@@ -0,0 +1,9 @@
+#include "h4088.h"
+#include "h3007.h"
+#include "h235.h"
+#include "h7516.h"
+#include "h5129.h"
+#if 0
+#include "h5871.h"
+#endif
+int main_1960() { return 0; }
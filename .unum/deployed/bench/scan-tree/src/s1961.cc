@@ -0,0 +1,6 @@
+#include "h5887.h"
+#include "h7163.h"
+#include "h185.h"
+#include "h3193.h"
+#include "h1616.h"
+int main_1961() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3223.h"
+#include "h679.h"
+#include "h8103.h"
+#include "h9707.h"
+#include "h3295.h"
+int main_1962() { return 0; }
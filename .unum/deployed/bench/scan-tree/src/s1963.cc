@@ -0,0 +1,6 @@
+#include "h1170.h"
+#include "h8111.h"
+#include "h7129.h"
+#include "h5513.h"
+#include "h7492.h"
+int main_1963() { return 0; }
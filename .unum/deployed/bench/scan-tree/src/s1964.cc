@@ -0,0 +1,6 @@
+#include "h802.h"
+#include "h4319.h"
+#include "h292.h"
+#include "h803.h"
+#include "h9239.h"
+int main_1964() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6200.h"
+#include "h5976.h"
+#include "h701.h"
+#include "h2472.h"
+#include "h4230.h"
+#if 0
+#include "h5506.h"
+#endif
+int main_1965() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1991.h"
+#include "h3134.h"
+#include "h9769.h"
+#include "h4312.h"
+#include "h1487.h"
+int main_1966() { return 0; }
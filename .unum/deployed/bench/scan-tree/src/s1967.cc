@@ -0,0 +1,6 @@
+#include "h6497.h"
+#include "h1741.h"
+#include "h460.h"
+#include "h1621.h"
+#include "h3036.h"
+int main_1967() { return 0; }
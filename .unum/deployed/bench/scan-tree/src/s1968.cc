@@ -0,0 +1,6 @@
+#include "h1363.h"
+#include "h7688.h"
+#include "h7887.h"
+#include "h8177.h"
+#include "h6496.h"
+int main_1968() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3086.h"
+#include "h549.h"
+#include "h9861.h"
+#include "h4919.h"
+#include "h2428.h"
+int main_1969() { return 0; }
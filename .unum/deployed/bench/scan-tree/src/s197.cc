@@ -0,0 +1,6 @@
+#include "h5726.h"
+#include "h6667.h"
+#include "h2707.h"
+#include "h1368.h"
+#include "h7426.h"
+int main_197() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6001.h"
+#include "h4301.h"
+#include "h567.h"
+#include "h2565.h"
+#include "h1725.h"
+#if 0
+#include "h9200.h"
+#endif
+int main_1970() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1476.h"
+#include "h7527.h"
+#include "h4124.h"
+#include "h5804.h"
+#include "h4478.h"
+int main_1971() { return 0; }
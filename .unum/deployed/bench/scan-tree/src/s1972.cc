@@ -0,0 +1,6 @@
+#include "h2693.h"
+#include "h9442.h"
+#include "h6943.h"
+#include "h3016.h"
+#include "h6268.h"
+int main_1972() { return 0; }
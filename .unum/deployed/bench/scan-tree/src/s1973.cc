@@ -0,0 +1,6 @@
+#include "h1401.h"
+#include "h7804.h"
+#include "h5824.h"
+#include "h7136.h"
+#include "h5247.h"
+int main_1973() { return 0; }
@@ -0,0 +1,6 @@
+#include "h22.h"
+#include "h8092.h"
+#include "h8175.h"
+#include "h7427.h"
+#include "h7325.h"
+int main_1974() { return 0; }
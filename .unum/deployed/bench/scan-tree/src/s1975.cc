@@ -0,0 +1,9 @@
+#include "h5089.h"
+#include "h4491.h"
+#include "h6199.h"
+#include "h7320.h"
+#include "h2698.h"
+#if 0
+#include "h5155.h"
+#endif
+int main_1975() { return 0; }
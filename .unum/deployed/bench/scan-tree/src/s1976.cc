@@ -0,0 +1,6 @@
+#include "h7489.h"
+#include "h8117.h"
+#include "h4779.h"
+#include "h5099.h"
+#include "h1074.h"
+int main_1976() { return 0; }
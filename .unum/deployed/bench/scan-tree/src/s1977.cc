@@ -0,0 +1,6 @@
+#include "h672.h"
+#include "h2977.h"
+#include "h5810.h"
+#include "h379.h"
+#include "h2969.h"
+int main_1977() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8220.h"
+#include "h2804.h"
+#include "h6920.h"
+#include "h6911.h"
+#include "h2282.h"
+int main_1978() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5373.h"
+#include "h4515.h"
+#include "h4950.h"
+#include "h5627.h"
+#include "h9253.h"
+int main_1979() { return 0; }
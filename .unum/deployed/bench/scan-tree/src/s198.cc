@@ -0,0 +1,6 @@
+#include "h1492.h"
+#include "h4750.h"
+#include "h2970.h"
+#include "h1040.h"
+#include "h4892.h"
+int main_198() { return 0; }
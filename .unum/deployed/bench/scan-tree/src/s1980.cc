@@ -0,0 +1,9 @@
+#include "h4874.h"
+#include "h6725.h"
+#include "h9555.h"
+#include "h7201.h"
+#include "h8840.h"
+#if 0
+#include "h1692.h"
+#endif
+int main_1980() { return 0; }
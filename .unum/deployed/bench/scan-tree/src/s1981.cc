@@ -0,0 +1,6 @@
+#include "h9617.h"
+#include "h2459.h"
+#include "h1066.h"
+#include "h5709.h"
+#include "h1367.h"
+int main_1981() { return 0; }
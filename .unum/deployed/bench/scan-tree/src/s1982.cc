@@ -0,0 +1,6 @@
+#include "h6507.h"
+#include "h7710.h"
+#include "h7103.h"
+#include "h2386.h"
+#include "h6337.h"
+int main_1982() { return 0; }
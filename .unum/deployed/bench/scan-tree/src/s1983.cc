@@ -0,0 +1,6 @@
+#include "h2733.h"
+#include "h4443.h"
+#include "h4380.h"
+#include "h7310.h"
+#include "h531.h"
+int main_1983() { return 0; }
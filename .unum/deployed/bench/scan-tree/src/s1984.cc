@@ -0,0 +1,6 @@
+#include "h5688.h"
+#include "h7655.h"
+#include "h5637.h"
+#include "h7496.h"
+#include "h3761.h"
+int main_1984() { return 0; }
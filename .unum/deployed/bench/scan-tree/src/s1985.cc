@@ -0,0 +1,9 @@
+#include "h3498.h"
+#include "h514.h"
+#include "h3634.h"
+#include "h2777.h"
+#include "h5131.h"
+#if 0
+#include "h8828.h"
+#endif
+int main_1985() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4538.h"
+#include "h7855.h"
+#include "h784.h"
+#include "h7500.h"
+#include "h8929.h"
+int main_1986() { return 0; }
@@ -0,0 +1,6 @@
+#include "h763.h"
+#include "h9370.h"
+#include "h1732.h"
+#include "h5938.h"
+#include "h9988.h"
+int main_1987() { return 0; }
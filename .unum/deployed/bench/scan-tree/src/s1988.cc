@@ -0,0 +1,6 @@
+#include "h8882.h"
+#include "h729.h"
+#include "h5591.h"
+#include "h3292.h"
+#include "h8633.h"
+int main_1988() { return 0; }
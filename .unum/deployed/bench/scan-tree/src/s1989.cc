@@ -0,0 +1,6 @@
+#include "h9861.h"
+#include "h7574.h"
+#include "h933.h"
+#include "h9748.h"
+#include "h8131.h"
+int main_1989() { return 0; }
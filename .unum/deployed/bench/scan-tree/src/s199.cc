@@ -0,0 +1,6 @@
+#include "h5456.h"
+#include "h8048.h"
+#include "h9056.h"
+#include "h1131.h"
+#include "h2550.h"
+int main_199() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3348.h"
+#include "h1835.h"
+#include "h9994.h"
+#include "h3822.h"
+#include "h6355.h"
+#if 0
+#include "h3477.h"
+#endif
+int main_1990() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4953.h"
+#include "h568.h"
+#include "h3019.h"
+#include "h119.h"
+#include "h9125.h"
+int main_1991() { return 0; }
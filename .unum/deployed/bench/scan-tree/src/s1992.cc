@@ -0,0 +1,6 @@
+#include "h9402.h"
+#include "h987.h"
+#include "h545.h"
+#include "h6872.h"
+#include "h9888.h"
+int main_1992() { return 0; }
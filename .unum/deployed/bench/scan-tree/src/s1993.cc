@@ -0,0 +1,6 @@
+#include "h8273.h"
+#include "h5680.h"
+#include "h1848.h"
+#include "h1678.h"
+#include "h7189.h"
+int main_1993() { return 0; }
@@ -0,0 +1,6 @@
+#include "h79.h"
+#include "h744.h"
+#include "h5063.h"
+#include "h4402.h"
+#include "h4426.h"
+int main_1994() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4561.h"
+#include "h5743.h"
+#include "h4499.h"
+#include "h9197.h"
+#include "h5801.h"
+#if 0
+#include "h1938.h"
+#endif
+int main_1995() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5910.h"
+#include "h201.h"
+#include "h4109.h"
+#include "h729.h"
+#include "h4155.h"
+int main_1996() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1763.h"
+#include "h5073.h"
+#include "h4055.h"
+#include "h6852.h"
+#include "h9392.h"
+int main_1997() { return 0; }
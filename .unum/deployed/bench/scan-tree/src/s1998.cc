@@ -0,0 +1,6 @@
+#include "h4779.h"
+#include "h6257.h"
+#include "h6588.h"
+#include "h7064.h"
+#include "h9599.h"
+int main_1998() { return 0; }
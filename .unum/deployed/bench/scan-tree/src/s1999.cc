@@ -0,0 +1,6 @@
+#include "h6463.h"
+#include "h1063.h"
+#include "h2645.h"
+#include "h573.h"
+#include "h1993.h"
+int main_1999() { return 0; }
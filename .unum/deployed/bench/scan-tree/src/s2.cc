@@ -0,0 +1,6 @@
+#include "h3065.h"
+#include "h4948.h"
+#include "h9772.h"
+#include "h4911.h"
+#include "h4272.h"
+int main_2() { return 0; }
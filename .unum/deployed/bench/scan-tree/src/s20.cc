@@ -0,0 +1,9 @@
+#include "h2558.h"
+#include "h9236.h"
+#include "h5742.h"
+#include "h9848.h"
+#include "h4566.h"
+#if 0
+#include "h3680.h"
+#endif
+int main_20() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1239.h"
+#include "h7126.h"
+#include "h1159.h"
+#include "h2268.h"
+#include "h3873.h"
+#if 0
+#include "h5071.h"
+#endif
+int main_200() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2511.h"
+#include "h7262.h"
+#include "h3021.h"
+#include "h8568.h"
+#include "h320.h"
+int main_201() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1261.h"
+#include "h4678.h"
+#include "h2713.h"
+#include "h9096.h"
+#include "h9961.h"
+int main_202() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9172.h"
+#include "h9552.h"
+#include "h7238.h"
+#include "h6030.h"
+#include "h8961.h"
+int main_203() { return 0; }
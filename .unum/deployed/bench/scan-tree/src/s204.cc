@@ -0,0 +1,6 @@
+#include "h8384.h"
+#include "h9964.h"
+#include "h3277.h"
+#include "h6462.h"
+#include "h6796.h"
+int main_204() { return 0; }
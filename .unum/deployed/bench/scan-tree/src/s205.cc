@@ -0,0 +1,9 @@
+#include "h8620.h"
+#include "h8744.h"
+#include "h5363.h"
+#include "h6913.h"
+#include "h5038.h"
+#if 0
+#include "h9317.h"
+#endif
+int main_205() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2227.h"
+#include "h3037.h"
+#include "h7965.h"
+#include "h9834.h"
+#include "h4092.h"
+int main_206() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1574.h"
+#include "h4618.h"
+#include "h3343.h"
+#include "h6446.h"
+#include "h1649.h"
+int main_207() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2022.h"
+#include "h4973.h"
+#include "h5657.h"
+#include "h9809.h"
+#include "h8999.h"
+int main_208() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3882.h"
+#include "h8762.h"
+#include "h6203.h"
+#include "h1700.h"
+#include "h6399.h"
+int main_209() { return 0; }
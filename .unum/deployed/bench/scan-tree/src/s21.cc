@@ -0,0 +1,6 @@
+#include "h3702.h"
+#include "h9214.h"
+#include "h8683.h"
+#include "h4396.h"
+#include "h2128.h"
+int main_21() { return 0; }
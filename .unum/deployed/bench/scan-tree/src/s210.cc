@@ -0,0 +1,9 @@
+#include "h1919.h"
+#include "h200.h"
+#include "h6168.h"
+#include "h4096.h"
+#include "h3098.h"
+#if 0
+#include "h3309.h"
+#endif
+int main_210() { return 0; }
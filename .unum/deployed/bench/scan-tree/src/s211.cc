@@ -0,0 +1,6 @@
+#include "h2882.h"
+#include "h253.h"
+#include "h6661.h"
+#include "h7985.h"
+#include "h1574.h"
+int main_211() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7724.h"
+#include "h7638.h"
+#include "h5321.h"
+#include "h3562.h"
+#include "h1782.h"
+int main_212() { return 0; }
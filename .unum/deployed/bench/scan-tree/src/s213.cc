@@ -0,0 +1,6 @@
+#include "h5278.h"
+#include "h2720.h"
+#include "h7177.h"
+#include "h7072.h"
+#include "h1291.h"
+int main_213() { return 0; }
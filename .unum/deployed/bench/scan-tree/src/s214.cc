@@ -0,0 +1,6 @@
+#include "h4487.h"
+#include "h9063.h"
+#include "h5538.h"
+#include "h2842.h"
+#include "h8231.h"
+int main_214() { return 0; }
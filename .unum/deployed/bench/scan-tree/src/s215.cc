@@ -0,0 +1,9 @@
+#include "h9983.h"
+#include "h1374.h"
+#include "h2517.h"
+#include "h1615.h"
+#include "h8766.h"
+#if 0
+#include "h4797.h"
+#endif
+int main_215() { return 0; }
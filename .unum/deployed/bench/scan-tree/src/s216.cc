@@ -0,0 +1,6 @@
+#include "h1066.h"
+#include "h5385.h"
+#include "h6901.h"
+#include "h2210.h"
+#include "h602.h"
+int main_216() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4847.h"
+#include "h6250.h"
+#include "h6207.h"
+#include "h1206.h"
+#include "h7609.h"
+int main_217() { return 0; }
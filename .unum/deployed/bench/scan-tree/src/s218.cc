@@ -0,0 +1,6 @@
+#include "h5622.h"
+#include "h2355.h"
+#include "h2526.h"
+#include "h2376.h"
+#include "h8990.h"
+int main_218() { return 0; }
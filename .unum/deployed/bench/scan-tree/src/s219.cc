@@ -0,0 +1,6 @@
+#include "h5771.h"
+#include "h6915.h"
+#include "h9374.h"
+#include "h2172.h"
+#include "h6129.h"
+int main_219() { return 0; }
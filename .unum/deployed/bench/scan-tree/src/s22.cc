@@ -0,0 +1,6 @@
+#include "h66.h"
+#include "h3723.h"
+#include "h524.h"
+#include "h1904.h"
+#include "h5430.h"
+int main_22() { return 0; }
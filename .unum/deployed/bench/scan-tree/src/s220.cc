@@ -0,0 +1,9 @@
+#include "h693.h"
+#include "h9423.h"
+#include "h7693.h"
+#include "h8547.h"
+#include "h9305.h"
+#if 0
+#include "h324.h"
+#endif
+int main_220() { return 0; }
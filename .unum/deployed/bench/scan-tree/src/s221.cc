@@ -0,0 +1,6 @@
+#include "h4769.h"
+#include "h8035.h"
+#include "h4933.h"
+#include "h7070.h"
+#include "h4560.h"
+int main_221() { return 0; }
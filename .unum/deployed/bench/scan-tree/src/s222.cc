@@ -0,0 +1,6 @@
+#include "h2445.h"
+#include "h96.h"
+#include "h3806.h"
+#include "h4273.h"
+#include "h9811.h"
+int main_222() { return 0; }
@@ -0,0 +1,6 @@
+#include "h663.h"
+#include "h6170.h"
+#include "h1659.h"
+#include "h1750.h"
+#include "h3949.h"
+int main_223() { return 0; }
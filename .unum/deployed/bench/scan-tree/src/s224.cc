@@ -0,0 +1,6 @@
+#include "h6196.h"
+#include "h9354.h"
+#include "h1464.h"
+#include "h8312.h"
+#include "h5670.h"
+int main_224() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2710.h"
+#include "h1535.h"
+#include "h3432.h"
+#include "h9979.h"
+#include "h9284.h"
+#if 0
+#include "h5389.h"
+#endif
+int main_225() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2398.h"
+#include "h6655.h"
+#include "h1625.h"
+#include "h1401.h"
+#include "h1737.h"
+int main_226() { return 0; }
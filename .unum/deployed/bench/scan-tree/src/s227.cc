@@ -0,0 +1,6 @@
+#include "h4169.h"
+#include "h6789.h"
+#include "h7130.h"
+#include "h4799.h"
+#include "h4992.h"
+int main_227() { return 0; }
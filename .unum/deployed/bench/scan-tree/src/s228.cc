@@ -0,0 +1,6 @@
+#include "h8363.h"
+#include "h9323.h"
+#include "h5496.h"
+#include "h4120.h"
+#include "h3075.h"
+int main_228() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9537.h"
+#include "h4970.h"
+#include "h6895.h"
+#include "h8663.h"
+#include "h5033.h"
+int main_229() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4197.h"
+#include "h609.h"
+#include "h8286.h"
+#include "h8849.h"
+#include "h9649.h"
+int main_23() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9767.h"
+#include "h6660.h"
+#include "h4149.h"
+#include "h3301.h"
+#include "h5189.h"
+#if 0
+#include "h7255.h"
+#endif
+int main_230() { return 0; }
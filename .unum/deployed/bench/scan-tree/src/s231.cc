@@ -0,0 +1,6 @@
+#include "h2599.h"
+#include "h1113.h"
+#include "h4345.h"
+#include "h9801.h"
+#include "h824.h"
+int main_231() { return 0; }
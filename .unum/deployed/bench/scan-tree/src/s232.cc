@@ -0,0 +1,6 @@
+#include "h8593.h"
+#include "h710.h"
+#include "h4879.h"
+#include "h2726.h"
+#include "h247.h"
+int main_232() { return 0; }
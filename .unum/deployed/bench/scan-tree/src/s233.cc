@@ -0,0 +1,6 @@
+#include "h5482.h"
+#include "h7092.h"
+#include "h1126.h"
+#include "h9011.h"
+#include "h4714.h"
+int main_233() { return 0; }
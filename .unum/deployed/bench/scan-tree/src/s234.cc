@@ -0,0 +1,6 @@
+#include "h2376.h"
+#include "h8663.h"
+#include "h5936.h"
+#include "h8993.h"
+#include "h8129.h"
+int main_234() { return 0; }
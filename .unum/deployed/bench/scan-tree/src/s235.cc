@@ -0,0 +1,9 @@
+#include "h6490.h"
+#include "h5167.h"
+#include "h9306.h"
+#include "h4837.h"
+#include "h6076.h"
+#if 0
+#include "h3238.h"
+#endif
+int main_235() { return 0; }
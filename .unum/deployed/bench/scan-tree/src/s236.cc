@@ -0,0 +1,6 @@
+#include "h5262.h"
+#include "h7016.h"
+#include "h6855.h"
+#include "h3395.h"
+#include "h2731.h"
+int main_236() { return 0; }
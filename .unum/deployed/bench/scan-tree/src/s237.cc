@@ -0,0 +1,6 @@
+#include "h4723.h"
+#include "h6977.h"
+#include "h7255.h"
+#include "h3331.h"
+#include "h9773.h"
+int main_237() { return 0; }
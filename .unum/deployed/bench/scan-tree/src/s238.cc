@@ -0,0 +1,6 @@
+#include "h3697.h"
+#include "h1835.h"
+#include "h9629.h"
+#include "h6209.h"
+#include "h290.h"
+int main_238() { return 0; }
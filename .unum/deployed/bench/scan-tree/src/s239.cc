@@ -0,0 +1,6 @@
+#include "h638.h"
+#include "h1582.h"
+#include "h567.h"
+#include "h937.h"
+#include "h545.h"
+int main_239() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3437.h"
+#include "h9533.h"
+#include "h1755.h"
+#include "h1591.h"
+#include "h1037.h"
+int main_24() { return 0; }
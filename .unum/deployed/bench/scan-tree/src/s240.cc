@@ -0,0 +1,9 @@
+#include "h2752.h"
+#include "h1190.h"
+#include "h992.h"
+#include "h5584.h"
+#include "h8450.h"
+#if 0
+#include "h5842.h"
+#endif
+int main_240() { return 0; }
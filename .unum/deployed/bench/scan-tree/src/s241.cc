@@ -0,0 +1,6 @@
+#include "h2079.h"
+#include "h6533.h"
+#include "h3186.h"
+#include "h807.h"
+#include "h4197.h"
+int main_241() { return 0; }
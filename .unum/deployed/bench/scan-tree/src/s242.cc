@@ -0,0 +1,6 @@
+#include "h4144.h"
+#include "h2322.h"
+#include "h7663.h"
+#include "h7305.h"
+#include "h5053.h"
+int main_242() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5988.h"
+#include "h5140.h"
+#include "h4189.h"
+#include "h3133.h"
+#include "h3974.h"
+int main_243() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6493.h"
+#include "h2816.h"
+#include "h1095.h"
+#include "h5444.h"
+#include "h8448.h"
+int main_244() { return 0; }
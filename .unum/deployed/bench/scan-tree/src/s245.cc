@@ -0,0 +1,9 @@
+#include "h1755.h"
+#include "h9301.h"
+#include "h2954.h"
+#include "h9582.h"
+#include "h1654.h"
+#if 0
+#include "h1853.h"
+#endif
+int main_245() { return 0; }
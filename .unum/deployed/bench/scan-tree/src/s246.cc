@@ -0,0 +1,6 @@
+#include "h3604.h"
+#include "h5235.h"
+#include "h4862.h"
+#include "h8792.h"
+#include "h7776.h"
+int main_246() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5381.h"
+#include "h4385.h"
+#include "h5894.h"
+#include "h1707.h"
+#include "h765.h"
+int main_247() { return 0; }
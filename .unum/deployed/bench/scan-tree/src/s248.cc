@@ -0,0 +1,6 @@
+#include "h779.h"
+#include "h6507.h"
+#include "h4465.h"
+#include "h8866.h"
+#include "h5970.h"
+int main_248() { return 0; }
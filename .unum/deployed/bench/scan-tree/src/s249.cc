@@ -0,0 +1,6 @@
+#include "h5835.h"
+#include "h3008.h"
+#include "h5078.h"
+#include "h805.h"
+#include "h4498.h"
+int main_249() { return 0; }
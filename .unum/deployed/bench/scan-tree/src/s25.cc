@@ -0,0 +1,9 @@
+#include "h6563.h"
+#include "h2210.h"
+#include "h2285.h"
+#include "h9042.h"
+#include "h6889.h"
+#if 0
+#include "h2432.h"
+#endif
+int main_25() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2037.h"
+#include "h9550.h"
+#include "h8795.h"
+#include "h3069.h"
+#include "h3697.h"
+#if 0
+#include "h9505.h"
+#endif
+int main_250() { return 0; }
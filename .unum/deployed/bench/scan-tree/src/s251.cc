@@ -0,0 +1,6 @@
+#include "h3284.h"
+#include "h5913.h"
+#include "h4119.h"
+#include "h957.h"
+#include "h6037.h"
+int main_251() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5900.h"
+#include "h8685.h"
+#include "h8894.h"
+#include "h7007.h"
+#include "h2461.h"
+int main_252() { return 0; }
@@ -0,0 +1,6 @@
+#include "h392.h"
+#include "h2624.h"
+#include "h5615.h"
+#include "h5066.h"
+#include "h1251.h"
+int main_253() { return 0; }
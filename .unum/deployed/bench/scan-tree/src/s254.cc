@@ -0,0 +1,6 @@
+#include "h7487.h"
+#include "h6183.h"
+#include "h9389.h"
+#include "h1249.h"
+#include "h3618.h"
+int main_254() { return 0; }
@@ -0,0 +1,9 @@
+#include "h997.h"
+#include "h8418.h"
+#include "h5895.h"
+#include "h1661.h"
+#include "h218.h"
+#if 0
+#include "h3391.h"
+#endif
+int main_255() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2454.h"
+#include "h4430.h"
+#include "h8367.h"
+#include "h8233.h"
+#include "h8634.h"
+int main_256() { return 0; }
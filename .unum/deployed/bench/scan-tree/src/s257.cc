@@ -0,0 +1,6 @@
+#include "h3001.h"
+#include "h8433.h"
+#include "h6229.h"
+#include "h2625.h"
+#include "h2080.h"
+int main_257() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7567.h"
+#include "h9237.h"
+#include "h8122.h"
+#include "h1159.h"
+#include "h2331.h"
+int main_258() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3522.h"
+#include "h6087.h"
+#include "h706.h"
+#include "h4418.h"
+#include "h1805.h"
+int main_259() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1093.h"
+#include "h8523.h"
+#include "h610.h"
+#include "h4311.h"
+#include "h9028.h"
+int main_26() { return 0; }
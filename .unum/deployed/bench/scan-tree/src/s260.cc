@@ -0,0 +1,9 @@
+#include "h9948.h"
+#include "h8894.h"
+#include "h2801.h"
+#include "h9522.h"
+#include "h4841.h"
+#if 0
+#include "h3411.h"
+#endif
+int main_260() { return 0; }
@@ -0,0 +1,6 @@
+#include "h532.h"
+#include "h3258.h"
+#include "h9528.h"
+#include "h6201.h"
+#include "h1266.h"
+int main_261() { return 0; }
@@ -0,0 +1,6 @@
+#include "h776.h"
+#include "h888.h"
+#include "h4244.h"
+#include "h5058.h"
+#include "h8817.h"
+int main_262() { return 0; }
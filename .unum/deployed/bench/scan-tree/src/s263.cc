@@ -0,0 +1,6 @@
+#include "h4107.h"
+#include "h7615.h"
+#include "h5245.h"
+#include "h1142.h"
+#include "h4299.h"
+int main_263() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8388.h"
+#include "h2225.h"
+#include "h4996.h"
+#include "h3044.h"
+#include "h63.h"
+int main_264() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8678.h"
+#include "h4000.h"
+#include "h5574.h"
+#include "h7680.h"
+#include "h7327.h"
+#if 0
+#include "h4375.h"
+#endif
+int main_265() { return 0; }
@@ -0,0 +1,6 @@
+#include "h492.h"
+#include "h4545.h"
+#include "h6034.h"
+#include "h5366.h"
+#include "h6252.h"
+int main_266() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6636.h"
+#include "h8464.h"
+#include "h4454.h"
+#include "h1997.h"
+#include "h3631.h"
+int main_267() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4494.h"
+#include "h7997.h"
+#include "h9867.h"
+#include "h1900.h"
+#include "h6982.h"
+int main_268() { return 0; }
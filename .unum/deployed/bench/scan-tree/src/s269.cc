@@ -0,0 +1,6 @@
+#include "h6425.h"
+#include "h5590.h"
+#include "h294.h"
+#include "h6215.h"
+#include "h6897.h"
+int main_269() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9870.h"
+#include "h1039.h"
+#include "h5228.h"
+#include "h1610.h"
+#include "h4815.h"
+int main_27() { return 0; }
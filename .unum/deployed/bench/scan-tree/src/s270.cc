@@ -0,0 +1,9 @@
+#include "h7197.h"
+#include "h4792.h"
+#include "h1402.h"
+#include "h1601.h"
+#include "h9789.h"
+#if 0
+#include "h1763.h"
+#endif
+int main_270() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4080.h"
+#include "h4101.h"
+#include "h2316.h"
+#include "h275.h"
+#include "h6538.h"
+int main_271() { return 0; }
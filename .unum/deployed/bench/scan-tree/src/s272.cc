@@ -0,0 +1,6 @@
+#include "h2512.h"
+#include "h543.h"
+#include "h8787.h"
+#include "h1831.h"
+#include "h8774.h"
+int main_272() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1037.h"
+#include "h7442.h"
+#include "h5627.h"
+#include "h3221.h"
+#include "h888.h"
+int main_273() { return 0; }
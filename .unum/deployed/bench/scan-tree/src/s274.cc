@@ -0,0 +1,6 @@
+#include "h3672.h"
+#include "h3521.h"
+#include "h4100.h"
+#include "h921.h"
+#include "h9170.h"
+int main_274() { return 0; }
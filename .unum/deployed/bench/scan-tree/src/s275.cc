@@ -0,0 +1,9 @@
+#include "h1203.h"
+#include "h5207.h"
+#include "h9057.h"
+#include "h7309.h"
+#include "h5079.h"
+#if 0
+#include "h8681.h"
+#endif
+int main_275() { return 0; }
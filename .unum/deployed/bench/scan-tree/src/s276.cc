@@ -0,0 +1,6 @@
+#include "h136.h"
+#include "h5063.h"
+#include "h6656.h"
+#include "h1475.h"
+#include "h1439.h"
+int main_276() { return 0; }
@@ -0,0 +1,6 @@
+#include "h363.h"
+#include "h3332.h"
+#include "h8545.h"
+#include "h4289.h"
+#include "h9972.h"
+int main_277() { return 0; }
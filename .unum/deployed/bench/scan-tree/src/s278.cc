@@ -0,0 +1,6 @@
+#include "h790.h"
+#include "h7590.h"
+#include "h1368.h"
+#include "h2530.h"
+#include "h9150.h"
+int main_278() { return 0; }
@@ -0,0 +1,6 @@
+#include "h805.h"
+#include "h5901.h"
+#include "h9381.h"
+#include "h4358.h"
+#include "h5191.h"
+int main_279() { return 0; }
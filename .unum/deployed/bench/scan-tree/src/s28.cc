@@ -0,0 +1,6 @@
+#include "h1817.h"
+#include "h9049.h"
+#include "h5460.h"
+#include "h3756.h"
+#include "h9811.h"
+int main_28() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9718.h"
+#include "h477.h"
+#include "h2110.h"
+#include "h7064.h"
+#include "h8837.h"
+#if 0
+#include "h4211.h"
+#endif
+int main_280() { return 0; }
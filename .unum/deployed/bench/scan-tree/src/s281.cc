@@ -0,0 +1,6 @@
+#include "h9231.h"
+#include "h3224.h"
+#include "h7084.h"
+#include "h5514.h"
+#include "h9656.h"
+int main_281() { return 0; }
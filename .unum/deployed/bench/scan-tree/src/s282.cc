@@ -0,0 +1,6 @@
+#include "h7441.h"
+#include "h6787.h"
+#include "h7206.h"
+#include "h1437.h"
+#include "h5848.h"
+int main_282() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1300.h"
+#include "h7988.h"
+#include "h5822.h"
+#include "h6147.h"
+#include "h6670.h"
+int main_283() { return 0; }
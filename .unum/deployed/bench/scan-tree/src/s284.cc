@@ -0,0 +1,6 @@
+#include "h4521.h"
+#include "h8614.h"
+#include "h3631.h"
+#include "h8914.h"
+#include "h4343.h"
+int main_284() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2907.h"
+#include "h6291.h"
+#include "h9200.h"
+#include "h8272.h"
+#include "h887.h"
+#if 0
+#include "h1287.h"
+#endif
+int main_285() { return 0; }
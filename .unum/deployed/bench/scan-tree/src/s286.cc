@@ -0,0 +1,6 @@
+#include "h3202.h"
+#include "h2051.h"
+#include "h3230.h"
+#include "h3029.h"
+#include "h9673.h"
+int main_286() { return 0; }
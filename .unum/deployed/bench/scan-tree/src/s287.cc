@@ -0,0 +1,6 @@
+#include "h8886.h"
+#include "h4941.h"
+#include "h8233.h"
+#include "h4893.h"
+#include "h5383.h"
+int main_287() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9762.h"
+#include "h9985.h"
+#include "h6658.h"
+#include "h3538.h"
+#include "h3233.h"
+int main_288() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7958.h"
+#include "h7487.h"
+#include "h2911.h"
+#include "h2404.h"
+#include "h9237.h"
+int main_289() { return 0; }
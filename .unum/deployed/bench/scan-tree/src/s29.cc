@@ -0,0 +1,6 @@
+#include "h9951.h"
+#include "h4236.h"
+#include "h3606.h"
+#include "h488.h"
+#include "h6227.h"
+int main_29() { return 0; }
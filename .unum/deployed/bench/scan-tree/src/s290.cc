@@ -0,0 +1,9 @@
+#include "h5325.h"
+#include "h9795.h"
+#include "h8159.h"
+#include "h2405.h"
+#include "h160.h"
+#if 0
+#include "h3959.h"
+#endif
+int main_290() { return 0; }
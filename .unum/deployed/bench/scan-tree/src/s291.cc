@@ -0,0 +1,6 @@
+#include "h8805.h"
+#include "h7585.h"
+#include "h3339.h"
+#include "h7856.h"
+#include "h9621.h"
+int main_291() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4986.h"
+#include "h9458.h"
+#include "h9098.h"
+#include "h7384.h"
+#include "h3157.h"
+int main_292() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8123.h"
+#include "h12.h"
+#include "h7901.h"
+#include "h1189.h"
+#include "h1525.h"
+int main_293() { return 0; }
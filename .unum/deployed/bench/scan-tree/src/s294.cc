@@ -0,0 +1,6 @@
+#include "h7519.h"
+#include "h2373.h"
+#include "h5855.h"
+#include "h8096.h"
+#include "h8139.h"
+int main_294() { return 0; }
@@ -0,0 +1,9 @@
+#include "h760.h"
+#include "h2900.h"
+#include "h4162.h"
+#include "h4479.h"
+#include "h9554.h"
+#if 0
+#include "h4076.h"
+#endif
+int main_295() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4794.h"
+#include "h5881.h"
+#include "h3220.h"
+#include "h178.h"
+#include "h2304.h"
+int main_296() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7633.h"
+#include "h2699.h"
+#include "h4341.h"
+#include "h4246.h"
+#include "h2742.h"
+int main_297() { return 0; }
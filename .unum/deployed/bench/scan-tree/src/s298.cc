@@ -0,0 +1,6 @@
+#include "h8063.h"
+#include "h1944.h"
+#include "h2332.h"
+#include "h5050.h"
+#include "h8684.h"
+int main_298() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3789.h"
+#include "h3322.h"
+#include "h5580.h"
+#include "h7356.h"
+#include "h9504.h"
+int main_299() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5984.h"
+#include "h222.h"
+#include "h257.h"
+#include "h278.h"
+#include "h6709.h"
+int main_3() { return 0; }
@@ -0,0 +1,9 @@
+#include "h725.h"
+#include "h414.h"
+#include "h9071.h"
+#include "h1264.h"
+#include "h3965.h"
+#if 0
+#include "h5147.h"
+#endif
+int main_30() { return 0; }
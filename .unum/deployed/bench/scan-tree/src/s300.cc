@@ -0,0 +1,9 @@
+#include "h4158.h"
+#include "h6716.h"
+#include "h1260.h"
+#include "h8640.h"
+#include "h5941.h"
+#if 0
+#include "h9874.h"
+#endif
+int main_300() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9457.h"
+#include "h7195.h"
+#include "h8782.h"
+#include "h7794.h"
+#include "h2432.h"
+int main_301() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8254.h"
+#include "h2246.h"
+#include "h9161.h"
+#include "h5185.h"
+#include "h9051.h"
+int main_302() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9194.h"
+#include "h7829.h"
+#include "h498.h"
+#include "h7120.h"
+#include "h7149.h"
+int main_303() { return 0; }
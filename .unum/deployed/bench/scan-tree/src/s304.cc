@@ -0,0 +1,6 @@
+#include "h6004.h"
+#include "h4419.h"
+#include "h1230.h"
+#include "h6771.h"
+#include "h1647.h"
+int main_304() { return 0; }
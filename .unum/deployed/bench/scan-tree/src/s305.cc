@@ -0,0 +1,9 @@
+#include "h2109.h"
+#include "h3213.h"
+#include "h5749.h"
+#include "h5262.h"
+#include "h4570.h"
+#if 0
+#include "h5722.h"
+#endif
+int main_305() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1423.h"
+#include "h5477.h"
+#include "h8508.h"
+#include "h3776.h"
+#include "h6326.h"
+int main_306() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3527.h"
+#include "h2586.h"
+#include "h7343.h"
+#include "h5378.h"
+#include "h9604.h"
+int main_307() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4716.h"
+#include "h8153.h"
+#include "h2790.h"
+#include "h1214.h"
+#include "h8097.h"
+int main_308() { return 0; }
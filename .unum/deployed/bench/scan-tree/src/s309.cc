@@ -0,0 +1,6 @@
+#include "h9844.h"
+#include "h5602.h"
+#include "h6217.h"
+#include "h3945.h"
+#include "h3973.h"
+int main_309() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3758.h"
+#include "h8050.h"
+#include "h8714.h"
+#include "h6360.h"
+#include "h3476.h"
+int main_31() { return 0; }
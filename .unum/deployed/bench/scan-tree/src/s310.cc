@@ -0,0 +1,9 @@
+#include "h4192.h"
+#include "h6278.h"
+#include "h1787.h"
+#include "h663.h"
+#include "h3212.h"
+#if 0
+#include "h1795.h"
+#endif
+int main_310() { return 0; }
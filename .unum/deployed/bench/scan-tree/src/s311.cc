@@ -0,0 +1,6 @@
+#include "h6054.h"
+#include "h1252.h"
+#include "h8500.h"
+#include "h5771.h"
+#include "h2498.h"
+int main_311() { return 0; }
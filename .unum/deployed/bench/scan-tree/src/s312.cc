@@ -0,0 +1,6 @@
+#include "h3396.h"
+#include "h2233.h"
+#include "h7718.h"
+#include "h8938.h"
+#include "h7939.h"
+int main_312() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6373.h"
+#include "h4756.h"
+#include "h5287.h"
+#include "h8705.h"
+#include "h5391.h"
+int main_313() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2070.h"
+#include "h9121.h"
+#include "h6758.h"
+#include "h9284.h"
+#include "h4422.h"
+int main_314() { return 0; }
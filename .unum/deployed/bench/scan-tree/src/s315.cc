@@ -0,0 +1,9 @@
+#include "h3063.h"
+#include "h131.h"
+#include "h2681.h"
+#include "h3662.h"
+#include "h6341.h"
+#if 0
+#include "h8731.h"
+#endif
+int main_315() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8872.h"
+#include "h1700.h"
+#include "h6326.h"
+#include "h924.h"
+#include "h7483.h"
+int main_316() { return 0; }
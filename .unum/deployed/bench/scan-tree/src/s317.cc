@@ -0,0 +1,6 @@
+#include "h7411.h"
+#include "h8662.h"
+#include "h3786.h"
+#include "h2288.h"
+#include "h9418.h"
+int main_317() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9896.h"
+#include "h6003.h"
+#include "h1997.h"
+#include "h9700.h"
+#include "h3893.h"
+int main_318() { return 0; }
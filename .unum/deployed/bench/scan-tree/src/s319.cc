@@ -0,0 +1,6 @@
+#include "h4207.h"
+#include "h7777.h"
+#include "h5387.h"
+#include "h2284.h"
+#include "h2086.h"
+int main_319() { return 0; }
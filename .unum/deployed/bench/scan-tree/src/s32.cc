@@ -0,0 +1,6 @@
+#include "h1125.h"
+#include "h4684.h"
+#include "h5309.h"
+#include "h2583.h"
+#include "h8364.h"
+int main_32() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4152.h"
+#include "h2831.h"
+#include "h356.h"
+#include "h9072.h"
+#include "h5683.h"
+#if 0
+#include "h3607.h"
+#endif
+int main_320() { return 0; }
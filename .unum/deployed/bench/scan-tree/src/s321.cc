@@ -0,0 +1,6 @@
+#include "h2282.h"
+#include "h9399.h"
+#include "h7485.h"
+#include "h228.h"
+#include "h1975.h"
+int main_321() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7808.h"
+#include "h7713.h"
+#include "h6506.h"
+#include "h2827.h"
+#include "h5518.h"
+int main_322() { return 0; }
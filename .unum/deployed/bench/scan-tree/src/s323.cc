@@ -0,0 +1,6 @@
+#include "h7993.h"
+#include "h5876.h"
+#include "h7994.h"
+#include "h7633.h"
+#include "h1440.h"
+int main_323() { return 0; }
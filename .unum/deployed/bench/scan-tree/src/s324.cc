@@ -0,0 +1,6 @@
+#include "h6938.h"
+#include "h5578.h"
+#include "h1448.h"
+#include "h1672.h"
+#include "h2787.h"
+int main_324() { return 0; }
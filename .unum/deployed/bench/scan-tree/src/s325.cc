@@ -0,0 +1,9 @@
+#include "h7149.h"
+#include "h8301.h"
+#include "h619.h"
+#include "h8308.h"
+#include "h9270.h"
+#if 0
+#include "h4874.h"
+#endif
+int main_325() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3776.h"
+#include "h4535.h"
+#include "h4203.h"
+#include "h998.h"
+#include "h8524.h"
+int main_326() { return 0; }
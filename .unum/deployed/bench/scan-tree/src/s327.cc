@@ -0,0 +1,6 @@
+#include "h7039.h"
+#include "h8043.h"
+#include "h829.h"
+#include "h5117.h"
+#include "h6659.h"
+int main_327() { return 0; }
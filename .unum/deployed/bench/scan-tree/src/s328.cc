@@ -0,0 +1,6 @@
+#include "h8492.h"
+#include "h9174.h"
+#include "h5393.h"
+#include "h7227.h"
+#include "h1353.h"
+int main_328() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7559.h"
+#include "h5743.h"
+#include "h6468.h"
+#include "h7730.h"
+#include "h2972.h"
+int main_329() { return 0; }
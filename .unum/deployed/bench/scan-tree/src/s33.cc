@@ -0,0 +1,6 @@
+#include "h7334.h"
+#include "h2961.h"
+#include "h4415.h"
+#include "h337.h"
+#include "h4040.h"
+int main_33() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1194.h"
+#include "h7073.h"
+#include "h2529.h"
+#include "h1172.h"
+#include "h184.h"
+#if 0
+#include "h2841.h"
+#endif
+int main_330() { return 0; }
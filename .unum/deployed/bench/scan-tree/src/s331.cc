@@ -0,0 +1,6 @@
+#include "h2993.h"
+#include "h8624.h"
+#include "h6834.h"
+#include "h5081.h"
+#include "h6452.h"
+int main_331() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1590.h"
+#include "h5329.h"
+#include "h4805.h"
+#include "h5717.h"
+#include "h3987.h"
+int main_332() { return 0; }
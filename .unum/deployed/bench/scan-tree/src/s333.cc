@@ -0,0 +1,6 @@
+#include "h2960.h"
+#include "h2293.h"
+#include "h1870.h"
+#include "h4019.h"
+#include "h3060.h"
+int main_333() { return 0; }
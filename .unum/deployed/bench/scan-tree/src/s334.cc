@@ -0,0 +1,6 @@
+#include "h536.h"
+#include "h4299.h"
+#include "h6783.h"
+#include "h8568.h"
+#include "h3206.h"
+int main_334() { return 0; }
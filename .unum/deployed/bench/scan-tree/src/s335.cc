@@ -0,0 +1,9 @@
+#include "h7391.h"
+#include "h8050.h"
+#include "h5373.h"
+#include "h9174.h"
+#include "h4238.h"
+#if 0
+#include "h4835.h"
+#endif
+int main_335() { return 0; }
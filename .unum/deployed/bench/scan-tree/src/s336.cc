@@ -0,0 +1,6 @@
+#include "h745.h"
+#include "h2105.h"
+#include "h6166.h"
+#include "h382.h"
+#include "h8762.h"
+int main_336() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5623.h"
+#include "h2209.h"
+#include "h9337.h"
+#include "h7017.h"
+#include "h8466.h"
+int main_337() { return 0; }
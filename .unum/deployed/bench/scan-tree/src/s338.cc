@@ -0,0 +1,6 @@
+#include "h414.h"
+#include "h3320.h"
+#include "h9126.h"
+#include "h8829.h"
+#include "h3348.h"
+int main_338() { return 0; }
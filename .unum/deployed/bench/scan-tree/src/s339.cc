@@ -0,0 +1,6 @@
+#include "h6577.h"
+#include "h6778.h"
+#include "h8927.h"
+#include "h2021.h"
+#include "h3183.h"
+int main_339() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8010.h"
+#include "h3703.h"
+#include "h5146.h"
+#include "h7264.h"
+#include "h9086.h"
+int main_34() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7090.h"
+#include "h1844.h"
+#include "h1978.h"
+#include "h9799.h"
+#include "h8701.h"
+#if 0
+#include "h6828.h"
+#endif
+int main_340() { return 0; }
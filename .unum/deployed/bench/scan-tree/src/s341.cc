@@ -0,0 +1,6 @@
+#include "h2126.h"
+#include "h8284.h"
+#include "h1188.h"
+#include "h8240.h"
+#include "h4437.h"
+int main_341() { return 0; }
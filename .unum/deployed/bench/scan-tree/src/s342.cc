@@ -0,0 +1,6 @@
+#include "h6343.h"
+#include "h3079.h"
+#include "h4941.h"
+#include "h410.h"
+#include "h7332.h"
+int main_342() { return 0; }
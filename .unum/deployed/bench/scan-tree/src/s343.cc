@@ -0,0 +1,6 @@
+#include "h1277.h"
+#include "h9065.h"
+#include "h6588.h"
+#include "h5646.h"
+#include "h2387.h"
+int main_343() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8580.h"
+#include "h771.h"
+#include "h7217.h"
+#include "h4371.h"
+#include "h4632.h"
+int main_344() { return 0; }
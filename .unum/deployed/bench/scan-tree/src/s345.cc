@@ -0,0 +1,9 @@
+#include "h3414.h"
+#include "h7903.h"
+#include "h5026.h"
+#include "h9682.h"
+#include "h8393.h"
+#if 0
+#include "h8373.h"
+#endif
+int main_345() { return 0; }
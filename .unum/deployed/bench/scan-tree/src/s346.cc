@@ -0,0 +1,6 @@
+#include "h4119.h"
+#include "h6919.h"
+#include "h6188.h"
+#include "h6747.h"
+#include "h2053.h"
+int main_346() { return 0; }
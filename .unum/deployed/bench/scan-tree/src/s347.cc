@@ -0,0 +1,6 @@
+#include "h3894.h"
+#include "h7261.h"
+#include "h78.h"
+#include "h9104.h"
+#include "h1958.h"
+int main_347() { return 0; }
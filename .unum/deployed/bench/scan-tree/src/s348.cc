@@ -0,0 +1,6 @@
+#include "h8127.h"
+#include "h2203.h"
+#include "h6801.h"
+#include "h2182.h"
+#include "h1329.h"
+int main_348() { return 0; }
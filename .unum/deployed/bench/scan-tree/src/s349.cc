@@ -0,0 +1,6 @@
+#include "h1270.h"
+#include "h4051.h"
+#include "h6495.h"
+#include "h6857.h"
+#include "h4651.h"
+int main_349() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4137.h"
+#include "h4396.h"
+#include "h988.h"
+#include "h9305.h"
+#include "h100.h"
+#if 0
+#include "h9170.h"
+#endif
+int main_35() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2167.h"
+#include "h2205.h"
+#include "h172.h"
+#include "h7680.h"
+#include "h4480.h"
+#if 0
+#include "h3944.h"
+#endif
+int main_350() { return 0; }
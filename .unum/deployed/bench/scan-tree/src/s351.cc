@@ -0,0 +1,6 @@
+#include "h3950.h"
+#include "h4790.h"
+#include "h2298.h"
+#include "h2674.h"
+#include "h2432.h"
+int main_351() { return 0; }
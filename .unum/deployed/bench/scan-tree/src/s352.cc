@@ -0,0 +1,6 @@
+#include "h2983.h"
+#include "h8340.h"
+#include "h6814.h"
+#include "h5155.h"
+#include "h9494.h"
+int main_352() { return 0; }
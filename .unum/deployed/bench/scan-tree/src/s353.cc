@@ -0,0 +1,6 @@
+#include "h3871.h"
+#include "h2244.h"
+#include "h9769.h"
+#include "h5855.h"
+#include "h8560.h"
+int main_353() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8904.h"
+#include "h4475.h"
+#include "h8418.h"
+#include "h4538.h"
+#include "h1272.h"
+int main_354() { return 0; }
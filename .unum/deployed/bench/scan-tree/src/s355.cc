@@ -0,0 +1,9 @@
+#include "h4139.h"
+#include "h149.h"
+#include "h9759.h"
+#include "h6734.h"
+#include "h1165.h"
+#if 0
+#include "h170.h"
+#endif
+int main_355() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6642.h"
+#include "h9759.h"
+#include "h425.h"
+#include "h9254.h"
+#include "h2030.h"
+int main_356() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7873.h"
+#include "h2796.h"
+#include "h3613.h"
+#include "h8767.h"
+#include "h1435.h"
+int main_357() { return 0; }
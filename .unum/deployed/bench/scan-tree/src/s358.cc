@@ -0,0 +1,6 @@
+#include "h4681.h"
+#include "h6383.h"
+#include "h3122.h"
+#include "h7618.h"
+#include "h1523.h"
+int main_358() { return 0; }
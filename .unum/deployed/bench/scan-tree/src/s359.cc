@@ -0,0 +1,6 @@
+#include "h2926.h"
+#include "h6248.h"
+#include "h1213.h"
+#include "h2368.h"
+#include "h9498.h"
+int main_359() { return 0; }
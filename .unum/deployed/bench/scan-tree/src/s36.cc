@@ -0,0 +1,6 @@
+#include "h837.h"
+#include "h7357.h"
+#include "h6358.h"
+#include "h2074.h"
+#include "h5225.h"
+int main_36() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4605.h"
+#include "h7762.h"
+#include "h3293.h"
+#include "h525.h"
+#include "h5786.h"
+#if 0
+#include "h8492.h"
+#endif
+int main_360() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5310.h"
+#include "h1949.h"
+#include "h619.h"
+#include "h8284.h"
+#include "h3414.h"
+int main_361() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5163.h"
+#include "h8566.h"
+#include "h2131.h"
+#include "h5656.h"
+#include "h5704.h"
+int main_362() { return 0; }
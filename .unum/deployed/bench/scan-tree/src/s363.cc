@@ -0,0 +1,6 @@
+#include "h8742.h"
+#include "h3766.h"
+#include "h4889.h"
+#include "h2431.h"
+#include "h447.h"
+int main_363() { return 0; }
@@ -0,0 +1,6 @@
+#include "h573.h"
+#include "h7269.h"
+#include "h7380.h"
+#include "h4346.h"
+#include "h1872.h"
+int main_364() { return 0; }
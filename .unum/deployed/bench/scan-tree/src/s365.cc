@@ -0,0 +1,9 @@
+#include "h6191.h"
+#include "h3702.h"
+#include "h6905.h"
+#include "h8183.h"
+#include "h8736.h"
+#if 0
+#include "h4481.h"
+#endif
+int main_365() { return 0; }
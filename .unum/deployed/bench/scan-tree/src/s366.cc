@@ -0,0 +1,6 @@
+#include "h1434.h"
+#include "h4385.h"
+#include "h5700.h"
+#include "h8583.h"
+#include "h7549.h"
+int main_366() { return 0; }
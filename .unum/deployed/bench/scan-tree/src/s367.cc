@@ -0,0 +1,6 @@
+#include "h4693.h"
+#include "h9529.h"
+#include "h5846.h"
+#include "h8405.h"
+#include "h6491.h"
+int main_367() { return 0; }
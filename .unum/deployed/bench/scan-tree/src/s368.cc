@@ -0,0 +1,6 @@
+#include "h3027.h"
+#include "h2400.h"
+#include "h360.h"
+#include "h4894.h"
+#include "h7583.h"
+int main_368() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7352.h"
+#include "h1130.h"
+#include "h6056.h"
+#include "h6683.h"
+#include "h2944.h"
+int main_369() { return 0; }
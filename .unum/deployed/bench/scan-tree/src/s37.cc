@@ -0,0 +1,6 @@
+#include "h3373.h"
+#include "h4717.h"
+#include "h2724.h"
+#include "h7447.h"
+#include "h828.h"
+int main_37() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9747.h"
+#include "h3375.h"
+#include "h1118.h"
+#include "h4091.h"
+#include "h7503.h"
+#if 0
+#include "h9962.h"
+#endif
+int main_370() { return 0; }
@@ -0,0 +1,6 @@
+#include "h845.h"
+#include "h9698.h"
+#include "h1501.h"
+#include "h9608.h"
+#include "h8871.h"
+int main_371() { return 0; }
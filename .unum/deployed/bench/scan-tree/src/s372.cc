@@ -0,0 +1,6 @@
+#include "h7606.h"
+#include "h8770.h"
+#include "h7755.h"
+#include "h3330.h"
+#include "h5633.h"
+int main_372() { return 0; }
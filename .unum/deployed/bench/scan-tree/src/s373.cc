@@ -0,0 +1,6 @@
+#include "h7994.h"
+#include "h8979.h"
+#include "h615.h"
+#include "h1790.h"
+#include "h8130.h"
+int main_373() { return 0; }
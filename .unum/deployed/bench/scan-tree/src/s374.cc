@@ -0,0 +1,6 @@
+#include "h9655.h"
+#include "h4719.h"
+#include "h636.h"
+#include "h5930.h"
+#include "h6869.h"
+int main_374() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3110.h"
+#include "h6360.h"
+#include "h2713.h"
+#include "h3822.h"
+#include "h5971.h"
+#if 0
+#include "h4306.h"
+#endif
+int main_375() { return 0; }
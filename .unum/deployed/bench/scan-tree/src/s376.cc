@@ -0,0 +1,6 @@
+#include "h313.h"
+#include "h2678.h"
+#include "h7280.h"
+#include "h5631.h"
+#include "h265.h"
+int main_376() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2739.h"
+#include "h9300.h"
+#include "h5629.h"
+#include "h3340.h"
+#include "h6690.h"
+int main_377() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1649.h"
+#include "h331.h"
+#include "h6027.h"
+#include "h2930.h"
+#include "h519.h"
+int main_378() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9652.h"
+#include "h1740.h"
+#include "h7735.h"
+#include "h959.h"
+#include "h8294.h"
+int main_379() { return 0; }
@@ -0,0 +1,6 @@
+#include "h828.h"
+#include "h5493.h"
+#include "h2290.h"
+#include "h2677.h"
+#include "h1561.h"
+int main_38() { return 0; }
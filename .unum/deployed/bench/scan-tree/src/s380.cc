@@ -0,0 +1,9 @@
+#include "h9021.h"
+#include "h9526.h"
+#include "h4263.h"
+#include "h1121.h"
+#include "h6595.h"
+#if 0
+#include "h9605.h"
+#endif
+int main_380() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6028.h"
+#include "h3997.h"
+#include "h3434.h"
+#include "h2203.h"
+#include "h3572.h"
+int main_381() { return 0; }
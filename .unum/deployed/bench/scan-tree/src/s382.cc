@@ -0,0 +1,6 @@
+#include "h809.h"
+#include "h9177.h"
+#include "h2757.h"
+#include "h6260.h"
+#include "h7061.h"
+int main_382() { return 0; }
@@ -0,0 +1,6 @@
+#include "h470.h"
+#include "h3742.h"
+#include "h4981.h"
+#include "h2958.h"
+#include "h8050.h"
+int main_383() { return 0; }
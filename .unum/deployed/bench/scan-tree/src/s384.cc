@@ -0,0 +1,6 @@
+#include "h3870.h"
+#include "h3362.h"
+#include "h1611.h"
+#include "h9241.h"
+#include "h3430.h"
+int main_384() { return 0; }
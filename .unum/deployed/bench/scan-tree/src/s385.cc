@@ -0,0 +1,9 @@
+#include "h6011.h"
+#include "h2484.h"
+#include "h5402.h"
+#include "h9790.h"
+#include "h2465.h"
+#if 0
+#include "h4624.h"
+#endif
+int main_385() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3659.h"
+#include "h1.h"
+#include "h6024.h"
+#include "h3608.h"
+#include "h947.h"
+int main_386() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6852.h"
+#include "h8230.h"
+#include "h9753.h"
+#include "h2740.h"
+#include "h5985.h"
+int main_387() { return 0; }
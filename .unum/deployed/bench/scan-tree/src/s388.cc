@@ -0,0 +1,6 @@
+#include "h2843.h"
+#include "h609.h"
+#include "h4979.h"
+#include "h473.h"
+#include "h8265.h"
+int main_388() { return 0; }
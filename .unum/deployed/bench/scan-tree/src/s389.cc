@@ -0,0 +1,6 @@
+#include "h7203.h"
+#include "h8433.h"
+#include "h1876.h"
+#include "h7424.h"
+#include "h9150.h"
+int main_389() { return 0; }
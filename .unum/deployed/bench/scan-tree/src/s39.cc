@@ -0,0 +1,6 @@
+#include "h3954.h"
+#include "h3334.h"
+#include "h4747.h"
+#include "h7182.h"
+#include "h7570.h"
+int main_39() { return 0; }
@@ -0,0 +1,9 @@
+#include "h954.h"
+#include "h7020.h"
+#include "h8956.h"
+#include "h9535.h"
+#include "h6940.h"
+#if 0
+#include "h9474.h"
+#endif
+int main_390() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8242.h"
+#include "h6026.h"
+#include "h3844.h"
+#include "h2236.h"
+#include "h6351.h"
+int main_391() { return 0; }
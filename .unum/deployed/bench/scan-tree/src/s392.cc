@@ -0,0 +1,6 @@
+#include "h1247.h"
+#include "h7752.h"
+#include "h8801.h"
+#include "h7552.h"
+#include "h3430.h"
+int main_392() { return 0; }
@@ -0,0 +1,6 @@
+#include "h679.h"
+#include "h794.h"
+#include "h322.h"
+#include "h778.h"
+#include "h1768.h"
+int main_393() { return 0; }
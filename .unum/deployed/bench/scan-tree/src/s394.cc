@@ -0,0 +1,6 @@
+#include "h3126.h"
+#include "h7640.h"
+#include "h4883.h"
+#include "h3941.h"
+#include "h3255.h"
+int main_394() { return 0; }
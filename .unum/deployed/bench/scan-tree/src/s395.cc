@@ -0,0 +1,9 @@
+#include "h7658.h"
+#include "h5762.h"
+#include "h2939.h"
+#include "h4011.h"
+#include "h1678.h"
+#if 0
+#include "h9883.h"
+#endif
+int main_395() { return 0; }
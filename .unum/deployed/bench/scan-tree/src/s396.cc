@@ -0,0 +1,6 @@
+#include "h9731.h"
+#include "h605.h"
+#include "h4570.h"
+#include "h7663.h"
+#include "h7266.h"
+int main_396() { return 0; }
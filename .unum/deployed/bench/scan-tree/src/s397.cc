@@ -0,0 +1,6 @@
+#include "h7784.h"
+#include "h5900.h"
+#include "h2196.h"
+#include "h6486.h"
+#include "h9997.h"
+int main_397() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8950.h"
+#include "h6299.h"
+#include "h9165.h"
+#include "h7262.h"
+#include "h3087.h"
+int main_398() { return 0; }
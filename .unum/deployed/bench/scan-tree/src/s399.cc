@@ -0,0 +1,6 @@
+#include "h5344.h"
+#include "h7669.h"
+#include "h2257.h"
+#include "h5812.h"
+#include "h2438.h"
+int main_399() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6774.h"
+#include "h9889.h"
+#include "h7326.h"
+#include "h4197.h"
+#include "h6632.h"
+int main_4() { return 0; }
@@ -0,0 +1,9 @@
+#include "h104.h"
+#include "h2592.h"
+#include "h4063.h"
+#include "h7914.h"
+#include "h6182.h"
+#if 0
+#include "h7901.h"
+#endif
+int main_40() { return 0; }
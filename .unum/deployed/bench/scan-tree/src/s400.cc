@@ -0,0 +1,9 @@
+#include "h3737.h"
+#include "h203.h"
+#include "h3257.h"
+#include "h2234.h"
+#include "h2196.h"
+#if 0
+#include "h4551.h"
+#endif
+int main_400() { return 0; }
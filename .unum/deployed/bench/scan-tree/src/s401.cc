@@ -0,0 +1,6 @@
+#include "h1259.h"
+#include "h5269.h"
+#include "h2243.h"
+#include "h1642.h"
+#include "h3117.h"
+int main_401() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2431.h"
+#include "h3889.h"
+#include "h7074.h"
+#include "h678.h"
+#include "h6154.h"
+int main_402() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7912.h"
+#include "h1279.h"
+#include "h760.h"
+#include "h7823.h"
+#include "h4840.h"
+int main_403() { return 0; }
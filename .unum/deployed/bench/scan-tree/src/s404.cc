@@ -0,0 +1,6 @@
+#include "h9791.h"
+#include "h3461.h"
+#include "h6906.h"
+#include "h7454.h"
+#include "h6174.h"
+int main_404() { return 0; }
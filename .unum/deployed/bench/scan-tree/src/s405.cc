@@ -0,0 +1,9 @@
+#include "h9562.h"
+#include "h4273.h"
+#include "h1186.h"
+#include "h2049.h"
+#include "h1279.h"
+#if 0
+#include "h7704.h"
+#endif
+int main_405() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6392.h"
+#include "h8462.h"
+#include "h5044.h"
+#include "h1398.h"
+#include "h6.h"
+int main_406() { return 0; }
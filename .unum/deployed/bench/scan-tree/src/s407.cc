@@ -0,0 +1,6 @@
+#include "h3028.h"
+#include "h3806.h"
+#include "h1355.h"
+#include "h1088.h"
+#include "h6813.h"
+int main_407() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9063.h"
+#include "h3170.h"
+#include "h3051.h"
+#include "h2586.h"
+#include "h4040.h"
+int main_408() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2684.h"
+#include "h3276.h"
+#include "h7165.h"
+#include "h3217.h"
+#include "h5574.h"
+int main_409() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4855.h"
+#include "h8434.h"
+#include "h2939.h"
+#include "h463.h"
+#include "h3132.h"
+int main_41() { return 0; }
@@ -0,0 +1,9 @@
+#include "h591.h"
+#include "h9455.h"
+#include "h7850.h"
+#include "h8946.h"
+#include "h4920.h"
+#if 0
+#include "h2285.h"
+#endif
+int main_410() { return 0; }
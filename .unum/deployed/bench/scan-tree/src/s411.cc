@@ -0,0 +1,6 @@
+#include "h1578.h"
+#include "h7021.h"
+#include "h7133.h"
+#include "h7086.h"
+#include "h923.h"
+int main_411() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6203.h"
+#include "h182.h"
+#include "h3107.h"
+#include "h4217.h"
+#include "h7877.h"
+int main_412() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7868.h"
+#include "h2246.h"
+#include "h6033.h"
+#include "h6107.h"
+#include "h4425.h"
+int main_413() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3629.h"
+#include "h7931.h"
+#include "h3091.h"
+#include "h2545.h"
+#include "h5916.h"
+int main_414() { return 0; }
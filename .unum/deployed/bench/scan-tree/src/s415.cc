@@ -0,0 +1,9 @@
+#include "h6631.h"
+#include "h1362.h"
+#include "h5851.h"
+#include "h3191.h"
+#include "h2563.h"
+#if 0
+#include "h4220.h"
+#endif
+int main_415() { return 0; }
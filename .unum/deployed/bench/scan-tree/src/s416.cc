@@ -0,0 +1,6 @@
+#include "h9821.h"
+#include "h1943.h"
+#include "h4693.h"
+#include "h7471.h"
+#include "h1882.h"
+int main_416() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2748.h"
+#include "h7871.h"
+#include "h5337.h"
+#include "h3174.h"
+#include "h7586.h"
+int main_417() { return 0; }
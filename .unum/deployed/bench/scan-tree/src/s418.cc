@@ -0,0 +1,6 @@
+#include "h4143.h"
+#include "h6063.h"
+#include "h4247.h"
+#include "h4548.h"
+#include "h5139.h"
+int main_418() { return 0; }
@@ -0,0 +1,6 @@
+#include "h756.h"
+#include "h7208.h"
+#include "h7872.h"
+#include "h9600.h"
+#include "h8911.h"
+int main_419() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6544.h"
+#include "h8456.h"
+#include "h4951.h"
+#include "h2559.h"
+#include "h9399.h"
+int main_42() { return 0; }
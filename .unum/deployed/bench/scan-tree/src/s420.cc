@@ -0,0 +1,9 @@
+#include "h2338.h"
+#include "h9295.h"
+#include "h6966.h"
+#include "h7321.h"
+#include "h4678.h"
+#if 0
+#include "h9686.h"
+#endif
+int main_420() { return 0; }
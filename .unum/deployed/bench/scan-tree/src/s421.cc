@@ -0,0 +1,6 @@
+#include "h3339.h"
+#include "h6651.h"
+#include "h4647.h"
+#include "h6142.h"
+#include "h5417.h"
+int main_421() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2127.h"
+#include "h6950.h"
+#include "h9500.h"
+#include "h5911.h"
+#include "h7430.h"
+int main_422() { return 0; }
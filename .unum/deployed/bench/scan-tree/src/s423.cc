@@ -0,0 +1,6 @@
+#include "h2190.h"
+#include "h1808.h"
+#include "h6652.h"
+#include "h8511.h"
+#include "h941.h"
+int main_423() { return 0; }
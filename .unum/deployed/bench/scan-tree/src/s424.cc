@@ -0,0 +1,6 @@
+#include "h5630.h"
+#include "h7774.h"
+#include "h7688.h"
+#include "h6081.h"
+#include "h7915.h"
+int main_424() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1199.h"
+#include "h7960.h"
+#include "h5640.h"
+#include "h6831.h"
+#include "h4805.h"
+#if 0
+#include "h611.h"
+#endif
+int main_425() { return 0; }
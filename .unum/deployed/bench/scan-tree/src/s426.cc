@@ -0,0 +1,6 @@
+#include "h4509.h"
+#include "h179.h"
+#include "h5084.h"
+#include "h8140.h"
+#include "h4599.h"
+int main_426() { return 0; }
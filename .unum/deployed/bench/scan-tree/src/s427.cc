@@ -0,0 +1,6 @@
+#include "h9706.h"
+#include "h5149.h"
+#include "h6006.h"
+#include "h3986.h"
+#include "h7738.h"
+int main_427() { return 0; }
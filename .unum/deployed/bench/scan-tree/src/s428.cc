@@ -0,0 +1,6 @@
+#include "h1346.h"
+#include "h8926.h"
+#include "h4939.h"
+#include "h4969.h"
+#include "h201.h"
+int main_428() { return 0; }
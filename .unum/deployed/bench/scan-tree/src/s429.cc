@@ -0,0 +1,6 @@
+#include "h2415.h"
+#include "h6014.h"
+#include "h3548.h"
+#include "h5121.h"
+#include "h1200.h"
+int main_429() { return 0; }
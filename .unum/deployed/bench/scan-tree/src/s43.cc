@@ -0,0 +1,6 @@
+#include "h3925.h"
+#include "h5631.h"
+#include "h7567.h"
+#include "h1735.h"
+#include "h183.h"
+int main_43() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1359.h"
+#include "h3379.h"
+#include "h2488.h"
+#include "h683.h"
+#include "h252.h"
+#if 0
+#include "h8339.h"
+#endif
+int main_430() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2354.h"
+#include "h3517.h"
+#include "h3888.h"
+#include "h5220.h"
+#include "h1708.h"
+int main_431() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4210.h"
+#include "h2301.h"
+#include "h8459.h"
+#include "h801.h"
+#include "h5208.h"
+int main_432() { return 0; }
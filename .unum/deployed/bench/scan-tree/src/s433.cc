@@ -0,0 +1,6 @@
+#include "h6795.h"
+#include "h1802.h"
+#include "h6886.h"
+#include "h1773.h"
+#include "h4740.h"
+int main_433() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2810.h"
+#include "h380.h"
+#include "h8875.h"
+#include "h6145.h"
+#include "h6316.h"
+int main_434() { return 0; }
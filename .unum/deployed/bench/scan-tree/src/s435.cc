@@ -0,0 +1,9 @@
+#include "h5507.h"
+#include "h7558.h"
+#include "h9157.h"
+#include "h1921.h"
+#include "h9601.h"
+#if 0
+#include "h6286.h"
+#endif
+int main_435() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7439.h"
+#include "h4996.h"
+#include "h1021.h"
+#include "h6971.h"
+#include "h3383.h"
+int main_436() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5679.h"
+#include "h7171.h"
+#include "h7266.h"
+#include "h5055.h"
+#include "h898.h"
+int main_437() { return 0; }
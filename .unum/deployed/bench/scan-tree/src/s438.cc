@@ -0,0 +1,6 @@
+#include "h6273.h"
+#include "h2145.h"
+#include "h1541.h"
+#include "h448.h"
+#include "h1714.h"
+int main_438() { return 0; }
@@ -0,0 +1,6 @@
+#include "h31.h"
+#include "h2385.h"
+#include "h9556.h"
+#include "h4055.h"
+#include "h2576.h"
+int main_439() { return 0; }
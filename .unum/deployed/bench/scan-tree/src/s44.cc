@@ -0,0 +1,6 @@
+#include "h5775.h"
+#include "h7339.h"
+#include "h5309.h"
+#include "h8325.h"
+#include "h3103.h"
+int main_44() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8698.h"
+#include "h2014.h"
+#include "h5435.h"
+#include "h964.h"
+#include "h5469.h"
+#if 0
+#include "h5781.h"
+#endif
+int main_440() { return 0; }
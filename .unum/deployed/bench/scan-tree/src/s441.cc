@@ -0,0 +1,6 @@
+#include "h9143.h"
+#include "h5407.h"
+#include "h4624.h"
+#include "h7560.h"
+#include "h3373.h"
+int main_441() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8557.h"
+#include "h5263.h"
+#include "h8732.h"
+#include "h6510.h"
+#include "h6616.h"
+int main_442() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4502.h"
+#include "h8831.h"
+#include "h215.h"
+#include "h8761.h"
+#include "h4174.h"
+int main_443() { return 0; }
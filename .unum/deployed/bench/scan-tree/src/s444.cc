@@ -0,0 +1,6 @@
+#include "h6475.h"
+#include "h1587.h"
+#include "h5534.h"
+#include "h5690.h"
+#include "h2649.h"
+int main_444() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1919.h"
+#include "h261.h"
+#include "h9812.h"
+#include "h244.h"
+#include "h8561.h"
+#if 0
+#include "h2026.h"
+#endif
+int main_445() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1911.h"
+#include "h1411.h"
+#include "h6774.h"
+#include "h5174.h"
+#include "h3880.h"
+int main_446() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1185.h"
+#include "h1577.h"
+#include "h494.h"
+#include "h749.h"
+#include "h6737.h"
+int main_447() { return 0; }
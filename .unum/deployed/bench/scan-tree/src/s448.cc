@@ -0,0 +1,6 @@
+#include "h5917.h"
+#include "h1802.h"
+#include "h8950.h"
+#include "h1891.h"
+#include "h6680.h"
+int main_448() { return 0; }
@@ -0,0 +1,6 @@
+#include "h423.h"
+#include "h3314.h"
+#include "h8581.h"
+#include "h8198.h"
+#include "h1263.h"
+int main_449() { return 0; }
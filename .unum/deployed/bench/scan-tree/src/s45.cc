@@ -0,0 +1,9 @@
+#include "h3004.h"
+#include "h1087.h"
+#include "h5878.h"
+#include "h983.h"
+#include "h605.h"
+#if 0
+#include "h7305.h"
+#endif
+int main_45() { return 0; }
@@ -0,0 +1,9 @@
+#include "h436.h"
+#include "h5456.h"
+#include "h4898.h"
+#include "h509.h"
+#include "h5941.h"
+#if 0
+#include "h6169.h"
+#endif
+int main_450() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3843.h"
+#include "h1278.h"
+#include "h5835.h"
+#include "h3036.h"
+#include "h9388.h"
+int main_451() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5027.h"
+#include "h5940.h"
+#include "h1751.h"
+#include "h1770.h"
+#include "h8082.h"
+int main_452() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7505.h"
+#include "h5752.h"
+#include "h2409.h"
+#include "h6604.h"
+#include "h525.h"
+int main_453() { return 0; }
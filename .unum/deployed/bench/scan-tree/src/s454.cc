@@ -0,0 +1,6 @@
+#include "h3248.h"
+#include "h3273.h"
+#include "h271.h"
+#include "h2286.h"
+#include "h9589.h"
+int main_454() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3631.h"
+#include "h9556.h"
+#include "h7565.h"
+#include "h1961.h"
+#include "h4985.h"
+#if 0
+#include "h2367.h"
+#endif
+int main_455() { return 0; }
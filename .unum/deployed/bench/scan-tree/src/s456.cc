@@ -0,0 +1,6 @@
+#include "h2544.h"
+#include "h9736.h"
+#include "h1779.h"
+#include "h1268.h"
+#include "h8128.h"
+int main_456() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6574.h"
+#include "h5324.h"
+#include "h1895.h"
+#include "h8969.h"
+#include "h2960.h"
+int main_457() { return 0; }
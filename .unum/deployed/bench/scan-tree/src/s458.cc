@@ -0,0 +1,6 @@
+#include "h7749.h"
+#include "h8647.h"
+#include "h9283.h"
+#include "h9853.h"
+#include "h1370.h"
+int main_458() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7107.h"
+#include "h5481.h"
+#include "h4939.h"
+#include "h7228.h"
+#include "h4665.h"
+int main_459() { return 0; }
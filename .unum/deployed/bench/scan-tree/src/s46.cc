@@ -0,0 +1,6 @@
+#include "h770.h"
+#include "h6197.h"
+#include "h8925.h"
+#include "h4488.h"
+#include "h784.h"
+int main_46() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9654.h"
+#include "h2408.h"
+#include "h8930.h"
+#include "h9930.h"
+#include "h9561.h"
+#if 0
+#include "h5649.h"
+#endif
+int main_460() { return 0; }
@@ -0,0 +1,6 @@
+#include "h245.h"
+#include "h2494.h"
+#include "h4865.h"
+#include "h544.h"
+#include "h5052.h"
+int main_461() { return 0; }
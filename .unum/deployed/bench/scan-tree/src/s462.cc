@@ -0,0 +1,6 @@
+#include "h8327.h"
+#include "h1396.h"
+#include "h9075.h"
+#include "h9248.h"
+#include "h7158.h"
+int main_462() { return 0; }
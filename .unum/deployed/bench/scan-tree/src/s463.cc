@@ -0,0 +1,6 @@
+#include "h300.h"
+#include "h5998.h"
+#include "h9446.h"
+#include "h9067.h"
+#include "h3312.h"
+int main_463() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2090.h"
+#include "h20.h"
+#include "h5130.h"
+#include "h2672.h"
+#include "h3936.h"
+int main_464() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1425.h"
+#include "h3457.h"
+#include "h5513.h"
+#include "h1501.h"
+#include "h7843.h"
+#if 0
+#include "h4884.h"
+#endif
+int main_465() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5605.h"
+#include "h6026.h"
+#include "h3752.h"
+#include "h4350.h"
+#include "h8813.h"
+int main_466() { return 0; }
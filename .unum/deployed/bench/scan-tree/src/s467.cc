@@ -0,0 +1,6 @@
+#include "h5943.h"
+#include "h1782.h"
+#include "h4400.h"
+#include "h3891.h"
+#include "h7308.h"
+int main_467() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3036.h"
+#include "h1040.h"
+#include "h4861.h"
+#include "h5041.h"
+#include "h5739.h"
+int main_468() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2072.h"
+#include "h4624.h"
+#include "h9313.h"
+#include "h2340.h"
+#include "h8644.h"
+int main_469() { return 0; }
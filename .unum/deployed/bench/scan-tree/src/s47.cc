@@ -0,0 +1,6 @@
+#include "h2856.h"
+#include "h9329.h"
+#include "h7136.h"
+#include "h1232.h"
+#include "h2471.h"
+int main_47() { return 0; }
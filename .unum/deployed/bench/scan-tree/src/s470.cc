@@ -0,0 +1,9 @@
+#include "h3569.h"
+#include "h95.h"
+#include "h7379.h"
+#include "h8592.h"
+#include "h4990.h"
+#if 0
+#include "h1549.h"
+#endif
+int main_470() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7873.h"
+#include "h4903.h"
+#include "h9169.h"
+#include "h8885.h"
+#include "h6760.h"
+int main_471() { return 0; }
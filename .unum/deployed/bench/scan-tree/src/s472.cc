@@ -0,0 +1,6 @@
+#include "h2495.h"
+#include "h489.h"
+#include "h1986.h"
+#include "h1624.h"
+#include "h877.h"
+int main_472() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9993.h"
+#include "h3475.h"
+#include "h5276.h"
+#include "h6261.h"
+#include "h5808.h"
+int main_473() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9946.h"
+#include "h5794.h"
+#include "h2509.h"
+#include "h585.h"
+#include "h3382.h"
+int main_474() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9833.h"
+#include "h545.h"
+#include "h1993.h"
+#include "h8833.h"
+#include "h9174.h"
+#if 0
+#include "h4823.h"
+#endif
+int main_475() { return 0; }
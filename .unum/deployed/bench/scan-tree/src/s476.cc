@@ -0,0 +1,6 @@
+#include "h5835.h"
+#include "h7281.h"
+#include "h8333.h"
+#include "h349.h"
+#include "h4702.h"
+int main_476() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4643.h"
+#include "h2824.h"
+#include "h9162.h"
+#include "h9258.h"
+#include "h7738.h"
+int main_477() { return 0; }
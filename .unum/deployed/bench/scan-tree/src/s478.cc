@@ -0,0 +1,6 @@
+#include "h146.h"
+#include "h7570.h"
+#include "h4253.h"
+#include "h9780.h"
+#include "h4099.h"
+int main_478() { return 0; }
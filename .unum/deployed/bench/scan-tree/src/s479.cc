@@ -0,0 +1,6 @@
+#include "h4233.h"
+#include "h883.h"
+#include "h2011.h"
+#include "h9579.h"
+#include "h2813.h"
+int main_479() { return 0; }
@@ -0,0 +1,6 @@
+#include "h745.h"
+#include "h6531.h"
+#include "h4322.h"
+#include "h7481.h"
+#include "h7547.h"
+int main_48() { return 0; }
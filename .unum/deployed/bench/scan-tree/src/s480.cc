@@ -0,0 +1,9 @@
+#include "h995.h"
+#include "h7228.h"
+#include "h7844.h"
+#include "h5096.h"
+#include "h6006.h"
+#if 0
+#include "h7777.h"
+#endif
+int main_480() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7034.h"
+#include "h9077.h"
+#include "h780.h"
+#include "h2501.h"
+#include "h149.h"
+int main_481() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4530.h"
+#include "h7089.h"
+#include "h7099.h"
+#include "h1550.h"
+#include "h2590.h"
+int main_482() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4428.h"
+#include "h2045.h"
+#include "h1691.h"
+#include "h2267.h"
+#include "h5092.h"
+int main_483() { return 0; }
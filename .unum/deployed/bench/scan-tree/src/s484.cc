@@ -0,0 +1,6 @@
+#include "h1211.h"
+#include "h5106.h"
+#include "h7780.h"
+#include "h4193.h"
+#include "h7814.h"
+int main_484() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8741.h"
+#include "h506.h"
+#include "h7340.h"
+#include "h5886.h"
+#include "h8444.h"
+#if 0
+#include "h4643.h"
+#endif
+int main_485() { return 0; }
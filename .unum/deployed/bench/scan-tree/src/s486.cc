@@ -0,0 +1,6 @@
+#include "h5681.h"
+#include "h9402.h"
+#include "h5159.h"
+#include "h4544.h"
+#include "h5990.h"
+int main_486() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6219.h"
+#include "h9206.h"
+#include "h439.h"
+#include "h1111.h"
+#include "h1392.h"
+int main_487() { return 0; }
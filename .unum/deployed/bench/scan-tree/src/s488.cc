@@ -0,0 +1,6 @@
+#include "h1821.h"
+#include "h469.h"
+#include "h981.h"
+#include "h6844.h"
+#include "h5159.h"
+int main_488() { return 0; }
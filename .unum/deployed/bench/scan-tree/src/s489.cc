@@ -0,0 +1,6 @@
+#include "h3596.h"
+#include "h7250.h"
+#include "h543.h"
+#include "h7933.h"
+#include "h4573.h"
+int main_489() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1820.h"
+#include "h9921.h"
+#include "h4644.h"
+#include "h1890.h"
+#include "h5982.h"
+int main_49() { return 0; }
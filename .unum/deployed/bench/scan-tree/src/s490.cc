@@ -0,0 +1,9 @@
+#include "h378.h"
+#include "h8578.h"
+#include "h6522.h"
+#include "h7917.h"
+#include "h7776.h"
+#if 0
+#include "h7761.h"
+#endif
+int main_490() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6097.h"
+#include "h2581.h"
+#include "h9886.h"
+#include "h8636.h"
+#include "h4754.h"
+int main_491() { return 0; }
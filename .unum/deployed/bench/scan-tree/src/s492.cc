@@ -0,0 +1,6 @@
+#include "h1711.h"
+#include "h848.h"
+#include "h4939.h"
+#include "h3250.h"
+#include "h3090.h"
+int main_492() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2426.h"
+#include "h8678.h"
+#include "h8080.h"
+#include "h9884.h"
+#include "h4304.h"
+int main_493() { return 0; }
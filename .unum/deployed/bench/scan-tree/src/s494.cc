@@ -0,0 +1,6 @@
+#include "h5389.h"
+#include "h7489.h"
+#include "h6981.h"
+#include "h7902.h"
+#include "h8184.h"
+int main_494() { return 0; }
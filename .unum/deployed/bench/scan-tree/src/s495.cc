@@ -0,0 +1,9 @@
+#include "h654.h"
+#include "h7840.h"
+#include "h1718.h"
+#include "h4247.h"
+#include "h684.h"
+#if 0
+#include "h5754.h"
+#endif
+int main_495() { return 0; }
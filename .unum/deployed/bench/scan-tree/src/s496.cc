@@ -0,0 +1,6 @@
+#include "h6757.h"
+#include "h5919.h"
+#include "h3335.h"
+#include "h3692.h"
+#include "h5488.h"
+int main_496() { return 0; }
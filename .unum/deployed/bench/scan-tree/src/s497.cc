@@ -0,0 +1,6 @@
+#include "h8621.h"
+#include "h4791.h"
+#include "h543.h"
+#include "h8160.h"
+#include "h1528.h"
+int main_497() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1540.h"
+#include "h4863.h"
+#include "h1842.h"
+#include "h34.h"
+#include "h3895.h"
+int main_498() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7819.h"
+#include "h4410.h"
+#include "h4503.h"
+#include "h3075.h"
+#include "h3559.h"
+int main_499() { return 0; }
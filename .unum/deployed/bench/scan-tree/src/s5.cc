@@ -0,0 +1,9 @@
+#include "h3669.h"
+#include "h8184.h"
+#include "h2270.h"
+#include "h4216.h"
+#include "h7708.h"
+#if 0
+#include "h4605.h"
+#endif
+int main_5() { return 0; }
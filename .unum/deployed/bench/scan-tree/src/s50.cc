@@ -0,0 +1,9 @@
+#include "h4310.h"
+#include "h9298.h"
+#include "h832.h"
+#include "h9573.h"
+#include "h439.h"
+#if 0
+#include "h9751.h"
+#endif
+int main_50() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8284.h"
+#include "h6042.h"
+#include "h377.h"
+#include "h485.h"
+#include "h6119.h"
+#if 0
+#include "h1087.h"
+#endif
+int main_500() { return 0; }
@@ -0,0 +1,6 @@
+#include "h714.h"
+#include "h3454.h"
+#include "h8719.h"
+#include "h2854.h"
+#include "h4917.h"
+int main_501() { return 0; }
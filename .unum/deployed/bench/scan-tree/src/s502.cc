@@ -0,0 +1,6 @@
+#include "h1211.h"
+#include "h310.h"
+#include "h9526.h"
+#include "h343.h"
+#include "h2220.h"
+int main_502() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2976.h"
+#include "h6908.h"
+#include "h9616.h"
+#include "h8033.h"
+#include "h6644.h"
+int main_503() { return 0; }
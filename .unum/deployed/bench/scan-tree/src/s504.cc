@@ -0,0 +1,6 @@
+#include "h419.h"
+#include "h537.h"
+#include "h1433.h"
+#include "h8376.h"
+#include "h1969.h"
+int main_504() { return 0; }
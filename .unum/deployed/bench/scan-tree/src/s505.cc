@@ -0,0 +1,9 @@
+#include "h5283.h"
+#include "h6608.h"
+#include "h8689.h"
+#include "h9765.h"
+#include "h7851.h"
+#if 0
+#include "h1860.h"
+#endif
+int main_505() { return 0; }
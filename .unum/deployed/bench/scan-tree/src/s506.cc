@@ -0,0 +1,6 @@
+#include "h6487.h"
+#include "h9449.h"
+#include "h2938.h"
+#include "h7300.h"
+#include "h5150.h"
+int main_506() { return 0; }
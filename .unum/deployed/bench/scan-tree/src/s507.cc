@@ -0,0 +1,6 @@
+#include "h8193.h"
+#include "h6253.h"
+#include "h9345.h"
+#include "h9011.h"
+#include "h3740.h"
+int main_507() { return 0; }
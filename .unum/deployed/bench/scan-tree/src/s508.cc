@@ -0,0 +1,6 @@
+#include "h1665.h"
+#include "h3943.h"
+#include "h3934.h"
+#include "h1366.h"
+#include "h3049.h"
+int main_508() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9976.h"
+#include "h4333.h"
+#include "h3498.h"
+#include "h6.h"
+#include "h2961.h"
+int main_509() { return 0; }
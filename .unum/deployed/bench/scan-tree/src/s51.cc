@@ -0,0 +1,6 @@
+#include "h7207.h"
+#include "h9320.h"
+#include "h5382.h"
+#include "h1566.h"
+#include "h5659.h"
+int main_51() { return 0; }
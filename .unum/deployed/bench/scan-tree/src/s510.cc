@@ -0,0 +1,9 @@
+#include "h2394.h"
+#include "h2233.h"
+#include "h5438.h"
+#include "h5315.h"
+#include "h4326.h"
+#if 0
+#include "h3742.h"
+#endif
+int main_510() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1100.h"
+#include "h5858.h"
+#include "h3231.h"
+#include "h1541.h"
+#include "h1500.h"
+int main_511() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6855.h"
+#include "h9758.h"
+#include "h2218.h"
+#include "h1612.h"
+#include "h2776.h"
+int main_512() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9337.h"
+#include "h5286.h"
+#include "h2750.h"
+#include "h5432.h"
+#include "h7594.h"
+int main_513() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2921.h"
+#include "h7450.h"
+#include "h4843.h"
+#include "h4603.h"
+#include "h2001.h"
+int main_514() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5582.h"
+#include "h1314.h"
+#include "h3552.h"
+#include "h8278.h"
+#include "h7787.h"
+#if 0
+#include "h6739.h"
+#endif
+int main_515() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8577.h"
+#include "h3213.h"
+#include "h6702.h"
+#include "h7603.h"
+#include "h849.h"
+int main_516() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3589.h"
+#include "h2917.h"
+#include "h7586.h"
+#include "h6446.h"
+#include "h9303.h"
+int main_517() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9740.h"
+#include "h808.h"
+#include "h9400.h"
+#include "h4682.h"
+#include "h1509.h"
+int main_518() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3682.h"
+#include "h9555.h"
+#include "h492.h"
+#include "h6253.h"
+#include "h5813.h"
+int main_519() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5576.h"
+#include "h4629.h"
+#include "h9664.h"
+#include "h8271.h"
+#include "h2498.h"
+int main_52() { return 0; }
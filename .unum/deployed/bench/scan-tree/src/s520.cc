@@ -0,0 +1,9 @@
+#include "h6317.h"
+#include "h4410.h"
+#include "h986.h"
+#include "h2707.h"
+#include "h3739.h"
+#if 0
+#include "h7262.h"
+#endif
+int main_520() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1030.h"
+#include "h8454.h"
+#include "h1171.h"
+#include "h3637.h"
+#include "h5908.h"
+int main_521() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9711.h"
+#include "h422.h"
+#include "h2152.h"
+#include "h4798.h"
+#include "h2874.h"
+int main_522() { return 0; }
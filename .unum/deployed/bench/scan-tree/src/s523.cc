@@ -0,0 +1,6 @@
+#include "h2302.h"
+#include "h596.h"
+#include "h9150.h"
+#include "h9880.h"
+#include "h6364.h"
+int main_523() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7267.h"
+#include "h716.h"
+#include "h577.h"
+#include "h7727.h"
+#include "h1949.h"
+int main_524() { return 0; }
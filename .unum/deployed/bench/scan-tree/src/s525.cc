@@ -0,0 +1,9 @@
+#include "h5382.h"
+#include "h6447.h"
+#include "h1297.h"
+#include "h6261.h"
+#include "h769.h"
+#if 0
+#include "h2614.h"
+#endif
+int main_525() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7609.h"
+#include "h9105.h"
+#include "h333.h"
+#include "h4775.h"
+#include "h5018.h"
+int main_526() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9165.h"
+#include "h9067.h"
+#include "h8656.h"
+#include "h9212.h"
+#include "h6503.h"
+int main_527() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7796.h"
+#include "h4295.h"
+#include "h297.h"
+#include "h70.h"
+#include "h7719.h"
+int main_528() { return 0; }
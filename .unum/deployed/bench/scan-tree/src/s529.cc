@@ -0,0 +1,6 @@
+#include "h3493.h"
+#include "h8409.h"
+#include "h679.h"
+#include "h1731.h"
+#include "h6405.h"
+int main_529() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7546.h"
+#include "h296.h"
+#include "h8650.h"
+#include "h4275.h"
+#include "h7094.h"
+int main_53() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6849.h"
+#include "h344.h"
+#include "h1633.h"
+#include "h5642.h"
+#include "h2169.h"
+#if 0
+#include "h238.h"
+#endif
+int main_530() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7931.h"
+#include "h7859.h"
+#include "h7312.h"
+#include "h500.h"
+#include "h9856.h"
+int main_531() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7816.h"
+#include "h8798.h"
+#include "h8390.h"
+#include "h8928.h"
+#include "h4535.h"
+int main_532() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9577.h"
+#include "h2673.h"
+#include "h6883.h"
+#include "h8993.h"
+#include "h2643.h"
+int main_533() { return 0; }
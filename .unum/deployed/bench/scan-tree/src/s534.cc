@@ -0,0 +1,6 @@
+#include "h2045.h"
+#include "h2143.h"
+#include "h5917.h"
+#include "h3512.h"
+#include "h6110.h"
+int main_534() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3880.h"
+#include "h1634.h"
+#include "h7105.h"
+#include "h2213.h"
+#include "h8771.h"
+#if 0
+#include "h3978.h"
+#endif
+int main_535() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6000.h"
+#include "h9862.h"
+#include "h8398.h"
+#include "h6725.h"
+#include "h9710.h"
+int main_536() { return 0; }
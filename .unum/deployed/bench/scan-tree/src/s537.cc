@@ -0,0 +1,6 @@
+#include "h7483.h"
+#include "h6140.h"
+#include "h233.h"
+#include "h9030.h"
+#include "h58.h"
+int main_537() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9349.h"
+#include "h6350.h"
+#include "h83.h"
+#include "h1492.h"
+#include "h1541.h"
+int main_538() { return 0; }
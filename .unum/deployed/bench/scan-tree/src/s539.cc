@@ -0,0 +1,6 @@
+#include "h3659.h"
+#include "h55.h"
+#include "h127.h"
+#include "h2050.h"
+#include "h2148.h"
+int main_539() { return 0; }
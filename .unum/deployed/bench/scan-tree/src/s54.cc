@@ -0,0 +1,6 @@
+#include "h8344.h"
+#include "h2587.h"
+#include "h3866.h"
+#include "h3855.h"
+#include "h9349.h"
+int main_54() { return 0; }
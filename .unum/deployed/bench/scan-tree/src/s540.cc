@@ -0,0 +1,9 @@
+#include "h7682.h"
+#include "h1149.h"
+#include "h2410.h"
+#include "h6067.h"
+#include "h6295.h"
+#if 0
+#include "h1209.h"
+#endif
+int main_540() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7640.h"
+#include "h8711.h"
+#include "h8650.h"
+#include "h3872.h"
+#include "h103.h"
+int main_541() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3983.h"
+#include "h9892.h"
+#include "h1547.h"
+#include "h3915.h"
+#include "h6944.h"
+int main_542() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2026.h"
+#include "h3458.h"
+#include "h1187.h"
+#include "h2603.h"
+#include "h2310.h"
+int main_543() { return 0; }
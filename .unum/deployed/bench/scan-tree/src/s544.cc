@@ -0,0 +1,6 @@
+#include "h9713.h"
+#include "h3038.h"
+#include "h1267.h"
+#include "h1298.h"
+#include "h8966.h"
+int main_544() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8864.h"
+#include "h7309.h"
+#include "h2299.h"
+#include "h2089.h"
+#include "h2525.h"
+#if 0
+#include "h2403.h"
+#endif
+int main_545() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1013.h"
+#include "h439.h"
+#include "h8638.h"
+#include "h488.h"
+#include "h1658.h"
+int main_546() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3092.h"
+#include "h3225.h"
+#include "h6583.h"
+#include "h9168.h"
+#include "h4653.h"
+int main_547() { return 0; }
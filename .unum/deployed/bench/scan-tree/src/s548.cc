@@ -0,0 +1,6 @@
+#include "h1087.h"
+#include "h9122.h"
+#include "h454.h"
+#include "h1621.h"
+#include "h5407.h"
+int main_548() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9418.h"
+#include "h7752.h"
+#include "h4174.h"
+#include "h3572.h"
+#include "h2598.h"
+int main_549() { return 0; }
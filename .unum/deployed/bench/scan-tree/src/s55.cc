@@ -0,0 +1,9 @@
+#include "h9974.h"
+#include "h8732.h"
+#include "h9810.h"
+#include "h821.h"
+#include "h7844.h"
+#if 0
+#include "h6824.h"
+#endif
+int main_55() { return 0; }
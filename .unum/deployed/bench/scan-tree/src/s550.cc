@@ -0,0 +1,9 @@
+#include "h5902.h"
+#include "h7051.h"
+#include "h6769.h"
+#include "h9073.h"
+#include "h3104.h"
+#if 0
+#include "h3248.h"
+#endif
+int main_550() { return 0; }
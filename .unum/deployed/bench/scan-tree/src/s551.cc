@@ -0,0 +1,6 @@
+#include "h6894.h"
+#include "h1481.h"
+#include "h9002.h"
+#include "h4187.h"
+#include "h226.h"
+int main_551() { return 0; }
@@ -0,0 +1,6 @@
+#include "h188.h"
+#include "h7144.h"
+#include "h6477.h"
+#include "h5636.h"
+#include "h7363.h"
+int main_552() { return 0; }
@@ -0,0 +1,6 @@
+#include "h333.h"
+#include "h1588.h"
+#include "h2898.h"
+#include "h166.h"
+#include "h3653.h"
+int main_553() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1349.h"
+#include "h1720.h"
+#include "h1746.h"
+#include "h7595.h"
+#include "h3943.h"
+int main_554() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6713.h"
+#include "h2680.h"
+#include "h3562.h"
+#include "h7058.h"
+#include "h6889.h"
+#if 0
+#include "h2158.h"
+#endif
+int main_555() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2055.h"
+#include "h8384.h"
+#include "h5605.h"
+#include "h3125.h"
+#include "h6311.h"
+int main_556() { return 0; }
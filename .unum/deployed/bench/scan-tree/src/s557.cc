@@ -0,0 +1,6 @@
+#include "h7554.h"
+#include "h4750.h"
+#include "h6772.h"
+#include "h197.h"
+#include "h4826.h"
+int main_557() { return 0; }
@@ -0,0 +1,6 @@
+#include "h551.h"
+#include "h6820.h"
+#include "h2273.h"
+#include "h6161.h"
+#include "h1968.h"
+int main_558() { return 0; }
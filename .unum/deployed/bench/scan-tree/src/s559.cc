@@ -0,0 +1,6 @@
+#include "h8420.h"
+#include "h894.h"
+#include "h5346.h"
+#include "h2123.h"
+#include "h9500.h"
+int main_559() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4942.h"
+#include "h4802.h"
+#include "h1610.h"
+#include "h1259.h"
+#include "h8986.h"
+int main_56() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4.h"
+#include "h690.h"
+#include "h4261.h"
+#include "h9139.h"
+#include "h1830.h"
+#if 0
+#include "h2189.h"
+#endif
+int main_560() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7146.h"
+#include "h7419.h"
+#include "h9398.h"
+#include "h9387.h"
+#include "h2887.h"
+int main_561() { return 0; }
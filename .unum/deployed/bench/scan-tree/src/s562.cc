@@ -0,0 +1,6 @@
+#include "h4469.h"
+#include "h587.h"
+#include "h71.h"
+#include "h9102.h"
+#include "h8855.h"
+int main_562() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8410.h"
+#include "h3169.h"
+#include "h7420.h"
+#include "h2500.h"
+#include "h6446.h"
+int main_563() { return 0; }
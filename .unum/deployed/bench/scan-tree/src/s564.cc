@@ -0,0 +1,6 @@
+#include "h5774.h"
+#include "h2798.h"
+#include "h8224.h"
+#include "h5991.h"
+#include "h1475.h"
+int main_564() { return 0; }
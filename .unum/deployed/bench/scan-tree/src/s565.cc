@@ -0,0 +1,9 @@
+#include "h9573.h"
+#include "h8428.h"
+#include "h3108.h"
+#include "h4389.h"
+#include "h3889.h"
+#if 0
+#include "h4686.h"
+#endif
+int main_565() { return 0; }
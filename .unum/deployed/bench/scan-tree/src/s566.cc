@@ -0,0 +1,6 @@
+#include "h8004.h"
+#include "h6727.h"
+#include "h2331.h"
+#include "h9662.h"
+#include "h5256.h"
+int main_566() { return 0; }
@@ -0,0 +1,6 @@
+#include "h390.h"
+#include "h3788.h"
+#include "h212.h"
+#include "h870.h"
+#include "h503.h"
+int main_567() { return 0; }
@@ -0,0 +1,6 @@
+#include "h475.h"
+#include "h3727.h"
+#include "h6386.h"
+#include "h4920.h"
+#include "h2627.h"
+int main_568() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5994.h"
+#include "h4137.h"
+#include "h9830.h"
+#include "h5973.h"
+#include "h5471.h"
+int main_569() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3703.h"
+#include "h6525.h"
+#include "h5538.h"
+#include "h3278.h"
+#include "h5535.h"
+int main_57() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6992.h"
+#include "h7492.h"
+#include "h6864.h"
+#include "h3288.h"
+#include "h5194.h"
+#if 0
+#include "h9325.h"
+#endif
+int main_570() { return 0; }
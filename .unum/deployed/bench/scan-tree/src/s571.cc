@@ -0,0 +1,6 @@
+#include "h194.h"
+#include "h7037.h"
+#include "h3324.h"
+#include "h6259.h"
+#include "h7380.h"
+int main_571() { return 0; }
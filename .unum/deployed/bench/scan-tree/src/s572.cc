@@ -0,0 +1,6 @@
+#include "h2513.h"
+#include "h3218.h"
+#include "h597.h"
+#include "h1494.h"
+#include "h8733.h"
+int main_572() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5329.h"
+#include "h6560.h"
+#include "h3740.h"
+#include "h4490.h"
+#include "h4814.h"
+int main_573() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8760.h"
+#include "h4848.h"
+#include "h150.h"
+#include "h8290.h"
+#include "h1813.h"
+int main_574() { return 0; }
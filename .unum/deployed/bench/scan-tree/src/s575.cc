@@ -0,0 +1,9 @@
+#include "h4394.h"
+#include "h6932.h"
+#include "h9099.h"
+#include "h9256.h"
+#include "h1879.h"
+#if 0
+#include "h3349.h"
+#endif
+int main_575() { return 0; }
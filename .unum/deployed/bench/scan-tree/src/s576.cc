@@ -0,0 +1,6 @@
+#include "h7678.h"
+#include "h8982.h"
+#include "h4020.h"
+#include "h5434.h"
+#include "h7614.h"
+int main_576() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2257.h"
+#include "h6489.h"
+#include "h6728.h"
+#include "h972.h"
+#include "h8411.h"
+int main_577() { return 0; }
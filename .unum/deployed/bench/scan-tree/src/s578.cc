@@ -0,0 +1,6 @@
+#include "h4589.h"
+#include "h7567.h"
+#include "h5067.h"
+#include "h6032.h"
+#include "h5541.h"
+int main_578() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9228.h"
+#include "h6533.h"
+#include "h3352.h"
+#include "h9731.h"
+#include "h2156.h"
+int main_579() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1329.h"
+#include "h1138.h"
+#include "h1365.h"
+#include "h4624.h"
+#include "h5595.h"
+int main_58() { return 0; }
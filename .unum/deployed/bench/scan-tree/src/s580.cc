@@ -0,0 +1,9 @@
+#include "h6055.h"
+#include "h652.h"
+#include "h3145.h"
+#include "h4592.h"
+#include "h390.h"
+#if 0
+#include "h361.h"
+#endif
+int main_580() { return 0; }
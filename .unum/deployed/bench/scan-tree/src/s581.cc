@@ -0,0 +1,6 @@
+#include "h9262.h"
+#include "h9396.h"
+#include "h9623.h"
+#include "h3919.h"
+#include "h4916.h"
+int main_581() { return 0; }
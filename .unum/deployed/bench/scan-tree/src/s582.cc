@@ -0,0 +1,6 @@
+#include "h7858.h"
+#include "h1542.h"
+#include "h1207.h"
+#include "h7356.h"
+#include "h7042.h"
+int main_582() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1732.h"
+#include "h5684.h"
+#include "h8617.h"
+#include "h519.h"
+#include "h9876.h"
+int main_583() { return 0; }
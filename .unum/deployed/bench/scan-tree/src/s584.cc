@@ -0,0 +1,6 @@
+#include "h4834.h"
+#include "h2663.h"
+#include "h3722.h"
+#include "h101.h"
+#include "h9346.h"
+int main_584() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5360.h"
+#include "h5949.h"
+#include "h4021.h"
+#include "h9124.h"
+#include "h5745.h"
+#if 0
+#include "h316.h"
+#endif
+int main_585() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2884.h"
+#include "h6874.h"
+#include "h2778.h"
+#include "h6502.h"
+#include "h8854.h"
+int main_586() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7876.h"
+#include "h7849.h"
+#include "h3269.h"
+#include "h975.h"
+#include "h3353.h"
+int main_587() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9999.h"
+#include "h9239.h"
+#include "h6734.h"
+#include "h2408.h"
+#include "h8121.h"
+int main_588() { return 0; }
@@ -0,0 +1,6 @@
+#include "h429.h"
+#include "h8945.h"
+#include "h527.h"
+#include "h8774.h"
+#include "h4140.h"
+int main_589() { return 0; }
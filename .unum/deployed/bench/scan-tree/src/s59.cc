@@ -0,0 +1,6 @@
+#include "h3642.h"
+#include "h5702.h"
+#include "h2900.h"
+#include "h1298.h"
+#include "h3597.h"
+int main_59() { return 0; }
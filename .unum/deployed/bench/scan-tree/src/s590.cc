@@ -0,0 +1,9 @@
+#include "h4381.h"
+#include "h1524.h"
+#include "h8170.h"
+#include "h3527.h"
+#include "h9143.h"
+#if 0
+#include "h5429.h"
+#endif
+int main_590() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1590.h"
+#include "h6961.h"
+#include "h8936.h"
+#include "h5906.h"
+#include "h3600.h"
+int main_591() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5166.h"
+#include "h4291.h"
+#include "h9654.h"
+#include "h5108.h"
+#include "h7908.h"
+int main_592() { return 0; }
@@ -0,0 +1,6 @@
+#include "h801.h"
+#include "h6043.h"
+#include "h8286.h"
+#include "h5394.h"
+#include "h3347.h"
+int main_593() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2159.h"
+#include "h4467.h"
+#include "h6057.h"
+#include "h3895.h"
+#include "h6989.h"
+int main_594() { return 0; }
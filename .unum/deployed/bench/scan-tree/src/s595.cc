@@ -0,0 +1,9 @@
+#include "h6552.h"
+#include "h1889.h"
+#include "h3017.h"
+#include "h903.h"
+#include "h4307.h"
+#if 0
+#include "h300.h"
+#endif
+int main_595() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7453.h"
+#include "h9867.h"
+#include "h1459.h"
+#include "h9580.h"
+#include "h4547.h"
+int main_596() { return 0; }
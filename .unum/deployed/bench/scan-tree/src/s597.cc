@@ -0,0 +1,6 @@
+#include "h4831.h"
+#include "h7888.h"
+#include "h4602.h"
+#include "h7433.h"
+#include "h3811.h"
+int main_597() { return 0; }
@@ -0,0 +1,6 @@
+#include "h196.h"
+#include "h4351.h"
+#include "h3546.h"
+#include "h2900.h"
+#include "h4262.h"
+int main_598() { return 0; }
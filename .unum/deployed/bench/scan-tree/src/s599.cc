@@ -0,0 +1,6 @@
+#include "h2228.h"
+#include "h2488.h"
+#include "h6606.h"
+#include "h7024.h"
+#include "h2272.h"
+int main_599() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5377.h"
+#include "h5334.h"
+#include "h3107.h"
+#include "h5116.h"
+#include "h1198.h"
+int main_6() { return 0; }
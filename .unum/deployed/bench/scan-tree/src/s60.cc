@@ -0,0 +1,9 @@
+#include "h8713.h"
+#include "h1593.h"
+#include "h9504.h"
+#include "h4192.h"
+#include "h9485.h"
+#if 0
+#include "h2965.h"
+#endif
+int main_60() { return 0; }
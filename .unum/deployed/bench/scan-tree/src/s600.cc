@@ -0,0 +1,9 @@
+#include "h6131.h"
+#include "h7402.h"
+#include "h1786.h"
+#include "h6410.h"
+#include "h3631.h"
+#if 0
+#include "h444.h"
+#endif
+int main_600() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9898.h"
+#include "h141.h"
+#include "h2025.h"
+#include "h5421.h"
+#include "h3708.h"
+int main_601() { return 0; }
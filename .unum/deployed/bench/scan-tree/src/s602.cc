@@ -0,0 +1,6 @@
+#include "h2642.h"
+#include "h9045.h"
+#include "h6224.h"
+#include "h1834.h"
+#include "h7241.h"
+int main_602() { return 0; }
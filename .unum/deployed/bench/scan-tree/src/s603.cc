@@ -0,0 +1,6 @@
+#include "h6526.h"
+#include "h1460.h"
+#include "h2495.h"
+#include "h3455.h"
+#include "h9508.h"
+int main_603() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2364.h"
+#include "h5457.h"
+#include "h4908.h"
+#include "h9773.h"
+#include "h7837.h"
+int main_604() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5664.h"
+#include "h9661.h"
+#include "h7345.h"
+#include "h4526.h"
+#include "h6575.h"
+#if 0
+#include "h6155.h"
+#endif
+int main_605() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8989.h"
+#include "h8328.h"
+#include "h7228.h"
+#include "h2367.h"
+#include "h7955.h"
+int main_606() { return 0; }
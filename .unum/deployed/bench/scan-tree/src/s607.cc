@@ -0,0 +1,6 @@
+#include "h828.h"
+#include "h1851.h"
+#include "h7219.h"
+#include "h3867.h"
+#include "h3532.h"
+int main_607() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1803.h"
+#include "h1169.h"
+#include "h9476.h"
+#include "h776.h"
+#include "h8802.h"
+int main_608() { return 0; }
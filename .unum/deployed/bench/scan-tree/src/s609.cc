@@ -0,0 +1,6 @@
+#include "h4701.h"
+#include "h2219.h"
+#include "h6030.h"
+#include "h9538.h"
+#include "h7142.h"
+int main_609() { return 0; }
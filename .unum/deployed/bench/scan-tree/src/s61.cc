@@ -0,0 +1,6 @@
+#include "h5493.h"
+#include "h4474.h"
+#include "h9862.h"
+#include "h1485.h"
+#include "h2437.h"
+int main_61() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8400.h"
+#include "h4509.h"
+#include "h1891.h"
+#include "h2292.h"
+#include "h6300.h"
+#if 0
+#include "h9990.h"
+#endif
+int main_610() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4820.h"
+#include "h5645.h"
+#include "h2040.h"
+#include "h5412.h"
+#include "h8299.h"
+int main_611() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6501.h"
+#include "h5027.h"
+#include "h8051.h"
+#include "h962.h"
+#include "h6209.h"
+int main_612() { return 0; }
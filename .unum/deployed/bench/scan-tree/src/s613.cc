@@ -0,0 +1,6 @@
+#include "h6282.h"
+#include "h9889.h"
+#include "h9261.h"
+#include "h42.h"
+#include "h2117.h"
+int main_613() { return 0; }
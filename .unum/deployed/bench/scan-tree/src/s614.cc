@@ -0,0 +1,6 @@
+#include "h8146.h"
+#include "h7125.h"
+#include "h1341.h"
+#include "h4745.h"
+#include "h3968.h"
+int main_614() { return 0; }
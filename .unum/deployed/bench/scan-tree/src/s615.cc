@@ -0,0 +1,9 @@
+#include "h4041.h"
+#include "h6088.h"
+#include "h9119.h"
+#include "h1881.h"
+#include "h942.h"
+#if 0
+#include "h4419.h"
+#endif
+int main_615() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6630.h"
+#include "h9028.h"
+#include "h6184.h"
+#include "h5184.h"
+#include "h6326.h"
+int main_616() { return 0; }
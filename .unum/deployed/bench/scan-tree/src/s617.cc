@@ -0,0 +1,6 @@
+#include "h2196.h"
+#include "h8276.h"
+#include "h6251.h"
+#include "h17.h"
+#include "h5598.h"
+int main_617() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2515.h"
+#include "h1312.h"
+#include "h1880.h"
+#include "h6384.h"
+#include "h9139.h"
+int main_618() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7685.h"
+#include "h6015.h"
+#include "h5705.h"
+#include "h4833.h"
+#include "h8372.h"
+int main_619() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9585.h"
+#include "h5843.h"
+#include "h6372.h"
+#include "h8895.h"
+#include "h7869.h"
+int main_62() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8316.h"
+#include "h4209.h"
+#include "h8947.h"
+#include "h4351.h"
+#include "h4144.h"
+#if 0
+#include "h952.h"
+#endif
+int main_620() { return 0; }
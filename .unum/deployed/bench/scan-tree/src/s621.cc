@@ -0,0 +1,6 @@
+#include "h3243.h"
+#include "h3749.h"
+#include "h388.h"
+#include "h3752.h"
+#include "h3837.h"
+int main_621() { return 0; }
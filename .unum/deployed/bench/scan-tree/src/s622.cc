@@ -0,0 +1,6 @@
+#include "h17.h"
+#include "h9433.h"
+#include "h1142.h"
+#include "h2746.h"
+#include "h5028.h"
+int main_622() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5879.h"
+#include "h802.h"
+#include "h4615.h"
+#include "h4478.h"
+#include "h6248.h"
+int main_623() { return 0; }
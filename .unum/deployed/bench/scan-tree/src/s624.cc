@@ -0,0 +1,6 @@
+#include "h5743.h"
+#include "h8952.h"
+#include "h1357.h"
+#include "h7760.h"
+#include "h1599.h"
+int main_624() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7978.h"
+#include "h370.h"
+#include "h56.h"
+#include "h5399.h"
+#include "h2063.h"
+#if 0
+#include "h3298.h"
+#endif
+int main_625() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4390.h"
+#include "h4906.h"
+#include "h6888.h"
+#include "h7560.h"
+#include "h1207.h"
+int main_626() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9924.h"
+#include "h5536.h"
+#include "h4362.h"
+#include "h4627.h"
+#include "h3368.h"
+int main_627() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5295.h"
+#include "h6949.h"
+#include "h2277.h"
+#include "h4221.h"
+#include "h9109.h"
+int main_628() { return 0; }
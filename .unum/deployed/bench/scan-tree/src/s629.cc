@@ -0,0 +1,6 @@
+#include "h4520.h"
+#include "h860.h"
+#include "h5713.h"
+#include "h9015.h"
+#include "h2561.h"
+int main_629() { return 0; }
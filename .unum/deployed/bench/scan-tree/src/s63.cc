@@ -0,0 +1,6 @@
+#include "h38.h"
+#include "h4499.h"
+#include "h6484.h"
+#include "h1804.h"
+#include "h5462.h"
+int main_63() { return 0; }
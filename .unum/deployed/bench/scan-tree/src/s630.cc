@@ -0,0 +1,9 @@
+#include "h175.h"
+#include "h3706.h"
+#include "h5342.h"
+#include "h9963.h"
+#include "h7814.h"
+#if 0
+#include "h2801.h"
+#endif
+int main_630() { return 0; }
@@ -0,0 +1,6 @@
+#include "h17.h"
+#include "h2672.h"
+#include "h9266.h"
+#include "h7396.h"
+#include "h4992.h"
+int main_631() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7244.h"
+#include "h8264.h"
+#include "h8442.h"
+#include "h1435.h"
+#include "h8168.h"
+int main_632() { return 0; }
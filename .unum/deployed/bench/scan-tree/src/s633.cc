@@ -0,0 +1,6 @@
+#include "h2285.h"
+#include "h7670.h"
+#include "h3072.h"
+#include "h8959.h"
+#include "h5086.h"
+int main_633() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2149.h"
+#include "h9962.h"
+#include "h4501.h"
+#include "h6749.h"
+#include "h2822.h"
+int main_634() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5141.h"
+#include "h651.h"
+#include "h8578.h"
+#include "h1621.h"
+#include "h7557.h"
+#if 0
+#include "h3430.h"
+#endif
+int main_635() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1189.h"
+#include "h1057.h"
+#include "h1323.h"
+#include "h7724.h"
+#include "h4089.h"
+int main_636() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4444.h"
+#include "h3401.h"
+#include "h1319.h"
+#include "h2151.h"
+#include "h696.h"
+int main_637() { return 0; }
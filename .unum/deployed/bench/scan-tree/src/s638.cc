@@ -0,0 +1,6 @@
+#include "h9911.h"
+#include "h1681.h"
+#include "h5095.h"
+#include "h872.h"
+#include "h5586.h"
+int main_638() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4995.h"
+#include "h387.h"
+#include "h8285.h"
+#include "h244.h"
+#include "h453.h"
+int main_639() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3310.h"
+#include "h9036.h"
+#include "h4253.h"
+#include "h6864.h"
+#include "h5904.h"
+int main_64() { return 0; }
@@ -0,0 +1,9 @@
+#include "h9883.h"
+#include "h9665.h"
+#include "h1965.h"
+#include "h346.h"
+#include "h6003.h"
+#if 0
+#include "h2510.h"
+#endif
+int main_640() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6202.h"
+#include "h5544.h"
+#include "h4872.h"
+#include "h7107.h"
+#include "h8500.h"
+int main_641() { return 0; }
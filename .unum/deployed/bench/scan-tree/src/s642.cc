@@ -0,0 +1,6 @@
+#include "h7055.h"
+#include "h9059.h"
+#include "h6015.h"
+#include "h6201.h"
+#include "h4143.h"
+int main_642() { return 0; }
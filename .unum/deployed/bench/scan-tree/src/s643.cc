@@ -0,0 +1,6 @@
+#include "h829.h"
+#include "h2804.h"
+#include "h6612.h"
+#include "h7241.h"
+#include "h8648.h"
+int main_643() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4922.h"
+#include "h2135.h"
+#include "h5954.h"
+#include "h3997.h"
+#include "h3953.h"
+int main_644() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3209.h"
+#include "h5990.h"
+#include "h7181.h"
+#include "h7473.h"
+#include "h6450.h"
+#if 0
+#include "h3286.h"
+#endif
+int main_645() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5829.h"
+#include "h2485.h"
+#include "h7934.h"
+#include "h2551.h"
+#include "h4802.h"
+int main_646() { return 0; }
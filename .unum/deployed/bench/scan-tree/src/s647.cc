@@ -0,0 +1,6 @@
+#include "h2715.h"
+#include "h5810.h"
+#include "h9180.h"
+#include "h6658.h"
+#include "h125.h"
+int main_647() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9188.h"
+#include "h2976.h"
+#include "h6078.h"
+#include "h3287.h"
+#include "h1017.h"
+int main_648() { return 0; }
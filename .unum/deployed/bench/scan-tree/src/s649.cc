@@ -0,0 +1,6 @@
+#include "h879.h"
+#include "h6896.h"
+#include "h138.h"
+#include "h6253.h"
+#include "h6190.h"
+int main_649() { return 0; }
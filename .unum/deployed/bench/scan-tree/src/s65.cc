@@ -0,0 +1,9 @@
+#include "h938.h"
+#include "h654.h"
+#include "h680.h"
+#include "h9161.h"
+#include "h4252.h"
+#if 0
+#include "h2936.h"
+#endif
+int main_65() { return 0; }
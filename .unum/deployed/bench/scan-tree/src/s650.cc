@@ -0,0 +1,9 @@
+#include "h3015.h"
+#include "h9100.h"
+#include "h1345.h"
+#include "h6705.h"
+#include "h3333.h"
+#if 0
+#include "h998.h"
+#endif
+int main_650() { return 0; }
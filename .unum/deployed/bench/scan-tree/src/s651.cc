@@ -0,0 +1,6 @@
+#include "h3324.h"
+#include "h553.h"
+#include "h3814.h"
+#include "h783.h"
+#include "h1829.h"
+int main_651() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3601.h"
+#include "h9248.h"
+#include "h2733.h"
+#include "h3775.h"
+#include "h8992.h"
+int main_652() { return 0; }
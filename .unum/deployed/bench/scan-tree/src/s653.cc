@@ -0,0 +1,6 @@
+#include "h4224.h"
+#include "h8689.h"
+#include "h8518.h"
+#include "h9466.h"
+#include "h5348.h"
+int main_653() { return 0; }
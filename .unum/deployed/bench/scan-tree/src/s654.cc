@@ -0,0 +1,6 @@
+#include "h3357.h"
+#include "h5896.h"
+#include "h9509.h"
+#include "h6296.h"
+#include "h2895.h"
+int main_654() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7777.h"
+#include "h2332.h"
+#include "h2499.h"
+#include "h5639.h"
+#include "h9826.h"
+#if 0
+#include "h6217.h"
+#endif
+int main_655() { return 0; }
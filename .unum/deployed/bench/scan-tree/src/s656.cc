@@ -0,0 +1,6 @@
+#include "h8078.h"
+#include "h3621.h"
+#include "h4362.h"
+#include "h5402.h"
+#include "h7808.h"
+int main_656() { return 0; }
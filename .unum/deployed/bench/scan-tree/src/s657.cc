@@ -0,0 +1,6 @@
+#include "h1080.h"
+#include "h5119.h"
+#include "h9034.h"
+#include "h8316.h"
+#include "h7096.h"
+int main_657() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7754.h"
+#include "h1735.h"
+#include "h826.h"
+#include "h8484.h"
+#include "h9036.h"
+int main_658() { return 0; }
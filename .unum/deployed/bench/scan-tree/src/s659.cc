@@ -0,0 +1,6 @@
+#include "h7770.h"
+#include "h7877.h"
+#include "h5831.h"
+#include "h6797.h"
+#include "h9025.h"
+int main_659() { return 0; }
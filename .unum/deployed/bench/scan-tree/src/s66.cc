@@ -0,0 +1,6 @@
+#include "h396.h"
+#include "h3892.h"
+#include "h8257.h"
+#include "h1699.h"
+#include "h4576.h"
+int main_66() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3450.h"
+#include "h7430.h"
+#include "h911.h"
+#include "h7928.h"
+#include "h6097.h"
+#if 0
+#include "h4338.h"
+#endif
+int main_660() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1791.h"
+#include "h9197.h"
+#include "h1158.h"
+#include "h8844.h"
+#include "h3450.h"
+int main_661() { return 0; }
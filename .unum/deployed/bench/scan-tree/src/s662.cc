@@ -0,0 +1,6 @@
+#include "h5481.h"
+#include "h1771.h"
+#include "h3093.h"
+#include "h4452.h"
+#include "h1992.h"
+int main_662() { return 0; }
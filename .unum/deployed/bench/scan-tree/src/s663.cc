@@ -0,0 +1,6 @@
+#include "h8082.h"
+#include "h4965.h"
+#include "h3721.h"
+#include "h2107.h"
+#include "h3348.h"
+int main_663() { return 0; }
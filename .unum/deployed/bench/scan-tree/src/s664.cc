@@ -0,0 +1,6 @@
+#include "h8604.h"
+#include "h2066.h"
+#include "h1800.h"
+#include "h3896.h"
+#include "h3234.h"
+int main_664() { return 0; }
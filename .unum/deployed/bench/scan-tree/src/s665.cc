@@ -0,0 +1,9 @@
+#include "h8221.h"
+#include "h8692.h"
+#include "h5877.h"
+#include "h151.h"
+#include "h8171.h"
+#if 0
+#include "h9966.h"
+#endif
+int main_665() { return 0; }
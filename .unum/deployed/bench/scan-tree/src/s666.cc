@@ -0,0 +1,6 @@
+#include "h6405.h"
+#include "h3965.h"
+#include "h7472.h"
+#include "h9364.h"
+#include "h4760.h"
+int main_666() { return 0; }
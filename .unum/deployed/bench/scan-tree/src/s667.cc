@@ -0,0 +1,6 @@
+#include "h9847.h"
+#include "h1144.h"
+#include "h6232.h"
+#include "h3391.h"
+#include "h3436.h"
+int main_667() { return 0; }
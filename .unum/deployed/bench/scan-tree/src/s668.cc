@@ -0,0 +1,6 @@
+#include "h5941.h"
+#include "h6562.h"
+#include "h4741.h"
+#include "h5019.h"
+#include "h4440.h"
+int main_668() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1046.h"
+#include "h4953.h"
+#include "h5255.h"
+#include "h4202.h"
+#include "h2173.h"
+int main_669() { return 0; }
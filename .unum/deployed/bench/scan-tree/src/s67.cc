@@ -0,0 +1,6 @@
+#include "h1190.h"
+#include "h9802.h"
+#include "h7039.h"
+#include "h3329.h"
+#include "h9912.h"
+int main_67() { return 0; }
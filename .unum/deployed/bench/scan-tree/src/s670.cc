@@ -0,0 +1,9 @@
+#include "h8635.h"
+#include "h2666.h"
+#include "h8929.h"
+#include "h2945.h"
+#include "h4650.h"
+#if 0
+#include "h1992.h"
+#endif
+int main_670() { return 0; }
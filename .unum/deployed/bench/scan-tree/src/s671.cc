@@ -0,0 +1,6 @@
+#include "h4182.h"
+#include "h2970.h"
+#include "h2355.h"
+#include "h7279.h"
+#include "h9556.h"
+int main_671() { return 0; }
@@ -0,0 +1,6 @@
+#include "h166.h"
+#include "h1898.h"
+#include "h3290.h"
+#include "h1585.h"
+#include "h2922.h"
+int main_672() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2106.h"
+#include "h7009.h"
+#include "h76.h"
+#include "h3605.h"
+#include "h3040.h"
+int main_673() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6153.h"
+#include "h5915.h"
+#include "h7933.h"
+#include "h9850.h"
+#include "h2758.h"
+int main_674() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1342.h"
+#include "h8922.h"
+#include "h4903.h"
+#include "h3629.h"
+#include "h8503.h"
+#if 0
+#include "h5889.h"
+#endif
+int main_675() { return 0; }
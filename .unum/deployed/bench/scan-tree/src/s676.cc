@@ -0,0 +1,6 @@
+#include "h2278.h"
+#include "h7464.h"
+#include "h3091.h"
+#include "h4550.h"
+#include "h7614.h"
+int main_676() { return 0; }
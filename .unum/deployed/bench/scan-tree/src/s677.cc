@@ -0,0 +1,6 @@
+#include "h270.h"
+#include "h8907.h"
+#include "h2844.h"
+#include "h9989.h"
+#include "h5846.h"
+int main_677() { return 0; }
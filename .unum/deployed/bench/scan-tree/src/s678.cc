@@ -0,0 +1,6 @@
+#include "h4154.h"
+#include "h9128.h"
+#include "h9195.h"
+#include "h993.h"
+#include "h2142.h"
+int main_678() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7899.h"
+#include "h8728.h"
+#include "h6523.h"
+#include "h275.h"
+#include "h4740.h"
+int main_679() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5065.h"
+#include "h9145.h"
+#include "h4008.h"
+#include "h8372.h"
+#include "h8263.h"
+int main_68() { return 0; }
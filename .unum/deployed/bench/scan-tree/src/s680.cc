@@ -0,0 +1,9 @@
+#include "h1063.h"
+#include "h3444.h"
+#include "h8430.h"
+#include "h9588.h"
+#include "h2882.h"
+#if 0
+#include "h3567.h"
+#endif
+int main_680() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7751.h"
+#include "h4022.h"
+#include "h7687.h"
+#include "h1756.h"
+#include "h2528.h"
+int main_681() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5648.h"
+#include "h8291.h"
+#include "h982.h"
+#include "h7945.h"
+#include "h2436.h"
+int main_682() { return 0; }
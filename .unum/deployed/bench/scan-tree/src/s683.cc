@@ -0,0 +1,6 @@
+#include "h4171.h"
+#include "h768.h"
+#include "h8171.h"
+#include "h9776.h"
+#include "h5313.h"
+int main_683() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1199.h"
+#include "h7443.h"
+#include "h337.h"
+#include "h191.h"
+#include "h2083.h"
+int main_684() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1159.h"
+#include "h8579.h"
+#include "h692.h"
+#include "h5431.h"
+#include "h7123.h"
+#if 0
+#include "h6657.h"
+#endif
+int main_685() { return 0; }
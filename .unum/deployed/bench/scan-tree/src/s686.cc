@@ -0,0 +1,6 @@
+#include "h1505.h"
+#include "h2136.h"
+#include "h159.h"
+#include "h482.h"
+#include "h7134.h"
+int main_686() { return 0; }
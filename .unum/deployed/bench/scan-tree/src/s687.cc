@@ -0,0 +1,6 @@
+#include "h155.h"
+#include "h1909.h"
+#include "h9467.h"
+#include "h7967.h"
+#include "h8090.h"
+int main_687() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5644.h"
+#include "h5965.h"
+#include "h4940.h"
+#include "h3398.h"
+#include "h5294.h"
+int main_688() { return 0; }
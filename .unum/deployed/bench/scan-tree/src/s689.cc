@@ -0,0 +1,6 @@
+#include "h2231.h"
+#include "h1929.h"
+#include "h4763.h"
+#include "h4939.h"
+#include "h6394.h"
+int main_689() { return 0; }
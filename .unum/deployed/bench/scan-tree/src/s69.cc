@@ -0,0 +1,6 @@
+#include "h1258.h"
+#include "h9862.h"
+#include "h1220.h"
+#include "h9359.h"
+#include "h8385.h"
+int main_69() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2657.h"
+#include "h4981.h"
+#include "h4756.h"
+#include "h3059.h"
+#include "h119.h"
+#if 0
+#include "h5558.h"
+#endif
+int main_690() { return 0; }
@@ -0,0 +1,6 @@
+#include "h996.h"
+#include "h1225.h"
+#include "h7218.h"
+#include "h6360.h"
+#include "h5883.h"
+int main_691() { return 0; }
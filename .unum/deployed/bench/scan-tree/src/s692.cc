@@ -0,0 +1,6 @@
+#include "h3818.h"
+#include "h3431.h"
+#include "h1125.h"
+#include "h3526.h"
+#include "h1752.h"
+int main_692() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3820.h"
+#include "h1521.h"
+#include "h917.h"
+#include "h5141.h"
+#include "h4798.h"
+int main_693() { return 0; }
@@ -0,0 +1,6 @@
+#include "h316.h"
+#include "h1441.h"
+#include "h779.h"
+#include "h6980.h"
+#include "h1628.h"
+int main_694() { return 0; }
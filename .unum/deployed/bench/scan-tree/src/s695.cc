@@ -0,0 +1,9 @@
+#include "h8755.h"
+#include "h6017.h"
+#include "h2891.h"
+#include "h1129.h"
+#include "h4650.h"
+#if 0
+#include "h3584.h"
+#endif
+int main_695() { return 0; }
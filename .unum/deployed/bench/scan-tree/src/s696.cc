@@ -0,0 +1,6 @@
+#include "h8673.h"
+#include "h3367.h"
+#include "h8280.h"
+#include "h6522.h"
+#include "h1745.h"
+int main_696() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3096.h"
+#include "h8386.h"
+#include "h284.h"
+#include "h7291.h"
+#include "h5970.h"
+int main_697() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8156.h"
+#include "h6964.h"
+#include "h5793.h"
+#include "h8739.h"
+#include "h9213.h"
+int main_698() { return 0; }
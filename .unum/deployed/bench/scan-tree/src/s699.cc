@@ -0,0 +1,6 @@
+#include "h3429.h"
+#include "h8148.h"
+#include "h1181.h"
+#include "h4552.h"
+#include "h4410.h"
+int main_699() { return 0; }
@@ -0,0 +1,6 @@
+#include "h852.h"
+#include "h4244.h"
+#include "h6125.h"
+#include "h5434.h"
+#include "h3617.h"
+int main_7() { return 0; }
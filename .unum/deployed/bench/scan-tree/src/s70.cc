@@ -0,0 +1,9 @@
+#include "h1620.h"
+#include "h1551.h"
+#include "h9857.h"
+#include "h6775.h"
+#include "h7741.h"
+#if 0
+#include "h3488.h"
+#endif
+int main_70() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1662.h"
+#include "h5185.h"
+#include "h971.h"
+#include "h5365.h"
+#include "h5629.h"
+#if 0
+#include "h2731.h"
+#endif
+int main_700() { return 0; }
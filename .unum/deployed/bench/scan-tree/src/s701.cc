@@ -0,0 +1,6 @@
+#include "h8261.h"
+#include "h4796.h"
+#include "h6503.h"
+#include "h9167.h"
+#include "h2447.h"
+int main_701() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6590.h"
+#include "h5106.h"
+#include "h3876.h"
+#include "h2618.h"
+#include "h7183.h"
+int main_702() { return 0; }
@@ -0,0 +1,6 @@
+#include "h741.h"
+#include "h4983.h"
+#include "h4136.h"
+#include "h7101.h"
+#include "h4059.h"
+int main_703() { return 0; }
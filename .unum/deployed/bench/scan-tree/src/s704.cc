@@ -0,0 +1,6 @@
+#include "h7845.h"
+#include "h5071.h"
+#include "h7184.h"
+#include "h727.h"
+#include "h5305.h"
+int main_704() { return 0; }
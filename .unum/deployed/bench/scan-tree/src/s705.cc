@@ -0,0 +1,9 @@
+#include "h6297.h"
+#include "h1031.h"
+#include "h5308.h"
+#include "h8444.h"
+#include "h5433.h"
+#if 0
+#include "h6576.h"
+#endif
+int main_705() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3255.h"
+#include "h8515.h"
+#include "h327.h"
+#include "h1822.h"
+#include "h1797.h"
+int main_706() { return 0; }
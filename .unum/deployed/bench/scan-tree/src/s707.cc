@@ -0,0 +1,6 @@
+#include "h4991.h"
+#include "h3033.h"
+#include "h9422.h"
+#include "h257.h"
+#include "h1513.h"
+int main_707() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3983.h"
+#include "h6795.h"
+#include "h6142.h"
+#include "h3163.h"
+#include "h2304.h"
+int main_708() { return 0; }
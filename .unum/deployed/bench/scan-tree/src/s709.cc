@@ -0,0 +1,6 @@
+#include "h704.h"
+#include "h4889.h"
+#include "h8352.h"
+#include "h3683.h"
+#include "h9633.h"
+int main_709() { return 0; }
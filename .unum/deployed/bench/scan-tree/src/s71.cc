@@ -0,0 +1,6 @@
+#include "h5279.h"
+#include "h8885.h"
+#include "h2558.h"
+#include "h8232.h"
+#include "h4187.h"
+int main_71() { return 0; }
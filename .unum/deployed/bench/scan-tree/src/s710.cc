@@ -0,0 +1,9 @@
+#include "h6711.h"
+#include "h8633.h"
+#include "h8450.h"
+#include "h2125.h"
+#include "h4996.h"
+#if 0
+#include "h6330.h"
+#endif
+int main_710() { return 0; }
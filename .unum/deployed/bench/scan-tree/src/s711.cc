@@ -0,0 +1,6 @@
+#include "h9745.h"
+#include "h5829.h"
+#include "h5627.h"
+#include "h3941.h"
+#include "h9436.h"
+int main_711() { return 0; }
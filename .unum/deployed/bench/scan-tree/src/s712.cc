@@ -0,0 +1,6 @@
+#include "h8228.h"
+#include "h9355.h"
+#include "h3023.h"
+#include "h9054.h"
+#include "h201.h"
+int main_712() { return 0; }
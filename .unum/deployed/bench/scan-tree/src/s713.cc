@@ -0,0 +1,6 @@
+#include "h5720.h"
+#include "h9132.h"
+#include "h5509.h"
+#include "h8771.h"
+#include "h2944.h"
+int main_713() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1592.h"
+#include "h5766.h"
+#include "h6640.h"
+#include "h4192.h"
+#include "h2837.h"
+int main_714() { return 0; }
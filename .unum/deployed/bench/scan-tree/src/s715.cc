@@ -0,0 +1,9 @@
+#include "h3343.h"
+#include "h9859.h"
+#include "h5071.h"
+#include "h301.h"
+#include "h4592.h"
+#if 0
+#include "h1943.h"
+#endif
+int main_715() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7481.h"
+#include "h1919.h"
+#include "h4047.h"
+#include "h2818.h"
+#include "h1700.h"
+int main_716() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6824.h"
+#include "h4011.h"
+#include "h4287.h"
+#include "h3586.h"
+#include "h2218.h"
+int main_717() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7906.h"
+#include "h3149.h"
+#include "h9054.h"
+#include "h7956.h"
+#include "h5672.h"
+int main_718() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2816.h"
+#include "h5107.h"
+#include "h2030.h"
+#include "h8020.h"
+#include "h3406.h"
+int main_719() { return 0; }
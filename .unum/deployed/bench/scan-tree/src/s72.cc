@@ -0,0 +1,6 @@
+#include "h9740.h"
+#include "h3764.h"
+#include "h8560.h"
+#include "h4550.h"
+#include "h4171.h"
+int main_72() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1678.h"
+#include "h2591.h"
+#include "h1747.h"
+#include "h4140.h"
+#include "h5039.h"
+#if 0
+#include "h8788.h"
+#endif
+int main_720() { return 0; }
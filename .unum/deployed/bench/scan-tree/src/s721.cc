@@ -0,0 +1,6 @@
+#include "h6985.h"
+#include "h5897.h"
+#include "h5225.h"
+#include "h2240.h"
+#include "h5359.h"
+int main_721() { return 0; }
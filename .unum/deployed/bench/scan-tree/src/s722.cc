@@ -0,0 +1,6 @@
+#include "h2300.h"
+#include "h4563.h"
+#include "h4298.h"
+#include "h5.h"
+#include "h8912.h"
+int main_722() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9380.h"
+#include "h1067.h"
+#include "h9311.h"
+#include "h7414.h"
+#include "h3526.h"
+int main_723() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6836.h"
+#include "h8401.h"
+#include "h6196.h"
+#include "h4450.h"
+#include "h9603.h"
+int main_724() { return 0; }
@@ -0,0 +1,9 @@
+#include "h667.h"
+#include "h3010.h"
+#include "h9843.h"
+#include "h336.h"
+#include "h4408.h"
+#if 0
+#include "h2640.h"
+#endif
+int main_725() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2391.h"
+#include "h3344.h"
+#include "h6045.h"
+#include "h1383.h"
+#include "h5050.h"
+int main_726() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3679.h"
+#include "h7156.h"
+#include "h9657.h"
+#include "h9562.h"
+#include "h8369.h"
+int main_727() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8789.h"
+#include "h1779.h"
+#include "h3424.h"
+#include "h958.h"
+#include "h5874.h"
+int main_728() { return 0; }
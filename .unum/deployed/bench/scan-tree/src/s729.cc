@@ -0,0 +1,6 @@
+#include "h7448.h"
+#include "h9657.h"
+#include "h6450.h"
+#include "h9813.h"
+#include "h817.h"
+int main_729() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5426.h"
+#include "h8853.h"
+#include "h1389.h"
+#include "h2416.h"
+#include "h7507.h"
+int main_73() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3181.h"
+#include "h3120.h"
+#include "h3061.h"
+#include "h7044.h"
+#include "h3816.h"
+#if 0
+#include "h3287.h"
+#endif
+int main_730() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1234.h"
+#include "h1760.h"
+#include "h8613.h"
+#include "h9070.h"
+#include "h8120.h"
+int main_731() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1402.h"
+#include "h348.h"
+#include "h5351.h"
+#include "h3647.h"
+#include "h8874.h"
+int main_732() { return 0; }
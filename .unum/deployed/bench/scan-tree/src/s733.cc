@@ -0,0 +1,6 @@
+#include "h4792.h"
+#include "h7823.h"
+#include "h6113.h"
+#include "h2254.h"
+#include "h308.h"
+int main_733() { return 0; }
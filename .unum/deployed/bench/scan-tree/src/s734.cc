@@ -0,0 +1,6 @@
+#include "h3420.h"
+#include "h588.h"
+#include "h1367.h"
+#include "h4101.h"
+#include "h2621.h"
+int main_734() { return 0; }
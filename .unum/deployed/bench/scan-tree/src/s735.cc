@@ -0,0 +1,9 @@
+#include "h810.h"
+#include "h8143.h"
+#include "h9738.h"
+#include "h8586.h"
+#include "h7934.h"
+#if 0
+#include "h608.h"
+#endif
+int main_735() { return 0; }
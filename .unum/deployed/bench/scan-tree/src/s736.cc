@@ -0,0 +1,6 @@
+#include "h125.h"
+#include "h91.h"
+#include "h6078.h"
+#include "h1140.h"
+#include "h452.h"
+int main_736() { return 0; }
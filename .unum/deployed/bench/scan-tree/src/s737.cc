@@ -0,0 +1,6 @@
+#include "h9991.h"
+#include "h4467.h"
+#include "h6445.h"
+#include "h7387.h"
+#include "h2909.h"
+int main_737() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6164.h"
+#include "h9525.h"
+#include "h7076.h"
+#include "h1531.h"
+#include "h287.h"
+int main_738() { return 0; }
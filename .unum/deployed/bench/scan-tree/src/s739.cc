@@ -0,0 +1,6 @@
+#include "h1811.h"
+#include "h29.h"
+#include "h7694.h"
+#include "h6618.h"
+#include "h4066.h"
+int main_739() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9455.h"
+#include "h214.h"
+#include "h7994.h"
+#include "h9487.h"
+#include "h6530.h"
+int main_74() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5755.h"
+#include "h5386.h"
+#include "h4739.h"
+#include "h8065.h"
+#include "h4451.h"
+#if 0
+#include "h3202.h"
+#endif
+int main_740() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2322.h"
+#include "h8660.h"
+#include "h2165.h"
+#include "h6789.h"
+#include "h9096.h"
+int main_741() { return 0; }
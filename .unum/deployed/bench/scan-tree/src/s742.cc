@@ -0,0 +1,6 @@
+#include "h7539.h"
+#include "h6945.h"
+#include "h8304.h"
+#include "h4961.h"
+#include "h3576.h"
+int main_742() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4955.h"
+#include "h5053.h"
+#include "h701.h"
+#include "h5237.h"
+#include "h7351.h"
+int main_743() { return 0; }
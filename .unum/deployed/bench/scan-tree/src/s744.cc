@@ -0,0 +1,6 @@
+#include "h8912.h"
+#include "h9909.h"
+#include "h1592.h"
+#include "h5598.h"
+#include "h9175.h"
+int main_744() { return 0; }
@@ -0,0 +1,9 @@
+#include "h25.h"
+#include "h9817.h"
+#include "h1414.h"
+#include "h4255.h"
+#include "h7957.h"
+#if 0
+#include "h1136.h"
+#endif
+int main_745() { return 0; }
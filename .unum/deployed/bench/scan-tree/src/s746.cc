@@ -0,0 +1,6 @@
+#include "h2376.h"
+#include "h9813.h"
+#include "h2675.h"
+#include "h8188.h"
+#include "h1926.h"
+int main_746() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9377.h"
+#include "h8408.h"
+#include "h339.h"
+#include "h703.h"
+#include "h6412.h"
+int main_747() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6830.h"
+#include "h4285.h"
+#include "h8199.h"
+#include "h1141.h"
+#include "h6512.h"
+int main_748() { return 0; }
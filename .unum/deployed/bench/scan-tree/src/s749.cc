@@ -0,0 +1,6 @@
+#include "h5593.h"
+#include "h5912.h"
+#include "h409.h"
+#include "h1726.h"
+#include "h3649.h"
+int main_749() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7684.h"
+#include "h7101.h"
+#include "h8093.h"
+#include "h122.h"
+#include "h2680.h"
+#if 0
+#include "h8927.h"
+#endif
+int main_75() { return 0; }
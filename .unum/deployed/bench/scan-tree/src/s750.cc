@@ -0,0 +1,9 @@
+#include "h1747.h"
+#include "h2170.h"
+#include "h1227.h"
+#include "h4601.h"
+#include "h8765.h"
+#if 0
+#include "h4040.h"
+#endif
+int main_750() { return 0; }
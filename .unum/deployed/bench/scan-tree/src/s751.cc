@@ -0,0 +1,6 @@
+#include "h5942.h"
+#include "h4226.h"
+#include "h5567.h"
+#include "h1090.h"
+#include "h643.h"
+int main_751() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6790.h"
+#include "h5827.h"
+#include "h862.h"
+#include "h8600.h"
+#include "h4044.h"
+int main_752() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3142.h"
+#include "h7746.h"
+#include "h780.h"
+#include "h2127.h"
+#include "h1286.h"
+int main_753() { return 0; }
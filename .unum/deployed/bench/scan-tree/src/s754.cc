@@ -0,0 +1,6 @@
+#include "h4293.h"
+#include "h5050.h"
+#include "h4604.h"
+#include "h9428.h"
+#include "h632.h"
+int main_754() { return 0; }
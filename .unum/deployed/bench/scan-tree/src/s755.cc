@@ -0,0 +1,9 @@
+#include "h7807.h"
+#include "h9753.h"
+#include "h2662.h"
+#include "h7563.h"
+#include "h1837.h"
+#if 0
+#include "h4253.h"
+#endif
+int main_755() { return 0; }
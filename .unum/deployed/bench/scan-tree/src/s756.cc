@@ -0,0 +1,6 @@
+#include "h3948.h"
+#include "h5255.h"
+#include "h9222.h"
+#include "h1636.h"
+#include "h4479.h"
+int main_756() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8702.h"
+#include "h5702.h"
+#include "h9831.h"
+#include "h5233.h"
+#include "h9531.h"
+int main_757() { return 0; }
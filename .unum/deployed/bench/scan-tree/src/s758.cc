@@ -0,0 +1,6 @@
+#include "h6579.h"
+#include "h6851.h"
+#include "h847.h"
+#include "h8846.h"
+#include "h4301.h"
+int main_758() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6227.h"
+#include "h635.h"
+#include "h2751.h"
+#include "h7003.h"
+#include "h9792.h"
+int main_759() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7115.h"
+#include "h519.h"
+#include "h332.h"
+#include "h8635.h"
+#include "h7083.h"
+int main_76() { return 0; }
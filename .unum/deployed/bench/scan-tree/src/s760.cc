@@ -0,0 +1,9 @@
+#include "h3455.h"
+#include "h5369.h"
+#include "h5955.h"
+#include "h7115.h"
+#include "h8274.h"
+#if 0
+#include "h3884.h"
+#endif
+int main_760() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4143.h"
+#include "h4023.h"
+#include "h3049.h"
+#include "h9376.h"
+#include "h4002.h"
+int main_761() { return 0; }
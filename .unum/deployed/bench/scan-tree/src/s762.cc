@@ -0,0 +1,6 @@
+#include "h941.h"
+#include "h263.h"
+#include "h2064.h"
+#include "h7516.h"
+#include "h9746.h"
+int main_762() { return 0; }
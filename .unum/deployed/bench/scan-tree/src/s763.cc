@@ -0,0 +1,6 @@
+#include "h6204.h"
+#include "h4018.h"
+#include "h5752.h"
+#include "h5018.h"
+#include "h4468.h"
+int main_763() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9666.h"
+#include "h9633.h"
+#include "h7809.h"
+#include "h3360.h"
+#include "h1472.h"
+int main_764() { return 0; }
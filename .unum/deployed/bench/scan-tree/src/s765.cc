@@ -0,0 +1,9 @@
+#include "h3122.h"
+#include "h3331.h"
+#include "h9883.h"
+#include "h6880.h"
+#include "h916.h"
+#if 0
+#include "h47.h"
+#endif
+int main_765() { return 0; }
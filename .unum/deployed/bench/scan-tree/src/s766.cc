@@ -0,0 +1,6 @@
+#include "h3116.h"
+#include "h6983.h"
+#include "h4198.h"
+#include "h4121.h"
+#include "h5314.h"
+int main_766() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8437.h"
+#include "h59.h"
+#include "h2407.h"
+#include "h4026.h"
+#include "h9055.h"
+int main_767() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2463.h"
+#include "h7055.h"
+#include "h7328.h"
+#include "h4377.h"
+#include "h9908.h"
+int main_768() { return 0; }
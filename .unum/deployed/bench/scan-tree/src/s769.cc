@@ -0,0 +1,6 @@
+#include "h6649.h"
+#include "h5702.h"
+#include "h3081.h"
+#include "h6631.h"
+#include "h7677.h"
+int main_769() { return 0; }
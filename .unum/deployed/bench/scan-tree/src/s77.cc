@@ -0,0 +1,6 @@
+#include "h9667.h"
+#include "h1043.h"
+#include "h1423.h"
+#include "h6731.h"
+#include "h4967.h"
+int main_77() { return 0; }
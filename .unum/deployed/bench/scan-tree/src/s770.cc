@@ -0,0 +1,9 @@
+#include "h9358.h"
+#include "h5054.h"
+#include "h906.h"
+#include "h2260.h"
+#include "h1779.h"
+#if 0
+#include "h7332.h"
+#endif
+int main_770() { return 0; }
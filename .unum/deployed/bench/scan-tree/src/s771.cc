@@ -0,0 +1,6 @@
+#include "h2007.h"
+#include "h8822.h"
+#include "h8283.h"
+#include "h2681.h"
+#include "h8116.h"
+int main_771() { return 0; }
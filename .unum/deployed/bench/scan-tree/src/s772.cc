@@ -0,0 +1,6 @@
+#include "h7428.h"
+#include "h3783.h"
+#include "h3036.h"
+#include "h2186.h"
+#include "h4349.h"
+int main_772() { return 0; }
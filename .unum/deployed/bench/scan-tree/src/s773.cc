@@ -0,0 +1,6 @@
+#include "h6318.h"
+#include "h5942.h"
+#include "h7259.h"
+#include "h6225.h"
+#include "h2090.h"
+int main_773() { return 0; }
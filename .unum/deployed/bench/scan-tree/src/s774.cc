@@ -0,0 +1,6 @@
+#include "h551.h"
+#include "h4123.h"
+#include "h7317.h"
+#include "h713.h"
+#include "h7429.h"
+int main_774() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5936.h"
+#include "h6312.h"
+#include "h1593.h"
+#include "h3660.h"
+#include "h3453.h"
+#if 0
+#include "h1762.h"
+#endif
+int main_775() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4616.h"
+#include "h8597.h"
+#include "h8407.h"
+#include "h1429.h"
+#include "h9661.h"
+int main_776() { return 0; }
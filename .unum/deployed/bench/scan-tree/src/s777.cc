@@ -0,0 +1,6 @@
+#include "h2709.h"
+#include "h6548.h"
+#include "h8226.h"
+#include "h6706.h"
+#include "h7285.h"
+int main_777() { return 0; }
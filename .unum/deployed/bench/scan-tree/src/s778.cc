@@ -0,0 +1,6 @@
+#include "h5471.h"
+#include "h1969.h"
+#include "h4776.h"
+#include "h131.h"
+#include "h7150.h"
+int main_778() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9082.h"
+#include "h5960.h"
+#include "h1982.h"
+#include "h1455.h"
+#include "h622.h"
+int main_779() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2261.h"
+#include "h6916.h"
+#include "h6287.h"
+#include "h3229.h"
+#include "h6036.h"
+int main_78() { return 0; }
@@ -0,0 +1,9 @@
+#include "h3008.h"
+#include "h6091.h"
+#include "h58.h"
+#include "h8679.h"
+#include "h5859.h"
+#if 0
+#include "h1914.h"
+#endif
+int main_780() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2980.h"
+#include "h3444.h"
+#include "h4576.h"
+#include "h2108.h"
+#include "h5391.h"
+int main_781() { return 0; }
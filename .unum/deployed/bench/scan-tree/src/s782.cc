@@ -0,0 +1,6 @@
+#include "h1762.h"
+#include "h6203.h"
+#include "h5640.h"
+#include "h3815.h"
+#include "h594.h"
+int main_782() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3466.h"
+#include "h6072.h"
+#include "h6945.h"
+#include "h5549.h"
+#include "h1865.h"
+int main_783() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3768.h"
+#include "h1256.h"
+#include "h2836.h"
+#include "h4404.h"
+#include "h5105.h"
+int main_784() { return 0; }
@@ -0,0 +1,9 @@
+#include "h818.h"
+#include "h2040.h"
+#include "h8428.h"
+#include "h1284.h"
+#include "h953.h"
+#if 0
+#include "h245.h"
+#endif
+int main_785() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5583.h"
+#include "h3825.h"
+#include "h1267.h"
+#include "h6488.h"
+#include "h4547.h"
+int main_786() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8132.h"
+#include "h4431.h"
+#include "h7094.h"
+#include "h289.h"
+#include "h1942.h"
+int main_787() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6023.h"
+#include "h3175.h"
+#include "h580.h"
+#include "h6604.h"
+#include "h2614.h"
+int main_788() { return 0; }
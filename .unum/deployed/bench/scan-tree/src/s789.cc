@@ -0,0 +1,6 @@
+#include "h2090.h"
+#include "h4610.h"
+#include "h908.h"
+#include "h1889.h"
+#include "h1509.h"
+int main_789() { return 0; }
@@ -0,0 +1,6 @@
+#include "h984.h"
+#include "h1030.h"
+#include "h1164.h"
+#include "h4843.h"
+#include "h1473.h"
+int main_79() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8923.h"
+#include "h5749.h"
+#include "h3737.h"
+#include "h7564.h"
+#include "h1197.h"
+#if 0
+#include "h2083.h"
+#endif
+int main_790() { return 0; }
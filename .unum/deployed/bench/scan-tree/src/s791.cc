@@ -0,0 +1,6 @@
+#include "h6636.h"
+#include "h3219.h"
+#include "h3812.h"
+#include "h2199.h"
+#include "h2104.h"
+int main_791() { return 0; }
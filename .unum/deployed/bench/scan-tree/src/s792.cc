@@ -0,0 +1,6 @@
+#include "h1511.h"
+#include "h7603.h"
+#include "h6139.h"
+#include "h7279.h"
+#include "h7787.h"
+int main_792() { return 0; }
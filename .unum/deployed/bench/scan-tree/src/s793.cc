@@ -0,0 +1,6 @@
+#include "h1102.h"
+#include "h9728.h"
+#include "h9334.h"
+#include "h773.h"
+#include "h8020.h"
+int main_793() { return 0; }
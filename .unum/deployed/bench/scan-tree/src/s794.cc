@@ -0,0 +1,6 @@
+#include "h4568.h"
+#include "h2332.h"
+#include "h4376.h"
+#include "h9378.h"
+#include "h9518.h"
+int main_794() { return 0; }
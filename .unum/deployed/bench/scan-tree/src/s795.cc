@@ -0,0 +1,9 @@
+#include "h505.h"
+#include "h7861.h"
+#include "h2742.h"
+#include "h7941.h"
+#include "h3563.h"
+#if 0
+#include "h2800.h"
+#endif
+int main_795() { return 0; }
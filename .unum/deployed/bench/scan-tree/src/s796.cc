@@ -0,0 +1,6 @@
+#include "h9081.h"
+#include "h1343.h"
+#include "h1854.h"
+#include "h3361.h"
+#include "h6884.h"
+int main_796() { return 0; }
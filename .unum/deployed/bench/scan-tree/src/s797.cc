@@ -0,0 +1,6 @@
+#include "h6009.h"
+#include "h7412.h"
+#include "h1557.h"
+#include "h9236.h"
+#include "h8534.h"
+int main_797() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4827.h"
+#include "h4256.h"
+#include "h6691.h"
+#include "h7496.h"
+#include "h1644.h"
+int main_798() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3978.h"
+#include "h8324.h"
+#include "h1079.h"
+#include "h1066.h"
+#include "h871.h"
+int main_799() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4001.h"
+#include "h9237.h"
+#include "h1915.h"
+#include "h9824.h"
+#include "h4069.h"
+int main_8() { return 0; }
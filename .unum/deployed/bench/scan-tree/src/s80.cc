@@ -0,0 +1,9 @@
+#include "h4534.h"
+#include "h930.h"
+#include "h4377.h"
+#include "h9482.h"
+#include "h459.h"
+#if 0
+#include "h8766.h"
+#endif
+int main_80() { return 0; }
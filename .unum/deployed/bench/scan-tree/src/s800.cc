@@ -0,0 +1,9 @@
+#include "h7214.h"
+#include "h4264.h"
+#include "h7497.h"
+#include "h2357.h"
+#include "h971.h"
+#if 0
+#include "h3817.h"
+#endif
+int main_800() { return 0; }
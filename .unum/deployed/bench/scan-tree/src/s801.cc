@@ -0,0 +1,6 @@
+#include "h7138.h"
+#include "h4844.h"
+#include "h9220.h"
+#include "h6903.h"
+#include "h2511.h"
+int main_801() { return 0; }
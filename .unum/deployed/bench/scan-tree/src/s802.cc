@@ -0,0 +1,6 @@
+#include "h4328.h"
+#include "h3558.h"
+#include "h4872.h"
+#include "h143.h"
+#include "h4483.h"
+int main_802() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6957.h"
+#include "h8741.h"
+#include "h2445.h"
+#include "h8954.h"
+#include "h9836.h"
+int main_803() { return 0; }
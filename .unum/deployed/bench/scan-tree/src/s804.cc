@@ -0,0 +1,6 @@
+#include "h9425.h"
+#include "h2239.h"
+#include "h1692.h"
+#include "h1893.h"
+#include "h6430.h"
+int main_804() { return 0; }
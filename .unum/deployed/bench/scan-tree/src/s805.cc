@@ -0,0 +1,9 @@
+#include "h9450.h"
+#include "h1160.h"
+#include "h323.h"
+#include "h4271.h"
+#include "h4710.h"
+#if 0
+#include "h6604.h"
+#endif
+int main_805() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4580.h"
+#include "h503.h"
+#include "h6491.h"
+#include "h8394.h"
+#include "h1289.h"
+int main_806() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9609.h"
+#include "h5630.h"
+#include "h1896.h"
+#include "h8151.h"
+#include "h4614.h"
+int main_807() { return 0; }
@@ -0,0 +1,6 @@
+#include "h263.h"
+#include "h3879.h"
+#include "h9438.h"
+#include "h7354.h"
+#include "h8404.h"
+int main_808() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6773.h"
+#include "h9033.h"
+#include "h4470.h"
+#include "h2045.h"
+#include "h8706.h"
+int main_809() { return 0; }
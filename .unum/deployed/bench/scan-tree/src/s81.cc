@@ -0,0 +1,6 @@
+#include "h5386.h"
+#include "h4442.h"
+#include "h596.h"
+#include "h8147.h"
+#include "h311.h"
+int main_81() { return 0; }
@@ -0,0 +1,9 @@
+#include "h6621.h"
+#include "h6950.h"
+#include "h7222.h"
+#include "h3661.h"
+#include "h1064.h"
+#if 0
+#include "h8939.h"
+#endif
+int main_810() { return 0; }
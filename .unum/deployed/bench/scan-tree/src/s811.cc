@@ -0,0 +1,6 @@
+#include "h2530.h"
+#include "h5209.h"
+#include "h3477.h"
+#include "h2343.h"
+#include "h3122.h"
+int main_811() { return 0; }
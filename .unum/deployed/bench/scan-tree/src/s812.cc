@@ -0,0 +1,6 @@
+#include "h4073.h"
+#include "h9519.h"
+#include "h2104.h"
+#include "h2931.h"
+#include "h515.h"
+int main_812() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7932.h"
+#include "h6451.h"
+#include "h3052.h"
+#include "h2238.h"
+#include "h6374.h"
+int main_813() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8403.h"
+#include "h6471.h"
+#include "h4102.h"
+#include "h5186.h"
+#include "h3172.h"
+int main_814() { return 0; }
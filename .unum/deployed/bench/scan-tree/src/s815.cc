@@ -0,0 +1,9 @@
+#include "h7380.h"
+#include "h5360.h"
+#include "h2061.h"
+#include "h1656.h"
+#include "h4343.h"
+#if 0
+#include "h586.h"
+#endif
+int main_815() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3509.h"
+#include "h3868.h"
+#include "h1874.h"
+#include "h8016.h"
+#include "h6156.h"
+int main_816() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7581.h"
+#include "h2049.h"
+#include "h6595.h"
+#include "h4791.h"
+#include "h4208.h"
+int main_817() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7550.h"
+#include "h7659.h"
+#include "h4105.h"
+#include "h2784.h"
+#include "h9254.h"
+int main_818() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8642.h"
+#include "h5311.h"
+#include "h1047.h"
+#include "h4757.h"
+#include "h5070.h"
+int main_819() { return 0; }
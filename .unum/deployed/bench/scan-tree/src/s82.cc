@@ -0,0 +1,6 @@
+#include "h379.h"
+#include "h6223.h"
+#include "h5813.h"
+#include "h6789.h"
+#include "h2136.h"
+int main_82() { return 0; }
@@ -0,0 +1,9 @@
+#include "h266.h"
+#include "h1591.h"
+#include "h5772.h"
+#include "h4410.h"
+#include "h8875.h"
+#if 0
+#include "h3275.h"
+#endif
+int main_820() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3274.h"
+#include "h4532.h"
+#include "h9650.h"
+#include "h1630.h"
+#include "h1041.h"
+int main_821() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9983.h"
+#include "h7652.h"
+#include "h4126.h"
+#include "h8347.h"
+#include "h9379.h"
+int main_822() { return 0; }
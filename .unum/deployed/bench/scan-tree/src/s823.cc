@@ -0,0 +1,6 @@
+#include "h9858.h"
+#include "h6562.h"
+#include "h557.h"
+#include "h8663.h"
+#include "h8500.h"
+int main_823() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3487.h"
+#include "h1679.h"
+#include "h4204.h"
+#include "h240.h"
+#include "h8947.h"
+int main_824() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4626.h"
+#include "h9028.h"
+#include "h9938.h"
+#include "h136.h"
+#include "h2647.h"
+#if 0
+#include "h3498.h"
+#endif
+int main_825() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2392.h"
+#include "h8079.h"
+#include "h4898.h"
+#include "h7836.h"
+#include "h2971.h"
+int main_826() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3476.h"
+#include "h2095.h"
+#include "h2598.h"
+#include "h6851.h"
+#include "h2784.h"
+int main_827() { return 0; }
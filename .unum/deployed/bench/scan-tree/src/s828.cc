@@ -0,0 +1,6 @@
+#include "h8179.h"
+#include "h6978.h"
+#include "h7897.h"
+#include "h9488.h"
+#include "h7242.h"
+int main_828() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7847.h"
+#include "h7382.h"
+#include "h7429.h"
+#include "h8642.h"
+#include "h8166.h"
+int main_829() { return 0; }
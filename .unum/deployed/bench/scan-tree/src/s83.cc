@@ -0,0 +1,6 @@
+#include "h3094.h"
+#include "h9916.h"
+#include "h4412.h"
+#include "h2623.h"
+#include "h6074.h"
+int main_83() { return 0; }
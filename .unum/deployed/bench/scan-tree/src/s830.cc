@@ -0,0 +1,9 @@
+#include "h4826.h"
+#include "h393.h"
+#include "h4578.h"
+#include "h2310.h"
+#include "h1974.h"
+#if 0
+#include "h2482.h"
+#endif
+int main_830() { return 0; }
@@ -0,0 +1,6 @@
+#include "h343.h"
+#include "h4660.h"
+#include "h9313.h"
+#include "h6907.h"
+#include "h9692.h"
+int main_831() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9485.h"
+#include "h5257.h"
+#include "h2111.h"
+#include "h1280.h"
+#include "h1134.h"
+int main_832() { return 0; }
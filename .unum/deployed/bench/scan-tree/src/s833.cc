@@ -0,0 +1,6 @@
+#include "h8783.h"
+#include "h9104.h"
+#include "h4741.h"
+#include "h5884.h"
+#include "h8337.h"
+int main_833() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2328.h"
+#include "h1833.h"
+#include "h5888.h"
+#include "h8280.h"
+#include "h850.h"
+int main_834() { return 0; }
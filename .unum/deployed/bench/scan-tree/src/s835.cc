@@ -0,0 +1,9 @@
+#include "h2258.h"
+#include "h25.h"
+#include "h2779.h"
+#include "h7930.h"
+#include "h5435.h"
+#if 0
+#include "h8482.h"
+#endif
+int main_835() { return 0; }
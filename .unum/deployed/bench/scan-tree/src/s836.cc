@@ -0,0 +1,6 @@
+#include "h4823.h"
+#include "h9084.h"
+#include "h4970.h"
+#include "h4911.h"
+#include "h8531.h"
+int main_836() { return 0; }
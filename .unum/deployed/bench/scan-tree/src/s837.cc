@@ -0,0 +1,6 @@
+#include "h2548.h"
+#include "h7523.h"
+#include "h1733.h"
+#include "h1377.h"
+#include "h3287.h"
+int main_837() { return 0; }
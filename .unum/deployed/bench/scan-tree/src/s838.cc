@@ -0,0 +1,6 @@
+#include "h9845.h"
+#include "h2269.h"
+#include "h6775.h"
+#include "h8727.h"
+#include "h5741.h"
+int main_838() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1859.h"
+#include "h2159.h"
+#include "h7596.h"
+#include "h5212.h"
+#include "h3989.h"
+int main_839() { return 0; }
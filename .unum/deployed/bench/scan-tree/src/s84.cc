@@ -0,0 +1,6 @@
+#include "h3063.h"
+#include "h4195.h"
+#include "h867.h"
+#include "h5698.h"
+#include "h7925.h"
+int main_84() { return 0; }
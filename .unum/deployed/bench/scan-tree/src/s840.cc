@@ -0,0 +1,9 @@
+#include "h7572.h"
+#include "h5376.h"
+#include "h6194.h"
+#include "h6612.h"
+#include "h8357.h"
+#if 0
+#include "h5429.h"
+#endif
+int main_840() { return 0; }
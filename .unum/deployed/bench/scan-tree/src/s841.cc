@@ -0,0 +1,6 @@
+#include "h3895.h"
+#include "h7346.h"
+#include "h5059.h"
+#include "h2683.h"
+#include "h889.h"
+int main_841() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2775.h"
+#include "h3936.h"
+#include "h2513.h"
+#include "h5652.h"
+#include "h5763.h"
+int main_842() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9751.h"
+#include "h7815.h"
+#include "h3767.h"
+#include "h7696.h"
+#include "h8628.h"
+int main_843() { return 0; }
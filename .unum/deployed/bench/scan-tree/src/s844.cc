@@ -0,0 +1,6 @@
+#include "h556.h"
+#include "h4242.h"
+#include "h4434.h"
+#include "h5453.h"
+#include "h2422.h"
+int main_844() { return 0; }
@@ -0,0 +1,9 @@
+#include "h8653.h"
+#include "h9708.h"
+#include "h5692.h"
+#include "h2173.h"
+#include "h3711.h"
+#if 0
+#include "h1490.h"
+#endif
+int main_845() { return 0; }
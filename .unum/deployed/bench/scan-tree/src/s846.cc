@@ -0,0 +1,6 @@
+#include "h8411.h"
+#include "h3215.h"
+#include "h4326.h"
+#include "h1053.h"
+#include "h1755.h"
+int main_846() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3715.h"
+#include "h4697.h"
+#include "h6433.h"
+#include "h1348.h"
+#include "h3958.h"
+int main_847() { return 0; }
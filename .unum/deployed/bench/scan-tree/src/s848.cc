@@ -0,0 +1,6 @@
+#include "h7274.h"
+#include "h9581.h"
+#include "h2859.h"
+#include "h2024.h"
+#include "h2869.h"
+int main_848() { return 0; }
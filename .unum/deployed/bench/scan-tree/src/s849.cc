@@ -0,0 +1,6 @@
+#include "h8916.h"
+#include "h2214.h"
+#include "h414.h"
+#include "h8497.h"
+#include "h3456.h"
+int main_849() { return 0; }
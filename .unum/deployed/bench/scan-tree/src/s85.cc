@@ -0,0 +1,9 @@
+#include "h9906.h"
+#include "h8512.h"
+#include "h5140.h"
+#include "h8255.h"
+#include "h1014.h"
+#if 0
+#include "h8747.h"
+#endif
+int main_85() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4889.h"
+#include "h6918.h"
+#include "h3819.h"
+#include "h8891.h"
+#include "h11.h"
+#if 0
+#include "h6197.h"
+#endif
+int main_850() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7415.h"
+#include "h1830.h"
+#include "h7385.h"
+#include "h187.h"
+#include "h8505.h"
+int main_851() { return 0; }
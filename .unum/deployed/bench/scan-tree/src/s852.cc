@@ -0,0 +1,6 @@
+#include "h6084.h"
+#include "h2586.h"
+#include "h9538.h"
+#include "h9517.h"
+#include "h9909.h"
+int main_852() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3785.h"
+#include "h5918.h"
+#include "h5407.h"
+#include "h5022.h"
+#include "h3705.h"
+int main_853() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7306.h"
+#include "h5832.h"
+#include "h4704.h"
+#include "h6854.h"
+#include "h7203.h"
+int main_854() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2080.h"
+#include "h1017.h"
+#include "h8976.h"
+#include "h8535.h"
+#include "h7705.h"
+#if 0
+#include "h2514.h"
+#endif
+int main_855() { return 0; }
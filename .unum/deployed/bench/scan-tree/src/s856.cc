@@ -0,0 +1,6 @@
+#include "h6827.h"
+#include "h7605.h"
+#include "h7879.h"
+#include "h7600.h"
+#include "h600.h"
+int main_856() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5266.h"
+#include "h8478.h"
+#include "h2456.h"
+#include "h6065.h"
+#include "h4912.h"
+int main_857() { return 0; }
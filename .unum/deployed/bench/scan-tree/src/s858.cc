@@ -0,0 +1,6 @@
+#include "h708.h"
+#include "h7032.h"
+#include "h1874.h"
+#include "h7391.h"
+#include "h6108.h"
+int main_858() { return 0; }
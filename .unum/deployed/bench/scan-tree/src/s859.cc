@@ -0,0 +1,6 @@
+#include "h6706.h"
+#include "h6483.h"
+#include "h9919.h"
+#include "h5770.h"
+#include "h1437.h"
+int main_859() { return 0; }
@@ -0,0 +1,6 @@
+#include "h512.h"
+#include "h3003.h"
+#include "h7524.h"
+#include "h2899.h"
+#include "h4955.h"
+int main_86() { return 0; }
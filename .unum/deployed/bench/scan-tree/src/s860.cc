@@ -0,0 +1,9 @@
+#include "h4833.h"
+#include "h3058.h"
+#include "h4381.h"
+#include "h4034.h"
+#include "h7093.h"
+#if 0
+#include "h50.h"
+#endif
+int main_860() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2896.h"
+#include "h5361.h"
+#include "h5597.h"
+#include "h4160.h"
+#include "h2884.h"
+int main_861() { return 0; }
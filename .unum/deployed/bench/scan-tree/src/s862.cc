@@ -0,0 +1,6 @@
+#include "h6603.h"
+#include "h3381.h"
+#include "h4095.h"
+#include "h4954.h"
+#include "h4333.h"
+int main_862() { return 0; }
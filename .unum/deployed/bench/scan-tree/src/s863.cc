@@ -0,0 +1,6 @@
+#include "h6733.h"
+#include "h9777.h"
+#include "h9823.h"
+#include "h5582.h"
+#include "h179.h"
+int main_863() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2645.h"
+#include "h4954.h"
+#include "h6437.h"
+#include "h1357.h"
+#include "h6446.h"
+int main_864() { return 0; }
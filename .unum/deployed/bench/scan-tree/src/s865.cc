@@ -0,0 +1,9 @@
+#include "h2830.h"
+#include "h1742.h"
+#include "h2807.h"
+#include "h8237.h"
+#include "h228.h"
+#if 0
+#include "h5447.h"
+#endif
+int main_865() { return 0; }
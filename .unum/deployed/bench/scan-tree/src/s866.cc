@@ -0,0 +1,6 @@
+#include "h5187.h"
+#include "h4.h"
+#include "h5439.h"
+#include "h4212.h"
+#include "h9985.h"
+int main_866() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8198.h"
+#include "h3281.h"
+#include "h9568.h"
+#include "h2880.h"
+#include "h4751.h"
+int main_867() { return 0; }
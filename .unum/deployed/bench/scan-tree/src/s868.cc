@@ -0,0 +1,6 @@
+#include "h1585.h"
+#include "h5824.h"
+#include "h8930.h"
+#include "h7832.h"
+#include "h3241.h"
+int main_868() { return 0; }
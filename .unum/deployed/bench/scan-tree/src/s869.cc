@@ -0,0 +1,6 @@
+#include "h5231.h"
+#include "h2317.h"
+#include "h2215.h"
+#include "h3457.h"
+#include "h2586.h"
+int main_869() { return 0; }
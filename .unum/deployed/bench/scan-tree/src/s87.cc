@@ -0,0 +1,6 @@
+#include "h7268.h"
+#include "h7339.h"
+#include "h7805.h"
+#include "h9834.h"
+#include "h7964.h"
+int main_87() { return 0; }
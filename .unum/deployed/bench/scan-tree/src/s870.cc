@@ -0,0 +1,9 @@
+#include "h2284.h"
+#include "h7807.h"
+#include "h5046.h"
+#include "h8935.h"
+#include "h6894.h"
+#if 0
+#include "h7688.h"
+#endif
+int main_870() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6842.h"
+#include "h9500.h"
+#include "h6457.h"
+#include "h2065.h"
+#include "h2740.h"
+int main_871() { return 0; }
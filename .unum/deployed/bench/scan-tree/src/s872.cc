@@ -0,0 +1,6 @@
+#include "h5995.h"
+#include "h6428.h"
+#include "h847.h"
+#include "h6693.h"
+#include "h4853.h"
+int main_872() { return 0; }
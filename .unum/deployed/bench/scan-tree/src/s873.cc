@@ -0,0 +1,6 @@
+#include "h7454.h"
+#include "h8390.h"
+#include "h2071.h"
+#include "h4058.h"
+#include "h8232.h"
+int main_873() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7939.h"
+#include "h338.h"
+#include "h951.h"
+#include "h333.h"
+#include "h898.h"
+int main_874() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5382.h"
+#include "h9122.h"
+#include "h7121.h"
+#include "h9573.h"
+#include "h4792.h"
+#if 0
+#include "h9063.h"
+#endif
+int main_875() { return 0; }
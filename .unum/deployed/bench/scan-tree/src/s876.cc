@@ -0,0 +1,6 @@
+#include "h8105.h"
+#include "h5195.h"
+#include "h9286.h"
+#include "h8177.h"
+#include "h8166.h"
+int main_876() { return 0; }
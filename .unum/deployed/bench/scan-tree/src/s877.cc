@@ -0,0 +1,6 @@
+#include "h6178.h"
+#include "h5771.h"
+#include "h9357.h"
+#include "h3383.h"
+#include "h3278.h"
+int main_877() { return 0; }
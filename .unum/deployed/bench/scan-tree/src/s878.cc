@@ -0,0 +1,6 @@
+#include "h2829.h"
+#include "h2455.h"
+#include "h9650.h"
+#include "h498.h"
+#include "h4740.h"
+int main_878() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3565.h"
+#include "h9114.h"
+#include "h3684.h"
+#include "h3338.h"
+#include "h3138.h"
+int main_879() { return 0; }
@@ -0,0 +1,6 @@
+#include "h190.h"
+#include "h2085.h"
+#include "h917.h"
+#include "h9888.h"
+#include "h4907.h"
+int main_88() { return 0; }
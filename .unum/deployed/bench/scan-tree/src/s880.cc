@@ -0,0 +1,9 @@
+#include "h6991.h"
+#include "h4476.h"
+#include "h3298.h"
+#include "h4702.h"
+#include "h3586.h"
+#if 0
+#include "h6202.h"
+#endif
+int main_880() { return 0; }
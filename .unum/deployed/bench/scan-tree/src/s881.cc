@@ -0,0 +1,6 @@
+#include "h5703.h"
+#include "h1085.h"
+#include "h2922.h"
+#include "h5449.h"
+#include "h8406.h"
+int main_881() { return 0; }
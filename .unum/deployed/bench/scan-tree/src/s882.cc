@@ -0,0 +1,6 @@
+#include "h5749.h"
+#include "h6363.h"
+#include "h9578.h"
+#include "h7098.h"
+#include "h1779.h"
+int main_882() { return 0; }
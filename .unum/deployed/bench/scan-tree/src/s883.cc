@@ -0,0 +1,6 @@
+#include "h1379.h"
+#include "h7021.h"
+#include "h4511.h"
+#include "h1488.h"
+#include "h8568.h"
+int main_883() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9360.h"
+#include "h3632.h"
+#include "h3688.h"
+#include "h1235.h"
+#include "h2771.h"
+int main_884() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1785.h"
+#include "h3808.h"
+#include "h5787.h"
+#include "h9043.h"
+#include "h7615.h"
+#if 0
+#include "h5863.h"
+#endif
+int main_885() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1150.h"
+#include "h8155.h"
+#include "h4913.h"
+#include "h1359.h"
+#include "h2929.h"
+int main_886() { return 0; }
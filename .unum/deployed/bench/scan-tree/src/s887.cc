@@ -0,0 +1,6 @@
+#include "h2850.h"
+#include "h7058.h"
+#include "h7855.h"
+#include "h7991.h"
+#include "h1703.h"
+int main_887() { return 0; }
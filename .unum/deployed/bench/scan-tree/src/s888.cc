@@ -0,0 +1,6 @@
+#include "h7912.h"
+#include "h5433.h"
+#include "h1475.h"
+#include "h82.h"
+#include "h3080.h"
+int main_888() { return 0; }
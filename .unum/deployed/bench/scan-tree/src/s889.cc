@@ -0,0 +1,6 @@
+#include "h9727.h"
+#include "h993.h"
+#include "h382.h"
+#include "h828.h"
+#include "h8993.h"
+int main_889() { return 0; }
@@ -0,0 +1,6 @@
+#include "h836.h"
+#include "h1431.h"
+#include "h2140.h"
+#include "h1974.h"
+#include "h4954.h"
+int main_89() { return 0; }
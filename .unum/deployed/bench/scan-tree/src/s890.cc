@@ -0,0 +1,9 @@
+#include "h1361.h"
+#include "h5641.h"
+#include "h7179.h"
+#include "h1812.h"
+#include "h8043.h"
+#if 0
+#include "h7827.h"
+#endif
+int main_890() { return 0; }
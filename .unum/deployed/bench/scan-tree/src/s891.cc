@@ -0,0 +1,6 @@
+#include "h764.h"
+#include "h4447.h"
+#include "h4868.h"
+#include "h2841.h"
+#include "h638.h"
+int main_891() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2349.h"
+#include "h4428.h"
+#include "h7297.h"
+#include "h7035.h"
+#include "h2265.h"
+int main_892() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7853.h"
+#include "h4371.h"
+#include "h7233.h"
+#include "h126.h"
+#include "h8364.h"
+int main_893() { return 0; }
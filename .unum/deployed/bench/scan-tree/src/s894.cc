@@ -0,0 +1,6 @@
+#include "h8713.h"
+#include "h2302.h"
+#include "h929.h"
+#include "h906.h"
+#include "h8056.h"
+int main_894() { return 0; }
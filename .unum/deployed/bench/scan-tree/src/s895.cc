@@ -0,0 +1,9 @@
+#include "h4570.h"
+#include "h6907.h"
+#include "h9659.h"
+#include "h7298.h"
+#include "h4342.h"
+#if 0
+#include "h4500.h"
+#endif
+int main_895() { return 0; }
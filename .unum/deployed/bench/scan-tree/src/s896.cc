@@ -0,0 +1,6 @@
+#include "h1887.h"
+#include "h2960.h"
+#include "h9565.h"
+#include "h157.h"
+#include "h8028.h"
+int main_896() { return 0; }
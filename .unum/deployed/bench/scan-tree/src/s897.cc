@@ -0,0 +1,6 @@
+#include "h1679.h"
+#include "h558.h"
+#include "h7732.h"
+#include "h9299.h"
+#include "h8007.h"
+int main_897() { return 0; }
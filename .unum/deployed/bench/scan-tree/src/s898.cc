@@ -0,0 +1,6 @@
+#include "h4446.h"
+#include "h8064.h"
+#include "h6304.h"
+#include "h2567.h"
+#include "h2595.h"
+int main_898() { return 0; }
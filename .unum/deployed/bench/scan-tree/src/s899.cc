@@ -0,0 +1,6 @@
+#include "h6333.h"
+#include "h2670.h"
+#include "h1702.h"
+#include "h8593.h"
+#include "h2687.h"
+int main_899() { return 0; }
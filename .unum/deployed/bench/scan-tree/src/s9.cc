@@ -0,0 +1,6 @@
+#include "h424.h"
+#include "h1969.h"
+#include "h8236.h"
+#include "h5159.h"
+#include "h7938.h"
+int main_9() { return 0; }
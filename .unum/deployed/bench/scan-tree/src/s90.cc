@@ -0,0 +1,9 @@
+#include "h7760.h"
+#include "h1863.h"
+#include "h4773.h"
+#include "h7305.h"
+#include "h8793.h"
+#if 0
+#include "h4788.h"
+#endif
+int main_90() { return 0; }
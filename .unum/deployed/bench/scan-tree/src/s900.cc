@@ -0,0 +1,9 @@
+#include "h9502.h"
+#include "h3500.h"
+#include "h6325.h"
+#include "h4556.h"
+#include "h2330.h"
+#if 0
+#include "h5723.h"
+#endif
+int main_900() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7521.h"
+#include "h9403.h"
+#include "h8123.h"
+#include "h7364.h"
+#include "h8720.h"
+int main_901() { return 0; }
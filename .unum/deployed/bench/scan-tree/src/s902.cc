@@ -0,0 +1,6 @@
+#include "h1343.h"
+#include "h2625.h"
+#include "h2199.h"
+#include "h1461.h"
+#include "h4644.h"
+int main_902() { return 0; }
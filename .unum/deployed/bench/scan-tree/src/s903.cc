@@ -0,0 +1,6 @@
+#include "h9465.h"
+#include "h1501.h"
+#include "h4769.h"
+#include "h2915.h"
+#include "h3271.h"
+int main_903() { return 0; }
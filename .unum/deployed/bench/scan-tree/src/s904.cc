@@ -0,0 +1,6 @@
+#include "h3262.h"
+#include "h2891.h"
+#include "h7324.h"
+#include "h4353.h"
+#include "h288.h"
+int main_904() { return 0; }
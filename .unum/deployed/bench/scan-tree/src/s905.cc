@@ -0,0 +1,9 @@
+#include "h9499.h"
+#include "h5676.h"
+#include "h225.h"
+#include "h9986.h"
+#include "h9430.h"
+#if 0
+#include "h9530.h"
+#endif
+int main_905() { return 0; }
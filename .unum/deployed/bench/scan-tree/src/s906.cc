@@ -0,0 +1,6 @@
+#include "h2731.h"
+#include "h4216.h"
+#include "h9934.h"
+#include "h1600.h"
+#include "h5685.h"
+int main_906() { return 0; }
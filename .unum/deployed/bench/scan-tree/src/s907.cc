@@ -0,0 +1,6 @@
+#include "h9256.h"
+#include "h4835.h"
+#include "h4420.h"
+#include "h125.h"
+#include "h1615.h"
+int main_907() { return 0; }
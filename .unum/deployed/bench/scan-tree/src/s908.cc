@@ -0,0 +1,6 @@
+#include "h5837.h"
+#include "h9745.h"
+#include "h8432.h"
+#include "h3553.h"
+#include "h469.h"
+int main_908() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8498.h"
+#include "h2767.h"
+#include "h9367.h"
+#include "h8545.h"
+#include "h4493.h"
+int main_909() { return 0; }
@@ -0,0 +1,6 @@
+#include "h149.h"
+#include "h8475.h"
+#include "h3571.h"
+#include "h122.h"
+#include "h4007.h"
+int main_91() { return 0; }
@@ -0,0 +1,9 @@
+#include "h7993.h"
+#include "h5650.h"
+#include "h4515.h"
+#include "h8528.h"
+#include "h7593.h"
+#if 0
+#include "h513.h"
+#endif
+int main_910() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1130.h"
+#include "h8004.h"
+#include "h5355.h"
+#include "h811.h"
+#include "h1879.h"
+int main_911() { return 0; }
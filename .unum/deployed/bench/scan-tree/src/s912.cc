@@ -0,0 +1,6 @@
+#include "h2928.h"
+#include "h594.h"
+#include "h5831.h"
+#include "h7368.h"
+#include "h5850.h"
+int main_912() { return 0; }
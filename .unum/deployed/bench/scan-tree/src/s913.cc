@@ -0,0 +1,6 @@
+#include "h5332.h"
+#include "h3727.h"
+#include "h9044.h"
+#include "h1567.h"
+#include "h4064.h"
+int main_913() { return 0; }
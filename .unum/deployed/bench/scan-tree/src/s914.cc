@@ -0,0 +1,6 @@
+#include "h8328.h"
+#include "h9342.h"
+#include "h8255.h"
+#include "h8904.h"
+#include "h6121.h"
+int main_914() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2941.h"
+#include "h1785.h"
+#include "h284.h"
+#include "h3835.h"
+#include "h9483.h"
+#if 0
+#include "h505.h"
+#endif
+int main_915() { return 0; }
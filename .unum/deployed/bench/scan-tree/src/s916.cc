@@ -0,0 +1,6 @@
+#include "h4660.h"
+#include "h400.h"
+#include "h6314.h"
+#include "h3265.h"
+#include "h9986.h"
+int main_916() { return 0; }
@@ -0,0 +1,6 @@
+#include "h674.h"
+#include "h3692.h"
+#include "h1228.h"
+#include "h200.h"
+#include "h5083.h"
+int main_917() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5766.h"
+#include "h6704.h"
+#include "h2365.h"
+#include "h6341.h"
+#include "h6891.h"
+int main_918() { return 0; }
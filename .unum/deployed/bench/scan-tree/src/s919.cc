@@ -0,0 +1,6 @@
+#include "h5432.h"
+#include "h7784.h"
+#include "h8068.h"
+#include "h5800.h"
+#include "h6400.h"
+int main_919() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5492.h"
+#include "h4499.h"
+#include "h37.h"
+#include "h8080.h"
+#include "h8117.h"
+int main_92() { return 0; }
@@ -0,0 +1,9 @@
+#include "h84.h"
+#include "h5614.h"
+#include "h552.h"
+#include "h8804.h"
+#include "h4481.h"
+#if 0
+#include "h2769.h"
+#endif
+int main_920() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5431.h"
+#include "h1836.h"
+#include "h6987.h"
+#include "h8934.h"
+#include "h9994.h"
+int main_921() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4874.h"
+#include "h5187.h"
+#include "h8627.h"
+#include "h6569.h"
+#include "h3922.h"
+int main_922() { return 0; }
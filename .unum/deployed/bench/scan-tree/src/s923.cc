@@ -0,0 +1,6 @@
+#include "h3707.h"
+#include "h9594.h"
+#include "h7189.h"
+#include "h6276.h"
+#include "h7037.h"
+int main_923() { return 0; }
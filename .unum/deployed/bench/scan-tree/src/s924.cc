@@ -0,0 +1,6 @@
+#include "h1347.h"
+#include "h5432.h"
+#include "h3961.h"
+#include "h9979.h"
+#include "h1131.h"
+int main_924() { return 0; }
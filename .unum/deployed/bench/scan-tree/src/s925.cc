@@ -0,0 +1,9 @@
+#include "h5501.h"
+#include "h3531.h"
+#include "h6137.h"
+#include "h8814.h"
+#include "h2664.h"
+#if 0
+#include "h5754.h"
+#endif
+int main_925() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5519.h"
+#include "h6739.h"
+#include "h9984.h"
+#include "h3325.h"
+#include "h7463.h"
+int main_926() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6319.h"
+#include "h3724.h"
+#include "h18.h"
+#include "h1576.h"
+#include "h7442.h"
+int main_927() { return 0; }
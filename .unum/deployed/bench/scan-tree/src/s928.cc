@@ -0,0 +1,6 @@
+#include "h4346.h"
+#include "h3948.h"
+#include "h386.h"
+#include "h4282.h"
+#include "h1105.h"
+int main_928() { return 0; }
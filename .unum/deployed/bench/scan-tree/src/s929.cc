@@ -0,0 +1,6 @@
+#include "h9802.h"
+#include "h3769.h"
+#include "h605.h"
+#include "h2826.h"
+#include "h1388.h"
+int main_929() { return 0; }
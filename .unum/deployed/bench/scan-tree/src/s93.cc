@@ -0,0 +1,6 @@
+#include "h5637.h"
+#include "h4413.h"
+#include "h8779.h"
+#include "h7442.h"
+#include "h3497.h"
+int main_93() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2535.h"
+#include "h6501.h"
+#include "h3648.h"
+#include "h2212.h"
+#include "h6998.h"
+#if 0
+#include "h2510.h"
+#endif
+int main_930() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3502.h"
+#include "h3548.h"
+#include "h3228.h"
+#include "h2574.h"
+#include "h6607.h"
+int main_931() { return 0; }
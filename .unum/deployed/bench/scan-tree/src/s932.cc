@@ -0,0 +1,6 @@
+#include "h2392.h"
+#include "h5627.h"
+#include "h2924.h"
+#include "h9666.h"
+#include "h5120.h"
+int main_932() { return 0; }
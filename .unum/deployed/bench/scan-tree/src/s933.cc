@@ -0,0 +1,6 @@
+#include "h2568.h"
+#include "h2793.h"
+#include "h637.h"
+#include "h3213.h"
+#include "h9522.h"
+int main_933() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1376.h"
+#include "h3194.h"
+#include "h2452.h"
+#include "h8064.h"
+#include "h3196.h"
+int main_934() { return 0; }
@@ -0,0 +1,9 @@
+#include "h4169.h"
+#include "h3925.h"
+#include "h9364.h"
+#include "h5091.h"
+#include "h8352.h"
+#if 0
+#include "h4935.h"
+#endif
+int main_935() { return 0; }
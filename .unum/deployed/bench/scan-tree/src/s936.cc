@@ -0,0 +1,6 @@
+#include "h2239.h"
+#include "h9523.h"
+#include "h6247.h"
+#include "h8885.h"
+#include "h3294.h"
+int main_936() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1624.h"
+#include "h8321.h"
+#include "h2581.h"
+#include "h4126.h"
+#include "h2562.h"
+int main_937() { return 0; }
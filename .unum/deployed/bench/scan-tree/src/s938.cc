@@ -0,0 +1,6 @@
+#include "h4650.h"
+#include "h2682.h"
+#include "h681.h"
+#include "h8525.h"
+#include "h7241.h"
+int main_938() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1558.h"
+#include "h5525.h"
+#include "h4644.h"
+#include "h1777.h"
+#include "h5165.h"
+int main_939() { return 0; }
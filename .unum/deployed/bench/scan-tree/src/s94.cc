@@ -0,0 +1,6 @@
+#include "h9566.h"
+#include "h1037.h"
+#include "h7165.h"
+#include "h8789.h"
+#include "h9223.h"
+int main_94() { return 0; }
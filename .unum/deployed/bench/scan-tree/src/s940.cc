@@ -0,0 +1,9 @@
+#include "h6505.h"
+#include "h1290.h"
+#include "h2410.h"
+#include "h9308.h"
+#include "h9296.h"
+#if 0
+#include "h1882.h"
+#endif
+int main_940() { return 0; }
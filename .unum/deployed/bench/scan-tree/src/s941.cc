@@ -0,0 +1,6 @@
+#include "h1218.h"
+#include "h6044.h"
+#include "h3596.h"
+#include "h8496.h"
+#include "h4557.h"
+int main_941() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8614.h"
+#include "h1164.h"
+#include "h2268.h"
+#include "h3556.h"
+#include "h1969.h"
+int main_942() { return 0; }
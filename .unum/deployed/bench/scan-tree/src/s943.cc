@@ -0,0 +1,6 @@
+#include "h3157.h"
+#include "h5535.h"
+#include "h5298.h"
+#include "h1185.h"
+#include "h2970.h"
+int main_943() { return 0; }
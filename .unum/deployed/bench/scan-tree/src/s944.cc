@@ -0,0 +1,6 @@
+#include "h206.h"
+#include "h5168.h"
+#include "h9776.h"
+#include "h7407.h"
+#include "h4152.h"
+int main_944() { return 0; }
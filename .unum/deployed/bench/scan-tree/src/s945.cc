@@ -0,0 +1,9 @@
+#include "h2123.h"
+#include "h1961.h"
+#include "h3299.h"
+#include "h3008.h"
+#include "h9736.h"
+#if 0
+#include "h182.h"
+#endif
+int main_945() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8654.h"
+#include "h5868.h"
+#include "h7213.h"
+#include "h3181.h"
+#include "h3911.h"
+int main_946() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9213.h"
+#include "h8822.h"
+#include "h8440.h"
+#include "h3336.h"
+#include "h4788.h"
+int main_947() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6919.h"
+#include "h1717.h"
+#include "h1933.h"
+#include "h8663.h"
+#include "h7032.h"
+int main_948() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8180.h"
+#include "h6432.h"
+#include "h1680.h"
+#include "h8610.h"
+#include "h1842.h"
+int main_949() { return 0; }
@@ -0,0 +1,9 @@
+#include "h1195.h"
+#include "h9298.h"
+#include "h5793.h"
+#include "h8862.h"
+#include "h3133.h"
+#if 0
+#include "h5635.h"
+#endif
+int main_95() { return 0; }
@@ -0,0 +1,9 @@
+#include "h2424.h"
+#include "h5517.h"
+#include "h3978.h"
+#include "h2273.h"
+#include "h3469.h"
+#if 0
+#include "h7189.h"
+#endif
+int main_950() { return 0; }
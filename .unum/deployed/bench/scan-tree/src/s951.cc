@@ -0,0 +1,6 @@
+#include "h5057.h"
+#include "h7293.h"
+#include "h6987.h"
+#include "h8963.h"
+#include "h2374.h"
+int main_951() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5621.h"
+#include "h2476.h"
+#include "h4916.h"
+#include "h3039.h"
+#include "h2274.h"
+int main_952() { return 0; }
@@ -0,0 +1,6 @@
+#include "h6323.h"
+#include "h5053.h"
+#include "h3340.h"
+#include "h6666.h"
+#include "h3832.h"
+int main_953() { return 0; }
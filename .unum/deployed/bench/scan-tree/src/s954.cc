@@ -0,0 +1,6 @@
+#include "h453.h"
+#include "h8587.h"
+#include "h6309.h"
+#include "h9667.h"
+#include "h4913.h"
+int main_954() { return 0; }
@@ -0,0 +1,9 @@
+#include "h5683.h"
+#include "h7477.h"
+#include "h9097.h"
+#include "h8114.h"
+#include "h9874.h"
+#if 0
+#include "h8009.h"
+#endif
+int main_955() { return 0; }
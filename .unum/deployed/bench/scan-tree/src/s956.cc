@@ -0,0 +1,6 @@
+#include "h2028.h"
+#include "h9209.h"
+#include "h6491.h"
+#include "h9063.h"
+#include "h3595.h"
+int main_956() { return 0; }
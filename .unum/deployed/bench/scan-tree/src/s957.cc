@@ -0,0 +1,6 @@
+#include "h628.h"
+#include "h7068.h"
+#include "h5094.h"
+#include "h6350.h"
+#include "h5272.h"
+int main_957() { return 0; }
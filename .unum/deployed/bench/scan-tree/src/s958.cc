@@ -0,0 +1,6 @@
+#include "h5999.h"
+#include "h9013.h"
+#include "h2141.h"
+#include "h7387.h"
+#include "h2106.h"
+int main_958() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8572.h"
+#include "h2421.h"
+#include "h2839.h"
+#include "h5202.h"
+#include "h8028.h"
+int main_959() { return 0; }
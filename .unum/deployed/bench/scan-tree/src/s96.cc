@@ -0,0 +1,6 @@
+#include "h301.h"
+#include "h3631.h"
+#include "h3500.h"
+#include "h2920.h"
+#include "h8250.h"
+int main_96() { return 0; }
@@ -0,0 +1,9 @@
+#include "h726.h"
+#include "h6369.h"
+#include "h8357.h"
+#include "h4528.h"
+#include "h7738.h"
+#if 0
+#include "h124.h"
+#endif
+int main_960() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2559.h"
+#include "h1564.h"
+#include "h688.h"
+#include "h7887.h"
+#include "h4916.h"
+int main_961() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2599.h"
+#include "h6618.h"
+#include "h9483.h"
+#include "h396.h"
+#include "h366.h"
+int main_962() { return 0; }
@@ -0,0 +1,6 @@
+#include "h2669.h"
+#include "h1337.h"
+#include "h8213.h"
+#include "h2666.h"
+#include "h3156.h"
+int main_963() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4511.h"
+#include "h4636.h"
+#include "h8532.h"
+#include "h1270.h"
+#include "h4391.h"
+int main_964() { return 0; }
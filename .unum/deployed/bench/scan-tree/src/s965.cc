@@ -0,0 +1,9 @@
+#include "h2792.h"
+#include "h2924.h"
+#include "h3351.h"
+#include "h1394.h"
+#include "h2888.h"
+#if 0
+#include "h2777.h"
+#endif
+int main_965() { return 0; }
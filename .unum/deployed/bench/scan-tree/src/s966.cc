@@ -0,0 +1,6 @@
+#include "h5110.h"
+#include "h5379.h"
+#include "h4650.h"
+#include "h2588.h"
+#include "h8033.h"
+int main_966() { return 0; }
@@ -0,0 +1,6 @@
+#include "h441.h"
+#include "h4347.h"
+#include "h1927.h"
+#include "h2091.h"
+#include "h3490.h"
+int main_967() { return 0; }
@@ -0,0 +1,6 @@
+#include "h1581.h"
+#include "h3767.h"
+#include "h2551.h"
+#include "h6616.h"
+#include "h6258.h"
+int main_968() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9363.h"
+#include "h9216.h"
+#include "h8789.h"
+#include "h9393.h"
+#include "h2566.h"
+int main_969() { return 0; }
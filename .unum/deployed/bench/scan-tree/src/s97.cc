@@ -0,0 +1,6 @@
+#include "h4441.h"
+#include "h4630.h"
+#include "h5264.h"
+#include "h5295.h"
+#include "h9754.h"
+int main_97() { return 0; }
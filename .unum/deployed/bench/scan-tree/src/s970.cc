@@ -0,0 +1,9 @@
+#include "h5964.h"
+#include "h1314.h"
+#include "h4837.h"
+#include "h4902.h"
+#include "h3905.h"
+#if 0
+#include "h99.h"
+#endif
+int main_970() { return 0; }
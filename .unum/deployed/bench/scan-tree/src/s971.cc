@@ -0,0 +1,6 @@
+#include "h8785.h"
+#include "h9682.h"
+#include "h5341.h"
+#include "h9071.h"
+#include "h1464.h"
+int main_971() { return 0; }
@@ -0,0 +1,6 @@
+#include "h995.h"
+#include "h9847.h"
+#include "h3529.h"
+#include "h9696.h"
+#include "h1285.h"
+int main_972() { return 0; }
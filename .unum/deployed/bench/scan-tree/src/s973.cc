@@ -0,0 +1,6 @@
+#include "h4245.h"
+#include "h6839.h"
+#include "h8288.h"
+#include "h4555.h"
+#include "h1322.h"
+int main_973() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9923.h"
+#include "h9289.h"
+#include "h1596.h"
+#include "h7608.h"
+#include "h2015.h"
+int main_974() { return 0; }
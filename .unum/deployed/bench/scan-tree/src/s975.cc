@@ -0,0 +1,9 @@
+#include "h4137.h"
+#include "h10.h"
+#include "h1725.h"
+#include "h522.h"
+#include "h8250.h"
+#if 0
+#include "h8565.h"
+#endif
+int main_975() { return 0; }
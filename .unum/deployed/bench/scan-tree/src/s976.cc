@@ -0,0 +1,6 @@
+#include "h7856.h"
+#include "h651.h"
+#include "h8956.h"
+#include "h3214.h"
+#include "h2177.h"
+int main_976() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9168.h"
+#include "h7886.h"
+#include "h4996.h"
+#include "h6514.h"
+#include "h9782.h"
+int main_977() { return 0; }
@@ -0,0 +1,6 @@
+#include "h238.h"
+#include "h5442.h"
+#include "h8453.h"
+#include "h1783.h"
+#include "h3706.h"
+int main_978() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9179.h"
+#include "h1735.h"
+#include "h2927.h"
+#include "h3134.h"
+#include "h7600.h"
+int main_979() { return 0; }
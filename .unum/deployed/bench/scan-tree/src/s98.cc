@@ -0,0 +1,6 @@
+#include "h895.h"
+#include "h3756.h"
+#include "h4621.h"
+#include "h8014.h"
+#include "h748.h"
+int main_98() { return 0; }
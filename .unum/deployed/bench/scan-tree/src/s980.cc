@@ -0,0 +1,9 @@
+#include "h4452.h"
+#include "h5814.h"
+#include "h8437.h"
+#include "h5453.h"
+#include "h2659.h"
+#if 0
+#include "h8865.h"
+#endif
+int main_980() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5067.h"
+#include "h8869.h"
+#include "h476.h"
+#include "h9170.h"
+#include "h301.h"
+int main_981() { return 0; }
@@ -0,0 +1,6 @@
+#include "h9862.h"
+#include "h9554.h"
+#include "h3913.h"
+#include "h7587.h"
+#include "h2081.h"
+int main_982() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4226.h"
+#include "h1041.h"
+#include "h8363.h"
+#include "h9365.h"
+#include "h7291.h"
+int main_983() { return 0; }
@@ -0,0 +1,6 @@
+#include "h5686.h"
+#include "h8993.h"
+#include "h3505.h"
+#include "h5546.h"
+#include "h963.h"
+int main_984() { return 0; }
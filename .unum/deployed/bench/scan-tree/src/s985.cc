@@ -0,0 +1,9 @@
+#include "h6046.h"
+#include "h7534.h"
+#include "h3177.h"
+#include "h721.h"
+#include "h8720.h"
+#if 0
+#include "h4913.h"
+#endif
+int main_985() { return 0; }
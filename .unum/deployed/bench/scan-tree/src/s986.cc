@@ -0,0 +1,6 @@
+#include "h4170.h"
+#include "h8439.h"
+#include "h5831.h"
+#include "h4327.h"
+#include "h3156.h"
+int main_986() { return 0; }
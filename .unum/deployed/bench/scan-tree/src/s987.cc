@@ -0,0 +1,6 @@
+#include "h4613.h"
+#include "h1517.h"
+#include "h4182.h"
+#include "h6624.h"
+#include "h1583.h"
+int main_987() { return 0; }
@@ -0,0 +1,6 @@
+#include "h4571.h"
+#include "h9501.h"
+#include "h1249.h"
+#include "h2917.h"
+#include "h7223.h"
+int main_988() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3018.h"
+#include "h9499.h"
+#include "h228.h"
+#include "h6213.h"
+#include "h4391.h"
+int main_989() { return 0; }
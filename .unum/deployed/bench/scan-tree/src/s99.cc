@@ -0,0 +1,6 @@
+#include "h159.h"
+#include "h9695.h"
+#include "h774.h"
+#include "h398.h"
+#include "h5337.h"
+int main_99() { return 0; }
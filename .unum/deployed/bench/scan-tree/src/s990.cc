@@ -0,0 +1,9 @@
+#include "h9196.h"
+#include "h3546.h"
+#include "h6815.h"
+#include "h3052.h"
+#include "h9534.h"
+#if 0
+#include "h8093.h"
+#endif
+int main_990() { return 0; }
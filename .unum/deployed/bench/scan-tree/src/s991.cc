@@ -0,0 +1,6 @@
+#include "h271.h"
+#include "h4478.h"
+#include "h7137.h"
+#include "h6097.h"
+#include "h3787.h"
+int main_991() { return 0; }
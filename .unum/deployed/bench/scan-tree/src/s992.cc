@@ -0,0 +1,6 @@
+#include "h6802.h"
+#include "h1881.h"
+#include "h6198.h"
+#include "h7083.h"
+#include "h3615.h"
+int main_992() { return 0; }
@@ -0,0 +1,6 @@
+#include "h8918.h"
+#include "h6191.h"
+#include "h961.h"
+#include "h8919.h"
+#include "h3920.h"
+int main_993() { return 0; }
@@ -0,0 +1,6 @@
+#include "h3125.h"
+#include "h7433.h"
+#include "h8218.h"
+#include "h7223.h"
+#include "h5031.h"
+int main_994() { return 0; }
@@ -0,0 +1,9 @@
+#include "h874.h"
+#include "h4062.h"
+#include "h5533.h"
+#include "h1655.h"
+#include "h1438.h"
+#if 0
+#include "h8180.h"
+#endif
+int main_995() { return 0; }
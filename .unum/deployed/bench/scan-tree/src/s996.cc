@@ -0,0 +1,6 @@
+#include "h6514.h"
+#include "h1696.h"
+#include "h7489.h"
+#include "h9996.h"
+#include "h7529.h"
+int main_996() { return 0; }
@@ -0,0 +1,6 @@
+#include "h692.h"
+#include "h468.h"
+#include "h993.h"
+#include "h5915.h"
+#include "h7750.h"
+int main_997() { return 0; }
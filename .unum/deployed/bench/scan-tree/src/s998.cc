@@ -0,0 +1,6 @@
+#include "h7619.h"
+#include "h2373.h"
+#include "h5719.h"
+#include "h4981.h"
+#include "h9303.h"
+int main_998() { return 0; }
@@ -0,0 +1,6 @@
+#include "h7469.h"
+#include "h5007.h"
+#include "h9538.h"
+#include "h2088.h"
+#include "h2957.h"
+int main_999() { return 0; }
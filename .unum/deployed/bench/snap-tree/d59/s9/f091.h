@@ -0,0 +1,30 @@
+int x;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
+int y;
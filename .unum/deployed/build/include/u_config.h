@@ -0,0 +1,48 @@
+#ifndef UNUM_CONFIG_H
+#define UNUM_CONFIG_H
+
+/*
+ *  This file is auto-generated.
+ */
+
+#define UNUM_OS_UNIX         1
+// #define UNUM_OS_MACOS        0
+#define UNUM_OS_LINUX        1
+
+#define UNUM_PATH_SEP        '/'
+#define UNUM_PATH_SEP_S      "/"
+
+#define UNUM_TOOL_CXX        "/usr/bin/g++"
+#define UNUM_TOOL_LD         "/usr/bin/ld"
+#define UNUM_TOOL_ID         "8eb244cf4c2e7ec2"
+
+#define UNUM_HW_CPUS         1
+#define UNUM_HW_SMT          1
+#define UNUM_HW_CACHE_L1D    49152
+#define UNUM_HW_CACHE_L2     2097152
+#define UNUM_HW_CACHE_L3     314572800
+#define UNUM_HW_CACHE_LINE   64
+#define UNUM_HW_NUMA_NODES   1
+
+#define UNUM_HAVE_MARCH_NATIVE     1
+#define UNUM_HAVE_TARGET_SSE42     1
+#define UNUM_HAVE_TARGET_AVX2      1
+#define UNUM_HAVE_TARGET_AVX512    1
+#define UNUM_HAVE_LTO              1
+#define UNUM_HAVE_LTO_PARTITION    1
+// #define UNUM_HAVE_LTO_INCREMENTAL  0
+// #define UNUM_HAVE_LTO_THIN         0
+#define UNUM_HAVE_PCH              1
+#define UNUM_HAVE_FILE_PREFIX_MAP  1
+#define UNUM_HAVE_NO_GNU_UNIQUE    1
+// #define UNUM_HAVE_LD_MOLD          0
+// #define UNUM_HAVE_LD_LLD           0
+#define UNUM_HAVE_LD_GOLD          1
+#define UNUM_HAVE_MODULES_TS       1
+#define UNUM_HAVE_PGO              1
+// #define UNUM_HAVE_PGO_INSTR        0
+// #define UNUM_HAVE_TIME_TRACE       0
+#define UNUM_HAVE_BUILTIN_EXPECT   1
+#define UNUM_HAVE_LIKELY           1
+
+#endif /* UNUM_CONFIG_H */
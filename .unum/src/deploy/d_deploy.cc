@@ -6,31 +6,217 @@
 | -------------------------------------------------------------------*/
 
 #include <cctype>
+#include <cerrno>
+#include <climits>
 #include <cstdarg>
 #include <cstdlib>
 #include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "u_common.h"
+#include "u_hash.h"
+#include "u_lex.h"
+#include "u_paths.h"
+#include "u_sysinfo.h"
 #include "d_deploy.h"
+#include "d_graph.h"
+#include "d_journal.h"
+#include "d_profile.h"
+#include "d_scan.h"
+#include "d_scratch.h"
+#include "d_snap.h"
+#include "d_store.h"
+
+
+// - clang's instrumented profiles where gcc's flavor isn't available
+#define PGO_INSTR     (!UNUM_HAVE_PGO && UNUM_HAVE_PGO_INSTR)
+
+
+// - configurations that may be deployed side by side with --variants
+static const struct { const char *name;
+                      const char *cflags;
+                      const char *lflags; } variant_defs[] = {
+	{ "kernel",  "", "" },
+	{ "release", " -O2 -DNDEBUG", "" },
+	{ "debug",   " -O0 -g", "" },
+	{ "asan",    " -O1 -g -fsanitize=address -fno-omit-frame-pointer",
+	             " -fsanitize=address" },
+	{ "ubsan",   " -O1 -g -fsanitize=undefined", " -fsanitize=undefined" },
+};
+
+
+struct un::deploy_monitor_s {
+	un::journal_t *jn;
+	un::hash_t    man;          // - the manifest the watches were made from
+	bool          is_new;
+};
+
 
 class deployment {
 	public:
 	
 	deployment() {
-		heap_allocs = nullptr;
-		num_alloc   = 0;
-		max_alloc   = 0;
+		heap_allocs  = nullptr;
+		num_alloc    = 0;
+		max_alloc    = 0;
+		cache_dir    = nullptr;
+		cache_budget = CACHE_BUDGET;
+		scratch_cap  = SCRATCH_CAP;
+		scratch_dir  = nullptr;
+		scratch_used = 0;
+		scan         = nullptr;
+		has_headers  = false;
+		all_headers  = { 0, 0 };
+		std::memset(&graph, 0, sizeof(graph));
+		build_lock   = -1;
+		queue_lock   = -1;
+		interfaces   = nullptr;
+		pgo_mode     = PGO_NONE;
+		variants     = nullptr;
+		snap         = nullptr;
+		live_files   = nullptr;
+		std::memset(&lto_stats, 0, sizeof(lto_stats));
+		std::memset(&opts, 0, sizeof(opts));
 	}
 	
-	bool deploy( char *error, size_t len ) {
-		cstrarr_t inc_dirs, src_files;
+	
+	/*
+	 *  Concurrent deployments are coalesced.  One builds while at most one 
+	 *  more waits to follow it, and any arriving after that share the 
+	 *  follower's result, so overlapping requests never cost more than two 
+	 *  builds.  The follower is necessary because the running build may 
+	 *  have read its inputs before the edits that prompted the others.  A
+	 *  request with different options than the follower's can't use its 
+	 *  result and builds after it instead.
+	 */
+	bool deploy( char *error, size_t len, bool *is_changed,
+	             const un::deploy_opts_t *options ) {
+		const char *result, *sig;
+		bool       ret;
+		
+		if (options) {
+			opts = *options;
+		}
 		
 		try {
+			// - the deploy that started the workload holds the lock it
+			//   would wait on forever.
+			if (std::getenv(TRAINING_ENV)) {
+				throw uabort("a pgo training workload can't deploy");
+			}
+			
 			set_root();
+			build_lock = open_lock(un::BP_DEPLOY_LOCK);
+			queue_lock = open_lock(un::BP_DEPLOY_QUEUE);
+			result     = path_to(un::BP_DEPLOY_RESULT);
+			sig        = request_sig();
+			
+			if (flock(build_lock, LOCK_EX | LOCK_NB) != 0) {
+				if (flock(queue_lock, LOCK_EX | LOCK_NB) != 0) {
+					// - the follower starts later than this request, so its
+					//   result is as good as building again.
+					lock(queue_lock, LOCK_SH);
+					lock(queue_lock, LOCK_UN);
+					lock(build_lock, LOCK_SH);
+					if (is_shared(result, sig)) {
+						return read_result(result, error, len, is_changed);
+					}
+					lock(build_lock, LOCK_UN);
+				}
+				
+				lock(build_lock, LOCK_EX);
+				lock(queue_lock, LOCK_UN);
+			}
+			
+		} catch (uabort &err) {
+			std::strncpy(error, err.msg, len);
+			return false;
+		}
+		
+		// - a result is only left by a build that wasn't interrupted
+		unlink(result);
+		ret = build(error, len, is_changed);
+		write_result(result, sig, ret, error, *is_changed);
+		return ret;
+	}
+	
+	
+	bool build( char *error, size_t len, bool *is_changed ) {
+		cstrarr_t          inc_dirs, src_files;
+		variant_t          *vars;
+		int                num_vars;
+		const char         *sig;
+		un::journal_mark_t mark;
+		
+		// - a failed build leaves the kernel as it was
+		*is_changed = false;
+		
+		try {
+		#if !UNUM_HAVE_TIME_TRACE
+			if (opts.is_profile) {
+				throw uabort("the compiler doesn't support -ftime-trace");
+			}
+		#endif
+		#if !UNUM_HAVE_PGO && !UNUM_HAVE_PGO_INSTR
+			if (opts.pgo_cmd) {
+				throw uabort("the compiler doesn't support profile feedback");
+			}
+		#endif
+		#if !UNUM_HAVE_LTO
+			if (opts.is_lto) {
+				throw uabort("the compiler doesn't support link-time "
+				             "optimization");
+			}
+		#endif
+			
+			vars = make_variants(&num_vars);
+			sig  = deploy_sig(vars, num_vars);
+			if (is_unchanged(vars, num_vars, sig)) {
+				*is_changed = false;
+				return true;
+			}
+			
+			// - the mark is taken before any input is read, so whatever
+			//   changes during the deploy is seen by the next one.
+			unlink(path_to(un::BP_JOURNAL_MARK));
+			if (!un::journal_mark(path_to(un::BP_JOURNAL), &mark)) {
+				std::memset(&mark, 0, sizeof(mark));
+				snap = deployment().snapshot();
+			}
+			
 			read_manifest(&inc_dirs, &src_files);
-			run_cc(UNUM_RUNTIME_BIN, inc_dirs, src_files);
+			if (opts.pgo_cmd) {
+				prepare_profile(inc_dirs, src_files);
+			}
+			
+			double start = now_secs();
+			compile(inc_dirs, src_files, vars, num_vars);
+			lto_stats.compile_secs = now_secs() - start;
+			
+			// - early cutoff, identical objects can only produce the same
+			//   kernel so it and everything after it are left alone.
+			*is_changed = false;
+			for (int v = 0; v < num_vars; v++) {
+				if (!is_linked(&vars[v])) {
+					run_link(&vars[v]);
+					*is_changed = true;
+				}
+				write_link(&vars[v]);
+			}
+			deploy_live(inc_dirs);
+			
+			if (opts.is_lto && opts.lto) {
+				*opts.lto = lto_stats;
+			}
+			write_stamp();
+			save_graph(all_sources(src_files));
+			write_mark(&mark, sig);
 			
 		} catch (uabort &err) {
 			std::strncpy(error, err.msg, len);
@@ -52,11 +238,27 @@ class deployment {
 		try {
 			set_root();
 			read_manifest(&inc_dirs, &src_files);
+			src_files = all_sources(src_files);
 
+			// - the link record is refreshed by every deploy, even those that
+			//   don't replace the kernel.
 			int ret = 0;
-			time_t bin_mod = file_info(UNUM_RUNTIME_BIN).st_mtime;
+			time_t bin_mod = file_info(path_to(un::BP_RUNTIME_BIN)).st_mtime;
+			time_t dep_mod = file_info(path_to(un::BP_LINK_KEY)).st_mtime;
+			bin_mod        = dep_mod > bin_mod ? dep_mod : bin_mod;
+			if (un::graph_load(path_to(un::BP_DEPS_GRAPH), &graph)) {
+				return graph_status(src_files);
+			}
+			
 			for (cstrarr_t cur = src_files; *cur; cur++) {
-				if (file_info(*cur).st_mtime > bin_mod) {
+				un::scan_t *deps   = scanner(inc_dirs);
+				un::hash_t headers;
+				time_t     src_mod = file_info(*cur).st_mtime, inc_mod;
+				
+				// - a source is also out of date when a header it reaches is
+				un::scan_digest(deps, un::scan_file(deps, *cur), &headers,
+				                &inc_mod);
+				if (src_mod > bin_mod || inc_mod > bin_mod) {
 					ret++;
 				}
 			}
@@ -70,7 +272,114 @@ class deployment {
 	}
 
 
+	/*
+	 *  The monitor runs until it is killed, at which point its lock on the
+	 *  journal is released and readers stop trusting it.  The manifest is
+	 *  hashed after every batch of events so that directories it newly 
+	 *  names are watched, in a new generation because marks taken before 
+	 *  they were can't have seen their changes.
+	 */
+	un::deploy_monitor_t *monitor_open( char *error, size_t len ) {
+		un::deploy_monitor_t *mon = nullptr;
+		
+		try {
+			set_root();
+			mon = (un::deploy_monitor_t *) std::calloc(1, sizeof(*mon));
+			if (!mon) {
+				throw uabort("out of memory");
+			}
+			
+			if (!(mon->jn = un::journal_start(path_to(un::BP_JOURNAL)))) {
+				throw uabort("the journal is in use or file events are "
+				             "unavailable");
+			}
+			mon->is_new = true;
+			return mon;
+			
+		} catch (uabort &err) {
+			std::strncpy(error, err.msg, len);
+		}
+		
+		std::free(mon);
+		return nullptr;
+	}
+	
+	
+	// - the watches follow the manifest, starting a new generation when
+	//   they change because what was missed in between is unknown
+	bool monitor_update( un::deploy_monitor_t *mon, int timeout_ms,
+	                     char *error, size_t len ) {
+		un::hash_t cur;
+		
+		try {
+			set_root();
+			if (!un::hash_file(path_to(un::BP_MANIFEST), &cur)) {
+				throw uabort("failed to read manifest");
+			}
+			
+			if (mon->is_new || !un::hash_equal(cur, mon->man)) {
+				deployment().watch(mon->jn);
+				if (!mon->is_new && !un::journal_rotate(mon->jn)) {
+					throw uabort("failed to start a new journal");
+				}
+				mon->man    = cur;
+				mon->is_new = false;
+			}
+			
+			if (un::journal_wait(mon->jn, timeout_ms) < 0) {
+				throw uabort("failed to read file events");
+			}
+			return true;
+			
+		} catch (uabort &err) {
+			std::strncpy(error, err.msg, len);
+		}
+		
+		return false;
+	}
+	
+	
+	bool monitor( char *error, size_t len ) {
+		un::deploy_monitor_t *mon = monitor_open(error, len);
+		
+		while (mon && monitor_update(mon, -1, error, len)) {
+		}
+		
+		un::deploy_monitor_close(mon);
+		return false;
+	}
+
+
+	bool cache( char *dir, size_t len, long long *budget ) {
+		cstrarr_t inc_dirs, src_files;
+		
+		try {
+			set_root();
+			read_manifest(&inc_dirs, &src_files);
+			if (!cache_dir) {
+				return false;
+			}
+			
+			std::strncpy(dir, cache_dir, len);
+			*budget = cache_budget;
+			return true;
+			
+		} catch (...) {
+			return false;
+		}
+	}
+
+
 	~deployment() {
+		if (build_lock >= 0) {
+			close(build_lock);
+		}
+		if (queue_lock >= 0) {
+			close(queue_lock);
+		}
+		un::scan_close(scan);
+		un::graph_close(&graph);
+		un::snap_close(snap);
 		for (int i = 0; i < num_alloc; i++) {
 			::free(heap_allocs[i]);
 		}
@@ -96,26 +405,217 @@ class deployment {
 	
 	
 	void set_root( void ) {
-		if (chdir(UNUM_DIR_ROOT) != 0) {
+		if (chdir(path_to(un::BP_ROOT)) != 0) {
 			throw uabort("failed to set root directory");
 		}
 	}
 	
 	
+	const char *path_to( un::basis_path_e which ) {
+		const char *ret = un::basis_path(which);
+		if (!ret) {
+			throw uabort("failed to locate the repository");
+		}
+		return ret;
+	}
+	
+	
+	// - allows uboot to trust this kernel with redeployment when its
+	//   toolchain hasn't changed.
+	void write_stamp( void ) {
+		FILE *fp = std::fopen(path_to(un::BP_TOOL_STAMP), "w");
+		
+		if (!fp || std::fprintf(fp, "%s\n", UNUM_TOOL_ID) < 0) {
+			if (fp) {
+				std::fclose(fp);
+			}
+			throw uabort("failed to write kernel stamp");
+		}
+		std::fclose(fp);
+	}
+	
+	
 	const static char *MAN_SEC_CORE;
 	const static char *MAN_SEC_KERNEL;
 	const static char *MAN_SEC_BUILD;
 	const static char *MAN_SEC_INC;
+	const static char *MAN_SEC_MODULES;
+	const static char *MAN_SEC_LIVE;
+	const static char *MODULE_FLAGS;
+	const static char *LIVE_FLAGS;
+	const static char *LIVE_LINK_FLAGS;
+	const static char *MAN_KEY_CACHE;
+	const static char *MAN_KEY_CACHE_SIZE;
+	const static char *MAN_KEY_SCRATCH_SIZE;
+	const static char *TRAINING_ENV;
+	const static char *PROFDATA;
+	const static long long CACHE_BUDGET = 1024LL * 1024 * 1024;
+	const static long long SCRATCH_CAP  = 512LL * 1024 * 1024;
+	const static int       PGO_MIN_COVERAGE = 80;
+	
+	enum { PGO_NONE = 0, PGO_TRAIN, PGO_USE };
+	
+	// - the shared artifact store is opt-in with 'build: cache: <dir>'
+	const char *cache_dir;
+	long long  cache_budget;
+	
+	// - RAM scratch is used up to 'build: scratch-size: <bytes>', 0 disables
+	long long  scratch_cap;
+	const char *scratch_dir;        // - while units are compiled into it
+	long long  scratch_used;
+	
+	// - sources declared as module interfaces in 'build: modules:'
+	cstrarr_t  interfaces;
+	
+	// - sources deployed as shared objects of their own under 'live:'
+	cstrarr_t  live_files;
+	
+	// - include dependencies, with every header as the fallback for sources
+	//   whose includes can't be determined
+	un::scan_t *scan;
+	un::hash_t all_headers;
+	bool       has_headers;
+	
+	// - the dependencies of the last deployment, saved for status
+	un::graph_t graph;
+	
+	// - the tracked directories before this deployment read them, saved
+	//   when no monitor is journaling their changes
+	un::snap_t  *snap;
+	
+	un::deploy_opts_t opts;
+	
+	/*
+	 *  Variants are configurations of the kernel deployed together, sharing
+	 *  the manifest, the include scans and a single scheduler that keeps 
+	 *  every core busy with the units of all of them.  Each has its own 
+	 *  objects and binary under the variants directory, apart from the
+	 *  unnamed kernel itself.
+	 */
+	typedef struct {
+		const char *name;
+		const char *cflags;
+		const char *lflags;
+		const char *bin_file;
+		const char *link_file;
+		char       *flags;
+		cstrarr_t  obj_files;
+		un::hash_t link_key;
+	} variant_t;
+	
+	// - the configurations being compiled
+	variant_t  *variants;
+	
+	// - the feedback profile stage of the objects being compiled
+	int        pgo_mode;
+	
+	// - the phases of the last link-time optimized deploy
+	un::deploy_lto_t lto_stats;
+	
+	// - serialize deployments, released when the descriptors are closed
+	int        build_lock;
+	int        queue_lock;
+	
+	
+	int open_lock( un::basis_path_e which ) {
+		const char *path = path_to(which);
+		int        fd;
+		
+		make_dirs(path);
+		if ((fd = open(path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR)) < 0) {
+			throw uabort("failed to open %s", path);
+		}
+		return fd;
+	}
+	
+	
+	void lock( int fd, int op ) {
+		while (flock(fd, op) != 0) {
+			if (errno != EINTR) {
+				throw uabort("failed to lock deployment");
+			}
+		}
+	}
+	
+	
+	/*
+	 *  <sample-deploy-result>
+	 *
+	 *  3f0c...9a1e                 - the options it was requested with
+	 *  ok 1                        - succeeded, the kernel was replaced
+	 *  failed                      - or failed with the message that follows
+	 *  failed to compile main.cc
+	 *
+	 */
+	void write_result( const char *path, const char *sig, bool is_ok,
+	                   const char *error, bool is_changed ) {
+		FILE *fp = std::fopen(path, "w");
+		
+		if (!fp) {
+			return;
+		}
+		std::fprintf(fp, "%s\n", sig);
+		if (is_ok) {
+			std::fprintf(fp, "ok %d\n", is_changed ? 1 : 0);
+		} else {
+			std::fprintf(fp, "failed\n%s\n", error);
+		}
+		std::fclose(fp);
+	}
+	
+	
+	bool read_result( const char *path, char *error, size_t len,
+	                  bool *is_changed ) {
+		FILE *fp = std::fopen(path, "r");
+		char buf[512];
+		int  changed = 0;
+		bool ret     = false;
+		
+		if (!fp) {
+			std::strncpy(error, "concurrent deployment was interrupted", len);
+			return false;
+		}
+		
+		if (std::fscanf(fp, "%*s ok %d", &changed) == 1) {
+			*is_changed = changed != 0;
+			ret         = true;
+		} else if (std::fgets(buf, sizeof(buf), fp) &&
+		           std::fgets(buf, sizeof(buf), fp) &&
+		           std::fgets(buf, sizeof(buf), fp)) {
+			std::strncpy(error, trim_ws(buf), len);
+		} else {
+			std::strncpy(error, "concurrent deployment failed", len);
+		}
+		
+		std::fclose(fp);
+		return ret;
+	}
+	
+	
+	// - a result is only shared with requests for the same deployment
+	bool is_shared( const char *path, const char *sig ) {
+		FILE *fp = std::fopen(path, "r");
+		char buf[UNUM_HASH_HEX_LEN];
+		bool ret;
+		
+		if (!fp) {
+			return false;
+		}
+		ret = std::fscanf(fp, "%32s", buf) == 1 && !std::strcmp(buf, sig);
+		std::fclose(fp);
+		return ret;
+	}
 	
 	
 	void read_manifest( cstrarr_t *inc_dirs, cstrarr_t *src_files ) {
-		FILE        *fp;
+		FILE        *fp = nullptr;
 	
 		*inc_dirs  = NULL;
 		*src_files = NULL;
+		live_files = NULL;
 	
 		try {
-			fp = std::fopen(UNUM_MANIFEST, "r");
+			fp = std::fopen(path_to(un::BP_MANIFEST), "r");
 			if (!fp) {
 				throw uabort("failed to read manifest");
 			}
@@ -127,6 +627,9 @@ class deployment {
 			read_manifest_from(fp, MAN_SEC_CORE, inc_dirs, src_files);
 			std::fseek(fp, 0L, SEEK_SET);
 			read_manifest_from(fp, MAN_SEC_KERNEL, inc_dirs, src_files);
+			std::fseek(fp, 0L, SEEK_SET);
+			read_manifest_from(fp, MAN_SEC_LIVE, inc_dirs, &live_files);
+			std::fclose(fp);
 
 		} catch (...) {
 			if (fp) {
@@ -142,44 +645,53 @@ class deployment {
 		char        buf[8192];
 		char        *bp;
 		int         is_core = 0, is_kern = 0, is_build = 0, is_inc = 0;
-		int 		do_core = 0, do_kern = 0, do_inc = 0;
+		int         is_mod  = 0, is_live = 0;
+		int 		do_core = 0, do_kern = 0, do_inc = 0, do_live = 0;
 		int         line = 0;
 		struct stat s;
 		
 		do_core = !str2cmp(section, MAN_SEC_CORE);
 		do_kern = !str2cmp(section, MAN_SEC_KERNEL);
 		do_inc  = !str2cmp(section, MAN_SEC_INC);
+		do_live = !str2cmp(section, MAN_SEC_LIVE);
 
 		while (fp && !std::feof(fp) && std::fgets(buf, sizeof(buf), fp)) {
 			line++;
 		
 			if (!str2cmp(buf, MAN_SEC_CORE)) {
 				is_core  = 1;
-				is_kern  = is_build = is_inc = 0;
+				is_kern  = is_build = is_inc = is_mod = is_live = 0;
 				continue;
 
 			}
 			else if (!str2cmp(buf, MAN_SEC_KERNEL)) {
 				is_kern  = 1;
-				is_core  = is_build = is_inc = 0;
+				is_core  = is_build = is_inc = is_mod = is_live = 0;
 				continue;
 								
 			} else if (!str2cmp(buf, MAN_SEC_BUILD)) {
 				is_build = 1;
-				is_core  = is_kern = is_inc = 0;
+				is_core  = is_kern = is_inc = is_mod = is_live = 0;
+				continue;
+			
+			} else if (!str2cmp(buf, MAN_SEC_LIVE)) {
+				is_live  = 1;
+				is_core  = is_kern = is_build = is_inc = is_mod = 0;
 				continue;
 			
-			} else if ((is_core || is_build) && !std::isspace(*buf)) {
-				is_core = is_kern = is_build = is_inc = 0;
+			} else if ((is_core || is_build || is_live) &&
+			           !std::isspace(*buf)) {
+				is_core = is_kern = is_build = is_inc = is_mod = is_live = 0;
 				continue;
 			
-			} else if (!is_core && !is_build && !is_kern) {
+			} else if (!is_core && !is_build && !is_kern && !is_live) {
 				continue;
 			}
 		
 			for (bp = buf; *bp && std::isspace(*bp); bp++) {}
 		
-			if ((is_core && do_core) || (is_kern && do_kern)) {
+			if ((is_core && do_core) || (is_kern && do_kern) ||
+			    (is_live && do_live)) {
 				if (*bp == '-' && std::isspace(*(bp+1)) &&
 				    !std::isspace(*bp+2)) {
 					bp += 2;
@@ -194,6 +706,25 @@ class deployment {
 				}
 
 			} else if (is_build && do_inc) {
+				if (is_mod) {
+					if (*bp == '-' && std::isspace(*(bp + 1)) &&
+					    !std::isspace(*bp+2)) {
+						bp += 2;
+						
+						if (!trim_ws(bp) || !*bp ||
+						    !(file_info(bp).st_mode & S_IFREG)) {
+							throw uabort("invalid manifest module %s, line %d",
+							             bp, line);
+						}
+						
+						interfaces = arr_add(interfaces, bp);
+						continue;
+						
+					} else if (*bp && !std::isspace(*bp)) {
+						is_mod = 0;
+					}
+				}
+				
 				if (is_inc) {
 					if (*bp == '-' && std::isspace(*(bp + 1)) &&
 					    !std::isspace(*bp+2)) {
@@ -205,15 +736,32 @@ class deployment {
 						}
 					
 						*inc_dirs = arr_add(*inc_dirs, bp);
+						continue;
 					
 					} else if (*bp && !std::isspace(*bp)) {
 						is_inc = 0;
 					}
-			
-				} else {
-					if (!str2cmp(bp, MAN_SEC_INC)) {
-						is_inc = 1;
-					}
+				}
+				
+				if (!str2cmp(bp, MAN_SEC_INC)) {
+					is_inc = 1;
+					
+				} else if (!str2cmp(bp, MAN_SEC_MODULES)) {
+					is_mod = 1;
+					
+				} else if (!str2cmp(bp, MAN_KEY_CACHE)) {
+					cache_dir = read_cache_dir(bp + std::strlen(MAN_KEY_CACHE),
+					                           line);
+					
+				} else if (!str2cmp(bp, MAN_KEY_CACHE_SIZE)) {
+					cache_budget = read_size(bp +
+					                         std::strlen(MAN_KEY_CACHE_SIZE),
+					                         line);
+					
+				} else if (!str2cmp(bp, MAN_KEY_SCRATCH_SIZE)) {
+					scratch_cap = read_size(bp +
+					                        std::strlen(MAN_KEY_SCRATCH_SIZE),
+					                        line);
 				}
 			}
 		}
@@ -224,12 +772,61 @@ class deployment {
 	}
 	
 	
+	// ...a leading '~' refers to the user's home directory
+	const char *read_cache_dir( char *value, int line ) {
+		const char *home = std::getenv("HOME");
+		char       *ret  = nullptr;
+		
+		for (; *value && std::isspace(*value); value++) {}
+		if (!trim_ws(value) || !*value) {
+			throw uabort("invalid manifest cache, line %d", line);
+		}
+		
+		if (value[0] == '~' && (!value[1] || value[1] == '/') && home) {
+			ret = rstrcat(ret, home);
+			value++;
+		}
+		
+		return rstrcat(ret, value);
+	}
+	
+	
+	// ...sizes are in bytes, with an optional K, M or G suffix
+	long long read_size( char *value, int line ) {
+		char      *end;
+		long long ret = std::strtoll(value, &end, 10);
+		
+		switch (std::toupper(*end)) {
+		case 'G':
+			ret *= 1024;
+		case 'M':
+			ret *= 1024;
+		case 'K':
+			ret *= 1024;
+			end++;
+			break;
+		}
+		
+		for (; *end && std::isspace(*end); end++) {}
+		if (ret < 0 || *end) {
+			throw uabort("invalid manifest size, line %d", line);
+		}
+		
+		return ret;
+	}
+	
+	
 	// ...compare the prefix of s1 precisely to s2
 	inline int str2cmp(const char *s1, const char *s2) {
 		return strncmp(s1, s2, s2 ? strlen(s2) : 0);
 	}
 
 				
+	long long file_bytes( const char *path ) {
+		return (long long) file_info(path).st_blocks * 512;
+	}
+	
+	
 	struct stat file_info( const char *path ) {
 		struct stat sinfo;
 
@@ -273,46 +870,1861 @@ class deployment {
 	}
 	
 		
-	void run_cc( const char *bin_file, cstrarr_t inc_dirs,
-	            cstrarr_t src_files ) {
-		char *cmd = NULL;
+	/*
+	 *  Each source is compiled to its own object under the build directory,
+	 *  identified by a key over everything that can affect its output: the
+	 *  toolchain, the flags, its content and that of the headers it 
+	 *  includes.  An object whose key is unchanged is reused and
+	 *  a missing one may be found in the shared store before compiling.
+	 *  Units that import modules wait for the interfaces in `deps`, and those
+	 *  of a variant identical to another's take its object from `origin`.
+	 */
+	typedef struct {
+		const char *src;
+		const char *obj;
+		const char *key_file;
+		const char *cmd;
+		const char *module;
+		int        *deps;
+		int        num_deps;
+		int        variant;
+		int        origin;
+		char       key[UNUM_HASH_HEX_LEN];
+		char       obj_hash[UNUM_HASH_HEX_LEN];
+		pid_t      pid;
+		bool       is_keyed;
+		bool       is_started;
+		bool       is_done;
+		bool       is_failed;
+	} unit_t;
 	
-		cmd = rstrcat(cmd, UNUM_TOOL_CXX);
-
-		for (; inc_dirs && *inc_dirs && **inc_dirs; inc_dirs++) {
-			cmd = rstrcat(cmd, " -I");
-			cmd = rstrcat(cmd, *inc_dirs);
+	
+	variant_t *make_variants( int *num_vars ) {
+		char      *names = strdup(opts.variants ? opts.variants : "kernel");
+		variant_t *ret   = nullptr;
+		int       num    = 0;
+		
+		for (char *name = std::strtok(names, ","); name;
+		     name = std::strtok(NULL, ",")) {
+			const int num_defs = sizeof(variant_defs) / sizeof(variant_defs[0]);
+			int       def      = 0;
+			
+			for (; def < num_defs && std::strcmp(variant_defs[def].name, name);
+			     def++) {}
+			if (def == num_defs) {
+				throw uabort("'%s' is not a variant", name);
+			}
+			
+			for (int v = 0; v < num; v++) {
+				if (!std::strcmp(ret[v].name ? ret[v].name : "kernel", name)) {
+					throw uabort("variant %s is repeated", name);
+				}
+			}
+			
+			ret            = (variant_t *) realloc(ret, sizeof(variant_t) *
+			                                            (num + 1));
+			variant_t *var = &ret[num++];
+			
+			std::memset(var, 0, sizeof(*var));
+			var->cflags = variant_defs[def].cflags;
+			var->lflags = variant_defs[def].lflags;
+			if (def == 0) {
+				var->bin_file  = path_to(un::BP_RUNTIME_BIN);
+				var->link_file = path_to(un::BP_LINK_KEY);
+				continue;
+			}
+			
+			var->name      = variant_defs[def].name;
+			var->bin_file  = rstrcat(rstrcat(rstrcat(nullptr, 
+			                 path_to(un::BP_VARIANTS)), "/"), name);
+			var->link_file = rstrcat(rstrcat(nullptr, var->bin_file),
+			                         "/kernel.link");
+			var->bin_file  = rstrcat((char *) var->bin_file, "/unum");
 		}
-
-		cmd = rstrcat(cmd, " -o ");
-		cmd = rstrcat(cmd, bin_file);
-
-		for (; *src_files && *src_files; src_files++) {
-			cmd = rstrcat(cmd, " ");
-			cmd = rstrcat(cmd, *src_files);
+		
+		if (!num) {
+			throw uabort("no variants were named");
 		}
-
-		if (system(cmd) != 0) {
-			throw uabort("failed to deploy kernel");
+		
+		*num_vars = num;
+		return ret;
+	}
+	
+	
+	// ...beside the kernel's so that a unit's object path differs only by root
+	const char *variant_root( const char *root, variant_t *var ) {
+		if (!var->name) {
+			return root;
 		}
+		return rstrcat(rstrcat(rstrcat(nullptr, root), "/"), var->name);
 	}
 	
+	
+	void compile( cstrarr_t inc_dirs, cstrarr_t src_files, variant_t *vars,
+	              int num_vars ) {
+		unit_t     *units;
+		int        num_src  = 0, num_units, hits = 0, misses = 0;
+		const char *obj_root = disk_root(), *alt_root = nullptr;
+		char       scratch[PATH_MAX];
+		bool       is_ram    = false;
+		
+		// - intermediates prefer RAM, only the kernel must reach the disk,
+		//   but an object already built in the other place is used there
+		if (pgo_mode != PGO_TRAIN &&
+		    un::scratch_open(scratch, sizeof(scratch), scratch_cap)) {
+			obj_root = scratch;
+			alt_root = disk_root();
+			is_ram   = true;
 			
-	char *rstrcat( char *buf, const char *text ) {
-		const size_t len_cur = buf ? strlen(buf) : 0;
-		const size_t len_txt = strlen(text);
-
-		if (!len_txt) {
-			return buf;
+		} else if (pgo_mode != PGO_TRAIN &&
+		           un::scratch_find(scratch, sizeof(scratch))) {
+			alt_root = scratch;
 		}
-
-		buf = (char *) realloc(buf, len_cur + len_txt + 1);
-		if (!buf) {
-			throw uabort("out of memory");
+		
+		for (cstrarr_t cur = src_files; cur && *cur; cur++) {
+			num_src++;
 		}
-
-		std::strcpy(&buf[len_cur], text);
-		return buf;
+		
+		num_units = num_src * num_vars;
+		variants  = vars;
+		units     = (unit_t *) malloc(sizeof(unit_t) *
+		                              (num_units ? num_units : 1));
+		for (int v = 0; v < num_vars; v++) {
+			vars[v].flags = rstrcat(rstrcat(rstrcat(cc_flags(inc_dirs),
+			                pgo_flags()), lto_flags()), vars[v].cflags);
+			
+			for (int i = 0; i < num_src; i++) {
+				unit_t *u = &units[v * num_src + i];
+				
+				std::memset(u, 0, sizeof(*u));
+				u->src     = src_files[i];
+				u->variant = v;
+				u->origin  = -1;
+				set_paths(u, variant_root(obj_root, &vars[v]));
+				unit_key(u, vars[v].flags, inc_dirs);
+			}
+			
+		#if UNUM_HAVE_MODULES_TS
+			link_modules(units, v * num_src, num_src);
+		#endif
+		}
+		
+		// - variants compiling a unit identically share one object
+		for (int i = num_src; i < num_units; i++) {
+			for (int j = i - num_src; j >= 0; j -= num_src) {
+				if (!std::strcmp(units[i].key, units[j].key)) {
+					units[i].origin = units[j].origin >= 0 ? units[j].origin : j;
+					break;
+				}
+			}
+		}
+		
+		if (is_ram) {
+			trim_scratch(scratch, units, num_units);
+		}
+		
+		for (int i = 0; i < num_units; i++) {
+			unit_t *u = &units[i];
+			
+			// - a profile needs every unit to be compiled again
+			if (u->origin >= 0 || (!opts.is_profile && is_built(u, alt_root))) {
+				continue;
+			}
+			
+			make_dirs(u->obj);
+			unlink(u->key_file);
+			
+			if (cache_dir && !opts.is_profile && is_shared(u)) {
+				if (un::store_fetch(cache_dir, u->key, u->obj)) {
+					write_key(u);
+					hits++;
+					continue;
+				}
+				misses++;
+			}
+			
+			// - the stale object would only count against the cap
+			if (is_ram) {
+				unlink(u->obj);
+			}
+			set_cmd(u, vars[u->variant].flags);
+		}
+		
+		if (is_ram) {
+			scratch_dir  = scratch;
+			scratch_used = un::scratch_usage(scratch);
+		}
+		bool is_ok  = run_units(units, num_units);
+		scratch_dir = nullptr;
+		if (!is_ok && is_ram && un::scratch_low(obj_root)) {
+			// - RAM is exhausted, so everything unfinished is redone on disk
+			for (int i = 0; i < num_units; i++) {
+				unit_t *u = &units[i];
+				if (!u->cmd || u->is_done) {
+					continue;
+				}
+				
+				set_paths(u, variant_root(disk_root(), &vars[u->variant]));
+				make_dirs(u->obj);
+				unlink(u->key_file);
+				set_cmd(u, vars[u->variant].flags);
+				u->is_failed  = false;
+				u->is_started = false;
+			}
+			
+			is_ok = run_units(units, num_units);
+		}
+		
+		// - objects that were finished are kept even when others failed
+		if (cache_dir) {
+			for (int i = 0; i < num_units; i++) {
+				if (units[i].cmd && units[i].is_done && is_shared(&units[i])) {
+					un::store_put(cache_dir, units[i].key, units[i].obj);
+				}
+			}
+			
+			if (hits || misses) {
+				un::store_count(cache_dir, hits, misses);
+				un::store_trim(cache_dir, cache_budget);
+			}
+		}
+		
+		if (opts.is_profile) {
+			write_profile(units, num_units);
+		}
+		
+		if (!is_ok) {
+			throw uabort("failed to compile %s", failed_units(units,
+			                                                  num_units));
+		}
+		
+		for (int v = 0; v < num_vars; v++) {
+			un::hash_ctx_t ctx;
+			
+			un::hash_init(&ctx);
+			un::hash_update_s(&ctx, UNUM_TOOL_ID);
+			un::hash_update_s(&ctx, link_flags(&vars[v]));
+			for (int i = v * num_src; i < (v + 1) * num_src; i++) {
+				unit_t *u = units[i].origin >= 0 ? &units[units[i].origin] :
+				                                   &units[i];
+				vars[v].obj_files = arr_add(vars[v].obj_files, u->obj);
+				un::hash_update_s(&ctx, u->obj_hash);
+			}
+			vars[v].link_key = un::hash_final(&ctx);
+		}
+	}
+	
+	
+	// ...instrumented objects are kept apart so that they survive between
+	//   trainings without displacing those of the kernel.
+	const char *disk_root( void ) {
+		if (pgo_mode == PGO_TRAIN) {
+			return rstrcat(rstrcat(nullptr, path_to(un::BP_PGO)), "/obj");
+		}
+		return rstrcat(rstrcat(nullptr, path_to(un::BP_BUILD)), "/obj");
+	}
+	
+	
+	// ...interfaces are compiled for their BMI as much as their object and
+	//   instrumented objects name the file their counters are written to.
+	bool is_shared( unit_t *u ) {
+		return !u->module && pgo_mode != PGO_TRAIN;
+	}
+	
+	
+	void set_paths( unit_t *u, const char *root ) {
+		u->obj      = rstrcat(rstrcat(rstrcat(rstrcat(nullptr, root), "/"),
+		                      u->src), ".o");
+		u->key_file = rstrcat(rstrcat(nullptr, u->obj), ".key");
+	}
+	
+	
+	void set_cmd( unit_t *u, const char *flags ) {
+		u->cmd = rstrcat(rstrcat(rstrcat(rstrcat(rstrcat(rstrcat(nullptr,
+		                 UNUM_TOOL_CXX), prefix_map()), flags), " -o "),
+		                 u->obj), " ");
+		u->cmd = rstrcat((char *) u->cmd, u->src);
+		if (u->module || u->num_deps) {
+			u->cmd = rstrcat(rstrcat((char *) u->cmd, MODULE_FLAGS),
+			                 module_map(u->variant));
+		}
+		if (pgo_mode == PGO_USE) {
+			stage_counts(u);
+		}
+		if (opts.is_profile) {
+			u->cmd = rstrcat((char *) u->cmd, " -ftime-trace");
+		}
+	}
+	
+	
+	// - the compiler names its trace after the object, in the same directory
+	void write_profile( unit_t *units, int num_units ) {
+		const char *report = path_to(un::BP_COMPILE_COST);
+		un::prof_t *prof   = un::prof_open();
+		
+		if (!prof) {
+			throw uabort("out of memory");
+		}
+		
+		for (int i = 0; i < num_units; i++) {
+			char *trace = strdup(units[i].obj), *ext;
+			
+			if (!units[i].is_done) {
+				continue;
+			}
+			
+			if ((ext = std::strrchr(trace, '.'))) {
+				*ext = '\0';
+			}
+			trace = rstrcat(trace, ".json");
+			un::prof_add_trace(prof, trace, units[i].src);
+			unlink(trace);
+		}
+		
+		if (!un::prof_write(prof, report)) {
+			un::prof_close(prof);
+			throw uabort("failed to write %s", report);
+		}
+		un::prof_close(prof);
+	}
+	
+	
+	// - the compiler has already explained each failure
+	const char *failed_units( unit_t *units, int num_units ) {
+		char *ret = nullptr;
+		
+		for (int i = 0; i < num_units; i++) {
+			const char *name = variants[units[i].variant].name;
+			
+			if (!units[i].is_failed) {
+				continue;
+			}
+			
+			ret = rstrcat(ret ? rstrcat(ret, ", ") : ret, units[i].src);
+			if (name) {
+				ret = rstrcat(rstrcat(rstrcat(ret, " ("), name), ")");
+			}
+		}
+		return ret ? ret : "kernel";
+	}
+	
+	
+	/*
+	 *  A profile-guided kernel is optimized with the counters gathered from
+	 *  an instrumented one running the training command, which finds it
+	 *  first on the PATH.  The counters are kept under the pgo directory
+	 *  with the inputs of each unit they were gathered from, and are reused
+	 *  until fewer than PGO_MIN_COVERAGE percent of the units still match.
+	 *  Units that have changed since are built with whatever of their
+	 *  profile applies.  With gcc the counters are kept per unit, with
+	 *  clang the raw profiles of the training are merged into one.
+	 */
+	void prepare_profile( cstrarr_t inc_dirs, cstrarr_t src_files ) {
+		un::deploy_pgo_t report;
+		
+		std::memset(&report, 0, sizeof(report));
+		profile_coverage(inc_dirs, src_files, &report);
+		if (report.num_covered * 100 < report.num_units * PGO_MIN_COVERAGE) {
+			train_profile(inc_dirs, src_files);
+			report.is_trained = true;
+		}
+		
+		if (opts.pgo) {
+			*opts.pgo = report;
+		}
+		pgo_mode = PGO_USE;
+	}
+	
+	
+	/*
+	 *  <sample-profile-keys>
+	 *
+	 *  6f0c1d2e3a4b5c6d7e8f90a1b2c3d4e5 .unum/src/u_hash.cc
+	 *  0a1b2c3d4e5f60718293a4b5c6d7e8f9 .unum/src/u_lz.cc
+	 *
+	 */
+	void profile_coverage( cstrarr_t inc_dirs, cstrarr_t src_files,
+	                       un::deploy_pgo_t *report ) {
+		size_t len;
+		char   *keys = un::lex_read_file(profile_keys(), &len);
+		
+		for (cstrarr_t cur = src_files; cur && *cur; cur++) {
+			char hex[UNUM_HASH_HEX_LEN];
+			
+			report->num_units++;
+			if (!keys) {
+				continue;
+			}
+			
+			un::hash_hex(unit_inputs(*cur, inc_dirs), hex);
+			if (std::strstr(keys, rstrcat(rstrcat(rstrcat(rstrcat(nullptr,
+			                hex), " "), *cur), "\n"))) {
+				report->num_covered++;
+			}
+		}
+		
+		std::free(keys);
+	}
+	
+	
+	void train_profile( cstrarr_t inc_dirs, cstrarr_t src_files ) {
+		const char *bin  = rstrcat(rstrcat(nullptr, path_to(un::BP_PGO)),
+		                           "/bin/unum");
+		const char *keys = profile_keys();
+		cstrarr_t  obj_files;
+		variant_t  var;
+		FILE       *fp;
+		
+		std::memset(&var, 0, sizeof(var));
+		var.cflags   = "";
+		var.lflags   = "";
+		var.bin_file = bin;
+		pgo_mode     = PGO_TRAIN;
+		compile(inc_dirs, src_files, &var, 1);
+		run_link(&var);
+		obj_files    = var.obj_files;
+		
+		// - the counters of earlier runs would otherwise be accumulated
+		unlink(keys);
+	#if PGO_INSTR
+		(void) obj_files;
+		clear_raw_profiles();
+		run_training(bin);
+		merge_profile();
+	#else
+		for (cstrarr_t cur = obj_files; cur && *cur; cur++) {
+			unlink(counts_path(*cur));
+		}
+		
+		run_training(bin);
+		
+		for (int i = 0; src_files && src_files[i]; i++) {
+			const char *profile = profile_path(src_files[i]);
+			
+			unlink(profile);
+			make_dirs(profile);
+			copy_file(counts_path(obj_files[i]), profile);
+		}
+	#endif
+		
+		if (!(fp = std::fopen(keys, "w"))) {
+			throw uabort("failed to write %s", keys);
+		}
+		
+		for (cstrarr_t cur = src_files; cur && *cur; cur++) {
+			char hex[UNUM_HASH_HEX_LEN];
+			un::hash_hex(unit_inputs(*cur, inc_dirs), hex);
+			std::fprintf(fp, "%s %s\n", hex, *cur);
+		}
+		
+		if (std::fclose(fp) != 0) {
+			unlink(keys);
+			throw uabort("failed to write %s", keys);
+		}
+	}
+	
+	
+	/*
+	 *  The workload must not deploy, since this process holds the deploy
+	 *  lock until it ends, so a deploy inside it fails instead.  It also
+	 *  runs its commands itself rather than forwarding them to a resident
+	 *  service, where they wouldn't be counted.
+	 */
+	void run_training( const char *bin ) {
+		const char *path = std::getenv("PATH");
+		char       *dir  = strdup(bin);
+		pid_t      pid;
+		int        status;
+		
+		*std::strrchr(dir, '/') = '\0';
+		if ((pid = fork()) == 0) {
+			setenv("PATH", path ? rstrcat(rstrcat(dir, ":"), path) : dir, 1);
+			setenv(TRAINING_ENV, "1", 1);
+			setenv("UNUM_LOCAL", "1", 1);
+		#if PGO_INSTR
+			setenv("LLVM_PROFILE_FILE", rstrcat(raw_profiles(),
+			       "/unum-%p.profraw"), 1);
+		#endif
+			execl("/bin/sh", "sh", "-c", opts.pgo_cmd, (char *) NULL);
+			_exit(127);
+		}
+		
+		while (pid > 0 && waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+		if (pid < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			throw uabort("failed to train the profile with '%s'", opts.pgo_cmd);
+		}
+	}
+	
+	
+	// ...counters missing from the profile leave the unit unoptimized
+	void stage_counts( unit_t *u ) {
+	#if PGO_INSTR
+		(void) u;
+	#else
+		const char *counts = counts_path(u->obj);
+		
+		unlink(counts);
+		copy_file(profile_path(u->src), counts);
+	#endif
+	}
+	
+	
+	const char *pgo_flags( void ) {
+		switch (pgo_mode) {
+		case PGO_TRAIN:
+		#if PGO_INSTR
+			return " -O2 -fprofile-instr-generate";
+		#else
+			return " -O2 -fprofile-generate -fprofile-update=atomic";
+		#endif
+			
+		case PGO_USE:
+		#if PGO_INSTR
+			return rstrcat(rstrcat(rstrcat(nullptr, " -O2 -fprofile-instr-use="),
+			               profile_path(nullptr)), " -Wno-profile-instr-unprofiled"
+			               " -Wno-profile-instr-out-of-date");
+		#else
+			return " -O2 -fprofile-use -fprofile-partial-training "
+			       "-Wno-missing-profile -Wno-coverage-mismatch";
+		#endif
+		}
+		return "";
+	}
+	
+	
+	// ...the compiler names counters after the object, in the same directory
+	const char *counts_path( const char *obj ) {
+		char *ret = strdup(obj);
+		char *ext = std::strrchr(ret, '.');
+		
+		if (ext) {
+			*ext = '\0';
+		}
+		return rstrcat(ret, ".gcda");
+	}
+	
+	
+	// ...clang's profile is shared by every unit
+	const char *profile_path( const char *src ) {
+	#if PGO_INSTR
+		(void) src;
+		return rstrcat(rstrcat(nullptr, path_to(un::BP_PGO)), "/unum.profdata");
+	#else
+		return rstrcat(rstrcat(rstrcat(rstrcat(nullptr, path_to(un::BP_PGO)),
+		               "/"), src), ".gcda");
+	#endif
+	}
+	
+	
+	char *raw_profiles( void ) {
+		return rstrcat(rstrcat(nullptr, path_to(un::BP_PGO)), "/raw");
+	}
+	
+	
+	void clear_raw_profiles( void ) {
+		const char    *dir = raw_profiles();
+		DIR           *dirp;
+		struct dirent *de;
+		
+		if (!(dirp = opendir(dir))) {
+			return;
+		}
+		while ((de = readdir(dirp))) {
+			if (de->d_name[0] != '.') {
+				unlink(rstrcat(rstrcat(rstrcat(nullptr, dir), "/"), de->d_name));
+			}
+		}
+		closedir(dirp);
+	}
+	
+	
+	void merge_profile( void ) {
+		const char *profile = profile_path(nullptr);
+		char       *cmd     = nullptr;
+		
+		unlink(profile);
+		cmd = rstrcat(rstrcat(cmd, PROFDATA), " merge -o ");
+		cmd = rstrcat(rstrcat(rstrcat(cmd, profile), " "), raw_profiles());
+		cmd = rstrcat(cmd, "/*.profraw");
+		if (system(cmd) != 0) {
+			unlink(profile);
+			throw uabort("failed to merge the profile with llvm-profdata");
+		}
+	}
+	
+	
+	const char *profile_keys( void ) {
+		return rstrcat(rstrcat(nullptr, path_to(un::BP_PGO)), "/profile.keys");
+	}
+	
+	
+	// ...a missing source is not an error
+	void copy_file( const char *from, const char *to ) {
+		size_t len;
+		char   *data = un::lex_read_file(from, &len);
+		FILE   *fp;
+		
+		if (!data) {
+			return;
+		}
+		
+		bool is_ok = (fp = std::fopen(to, "wb")) &&
+		             std::fwrite(data, 1, len, fp) == len;
+		is_ok      = fp && std::fclose(fp) == 0 && is_ok;
+		std::free(data);
+		if (!is_ok) {
+			unlink(to);
+			throw uabort("failed to write %s", to);
+		}
+	}
+	
+	
+	// ...compiles in parallel, up to one job per online processor.  Each
+	//   key is written as its object completes so that whatever finished
+	//   survives a failure or an interruption.  A unit is held back until
+	//   the interfaces it imports are built and fails with any of them.
+	bool run_units( unit_t *units, int num_units ) {
+		un::sysinfo_t info;
+		int           running = 0, status;
+		pid_t         pid;
+		bool          ok      = true;
+		
+		un::sysinfo_query(&info);
+		
+		for (;;) {
+			int ready = -1, waiting = 0;
+			
+			for (int i = 0; i < num_units && (ok || opts.is_keep_going); i++) {
+				unit_t *u = &units[i];
+				
+				if (!u->cmd || u->is_started) {
+					continue;
+				}
+				
+				switch (dep_state(units, u)) {
+				case 0:
+					waiting++;
+					continue;
+					
+				case -1:
+					u->is_started = true;
+					u->is_failed  = true;
+					ok            = false;
+					continue;
+				}
+				
+				ready = i;
+				break;
+			}
+			
+			if (ready >= 0 && running < info.cpus_online) {
+				unit_t *u = &units[ready];
+				
+				u->is_started = true;
+				if ((u->pid = fork()) == 0) {
+					execl("/bin/sh", "sh", "-c", u->cmd, (char *) NULL);
+					_exit(127);
+					
+				} else if (u->pid < 0) {
+					u->is_failed = true;
+					ok           = false;
+					continue;
+				}
+				
+				running++;
+				continue;
+			}
+			
+			if (!running) {
+				// - what is left waits on interfaces that will never finish
+				for (int i = 0; waiting && i < num_units; i++) {
+					if (units[i].cmd && !units[i].is_started) {
+						units[i].is_failed = true;
+						ok                 = false;
+					}
+				}
+				break;
+			}
+			
+			if ((pid = wait(&status)) < 0) {
+				throw uabort("failed to wait for compiler");
+			}
+			
+			for (int i = 0; i < num_units; i++) {
+				unit_t *u = &units[i];
+				if (u->pid != pid) {
+					continue;
+				}
+				
+				u->pid = 0;
+				running--;
+				if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+					write_key(u);
+					u->is_done = true;
+					if (scratch_dir) {
+						spill_scratch(units, num_units, u);
+					}
+				} else {
+					u->is_failed = true;
+					ok           = false;
+				}
+				break;
+			}
+		}
+		
+		return ok;
+	}
+	
+	
+	// - only the objects of the units being deployed are kept, and once
+	//   those exceed the cap the oldest make room for the rest
+	void trim_scratch( const char *dir, unit_t *units, int num_units ) {
+		const char **keep = (const char **) malloc(sizeof(char *) *
+		                                          (2 * num_units + 1));
+		
+		for (int i = 0; i < num_units; i++) {
+			keep[2 * i]     = units[i].obj;
+			keep[2 * i + 1] = units[i].key_file;
+		}
+		un::scratch_trim(dir, keep, 2 * num_units, scratch_cap);
+	}
+	
+	
+	// ...a unit that is current in the other root is used from there, and
+	//   its stale copy dropped
+	bool is_built( unit_t *u, const char *alt_root ) {
+		const char *obj = u->obj, *key_file = u->key_file;
+		
+		if (is_current(u)) {
+			return true;
+		}
+		if (!alt_root) {
+			return false;
+		}
+		
+		set_paths(u, variant_root(alt_root, &variants[u->variant]));
+		if (is_current(u)) {
+			unlink(obj);
+			unlink(key_file);
+			return true;
+		}
+		
+		u->obj      = obj;
+		u->key_file = key_file;
+		return false;
+	}
+	
+	
+	// - once scratch reaches its cap or the file system runs low, the units
+	//   not yet started are compiled to the disk instead
+	void spill_scratch( unit_t *units, int num_units, const unit_t *done ) {
+		scratch_used += file_bytes(done->obj) + file_bytes(done->key_file);
+		if (scratch_used < scratch_cap && !un::scratch_low(scratch_dir)) {
+			return;
+		}
+		
+		for (int i = 0; i < num_units; i++) {
+			unit_t *u = &units[i];
+			if (!u->cmd || u->is_started) {
+				continue;
+			}
+			
+			set_paths(u, variant_root(disk_root(), &variants[u->variant]));
+			make_dirs(u->obj);
+			unlink(u->key_file);
+			set_cmd(u, variants[u->variant].flags);
+		}
+		scratch_dir = nullptr;
+	}
+	
+	
+	// ...1 when every interface imported by `u` is built, -1 if one failed
+	int dep_state( unit_t *units, unit_t *u ) {
+		int ret = 1;
+		
+		for (int n = 0; n < u->num_deps; n++) {
+			unit_t *dep = &units[u->deps[n]];
+			
+			if (dep->is_failed) {
+				return -1;
+				
+			} else if (dep->cmd && !dep->is_done) {
+				ret = 0;
+			}
+		}
+		
+		return ret;
+	}
+	
+	
+	void run_link( variant_t *var ) {
+		char       *cmd      = NULL;
+		const char *times    = nullptr;
+		double     start     = now_secs();
+		cstrarr_t  obj_files = var->obj_files;
+		int        rc;
+	
+		make_dirs(var->bin_file);
+		cmd = rstrcat(cmd, UNUM_TOOL_CXX);
+		cmd = rstrcat(cmd, link_flags(var));
+		cmd = rstrcat(cmd, " -o ");
+		cmd = rstrcat(cmd, var->bin_file);
+
+		for (; obj_files && *obj_files; obj_files++) {
+			cmd = rstrcat(cmd, " ");
+			cmd = rstrcat(cmd, *obj_files);
+		}
+	#if UNUM_OS_LINUX
+		cmd = rstrcat(cmd, " -ldl");
+	#endif
+		
+	#if !UNUM_HAVE_LTO_THIN
+		// - GCC reports the time of its analysis and each of its partitions
+		if (opts.is_lto) {
+			times = rstrcat(rstrcat(nullptr, path_to(un::BP_LTO_CACHE)),
+			                "/link.times");
+			make_dirs(times);
+			cmd   = rstrcat(rstrcat(cmd, " -ftime-report 2>"), times);
+		}
+	#endif
+
+		rc = system(cmd);
+		if (opts.is_lto) {
+			lto_stats.jobs      = lto_jobs();
+			lto_stats.link_secs = now_secs() - start;
+		#if UNUM_HAVE_LTO_THIN || UNUM_HAVE_LTO_INCREMENTAL
+			lto_stats.is_cached = true;
+		#endif
+			read_link_times(times, rc != 0);
+		}
+		
+		if (rc != 0) {
+			throw uabort("failed to deploy kernel");
+		}
+	}
+	
+	
+	// - the link is the serial tail of every deployment, so it prefers the
+	//   linkers that divide their work among all the cores.
+	const char *link_flags( variant_t *var ) {
+		const char *ld  = "";
+		char       *ret = nullptr;
+		
+	#if UNUM_HAVE_LD_MOLD
+		ld = " -fuse-ld=mold";
+	#elif UNUM_HAVE_LD_LLD
+		ld = " -fuse-ld=lld";
+	#elif UNUM_HAVE_LD_GOLD
+		ld = " -fuse-ld=gold -Wl,--threads";
+	#endif
+	#if UNUM_HAVE_LTO_THIN
+		// - the ThinLTO cache is managed by lld
+		if (opts.is_lto) {
+			ld = " -fuse-ld=lld";
+		}
+	#endif
+		
+		ret = rstrcat(ret, ld);
+	#if UNUM_OS_LINUX
+		// - live units find the basis in the kernel that loads them
+		if (live_files) {
+			ret = rstrcat(ret, " -rdynamic");
+		}
+	#endif
+		if (opts.is_lto) {
+			ret = rstrcat(ret, lto_link_flags());
+		}
+		if (pgo_mode == PGO_TRAIN) {
+		#if PGO_INSTR
+			ret = rstrcat(ret, " -fprofile-instr-generate");
+		#else
+			ret = rstrcat(ret, " -fprofile-generate");
+		#endif
+		}
+		ret = rstrcat(ret, var->lflags);
+		return ret ? ret : "";
+	}
+	
+	
+	/*
+	 *  Link-time optimized objects carry the compiler's IR, and the link
+	 *  divides the program into one partition per online processor that 
+	 *  are optimized in parallel.  Where the toolchain can cache partitions,
+	 *  ThinLTO's modules or GCC's incremental LTRANS units, those that are
+	 *  unchanged are reused from the LTO cache directory.
+	 */
+	const char *lto_flags( void ) {
+		if (!opts.is_lto) {
+			return "";
+		}
+		
+	#if UNUM_HAVE_LTO_THIN
+		return " -O2 -flto=thin";
+	#else
+		return " -O2 -flto";
+	#endif
+	}
+	
+	
+	/*
+	 *  Only ThinLTO and a GCC with -flto-incremental (15 and later) keep a
+	 *  cache between links, an older GCC optimizes every module again.
+	 */
+	const char *lto_link_flags( void ) {
+		char jobs[32];
+		char *ret = nullptr;
+		
+		std::snprintf(jobs, sizeof(jobs), "%d", lto_jobs());
+		
+	#if UNUM_HAVE_LTO_THIN
+		ret = rstrcat(rstrcat(ret, " -O2 -flto=thin -Wl,--thinlto-jobs="), jobs);
+		ret = rstrcat(rstrcat(ret, " -Wl,--thinlto-cache-dir="),
+		              path_to(un::BP_LTO_CACHE));
+	#else
+		ret = rstrcat(rstrcat(ret, " -O2 -flto="), jobs);
+	#if UNUM_HAVE_LTO_PARTITION
+		ret = rstrcat(ret, " -flto-partition=balanced");
+	#endif
+	#if UNUM_HAVE_LTO_INCREMENTAL
+		ret = rstrcat(rstrcat(ret, " -flto-incremental="),
+		              path_to(un::BP_LTO_CACHE));
+	#endif
+	#endif
+		
+		return ret;
+	}
+	
+	
+	int lto_jobs( void ) {
+		un::sysinfo_t info;
+		
+		un::sysinfo_query(&info);
+		return info.cpus_online > 0 ? info.cpus_online : 1;
+	}
+	
+	
+	/*
+	 *  <sample-link-times>
+	 *
+	 *  Time variable                            usr        sys       wall  ...
+	 *   phase stream in              :   0.10 ( 30%)  0.01 ...   0.12 ( 31%) ...
+	 *   ...
+	 *   TOTAL                        :   0.33        0.03       0.38       ...
+	 *
+	 *  Each LTO process prints a table to the shared stream, the analysis
+	 *  finishing before any partition starts.  Anything else in it is the
+	 *  linker's own output and is passed on when the link fails.
+	 */
+	void read_link_times( const char *times, bool is_failed ) {
+		size_t len;
+		char   *text = times ? un::lex_read_file(times, &len) : nullptr;
+		int    count = 0;
+		
+		if (!text) {
+			return;
+		}
+		
+		for (char *line = text, *next; line && *line; line = next) {
+			double usr, sys, wall;
+			
+			if ((next = std::strchr(line, '\n'))) {
+				*next++ = '\0';
+			}
+			
+			if (std::sscanf(line, " TOTAL : %lf %lf %lf", &usr, &sys,
+			                &wall) == 3) {
+				*(count++ ? &lto_stats.ltrans_secs : &lto_stats.wpa_secs) += wall;
+				
+			} else if (!str2cmp(line, "Time variable")) {
+				continue;
+				
+			} else if (is_failed && line[0] && line[0] != ' ') {
+				std::fprintf(stderr, "%s\n", line);
+			}
+		}
+		
+		std::free(text);
+	}
+	
+	
+	double now_secs( void ) {
+		struct timespec ts;
+		
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+	}
+	
+	
+	// - repository paths are relative to the root, so are the same in every
+	//   checkout and may be part of the key.
+	char *cc_flags( cstrarr_t inc_dirs ) {
+		char *ret = rstrcat(nullptr, " -c");
+		
+		for (; inc_dirs && *inc_dirs && **inc_dirs; inc_dirs++) {
+			ret = rstrcat(ret, " -I");
+			ret = rstrcat(ret, *inc_dirs);
+		}
+		
+		return ret;
+	}
+	
+	
+	// - objects must not depend on where the repository is checked out
+	const char *prefix_map( void ) {
+	#if UNUM_HAVE_FILE_PREFIX_MAP
+		return rstrcat(rstrcat(rstrcat(nullptr, " -ffile-prefix-map="),
+		               path_to(un::BP_ROOT)), "=.");
+	#else
+		return "";
+	#endif
+	}
+	
+	
+	void unit_key( unit_t *u, const char *flags, cstrarr_t inc_dirs ) {
+		un::hash_ctx_t ctx;
+		un::hash_t     inputs = unit_inputs(u->src, inc_dirs), counts;
+		
+		un::hash_init(&ctx);
+		un::hash_update_s(&ctx, UNUM_TOOL_ID);
+		un::hash_update_s(&ctx, flags);
+		un::hash_update(&ctx, &inputs, sizeof(inputs));
+		if (pgo_mode == PGO_USE &&
+		    un::hash_file(profile_path(u->src), &counts)) {
+			un::hash_update(&ctx, &counts, sizeof(counts));
+		}
+		un::hash_hex(un::hash_final(&ctx), u->key);
+	}
+	
+	
+	// ...the source and every header it reaches, regardless of toolchain
+	un::hash_t unit_inputs( const char *file, cstrarr_t inc_dirs ) {
+		un::hash_ctx_t ctx;
+		un::hash_t     src, headers;
+		time_t         mtime;
+		
+		if (!un::hash_file(file, &src)) {
+			throw uabort("failed to read %s", file);
+		}
+		
+		un::scan_t *deps = scanner(inc_dirs);
+		if (!un::scan_digest(deps, un::scan_file(deps, file), &headers,
+		                     &mtime)) {
+			if (!has_headers) {
+				all_headers = header_digest(inc_dirs);
+				has_headers = true;
+			}
+			headers = all_headers;
+		}
+		
+		un::hash_init(&ctx);
+		un::hash_update_s(&ctx, file);
+		un::hash_update(&ctx, &src, sizeof(src));
+		un::hash_update(&ctx, &headers, sizeof(headers));
+		return un::hash_final(&ctx);
+	}
+	
+	
+	/*
+	 *  Interfaces named in the manifest are compiled before the units that
+	 *  import them and an importer's key includes those of its interfaces,
+	 *  so a change to an interface rebuilds the units that see it while its
+	 *  implementation units are untouched.  BMIs are kept per toolchain
+	 *  because no other compiler can read them.
+	 */
+	void link_modules( unit_t *all, int base, int num_units ) {
+		unit_t *units = &all[base];
+		char   *map   = nullptr;
+		
+		for (int i = 0; i < num_units; i++) {
+			unit_t           *u = &units[i];
+			un::scan_info_t  info;
+			
+			if (!is_interface(u->src)) {
+				continue;
+			}
+			
+			un::scan_info(scan, un::scan_file(scan, u->src), &info);
+			if (!info.module) {
+				throw uabort("%s doesn't export a module", u->src);
+			}
+			
+			for (int j = 0; j < i; j++) {
+				if (units[j].module && !std::strcmp(units[j].module,
+				                                    info.module)) {
+					throw uabort("module %s is exported by %s and %s",
+					             info.module, units[j].src, u->src);
+				}
+			}
+			
+			u->module = info.module;
+			map       = rstrcat(rstrcat(rstrcat(rstrcat(map, u->module), " "),
+			                    bmi_path(u)), "\n");
+		}
+		
+		for (int i = 0; i < num_units; i++) {
+			unit_t          *u = &units[i];
+			un::scan_info_t info;
+			
+			un::scan_info(scan, un::scan_file(scan, u->src), &info);
+			if (!info.num_imports) {
+				continue;
+			}
+			
+			u->deps = (int *) malloc(sizeof(int) * info.num_imports);
+			for (int n = 0; n < info.num_imports; n++) {
+				int dep = find_module(units, num_units, info.imports[n]);
+				if (dep < 0) {
+					throw uabort("%s imports %s, which is not in the manifest "
+					             "modules", u->src, info.imports[n]);
+				}
+				
+				// - an implementation unit names its own interface
+				if (dep != i) {
+					u->deps[u->num_deps++] = base + dep;
+				}
+			}
+		}
+		
+		for (int i = 0; i < num_units; i++) {
+			fold_key(all, num_units, base + i, 0);
+		}
+		
+		if (map) {
+			write_map(map, units[0].variant);
+		}
+	}
+	
+	
+	// ...standard library modules are left to the compiler's own mapper
+	int find_module( unit_t *units, int num_units, const char *name ) {
+		for (int i = 0; i < num_units; i++) {
+			if (units[i].module && !std::strcmp(units[i].module, name)) {
+				return i;
+			}
+		}
+		return -1;
+	}
+	
+	
+	bool is_interface( const char *src ) {
+		for (cstrarr_t cur = interfaces; cur && *cur; cur++) {
+			if (!std::strcmp(*cur, src)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	
+	
+	// ...a chain longer than the unit count can only be a cycle
+	void fold_key( unit_t *units, int num_units, int i, int depth ) {
+		unit_t         *u = &units[i];
+		un::hash_ctx_t ctx;
+		
+		if (u->is_keyed || (!u->module && !u->num_deps)) {
+			return;
+		}
+		
+		if (depth > num_units) {
+			throw uabort("module import cycle through %s", u->src);
+		}
+		
+		un::hash_init(&ctx);
+		un::hash_update_s(&ctx, u->key);
+		un::hash_update_s(&ctx, MODULE_FLAGS);
+		for (int n = 0; n < u->num_deps; n++) {
+			fold_key(units, num_units, u->deps[n], depth + 1);
+			un::hash_update_s(&ctx, units[u->deps[n]].key);
+		}
+		un::hash_hex(un::hash_final(&ctx), u->key);
+		u->is_keyed = true;
+	}
+	
+	
+	// ...a BMI can only be imported with the flags that produced it
+	const char *bmi_dir( int variant ) {
+		const char *dir = rstrcat(rstrcat(nullptr, path_to(un::BP_BUILD)),
+		                          "/bmi/" UNUM_TOOL_ID);
+		return variant_root(dir, &variants[variant]);
+	}
+	
+	
+	const char *bmi_path( unit_t *u ) {
+		return rstrcat(rstrcat(rstrcat(nullptr, bmi_dir(u->variant)), "/"),
+		               rstrcat(strdup(u->module), ".gcm"));
+	}
+	
+	
+	const char *module_map( int variant ) {
+		return rstrcat(rstrcat(nullptr, bmi_dir(variant)), "/module.map");
+	}
+	
+	
+	// ...rewritten only on change so that a running compiler never sees it torn
+	void write_map( const char *map, int variant ) {
+		const char *path = module_map(variant);
+		const char *tmp  = rstrcat(rstrcat(nullptr, path), ".tmp");
+		char       *cur;
+		size_t     len;
+		FILE       *fp;
+		
+		if ((cur = un::lex_read_file(path, &len))) {
+			bool is_same = len == std::strlen(map) &&
+			               !std::memcmp(cur, map, len);
+			std::free(cur);
+			if (is_same) {
+				return;
+			}
+		}
+		
+		make_dirs(path);
+		if (!(fp = std::fopen(tmp, "w"))) {
+			throw uabort("failed to write %s", tmp);
+		}
+		
+		bool is_ok = std::fputs(map, fp) >= 0;
+		is_ok      = std::fclose(fp) == 0 && is_ok;
+		if (!is_ok || rename(tmp, path) != 0) {
+			unlink(tmp);
+			throw uabort("failed to write %s", path);
+		}
+	}
+	
+	
+	/*
+	 *  <sample-key-file>
+	 *
+	 *  6f0c1d2e3a4b5c6d7e8f90a1b2c3d4e5    - inputs to the compiler
+	 *  0a1b2c3d4e5f60718293a4b5c6d7e8f9    - content of the object
+	 *
+	 */
+	bool is_current( unit_t *u ) {
+		char key[UNUM_HASH_HEX_LEN];
+		FILE *fp;
+		bool ret = false;
+		
+		if (!(file_info(u->obj).st_mode & S_IFREG) ||
+		    (u->module && !(file_info(bmi_path(u)).st_mode & S_IFREG)) ||
+		    !(fp = std::fopen(u->key_file, "r"))) {
+			return false;
+		}
+		
+		ret = std::fscanf(fp, "%32s %32s", key, u->obj_hash) == 2 &&
+		      !std::strcmp(key, u->key);
+		std::fclose(fp);
+		return ret;
+	}
+	
+	
+	// - the key is written only after the object is complete
+	void write_key( unit_t *u ) {
+		FILE       *fp;
+		un::hash_t h;
+		
+		if (!un::hash_file(u->obj, &h)) {
+			throw uabort("failed to read %s", u->obj);
+		}
+		un::hash_hex(h, u->obj_hash);
+		
+		fp = std::fopen(u->key_file, "w");
+		if (!fp || std::fprintf(fp, "%s\n%s\n", u->key, u->obj_hash) < 0) {
+			if (fp) {
+				std::fclose(fp);
+			}
+			throw uabort("failed to write %s", u->key_file);
+		}
+		std::fclose(fp);
+	}
+	
+	
+	/*
+	 *  The link record pairs the link key with the size and modification 
+	 *  time of the kernel it produced so that a binary replaced by other 
+	 *  means (eg. the pre-kernel) is never mistaken for a current one.
+	 */
+	bool is_linked( variant_t *var ) {
+		char buf[UNUM_HASH_HEX_LEN], key[UNUM_HASH_HEX_LEN];
+		
+		return read_link(var, buf) &&
+		       !std::strcmp(buf, un::hash_hex(var->link_key, key));
+	}
+	
+	
+	// ...the key of the last link, provided the kernel is still its product
+	bool read_link( variant_t *var, char *key ) {
+		struct stat s = file_info(var->bin_file);
+		long long   size, mtime;
+		FILE        *fp;
+		bool        ret = false;
+		
+		if (!(s.st_mode & S_IFREG) ||
+		    !(fp = std::fopen(var->link_file, "r"))) {
+			return false;
+		}
+		
+		ret = std::fscanf(fp, "%32s %lld %lld", key, &size, &mtime) == 3 &&
+		      size == (long long) s.st_size && mtime == (long long) s.st_mtime;
+		std::fclose(fp);
+		return ret;
+	}
+	
+	
+	void write_link( variant_t *var ) {
+		struct stat s  = file_info(var->bin_file);
+		char        key[UNUM_HASH_HEX_LEN];
+		FILE        *fp = std::fopen(var->link_file, "w");
+		
+		if (!fp || std::fprintf(fp, "%s %lld %lld\n",
+		                        un::hash_hex(var->link_key, key),
+		                        (long long) s.st_size,
+		                        (long long) s.st_mtime) < 0) {
+			if (fp) {
+				std::fclose(fp);
+			}
+			throw uabort("failed to write link record");
+		}
+		std::fclose(fp);
+	}
+	
+	
+	/*
+	 *  Live units are compiled position independent and each is linked to
+	 *  a shared object of its own under the live directory, never into a
+	 *  kernel, so a deploy that only changed them leaves every kernel alone
+	 *  and a resident one swaps them in place.  Objects of units that left
+	 *  the manifest are removed so that no kernel loads them again.
+	 */
+	void deploy_live( cstrarr_t inc_dirs ) {
+		const char    *dir   = path_to(un::BP_LIVE);
+		char          *flags = rstrcat(cc_flags(inc_dirs), LIVE_FLAGS);
+		char          *names = rstrcat(nullptr, "/"), *failed = nullptr;
+		unit_t        *units;
+		int           num    = 0;
+		DIR           *dirp;
+		struct dirent *ditem;
+		
+		for (cstrarr_t cur = live_files; cur && *cur; cur++) {
+			num++;
+		}
+		
+		units = (unit_t *) malloc(sizeof(unit_t) * (num ? num : 1));
+		for (int i = 0; i < num; i++) {
+			unit_t *u = &units[i];
+			
+			std::memset(u, 0, sizeof(*u));
+			u->src    = live_files[i];
+			u->origin = -1;
+			set_paths(u, rstrcat(rstrcat(nullptr, disk_root()), "/live"));
+			unit_key(u, flags, inc_dirs);
+			if (!is_current(u)) {
+				make_dirs(u->obj);
+				unlink(u->key_file);
+				set_cmd(u, flags);
+			}
+		}
+		
+		if (!run_units(units, num)) {
+			for (int i = 0; i < num; i++) {
+				if (units[i].is_failed) {
+					failed = rstrcat(failed ? rstrcat(failed, ", ") : failed,
+					                 units[i].src);
+				}
+			}
+			throw uabort("failed to compile %s", failed ? failed : "live units");
+		}
+		
+		for (int i = 0; i < num; i++) {
+			const char     *base = std::strrchr(units[i].src, '/');
+			char           *name = strdup(base ? base + 1 : units[i].src);
+			char           *ext  = std::strrchr(name, '.');
+			un::hash_ctx_t ctx;
+			variant_t      lib;
+			
+			if (ext) {
+				*ext = '\0';
+			}
+			if (std::strstr(names, rstrcat(rstrcat(rstrcat(nullptr, "/"), name),
+			                               "/"))) {
+				throw uabort("live units share the name %s", name);
+			}
+			names = rstrcat(rstrcat(names, name), "/");
+			
+			std::memset(&lib, 0, sizeof(lib));
+			lib.name      = name;
+			lib.bin_file  = rstrcat(rstrcat(rstrcat(rstrcat(nullptr, dir), "/"),
+			                name), ".so");
+			lib.link_file = rstrcat(rstrcat(rstrcat(rstrcat(nullptr,
+			                path_to(un::BP_BUILD)), "/live/"), name), ".link");
+			lib.obj_files = arr_add(nullptr, units[i].obj);
+			
+			un::hash_init(&ctx);
+			un::hash_update_s(&ctx, UNUM_TOOL_ID);
+			un::hash_update_s(&ctx, LIVE_LINK_FLAGS);
+			un::hash_update_s(&ctx, units[i].obj_hash);
+			lib.link_key = un::hash_final(&ctx);
+			
+			if (!is_linked(&lib)) {
+				run_live_link(&lib);
+			}
+			make_dirs(lib.link_file);
+			write_link(&lib);
+		}
+		
+		// - units that left the manifest must not be loaded again
+		if (!(dirp = opendir(dir))) {
+			return;
+		}
+		while ((ditem = readdir(dirp))) {
+			char *name = strdup(ditem->d_name);
+			char *ext  = std::strrchr(name, '.');
+			
+			if (*name == '.' || !ext || std::strcmp(ext, ".so")) {
+				continue;
+			}
+			*ext = '\0';
+			if (!std::strstr(names, rstrcat(rstrcat(rstrcat(nullptr, "/"),
+			                                        name), "/"))) {
+				unlink(rstrcat(rstrcat(rstrcat(nullptr, dir), "/"),
+				               ditem->d_name));
+			}
+		}
+		closedir(dirp);
+	}
+	
+	
+	// - the object is renamed into place, never rewritten where a kernel may
+	//   have it mapped
+	void run_live_link( variant_t *lib ) {
+		const char *tmp = rstrcat(rstrcat(nullptr, lib->bin_file), ".new");
+		char       *cmd = nullptr;
+		
+		make_dirs(lib->bin_file);
+		cmd = rstrcat(cmd, UNUM_TOOL_CXX);
+		cmd = rstrcat(cmd, LIVE_LINK_FLAGS);
+		cmd = rstrcat(rstrcat(cmd, " -o "), tmp);
+		cmd = rstrcat(rstrcat(cmd, " "), lib->obj_files[0]);
+		
+		if (system(cmd) != 0 || rename(tmp, lib->bin_file) != 0) {
+			unlink(tmp);
+			throw uabort("failed to link live unit %s", lib->name);
+		}
+	}
+	
+	
+	// ...the kernel's sources followed by those of the live units
+	cstrarr_t all_sources( cstrarr_t src_files ) {
+		for (cstrarr_t cur = live_files; cur && *cur; cur++) {
+			src_files = arr_add(src_files, *cur);
+		}
+		return src_files;
+	}
+	
+	
+	// - every directory a unit or header may be found in, and the manifest's
+	int tracked_dirs( cstrarr_t *dirs, bool **is_recursive ) {
+		cstrarr_t inc_dirs, src_files;
+		char      *dir = strdup(path_to(un::BP_MANIFEST));
+		int       num  = 1;
+		
+		set_root();
+		read_manifest(&inc_dirs, &src_files);
+		src_files = all_sources(src_files);
+		for (cstrarr_t cur = inc_dirs; cur && *cur && **cur; cur++, num++) {
+		}
+		for (cstrarr_t cur = src_files; cur && *cur; cur++, num++) {
+		}
+		
+		*dirs         = (cstrarr_t) malloc(sizeof(char *) * num);
+		*is_recursive = (bool *) malloc(sizeof(bool) * num);
+		
+		*std::strrchr(dir, '/') = '\0';
+		(*dirs)[0]              = dir;
+		(*is_recursive)[0]      = false;
+		num                     = 1;
+		for (cstrarr_t cur = inc_dirs; cur && *cur && **cur; cur++, num++) {
+			(*dirs)[num]         = *cur;
+			(*is_recursive)[num] = true;
+		}
+		
+		for (cstrarr_t cur = src_files; cur && *cur; cur++, num++) {
+			const char *slash = std::strrchr(*cur, '/');
+			
+			dir                  = strdup(*cur);
+			dir[slash ? slash - *cur : 0] = '\0';
+			(*dirs)[num]         = *dir ? dir : ".";
+			(*is_recursive)[num] = true;
+		}
+		
+		return num;
+	}
+	
+	
+	void watch( un::journal_t *jn ) {
+		cstrarr_t dirs;
+		bool      *is_recursive;
+		int       num = tracked_dirs(&dirs, &is_recursive);
+		
+		for (int i = 0; i < num; i++) {
+			if ((file_info(dirs[i]).st_mode & S_IFDIR) &&
+			    !un::journal_watch(jn, dirs[i], is_recursive[i])) {
+				throw uabort("failed to watch %s", dirs[i]);
+			}
+		}
+	}
+	
+	
+	// ...the same directories as they are now, for when there is no monitor
+	un::snap_t *snapshot( void ) {
+		cstrarr_t dirs;
+		bool      *is_recursive;
+		int       num = tracked_dirs(&dirs, &is_recursive);
+		
+		return un::snap_build(dirs, is_recursive, num,
+		                      path_to(un::BP_DEPLOY));
+	}
+	
+	
+	// - whatever affects the kernels besides their sources
+	const char *deploy_sig( variant_t *vars, int num_vars ) {
+		un::hash_ctx_t ctx;
+		char           *ret = (char *) malloc(UNUM_HASH_HEX_LEN);
+		
+		un::hash_init(&ctx);
+		un::hash_update_s(&ctx, UNUM_TOOL_ID);
+		un::hash_update_s(&ctx, opts.is_lto ? "lto" : "");
+		for (int v = 0; v < num_vars; v++) {
+			un::hash_update_s(&ctx, vars[v].name ? vars[v].name : "kernel");
+		}
+		return un::hash_hex(un::hash_final(&ctx), ret);
+	}
+	
+	
+	// - the options of this request, which decide what it deploys
+	const char *request_sig( void ) {
+		un::hash_ctx_t ctx;
+		char           *ret = (char *) malloc(UNUM_HASH_HEX_LEN);
+		
+		un::hash_init(&ctx);
+		un::hash_update_s(&ctx, opts.is_keep_going ? "keep-going" : "");
+		un::hash_update_s(&ctx, opts.is_profile ? "profile" : "");
+		un::hash_update_s(&ctx, opts.is_lto ? "lto" : "");
+		un::hash_update_s(&ctx, opts.variants ? opts.variants : "");
+		un::hash_update_s(&ctx, opts.pgo_cmd ? opts.pgo_cmd : "");
+		return un::hash_hex(un::hash_final(&ctx), ret);
+	}
+	
+	
+	bool read_mark( un::journal_mark_t *mark, char *sig ) {
+		FILE               *fp = std::fopen(path_to(un::BP_JOURNAL_MARK), "r");
+		unsigned long long gen, pos;
+		bool               ret;
+		
+		if (!fp) {
+			return false;
+		}
+		
+		ret = std::fscanf(fp, "%llu %llu %32s", &gen, &pos, sig) == 3;
+		std::fclose(fp);
+		mark->gen = (uint64_t) gen;
+		mark->pos = (uint64_t) pos;
+		return ret;
+	}
+	
+	
+	// - without a journal the mark stands for the snapshot saved with it
+	void write_mark( const un::journal_mark_t *mark, const char *sig ) {
+		FILE *fp;
+		
+		if (!mark->gen && !un::snap_save(snap, path_to(un::BP_TREE_SNAP))) {
+			unlink(path_to(un::BP_TREE_SNAP));
+			return;
+		}
+		
+		fp = std::fopen(path_to(un::BP_JOURNAL_MARK), "w");
+		if (!fp || std::fprintf(fp, "%llu %llu %s\n",
+		                        (unsigned long long) mark->gen,
+		                        (unsigned long long) mark->pos, sig) < 0) {
+			if (fp) {
+				std::fclose(fp);
+			}
+			unlink(path_to(un::BP_JOURNAL_MARK));
+			return;
+		}
+		std::fclose(fp);
+	}
+	
+	
+	// ...what changed since the last deploy, if that can be known cheaply
+	bool read_changes( un::journal_log_t *log, const char *sig ) {
+		un::journal_mark_t mark;
+		char               last[UNUM_HASH_HEX_LEN];
+		un::snap_t         *prev;
+		bool               ret;
+		
+		if (!read_mark(&mark, last) || (sig && std::strcmp(sig, last))) {
+			return false;
+		}
+		
+		if (mark.gen) {
+			return un::journal_read(path_to(un::BP_JOURNAL), &mark, log);
+		}
+		
+		if (!(prev = un::snap_load(path_to(un::BP_TREE_SNAP)))) {
+			return false;
+		}
+		ret = un::snap_diff(prev, log);
+		un::snap_close(prev);
+		return ret;
+	}
+	
+	
+	/*
+	 *  With a journal or snapshot, a deploy that follows another with the
+	 *  same options finds nothing to do without reading the manifest or
+	 *  hashing any source, as long as every kernel is still the one that
+	 *  deploy linked.  Profiles are never skipped since collecting them is
+	 *  the point.
+	 */
+	bool is_unchanged( variant_t *vars, int num_vars, const char *sig ) {
+		un::journal_log_t log;
+		char              key[UNUM_HASH_HEX_LEN];
+		bool              ret;
+		
+		if (opts.is_profile || opts.pgo_cmd || !read_changes(&log, sig)) {
+			return false;
+		}
+		
+		ret = log.num_paths == 0;
+		un::journal_free(&log);
+		for (int v = 0; ret && v < num_vars; v++) {
+			ret = read_link(&vars[v], key);
+		}
+		return ret;
+	}
+	
+	
+	// - the graph is only an aid to status, so a failure just removes it
+	void save_graph( cstrarr_t src_files ) {
+		const char   *path = path_to(un::BP_DEPS_GRAPH);
+		un::gitidx_t *git  = scan ? un::gitidx_open(path_to(un::BP_ROOT)) : NULL;
+		
+		if (!scan || !un::graph_build(scan, src_files, git, &graph) ||
+		    !un::graph_save(&graph, path)) {
+			unlink(path);
+		}
+		un::gitidx_close(git);
+		un::graph_close(&graph);
+	}
+	
+	
+	/*
+	 *  A saved graph answers without reading any file, only those whose 
+	 *  size or modification time differ from when they were scanned are 
+	 *  followed to the units that include them.  When git still vouches
+	 *  for the blob that was scanned, a touched or re-checked-out file is
+	 *  known to be unchanged without hashing it.  Otherwise the file is
+	 *  lexed again, since an edit that leaves its tokens alone doesn't
+	 *  change what a deploy builds.  With a journal or snapshot, only the
+	 *  files they name are looked at.
+	 */
+	int graph_status( cstrarr_t src_files ) {
+		uint32_t          num    = graph.num_nodes + 1, num_dirty = 0;
+		uint32_t          *dirty = (uint32_t *) malloc(sizeof(uint32_t) * num);
+		uint32_t          *units = (uint32_t *) malloc(sizeof(uint32_t) * num);
+		unsigned char     *marks = (unsigned char *) malloc(num);
+		uint32_t          num_units;
+		int               ret    = 0;
+		un::gitidx_t      *git   = NULL;
+		bool              is_git = true;
+		unsigned char     oid[UNUM_GIT_OID_MAX];
+		un::hash_t        tokens;
+		un::journal_log_t log;
+		const char        **changed = nullptr;
+		char              buf[PATH_MAX];
+		
+		if (read_changes(&log, nullptr)) {
+			changed = (const char **) malloc(sizeof(char *) *
+			                                 (log.num_paths + 1));
+			for (int i = 0, pos = 0; i < log.num_paths; i++) {
+				changed[i] = log.paths + pos;
+				pos       += std::strlen(changed[i]) + 1;
+			}
+			std::qsort(changed, log.num_paths, sizeof(char *), path_cmp);
+		}
+		
+		for (uint32_t i = 0; i < graph.num_nodes; i++) {
+			const char  *path = un::graph_path(&graph, i);
+			const char  *key  = buf;
+			struct stat s;
+			
+			// - the journal's paths are normalized, the scanner's may not be
+			if (changed) {
+				std::snprintf(buf, sizeof(buf), "%s", path);
+				un::journal_norm(buf);
+				if (!std::bsearch(&key, changed, log.num_paths,
+				                  sizeof(char *), path_cmp)) {
+					continue;
+				}
+			}
+			
+			s = file_info(path);
+			if ((int64_t) s.st_mtime == graph.nodes[i].mtime &&
+			    (int64_t) s.st_size == graph.nodes[i].size) {
+				continue;
+			}
+			
+			// - the index is only opened once something looks modified
+			if ((graph.nodes[i].flags & un::GN_GIT) && is_git && !git &&
+			    !(git = un::gitidx_open(path_to(un::BP_ROOT)))) {
+				is_git = false;
+			}
+			if (git && (graph.nodes[i].flags & un::GN_GIT) &&
+			    un::gitidx_lookup(git, path, &s, oid) &&
+			    !std::memcmp(oid, graph.nodes[i].oid, sizeof(oid))) {
+				continue;
+			}
+			if ((graph.nodes[i].flags & un::GN_LEX) &&
+			    un::lex_fingerprint(path, &tokens) &&
+			    un::hash_equal(tokens, graph.nodes[i].tokens)) {
+				continue;
+			}
+			dirty[num_dirty++] = i;
+		}
+		un::gitidx_close(git);
+		if (changed) {
+			un::journal_free(&log);
+		}
+		
+		std::memset(marks, 0, num);
+		num_units = un::graph_dependents(&graph, dirty, num_dirty, units, num);
+		for (uint32_t i = 0; i < num_units && i < num; i++) {
+			marks[units[i]] = 1;
+		}
+		
+		// - sources new to the manifest were never scanned
+		for (cstrarr_t cur = src_files; cur && *cur; cur++) {
+			uint32_t id = un::graph_find(&graph, *cur);
+			if (id == UNUM_GRAPH_NONE || marks[id]) {
+				ret++;
+			}
+		}
+		
+		return ret;
+	}
+	
+	
+	static int path_cmp( const void *a, const void *b ) {
+		return std::strcmp(*(const char *const *) a, *(const char *const *) b);
+	}
+	
+	
+	un::scan_t *scanner( cstrarr_t inc_dirs ) {
+		if (!scan && !(scan = un::scan_open(inc_dirs))) {
+			throw uabort("out of memory");
+		}
+		return scan;
+	}
+	
+	
+	/*
+	 *  Headers are combined without regard to order because directory
+	 *  enumeration is not stable between checkouts, and by their tokens so
+	 *  that rewording a comment in a common header doesn't rebuild 
+	 *  everything.
+	 */
+	un::hash_t header_digest( cstrarr_t inc_dirs ) {
+		un::hash_t ret = { 0, 0 };
+		
+		for (; inc_dirs && *inc_dirs && **inc_dirs; inc_dirs++) {
+			add_headers(*inc_dirs, &ret);
+		}
+		
+		return ret;
+	}
+	
+	
+	void add_headers( const char *dir, un::hash_t *digest ) {
+		DIR           *dirp = opendir(dir);
+		struct dirent *ditem;
+		
+		if (!dirp) {
+			return;
+		}
+		
+		while ((ditem = readdir(dirp))) {
+			char        *file;
+			struct stat s;
+			
+			if (ditem->d_name[0] == '.') {
+				continue;
+			}
+			
+			file = rstrcat(rstrcat(rstrcat(nullptr, dir), "/"), ditem->d_name);
+			s    = file_info(file);
+			if (s.st_mode & S_IFDIR) {
+				add_headers(file, digest);
+				
+			} else if ((s.st_mode & S_IFREG) && is_header(file)) {
+				un::hash_ctx_t ctx;
+				un::hash_t     content, h;
+				
+				if (!un::lex_fingerprint(file, &content)) {
+					continue;
+				}
+				
+				un::hash_init(&ctx);
+				un::hash_update_s(&ctx, file);
+				un::hash_update(&ctx, &content, sizeof(content));
+				h           = un::hash_final(&ctx);
+				digest->lo += h.lo;
+				digest->hi += h.hi;
+			}
+		}
+		
+		closedir(dirp);
+	}
+	
+	
+	bool is_header( const char *file ) {
+		const char *ext = std::strrchr(file, '.');
+		return ext && (!std::strcmp(ext, ".h") || !std::strcmp(ext, ".hh") ||
+		               !std::strcmp(ext, ".hpp") || !std::strcmp(ext, ".inc"));
+	}
+	
+	
+	// ...creates the directories leading to `file`
+	void make_dirs( const char *file ) {
+		char *path = strdup(file);
+		
+		for (char *pp = path + 1; *pp; pp++) {
+			if (*pp != '/') {
+				continue;
+			}
+			
+			*pp = '\0';
+			if (mkdir(path, S_IRWXU) != 0 && errno != EEXIST) {
+				throw uabort("failed to create directory %s", path);
+			}
+			*pp = '/';
+		}
+	}
+	
+			
+	char *rstrcat( char *buf, const char *text ) {
+		const size_t len_cur = buf ? strlen(buf) : 0;
+		const size_t len_txt = strlen(text);
+
+		if (!len_txt) {
+			return buf;
+		}
+
+		buf = (char *) realloc(buf, len_cur + len_txt + 1);
+		if (!buf) {
+			throw uabort("out of memory");
+		}
+
+		std::strcpy(&buf[len_cur], text);
+		return buf;
 	}
 
 
@@ -397,12 +2809,67 @@ const char *deployment::MAN_SEC_CORE   = "core:";
 const char *deployment::MAN_SEC_KERNEL = "kernel:";
 const char *deployment::MAN_SEC_BUILD  = "build:";
 const char *deployment::MAN_SEC_INC    = "include:";
+const char *deployment::MAN_SEC_MODULES = "modules:";
+const char *deployment::MODULE_FLAGS   = " -std=c++20 -fmodules-ts "
+                                         "-DUNUM_MODULES=1 -fmodule-mapper=";
+const char *deployment::MAN_SEC_LIVE   = "live:";
+#if UNUM_HAVE_NO_GNU_UNIQUE
+const char *deployment::LIVE_FLAGS     = " -fPIC -fno-gnu-unique";
+#else
+const char *deployment::LIVE_FLAGS     = " -fPIC";
+#endif
+#if UNUM_OS_MACOS
+const char *deployment::LIVE_LINK_FLAGS = " -dynamiclib -undefined "
+                                          "dynamic_lookup";
+#else
+const char *deployment::LIVE_LINK_FLAGS = " -shared";
+#endif
+const char *deployment::MAN_KEY_CACHE  = "cache:";
+const char *deployment::MAN_KEY_CACHE_SIZE = "cache-size:";
+const char *deployment::MAN_KEY_SCRATCH_SIZE = "scratch-size:";
+const char *deployment::TRAINING_ENV   = "UNUM_PGO_TRAINING";
+#if UNUM_OS_MACOS
+const char *deployment::PROFDATA       = "xcrun llvm-profdata";
+#else
+const char *deployment::PROFDATA       = "llvm-profdata";
+#endif
 
 
-bool un::deploy( char *error, size_t len ) {
-	return deployment().deploy(error, len);
+bool un::deploy( char *error, size_t len, bool *is_changed,
+                 const deploy_opts_t *opts ) {
+	bool changed;
+	return deployment().deploy(error, len, is_changed ? is_changed : &changed,
+	                           opts);
 }
 
 int un::deploy_status( void ) {
 	return deployment().status();
 }
+
+bool un::deploy_monitor( char *error, size_t len ) {
+	return deployment().monitor(error, len);
+}
+
+un::deploy_monitor_t *un::deploy_monitor_open( char *error, size_t len ) {
+	return deployment().monitor_open(error, len);
+}
+
+int un::deploy_monitor_fd( const deploy_monitor_t *mon ) {
+	return un::journal_fd(mon->jn);
+}
+
+bool un::deploy_monitor_update( deploy_monitor_t *mon, int timeout_ms,
+                                char *error, size_t len ) {
+	return deployment().monitor_update(mon, timeout_ms, error, len);
+}
+
+void un::deploy_monitor_close( deploy_monitor_t *mon ) {
+	if (mon) {
+		un::journal_stop(mon->jn);
+		std::free(mon);
+	}
+}
+
+bool un::deploy_cache( char *dir, size_t len, long long *budget ) {
+	return deployment().cache(dir, len, budget);
+}
@@ -13,9 +13,57 @@
 namespace un {
 
 
-extern bool deploy( char *error, size_t len );
+// - how much of a kernel's feedback profile still matches its sources
+typedef struct {
+	int  num_units;         // - units in the kernel
+	int  num_covered;       // - units unchanged since the profile was trained
+	bool is_trained;        // - the profile was too stale and was retrained
+} deploy_pgo_t;
+
+
+// - where the time of a link-time optimized deploy went, `jobs` is zero
+//   when the kernel didn't need to be linked
+typedef struct {
+	int    jobs;            // - partitions optimized in parallel
+	double compile_secs;    // - compiling every unit to an LTO object
+	double link_secs;       // - the whole link
+	double wpa_secs;        // - whole-program analysis, if reported
+	double ltrans_secs;     // - code generation summed over partitions
+	bool   is_cached;       // - unchanged modules can be reused by the link
+} deploy_lto_t;
+
+
+// - deployment options, zeroed for the defaults
+typedef struct {
+	bool         is_keep_going; // - compile every unit despite failures
+	bool         is_profile;    // - compile every unit with time traces
+	bool         is_lto;        // - optimize the kernel at link time
+	const char   *variants;     // - comma-separated configurations to deploy
+	const char   *pgo_cmd;      // - workload that trains a PGO kernel
+	deploy_pgo_t *pgo;          // - (optional) reports the profile used
+	deploy_lto_t *lto;          // - (optional) reports the link phases
+} deploy_opts_t;
+
+
+// - `is_changed` (optional) reports whether the kernel binary was replaced
+extern bool deploy( char *error, size_t len, bool *is_changed = nullptr,
+                    const deploy_opts_t *opts = nullptr );
 extern int deploy_status( void );
 
+// - journals changes for status and deploy, only returning on failure
+extern bool deploy_monitor( char *error, size_t len );
+
+// - the same monitor for a caller that polls deploy_monitor_fd() among its
+//   own descriptors and updates whenever it is readable
+typedef struct deploy_monitor_s deploy_monitor_t;
+extern deploy_monitor_t *deploy_monitor_open( char *error, size_t len );
+extern int              deploy_monitor_fd( const deploy_monitor_t *mon );
+extern bool             deploy_monitor_update( deploy_monitor_t *mon,
+                                               int timeout_ms, char *error,
+                                               size_t len );
+extern void             deploy_monitor_close( deploy_monitor_t *mon );
+extern bool deploy_cache( char *dir, size_t len, long long *budget );
+
 
 }
 #endif /* UNUM_DEPLOY_H */
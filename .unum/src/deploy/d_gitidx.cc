@@ -0,0 +1,459 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "d_gitidx.h"
+
+/*
+ *  <index-entry>
+ *
+ *  ctime, mtime        - seconds and nanoseconds, 32 bits each
+ *  dev, ino, mode      - 32 bits each
+ *  uid, gid, size      - 32 bits each, the size truncated
+ *  oid                 - 20 bytes, or 32 in a SHA-256 repository
+ *  flags               - 16 bits, assume-valid, extended, stage, name length
+ *  extended flags      - 16 bits, only when flagged in version 3 and later
+ *  name                - NUL-terminated and padded to 8 bytes in versions
+ *                        2 and 3.  Version 4 drops a number of bytes from
+ *                        the end of the previous name, as a varint, and
+ *                        appends an unpadded NUL-terminated suffix.
+ *
+ *  Every integer is big-endian.  Entries are sorted by name, then stage.
+ */
+
+#define IDX_HDR_LEN      12
+#define IDX_STAT_LEN     40
+#define IDX_ASSUME_VALID 0x8000
+#define IDX_EXTENDED     0x4000
+#define IDX_STAGE        0x3000
+#define IDX_NAME_MASK    0x0FFF
+#define IDX_SKIP_TREE    0x4000
+#define IDX_INTENT_ADD   0x2000
+
+struct un::gitidx_s {
+	void                *base;
+	size_t              len;
+	int                 version;
+	size_t              oid_len;
+	uint32_t            num_entries;
+	const unsigned char **entries;  // - the stat data of each entry
+	const char          **names;
+	uint32_t            *name_lens;
+	char                *arena;     // - expanded version 4 names
+	char                *prefix;    // - the root within the work tree
+	size_t              prefix_len;
+	int64_t             mtime_s;    // - when the index was written
+	int64_t             mtime_ns;
+};
+
+
+static uint32_t be32( const unsigned char *p ) {
+	return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) |
+	       ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+
+static uint16_t be16( const unsigned char *p ) {
+	return (uint16_t) ((p[0] << 8) | p[1]);
+}
+
+
+static void stat_times( const struct stat *st, int64_t *m_s, int64_t *m_ns,
+                        int64_t *c_s, int64_t *c_ns ) {
+#if UNUM_OS_MACOS
+	*m_s  = st->st_mtimespec.tv_sec;
+	*m_ns = st->st_mtimespec.tv_nsec;
+	*c_s  = st->st_ctimespec.tv_sec;
+	*c_ns = st->st_ctimespec.tv_nsec;
+#else
+	*m_s  = st->st_mtim.tv_sec;
+	*m_ns = st->st_mtim.tv_nsec;
+	*c_s  = st->st_ctim.tv_sec;
+	*c_ns = st->st_ctim.tv_nsec;
+#endif
+}
+
+
+// ...the first line of a small file, NULL if it can't be read
+static char *read_line( const char *path ) {
+	char buf[PATH_MAX + 16];
+	FILE *fp = std::fopen(path, "r");
+	bool ok  = fp && std::fgets(buf, sizeof(buf), fp);
+	
+	if (fp) {
+		std::fclose(fp);
+	}
+	if (!ok) {
+		return NULL;
+	}
+	
+	buf[std::strcspn(buf, "\r\n")] = '\0';
+	return strdup(buf);
+}
+
+
+/*
+ *  The work tree is the nearest directory above the root with a .git,
+ *  which is either the git directory or, for linked work trees and
+ *  submodules, a file naming it.
+ */
+static char *find_git_dir( const char *root, char **prefix ) {
+	char        dir[PATH_MAX], path[PATH_MAX + 8];
+	struct stat s;
+	
+	if (!realpath(root, dir)) {
+		return NULL;
+	}
+	
+	for (;;) {
+		char *slash;
+		
+		std::snprintf(path, sizeof(path), "%s/.git", *dir ? dir : "");
+		if (stat(path, &s) == 0) {
+			const char *rel;
+			char       full[PATH_MAX];
+			char       *git = NULL, *line;
+			
+			if (S_ISDIR(s.st_mode)) {
+				git = strdup(path);
+			
+			} else if ((line = read_line(path))) {
+				if (!std::strncmp(line, "gitdir: ", 8)) {
+					if (line[8] == '/') {
+						git = strdup(line + 8);
+					} else {
+						std::snprintf(full, sizeof(full), "%s/%s", dir,
+						              line + 8);
+						git = strdup(full);
+					}
+				}
+				std::free(line);
+			}
+			
+			if (!git || !realpath(root, full)) {
+				std::free(git);
+				return NULL;
+			}
+			
+			rel     = full + std::strlen(dir);
+			rel    += (*rel == '/') ? 1 : 0;
+			*prefix = (char *) std::malloc(std::strlen(rel) + 2);
+			std::strcpy(*prefix, rel);
+			if (*rel) {
+				std::strcat(*prefix, "/");
+			}
+			return git;
+		}
+		
+		if (!(slash = std::strrchr(dir, '/')) || !*dir) {
+			return NULL;
+		}
+		*slash = '\0';
+	}
+}
+
+
+// ...a SHA-256 repository declares itself in the shared configuration
+static size_t oid_length( const char *git_dir ) {
+	char   path[PATH_MAX + 32], line[512];
+	char   *common = NULL;
+	size_t ret     = 20;
+	FILE   *fp;
+	
+	std::snprintf(path, sizeof(path), "%s/commondir", git_dir);
+	if ((common = read_line(path))) {
+		std::snprintf(path, sizeof(path), "%s%s%s/config",
+		              common[0] == '/' ? "" : git_dir,
+		              common[0] == '/' ? "" : "/", common);
+		std::free(common);
+	} else {
+		std::snprintf(path, sizeof(path), "%s/config", git_dir);
+	}
+	
+	if (!(fp = std::fopen(path, "r"))) {
+		return ret;
+	}
+	
+	while (std::fgets(line, sizeof(line), fp)) {
+		if (std::strstr(line, "objectformat") && std::strstr(line, "sha256")) {
+			ret = 32;
+		}
+	}
+	std::fclose(fp);
+	return ret;
+}
+
+
+// - git's offset encoding, which adds one for every continuation byte
+static bool read_varint( const unsigned char **pos, const unsigned char *end,
+                         uint64_t *out ) {
+	const unsigned char *p = *pos;
+	uint64_t            val;
+	
+	if (p >= end) {
+		return false;
+	}
+	
+	val = *p & 127;
+	while (*p++ & 128) {
+		if (p >= end || val > (UINT64_MAX >> 8)) {
+			return false;
+		}
+		val = ((val + 1) << 7) | (*p & 127);
+	}
+	
+	*pos = p;
+	*out = val;
+	return true;
+}
+
+
+static bool parse_entries( un::gitidx_t *git ) {
+	const unsigned char *pos = (const unsigned char *) git->base + IDX_HDR_LEN;
+	const unsigned char *end = (const unsigned char *) git->base + git->len;
+	size_t              arena_len = 0, arena_cap = 0, prev_len = 0;
+	size_t              *offsets  = NULL;
+	
+	git->entries   = (const unsigned char **) std::calloc(
+	                 git->num_entries + 1, sizeof(*git->entries));
+	git->names     = (const char **) std::calloc(git->num_entries + 1,
+	                                             sizeof(*git->names));
+	git->name_lens = (uint32_t *) std::calloc(git->num_entries + 1,
+	                                          sizeof(uint32_t));
+	if (git->version == 4) {
+		offsets = (size_t *) std::calloc(git->num_entries + 1, sizeof(size_t));
+	}
+	if (!git->entries || !git->names || !git->name_lens ||
+	    (git->version == 4 && !offsets)) {
+		std::free(offsets);
+		return false;
+	}
+	
+	for (uint32_t i = 0; i < git->num_entries; i++) {
+		const unsigned char *name, *nul;
+		size_t              fixed = IDX_STAT_LEN + git->oid_len + 2;
+		size_t              len;
+		uint16_t            flags;
+		uint64_t            strip;
+		
+		if (pos > end || (size_t) (end - pos) < fixed + 2) {
+			std::free(offsets);
+			return false;
+		}
+		
+		flags = be16(pos + IDX_STAT_LEN + git->oid_len);
+		if ((flags & IDX_EXTENDED) && git->version >= 3) {
+			fixed += 2;
+		}
+		git->entries[i] = pos;
+		name            = pos + fixed;
+		
+		if (git->version < 4) {
+			if (!(nul = (const unsigned char *) std::memchr(name, 0,
+			                                                end - name))) {
+				return false;
+			}
+			
+			len               = (size_t) (nul - name);
+			git->names[i]     = (const char *) name;
+			git->name_lens[i] = (uint32_t) len;
+			pos              += (fixed + len + 8) & ~(size_t) 7;
+			continue;
+		}
+		
+		// - version 4 names are rebuilt from the one before
+		if (!read_varint(&name, end, &strip) || strip > prev_len ||
+		    !(nul = (const unsigned char *) std::memchr(name, 0, end - name))) {
+			std::free(offsets);
+			return false;
+		}
+		
+		len = prev_len - (size_t) strip + (size_t) (nul - name);
+		if (arena_len + len + 1 > arena_cap) {
+			char *tmp;
+			
+			arena_cap = (arena_len + len + 1) * 2;
+			if (!(tmp = (char *) std::realloc(git->arena, arena_cap))) {
+				std::free(offsets);
+				return false;
+			}
+			git->arena = tmp;
+		}
+		
+		if (i) {
+			std::memmove(git->arena + arena_len, git->arena + offsets[i - 1],
+			             prev_len - (size_t) strip);
+		}
+		std::memcpy(git->arena + arena_len + prev_len - strip, name,
+		            (size_t) (nul - name) + 1);
+		offsets[i]        = arena_len;
+		git->name_lens[i] = (uint32_t) len;
+		arena_len        += len + 1;
+		prev_len          = len;
+		pos               = nul + 1;
+	}
+	
+	// - the arena moved as it grew so names are only resolved at the end
+	for (uint32_t i = 0; offsets && i < git->num_entries; i++) {
+		git->names[i] = git->arena + offsets[i];
+	}
+	
+	std::free(offsets);
+	return true;
+}
+
+
+un::gitidx_t *un::gitidx_open( const char *root ) {
+	char                *prefix = NULL, *git_dir, path[PATH_MAX + 8];
+	gitidx_t            *git;
+	const unsigned char *hdr;
+	struct stat         s;
+	int                 fd;
+	int64_t             c_s, c_ns;
+	
+	if (!(git_dir = find_git_dir(root, &prefix))) {
+		return NULL;
+	}
+	
+	std::snprintf(path, sizeof(path), "%s/index", git_dir);
+	if (!(git = (gitidx_t *) std::calloc(1, sizeof(gitidx_t))) ||
+	    (fd = open(path, O_RDONLY)) < 0) {
+		std::free(git);
+		std::free(git_dir);
+		std::free(prefix);
+		return NULL;
+	}
+	
+	git->prefix     = prefix;
+	git->prefix_len = std::strlen(prefix);
+	git->oid_len    = oid_length(git_dir);
+	std::free(git_dir);
+	
+	if (fstat(fd, &s) != 0 || s.st_size < IDX_HDR_LEN ||
+	    (git->base = mmap(NULL, (size_t) s.st_size, PROT_READ, MAP_PRIVATE, fd,
+	                      0)) == MAP_FAILED) {
+		git->base = NULL;
+		close(fd);
+		gitidx_close(git);
+		return NULL;
+	}
+	
+	close(fd);
+	git->len = (size_t) s.st_size;
+	stat_times(&s, &git->mtime_s, &git->mtime_ns, &c_s, &c_ns);
+	
+	hdr              = (const unsigned char *) git->base;
+	git->version     = (int) be32(hdr + 4);
+	git->num_entries = be32(hdr + 8);
+	if (std::memcmp(hdr, "DIRC", 4) || git->version < 2 || git->version > 4 ||
+	    git->num_entries > git->len / (IDX_STAT_LEN + 4) ||
+	    !parse_entries(git)) {
+		gitidx_close(git);
+		return NULL;
+	}
+	
+	return git;
+}
+
+
+void un::gitidx_close( gitidx_t *git ) {
+	if (!git) {
+		return;
+	}
+	
+	if (git->base) {
+		munmap(git->base, git->len);
+	}
+	std::free(git->entries);
+	std::free(git->names);
+	std::free(git->name_lens);
+	std::free(git->arena);
+	std::free(git->prefix);
+	std::free(git);
+}
+
+
+static int name_cmp( const char *a, size_t a_len, const char *b,
+                     size_t b_len ) {
+	int ret = std::memcmp(a, b, a_len < b_len ? a_len : b_len);
+	return ret ? ret : (a_len < b_len ? -1 : (a_len > b_len ? 1 : 0));
+}
+
+
+bool un::gitidx_lookup( const gitidx_t *git, const char *path,
+                        const struct stat *st,
+                        unsigned char oid[UNUM_GIT_OID_MAX] ) {
+	char                key[PATH_MAX];
+	size_t              key_len;
+	uint32_t            lo = 0, hi;
+	const unsigned char *e;
+	int64_t             m_s, m_ns, c_s, c_ns, e_s, e_ns;
+	uint16_t            flags, ext;
+	
+	if (!git || !path || !st) {
+		return false;
+	}
+	
+	while (path[0] == '.' && path[1] == '/') {
+		path += 2;
+	}
+	if (*path == '/' ||
+	    std::snprintf(key, sizeof(key), "%s%s", git->prefix, path) >=
+	    (int) sizeof(key)) {
+		return false;
+	}
+	key_len = std::strlen(key);
+	
+	for (hi = git->num_entries; lo < hi;) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		if (name_cmp(git->names[mid], git->name_lens[mid], key, key_len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	
+	if (lo == git->num_entries ||
+	    name_cmp(git->names[lo], git->name_lens[lo], key, key_len)) {
+		return false;
+	}
+	
+	e = git->entries[lo];
+	flags = be16(e + IDX_STAT_LEN + git->oid_len);
+	ext   = ((flags & IDX_EXTENDED) && git->version >= 3) ?
+	                 be16(e + IDX_STAT_LEN + git->oid_len + 2) : 0;
+	if ((flags & (IDX_ASSUME_VALID | IDX_STAGE)) ||
+	    (ext & (IDX_SKIP_TREE | IDX_INTENT_ADD))) {
+		return false;
+	}
+	
+	// - git's own test, and an entry as new as the index may be racy
+	stat_times(st, &m_s, &m_ns, &c_s, &c_ns);
+	e_s  = be32(e + 8);
+	e_ns = be32(e + 12);
+	if (be32(e) != (uint32_t) c_s || be32(e + 4) != (uint32_t) c_ns ||
+	    e_s != (int64_t) (uint32_t) m_s || e_ns != m_ns ||
+	    be32(e + 20) != (uint32_t) st->st_ino ||
+	    be32(e + 36) != (uint32_t) st->st_size ||
+	    (be32(e + 24) & S_IFMT) != ((uint32_t) st->st_mode & S_IFMT) ||
+	    e_s > git->mtime_s || (e_s == git->mtime_s && e_ns >= git->mtime_ns)) {
+		return false;
+	}
+	
+	std::memset(oid, 0, UNUM_GIT_OID_MAX);
+	std::memcpy(oid, e + IDX_STAT_LEN, git->oid_len);
+	return true;
+}
@@ -0,0 +1,46 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_GITIDX_H
+#define UNUM_GITIDX_H
+
+#include <sys/stat.h>
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  The git index holds the stat data and blob id of every tracked file as
+ *  of when git last verified it.  It is read in place, in versions 2 to 4,
+ *  so that a file whose stat still matches can be identified by its blob
+ *  without being read or the git binary being run.
+ */
+#define UNUM_GIT_OID_MAX  32
+
+typedef struct gitidx_s gitidx_t;
+
+
+// - `root` is any directory inside the work tree, NULL if there is no index
+extern gitidx_t *gitidx_open( const char *root );
+extern void     gitidx_close( gitidx_t *git );
+
+
+/*
+ *  gitidx_lookup()
+ *  - finds the blob id of `path`, relative to the root given to open,
+ *    when git would consider the file described by `st` unchanged.  Racily
+ *    clean, conflicted, assumed and sparse entries are never trusted.
+ */
+extern bool     gitidx_lookup( const gitidx_t *git, const char *path,
+                               const struct stat *st,
+                               unsigned char oid[UNUM_GIT_OID_MAX] );
+
+
+}
+#endif /* UNUM_GITIDX_H */
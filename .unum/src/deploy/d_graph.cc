@@ -0,0 +1,405 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "d_graph.h"
+
+/*
+ *  <graph-layout>
+ *
+ *  header              - magic, node, edge and table counts, string bytes
+ *  nodes[n]            - modification time, size, path offset, flags, 
+ *                        the blob id of tracked files and the token 
+ *                        fingerprint
+ *  fwd_index[n+1]      - the includes of node i are fwd_edges[fwd_index[i]]
+ *  fwd_edges[e]          up to fwd_edges[fwd_index[i+1]]
+ *  rev_index[n+1]      - the same for the files that include node i
+ *  rev_edges[e]
+ *  table[cap]          - open addressed path lookup, node ids plus one
+ *  strings             - NUL-terminated paths
+ *
+ *  Every section begins on an 8-byte boundary.  The graph is a local cache
+ *  so it is kept in the native byte order and discarded when it doesn't fit.
+ */
+
+#define GRAPH_MAGIC  "UGR3"
+
+typedef struct {
+	char     magic[4];
+	uint32_t num_nodes;
+	uint32_t num_edges;
+	uint32_t table_cap;
+	uint64_t str_len;
+} graph_hdr_t;
+
+typedef enum {
+	SEC_NODES = 0,
+	SEC_FWD_INDEX,
+	SEC_FWD_EDGES,
+	SEC_REV_INDEX,
+	SEC_REV_EDGES,
+	SEC_TABLE,
+	SEC_STRINGS,
+	
+	SEC_COUNT
+} graph_sec_e;
+
+
+static uint32_t path_hash( const char *path ) {
+	uint32_t h = 2166136261u;
+	
+	for (; *path; path++) {
+		h = (h ^ (unsigned char) *path) * 16777619u;
+	}
+	
+	return h;
+}
+
+
+static const char *norm_path( const char *path ) {
+	while (path[0] == '.' && path[1] == '/') {
+		path += 2;
+	}
+	return path;
+}
+
+
+// ...returns the total size with the offset of each section
+static uint64_t layout( const graph_hdr_t *hdr, uint64_t *off ) {
+	uint64_t n   = hdr->num_nodes, e = hdr->num_edges;
+	uint64_t len[SEC_COUNT] = {
+		n * sizeof(un::graph_node_t),
+		(n + 1) * sizeof(uint32_t),
+		e * sizeof(uint32_t),
+		(n + 1) * sizeof(uint32_t),
+		e * sizeof(uint32_t),
+		(uint64_t) hdr->table_cap * sizeof(uint32_t),
+		hdr->str_len
+	};
+	uint64_t pos = sizeof(graph_hdr_t);
+	
+	for (int i = 0; i < SEC_COUNT; i++) {
+		off[i] = pos;
+		pos    = (pos + len[i] + 7) & ~(uint64_t) 7;
+	}
+	
+	return pos;
+}
+
+
+// ...points the graph into a buffer, checking what can be checked cheaply
+static bool attach( un::graph_t *graph, void *base, size_t len ) {
+	const graph_hdr_t *hdr = (const graph_hdr_t *) base;
+	const char        *bp  = (const char *) base;
+	uint64_t          off[SEC_COUNT];
+	
+	if (len < sizeof(graph_hdr_t) ||
+	    std::memcmp(hdr->magic, GRAPH_MAGIC, sizeof(hdr->magic)) ||
+	    !hdr->table_cap || (hdr->table_cap & (hdr->table_cap - 1)) ||
+	    hdr->table_cap < hdr->num_nodes || !hdr->str_len ||
+	    hdr->str_len > len || layout(hdr, off) != len) {
+		return false;
+	}
+	
+	graph->num_nodes = hdr->num_nodes;
+	graph->num_edges = hdr->num_edges;
+	graph->table_cap = hdr->table_cap;
+	graph->nodes     = (const un::graph_node_t *) (bp + off[SEC_NODES]);
+	graph->fwd_index = (const uint32_t *) (bp + off[SEC_FWD_INDEX]);
+	graph->fwd_edges = (const uint32_t *) (bp + off[SEC_FWD_EDGES]);
+	graph->rev_index = (const uint32_t *) (bp + off[SEC_REV_INDEX]);
+	graph->rev_edges = (const uint32_t *) (bp + off[SEC_REV_EDGES]);
+	graph->table     = (const uint32_t *) (bp + off[SEC_TABLE]);
+	graph->strings   = bp + off[SEC_STRINGS];
+	graph->str_len   = (size_t) hdr->str_len;
+	graph->base      = base;
+	graph->len       = len;
+	
+	return graph->fwd_index[graph->num_nodes] == graph->num_edges &&
+	       graph->rev_index[graph->num_nodes] == graph->num_edges &&
+	       graph->strings[hdr->str_len - 1] == '\0';
+}
+
+
+// ...only while the file is as it was scanned
+static bool is_tracked( const un::gitidx_t *git, const un::scan_info_t *info,
+                        uint8_t *oid ) {
+	struct stat s;
+	
+	return stat(info->path, &s) == 0 && s.st_mtime == info->mtime &&
+	       (long long) s.st_size == info->size &&
+	       un::gitidx_lookup(git, info->path, &s, oid);
+}
+
+
+bool un::graph_build( scan_t *scan, const char **units, const gitidx_t *git,
+                      graph_t *graph ) {
+	int          count   = scan_count(scan);
+	int          *id_map = (int *) std::malloc(sizeof(int) * (count ? count : 1));
+	uint32_t     *cursor = NULL;
+	graph_hdr_t  hdr;
+	uint64_t     off[SEC_COUNT], total, str_pos = 0;
+	char         *bp;
+	graph_node_t *nodes;
+	uint32_t     *fwd_index, *fwd_edges, *rev_index, *rev_edges, *table;
+	
+	std::memset(graph, 0, sizeof(*graph));
+	std::memset(&hdr, 0, sizeof(hdr));
+	std::memcpy(hdr.magic, GRAPH_MAGIC, sizeof(hdr.magic));
+	if (!id_map) {
+		return false;
+	}
+	
+	// - only files that exist are kept, the rest belong to the toolchain
+	for (int i = 0; i < count; i++) {
+		scan_info_t info;
+		
+		scan_info(scan, i, &info);
+		id_map[i] = info.is_found ? (int) hdr.num_nodes++ : -1;
+		if (info.is_found) {
+			hdr.num_edges += (uint32_t) info.num_edges;
+			hdr.str_len   += std::strlen(info.path) + 1;
+		}
+	}
+	
+	hdr.str_len   = hdr.str_len ? hdr.str_len : 1;
+	hdr.table_cap = 16;
+	while (hdr.table_cap < (uint64_t) hdr.num_nodes * 2) {
+		hdr.table_cap *= 2;
+	}
+	
+	total = layout(&hdr, off);
+	if (!(bp = (char *) std::calloc(1, (size_t) total)) ||
+	    !(cursor = (uint32_t *) std::calloc(hdr.num_nodes + 1,
+	                                        sizeof(uint32_t)))) {
+		std::free(bp);
+		std::free(id_map);
+		return false;
+	}
+	
+	std::memcpy(bp, &hdr, sizeof(hdr));
+	nodes     = (graph_node_t *) (bp + off[SEC_NODES]);
+	fwd_index = (uint32_t *) (bp + off[SEC_FWD_INDEX]);
+	fwd_edges = (uint32_t *) (bp + off[SEC_FWD_EDGES]);
+	rev_index = (uint32_t *) (bp + off[SEC_REV_INDEX]);
+	rev_edges = (uint32_t *) (bp + off[SEC_REV_EDGES]);
+	table     = (uint32_t *) (bp + off[SEC_TABLE]);
+	
+	// - forward rows are written in order while counting each in-degree
+	for (int i = 0; i < count; i++) {
+		scan_info_t  info;
+		graph_node_t *node;
+		uint32_t     id, slot;
+		
+		if (id_map[i] < 0) {
+			continue;
+		}
+		
+		scan_info(scan, i, &info);
+		id          = (uint32_t) id_map[i];
+		node        = &nodes[id];
+		node->mtime = (int64_t) info.mtime;
+		node->size  = (int64_t) info.size;
+		node->path  = (uint32_t) str_pos;
+		if (git && is_tracked(git, &info, node->oid)) {
+			node->flags |= GN_GIT;
+		}
+		if (info.is_scanned) {
+			node->tokens  = info.tokens;
+			node->flags  |= GN_LEX;
+		}
+		std::strcpy(bp + off[SEC_STRINGS] + str_pos, info.path);
+		str_pos    += std::strlen(info.path) + 1;
+		
+		for (slot = path_hash(info.path) & (hdr.table_cap - 1); table[slot];
+		     slot = (slot + 1) & (hdr.table_cap - 1)) {}
+		table[slot] = id + 1;
+		
+		fwd_index[id + 1] = fwd_index[id];
+		for (int j = 0; j < info.num_edges; j++) {
+			uint32_t to = (uint32_t) id_map[info.edges[j]];
+			fwd_edges[fwd_index[id + 1]++] = to;
+			rev_index[to + 1]++;
+		}
+	}
+	
+	for (uint32_t i = 0; i < hdr.num_nodes; i++) {
+		rev_index[i + 1] += rev_index[i];
+		cursor[i]         = rev_index[i];
+	}
+	for (uint32_t i = 0; i < hdr.num_nodes; i++) {
+		for (uint32_t j = fwd_index[i]; j < fwd_index[i + 1]; j++) {
+			rev_edges[cursor[fwd_edges[j]]++] = i;
+		}
+	}
+	
+	std::free(cursor);
+	std::free(id_map);
+	
+	if (!attach(graph, bp, (size_t) total)) {
+		std::free(bp);
+		std::memset(graph, 0, sizeof(*graph));
+		return false;
+	}
+	
+	for (; units && *units; units++) {
+		uint32_t id = graph_find(graph, *units);
+		if (id != UNUM_GRAPH_NONE) {
+			nodes[id].flags |= GN_UNIT;
+		}
+	}
+	
+	return true;
+}
+
+
+// ...replaces the file atomically so a reader never maps a partial graph
+bool un::graph_save( const graph_t *graph, const char *path ) {
+	char tmp[PATH_MAX];
+	int  fd;
+	bool ok;
+	
+	if (!graph->base ||
+	    std::snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", path, (long) getpid()) >=
+	    (int) sizeof(tmp) ||
+	    (fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR)) < 0) {
+		return false;
+	}
+	
+	ok = write(fd, graph->base, graph->len) == (ssize_t) graph->len;
+	ok = (close(fd) == 0) && ok;
+	if (!ok || rename(tmp, path) != 0) {
+		unlink(tmp);
+		return false;
+	}
+	
+	return true;
+}
+
+
+bool un::graph_load( const char *path, graph_t *graph ) {
+	struct stat s;
+	void        *base;
+	int         fd = open(path, O_RDONLY);
+	
+	std::memset(graph, 0, sizeof(*graph));
+	if (fd < 0) {
+		return false;
+	}
+	
+	if (fstat(fd, &s) != 0 || s.st_size <= 0 ||
+	    (base = mmap(NULL, (size_t) s.st_size, PROT_READ, MAP_PRIVATE, fd,
+	                 0)) == MAP_FAILED) {
+		close(fd);
+		return false;
+	}
+	close(fd);
+	
+	if (!attach(graph, base, (size_t) s.st_size)) {
+		munmap(base, (size_t) s.st_size);
+		std::memset(graph, 0, sizeof(*graph));
+		return false;
+	}
+	
+	graph->is_mapped = true;
+	return true;
+}
+
+
+void un::graph_close( graph_t *graph ) {
+	if (graph->is_mapped) {
+		munmap(graph->base, graph->len);
+	} else {
+		std::free(graph->base);
+	}
+	std::memset(graph, 0, sizeof(*graph));
+}
+
+
+uint32_t un::graph_find( const graph_t *graph, const char *path ) {
+	uint32_t mask = graph->table_cap - 1, slot;
+	
+	if (!graph->base) {
+		return UNUM_GRAPH_NONE;
+	}
+	
+	path = norm_path(path);
+	for (slot = path_hash(path) & mask; graph->table[slot];
+	     slot = (slot + 1) & mask) {
+		uint32_t id = graph->table[slot] - 1;
+		if (id < graph->num_nodes && !std::strcmp(graph_path(graph, id), path)) {
+			return id;
+		}
+	}
+	
+	return UNUM_GRAPH_NONE;
+}
+
+
+const char *un::graph_path( const graph_t *graph, uint32_t id ) {
+	if (id >= graph->num_nodes || graph->nodes[id].path >= graph->str_len) {
+		return "";
+	}
+	return graph->strings + graph->nodes[id].path;
+}
+
+
+// ...walks the reverse edges breadth first from every given file at once
+uint32_t un::graph_dependents( const graph_t *graph, const uint32_t *ids,
+                               uint32_t num_ids, uint32_t *units,
+                               uint32_t cap ) {
+	uint32_t      n     = graph->num_nodes, head = 0, tail = 0, ret = 0;
+	unsigned char *seen = (unsigned char *) std::calloc((n + 7) / 8 + 1, 1);
+	uint32_t      *queue = (uint32_t *) std::malloc(sizeof(uint32_t) *
+	                                                (n ? n : 1));
+	
+	if (!seen || !queue) {
+		std::free(seen);
+		std::free(queue);
+		return 0;
+	}
+	
+	for (uint32_t i = 0; i < num_ids; i++) {
+		if (ids[i] < n && !(seen[ids[i] >> 3] & (1 << (ids[i] & 7)))) {
+			seen[ids[i] >> 3] |= (unsigned char) (1 << (ids[i] & 7));
+			queue[tail++]      = ids[i];
+		}
+	}
+	
+	while (head < tail) {
+		uint32_t id = queue[head++];
+		
+		if (graph->nodes[id].flags & GN_UNIT) {
+			if (ret < cap) {
+				units[ret] = id;
+			}
+			ret++;
+		}
+		
+		for (uint32_t i = graph->rev_index[id];
+		     i < graph->rev_index[id + 1] && i < graph->num_edges; i++) {
+			uint32_t from = graph->rev_edges[i];
+			if (from < n && !(seen[from >> 3] & (1 << (from & 7)))) {
+				seen[from >> 3] |= (unsigned char) (1 << (from & 7));
+				queue[tail++]    = from;
+			}
+		}
+	}
+	
+	std::free(seen);
+	std::free(queue);
+	return ret;
+}
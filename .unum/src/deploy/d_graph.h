@@ -0,0 +1,85 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_GRAPH_H
+#define UNUM_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "d_gitidx.h"
+#include "d_scan.h"
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  The build graph is the frozen form of what the scanner discovered.  
+ *  Files are numbered densely and their include edges are stored in both
+ *  directions as compressed rows, which is the same layout in memory as on 
+ *  disk so that a saved graph is usable as soon as it is mapped.
+ */
+#define UNUM_GRAPH_NONE  0xFFFFFFFFu
+
+typedef enum {
+	GN_UNIT = 0x01,         // - a source compiled on its own
+	GN_GIT  = 0x02,         // - git vouched for its content with `oid`
+	GN_LEX  = 0x04          // - `tokens` is the fingerprint it was scanned with
+} graph_node_e;
+
+typedef struct {
+	int64_t  mtime;
+	int64_t  size;
+	uint32_t path;          // - offset into the string table
+	uint32_t flags;
+	uint8_t  oid[UNUM_GIT_OID_MAX];
+	hash_t   tokens;
+} graph_node_t;
+
+typedef struct {
+	uint32_t           num_nodes;
+	uint32_t           num_edges;
+	uint32_t           table_cap;
+	const graph_node_t *nodes;
+	const uint32_t     *fwd_index;
+	const uint32_t     *fwd_edges;
+	const uint32_t     *rev_index;
+	const uint32_t     *rev_edges;
+	const uint32_t     *table;
+	const char         *strings;
+	size_t             str_len;
+	void               *base;
+	size_t             len;
+	bool               is_mapped;
+} graph_t;
+
+
+extern bool     graph_build( scan_t *scan, const char **units,
+                             const gitidx_t *git, graph_t *graph );
+extern bool     graph_save( const graph_t *graph, const char *path );
+extern bool     graph_load( const char *path, graph_t *graph );
+extern void     graph_close( graph_t *graph );
+
+extern uint32_t graph_find( const graph_t *graph, const char *path );
+extern const char *graph_path( const graph_t *graph, uint32_t id );
+
+
+/*
+ *  graph_dependents()
+ *  - finds the units that reach any of the given files, including those 
+ *    files themselves if they are units, and returns how many there are
+ *    although no more than `cap` are stored.
+ */
+extern uint32_t graph_dependents( const graph_t *graph, const uint32_t *ids,
+                                  uint32_t num_ids, uint32_t *units,
+                                  uint32_t cap );
+
+
+}
+#endif /* UNUM_GRAPH_H */
@@ -0,0 +1,740 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "d_journal.h"
+
+#if UNUM_OS_LINUX
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+/*
+ *  <journal-layout>
+ *
+ *  header              - magic, version, generation
+ *  records             - NUL-terminated paths relative to the root, in the
+ *                        order their events arrived.  Records starting
+ *                        with JOURNAL_SYNC_MARK answer a reader's sync
+ *                        request and are not changes.
+ *
+ *  The monitor holds an exclusive lock on the journal for as long as it
+ *  runs, so a journal that can be locked by a reader is abandoned.  A new
+ *  generation is written aside and renamed into place, which leaves those
+ *  reading the old one with a consistent, if stale, file.
+ */
+
+#define JOURNAL_MAGIC     "UJN1"
+#define JOURNAL_VERSION   1
+#define JOURNAL_CAP       (16 * 1024 * 1024)
+#define JOURNAL_SYNC      ".sync."
+#define JOURNAL_SYNC_MARK '\x01'
+#define SYNC_WAIT_MS      1000
+
+typedef struct {
+	char     magic[4];
+	uint32_t version;
+	uint64_t gen;
+} journal_hdr_t;
+
+typedef struct {
+	char *dir;              // - NULL once the watch is gone
+	bool is_recursive;
+} watch_t;
+
+struct un::journal_s {
+	char     *path;
+	char     *tmp;          // - where the next generation is written
+	char     *sync_name;    // - the prefix of a reader's sync request
+	int      fd;
+	int      ino_fd;
+	int      sync_wd;
+	dev_t    skip_dev;      // - the journal's own directory
+	ino_t    skip_ino;
+	bool     is_published;
+	bool     is_overflow;
+	uint64_t gen;
+	watch_t  *watches;      // - indexed by watch descriptor
+	int      num_watches;
+	char     *batch;        // - records written by one pass over the events
+	size_t   batch_len;
+	size_t   batch_cap;
+	size_t   last;          // - the most recent record, to coalesce repeats
+	int      num_batch;
+};
+
+static un::journal_t *resident = NULL;  // - the monitor running in this process
+static bool          drain( un::journal_t *jn );
+
+
+char *un::journal_norm( char *path ) {
+	const char *in  = path;
+	char       *out = path;
+	
+	if (*in == '/') {
+		*out++ = *in++;
+	}
+	
+	while (*in) {
+		const char *end;
+		size_t     len;
+		
+		while (*in == '/') {
+			in++;
+		}
+		for (end = in; *end && *end != '/'; end++) {
+		}
+		
+		len = (size_t) (end - in);
+		if (len && !(len == 1 && *in == '.')) {
+			if (out > path && out[-1] != '/') {
+				*out++ = '/';
+			}
+			std::memmove(out, in, len);
+			out += len;
+		}
+		in = end;
+	}
+	
+	if (out == path) {
+		*out++ = '.';
+	}
+	*out = '\0';
+	return path;
+}
+
+
+static char *dir_of( const char *path, const char **base ) {
+	const char *slash = std::strrchr(path, '/');
+	char       *ret;
+	
+	*base = slash ? slash + 1 : path;
+	if (!slash) {
+		return strdup(".");
+	}
+	if (slash == path) {
+		return strdup("/");
+	}
+	
+	if ((ret = (char *) std::malloc((size_t) (slash - path) + 1))) {
+		std::memcpy(ret, path, (size_t) (slash - path));
+		ret[slash - path] = '\0';
+	}
+	return ret;
+}
+
+
+// ...a live journal, -1 if none or if its monitor isn't holding it
+static int open_live( const char *path, journal_hdr_t *hdr ) {
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	
+	if (fd < 0) {
+		return -1;
+	}
+	
+	if (flock(fd, LOCK_SH | LOCK_NB) == 0 ||
+	    pread(fd, hdr, sizeof(*hdr), 0) != (ssize_t) sizeof(*hdr) ||
+	    std::memcmp(hdr->magic, JOURNAL_MAGIC, 4) ||
+	    hdr->version != JOURNAL_VERSION) {
+		close(fd);
+		return -1;
+	}
+	
+	return fd;
+}
+
+
+bool un::journal_mark( const char *path, journal_mark_t *mark ) {
+	journal_hdr_t hdr;
+	struct stat   s;
+	int           fd = open_live(path, &hdr);
+	bool          ret;
+	
+	if (fd < 0) {
+		return false;
+	}
+	
+	// - a record being written at the mark is only ever read as extra
+	ret = fstat(fd, &s) == 0;
+	if (ret) {
+		mark->gen = hdr.gen;
+		mark->pos = (uint64_t) s.st_size;
+	}
+	close(fd);
+	return ret;
+}
+
+
+// ...everything written after `pos`, appending to what was read before
+static bool read_tail( int fd, uint64_t pos, char **buf, size_t *len ) {
+	struct stat s;
+	size_t      want;
+	ssize_t     rc;
+	char        *tmp;
+	
+	if (fstat(fd, &s) != 0 || (uint64_t) s.st_size < pos) {
+		return false;
+	}
+	
+	want = (size_t) ((uint64_t) s.st_size - pos);
+	if (want <= *len) {
+		return true;
+	}
+	
+	if (!(tmp = (char *) std::realloc(*buf, want + 1))) {
+		return false;
+	}
+	*buf = tmp;
+	
+	while (*len < want) {
+		rc = pread(fd, *buf + *len, want - *len, (off_t) (pos + *len));
+		if (rc <= 0) {
+			return rc == 0;
+		}
+		*len += (size_t) rc;
+	}
+	return true;
+}
+
+
+/*
+ *  Events are delivered to the monitor asynchronously, so a file saved
+ *  just before the read may not be journaled yet.  The reader creates a
+ *  file beside the journal and waits for the monitor to record it, and
+ *  because one inotify queue is delivered in order, everything before the
+ *  request has been recorded by then.
+ */
+bool un::journal_read( const char *path, const journal_mark_t *mark,
+                       journal_log_t *log ) {
+	static unsigned counter = 0;
+	journal_hdr_t   hdr;
+	const char      *base;
+	char            *dir, sync[PATH_MAX], want[NAME_MAX + 2];
+	char            *buf  = NULL;
+	size_t          len   = 0, found = (size_t) -1, start = 0, next = 0;
+	struct stat     s, cur;
+	struct timespec ms = { 0, 1000000 };
+	int             fd, sfd;
+	
+	std::memset(log, 0, sizeof(*log));
+	if ((fd = open_live(path, &hdr)) < 0) {
+		return false;
+	}
+	
+	if (hdr.gen != mark->gen || !(dir = dir_of(path, &base))) {
+		close(fd);
+		return false;
+	}
+	
+	// - the monitor in this process can simply be asked to catch up
+	if (resident && !std::strcmp(resident->path, path)) {
+		std::free(dir);
+		if (drain(resident) && resident->gen == mark->gen &&
+		    read_tail(fd, mark->pos, &buf, &len)) {
+			found = len;
+		}
+		close(fd);
+		
+	} else {
+		std::snprintf(want, sizeof(want), "%c%s%s%ld.%u", JOURNAL_SYNC_MARK,
+		              base, JOURNAL_SYNC, (long) getpid(), counter++);
+		std::snprintf(sync, sizeof(sync), "%s/%s", dir, want + 1);
+		std::free(dir);
+		
+		if ((sfd = open(sync, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+		                0644)) < 0) {
+			close(fd);
+			return false;
+		}
+		close(sfd);
+		
+		for (int waited = 0; waited < SYNC_WAIT_MS; waited++) {
+			if (!read_tail(fd, mark->pos, &buf, &len)) {
+				break;
+			}
+			
+			// - only complete records are compared, each of them once
+			for (; next < len && found == (size_t) -1; next++) {
+				if (buf[next] != '\0') {
+					continue;
+				}
+				if (!std::strcmp(buf + start, want)) {
+					found = start;
+				}
+				start = next + 1;
+			}
+			
+			// - a new generation is never going to answer
+			if (found != (size_t) -1 || fstat(fd, &cur) != 0 ||
+			    stat(path, &s) != 0 || s.st_ino != cur.st_ino) {
+				break;
+			}
+			
+			nanosleep(&ms, NULL);
+		}
+		
+		unlink(sync);
+		close(fd);
+	}
+	
+	if (found == (size_t) -1) {
+		std::free(buf);
+		return false;
+	}
+	
+	// - other readers' requests are dropped, the rest are changes
+	log->paths = buf;
+	for (size_t i = 0; i < found;) {
+		size_t rec = std::strlen(buf + i) + 1;
+		if (buf[i] != JOURNAL_SYNC_MARK) {
+			std::memmove(log->paths + log->len, buf + i, rec);
+			log->len += rec;
+			log->num_paths++;
+		}
+		i += rec;
+	}
+	return true;
+}
+
+
+void un::journal_free( journal_log_t *log ) {
+	std::free(log->paths);
+	std::memset(log, 0, sizeof(*log));
+}
+
+
+#if UNUM_OS_LINUX
+
+#define WATCH_EVENTS  (IN_MODIFY | IN_ATTRIB | IN_CREATE | IN_DELETE | \
+                       IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF | \
+                       IN_ONLYDIR)
+
+
+static bool new_generation( un::journal_t *jn ) {
+	journal_hdr_t   hdr;
+	struct timespec ts;
+	int             fd;
+	
+	fd = open(jn->tmp, O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC,
+	          0644);
+	if (fd < 0) {
+		return false;
+	}
+	
+	clock_gettime(CLOCK_REALTIME, &ts);
+	std::memset(&hdr, 0, sizeof(hdr));
+	std::memcpy(hdr.magic, JOURNAL_MAGIC, 4);
+	hdr.version = JOURNAL_VERSION;
+	hdr.gen     = ((uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec) ^
+	              ((uint64_t) getpid() << 44);
+	hdr.gen     = (hdr.gen == jn->gen) ? hdr.gen + 1 : hdr.gen;
+	
+	if (flock(fd, LOCK_EX | LOCK_NB) != 0 ||
+	    write(fd, &hdr, sizeof(hdr)) != (ssize_t) sizeof(hdr) ||
+	    (jn->is_published && rename(jn->tmp, jn->path) != 0)) {
+		close(fd);
+		unlink(jn->tmp);
+		return false;
+	}
+	
+	if (jn->fd >= 0) {
+		close(jn->fd);
+	}
+	jn->fd          = fd;
+	jn->gen         = hdr.gen;
+	jn->is_overflow = false;
+	return true;
+}
+
+
+static bool add_record( un::journal_t *jn, const char *dir, const char *name,
+                        char mark ) {
+	size_t len = (mark ? 1 : 0) + (dir ? std::strlen(dir) + 1 : 0) +
+	             std::strlen(name) + 1;
+	char   *rec;
+	
+	if (jn->batch_len + len > jn->batch_cap) {
+		size_t cap = (jn->batch_len + len) * 2;
+		char   *tmp = (char *) std::realloc(jn->batch, cap);
+		if (!tmp) {
+			return false;
+		}
+		jn->batch     = tmp;
+		jn->batch_cap = cap;
+	}
+	
+	rec = jn->batch + jn->batch_len;
+	std::snprintf(rec, len, "%s%s%s%s", mark ? "\x01" : "", dir ? dir : "",
+	              dir ? "/" : "", name);
+	un::journal_norm(rec + (mark ? 1 : 0));
+	len = std::strlen(rec) + 1;
+	
+	// - a save is usually several events for the same file
+	if (jn->num_batch && !std::strcmp(jn->batch + jn->last, rec)) {
+		return true;
+	}
+	
+	jn->last       = jn->batch_len;
+	jn->batch_len += len;
+	jn->num_batch++;
+	return true;
+}
+
+
+static bool add_watch( un::journal_t *jn, const char *dir, bool is_recursive ) {
+	int     wd = inotify_add_watch(jn->ino_fd, dir, WATCH_EVENTS);
+	watch_t *w;
+	
+	if (wd < 0) {
+		return false;
+	}
+	
+	if (wd >= jn->num_watches) {
+		int     num = wd * 2 + 16;
+		watch_t *tmp = (watch_t *) std::realloc(jn->watches,
+		                                        sizeof(watch_t) * num);
+		if (!tmp) {
+			return false;
+		}
+		std::memset(tmp + jn->num_watches, 0,
+		            sizeof(watch_t) * (num - jn->num_watches));
+		jn->watches     = tmp;
+		jn->num_watches = num;
+	}
+	
+	// - the same directory by another name keeps its first one
+	w                = &jn->watches[wd];
+	w->is_recursive |= is_recursive;
+	if (!w->dir && !(w->dir = strdup(dir))) {
+		return false;
+	}
+	un::journal_norm(w->dir);
+	return true;
+}
+
+
+/*
+ *  A directory is watched before it is listed so that nothing created in
+ *  it can be missed, and when it appeared after the monitor started all
+ *  of its files are journaled since their own events came too early.
+ */
+static bool add_tree( un::journal_t *jn, const char *dir, bool is_recursive,
+                      bool is_new ) {
+	DIR           *dirp;
+	struct dirent *ditem;
+	struct stat   s;
+	char          path[PATH_MAX];
+	bool          ret = true;
+	
+	if (stat(dir, &s) != 0 || !S_ISDIR(s.st_mode) ||
+	    (s.st_dev == jn->skip_dev && s.st_ino == jn->skip_ino)) {
+		return true;
+	}
+	
+	if (!add_watch(jn, dir, is_recursive)) {
+		return false;
+	}
+	if ((!is_recursive && !is_new) || !(dirp = opendir(dir))) {
+		return true;
+	}
+	
+	while (ret && (ditem = readdir(dirp))) {
+		bool is_dir;
+		
+		if (ditem->d_name[0] == '.' && (!ditem->d_name[1] ||
+		    !std::strcmp(ditem->d_name, "..") ||
+		    !std::strcmp(ditem->d_name, ".git"))) {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/%s", dir, ditem->d_name);
+		is_dir = ditem->d_type == DT_DIR ||
+		         (ditem->d_type == DT_UNKNOWN && lstat(path, &s) == 0 &&
+		          S_ISDIR(s.st_mode));
+		if (is_dir && is_recursive) {
+			ret = add_tree(jn, path, true, is_new);
+		} else if (!is_dir && is_new) {
+			ret = add_record(jn, dir, ditem->d_name, 0);
+		}
+	}
+	
+	closedir(dirp);
+	return ret;
+}
+
+
+un::journal_t *un::journal_start( const char *path ) {
+	journal_hdr_t hdr;
+	journal_t     *jn;
+	const char    *base;
+	char          *dir;
+	struct stat   s;
+	int           fd;
+	
+	// - the journal belongs to whichever monitor still holds it
+	if ((fd = open_live(path, &hdr)) >= 0) {
+		close(fd);
+		return NULL;
+	}
+	
+	if (!(jn = (journal_t *) std::calloc(1, sizeof(journal_t)))) {
+		return NULL;
+	}
+	
+	jn->fd      = -1;
+	jn->ino_fd  = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	jn->sync_wd = -1;
+	jn->path    = strdup(path);
+	jn->tmp     = (char *) std::malloc(std::strlen(path) + 8);
+	dir         = dir_of(path, &base);
+	if (jn->ino_fd < 0 || !jn->path || !jn->tmp || !dir) {
+		std::free(dir);
+		journal_stop(jn);
+		return NULL;
+	}
+	
+	std::sprintf(jn->tmp, "%s.new", path);
+	jn->sync_name = (char *) std::malloc(std::strlen(base) +
+	                                     sizeof(JOURNAL_SYNC));
+	if (jn->sync_name) {
+		std::sprintf(jn->sync_name, "%s%s", base, JOURNAL_SYNC);
+	}
+	
+	if (!jn->sync_name || stat(dir, &s) != 0 ||
+	    (jn->sync_wd = inotify_add_watch(jn->ino_fd, dir,
+	                                     IN_CREATE | IN_ONLYDIR)) < 0 ||
+	    !new_generation(jn)) {
+		std::free(dir);
+		journal_stop(jn);
+		return NULL;
+	}
+	
+	jn->skip_dev = s.st_dev;
+	jn->skip_ino = s.st_ino;
+	resident     = jn;
+	std::free(dir);
+	return jn;
+}
+
+
+bool un::journal_watch( journal_t *jn, const char *dir, bool is_recursive ) {
+	return jn && add_tree(jn, dir, is_recursive, false);
+}
+
+
+bool un::journal_rotate( journal_t *jn ) {
+	jn->batch_len = 0;
+	jn->num_batch = 0;
+	return new_generation(jn);
+}
+
+
+/*
+ *  journal_wait()
+ *  - returns the number of paths journaled, -1 on failure.  The journal is
+ *    published by the first wait so that every watch of its generation is
+ *    in place before any reader can take a mark in it.
+ */
+int un::journal_wait( journal_t *jn, int timeout_ms ) {
+	alignas(struct inotify_event) char buf[64 * 1024];
+	struct pollfd pfd = { jn->ino_fd, POLLIN, 0 };
+	struct stat   s;
+	ssize_t       len;
+	int           ret;
+	
+	if (!jn->is_published) {
+		if (rename(jn->tmp, jn->path) != 0) {
+			return -1;
+		}
+		jn->is_published = true;
+	}
+	
+	if ((ret = poll(&pfd, 1, timeout_ms)) <= 0) {
+		return (ret == 0 || errno == EINTR) ? 0 : -1;
+	}
+	
+	if ((len = read(jn->ino_fd, buf, sizeof(buf))) < 0) {
+		return (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+	}
+	
+	jn->batch_len = 0;
+	jn->num_batch = 0;
+	for (char *pos = buf; pos < buf + len;) {
+		struct inotify_event *ev = (struct inotify_event *) pos;
+		watch_t              *w;
+		
+		pos += sizeof(struct inotify_event) + ev->len;
+		if (ev->mask & IN_Q_OVERFLOW) {
+			jn->is_overflow = true;
+			continue;
+		}
+		
+		if (ev->wd == jn->sync_wd) {
+			if (ev->len && !std::strncmp(ev->name, jn->sync_name,
+			                             std::strlen(jn->sync_name)) &&
+			    !add_record(jn, NULL, ev->name, JOURNAL_SYNC_MARK)) {
+				return -1;
+			}
+			continue;
+		}
+		
+		if (ev->wd < 0 || ev->wd >= jn->num_watches ||
+		    !(w = &jn->watches[ev->wd])->dir) {
+			continue;
+		}
+		
+		if (ev->mask & IN_IGNORED) {
+			std::free(w->dir);
+			std::memset(w, 0, sizeof(*w));
+			continue;
+		}
+		
+		// - files that move with a directory send no events of their own
+		if ((ev->mask & IN_MOVE_SELF) ||
+		    ((ev->mask & IN_ISDIR) && (ev->mask & IN_MOVED_FROM))) {
+			jn->is_overflow = true;
+			continue;
+		}
+		
+		if (!ev->len) {
+			continue;
+		}
+		
+		if (ev->mask & IN_ISDIR) {
+			if ((ev->mask & (IN_CREATE | IN_MOVED_TO)) && w->is_recursive) {
+				char path[PATH_MAX];
+				std::snprintf(path, sizeof(path), "%s/%s", w->dir, ev->name);
+				if (!add_tree(jn, path, true, true)) {
+					jn->is_overflow = true;
+				}
+			}
+			continue;
+		}
+		
+		if (!add_record(jn, w->dir, ev->name, 0)) {
+			return -1;
+		}
+	}
+	
+	if (jn->is_overflow) {
+		return journal_rotate(jn) ? 0 : -1;
+	}
+	
+	if (jn->batch_len &&
+	    write(jn->fd, jn->batch, jn->batch_len) != (ssize_t) jn->batch_len) {
+		return -1;
+	}
+	
+	if (fstat(jn->fd, &s) == 0 && s.st_size > JOURNAL_CAP &&
+	    !journal_rotate(jn)) {
+		return -1;
+	}
+	
+	ret = 0;
+	for (size_t i = 0; i < jn->batch_len; i += std::strlen(jn->batch + i) + 1) {
+		ret += (jn->batch[i] != JOURNAL_SYNC_MARK) ? 1 : 0;
+	}
+	return ret;
+}
+
+
+int un::journal_fd( const journal_t *jn ) {
+	return jn->ino_fd;
+}
+
+
+// ...every event already queued, without waiting for more
+static bool drain( un::journal_t *jn ) {
+	struct pollfd pfd = { jn->ino_fd, POLLIN, 0 };
+	
+	while (poll(&pfd, 1, 0) > 0) {
+		if (un::journal_wait(jn, 0) < 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+void un::journal_stop( journal_t *jn ) {
+	if (!jn) {
+		return;
+	}
+	
+	if (resident == jn) {
+		resident = NULL;
+	}
+	// - an abandoned journal is recognized because nobody holds it
+	if (jn->fd >= 0) {
+		close(jn->fd);
+	}
+	if (!jn->is_published && jn->tmp) {
+		unlink(jn->tmp);
+	}
+	if (jn->ino_fd >= 0) {
+		close(jn->ino_fd);
+	}
+	for (int i = 0; i < jn->num_watches; i++) {
+		std::free(jn->watches[i].dir);
+	}
+	std::free(jn->watches);
+	std::free(jn->batch);
+	std::free(jn->sync_name);
+	std::free(jn->tmp);
+	std::free(jn->path);
+	std::free(jn);
+}
+
+
+#else
+
+un::journal_t *un::journal_start( const char *path ) {
+	return NULL;
+}
+
+
+bool un::journal_watch( journal_t *jn, const char *dir, bool is_recursive ) {
+	return false;
+}
+
+
+bool un::journal_rotate( journal_t *jn ) {
+	return false;
+}
+
+
+int un::journal_wait( journal_t *jn, int timeout_ms ) {
+	return -1;
+}
+
+
+int un::journal_fd( const journal_t *jn ) {
+	return -1;
+}
+
+
+static bool drain( un::journal_t *jn ) {
+	return false;
+}
+
+
+void un::journal_stop( journal_t *jn ) {
+}
+
+#endif
@@ -0,0 +1,68 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_JOURNAL_H
+#define UNUM_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  The journal is an append-only list of the paths that changed in the
+ *  watched directories, written by one monitor process.  Each run of the
+ *  monitor is a new generation, as is every overflow of the event queue,
+ *  so a mark taken in an earlier generation can't be trusted and whoever
+ *  holds it must fall back to looking at every file.
+ */
+typedef struct journal_s journal_t;
+
+typedef struct {
+	uint64_t gen;
+	uint64_t pos;
+} journal_mark_t;
+
+typedef struct {
+	char   *paths;          // - NUL-terminated paths back to back
+	size_t len;
+	int    num_paths;
+} journal_log_t;
+
+
+// - monitor, NULL when unsupported or another monitor owns the journal
+extern journal_t *journal_start( const char *path );
+extern bool       journal_watch( journal_t *jn, const char *dir,
+                                 bool is_recursive );
+extern bool       journal_rotate( journal_t *jn );
+extern int        journal_wait( journal_t *jn, int timeout_ms );
+extern int        journal_fd( const journal_t *jn );   // - to poll with others
+extern void       journal_stop( journal_t *jn );
+
+
+/*
+ *  journal_read()
+ *  - returns the paths recorded since `mark` once every change made before
+ *    the call has been journaled, or fails when the monitor isn't running,
+ *    has restarted or overflowed since, or doesn't answer in time.  A
+ *    monitor running in the calling process is caught up directly.
+ */
+extern bool       journal_mark( const char *path, journal_mark_t *mark );
+extern bool       journal_read( const char *path, const journal_mark_t *mark,
+                                journal_log_t *log );
+extern void       journal_free( journal_log_t *log );
+
+
+// - removes './' components and repeated separators in place
+extern char       *journal_norm( char *path );
+
+
+}
+#endif /* UNUM_JOURNAL_H */
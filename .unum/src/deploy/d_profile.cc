@@ -0,0 +1,450 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "u_common.h"
+#include "u_lex.h"
+#include "d_profile.h"
+
+/*
+ *  <sample-trace-event>
+ *
+ *  { "pid": 1, "tid": 1, "ph": "X", "ts": 5120, "dur": 1834,
+ *    "name": "Source", "args": { "detail": ".unum/src/u_common.h" } }
+ *
+ *  Only complete events with a duration are counted.  Durations are
+ *  inclusive, so a header's time contains that of the headers it includes.
+ */
+
+#define PROF_TOP     30
+#define NAME_MAX_LEN 1024
+#define JSON_DEPTH   64
+
+typedef enum {
+	PK_UNIT = 0,
+	PK_HEADER,
+	PK_TEMPLATE,
+	PK_FUNCTION,
+	
+	PK_COUNT
+} prof_kind_e;
+
+static const struct { const char *event;
+                      prof_kind_e kind; } events[] = {
+	{ "ExecuteCompiler",     PK_UNIT     },
+	{ "Source",              PK_HEADER   },
+	{ "InstantiateClass",    PK_TEMPLATE },
+	{ "InstantiateFunction", PK_TEMPLATE },
+	{ "CodeGen Function",    PK_FUNCTION },
+	{ "OptFunction",         PK_FUNCTION }
+};
+
+static const char *titles[PK_COUNT] = {
+	"units",
+	"headers, over every inclusion",
+	"template instantiations",
+	"functions, code generation and optimization"
+};
+
+typedef struct {
+	char        *name;
+	prof_kind_e kind;
+	long long   total_us;
+	long long   count;
+} cost_t;
+
+struct un::prof_s {
+	cost_t  *entries;
+	int      num_entries;
+	int      max_entries;
+	int      *table;
+	uint32_t table_cap;
+	int      num_traces;
+};
+
+typedef struct {
+	const char *p;
+	const char *end;
+	int        depth;
+} json_t;
+
+
+static uint32_t entry_hash( prof_kind_e kind, const char *name ) {
+	uint32_t h = 2166136261u ^ (uint32_t) kind;
+	
+	for (; *name; name++) {
+		h = (h ^ (unsigned char) *name) * 16777619u;
+	}
+	
+	return h;
+}
+
+
+// ...the table holds entry indices offset by one so that zero is empty
+static bool rehash( un::prof_t *prof ) {
+	uint32_t cap   = prof->table_cap ? prof->table_cap * 2 : 1024;
+	int      *table = (int *) std::calloc(cap, sizeof(int));
+	
+	if (!table) {
+		return false;
+	}
+	
+	for (int i = 0; i < prof->num_entries; i++) {
+		cost_t  *e   = &prof->entries[i];
+		uint32_t slot = entry_hash(e->kind, e->name) & (cap - 1);
+		while (table[slot]) {
+			slot = (slot + 1) & (cap - 1);
+		}
+		table[slot] = i + 1;
+	}
+	
+	std::free(prof->table);
+	prof->table     = table;
+	prof->table_cap = cap;
+	return true;
+}
+
+
+static bool add_cost( un::prof_t *prof, prof_kind_e kind, const char *name,
+                      long long dur ) {
+	uint32_t slot;
+	cost_t  *e;
+	
+	if ((uint32_t) (prof->num_entries + 1) * 2 > prof->table_cap &&
+	    !rehash(prof)) {
+		return false;
+	}
+	
+	for (slot = entry_hash(kind, name) & (prof->table_cap - 1);
+	     prof->table[slot]; slot = (slot + 1) & (prof->table_cap - 1)) {
+		e = &prof->entries[prof->table[slot] - 1];
+		if (e->kind == kind && !std::strcmp(e->name, name)) {
+			e->total_us += dur;
+			e->count++;
+			return true;
+		}
+	}
+	
+	if (prof->num_entries == prof->max_entries) {
+		int     cap  = prof->max_entries ? prof->max_entries * 2 : 256;
+		cost_t *tmp = (cost_t *) std::realloc(prof->entries,
+		                                        sizeof(cost_t) * cap);
+		if (!tmp) {
+			return false;
+		}
+		prof->entries     = tmp;
+		prof->max_entries = cap;
+	}
+	
+	e = &prof->entries[prof->num_entries];
+	if (!(e->name = strdup(name))) {
+		return false;
+	}
+	e->kind           = kind;
+	e->total_us       = dur;
+	e->count          = 1;
+	prof->table[slot] = ++prof->num_entries;
+	return true;
+}
+
+
+static void skip_ws( json_t *js ) {
+	while (js->p < js->end && (*js->p == ' ' || *js->p == '\t' ||
+	                           *js->p == '\n' || *js->p == '\r')) {
+		js->p++;
+	}
+}
+
+
+static bool expect( json_t *js, char c ) {
+	skip_ws(js);
+	if (js->p < js->end && *js->p == c) {
+		js->p++;
+		return true;
+	}
+	return false;
+}
+
+
+// ...decodes into the buffer, truncating what doesn't fit
+static bool read_string( json_t *js, char *buf, size_t cap ) {
+	size_t len = 0;
+	
+	if (!expect(js, '"')) {
+		return false;
+	}
+	
+	while (js->p < js->end && *js->p != '"') {
+		char c = *js->p++;
+		
+		if (c == '\\' && js->p < js->end) {
+			c = *js->p++;
+			switch (c) {
+			case 'n': c = '\n'; break;
+			case 't': c = '\t'; break;
+			case 'r': c = '\r'; break;
+			case 'b': c = '\b'; break;
+			case 'f': c = '\f'; break;
+			case 'u':
+				js->p = (js->end - js->p >= 4) ? js->p + 4 : js->end;
+				c     = '?';
+				break;
+			default:
+				break;
+			}
+		}
+		
+		if (buf && len + 1 < cap) {
+			buf[len++] = c;
+		}
+	}
+	
+	if (buf) {
+		buf[len] = '\0';
+	}
+	return expect(js, '"');
+}
+
+
+static bool skip_value( json_t *js ) {
+	bool ok = true;
+	
+	skip_ws(js);
+	if (js->p >= js->end || js->depth > JSON_DEPTH) {
+		return false;
+	}
+	
+	if (*js->p == '"') {
+		return read_string(js, NULL, 0);
+	}
+	
+	if (*js->p == '{' || *js->p == '[') {
+		char close = (*js->p == '{') ? '}' : ']';
+		bool is_obj = close == '}';
+		
+		js->p++;
+		js->depth++;
+		if (!expect(js, close)) {
+			do {
+				ok = (!is_obj || (read_string(js, NULL, 0) && expect(js, ':'))) &&
+				     skip_value(js);
+			} while (ok && expect(js, ','));
+			ok = ok && expect(js, close);
+		}
+		js->depth--;
+		return ok;
+	}
+	
+	// - numbers and literals
+	while (js->p < js->end && *js->p != ',' && *js->p != '}' &&
+	       *js->p != ']' && *js->p != ' ' && *js->p != '\n') {
+		js->p++;
+	}
+	return true;
+}
+
+
+static bool read_number( json_t *js, double *val ) {
+	char *endp;
+	
+	skip_ws(js);
+	*val = std::strtod(js->p, &endp);
+	if (endp == js->p) {
+		return skip_value(js);
+	}
+	js->p = endp;
+	return true;
+}
+
+
+static bool read_event( un::prof_t *prof, json_t *js, const char *unit ) {
+	char   key[64], name[64] = "", detail[NAME_MAX_LEN] = "";
+	double dur = -1.0;
+	bool   ok  = true;
+	
+	if (!expect(js, '{')) {
+		return skip_value(js);
+	}
+	
+	if (!expect(js, '}')) {
+		do {
+			if (!read_string(js, key, sizeof(key)) || !expect(js, ':')) {
+				return false;
+			}
+			
+			if (!std::strcmp(key, "name")) {
+				ok = read_string(js, name, sizeof(name));
+				
+			} else if (!std::strcmp(key, "dur")) {
+				ok = read_number(js, &dur);
+				
+			} else if (!std::strcmp(key, "args") && expect(js, '{')) {
+				if (!expect(js, '}')) {
+					do {
+						ok = read_string(js, key, sizeof(key)) &&
+						     expect(js, ':') &&
+						     (std::strcmp(key, "detail") ? skip_value(js) :
+						      read_string(js, detail, sizeof(detail)));
+					} while (ok && expect(js, ','));
+					ok = ok && expect(js, '}');
+				}
+				
+			} else {
+				ok = skip_value(js);
+			}
+		} while (ok && expect(js, ','));
+		
+		if (!ok || !expect(js, '}')) {
+			return false;
+		}
+	}
+	
+	if (dur < 0) {
+		return true;
+	}
+	
+	for (size_t i = 0; i < sizeof(events) / sizeof(events[0]); i++) {
+		if (std::strcmp(name, events[i].event)) {
+			continue;
+		}
+		
+		if (events[i].kind == PK_UNIT) {
+			return add_cost(prof, PK_UNIT, unit, (long long) dur);
+		}
+		return !detail[0] || add_cost(prof, events[i].kind, detail,
+		                              (long long) dur);
+	}
+	
+	return true;
+}
+
+
+un::prof_t *un::prof_open( void ) {
+	return (prof_t *) std::calloc(1, sizeof(prof_t));
+}
+
+
+void un::prof_close( prof_t *prof ) {
+	if (!prof) {
+		return;
+	}
+	
+	for (int i = 0; i < prof->num_entries; i++) {
+		std::free(prof->entries[i].name);
+	}
+	std::free(prof->entries);
+	std::free(prof->table);
+	std::free(prof);
+}
+
+
+// ...the unit is named by the caller because its compile event has no detail
+bool un::prof_add_trace( prof_t *prof, const char *path, const char *unit ) {
+	json_t js;
+	size_t len;
+	char   key[64];
+	char   *text = lex_read_file(path, &len);
+	bool   ok    = true;
+	
+	if (!text) {
+		return false;
+	}
+	
+	js.p     = text;
+	js.end   = text + len;
+	js.depth = 0;
+	
+	if (!expect(&js, '{')) {
+		std::free(text);
+		return false;
+	}
+	
+	do {
+		if (!read_string(&js, key, sizeof(key)) || !expect(&js, ':')) {
+			ok = false;
+			break;
+		}
+		
+		if (std::strcmp(key, "traceEvents") || !expect(&js, '[')) {
+			ok = skip_value(&js);
+			continue;
+		}
+		
+		if (!expect(&js, ']')) {
+			do {
+				ok = read_event(prof, &js, unit);
+			} while (ok && expect(&js, ','));
+			ok = ok && expect(&js, ']');
+		}
+	} while (ok && expect(&js, ','));
+	
+	std::free(text);
+	prof->num_traces += ok;
+	return ok;
+}
+
+
+static int by_cost( const void *a, const void *b ) {
+	const cost_t *ea = (const cost_t *) a, *eb = (const cost_t *) b;
+	
+	if (ea->kind != eb->kind) {
+		return (int) ea->kind - (int) eb->kind;
+	}
+	return (ea->total_us < eb->total_us) - (ea->total_us > eb->total_us);
+}
+
+
+/*
+ *  <sample-report>
+ *
+ *  unum compile profile, 12 units traced
+ *
+ *  headers, over every inclusion
+ *      total ms   count  name
+ *         812.4      11  .unum/src/u_common.h
+ *
+ */
+bool un::prof_write( prof_t *prof, const char *path ) {
+	FILE *fp = std::fopen(path, "w");
+	int  pos = 0;
+	
+	if (!fp) {
+		return false;
+	}
+	
+	// - the table is not needed after sorting, so it is discarded
+	if (prof->num_entries) {
+		std::qsort(prof->entries, (size_t) prof->num_entries, sizeof(cost_t),
+		           by_cost);
+	}
+	std::free(prof->table);
+	prof->table     = NULL;
+	prof->table_cap = 0;
+	
+	std::fprintf(fp, "unum compile profile, %d unit%s traced\n",
+	             prof->num_traces, prof->num_traces == 1 ? "" : "s");
+	
+	for (int kind = 0; kind < PK_COUNT; kind++) {
+		std::fprintf(fp, "\n%s\n", titles[kind]);
+		std::fprintf(fp, "    total ms   count  name\n");
+		
+		for (int n = 0; pos < prof->num_entries &&
+		                prof->entries[pos].kind == kind; pos++, n++) {
+			cost_t *e = &prof->entries[pos];
+			if (n < PROF_TOP) {
+				std::fprintf(fp, "%12.1f %7lld  %s\n", e->total_us / 1000.0,
+				             e->count, e->name);
+			}
+		}
+	}
+	
+	return std::fclose(fp) == 0;
+}
@@ -0,0 +1,34 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_PROFILE_H
+#define UNUM_PROFILE_H
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  The compile profile aggregates the time traces written by the compiler
+ *  for each unit (-ftime-trace, in the Chrome trace format) into the cost 
+ *  of each header, template instantiation and function across the whole
+ *  kernel.  A header's cost is the sum of every inclusion of it, which
+ *  shows where include hygiene will pay off.
+ */
+typedef struct prof_s prof_t;
+
+
+extern prof_t *prof_open( void );
+extern void   prof_close( prof_t *prof );
+extern bool   prof_add_trace( prof_t *prof, const char *path,
+                              const char *unit );
+extern bool   prof_write( prof_t *prof, const char *path );
+
+
+}
+#endif /* UNUM_PROFILE_H */
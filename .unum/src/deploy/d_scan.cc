@@ -0,0 +1,569 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+
+#include "u_common.h"
+#include "u_lex.h"
+#include "d_scan.h"
+
+/*
+ *  Files are interned by path into a table of nodes that records whether 
+ *  they exist so that system headers searched for in every include 
+ *  directory are only looked up once.  A node's edges are the files its 
+ *  directives resolved to and its digest combines its path and tokens.
+ *  The named modules a file exports and imports are recorded by name.
+ */
+typedef struct {
+	char       *path;
+	time_t     mtime;
+	long long  size;
+	un::hash_t digest;
+	un::hash_t tokens;
+	int        *edges;
+	int        num_edges;
+	int        max_edges;
+	unsigned   visit;
+	bool       is_found;
+	bool       is_scanned;
+	bool       is_opaque;
+	char       *module;
+	char       **imports;
+	int        num_imports;
+	int        max_imports;
+} node_t;
+
+struct un::scan_s {
+	const char **inc_dirs;
+	node_t     *nodes;
+	int        num_nodes;
+	int        max_nodes;
+	int        *table;
+	uint32_t   table_cap;
+	unsigned   visit;
+	int        *stack;
+	int        max_stack;
+};
+
+
+static uint32_t path_hash( const char *path ) {
+	uint32_t h = 2166136261u;
+	
+	for (; *path; path++) {
+		h = (h ^ (unsigned char) *path) * 16777619u;
+	}
+	
+	return h;
+}
+
+
+static bool grow( void **arr, int *max, int need, size_t size ) {
+	void *tmp;
+	int  cap = *max ? *max : 16;
+	
+	if (need <= *max) {
+		return true;
+	}
+	
+	while (cap < need) {
+		cap *= 2;
+	}
+	if (!(tmp = std::realloc(*arr, (size_t) cap * size))) {
+		return false;
+	}
+	
+	*arr = tmp;
+	*max = cap;
+	return true;
+}
+
+
+// ...the table holds node ids offset by one so that zero is empty
+static bool rehash( un::scan_t *scan ) {
+	uint32_t cap = scan->table_cap ? scan->table_cap * 2 : 1024;
+	int      *table = (int *) std::calloc(cap, sizeof(int));
+	
+	if (!table) {
+		return false;
+	}
+	
+	for (int i = 0; i < scan->num_nodes; i++) {
+		uint32_t slot = path_hash(scan->nodes[i].path) & (cap - 1);
+		while (table[slot]) {
+			slot = (slot + 1) & (cap - 1);
+		}
+		table[slot] = i + 1;
+	}
+	
+	std::free(scan->table);
+	scan->table     = table;
+	scan->table_cap = cap;
+	return true;
+}
+
+
+static int find_node( un::scan_t *scan, const char *path ) {
+	uint32_t slot = path_hash(path) & (scan->table_cap - 1);
+	
+	for (; scan->table[slot]; slot = (slot + 1) & (scan->table_cap - 1)) {
+		if (!std::strcmp(scan->nodes[scan->table[slot] - 1].path, path)) {
+			return scan->table[slot] - 1;
+		}
+	}
+	
+	return -1;
+}
+
+
+// ...interns the path, checking only once whether it exists
+static int intern( un::scan_t *scan, const char *path ) {
+	struct stat s;
+	node_t      *node;
+	int         id = find_node(scan, path);
+	
+	if (id >= 0) {
+		return id;
+	}
+	
+	if ((uint32_t) (scan->num_nodes + 1) * 2 > scan->table_cap &&
+	    !rehash(scan)) {
+		return -1;
+	}
+	if (!grow((void **) &scan->nodes, &scan->max_nodes, scan->num_nodes + 1,
+	          sizeof(node_t))) {
+		return -1;
+	}
+	
+	node = &scan->nodes[scan->num_nodes];
+	std::memset(node, 0, sizeof(*node));
+	if (!(node->path = strdup(path))) {
+		return -1;
+	}
+	
+	if (stat(path, &s) == 0 && S_ISREG(s.st_mode)) {
+		node->is_found = true;
+		node->mtime    = s.st_mtime;
+		node->size     = (long long) s.st_size;
+	}
+	
+	id = scan->num_nodes++;
+	for (uint32_t slot = path_hash(path) & (scan->table_cap - 1);;
+	     slot = (slot + 1) & (scan->table_cap - 1)) {
+		if (!scan->table[slot]) {
+			scan->table[slot] = id + 1;
+			break;
+		}
+	}
+	
+	return id;
+}
+
+
+static void join_path( char *buf, const char *dir, size_t dir_len,
+                       const char *name, size_t name_len ) {
+	if (name_len && name[0] == '/') {
+		dir_len = 0;
+	}
+	if (dir_len + name_len + 2 > PATH_MAX) {
+		buf[0] = '\0';
+		return;
+	}
+	
+	std::memcpy(buf, dir, dir_len);
+	if (dir_len && dir[dir_len - 1] != '/') {
+		buf[dir_len++] = '/';
+	}
+	std::memcpy(buf + dir_len, name, name_len);
+	buf[dir_len + name_len] = '\0';
+	
+	while (buf[0] == '.' && buf[1] == '/') {
+		std::memmove(buf, buf + 2, std::strlen(buf + 2) + 1);
+	}
+}
+
+
+// ...quoted names are tried beside the includer before the include path
+static int resolve( un::scan_t *scan, const char *from, const char *name,
+                    size_t len, bool is_quoted ) {
+	char       buf[PATH_MAX];
+	const char *slash = std::strrchr(from, '/');
+	int        id;
+	
+	if (is_quoted) {
+		join_path(buf, from, slash ? (size_t) (slash - from) : 0, name, len);
+		if (buf[0] && (id = intern(scan, buf)) >= 0 &&
+		    scan->nodes[id].is_found) {
+			return id;
+		}
+	}
+	
+	for (const char **dir = scan->inc_dirs; dir && *dir && **dir; dir++) {
+		join_path(buf, *dir, std::strlen(*dir), name, len);
+		if (buf[0] && (id = intern(scan, buf)) >= 0 &&
+		    scan->nodes[id].is_found) {
+			return id;
+		}
+	}
+	
+	return -1;
+}
+
+
+static bool add_edge( un::scan_t *scan, int from, int to ) {
+	node_t *node = &scan->nodes[from];
+	
+	for (int i = 0; i < node->num_edges; i++) {
+		if (node->edges[i] == to) {
+			return true;
+		}
+	}
+	
+	if (!grow((void **) &node->edges, &node->max_edges, node->num_edges + 1,
+	          sizeof(int))) {
+		return false;
+	}
+	node->edges[node->num_edges++] = to;
+	return true;
+}
+
+
+static bool is_include( const un::lex_token_t *tok ) {
+	static const char *names[] = { "include", "include_next", "import" };
+	
+	if (tok->type != un::LT_IDENT) {
+		return false;
+	}
+	
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		if (tok->len == std::strlen(names[i]) &&
+		    !std::strncmp(tok->text, names[i], tok->len)) {
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+
+static bool is_word( const un::lex_token_t *tok, const char *word ) {
+	return tok->type == un::LT_IDENT && tok->len == std::strlen(word) &&
+	       !std::strncmp(tok->text, word, tok->len);
+}
+
+
+// ...a dotted module name ending the declaration, but not a partition or
+//    a header unit which belong to other mechanisms.
+static bool read_module( un::lexer_t *lex, un::lex_token_t *tok, char *buf,
+                         size_t cap ) {
+	size_t len = 0;
+	
+	while (tok->type == un::LT_IDENT && len + tok->len + 2 < cap) {
+		std::memcpy(buf + len, tok->text, tok->len);
+		len += tok->len;
+		
+		if (!un::lex_next(lex, tok) || tok->type != un::LT_PUNCT ||
+		    tok->len != 1 || tok->text[0] != '.') {
+			break;
+		}
+		buf[len++] = '.';
+		if (!un::lex_next(lex, tok)) {
+			return false;
+		}
+	}
+	
+	buf[len] = '\0';
+	return len && tok->type == un::LT_PUNCT && tok->text[0] == ';';
+}
+
+
+static bool add_import( node_t *node, const char *name ) {
+	for (int i = 0; i < node->num_imports; i++) {
+		if (!std::strcmp(node->imports[i], name)) {
+			return true;
+		}
+	}
+	
+	if (!grow((void **) &node->imports, &node->max_imports,
+	          node->num_imports + 1, sizeof(char *)) ||
+	    !(node->imports[node->num_imports] = strdup(name))) {
+		return false;
+	}
+	node->num_imports++;
+	return true;
+}
+
+
+// ...module declarations begin a line and are never inside directives
+static bool scan_module( un::scan_t *scan, int id, un::lexer_t *lex,
+                         un::lex_token_t *tok ) {
+	char   name[256];
+	node_t *node     = &scan->nodes[id];
+	bool   is_export = is_word(tok, "export");
+	
+	if (is_export && (!un::lex_next(lex, tok) || tok->is_bol)) {
+		return true;
+	}
+	
+	if (is_word(tok, "module")) {
+		if (!un::lex_next(lex, tok) || !read_module(lex, tok, name,
+		                                            sizeof(name))) {
+			return true;
+		}
+		
+		// - an implementation unit implicitly imports its interface
+		if (is_export) {
+			std::free(node->module);
+			return (node->module = strdup(name)) != NULL;
+		}
+		return add_import(node, name);
+		
+	} else if (is_word(tok, "import")) {
+		if (!un::lex_next(lex, tok) || !read_module(lex, tok, name,
+		                                            sizeof(name))) {
+			return true;
+		}
+		return add_import(node, name);
+	}
+	
+	return true;
+}
+
+
+// ...lexes a file once for both its directives and its fingerprint
+static bool scan_node( un::scan_t *scan, int id ) {
+	un::lexer_t     lex;
+	un::lex_token_t tok;
+	un::hash_ctx_t  ctx;
+	un::hash_t      tokens;
+	size_t          len;
+	char            *text, *path;
+	
+	scan->nodes[id].is_scanned = true;
+	if (!scan->nodes[id].is_found ||
+	    !(text = un::lex_read_file(scan->nodes[id].path, &len))) {
+		return true;
+	}
+	
+	path   = scan->nodes[id].path;
+	tokens = un::lex_fingerprint_text(text, len);
+	scan->nodes[id].tokens = tokens;
+	un::hash_init(&ctx);
+	un::hash_update_s(&ctx, path);
+	un::hash_update(&ctx, &tokens, sizeof(tokens));
+	scan->nodes[id].digest = un::hash_final(&ctx);
+	
+	un::lex_init(&lex, text, len);
+	while (un::lex_next(&lex, &tok)) {
+		const char *name;
+		size_t     name_len;
+		bool       is_quoted;
+		int        to;
+		
+		if (tok.is_bol && tok.type == un::LT_IDENT && !lex.in_directive) {
+			if (!scan_module(scan, id, &lex, &tok)) {
+				std::free(text);
+				return false;
+			}
+			
+			// - the declaration ended early, possibly on a directive
+			if (!tok.is_directive) {
+				continue;
+			}
+		}
+		
+		if (!tok.is_directive || !un::lex_next(&lex, &tok) ||
+		    !is_include(&tok) || !un::lex_next(&lex, &tok)) {
+			continue;
+		}
+		
+		if (tok.type == un::LT_STRING && tok.text[0] == '"' && tok.len >= 2) {
+			name      = tok.text + 1;
+			name_len  = tok.len - 2;
+			is_quoted = true;
+			
+		} else if (tok.type == un::LT_PUNCT && tok.text[0] == '<') {
+			name = tok.text + 1;
+			for (name_len = 0; name + name_len < text + len &&
+			     name[name_len] != '>' && name[name_len] != '\n'; name_len++) {}
+			is_quoted = false;
+			
+		} else {
+			scan->nodes[id].is_opaque = true;
+			continue;
+		}
+		
+		if ((to = resolve(scan, path, name, name_len, is_quoted)) >= 0 &&
+		    !add_edge(scan, id, to)) {
+			std::free(text);
+			return false;
+		}
+	}
+	
+	std::free(text);
+	return true;
+}
+
+
+un::scan_t *un::scan_open( const char **inc_dirs ) {
+	scan_t *scan = (scan_t *) std::calloc(1, sizeof(scan_t));
+	
+	if (!scan) {
+		return NULL;
+	}
+	
+	scan->inc_dirs = inc_dirs;
+	if (!rehash(scan)) {
+		std::free(scan);
+		return NULL;
+	}
+	
+	return scan;
+}
+
+
+void un::scan_close( scan_t *scan ) {
+	if (!scan) {
+		return;
+	}
+	
+	for (int i = 0; i < scan->num_nodes; i++) {
+		node_t *node = &scan->nodes[i];
+		
+		for (int j = 0; j < node->num_imports; j++) {
+			std::free(node->imports[j]);
+		}
+		std::free(node->imports);
+		std::free(node->module);
+		std::free(node->path);
+		std::free(node->edges);
+	}
+	std::free(scan->nodes);
+	std::free(scan->table);
+	std::free(scan->stack);
+	std::free(scan);
+}
+
+
+// ...scans the file and, through a work stack, everything it includes
+int un::scan_file( scan_t *scan, const char *path ) {
+	char buf[PATH_MAX];
+	int  root, depth = 0;
+	
+	join_path(buf, "", 0, path, std::strlen(path));
+	if ((root = intern(scan, buf)) < 0 || !scan->nodes[root].is_found) {
+		return -1;
+	}
+	
+	if (scan->nodes[root].is_scanned) {
+		return root;
+	}
+	
+	if (!grow((void **) &scan->stack, &scan->max_stack, 1, sizeof(int))) {
+		return -1;
+	}
+	scan->stack[depth++] = root;
+	
+	while (depth) {
+		int id = scan->stack[--depth];
+		
+		if (scan->nodes[id].is_scanned) {
+			continue;
+		}
+		if (!scan_node(scan, id)) {
+			return -1;
+		}
+		
+		for (int i = 0; i < scan->nodes[id].num_edges; i++) {
+			int to = scan->nodes[id].edges[i];
+			if (scan->nodes[to].is_scanned) {
+				continue;
+			}
+			if (!grow((void **) &scan->stack, &scan->max_stack, depth + 1,
+			          sizeof(int))) {
+				return -1;
+			}
+			scan->stack[depth++] = to;
+		}
+	}
+	
+	return root;
+}
+
+
+bool un::scan_digest( scan_t *scan, int id, hash_t *out, time_t *mtime ) {
+	int  depth = 0;
+	bool ret   = true;
+	
+	*out   = { 0, 0 };
+	*mtime = 0;
+	// - every node is pushed at most once
+	if (id < 0 || id >= scan->num_nodes ||
+	    !grow((void **) &scan->stack, &scan->max_stack, scan->num_nodes,
+	          sizeof(int))) {
+		return false;
+	}
+	
+	scan->visit++;
+	scan->nodes[id].visit = scan->visit;
+	scan->stack[depth++]  = id;
+	
+	while (depth) {
+		node_t *node = &scan->nodes[scan->stack[--depth]];
+		
+		ret    = ret && !node->is_opaque;
+		*mtime = node->mtime > *mtime ? node->mtime : *mtime;
+		
+		// - headers are combined without regard to order, as they are found
+		if (node != &scan->nodes[id]) {
+			out->lo += node->digest.lo;
+			out->hi += node->digest.hi;
+		}
+		
+		for (int i = 0; i < node->num_edges; i++) {
+			node_t *to = &scan->nodes[node->edges[i]];
+			if (to->visit == scan->visit) {
+				continue;
+			}
+			to->visit            = scan->visit;
+			scan->stack[depth++] = node->edges[i];
+		}
+	}
+	
+	return ret;
+}
+
+
+int un::scan_count( scan_t *scan ) {
+	return scan->num_nodes;
+}
+
+
+bool un::scan_info( scan_t *scan, int id, scan_info_t *info ) {
+	node_t *node;
+	
+	if (id < 0 || id >= scan->num_nodes) {
+		return false;
+	}
+	
+	node            = &scan->nodes[id];
+	info->path        = node->path;
+	info->mtime       = node->mtime;
+	info->size        = node->size;
+	info->edges       = node->edges;
+	info->num_edges   = node->num_edges;
+	info->is_found    = node->is_found;
+	info->is_scanned  = node->is_scanned && node->is_found;
+	info->tokens      = node->tokens;
+	info->module      = node->module;
+	info->imports     = (const char * const *) node->imports;
+	info->num_imports = node->num_imports;
+	return true;
+}
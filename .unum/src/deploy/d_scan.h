@@ -0,0 +1,65 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_SCAN_H
+#define UNUM_SCAN_H
+
+#include <ctime>
+
+#include "u_hash.h"
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  The include scanner discovers the headers reached by a source without 
+ *  running the compiler.  Every directive is followed whether or not its 
+ *  conditional would be taken, which can only add dependencies, and each
+ *  file is read once no matter how many sources include it.  Includes that
+ *  don't name a file in an include directory are assumed to belong to the 
+ *  toolchain.
+ */
+typedef struct scan_s scan_t;
+
+
+extern scan_t *scan_open( const char **inc_dirs );
+extern void   scan_close( scan_t *scan );
+extern int    scan_file( scan_t *scan, const char *path );
+
+
+/*
+ *  scan_digest()
+ *  - combines the paths and token fingerprints of the headers reached by a
+ *    scanned file along with the newest modification time of them all.  
+ *    This fails if an include is computed by a macro and can't be known.
+ */
+extern bool   scan_digest( scan_t *scan, int id, hash_t *out, time_t *mtime );
+
+
+// - describes a file known to the scanner, ids are dense from zero
+typedef struct {
+	const char        *path;
+	time_t            mtime;
+	long long         size;
+	const int         *edges;
+	int               num_edges;
+	bool              is_found;
+	bool              is_scanned;
+	hash_t            tokens;       // - its token fingerprint once scanned
+	const char        *module;      // - the named module it exports
+	const char *const *imports;     // - the named modules it imports
+	int               num_imports;
+} scan_info_t;
+
+extern int    scan_count( scan_t *scan );
+extern bool   scan_info( scan_t *scan, int id, scan_info_t *info );
+
+
+}
+#endif /* UNUM_SCAN_H */
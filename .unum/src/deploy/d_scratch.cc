@@ -0,0 +1,388 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_hash.h"
+#include "u_paths.h"
+#include "d_scratch.h"
+
+#if UNUM_OS_LINUX
+#include <sys/vfs.h>
+#define TMPFS_MAGIC   0x01021994
+#endif
+
+// - the file system must keep this much free for anything else using it
+#define SCRATCH_RESERVE   (64LL * 1024 * 1024)
+
+// - each checkout's directory names the root it belongs to in this file, 
+//   one without it is only reclaimed once it has gone unused for a day
+#define SCRATCH_MARKER    "checkout"
+#define SCRATCH_STALE     (24 * 60 * 60)
+
+typedef struct {
+	time_t    mtime;
+	long long size;
+	char      *path;
+} entry_t;
+
+
+static bool is_ram_backed( const char *dir ) {
+#if UNUM_OS_LINUX
+	struct statfs s;
+	return statfs(dir, &s) == 0 && s.f_type == TMPFS_MAGIC &&
+	       access(dir, W_OK) == 0;
+#else
+	return false;
+#endif
+}
+
+
+static long long free_bytes( const char *dir ) {
+	struct statvfs s;
+	
+	if (statvfs(dir, &s) != 0) {
+		return 0;
+	}
+	
+	return (long long) s.f_bavail * (long long) s.f_frsize;
+}
+
+
+static long long disk_usage( const char *dir ) {
+	DIR           *dirp = opendir(dir);
+	struct dirent *ditem;
+	char          path[PATH_MAX];
+	struct stat   s;
+	long long     ret = 0;
+	
+	if (!dirp) {
+		return 0;
+	}
+	
+	while ((ditem = readdir(dirp))) {
+		if (!std::strcmp(ditem->d_name, ".") ||
+		    !std::strcmp(ditem->d_name, "..")) {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/%s", dir, ditem->d_name);
+		if (lstat(path, &s) != 0) {
+			continue;
+		}
+		
+		ret += (s.st_mode & S_IFDIR) ? disk_usage(path) :
+		                               (long long) s.st_blocks * 512;
+	}
+	
+	closedir(dirp);
+	return ret;
+}
+
+
+static bool make_dir( const char *path ) {
+	return mkdir(path, S_IRWXU) == 0 || errno == EEXIST;
+}
+
+
+static void remove_tree( const char *dir ) {
+	DIR           *dirp = opendir(dir);
+	struct dirent *ditem;
+	char          path[PATH_MAX];
+	struct stat   s;
+	
+	while (dirp && (ditem = readdir(dirp))) {
+		if (!std::strcmp(ditem->d_name, ".") ||
+		    !std::strcmp(ditem->d_name, "..")) {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/%s", dir, ditem->d_name);
+		if (lstat(path, &s) == 0 && (s.st_mode & S_IFMT) == S_IFDIR) {
+			remove_tree(path);
+		} else {
+			unlink(path);
+		}
+	}
+	
+	if (dirp) {
+		closedir(dirp);
+	}
+	rmdir(dir);
+}
+
+
+// ...the directory every checkout of this user's is kept under
+static const char *user_dir( const char *base, char *buf, size_t len ) {
+	std::snprintf(buf, len, "%s/unum-%ld", base, (long) getuid());
+	return buf;
+}
+
+
+// ...every checkout gets its own directory, named for its location
+static void checkout_key( const char *root, char *key ) {
+	un::hash_ctx_t ctx;
+	
+	un::hash_init(&ctx);
+	un::hash_update_s(&ctx, root);
+	un::hash_hex(un::hash_final(&ctx), key);
+	key[16] = '\0';
+}
+
+
+/*
+ *  Directories of checkouts that have since been removed would otherwise
+ *  hold their objects until the next reboot, which on a build machine
+ *  that clones a fresh workspace for every job is never soon enough.
+ */
+static void prune_checkouts( const char *users, const char *key ) {
+	DIR           *dirp = opendir(users);
+	struct dirent *ditem;
+	char          path[PATH_MAX], root[PATH_MAX];
+	struct stat   s;
+	FILE          *fp;
+	
+	while (dirp && (ditem = readdir(dirp))) {
+		if (ditem->d_name[0] == '.' || !std::strcmp(ditem->d_name, key)) {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/%s/" SCRATCH_MARKER, users,
+		              ditem->d_name);
+		if ((fp = std::fopen(path, "r"))) {
+			bool is_read = std::fgets(root, sizeof(root), fp) != NULL;
+			
+			std::fclose(fp);
+			root[is_read ? std::strcspn(root, "\n") : 0] = '\0';
+			std::snprintf(path, sizeof(path), "%s/.unum/config/manifest.umy",
+			              root);
+			if (!is_read || stat(path, &s) == 0) {
+				continue;
+			}
+			
+		} else {
+			std::snprintf(path, sizeof(path), "%s/%s", users, ditem->d_name);
+			if (lstat(path, &s) != 0 || (s.st_mode & S_IFMT) != S_IFDIR ||
+			    s.st_mtime > time(NULL) - SCRATCH_STALE) {
+				continue;
+			}
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/%s", users, ditem->d_name);
+		remove_tree(path);
+	}
+	
+	if (dirp) {
+		closedir(dirp);
+	}
+}
+
+
+static bool write_marker( const char *dir, const char *root ) {
+	char        path[PATH_MAX];
+	struct stat s;
+	FILE        *fp;
+	
+	std::snprintf(path, sizeof(path), "%s/" SCRATCH_MARKER, dir);
+	if (stat(path, &s) == 0) {
+		return true;
+	}
+	
+	if (!(fp = std::fopen(path, "w"))) {
+		return false;
+	}
+	std::fprintf(fp, "%s\n", root);
+	return std::fclose(fp) == 0;
+}
+
+
+bool un::scratch_open( char *dir, size_t len, long long cap ) {
+	const char *bases[] = { std::getenv("XDG_RUNTIME_DIR"), "/dev/shm" };
+	const char *root    = basis_path(BP_ROOT);
+	char       key[UNUM_HASH_HEX_LEN], users[PATH_MAX];
+	
+	if (cap <= 0 || !root) {
+		return false;
+	}
+	
+	checkout_key(root, key);
+	for (size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); i++) {
+		if (!bases[i] || !is_ram_backed(bases[i]) ||
+		    free_bytes(bases[i]) < SCRATCH_RESERVE ||
+		    !make_dir(user_dir(bases[i], users, sizeof(users)))) {
+			continue;
+		}
+		
+		prune_checkouts(users, key);
+		std::snprintf(dir, len, "%s/%s", users, key);
+		if (!make_dir(dir) || !write_marker(dir, root)) {
+			continue;
+		}
+		
+		return true;
+	}
+	
+	return false;
+}
+
+
+bool un::scratch_find( char *dir, size_t len ) {
+	const char  *bases[] = { std::getenv("XDG_RUNTIME_DIR"), "/dev/shm" };
+	const char  *root    = basis_path(BP_ROOT);
+	char        key[UNUM_HASH_HEX_LEN], users[PATH_MAX];
+	struct stat s;
+	
+	if (!root) {
+		return false;
+	}
+	
+	checkout_key(root, key);
+	for (size_t i = 0; i < sizeof(bases) / sizeof(bases[0]); i++) {
+		if (!bases[i]) {
+			continue;
+		}
+		
+		std::snprintf(dir, len, "%s/%s", user_dir(bases[i], users,
+		              sizeof(users)), key);
+		if (stat(dir, &s) == 0 && (s.st_mode & S_IFMT) == S_IFDIR) {
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+
+static int by_mtime( const void *e1, const void *e2 ) {
+	const entry_t *p1 = (const entry_t *) e1, *p2 = (const entry_t *) e2;
+	return (p1->mtime > p2->mtime) - (p1->mtime < p2->mtime);
+}
+
+
+static int by_ino( const void *i1, const void *i2 ) {
+	ino_t n1 = *(const ino_t *) i1, n2 = *(const ino_t *) i2;
+	return (n1 > n2) - (n1 < n2);
+}
+
+
+// ...removes what isn't kept and collects the rest, returning the count
+static long trim_files( const char *dir, const ino_t *keep, int num_keep,
+                        entry_t **entries, long num, long *max ) {
+	DIR           *dirp = opendir(dir);
+	struct dirent *ditem;
+	char          path[PATH_MAX];
+	struct stat   s;
+	
+	while (dirp && (ditem = readdir(dirp))) {
+		if (!std::strcmp(ditem->d_name, ".") ||
+		    !std::strcmp(ditem->d_name, "..")) {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/%s", dir, ditem->d_name);
+		if (lstat(path, &s) != 0) {
+			continue;
+		}
+		
+		if ((s.st_mode & S_IFMT) == S_IFDIR) {
+			num = trim_files(path, keep, num_keep, entries, num, max);
+			rmdir(path);
+			continue;
+		}
+		
+		if (!std::bsearch(&s.st_ino, keep, (size_t) num_keep, sizeof(ino_t),
+		                  by_ino)) {
+			unlink(path);
+			continue;
+		}
+		
+		if (num == *max) {
+			entry_t *tmp;
+			*max = *max ? *max * 2 : 256;
+			if (!(tmp = (entry_t *) std::realloc(*entries,
+			                                     sizeof(entry_t) * *max))) {
+				break;
+			}
+			*entries = tmp;
+		}
+		
+		(*entries)[num].mtime = s.st_mtime;
+		(*entries)[num].size  = (long long) s.st_blocks * 512;
+		(*entries)[num].path  = strdup(path);
+		num++;
+	}
+	
+	if (dirp) {
+		closedir(dirp);
+	}
+	return num;
+}
+
+
+void un::scratch_trim( const char *dir, const char **keep, int num_keep,
+                       long long cap ) {
+	ino_t       *inos = (ino_t *) std::malloc(sizeof(ino_t) * (num_keep + 1));
+	entry_t     *entries = NULL;
+	long        num, max = 0;
+	long long   total = 0;
+	int         num_inos = 0;
+	char        path[PATH_MAX];
+	struct stat s;
+	
+	if (!inos) {
+		return;
+	}
+	
+	// - files are matched by identity, whatever their paths were spelled as
+	std::snprintf(path, sizeof(path), "%s/" SCRATCH_MARKER, dir);
+	for (int i = -1; i < num_keep; i++) {
+		if (stat(i < 0 ? path : keep[i], &s) == 0) {
+			inos[num_inos++] = s.st_ino;
+		}
+	}
+	std::qsort(inos, (size_t) num_inos, sizeof(ino_t), by_ino);
+	
+	num = trim_files(dir, inos, num_inos, &entries, 0, &max);
+	for (long i = 0; i < num; i++) {
+		total += entries[i].size;
+	}
+	
+	// - the oldest go first, whatever is still current is only rebuilt
+	std::qsort(entries, (size_t) num, sizeof(entry_t), by_mtime);
+	for (long i = 0; i < num && total >= cap; i++) {
+		if (entries[i].path && std::strcmp(entries[i].path, path) &&
+		    unlink(entries[i].path) == 0) {
+			total -= entries[i].size;
+		}
+	}
+	
+	for (long i = 0; i < num; i++) {
+		std::free(entries[i].path);
+	}
+	std::free(entries);
+	std::free(inos);
+}
+
+
+bool un::scratch_low( const char *dir ) {
+	return free_bytes(dir) < SCRATCH_RESERVE;
+}
+
+
+long long un::scratch_usage( const char *dir ) {
+	return disk_usage(dir);
+}
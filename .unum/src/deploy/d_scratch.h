@@ -0,0 +1,50 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_SCRATCH_H
+#define UNUM_SCRATCH_H
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  Scratch space is a RAM-backed directory (eg. /dev/shm) private to this
+ *  checkout for intermediate build outputs.  It is only offered when `cap`
+ *  allows any and the file system has room to spare, so callers must 
+ *  always be prepared to use the disk instead.  Opening it reclaims the
+ *  directories of checkouts that no longer exist.  Its contents don't 
+ *  survive a reboot, after which units come from the shared store if one
+ *  is configured or are built again.
+ */
+extern bool scratch_open( char *dir, size_t len, long long cap );
+
+
+// - finds this checkout's scratch directory without creating it
+extern bool scratch_find( char *dir, size_t len );
+
+
+/*
+ *  scratch_trim()
+ *  - removes every file under `dir` that isn't named in `keep`, and then
+ *    the oldest of those that are until it holds less than `cap` bytes.
+ */
+extern void scratch_trim( const char *dir, const char **keep, int num_keep,
+                          long long cap );
+
+
+// - true when the file system under `dir` is nearly exhausted
+extern bool scratch_low( const char *dir );
+
+
+// - the bytes used under `dir`, for checking it against the cap as it fills
+extern long long scratch_usage( const char *dir );
+
+
+}
+#endif /* UNUM_SCRATCH_H */
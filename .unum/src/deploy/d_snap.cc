@@ -0,0 +1,572 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_hash.h"
+#include "d_snap.h"
+
+/*
+ *  <snapshot-layout>
+ *
+ *  header              - magic, directory, entry and string counts
+ *  dirs[d]             - modification time, identity and name digest of
+ *                        each directory, with the range of its entries
+ *  entries[e]          - size, modification time and identity of each
+ *                        entry, sorted by name within its directory
+ *  strings             - directory paths and entry names
+ *
+ *  Like the graph it is used where it was written, so it is kept in the
+ *  native byte order and discarded when it doesn't fit.
+ */
+
+#define SNAP_MAGIC  "USN1"
+
+typedef struct {
+	char     magic[4];
+	uint32_t num_dirs;
+	uint32_t num_entries;
+	uint32_t str_len;
+} snap_hdr_t;
+
+typedef struct {
+	int64_t    mtime_s;
+	int64_t    mtime_ns;
+	uint64_t   ino;
+	un::hash_t names;       // - digest of the names it holds, in order
+	uint32_t   path;        // - offset into the string table
+	uint32_t   first;       // - entries[first] up to entries[first + num]
+	uint32_t   num;
+	uint32_t   pad;
+} snap_dir_t;
+
+typedef struct {
+	int64_t  size;
+	int64_t  mtime_s;
+	int64_t  mtime_ns;
+	uint64_t ino;
+	uint32_t name;
+	uint32_t is_dir;
+} snap_entry_t;
+
+struct un::snap_s {
+	void         *base;
+	size_t       len;
+	bool         is_mapped;
+	snap_hdr_t   *hdr;
+	snap_dir_t   *dirs;
+	snap_entry_t *entries;
+	const char   *strings;
+};
+
+typedef struct {
+	char     *buf;
+	size_t   len;
+	size_t   cap;
+	char     **names;
+	uint32_t num;
+} listing_t;
+
+typedef struct {
+	snap_dir_t   *dirs;
+	uint32_t     num_dirs;
+	uint32_t     cap_dirs;
+	snap_entry_t *entries;
+	uint32_t     num_entries;
+	uint32_t     cap_entries;
+	char         *strings;
+	size_t       str_len;
+	size_t       str_cap;
+	struct stat  *seen;     // - directories already listed, by identity
+	uint32_t     num_seen;
+	uint32_t     cap_seen;
+	struct stat  skip;
+	bool         has_skip;
+	bool         is_ok;
+} builder_t;
+
+
+static void mtime_of( const struct stat *st, int64_t *sec, int64_t *nsec ) {
+#if UNUM_OS_MACOS
+	*sec  = st->st_mtimespec.tv_sec;
+	*nsec = st->st_mtimespec.tv_nsec;
+#else
+	*sec  = st->st_mtim.tv_sec;
+	*nsec = st->st_mtim.tv_nsec;
+#endif
+}
+
+
+static bool grow( void **ptr, uint32_t *cap, uint32_t want, size_t size ) {
+	void     *tmp;
+	uint32_t num;
+	
+	if (want <= *cap) {
+		return true;
+	}
+	
+	num = want * 2 + 16;
+	if (!(tmp = std::realloc(*ptr, (size_t) num * size))) {
+		return false;
+	}
+	*ptr = tmp;
+	*cap = num;
+	return true;
+}
+
+
+static int name_cmp( const void *a, const void *b ) {
+	return std::strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+
+// ...every name in the directory except the repository's own, sorted
+static bool list_dir( int dfd, listing_t *ls ) {
+	DIR           *dirp;
+	struct dirent *ditem;
+	int           fd = dup(dfd);
+	
+	ls->len = 0;
+	ls->num = 0;
+	if (fd < 0 || !(dirp = fdopendir(fd))) {
+		if (fd >= 0) {
+			close(fd);
+		}
+		return false;
+	}
+	
+	rewinddir(dirp);
+	while ((ditem = readdir(dirp))) {
+		size_t len = std::strlen(ditem->d_name) + 1;
+		
+		if (!std::strcmp(ditem->d_name, ".") ||
+		    !std::strcmp(ditem->d_name, "..") ||
+		    !std::strcmp(ditem->d_name, ".git")) {
+			continue;
+		}
+		
+		if (ls->len + len > ls->cap) {
+			size_t cap = (ls->len + len) * 2 + 256;
+			char   *tmp = (char *) std::realloc(ls->buf, cap);
+			if (!tmp) {
+				closedir(dirp);
+				return false;
+			}
+			ls->buf = tmp;
+			ls->cap = cap;
+		}
+		std::memcpy(ls->buf + ls->len, ditem->d_name, len);
+		ls->len += len;
+		ls->num++;
+	}
+	closedir(dirp);
+	
+	// - names are only pointed at once the buffer has stopped moving
+	std::free(ls->names);
+	if (!(ls->names = (char **) std::malloc(sizeof(char *) *
+	                                        (ls->num ? ls->num : 1)))) {
+		return false;
+	}
+	for (size_t i = 0, n = 0; n < ls->num; n++) {
+		ls->names[n] = ls->buf + i;
+		i           += std::strlen(ls->buf + i) + 1;
+	}
+	std::qsort(ls->names, ls->num, sizeof(char *), name_cmp);
+	return true;
+}
+
+
+static un::hash_t names_digest( const listing_t *ls ) {
+	un::hash_ctx_t ctx;
+	
+	un::hash_init(&ctx);
+	for (uint32_t i = 0; i < ls->num; i++) {
+		un::hash_update(&ctx, ls->names[i], std::strlen(ls->names[i]) + 1);
+	}
+	return un::hash_final(&ctx);
+}
+
+
+static uint32_t add_string( builder_t *b, const char *text ) {
+	size_t len = std::strlen(text) + 1;
+	size_t ret = b->str_len;
+	
+	if (b->str_len + len > b->str_cap) {
+		size_t cap = (b->str_len + len) * 2 + 4096;
+		char   *tmp = (char *) std::realloc(b->strings, cap);
+		if (!tmp) {
+			b->is_ok = false;
+			return 0;
+		}
+		b->strings = tmp;
+		b->str_cap = cap;
+	}
+	
+	std::memcpy(b->strings + b->str_len, text, len);
+	b->str_len += len;
+	return (uint32_t) ret;
+}
+
+
+static bool is_same( const struct stat *a, const struct stat *b ) {
+	return a->st_dev == b->st_dev && a->st_ino == b->st_ino;
+}
+
+
+static void walk( builder_t *b, const char *path, bool is_recursive ) {
+	listing_t   ls;
+	struct stat s;
+	snap_dir_t  *d;
+	uint32_t    first;
+	char        sub[PATH_MAX];
+	int         dfd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	
+	if (dfd < 0) {
+		return;
+	}
+	
+	// - the same directory may be reached by more than one name
+	if (fstat(dfd, &s) != 0 || (b->has_skip && is_same(&s, &b->skip)) ||
+	    !grow((void **) &b->seen, &b->cap_seen, b->num_seen + 1,
+	          sizeof(struct stat))) {
+		close(dfd);
+		return;
+	}
+	for (uint32_t i = 0; i < b->num_seen; i++) {
+		if (is_same(&s, &b->seen[i])) {
+			close(dfd);
+			return;
+		}
+	}
+	b->seen[b->num_seen++] = s;
+	
+	std::memset(&ls, 0, sizeof(ls));
+	if (!list_dir(dfd, &ls) ||
+	    !grow((void **) &b->dirs, &b->cap_dirs, b->num_dirs + 1,
+	          sizeof(snap_dir_t)) ||
+	    !grow((void **) &b->entries, &b->cap_entries,
+	          b->num_entries + ls.num, sizeof(snap_entry_t))) {
+		b->is_ok = false;
+		close(dfd);
+		std::free(ls.buf);
+		std::free(ls.names);
+		return;
+	}
+	
+	std::snprintf(sub, sizeof(sub), "%s", path);
+	first = b->num_entries;
+	d     = &b->dirs[b->num_dirs++];
+	std::memset(d, 0, sizeof(*d));
+	mtime_of(&s, &d->mtime_s, &d->mtime_ns);
+	d->ino   = (uint64_t) s.st_ino;
+	d->names = names_digest(&ls);
+	d->path  = add_string(b, un::journal_norm(sub));
+	d->first = first;
+	d->num   = ls.num;
+	
+	for (uint32_t i = 0; i < ls.num; i++) {
+		snap_entry_t *e = &b->entries[b->num_entries++];
+		
+		std::memset(e, 0, sizeof(*e));
+		e->name = add_string(b, ls.names[i]);
+		if (fstatat(dfd, ls.names[i], &s, 0) != 0) {
+			e->size = -1;
+			continue;
+		}
+		
+		mtime_of(&s, &e->mtime_s, &e->mtime_ns);
+		e->size   = (int64_t) s.st_size;
+		e->ino    = (uint64_t) s.st_ino;
+		e->is_dir = S_ISDIR(s.st_mode) ? 1 : 0;
+	}
+	close(dfd);
+	
+	// - entries are contiguous by directory, so children are taken after
+	for (uint32_t i = 0; is_recursive && b->is_ok && i < ls.num; i++) {
+		if (b->entries[first + i].is_dir) {
+			std::snprintf(sub, sizeof(sub), "%s/%s", path, ls.names[i]);
+			walk(b, sub, true);
+		}
+	}
+	
+	std::free(ls.buf);
+	std::free(ls.names);
+}
+
+
+un::snap_t *un::snap_build( const char **dirs, const bool *is_recursive,
+                            int num_dirs, const char *skip ) {
+	builder_t  b;
+	snap_t     *ret;
+	size_t     len;
+	char       *bp;
+	
+	std::memset(&b, 0, sizeof(b));
+	b.is_ok    = true;
+	b.has_skip = skip && stat(skip, &b.skip) == 0;
+	
+	for (int i = 0; b.is_ok && i < num_dirs; i++) {
+		walk(&b, dirs[i], is_recursive[i]);
+	}
+	
+	len = sizeof(snap_hdr_t) + sizeof(snap_dir_t) * b.num_dirs +
+	      sizeof(snap_entry_t) * b.num_entries + b.str_len;
+	ret = b.is_ok ? (snap_t *) std::calloc(1, sizeof(snap_t)) : NULL;
+	bp  = ret ? (char *) std::malloc(len) : NULL;
+	if (!bp) {
+		std::free(ret);
+		ret = NULL;
+	
+	} else {
+		snap_hdr_t hdr;
+		
+		std::memcpy(hdr.magic, SNAP_MAGIC, 4);
+		hdr.num_dirs    = b.num_dirs;
+		hdr.num_entries = b.num_entries;
+		hdr.str_len     = (uint32_t) b.str_len;
+		
+		ret->base    = bp;
+		ret->len     = len;
+		ret->hdr     = (snap_hdr_t *) bp;
+		ret->dirs    = (snap_dir_t *) (bp + sizeof(hdr));
+		ret->entries = (snap_entry_t *) (ret->dirs + b.num_dirs);
+		ret->strings = (const char *) (ret->entries + b.num_entries);
+		std::memcpy(bp, &hdr, sizeof(hdr));
+		std::memcpy(ret->dirs, b.dirs, sizeof(snap_dir_t) * b.num_dirs);
+		std::memcpy(ret->entries, b.entries,
+		            sizeof(snap_entry_t) * b.num_entries);
+		std::memcpy((char *) ret->strings, b.strings, b.str_len);
+	}
+	
+	std::free(b.dirs);
+	std::free(b.entries);
+	std::free(b.strings);
+	std::free(b.seen);
+	return ret;
+}
+
+
+bool un::snap_save( const snap_t *snap, const char *path ) {
+	char tmp[PATH_MAX];
+	int  fd;
+	bool ok;
+	
+	if (!snap ||
+	    std::snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", path, (long) getpid()) >=
+	    (int) sizeof(tmp) ||
+	    (fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR)) < 0) {
+		return false;
+	}
+	
+	ok = write(fd, snap->base, snap->len) == (ssize_t) snap->len;
+	ok = (close(fd) == 0) && ok;
+	if (!ok || rename(tmp, path) != 0) {
+		unlink(tmp);
+		return false;
+	}
+	
+	return true;
+}
+
+
+un::snap_t *un::snap_load( const char *path ) {
+	struct stat s;
+	snap_t      *ret;
+	void        *base;
+	snap_hdr_t  *hdr;
+	size_t      fixed;
+	int         fd = open(path, O_RDONLY | O_CLOEXEC);
+	
+	if (fd < 0) {
+		return NULL;
+	}
+	
+	if (fstat(fd, &s) != 0 || (size_t) s.st_size < sizeof(snap_hdr_t) ||
+	    (base = mmap(NULL, (size_t) s.st_size, PROT_READ, MAP_PRIVATE, fd,
+	                 0)) == MAP_FAILED) {
+		close(fd);
+		return NULL;
+	}
+	close(fd);
+	
+	hdr   = (snap_hdr_t *) base;
+	fixed = sizeof(snap_hdr_t) + sizeof(snap_dir_t) * (size_t) hdr->num_dirs +
+	        sizeof(snap_entry_t) * (size_t) hdr->num_entries;
+	if (std::memcmp(hdr->magic, SNAP_MAGIC, 4) || !hdr->str_len ||
+	    fixed + hdr->str_len != (size_t) s.st_size ||
+	    ((const char *) base)[s.st_size - 1] != '\0' ||
+	    !(ret = (snap_t *) std::calloc(1, sizeof(snap_t)))) {
+		munmap(base, (size_t) s.st_size);
+		return NULL;
+	}
+	
+	ret->base      = base;
+	ret->len       = (size_t) s.st_size;
+	ret->is_mapped = true;
+	ret->hdr       = hdr;
+	ret->dirs      = (snap_dir_t *) (hdr + 1);
+	ret->entries   = (snap_entry_t *) (ret->dirs + hdr->num_dirs);
+	ret->strings   = (const char *) (ret->entries + hdr->num_entries);
+	
+	// - offsets are checked once so that they can be trusted afterwards
+	for (uint32_t i = 0; i < hdr->num_dirs; i++) {
+		snap_dir_t *d = &ret->dirs[i];
+		if (d->path >= hdr->str_len || d->first > hdr->num_entries ||
+		    d->num > hdr->num_entries - d->first) {
+			snap_close(ret);
+			return NULL;
+		}
+	}
+	for (uint32_t i = 0; i < hdr->num_entries; i++) {
+		if (ret->entries[i].name >= hdr->str_len) {
+			snap_close(ret);
+			return NULL;
+		}
+	}
+	
+	return ret;
+}
+
+
+void un::snap_close( snap_t *snap ) {
+	if (!snap) {
+		return;
+	}
+	
+	if (snap->is_mapped) {
+		munmap(snap->base, snap->len);
+	} else {
+		std::free(snap->base);
+	}
+	std::free(snap);
+}
+
+
+static bool add_path( un::journal_log_t *log, size_t *cap, const char *dir,
+                      const char *name ) {
+	size_t len = std::strlen(dir) + std::strlen(name) + 2;
+	
+	if (log->len + len > *cap) {
+		size_t new_cap = (log->len + len) * 2 + 256;
+		char   *tmp    = (char *) std::realloc(log->paths, new_cap);
+		if (!tmp) {
+			return false;
+		}
+		log->paths = tmp;
+		*cap       = new_cap;
+	}
+	
+	std::snprintf(log->paths + log->len, len, "%s/%s", dir, name);
+	un::journal_norm(log->paths + log->len);
+	log->len += std::strlen(log->paths + log->len) + 1;
+	log->num_paths++;
+	return true;
+}
+
+
+// ...whether the entry is no longer what was recorded
+static bool is_modified( int dfd, const char *name, const snap_entry_t *e ) {
+	struct stat s;
+	int64_t     sec, nsec;
+	
+	if (fstatat(dfd, name, &s, 0) != 0) {
+		return e->size >= 0;
+	}
+	
+	// - a subdirectory's contents are its own record's concern
+	if (e->is_dir || S_ISDIR(s.st_mode)) {
+		return !e->is_dir != !S_ISDIR(s.st_mode);
+	}
+	
+	mtime_of(&s, &sec, &nsec);
+	return e->size != (int64_t) s.st_size || e->mtime_s != sec ||
+	       e->mtime_ns != nsec || e->ino != (uint64_t) s.st_ino;
+}
+
+
+bool un::snap_diff( const snap_t *snap, journal_log_t *log ) {
+	listing_t ls;
+	size_t    cap = 0;
+	bool      ok  = true;
+	
+	std::memset(log, 0, sizeof(*log));
+	std::memset(&ls, 0, sizeof(ls));
+	for (uint32_t i = 0; ok && i < snap->hdr->num_dirs; i++) {
+		const snap_dir_t   *d    = &snap->dirs[i];
+		const snap_entry_t *ents = &snap->entries[d->first];
+		const char         *path = snap->strings + d->path;
+		int                dfd   = open(path, O_RDONLY | O_DIRECTORY |
+		                                      O_CLOEXEC);
+		struct stat        s;
+		int64_t            sec, nsec;
+		bool               is_listed = false;
+		
+		if (dfd < 0 || fstat(dfd, &s) != 0) {
+			for (uint32_t j = 0; ok && j < d->num; j++) {
+				ok = add_path(log, &cap, path, snap->strings + ents[j].name);
+			}
+			if (dfd >= 0) {
+				close(dfd);
+			}
+			continue;
+		}
+		
+		// - a directory's time only changes with the names it holds
+		mtime_of(&s, &sec, &nsec);
+		if (sec != d->mtime_s || nsec != d->mtime_ns ||
+		    (uint64_t) s.st_ino != d->ino) {
+			if (!list_dir(dfd, &ls)) {
+				close(dfd);
+				ok = false;
+				break;
+			}
+			is_listed = !un::hash_equal(names_digest(&ls), d->names);
+		}
+		
+		// - otherwise the names are those recorded, in the same order
+		for (uint32_t j = 0, n = 0; ok && (j < d->num ||
+		                                   (is_listed && n < ls.num));) {
+			const char *name = j < d->num ? snap->strings + ents[j].name
+			                              : NULL;
+			int        cmp   = !is_listed ? 0 :
+			                   !name ? 1 : n >= ls.num ? -1 :
+			                   std::strcmp(name, ls.names[n]);
+			
+			if (cmp < 0) {
+				ok = add_path(log, &cap, path, name);
+				j++;
+			} else if (cmp > 0) {
+				ok = add_path(log, &cap, path, ls.names[n]);
+				n++;
+			} else {
+				if (is_modified(dfd, name, &ents[j])) {
+					ok = add_path(log, &cap, path, name);
+				}
+				j++;
+				n++;
+			}
+		}
+		close(dfd);
+	}
+	
+	std::free(ls.buf);
+	std::free(ls.names);
+	if (!ok) {
+		journal_free(log);
+	}
+	return ok;
+}
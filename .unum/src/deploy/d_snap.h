@@ -0,0 +1,46 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_SNAP_H
+#define UNUM_SNAP_H
+
+#include "d_journal.h"
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  A snapshot records the directories whose contents matter to a deploy,
+ *  each with its own modification time, a digest of the names it holds
+ *  and the size and modification time of every entry.  It stands in for
+ *  the journal when no monitor is running, at the cost of a stat of each
+ *  entry, since writing a file in place doesn't change its directory.
+ */
+typedef struct snap_s snap_t;
+
+
+// - `skip` (optional) is a directory that is never descended into
+extern snap_t *snap_build( const char **dirs, const bool *is_recursive,
+                           int num_dirs, const char *skip );
+extern bool   snap_save( const snap_t *snap, const char *path );
+extern snap_t *snap_load( const char *path );
+extern void   snap_close( snap_t *snap );
+
+
+/*
+ *  snap_diff()
+ *  - finds the entries added, removed or modified since the snapshot in
+ *    the same form as the journal.  Directories are only listed again when
+ *    their modification time or identity changed.
+ */
+extern bool   snap_diff( const snap_t *snap, journal_log_t *log );
+
+
+}
+#endif /* UNUM_SNAP_H */
@@ -0,0 +1,390 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_lz.h"
+#include "d_store.h"
+
+/*
+ *  <store-layout>
+ *
+ *  <dir>/lock                 - flock(2) serializes stats and eviction
+ *  <dir>/stats                - cumulative hit/miss/eviction counts
+ *  <dir>/objects/ab/ab...     - entries, the mtime is the last access
+ *
+ *  Entries are a 4-byte magic, the 8-byte little-endian uncompressed size
+ *  and the LZ block.  They are written to a temporary file and renamed so
+ *  that readers never observe a partial entry.
+ */
+
+#define STORE_MAGIC   "ULZ1"
+#define HDR_LEN       12
+
+
+static bool entry_path( char *buf, const char *dir, const char *key ) {
+	if (std::strlen(key) < 3) {
+		return false;
+	}
+	return std::snprintf(buf, PATH_MAX, "%s/objects/%.2s/%s", dir, key, key) <
+	       PATH_MAX;
+}
+
+
+static bool make_dir( const char *path ) {
+	return mkdir(path, S_IRWXU) == 0 || errno == EEXIST;
+}
+
+
+static bool read_all( const char *path, unsigned char **buf, size_t *len ) {
+	struct stat s;
+	int         fd = open(path, O_RDONLY);
+	size_t      pos = 0;
+	
+	*buf = NULL;
+	if (fd < 0) {
+		return false;
+	}
+	
+	if (fstat(fd, &s) != 0 || !(*buf = (unsigned char *)
+	                            std::malloc((size_t) s.st_size + 1))) {
+		close(fd);
+		return false;
+	}
+	
+	while (pos < (size_t) s.st_size) {
+		ssize_t rc = read(fd, *buf + pos, (size_t) s.st_size - pos);
+		if (rc <= 0) {
+			break;
+		}
+		pos += (size_t) rc;
+	}
+	close(fd);
+	
+	if (pos != (size_t) s.st_size) {
+		std::free(*buf);
+		*buf = NULL;
+		return false;
+	}
+	
+	*len = pos;
+	return true;
+}
+
+
+// ...writes through a temporary so the destination is replaced atomically
+static bool write_all( const char *path, const void *data, size_t len ) {
+	char tmp[PATH_MAX];
+	int  fd;
+	bool ok;
+	
+	std::snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", path, (long) getpid());
+	if ((fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR)) < 0) {
+		return false;
+	}
+	
+	ok = write(fd, data, len) == (ssize_t) len;
+	ok = (close(fd) == 0) && ok;
+	if (!ok || rename(tmp, path) != 0) {
+		unlink(tmp);
+		return false;
+	}
+	
+	return true;
+}
+
+
+static int lock_store( const char *dir ) {
+	char path[PATH_MAX];
+	int  fd;
+	
+	std::snprintf(path, sizeof(path), "%s/lock", dir);
+	if ((fd = open(path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR)) < 0) {
+		return -1;
+	}
+	
+	if (flock(fd, LOCK_EX) != 0) {
+		close(fd);
+		return -1;
+	}
+	
+	return fd;
+}
+
+
+static void unlock_store( int fd ) {
+	flock(fd, LOCK_UN);
+	close(fd);
+}
+
+
+static void read_counts( const char *dir, un::store_stats_t *stats ) {
+	char path[PATH_MAX];
+	FILE *fp;
+	
+	std::snprintf(path, sizeof(path), "%s/stats", dir);
+	if ((fp = std::fopen(path, "r"))) {
+		if (std::fscanf(fp, "hits %lld\nmisses %lld\nevictions %lld",
+		                &stats->hits, &stats->misses, &stats->evictions) != 3) {
+			stats->hits = stats->misses = stats->evictions = 0;
+		}
+		std::fclose(fp);
+	}
+}
+
+
+static bool write_counts( const char *dir, const un::store_stats_t *stats ) {
+	char path[PATH_MAX];
+	char buf[256];
+	int  len;
+	
+	std::snprintf(path, sizeof(path), "%s/stats", dir);
+	len = std::snprintf(buf, sizeof(buf), "hits %lld\nmisses %lld\n"
+	                    "evictions %lld\n", stats->hits, stats->misses,
+	                    stats->evictions);
+	return write_all(path, buf, (size_t) len);
+}
+
+
+bool un::store_fetch( const char *dir, const char *key, const char *dst ) {
+	char           path[PATH_MAX];
+	unsigned char  *buf = NULL, *out = NULL;
+	size_t         len;
+	uint64_t       raw  = 0;
+	bool           ok   = false;
+	
+	if (!entry_path(path, dir, key) || !read_all(path, &buf, &len)) {
+		return false;
+	}
+	
+	if (len >= HDR_LEN && !std::memcmp(buf, STORE_MAGIC, 4)) {
+		for (int i = 0; i < 8; i++) {
+			raw |= (uint64_t) buf[4 + i] << (i * 8);
+		}
+		
+		ok = (out = (unsigned char *) std::malloc(raw ? raw : 1)) &&
+		     lz_decompress(buf + HDR_LEN, len - HDR_LEN, out, raw) &&
+		     write_all(dst, out, raw);
+	}
+	
+	std::free(buf);
+	std::free(out);
+	
+	if (ok) {
+		utimes(path, NULL);     // - least-recently-used is by mtime
+	} else {
+		unlink(path);           // - corrupt entries are just dropped
+	}
+	
+	return ok;
+}
+
+
+bool un::store_put( const char *dir, const char *key, const char *src ) {
+	char           path[PATH_MAX];
+	char           fan_out[PATH_MAX];
+	unsigned char  *buf = NULL, *out = NULL;
+	size_t         len, cap, clen;
+	bool           ok  = false;
+	
+	if (!entry_path(path, dir, key) || !read_all(src, &buf, &len)) {
+		return false;
+	}
+	
+	std::snprintf(fan_out, sizeof(fan_out), "%s/objects", dir);
+	if (!make_dir(dir) || !make_dir(fan_out)) {
+		std::free(buf);
+		return false;
+	}
+	std::snprintf(fan_out, sizeof(fan_out), "%s/objects/%.2s", dir, key);
+	
+	cap = HDR_LEN + UNUM_LZ_BOUND(len);
+	if ((out = (unsigned char *) std::malloc(cap)) &&
+	    (clen = lz_compress(buf, len, out + HDR_LEN, cap - HDR_LEN)) > 0) {
+		std::memcpy(out, STORE_MAGIC, 4);
+		for (int i = 0; i < 8; i++) {
+			out[4 + i] = (unsigned char) ((uint64_t) len >> (i * 8));
+		}
+		
+		ok = make_dir(fan_out) && write_all(path, out, HDR_LEN + clen);
+	}
+	
+	std::free(buf);
+	std::free(out);
+	return ok;
+}
+
+
+typedef struct {
+	time_t    mtime;
+	long long size;
+	char      *path;
+} entry_t;
+
+
+static int by_mtime( const void *e1, const void *e2 ) {
+	const entry_t *p1 = (const entry_t *) e1, *p2 = (const entry_t *) e2;
+	return (p1->mtime > p2->mtime) - (p1->mtime < p2->mtime);
+}
+
+
+// ...collects every entry in the store, returning the count or -1
+static long scan_entries( const char *dir, entry_t **entries,
+                          long long *total ) {
+	char          path[PATH_MAX];
+	long          num = 0, max = 0;
+	DIR           *top, *sub;
+	struct dirent *td, *sd;
+	struct stat   s;
+	
+	*entries = NULL;
+	*total   = 0;
+	
+	std::snprintf(path, sizeof(path), "%s/objects", dir);
+	if (!(top = opendir(path))) {
+		return 0;
+	}
+	
+	while ((td = readdir(top))) {
+		if (td->d_name[0] == '.') {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/objects/%s", dir, td->d_name);
+		if (!(sub = opendir(path))) {
+			continue;
+		}
+		
+		while ((sd = readdir(sub))) {
+			char *file;
+			
+			if (sd->d_name[0] == '.' || std::strstr(sd->d_name, ".tmp")) {
+				continue;
+			}
+			
+			std::snprintf(path, sizeof(path), "%s/objects/%s/%s", dir,
+			              td->d_name, sd->d_name);
+			if (stat(path, &s) != 0 || !(s.st_mode & S_IFREG)) {
+				continue;
+			}
+			
+			if (num == max) {
+				entry_t *tmp;
+				max = max ? max * 2 : 256;
+				if (!(tmp = (entry_t *) std::realloc(*entries,
+				                                     sizeof(entry_t) * max))) {
+					break;
+				}
+				*entries = tmp;
+			}
+			
+			if (!(file = strdup(path))) {
+				break;
+			}
+			
+			(*entries)[num].mtime = s.st_mtime;
+			(*entries)[num].size  = (long long) s.st_size;
+			(*entries)[num].path  = file;
+			*total               += (long long) s.st_size;
+			num++;
+		}
+		closedir(sub);
+	}
+	closedir(top);
+	
+	return num;
+}
+
+
+static void free_entries( entry_t *entries, long num ) {
+	for (long i = 0; i < num; i++) {
+		std::free(entries[i].path);
+	}
+	std::free(entries);
+}
+
+
+bool un::store_trim( const char *dir, long long budget ) {
+	entry_t       *entries;
+	long          num;
+	long long     total;
+	store_stats_t stats;
+	int           lock;
+	
+	if ((lock = lock_store(dir)) < 0) {
+		return false;
+	}
+	
+	std::memset(&stats, 0, sizeof(stats));
+	read_counts(dir, &stats);
+	
+	num = scan_entries(dir, &entries, &total);
+	if (total > budget) {
+		std::qsort(entries, (size_t) num, sizeof(entry_t), by_mtime);
+		for (long i = 0; i < num && total > budget; i++) {
+			if (unlink(entries[i].path) == 0) {
+				total -= entries[i].size;
+				stats.evictions++;
+			}
+		}
+		write_counts(dir, &stats);
+	}
+	free_entries(entries, num);
+	
+	unlock_store(lock);
+	return true;
+}
+
+
+bool un::store_count( const char *dir, int hits, int misses ) {
+	store_stats_t stats;
+	int           lock;
+	bool          ok;
+	
+	if (!make_dir(dir) || (lock = lock_store(dir)) < 0) {
+		return false;
+	}
+	
+	std::memset(&stats, 0, sizeof(stats));
+	read_counts(dir, &stats);
+	stats.hits   += hits;
+	stats.misses += misses;
+	ok            = write_counts(dir, &stats);
+	
+	unlock_store(lock);
+	return ok;
+}
+
+
+bool un::store_stats( const char *dir, store_stats_t *stats ) {
+	entry_t *entries;
+	int     lock;
+	
+	std::memset(stats, 0, sizeof(*stats));
+	if ((lock = lock_store(dir)) < 0) {
+		return false;
+	}
+	
+	read_counts(dir, stats);
+	stats->entries = scan_entries(dir, &entries, &stats->bytes);
+	free_entries(entries, stats->entries);
+	
+	unlock_store(lock);
+	return true;
+}
@@ -0,0 +1,39 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_STORE_H
+#define UNUM_STORE_H
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  The artifact store is an optional user-level directory of compressed
+ *  build outputs shared by every clone that is configured to use it.  Its 
+ *  entries are addressed by a hash of their inputs so they are safe to share 
+ *  and all operations are best-effort, a failure is never more than a miss.
+ */
+typedef struct {
+	long long hits;
+	long long misses;
+	long long evictions;
+	long long entries;
+	long long bytes;
+} store_stats_t;
+
+
+extern bool store_fetch( const char *dir, const char *key, const char *dst );
+extern bool store_put( const char *dir, const char *key, const char *src );
+extern bool store_trim( const char *dir, long long budget );
+extern bool store_count( const char *dir, int hits, int misses );
+extern bool store_stats( const char *dir, store_stats_t *stats );
+
+
+}
+#endif /* UNUM_STORE_H */
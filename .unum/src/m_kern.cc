@@ -5,15 +5,67 @@
 | SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
 | -------------------------------------------------------------------*/
 
+#include <climits>
 #include <cstdio>
 #include <cstring>
 
 #include "u_common.h"
 #include "m_kern.h"
+#include "m_live.h"
+#include "m_serve.h"
+#include "u_sysinfo.h"
 #include "./deploy/d_deploy.h"
+#include "./deploy/d_store.h"
 
-int un::main(int argc, char **argv) {
-	if (argc > 1 && !std::strcmp(argv[1], "status")) {
+static const char *human_size( long long bytes, char *buf, size_t len ) {
+	const char *units = "BKMGT";
+	double     value  = (double) bytes;
+	
+	for (; value >= 1024.0 && units[1]; units++) {
+		value /= 1024.0;
+	}
+	
+	std::snprintf(buf, len, *units == 'B' ? "%.0f%c" : "%.1f%c", value, *units);
+	return buf;
+}
+
+
+static int cache_status( void ) {
+	char              dir[PATH_MAX];
+	long long         budget;
+	un::store_stats_t stats;
+	long long         total;
+	char              used[32], avail[32];
+	
+	if (!un::deploy_cache(dir, sizeof(dir), &budget)) {
+		std::printf("cache:     not configured\n");
+		return 0;
+	}
+	
+	if (!un::store_stats(dir, &stats)) {
+		std::memset(&stats, 0, sizeof(stats));
+	}
+	
+	total = stats.hits + stats.misses;
+	std::printf("cache:     %s\n", dir);
+	std::printf("entries:   %lld\n", stats.entries);
+	std::printf("size:      %s of %s\n",
+	            human_size(stats.bytes, used, sizeof(used)),
+	            human_size(budget, avail, sizeof(avail)));
+	std::printf("hits:      %lld\n", stats.hits);
+	std::printf("misses:    %lld (%.1f%% hit rate)\n", stats.misses,
+	            total ? (100.0 * stats.hits) / total : 0.0);
+	std::printf("evictions: %lld\n", stats.evictions);
+	return 0;
+}
+
+
+static int command( int argc, char **argv ) {
+	if (argc > 2 && !std::strcmp(argv[1], "status") &&
+	    !std::strcmp(argv[2], "--cache")) {
+		return cache_status();
+		
+	} else if (argc > 1 && !std::strcmp(argv[1], "status")) {
 		int count = un::deploy_status();
 		switch (count) {
 		case 0:
@@ -30,18 +82,108 @@ int un::main(int argc, char **argv) {
 		}
 
 	} else if (argc > 1 && !std::strcmp(argv[1], "deploy")) {
-		char buf[256];
-		if (!un::deploy(buf, sizeof(buf))) {
-			std::printf("unum: failed to deploy kernel");
-			return 1;
-		}
+		char              buf[512];
+		bool              is_changed;
+		int               num_live;
+		un::deploy_opts_t opts;
+		un::deploy_pgo_t  pgo;
+		un::deploy_lto_t  lto;
 		
+		// - the pre-kernel has just built this binary from the full manifest,
+		//   running is sufficient verification without another rebuild.
 		if (argc > 2 && !std::strcmp(argv[2], "--bootstrap")) {
-			// - it would be interesting to avoid a rebuild in favor of
-			//   checking the output of the bootstrapping process.
 	    	std::printf("unum: unum is bootstrapped\n");
+			return 0;
+		}
+		
+		std::memset(&opts, 0, sizeof(opts));
+		std::memset(&pgo, 0, sizeof(pgo));
+		std::memset(&lto, 0, sizeof(lto));
+		opts.pgo = &pgo;
+		opts.lto = &lto;
+		for (int i = 2; i < argc; i++) {
+			if (!std::strcmp(argv[i], "--keep-going") ||
+			    !std::strcmp(argv[i], "-k")) {
+				opts.is_keep_going = true;
+				
+			} else if (!std::strcmp(argv[i], "--profile-compile")) {
+				opts.is_profile = true;
+				
+			} else if (!std::strncmp(argv[i], "--variants=", 11)) {
+				opts.variants = &argv[i][11];
+				
+			} else if (!std::strcmp(argv[i], "--lto")) {
+				opts.is_lto = true;
+				
+			} else if (!std::strncmp(argv[i], "--pgo=", 6) && argv[i][6]) {
+				opts.pgo_cmd = &argv[i][6];
+				
+			} else {
+				std::printf("unum: '%s' is not a deploy option.  See "
+				            "'unum --help'\n", argv[i]);
+				return 1;
+			}
+		}
+		
+		if (!un::deploy(buf, sizeof(buf), &is_changed, &opts)) {
+			std::printf("unum: failed to deploy kernel, %s\n", buf);
+			return 1;
+		}
+		
+		if (pgo.num_units) {
+			std::printf("unum: pgo profile covers %d of %d units (%d%%)%s\n",
+			            pgo.num_covered, pgo.num_units,
+			            (100 * pgo.num_covered) / pgo.num_units,
+			            pgo.is_trained ? ", retrained" : "");
+		}
+		
+		if (lto.jobs) {
+			std::printf("unum: lto compile %.2fs, link %.2fs with %d job%s",
+			            lto.compile_secs, lto.link_secs, lto.jobs,
+			            lto.jobs > 1 ? "s" : "");
+			if (lto.wpa_secs > 0.0 || lto.ltrans_secs > 0.0) {
+				std::printf(" (analysis %.2fs, partitions %.2fs)",
+				            lto.wpa_secs, lto.ltrans_secs);
+			}
+			std::printf("%s\n", lto.is_cached ? "" : ", not incremental with "
+			            "this compiler");
+		}
+		
+		if (!is_changed) {
+			std::printf("unum: kernel is unchanged\n");
+		}
+		
+		// - only a kernel that has loaded live units has any to swap
+		if ((num_live = un::live_refresh()) > 0) {
+			std::printf("unum: %d live unit%s swapped in\n", num_live,
+			            num_live > 1 ? "s" : "");
 		}
 
+	} else if (argc > 1 && !std::strcmp(argv[1], "monitor")) {
+		char buf[512];
+		
+		un::deploy_monitor(buf, sizeof(buf));
+		std::printf("unum: failed to monitor changes, %s\n", buf);
+		return 1;
+		
+	} else if (argc > 1 && !std::strcmp(argv[1], "serve")) {
+		char buf[512];
+		
+		un::serve(command, buf, sizeof(buf));
+		std::printf("unum: failed to serve commands, %s\n", buf);
+		return 1;
+		
+	} else if (argc > 1 && !std::strcmp(argv[1], "sysinfo")) {
+		un::sysinfo_t info;
+		un::sysinfo_query(&info);
+		std::printf("cpus online:  %d\n", info.cpus_online);
+		std::printf("smt per core: %d\n", info.smt_per_core);
+		std::printf("cache L1d:    %ld\n", info.cache_l1d);
+		std::printf("cache L2:     %ld\n", info.cache_l2);
+		std::printf("cache L3:     %ld\n", info.cache_l3);
+		std::printf("cache line:   %d\n", info.cache_line);
+		std::printf("numa nodes:   %d\n", info.numa_nodes);
+
 	} else if (argc > 1 && (!std::strcmp(argv[1], "--version") ||
 						    !std::strcmp(argv[1], "-v"))) {
 		std::printf("unum version %s\n", UNUM_VERSION_S);
@@ -51,8 +193,28 @@ int un::main(int argc, char **argv) {
 		std::printf("usage: unum [-v | --version] [-h | --help] <command>\n");
 		std::printf("\ncommands:\n");
 		std::printf("   status    Show the unum deployment status\n");
+		std::printf("               --cache  Show shared artifact store usage\n");
 		std::printf("   deploy    Rebuild and deploy the service\n");
+		std::printf("               -k, --keep-going  Compile everything "
+		            "possible despite errors\n");
+		std::printf("               --profile-compile Report the costliest "
+		            "headers and templates\n");
+		std::printf("               --lto             Optimize the kernel at "
+		            "link time\n");
+		std::printf("               --pgo=<command>   Optimize with a profile "
+		            "of the command\n");
+		std::printf("               --variants=<list> Deploy kernel, release, "
+		            "debug, asan or ubsan\n");
+		std::printf("   monitor   Journal source changes for status and "
+		            "deploy until killed\n");
+		std::printf("   serve     Answer commands from a resident kernel "
+		            "until killed\n");
+		std::printf("   sysinfo   Show the hardware topology of the host\n");
+		un::live_help();
 	
+	} else if (argc > 1 && un::live_has(argv[1])) {
+		return un::live_run(argc, argv);
+		
 	} else if (argc > 1) {
 		std::printf("unum: '%s' is not an unum command.  See 'unum --help'\n",
 		            argv[1]);
@@ -61,3 +223,16 @@ int un::main(int argc, char **argv) {
 
 	return 0;
 }
+
+
+int un::main(int argc, char **argv) {
+	int rc;
+	
+	// - commands that never finish keep a process of their own
+	if (argc > 1 && std::strcmp(argv[1], "serve") &&
+	    std::strcmp(argv[1], "monitor") && un::serve_forward(argc, argv, &rc)) {
+		return rc;
+	}
+	
+	return command(argc, argv);
+}
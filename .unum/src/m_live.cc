@@ -0,0 +1,220 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_paths.h"
+#include "m_live.h"
+
+#define LIVE_EXT ".so"
+
+typedef struct {
+	char                  *name;
+	void                  *handle;
+	const un::live_unit_t *unit;
+	struct stat           s;        // - the object the unit was loaded from
+	bool                  is_seen;
+} loaded_t;
+
+static loaded_t *loaded    = NULL;
+static int      num_loaded = 0;
+static bool     is_started = false;     // - units are only loaded on demand
+static unsigned num_copies = 0;
+
+
+static bool is_same( const struct stat *a, const struct stat *b ) {
+	return a->st_dev == b->st_dev && a->st_ino == b->st_ino &&
+	       a->st_size == b->st_size && a->st_mtime == b->st_mtime;
+}
+
+
+/*
+ *  The object is loaded through a link of its own, since the loader hands
+ *  back an object it already has by the same name and the old one is
+ *  still loaded while its state is taken.  The link is removed as soon as
+ *  the object is mapped.
+ */
+static void *open_unit( const char *dir, const char *file,
+                        const un::live_unit_t **unit ) {
+	char path[PATH_MAX], copy[PATH_MAX];
+	void *ret;
+	
+	std::snprintf(path, sizeof(path), "%s/%s", dir, file);
+	std::snprintf(copy, sizeof(copy), "%s/.%ld.%u.%s", dir, (long) getpid(),
+	              num_copies++, file);
+	
+	unlink(copy);
+	if (link(path, copy) != 0) {
+		return NULL;
+	}
+	ret = dlopen(copy, RTLD_NOW | RTLD_LOCAL);
+	unlink(copy);
+	if (!ret) {
+		return NULL;
+	}
+	
+	*unit = (const un::live_unit_t *) dlsym(ret, UNUM_LIVE_SYM);
+	if (!*unit || (*unit)->abi != UNUM_LIVE_ABI || !(*unit)->command ||
+	    !(*unit)->run) {
+		dlclose(ret);
+		return NULL;
+	}
+	return ret;
+}
+
+
+static void close_unit( loaded_t *lu ) {
+	if (lu->unit->suspend) {
+		lu->unit->suspend();
+	}
+	dlclose(lu->handle);
+	std::free(lu->name);
+	*lu = loaded[--num_loaded];
+}
+
+
+// ...loads new units and swaps replaced ones, returning how many it loaded
+static int refresh( void ) {
+	const char            *dir = un::basis_path(un::BP_LIVE);
+	DIR                   *dirp = dir ? opendir(dir) : NULL;
+	struct dirent         *ditem;
+	const un::live_unit_t *unit;
+	loaded_t              *lu, *tmp;
+	struct stat           s;
+	char                  path[PATH_MAX];
+	void                  *handle;
+	size_t                len;
+	int                   ret = 0;
+	
+	for (int i = 0; i < num_loaded; i++) {
+		loaded[i].is_seen = false;
+	}
+	
+	while (dirp && (ditem = readdir(dirp))) {
+		len = std::strlen(ditem->d_name);
+		if (ditem->d_name[0] == '.' || len <= sizeof(LIVE_EXT) - 1 ||
+		    std::strcmp(ditem->d_name + len - (sizeof(LIVE_EXT) - 1),
+		                LIVE_EXT)) {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), "%s/%s", dir, ditem->d_name);
+		if (stat(path, &s) != 0) {
+			continue;
+		}
+		
+		for (lu = loaded; lu < loaded + num_loaded &&
+		     std::strcmp(lu->name, ditem->d_name); lu++) {
+		}
+		if (lu < loaded + num_loaded) {
+			lu->is_seen = true;
+			if (is_same(&lu->s, &s)) {
+				continue;
+			}
+		}
+		
+		// - a unit that fails to load leaves the one before it in place
+		if (!(handle = open_unit(dir, ditem->d_name, &unit))) {
+			std::fprintf(stderr, "unum: failed to load live unit %s\n",
+			             ditem->d_name);
+			continue;
+		}
+		
+		if (lu < loaded + num_loaded) {
+			void *state = lu->unit->suspend ? lu->unit->suspend() : NULL;
+			
+			if (unit->resume) {
+				unit->resume(state);
+			}
+			dlclose(lu->handle);
+			
+		} else {
+			tmp = (loaded_t *) std::realloc(loaded, sizeof(loaded_t) *
+			                                (size_t) (num_loaded + 1));
+			if (!tmp) {
+				dlclose(handle);
+				continue;
+			}
+			loaded = tmp;
+			lu     = &loaded[num_loaded];
+			if (!(lu->name = strdup(ditem->d_name))) {
+				dlclose(handle);
+				continue;
+			}
+			num_loaded++;
+			if (unit->resume) {
+				unit->resume(NULL);
+			}
+		}
+		
+		lu->handle  = handle;
+		lu->unit    = unit;
+		lu->s       = s;
+		lu->is_seen = true;
+		ret++;
+	}
+	
+	if (dirp) {
+		closedir(dirp);
+	}
+	
+	// - units no longer deployed are let go, along with their state
+	for (int i = num_loaded - 1; i >= 0; i--) {
+		if (!loaded[i].is_seen) {
+			close_unit(&loaded[i]);
+		}
+	}
+	return ret;
+}
+
+
+static const un::live_unit_t *find( const char *command ) {
+	for (int i = 0; i < num_loaded; i++) {
+		if (!std::strcmp(loaded[i].unit->command, command)) {
+			return loaded[i].unit;
+		}
+	}
+	return NULL;
+}
+
+
+bool un::live_has( const char *command ) {
+	is_started = true;
+	refresh();
+	return find(command) != NULL;
+}
+
+
+// - live_has() has just brought the units up to date
+int un::live_run( int argc, char **argv ) {
+	const live_unit_t *unit = argc > 1 ? find(argv[1]) : NULL;
+	
+	return unit ? unit->run(argc, argv) : 1;
+}
+
+
+void un::live_help( void ) {
+	is_started = true;
+	refresh();
+	for (int i = 0; i < num_loaded; i++) {
+		std::printf("   %-9s %s\n", loaded[i].unit->command,
+		            loaded[i].unit->help ? loaded[i].unit->help : "");
+	}
+}
+
+
+int un::live_refresh( void ) {
+	return is_started ? refresh() : 0;
+}
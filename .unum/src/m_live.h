@@ -0,0 +1,58 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_LIVE_H
+#define UNUM_LIVE_H
+
+#include <cstdint>
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  A live unit is a source under the manifest's 'live' category, deployed
+ *  as a shared object of its own instead of being linked into the kernel.
+ *  The kernel loads it to answer one command and a resident kernel swaps
+ *  in the new object after a deploy replaces it, between commands so that
+ *  nothing is running in the old one.  Its state is handed over from
+ *  suspend() to the replacement's resume() and must not point into the
+ *  unit itself, since the old object is unloaded right after.
+ */
+#define UNUM_LIVE_ABI  1
+#define UNUM_LIVE_SYM  "unum_live_unit"
+
+typedef struct {
+	uint32_t   abi;
+	const char *command;                 // - what it answers to
+	const char *help;                    // - its line in 'unum --help'
+	int        (*run)( int argc, char **argv );
+	void       (*resume)( void *state ); // - (optional) NULL when first loaded
+	void       *(*suspend)( void );      // - (optional) state to hand over
+} live_unit_t;
+
+
+// - every live unit defines its entry point with this, eg.
+//   UNUM_LIVE_UNIT("hello", "Say hello", hello_run, nullptr, nullptr);
+#define UNUM_LIVE_UNIT(command, help, run, resume, suspend)                \
+	extern "C" const un::live_unit_t unum_live_unit = {                    \
+		UNUM_LIVE_ABI, command, help, run, resume, suspend                 \
+	}
+
+
+// - the kernel's side, loading units on first use
+extern bool live_has( const char *command );
+extern int  live_run( int argc, char **argv );
+extern void live_help( void );
+
+// - swaps in whatever a deploy replaced, once units have been loaded
+extern int  live_refresh( void );
+
+
+}
+#endif /* UNUM_LIVE_H */
@@ -0,0 +1,527 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_paths.h"
+#include "m_serve.h"
+#include "./deploy/d_deploy.h"
+
+extern char **environ;
+
+/*
+ *  <request-layout>
+ *
+ *  header              - magic, number of arguments and of environment
+ *                        entries and the length of what follows, sent
+ *                        with the caller's standard descriptors attached
+ *  strings             - the working directory, the arguments and the
+ *                        environment, each NUL-terminated
+ *
+ *  The service acknowledges a request with one byte and only runs it once
+ *  the caller answers with another to say it is still waiting, then sends
+ *  the exit status when it is done.  A caller that gives up on the
+ *  acknowledgement never answers, so the request is abandoned and the
+ *  caller is free to run it itself.
+ */
+
+#define SERVE_MAGIC   "UKS1"
+#define SERVE_MAX_REQ (4 * 1024 * 1024)
+#define SERVE_LOCAL   "UNUM_LOCAL"  // - set for commands the service runs
+#define SERVE_ACK     'k'
+#define SERVE_GO      'g'
+#define SERVE_ACK_MS  500           // - how long a caller waits to be served
+#define SERVE_GO_MS   5000          // - how long the service waits on a caller
+
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS    MSG_NOSIGNAL
+#else
+#define SEND_FLAGS    0
+#endif
+
+#ifdef MSG_CMSG_CLOEXEC
+#define RECV_FLAGS    MSG_CMSG_CLOEXEC
+#else
+#define RECV_FLAGS    0
+#endif
+
+typedef struct {
+	char     magic[4];
+	uint32_t argc;
+	uint32_t envc;
+	uint32_t len;
+} serve_req_t;
+
+typedef union {
+	struct cmsghdr hdr;
+	char           buf[CMSG_SPACE(3 * sizeof(int))];
+} serve_ctl_t;
+
+
+static bool read_full( int fd, void *buf, size_t len ) {
+	char    *pos = (char *) buf;
+	ssize_t rc;
+	
+	while (len) {
+		if ((rc = read(fd, pos, len)) <= 0) {
+			if (rc < 0 && errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		pos += rc;
+		len -= (size_t) rc;
+	}
+	return true;
+}
+
+
+static bool send_full( int fd, const void *buf, size_t len ) {
+	const char *pos = (const char *) buf;
+	ssize_t    rc;
+	
+	while (len) {
+		if ((rc = send(fd, pos, len, SEND_FLAGS)) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		pos += rc;
+		len -= (size_t) rc;
+	}
+	return true;
+}
+
+
+static bool wait_byte( int fd, char expect, int timeout_ms ) {
+	struct pollfd pfd = { fd, POLLIN, 0 };
+	char          got;
+	int           rc;
+	
+	while ((rc = poll(&pfd, 1, timeout_ms)) < 0 && errno == EINTR) {}
+	return rc > 0 && read_full(fd, &got, 1) && got == expect;
+}
+
+
+static int open_sock( void ) {
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	
+	if (fd >= 0) {
+		fcntl(fd, F_SETFD, FD_CLOEXEC);
+#ifdef SO_NOSIGPIPE
+		int on = 1;
+		setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+	}
+	return fd;
+}
+
+
+// ...connects or binds to the socket, from its own directory when the
+//    full path doesn't fit in an address
+static int sock_addr( int fd, const char *path, bool is_bind ) {
+	struct sockaddr_un addr;
+	const char         *base = path, *slash;
+	char               dir[PATH_MAX];
+	int                cwd   = -1, ret;
+	
+	if (std::strlen(path) >= sizeof(addr.sun_path)) {
+		if (!(slash = std::strrchr(path, '/')) ||
+		    (size_t) (slash - path) >= sizeof(dir)) {
+			return -1;
+		}
+		
+		std::memcpy(dir, path, (size_t) (slash - path));
+		dir[slash - path] = '\0';
+		if ((cwd = open(".", O_RDONLY | O_CLOEXEC)) < 0 || chdir(dir) != 0) {
+			if (cwd >= 0) {
+				close(cwd);
+			}
+			return -1;
+		}
+		base = slash + 1;
+	}
+	
+	std::memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	std::strncpy(addr.sun_path, base, sizeof(addr.sun_path) - 1);
+	ret = is_bind ? bind(fd, (struct sockaddr *) &addr, sizeof(addr)) :
+	                connect(fd, (struct sockaddr *) &addr, sizeof(addr));
+	
+	if (cwd >= 0) {
+		if (fchdir(cwd) != 0) {
+			ret = -1;
+		}
+		close(cwd);
+	}
+	return ret;
+}
+
+
+// ...the request, before the service has agreed to run it
+static bool send_req( int fd, int argc, char **argv, const char *cwd ) {
+	serve_req_t   hdr;
+	serve_ctl_t   ctl;
+	struct iovec  iov = { &hdr, sizeof(hdr) };
+	struct msghdr msg;
+	int           fds[3] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+	size_t        len    = std::strlen(cwd) + 1;
+	int           envc   = 0;
+	char          *req, *pos;
+	bool          ret;
+	
+	for (int i = 0; i < argc; i++) {
+		len += std::strlen(argv[i]) + 1;
+	}
+	for (; environ[envc]; envc++) {
+		len += std::strlen(environ[envc]) + 1;
+	}
+	if (len > SERVE_MAX_REQ || !(req = (char *) std::malloc(len))) {
+		return false;
+	}
+	
+	pos = req;
+	pos = std::strcpy(pos, cwd) + std::strlen(cwd) + 1;
+	for (int i = 0; i < argc; i++) {
+		pos = std::strcpy(pos, argv[i]) + std::strlen(argv[i]) + 1;
+	}
+	for (int i = 0; i < envc; i++) {
+		pos = std::strcpy(pos, environ[i]) + std::strlen(environ[i]) + 1;
+	}
+	
+	std::memcpy(hdr.magic, SERVE_MAGIC, 4);
+	hdr.argc = (uint32_t) argc;
+	hdr.envc = (uint32_t) envc;
+	hdr.len  = (uint32_t) len;
+	
+	std::memset(&ctl, 0, sizeof(ctl));
+	std::memset(&msg, 0, sizeof(msg));
+	msg.msg_iov        = &iov;
+	msg.msg_iovlen     = 1;
+	msg.msg_control    = ctl.buf;
+	msg.msg_controllen = sizeof(ctl.buf);
+	CMSG_FIRSTHDR(&msg)->cmsg_level = SOL_SOCKET;
+	CMSG_FIRSTHDR(&msg)->cmsg_type  = SCM_RIGHTS;
+	CMSG_FIRSTHDR(&msg)->cmsg_len   = CMSG_LEN(sizeof(fds));
+	std::memcpy(CMSG_DATA(CMSG_FIRSTHDR(&msg)), fds, sizeof(fds));
+	
+	ret = sendmsg(fd, &msg, SEND_FLAGS) == (ssize_t) sizeof(hdr) &&
+	      send_full(fd, req, len);
+	std::free(req);
+	return ret;
+}
+
+
+/*
+ *  The service answers one request at a time, so a caller queued behind a
+ *  long deploy gives up on the acknowledgement and runs the command itself.
+ */
+bool un::serve_forward( int argc, char **argv, int *rc ) {
+	const char *path;
+	char       cwd[PATH_MAX], go = SERVE_GO;
+	int32_t    ret;
+	int        fd;
+	
+	if (std::getenv(SERVE_LOCAL) || !(path = un::basis_path(un::BP_SERVICE)) ||
+	    !getcwd(cwd, sizeof(cwd)) || (fd = open_sock()) < 0) {
+		return false;
+	}
+	
+	if (sock_addr(fd, path, false) != 0 || !send_req(fd, argc, argv, cwd) ||
+	    !wait_byte(fd, SERVE_ACK, SERVE_ACK_MS) || !send_full(fd, &go, 1)) {
+		close(fd);
+		return false;
+	}
+	
+	// - from here the command belongs to the service, whatever happens
+	if (!read_full(fd, &ret, sizeof(ret))) {
+		std::fprintf(stderr, "unum: the resident kernel stopped before "
+		             "finishing '%s'\n", argc > 1 ? argv[1] : "");
+		ret = 1;
+	}
+	
+	close(fd);
+	*rc = (int) ret;
+	return true;
+}
+
+
+static bool is_peer( int fd ) {
+#if UNUM_OS_LINUX
+	struct ucred cred;
+	socklen_t    len = sizeof(cred);
+	
+	return getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0 &&
+	       cred.uid == getuid();
+#else
+	uid_t uid;
+	gid_t gid;
+	
+	return getpeereid(fd, &uid, &gid) == 0 && uid == getuid();
+#endif
+}
+
+
+static bool recv_req( int fd, serve_req_t *hdr, int *fds ) {
+	serve_ctl_t    ctl;
+	struct iovec   iov = { hdr, sizeof(*hdr) };
+	struct msghdr  msg;
+	struct cmsghdr *cm;
+	ssize_t        rc;
+	
+	std::memset(&msg, 0, sizeof(msg));
+	msg.msg_iov        = &iov;
+	msg.msg_iovlen     = 1;
+	msg.msg_control    = ctl.buf;
+	msg.msg_controllen = sizeof(ctl.buf);
+	rc = recvmsg(fd, &msg, RECV_FLAGS);
+	
+	// - whatever descriptors arrived are kept so they are always closed
+	for (cm = rc > 0 ? CMSG_FIRSTHDR(&msg) : NULL; cm;
+	     cm = CMSG_NXTHDR(&msg, cm)) {
+		int num = (int) ((cm->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+		int *in = (int *) CMSG_DATA(cm);
+		
+		if (cm->cmsg_level != SOL_SOCKET || cm->cmsg_type != SCM_RIGHTS) {
+			continue;
+		}
+		for (int i = 0; i < num; i++) {
+			if (i < 3 && fds[i] < 0) {
+				fds[i] = in[i];
+				fcntl(in[i], F_SETFD, FD_CLOEXEC);
+			} else {
+				close(in[i]);
+			}
+		}
+	}
+	
+	return rc == (ssize_t) sizeof(*hdr) && !(msg.msg_flags & MSG_CTRUNC) &&
+	       !std::memcmp(hdr->magic, SERVE_MAGIC, 4) && fds[2] >= 0 &&
+	       hdr->argc > 0 && hdr->len <= SERVE_MAX_REQ &&
+	       hdr->argc + hdr->envc < hdr->len;
+}
+
+
+/*
+ *  The command runs in this process with the caller's descriptors in place
+ *  of the standard ones and the caller's environment, marked so that any
+ *  unum it starts runs on its own instead of waiting on this one.
+ */
+static bool run_req( int fd, const serve_req_t *hdr, const int *fds,
+                     un::serve_cmd_t cmd, const char *root ) {
+	int     argc = (int) hdr->argc, num = (int) (hdr->argc + hdr->envc);
+	int     saved[3] = { -1, -1, -1 };
+	char    *req, **strs, *pos, *end, **env = environ, ack = SERVE_ACK;
+	char    local[] = SERVE_LOCAL "=1";
+	bool    is_ok;
+	int32_t rc;
+	
+	req  = (char *) std::malloc(hdr->len);
+	strs = (char **) std::malloc(sizeof(char *) * (size_t) (num + 3));
+	
+	// - every string must be present and terminated
+	is_ok = req && strs && read_full(fd, req, hdr->len) &&
+	        req[hdr->len - 1] == '\0';
+	pos   = is_ok ? req + std::strlen(req) + 1 : NULL;
+	end   = is_ok ? req + hdr->len : NULL;
+	for (int i = 0, j = 0; is_ok && i < num; i++, j++) {
+		if (pos >= end) {
+			is_ok = false;
+			break;
+		}
+		j       += (i == argc) ? 1 : 0;
+		strs[j]  = pos;
+		pos     += std::strlen(pos) + 1;
+	}
+	
+	for (int i = 0; is_ok && i < 3; i++) {
+		is_ok = (saved[i] = fcntl(i, F_DUPFD_CLOEXEC, 3)) >= 0;
+	}
+	
+	if (!is_ok || !send_full(fd, &ack, 1) ||
+	    !wait_byte(fd, SERVE_GO, SERVE_GO_MS)) {
+		for (int i = 0; i < 3; i++) {
+			if (saved[i] >= 0) {
+				close(saved[i]);
+			}
+		}
+		std::free(strs);
+		std::free(req);
+		return false;
+	}
+	
+	strs[argc]    = NULL;
+	strs[num + 1] = local;
+	strs[num + 2] = NULL;
+	
+	std::fflush(stdout);
+	std::fflush(stderr);
+	for (int i = 0; i < 3; i++) {
+		dup2(fds[i], i);
+	}
+	environ = &strs[argc + 1];
+	
+	// - a directory that has since gone away leaves the command at the root
+	is_ok = chdir(req) == 0 || chdir(root) == 0;
+	rc    = is_ok ? (int32_t) cmd(argc, strs) : 1;
+	
+	std::fflush(stdout);
+	std::fflush(stderr);
+	environ = env;
+	for (int i = 0; i < 3; i++) {
+		dup2(saved[i], i);
+		close(saved[i]);
+	}
+	
+	std::free(strs);
+	std::free(req);
+	return send_full(fd, &rc, sizeof(rc));
+}
+
+
+// ...whether a deploy has replaced the binary this service is running
+static bool is_stale( const char *bin, const struct stat *self ) {
+	struct stat s;
+	
+	return stat(bin, &s) != 0 || s.st_ino != self->st_ino ||
+	       s.st_size != self->st_size || s.st_mtime != self->st_mtime;
+}
+
+
+static void answer( int lfd, un::serve_cmd_t cmd, const char *root ) {
+	serve_req_t hdr;
+	int         fds[3] = { -1, -1, -1 };
+	int         fd     = accept(lfd, NULL, NULL);
+	
+	if (fd < 0) {
+		return;
+	}
+	
+	fcntl(fd, F_SETFD, FD_CLOEXEC);
+	if (is_peer(fd) && recv_req(fd, &hdr, fds)) {
+		run_req(fd, &hdr, fds, cmd, root);
+	}
+	
+	for (int i = 0; i < 3; i++) {
+		if (fds[i] >= 0) {
+			close(fds[i]);
+		}
+	}
+	close(fd);
+}
+
+
+/*
+ *  un::serve()
+ *  - hosts the monitor when no other process does, so a status or deploy
+ *    catches up with the journal in memory instead of waiting on a sync
+ *    request, and starts over from the new binary once a deploy replaces
+ *    it.  A request arriving while the old binary is still running isn't
+ *    acknowledged and its caller runs the command itself.
+ */
+bool un::serve( serve_cmd_t cmd, char *error, size_t len ) {
+	const char           *path = un::basis_path(un::BP_SERVICE);
+	const char           *root = un::basis_path(un::BP_ROOT);
+	const char           *bin  = un::basis_path(un::BP_RUNTIME_BIN);
+	un::deploy_monitor_t *mon;
+	struct stat          self;
+	struct pollfd        pfd[2];
+	char                 buf[512];
+	mode_t               mask;
+	int                  lfd, probe;
+	bool                 is_ok;
+	
+	if (!path || !root || !bin || stat(bin, &self) != 0 || chdir(root) != 0) {
+		std::strncpy(error, "failed to locate the repository", len);
+		return false;
+	}
+	
+	// - a socket that nobody answers was left behind by an exited kernel
+	if ((probe = open_sock()) >= 0 && sock_addr(probe, path, false) == 0) {
+		close(probe);
+		std::strncpy(error, "another kernel is already serving", len);
+		return false;
+	}
+	if (probe >= 0) {
+		close(probe);
+	}
+	
+	unlink(path);
+	mask  = umask(077);
+	lfd   = open_sock();
+	is_ok = lfd >= 0 && sock_addr(lfd, path, true) == 0 &&
+	        listen(lfd, SOMAXCONN) == 0;
+	umask(mask);
+	if (!is_ok) {
+		if (lfd >= 0) {
+			close(lfd);
+		}
+		std::strncpy(error, "failed to listen on the kernel socket", len);
+		return false;
+	}
+	
+	// - a monitor running elsewhere serves just as well, only slower
+	mon = un::deploy_monitor_open(buf, sizeof(buf));
+	std::signal(SIGPIPE, SIG_IGN);
+	std::setvbuf(stdout, NULL, _IOLBF, 0);
+	
+	for (;;) {
+		pfd[0].fd     = lfd;
+		pfd[0].events = POLLIN;
+		pfd[1].fd     = mon ? un::deploy_monitor_fd(mon) : -1;
+		pfd[1].events = POLLIN;
+		if (poll(pfd, 2, -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			std::strncpy(error, "failed to wait for commands", len);
+			break;
+		}
+		
+		// - events are taken first so a command sees what came before it
+		if (mon && (pfd[0].revents || pfd[1].revents) &&
+		    !un::deploy_monitor_update(mon, 0, buf, sizeof(buf))) {
+			un::deploy_monitor_close(mon);
+			mon = nullptr;
+		}
+		
+		if (pfd[0].revents & POLLIN) {
+			if (is_stale(bin, &self)) {
+				break;
+			}
+			answer(lfd, cmd, root);
+			if (is_stale(bin, &self)) {
+				break;
+			}
+		}
+	}
+	
+	close(lfd);
+	unlink(path);
+	un::deploy_monitor_close(mon);
+	if (is_stale(bin, &self)) {
+		std::fflush(stdout);
+		execl(bin, "unum", "serve", (char *) NULL);
+		std::strncpy(error, "failed to restart the deployed kernel", len);
+	}
+	return false;
+}
@@ -0,0 +1,36 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_SERVE_H
+#define UNUM_SERVE_H
+
+#include <cstddef>
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  A resident kernel answers the commands of its basis on a socket in the
+ *  deployment, with the monitor's watches and journal already in memory.
+ *  The caller's descriptors travel with its arguments, directory and
+ *  environment, so a command writes to the same place it would have had
+ *  it run in the caller's own process.
+ */
+typedef int (*serve_cmd_t)( int argc, char **argv );
+
+
+// - runs the command in the resident kernel, false when none accepts it
+extern bool serve_forward( int argc, char **argv, int *rc );
+
+// - answers forwarded commands one at a time, only returning on failure
+extern bool serve( serve_cmd_t cmd, char *error, size_t len );
+
+
+}
+#endif /* UNUM_SERVE_H */
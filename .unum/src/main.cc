@@ -16,6 +16,7 @@
 #include <cstring>
 
 #include "u_common.h"
+#include "u_paths.h"
 #include "./deploy/d_deploy.h"
 
 int main(int argc, char **argv) {
@@ -26,8 +27,8 @@ int main(int argc, char **argv) {
 			std::fprintf(stderr, "unum: %s\n", buf);
 			return 1;
 		}
-		std::strcpy(buf, UNUM_RUNTIME_BIN);
-		std::strcat(buf, " deploy --bootstrap");
+		std::snprintf(buf, sizeof(buf), "%s deploy --bootstrap",
+		              un::basis_path(un::BP_RUNTIME_BIN));
 		if (std::system(buf) != 0) {
 			std::fprintf(stderr, "unum: failed to execute bootstrapped kernel");
 			return 1;
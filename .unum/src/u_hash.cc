@@ -0,0 +1,152 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_hash.h"
+
+#define P1  0x9e3779b185ebca87ULL
+#define P2  0xc2b2ae3d27d4eb4fULL
+#define P3  0x165667b19e3779f9ULL
+
+
+static inline uint64_t rotl( uint64_t v, int r ) {
+	return (v << r) | (v >> (64 - r));
+}
+
+
+static inline uint64_t load64( const unsigned char *p ) {
+	uint64_t v;
+	std::memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+
+static inline uint64_t round64( uint64_t acc, uint64_t v ) {
+	acc += v * P2;
+	acc  = rotl(acc, 31);
+	return acc * P1;
+}
+
+
+static inline uint64_t avalanche( uint64_t v ) {
+	v ^= v >> 33;
+	v *= P2;
+	v ^= v >> 29;
+	v *= P3;
+	v ^= v >> 32;
+	return v;
+}
+
+
+// ...consumes input in 16-byte stripes, one 64-bit word per lane
+static void stripe( un::hash_ctx_t *ctx, const unsigned char *p ) {
+	ctx->v[0] = round64(ctx->v[0], load64(p));
+	ctx->v[1] = round64(ctx->v[1], load64(p + 8));
+}
+
+
+void un::hash_init( hash_ctx_t *ctx ) {
+	ctx->v[0]     = P1 + P2;
+	ctx->v[1]     = P3 - P1;
+	ctx->num_tail = 0;
+	ctx->len      = 0;
+}
+
+
+void un::hash_update( hash_ctx_t *ctx, const void *data, size_t len ) {
+	const unsigned char *p   = (const unsigned char *) data;
+	const unsigned char *end = p + len;
+
+	ctx->len += len;
+
+	if (ctx->num_tail) {
+		size_t n = sizeof(ctx->tail) - ctx->num_tail;
+		n = n > len ? len : n;
+		std::memcpy(&ctx->tail[ctx->num_tail], p, n);
+		ctx->num_tail += n;
+		p             += n;
+		if (ctx->num_tail < sizeof(ctx->tail)) {
+			return;
+		}
+		stripe(ctx, ctx->tail);
+		ctx->num_tail = 0;
+	}
+
+	for (; end - p >= 16; p += 16) {
+		stripe(ctx, p);
+	}
+
+	ctx->num_tail = (size_t) (end - p);
+	std::memcpy(ctx->tail, p, ctx->num_tail);
+}
+
+
+void un::hash_update_s( hash_ctx_t *ctx, const char *text ) {
+	// - includes the terminator so that adjacent strings can't alias
+	hash_update(ctx, text, text ? std::strlen(text) + 1 : 0);
+}
+
+
+un::hash_t un::hash_final( hash_ctx_t *ctx ) {
+	unsigned char buf[16];
+	hash_t        ret;
+	uint64_t      v0 = ctx->v[0], v1 = ctx->v[1];
+
+	std::memset(buf, 0, sizeof(buf));
+	std::memcpy(buf, ctx->tail, ctx->num_tail);
+	v0 = round64(v0, load64(buf) ^ ctx->num_tail);
+	v1 = round64(v1, load64(buf + 8) ^ ctx->len);
+
+	ret.lo = avalanche(v0 ^ rotl(v1, 17));
+	ret.hi = avalanche(v1 ^ rotl(ret.lo, 41) ^ P3);
+	return ret;
+}
+
+
+bool un::hash_file( const char *path, hash_t *out ) {
+	unsigned char buf[65536];
+	hash_ctx_t    ctx;
+	ssize_t       rc;
+	int           fd = open(path, O_RDONLY);
+
+	if (fd < 0) {
+		return false;
+	}
+
+	hash_init(&ctx);
+	while ((rc = read(fd, buf, sizeof(buf))) > 0) {
+		hash_update(&ctx, buf, (size_t) rc);
+	}
+	close(fd);
+
+	if (rc < 0) {
+		return false;
+	}
+
+	*out = hash_final(&ctx);
+	return true;
+}
+
+
+un::hash_t un::hash_combine( hash_t h1, hash_t h2 ) {
+	hash_t ret;
+	ret.lo = avalanche(h1.lo ^ rotl(h2.lo, 23) ^ (h2.hi * P1));
+	ret.hi = avalanche(h1.hi ^ rotl(h2.hi, 29) ^ (h2.lo * P2));
+	return ret;
+}
+
+
+const char *un::hash_hex( hash_t h, char *buf ) {
+	std::snprintf(buf, UNUM_HASH_HEX_LEN, "%016llx%016llx",
+	              (unsigned long long) h.hi, (unsigned long long) h.lo);
+	return buf;
+}
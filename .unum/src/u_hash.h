@@ -0,0 +1,51 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_HASH_H
+#define UNUM_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  Streaming 128-bit content hash used to identify build inputs and outputs.
+ *  It is fast and well-distributed, not cryptographic.
+ */
+typedef struct {
+	uint64_t lo;
+	uint64_t hi;
+} hash_t;
+
+typedef struct {
+	uint64_t      v[2];
+	unsigned char tail[16];
+	size_t        num_tail;
+	uint64_t      len;
+} hash_ctx_t;
+
+#define UNUM_HASH_HEX_LEN  33
+
+
+extern void hash_init( hash_ctx_t *ctx );
+extern void hash_update( hash_ctx_t *ctx, const void *data, size_t len );
+extern void hash_update_s( hash_ctx_t *ctx, const char *text );
+extern hash_t hash_final( hash_ctx_t *ctx );
+extern bool hash_file( const char *path, hash_t *out );
+extern hash_t hash_combine( hash_t h1, hash_t h2 );
+extern const char *hash_hex( hash_t h, char *buf /* UNUM_HASH_HEX_LEN */ );
+inline bool hash_equal( hash_t h1, hash_t h2 ) {
+	return h1.lo == h2.lo && h1.hi == h2.hi;
+}
+
+
+}
+#endif /* UNUM_HASH_H */
@@ -0,0 +1,270 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_lex.h"
+
+#define is_ident_start(c)  ((c) == '_' || ((c) >= 'a' && (c) <= 'z') ||\
+                            ((c) >= 'A' && (c) <= 'Z') || (unsigned char)(c) >= 0x80)
+#define is_digit(c)        ((c) >= '0' && (c) <= '9')
+#define is_ident(c)        (is_ident_start(c) || is_digit(c))
+#define is_space(c)        ((c) == ' ' || (c) == '\t' || (c) == '\r' ||\
+                            (c) == '\f' || (c) == '\v')
+
+
+void un::lex_init( lexer_t *lex, const char *text, size_t len ) {
+	lex->pos          = text;
+	lex->end          = text + len;
+	lex->line         = 1;
+	lex->is_bol       = true;
+	lex->in_directive = false;
+}
+
+
+// ...consumes whitespace, comments and escaped newlines, stopping at a
+//    newline that ends a directive.
+static void skip_space( un::lexer_t *lex ) {
+	const char *p = lex->pos, *end = lex->end;
+	
+	while (p < end) {
+		if (is_space(*p)) {
+			p++;
+			
+		} else if (*p == '\\' && p + 1 < end && p[1] == '\n') {
+			p += 2;
+			lex->line++;
+			
+		} else if (*p == '\\' && p + 2 < end && p[1] == '\r' && p[2] == '\n') {
+			p += 3;
+			lex->line++;
+			
+		} else if (*p == '\n') {
+			if (lex->in_directive) {
+				break;
+			}
+			p++;
+			lex->line++;
+			lex->is_bol = true;
+			
+		} else if (*p == '/' && p + 1 < end && p[1] == '/') {
+			for (p += 2; p < end && *p != '\n'; p++) {
+				if (*p == '\\' && p + 1 < end && p[1] == '\n') {
+					p++;
+					lex->line++;
+				}
+			}
+			
+		} else if (*p == '/' && p + 1 < end && p[1] == '*') {
+			for (p += 2; p < end && !(*p == '*' && p + 1 < end && p[1] == '/');
+			     p++) {
+				lex->line += (*p == '\n');
+			}
+			p = (p < end) ? p + 2 : end;
+			
+		} else {
+			break;
+		}
+	}
+	
+	lex->pos = p;
+}
+
+
+static const char *skip_quoted( const char *p, const char *end, char quote,
+                                int *line ) {
+	for (p++; p < end && *p != quote && *p != '\n'; p++) {
+		if (*p == '\\' && p + 1 < end) {
+			*line += (*++p == '\n');
+		}
+	}
+	
+	return (p < end && *p == quote) ? p + 1 : p;
+}
+
+
+// ...R"delim( ... )delim", with `p` at the opening quote
+static const char *skip_raw( const char *p, const char *end, int *line ) {
+	const char *delim = ++p;
+	size_t     dlen;
+	
+	while (p < end && *p != '(' && p - delim < 16) {
+		p++;
+	}
+	if (p >= end || *p != '(') {
+		return p;
+	}
+	dlen = (size_t) (p - delim);
+	
+	for (p++; p < end; p++) {
+		if (*p == '\n') {
+			(*line)++;
+		} else if (*p == ')' && (size_t) (end - p) > dlen + 1 &&
+		           !std::strncmp(p + 1, delim, dlen) && p[dlen + 1] == '"') {
+			return p + dlen + 2;
+		}
+	}
+	
+	return end;
+}
+
+
+bool un::lex_next( lexer_t *lex, lex_token_t *tok ) {
+	const char *p, *end = lex->end, *start = lex->pos;
+	bool       is_bol;
+	
+	skip_space(lex);
+	p                 = lex->pos;
+	tok->is_spaced    = p != start;
+	is_bol            = lex->is_bol;
+	lex->is_bol       = false;
+	tok->text         = p;
+	tok->line         = lex->line;
+	tok->is_directive = false;
+	tok->is_bol       = is_bol;
+	
+	if (p >= end) {
+		tok->type         = lex->in_directive ? LT_EOD : LT_EOF;
+		tok->len          = 0;
+		tok->is_spaced    = false;
+		lex->in_directive = false;
+		return tok->type != LT_EOF;
+	}
+	
+	if (*p == '\n') {
+		// - only reachable at the end of a directive, where trailing space
+		//   means nothing
+		tok->type         = LT_EOD;
+		tok->len          = 0;
+		tok->is_spaced    = false;
+		lex->in_directive = false;
+		return true;
+	}
+	
+	if (*p == '#' && is_bol && !lex->in_directive) {
+		tok->type         = LT_PUNCT;
+		tok->is_directive = true;
+		lex->in_directive = true;
+		p++;
+		
+	} else if (is_ident_start(*p)) {
+		const char *start = p;
+		
+		while (p < end && is_ident(*p)) {
+			p++;
+		}
+		
+		// - encoding prefixes are part of the literal that follows
+		if (p < end && (*p == '"' || *p == '\'') && p - start <= 3) {
+			bool is_raw = p[-1] == 'R';
+			tok->type   = (*p == '"') ? LT_STRING : LT_CHAR;
+			p           = (is_raw && *p == '"') ?
+			              skip_raw(p, end, &lex->line) :
+			              skip_quoted(p, end, *p, &lex->line);
+		} else {
+			tok->type = LT_IDENT;
+		}
+		
+	} else if (is_digit(*p) || (*p == '.' && p + 1 < end && is_digit(p[1]))) {
+		// - pp-numbers include exponent signs and digit separators
+		for (p++; p < end; p++) {
+			if ((*p == '+' || *p == '-') && (p[-1] == 'e' || p[-1] == 'E' ||
+			                                 p[-1] == 'p' || p[-1] == 'P')) {
+				continue;
+			}
+			if (!is_ident(*p) && *p != '.' && *p != '\'') {
+				break;
+			}
+		}
+		tok->type = LT_NUMBER;
+		
+	} else if (*p == '"' || *p == '\'') {
+		tok->type = (*p == '"') ? LT_STRING : LT_CHAR;
+		p         = skip_quoted(p, end, *p, &lex->line);
+		
+	} else {
+		for (p++; p < end && !is_ident(*p) && !is_space(*p) && *p != '\n' &&
+		          *p != '"' && *p != '\'' && *p != '\\' && *p != '#' &&
+		          !(*p == '/' && p + 1 < end && (p[1] == '/' || p[1] == '*'));
+		     p++) {}
+		tok->type = LT_PUNCT;
+	}
+	
+	tok->len = (size_t) (p - tok->text);
+	lex->pos = p;
+	return true;
+}
+
+
+char *un::lex_read_file( const char *path, size_t *len ) {
+	struct stat s;
+	char        *buf;
+	size_t      pos = 0;
+	int         fd  = open(path, O_RDONLY);
+	
+	if (fd < 0) {
+		return NULL;
+	}
+	
+	if (fstat(fd, &s) != 0 ||
+	    !(buf = (char *) std::malloc((size_t) s.st_size + 1))) {
+		close(fd);
+		return NULL;
+	}
+	
+	while (pos < (size_t) s.st_size) {
+		ssize_t rc = read(fd, buf + pos, (size_t) s.st_size - pos);
+		if (rc <= 0) {
+			break;
+		}
+		pos += (size_t) rc;
+	}
+	close(fd);
+	
+	buf[pos] = '\0';
+	*len     = pos;
+	return buf;
+}
+
+
+bool un::lex_fingerprint( const char *path, hash_t *out ) {
+	size_t len;
+	char   *text = lex_read_file(path, &len);
+	
+	if (!text) {
+		return false;
+	}
+	
+	*out = lex_fingerprint_text(text, len);
+	std::free(text);
+	return true;
+}
+
+
+un::hash_t un::lex_fingerprint_text( const char *text, size_t len ) {
+	lexer_t     lex;
+	lex_token_t tok;
+	hash_ctx_t  ctx;
+	
+	hash_init(&ctx);
+	lex_init(&lex, text, len);
+	while (lex_next(&lex, &tok)) {
+		unsigned char sep[2] = { (unsigned char) tok.type,
+		                         (unsigned char) tok.is_spaced };
+		
+		hash_update(&ctx, &tok.line, sizeof(tok.line));
+		hash_update(&ctx, sep, sizeof(sep));
+		hash_update(&ctx, tok.text, tok.len);
+	}
+	
+	return hash_final(&ctx);
+}
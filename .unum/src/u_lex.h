@@ -0,0 +1,77 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_LEX_H
+#define UNUM_LEX_H
+
+#include <cstddef>
+
+#include "u_hash.h"
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  Fast C++ lexer for analyzing source without the compiler.  It is 
+ *  tolerant, not validating, and recognizes only enough of the language to
+ *  separate tokens from comments and whitespace.  Runs of punctuation are 
+ *  returned as a single token so that `a++b` and `a+ +b` remain distinct.
+ */
+typedef enum {
+	LT_EOF = 0,
+	LT_IDENT,
+	LT_NUMBER,
+	LT_STRING,
+	LT_CHAR,
+	LT_PUNCT,
+	LT_EOD              // - the end of a preprocessor directive
+} lex_token_e;
+
+typedef struct {
+	lex_token_e type;
+	const char  *text;
+	size_t      len;
+	int         line;
+	bool        is_directive;   // - the `#` beginning a directive
+	bool        is_bol;         // - the first token on its line
+	bool        is_spaced;      // - whitespace or a comment comes before it
+} lex_token_t;
+
+typedef struct {
+	const char  *pos;
+	const char  *end;
+	int         line;
+	bool        is_bol;
+	bool        in_directive;
+} lexer_t;
+
+
+extern void lex_init( lexer_t *lex, const char *text, size_t len );
+extern bool lex_next( lexer_t *lex, lex_token_t *tok );
+
+
+/*
+ *  lex_fingerprint()
+ *  - hashes the token stream of a file, which is unaffected by comments and 
+ *    the amount of whitespace on a line.  Whether a token is separated from
+ *    the one before it is kept, since `#define F (x)` is not `#define F(x)`
+ *    and stringizing preserves it, as is its line because `__LINE__` may be
+ *    expanded there by a macro from anywhere and debug information refers
+ *    to it.
+ */
+extern bool lex_fingerprint( const char *path, hash_t *out );
+extern hash_t lex_fingerprint_text( const char *text, size_t len );
+
+
+// - reads a whole file into a buffer the caller must free()
+extern char *lex_read_file( const char *path, size_t *len );
+
+
+}
+#endif /* UNUM_LEX_H */
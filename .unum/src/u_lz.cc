@@ -0,0 +1,190 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cstdint>
+#include <cstring>
+
+#include "u_common.h"
+#include "u_lz.h"
+
+/*
+ *  A block is a series of sequences, each of which is:
+ *
+ *    token          - high nibble is the literal count, low is match - 4
+ *    [len bytes]    - when a nibble is 15, add bytes until one is < 255
+ *    literals
+ *    offset         - 16-bit little-endian distance back to the match
+ *    [len bytes]
+ *
+ *  The final sequence holds only literals, which is recognized because it
+ *  exactly fills the output.
+ */
+
+#define MIN_MATCH    4
+#define MAX_OFFSET   65535
+#define HASH_BITS    14
+
+
+static inline uint32_t load32( const unsigned char *p ) {
+	uint32_t v;
+	std::memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+
+static inline uint32_t hash4( uint32_t v ) {
+	return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+
+static unsigned char *put_len( unsigned char *op, size_t len ) {
+	for (; len >= 255; len -= 255) {
+		*op++ = 255;
+	}
+	*op++ = (unsigned char) len;
+	return op;
+}
+
+
+static unsigned char *put_seq( unsigned char *op, const unsigned char *lit,
+                               size_t num_lit, size_t offset, size_t match ) {
+	unsigned char *token = op++;
+	size_t        ml     = match ? match - MIN_MATCH : 0;
+	
+	*token = (unsigned char) (((num_lit < 15 ? num_lit : 15) << 4) |
+	                          (ml < 15 ? ml : 15));
+	if (num_lit >= 15) {
+		op = put_len(op, num_lit - 15);
+	}
+	
+	std::memcpy(op, lit, num_lit);
+	op += num_lit;
+	
+	if (match) {
+		*op++ = (unsigned char) (offset & 0xff);
+		*op++ = (unsigned char) (offset >> 8);
+		if (ml >= 15) {
+			op = put_len(op, ml - 15);
+		}
+	}
+	
+	return op;
+}
+
+
+size_t un::lz_compress( const void *src, size_t len, void *dst, size_t cap ) {
+	const unsigned char *ip     = (const unsigned char *) src;
+	const unsigned char *base   = ip;
+	const unsigned char *end    = ip + len;
+	const unsigned char *limit  = len > MIN_MATCH ? end - MIN_MATCH : ip;
+	const unsigned char *anchor = ip;
+	unsigned char       *op     = (unsigned char *) dst;
+	uint32_t            table[1 << HASH_BITS];
+	
+	if (cap < UNUM_LZ_BOUND(len)) {
+		return 0;
+	}
+	
+	std::memset(table, 0, sizeof(table));
+	
+	while (ip < limit) {
+		uint32_t            seq  = load32(ip);
+		uint32_t            h    = hash4(seq);
+		const unsigned char *ref = base + table[h];
+		
+		table[h] = (uint32_t) (ip - base);
+		
+		if (ref >= ip || ip - ref > MAX_OFFSET || load32(ref) != seq) {
+			ip++;
+			continue;
+		}
+		
+		const unsigned char *mp = ip + MIN_MATCH;
+		const unsigned char *rp = ref + MIN_MATCH;
+		while (mp < end && *mp == *rp) {
+			mp++, rp++;
+		}
+		
+		op     = put_seq(op, anchor, (size_t) (ip - anchor),
+		                 (size_t) (ip - ref), (size_t) (mp - ip));
+		ip     = mp;
+		anchor = ip;
+	}
+	
+	op = put_seq(op, anchor, (size_t) (end - anchor), 0, 0);
+	return (size_t) (op - (unsigned char *) dst);
+}
+
+
+static bool get_len( const unsigned char **ip, const unsigned char *end,
+                     size_t *len ) {
+	unsigned char b;
+	
+	do {
+		if (*ip >= end) {
+			return false;
+		}
+		b     = *(*ip)++;
+		*len += b;
+	} while (b == 255);
+	
+	return true;
+}
+
+
+bool un::lz_decompress( const void *src, size_t len, void *dst,
+                        size_t out_len ) {
+	const unsigned char *ip   = (const unsigned char *) src;
+	const unsigned char *iend = ip + len;
+	unsigned char       *op   = (unsigned char *) dst;
+	unsigned char       *oend = op + out_len;
+	
+	while (ip < iend) {
+		unsigned char token   = *ip++;
+		size_t        num_lit = token >> 4;
+		size_t        match   = token & 0x0f;
+		size_t        offset;
+		
+		if (num_lit == 15 && !get_len(&ip, iend, &num_lit)) {
+			return false;
+		}
+		
+		if ((size_t) (iend - ip) < num_lit || (size_t) (oend - op) < num_lit) {
+			return false;
+		}
+		std::memcpy(op, ip, num_lit);
+		ip += num_lit;
+		op += num_lit;
+		
+		if (op == oend) {
+			return ip == iend;
+		}
+		
+		if (iend - ip < 2) {
+			return false;
+		}
+		offset = (size_t) ip[0] | ((size_t) ip[1] << 8);
+		ip    += 2;
+		
+		if (match == 15 && !get_len(&ip, iend, &match)) {
+			return false;
+		}
+		match += MIN_MATCH;
+		
+		if (!offset || offset > (size_t) (op - (unsigned char *) dst) ||
+		    (size_t) (oend - op) < match) {
+			return false;
+		}
+		
+		// - overlapping copies are how runs are encoded, so byte-wise
+		for (const unsigned char *mp = op - offset; match; match--) {
+			*op++ = *mp++;
+		}
+	}
+	
+	return op == oend;
+}
@@ -0,0 +1,38 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_LZ_H
+#define UNUM_LZ_H
+
+#include <cstddef>
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  Byte-oriented LZ77 block codec in the style of LZ4, favoring speed
+ *  over ratio.  Blocks are not self-describing, the caller must retain the
+ *  uncompressed length to decompress.
+ */
+
+// - the largest output `lz_compress` may produce for `len` input bytes
+#define UNUM_LZ_BOUND(len)  ((len) + ((len) / 255) + 16)
+
+
+// - returns the compressed length or 0 if `cap` is insufficient
+extern size_t lz_compress( const void *src, size_t len, void *dst, size_t cap );
+
+
+// - returns false if the block is corrupt or doesn't expand to `out_len`
+extern bool   lz_decompress( const void *src, size_t len, void *dst,
+                             size_t out_len );
+
+
+}
+#endif /* UNUM_LZ_H */
@@ -0,0 +1,157 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_paths.h"
+
+#if UNUM_OS_MACOS
+#include <mach-o/dyld.h>
+#endif
+
+
+// - relative to the root, in the same order as basis_path_e
+static const char *rel_paths[un::BP_COUNT] = {
+	"",
+	".unum",
+	".unum/deployed",
+	".unum/deployed/build",
+	".unum/deployed/build/include",
+	".unum/deployed/bin",
+	".unum/config/manifest.umy",
+	".unum/deployed/bin/unum",
+	".unum/deployed/build/kernel.id",
+	".unum/deployed/build/kernel.link",
+	".unum/deployed/build/deps.graph",
+	".unum/deployed/build/deploy.lock",
+	".unum/deployed/build/deploy.queue",
+	".unum/deployed/build/deploy.result",
+	".unum/deployed/build/compile-cost.txt",
+	".unum/deployed/build/pgo",
+	".unum/deployed/build/lto",
+	".unum/deployed/variants",
+	".unum/deployed/journal",
+	".unum/deployed/build/journal.mark",
+	".unum/deployed/build/tree.snap",
+	".unum/deployed/kernel.sock",
+	".unum/deployed/live"
+};
+
+static char paths[un::BP_COUNT][PATH_MAX];
+static bool is_resolved = false;
+
+
+static bool is_root( const char *dir ) {
+	char        buf[PATH_MAX];
+	struct stat s;
+	
+	std::snprintf(buf, sizeof(buf), "%s%c.unum%cconfig%cmanifest.umy", dir,
+	              UNUM_PATH_SEP, UNUM_PATH_SEP, UNUM_PATH_SEP);
+	return stat(buf, &s) == 0 && (s.st_mode & S_IFREG);
+}
+
+
+// ...removes the last component of the path, returning false if none remain
+static bool strip_last( char *path ) {
+	char *sep = std::strrchr(path, UNUM_PATH_SEP);
+	
+	if (!sep || sep == path) {
+		return false;
+	}
+	
+	*sep = '\0';
+	return true;
+}
+
+
+static bool exe_path( char *buf, size_t len ) {
+	char tmp[PATH_MAX];
+	
+#if UNUM_OS_MACOS
+	uint32_t size = sizeof(tmp);
+	if (_NSGetExecutablePath(tmp, &size) != 0) {
+		return false;
+	}
+	
+#else
+	ssize_t rc = readlink("/proc/self/exe", tmp, sizeof(tmp) - 1);
+	if (rc <= 0) {
+		return false;
+	}
+	tmp[rc] = '\0';
+	
+#endif
+	
+	return realpath(tmp, buf) != NULL && std::strlen(buf) < len;
+}
+
+
+// ...searches upwards from the path for the first root, truncating it there
+static bool root_above( char *path ) {
+	do {
+		if (is_root(path)) {
+			return true;
+		}
+	} while (strip_last(path));
+	
+	return false;
+}
+
+
+/*
+ *  The kernel is normally found beneath the root, at .unum/deployed/bin/unum
+ *  or in one of the variant or profile build directories, but when it is
+ *  built elsewhere (eg. by an IDE), the working directory is searched
+ *  upwards instead.
+ */
+static bool find_root( char *root ) {
+	if (exe_path(root, PATH_MAX) && strip_last(root) && root_above(root)) {
+		return true;
+	}
+	
+	return getcwd(root, PATH_MAX) && root_above(root);
+}
+
+
+static bool resolve( void ) {
+	char root[PATH_MAX];
+	
+	if (!find_root(root)) {
+		return false;
+	}
+	
+	for (int i = 0; i < un::BP_COUNT; i++) {
+		char *pp = paths[i];
+		int  len = std::snprintf(pp, PATH_MAX, "%s%s%s", root,
+		                         *rel_paths[i] ? UNUM_PATH_SEP_S : "",
+		                         rel_paths[i]);
+		if (len >= PATH_MAX) {
+			return false;
+		}
+		
+		for (; *pp; pp++) {
+			*pp = (*pp == '/') ? UNUM_PATH_SEP : *pp;
+		}
+	}
+	
+	return true;
+}
+
+
+const char *un::basis_path( basis_path_e which ) {
+	if (!is_resolved && !(is_resolved = resolve())) {
+		return NULL;
+	}
+	
+	return (which >= 0 && which < BP_COUNT) ? paths[which] : NULL;
+}
@@ -0,0 +1,56 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_PATHS_H
+#define UNUM_PATHS_H
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  Locations in the repository are resolved when the kernel runs instead of
+ *  being compiled into it, so that objects built from one checkout are 
+ *  identical to those built from any other and the binary may be moved
+ *  along with its repository.
+ */
+typedef enum {
+	BP_ROOT = 0,
+	BP_BASIS,
+	BP_DEPLOY,
+	BP_BUILD,
+	BP_INCLUDE,
+	BP_BIN,
+	BP_MANIFEST,
+	BP_RUNTIME_BIN,
+	BP_TOOL_STAMP,
+	BP_LINK_KEY,
+	BP_DEPS_GRAPH,
+	BP_DEPLOY_LOCK,
+	BP_DEPLOY_QUEUE,
+	BP_DEPLOY_RESULT,
+	BP_COMPILE_COST,
+	BP_PGO,
+	BP_LTO_CACHE,
+	BP_VARIANTS,
+	BP_JOURNAL,
+	BP_JOURNAL_MARK,
+	BP_TREE_SNAP,
+	BP_SERVICE,
+	BP_LIVE,
+
+	BP_COUNT
+} basis_path_e;
+
+
+// - returns NULL when the repository can't be located
+extern const char *basis_path( basis_path_e which );
+
+
+}
+#endif /* UNUM_PATHS_H */
@@ -0,0 +1,582 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_ring.h"
+
+#if UNUM_OS_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+/*
+ *  The region is a header followed by the slots, each of which is a small
+ *  header and `slot_size` bytes of payload.  The sender's and receiver's
+ *  positions only ever increase and are kept on lines of their own so that
+ *  the two sides don't contend for the same cache line.
+ *
+ *  A single-producer ring is published by its positions alone.  The multi-
+ *  producer ring is a bounded queue in the style of Vyukov, where each
+ *  slot carries the position it is next ready for so that senders and
+ *  receivers claim slots with one compare-and-swap and publish them in any
+ *  order.
+ *
+ *  A side with nothing to do sleeps on the futex word of the other, having
+ *  first counted itself as waiting, and the other side only makes the
+ *  system call to wake it when it sees that count after a batch.
+ */
+
+#define RING_MAGIC   "URG1"
+#define RING_LINE    128        // - fixed, so every build agrees on the layout
+#define RING_SPINS   256
+#define RING_MAX     (1U << 24)
+
+typedef struct {
+	char     magic[4];
+	uint32_t kind;
+	uint32_t num_slots;
+	uint32_t slot_size;
+	uint64_t size;
+	
+	alignas(RING_LINE) uint64_t head;   // - next position to send
+	uint32_t sent;                      // - bumped to wake receivers
+	uint32_t num_recv_wait;
+	
+	alignas(RING_LINE) uint64_t tail;   // - next position to receive
+	uint32_t taken;                     // - bumped to wake senders
+	uint32_t num_send_wait;
+	
+	alignas(RING_LINE) char data[];
+} header_t;
+
+typedef struct {
+	uint64_t seq;                       // - (MPMC) the position it's ready for
+	uint32_t len;
+	uint32_t reserved;
+} slot_t;
+
+struct un::ring_s {
+	header_t    *hdr;
+	size_t      size;
+	size_t      stride;
+	uint64_t    num_slots;
+	uint32_t    slot_size;
+	ring_kind_e kind;
+	int         fd;
+	int         spins;
+	uint64_t    head_seen;              // - (SPSC) the receiver's last look
+	uint64_t    tail_seen;              // - (SPSC) the sender's last look
+};
+
+
+static inline slot_t *slot_at( un::ring_t *ring, uint64_t pos ) {
+	return (slot_t *) (ring->hdr->data +
+	                   (size_t) (pos & (ring->num_slots - 1)) * ring->stride);
+}
+
+
+static inline size_t stride_of( uint32_t slot_size ) {
+	return (sizeof(slot_t) + slot_size + 7) & ~(size_t) 7;
+}
+
+
+static inline void cpu_relax( void ) {
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__)
+	__asm__ __volatile__("yield");
+#endif
+}
+
+
+static int64_t now_ms( void ) {
+	struct timespec ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+
+static int64_t deadline_of( int timeout_ms ) {
+	return timeout_ms < 0 ? -1 : now_ms() + timeout_ms;
+}
+
+
+// - the milliseconds left, -1 for no deadline at all
+static int remaining( int64_t deadline ) {
+	int64_t left;
+	
+	if (deadline < 0) {
+		return -1;
+	}
+	left = deadline - now_ms();
+	return left <= 0 ? 0 : (left > INT_MAX ? INT_MAX : (int) left);
+}
+
+
+#if UNUM_OS_LINUX
+
+static int open_region( size_t size ) {
+	int fd = memfd_create("unum-ring", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	
+	if (fd < 0) {
+		return -1;
+	}
+	
+	// - sealed, so no one can shrink it out from under another's mapping
+	if (ftruncate(fd, (off_t) size) != 0 ||
+	    fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+
+static bool is_sealed( int fd ) {
+	int seals = fcntl(fd, F_GET_SEALS);
+	
+	return seals >= 0 && (seals & F_SEAL_SHRINK);
+}
+
+
+// - shared between processes, so never FUTEX_PRIVATE_FLAG
+static void wait_word( uint32_t *word, uint32_t seen, int timeout_ms ) {
+	struct timespec ts, *tsp = NULL;
+	
+	if (timeout_ms >= 0) {
+		ts.tv_sec  = timeout_ms / 1000;
+		ts.tv_nsec = (long) (timeout_ms % 1000) * 1000000L;
+		tsp        = &ts;
+	}
+	syscall(SYS_futex, word, FUTEX_WAIT, seen, tsp, NULL, 0);
+}
+
+
+static void wake_word( uint32_t *word, unsigned count ) {
+	syscall(SYS_futex, word, FUTEX_WAKE,
+	        count > INT_MAX ? INT_MAX : (int) count, NULL, NULL, 0);
+}
+
+
+#else
+
+static int open_region( size_t size ) {
+	static unsigned num_regions = 0;
+	char            name[64];
+	int             fd;
+	
+	std::snprintf(name, sizeof(name), "/unum-ring.%ld.%u", (long) getpid(),
+	              num_regions++);
+	if ((fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600)) < 0) {
+		return -1;
+	}
+	shm_unlink(name);
+	
+	if (fcntl(fd, F_SETFD, FD_CLOEXEC) != 0 || ftruncate(fd, (off_t) size) != 0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+
+static bool is_sealed( int fd ) {
+	return true;
+}
+
+
+// - without a futex to sleep on, a waiter looks again shortly
+static void wait_word( uint32_t *word, uint32_t seen, int timeout_ms ) {
+	struct timespec ts = { 0, 100 * 1000L };
+	
+	if (timeout_ms != 0 && __atomic_load_n(word, __ATOMIC_ACQUIRE) == seen) {
+		nanosleep(&ts, NULL);
+	}
+}
+
+
+static void wake_word( uint32_t *word, unsigned count ) {
+}
+
+#endif
+
+
+static un::ring_t *map_ring( int fd ) {
+	un::ring_t  *ring;
+	header_t    *hdr;
+	struct stat s;
+	uint32_t    num_slots, slot_size;
+	size_t      size;
+	
+	if (fstat(fd, &s) != 0 || (size_t) s.st_size < sizeof(header_t) ||
+	    !is_sealed(fd)) {
+		return NULL;
+	}
+	
+	hdr = (header_t *) mmap(NULL, (size_t) s.st_size, PROT_READ | PROT_WRITE,
+	                        MAP_SHARED, fd, 0);
+	if (hdr == MAP_FAILED) {
+		return NULL;
+	}
+	
+	// - the shape is taken once, so a peer can't later steer us outside it
+	num_slots = hdr->num_slots;
+	slot_size = hdr->slot_size;
+	size      = sizeof(header_t) + (size_t) num_slots * stride_of(slot_size);
+	if (std::memcmp(hdr->magic, RING_MAGIC, sizeof(hdr->magic)) ||
+	    (hdr->kind != un::RING_SPSC && hdr->kind != un::RING_MPMC) ||
+	    !num_slots || num_slots > RING_MAX || (num_slots & (num_slots - 1)) ||
+	    !slot_size || slot_size > RING_MAX || size > (size_t) s.st_size ||
+	    !(ring = (un::ring_t *) std::calloc(1, sizeof(un::ring_t)))) {
+		munmap(hdr, (size_t) s.st_size);
+		return NULL;
+	}
+	
+	ring->hdr       = hdr;
+	ring->size      = (size_t) s.st_size;
+	ring->stride    = stride_of(slot_size);
+	ring->num_slots = num_slots;
+	ring->slot_size = slot_size;
+	ring->kind      = (un::ring_kind_e) hdr->kind;
+	ring->fd        = fd;
+	ring->spins     = sysconf(_SC_NPROCESSORS_ONLN) > 1 ? RING_SPINS : 0;
+	ring->tail_seen = __atomic_load_n(&hdr->tail, __ATOMIC_ACQUIRE);
+	ring->head_seen = ring->tail_seen;
+	return ring;
+}
+
+
+un::ring_t *un::ring_create( ring_kind_e kind, uint32_t slots,
+                             uint32_t slot_size ) {
+	uint32_t num_slots = 1;
+	size_t   size;
+	header_t *hdr;
+	ring_t   *ret;
+	int      fd;
+	
+	if ((kind != RING_SPSC && kind != RING_MPMC) || !slots ||
+	    slots > RING_MAX || !slot_size || slot_size > RING_MAX) {
+		return NULL;
+	}
+	while (num_slots < slots) {
+		num_slots <<= 1;
+	}
+	
+	size = sizeof(header_t) + (size_t) num_slots * stride_of(slot_size);
+	if ((fd = open_region(size)) < 0) {
+		return NULL;
+	}
+	
+	hdr = (header_t *) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+	                        fd, 0);
+	if (hdr == MAP_FAILED) {
+		close(fd);
+		return NULL;
+	}
+	
+	// - a new region is zero-filled, so only the shape and slots are set
+	std::memcpy(hdr->magic, RING_MAGIC, sizeof(hdr->magic));
+	hdr->kind      = (uint32_t) kind;
+	hdr->num_slots = num_slots;
+	hdr->slot_size = slot_size;
+	hdr->size      = size;
+	for (uint32_t i = 0; i < num_slots; i++) {
+		((slot_t *) (hdr->data + (size_t) i * stride_of(slot_size)))->seq = i;
+	}
+	munmap(hdr, size);
+	
+	if (!(ret = map_ring(fd))) {
+		close(fd);
+	}
+	return ret;
+}
+
+
+// - maps a descriptor of its own, the caller's is left open
+un::ring_t *un::ring_attach( int fd ) {
+	ring_t *ret;
+	int    own = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+	
+	if (own < 0) {
+		return NULL;
+	}
+	if (!(ret = map_ring(own))) {
+		close(own);
+	}
+	return ret;
+}
+
+
+int un::ring_fd( const ring_t *ring ) {
+	return ring->fd;
+}
+
+
+uint32_t un::ring_slot_size( const ring_t *ring ) {
+	return ring->slot_size;
+}
+
+
+void un::ring_close( ring_t *ring ) {
+	if (!ring) {
+		return;
+	}
+	munmap(ring->hdr, ring->size);
+	close(ring->fd);
+	std::free(ring);
+}
+
+
+static inline void put( slot_t *slot, const un::ring_msg_t *msg ) {
+	slot->len = msg->len;
+	std::memcpy(slot + 1, msg->data, msg->len);
+}
+
+
+static inline void take( const un::ring_t *ring, const slot_t *slot,
+                         un::ring_msg_t *msg ) {
+	uint32_t len = slot->len < ring->slot_size ? slot->len : ring->slot_size;
+	
+	msg->len = len < msg->len ? len : msg->len;
+	std::memcpy(msg->data, slot + 1, msg->len);
+}
+
+
+// - the whole batch is published with one store
+static unsigned spsc_send( un::ring_t *ring, const un::ring_msg_t *msgs,
+                           unsigned count ) {
+	header_t *hdr = ring->hdr;
+	uint64_t head = __atomic_load_n(&hdr->head, __ATOMIC_RELAXED);
+	unsigned n;
+	
+	for (n = 0; n < count && msgs[n].len <= ring->slot_size; n++, head++) {
+		if (head - ring->tail_seen >= ring->num_slots) {
+			ring->tail_seen = __atomic_load_n(&hdr->tail, __ATOMIC_ACQUIRE);
+			if (head - ring->tail_seen >= ring->num_slots) {
+				break;
+			}
+		}
+		put(slot_at(ring, head), &msgs[n]);
+	}
+	
+	if (n) {
+		__atomic_store_n(&hdr->head, head, __ATOMIC_RELEASE);
+	}
+	return n;
+}
+
+
+static unsigned spsc_recv( un::ring_t *ring, un::ring_msg_t *msgs,
+                           unsigned count ) {
+	header_t *hdr = ring->hdr;
+	uint64_t tail = __atomic_load_n(&hdr->tail, __ATOMIC_RELAXED);
+	uint64_t avail;
+	unsigned n;
+	
+	if ((int64_t) (ring->head_seen - tail) <= 0) {
+		ring->head_seen = __atomic_load_n(&hdr->head, __ATOMIC_ACQUIRE);
+	}
+	avail = ring->head_seen - tail;
+	avail = avail > ring->num_slots ? ring->num_slots : avail;
+	
+	for (n = 0; n < count && n < avail; n++) {
+		take(ring, slot_at(ring, tail + n), &msgs[n]);
+	}
+	
+	if (n) {
+		__atomic_store_n(&hdr->tail, tail + n, __ATOMIC_RELEASE);
+	}
+	return n;
+}
+
+
+static unsigned mpmc_send( un::ring_t *ring, const un::ring_msg_t *msgs,
+                           unsigned count ) {
+	header_t *hdr = ring->hdr;
+	slot_t   *slot;
+	uint64_t pos;
+	int64_t  dif;
+	unsigned n;
+	
+	for (n = 0; n < count && msgs[n].len <= ring->slot_size; n++) {
+		pos = __atomic_load_n(&hdr->head, __ATOMIC_RELAXED);
+		for (;;) {
+			slot = slot_at(ring, pos);
+			dif  = (int64_t) (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) -
+			                  pos);
+			if (dif == 0) {
+				if (__atomic_compare_exchange_n(&hdr->head, &pos, pos + 1, true,
+				                                __ATOMIC_RELAXED,
+				                                __ATOMIC_RELAXED)) {
+					break;
+				}
+			} else if (dif < 0) {
+				return n;
+			} else {
+				pos = __atomic_load_n(&hdr->head, __ATOMIC_RELAXED);
+			}
+		}
+		
+		put(slot, &msgs[n]);
+		__atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+	}
+	return n;
+}
+
+
+static unsigned mpmc_recv( un::ring_t *ring, un::ring_msg_t *msgs,
+                           unsigned count ) {
+	header_t *hdr = ring->hdr;
+	slot_t   *slot;
+	uint64_t pos;
+	int64_t  dif;
+	unsigned n;
+	
+	for (n = 0; n < count; n++) {
+		pos = __atomic_load_n(&hdr->tail, __ATOMIC_RELAXED);
+		for (;;) {
+			slot = slot_at(ring, pos);
+			dif  = (int64_t) (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) -
+			                  (pos + 1));
+			if (dif == 0) {
+				if (__atomic_compare_exchange_n(&hdr->tail, &pos, pos + 1, true,
+				                                __ATOMIC_RELAXED,
+				                                __ATOMIC_RELAXED)) {
+					break;
+				}
+			} else if (dif < 0) {
+				return n;
+			} else {
+				pos = __atomic_load_n(&hdr->tail, __ATOMIC_RELAXED);
+			}
+		}
+		
+		take(ring, slot, &msgs[n]);
+		__atomic_store_n(&slot->seq, pos + ring->num_slots, __ATOMIC_RELEASE);
+	}
+	return n;
+}
+
+
+static bool is_ready( un::ring_t *ring, bool is_send ) {
+	header_t *hdr = ring->hdr;
+	uint64_t head, tail, pos;
+	
+	if (ring->kind == un::RING_SPSC) {
+		head = __atomic_load_n(&hdr->head, __ATOMIC_ACQUIRE);
+		tail = __atomic_load_n(&hdr->tail, __ATOMIC_ACQUIRE);
+		return is_send ? head - tail < ring->num_slots : head != tail;
+	}
+	
+	pos = __atomic_load_n(is_send ? &hdr->head : &hdr->tail, __ATOMIC_RELAXED);
+	return (int64_t) (__atomic_load_n(&slot_at(ring, pos)->seq,
+	                                  __ATOMIC_ACQUIRE) - pos) >=
+	       (is_send ? 0 : 1);
+}
+
+
+/*
+ *  The waiter reads the word before counting itself and the other side
+ *  bumps it after seeing the count, so a wakeup between its last look at
+ *  the ring and the futex call makes the call return at once.
+ */
+static bool wait_for( un::ring_t *ring, bool is_send, int64_t deadline ) {
+	uint32_t *word    = is_send ? &ring->hdr->taken : &ring->hdr->sent;
+	uint32_t *waiting = is_send ? &ring->hdr->num_send_wait :
+	                              &ring->hdr->num_recv_wait;
+	uint32_t seen;
+	bool     is_ok;
+	int      left;
+	
+	for (int i = 0; i < ring->spins; i++) {
+		if (is_ready(ring, is_send)) {
+			return true;
+		}
+		cpu_relax();
+	}
+	
+	for (;;) {
+		left = remaining(deadline);
+		seen = __atomic_load_n(word, __ATOMIC_ACQUIRE);
+		__atomic_fetch_add(waiting, 1, __ATOMIC_SEQ_CST);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		if (!(is_ok = is_ready(ring, is_send)) && left != 0) {
+			wait_word(word, seen, left);
+		}
+		__atomic_fetch_sub(waiting, 1, __ATOMIC_RELEASE);
+		if (is_ok || left == 0) {
+			return is_ok;
+		}
+	}
+}
+
+
+static void wake( un::ring_t *ring, bool is_send, unsigned count ) {
+	uint32_t *word    = is_send ? &ring->hdr->sent : &ring->hdr->taken;
+	uint32_t *waiting = is_send ? &ring->hdr->num_recv_wait :
+	                              &ring->hdr->num_send_wait;
+	
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(waiting, __ATOMIC_RELAXED)) {
+		__atomic_fetch_add(word, 1, __ATOMIC_RELEASE);
+		wake_word(word, count);
+	}
+}
+
+
+unsigned un::ring_send( ring_t *ring, const ring_msg_t *msgs, unsigned count,
+                        int timeout_ms ) {
+	int64_t  deadline = deadline_of(timeout_ms);
+	unsigned ret      = 0, n;
+	
+	while (ret < count) {
+		n = ring->kind == RING_SPSC ? spsc_send(ring, msgs + ret, count - ret) :
+		                              mpmc_send(ring, msgs + ret, count - ret);
+		if (n) {
+			wake(ring, true, n);
+			ret += n;
+			
+		} else if (msgs[ret].len > ring->slot_size ||
+		           !wait_for(ring, true, deadline)) {
+			break;
+		}
+	}
+	return ret;
+}
+
+
+unsigned un::ring_recv( ring_t *ring, ring_msg_t *msgs, unsigned count,
+                        int timeout_ms ) {
+	int64_t  deadline = deadline_of(timeout_ms);
+	unsigned n;
+	
+	while (count) {
+		n = ring->kind == RING_SPSC ? spsc_recv(ring, msgs, count) :
+		                              mpmc_recv(ring, msgs, count);
+		if (n) {
+			wake(ring, false, n);
+			return n;
+		}
+		
+		if (!wait_for(ring, false, deadline)) {
+			break;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,72 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_RING_H
+#define UNUM_RING_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  A ring is a bounded queue of fixed-size message slots in a region of
+ *  shared memory, for linkage between kernels on the same host without a
+ *  trip through the socket layer.  The region is a descriptor, so it is
+ *  handed to the other kernel the same way as any other, whether inherited
+ *  or sent over a socket, and each side attaches its own mapping.  A call
+ *  between two kernels is a pair of rings, one in each direction.
+ *
+ *  Neither side takes a lock and a waiting side only costs the other a
+ *  system call to wake it, once for each batch.  A single-producer ring
+ *  is cheaper still, but must only ever have one sender and one receiver
+ *  at a time.
+ */
+typedef struct ring_s ring_t;
+
+typedef enum {
+	RING_SPSC = 1,
+	RING_MPMC = 2
+} ring_kind_e;
+
+typedef struct {
+	void     *data;
+	uint32_t len;       // - bytes to send, or the capacity and then size received
+} ring_msg_t;
+
+
+// - NULL on failure, `slots` is rounded up to a power of two
+extern ring_t   *ring_create( ring_kind_e kind, uint32_t slots,
+                              uint32_t slot_size );
+extern ring_t   *ring_attach( int fd );
+extern int      ring_fd( const ring_t *ring );
+extern uint32_t ring_slot_size( const ring_t *ring );
+extern void     ring_close( ring_t *ring );
+
+
+/*
+ *  ring_send()
+ *  - queues the messages in order, waiting up to `timeout_ms` (-1 forever)
+ *    for room, and returns how many were queued.  A message larger than
+ *    the slot size is never queued.
+ *
+ *  ring_recv()
+ *  - waits up to `timeout_ms` for a message and then takes as many as are
+ *    waiting, up to `count`, returning how many were taken.  A message
+ *    larger than its buffer is truncated.
+ */
+extern unsigned ring_send( ring_t *ring, const ring_msg_t *msgs, unsigned count,
+                           int timeout_ms );
+extern unsigned ring_recv( ring_t *ring, ring_msg_t *msgs, unsigned count,
+                           int timeout_ms );
+
+
+}
+#endif /* UNUM_RING_H */
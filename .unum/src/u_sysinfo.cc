@@ -0,0 +1,190 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include "u_common.h"
+#include "u_sysinfo.h"
+
+#if UNUM_OS_MACOS
+#include <sys/sysctl.h>
+#endif
+
+#define SYS_CPU_DIR   "/sys/devices/system/cpu"
+#define SYS_NODE_DIR  "/sys/devices/system/node"
+
+
+static bool read_line( const char *path, char *buf, size_t len ) {
+	FILE *fp = std::fopen(path, "r");
+	bool ret = false;
+	
+	if (fp) {
+		ret = std::fgets(buf, (int) len, fp) != NULL;
+		std::fclose(fp);
+	}
+	
+	return ret;
+}
+
+
+// ...counts the entries in a sysfs list (eg. "0-3,8-11")
+static int count_list( const char *path ) {
+	char buf[1024];
+	int  ret = 0;
+	
+	if (!read_line(path, buf, sizeof(buf))) {
+		return 0;
+	}
+	
+	for (char *bp = buf; *bp && !std::isspace(*bp);) {
+		long first = std::strtol(bp, &bp, 10);
+		long last  = (*bp == '-') ? std::strtol(bp + 1, &bp, 10) : first;
+		
+		ret += (int) (last - first + 1);
+		if (*bp == ',') {
+			bp++;
+		}
+	}
+	
+	return ret;
+}
+
+
+// ...sysfs cache sizes are expressed as "48K" or "8M", as uboot parses them
+static long read_size( const char *path ) {
+	char buf[64];
+	char *bp;
+	long ret;
+	
+	if (!read_line(path, buf, sizeof(buf))) {
+		return 0;
+	}
+	
+	ret = std::strtol(buf, &bp, 10);
+	switch (*bp) {
+	case 'K':
+		return ret * 1024;
+		
+	case 'M':
+		return ret * 1024 * 1024;
+		
+	case 'G':
+		return ret * 1024 * 1024 * 1024;
+		
+	default:
+		return ret;
+	}
+}
+
+
+#if UNUM_OS_MACOS
+static long sysctl_long( const char *name ) {
+	long long value = 0;
+	size_t    len   = sizeof(value);
+	
+	if (sysctlbyname(name, &value, &len, NULL, 0) != 0) {
+		return 0;
+	}
+	
+	return len == sizeof(int) ? (long) *(int *) &value : (long) value;
+}
+#endif
+
+
+static void query_host( un::sysinfo_t *info ) {
+#if UNUM_OS_MACOS
+	long physical      = sysctl_long("hw.physicalcpu");
+	
+	info->cpus_online  = (int) sysctl_long("hw.activecpu");
+	info->smt_per_core = physical ? (int) (sysctl_long("hw.logicalcpu") /
+	                                       physical) : 0;
+	info->cache_l1d    = sysctl_long("hw.l1dcachesize");
+	info->cache_l2     = sysctl_long("hw.l2cachesize");
+	info->cache_l3     = sysctl_long("hw.l3cachesize");
+	info->cache_line   = (int) sysctl_long("hw.cachelinesize");
+	info->numa_nodes   = 1;
+	
+#else
+	char path[256];
+	char type[64];
+	
+	info->cpus_online  = count_list(SYS_CPU_DIR "/online");
+	info->smt_per_core = count_list(SYS_CPU_DIR
+	                                "/cpu0/topology/thread_siblings_list");
+	info->numa_nodes   = count_list(SYS_NODE_DIR "/online");
+	
+	for (int i = 0; ; i++) {
+		long level;
+		
+		std::snprintf(path, sizeof(path), SYS_CPU_DIR "/cpu0/cache/index%d/"
+		              "level", i);
+		if (!(level = read_size(path))) {
+			break;
+		}
+		
+		std::snprintf(path, sizeof(path), SYS_CPU_DIR "/cpu0/cache/index%d/"
+		              "type", i);
+		if (!read_line(path, type, sizeof(type)) ||
+		    !std::strncmp(type, "Instruction", 11)) {
+			continue;
+		}
+		
+		std::snprintf(path, sizeof(path), SYS_CPU_DIR "/cpu0/cache/index%d/"
+		              "size", i);
+		switch (level) {
+		case 1:
+			info->cache_l1d = read_size(path);
+			break;
+			
+		case 2:
+			info->cache_l2  = read_size(path);
+			break;
+			
+		case 3:
+			info->cache_l3  = read_size(path);
+			break;
+		}
+		
+		if (!info->cache_line) {
+			std::snprintf(path, sizeof(path), SYS_CPU_DIR "/cpu0/cache/"
+			              "index%d/coherency_line_size", i);
+			info->cache_line = (int) read_size(path);
+		}
+	}
+#endif
+}
+
+
+void un::sysinfo_query( sysinfo_t *info ) {
+	std::memset(info, 0, sizeof(*info));
+	
+	query_host(info);
+	
+	// - anything the host won't disclose falls back to what was captured
+	//   during bootstrapping.
+	if (info->cpus_online <= 0) {
+		long ncpu         = sysconf(_SC_NPROCESSORS_ONLN);
+		info->cpus_online = ncpu > 0 ? (int) ncpu : UNUM_HW_CPUS;
+	}
+	
+	info->smt_per_core = info->smt_per_core > 0 ? info->smt_per_core :
+	                                              UNUM_HW_SMT;
+	info->cache_l1d    = info->cache_l1d > 0 ? info->cache_l1d :
+	                                           UNUM_HW_CACHE_L1D;
+	info->cache_l2     = info->cache_l2 > 0 ? info->cache_l2 :
+	                                          UNUM_HW_CACHE_L2;
+	info->cache_l3     = info->cache_l3 > 0 ? info->cache_l3 :
+	                                          UNUM_HW_CACHE_L3;
+	info->cache_line   = info->cache_line > 0 ? info->cache_line :
+	                                            UNUM_HW_CACHE_LINE;
+	info->numa_nodes   = info->numa_nodes > 0 ? info->numa_nodes :
+	                                            UNUM_HW_NUMA_NODES;
+}
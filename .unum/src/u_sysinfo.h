@@ -0,0 +1,36 @@
+/*-------------------------------------------------------------------
+| vi: set noet ts=4 sw=4 fenc=utf-8
+| -------------------------------------------------------------------
+| Copyright (c) 2025 Francis Henry Grolemund III and RealProven, LLC.
+| SPDX-License-Identifier: LicenseRef-Unum-Commercial OR GPL-3.0-only
+| -------------------------------------------------------------------*/
+
+#ifndef UNUM_SYSINFO_H
+#define UNUM_SYSINFO_H
+
+
+// -- UNUM NAMESPACE
+namespace un {
+
+
+/*
+ *  Hardware topology of the host.  The same values are captured by uboot
+ *  as UNUM_HW_* constants for compile-time tuning, these are the runtime
+ *  equivalents for when the basis has moved to different hardware.
+ */
+typedef struct {
+	int  cpus_online;
+	int  smt_per_core;
+	long cache_l1d;
+	long cache_l2;
+	long cache_l3;
+	int  cache_line;
+	int  numa_nodes;
+} sysinfo_t;
+
+
+extern void sysinfo_query( sysinfo_t *info );
+
+
+}
+#endif /* UNUM_SYSINFO_H */